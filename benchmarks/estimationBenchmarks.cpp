@@ -0,0 +1,771 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    End-to-end benchmark suite for the estimation. For each scenario, the observations are simulated from the
+ *    unperturbed parameters, after which a fixed number of estimation iterations is performed from perturbed parameters.
+ *    For each iteration, the wall time is split into the phases recorded by the trace scopes of the estimation (see
+ *    tracing.h):
+ *    - propagation: numerical integration of the equations of motion and variational equations (which are integrated
+ *      concurrently, as a single state)
+ *    - variational_interpolation: creation of the state transition and sensitivity matrix interpolators
+ *    - partials: computation of the observations and observation partials
+ *    - assembly: assembly of the design matrix (or normal equations) and residuals from the partials
+ *    - solve: solution of the least squares problem
+ *    The results are printed to the console, and can be written to a JSON file for regression tracking.
+ *
+ *    Usage: tudat_estimation_benchmarks [--json <file>] [--iterations <number>] [--threads <number>] [scenario ...]
+ *    (all scenarios are run if none are given)
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "tudat/basics/modelEvaluationProfiler.h"
+#include "tudat/basics/tracing.h"
+#include "tudat/simulation/simulation.h"
+#include "tudat/simulation/estimation_setup/orbitDeterminationManager.h"
+#include "tudat/simulation/estimation_setup/simulateObservations.h"
+#include "tudat/simulation/environment_setup/createGroundStations.h"
+
+using namespace tudat;
+using namespace tudat::numerical_integrators;
+using namespace tudat::simulation_setup;
+using namespace tudat::propagators;
+using namespace tudat::basic_astrodynamics;
+using namespace tudat::orbital_element_conversions;
+using namespace tudat::observation_models;
+using namespace tudat::estimatable_parameters;
+
+//! Wall time (in seconds) of each phase of a single estimation iteration
+struct IterationTimings
+{
+    int iteration_ = -1;
+    double totalTime_ = 0.0;
+    double propagationTime_ = 0.0;
+    double variationalInterpolationTime_ = 0.0;
+    double partialsTime_ = 0.0;
+    double assemblyTime_ = 0.0;
+    double solveTime_ = 0.0;
+};
+
+//! Results of a single estimation benchmark scenario
+struct EstimationBenchmarkResult
+{
+    std::string scenarioName_;
+    int numberOfObservations_ = 0;
+    int numberOfParameters_ = 0;
+    double setupTime_ = TUDAT_NAN;
+    double memoryFootprint_ = TUDAT_NAN;
+    std::vector< IterationTimings > iterationTimings_;
+    std::string failureMessage_;
+};
+
+//! Settings of a single estimation benchmark scenario, as created by the scenario functions
+struct EstimationBenchmarkScenario
+{
+    SystemOfBodies bodies_;
+    std::shared_ptr< EstimatableParameterSet< double > > parametersToEstimate_;
+    std::vector< std::shared_ptr< ObservationModelSettings > > observationSettingsList_;
+    std::shared_ptr< PropagatorSettings< double > > propagatorSettings_;
+    std::vector< std::shared_ptr< ObservationSimulationSettings< double > > > observationSimulationSettings_;
+    std::map< ObservableType, double > weightPerObservable_;
+};
+
+//! Function to retrieve the wall time (in seconds) elapsed since a given time point
+double getElapsedWallTime( const std::chrono::steady_clock::time_point& startTime )
+{
+    return std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+}
+
+//! Function to retrieve the wall time (in seconds) covered by a set of trace events, within a given time window
+/*!
+ *  Function to retrieve the wall time (in seconds) covered by all trace events with any of the given names, within a
+ *  given time window. Overlapping events (nested events, or events on different threads) are counted only once.
+ *  \param traceEvents List of trace events (with thread indices), as retrieved from utilities::getTraceEvents
+ *  \param eventNames Names of the events that are to be included
+ *  \param windowStart Start of the time window (in microseconds since the trace reference epoch)
+ *  \param windowEnd End of the time window (in microseconds since the trace reference epoch)
+ *  \return Wall time covered by the events (in seconds)
+ */
+double getTraceEventWallTime(
+        const std::vector< std::pair< int, utilities::TraceEvent > >& traceEvents,
+        const std::vector< std::string >& eventNames,
+        const double windowStart,
+        const double windowEnd )
+{
+    std::vector< std::pair< double, double > > eventIntervals;
+    for( unsigned int i = 0; i < traceEvents.size( ); i++ )
+    {
+        const utilities::TraceEvent& currentEvent = traceEvents.at( i ).second;
+        if( std::find( eventNames.begin( ), eventNames.end( ), std::string( currentEvent.name_ ) ) != eventNames.end( ) )
+        {
+            double intervalStart = std::max( currentEvent.startTime_, windowStart );
+            double intervalEnd = std::min( currentEvent.startTime_ + currentEvent.duration_, windowEnd );
+            if( intervalEnd > intervalStart )
+            {
+                eventIntervals.push_back( std::make_pair( intervalStart, intervalEnd ) );
+            }
+        }
+    }
+    std::sort( eventIntervals.begin( ), eventIntervals.end( ) );
+
+    // Sum lengths of the union of the intervals
+    double wallTime = 0.0;
+    double currentEnd = -std::numeric_limits< double >::infinity( );
+    for( unsigned int i = 0; i < eventIntervals.size( ); i++ )
+    {
+        if( eventIntervals.at( i ).second > currentEnd )
+        {
+            wallTime += eventIntervals.at( i ).second - std::max( eventIntervals.at( i ).first, currentEnd );
+            currentEnd = eventIntervals.at( i ).second;
+        }
+    }
+    return wallTime * 1.0E-6;
+}
+
+//! Function to split the wall time of each estimation iteration into phases, from the recorded trace events
+std::vector< IterationTimings > getIterationTimings(
+        const std::vector< std::pair< int, utilities::TraceEvent > >& traceEvents,
+        const double windowStart,
+        const double windowEnd )
+{
+    std::vector< IterationTimings > iterationTimings;
+    for( unsigned int i = 0; i < traceEvents.size( ); i++ )
+    {
+        const utilities::TraceEvent& currentEvent = traceEvents.at( i ).second;
+        if( std::string( currentEvent.name_ ) == "estimation_iteration" && currentEvent.startTime_ >= windowStart &&
+                currentEvent.startTime_ + currentEvent.duration_ <= windowEnd )
+        {
+            double iterationStart = currentEvent.startTime_;
+            double iterationEnd = currentEvent.startTime_ + currentEvent.duration_;
+
+            IterationTimings currentTimings;
+            currentTimings.iteration_ = static_cast< int >( currentEvent.index_ );
+            currentTimings.totalTime_ = currentEvent.duration_ * 1.0E-6;
+            currentTimings.variationalInterpolationTime_ = getTraceEventWallTime(
+                        traceEvents, { "variational_interpolators" }, iterationStart, iterationEnd );
+            currentTimings.propagationTime_ = getTraceEventWallTime(
+                        traceEvents, { "single_arc_variational_equations", "multi_arc_variational_equations",
+                                       "hybrid_arc_variational_equations" }, iterationStart, iterationEnd ) -
+                    currentTimings.variationalInterpolationTime_;
+            currentTimings.partialsTime_ = getTraceEventWallTime(
+                        traceEvents, { "observation_partials" }, iterationStart, iterationEnd );
+            currentTimings.assemblyTime_ = getTraceEventWallTime(
+                        traceEvents, { "design_matrix", "normal_equations" }, iterationStart, iterationEnd ) -
+                    currentTimings.partialsTime_;
+            currentTimings.solveTime_ = getTraceEventWallTime(
+                        traceEvents, { "least_squares_solution" }, iterationStart, iterationEnd );
+            iterationTimings.push_back( currentTimings );
+        }
+    }
+
+    std::sort( iterationTimings.begin( ), iterationTimings.end( ),
+               [ ]( const IterationTimings& first, const IterationTimings& second )
+    { return first.iteration_ < second.iteration_; } );
+    return iterationTimings;
+}
+
+//! Function to create a list of equispaced observation times in [startTime, endTime)
+std::vector< double > getObservationTimes( const double startTime, const double endTime, const double timeStep )
+{
+    std::vector< double > observationTimes;
+    for( double currentTime = startTime; currentTime < endTime; currentTime += timeStep )
+    {
+        observationTimes.push_back( currentTime );
+    }
+    return observationTimes;
+}
+
+//! Function to simulate the observations of a scenario, and perform a fixed number of iterations from perturbed parameters
+/*!
+ *  Function to simulate the observations of a scenario, and perform a fixed number of iterations from perturbed
+ *  parameters. The initial state parameters are perturbed by 10 m in position and 1 mm/s in velocity, all other
+ *  parameters by a relative 1.0E-4.
+ *  \param scenario Settings of the scenario
+ *  \param numberOfIterations Number of estimation iterations that is to be performed
+ *  \param numberOfThreads Number of threads used for the computation of the partials
+ *  \param result Results of the benchmark (returned by reference)
+ */
+void runEstimationBenchmark(
+        const EstimationBenchmarkScenario& scenario,
+        const int numberOfIterations,
+        const int numberOfThreads,
+        EstimationBenchmarkResult& result )
+{
+    // Create estimation objects, and simulate observations
+    std::chrono::steady_clock::time_point setupStartTime = std::chrono::steady_clock::now( );
+    OrbitDeterminationManager< double, double > orbitDeterminationManager(
+                scenario.bodies_, scenario.parametersToEstimate_, scenario.observationSettingsList_,
+                scenario.propagatorSettings_ );
+    orbitDeterminationManager.setNumberOfDesignMatrixThreads( numberOfThreads );
+    std::shared_ptr< ObservationCollection< double, double > > simulatedObservations =
+            simulateObservations< double, double >(
+                scenario.observationSimulationSettings_, orbitDeterminationManager.getObservationSimulators( ),
+                scenario.bodies_ );
+    result.setupTime_ = getElapsedWallTime( setupStartTime );
+    result.numberOfObservations_ = simulatedObservations->getTotalObservableSize( );
+    result.numberOfParameters_ = scenario.parametersToEstimate_->getParameterSetSize( );
+
+    // Perturb parameters
+    Eigen::VectorXd initialParameterEstimate = scenario.parametersToEstimate_->getFullParameterValues< double >( );
+    int initialStateSize = scenario.parametersToEstimate_->getInitialDynamicalStateParameterSize( );
+    for( int i = 0; i < initialParameterEstimate.rows( ); i++ )
+    {
+        if( i < initialStateSize )
+        {
+            initialParameterEstimate( i ) += ( ( i % 6 ) < 3 ) ? 10.0 : 1.0E-3;
+        }
+        else
+        {
+            initialParameterEstimate( i ) *= ( 1.0 + 1.0E-4 );
+        }
+    }
+    scenario.parametersToEstimate_->resetParameterValues( initialParameterEstimate );
+
+    std::shared_ptr< EstimationInput< double, double > > estimationInput =
+            std::make_shared< EstimationInput< double, double > >( simulatedObservations );
+    estimationInput->setConstantPerObservableWeightsMatrix( scenario.weightPerObservable_ );
+    estimationInput->defineEstimationSettings( true, true, false, false, false );
+    estimationInput->setConvergenceChecker( std::make_shared< EstimationConvergenceChecker >(
+                                                numberOfIterations, 0.0, 1.0E-20, numberOfIterations + 1 ) );
+
+    // Perform estimation, recording the trace events of the estimation
+    bool wasTracingEnabled = utilities::isTracingEnabled( );
+    utilities::setTracingEnabled( true );
+    std::shared_ptr< EstimationOutput< double, double > > estimationOutput;
+    {
+        TUDAT_TRACE_SCOPE( "benchmark_estimation", "benchmark" );
+        estimationOutput = orbitDeterminationManager.estimateParameters( estimationInput );
+    }
+    utilities::setTracingEnabled( wasTracingEnabled );
+    result.memoryFootprint_ = static_cast< double >( estimationOutput->getMemoryFootprint( ).getTotalSize( ) );
+
+    // Retrieve time window of this estimation (last recorded benchmark event), and timings of each iteration
+    std::vector< std::pair< int, utilities::TraceEvent > > traceEvents = utilities::getTraceEvents( );
+    for( auto eventIterator = traceEvents.rbegin( ); eventIterator != traceEvents.rend( ); eventIterator++ )
+    {
+        if( std::string( eventIterator->second.name_ ) == "benchmark_estimation" )
+        {
+            result.iterationTimings_ = getIterationTimings(
+                        traceEvents, eventIterator->second.startTime_,
+                        eventIterator->second.startTime_ + eventIterator->second.duration_ );
+            break;
+        }
+    }
+}
+
+//! Single-arc low Earth orbiter, with range and Doppler data from three ground stations (one day of data)
+EstimationBenchmarkScenario createLeoRangeDopplerScenario( )
+{
+    double initialTime = 1.0E7;
+    double finalTime = initialTime + 86400.0;
+
+    EstimationBenchmarkScenario scenario;
+    BodyListSettings bodySettings = getDefaultBodySettings(
+                { "Sun", "Earth", "Moon" }, initialTime - 3600.0, finalTime + 3600.0, "Earth", "J2000" );
+    bodySettings.at( "Earth" )->gravityFieldSettings =
+            std::make_shared< FromFileSphericalHarmonicsGravityFieldSettings >( egm96, 32 );
+    bodySettings.at( "Earth" )->atmosphereSettings = exponentialAtmosphereSettings( "Earth" );
+    scenario.bodies_ = createSystemOfBodies( bodySettings );
+    SystemOfBodies& bodies = scenario.bodies_;
+
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.at( "Vehicle" )->setConstantBodyMass( 400.0 );
+    bodies.at( "Vehicle" )->setAerodynamicCoefficientInterface(
+                createAerodynamicCoefficientInterface(
+                    constantAerodynamicCoefficientSettings( 4.0, 1.2 * Eigen::Vector3d::UnitX( ) ), "Vehicle", bodies ) );
+    bodies.at( "Vehicle" )->setEphemeris( std::make_shared< ephemerides::TabulatedCartesianEphemeris< > >(
+                                              std::shared_ptr< interpolators::OneDimensionalInterpolator
+                                              < double, Eigen::Vector6d > >( ), "Earth", "J2000" ) );
+
+    std::vector< std::string > stationNames = { "Station1", "Station2", "Station3" };
+    createGroundStation( bodies.at( "Earth" ), "Station1", ( Eigen::Vector3d( ) << 0.0, 0.35, 0.0 ).finished( ),
+                         coordinate_conversions::geodetic_position );
+    createGroundStation( bodies.at( "Earth" ), "Station2", ( Eigen::Vector3d( ) << 0.0, -0.55, 2.0 ).finished( ),
+                         coordinate_conversions::geodetic_position );
+    createGroundStation( bodies.at( "Earth" ), "Station3", ( Eigen::Vector3d( ) << 0.0, 0.05, 4.0 ).finished( ),
+                         coordinate_conversions::geodetic_position );
+
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back( sphericalHarmonicAcceleration( 32, 32 ) );
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back( aerodynamicAcceleration( ) );
+    accelerationSettings[ "Vehicle" ][ "Sun" ].push_back( pointMassGravityAcceleration( ) );
+    accelerationSettings[ "Vehicle" ][ "Moon" ].push_back( pointMassGravityAcceleration( ) );
+    AccelerationMap accelerationModels = createAccelerationModelsMap(
+                bodies, accelerationSettings, { "Vehicle" }, { "Earth" } );
+
+    Eigen::Vector6d initialKeplerElements;
+    initialKeplerElements << 6378.0E3 + 450.0E3, 0.001, 1.4, 0.2, 0.3, 0.4;
+    Eigen::Vector6d initialState = convertKeplerianToCartesianElements(
+                initialKeplerElements, bodies.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( ) );
+    scenario.propagatorSettings_ = translationalStatePropagatorSettings< double >(
+                { "Earth" }, accelerationModels, { "Vehicle" }, initialState, initialTime,
+                rungeKuttaFixedStepSettings< double >( 30.0, CoefficientSets::rungeKuttaFehlberg78 ),
+                propagationTimeTerminationSettings( finalTime ) );
+
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterSettings =
+            getInitialStateParameterSettings< double >( scenario.propagatorSettings_, bodies );
+    parameterSettings.push_back( std::make_shared< EstimatableParameterSettings >( "Vehicle", constant_drag_coefficient ) );
+    scenario.parametersToEstimate_ = createParametersToEstimate< double >( parameterSettings, bodies );
+
+    std::vector< double > observationTimes = getObservationTimes( initialTime + 600.0, finalTime - 600.0, 30.0 );
+    for( unsigned int i = 0; i < stationNames.size( ); i++ )
+    {
+        LinkEnds uplinkEnds;
+        uplinkEnds[ transmitter ] = LinkEndId( "Earth", stationNames.at( i ) );
+        uplinkEnds[ receiver ] = LinkEndId( "Vehicle" );
+        LinkEnds downlinkEnds;
+        downlinkEnds[ transmitter ] = LinkEndId( "Vehicle" );
+        downlinkEnds[ receiver ] = LinkEndId( "Earth", stationNames.at( i ) );
+
+        for( ObservableType currentObservable: { one_way_range, one_way_doppler } )
+        {
+            for( const LinkEnds& currentLinkEnds: { uplinkEnds, downlinkEnds } )
+            {
+                scenario.observationSettingsList_.push_back(
+                            std::make_shared< ObservationModelSettings >( currentObservable, currentLinkEnds ) );
+                scenario.observationSimulationSettings_.push_back(
+                            std::make_shared< TabulatedObservationSimulationSettings< double > >(
+                                currentObservable, currentLinkEnds, observationTimes, receiver ) );
+            }
+        }
+    }
+    scenario.weightPerObservable_[ one_way_range ] = 1.0;
+    scenario.weightPerObservable_[ one_way_doppler ] = 1.0E10;
+    return scenario;
+}
+
+//! Multi-arc Mars orbiter, with Mars gravity field recovery (degree 20) from Earth-based range and Doppler (four arcs)
+EstimationBenchmarkScenario createPlanetaryOrbiterGravityScenario( )
+{
+    double initialTime = 1.0E7;
+    double arcDuration = 86400.0;
+    int numberOfArcs = 4;
+    double finalTime = initialTime + numberOfArcs * arcDuration;
+
+    EstimationBenchmarkScenario scenario;
+    BodyListSettings bodySettings = getDefaultBodySettings(
+                { "Sun", "Earth", "Mars" }, initialTime - 3600.0, finalTime + 3600.0, "SSB", "ECLIPJ2000" );
+    bodySettings.at( "Mars" )->gravityFieldSettings =
+            std::make_shared< FromFileSphericalHarmonicsGravityFieldSettings >( jgmro120d, 20 );
+    scenario.bodies_ = createSystemOfBodies( bodySettings );
+    SystemOfBodies& bodies = scenario.bodies_;
+
+    bodies.createEmptyBody( "Orbiter" );
+    bodies.at( "Orbiter" )->setConstantBodyMass( 2000.0 );
+    bodies.at( "Orbiter" )->setEphemeris( std::make_shared< ephemerides::MultiArcEphemeris >(
+                                              std::map< double, std::shared_ptr< ephemerides::Ephemeris > >( ),
+                                              "Mars", "ECLIPJ2000" ) );
+    createGroundStation( bodies.at( "Earth" ), "Station", ( Eigen::Vector3d( ) << 0.0, 0.35, 1.2 ).finished( ),
+                         coordinate_conversions::geodetic_position );
+
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Orbiter" ][ "Mars" ].push_back( sphericalHarmonicAcceleration( 20, 20 ) );
+    accelerationSettings[ "Orbiter" ][ "Sun" ].push_back( pointMassGravityAcceleration( ) );
+    AccelerationMap accelerationModels = createAccelerationModelsMap(
+                bodies, accelerationSettings, { "Orbiter" }, { "Mars" } );
+
+    double marsGravitationalParameter = bodies.at( "Mars" )->getGravityFieldModel( )->getGravitationalParameter( );
+    std::vector< double > arcStartTimes;
+    std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > arcPropagatorSettings;
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        Eigen::Vector6d initialKeplerElements;
+        initialKeplerElements << 3390.0E3 + 300.0E3, 0.01, 1.6, 0.2 * i, 0.3, 0.4;
+        arcStartTimes.push_back( initialTime + i * arcDuration );
+        arcPropagatorSettings.push_back(
+                    translationalStatePropagatorSettings< double >(
+                        { "Mars" }, accelerationModels, { "Orbiter" },
+                        convertKeplerianToCartesianElements( initialKeplerElements, marsGravitationalParameter ),
+                        arcStartTimes.at( i ),
+                        rungeKuttaFixedStepSettings< double >( 30.0, CoefficientSets::rungeKuttaFehlberg78 ),
+                        propagationTimeTerminationSettings( arcStartTimes.at( i ) + arcDuration - 60.0 ) ) );
+    }
+    std::shared_ptr< MultiArcPropagatorSettings< double > > propagatorSettings =
+            std::make_shared< MultiArcPropagatorSettings< double > >( arcPropagatorSettings );
+    scenario.propagatorSettings_ = propagatorSettings;
+
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterSettings =
+            getInitialMultiArcParameterSettings< double, double >( propagatorSettings, bodies, arcStartTimes );
+    parameterSettings.push_back( std::make_shared< EstimatableParameterSettings >( "Mars", gravitational_parameter ) );
+    parameterSettings.push_back( std::make_shared< SphericalHarmonicEstimatableParameterSettings >(
+                                     2, 0, 20, 20, "Mars", spherical_harmonics_cosine_coefficient_block ) );
+    parameterSettings.push_back( std::make_shared< SphericalHarmonicEstimatableParameterSettings >(
+                                     2, 1, 20, 20, "Mars", spherical_harmonics_sine_coefficient_block ) );
+    scenario.parametersToEstimate_ = createParametersToEstimate< double >( parameterSettings, bodies );
+
+    LinkEnds linkEnds;
+    linkEnds[ transmitter ] = LinkEndId( "Earth", "Station" );
+    linkEnds[ receiver ] = LinkEndId( "Orbiter" );
+    std::vector< double > observationTimes;
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        std::vector< double > arcObservationTimes = getObservationTimes(
+                    arcStartTimes.at( i ) + 1800.0, arcStartTimes.at( i ) + arcDuration - 1800.0, 60.0 );
+        observationTimes.insert( observationTimes.end( ), arcObservationTimes.begin( ), arcObservationTimes.end( ) );
+    }
+    for( ObservableType currentObservable: { one_way_range, one_way_doppler } )
+    {
+        scenario.observationSettingsList_.push_back(
+                    std::make_shared< ObservationModelSettings >( currentObservable, linkEnds ) );
+        scenario.observationSimulationSettings_.push_back(
+                    std::make_shared< TabulatedObservationSimulationSettings< double > >(
+                        currentObservable, linkEnds, observationTimes, receiver ) );
+    }
+    scenario.weightPerObservable_[ one_way_range ] = 1.0;
+    scenario.weightPerObservable_[ one_way_doppler ] = 1.0E10;
+    return scenario;
+}
+
+//! Single-arc high Earth orbiter, with angular position and differential (w.r.t. the Moon) angular position data from
+//! five ground stations, and estimation of the station positions (three days of data)
+EstimationBenchmarkScenario createVlbiAngleScenario( )
+{
+    double initialTime = 1.0E7;
+    double finalTime = initialTime + 3.0 * 86400.0;
+
+    EstimationBenchmarkScenario scenario;
+    BodyListSettings bodySettings = getDefaultBodySettings(
+                { "Sun", "Earth", "Moon" }, initialTime - 3600.0, finalTime + 3600.0, "Earth", "J2000" );
+    scenario.bodies_ = createSystemOfBodies( bodySettings );
+    SystemOfBodies& bodies = scenario.bodies_;
+
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.at( "Vehicle" )->setConstantBodyMass( 1000.0 );
+    bodies.at( "Vehicle" )->setEphemeris( std::make_shared< ephemerides::TabulatedCartesianEphemeris< > >(
+                                              std::shared_ptr< interpolators::OneDimensionalInterpolator
+                                              < double, Eigen::Vector6d > >( ), "Earth", "J2000" ) );
+
+    std::vector< std::string > stationNames;
+    for( int i = 0; i < 5; i++ )
+    {
+        stationNames.push_back( "Station" + std::to_string( i + 1 ) );
+        createGroundStation( bodies.at( "Earth" ), stationNames.at( i ),
+                             ( Eigen::Vector3d( ) << 0.0, -0.8 + 0.4 * i, 1.2 * i ).finished( ),
+                             coordinate_conversions::geodetic_position );
+    }
+
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back( sphericalHarmonicAcceleration( 4, 4 ) );
+    accelerationSettings[ "Vehicle" ][ "Sun" ].push_back( pointMassGravityAcceleration( ) );
+    accelerationSettings[ "Vehicle" ][ "Moon" ].push_back( pointMassGravityAcceleration( ) );
+    AccelerationMap accelerationModels = createAccelerationModelsMap(
+                bodies, accelerationSettings, { "Vehicle" }, { "Earth" } );
+
+    Eigen::Vector6d initialKeplerElements;
+    initialKeplerElements << 40000.0E3, 0.6, 0.5, 0.2, 0.3, 0.4;
+    Eigen::Vector6d initialState = convertKeplerianToCartesianElements(
+                initialKeplerElements, bodies.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( ) );
+    scenario.propagatorSettings_ = translationalStatePropagatorSettings< double >(
+                { "Earth" }, accelerationModels, { "Vehicle" }, initialState, initialTime,
+                rungeKuttaFixedStepSettings< double >( 120.0, CoefficientSets::rungeKuttaFehlberg78 ),
+                propagationTimeTerminationSettings( finalTime ) );
+
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterSettings =
+            getInitialStateParameterSettings< double >( scenario.propagatorSettings_, bodies );
+    for( unsigned int i = 0; i < stationNames.size( ); i++ )
+    {
+        parameterSettings.push_back( std::make_shared< EstimatableParameterSettings >(
+                                         "Earth", ground_station_position, stationNames.at( i ) ) );
+    }
+    scenario.parametersToEstimate_ = createParametersToEstimate< double >( parameterSettings, bodies );
+
+    std::vector< double > observationTimes = getObservationTimes( initialTime + 600.0, finalTime - 600.0, 120.0 );
+    for( unsigned int i = 0; i < stationNames.size( ); i++ )
+    {
+        LinkEnds angularPositionLinkEnds;
+        angularPositionLinkEnds[ transmitter ] = LinkEndId( "Vehicle" );
+        angularPositionLinkEnds[ receiver ] = LinkEndId( "Earth", stationNames.at( i ) );
+        LinkEnds relativeAngularPositionLinkEnds = angularPositionLinkEnds;
+        relativeAngularPositionLinkEnds[ transmitter2 ] = LinkEndId( "Moon" );
+
+        std::vector< std::pair< ObservableType, LinkEnds > > observables =
+        { { angular_position, angularPositionLinkEnds }, { relative_angular_position, relativeAngularPositionLinkEnds } };
+        for( unsigned int j = 0; j < observables.size( ); j++ )
+        {
+            scenario.observationSettingsList_.push_back(
+                        std::make_shared< ObservationModelSettings >( observables.at( j ).first, observables.at( j ).second ) );
+            scenario.observationSimulationSettings_.push_back(
+                        std::make_shared< TabulatedObservationSimulationSettings< double > >(
+                            observables.at( j ).first, observables.at( j ).second, observationTimes, receiver ) );
+        }
+    }
+    scenario.weightPerObservable_[ angular_position ] = 1.0E16;
+    scenario.weightPerObservable_[ relative_angular_position ] = 1.0E18;
+    return scenario;
+}
+
+//! Hybrid-arc estimation of Mars (single arc w.r.t. the barycenter) and a Mars orbiter (four arcs w.r.t. Mars), from
+//! Earth-based range and angular position data
+EstimationBenchmarkScenario createHybridArcScenario( )
+{
+    double initialTime = 1.0E7;
+    double arcDuration = 86400.0;
+    int numberOfArcs = 4;
+    double finalTime = initialTime + ( numberOfArcs + 1 ) * arcDuration;
+
+    EstimationBenchmarkScenario scenario;
+    BodyListSettings bodySettings = getDefaultBodySettings(
+                { "Sun", "Earth", "Mars", "Jupiter" }, initialTime - 3.0 * 3600.0, finalTime + 3.0 * 3600.0,
+                "SSB", "ECLIPJ2000" );
+    scenario.bodies_ = createSystemOfBodies( bodySettings );
+    SystemOfBodies& bodies = scenario.bodies_;
+
+    bodies.createEmptyBody( "Orbiter" );
+    bodies.at( "Orbiter" )->setConstantBodyMass( 2000.0 );
+    bodies.at( "Orbiter" )->setEphemeris( std::make_shared< ephemerides::MultiArcEphemeris >(
+                                              std::map< double, std::shared_ptr< ephemerides::Ephemeris > >( ),
+                                              "Mars", "ECLIPJ2000" ) );
+    bodies.processBodyFrameDefinitions( );
+    createGroundStation( bodies.at( "Earth" ), "Station", ( Eigen::Vector3d( ) << 0.0, 0.35, 1.2 ).finished( ),
+                         coordinate_conversions::geodetic_position );
+
+    // Create single-arc settings for Mars
+    SelectedAccelerationMap singleArcAccelerationSettings;
+    singleArcAccelerationSettings[ "Mars" ][ "Sun" ].push_back( pointMassGravityAcceleration( ) );
+    singleArcAccelerationSettings[ "Mars" ][ "Earth" ].push_back( pointMassGravityAcceleration( ) );
+    singleArcAccelerationSettings[ "Mars" ][ "Jupiter" ].push_back( pointMassGravityAcceleration( ) );
+    AccelerationMap singleArcAccelerationModels = createAccelerationModelsMap(
+                bodies, singleArcAccelerationSettings, { "Mars" }, { "SSB" } );
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > singleArcPropagatorSettings =
+            translationalStatePropagatorSettings< double >(
+                { "SSB" }, singleArcAccelerationModels, { "Mars" },
+                getInitialStatesOfBodies( { "Mars" }, { "SSB" }, bodies, initialTime ), initialTime,
+                rungeKuttaFixedStepSettings< double >( 3600.0, CoefficientSets::rungeKuttaFehlberg78 ),
+                propagationTimeTerminationSettings( finalTime ) );
+
+    // Create multi-arc settings for orbiter
+    SelectedAccelerationMap multiArcAccelerationSettings;
+    multiArcAccelerationSettings[ "Orbiter" ][ "Mars" ].push_back( sphericalHarmonicAcceleration( 4, 4 ) );
+    multiArcAccelerationSettings[ "Orbiter" ][ "Sun" ].push_back( pointMassGravityAcceleration( ) );
+    multiArcAccelerationSettings[ "Orbiter" ][ "Jupiter" ].push_back( pointMassGravityAcceleration( ) );
+    AccelerationMap multiArcAccelerationModels = createAccelerationModelsMap(
+                bodies, multiArcAccelerationSettings, { "Orbiter" }, { "Mars" } );
+
+    double marsGravitationalParameter = bodies.at( "Mars" )->getGravityFieldModel( )->getGravitationalParameter( );
+    std::vector< double > arcStartTimes;
+    std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > arcPropagatorSettings;
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        Eigen::Vector6d initialKeplerElements;
+        initialKeplerElements << 6000.0E3, 0.05, 1.5, 0.2 * i, 0.3, 0.4;
+        arcStartTimes.push_back( initialTime + 3600.0 + i * arcDuration );
+        arcPropagatorSettings.push_back(
+                    translationalStatePropagatorSettings< double >(
+                        { "Mars" }, multiArcAccelerationModels, { "Orbiter" },
+                        convertKeplerianToCartesianElements( initialKeplerElements, marsGravitationalParameter ),
+                        arcStartTimes.at( i ),
+                        rungeKuttaFixedStepSettings< double >( 60.0, CoefficientSets::rungeKuttaFehlberg78 ),
+                        propagationTimeTerminationSettings( arcStartTimes.at( i ) + arcDuration - 60.0 ) ) );
+    }
+    std::shared_ptr< HybridArcPropagatorSettings< double > > propagatorSettings =
+            std::make_shared< HybridArcPropagatorSettings< double > >(
+                singleArcPropagatorSettings,
+                std::make_shared< MultiArcPropagatorSettings< double > >( arcPropagatorSettings ) );
+    scenario.propagatorSettings_ = propagatorSettings;
+
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterSettings =
+            getInitialHybridArcParameterSettings< double, double >( propagatorSettings, bodies, arcStartTimes );
+    parameterSettings.push_back( std::make_shared< EstimatableParameterSettings >( "Sun", gravitational_parameter ) );
+    parameterSettings.push_back( std::make_shared< EstimatableParameterSettings >( "Mars", gravitational_parameter ) );
+    scenario.parametersToEstimate_ = createParametersToEstimate< double >( parameterSettings, bodies );
+
+    std::vector< double > observationTimes;
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        std::vector< double > arcObservationTimes = getObservationTimes(
+                    arcStartTimes.at( i ) + 1800.0, arcStartTimes.at( i ) + arcDuration - 1800.0, 60.0 );
+        observationTimes.insert( observationTimes.end( ), arcObservationTimes.begin( ), arcObservationTimes.end( ) );
+    }
+    LinkEnds uplinkEnds;
+    uplinkEnds[ transmitter ] = LinkEndId( "Earth", "Station" );
+    uplinkEnds[ receiver ] = LinkEndId( "Orbiter" );
+    LinkEnds downlinkEnds;
+    downlinkEnds[ transmitter ] = LinkEndId( "Orbiter" );
+    downlinkEnds[ receiver ] = LinkEndId( "Earth", "Station" );
+    for( const LinkEnds& currentLinkEnds: { uplinkEnds, downlinkEnds } )
+    {
+        for( ObservableType currentObservable: { one_way_range, angular_position } )
+        {
+            scenario.observationSettingsList_.push_back(
+                        std::make_shared< ObservationModelSettings >( currentObservable, currentLinkEnds ) );
+            scenario.observationSimulationSettings_.push_back(
+                        std::make_shared< TabulatedObservationSimulationSettings< double > >(
+                            currentObservable, currentLinkEnds, observationTimes, receiver ) );
+        }
+    }
+    scenario.weightPerObservable_[ one_way_range ] = 1.0E-4;
+    scenario.weightPerObservable_[ angular_position ] = 1.0E16;
+    return scenario;
+}
+
+//! Function to print the results of a single scenario to the console
+void printBenchmarkResult( const EstimationBenchmarkResult& result )
+{
+    std::cout << std::endl << "Scenario: " << result.scenarioName_ << std::endl;
+    if( result.failureMessage_ != "" )
+    {
+        std::cout << "  failed: " << result.failureMessage_ << std::endl;
+        return;
+    }
+
+    std::cout << "  Observations: " << result.numberOfObservations_ << ", parameters: " << result.numberOfParameters_
+              << ", setup time: " << std::fixed << std::setprecision( 3 ) << result.setupTime_ << " s"
+              << ", memory: " << result.memoryFootprint_ / 1.0E6 << " MB" << std::endl;
+    std::cout << std::right << std::setw( 10 ) << "Iteration" << std::setw( 12 ) << "Total [s]"
+              << std::setw( 14 ) << "Propagation" << std::setw( 14 ) << "Var. interp." << std::setw( 12 ) << "Partials"
+              << std::setw( 12 ) << "Assembly" << std::setw( 12 ) << "Solve" << std::endl;
+    for( unsigned int i = 0; i < result.iterationTimings_.size( ); i++ )
+    {
+        const IterationTimings& currentTimings = result.iterationTimings_.at( i );
+        std::cout << std::setw( 10 ) << currentTimings.iteration_ << std::setw( 12 ) << currentTimings.totalTime_
+                  << std::setw( 14 ) << currentTimings.propagationTime_
+                  << std::setw( 14 ) << currentTimings.variationalInterpolationTime_
+                  << std::setw( 12 ) << currentTimings.partialsTime_ << std::setw( 12 ) << currentTimings.assemblyTime_
+                  << std::setw( 12 ) << currentTimings.solveTime_ << std::endl;
+    }
+    std::cout << std::defaultfloat;
+}
+
+//! Function to retrieve the results of all scenarios as a JSON string
+std::string getBenchmarkResultsJson( const std::vector< EstimationBenchmarkResult >& results )
+{
+    std::ostringstream jsonStream;
+    jsonStream << std::setprecision( 9 );
+    jsonStream << "{\"scenarios\": [";
+    for( unsigned int i = 0; i < results.size( ); i++ )
+    {
+        const EstimationBenchmarkResult& currentResult = results.at( i );
+        jsonStream << ( ( i == 0 ) ? "\n" : ",\n" );
+        jsonStream << "  {\"name\": \"" << utilities::escapeJsonString( currentResult.scenarioName_ ) << "\"";
+        if( currentResult.failureMessage_ != "" )
+        {
+            jsonStream << ", \"failure\": \"" << utilities::escapeJsonString( currentResult.failureMessage_ ) << "\"}";
+            continue;
+        }
+        jsonStream << ", \"number_of_observations\": " << currentResult.numberOfObservations_
+                   << ", \"number_of_parameters\": " << currentResult.numberOfParameters_
+                   << ", \"setup_time\": " << currentResult.setupTime_
+                   << ", \"memory_footprint\": " << currentResult.memoryFootprint_
+                   << ", \"iterations\": [";
+        for( unsigned int j = 0; j < currentResult.iterationTimings_.size( ); j++ )
+        {
+            const IterationTimings& currentTimings = currentResult.iterationTimings_.at( j );
+            jsonStream << ( ( j == 0 ) ? "\n" : ",\n" );
+            jsonStream << "    {\"iteration\": " << currentTimings.iteration_
+                       << ", \"total\": " << currentTimings.totalTime_
+                       << ", \"propagation\": " << currentTimings.propagationTime_
+                       << ", \"variational_interpolation\": " << currentTimings.variationalInterpolationTime_
+                       << ", \"partials\": " << currentTimings.partialsTime_
+                       << ", \"assembly\": " << currentTimings.assemblyTime_
+                       << ", \"solve\": " << currentTimings.solveTime_ << "}";
+        }
+        jsonStream << "\n  ]}";
+    }
+    jsonStream << "\n]}\n";
+    return jsonStream.str( );
+}
+
+int main( int argc, char* argv[ ] )
+{
+    std::vector< std::pair< std::string, std::function< EstimationBenchmarkScenario( ) > > > scenarios =
+    {
+        { "leo_range_doppler", &createLeoRangeDopplerScenario },
+        { "planetary_orbiter_gravity", &createPlanetaryOrbiterGravityScenario },
+        { "vlbi_angles", &createVlbiAngleScenario },
+        { "hybrid_arc", &createHybridArcScenario }
+    };
+
+    // Parse command line arguments
+    std::string jsonFile;
+    int numberOfIterations = 3;
+    int numberOfThreads = 1;
+    std::vector< std::string > selectedScenarios;
+    for( int i = 1; i < argc; i++ )
+    {
+        std::string currentArgument = argv[ i ];
+        if( ( currentArgument == "--json" || currentArgument == "--iterations" || currentArgument == "--threads" ) &&
+                i + 1 < argc )
+        {
+            std::string currentValue = argv[ ++i ];
+            if( currentArgument == "--json" )
+            {
+                jsonFile = currentValue;
+            }
+            else if( currentArgument == "--iterations" )
+            {
+                numberOfIterations = std::stoi( currentValue );
+            }
+            else
+            {
+                numberOfThreads = std::stoi( currentValue );
+            }
+        }
+        else if( std::find_if( scenarios.begin( ), scenarios.end( ),
+                               [ & ]( const std::pair< std::string, std::function< EstimationBenchmarkScenario( ) > >& scenario )
+        { return scenario.first == currentArgument; } ) != scenarios.end( ) )
+        {
+            selectedScenarios.push_back( currentArgument );
+        }
+        else
+        {
+            std::cerr << "Error, argument " << currentArgument << " not recognized; usage: tudat_estimation_benchmarks "
+                      << "[--json <file>] [--iterations <number>] [--threads <number>] [scenario ...], with scenarios:";
+            for( unsigned int j = 0; j < scenarios.size( ); j++ )
+            {
+                std::cerr << " " << scenarios.at( j ).first;
+            }
+            std::cerr << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    spice_interface::loadStandardSpiceKernels( );
+
+    std::vector< EstimationBenchmarkResult > results;
+    for( unsigned int i = 0; i < scenarios.size( ); i++ )
+    {
+        if( selectedScenarios.size( ) == 0 ||
+                std::find( selectedScenarios.begin( ), selectedScenarios.end( ), scenarios.at( i ).first ) !=
+                selectedScenarios.end( ) )
+        {
+            EstimationBenchmarkResult currentResult;
+            currentResult.scenarioName_ = scenarios.at( i ).first;
+            try
+            {
+                runEstimationBenchmark( scenarios.at( i ).second( ), numberOfIterations, numberOfThreads, currentResult );
+            }
+            catch( std::exception& caughtException )
+            {
+                currentResult.failureMessage_ = caughtException.what( );
+            }
+            printBenchmarkResult( currentResult );
+            results.push_back( currentResult );
+        }
+    }
+
+    if( jsonFile != "" )
+    {
+        std::ofstream outputFile( jsonFile );
+        if( !outputFile.is_open( ) )
+        {
+            std::cerr << "Error, could not open benchmark output file " << jsonFile << std::endl;
+            return EXIT_FAILURE;
+        }
+        outputFile << getBenchmarkResultsJson( results );
+    }
+
+    return EXIT_SUCCESS;
+}
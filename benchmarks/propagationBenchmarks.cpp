@@ -0,0 +1,710 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Benchmark suite for the numerical integrators and propagators. Each scenario is propagated with each of the
+ *    integrator types, and the number of state derivative evaluations, accepted/rejected steps, wall time and final
+ *    position error w.r.t. a tight-tolerance reference propagation are reported.
+ *
+ *    Usage: tudat_benchmarks [scenario ...] (all scenarios are run if none are given)
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "tudat/simulation/simulation.h"
+#include "tudat/simulation/estimation_setup/orbitDeterminationManager.h"
+#include "tudat/simulation/estimation_setup/simulateObservations.h"
+#include "tudat/simulation/environment_setup/createGroundStations.h"
+#include "tudat/math/interpolators/createInterpolator.h"
+#include "tudat/astro/propagators/circularRestrictedThreeBodyPeriodicOrbits.h"
+#include "tudat/astro/propagators/stateDerivativeCircularRestrictedThreeBodyProblem.h"
+
+using namespace tudat;
+using namespace tudat::numerical_integrators;
+using namespace tudat::simulation_setup;
+using namespace tudat::propagators;
+using namespace tudat::basic_astrodynamics;
+using namespace tudat::orbital_element_conversions;
+using namespace tudat::observation_models;
+using namespace tudat::estimatable_parameters;
+
+//! Function creating the propagator settings of a scenario, for given integrator settings
+typedef std::function< std::shared_ptr< SingleArcPropagatorSettings< double > >(
+        const std::shared_ptr< IntegratorSettings< double > > ) > PropagatorSettingsFunction;
+
+//! Results of a single benchmark run (one scenario, one integrator)
+struct BenchmarkResult
+{
+    std::string integratorName_;
+    double wallTime_ = TUDAT_NAN;
+    unsigned int numberOfFunctionEvaluations_ = 0;
+    unsigned int numberOfAcceptedSteps_ = 0;
+    unsigned int numberOfRejectedSteps_ = 0;
+    double finalError_ = TUDAT_NAN;
+    std::string failureMessage_;
+};
+
+//! Function to create the list of benchmarked integrators, with settings scaled by the characteristic time step
+std::vector< std::pair< std::string, std::shared_ptr< IntegratorSettings< double > > > > getBenchmarkIntegrators(
+        const double characteristicTimeStep,
+        const double tolerance = 1.0E-10 )
+{
+    double minimumStep = std::numeric_limits< double >::epsilon( );
+    double maximumStep = 1000.0 * characteristicTimeStep;
+
+    std::vector< std::pair< std::string, std::shared_ptr< IntegratorSettings< double > > > > integrators;
+    integrators.push_back( std::make_pair(
+                               "RK4", rungeKuttaFixedStepSettings< double >(
+                                   characteristicTimeStep, CoefficientSets::rungeKutta4Classic ) ) );
+    integrators.push_back( std::make_pair(
+                               "RKF45", rungeKuttaVariableStepSettingsScalarTolerances< double >(
+                                   characteristicTimeStep, CoefficientSets::rungeKuttaFehlberg45,
+                                   minimumStep, maximumStep, tolerance, tolerance ) ) );
+    integrators.push_back( std::make_pair(
+                               "RKF78", rungeKuttaVariableStepSettingsScalarTolerances< double >(
+                                   characteristicTimeStep, CoefficientSets::rungeKuttaFehlberg78,
+                                   minimumStep, maximumStep, tolerance, tolerance ) ) );
+    integrators.push_back( std::make_pair(
+                               "RKDP87", rungeKuttaVariableStepSettingsScalarTolerances< double >(
+                                   characteristicTimeStep, CoefficientSets::rungeKutta87DormandPrince,
+                                   minimumStep, maximumStep, tolerance, tolerance ) ) );
+    integrators.push_back( std::make_pair(
+                               "RKF89", rungeKuttaVariableStepSettingsScalarTolerances< double >(
+                                   characteristicTimeStep, CoefficientSets::rungeKuttaFehlberg89,
+                                   minimumStep, maximumStep, tolerance, tolerance ) ) );
+    integrators.push_back( std::make_pair(
+                               "BS", bulirschStoerIntegratorSettings< double >(
+                                   characteristicTimeStep, bulirsch_stoer_sequence, 6,
+                                   minimumStep, maximumStep, tolerance, tolerance ) ) );
+    integrators.push_back( std::make_pair(
+                               "ABM", adamsBashforthMoultonSettings< double >(
+                                   characteristicTimeStep, minimumStep, maximumStep, tolerance, tolerance ) ) );
+    integrators.push_back( std::make_pair(
+                               "GJ8", gaussJacksonSettings< double >( characteristicTimeStep, 8 ) ) );
+    return integrators;
+}
+
+//! Function to retrieve the wall time (in seconds) elapsed since a given time point
+double getElapsedWallTime( const std::chrono::steady_clock::time_point& startTime )
+{
+    return std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+}
+
+//! Function to run all integrators for a single-arc scenario, comparing the results to a reference propagation
+std::vector< BenchmarkResult > runSingleArcScenario(
+        const SystemOfBodies& bodies,
+        const PropagatorSettingsFunction& propagatorSettingsFunction,
+        const double characteristicTimeStep )
+{
+    // Propagate reference solution
+    SingleArcDynamicsSimulator< > referenceSimulator(
+                bodies, propagatorSettingsFunction(
+                    rungeKuttaVariableStepSettingsScalarTolerances< double >(
+                        characteristicTimeStep, CoefficientSets::rungeKuttaFehlberg89,
+                        std::numeric_limits< double >::epsilon( ), 1000.0 * characteristicTimeStep,
+                        1.0E-15, 1.0E-15 ) ) );
+    std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::VectorXd > > referenceInterpolator =
+            interpolators::createOneDimensionalInterpolator(
+                referenceSimulator.getEquationsOfMotionNumericalSolution( ),
+                std::make_shared< interpolators::LagrangeInterpolatorSettings >( 8 ) );
+
+    std::vector< BenchmarkResult > results;
+    std::vector< std::pair< std::string, std::shared_ptr< IntegratorSettings< double > > > > integrators =
+            getBenchmarkIntegrators( characteristicTimeStep );
+    for( unsigned int i = 0; i < integrators.size( ); i++ )
+    {
+        BenchmarkResult currentResult;
+        currentResult.integratorName_ = integrators.at( i ).first;
+        try
+        {
+            std::shared_ptr< SingleArcPropagatorSettings< double > > propagatorSettings =
+                    propagatorSettingsFunction( integrators.at( i ).second );
+
+            std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+            SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+            currentResult.wallTime_ = getElapsedWallTime( startTime );
+
+            std::map< double, Eigen::VectorXd > stateHistory = dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+            PropagationStepStatistics stepStatistics =
+                    dynamicsSimulator.getSingleArcPropagationResults( )->getStepStatistics( );
+            currentResult.numberOfFunctionEvaluations_ = stepStatistics.numberOfFunctionEvaluations_;
+            currentResult.numberOfAcceptedSteps_ = stepStatistics.numberOfAcceptedSteps_;
+            currentResult.numberOfRejectedSteps_ = stepStatistics.numberOfRejectedSteps_;
+            currentResult.finalError_ = ( stateHistory.rbegin( )->second.segment( 0, 3 ) -
+                                          referenceInterpolator->interpolate(
+                                              stateHistory.rbegin( )->first ).segment( 0, 3 ) ).norm( );
+        }
+        catch( std::exception& caughtException )
+        {
+            currentResult.failureMessage_ = caughtException.what( );
+        }
+        results.push_back( currentResult );
+    }
+    return results;
+}
+
+//! Low Earth orbit, with degree 100 EGM96 gravity field, exponential atmosphere drag and luni-solar perturbations
+std::vector< BenchmarkResult > runLeoBenchmark( )
+{
+    double initialTime = 1.0E7;
+    double finalTime = initialTime + 86400.0;
+
+    BodyListSettings bodySettings = getDefaultBodySettings(
+                { "Sun", "Earth", "Moon" }, initialTime - 3600.0, finalTime + 3600.0, "Earth", "J2000" );
+    bodySettings.at( "Earth" )->gravityFieldSettings =
+            std::make_shared< FromFileSphericalHarmonicsGravityFieldSettings >( egm96, 100 );
+    bodySettings.at( "Earth" )->atmosphereSettings = exponentialAtmosphereSettings( "Earth" );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.at( "Vehicle" )->setConstantBodyMass( 400.0 );
+    bodies.at( "Vehicle" )->setAerodynamicCoefficientInterface(
+                createAerodynamicCoefficientInterface(
+                    constantAerodynamicCoefficientSettings( 4.0, 1.2 * Eigen::Vector3d::UnitX( ) ), "Vehicle", bodies ) );
+
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back( sphericalHarmonicAcceleration( 100, 100 ) );
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back( aerodynamicAcceleration( ) );
+    accelerationSettings[ "Vehicle" ][ "Sun" ].push_back( pointMassGravityAcceleration( ) );
+    accelerationSettings[ "Vehicle" ][ "Moon" ].push_back( pointMassGravityAcceleration( ) );
+    AccelerationMap accelerationModels = createAccelerationModelsMap(
+                bodies, accelerationSettings, { "Vehicle" }, { "Earth" } );
+
+    Eigen::Vector6d initialKeplerElements;
+    initialKeplerElements << 6378.0E3 + 400.0E3, 0.001, 1.4, 0.2, 0.3, 0.4;
+    Eigen::Vector6d initialState = convertKeplerianToCartesianElements(
+                initialKeplerElements, bodies.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( ) );
+
+    return runSingleArcScenario(
+                bodies, [ = ]( const std::shared_ptr< IntegratorSettings< double > > integratorSettings )
+    {
+        return translationalStatePropagatorSettings< double >(
+                    { "Earth" }, accelerationModels, { "Vehicle" }, initialState, initialTime, integratorSettings,
+                    propagationTimeTerminationSettings( finalTime, true ) );
+    }, 10.0 );
+}
+
+//! Geostationary orbit, with solar radiation pressure (including Earth shadow) and luni-solar perturbations
+std::vector< BenchmarkResult > runGeoBenchmark( )
+{
+    double initialTime = 1.0E7;
+    double finalTime = initialTime + 3.0 * 86400.0;
+
+    BodyListSettings bodySettings = getDefaultBodySettings(
+                { "Sun", "Earth", "Moon" }, initialTime - 3600.0, finalTime + 3600.0, "Earth", "J2000" );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.at( "Vehicle" )->setConstantBodyMass( 2000.0 );
+    bodies.at( "Vehicle" )->setRadiationPressureInterface(
+                "Sun", createRadiationPressureInterface(
+                    cannonBallRadiationPressureSettings( "Sun", 20.0, 1.3, { "Earth" } ), "Vehicle", bodies ) );
+
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back( sphericalHarmonicAcceleration( 4, 4 ) );
+    accelerationSettings[ "Vehicle" ][ "Sun" ].push_back( pointMassGravityAcceleration( ) );
+    accelerationSettings[ "Vehicle" ][ "Sun" ].push_back( cannonBallRadiationPressureAcceleration( ) );
+    accelerationSettings[ "Vehicle" ][ "Moon" ].push_back( pointMassGravityAcceleration( ) );
+    AccelerationMap accelerationModels = createAccelerationModelsMap(
+                bodies, accelerationSettings, { "Vehicle" }, { "Earth" } );
+
+    Eigen::Vector6d initialKeplerElements;
+    initialKeplerElements << 42164.0E3, 0.0002, 0.001, 0.2, 0.3, 0.4;
+    Eigen::Vector6d initialState = convertKeplerianToCartesianElements(
+                initialKeplerElements, bodies.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( ) );
+
+    return runSingleArcScenario(
+                bodies, [ = ]( const std::shared_ptr< IntegratorSettings< double > > integratorSettings )
+    {
+        return translationalStatePropagatorSettings< double >(
+                    { "Earth" }, accelerationModels, { "Vehicle" }, initialState, initialTime, integratorSettings,
+                    propagationTimeTerminationSettings( finalTime, true ) );
+    }, 300.0 );
+}
+
+//! Heliocentric cruise, with point mass attractions of the Sun and (major) planets
+std::vector< BenchmarkResult > runInterplanetaryBenchmark( )
+{
+    double initialTime = 1.0E7;
+    double finalTime = initialTime + 200.0 * 86400.0;
+
+    std::vector< std::string > perturbingBodies = { "Mercury", "Venus", "Earth", "Moon", "Mars", "Jupiter", "Saturn" };
+    std::vector< std::string > bodiesToCreate = perturbingBodies;
+    bodiesToCreate.push_back( "Sun" );
+    BodyListSettings bodySettings = getDefaultBodySettings(
+                bodiesToCreate, initialTime - 86400.0, finalTime + 86400.0, "SSB", "ECLIPJ2000", 3600.0 );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.at( "Vehicle" )->setConstantBodyMass( 1000.0 );
+
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Sun" ].push_back( pointMassGravityAcceleration( ) );
+    for( unsigned int i = 0; i < perturbingBodies.size( ); i++ )
+    {
+        accelerationSettings[ "Vehicle" ][ perturbingBodies.at( i ) ].push_back( pointMassGravityAcceleration( ) );
+    }
+    AccelerationMap accelerationModels = createAccelerationModelsMap(
+                bodies, accelerationSettings, { "Vehicle" }, { "Sun" } );
+
+    Eigen::Vector6d initialKeplerElements;
+    initialKeplerElements << 1.2 * physical_constants::ASTRONOMICAL_UNIT, 0.2, 0.02, 0.2, 0.3, 0.4;
+    Eigen::Vector6d initialState = convertKeplerianToCartesianElements(
+                initialKeplerElements, bodies.at( "Sun" )->getGravityFieldModel( )->getGravitationalParameter( ) );
+
+    return runSingleArcScenario(
+                bodies, [ = ]( const std::shared_ptr< IntegratorSettings< double > > integratorSettings )
+    {
+        return translationalStatePropagatorSettings< double >(
+                    { "Sun" }, accelerationModels, { "Vehicle" }, initialState, initialTime, integratorSettings,
+                    propagationTimeTerminationSettings( finalTime, true ) );
+    }, 3600.0 );
+}
+
+//! Low lunar orbit, with degree 100 GRGM1200 lunar gravity field and point mass attractions of the Earth and Sun
+std::vector< BenchmarkResult > runLunarBenchmark( )
+{
+    double initialTime = 1.0E7;
+    double finalTime = initialTime + 86400.0;
+
+    BodyListSettings bodySettings = getDefaultBodySettings(
+                { "Sun", "Earth", "Moon" }, initialTime - 3600.0, finalTime + 3600.0, "Moon", "J2000" );
+    bodySettings.at( "Moon" )->gravityFieldSettings =
+            std::make_shared< FromFileSphericalHarmonicsGravityFieldSettings >( gggrx1200, 100 );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.at( "Vehicle" )->setConstantBodyMass( 1000.0 );
+
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Moon" ].push_back( sphericalHarmonicAcceleration( 100, 100 ) );
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back( pointMassGravityAcceleration( ) );
+    accelerationSettings[ "Vehicle" ][ "Sun" ].push_back( pointMassGravityAcceleration( ) );
+    AccelerationMap accelerationModels = createAccelerationModelsMap(
+                bodies, accelerationSettings, { "Vehicle" }, { "Moon" } );
+
+    Eigen::Vector6d initialKeplerElements;
+    initialKeplerElements << 1737.4E3 + 100.0E3, 0.005, 1.5, 0.2, 0.3, 0.4;
+    Eigen::Vector6d initialState = convertKeplerianToCartesianElements(
+                initialKeplerElements, bodies.at( "Moon" )->getGravityFieldModel( )->getGravitationalParameter( ) );
+
+    return runSingleArcScenario(
+                bodies, [ = ]( const std::shared_ptr< IntegratorSettings< double > > integratorSettings )
+    {
+        return translationalStatePropagatorSettings< double >(
+                    { "Moon" }, accelerationModels, { "Vehicle" }, initialState, initialTime, integratorSettings,
+                    propagationTimeTerminationSettings( finalTime, true ) );
+    }, 10.0 );
+}
+
+//! Coupled orbit and attitude propagation (13-dimensional state) of an Earth orbiter, with gravity gradient torque
+std::vector< BenchmarkResult > runCoupledAttitudeOrbitBenchmark( )
+{
+    double initialTime = 1.0E7;
+    double finalTime = initialTime + 86400.0;
+
+    BodyListSettings bodySettings = getDefaultBodySettings(
+                { "Sun", "Earth", "Moon" }, initialTime - 3600.0, finalTime + 3600.0, "Earth", "J2000" );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+
+    // Create vehicle with constant mass and inertia tensor, and (dummy) tabulated translational and rotational ephemerides
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.at( "Vehicle" )->setConstantBodyMass( 1000.0 );
+    Eigen::Matrix3d inertiaTensor = Eigen::Matrix3d::Zero( );
+    inertiaTensor.diagonal( ) << 800.0, 1000.0, 600.0;
+    bodies.at( "Vehicle" )->setBodyInertiaTensor( inertiaTensor );
+
+    std::map< double, Eigen::Matrix< double, 7, 1 > > dummyRotationMap;
+    dummyRotationMap[ -1.0E100 ] = Eigen::Matrix< double, 7, 1 >::Zero( );
+    dummyRotationMap[ 1.0E100 ] = Eigen::Matrix< double, 7, 1 >::Zero( );
+    bodies.at( "Vehicle" )->setRotationalEphemeris( std::make_shared< ephemerides::TabulatedRotationalEphemeris< double, double > >(
+                std::make_shared< interpolators::LinearInterpolator< double, Eigen::Matrix< double, 7, 1 > > >( dummyRotationMap ),
+                "J2000", "Vehicle_Fixed" ) );
+
+    std::map< double, Eigen::Vector6d > dummyStateMap;
+    dummyStateMap[ -1.0E100 ] = Eigen::Vector6d::Zero( );
+    dummyStateMap[ 1.0E100 ] = Eigen::Vector6d::Zero( );
+    bodies.at( "Vehicle" )->setEphemeris( std::make_shared< ephemerides::TabulatedCartesianEphemeris< double, double > >(
+                std::make_shared< interpolators::LinearInterpolator< double, Eigen::Vector6d > >( dummyStateMap ),
+                "Earth", "J2000" ) );
+
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back( sphericalHarmonicAcceleration( 8, 8 ) );
+    accelerationSettings[ "Vehicle" ][ "Sun" ].push_back( pointMassGravityAcceleration( ) );
+    accelerationSettings[ "Vehicle" ][ "Moon" ].push_back( pointMassGravityAcceleration( ) );
+    AccelerationMap accelerationModels = createAccelerationModelsMap(
+                bodies, accelerationSettings, { "Vehicle" }, { "Earth" } );
+
+    SelectedTorqueMap torqueSettings;
+    torqueSettings[ "Vehicle" ][ "Earth" ].push_back( std::make_shared< TorqueSettings >( second_order_gravitational_torque ) );
+    torqueSettings[ "Vehicle" ][ "Moon" ].push_back( std::make_shared< TorqueSettings >( second_order_gravitational_torque ) );
+    TorqueModelMap torqueModels = createTorqueModelsMap( bodies, torqueSettings, { "Vehicle" } );
+
+    Eigen::Vector6d initialKeplerElements;
+    initialKeplerElements << 6378.0E3 + 700.0E3, 0.001, 1.4, 0.2, 0.3, 0.4;
+    Eigen::Vector6d initialState = convertKeplerianToCartesianElements(
+                initialKeplerElements, bodies.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( ) );
+
+    Eigen::VectorXd initialRotationalState = Eigen::VectorXd::Zero( 7 );
+    initialRotationalState.segment( 0, 4 ) = linear_algebra::convertQuaternionToVectorFormat(
+                Eigen::Quaterniond( Eigen::AngleAxisd( 0.3, Eigen::Vector3d( 1.0, 2.0, 3.0 ).normalized( ) ) ) );
+    initialRotationalState.segment( 4, 3 ) << 1.0E-3, -2.0E-3, 1.5E-3;
+
+    return runSingleArcScenario(
+                bodies, [ = ]( const std::shared_ptr< IntegratorSettings< double > > integratorSettings )
+    {
+        std::shared_ptr< PropagationTerminationSettings > terminationSettings =
+                propagationTimeTerminationSettings( finalTime, true );
+        std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > propagatorSettingsList;
+        propagatorSettingsList.push_back(
+                    translationalStatePropagatorSettings< double >(
+                        { "Earth" }, accelerationModels, { "Vehicle" }, initialState, initialTime, integratorSettings,
+                        terminationSettings ) );
+        propagatorSettingsList.push_back(
+                    rotationalStatePropagatorSettings< double >(
+                        torqueModels, { "Vehicle" }, initialRotationalState, initialTime, integratorSettings,
+                        terminationSettings, quaternions ) );
+        return multiTypePropagatorSettings< double >(
+                    propagatorSettingsList, integratorSettings, initialTime, terminationSettings );
+    }, 10.0 );
+}
+
+//! Single iteration of a multi-arc initial state estimation of an Earth orbiter from one-way range data
+/*!
+ *  Single iteration of a multi-arc initial state estimation of an Earth orbiter from one-way range data. For this
+ *  scenario, the reported error is the maximum position error of the estimated arc initial states w.r.t. the truth.
+ */
+std::vector< BenchmarkResult > runMultiArcEstimationBenchmark( )
+{
+    double initialTime = 1.0E7;
+    double arcDuration = 86400.0;
+    int numberOfArcs = 3;
+    double finalTime = initialTime + numberOfArcs * arcDuration;
+
+    std::vector< BenchmarkResult > results;
+    std::vector< std::pair< std::string, std::shared_ptr< IntegratorSettings< double > > > > integrators =
+            getBenchmarkIntegrators( 30.0 );
+    for( unsigned int i = 0; i < integrators.size( ); i++ )
+    {
+        BenchmarkResult currentResult;
+        currentResult.integratorName_ = integrators.at( i ).first;
+        try
+        {
+            // Create environment (recreated for each integrator, as the estimation resets the vehicle ephemeris)
+            BodyListSettings bodySettings = getDefaultBodySettings(
+                        { "Sun", "Earth", "Moon" }, initialTime - 3600.0, finalTime + 3600.0, "Earth", "J2000" );
+            SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+            bodies.createEmptyBody( "Vehicle" );
+            bodies.at( "Vehicle" )->setConstantBodyMass( 400.0 );
+            bodies.at( "Vehicle" )->setEphemeris( std::make_shared< ephemerides::MultiArcEphemeris >(
+                                                      std::map< double, std::shared_ptr< ephemerides::Ephemeris > >( ),
+                                                      "Earth", "J2000" ) );
+            createGroundStation( bodies.at( "Earth" ), "Station", ( Eigen::Vector3d( ) << 0.0, 0.35, 1.2 ).finished( ),
+                                 coordinate_conversions::geodetic_position );
+
+            SelectedAccelerationMap accelerationSettings;
+            accelerationSettings[ "Vehicle" ][ "Earth" ].push_back( sphericalHarmonicAcceleration( 20, 20 ) );
+            accelerationSettings[ "Vehicle" ][ "Sun" ].push_back( pointMassGravityAcceleration( ) );
+            accelerationSettings[ "Vehicle" ][ "Moon" ].push_back( pointMassGravityAcceleration( ) );
+            AccelerationMap accelerationModels = createAccelerationModelsMap(
+                        bodies, accelerationSettings, { "Vehicle" }, { "Earth" } );
+
+            // Define arcs
+            double earthGravitationalParameter =
+                    bodies.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( );
+            std::vector< double > arcStartTimes;
+            std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > arcPropagatorSettings;
+            for( int j = 0; j < numberOfArcs; j++ )
+            {
+                Eigen::Vector6d initialKeplerElements;
+                initialKeplerElements << 7000.0E3, 0.01, 1.0, 0.2 * j, 0.3, 0.4;
+                arcStartTimes.push_back( initialTime + j * arcDuration );
+                arcPropagatorSettings.push_back(
+                            translationalStatePropagatorSettings< double >(
+                                { "Earth" }, accelerationModels, { "Vehicle" },
+                                convertKeplerianToCartesianElements( initialKeplerElements, earthGravitationalParameter ),
+                                arcStartTimes.at( j ), integrators.at( i ).second,
+                                propagationTimeTerminationSettings( arcStartTimes.at( j ) + arcDuration - 60.0, true ) ) );
+            }
+            std::shared_ptr< MultiArcPropagatorSettings< double > > propagatorSettings =
+                    std::make_shared< MultiArcPropagatorSettings< double > >( arcPropagatorSettings );
+
+            // Define estimation and observations
+            std::shared_ptr< EstimatableParameterSet< double > > parametersToEstimate =
+                    createParametersToEstimate< double >(
+                        getInitialMultiArcParameterSettings< double, double >(
+                            propagatorSettings, bodies, arcStartTimes ), bodies );
+
+            LinkEnds linkEnds;
+            linkEnds[ transmitter ] = LinkEndId( "Earth", "Station" );
+            linkEnds[ receiver ] = LinkEndId( "Vehicle" );
+            std::vector< std::shared_ptr< ObservationModelSettings > > observationSettingsList;
+            observationSettingsList.push_back( std::make_shared< ObservationModelSettings >( one_way_range, linkEnds ) );
+
+            std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+            OrbitDeterminationManager< double, double > orbitDeterminationManager(
+                        bodies, parametersToEstimate, observationSettingsList, propagatorSettings );
+
+            std::vector< double > observationTimes;
+            for( int j = 0; j < numberOfArcs; j++ )
+            {
+                for( double currentTime = arcStartTimes.at( j ) + 600.0;
+                     currentTime < arcStartTimes.at( j ) + arcDuration - 600.0; currentTime += 120.0 )
+                {
+                    observationTimes.push_back( currentTime );
+                }
+            }
+            std::vector< std::shared_ptr< ObservationSimulationSettings< double > > > measurementSimulationInput;
+            measurementSimulationInput.push_back(
+                        std::make_shared< TabulatedObservationSimulationSettings< double > >(
+                            one_way_range, linkEnds, observationTimes, receiver ) );
+            std::shared_ptr< ObservationCollection< double, double > > simulatedObservations =
+                    simulateObservations< double, double >(
+                        measurementSimulationInput, orbitDeterminationManager.getObservationSimulators( ), bodies );
+
+            // Perturb initial states, and perform a single iteration
+            Eigen::VectorXd truthParameters = parametersToEstimate->getFullParameterValues< double >( );
+            Eigen::VectorXd initialParameterEstimate = truthParameters;
+            for( int j = 0; j < numberOfArcs; j++ )
+            {
+                initialParameterEstimate.segment( 6 * j, 3 ) += Eigen::Vector3d::Constant( 10.0 );
+                initialParameterEstimate.segment( 6 * j + 3, 3 ) += Eigen::Vector3d::Constant( 1.0E-2 );
+            }
+            parametersToEstimate->resetParameterValues( initialParameterEstimate );
+
+            std::shared_ptr< EstimationInput< double, double > > estimationInput =
+                    std::make_shared< EstimationInput< double, double > >( simulatedObservations );
+            estimationInput->defineEstimationSettings( true, false, false, false, false );
+            estimationInput->setConvergenceChecker( std::make_shared< EstimationConvergenceChecker >( 1 ) );
+            std::shared_ptr< EstimationOutput< double, double > > estimationOutput =
+                    orbitDeterminationManager.estimateParameters( estimationInput );
+            currentResult.wallTime_ = getElapsedWallTime( startTime );
+
+            // Retrieve step statistics of last propagation of variational equations
+            std::shared_ptr< MultiArcVariationalEquationsSolver< double, double > > variationalEquationsSolver =
+                    std::dynamic_pointer_cast< MultiArcVariationalEquationsSolver< double, double > >(
+                        orbitDeterminationManager.getVariationalEquationsSolver( ) );
+            for( auto arcResults: variationalEquationsSolver->getMultiArcVariationalPropagationResults( )->
+                 getSingleArcResults( ) )
+            {
+                PropagationStepStatistics stepStatistics = arcResults->getDynamicsResults( )->getStepStatistics( );
+                currentResult.numberOfFunctionEvaluations_ += stepStatistics.numberOfFunctionEvaluations_;
+                currentResult.numberOfAcceptedSteps_ += stepStatistics.numberOfAcceptedSteps_;
+                currentResult.numberOfRejectedSteps_ += stepStatistics.numberOfRejectedSteps_;
+            }
+
+            currentResult.finalError_ = 0.0;
+            Eigen::VectorXd parameterError = estimationOutput->parameterEstimate_ - truthParameters;
+            for( int j = 0; j < numberOfArcs; j++ )
+            {
+                currentResult.finalError_ = std::max( currentResult.finalError_,
+                                                      parameterError.segment( 6 * j, 3 ).norm( ) );
+            }
+        }
+        catch( std::exception& caughtException )
+        {
+            currentResult.failureMessage_ = caughtException.what( );
+        }
+        results.push_back( currentResult );
+    }
+    return results;
+}
+
+//! Function to run repeated CR3BP propagations with the general numerical integrator, for a given state type
+template< typename StateType >
+BenchmarkResult runCr3bpGeneralIntegratorBenchmark(
+        const std::string& name,
+        const std::function< StateType( const double, const StateType& ) >& stateDerivativeFunction,
+        const StateType& initialState,
+        const double finalTime,
+        const unsigned int numberOfPropagations,
+        const Eigen::Vector3d& referenceFinalPosition,
+        const double tolerance )
+{
+    BenchmarkResult result;
+    result.integratorName_ = name;
+
+    unsigned int numberOfFunctionEvaluations = 0;
+    std::function< StateType( const double, const StateType& ) > countingStateDerivativeFunction =
+            [ & ]( const double time, const StateType& state )
+    {
+        numberOfFunctionEvaluations++;
+        return stateDerivativeFunction( time, state );
+    };
+    std::shared_ptr< IntegratorSettings< double > > integratorSettings =
+            rungeKuttaVariableStepSettingsScalarTolerances< double >(
+                1.0E-3, CoefficientSets::rungeKutta87DormandPrince, std::numeric_limits< double >::epsilon( ), 0.1,
+                tolerance, tolerance );
+
+    StateType finalState;
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+    for( unsigned int i = 0; i < numberOfPropagations; i++ )
+    {
+        numberOfFunctionEvaluations = 0;
+        result.numberOfAcceptedSteps_ = 0;
+        std::shared_ptr< NumericalIntegrator< double, StateType > > integrator =
+                createIntegrator< double, StateType >(
+                    countingStateDerivativeFunction, initialState, 0.0, integratorSettings );
+        double stepSize = integratorSettings->initialTimeStep_;
+        while( integrator->getCurrentIndependentVariable( ) < finalTime )
+        {
+            finalState = integrator->performIntegrationStep(
+                        std::min( stepSize, finalTime - integrator->getCurrentIndependentVariable( ) ) );
+            stepSize = integrator->getNextStepSize( );
+            result.numberOfAcceptedSteps_++;
+        }
+        result.numberOfRejectedSteps_ = integrator->getNumberOfRejectedSteps( );
+    }
+    result.wallTime_ = getElapsedWallTime( startTime );
+    result.numberOfFunctionEvaluations_ = numberOfFunctionEvaluations;
+    result.finalError_ = ( finalState.template topLeftCorner< 3, 1 >( ) - referenceFinalPosition ).norm( );
+    return result;
+}
+
+//! Repeated half-period propagations of an Earth-Moon L1 halo orbit, as used in CR3BP differential correction
+/*!
+ *  Repeated half-period propagations of an Earth-Moon L1 halo orbit (normalized units), as required in each iteration
+ *  of the CR3BP differential correction and continuation. The dedicated CircularRestrictedThreeBodyPropagator is
+ *  compared to the general numerical integrator (with the same RKDP87 method and tolerances), both for the state only
+ *  and for the state and state transition matrix. For this scenario, the wall time is the total over all propagations,
+ *  the step statistics are those of a single propagation, and the error is the normalized position error w.r.t. a
+ *  tight-tolerance propagation.
+ */
+std::vector< BenchmarkResult > runCr3bpBenchmark( )
+{
+    const double massParameter = 1.21506683E-2;
+    const double tolerance = 1.0E-12;
+    const unsigned int numberOfPropagations = 1000;
+
+    CircularRestrictedThreeBodyPropagator cr3bpPropagator( massParameter, tolerance, tolerance );
+    Eigen::Vector6d initialStateGuess;
+    initialStateGuess << 0.8234, 0.0, -0.0224, 0.0, 0.1343, 0.0;
+    Cr3bpPeriodicOrbit haloOrbit = correctSymmetricCr3bpPeriodicOrbit( cr3bpPropagator, initialStateGuess );
+    const Eigen::Vector6d initialState = haloOrbit.initialState_;
+    const double finalTime = haloOrbit.period_ / 2.0;
+
+    const Eigen::Vector3d referenceFinalPosition = CircularRestrictedThreeBodyPropagator(
+                massParameter, 1.0E-15, 1.0E-15 ).propagateState( initialState, 0.0, finalTime ).finalState_.segment( 0, 3 );
+
+    std::vector< BenchmarkResult > results;
+    for( unsigned int propagateStateTransitionMatrix = 0; propagateStateTransitionMatrix < 2;
+         propagateStateTransitionMatrix++ )
+    {
+        BenchmarkResult currentResult;
+        currentResult.integratorName_ = propagateStateTransitionMatrix ? "CR3BP+STM" : "CR3BP";
+
+        Cr3bpPropagationResult propagationResult;
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+        for( unsigned int i = 0; i < numberOfPropagations; i++ )
+        {
+            propagationResult = propagateStateTransitionMatrix ?
+                        cr3bpPropagator.propagateStateAndTransitionMatrix( initialState, 0.0, finalTime ) :
+                        cr3bpPropagator.propagateState( initialState, 0.0, finalTime );
+        }
+        currentResult.wallTime_ = getElapsedWallTime( startTime );
+        currentResult.numberOfFunctionEvaluations_ = propagationResult.numberOfFunctionEvaluations_;
+        currentResult.numberOfAcceptedSteps_ = propagationResult.numberOfAcceptedSteps_;
+        currentResult.numberOfRejectedSteps_ = propagationResult.numberOfRejectedSteps_;
+        currentResult.finalError_ = ( propagationResult.finalState_.segment( 0, 3 ) - referenceFinalPosition ).norm( );
+        results.push_back( currentResult );
+    }
+
+    StateDerivativeCircularRestrictedThreeBodyProblem stateDerivativeModel( massParameter );
+    results.push_back( runCr3bpGeneralIntegratorBenchmark< Eigen::Vector6d >(
+                           "RKDP87", [ & ]( const double time, const Eigen::Vector6d& state )
+    {
+        return stateDerivativeModel.computeStateDerivative( time, state );
+    }, initialState, finalTime, numberOfPropagations, referenceFinalPosition, tolerance ) );
+
+    Eigen::MatrixXd initialStateAndTransitionMatrix( 6, 7 );
+    initialStateAndTransitionMatrix << initialState, Eigen::Matrix6d::Identity( );
+    results.push_back( runCr3bpGeneralIntegratorBenchmark< Eigen::MatrixXd >(
+                           "RKDP87+STM", [ & ]( const double, const Eigen::MatrixXd& stateAndTransitionMatrix )
+    {
+        return Eigen::MatrixXd( computeCr3bpStateAndTransitionMatrixDerivative(
+                                    massParameter, stateAndTransitionMatrix ) );
+    }, initialStateAndTransitionMatrix, finalTime, numberOfPropagations, referenceFinalPosition, tolerance ) );
+
+    return results;
+}
+
+//! Function to print the results of a single scenario to the console
+void printBenchmarkResults( const std::string& scenarioName, const std::vector< BenchmarkResult >& results )
+{
+    std::cout << std::endl << "Scenario: " << scenarioName << std::endl;
+    std::cout << std::left << std::setw( 12 ) << "Integrator" << std::right
+              << std::setw( 14 ) << "Evaluations" << std::setw( 10 ) << "Accepted" << std::setw( 10 ) << "Rejected"
+              << std::setw( 14 ) << "Wall time [s]" << std::setw( 16 ) << "Error [m]" << std::endl;
+    for( unsigned int i = 0; i < results.size( ); i++ )
+    {
+        std::cout << std::left << std::setw( 12 ) << results.at( i ).integratorName_ << std::right;
+        if( results.at( i ).failureMessage_ != "" )
+        {
+            std::cout << "  failed: " << results.at( i ).failureMessage_ << std::endl;
+        }
+        else
+        {
+            std::cout << std::setw( 14 ) << results.at( i ).numberOfFunctionEvaluations_
+                      << std::setw( 10 ) << results.at( i ).numberOfAcceptedSteps_
+                      << std::setw( 10 ) << results.at( i ).numberOfRejectedSteps_
+                      << std::setw( 14 ) << std::fixed << std::setprecision( 3 ) << results.at( i ).wallTime_
+                      << std::setw( 16 ) << std::scientific << std::setprecision( 3 ) << results.at( i ).finalError_
+                      << std::defaultfloat << std::endl;
+        }
+    }
+}
+
+int main( int argc, char* argv[ ] )
+{
+    spice_interface::loadStandardSpiceKernels( );
+
+    std::vector< std::pair< std::string, std::function< std::vector< BenchmarkResult >( ) > > > scenarios =
+    {
+        { "leo_gravity_drag", &runLeoBenchmark },
+        { "geo_radiation_pressure", &runGeoBenchmark },
+        { "interplanetary_n_body", &runInterplanetaryBenchmark },
+        { "lunar_high_degree", &runLunarBenchmark },
+        { "coupled_attitude_orbit", &runCoupledAttitudeOrbitBenchmark },
+        { "multi_arc_estimation", &runMultiArcEstimationBenchmark },
+        { "cr3bp_halo_stm", &runCr3bpBenchmark }
+    };
+
+    std::vector< std::string > selectedScenarios( argv + 1, argv + argc );
+    for( unsigned int i = 0; i < selectedScenarios.size( ); i++ )
+    {
+        if( std::find_if( scenarios.begin( ), scenarios.end( ),
+                          [ & ]( const std::pair< std::string, std::function< std::vector< BenchmarkResult >( ) > >& scenario )
+        { return scenario.first == selectedScenarios.at( i ); } ) == scenarios.end( ) )
+        {
+            std::cerr << "Error, benchmark scenario " << selectedScenarios.at( i ) << " not found; available scenarios are:";
+            for( unsigned int j = 0; j < scenarios.size( ); j++ )
+            {
+                std::cerr << " " << scenarios.at( j ).first;
+            }
+            std::cerr << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    for( unsigned int i = 0; i < scenarios.size( ); i++ )
+    {
+        if( selectedScenarios.size( ) == 0 ||
+                std::find( selectedScenarios.begin( ), selectedScenarios.end( ), scenarios.at( i ).first ) !=
+                selectedScenarios.end( ) )
+        {
+            printBenchmarkResults( scenarios.at( i ).first, scenarios.at( i ).second( ) );
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -25,6 +25,7 @@
 #include "tudat/astro/aerodynamics/controlSurfaceAerodynamicCoefficientInterface.h"
 #include "tudat/astro/aerodynamics/aerodynamics.h"
 #include "tudat/astro/reference_frames/referenceFrameTransformations.h"
+#include "tudat/basics/modelEvaluationProfiler.h"
 #include "tudat/basics/utilities.h"
 
 namespace tudat
@@ -474,7 +475,7 @@ public:
      * \param index Index in list of control surfaces (controlSurfaceNames_)
      * \return Name of requested control surfaces.
      */
-    std::string getControlSurfaceName( const int index )
+    const std::string& getControlSurfaceName( const int index )
     {
         return controlSurfaceNames_.at( index );
     }
@@ -560,12 +561,49 @@ public:
         momentContributionInterface_ = momentContributionInterface;
     }
 
+    //! Function to set the object to which the evaluations of the coefficients are to be profiled.
+    /*!
+     * Function to set the object to which the evaluations of the coefficients are to be profiled, registering the
+     * (full) coefficient update of this interface under the name of the vehicle (aerodynamic_coefficient_update category)
+     * \param modelEvaluationProfiler Object to which model evaluations are to be profiled (nullptr to disable profiling)
+     * \param vehicleName Name of the vehicle to which the coefficients belong
+     */
+    void setModelEvaluationProfiler(
+            const std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler,
+            const std::string& vehicleName )
+    {
+        modelEvaluationProfiler_ = modelEvaluationProfiler;
+        coefficientUpdateProfilingIndex_ = ( modelEvaluationProfiler_ == nullptr ) ? -1 :
+            modelEvaluationProfiler_->addProfiledModel( "aerodynamic_coefficient_update", vehicleName );
+    }
+
+    //! Function to create a copy of this object, with its own current coefficients (see SystemOfBodies::clone)
+    /*!
+     * Function to create a copy of this object, with its own current coefficients, sharing the (read-only) coefficient
+     * data and functions with this object. Not supported by default; derived classes for which the coefficients are
+     * computed from the independent variables alone override this function.
+     * \return Copy of this object
+     */
+    virtual std::shared_ptr< AerodynamicCoefficientInterface > clone( )
+    {
+        throw std::runtime_error( "Error when copying aerodynamic coefficient interface, not supported for this type." );
+    }
+
 
 
 
 
 protected:
 
+     //! Function to check whether this object can be copied by clone (i.e. is not bound to any body or control surface).
+     void checkIsCopySupported( )
+     {
+         if( controlSurfaceIncrementInterfaces_.size( ) > 0 || momentContributionInterface_ != nullptr )
+         {
+             throw std::runtime_error( "Error when copying aerodynamic coefficient interface, not supported for interfaces "
+                                       "with control surfaces or moment contributions of the aerodynamic force." );
+         }
+     }
 
      //! Compute the aerodynamic coefficients for a single control surface, and add to full configuration coefficients.
      /*!
@@ -578,22 +616,24 @@ protected:
       */
      void updateCurrentControlSurfaceCoefficientsCoefficients(
              const std::string& currentControlSurface,
-             std::vector< double > controlSurfaceIndependentVariables )
+             const std::vector< double >& controlSurfaceIndependentVariables )
      {
-         if( controlSurfaceIncrementInterfaces_.count( currentControlSurface ) == 0 )
+         auto controlSurfaceIterator = controlSurfaceIncrementInterfaces_.find( currentControlSurface );
+         if( controlSurfaceIterator == controlSurfaceIncrementInterfaces_.end( ) )
          {
              throw std::runtime_error( "Error when updating coefficients, could not fid control surface " + currentControlSurface );
          }
-         controlSurfaceIncrementInterfaces_.at( currentControlSurface )->updateCurrentCoefficients(
-                 controlSurfaceIndependentVariables );
+         controlSurfaceIterator->second->updateCurrentCoefficients( controlSurfaceIndependentVariables );
 
-         currentControlSurfaceForceCoefficient_[ currentControlSurface ] =
-                 controlSurfaceIncrementInterfaces_.at( currentControlSurface )->getCurrentForceCoefficients( );
-         currentForceCoefficients_ += currentControlSurfaceForceCoefficient_.at( currentControlSurface );
+         Eigen::Vector3d& currentControlSurfaceForceCoefficient =
+                 currentControlSurfaceForceCoefficient_[ currentControlSurface ];
+         currentControlSurfaceForceCoefficient = controlSurfaceIterator->second->getCurrentForceCoefficients( );
+         currentForceCoefficients_ += currentControlSurfaceForceCoefficient;
 
-         currentControlSurfaceMomentCoefficient_[ currentControlSurface ] =
-                 controlSurfaceIncrementInterfaces_.at( currentControlSurface )->getCurrentMomentCoefficients( );
-         currentMomentCoefficients_ += currentControlSurfaceMomentCoefficient_.at( currentControlSurface );
+         Eigen::Vector3d& currentControlSurfaceMomentCoefficient =
+                 currentControlSurfaceMomentCoefficient_[ currentControlSurface ];
+         currentControlSurfaceMomentCoefficient = controlSurfaceIterator->second->getCurrentMomentCoefficients( );
+         currentMomentCoefficients_ += currentControlSurfaceMomentCoefficient;
      }
 
     //! The current force coefficients.
@@ -657,6 +697,12 @@ protected:
 
     std::shared_ptr< AerodynamicMomentContributionInterface > momentContributionInterface_;
 
+    //! Object to which the coefficient evaluations are profiled (nullptr if not profiled)
+    std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler_;
+
+    //! Index of coefficient update in modelEvaluationProfiler_ (only used if profiler is set)
+    int coefficientUpdateProfilingIndex_ = -1;
+
     //! List of control surface aerodynamic coefficient interfaces
     std::map< std::string, std::shared_ptr< ControlSurfaceIncrementAerodynamicInterface > >
     controlSurfaceIncrementInterfaces_;
@@ -709,6 +755,15 @@ public:
 
     }
 
+    std::shared_ptr< AerodynamicCoefficientInterface > clone( )
+    {
+        checkIsCopySupported( );
+        std::shared_ptr< ScaledAerodynamicCoefficientInterface > copiedInterface =
+                std::make_shared< ScaledAerodynamicCoefficientInterface >( *this );
+        copiedInterface->baseCoefficientInterface_ = baseCoefficientInterface_->clone( );
+        return copiedInterface;
+    }
+
 private:
 
     std::shared_ptr< AerodynamicCoefficientInterface > baseCoefficientInterface_;
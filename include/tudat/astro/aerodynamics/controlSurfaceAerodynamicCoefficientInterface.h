@@ -86,7 +86,7 @@ public:
      *  determination implemented by derived class
      */
     virtual void updateCurrentCoefficients(
-            std::vector< double >& independentVariables ) = 0;
+            const std::vector< double >& independentVariables ) = 0;
 
     //! Function for returning current aerodynamic force coefficients
     /*!
@@ -244,7 +244,7 @@ public:
      *  \param independentVariables Independent variables of force and moment coefficient
      *  determination implemented by derived class
      */
-    void updateCurrentCoefficients( std::vector< double >& independentVariables )
+    void updateCurrentCoefficients( const std::vector< double >& independentVariables )
     {
         // Check if the correct number of aerodynamic coefficients is provided.
         if( independentVariables.size( ) != numberOfIndependentVariables_ )
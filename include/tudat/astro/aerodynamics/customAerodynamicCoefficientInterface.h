@@ -161,6 +161,17 @@ public:
         currentMomentCoefficients_ = currentCoefficients.segment( 3, 3 );
     }
 
+    //! Function to create a copy of this object, with its own current coefficients (see SystemOfBodies::clone)
+    std::shared_ptr< AerodynamicCoefficientInterface > clone( )
+    {
+        checkIsCopySupported( );
+        if( timeUpdateFunction_ != nullptr )
+        {
+            throw std::runtime_error( "Error when copying aerodynamic coefficient interface, not supported for time-varying coefficients." );
+        }
+        return std::make_shared< CustomAerodynamicCoefficientInterface >( *this );
+    }
+
     //! Function to reset the constant aerodynamic coefficients, only valid if coefficients are already constant
     /*!
      * Function to reset the constant aerodynamic coefficients, only valid if coefficients are already constant. Function
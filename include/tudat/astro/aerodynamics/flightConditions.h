@@ -11,6 +11,7 @@
 #ifndef TUDAT_FLIGHTCONDITIONS_H
 #define TUDAT_FLIGHTCONDITIONS_H
 
+#include <set>
 #include <vector>
 
 #include <functional>
@@ -31,6 +32,21 @@ namespace tudat
 namespace aerodynamics
 {
 
+//! Components of the flight conditions that may be skipped when updating the flight conditions
+/*!
+ *  Components of the flight conditions that may be skipped when updating the flight conditions. If the flight conditions
+ *  use demand-driven updates (see FlightConditions::setUseDemandDrivenUpdates), each component is only updated if it
+ *  has been declared as required by one of the models using the flight conditions (see
+ *  FlightConditions::addRequiredUpdateComponent).
+ */
+enum FlightConditionsUpdateComponent
+{
+    //! Angle of attack, sideslip angle and bank angle (and associated rotations to body-fixed frame)
+    body_orientation_angles_update,
+    //! Independent variables and values of the aerodynamic coefficients (implies body_orientation_angles_update)
+    aerodynamic_coefficients_update
+};
+
 //! Class for calculating aerodynamic flight characteristics of a vehicle during numerical
 //! integration, in the absence of an atmosphere.
 /*!
@@ -192,8 +208,73 @@ public:
         return currentBodyCenteredAirspeedBasedBodyFixedState_;
     }
 
+    //! Function to set whether only the components of the flight conditions that are declared as required are updated.
+    /*!
+     *  Function to set whether only the components of the flight conditions that are declared as required (see
+     *  addRequiredUpdateComponent) are updated by updateConditions. By default (false), all components are updated.
+     *  Scalar flight conditions (altitude, density, etc.) are always computed on request, regardless of this setting.
+     *  \param useDemandDrivenUpdates Boolean denoting whether only the required components are to be updated.
+     */
+    void setUseDemandDrivenUpdates( const bool useDemandDrivenUpdates )
+    {
+        useDemandDrivenUpdates_ = useDemandDrivenUpdates;
+        resetUpdateComponentSettings( );
+    }
+
+    //! Function to retrieve whether only the components of the flight conditions that are declared as required are updated.
+    /*!
+     *  Function to retrieve whether only the components of the flight conditions that are declared as required are updated.
+     *  \return Boolean denoting whether only the required components are to be updated.
+     */
+    bool getUseDemandDrivenUpdates( )
+    {
+        return useDemandDrivenUpdates_;
+    }
+
+    //! Function to declare a component of the flight conditions as required by a model using the flight conditions.
+    /*!
+     *  Function to declare a component of the flight conditions as required by a model using the flight conditions, so
+     *  that it is updated by updateConditions when demand-driven updates are used.
+     *  \param updateComponent Component of the flight conditions that is required.
+     */
+    void addRequiredUpdateComponent( const FlightConditionsUpdateComponent updateComponent )
+    {
+        requiredUpdateComponents_.insert( updateComponent );
+        resetUpdateComponentSettings( );
+    }
+
+    //! Function to retrieve whether a component of the flight conditions is updated by updateConditions.
+    /*!
+     *  Function to retrieve whether a component of the flight conditions is updated by updateConditions.
+     *  \param updateComponent Component of the flight conditions.
+     *  \return True if component is updated by updateConditions.
+     */
+    bool isComponentUpdated( const FlightConditionsUpdateComponent updateComponent )
+    {
+        bool isUpdated = false;
+        switch( updateComponent )
+        {
+        case body_orientation_angles_update:
+            isUpdated = updateBodyOrientationAngles_;
+            break;
+        case aerodynamic_coefficients_update:
+            isUpdated = updateAerodynamicCoefficients_;
+            break;
+        }
+        return isUpdated;
+    }
+
 protected:
 
+    //! Function to set which components are to be updated by updateConditions, from the current settings.
+    void resetUpdateComponentSettings( )
+    {
+        updateAerodynamicCoefficients_ = !useDemandDrivenUpdates_ ||
+                ( requiredUpdateComponents_.count( aerodynamic_coefficients_update ) > 0 );
+        updateBodyOrientationAngles_ = updateAerodynamicCoefficients_ ||
+                ( requiredUpdateComponents_.count( body_orientation_angles_update ) > 0 );
+    }
+
     //! Function to compute and set the current latitude and longitude
     void computeLatitudeAndLongitude( )
     {
@@ -277,6 +358,18 @@ protected:
     //! geographic latitude).
     std::function< double( const Eigen::Vector3d& ) > geodeticLatitudeFunction_;
 
+    //! Boolean denoting whether only the components declared in requiredUpdateComponents_ are updated.
+    bool useDemandDrivenUpdates_;
+
+    //! Components of the flight conditions that are declared as required by the models using the flight conditions.
+    std::set< FlightConditionsUpdateComponent > requiredUpdateComponents_;
+
+    //! Boolean denoting whether the body orientation angles are updated by updateConditions.
+    bool updateBodyOrientationAngles_;
+
+    //! Boolean denoting whether the aerodynamic coefficients are updated by updateConditions.
+    bool updateAerodynamicCoefficients_;
+
 };
 
 //! Class for calculating aerodynamic flight characteristics of a vehicle during numerical
@@ -467,6 +560,18 @@ public:
         return currentBodyCenteredAirspeedBasedBodyFixedState_.segment( 3, 3 );
     }
 
+    //! Function to compute the gradient of the current density w.r.t. the body-fixed position of the vehicle
+    /*!
+     *  Function to compute the gradient of the current density w.r.t. the central body-fixed position of the vehicle,
+     *  at the current time. For an exponential atmosphere of a spherical body, the gradient is computed analytically.
+     *  For other atmosphere models (e.g. tabulated or NRLMSISE-00), it is computed by central differences of the
+     *  atmosphere model only (using the shape model to compute the altitude of the perturbed positions), so that the
+     *  remaining flight conditions are not re-evaluated.
+     *  \param positionPerturbation Perturbation of body-fixed position used for numerical differentiation.
+     *  eturn Gradient of the current density w.r.t. the body-fixed position of the vehicle, in the body-fixed frame
+     */
+    Eigen::Vector3d getCurrentDensityGradient( const double positionPerturbation );
+
     //! Function to return object from which the aerodynamic coefficients are obtained.
     /*!
      *  Function to return object from which the aerodynamic coefficients are obtained.
@@ -490,7 +595,8 @@ public:
                         "Error when getting aerodynamic coefficient independent variables, no coefficient interface is defined" );
         }
 
-        if( aerodynamicCoefficientIndependentVariables_.size( ) !=
+        // Input is not updated by updateConditions if coefficients are not required
+        if( !updateAerodynamicCoefficients_ || aerodynamicCoefficientIndependentVariables_.size( ) !=
                 aerodynamicCoefficientInterface_->getNumberOfIndependentVariables( ) )
         {
             updateAerodynamicCoefficientInput( );
@@ -513,7 +619,8 @@ public:
                         "Error when getting control surface aerodynamic coefficient independent variables, no coefficient interface is defined" );
         }
 
-        if( controlSurfaceAerodynamicCoefficientIndependentVariables_.size( ) !=
+        // Input is not updated by updateConditions if coefficients are not required
+        if( !updateAerodynamicCoefficients_ || controlSurfaceAerodynamicCoefficientIndependentVariables_.size( ) !=
                 aerodynamicCoefficientInterface_->getNumberOfControlSurfaces( ) )
         {
             updateAerodynamicCoefficientInput( );
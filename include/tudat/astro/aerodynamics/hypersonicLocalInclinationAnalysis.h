@@ -100,6 +100,8 @@ public:
      *  \param referenceLength Reference length used to non-dimensionalize aerodynamic moments.
      *  \param momentReferencePoint Reference point wrt which aerodynamic moments are calculated.
      *  \param savePressureCoefficients Boolean denoting whether to save the pressure coefficients that are computed to files
+     *  \param numberOfThreads Number of threads over which the evaluation of the coefficients on the grid of independent
+     *  variables is distributed (default 1).
      */
     HypersonicLocalInclinationAnalysis(
             const std::vector< std::vector< double > >& dataPointsOfIndependentVariables,
@@ -111,7 +113,8 @@ public:
             const double referenceArea,
             const double referenceLength,
             const Eigen::Vector3d& momentReferencePoint,
-            const bool savePressureCoefficients = false );
+            const bool savePressureCoefficients = false,
+            const int numberOfThreads = 1 );
 
     //! Default destructor.
     /*!
@@ -141,6 +144,44 @@ public:
     void determineInclinations( const double angleOfAttack,
                                 const double angleOfSideslip );
 
+    //! Function to reset the local inclination methods of a single vehicle part.
+    /*!
+     * Function to reset the local inclination methods of a single vehicle part. Only the contribution of the given part
+     * to the aerodynamic coefficients is recomputed (the contributions of all other parts are retained), after which the
+     * coefficient interpolator is recreated.
+     * \param partNumber Index from vehicleParts_ array for which the methods are to be reset.
+     * \param compressionMethod New compression method of the part (see updateCompressionPressures).
+     * \param expansionMethod New expansion method of the part (see updateExpansionPressures).
+     */
+    void setSelectedMethods( const int partNumber,
+                             const int compressionMethod,
+                             const int expansionMethod );
+
+    //! Get array of selected methods.
+    /*!
+     * Returns array of selected methods, first index represents compression/expansion, second index represents vehicle
+     * part.
+     * \return Array of selected methods.
+     */
+    std::vector< std::vector< int > > getSelectedMethods( ) const
+    {
+        return selectedMethods_;
+    }
+
+    //! Function to set the number of threads over which the coefficient evaluation is distributed.
+    /*!
+     * Function to set the number of threads over which the evaluation of the coefficients on the grid of independent
+     * variables is distributed (used when recomputing coefficients with setSelectedMethods).
+     * \param numberOfThreads Number of threads (must be at least 1).
+     */
+    void setNumberOfThreads( const int numberOfThreads );
+
+    //! Function to retrieve the number of threads over which the coefficient evaluation is distributed.
+    int getNumberOfThreads( ) const
+    {
+        return numberOfThreads_;
+    }
+
     //! Get the number of vehicle parts.
     /*!
      *  Returns the number of vehicle parts.
@@ -232,13 +273,16 @@ public:
             for( unsigned int j = 0; j < inclination_.at( i ).size( ); j++ )
             {
                 inclination_.at( i ).at( j ).clear( );
-                pressureCoefficient_.at( i ).at( j ).clear( );
             }
             inclination_.at( i ).clear( );
-            pressureCoefficient_.at( i ).clear( );
         }
         inclination_.clear( );
-        pressureCoefficient_.clear( );
+
+        panelSurfaceNormals_.clear( );
+        panelForceCoefficientContributions_.clear( );
+        panelMomentCoefficientContributions_.clear( );
+        partCoefficients_.clear( );
+        pressureCoefficientList_.clear( );
 
         for( unsigned int i = 0; i < selectedMethods_.size( ); i++ )
         {
@@ -246,7 +290,6 @@ public:
         }
         selectedMethods_.clear( );
 
-        previouslyComputedInclinations_.clear( );
         clearBaseData( );
 
     }
@@ -262,6 +305,24 @@ private:
      */
     void generateCoefficients( );
 
+    //! Compute the contributions of a set of vehicle parts to the aerodynamic coefficients.
+    /*!
+     * Computes the contributions of a set of vehicle parts to the aerodynamic coefficients at all combinations of
+     * independent variables, and sets them in partCoefficients_. The computations are distributed over numberOfThreads_
+     * threads, with each task processing all Mach numbers for a single combination of angle of attack and sideslip (so
+     * that the panel inclinations are computed only once per attitude). The results are independent of the number of
+     * threads.
+     * \param partNumbers Indices from vehicleParts_ array for which to determine the contributions.
+     */
+    void computePartCoefficients( const std::vector< int >& partNumbers );
+
+    //! Sum the contributions of all vehicle parts to the aerodynamic coefficients.
+    /*!
+     * Sums the contributions of all vehicle parts (in partCoefficients_) to the aerodynamic coefficients, and sets
+     * the results in aerodynamicCoefficients_.
+     */
+    void sumPartCoefficients( );
+
     //! Generate aerodynamic coefficients at a single set of independent variables.
     /*!
      * Generates aerodynamic coefficients at a single set of independent variables.
@@ -273,61 +334,67 @@ private:
 
     //! Determine aerodynamic coefficients for a single LaWGS part.
     /*!
-     * Determines aerodynamic coefficients for a single LaWGS part,
-     * calls determinepressureCoefficient_ function for given vehicle part.
+     * Determines aerodynamic coefficients for a single LaWGS part from the panel inclinations of the part, using the
+     * precomputed panel geometry.
      * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \param independentVariableIndices Array of indices of independent variables.
+     * \param machNumber Mach number at which to perform analysis.
+     * \param inclinations Inclination angles of the panels of the part (see determinePanelInclinations).
+     * \param pressureCoefficients Pressure coefficients of the panels of the part (returned by reference).
      * \return Force and moment coefficients for requested vehicle part.
      */
     Eigen::Vector6d determinePartCoefficients(
-            const int partNumber, const boost::array< int, 3 > independentVariableIndices );
+            const int partNumber, const double machNumber,
+            const Eigen::VectorXd& inclinations, Eigen::VectorXd& pressureCoefficients ) const;
 
-    //! Determine pressure coefficients on a given part.
+    //! Determine inclination angles of the panels on a given part.
     /*!
-     * Determines pressure coefficients on a single vehicle part.
-     * Calls the updateExpansionPressures and updateCompressionPressures for given vehicle part.
-     * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \param independentVariableIndices Array of indices of independent variables.
-     */
-    void determinePressureCoefficients( const int partNumber,
-                                        const boost::array< int, 3 > independentVariableIndices );
-
-    //! Determine force coefficients of a part.
-    /*!
-     * Sums the pressure coefficients of given part and determines force coefficients from it by
-     * non-dimensionalization with reference area.
-     * \param partNumber Index from vehicleParts_ array for which determine coefficients.
-     * \return Force coefficients for requested vehicle part.
-     */
-    Eigen::Vector3d calculateForceCoefficients( const int partNumber );
-
-    //! Determine moment coefficients of a part.
-    /*!
-     * Determines the moment coefficients of a given part by summing the contributions of all
-     * panels on the part. Moment arms are taken from panel centroid to momentReferencePoint. Non-
-     * dimensionalization is performed by product of referenceLength and referenceArea.
-     * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \return Moment coefficients for requested vehicle part.
+     * Determines inclination angles of the panels on a given part, for a given free-stream velocity direction.
+     * \param partNumber Index from vehicleParts_ array for which to determine inclinations.
+     * \param freestreamVelocityDirection Free-stream velocity direction, in the frame of the vehicle geometry.
+     * \param inclinations Inclination angles of the panels, in the order of panelSurfaceNormals_ (returned by
+     * reference).
      */
-    Eigen::Vector3d calculateMomentCoefficients( const int partNumber );
+    void determinePanelInclinations( const int partNumber,
+                                     const Eigen::Vector3d& freestreamVelocityDirection,
+                                     Eigen::VectorXd& inclinations ) const;
 
     //! Determine the compression pressure coefficients of a given part.
     /*!
-     * Sets the values of pressureCoefficient_ on given part and at given Mach number for which
+     * Sets the values of the pressure coefficients on given part and at given Mach number for which
      * inclination > 0.
      * \param machNumber Mach number at which to perform analysis.
      * \param partNumber of part from vehicleParts_ which is to be analyzed.
+     * \param inclinations Inclination angles of the panels of the part.
+     * \param pressureCoefficients Pressure coefficients of the panels of the part (modified by reference).
      */
-    void updateCompressionPressures( const double machNumber, const int partNumber );
+    void updateCompressionPressures( const double machNumber, const int partNumber,
+                                     const Eigen::VectorXd& inclinations,
+                                     Eigen::VectorXd& pressureCoefficients ) const;
 
     //! Determine the expansion pressure coefficients of a given part.
     /*!
-     * Determine the values of pressureCoefficient_ on given part and at given Mach number for
+     * Determine the values of the pressure coefficients on given part and at given Mach number for
      * which inclination <= 0.
      * \param machNumber Mach number at which to perform analysis.
      * \param partNumber of part from vehicleParts_ which is to be analyzed.
+     * \param inclinations Inclination angles of the panels of the part.
+     * \param pressureCoefficients Pressure coefficients of the panels of the part (modified by reference).
      */
-    void updateExpansionPressures( const double machNumber, const int partNumber );
+    void updateExpansionPressures( const double machNumber, const int partNumber,
+                                   const Eigen::VectorXd& inclinations,
+                                   Eigen::VectorXd& pressureCoefficients ) const;
+
+    //! Function to save the pressure coefficients of a single part at a single set of independent variables.
+    /*!
+     * Function to save the pressure coefficients of a single part at a single set of independent variables in
+     * pressureCoefficientList_, for which the entry must already exist.
+     * \param partNumber Index from vehicleParts_ array of the part.
+     * \param independentVariableIndices Array of indices of independent variables.
+     * \param pressureCoefficients Pressure coefficients of the panels of the part.
+     */
+    void savePartPressureCoefficients( const int partNumber,
+                                       const boost::array< int, 3 >& independentVariableIndices,
+                                       const Eigen::VectorXd& pressureCoefficients );
 
     //! Array of vehicle parts.
     /*!
@@ -349,28 +416,33 @@ private:
      */
     std::vector< std::vector< std::vector< double > > > inclination_;
 
-    //! Map of angle of attack and -sideslip pair and associated panel inclinations.
+    //! Surface normals of the panels of each part.
     /*!
-     * Map of angle of attack and -sideslip pair and associated panel inclinations.
+     * Surface normals of the panels of each part (vector entry), stored as columns of a contiguous matrix. The column of
+     * the panel at line i and point j is i * ( numberOfPoints - 1 ) + j.
      */
-    std::map< std::pair< double, double >, std::vector< std::vector< std::vector< double > > > >
-    previouslyComputedInclinations_;
+    std::vector< Eigen::Matrix3Xd > panelSurfaceNormals_;
 
-    //! Three-dimensional array of panel pressure coefficients.
+    //! Contributions of a unit pressure coefficient on each panel to the force coefficients, per part.
     /*!
-     * Three-dimensional array of panel pressure coefficients at current values
-     * of independent variables. Indices indicate part-line-point.
+     * Contributions of a unit pressure coefficient on each panel to the force coefficients (-area times surface normal,
+     * divided by reference area), per part, with the same column ordering as panelSurfaceNormals_.
      */
-    std::vector< std::vector< std::vector< double > > > pressureCoefficient_;
-
-    std::map< boost::array< int, 3 >,  std::vector< std::vector< std::vector< double > > > > pressureCoefficientList_;
+    std::vector< Eigen::Matrix3Xd > panelForceCoefficientContributions_;
 
-    //! Stagnation pressure coefficient.
+    //! Contributions of a unit pressure coefficient on each panel to the moment coefficients, per part.
     /*!
-     * Stagnation pressure coefficient for flow which has passed through a
-     * normal shock wave at current Mach number.
+     * Contributions of a unit pressure coefficient on each panel to the moment coefficients (-area times the cross
+     * product of moment arm and surface normal, divided by reference area and length), per part, with the same column
+     * ordering as panelSurfaceNormals_.
      */
-    double stagnationPressureCoefficient;
+    std::vector< Eigen::Matrix3Xd > panelMomentCoefficientContributions_;
+
+    //! Contributions of each part to the aerodynamic coefficients at each combination of independent variables.
+    std::vector< boost::multi_array< Eigen::Vector6d, 3 > > partCoefficients_;
+
+    //! Pressure coefficients (indices part-line-point) at each combination of independent variables, if saved.
+    std::map< boost::array< int, 3 >,  std::vector< std::vector< std::vector< double > > > > pressureCoefficientList_;
 
     //! Ratio of specific heats.
     /*!
@@ -386,6 +458,9 @@ private:
     std::vector< std::vector< int > > selectedMethods_;
 
     bool savePressureCoefficients_;
+
+    //! Number of threads over which the evaluation of the coefficients is distributed.
+    int numberOfThreads_;
 };
 
 
@@ -15,10 +15,13 @@
 #include <utility>
 #include <cmath>
 #include <algorithm>
+#include <memory>
 
 #include <functional>
 #include <boost/functional/hash.hpp>
 
+#include <Eigen/Core>
+
 #include "tudat/astro/basic_astro/physicalConstants.h"
 #include "tudat/astro/aerodynamics/atmosphereModel.h"
 #include "tudat/astro/aerodynamics/aerodynamics.h"
@@ -107,6 +110,108 @@ struct GasComponentProperties
 };
 
 
+//! Settings for the tabulated (accelerated) evaluation of the NRLMSISE-00 atmosphere model
+/*!
+ *  Settings for the tabulated (accelerated) evaluation of the NRLMSISE-00 atmosphere model. When these settings are
+ *  provided to an NRLMSISE00Atmosphere object, the model output (total mass density, temperatures and number densities)
+ *  is tabulated on a grid in altitude, latitude and local solar time, and interpolated (linearly in altitude, latitude
+ *  and local solar time; the densities are interpolated logarithmically). The grid is valid for a single epoch window
+ *  (of given duration) and a single set of space-weather inputs (F10.7, averaged F10.7 and Ap values): it is evaluated at
+ *  the middle of the window, and reset whenever a query is in a different window, or has different space-weather
+ *  inputs. The grid nodes are evaluated lazily (when first required for an interpolation), so that only the part of the
+ *  grid close to the trajectory is computed. The dependency of the model on longitude and time (within the window) is
+ *  only retained through the local solar time. The error introduced by the tabulation may be checked using
+ *  NRLMSISE00Atmosphere::computeMaximumTabulatedDensityError. Outside of the altitude range of the grid, the model is
+ *  evaluated directly.
+ */
+struct NRLMSISE00TabulationSettings
+{
+    //! Constructor
+    /*!
+     * Constructor
+     * \param minimumAltitude Minimum altitude of the grid [m]
+     * \param maximumAltitude Maximum altitude of the grid [m]
+     * \param altitudeStep (Approximate) altitude step of the grid [m]
+     * \param latitudeStep (Approximate) latitude step of the grid [rad]
+     * \param localSolarTimeStep (Approximate) local solar time step of the grid [hours]
+     * \param epochWindowDuration Duration of the epoch windows, for each of which the grid is evaluated [s]
+     */
+    NRLMSISE00TabulationSettings(
+            const double minimumAltitude = 100.0E3,
+            const double maximumAltitude = 1000.0E3,
+            const double altitudeStep = 5.0E3,
+            const double latitudeStep = 5.0 * mathematical_constants::PI / 180.0,
+            const double localSolarTimeStep = 0.5,
+            const double epochWindowDuration = 3.0 * 3600.0 ):
+        minimumAltitude_( minimumAltitude ), maximumAltitude_( maximumAltitude ), altitudeStep_( altitudeStep ),
+        latitudeStep_( latitudeStep ), localSolarTimeStep_( localSolarTimeStep ),
+        epochWindowDuration_( epochWindowDuration ){ }
+
+    //! Minimum altitude of the grid [m]
+    double minimumAltitude_;
+
+    //! Maximum altitude of the grid [m]
+    double maximumAltitude_;
+
+    //! (Approximate) altitude step of the grid [m]
+    double altitudeStep_;
+
+    //! (Approximate) latitude step of the grid [rad]
+    double latitudeStep_;
+
+    //! (Approximate) local solar time step of the grid [hours]
+    double localSolarTimeStep_;
+
+    //! Duration of the epoch windows, for each of which the grid is evaluated [s]
+    double epochWindowDuration_;
+};
+
+//! Atmospheric properties computed by the NRLMSISE-00 atmosphere model at a set of points
+/*!
+ *  Atmospheric properties computed by the NRLMSISE-00 atmosphere model at a set of points (see
+ *  NRLMSISE00Atmosphere::computeMultiPointProperties), with entry i of each vector (row i of the number density matrix)
+ *  corresponding to point i.
+ */
+struct NRLMSISE00MultiPointOutput
+{
+    //! Function to resize all vectors/matrices to the given number of points.
+    void resize( const int numberOfPoints )
+    {
+        densities_.resize( numberOfPoints );
+        temperatures_.resize( numberOfPoints );
+        exosphericTemperatures_.resize( numberOfPoints );
+        pressures_.resize( numberOfPoints );
+        meanMolarMasses_.resize( numberOfPoints );
+        speedsOfSound_.resize( numberOfPoints );
+        meanFreePaths_.resize( numberOfPoints );
+        numberDensities_.resize( numberOfPoints, 8 );
+    }
+
+    //! Densities [kg/m^3]
+    Eigen::VectorXd densities_;
+
+    //! Temperatures [K]
+    Eigen::VectorXd temperatures_;
+
+    //! Exospheric temperatures [K]
+    Eigen::VectorXd exosphericTemperatures_;
+
+    //! Pressures [Pa]
+    Eigen::VectorXd pressures_;
+
+    //! Mean molar masses [kg/mol]
+    Eigen::VectorXd meanMolarMasses_;
+
+    //! Speeds of sound [m/s]
+    Eigen::VectorXd speedsOfSound_;
+
+    //! Mean free paths [m]
+    Eigen::VectorXd meanFreePaths_;
+
+    //! Number densities [m^-3] of He, O, N2, O2, Ar, H, N and anomalous O (one column per species)
+    Eigen::Matrix< double, Eigen::Dynamic, 8 > numberDensities_;
+};
+
 //! NRLMSISE-00 atmosphere model class.
 /*!
  *  NRLMSISE-00 atmosphere model class. This class uses the NRLMSISE00 atmosphere model to calculate atmospheric
@@ -138,6 +243,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
         :nrlmsise00InputFunction_(nrlmsise00InputFunction)
     {
         resetHashKey( );
+        isTabulationReferenceSet_ = false;
         molarGasConstant_ = tudat::physical_constants::MOLAR_GAS_CONSTANT;
         specificHeatRatio_ = 1.4;
         GasComponentProperties gasProperties;
@@ -146,15 +252,25 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     }
 
     NRLMSISE00Atmosphere( const tudat::input_output::solar_activity::SolarActivityDataMap solarActivityData,
+                          const bool useIdealGasLaw = true ):
+        NRLMSISE00Atmosphere( std::make_shared< input_output::solar_activity::SolarActivityContainer >( solarActivityData ),
+                              useIdealGasLaw ){ }
+
+    //! Constructor from (shared) day-indexed solar activity data
+    /*!
+     * Constructor from (shared) day-indexed solar activity data, as loaded by
+     * input_output::solar_activity::loadSolarActivityData. The data is not copied, so that any number of atmosphere
+     * models may use the same data.
+     * \param solarActivityContainer Container of solar activity data
+     * \param useIdealGasLaw Variable denoting whether to use the ideal gas law for computation of pressure.
+     */
+    NRLMSISE00Atmosphere( const std::shared_ptr< input_output::solar_activity::SolarActivityContainer > solarActivityContainer,
                           const bool useIdealGasLaw = true )
     {
-        nrlmsise00InputFunction_ = std::bind( &tudat::aerodynamics::nrlmsiseInputFunction,
-                   std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4,
-                   solarActivityData, false, TUDAT_NAN );
-        solarActivityContainer_ = std::make_shared< input_output::solar_activity::SolarActivityContainer >(
-                    solarActivityData );
+        setSolarActivityContainer( solarActivityContainer );
 
         resetHashKey( );
+        isTabulationReferenceSet_ = false;
         molarGasConstant_ = tudat::physical_constants::MOLAR_GAS_CONSTANT;
         specificHeatRatio_ = 1.4;
         GasComponentProperties gasProperties;
@@ -176,13 +292,11 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
                          const GasComponentProperties gasProperties,
                          const bool useIdealGasLaw = true)
     {
-        nrlmsise00InputFunction_ = std::bind( &tudat::aerodynamics::nrlmsiseInputFunction,
-                   std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4,
-                   solarActivityData, false, TUDAT_NAN );
-        solarActivityContainer_ = std::make_shared< input_output::solar_activity::SolarActivityContainer >(
-                    solarActivityData );
+        setSolarActivityContainer(
+                    std::make_shared< input_output::solar_activity::SolarActivityContainer >( solarActivityData ) );
 
         resetHashKey( );
+        isTabulationReferenceSet_ = false;
         molarGasConstant_ = tudat::physical_constants::MOLAR_GAS_CONSTANT;
         specificHeatRatio_ = specificHeatRatio;
         gasComponentProperties_ = gasProperties;
@@ -393,11 +507,59 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
         return inputData_;
     }
 
+    //! Function to set the settings for the tabulated evaluation of the model
+    /*!
+     *  Function to set the settings for the tabulated evaluation of the model (see NRLMSISE00TabulationSettings), or to
+     *  switch back to direct evaluation of the model (if the input is a nullptr).
+     *  \param tabulationSettings Settings for the tabulated evaluation of the model (nullptr for direct evaluation).
+     */
+    void setTabulationSettings( const std::shared_ptr< NRLMSISE00TabulationSettings > tabulationSettings );
+
+    //! Function to retrieve the settings for the tabulated evaluation of the model
+    /*!
+     *  Function to retrieve the settings for the tabulated evaluation of the model
+     *  \return Settings for the tabulated evaluation of the model (nullptr if the model is evaluated directly).
+     */
+    std::shared_ptr< NRLMSISE00TabulationSettings > getTabulationSettings( )
+    {
+        return tabulationSettings_;
+    }
+
+    //! Function to compute the atmospheric properties at a set of points
+    /*!
+     *  Function to compute the atmospheric properties at a set of points, given as arrays of altitudes, longitudes,
+     *  latitudes and times. If the model was created from solar activity data, the time-dependent (space-weather)
+     *  input is computed once for consecutive points at the same epoch, so that grouping points by epoch reduces the
+     *  cost of the input computation. The tabulated evaluation (if set) is used in the same manner as for single-point
+     *  queries. The points are evaluated serially, as the underlying NRLMSISE00 implementation is not reentrant.
+     *  \param altitudes Altitudes at which output is to be computed [m].
+     *  \param longitudes Longitudes at which output is to be computed [rad].
+     *  \param latitudes Latitudes at which output is to be computed [rad].
+     *  \param times Times at which output is to be computed (seconds since J2000).
+     *  \param output Atmospheric properties at the points (returned by reference).
+     */
+    void computeMultiPointProperties( const Eigen::VectorXd& altitudes, const Eigen::VectorXd& longitudes,
+                                      const Eigen::VectorXd& latitudes, const Eigen::VectorXd& times,
+                                      NRLMSISE00MultiPointOutput& output );
+
+    //! Function to compute the maximum relative error in the density due to the tabulation
+    /*!
+     *  Function to compute the maximum relative error in the density due to the tabulation, in the current epoch window.
+     *  The error is computed by comparing the interpolated and directly evaluated density at the center of each of the
+     *  grid cells for which all corner nodes have been evaluated (i.e. the grid cells that have been used for the
+     *  interpolation so far in the current window).
+     *  \return Maximum relative error in the density due to the tabulation (0 if no grid cells have been evaluated).
+     */
+    double computeMaximumTabulatedDensityError( );
+
  private:
 
     //! Shared pointer to solar activity function
     NRLMSISE00InputFunction nrlmsise00InputFunction_;
 
+    //! Function to compute the time-dependent part of the input (nullptr if model created from input function)
+    std::function< NRLMSISE00Input( const double ) > nrlmsise00EpochInputFunction_;
+
     //! Use the ideal gas law for the computation of the pressure.
     bool useIdealGasLaw_;
 
@@ -552,10 +714,148 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     void computeProperties( const double altitude, const double longitude,
                             const double latitude, const double time );
 
+    //! Function to compute the model output (output_ member) from the current input data (inputData_ member)
+    /*!
+     * Function to compute the model output (output_ member) from the current input data (inputData_ member), either
+     * directly or using the tabulated evaluation.
+     * \param altitude Altitude at which output is to be computed [m].
+     * \param longitude Longitude at which output is to be computed [rad].
+     * \param latitude Latitude at which output is to be computed [rad].
+     * \param time Time at which output is to be computed (seconds since J2000).
+     */
+    void computeModelOutput( const double altitude, const double longitude,
+                             const double latitude, const double time );
+
+    //! Function to set the input of the NRLMSISE00 model (input_, aph_ and flags_ members)
+    /*!
+     * Function to set the input of the NRLMSISE00 model (input_, aph_ and flags_ members)
+     * \param inputData Input data of the model, at the given position and time
+     * \param altitude Altitude at which output is to be computed [m].
+     * \param longitude Longitude at which output is to be computed [rad].
+     * \param latitude Latitude at which output is to be computed [rad].
+     */
+    void setModelInput( const NRLMSISE00Input& inputData, const double altitude, const double longitude,
+                        const double latitude );
+
+    //! Function to compute the atmospheric properties from the current model output (output_ member)
+    void computePropertiesFromModelOutput( );
+
+    //! Function to reset the grid for the tabulated evaluation, if the current query is in a different epoch window or
+    //! has different space-weather inputs than those used for the grid.
+    /*!
+     * Function to reset the grid for the tabulated evaluation, if the current query is in a different epoch window or
+     * has different space-weather inputs (in inputData_) than those used for the grid.
+     * \param altitude Altitude at which output is to be computed [m].
+     * \param longitude Longitude at which output is to be computed [rad].
+     * \param latitude Latitude at which output is to be computed [rad].
+     * \param time Time at which output is to be computed (seconds since J2000).
+     */
+    void updateTabulationReference( const double altitude, const double longitude,
+                                    const double latitude, const double time );
+
+    //! Function to evaluate the model directly at a given point of the grid of the tabulated evaluation
+    /*!
+     * Function to evaluate the model directly at a given point (not necessarily a node) of the grid of the tabulated
+     * evaluation, using the input of the current epoch window, and the longitude that corresponds to the local solar time.
+     * \param altitude Altitude at which output is to be computed [m].
+     * \param latitude Latitude at which output is to be computed [rad].
+     * \param localSolarTime Local solar time at which output is to be computed [hours].
+     * \param output Model output (returned by reference).
+     */
+    void evaluateModelAtTabulationPoint( const double altitude, const double latitude, const double localSolarTime,
+                                         nrlmsise_output& output );
+
+    //! Function to retrieve the tabulated values at a grid node, evaluating the node if this has not yet been done
+    /*!
+     * Function to retrieve the tabulated values at a grid node, evaluating the node if this has not yet been done
+     * \param altitudeIndex Index of the node in altitude
+     * \param latitudeIndex Index of the node in latitude
+     * \param localSolarTimeIndex Index of the node in local solar time
+     * \return Pointer to the numberOfTabulatedValues_ tabulated values at the node
+     */
+    const double* getTabulatedNodeValues( const int altitudeIndex, const int latitudeIndex,
+                                          const int localSolarTimeIndex );
+
+    //! Function to compute the model output (output_ member) by interpolation in the grid of the tabulated evaluation
+    /*!
+     * Function to compute the model output (output_ member) by interpolation in the grid of the tabulated evaluation
+     * \param altitude Altitude at which output is to be computed [m].
+     * \param latitude Latitude at which output is to be computed [rad].
+     * \param localSolarTime Local solar time at which output is to be computed [hours].
+     * \param output Model output (returned by reference).
+     */
+    void computeTabulatedModelOutput( const double altitude, const double latitude, const double localSolarTime,
+                                      nrlmsise_output& output );
+
+    //! Function to convert model output to the values that are tabulated (logarithm of densities, and temperatures)
+    static void convertModelOutputToTabulatedValues( const nrlmsise_output& output, double* tabulatedValues );
+
+    //! Function to convert tabulated values (logarithm of densities, and temperatures) to model output
+    static void convertTabulatedValuesToModelOutput( const double* tabulatedValues, nrlmsise_output& output );
+
     //! Input data to NRLMSISE00 atmosphere model
     NRLMSISE00Input inputData_;
 
     std::shared_ptr< input_output::solar_activity::SolarActivityContainer > solarActivityContainer_;
+
+    //! Function to set the solar activity data, and the input functions that use it
+    /*!
+     * Function to set the solar activity data, and the input functions that use it
+     * \param solarActivityContainer Container of solar activity data
+     */
+    void setSolarActivityContainer(
+            const std::shared_ptr< input_output::solar_activity::SolarActivityContainer > solarActivityContainer )
+    {
+        solarActivityContainer_ = solarActivityContainer;
+        nrlmsise00InputFunction_ = [ = ]( const double altitude, const double longitude,
+                                          const double latitude, const double time )
+        {
+            return nrlmsiseInputFunction( altitude, longitude, latitude, time, solarActivityContainer, false, TUDAT_NAN );
+        };
+        nrlmsise00EpochInputFunction_ = [ = ]( const double time )
+        {
+            return nrlmsiseEpochInputFunction( time, solarActivityContainer );
+        };
+    }
+
+    //! Settings for the tabulated evaluation of the model (nullptr if the model is evaluated directly)
+    std::shared_ptr< NRLMSISE00TabulationSettings > tabulationSettings_;
+
+    //! Number of values tabulated at each node (total mass density, 2 temperatures, 8 number densities)
+    static const int numberOfTabulatedValues_ = 11;
+
+    //! Number of altitude nodes of the grid of the tabulated evaluation
+    int numberOfTabulationAltitudes_;
+
+    //! Number of latitude nodes (from -90 to 90 degrees) of the grid of the tabulated evaluation
+    int numberOfTabulationLatitudes_;
+
+    //! Number of local solar time nodes (from 0 to 24 hours, periodic) of the grid of the tabulated evaluation
+    int numberOfTabulationLocalSolarTimes_;
+
+    //! Altitude step of the grid of the tabulated evaluation [m]
+    double tabulationAltitudeStep_;
+
+    //! Latitude step of the grid of the tabulated evaluation [rad]
+    double tabulationLatitudeStep_;
+
+    //! Local solar time step of the grid of the tabulated evaluation [hours]
+    double tabulationLocalSolarTimeStep_;
+
+    //! Boolean denoting whether the grid of the tabulated evaluation has been set for an epoch window
+    bool isTabulationReferenceSet_;
+
+    //! Index of the epoch window of the current grid of the tabulated evaluation
+    long long tabulationWindowIndex_;
+
+    //! Model input (at the middle of the epoch window) used for the current grid of the tabulated evaluation
+    NRLMSISE00Input tabulationReferenceInput_;
+
+    //! Tabulated values at the grid nodes (numberOfTabulatedValues_ values per node, contiguous)
+    std::vector< double > tabulatedNodeValues_;
+
+    //! Flags denoting whether the grid nodes have been evaluated in the current epoch window
+    std::vector< char > isTabulatedNodeComputed_;
 };
 
 }  // namespace aerodynamics
@@ -15,6 +15,7 @@
 #include <cmath>
 
 #include "tudat/io/solarActivityData.h"
+#include "tudat/math/basic/mathematicalConstants.h"
 
 
 namespace tudat
@@ -90,6 +91,45 @@ struct NRLMSISE00Input
 };
 
 
+//! NRLMSISE00 epoch input function
+/*!
+ * Function to define the part of the input for the NRLMSISE model that depends only on time (date and space weather),
+ * from solar activity data. The local solar time is set to that at zero longitude, and may be adjusted for a given
+ * longitude using computeNrlmsiseLocalSolarTime. This function allows the time-dependent input to be computed once for
+ * a set of points at the same epoch.
+ * \param time Time at which output is to be computed (seconds since J2000).
+ * \param solarActivityMap SolarActivityData structure
+ * \return NRLMSISE00Input at given epoch (with local solar time at zero longitude)
+ */
+NRLMSISE00Input nrlmsiseEpochInputFunction(
+        const double time, const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap );
+
+//! NRLMSISE00 epoch input function, using day-indexed solar activity data
+/*!
+ * Function to define the part of the input for the NRLMSISE model that depends only on time, as
+ * nrlmsiseEpochInputFunction with a map of solar activity data, but retrieving the solar activity data of the current day
+ * in O(1) time from a container.
+ * \param time Time at which output is to be computed (seconds since J2000).
+ * \param solarActivityContainer Container of solar activity data
+ * \return NRLMSISE00Input at given epoch (with local solar time at zero longitude)
+ */
+NRLMSISE00Input nrlmsiseEpochInputFunction(
+        const double time,
+        const std::shared_ptr< tudat::input_output::solar_activity::SolarActivityContainer > solarActivityContainer );
+
+//! Function to compute the local solar time used as NRLMSISE00 input
+/*!
+ * Function to compute the local solar time used as NRLMSISE00 input, from the time of day and the longitude
+ * \param secondOfTheDay Number of seconds into the current day.
+ * \param longitude Longitude at which output is to be computed [rad].
+ * \return Local solar time [hours]
+ */
+inline double computeNrlmsiseLocalSolarTime( const double secondOfTheDay, const double longitude )
+{
+    // Hrs since begin of the day at longitude 0 (GMT) + Hrs passed at current longitude
+    return secondOfTheDay / 3600.0 + longitude / ( tudat::mathematical_constants::PI / 12.0 );
+}
+
 //! NRLMSISE00 Input function
 /*!
  * This function is used to define the input for the NRLMSISE model.
@@ -109,6 +149,26 @@ NRLMSISE00Input nrlmsiseInputFunction( const double altitude, const double longi
                                        const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap,
                                        const bool adjustSolarTime = false, const double localSolarTime = 0.0 );
 
+//! NRLMSISE00 Input function, using day-indexed solar activity data
+/*!
+ * NRLMSISE00 Input function, as nrlmsiseInputFunction with a map of solar activity data, but retrieving the solar
+ * activity data of the current day in O(1) time from a container.
+ * \param altitude Altitude at which output is to be computed [m].
+ * \param longitude Longitude at which output is to be computed [rad].
+ * \param latitude Latitude at which output is to be computed [rad].
+ * \param time Time at which output is to be computed (seconds since J2000).
+ * \param solarActivityContainer Container of solar activity data
+ * \param adjustSolarTime Boolean denoting whether the computed local solar time should be overidden with localSolarTime
+ * input.
+ * \param localSolarTime Local solar time that is used when adjustSolarTime is set to true.
+ * \return NRLMSISE00Input nrlmsiseInputFunction
+ */
+NRLMSISE00Input nrlmsiseInputFunction(
+        const double altitude, const double longitude,
+        const double latitude, const double time,
+        const std::shared_ptr< tudat::input_output::solar_activity::SolarActivityContainer > solarActivityContainer,
+        const bool adjustSolarTime = false, const double localSolarTime = 0.0 );
+
 }  // namespace aerodynamics
 }  // namespace tudat
 
@@ -23,6 +23,7 @@
 
 #include <Eigen/Core>
 
+#include "tudat/basics/basicTypedefs.h"
 #include "tudat/basics/utilityMacros.h"
 
 #include "tudat/astro/aerodynamics/standardAtmosphere.h"
@@ -94,6 +95,8 @@ public:
         // Initialize atmosphere
         createAtmosphereInterpolators( );
         independentVariableData_.resize( numberOfIndependentVariables_ );
+        currentIndependentVariableData_.resize( numberOfIndependentVariables_ );
+        areCurrentDependentVariablesSet_ = false;
     }
 
     //! Constructor with default gas constant and specific heat ratio.
@@ -195,6 +198,8 @@ public:
         // Initialize atmosphere
         createAtmosphereInterpolators( );
         independentVariableData_.resize( numberOfIndependentVariables_ );
+        currentIndependentVariableData_.resize( numberOfIndependentVariables_ );
+        areCurrentDependentVariablesSet_ = false;
     }
 
     //! Destructor
@@ -207,6 +212,20 @@ public:
      */
     std::map< int, std::string > getAtmosphereTableFile( ) { return atmosphereTableFile_; }
 
+    //! Get independent variables of atmosphere table.
+    /*!
+     *  Returns the independent variables of the atmosphere table, in the order in which they are tabulated.
+     *  \return Independent variables of the atmosphere table.
+     */
+    std::vector< AtmosphereIndependentVariables > getIndependentVariables( ) { return independentVariables_; }
+
+    //! Get values of independent variables of atmosphere table.
+    /*!
+     *  Returns the values at which the atmosphere is tabulated, for each of the independent variables.
+     *  \return Values of independent variables of the atmosphere table.
+     */
+    std::vector< std::vector< double > > getIndependentVariablesData( ) { return independentVariablesData_; }
+
     //! Get local density.
     /*!
      *  Returns the local density parameter of the atmosphere in kg per meter^3, at the specified conditions.
@@ -219,28 +238,8 @@ public:
     double getDensity( const double altitude, const double longitude = 0.0,
                        const double latitude = 0.0, const double time = 0.0 )
     {
-        // Get list of independent variables
-        for ( unsigned int i = 0; i < numberOfIndependentVariables_; i++ )
-        {
-            switch ( independentVariables_.at( i ) )
-            {
-            case altitude_dependent_atmosphere:
-                independentVariableData_[ i ] = altitude;
-                break;
-            case longitude_dependent_atmosphere:
-                independentVariableData_[ i ] = longitude;
-                break;
-            case latitude_dependent_atmosphere:
-                independentVariableData_[ i ] = latitude;
-                break;
-            case time_dependent_atmosphere:
-                independentVariableData_[ i ] = time;
-                break;
-            }
-        }
-
-        // Give output
-        return interpolatorForDensity_->interpolate( independentVariableData_ );
+        updateDependentVariables( altitude, longitude, latitude, time );
+        return currentDependentVariables_( density_dependent_atmosphere );
     }
 
     //! Get local pressure.
@@ -255,29 +254,8 @@ public:
     double getPressure( const double altitude, const double longitude = 0.0,
                         const double latitude = 0.0, const double time = 0.0 )
     {
-        // Get list of independent variables
-        std::vector< double > independentVariableData;
-        for ( unsigned int i = 0; i < numberOfIndependentVariables_; i++ )
-        {
-            switch ( independentVariables_.at( i ) )
-            {
-            case altitude_dependent_atmosphere:
-                independentVariableData.push_back( altitude );
-                break;
-            case longitude_dependent_atmosphere:
-                independentVariableData.push_back( longitude );
-                break;
-            case latitude_dependent_atmosphere:
-                independentVariableData.push_back( latitude );
-                break;
-            case time_dependent_atmosphere:
-                independentVariableData.push_back( time );
-                break;
-            }
-        }
-
-        // Give output
-        return interpolatorForPressure_->interpolate( independentVariableData );
+        updateDependentVariables( altitude, longitude, latitude, time );
+        return currentDependentVariables_( pressure_dependent_atmosphere );
     }
 
     //! Get local temperature.
@@ -292,29 +270,8 @@ public:
     double getTemperature( const double altitude, const double longitude = 0.0,
                            const double latitude = 0.0, const double time = 0.0 )
     {
-        // Get list of independent variables
-        std::vector< double > independentVariableData;
-        for ( unsigned int i = 0; i < numberOfIndependentVariables_; i++ )
-        {
-            switch ( independentVariables_.at( i ) )
-            {
-            case altitude_dependent_atmosphere:
-                independentVariableData.push_back( altitude );
-                break;
-            case longitude_dependent_atmosphere:
-                independentVariableData.push_back( longitude );
-                break;
-            case latitude_dependent_atmosphere:
-                independentVariableData.push_back( latitude );
-                break;
-            case time_dependent_atmosphere:
-                independentVariableData.push_back( time );
-                break;
-            }
-        }
-
-        // Give output
-        return interpolatorForTemperature_->interpolate( independentVariableData );
+        updateDependentVariables( altitude, longitude, latitude, time );
+        return currentDependentVariables_( temperature_dependent_atmosphere );
     }
 
     //! Get specific gas constant.
@@ -331,29 +288,8 @@ public:
     {
         if ( dependentVariablesDependency_.at( gas_constant_dependent_atmosphere ) )
         {
-            // Get list of independent variables
-            std::vector< double > independentVariableData;
-            for ( unsigned int i = 0; i < numberOfIndependentVariables_; i++ )
-            {
-                switch ( independentVariables_.at( i ) )
-                {
-                case altitude_dependent_atmosphere:
-                    independentVariableData.push_back( altitude );
-                    break;
-                case longitude_dependent_atmosphere:
-                    independentVariableData.push_back( longitude );
-                    break;
-                case latitude_dependent_atmosphere:
-                    independentVariableData.push_back( latitude );
-                    break;
-                case time_dependent_atmosphere:
-                    independentVariableData.push_back( time );
-                    break;
-                }
-            }
-
-            // Give output
-            return interpolatorForGasConstant_->interpolate( independentVariableData );
+            updateDependentVariables( altitude, longitude, latitude, time );
+            return currentDependentVariables_( gas_constant_dependent_atmosphere );
         }
         else
         {
@@ -375,29 +311,8 @@ public:
     {
         if ( dependentVariablesDependency_.at( specific_heat_ratio_dependent_atmosphere ) )
         {
-            // Get list of independent variables
-            std::vector< double > independentVariableData;
-            for ( unsigned int i = 0; i < numberOfIndependentVariables_; i++ )
-            {
-                switch ( independentVariables_.at( i ) )
-                {
-                case altitude_dependent_atmosphere:
-                    independentVariableData.push_back( altitude );
-                    break;
-                case longitude_dependent_atmosphere:
-                    independentVariableData.push_back( longitude );
-                    break;
-                case latitude_dependent_atmosphere:
-                    independentVariableData.push_back( latitude );
-                    break;
-                case time_dependent_atmosphere:
-                    independentVariableData.push_back( time );
-                    break;
-                }
-            }
-
-            // Give output
-            return interpolatorForSpecificHeatRatio_->interpolate( independentVariableData );
+            updateDependentVariables( altitude, longitude, latitude, time );
+            return currentDependentVariables_( specific_heat_ratio_dependent_atmosphere );
         }
         else
         {
@@ -419,29 +334,8 @@ public:
     {
         if ( dependentVariablesDependency_.at( molar_mass_dependent_atmosphere ) )
         {
-            // Get list of independent variables
-            std::vector< double > independentVariableData;
-            for ( unsigned int i = 0; i < numberOfIndependentVariables_; i++ )
-            {
-                switch ( independentVariables_.at( i ) )
-                {
-                case altitude_dependent_atmosphere:
-                    independentVariableData.push_back( altitude );
-                    break;
-                case longitude_dependent_atmosphere:
-                    independentVariableData.push_back( longitude );
-                    break;
-                case latitude_dependent_atmosphere:
-                    independentVariableData.push_back( latitude );
-                    break;
-                case time_dependent_atmosphere:
-                    independentVariableData.push_back( time );
-                    break;
-                }
-            }
-
-            // Give output
-            return interpolatorForMolarMass_->interpolate( independentVariableData );
+            updateDependentVariables( altitude, longitude, latitude, time );
+            return currentDependentVariables_( molar_mass_dependent_atmosphere );
         }
         else
         {
@@ -488,6 +382,42 @@ private:
     template< unsigned int NumberOfIndependentVariables >
     void createMultiDimensionalAtmosphereInterpolators( );
 
+    //! Function to check whether a dependent variable is included in the interpolator.
+    /*!
+     *  Function to check whether a dependent variable is included in the interpolator. Density, pressure and temperature
+     *  are always included, the other dependent variables only when provided in the atmosphere table files.
+     *  \param dependentVariable Dependent variable (index in AtmosphereDependentVariables).
+     *  \return Boolean denoting whether the dependent variable is included in the interpolator.
+     */
+    bool isDependentVariableInterpolated( const unsigned int dependentVariable )
+    {
+        return ( dependentVariable <= temperature_dependent_atmosphere ) ||
+                dependentVariablesDependency_.at( dependentVariable );
+    }
+
+    //! Function to retrieve the default extrapolation values of all dependent variables combined
+    /*!
+     *  Function to retrieve the default extrapolation values of all dependent variables combined into the vectors used
+     *  by dependentVariablesInterpolator_.
+     *  \return Default extrapolation values (per independent variable) of all dependent variables combined
+     */
+    std::vector< std::pair< Eigen::Vector6d, Eigen::Vector6d > > getCombinedDefaultExtrapolationValues( );
+
+    //! Function to update the dependent variables (currentDependentVariables_) to the given conditions.
+    /*!
+     *  Function to update the dependent variables (currentDependentVariables_) to the given conditions. All dependent
+     *  variables are interpolated in a single call, so that the interval look-up and interpolation weights are computed
+     *  only once per query. If the independent variables are equal to those of the previous query, the dependent
+     *  variables are not recomputed, so that subsequent requests for different properties under the same conditions
+     *  (e.g. by the flight conditions) require no interpolation.
+     *  \param altitude Altitude at which dependent variables are to be computed.
+     *  \param longitude Longitude at which dependent variables are to be computed.
+     *  \param latitude Latitude at which dependent variables are to be computed.
+     *  \param time Time at which dependent variables are to be computed.
+     */
+    void updateDependentVariables( const double altitude, const double longitude,
+                                   const double latitude, const double time );
+
     //! The file name of the atmosphere table.
     /*!
      *  The file name of the atmosphere table. The file should contain four columns of data,
@@ -526,23 +456,10 @@ private:
     //! Ratio of specific heats of the atmosphere at constant pressure and constant volume.
     double ratioOfSpecificHeats_;
 
-    //! Interpolation for density. Note that type of interpolator depends on number of independent variables specified.
-    std::shared_ptr< interpolators::Interpolator< double, double > > interpolatorForDensity_;
-
-    //! Interpolation for pressure. Note that type of interpolator depends on number of independent variables specified.
-    std::shared_ptr< interpolators::Interpolator< double, double > > interpolatorForPressure_;
-
-    //! Interpolation for temperature. Note that type of interpolator depends on number of independent variables specified.
-    std::shared_ptr< interpolators::Interpolator< double, double > > interpolatorForTemperature_;
-
-    //! Interpolation for specific gas constant. Note that type of interpolator depends on number of independent variables specified.
-    std::shared_ptr< interpolators::Interpolator< double, double > > interpolatorForGasConstant_;
-
-    //! Interpolation for ratio of specific heats. Note that type of interpolator depends on number of independent variables specified.
-    std::shared_ptr< interpolators::Interpolator< double, double > > interpolatorForSpecificHeatRatio_;
-
-    //! Interpolation for molar mass. Note that type of interpolator depends on number of independent variables specified.
-    std::shared_ptr< interpolators::Interpolator< double, double > > interpolatorForMolarMass_;
+    //! Interpolator for all dependent variables, with entry i of the interpolated vector corresponding to
+    //! AtmosphereDependentVariables entry i. Note that type of interpolator depends on number of independent variables
+    //! specified.
+    std::shared_ptr< interpolators::Interpolator< double, Eigen::Vector6d > > dependentVariablesInterpolator_;
 
     //! Behavior of interpolator when independent variable is outside range.
     std::vector< interpolators::BoundaryInterpolationType > boundaryHandling_;
@@ -557,8 +474,18 @@ private:
      */
     std::vector< std::vector< std::pair< double, double > > > defaultExtrapolationValue_;
 
+    //! Independent variables (in order of independentVariables_) of current query.
     std::vector< double > independentVariableData_;
 
+    //! Independent variables (in order of independentVariables_) at which currentDependentVariables_ were computed.
+    std::vector< double > currentIndependentVariableData_;
+
+    //! Dependent variables at currentIndependentVariableData_ (see dependentVariablesInterpolator_).
+    Eigen::Vector6d currentDependentVariables_;
+
+    //! Boolean denoting whether currentDependentVariables_ have been computed.
+    bool areCurrentDependentVariablesSet_;
+
 };
 
 //! Typedef for shared-pointer to TabulatedAtmosphere object.
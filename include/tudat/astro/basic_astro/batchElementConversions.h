@@ -0,0 +1,278 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_BATCH_ELEMENT_CONVERSIONS_H
+#define TUDAT_BATCH_ELEMENT_CONVERSIONS_H
+
+#include <algorithm>
+#include <functional>
+
+#include <Eigen/Core>
+
+#include "tudat/basics/parallelization.h"
+#include "tudat/astro/basic_astro/orbitalElementConversions.h"
+#include "tudat/astro/basic_astro/modifiedEquinoctialElementConversions.h"
+#include "tudat/astro/basic_astro/sphericalStateConversions.h"
+#include "tudat/astro/basic_astro/unifiedStateModelQuaternionElementConversions.h"
+
+namespace tudat
+{
+
+namespace orbital_element_conversions
+{
+
+//! Minimum number of states per task when distributing a batch conversion over multiple threads
+const int MINIMUM_NUMBER_OF_STATES_PER_CONVERSION_TASK = 256;
+
+//! Function to convert a batch of states, each stored as a column of a matrix, using a single-state conversion function
+/*!
+ *  Function to convert a batch of states, each stored as a column of a matrix, using a single-state conversion function.
+ *  The converted states are written directly into the columns of the output matrix, which is allocated once. If more than
+ *  one thread is requested, the columns are split into contiguous chunks (of at least
+ *  MINIMUM_NUMBER_OF_STATES_PER_CONVERSION_TASK states), which are converted concurrently. The conversion function must
+ *  therefore be safe to call concurrently (which is the case for the element conversion functions).
+ *  \param inputStates States that are to be converted, one state per column
+ *  \param convertState Function converting a single state (input column) into the output column (by reference)
+ *  \param numberOfThreads Maximum number of threads over which the conversion is distributed
+ *  \return Converted states, one state per column
+ */
+template< int InputSize, int OutputSize, typename ScalarType >
+Eigen::Matrix< ScalarType, OutputSize, Eigen::Dynamic > convertStateBatch(
+        const Eigen::Matrix< ScalarType, InputSize, Eigen::Dynamic >& inputStates,
+        const std::function< void( const Eigen::Matrix< ScalarType, InputSize, 1 >&,
+                                   Eigen::Matrix< ScalarType, OutputSize, 1 >& ) >& convertState,
+        const int numberOfThreads = 1 )
+{
+    const int numberOfStates = static_cast< int >( inputStates.cols( ) );
+    Eigen::Matrix< ScalarType, OutputSize, Eigen::Dynamic > outputStates( OutputSize, numberOfStates );
+
+    // Convert the states in a given (contiguous) range of columns
+    auto convertStateRange = [ & ]( const int startIndex, const int endIndex )
+    {
+        Eigen::Matrix< ScalarType, InputSize, 1 > currentInputState;
+        Eigen::Matrix< ScalarType, OutputSize, 1 > currentOutputState;
+        for( int i = startIndex; i < endIndex; i++ )
+        {
+            currentInputState = inputStates.col( i );
+            convertState( currentInputState, currentOutputState );
+            outputStates.col( i ) = currentOutputState;
+        }
+    };
+
+    int numberOfTasks = std::min(
+                numberOfThreads, numberOfStates / MINIMUM_NUMBER_OF_STATES_PER_CONVERSION_TASK );
+    if( numberOfTasks <= 1 )
+    {
+        convertStateRange( 0, numberOfStates );
+    }
+    else
+    {
+        int statesPerTask = ( numberOfStates + numberOfTasks - 1 ) / numberOfTasks;
+        utilities::executeParallelTasks(
+                    numberOfTasks, [ & ]( const int taskIndex )
+        {
+            convertStateRange( taskIndex * statesPerTask,
+                               std::min( numberOfStates, ( taskIndex + 1 ) * statesPerTask ) );
+        }, numberOfThreads );
+    }
+    return outputStates;
+}
+
+//! Function to convert a batch of Keplerian elements to Cartesian elements
+/*!
+ *  Function to convert a batch of Keplerian elements to Cartesian elements (see convertKeplerianToCartesianElements).
+ *  \param keplerianElements Keplerian elements that are to be converted, one state per column
+ *  \param centralBodyGravitationalParameter Gravitational parameter of central body
+ *  \param numberOfThreads Maximum number of threads over which the conversion is distributed
+ *  \return Cartesian elements, one state per column
+ */
+template< typename ScalarType = double >
+Eigen::Matrix< ScalarType, 6, Eigen::Dynamic > convertKeplerianToCartesianElementsBatch(
+        const Eigen::Matrix< ScalarType, 6, Eigen::Dynamic >& keplerianElements,
+        const ScalarType centralBodyGravitationalParameter,
+        const int numberOfThreads = 1 )
+{
+    return convertStateBatch< 6, 6, ScalarType >(
+                keplerianElements, [ = ]( const Eigen::Matrix< ScalarType, 6, 1 >& inputState,
+                Eigen::Matrix< ScalarType, 6, 1 >& outputState )
+    {
+        outputState = convertKeplerianToCartesianElements< ScalarType >( inputState, centralBodyGravitationalParameter );
+    }, numberOfThreads );
+}
+
+//! Function to convert a batch of Cartesian elements to Keplerian elements
+/*!
+ *  Function to convert a batch of Cartesian elements to Keplerian elements (see convertCartesianToKeplerianElements).
+ *  \param cartesianElements Cartesian elements that are to be converted, one state per column
+ *  \param centralBodyGravitationalParameter Gravitational parameter of central body
+ *  \param numberOfThreads Maximum number of threads over which the conversion is distributed
+ *  \return Keplerian elements, one state per column
+ */
+template< typename ScalarType = double >
+Eigen::Matrix< ScalarType, 6, Eigen::Dynamic > convertCartesianToKeplerianElementsBatch(
+        const Eigen::Matrix< ScalarType, 6, Eigen::Dynamic >& cartesianElements,
+        const ScalarType centralBodyGravitationalParameter,
+        const int numberOfThreads = 1 )
+{
+    return convertStateBatch< 6, 6, ScalarType >(
+                cartesianElements, [ = ]( const Eigen::Matrix< ScalarType, 6, 1 >& inputState,
+                Eigen::Matrix< ScalarType, 6, 1 >& outputState )
+    {
+        outputState = convertCartesianToKeplerianElements< ScalarType >( inputState, centralBodyGravitationalParameter );
+    }, numberOfThreads );
+}
+
+//! Function to convert a batch of modified equinoctial elements to Cartesian elements
+/*!
+ *  Function to convert a batch of modified equinoctial elements to Cartesian elements (see
+ *  convertModifiedEquinoctialToCartesianElements).
+ *  \param modifiedEquinoctialElements Modified equinoctial elements that are to be converted, one state per column
+ *  \param centralBodyGravitationalParameter Gravitational parameter of central body
+ *  \param flipSingularityToZeroInclination Boolean denoting whether the elements use the retrograde factor (singularity
+ *  at zero inclination)
+ *  \param numberOfThreads Maximum number of threads over which the conversion is distributed
+ *  \return Cartesian elements, one state per column
+ */
+template< typename ScalarType = double >
+Eigen::Matrix< ScalarType, 6, Eigen::Dynamic > convertModifiedEquinoctialToCartesianElementsBatch(
+        const Eigen::Matrix< ScalarType, 6, Eigen::Dynamic >& modifiedEquinoctialElements,
+        const ScalarType centralBodyGravitationalParameter,
+        const bool flipSingularityToZeroInclination,
+        const int numberOfThreads = 1 )
+{
+    return convertStateBatch< 6, 6, ScalarType >(
+                modifiedEquinoctialElements, [ = ]( const Eigen::Matrix< ScalarType, 6, 1 >& inputState,
+                Eigen::Matrix< ScalarType, 6, 1 >& outputState )
+    {
+        outputState = convertModifiedEquinoctialToCartesianElements< ScalarType >(
+                    inputState, centralBodyGravitationalParameter, flipSingularityToZeroInclination );
+    }, numberOfThreads );
+}
+
+//! Function to convert a batch of Cartesian elements to modified equinoctial elements
+/*!
+ *  Function to convert a batch of Cartesian elements to modified equinoctial elements (see
+ *  convertCartesianToModifiedEquinoctialElements).
+ *  \param cartesianElements Cartesian elements that are to be converted, one state per column
+ *  \param centralBodyGravitationalParameter Gravitational parameter of central body
+ *  \param flipSingularityToZeroInclination Boolean denoting whether the elements are to use the retrograde factor
+ *  (singularity at zero inclination)
+ *  \param numberOfThreads Maximum number of threads over which the conversion is distributed
+ *  \return Modified equinoctial elements, one state per column
+ */
+template< typename ScalarType = double >
+Eigen::Matrix< ScalarType, 6, Eigen::Dynamic > convertCartesianToModifiedEquinoctialElementsBatch(
+        const Eigen::Matrix< ScalarType, 6, Eigen::Dynamic >& cartesianElements,
+        const ScalarType centralBodyGravitationalParameter,
+        const bool flipSingularityToZeroInclination,
+        const int numberOfThreads = 1 )
+{
+    return convertStateBatch< 6, 6, ScalarType >(
+                cartesianElements, [ = ]( const Eigen::Matrix< ScalarType, 6, 1 >& inputState,
+                Eigen::Matrix< ScalarType, 6, 1 >& outputState )
+    {
+        outputState = convertCartesianToModifiedEquinoctialElements< ScalarType >(
+                    inputState, centralBodyGravitationalParameter, flipSingularityToZeroInclination );
+    }, numberOfThreads );
+}
+
+//! Function to convert a batch of unified state model elements (with quaternions) to Cartesian elements
+/*!
+ *  Function to convert a batch of unified state model elements (with quaternions) to Cartesian elements (see
+ *  convertUnifiedStateModelQuaternionsToCartesianElements).
+ *  \param unifiedStateModelElements USM7 elements that are to be converted, one state per column
+ *  \param centralBodyGravitationalParameter Gravitational parameter of central body
+ *  \param forceQuaternionNormalization Boolean denoting whether the quaternions are to be normalized before conversion
+ *  \param numberOfThreads Maximum number of threads over which the conversion is distributed
+ *  \return Cartesian elements, one state per column
+ */
+inline Eigen::Matrix< double, 6, Eigen::Dynamic > convertUnifiedStateModelQuaternionsToCartesianElementsBatch(
+        const Eigen::Matrix< double, 7, Eigen::Dynamic >& unifiedStateModelElements,
+        const double centralBodyGravitationalParameter,
+        const bool forceQuaternionNormalization = false,
+        const int numberOfThreads = 1 )
+{
+    return convertStateBatch< 7, 6, double >(
+                unifiedStateModelElements, [ = ]( const Eigen::Matrix< double, 7, 1 >& inputState,
+                Eigen::Matrix< double, 6, 1 >& outputState )
+    {
+        outputState = convertUnifiedStateModelQuaternionsToCartesianElements(
+                    inputState, centralBodyGravitationalParameter, forceQuaternionNormalization );
+    }, numberOfThreads );
+}
+
+//! Function to convert a batch of Cartesian elements to unified state model elements (with quaternions)
+/*!
+ *  Function to convert a batch of Cartesian elements to unified state model elements (with quaternions) (see
+ *  convertCartesianToUnifiedStateModelQuaternionsElements).
+ *  \param cartesianElements Cartesian elements that are to be converted, one state per column
+ *  \param centralBodyGravitationalParameter Gravitational parameter of central body
+ *  \param numberOfThreads Maximum number of threads over which the conversion is distributed
+ *  \return USM7 elements, one state per column
+ */
+inline Eigen::Matrix< double, 7, Eigen::Dynamic > convertCartesianToUnifiedStateModelQuaternionsElementsBatch(
+        const Eigen::Matrix< double, 6, Eigen::Dynamic >& cartesianElements,
+        const double centralBodyGravitationalParameter,
+        const int numberOfThreads = 1 )
+{
+    return convertStateBatch< 6, 7, double >(
+                cartesianElements, [ = ]( const Eigen::Matrix< double, 6, 1 >& inputState,
+                Eigen::Matrix< double, 7, 1 >& outputState )
+    {
+        outputState = convertCartesianToUnifiedStateModelQuaternionsElements(
+                    inputState, centralBodyGravitationalParameter );
+    }, numberOfThreads );
+}
+
+//! Function to convert a batch of body-fixed Cartesian states to spherical orbital states
+/*!
+ *  Function to convert a batch of body-fixed Cartesian states to spherical orbital states (see
+ *  convertCartesianToSphericalOrbitalState), e.g. for the computation of ground tracks.
+ *  \param bodyFixedCartesianStates Body-fixed Cartesian states that are to be converted, one state per column
+ *  \param numberOfThreads Maximum number of threads over which the conversion is distributed
+ *  \return Spherical orbital states, one state per column
+ */
+inline Eigen::Matrix< double, 6, Eigen::Dynamic > convertCartesianToSphericalOrbitalStateBatch(
+        const Eigen::Matrix< double, 6, Eigen::Dynamic >& bodyFixedCartesianStates,
+        const int numberOfThreads = 1 )
+{
+    return convertStateBatch< 6, 6, double >(
+                bodyFixedCartesianStates, [ ]( const Eigen::Matrix< double, 6, 1 >& inputState,
+                Eigen::Matrix< double, 6, 1 >& outputState )
+    {
+        outputState = convertCartesianToSphericalOrbitalState( inputState );
+    }, numberOfThreads );
+}
+
+//! Function to convert a batch of spherical orbital states to body-fixed Cartesian states
+/*!
+ *  Function to convert a batch of spherical orbital states to body-fixed Cartesian states (see
+ *  convertSphericalOrbitalToCartesianState).
+ *  \param sphericalOrbitalStates Spherical orbital states that are to be converted, one state per column
+ *  \param numberOfThreads Maximum number of threads over which the conversion is distributed
+ *  \return Body-fixed Cartesian states, one state per column
+ */
+inline Eigen::Matrix< double, 6, Eigen::Dynamic > convertSphericalOrbitalToCartesianStateBatch(
+        const Eigen::Matrix< double, 6, Eigen::Dynamic >& sphericalOrbitalStates,
+        const int numberOfThreads = 1 )
+{
+    return convertStateBatch< 6, 6, double >(
+                sphericalOrbitalStates, [ ]( const Eigen::Matrix< double, 6, 1 >& inputState,
+                Eigen::Matrix< double, 6, 1 >& outputState )
+    {
+        outputState = convertSphericalOrbitalToCartesianState< double >( inputState );
+    }, numberOfThreads );
+}
+
+} // namespace orbital_element_conversions
+
+} // namespace tudat
+
+#endif // TUDAT_BATCH_ELEMENT_CONVERSIONS_H
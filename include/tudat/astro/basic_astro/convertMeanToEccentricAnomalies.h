@@ -37,6 +37,8 @@
 
 #include <cmath>
 
+#include <Eigen/Core>
+
 #include "tudat/math/root_finders/createRootFinder.h"
 #include "tudat/math/basic/mathematicalConstants.h"
 #include "tudat/math/basic/basicMathematicsFunctions.h"
@@ -415,6 +417,194 @@ ScalarType convertMeanAnomalyToHyperbolicEccentricAnomaly(
     return hyperbolicEccentricAnomaly;
 }
 
+//! Function to apply a fixed number of fourth-order (Danby) corrections to solutions of Kepler's equation.
+/*!
+ * Function to apply a fixed number of fourth-order corrections to approximate solutions of Kepler's equation, for a
+ * batch of values, as described by Danby (1987). All operations are performed on full arrays (without branches or
+ * memory allocation inside the iterations), allowing them to be vectorized by the compiler and Eigen.
+ * \param eccentricities Eccentricities of the orbits [-].
+ * \param meanAnomalies (Hyperbolic) mean anomalies to convert [rad].
+ * \param anomalies (Hyperbolic) eccentric anomalies: initial guess as input, corrected values as output [rad].
+ * \param numberOfIterations Number of corrections that are applied.
+ * \param isOrbitHyperbolic Boolean denoting whether the hyperbolic (true) or elliptic (false) form of Kepler's
+ * equation is solved.
+ * \return Estimate of the remaining error of each anomaly (computed from a final Newton-Raphson step) [rad].
+ */
+template< typename ScalarType = double >
+Eigen::Array< ScalarType, Eigen::Dynamic, 1 > applyKeplerEquationCorrections(
+        const Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& eccentricities,
+        const Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& meanAnomalies,
+        Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& anomalies,
+        const int numberOfIterations,
+        const bool isOrbitHyperbolic )
+{
+    typedef Eigen::Array< ScalarType, Eigen::Dynamic, 1 > ArrayType;
+    const ScalarType one = mathematical_constants::getFloatingInteger< ScalarType >( 1 );
+    const ScalarType half = mathematical_constants::getFloatingFraction< ScalarType >( 1, 2 );
+    const ScalarType sixth = mathematical_constants::getFloatingFraction< ScalarType >( 1, 6 );
+
+    // Allocate work arrays once for all iterations
+    ArrayType secondDerivatives( anomalies.rows( ) ), thirdDerivatives( anomalies.rows( ) );
+    ArrayType functionValues( anomalies.rows( ) ), firstDerivatives( anomalies.rows( ) ), corrections( anomalies.rows( ) );
+
+    for( int i = 0; i <= numberOfIterations; i++ )
+    {
+        // Compute Kepler's function, and its first, second and third derivative
+        if( !isOrbitHyperbolic )
+        {
+            secondDerivatives = eccentricities * anomalies.sin( );
+            thirdDerivatives = eccentricities * anomalies.cos( );
+            functionValues = anomalies - secondDerivatives - meanAnomalies;
+            firstDerivatives = one - thirdDerivatives;
+        }
+        else
+        {
+            secondDerivatives = eccentricities * anomalies.sinh( );
+            thirdDerivatives = eccentricities * anomalies.cosh( );
+            functionValues = secondDerivatives - anomalies - meanAnomalies;
+            firstDerivatives = thirdDerivatives - one;
+        }
+
+        // Compute Newton-Raphson correction; on final pass, only use it as estimate of the remaining error
+        corrections = -functionValues / firstDerivatives;
+        if( i == numberOfIterations )
+        {
+            break;
+        }
+
+        // Apply fourth-order correction
+        corrections = -functionValues / ( firstDerivatives + half * corrections * secondDerivatives );
+        corrections = -functionValues / ( firstDerivatives + half * corrections * secondDerivatives +
+                                          sixth * corrections.square( ) * thirdDerivatives );
+        anomalies += corrections;
+    }
+    return corrections.abs( );
+}
+
+//! Convert a batch of mean anomalies to eccentric anomalies.
+/*!
+ * Converts a batch of mean anomalies to eccentric anomalies for elliptical orbits, for all eccentricities >= 0.0 and
+ * < 1.0. Contrary to the convertMeanAnomalyToEccentricAnomaly function, no root finder objects are used. Instead, a
+ * fixed number of fourth-order corrections (see applyKeplerEquationCorrections) is applied to the starter
+ * E = M + 0.85 * e * sign( sin( M ) ) [Danby, 1987], on the full set of values at once. Values for which the estimated
+ * remaining error is larger than the tolerance after these iterations (typically only very close to parabolic orbits) are
+ * recomputed using the convertMeanAnomalyToEccentricAnomaly function. As for that function, the mean anomalies are first
+ * reduced to the range [0, 2 PI).
+ * \param eccentricities Eccentricities of the orbits [-].
+ * \param meanAnomalies Mean anomalies to convert to eccentric anomalies [rad].
+ * \param numberOfIterations Number of fourth-order corrections that are applied, before the convergence is checked.
+ * \return Eccentric anomalies [rad].
+ */
+template< typename ScalarType = double >
+Eigen::Array< ScalarType, Eigen::Dynamic, 1 > convertMeanAnomaliesToEccentricAnomalies(
+        const Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& eccentricities,
+        const Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& meanAnomalies,
+        const int numberOfIterations = 4 )
+{
+    using namespace mathematical_constants;
+    typedef Eigen::Array< ScalarType, Eigen::Dynamic, 1 > ArrayType;
+
+    if( eccentricities.rows( ) != meanAnomalies.rows( ) )
+    {
+        throw std::runtime_error( "Error when converting mean to eccentric anomalies, input sizes are inconsistent." );
+    }
+    else if( eccentricities.rows( ) == 0 )
+    {
+        return ArrayType( 0 );
+    }
+    else if( ( eccentricities < getFloatingInteger< ScalarType >( 0 ) ).any( ) ||
+             ( eccentricities >= getFloatingInteger< ScalarType >( 1 ) ).any( ) )
+    {
+        throw std::runtime_error( "Invalid eccentricity. Valid range is 0.0 <= e < 1.0. Eccentricity range was: " +
+                                  std::to_string( eccentricities.minCoeff( ) ) + " to " +
+                                  std::to_string( eccentricities.maxCoeff( ) ) );
+    }
+
+    // Set mean anomalies to region between 0 and 2 PI.
+    const ScalarType twoPi = getFloatingInteger< ScalarType >( 2 ) * getPi< ScalarType >( );
+    ArrayType reducedMeanAnomalies = meanAnomalies - twoPi * ( meanAnomalies / twoPi ).floor( );
+
+    // Set initial guess, and refine solution
+    ArrayType eccentricAnomalies = reducedMeanAnomalies + getFloatingFraction< ScalarType >( 85, 100 ) *
+            ( reducedMeanAnomalies < getPi< ScalarType >( ) ).select( eccentricities, -eccentricities );
+    ArrayType remainingErrors = applyKeplerEquationCorrections< ScalarType >(
+                eccentricities, reducedMeanAnomalies, eccentricAnomalies, numberOfIterations, false );
+
+    // Recompute non-converged values
+    const ScalarType tolerance = 10.0 * std::numeric_limits< ScalarType >::epsilon( ) * twoPi;
+    for( int i = 0; i < eccentricAnomalies.rows( ); i++ )
+    {
+        if( !( remainingErrors( i ) <= tolerance ) )
+        {
+            eccentricAnomalies( i ) = convertMeanAnomalyToEccentricAnomaly< ScalarType >(
+                        eccentricities( i ), reducedMeanAnomalies( i ) );
+        }
+    }
+
+    return eccentricAnomalies;
+}
+
+//! Convert a batch of hyperbolic mean anomalies to hyperbolic eccentric anomalies.
+/*!
+ * Converts a batch of hyperbolic mean anomalies to hyperbolic eccentric anomalies for hyperbolic orbits, for all
+ * eccentricities > 1.0. Contrary to the convertMeanAnomalyToHyperbolicEccentricAnomaly function, no root finder objects
+ * are used. Instead, a fixed number of fourth-order corrections (see applyKeplerEquationCorrections) is applied to the
+ * starter F = sign( M ) * ln( 2 * |M| / e + 1.8 ) [Danby, 1987], on the full set of values at once. Values for which the
+ * estimated remaining error is larger than the tolerance after these iterations (typically only close to parabolic
+ * orbits) are recomputed using the convertMeanAnomalyToHyperbolicEccentricAnomaly function.
+ * \param eccentricities Eccentricities of the orbits [-].
+ * \param hyperbolicMeanAnomalies Hyperbolic mean anomalies to convert to hyperbolic eccentric anomalies [rad].
+ * \param numberOfIterations Number of fourth-order corrections that are applied, before the convergence is checked.
+ * \return Hyperbolic eccentric anomalies [rad].
+ */
+template< typename ScalarType = double >
+Eigen::Array< ScalarType, Eigen::Dynamic, 1 > convertMeanAnomaliesToHyperbolicEccentricAnomalies(
+        const Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& eccentricities,
+        const Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& hyperbolicMeanAnomalies,
+        const int numberOfIterations = 6 )
+{
+    using namespace mathematical_constants;
+    typedef Eigen::Array< ScalarType, Eigen::Dynamic, 1 > ArrayType;
+
+    if( eccentricities.rows( ) != hyperbolicMeanAnomalies.rows( ) )
+    {
+        throw std::runtime_error(
+                    "Error when converting mean to hyperbolic eccentric anomalies, input sizes are inconsistent." );
+    }
+    else if( eccentricities.rows( ) == 0 )
+    {
+        return ArrayType( 0 );
+    }
+    else if( !( eccentricities > getFloatingInteger< ScalarType >( 1 ) ).all( ) )
+    {
+        throw std::runtime_error( "Invalid eccentricity. Valid range is e > 1.0. Minimum eccentricity was: " +
+                                  std::to_string( eccentricities.minCoeff( ) ) );
+    }
+
+    // Set initial guess, and refine solution
+    ArrayType hyperbolicEccentricAnomalies =
+            ( getFloatingInteger< ScalarType >( 2 ) * hyperbolicMeanAnomalies.abs( ) / eccentricities +
+              getFloatingFraction< ScalarType >( 9, 5 ) ).log( );
+    hyperbolicEccentricAnomalies =
+            ( hyperbolicMeanAnomalies < getFloatingInteger< ScalarType >( 0 ) ).select(
+                -hyperbolicEccentricAnomalies, hyperbolicEccentricAnomalies );
+    ArrayType remainingErrors = applyKeplerEquationCorrections< ScalarType >(
+                eccentricities, hyperbolicMeanAnomalies, hyperbolicEccentricAnomalies, numberOfIterations, true );
+
+    // Recompute non-converged values
+    for( int i = 0; i < hyperbolicEccentricAnomalies.rows( ); i++ )
+    {
+        if( !( remainingErrors( i ) <= 25.0 * std::numeric_limits< ScalarType >::epsilon( ) *
+               std::max( getFloatingInteger< ScalarType >( 1 ), std::fabs( hyperbolicEccentricAnomalies( i ) ) ) ) )
+        {
+            hyperbolicEccentricAnomalies( i ) = convertMeanAnomalyToHyperbolicEccentricAnomaly< ScalarType >(
+                        eccentricities( i ), hyperbolicMeanAnomalies( i ) );
+        }
+    }
+
+    return hyperbolicEccentricAnomalies;
+}
+
 } // namespace orbital_element_conversions
 
 } // namespace tudat
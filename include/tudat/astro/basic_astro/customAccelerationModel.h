@@ -12,7 +12,9 @@
 #ifndef TUDAT_CUSTOM_ACCELERATION_MODEL_H
 #define TUDAT_CUSTOM_ACCELERATION_MODEL_H
 
+#include "tudat/basics/basicTypedefs.h"
 #include "tudat/astro/basic_astro/accelerationModel.h"
+#include "tudat/math/basic/forwardModeDifferentiation.h"
 
 namespace tudat
 {  
@@ -27,17 +29,88 @@ public:
     {
     }
 
+    //! Constructor for an acceleration that depends on the state of the body undergoing the acceleration
+    /*!
+     *  Constructor for an acceleration that depends on the (inertial) state of the body undergoing the acceleration. In
+     *  addition to the acceleration function itself, the same function evaluated with dual numbers is provided, from which
+     *  the exact partial derivatives of the acceleration w.r.t. the state are computed (forward-mode automatic
+     *  differentiation) by getCurrentStatePartial.
+     *  \param stateDependentAccelerationFunction Acceleration as a function of time and state
+     *  \param dualAccelerationFunction Acceleration as a function of time and state, evaluated with dual numbers
+     *  \param stateFunction Function returning the current inertial state of the body undergoing the acceleration
+     */
+    CustomAccelerationModel(
+            const std::function< Eigen::Vector3d( const double, const Eigen::Vector6d& ) > stateDependentAccelerationFunction,
+            const std::function< automatic_differentiation::Vector3StateDual(
+                const double, const automatic_differentiation::StateDualVector& ) > dualAccelerationFunction,
+            const std::function< Eigen::Vector6d( ) > stateFunction ):
+        stateDependentAccelerationFunction_( stateDependentAccelerationFunction ),
+        dualAccelerationFunction_( dualAccelerationFunction ),
+        stateFunction_( stateFunction ),
+        currentEvaluationTime_( TUDAT_NAN )
+    {
+    }
+
     virtual void updateMembers( const double currentTime = TUDAT_NAN )
     {
         if( !( this->currentTime_ == currentTime ) )
         {
-            currentAcceleration_ = accelerationFunction_( currentTime );
+            if( stateDependentAccelerationFunction_ == nullptr )
+            {
+                currentAcceleration_ = accelerationFunction_( currentTime );
+            }
+            else
+            {
+                currentState_ = stateFunction_( );
+                currentEvaluationTime_ = currentTime;
+                currentAcceleration_ = stateDependentAccelerationFunction_( currentTime, currentState_ );
+            }
         }
 
     }
 
+    //! Function to check whether exact partials w.r.t. the state of the body undergoing acceleration can be computed
+    bool hasStatePartials( )
+    {
+        return ( dualAccelerationFunction_ != nullptr );
+    }
+
+    //! Function to compute the partial of the acceleration w.r.t. the state of the body undergoing acceleration
+    /*!
+     *  Function to compute the partial of the acceleration w.r.t. the state of the body undergoing acceleration, at the
+     *  time and state of the last call to updateMembers. All six columns are obtained in a single evaluation of the
+     *  acceleration function with dual numbers.
+     *  \return Partial of the acceleration w.r.t. the Cartesian state of the body undergoing acceleration
+     */
+    Eigen::Matrix< double, 3, 6 > getCurrentStatePartial( )
+    {
+        if( dualAccelerationFunction_ == nullptr )
+        {
+            throw std::runtime_error( "Error when computing custom acceleration state partial, no dual acceleration function is defined" );
+        }
+        return automatic_differentiation::getDualVectorJacobian(
+                    dualAccelerationFunction_(
+                        currentEvaluationTime_, automatic_differentiation::getSeededDualVector( currentState_ ) ) );
+    }
+
 private:
     std::function< Eigen::Vector3d( const double ) > accelerationFunction_;
+
+    //! Acceleration as a function of time and state (nullptr if acceleration depends on time only)
+    std::function< Eigen::Vector3d( const double, const Eigen::Vector6d& ) > stateDependentAccelerationFunction_;
+
+    //! Acceleration as a function of time and state, evaluated with dual numbers (nullptr if not available)
+    std::function< automatic_differentiation::Vector3StateDual(
+        const double, const automatic_differentiation::StateDualVector& ) > dualAccelerationFunction_;
+
+    //! Function returning the current inertial state of the body undergoing the acceleration
+    std::function< Eigen::Vector6d( ) > stateFunction_;
+
+    //! State of the body undergoing the acceleration, at the last call to updateMembers
+    Eigen::Vector6d currentState_;
+
+    //! Time of the last call to updateMembers
+    double currentEvaluationTime_;
 };
 
 
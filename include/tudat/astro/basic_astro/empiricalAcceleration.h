@@ -24,6 +24,7 @@
 
 #include "tudat/astro/ephemerides/rotationalEphemeris.h"
 #include "tudat/astro/reference_frames/referenceFrameTransformations.h"
+#include "tudat/math/interpolators/arcCursor.h"
 
 namespace tudat
 {
@@ -213,6 +214,7 @@ public:
 
         areAccelerationComponentsTimeDependent_ = 0;
         accelerationComponentsFunction_ = [ = ]( const double ){ return newAccelerationComponents; };
+        arcCursor_ = nullptr;
 
     }
 
@@ -227,9 +229,41 @@ public:
     {
         areAccelerationComponentsTimeDependent_ = 1;
         accelerationComponentsFunction_ = accelerationComponentsFunction;
+        arcCursor_ = nullptr;
 
     }
 
+    //! Function to reset arc-wise constant empirical acceleration components
+    /*!
+     *  Function to reset arc-wise constant empirical acceleration components. The arc in which the current time lies is
+     *  retrieved from the arc cursor, and the components are only updated when this arc changes. For times before the
+     *  start of the first arc, the components of the first arc are used.
+     *  \param arcCursor Object used to retrieve the arc in which a given time lies
+     *  \param arcWiseAccelerationComponents Empirical acceleration components per arc. Constant, sine and cosine terms are
+     *  given in first, second and third column of each matrix, respectively.
+     */
+    void resetArcWiseAccelerationComponents(
+            const std::shared_ptr< interpolators::ArcCursor > arcCursor,
+            const std::vector< Eigen::Matrix3d >& arcWiseAccelerationComponents )
+    {
+        if( static_cast< int >( arcWiseAccelerationComponents.size( ) ) != arcCursor->getNumberOfArcs( ) )
+        {
+            throw std::runtime_error( "Error when resetting arc-wise empirical acceleration components, number of arcs is inconsistent" );
+        }
+
+        areAccelerationComponentsTimeDependent_ = 1;
+        arcCursor_ = arcCursor;
+        arcWiseAccelerationComponents_ = arcWiseAccelerationComponents;
+        accelerationComponentsFunction_ = [ = ]( const double time )
+        {
+            return arcWiseAccelerationComponents.at( std::max( arcCursor->getArcIndex( time ), 0 ) );
+        };
+
+        // Force update of components at next call to updateMembers
+        currentArcIndex_ = -1;
+        this->currentTime_ = TUDAT_NAN;
+    }
+
     //! Function to retrieve current state of the body that is undergoing the empirical acceleration, relative to central body
     /*!
      *  Function to retrieve Current state of the body that is undergoing the empirical acceleration, relative to central body,
@@ -290,6 +324,21 @@ private:
      */
     void updateAccelerationComponents( const double currentTime = 0.0 )
     {
+        // Retrieve arc-wise components directly, if arc has changed
+        if( arcCursor_ != nullptr )
+        {
+            int arcIndex = std::max( arcCursor_->getArcIndex( currentTime ), 0 );
+            if( arcIndex != currentArcIndex_ )
+            {
+                const Eigen::Matrix3d& accelerationComponents = arcWiseAccelerationComponents_[ arcIndex ];
+                currentConstantAcceleration_ = accelerationComponents.col( 0 );
+                currentSineAcceleration_ = accelerationComponents.col( 1 );
+                currentCosineAcceleration_ = accelerationComponents.col( 2 );
+                currentArcIndex_ = arcIndex;
+            }
+            return;
+        }
+
         Eigen::Matrix3d accelerationComponents = accelerationComponentsFunction_( currentTime );
 
         currentConstantAcceleration_ = accelerationComponents.block( 0, 0, 3, 1 );
@@ -307,6 +356,15 @@ private:
     //! Boolean denoting whether empirical accelerations are time-dependent.
     bool areAccelerationComponentsTimeDependent_;
 
+    //! Object used to retrieve the current arc, if empirical accelerations are arc-wise constant (nullptr otherwise).
+    std::shared_ptr< interpolators::ArcCursor > arcCursor_;
+
+    //! Empirical acceleration components per arc, if empirical accelerations are arc-wise constant.
+    std::vector< Eigen::Matrix3d > arcWiseAccelerationComponents_;
+
+    //! Index of arc for which the current acceleration components were set (-1 if not set).
+    int currentArcIndex_ = -1;
+
 
     //! Value of constant empirical acceleration, in RSW frame, as computed by last call to updateMembers function.
     Eigen::Vector3d currentConstantAcceleration_;
@@ -154,6 +154,61 @@ Eigen::Vector3d convertCartesianToGeodeticCoordinates( const Eigen::Vector3d car
                                                        const double flattening,
                                                        const double tolerance );
 
+//! Relative tolerance (w.r.t. equatorial radius) of the iterative geodetic conversion used close to the center of the body
+const double GEODETIC_CONVERSION_FALLBACK_TOLERANCE = 1.0E-12;
+
+//! Calculate geodetic coordinates (altitude, geodetic latitude, longitude) of a position vector, using a closed-form method.
+/*!
+ * Calculates the geodetic coordinates (altitude, geodetic latitude, longitude) of a position vector, using the closed-form
+ * method of Vermeille (2002), which requires no iterations. For points at a distance of more than approximately
+ * e^2 * equatorialRadius (~43 km for the Earth) from the center of the body, the method is exact up to round-off errors:
+ * compared to the iterative method (convertCartesianToGeodeticCoordinates) with a tolerance of 1 nm, differences are
+ * below 1.0E-8 m plus 1.0E-15 times the distance to the center of the body (i.e. at the level of the round-off of the
+ * position) in altitude, and below 1.0E-14 rad in latitude, for altitudes from -100 km to 1.0E8 m over the Earth. Closer
+ * to the center of the body (where the geodetic coordinates are not uniquely defined), the iterative method is used,
+ * with a tolerance of GEODETIC_CONVERSION_FALLBACK_TOLERANCE times the equatorial radius.
+ * \param cartesianCoordinates Cartesian position in body-fixed frame where geodetic coordinates are to be determined.
+ * \param equatorialRadius Equatorial radius of oblate spheroid.
+ * \param flattening Flattening of oblate spheroid.
+ * \return Geodetic coordinates at requested point.
+ */
+Eigen::Vector3d convertCartesianToGeodeticCoordinatesClosedForm( const Eigen::Vector3d& cartesianCoordinates,
+                                                                 const double equatorialRadius,
+                                                                 const double flattening );
+
+//! Calculate geodetic coordinates of a batch of position vectors, using a closed-form method.
+/*!
+ * Calculates the geodetic coordinates (altitude, geodetic latitude, longitude) of a batch of position vectors, using the
+ * closed-form method of convertCartesianToGeodeticCoordinatesClosedForm. The computations are performed on entire
+ * blocks of positions (as Eigen array operations, allowing the compiler to vectorize them), which are distributed over
+ * a number of threads.
+ * \param cartesianCoordinates Cartesian positions in body-fixed frame, one position per column.
+ * \param equatorialRadius Equatorial radius of oblate spheroid.
+ * \param flattening Flattening of oblate spheroid.
+ * \param numberOfThreads Maximum number of threads over which the conversion is distributed.
+ * \return Geodetic coordinates at requested points, one point per column.
+ */
+Eigen::Matrix3Xd convertCartesianToGeodeticCoordinatesBatch( const Eigen::Matrix3Xd& cartesianCoordinates,
+                                                             const double equatorialRadius,
+                                                             const double flattening,
+                                                             const int numberOfThreads = 1 );
+
+//! Calculate the Cartesian positions of a batch of geodetic coordinates.
+/*!
+ * Calculates the Cartesian positions of a batch of geodetic coordinates (altitude, geodetic latitude, longitude), see
+ * convertGeodeticToCartesianCoordinates. The computations are performed on entire blocks of points (as Eigen array
+ * operations), which are distributed over a number of threads.
+ * \param geodeticCoordinates Geodetic coordinates w.r.t. given body, one point per column.
+ * \param equatorialRadius Equatorial radius of oblate spheroid.
+ * \param flattening Flattening of oblate spheroid.
+ * \param numberOfThreads Maximum number of threads over which the conversion is distributed.
+ * \return Cartesian positions in body-fixed frame, one position per column.
+ */
+Eigen::Matrix3Xd convertGeodeticToCartesianCoordinatesBatch( const Eigen::Matrix3Xd& geodeticCoordinates,
+                                                             const double equatorialRadius,
+                                                             const double flattening,
+                                                             const int numberOfThreads = 1 );
+
 } // namespace coordinate_conversions
 
 } // namespace tudat
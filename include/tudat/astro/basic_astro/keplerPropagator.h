@@ -14,6 +14,8 @@
 
 
 
+#include <vector>
+
 #include <Eigen/Core>
 
 #include "tudat/astro/basic_astro/stateVectorIndices.h"
@@ -159,6 +161,105 @@ Eigen::Matrix< ScalarType, 6, 1 > propagateKeplerOrbit(
     return finalStateInKeplerianElements;
 }
 
+//! Propagate a batch of Kepler orbits.
+/*!
+ * Propagates a batch of Kepler orbits, providing the same result as successive calls to the propagateKeplerOrbit function
+ * (to within the convergence tolerance of the conversion from mean to eccentric anomaly), but solving Kepler's equation
+ * for all orbits at once, using the convertMeanAnomaliesToEccentricAnomalies and
+ * convertMeanAnomaliesToHyperbolicEccentricAnomalies functions. Elliptic and hyperbolic orbits may be mixed.
+ * Parabolic orbits are not supported and will result in an error message.
+ * \param initialStatesInKeplerianElements Initial states in classical Keplerian elements, with one orbit per row (see
+ * propagateKeplerOrbit for the order of elements). Each column contains a single element for all orbits.
+ * \param propagationTimes Propagation time for each orbit (entry i for row i of initialStatesInKeplerianElements). [s]
+ * \param centralBodyGravitationalParameter Gravitational parameter of central body      [m^3 s^-2]
+ * \return Final states in classical Keplerian elements, with one orbit per row (same format as input).
+ */
+template< typename ScalarType = double >
+Eigen::Matrix< ScalarType, Eigen::Dynamic, 6 > propagateKeplerOrbits(
+        const Eigen::Matrix< ScalarType, Eigen::Dynamic, 6 >& initialStatesInKeplerianElements,
+        const Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& propagationTimes,
+        const ScalarType centralBodyGravitationalParameter )
+{
+    typedef Eigen::Array< ScalarType, Eigen::Dynamic, 1 > ArrayType;
+    const int numberOfOrbits = initialStatesInKeplerianElements.rows( );
+
+    if( propagationTimes.rows( ) != numberOfOrbits )
+    {
+        throw std::runtime_error( "Error when propagating Kepler orbits, number of propagation times (" +
+                                  std::to_string( propagationTimes.rows( ) ) + ") is inconsistent with number of orbits (" +
+                                  std::to_string( numberOfOrbits ) + ")." );
+    }
+
+    // Determine orbit type, and compute final mean anomalies
+    std::vector< int > ellipticIndices, hyperbolicIndices;
+    ArrayType finalMeanAnomalies = ArrayType::Zero( numberOfOrbits );
+    for( int i = 0; i < numberOfOrbits; i++ )
+    {
+        const ScalarType eccentricity = initialStatesInKeplerianElements( i, eccentricityIndex );
+        if ( eccentricity < mathematical_constants::getFloatingInteger< ScalarType >( 0 ) )
+        {
+            throw std::runtime_error( "Eccentricity is invalid (smaller than 0)." );
+        }
+        else if ( eccentricity < mathematical_constants::getFloatingInteger< ScalarType >( 1 ) )
+        {
+            finalMeanAnomalies( i ) =
+                    convertEccentricAnomalyToMeanAnomaly< ScalarType >(
+                        convertTrueAnomalyToEccentricAnomaly< ScalarType >(
+                            initialStatesInKeplerianElements( i, trueAnomalyIndex ), eccentricity ), eccentricity ) +
+                    convertElapsedTimeToEllipticalMeanAnomalyChange< ScalarType >(
+                        propagationTimes( i ), centralBodyGravitationalParameter,
+                        initialStatesInKeplerianElements( i, semiMajorAxisIndex ) );
+            ellipticIndices.push_back( i );
+        }
+        else if ( eccentricity > mathematical_constants::getFloatingInteger< ScalarType >( 1 ) )
+        {
+            finalMeanAnomalies( i ) =
+                    convertHyperbolicEccentricAnomalyToMeanAnomaly< ScalarType >(
+                        convertTrueAnomalyToHyperbolicEccentricAnomaly< ScalarType >(
+                            initialStatesInKeplerianElements( i, trueAnomalyIndex ), eccentricity ), eccentricity ) +
+                    convertElapsedTimeToHyperbolicMeanAnomalyChange< ScalarType >(
+                        propagationTimes( i ), centralBodyGravitationalParameter,
+                        initialStatesInKeplerianElements( i, semiMajorAxisIndex ) );
+            hyperbolicIndices.push_back( i );
+        }
+        else
+        {
+            throw std::runtime_error( "Parabolic orbits are not (yet) supported." );
+        }
+    }
+
+    Eigen::Matrix< ScalarType, Eigen::Dynamic, 6 > finalStatesInKeplerianElements = initialStatesInKeplerianElements;
+
+    // Solve Kepler's equation for all orbits of each type at once, and compute final true anomalies
+    for( int orbitType = 0; orbitType < 2; orbitType++ )
+    {
+        const std::vector< int >& currentIndices = ( orbitType == 0 ) ? ellipticIndices : hyperbolicIndices;
+        const int numberOfCurrentOrbits = currentIndices.size( );
+
+        ArrayType currentEccentricities( numberOfCurrentOrbits ), currentMeanAnomalies( numberOfCurrentOrbits );
+        for( int i = 0; i < numberOfCurrentOrbits; i++ )
+        {
+            currentEccentricities( i ) = initialStatesInKeplerianElements( currentIndices.at( i ), eccentricityIndex );
+            currentMeanAnomalies( i ) = finalMeanAnomalies( currentIndices.at( i ) );
+        }
+
+        ArrayType currentEccentricAnomalies = ( orbitType == 0 ) ?
+                    convertMeanAnomaliesToEccentricAnomalies< ScalarType >(
+                        currentEccentricities, currentMeanAnomalies ) :
+                    convertMeanAnomaliesToHyperbolicEccentricAnomalies< ScalarType >(
+                        currentEccentricities, currentMeanAnomalies );
+
+        for( int i = 0; i < numberOfCurrentOrbits; i++ )
+        {
+            finalStatesInKeplerianElements( currentIndices.at( i ), trueAnomalyIndex ) =
+                    convertEccentricAnomalyToTrueAnomaly< ScalarType >(
+                        currentEccentricAnomalies( i ), currentEccentricities( i ) );
+        }
+    }
+
+    return finalStatesInKeplerianElements;
+}
+
 template< typename ScalarType = double, typename TimeType = double >
 std::map< TimeType, Eigen::Matrix< ScalarType, 6, 1 > > getKeplerOrbitKeplerianStateHistory(
         const Eigen::Matrix< ScalarType, 6, 1 >& initialStateInKeplerianElements,
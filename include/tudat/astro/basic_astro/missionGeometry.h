@@ -23,6 +23,11 @@
 #ifndef TUDAT_MISSION_GEOMETRY_H
 #define TUDAT_MISSION_GEOMETRY_H
 
+#include <functional>
+#include <map>
+#include <utility>
+#include <vector>
+
 #include <Eigen/Core>
 
 #include "tudat/basics/basicTypedefs.h"
@@ -84,6 +89,134 @@ double computeShadowFunction( const Eigen::Vector3d& occultedBodyPosition,
                               const double occultingBodyRadius,
                               const Eigen::Vector3d& satellitePosition );
 
+//! Compute the shadow function for a batch of satellite positions.
+/*!
+ * Returns the values of the shadow function (see computeShadowFunction) for a batch of satellite positions, with the
+ * positions of the occulted and occulting bodies provided at the same epochs, each epoch stored as a column.
+ * \param occultedBodyPositions Cartesian positions of the occulted body (one column per epoch).
+ * \param occultedBodyRadius Mean radius of occulted body.
+ * \param occultingBodyPositions Cartesian positions of the occulting body (one column per epoch).
+ * \param occultingBodyRadius Mean radius of occulting body.
+ * \param satellitePositions Cartesian positions of the satellite (one column per epoch).
+ * \return Shadow function values (one entry per epoch).
+ */
+Eigen::VectorXd computeShadowFunctions( const Eigen::Matrix3Xd& occultedBodyPositions,
+                                        const double occultedBodyRadius,
+                                        const Eigen::Matrix3Xd& occultingBodyPositions,
+                                        const double occultingBodyRadius,
+                                        const Eigen::Matrix3Xd& satellitePositions );
+
+//! Compute the clearance of the line of sight between two points w.r.t. a spherical body.
+/*!
+ * Returns the distance from the center of a spherical (occulting) body to the line segment connecting an observer and a
+ * target, minus the radius of the body. The line of sight is unobstructed if (and only if) the value is positive.
+ * \param observerPosition Cartesian position of the observer.
+ * \param targetPosition Cartesian position of the target.
+ * \param occultingBodyPosition Cartesian position of the center of the occulting body.
+ * \param occultingBodyRadius Radius of the occulting body.
+ * \return Clearance of the line of sight w.r.t. the surface of the occulting body.
+ */
+double computeLineOfSightClearance( const Eigen::Vector3d& observerPosition,
+                                    const Eigen::Vector3d& targetPosition,
+                                    const Eigen::Vector3d& occultingBodyPosition,
+                                    const double occultingBodyRadius );
+
+//! Compute the clearance of the line of sight between two points w.r.t. a spherical body, for a batch of positions.
+/*!
+ * Returns the clearance of the line of sight (see computeLineOfSightClearance) for a batch of observer, target and
+ * occulting body positions (one column per epoch). The computation is performed with array operations over all epochs.
+ * \param observerPositions Cartesian positions of the observer (one column per epoch).
+ * \param targetPositions Cartesian positions of the target (one column per epoch).
+ * \param occultingBodyPositions Cartesian positions of the center of the occulting body (one column per epoch).
+ * \param occultingBodyRadius Radius of the occulting body.
+ * \return Clearance of the line of sight w.r.t. the surface of the occulting body (one entry per epoch).
+ */
+Eigen::VectorXd computeLineOfSightClearances( const Eigen::Matrix3Xd& observerPositions,
+                                              const Eigen::Matrix3Xd& targetPositions,
+                                              const Eigen::Matrix3Xd& occultingBodyPositions,
+                                              const double occultingBodyRadius );
+
+//! Extract the time windows during which an event is active, from its evaluation on a (coarse) grid of epochs.
+/*!
+ * Extract the time windows during which an event (e.g. eclipse or visibility) is active, from its evaluation on a grid of
+ * epochs. Each change of the event state between two consecutive grid epochs is refined by bisection using the
+ * isEventActiveFunction, until the bracketing interval is smaller than the time tolerance. Windows that are active at the
+ * first (last) grid epoch start (end) at that epoch. Note that events that start and end in between two grid epochs are
+ * not detected.
+ * \param epochs Grid of epochs, in ascending order.
+ * \param isEventActive Whether the event is active at each of the grid epochs.
+ * \param isEventActiveFunction Function returning whether the event is active at a given epoch (if empty, no refinement is
+ * performed, and the entry (exit) epoch is taken as the first (last) grid epoch at which the event is active).
+ * \param timeTolerance Tolerance on the entry and exit epochs of the windows.
+ * \return List of windows (entry and exit epochs) during which the event is active.
+ */
+std::vector< std::pair< double, double > > extractEventWindows(
+        const std::vector< double >& epochs,
+        const std::vector< bool >& isEventActive,
+        const std::function< bool( const double ) > isEventActiveFunction,
+        const double timeTolerance );
+
+//! Interpolate the position from a Cartesian state history, using cubic Hermite interpolation.
+/*!
+ * Interpolate the position from a Cartesian state history, using cubic Hermite interpolation of the positions and
+ * velocities (first six entries of each state) at the two history epochs bracketing the requested epoch.
+ * \param stateHistory Cartesian state history (at least two epochs)
+ * \param epoch Epoch at which the position is to be interpolated (clamped to the history's time interval).
+ * \return Interpolated Cartesian position.
+ */
+Eigen::Vector3d interpolatePositionFromStateHistory(
+        const std::map< double, Eigen::VectorXd >& stateHistory,
+        const double epoch );
+
+//! Compute the eclipse windows of a satellite, from its (propagated) state history.
+/*!
+ * Compute the windows during which a satellite is (partially) eclipsed, from its Cartesian state history (e.g. the result
+ * of a propagation), without re-propagating. The shadow function is evaluated at the epochs of the state history, and the
+ * entry and exit epochs are refined using the state history (see interpolatePositionFromStateHistory) and
+ * extractEventWindows.
+ * \param satelliteStateHistory Cartesian state history of the satellite.
+ * \param occultedBodyPositionFunction Function returning the position of the occulted body (e.g. the Sun) as a function of
+ * time, in the same frame as the satellite state history.
+ * \param occultedBodyRadius Mean radius of occulted body.
+ * \param occultingBodyPositionFunction Function returning the position of the occulting body as a function of time, in
+ * the same frame as the satellite state history.
+ * \param occultingBodyRadius Mean radius of occulting body.
+ * \param shadowFunctionThreshold Value of the shadow function below which the satellite is considered to be eclipsed
+ * (default 1, so that penumbra is included; use a small value to obtain the umbra windows).
+ * \param timeTolerance Tolerance on the entry and exit epochs of the windows.
+ * \return List of eclipse windows (entry and exit epochs).
+ */
+std::vector< std::pair< double, double > > computeEclipseWindows(
+        const std::map< double, Eigen::VectorXd >& satelliteStateHistory,
+        const std::function< Eigen::Vector3d( const double ) > occultedBodyPositionFunction,
+        const double occultedBodyRadius,
+        const std::function< Eigen::Vector3d( const double ) > occultingBodyPositionFunction,
+        const double occultingBodyRadius,
+        const double shadowFunctionThreshold = 1.0,
+        const double timeTolerance = 1.0E-3 );
+
+//! Compute the windows during which a target is visible from a satellite, from the satellite's state history.
+/*!
+ * Compute the windows during which the line of sight from a satellite to a target is not obstructed by a spherical body,
+ * from the satellite's Cartesian state history (e.g. the result of a propagation), without re-propagating. The line of
+ * sight clearance is evaluated at the epochs of the state history, and the entry and exit epochs are refined using the
+ * state history (see interpolatePositionFromStateHistory) and extractEventWindows.
+ * \param satelliteStateHistory Cartesian state history of the satellite.
+ * \param targetPositionFunction Function returning the position of the target as a function of time, in the same frame
+ * as the satellite state history.
+ * \param occultingBodyPositionFunction Function returning the position of the occulting body as a function of time, in
+ * the same frame as the satellite state history.
+ * \param occultingBodyRadius Radius of occulting body.
+ * \param timeTolerance Tolerance on the entry and exit epochs of the windows.
+ * \return List of visibility windows (entry and exit epochs).
+ */
+std::vector< std::pair< double, double > > computeVisibilityWindows(
+        const std::map< double, Eigen::VectorXd >& satelliteStateHistory,
+        const std::function< Eigen::Vector3d( const double ) > targetPositionFunction,
+        const std::function< Eigen::Vector3d( const double ) > occultingBodyPositionFunction,
+        const double occultingBodyRadius,
+        const double timeTolerance = 1.0E-3 );
+
 //! Compute the radius of the sphere of influence.
 /*!
  * Returns the radius of the the Sphere of Influence (SOI) for a body orbiting a central body.
@@ -20,6 +20,8 @@
 #include "tudat/astro/basic_astro/bodyShapeModel.h"
 #include "tudat/astro/basic_astro/polyhedronFuntions.h"
 #include "tudat/math/basic/polyhedron.h"
+#include "tudat/math/basic/kdTree.h"
+#include <atomic>
 #include <iostream>
 
 namespace tudat
@@ -53,15 +55,23 @@ public:
         verticesDefiningEachFacet_( verticesDefiningEachFacet ),
         computeAltitudeWithSign_( computeAltitudeWithSign ),
         justComputeDistanceToVertices_( justComputeDistanceToVertices ),
-        averageRadius_( TUDAT_NAN )
+        averageRadius_( TUDAT_NAN ),
+        previousClosestVertex_( -1 )
     {
         // Check if provided settings are valid
         basic_mathematics::checkValidityOfPolyhedronSettings( verticesCoordinates, verticesDefiningEachFacet );
 
-        // If necessary, get list with vertices defining each edge
+        // Create spatial index of vertices, for retrieval of closest vertex
+        verticesTree_ = std::make_shared< basic_mathematics::KdTree< 3 > >( verticesCoordinates_ );
+
+        // Radius of sphere enclosing the polyhedron, outside of which the altitude sign need not be computed
+        boundingSphereRadius_ = verticesCoordinates_.rowwise( ).norm( ).maxCoeff( );
+
+        // If necessary, get list with vertices defining each edge, and the edges and facets adjacent to each vertex
         if ( !justComputeDistanceToVertices_ )
         {
             computeVerticesDefiningEachEdge();
+            computeFeaturesAdjacentToEachVertex( );
         }
     }
 
@@ -73,6 +83,11 @@ public:
      *  Function to calculate the altitude above the polyhedron from a body fixed position.
      *  Function computes the minimum distance to each of the polyhedron features (vertices, edges and facets); the
      *  distance is only computed wrt to the edges and facets around the closest vertex. See Avillez (2022).
+     *  The closest vertex is found from a k-d tree of the vertices, with the search started from the vertex closest to
+     *  the previous field point (improved by moving along the polyhedron edges), so that consecutive, nearby, queries
+     *  only visit a small part of the tree. The edges and facets around the closest vertex are retrieved from lists
+     *  precomputed at construction. The sign of the altitude (if requested) is only computed from the polyhedron
+     *  Laplacian if the field point lies within a sphere enclosing the polyhedron.
      *  \param bodyFixedPosition Cartesian, body-fixed position of the point at which the altitude
      *  is to be determined.
      *  \return Altitude above the polyhedron.
@@ -130,6 +145,18 @@ private:
     double computeDistanceToClosestVertex( const Eigen::Vector3d& bodyFixedPosition,
                                            unsigned int& closestVertexId);
 
+    /*! Finds a vertex close to the field point, starting from the vertex closest to the previous field point.
+     *
+     * Finds a vertex close to the field point by moving along the polyhedron edges (if these are computed), starting
+     * from the vertex closest to the previous field point, for as long as this reduces the distance to the field point.
+     * The resulting vertex is
+     * used as initial guess for the k-d tree search.
+     * @param bodyFixedPosition Cartesian, body-fixed position of the point at which the altitude
+     *  is to be determined.
+     * @return Index of the vertex (-1 if no previous field point was evaluated).
+     */
+    int findVertexCloseToPreviousClosestVertex( const Eigen::Vector3d& bodyFixedPosition );
+
     /*! Computes the distance to the facet closest to the field point.
      *
      * Computes the distance to the facet closest to the field point, according to Avillez (2022). The distance is
@@ -137,11 +164,11 @@ private:
      * function returns NAN. The returned distance is unsigned.
      * @param bodyFixedPosition Cartesian, body-fixed position of the point at which the altitude
      *  is to be determined.
-     * @param verticesDefiningEachFacetToEvaluate Facets wrt which the distance is to be computed.
+     * @param facetsToEvaluate Indices of facets wrt which the distance is to be computed.
      * @return Distance to closest facet.
      */
     double computeDistanceToClosestFacet ( const Eigen::Vector3d& bodyFixedPosition,
-                                           const Eigen::MatrixXi& verticesDefiningEachFacetToEvaluate );
+                                           const std::vector< unsigned int >& facetsToEvaluate );
 
     /*! Computes the distance to the edge closest to the field point.
      *
@@ -150,18 +177,26 @@ private:
      * function returns NAN. The returned distance is unsigned.
      * @param bodyFixedPosition Cartesian, body-fixed position of the point at which the altitude
      *  is to be determined.
-     * @param verticesDefiningEachEdgeToEvaluate Edges wrt which the distance is to be computed.
+     * @param edgesToEvaluate Indices of edges wrt which the distance is to be computed.
      * @return Distance to closest edge.
      */
     double computeDistanceToClosestEdge ( const Eigen::Vector3d& bodyFixedPosition,
-                                          const Eigen::MatrixXi& verticesDefiningEachEdgeToEvaluate );
+                                          const std::vector< unsigned int >& edgesToEvaluate );
 
     /*! Computes the matrix with the indices of the vertices defining each edge.
      *
-     * Computes the matrix with the indices of the vertices defining each edge; saves the list to verticesDefiningEachEdge_.
+     * Computes the matrix with the indices of the vertices defining each edge (see getPolyhedronPreprocessedData); saves
+     * the list to verticesDefiningEachEdge_.
      */
     void computeVerticesDefiningEachEdge( );
 
+    /*! Computes the lists of edges and facets adjacent to each vertex.
+     *
+     * Computes the lists of edges and facets adjacent to each vertex, saved to edgesAdjacentToEachVertex_ and
+     * facetsAdjacentToEachVertex_.
+     */
+    void computeFeaturesAdjacentToEachVertex( );
+
 
     // Matrix with coordinates of the polyhedron vertices.
     Eigen::MatrixXd verticesCoordinates_;
@@ -172,6 +207,15 @@ private:
     // Matrix with the indices (0 indexed) of the vertices defining each edge.
     Eigen::MatrixXi verticesDefiningEachEdge_;
 
+    // Indices of the edges that contain each vertex.
+    std::vector< std::vector< unsigned int > > edgesAdjacentToEachVertex_;
+
+    // Indices of the facets that contain each vertex.
+    std::vector< std::vector< unsigned int > > facetsAdjacentToEachVertex_;
+
+    // K-d tree of the polyhedron vertices, used to find the vertex closest to the field point.
+    std::shared_ptr< basic_mathematics::KdTree< 3 > > verticesTree_;
+
     // Flag indicating whether the altitude should be computed with sign (i.e. >0 if above surface, <0 otherwise) or
     // having always a positive value
     bool computeAltitudeWithSign_;
@@ -183,6 +227,12 @@ private:
     // Average radius of the polyhedron
     double averageRadius_;
 
+    // Radius of the sphere, centered at the origin, enclosing all vertices of the polyhedron
+    double boundingSphereRadius_;
+
+    // Vertex closest to the previous field point (atomic, so that the altitude may be computed concurrently)
+    std::atomic< int > previousClosestVertex_;
+
 };
 
 } // namespace basic_astrodynamics
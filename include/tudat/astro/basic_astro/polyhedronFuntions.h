@@ -116,6 +116,41 @@ Eigen::Matrix3d computePolyhedronInertiaTensor (const Eigen::MatrixXd& verticesC
                                                 const double gravitationalParameter,
                                                 const double gravitationalConstant );
 
+/*! Computes the radius of the Brillouin sphere of a polyhedron.
+ *
+ * Computes the radius of the Brillouin sphere of a polyhedron, i.e. the smallest sphere centered at the origin of the
+ * frame in which the vertices are defined that encloses the polyhedron (equal to the maximum distance of the vertices
+ * to the origin). A spherical harmonic expansion of the gravity field of the polyhedron converges outside this sphere.
+ *
+ * @param verticesCoordinates Cartesian coordinates of each vertex (one row per vertex, 3 columns).
+ * @return Radius of Brillouin sphere.
+ */
+double computePolyhedronBrillouinSphereRadius( const Eigen::MatrixXd& verticesCoordinates );
+
+/*! Computes the spherical harmonic coefficients of the gravity field of a constant-density polyhedron.
+ *
+ * Computes the geodesy-normalized spherical harmonic coefficients of the gravity field of a constant-density
+ * polyhedron, expanded about the origin of the frame in which the vertices are defined. The polyhedron is decomposed
+ * into (signed) tetrahedra, each formed by the origin and one facet, and the integrals of the solid spherical harmonics
+ * over each tetrahedron are computed with a collapsed (Duffy) Gauss-Legendre quadrature rule, which is exact for the
+ * polynomial integrands up to the requested degree. The coefficients are independent of the density (i.e. C_00 = 1).
+ *
+ * @param verticesCoordinates Cartesian coordinates of each vertex (one row per vertex, 3 columns).
+ * @param verticesDefiningEachFacet Index (0 based) of the vertices constituting each facet (one row per facet, 3 columns).
+ * @param maximumDegree Maximum degree (and order) of the expansion.
+ * @param referenceRadius Reference radius of the expansion.
+ * @param cosineCoefficients Cosine coefficients (geodesy-normalized), with degree as row and order as column index
+ * (returned by reference).
+ * @param sineCoefficients Sine coefficients (geodesy-normalized), with degree as row and order as column index (returned
+ * by reference).
+ */
+void computePolyhedronSphericalHarmonicCoefficients( const Eigen::MatrixXd& verticesCoordinates,
+                                                     const Eigen::MatrixXi& verticesDefiningEachFacet,
+                                                     const int maximumDegree,
+                                                     const double referenceRadius,
+                                                     Eigen::MatrixXd& cosineCoefficients,
+                                                     Eigen::MatrixXd& sineCoefficients );
+
 } // namespace basic_astrodynamics
 } // namespace tudat
 
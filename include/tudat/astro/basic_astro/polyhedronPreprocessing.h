@@ -0,0 +1,145 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References:
+ *       "EXTERIOR GRAVITATION OF A POLYHEDRON DERIVED AND COMPARED WITH HARMONIC AND MASCON GRAVITATION REPRESENTATIONS
+ *          OF ASTEROID 4769 CASTALIA", Werner and Scheeres (1997), Celestial Mechanics and Dynamical Astronomy
+ */
+
+#ifndef TUDAT_POLYHEDRON_PREPROCESSING_H
+#define TUDAT_POLYHEDRON_PREPROCESSING_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace basic_astrodynamics
+{
+
+//! Quantities derived from the vertices and facets of a polyhedron, used by the polyhedron gravity field and shape model.
+/*!
+ *  Quantities derived from the vertices and facets of a polyhedron (edge topology, facet normals, facet and edge dyads),
+ *  according to Werner and Scheeres (1997). Objects of this type are shared (read-only) between all gravity field and
+ *  shape models that are created for the same polyhedron (see getPolyhedronPreprocessedData).
+ */
+struct PolyhedronPreprocessedData
+{
+    //! Cartesian coordinates of each vertex (one row per vertex, 3 columns).
+    Eigen::MatrixXd verticesCoordinates;
+
+    //! Index (0 based) of the vertices constituting each facet (one row per facet, 3 columns).
+    Eigen::MatrixXi verticesDefiningEachFacet;
+
+    //! Index (0 based) of the vertices constituting each edge (one row per edge, 2 columns).
+    Eigen::MatrixXi verticesDefiningEachEdge;
+
+    //! Index (0 based) of the facets defining each edge (one row per edge, 2 columns).
+    Eigen::MatrixXi facetsDefiningEachEdge;
+
+    //! Vector with the outward-pointing normal vector of each facet.
+    std::vector< Eigen::Vector3d > facetNormalVectors;
+
+    //! Vector with the facet dyad of each facet.
+    std::vector< Eigen::MatrixXd > facetDyads;
+
+    //! Vector with the edge dyad of each edge.
+    std::vector< Eigen::MatrixXd > edgeDyads;
+};
+
+/*! Function to compute a hash of the vertices and facets of a polyhedron.
+ *
+ * Function to compute a (64-bit FNV-1a) hash of the vertices and facets of a polyhedron, used to identify the
+ * preprocessed data of the polyhedron in the in-memory and on-disk caches.
+ * @param verticesCoordinates Cartesian coordinates of each vertex (one row per vertex, 3 columns).
+ * @param verticesDefiningEachFacet Index (0 based) of the vertices constituting each facet (one row per facet, 3 columns).
+ * @return Hash of the polyhedron.
+ */
+uint64_t computePolyhedronHash( const Eigen::MatrixXd& verticesCoordinates,
+                                const Eigen::MatrixXi& verticesDefiningEachFacet );
+
+/*! Function to compute the preprocessed data of a polyhedron.
+ *
+ * Function to compute the preprocessed data of a polyhedron: the vertices and facets defining each edge, and the facet
+ * normals, facet dyads and edge dyads, according to Werner and Scheeres (1997). The edges are stored in order of first
+ * occurrence in the list of facets.
+ * @param verticesCoordinates Cartesian coordinates of each vertex (one row per vertex, 3 columns).
+ * @param verticesDefiningEachFacet Index (0 based) of the vertices constituting each facet (one row per facet, 3 columns).
+ * @return Preprocessed data of the polyhedron.
+ */
+std::shared_ptr< PolyhedronPreprocessedData > computePolyhedronPreprocessedData(
+        const Eigen::MatrixXd& verticesCoordinates,
+        const Eigen::MatrixXi& verticesDefiningEachFacet );
+
+/*! Function to write the preprocessed data of a polyhedron to a binary file.
+ *
+ * Function to write the preprocessed data of a polyhedron to a binary file. The file starts with an 8-byte identifier
+ * ("TUDATPLY"), followed by the format version and a byte order mark (32-bit unsigned integers), the hash of the
+ * polyhedron (see computePolyhedronHash) and the number of vertices, facets and edges (64-bit unsigned integers). This
+ * is followed by the vertices, facets, vertices and facets defining each edge, facet normals, and facet and edge dyads,
+ * each stored contiguously in column-major order, in the byte order of the platform.
+ * @param fileName Name (including path) of the file that is to be written.
+ * @param preprocessedData Preprocessed data of the polyhedron that is to be written.
+ */
+void writePolyhedronPreprocessedDataToBinaryFile(
+        const std::string& fileName,
+        const PolyhedronPreprocessedData& preprocessedData );
+
+/*! Function to read the preprocessed data of a polyhedron from a binary file.
+ *
+ * Function to read the preprocessed data of a polyhedron from a binary file written by
+ * writePolyhedronPreprocessedDataToBinaryFile. The file is mapped into memory, and its contents are only used if the
+ * vertices and facets stored in it are identical to those provided as input.
+ * @param fileName Name (including path) of the file that is to be read.
+ * @param verticesCoordinates Cartesian coordinates of each vertex (one row per vertex, 3 columns).
+ * @param verticesDefiningEachFacet Index (0 based) of the vertices constituting each facet (one row per facet, 3 columns).
+ * @return Preprocessed data of the polyhedron, or nullptr if the file does not exist, is not a valid file, or was
+ * written for a different polyhedron.
+ */
+std::shared_ptr< PolyhedronPreprocessedData > readPolyhedronPreprocessedDataFromBinaryFile(
+        const std::string& fileName,
+        const Eigen::MatrixXd& verticesCoordinates,
+        const Eigen::MatrixXi& verticesDefiningEachFacet );
+
+/*! Function to set the directory in which preprocessed polyhedron data is cached on disk.
+ *
+ * Function to set the directory in which preprocessed polyhedron data is cached on disk (see
+ * getPolyhedronPreprocessedData). By default (empty directory), no data is cached on disk.
+ * @param cacheDirectory Directory in which the preprocessed polyhedron data is to be cached (created if it does not
+ * exist), or empty to disable the on-disk cache.
+ */
+void setPolyhedronPreprocessedDataCacheDirectory( const std::string& cacheDirectory );
+
+//! Function to retrieve the directory in which preprocessed polyhedron data is cached on disk (empty if disabled).
+std::string getPolyhedronPreprocessedDataCacheDirectory( );
+
+/*! Function to retrieve the preprocessed data of a polyhedron, reusing previously computed data where possible.
+ *
+ * Function to retrieve the preprocessed data of a polyhedron. The data is shared by all callers for the same
+ * polyhedron while it is in use. If it is not in use, it is read from the on-disk cache, if enabled (see
+ * setPolyhedronPreprocessedDataCacheDirectory) and available, or computed otherwise (and then written to the on-disk
+ * cache, if enabled). The cached data is identified by the hash of the vertices and facets (see computePolyhedronHash).
+ * @param verticesCoordinates Cartesian coordinates of each vertex (one row per vertex, 3 columns).
+ * @param verticesDefiningEachFacet Index (0 based) of the vertices constituting each facet (one row per facet, 3 columns).
+ * @return Preprocessed data of the polyhedron.
+ */
+std::shared_ptr< const PolyhedronPreprocessedData > getPolyhedronPreprocessedData(
+        const Eigen::MatrixXd& verticesCoordinates,
+        const Eigen::MatrixXi& verticesDefiningEachFacet );
+
+} // namespace basic_astrodynamics
+
+} // namespace tudat
+
+#endif // TUDAT_POLYHEDRON_PREPROCESSING_H
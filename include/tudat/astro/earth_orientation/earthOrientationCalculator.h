@@ -297,7 +297,7 @@ private:
  * \return Default Earth rotation parameter object.
  */
 std::shared_ptr< EarthOrientationAnglesCalculator > createStandardEarthOrientationCalculator(
-        const std::shared_ptr< EOPReader > eopReader = std::make_shared< EOPReader >( ) );
+        const std::shared_ptr< EOPReader > eopReader = loadEOPReader( ) );
 
 //! Function to create an interpolator for the Earth orientation angles and UT1
 /*!
@@ -12,8 +12,11 @@
 #ifndef TUDAT_EOPREADER_H
 #define TUDAT_EOPREADER_H
 
+#include <limits>
 #include <map>
+#include <memory>
 #include <string>
+#include <vector>
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/trim.hpp>
 #include <Eigen/Core>
@@ -24,6 +27,7 @@
 #include "tudat/io/basicInputOutput.h"
 
 #include "tudat/astro/basic_astro/timeConversions.h"
+#include "tudat/basics/basicTypedefs.h"
 #include "tudat/basics/utilities.h"
 #include "tudat/interface/sofa/earthOrientation.h"
 #include "tudat/paths.hpp"
@@ -36,6 +40,13 @@ namespace earth_orientation
 {
 
 //! Class used to read Earth Orientation Parameters (EOP) from file
+/*!
+ *  Class used to read Earth Orientation Parameters (EOP) from file. The file is mapped into memory and parsed without
+ *  intermediate copies, and may be restricted to a time window, in which case the start of the window is located in
+ *  the file by bisection, without parsing the preceding data. The data is stored in contiguous arrays, with one entry
+ *  per day. Objects of this class are not modified after construction, and may be shared by any number of users (see
+ *  loadEOPReader).
+ */
 class EOPReader
 {
 public:
@@ -46,25 +57,30 @@ public:
      * \param eopFile Name of EOP file that is to be used
      * \param format Identifier for file format that is provied
      * \param nutationTheory Nutation theory w.r.t. which the EOP data is given.
+     * \param startTime Start of the time window for which data is to be read (UTC seconds since J2000); data starting
+     * EOP_READER_WINDOW_MARGIN days before this time is read.
+     * \param endTime End of the time window for which data is to be read (UTC seconds since J2000); data up to
+     * EOP_READER_WINDOW_MARGIN days after this time is read.
      */
     EOPReader(
             const std::string& eopFile = tudat::paths::getEarthOrientationDataFilesPath( ) + "/eopc04_14_IAU2000.62-now.txt",
             const std::string& format = "C04",
-            const basic_astrodynamics::IAUConventions nutationTheory = basic_astrodynamics::iau_2006 );
+            const basic_astrodynamics::IAUConventions nutationTheory = basic_astrodynamics::iau_2006,
+            const double startTime = -std::numeric_limits< double >::infinity( ),
+            const double endTime = std::numeric_limits< double >::infinity( ) );
 
     //! Function to retrieve the data of UT1-UTC, as provided in the EOP file.
     std::map< double, double > getUt1MinusUtcMapRaw( )
     {
-        return ut1MinusUtc;
+        return createDataMap< double >( ut1MinusUtcIndex, 1.0, 0.0 );
     }
 
     //! Function to retrieve the data of UT1-UTC, with map key seconds since J2000
     std::map< double, double > getUt1MinusUtcMapInSecondsSinceJ2000( )
     {
-        return utilities::linearlyScaleKeyOfMap< double, double >
-                ( ut1MinusUtc,
-                  basic_astrodynamics::JULIAN_DAY_ON_J2000 - basic_astrodynamics::JULIAN_DAY_AT_0_MJD,
-                  physical_constants::JULIAN_DAY );
+        return createDataMap< double >(
+                    ut1MinusUtcIndex, physical_constants::JULIAN_DAY,
+                    basic_astrodynamics::JULIAN_DAY_ON_J2000 - basic_astrodynamics::JULIAN_DAY_AT_0_MJD );
 
     }
 
@@ -75,7 +91,7 @@ public:
      */
     std::map< double, double > getLengthOfDayMapRaw( )
     {
-        return lengthOfDayOffset;
+        return createDataMap< double >( lengthOfDayIndex, 1.0, 0.0 );
     }
 
     //! Function to retrieve the data of LOD offset, with map key seconds since J2000
@@ -85,10 +101,9 @@ public:
      */
     std::map< double, double > getLengthOfDayMapInSecondsSinceJ2000( )
     {
-        return utilities::linearlyScaleKeyOfMap< double, double >
-                ( lengthOfDayOffset,
-                  basic_astrodynamics::JULIAN_DAY_ON_J2000 - basic_astrodynamics::JULIAN_DAY_AT_0_MJD,
-                  physical_constants::JULIAN_DAY );
+        return createDataMap< double >(
+                    lengthOfDayIndex, physical_constants::JULIAN_DAY,
+                    basic_astrodynamics::JULIAN_DAY_ON_J2000 - basic_astrodynamics::JULIAN_DAY_AT_0_MJD );
 
     }
 
@@ -99,7 +114,7 @@ public:
     */
     std::map< double, Eigen::Vector2d > getCipInItrsMapRaw( )
     {
-        return cipInItrs;
+        return createDataMap< Eigen::Vector2d >( cipInItrsIndex, 1.0, 0.0 );
     }
 
     //! Function to retrieve the data of CIP in ITRS correction (polar motion), with map key seconds since J2000
@@ -109,10 +124,9 @@ public:
     */
     std::map< double, Eigen::Vector2d > getCipInItrsMapInSecondsSinceJ2000( )
     {
-        return utilities::linearlyScaleKeyOfMap< double, Eigen::Vector2d >
-                ( cipInItrs,
-                  basic_astrodynamics::JULIAN_DAY_ON_J2000 - basic_astrodynamics::JULIAN_DAY_AT_0_MJD,
-                  physical_constants::JULIAN_DAY );
+        return createDataMap< Eigen::Vector2d >(
+                    cipInItrsIndex, physical_constants::JULIAN_DAY,
+                    basic_astrodynamics::JULIAN_DAY_ON_J2000 - basic_astrodynamics::JULIAN_DAY_AT_0_MJD );
 
     }
 
@@ -123,7 +137,7 @@ public:
     */
     std::map< double, Eigen::Vector2d > getCipInGcrsCorrectionMapRaw( )
     {
-        return cipInGcrsCorrection;
+        return createDataMap< Eigen::Vector2d >( cipInGcrsCorrectionIndex, 1.0, 0.0 );
     }
 
     //! Function to retrieve the data of CIP in GCRS correction (nutation), with map key seconds since J2000
@@ -133,36 +147,140 @@ public:
     */
     std::map< double, Eigen::Vector2d > getCipInGcrsCorrectionMapInSecondsSinceJ2000( )
     {
-        return utilities::linearlyScaleKeyOfMap< double, Eigen::Vector2d >
-                ( cipInGcrsCorrection,
-                  basic_astrodynamics::JULIAN_DAY_ON_J2000 - basic_astrodynamics::JULIAN_DAY_AT_0_MJD,
-                  physical_constants::JULIAN_DAY );
+        return createDataMap< Eigen::Vector2d >(
+                    cipInGcrsCorrectionIndex, physical_constants::JULIAN_DAY,
+                    basic_astrodynamics::JULIAN_DAY_ON_J2000 - basic_astrodynamics::JULIAN_DAY_AT_0_MJD );
+
+    }
+
+    //! Function to retrieve the number of days for which data has been read
+    int getNumberOfDays( ) const
+    {
+        return static_cast< int >( modifiedJulianDays_.size( ) );
+    }
+
+    //! Function to retrieve the modified Julian days for which data has been read
+    const std::vector< double >& getModifiedJulianDays( ) const
+    {
+        return modifiedJulianDays_;
+    }
+
+    //! Function to retrieve the index of the last day at or before a given modified Julian day
+    /*!
+    *  Function to retrieve the index of the last day at or before a given modified Julian day (limited to the range of the
+    *  data). For data with one entry per consecutive day (as in the C04 files), the index is computed in O(1) time.
+    *  \param modifiedJulianDay Modified Julian day for which the index is to be retrieved
+    *  \return Index of the last day at or before the given modified Julian day
+    */
+    int getDayIndex( const double modifiedJulianDay ) const;
 
+    //! Function to retrieve all EOP data of the day with the given index
+    /*!
+    *  Function to retrieve all EOP data of the day with the given index, as (x_p, y_p, UT1-UTC, LOD, dX, dY), with
+    *  angles in radians and times in seconds.
+    *  \param dayIndex Index of the day (see getDayIndex)
+    *  \return EOP data of the day
+    */
+    Eigen::Vector6d getEopDataOfDay( const int dayIndex ) const
+    {
+        return Eigen::Map< const Eigen::Vector6d >( eopData_.data( ) + 6 * dayIndex );
     }
 
 private:
 
+    //! Index of x_p and y_p (CIP in ITRS) in the data of a single day
+    static const int cipInItrsIndex = 0;
+
+    //! Index of UT1-UTC in the data of a single day
+    static const int ut1MinusUtcIndex = 2;
+
+    //! Index of LOD in the data of a single day
+    static const int lengthOfDayIndex = 3;
+
+    //! Index of dX and dY (CIP in GCRS correction) in the data of a single day
+    static const int cipInGcrsCorrectionIndex = 4;
+
     //! Function to read EOP file
     /*!
      * Function to read EOP file
      * \param fileName EOP file name.
+     * \param startModifiedJulianDay First modified Julian day for which data is to be read.
+     * \param endModifiedJulianDay Last modified Julian day for which data is to be read.
+     */
+    void readEopFile( const std::string& fileName,
+                      const double startModifiedJulianDay,
+                      const double endModifiedJulianDay );
+
+    //! Function to create a map of one of the EOP quantities, with linearly scaled modified Julian day as key
+    /*!
+     * Function to create a map of one of the EOP quantities, with key ( MJD - keyOffset ) * keyScale
+     * \param dataIndex Index of the (first entry of the) quantity in the data of a single day
+     * \param keyScale Scale factor of the key
+     * \param keyOffset Offset of the key
+     * \return Map of the EOP quantity
      */
-    void readEopFile( const std::string& fileName );
+    template< typename ValueType >
+    std::map< double, ValueType > createDataMap( const int dataIndex, const double keyScale, const double keyOffset ) const
+    {
+        std::map< double, ValueType > dataMap;
+        for( unsigned int i = 0; i < modifiedJulianDays_.size( ); i++ )
+        {
+            ValueType value;
+            extractValue( eopData_.data( ) + 6 * i + dataIndex, value );
+            dataMap.emplace_hint( dataMap.end( ), keyScale * ( modifiedJulianDays_.at( i ) - keyOffset ), value );
+        }
+        return dataMap;
+    }
 
-    //! Terrestrial pole position corrections (CIP in ITRS; polar motion), read from file
-    std::map< double, Eigen::Vector2d > cipInItrs;
+    //! Function to extract a scalar EOP quantity from the data of a single day
+    static void extractValue( const double* data, double& value )
+    {
+        value = data[ 0 ];
+    }
+
+    //! Function to extract a two-dimensional EOP quantity from the data of a single day
+    static void extractValue( const double* data, Eigen::Vector2d& value )
+    {
+        value << data[ 0 ], data[ 1 ];
+    }
 
-    //! Celestial pole position corrections (CIP in GCRS; nutation), read from file
-    std::map< double, Eigen::Vector2d > cipInGcrsCorrection;
+    //! Modified Julian days for which data has been read (in increasing order)
+    std::vector< double > modifiedJulianDays_;
 
-    //! Corrections to UT1 - UTC, read from file
-    std::map< double, double > ut1MinusUtc;
+    //! EOP data for each day, as (x_p, y_p, UT1-UTC, LOD, dX, dY), stored consecutively per day
+    std::vector< double > eopData_;
 
-    //! Corrections to LOD, read from file
-    std::map< double, double > lengthOfDayOffset;
+    //! Boolean denoting whether the data consists of consecutive days (allowing O(1) retrieval of the index of a day)
+    bool areDaysConsecutive_;
 
 };
 
+//! Margin (in days) around the time window of an EOPReader for which data is read, to allow interpolation in the window
+static const int EOP_READER_WINDOW_MARGIN = 5;
+
+//! Function to load the EOP data of a file, sharing a single copy of the data of each file within the process
+/*!
+ * Function to load the EOP data of a file, sharing a single copy of the data of each file within the process. The file
+ * is parsed on the first call for a given file, and the result is retained for the lifetime of the process (or until
+ * clearEOPReaderCache is called), so that subsequent calls (for instance when creating many Earth rotation models and
+ * time scale converters) do not read the file again. The file is parsed again if its size or modification time has
+ * changed. This function may be called from multiple threads concurrently.
+ * \param eopFile Name of EOP file that is to be used
+ * \param format Identifier for file format that is provied
+ * \param nutationTheory Nutation theory w.r.t. which the EOP data is given.
+ * \return Reader containing the EOP data of the complete file
+ */
+std::shared_ptr< EOPReader > loadEOPReader(
+        const std::string& eopFile = tudat::paths::getEarthOrientationDataFilesPath( ) + "/eopc04_14_IAU2000.62-now.txt",
+        const std::string& format = "C04",
+        const basic_astrodynamics::IAUConventions nutationTheory = basic_astrodynamics::iau_2006 );
+
+//! Function to clear the cache of EOP data used by loadEOPReader
+/*!
+ * Function to clear the cache of EOP data used by loadEOPReader. Existing users of the data are not affected.
+ */
+void clearEOPReaderCache( );
+
 }
 
 }
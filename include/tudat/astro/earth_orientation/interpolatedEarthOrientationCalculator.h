@@ -0,0 +1,165 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_INTERPOLATEDEARTHORIENTATIONCALCULATOR_H
+#define TUDAT_INTERPOLATEDEARTHORIENTATIONCALCULATOR_H
+
+#include <memory>
+#include <vector>
+
+#include "tudat/astro/earth_orientation/earthOrientationCalculator.h"
+
+namespace tudat
+{
+
+namespace earth_orientation
+{
+
+//! Class to calculate earth orientation angles by interpolating pre-tabulated values
+/*!
+ *  Class to calculate earth orientation angles (X, Y, s, x_p, y_p) and UT1 by interpolating values that are tabulated
+ *  once (at construction) from an EarthOrientationAnglesCalculator, over a given time interval. This prevents the full
+ *  IAU precession-nutation series, the short-period polar motion and UT1 corrections, and the time scale conversions
+ *  from being evaluated at each rotation query. Instead of UT1 itself, the (smooth) difference between UT1 and the input
+ *  time is tabulated. The values are tabulated at a constant time step, which is halved until the interpolated values
+ *  reproduce the directly computed ones (at the midpoints between the tabulation points) to within the requested angular
+ *  accuracy (for UT1, the difference is converted to an Earth rotation angle). The interpolation is done using Lagrange
+ *  polynomials on the equidistant grid, which requires no memory allocation. As the class is not modified after
+ *  construction, it may be used from multiple threads concurrently. Outside of the tabulated interval, the angles are
+ *  computed directly from the EarthOrientationAnglesCalculator.
+ */
+class InterpolatedEarthOrientationAnglesCalculator
+{
+public:
+
+    //! Constructor, tabulates the earth orientation angles
+    /*!
+     *  Constructor, tabulates the earth orientation angles
+     *  \param anglesCalculator Object from which the earth orientation angles are computed directly
+     *  \param inputTimeScale Time scale in which the input time to this class is provided
+     *  \param startTime Start time of the interval on which the angles are tabulated
+     *  \param endTime End time of the interval on which the angles are tabulated
+     *  \param angularAccuracy Maximum permitted error of the interpolated angles (in radians)
+     *  \param numberOfInterpolationPoints Number of points used in the Lagrange interpolation (even, between 4 and 12)
+     *  \param initialTimeStep Time step of the tabulation at which the refinement is started
+     *  \param minimumTimeStep Time step at which the refinement is stopped (with a warning if the accuracy is not met)
+     */
+    InterpolatedEarthOrientationAnglesCalculator(
+            const std::shared_ptr< EarthOrientationAnglesCalculator > anglesCalculator,
+            const basic_astrodynamics::TimeScales inputTimeScale,
+            const double startTime,
+            const double endTime,
+            const double angularAccuracy = 1.0E-11,
+            const int numberOfInterpolationPoints = 8,
+            const double initialTimeStep = 6.0 * 3600.0,
+            const double minimumTimeStep = 60.0 );
+
+    //! Calculate rotation angles from ITRS to GCRS at given time value.
+    /*!
+     *  Calculate rotation angles from ITRS to GCRS at given time value (in the input time scale), by interpolation of the
+     *  tabulated values.
+     *  \param timeValue Number of seconds since J2000 at which orientation is to be evaluated.
+     *  \return Rotation angles for ITRS<->GCRS transformation at given epoch. First pair entry is: X, Y, s, x_p, y_p. Second
+     *  defines UT1.
+     */
+    template< typename TimeType >
+    std::pair< Eigen::Vector5d, TimeType > getRotationAnglesFromItrsToGcrs( const TimeType timeValue )
+    {
+        double doubleTimeValue = static_cast< double >( timeValue );
+        if( !( doubleTimeValue >= startTime_ && doubleTimeValue <= endTime_ ) )
+        {
+            return anglesCalculator_->getRotationAnglesFromItrsToGcrs< TimeType >( timeValue, inputTimeScale_ );
+        }
+
+        Eigen::Vector6d interpolatedValues;
+        interpolateValues( doubleTimeValue, interpolatedValues );
+        return std::make_pair( interpolatedValues.segment< 5 >( 0 ), timeValue + interpolatedValues( 5 ) );
+    }
+
+    //! Function to retrieve the time interval on which the angles are tabulated
+    std::pair< double, double > getTabulatedInterval( )
+    {
+        return std::make_pair( startTime_, endTime_ );
+    }
+
+    //! Function to retrieve the time step of the tabulation
+    double getTimeStep( )
+    {
+        return timeStep_;
+    }
+
+    //! Function to retrieve the maximum interpolation error (in radians) at the midpoints of the tabulation
+    double getMaximumInterpolationError( )
+    {
+        return maximumInterpolationError_;
+    }
+
+    //! Function to retrieve the time scale in which the input time to this class is provided
+    basic_astrodynamics::TimeScales getInputTimeScale( )
+    {
+        return inputTimeScale_;
+    }
+
+    //! Function to retrieve the object from which the earth orientation angles are computed directly
+    std::shared_ptr< EarthOrientationAnglesCalculator > getAnglesCalculator( )
+    {
+        return anglesCalculator_;
+    }
+
+private:
+
+    //! Function to tabulate the angles with the given time step
+    void tabulateValues( const double timeStep );
+
+    //! Function to compute the tabulated quantities (X, Y, s, x_p, y_p, UT1 minus input time) directly
+    Eigen::Vector6d computeValuesDirectly( const double timeValue );
+
+    //! Function to interpolate the tabulated quantities (X, Y, s, x_p, y_p, UT1 minus input time)
+    void interpolateValues( const double timeValue, Eigen::Vector6d& interpolatedValues );
+
+    //! Object from which the earth orientation angles are computed directly
+    std::shared_ptr< EarthOrientationAnglesCalculator > anglesCalculator_;
+
+    //! Time scale in which the input time to this class is provided
+    basic_astrodynamics::TimeScales inputTimeScale_;
+
+    //! Start time of the interval on which the angles are tabulated
+    double startTime_;
+
+    //! End time of the interval on which the angles are tabulated
+    double endTime_;
+
+    //! Number of points used in the Lagrange interpolation
+    int numberOfInterpolationPoints_;
+
+    //! Time step of the tabulation
+    double timeStep_;
+
+    //! Inverse of timeStep_
+    double inverseTimeStep_;
+
+    //! Number of tabulation points
+    int numberOfTabulationPoints_;
+
+    //! Tabulated values (X, Y, s, x_p, y_p, UT1 minus input time at each tabulation point, stored consecutively)
+    std::vector< double > tabulatedValues_;
+
+    //! Denominators of the Lagrange polynomials for equidistant nodes (independent of the interpolation time)
+    std::vector< double > lagrangeDenominators_;
+
+    //! Maximum interpolation error (in radians) at the midpoints of the tabulation
+    double maximumInterpolationError_;
+};
+
+} // namespace earth_orientation
+
+} // namespace tudat
+
+#endif // TUDAT_INTERPOLATEDEARTHORIENTATIONCALCULATOR_H
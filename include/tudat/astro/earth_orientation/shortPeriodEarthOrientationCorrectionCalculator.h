@@ -16,6 +16,7 @@
 #include <string>
 
 #include <functional>
+#include <type_traits>
 
 
 
@@ -38,6 +39,32 @@ namespace tudat
 namespace earth_orientation
 {
 
+//! Function to calculate the Delaunay fundamental arguments with GMST, reusing earlier results in the current thread
+/*!
+ *  Function to calculate the Delaunay fundamental arguments with GMST (see
+ *  sofa_interface::calculateApproximateDelaunayFundamentalArgumentsWithGmst). The arguments are retrieved from
+ *  sofa_interface::getSharedApproximateDelaunayFundamentalArgumentsWithGmst, so that e.g. the short-period polar motion and
+ *  UT1 corrections, and the tidal deformation models (through the Doodson arguments), which are evaluated at the same time,
+ *  share the computation of the arguments.
+ *  \param tdbTime TDB time (seconds since J2000) at which arguments are to be computed
+ *  \return Delaunay fundamental arguments with GMST
+ */
+Eigen::Vector6d calculateMemoisedDelaunayFundamentalArgumentsWithGmst( const double tdbTime );
+
+//! Function to retrieve a unique identifier for a new short-period correction calculator (used to memoise its results).
+unsigned int getNewShortPeriodCorrectionCalculatorId( );
+
+//! Function to retrieve per-thread buffers for the phase angles, and their sines and cosines, of short-period corrections.
+/*!
+ *  Function to retrieve per-thread buffers for the phase angles, and their sines and cosines, of short-period corrections.
+ *  The buffers are only reallocated when a larger size than before is requested in the current thread.
+ *  \param numberOfTerms Number of correction terms for which buffers are required
+ *  \param phaseAngles Pointer to buffer for the phase angles (returned by reference)
+ *  \param sines Pointer to buffer for the sines of the phase angles (returned by reference)
+ *  \param cosines Pointer to buffer for the cosines of the phase angles (returned by reference)
+ */
+void getShortPeriodCorrectionBuffers( const int numberOfTerms, double*& phaseAngles, double*& sines, double*& cosines );
+
 //! Object to calculate the short period variations in Earth orientaion parameters
 /*!
  *  Object to calculate the short period  variations in Earth orientaion parameters, e.g. taking into account
@@ -65,8 +92,8 @@ public:
             const std::vector< std::string >& amplitudesFiles,
             const std::vector< std::string >& argumentMultipliersFile ,
             const std::function< Eigen::Vector6d( const double )  > argumentFunction =
-            std::bind( &sofa_interface::calculateApproximateDelaunayFundamentalArgumentsWithGmst, std::placeholders::_1 ) ):
-        argumentFunction_( argumentFunction )
+            std::bind( &calculateMemoisedDelaunayFundamentalArgumentsWithGmst, std::placeholders::_1 ) ):
+        argumentFunction_( argumentFunction ), calculatorId_( getNewShortPeriodCorrectionCalculatorId( ) )
     {
         if( amplitudesFiles.size( ) != argumentMultipliersFile.size( ) )
         {
@@ -74,25 +101,71 @@ public:
         }
 
         // Read data from files
+        std::vector< Eigen::MatrixXd > argumentAmplitudes;
+        std::vector< Eigen::MatrixXd > argumentMultipliers;
         std::pair< Eigen::MatrixXd, Eigen::MatrixXd > dataFromFile;
         for( unsigned int i = 0; i < amplitudesFiles.size( ); i++ )
         {
             dataFromFile = readAmplitudesAndFundamentalArgumentMultipliers(
                         amplitudesFiles.at( i ), argumentMultipliersFile.at( i ), minimumAmplitude );
-            argumentAmplitudes_.push_back( conversionFactor * dataFromFile.first );
-            argumentMultipliers_.push_back( dataFromFile.second );
+            argumentAmplitudes.push_back( conversionFactor * dataFromFile.first );
+            argumentMultipliers.push_back( dataFromFile.second );
+        }
+
+        // Combine terms of all files, and split amplitudes into sine and cosine amplitudes
+        int numberOfTerms = 0;
+        for( unsigned int i = 0; i < argumentAmplitudes.size( ); i++ )
+        {
+            numberOfTerms += argumentAmplitudes.at( i ).rows( );
+        }
+        // Number of output components (sumCorrectionTerms is implemented for double and Eigen::Vector2d only)
+        int numberOfOutputs = std::is_same< OutputType, double >::value ? 1 : 2;
+
+        combinedArgumentMultipliers_.setZero( numberOfTerms, 6 );
+        sineAmplitudes_.setZero( numberOfOutputs, numberOfTerms );
+        cosineAmplitudes_.setZero( numberOfOutputs, numberOfTerms );
+        int currentStartIndex = 0;
+        for( unsigned int i = 0; i < argumentAmplitudes.size( ); i++ )
+        {
+            int currentNumberOfTerms = argumentAmplitudes.at( i ).rows( );
+            if( argumentAmplitudes.at( i ).cols( ) < 2 * numberOfOutputs )
+            {
+                throw std::runtime_error( "Error when calling ShortPeriodEarthOrientationCorrectionCalculator, amplitude files are inconsistent" );
+            }
+            combinedArgumentMultipliers_.block( currentStartIndex, 0, currentNumberOfTerms, 6 ) =
+                    argumentMultipliers.at( i ).block( 0, 0, currentNumberOfTerms, 6 );
+            for( int j = 0; j < numberOfOutputs; j++ )
+            {
+                sineAmplitudes_.block( j, currentStartIndex, 1, currentNumberOfTerms ) =
+                        argumentAmplitudes.at( i ).col( 2 * j ).transpose( );
+                cosineAmplitudes_.block( j, currentStartIndex, 1, currentNumberOfTerms ) =
+                        argumentAmplitudes.at( i ).col( 2 * j + 1 ).transpose( );
+            }
+            currentStartIndex += currentNumberOfTerms;
         }
     }
 
     //! Function to obtain short period corrections.
     /*!
      *  Function to obtain short period corrections, using time as input. Fundamental arguments are calculated internally.
+     *  The result of the last call (in the current thread) is stored, and returned directly when the corrections are
+     *  requested again at the same time.
      *  \param ephemerisTime Time (TDB seconds since J2000) at which corretions are to be determined
      *  \return Short period corrections
      */
     OutputType getCorrections( const double& ephemerisTime )
     {
-        return sumCorrectionTerms( argumentFunction_( ephemerisTime ) );
+        thread_local unsigned int lastCalculatorId = 0;
+        thread_local double lastEphemerisTime = TUDAT_NAN;
+        thread_local OutputType lastCorrections;
+
+        if( lastCalculatorId != calculatorId_ || !( lastEphemerisTime == ephemerisTime ) )
+        {
+            lastCorrections = sumCorrectionTerms( argumentFunction_( ephemerisTime ) );
+            lastCalculatorId = calculatorId_;
+            lastEphemerisTime = ephemerisTime;
+        }
+        return lastCorrections;
     }
 
     //! Function to obtain short period corrections.
@@ -110,21 +183,48 @@ private:
 
     //! Function to sum all the corrcetion terms.
     /*!
-     *  Function to sum all the corrcetion terms.
+     *  Function to sum all the corrcetion terms. The phase angles of all terms are computed as a single matrix-vector product,
+     *  after which their sines and cosines are evaluated as a single (vectorized) array operation, and multiplied
+     *  with the amplitudes.
      * \param arguments Values of fundamental arguments
      * \return Total correction at current fundamental arguments
      */
     OutputType sumCorrectionTerms( const Eigen::Vector6d& arguments );
 
-    //! Amplitudes of libration-induced variations
-    std::vector< Eigen::MatrixXd > argumentAmplitudes_;
+    //! Function to compute the sine and cosine of the phase angles of all terms.
+    /*!
+     *  Function to compute the sine and cosine of the phase angles of all terms, in per-thread buffers
+     * \param arguments Values of fundamental arguments
+     * \param sines Pointer to sines of phase angles (returned by reference)
+     * \param cosines Pointer to cosines of phase angles (returned by reference)
+     */
+    void computeTrigonometricTerms( const Eigen::Vector6d& arguments, double*& sines, double*& cosines )
+    {
+        int numberOfTerms = combinedArgumentMultipliers_.rows( );
+        double* phaseAngles;
+        getShortPeriodCorrectionBuffers( numberOfTerms, phaseAngles, sines, cosines );
 
-    //! Fundamental argument multipliers of libration-induced variations.
-    std::vector< Eigen::MatrixXd > argumentMultipliers_;
+        Eigen::Map< Eigen::VectorXd > phaseAnglesVector( phaseAngles, numberOfTerms );
+        phaseAnglesVector.noalias( ) = combinedArgumentMultipliers_ * arguments;
+        Eigen::Map< Eigen::VectorXd >( sines, numberOfTerms ) = phaseAnglesVector.array( ).sin( ).matrix( );
+        Eigen::Map< Eigen::VectorXd >( cosines, numberOfTerms ) = phaseAnglesVector.array( ).cos( ).matrix( );
+    }
 
     //! Fundamental argument functions associated with multipliers.
     std::function< Eigen::Vector6d( const double ) > argumentFunction_;
 
+    //! Fundamental argument multipliers of all terms (with rows of all files concatenated)
+    Eigen::MatrixXd combinedArgumentMultipliers_;
+
+    //! Sine amplitudes of all terms (row per output component, column per term)
+    Eigen::MatrixXd sineAmplitudes_;
+
+    //! Cosine amplitudes of all terms (row per output component, column per term)
+    Eigen::MatrixXd cosineAmplitudes_;
+
+    //! Unique identifier of this object, used to memoise its results
+    unsigned int calculatorId_;
+
 
 };
 
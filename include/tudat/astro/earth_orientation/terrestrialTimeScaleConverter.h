@@ -12,7 +12,9 @@
 #ifndef TUDAT_TERRESTRIALTIMESCALECONVERTER_H
 #define TUDAT_TERRESTRIALTIMESCALECONVERTER_H
 
+#include <algorithm>
 #include <functional>
+#include <vector>
 
 #include "tudat/math/interpolators/oneDimensionalInterpolator.h"
 #include "tudat/basics/timeType.h"
@@ -110,7 +112,9 @@ public:
             shortPeriodUt1CorrectionCalculator = getDefaultUT1CorrectionCalculator( ) ):
         dailyUtcUt1CorrectionInterpolator_( dailyUtcUt1CorrectionInterpolator ),
         shortPeriodUt1CorrectionCalculator_( shortPeriodUt1CorrectionCalculator ),
-        previousEarthFixedPosition_( Eigen::Vector3d::Zero( ) )
+        previousEarthFixedPosition_( Eigen::Vector3d::Zero( ) ),
+        conversionCacheSize_( 16 ),
+        numberOfConversionCacheHits_( 0 )
     { }
 
     //! Function to convert a time value from the input to the output scale.
@@ -137,18 +141,47 @@ public:
         }
         else
         {
-            // Check if update is required
+            // Check if update is required (first from current times, then from times at recently used epochs/stations)
             if( !( static_cast< TimeType >( getCurrentTimeList< TimeType >( ).getTimeValue( inputScale ) ) ==
                    static_cast< TimeType >( inputTimeValue ) ) ||
                     !( getPreviousGroundStationPosition< TimeType >( ) == earthFixedPosition ) )
             {
-                updateTimes< TimeType >( inputScale, inputTimeValue, earthFixedPosition );
+                if( !retrieveTimesFromConversionCache< TimeType >( inputScale, inputTimeValue, earthFixedPosition ) )
+                {
+                    updateTimes< TimeType >( inputScale, inputTimeValue, earthFixedPosition );
+                }
             }
             convertedTime = getCurrentTimeList< TimeType >( ).getTimeValue( outputScale );
         }
         return convertedTime;
     }
 
+    //! Function to convert a list of time values from the input to the output scale.
+    /*!
+     *  Function to convert a list of time values from the input to the output scale, at a single Earth-fixed position
+     *  (see getCurrentTime).
+     *  \param inputScale Time scale of inputTimeValues.
+     *  \param outputScale Desired time scale for output values.
+     *  \param inputTimeValues Time values that are to be converted.
+     *  \param earthFixedPosition Earth-fixed position at which time conversions are to be evaluated
+     *  \return Converted time values (in the same order as the input values).
+     */
+    template< typename TimeType >
+    std::vector< TimeType > getCurrentTimes(
+            const basic_astrodynamics::TimeScales inputScale, const basic_astrodynamics::TimeScales outputScale,
+            const std::vector< TimeType >& inputTimeValues,
+            const Eigen::Vector3d& earthFixedPosition = Eigen::Vector3d::Zero( ) )
+    {
+        std::vector< TimeType > convertedTimes;
+        convertedTimes.reserve( inputTimeValues.size( ) );
+        for( unsigned int i = 0; i < inputTimeValues.size( ); i++ )
+        {
+            convertedTimes.push_back( getCurrentTime< TimeType >(
+                                          inputScale, outputScale, inputTimeValues.at( i ), earthFixedPosition ) );
+        }
+        return convertedTimes;
+    }
+
     template< typename TimeType >
     TimeType getCurrentTimeDifference(
         const basic_astrodynamics::TimeScales inputScale, const basic_astrodynamics::TimeScales outputScale,
@@ -169,6 +202,34 @@ public:
         timesToUpdate.tdb = TUDAT_NAN;
         timesToUpdate.ut1 = TUDAT_NAN;
         timesToUpdate.utc = TUDAT_NAN;
+        getConversionCache< TimeType >( ).clear( );
+    }
+
+    //! Function to set the number of epoch/station combinations for which the converted times are retained
+    /*!
+     *  Function to set the number of epoch/station combinations for which the converted times are retained (in addition
+     *  to the current times). When a conversion is requested at one of these combinations (for instance when several
+     *  observables at the same receive time are computed for different stations in turn), the times are retrieved
+     *  instead of recomputed. The least recently used combination is discarded when the cache is full.
+     *  \param conversionCacheSize Number of retained epoch/station combinations (0 to disable the cache)
+     */
+    void setConversionCacheSize( const unsigned int conversionCacheSize )
+    {
+        conversionCacheSize_ = conversionCacheSize;
+        if( conversionCacheEntries_.size( ) > conversionCacheSize_ )
+        {
+            conversionCacheEntries_.resize( conversionCacheSize_ );
+        }
+        if( conversionCacheEntriesSplit_.size( ) > conversionCacheSize_ )
+        {
+            conversionCacheEntriesSplit_.resize( conversionCacheSize_ );
+        }
+    }
+
+    //! Function to retrieve the number of conversions for which the times were retrieved from the cache
+    unsigned int getNumberOfConversionCacheHits( )
+    {
+        return numberOfConversionCacheHits_;
     }
 
     //! Function to recalculate time-values at all time scales from given unput values.
@@ -274,6 +335,8 @@ public:
             throw std::runtime_error( "Error when performing Earth time scales, input time not recognized" );
             break;
         }
+
+        addTimesToConversionCache< TimeType >( );
     }
 
     template< typename TimeType >
@@ -321,6 +384,58 @@ private:
     template< typename TimeType >
     void setCurrentGroundStation( const Eigen::Vector3d& currentGroundStation );
 
+    //! Function to retrieve list of recently converted times (most recent first), with associated ground station position
+    template< typename TimeType >
+    std::vector< std::pair< CurrentTimes< TimeType >, Eigen::Vector3d > >& getConversionCache( );
+
+    //! Function to set the current times from the cache, if they are available for the given input time and position
+    /*!
+     *  Function to set the current times from the cache, if they are available for the given input time and position.
+     *  The retrieved entry is moved to the front of the cache.
+     *  \param inputScale Time scale of inputTimeValue.
+     *  \param inputTimeValue Time value that is to be converted.
+     *  \param earthFixedPosition Earth-fixed position at which time conversions are to be evaluated
+     *  \return True if the times were retrieved from the cache, false if they are to be recomputed.
+     */
+    template< typename TimeType >
+    bool retrieveTimesFromConversionCache(
+            const basic_astrodynamics::TimeScales inputScale, const TimeType& inputTimeValue,
+            const Eigen::Vector3d& earthFixedPosition )
+    {
+        std::vector< std::pair< CurrentTimes< TimeType >, Eigen::Vector3d > >& conversionCache =
+                getConversionCache< TimeType >( );
+        for( unsigned int i = 0; i < conversionCache.size( ); i++ )
+        {
+            if( static_cast< TimeType >( conversionCache[ i ].first.getTimeValue( inputScale ) ) ==
+                    static_cast< TimeType >( inputTimeValue ) && conversionCache[ i ].second == earthFixedPosition )
+            {
+                std::rotate( conversionCache.begin( ), conversionCache.begin( ) + i, conversionCache.begin( ) + i + 1 );
+                getCurrentTimeList< TimeType >( ) = conversionCache[ 0 ].first;
+                setCurrentGroundStation< TimeType >( conversionCache[ 0 ].second );
+                numberOfConversionCacheHits_++;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //! Function to add the current times (and ground station position) to the front of the cache
+    template< typename TimeType >
+    void addTimesToConversionCache( )
+    {
+        if( conversionCacheSize_ > 0 )
+        {
+            std::vector< std::pair< CurrentTimes< TimeType >, Eigen::Vector3d > >& conversionCache =
+                    getConversionCache< TimeType >( );
+            if( conversionCache.size( ) >= conversionCacheSize_ )
+            {
+                conversionCache.pop_back( );
+            }
+            conversionCache.insert( conversionCache.begin( ), std::make_pair(
+                                        getCurrentTimeList< TimeType >( ), getPreviousGroundStationPosition< TimeType >( ) ) );
+        }
+    }
+
     //! Function to update the universal times (UT1 and UTC) in CurrentTimes member at requested precision
     template< typename TimeType >
     void calculateUniversalTimes( )
@@ -354,6 +469,18 @@ private:
 
     //! Value of ground station position used on last call to updateTimes< Time > function
     Eigen::Vector3d previousEarthFixedPositionSplit_;
+
+    //! Times (with ground station positions) at recently used epoch/station combinations at double precision
+    std::vector< std::pair< CurrentTimes< double >, Eigen::Vector3d > > conversionCacheEntries_;
+
+    //! Times (with ground station positions) at recently used epoch/station combinations at Time precision
+    std::vector< std::pair< CurrentTimes< Time >, Eigen::Vector3d > > conversionCacheEntriesSplit_;
+
+    //! Maximum number of entries in conversionCacheEntries_ and conversionCacheEntriesSplit_
+    unsigned int conversionCacheSize_;
+
+    //! Number of conversions for which the times were retrieved from the cache
+    unsigned int numberOfConversionCacheHits_;
 };
 
 //! Function to create the default Earth time scales conversion object
@@ -364,7 +491,7 @@ private:
  * \return Default Earth time scales conversion object
  */
 std::shared_ptr< TerrestrialTimeScaleConverter > createDefaultTimeConverter( const std::shared_ptr< EOPReader > eopReader =
-        std::make_shared< EOPReader >( ) );
+        loadEOPReader( ) );
 
 static const std::shared_ptr< TerrestrialTimeScaleConverter > defaultTimeConverter = createDefaultTimeConverter( );
 
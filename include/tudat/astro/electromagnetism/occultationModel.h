@@ -15,6 +15,8 @@
 #ifndef TUDAT_OCCULTATIONMODEL_H
 #define TUDAT_OCCULTATIONMODEL_H
 
+#include <functional>
+#include <memory>
 #include <vector>
 
 #include <Eigen/Core>
@@ -28,6 +30,22 @@ namespace tudat
 namespace electromagnetism
 {
 
+/*!
+ * Interval in time during which the received fraction of an occulted extended source is constant (i.e. the target is
+ * either fully illuminated or in umbra), as determined along a reference trajectory of the target.
+ */
+struct ConstantReceivedFractionInterval
+{
+    //! Start time of interval
+    double startTime;
+
+    //! End time of interval
+    double endTime;
+
+    //! Received fraction during interval (either 0 or 1)
+    double receivedFraction;
+};
+
 /*!
  * Class modeling the occultation of an occulted body due to occulting bodies as seen from a target position. This class
  * is only aware of the occulting bodies, not the occulted body or target.
@@ -54,17 +72,21 @@ public:
     void updateMembers(double currentTime);
 
     /*!
-     *  Evaluate how much of an occulted extended source is visible (i.e. the shadow function).
+     *  Evaluate how much of an occulted extended source is visible (i.e. the shadow function). If the current time lies
+     *  in one of the constant received fraction intervals (see setConstantReceivedFractionIntervals), the received
+     *  fraction of that interval is returned without evaluating the geometry. If the function is called repeatedly for
+     *  the same source and target at the same time (e.g. by multiple models using this occultation model), the
+     *  previously computed result is returned.
      *
      * @param occultedSourcePosition Position of the occulted source in global coordinates
      * @param occultedSourceShapeModel Shape model of the occulted source
      * @param targetPosition Position of the target from which occultation is observed in global coordinates
      * @return Visible fraction of the occulted source (between 0 and 1)
      */
-    virtual double evaluateReceivedFractionFromExtendedSource(
+    double evaluateReceivedFractionFromExtendedSource(
             const Eigen::Vector3d& occultedSourcePosition,
             const std::shared_ptr<basic_astrodynamics::BodyShapeModel>& occultedSourceShapeModel,
-            const Eigen::Vector3d& targetPosition) const = 0;
+            const Eigen::Vector3d& targetPosition) const;
 
     /*!
      * Evaluate how much of an occulted point source is visible (i.e. point-to-point visibility). This function is
@@ -88,12 +110,53 @@ public:
         return numberOfOccultingBodies;
     }
 
+    /*!
+     * Set intervals in time during which the received fraction of the occulted extended source is known to be constant,
+     * typically computed with computeConstantReceivedFractionIntervals from a reference trajectory of the target. These
+     * intervals are only valid if the target follows the reference trajectory, and should therefore not be set for
+     * occultation models that are evaluated for multiple targets (e.g. for the panels of a paneled source).
+     *
+     * @param constantReceivedFractionIntervals Non-overlapping intervals with constant received fraction
+     */
+    void setConstantReceivedFractionIntervals(
+            const std::vector<ConstantReceivedFractionInterval>& constantReceivedFractionIntervals);
+
+    std::vector<ConstantReceivedFractionInterval> getConstantReceivedFractionIntervals() const
+    {
+        return constantReceivedFractionIntervals_;
+    }
+
 private:
     virtual void updateMembers_(double currentTime) {}
 
+    /*!
+     * Compute how much of an occulted extended source is visible (i.e. the shadow function) from the current geometry.
+     */
+    virtual double computeReceivedFractionFromExtendedSource(
+            const Eigen::Vector3d& occultedSourcePosition,
+            const std::shared_ptr<basic_astrodynamics::BodyShapeModel>& occultedSourceShapeModel,
+            const Eigen::Vector3d& targetPosition) const = 0;
+
+    /*!
+     * Find the constant received fraction interval that contains the current time, if any.
+     *
+     * @return Pointer to the interval containing the current time, or nullptr if there is no such interval
+     */
+    const ConstantReceivedFractionInterval* findCurrentConstantReceivedFractionInterval() const;
+
     double currentTime_{TUDAT_NAN};
     unsigned int numberOfOccultingBodies;
     std::vector<std::string> occultingBodyNames_;
+
+    std::vector<ConstantReceivedFractionInterval> constantReceivedFractionIntervals_;
+    mutable unsigned int currentConstantReceivedFractionIntervalIndex_{0};
+
+    // Inputs and result of the last extended source evaluation at the current time, to share the result between users
+    mutable bool isLastReceivedFractionFromExtendedSourceValid_{false};
+    mutable Eigen::Vector3d lastOccultedSourcePosition_;
+    mutable const basic_astrodynamics::BodyShapeModel* lastOccultedSourceShapeModel_{nullptr};
+    mutable Eigen::Vector3d lastTargetPosition_;
+    mutable double lastReceivedFractionFromExtendedSource_{TUDAT_NAN};
 };
 
 /*!
@@ -105,16 +168,17 @@ public:
     explicit NoOccultingBodyOccultationModel() :
             OccultationModel({}) {}
 
-    double evaluateReceivedFractionFromExtendedSource(
+    double evaluateReceivedFractionFromPointSource(
             const Eigen::Vector3d& occultedSourcePosition,
-            const std::shared_ptr<basic_astrodynamics::BodyShapeModel>& occultedSourceShapeModel,
             const Eigen::Vector3d& targetPosition) const override
     {
         return 1.0;
     }
 
-    double evaluateReceivedFractionFromPointSource(
+private:
+    double computeReceivedFractionFromExtendedSource(
             const Eigen::Vector3d& occultedSourcePosition,
+            const std::shared_ptr<basic_astrodynamics::BodyShapeModel>& occultedSourceShapeModel,
             const Eigen::Vector3d& targetPosition) const override
     {
         return 1.0;
@@ -136,11 +200,6 @@ public:
             occultingBodyPositionFunction_(occultingBodyPositionFunction),
             occultingBodyShapeModel_(occultingBodyShapeModel) {}
 
-    double evaluateReceivedFractionFromExtendedSource(
-            const Eigen::Vector3d& occultedSourcePosition,
-            const std::shared_ptr<basic_astrodynamics::BodyShapeModel>& occultedSourceShapeModel,
-            const Eigen::Vector3d& targetPosition) const override;
-
     double evaluateReceivedFractionFromPointSource(
             const Eigen::Vector3d& occultedSourcePosition,
             const Eigen::Vector3d& targetPosition) const override;
@@ -148,6 +207,11 @@ public:
 private:
     void updateMembers_(double currentTime) override;
 
+    double computeReceivedFractionFromExtendedSource(
+            const Eigen::Vector3d& occultedSourcePosition,
+            const std::shared_ptr<basic_astrodynamics::BodyShapeModel>& occultedSourceShapeModel,
+            const Eigen::Vector3d& targetPosition) const override;
+
     std::function<Eigen::Vector3d()> occultingBodyPositionFunction_;
     std::shared_ptr<basic_astrodynamics::BodyShapeModel> occultingBodyShapeModel_;
     Eigen::Vector3d occultingBodyPosition;
@@ -172,11 +236,6 @@ public:
             occultingBodyShapeModels_(occultingBodyShapeModels),
             occultingBodyPositions(occultingBodyNames.size()) {}
 
-    double evaluateReceivedFractionFromExtendedSource(
-            const Eigen::Vector3d& occultedSourcePosition,
-            const std::shared_ptr<basic_astrodynamics::BodyShapeModel>& occultedSourceShapeModel,
-            const Eigen::Vector3d& targetPosition) const override;
-
     double evaluateReceivedFractionFromPointSource(
             const Eigen::Vector3d& occultedSourcePosition,
             const Eigen::Vector3d& targetPosition) const override;
@@ -184,6 +243,11 @@ public:
 private:
     void updateMembers_(double currentTime) override;
 
+    double computeReceivedFractionFromExtendedSource(
+            const Eigen::Vector3d& occultedSourcePosition,
+            const std::shared_ptr<basic_astrodynamics::BodyShapeModel>& occultedSourceShapeModel,
+            const Eigen::Vector3d& targetPosition) const override;
+
     std::vector<std::function<Eigen::Vector3d()>> occultingBodyPositionFunctions_;
     std::vector<std::shared_ptr<basic_astrodynamics::BodyShapeModel>> occultingBodyShapeModels_;
     std::vector<Eigen::Vector3d> occultingBodyPositions;
@@ -191,6 +255,47 @@ private:
 
 // TODO Realistic two-body occultation (DOI: 10.1016/j.asr.2018.02.002)
 
+/*!
+ * Evaluate whether a target is fully illuminated by a spherical extended source, i.e. whether the apparent disks of the
+ * occulted source and the spherical occulting body, as seen from the target, do not overlap. This is a cheap
+ * pre-check (no trigonometric functions) for the shadow function, which is exactly 1 in this case.
+ *
+ * @param occultedSourcePosition Position of the occulted source in global coordinates
+ * @param occultedSourceRadius Radius of the occulted source
+ * @param occultingBodyPosition Position of the occulting body in global coordinates
+ * @param occultingBodyRadius Radius of the occulting body
+ * @param targetPosition Position of the target from which occultation is observed in global coordinates
+ * @return Whether the target is fully illuminated by the source (false if the check is inconclusive)
+ */
+bool isTargetFullyIlluminatedByExtendedSource(
+        const Eigen::Vector3d& occultedSourcePosition,
+        double occultedSourceRadius,
+        const Eigen::Vector3d& occultingBodyPosition,
+        double occultingBodyRadius,
+        const Eigen::Vector3d& targetPosition);
+
+/*!
+ * Compute the intervals during which the received fraction of an occulted extended source is constant (i.e. the target
+ * is fully illuminated or in umbra), from the received fraction along a reference trajectory. The received fraction is
+ * sampled with a fixed time step, and the entry and exit epochs of each interval are refined by bisection. The
+ * intervals are shrunk conservatively, such that the received fraction is constant within the returned intervals up to
+ * the given time tolerance. The time step must be smaller than the duration of the shortest illuminated, penumbra and
+ * umbra phase, since phases shorter than the time step may be missed.
+ *
+ * @param receivedFractionFunction Received fraction as a function of time along the reference trajectory
+ * @param startTime Start time of reference trajectory
+ * @param endTime End time of reference trajectory
+ * @param timeStep Time step with which the received fraction is sampled
+ * @param timeTolerance Tolerance of the entry and exit epochs of the intervals
+ * @return Intervals with constant received fraction, sorted by time
+ */
+std::vector<ConstantReceivedFractionInterval> computeConstantReceivedFractionIntervals(
+        const std::function<double(double)>& receivedFractionFunction,
+        double startTime,
+        double endTime,
+        double timeStep,
+        double timeTolerance = 1.0E-3);
+
 /*!
  * Evaluate whether two points have a line of sight with an occulting spherical body in between.
  *
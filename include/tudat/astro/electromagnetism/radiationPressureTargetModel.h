@@ -14,6 +14,7 @@
 #ifndef TUDAT_RADIATIONPRESSURETARGETMODEL_H
 #define TUDAT_RADIATIONPRESSURETARGETMODEL_H
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <vector>
@@ -109,8 +110,89 @@ private:
     double coefficient_;
 };
 
+/*!
+ * Class providing precomputed self-shadowing factors of the panels of a paneled target, i.e. the fraction of the area
+ * of each panel that is illuminated (not shadowed by other parts of the target), as a function of the direction of the
+ * source in the local (i.e. target-fixed) frame. The factors are tabulated on a regular grid of source direction
+ * latitudes (from -π/2 to π/2, inclusive) and longitudes (from -π to π, exclusive, and periodic), and are bilinearly
+ * interpolated. The table is typically generated once (e.g., by ray tracing a detailed geometry model), so that no
+ * ray tracing is needed during the propagation. Since the table is defined in the target-fixed frame, it only accounts
+ * for shadowing by parts of the target that are fixed in that frame.
+ */
+class PanelSelfShadowingTable
+{
+public:
+    /*!
+     * Constructor.
+     *
+     * @param illuminatedFractions Illuminated fractions (between 0 and 1) of each panel (rows) at each grid point
+     *      (columns). Grid point (i, j), with i the latitude index and j the longitude index, is stored in column
+     *      i * numberOfLongitudes + j
+     * @param numberOfLatitudes Number of source direction latitudes in grid (at least 2)
+     * @param numberOfLongitudes Number of source direction longitudes in grid (at least 1)
+     */
+    PanelSelfShadowingTable(
+            const Eigen::MatrixXd& illuminatedFractions,
+            unsigned int numberOfLatitudes,
+            unsigned int numberOfLongitudes);
+
+    /*!
+     * Evaluate illuminated fractions of all panels for the current source direction.
+     *
+     * @param sourceToTargetDirection Direction of incoming radiation in local (i.e. target-fixed) coordinates
+     * @return Illuminated fraction of each panel
+     */
+    Eigen::VectorXd evaluateIlluminatedFractions(const Eigen::Vector3d& sourceToTargetDirection) const;
+
+    unsigned int getNumberOfPanels() const
+    {
+        return illuminatedFractions_.rows();
+    }
+
+    const Eigen::MatrixXd& getIlluminatedFractions() const
+    {
+        return illuminatedFractions_;
+    }
+
+    unsigned int getNumberOfLatitudes() const
+    {
+        return numberOfLatitudes_;
+    }
+
+    unsigned int getNumberOfLongitudes() const
+    {
+        return numberOfLongitudes_;
+    }
+
+private:
+    Eigen::MatrixXd illuminatedFractions_;
+    unsigned int numberOfLatitudes_;
+    unsigned int numberOfLongitudes_;
+};
+
+/*!
+ * Create a self-shadowing table by sampling a function (e.g., a ray tracer) on the grid of source directions.
+ *
+ * @param illuminatedFractionFunction Function returning the illuminated fraction of each panel for a given direction
+ *      of incoming radiation in local (i.e. target-fixed) coordinates
+ * @param numberOfPanels Number of panels of the target
+ * @param numberOfLatitudes Number of source direction latitudes in grid (at least 2)
+ * @param numberOfLongitudes Number of source direction longitudes in grid (at least 1)
+ * @return Self-shadowing table
+ */
+std::shared_ptr<PanelSelfShadowingTable> createPanelSelfShadowingTable(
+        const std::function<Eigen::VectorXd(const Eigen::Vector3d&)>& illuminatedFractionFunction,
+        unsigned int numberOfPanels,
+        unsigned int numberOfLatitudes,
+        unsigned int numberOfLongitudes);
+
 /*!
  * Class modeling a target as collection of panels, e.g., representing the box body and solar panels.
+ *
+ * Panel surface normals, areas and reaction coefficients of specular-diffuse-mix reflection laws are stored
+ * column-wise (one entry per panel), and refreshed once per time step, such that the force summation over all panels
+ * is a small number of vectorized operations. Panels with other reflection laws are evaluated individually. Optionally,
+ * the effective area of each panel is scaled with a precomputed self-shadowing factor (see PanelSelfShadowingTable).
  */
 class PaneledRadiationPressureTargetModel : public RadiationPressureTargetModel
 {
@@ -127,7 +209,10 @@ public:
     explicit PaneledRadiationPressureTargetModel(
             const std::vector<Panel>& panels,
             const std::map<std::string, std::vector<std::string>>& sourceToTargetOccultingBodies = {}) :
-            RadiationPressureTargetModel(sourceToTargetOccultingBodies), panels_(panels) {}
+            RadiationPressureTargetModel(sourceToTargetOccultingBodies), panels_(panels)
+    {
+        initializePanelArrays();
+    }
 
     /*!
      * Constructor.
@@ -139,7 +224,10 @@ public:
     PaneledRadiationPressureTargetModel(
             std::initializer_list<Panel> panels,
             const std::map<std::string, std::vector<std::string>>& sourceToTargetOccultingBodies = {}) :
-            RadiationPressureTargetModel(sourceToTargetOccultingBodies), panels_(panels) {}
+            RadiationPressureTargetModel(sourceToTargetOccultingBodies), panels_(panels)
+    {
+        initializePanelArrays();
+    }
 
     Eigen::Vector3d evaluateRadiationPressureForce(
             double sourceIrradiance,
@@ -150,10 +238,43 @@ public:
         return panels_;
     }
 
+    /*!
+     * Set table of self-shadowing factors, by which the effective area of each panel is scaled. Set to nullptr to
+     * disable self-shadowing.
+     *
+     * @param selfShadowingTable Self-shadowing table, with one row per panel
+     */
+    void setSelfShadowingTable(const std::shared_ptr<PanelSelfShadowingTable>& selfShadowingTable);
+
+    std::shared_ptr<PanelSelfShadowingTable> getSelfShadowingTable() const
+    {
+        return selfShadowingTable_;
+    }
+
 private:
     void updateMembers_(double currentTime) override;
 
+    void initializePanelArrays();
+
+    void updatePanelArrays();
+
     std::vector<Panel> panels_;
+
+    // Surface normals of all panels (one column per panel), updated once per time step
+    Eigen::Matrix3Xd panelSurfaceNormals_;
+
+    Eigen::VectorXd panelAreas_;
+
+    // Reaction vector coefficients of specular-diffuse-mix panels, such that the reaction vector is
+    // c_incidence * incomingDirection - (c_diffuse + c_specular * cos(theta)) * surfaceNormal (zero for other panels)
+    Eigen::VectorXd incidenceReactionCoefficients_;
+    Eigen::VectorXd diffuseReactionCoefficients_;
+    Eigen::VectorXd specularReactionCoefficients_;
+
+    // Indices of panels with reflection laws other than SpecularDiffuseMixReflectionLaw
+    std::vector<unsigned int> genericReflectionLawPanelIndices_;
+
+    std::shared_ptr<PanelSelfShadowingTable> selfShadowingTable_;
 };
 
 /*!
@@ -224,6 +345,7 @@ private:
     void updateMembers();
 
     Eigen::Vector3d surfaceNormal_;
+    bool isSurfaceNormalSet_{false};
     std::function<Eigen::Vector3d()> surfaceNormalFunction_;
     std::shared_ptr<ReflectionLaw> reflectionLaw_;
     double area_;
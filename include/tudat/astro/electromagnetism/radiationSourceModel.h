@@ -23,6 +23,8 @@
 #ifndef TUDAT_RADIATIONSOURCEMODEL_H
 #define TUDAT_RADIATIONSOURCEMODEL_H
 
+#include <cmath>
+#include <string>
 #include <utility>
 #include <vector>
 #include <map>
@@ -38,6 +40,7 @@
 #include "tudat/astro/basic_astro/bodyShapeModel.h"
 #include "tudat/math/basic/mathematicalConstants.h"
 #include "tudat/math/basic/coordinateConversions.h"
+#include "tudat/basics/parallelization.h"
 #include "occultationModel.h"
 
 
@@ -94,10 +97,55 @@ public:
     double evaluateTotalIrradianceAtPosition(
             const Eigen::Vector3d& targetPosition);
 
+    /*!
+     * Set whether the source-to-target occultation models are shared between the radiation pressure accelerations of
+     * all targets of this source with the same occulting bodies. When enabled, the positions of the occulting bodies are
+     * retrieved once per epoch for all these targets, and the received fraction of the source is computed only once
+     * for targets at the same position. Since constant received fraction intervals (see
+     * OccultationModel::setConstantReceivedFractionIntervals) are only valid for a single target, these must not be
+     * set on shared occultation models. Must be set before the accelerations are created (default false).
+     *
+     * @param shareTargetOccultationModels Boolean denoting whether occultation models are shared between targets
+     */
+    void setTargetOccultationModelSharing(const bool shareTargetOccultationModels)
+    {
+        shareTargetOccultationModels_ = shareTargetOccultationModels;
+    }
+
+    bool getTargetOccultationModelSharing() const
+    {
+        return shareTargetOccultationModels_;
+    }
+
+    /*!
+     * Get the occultation model shared by the targets of this source with the given occulting bodies.
+     *
+     * @param occultingBodyNames Names of the occulting bodies (in any order)
+     * @return Shared occultation model, or nullptr if none has been added for these occulting bodies
+     */
+    std::shared_ptr<OccultationModel> getSharedTargetOccultationModel(
+            const std::vector<std::string>& occultingBodyNames) const;
+
+    /*!
+     * Add an occultation model that is to be shared by the targets of this source with the given occulting bodies.
+     *
+     * @param occultingBodyNames Names of the occulting bodies (in any order)
+     * @param occultationModel Occultation model that is to be shared
+     */
+    void addSharedTargetOccultationModel(
+            const std::vector<std::string>& occultingBodyNames,
+            const std::shared_ptr<OccultationModel>& occultationModel);
+
 protected:
     virtual void updateMembers_(const double currentTime) {};
 
     double currentTime_{TUDAT_NAN};
+
+private:
+    bool shareTargetOccultationModels_{false};
+
+    //! Occultation models shared by the targets of this source, with the sorted names of the occulting bodies as key
+    std::map<std::vector<std::string>, std::shared_ptr<OccultationModel>> sharedTargetOccultationModels_;
 };
 
 //*********************************************************************************************
@@ -124,15 +172,38 @@ public:
 
     IrradianceWithSourceList evaluateIrradianceAtPosition(const Eigen::Vector3d& targetPosition) override;
 
+    /*!
+     * Evaluate the irradiance [W/m²] at a certain position due to this source, as a single value. Equivalent to
+     * evaluateIrradianceAtPosition(), but without creating a list of sub-source irradiances, so that it can be called
+     * for many targets at little cost.
+     *
+     * @param targetPosition Position where to evaluate the irradiance in local (i.e. source-fixed) coordinates
+     * @return Irradiance from this source at the target position [W/m²]
+     */
+    double evaluatePointIrradianceAtPosition(const Eigen::Vector3d& targetPosition) const;
+
     const std::shared_ptr<LuminosityModel>& getLuminosityModel() const
     {
         return luminosityModel_;
     }
 
+    /*!
+     * Get the luminosity of the source at the current time.
+     *
+     * @return Luminosity as retrieved at the last update, or directly from the luminosity model if not yet updated [W]
+     */
+    double getCurrentLuminosity() const
+    {
+        return std::isnan(currentLuminosity_) ? luminosityModel_->getLuminosity() : currentLuminosity_;
+    }
+
 private:
     void updateMembers_(double currentTime) override;
 
     std::shared_ptr<LuminosityModel> luminosityModel_;
+
+    //! Luminosity retrieved at the last update, shared by all irradiance evaluations until the next update [W]
+    double currentLuminosity_{TUDAT_NAN};
 };
 
 //*********************************************************************************************
@@ -202,8 +273,6 @@ protected:
     std::shared_ptr<basic_astrodynamics::BodyShapeModel> sourceBodyShapeModel_;
     std::unique_ptr<SourcePanelRadiosityModelUpdater> sourcePanelRadiosityModelUpdater_;
 
-private:
-
     // For dependent variable
     double visibleArea{TUDAT_NAN};
 };
@@ -280,6 +349,12 @@ private:
  * This is the classic paneling for albedo modeling introduced by Knocke (1988). Panels are generated for the
  * the spherical cap of the source body that is visible from the target. The spherical cap is divided into
  * a central cap centered around the subsatellite point and a number of rings divided into panels.
+ *
+ * Since the ring layout is fixed, the azimuthal directions of the panels relative to the subsatellite point are
+ * computed only once, and the panel geometry is stored as contiguous arrays (one column per panel) so that it can be
+ * generated with a single matrix product per evaluation. The irradiances of the individual panels can be evaluated
+ * in parallel (see setNumberOfThreads). Repeated evaluations for the same target position at the same time reuse the
+ * previous result.
  */
 class DynamicallyPaneledRadiationSourceModel : public PaneledRadiationSourceModel
 {
@@ -290,12 +365,14 @@ public:
      * @param sourceBodyShapeModel Shape model of this source
      * @param baseRadiosityModels Radiosity models that will be copied for each panel
      * @param numberOfPanelsPerRing Number of panels for each ring, excluding the central cap
+     * @param numberOfThreads Number of threads over which the panel irradiance evaluations are distributed
      */
     explicit DynamicallyPaneledRadiationSourceModel(
             const std::shared_ptr<basic_astrodynamics::BodyShapeModel>& sourceBodyShapeModel,
             std::unique_ptr<SourcePanelRadiosityModelUpdater> sourcePanelRadiosityModelUpdater,
             const std::vector<std::unique_ptr<SourcePanelRadiosityModel>>& baseRadiosityModels,
-            const std::vector<int>& numberOfPanelsPerRing);
+            const std::vector<int>& numberOfPanelsPerRing,
+            int numberOfThreads = 1);
 
     IrradianceWithSourceList evaluateIrradianceAtPosition(const Eigen::Vector3d& targetPosition) override;
 
@@ -309,14 +386,56 @@ public:
         return numberOfPanels;
     }
 
+    /*!
+     * Set the number of threads over which the panel irradiance evaluations are distributed. The panel geometry and
+     * radiosity model updates (which may use shared caches, e.g. in the albedo distribution) are always performed in the
+     * calling thread.
+     *
+     * @param numberOfThreads Number of threads (must be at least 1)
+     */
+    void setNumberOfThreads(int numberOfThreads);
+
+    int getNumberOfThreads() const
+    {
+        return numberOfThreads_;
+    }
+
 private:
     void updateMembers_(double currentTime) override;
 
+    /*!
+     * Update the geometry (center, surface normal, area, latitude and longitude) of all panels, for the spherical cap
+     * that is visible from the target.
+     *
+     * @param targetPosition Position of the target in local frame
+     */
+    void updatePanelGeometry(const Eigen::Vector3d& targetPosition);
+
     unsigned int numberOfPanels;
 
     const std::vector<int> numberOfPanelsPerRing_;
 
     std::vector<Panel> panels_;
+
+    // Cosine (first row) and sine (second row) of the azimuth angle of each ring panel around the subsatellite point
+    Eigen::Matrix2Xd ringPanelAzimuthDirections_;
+
+    // Surface normals of all panels in local frame (one column per panel, central cap first)
+    Eigen::Matrix3Xd panelSurfaceNormals_;
+
+    // Areas of all panels
+    Eigen::VectorXd panelAreas_;
+
+    // Irradiances at the target due to all panels, for the current evaluation
+    Eigen::VectorXd panelIrradiances_;
+
+    // Target position and result of the last evaluation at the current time
+    bool isLastIrradianceListValid_{false};
+    Eigen::Vector3d lastTargetPosition_;
+    IrradianceWithSourceList lastIrradiances_;
+
+    int numberOfThreads_{1};
+    std::shared_ptr<utilities::ParallelTaskPool> threadPool_;
 };
 
 /*!
@@ -553,6 +672,22 @@ generatePaneledSphericalCap_EqualAngularResolution(
         const std::vector<int>& numberOfPanelsPerRing,
         double bodyRadius);
 
+/*!
+ * Compute the boundaries of the central cap and rings for the paneling of the spherical cap of the source body that is
+ * visible from the target as in Knocke (1988), such that all panels have the same projected, attenuated area (see
+ * generatePaneledSphericalCap_EqualProjectedAttenuatedArea).
+ *
+ * @param targetDistance Distance of the target from the body center
+ * @param numberOfPanelsPerRing Number of panels for each ring, excluding the central cap
+ * @param bodyRadius Radius of the body
+ * @return Angles between the subsatellite point and the outer boundaries of the central cap and of each ring, as seen
+ *      from the body center
+ */
+std::vector<double> computeRingBoundaryAngles_EqualProjectedAttenuatedArea(
+        double targetDistance,
+        const std::vector<int>& numberOfPanelsPerRing,
+        double bodyRadius);
+
 /*!
  * Generate panels for the spherical cap of the source body that is visible from the target as in Knocke (1988). The
  * spherical cap is divided into a central cap centered around the subsatellite point and a number of rings divided into
@@ -83,6 +83,11 @@ private:
 /*!
  * Class modeling the distribution of a property on the surface of a sphere, such as albedo or emissivity. The
  * distribution is constant with respect to time. Spatial variations are given by a spherical harmonics expansion.
+ *
+ * Since the distribution is time-invariant, the value for a given panel is only evaluated when the panel moves (see
+ * SourcePanelRadiosityModel::updateMembers), i.e. once for static paneling. For dynamic paneling, where the panel
+ * centers change every evaluation, the expansion can optionally be tabulated once on a regular latitude/longitude grid,
+ * from which values are bilinearly interpolated (see setInterpolationGridResolution).
  */
 class SphericalHarmonicsSurfacePropertyDistribution : public SurfacePropertyDistribution
 {
@@ -120,6 +125,19 @@ public:
         return true;
     }
 
+    /*!
+     * Set resolution of the latitude/longitude grid on which the expansion is tabulated. If set, values are bilinearly
+     * interpolated from the grid instead of evaluating the full expansion.
+     *
+     * @param gridResolution Angular grid resolution [rad], NaN to evaluate the full expansion for every value
+     */
+    void setInterpolationGridResolution(double gridResolution);
+
+    double getInterpolationGridResolution() const
+    {
+        return gridResolution_;
+    }
+
     const Eigen::MatrixXd& getCosineCoefficients() const
     {
         return cosineCoefficients_;
@@ -141,6 +159,10 @@ public:
     }
 
 private:
+    double evaluateExpansion(double latitude, double longitude);
+
+    double interpolateFromGrid(double latitude, double longitude) const;
+
     // Cosine spherical harmonic coefficients (not normalized)
     Eigen::MatrixXd cosineCoefficients_;
 
@@ -154,6 +176,17 @@ private:
     basic_mathematics::SphericalHarmonicsCache sphericalHarmonicsCache_;
 
     std::shared_ptr<basic_mathematics::LegendreCache> legendreCache_;
+
+    // Resolution of interpolation grid, NaN if expansion is evaluated directly
+    double gridResolution_{TUDAT_NAN};
+
+    // Tabulated values (latitude x longitude), latitudes from -π/2 to π/2 (inclusive) and longitudes from -π to π
+    // (exclusive), with spacing gridLatitudeStep_ and gridLongitudeStep_
+    Eigen::MatrixXd gridValues_;
+
+    double gridLatitudeStep_{TUDAT_NAN};
+
+    double gridLongitudeStep_{TUDAT_NAN};
 };
 
 /*!
@@ -162,7 +195,8 @@ private:
  * the distribution is constant w.r.t. longitude). This model corresponds to the albedo and emissivity for Earth in
  * Knocke (1988).
  *
- * Only the first-degree zonal coefficient varies with time.
+ * Only the first-degree zonal coefficient varies with time. It is evaluated once per epoch (in updateMembers), and
+ * shared by all panels that query the distribution at that epoch.
  */
 class SecondDegreeZonalPeriodicSurfacePropertyDistribution : public SurfacePropertyDistribution
 {
@@ -17,6 +17,7 @@
 #include "ephemerides/approximatePlanetPositionsDataContainer.h"
 #include "ephemerides/cartesianStateExtractor.h"
 #include "ephemerides/compositeEphemeris.h"
+#include "ephemerides/conjunctionScreening.h"
 #include "ephemerides/constantEphemeris.h"
 #include "ephemerides/constantRotationalEphemeris.h"
 #include "ephemerides/customEphemeris.h"
@@ -0,0 +1,239 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_CHEBYSHEVEPHEMERIS_H
+#define TUDAT_CHEBYSHEVEPHEMERIS_H
+
+#include <functional>
+#include <map>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/ephemerides/ephemeris.h"
+#include "tudat/basics/basicTypedefs.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Class that determines an ephemeris from Chebyshev polynomials, fitted once to tabulated data.
+/*!
+ *  Class that determines an ephemeris from Chebyshev polynomials, fitted once to tabulated data (in the manner of SPK
+ *  type 3 segments). The tabulated interval is divided into segments of equal duration. In each segment, each of the 6
+ *  Cartesian state components is represented by a Chebyshev series of fixed degree, which is fitted by interpolation at the
+ *  Chebyshev nodes (using a Lagrange interpolator through the tabulated data to obtain the state at the nodes). The number of
+ *  segments is increased until the fit reproduces the tabulated states (and the state at points in between the
+ *  Chebyshev nodes) to within the requested position and velocity tolerance. Since all segments have the same duration,
+ *  finding the segment for a given epoch is an O(1) operation, and evaluating the state requires no memory allocation.
+ *  Alternatively, the segments may be fitted directly to a state function (for instance a Spice ephemeris).
+ *  This class may for instance be used for setting the numerically integrated state of a body as its 'new' ephemeris,
+ *  when this ephemeris is to be evaluated very often (e.g. in estimation and observation simulation).
+ */
+class ChebyshevCartesianEphemeris : public Ephemeris
+{
+public:
+
+    using Ephemeris::getCartesianState;
+
+    //! Constructor, fits the Chebyshev segments to the tabulated data.
+    /*!
+     *  Constructor, fits the Chebyshev segments to the tabulated data.
+     *  \param stateHistory Tabulated Cartesian states (time as key) to which the ephemeris is to be fitted. If empty, no
+     *  data is set, and the ephemeris can only be used after a call to resetStateHistory.
+     *  \param positionTolerance Maximum permitted position error of the fit w.r.t. the tabulated data (if below the
+     *  round-off level of the tabulated positions, the fit is performed to this round-off level instead).
+     *  \param velocityTolerance Maximum permitted velocity error of the fit w.r.t. the tabulated data (if below the
+     *  round-off level of the tabulated velocities, the fit is performed to this round-off level instead).
+     *  \param polynomialDegree Degree of the Chebyshev series of each state component in each segment.
+     *  \param referenceFrameOrigin Origin of reference frame in which state is defined.
+     *  \param referenceFrameOrientation Orientation of reference frame in which state is defined.
+     */
+    ChebyshevCartesianEphemeris(
+            const std::map< double, Eigen::Vector6d >& stateHistory,
+            const double positionTolerance = 1.0E-3,
+            const double velocityTolerance = 1.0E-6,
+            const int polynomialDegree = 12,
+            const std::string referenceFrameOrigin = "SSB",
+            const std::string referenceFrameOrientation = "ECLIPJ2000" );
+
+    //! Constructor, fits the Chebyshev segments to a state function.
+    /*!
+     *  Constructor, fits the Chebyshev segments directly to a state function (for instance a Spice ephemeris), so that the
+     *  tolerances are met w.r.t. this function, in between (as well as at) the Chebyshev nodes.
+     *  \param stateFunction Function returning the Cartesian state as a function of time, to which the ephemeris is fitted
+     *  \param startTime Start of the interval on which the ephemeris is fitted
+     *  \param endTime End of the interval on which the ephemeris is fitted
+     *  \param positionTolerance Maximum permitted position error of the fit w.r.t. state function (limited to the
+     *  round-off level of the positions).
+     *  \param velocityTolerance Maximum permitted velocity error of the fit w.r.t. state function (limited to the
+     *  round-off level of the velocities).
+     *  \param polynomialDegree Degree of the Chebyshev series of each state component in each segment.
+     *  \param minimumSegmentDuration Minimum duration of a segment, at which refinement of the segments is stopped (with
+     *  a warning if the tolerance is not met).
+     *  \param referenceFrameOrigin Origin of reference frame in which state is defined.
+     *  \param referenceFrameOrientation Orientation of reference frame in which state is defined.
+     */
+    ChebyshevCartesianEphemeris(
+            const std::function< Eigen::Vector6d( const double ) >& stateFunction,
+            const double startTime,
+            const double endTime,
+            const double positionTolerance = 1.0E-3,
+            const double velocityTolerance = 1.0E-6,
+            const int polynomialDegree = 12,
+            const double minimumSegmentDuration = 60.0,
+            const std::string referenceFrameOrigin = "SSB",
+            const std::string referenceFrameOrientation = "ECLIPJ2000" );
+
+    //! Destructor
+    ~ChebyshevCartesianEphemeris( ){ }
+
+    //! Function to refit the Chebyshev segments to new tabulated data.
+    /*!
+     *  Function to refit the Chebyshev segments to new tabulated data, for instance following an update of the states of
+     *  the body after a new numerical integration. The tolerances and polynomial degree are kept.
+     *  \param stateHistory New tabulated Cartesian states (time as key) to which the ephemeris is to be fitted.
+     */
+    void resetStateHistory( const std::map< double, Eigen::Vector6d >& stateHistory );
+
+    //! Function to refit the Chebyshev segments to a state function.
+    /*!
+     *  Function to refit the Chebyshev segments to a state function, on a given interval. The tolerances and polynomial
+     *  degree are kept.
+     *  \param stateFunction Function returning the Cartesian state as a function of time, to which the ephemeris is fitted
+     *  \param startTime Start of the interval on which the ephemeris is fitted
+     *  \param endTime End of the interval on which the ephemeris is fitted
+     *  \param minimumSegmentDuration Minimum duration of a segment, at which refinement of the segments is stopped.
+     */
+    void resetStateFunction( const std::function< Eigen::Vector6d( const double ) >& stateFunction,
+                             const double startTime,
+                             const double endTime,
+                             const double minimumSegmentDuration = 60.0 );
+
+    //! Get cartesian state from ephemeris.
+    /*!
+     * Returns cartesian state from ephemeris, as evaluated from the Chebyshev series of the segment in which the epoch lies.
+     * An exception is thrown if the epoch is outside of the fitted interval.
+     * \param secondsSinceEpoch Seconds since epoch.
+     * \return State in Cartesian elements from ephemeris.
+     */
+    Eigen::Vector6d getCartesianState(
+            const double secondsSinceEpoch );
+
+    //! Function to retrieve the time interval at which this ephemeris can be safely interrogated
+    /*!
+     * Function to retrieve the time interval at which this ephemeris can be safely interrogated, which is the full
+     * interval of the tabulated data to which the segments were fitted.
+     * \return The time interval at which the ephemeris can be safely interrogated
+     */
+    std::pair< double, double > getSafeInterpolationInterval( )
+    {
+        return std::make_pair( startTime_, endTime_ );
+    }
+
+    //! Function to retrieve the number of Chebyshev segments
+    int getNumberOfSegments( )
+    {
+        return numberOfSegments_;
+    }
+
+    //! Function to retrieve the degree of the Chebyshev series in each segment
+    int getPolynomialDegree( )
+    {
+        return polynomialDegree_;
+    }
+
+    //! Function to retrieve the duration of each Chebyshev segment
+    double getSegmentDuration( )
+    {
+        return segmentDuration_;
+    }
+
+    //! Function to retrieve the maximum position and velocity error of the fit, w.r.t. tabulated data
+    std::pair< double, double > getMaximumFitErrors( )
+    {
+        return std::make_pair( maximumPositionFitError_, maximumVelocityFitError_ );
+    }
+
+private:
+
+    //! Function to fit the Chebyshev segments, increasing the number of segments until the tolerance is met
+    /*!
+     * Function to fit the Chebyshev segments, doubling the number of segments until the tolerance is met, or until the
+     * maximum number of segments is reached.
+     * \param stateFunction Function returning the state at arbitrary epochs
+     * \param stateHistory Tabulated Cartesian states at which the fit is additionally checked (may be empty).
+     * \param maximumNumberOfSegments Maximum number of segments into which the interval is divided.
+     */
+    void fitToStateFunction( const std::function< Eigen::Vector6d( const double ) >& stateFunction,
+                             const std::map< double, Eigen::Vector6d >& stateHistory,
+                             const int maximumNumberOfSegments );
+
+    //! Function to compute the Chebyshev coefficients of all segments, for a given number of segments
+    /*!
+     * Function to compute the Chebyshev coefficients of all segments, for a given number of segments, and set the
+     * maximum position and velocity difference w.r.t. the check states.
+     * \param stateHistory Tabulated Cartesian states at which the fit is additionally checked (may be empty).
+     * \param stateFunction Function returning the state at arbitrary epochs
+     * \param numberOfSegments Number of segments into which the interval is divided.
+     * \param maximumPositionNorm Maximum norm of position at Chebyshev nodes (returned by reference)
+     * \param maximumVelocityNorm Maximum norm of velocity at Chebyshev nodes (returned by reference)
+     */
+    void fitSegments( const std::map< double, Eigen::Vector6d >& stateHistory,
+                      const std::function< Eigen::Vector6d( const double ) >& stateFunction,
+                      const int numberOfSegments,
+                      double& maximumPositionNorm,
+                      double& maximumVelocityNorm );
+
+    //! Function to compute the state in a given segment, at a given normalized time (in [-1,1])
+    void evaluateSegment( const int segmentIndex, const double normalizedTime, Eigen::Vector6d& state );
+
+    //! Maximum permitted position error of the fit
+    double positionTolerance_;
+
+    //! Maximum permitted velocity error of the fit
+    double velocityTolerance_;
+
+    //! Degree of the Chebyshev series of each state component in each segment.
+    int polynomialDegree_;
+
+    //! Start time of fitted interval
+    double startTime_;
+
+    //! End time of fitted interval
+    double endTime_;
+
+    //! Duration of each segment
+    double segmentDuration_;
+
+    //! Inverse of segmentDuration_
+    double inverseSegmentDuration_;
+
+    //! Number of segments into which the fitted interval is divided.
+    int numberOfSegments_;
+
+    //! Chebyshev coefficients, stored per segment (outer), per degree, and per state component (inner)
+    std::vector< double > coefficients_;
+
+    //! Maximum position error of the current fit w.r.t. tabulated data.
+    double maximumPositionFitError_;
+
+    //! Maximum velocity error of the current fit w.r.t. tabulated data.
+    double maximumVelocityFitError_;
+};
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_CHEBYSHEVEPHEMERIS_H
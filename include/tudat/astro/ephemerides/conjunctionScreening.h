@@ -0,0 +1,168 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Hoots, F.R., Crawford, L.L. and Roehrich, R.L., An analytic method to determine future close approaches between
+ *          satellites, Celestial Mechanics 33, 1984.
+ */
+
+#ifndef TUDAT_CONJUNCTIONSCREENING_H
+#define TUDAT_CONJUNCTIONSCREENING_H
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/ephemerides/ephemeris.h"
+#include "tudat/basics/basicTypedefs.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Settings for the screening of a set of objects for close approaches
+class ConjunctionScreeningSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param screeningDistance Miss distance below which a close approach is reported
+     *  \param timeStep Step of the grid of epochs at which the states of the objects are sampled. The step must be small
+     *  w.r.t. the orbital periods, so that the relative distance of a pair has at most one minimum per step.
+     *  \param numberOfThreads Number of threads over which the time windows are distributed
+     *  \param timeOfClosestApproachTolerance Absolute tolerance (in seconds) of the time of closest approach
+     */
+    ConjunctionScreeningSettings( const double screeningDistance,
+                                  const double timeStep,
+                                  const int numberOfThreads = 1,
+                                  const double timeOfClosestApproachTolerance = 1.0E-6 ):
+        screeningDistance_( screeningDistance ), timeStep_( timeStep ), numberOfThreads_( numberOfThreads ),
+        timeOfClosestApproachTolerance_( timeOfClosestApproachTolerance ){ }
+
+    //! Miss distance below which a close approach is reported
+    double screeningDistance_;
+
+    //! Step of the grid of epochs at which the states of the objects are sampled
+    double timeStep_;
+
+    //! Number of threads over which the time windows are distributed
+    int numberOfThreads_;
+
+    //! Absolute tolerance (in seconds) of the time of closest approach
+    double timeOfClosestApproachTolerance_;
+};
+
+//! Close approach between two objects, as found by the conjunction screening
+struct ConjunctionEvent
+{
+    //! Index of the first object of the pair (always smaller than the index of the second object)
+    int firstObjectIndex;
+
+    //! Index of the second object of the pair
+    int secondObjectIndex;
+
+    //! Time of closest approach
+    double timeOfClosestApproach;
+
+    //! Distance between the objects at the time of closest approach
+    double missDistance;
+
+    //! State of the second object w.r.t. the first object at the time of closest approach
+    Eigen::Vector6d relativeState;
+
+    //! Sum of the position covariances of both objects at the time of closest approach (zero if not available)
+    Eigen::Matrix3d combinedPositionCovariance;
+
+    //! Boolean denoting whether the combined position covariance has been computed
+    bool isCovarianceAvailable;
+};
+
+//! Function to create a function that returns the covariance of an object, propagated by its state transition matrix
+/*!
+ *  Function to create a function that returns the covariance of the state of an object at a given time, computed from
+ *  the covariance at a reference epoch and the state transition matrix from that epoch: P(t) = Phi(t) P0 Phi(t)^T.
+ *  \param initialCovariance Covariance of the state at the reference epoch
+ *  \param stateTransitionMatrixFunction Function returning the state transition matrix from the reference epoch to the
+ *  time given as input (e.g. as retrieved from the results of a variational equations propagation)
+ *  \return Function returning the propagated covariance of the state at the time given as input
+ */
+std::function< Eigen::Matrix6d( const double ) > createPropagatedCovarianceFunction(
+        const Eigen::Matrix6d& initialCovariance,
+        const std::function< Eigen::Matrix6d( const double ) >& stateTransitionMatrixFunction );
+
+//! Function to screen a catalogue of objects, of which the states are given on a common grid of epochs, for close approaches
+/*!
+ *  Function to screen a catalogue of objects, of which the states are given on a common grid of epochs, for close
+ *  approaches. The screening is performed in the following steps:
+ *
+ *  - Pairs of which the ranges of distances from the central body (i.e. the perigee-apogee ranges, for a Keplerian
+ *    orbit, as sampled on the grid) are separated by more than the screening distance are discarded (Hoots et al., 1984).
+ *  - For each step of the grid, the trajectory of each object is bounded by a box, and the boxes are inserted into a
+ *    spatial hash. Only pairs that share a cell of the hash, and of which the boxes overlap, are retained.
+ *  - For each retained pair and step, the time of closest approach is found by a root-finder (bisection) applied to the
+ *    derivative of the squared relative distance, as computed from a cubic Hermite interpolation of the relative state
+ *    over the step (using the position and velocity at both ends of the step). Every minimum inside the step (or at its
+ *    end) with a miss distance below the screening distance is reported.
+ *
+ *  The steps of the grid are divided into one time window per thread, which are processed in parallel. If covariance
+ *  functions are provided, the combined position covariance of each event is computed from them.
+ *  \param catalogueStates States of the objects, stored contiguously per epoch: the state of object j at epoch i is stored
+ *  in column i * numberOfObjects + j (as provided by propagateTleCatalogue). The states must be w.r.t. a common central
+ *  body.
+ *  \param epochs Epochs of the grid, in increasing order
+ *  \param numberOfObjects Number of objects in the catalogue
+ *  \param settings Settings for the screening (of which the time step is not used; the grid of epochs is given)
+ *  \param covarianceFunctions Functions returning the covariance of the state of each object as a function of time
+ *  (empty if no covariance is to be computed; see createPropagatedCovarianceFunction)
+ *  \return Close approaches, sorted by object indices and time of closest approach
+ */
+std::vector< ConjunctionEvent > screenCatalogueForConjunctions(
+        const Eigen::Matrix< double, 6, Eigen::Dynamic >& catalogueStates,
+        const std::vector< double >& epochs,
+        const int numberOfObjects,
+        const ConjunctionScreeningSettings& settings,
+        const std::vector< std::function< Eigen::Matrix6d( const double ) > >& covarianceFunctions =
+        std::vector< std::function< Eigen::Matrix6d( const double ) > >( ) );
+
+//! Function to screen a set of ephemerides for close approaches
+/*!
+ *  Function to screen a set of ephemerides (typically TabulatedCartesianEphemeris objects created from propagation
+ *  results) for close approaches over a given interval. The states of all objects are first sampled on a grid with the
+ *  time step given in the settings (distributing the objects over the threads), after which the screening is performed by
+ *  screenCatalogueForConjunctions. Finally, the time of closest approach of each event is refined by applying the
+ *  root-finder to the states provided by the ephemerides themselves (i.e. to their interpolants, for tabulated
+ *  ephemerides) instead of the Hermite interpolation of the grid. As ephemeris objects are not generally thread-safe, this
+ *  last step is performed serially.
+ *  \param ephemerides Ephemerides of the objects, which must all have the same origin and orientation
+ *  \param startTime Start time of the screening interval
+ *  \param endTime End time of the screening interval
+ *  \param settings Settings for the screening
+ *  \param covarianceFunctions Functions returning the covariance of the state of each object as a function of time
+ *  (empty if no covariance is to be computed; see createPropagatedCovarianceFunction)
+ *  \return Close approaches, sorted by object indices and time of closest approach
+ */
+std::vector< ConjunctionEvent > screenEphemeridesForConjunctions(
+        const std::vector< std::shared_ptr< Ephemeris > >& ephemerides,
+        const double startTime,
+        const double endTime,
+        const ConjunctionScreeningSettings& settings,
+        const std::vector< std::function< Eigen::Matrix6d( const double ) > >& covarianceFunctions =
+        std::vector< std::function< Eigen::Matrix6d( const double ) > >( ) );
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_CONJUNCTIONSCREENING_H
@@ -106,6 +106,7 @@ public:
     void updateConstantState( const Eigen::Vector7d& newState )
     {
         constantState_ = newState;
+        registerModification( );
 
         Eigen::Quaterniond currentRotationToGlobalFrame =
                  Eigen::Quaterniond( constantState_( 0 ),
@@ -121,6 +122,9 @@ public:
                      constantState_.block( 4, 0, 3, 1 ) ) * currentRotationMatrixToLocalFrame;
     }
 
+    //! Function to check whether the rotation depends only on time (true for this class)
+    bool isTimeDependentOnly( ){ return true; }
+
 private:
 
     //! Constant rotational state vector
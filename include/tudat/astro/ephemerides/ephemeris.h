@@ -165,6 +165,12 @@ public:
      */
     std::string getReferenceFrameOrientation( ) { return referenceFrameOrientation_; }
 
+    //! Function to retrieve the heap memory held by tabulated data of the ephemeris (zero for analytical ephemerides)
+    virtual std::size_t getHeapMemorySize( ) const
+    {
+        return 0;
+    }
+
 protected:
 
     //! Reference frame origin.
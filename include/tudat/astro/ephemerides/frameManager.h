@@ -48,6 +48,70 @@ bool isFrameInertial( const std::string& frame );
 std::string getBaseFrameName( );
 
 
+//! Class to compute the state of a single frame (w.r.t. its base frame), memoising it at the current evaluation time
+/*!
+ *  Class to compute the state of a single frame (w.r.t. its base frame) from its ephemeris, used as constituent of the
+ *  composite ephemerides created by the ReferenceFrameManager. While the memoisation of the frame manager that created
+ *  this object is active (see ReferenceFrameManager::startFrameStateMemoisation), the state is retained after its
+ *  computation, and reused for all evaluations at the same time, so that portions of a frame chain that are shared by
+ *  multiple composite ephemerides (e.g. SSB->EMB) are evaluated only once per epoch. The retained state is discarded on a
+ *  change of evaluation time, and when the memoisation of the frame manager is restarted or stopped.
+ */
+template< typename StateScalarType, typename TimeType >
+class MemoisedFrameState
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param ephemeris Ephemeris of the frame w.r.t. its base frame
+     *  \param currentMemoisationIndex Index of current memoisation of the frame manager (negative if inactive)
+     */
+    MemoisedFrameState( const std::shared_ptr< Ephemeris > ephemeris,
+                        const std::shared_ptr< int > currentMemoisationIndex ):
+        ephemeris_( ephemeris ), currentMemoisationIndex_( currentMemoisationIndex ), memoisationIndex_( -1 ){ }
+
+    //! Function to retrieve the state of the frame w.r.t. its base frame
+    /*!
+     *  Function to retrieve the state of the frame w.r.t. its base frame, from the retained value if the memoisation is
+     *  active and the state has already been computed at the current time, or from the ephemeris otherwise.
+     *  \param time Time at which the state is to be computed
+     *  \return State of the frame w.r.t. its base frame
+     */
+    Eigen::Matrix< StateScalarType, 6, 1 > getState( const TimeType& time )
+    {
+        if( *currentMemoisationIndex_ < 0 )
+        {
+            return ephemeris_->getTemplatedStateFromEphemeris< StateScalarType, TimeType >( time );
+        }
+        else if( !( memoisationIndex_ == *currentMemoisationIndex_ && memoisedTime_ == time ) )
+        {
+            memoisedState_ = ephemeris_->getTemplatedStateFromEphemeris< StateScalarType, TimeType >( time );
+            memoisedTime_ = time;
+            memoisationIndex_ = *currentMemoisationIndex_;
+        }
+        return memoisedState_;
+    }
+
+private:
+
+    //! Ephemeris of the frame w.r.t. its base frame
+    std::shared_ptr< Ephemeris > ephemeris_;
+
+    //! Index of current memoisation of the frame manager (negative if inactive)
+    std::shared_ptr< int > currentMemoisationIndex_;
+
+    //! Index of memoisation during which memoisedState_ was computed
+    int memoisationIndex_;
+
+    //! Time at which memoisedState_ was computed
+    TimeType memoisedTime_;
+
+    //! Retained state of the frame w.r.t. its base frame
+    Eigen::Matrix< StateScalarType, 6, 1 > memoisedState_;
+};
+
 //! Class to retrieve translation functions between different frames
 /*!
  * Class to retrieve translation functions between different frames, as calculated from a list of
@@ -111,9 +175,7 @@ public:
                 for( unsigned int i = 0; i < ephemerisList.size( ); i++ )
                 {
                     totalEphemerisList[ i ] = std::make_pair(
-                                std::bind( &Ephemeris::getTemplatedStateFromEphemeris
-                                             < StateScalarType, TimeType >,
-                                             ephemerisList[ i ], std::placeholders::_1 ), false );
+                                getMemoisedFrameStateFunction< StateScalarType, TimeType >( ephemerisList[ i ] ), false );
                 }
             }
             // If origin is nearest common frame, get set of ephemeris and set to add them when
@@ -124,9 +186,7 @@ public:
                 for( unsigned int i = 0; i < ephemerisList.size( ); i++ )
                 {
                     totalEphemerisList[ i ] = std::make_pair(
-                                std::bind( &Ephemeris::getTemplatedStateFromEphemeris
-                                             < StateScalarType, TimeType >,
-                                             ephemerisList[ i ], std::placeholders::_1 ), true );
+                                getMemoisedFrameStateFunction< StateScalarType, TimeType >( ephemerisList[ i ] ), true );
                 }
             }
             // If nearest common frame is neither input, create link from both to nearest common frame.
@@ -138,9 +198,7 @@ public:
                 for( unsigned int i = 0; i < ephemerisList.size( ); i++ )
                 {
                     totalEphemerisList[ i ] = std::make_pair(
-                                std::bind( &Ephemeris::getTemplatedStateFromEphemeris
-                                             < StateScalarType, TimeType >,
-                                             ephemerisList[ i ], std::placeholders::_1 ), true );
+                                getMemoisedFrameStateFunction< StateScalarType, TimeType >( ephemerisList[ i ] ), true );
                 }
                 int firstListSize = ephemerisList.size( );
 
@@ -150,9 +208,7 @@ public:
                 for( unsigned int i = 0; i < ephemerisList.size( ); i++ )
                 {
                     totalEphemerisList[ i + firstListSize ] = std::make_pair(
-                                std::bind( &Ephemeris::getTemplatedStateFromEphemeris
-                                             < StateScalarType, TimeType >,
-                                             ephemerisList[ i ], std::placeholders::_1 ), false );
+                                getMemoisedFrameStateFunction< StateScalarType, TimeType >( ephemerisList[ i ] ), false );
                 }
             }
 
@@ -200,8 +256,55 @@ public:
      */
     std::vector< std::string > getEphemerisOrigins( const std::vector< std::string >& bodyList );
 
+    //! Function to start the memoisation of the states of the frames, for evaluations of its composite ephemerides
+    /*!
+     *  Function to start the memoisation of the states of the frames, for evaluations of the composite ephemerides created
+     *  by this object. While active, the state of each frame w.r.t. its base frame is computed once per evaluation time
+     *  (see MemoisedFrameState). This function is to be called when the states of several bodies w.r.t. different
+     *  origins are to be evaluated at the same epoch; the memoisation must be stopped (by stopFrameStateMemoisation)
+     *  before any of the ephemerides is modified. Any states retained from a previous memoisation are discarded.
+     */
+    void startFrameStateMemoisation( )
+    {
+        *currentMemoisationIndex_ = ++numberOfMemoisations_;
+    }
+
+    //! Function to stop the memoisation of the states of the frames (see startFrameStateMemoisation)
+    void stopFrameStateMemoisation( )
+    {
+        *currentMemoisationIndex_ = -1;
+    }
+
 private:
 
+    //! Function to retrieve function that computes the state of a frame w.r.t. its base frame
+    /*!
+     *  Function to retrieve function that computes the state of a frame w.r.t. its base frame, memoised during active
+     *  memoisation of this object.
+     *  \param ephemeris Ephemeris of the frame w.r.t. its base frame
+     *  \return Function that computes the state of a frame w.r.t. its base frame
+     */
+    template< typename StateScalarType, typename TimeType >
+    std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType& ) > getMemoisedFrameStateFunction(
+            const std::shared_ptr< Ephemeris > ephemeris )
+    {
+        // Create object for frame, if it does not yet exist (so that it is shared by all composite ephemerides)
+        std::map< std::shared_ptr< Ephemeris >, std::shared_ptr< MemoisedFrameState< StateScalarType, TimeType > > >&
+                memoisedFrameStates = getMemoisedFrameStates< StateScalarType, TimeType >( );
+        if( memoisedFrameStates.count( ephemeris ) == 0 )
+        {
+            memoisedFrameStates[ ephemeris ] = std::make_shared< MemoisedFrameState< StateScalarType, TimeType > >(
+                        ephemeris, currentMemoisationIndex_ );
+        }
+        return std::bind( &MemoisedFrameState< StateScalarType, TimeType >::getState,
+                          memoisedFrameStates.at( ephemeris ), std::placeholders::_1 );
+    }
+
+    //! Function to retrieve the objects computing the (memoised) frame states, at requested numerical precision
+    template< typename StateScalarType, typename TimeType >
+    std::map< std::shared_ptr< Ephemeris >, std::shared_ptr< MemoisedFrameState< StateScalarType, TimeType > > >&
+    getMemoisedFrameStates( );
+
     //! Vector of frames with associated base frames, ordered by frame level.
     /*!
      *  Vector of frames with associated base frames, ordered by frame level. Index of vector
@@ -224,6 +327,28 @@ private:
      */
     std::map< std::string, int > frameIndexList_;
 
+    //! Index of current memoisation (negative if inactive), shared with the MemoisedFrameState objects
+    std::shared_ptr< int > currentMemoisationIndex_;
+
+    //! Number of times that the memoisation was started
+    int numberOfMemoisations_;
+
+    //! Objects computing the (memoised) frame states, per frame ephemeris, with double precision state and time
+    std::map< std::shared_ptr< Ephemeris >, std::shared_ptr< MemoisedFrameState< double, double > > >
+    memoisedFrameStates_;
+
+    //! Objects computing the (memoised) frame states, per frame ephemeris, with long double precision state
+    std::map< std::shared_ptr< Ephemeris >, std::shared_ptr< MemoisedFrameState< long double, double > > >
+    memoisedFrameStatesLong_;
+
+    //! Objects computing the (memoised) frame states, per frame ephemeris, with Time precision time
+    std::map< std::shared_ptr< Ephemeris >, std::shared_ptr< MemoisedFrameState< double, Time > > >
+    memoisedFrameStatesSplitTime_;
+
+    //! Objects computing the (memoised) frame states, per frame ephemeris, with long double state and Time precision time
+    std::map< std::shared_ptr< Ephemeris >, std::shared_ptr< MemoisedFrameState< long double, Time > > >
+    memoisedFrameStatesLongSplitTime_;
+
     //! Returns an ephemeris along a single line of the hierarchy tree.
     /*!
      *  Returns an ephemeris along a single line of the hierarchy tree, i.e. returned ephemeris
@@ -0,0 +1,235 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_INTERPOLATEDROTATIONALEPHEMERIS_H
+#define TUDAT_INTERPOLATEDROTATIONALEPHEMERIS_H
+
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "tudat/astro/ephemerides/rotationalEphemeris.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Class that computes a rotation by interpolating the pre-tabulated rotation of an (expensive) rotation model
+/*!
+ *  Class that computes a rotation by interpolating the rotation of another rotation model, tabulated once (at
+ *  construction) over a given time interval. This prevents models such as the GCRS<->ITRS, full planetary, Spice and
+ *  synchronous rotation models from being evaluated at each rotation query. The quaternion from the target to the base
+ *  frame, and its time derivative (computed from the angular velocity vector), are tabulated at a constant time step,
+ *  and interpolated using cubic Hermite polynomials, after which the quaternion is normalized. The angular velocity
+ *  vector is computed from the derivative of the interpolated quaternion, so that it is consistent with the
+ *  interpolated rotation. The time step is halved until the interpolated rotation reproduces the directly computed one
+ *  (at the midpoints between the tabulation points) to within the requested angular accuracy. The interpolation requires
+ *  no memory allocation, and does not modify the object, so that it may be used from multiple threads concurrently.
+ *  Outside of the tabulated interval, the rotation is computed directly from the original rotation model. Note that
+ *  the tabulation is not updated if the original rotation model is modified afterwards (e.g. by estimating its
+ *  parameters), or if it depends on the state of bodies (such as the synchronous rotation model) that is propagated.
+ */
+class InterpolatedRotationalEphemeris: public RotationalEphemeris
+{
+public:
+
+    //! Constructor, tabulates the rotation of the original rotation model
+    /*!
+     *  Constructor, tabulates the rotation of the original rotation model
+     *  \param originalRotationalEphemeris Rotation model from which the rotation is tabulated
+     *  \param startTime Start time of the interval on which the rotation is tabulated
+     *  \param endTime End time of the interval on which the rotation is tabulated
+     *  \param angularAccuracy Maximum permitted error of the interpolated rotation (in radians)
+     *  \param initialTimeStep Time step of the tabulation at which the refinement is started
+     *  \param minimumTimeStep Time step at which the refinement is stopped (with a warning if the accuracy is not met)
+     */
+    InterpolatedRotationalEphemeris(
+            const std::shared_ptr< RotationalEphemeris > originalRotationalEphemeris,
+            const double startTime,
+            const double endTime,
+            const double angularAccuracy = 1.0E-10,
+            const double initialTimeStep = 3600.0,
+            const double minimumTimeStep = 1.0 );
+
+    //! Destructor
+    ~InterpolatedRotationalEphemeris( ){ }
+
+    //! Get rotation quaternion from target frame to base frame.
+    /*!
+     * Function to calculate and return the rotation quaternion from target frame to base frame at specified time.
+     * \param secondsSinceEpoch Seconds since epoch at which rotational ephemeris is to be evaluated.
+     * \return Rotation quaternion computed from target frame to base frame
+     */
+    Eigen::Quaterniond getRotationToBaseFrame( const double secondsSinceEpoch );
+
+    //! Get rotation quaternion from base frame to target frame.
+    /*!
+     * Function to calculate and return the rotation quaternion from base frame to target frame at specified time.
+     * \param secondsSinceEpoch Seconds since epoch at which rotational ephemeris is to be evaluated.
+     * \return Rotation quaternion computed from base frame to target frame
+     */
+    Eigen::Quaterniond getRotationToTargetFrame( const double secondsSinceEpoch )
+    {
+        return getRotationToBaseFrame( secondsSinceEpoch ).inverse( );
+    }
+
+    //! Function to retrieve the angular velocity vector of the body, expressed in the base frame.
+    /*!
+     * Function to retrieve the angular velocity vector of the body, expressed in the base frame.
+     * \param secondsSinceEpoch Seconds since epoch at which rotational ephemeris is to be evaluated.
+     * \return Angular velocity vector of body, expressed in base frame.
+     */
+    Eigen::Vector3d getRotationalVelocityVectorInBaseFrame( const double secondsSinceEpoch );
+
+    //! Function to retrieve the angular velocity vector of the body, expressed in the target (body-fixed) frame.
+    /*!
+     * Function to retrieve the angular velocity vector of the body, expressed in the target (body-fixed) frame.
+     * \param secondsSinceEpoch Seconds since epoch at which rotational ephemeris is to be evaluated.
+     * \return Angular velocity vector of body, expressed in target (body-fixed) frame.
+     */
+    Eigen::Vector3d getRotationalVelocityVectorInTargetFrame( const double secondsSinceEpoch );
+
+    //! Function to calculate the derivative of the rotation matrix from base frame to target frame.
+    /*!
+     *  Function to calculate the derivative of the rotation matrix from base frame to target frame at specified time.
+     * \param secondsSinceEpoch Seconds since epoch at which rotational ephemeris is to be evaluated.
+     *  \return Derivative of rotation from base to target (body-fixed) frame at specified time.
+     */
+    Eigen::Matrix3d getDerivativeOfRotationToTargetFrame( const double secondsSinceEpoch );
+
+    //! Function to calculate the derivative of the rotation matrix from target frame to base frame.
+    /*!
+     *  Function to calculate the derivative of the rotation matrix from target frame to base frame at specified time.
+     * \param secondsSinceEpoch Seconds since epoch at which rotational ephemeris is to be evaluated.
+     *  \return Derivative of rotation from target (body-fixed) to base frame at specified time.
+     */
+    Eigen::Matrix3d getDerivativeOfRotationToBaseFrame( const double secondsSinceEpoch )
+    {
+        return getDerivativeOfRotationToTargetFrame( secondsSinceEpoch ).transpose( );
+    }
+
+    //! Function to calculate the full rotational state at given time
+    /*!
+     * Function to calculate the full rotational state at given time (rotation matrix, derivative of rotation matrix
+     * and angular velocity vector), from a single interpolation.
+     * \param currentRotationToLocalFrame Current rotation to local frame (returned by reference)
+     * \param currentRotationToLocalFrameDerivative Current derivative of rotation matrix to local frame
+     * (returned by reference)
+     * \param currentAngularVelocityVectorInGlobalFrame Current angular velocity vector, expressed in global frame
+     * (returned by reference)
+     * \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     */
+    void getFullRotationalQuantitiesToTargetFrame(
+            Eigen::Quaterniond& currentRotationToLocalFrame,
+            Eigen::Matrix3d& currentRotationToLocalFrameDerivative,
+            Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
+            const double secondsSinceEpoch );
+
+    //! Function to check whether the rotation depends only on time (true, as the rotation is tabulated)
+    bool isTimeDependentOnly( )
+    {
+        return true;
+    }
+
+    //! Function to define whether the body is currently being propagated (passed to original rotation model)
+    void setIsBodyInPropagation( const bool isBodyInPropagation )
+    {
+        originalRotationalEphemeris_->setIsBodyInPropagation( isBodyInPropagation );
+    }
+
+    //! Function to retrieve the rotation model from which the rotation is tabulated
+    std::shared_ptr< RotationalEphemeris > getOriginalRotationalEphemeris( )
+    {
+        return originalRotationalEphemeris_;
+    }
+
+    //! Function to retrieve the time interval on which the rotation is tabulated
+    std::pair< double, double > getTabulatedInterval( )
+    {
+        return std::make_pair( startTime_, endTime_ );
+    }
+
+    //! Function to retrieve the time step of the tabulation
+    double getTimeStep( )
+    {
+        return timeStep_;
+    }
+
+    //! Function to retrieve the maximum interpolation error of the rotation (in radians) at the midpoints of the tabulation
+    double getMaximumInterpolationError( )
+    {
+        return maximumInterpolationError_;
+    }
+
+private:
+
+    //! Function to tabulate the rotation with the given time step
+    void tabulateRotation( const double timeStep );
+
+    //! Function to interpolate the (unnormalized) quaternion from target to base frame, and its time derivative
+    /*!
+     *  Function to interpolate the (unnormalized) quaternion from target to base frame (w,x,y,z), and its time derivative
+     *  \param timeValue Time at which the rotation is to be interpolated (must be in the tabulated interval)
+     *  \param quaternion Interpolated quaternion (returned by reference)
+     *  \param quaternionDerivative Interpolated quaternion time derivative (returned by reference)
+     */
+    void interpolateQuaternion( const double timeValue, Eigen::Vector4d& quaternion,
+                                Eigen::Vector4d& quaternionDerivative ) const;
+
+    //! Function to compute the rotation to base frame, and angular velocity vector in base frame, from interpolation
+    /*!
+     *  Function to compute the rotation to base frame, and angular velocity vector in base frame, from interpolation
+     *  \param timeValue Time at which the rotation is to be interpolated (must be in the tabulated interval)
+     *  \param rotationToBaseFrame Rotation from target to base frame (returned by reference)
+     *  \param angularVelocityInBaseFrame Angular velocity vector, expressed in base frame (returned by reference)
+     */
+    void interpolateRotation( const double timeValue, Eigen::Quaterniond& rotationToBaseFrame,
+                              Eigen::Vector3d& angularVelocityInBaseFrame ) const;
+
+    //! Function to check whether the given time is in the tabulated interval
+    bool isTimeInTabulatedInterval( const double timeValue ) const
+    {
+        return ( timeValue >= startTime_ && timeValue <= endTime_ );
+    }
+
+    //! Rotation model from which the rotation is tabulated
+    std::shared_ptr< RotationalEphemeris > originalRotationalEphemeris_;
+
+    //! Start time of the interval on which the rotation is tabulated
+    double startTime_;
+
+    //! End time of the interval on which the rotation is tabulated
+    double endTime_;
+
+    //! Time step of the tabulation
+    double timeStep_;
+
+    //! Inverse of timeStep_
+    double inverseTimeStep_;
+
+    //! Number of tabulation points
+    int numberOfTabulationPoints_;
+
+    //! Tabulated quaternions (w,x,y,z) and their time derivatives at each tabulation point, stored consecutively
+    std::vector< double > tabulatedValues_;
+
+    //! Maximum interpolation error of the rotation (in radians) at the midpoints of the tabulation
+    double maximumInterpolationError_;
+};
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_INTERPOLATEDROTATIONALEPHEMERIS_H
@@ -20,6 +20,7 @@
 #include "tudat/math/interpolators/interpolator.h"
 #include "tudat/astro/ephemerides/rotationalEphemeris.h"
 #include "tudat/astro/earth_orientation/earthOrientationCalculator.h"
+#include "tudat/astro/earth_orientation/interpolatedEarthOrientationCalculator.h"
 
 
 
@@ -66,17 +67,38 @@ public:
      *  \param anglesCalculator Class performing calculation to obtain earth orientation angle.
      *  \param timeScale Time scale in which input to this class (in getRotationToBaseFrame, getDerivativeOfRotationToBaseFrame) is provided,
      *  needed for correct input to EarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs.
+     *  \param baseFrame Base frame of the rotation model (GCRS or J2000)
+     *  \param interpolatedAnglesCalculator Object interpolating pre-tabulated earth orientation angles (computed from
+     *  anglesCalculator). If provided, the angles are obtained from this object, instead of being computed directly by
+     *  anglesCalculator (default none).
      */
     GcrsToItrsRotationModel( const std::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > anglesCalculator,
                              const basic_astrodynamics::TimeScales inputTimeScale  = basic_astrodynamics::tdb_scale,
-                             const std::string& baseFrame = "GCRS" ):
+                             const std::string& baseFrame = "GCRS",
+                             const std::shared_ptr< earth_orientation::InterpolatedEarthOrientationAnglesCalculator >
+                             interpolatedAnglesCalculator = nullptr ):
         RotationalEphemeris( baseFrame, "ITRS" ), anglesCalculator_( anglesCalculator ), inputTimeScale_( inputTimeScale ),
+        interpolatedAnglesCalculator_( interpolatedAnglesCalculator ),
         frameBias_( Eigen::Matrix3d::Identity( ) )
 
     {
-        functionToGetRotationAngles = std::bind(
-                    &earth_orientation::EarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs< double >,
-                    anglesCalculator, std::placeholders::_1, inputTimeScale );
+        if( interpolatedAnglesCalculator_ == nullptr )
+        {
+            functionToGetRotationAngles = std::bind(
+                        &earth_orientation::EarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs< double >,
+                        anglesCalculator, std::placeholders::_1, inputTimeScale );
+        }
+        else
+        {
+            if( interpolatedAnglesCalculator_->getAnglesCalculator( ) != anglesCalculator_ ||
+                    interpolatedAnglesCalculator_->getInputTimeScale( ) != inputTimeScale_ )
+            {
+                throw std::runtime_error( "Error in GCRS<->ITRS model, interpolated angles are not consistent with angles calculator" );
+            }
+            functionToGetRotationAngles = std::bind(
+                        &earth_orientation::InterpolatedEarthOrientationAnglesCalculator::
+                        getRotationAnglesFromItrsToGcrs< double >, interpolatedAnglesCalculator_, std::placeholders::_1 );
+        }
         if( baseFrame == "J2000" )
         {
             frameBias_ = sofa_interface::getFrameBias(
@@ -97,8 +119,7 @@ public:
     Eigen::Quaterniond getRotationToBaseFrame( const double ephemerisTime )
     {
         return Eigen::Quaterniond( frameBias_ ) * earth_orientation::calculateRotationFromItrsToGcrs< double >(
-                    anglesCalculator_->getRotationAnglesFromItrsToGcrs< double >( ephemerisTime, inputTimeScale_ ),
-                    ephemerisTime );
+                    getRotationAngles< double >( ephemerisTime ), ephemerisTime );
     }
 
     //! Function to calculate the rotation quaternion from ITRS to base frame
@@ -111,8 +132,7 @@ public:
     Eigen::Quaterniond getRotationToBaseFrameFromExtendedTime( const Time ephemerisTime )
     {
         return Eigen::Quaterniond( frameBias_ ) * earth_orientation::calculateRotationFromItrsToGcrs< Time >(
-                    anglesCalculator_->getRotationAnglesFromItrsToGcrs< Time >( ephemerisTime, inputTimeScale_ ),
-                    ephemerisTime );
+                    getRotationAngles< Time >( ephemerisTime ), ephemerisTime );
     }
 
 
@@ -184,9 +204,32 @@ public:
         return inputTimeScale_;
     }
 
+    //! Function to retrieve object interpolating pre-tabulated earth orientation angles (nullptr if not used)
+    std::shared_ptr< earth_orientation::InterpolatedEarthOrientationAnglesCalculator > getInterpolatedAnglesCalculator( )
+    {
+        return interpolatedAnglesCalculator_;
+    }
+
+
+    //! Function to check whether the rotation depends only on time (true for this class)
+    bool isTimeDependentOnly( ){ return true; }
 
 private:
 
+    //! Function to retrieve the earth orientation angles and UT1, from interpolator if available, or directly otherwise
+    template< typename TimeType >
+    std::pair< Eigen::Vector5d, TimeType > getRotationAngles( const TimeType ephemerisTime )
+    {
+        if( interpolatedAnglesCalculator_ != nullptr )
+        {
+            return interpolatedAnglesCalculator_->getRotationAnglesFromItrsToGcrs< TimeType >( ephemerisTime );
+        }
+        else
+        {
+            return anglesCalculator_->getRotationAnglesFromItrsToGcrs< TimeType >( ephemerisTime, inputTimeScale_ );
+        }
+    }
+
     //! Function providing the earth orientation angles as a function of time
     /*!
      * Function providing the earth orientation angles as a function of time.
@@ -205,6 +248,9 @@ private:
     //! Time scale in which the input time for class functions are interpreted
     basic_astrodynamics::TimeScales inputTimeScale_;
 
+    //! Object interpolating pre-tabulated earth orientation angles (nullptr if angles are computed directly)
+    std::shared_ptr< earth_orientation::InterpolatedEarthOrientationAnglesCalculator > interpolatedAnglesCalculator_;
+
     //! Frame rotation from GCRS to base frame
     /*!
      * Frame rotation from GCRS to base frame. If base frame is J2000, this is the standard frame bias, as computed from Spice.
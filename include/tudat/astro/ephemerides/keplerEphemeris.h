@@ -12,6 +12,8 @@
 #ifndef TUDAT_KEPLEREPHEMERIS_H
 #define TUDAT_KEPLEREPHEMERIS_H
 
+#include <vector>
+
 #include <Eigen/Geometry>
 
 #include "tudat/astro/basic_astro/timeConversions.h"
@@ -76,6 +78,19 @@ public:
     Eigen::Vector6d getCartesianState(
             const double secondsSinceEpoch );
 
+    //! Function to get states from ephemeris at a batch of epochs.
+    /*!
+     *  Returns states from ephemeris at a batch of epochs, assuming a purely Keplerian orbit. The results are equal to
+     *  those of successive calls to getCartesianState (to within the convergence tolerance of the conversion from mean to
+     *  eccentric anomaly), but Kepler's equation is solved for all epochs at once (see
+     *  convertMeanAnomaliesToEccentricAnomalies), and the conversion to Cartesian elements is done on all epochs at once.
+     *  \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     *  \return Keplerian orbit Cartesian states at given times, with one epoch per row. Each column contains a single
+     *  Cartesian element at all epochs.
+     */
+    Eigen::Matrix< double, Eigen::Dynamic, 6 > getCartesianStates(
+            const std::vector< double >& secondsSinceEpoch );
+
 private:
 
     //! Kepler elements at time epochOfInitialState.
@@ -40,6 +40,7 @@ public:
      * Constructor
      * \param singleArcEphemerides Map of single arc ephemerides, with map key the minimum time at which the
      * ephemeris is valid. In case of arc overlaps, the arc with the highest start time is used to determine the state.
+     * Prior to the first arc start time, the first arc is used.
      *  \param referenceFrameOrigin Origin of reference frame (string identifier).
      *  \param referenceFrameOrientation Orientation of reference frame (string identifier).
      */
@@ -51,13 +52,7 @@ public:
         singleArcEphemerides_( utilities::createVectorFromMapValues( singleArcEphemerides ) ),
         arcStartTimes_( utilities::createVectorFromMapKeys( singleArcEphemerides ) )
     {
-        // Create times at which the look up changes from one arc to the other.
-        arcSplitTimes_ = arcStartTimes_;
-        arcSplitTimes_.push_back( std::numeric_limits< double >::max( ) );
-
-        // Create lookup scheme to determine which ephemeris to use.
-        lookUpscheme_ = std::make_shared< interpolators::HuntingAlgorithmLookupScheme< double > >(
-                    arcSplitTimes_ );
+        createArcLookupScheme( );
     }
 
     //! Destructor
@@ -72,12 +67,7 @@ public:
     Eigen::Vector6d getCartesianState(
             const double secondsSinceEpoch )
     {
-        if( singleArcEphemerides_.size( ) == 0 )
-        {
-            throw std::runtime_error( "Error when retrieving state from multi-arc ephemeris; no constituent single-arc ephemerides are set" );
-        }
-        return singleArcEphemerides_.at( lookUpscheme_->findNearestLowerNeighbour( secondsSinceEpoch ) )->
-                getCartesianState( double( secondsSinceEpoch ) );
+        return getCurrentArcEphemeris( secondsSinceEpoch )->getCartesianState( double( secondsSinceEpoch ) );
     }
 
     //! Get state from ephemeris (long double state output).
@@ -89,12 +79,7 @@ public:
     Eigen::Matrix< long double, 6, 1 > getCartesianLongState(
             const double secondsSinceEpoch )
     {
-        if( singleArcEphemerides_.size( ) == 0 )
-        {
-            throw std::runtime_error( "Error when retrieving state from multi-arc ephemeris; no constituent single-arc ephemerides are set" );
-        }
-        return singleArcEphemerides_.at( lookUpscheme_->findNearestLowerNeighbour( secondsSinceEpoch ) )->
-                getCartesianLongState( secondsSinceEpoch );
+        return getCurrentArcEphemeris( secondsSinceEpoch )->getCartesianLongState( secondsSinceEpoch );
     }
 
     //! Get state from ephemeris (Time time input)
@@ -106,12 +91,7 @@ public:
     Eigen::Vector6d getCartesianStateFromExtendedTime(
             const Time& currentTime )
     {
-        if( singleArcEphemerides_.size( ) == 0 )
-        {
-            throw std::runtime_error( "Error when retrieving state from multi-arc ephemeris; no constituent single-arc ephemerides are set" );
-        }
-        return singleArcEphemerides_.at( lookUpscheme_->findNearestLowerNeighbour( currentTime ) )->
-                getCartesianStateFromExtendedTime( currentTime );
+        return getCurrentArcEphemeris( currentTime )->getCartesianStateFromExtendedTime( currentTime );
     }
 
     //! Get state from ephemeris (long double state output and Time time input)
@@ -123,32 +103,29 @@ public:
     Eigen::Matrix< long double, 6, 1 > getCartesianLongStateFromExtendedTime(
             const Time& currentTime )
     {
-        if( singleArcEphemerides_.size( ) == 0 )
-        {
-            throw std::runtime_error( "Error when retrieving state from multi-arc ephemeris; no constituent single-arc ephemerides are set" );
-        }
-        return singleArcEphemerides_.at( lookUpscheme_->findNearestLowerNeighbour( currentTime ) )->
-                getCartesianLongStateFromExtendedTime( currentTime );
+        return getCurrentArcEphemeris( currentTime )->getCartesianLongStateFromExtendedTime( currentTime );
     }
 
     //! Function to reset the constituent arc ephemerides
     /*!
      * Function to reset the constituent arc ephemerides
      * \param singleArcEphemerides New list of arc ephemeris objects
-     * \param arcStartTimes New list of ephemeris start times
+     * \param arcStartTimes New list of ephemeris start times (must be strictly increasing)
      */
     void resetSingleArcEphemerides(
             const std::vector< std::shared_ptr< Ephemeris > >& singleArcEphemerides,
             const std::vector< double >& arcStartTimes )
     {        
+        if( singleArcEphemerides.size( ) != arcStartTimes.size( ) )
+        {
+            throw std::runtime_error( "Error when resetting multi-arc ephemeris; number of arc ephemerides (" +
+                                      std::to_string( singleArcEphemerides.size( ) ) + ") and arc start times (" +
+                                      std::to_string( arcStartTimes.size( ) ) + ") are not consistent" );
+        }
+
         singleArcEphemerides_ = singleArcEphemerides;
         arcStartTimes_ = arcStartTimes;
-
-        // Create times at which the look up changes from one arc to the other.
-        arcSplitTimes_ = arcStartTimes_;
-        arcSplitTimes_.push_back(  std::numeric_limits< double >::max( ) );
-        lookUpscheme_ = std::make_shared< interpolators::HuntingAlgorithmLookupScheme< double > >(
-                    arcSplitTimes_ );
+        createArcLookupScheme( );
     }
 
     //! Function to reset the constituent arc ephemerides
@@ -183,9 +160,68 @@ public:
         return singleArcEphemerides_;
     }
 
+    //! Function to retrieve the heap memory held by tabulated data of all arc ephemeris objects
+    std::size_t getHeapMemorySize( ) const
+    {
+        std::size_t heapMemorySize = 0;
+        for( unsigned int i = 0; i < singleArcEphemerides_.size( ); i++ )
+        {
+            heapMemorySize += singleArcEphemerides_.at( i )->getHeapMemorySize( );
+        }
+        return heapMemorySize;
+    }
+
 
 private:
 
+    //! Function to create the lookup scheme that determines which arc ephemeris to use at a given time.
+    /*!
+     * Function to create the lookup scheme that determines which arc ephemeris to use at a given time. Arc i is used from
+     * its start time up to the start time of arc i+1 (so that, for overlapping arcs, the arc with the highest start time is
+     * used), with the first arc used before its start time and the last arc used up to infinity. For equidistant arc start
+     * times, the arc index is computed directly from the time; otherwise, the arc found in the previous call, and the arc
+     * following it, are checked before a binary search is performed. Both lookups may be performed concurrently.
+     */
+    void createArcLookupScheme( )
+    {
+        // Create times at which the look up changes from one arc to the other.
+        arcSplitTimes_ = arcStartTimes_;
+        arcSplitTimes_.push_back( std::numeric_limits< double >::max( ) );
+
+        if( arcStartTimes_.size( ) == 0 )
+        {
+            arcLookupScheme_ = nullptr;
+        }
+        else if( interpolators::isIndependentVariableGridUniform( arcStartTimes_ ) )
+        {
+            // Close the final arc at the next grid point, values beyond it are mapped to the final arc by the lookup.
+            std::vector< double > arcBoundaries = arcStartTimes_;
+            arcBoundaries.push_back( arcStartTimes_.back( ) +
+                                     ( arcStartTimes_.back( ) - arcStartTimes_.front( ) ) /
+                                     static_cast< double >( arcStartTimes_.size( ) - 1 ) );
+            arcLookupScheme_ = std::make_shared< interpolators::UniformGridLookupScheme< double > >( arcBoundaries );
+        }
+        else
+        {
+            arcLookupScheme_ = std::make_shared< interpolators::ArcBoundaryLookupScheme< double > >( arcSplitTimes_ );
+        }
+    }
+
+    //! Function to retrieve the arc ephemeris that is to be used at a given time.
+    /*!
+     * Function to retrieve the arc ephemeris that is to be used at a given time.
+     * \param currentTime Time at which the ephemeris is to be evaluated.
+     * \return Arc ephemeris that is to be used at currentTime.
+     */
+    const std::shared_ptr< Ephemeris >& getCurrentArcEphemeris( const double currentTime )
+    {
+        if( singleArcEphemerides_.size( ) == 0 )
+        {
+            throw std::runtime_error( "Error when retrieving state from multi-arc ephemeris; no constituent single-arc ephemerides are set" );
+        }
+        return singleArcEphemerides_[ arcLookupScheme_->findNearestLowerNeighbour( currentTime ) ];
+    }
+
     //! List of arc ephemeris objects
     std::vector< std::shared_ptr< Ephemeris > > singleArcEphemerides_;
 
@@ -195,8 +231,8 @@ private:
     //! Times at which the look up changes from one arc to the other.
     std::vector< double > arcSplitTimes_;
 
-    //! Lookup scheme to determine which ephemeris to use.
-    std::shared_ptr< interpolators::HuntingAlgorithmLookupScheme< double > > lookUpscheme_;
+    //! Lookup scheme to determine which ephemeris to use (see createArcLookupScheme).
+    std::shared_ptr< interpolators::LookUpScheme< double > > arcLookupScheme_;
 
 
 };
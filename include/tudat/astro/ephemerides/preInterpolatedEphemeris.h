@@ -0,0 +1,182 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PREINTERPOLATEDEPHEMERIS_H
+#define TUDAT_PREINTERPOLATEDEPHEMERIS_H
+
+#include <memory>
+
+#include "tudat/astro/ephemerides/chebyshevEphemeris.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Class that computes a state from Chebyshev segments, fitted once to an (expensive) ephemeris over a given interval
+/*!
+ *  Class that computes a state from Chebyshev segments (see ChebyshevCartesianEphemeris), fitted once (at construction)
+ *  directly to another ephemeris over a given time interval, such as the ephemeris of a perturbing body over the time
+ *  interval of a propagation. This prevents models such as Spice, approximate planet positions or high-order tabulated
+ *  ephemerides from being evaluated at each state derivative evaluation. Outside of the fitted interval, the state is
+ *  computed directly from the original ephemeris, and the reference frame is that of the original ephemeris. Note that the
+ *  fit is not updated if the original ephemeris is modified afterwards.
+ */
+class PreInterpolatedEphemeris : public Ephemeris
+{
+public:
+
+    using Ephemeris::getCartesianState;
+
+    //! Constructor, fits the Chebyshev segments to the original ephemeris
+    /*!
+     *  Constructor, fits the Chebyshev segments to the original ephemeris
+     *  \param originalEphemeris Ephemeris to which the Chebyshev segments are fitted
+     *  \param startTime Start of the interval on which the ephemeris is fitted
+     *  \param endTime End of the interval on which the ephemeris is fitted
+     *  \param positionTolerance Maximum permitted position error of the fit w.r.t. the original ephemeris
+     *  \param velocityTolerance Maximum permitted velocity error of the fit w.r.t. the original ephemeris
+     *  \param polynomialDegree Degree of the Chebyshev series of each state component in each segment.
+     *  \param minimumSegmentDuration Minimum duration of a segment, at which refinement of the segments is stopped (with
+     *  a warning if the tolerance is not met).
+     */
+    PreInterpolatedEphemeris(
+            const std::shared_ptr< Ephemeris > originalEphemeris,
+            const double startTime,
+            const double endTime,
+            const double positionTolerance = 1.0E-3,
+            const double velocityTolerance = 1.0E-6,
+            const int polynomialDegree = 12,
+            const double minimumSegmentDuration = 60.0 );
+
+    //! Destructor
+    ~PreInterpolatedEphemeris( ){ }
+
+    //! Get cartesian state from ephemeris.
+    /*!
+     * Returns cartesian state from the Chebyshev segments if the epoch is in the fitted interval, and from the original
+     * ephemeris otherwise.
+     * \param secondsSinceEpoch Seconds since epoch.
+     * \return State in Cartesian elements from ephemeris.
+     */
+    Eigen::Vector6d getCartesianState(
+            const double secondsSinceEpoch )
+    {
+        if( isTimeInFittedInterval( secondsSinceEpoch ) )
+        {
+            return chebyshevEphemeris_->getCartesianState( secondsSinceEpoch );
+        }
+        else
+        {
+            return originalEphemeris_->getCartesianState( secondsSinceEpoch );
+        }
+    }
+
+    //! Get cartesian state from ephemeris (with long double as state scalar).
+    /*!
+     * Returns cartesian state (with long double as state scalar) from the Chebyshev segments if the epoch is in the
+     * fitted interval, and from the original ephemeris otherwise.
+     * \param secondsSinceEpoch Seconds since epoch.
+     * \return State in Cartesian elements from ephemeris.
+     */
+    Eigen::Matrix< long double, 6, 1 > getCartesianLongState(
+            const double secondsSinceEpoch )
+    {
+        if( isTimeInFittedInterval( secondsSinceEpoch ) )
+        {
+            return chebyshevEphemeris_->getCartesianState( secondsSinceEpoch ).cast< long double >( );
+        }
+        else
+        {
+            return originalEphemeris_->getCartesianLongState( secondsSinceEpoch );
+        }
+    }
+
+    //! Get cartesian state from ephemeris (with double as state scalar and Time as time type).
+    Eigen::Vector6d getCartesianStateFromExtendedTime(
+            const Time& currentTime )
+    {
+        double secondsSinceEpoch = currentTime.getSeconds< double >( );
+        if( isTimeInFittedInterval( secondsSinceEpoch ) )
+        {
+            return chebyshevEphemeris_->getCartesianState( secondsSinceEpoch );
+        }
+        else
+        {
+            return originalEphemeris_->getCartesianStateFromExtendedTime( currentTime );
+        }
+    }
+
+    //! Get cartesian state from ephemeris (with long double as state scalar and Time as time type).
+    Eigen::Matrix< long double, 6, 1 > getCartesianLongStateFromExtendedTime(
+            const Time& currentTime )
+    {
+        double secondsSinceEpoch = currentTime.getSeconds< double >( );
+        if( isTimeInFittedInterval( secondsSinceEpoch ) )
+        {
+            return chebyshevEphemeris_->getCartesianState( secondsSinceEpoch ).cast< long double >( );
+        }
+        else
+        {
+            return originalEphemeris_->getCartesianLongStateFromExtendedTime( currentTime );
+        }
+    }
+
+    //! Function to check whether the state is computed from the Chebyshev segments over the full given interval
+    bool isIntervalFitted( const double startTime, const double endTime )
+    {
+        return ( startTime >= startTime_ && endTime <= endTime_ );
+    }
+
+    //! Function to retrieve the ephemeris to which the Chebyshev segments are fitted
+    std::shared_ptr< Ephemeris > getOriginalEphemeris( )
+    {
+        return originalEphemeris_;
+    }
+
+    //! Function to retrieve the Chebyshev ephemeris fitted to the original ephemeris
+    std::shared_ptr< ChebyshevCartesianEphemeris > getChebyshevEphemeris( )
+    {
+        return chebyshevEphemeris_;
+    }
+
+    //! Function to retrieve the time interval on which the Chebyshev segments are fitted
+    std::pair< double, double > getFittedInterval( )
+    {
+        return std::make_pair( startTime_, endTime_ );
+    }
+
+private:
+
+    //! Function to check whether the given time is in the fitted interval
+    bool isTimeInFittedInterval( const double timeValue ) const
+    {
+        return ( timeValue >= startTime_ && timeValue <= endTime_ );
+    }
+
+    //! Ephemeris to which the Chebyshev segments are fitted
+    std::shared_ptr< Ephemeris > originalEphemeris_;
+
+    //! Start of the interval on which the Chebyshev segments are fitted
+    double startTime_;
+
+    //! End of the interval on which the Chebyshev segments are fitted
+    double endTime_;
+
+    //! Chebyshev ephemeris fitted to the original ephemeris
+    std::shared_ptr< ChebyshevCartesianEphemeris > chebyshevEphemeris_;
+};
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_PREINTERPOLATEDEPHEMERIS_H
@@ -191,7 +191,8 @@ public:
     RotationalEphemeris( const std::string& baseFrameOrientation = "",
                          const std::string& targetFrameOrientation = "" )
         : baseFrameOrientation_( baseFrameOrientation ),
-          targetFrameOrientation_( targetFrameOrientation )
+          targetFrameOrientation_( targetFrameOrientation ),
+          numberOfModifications_( 0 )
     { }
 
     //! Virtual destructor.
@@ -481,6 +482,24 @@ public:
 
     virtual void resetCurrentTime( ){ }
 
+    //! Function to check whether the rotation depends only on time
+    /*!
+     * Function to check whether the rotation depends only on time, and not on the (propagated) state of any body, so that
+     * it is identical for all evaluations at the same epoch. False by default, overridden by derived classes for which
+     * this holds.
+     * \return True if the rotation depends only on time
+     */
+    virtual bool isTimeDependentOnly( ){ return false; }
+
+    //! Function to retrieve the number of times the properties of the rotation model have been modified
+    /*!
+     * Function to retrieve the number of times the properties of the rotation model (e.g. its rotation rate) have been
+     * modified after creation. Used to determine whether a rotation computed earlier at the same epoch (see
+     * isTimeDependentOnly) may be reused.
+     * \return Number of times the properties of the rotation model have been modified
+     */
+    unsigned int getNumberOfModifications( ){ return numberOfModifications_; }
+
     virtual void setIsBodyInPropagation( const bool isBodyInPropagation )
     { }
 protected:
@@ -497,6 +516,12 @@ protected:
      */
     const std::string targetFrameOrientation_;
 
+    //! Function to register a modification of the properties of the rotation model (see getNumberOfModifications)
+    void registerModification( ){ numberOfModifications_++; }
+
+    //! Number of times the properties of the rotation model have been modified
+    unsigned int numberOfModifications_;
+
 };
 
 //! Function to transform a state from the target to base frame of a rotational ephemeris
@@ -167,7 +167,11 @@ public:
      * Function to reset the rotation rate of the body.
      * \param rotationRate New rotation rate [rad/s].
      */
-    void resetRotationRate( const double rotationRate ) { rotationRate_ = rotationRate; }
+    void resetRotationRate( const double rotationRate )
+    {
+        rotationRate_ = rotationRate;
+        registerModification( );
+    }
 
     //! Function to get vector of euler angles at initialSecondsSinceEpoch_
     /*!
@@ -191,6 +195,9 @@ public:
                                                        const double declination );
 
 
+    //! Function to check whether the rotation depends only on time (true for this class)
+    bool isTimeDependentOnly( ){ return true; }
+
 private:
 
     //! Rotation rate of body (about local z-axis).
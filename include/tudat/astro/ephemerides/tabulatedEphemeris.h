@@ -156,6 +156,12 @@ public:
         return interpolator_;
     }
 
+    //! Function to retrieve the heap memory held by the interpolator of the ephemeris
+    std::size_t getHeapMemorySize( ) const
+    {
+        return ( interpolator_ == nullptr ) ? 0 : interpolator_->getHeapMemorySize( );
+    }
+
     VariableStateInterpolatorPointer getDynamicVectorSizeInterpolator( )
     {
         return interpolators::convertBetweenStaticDynamicEigenTypeInterpolators<
@@ -222,7 +228,8 @@ private:
 //! Function to check whether an ephemeris is a (type of) tabulated ephemeris
 /*!
  *  Function to check whether an ephemeris is a (type of) tabulated ephemeris, it checks all typical combinations of
- *  class template arguments are returns true if a dynamic cast is succesful
+ *  class template arguments are returns true if a dynamic cast is succesful. A ChebyshevCartesianEphemeris (fitted to
+ *  tabulated data) is also considered to be a tabulated ephemeris.
  *  \param ephemeris Ephemeris pointer for which it is to be checked whether it is a tabulated ephemeris
  *  \return True if ephemeris is a tabulated ephemeris
  */
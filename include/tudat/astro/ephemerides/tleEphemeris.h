@@ -12,7 +12,11 @@
 #ifndef TUDAT_TLEEPHEMERIS_H
 #define TUDAT_TLEEPHEMERIS_H
 
+#include <memory>
+#include <vector>
+
 #include "tudat/astro/ephemerides/ephemeris.h"
+#include "tudat/io/twoLineElementData.h"
 
 namespace tudat
 {
@@ -175,6 +179,50 @@ private:
 
 };
 
+//! Function to compute the rotation matrix from the True Equator, Mean Equinox (TEME) frame to a given frame.
+/*!
+ * Function to compute the rotation matrix from the True Equator, Mean Equinox (TEME) frame, in which the states are
+ * obtained from the SGP4/SDP4 propagators, to the J2000 or ECLIPJ2000 frame. The rotation is performed through the True Of
+ * Date frame, using the equation of the equinoxes and the 1976/1980 precession-nutation model.
+ * \param secondsSinceEpoch Seconds since J2000 epoch at which the rotation is to be computed.
+ * \param targetFrameOrientation Orientation of the target frame (J2000 or ECLIPJ2000).
+ * \return Rotation matrix from TEME to target frame.
+ */
+Eigen::Matrix3d getRotationMatrixFromTemeFrame( const double secondsSinceEpoch, const std::string& targetFrameOrientation );
+
+//! Function to create TLE objects from the data read from a two-line elements file.
+/*!
+ * Function to create TLE objects from the data read from a two-line elements file (e.g. a full catalogue), using the TLE
+ * line strings stored in each TwoLineElementData object.
+ * \param twoLineElementData Data of each object, as read by the TwoLineElementsTextFileReader.
+ * \return TLE objects, in the same order as the input.
+ */
+std::vector< std::shared_ptr< Tle > > createTlesFromTwoLineElementData(
+        const std::vector< input_output::TwoLineElementData >& twoLineElementData );
+
+//! Function to propagate a catalogue of TLEs to a common grid of epochs.
+/*!
+ * Function to propagate a catalogue of TLEs to a common grid of epochs, providing the same result as the
+ * getCartesianState function of a TleEphemeris for each TLE and epoch (to within numerical round-off).
+ * The rotation from the TEME frame to the target frame, which only depends on the epoch, is computed only once for each
+ * epoch (distributed over the threads), and applied to the states of all objects at that epoch at once. The SGP4
+ * propagation is performed for all epochs of a single object in a single Spice call sequence, with the objects
+ * distributed over the threads. Note that, since CSPICE is not thread-safe, the SGP4 propagations themselves are
+ * serialized. As for the TleEphemeris class, only the near-Earth SGP4 model is supported.
+ * \param tles TLE objects that are to be propagated.
+ * \param epochs Epochs (in seconds since J2000) at which the states are to be computed.
+ * \param referenceFrameOrientation Orientation of the target frame (J2000 or ECLIPJ2000). The states are always
+ * Earth-centered.
+ * \param numberOfThreads Number of threads over which the computations are distributed
+ * \return Cartesian states, stored contiguously per epoch: the state of object j at epoch i is stored in column
+ * i * tles.size( ) + j.
+ */
+Eigen::Matrix< double, 6, Eigen::Dynamic > propagateTleCatalogue(
+        const std::vector< std::shared_ptr< Tle > >& tles,
+        const std::vector< double >& epochs,
+        const std::string& referenceFrameOrientation = "J2000",
+        const int numberOfThreads = 1 );
+
 }
 }
 #endif //TUDAT_TLEEPHEMERIS_H
@@ -28,6 +28,7 @@
 #include "gravitation/sphericalHarmonicsGravityModel.h"
 #include "gravitation/sphericalHarmonicsGravityModelBase.h"
 #include "gravitation/polyhedronGravityField.h"
+#include "gravitation/hybridPolyhedronGravityField.h"
 #include "gravitation/polyhedronGravityModel.h"
 #include "gravitation/ringGravityField.h"
 #include "gravitation/ringGravityModel.h"
@@ -159,6 +159,18 @@ public:
                     maximumDegree_ - minimumDegree_ + 1, maximumOrder_ - minimumOrder_ + 1 );
         currentSineCorrections_ = Eigen::MatrixXd::Zero(
                     maximumDegree_ - minimumDegree_ + 1, maximumOrder_ - minimumOrder_ + 1 );
+
+        // Precompute normalization factors, and allocate storage for tidal phase factors of each order.
+        geodesyNormalizationFactors_ = Eigen::MatrixXd::Zero( maximumDegree_ + 1, maximumOrder_ + 1 );
+        for( int n = minimumDegree_; n <= maximumDegree_; n++ )
+        {
+            for( int m = 0; ( m <= n && m <= maximumOrder_ ); m++ )
+            {
+                geodesyNormalizationFactors_( n, m ) =
+                        basic_mathematics::calculateLegendreGeodesyNormalizationFactor( n, m );
+            }
+        }
+        tidePhaseFactors_.resize( maximumOrder_ + 1 );
     }
 
     //! Destructor
@@ -188,6 +200,18 @@ public:
         return calculateBasicSphericalHarmonicsCorrections( time );
     }
 
+    //! Derived function for calculating spherical harmonic coefficient corrections into existing matrices.
+    /*!
+     *  Derived function for calculating spherical harmonic coefficient corrections into existing matrices.
+     *  \param time Time at which variations are to be calculated.
+     *  \param cosineCorrections Variations in cosine coefficients (returned by reference).
+     *  \param sineCorrections Variations in sine coefficients (returned by reference).
+     */
+    virtual void calculateSphericalHarmonicsCorrectionBlocks(
+            const double time,
+            Eigen::MatrixXd& cosineCorrections,
+            Eigen::MatrixXd& sineCorrections );
+
     //! Function to retrieve the love numbers at given degree.
     /*!
      *  Function to retrieve the love numbers at given degree. Returns a vector containing (complex)
@@ -394,6 +418,8 @@ protected:
     //! Sets current properties (mass state) of body causing tidal deformation.
     /*!
      *  Sets current properties (mass state) of body causing tidal deformation.
+     * The geometry of the body (distance ratio, latitude and tidal phase factors of each order) is computed once, and
+     * shared by the corrections at all degrees.
      * \param bodyIndex Index of body causing deformation for which data is to be retrieved.
      * Deformed body is also updated to bodyIndex = 0.
      * \param evaluationTime Time at which properties are to be evaluated.
@@ -535,6 +561,12 @@ protected:
     //! Tidal corrections to sine coefficients at current calculation step.
     Eigen::MatrixXd currentSineCorrections_;
 
+    //! Geodesy normalization factors (row index degree, column index order) of all corrected coefficients.
+    Eigen::MatrixXd geodesyNormalizationFactors_;
+
+    //! Factors exp( -i m longitude ) of currently considered body, for each order m (shared by all degrees).
+    std::vector< std::complex< double > > tidePhaseFactors_;
+
 };
 
 } // namespace gravitation
@@ -154,6 +154,12 @@ public:
         numberOfOrders_ = maximumOrder_ - minimumOrder_ + 1;
         lastCosineCorrection_.setZero( maximumDegree_ + 1, maximumOrder_ + 1 );
         lastSineCorrection_.setZero( maximumDegree_ + 1, maximumOrder_ + 1 );
+
+        if( numberOfDegrees_ > 0 && numberOfOrders_ > 0 )
+        {
+            cosineCorrectionBlock_.setZero( numberOfDegrees_, numberOfOrders_ );
+            sineCorrectionBlock_.setZero( numberOfDegrees_, numberOfOrders_ );
+        }
     }
 
     //! Virtual destructor
@@ -173,11 +179,33 @@ public:
     virtual std::pair< Eigen::MatrixXd, Eigen::MatrixXd > calculateSphericalHarmonicsCorrections(
             const double time ) = 0;
 
+    //! Function for calculating corrections into existing matrices.
+    /*!
+     *  Function for calculating corrections at given time into existing matrices, which are overwritten. If the
+     *  matrices already have the size of the correction block (numberOfDegrees_ x numberOfOrders_), no memory is
+     *  allocated by derived classes that override this function. The default implementation copies the output of
+     *  calculateSphericalHarmonicsCorrections.
+     *  \param time Time at which variations are to be calculated.
+     *  \param cosineCorrections Variations in cosine coefficients at block position in total matrices defined by
+     *  minimumDegree_, minimumOrder_, numberOfDegrees_, numberOfOrders_ (returned by reference).
+     *  \param sineCorrections Variations in sine coefficients at same block position (returned by reference).
+     */
+    virtual void calculateSphericalHarmonicsCorrectionBlocks(
+            const double time,
+            Eigen::MatrixXd& cosineCorrections,
+            Eigen::MatrixXd& sineCorrections )
+    {
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > correctionPair =
+                calculateSphericalHarmonicsCorrections( time );
+        cosineCorrections = correctionPair.first;
+        sineCorrections = correctionPair.second;
+    }
+
     //! Function to add sine and cosine corrections at given time to coefficient matrices.
     /*!
      *  Function to add sine and cosine corrections at given time to coefficient matrices.
      *  The current sine and cosine matrices are passed by reference, the corrections are calculated
-     *  internally and added to them.
+     *  internally (into preallocated blocks, see calculateSphericalHarmonicsCorrectionBlocks) and added to them.
      *  \param time Time at which corrections are to be evaluated.
      *  \param sineCoefficients Current spherical harmonic sine coefficients, calculated
      *  corrections are added and returned by reference
@@ -306,6 +334,12 @@ protected:
 
     //! Latest correction to sine coefficients, as computed by last call to addSphericalHarmonicsCorrections
     Eigen::MatrixXd lastSineCorrection_;
+
+    //! Preallocated block into which the cosine corrections are computed by addSphericalHarmonicsCorrections
+    Eigen::MatrixXd cosineCorrectionBlock_;
+
+    //! Preallocated block into which the sine corrections are computed by addSphericalHarmonicsCorrections
+    Eigen::MatrixXd sineCorrectionBlock_;
 };
 
 //! Function to create a function linearly interpolating the sine and cosine correction coefficients
@@ -406,6 +440,15 @@ public:
     std::vector< std::function< void( const double, Eigen::MatrixXd&, Eigen::MatrixXd& ) > >
     getVariationFunctions( );
 
+    //! Function to determine whether the variation functions depend only on time
+    /*!
+     * Function to determine whether the variation functions (see getVariationFunctions) depend only on time, and not on
+     * the states of bodies or on estimated parameters, so that they need not be recomputed when called repeatedly at the
+     * same time. This is the case for periodic and tabulated variations, and for any variation that is interpolated.
+     * \return True if all variation functions depend only on time
+     */
+    bool areVariationsTimeDependentOnly( );
+
     //! Function to retrieve the complete set of variations to take nto account.
     /*!
      * Function to retrieve the complete set of variations to take nto account.
@@ -0,0 +1,165 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References:
+ *      Werner, R.A. (1997), "Spherical harmonic coefficients for the potential of a constant-density polyhedron",
+ *          Computers & Geosciences, 23(10), 1071-1077
+ */
+
+#ifndef TUDAT_HYBRIDPOLYHEDRONGRAVITYFIELD_H
+#define TUDAT_HYBRIDPOLYHEDRONGRAVITYFIELD_H
+
+#include <memory>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/gravitation/polyhedronGravityField.h"
+#include "tudat/astro/gravitation/sphericalHarmonicsGravityField.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+/*! Function to compute the weight of the far-field model in the blending region of a hybrid gravity model.
+ *
+ * Function to compute the weight of the far-field (spherical harmonic) model in the blending region of a hybrid
+ * polyhedron/spherical harmonic gravity model, and its derivative w.r.t. the distance. The weight is 0 inside the
+ * inner switch distance, 1 outside the outer switch distance, and is a cubic (smoothstep) function of the distance in
+ * between, so that the blended acceleration is continuously differentiable.
+ * @param distance Distance from the origin of the body-fixed frame.
+ * @param innerSwitchDistance Distance at which the blending region starts.
+ * @param outerSwitchDistance Distance at which the blending region ends.
+ * @param weight Weight of far-field model (returned by reference).
+ * @param weightDerivative Derivative of weight w.r.t. distance (returned by reference).
+ */
+inline void computeHybridGravityFieldBlendingWeight(
+        const double distance,
+        const double innerSwitchDistance,
+        const double outerSwitchDistance,
+        double& weight,
+        double& weightDerivative )
+{
+    if( distance <= innerSwitchDistance )
+    {
+        weight = 0.0;
+        weightDerivative = 0.0;
+    }
+    else if( distance >= outerSwitchDistance )
+    {
+        weight = 1.0;
+        weightDerivative = 0.0;
+    }
+    else
+    {
+        const double blendingWidth = outerSwitchDistance - innerSwitchDistance;
+        const double normalizedDistance = ( distance - innerSwitchDistance ) / blendingWidth;
+        weight = normalizedDistance * normalizedDistance * ( 3.0 - 2.0 * normalizedDistance );
+        weightDerivative = 6.0 * normalizedDistance * ( 1.0 - normalizedDistance ) / blendingWidth;
+    }
+}
+
+//! Class to represent the gravity field of a constant density polyhedron, with a spherical harmonic far field.
+/*!
+ * Class to represent the gravity field of a constant density polyhedron, which uses a (low-degree) spherical harmonic
+ * expansion of the polyhedron's gravity field at large distances, where it is accurate and orders of magnitude cheaper to
+ * evaluate than the polyhedron. The spherical harmonic coefficients are computed once upon construction (see
+ * basic_astrodynamics::computePolyhedronSphericalHarmonicCoefficients), with the radius of the Brillouin sphere as
+ * reference radius. Inside the inner switch distance the polyhedron is used, outside the outer switch distance the
+ * spherical harmonic expansion; in between, the two are blended with a smooth weight (see
+ * computeHybridGravityFieldBlendingWeight). Since the class derives from PolyhedronGravityField, the polyhedron
+ * acceleration models that are created for it use the same switching (see
+ * PolyhedronGravitationalAccelerationModel::setFarFieldAccelerationModel).
+ */
+class HybridPolyhedronGravityField: public PolyhedronGravityField
+{
+public:
+
+    /*! Constructor.
+     *
+     * Constructor.
+     * @param gravitationalParameter Gravitational parameter of the polyhedron.
+     * @param verticesCoordinates Cartesian coordinates of each vertex (one row per vertex, 3 columns).
+     * @param verticesDefiningEachFacet Index (0 based) of the vertices constituting each facet (one row per facet, 3 columns).
+     * @param maximumDegree Maximum degree (and order) of the spherical harmonic far-field expansion.
+     * @param innerSwitchDistance Distance at which the blending from polyhedron to spherical harmonic model starts. Must
+     * be larger than the radius of the Brillouin sphere, outside which the expansion converges.
+     * @param outerSwitchDistance Distance at which the blending from polyhedron to spherical harmonic model ends (equal to
+     * innerSwitchDistance for a discontinuous switch).
+     * @param fixedReferenceFrame Identifier for body-fixed reference frame to which the field is fixed (optional).
+     * @param updateInertiaTensor Function that is to be called to update the inertia tensor (typicaly in Body class;
+     * default empty)
+     */
+    HybridPolyhedronGravityField(
+            const double gravitationalParameter,
+            const Eigen::MatrixXd& verticesCoordinates,
+            const Eigen::MatrixXi& verticesDefiningEachFacet,
+            const int maximumDegree,
+            const double innerSwitchDistance,
+            const double outerSwitchDistance,
+            const std::string& fixedReferenceFrame = "",
+            const std::function< void( ) > updateInertiaTensor = std::function< void( ) > ( ) );
+
+    /*! Function to calculate the gravitational potential.
+     *
+     * Function to calculate the gravitational potential, blended between polyhedron and spherical harmonic model.
+     * @param bodyFixedPosition Position of point at which potential is to be calculated, in body-fixed frame.
+     * @return Gravitational potential.
+     */
+    double getGravitationalPotential( const Eigen::Vector3d& bodyFixedPosition );
+
+    /*! Function to calculate the gradient of the gravitational potential (i.e. the acceleration).
+     *
+     * Function to calculate the gradient of the gravitational potential (i.e. the acceleration), blended between
+     * polyhedron and spherical harmonic model.
+     * @param bodyFixedPosition Position of point at which potential is to be calculated, in body-fixed frame.
+     * @return Gradient of the gravitational potential.
+     */
+    Eigen::Vector3d getGradientOfPotential( const Eigen::Vector3d& bodyFixedPosition );
+
+    /*! Function to calculate the laplacian of the gravitational potential.
+     *
+     * Function to calculate the laplacian of the gravitational potential, blended between polyhedron and spherical
+     * harmonic model (for which it is zero, as the expansion is only valid outside the body).
+     * @param bodyFixedPosition Position of point at which potential is to be calculated, in body-fixed frame.
+     * @return Laplacian of the gravitational potential.
+     */
+    double getLaplacianOfPotential( const Eigen::Vector3d& bodyFixedPosition );
+
+    //! Function to retrieve the spherical harmonic far-field model.
+    std::shared_ptr< SphericalHarmonicsGravityField > getFarFieldGravityField( )
+    { return farFieldGravityField_; }
+
+    //! Function to retrieve the distance at which the blending from polyhedron to spherical harmonic model starts.
+    double getInnerSwitchDistance( )
+    { return innerSwitchDistance_; }
+
+    //! Function to retrieve the distance at which the blending from polyhedron to spherical harmonic model ends.
+    double getOuterSwitchDistance( )
+    { return outerSwitchDistance_; }
+
+private:
+
+    //! Spherical harmonic expansion of polyhedron gravity field, used in the far field.
+    std::shared_ptr< SphericalHarmonicsGravityField > farFieldGravityField_;
+
+    //! Distance at which the blending from polyhedron to spherical harmonic model starts.
+    double innerSwitchDistance_;
+
+    //! Distance at which the blending from polyhedron to spherical harmonic model ends.
+    double outerSwitchDistance_;
+
+};
+
+} // namespace gravitation
+
+} // namespace tudat
+
+#endif //TUDAT_HYBRIDPOLYHEDRONGRAVITYFIELD_H
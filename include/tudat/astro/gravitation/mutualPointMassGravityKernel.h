@@ -0,0 +1,159 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_MUTUALPOINTMASSGRAVITYKERNEL_H
+#define TUDAT_MUTUALPOINTMASSGRAVITYKERNEL_H
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/basics/parallelization.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Class to compute the point-mass gravitational accelerations between all pairs of a set of bodies in a single evaluation
+/*!
+ *  Class to compute the point-mass gravitational accelerations between all pairs of a set of bodies in a single
+ *  evaluation, as a replacement of a set of CentralGravitationalAccelerationModel3d objects (one per pair and direction)
+ *  between mutually propagated bodies (see NBodyStateDerivative::useMutualPointMassGravityKernel). The positions and
+ *  gravitational parameters are retrieved once per body per update, and stored in a structure-of-arrays layout. For a
+ *  serial update, the relative position and inverse cube of the distance of each pair are computed once, and used for the
+ *  accelerations of both bodies. For a parallel update, the accelerations of each body are computed by a separate task
+ *  (computing each pair twice, but without concurrent writes). In both cases, the inner loop runs over contiguous arrays,
+ *  such that it can be vectorized by the compiler. An interaction mask defines which of the pairs are included, so that
+ *  sets of accelerations that are not fully symmetric are also supported.
+ */
+class MutualPointMassGravityKernel
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param positionFunctions Functions returning the (inertial) position of each body
+     *  \param gravitationalParameterFunctions Functions returning the gravitational parameter of each body (may be empty
+     *  for bodies that exert no acceleration in the set)
+     *  \param interactionMask Matrix defining the accelerations that are included, with entry (i,j) true if the
+     *  acceleration exerted by body j on body i is included (diagonal must be false)
+     */
+    MutualPointMassGravityKernel(
+            const std::vector< std::function< void( Eigen::Vector3d& ) > >& positionFunctions,
+            const std::vector< std::function< double( ) > >& gravitationalParameterFunctions,
+            const Eigen::Matrix< bool, Eigen::Dynamic, Eigen::Dynamic >& interactionMask );
+
+    //! Function to update the accelerations of all bodies to the current time
+    /*!
+     *  Function to update the accelerations of all bodies to the current time, retrieving the current positions and
+     *  gravitational parameters. If the current time is equal to that of the previous update, no computations are performed.
+     *  \param currentTime Time to which the accelerations are to be updated
+     *  \param parallelTaskPool Pool of threads over which the computation is distributed (nullptr for serial update)
+     */
+    void update( const double currentTime,
+                 const std::shared_ptr< utilities::ParallelTaskPool > parallelTaskPool = nullptr );
+
+    //! Function to reset the current time, so that the accelerations are recomputed at the next update
+    void resetCurrentTime( )
+    {
+        currentTime_ = TUDAT_NAN;
+    }
+
+    //! Function to retrieve the number of bodies in the set
+    int getNumberOfBodies( ) const
+    {
+        return numberOfBodies_;
+    }
+
+    //! Function to retrieve the number of accelerations (body pairs, per direction) that are included
+    int getNumberOfInteractions( ) const
+    {
+        return numberOfInteractions_;
+    }
+
+    //! Function to retrieve the total acceleration of a single body, exerted by the other bodies in the set
+    /*!
+     *  Function to retrieve the total acceleration of a single body, exerted by the other bodies in the set, as computed by
+     *  the last call to update
+     *  \param bodyIndex Index of the body in the set
+     *  \return Total acceleration of the body
+     */
+    Eigen::Vector3d getAcceleration( const int bodyIndex ) const
+    {
+        return Eigen::Vector3d( accelerationsX_( bodyIndex ), accelerationsY_( bodyIndex ), accelerationsZ_( bodyIndex ) );
+    }
+
+private:
+
+    //! Function to compute the accelerations of all bodies, evaluating each pair once
+    void computeSymmetricAccelerations( );
+
+    //! Function to compute the accelerations of a range of bodies, evaluating all pairs each body is part of
+    /*!
+     *  Function to compute the accelerations of a range of bodies, evaluating all pairs each body is part of
+     *  \param firstBodyIndex Index of first body for which the acceleration is to be computed
+     *  \param numberOfBodiesInRange Number of bodies for which the acceleration is to be computed
+     *  \param scratchArrays Pre-allocated arrays (numberOfBodies_ x 4) used in the computation
+     */
+    void computeAccelerationsOfBodies( const int firstBodyIndex, const int numberOfBodiesInRange,
+                                       Eigen::ArrayXXd& scratchArrays );
+
+    //! Function to add the contributions of a contiguous range of bodies to the acceleration of a single body
+    void addAccelerationContributions( const int bodyIndex, const int firstExertingBodyIndex,
+                                       const int numberOfExertingBodies, Eigen::ArrayXXd& scratchArrays );
+
+    //! Functions returning the (inertial) position of each body
+    std::vector< std::function< void( Eigen::Vector3d& ) > > positionFunctions_;
+
+    //! Functions returning the gravitational parameter of each body
+    std::vector< std::function< double( ) > > gravitationalParameterFunctions_;
+
+    //! Number of bodies in the set
+    int numberOfBodies_;
+
+    //! Number of accelerations that are included
+    int numberOfInteractions_;
+
+    //! Interaction mask, with entry (i,j) equal to 1.0 if the acceleration of j on i is included (0.0 otherwise)
+    Eigen::Array< double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > interactionMask_;
+
+    //! Transpose of interactionMask_ (stored separately, so that both are accessed contiguously)
+    Eigen::Array< double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > transposedInteractionMask_;
+
+    //! Current Cartesian components of the positions of the bodies
+    Eigen::ArrayXd positionsX_, positionsY_, positionsZ_;
+
+    //! Current gravitational parameters of the bodies
+    Eigen::ArrayXd gravitationalParameters_;
+
+    //! Current Cartesian components of the total accelerations of the bodies
+    Eigen::ArrayXd accelerationsX_, accelerationsY_, accelerationsZ_;
+
+    //! Pre-allocated arrays used in the computation (one entry per task for a parallel update)
+    std::vector< Eigen::ArrayXXd > scratchArrays_;
+
+    //! Pre-allocated vector to which the position of a body is retrieved
+    Eigen::Vector3d currentPosition_;
+
+    //! Time of the last update
+    double currentTime_;
+};
+
+} // namespace gravitation
+
+} // namespace tudat
+
+#endif // TUDAT_MUTUALPOINTMASSGRAVITYKERNEL_H
@@ -26,6 +26,7 @@
 #include "tudat/astro/gravitation/sphericalHarmonicsGravityModel.h"
 #include "tudat/math/basic/legendrePolynomials.h"
 #include "tudat/basics/basicTypedefs.h"
+#include "tudat/basics/parallelization.h"
 
 
 
@@ -155,6 +156,9 @@ public:
                     positionOfBodySubjectToAccelerationFunction,
                     toLocalFrameOfBodyUndergoingAccelerationTransformation,
                     useCentralBodyFixedFrame, sphericalHarmonicsCacheOfBodyUndergoingAcceleration );
+
+        sphericalHarmonicsCachesAreShared_ =
+                ( sphericalHarmonicsCacheOfBodyExertingAcceleration == sphericalHarmonicsCacheOfBodyUndergoingAcceleration );
     }
 
     //! Update member variables used by the acceleration model.
@@ -163,8 +167,21 @@ public:
      */
     virtual void updateMembers( const double currentTime = TUDAT_NAN )
     {
-        accelerationModelFromShExpansionOfBodyExertingAcceleration_->updateMembers( currentTime );
-        accelerationModelFromShExpansionOfBodyUndergoingAcceleration_->updateMembers( currentTime );
+        if( threadPool_ != nullptr )
+        {
+            // Update the two constituent models concurrently; they only share read-only environment functions
+            threadPool_->executeTasks( 2, [ & ]( const int modelIndex )
+            {
+                ( modelIndex == 0 ? accelerationModelFromShExpansionOfBodyExertingAcceleration_ :
+                                    accelerationModelFromShExpansionOfBodyUndergoingAcceleration_ )->
+                        updateMembers( currentTime );
+            } );
+        }
+        else
+        {
+            accelerationModelFromShExpansionOfBodyExertingAcceleration_->updateMembers( currentTime );
+            accelerationModelFromShExpansionOfBodyUndergoingAcceleration_->updateMembers( currentTime );
+        }
 
         this->currentTime_ = currentTime;
         this->currentAcceleration_ = accelerationModelFromShExpansionOfBodyExertingAcceleration_->getAcceleration( ) -
@@ -184,6 +201,23 @@ public:
         accelerationModelFromShExpansionOfBodyUndergoingAcceleration_->resetCurrentTime( );
     }
 
+    //! Function to set the number of threads over which the computation of the acceleration is distributed.
+    /*!
+     *  Function to set the number of threads over which the computation of the acceleration is distributed. For more than
+     *  one thread, the spherical harmonic accelerations due to the expansions of the two bodies are computed concurrently
+     *  (so that at most two threads are used). This is only beneficial for high-degree expansions, for which the summation
+     *  is much more expensive than the synchronization of the threads. The two bodies must use different spherical harmonic
+     *  caches.
+     *  \param numberOfThreads Number of threads (must be at least 1).
+     */
+    void setNumberOfThreads( const int numberOfThreads );
+
+    //! Function to retrieve the number of threads over which the computation of the acceleration is distributed.
+    int getNumberOfThreads( )
+    {
+        return numberOfThreads_;
+    }
+
     //! Function returning whether the acceleration is expressed in a frame centered on the body exerting the acceleration.
     /*!
      *  Function returning whether the acceleration is expressed in a frame centered on the body exerting the acceleration.
@@ -253,6 +287,14 @@ protected:
     std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel >
         accelerationModelFromShExpansionOfBodyUndergoingAcceleration_;
 
+    //! Boolean denoting whether the two constituent models use the same spherical harmonics cache.
+    bool sphericalHarmonicsCachesAreShared_;
+
+    //! Number of threads over which the computation of the acceleration is distributed.
+    int numberOfThreads_ = 1;
+
+    //! Pool of threads used to compute the two constituent accelerations concurrently (nullptr if single-threaded).
+    std::shared_ptr< utilities::ParallelTaskPool > threadPool_;
 
 };
 
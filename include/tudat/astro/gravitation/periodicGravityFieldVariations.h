@@ -38,6 +38,11 @@ public:
     std::pair< Eigen::MatrixXd, Eigen::MatrixXd > calculateSphericalHarmonicsCorrections(
             const double time );
 
+    void calculateSphericalHarmonicsCorrectionBlocks(
+            const double time,
+            Eigen::MatrixXd& cosineCorrections,
+            Eigen::MatrixXd& sineCorrections );
+
 
 protected:
 
@@ -26,7 +26,9 @@
 #include "tudat/astro/gravitation/gravityFieldModel.h"
 #include "tudat/astro/basic_astro/physicalConstants.h"
 #include "tudat/astro/basic_astro/polyhedronFuntions.h"
+#include "tudat/astro/basic_astro/polyhedronPreprocessing.h"
 #include "tudat/math/basic/polyhedron.h"
+#include "tudat/basics/parallelization.h"
 
 namespace tudat
 {
@@ -35,6 +37,15 @@ namespace gravitation
 {
 
 //! Cache object in which variables that are required for the computation of polyhedron gravity field are stored.
+/*!
+ * Cache object in which variables that are required for the computation of polyhedron gravity field are stored. If the
+ * facet and edge dyads are provided upon construction, they are stored as contiguous fixed-size arrays (one array per
+ * unique entry of the symmetric dyads, see Werner and Scheeres, 1997), and the update function computes the per-facet
+ * and per-edge sums for the potential, its gradient and its laplacian in the same pass over the facets and edges as the
+ * per-facet and per-edge factors. The facets and edges are processed in blocks of fixed size, which may be distributed
+ * over a number of threads. Since the partial sums of the blocks are added in a fixed order, the results do not depend
+ * on the number of threads.
+ */
 class PolyhedronGravityCache
 {
 public:
@@ -48,17 +59,18 @@ public:
      * row contains 3 indices, which must be provided in counterclockwise order when seen from outise the polyhedron.
      * @param verticesDefiningEachEdge Matrix with the indices (0 indexed) of the vertices defining each facet. Each
      * row contains 2 indices.
+     * @param facetDyads Vector with the facet dyad of each facet. If empty (default), only the per-facet and per-edge
+     * factors are computed by the update function.
+     * @param edgeDyads Vector with the edge dyad of each edge (must be provided if facetDyads is provided).
+     * @param numberOfThreads Number of threads over which the computations are distributed (default 1).
      */
     PolyhedronGravityCache(
             const Eigen::MatrixXd& verticesCoordinates,
             const Eigen::MatrixXi& verticesDefiningEachFacet,
-            const Eigen::MatrixXi& verticesDefiningEachEdge)
-            : verticesCoordinates_( verticesCoordinates ),
-              verticesDefiningEachFacet_( verticesDefiningEachFacet ),
-              verticesDefiningEachEdge_( verticesDefiningEachEdge )
-    {
-        currentBodyFixedPosition_ = (Eigen::Vector3d() << TUDAT_NAN, TUDAT_NAN, TUDAT_NAN).finished();
-    }
+            const Eigen::MatrixXi& verticesDefiningEachEdge,
+            const std::vector< Eigen::MatrixXd >& facetDyads = std::vector< Eigen::MatrixXd >( ),
+            const std::vector< Eigen::MatrixXd >& edgeDyads = std::vector< Eigen::MatrixXd >( ),
+            const int numberOfThreads = 1 );
 
     /*! Update cached variables to current state.
      *
@@ -91,11 +103,86 @@ public:
     Eigen::VectorXd& getPerEdgeFactor ( )
     { return currentPerEdgeFactor_; }
 
+    /*! Function to retrieve the gravitational potential at the current position.
+     *
+     * Function to retrieve the gravitational potential at the current position, according to Eq. 10 of Werner and
+     * Scheeres (1997), from the sums computed by the last call to the update function. Requires the dyads to be provided
+     * upon construction.
+     * @param gravitationalConstantTimesDensity Product of the gravitational constant and density.
+     * @return Gravitational potential.
+     */
+    double getGravitationalPotential( const double gravitationalConstantTimesDensity );
+
+    /*! Function to retrieve the gradient of the gravitational potential at the current position.
+     *
+     * Function to retrieve the gradient of the gravitational potential at the current position, according to Eq. 15 of
+     * Werner and Scheeres (1997), from the sums computed by the last call to the update function. Requires the dyads to
+     * be provided upon construction.
+     * @param gravitationalConstantTimesDensity Product of the gravitational constant and density.
+     * @return Gradient of gravitational potential.
+     */
+    Eigen::Vector3d getGradientOfPotential( const double gravitationalConstantTimesDensity );
+
+    /*! Function to compute the Hessian matrix of the gravitational potential at the current position.
+     *
+     * Function to compute the Hessian matrix of the gravitational potential at the current position, according to
+     * Eq. 16 of Werner and Scheeres (1997), from the per-facet and per-edge factors computed by the last call to the
+     * update function. Requires the dyads to be provided upon construction.
+     * @param gravitationalConstantTimesDensity Product of the gravitational constant and density.
+     * @return Hessian matrix of the potential.
+     */
+    Eigen::Matrix3d getHessianOfPotential( const double gravitationalConstantTimesDensity );
+
+    /*! Function to retrieve the laplacian of the gravitational potential at the current position.
+     *
+     * Function to retrieve the laplacian of the gravitational potential at the current position, according to Eq. 17 of
+     * Werner and Scheeres (1997), from the sum computed by the last call to the update function.
+     * @param gravitationalConstantTimesDensity Product of the gravitational constant and density.
+     * @return Laplacian of the gravitational potential
+     */
+    double getLaplacianOfPotential( const double gravitationalConstantTimesDensity )
+    { return - gravitationalConstantTimesDensity * currentPerFacetFactorSum_; }
+
+    /*! Function to set the number of threads over which the computations are distributed.
+     *
+     * Function to set the number of threads over which the computations are distributed.
+     * @param numberOfThreads Number of threads (must be at least 1).
+     */
+    void setNumberOfThreads( const int numberOfThreads );
+
+    //! Function to retrieve the number of threads over which the computations are distributed.
+    int getNumberOfThreads( )
+    { return numberOfThreads_; }
 
 protected:
 
 private:
 
+    //! Partial sums over a single block of facets or edges.
+    struct PolyhedronBlockSums
+    {
+        //! Sum of the gradient terms (dyad times vector to facet/edge times factor).
+        Eigen::Vector3d gradientSum;
+
+        //! Sum of the potential terms (vector to facet/edge times dyad times the same vector times factor).
+        double potentialSum;
+
+        //! Sum of the factors.
+        double factorSum;
+    };
+
+    //! Function to compute the per-facet factors (and if required the per-facet sums) of a single block of facets.
+    void updateFacetBlock( const int block );
+
+    //! Function to compute the per-edge factors (and if required the per-edge sums) of a single block of edges.
+    void updateEdgeBlock( const int block );
+
+    //! Function to check whether the dyads were provided upon construction (throws error if not).
+    void checkDyadsAreAvailable( const std::string& quantity );
+
+    //! Function to execute a set of independent tasks, on the thread pool if more than one thread is used.
+    void executeTasks( const int numberOfTasks, const std::function< void( const int ) >& taskFunction );
+
     // Current body fixed position.
     Eigen::Vector3d currentBodyFixedPosition_;
 
@@ -108,6 +195,27 @@ private:
     // Matrix with the indices (0 indexed) of the vertices defining each facet.
     const Eigen::MatrixXi verticesDefiningEachEdge_;
 
+    // Boolean denoting whether the dyads were provided, and the per-facet and per-edge sums are computed.
+    bool computeSums_;
+
+    // Unique entries (xx, xy, xz, yy, yz, zz) of the facet dyads, with one row per facet.
+    Eigen::Matrix< double, Eigen::Dynamic, 6 > facetDyadEntries_;
+
+    // Unique entries (xx, xy, xz, yy, yz, zz) of the edge dyads, with one row per edge.
+    Eigen::Matrix< double, Eigen::Dynamic, 6 > edgeDyadEntries_;
+
+    // Number of blocks in which the facets are processed.
+    int numberOfFacetBlocks_;
+
+    // Number of blocks in which the edges are processed.
+    int numberOfEdgeBlocks_;
+
+    // Number of threads over which the computations are distributed.
+    int numberOfThreads_;
+
+    // Pool of worker threads (only created if more than one thread is used).
+    std::shared_ptr< utilities::ParallelTaskPool > threadPool_;
+
     // Current vertices coordinates wrt body fixed position.
     Eigen::MatrixXd currentVerticesCoordinatesRelativeToFieldPoint_;
 
@@ -116,6 +224,30 @@ private:
 
     // Current value of the per-edge factors.
     Eigen::VectorXd currentPerEdgeFactor_;
+
+    // Current partial sums of each block of facets.
+    std::vector< PolyhedronBlockSums > currentFacetBlockSums_;
+
+    // Current partial sums of each block of edges.
+    std::vector< PolyhedronBlockSums > currentEdgeBlockSums_;
+
+    // Current partial Hessian sums of each block of facets and edges (facet blocks first).
+    std::vector< Eigen::Matrix3d > currentBlockHessianSums_;
+
+    // Current sum of the per-facet gradient terms.
+    Eigen::Vector3d currentPerFacetGradientSum_;
+
+    // Current sum of the per-edge gradient terms.
+    Eigen::Vector3d currentPerEdgeGradientSum_;
+
+    // Current sum of the per-facet potential terms.
+    double currentPerFacetPotentialSum_;
+
+    // Current sum of the per-edge potential terms.
+    double currentPerEdgePotentialSum_;
+
+    // Current sum of the per-facet factors.
+    double currentPerFacetFactorSum_;
 };
 
 
@@ -154,18 +286,14 @@ public:
         volume_ = basic_astrodynamics::computePolyhedronVolume( verticesCoordinates, verticesDefiningEachFacet );
         density_ = gravitationalParameter_ / physical_constants::GRAVITATIONAL_CONSTANT / volume_;
 
-        // Compute edges in polyhedron
-        computeVerticesAndFacetsDefiningEachEdge();
-
-        // Compute facet dyads
-        computeFacetNormalsAndDyads();
-
-        // Compute edge dyads
-        computeEdgeDyads();
+        // Retrieve edges, facet dyads and edge dyads of polyhedron (shared with other models of the same polyhedron)
+        preprocessedData_ = basic_astrodynamics::getPolyhedronPreprocessedData(
+                    verticesCoordinates_, verticesDefiningEachFacet_ );
 
         // Create cache object
         polyhedronGravityCache_ = std::make_shared< PolyhedronGravityCache >(
-                verticesCoordinates_, verticesDefiningEachFacet_, verticesDefiningEachEdge_);
+                verticesCoordinates_, verticesDefiningEachFacet_, preprocessedData_->verticesDefiningEachEdge,
+                preprocessedData_->facetDyads, preprocessedData_->edgeDyads );
 
         inertiaTensor_ = basic_astrodynamics::computePolyhedronInertiaTensor(
                 verticesCoordinates_, verticesDefiningEachFacet_, density_ );
@@ -181,15 +309,7 @@ public:
     {
         polyhedronGravityCache_->update(bodyFixedPosition);
 
-        return basic_mathematics::calculatePolyhedronGravitationalPotential(
-                gravitationalParameter_ / volume_,
-                polyhedronGravityCache_->getVerticesCoordinatesRelativeToFieldPoint(),
-                verticesDefiningEachFacet_,
-                verticesDefiningEachEdge_,
-                facetDyads_,
-                edgeDyads_,
-                polyhedronGravityCache_->getPerFacetFactor(),
-                polyhedronGravityCache_->getPerEdgeFactor() );
+        return polyhedronGravityCache_->getGravitationalPotential( gravitationalParameter_ / volume_ );
     }
 
     /*! Function to calculate the gradient of the gravitational potential (i.e. the acceleration).
@@ -202,15 +322,7 @@ public:
     {
         polyhedronGravityCache_->update(bodyFixedPosition);
 
-        return basic_mathematics::calculatePolyhedronGradientOfGravitationalPotential(
-                gravitationalParameter_ / volume_,
-                polyhedronGravityCache_->getVerticesCoordinatesRelativeToFieldPoint(),
-                verticesDefiningEachFacet_,
-                verticesDefiningEachEdge_,
-                facetDyads_,
-                edgeDyads_,
-                polyhedronGravityCache_->getPerFacetFactor(),
-                polyhedronGravityCache_->getPerEdgeFactor() );
+        return polyhedronGravityCache_->getGradientOfPotential( gravitationalParameter_ / volume_ );
     }
 
     /*! Function to calculate the hessian matrix of the gravitational potential.
@@ -223,12 +335,7 @@ public:
     {
         polyhedronGravityCache_->update(bodyFixedPosition);
 
-        return basic_mathematics::calculatePolyhedronHessianOfGravitationalPotential(
-                gravitationalParameter_ / volume_,
-                facetDyads_,
-                edgeDyads_,
-                polyhedronGravityCache_->getPerFacetFactor(),
-                polyhedronGravityCache_->getPerEdgeFactor() );
+        return polyhedronGravityCache_->getHessianOfPotential( gravitationalParameter_ / volume_ );
     }
 
     /*! Function to calculate the laplacian of the gravitational potential.
@@ -241,11 +348,18 @@ public:
     {
         polyhedronGravityCache_->update(bodyFixedPosition);
 
-        return basic_mathematics::calculatePolyhedronLaplacianOfGravitationalPotential(
-                gravitationalParameter_ / volume_,
-                polyhedronGravityCache_->getPerFacetFactor() );
+        return polyhedronGravityCache_->getLaplacianOfPotential( gravitationalParameter_ / volume_ );
     }
 
+    /*! Function to set the number of threads over which the computations are distributed.
+     *
+     * Function to set the number of threads over which the computations of the potential and its derivatives are
+     * distributed (see PolyhedronGravityCache).
+     * @param numberOfThreads Number of threads (must be at least 1).
+     */
+    void setNumberOfThreads( const int numberOfThreads )
+    { polyhedronGravityCache_->setNumberOfThreads( numberOfThreads ); }
+
     //! Function to retrieve the identifier for the body-fixed reference frame.
     std::string getFixedReferenceFrame( )
     { return fixedReferenceFrame_; }
@@ -264,15 +378,15 @@ public:
 
     //! Function to return the vertices defining each edge.
     const Eigen::MatrixXi& getVerticesDefiningEachEdge( )
-    { return verticesDefiningEachEdge_; }
+    { return preprocessedData_->verticesDefiningEachEdge; }
 
     //! Function to return the facet dyads.
     const std::vector< Eigen::MatrixXd >& getFacetDyads( )
-    { return facetDyads_; }
+    { return preprocessedData_->facetDyads; }
 
     //! Function to return the edge dyads.
     const std::vector< Eigen::MatrixXd >& getEdgeDyads( )
-    { return edgeDyads_; }
+    { return preprocessedData_->edgeDyads; }
 
     virtual Eigen::Matrix3d getInertiaTensor( )
     {
@@ -283,33 +397,6 @@ protected:
 
 private:
 
-    /*! Function to compute the vertices and facets defining each edge.
-     *
-     * Function to compute the vertices and facets defining each edge, according to Werner and Scheeres (1997).
-     * VerticesDefiningEachEdge is a matrix with
-     * the index (0 based) of the vertices constituting each edge (one row per edge, 2 columns). FacetsDefiningEachEdge
-     * is a matrix with the index (0 based) of the facets defining each edge (one row per edge, 2 columns). The function
-     * saves the two computed matrices into member variables of the class.
-     */
-    void computeVerticesAndFacetsDefiningEachEdge ( );
-
-    /*! Function to compute the facet normals and facet dyads.
-     *
-     * Function to compute the facet normals and facet dyads, according to Werner and Scheeres (1997).
-     * Computes a vector of facet normals, each member of the
-     * vector being the normal to one facet. Computes a vector of facet dyads, each member of the vector being the ´
-     * dyad associated with one facet. The function saves the two computed vectors into member variables of the class.
-     */
-    void computeFacetNormalsAndDyads ( );
-
-    /*! Function to compute the edge dyads.
-     *
-     * Function to compute the edge dyads, according to Werner and Scheeres (1997). Computes a vector of edge dyads,
-     * each member of the vector being the dyad associated with one edge. The function saves the computed vector
-     * into a member variable of the class.
-     */
-    void computeEdgeDyads ( );
-
     //! Gravitational parameter of the polyhedron.
     double gravitationalParameter_;
 
@@ -326,20 +413,8 @@ private:
     //! Index (0 based) of the vertices constituting each facet (one row per facet, 3 columns).
     Eigen::MatrixXi verticesDefiningEachFacet_;
 
-    //! Index (0 based) of the vertices constituting each edge (one row per edge, 2 columns).
-    Eigen::MatrixXi verticesDefiningEachEdge_;
-
-    //! Index (0 based) of the facets defining each edge (one row per edge, 2 columns).
-    Eigen::MatrixXi facetsDefiningEachEdge_;
-
-    //! Vector with the outward-pointing normal vector of each facet.
-    std::vector< Eigen::Vector3d > facetNormalVectors_;
-
-    //! Vector with the facet dyad of each facet.
-    std::vector< Eigen::MatrixXd > facetDyads_;
-
-    //! Vector with the edge dyad of each edge.
-    std::vector< Eigen::MatrixXd > edgeDyads_;
+    //! Edges, facet normals and facet and edge dyads of the polyhedron.
+    std::shared_ptr< const basic_astrodynamics::PolyhedronPreprocessedData > preprocessedData_;
 
     //! Polyhedron cache.
     std::shared_ptr< PolyhedronGravityCache > polyhedronGravityCache_;
@@ -21,6 +21,8 @@
 
 #include "tudat/astro/basic_astro/accelerationModel.h"
 #include "tudat/astro/gravitation/polyhedronGravityField.h"
+#include "tudat/astro/gravitation/hybridPolyhedronGravityField.h"
+#include "tudat/astro/gravitation/sphericalHarmonicsGravityModel.h"
 #include "tudat/math/basic/polyhedron.h"
 
 namespace tudat
@@ -98,7 +100,8 @@ public:
           rotationFromBodyFixedToIntegrationFrameFunction_( rotationFromBodyFixedToIntegrationFrameFunction ),
           isMutualAttractionUsed_( isMutualAttractionUsed ),
           polyhedronCache_( std::make_shared< PolyhedronGravityCache >(
-                 aVerticesCoordinatesMatrix, aVerticesDefiningEachFacetMatrix, aVerticesDefiningEachEdgeMatrix) ),
+                 aVerticesCoordinatesMatrix, aVerticesDefiningEachFacetMatrix, aVerticesDefiningEachEdgeMatrix,
+                 aFacetDyadsVector, aEdgeDyadsVector ) ),
           currentPotential_( TUDAT_NAN ),
           currentLaplacianOfPotential_( TUDAT_NAN ),
           updatePotential_( updateGravitationalPotential ),
@@ -159,7 +162,7 @@ public:
           isMutualAttractionUsed_( isMutualAttractionUsed ),
           polyhedronCache_( std::make_shared< PolyhedronGravityCache >(
                  verticesCoordinatesFunction(), verticesDefiningEachFacetFunction(),
-                 verticesDefiningEachEdgeFunction() ) ),
+                 verticesDefiningEachEdgeFunction(), facetDyadsFunction(), edgeDyadsFunction() ) ),
           currentPotential_( TUDAT_NAN ),
           currentLaplacianOfPotential_( TUDAT_NAN ),
           updatePotential_( updateGravitationalPotential ),
@@ -258,6 +261,62 @@ public:
         return polyhedronCache_;
     }
 
+    //! Function to set a spherical harmonic acceleration model that is to be used far from the polyhedron.
+    /*!
+     * Function to set a spherical harmonic acceleration model (typically of the spherical harmonic expansion of the
+     * polyhedron, see HybridPolyhedronGravityField) that is to be used far from the polyhedron. Below the inner switch
+     * distance only the polyhedron is evaluated, beyond the outer switch distance only the spherical harmonic model.
+     * In between, the two accelerations are blended with the weight of computeHybridGravityFieldBlendingWeight (as are
+     * the potential and laplacian, if these are updated).
+     * \param farFieldAccelerationModel Spherical harmonic acceleration model, for the same bodies as this model.
+     * \param innerSwitchDistance Distance at which the blending from polyhedron to spherical harmonic model starts.
+     * \param outerSwitchDistance Distance at which the blending from polyhedron to spherical harmonic model ends.
+     */
+    void setFarFieldAccelerationModel(
+            const std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > farFieldAccelerationModel,
+            const double innerSwitchDistance,
+            const double outerSwitchDistance );
+
+    //! Function to retrieve the spherical harmonic acceleration model used far from the polyhedron (nullptr if none).
+    std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > getFarFieldAccelerationModel( )
+    { return farFieldAccelerationModel_; }
+
+    //! Function to retrieve the distance at which the blending from polyhedron to spherical harmonic model starts.
+    double getInnerSwitchDistance( )
+    { return innerSwitchDistance_; }
+
+    //! Function to retrieve the distance at which the blending from polyhedron to spherical harmonic model ends.
+    double getOuterSwitchDistance( )
+    { return outerSwitchDistance_; }
+
+    //! Function to retrieve the current weight of the far-field model, as computed by last call to updateMembers.
+    double getCurrentFarFieldWeight( )
+    { return currentFarFieldWeight_; }
+
+    //! Function to retrieve the derivative of the current weight of the far-field model w.r.t. distance.
+    double getCurrentFarFieldWeightDerivative( )
+    { return currentFarFieldWeightDerivative_; }
+
+    //! Function to retrieve the current acceleration in the body-fixed frame of the body exerting the acceleration.
+    Eigen::Vector3d getAccelerationInBodyFixedFrame( )
+    { return currentAccelerationInBodyFixedFrame_; }
+
+    //! Function to retrieve the current difference of the far-field and polyhedron acceleration in the body-fixed frame
+    //! (only computed in the blending region, zero elsewhere).
+    Eigen::Vector3d getCurrentFarFieldAccelerationCorrectionInBodyFixedFrame( )
+    { return currentFarFieldAccelerationCorrectionInBodyFixedFrame_; }
+
+    //! Function to set the number of threads over which the computation of the acceleration is distributed.
+    /*!
+     * Function to set the number of threads over which the computation of the acceleration (and potential and laplacian,
+     * if these are updated) is distributed, see PolyhedronGravityCache.
+     * \param numberOfThreads Number of threads (must be at least 1).
+     */
+    void setNumberOfThreads( const int numberOfThreads )
+    {
+        polyhedronCache_->setNumberOfThreads( numberOfThreads );
+    }
+
     //! Function to return the value of the current gravitational potential.
     double getCurrentPotential ( )
     { return currentPotential_; }
@@ -272,7 +331,13 @@ public:
 
     //! Function to reset the update potential flag.
     void resetUpdatePotential ( bool updatePotential )
-    { updatePotential_ = updatePotential; }
+    {
+        updatePotential_ = updatePotential;
+        if( farFieldAccelerationModel_ != nullptr )
+        {
+            farFieldAccelerationModel_->resetUpdatePotential( updatePotential );
+        }
+    }
 
     //! Function to return the update laplacian of potential flag.
     bool getUpdateLaplacianOfPotential ( )
@@ -320,6 +385,24 @@ private:
     //!  Polyhedron cache for this acceleration
     std::shared_ptr< PolyhedronGravityCache > polyhedronCache_;
 
+    //! Spherical harmonic acceleration model used far from the polyhedron (nullptr if none).
+    std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > farFieldAccelerationModel_;
+
+    //! Distance at which the blending from polyhedron to spherical harmonic model starts.
+    double innerSwitchDistance_ = TUDAT_NAN;
+
+    //! Distance at which the blending from polyhedron to spherical harmonic model ends.
+    double outerSwitchDistance_ = TUDAT_NAN;
+
+    //! Current weight of the far-field model.
+    double currentFarFieldWeight_ = 0.0;
+
+    //! Derivative of the current weight of the far-field model w.r.t. distance.
+    double currentFarFieldWeightDerivative_ = 0.0;
+
+    //! Current difference of the far-field and polyhedron acceleration in the body-fixed frame (in blending region).
+    Eigen::Vector3d currentFarFieldAccelerationCorrectionInBodyFixedFrame_ = Eigen::Vector3d::Zero( );
+
     //! Current rotation from body-fixed frame to integration frame.
     Eigen::Quaterniond rotationToIntegrationFrame_;
 
@@ -0,0 +1,128 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_SPHERICALHARMONICSBATCHEVALUATION_H
+#define TUDAT_SPHERICALHARMONICSBATCHEVALUATION_H
+
+#include <Eigen/Core>
+
+#include "tudat/math/basic/legendrePolynomials.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Backends by which a batch of spherical harmonic field evaluations can be performed
+/*!
+ *  Backends by which a batch of spherical harmonic field evaluations can be performed. The cpu_batch_evaluation backend
+ *  uses the ring-wise algorithm on the host. The cuda_batch_evaluation backend evaluates each point separately, on a
+ *  CUDA device when Tudat is built with TUDAT_BUILD_WITH_CUDA, and otherwise with the same per-point algorithm on host
+ *  threads (see isSphericalHarmonicsBatchEvaluationOnDevice).
+ */
+enum SphericalHarmonicsBatchEvaluationBackend
+{
+    cpu_batch_evaluation,
+    cuda_batch_evaluation
+};
+
+//! Function to check whether a backend for batched spherical harmonic field evaluation runs on a CUDA device
+/*!
+ *  Function to check whether a backend for batched spherical harmonic field evaluation runs on a CUDA device in this
+ *  build, which is the case for the CUDA backend when Tudat is built with TUDAT_BUILD_WITH_CUDA. Otherwise, the CUDA
+ *  backend evaluates the same per-point algorithm on host threads.
+ *  \param backend Backend that is to be checked
+ *  \return True if the backend runs on a CUDA device, false otherwise
+ */
+bool isSphericalHarmonicsBatchEvaluationOnDevice( const SphericalHarmonicsBatchEvaluationBackend backend );
+
+//! Function to compute the potential and its gradient of a geodesy-normalized spherical harmonic field at a set of points
+/*!
+ *  Function to compute the potential and its (Cartesian) gradient of a geodesy-normalized spherical harmonic field at a
+ *  set of points, using a ring-wise algorithm. The points are grouped into 'rings' of identical distance and latitude.
+ *  For each ring, the Legendre polynomials are computed once, and the sums over all degrees are computed once per order,
+ *  after which the potential and gradient at each longitude of the ring only require a single sum over all orders (with
+ *  the trigonometric functions of order times longitude computed by recursion). For points that do not share a ring,
+ *  the cost is equal to that of a single-point evaluation. The rings are distributed over the requested number of
+ *  threads. The results are equal to those of calculateSphericalHarmonicGravitationalPotential and
+ *  computeGeodesyNormalizedGravitationalAccelerationSum up to round-off.
+ *
+ *  With the CUDA backend, each point is instead evaluated separately (by a device thread, or on the host if Tudat is
+ *  built without CUDA), with the Legendre polynomials divided by the power of the cosine of latitude equal to their
+ *  order (Holmes and Featherstone, 2002), which prevents underflow of the sectoral terms at high degree. The CPU backend
+ *  is the reference implementation, to which the CUDA backend is equal up to round-off; the recursionType input only
+ *  applies to the CPU backend, and the numberOfThreads input does not apply to evaluation on a device.
+ *  \param bodyFixedPositions Positions at which the potential and gradient are to be computed (one column per point), in
+ *  the frame in which the expansion is defined (typically body-fixed).
+ *  \param gravitationalParameter Gravitational parameter of massive body
+ *  \param referenceRadius Reference radius of spherical harmonic field expansion
+ *  \param cosineCoefficients Cosine spherical harmonic coefficients (geodesy normalized)
+ *  \param sineCoefficients Sine spherical harmonic coefficients (geodesy normalized)
+ *  \param potentials Potential at each of the points (returned by reference)
+ *  \param gradients Gradient of the potential at each of the points (returned by reference)
+ *  \param numberOfThreads Number of threads over which the rings are distributed
+ *  \param recursionType Type of recursion used to compute the Legendre polynomials
+ *  \param backend Backend by which the evaluation is performed
+ */
+void computeGeodesyNormalizedPotentialAndGradientAtPoints(
+        const Eigen::Matrix3Xd& bodyFixedPositions,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const Eigen::MatrixXd& cosineCoefficients,
+        const Eigen::MatrixXd& sineCoefficients,
+        Eigen::VectorXd& potentials,
+        Eigen::Matrix3Xd& gradients,
+        const int numberOfThreads = 1,
+        const basic_mathematics::LegendreRecursionType recursionType = basic_mathematics::standard_legendre_recursion,
+        const SphericalHarmonicsBatchEvaluationBackend backend = cpu_batch_evaluation );
+
+//! Function to compute the potential and its gradient of a geodesy-normalized spherical harmonic field on a regular grid
+/*!
+ *  Function to compute the potential and its (Cartesian) gradient of a geodesy-normalized spherical harmonic field on a
+ *  regular latitude/longitude grid at constant distance, using the ring-wise algorithm of
+ *  computeGeodesyNormalizedPotentialAndGradientAtPoints (with each latitude a single ring). The latitudes must not be
+ *  at the poles, where the gradient is singular. With the CUDA backend, the grid points are evaluated individually, as
+ *  described for computeGeodesyNormalizedPotentialAndGradientAtPoints.
+ *  \param distance Distance from the center of the body at which the grid is defined
+ *  \param latitudes Latitudes of the grid
+ *  \param longitudes Longitudes of the grid
+ *  \param gravitationalParameter Gravitational parameter of massive body
+ *  \param referenceRadius Reference radius of spherical harmonic field expansion
+ *  \param cosineCoefficients Cosine spherical harmonic coefficients (geodesy normalized)
+ *  \param sineCoefficients Sine spherical harmonic coefficients (geodesy normalized)
+ *  \param potentials Potential at each of the grid points (returned by reference), with row index the latitude index and
+ *  column index the longitude index.
+ *  \param gradients Gradient of the potential at each of the grid points (returned by reference), with the gradient at
+ *  latitude index i and longitude index j in column i + j * latitudes.rows( ) (the same order in which the entries of
+ *  potentials are stored).
+ *  \param numberOfThreads Number of threads over which the latitudes are distributed
+ *  \param recursionType Type of recursion used to compute the Legendre polynomials
+ *  \param backend Backend by which the evaluation is performed
+ */
+void computeGeodesyNormalizedPotentialAndGradientOnGrid(
+        const double distance,
+        const Eigen::VectorXd& latitudes,
+        const Eigen::VectorXd& longitudes,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const Eigen::MatrixXd& cosineCoefficients,
+        const Eigen::MatrixXd& sineCoefficients,
+        Eigen::MatrixXd& potentials,
+        Eigen::Matrix3Xd& gradients,
+        const int numberOfThreads = 1,
+        const basic_mathematics::LegendreRecursionType recursionType = basic_mathematics::standard_legendre_recursion,
+        const SphericalHarmonicsBatchEvaluationBackend backend = cpu_batch_evaluation );
+
+} // namespace gravitation
+
+} // namespace tudat
+
+#endif // TUDAT_SPHERICALHARMONICSBATCHEVALUATION_H
@@ -0,0 +1,227 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Holmes, S.A. and Featherstone, W.E., A unified approach to the Clenshaw summation and the recursive computation
+ *          of very high degree and order normalised associated Legendre functions, Journal of Geodesy 76, 2002.
+ */
+
+#ifndef TUDAT_SPHERICALHARMONICSDEVICEEVALUATION_H
+#define TUDAT_SPHERICALHARMONICSDEVICEEVALUATION_H
+
+#include <cmath>
+
+#include "tudat/basics/utilityMacros.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Scaling of the sectoral Legendre polynomials, preventing overflow of the scaled polynomials at high degree
+constexpr double SECTORAL_POLYNOMIAL_SCALING = 1.0E-280;
+
+//! Function to compute the potential and its gradient of a geodesy-normalized spherical harmonic field at a single point
+/*!
+ *  Function to compute the potential and its (Cartesian) gradient of a geodesy-normalized spherical harmonic field at a
+ *  single point. The Legendre polynomials of each order m are computed by the forward column recursion, divided by
+ *  cos(latitude)^m (Holmes and Featherstone, 2002), so that the recursion does not underflow near the poles at high
+ *  degree, and scaled by SECTORAL_POLYNOMIAL_SCALING so that it does not overflow. Both factors are removed from the sum
+ *  over all degrees of each order. The recursion coefficients are precomputed, and stored in the same order as the
+ *  spherical harmonic coefficients, so that concurrent evaluations at different points read the same entries.
+ *
+ *  This function is used by the CUDA kernel (one device thread per point), and by its host fallback when Tudat is built
+ *  without TUDAT_BUILD_WITH_CUDA, so that both produce the same results. The point must not be on the polar axis.
+ *  \param bodyFixedPosition Position at which the potential and gradient are to be computed (3 entries)
+ *  \param gravitationalParameter Gravitational parameter of massive body
+ *  \param referenceRadius Reference radius of spherical harmonic field expansion
+ *  \param maximumDegree Maximum degree of coefficients
+ *  \param maximumOrder Maximum order of coefficients (limited to maximum degree)
+ *  \param cosineCoefficients Cosine coefficients (geodesy normalized), stored order by order, with the coefficients of
+ *  degree m..maximumDegree of order m starting at entry orderOffsets[ m ]
+ *  \param sineCoefficients Sine coefficients (geodesy normalized), stored as cosineCoefficients
+ *  \param orderOffsets Start of each order in coefficient storage (maximumOrder + 2 entries)
+ *  \param firstRecursionCoefficients Coefficients of the current polynomial in the column recursion, stored as
+ *  cosineCoefficients
+ *  \param secondRecursionCoefficients Coefficients of the previous polynomial in the column recursion, stored as
+ *  cosineCoefficients
+ *  \param derivativeCoefficients Coefficients of the previous polynomial in the derivative w.r.t. latitude, stored as
+ *  cosineCoefficients
+ *  \param potential Potential at the point (returned by reference)
+ *  \param gradient Gradient of the potential at the point (returned by reference, 3 entries)
+ */
+TUDAT_HOST_DEVICE inline void computeGeodesyNormalizedPotentialAndGradientAtSinglePoint(
+        const double* bodyFixedPosition,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const int maximumDegree,
+        const int maximumOrder,
+        const double* cosineCoefficients,
+        const double* sineCoefficients,
+        const int* orderOffsets,
+        const double* firstRecursionCoefficients,
+        const double* secondRecursionCoefficients,
+        const double* derivativeCoefficients,
+        double& potential,
+        double* gradient )
+{
+    const double x = bodyFixedPosition[ 0 ];
+    const double y = bodyFixedPosition[ 1 ];
+    const double z = bodyFixedPosition[ 2 ];
+    const double distance = std::sqrt( x * x + y * y + z * z );
+    const double horizontalDistance = std::sqrt( x * x + y * y );
+    const double sineOfLatitude = z / distance;
+    const double cosineOfLatitude = horizontalDistance / distance;
+    const double cosineOfLongitude = x / horizontalDistance;
+    const double sineOfLongitude = y / horizontalDistance;
+    const double radiusRatio = referenceRadius / distance;
+
+    double potentialSum = 0.0, radialSum = 0.0, latitudinalSum = 0.0, longitudinalSum = 0.0;
+
+    // Scaled sectoral Legendre polynomial, cos(latitude)^order, (R/r)^(order+1) and trigonometric functions of order
+    // times longitude, of current order
+    double sectoralPolynomial = SECTORAL_POLYNOMIAL_SCALING;
+    double cosineOfLatitudePower = 1.0;
+    double orderRadiusPowerTerm = radiusRatio;
+    double cosineOfOrderLongitude = 1.0;
+    double sineOfOrderLongitude = 0.0;
+
+    for( int order = 0; order <= maximumOrder; order++ )
+    {
+        const int orderOffset = orderOffsets[ order ];
+        const double doubleOrder = static_cast< double >( order );
+
+        // Compute sums over all degrees of current order
+        double cosinePotentialSum = 0.0, sinePotentialSum = 0.0;
+        double cosineRadialSum = 0.0, sineRadialSum = 0.0;
+        double cosineLatitudinalSum = 0.0, sineLatitudinalSum = 0.0;
+
+        double currentPolynomial = sectoralPolynomial;
+        double previousPolynomial = 0.0;
+        double radiusPowerTerm = orderRadiusPowerTerm;
+        for( int degree = order; degree <= maximumDegree; degree++ )
+        {
+            const int index = orderOffset + degree - order;
+            if( degree > order )
+            {
+                const double nextPolynomial = firstRecursionCoefficients[ index ] * sineOfLatitude * currentPolynomial -
+                        secondRecursionCoefficients[ index ] * previousPolynomial;
+                previousPolynomial = currentPolynomial;
+                currentPolynomial = nextPolynomial;
+            }
+
+            // Derivative w.r.t. latitude, multiplied by cos(latitude)
+            const double doubleDegree = static_cast< double >( degree );
+            const double scaledDerivative = -doubleDegree * sineOfLatitude * currentPolynomial +
+                    derivativeCoefficients[ index ] * previousPolynomial;
+
+            const double polynomialTerm = radiusPowerTerm * currentPolynomial;
+            const double derivativeTerm = radiusPowerTerm * scaledDerivative;
+            cosinePotentialSum += polynomialTerm * cosineCoefficients[ index ];
+            sinePotentialSum += polynomialTerm * sineCoefficients[ index ];
+            cosineRadialSum += ( doubleDegree + 1.0 ) * polynomialTerm * cosineCoefficients[ index ];
+            sineRadialSum += ( doubleDegree + 1.0 ) * polynomialTerm * sineCoefficients[ index ];
+            cosineLatitudinalSum += derivativeTerm * cosineCoefficients[ index ];
+            sineLatitudinalSum += derivativeTerm * sineCoefficients[ index ];
+
+            radiusPowerTerm *= radiusRatio;
+        }
+
+        // Add contribution of current order (removing cos(latitude) power before the scaling, to prevent overflow)
+        potentialSum += ( cosineOfLatitudePower * (
+                    cosinePotentialSum * cosineOfOrderLongitude + sinePotentialSum * sineOfOrderLongitude ) ) /
+                SECTORAL_POLYNOMIAL_SCALING;
+        radialSum += ( cosineOfLatitudePower * (
+                    cosineRadialSum * cosineOfOrderLongitude + sineRadialSum * sineOfOrderLongitude ) ) /
+                SECTORAL_POLYNOMIAL_SCALING;
+        latitudinalSum += ( cosineOfLatitudePower * (
+                    cosineLatitudinalSum * cosineOfOrderLongitude + sineLatitudinalSum * sineOfOrderLongitude ) ) /
+                SECTORAL_POLYNOMIAL_SCALING;
+        longitudinalSum += ( cosineOfLatitudePower * doubleOrder * (
+                    sinePotentialSum * cosineOfOrderLongitude - cosinePotentialSum * sineOfOrderLongitude ) ) /
+                SECTORAL_POLYNOMIAL_SCALING;
+
+        // Update terms to next order (the normalization of order 0 differs from that of other orders by a factor 2)
+        sectoralPolynomial *= ( order == 0 ) ? std::sqrt( 3.0 ) :
+                                               std::sqrt( ( 2.0 * doubleOrder + 3.0 ) / ( 2.0 * doubleOrder + 2.0 ) );
+        cosineOfLatitudePower *= cosineOfLatitude;
+        orderRadiusPowerTerm *= radiusRatio;
+        const double previousCosineOfOrderLongitude = cosineOfOrderLongitude;
+        cosineOfOrderLongitude = previousCosineOfOrderLongitude * cosineOfLongitude -
+                sineOfOrderLongitude * sineOfLongitude;
+        sineOfOrderLongitude = sineOfOrderLongitude * cosineOfLongitude +
+                previousCosineOfOrderLongitude * sineOfLongitude;
+    }
+
+    // Compute partials w.r.t. radius, latitude and longitude, and convert gradient to Cartesian frame
+    const double preMultiplier = gravitationalParameter / referenceRadius;
+    const double radialGradient = -preMultiplier / distance * radialSum;
+    const double scaledLatitudinalGradient = preMultiplier * latitudinalSum / horizontalDistance;
+    const double scaledLongitudinalGradient = preMultiplier * longitudinalSum / horizontalDistance;
+
+    potential = preMultiplier * potentialSum;
+    gradient[ 0 ] =
+            cosineOfLatitude * cosineOfLongitude * radialGradient -
+            sineOfLatitude * cosineOfLongitude * scaledLatitudinalGradient -
+            sineOfLongitude * scaledLongitudinalGradient;
+    gradient[ 1 ] =
+            cosineOfLatitude * sineOfLongitude * radialGradient -
+            sineOfLatitude * sineOfLongitude * scaledLatitudinalGradient +
+            cosineOfLongitude * scaledLongitudinalGradient;
+    gradient[ 2 ] =
+            sineOfLatitude * radialGradient + cosineOfLatitude * scaledLatitudinalGradient;
+}
+
+//! Function to compute the potential and its gradient of a geodesy-normalized spherical harmonic field on a CUDA device
+/*!
+ *  Function to compute the potential and its (Cartesian) gradient of a geodesy-normalized spherical harmonic field at a
+ *  set of points on a CUDA device, with one device thread per point evaluating
+ *  computeGeodesyNormalizedPotentialAndGradientAtSinglePoint. This function is only defined when Tudat is built with
+ *  TUDAT_BUILD_WITH_CUDA, and is called through computeGeodesyNormalizedPotentialAndGradientAtPoints. All arrays are in
+ *  host memory; the transfer to and from the device is handled by this function.
+ *  \param bodyFixedPositions Positions at which the potential and gradient are to be computed (3 x numberOfPoints,
+ *  column-major)
+ *  \param numberOfPoints Number of points at which the potential and gradient are to be computed
+ *  \param gravitationalParameter Gravitational parameter of massive body
+ *  \param referenceRadius Reference radius of spherical harmonic field expansion
+ *  \param maximumDegree Maximum degree of coefficients
+ *  \param maximumOrder Maximum order of coefficients (limited to maximum degree)
+ *  \param cosineCoefficients Cosine coefficients (geodesy normalized), stored order by order, with the coefficients of
+ *  degree m..maximumDegree of order m starting at entry orderOffsets[ m ]
+ *  \param sineCoefficients Sine coefficients (geodesy normalized), stored as cosineCoefficients
+ *  \param orderOffsets Start of each order in coefficient storage (maximumOrder + 2 entries)
+ *  \param firstRecursionCoefficients Coefficients of the current polynomial in the column recursion
+ *  \param secondRecursionCoefficients Coefficients of the previous polynomial in the column recursion
+ *  \param derivativeCoefficients Coefficients of the previous polynomial in the derivative w.r.t. latitude
+ *  \param potentials Potential at each of the points (returned by reference, numberOfPoints entries)
+ *  \param gradients Gradient of the potential at each of the points (returned by reference, 3 x numberOfPoints,
+ *  column-major)
+ */
+void computeGeodesyNormalizedPotentialAndGradientOnDevice(
+        const double* bodyFixedPositions,
+        const int numberOfPoints,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const int maximumDegree,
+        const int maximumOrder,
+        const double* cosineCoefficients,
+        const double* sineCoefficients,
+        const int* orderOffsets,
+        const double* firstRecursionCoefficients,
+        const double* secondRecursionCoefficients,
+        const double* derivativeCoefficients,
+        double* potentials,
+        double* gradients );
+
+} // namespace gravitation
+
+} // namespace tudat
+
+#endif // TUDAT_SPHERICALHARMONICSDEVICEEVALUATION_H
@@ -18,6 +18,7 @@
 #define TUDAT_SPHERICAL_HARMONICS_GRAVITY_FIELD_H
 
 #include <functional>
+#include <map>
 #include <boost/lambda/lambda.hpp>
 
 
@@ -25,9 +26,11 @@
 #include <Eigen/Geometry>
 
 #include "tudat/math/basic/mathematicalConstants.h"
+#include "tudat/math/basic/copyOnWriteMatrix.h"
 #include "tudat/math/basic/legendrePolynomials.h"
 #include "tudat/astro/basic_astro/physicalConstants.h"
 #include "tudat/astro/gravitation/gravityFieldModel.h"
+#include "tudat/astro/gravitation/sphericalHarmonicsBatchEvaluation.h"
 #include "tudat/math/basic/sphericalHarmonics.h"
 
 namespace tudat
@@ -197,6 +200,30 @@ public:
             const Eigen::MatrixXd& sineCoefficients = Eigen::MatrixXd::Zero( 1, 1 ),
             const std::string& fixedReferenceFrame = "",
             const double scaledMeanMomentOfInertia = TUDAT_NAN )
+        : SphericalHarmonicsGravityField(
+              gravitationalParameter, referenceRadius, basic_mathematics::CopyOnWriteMatrix( cosineCoefficients ),
+              basic_mathematics::CopyOnWriteMatrix( sineCoefficients ), fixedReferenceFrame, scaledMeanMomentOfInertia )
+    { }
+
+    //! Class constructor, using (shared) coefficient storage.
+    /*!
+     *  Class constructor, using (shared) coefficient storage. The coefficients are not copied, but share their storage
+     *  with the input objects (e.g. the gravity field settings, or another gravity field) until either of them is
+     *  modified.
+     *  \param gravitationalParameter Gravitational parameter of massive body
+     *  \param referenceRadius Reference radius of spherical harmonic field expansion
+     *  \param cosineCoefficients Cosine spherical harmonic coefficients (geodesy normalized)
+     *  \param sineCoefficients Sine spherical harmonic coefficients (geodesy normalized)
+     *  \param fixedReferenceFrame Identifier for body-fixed reference frame to which the field is fixed (optional).
+     *  \param scaledMeanMomentOfInertia Mean moment of inertia, divided by (M*R^2)
+     */
+    SphericalHarmonicsGravityField(
+            const double gravitationalParameter,
+            const double referenceRadius,
+            const basic_mathematics::CopyOnWriteMatrix& cosineCoefficients,
+            const basic_mathematics::CopyOnWriteMatrix& sineCoefficients,
+            const std::string& fixedReferenceFrame = "",
+            const double scaledMeanMomentOfInertia = TUDAT_NAN )
         : GravityFieldModel( gravitationalParameter ), referenceRadius_( referenceRadius ),
           cosineCoefficients_( cosineCoefficients ), sineCoefficients_( sineCoefficients ),
           fixedReferenceFrame_( fixedReferenceFrame ),
@@ -238,6 +265,17 @@ public:
      *  \return Cosine spherical harmonic coefficients (geodesy normalized)
      */
     Eigen::MatrixXd getCosineCoefficients( )
+    {
+        return cosineCoefficients_.getMatrix( );
+    }
+
+    //! Function to get the (shared) storage of the cosine spherical harmonic coefficients (geodesy normalized)
+    /*!
+     *  Function to get the (shared) storage of the cosine spherical harmonic coefficients (geodesy normalized), which
+     *  can be used to create other objects with the same coefficients without copying them.
+     *  \return Storage of cosine spherical harmonic coefficients (geodesy normalized)
+     */
+    basic_mathematics::CopyOnWriteMatrix getSharedCosineCoefficients( )
     {
         return cosineCoefficients_;
     }
@@ -248,6 +286,17 @@ public:
      *  \return Sine spherical harmonic coefficients (geodesy normalized)
      */
     Eigen::MatrixXd getSineCoefficients( )
+    {
+        return sineCoefficients_.getMatrix( );
+    }
+
+    //! Function to get the (shared) storage of the sine spherical harmonic coefficients (geodesy normalized)
+    /*!
+     *  Function to get the (shared) storage of the sine spherical harmonic coefficients (geodesy normalized), which
+     *  can be used to create other objects with the same coefficients without copying them.
+     *  \return Storage of sine spherical harmonic coefficients (geodesy normalized)
+     */
+    basic_mathematics::CopyOnWriteMatrix getSharedSineCoefficients( )
     {
         return sineCoefficients_;
     }
@@ -265,7 +314,7 @@ public:
             throw std::runtime_error( "Error when resettings spherical harmonics gravity field cosine coefficients; sizes are incompatible" );
         }
 
-        cosineCoefficients_ = cosineCoefficients;
+        cosineCoefficients_.setMatrix( cosineCoefficients );
         if( !( updateInertiaTensor_ == nullptr ) )
         {
             updateInertiaTensor_( );
@@ -285,7 +334,7 @@ public:
             throw std::runtime_error( "Error when resettings spherical harmonics gravity field cosine coefficients; sizes are incompatible" );
         }
 
-        sineCoefficients_ = sineCoefficients;
+        sineCoefficients_.setMatrix( sineCoefficients );
 
         if( !( updateInertiaTensor_ == nullptr ) )
         {
@@ -434,6 +483,62 @@ public:
                     sineCoefficients_.block( 0, 0, maximumDegree, maximumOrder ), sphericalHarmonicsCache_, dummyMap );
     }
 
+    //! Function to calculate the gravitational potential and its gradient at a set of points
+    /*!
+     *  Function to calculate the gravitational potential and its gradient at a set of points, expanding the gravity field to
+     *  its maximum degree and order, using a ring-wise algorithm for points sharing distance and latitude (see
+     *  computeGeodesyNormalizedPotentialAndGradientAtPoints).
+     *  \param bodyFixedPositions Positions at which the potential and gradient are to be computed (one column per point),
+     *  in body-fixed frame.
+     *  \param potentials Potential at each of the points (returned by reference)
+     *  \param gradients Gradient of the potential at each of the points (returned by reference)
+     *  \param numberOfThreads Number of threads over which the evaluation is distributed (not used on a CUDA device)
+     *  \param backend Backend by which the evaluation is performed
+     */
+    void getGravitationalPotentialAndGradientAtPoints(
+            const Eigen::Matrix3Xd& bodyFixedPositions,
+            Eigen::VectorXd& potentials,
+            Eigen::Matrix3Xd& gradients,
+            const int numberOfThreads = 1,
+            const SphericalHarmonicsBatchEvaluationBackend backend = cpu_batch_evaluation )
+    {
+        computeGeodesyNormalizedPotentialAndGradientAtPoints(
+                    bodyFixedPositions, gravitationalParameter_, referenceRadius_, cosineCoefficients_.getMatrix( ),
+                    sineCoefficients_.getMatrix( ),
+                    potentials, gradients, numberOfThreads, sphericalHarmonicsCache_->getLegendreRecursionType( ),
+                    backend );
+    }
+
+    //! Function to calculate the gravitational potential and its gradient on a regular latitude/longitude grid
+    /*!
+     *  Function to calculate the gravitational potential and its gradient on a regular latitude/longitude grid at constant
+     *  distance, expanding the gravity field to its maximum degree and order (see
+     *  computeGeodesyNormalizedPotentialAndGradientOnGrid).
+     *  \param distance Distance from the center of the body at which the grid is defined
+     *  \param latitudes Latitudes of the grid
+     *  \param longitudes Longitudes of the grid
+     *  \param potentials Potential at each of the grid points (returned by reference), with row index the latitude index
+     *  and column index the longitude index.
+     *  \param gradients Gradient of the potential at each of the grid points (returned by reference), with the gradient at
+     *  latitude index i and longitude index j in column i + j * latitudes.rows( ).
+     *  \param numberOfThreads Number of threads over which the evaluation is distributed (not used on a CUDA device)
+     *  \param backend Backend by which the evaluation is performed
+     */
+    void getGravitationalPotentialAndGradientOnGrid(
+            const double distance,
+            const Eigen::VectorXd& latitudes,
+            const Eigen::VectorXd& longitudes,
+            Eigen::MatrixXd& potentials,
+            Eigen::Matrix3Xd& gradients,
+            const int numberOfThreads = 1,
+            const SphericalHarmonicsBatchEvaluationBackend backend = cpu_batch_evaluation )
+    {
+        computeGeodesyNormalizedPotentialAndGradientOnGrid(
+                    distance, latitudes, longitudes, gravitationalParameter_, referenceRadius_,
+                    cosineCoefficients_.getMatrix( ), sineCoefficients_.getMatrix( ), potentials, gradients, numberOfThreads,
+                    sphericalHarmonicsCache_->getLegendreRecursionType( ), backend );
+    }
+
     //! Get the gradient of the laplacian of potential.
     /*!
      * Returns the laplacian of the gravitational potential for the gravity field selected.
@@ -493,6 +598,33 @@ public:
     {
         scaledMeanMomentOfInertia_ = scaledMeanMomentOfInertia;
     }
+
+    //! Function to retrieve the spherical harmonics cache shared by all models of this field acting on a given body
+    /*!
+     * Function to retrieve the spherical harmonics cache that is shared by all models of this field that act on a given
+     * body (created at the first call for the body and summation type). Such models, e.g. the spherical harmonic
+     * acceleration on the body and the spherical harmonic torque exerted by the body on the body to which this field
+     * belongs, are evaluated at the same body-fixed relative position. Since the cache only recomputes its terms when
+     * this position changes, the Legendre polynomials and trigonometric terms are then computed once per evaluation.
+     * Models that act on the body at different epochs concurrently (in different threads) must not share a cache.
+     * \param bodyUndergoingAcceleration Name of body on which the models act
+     * \param summationType Type of summation of the models that share the cache
+     * \return Spherical harmonics cache shared by all models of this field acting on the given body
+     */
+    std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > getSharedSphericalHarmonicsCache(
+            const std::string& bodyUndergoingAcceleration,
+            const basic_mathematics::SphericalHarmonicsSummationType summationType )
+    {
+        std::shared_ptr< basic_mathematics::SphericalHarmonicsCache >& sharedCache =
+                sharedSphericalHarmonicsCaches_[ std::make_pair( bodyUndergoingAcceleration, summationType ) ];
+        if( sharedCache == nullptr )
+        {
+            sharedCache = std::make_shared< basic_mathematics::SphericalHarmonicsCache >( );
+            sharedCache->setSummationType( summationType );
+        }
+        return sharedCache;
+    }
+
 protected:
 
     //! Reference radius of spherical harmonic field expansion
@@ -503,15 +635,17 @@ protected:
 
     //! Cosine spherical harmonic coefficients (geodesy normalized)
     /*!
-     *  Cosine spherical harmonic coefficients (geodesy normalized)
+     *  Cosine spherical harmonic coefficients (geodesy normalized), with storage that is shared with the objects from
+     *  which it was created (or copied) until it is modified.
      */
-    Eigen::MatrixXd cosineCoefficients_;
+    basic_mathematics::CopyOnWriteMatrix cosineCoefficients_;
 
     //! Sine spherical harmonic coefficients (geodesy normalized)
     /*!
-     *  Sine spherical harmonic coefficients (geodesy normalized)
+     *  Sine spherical harmonic coefficients (geodesy normalized), with storage that is shared with the objects from
+     *  which it was created (or copied) until it is modified.
      */
-    Eigen::MatrixXd sineCoefficients_;
+    basic_mathematics::CopyOnWriteMatrix sineCoefficients_;
 
     //! Identifier for body-fixed reference frame
     /*!
@@ -527,6 +661,10 @@ protected:
 
     //! Cache object for potential calculations.
     std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache_;
+
+    //! Caches shared by models of this field, per body on which they act and summation type
+    std::map< std::pair< std::string, basic_mathematics::SphericalHarmonicsSummationType >,
+    std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > > sharedSphericalHarmonicsCaches_;
 };
 
 //! Function to determine a body's inertia tensor from its degree two unnormalized gravity field coefficients
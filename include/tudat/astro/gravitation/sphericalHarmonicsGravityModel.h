@@ -109,7 +109,9 @@ public:
           rotationFromBodyFixedToIntegrationFrameFunction_(
               rotationFromBodyFixedToIntegrationFrameFunction ),
           sphericalHarmonicsCache_( sphericalHarmonicsCache ),
-          saveSphericalHarmonicTermsSeparately_( false )
+          saveSphericalHarmonicTermsSeparately_( false ),
+          degreeTruncationTolerance_( TUDAT_NAN ),
+          currentTruncationDegree_( -1 )
     {
         maximumDegree_ = static_cast< int >( getCosineHarmonicsCoefficients( ).rows( ) );
         maximumOrder_ = static_cast< int >( getCosineHarmonicsCoefficients( ).cols( ) );
@@ -170,7 +172,9 @@ public:
           getSineHarmonicsCoefficients( sineHarmonicCoefficientsFunction ),
           rotationFromBodyFixedToIntegrationFrameFunction_( rotationFromBodyFixedToIntegrationFrameFunction ),
           sphericalHarmonicsCache_( sphericalHarmonicsCache ),
-          saveSphericalHarmonicTermsSeparately_( false )
+          saveSphericalHarmonicTermsSeparately_( false ),
+          degreeTruncationTolerance_( TUDAT_NAN ),
+          currentTruncationDegree_( -1 )
     {
         maximumDegree_ = static_cast< int >( getCosineHarmonicsCoefficients( ).rows( ) );
         maximumOrder_ = static_cast< int >( getCosineHarmonicsCoefficients( ).cols( ) );
@@ -217,6 +221,9 @@ public:
             currentRelativePosition_ = rotationToIntegrationFrame_.inverse( ) * (
                         currentInertialRelativePosition_ );
 
+            // Remove the degrees that are negligible at the current distance, if requested
+            truncateCoefficientsByDistance( );
+
             currentAcceleration_ =
                     computeGeodesyNormalizedGravitationalAccelerationSum(
                         currentRelativePosition_,
@@ -309,6 +316,28 @@ public:
         return sphericalHarmonicsCache_;
     }
 
+    //! Function to retrieve the cosine coefficients used at the last call to updateMembers.
+    /*!
+     * Function to retrieve the cosine coefficients used at the last call to updateMembers, so that objects that are
+     * updated to the same time (e.g. acceleration partials) can reuse them without re-evaluating the coefficient function.
+     * \return Cosine coefficients used at the last call to updateMembers
+     */
+    const Eigen::MatrixXd& getCurrentCosineHarmonicCoefficients( )
+    {
+        return cosineHarmonicCoefficients;
+    }
+
+    //! Function to retrieve the sine coefficients used at the last call to updateMembers.
+    /*!
+     * Function to retrieve the sine coefficients used at the last call to updateMembers, so that objects that are
+     * updated to the same time (e.g. acceleration partials) can reuse them without re-evaluating the coefficient function.
+     * \return Sine coefficients used at the last call to updateMembers
+     */
+    const Eigen::MatrixXd& getCurrentSineHarmonicCoefficients( )
+    {
+        return sineHarmonicCoefficients;
+    }
+
     //! Function to return current position vector from body exerting acceleration to body undergoing acceleration, in frame
     //! fixed to body undergoing acceleration
     /*!
@@ -415,6 +444,10 @@ public:
             {
                 returnVector.segment( i * 3, 3 ) = accelerationPerTerm_.at( coefficientIndices.at( i ) );
             }
+            else if( isTermTruncated( coefficientIndices.at( i ) ) )
+            {
+                returnVector.segment( i * 3, 3 ).setZero( );
+            }
             else
             {
                 throw std::runtime_error( "Error when retrieving spherical harmonic acceleration at degree/order: " +
@@ -441,6 +474,10 @@ public:
             {
                 returnVector( i ) = accelerationPerTerm_.at( coefficientIndices.at( i ) ).norm( );
             }
+            else if( isTermTruncated( coefficientIndices.at( i ) ) )
+            {
+                returnVector( i ) = 0.0;
+            }
             else
             {
                 throw std::runtime_error( "Error when retrieving spherical harmonic acceleration at degree/order: " +
@@ -472,11 +509,110 @@ public:
         return maximumOrder_;
     }
 
+    //! Function to set the tolerance used to truncate the expansion as a function of distance
+    /*!
+     * Function to set the tolerance used to truncate the expansion as a function of distance. If set, the degrees that
+     * are evaluated are selected at each call to updateMembers, such that the estimated contribution of all omitted
+     * degrees to the acceleration is below the tolerance. The contribution of degree n is estimated as
+     * (mu/r^2)(n+1)(R/r)^n times the root-sum-square of the coefficients of degree n, with r the distance between the
+     * bodies and R the reference radius. Since this is an RMS estimate over the sphere, the actual error at a given
+     * point may somewhat exceed the tolerance. The truncated coefficients are also used for the potential, and are returned by
+     * getCurrentCosineHarmonicCoefficients and getCurrentSineHarmonicCoefficients (so that partials that use them are
+     * consistent with the acceleration).
+     * \param degreeTruncationTolerance Tolerance on the acceleration [m/s^2] (NaN to always evaluate the full expansion)
+     */
+    void setDegreeTruncationTolerance( const double degreeTruncationTolerance )
+    {
+        if( degreeTruncationTolerance < 0.0 )
+        {
+            throw std::runtime_error( "Error when setting spherical harmonic degree truncation tolerance, tolerance is negative" );
+        }
+        degreeTruncationTolerance_ = degreeTruncationTolerance;
+        this->currentTime_ = TUDAT_NAN;
+    }
+
+    //! Function to retrieve the tolerance used to truncate the expansion as a function of distance
+    /*!
+     * Function to retrieve the tolerance used to truncate the expansion as a function of distance (see
+     * setDegreeTruncationTolerance)
+     * \return Tolerance used to truncate the expansion as a function of distance (NaN if no truncation is used)
+     */
+    double getDegreeTruncationTolerance( )
+    {
+        return degreeTruncationTolerance_;
+    }
+
+    //! Function to retrieve the maximum degree used at the last call to updateMembers
+    /*!
+     * Function to retrieve the maximum degree used at the last call to updateMembers, which is less than the maximum
+     * degree of the expansion if the expansion is truncated as a function of distance (see setDegreeTruncationTolerance).
+     * \return Maximum degree used at the last call to updateMembers
+     */
+    int getCurrentMaximumDegree( )
+    {
+        return currentTruncationDegree_;
+    }
 
 protected:
 
 private:
 
+    //! Function to remove the degrees that are negligible at the current distance from the current coefficients
+    /*!
+     * Function to remove the degrees that are negligible at the current distance from the current coefficients, if a
+     * truncation tolerance is set (see setDegreeTruncationTolerance), and to set the maximum degree that is used.
+     */
+    void truncateCoefficientsByDistance( )
+    {
+        const int numberOfDegrees = static_cast< int >( cosineHarmonicCoefficients.rows( ) );
+        int truncationDegree = numberOfDegrees - 1;
+        if( !std::isnan( degreeTruncationTolerance_ ) && numberOfDegrees > 1 )
+        {
+            // Add estimated contributions of degrees, starting from the highest, until the omitted acceleration exceeds
+            // the tolerance
+            const double distance = currentRelativePosition_.norm( );
+            const double radiusRatio = equatorialRadius / distance;
+            const double centralAcceleration = gravitationalParameter / ( distance * distance );
+            double omittedAcceleration = 0.0;
+            while( truncationDegree > 0 )
+            {
+                const int numberOfOrders = std::min< int >( truncationDegree + 1, cosineHarmonicCoefficients.cols( ) );
+                omittedAcceleration += centralAcceleration * static_cast< double >( truncationDegree + 1 ) *
+                        std::pow( radiusRatio, truncationDegree ) * std::sqrt(
+                            cosineHarmonicCoefficients.row( truncationDegree ).head( numberOfOrders ).squaredNorm( ) +
+                            sineHarmonicCoefficients.row( truncationDegree ).head( numberOfOrders ).squaredNorm( ) );
+                if( omittedAcceleration > degreeTruncationTolerance_ )
+                {
+                    break;
+                }
+                truncationDegree--;
+            }
+
+            if( truncationDegree < numberOfDegrees - 1 )
+            {
+                const int numberOfOrders = std::min< int >( truncationDegree + 1, cosineHarmonicCoefficients.cols( ) );
+                cosineHarmonicCoefficients.conservativeResize( truncationDegree + 1, numberOfOrders );
+                sineHarmonicCoefficients.conservativeResize( truncationDegree + 1, numberOfOrders );
+
+                // Remove terms of omitted degrees saved at previous evaluations
+                if( saveSphericalHarmonicTermsSeparately_ && truncationDegree < currentTruncationDegree_ )
+                {
+                    accelerationPerTerm_.erase( accelerationPerTerm_.lower_bound( std::make_pair( truncationDegree + 1, 0 ) ),
+                                                accelerationPerTerm_.end( ) );
+                }
+            }
+        }
+        currentTruncationDegree_ = truncationDegree;
+    }
+
+    //! Function to check whether a term of the expansion is omitted due to truncation as a function of distance
+    bool isTermTruncated( const std::pair< int, int >& degreeAndOrder )
+    {
+        return !std::isnan( degreeTruncationTolerance_ ) &&
+                degreeAndOrder.first > currentTruncationDegree_ && degreeAndOrder.first < maximumDegree_ &&
+                degreeAndOrder.second <= degreeAndOrder.first && degreeAndOrder.second < maximumOrder_;
+    }
+
     //! Equatorial radius [m].
     /*!
      * Current value of equatorial (planetary) radius used for spherical harmonics expansion [m].
@@ -540,6 +676,12 @@ private:
     //! Maximum order of gravity field expansion
     int maximumOrder_;
 
+    //! Tolerance on the acceleration used to truncate the expansion as a function of distance (NaN if not used)
+    double degreeTruncationTolerance_;
+
+    //! Maximum degree used at the last call to updateMembers
+    int currentTruncationDegree_;
+
 };
 
 
@@ -0,0 +1,116 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_SPHERICALHARMONICSSUMMATIONKERNELS_H
+#define TUDAT_SPHERICALHARMONICSSUMMATIONKERNELS_H
+
+#include <string>
+
+#include <Eigen/Core>
+
+#include "tudat/math/basic/sphericalHarmonics.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Function to retrieve the name of the instruction set used for the vectorized spherical harmonics summation
+/*!
+ *  Function to retrieve the name of the instruction set used for the vectorized spherical harmonics summation (see
+ *  basic_mathematics::vectorized_spherical_harmonics_summation) on the current machine, as detected at run time.
+ *  \return Name of the instruction set: "avx512", "avx2" or "scalar" (if no SIMD instruction set is supported)
+ */
+std::string getVectorizedSphericalHarmonicsInstructionSet( );
+
+//! Function to sum the terms of all orders of a single degree of a geodesy-normalized spherical harmonic gradient
+/*!
+ *  Function to sum the terms of all orders of a single degree of a geodesy-normalized spherical harmonic gradient, with all
+ *  input stored contiguously in order. The three returned sums are (with P the Legendre polynomial, C and S the cosine and
+ *  sine coefficients, and c_m, s_m the cosine and sine of m times the longitude):
+ *  sum_m P ( C c_m + S s_m ), sum_m dP/dx ( C c_m + S s_m ) and sum_m m P ( S c_m - C s_m ).
+ *  \param legendrePolynomials Legendre polynomials of the degree, for orders 0 to numberOfOrders - 1
+ *  \param legendrePolynomialDerivatives Derivatives of Legendre polynomials of the degree
+ *  \param cosineCoefficients Cosine coefficients of the degree
+ *  \param sineCoefficients Sine coefficients of the degree
+ *  \param cosinesOfLongitude Cosines of order times longitude
+ *  \param sinesOfLongitude Sines of order times longitude
+ *  \param numberOfOrders Number of orders that are summed
+ *  \param useVectorization Boolean denoting whether the SIMD implementation is to be used (if available)
+ *  \param radialSum Sum of radial terms (returned by reference)
+ *  \param latitudinalSum Sum of latitudinal terms (returned by reference)
+ *  \param longitudinalSum Sum of longitudinal terms (returned by reference)
+ */
+void sumGeodesyNormalizedGradientTermsOfDegree(
+        const double* legendrePolynomials,
+        const double* legendrePolynomialDerivatives,
+        const double* cosineCoefficients,
+        const double* sineCoefficients,
+        const double* cosinesOfLongitude,
+        const double* sinesOfLongitude,
+        const int numberOfOrders,
+        const bool useVectorization,
+        double& radialSum,
+        double& latitudinalSum,
+        double& longitudinalSum );
+
+//! Function to compute the spherical gradient of a geodesy-normalized spherical harmonic potential, degree by degree
+/*!
+ *  Function to compute the spherical gradient (radial, latitudinal and longitudinal component) of a geodesy-normalized
+ *  spherical harmonic potential, summing the terms of all orders of each degree at once (see
+ *  sumGeodesyNormalizedGradientTermsOfDegree). The result is equal to the sum of basic_mathematics::computePotentialGradient
+ *  over all terms, up to round-off. The sphericalHarmonicsCache must be updated to the current position before calling this
+ *  function.
+ *  \param distance Distance from center of body with gravity field
+ *  \param preMultiplier Gravitational parameter divided by reference radius
+ *  \param cosineHarmonicCoefficients Geodesy-normalized cosine coefficients (row index degree, column index order)
+ *  \param sineHarmonicCoefficients Geodesy-normalized sine coefficients (row index degree, column index order)
+ *  \param sphericalHarmonicsCache Cache object, updated to current position
+ *  \param useVectorization Boolean denoting whether the SIMD implementation is to be used (if available)
+ *  \return Spherical gradient of the potential
+ */
+Eigen::Vector3d computeGeodesyNormalizedSphericalGradientPerDegree(
+        const double distance,
+        const double preMultiplier,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients,
+        basic_mathematics::SphericalHarmonicsCache& sphericalHarmonicsCache,
+        const bool useVectorization );
+
+//! Function to compute the gradient of a geodesy-normalized spherical harmonic potential in Cartesian coordinates
+/*!
+ *  Function to compute the gradient of a geodesy-normalized spherical harmonic potential in Cartesian coordinates (in the
+ *  frame of the expansion), using the Cartesian terms of the expansion computed by Cunningham's recursion (see
+ *  basic_mathematics::CartesianSphericalHarmonicsRecursion). This formulation requires no conversion to spherical
+ *  coordinates and is free of singularities at the poles. The result is equal to the Cartesian gradient computed from the
+ *  sum of basic_mathematics::computePotentialGradient over all terms, up to round-off. The maximum degree and order of the
+ *  recursion object are increased if they are too small for the coefficients.
+ *  \param position Position at which the gradient is to be computed, in the frame of the expansion
+ *  \param gravitationalParameter Gravitational parameter of the expansion
+ *  \param referenceRadius Reference radius of the expansion
+ *  \param cosineHarmonicCoefficients Geodesy-normalized cosine coefficients (row index degree, column index order)
+ *  \param sineHarmonicCoefficients Geodesy-normalized sine coefficients (row index degree, column index order)
+ *  \param cartesianRecursion Object used to compute the Cartesian terms of the expansion
+ *  \return Cartesian gradient of the potential
+ */
+Eigen::Vector3d computeGeodesyNormalizedCartesianGradient(
+        const Eigen::Vector3d& position,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients,
+        basic_mathematics::CartesianSphericalHarmonicsRecursion& cartesianRecursion );
+
+} // namespace gravitation
+
+} // namespace tudat
+
+#endif // TUDAT_SPHERICALHARMONICSSUMMATIONKERNELS_H
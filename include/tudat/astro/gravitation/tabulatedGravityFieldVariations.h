@@ -82,6 +82,18 @@ public:
     std::pair< Eigen::MatrixXd, Eigen::MatrixXd > calculateSphericalHarmonicsCorrections(
             const double time );
 
+    //! Function for calculating corrections by interpolating tabulated corrections, into existing matrices.
+    /*!
+     *  Function for calculating corrections by interpolating tabulated corrections, into existing matrices.
+     *  \param time Time at which variations are to be calculated.
+     *  \param cosineCorrections Variations in cosine coefficients (returned by reference)
+     *  \param sineCorrections Variations in sine coefficients (returned by reference)
+     */
+    void calculateSphericalHarmonicsCorrectionBlocks(
+            const double time,
+            Eigen::MatrixXd& cosineCorrections,
+            Eigen::MatrixXd& sineCorrections );
+
     //! Function to return map of cosine coefficient variations, with associated times as map key.
     /*!
      *  Function to return map of cosine coefficient variations, with associated times as map key.
@@ -134,6 +146,9 @@ private:
     std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
     variationInterpolator_;
 
+    //! Concatenated [cosine|sine] coefficients, as interpolated by last call to calculateSphericalHarmonicsCorrectionBlocks
+    Eigen::MatrixXd interpolatedCosineSinePair_;
+
 };
 
 } // namespace gravitation
@@ -11,6 +11,7 @@
 #ifndef TUDAT_TIMEDEPENDENTSPHERICALHARMONICSGRAVITYFIELD_H
 #define TUDAT_TIMEDEPENDENTSPHERICALHARMONICSGRAVITYFIELD_H
 
+#include <algorithm>
 #include <functional>
 
 
@@ -65,11 +66,43 @@ public:
             const Eigen::MatrixXd& nominalSineCoefficients,
             const std::string& fixedReferenceFrame = "",
             const double scaledMeanMomentOfInertia = TUDAT_NAN ):
+        TimeDependentSphericalHarmonicsGravityField(
+            gravitationalParameter, referenceRadius, basic_mathematics::CopyOnWriteMatrix( nominalCosineCoefficients ),
+            basic_mathematics::CopyOnWriteMatrix( nominalSineCoefficients ), fixedReferenceFrame,
+            scaledMeanMomentOfInertia )
+    { }
+
+    //! Semi-dummy constructor, using (shared) nominal coefficient storage.
+    /*!
+     *  Semi-dummy constructor, as above, but with nominal coefficients that are not copied, but share their storage
+     *  with the input objects (e.g. the gravity field settings) until either of them is modified. The current
+     *  coefficients share the storage of the nominal coefficients until the first update with non-zero variations.
+     *  \param gravitationalParameter Gravitational parameter of massive body.
+     *  \param referenceRadius Reference radius of spherical harmonic field expansion.
+     *  \param nominalCosineCoefficients Nominal (i.e. with zero variation) cosine spherical
+     *  harmonic coefficients.
+     *  \param nominalSineCoefficients Nominal (i.e. with zero variation) sine spherical harmonic
+     *  coefficients.
+     *  \param fixedReferenceFrame Identifier for body-fixed reference frame to which the field is
+     *  fixed (optional).
+     *  \param scaledMeanMomentOfInertia Mean moment of inertia, divided by (M*R^2)
+     */
+    TimeDependentSphericalHarmonicsGravityField(
+            const double gravitationalParameter, const double referenceRadius,
+            const basic_mathematics::CopyOnWriteMatrix& nominalCosineCoefficients,
+            const basic_mathematics::CopyOnWriteMatrix& nominalSineCoefficients,
+            const std::string& fixedReferenceFrame = "",
+            const double scaledMeanMomentOfInertia = TUDAT_NAN ):
         SphericalHarmonicsGravityField(
             gravitationalParameter, referenceRadius, nominalCosineCoefficients,
             nominalSineCoefficients, fixedReferenceFrame, scaledMeanMomentOfInertia ),
         nominalSineCoefficients_( nominalSineCoefficients ),
-        nominalCosineCoefficients_( nominalCosineCoefficients )
+        nominalCosineCoefficients_( nominalCosineCoefficients ),
+        currentTime_( TUDAT_NAN ),
+        areVariationsTimeDependentOnly_( false ),
+        resetAllCoefficients_( true ),
+        maximumVariationDegree_( -1 ),
+        maximumVariationOrder_( -1 )
     { }
 
     //! Full class constructor.
@@ -96,9 +129,14 @@ public:
         SphericalHarmonicsGravityField(
             gravitationalParameter, referenceRadius,
             nominalCosineCoefficients, nominalSineCoefficients, fixedReferenceFrame, scaledMeanMomentOfInertia ),
-        nominalSineCoefficients_( nominalSineCoefficients ),
-        nominalCosineCoefficients_( nominalCosineCoefficients ),
-        gravityFieldVariationsSet_( gravityFieldVariationUpdateSettings )
+        nominalSineCoefficients_( sineCoefficients_ ),
+        nominalCosineCoefficients_( cosineCoefficients_ ),
+        gravityFieldVariationsSet_( gravityFieldVariationUpdateSettings ),
+        currentTime_( TUDAT_NAN ),
+        areVariationsTimeDependentOnly_( false ),
+        resetAllCoefficients_( true ),
+        maximumVariationDegree_( -1 ),
+        maximumVariationOrder_( -1 )
     {
         updateCorrectionFunctions( );
     }
@@ -112,11 +150,28 @@ public:
     //! Update gravity field to current time.
     /*!
      *  Update gravity field coefficient corrections to current time. All correction functions are
-     *  called and subsequently added to the nominal value.
+     *  called and subsequently added to the nominal value. The coefficients are updated in place: only the block of
+     *  coefficients that is affected by the variations is reset to its nominal value (all coefficients are reset after
+     *  the nominal coefficients or the variations have been modified). The current coefficients share the storage of
+     *  the nominal coefficients until a correction is first added to them. If all variations depend only on time (see
+     *  GravityFieldVariationsSet::areVariationsTimeDependentOnly), the update is skipped when the time is equal to that
+     *  of the previous update (see resetCurrentTime).
      *  \param time Current time.
      */
     void update( const double time );
 
+    //! Function to reset the current time, so that the coefficients are recomputed at the next update
+    void resetCurrentTime( )
+    {
+        currentTime_ = TUDAT_NAN;
+    }
+
+    //! Function to determine whether the coefficients depend only on time (see update)
+    bool areVariationsTimeDependentOnly( )
+    {
+        return areVariationsTimeDependentOnly_;
+    }
+
     //! Update correction functions.
     /*!
      *  Update correction functions, for instance to account for changed changed environmental
@@ -133,7 +188,21 @@ public:
         {
             // Reset correction functions.
             correctionFunctions_ = gravityFieldVariationsSet_->getVariationFunctions( );
+            areVariationsTimeDependentOnly_ = gravityFieldVariationsSet_->areVariationsTimeDependentOnly( );
+
+            // Determine block of coefficients affected by variations
+            maximumVariationDegree_ = -1;
+            maximumVariationOrder_ = -1;
+            std::vector< std::shared_ptr< GravityFieldVariations > > variationObjects =
+                    gravityFieldVariationsSet_->getVariationObjects( );
+            for( unsigned int i = 0; i < variationObjects.size( ); i++ )
+            {
+                maximumVariationDegree_ = std::max( maximumVariationDegree_, variationObjects.at( i )->getMaximumDegree( ) );
+                maximumVariationOrder_ = std::max( maximumVariationOrder_, variationObjects.at( i )->getMaximumOrder( ) );
+            }
         }
+        resetAllCoefficients_ = true;
+        currentTime_ = TUDAT_NAN;
 
     }
 
@@ -164,7 +233,7 @@ public:
      */
     Eigen::MatrixXd getNominalCosineCoefficients( )
     {
-        return nominalCosineCoefficients_;
+        return nominalCosineCoefficients_.getMatrix( );
     }
 
     //! Get current total correction to cosine coefficients
@@ -251,7 +320,9 @@ public:
      */
     void setNominalCosineCoefficients( const Eigen::MatrixXd& nominalCosineCoefficients )
     {
-        nominalCosineCoefficients_ = nominalCosineCoefficients;
+        nominalCosineCoefficients_.setMatrix( nominalCosineCoefficients );
+        resetAllCoefficients_ = true;
+        currentTime_ = TUDAT_NAN;
     }
 
     //! Set nominal (i.e. with zero variations) cosine coefficient of given degree and order.
@@ -266,7 +337,9 @@ public:
         if( degree <= nominalCosineCoefficients_.rows( ) &&
                 order <= nominalCosineCoefficients_.cols( ) )
         {
-            nominalCosineCoefficients_( degree, order ) = coefficient;
+            nominalCosineCoefficients_.getMutableMatrix( )( degree, order ) = coefficient;
+            resetAllCoefficients_ = true;
+            currentTime_ = TUDAT_NAN;
         }
         else
         {
@@ -281,7 +354,7 @@ public:
      */
     Eigen::MatrixXd getNominalSineCoefficients( )
     {
-        return nominalSineCoefficients_;
+        return nominalSineCoefficients_.getMatrix( );
     }
 
     //! Set nominal (i.e. with zero variations) sine coefficients.
@@ -291,7 +364,9 @@ public:
      */
     void setNominalSineCoefficients( const Eigen::MatrixXd& nominalSineCoefficients )
     {
-        nominalSineCoefficients_ = nominalSineCoefficients;
+        nominalSineCoefficients_.setMatrix( nominalSineCoefficients );
+        resetAllCoefficients_ = true;
+        currentTime_ = TUDAT_NAN;
     }
 
     //! Set nominal (i.e. with zero variations) sine coefficient of given degree and order.
@@ -306,7 +381,9 @@ public:
         if( degree <= nominalSineCoefficients_.rows( ) &&
                 order <= nominalSineCoefficients_.cols( ) )
         {
-            nominalSineCoefficients_( degree, order ) = coefficient;
+            nominalSineCoefficients_.getMutableMatrix( )( degree, order ) = coefficient;
+            resetAllCoefficients_ = true;
+            currentTime_ = TUDAT_NAN;
         }
         else
         {
@@ -331,7 +408,7 @@ private:
      *  all corrections are calculated and the sum of these corrections and this nominal value is
      *  set as cosineCoefficients_ base class member.
      */
-    Eigen::MatrixXd nominalSineCoefficients_;
+    basic_mathematics::CopyOnWriteMatrix nominalSineCoefficients_;
 
     //! Nominal (i.e. with zero variations) sine coefficients.
     /*!
@@ -339,7 +416,7 @@ private:
      *  all corrections are calculated and the sum of these corrections and this nominal value is
      *  set as sineCoefficients_ base class member.
      */
-    Eigen::MatrixXd nominalCosineCoefficients_;
+    basic_mathematics::CopyOnWriteMatrix nominalCosineCoefficients_;
 
     //! List of update functions which are called when calculating current gravity field variations.
     /*!
@@ -358,6 +435,21 @@ private:
      */
     std::shared_ptr< GravityFieldVariationsSet > gravityFieldVariationsSet_;
 
+    //! Time of last update, NaN if the coefficients are to be recomputed at the next update.
+    double currentTime_;
+
+    //! Boolean denoting whether all correction functions depend only on time.
+    bool areVariationsTimeDependentOnly_;
+
+    //! Boolean denoting whether all coefficients (not only the block affected by variations) are reset at next update.
+    bool resetAllCoefficients_;
+
+    //! Maximum degree of coefficients affected by variations (-1 if none).
+    int maximumVariationDegree_;
+
+    //! Maximum order of coefficients affected by variations (-1 if none).
+    int maximumVariationOrder_;
+
 };
 
 } // namespace gravitation
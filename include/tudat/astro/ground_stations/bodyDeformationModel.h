@@ -72,6 +72,12 @@ public:
         return motion;
     }
 
+    //! Function to retrieve the current list of body deformation models
+    std::vector< std::shared_ptr< basic_astrodynamics::BodyDeformationModel > >& getBodyDeformationModels( )
+    {
+        return modelList_( );
+    }
+
 protected:
 
     std::function< std::vector< std::shared_ptr< basic_astrodynamics::BodyDeformationModel > >& ( ) > modelList_;
@@ -79,6 +85,29 @@ protected:
     std::shared_ptr< ground_stations::GroundStationState > groundStationState_;
 };
 
+//! Function to replace the body deformation motion of a ground station by values tabulated over a given interval
+/*!
+ *  Function to replace the body deformation motion (BodyDeformationStationMotionModel, either as the station motion model
+ *  itself, or as part of a CombinedStationMotionModel) of a ground station by a TabulatedStationMotionModel, which
+ *  interpolates the displacement tabulated over a given interval. Since all observation models and partials referring to
+ *  the station retrieve its position from the same GroundStationState, the tabulation is shared between all of them. The
+ *  other contributions to the station motion (e.g. piecewise constant displacements) are not tabulated. If the body
+ *  deformation motion was already tabulated, it is tabulated anew from the original model. Body deformation models that
+ *  are added to the body after calling this function are not included in the tabulated values.
+ *  \param groundStationState State of the ground station for which the body deformation is to be tabulated
+ *  \param startTime Start time of the interval on which the displacement is tabulated
+ *  \param endTime End time of the interval on which the displacement is tabulated
+ *  \param timeStep Time step of the tabulation
+ *  \param numberOfInterpolationPoints Number of points used in the Lagrange interpolation (even, between 4 and 12)
+ *  \return True if a body deformation motion was found (and is tabulated), false otherwise
+ */
+bool tabulateBodyDeformationStationMotion(
+        const std::shared_ptr< GroundStationState > groundStationState,
+        const double startTime,
+        const double endTime,
+        const double timeStep = 1800.0,
+        const int numberOfInterpolationPoints = 8 );
+
 }
 
 } // namespace tudat
@@ -0,0 +1,208 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_GROUNDSTATIONNETWORK_H
+#define TUDAT_GROUNDSTATIONNETWORK_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "tudat/astro/ephemerides/rotationalEphemeris.h"
+#include "tudat/astro/ground_stations/groundStation.h"
+
+namespace tudat
+{
+
+namespace ground_stations
+{
+
+//! Class to compute the states and pointing angles of a set of ground stations on a single body in one pass.
+/*!
+ *  Class to compute the states and pointing angles (elevation, azimuth) of a set of ground stations (e.g. an SLR/VLBI
+ *  network, or a set of GNSS receivers) located on a single body in one pass. Evaluating these quantities station by
+ *  station (through the GroundStation and PointingAnglesCalculator objects) evaluates the rotation model of the body once
+ *  per station. This class evaluates the rotation model once per epoch, and applies it to the body-fixed states of all
+ *  stations (stored as the columns of a single matrix) in a single matrix product. Similarly, the pointing angles of all
+ *  stations are computed from the columns of a single matrix of (body-fixed) relative position vectors. The body-fixed
+ *  states and topocentric frames are retrieved from the stations' GroundStationState objects at each update, so that
+ *  changes to the nominal station positions (e.g. during estimation) and station motion models are taken into account.
+ */
+class GroundStationNetwork
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param groundStations List of ground stations in the network, all located on the same body.
+     *  \param bodyRotationModel Rotation model of the body on which the stations are located.
+     */
+    GroundStationNetwork(
+            const std::vector< std::shared_ptr< GroundStation > >& groundStations,
+            const std::shared_ptr< ephemerides::RotationalEphemeris > bodyRotationModel );
+
+    //! Function to update the body-fixed and inertial states of all stations to the given time
+    /*!
+     *  Function to update the body-fixed and inertial (i.e. expressed in the base frame of the body rotation model) states
+     *  of all stations to the given time. The rotation model of the body is evaluated only once. If the states have
+     *  already been updated to the given time, this function does nothing.
+     *  \param time Time at which the states are to be computed.
+     */
+    void updateStationStates( const double time );
+
+    //! Function to compute the inertial states of all stations at the given time.
+    /*!
+     *  Function to compute the states of all stations w.r.t. the center of the body, expressed in the base frame of the
+     *  body rotation model, at the given time.
+     *  \param time Time at which the states are to be computed.
+     *  \return States of all stations (one station per column, in the order of getStationNames)
+     */
+    const Eigen::Matrix< double, 6, Eigen::Dynamic >& getStationStatesInBaseFrame( const double time )
+    {
+        updateStationStates( time );
+        return inertialStationStates_;
+    }
+
+    //! Function to compute the body-fixed states of all stations at the given time.
+    /*!
+     *  Function to compute the states of all stations in the body-fixed frame at the given time.
+     *  \param time Time at which the states are to be computed.
+     *  \return Body-fixed states of all stations (one station per column, in the order of getStationNames)
+     */
+    const Eigen::Matrix< double, 6, Eigen::Dynamic >& getStationStatesInBodyFixedFrame( const double time )
+    {
+        updateStationStates( time );
+        return bodyFixedStationStates_;
+    }
+
+    //! Function to compute the elevation and azimuth angles from all stations to given target positions.
+    /*!
+     *  Function to compute the elevation and azimuth angles from all stations to given target positions, in one pass. The
+     *  angles are identical to those computed by the PointingAnglesCalculator of the individual stations.
+     *  \param targetPositions Positions of the targets w.r.t. the center of the body, expressed in the base frame of the
+     *  body rotation model (one column per station, in the order of getStationNames)
+     *  \param time Time at which the pointing angles are to be computed.
+     *  \param elevationAngles Elevation angles from each station to its target (returned by reference)
+     *  \param azimuthAngles Azimuth angles from each station to its target (returned by reference)
+     */
+    void calculatePointingAnglesToTargets(
+            const Eigen::Matrix3Xd& targetPositions,
+            const double time,
+            Eigen::VectorXd& elevationAngles,
+            Eigen::VectorXd& azimuthAngles );
+
+    //! Function to compute the elevation and azimuth angles from all stations to a single target position.
+    /*!
+     *  Function to compute the elevation and azimuth angles from all stations to a single target position, in one pass.
+     *  \param targetPosition Position of the target w.r.t. the center of the body, expressed in the base frame of the
+     *  body rotation model
+     *  \param time Time at which the pointing angles are to be computed.
+     *  \param elevationAngles Elevation angles from each station to the target (returned by reference)
+     *  \param azimuthAngles Azimuth angles from each station to the target (returned by reference)
+     */
+    void calculatePointingAngles(
+            const Eigen::Vector3d& targetPosition,
+            const double time,
+            Eigen::VectorXd& elevationAngles,
+            Eigen::VectorXd& azimuthAngles )
+    {
+        calculatePointingAnglesToTargets(
+                    targetPosition.replicate( 1, numberOfStations_ ), time, elevationAngles, azimuthAngles );
+    }
+
+    //! Function to compute the elevation angles from all stations to a single target position.
+    /*!
+     *  Function to compute the elevation angles from all stations to a single target position, in one pass.
+     *  \param targetPosition Position of the target w.r.t. the center of the body, expressed in the base frame of the
+     *  body rotation model
+     *  \param time Time at which the elevation angles are to be computed.
+     *  \return Elevation angles from each station to the target (in the order of getStationNames)
+     */
+    Eigen::VectorXd calculateElevationAngles(
+            const Eigen::Vector3d& targetPosition,
+            const double time )
+    {
+        Eigen::VectorXd elevationAngles, azimuthAngles;
+        calculatePointingAngles( targetPosition, time, elevationAngles, azimuthAngles );
+        return elevationAngles;
+    }
+
+    //! Function to retrieve the ground stations in the network
+    std::vector< std::shared_ptr< GroundStation > > getGroundStations( )
+    {
+        return groundStations_;
+    }
+
+    //! Function to retrieve the names of the ground stations in the network (in the order of the matrix columns)
+    std::vector< std::string > getStationNames( )
+    {
+        return stationNames_;
+    }
+
+    //! Function to retrieve the number of stations in the network
+    int getNumberOfStations( )
+    {
+        return numberOfStations_;
+    }
+
+    //! Function to retrieve the rotation model of the body on which the stations are located
+    std::shared_ptr< ephemerides::RotationalEphemeris > getBodyRotationModel( )
+    {
+        return bodyRotationModel_;
+    }
+
+    //! Function to reset the time of the current states, forcing a recomputation at the next update.
+    void resetCurrentTime( )
+    {
+        currentTime_ = TUDAT_NAN;
+    }
+
+private:
+
+    //! Ground stations in the network
+    std::vector< std::shared_ptr< GroundStation > > groundStations_;
+
+    //! Names of the ground stations in the network
+    std::vector< std::string > stationNames_;
+
+    //! Number of stations in the network
+    int numberOfStations_;
+
+    //! Rotation model of the body on which the stations are located
+    std::shared_ptr< ephemerides::RotationalEphemeris > bodyRotationModel_;
+
+    //! Time to which the current states have been updated.
+    double currentTime_;
+
+    //! Current body-fixed states of the stations (one station per column)
+    Eigen::Matrix< double, 6, Eigen::Dynamic > bodyFixedStationStates_;
+
+    //! Current states of the stations, expressed in the base frame of the body rotation model (one station per column)
+    Eigen::Matrix< double, 6, Eigen::Dynamic > inertialStationStates_;
+
+    //! Current East, North and Up unit vectors of the topocentric frames, expressed in the body-fixed frame (one station per column)
+    Eigen::Matrix3Xd eastUnitVectors_, northUnitVectors_, upUnitVectors_;
+
+    //! Current rotation from the body-fixed frame to the base frame of the body rotation model
+    Eigen::Matrix3d currentRotationToBaseFrame_;
+
+    //! Pre-allocated matrix of relative target positions (one station per column)
+    Eigen::Matrix3Xd relativeTargetPositions_;
+};
+
+} // namespace ground_stations
+
+} // namespace tudat
+
+#endif // TUDAT_GROUNDSTATIONNETWORK_H
@@ -226,6 +226,18 @@ public:
         return geocentricUnitVectors_;
     }
 
+    //! Function to retrieve the model for the time variation of the station position
+    std::shared_ptr< StationMotionModel > getStationMotionModel( )
+    {
+        return stationMotionModel_;
+    }
+
+    //! Function to reset the model for the time variation of the station position
+    void setStationMotionModel( const std::shared_ptr< StationMotionModel > stationMotionModel )
+    {
+        stationMotionModel_ = stationMotionModel;
+    }
+
 protected:
 
 
@@ -399,12 +411,105 @@ public:
         return motion;
     }
 
+    std::vector< std::shared_ptr< StationMotionModel > > getModelList( )
+    {
+        return modelList_;
+    }
+
+    void setModelList( const std::vector< std::shared_ptr< StationMotionModel > >& modelList )
+    {
+        modelList_ = modelList;
+    }
 
 protected:
 
     std::vector< std::shared_ptr< StationMotionModel > > modelList_;
 };
 
+//! Station motion model that interpolates the motion tabulated from another station motion model
+/*!
+ *  Station motion model that interpolates the motion (body-fixed displacement and velocity) of a station, tabulated once (at
+ *  construction) from another station motion model on an equidistant time grid over a given interval. This is intended for
+ *  slowly varying, smooth, station motion that is expensive to compute (e.g. tidal deformation, which requires the
+ *  evaluation of the ephemerides of the deforming bodies). The interpolation is done using Lagrange polynomials on the
+ *  equidistant grid, which requires no memory allocation. As the class is not modified after construction, it may be used
+ *  from multiple threads concurrently. Outside of the tabulated interval, the motion is computed directly from the
+ *  original model. Note that the original model is evaluated at construction only, so any subsequent changes to it (e.g.
+ *  the addition of body deformation models) are not reflected in the tabulated values.
+ */
+struct TabulatedStationMotionModel: public StationMotionModel
+{
+public:
+
+    //! Constructor, tabulates the station motion
+    /*!
+     *  Constructor, tabulates the station motion
+     *  \param originalModel Station motion model from which the tabulated values are computed
+     *  \param groundStationState State of the ground station for which the motion is computed
+     *  \param startTime Start time of the interval on which the motion is tabulated
+     *  \param endTime End time of the interval on which the motion is tabulated
+     *  \param timeStep Time step of the tabulation
+     *  \param numberOfInterpolationPoints Number of points used in the Lagrange interpolation (even, between 4 and 12)
+     */
+    TabulatedStationMotionModel(
+            const std::shared_ptr< StationMotionModel > originalModel,
+            const std::shared_ptr< GroundStationState > groundStationState,
+            const double startTime,
+            const double endTime,
+            const double timeStep = 1800.0,
+            const int numberOfInterpolationPoints = 8 );
+
+    ~TabulatedStationMotionModel( ){ }
+
+    Eigen::Vector6d getBodyFixedStationMotion(
+            const double time,
+            const std::shared_ptr< ground_stations::GroundStationState > groundStationState );
+
+    //! Function to retrieve the station motion model from which the tabulated values are computed
+    std::shared_ptr< StationMotionModel > getOriginalModel( )
+    {
+        return originalModel_;
+    }
+
+    //! Function to retrieve the time interval on which the motion is tabulated
+    std::pair< double, double > getTabulatedInterval( )
+    {
+        return std::make_pair( startTime_, endTime_ );
+    }
+
+    //! Function to retrieve the time step of the tabulation
+    double getTimeStep( )
+    {
+        return timeStep_;
+    }
+
+protected:
+
+    //! Station motion model from which the tabulated values are computed
+    std::shared_ptr< StationMotionModel > originalModel_;
+
+    //! Start time of the interval on which the motion is tabulated
+    double startTime_;
+
+    //! End time of the interval on which the motion is tabulated
+    double endTime_;
+
+    //! Time step of the tabulation
+    double timeStep_;
+
+    //! Number of points used in the Lagrange interpolation
+    int numberOfInterpolationPoints_;
+
+    //! Number of tabulation points
+    int numberOfTabulationPoints_;
+
+    //! Tabulated station motion (6 entries at each tabulation point, stored consecutively)
+    std::vector< double > tabulatedValues_;
+
+    //! Denominators of the Lagrange polynomials for equidistant nodes (independent of the interpolation time)
+    std::vector< double > lagrangeDenominators_;
+};
+
 } // namespace ground_stations
 
 } // namespace tudat
@@ -0,0 +1,279 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_BATCH_FITNESS_PROBLEM_H
+#define TUDAT_BATCH_FITNESS_PROBLEM_H
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "tudat/basics/parallelization.h"
+
+namespace tudat
+{
+
+namespace low_thrust_trajectories
+{
+
+namespace batch_fitness_detail
+{
+
+template< typename T, typename = void >
+struct has_get_nobj: std::false_type { };
+
+template< typename T >
+struct has_get_nobj< T, std::void_t< decltype( std::declval< const T& >( ).get_nobj( ) ) > >: std::true_type { };
+
+template< typename T, typename = void >
+struct has_get_nec: std::false_type { };
+
+template< typename T >
+struct has_get_nec< T, std::void_t< decltype( std::declval< const T& >( ).get_nec( ) ) > >: std::true_type { };
+
+template< typename T, typename = void >
+struct has_get_nic: std::false_type { };
+
+template< typename T >
+struct has_get_nic< T, std::void_t< decltype( std::declval< const T& >( ).get_nic( ) ) > >: std::true_type { };
+
+template< typename T, typename = void >
+struct has_get_name: std::false_type { };
+
+template< typename T >
+struct has_get_name< T, std::void_t< decltype( std::declval< const T& >( ).get_name( ) ) > >: std::true_type { };
+
+} // namespace batch_fitness_detail
+
+//! Adaptor that adds a parallel batch fitness evaluation to an optimisation problem
+/*!
+ *  Adaptor that wraps a (pagmo-style) user-defined optimisation problem, and evaluates the fitness of an entire population
+ *  of decision vectors in a single call to batch_fitness, distributed over a pool of threads. This allows generational
+ *  algorithms (e.g. using pagmo's bfe) to evaluate their populations in parallel, without the overhead of one island per
+ *  thread.
+ *
+ *  The adaptor holds one copy of the problem per worker (thread), so that problems may keep (mutable) reusable state, such
+ *  as the leg objects of a trajectory, which is re-evaluated for each decision vector. The worker problems must therefore
+ *  not share any state that is modified during the fitness evaluation (in particular, they should not share legs or
+ *  SystemOfBodies objects with non-thread-safe ephemerides). Work is distributed deterministically: decision vector i is
+ *  evaluated by worker ( i mod number of workers ), so that, provided the fitness of each worker problem depends only on
+ *  the decision vector, results do not depend on the number of workers.
+ *
+ *  The fitness, bounds, number of objectives and constraints, and name of the problem are forwarded to the first worker
+ *  problem. Gradients are not forwarded, as the adaptor is intended for gradient-free generational algorithms. The thread
+ *  pool is created when first needed, and is not shared between copies of the adaptor, so that (as for any pagmo problem)
+ *  each island may use its own copy. A single adaptor object must not be used from multiple threads simultaneously.
+ */
+template< typename UserDefinedProblem >
+class BatchFitnessProblem
+{
+public:
+
+    //! Default constructor, required for use as pagmo user-defined problem
+    BatchFitnessProblem( ): workerProblems_( 1 ) { }
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param workerProblems List of optimisation problems, one per worker, with identical settings and no shared state
+     */
+    BatchFitnessProblem( const std::vector< UserDefinedProblem >& workerProblems ):
+        workerProblems_( workerProblems )
+    {
+        if( workerProblems_.size( ) == 0 )
+        {
+            throw std::runtime_error( "Error when creating batch fitness problem, no worker problems provided" );
+        }
+    }
+
+    //! Constructor, copying a single problem for each worker
+    /*!
+     *  Constructor, copying a single problem for each worker. Only to be used if copies of the problem do not share any
+     *  state that is modified during the fitness evaluation.
+     *  \param problem Optimisation problem
+     *  \param numberOfThreads Number of workers (threads) used for batch fitness evaluation
+     */
+    BatchFitnessProblem( const UserDefinedProblem& problem, const int numberOfThreads ):
+        workerProblems_( numberOfThreads > 0 ? numberOfThreads : 0, problem )
+    {
+        if( numberOfThreads <= 0 )
+        {
+            throw std::runtime_error( "Error when creating batch fitness problem, number of threads (" +
+                                      std::to_string( numberOfThreads ) + ") must be positive" );
+        }
+    }
+
+    //! Copy constructor, copies worker problems but not the thread pool
+    BatchFitnessProblem( const BatchFitnessProblem& otherProblem ):
+        workerProblems_( otherProblem.workerProblems_ ) { }
+
+    //! Assignment operator, copies worker problems but not the thread pool
+    BatchFitnessProblem& operator=( const BatchFitnessProblem& otherProblem )
+    {
+        if( this != &otherProblem )
+        {
+            workerProblems_ = otherProblem.workerProblems_;
+            taskPool_.reset( );
+        }
+        return *this;
+    }
+
+    //! Function to compute the fitness of a single decision vector
+    std::vector< double > fitness( const std::vector< double >& decisionVector ) const
+    {
+        return workerProblems_.at( 0 ).fitness( decisionVector );
+    }
+
+    //! Function to compute the fitness of a batch of decision vectors, in parallel
+    /*!
+     *  Function to compute the fitness of a batch of decision vectors, in parallel
+     *  \param decisionVectors Concatenated decision vectors (size equal to the number of decision vectors times the
+     *  dimension of the problem)
+     *  \return Concatenated fitness vectors (size equal to the number of decision vectors times the fitness dimension)
+     */
+    std::vector< double > batch_fitness( const std::vector< double >& decisionVectors ) const
+    {
+        const int problemDimension = get_bounds( ).first.size( );
+        const int fitnessDimension = get_nobj( ) + get_nec( ) + get_nic( );
+        if( problemDimension == 0 || decisionVectors.size( ) % problemDimension != 0 )
+        {
+            throw std::runtime_error( "Error in batch fitness evaluation, size of decision vectors (" +
+                                      std::to_string( decisionVectors.size( ) ) +
+                                      ") is not a multiple of the problem dimension (" +
+                                      std::to_string( problemDimension ) + ")" );
+        }
+
+        const int numberOfEvaluations = decisionVectors.size( ) / problemDimension;
+        const int numberOfWorkers = workerProblems_.size( );
+        std::vector< double > fitnessVectors( numberOfEvaluations * fitnessDimension );
+
+        auto evaluateWorkerFitness = [ & ]( const int workerIndex )
+        {
+            std::vector< double > decisionVector( problemDimension );
+            for( int i = workerIndex; i < numberOfEvaluations; i += numberOfWorkers )
+            {
+                std::copy( decisionVectors.begin( ) + i * problemDimension,
+                           decisionVectors.begin( ) + ( i + 1 ) * problemDimension, decisionVector.begin( ) );
+                const std::vector< double > currentFitness = workerProblems_.at( workerIndex ).fitness( decisionVector );
+                if( static_cast< int >( currentFitness.size( ) ) != fitnessDimension )
+                {
+                    throw std::runtime_error( "Error in batch fitness evaluation, fitness of decision vector " +
+                                              std::to_string( i ) + " has size " +
+                                              std::to_string( currentFitness.size( ) ) + ", expected " +
+                                              std::to_string( fitnessDimension ) );
+                }
+                std::copy( currentFitness.begin( ), currentFitness.end( ),
+                           fitnessVectors.begin( ) + i * fitnessDimension );
+            }
+        };
+
+        if( numberOfWorkers == 1 || numberOfEvaluations <= 1 )
+        {
+            for( int workerIndex = 0; workerIndex < std::min( numberOfWorkers, numberOfEvaluations ); workerIndex++ )
+            {
+                evaluateWorkerFitness( workerIndex );
+            }
+        }
+        else
+        {
+            if( taskPool_ == nullptr )
+            {
+                taskPool_ = std::make_shared< utilities::ParallelTaskPool >( numberOfWorkers );
+            }
+            taskPool_->executeTasks( std::min( numberOfWorkers, numberOfEvaluations ), evaluateWorkerFitness );
+        }
+
+        return fitnessVectors;
+    }
+
+    //! Function to retrieve the bounds of the decision vector
+    std::pair< std::vector< double >, std::vector< double > > get_bounds( ) const
+    {
+        return workerProblems_.at( 0 ).get_bounds( );
+    }
+
+    //! Function to retrieve the number of objectives (1 if not defined by the problem)
+    std::size_t get_nobj( ) const
+    {
+        return getNumberOfObjectives( workerProblems_.at( 0 ) );
+    }
+
+    //! Function to retrieve the number of equality constraints (0 if not defined by the problem)
+    std::size_t get_nec( ) const
+    {
+        return getNumberOfEqualityConstraints( workerProblems_.at( 0 ) );
+    }
+
+    //! Function to retrieve the number of inequality constraints (0 if not defined by the problem)
+    std::size_t get_nic( ) const
+    {
+        return getNumberOfInequalityConstraints( workerProblems_.at( 0 ) );
+    }
+
+    //! Function to retrieve the name of the problem
+    std::string get_name( ) const
+    {
+        return getProblemName( workerProblems_.at( 0 ) ) + " (batch fitness)";
+    }
+
+    //! Function to retrieve the number of workers
+    int getNumberOfWorkers( ) const
+    {
+        return workerProblems_.size( );
+    }
+
+    //! Function to retrieve the problem of a given worker
+    const UserDefinedProblem& getWorkerProblem( const int workerIndex ) const
+    {
+        return workerProblems_.at( workerIndex );
+    }
+
+private:
+
+    template< typename T, typename std::enable_if< batch_fitness_detail::has_get_nobj< T >::value, int >::type = 0 >
+    static std::size_t getNumberOfObjectives( const T& problem ) { return problem.get_nobj( ); }
+
+    template< typename T, typename std::enable_if< !batch_fitness_detail::has_get_nobj< T >::value, int >::type = 0 >
+    static std::size_t getNumberOfObjectives( const T& ) { return 1; }
+
+    template< typename T, typename std::enable_if< batch_fitness_detail::has_get_nec< T >::value, int >::type = 0 >
+    static std::size_t getNumberOfEqualityConstraints( const T& problem ) { return problem.get_nec( ); }
+
+    template< typename T, typename std::enable_if< !batch_fitness_detail::has_get_nec< T >::value, int >::type = 0 >
+    static std::size_t getNumberOfEqualityConstraints( const T& ) { return 0; }
+
+    template< typename T, typename std::enable_if< batch_fitness_detail::has_get_nic< T >::value, int >::type = 0 >
+    static std::size_t getNumberOfInequalityConstraints( const T& problem ) { return problem.get_nic( ); }
+
+    template< typename T, typename std::enable_if< !batch_fitness_detail::has_get_nic< T >::value, int >::type = 0 >
+    static std::size_t getNumberOfInequalityConstraints( const T& ) { return 0; }
+
+    template< typename T, typename std::enable_if< batch_fitness_detail::has_get_name< T >::value, int >::type = 0 >
+    static std::string getProblemName( const T& problem ) { return problem.get_name( ); }
+
+    template< typename T, typename std::enable_if< !batch_fitness_detail::has_get_name< T >::value, int >::type = 0 >
+    static std::string getProblemName( const T& ) { return "Unnamed problem"; }
+
+    //! List of optimisation problems, one per worker
+    std::vector< UserDefinedProblem > workerProblems_;
+
+    //! Thread pool used for batch fitness evaluation (created when first needed)
+    mutable std::shared_ptr< utilities::ParallelTaskPool > taskPool_;
+};
+
+} // namespace low_thrust_trajectories
+
+} // namespace tudat
+
+#endif // TUDAT_BATCH_FITNESS_PROBLEM_H
@@ -135,13 +135,12 @@ private:
     //! Satisfy boundary conditions in normal direction.
     void satisfyNormalBoundaryConditions( const Eigen::VectorXd& freeCoefficients );
 
-    //! Define angular velocity due to the third component of the composite function only.
-    double computeDerivativePolarAngleDueToThirdComponent(
-            const double timeSinceDeparture, const Eigen::Vector2d& matrixK );
+    //! Update values of the velocity function components at the quadrature nodes, and boundary-value matrices, if the
+    //! time of flight has changed since the last update.
+    void updateTimeOfFlightDependentValues( );
 
-    //! Define the angular velocity due to all the other components of the composite function, once combined.
-    double computeDerivativePolarAngleDueToOtherComponents(
-            const double timeSinceDeparture, const Eigen::Vector2d& matrixL, const Eigen::VectorXd& freeCoefficients );
+    //! Compute radial distance at the quadrature nodes, from the values of the radial velocity function components.
+    Eigen::ArrayXd computeRadialDistanceAtQuadratureNodes( );
 
     //! Compute third fixed coefficient of the normal velocity composite function, so that the condition on the final polar angle
     //! is fulfilled.
@@ -216,6 +215,29 @@ private:
 
     //! Previously computed thrust acceleration values
     std::map< double, Eigen::Vector3d > thrustAccelerationVectorCache_;
+
+    //! Time of flight for which the values at the quadrature nodes (and boundary-value matrices) were last computed.
+    double timeOfFlightOfQuadratureNodeValues_;
+
+    //! Times since departure of the quadrature nodes used to compute the deltaV and final polar angle.
+    Eigen::ArrayXd quadratureNodeTimes_;
+
+    //! Weights of the quadrature nodes, scaled to the time of flight.
+    Eigen::ArrayXd quadratureNodeWeights_;
+
+    //! Values of velocity function components at the quadrature nodes (one row per node, one column per component).
+    Eigen::MatrixXd radialVelocityComponentsAtQuadratureNodes_;
+    Eigen::MatrixXd normalVelocityComponentsAtQuadratureNodes_;
+
+    //! Derivatives of velocity function components at the quadrature nodes (one row per node, one column per component).
+    Eigen::MatrixXd radialVelocityComponentDerivativesAtQuadratureNodes_;
+    Eigen::MatrixXd normalVelocityComponentDerivativesAtQuadratureNodes_;
+    Eigen::MatrixXd axialVelocityComponentDerivativesAtQuadratureNodes_;
+
+    //! Integrals of velocity function components from departure to the quadrature nodes (one row per node, one column
+    //! per component).
+    Eigen::MatrixXd radialVelocityComponentIntegralsAtQuadratureNodes_;
+    Eigen::MatrixXd axialVelocityComponentIntegralsAtQuadratureNodes_;
 };
 
 
@@ -128,6 +128,15 @@ protected:
     //! Compute the inverse of the boundary conditions matrix.
     Eigen::MatrixXd computeInverseMatrixBoundaryConditions( );
 
+    //! Update values of the radial distance and elevation angle function components (and their derivatives) at the
+    //! quadrature nodes, if the initial or final azimuth angle has changed since the last update.
+    void updateAzimuthDependentValues( );
+
+    //! Compute radial distance and elevation angle (and derivatives up to third order w.r.t. azimuth angle) at the
+    //! quadrature nodes, from the values of the composite function components (one row per node).
+    void computeShapeAtQuadratureNodes( Eigen::Matrix< double, Eigen::Dynamic, 4 >& radialDistanceAtNodes,
+                                        Eigen::Matrix< double, Eigen::Dynamic, 4 >& elevationAngleAtNodes );
+
     //! Compute the initial value of the constant alpha, as defined in Eq. 7.16 of Roegiers (2014) to express the boundary conditions.
     double computeValueConstantAlpha ( Eigen::Vector6d stateParametrizedByAzimuthAngle );
 
@@ -300,6 +309,23 @@ private:
 
     std::shared_ptr< numerical_quadrature::QuadratureSettings< double > > quadratureSettings_;
 
+    //! Inverse of the boundary conditions matrix, for the current boundary conditions.
+    Eigen::MatrixXd inverseMatrixBoundaryConditions_;
+
+    //! Initial and final azimuth angle for which the values at the quadrature nodes were last computed.
+    std::pair< double, double > azimuthRangeOfQuadratureNodeValues_;
+
+    //! Weights of the quadrature nodes used to compute the time of flight and deltaV, scaled to the azimuth range.
+    Eigen::ArrayXd quadratureNodeWeights_;
+
+    //! Values of the radial distance function components at the quadrature nodes (one row per node, one column per
+    //! component), with vector entry i containing the i-th derivative w.r.t. azimuth angle (i = 0, 1, 2, 3).
+    std::vector< Eigen::MatrixXd > radialDistanceComponentsAtQuadratureNodes_;
+
+    //! Values of the elevation angle function components at the quadrature nodes (one row per node, one column per
+    //! component), with vector entry i containing the i-th derivative w.r.t. azimuth angle (i = 0, 1, 2, 3).
+    std::vector< Eigen::MatrixXd > elevationAngleComponentsAtQuadratureNodes_;
+
 };
 
 
@@ -167,18 +167,49 @@ public:
 
     int convertTimeToLegSegment( double currentTime );
 
-    std::shared_ptr< simulation_setup::ThrustAccelerationSettings > getThrustAccelerationSettingsFullLeg(
-            const simulation_setup::SystemOfBodies& bodies );
+    //! Add the engine model of the full leg to the body to propagate, and return the associated thrust acceleration settings.
+    /*!
+     *  Add the engine model of the full leg to the body to propagate (replacing any existing engine with the same name), and
+     *  return the associated thrust acceleration settings. The thrust direction is defined in the body-fixed frame of the
+     *  body to propagate, which must therefore coincide with the propagation frame (e.g. the body has no rotation model).
+     *  \param bodies System of bodies
+     *  \param bodyToPropagate Name of the body to propagate, to which the engine is added
+     *  \return Thrust acceleration settings using the engine of the leg
+     */
+    std::shared_ptr< simulation_setup::AccelerationSettings > getThrustAccelerationSettingsFullLeg(
+            const simulation_setup::SystemOfBodies& bodies,
+            const std::string& bodyToPropagate );
 
     double getMassAtSegment( const int segment )
     {
         return segmentMasses_.at( segment );
     }
 
+    //! Compute partial derivatives of the total deltaV and match point states w.r.t. the throttles.
+    /*!
+     *  Compute partial derivatives of the total deltaV, and of the states at the match point from the forward and backward
+     *  propagations, w.r.t. the throttles (ordered as x_0, y_0, z_0, x_1, ... for segments 0, 1, ...). The partials are
+     *  obtained by applying the chain rule through the mass propagation, the impulsive deltaVs and the Kepler arcs of each
+     *  segment, so that the cost of this function is proportional to the number of segments. The state transition matrix
+     *  of each (half-segment) Kepler arc is computed using central differences. This function also updates the states at
+     *  the match point, so that the propagate...ToMatchPoint functions need not be called.
+     *  \param totalDeltaVPartials Partials of the total deltaV w.r.t. the throttles (1 x 3N, returned by reference)
+     *  \param matchPointStateForwardPropagationPartials Partials of the state at the match point from the forward
+     *  propagation w.r.t. the throttles (6 x 3N, returned by reference)
+     *  \param matchPointStateBackwardPropagationPartials Partials of the state at the match point from the backward
+     *  propagation w.r.t. the throttles (6 x 3N, returned by reference)
+     */
+    void computeThrottlePartials(
+            Eigen::MatrixXd& totalDeltaVPartials,
+            Eigen::MatrixXd& matchPointStateForwardPropagationPartials,
+            Eigen::MatrixXd& matchPointStateBackwardPropagationPartials );
+
 protected:
 
-    std::shared_ptr< simulation_setup::ThrustAccelerationSettings > getConstantThrustAccelerationSettingsPerSegment(
-            unsigned int indexSegment );
+    std::shared_ptr< simulation_setup::AccelerationSettings > getConstantThrustAccelerationSettingsPerSegment(
+            const unsigned int indexSegment,
+            const simulation_setup::SystemOfBodies& bodies,
+            const std::string& bodyToPropagate );
 
     basic_astrodynamics::AccelerationMap getAccelerationModelPerSegment(
             const unsigned int indexSegment,
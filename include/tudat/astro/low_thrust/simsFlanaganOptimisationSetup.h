@@ -37,7 +37,7 @@ struct SimsFlanaganProblem
     typedef Eigen::Matrix< double, 6, 1 > StateType;
 
     //! Default constructor, required for Pagmo compatibility
-    SimsFlanaganProblem( ){ }
+    SimsFlanaganProblem( ): numberOfThreads_( 1 ){ }
 
     //! Constructor.
     SimsFlanaganProblem( const Eigen::Vector6d& stateAtDeparture,
@@ -49,11 +49,32 @@ struct SimsFlanaganProblem
                          const int numberSegments,
                          const double timeOfFlight,
                          const std::pair< std::vector< double >, double > initialGuessThrustModel,
-                         const double relativeToleranceConstraints = 1.0e-6 );
+                         const double relativeToleranceConstraints = 1.0e-6,
+                         const int numberOfThreads = 1 );
 
     //! Calculate the fitness as a function of the parameter vector x
     std::vector< double > fitness( const std::vector< double > &x ) const;
 
+    //! Calculate the gradient of the fitness w.r.t. the parameter vector x
+    /*!
+     *  Calculate the gradient of the fitness w.r.t. the parameter vector x, by applying the chain rule to the partials of
+     *  the deltaV and match point states computed by SimsFlanaganModel::computeThrottlePartials. Its presence allows
+     *  gradient-based (e.g. NLopt SLSQP) algorithms to be used without finite differencing the full fitness function.
+     *  \param x Parameter vector (throttles of all segments)
+     *  \return Gradient of the fitness (dense, one entry per parameter)
+     */
+    std::vector< double > gradient( const std::vector< double > &x ) const;
+
+    //! Calculate the fitness for a batch of parameter vectors, distributed over numberOfThreads_ threads
+    /*!
+     *  Calculate the fitness for a batch of parameter vectors, distributed over numberOfThreads_ threads (see constructor).
+     *  Used by pagmo (e.g. by the batch fitness evaluator of population-based algorithms) to evaluate a full population at
+     *  once. The specific impulse function must be thread-safe if more than one thread is used.
+     *  \param xs Concatenated parameter vectors
+     *  \return Concatenated fitness vectors
+     */
+    std::vector< double > batch_fitness( const std::vector< double > &xs ) const;
+
     //! Retrieve the allowable limits of the parameter vector x: pair containing minima and maxima of parameter values
     std::pair< std::vector< double >, std::vector< double > > get_bounds() const;
 
@@ -117,6 +138,9 @@ private:
     //! Relative tolerance for optimisation constraints.
     double relativeToleranceConstraints_;
 
+    //! Number of threads over which the batch fitness evaluations are distributed.
+    int numberOfThreads_;
+
 
 };
 
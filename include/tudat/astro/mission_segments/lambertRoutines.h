@@ -11,6 +11,7 @@
  *      Battin, R.H. An Introduction to the math and Methods of astro,
  *          AIAA Education Series, 1999.
  *      Izzo, D. lambert_problem.h, http://esa.github.io/pykep/ .
+ *      Izzo, D. Revisiting Lambert's problem, Celestial Mechanics and Dynamical Astronomy, 121:1-15, 2015.
  *      Gooding, R.H. A procedure for the solution of Lambert's orbital
  *          boundary-value problem, Celestial Mechanics and Dynamical Astronomy,
  *          48:145-165, 1990.
@@ -46,9 +47,9 @@ namespace mission_segments
  * in non-dimensional units, meaning that position, time-of-flight, and
  * gravitational parameter can be provided in any units, as long as they are
  * consistent across all quantities. Results will be returned in the same units
- * as the input variables.  Note that while this implementation does not
- * support multi-revolution transfers, the original algorithm (see link above)
- * does. The root-finder (Secant Method) is currently hard-coded.
+ * as the input variables. The problem is solved by solveLambertProblemIzzoHouseholder (for zero revolutions), and an
+ * exception is thrown if no solution is found. For multi-revolution transfers, and for the solution of many problems at
+ * once, see solveLambertProblemIzzoHouseholder and solveLambertProblemsIzzo.
  * \param cartesianPositionAtDeparture Cartesian position at departure. [Input]
  * \param cartesianPositionAtArrival Cartesian position at arrival. [Input]
  * \param timeOfFlight Time-of-flight between departure and arrival. [Input]
@@ -71,6 +72,95 @@ void solveLambertProblemIzzo( const Eigen::Vector3d& cartesianPositionAtDepartur
                               const double convergenceTolerance = 1e-9,
                               const unsigned int maximumNumberOfIterations = 50 );
 
+//! Solve Lambert Problem using Izzo's (2015) algorithm, for a given number of revolutions and branch.
+/*!
+ * Solves the Lambert Problem using the algorithm of Izzo (2015), as implemented in PyKEP: the time-of-flight equation
+ * is written in terms of the Lancaster-Blanchard variable x, and solved using Householder iterations, starting from an
+ * analytical initial guess. This function does not allocate any memory, and does not throw exceptions, so that it may
+ * be called in tight loops (see also solveLambertProblemsIzzo). For multi-revolution transfers, two solutions exist
+ * (if the time of flight is larger than the minimum time of flight for the given number of revolutions), denoted as
+ * the left and right branch.
+ * \param cartesianPositionAtDeparture Cartesian position at departure. [Input]
+ * \param cartesianPositionAtArrival Cartesian position at arrival. [Input]
+ * \param timeOfFlight Time-of-flight between departure and arrival. [Input]
+ * \param gravitationalParameter Gravitational parameter of the central body. [Input]
+ * \param cartesianVelocityAtDeparture Velocity at departure (NaN if no solution was found). [Output]
+ * \param cartesianVelocityAtArrival Velocity at arrival (NaN if no solution was found). [Output]
+ * \param numberOfRevolutions Number of complete revolutions of the transfer. [Input, Optional]
+ * \param isRightBranch Boolean flag to indicate whether the right branch (corresponding to the high energy transfer)
+ *          is to be used, only relevant for multi-revolution transfers. [Input, Optional]
+ * \param isRetrograde Boolean flag to indicate direction of motion. [Input, Optional]
+ * \param convergenceTolerance Convergence tolerance of the Householder iterations (on x). [Input, Optional]
+ * \param maximumNumberOfIterations Maximum number of Householder iterations. [Input, Optional]
+ * \return True if a solution was found, false if the input is invalid, the requested number of revolutions is not
+ *          feasible for the given time of flight, or the iterations did not converge.
+ */
+bool solveLambertProblemIzzoHouseholder( const Eigen::Vector3d& cartesianPositionAtDeparture,
+                                         const Eigen::Vector3d& cartesianPositionAtArrival,
+                                         const double timeOfFlight,
+                                         const double gravitationalParameter,
+                                         Eigen::Vector3d& cartesianVelocityAtDeparture,
+                                         Eigen::Vector3d& cartesianVelocityAtArrival,
+                                         const int numberOfRevolutions = 0,
+                                         const bool isRightBranch = false,
+                                         const bool isRetrograde = false,
+                                         const double convergenceTolerance = 1.0e-11,
+                                         const unsigned int maximumNumberOfIterations = 15 );
+
+//! Compute maximum number of revolutions for which a solution to the Lambert problem exists, using Izzo's algorithm.
+/*!
+ * Computes maximum number of revolutions for which a solution to the Lambert problem exists, using Izzo's (2015)
+ * algorithm, by comparing the time of flight to the minimum time of flight of the multi-revolution transfers.
+ * \param cartesianPositionAtDeparture Cartesian position at departure. [Input]
+ * \param cartesianPositionAtArrival Cartesian position at arrival. [Input]
+ * \param timeOfFlight Time-of-flight between departure and arrival. [Input]
+ * \param gravitationalParameter Gravitational parameter of the central body. [Input]
+ * \param isRetrograde Boolean flag to indicate direction of motion. [Input, Optional]
+ * \return Maximum number of revolutions (-1 if input is invalid).
+ */
+int computeMaximumNumberOfRevolutionsIzzo( const Eigen::Vector3d& cartesianPositionAtDeparture,
+                                           const Eigen::Vector3d& cartesianPositionAtArrival,
+                                           const double timeOfFlight,
+                                           const double gravitationalParameter,
+                                           const bool isRetrograde = false );
+
+//! Solve a batch of Lambert problems using Izzo's (2015) algorithm.
+/*!
+ * Solves a batch of Lambert problems using Izzo's (2015) algorithm (see solveLambertProblemIzzoHouseholder), for
+ * instance for the evaluation of porkchop plots. The input and output vectors are stored as structure-of-arrays: row
+ * i of each matrix contains the vector of problem i, so that each Cartesian component is contiguous in memory. No
+ * memory is allocated if the output matrices already have the correct size. Problems for which no solution is found are
+ * not reported by an exception, but have NaN velocities. The problems may be distributed over multiple threads, in
+ * which case the results are identical to those of a single thread.
+ * \param cartesianPositionsAtDeparture Cartesian positions at departure (one row per problem). [Input]
+ * \param cartesianPositionsAtArrival Cartesian positions at arrival (one row per problem). [Input]
+ * \param timesOfFlight Times-of-flight between departure and arrival (one entry per problem). [Input]
+ * \param gravitationalParameters Gravitational parameter of the central body (one entry per problem, or a single entry
+ *          used for all problems). [Input]
+ * \param cartesianVelocitiesAtDeparture Velocities at departure (one row per problem). [Output]
+ * \param cartesianVelocitiesAtArrival Velocities at arrival (one row per problem). [Output]
+ * \param numberOfRevolutions Number of complete revolutions of the transfers. [Input, Optional]
+ * \param isRightBranch Boolean flag to indicate whether the right branch is to be used, only relevant for
+ *          multi-revolution transfers. [Input, Optional]
+ * \param isRetrograde Boolean flag to indicate direction of motion. [Input, Optional]
+ * \param numberOfThreads Number of threads over which the problems are distributed. [Input, Optional]
+ * \param convergenceTolerance Convergence tolerance of the Householder iterations (on x). [Input, Optional]
+ * \param maximumNumberOfIterations Maximum number of Householder iterations. [Input, Optional]
+ * \return Number of problems for which no solution was found.
+ */
+int solveLambertProblemsIzzo( const Eigen::Matrix< double, Eigen::Dynamic, 3 >& cartesianPositionsAtDeparture,
+                              const Eigen::Matrix< double, Eigen::Dynamic, 3 >& cartesianPositionsAtArrival,
+                              const Eigen::VectorXd& timesOfFlight,
+                              const Eigen::VectorXd& gravitationalParameters,
+                              Eigen::Matrix< double, Eigen::Dynamic, 3 >& cartesianVelocitiesAtDeparture,
+                              Eigen::Matrix< double, Eigen::Dynamic, 3 >& cartesianVelocitiesAtArrival,
+                              const int numberOfRevolutions = 0,
+                              const bool isRightBranch = false,
+                              const bool isRetrograde = false,
+                              const int numberOfThreads = 1,
+                              const double convergenceTolerance = 1.0e-11,
+                              const unsigned int maximumNumberOfIterations = 15 );
+
 //! Compute time-of-flight using Lagrange's equation.
 /*!
  * Computes the time-of-flight according to Lagrange's equation as a function
@@ -57,6 +57,28 @@ public:
             const std::vector< Eigen::VectorXd >& legFreeParameters,
             const std::vector< Eigen::VectorXd >& nodeFreeParameters );
 
+    //! Update trajectory with new independent variables, terminating as soon as the Delta V exceeds a budget
+    /*!
+     *  Update trajectory with new independent variables, terminating the evaluation as soon as the accumulated Delta V
+     *  of the legs and nodes evaluated so far exceeds the given budget. Since the Delta V of each leg and node is
+     *  non-negative, the total Delta V of the trajectory then exceeds the budget as well. If the evaluation is
+     *  terminated, the trajectory is not in a valid state (its Delta V etc. cannot be retrieved).
+     *  \param nodeTimes Times at the nodes
+     *  \param legFreeParameters Free parameters of each leg
+     *  \param nodeFreeParameters Free parameters of each node
+     *  \param maximumDeltaV Delta V budget
+     *  \param numberOfNodeTimesUsed Number of leading entries of nodeTimes on which the legs and nodes that were
+     *  evaluated depend (output). If the evaluation is terminated, any trajectory with the same values of these node times
+     *  (and the same free parameters) exceeds the budget as well.
+     *  \return True if the trajectory was fully evaluated, false if the evaluation was terminated
+     */
+    bool evaluateTrajectoryWithinDeltaVBudget(
+            const std::vector< double >& nodeTimes,
+            const std::vector< Eigen::VectorXd >& legFreeParameters,
+            const std::vector< Eigen::VectorXd >& nodeFreeParameters,
+            const double maximumDeltaV,
+            int& numberOfNodeTimesUsed );
+
     //! Retrieve total trajectory Delta V
     double getTotalDeltaV( );
 
@@ -0,0 +1,154 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_TRANSFER_TRAJECTORY_GRID_SEARCH_H
+#define TUDAT_TRANSFER_TRAJECTORY_GRID_SEARCH_H
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/mission_segments/transferTrajectory.h"
+
+namespace tudat
+{
+
+namespace mission_segments
+{
+
+//! Class for the evaluation of the Delta V of a transfer trajectory on a grid or batch of node times, in parallel
+/*!
+ *  Class for the evaluation of the Delta V of a transfer trajectory for many sets of node times (with fixed leg and node
+ *  free parameters), for instance to generate porkchop plots, or to scan (and prune) the departure dates and times of
+ *  flight of a multiple gravity assist sequence. The evaluations are distributed over a number of workers, each of which
+ *  evaluates its own TransferTrajectory object. The worker trajectories must therefore not share any legs or nodes (i.e.
+ *  each must be created by a separate call to createTransferTrajectory with the same settings). Since the ephemerides
+ *  of the bodies are evaluated concurrently, worker trajectories should be created from separate SystemOfBodies objects,
+ *  unless the ephemerides are known to be thread-safe. Work is distributed deterministically: evaluation i (or, for a
+ *  grid, departure time i) is done by worker ( i mod number of workers ), so that results do not depend on the number of
+ *  workers.
+ *
+ *  Optionally, a Delta V budget can be provided. The evaluation of a trajectory is then terminated as soon as the
+ *  accumulated Delta V of its legs and nodes exceeds the budget. For a grid, all grid points that share the node times on
+ *  which the evaluated legs and nodes depend are pruned as well, without being evaluated. Trajectories that exceed the
+ *  budget are assigned an infinite Delta V, trajectories for which the evaluation fails (e.g. an infeasible swingby) are
+ *  assigned a NaN Delta V.
+ */
+class TransferTrajectoryGridSearch
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param workerTrajectories List of transfer trajectories, one per worker, with identical settings and no shared
+     *  legs or nodes.
+     *  \param legFreeParameters Free parameters of each leg, used for all evaluations (default none, i.e. all legs without
+     *  free parameters)
+     *  \param nodeFreeParameters Free parameters of each node, used for all evaluations (default none, i.e. all nodes
+     *  without free parameters)
+     */
+    TransferTrajectoryGridSearch(
+            const std::vector< std::shared_ptr< TransferTrajectory > >& workerTrajectories,
+            const std::vector< Eigen::VectorXd >& legFreeParameters = std::vector< Eigen::VectorXd >( ),
+            const std::vector< Eigen::VectorXd >& nodeFreeParameters = std::vector< Eigen::VectorXd >( ) );
+
+    //! Function to evaluate the total Delta V of the trajectory for a batch of node times
+    /*!
+     *  Function to evaluate the total Delta V of the trajectory for a batch of node times
+     *  \param nodeTimesList List of node times, one entry per trajectory that is to be evaluated
+     *  \param maximumDeltaV Delta V budget (default none)
+     *  \return Total Delta V of each trajectory (infinity if exceeding the budget, NaN if evaluation failed)
+     */
+    Eigen::VectorXd evaluateTotalDeltaV(
+            const std::vector< std::vector< double > >& nodeTimesList,
+            const double maximumDeltaV = std::numeric_limits< double >::infinity( ) );
+
+    //! Function to evaluate the total Delta V of the trajectory on a grid of departure times and times of flight
+    /*!
+     *  Function to evaluate the total Delta V of the trajectory on a grid of departure times and times of flight. The
+     *  node times of grid point ( i_0, i_1, ..., i_N ) are t_0 = departureTimes[ i_0 ] and
+     *  t_j = t_{j-1} + timesOfFlightPerLeg[ j - 1 ][ i_j ].
+     *  \param departureTimes Departure times (times at the first node)
+     *  \param timesOfFlightPerLeg Times of flight of each leg
+     *  \param maximumDeltaV Delta V budget (default none)
+     *  \return Total Delta V at each grid point (infinity if exceeding the budget, NaN if evaluation failed), stored in
+     *  row-major order (i.e. with the index of the last leg varying fastest)
+     */
+    Eigen::VectorXd evaluateTotalDeltaVOnGrid(
+            const std::vector< double >& departureTimes,
+            const std::vector< std::vector< double > >& timesOfFlightPerLeg,
+            const double maximumDeltaV = std::numeric_limits< double >::infinity( ) );
+
+    //! Function to compute the total Delta V of a single-leg trajectory, for a porkchop plot
+    /*!
+     *  Function to compute the total Delta V of a single-leg trajectory on a grid of departure times and times of flight,
+     *  for a porkchop plot.
+     *  \param departureTimes Departure times
+     *  \param timesOfFlight Times of flight
+     *  \param maximumDeltaV Delta V budget (default none)
+     *  \return Total Delta V (infinity if exceeding the budget, NaN if evaluation failed), with one row per departure time
+     *  and one column per time of flight
+     */
+    Eigen::MatrixXd computePorkchopDeltaV(
+            const std::vector< double >& departureTimes,
+            const std::vector< double >& timesOfFlight,
+            const double maximumDeltaV = std::numeric_limits< double >::infinity( ) );
+
+    //! Function to retrieve the number of trajectory evaluations that were skipped by pruning in the last grid evaluation
+    int getNumberOfPrunedEvaluations( )
+    {
+        return numberOfPrunedEvaluations_;
+    }
+
+    //! Function to retrieve the number of workers
+    int getNumberOfWorkers( )
+    {
+        return workerTrajectories_.size( );
+    }
+
+private:
+
+    //! Function to evaluate a single trajectory with a given worker
+    /*!
+     *  Function to evaluate a single trajectory with a given worker
+     *  \param workerIndex Index of worker
+     *  \param nodeTimes Node times of trajectory
+     *  \param maximumDeltaV Delta V budget
+     *  \param numberOfNodeTimesUsed Number of leading node times on which the evaluated legs and nodes depend (output,
+     *  equal to the total number of nodes if the evaluation failed)
+     *  \return Total Delta V (infinity if exceeding the budget, NaN if evaluation failed)
+     */
+    double evaluateSingleTrajectory(
+            const int workerIndex,
+            const std::vector< double >& nodeTimes,
+            const double maximumDeltaV,
+            int& numberOfNodeTimesUsed );
+
+    //! List of transfer trajectories, one per worker
+    std::vector< std::shared_ptr< TransferTrajectory > > workerTrajectories_;
+
+    //! Free parameters of each leg
+    std::vector< Eigen::VectorXd > legFreeParameters_;
+
+    //! Free parameters of each node
+    std::vector< Eigen::VectorXd > nodeFreeParameters_;
+
+    //! Number of trajectory evaluations that were skipped by pruning in the last grid evaluation
+    int numberOfPrunedEvaluations_;
+};
+
+} // namespace mission_segments
+
+} // namespace tudat
+
+#endif // TUDAT_TRANSFER_TRAJECTORY_GRID_SEARCH_H
@@ -37,6 +37,10 @@ namespace observation_models
  *  NOTE: If the perturbing body is equal to the transmitting or receiving body, the transmission or reception time,
  *  respectively, are used to evaluate this perturbing body's state when computing the correction. For all other bodies,
  *  the mid-way point of the light time is used.
+ *  The states and gravitational parameters of all perturbing bodies are evaluated together, once per pair of transmission and
+ *  reception times, and stored, so that the partial derivatives of the correction at the same link end times (as well as the
+ *  associated FirstOrderRelativisticLightTimeCorrectionPartial object) use the same perturbing body properties without
+ *  re-evaluating them.
  */
 class FirstOrderLightTimeCorrectionCalculator: public LightTimeCorrection
 {
@@ -71,6 +75,12 @@ public:
         currentTotalLightTimeCorrection_ = 0.0;
         currentLighTimeCorrectionComponents_.resize( perturbingBodyNames_.size( ) );
 
+        currentPerturbingBodyPositions_.setZero( 3, perturbingBodyNames_.size( ) );
+        currentPerturbingBodyGravitationalParameters_.setZero( perturbingBodyNames_.size( ) );
+        currentPpnParameterGamma_ = TUDAT_NAN;
+        currentTransmissionTime_ = TUDAT_NAN;
+        currentReceptionTime_ = TUDAT_NAN;
+
         // Check if perturbing body is transmitting/receiving body, and set evaluation time settings accordingly
         for( unsigned int i = 0; i < perturbingBodyNames.size( ); i++ )
         {
@@ -203,6 +213,48 @@ public:
         return ppnParameterGammaFunction_;
     }
 
+    //! Function to evaluate the positions and gravitational parameters of all perturbing bodies for given link end times
+    /*!
+     * Function to evaluate the positions and gravitational parameters of all perturbing bodies (as well as the ppn parameter
+     * gamma) for given link end times, and store them for use in the correction and its partials.
+     * \param transmissionTime Time of signal transmission
+     * \param receptionTime Time of singal reception
+     */
+    void updatePerturbingBodyStates( const double transmissionTime, const double receptionTime );
+
+    //! Function to get the positions of the perturbing bodies, as computed by last call to updatePerturbingBodyStates.
+    /*!
+     * Function to get the positions of the perturbing bodies, as computed by last call to updatePerturbingBodyStates.
+     * \return Positions of the perturbing bodies (one column per body)
+     */
+    const Eigen::Matrix3Xd& getCurrentPerturbingBodyPositions( )
+    {
+        return currentPerturbingBodyPositions_;
+    }
+
+    //! Function to get the gravitational parameter of given perturbing body, as computed by last call to
+    //! updatePerturbingBodyStates.
+    /*!
+     * Function to get the gravitational parameter of given perturbing body, as computed by last call to
+     * updatePerturbingBodyStates.
+     * \param bodyIndex Index in list of bodies for which the gravitational parameter is to be returned
+     * \return Gravitational parameter of given perturbing body
+     */
+    double getCurrentPerturbingBodyGravitationalParameter( const int bodyIndex )
+    {
+        return currentPerturbingBodyGravitationalParameters_( bodyIndex );
+    }
+
+    //! Function to get the ppn parameter gamma, as computed by last call to updatePerturbingBodyStates.
+    /*!
+     * Function to get the ppn parameter gamma, as computed by last call to updatePerturbingBodyStates.
+     * \return Parametric post-Newtonian parameter gamma
+     */
+    double getCurrentPpnParameterGamma( )
+    {
+        return currentPpnParameterGamma_;
+    }
+
 private:
 
     //! Set of function returning the state of the gravitating bodies as a function of time.
@@ -230,6 +282,21 @@ private:
 
     //! Total light-time correction, as computed by last call to calculateLightTimeCorrection.
     double currentTotalLightTimeCorrection_;
+
+    //! Positions of perturbing bodies (one column per body), as computed by last call to updatePerturbingBodyStates.
+    Eigen::Matrix3Xd currentPerturbingBodyPositions_;
+
+    //! Gravitational parameters of perturbing bodies, as computed by last call to updatePerturbingBodyStates.
+    Eigen::VectorXd currentPerturbingBodyGravitationalParameters_;
+
+    //! Parametric post-Newtonian parameter gamma, as computed by last call to updatePerturbingBodyStates.
+    double currentPpnParameterGamma_;
+
+    //! Transmission time for which perturbing body properties were last computed.
+    double currentTransmissionTime_;
+
+    //! Reception time for which perturbing body properties were last computed.
+    double currentReceptionTime_;
 };
 
 } // namespace observation_models
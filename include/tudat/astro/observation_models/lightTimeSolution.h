@@ -281,7 +281,12 @@ public:
         stateFunctionOfReceivingBody_( positionFunctionOfReceivingBody ),
         correctionFunctions_( correctionFunctions ),
         lightTimeConvergenceCriteria_( lightTimeConvergenceCriteria ),
-        currentCorrection_( 0.0 ){ }
+        currentCorrection_( 0.0 ),
+        useWarmStart_( false ),
+        maximumWarmStartTimeInterval_( TUDAT_NAN ),
+        numberOfStoredSolutions_( 0 ),
+        numberOfIterationsOfLastSolution_( 0 ),
+        useSolutionCaching_( false ){ }
 
     //! Class constructor.
     /*!
@@ -299,7 +304,12 @@ public:
         stateFunctionOfTransmittingBody_( positionFunctionOfTransmittingBody ),
         stateFunctionOfReceivingBody_( positionFunctionOfReceivingBody ),
         lightTimeConvergenceCriteria_( lightTimeConvergenceCriteria ),
-        currentCorrection_( 0.0 )
+        currentCorrection_( 0.0 ),
+        useWarmStart_( false ),
+        maximumWarmStartTimeInterval_( TUDAT_NAN ),
+        numberOfStoredSolutions_( 0 ),
+        numberOfIterationsOfLastSolution_( 0 ),
+        useSolutionCaching_( false )
     {
         for( unsigned int i = 0; i < correctionFunctions.size( ); i++ )
         {
@@ -381,9 +391,30 @@ public:
             const ObservationScalarType tolerance =
             ( getDefaultLightTimeTolerance< ObservationScalarType >( ) ) )
     {
-        // Initialize reception and transmission times and states to initial guess (zero light time)
-        TimeType receptionTime = time;
-        TimeType transmissionTime = time;
+        // Retrieve solution from cache, if available
+        if( useSolutionCaching_ )
+        {
+            typename std::map< std::pair< TimeType, bool >, CachedLightTimeSolution >::const_iterator cacheIterator =
+                    cachedSolutions_.find( std::make_pair( time, isTimeAtReception ) );
+            if( cacheIterator != cachedSolutions_.end( ) )
+            {
+                receiverStateOutput = cacheIterator->second.receiverState_;
+                transmitterStateOutput = cacheIterator->second.transmitterState_;
+                currentCorrection_ = cacheIterator->second.lightTimeCorrection_;
+                numberOfIterationsOfLastSolution_ = 0;
+                return cacheIterator->second.lightTime_;
+            }
+        }
+
+        // Initialize reception and transmission times and states to initial guess (zero light time, or predicted light
+        // time from preceding solutions if warm start is used)
+        ObservationScalarType initialLightTimeGuess = mathematical_constants::getFloatingInteger< ObservationScalarType >( 0 );
+        if( useWarmStart_ )
+        {
+            getPredictedLightTime( time, isTimeAtReception, initialLightTimeGuess );
+        }
+        TimeType receptionTime = isTimeAtReception ? time : time + initialLightTimeGuess;
+        TimeType transmissionTime = isTimeAtReception ? time - initialLightTimeGuess : time;
         StateType receiverState = stateFunctionOfReceivingBody_( receptionTime );
         StateType transmitterState =
                 stateFunctionOfTransmittingBody_( transmissionTime );
@@ -447,9 +478,91 @@ public:
         receiverStateOutput = receiverState;
         transmitterStateOutput = transmitterState;
 
+        numberOfIterationsOfLastSolution_ = counter;
+        if( useWarmStart_ )
+        {
+            storeSolutionForWarmStart( time, isTimeAtReception, newLightTimeCalculation );
+        }
+
+        if( useSolutionCaching_ )
+        {
+            CachedLightTimeSolution& cachedSolution = cachedSolutions_[ std::make_pair( time, isTimeAtReception ) ];
+            cachedSolution.lightTime_ = newLightTimeCalculation;
+            cachedSolution.receiverState_ = receiverState;
+            cachedSolution.transmitterState_ = transmitterState;
+            cachedSolution.lightTimeCorrection_ = currentCorrection_;
+        }
+
         return newLightTimeCalculation;
     }
 
+    //! Function to set whether light-time solutions are cached.
+    /*!
+     *  Function to set whether light-time solutions are cached. If so, each solution (light time and link end states) is
+     *  stored, and a subsequent call with the same input time (and the same link end at which this time is valid) returns
+     *  the stored solution, without evaluating the link end states and light-time corrections. When a single calculator
+     *  is shared by several observation models (e.g. range and Doppler of the same link, see
+     *  LightTimeCalculatorRegistry), the light time at a given epoch is then only solved once. The cached solutions are
+     *  only valid as long as the environment (link end dynamics and correction models) is unchanged, so caching should
+     *  only be enabled for a single simulation pass. The cache is cleared whenever this function is called.
+     *  \param useSolutionCaching Boolean denoting whether light-time solutions are cached
+     */
+    void setSolutionCaching( const bool useSolutionCaching )
+    {
+        useSolutionCaching_ = useSolutionCaching;
+        cachedSolutions_.clear( );
+    }
+
+    //! Function to retrieve whether light-time solutions are cached.
+    bool getUseSolutionCaching( )
+    {
+        return useSolutionCaching_;
+    }
+
+    //! Function to retrieve the number of light-time solutions that are currently cached.
+    int getNumberOfCachedSolutions( )
+    {
+        return cachedSolutions_.size( );
+    }
+
+    //! Function to set whether the light-time iteration is warm-started from preceding solutions.
+    /*!
+     *  Function to set whether the light-time iteration is warm-started from preceding solutions. If so, the initial guess
+     *  of the light time is predicted (to first order) from the light times of the two preceding calls to this object,
+     *  instead of using the instantaneous geometric distance. For densely sampled observations, this reduces the number
+     *  of iterations (and thereby of link end state evaluations and light-time correction evaluations) that is required
+     *  to meet the convergence criteria. The convergence criteria themselves are not modified. The prediction is only
+     *  used if the input time is of the same type (reception/transmission) as that of the preceding solution, and its
+     *  difference w.r.t. the time of the preceding solution does not exceed a given value.
+     *  \param useWarmStart Boolean denoting whether the iteration is to be warm-started
+     *  \param maximumWarmStartTimeInterval Maximum time difference w.r.t. the preceding solution at which the prediction
+     *  is used (NaN, the default, denotes no limit).
+     */
+    void setWarmStart( const bool useWarmStart, const double maximumWarmStartTimeInterval = TUDAT_NAN )
+    {
+        useWarmStart_ = useWarmStart;
+        maximumWarmStartTimeInterval_ = maximumWarmStartTimeInterval;
+        resetWarmStart( );
+    }
+
+    //! Function to discard the preceding solutions used for warm start (e.g. after a change of the link end dynamics)
+    void resetWarmStart( )
+    {
+        numberOfStoredSolutions_ = 0;
+    }
+
+    //! Function to retrieve whether the light-time iteration is warm-started from preceding solutions.
+    bool getUseWarmStart( )
+    {
+        return useWarmStart_;
+    }
+
+    //! Function to retrieve the number of iterations that were performed in the most recent light-time solution
+    int getNumberOfIterationsOfLastSolution( )
+    {
+        return numberOfIterationsOfLastSolution_;
+    }
+
     //! Function to get the part wrt linkend position
     /*!
      *  Function to get the part wrt linkend position
@@ -566,6 +679,99 @@ protected:
         }
         currentCorrection_ = totalLightTimeCorrections;
     }
+
+    //! Function to predict the light time from the preceding solutions (returns false if no prediction is available).
+    bool getPredictedLightTime( const TimeType time, const bool isTimeAtReception, ObservationScalarType& predictedLightTime )
+    {
+        if( numberOfStoredSolutions_ == 0 || isTimeAtReception != isLastSolutionTimeAtReception_ )
+        {
+            return false;
+        }
+
+        double timeDifference = static_cast< double >( time - lastSolutionTime_ );
+        if( std::fabs( timeDifference ) > maximumWarmStartTimeInterval_ )
+        {
+            return false;
+        }
+
+        ObservationScalarType currentPrediction = lastLightTime_;
+        if( numberOfStoredSolutions_ > 1 )
+        {
+            currentPrediction += lastLightTimeRate_ * static_cast< ObservationScalarType >( timeDifference );
+        }
+
+        if( !( currentPrediction >= mathematical_constants::getFloatingInteger< ObservationScalarType >( 0 ) ) )
+        {
+            return false;
+        }
+        predictedLightTime = currentPrediction;
+        return true;
+    }
+
+    //! Function to store a light-time solution, to be used for the prediction of subsequent solutions
+    void storeSolutionForWarmStart( const TimeType time, const bool isTimeAtReception, const ObservationScalarType lightTime )
+    {
+        if( numberOfStoredSolutions_ > 0 && isTimeAtReception == isLastSolutionTimeAtReception_ )
+        {
+            double timeDifference = static_cast< double >( time - lastSolutionTime_ );
+            if( timeDifference != 0.0 )
+            {
+                lastLightTimeRate_ = ( lightTime - lastLightTime_ ) / static_cast< ObservationScalarType >( timeDifference );
+                numberOfStoredSolutions_ = 2;
+            }
+        }
+        else
+        {
+            numberOfStoredSolutions_ = 1;
+        }
+
+        lastSolutionTime_ = time;
+        lastLightTime_ = lightTime;
+        isLastSolutionTimeAtReception_ = isTimeAtReception;
+    }
+
+    //! Boolean denoting whether the light-time iteration is warm-started from preceding solutions.
+    bool useWarmStart_;
+
+    //! Maximum time difference w.r.t. the preceding solution at which the warm start is used.
+    double maximumWarmStartTimeInterval_;
+
+    //! Number of stored preceding solutions (0: none; 1: light time only; 2: light time and its rate)
+    int numberOfStoredSolutions_;
+
+    //! Input time of the most recent solution
+    TimeType lastSolutionTime_;
+
+    //! Light time of the most recent solution
+    ObservationScalarType lastLightTime_;
+
+    //! Rate of change of the light time, computed from the two most recent solutions
+    ObservationScalarType lastLightTimeRate_;
+
+    //! Boolean denoting whether the input time of the most recent solution was at reception
+    bool isLastSolutionTimeAtReception_;
+
+    //! Number of iterations that were performed in the most recent light-time solution
+    int numberOfIterationsOfLastSolution_;
+
+    //! Light-time solution (with associated link end states and correction), as stored when caching is used.
+    struct CachedLightTimeSolution
+    {
+        ObservationScalarType lightTime_;
+
+        StateType receiverState_;
+
+        StateType transmitterState_;
+
+        double lightTimeCorrection_;
+    };
+
+    //! Boolean denoting whether light-time solutions are cached.
+    bool useSolutionCaching_;
+
+    //! Cached light-time solutions, with input time and boolean denoting whether this time is at reception as key
+    std::map< std::pair< TimeType, bool >, CachedLightTimeSolution > cachedSolutions_;
+
 private:
 };
 
@@ -180,6 +180,48 @@ public:
                      ) << totalLightTime * physical_constants::getSpeedOfLight< ObservationScalarType >( ) ).finished( );
     }
 
+    //! Function to compute ideal n-way range observations at a list of times.
+    /*!
+     *  Function to compute ideal n-way range observations at a list of times (see base class). The light-time
+     *  iterations of each leg are warm-started from the preceding observation in the list (for each light-time calculator
+     *  for which it is not already enabled, warm start is only used inside this function).
+     *  \param times Times at which observable is to be evaluated.
+     *  \param linkEndAssociatedWithTime Link end at which given times are valid
+     *  \param observations Ideal n-way range observables, one column per time (returned by reference).
+     *  \param linkEndTimes Times at each link end, one column per time (returned by reference).
+     *  \param linkEndStates States at each link end, one column per time (returned by reference).
+     *  \param ancilliarySetings Ancilliary settings (retransmission delays, used for all times)
+     */
+    void computeIdealObservationsWithLinkEndDataAtTimes(
+            const std::vector< TimeType >& times,
+            const LinkEndType linkEndAssociatedWithTime,
+            Eigen::Matrix< ObservationScalarType, 1, Eigen::Dynamic >& observations,
+            Eigen::MatrixXd& linkEndTimes,
+            Eigen::MatrixXd& linkEndStates,
+            const std::shared_ptr< ObservationAncilliarySimulationSettings< TimeType > > ancilliarySetings = nullptr )
+    {
+        std::vector< bool > enableWarmStart( lightTimeCalculators_.size( ) );
+        for( unsigned int i = 0; i < lightTimeCalculators_.size( ); i++ )
+        {
+            enableWarmStart[ i ] = !lightTimeCalculators_.at( i )->getUseWarmStart( );
+            if( enableWarmStart[ i ] )
+            {
+                lightTimeCalculators_.at( i )->setWarmStart( true );
+            }
+        }
+
+        ObservationModel< 1, ObservationScalarType, TimeType >::computeIdealObservationsWithLinkEndDataAtTimes(
+                    times, linkEndAssociatedWithTime, observations, linkEndTimes, linkEndStates, ancilliarySetings );
+
+        for( unsigned int i = 0; i < lightTimeCalculators_.size( ); i++ )
+        {
+            if( enableWarmStart[ i ] )
+            {
+                lightTimeCalculators_.at( i )->setWarmStart( false );
+            }
+        }
+    }
+
     std::vector< std::shared_ptr< LightTimeCalculator< ObservationScalarType, TimeType > > > getLightTimeCalculators( )
     {
         return lightTimeCalculators_;
@@ -299,7 +299,7 @@ public:
         // Create current arc lookup scheme
         std::vector< double > lookupSchemeTimes = arcStartTimes_;
         lookupSchemeTimes.push_back( std::numeric_limits< double >::max( ) );
-        lookupScheme_ = std::make_shared< interpolators::HuntingAlgorithmLookupScheme< double > >(
+        lookupScheme_ = std::make_shared< interpolators::ArcBoundaryLookupScheme< double > >(
                     lookupSchemeTimes );
 
     }
@@ -475,7 +475,7 @@ public:
         // Create current arc lookup scheme
         std::vector< double > lookupSchemeTimes = arcStartTimes_;
         lookupSchemeTimes.push_back( std::numeric_limits< double >::max( ) );
-        lookupScheme_ = std::make_shared< interpolators::HuntingAlgorithmLookupScheme< double > >(
+        lookupScheme_ = std::make_shared< interpolators::ArcBoundaryLookupScheme< double > >(
                     lookupSchemeTimes );
     }
 
@@ -792,7 +792,7 @@ public:
         // Create current arc lookup scheme
         std::vector< double > lookupSchemeTimes = arcStartTimes_;
         lookupSchemeTimes.push_back( std::numeric_limits< double >::max( ) );
-        lookupScheme_ = std::make_shared< interpolators::HuntingAlgorithmLookupScheme< double > >(
+        lookupScheme_ = std::make_shared< interpolators::ArcBoundaryLookupScheme< double > >(
                 lookupSchemeTimes );
     }
 
@@ -813,9 +813,9 @@ public:
             const Eigen::Matrix< double, ObservationSize, 1 >& currentObservableValue =
             ( Eigen::Matrix< double, ObservationSize, 1 >( ) << TUDAT_NAN ).finished( ) )
     {
-        return timeDriftBiases_.at( lookupScheme_->findNearestLowerNeighbour( linkEndTimes.at( linkEndIndexForTime_ ) ) ) *
-               ( linkEndTimes.at( linkEndIndexForTime_ )
-                 - referenceEpochs_.at( lookupScheme_->findNearestLowerNeighbour( linkEndTimes.at( linkEndIndexForTime_ ) ) ) );
+        int currentArcIndex = lookupScheme_->findNearestLowerNeighbour( linkEndTimes.at( linkEndIndexForTime_ ) );
+        return timeDriftBiases_.at( currentArcIndex ) *
+               ( linkEndTimes.at( linkEndIndexForTime_ ) - referenceEpochs_.at( currentArcIndex ) );
     }
 
     //! Function retrieve the constant (entry-wise) time drift bias as a variable-size vector.
@@ -1049,7 +1049,7 @@ public:
         // Create current arc lookup scheme
         std::vector< double > lookupSchemeTimes = arcStartTimes_;
         lookupSchemeTimes.push_back( std::numeric_limits< double >::max( ) );
-        lookupScheme_ = std::make_shared< interpolators::HuntingAlgorithmLookupScheme< double > >(
+        lookupScheme_ = std::make_shared< interpolators::ArcBoundaryLookupScheme< double > >(
                 lookupSchemeTimes );
     }
 
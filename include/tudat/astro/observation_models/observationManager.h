@@ -11,6 +11,8 @@
 #ifndef TUDAT_OBSERVATIONMANAGER_H
 #define TUDAT_OBSERVATIONMANAGER_H
 
+#include <set>
+
 #include "tudat/astro/observation_models/observableTypes.h"
 #include "tudat/astro/observation_models/observationModel.h"
 #include "tudat/astro/observation_models/linkTypeDefs.h"
@@ -101,9 +103,55 @@ public:
      */
     virtual std::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > getObservationSimulator( ) = 0;
 
+    //! Function (pure virtual) to return the parameters for which observation partials are computed, per set of link ends
+    /*!
+     * Function (pure virtual) to return the parameters for which observation partial objects exist, per set of link ends.
+     * Partials w.r.t. parameters that are not in this list are structurally zero, unless they enter the observation through
+     * the state transition/sensitivity matrix (i.e. through the partial w.r.t. a link end state).
+     * \return Start index and size of parameters in full parameter vector for which partials exist, per set of link ends
+     */
+    virtual std::map< LinkEnds, std::vector< std::pair< int, int > > > getPartialParameterIndices( ) = 0;
+
+    //! Function to set the entries of the parameter vector for which the observation partials are not to be computed
+    /*!
+     * Function to set the entries of the parameter vector for which the observation partials are not to be computed. A
+     * partial object is skipped if all entries of its parameter are in this list, in which case the associated columns of
+     * the partial matrix are left zero. This is used to reuse the partials w.r.t. (for instance) observation biases of a
+     * previous estimation iteration (see EstimationInput::setPartialsReuse). Must not be called concurrently with
+     * computeObservationsWithPartials.
+     * \param parameterIndices Indices in the full parameter vector for which no partials are to be computed (empty to
+     * compute all partials)
+     */
+    void setSkippedPartialParameterIndices( const std::vector< int >& parameterIndices )
+    {
+        skippedPartialParameterIndices_ = std::set< int >( parameterIndices.begin( ), parameterIndices.end( ) );
+    }
+
 
 protected:
 
+    //! Function to check whether the partial w.r.t. a given parameter is to be skipped
+    /*!
+     *  Function to check whether the partial w.r.t. a given parameter is to be skipped (see setSkippedPartialParameterIndices)
+     *  \param parameterIndices Start index and size of the parameter in the full parameter vector
+     *  \return True if all entries of the parameter are skipped
+     */
+    bool isPartialSkipped( const std::pair< int, int >& parameterIndices ) const
+    {
+        if( skippedPartialParameterIndices_.size( ) == 0 )
+        {
+            return false;
+        }
+        for( int i = 0; i < parameterIndices.second; i++ )
+        {
+            if( skippedPartialParameterIndices_.count( parameterIndices.first + i ) == 0 )
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     //! Function to get the state transition and sensitivity matrix.
     /*!
      *  Function to get the state transition matrix Phi and sensitivity matrix S at a given time as a single matrix [Phi;S]
@@ -133,6 +181,9 @@ protected:
      */
     int stateTransitionMatrixSize_;
 
+    //! Entries of the parameter vector for which the observation partials are not computed
+    std::set< int > skippedPartialParameterIndices_;
+
 };
 
 //! Class to manage simulation of observables and associated partials for a single type of observable.
@@ -223,7 +274,9 @@ public:
     //! Function to simulate observations between specified link ends and associated partials at set of observation times.
     /*!
      *  Function to simulate observations between specified link ends  and associated partials at set of observation times,
-     *  used the sensitivity and state transition matrix interpolators set in the base class.
+     *  used the sensitivity and state transition matrix interpolators set in the base class. The function modifies no
+     *  member variables of this object, so that it may be called concurrently for link ends that share no observation model
+     *  or partial objects (see OrbitDeterminationManager::setNumberOfDesignMatrixThreads).
      *  \param times Vector of times at which observations are performed
      *  \param linkEnds Set of stations, S/C etc. in link, with specifiers of type of link end.
      *  \param linkEndAssociatedWithTime Link end at which input times are valid, i.e. link end for which associated time
@@ -244,6 +297,14 @@ public:
         std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > selectedObservationModel =
                 observationSimulator_->getObservationModel( linkEnds );
 
+        // Compute observations, and states and times of link ends, at all times
+        Eigen::Matrix< ObservationScalarType, ObservationSize, Eigen::Dynamic > batchObservations;
+        Eigen::MatrixXd batchLinkEndTimes;
+        Eigen::MatrixXd batchLinkEndStates;
+        selectedObservationModel->computeObservationsWithLinkEndDataAtTimes(
+                    times, linkEndAssociatedWithTime, batchObservations, batchLinkEndTimes, batchLinkEndStates,
+                    ancilliarySettings );
+
         // Initialize vectors of states and times of link ends to be used in calculations.
         std::vector< Eigen::Vector6d > vectorOfStates;
         std::vector< double > vectorOfTimes;
@@ -254,12 +315,8 @@ public:
         int currentObservationSize;
         for( unsigned int i = 0; i < times.size( ); i++ )
         {
-            vectorOfTimes.clear( );
-            vectorOfStates.clear( );
-
-            // Compute observation
-            currentObservation = selectedObservationModel->computeObservationsWithLinkEndData(
-                        times[ i ], linkEndAssociatedWithTime, vectorOfTimes, vectorOfStates, ancilliarySettings );
+            currentObservation = batchObservations.col( i );
+            getLinkEndDataFromBatchColumn( i, batchLinkEndTimes, batchLinkEndStates, vectorOfTimes, vectorOfStates );
             TimeType saveTime = times[ i ];
             while( observations.count( saveTime ) != 0 )
             {
@@ -295,6 +352,21 @@ public:
         return observationPartials_;
     }
 
+    //! Function to return the parameters for which observation partials are computed, per set of link ends
+    /*!
+     * Function to return the parameters for which observation partial objects exist, per set of link ends
+     * \return Start index and size of parameters in full parameter vector for which partials exist, per set of link ends
+     */
+    std::map< LinkEnds, std::vector< std::pair< int, int > > > getPartialParameterIndices( )
+    {
+        std::map< LinkEnds, std::vector< std::pair< int, int > > > partialParameterIndices;
+        for( auto linkEndIterator : observationPartials_ )
+        {
+            partialParameterIndices[ linkEndIterator.first ] = utilities::createVectorFromMapKeys( linkEndIterator.second );
+        }
+        return partialParameterIndices;
+    }
+
     //! Function to return the observation partial objects for a single set of link ends
     /*!
      * Function to return the observation partial objects for a single set of link ends
@@ -363,14 +435,19 @@ protected:
         Eigen::Matrix< double, ObservationSize, Eigen::Dynamic > partialMatrix =
                 Eigen::MatrixXd::Zero( observationSize, fullParameterVector );
 
-        // Initialize list of [Phi;S] matrices at times required by calculation (key)
-        std::map< double, Eigen::MatrixXd > combinedStateTransitionMatrices;
+        // Initialize list of rows of [Phi;S] matrices at times and start rows required by calculation (key)
+        std::map< std::pair< double, int >, Eigen::MatrixXd > combinedStateTransitionMatrixRows;
 
 //        std::cout << "before update partials" << "\n\n";
         // Perform updates of dependent variables used by (subset of) observation partials.
         updatePartials( states, times, linkEnds, linkEndAssociatedWithTime, currentObservation );
 
-        currentLinkEndPartials = observationPartials_[ linkEnds ];
+        typename std::map< LinkEnds, std::map< std::pair< int, int >, std::shared_ptr<
+                observation_partials::ObservationPartial< ObservationSize > > > >::const_iterator linkEndPartialsIterator =
+                observationPartials_.find( linkEnds );
+        const std::map< std::pair< int, int >, std::shared_ptr< observation_partials::ObservationPartial< ObservationSize > > >&
+                currentLinkEndPartials = ( linkEndPartialsIterator != observationPartials_.end( ) ) ?
+                    linkEndPartialsIterator->second : noLinkEndPartials_;
 
         // Get list of bodies involved in linkEnds
         std::vector< std::string > bodiesInLinkEnds;
@@ -385,12 +462,16 @@ protected:
 
         // Iterate over all observation partials associated with given link ends.
         for( typename std::map< std::pair< int, int >, std::shared_ptr<
-             observation_partials::ObservationPartial< ObservationSize > > >::iterator
+             observation_partials::ObservationPartial< ObservationSize > > >::const_iterator
              partialIterator = currentLinkEndPartials.begin( );
              partialIterator != currentLinkEndPartials.end( ); partialIterator++ )
         {
             // Get Observation partial start and size indices in parameter vector.
             std::pair< int, int > currentIndexInfo = partialIterator->first;
+            if( this->isPartialSkipped( currentIndexInfo ) )
+            {
+                continue;
+            }
 //            std::cout << "current index info: " << currentIndexInfo.first << " & " << currentIndexInfo.second << "\n\n";
 //            std::cout << "block STM: " << currentIndexInfo.first << " - " << 0 << " & " << currentIndexInfo.second << " - " <<  fullParameterVector << "\n\n";
 //            std::cout << "stateTransitionMatrixSize_: " << stateTransitionMatrixSize_ << "\n\n";
@@ -427,17 +508,22 @@ protected:
                 {
 //                    std::cout << "size singlePartialSet: " << singlePartialSet[ i ].first.rows( ) << " & " << singlePartialSet[ i ].first.cols( ) << "\n\n";
 
-                    // Evaluate [Phi;S] matrix at each time instant associated with partial, if not yet evaluated.
-                    if( combinedStateTransitionMatrices.count( singlePartialSet[ i ].second ) == 0 )
+                    // Evaluate rows of [Phi;S] matrix of current state at each time instant associated with partial,
+                    // if not yet evaluated.
+                    std::pair< double, int > matrixRowsKey = std::make_pair( singlePartialSet[ i ].second, currentIndexInfo.first );
+                    typename std::map< std::pair< double, int >, Eigen::MatrixXd >::iterator matrixRowsIterator =
+                            combinedStateTransitionMatrixRows.find( matrixRowsKey );
+                    if( matrixRowsIterator == combinedStateTransitionMatrixRows.end( ) )
                     {
-                        combinedStateTransitionMatrices[ singlePartialSet[ i ].second ] =
-                                this->getCombinedStateTransitionAndSensitivityMatrix( singlePartialSet[ i ].second, bodiesOfInterestInLinkEnds /*bodiesInLinkEnds*/ );
+                        matrixRowsIterator = combinedStateTransitionMatrixRows.insert(
+                                    std::make_pair( matrixRowsKey, Eigen::MatrixXd( ) ) ).first;
+                        stateTransitionMatrixInterface_->getFullCombinedStateTransitionAndSensitivityMatrixRows(
+                                    singlePartialSet[ i ].second, currentIndexInfo.first, currentIndexInfo.second,
+                                    matrixRowsIterator->second, true, bodiesOfInterestInLinkEnds );
                     }
 
                     // Add partial of observation h w.r.t. initial state x_{0} (dh/dx_{0}=dh/dx*dx/dx_{0})
-                    partialMatrix += ( singlePartialSet[ i ].first ) *
-                            combinedStateTransitionMatrices[ singlePartialSet[ i ].second ].block
-                            ( currentIndexInfo.first, 0, currentIndexInfo.second, fullParameterVector );
+                    partialMatrix.noalias( ) += ( singlePartialSet[ i ].first ) * matrixRowsIterator->second;
 
 //                    std::cout << "end single partial set" << "\n\n";
                 }
@@ -528,9 +614,9 @@ protected:
     std::map< LinkEnds, std::map< std::pair< int, int >, std::shared_ptr<
     observation_partials::ObservationPartial< ObservationSize > > > > observationPartials_;
 
-    //! Pre-declared map used in computation of partials.
-    std::map< std::pair< int, int >, std::shared_ptr< observation_partials::ObservationPartial< ObservationSize > > >
-    currentLinkEndPartials;
+    //! Empty list of partials, used for link ends for which no partials are defined.
+    const std::map< std::pair< int, int >, std::shared_ptr< observation_partials::ObservationPartial< ObservationSize > > >
+    noLinkEndPartials_;
 
     std::shared_ptr< propagators::DependentVariablesInterface< TimeType > > dependentVariablesInterface_;
 
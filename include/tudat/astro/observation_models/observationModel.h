@@ -208,7 +208,69 @@ std::shared_ptr< ObservationAncilliarySimulationSettings< TimeType > > getDefaul
     return ancilliarySettings;
 }
 
+//! Function to set the link end times and states of a single observation in the batch buffers of an observation model
+/*!
+ *  Function to set the link end times and states of a single observation in the batch buffers of an observation model
+ *  (see ObservationModel::computeObservationsWithLinkEndDataAtTimes), which must be of the correct size.
+ *  \param columnIndex Index of observation (column) in the buffers
+ *  \param vectorOfTimes Times at each link end of the current observation
+ *  \param vectorOfStates States at each link end of the current observation
+ *  \param linkEndTimes Times at each link end, one column per observation (modified by reference).
+ *  \param linkEndStates States at each link end, one column per observation (modified by reference).
+ */
+inline void setLinkEndDataInBatchColumn(
+        const int columnIndex,
+        const std::vector< double >& vectorOfTimes,
+        const std::vector< Eigen::Matrix< double, 6, 1 > >& vectorOfStates,
+        Eigen::MatrixXd& linkEndTimes,
+        Eigen::MatrixXd& linkEndStates )
+{
+    if( static_cast< int >( vectorOfTimes.size( ) ) != linkEndTimes.rows( ) ||
+            6 * static_cast< int >( vectorOfStates.size( ) ) != linkEndStates.rows( ) )
+    {
+        throw std::runtime_error( "Error when computing observations at list of times, number of link end times and states "
+                                  "is not the same for each observation." );
+    }
+
+    for( unsigned int i = 0; i < vectorOfTimes.size( ); i++ )
+    {
+        linkEndTimes( i, columnIndex ) = vectorOfTimes.at( i );
+    }
+    for( unsigned int i = 0; i < vectorOfStates.size( ); i++ )
+    {
+        linkEndStates.block< 6, 1 >( 6 * i, columnIndex ) = vectorOfStates.at( i );
+    }
+}
+
+//! Function to retrieve the link end times and states of a single observation from the batch buffers of an observation model
+/*!
+ *  Function to retrieve the link end times and states of a single observation from the batch buffers of an observation
+ *  model (see ObservationModel::computeObservationsWithLinkEndDataAtTimes).
+ *  \param columnIndex Index of observation (column) in the buffers
+ *  \param linkEndTimes Times at each link end, one column per observation
+ *  \param linkEndStates States at each link end, one column per observation
+ *  \param vectorOfTimes Times at each link end of the current observation (returned by reference).
+ *  \param vectorOfStates States at each link end of the current observation (returned by reference).
+ */
+inline void getLinkEndDataFromBatchColumn(
+        const int columnIndex,
+        const Eigen::MatrixXd& linkEndTimes,
+        const Eigen::MatrixXd& linkEndStates,
+        std::vector< double >& vectorOfTimes,
+        std::vector< Eigen::Matrix< double, 6, 1 > >& vectorOfStates )
+{
+    vectorOfTimes.resize( linkEndTimes.rows( ) );
+    for( unsigned int i = 0; i < vectorOfTimes.size( ); i++ )
+    {
+        vectorOfTimes[ i ] = linkEndTimes( i, columnIndex );
+    }
 
+    vectorOfStates.resize( linkEndStates.rows( ) / 6 );
+    for( unsigned int i = 0; i < vectorOfStates.size( ); i++ )
+    {
+        vectorOfStates[ i ] = linkEndStates.block< 6, 1 >( 6 * i, columnIndex );
+    }
+}
 
 //! Base class for models of observables (i.e. range, range-rate, etc.).
 /*!
@@ -343,6 +405,116 @@ public:
         }
     }
 
+    //! Function to compute the observable without any corrections, at a list of times
+    /*!
+     *  Function to compute the observable without any corrections (see computeIdealObservationsWithLinkEndData) at a list
+     *  of times, writing the observables, and the times and states of the link ends, into contiguous buffers, with one
+     *  column per observation time. The buffers are only reallocated if their size changes, so that they may be reused
+     *  for subsequent calls. By default, computeIdealObservationsWithLinkEndData is called for each time; this function
+     *  may be redefined in derived class for improved efficiency.
+     *  \param times Times at which observable is to be evaluated.
+     *  \param linkEndAssociatedWithTime Link end at which given times are valid, i.e. link end for which associated time
+     *  is kept constant (to input value)
+     *  \param observations Ideal observables, one column per time (returned by reference).
+     *  \param linkEndTimes Times at each link end during observation, one column per time (returned by reference).
+     *  \param linkEndStates States at each link end during observation, one column per time, with the states of the
+     *  link ends stacked in the column (returned by reference).
+     *  \param ancilliarySetings Ancilliary settings for the observation model, used for all times
+     */
+    virtual void computeIdealObservationsWithLinkEndDataAtTimes(
+            const std::vector< TimeType >& times,
+            const LinkEndType linkEndAssociatedWithTime,
+            Eigen::Matrix< ObservationScalarType, ObservationSize, Eigen::Dynamic >& observations,
+            Eigen::MatrixXd& linkEndTimes,
+            Eigen::MatrixXd& linkEndStates,
+            const std::shared_ptr< ObservationAncilliarySimulationSettings< TimeType > > ancilliarySetings = nullptr )
+    {
+        Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > currentObservation;
+        for( unsigned int i = 0; i < times.size( ); i++ )
+        {
+            currentObservation = computeIdealObservationsWithLinkEndData(
+                        times.at( i ), linkEndAssociatedWithTime, linkEndTimes_, linkEndStates_, ancilliarySetings );
+            if( i == 0 )
+            {
+                observations.resize( currentObservation.rows( ), times.size( ) );
+                linkEndTimes.resize( linkEndTimes_.size( ), times.size( ) );
+                linkEndStates.resize( 6 * linkEndStates_.size( ), times.size( ) );
+            }
+            observations.col( i ) = currentObservation;
+            setLinkEndDataInBatchColumn( i, linkEndTimes_, linkEndStates_, linkEndTimes, linkEndStates );
+        }
+
+        if( times.size( ) == 0 )
+        {
+            observations.resize( ( ObservationSize == Eigen::Dynamic ) ? 0 : ObservationSize, 0 );
+            linkEndTimes.resize( 0, 0 );
+            linkEndStates.resize( 0, 0 );
+        }
+    }
+
+    //! Function to compute full observations at a list of times.
+    /*!
+     *  Function to compute observations at a list of times (include any defined non-ideal corrections), writing the
+     *  observables, and the times and states of the link ends, into contiguous buffers, with one column per observation
+     *  time (see computeIdealObservationsWithLinkEndDataAtTimes). The result is identical to that of successive calls to
+     *  computeObservationsWithLinkEndData, to within the convergence tolerance of the light-time computations.
+     *  \param times Times at which observation is to be simulated
+     *  \param linkEndAssociatedWithTime Link end at which current time is measured, i.e. reference
+     *  link end for observable.
+     *  \param observations Calculated observables, one column per time (returned by reference).
+     *  \param linkEndTimes Times at each link end during observation, one column per time (returned by reference).
+     *  \param linkEndStates States at each link end during observation, one column per time, with the states of the
+     *  link ends stacked in the column (returned by reference).
+     *  \param ancilliarySetings Ancilliary settings for the observation model, used for all times
+     */
+    void computeObservationsWithLinkEndDataAtTimes(
+            const std::vector< TimeType >& times,
+            const LinkEndType linkEndAssociatedWithTime,
+            Eigen::Matrix< ObservationScalarType, ObservationSize, Eigen::Dynamic >& observations,
+            Eigen::MatrixXd& linkEndTimes,
+            Eigen::MatrixXd& linkEndStates,
+            const std::shared_ptr< ObservationAncilliarySimulationSettings< TimeType > > ancilliarySetings = nullptr )
+    {
+        // Check if any non-ideal models are set.
+        if( isBiasnullptr_ )
+        {
+            computeIdealObservationsWithLinkEndDataAtTimes(
+                        times, linkEndAssociatedWithTime, observations, linkEndTimes, linkEndStates, ancilliarySetings );
+        }
+        else
+        {
+            // Check that time biases are associated with the time reference time link.
+            checkReferenceLinkEndForTimeBiases( linkEndAssociatedWithTime );
+
+            // Compute ideal observables, adding time bias if necessary
+            if( isTimeBiasNullptr_ )
+            {
+                computeIdealObservationsWithLinkEndDataAtTimes(
+                            times, linkEndAssociatedWithTime, observations, linkEndTimes, linkEndStates, ancilliarySetings );
+            }
+            else
+            {
+                std::vector< TimeType > observationTimes( times.size( ) );
+                for( unsigned int i = 0; i < times.size( ); i++ )
+                {
+                    observationTimes[ i ] = computeBiasedObservationTime( times.at( i ) );
+                }
+                computeIdealObservationsWithLinkEndDataAtTimes(
+                            observationTimes, linkEndAssociatedWithTime, observations, linkEndTimes, linkEndStates,
+                            ancilliarySetings );
+            }
+
+            // Add corrections
+            for( unsigned int i = 0; i < times.size( ); i++ )
+            {
+                getLinkEndDataFromBatchColumn( i, linkEndTimes, linkEndStates, linkEndTimes_, linkEndStates_ );
+                observations.col( i ) += this->observationBiasCalculator_->getObservationBias(
+                            linkEndTimes_, linkEndStates_, observations.col( i ).template cast< double >( ) ).
+                        template cast< ObservationScalarType >( );
+            }
+        }
+    }
+
     //! Function to compute the observable without any corrections.
     /*!
      * Function to compute the observable without any corrections, i.e. the ideal physical observable as computed
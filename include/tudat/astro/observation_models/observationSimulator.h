@@ -13,6 +13,7 @@
 
 #include "tudat/basics/utilities.h"
 #include "tudat/astro/observation_models/observableTypes.h"
+#include "tudat/astro/observation_models/lightTimeSolution.h"
 #include "tudat/astro/observation_models/observationModel.h"
 #include "tudat/astro/observation_models/observationViabilityCalculator.h"
 #include "tudat/astro/observation_models/linkTypeDefs.h"
@@ -64,12 +65,33 @@ public:
      */
     virtual int getObservationSize( ) = 0;
 
+    //! Function to set the light-time calculators that are shared with other observation simulators
+    /*!
+     * Function to set the light-time calculators that are shared with other observation simulators (see
+     * setLightTimeSolutionCaching)
+     * \param sharedLightTimeCalculators Light-time calculators that are shared with other observation simulators
+     */
+    void setSharedLightTimeCalculators(
+            const std::vector< std::shared_ptr< LightTimeCalculator< ObservationScalarType, TimeType > > >&
+            sharedLightTimeCalculators )
+    {
+        sharedLightTimeCalculators_ = sharedLightTimeCalculators;
+    }
+
+    //! Function to retrieve the light-time calculators that are shared with other observation simulators
+    std::vector< std::shared_ptr< LightTimeCalculator< ObservationScalarType, TimeType > > > getSharedLightTimeCalculators( )
+    {
+        return sharedLightTimeCalculators_;
+    }
 
 protected:
 
     //! Type of observable for which this object computes observations
     ObservableType observableType_;
 
+    //! Light-time calculators that are shared with other observation simulators
+    std::vector< std::shared_ptr< LightTimeCalculator< ObservationScalarType, TimeType > > > sharedLightTimeCalculators_;
+
 };
 
 //! Objects used to simulate a set of observations of a given kind
@@ -179,6 +201,31 @@ getObservationSimulatorOfType(
     return observationSimulator;
 }
 
+//! Function to set whether the light-time solutions of the shared light-time calculators of observation simulators are cached
+/*!
+ *  Function to set whether the light-time solutions of the shared light-time calculators of observation simulators are
+ *  cached (see LightTimeCalculator::setSolutionCaching), so that the light time of a link at a given epoch is solved only
+ *  once for all observables in which it is used. The caching should be enabled at the start of a single simulation pass,
+ *  and disabled at its end (which clears the cached solutions), as the cached solutions are invalidated by changes in the
+ *  environment.
+ *  \param observationSimulators List of observation simulators
+ *  \param useSolutionCaching Boolean denoting whether light-time solutions are to be cached
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+void setLightTimeSolutionCaching(
+        const std::vector< std::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > >& observationSimulators,
+        const bool useSolutionCaching )
+{
+    for( unsigned int i = 0; i < observationSimulators.size( ); i++ )
+    {
+        std::vector< std::shared_ptr< LightTimeCalculator< ObservationScalarType, TimeType > > > lightTimeCalculators =
+                observationSimulators.at( i )->getSharedLightTimeCalculators( );
+        for( unsigned int j = 0; j < lightTimeCalculators.size( ); j++ )
+        {
+            lightTimeCalculators.at( j )->setSolutionCaching( useSolutionCaching );
+        }
+    }
+}
 
 }
 
@@ -618,6 +618,41 @@ public:
         return ( Eigen::Matrix<  ObservationScalarType, 1, 1  >( ) << multiplicationTerm_ * totalDopplerObservable ).finished( );
     }
 
+    //! Function to compute ideal one-way Doppler observations at a list of times.
+    /*!
+     *  Function to compute ideal one-way Doppler observations at a list of times (see base class). The light-time
+     *  iterations are warm-started from the preceding observation in the list (unless already enabled for the light-time
+     *  calculator, warm start is only used inside this function).
+     *  \param times Times at which observable is to be evaluated.
+     *  \param linkEndAssociatedWithTime Link end at which given times are valid
+     *  \param observations Ideal one-way Doppler observables, one column per time (returned by reference).
+     *  \param linkEndTimes Times of transmitter and receiver, one column per time (returned by reference).
+     *  \param linkEndStates States of transmitter and receiver, one column per time (returned by reference).
+     *  \param ancilliarySetings Ancilliary settings (none are supported for this observable)
+     */
+    void computeIdealObservationsWithLinkEndDataAtTimes(
+            const std::vector< TimeType >& times,
+            const LinkEndType linkEndAssociatedWithTime,
+            Eigen::Matrix< ObservationScalarType, 1, Eigen::Dynamic >& observations,
+            Eigen::MatrixXd& linkEndTimes,
+            Eigen::MatrixXd& linkEndStates,
+            const std::shared_ptr< ObservationAncilliarySimulationSettings< TimeType > > ancilliarySetings = nullptr )
+    {
+        bool enableWarmStart = !lightTimeCalculator_->getUseWarmStart( );
+        if( enableWarmStart )
+        {
+            lightTimeCalculator_->setWarmStart( true );
+        }
+
+        ObservationModel< 1, ObservationScalarType, TimeType >::computeIdealObservationsWithLinkEndDataAtTimes(
+                    times, linkEndAssociatedWithTime, observations, linkEndTimes, linkEndStates, ancilliarySetings );
+
+        if( enableWarmStart )
+        {
+            lightTimeCalculator_->setWarmStart( false );
+        }
+    }
+
     //! Function to return the object to calculate light time.
     /*!
      * Function to return the object to calculate light time.
@@ -131,6 +131,80 @@ public:
         return ( Eigen::Matrix< ObservationScalarType, 1, 1 >( ) << observation ).finished( );
     }
 
+    //! Function to compute ideal one-way range observations at a list of times.
+    /*!
+     *  Function to compute ideal one-way range observations at a list of times, writing the observations and link end
+     *  times and states directly into the buffers (see base class). The light-time iterations are warm-started from the
+     *  preceding observation in the list (unless already enabled for the light-time calculator, warm start is only used
+     *  inside this function).
+     *  \param times Times at which observable is to be evaluated.
+     *  \param linkEndAssociatedWithTime Link end at which given times are valid
+     *  \param observations Ideal one-way range observables, one column per time (returned by reference).
+     *  \param linkEndTimes Times of transmitter and receiver, one column per time (returned by reference).
+     *  \param linkEndStates States of transmitter and receiver, one column per time (returned by reference).
+     *  \param ancilliarySetings Ancilliary settings (none are supported for this observable)
+     */
+    void computeIdealObservationsWithLinkEndDataAtTimes(
+            const std::vector< TimeType >& times,
+            const LinkEndType linkEndAssociatedWithTime,
+            Eigen::Matrix< ObservationScalarType, 1, Eigen::Dynamic >& observations,
+            Eigen::MatrixXd& linkEndTimes,
+            Eigen::MatrixXd& linkEndStates,
+            const std::shared_ptr< ObservationAncilliarySimulationSettings< TimeType > > ancilliarySetings = nullptr )
+    {
+        if( ancilliarySetings != nullptr )
+        {
+            throw std::runtime_error( "Error, calling one-way range observable with ancilliary settings, but none are supported." );
+        }
+
+        if( linkEndAssociatedWithTime != receiver && linkEndAssociatedWithTime != transmitter )
+        {
+            std::string errorMessage = "Error, cannot have link end type: " +
+                    std::to_string( linkEndAssociatedWithTime ) + "for one-way range";
+            throw std::runtime_error( errorMessage );
+        }
+        bool isTimeAtReception = ( linkEndAssociatedWithTime == receiver );
+
+        observations.resize( 1, times.size( ) );
+        linkEndTimes.resize( 2, times.size( ) );
+        linkEndStates.resize( 12, times.size( ) );
+
+        bool enableWarmStart = !lightTimeCalculator_->getUseWarmStart( );
+        if( enableWarmStart )
+        {
+            lightTimeCalculator_->setWarmStart( true );
+        }
+
+        ObservationScalarType lightTime;
+        TimeType transmissionTime, receptionTime;
+        for( unsigned int i = 0; i < times.size( ); i++ )
+        {
+            lightTime = lightTimeCalculator_->calculateLightTimeWithLinkEndsStates(
+                        receiverState, transmitterState, times.at( i ), isTimeAtReception );
+            if( isTimeAtReception )
+            {
+                transmissionTime = times.at( i ) - lightTime;
+                receptionTime = times.at( i );
+            }
+            else
+            {
+                transmissionTime = times.at( i );
+                receptionTime = times.at( i ) + lightTime;
+            }
+
+            observations( 0, i ) = lightTime * physical_constants::getSpeedOfLight< ObservationScalarType >( );
+            linkEndTimes( 0, i ) = static_cast< double >( transmissionTime );
+            linkEndTimes( 1, i ) = static_cast< double >( receptionTime );
+            linkEndStates.block( 0, i, 6, 1 ) = transmitterState.template cast< double >( );
+            linkEndStates.block( 6, i, 6, 1 ) = receiverState.template cast< double >( );
+        }
+
+        if( enableWarmStart )
+        {
+            lightTimeCalculator_->setWarmStart( false );
+        }
+    }
+
     //! Function to get the object to calculate light time.
     /*!
      * Function to get the object to calculate light time.
@@ -210,6 +210,51 @@ public:
         return isDependent;
     }
 
+    //! Function to retrieve the structure of the partials of the acceleration w.r.t. the positions of the bodies
+    /*!
+     *  Function to retrieve the structure of the partials of the acceleration w.r.t. the positions of the bodies
+     *  involved in the acceleration. Default is dense; may be overridden by derived class.
+     *  \return Structure of the position partials
+     */
+    virtual orbit_determination::PartialMatrixStructure getPositionPartialStructure( )
+    {
+        return orbit_determination::dense_partial_matrix;
+    }
+
+    //! Function to retrieve the structure of the partials of the acceleration w.r.t. the velocities of the bodies
+    /*!
+     *  Function to retrieve the structure of the partials of the acceleration w.r.t. the velocities of the bodies
+     *  involved in the acceleration. Default is dense; may be overridden by derived class (e.g. zero for gravitational
+     *  accelerations).
+     *  \return Structure of the velocity partials
+     */
+    virtual orbit_determination::PartialMatrixStructure getVelocityPartialStructure( )
+    {
+        return orbit_determination::dense_partial_matrix;
+    }
+
+    //! Function to retrieve the number of leading columns of the partial w.r.t. a propagated state that can be non-zero
+    /*!
+     * Function to retrieve the number of leading columns of the partial w.r.t. a propagated state that can be non-zero.
+     * For a translational state, only the three position columns can be non-zero if the velocity partials are zero.
+     * \param stateReferencePoint Reference point (id) for propagated state (i.e. body name for translational dynamics).
+     * \param integratedStateType Type of propagated state.
+     * \return Number of leading columns of partial that can be non-zero (0 if no dependency exists)
+     */
+    int getNumberOfNonZeroStatePartialColumns(
+            const std::pair< std::string, std::string >& stateReferencePoint,
+            const propagators::IntegratedStateType integratedStateType )
+    {
+        int numberOfColumns = getDerivativeFunctionWrtStateOfIntegratedBody(
+                    stateReferencePoint, integratedStateType ).second;
+        if( integratedStateType == propagators::translational_state && numberOfColumns == 6 &&
+                getVelocityPartialStructure( ) == orbit_determination::zero_partial_matrix )
+        {
+            numberOfColumns = 3;
+        }
+        return numberOfColumns;
+    }
+
     //! Pure virtual function for calculating the partial of the acceleration w.r.t. the position of the accelerated body.
     /*!
      *  Pure virtual function for calculating the partial of the acceleration w.r.t. the position of the accelerated body and
@@ -26,8 +26,13 @@ namespace acceleration_partials
 
 //! Class to calculate the partials of the aerodynamic acceleration w.r.t. parameters and states.
 /*!
- * Class to calculate the partials of the aerodynamic acceleration w.r.t. parameters and states. Note that the state partials
- * are computed numerically by 2nd-order central difference with perturbations hard-coded in the constructor
+ * Class to calculate the partials of the aerodynamic acceleration w.r.t. parameters and states. If the aerodynamic force
+ * is a pure drag force (no side and lift force) with coefficients that do not depend on the state of the vehicle, there is no
+ * wind model, and the angular velocity of the central body is provided, the state partials are computed analytically from
+ * the current flight conditions (with only the density gradient computed numerically for models other than an
+ * exponential atmosphere, see AtmosphericFlightConditions::getCurrentDensityGradient). Otherwise, the state partials are
+ * computed numerically by 2nd-order central difference with perturbations hard-coded in the constructor, which requires a
+ * full update of the flight conditions and acceleration for each perturbed state.
  */
 class AerodynamicAccelerationPartial: public AccelerationPartial
 {
@@ -43,6 +48,8 @@ public:
      * \param vehicleStateSetFunction Function to set the state of the body undergoing the acceleration.
      * \param acceleratedBody Body undergoing acceleration.
      * \param acceleratingBody Body exerting acceleration.
+     * \param centralBodyAngularVelocityFunction Function returning the angular velocity vector of the body exerting the
+     * acceleration, in the inertial frame (if empty, the state partials are always computed numerically).
      */
     AerodynamicAccelerationPartial(
             const std::shared_ptr< aerodynamics::AerodynamicAcceleration > aerodynamicAcceleration,
@@ -50,12 +57,16 @@ public:
             const std::function< Eigen::Vector6d( ) > vehicleStateGetFunction,
             const std::function< void( const Eigen::Vector6d& ) > vehicleStateSetFunction,
             const std::string acceleratedBody,
-            const std::string acceleratingBody ):
+            const std::string acceleratingBody,
+            const std::function< Eigen::Vector3d( ) > centralBodyAngularVelocityFunction =
+            std::function< Eigen::Vector3d( ) >( ) ):
         AccelerationPartial( acceleratedBody, acceleratingBody, basic_astrodynamics::aerodynamic ),
         aerodynamicAcceleration_( aerodynamicAcceleration ), flightConditions_( flightConditions ),
-        vehicleStateGetFunction_( vehicleStateGetFunction ), vehicleStateSetFunction_( vehicleStateSetFunction )
+        vehicleStateGetFunction_( vehicleStateGetFunction ), vehicleStateSetFunction_( vehicleStateSetFunction ),
+        centralBodyAngularVelocityFunction_( centralBodyAngularVelocityFunction ), areStatePartialsAnalytical_( false )
     {
         bodyStatePerturbations_ << 10.0, 10.0, 10.0, 1.0E-2, 1.0E-2, 1.0E-2;
+        areAnalyticalStatePartialsSupported_ = checkAnalyticalStatePartialSupport( );
     }
 
     //! Function for calculating the partial of the acceleration w.r.t. the position of body undergoing acceleration..
@@ -272,13 +283,46 @@ public:
     //! Function for updating partial w.r.t. the bodies' positions
     /*!
      *  Function for updating common blocks of partial to current state. The partial of the acceleration w.r.t. the current
-     *  state (in inertial frame) is computed numerically.
+     *  state (in inertial frame) is computed analytically if possible, and numerically otherwise (see class description).
      *  \param currentTime Time at which partials are to be calculated
      */
     void update( const double currentTime = TUDAT_NAN );
 
+    //! Function to retrieve whether the state partials were computed analytically during the last call to update( )
+    /*!
+     *  Function to retrieve whether the state partials were computed analytically during the last call to update( )
+     *  \return True if the state partials were computed analytically, false if computed numerically
+     */
+    bool getAreStatePartialsAnalytical( )
+    {
+        return areStatePartialsAnalytical_;
+    }
+
 protected:
 
+    //! Function to check whether the models used for the acceleration allow the state partials to be computed analytically
+    /*!
+     *  Function to check whether the models used for the acceleration allow the state partials to be computed
+     *  analytically, for those conditions that do not change during a propagation (coefficients that depend at most on
+     *  time, given in the aerodynamic frame, no control surfaces, no wind model and an available central body angular
+     *  velocity).
+     *  \return True if the state partials can be computed analytically (provided that the side and lift force coefficients
+     *  are zero)
+     */
+    bool checkAnalyticalStatePartialSupport( );
+
+    //! Function to compute the state partials analytically from the current flight conditions
+    void computeAnalyticalStatePartials( );
+
+    //! Function to compute the state partials numerically, by updating the flight conditions and acceleration for
+    //! perturbed states
+    /*!
+     *  Function to compute the state partials numerically, by updating the flight conditions and acceleration for
+     *  perturbed states
+     *  \param currentTime Time at which partials are to be calculated
+     */
+    void computeNumericalStatePartials( const double currentTime );
+
     //! Function to compute the partial derivative of the acceleration w.r.t. the drag coefficient
     /*!
      * Function to compute the partial derivative of the acceleration w.r.t. the drag coefficient
@@ -351,6 +395,15 @@ protected:
     //! Function to set the state of the body undergoing the acceleration
     std::function< void( const Eigen::Vector6d& ) > vehicleStateSetFunction_;
 
+    //! Function returning the angular velocity vector of the body exerting the acceleration, in the inertial frame
+    std::function< Eigen::Vector3d( ) > centralBodyAngularVelocityFunction_;
+
+    //! Boolean denoting whether the models used for the acceleration allow the state partials to be computed analytically
+    bool areAnalyticalStatePartialsSupported_;
+
+    //! Boolean denoting whether the state partials were computed analytically during the last call to update( )
+    bool areStatePartialsAnalytical_;
+
 };
 
 } // namespace acceleration_partials
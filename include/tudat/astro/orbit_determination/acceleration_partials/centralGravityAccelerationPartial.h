@@ -170,6 +170,23 @@ public:
         return std::make_pair( partialFunction, 0 );
     }
 
+    //! Function to retrieve the structure of the partials of the acceleration w.r.t. the positions of the bodies
+    /*!
+     *  Function to retrieve the structure of the partials of the acceleration w.r.t. the positions of the bodies (symmetric
+     *  gravity gradient).
+     *  \return Structure of the position partials
+     */
+    orbit_determination::PartialMatrixStructure getPositionPartialStructure( )
+    {
+        return orbit_determination::symmetric_partial_matrix;
+    }
+
+    //! Function to retrieve the structure of the partials of the acceleration w.r.t. the velocities of the bodies (zero).
+    orbit_determination::PartialMatrixStructure getVelocityPartialStructure( )
+    {
+        return orbit_determination::zero_partial_matrix;
+    }
+
     //! Function for updating partial w.r.t. the bodies' positions
     /*!
      *  Function for updating common blocks of partial to current state. For the central gravitational acceleration,
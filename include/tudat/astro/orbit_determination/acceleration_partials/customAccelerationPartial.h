@@ -0,0 +1,194 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_CUSTOMACCELERATIONPARTIAL_H
+#define TUDAT_CUSTOMACCELERATIONPARTIAL_H
+
+#include "tudat/astro/basic_astro/customAccelerationModel.h"
+
+#include "tudat/astro/orbit_determination/acceleration_partials/accelerationPartial.h"
+
+namespace tudat
+{
+
+namespace acceleration_partials
+{
+
+//! Class to calculate the partials of a state-dependent custom acceleration w.r.t. the state of the accelerated body.
+/*!
+ *  Class to calculate the partials of a state-dependent custom acceleration w.r.t. the state of the accelerated body.
+ *  The partials are computed by forward-mode automatic differentiation: the acceleration function is evaluated once
+ *  with dual numbers, providing the exact derivatives w.r.t. all six state components (instead of the twelve
+ *  acceleration evaluations, and truncation error, of a central difference).
+ */
+class CustomAccelerationPartial: public AccelerationPartial
+{
+public:
+
+    //! Constructor.
+    /*!
+     * Constructor.
+     * \param customAcceleration Custom acceleration model, for which hasStatePartials must be true.
+     * \param acceleratedBody Name of the body undergoing acceleration.
+     * \param acceleratingBody Name of the body exerting acceleration.
+     */
+    CustomAccelerationPartial(
+            const std::shared_ptr< basic_astrodynamics::CustomAccelerationModel > customAcceleration,
+            const std::string acceleratedBody,
+            const std::string acceleratingBody ):
+        AccelerationPartial( acceleratedBody, acceleratingBody, basic_astrodynamics::custom_acceleration ),
+        customAcceleration_( customAcceleration ),
+        currentStatePartial_( Eigen::Matrix< double, 3, 6 >::Zero( ) )
+    {
+        if( !customAcceleration_->hasStatePartials( ) )
+        {
+            throw std::runtime_error( "Error when creating custom acceleration partial, acceleration has no dual acceleration function" );
+        }
+    }
+
+    //! Destructor.
+    ~CustomAccelerationPartial( ){ }
+
+    //! Function for calculating the partial of the acceleration w.r.t. the position of body undergoing acceleration..
+    /*!
+     *  Function for calculating the partial of the acceleration w.r.t. the position of body undergoing acceleration
+     *  and adding it to the existing partial block
+     *  Update( ) function must have been called during current time step before calling this function.
+     *  \param partialMatrix Block of partial derivatives of acceleration w.r.t. Cartesian position of body
+     *  undergoing acceleration where current partial is to be added.
+     *  \param addContribution Variable denoting whether to return the partial itself (true) or the negative partial (false).
+     *  \param startRow First row in partialMatrix block where the computed partial is to be added.
+     *  \param startColumn First column in partialMatrix block where the computed partial is to be added.
+     */
+    void wrtPositionOfAcceleratedBody(
+            Eigen::Block< Eigen::MatrixXd > partialMatrix,
+            const bool addContribution = 1, const int startRow = 0, const int startColumn = 0 )
+    {
+        if( addContribution )
+        {
+            partialMatrix.block( startRow, startColumn, 3, 3 ) += currentStatePartial_.block( 0, 0, 3, 3 );
+        }
+        else
+        {
+            partialMatrix.block( startRow, startColumn, 3, 3 ) -= currentStatePartial_.block( 0, 0, 3, 3 );
+        }
+    }
+
+    //! Function for calculating the partial of the acceleration w.r.t. the velocity of body undergoing acceleration..
+    /*!
+     *  Function for calculating the partial of the acceleration w.r.t. the velocity of body undergoing acceleration
+     *  and adding it to the existing partial block
+     *  Update( ) function must have been called during current time step before calling this function.
+     *  \param partialMatrix Block of partial derivatives of acceleration w.r.t. Cartesian velocity of body
+     *  undergoing acceleration where current partial is to be added.
+     *  \param addContribution Variable denoting whether to return the partial itself (true) or the negative partial (false).
+     *  \param startRow First row in partialMatrix block where the computed partial is to be added.
+     *  \param startColumn First column in partialMatrix block where the computed partial is to be added.
+     */
+    void wrtVelocityOfAcceleratedBody(
+            Eigen::Block< Eigen::MatrixXd > partialMatrix,
+            const bool addContribution = 1, const int startRow = 0, const int startColumn = 3 )
+    {
+        if( addContribution )
+        {
+            partialMatrix.block( startRow, startColumn, 3, 3 ) += currentStatePartial_.block( 0, 3, 3, 3 );
+        }
+        else
+        {
+            partialMatrix.block( startRow, startColumn, 3, 3 ) -= currentStatePartial_.block( 0, 3, 3, 3 );
+        }
+    }
+
+    //! Function for calculating the partial of the acceleration w.r.t. the position of body exerting acceleration.
+    /*!
+     *  Function for calculating the partial of the acceleration w.r.t. the position of body exerting acceleration, which
+     *  is zero, since the custom acceleration depends only on the state of the body undergoing acceleration.
+     *  \param partialMatrix Block of partial derivatives of acceleration w.r.t. Cartesian position of body
+     *  exerting acceleration where current partial is to be added.
+     *  \param addContribution Variable denoting whether to return the partial itself (true) or the negative partial (false).
+     *  \param startRow First row in partialMatrix block where the computed partial is to be added.
+     *  \param startColumn First column in partialMatrix block where the computed partial is to be added.
+     */
+    void wrtPositionOfAcceleratingBody( Eigen::Block< Eigen::MatrixXd > partialMatrix,
+                                        const bool addContribution = 1, const int startRow = 0, const int startColumn = 0 ){ }
+
+    //! Function for determining if the acceleration is dependent on a non-translational integrated state.
+    /*!
+     *  Function for determining if the acceleration is dependent on a non-translational integrated state (no dependency
+     *  for custom acceleration).
+     *  \param stateReferencePoint Reference point id of propagated state
+     *  \param integratedStateType Type of propagated state for which dependency is to be determined.
+     *  \return True if dependency exists (non-zero partial), false otherwise.
+     */
+    bool isStateDerivativeDependentOnIntegratedAdditionalStateTypes(
+                const std::pair< std::string, std::string >& stateReferencePoint,
+                const propagators::IntegratedStateType integratedStateType )
+    {
+        return 0;
+    }
+
+    //! Function for setting up and retrieving a function returning a partial w.r.t. a double parameter.
+    /*!
+     *  Function for setting up and retrieving a function returning a partial w.r.t. a double parameter (no dependency
+     *  for custom acceleration).
+     *  \param parameter Parameter w.r.t. which partial is to be taken.
+     *  \return Pair of parameter partial function and number of columns in partial (0 for no dependency).
+     */
+    std::pair< std::function< void( Eigen::MatrixXd& ) >, int >
+    getParameterPartialFunction( std::shared_ptr< estimatable_parameters::EstimatableParameter< double > > parameter )
+    {
+        std::function< void( Eigen::MatrixXd& ) > partialFunction;
+        return std::make_pair( partialFunction, 0 );
+    }
+
+    //! Function for setting up and retrieving a function returning a partial w.r.t. a vector parameter.
+    /*!
+     *  Function for setting up and retrieving a function returning a partial w.r.t. a vector parameter (no dependency
+     *  for custom acceleration).
+     *  \param parameter Parameter w.r.t. which partial is to be taken.
+     *  \return Pair of parameter partial function and number of columns in partial (0 for no dependency).
+     */
+    std::pair< std::function< void( Eigen::MatrixXd& ) >, int > getParameterPartialFunction(
+            std::shared_ptr< estimatable_parameters::EstimatableParameter< Eigen::VectorXd > > parameter )
+    {
+        std::function< void( Eigen::MatrixXd& ) > partialFunction;
+        return std::make_pair( partialFunction, 0 );
+    }
+
+    //! Function for updating partial w.r.t. the bodies' states
+    /*!
+     *  Function for updating partial w.r.t. the bodies' states, by updating the acceleration model and evaluating
+     *  the acceleration function with dual numbers.
+     *  \param currentTime Time at which partials are to be calculated
+     */
+    void update( const double currentTime = TUDAT_NAN )
+    {
+        if( !( currentTime_ == currentTime ) )
+        {
+            customAcceleration_->updateMembers( currentTime );
+            currentStatePartial_ = customAcceleration_->getCurrentStatePartial( );
+            currentTime_ = currentTime;
+        }
+    }
+
+protected:
+
+    //! Custom acceleration model.
+    std::shared_ptr< basic_astrodynamics::CustomAccelerationModel > customAcceleration_;
+
+    //! Current partial of the acceleration w.r.t. the state of the body undergoing acceleration.
+    Eigen::Matrix< double, 3, 6 > currentStatePartial_;
+};
+
+} // namespace acceleration_partials
+
+} // namespace tudat
+
+#endif // TUDAT_CUSTOMACCELERATIONPARTIAL_H
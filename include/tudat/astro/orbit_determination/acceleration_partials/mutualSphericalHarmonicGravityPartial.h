@@ -191,6 +191,32 @@ public:
                     partialMatrix, -1 );
     }
 
+    //! Function to retrieve the structure of the partials of the acceleration w.r.t. the positions of the bodies
+    /*!
+     *  Function to retrieve the structure of the partials of the acceleration w.r.t. the positions of the bodies, combined
+     *  from those of the constituent spherical harmonic partials.
+     *  \return Structure of the position partials
+     */
+    orbit_determination::PartialMatrixStructure getPositionPartialStructure( )
+    {
+        return orbit_determination::combinePartialMatrixStructures(
+                    accelerationPartialOfShExpansionOfBodyExertingAcceleration_->getPositionPartialStructure( ),
+                    accelerationPartialOfShExpansionOfBodyUndergoingAcceleration_->getPositionPartialStructure( ) );
+    }
+
+    //! Function to retrieve the structure of the partials of the acceleration w.r.t. the velocities of the bodies
+    /*!
+     *  Function to retrieve the structure of the partials of the acceleration w.r.t. the velocities of the bodies, combined
+     *  from those of the constituent spherical harmonic partials.
+     *  \return Structure of the velocity partials
+     */
+    orbit_determination::PartialMatrixStructure getVelocityPartialStructure( )
+    {
+        return orbit_determination::combinePartialMatrixStructures(
+                    accelerationPartialOfShExpansionOfBodyExertingAcceleration_->getVelocityPartialStructure( ),
+                    accelerationPartialOfShExpansionOfBodyUndergoingAcceleration_->getVelocityPartialStructure( ) );
+    }
+
     //! Function for updating the partial object to current state and time.
     /*!
      *  Function for updating the partial object to current state and time. Calculates the variables that are
@@ -48,6 +48,31 @@ public:
     //! Destructor
     ~RingGravityPartial( ){ }
 
+    //! Function to retrieve the structure of the partials of the acceleration w.r.t. the positions of the bodies
+    /*!
+     *  Function to retrieve the structure of the partials of the acceleration w.r.t. the positions of the bodies, which
+     *  are symmetric (gravity gradient) unless the rotation of the body exerting acceleration depends on the
+     *  translational state.
+     *  \return Structure of the position partials
+     */
+    orbit_determination::PartialMatrixStructure getPositionPartialStructure( )
+    {
+        return ( rotationMatrixPartials_.count( std::make_pair( estimatable_parameters::initial_body_state, "" ) ) > 0 ) ?
+                    orbit_determination::dense_partial_matrix : orbit_determination::symmetric_partial_matrix;
+    }
+
+    //! Function to retrieve the structure of the partials of the acceleration w.r.t. the velocities of the bodies
+    /*!
+     *  Function to retrieve the structure of the partials of the acceleration w.r.t. the velocities of the bodies, which
+     *  are zero unless the rotation of the body exerting acceleration depends on the translational state.
+     *  \return Structure of the velocity partials
+     */
+    orbit_determination::PartialMatrixStructure getVelocityPartialStructure( )
+    {
+        return ( rotationMatrixPartials_.count( std::make_pair( estimatable_parameters::initial_body_state, "" ) ) > 0 ) ?
+                    orbit_determination::dense_partial_matrix : orbit_determination::zero_partial_matrix;
+    }
+
     //! Function for updating the partial object to current state and time.
     /*!
      *  Function for updating the partial object to current state and time. Calculates the variables that are
@@ -246,6 +246,31 @@ public:
     std::pair< std::function< void( Eigen::MatrixXd& ) >, int > getGravitationalParameterPartialFunction(
             const estimatable_parameters::EstimatebleParameterIdentifier& parameterId );
 
+    //! Function to retrieve the structure of the partials of the acceleration w.r.t. the positions of the bodies
+    /*!
+     *  Function to retrieve the structure of the partials of the acceleration w.r.t. the positions of the bodies, which
+     *  are symmetric (gravity gradient) unless the rotation of the body exerting acceleration depends on the
+     *  translational state.
+     *  \return Structure of the position partials
+     */
+    orbit_determination::PartialMatrixStructure getPositionPartialStructure( )
+    {
+        return ( rotationMatrixPartials_.count( std::make_pair( estimatable_parameters::initial_body_state, "" ) ) > 0 ) ?
+                    orbit_determination::dense_partial_matrix : orbit_determination::symmetric_partial_matrix;
+    }
+
+    //! Function to retrieve the structure of the partials of the acceleration w.r.t. the velocities of the bodies
+    /*!
+     *  Function to retrieve the structure of the partials of the acceleration w.r.t. the velocities of the bodies, which
+     *  are zero unless the rotation of the body exerting acceleration depends on the translational state.
+     *  \return Structure of the velocity partials
+     */
+    orbit_determination::PartialMatrixStructure getVelocityPartialStructure( )
+    {
+        return ( rotationMatrixPartials_.count( std::make_pair( estimatable_parameters::initial_body_state, "" ) ) > 0 ) ?
+                    orbit_determination::dense_partial_matrix : orbit_determination::zero_partial_matrix;
+    }
+
     //! Function for updating the partial object to current state and time.
     /*!
      *  Function for updating the partial object to current state and time. Calculates the variables that are
@@ -399,6 +424,22 @@ protected:
             const int parameterSize,
             Eigen::MatrixXd& accelerationPartial );
 
+    //! Function to set the partials wrt coefficients that are omitted by the acceleration model to zero.
+    /*!
+     *  Function to set the partials wrt coefficients that are omitted by the acceleration model to zero, for an
+     *  acceleration model of which the expansion is truncated as a function of distance (see
+     *  SphericalHarmonicsGravitationalAccelerationModel::setDegreeTruncationTolerance).
+     *  \param blockIndices List of coefficient indices wrt which the partials are taken.
+     *  \param partialDerivatives Matrix of acceleration partials, with each column containg the partial wrt a single
+     *  coefficient (in same order as blockIndices), modified by this function.
+     */
+    void setPartialsOfTruncatedCoefficientsToZero(
+            const std::vector< std::pair< int, int > >& blockIndices,
+            Eigen::MatrixXd& partialDerivatives );
+
+    //! Acceleration model for which partials are computed (used to retrieve its values at the current time).
+    std::shared_ptr< gravitation::SphericalHarmonicsGravitationalAccelerationModel > accelerationModel_;
+
     //! Function to return the gravitational parameter used for calculating the acceleration.
     std::function< double( ) > gravitationalParameterFunction_;
 
@@ -462,6 +503,9 @@ protected:
      */
     Eigen::Vector3d bodyFixedSphericalPosition_;
 
+    //! Current matrix to convert a spherical gradient to a Cartesian gradient, set by update( time ) function.
+    Eigen::Matrix3d currentSphericalToCartesianGradientMatrix_;
+
     //! The current partial of the acceleration wrt the position of the body undergoing the acceleration.
     /*!
      *  The current partial of the acceleration wrt the position of the body undergoing the acceleration.
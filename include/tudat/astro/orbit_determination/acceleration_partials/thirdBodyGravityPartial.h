@@ -446,6 +446,32 @@ public:
         return std::max( partialFunctionFromDirectGravity.second, partialFunctionFromCentralGravity.second );
     }
 
+    //! Function to retrieve the structure of the partials of the acceleration w.r.t. the positions of the bodies
+    /*!
+     *  Function to retrieve the structure of the partials of the acceleration w.r.t. the positions of the bodies, combined
+     *  from those of the direct gravity partials on the body undergoing acceleration and on the central body.
+     *  \return Structure of the position partials
+     */
+    orbit_determination::PartialMatrixStructure getPositionPartialStructure( )
+    {
+        return orbit_determination::combinePartialMatrixStructures(
+                    partialOfDirectGravityOnBodyUndergoingAcceleration_->getPositionPartialStructure( ),
+                    partialOfDirectGravityOnCentralBody_->getPositionPartialStructure( ) );
+    }
+
+    //! Function to retrieve the structure of the partials of the acceleration w.r.t. the velocities of the bodies
+    /*!
+     *  Function to retrieve the structure of the partials of the acceleration w.r.t. the velocities of the bodies, combined
+     *  from those of the direct gravity partials on the body undergoing acceleration and on the central body.
+     *  \return Structure of the velocity partials
+     */
+    orbit_determination::PartialMatrixStructure getVelocityPartialStructure( )
+    {
+        return orbit_determination::combinePartialMatrixStructures(
+                    partialOfDirectGravityOnBodyUndergoingAcceleration_->getVelocityPartialStructure( ),
+                    partialOfDirectGravityOnCentralBody_->getVelocityPartialStructure( ) );
+    }
+
     //! Function for updating partials  w.r.t. the bodies' positions
     /*!
      *  Function for updating common blocks of partial to current state. For the third body gravitational acceleration,
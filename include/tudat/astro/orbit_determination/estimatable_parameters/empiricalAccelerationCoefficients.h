@@ -14,7 +14,7 @@
 
 #include "tudat/astro/orbit_determination/estimatable_parameters/estimatableParameter.h"
 #include "tudat/astro/basic_astro/empiricalAcceleration.h"
-#include "tudat/math/interpolators/piecewiseConstantInterpolator.h"
+#include "tudat/math/interpolators/arcCursor.h"
 
 namespace tudat
 {
@@ -294,7 +294,8 @@ public:
             }
         }
 
-        // Add maximum time to end of arc list.
+        // Create cursor to retrieve current arc, and add maximum time to end of arc list.
+        arcCursor_ = std::make_shared< interpolators::ArcCursor >( arcStartTimeList_ );
         arcStartTimeList_.push_back( 1.0E300 );
 
         // Retrieve current empirical accelerations (set in each arc)
@@ -308,21 +309,10 @@ public:
             }
 
         }
-        for( unsigned int i = 0; i < arcStartTimeList_.size( ); i++ )
+        for( unsigned int i = 0; i < arcStartTimeList_.size( ) - 1; i++ )
         {
             empiricalAccelerationList_.push_back( currentTimeInvariantEmpiricalAccelerations );
         }
-
-        // Create piecewise constant interpolator for empirical acceleration
-        empiricalAccelerationInterpolator_ = std::make_shared<
-                interpolators::PiecewiseConstantInterpolator< double, Eigen::Matrix3d > >(
-                    arcStartTimeList_, empiricalAccelerationList_ );
-        typedef interpolators::OneDimensionalInterpolator< double, Eigen::Matrix3d > LocalInterpolator;
-
-        empiricalAccelerationFunction_ =
-                std::bind( static_cast< Eigen::Matrix3d( LocalInterpolator::* )( const double ) >
-                           ( &LocalInterpolator::interpolate ), empiricalAccelerationInterpolator_, std::placeholders::_1 );
-
     }
 
     //! Destructor
@@ -397,9 +387,8 @@ public:
                 empiricalAccelerationList_[ i ] = currentArcAccelerations;
             }
 
-            // Set list of arc times and interpolation function
-            empiricalAccelerationInterpolator_->resetDependentValues( empiricalAccelerationList_ );
-            empiricalAcceleration_.at( i )->resetAccelerationComponentsFunction( empiricalAccelerationFunction_ );
+            // Set arc-wise accelerations in acceleration model
+            empiricalAcceleration_.at( i )->resetArcWiseAccelerationComponents( arcCursor_, empiricalAccelerationList_ );
 
             if( currentIndex != getParameterSize( ) )
             {
@@ -434,9 +423,25 @@ public:
         return accelerationIndices_;
     }
 
-    std::shared_ptr< interpolators::LookUpScheme< double > > getArcTimeLookupScheme( )
+    //! Function to retrieve the object used to retrieve the arc in which a given time lies
+    /*!
+     *  Function to retrieve the object used to retrieve the arc in which a given time lies (shared with the acceleration
+     *  models, so that the arc index is retrieved in constant time during propagation).
+     *  eturn Object used to retrieve the arc in which a given time lies
+     */
+    std::shared_ptr< interpolators::ArcCursor > getArcCursor( )
+    {
+        return arcCursor_;
+    }
+
+    //! Function to retrieve the times at which the arcs start
+    /*!
+     *  Function to retrieve the times at which the arcs start
+     *  \return Times at which the arcs start
+     */
+    std::vector< double > getArcStartTimes( )
     {
-        return empiricalAccelerationInterpolator_->getLookUpScheme( );
+        return std::vector< double >( arcStartTimeList_.begin( ), arcStartTimeList_.end( ) - 1 );
     }
 
 protected:
@@ -446,12 +451,8 @@ private:
     //! Class defining properties of empirical acceleration used in propagation.
     std::vector< std::shared_ptr< basic_astrodynamics::EmpiricalAcceleration > > empiricalAcceleration_;
 
-    //! Interpolator to compute the empirical acceleration as a function of time
-    std::shared_ptr< interpolators::PiecewiseConstantInterpolator< double, Eigen::Matrix3d > >
-    empiricalAccelerationInterpolator_;
-
-    //! Function returning the empirical acceleration as a function of time (linked to empiricalAccelerationInterpolator_)
-    std::function< Eigen::Matrix3d( const double ) > empiricalAccelerationFunction_;
+    //! Object used to retrieve the arc in which a given time lies
+    std::shared_ptr< interpolators::ArcCursor > arcCursor_;
 
     //! List of components in empirical accelerations that are to be estimated for every arc.
     std::map< basic_astrodynamics::EmpiricalAccelerationFunctionalShapes, std::vector< int > > accelerationIndices_;
@@ -174,6 +174,16 @@ public:
         return coefficientInterpolator_->getLookUpScheme( );
     }
 
+    //! Function to retrieve the times at which the arcs start
+    /*!
+     *  Function to retrieve the times at which the arcs start
+     *  \return Times at which the arcs start
+     */
+    std::vector< double > getArcStartTimes( )
+    {
+        return std::vector< double >( timeLimits_.begin( ), timeLimits_.end( ) - 1 );
+    }
+
 protected:
 
 private:
@@ -83,7 +83,7 @@ public:
 
         double partialValue = getPartialOfFirstOrderRelativisticLightTimeCorrectionWrtSingleGravitationalParameter(
                     correctionCalculator_->getCurrentLightTimeCorrectionComponent( bodyIndex ),
-                    perturbingBodyGravitationalParameterFunctions_.at( bodyIndex )( ) );
+                    correctionCalculator_->getCurrentPerturbingBodyGravitationalParameter( bodyIndex ) );
         return std::make_pair(
                     ( Eigen::Matrix< double, 1, Eigen::Dynamic >( 1, 1 ) << partialValue ).finished( ),
                     ( times[ 0 ] + times[ 1 ] ) / 2.0 );
@@ -101,7 +101,7 @@ public:
     {
         double partialValue = getPartialOfFirstOrderRelativisticLightTimeCorrectionWrtPpnParameterGamma(
                     correctionCalculator_->getCurrentTotalLightTimeCorrection( ),
-                    correctionCalculator_->getPpnParameterGammaFunction_( )( ) );
+                    correctionCalculator_->getCurrentPpnParameterGamma( ) );
         return std::make_pair(
                     ( Eigen::Matrix< double, 1, Eigen::Dynamic >( 1, 1 ) << partialValue ).finished( ),
                     ( times[ 0 ] + times[ 1 ] ) / 2.0 );
@@ -186,6 +186,103 @@ protected:
 };
 
 
+//! Class that stores the partials computed by another observation partial object, so that they are computed once per epoch
+/*!
+ *  Class that stores the partials computed by another observation partial object, so that they are computed once per
+ *  epoch. This is used for the partials of the constituent one-way links of composite observables (n-way range and two-way
+ *  Doppler), which are shared by all composite observables of the same link (see OneWayRangePartialRegistry), so that the
+ *  one-way partials of a link are computed only once if range and Doppler of that link are processed together. When caching
+ *  is enabled, the partials are stored with the link end times and the link end of fixed time as key. The caching should
+ *  be enabled at the start of a single pass over the observations, and disabled at its end (which clears the stored
+ *  partials), as the partials are invalidated by changes in the environment.
+ */
+template< int ObservationSize >
+class CachedObservationPartial: public ObservationPartial< ObservationSize >
+{
+public:
+
+    typedef std::vector< std::pair< Eigen::Matrix< double, ObservationSize, Eigen::Dynamic >, double > > ObservationPartialReturnType;
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param observationPartial Observation partial object of which the partials are stored
+     */
+    CachedObservationPartial( const std::shared_ptr< ObservationPartial< ObservationSize > > observationPartial ):
+        ObservationPartial< ObservationSize >( observationPartial->getParameterIdentifier( ) ),
+        observationPartial_( observationPartial ), useCaching_( false ){ }
+
+    //! Destructor
+    ~CachedObservationPartial( ){ }
+
+    //! Function to calculate the observation partial(s) at required time and state, or retrieve them if already computed
+    /*!
+     *  Function to calculate the observation partial(s) at required time and state, or retrieve them if they have been
+     *  computed for the same link end times and link end of fixed time since caching was enabled.
+     *  \param states Link end states. Index maps to link end for a given ObsevableType through getLinkEndIndex function.
+     *  \param times Link end times.
+     *  \param linkEndOfFixedTime Link end that is kept fixed when computing the observable.
+     *  \param currentObservation Value of the observation for which the partial is to be computed
+     *  \return Vector of pairs containing partial values and associated times.
+     */
+    ObservationPartialReturnType calculatePartial(
+            const std::vector< Eigen::Vector6d >& states,
+            const std::vector< double >& times,
+            const observation_models::LinkEndType linkEndOfFixedTime = observation_models::receiver,
+            const Eigen::Matrix< double, ObservationSize, 1 >& currentObservation =
+            Eigen::Matrix< double, ObservationSize, 1 >::Constant( TUDAT_NAN ) )
+    {
+        if( !useCaching_ )
+        {
+            return observationPartial_->calculatePartial( states, times, linkEndOfFixedTime, currentObservation );
+        }
+
+        std::pair< std::vector< double >, observation_models::LinkEndType > partialKey =
+                std::make_pair( times, linkEndOfFixedTime );
+        typename std::map< std::pair< std::vector< double >, observation_models::LinkEndType >,
+                ObservationPartialReturnType >::const_iterator cacheIterator = cachedPartials_.find( partialKey );
+        if( cacheIterator != cachedPartials_.end( ) )
+        {
+            return cacheIterator->second;
+        }
+
+        ObservationPartialReturnType currentPartials =
+                observationPartial_->calculatePartial( states, times, linkEndOfFixedTime, currentObservation );
+        cachedPartials_[ partialKey ] = currentPartials;
+        return currentPartials;
+    }
+
+    //! Function to set whether the computed partials are stored (clearing the stored partials)
+    void setPartialCaching( const bool useCaching )
+    {
+        useCaching_ = useCaching;
+        cachedPartials_.clear( );
+    }
+
+    //! Function to retrieve the number of stored partials
+    int getNumberOfCachedPartials( )
+    {
+        return cachedPartials_.size( );
+    }
+
+    //! Function to retrieve the observation partial object of which the partials are stored
+    std::shared_ptr< ObservationPartial< ObservationSize > > getObservationPartial( )
+    {
+        return observationPartial_;
+    }
+
+private:
+
+    //! Observation partial object of which the partials are stored
+    std::shared_ptr< ObservationPartial< ObservationSize > > observationPartial_;
+
+    //! Boolean denoting whether the computed partials are stored
+    bool useCaching_;
+
+    //! Stored partials, with link end times and link end of fixed time as key
+    std::map< std::pair< std::vector< double >, observation_models::LinkEndType >, ObservationPartialReturnType > cachedPartials_;
+};
+
 //! Class for computing the derivative of any observable w.r.t. a constant absolute observation bias
 /*!
  *  Class for computing the derivative of any observable w.r.t. a constant absolute observation bias. Note that this partial is
@@ -284,6 +381,7 @@ public:
         constantPartial_ = Eigen::Matrix< double, ObservationSize, ObservationSize >::Identity( );
         totalPartial_ = Eigen::Matrix< double, ObservationSize, Eigen::Dynamic >::Zero(
                     ObservationSize, ObservationSize * numberOfArcs_ );
+        previousArcIndex_ = -1;
     }
 
     //! Destructor
@@ -306,15 +404,17 @@ public:
             const Eigen::Matrix< double, ObservationSize, 1 >& currentObservation =
             Eigen::Matrix< double, ObservationSize, 1 >::Zero( ) )
     {
-//        std::cout << "TEST CALCULATE PARTIALS W.R.T. ARC WISE CONSTANT BIAS" << "\n\n";
-        int currentIndex = arcLookupScheme_->findNearestLowerNeighbour( times.at( linkEndIndex_ ) );
-
+        // Reset only the block set in the previous call
+        if( previousArcIndex_ >= 0 )
+        {
+            totalPartial_.block( 0, previousArcIndex_ * ObservationSize, ObservationSize, ObservationSize ).setZero( );
+            previousArcIndex_ = -1;
+        }
 
-        totalPartial_.setZero( );
         if( arcLookupScheme_->getMinimumValue( ) <= times.at( linkEndIndex_ ) )
         {
-            int currentIndex = arcLookupScheme_->findNearestLowerNeighbour( times.at( linkEndIndex_ ) );
-            totalPartial_.block( 0, currentIndex * ObservationSize, ObservationSize, ObservationSize ) = constantPartial_;
+            previousArcIndex_ = arcLookupScheme_->findNearestLowerNeighbour( times.at( linkEndIndex_ ) );
+            totalPartial_.block( 0, previousArcIndex_ * ObservationSize, ObservationSize, ObservationSize ) = constantPartial_;
         }
 
         return { std::make_pair( totalPartial_, times.at( linkEndIndex_ ) ) };
@@ -343,6 +443,9 @@ private:
     //! Pre-allocated partial vector
     Eigen::Matrix< double, ObservationSize, Eigen::Dynamic > totalPartial_;
 
+    //! Index of arc for which the partial was set in the previous call (-1 if none)
+    int previousArcIndex_;
+
 };
 
 //! Class for computing the derivative of any observable w.r.t. a constant relative observation bias
@@ -433,6 +536,7 @@ public:
         linkEndIndex_( linkEndIndex ), numberOfArcs_( numberOfArcs )
     {
        totalPartial_ = Eigen::VectorXd::Zero( ObservationSize * numberOfArcs_ );
+       previousArcIndex_ = -1;
     }
 
     //! Destructor
@@ -455,12 +559,17 @@ public:
             const Eigen::Matrix< double, ObservationSize, 1 >& currentObservation =
             Eigen::Matrix< double, ObservationSize, 1 >::Zero( ) )
     {
-        totalPartial_.setZero( );
+        // Reset only the segment set in the previous call
+        if( previousArcIndex_ >= 0 )
+        {
+            totalPartial_.segment( previousArcIndex_ * ObservationSize, ObservationSize ).setZero( );
+            previousArcIndex_ = -1;
+        }
 
         if( arcLookupScheme_->getMinimumValue( ) <= times.at( linkEndIndex_ ) )
         {
-            int currentIndex = arcLookupScheme_->findNearestLowerNeighbour( times.at( linkEndIndex_ ) );
-            totalPartial_.segment( currentIndex * ObservationSize, ObservationSize ) = currentObservation;
+            previousArcIndex_ = arcLookupScheme_->findNearestLowerNeighbour( times.at( linkEndIndex_ ) );
+            totalPartial_.segment( previousArcIndex_ * ObservationSize, ObservationSize ) = currentObservation;
         }
         return { std::make_pair( totalPartial_, times.at( linkEndIndex_ ) ) };
     }
@@ -485,6 +594,9 @@ private:
     //! Pre-allocated partial vector
     Eigen::VectorXd totalPartial_;
 
+    //! Index of arc for which the partial was set in the previous call (-1 if none)
+    int previousArcIndex_;
+
 };
 
 //! Class for computing the derivative of any observable w.r.t. a constant time drift bias
@@ -592,6 +704,7 @@ public:
             linkEndIndex_( linkEndIndex ), numberOfArcs_( numberOfArcs ), referenceEpochs_( referenceEpochs )
     {
         totalPartial_ = Eigen::VectorXd::Zero( ObservationSize * numberOfArcs_ );
+        previousArcIndex_ = -1;
     }
 
     //! Destructor
@@ -622,8 +735,13 @@ public:
             observationTime( i, 0 ) = times.at( linkEndIndex_ ) - referenceEpochs_.at( currentIndex );
         }
 
-        totalPartial_.setZero( );
+        // Reset only the segment set in the previous call
+        if( previousArcIndex_ >= 0 )
+        {
+            totalPartial_.segment( previousArcIndex_ * ObservationSize, ObservationSize ).setZero( );
+        }
         totalPartial_.segment( currentIndex * ObservationSize, ObservationSize ) = observationTime;
+        previousArcIndex_ = currentIndex;
 
         return { std::make_pair( totalPartial_, times.at( linkEndIndex_ ) ) };
     }
@@ -648,6 +766,9 @@ private:
     //! Pre-allocated partial vector
     Eigen::VectorXd totalPartial_;
 
+    //! Index of arc for which the partial was set in the previous call (-1 if none)
+    int previousArcIndex_;
+
     //! Reference epochs (per arc) at which the time drift biases are initialised.
     std::vector< double > referenceEpochs_;
 
@@ -751,6 +872,7 @@ public:
             linkEndIndex_( linkEndIndex ), numberOfArcs_( numberOfArcs )
     {
         totalPartial_ = Eigen::VectorXd::Zero( 1 * numberOfArcs_ );
+        previousArcIndex_ = -1;
     }
 
     //! Destructor
@@ -781,8 +903,13 @@ public:
             observationTime( i, 0 ) = - 1.0;
         }
 
-        totalPartial_.setZero( );
+        // Reset only the segment set in the previous call
+        if( previousArcIndex_ >= 0 )
+        {
+            totalPartial_.segment( previousArcIndex_ * ObservationSize, ObservationSize ).setZero( );
+        }
         totalPartial_.segment( currentIndex * ObservationSize, ObservationSize ) = observationTime;
+        previousArcIndex_ = currentIndex;
 
         return { std::make_pair( totalPartial_, times.at( linkEndIndex_ ) ) };
     }
@@ -807,6 +934,9 @@ private:
     //! Pre-allocated partial vector
     Eigen::VectorXd totalPartial_;
 
+    //! Index of arc for which the partial was set in the previous call (-1 if none)
+    int previousArcIndex_;
+
 };
 
 
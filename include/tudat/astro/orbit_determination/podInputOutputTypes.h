@@ -12,6 +12,7 @@
 #define TUDAT_PODINPUTOUTPUTTYPES_H
 
 #include <map>
+#include <set>
 #include <vector>
 #include <iostream>
 #include <memory>
@@ -19,7 +20,9 @@
 #include <Eigen/Core>
 #include <Eigen/LU>
 
+#include "tudat/basics/memoryFootprint.h"
 #include "tudat/basics/timeType.h"
+#include "tudat/math/basic/leastSquaresEstimation.h"
 #include "tudat/astro/observation_models/linkTypeDefs.h"
 #include "tudat/astro/observation_models/observableTypes.h"
 #include "tudat/simulation/estimation_setup/observations.h"
@@ -47,7 +50,9 @@ public:
         reintegrateEquationsOnFirstIteration_( true ),
         reintegrateVariationalEquations_( true ),
         saveDesignMatrix_( true ),
-        printOutput_( true )
+        printOutput_( true ),
+        accumulateNormalEquations_( false ),
+        maximumNumberOfObservationsPerBlock_( 10000 )
     {
         weightsMatrixDiagonals_ = Eigen::VectorXd::Zero( observationCollection->getTotalObservableSize( ) );
         setConstantWeightsMatrix( 1.0 );
@@ -500,6 +505,40 @@ public:
         return considerParametersIncluded_;
     }
 
+    //! Function to set whether the normal equations are to be accumulated per block of observations
+    /*!
+     * Function to set whether the normal equations (H^T W H and H^T W y) are to be accumulated per block of observations,
+     * instead of forming the full design matrix H. This reduces the memory use of the estimation from (number of
+     * observations) x (number of parameters) to (number of parameters) x (number of parameters). The estimation results
+     * are equal (up to round-off) to those computed from the full design matrix, but the design matrix is not available in
+     * the output (regardless of the saveDesignMatrix setting).
+     * \param accumulateNormalEquations Boolean denoting whether the normal equations are to be accumulated
+     * \param maximumNumberOfObservationsPerBlock Maximum number of observations for which the partials are computed at
+     * once (observation sets with more observations are split into several blocks)
+     */
+    void setNormalEquationsAccumulation( const bool accumulateNormalEquations,
+                                         const int maximumNumberOfObservationsPerBlock = 10000 )
+    {
+        if( maximumNumberOfObservationsPerBlock < 1 )
+        {
+            throw std::runtime_error( "Error when setting normal equations accumulation, block size must be positive" );
+        }
+        accumulateNormalEquations_ = accumulateNormalEquations;
+        maximumNumberOfObservationsPerBlock_ = maximumNumberOfObservationsPerBlock;
+    }
+
+    //! Function to return the boolean denoting whether the normal equations are to be accumulated per block of observations
+    bool getAccumulateNormalEquations( ) const
+    {
+        return accumulateNormalEquations_;
+    }
+
+    //! Function to return the maximum number of observations per block when accumulating the normal equations
+    int getMaximumNumberOfObservationsPerBlock( ) const
+    {
+        return maximumNumberOfObservationsPerBlock_;
+    }
+
 
 
 protected:
@@ -531,6 +570,12 @@ protected:
 
     //! Boolean denoting whether consider parameters are included in the covariance analysis
     bool considerParametersIncluded_;
+
+    //! Boolean denoting whether the normal equations are accumulated per block of observations (without full design matrix)
+    bool accumulateNormalEquations_;
+
+    //! Maximum number of observations per block when accumulating the normal equations
+    int maximumNumberOfObservationsPerBlock_;
 };
 
 
@@ -614,6 +659,143 @@ protected:
 
 
 
+//! Class defining the reweighting of observations (and rejection of outliers) within each iteration of the estimation
+/*!
+ *  Class defining the reweighting of observations (and rejection of outliers) within each iteration of the estimation.
+ *  When provided to the EstimationInput, the parameter correction of each iteration is computed in an inner loop: the
+ *  least squares problem is solved, the post-fit residuals are computed, and the weights are updated from these residuals,
+ *  after which the least squares problem is solved again with the new weights. This is repeated until the weights are
+ *  converged, or the maximum number of reweighting iterations is reached. The inner loop reuses the design matrix of the
+ *  iteration, so that the dynamics are not repropagated, and the partials are not recomputed.
+ *
+ *  The weights are computed from the nominal weights w0 (as set in the EstimationInput) and the normalized post-fit
+ *  residual z = |r| sqrt( w0 ) of each observation:
+ *
+ *  - If z exceeds the outlier rejection threshold, the observation is rejected (weight set to zero)
+ *  - Else, if z exceeds the Huber threshold k, the weight is reduced to w0 k / z (iteratively reweighted least squares
+ *    with Huber weight function)
+ *  - Else, the nominal weight is used
+ */
+class ObservationReweightingSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param outlierRejectionThreshold Normalized residual above which an observation is rejected (NaN if no rejection)
+     * \param huberThreshold Normalized residual above which the weight of an observation is reduced according to the Huber
+     * weight function (NaN if no reduction)
+     * \param maximumNumberOfReweightingIterations Maximum number of times the weights are updated within an iteration
+     * \param weightChangeTolerance Tolerance on the change of the weights (relative to the nominal weights) below which the
+     * weights are deemed converged
+     */
+    ObservationReweightingSettings(
+            const double outlierRejectionThreshold = 3.0,
+            const double huberThreshold = TUDAT_NAN,
+            const int maximumNumberOfReweightingIterations = 5,
+            const double weightChangeTolerance = 1.0E-3 ):
+        outlierRejectionThreshold_( outlierRejectionThreshold ), huberThreshold_( huberThreshold ),
+        maximumNumberOfReweightingIterations_( maximumNumberOfReweightingIterations ),
+        weightChangeTolerance_( weightChangeTolerance )
+    {
+        if( maximumNumberOfReweightingIterations_ < 0 )
+        {
+            throw std::runtime_error( "Error when creating observation reweighting settings, number of iterations must be positive" );
+        }
+    }
+
+    //! Function to compute the weights of the observations from their nominal weights and post-fit residuals
+    /*!
+     * Function to compute the weights of the observations from their nominal weights and post-fit residuals
+     * \param nominalWeights Nominal weights of the observations
+     * \param residuals Post-fit residuals of the observations
+     * \return Weights of the observations (zero for rejected observations)
+     */
+    Eigen::VectorXd computeWeights( const Eigen::VectorXd& nominalWeights, const Eigen::VectorXd& residuals ) const
+    {
+        if( nominalWeights.rows( ) != residuals.rows( ) )
+        {
+            throw std::runtime_error( "Error when reweighting observations, number of weights and residuals are inconsistent" );
+        }
+
+        Eigen::VectorXd weights = nominalWeights;
+        for( int i = 0; i < weights.rows( ); i++ )
+        {
+            double normalizedResidual = std::fabs( residuals( i ) ) * std::sqrt( nominalWeights( i ) );
+            if( normalizedResidual > outlierRejectionThreshold_ )
+            {
+                weights( i ) = 0.0;
+            }
+            else if( normalizedResidual > huberThreshold_ )
+            {
+                weights( i ) = nominalWeights( i ) * huberThreshold_ / normalizedResidual;
+            }
+        }
+        return weights;
+    }
+
+    //! Function to check whether the weights are converged
+    /*!
+     * Function to check whether the weights are converged, which is the case if the same observations are rejected, and
+     * the change of all weights (relative to the nominal weights) is below the tolerance
+     * \param nominalWeights Nominal weights of the observations
+     * \param previousWeights Weights of the previous reweighting iteration
+     * \param currentWeights Weights of the current reweighting iteration
+     * \return True if the weights are converged
+     */
+    bool areWeightsConverged( const Eigen::VectorXd& nominalWeights,
+                              const Eigen::VectorXd& previousWeights,
+                              const Eigen::VectorXd& currentWeights ) const
+    {
+        for( int i = 0; i < nominalWeights.rows( ); i++ )
+        {
+            if( ( previousWeights( i ) == 0.0 ) != ( currentWeights( i ) == 0.0 ) )
+            {
+                return false;
+            }
+            else if( nominalWeights( i ) > 0.0 &&
+                     std::fabs( currentWeights( i ) - previousWeights( i ) ) > weightChangeTolerance_ * nominalWeights( i ) )
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //! Function to return the normalized residual above which an observation is rejected
+    double getOutlierRejectionThreshold( ) const
+    {
+        return outlierRejectionThreshold_;
+    }
+
+    //! Function to return the normalized residual above which the weight of an observation is reduced
+    double getHuberThreshold( ) const
+    {
+        return huberThreshold_;
+    }
+
+    //! Function to return the maximum number of times the weights are updated within an iteration
+    int getMaximumNumberOfReweightingIterations( ) const
+    {
+        return maximumNumberOfReweightingIterations_;
+    }
+
+protected:
+
+    //! Normalized residual above which an observation is rejected (NaN if no rejection)
+    double outlierRejectionThreshold_;
+
+    //! Normalized residual above which the weight of an observation is reduced (NaN if no reduction)
+    double huberThreshold_;
+
+    //! Maximum number of times the weights are updated within an iteration
+    int maximumNumberOfReweightingIterations_;
+
+    //! Tolerance on the change of the weights (relative to the nominal weights) below which the weights are converged
+    double weightChangeTolerance_;
+};
+
 //! Data structure used to provide input to orbit determination procedure
 template< typename ObservationScalarType = double, typename TimeType = double >
 class EstimationInput: public CovarianceAnalysisInput< ObservationScalarType, TimeType >
@@ -643,7 +825,11 @@ public:
         convergenceChecker_( convergenceChecker ),
         considerParametersDeviations_( considerParametersDeviations ),
         conditionNumberWarningEachIteration_( conditionNumberWarningEachIteration ),
-        applyFinalParameterCorrection_( applyFinalParameterCorrection )
+        applyFinalParameterCorrection_( applyFinalParameterCorrection ),
+        linearSolverType_( linear_algebra::jacobi_svd_solver ),
+        reduceArcLocalParameters_( false ),
+        pipelinedArcProcessing_( false ),
+        partialsRefreshTolerance_( TUDAT_NAN )
 
     {
         if ( this->areConsiderParametersIncluded( ) )
@@ -722,6 +908,142 @@ public:
         convergenceChecker_ = convergenceChecker;
     }
 
+    //! Function to set the type of linear solver used to compute the parameter correction in each iteration
+    /*!
+     * Function to set the type of linear solver used to compute the parameter correction in each iteration (JacobiSVD by
+     * default). For large numbers of parameters, the LDLT or Cholesky (LLT) solvers on the normal matrix are much faster
+     * than an SVD. For the column-pivoting QR solver, the weighted design matrix is decomposed directly (except when
+     * accumulating the normal equations, or when using constraints).
+     * \param linearSolverType Type of linear solver that is to be used
+     */
+    void setLinearSolverType( const linear_algebra::LinearSolverType linearSolverType )
+    {
+        linearSolverType_ = linearSolverType;
+    }
+
+    //! Function to return the type of linear solver used to compute the parameter correction in each iteration
+    linear_algebra::LinearSolverType getLinearSolverType( ) const
+    {
+        return linearSolverType_;
+    }
+
+    //! Function to set whether the arc-local parameters are to be eliminated from the normal equations in each iteration
+    /*!
+     * Function to set whether the arc-local parameters of a multi-arc estimation (arc initial states, and arc-wise
+     * parameters such as per-arc biases and empirical accelerations, see getArcLocalParameterIndices) are to be eliminated
+     * from the normal equations in each iteration. The normal equations are then accumulated in block-structured form
+     * (see ArcWiseNormalEquationsAccumulator), and the local parameters of each arc are eliminated in parallel (using the
+     * number of threads set for the design matrix computation of the OrbitDeterminationManager), so that only the
+     * reduced normal equations of the global parameters are solved with the selected linear solver. Setting this to true
+     * also enables the accumulation of the normal equations (see setNormalEquationsAccumulation). Consider parameters and
+     * constraints are not supported in this mode.
+     * \param reduceArcLocalParameters Boolean denoting whether the arc-local parameters are to be eliminated
+     */
+    void setArcLocalParameterReduction( const bool reduceArcLocalParameters )
+    {
+        reduceArcLocalParameters_ = reduceArcLocalParameters;
+        if( reduceArcLocalParameters )
+        {
+            this->accumulateNormalEquations_ = true;
+        }
+    }
+
+    //! Function to return the boolean denoting whether the arc-local parameters are to be eliminated in each iteration
+    bool getReduceArcLocalParameters( ) const
+    {
+        return reduceArcLocalParameters_;
+    }
+
+    //! Function to set whether the observations of each arc are to be processed directly after the propagation of the arc
+    /*!
+     * Function to set whether the observations of each arc of a multi-arc estimation are to be processed directly after
+     * the propagation of the variational equations of the arc, so that the state transition and sensitivity matrix
+     * histories of only a single arc (per concurrently propagated arc group) are stored at any time. In each iteration, the
+     * dynamics of all arcs are then propagated first (to update the environment), after which the variational equations
+     * are propagated arc by arc, with the partials and normal equations of the observations in an arc computed as soon as
+     * the arc is completed (overlapping with the propagation of other arcs, if the arcs are propagated concurrently). Each
+     * observation set must lie within a single arc. Setting this to true also enables the accumulation of the normal
+     * equations (see setNormalEquationsAccumulation); saving the state history for each iteration is not supported in
+     * this mode.
+     * \param pipelinedArcProcessing Boolean denoting whether the observations of each arc are processed directly after
+     * the propagation of the arc
+     */
+    void setPipelinedArcProcessing( const bool pipelinedArcProcessing )
+    {
+        pipelinedArcProcessing_ = pipelinedArcProcessing;
+        if( pipelinedArcProcessing )
+        {
+            this->accumulateNormalEquations_ = true;
+        }
+    }
+
+    //! Function to return the boolean denoting whether the observations of each arc are processed directly after its propagation
+    bool getPipelinedArcProcessing( ) const
+    {
+        return pipelinedArcProcessing_;
+    }
+
+    //! Function to set the parameters for which the observation partials are reused between iterations
+    /*!
+     * Function to set the parameters for which the observation partials are reused between iterations. For parameters
+     * that enter the observation models only (e.g. observation biases or station positions), the partials change little
+     * between iterations. The partials w.r.t. these parameters are then only computed in the first iteration, and reused
+     * in later iterations. If a refresh tolerance is provided, the partials are recomputed for the next iteration whenever
+     * the (normalized) change of any of these parameters w.r.t. the value at which the partials were computed exceeds the
+     * tolerance. The normalized change of a parameter is the change multiplied by the normalization term of its column in
+     * the design matrix, i.e. the maximum change of the observations due to the parameter change in the linear
+     * approximation. Only available when the full design matrix is computed (not when accumulating the normal equations).
+     * \param reusedPartialsParameterIndices List of start index and size of the parameters in the estimated parameter
+     * vector (as returned by EstimatableParameterSet::getIndicesForParameterType), for which partials are to be reused.
+     * \param partialsRefreshTolerance Tolerance on normalized parameter change above which the partials are recomputed
+     * (NaN by default, in which case the partials are never recomputed)
+     */
+    void setPartialsReuse( const std::vector< std::pair< int, int > >& reusedPartialsParameterIndices,
+                           const double partialsRefreshTolerance = TUDAT_NAN )
+    {
+        reusedPartialsParameterIndices_.clear( );
+        for( unsigned int i = 0; i < reusedPartialsParameterIndices.size( ); i++ )
+        {
+            for( int j = 0; j < reusedPartialsParameterIndices.at( i ).second; j++ )
+            {
+                reusedPartialsParameterIndices_.push_back( reusedPartialsParameterIndices.at( i ).first + j );
+            }
+        }
+        partialsRefreshTolerance_ = partialsRefreshTolerance;
+    }
+
+    //! Function to return the entries of the estimated parameter vector for which the partials are reused between iterations
+    std::vector< int > getReusedPartialsParameterIndices( ) const
+    {
+        return reusedPartialsParameterIndices_;
+    }
+
+    //! Function to return the tolerance on normalized parameter change above which the reused partials are recomputed
+    double getPartialsRefreshTolerance( ) const
+    {
+        return partialsRefreshTolerance_;
+    }
+
+    //! Function to set the reweighting of the observations (and rejection of outliers) within each iteration
+    /*!
+     * Function to set the reweighting of the observations (and rejection of outliers) within each iteration (see
+     * ObservationReweightingSettings). The weights in the estimation output are the weights of the final reweighting
+     * iteration (zero for rejected observations), and the rms residual used for the convergence check is computed from
+     * the observations that are not rejected. Only available when the full design matrix is computed (not when
+     * accumulating the normal equations).
+     * \param observationReweightingSettings Settings for the reweighting (nullptr if no reweighting is to be performed)
+     */
+    void setObservationReweighting( const std::shared_ptr< ObservationReweightingSettings > observationReweightingSettings )
+    {
+        observationReweightingSettings_ = observationReweightingSettings;
+    }
+
+    //! Function to return the settings for the reweighting of the observations within each iteration
+    std::shared_ptr< ObservationReweightingSettings > getObservationReweightingSettings( ) const
+    {
+        return observationReweightingSettings_;
+    }
+
 
 
 
@@ -750,6 +1072,24 @@ public:
 
     bool applyFinalParameterCorrection_;
 
+    //! Type of linear solver used to compute the parameter correction in each iteration
+    linear_algebra::LinearSolverType linearSolverType_;
+
+    //! Boolean denoting whether the arc-local parameters are to be eliminated from the normal equations in each iteration
+    bool reduceArcLocalParameters_;
+
+    //! Boolean denoting whether the observations of each arc are processed directly after the propagation of the arc
+    bool pipelinedArcProcessing_;
+
+    //! Entries of the estimated parameter vector for which the partials are reused between iterations
+    std::vector< int > reusedPartialsParameterIndices_;
+
+    //! Tolerance on normalized parameter change above which the reused partials are recomputed (NaN if never)
+    double partialsRefreshTolerance_;
+
+    //! Settings for the reweighting of the observations within each iteration (nullptr if none)
+    std::shared_ptr< ObservationReweightingSettings > observationReweightingSettings_;
+
 
 };
 
@@ -800,7 +1140,7 @@ struct CovarianceAnalysisOutput
         exceptionDuringPropagation_( exceptionDuringPropagation )
     {
         considerParametersIncluded_ = false;
-        if ( designMatrixConsiderParameters.size( ) > 0 && considerNormalizationFactors.size( ) > 0 && considerCovarianceContribution.size( ) > 0 )
+        if ( considerNormalizationFactors.size( ) > 0 && considerCovarianceContribution.size( ) > 0 )
         {
             considerParametersIncluded_ = true;
         }
@@ -933,6 +1273,35 @@ struct CovarianceAnalysisOutput
         return weightedUnnormalizedDesignMatrix;
     }
 
+    //! Function to retrieve the (heap) memory held by the estimation, per subsystem
+    /*!
+     *  Function to retrieve the (heap) memory held by the estimation, per subsystem, evaluated at the end of the estimation:
+     *  the environment, observations, propagation results, state transition interface (see
+     *  OrbitDeterminationManager::getMemoryFootprint) and the matrices in this output object (prefix "estimation_output").
+     *  \return Memory held by the estimation
+     */
+    utilities::MemoryFootprint getMemoryFootprint( ) const
+    {
+        return memoryFootprint_;
+    }
+
+    //! Function to retrieve the (heap) memory held by the design and covariance matrices in this output object
+    utilities::MemoryFootprint getOutputMemoryFootprint( ) const
+    {
+        utilities::MemoryFootprint memoryFootprint;
+        memoryFootprint.addEntry( "design_matrix", utilities::getHeapMemorySize( normalizedDesignMatrix_ ) +
+                                  utilities::getHeapMemorySize( normalizedDesignMatrixConsiderParameters_ ) );
+        memoryFootprint.addEntry( "covariance_matrices",
+                                  utilities::getHeapMemorySize( inverseNormalizedCovarianceMatrix_ ) +
+                                  utilities::getHeapMemorySize( inverseUnnormalizedCovarianceMatrix_ ) +
+                                  utilities::getHeapMemorySize( normalizedCovarianceMatrix_ ) +
+                                  utilities::getHeapMemorySize( unnormalizedCovarianceMatrix_ ) +
+                                  utilities::getHeapMemorySize( considerCovarianceContribution_ ) +
+                                  utilities::getHeapMemorySize( normalizedCovarianceWithConsiderParameters_ ) +
+                                  utilities::getHeapMemorySize( unnormalizedCovarianceWithConsiderParameters_ ) );
+        return memoryFootprint;
+    }
+
 
     //! Function to retrieve the unnormalized formal error vector of the estimation result.
     /*!
@@ -1009,6 +1378,354 @@ struct CovarianceAnalysisOutput
 
     //! Boolean denoting whether consider parameters are included
     bool considerParametersIncluded_;
+
+    //! Memory held by the estimation, per subsystem (see getMemoryFootprint)
+    utilities::MemoryFootprint memoryFootprint_;
+};
+
+//! Class to repeat a covariance analysis with different weights, observation sets and a priori/consider covariances
+/*!
+ *  Class to repeat a covariance analysis with different observation weights, subsets of the observation sets, and a priori
+ *  and consider covariances, without recomputing the propagation, state transition matrices and observation partials. The
+ *  (normalized) partials of each observation set are stored once, as is the unweighted normal matrix H_s^T H_s (and
+ *  H_s^T H_{c,s} for the consider parameters) of each set. Each subsequent covariance analysis then only requires the
+ *  accumulation of the normal matrices of the selected sets, and the inversion of the resulting matrix. When the weights
+ *  are constant per observation set (see computeCovarianceWithConstantSetWeights), the accumulation does not depend on the
+ *  number of observations. An object of this class is typically created by
+ *  OrbitDeterminationManager::createCovarianceSensitivityAnalysis.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double  >
+class CovarianceSensitivityAnalysis
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param observationCollection Observations for which the partials were computed
+     *  \param normalizedDesignMatrix Normalized partials of all observations w.r.t. the estimated parameters
+     *  \param normalizationTerms Values by which the columns of the unnormalized design matrix were divided
+     *  \param normalizedConsiderDesignMatrix Normalized partials of all observations w.r.t. the consider parameters (empty if
+     *  none)
+     *  \param considerNormalizationTerms Values by which the columns of the unnormalized consider design matrix were divided
+     *  \param constraintMultiplier Multiplier for estimated parameter that defines linear constraint
+     *  \param constraintRightHandSide Right-hand side estimation linear constraint
+     */
+    CovarianceSensitivityAnalysis(
+            const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > >& observationCollection,
+            const Eigen::MatrixXd& normalizedDesignMatrix,
+            const Eigen::VectorXd& normalizationTerms,
+            const Eigen::MatrixXd& normalizedConsiderDesignMatrix = Eigen::MatrixXd::Zero( 0, 0 ),
+            const Eigen::VectorXd& considerNormalizationTerms = Eigen::VectorXd::Zero( 0 ),
+            const Eigen::MatrixXd& constraintMultiplier = Eigen::MatrixXd::Zero( 0, 0 ),
+            const Eigen::VectorXd& constraintRightHandSide = Eigen::VectorXd::Zero( 0 ) ):
+        normalizationTerms_( normalizationTerms ),
+        considerNormalizationTerms_( considerNormalizationTerms ),
+        constraintMultiplier_( constraintMultiplier ),
+        constraintRightHandSide_( constraintRightHandSide ),
+        totalObservableSize_( observationCollection->getTotalObservableSize( ) )
+    {
+        if( normalizedDesignMatrix.rows( ) != totalObservableSize_ )
+        {
+            throw std::runtime_error( "Error when creating covariance sensitivity analysis, design matrix has " +
+                                      std::to_string( normalizedDesignMatrix.rows( ) ) + " rows, but " +
+                                      std::to_string( totalObservableSize_ ) + " observations are provided" );
+        }
+
+        bool considerParametersIncluded = ( considerNormalizationTerms_.rows( ) > 0 );
+        int numberOfParameters = normalizedDesignMatrix.cols( );
+        int numberOfConsiderParameters = considerNormalizationTerms_.rows( );
+
+        // Split partials per observation set, and compute unweighted normal matrix of each set
+        for( auto observableIterator : observationCollection->getObservationSetStartAndSize( ) )
+        {
+            for( auto linkEndIterator : observableIterator.second )
+            {
+                for( unsigned int i = 0; i < linkEndIterator.second.size( ); i++ )
+                {
+                    int startIndex = linkEndIterator.second.at( i ).first;
+                    int numberOfRows = linkEndIterator.second.at( i ).second;
+
+                    observationSets_.push_back( std::make_tuple( observableIterator.first, linkEndIterator.first, i ) );
+                    observationSetStartAndSize_.push_back( std::make_pair( startIndex, numberOfRows ) );
+
+                    partialsPerSet_.push_back( normalizedDesignMatrix.block( startIndex, 0, numberOfRows, numberOfParameters ) );
+                    normalMatrixPerSet_.push_back( partialsPerSet_.back( ).transpose( ) * partialsPerSet_.back( ) );
+                    if( considerParametersIncluded )
+                    {
+                        considerPartialsPerSet_.push_back( normalizedConsiderDesignMatrix.block(
+                                                               startIndex, 0, numberOfRows, numberOfConsiderParameters ) );
+                        considerNormalMatrixPerSet_.push_back(
+                                    partialsPerSet_.back( ).transpose( ) * considerPartialsPerSet_.back( ) );
+                    }
+                }
+            }
+        }
+    }
+
+    //! Function to compute the covariance, using weights per observation
+    /*!
+     *  Function to compute the covariance, using weights per observation. The normal matrix of each selected set is
+     *  computed from the stored partials of the set and the weights.
+     *  \param weightsMatrixDiagonals Diagonal of the observation weights matrix (same order as observations)
+     *  \param inverseOfAprioriCovariance Inverse of a priori covariance matrix (unnormalized; empty if none)
+     *  \param considerCovariance Covariance matrix of the consider parameters (unnormalized; empty if not to be included)
+     *  \param observationSetIndices Indices (see getObservationSets) of the observation sets to use (all sets if empty)
+     *  \return Output of the covariance analysis (without design matrix)
+     */
+    std::shared_ptr< CovarianceAnalysisOutput< ObservationScalarType, TimeType > > computeCovariance(
+            const Eigen::VectorXd& weightsMatrixDiagonals,
+            const Eigen::MatrixXd& inverseOfAprioriCovariance = Eigen::MatrixXd::Zero( 0, 0 ),
+            const Eigen::MatrixXd& considerCovariance = Eigen::MatrixXd::Zero( 0, 0 ),
+            const std::vector< int >& observationSetIndices = std::vector< int >( ) )
+    {
+        if( weightsMatrixDiagonals.rows( ) != totalObservableSize_ )
+        {
+            throw std::runtime_error( "Error in covariance sensitivity analysis, weights vector has size " +
+                                      std::to_string( weightsMatrixDiagonals.rows( ) ) + ", but " +
+                                      std::to_string( totalObservableSize_ ) + " observations are provided" );
+        }
+
+        bool includeConsiderParameters = checkConsiderCovariance( considerCovariance );
+        Eigen::MatrixXd normalMatrix = Eigen::MatrixXd::Zero( normalizationTerms_.rows( ), normalizationTerms_.rows( ) );
+        Eigen::MatrixXd considerNormalMatrix = Eigen::MatrixXd::Zero(
+                    normalizationTerms_.rows( ), includeConsiderParameters ? considerNormalizationTerms_.rows( ) : 0 );
+
+        std::vector< int > setIndices = getSetIndicesToUse( observationSetIndices );
+        for( unsigned int i = 0; i < setIndices.size( ); i++ )
+        {
+            int setIndex = setIndices.at( i );
+            Eigen::MatrixXd weightedPartialsTranspose =
+                    partialsPerSet_.at( setIndex ).transpose( ) *
+                    weightsMatrixDiagonals.segment( observationSetStartAndSize_.at( setIndex ).first,
+                                                    observationSetStartAndSize_.at( setIndex ).second ).asDiagonal( );
+            normalMatrix += weightedPartialsTranspose * partialsPerSet_.at( setIndex );
+            if( includeConsiderParameters )
+            {
+                considerNormalMatrix += weightedPartialsTranspose * considerPartialsPerSet_.at( setIndex );
+            }
+        }
+
+        return computeCovarianceFromNormalMatrices(
+                    normalMatrix, considerNormalMatrix, weightsMatrixDiagonals, inverseOfAprioriCovariance, considerCovariance,
+                    includeConsiderParameters );
+    }
+
+    //! Function to compute the covariance, using a single weight for all observations of each set
+    /*!
+     *  Function to compute the covariance, using a single weight for all observations of each set. The normal matrix is
+     *  accumulated from the stored unweighted normal matrices of the selected sets, so that the cost does not depend on the
+     *  number of observations.
+     *  \param weightPerSet Weight of the observations of each set (same order as getObservationSets)
+     *  \param inverseOfAprioriCovariance Inverse of a priori covariance matrix (unnormalized; empty if none)
+     *  \param considerCovariance Covariance matrix of the consider parameters (unnormalized; empty if not to be included)
+     *  \param observationSetIndices Indices (see getObservationSets) of the observation sets to use (all sets if empty)
+     *  \return Output of the covariance analysis (without design matrix)
+     */
+    std::shared_ptr< CovarianceAnalysisOutput< ObservationScalarType, TimeType > > computeCovarianceWithConstantSetWeights(
+            const std::vector< double >& weightPerSet,
+            const Eigen::MatrixXd& inverseOfAprioriCovariance = Eigen::MatrixXd::Zero( 0, 0 ),
+            const Eigen::MatrixXd& considerCovariance = Eigen::MatrixXd::Zero( 0, 0 ),
+            const std::vector< int >& observationSetIndices = std::vector< int >( ) )
+    {
+        if( weightPerSet.size( ) != observationSets_.size( ) )
+        {
+            throw std::runtime_error( "Error in covariance sensitivity analysis, " + std::to_string( weightPerSet.size( ) ) +
+                                      " weights provided for " + std::to_string( observationSets_.size( ) ) + " observation sets" );
+        }
+
+        bool includeConsiderParameters = checkConsiderCovariance( considerCovariance );
+        Eigen::MatrixXd normalMatrix = Eigen::MatrixXd::Zero( normalizationTerms_.rows( ), normalizationTerms_.rows( ) );
+        Eigen::MatrixXd considerNormalMatrix = Eigen::MatrixXd::Zero(
+                    normalizationTerms_.rows( ), includeConsiderParameters ? considerNormalizationTerms_.rows( ) : 0 );
+        Eigen::VectorXd weightsMatrixDiagonals = Eigen::VectorXd::Zero( totalObservableSize_ );
+
+        std::vector< int > setIndices = getSetIndicesToUse( observationSetIndices );
+        for( unsigned int i = 0; i < setIndices.size( ); i++ )
+        {
+            int setIndex = setIndices.at( i );
+            normalMatrix += weightPerSet.at( setIndex ) * normalMatrixPerSet_.at( setIndex );
+            if( includeConsiderParameters )
+            {
+                considerNormalMatrix += weightPerSet.at( setIndex ) * considerNormalMatrixPerSet_.at( setIndex );
+            }
+            weightsMatrixDiagonals.segment( observationSetStartAndSize_.at( setIndex ).first,
+                                            observationSetStartAndSize_.at( setIndex ).second ).setConstant(
+                        weightPerSet.at( setIndex ) );
+        }
+
+        return computeCovarianceFromNormalMatrices(
+                    normalMatrix, considerNormalMatrix, weightsMatrixDiagonals, inverseOfAprioriCovariance, considerCovariance,
+                    includeConsiderParameters );
+    }
+
+    //! Function to retrieve the indices of all observation sets of a given observable type and link ends
+    /*!
+     *  Function to retrieve the indices (see getObservationSets) of all observation sets of a given observable type and link
+     *  ends, for use in the selection of observation sets
+     *  \param observableType Type of observable
+     *  \param linkEnds Link ends of observable
+     *  \return Indices of observation sets
+     */
+    std::vector< int > getObservationSetIndices( const observation_models::ObservableType observableType,
+                                                 const observation_models::LinkEnds& linkEnds )
+    {
+        std::vector< int > setIndices;
+        for( unsigned int i = 0; i < observationSets_.size( ); i++ )
+        {
+            if( std::get< 0 >( observationSets_.at( i ) ) == observableType && std::get< 1 >( observationSets_.at( i ) ) == linkEnds )
+            {
+                setIndices.push_back( i );
+            }
+        }
+        return setIndices;
+    }
+
+    //! Function to retrieve the observation sets (observable type, link ends and index of set), in order of the set indices
+    const std::vector< std::tuple< observation_models::ObservableType, observation_models::LinkEnds, int > >& getObservationSets( )
+    {
+        return observationSets_;
+    }
+
+    //! Function to retrieve the values by which the columns of the unnormalized design matrix were divided
+    Eigen::VectorXd getNormalizationTerms( )
+    {
+        return normalizationTerms_;
+    }
+
+    //! Function to retrieve the (heap) memory held by the stored partials and normal matrices
+    utilities::MemoryFootprint getMemoryFootprint( ) const
+    {
+        utilities::MemoryFootprint memoryFootprint;
+        memoryFootprint.addEntry( "partials_per_set", utilities::getHeapMemorySize( partialsPerSet_ ) +
+                                  utilities::getHeapMemorySize( considerPartialsPerSet_ ) );
+        memoryFootprint.addEntry( "normal_matrix_per_set", utilities::getHeapMemorySize( normalMatrixPerSet_ ) +
+                                  utilities::getHeapMemorySize( considerNormalMatrixPerSet_ ) );
+        return memoryFootprint;
+    }
+
+private:
+
+    //! Function to check the consider covariance, and determine whether the consider parameters are to be included
+    bool checkConsiderCovariance( const Eigen::MatrixXd& considerCovariance )
+    {
+        if( considerCovariance.size( ) == 0 )
+        {
+            return false;
+        }
+        else if( considerCovariance.rows( ) != considerNormalizationTerms_.rows( ) ||
+                 considerCovariance.cols( ) != considerNormalizationTerms_.rows( ) )
+        {
+            throw std::runtime_error( "Error in covariance sensitivity analysis, consider covariance has size " +
+                                      std::to_string( considerCovariance.rows( ) ) + ", but " +
+                                      std::to_string( considerNormalizationTerms_.rows( ) ) + " consider parameters are used" );
+        }
+        return true;
+    }
+
+    //! Function to retrieve the indices of the observation sets that are to be used (all sets if input is empty)
+    std::vector< int > getSetIndicesToUse( const std::vector< int >& observationSetIndices )
+    {
+        if( observationSetIndices.size( ) == 0 )
+        {
+            std::vector< int > setIndices( observationSets_.size( ) );
+            for( unsigned int i = 0; i < observationSets_.size( ); i++ )
+            {
+                setIndices[ i ] = i;
+            }
+            return setIndices;
+        }
+
+        for( unsigned int i = 0; i < observationSetIndices.size( ); i++ )
+        {
+            if( observationSetIndices.at( i ) < 0 ||
+                    observationSetIndices.at( i ) >= static_cast< int >( observationSets_.size( ) ) )
+            {
+                throw std::runtime_error( "Error in covariance sensitivity analysis, observation set index " +
+                                          std::to_string( observationSetIndices.at( i ) ) + " is not valid" );
+            }
+        }
+        return observationSetIndices;
+    }
+
+    //! Function to compute the covariance from the accumulated (normalized) normal matrices
+    std::shared_ptr< CovarianceAnalysisOutput< ObservationScalarType, TimeType > > computeCovarianceFromNormalMatrices(
+            const Eigen::MatrixXd& normalMatrix,
+            const Eigen::MatrixXd& considerNormalMatrix,
+            const Eigen::VectorXd& weightsMatrixDiagonals,
+            const Eigen::MatrixXd& inverseOfAprioriCovariance,
+            const Eigen::MatrixXd& considerCovariance,
+            const bool includeConsiderParameters )
+    {
+        // Normalize inverse a priori covariance
+        int numberOfParameters = normalizationTerms_.rows( );
+        Eigen::MatrixXd normalizedInverseAprioriCovariance = Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters );
+        if( inverseOfAprioriCovariance.size( ) > 0 )
+        {
+            if( inverseOfAprioriCovariance.rows( ) != numberOfParameters || inverseOfAprioriCovariance.cols( ) != numberOfParameters )
+            {
+                throw std::runtime_error( "Error in covariance sensitivity analysis, inverse a priori covariance has size " +
+                                          std::to_string( inverseOfAprioriCovariance.rows( ) ) + ", but " +
+                                          std::to_string( numberOfParameters ) + " parameters are estimated" );
+            }
+            Eigen::MatrixXd inverseAprioriCovariance = inverseOfAprioriCovariance;
+            Eigen::VectorXd normalizationTerms = normalizationTerms_;
+            normalizedInverseAprioriCovariance = normaliseUnnormaliseInverseCovarianceMatrix(
+                        inverseAprioriCovariance, normalizationTerms, true );
+        }
+
+        Eigen::MatrixXd inverseNormalizedCovariance = linear_algebra::calculateInverseOfUpdatedCovarianceMatrixFromNormalMatrix(
+                    normalMatrix, normalizedInverseAprioriCovariance, constraintMultiplier_, constraintRightHandSide_ );
+
+        // Compute contribution consider parameters
+        Eigen::MatrixXd covarianceContributionConsiderParameters = Eigen::MatrixXd::Zero( 0, 0 );
+        Eigen::VectorXd considerNormalizationTerms = Eigen::VectorXd::Zero( 0 );
+        if( includeConsiderParameters )
+        {
+            considerNormalizationTerms = considerNormalizationTerms_;
+            covarianceContributionConsiderParameters =
+                    linear_algebra::calculateConsiderParametersCovarianceContributionFromNormalMatrix(
+                        inverseNormalizedCovariance.inverse( ), considerNormalMatrix,
+                        normaliseUnnormaliseCovarianceMatrix( considerCovariance, considerNormalizationTerms_, true ) );
+        }
+
+        return std::make_shared< CovarianceAnalysisOutput< ObservationScalarType, TimeType > >(
+                    Eigen::MatrixXd::Zero( 0, 0 ), weightsMatrixDiagonals, normalizationTerms_, inverseNormalizedCovariance,
+                    Eigen::MatrixXd::Zero( 0, 0 ), considerNormalizationTerms, covarianceContributionConsiderParameters );
+    }
+
+    //! Observation sets (observable type, link ends and index of set)
+    std::vector< std::tuple< observation_models::ObservableType, observation_models::LinkEnds, int > > observationSets_;
+
+    //! Start index and size of each observation set in the full observation vector
+    std::vector< std::pair< int, int > > observationSetStartAndSize_;
+
+    //! Normalized partials of each observation set w.r.t. the estimated parameters
+    std::vector< Eigen::MatrixXd > partialsPerSet_;
+
+    //! Normalized partials of each observation set w.r.t. the consider parameters
+    std::vector< Eigen::MatrixXd > considerPartialsPerSet_;
+
+    //! Unweighted normalized normal matrix of each observation set
+    std::vector< Eigen::MatrixXd > normalMatrixPerSet_;
+
+    //! Unweighted normalized normal matrix between estimated and consider parameters of each observation set
+    std::vector< Eigen::MatrixXd > considerNormalMatrixPerSet_;
+
+    //! Values by which the columns of the unnormalized design matrix were divided
+    Eigen::VectorXd normalizationTerms_;
+
+    //! Values by which the columns of the unnormalized consider design matrix were divided
+    Eigen::VectorXd considerNormalizationTerms_;
+
+    //! Multiplier for estimated parameter that defines linear constraint
+    Eigen::MatrixXd constraintMultiplier_;
+
+    //! Right-hand side estimation linear constraint
+    Eigen::VectorXd constraintRightHandSide_;
+
+    //! Total size of the observation vector
+    int totalObservableSize_;
 };
 
 //! Data structure through which the output of the orbit determination is communicated
@@ -1160,6 +1877,27 @@ struct EstimationOutput: public CovarianceAnalysisOutput< ObservationScalarType,
         return simulationResultsPerIteration_;
     }
 
+    //! Function to retrieve the (heap) memory held by the matrices and iteration histories in this output object
+    utilities::MemoryFootprint getOutputMemoryFootprint( ) const
+    {
+        utilities::MemoryFootprint memoryFootprint =
+                CovarianceAnalysisOutput< ObservationScalarType, TimeType >::getOutputMemoryFootprint( );
+        memoryFootprint.addEntry( "iteration_history", utilities::getHeapMemorySize( residualHistory_ ) +
+                                  utilities::getHeapMemorySize( parameterHistory_ ) );
+        std::size_t savedResultsSize = 0;
+        std::set< const void* > countedResults;
+        for( unsigned int i = 0; i < simulationResultsPerIteration_.size( ); i++ )
+        {
+            if( simulationResultsPerIteration_.at( i ) != nullptr &&
+                    countedResults.insert( simulationResultsPerIteration_.at( i ).get( ) ).second )
+            {
+                savedResultsSize += simulationResultsPerIteration_.at( i )->getMemoryFootprint( ).getTotalSize( );
+            }
+        }
+        memoryFootprint.addEntry( "saved_propagation_results", savedResultsSize );
+        return memoryFootprint;
+    }
+
 
     //! Vector of estimated parameter values.
     Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > parameterEstimate_;
@@ -11,6 +11,7 @@
 #ifndef TUDAT_STATEDERIVATIVEPARTIAL_H
 #define TUDAT_STATEDERIVATIVEPARTIAL_H
 
+#include <algorithm>
 #include <string>
 #include <map>
 #include <Eigen/Core>
@@ -32,6 +33,27 @@ namespace tudat
 namespace orbit_determination
 {
 
+//! Structure of a (square) block of partial derivatives
+/*!
+ *  Structure of a (square) block of partial derivatives, as declared by a partial object, so that blocks that are
+ *  always zero can be skipped when setting up the variational equations. The entries are ordered from most to least
+ *  restrictive, so that the structure of a sum of blocks is the maximum of the structures of its terms.
+ */
+enum PartialMatrixStructure
+{
+    zero_partial_matrix = 0,
+    diagonal_partial_matrix = 1,
+    symmetric_partial_matrix = 2,
+    dense_partial_matrix = 3
+};
+
+//! Function to retrieve the structure of the sum of two partial matrix blocks with given structures
+inline PartialMatrixStructure combinePartialMatrixStructures(
+        const PartialMatrixStructure firstStructure, const PartialMatrixStructure secondStructure )
+{
+    return std::max( firstStructure, secondStructure );
+}
+
 //! Base class for computing the partial derivatives of a state derivative model
 /*!
  * Base class for computing the partial derivatives of a state derivative model (i.e. acceleration model for
@@ -75,6 +97,23 @@ public:
             const std::pair< std::string, std::string >& stateReferencePoint,
             const propagators::IntegratedStateType integratedStateType ) = 0;
 
+    //! Function to retrieve the number of leading columns of the partial w.r.t. a propagated state that can be non-zero
+    /*!
+     * Function to retrieve the number of leading columns of the partial w.r.t. a propagated state that can be non-zero.
+     * The remaining columns of the block set by the function from getDerivativeFunctionWrtStateOfIntegratedBody are
+     * always zero, so that the variational equations need not multiply them with the state transition matrix.
+     * By default, all columns can be non-zero; derived classes may override this function.
+     * \param stateReferencePoint Reference point (id) for propagated state (i.e. body name for translational dynamics).
+     * \param integratedStateType Type of propagated state.
+     * \return Number of leading columns of partial that can be non-zero (0 if no dependency exists)
+     */
+    virtual int getNumberOfNonZeroStatePartialColumns(
+            const std::pair< std::string, std::string >& stateReferencePoint,
+            const propagators::IntegratedStateType integratedStateType )
+    {
+        return getDerivativeFunctionWrtStateOfIntegratedBody( stateReferencePoint, integratedStateType ).second;
+    }
+
     //! Pure virtual function to check whether a partial w.r.t. some integrated state is non-zero.
     /*!
      * Pure virtual function to check whether a partial w.r.t. some integrated state is non-zero.
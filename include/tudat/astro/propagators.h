@@ -33,6 +33,8 @@
 #include "propagators/rotationalMotionStateDerivative.h"
 #include "propagators/singleStateTypeDerivative.h"
 #include "propagators/stateDerivativeCircularRestrictedThreeBodyProblem.h"
+#include "propagators/circularRestrictedThreeBodyPropagator.h"
+#include "propagators/circularRestrictedThreeBodyPeriodicOrbits.h"
 #include "propagators/stateTransitionMatrixInterface.h"
 #include "propagators/variationalEquations.h"
 
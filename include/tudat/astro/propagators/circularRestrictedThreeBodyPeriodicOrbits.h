@@ -0,0 +1,153 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *        Koon, W.S., Lo, M.W., Marsden, J.E., Ross, S.D., "Dynamical Systems, the Three-Body Problem and Space
+ *          Mission Design", 2011.
+ *        Howell, K.C., "Three-dimensional, periodic, 'halo' orbits", Celestial Mechanics 32, 53-71, 1984.
+ *
+ */
+
+#ifndef TUDAT_CIRCULAR_RESTRICTED_THREE_BODY_PERIODIC_ORBITS_H
+#define TUDAT_CIRCULAR_RESTRICTED_THREE_BODY_PERIODIC_ORBITS_H
+
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/propagators/circularRestrictedThreeBodyPropagator.h"
+
+namespace tudat
+{
+namespace propagators
+{
+
+//! Component of the initial state that is kept fixed during differential correction of a symmetric periodic orbit
+enum Cr3bpFixedInitialStateComponent
+{
+    fix_initial_x_position,
+    fix_initial_z_position
+};
+
+//! Periodic orbit in the CR3BP, as obtained from differential correction
+struct Cr3bpPeriodicOrbit
+{
+    //! Normalized initial state, on the xz-plane
+    Eigen::Vector6d initialState_;
+
+    //! Normalized period
+    double period_;
+
+    //! Monodromy matrix (state transition matrix over one period)
+    Eigen::Matrix6d monodromyMatrix_;
+
+    //! Jacobi energy of the orbit
+    double jacobiEnergy_;
+
+    //! Number of differential correction iterations required for convergence
+    unsigned int numberOfIterations_;
+};
+
+//! Function to compute the x-coordinate of a collinear libration point of the CR3BP
+/*!
+ * Function to compute the x-coordinate of a collinear libration point of the CR3BP, by solving the quintic equation
+ * of the equilibrium condition with Newton iterations.
+ * \param massParameter Mass parameter of the CR3BP
+ * \param librationPointIndex Index of the libration point (1, 2 or 3)
+ * \return Normalized x-coordinate of the libration point
+ */
+double computeCr3bpCollinearLibrationPointPosition( const double massParameter, const int librationPointIndex );
+
+//! Function to correct an initial state to a periodic orbit that is symmetric w.r.t. the xz-plane
+/*!
+ * Function to correct an initial state of the form [ x, 0, z, 0, vy, 0 ] to a periodic orbit that is symmetric
+ * w.r.t. the xz-plane (e.g. planar Lyapunov and halo orbits), with single shooting to the first xz-plane crossing
+ * (Howell, 1984). At the crossing, the x- and z-velocities are targeted to zero, with the crossing time variation
+ * accounted for in the correction. For a planar initial state (z = vz = 0), only vy is corrected (with x fixed). For a
+ * spatial initial state, vy and either x or z are corrected (with the other kept fixed). Each iteration requires a
+ * single propagation of the state and state transition matrix with the CircularRestrictedThreeBodyPropagator.
+ * \param propagator Propagator used for the differential correction
+ * \param initialStateGuess Initial guess of the normalized initial state
+ * \param fixedComponent Component of the initial position that is kept fixed (for spatial orbits)
+ * \param tolerance Tolerance on the x- and z-velocity at the xz-plane crossing
+ * \param maximumNumberOfIterations Maximum number of iterations, after which an exception is thrown
+ * \param maximumHalfPeriod Maximum propagation time when searching for the xz-plane crossing
+ * \return Corrected periodic orbit, with the monodromy matrix computed from a propagation over the full period
+ */
+Cr3bpPeriodicOrbit correctSymmetricCr3bpPeriodicOrbit(
+        const CircularRestrictedThreeBodyPropagator& propagator,
+        const Eigen::Vector6d& initialStateGuess,
+        const Cr3bpFixedInitialStateComponent fixedComponent = fix_initial_z_position,
+        const double tolerance = 1.0E-11,
+        const unsigned int maximumNumberOfIterations = 25,
+        const double maximumHalfPeriod = 10.0 );
+
+//! Function to compute a family of symmetric periodic orbits with natural parameter continuation
+/*!
+ * Function to compute a family of symmetric periodic orbits with natural parameter continuation in the fixed initial
+ * state component (see correctSymmetricCr3bpPeriodicOrbit). The initial guess of each new orbit is linearly
+ * extrapolated from the two previous orbits (or equal to the previous orbit with the fixed component incremented, for
+ * the second orbit). The continuation stops early if the differential correction of an orbit fails, in which case the
+ * orbits computed up to that point are returned.
+ * \param propagator Propagator used for the differential correction
+ * \param initialStateGuess Initial guess of the normalized initial state of the first orbit
+ * \param fixedComponent Component of the initial position that is kept fixed, and is varied along the family
+ * \param continuationStepSize Increment of the fixed component between subsequent orbits
+ * \param numberOfOrbits Number of orbits that is to be computed
+ * \param tolerance Tolerance on the x- and z-velocity at the xz-plane crossing
+ * \param maximumNumberOfIterations Maximum number of differential correction iterations per orbit
+ * \return Periodic orbits of the family (at most numberOfOrbits)
+ */
+std::vector< Cr3bpPeriodicOrbit > continueSymmetricCr3bpPeriodicOrbitFamily(
+        const CircularRestrictedThreeBodyPropagator& propagator,
+        const Eigen::Vector6d& initialStateGuess,
+        const Cr3bpFixedInitialStateComponent fixedComponent,
+        const double continuationStepSize,
+        const unsigned int numberOfOrbits,
+        const double tolerance = 1.0E-11,
+        const unsigned int maximumNumberOfIterations = 25 );
+
+//! Function to compute the stability index of a periodic orbit from the eigenvalues of its monodromy matrix
+/*!
+ * Function to compute the stability index nu = ( lambda_max + 1 / lambda_max ) / 2 of a periodic orbit, with
+ * lambda_max the eigenvalue of the monodromy matrix with the largest magnitude.
+ * \param periodicOrbit Periodic orbit for which the stability index is to be computed
+ * \return Stability index (|nu| > 1 for unstable orbits)
+ */
+double computeCr3bpStabilityIndex( const Cr3bpPeriodicOrbit& periodicOrbit );
+
+//! Function to compute the initial states of the invariant manifold of a periodic orbit
+/*!
+ * Function to compute the initial states of the (un)stable invariant manifold of a periodic orbit, at equally spaced
+ * times along the orbit. The (un)stable eigenvector of the monodromy matrix is mapped along the orbit with the state
+ * transition matrix, and the orbit state is perturbed along it with a displacement of the given size in position
+ * (Koon et al., 2011).
+ * \param propagator Propagator used to map the eigenvector along the orbit
+ * \param periodicOrbit Periodic orbit for which the manifold is to be computed
+ * \param numberOfPoints Number of points along the orbit at which the manifold initial state is computed
+ * \param perturbationSize Size of the position displacement along the eigenvector (normalized units)
+ * \param computeUnstableManifold Boolean denoting whether the unstable (if true) or stable (if false) manifold is
+ * computed
+ * \param positiveBranch Boolean denoting whether the branch with the positive or negative eigenvector is computed
+ * \return Initial states of the manifold (to be propagated forward in time for the unstable manifold, and backward in
+ * time for the stable manifold)
+ */
+std::vector< Eigen::Vector6d > computeCr3bpManifoldInitialStates(
+        const CircularRestrictedThreeBodyPropagator& propagator,
+        const Cr3bpPeriodicOrbit& periodicOrbit,
+        const unsigned int numberOfPoints,
+        const double perturbationSize = 1.0E-6,
+        const bool computeUnstableManifold = true,
+        const bool positiveBranch = true );
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_CIRCULAR_RESTRICTED_THREE_BODY_PERIODIC_ORBITS_H
@@ -0,0 +1,310 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *        Koon, W.S., Lo, M.W., Marsden, J.E., Ross, S.D., "Dynamical Systems, the Three-Body Problem and Space
+ *          Mission Design", 2011.
+ *        Montenbruck, O., Gill, E. Satellite Orbits: Models, Methods, Applications, Springer, 2005.
+ *
+ */
+
+#ifndef TUDAT_CIRCULAR_RESTRICTED_THREE_BODY_PROPAGATOR_H
+#define TUDAT_CIRCULAR_RESTRICTED_THREE_BODY_PROPAGATOR_H
+
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/basics/basicTypedefs.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace propagators
+{
+
+//! Typedef for the CR3BP state (first column) concatenated with its state transition matrix (remaining six columns)
+typedef Eigen::Matrix< double, 6, 7 > Cr3bpStateAndTransitionMatrix;
+
+//! Function to compute the state derivative in the CR3BP (normalized units, synodic frame)
+/*!
+ * Function to compute the state derivative in the CR3BP (normalized units, synodic frame). Equivalent to
+ * StateDerivativeCircularRestrictedThreeBodyProblem::computeStateDerivative, but without any heap allocation or pow
+ * calls.
+ * \param massParameter Mass parameter of the CR3BP
+ * \param state Normalized Cartesian state
+ * \return Normalized state derivative
+ */
+Eigen::Vector6d computeCr3bpStateDerivative( const double massParameter, const Eigen::Vector6d& state );
+
+//! Function to compute the Jacobian of the CR3BP state derivative w.r.t. the state
+/*!
+ * Function to compute the Jacobian of the CR3BP state derivative w.r.t. the state, in closed form, i.e. the matrix
+ * A = [ 0, I; U_rr, 2 Omega ] of the variational equations dPhi/dt = A Phi, with U_rr the Hessian of the
+ * pseudo-potential (Koon et al., 2011).
+ * \param massParameter Mass parameter of the CR3BP
+ * \param state Normalized Cartesian state
+ * \return Jacobian of the state derivative w.r.t. the state
+ */
+Eigen::Matrix6d computeCr3bpStateDerivativeJacobian( const double massParameter, const Eigen::Vector6d& state );
+
+//! Function to compute the derivative of the CR3BP state and state transition matrix
+/*!
+ * Function to compute the derivative of the CR3BP state and state transition matrix, with the variational equations
+ * evaluated in closed form (see computeCr3bpStateDerivativeJacobian).
+ * \param massParameter Mass parameter of the CR3BP
+ * \param stateAndTransitionMatrix State (first column) and state transition matrix (remaining columns)
+ * \return Derivative of state (first column) and state transition matrix (remaining columns)
+ */
+Cr3bpStateAndTransitionMatrix computeCr3bpStateAndTransitionMatrixDerivative(
+        const double massParameter, const Cr3bpStateAndTransitionMatrix& stateAndTransitionMatrix );
+
+//! Continuous extension (dense output) of a CR3BP propagation
+/*!
+ * Continuous extension (dense output) of a CR3BP propagation, storing the state (and state transition matrix, if it was
+ * propagated) and its derivative at the boundaries of each accepted step. Values inside a step are obtained from a cubic
+ * Hermite interpolant, which is of lower order than the propagation itself.
+ */
+class Cr3bpDenseOutput
+{
+public:
+
+    //! Constructor
+    Cr3bpDenseOutput( ):
+        isStateTransitionMatrixPropagated_( false ){ }
+
+    //! Function to remove all nodes
+    void clear( )
+    {
+        times_.clear( );
+        values_.clear( );
+        derivatives_.clear( );
+    }
+
+    //! Function to add a node (must be called with monotonically increasing or decreasing times)
+    void addNode( const double time, const Cr3bpStateAndTransitionMatrix& value,
+                  const Cr3bpStateAndTransitionMatrix& derivative )
+    {
+        times_.push_back( time );
+        values_.push_back( value );
+        derivatives_.push_back( derivative );
+    }
+
+    //! Function to interpolate the state and state transition matrix at a given time
+    /*!
+     * Function to interpolate the state and state transition matrix at a given time, which must lie inside the
+     * propagation interval.
+     * \param time Time at which the state and state transition matrix are to be interpolated
+     * \return Interpolated state (first column) and state transition matrix (remaining columns, zero if not propagated)
+     */
+    Cr3bpStateAndTransitionMatrix interpolate( const double time ) const;
+
+    //! Function to interpolate the state at a given time
+    Eigen::Vector6d interpolateState( const double time ) const
+    {
+        return interpolate( time ).col( 0 );
+    }
+
+    //! Function to interpolate the state transition matrix at a given time
+    Eigen::Matrix6d interpolateStateTransitionMatrix( const double time ) const;
+
+    //! Function to retrieve the times of the nodes (boundaries of the accepted steps)
+    const std::vector< double >& getNodeTimes( ) const
+    {
+        return times_;
+    }
+
+    //! Function to retrieve whether the state transition matrix is available
+    bool isStateTransitionMatrixPropagated( ) const
+    {
+        return isStateTransitionMatrixPropagated_;
+    }
+
+    //! Function to set whether the state transition matrix is available (set by propagator)
+    void setIsStateTransitionMatrixPropagated( const bool isStateTransitionMatrixPropagated )
+    {
+        isStateTransitionMatrixPropagated_ = isStateTransitionMatrixPropagated;
+    }
+
+private:
+
+    //! Times of the nodes
+    std::vector< double > times_;
+
+    //! State and state transition matrix at the nodes
+    std::vector< Cr3bpStateAndTransitionMatrix > values_;
+
+    //! Derivatives of state and state transition matrix at the nodes
+    std::vector< Cr3bpStateAndTransitionMatrix > derivatives_;
+
+    //! Boolean denoting whether the state transition matrix is available
+    bool isStateTransitionMatrixPropagated_;
+};
+
+//! Results of a propagation with the CircularRestrictedThreeBodyPropagator
+struct Cr3bpPropagationResult
+{
+    //! Time at which the propagation terminated (final time, or time of the detected plane crossing)
+    double finalTime_ = TUDAT_NAN;
+
+    //! State at the final time
+    Eigen::Vector6d finalState_ = Eigen::Vector6d::Constant( TUDAT_NAN );
+
+    //! State transition matrix at the final time (identity if it was not propagated)
+    Eigen::Matrix6d stateTransitionMatrix_ = Eigen::Matrix6d::Identity( );
+
+    //! Boolean denoting whether the requested plane crossing was found
+    bool isCrossingDetected_ = false;
+
+    //! Number of state derivative evaluations
+    unsigned int numberOfFunctionEvaluations_ = 0;
+
+    //! Number of accepted steps
+    unsigned int numberOfAcceptedSteps_ = 0;
+
+    //! Number of rejected steps
+    unsigned int numberOfRejectedSteps_ = 0;
+};
+
+//! Dedicated propagator for the CR3BP, with fixed-size state and closed-form variational equations
+/*!
+ * Dedicated propagator for the CR3BP (normalized units, synodic frame), intended for applications that require very
+ * large numbers of short state and state transition matrix propagations (differential correction, continuation,
+ * manifold computation). The state (and optionally the state transition matrix) is stored in fixed-size Eigen types,
+ * and is propagated with a variable step-size Runge-Kutta 8(7) Dormand-Prince integrator (Montenbruck and Gill, 2005),
+ * using the compile-time unrolled stage loop of StaticRungeKuttaCoefficients. No memory is allocated during a
+ * propagation, unless dense output is requested. The step-size is controlled on all propagated entries, so that the
+ * state transition matrix is computed to the same relative tolerance as the state. Propagation backwards in time is
+ * supported.
+ */
+class CircularRestrictedThreeBodyPropagator
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param massParameter Mass parameter of the CR3BP
+     * \param relativeTolerance Relative error tolerance of each step
+     * \param absoluteTolerance Absolute error tolerance of each step
+     * \param initialStepSize Absolute value of the initial step size
+     * \param maximumStepSize Absolute value of the maximum step size
+     * \param maximumNumberOfSteps Maximum number of (accepted and rejected) steps, after which an exception is thrown
+     */
+    CircularRestrictedThreeBodyPropagator(
+            const double massParameter,
+            const double relativeTolerance = 1.0E-12,
+            const double absoluteTolerance = 1.0E-12,
+            const double initialStepSize = 1.0E-3,
+            const double maximumStepSize = 0.1,
+            const unsigned int maximumNumberOfSteps = 1000000 ):
+        massParameter_( massParameter ), relativeTolerance_( relativeTolerance ),
+        absoluteTolerance_( absoluteTolerance ), initialStepSize_( initialStepSize ),
+        maximumStepSize_( maximumStepSize ), maximumNumberOfSteps_( maximumNumberOfSteps ){ }
+
+    //! Function to propagate the state from an initial to a final time
+    /*!
+     * Function to propagate the state from an initial to a final time (which may be before the initial time).
+     * \param initialState Normalized initial state
+     * \param initialTime Initial time
+     * \param finalTime Final time
+     * \param denseOutput Continuous extension that is to be filled with the propagation results (if not nullptr)
+     * \return Propagation results
+     */
+    Cr3bpPropagationResult propagateState(
+            const Eigen::Vector6d& initialState,
+            const double initialTime,
+            const double finalTime,
+            const std::shared_ptr< Cr3bpDenseOutput > denseOutput = nullptr ) const;
+
+    //! Function to propagate the state and state transition matrix from an initial to a final time
+    /*!
+     * Function to propagate the state and state transition matrix from an initial to a final time (which may be before
+     * the initial time).
+     * \param initialState Normalized initial state
+     * \param initialTime Initial time
+     * \param finalTime Final time
+     * \param denseOutput Continuous extension that is to be filled with the propagation results (if not nullptr)
+     * \param initialStateTransitionMatrix Initial state transition matrix
+     * \return Propagation results
+     */
+    Cr3bpPropagationResult propagateStateAndTransitionMatrix(
+            const Eigen::Vector6d& initialState,
+            const double initialTime,
+            const double finalTime,
+            const std::shared_ptr< Cr3bpDenseOutput > denseOutput = nullptr,
+            const Eigen::Matrix6d& initialStateTransitionMatrix = Eigen::Matrix6d::Identity( ) ) const;
+
+    //! Function to propagate the state (and state transition matrix) to a crossing of a coordinate plane
+    /*!
+     * Function to propagate the state (and optionally the state transition matrix) until a given state component
+     * changes sign for the given number of times. The crossing epoch is refined with Newton iterations on the size of
+     * the last step. A sign change at the initial time (e.g. when starting on the plane) is not counted as a crossing.
+     * \param initialState Normalized initial state
+     * \param initialTime Initial time
+     * \param maximumTime Time at which the propagation is terminated if the requested crossing has not been found
+     * \param stateIndex Index of the state component of which the zero crossing is detected (1 for the xz-plane)
+     * \param numberOfCrossings Number of crossings after which the propagation is terminated
+     * \param propagateStateTransitionMatrix Boolean denoting whether the state transition matrix is to be propagated
+     * \param crossingDirection Sign of the component derivative at the crossing that is to be detected (0 for both)
+     * \return Propagation results, with isCrossingDetected_ false if maximumTime was reached first
+     */
+    Cr3bpPropagationResult propagateToCrossing(
+            const Eigen::Vector6d& initialState,
+            const double initialTime,
+            const double maximumTime,
+            const int stateIndex = 1,
+            const unsigned int numberOfCrossings = 1,
+            const bool propagateStateTransitionMatrix = true,
+            const int crossingDirection = 0 ) const;
+
+    //! Function to retrieve the mass parameter of the CR3BP
+    double getMassParameter( ) const
+    {
+        return massParameter_;
+    }
+
+private:
+
+    //! Function to perform the propagation, for state only (NumberOfColumns = 1) or including the STM (7)
+    template< int NumberOfColumns >
+    Cr3bpPropagationResult propagate(
+            const Eigen::Matrix< double, 6, NumberOfColumns >& initialValue,
+            const double initialTime,
+            const double finalTime,
+            const std::shared_ptr< Cr3bpDenseOutput > denseOutput,
+            const int crossingStateIndex,
+            const unsigned int numberOfCrossings,
+            const int crossingDirection ) const;
+
+    //! Mass parameter of the CR3BP
+    double massParameter_;
+
+    //! Relative error tolerance of each step
+    double relativeTolerance_;
+
+    //! Absolute error tolerance of each step
+    double absoluteTolerance_;
+
+    //! Absolute value of the initial step size
+    double initialStepSize_;
+
+    //! Absolute value of the maximum step size
+    double maximumStepSize_;
+
+    //! Maximum number of (accepted and rejected) steps
+    unsigned int maximumNumberOfSteps_;
+};
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_CIRCULAR_RESTRICTED_THREE_BODY_PROPAGATOR_H
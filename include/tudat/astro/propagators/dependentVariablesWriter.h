@@ -0,0 +1,110 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_DEPENDENTVARIABLESWRITER_H
+#define TUDAT_DEPENDENTVARIABLESWRITER_H
+
+#include <functional>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Class that evaluates a list of dependent variables directly into a preallocated output vector
+/*!
+ *  Class that evaluates a list of dependent variables directly into a preallocated output vector (such as a row of a
+ *  contiguous results history), with each dependent variable written to a segment of the output vector at a fixed offset.
+ *  The offset of each variable is set when it is added to this object, in the order in which the variables are added (which
+ *  is also the order in which the variables are evaluated). Scalar and 3-dimensional variables are written without
+ *  allocating memory, other vector variables are written from the (dynamically allocated) vector returned by their function.
+ */
+class DependentVariablesWriter
+{
+public:
+
+    //! Typedef for function writing a single dependent variable into the output vector
+    typedef std::function< void( Eigen::Ref< Eigen::VectorXd > ) > SingleVariableWriteFunction;
+
+    //! Constructor
+    DependentVariablesWriter( ): totalSize_( 0 ){ }
+
+    //! Function to add a scalar dependent variable to the end of the list
+    /*!
+     *  Function to add a scalar dependent variable to the end of the list
+     *  \param variableFunction Function returning the dependent variable
+     *  \return Index of the dependent variable in the output vector
+     */
+    int addScalarVariable( const std::function< double( ) >& variableFunction );
+
+    //! Function to add a 3-dimensional vector dependent variable to the end of the list
+    /*!
+     *  Function to add a 3-dimensional vector dependent variable to the end of the list
+     *  \param variableFunction Function returning the dependent variable
+     *  \return Start index of the dependent variable in the output vector
+     */
+    int addThreeDimensionalVariable( const std::function< Eigen::Vector3d( ) >& variableFunction );
+
+    //! Function to add a vector dependent variable of arbitrary size to the end of the list
+    /*!
+     *  Function to add a vector dependent variable of arbitrary size to the end of the list
+     *  \param variableFunction Function returning the dependent variable
+     *  \param variableSize Size of the vector returned by the variableFunction
+     *  \return Start index of the dependent variable in the output vector
+     */
+    int addVectorVariable( const std::function< Eigen::VectorXd( ) >& variableFunction, const int variableSize );
+
+    //! Function to evaluate all dependent variables, and write them into a vector of size getTotalSize( )
+    /*!
+     *  Function to evaluate all dependent variables, and write them into a vector of size getTotalSize( ). The
+     *  environment and state derivative models need to be updated to the current state and independent variable before
+     *  calling this function.
+     *  \param dependentVariables Vector into which the dependent variables are written (returned by reference)
+     */
+    void writeDependentVariables( Eigen::Ref< Eigen::VectorXd > dependentVariables ) const;
+
+    //! Function to evaluate all dependent variables, and return them as a newly allocated vector
+    Eigen::VectorXd evaluateDependentVariables( ) const
+    {
+        Eigen::VectorXd dependentVariables = Eigen::VectorXd::Zero( totalSize_ );
+        writeDependentVariables( dependentVariables );
+        return dependentVariables;
+    }
+
+    //! Function to retrieve the total size of the dependent variables
+    int getTotalSize( ) const
+    {
+        return totalSize_;
+    }
+
+    //! Function to retrieve the number of dependent variables (as added to this object)
+    int getNumberOfVariables( ) const
+    {
+        return static_cast< int >( writeFunctions_.size( ) );
+    }
+
+private:
+
+    //! Functions writing the single dependent variables into the output vector, in order of evaluation
+    std::vector< SingleVariableWriteFunction > writeFunctions_;
+
+    //! Total size of the dependent variables
+    int totalSize_;
+};
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_DEPENDENTVARIABLESWRITER_H
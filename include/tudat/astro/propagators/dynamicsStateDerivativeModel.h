@@ -22,9 +22,13 @@
 
 #include <Eigen/Core>
 
+#include "tudat/basics/contiguousTimeHistory.h"
+#include "tudat/basics/modelEvaluationProfiler.h"
+#include "tudat/basics/scratchArena.h"
 #include "tudat/astro/basic_astro/torqueModelTypes.h"
 #include "tudat/astro/propagators/bodyMassStateDerivative.h"
 #include "tudat/astro/propagators/singleStateTypeDerivative.h"
+#include "tudat/astro/propagators/nBodyEnckeStateDerivative.h"
 #include "tudat/astro/propagators/nBodyStateDerivative.h"
 #include "tudat/astro/propagators/rotationalMotionStateDerivative.h"
 #include "tudat/astro/propagators/variationalEquations.h"
@@ -65,7 +69,7 @@ public:
             stateDerivativeModels,
             const std::function< void(
                 const TimeType, const std::unordered_map< IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >&,
-                const std::vector< IntegratedStateType > ) > environmentUpdateFunction,
+                const std::vector< IntegratedStateType >& ) > environmentUpdateFunction,
             const std::shared_ptr< VariationalEquations > variationalEquations =
             std::shared_ptr< VariationalEquations >( ) ):
         environmentUpdateFunction_( environmentUpdateFunction ), variationalEquations_( variationalEquations ),
@@ -124,6 +128,9 @@ public:
             // Set current model in member map.
             stateDerivativeModels_[ stateDerivativeModels.at( i )->getIntegratedStateType( ) ].push_back(
                         stateDerivativeModels.at( i ) );
+            currentPropagatedStateBlocks_[ stateDerivativeModels.at( i )->getIntegratedStateType( ) ].push_back(
+                        Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >::Zero(
+                            stateDerivativeModels.at( i )->getPropagatedStateSize( ) ) );
 
             currentStatesPerTypeInConventionalRepresentation_[ stateDerivativeModels.at( i )->getIntegratedStateType( )  ] =
                     Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >::Zero(
@@ -145,6 +152,23 @@ public:
      */
     StateType computeStateDerivative( const TimeType time, const StateType& state )
     {
+        return evaluateStateDerivative( time, state );
+    }
+
+    //! Function to calculate the system state derivative, without copying the result
+    /*!
+     *  Function to calculate the system state derivative, as computeStateDerivative, but returning a reference to the
+     *  internally stored state derivative (valid until the next call of this function), instead of a copy. During the
+     *  evaluation, the scratchArena_ of this object is the active scratch arena in the current thread, from which models
+     *  may obtain memory for their temporaries, so that (after the first few calls) no heap allocations are needed.
+     *  \param time Current time.
+     *  \param state Current complete state.
+     *  \return Calculated state derivative.
+     */
+    const StateType& evaluateStateDerivative( const TimeType time, const StateType& state )
+    {
+        utilities::ScopedScratchArena scopedScratchArena( scratchArena_ );
+        TUDAT_PROFILE_MODEL_EVALUATION( modelEvaluationProfiler_, totalProfilingIndex_ );
 
         if( !( time == time ) )
         {
@@ -182,16 +206,16 @@ public:
                 }
             }
 
+            TUDAT_PROFILE_MODEL_EVALUATION( modelEvaluationProfiler_, environmentUpdateProfilingIndex_ );
             convertCurrentStateToGlobalRepresentationPerType( state, time, evaluateVariationalEquations_ );
             environmentUpdateFunction_( time, currentStatesPerTypeInConventionalRepresentation_,
                                         integratedStatesFromEnvironment_ );
         }
         else
         {
+            TUDAT_PROFILE_MODEL_EVALUATION( modelEvaluationProfiler_, environmentUpdateProfilingIndex_ );
             environmentUpdateFunction_(
-                        time, std::unordered_map<
-                        IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >( ),
-                        integratedStatesFromEnvironment_ );
+                        time, emptyStatesPerType_, integratedStatesFromEnvironment_ );
 
         }
 
@@ -212,6 +236,7 @@ public:
                 for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
                 {
                     // Update state derivative models
+                    TUDAT_PROFILE_MODEL_EVALUATION( modelEvaluationProfiler_, stateDerivativeUpdateProfilingIndex_ );
                     stateDerivativeModelsIterator_->second.at( i )->updateStateDerivativeModel( time );
                 }
             }
@@ -223,10 +248,14 @@ public:
                 for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
                 {
                     // Evaluate and set current dynamical state derivative
+                    TUDAT_PROFILE_MODEL_EVALUATION( modelEvaluationProfiler_, stateDerivativeEvaluationProfilingIndex_ );
                     currentIndices = propagatedStateIndices_.at( stateDerivativeModelsIterator_->first ).at( i );
 
+                    Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& currentPropagatedState =
+                            currentPropagatedStateBlocks_.at( stateDerivativeModelsIterator_->first ).at( i );
+                    currentPropagatedState = state.block( currentIndices.first, dynamicsStartColumn_, currentIndices.second, 1 );
                     stateDerivativeModelsIterator_->second.at( i )->calculateSystemStateDerivative(
-                                time, state.block( currentIndices.first, dynamicsStartColumn_, currentIndices.second, 1 ),
+                                time, currentPropagatedState,
                                 stateDerivative_.block( currentIndices.first, dynamicsStartColumn_, currentIndices.second, 1 ) );
                 }
             }
@@ -235,6 +264,7 @@ public:
         // If variational equations are to be integrated: evaluate and set.
         if( evaluateVariationalEquations_ )
         {
+            TUDAT_PROFILE_MODEL_EVALUATION( modelEvaluationProfiler_, variationalEquationsProfilingIndex_ );
             variationalEquations_->updatePartials( time, currentStatesPerTypeInConventionalRepresentation_ );
 
             variationalEquations_->evaluateVariationalEquations< StateScalarType >(
@@ -244,7 +274,8 @@ public:
 
         // Update counters
         functionEvaluationCounter_++;
-        cumulativeFunctionEvaluationCounter_[ time ] = functionEvaluationCounter_;
+        cumulativeFunctionEvaluationTimes_.push_back( time );
+        cumulativeFunctionEvaluationCounter_.push_back( functionEvaluationCounter_ );
 
         return stateDerivative_;
 
@@ -322,7 +353,25 @@ public:
     {
         Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > outputState =
                 Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >::Zero( totalConventionalStateSize_, 1 );
+        convertToOutputSolution( internalSolution, time, outputState );
+        return outputState;
+    }
 
+    //! Function to convert the propagator-specific form of the state to the conventional form, into an existing vector.
+    /*!
+     * Function to convert the propagator-specific form of the state to the conventional form (see above), into an existing
+     * vector, so that no memory needs to be allocated for the output when converting a full state history.
+     * \param internalSolution State in propagator-specific form (i.e. form that is used in numerical integration).
+     * \param time Current time at which the state is valid.
+     * \param outputState State (internalSolution), converted to the 'conventional form' (returned by reference; must be
+     * of the size of the conventional state).
+     */
+    template< typename InternalStateType >
+    void convertToOutputSolution(
+            const Eigen::MatrixBase< InternalStateType >& internalSolution,
+            const TimeType& time,
+            Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& outputState )
+    {
         // Iterate over all state derivative models and convert associated state entries
         std::vector< std::pair< int, int > > currentConventionalStateIndices;
         std::vector< std::pair< int, int > > currentPropagatedStateIndices;
@@ -342,8 +391,6 @@ public:
                                                currentConventionalStateIndices.at( i ).second, 1 ) );
             }
         }
-
-        return outputState;
     }
 
     //! Function to convert a state history from propagator-specific form to the conventional form.
@@ -371,13 +418,91 @@ public:
         }
     }
 
+    //! Function to convert a contiguous state history from propagator-specific form to the conventional form.
+    /*!
+     * Function to convert a contiguous state history from propagator-specific form to the conventional form, writing the
+     * converted states directly into the contiguous output history (no memory is allocated per epoch). The states of
+     * state types that support it (see SingleStateTypeDerivative::convertToOutputSolutionBatch) are converted as a single
+     * batch, distributed over a number of threads, the others are converted epoch by epoch.
+     * \sa DynamicsStateDerivativeModel::convertToOutputSolution
+     * \param convertedSolution State history in conventional form (returned by reference)
+     * \param rawSolution State history in propagator-specific form (i.e. form that is used in numerical integration).
+     * \param numberOfThreads Maximum number of threads over which batch conversions are distributed
+     */
+    void convertNumericalStateSolutionsToOutputSolutions(
+            utilities::ContiguousTimeHistory< TimeType, StateScalarType >& convertedSolution,
+            const utilities::ContiguousTimeHistory< TimeType, StateScalarType >& rawSolution,
+            const int numberOfThreads = 1 )
+    {
+        int numberOfEpochs = rawSolution.size( );
+        convertedSolution = utilities::ContiguousTimeHistory< TimeType, StateScalarType >(
+                    totalConventionalStateSize_, numberOfEpochs );
+
+        // Convert state histories of state types supporting batch conversion, one epoch per column
+        Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > convertedStates =
+                Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >::Zero(
+                    totalConventionalStateSize_, numberOfEpochs );
+        Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > currentConvertedStates;
+        std::vector< std::pair< IntegratedStateType, int > > modelsToConvertPerEpoch;
+        for( auto modelIterator : stateDerivativeModels_ )
+        {
+            for( unsigned int i = 0; i < modelIterator.second.size( ); i++ )
+            {
+                std::pair< int, int > propagatedIndices = propagatedStateIndices_.at( modelIterator.first ).at( i );
+                std::pair< int, int > conventionalIndices = conventionalStateIndices_.at( modelIterator.first ).at( i );
+                if( modelIterator.second.at( i )->convertToOutputSolutionBatch(
+                            rawSolution.getValues( ).middleCols( propagatedIndices.first, propagatedIndices.second ).transpose( ),
+                            currentConvertedStates, numberOfThreads ) )
+                {
+                    convertedStates.middleRows( conventionalIndices.first, conventionalIndices.second ) =
+                            currentConvertedStates;
+                }
+                else
+                {
+                    modelsToConvertPerEpoch.push_back( std::make_pair( modelIterator.first, i ) );
+                }
+            }
+        }
+
+        // Convert state histories of remaining state types epoch by epoch
+        if( modelsToConvertPerEpoch.size( ) > 0 )
+        {
+            Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > convertedState =
+                    Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >::Zero( totalConventionalStateSize_ );
+            for( int j = 0; j < numberOfEpochs; j++ )
+            {
+                for( unsigned int k = 0; k < modelsToConvertPerEpoch.size( ); k++ )
+                {
+                    IntegratedStateType stateType = modelsToConvertPerEpoch.at( k ).first;
+                    int modelIndex = modelsToConvertPerEpoch.at( k ).second;
+                    std::pair< int, int > propagatedIndices = propagatedStateIndices_.at( stateType ).at( modelIndex );
+                    std::pair< int, int > conventionalIndices = conventionalStateIndices_.at( stateType ).at( modelIndex );
+
+                    stateDerivativeModels_.at( stateType ).at( modelIndex )->convertToOutputSolution(
+                                rawSolution.getValue( j ).segment( propagatedIndices.first, propagatedIndices.second ),
+                                rawSolution.getTime( j ),
+                                convertedState.block( conventionalIndices.first, 0, conventionalIndices.second, 1 ) );
+                    convertedStates.block( conventionalIndices.first, j, conventionalIndices.second, 1 ) =
+                            convertedState.segment( conventionalIndices.first, conventionalIndices.second );
+                }
+            }
+        }
+
+        for( int j = 0; j < numberOfEpochs; j++ )
+        {
+            convertedSolution.appendEpoch( rawSolution.getTime( j ) ) = convertedStates.col( j );
+        }
+    }
+
     //! Function to process the state vector during propagation.
     /*!
      * Function to process the state vector during propagation.
      * \param unprocessedState State before processing.
+     * \param currentTime Time at which the state is valid.
      * \return Processed state (returned by reference).
      */
-    void postProcessState( Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& unprocessedState )
+    void postProcessState( Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& unprocessedState,
+                           const TimeType currentTime )
     {
         // Iterate over all state derivative models and post-process associated state entries
         std::vector< std::pair< int, int > > currentIndices;
@@ -392,7 +517,7 @@ public:
                 {
                     stateDerivativeModelsIterator_->second.at( i )->postProcessState(
                                 unprocessedState.block( currentIndices.at( i ).first, 0,
-                                                        currentIndices.at( i ).second, 1 ) );
+                                                        currentIndices.at( i ).second, 1 ), currentTime );
                 }
             }
         }
@@ -400,13 +525,19 @@ public:
 
     //! Function to process the state vector and variational equations during propagation.
     /*!
-     * Function to process the state vector and variational equations during propagation.
+     * Function to process the state vector and variational equations during propagation. Only the time-independent
+     * post-processing of the state derivative models is performed, since time-dependent processing (e.g. rectification
+     * of the Encke reference orbit) would invalidate the variational equations.
      * \param unprocessedState State before processing.
+     * \param currentTime Time at which the state is valid (unused).
      * \return Processed state (returned by reference).
      */
     void postProcessStateAndVariationalEquations(
-            Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& unprocessedState )
+            Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& unprocessedState,
+            const TimeType currentTime )
     {
+        TUDAT_UNUSED_PARAMETER( currentTime );
+
         // Iterate over all state derivative models and post-process associated state entries
         std::vector< std::pair< int, int > > currentIndices;
         Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > currentUnprocessedState;
@@ -497,7 +628,8 @@ public:
                     case cowell:
                         break;
                     case encke:
-//                        throw std::runtime_error( "Error, reference orbit not reset in Encke propagator" );
+                        std::dynamic_pointer_cast< NBodyEnckeStateDerivative< StateScalarType, TimeType > >(
+                                    currentTranslationalStateDerivative )->resetRectifiedReferenceOrbits( );
                         break;
                     case gauss_keplerian:
                         break;
@@ -585,7 +717,13 @@ public:
      */
     std::map< TimeType, unsigned int > getCumulativeNumberOfFunctionEvaluations( )
     {
-        return cumulativeFunctionEvaluationCounter_;
+        std::map< TimeType, unsigned int > cumulativeNumberOfFunctionEvaluations;
+        for( unsigned int i = 0; i < cumulativeFunctionEvaluationTimes_.size( ); i++ )
+        {
+            cumulativeNumberOfFunctionEvaluations[ cumulativeFunctionEvaluationTimes_[ i ] ] =
+                    cumulativeFunctionEvaluationCounter_[ i ];
+        }
+        return cumulativeNumberOfFunctionEvaluations;
     }
 
     //! Function to reset the number of calls to the computeStateDerivative function to zero.
@@ -595,9 +733,20 @@ public:
      */
     void resetCumulativeFunctionEvaluationCounter( )
     {
+        cumulativeFunctionEvaluationTimes_.clear( );
         cumulativeFunctionEvaluationCounter_.clear( );
     }
 
+    //! Function to retrieve the scratch arena that is active during the evaluation of the state derivative
+    /*!
+     * Function to retrieve the scratch arena that is active during the evaluation of the state derivative
+     * \return Scratch arena that is active during the evaluation of the state derivative
+     */
+    const utilities::ScratchArena& getScratchArena( )
+    {
+        return scratchArena_;
+    }
+
     //! Function to retrieve the object used for computing the state derivative in the variational equations
     /*!
      * Function to retrieve the object used for computing the state derivative in the variational equations
@@ -608,6 +757,46 @@ public:
         return variationalEquations_;
     }
 
+    //! Function to set the object to which the model evaluations are to be profiled
+    /*!
+     * Function to set the object to which the model evaluations are to be profiled. The sections of the
+     * computeStateDerivative function are registered in the state_derivative category, and the profiler is passed to
+     * all state derivative models (which register their own models, e.g. accelerations and torques). Note that
+     * evaluations are only profiled if Tudat is compiled with TUDAT_BUILD_WITH_PROPAGATION_PROFILING.
+     * \param modelEvaluationProfiler Object to which model evaluations are to be profiled (nullptr to disable profiling)
+     */
+    void setModelEvaluationProfiler(
+            const std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler )
+    {
+        modelEvaluationProfiler_ = modelEvaluationProfiler;
+        if( modelEvaluationProfiler_ != nullptr )
+        {
+            totalProfilingIndex_ = modelEvaluationProfiler_->addProfiledModel( "state_derivative", "total" );
+            environmentUpdateProfilingIndex_ = modelEvaluationProfiler_->addProfiledModel(
+                        "state_derivative", "environment_update" );
+            stateDerivativeUpdateProfilingIndex_ = modelEvaluationProfiler_->addProfiledModel(
+                        "state_derivative", "state_derivative_model_update" );
+            stateDerivativeEvaluationProfilingIndex_ = modelEvaluationProfiler_->addProfiledModel(
+                        "state_derivative", "state_derivative_evaluation" );
+            variationalEquationsProfilingIndex_ = modelEvaluationProfiler_->addProfiledModel(
+                        "state_derivative", "variational_equations" );
+        }
+
+        for( auto modelIterator : stateDerivativeModels_ )
+        {
+            for( unsigned int i = 0; i < modelIterator.second.size( ); i++ )
+            {
+                modelIterator.second.at( i )->setModelEvaluationProfiler( modelEvaluationProfiler_ );
+            }
+        }
+    }
+
+    //! Function to retrieve the object to which the model evaluations are profiled (nullptr if not profiled)
+    std::shared_ptr< utilities::ModelEvaluationProfiler > getModelEvaluationProfiler( )
+    {
+        return modelEvaluationProfiler_;
+    }
+
 
 private:
 
@@ -655,8 +844,12 @@ private:
                 currentConventionalIndices = conventionalStateIndices_.at( stateDerivativeModelsIterator_->first ).at( i );
 
                 // Set current block in split state (in global form)
+                Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& currentPropagatedState =
+                        currentPropagatedStateBlocks_.at( stateDerivativeModelsIterator_->first ).at( i );
+                currentPropagatedState = state.block(
+                            currentPropagatedIndices.first, startColumn, currentPropagatedIndices.second, 1 );
                 stateDerivativeModelsIterator_->second.at( i )->convertCurrentStateToGlobalRepresentation(
-                            state.block( currentPropagatedIndices.first, startColumn, currentPropagatedIndices.second, 1 ), time,
+                            currentPropagatedState, time,
                             currentStatesPerTypeInConventionalRepresentation_.at(
                                 stateDerivativeModelsIterator_->first ).block(
                                 currentStateTypeSize, 0, currentConventionalIndices.second, 1 ) );
@@ -668,7 +861,7 @@ private:
     std::function<
     void( const TimeType, const std::unordered_map< IntegratedStateType,
           Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >&,
-          const std::vector< IntegratedStateType > ) > environmentUpdateFunction_;
+          const std::vector< IntegratedStateType >& ) > environmentUpdateFunction_;
 
     //! Object used for computing the state derivative in the variational equations
     std::shared_ptr< VariationalEquations > variationalEquations_;
@@ -733,8 +926,40 @@ private:
     //! Variable to keep track of the number of calls to the computeStateDerivative function
     unsigned int functionEvaluationCounter_ = 0;
 
-    //! Variable to keep track of the number of calls to the computeStateDerivative function per time step
-    std::map< TimeType, unsigned int > cumulativeFunctionEvaluationCounter_;
+    //! Times at which the computeStateDerivative function was called (in order of calls, entries may be repeated)
+    std::vector< TimeType > cumulativeFunctionEvaluationTimes_;
+
+    //! Values of functionEvaluationCounter_ after each of the calls in cumulativeFunctionEvaluationTimes_
+    /*!
+     *  Values of functionEvaluationCounter_ after each of the calls in cumulativeFunctionEvaluationTimes_. The history is
+     *  stored in two vectors (rather than a map) so that no heap allocation is needed per call, once the capacity of the
+     *  vectors has grown sufficiently (which it retains after a reset).
+     */
+    std::vector< unsigned int > cumulativeFunctionEvaluationCounter_;
+
+    //! Pre-allocated copies of the propagated state of each state derivative model (in order of stateDerivativeModels_)
+    /*!
+     *  Pre-allocated copies of the propagated state of each state derivative model (in order of stateDerivativeModels_), used
+     *  to pass the current state to the models without creating a heap-allocated temporary for each call.
+     */
+    std::map< IntegratedStateType, std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > >
+    currentPropagatedStateBlocks_;
+
+    //! Empty list of states, used to update the environment when the dynamical equations are not evaluated
+    std::unordered_map< IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > emptyStatesPerType_;
+
+    //! Arena of scratch memory that is active in the current thread during the evaluation of the state derivative
+    utilities::ScratchArena scratchArena_;
+
+    //! Object to which the model evaluations are profiled (nullptr if not profiled)
+    std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler_;
+
+    //! Indices in modelEvaluationProfiler_ of the (sections of the) computeStateDerivative function
+    int totalProfilingIndex_ = -1;
+    int environmentUpdateProfilingIndex_ = -1;
+    int stateDerivativeUpdateProfilingIndex_ = -1;
+    int stateDerivativeEvaluationProfilingIndex_ = -1;
+    int variationalEquationsProfilingIndex_ = -1;
 };
 
 extern template class DynamicsStateDerivativeModel< double, double >;
@@ -763,9 +988,10 @@ std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel3d > > getAc
     // Retrieve acceleration models
     if( stateDerivativeModels.count( propagators::translational_state ) == 1 )
     {
-        basic_astrodynamics::AccelerationMap accelerationModelList =
+        std::shared_ptr< NBodyStateDerivative< StateScalarType, TimeType > > nBodyModel =
                 std::dynamic_pointer_cast< NBodyStateDerivative< StateScalarType, TimeType > >(
-                    stateDerivativeModels.at( propagators::translational_state ).at( 0 ) )->getFullAccelerationsMap( );
+                    stateDerivativeModels.at( propagators::translational_state ).at( 0 ) );
+        basic_astrodynamics::AccelerationMap accelerationModelList = nBodyModel->getFullAccelerationsMap( );
 
         if( accelerationModelList.count( bodyUndergoingAcceleration ) == 0 )
         {
@@ -788,6 +1014,9 @@ std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel3d > > getAc
                 // Retrieve required acceleration.
                 listOfSuitableAccelerationModels = basic_astrodynamics::getAccelerationModelsOfType(
                             accelerationModelList.at( bodyUndergoingAcceleration ).at( bodyExertingAcceleration ), accelerationModelType );
+
+                // Ensure that models evaluated by mutual point-mass kernel are up to date when retrieved
+                nBodyModel->setUpdateKernelEvaluatedAccelerations( listOfSuitableAccelerationModels );
             }
         }
     }
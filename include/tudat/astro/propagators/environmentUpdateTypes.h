@@ -49,6 +49,14 @@ void addEnvironmentUpdates(
         const std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > >
         updatesToAdd );
 
+//! Function to get a string representing an environment update type
+/*!
+ * Function to get a string representing an environment update type
+ * \param updateType Environment update type
+ * \return String representing the environment update type
+ */
+std::string getEnvironmentUpdateTypeName( const EnvironmentModelsToUpdate updateType );
+
 } // namespace propagators
 
 } // namespace tudat
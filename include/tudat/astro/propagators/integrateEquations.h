@@ -20,13 +20,17 @@
 #include <Eigen/Core>
 #include <boost/lambda/lambda.hpp>
 #include <chrono>
+#include <cmath>
 #include <limits>
 
 #include <map>
 
 #include "tudat/math/integrators/numericalIntegrator.h"
 #include "tudat/astro/basic_astro/timeConversions.h"
+#include "tudat/basics/contiguousTimeHistory.h"
 #include "tudat/basics/timeType.h"
+#include "tudat/astro/propagators/dependentVariablesWriter.h"
+#include "tudat/astro/propagators/propagationCheckpoint.h"
 #include "tudat/astro/propagators/singleStateTypeDerivative.h"
 #include "tudat/math/integrators/createNumericalIntegrator.h"
 #include "tudat/math/interpolators/lagrangeInterpolator.h"
@@ -43,7 +47,9 @@ namespace propagators
 //! Function to determine, for a given time step of the numerical integrator, the error in termination dependent variable
 /*!
  *  Function to determine, for a given time step of the numerical integrator, the error in termination dependent variable. This
- *  function is used as input for the root finder when the propagation must terminate exactly on a dependent variable value
+ *  function is used as input for the root finder when the propagation must terminate exactly on a dependent variable value.
+ *  If the integrator provides dense output for the last step, the state is retrieved from it, instead of (re)taking a
+ *  time step from the previous state.
  *  \param timeStep Time step to take with the numerical integrator
  *  \param integrator Numerical integrator used for propagation
  *  \param dependentVariableTerminationCondition Settings used to determine value/type of dependent variable at which propagation
@@ -57,6 +63,14 @@ TimeStepType getTerminationDependentVariableErrorForGivenTimeStep(
         integrator,
         const std::shared_ptr< SingleVariableLimitPropagationTerminationCondition > dependentVariableTerminationCondition )
 {
+    // Retrieve value of dependent variable from dense output, if available
+    if( integrator->isDenseOutputAvailable( ) )
+    {
+        TimeType currentTime = integrator->getPreviousIndependentVariable( ) + timeStep;
+        integrator->getStateDerivativeFunction( )( currentTime, integrator->getDenseOutputState( currentTime ) );
+        return static_cast< TimeStepType >( dependentVariableTerminationCondition->getStopConditionError( ) );
+    }
+
     // Perform integration step
     integrator->performIntegrationStep( timeStep );
 
@@ -78,7 +92,7 @@ TimeStepType getTerminationDependentVariableErrorForGivenTimeStep(
  * Determines the time step that is to be taken by using a root finder, and returns (by reference) the converged final time
  * and state.
  * \param integrator Numerical integrator that is used for propagation. Upon input to this function, the integrator is rolled
- * back to the secondToLastTime/secondToLastState
+ * back to the secondToLastTime/secondToLastState, or (if dense output is available) is at the lastTime/lastState
  * \param dependentVariableTerminationCondition Termination condition that is to be used
  * \param secondToLastTime Second to last time (e.g. last time at which integration did not exceed termination condition)
  * \param lastTime Time at which integration first exceeded termination condition
@@ -136,8 +150,16 @@ void getFinalStateForExactDependentVariableTerminationCondition(
                     std::make_shared< basic_mathematics::FunctionProxy< TimeStepType, TimeStepType > >(
                         dependentVariableErrorFunction ), ( lastTime - secondToLastTime ) / 2.0 );
 
-        endState = integrator->performIntegrationStep( finalTimeStep );
-        endTime = integrator->getCurrentIndependentVariable( );
+        if( integrator->isDenseOutputAvailable( ) )
+        {
+            endTime = secondToLastTime + finalTimeStep;
+            endState = integrator->getDenseOutputState( endTime );
+        }
+        else
+        {
+            endState = integrator->performIntegrationStep( finalTimeStep );
+            endTime = integrator->getCurrentIndependentVariable( );
+        }
     }
     // If dependent variable has no root in given interval, set end time and state at NaN
     catch( std::runtime_error& caughtException )
@@ -153,11 +175,62 @@ void getFinalStateForExactDependentVariableTerminationCondition(
     }
 }
 
+//! Function to retrieve the tolerance in time to which an exact termination condition is located
+/*!
+ * Function to retrieve the tolerance in time to which an exact termination condition is located, used to determine whether
+ * multiple events of a hybrid termination condition occur simultaneously. For time conditions, this is a small multiple of
+ * the floating point resolution of the time step, for dependent variable conditions it is the independent variable
+ * tolerance of the root finder, and for hybrid conditions it is the largest tolerance of the constituent conditions.
+ * \param terminationCondition Termination condition for which the tolerance is to be determined
+ * \param timeStep Time step in which the event is located
+ * \return Tolerance in time to which the termination condition is located
+ */
+template< typename TimeStepType >
+double getExactTerminationTimeTolerance(
+        const std::shared_ptr< PropagationTerminationCondition > terminationCondition,
+        const TimeStepType timeStep )
+{
+    double absoluteTimeStep = std::fabs( static_cast< double >( timeStep ) );
+    double timeTolerance = 4.0 * std::numeric_limits< double >::epsilon( ) * absoluteTimeStep;
+    if( terminationCondition->getTerminationType( ) == dependent_variable_stopping_condition )
+    {
+        std::shared_ptr< root_finders::RootFinderSettings > rootFinderSettings =
+                std::dynamic_pointer_cast< SingleVariableLimitPropagationTerminationCondition >(
+                    terminationCondition )->getTerminationRootFinderSettings( );
+        if( rootFinderSettings->absoluteIndependentVariableTolerance_ ==
+                rootFinderSettings->absoluteIndependentVariableTolerance_ )
+        {
+            timeTolerance = std::max( timeTolerance, rootFinderSettings->absoluteIndependentVariableTolerance_ );
+        }
+        if( rootFinderSettings->relativeIndependentVariableTolerance_ ==
+                rootFinderSettings->relativeIndependentVariableTolerance_ )
+        {
+            timeTolerance = std::max(
+                        timeTolerance, rootFinderSettings->relativeIndependentVariableTolerance_ * absoluteTimeStep );
+        }
+    }
+    else if( terminationCondition->getTerminationType( ) == hybrid_stopping_condition )
+    {
+        std::vector< std::shared_ptr< PropagationTerminationCondition > > terminationConditionList =
+                std::dynamic_pointer_cast< HybridPropagationTerminationCondition >(
+                    terminationCondition )->getPropagationTerminationConditions( );
+        for( unsigned int i = 0; i < terminationConditionList.size( ); i++ )
+        {
+            timeTolerance = std::max(
+                        timeTolerance, getExactTerminationTimeTolerance( terminationConditionList.at( i ), timeStep ) );
+        }
+    }
+    return timeTolerance;
+}
+
 //! Function that propagates to an exact final condition (within tolerance) for hybrid termination condition
 /*!
  * Function that propagates to an exact final condition (within tolerance) for hybrid termination condition. Determines
- * the termination time/state for each of the constituent termination condition, and chooses the hybrid termiantion time/state
- * accordingly
+ * the termination time/state for each of the constituent termination condition that was met at the end of the last step,
+ * and chooses the hybrid termiantion time/state accordingly. If the integrator provides dense output, all events are located
+ * on the same continuous extension of the last step. Afterwards, the list of conditions that were met when stopping is reset
+ * in the hybrid termination condition, so that it is true only for the constituent conditions that are met at the final time
+ * (within the tolerance of the root finder, so that multiple simultaneous events are all flagged).
  * \param integrator Numerical integrator that is used for propagation. Upon input to this function, the integrator is rolled
  * back to the secondToLastTime/secondToLastState
  * \param hyrbidTerminationCondition Termination condition that is to be used
@@ -183,6 +256,7 @@ bool getFinalStateForExactHybridVariableTerminationCondition(
 
     std::vector< std::shared_ptr< PropagationTerminationCondition > > terminationConditionList =
             hyrbidTerminationCondition->getPropagationTerminationConditions( );
+    std::vector< bool > isConditionMetWhenStopping = hyrbidTerminationCondition->getIsConditionMetWhenStopping( );
 
     // Create list of converged times/states for each constituent condition
     std::vector< TimeType > endTimes;
@@ -196,8 +270,11 @@ bool getFinalStateForExactHybridVariableTerminationCondition(
     bool timesAreSet = false;
     for( unsigned int i = 0; i < terminationConditionList.size( ); i++ )
     {
-        if( terminationConditionList.at( i )->getcheckTerminationToExactCondition( ) )
-        {           
+        // Events can only be located for conditions that were met at the end of the last step
+        endTimes[ i ] = TUDAT_NAN;
+        if( terminationConditionList.at( i )->getcheckTerminationToExactCondition( ) &&
+                isConditionMetWhenStopping.at( i ) )
+        {
             // Determine single termination condition
             getFinalStateForExactTerminationCondition(
                         integrator, terminationConditionList.at( i ),secondToLastTime, lastTime, secondToLastState, lastState,
@@ -256,6 +333,20 @@ bool getFinalStateForExactHybridVariableTerminationCondition(
         {
             throw std::runtime_error( "Error when propagating to exact final hybrid condition, case not recognized" );
         }
+
+        // Flag events that occur at or before final time (including simultaneous events); conditions that are not
+        // located exactly are left unchanged
+        double directionSign = propagationIsForwards ? 1.0 : -1.0;
+        for( unsigned int i = 0; i < terminationConditionList.size( ); i++ )
+        {
+            if( endTimes[ i ] == endTimes[ i ] )
+            {
+                isConditionMetWhenStopping[ i ] =
+                        directionSign * static_cast< double >( endTimes[ i ] - endTime ) <=
+                        getExactTerminationTimeTolerance( terminationConditionList.at( i ), lastTime - secondToLastTime );
+            }
+        }
+        hyrbidTerminationCondition->resetIsConditionMetWhenStopping( isConditionMetWhenStopping );
         return true;
     }
     else
@@ -300,12 +391,20 @@ bool getFinalStateForExactTerminationCondition(
         std::shared_ptr< FixedTimePropagationTerminationCondition > timeTerminationCondition =
                 std::dynamic_pointer_cast< FixedTimePropagationTerminationCondition >( terminationCondition );
 
-        // Determine final time step and propagate
-        TimeStepType finalTimeStep = timeTerminationCondition->getStopTime( ) - secondToLastTime;
+        // Determine final state from dense output, if available, or by repeating last step with final time step
+        if( integrator->isDenseOutputAvailable( ) )
+        {
+            endTime = timeTerminationCondition->getStopTime( );
+            endState = integrator->getDenseOutputState( endTime );
+        }
+        else
+        {
+            TimeStepType finalTimeStep = timeTerminationCondition->getStopTime( ) - secondToLastTime;
 
-        integrator->rollbackToPreviousState( );
-        endState = integrator->performIntegrationStep( finalTimeStep );
-        endTime = integrator->getCurrentIndependentVariable( );
+            integrator->rollbackToPreviousState( );
+            endState = integrator->performIntegrationStep( finalTimeStep );
+            endTime = integrator->getCurrentIndependentVariable( );
+        }
 
         break;
     }
@@ -320,7 +419,11 @@ bool getFinalStateForExactTerminationCondition(
     }
     case dependent_variable_stopping_condition:
     {
-        integrator->rollbackToPreviousState( );
+        // Undo last step, unless final state can be determined from dense output
+        if( !integrator->isDenseOutputAvailable( ) )
+        {
+            integrator->rollbackToPreviousState( );
+        }
 
         std::shared_ptr< SingleVariableLimitPropagationTerminationCondition > dependentVariableTerminationCondition =
                 std::dynamic_pointer_cast< SingleVariableLimitPropagationTerminationCondition >( terminationCondition );
@@ -355,6 +458,272 @@ bool getFinalStateForExactTerminationCondition(
     return useNewSolution;
 }
 
+//! Function to remove all entries from a history stored as map, except those at the initial and last saved epoch
+template< typename ValueType, typename TimeType >
+void removeIntermediateHistoryEntries( std::map< TimeType, ValueType >& history )
+{
+    while( history.size( ) > 2 )
+    {
+        history.erase( std::next( history.begin( ) ) );
+    }
+}
+
+//! Function to remove all entries from a contiguous history, except those at the initial and last saved epoch
+template< typename TimeType >
+void removeIntermediateHistoryEntries( utilities::ContiguousTimeHistory< TimeType, double >& history )
+{
+    while( history.size( ) > 2 )
+    {
+        history.removeEpoch( 1 );
+    }
+}
+
+//! Function to retrieve the dependent variables at a given epoch from a history stored as map (empty if not available)
+template< typename TimeType >
+Eigen::VectorXd getDependentVariablesAtEpoch(
+        const std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
+        const TimeType time )
+{
+    typename std::map< TimeType, Eigen::VectorXd >::const_iterator historyIterator = dependentVariableHistory.find( time );
+    return ( historyIterator == dependentVariableHistory.end( ) ) ? Eigen::VectorXd( ) : historyIterator->second;
+}
+
+//! Function to retrieve the dependent variables at the last saved epoch from a contiguous history (empty if not available)
+template< typename TimeType >
+Eigen::VectorXd getDependentVariablesAtEpoch(
+        const utilities::ContiguousTimeHistory< TimeType, double >& dependentVariableHistory,
+        const TimeType time )
+{
+    if( dependentVariableHistory.size( ) > 0 && dependentVariableHistory.getLastTime( ) == time )
+    {
+        return dependentVariableHistory.getValue( dependentVariableHistory.size( ) - 1 );
+    }
+    return Eigen::VectorXd( );
+}
+
+//! Function to retrieve a history of dependent variables stored as map, as a map (used for checkpointing)
+template< typename TimeType >
+std::map< TimeType, Eigen::VectorXd > getDependentVariableHistoryAsMap(
+        const std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory )
+{
+    return dependentVariableHistory;
+}
+
+//! Function to retrieve a contiguous history of dependent variables as a map (used for checkpointing)
+template< typename TimeType >
+std::map< TimeType, Eigen::VectorXd > getDependentVariableHistoryAsMap(
+        const utilities::ContiguousTimeHistory< TimeType, double >& dependentVariableHistory )
+{
+    return dependentVariableHistory.toMap( );
+}
+
+//! Function to reset a history of dependent variables stored as map from a map (used for checkpointing)
+template< typename TimeType >
+void resetDependentVariableHistoryFromMap(
+        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
+        const std::map< TimeType, Eigen::VectorXd >& dependentVariableMap )
+{
+    dependentVariableHistory = dependentVariableMap;
+}
+
+//! Function to reset a contiguous history of dependent variables from a map (used for checkpointing)
+template< typename TimeType >
+void resetDependentVariableHistoryFromMap(
+        utilities::ContiguousTimeHistory< TimeType, double >& dependentVariableHistory,
+        const std::map< TimeType, Eigen::VectorXd >& dependentVariableMap )
+{
+    dependentVariableHistory = utilities::ContiguousTimeHistory< TimeType, double >( dependentVariableMap );
+}
+
+//! Function to pass the results at a single output epoch to a list of result sinks
+/*!
+ * Function to pass the results at a single output epoch to a list of result sinks
+ * \param resultSinks Sinks to which the results are to be passed
+ * \param time Output epoch
+ * \param state State at output epoch, in propagator-specific form
+ * \param dependentVariables Dependent variables at output epoch
+ * \param stateConversionFunction Function to convert the state to the conventional form (if empty, the last column of
+ * the state is passed to the sinks directly)
+ */
+template< typename StateType, typename TimeType >
+void passEpochToResultSinks(
+        const std::vector< std::shared_ptr< PropagationResultSink > >& resultSinks,
+        const TimeType time,
+        const StateType& state,
+        const Eigen::VectorXd& dependentVariables,
+        const std::function< Eigen::VectorXd( const StateType&, const TimeType ) >& stateConversionFunction )
+{
+    Eigen::VectorXd outputState;
+    if( stateConversionFunction != nullptr )
+    {
+        outputState = stateConversionFunction( state, time );
+    }
+    else
+    {
+        outputState = state.col( state.cols( ) - 1 ).template cast< double >( );
+    }
+
+    for( unsigned int i = 0; i < resultSinks.size( ); i++ )
+    {
+        resultSinks.at( i )->processEpoch( static_cast< double >( time ), outputState, dependentVariables );
+    }
+}
+
+//! Function to add the dependent variables at a given epoch to a history stored as map
+template< typename TimeType >
+void addDependentVariablesToHistory(
+        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
+        const TimeType time,
+        const Eigen::VectorXd& dependentVariables )
+{
+    dependentVariableHistory[ time ] = dependentVariables;
+}
+
+//! Function to add the dependent variables at a given epoch to a history stored contiguously
+template< typename TimeType >
+void addDependentVariablesToHistory(
+        utilities::ContiguousTimeHistory< TimeType, double >& dependentVariableHistory,
+        const TimeType time,
+        const Eigen::VectorXd& dependentVariables )
+{
+    dependentVariableHistory.append( time, dependentVariables );
+}
+
+//! Function to evaluate the dependent variables at a given epoch directly into a history stored as map
+/*!
+ * Function to evaluate the dependent variables at a given epoch directly into a history stored as map, without creating
+ * intermediate vectors. The environment and state derivative models need to be updated to the given epoch before calling
+ * this function.
+ * \param dependentVariableHistory History of dependent variables (modified by reference)
+ * \param time Epoch at which the dependent variables are to be added
+ * \param dependentVariablesWriter Object writing the dependent variables into a preallocated vector
+ */
+template< typename TimeType >
+void writeDependentVariablesToHistory(
+        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
+        const TimeType time,
+        const DependentVariablesWriter& dependentVariablesWriter )
+{
+    Eigen::VectorXd& dependentVariables = dependentVariableHistory[ time ];
+    dependentVariables.resize( dependentVariablesWriter.getTotalSize( ) );
+    dependentVariablesWriter.writeDependentVariables( dependentVariables );
+}
+
+//! Function to evaluate the dependent variables at a given epoch directly into a history stored contiguously
+/*!
+ * Function to evaluate the dependent variables at a given epoch directly into the (preallocated) storage of a contiguous
+ * history, without creating intermediate vectors. The environment and state derivative models need to be updated to the
+ * given epoch before calling this function.
+ * \param dependentVariableHistory History of dependent variables (modified by reference)
+ * \param time Epoch at which the dependent variables are to be added
+ * \param dependentVariablesWriter Object writing the dependent variables into a preallocated vector
+ */
+template< typename TimeType >
+void writeDependentVariablesToHistory(
+        utilities::ContiguousTimeHistory< TimeType, double >& dependentVariableHistory,
+        const TimeType time,
+        const DependentVariablesWriter& dependentVariablesWriter )
+{
+    if( dependentVariableHistory.size( ) == 0 && dependentVariableHistory.getNumberOfColumns( ) == 0 )
+    {
+        dependentVariableHistory = utilities::ContiguousTimeHistory< TimeType, double >(
+                    dependentVariablesWriter.getTotalSize( ) );
+    }
+    else if( dependentVariableHistory.getNumberOfColumns( ) != dependentVariablesWriter.getTotalSize( ) )
+    {
+        throw std::runtime_error( "Error when writing dependent variables to contiguous history, size is incompatible" );
+    }
+    dependentVariablesWriter.writeDependentVariables( dependentVariableHistory.appendEpoch( time ) );
+}
+
+//! Function to evaluate the dependent variables at a given epoch, and add them to a history
+/*!
+ * Function to evaluate the dependent variables at a given epoch, and add them to a history (map or contiguous). If an
+ * object to write the dependent variables directly into the history is provided, it is used. Otherwise, the dependent
+ * variable function is used.
+ * \param dependentVariableHistory History of dependent variables (modified by reference)
+ * \param time Epoch at which the dependent variables are to be added
+ * \param dependentVariableFunction Function returning dependent variables
+ * \param dependentVariablesWriter Object writing the dependent variables into a preallocated vector (may be nullptr)
+ */
+template< typename DependentVariableHistoryType, typename TimeType >
+void computeDependentVariablesIntoHistory(
+        DependentVariableHistoryType& dependentVariableHistory,
+        const TimeType time,
+        const std::function< Eigen::VectorXd( ) >& dependentVariableFunction,
+        const std::shared_ptr< DependentVariablesWriter > dependentVariablesWriter )
+{
+    if( dependentVariablesWriter != nullptr )
+    {
+        writeDependentVariablesToHistory( dependentVariableHistory, time, *dependentVariablesWriter );
+    }
+    else
+    {
+        addDependentVariablesToHistory( dependentVariableHistory, time, dependentVariableFunction( ) );
+    }
+}
+
+//! Function to remove the dependent variables at the epoch at which the state was last saved, from a history stored as map
+/*!
+ * Function to remove the dependent variables at the epoch at which the state was last saved, from a history stored as map
+ * \param dependentVariableHistory History of dependent variables (modified by reference)
+ * \param solutionHistory History of state variables
+ * \param timeStep Last time step taken by integrator (sign indicates direction of propagation)
+ * \return True if dependent variables were removed
+ */
+template< typename StateType, typename TimeType, typename TimeStepType >
+bool removeDependentVariablesAtLastSavedEpoch(
+        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
+        const std::map< TimeType, StateType >& solutionHistory,
+        const TimeStepType timeStep )
+{
+    bool isEntryRemoved = false;
+    if( dependentVariableHistory.size( ) > 0 )
+    {
+        if( dependentVariableHistory.rbegin( )->first == solutionHistory.rbegin( )->first )
+        {
+            if( timeStep > 0 )
+            {
+                dependentVariableHistory.erase( std::prev( dependentVariableHistory.end() ) );
+            }
+            else
+            {
+                dependentVariableHistory.erase(  dependentVariableHistory.begin( ) );
+            }
+            isEntryRemoved = true;
+        }
+    }
+    return isEntryRemoved;
+}
+
+//! Function to remove the dependent variables at the epoch at which the state was last saved, from a contiguous history
+/*!
+ * Function to remove the dependent variables at the epoch at which the state was last saved, from a contiguous history
+ * (in which the epochs are stored in the order in which they were saved)
+ * \param dependentVariableHistory History of dependent variables (modified by reference)
+ * \param solutionHistory History of state variables
+ * \param timeStep Last time step taken by integrator (sign indicates direction of propagation)
+ * \return True if dependent variables were removed
+ */
+template< typename StateType, typename TimeType, typename TimeStepType >
+bool removeDependentVariablesAtLastSavedEpoch(
+        utilities::ContiguousTimeHistory< TimeType, double >& dependentVariableHistory,
+        const std::map< TimeType, StateType >& solutionHistory,
+        const TimeStepType timeStep )
+{
+    bool isEntryRemoved = false;
+    if( dependentVariableHistory.size( ) > 0 )
+    {
+        TimeType lastSavedTime = ( timeStep > 0 ) ? solutionHistory.rbegin( )->first : solutionHistory.begin( )->first;
+        if( dependentVariableHistory.getLastTime( ) == lastSavedTime )
+        {
+            dependentVariableHistory.removeLastEpoch( );
+            isEntryRemoved = true;
+        }
+    }
+    return isEntryRemoved;
+}
+
 //! Function that propagates to an exact final condition (within tolerance) for arbitrary termination condition
 /*!
  * Function that propagates to an exact final condition (within tolerance) for arbitrary termination condition.
@@ -367,17 +736,18 @@ bool getFinalStateForExactTerminationCondition(
  * \param solutionHistory History of state variables that are to be saved given as map
  * (time as key; returned by reference)
  * \param dependentVariableHistory History of dependent variables that are to be saved given as map
- * (time as key; returned by reference)
+ * (time as key) or as contiguous history (returned by reference)
  * \param currentCpuTime Current run time of propagation.
  */
-template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType,
+          typename DependentVariableHistoryType = std::map< TimeType, Eigen::VectorXd > >
 void propagateToExactTerminationCondition(
         const std::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > > integrator,
         const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
         const TimeStepType timeStep,
         const std::function< Eigen::VectorXd( ) > dependentVariableFunction,
         std::map< TimeType, StateType >& solutionHistory,
-        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
+        DependentVariableHistoryType& dependentVariableHistory,
         const double currentCpuTime )
 {
     // Turn off step size control
@@ -396,22 +766,8 @@ void propagateToExactTerminationCondition(
     {
 
         // Check if any dependent variables are saved. If so, remove last entry
-        bool recomputeDependentVariables = false;
-        if( dependentVariableHistory.size( ) > 0 )
-        {
-            if( dependentVariableHistory.rbegin( )->first == solutionHistory.rbegin( )->first )
-            {
-                if( timeStep > 0 )
-                {
-                    dependentVariableHistory.erase( std::prev( dependentVariableHistory.end() ) );
-                }
-                else
-                {
-                    dependentVariableHistory.erase(  dependentVariableHistory.begin( ) );
-                }
-                recomputeDependentVariables = true;
-            }
-        }
+        bool recomputeDependentVariables = removeDependentVariablesAtLastSavedEpoch(
+                    dependentVariableHistory, solutionHistory, timeStep );
 
         // Remove state entry last added, and enter converged final state
         if( timeStep > 0 )
@@ -429,10 +785,14 @@ void propagateToExactTerminationCondition(
         if( recomputeDependentVariables )
         {
             integrator->getStateDerivativeFunction( )( endTime, endState );
-            dependentVariableHistory[ endTime ] = dependentVariableFunction( );
+            addDependentVariablesToHistory( dependentVariableHistory, endTime, dependentVariableFunction( ) );
 
-            // Check stopping conditions to be able to save details
-            propagationTerminationCondition->checkStopCondition( endTime, currentCpuTime );
+            // Check stopping conditions to be able to save details (for hybrid conditions, these have been set when
+            // locating the events, and are not re-evaluated at the located final time)
+            if( propagationTerminationCondition->getTerminationType( ) != hybrid_stopping_condition )
+            {
+                propagationTerminationCondition->checkStopCondition( endTime, currentCpuTime );
+            }
         }
     }
     else
@@ -446,30 +806,47 @@ void propagateToExactTerminationCondition(
     integrator->setStepSizeControl( true );
 }
 
-//! Function to numerically integrate a given first order differential equation
+//! Function to numerically integrate a given first order differential equation, for a given type of dependent variable history
 /*!
  *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
- *  a single independent variable and the current state
+ *  a single independent variable and the current state, with the dependent variables saved in a history of the given type
+ *  (map with time as key, or contiguous history)
  *  \param integrator Numerical integrator used for propagation
  *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time
  *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
  *  derivative model).
- *  \param statePostProcessingFunction Function to post-process state after numerical integration (obtained from state derivative model).
+ *  \param statePostProcessingFunction Function to post-process state after a numerical integration step, with the time of the
+ *  state as second argument (obtained from state derivative model).
+ *  \param processingSettings Settings for the processing of the results (including sinks to which the results are streamed)
+ *  \param sinkStateConversionFunction Function to convert the state to the form that is passed to the result sinks
+ *  \param dependentVariablesWriter Object writing the dependent variables directly into the history (if nullptr, the
+ *  dependentVariableFunction is used)
+ *  \param continuationCheckpoint State of a previous propagation from which this propagation is to be continued, with
+ *  the results of the previous propagation in its histories, to which the new results are appended (nullptr if not
+ *  continued). Its contents are moved into this propagation.
+ *  \param finalCheckpoint State of the propagation after its final step, from which the propagation can be continued
+ *  (returned by reference, not set if nullptr). The histories of the results are not included.
  */
-template< typename SimulationResults, typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
-void integrateEquationsFromIntegrator(
+template< typename SimulationResults, typename DependentVariableHistoryType, typename StateType = Eigen::MatrixXd,
+          typename TimeType = double, typename TimeStepType = TimeType  >
+void integrateEquationsFromIntegratorWithHistoryType(
         const std::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > > integrator,
         const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
         const std::shared_ptr< SimulationResults > simulationResults,
         const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
-        const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
-        const std::shared_ptr< SingleArcPropagatorProcessingSettings > processingSettings = std::make_shared< SingleArcPropagatorProcessingSettings >( ) )
+        const std::function< void( StateType&, const TimeType ) > statePostProcessingFunction =
+                std::function< void( StateType&, const TimeType ) >( ),
+        const std::shared_ptr< SingleArcPropagatorProcessingSettings > processingSettings = std::make_shared< SingleArcPropagatorProcessingSettings >( ),
+        const std::function< Eigen::VectorXd( const StateType&, const TimeType ) > sinkStateConversionFunction = nullptr,
+        const std::shared_ptr< DependentVariablesWriter > dependentVariablesWriter = nullptr,
+        const std::shared_ptr< SingleArcPropagationCheckpoint< StateType, TimeType, TimeStepType > > continuationCheckpoint = nullptr,
+        const std::shared_ptr< SingleArcPropagationCheckpoint< StateType, TimeType, TimeStepType > > finalCheckpoint = nullptr )
 {
     int saveFrequency = 1;
 
     // Define structures that will contain with numerical results
     std::map< TimeType, StateType > solutionHistory;
-    std::map< TimeType, Eigen::VectorXd > dependentVariableHistory;
+    DependentVariableHistoryType dependentVariableHistory;
     std::map< TimeType, double > cumulativeComputationTimeHistory;
     std::shared_ptr< PropagationTerminationDetails > terminationDetails;
 
@@ -484,17 +861,33 @@ void integrateEquationsFromIntegrator(
     TimeType initialTime = currentTime;
     StateType newState = integrator->getCurrentState( );
 
+    // Retrieve sinks to which results are streamed, and whether full history is retained in memory
+    std::vector< std::shared_ptr< PropagationResultSink > > resultSinks = processingSettings->getResultSinks( );
+    bool storeResultsInMemory = processingSettings->getStoreResultsInMemory( );
+    for( unsigned int i = 0; i < resultSinks.size( ); i++ )
+    {
+        resultSinks.at( i )->startPropagation( );
+    }
+
     // Add results at initial state
     solutionHistory.clear( );
     solutionHistory[ currentTime ] = newState;
     dependentVariableHistory.clear( );
+    Eigen::VectorXd currentDependentVariables;
     if( !( dependentVariableFunction == nullptr ) )
     {
         // If dependent variables are to be used, updated state derivative model and compute
         integrator->getStateDerivativeFunction( )( currentTime, newState );
-        dependentVariableHistory[ currentTime ] = dependentVariableFunction( );
+        computeDependentVariablesIntoHistory(
+                    dependentVariableHistory, currentTime, dependentVariableFunction, dependentVariablesWriter );
+        currentDependentVariables = getDependentVariablesAtEpoch( dependentVariableHistory, currentTime );
     }
 
+    // Results at last saved epoch are passed to sinks once next epoch is saved (it may be modified by exact termination)
+    TimeType sinkPendingTime = currentTime;
+    StateType sinkPendingState = newState;
+    Eigen::VectorXd sinkPendingDependentVariables = currentDependentVariables;
+
     // Add CPU time after first saving step
     cumulativeComputationTimeHistory.clear( );
     double currentCPUTime = std::chrono::duration_cast< std::chrono::nanoseconds >(
@@ -532,6 +925,101 @@ void integrateEquationsFromIntegrator(
         stepsSinceLastPrint = 0;
     }
 
+    // Resume propagation from previous propagation or checkpoint file, if required
+    std::string resumeFromCheckpointFile = processingSettings->getResumeFromCheckpointFile( );
+    if( continuationCheckpoint != nullptr || resumeFromCheckpointFile != "" )
+    {
+        SingleArcPropagationCheckpoint< StateType, TimeType, TimeStepType > checkpoint =
+                ( continuationCheckpoint != nullptr ) ? std::move( *continuationCheckpoint ) :
+                                                        readSingleArcPropagationCheckpoint< StateType, TimeType, TimeStepType >(
+                                                            resumeFromCheckpointFile );
+        std::string checkpointName = ( continuationCheckpoint != nullptr ) ?
+                    "previous propagation" : ( "checkpoint " + resumeFromCheckpointFile );
+        if( checkpoint.integratorCheckpoint_.currentState_.rows( ) != newState.rows( ) ||
+                checkpoint.integratorCheckpoint_.currentState_.cols( ) != newState.cols( ) )
+        {
+            throw std::runtime_error( "Error when resuming propagation from " + checkpointName +
+                                      ", size of propagated state is not compatible." );
+        }
+
+        // If internal state of integrator is not available, integrator is assumed to be created from checkpoint state
+        if( checkpoint.isIntegratorStateRetained_ )
+        {
+            integrator->resetFromCheckpoint( checkpoint.integratorCheckpoint_ );
+        }
+        currentTime = integrator->getCurrentIndependentVariable( );
+        initialTime = checkpoint.initialTime_;
+        newState = integrator->getCurrentState( );
+        timeStep = integrator->getNextStepSize( );
+        previousTime = currentTime;
+
+        solutionHistory = checkpoint.solutionHistory_;
+        resetDependentVariableHistoryFromMap( dependentVariableHistory, checkpoint.dependentVariableHistory_ );
+        cumulativeComputationTimeHistory = checkpoint.cumulativeComputationTimeHistory_;
+
+        stepsSinceLastSave = checkpoint.stepsSinceLastSave_;
+        timeOfLastSave = checkpoint.timeOfLastSave_;
+        stepsSinceLastPrint = checkpoint.stepsSinceLastPrint_;
+        timeOfLastPrint = checkpoint.timeOfLastPrint_;
+
+        sinkPendingTime = checkpoint.sinkPendingTime_;
+        sinkPendingState = checkpoint.sinkPendingState_;
+        sinkPendingDependentVariables = checkpoint.sinkPendingDependentVariables_;
+
+        // Offset clock, so that CPU time (and CPU time termination condition) includes time before checkpoint
+        currentCPUTime = checkpoint.elapsedCpuTime_;
+        initialClockTime -= std::chrono::duration_cast< std::chrono::steady_clock::duration >(
+                    std::chrono::duration< double >( currentCPUTime ) );
+    }
+
+    // Function to save the results (state, dependent variables and results passed to sinks) at a given epoch
+    auto saveResultsAtEpoch = [ & ]( const TimeType saveTime, const StateType& saveState )
+    {
+        solutionHistory[ saveTime ] = saveState;
+
+        if( !( dependentVariableFunction == nullptr ) )
+        {
+            integrator->getStateDerivativeFunction( )( saveTime, saveState );
+            computeDependentVariablesIntoHistory(
+                        dependentVariableHistory, saveTime, dependentVariableFunction, dependentVariablesWriter );
+            if( resultSinks.size( ) > 0 )
+            {
+                currentDependentVariables = getDependentVariablesAtEpoch( dependentVariableHistory, saveTime );
+            }
+        }
+
+        if( resultSinks.size( ) > 0 )
+        {
+            passEpochToResultSinks( resultSinks, sinkPendingTime, sinkPendingState,
+                                    sinkPendingDependentVariables, sinkStateConversionFunction );
+            sinkPendingTime = saveTime;
+            sinkPendingState = saveState;
+            sinkPendingDependentVariables = currentDependentVariables;
+        }
+
+        if( !storeResultsInMemory )
+        {
+            removeIntermediateHistoryEntries( solutionHistory );
+            removeIntermediateHistoryEntries( dependentVariableHistory );
+        }
+        timeOfLastSave = saveTime;
+        stepsSinceLastSave = 0;
+    };
+
+    // Retrieve fixed interval at which results are saved (if any), and direction of propagation
+    double fixedSaveInterval = processingSettings->getFixedResultsSaveInterval( );
+    bool useFixedSaveInterval = !std::isnan( fixedSaveInterval );
+    double propagationDirection = ( timeStep > 0 ) ? 1.0 : -1.0;
+
+    // Initialize statistics of the integration steps
+    PropagationStepStatistics stepStatistics;
+    int initialNumberOfRejectedSteps = integrator->getNumberOfRejectedSteps( );
+
+    // Retrieve settings for writing checkpoints
+    std::string checkpointFile = processingSettings->getCheckpointFile( );
+    int numberOfStepsBetweenCheckpoints = processingSettings->getNumberOfStepsBetweenCheckpoints( );
+    int stepsSinceLastCheckpoint = 0;
+
     // Perform numerical integration steps until end time reached.
     do
     {
@@ -565,7 +1053,7 @@ void integrateEquationsFromIntegrator(
                 newState = integrator->performIntegrationStep( timeStep );
                 if( statePostProcessingFunction != nullptr )
                 {
-                    statePostProcessingFunction( newState );
+                    statePostProcessingFunction( newState, integrator->getCurrentIndependentVariable( ) );
                     integrator->modifyCurrentState( newState, true );
                 }
 
@@ -584,20 +1072,38 @@ void integrateEquationsFromIntegrator(
                 // Update epoch and step-size
                 currentTime = integrator->getCurrentIndependentVariable( );
                 timeStep = integrator->getNextStepSize( );
+                stepStatistics.addAcceptedStep( static_cast< double >( currentTime - previousTime ) );
 
-                // Save integration result in map
-                if( processingSettings->saveCurrentStep( stepsSinceLastSave, std::fabs(
-                        static_cast< double >( currentTime ) - timeOfLastSave ) ) )
+                // Save integration result in map, at all output epochs (initialTime + i * fixedSaveInterval) in the last
+                // step, or at the current step
+                if( useFixedSaveInterval )
                 {
-                    solutionHistory[ currentTime ] = newState;
-
-                    if( !( dependentVariableFunction == nullptr ) )
+                    int firstOutputIndex = static_cast< int >( std::floor(
+                            propagationDirection * static_cast< double >( previousTime - initialTime ) / fixedSaveInterval ) ) + 1;
+                    int lastOutputIndex = static_cast< int >( std::floor(
+                            propagationDirection * static_cast< double >( currentTime - initialTime ) / fixedSaveInterval ) );
+                    for( int outputIndex = firstOutputIndex; outputIndex <= lastOutputIndex; outputIndex++ )
                     {
-                        integrator->getStateDerivativeFunction( )( currentTime, newState );
-                        dependentVariableHistory[ currentTime ] = dependentVariableFunction( );
+                        TimeType outputTime = initialTime + propagationDirection * static_cast< double >( outputIndex ) * fixedSaveInterval;
+                        if( outputTime == currentTime )
+                        {
+                            saveResultsAtEpoch( currentTime, newState );
+                        }
+                        else if( integrator->isDenseOutputAvailable( ) )
+                        {
+                            saveResultsAtEpoch( outputTime, integrator->getDenseOutputState( outputTime ) );
+                        }
+                        else
+                        {
+                            throw std::runtime_error( "Error when saving results at fixed interval, no dense output available "
+                                                      "from integrator (state may have been modified after integration step)" );
+                        }
                     }
-                    timeOfLastSave = currentTime;
-                    stepsSinceLastSave = 0;
+                }
+                else if( processingSettings->saveCurrentStep( stepsSinceLastSave, std::fabs(
+                        static_cast< double >( currentTime ) - timeOfLastSave ) ) )
+                {
+                    saveResultsAtEpoch( currentTime, newState );
                 }
 
                 stepsSinceLastPrint++;
@@ -617,9 +1123,19 @@ void integrateEquationsFromIntegrator(
             currentCPUTime = std::chrono::duration_cast< std::chrono::nanoseconds >(
                         std::chrono::steady_clock::now( ) - initialClockTime ).count( ) * 1.0e-9;
             cumulativeComputationTimeHistory[ currentTime ] = currentCPUTime;
+            if( !storeResultsInMemory )
+            {
+                removeIntermediateHistoryEntries( cumulativeComputationTimeHistory );
+            }
 
             if( propagationTerminationCondition->checkStopCondition( static_cast< double >( currentTime ), currentCPUTime ) )
             {
+                // Save results at final step when saving at fixed interval (final step is otherwise not saved, in general)
+                if( useFixedSaveInterval && solutionHistory.count( currentTime ) == 0 )
+                {
+                    saveResultsAtEpoch( currentTime, newState );
+                }
+
                 // Propagate to the exact termination conditions
                 if( propagationTerminationCondition->iterateToExactTermination( ) )
                 {
@@ -651,6 +1167,28 @@ void integrateEquationsFromIntegrator(
 
                 breakPropagation = true;
             }
+
+            // Write checkpoint from which propagation can be resumed, if required
+            if( !breakPropagation && checkpointFile != "" &&
+                    ++stepsSinceLastCheckpoint >= numberOfStepsBetweenCheckpoints )
+            {
+                SingleArcPropagationCheckpoint< StateType, TimeType, TimeStepType > checkpoint;
+                checkpoint.integratorCheckpoint_ = integrator->getCheckpoint( );
+                checkpoint.initialTime_ = initialTime;
+                checkpoint.elapsedCpuTime_ = currentCPUTime;
+                checkpoint.stepsSinceLastSave_ = stepsSinceLastSave;
+                checkpoint.timeOfLastSave_ = timeOfLastSave;
+                checkpoint.stepsSinceLastPrint_ = stepsSinceLastPrint;
+                checkpoint.timeOfLastPrint_ = timeOfLastPrint;
+                checkpoint.sinkPendingTime_ = sinkPendingTime;
+                checkpoint.sinkPendingState_ = sinkPendingState;
+                checkpoint.sinkPendingDependentVariables_ = sinkPendingDependentVariables;
+                checkpoint.solutionHistory_ = solutionHistory;
+                checkpoint.dependentVariableHistory_ = getDependentVariableHistoryAsMap( dependentVariableHistory );
+                checkpoint.cumulativeComputationTimeHistory_ = cumulativeComputationTimeHistory;
+                writeSingleArcPropagationCheckpoint( checkpoint, checkpointFile );
+                stepsSinceLastCheckpoint = 0;
+            }
         }
         catch( const std::exception& caughtException )
         {
@@ -664,6 +1202,20 @@ void integrateEquationsFromIntegrator(
     }
     while( !breakPropagation );
 
+    // Pass results at final epoch (as retained in history) to sinks
+    if( resultSinks.size( ) > 0 )
+    {
+        typename std::map< TimeType, StateType >::iterator finalStateIterator =
+                ( timeStep > 0 ) ? std::prev( solutionHistory.end( ) ) : solutionHistory.begin( );
+        passEpochToResultSinks( resultSinks, finalStateIterator->first, finalStateIterator->second,
+                                getDependentVariablesAtEpoch( dependentVariableHistory, finalStateIterator->first ),
+                                sinkStateConversionFunction );
+        for( unsigned int i = 0; i < resultSinks.size( ); i++ )
+        {
+            resultSinks.at( i )->finalizePropagation( );
+        }
+    }
+
     if( printInitialAndFinalCondition )
     {
         std::cout << "PRINTING FINAL CONDITIONS"<<std::endl;
@@ -682,8 +1234,98 @@ void integrateEquationsFromIntegrator(
     }
 
 
+    // Retrieve state from which propagation can be continued, if required
+    if( finalCheckpoint != nullptr )
+    {
+        try
+        {
+            finalCheckpoint->integratorCheckpoint_ = integrator->getCheckpoint( );
+            finalCheckpoint->isIntegratorStateRetained_ = true;
+        }
+        catch( const std::runtime_error& )
+        {
+            // Retain only current epoch and state, if integrator does not support checkpointing
+            finalCheckpoint->integratorCheckpoint_ =
+                    numerical_integrators::NumericalIntegratorCheckpoint< TimeType, StateType, StateType, TimeStepType >( );
+            finalCheckpoint->integratorCheckpoint_.currentIndependentVariable_ = integrator->getCurrentIndependentVariable( );
+            finalCheckpoint->integratorCheckpoint_.currentState_ = integrator->getCurrentState( );
+            finalCheckpoint->integratorCheckpoint_.stepSize_ = timeStep;
+            finalCheckpoint->isIntegratorStateRetained_ = false;
+        }
+        finalCheckpoint->initialTime_ = initialTime;
+        finalCheckpoint->elapsedCpuTime_ = currentCPUTime;
+        finalCheckpoint->stepsSinceLastSave_ = stepsSinceLastSave;
+        finalCheckpoint->timeOfLastSave_ = timeOfLastSave;
+        finalCheckpoint->stepsSinceLastPrint_ = stepsSinceLastPrint;
+        finalCheckpoint->timeOfLastPrint_ = timeOfLastPrint;
+
+        // Results at final saved epoch are passed to sinks again if the propagation is continued
+        typename std::map< TimeType, StateType >::iterator finalStateIterator =
+                ( timeStep > 0 ) ? std::prev( solutionHistory.end( ) ) : solutionHistory.begin( );
+        finalCheckpoint->sinkPendingTime_ = finalStateIterator->first;
+        finalCheckpoint->sinkPendingState_ = finalStateIterator->second;
+        finalCheckpoint->sinkPendingDependentVariables_ = getDependentVariablesAtEpoch(
+                    dependentVariableHistory, finalStateIterator->first );
+        finalCheckpoint->solutionHistory_.clear( );
+        finalCheckpoint->dependentVariableHistory_.clear( );
+        finalCheckpoint->cumulativeComputationTimeHistory_.clear( );
+    }
+
     simulationResults->reset( solutionHistory, dependentVariableHistory, cumulativeComputationTimeHistory,
                               std::map<TimeType, unsigned int>( ), propagationTerminationReason );
+
+    stepStatistics.numberOfRejectedSteps_ = integrator->getNumberOfRejectedSteps( ) - initialNumberOfRejectedSteps;
+    simulationResults->setStepStatistics( stepStatistics );
+}
+
+//! Function to numerically integrate a given first order differential equation
+/*!
+ *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
+ *  a single independent variable and the current state. If contiguous result storage is requested in the processing
+ *  settings, the dependent variables are written directly into contiguous memory during the propagation.
+ *  \param integrator Numerical integrator used for propagation
+ *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time
+ *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
+ *  derivative model).
+ *  \param statePostProcessingFunction Function to post-process state after numerical integration (obtained from state derivative model).
+ *  \param processingSettings Settings for the processing of the results (including sinks to which the results are streamed)
+ *  \param sinkStateConversionFunction Function to convert the state to the form that is passed to the result sinks
+ *  \param dependentVariablesWriter Object writing the dependent variables directly into the history (if nullptr, the
+ *  dependentVariableFunction is used)
+ *  \param continuationCheckpoint State of a previous propagation from which this propagation is to be continued (see
+ *  integrateEquationsFromIntegratorWithHistoryType; nullptr if not continued)
+ *  \param finalCheckpoint State of the propagation after its final step (returned by reference, not set if nullptr)
+ */
+template< typename SimulationResults, typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
+void integrateEquationsFromIntegrator(
+        const std::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > > integrator,
+        const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
+        const std::shared_ptr< SimulationResults > simulationResults,
+        const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
+        const std::function< void( StateType&, const TimeType ) > statePostProcessingFunction =
+                std::function< void( StateType&, const TimeType ) >( ),
+        const std::shared_ptr< SingleArcPropagatorProcessingSettings > processingSettings = std::make_shared< SingleArcPropagatorProcessingSettings >( ),
+        const std::function< Eigen::VectorXd( const StateType&, const TimeType ) > sinkStateConversionFunction = nullptr,
+        const std::shared_ptr< DependentVariablesWriter > dependentVariablesWriter = nullptr,
+        const std::shared_ptr< SingleArcPropagationCheckpoint< StateType, TimeType, TimeStepType > > continuationCheckpoint = nullptr,
+        const std::shared_ptr< SingleArcPropagationCheckpoint< StateType, TimeType, TimeStepType > > finalCheckpoint = nullptr )
+{
+    if( processingSettings->getUseContiguousResultStorage( ) )
+    {
+        integrateEquationsFromIntegratorWithHistoryType<
+                SimulationResults, utilities::ContiguousTimeHistory< TimeType, double >, StateType, TimeType, TimeStepType >(
+                    integrator, propagationTerminationCondition, simulationResults, dependentVariableFunction,
+                    statePostProcessingFunction, processingSettings, sinkStateConversionFunction, dependentVariablesWriter,
+                    continuationCheckpoint, finalCheckpoint );
+    }
+    else
+    {
+        integrateEquationsFromIntegratorWithHistoryType<
+                SimulationResults, std::map< TimeType, Eigen::VectorXd >, StateType, TimeType, TimeStepType >(
+                    integrator, propagationTerminationCondition, simulationResults, dependentVariableFunction,
+                    statePostProcessingFunction, processingSettings, sinkStateConversionFunction, dependentVariablesWriter,
+                    continuationCheckpoint, finalCheckpoint );
+    }
 }
 
 
@@ -706,6 +1348,12 @@ void integrateEquationsFromIntegrator(
      *  \param statePrintInterval Frequency with which to print progress to console (nan = never).
      *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
      *  By default now(), i.e. the moment at which this function is called.
+     *  \param dependentVariablesWriter Object writing the dependent variables directly into the history (if nullptr, the
+     *  dependentVariableFunction is used)
+     *  \param continuationCheckpoint State of a previous propagation from which this propagation is to be continued (see
+     *  integrateEquationsFromIntegratorWithHistoryType; nullptr if not continued). The initialState and initialTime
+     *  should be the current state and epoch of its integrator.
+     *  \param finalCheckpoint State of the propagation after its final step (returned by reference, not set if nullptr)
      *  \return Event that triggered the termination of the propagation
      */
     template< typename SimulationResults, typename StateType, typename TimeType = double >
@@ -717,8 +1365,15 @@ void integrateEquationsFromIntegrator(
             const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
             std::shared_ptr< SimulationResults > simulationResults,
             const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
-            const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
-            const std::shared_ptr< SingleArcPropagatorProcessingSettings > processingSettings = std::make_shared< SingleArcPropagatorProcessingSettings >( ) )
+            const std::function< void( StateType&, const TimeType ) > statePostProcessingFunction =
+                std::function< void( StateType&, const TimeType ) >( ),
+            const std::shared_ptr< SingleArcPropagatorProcessingSettings > processingSettings = std::make_shared< SingleArcPropagatorProcessingSettings >( ),
+            const std::function< Eigen::VectorXd( const StateType&, const TimeType ) > sinkStateConversionFunction = nullptr,
+            const std::shared_ptr< DependentVariablesWriter > dependentVariablesWriter = nullptr,
+            const std::shared_ptr< SingleArcPropagationCheckpoint<
+            StateType, TimeType, typename scalar_type< TimeType >::value_type > > continuationCheckpoint = nullptr,
+            const std::shared_ptr< SingleArcPropagationCheckpoint<
+            StateType, TimeType, typename scalar_type< TimeType >::value_type > > finalCheckpoint = nullptr )
     {
         std::function< bool( const double, const double ) > stopPropagationFunction =
                 std::bind( &PropagationTerminationCondition::checkStopCondition, propagationTerminationCondition, std::placeholders::_1, std::placeholders::_2 );
@@ -739,7 +1394,11 @@ void integrateEquationsFromIntegrator(
                     simulationResults,
                     dependentVariableFunction,
                     statePostProcessingFunction,
-                    processingSettings );
+                    processingSettings,
+                    sinkStateConversionFunction,
+                    dependentVariablesWriter,
+                    continuationCheckpoint,
+                    finalCheckpoint );
     }
 
 
@@ -62,7 +62,7 @@ public:
             const TimeType time, const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& stateOfSystemToBeIntegrated,
             Eigen::Block< Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > > stateDerivative )
     {
-        stateDerivative.setZero( );
+        // State derivative is set to zero by sumStateDerivativeContributions
         this->sumStateDerivativeContributions( stateOfSystemToBeIntegrated, stateDerivative, true );
     }
 
@@ -101,6 +101,25 @@ public:
         currentCartesianLocalSoluton = internalSolution;
     }
 
+    //! Function to convert a history of propagator-specific states to the conventional form in a single batch.
+    /*!
+     * Function to convert a history of propagator-specific states to the conventional form in a single batch. For the
+     * Cowell propagator, the two are equivalent, and this function copies the input states.
+     * \param internalSolutions States in propagator-specific form, one epoch per column
+     * \param outputSolutions States (internalSolutions), converted to the 'conventional form', one epoch per column
+     * (returned by reference)
+     * \param numberOfThreads Maximum number of threads over which the conversion is distributed (not used in this class)
+     * \return True (batch conversion is supported)
+     */
+    bool convertToOutputSolutionBatch(
+            const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& internalSolutions,
+            Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& outputSolutions,
+            const int numberOfThreads )
+    {
+        outputSolutions = internalSolutions;
+        return true;
+    }
+
 };
 
 extern template class NBodyCowellStateDerivative< double, double >;
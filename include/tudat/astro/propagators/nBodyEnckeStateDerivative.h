@@ -11,6 +11,8 @@
 #ifndef TUDAT_NBODYENCKESTATEDERIVATIVE_H
 #define TUDAT_NBODYENCKESTATEDERIVATIVE_H
 
+#include <map>
+
 #include "tudat/astro/basic_astro/orbitalElementConversions.h"
 #include "tudat/astro/basic_astro/keplerPropagator.h"
 
@@ -40,11 +42,228 @@ StateScalarType calculateEnckeQFunction( const StateScalarType qValue )
     return mathematical_constants::getFloatingInteger< StateScalarType >( 1 ) - 1.0 / ( powerTerm * std::sqrt( powerTerm ) );
 }
 
+//! Class to compute the Cartesian state along a reference Kepler orbit, as used by the Encke propagator
+/*!
+ *  Class to compute the Cartesian state along a reference Kepler orbit, as used by the Encke propagator. For elliptical
+ *  orbits, all quantities that are constant along the orbit (mean motion, perifocal unit vectors, etc.) are computed
+ *  once, and Kepler's equation is solved by a Newton iteration that is warm-started from the solution of the previous
+ *  request (typically the previous integrator stage), which requires one or two iterations. For non-elliptical orbits,
+ *  the general Kepler propagator is used.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class EnckeReferenceOrbit
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param keplerElements Kepler elements of the reference orbit, valid at referenceTime.
+     *  \param referenceTime Time at which keplerElements are valid.
+     *  \param gravitationalParameter Gravitational parameter of the central body.
+     */
+    EnckeReferenceOrbit( const Eigen::Matrix< StateScalarType, 6, 1 >& keplerElements,
+                         const TimeType& referenceTime,
+                         const StateScalarType gravitationalParameter ):
+        keplerElements_( keplerElements ), referenceTime_( referenceTime )
+    {
+        resetGravitationalParameter( gravitationalParameter );
+    }
+
+    //! Function to reset the gravitational parameter of the central body, and recompute the orbit constants
+    /*!
+     *  Function to reset the gravitational parameter of the central body, and recompute the orbit constants
+     *  \param gravitationalParameter Gravitational parameter of the central body.
+     */
+    void resetGravitationalParameter( const StateScalarType gravitationalParameter )
+    {
+        using namespace orbital_element_conversions;
+
+        gravitationalParameter_ = gravitationalParameter;
+        eccentricity_ = keplerElements_( eccentricityIndex );
+        isOrbitElliptical_ = ( eccentricity_ >= mathematical_constants::getFloatingInteger< StateScalarType >( 0 ) &&
+                               eccentricity_ < mathematical_constants::getFloatingInteger< StateScalarType >( 1 ) );
+
+        if( isOrbitElliptical_ )
+        {
+            semiMajorAxis_ = keplerElements_( semiMajorAxisIndex );
+            eccentricityFactor_ = std::sqrt( mathematical_constants::getFloatingInteger< StateScalarType >( 1 ) -
+                                             eccentricity_ * eccentricity_ );
+            meanMotion_ = std::sqrt( gravitationalParameter_ / ( semiMajorAxis_ * semiMajorAxis_ * semiMajorAxis_ ) );
+            velocityFactor_ = std::sqrt( gravitationalParameter_ * semiMajorAxis_ );
+            referenceMeanAnomaly_ = convertEllipticalEccentricAnomalyToMeanAnomaly< StateScalarType >(
+                        convertTrueAnomalyToEllipticalEccentricAnomaly< StateScalarType >(
+                            keplerElements_( trueAnomalyIndex ), eccentricity_ ), eccentricity_ );
+
+            // Compute unit vectors towards pericenter (P) and along semi-latus rectum (Q)
+            const StateScalarType cosineOfArgumentOfPeriapsis = std::cos( keplerElements_( argumentOfPeriapsisIndex ) );
+            const StateScalarType sineOfArgumentOfPeriapsis = std::sin( keplerElements_( argumentOfPeriapsisIndex ) );
+            const StateScalarType cosineOfAscendingNode = std::cos( keplerElements_( longitudeOfAscendingNodeIndex ) );
+            const StateScalarType sineOfAscendingNode = std::sin( keplerElements_( longitudeOfAscendingNodeIndex ) );
+            const StateScalarType cosineOfInclination = std::cos( keplerElements_( inclinationIndex ) );
+            const StateScalarType sineOfInclination = std::sin( keplerElements_( inclinationIndex ) );
+
+            pericenterUnitVector_ << cosineOfAscendingNode * cosineOfArgumentOfPeriapsis -
+                    sineOfAscendingNode * sineOfArgumentOfPeriapsis * cosineOfInclination,
+                    sineOfAscendingNode * cosineOfArgumentOfPeriapsis +
+                    cosineOfAscendingNode * sineOfArgumentOfPeriapsis * cosineOfInclination,
+                    sineOfArgumentOfPeriapsis * sineOfInclination;
+            semiLatusRectumUnitVector_ << -cosineOfAscendingNode * sineOfArgumentOfPeriapsis -
+                    sineOfAscendingNode * cosineOfArgumentOfPeriapsis * cosineOfInclination,
+                    -sineOfAscendingNode * sineOfArgumentOfPeriapsis +
+                    cosineOfAscendingNode * cosineOfArgumentOfPeriapsis * cosineOfInclination,
+                    cosineOfArgumentOfPeriapsis * sineOfInclination;
+        }
+
+        previousMeanAnomaly_ = TUDAT_NAN;
+        previousEccentricAnomaly_ = TUDAT_NAN;
+    }
+
+    //! Function to compute the Cartesian state along the reference orbit at a given time
+    /*!
+     *  Function to compute the Cartesian state along the reference orbit at a given time
+     *  \param time Time at which the state is to be computed
+     *  \param rootFinder Root finder used to propagate non-elliptical orbits
+     *  \param cartesianState Cartesian state along the reference orbit at the given time (returned by reference)
+     */
+    void computeCartesianState(
+            const TimeType time,
+            const std::shared_ptr< root_finders::RootFinder< StateScalarType > > rootFinder,
+            Eigen::Matrix< StateScalarType, 6, 1 >& cartesianState )
+    {
+        if( !isOrbitElliptical_ )
+        {
+            cartesianState = orbital_element_conversions::convertKeplerianToCartesianElements< StateScalarType >(
+                        orbital_element_conversions::propagateKeplerOrbit< StateScalarType >(
+                            keplerElements_, static_cast< StateScalarType >( time - referenceTime_ ),
+                            gravitationalParameter_, rootFinder ), gravitationalParameter_ );
+            return;
+        }
+
+        const StateScalarType eccentricAnomaly = computeEccentricAnomaly( time );
+        const StateScalarType cosineOfEccentricAnomaly = std::cos( eccentricAnomaly );
+        const StateScalarType sineOfEccentricAnomaly = std::sin( eccentricAnomaly );
+        const StateScalarType radius = semiMajorAxis_ * (
+                    mathematical_constants::getFloatingInteger< StateScalarType >( 1 ) -
+                    eccentricity_ * cosineOfEccentricAnomaly );
+
+        cartesianState.template segment< 3 >( 0 ) =
+                semiMajorAxis_ * ( ( cosineOfEccentricAnomaly - eccentricity_ ) * pericenterUnitVector_ +
+                                   eccentricityFactor_ * sineOfEccentricAnomaly * semiLatusRectumUnitVector_ );
+        cartesianState.template segment< 3 >( 3 ) =
+                velocityFactor_ / radius * ( -sineOfEccentricAnomaly * pericenterUnitVector_ +
+                                             eccentricityFactor_ * cosineOfEccentricAnomaly * semiLatusRectumUnitVector_ );
+    }
+
+    //! Function to retrieve the gravitational parameter of the central body used for the orbit
+    StateScalarType getGravitationalParameter( )
+    {
+        return gravitationalParameter_;
+    }
+
+private:
+
+    //! Function to compute the eccentric anomaly at a given time, warm-started from the previous request
+    StateScalarType computeEccentricAnomaly( const TimeType time )
+    {
+        const StateScalarType twoPi = mathematical_constants::getFloatingInteger< StateScalarType >( 2 ) *
+                mathematical_constants::getPi< StateScalarType >( );
+
+        // Compute mean anomaly in [-pi, pi)
+        StateScalarType meanAnomaly = referenceMeanAnomaly_ +
+                meanMotion_ * static_cast< StateScalarType >( time - referenceTime_ );
+        meanAnomaly -= twoPi * std::floor( meanAnomaly / twoPi + 0.5 );
+
+        // Set initial guess from previous solution (first-order expansion), or from mean anomaly
+        StateScalarType eccentricAnomaly;
+        if( previousEccentricAnomaly_ == previousEccentricAnomaly_ )
+        {
+            StateScalarType meanAnomalyChange = meanAnomaly - previousMeanAnomaly_;
+            meanAnomalyChange -= twoPi * std::floor( meanAnomalyChange / twoPi + 0.5 );
+            eccentricAnomaly = previousEccentricAnomaly_ + meanAnomalyChange /
+                    ( mathematical_constants::getFloatingInteger< StateScalarType >( 1 ) -
+                      eccentricity_ * std::cos( previousEccentricAnomaly_ ) );
+        }
+        else
+        {
+            eccentricAnomaly = meanAnomaly + eccentricity_ * std::sin( meanAnomaly );
+        }
+
+        // Solve Kepler's equation using Newton-Raphson iterations
+        const StateScalarType tolerance = 5.0 * std::numeric_limits< StateScalarType >::epsilon( ) *
+                ( mathematical_constants::getFloatingInteger< StateScalarType >( 1 ) + std::fabs( eccentricAnomaly ) );
+        for( int i = 0; i < 50; i++ )
+        {
+            const StateScalarType correction =
+                    ( eccentricAnomaly - eccentricity_ * std::sin( eccentricAnomaly ) - meanAnomaly ) /
+                    ( mathematical_constants::getFloatingInteger< StateScalarType >( 1 ) -
+                      eccentricity_ * std::cos( eccentricAnomaly ) );
+            eccentricAnomaly -= correction;
+            if( std::fabs( correction ) <= tolerance )
+            {
+                break;
+            }
+        }
+
+        previousMeanAnomaly_ = meanAnomaly;
+        previousEccentricAnomaly_ = eccentricAnomaly;
+        return eccentricAnomaly;
+    }
+
+    //! Kepler elements of the reference orbit, valid at referenceTime_.
+    Eigen::Matrix< StateScalarType, 6, 1 > keplerElements_;
+
+    //! Time at which keplerElements_ are valid.
+    TimeType referenceTime_;
+
+    //! Gravitational parameter of the central body.
+    StateScalarType gravitationalParameter_;
+
+    //! Boolean denoting whether the orbit is elliptical (if false, the general Kepler propagator is used).
+    bool isOrbitElliptical_;
+
+    //! Eccentricity of the orbit.
+    StateScalarType eccentricity_;
+
+    //! Semi-major axis of the (elliptical) orbit.
+    StateScalarType semiMajorAxis_;
+
+    //! Square root of ( 1 - e^2 ).
+    StateScalarType eccentricityFactor_;
+
+    //! Mean motion of the (elliptical) orbit.
+    StateScalarType meanMotion_;
+
+    //! Square root of the product of gravitational parameter and semi-major axis.
+    StateScalarType velocityFactor_;
+
+    //! Mean anomaly at referenceTime_.
+    StateScalarType referenceMeanAnomaly_;
+
+    //! Unit vector towards the pericenter.
+    Eigen::Matrix< StateScalarType, 3, 1 > pericenterUnitVector_;
+
+    //! Unit vector along the semi-latus rectum (perpendicular to pericenterUnitVector_ in the orbital plane).
+    Eigen::Matrix< StateScalarType, 3, 1 > semiLatusRectumUnitVector_;
+
+    //! Mean anomaly at the previous request (in [-pi, pi)).
+    StateScalarType previousMeanAnomaly_;
+
+    //! Eccentric anomaly at the previous request, used as initial guess for the next request (NaN if not set).
+    StateScalarType previousEccentricAnomaly_;
+
+};
+
 //! Class for computing the state derivative of translational motion of N bodies, using an Encke propagator.
 /*!
  * Class for computing the state derivative of translational motion of N bodies, using an Encke propagator.
  * The Encke propagator propagates the Cartesian deviation from an ideal (pre-defined) Keplerian orbit.
  * See e.g. Wakker, astro II for mathematical details.
+ * When the position deviation of a body exceeds a given fraction of its distance to the central body, the reference orbit
+ * is rectified after the integration step: a new reference orbit is started from the osculating orbit at the current
+ * epoch, and the deviation is reset to zero. The reference orbits used during the propagation are retained (per epoch at
+ * which they were started), so that the propagated states can be converted to Cartesian states after the propagation.
+ * Rectification is not applied when the variational equations are propagated.
  */
 template< typename StateScalarType = double, typename TimeType = double >
 class NBodyEnckeStateDerivative: public NBodyStateDerivative< StateScalarType, TimeType >
@@ -66,19 +285,26 @@ public:
      *  \param bodiesToIntegrate List of names of bodies that are to be integrated numerically.
      *  \param initialKeplerElements Kepler elements of bodiesToIntegrate, valid at initialTime.
      *  \param initialTime Time at which the initialKeplerElements provide the orbital state.
+     *  \param rectificationThreshold Ratio of position deviation and distance to central body above which the reference
+     *  orbit is rectified (rectification is disabled if this value is not positive).
      */
     NBodyEnckeStateDerivative( const basic_astrodynamics::AccelerationMap& accelerationModelsPerBody,
                                const std::shared_ptr< CentralBodyData< StateScalarType, TimeType > > centralBodyData,
                                const std::vector< std::string >& bodiesToIntegrate,
                                const std::vector< Eigen::Matrix< StateScalarType, 6, 1 > >& initialKeplerElements,
-                               const TimeType& initialTime ):
+                               const TimeType& initialTime,
+                               const double rectificationThreshold = 0.01 ):
         NBodyStateDerivative< StateScalarType, TimeType >(
             accelerationModelsPerBody, centralBodyData, encke, bodiesToIntegrate, true ),
         initialKeplerElements_( initialKeplerElements ),
         initialTime_( initialTime ),
+        rectificationThreshold_( rectificationThreshold ),
+        numberOfRectifications_( 0 ),
         currentKeplerOrbitTime_( TUDAT_NAN )
     {
         currentKeplerianOrbitCartesianState_.resize( bodiesToIntegrate.size( ) );
+        forwardRectifiedReferenceOrbits_.resize( bodiesToIntegrate.size( ) );
+        backwardRectifiedReferenceOrbits_.resize( bodiesToIntegrate.size( ) );
 
         // Remove central gravitational acceleration from list of accelerations that is to be evaluated
         centralBodyGravitationalParameters_ =
@@ -92,6 +318,13 @@ public:
                         TUDAT_NAN, 5.0 * std::numeric_limits< StateScalarType >::epsilon( ),
                         TUDAT_NAN, 50, root_finders::accept_result ) );
 
+        // Create reference orbits at initial time
+        for( unsigned int i = 0; i < bodiesToIntegrate.size( ); i++ )
+        {
+            initialReferenceOrbits_.push_back( std::make_shared< EnckeReferenceOrbit< StateScalarType, TimeType > >(
+                                                   initialKeplerElements_.at( i ), initialTime_,
+                                                   static_cast< StateScalarType >( centralBodyGravitationalParameters_.at( i )( ) ) ) );
+        }
 
         this->createAccelerationModelList( );
     }
@@ -191,6 +424,91 @@ public:
 
     }
 
+    using SingleStateTypeDerivative< StateScalarType, TimeType >::postProcessState;
+
+    //! Function to rectify the reference orbits, if the deviation from them has become too large.
+    /*!
+     * Function to rectify the reference orbits, if the deviation from them has become too large. For each body for which
+     * the position deviation exceeds rectificationThreshold_ times the reference orbit radius, a new reference orbit is
+     * started at the current time from the osculating orbit, and the Encke state is reset accordingly (to zero, up to
+     * rounding errors).
+     * \param unprocessedState Encke state after the integration step, modified by this function if rectified.
+     * \param currentTime Time at which the state is valid.
+     */
+    void postProcessState( Eigen::Block< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > unprocessedState,
+                           const TimeType currentTime )
+    {
+        if( !( currentTime > initialTime_ ) && !( currentTime < initialTime_ ) )
+        {
+            return;
+        }
+
+        calculateKeplerTrajectoryCartesianStates( currentTime );
+        for( unsigned int i = 0; i < this->bodiesToBeIntegratedNumerically_.size( ); i++ )
+        {
+            if( unprocessedState.template block< 3, 1 >( i * 6, 0 ).norm( ) >
+                    static_cast< StateScalarType >( rectificationThreshold_ ) *
+                    currentKeplerianOrbitCartesianState_[ i ].template segment< 3 >( 0 ).norm( ) )
+            {
+                // Create new reference orbit from osculating elements at current time
+                Eigen::Matrix< StateScalarType, 6, 1 > cartesianState =
+                        currentKeplerianOrbitCartesianState_[ i ] + unprocessedState.template block< 6, 1 >( i * 6, 0 );
+                StateScalarType gravitationalParameter =
+                        static_cast< StateScalarType >( centralBodyGravitationalParameters_.at( i )( ) );
+                std::shared_ptr< EnckeReferenceOrbit< StateScalarType, TimeType > > rectifiedReferenceOrbit =
+                        std::make_shared< EnckeReferenceOrbit< StateScalarType, TimeType > >(
+                            orbital_element_conversions::convertCartesianToKeplerianElements< StateScalarType >(
+                                cartesianState, gravitationalParameter ), currentTime, gravitationalParameter );
+
+                // Set reference orbit from current time onwards (in direction of propagation)
+                if( currentTime > initialTime_ )
+                {
+                    std::map< TimeType, std::shared_ptr< EnckeReferenceOrbit< StateScalarType, TimeType > > >&
+                            referenceOrbits = forwardRectifiedReferenceOrbits_[ i ];
+                    referenceOrbits.erase( referenceOrbits.lower_bound( currentTime ), referenceOrbits.end( ) );
+                    referenceOrbits[ currentTime ] = rectifiedReferenceOrbit;
+                }
+                else
+                {
+                    std::map< TimeType, std::shared_ptr< EnckeReferenceOrbit< StateScalarType, TimeType > > >&
+                            referenceOrbits = backwardRectifiedReferenceOrbits_[ i ];
+                    referenceOrbits.erase( referenceOrbits.begin( ), referenceOrbits.upper_bound( currentTime ) );
+                    referenceOrbits[ currentTime ] = rectifiedReferenceOrbit;
+                }
+
+                // Reset Encke state w.r.t. new reference orbit
+                rectifiedReferenceOrbit->computeCartesianState(
+                            currentTime, rootFinder_, currentKeplerianOrbitCartesianState_[ i ] );
+                unprocessedState.template block< 6, 1 >( i * 6, 0 ) = cartesianState - currentKeplerianOrbitCartesianState_[ i ];
+                numberOfRectifications_++;
+            }
+        }
+    }
+
+    //! Function to return whether the state needs to be post-processed (i.e. whether rectification is enabled).
+    bool isStateToBePostProcessed( )
+    {
+        return rectificationThreshold_ > 0.0;
+    }
+
+    //! Function to remove the reference orbits created by rectification, and reset to the initial reference orbits.
+    void resetRectifiedReferenceOrbits( )
+    {
+        for( unsigned int i = 0; i < forwardRectifiedReferenceOrbits_.size( ); i++ )
+        {
+            forwardRectifiedReferenceOrbits_[ i ].clear( );
+            backwardRectifiedReferenceOrbits_[ i ].clear( );
+        }
+        numberOfRectifications_ = 0;
+        currentKeplerOrbitTime_ = TUDAT_NAN;
+    }
+
+    //! Function to retrieve the number of rectifications of the reference orbits since the last reset
+    int getNumberOfRectifications( )
+    {
+        return numberOfRectifications_;
+    }
+
     //! Function to convert the Encke-propagator-specific form of the state to the conventional form.
     /*!
      * Function to convert the Encle-propagator-specific form of the state to the conventional form. For the Encke
@@ -233,14 +551,51 @@ private:
             const TimeType time,
             const int bodyIndex )
     {
+        std::shared_ptr< EnckeReferenceOrbit< StateScalarType, TimeType > > referenceOrbit =
+                getReferenceOrbit( time, bodyIndex );
+
+        // Update orbit constants if gravitational parameter has changed (e.g. during estimation).
+        StateScalarType gravitationalParameter =
+                static_cast< StateScalarType >( centralBodyGravitationalParameters_.at( bodyIndex )( ) );
+        if( !( referenceOrbit->getGravitationalParameter( ) == gravitationalParameter ) )
+        {
+            referenceOrbit->resetGravitationalParameter( gravitationalParameter );
+        }
+
         // Propagate Kepler orbit to current time and set.
-        currentKeplerianOrbitCartesianState_[ bodyIndex ] =
-                orbital_element_conversions::convertKeplerianToCartesianElements< StateScalarType >(
-                    orbital_element_conversions::propagateKeplerOrbit< StateScalarType >(
-                        initialKeplerElements_.at( bodyIndex ), static_cast< StateScalarType >( time - initialTime_ ),
-                        static_cast< StateScalarType >( centralBodyGravitationalParameters_.at( bodyIndex )( ) ),
-                        rootFinder_ ),
-                    static_cast< StateScalarType >( centralBodyGravitationalParameters_.at( bodyIndex )( ) ) );
+        referenceOrbit->computeCartesianState( time, rootFinder_, currentKeplerianOrbitCartesianState_[ bodyIndex ] );
+    }
+
+    //! Function to retrieve the reference orbit that is valid at the given time for given body.
+    /*!
+     * Function to retrieve the reference orbit that is valid at the given time for given body, which is the orbit
+     * created by the latest rectification (in the direction of propagation) before this time, or the initial reference
+     * orbit if no rectification has taken place.
+     * \param time Time at which reference orbit is to be retrieved.
+     * \param bodyIndex Index in list of bodies for which reference orbit is to be retrieved.
+     * \return Reference orbit that is valid at the given time for given body.
+     */
+    std::shared_ptr< EnckeReferenceOrbit< StateScalarType, TimeType > > getReferenceOrbit(
+            const TimeType time,
+            const int bodyIndex )
+    {
+        if( time > initialTime_ && !forwardRectifiedReferenceOrbits_[ bodyIndex ].empty( ) )
+        {
+            auto referenceOrbitIterator = forwardRectifiedReferenceOrbits_[ bodyIndex ].upper_bound( time );
+            if( referenceOrbitIterator != forwardRectifiedReferenceOrbits_[ bodyIndex ].begin( ) )
+            {
+                return std::prev( referenceOrbitIterator )->second;
+            }
+        }
+        else if( time < initialTime_ && !backwardRectifiedReferenceOrbits_[ bodyIndex ].empty( ) )
+        {
+            auto referenceOrbitIterator = backwardRectifiedReferenceOrbits_[ bodyIndex ].lower_bound( time );
+            if( referenceOrbitIterator != backwardRectifiedReferenceOrbits_[ bodyIndex ].end( ) )
+            {
+                return referenceOrbitIterator->second;
+            }
+        }
+        return initialReferenceOrbits_[ bodyIndex ];
     }
 
     //! Function to calculate and set the reference Kepler orbit in Cartesian coordinates for all bodies.
@@ -276,7 +631,25 @@ private:
     std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > >
     centralAccelerations_;
 
-    //! Root finder used to propagate Kepler orbit.
+    //! Ratio of position deviation and distance to central body above which the reference orbit is rectified.
+    double rectificationThreshold_;
+
+    //! Reference orbits of bodiesToIntegrate, starting at initialTime_.
+    std::vector< std::shared_ptr< EnckeReferenceOrbit< StateScalarType, TimeType > > > initialReferenceOrbits_;
+
+    //! Reference orbits created by rectification after initialTime_, per body, with the time at which they start as key.
+    std::vector< std::map< TimeType, std::shared_ptr< EnckeReferenceOrbit< StateScalarType, TimeType > > > >
+    forwardRectifiedReferenceOrbits_;
+
+    //! Reference orbits created by rectification before initialTime_ (backward propagation), per body, with the time
+    //! at which they start as key.
+    std::vector< std::map< TimeType, std::shared_ptr< EnckeReferenceOrbit< StateScalarType, TimeType > > > >
+    backwardRectifiedReferenceOrbits_;
+
+    //! Number of rectifications of the reference orbits since the last reset.
+    int numberOfRectifications_;
+
+    //! Root finder used to propagate Kepler orbit (for non-elliptical reference orbits).
     std::shared_ptr< root_finders::RootFinder< StateScalarType > > rootFinder_;
 
     //! Current Cartesian states of reference Kepler orbits, valid at currentKeplerOrbitTime_, computed by
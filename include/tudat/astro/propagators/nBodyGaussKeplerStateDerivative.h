@@ -14,6 +14,7 @@
 #include "tudat/astro/propagators/nBodyStateDerivative.h"
 #include "tudat/astro/basic_astro/stateRepresentationConversions.h"
 #include "tudat/astro/basic_astro/astrodynamicsFunctions.h"
+#include "tudat/astro/basic_astro/batchElementConversions.h"
 
 namespace tudat
 {
@@ -210,49 +211,99 @@ public:
             const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& internalSolution, const TimeType& time,
             Eigen::Block< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > currentCartesianLocalSolution )
     {
-        // Add Keplerian state to perturbation from Encke algorithm to get Cartesian state in local frames.
-        Eigen::Matrix< StateScalarType, 6, 1 > currentKeplerianState;
+        // Convert Keplerian state (with mean anomaly) to Cartesian state in local frames.
+        Eigen::Matrix< StateScalarType, 6, 1 > currentCartesianState;
         for( unsigned int i = 0; i < this->bodiesToBeIntegratedNumerically_.size( ); i++ )
         {
-            try
-            {
-                currentKeplerianState = internalSolution.block( i * 6, 0, 6, 1 );
-                StateScalarType currentTrueAnomaly;
-                if( currentKeplerianState( 1 ) < 1.0 )
-                {
-                    StateScalarType currentEccentricAnomaly = orbital_element_conversions::convertMeanAnomalyToEccentricAnomaly(
-                                currentKeplerianState( 1 ), currentKeplerianState( 5 ) );
-                    currentTrueAnomaly = orbital_element_conversions::convertEccentricAnomalyToTrueAnomaly(
-                                currentEccentricAnomaly, currentKeplerianState( 1 ) );
-                    currentKeplerianState( 5 ) = currentTrueAnomaly;
-                }
-                else
-                {
-                    StateScalarType currentEccentricAnomaly = orbital_element_conversions::convertMeanAnomalyToHyperbolicEccentricAnomaly(
-                                currentKeplerianState( 1 ), currentKeplerianState( 5 ) );
-                    currentTrueAnomaly = orbital_element_conversions::convertHyperbolicEccentricAnomalyToTrueAnomaly(
-                                currentEccentricAnomaly, currentKeplerianState( 1 ) );
-                    currentKeplerianState( 5 ) = currentTrueAnomaly;
-                }
-
-                currentTrueAnomalies_[ i ] = currentTrueAnomaly;
-                currentCartesianLocalSolution.block( i * 6, 0, 6, 1 ) = orbital_element_conversions::convertKeplerianToCartesianElements(
-                            currentKeplerianState, static_cast< StateScalarType >( centralBodyGravitationalParameters_.at( i )( ) ) );
-            }
-            catch( std::runtime_error const& )
-            {
-                currentTrueAnomalies_[ i ] = TUDAT_NAN;
-                currentCartesianLocalSolution.block( i * 6, 0, 6, 1 ) =
-                        Eigen::Matrix< StateScalarType, 6, 1 >::Constant( TUDAT_NAN );
-            }
-
+            currentTrueAnomalies_[ i ] = convertMeanAnomalyKeplerElementsToCartesianElements(
+                        internalSolution.block( i * 6, 0, 6, 1 ),
+                        static_cast< StateScalarType >( centralBodyGravitationalParameters_.at( i )( ) ),
+                        currentCartesianState );
+            currentCartesianLocalSolution.block( i * 6, 0, 6, 1 ) = currentCartesianState;
         }
 
         currentCartesianLocalSolution_ = currentCartesianLocalSolution.template cast< double >( );
     }
 
+    //! Function to convert a history of Kepler states of the bodies to the conventional form in a single batch.
+    /*!
+     * Function to convert a history of Kepler states (with mean anomaly) of the bodies to Cartesian states w.r.t. the
+     * central bodies in a single batch, distributed over a number of threads (see convertStateBatch). The current
+     * Cartesian states and true anomalies of the bodies (set by convertToOutputSolution) are not modified.
+     * \param internalSolutions States in Kepler elements, one epoch per column
+     * \param outputSolutions States (internalSolutions), converted to the 'conventional form', one epoch per column
+     * (returned by reference)
+     * \param numberOfThreads Maximum number of threads over which the conversion is distributed
+     * \return True (batch conversion is supported)
+     */
+    bool convertToOutputSolutionBatch(
+            const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& internalSolutions,
+            Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& outputSolutions,
+            const int numberOfThreads )
+    {
+        outputSolutions.resize( internalSolutions.rows( ), internalSolutions.cols( ) );
+        for( unsigned int i = 0; i < this->bodiesToBeIntegratedNumerically_.size( ); i++ )
+        {
+            StateScalarType centralBodyGravitationalParameter =
+                    static_cast< StateScalarType >( centralBodyGravitationalParameters_.at( i )( ) );
+            outputSolutions.block( i * 6, 0, 6, internalSolutions.cols( ) ) =
+                    orbital_element_conversions::convertStateBatch< 6, 6, StateScalarType >(
+                        internalSolutions.block( i * 6, 0, 6, internalSolutions.cols( ) ),
+                        [ = ]( const Eigen::Matrix< StateScalarType, 6, 1 >& keplerianState,
+                        Eigen::Matrix< StateScalarType, 6, 1 >& cartesianState )
+            {
+                convertMeanAnomalyKeplerElementsToCartesianElements(
+                            keplerianState, centralBodyGravitationalParameter, cartesianState );
+            }, numberOfThreads );
+        }
+        return true;
+    }
+
 private:
 
+    //! Function to convert Kepler elements (with mean anomaly) to Cartesian elements
+    /*!
+     * Function to convert Kepler elements (with mean anomaly) to Cartesian elements. If the conversion fails (e.g. if the
+     * anomaly conversion does not converge), the Cartesian elements and true anomaly are set to NaN.
+     * \param keplerianState Kepler elements, with the mean anomaly as the sixth element
+     * \param centralBodyGravitationalParameter Gravitational parameter of the central body
+     * \param cartesianState Cartesian elements (returned by reference)
+     * \return True anomaly corresponding to the Kepler elements
+     */
+    static StateScalarType convertMeanAnomalyKeplerElementsToCartesianElements(
+            Eigen::Matrix< StateScalarType, 6, 1 > keplerianState,
+            const StateScalarType centralBodyGravitationalParameter,
+            Eigen::Matrix< StateScalarType, 6, 1 >& cartesianState )
+    {
+        StateScalarType currentTrueAnomaly;
+        try
+        {
+            if( keplerianState( 1 ) < 1.0 )
+            {
+                StateScalarType currentEccentricAnomaly = orbital_element_conversions::convertMeanAnomalyToEccentricAnomaly(
+                            keplerianState( 1 ), keplerianState( 5 ) );
+                currentTrueAnomaly = orbital_element_conversions::convertEccentricAnomalyToTrueAnomaly(
+                            currentEccentricAnomaly, keplerianState( 1 ) );
+            }
+            else
+            {
+                StateScalarType currentEccentricAnomaly = orbital_element_conversions::convertMeanAnomalyToHyperbolicEccentricAnomaly(
+                            keplerianState( 1 ), keplerianState( 5 ) );
+                currentTrueAnomaly = orbital_element_conversions::convertHyperbolicEccentricAnomalyToTrueAnomaly(
+                            currentEccentricAnomaly, keplerianState( 1 ) );
+            }
+            keplerianState( 5 ) = currentTrueAnomaly;
+            cartesianState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                        keplerianState, centralBodyGravitationalParameter );
+        }
+        catch( std::runtime_error const& )
+        {
+            currentTrueAnomaly = TUDAT_NAN;
+            cartesianState = Eigen::Matrix< StateScalarType, 6, 1 >::Constant( TUDAT_NAN );
+        }
+        return currentTrueAnomaly;
+    }
+
     //!  Gravitational parameters of central bodies used to convert Cartesian to Keplerian orbits, and vice versa
     std::vector< std::function< double( ) > > centralBodyGravitationalParameters_;
 
@@ -14,6 +14,7 @@
 #include "tudat/astro/propagators/nBodyStateDerivative.h"
 #include "tudat/astro/basic_astro/stateRepresentationConversions.h"
 #include "tudat/astro/basic_astro/astrodynamicsFunctions.h"
+#include "tudat/astro/basic_astro/batchElementConversions.h"
 
 namespace tudat
 {
@@ -197,6 +198,33 @@ public:
         currentCartesianLocalSolution_ = currentCartesianLocalSolution;
     }
 
+    //! Function to convert a history of modified equinoctial elements of the bodies to the conventional form in a batch.
+    /*!
+     * Function to convert a history of modified equinoctial elements of the bodies to Cartesian states w.r.t. the central
+     * bodies in a single batch, distributed over a number of threads (see convertStateBatch). The current Cartesian state
+     * of the bodies (set by convertToOutputSolution) is not modified.
+     * \param internalSolutions States in modified equinoctial elements, one epoch per column
+     * \param outputSolutions States (internalSolutions), converted to the 'conventional form', one epoch per column
+     * (returned by reference)
+     * \param numberOfThreads Maximum number of threads over which the conversion is distributed
+     * \return True (batch conversion is supported)
+     */
+    bool convertToOutputSolutionBatch(
+            const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& internalSolutions,
+            Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& outputSolutions,
+            const int numberOfThreads )
+    {
+        outputSolutions.resize( internalSolutions.rows( ), internalSolutions.cols( ) );
+        for( unsigned int i = 0; i < this->bodiesToBeIntegratedNumerically_.size( ); i++ )
+        {
+            outputSolutions.block( i * 6, 0, 6, internalSolutions.cols( ) ) =
+                    orbital_element_conversions::convertModifiedEquinoctialToCartesianElementsBatch< StateScalarType >(
+                        internalSolutions.block( i * 6, 0, 6, internalSolutions.cols( ) ), static_cast< StateScalarType >(
+                            centralBodyGravitationalParameters_.at( i )( ) ), flipSingularities_.at( i ), numberOfThreads );
+        }
+        return true;
+    }
+
 
 private:
 
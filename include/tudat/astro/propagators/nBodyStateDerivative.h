@@ -17,11 +17,15 @@
 
 #include <memory>
 #include <functional>
+#include <set>
+#include <unordered_set>
 
 #include "tudat/astro/basic_astro/accelerationModel.h"
 
 #include "tudat/astro/basic_astro/accelerationModelTypes.h"
+#include "tudat/astro/gravitation/mutualPointMassGravityKernel.h"
 #include "tudat/astro/propagators/centralBodyData.h"
+#include "tudat/basics/parallelization.h"
 #include "tudat/astro/propagators/singleStateTypeDerivative.h"
 
 namespace tudat
@@ -180,6 +184,15 @@ public:
             accelerationModelList_.at( i )->resetCurrentTime( );
         }        
 
+        if( mutualPointMassGravityKernel_ != nullptr )
+        {
+            mutualPointMassGravityKernel_->resetCurrentTime( );
+            for( unsigned int i = 0; i < updatedKernelEvaluatedAccelerations_.size( ); i++ )
+            {
+                updatedKernelEvaluatedAccelerations_.at( i )->resetCurrentTime( );
+            }
+        }
+
         for( unsigned int i = 0; i < updateRemovedAccelerations_.size( ); i++ )
         {
             if( removedCentralAccelerations_.count( updateRemovedAccelerations_.at( i  ) ) > 0 )
@@ -211,9 +224,38 @@ public:
      */
     void updateStateDerivativeModel( const TimeType currentTime )
     {
-        for( unsigned int i = 0; i < accelerationModelList_.size( ); i++ )
+        if( parallelTaskPool_ != nullptr )
+        {
+            // Update accelerations acting on each body in a separate task (not profiled)
+            parallelTaskPool_->executeTasks(
+                        static_cast< int >( bodyAccelerationModelListStartIndices_.size( ) ) - 1,
+                        [ this, currentTime ]( const int bodyIndex )
+            {
+                for( int i = bodyAccelerationModelListStartIndices_[ bodyIndex ];
+                     i < bodyAccelerationModelListStartIndices_[ bodyIndex + 1 ]; i++ )
+                {
+                    accelerationModelList_[ i ]->updateMembers( currentTime );
+                }
+            } );
+        }
+        else
+        {
+            for( unsigned int i = 0; i < accelerationModelList_.size( ); i++ )
+            {
+                TUDAT_PROFILE_MODEL_EVALUATION( modelEvaluationProfiler_, accelerationUpdateProfilingIndices_[ i ] );
+                accelerationModelList_.at( i )->updateMembers( currentTime );
+            }
+        }
+
+        // Update all mutual point-mass accelerations, and the individual models of those that are used as output
+        if( mutualPointMassGravityKernel_ != nullptr )
         {
-            accelerationModelList_.at( i )->updateMembers( currentTime );
+            TUDAT_PROFILE_MODEL_EVALUATION( modelEvaluationProfiler_, kernelUpdateProfilingIndex_ );
+            mutualPointMassGravityKernel_->update( static_cast< double >( currentTime ), parallelTaskPool_ );
+            for( unsigned int i = 0; i < updatedKernelEvaluatedAccelerations_.size( ); i++ )
+            {
+                updatedKernelEvaluatedAccelerations_.at( i )->updateMembers( currentTime );
+            }
         }
 
         for( unsigned int i = 0; i < updateRemovedAccelerations_.size( ); i++ )
@@ -241,7 +283,9 @@ public:
             const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& internalSolution, const TimeType& time,
             Eigen::Block< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > currentCartesianLocalSoluton )
     {
-        this->convertToOutputSolution( internalSolution, time, currentCartesianLocalSoluton );
+        // Copy state to pre-allocated matrix, to prevent creation of temporary in conversion to matrix input argument
+        currentInternalSolution_ = internalSolution;
+        this->convertToOutputSolution( currentInternalSolution_, time, currentCartesianLocalSoluton );
 
         centralBodyData_->getReferenceFrameOriginInertialStates(
                     currentCartesianLocalSoluton, time, centralBodyStatesWrtGlobalOrigin_, true );
@@ -336,11 +380,19 @@ public:
                 {
                     for( unsigned int j = 0; j < innerAccelerationIterator->second.size( ); j++ )
                     {
-                        // Calculate acceleration and add to state derivative.
-                         innerAccelerationIterator->second[ j ]->addCurrentAcceleration( totalAcceleration );
+                        // Calculate acceleration and add to state derivative (if not evaluated by mutual point-mass kernel)
+                        if( kernelEvaluatedAccelerationSet_.count( innerAccelerationIterator->second[ j ].get( ) ) == 0 )
+                        {
+                            innerAccelerationIterator->second[ j ]->addCurrentAcceleration( totalAcceleration );
+                        }
                     }
                 }
             }
+
+            if( kernelBodyIndices_.count( bodyName ) != 0 )
+            {
+                totalAcceleration += mutualPointMassGravityKernel_->getAcceleration( kernelBodyIndices_.at( bodyName ) );
+            }
         }
         return totalAcceleration;
     }
@@ -373,10 +425,236 @@ public:
         }
     }
 
+    // Function to set the object to which the evaluations of the acceleration models are to be profiled.
+    /*
+     * Function to set the object to which the evaluations of the acceleration models are to be profiled, registering
+     * the update (acceleration_update category) and retrieval (acceleration_evaluation category) of each acceleration model
+     * \param modelEvaluationProfiler Object to which model evaluations are to be profiled (nullptr to disable profiling)
+     */
+    void setModelEvaluationProfiler(
+            const std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler )
+    {
+        modelEvaluationProfiler_ = modelEvaluationProfiler;
+        registerProfiledAccelerationModels( );
+    }
+
+    // Function to set the number of threads over which the acceleration models are updated
+    /*
+     * Function to set the number of threads over which the acceleration models are updated. If more than one thread is
+     * used, the accelerations acting on each propagated body are updated as a separate task, distributed over a
+     * persistent set of worker threads. This requires the acceleration models acting on different bodies to be
+     * independent once the environment is updated. This is the case for the models created by createAccelerationModelsMap,
+     * as each model has its own caches (e.g. SphericalHarmonicsCache), but not necessarily for custom models that share
+     * mutable objects. The summation of the accelerations, and all environment updates, are always done serially.
+     * Updates are not profiled by the modelEvaluationProfiler_ when using more than one thread.
+     * \param numberOfThreads Number of threads that is to be used (1 for serial update)
+     */
+    void setNumberOfParallelThreads( const int numberOfThreads )
+    {
+        if( numberOfThreads > 1 )
+        {
+            parallelTaskPool_ = std::make_shared< utilities::ParallelTaskPool >( numberOfThreads );
+        }
+        else
+        {
+            parallelTaskPool_ = nullptr;
+        }
+    }
+
+    // Function to retrieve the number of threads over which the acceleration models are updated
+    int getNumberOfParallelThreads( )
+    {
+        return ( parallelTaskPool_ == nullptr ) ? 1 : parallelTaskPool_->getNumberOfThreads( );
+    }
+
+    // Function to evaluate the point-mass accelerations between the propagated bodies with a single all-pairs kernel
+    /*
+     * Function to evaluate the point-mass gravitational accelerations between the propagated bodies with a single
+     * all-pairs kernel (see MutualPointMassGravityKernel), instead of with a separate acceleration model per pair and
+     * direction. All CentralGravitationalAccelerationModel3d objects (without mutual attraction) for which both the body
+     * undergoing and the body exerting the acceleration are propagated by this object are removed from the summed
+     * accelerations, and their combined acceleration on each body is added as a single contribution. The models remain in
+     * the full acceleration map (see getFullAccelerationsMap), which is used to create the acceleration partials (which
+     * update the models themselves) and the dependent variables. Models that are used for dependent variables are
+     * updated in addition to the kernel (see setUpdateKernelEvaluatedAccelerations). If the accelerations are updated on
+     * multiple threads (see setNumberOfParallelThreads), the kernel is evaluated on the same threads. The accelerations
+     * computed by the kernel are equal to those of the separate models up to round-off.
+     */
+    void useMutualPointMassGravityKernel( )
+    {
+        if( mutualPointMassGravityKernel_ != nullptr )
+        {
+            return;
+        }
+
+        std::vector< std::function< void( Eigen::Vector3d& ) > > positionFunctions;
+        std::vector< std::function< double( ) > > gravitationalParameterFunctions;
+        std::vector< std::pair< int, int > > interactions;
+        std::set< std::pair< int, int > > includedInteractions;
+
+        // Retrieve index of body in the kernel, adding it if needed
+        auto getKernelBodyIndex = [ & ]( const std::string& bodyName,
+                const std::function< void( Eigen::Vector3d& ) >& positionFunction )
+        {
+            if( kernelBodyIndices_.count( bodyName ) == 0 )
+            {
+                kernelBodyIndices_[ bodyName ] = static_cast< int >( positionFunctions.size( ) );
+                kernelBodyStateIndices_.push_back( static_cast< int >( std::distance(
+                        bodiesToBeIntegratedNumerically_.begin( ),
+                        std::find( bodiesToBeIntegratedNumerically_.begin( ), bodiesToBeIntegratedNumerically_.end( ),
+                                   bodyName ) ) ) );
+                positionFunctions.push_back( positionFunction );
+                gravitationalParameterFunctions.push_back( nullptr );
+            }
+            return kernelBodyIndices_.at( bodyName );
+        };
+
+        // Remove point-mass accelerations between propagated bodies from summed accelerations
+        for( auto& outerIterator : accelerationModelsPerBody_ )
+        {
+            for( auto& innerIterator : outerIterator.second )
+            {
+                if( innerIterator.first == outerIterator.first ||
+                        std::find( bodiesToBeIntegratedNumerically_.begin( ), bodiesToBeIntegratedNumerically_.end( ),
+                                   innerIterator.first ) == bodiesToBeIntegratedNumerically_.end( ) )
+                {
+                    continue;
+                }
+
+                std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > >&
+                        accelerationList = innerIterator.second;
+                for( unsigned int j = 0; j < accelerationList.size( ); j++ )
+                {
+                    std::shared_ptr< gravitation::CentralGravitationalAccelerationModel3d > pointMassAcceleration =
+                            std::dynamic_pointer_cast< gravitation::CentralGravitationalAccelerationModel3d >(
+                                accelerationList.at( j ) );
+                    if( pointMassAcceleration == nullptr || pointMassAcceleration->getIsMutualAttractionUsed( ) )
+                    {
+                        continue;
+                    }
+
+                    int undergoingBodyIndex = getKernelBodyIndex(
+                                outerIterator.first, pointMassAcceleration->getStateFunctionOfBodyUndergoingAcceleration( ) );
+                    int exertingBodyIndex = getKernelBodyIndex(
+                                innerIterator.first, pointMassAcceleration->getStateFunctionOfBodyExertingAcceleration( ) );
+
+                    // Only a single acceleration per pair and direction is included in the kernel
+                    if( includedInteractions.count( std::make_pair( undergoingBodyIndex, exertingBodyIndex ) ) == 0 )
+                    {
+                        includedInteractions.insert( std::make_pair( undergoingBodyIndex, exertingBodyIndex ) );
+                        if( gravitationalParameterFunctions.at( exertingBodyIndex ) == nullptr )
+                        {
+                            gravitationalParameterFunctions.at( exertingBodyIndex ) =
+                                    pointMassAcceleration->getGravitationalParameterFunction( );
+                        }
+                        kernelEvaluatedAccelerationSet_.insert( pointMassAcceleration.get( ) );
+                        accelerationList.erase( accelerationList.begin( ) + j );
+                        j--;
+                    }
+                }
+            }
+        }
+
+        if( includedInteractions.size( ) == 0 )
+        {
+            kernelBodyIndices_.clear( );
+            kernelBodyStateIndices_.clear( );
+            return;
+        }
+
+        // Create kernel, and update list of separately updated acceleration models
+        Eigen::Matrix< bool, Eigen::Dynamic, Eigen::Dynamic > interactionMask =
+                Eigen::Matrix< bool, Eigen::Dynamic, Eigen::Dynamic >::Constant(
+                    positionFunctions.size( ), positionFunctions.size( ), false );
+        for( auto interaction : includedInteractions )
+        {
+            interactionMask( interaction.first, interaction.second ) = true;
+        }
+        mutualPointMassGravityKernel_ = std::make_shared< gravitation::MutualPointMassGravityKernel >(
+                    positionFunctions, gravitationalParameterFunctions, interactionMask );
+        createAccelerationModelList( );
+    }
+
+    // Function to retrieve the kernel evaluating the point-mass accelerations between the propagated bodies
+    /*
+     * Function to retrieve the kernel evaluating the point-mass accelerations between the propagated bodies (nullptr if
+     * useMutualPointMassGravityKernel is not called, or if no such accelerations exist)
+     * \return Kernel evaluating the point-mass accelerations between the propagated bodies
+     */
+    std::shared_ptr< gravitation::MutualPointMassGravityKernel > getMutualPointMassGravityKernel( )
+    {
+        return mutualPointMassGravityKernel_;
+    }
 
+    // Function to ensure that acceleration models evaluated by the mutual point-mass kernel are also updated separately
+    /*
+     * Function to ensure that acceleration models evaluated by the mutual point-mass kernel are also updated separately,
+     * so that their current acceleration can be retrieved (e.g. as dependent variable). Models that are not evaluated by
+     * the kernel are ignored.
+     * \param accelerationModels Acceleration models that are to be updated separately
+     */
+    void setUpdateKernelEvaluatedAccelerations(
+            const std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > >& accelerationModels )
+    {
+        for( unsigned int i = 0; i < accelerationModels.size( ); i++ )
+        {
+            if( kernelEvaluatedAccelerationSet_.count( accelerationModels.at( i ).get( ) ) != 0 &&
+                    std::find( updatedKernelEvaluatedAccelerations_.begin( ), updatedKernelEvaluatedAccelerations_.end( ),
+                               accelerationModels.at( i ) ) == updatedKernelEvaluatedAccelerations_.end( ) )
+            {
+                updatedKernelEvaluatedAccelerations_.push_back( accelerationModels.at( i ) );
+            }
+        }
+    }
 
 protected:
 
+    // Function to register the acceleration models in accelerationModelList_ with the modelEvaluationProfiler_
+    void registerProfiledAccelerationModels( )
+    {
+        accelerationUpdateProfilingIndices_.clear( );
+        accelerationEvaluationProfilingIndices_.clear( );
+        if( modelEvaluationProfiler_ != nullptr )
+        {
+            // Iterate over accelerations in same order as createAccelerationModelList
+            for( auto& outerIterator : accelerationModelsPerBody_ )
+            {
+                for( auto& innerIterator : outerIterator.second )
+                {
+                    for( unsigned int j = 0; j < innerIterator.second.size( ); j++ )
+                    {
+                        std::string accelerationName;
+                        try
+                        {
+                            accelerationName = basic_astrodynamics::getAccelerationModelName(
+                                        basic_astrodynamics::getAccelerationModelType( innerIterator.second.at( j ) ) );
+                        }
+                        catch( const std::runtime_error& )
+                        {
+                            accelerationName = "unidentified acceleration";
+                        }
+
+                        std::string modelName = outerIterator.first + " <- " + innerIterator.first + ": " + accelerationName;
+                        if( j > 0 )
+                        {
+                            modelName += " (" + std::to_string( j ) + ")";
+                        }
+                        accelerationUpdateProfilingIndices_.push_back(
+                                    modelEvaluationProfiler_->addProfiledModel( "acceleration_update", modelName ) );
+                        accelerationEvaluationProfilingIndices_.push_back(
+                                    modelEvaluationProfiler_->addProfiledModel( "acceleration_evaluation", modelName ) );
+                    }
+                }
+            }
+
+            if( mutualPointMassGravityKernel_ != nullptr )
+            {
+                kernelUpdateProfilingIndex_ = modelEvaluationProfiler_->addProfiledModel(
+                            "acceleration_update", "mutual point-mass gravity kernel" );
+            }
+        }
+    }
+
     void verifyInput( )
     {
         for( unsigned int i = 0; i < bodiesToBeIntegratedNumerically_.size( ); i++ )
@@ -409,9 +687,12 @@ protected:
     {
         // Iterate over all accelerations and update their internal state.
         accelerationModelList_.clear( );
+        bodyAccelerationModelListStartIndices_.clear( );
         for( outerAccelerationIterator = accelerationModelsPerBody_.begin( );
              outerAccelerationIterator != accelerationModelsPerBody_.end( ); outerAccelerationIterator++ )
         {
+            bodyAccelerationModelListStartIndices_.push_back( static_cast< int >( accelerationModelList_.size( ) ) );
+
             // Iterate over all accelerations acting on body
             for( innerAccelerationIterator  = outerAccelerationIterator->second.begin( );
                  innerAccelerationIterator != outerAccelerationIterator->second.end( );
@@ -424,6 +705,8 @@ protected:
                 }
             }
         }
+        bodyAccelerationModelListStartIndices_.push_back( static_cast< int >( accelerationModelList_.size( ) ) );
+        registerProfiledAccelerationModels( );
     }
 
     // Function to get the state derivative of the system in Cartesian coordinates.
@@ -447,6 +730,9 @@ protected:
 
         int currentBodyIndex = 0;
         int currentAccelerationIndex = 0;
+#if TUDAT_BUILD_WITH_PROPAGATION_PROFILING
+        int currentModelIndex = 0;
+#endif
 
         // Iterate over all bodies with accelerations.
         for( outerAccelerationIterator = accelerationModelsPerBody_.begin( );
@@ -462,8 +748,11 @@ protected:
             {
                 for( unsigned int j = 0; j < innerAccelerationIterator->second.size( ); j++ )
                 {
-                    // Calculate acceleration and add to state derivative.
-                    stateDerivative.block( currentBodyIndex * 6 + 3, 0, 3, 1 ) +=
+                    TUDAT_PROFILE_MODEL_EVALUATION(
+                                modelEvaluationProfiler_, accelerationEvaluationProfilingIndices_[ currentModelIndex++ ] );
+
+                    // Calculate acceleration and add to state derivative (using fixed-size block to prevent temporaries).
+                    stateDerivative.template block< 3, 1 >( currentBodyIndex * 6 + 3, 0 ) +=
                                                 ( innerAccelerationIterator->second[ j ]->getAccelerationReference( ) ).
                                                 template cast< StateScalarType >( );
 
@@ -473,11 +762,21 @@ protected:
             if( addPositionDerivatives )
             {
                 // Add body velocity as derivative of its position.
-                stateDerivative.block( currentBodyIndex * 6, 0, 3, 1 ) =
-                        ( stateOfSystemToBeIntegrated.segment( currentBodyIndex * 6 + 3, 3 ) );
+                stateDerivative.template block< 3, 1 >( currentBodyIndex * 6, 0 ) =
+                        stateOfSystemToBeIntegrated.template segment< 3 >( currentBodyIndex * 6 + 3 );
             }
             currentAccelerationIndex++;
         }
+
+        // Add point-mass accelerations between propagated bodies, as computed by single kernel
+        if( mutualPointMassGravityKernel_ != nullptr )
+        {
+            for( unsigned int i = 0; i < kernelBodyStateIndices_.size( ); i++ )
+            {
+                stateDerivative.template block< 3, 1 >( kernelBodyStateIndices_[ i ] * 6 + 3, 0 ) +=
+                        mutualPointMassGravityKernel_->getAcceleration( i ).template cast< StateScalarType >( );
+            }
+        }
     }
 
     // Function to get the state derivative of the system in Cartesian coordinates.
@@ -520,6 +819,13 @@ protected:
     // Vector of acceleration models, containing all entries of accelerationModelsPerBody_.
     std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > > accelerationModelList_;
 
+    // Indices in accelerationModelList_ at which the accelerations acting on each body start (in order of
+    // accelerationModelsPerBody_), with the size of accelerationModelList_ as final entry.
+    std::vector< int > bodyAccelerationModelListStartIndices_;
+
+    // Pool of threads over which the acceleration models are updated (nullptr for serial update)
+    std::shared_ptr< utilities::ParallelTaskPool > parallelTaskPool_;
+
     // Object responsible for providing the current integration origins from the global origins.
     std::shared_ptr< CentralBodyData< StateScalarType, TimeType > > centralBodyData_;
 
@@ -542,10 +848,41 @@ protected:
     // List of states of the central bodies of the propagated bodies.
     std::vector< Eigen::Matrix< StateScalarType, 6, 1 >  > centralBodyStatesWrtGlobalOrigin_;
 
+    // Pre-allocated copy of propagated state, used in convertCurrentStateToGlobalRepresentation
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > currentInternalSolution_;
+
     Eigen::Vector3d currentAccelerationComponent_;
 
     bool removeCentralTerm_;
 
+    // Object to which the model evaluations are profiled (nullptr if not profiled)
+    std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler_;
+
+    // Indices in modelEvaluationProfiler_ of the update of each entry of accelerationModelList_
+    std::vector< int > accelerationUpdateProfilingIndices_;
+
+    // Indices in modelEvaluationProfiler_ of the retrieval of each entry of accelerationModelList_
+    std::vector< int > accelerationEvaluationProfilingIndices_;
+
+    // Index in modelEvaluationProfiler_ of the update of mutualPointMassGravityKernel_
+    int kernelUpdateProfilingIndex_ = -1;
+
+    // Kernel evaluating the point-mass accelerations between the propagated bodies (nullptr if not used)
+    std::shared_ptr< gravitation::MutualPointMassGravityKernel > mutualPointMassGravityKernel_;
+
+    // Index of each body in mutualPointMassGravityKernel_ (key: body name)
+    std::map< std::string, int > kernelBodyIndices_;
+
+    // Index in bodiesToBeIntegratedNumerically_ of each body in mutualPointMassGravityKernel_
+    std::vector< int > kernelBodyStateIndices_;
+
+    // Acceleration models of which the acceleration is computed by mutualPointMassGravityKernel_
+    std::unordered_set< basic_astrodynamics::AccelerationModel< Eigen::Vector3d >* > kernelEvaluatedAccelerationSet_;
+
+    // Acceleration models evaluated by mutualPointMassGravityKernel_ that are also updated separately
+    std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > >
+    updatedKernelEvaluatedAccelerations_;
+
 };
 
 extern template class NBodyStateDerivative< double, double >;
@@ -13,6 +13,7 @@
 
 #include "tudat/astro/propagators/nBodyStateDerivative.h"
 #include "tudat/astro/basic_astro/stateRepresentationConversions.h"
+#include "tudat/astro/basic_astro/batchElementConversions.h"
 
 namespace tudat
 {
@@ -213,6 +214,34 @@ public:
         currentCartesianLocalSolution_ = currentCartesianLocalSolution;
     }
 
+    //! Function to convert a history of USM7 elements of the bodies to the conventional form in a single batch.
+    /*!
+     * Function to convert a history of USM7 elements of the bodies to Cartesian states w.r.t. the central bodies in a
+     * single batch, distributed over a number of threads (see convertStateBatch). The current Cartesian state of the
+     * bodies (set by convertToOutputSolution) is not modified.
+     * \param internalSolutions States in USM7 elements, one epoch per column
+     * \param outputSolutions States (internalSolutions), converted to the 'conventional form', one epoch per column
+     * (returned by reference)
+     * \param numberOfThreads Maximum number of threads over which the conversion is distributed
+     * \return True (batch conversion is supported)
+     */
+    bool convertToOutputSolutionBatch(
+            const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& internalSolutions,
+            Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& outputSolutions,
+            const int numberOfThreads )
+    {
+        outputSolutions.resize( 6 * this->bodiesToBeIntegratedNumerically_.size( ), internalSolutions.cols( ) );
+        for( unsigned int i = 0; i < this->bodiesToBeIntegratedNumerically_.size( ); i++ )
+        {
+            outputSolutions.block( i * 6, 0, 6, internalSolutions.cols( ) ) =
+                    orbital_element_conversions::convertUnifiedStateModelQuaternionsToCartesianElementsBatch(
+                        internalSolutions.block( i * 7, 0, 7, internalSolutions.cols( ) ).template cast< double >( ),
+                        static_cast< double >( centralBodyGravitationalParameters_.at( i )( ) ), true,
+                        numberOfThreads ).template cast< StateScalarType >( );
+        }
+        return true;
+    }
+
 
     //! Function to return the size of the state handled by the object.
     /*!
@@ -64,19 +64,49 @@ void propagateCovariance(
         const Eigen::MatrixXd& initialCovariance,
         const std::map< double, Eigen::MatrixXd >& fullVariationalEquationsSolutionHistory );
 
+//! Function to propagate full covariance at the initial time to (blocks of) the state covariance at a list of epochs
+/*!
+ * Function to propagate full covariance at the initial time to (blocks of) the state covariance at a list of epochs. The
+ * covariances at all epochs are written into a single contiguous matrix, in which the covariance at epoch i is stored in
+ * the block of columns starting at i * m, with m the size of the output covariance. If a list of state blocks is
+ * provided, only the rows of the state transition and sensitivity matrices for these blocks are evaluated, and the output
+ * is the marginal covariance of these blocks (including the correlations between them), in the order in which they are
+ * provided. The epochs are evaluated in parallel (each thread processing a contiguous range of epochs with its own
+ * preallocated workspace), so that the results do not depend on the number of threads.
+ * \param propagatedCovariances Covariances at all epochs, as a matrix of size m x ( m * N ), with N the number of
+ * epochs (returned by reference)
+ * \param initialCovariance Full covariance at initial time
+ * \param stateTransitionInterface Object that is used to obtain state transition and sensitivity matrices
+ * \param evaluationTimes Times at which the covariance is to be evaluated
+ * \param outputStateBlocks List of start index and size of the entries of the propagated state vector for which the
+ * covariance is to be computed (e.g. { { 0, 3 } } for the position covariance of the first body). Empty (default) for the
+ * full state covariance.
+ * \param numberOfThreads Number of threads over which the epochs are distributed
+ */
+void propagateCovarianceAtEpochs(
+        Eigen::MatrixXd& propagatedCovariances,
+        const Eigen::MatrixXd& initialCovariance,
+        const std::shared_ptr< CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionInterface,
+        const std::vector< double >& evaluationTimes,
+        const std::vector< std::pair< int, int > >& outputStateBlocks = std::vector< std::pair< int, int > >( ),
+        const int numberOfThreads = 1 );
+
 //! Function to propagate full covariance at the initial time to state covariance at later times
 /*!
- * Function to propagate full covariance at the initial time to state covariance at later times
+ * Function to propagate full covariance at the initial time to state covariance at later times (see
+ * propagateCovarianceAtEpochs)
  * \param propagatedCovariance List of state covariances at epochs (returned by reference)
  * \param initialCovariance Full covariance at initial time
  * \param stateTransitionInterface Object that is used to obtain state transition and sensitivity matrices
  * \param evaluationTimes Times at which the covariance is to be evaluated
+ * \param numberOfThreads Number of threads over which the epochs are distributed
  */
 void propagateCovariance(
         std::map< double, Eigen::MatrixXd >& propagatedCovariance,
         const Eigen::MatrixXd& initialCovariance,
         const std::shared_ptr< CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionInterface,
-        const std::vector< double > evaluationTimes );
+        const std::vector< double > evaluationTimes,
+        const int numberOfThreads = 1 );
 
 //! Function to propagate full covariance at the initial time to state formal errors at later times
 std::map< double, Eigen::MatrixXd > propagateCovariance(
@@ -126,12 +156,14 @@ void convertCovarianceHistoryToFormalErrorHistory(
  * \param initialCovariance Full covariance at initial time
  * \param stateTransitionInterface Object that is used to obtain state transition and sensitivity matrices
  * \param evaluationTimes Times at which the covariance is to be evaluated
+ * \param numberOfThreads Number of threads over which the epochs are distributed
  */
 void propagateFormalErrors(
         std::map< double, Eigen::VectorXd >& propagatedFormalErrors,
         const Eigen::MatrixXd& initialCovariance,
         const std::shared_ptr< CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionInterface,
-        const std::vector< double > evaluationTimes );
+        const std::vector< double > evaluationTimes,
+        const int numberOfThreads = 1 );
 
 //! Function to propagate full covariance at the initial time to state formal errors at later times
 std::map< double, Eigen::VectorXd > propagateFormalErrors(
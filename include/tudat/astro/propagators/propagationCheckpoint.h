@@ -0,0 +1,370 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PROPAGATIONCHECKPOINT_H
+#define TUDAT_PROPAGATIONCHECKPOINT_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/basics/timeType.h"
+#include "tudat/math/integrators/numericalIntegrator.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Full state of a single-arc propagation, from which the propagation can be continued identically
+/*!
+ *  Full state of a single-arc propagation, at the end of an accepted integration step, from which the propagation can be
+ *  continued identically (e.g. after saving it to a checkpoint file, see writeSingleArcPropagationCheckpoint). It contains
+ *  the internal state of the integrator, the state of the propagation loop (counters used for saving/printing of the
+ *  results, and elapsed CPU time used by the CPU time termination condition), and the results accumulated up to the
+ *  current epoch.
+ */
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType >
+struct SingleArcPropagationCheckpoint
+{
+    //! Internal state of the numerical integrator
+    numerical_integrators::NumericalIntegratorCheckpoint< TimeType, StateType, StateType, TimeStepType > integratorCheckpoint_;
+
+    //! Initial time of the propagation
+    TimeType initialTime_;
+
+    //! CPU time (in seconds) elapsed in propagation up to the checkpoint
+    double elapsedCpuTime_;
+
+    //! Number of steps since results were last saved
+    int stepsSinceLastSave_;
+
+    //! Time at which results were last saved
+    double timeOfLastSave_;
+
+    //! Number of steps since results were last printed
+    int stepsSinceLastPrint_;
+
+    //! Time at which results were last printed
+    double timeOfLastPrint_;
+
+    //! Time of saved epoch that is yet to be passed to the result sinks
+    TimeType sinkPendingTime_;
+
+    //! State at saved epoch that is yet to be passed to the result sinks
+    StateType sinkPendingState_;
+
+    //! Dependent variables at saved epoch that is yet to be passed to the result sinks
+    Eigen::VectorXd sinkPendingDependentVariables_;
+
+    //! History of saved states up to the checkpoint
+    std::map< TimeType, StateType > solutionHistory_;
+
+    //! History of saved dependent variables up to the checkpoint
+    std::map< TimeType, Eigen::VectorXd > dependentVariableHistory_;
+
+    //! History of CPU time up to the checkpoint
+    std::map< TimeType, double > cumulativeComputationTimeHistory_;
+
+    //! Boolean denoting whether integratorCheckpoint_ contains the full internal state of the integrator
+    /*!
+     *  Boolean denoting whether integratorCheckpoint_ contains the full internal state of the integrator. If false, only
+     *  the current epoch, state and step size are set, and the integrator is restarted from this state when continuing.
+     *  This is only used when continuing a propagation in memory (see SingleArcDynamicsSimulator::extendPropagation); a
+     *  checkpoint file always contains the full internal state.
+     */
+    bool isIntegratorStateRetained_ = true;
+};
+
+//! Function to write a single value to a binary checkpoint file
+void writeCheckpointValue( std::ostream& stream, const int value );
+
+//! Function to write a single value to a binary checkpoint file
+void writeCheckpointValue( std::ostream& stream, const double value );
+
+//! Function to write a single value to a binary checkpoint file
+void writeCheckpointValue( std::ostream& stream, const long double value );
+
+//! Function to write a single value to a binary checkpoint file
+void writeCheckpointValue( std::ostream& stream, const Time& value );
+
+//! Function to read a single value from a binary checkpoint file
+void readCheckpointValue( std::istream& stream, int& value );
+
+//! Function to read a single value from a binary checkpoint file
+void readCheckpointValue( std::istream& stream, double& value );
+
+//! Function to read a single value from a binary checkpoint file
+void readCheckpointValue( std::istream& stream, long double& value );
+
+//! Function to read a single value from a binary checkpoint file
+void readCheckpointValue( std::istream& stream, Time& value );
+
+//! Function to write the header of a binary checkpoint file, identifying the file type and scalar types
+/*!
+ *  Function to write the header of a binary checkpoint file, identifying the file type, format version and the sizes of
+ *  the time and state scalar types, so that a checkpoint is not read into a propagation with different types.
+ *  \param stream Stream to which header is written
+ *  \param timeTypeSize Size (in bytes) of the time type
+ *  \param stateScalarTypeSize Size (in bytes) of the state scalar type
+ */
+void writeCheckpointHeader( std::ostream& stream, const int timeTypeSize, const int stateScalarTypeSize );
+
+//! Function to read and check the header of a binary checkpoint file (see writeCheckpointHeader)
+/*!
+ *  Function to read and check the header of a binary checkpoint file (see writeCheckpointHeader). An exception is thrown
+ *  if the file is not a checkpoint file, or was written for different time or state scalar types.
+ *  \param stream Stream from which header is read
+ *  \param timeTypeSize Size (in bytes) of the time type expected in the file
+ *  \param stateScalarTypeSize Size (in bytes) of the state scalar type expected in the file
+ */
+void readCheckpointHeader( std::istream& stream, const int timeTypeSize, const int stateScalarTypeSize );
+
+//! Function to write an Eigen matrix (size and entries) to a binary checkpoint file
+template< typename ScalarType, int NumberOfRows, int NumberOfColumns, int Options, int MaximumRows, int MaximumColumns >
+void writeCheckpointValue(
+        std::ostream& stream,
+        const Eigen::Matrix< ScalarType, NumberOfRows, NumberOfColumns, Options, MaximumRows, MaximumColumns >& value )
+{
+    writeCheckpointValue( stream, static_cast< int >( value.rows( ) ) );
+    writeCheckpointValue( stream, static_cast< int >( value.cols( ) ) );
+    for( int j = 0; j < value.cols( ); j++ )
+    {
+        for( int i = 0; i < value.rows( ); i++ )
+        {
+            writeCheckpointValue( stream, value( i, j ) );
+        }
+    }
+}
+
+//! Function to read an Eigen matrix (size and entries) from a binary checkpoint file
+template< typename ScalarType, int NumberOfRows, int NumberOfColumns, int Options, int MaximumRows, int MaximumColumns >
+void readCheckpointValue(
+        std::istream& stream,
+        Eigen::Matrix< ScalarType, NumberOfRows, NumberOfColumns, Options, MaximumRows, MaximumColumns >& value )
+{
+    int numberOfMatrixRows, numberOfMatrixColumns;
+    readCheckpointValue( stream, numberOfMatrixRows );
+    readCheckpointValue( stream, numberOfMatrixColumns );
+    if( numberOfMatrixRows < 0 || numberOfMatrixColumns < 0 ||
+            ( NumberOfRows != Eigen::Dynamic && numberOfMatrixRows != NumberOfRows ) ||
+            ( NumberOfColumns != Eigen::Dynamic && numberOfMatrixColumns != NumberOfColumns ) )
+    {
+        throw std::runtime_error( "Error when reading propagation checkpoint, matrix size is not compatible." );
+    }
+
+    value.resize( numberOfMatrixRows, numberOfMatrixColumns );
+    for( int j = 0; j < value.cols( ); j++ )
+    {
+        for( int i = 0; i < value.rows( ); i++ )
+        {
+            readCheckpointValue( stream, value( i, j ) );
+        }
+    }
+}
+
+//! Function to write a list of values to a binary checkpoint file
+template< typename ValueType >
+void writeCheckpointValue( std::ostream& stream, const std::vector< ValueType >& values )
+{
+    writeCheckpointValue( stream, static_cast< int >( values.size( ) ) );
+    for( unsigned int i = 0; i < values.size( ); i++ )
+    {
+        writeCheckpointValue( stream, values.at( i ) );
+    }
+}
+
+//! Function to read a list of values from a binary checkpoint file
+template< typename ValueType >
+void readCheckpointValue( std::istream& stream, std::vector< ValueType >& values )
+{
+    int numberOfValues;
+    readCheckpointValue( stream, numberOfValues );
+    if( numberOfValues < 0 )
+    {
+        throw std::runtime_error( "Error when reading propagation checkpoint, list size is negative." );
+    }
+
+    values.resize( numberOfValues );
+    for( int i = 0; i < numberOfValues; i++ )
+    {
+        readCheckpointValue( stream, values.at( i ) );
+    }
+}
+
+//! Function to write a history of values, with time as key, to a binary checkpoint file
+template< typename TimeType, typename ValueType >
+void writeCheckpointValue( std::ostream& stream, const std::map< TimeType, ValueType >& history )
+{
+    writeCheckpointValue( stream, static_cast< int >( history.size( ) ) );
+    for( auto historyIterator : history )
+    {
+        writeCheckpointValue( stream, historyIterator.first );
+        writeCheckpointValue( stream, historyIterator.second );
+    }
+}
+
+//! Function to read a history of values, with time as key, from a binary checkpoint file
+template< typename TimeType, typename ValueType >
+void readCheckpointValue( std::istream& stream, std::map< TimeType, ValueType >& history )
+{
+    int numberOfEntries;
+    readCheckpointValue( stream, numberOfEntries );
+    if( numberOfEntries < 0 )
+    {
+        throw std::runtime_error( "Error when reading propagation checkpoint, history size is negative." );
+    }
+
+    history.clear( );
+    TimeType currentTime;
+    ValueType currentValue;
+    for( int i = 0; i < numberOfEntries; i++ )
+    {
+        readCheckpointValue( stream, currentTime );
+        readCheckpointValue( stream, currentValue );
+        history.insert( history.end( ), std::make_pair( currentTime, currentValue ) );
+    }
+}
+
+//! Function to write the internal state of a numerical integrator to a binary checkpoint file
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+void writeCheckpointValue(
+        std::ostream& stream,
+        const numerical_integrators::NumericalIntegratorCheckpoint<
+        IndependentVariableType, StateType, StateDerivativeType, TimeStepType >& checkpoint )
+{
+    writeCheckpointValue( stream, checkpoint.currentIndependentVariable_ );
+    writeCheckpointValue( stream, checkpoint.currentState_ );
+    writeCheckpointValue( stream, checkpoint.lastIndependentVariable_ );
+    writeCheckpointValue( stream, checkpoint.lastState_ );
+    writeCheckpointValue( stream, checkpoint.stepSize_ );
+    writeCheckpointValue( stream, checkpoint.additionalIntegerValues_ );
+    writeCheckpointValue( stream, checkpoint.additionalStepSizes_ );
+    writeCheckpointValue( stream, checkpoint.additionalStates_ );
+    writeCheckpointValue( stream, checkpoint.additionalStateDerivatives_ );
+}
+
+//! Function to read the internal state of a numerical integrator from a binary checkpoint file
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+void readCheckpointValue(
+        std::istream& stream,
+        numerical_integrators::NumericalIntegratorCheckpoint<
+        IndependentVariableType, StateType, StateDerivativeType, TimeStepType >& checkpoint )
+{
+    readCheckpointValue( stream, checkpoint.currentIndependentVariable_ );
+    readCheckpointValue( stream, checkpoint.currentState_ );
+    readCheckpointValue( stream, checkpoint.lastIndependentVariable_ );
+    readCheckpointValue( stream, checkpoint.lastState_ );
+    readCheckpointValue( stream, checkpoint.stepSize_ );
+    readCheckpointValue( stream, checkpoint.additionalIntegerValues_ );
+    readCheckpointValue( stream, checkpoint.additionalStepSizes_ );
+    readCheckpointValue( stream, checkpoint.additionalStates_ );
+    readCheckpointValue( stream, checkpoint.additionalStateDerivatives_ );
+}
+
+//! Function to write the full state of a single-arc propagation to a binary checkpoint file
+/*!
+ *  Function to write the full state of a single-arc propagation to a binary checkpoint file. The checkpoint is first
+ *  written to a temporary file, which then replaces the existing file (if any), so that an interruption during writing
+ *  does not corrupt a previously written checkpoint.
+ *  \param checkpoint Full state of the propagation
+ *  \param fileName Name of the checkpoint file
+ */
+template< typename StateType, typename TimeType, typename TimeStepType >
+void writeSingleArcPropagationCheckpoint(
+        const SingleArcPropagationCheckpoint< StateType, TimeType, TimeStepType >& checkpoint,
+        const std::string& fileName )
+{
+    std::string temporaryFileName = fileName + ".tmp";
+    {
+        std::ofstream checkpointFile( temporaryFileName, std::ios::binary | std::ios::trunc );
+        if( !checkpointFile.is_open( ) )
+        {
+            throw std::runtime_error( "Error when writing propagation checkpoint, could not open file " + temporaryFileName );
+        }
+
+        writeCheckpointHeader( checkpointFile, sizeof( TimeType ), sizeof( typename StateType::Scalar ) );
+        writeCheckpointValue( checkpointFile, checkpoint.integratorCheckpoint_ );
+        writeCheckpointValue( checkpointFile, checkpoint.initialTime_ );
+        writeCheckpointValue( checkpointFile, checkpoint.elapsedCpuTime_ );
+        writeCheckpointValue( checkpointFile, checkpoint.stepsSinceLastSave_ );
+        writeCheckpointValue( checkpointFile, checkpoint.timeOfLastSave_ );
+        writeCheckpointValue( checkpointFile, checkpoint.stepsSinceLastPrint_ );
+        writeCheckpointValue( checkpointFile, checkpoint.timeOfLastPrint_ );
+        writeCheckpointValue( checkpointFile, checkpoint.sinkPendingTime_ );
+        writeCheckpointValue( checkpointFile, checkpoint.sinkPendingState_ );
+        writeCheckpointValue( checkpointFile, checkpoint.sinkPendingDependentVariables_ );
+        writeCheckpointValue( checkpointFile, checkpoint.solutionHistory_ );
+        writeCheckpointValue( checkpointFile, checkpoint.dependentVariableHistory_ );
+        writeCheckpointValue( checkpointFile, checkpoint.cumulativeComputationTimeHistory_ );
+
+        checkpointFile.close( );
+        if( checkpointFile.fail( ) )
+        {
+            throw std::runtime_error( "Error when writing propagation checkpoint to file " + temporaryFileName );
+        }
+    }
+
+    if( std::rename( temporaryFileName.c_str( ), fileName.c_str( ) ) != 0 )
+    {
+        throw std::runtime_error( "Error when writing propagation checkpoint, could not move file " + temporaryFileName +
+                                  " to " + fileName );
+    }
+}
+
+//! Function to read the full state of a single-arc propagation from a binary checkpoint file
+/*!
+ *  Function to read the full state of a single-arc propagation from a binary checkpoint file, as written by
+ *  writeSingleArcPropagationCheckpoint. An exception is thrown if the file cannot be read, or is not compatible with the
+ *  time and state types.
+ *  \param fileName Name of the checkpoint file
+ *  \return Full state of the propagation
+ */
+template< typename StateType, typename TimeType, typename TimeStepType >
+SingleArcPropagationCheckpoint< StateType, TimeType, TimeStepType > readSingleArcPropagationCheckpoint(
+        const std::string& fileName )
+{
+    std::ifstream checkpointFile( fileName, std::ios::binary );
+    if( !checkpointFile.is_open( ) )
+    {
+        throw std::runtime_error( "Error when reading propagation checkpoint, could not open file " + fileName );
+    }
+
+    SingleArcPropagationCheckpoint< StateType, TimeType, TimeStepType > checkpoint;
+    readCheckpointHeader( checkpointFile, sizeof( TimeType ), sizeof( typename StateType::Scalar ) );
+    readCheckpointValue( checkpointFile, checkpoint.integratorCheckpoint_ );
+    readCheckpointValue( checkpointFile, checkpoint.initialTime_ );
+    readCheckpointValue( checkpointFile, checkpoint.elapsedCpuTime_ );
+    readCheckpointValue( checkpointFile, checkpoint.stepsSinceLastSave_ );
+    readCheckpointValue( checkpointFile, checkpoint.timeOfLastSave_ );
+    readCheckpointValue( checkpointFile, checkpoint.stepsSinceLastPrint_ );
+    readCheckpointValue( checkpointFile, checkpoint.timeOfLastPrint_ );
+    readCheckpointValue( checkpointFile, checkpoint.sinkPendingTime_ );
+    readCheckpointValue( checkpointFile, checkpoint.sinkPendingState_ );
+    readCheckpointValue( checkpointFile, checkpoint.sinkPendingDependentVariables_ );
+    readCheckpointValue( checkpointFile, checkpoint.solutionHistory_ );
+    readCheckpointValue( checkpointFile, checkpoint.dependentVariableHistory_ );
+    readCheckpointValue( checkpointFile, checkpoint.cumulativeComputationTimeHistory_ );
+    return checkpoint;
+}
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_PROPAGATIONCHECKPOINT_H
@@ -86,21 +86,19 @@ public:
             const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& stateOfSystemToBeIntegrated,
             Eigen::Block< Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > > stateDerivative )
     {
-        stateDerivative = Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >::Zero( stateOfSystemToBeIntegrated.rows( ), 1 );
-        std::vector< Eigen::Vector3d > torquesActingOnBodies = this->sumTorquesPerBody( );
+        const std::vector< Eigen::Vector3d >& torquesActingOnBodies = this->sumTorquesPerBody( );
 
         for( unsigned int i = 0; i < torquesActingOnBodies.size( ); i++ )
         {
-            Eigen::Matrix< StateScalarType, 4, 1 > currentExponentialMap = stateOfSystemToBeIntegrated.block( i * 7, 0, 4, 1 );
-            Eigen::Matrix< StateScalarType, 3, 1 > currentBodyFixedRotationRate = stateOfSystemToBeIntegrated.block( i * 7 + 4, 0, 3, 1 );
-
-            stateDerivative.block( i * 7, 0, 4, 1 ) = calculateExponentialMapDerivative(
-                        currentExponentialMap.template cast< double >( ), currentBodyFixedRotationRate.template cast< double >( ) ).
-                    template cast< StateScalarType >( );
-            stateDerivative.block( i * 7 + 4, 0, 3, 1 ) = evaluateRotationalEquationsOfMotion(
-                        this->bodyInertiaTensorFunctions_.at( i )( ), torquesActingOnBodies.at( i ),
-                        currentBodyFixedRotationRate.template cast< double >( ),
-                        this->bodyInertiaTensorTimeDerivativeFunctions_.at( i )( ) ).template cast< StateScalarType >( );
+            const Eigen::Vector4d currentExponentialMap =
+                    stateOfSystemToBeIntegrated.template segment< 4 >( i * 7 ).template cast< double >( );
+            const Eigen::Vector3d currentBodyFixedRotationRate =
+                    stateOfSystemToBeIntegrated.template segment< 3 >( i * 7 + 4 ).template cast< double >( );
+
+            stateDerivative.template block< 4, 1 >( i * 7, 0 ) = calculateExponentialMapDerivative(
+                        currentExponentialMap, currentBodyFixedRotationRate ).template cast< StateScalarType >( );
+            stateDerivative.template block< 3, 1 >( i * 7 + 4, 0 ) = this->computeAngularAcceleration(
+                        i, torquesActingOnBodies[ i ] ).template cast< StateScalarType >( );
         }
     }
 
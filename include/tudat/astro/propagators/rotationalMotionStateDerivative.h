@@ -20,6 +20,7 @@
 #include <functional>
 
 #include "tudat/astro/basic_astro/torqueModel.h"
+#include "tudat/astro/basic_astro/torqueModelTypes.h"
 
 #include "tudat/astro/propagators/singleStateTypeDerivative.h"
 #include "tudat/simulation/environment_setup/body.h"
@@ -59,6 +60,15 @@ Eigen::Vector3d evaluateRotationalEquationsOfMotion(
         const Eigen::Vector3d& angularVelocityVector,
         const Eigen::Matrix3d& inertiaTensorTimeDerivative = Eigen::Matrix3d::Zero( ) );
 
+// Function to compute the inverse of an inertia tensor, checking that the inverse is well-defined
+/*
+ * Function to compute the inverse of an inertia tensor, checking that the inverse is well-defined (throws exception if it
+ * contains NaN entries).
+ * \param inertiaTensor Inertia tensor of body
+ * \return Inverse of inertiaTensor
+ */
+Eigen::Matrix3d computeInverseInertiaTensor( const Eigen::Matrix3d& inertiaTensor );
+
 // Class for computing the state derivative for rotational dynamics of N bodies.
 /*
  *  Class for computing the state derivative for rotational dynamics of N bodies, using quaternion from body-fixed to inertial
@@ -131,6 +141,24 @@ public:
         }
 
         verifyInput( );
+
+        // Flatten list of torque models acting on each body, and pre-allocate torque and inertia tensor buffers
+        torqueModelListPerBody_.resize( bodiesToPropagate_.size( ) );
+        for( unsigned int i = 0; i < bodiesToPropagate_.size( ); i++ )
+        {
+            for( auto innerIterator : torqueModelsPerBody_.at( bodiesToPropagate_.at( i ) ) )
+            {
+                for( unsigned int j = 0; j < innerIterator.second.size( ); j++ )
+                {
+                    torqueModelListPerBody_[ i ].push_back( innerIterator.second.at( j ).get( ) );
+                }
+            }
+        }
+        totalTorquesPerBody_.resize( bodiesToPropagate_.size( ) );
+        currentInertiaTensors_.resize(
+                    bodiesToPropagate_.size( ), Eigen::Matrix3d::Constant( TUDAT_NAN ) );
+        currentInverseInertiaTensors_.resize(
+                    bodiesToPropagate_.size( ), Eigen::Matrix3d::Constant( TUDAT_NAN ) );
     }
 
     // Destructor
@@ -185,6 +213,9 @@ public:
      */
     void updateStateDerivativeModel( const TimeType currentTime )
     {
+#if TUDAT_BUILD_WITH_PROPAGATION_PROFILING
+        int currentModelIndex = 0;
+#endif
         for( torqueModelMapIterator = torqueModelsPerBody_.begin( );
              torqueModelMapIterator != torqueModelsPerBody_.end( ); torqueModelMapIterator++ )
         {
@@ -193,6 +224,8 @@ public:
             {
                 for( unsigned int j = 0; j < innerTorqueIterator->second.size( ); j++ )
                 {
+                    TUDAT_PROFILE_MODEL_EVALUATION(
+                                modelEvaluationProfiler_, torqueUpdateProfilingIndices_[ currentModelIndex++ ] );
                     innerTorqueIterator->second[ j ]->updateMembers( currentTime );
                 }
             }
@@ -215,7 +248,9 @@ public:
             const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& internalSolution, const TimeType& time,
             Eigen::Block< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > currentRotationalState )
     {
-        this->convertToOutputSolution( internalSolution, time, currentRotationalState );
+        // Copy state to pre-allocated matrix, to prevent creation of temporary in conversion to matrix input argument
+        currentInternalSolution_ = internalSolution;
+        this->convertToOutputSolution( currentInternalSolution_, time, currentRotationalState );
     }
 
     // Function to get list of names of bodies that are to be integrated numerically.
@@ -298,6 +333,53 @@ public:
         return propagatorType_;
     }
 
+    // Function to set the object to which the evaluations of the torque models are to be profiled.
+    /*
+     * Function to set the object to which the evaluations of the torque models are to be profiled, registering the update
+     * of each torque model (torque_update category)
+     * \param modelEvaluationProfiler Object to which model evaluations are to be profiled (nullptr to disable profiling)
+     */
+    void setModelEvaluationProfiler(
+            const std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler )
+    {
+        modelEvaluationProfiler_ = modelEvaluationProfiler;
+        torqueUpdateProfilingIndices_.clear( );
+        if( modelEvaluationProfiler_ != nullptr )
+        {
+            // Iterate over torques in same order as updateStateDerivativeModel
+            for( torqueModelMapIterator = torqueModelsPerBody_.begin( );
+                 torqueModelMapIterator != torqueModelsPerBody_.end( ); torqueModelMapIterator++ )
+            {
+                for( innerTorqueIterator = torqueModelMapIterator->second.begin( ); innerTorqueIterator !=
+                     torqueModelMapIterator->second.end( ); innerTorqueIterator++ )
+                {
+                    for( unsigned int j = 0; j < innerTorqueIterator->second.size( ); j++ )
+                    {
+                        std::string torqueName;
+                        try
+                        {
+                            torqueName = basic_astrodynamics::getTorqueModelName(
+                                        basic_astrodynamics::getTorqueModelType( innerTorqueIterator->second.at( j ) ) );
+                        }
+                        catch( const std::runtime_error& )
+                        {
+                            torqueName = "unidentified torque";
+                        }
+
+                        std::string modelName = torqueModelMapIterator->first + " <- " + innerTorqueIterator->first + ": " +
+                                torqueName;
+                        if( j > 0 )
+                        {
+                            modelName += " (" + std::to_string( j ) + ")";
+                        }
+                        torqueUpdateProfilingIndices_.push_back(
+                                    modelEvaluationProfiler_->addProfiledModel( "torque_update", modelName ) );
+                    }
+                }
+            }
+        }
+    }
+
 protected:
 
     void verifyInput( )
@@ -331,34 +413,42 @@ protected:
      * and torque models must have been updated to the current state before calling this
      * function.
      * \return Total torques acting on each body, expressed in the body-fixed frames (in order of bodiesToPropagate_).
+     * The returned reference is to a pre-allocated buffer, which is overwritten on the next call.
      */
-    std::vector< Eigen::Vector3d > sumTorquesPerBody( )
+    const std::vector< Eigen::Vector3d >& sumTorquesPerBody( )
     {
-        using namespace basic_astrodynamics;
-
-        std::vector< Eigen::Vector3d > torques;
-        torques.resize( bodiesToPropagate_.size( ) );
-
-        // Iterate over all bodies with torques
-        for( unsigned int i = 0; i < bodiesToPropagate_.size( ); i++ )
+        // Iterate over all bodies, and flattened list of torques acting on them
+        for( unsigned int i = 0; i < torqueModelListPerBody_.size( ); i++ )
         {
-            torques[ i ].setZero( );
-
-            if( torqueModelsPerBody_.count( bodiesToPropagate_[ i ] ) != 0 )
+            Eigen::Vector3d& currentTorque = totalTorquesPerBody_[ i ];
+            currentTorque.setZero( );
+            for( unsigned int j = 0; j < torqueModelListPerBody_[ i ].size( ); j++ )
             {
-                for( innerTorqueIterator  = torqueModelsPerBody_[ bodiesToPropagate_[ i ] ].begin( );
-                     innerTorqueIterator != torqueModelsPerBody_[ bodiesToPropagate_[ i ] ].end( );
-                     innerTorqueIterator++ )
-                {
-                    for( unsigned int j = 0; j < innerTorqueIterator->second.size( ); j++ )
-                    {
-                        torques[ i ] += ( innerTorqueIterator->second[ j ]->getTorque( ) );
-                    }
-                }
+                currentTorque += torqueModelListPerBody_[ i ][ j ]->getTorque( );
             }
         }
 
-        return torques;
+        return totalTorquesPerBody_;
+    }
+
+    // Function to compute the time-derivative of the angular velocity vector of a single body
+    /*
+     * Function to compute the time-derivative of the angular velocity vector of a single body, expressed in its body-fixed
+     * frame (see evaluateRotationalEquationsOfMotion). The inverse of the inertia tensor is cached, and only recomputed
+     * if the inertia tensor has changed since the previous call (i.e. it is computed only once for a constant-mass body).
+     * \param bodyIndex Index of body in bodiesToPropagate_
+     * \param totalTorque Total torque acting on body, expressed in its body-fixed frame
+     * \return Time-derivative of the body's angular velocity vector, expressed in its body-fixed frame
+     */
+    Eigen::Vector3d computeAngularAcceleration( const unsigned int bodyIndex, const Eigen::Vector3d& totalTorque )
+    {
+        const Eigen::Matrix3d inertiaTensor = bodyInertiaTensorFunctions_[ bodyIndex ]( );
+        if( inertiaTensor != currentInertiaTensors_[ bodyIndex ] )
+        {
+            currentInverseInertiaTensors_[ bodyIndex ] = computeInverseInertiaTensor( inertiaTensor );
+            currentInertiaTensors_[ bodyIndex ] = inertiaTensor;
+        }
+        return currentInverseInertiaTensors_[ bodyIndex ] * totalTorque;
     }
 
     // A map containing the list of torques acting on each body,
@@ -371,6 +461,24 @@ protected:
      */
     basic_astrodynamics::TorqueModelMap torqueModelsPerBody_;
 
+    // List of torque models acting on each body (in order of bodiesToPropagate_), flattened from torqueModelsPerBody_
+    std::vector< std::vector< basic_astrodynamics::TorqueModel* > > torqueModelListPerBody_;
+
+    // Pre-allocated total torque acting on each body (in order of bodiesToPropagate_), set by sumTorquesPerBody
+    std::vector< Eigen::Vector3d > totalTorquesPerBody_;
+
+    // Inertia tensors of bodies at last call of computeAngularAcceleration (NaN if not yet called)
+    std::vector< Eigen::Matrix3d > currentInertiaTensors_;
+
+    // Inverses of currentInertiaTensors_
+    std::vector< Eigen::Matrix3d > currentInverseInertiaTensors_;
+
+    // Object to which the model evaluations are profiled (nullptr if not profiled)
+    std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler_;
+
+    // Indices in modelEvaluationProfiler_ of the update of each torque model (in order of iteration over torqueModelsPerBody_)
+    std::vector< int > torqueUpdateProfilingIndices_;
+
     // Type of propagator that is to be used (i.e., quaternions, etc.)
     RotationalPropagatorType propagatorType_;
 
@@ -389,6 +497,9 @@ protected:
     // Predefined iterator to save (de-)allocation time.
     basic_astrodynamics::SingleBodyTorqueModelMap::iterator innerTorqueIterator;
 
+    // Pre-allocated copy of propagated state, used in convertCurrentStateToGlobalRepresentation
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > currentInternalSolution_;
+
 };
 
 
@@ -12,9 +12,11 @@
 #define TUDAT_STATEDERIVATIVE_H
 
 #include <map>
+#include <memory>
 
 #include <Eigen/Core>
 
+#include "tudat/basics/modelEvaluationProfiler.h"
 #include "tudat/basics/timeType.h"
 #include <tudat/basics/utilityMacros.h>
 
@@ -176,6 +178,27 @@ public:
             const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& internalSolution, const TimeType& time,
             Eigen::Block< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > currentCartesianLocalSoluton ) = 0;
 
+    // Function to convert a history of propagator-specific states to the conventional form in a single batch.
+    /*
+     * Function to convert a history of propagator-specific states to the conventional form (see convertToOutputSolution)
+     * in a single batch, which may be distributed over multiple threads. This is only implemented for state types for which
+     * the conversion does not depend on time (or on the environment), and which do not need to retain any information
+     * from the conversion. For other state types, this function returns false, and the states are to be converted one
+     * by one using convertToOutputSolution.
+     * \param internalSolutions States in propagator-specific form, one epoch per column
+     * \param outputSolutions States (internalSolutions), converted to the 'conventional form', one epoch per column
+     * (returned by reference)
+     * \param numberOfThreads Maximum number of threads over which the conversion is distributed
+     * \return True if the states were converted, false if batch conversion is not supported by this state type
+     */
+    virtual bool convertToOutputSolutionBatch(
+            const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& internalSolutions,
+            Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& outputSolutions,
+            const int numberOfThreads )
+    {
+        return false;
+    }
+
     // Function to return the size of the conventional state handled by the object.
     /*
      * Function to return the size of the conventional state handled by the object. This is the size of the conventional
@@ -216,6 +239,19 @@ public:
         TUDAT_UNUSED_PARAMETER( unprocessedState );
     }
 
+    // Function to process the state vector after an integration step, at the time of the step.
+    /*
+     * Function to process the state after an integration step, for processing that depends on the epoch of the
+     * state (e.g., rectification of a reference orbit). By default, the time-independent post-processing is performed.
+     * \param unprocessedState State computed after propagation.
+     * \param currentTime Time at which the state is valid.
+     */
+    virtual void postProcessState( Eigen::Block< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > unprocessedState,
+                                   const TimeType currentTime )
+    {
+        postProcessState( unprocessedState );
+    }
+
     virtual void postProcessState( Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& unprocessedState )
     {
         unprocessedState_ = unprocessedState.block( 0, 0, getPropagatedStateSize( ), 1 );
@@ -233,6 +269,15 @@ public:
         return false;
     }
 
+    // Function to set the object to which the evaluations of the models of this state derivative are to be profiled.
+    /*
+     * Function to set the object to which the evaluations of the models (e.g. acceleration models) of this state derivative
+     * are to be profiled. Default implementation is empty (i.e. no models are profiled).
+     * \param modelEvaluationProfiler Object to which model evaluations are to be profiled (nullptr to disable profiling)
+     */
+    virtual void setModelEvaluationProfiler(
+            const std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler ){ }
+
 protected:
 
     // Type of dynamics for which the state derivative is calculated.
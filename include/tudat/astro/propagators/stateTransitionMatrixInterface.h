@@ -12,6 +12,9 @@
 #define TUDAT_STATETRANSITIONMATRIXINTERFACE_H
 
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <tuple>
 #include <vector>
 
 #include <memory>
@@ -29,6 +32,23 @@ namespace tudat
 namespace propagators
 {
 
+//! Function to interpolate a block of rows of a matrix-valued interpolator, writing the result into a given block
+/*!
+ *  Function to interpolate a block of rows of a matrix-valued interpolator, writing the result into a given block. For
+ *  a Lagrange interpolator, only the requested rows are interpolated (see LagrangeInterpolator::interpolateRows), for
+ *  other interpolators the full matrix is interpolated, and the requested rows are retrieved from it.
+ *  \param matrixInterpolator Interpolator returning a matrix as a function of time
+ *  \param evaluationTime Time at which to evaluate the interpolator
+ *  \param startRow Index of first row that is to be interpolated
+ *  \param interpolatedRows Block into which the interpolated rows are written (returned by reference), the size of which
+ *  determines the number of rows (and columns) that are interpolated.
+ */
+void interpolateMatrixRows(
+        const std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > > matrixInterpolator,
+        const double evaluationTime,
+        const int startRow,
+        Eigen::Block< Eigen::MatrixXd > interpolatedRows );
+
 //! Base class for interface object of interpolation of numerically propagated state transition and sensitivity matrices.
 /*!
  *  Base class for interface object of interpolation of numerically propagated state transition and sensitivity matrices.
@@ -47,7 +67,8 @@ public:
      */
     CombinedStateTransitionAndSensitivityMatrixInterface(
             const int numberOfInitialDynamicalParameters,
-            const int numberOfParameters )
+            const int numberOfParameters ):
+        useMatrixCaching_( false ), maximumNumberOfCachedMatrices_( 0 )
     {
         stateTransitionMatrixSize_ = numberOfInitialDynamicalParameters;
         sensitivityMatrixSize_ = numberOfParameters - stateTransitionMatrixSize_;
@@ -79,6 +100,89 @@ public:
                                                                                 const bool addCentralBodyDependency = true,
                                                                                 const std::vector< std::string >& arcDefiningBodies = std::vector< std::string >( ) ) = 0;
 
+    //! Function to get a block of rows of the full concatenated state transition and sensitivity matrix at a given time.
+    /*!
+     *  Function to get a block of rows of the full concatenated state transition and sensitivity matrix at a given time,
+     *  (i.e. the given rows of the matrix returned by getFullCombinedStateTransitionAndSensitivityMatrix), written into
+     *  a matrix provided by the caller (which is only resized if its size is not correct). Where possible, only the
+     *  requested rows are interpolated. If matrix caching is enabled (see setMatrixCaching), the rows are computed only
+     *  once for each combination of input arguments. This function may be called concurrently.
+     *  \param evaluationTime Time at which to evaluate matrix interpolators
+     *  \param startRow Index of first row of full matrix that is to be retrieved
+     *  \param numberOfRows Number of rows of full matrix that are to be retrieved
+     *  \param matrixRows Requested rows of the concatenated state transition and sensitivity matrices (returned by
+     *  reference).
+     *  \param addCentralBodyDependency Boolean denoting whether the dependency on the estimated state of the central
+     *  body is to be added
+     *  \param arcDefiningBodies Bodies defining the arc in which evaluationTime is located (multi-arc only)
+     */
+    void getFullCombinedStateTransitionAndSensitivityMatrixRows(
+            const double evaluationTime,
+            const int startRow,
+            const int numberOfRows,
+            Eigen::MatrixXd& matrixRows,
+            const bool addCentralBodyDependency = true,
+            const std::vector< std::string >& arcDefiningBodies = std::vector< std::string >( ) )
+    {
+        if( useMatrixCaching_ )
+        {
+            std::lock_guard< std::mutex > lock( cacheMutex_ );
+            auto cacheIterator = cachedMatrixRows_.find(
+                        std::make_tuple( evaluationTime, startRow, numberOfRows, addCentralBodyDependency, arcDefiningBodies ) );
+            if( cacheIterator != cachedMatrixRows_.end( ) )
+            {
+                matrixRows = cacheIterator->second;
+                return;
+            }
+        }
+
+        computeFullCombinedStateTransitionAndSensitivityMatrixRows(
+                    evaluationTime, startRow, numberOfRows, matrixRows, addCentralBodyDependency, arcDefiningBodies );
+
+        if( useMatrixCaching_ )
+        {
+            std::lock_guard< std::mutex > lock( cacheMutex_ );
+            if( static_cast< int >( cachedMatrixRows_.size( ) ) < maximumNumberOfCachedMatrices_ )
+            {
+                cachedMatrixRows_.insert(
+                            std::make_pair( std::make_tuple( evaluationTime, startRow, numberOfRows,
+                                                             addCentralBodyDependency, arcDefiningBodies ), matrixRows ) );
+            }
+        }
+    }
+
+    //! Function to set whether the rows of the full combined matrix are cached.
+    /*!
+     *  Function to set whether the rows of the full combined matrix, as retrieved by
+     *  getFullCombinedStateTransitionAndSensitivityMatrixRows, are cached. If so, a subsequent call with equal input
+     *  (e.g. for different observables of the same link at the same epoch) returns the stored rows, without
+     *  interpolating the matrices. The cached rows are only valid as long as the matrix interpolators are unchanged, so
+     *  caching should only be enabled for a single pass over the observations. Once the maximum number of cached entries
+     *  is reached, no new entries are added. The cache is cleared whenever this function is called.
+     *  \param useMatrixCaching Boolean denoting whether rows of full combined matrices are to be cached
+     *  \param maximumNumberOfCachedMatrices Maximum number of row blocks that are stored in the cache
+     */
+    void setMatrixCaching( const bool useMatrixCaching, const int maximumNumberOfCachedMatrices = 10000 )
+    {
+        std::lock_guard< std::mutex > lock( cacheMutex_ );
+        useMatrixCaching_ = useMatrixCaching;
+        maximumNumberOfCachedMatrices_ = maximumNumberOfCachedMatrices;
+        cachedMatrixRows_.clear( );
+    }
+
+    //! Function to retrieve whether the rows of the full combined matrix are cached.
+    bool getUseMatrixCaching( )
+    {
+        return useMatrixCaching_;
+    }
+
+    //! Function to retrieve the number of row blocks of the full combined matrix that are currently cached.
+    int getNumberOfCachedMatrices( )
+    {
+        std::lock_guard< std::mutex > lock( cacheMutex_ );
+        return cachedMatrixRows_.size( );
+    }
+
     //! Function to get the size of state transition matrix
     /*!
      * Function to get the size of state transition matrix
@@ -106,14 +210,78 @@ public:
      */
     virtual int getFullParameterVectorSize( ) = 0;
 
+    //! Function to retrieve the (heap) memory held by this interface (interpolators and cached matrix rows)
+    /*!
+     *  Function to retrieve the (heap) memory held by this interface. This base class function returns the memory held by
+     *  the cached rows of the full matrix; derived classes add the memory held by their matrix interpolators.
+     *  \return Memory held by this interface
+     */
+    virtual utilities::MemoryFootprint getMemoryFootprint( )
+    {
+        utilities::MemoryFootprint memoryFootprint;
+        std::lock_guard< std::mutex > lock( cacheMutex_ );
+        memoryFootprint.addEntry( "matrix_row_cache", utilities::getHeapMemorySize( cachedMatrixRows_ ) );
+        return memoryFootprint;
+    }
+
 protected:
 
+    //! Function to compute a block of rows of the full concatenated state transition and sensitivity matrix at a given time.
+    /*!
+     *  Function to compute a block of rows of the full concatenated state transition and sensitivity matrix at a given
+     *  time, called by getFullCombinedStateTransitionAndSensitivityMatrixRows if no cached value is available. By
+     *  default, the full matrix is computed, from which the rows are retrieved; derived classes may override this to
+     *  interpolate only the requested rows.
+     *  \param evaluationTime Time at which to evaluate matrix interpolators
+     *  \param startRow Index of first row of full matrix that is to be retrieved
+     *  \param numberOfRows Number of rows of full matrix that are to be retrieved
+     *  \param matrixRows Requested rows of the concatenated state transition and sensitivity matrices (returned by
+     *  reference).
+     *  \param addCentralBodyDependency Boolean denoting whether the dependency on the estimated state of the central
+     *  body is to be added
+     *  \param arcDefiningBodies Bodies defining the arc in which evaluationTime is located (multi-arc only)
+     */
+    virtual void computeFullCombinedStateTransitionAndSensitivityMatrixRows(
+            const double evaluationTime,
+            const int startRow,
+            const int numberOfRows,
+            Eigen::MatrixXd& matrixRows,
+            const bool addCentralBodyDependency,
+            const std::vector< std::string >& arcDefiningBodies )
+    {
+        matrixRows = getFullCombinedStateTransitionAndSensitivityMatrix(
+                    evaluationTime, addCentralBodyDependency, arcDefiningBodies ).block(
+                    startRow, 0, numberOfRows, getFullParameterVectorSize( ) );
+    }
+
+    //! Function to clear all cached rows of the full combined matrix (called when matrix interpolators are reset).
+    void clearMatrixCache( )
+    {
+        std::lock_guard< std::mutex > lock( cacheMutex_ );
+        cachedMatrixRows_.clear( );
+    }
+
     //! Size of state transition matrix
     int stateTransitionMatrixSize_;
 
     //! Number of columns of sensitivity matrix.
     int sensitivityMatrixSize_;
 
+private:
+
+    //! Boolean denoting whether rows of the full combined matrix are cached.
+    bool useMatrixCaching_;
+
+    //! Maximum number of row blocks that are stored in the cache
+    int maximumNumberOfCachedMatrices_;
+
+    //! Cached rows of full combined matrix, with input arguments of getFullCombinedStateTransitionAndSensitivityMatrixRows
+    //! (evaluation time, start row, number of rows, central body dependency, arc defining bodies) as key
+    std::map< std::tuple< double, int, int, bool, std::vector< std::string > >, Eigen::MatrixXd > cachedMatrixRows_;
+
+    //! Mutex for access to cachedMatrixRows_, so that matrix rows can be retrieved concurrently
+    std::mutex cacheMutex_;
+
 };
 
 //! Interface object of interpolation of numerically propagated state transition and sensitivity matrices for single-arc
@@ -144,9 +312,6 @@ public:
         stateTransitionMatrixInterpolator_( stateTransitionMatrixInterpolator ),
         sensitivityMatrixInterpolator_( sensitivityMatrixInterpolator )
     {
-        combinedStateTransitionMatrix_ = Eigen::MatrixXd::Zero(
-                        stateTransitionMatrixSize_, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
-
         // Re-order state partial addition indices to match ephemeris update order (inverted in variational equations object)
         statePartialAdditionIndices_.clear( );
         for ( int i = statePartialAdditionIndices.size( ) - 1; i >= 0 ; i-- )
@@ -230,15 +395,49 @@ public:
         return sensitivityMatrixSize_ + stateTransitionMatrixSize_;
     }
 
+    //! Function to retrieve the (heap) memory held by this interface (interpolators and cached matrix rows)
+    utilities::MemoryFootprint getMemoryFootprint( )
+    {
+        utilities::MemoryFootprint memoryFootprint = CombinedStateTransitionAndSensitivityMatrixInterface::getMemoryFootprint( );
+        memoryFootprint.addEntry( "state_transition_matrix_interpolators",
+                                  ( stateTransitionMatrixInterpolator_ == nullptr ) ?
+                                      0 : stateTransitionMatrixInterpolator_->getHeapMemorySize( ) );
+        memoryFootprint.addEntry( "sensitivity_matrix_interpolators",
+                                  ( sensitivityMatrixInterpolator_ == nullptr ) ?
+                                      0 : sensitivityMatrixInterpolator_->getHeapMemorySize( ) );
+        return memoryFootprint;
+    }
+
     std::vector< std::pair< int, int > > getStatePartialAdditionIndices( )
     {
         return statePartialAdditionIndices_;
     }
 
-private:
+protected:
 
-    //! Predefined matrix to use as return value when calling getCombinedStateTransitionAndSensitivityMatrix.
-    Eigen::MatrixXd combinedStateTransitionMatrix_;
+    //! Function to compute a block of rows of the concatenated state transition and sensitivity matrix at a given time.
+    /*!
+     *  Function to compute a block of rows of the concatenated state transition and sensitivity matrix at a given
+     *  time. Only the requested rows are interpolated, unless the dependency on the central body is to be added (in
+     *  which case other rows are needed as well, and full matrices are interpolated).
+     *  \param evaluationTime Time at which to evaluate matrix interpolators
+     *  \param startRow Index of first row of matrix that is to be retrieved
+     *  \param numberOfRows Number of rows of matrix that are to be retrieved
+     *  \param matrixRows Requested rows of the concatenated state transition and sensitivity matrices (returned by
+     *  reference).
+     *  \param addCentralBodyDependency Boolean denoting whether the dependency on the estimated state of the central
+     *  body is to be added
+     *  \param arcDefiningBodies Bodies defining the arc (not used for single-arc)
+     */
+    void computeFullCombinedStateTransitionAndSensitivityMatrixRows(
+            const double evaluationTime,
+            const int startRow,
+            const int numberOfRows,
+            Eigen::MatrixXd& matrixRows,
+            const bool addCentralBodyDependency,
+            const std::vector< std::string >& arcDefiningBodies );
+
+private:
 
     //! Interpolator returning the state transition matrix as a function of time.
     std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
@@ -354,6 +553,7 @@ public:
     {
         stateTransitionMatrixInterpolators_ = stateTransitionMatrixInterpolators;
         sensitivityMatrixInterpolators_ = sensitivityMatrixInterpolators;
+        clearMatrixCache( );
         arcStartTimes_ =  arcStartTimes;
         arcEndTimes_ = arcEndTimes;
 
@@ -391,6 +591,28 @@ public:
         }
     }
 
+    //! Function to reset the state transition and sensitivity matrix interpolators of a single arc
+    /*!
+     * Function to reset the state transition and sensitivity matrix interpolators of a single arc, leaving those of the
+     * other arcs (and the arc start and end times) unchanged. Used when the variational equations are processed arc by arc,
+     * in which case the interpolators of an arc may be released (set to nullptr) once it has been processed. The matrices
+     * may not be retrieved at epochs in an arc for which no interpolators are set.
+     * \param arcIndex Index of the arc for which the interpolators are to be reset
+     * \param stateTransitionMatrixInterpolator New interpolator returning the state transition matrix of the arc
+     * \param sensitivityMatrixInterpolator New interpolator returning the sensitivity matrix of the arc
+     */
+    void resetSingleArcMatrixInterpolators(
+            const int arcIndex,
+            const std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
+            stateTransitionMatrixInterpolator,
+            const std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
+            sensitivityMatrixInterpolator )
+    {
+        stateTransitionMatrixInterpolators_.at( arcIndex ) = stateTransitionMatrixInterpolator;
+        sensitivityMatrixInterpolators_.at( arcIndex ) = sensitivityMatrixInterpolator;
+        clearMatrixCache( );
+    }
+
     //! Function to get the vector of interpolators returning the state transition matrix as a function of time.
     /*!
      * Function to get the vector of interpolators returning the state transition matrix as a function of time.
@@ -423,6 +645,22 @@ public:
         return fullStateTransitionMatrixSize_ + fullSensitivityMatrixSize_;
     }
 
+    //! Function to retrieve the (heap) memory held by this interface (interpolators of all arcs and cached matrix rows)
+    utilities::MemoryFootprint getMemoryFootprint( )
+    {
+        utilities::MemoryFootprint memoryFootprint = CombinedStateTransitionAndSensitivityMatrixInterface::getMemoryFootprint( );
+        for( unsigned int i = 0; i < stateTransitionMatrixInterpolators_.size( ); i++ )
+        {
+            memoryFootprint.addEntry( "state_transition_matrix_interpolators",
+                                      ( stateTransitionMatrixInterpolators_.at( i ) == nullptr ) ?
+                                          0 : stateTransitionMatrixInterpolators_.at( i )->getHeapMemorySize( ) );
+            memoryFootprint.addEntry( "sensitivity_matrix_interpolators",
+                                      ( sensitivityMatrixInterpolators_.at( i ) == nullptr ) ?
+                                          0 : sensitivityMatrixInterpolators_.at( i )->getHeapMemorySize( ) );
+        }
+        return memoryFootprint;
+    }
+
     //! Function to get the concatenated single-arc state transition and sensitivity matrix at a given time.
     /*!
      *  Function to get the concatenated single-arc state transition and sensitivity matrix at a given time, evaluates matrices
@@ -934,6 +1172,15 @@ public:
         return multiArcInterface_->getFullParameterVectorSize( ) - singleArcStateSize_ * ( numberOfMultiArcs_ - 1 );
     }
 
+    //! Function to retrieve the (heap) memory held by this interface (single- and multi-arc interfaces, and cached rows)
+    utilities::MemoryFootprint getMemoryFootprint( )
+    {
+        utilities::MemoryFootprint memoryFootprint = CombinedStateTransitionAndSensitivityMatrixInterface::getMemoryFootprint( );
+        memoryFootprint.addFootprint( singleArcInterface_->getMemoryFootprint( ), "single_arc" );
+        memoryFootprint.addFootprint( multiArcInterface_->getMemoryFootprint( ), "multi_arc" );
+        return memoryFootprint;
+    }
+
     //! Function to get the concatenated state transition and sensitivity matrix at a given time.
     /*!
      *  Function to get the concatenated state transition and sensitivity matrix at a given time. Only the state transition
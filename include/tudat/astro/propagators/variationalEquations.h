@@ -11,11 +11,13 @@
 #define TUDAT_VARIATIONALEQUATIONS_H
 
 #include <map>
+#include <numeric>
 #include <string>
 #include <vector>
 
 #include <memory>
 
+#include "tudat/basics/scratchArena.h"
 #include "tudat/math/basic/linearAlgebra.h"
 
 #include "tudat/astro/basic_astro/accelerationModel.h"
@@ -33,6 +35,40 @@ namespace tudat
 namespace propagators
 {
 
+//! Single entry in the list of partial derivative functions that are evaluated to set up the variational equations.
+struct VariationalEquationsPartialBlock
+{
+    //! Constructor
+    /*!
+     * Constructor
+     * \param rowIndex Start row of block in which partial is to be set
+     * \param columnIndex Start column of block in which partial is to be set
+     * \param numberOfRows Number of rows of block in which partial is to be set
+     * \param numberOfColumns Number of columns of block in which partial is to be set
+     * \param partialFunction Function adding the partial to a given matrix block
+     */
+    VariationalEquationsPartialBlock(
+            const int rowIndex, const int columnIndex, const int numberOfRows, const int numberOfColumns,
+            const std::function< void( Eigen::Block< Eigen::MatrixXd > ) >& partialFunction ):
+        rowIndex_( rowIndex ), columnIndex_( columnIndex ), numberOfRows_( numberOfRows ),
+        numberOfColumns_( numberOfColumns ), partialFunction_( partialFunction ){ }
+
+    //! Start row of block in which partial is to be set
+    int rowIndex_;
+
+    //! Start column of block in which partial is to be set
+    int columnIndex_;
+
+    //! Number of rows of block in which partial is to be set
+    int numberOfRows_;
+
+    //! Number of columns of block in which partial is to be set
+    int numberOfColumns_;
+
+    //! Function adding the partial to a given matrix block
+    std::function< void( Eigen::Block< Eigen::MatrixXd > ) > partialFunction_;
+};
+
 //! Class from which the variational equations can be evaluated.
 /*!
  *  Class from which the variational equations can be evaluated. The time derivative of the state transition  and
@@ -67,7 +103,7 @@ public:
             const int currentArcIndex = -1,
             const std::map< std::string, int > arcIndicesPerBody = std::map< std::string, int >( ) ):
         stateDerivativePartialList_( stateDerivativePartialList ), stateTypeStartIndices_( stateTypeStartIndices ),
-        couplingEntriesToSuppress_( -1 )
+        couplingEntriesToSuppress_( -1 ), areDynamicsFreeParameterColumnsOmitted_( false )
     {
         dynamicalStatesToEstimate_ =
                 estimatable_parameters::getListOfInitialDynamicalStateParametersEstimate< ParameterType >(
@@ -116,6 +152,9 @@ public:
         }
         setRotationalStatePartialScalingFunctions( parametersToEstimate );
         setParameterPartialFunctionList( parametersToEstimate );
+
+        // Assemble partial function lists into contiguous lists of blocks that are evaluated
+        setPartialBlockLists( );
     }
 
     //! Calculates matrix containing partial derivatives of state derivatives w.r.t. body state.
@@ -136,21 +175,45 @@ public:
      */
     template< typename StateScalarType >
     void getBodyInitialStatePartialMatrix(
-            const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& stateTransitionAndSensitivityMatrices,
+            const Eigen::Ref< const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > >&
+            stateTransitionAndSensitivityMatrices,
             Eigen::Block< Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > > currentMatrixDerivative )
     {
         setBodyStatePartialMatrix( );
 
-        // Add partials of body positions and velocities.
-        currentMatrixDerivative.block( 0, 0, totalDynamicalStateSize_, numberOfParameterValues_ ) =
-                ( variationalMatrix_.template cast< StateScalarType >( ) * stateTransitionAndSensitivityMatrices );
+        // Time derivative of position partials is equal to velocity partials
+        for( unsigned int i = 0; i < kinematicPositionRowIndices_.size( ); i++ )
+        {
+            currentMatrixDerivative.block( kinematicPositionRowIndices_.at( i ), 0, 3, numberOfParameterValues_ ) =
+                    stateTransitionAndSensitivityMatrices.block(
+                        kinematicPositionRowIndices_.at( i ) + 3, 0, 3, numberOfParameterValues_ );
+        }
+
+        // Add partials of remaining rows, using only the column blocks of variationalMatrix_ that can be non-zero
+        for( unsigned int i = 0; i < variationalMatrixRowBlocks_.size( ); i++ )
+        {
+            const int startRow = variationalMatrixRowBlocks_.at( i ).first;
+            const int numberOfRows = variationalMatrixRowBlocks_.at( i ).second;
+
+            currentMatrixDerivative.block( startRow, 0, numberOfRows, numberOfParameterValues_ ).setZero( );
+            for( unsigned int j = 0; j < variationalMatrixColumnBlocks_.size( ); j++ )
+            {
+                const int startColumn = variationalMatrixColumnBlocks_.at( j ).first;
+                const int numberOfColumns = variationalMatrixColumnBlocks_.at( j ).second;
+
+                currentMatrixDerivative.block( startRow, 0, numberOfRows, numberOfParameterValues_ ).noalias( ) +=
+                        variationalMatrix_.block( startRow, startColumn, numberOfRows, numberOfColumns ).template
+                        cast< StateScalarType >( ) *
+                        stateTransitionAndSensitivityMatrices.block( startColumn, 0, numberOfColumns, numberOfParameterValues_ );
+            }
+        }
 
         if( couplingEntriesToSuppress_ > 0 )
         {
             int numberOfStaticParameters = numberOfParameterValues_ - totalDynamicalStateSize_;
             int numberOfUncoupledEntries = totalDynamicalStateSize_ - couplingEntriesToSuppress_;
 
-            currentMatrixDerivative.block( couplingEntriesToSuppress_, totalDynamicalStateSize_, numberOfUncoupledEntries, numberOfStaticParameters ) =
+            currentMatrixDerivative.block( couplingEntriesToSuppress_, totalDynamicalStateSize_, numberOfUncoupledEntries, numberOfStaticParameters ).noalias( ) =
                     variationalMatrix_.template cast< StateScalarType >( ).block(
                         couplingEntriesToSuppress_, couplingEntriesToSuppress_,
                         numberOfUncoupledEntries, numberOfUncoupledEntries ) *
@@ -173,41 +236,26 @@ public:
         // Initialize matrix to zeros
         variationalParameterMatrix_.setZero( );
 
-        // Iterate over all bodies undergoing accelerations for which initial condition is to be estimated.
-        for( std::map< IntegratedStateType, std::vector< std::multimap< std::pair< int, int >,
-             std::function< void( Eigen::Block< Eigen::MatrixXd > ) > > > >::iterator typeIterator =
-             parameterPartialList_.begin( ); typeIterator != parameterPartialList_.end( ); typeIterator++ )
+        // Evaluate all parameter partial functions determined by setParameterPartialFunctionList( )
+        for( unsigned int i = 0; i < parameterPartialBlocks_.size( ); i++ )
         {
-            int startIndex = stateTypeStartIndices_.at( typeIterator->first );
-            int currentStateSize = getSingleIntegrationSize( typeIterator->first );
-            int entriesToSkipPerEntry = currentStateSize - getGeneralizedAccelerationSize( typeIterator->first );
-
-            // Iterate over all bodies being estimated.
-            for( unsigned int i = 0; i < typeIterator->second.size( ); i++ )
-            {
-                // Iterate over all parameter partial functions determined by setParameterPartialFunctionList( )
-                for( functionIterator = typeIterator->second[ i ].begin( );
-                     functionIterator != typeIterator->second[ i ].end( );
-                     functionIterator++ )
-                {
-                    functionIterator->second(
-                                variationalParameterMatrix_.block(
-                                    startIndex + entriesToSkipPerEntry + currentStateSize * i,
-                                    functionIterator->first.first - totalDynamicalStateSize_,
-                                    currentStateSize - entriesToSkipPerEntry,
-                                    functionIterator->first.second ) );
-                }
-            }
+            parameterPartialBlocks_[ i ].partialFunction_(
+                        variationalParameterMatrix_.block(
+                            parameterPartialBlocks_[ i ].rowIndex_, parameterPartialBlocks_[ i ].columnIndex_,
+                            parameterPartialBlocks_[ i ].numberOfRows_, parameterPartialBlocks_[ i ].numberOfColumns_ ) );
         }
 
+        const int numberOfStaticParameters = numberOfParameterValues_ - totalDynamicalStateSize_;
         for( unsigned int i = 0; i < inertiaTensorsForMultiplication_.size( ); i++ )
         {
-            variationalParameterMatrix_.block( inertiaTensorsForMultiplication_.at( i ).first, 0, 3,
-                                               numberOfParameterValues_ - totalDynamicalStateSize_ ) =
-                    ( inertiaTensorsForMultiplication_.at( i ).second( ).inverse( ) ) *
-                    variationalParameterMatrix_.block(
-                        inertiaTensorsForMultiplication_.at( i ).first, 0, 3,
-                        numberOfParameterValues_ - totalDynamicalStateSize_ ).eval( );
+            // Copy torque partials to scratch memory, to prevent aliasing in multiplication with inverse inertia tensor
+            Eigen::Map< Eigen::MatrixXd > unscaledTorquePartials = utilities::getScratchMatrix(
+                        3, numberOfStaticParameters, unscaledTorquePartialsFallback_ );
+            unscaledTorquePartials = variationalParameterMatrix_.block(
+                        inertiaTensorsForMultiplication_.at( i ).first, 0, 3, numberOfStaticParameters );
+            variationalParameterMatrix_.block(
+                        inertiaTensorsForMultiplication_.at( i ).first, 0, 3, numberOfStaticParameters ).noalias( ) =
+                    ( inertiaTensorsForMultiplication_.at( i ).second( ).inverse( ) ) * unscaledTorquePartials;
         }
 
         currentMatrixDerivative.block( 0, totalDynamicalStateSize_, totalDynamicalStateSize_,
@@ -229,7 +277,7 @@ public:
      */
     template< typename StateScalarType >
     void evaluateVariationalEquations(
-            const double time, const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >&
+            const double time, const Eigen::Ref< const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > >&
             stateTransitionAndSensitivityMatrices,
             Eigen::Block< Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > > currentMatrixDerivative )
     {
@@ -261,7 +309,7 @@ public:
      */
     template< typename StateScalarType >
     void updatePartials( const double currentTime,
-                         const std::unordered_map< IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >
+                         const std::unordered_map< IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >&
                          currentStatesPerTypeInConventionalRepresentation )
     {
         for( auto stateIterator = currentStatesPerTypeInConventionalRepresentation.begin( );
@@ -317,6 +365,35 @@ public:
     {
         return statePartialAdditionIndices_;
     }
+
+    //! Function to omit the sensitivity matrix columns of parameters that do not influence the dynamics
+    /*!
+     *  Function to omit the sensitivity matrix columns of parameters that do not influence the dynamics (e.g.
+     *  observation biases, ground station positions) from the propagated variational equations. For such parameters,
+     *  there is no partial derivative of the state derivative w.r.t. the parameter, so that (with a zero initial
+     *  value) their columns of the sensitivity matrix are zero at all times. After calling this function, the
+     *  propagated sensitivity matrix contains only the columns of parameters for which at least one parameter partial
+     *  exists, in the same order as in the full parameter vector, and getNumberOfParameterValues returns the reduced
+     *  size.
+     *  \return Indices (in the full sensitivity matrix) of the columns that are propagated
+     */
+    std::vector< int > omitDynamicsFreeParameterColumns( );
+
+    //! Function to retrieve the indices (in the full sensitivity matrix) of the propagated sensitivity matrix columns
+    /*!
+     *  Function to retrieve the indices (in the full sensitivity matrix) of the propagated sensitivity matrix columns
+     *  \return Indices of propagated sensitivity matrix columns
+     */
+    std::vector< int > getPropagatedSensitivityColumnIndices( )
+    {
+        if( !areDynamicsFreeParameterColumnsOmitted_ )
+        {
+            std::vector< int > columnIndices( numberOfParameterValues_ - totalDynamicalStateSize_ );
+            std::iota( columnIndices.begin( ), columnIndices.end( ), 0 );
+            return columnIndices;
+        }
+        return propagatedSensitivityColumnIndices_;
+    }
     
     void suppressParameterCoupling( const int couplingEntriesToSuppress )
     {
@@ -334,6 +411,15 @@ private:
      */
     void setStatePartialFunctionList( );
 
+    //! Function (called by constructor) to assemble the partial function lists into the lists of blocks that are evaluated
+    /*!
+     * Function (called by constructor) to assemble the statePartialList_ and parameterPartialList_ members into
+     * flat lists of blocks (statePartialBlocks_ and parameterPartialBlocks_), with the indices in the matrix of
+     * each block precomputed. Also determines the sparsity structure of variationalMatrix_ that is used when
+     * multiplying it with the state transition and sensitivity matrices.
+     */
+    void setPartialBlockLists( );
+
     //! Function to add parameter partial functions for single state derivative model, and set of parameter objects.
     /*!
      *  Function to add parameter partial functions for single state derivative model, and set of parameter objects.
@@ -587,9 +673,20 @@ private:
     std::vector< std::multimap< std::pair< int, int >, std::function< void( Eigen::Block< Eigen::MatrixXd > ) > > > >
     statePartialList_;
     
-    //! Pre-defined iterator for efficiency.
-    std::multimap< std::pair< int, int >, std::function< void( Eigen::Block< Eigen::MatrixXd > ) > >::iterator
-    statePartialIterator_;
+    //! Start columns and sizes of the blocks of the functions in statePartialList_ in which the partials can be non-zero
+    std::vector< std::pair< int, int > > statePartialNonZeroColumnBlocks_;
+
+    //! List of blocks of variationalMatrix_ that are set by the functions in statePartialList_
+    std::vector< VariationalEquationsPartialBlock > statePartialBlocks_;
+
+    //! Start rows of position partials of translational states, for which time derivatives are equal to velocity partials
+    std::vector< int > kinematicPositionRowIndices_;
+
+    //! Start rows and sizes of (contiguous) row blocks of variationalMatrix_, other than those in kinematicPositionRowIndices_
+    std::vector< std::pair< int, int > > variationalMatrixRowBlocks_;
+
+    //! Start columns and sizes of (contiguous) column blocks of variationalMatrix_ in which the entries can be non-zero
+    std::vector< std::pair< int, int > > variationalMatrixColumnBlocks_;
     
     //! Vector of pair providing indices of column blocks of variational equations to add to other column blocks
     /*!
@@ -614,9 +711,8 @@ private:
     std::map< IntegratedStateType, std::vector< std::multimap< std::pair< int, int >,
     std::function< void( Eigen::Block< Eigen::MatrixXd > ) > > > > parameterPartialList_;
     
-    //! Pre-declared iterator over all parameter partial functions.
-    std::multimap< std::pair< int, int >, std::function< void( Eigen::Block< Eigen::MatrixXd > ) > >
-    ::iterator functionIterator;
+    //! List of blocks of variationalParameterMatrix_ that are set by the functions in parameterPartialList_
+    std::vector< VariationalEquationsPartialBlock > parameterPartialBlocks_;
 
     //! Pre-declared iterator over all state types
     std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap >
@@ -627,7 +723,7 @@ private:
     dynamicalStatesToEstimate_;
 
     
-    //! Number of parameter values in estimation (i.e. number of columns in sensitivity matrix)
+    //! Number of parameter values in estimation (i.e. number of columns in propagated state transition and sensitivity matrix)
     int numberOfParameterValues_;
     
     //! Total size of (single-arc) state vector of dynamics that is to be estimated.
@@ -635,12 +731,21 @@ private:
 
     int couplingEntriesToSuppress_;
 
+    //! Indices (in the full sensitivity matrix) of the propagated sensitivity matrix columns (set by omitDynamicsFreeParameterColumns)
+    std::vector< int > propagatedSensitivityColumnIndices_;
+
+    //! Boolean denoting whether omitDynamicsFreeParameterColumns has been called
+    bool areDynamicsFreeParameterColumnsOmitted_;
+
     //! Total matrix of partial derivatives of state derivatives w.r.t. current states.
     Eigen::MatrixXd variationalMatrix_;
 
     //! Total matrix of partial derivatives of state derivatives w.r.t. parameter vectors.
     Eigen::MatrixXd variationalParameterMatrix_;
 
+    //! Matrix used for unscaled torque partials in getParameterPartialMatrix, if no scratch arena is active
+    Eigen::MatrixXd unscaledTorquePartialsFallback_;
+
     //! Current states, in conventional representation (e.g. transformed from specific propagator) sorted per state type.
     std::unordered_map< IntegratedStateType, Eigen::VectorXd > currentStatesPerTypeInConventionalRepresentation_;
 };
@@ -81,7 +81,11 @@ public:
         thrustDirectionCalculator_( thrustDirectionWrapper ),
         bodyMassFunction_( bodyMassFunction ),
         requiredModelUpdates_( requiredModelUpdates ),
-        saveThrustContributions_( false ){ }
+        saveThrustContributions_( false )
+    {
+        orientationBasedThrustDirectionCalculator_ =
+                std::dynamic_pointer_cast< OrientationBasedThrustDirectionCalculator >( thrustDirectionCalculator_ );
+    }
 
     //! Destructor
     ~ThrustAcceleration( ){ }
@@ -173,6 +177,13 @@ protected:
 
     std::shared_ptr< ThrustDirectionCalculator > thrustDirectionCalculator_;
 
+    //! Orientation-based thrust direction calculator (nullptr if thrustDirectionCalculator_ is of another type)
+    /*!
+     * Orientation-based thrust direction calculator (nullptr if thrustDirectionCalculator_ is of another type). If set,
+     * the body-fixed thrust accelerations of all engines are summed, and rotated to the inertial frame in a single step.
+     */
+    std::shared_ptr< OrientationBasedThrustDirectionCalculator > orientationBasedThrustDirectionCalculator_;
+
     //! Function returning the current mass of the body being propagated.
     std::function< double( ) > bodyMassFunction_;
 
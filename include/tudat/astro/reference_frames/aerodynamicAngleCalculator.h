@@ -275,6 +275,16 @@ public:
         return centralBodyName_;
     }
 
+    //! Function to get the model that computes the atmospheric wind
+    /*!
+     * Function to get the model that computes the atmospheric wind (nullptr if no wind model is set).
+     * \return Model that computes the atmospheric wind
+     */
+    std::shared_ptr< aerodynamics::WindModel > getWindModel( )
+    {
+        return windModel_;
+    }
+
     //! Function to get the current airspeed-based body-fixed state of vehicle, as set by previous call to update( ).
     /*!
      * Function to get the current airspeed-based body-fixed state of vehicle, as set by previous call to update( ).
@@ -44,6 +44,26 @@ double calculateFirstOrderLightTimeCorrectionFromCentralBody( const double bodyG
                                                               const Eigen::Vector3d& centralBodyPosition,
                                                               const double ppnParameterGamma = 1.0 );
 
+//! Function to calculate first order relativistic light time corrections due to a set of gravitating point masses.
+/*!
+ *  Function to calculate first order relativistic light time corrections due to a set of gravitating point masses,
+ *  according to Eq. (11.17) of 2010 IERS conventions, evaluating the contributions of all bodies at once.
+ *  \param bodyGravitationalParameters Gravitational parameters of gravitating bodies.
+ *  \param transmitterPosition Position of origin of electromagnetic signal (at time of transmission).
+ *  \param receiverPosition Position of target of electromagentic signal (at time of reception)
+ *  \param centralBodyPositions Positions of perturbing bodies (at certain time during signal propagation), one column
+ *  per body, in the same order as bodyGravitationalParameters.
+ *  \param ppnParameterGamma Parametric post-Newtonian parameter gamma, a measure for the space-time curvature due to a
+ *  unit rest mass (1.0 in GR)
+ *  \return Light time corrections (in seconds) due to each of the gravitating point masses.
+ */
+Eigen::VectorXd calculateFirstOrderLightTimeCorrectionsFromCentralBodies(
+        const Eigen::VectorXd& bodyGravitationalParameters,
+        const Eigen::Vector3d& transmitterPosition,
+        const Eigen::Vector3d& receiverPosition,
+        const Eigen::Matrix3Xd& centralBodyPositions,
+        const double ppnParameterGamma = 1.0 );
+
 //! Function to calculate gradient of first order relativistic light time correction due to a gravitating point mass.
 /*!
  *  Function to calculate gradient of first order relativistic light time correction due to a gravitating point mass.
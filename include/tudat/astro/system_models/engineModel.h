@@ -48,7 +48,8 @@ public:
                 []( const double ){ return Eigen::Vector3d::UnitX( ); } ):
        thrustMagnitudeWrapper_( thrustMagnitudeWrapper ),
        engineName_( engineName ),
-       bodyFixedThrustDirection_( bodyFixedThrustDirection )
+       bodyFixedThrustDirection_( bodyFixedThrustDirection ),
+       currentTime_( TUDAT_NAN )
     { }
 
     //! Destructor.
@@ -58,13 +59,19 @@ public:
     //! Pure virtual function to update the engine model to the current time
     /*!
      *  Pure virtual function to update the engine model to the current time. This function must be implemented in the derived
-     *  class, wehre it typically resets the currentThrust_ variable (and any associated variables).
+     *  class, wehre it typically resets the currentThrust_ variable (and any associated variables). The update is only
+     *  performed if the engine model has not yet been updated to currentTime, so that the thrust acceleration, mass rate
+     *  and any dependent variables using the same engine share a single evaluation per epoch.
      *  \param currentTime Current itme in simulation.
      */
     virtual void updateEngineModel( const double currentTime )
     {
-        thrustMagnitudeWrapper_->update( currentTime );
-        currentBodyFixedThrustDirection_ = bodyFixedThrustDirection_( currentTime ).normalized( );
+        if( !( currentTime_ == currentTime ) )
+        {
+            thrustMagnitudeWrapper_->update( currentTime );
+            currentBodyFixedThrustDirection_ = bodyFixedThrustDirection_( currentTime ).normalized( );
+            currentTime_ = currentTime;
+        }
     }
 
 
@@ -109,6 +116,7 @@ public:
     {
         thrustMagnitudeWrapper_->resetCurrentTime( );
         bodyFixedThrustDirection_( TUDAT_NAN );
+        currentTime_ = TUDAT_NAN;
     }
 
     const std::string getEngineName( )
@@ -132,6 +140,9 @@ protected:
 
     Eigen::Vector3d currentBodyFixedThrustDirection_;
 
+    //! Time to which the engine model was last updated
+    double currentTime_;
+
 
 };
 
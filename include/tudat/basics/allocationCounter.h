@@ -0,0 +1,75 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_ALLOCATIONCOUNTER_H
+#define TUDAT_ALLOCATIONCOUNTER_H
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Function to check whether Tudat is compiled with heap allocation counting
+/*!
+ *  Function to check whether Tudat is compiled with heap allocation counting. The heap allocation functions are only
+ *  instrumented when Tudat is compiled with TUDAT_BUILD_WITH_PROPAGATION_PROFILING (as the instrumentation adds overhead to
+ *  all heap allocations in the program). With glibc, the C allocation functions (malloc etc.) are instrumented, so that
+ *  allocations by both operator new and Eigen are counted; on other platforms, only the global operator new is replaced.
+ *  Without instrumentation, the number of heap allocations reported by the functions in this file is always zero.
+ *  \return True if heap allocations are counted, false otherwise
+ */
+inline bool isAllocationCountingAvailable( )
+{
+#if TUDAT_BUILD_WITH_PROPAGATION_PROFILING
+    return true;
+#else
+    return false;
+#endif
+}
+
+//! Function to retrieve the number of heap allocations made by the current thread
+/*!
+ *  Function to retrieve the number of heap allocations made by the current thread since its
+ *  creation. Always returns zero if isAllocationCountingAvailable( ) is false.
+ *  \return Number of heap allocations made by the current thread
+ */
+long long getNumberOfHeapAllocationsInCurrentThread( );
+
+//! Class to count the number of heap allocations made by the current thread during the lifetime of the object.
+/*!
+ *  Class to count the number of heap allocations made by the current thread during the lifetime of the object, for instance
+ *  to verify that the steady-state evaluation of a state derivative does not allocate memory.
+ */
+class ScopedAllocationCounter
+{
+public:
+
+    //! Constructor, starts counting
+    ScopedAllocationCounter( ):
+        initialNumberOfAllocations_( getNumberOfHeapAllocationsInCurrentThread( ) ){ }
+
+    //! Function to retrieve the number of heap allocations made by the current thread since the creation of this object
+    long long getNumberOfAllocations( ) const
+    {
+        return getNumberOfHeapAllocationsInCurrentThread( ) - initialNumberOfAllocations_;
+    }
+
+private:
+
+    //! Number of heap allocations made by the current thread at the creation of this object
+    long long initialNumberOfAllocations_;
+};
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_ALLOCATIONCOUNTER_H
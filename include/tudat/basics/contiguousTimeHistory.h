@@ -0,0 +1,388 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_CONTIGUOUSTIMEHISTORY_H
+#define TUDAT_CONTIGUOUSTIMEHISTORY_H
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Class to store a history of vectors of equal size in contiguous memory
+/*!
+ *  Class to store a history of vectors of equal size (e.g. propagated states or dependent variables) in contiguous memory,
+ *  as an alternative to a std::map< TimeType, Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > >. The epochs are stored in
+ *  a single vector, and the values in a single row-major matrix (one row per epoch), so that no memory is allocated per
+ *  epoch, and each entry can be accessed by index in constant time. The storage grows geometrically when epochs are
+ *  appended. Epochs are stored in the order in which they are added; lookups by time (findEpochIndex) and merging
+ *  require the epochs to be sorted in ascending order (see sortByTime).
+ */
+template< typename TimeType, typename ScalarType = double >
+class ContiguousTimeHistory
+{
+public:
+
+    //! Typedef for the (row-major) matrix in which the values are stored
+    typedef Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > ValueMatrix;
+
+    //! Typedef for a single value in the history
+    typedef Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > ValueVector;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param numberOfColumns Size of each value in the history. If 0, the size is set when the first epoch is added.
+     *  \param numberOfReservedEpochs Number of epochs for which memory is to be allocated upon construction.
+     */
+    ContiguousTimeHistory( const int numberOfColumns = 0, const int numberOfReservedEpochs = 0 ):
+        numberOfColumns_( numberOfColumns )
+    {
+        if( numberOfColumns < 0 )
+        {
+            throw std::runtime_error( "Error when creating contiguous time history, number of columns cannot be negative" );
+        }
+        reserve( numberOfReservedEpochs );
+    }
+
+    //! Constructor from map (time as key)
+    /*!
+     *  Constructor from map (time as key); all values in the map must be of equal size.
+     *  \param history History of values, with time as key.
+     */
+    ContiguousTimeHistory( const std::map< TimeType, ValueVector >& history ):
+        numberOfColumns_( history.size( ) > 0 ? history.begin( )->second.rows( ) : 0 )
+    {
+        reserve( history.size( ) );
+        for( auto historyIterator : history )
+        {
+            append( historyIterator.first, historyIterator.second );
+        }
+    }
+
+    //! Function to allocate memory for a given number of epochs
+    /*!
+     *  Function to allocate memory for a given number of epochs. Only has an effect if the requested number of epochs exceeds
+     *  the current capacity, and the number of columns is known.
+     *  \param numberOfEpochs Number of epochs for which memory is to be allocated.
+     */
+    void reserve( const int numberOfEpochs )
+    {
+        times_.reserve( numberOfEpochs );
+        if( numberOfColumns_ > 0 && numberOfEpochs > values_.rows( ) )
+        {
+            values_.conservativeResize( numberOfEpochs, numberOfColumns_ );
+        }
+    }
+
+    //! Function to add an epoch to the history, returning a writable view of the associated value
+    /*!
+     *  Function to add an epoch to the history, returning a writable view of the associated value, so that the value can
+     *  be computed directly into the storage. The view is invalidated when a subsequent epoch is added.
+     *  \param time Epoch that is to be added
+     *  \return View of value at the added epoch (entries are not initialized)
+     */
+    Eigen::Map< ValueVector > appendEpoch( const TimeType time )
+    {
+        int numberOfEpochs = times_.size( );
+        if( numberOfEpochs == values_.rows( ) )
+        {
+            values_.conservativeResize( std::max( 2 * numberOfEpochs, 16 ), numberOfColumns_ );
+        }
+        times_.push_back( time );
+        return Eigen::Map< ValueVector >( values_.data( ) + numberOfEpochs * numberOfColumns_, numberOfColumns_ );
+    }
+
+    //! Function to add an epoch and associated value to the history
+    /*!
+     *  Function to add an epoch and associated value to the history. If the number of columns was not yet set, it is set
+     *  from the size of the input value.
+     *  \param time Epoch that is to be added
+     *  \param value Value at the epoch that is to be added
+     */
+    template< typename Derived >
+    void append( const TimeType time, const Eigen::MatrixBase< Derived >& value )
+    {
+        if( numberOfColumns_ == 0 && times_.size( ) == 0 )
+        {
+            numberOfColumns_ = value.size( );
+        }
+
+        if( value.size( ) != numberOfColumns_ )
+        {
+            throw std::runtime_error( "Error when adding epoch to contiguous time history, value size (" +
+                                      std::to_string( value.size( ) ) + ") is incompatible with history size (" +
+                                      std::to_string( numberOfColumns_ ) + ")" );
+        }
+        appendEpoch( time ) = value.template cast< ScalarType >( );
+    }
+
+    //! Function to remove the epoch that was added last
+    void removeLastEpoch( )
+    {
+        if( times_.size( ) == 0 )
+        {
+            throw std::runtime_error( "Error when removing epoch from contiguous time history, history is empty" );
+        }
+        times_.pop_back( );
+    }
+
+    //! Function to remove the epoch at a given index (subsequent epochs are shifted)
+    void removeEpoch( const int index )
+    {
+        checkIndex( index );
+        int numberOfEpochs = times_.size( );
+        for( int i = index; i < numberOfEpochs - 1; i++ )
+        {
+            values_.row( i ) = values_.row( i + 1 );
+        }
+        times_.erase( times_.begin( ) + index );
+    }
+
+    //! Function to remove all epochs, retaining the allocated memory
+    void clear( )
+    {
+        times_.clear( );
+    }
+
+    //! Function to remove all epochs, and release the allocated memory
+    void clearAndRelease( )
+    {
+        std::vector< TimeType >( ).swap( times_ );
+        values_.resize( 0, numberOfColumns_ );
+    }
+
+    //! Function to retrieve the number of epochs in the history
+    int size( ) const
+    {
+        return times_.size( );
+    }
+
+    //! Function to check whether the history is empty
+    bool empty( ) const
+    {
+        return times_.empty( );
+    }
+
+    //! Function to retrieve the size of each value in the history
+    int getNumberOfColumns( ) const
+    {
+        return numberOfColumns_;
+    }
+
+    //! Function to retrieve the number of epochs for which memory is currently allocated
+    int getCapacity( ) const
+    {
+        return values_.rows( );
+    }
+
+    //! Function to retrieve the heap memory held by the history (including unused allocated epochs), in bytes
+    std::size_t getHeapMemorySize( ) const
+    {
+        return times_.capacity( ) * sizeof( TimeType ) + static_cast< std::size_t >( values_.size( ) ) * sizeof( ScalarType );
+    }
+
+    //! Function to retrieve the epoch at a given index
+    TimeType getTime( const int index ) const
+    {
+        return times_.at( index );
+    }
+
+    //! Function to retrieve the first epoch in the history
+    TimeType getFirstTime( ) const
+    {
+        if( times_.size( ) == 0 )
+        {
+            throw std::runtime_error( "Error when retrieving first epoch from contiguous time history, history is empty" );
+        }
+        return times_.front( );
+    }
+
+    //! Function to retrieve the epoch that was added last
+    TimeType getLastTime( ) const
+    {
+        if( times_.size( ) == 0 )
+        {
+            throw std::runtime_error( "Error when retrieving last epoch from contiguous time history, history is empty" );
+        }
+        return times_.back( );
+    }
+
+    //! Function to retrieve (a view of) the value at a given index
+    Eigen::Map< const ValueVector > getValue( const int index ) const
+    {
+        checkIndex( index );
+        return Eigen::Map< const ValueVector >( values_.data( ) + index * numberOfColumns_, numberOfColumns_ );
+    }
+
+    //! Function to retrieve a writable view of the value at a given index
+    Eigen::Map< ValueVector > getValue( const int index )
+    {
+        checkIndex( index );
+        return Eigen::Map< ValueVector >( values_.data( ) + index * numberOfColumns_, numberOfColumns_ );
+    }
+
+    //! Function to retrieve all epochs in the history
+    const std::vector< TimeType >& getTimes( ) const
+    {
+        return times_;
+    }
+
+    //! Function to retrieve the values at all epochs, as a matrix with one row per epoch
+    typename ValueMatrix::ConstRowsBlockXpr getValues( ) const
+    {
+        return values_.topRows( size( ) );
+    }
+
+    //! Function to find the index of a given epoch (epochs must be sorted in ascending order), returns -1 if not found
+    int findEpochIndex( const TimeType time ) const
+    {
+        typename std::vector< TimeType >::const_iterator timeIterator =
+                std::lower_bound( times_.begin( ), times_.end( ), time );
+        if( timeIterator == times_.end( ) || *timeIterator != time )
+        {
+            return -1;
+        }
+        return static_cast< int >( timeIterator - times_.begin( ) );
+    }
+
+    //! Function to sort the epochs (and associated values) in ascending order
+    /*!
+     *  Function to sort the epochs (and associated values) in ascending order. Histories that were filled in descending
+     *  order (e.g. from a backwards propagation) are reversed in place.
+     */
+    void sortByTime( )
+    {
+        if( std::is_sorted( times_.begin( ), times_.end( ) ) )
+        {
+            return;
+        }
+
+        int numberOfEpochs = times_.size( );
+        if( std::is_sorted( times_.rbegin( ), times_.rend( ) ) )
+        {
+            std::reverse( times_.begin( ), times_.end( ) );
+            for( int i = 0; i < numberOfEpochs / 2; i++ )
+            {
+                values_.row( i ).swap( values_.row( numberOfEpochs - 1 - i ) );
+            }
+        }
+        else
+        {
+            std::vector< int > sortedIndices( numberOfEpochs );
+            std::iota( sortedIndices.begin( ), sortedIndices.end( ), 0 );
+            std::stable_sort( sortedIndices.begin( ), sortedIndices.end( ),
+                              [ & ]( const int first, const int second ){ return times_[ first ] < times_[ second ]; } );
+
+            std::vector< TimeType > sortedTimes( numberOfEpochs );
+            ValueMatrix sortedValues( values_.rows( ), numberOfColumns_ );
+            for( int i = 0; i < numberOfEpochs; i++ )
+            {
+                sortedTimes[ i ] = times_[ sortedIndices[ i ] ];
+                sortedValues.row( i ) = values_.row( sortedIndices[ i ] );
+            }
+            times_.swap( sortedTimes );
+            values_.swap( sortedValues );
+        }
+    }
+
+    //! Function to merge another history into this one
+    /*!
+     *  Function to merge another history into this one, retaining the current value for epochs present in both histories
+     *  (as for std::map::insert). Both histories must be sorted in ascending order.
+     *  \param otherHistory History that is to be merged into this one.
+     */
+    void merge( const ContiguousTimeHistory< TimeType, ScalarType >& otherHistory )
+    {
+        if( otherHistory.empty( ) )
+        {
+            return;
+        }
+        else if( empty( ) )
+        {
+            *this = otherHistory;
+            return;
+        }
+        else if( otherHistory.getNumberOfColumns( ) != numberOfColumns_ )
+        {
+            throw std::runtime_error( "Error when merging contiguous time histories, sizes are incompatible" );
+        }
+
+        ContiguousTimeHistory< TimeType, ScalarType > mergedHistory( numberOfColumns_, size( ) + otherHistory.size( ) );
+        int currentIndex = 0, otherIndex = 0;
+        while( currentIndex < size( ) || otherIndex < otherHistory.size( ) )
+        {
+            if( otherIndex == otherHistory.size( ) ||
+                    ( currentIndex < size( ) && times_[ currentIndex ] <= otherHistory.times_[ otherIndex ] ) )
+            {
+                if( otherIndex < otherHistory.size( ) && times_[ currentIndex ] == otherHistory.times_[ otherIndex ] )
+                {
+                    otherIndex++;
+                }
+                mergedHistory.appendEpoch( times_[ currentIndex ] ) = getValue( currentIndex );
+                currentIndex++;
+            }
+            else
+            {
+                mergedHistory.appendEpoch( otherHistory.times_[ otherIndex ] ) = otherHistory.getValue( otherIndex );
+                otherIndex++;
+            }
+        }
+        *this = std::move( mergedHistory );
+    }
+
+    //! Function to convert the history to a map (time as key)
+    std::map< TimeType, ValueVector > toMap( ) const
+    {
+        std::map< TimeType, ValueVector > history;
+        for( unsigned int i = 0; i < times_.size( ); i++ )
+        {
+            history[ times_[ i ] ] = getValue( i );
+        }
+        return history;
+    }
+
+private:
+
+    //! Function to check whether an index is valid, throws an exception if not
+    void checkIndex( const int index ) const
+    {
+        if( index < 0 || index >= static_cast< int >( times_.size( ) ) )
+        {
+            throw std::runtime_error( "Error when retrieving value from contiguous time history, index " +
+                                      std::to_string( index ) + " is not available" );
+        }
+    }
+
+    //! Epochs in the history, in the order in which they were added
+    std::vector< TimeType > times_;
+
+    //! Values in the history, one row per epoch (rows beyond the number of epochs are allocated but unused)
+    ValueMatrix values_;
+
+    //! Size of each value in the history
+    int numberOfColumns_;
+};
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_CONTIGUOUSTIMEHISTORY_H
@@ -0,0 +1,1223 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Hida, Y., Li, X.S., Bailey, D.H. Library for double-double and quad-double arithmetic, Technical report,
+ *          Lawrence Berkeley National Laboratory, 2008.
+ *      Dekker, T.J. A floating-point technique for extending the available precision, Numerische Mathematik 18, 1971.
+ *
+ */
+
+#ifndef TUDAT_DOUBLEDOUBLE_H
+#define TUDAT_DOUBLEDOUBLE_H
+
+#include <cmath>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace double_double
+{
+
+//! Class for floating point numbers in double-double representation, with about 106 bits (31 digits) of precision
+/*!
+ *  Class for floating point numbers in double-double representation, with about 106 bits (31 digits) of precision. A number
+ *  is represented by the unevaluated sum of two doubles (high and low part), with |low| <= ulp( high ) / 2. The arithmetic
+ *  operations are implemented using the error-free transformations of Dekker and Knuth (with hardware fused multiply-add),
+ *  following the algorithms of Hida et al. (2008). Compared to long double (80-bit x87 on x86, software-emulated 128-bit
+ *  on ARM/Power), this type provides higher precision, and is typically faster, as it uses only double precision hardware
+ *  operations. The type can be used as state scalar type for numerical propagation (with double or Time as time type).
+ *  Note that the error-free transformations require strict IEEE double precision arithmetic, and that the results are
+ *  invalid if the code is compiled with value-unsafe optimizations (e.g. -ffast-math).
+ */
+class DoubleDouble
+{
+public:
+
+    //! Default constructor, sets value to zero.
+    constexpr DoubleDouble( ): high_( 0.0 ), low_( 0.0 ){ }
+
+    //! Constructor from double precision value.
+    /*!
+     * Constructor from double precision value.
+     * \param value Value of number
+     */
+    constexpr DoubleDouble( const double value ): high_( value ), low_( 0.0 ){ }
+
+    //! Constructor from float value.
+    /*!
+     * Constructor from float value.
+     * \param value Value of number
+     */
+    constexpr DoubleDouble( const float value ): high_( static_cast< double >( value ) ), low_( 0.0 ){ }
+
+    //! Constructor from long double value.
+    /*!
+     * Constructor from long double value, split into high and low part (exact if the long double mantissa has at most
+     * 106 bits).
+     * \param value Value of number
+     */
+    DoubleDouble( const long double value ): high_( static_cast< double >( value ) ),
+        low_( std::isfinite( high_ ) ? static_cast< double >( value - static_cast< long double >( high_ ) ) : 0.0 ){ }
+
+    //! Constructor from integer value.
+    /*!
+     * Constructor from integer value (exact for integers of up to 106 bits).
+     * \param value Value of number
+     */
+    template< typename IntegerType, typename std::enable_if< std::is_integral< IntegerType >::value, int >::type = 0 >
+    DoubleDouble( const IntegerType value ):
+        high_( static_cast< double >( value ) ), low_( 0.0 )
+    {
+        if( std::numeric_limits< IntegerType >::digits > std::numeric_limits< double >::digits )
+        {
+            // Use long double, as difference may not be representable in input type.
+            low_ = static_cast< double >( static_cast< long double >( value ) - static_cast< long double >( high_ ) );
+        }
+    }
+
+    //! Constructor from high and low part.
+    /*!
+     * Constructor from high and low part, where the components are renormalized such that |low| <= ulp( high ) / 2.
+     * \param high High part of number
+     * \param low Low part of number
+     */
+    DoubleDouble( const double high, const double low )
+    {
+        setNormalizedSum( high, low );
+    }
+
+    //! Function to retrieve the high part of the number (i.e. the closest double precision value).
+    /*!
+     * Function to retrieve the high part of the number (i.e. the closest double precision value).
+     * \return High part of the number
+     */
+    constexpr double getHigh( ) const
+    {
+        return high_;
+    }
+
+    //! Function to retrieve the low part of the number.
+    /*!
+     * Function to retrieve the low part of the number.
+     * \return Low part of the number
+     */
+    constexpr double getLow( ) const
+    {
+        return low_;
+    }
+
+    //! Explicit conversion to double (rounded to nearest).
+    explicit constexpr operator double( ) const
+    {
+        return high_;
+    }
+
+    //! Explicit conversion to float.
+    explicit constexpr operator float( ) const
+    {
+        return static_cast< float >( high_ );
+    }
+
+    //! Explicit conversion to long double.
+    explicit operator long double( ) const
+    {
+        return static_cast< long double >( high_ ) + static_cast< long double >( low_ );
+    }
+
+    //! Explicit conversion to integer types (truncated towards zero).
+    template< typename IntegerType, typename std::enable_if< std::is_integral< IntegerType >::value, int >::type = 0 >
+    explicit operator IntegerType( ) const
+    {
+        return static_cast< IntegerType >( static_cast< long double >( *this ) );
+    }
+
+    //! Unary minus operator
+    DoubleDouble operator-( ) const
+    {
+        return fromNormalizedComponents( -high_, -low_ );
+    }
+
+    //! Unary plus operator
+    DoubleDouble operator+( ) const
+    {
+        return *this;
+    }
+
+    //! Addition operator for two double-double numbers.
+    friend DoubleDouble operator+( const DoubleDouble& number1, const DoubleDouble& number2 )
+    {
+        double lowSum, lowError;
+        double highSum = twoSum( number1.high_, number2.high_, lowSum );
+        double lowSumHigh = twoSum( number1.low_, number2.low_, lowError );
+        lowSum += lowSumHigh;
+        highSum = quickTwoSum( highSum, lowSum, lowSum );
+        lowSum += lowError;
+        return fromQuickTwoSum( highSum, lowSum );
+    }
+
+    //! Addition operator for double-double and double number.
+    friend DoubleDouble operator+( const DoubleDouble& number1, const double number2 )
+    {
+        double lowSum;
+        double highSum = twoSum( number1.high_, number2, lowSum );
+        lowSum += number1.low_;
+        return fromQuickTwoSum( highSum, lowSum );
+    }
+
+    //! Addition operator for double and double-double number.
+    friend DoubleDouble operator+( const double number1, const DoubleDouble& number2 )
+    {
+        return number2 + number1;
+    }
+
+    //! Subtraction operator for two double-double numbers.
+    friend DoubleDouble operator-( const DoubleDouble& number1, const DoubleDouble& number2 )
+    {
+        return number1 + ( -number2 );
+    }
+
+    //! Subtraction operator for double-double and double number.
+    friend DoubleDouble operator-( const DoubleDouble& number1, const double number2 )
+    {
+        return number1 + ( -number2 );
+    }
+
+    //! Subtraction operator for double and double-double number.
+    friend DoubleDouble operator-( const double number1, const DoubleDouble& number2 )
+    {
+        return ( -number2 ) + number1;
+    }
+
+    //! Multiplication operator for two double-double numbers.
+    friend DoubleDouble operator*( const DoubleDouble& number1, const DoubleDouble& number2 )
+    {
+        double productError;
+        double product = twoProduct( number1.high_, number2.high_, productError );
+        productError += ( number1.high_ * number2.low_ + number1.low_ * number2.high_ );
+        return fromQuickTwoSum( product, productError );
+    }
+
+    //! Multiplication operator for double-double and double number.
+    friend DoubleDouble operator*( const DoubleDouble& number1, const double number2 )
+    {
+        double productError;
+        double product = twoProduct( number1.high_, number2, productError );
+        productError += number1.low_ * number2;
+        return fromQuickTwoSum( product, productError );
+    }
+
+    //! Multiplication operator for double and double-double number.
+    friend DoubleDouble operator*( const double number1, const DoubleDouble& number2 )
+    {
+        return number2 * number1;
+    }
+
+    //! Division operator for two double-double numbers.
+    friend DoubleDouble operator/( const DoubleDouble& number1, const DoubleDouble& number2 )
+    {
+        // Compute quotient in three double precision parts, the third correcting the rounding of the second
+        double firstQuotient = number1.high_ / number2.high_;
+        if( !std::isfinite( firstQuotient ) || number1.high_ == 0.0 )
+        {
+            return DoubleDouble( firstQuotient );
+        }
+        DoubleDouble remainder = number1 - number2 * firstQuotient;
+        double secondQuotient = remainder.high_ / number2.high_;
+        remainder = remainder - number2 * secondQuotient;
+        double thirdQuotient = remainder.high_ / number2.high_;
+
+        double quotientError;
+        firstQuotient = quickTwoSum( firstQuotient, secondQuotient, quotientError );
+        return fromNormalizedComponents( firstQuotient, quotientError ) + thirdQuotient;
+    }
+
+    //! Division operator for double-double and double number.
+    friend DoubleDouble operator/( const DoubleDouble& number1, const double number2 )
+    {
+        double firstQuotient = number1.high_ / number2;
+        if( !std::isfinite( firstQuotient ) || number1.high_ == 0.0 )
+        {
+            return DoubleDouble( firstQuotient );
+        }
+        double productError;
+        double product = twoProduct( firstQuotient, number2, productError );
+        double remainderError;
+        double remainder = twoSum( number1.high_, -product, remainderError );
+        remainderError += number1.low_;
+        remainderError -= productError;
+        double secondQuotient = ( remainder + remainderError ) / number2;
+        return fromQuickTwoSum( firstQuotient, secondQuotient );
+    }
+
+    //! Division operator for double and double-double number.
+    friend DoubleDouble operator/( const double number1, const DoubleDouble& number2 )
+    {
+        return DoubleDouble( number1 ) / number2;
+    }
+
+    // Operators for mixed use with other arithmetic types (e.g. long double, int), which are converted to DoubleDouble.
+    // Without these, overload resolution would convert a long double argument to double, losing precision.
+#define TUDAT_DOUBLE_DOUBLE_MIXED_OPERATOR( OPERATOR ) \
+    template< typename ScalarType, typename std::enable_if< std::is_arithmetic< ScalarType >::value && \
+        !std::is_same< ScalarType, double >::value, int >::type = 0 > \
+    friend DoubleDouble operator OPERATOR( const DoubleDouble& number1, const ScalarType number2 ) \
+    { \
+        return number1 OPERATOR DoubleDouble( number2 ); \
+    } \
+    template< typename ScalarType, typename std::enable_if< std::is_arithmetic< ScalarType >::value && \
+        !std::is_same< ScalarType, double >::value, int >::type = 0 > \
+    friend DoubleDouble operator OPERATOR( const ScalarType number1, const DoubleDouble& number2 ) \
+    { \
+        return DoubleDouble( number1 ) OPERATOR number2; \
+    }
+
+    TUDAT_DOUBLE_DOUBLE_MIXED_OPERATOR( + )
+    TUDAT_DOUBLE_DOUBLE_MIXED_OPERATOR( - )
+    TUDAT_DOUBLE_DOUBLE_MIXED_OPERATOR( * )
+    TUDAT_DOUBLE_DOUBLE_MIXED_OPERATOR( / )
+
+#undef TUDAT_DOUBLE_DOUBLE_MIXED_OPERATOR
+
+    //! Compound assignment operators
+    template< typename ScalarType >
+    DoubleDouble& operator+=( const ScalarType& number )
+    {
+        *this = *this + number;
+        return *this;
+    }
+
+    template< typename ScalarType >
+    DoubleDouble& operator-=( const ScalarType& number )
+    {
+        *this = *this - number;
+        return *this;
+    }
+
+    template< typename ScalarType >
+    DoubleDouble& operator*=( const ScalarType& number )
+    {
+        *this = *this * number;
+        return *this;
+    }
+
+    template< typename ScalarType >
+    DoubleDouble& operator/=( const ScalarType& number )
+    {
+        *this = *this / number;
+        return *this;
+    }
+
+    //! Comparison operators (with conversion of other arithmetic types to DoubleDouble)
+    friend bool operator==( const DoubleDouble& number1, const DoubleDouble& number2 )
+    {
+        return ( number1.high_ == number2.high_ ) && ( number1.low_ == number2.low_ );
+    }
+
+    friend bool operator!=( const DoubleDouble& number1, const DoubleDouble& number2 )
+    {
+        return !( number1 == number2 );
+    }
+
+    friend bool operator<( const DoubleDouble& number1, const DoubleDouble& number2 )
+    {
+        return ( number1.high_ < number2.high_ ) || ( number1.high_ == number2.high_ && number1.low_ < number2.low_ );
+    }
+
+    friend bool operator>( const DoubleDouble& number1, const DoubleDouble& number2 )
+    {
+        return number2 < number1;
+    }
+
+    friend bool operator<=( const DoubleDouble& number1, const DoubleDouble& number2 )
+    {
+        return ( number1.high_ < number2.high_ ) || ( number1.high_ == number2.high_ && number1.low_ <= number2.low_ );
+    }
+
+    friend bool operator>=( const DoubleDouble& number1, const DoubleDouble& number2 )
+    {
+        return number2 <= number1;
+    }
+
+#define TUDAT_DOUBLE_DOUBLE_MIXED_COMPARISON( OPERATOR ) \
+    template< typename ScalarType, typename std::enable_if< std::is_arithmetic< ScalarType >::value, int >::type = 0 > \
+    friend bool operator OPERATOR( const DoubleDouble& number1, const ScalarType number2 ) \
+    { \
+        return number1 OPERATOR DoubleDouble( number2 ); \
+    } \
+    template< typename ScalarType, typename std::enable_if< std::is_arithmetic< ScalarType >::value, int >::type = 0 > \
+    friend bool operator OPERATOR( const ScalarType number1, const DoubleDouble& number2 ) \
+    { \
+        return DoubleDouble( number1 ) OPERATOR number2; \
+    }
+
+    TUDAT_DOUBLE_DOUBLE_MIXED_COMPARISON( == )
+    TUDAT_DOUBLE_DOUBLE_MIXED_COMPARISON( != )
+    TUDAT_DOUBLE_DOUBLE_MIXED_COMPARISON( < )
+    TUDAT_DOUBLE_DOUBLE_MIXED_COMPARISON( > )
+    TUDAT_DOUBLE_DOUBLE_MIXED_COMPARISON( <= )
+    TUDAT_DOUBLE_DOUBLE_MIXED_COMPARISON( >= )
+
+#undef TUDAT_DOUBLE_DOUBLE_MIXED_COMPARISON
+
+    //! Function to create a number from components that are already normalized (|low| <= ulp( high ) / 2)
+    static constexpr DoubleDouble fromNormalizedComponents( const double high, const double low )
+    {
+        return DoubleDouble( high, low, NormalizedTag( ) );
+    }
+
+    //! Function to compute the sum of two doubles, and the exact rounding error of the sum (Knuth's TwoSum)
+    static double twoSum( const double number1, const double number2, double& error )
+    {
+        double sum = number1 + number2;
+        double number2Virtual = sum - number1;
+        error = ( number1 - ( sum - number2Virtual ) ) + ( number2 - number2Virtual );
+        return sum;
+    }
+
+    //! Function to compute the sum of two doubles, and the exact rounding error of the sum, with |number1| >= |number2|
+    static double quickTwoSum( const double number1, const double number2, double& error )
+    {
+        double sum = number1 + number2;
+        error = number2 - ( sum - number1 );
+        return sum;
+    }
+
+    //! Function to compute the product of two doubles, and the exact rounding error of the product.
+    static double twoProduct( const double number1, const double number2, double& error )
+    {
+        double product = number1 * number2;
+        error = std::fma( number1, number2, -product );
+        return product;
+    }
+
+private:
+
+    //! Tag to select constructor that does not renormalize the components
+    struct NormalizedTag{ };
+
+    //! Constructor from components that are already normalized
+    constexpr DoubleDouble( const double high, const double low, const NormalizedTag ): high_( high ), low_( low ){ }
+
+    //! Function to create number from (approximate) sum, with |high| >= |low|, catching non-finite values.
+    static DoubleDouble fromQuickTwoSum( const double high, const double low )
+    {
+        double error;
+        double sum = quickTwoSum( high, low, error );
+        if( !std::isfinite( sum ) )
+        {
+            return DoubleDouble( sum );
+        }
+        return fromNormalizedComponents( sum, error );
+    }
+
+    //! Function to set the components from the sum of two doubles
+    void setNormalizedSum( const double high, const double low )
+    {
+        high_ = twoSum( high, low, low_ );
+        if( !std::isfinite( high_ ) )
+        {
+            low_ = 0.0;
+        }
+    }
+
+    //! High part of the number
+    double high_;
+
+    //! Low part of the number, with |low_| <= ulp( high_ ) / 2
+    double low_;
+};
+
+} // namespace double_double
+
+//! Double-double number type, defined in a nested namespace so that the overloads of the mathematical functions (sqrt,
+//! pow, exp, etc.) for this type are only found by argument-dependent lookup, and do not take part in the (unqualified)
+//! lookup of these functions for double arguments in the tudat namespace.
+using double_double::DoubleDouble;
+
+//! Typedefs for Eigen vectors and matrices of double-double numbers
+typedef Eigen::Matrix< DoubleDouble, 3, 1 > Vector3dd;
+typedef Eigen::Matrix< DoubleDouble, 6, 1 > Vector6dd;
+typedef Eigen::Matrix< DoubleDouble, 7, 1 > Vector7dd;
+typedef Eigen::Matrix< DoubleDouble, Eigen::Dynamic, 1 > VectorXdd;
+typedef Eigen::Matrix< DoubleDouble, Eigen::Dynamic, Eigen::Dynamic > MatrixXdd;
+
+namespace double_double_constants
+{
+
+//! Double-double representations of commonly used constants
+constexpr DoubleDouble PI = DoubleDouble::fromNormalizedComponents( 3.141592653589793116e+00, 1.224646799147353207e-16 );
+constexpr DoubleDouble TWO_PI = DoubleDouble::fromNormalizedComponents( 6.283185307179586232e+00, 2.449293598294706414e-16 );
+constexpr DoubleDouble HALF_PI = DoubleDouble::fromNormalizedComponents( 1.570796326794896558e+00, 6.123233995736766036e-17 );
+constexpr DoubleDouble QUARTER_PI = DoubleDouble::fromNormalizedComponents( 7.853981633974482790e-01, 3.061616997868383018e-17 );
+constexpr DoubleDouble LN2 = DoubleDouble::fromNormalizedComponents( 6.931471805599452862e-01, 2.319046813846299558e-17 );
+constexpr DoubleDouble LN10 = DoubleDouble::fromNormalizedComponents( 2.302585092994045901e+00, -2.170756223382249351e-16 );
+
+//! Relative precision of double-double arithmetic (2^-104)
+constexpr double EPSILON = 4.93038065763132e-32;
+
+} // namespace double_double_constants
+
+namespace double_double
+{
+
+//! Function to compute the absolute value of a double-double number
+inline DoubleDouble abs( const DoubleDouble& number )
+{
+    return ( number.getHigh( ) < 0.0 ) ? -number : number;
+}
+
+//! Function to compute the absolute value of a double-double number
+inline DoubleDouble fabs( const DoubleDouble& number )
+{
+    return abs( number );
+}
+
+//! Function to check if a double-double number is NaN
+inline bool isnan( const DoubleDouble& number )
+{
+    return std::isnan( number.getHigh( ) );
+}
+
+//! Function to check if a double-double number is infinite
+inline bool isinf( const DoubleDouble& number )
+{
+    return std::isinf( number.getHigh( ) );
+}
+
+//! Function to check if a double-double number is finite
+inline bool isfinite( const DoubleDouble& number )
+{
+    return std::isfinite( number.getHigh( ) );
+}
+
+//! Function to compute the square of a double-double number
+inline DoubleDouble square( const DoubleDouble& number )
+{
+    double productError;
+    double product = DoubleDouble::twoProduct( number.getHigh( ), number.getHigh( ), productError );
+    productError += 2.0 * number.getHigh( ) * number.getLow( );
+    return DoubleDouble( product, productError );
+}
+
+//! Function to multiply a double-double number by an (exact) power of two
+inline DoubleDouble ldexp( const DoubleDouble& number, const int exponent )
+{
+    return DoubleDouble::fromNormalizedComponents(
+                std::ldexp( number.getHigh( ), exponent ), std::ldexp( number.getLow( ), exponent ) );
+}
+
+//! Function to compute the largest integer value not greater than a double-double number
+inline DoubleDouble floor( const DoubleDouble& number )
+{
+    double highFloor = std::floor( number.getHigh( ) );
+    if( highFloor == number.getHigh( ) )
+    {
+        return DoubleDouble( highFloor, std::floor( number.getLow( ) ) );
+    }
+    return DoubleDouble( highFloor );
+}
+
+//! Function to compute the smallest integer value not less than a double-double number
+inline DoubleDouble ceil( const DoubleDouble& number )
+{
+    double highCeil = std::ceil( number.getHigh( ) );
+    if( highCeil == number.getHigh( ) )
+    {
+        return DoubleDouble( highCeil, std::ceil( number.getLow( ) ) );
+    }
+    return DoubleDouble( highCeil );
+}
+
+//! Function to round a double-double number to the nearest integer value (halfway cases away from zero)
+inline DoubleDouble round( const DoubleDouble& number )
+{
+    return ( number.getHigh( ) < 0.0 ) ? -floor( -number + 0.5 ) : floor( number + 0.5 );
+}
+
+//! Function to compute the square root of a double-double number
+/*!
+ *  Function to compute the square root of a double-double number, from the double precision estimate, with a single
+ *  Newton-Raphson iteration (Karp's method).
+ */
+inline DoubleDouble sqrt( const DoubleDouble& number )
+{
+    if( number.getHigh( ) <= 0.0 )
+    {
+        return ( number.getHigh( ) == 0.0 ) ? DoubleDouble( 0.0 ) : DoubleDouble( std::numeric_limits< double >::quiet_NaN( ) );
+    }
+    if( !std::isfinite( number.getHigh( ) ) )
+    {
+        return DoubleDouble( std::sqrt( number.getHigh( ) ) );
+    }
+
+    double inverseRoot = 1.0 / std::sqrt( number.getHigh( ) );
+    double root = number.getHigh( ) * inverseRoot;
+    return DoubleDouble( root ) + ( number - square( DoubleDouble( root ) ) ).getHigh( ) * ( inverseRoot * 0.5 );
+}
+
+//! Function to compute the cube root of a double-double number
+inline DoubleDouble cbrt( const DoubleDouble& number )
+{
+    if( number.getHigh( ) == 0.0 || !std::isfinite( number.getHigh( ) ) )
+    {
+        return DoubleDouble( std::cbrt( number.getHigh( ) ) );
+    }
+
+    // One Newton-Raphson iteration from double precision estimate
+    DoubleDouble root = DoubleDouble( std::cbrt( number.getHigh( ) ) );
+    return root - ( root * square( root ) - number ) / ( 3.0 * square( root ) );
+}
+
+//! Function to compute the exponential of a double-double number
+/*!
+ *  Function to compute the exponential of a double-double number. The argument is reduced as x = k ln 2 + 512 r, with
+ *  |r| <= ln 2 / 1024, after which exp( r ) - 1 is computed from its Taylor series, and raised to the power 512 by
+ *  repeated squaring.
+ */
+inline DoubleDouble exp( const DoubleDouble& number )
+{
+    if( number.getHigh( ) > 709.78 )
+    {
+        return DoubleDouble( std::numeric_limits< double >::infinity( ) );
+    }
+    else if( number.getHigh( ) < -745.2 )
+    {
+        return DoubleDouble( 0.0 );
+    }
+    else if( !std::isfinite( number.getHigh( ) ) )
+    {
+        return DoubleDouble( number.getHigh( ) );
+    }
+
+    // Reduce argument
+    double powerOfTwo = std::floor( number.getHigh( ) / double_double_constants::LN2.getHigh( ) + 0.5 );
+    DoubleDouble reducedArgument = ldexp( number - double_double_constants::LN2 * powerOfTwo, -9 );
+
+    // Compute exp( r ) - 1 from Taylor series
+    DoubleDouble term = reducedArgument;
+    DoubleDouble exponentialMinusOne = reducedArgument;
+    for( int i = 2; i < 20; i++ )
+    {
+        term = term * reducedArgument / static_cast< double >( i );
+        exponentialMinusOne = exponentialMinusOne + term;
+        if( std::fabs( term.getHigh( ) ) <= double_double_constants::EPSILON * 1.0E-3 * std::fabs( exponentialMinusOne.getHigh( ) ) )
+        {
+            break;
+        }
+    }
+
+    // Undo argument reduction, using ( 1 + s )^2 - 1 = 2 s + s^2 to avoid loss of precision
+    for( int i = 0; i < 9; i++ )
+    {
+        exponentialMinusOne = ldexp( exponentialMinusOne, 1 ) + square( exponentialMinusOne );
+    }
+    return ldexp( exponentialMinusOne + 1.0, static_cast< int >( powerOfTwo ) );
+}
+
+//! Function to compute the natural logarithm of a double-double number
+/*!
+ *  Function to compute the natural logarithm of a double-double number, from the double precision estimate, with a single
+ *  Newton-Raphson iteration on exp( y ) = x.
+ */
+inline DoubleDouble log( const DoubleDouble& number )
+{
+    if( number.getHigh( ) <= 0.0 )
+    {
+        return ( number.getHigh( ) == 0.0 ) ? DoubleDouble( -std::numeric_limits< double >::infinity( ) ) :
+                                               DoubleDouble( std::numeric_limits< double >::quiet_NaN( ) );
+    }
+    if( !std::isfinite( number.getHigh( ) ) )
+    {
+        return DoubleDouble( number.getHigh( ) );
+    }
+
+    DoubleDouble logarithm = DoubleDouble( std::log( number.getHigh( ) ) );
+    return logarithm + number * exp( -logarithm ) - 1.0;
+}
+
+//! Function to compute the base-10 logarithm of a double-double number
+inline DoubleDouble log10( const DoubleDouble& number )
+{
+    return log( number ) / double_double_constants::LN10;
+}
+
+//! Function to compute a double-double number to an integer power (by repeated squaring)
+inline DoubleDouble pow( const DoubleDouble& base, const int exponent )
+{
+    if( exponent == 0 )
+    {
+        return DoubleDouble( 1.0 );
+    }
+
+    unsigned int remainingExponent = static_cast< unsigned int >( std::abs( exponent ) );
+    DoubleDouble currentPower = base;
+    DoubleDouble result( 1.0 );
+    while( remainingExponent > 0 )
+    {
+        if( remainingExponent % 2 == 1 )
+        {
+            result = result * currentPower;
+        }
+        remainingExponent /= 2;
+        if( remainingExponent > 0 )
+        {
+            currentPower = square( currentPower );
+        }
+    }
+    return ( exponent < 0 ) ? 1.0 / result : result;
+}
+
+//! Function to compute a double-double number to a double-double power
+inline DoubleDouble pow( const DoubleDouble& base, const DoubleDouble& exponent )
+{
+    if( exponent == floor( exponent ) && std::fabs( exponent.getHigh( ) ) < 1.0E9 )
+    {
+        return pow( base, static_cast< int >( exponent.getHigh( ) ) );
+    }
+    return exp( exponent * log( base ) );
+}
+
+//! Function to compute a double-double number to a power (given as other arithmetic type)
+template< typename ScalarType, typename std::enable_if< std::is_arithmetic< ScalarType >::value &&
+          !std::is_same< ScalarType, int >::value, int >::type = 0 >
+inline DoubleDouble pow( const DoubleDouble& base, const ScalarType exponent )
+{
+    return pow( base, DoubleDouble( exponent ) );
+}
+
+//! Function to compute a number (given as other arithmetic type) to a double-double power
+template< typename ScalarType, typename std::enable_if< std::is_arithmetic< ScalarType >::value, int >::type = 0 >
+inline DoubleDouble pow( const ScalarType base, const DoubleDouble& exponent )
+{
+    return pow( DoubleDouble( base ), exponent );
+}
+
+namespace double_double_detail
+{
+
+//! Function to compute the sine and cosine of a double-double number with |x| <= pi/4, from their Taylor series
+inline void computeReducedSineAndCosine( const DoubleDouble& number, DoubleDouble& sine, DoubleDouble& cosine )
+{
+    if( number.getHigh( ) == 0.0 )
+    {
+        sine = DoubleDouble( 0.0 );
+        cosine = DoubleDouble( 1.0 );
+        return;
+    }
+
+    DoubleDouble negativeSquare = -square( number );
+    DoubleDouble sineTerm = number;
+    DoubleDouble cosineTerm = DoubleDouble( 1.0 );
+    sine = sineTerm;
+    cosine = cosineTerm;
+    double tolerance = double_double_constants::EPSILON * 1.0E-3;
+    for( int i = 1; i < 20; i++ )
+    {
+        cosineTerm = cosineTerm * negativeSquare / static_cast< double >( ( 2 * i - 1 ) * ( 2 * i ) );
+        sineTerm = sineTerm * negativeSquare / static_cast< double >( ( 2 * i ) * ( 2 * i + 1 ) );
+        cosine = cosine + cosineTerm;
+        sine = sine + sineTerm;
+        if( std::fabs( cosineTerm.getHigh( ) ) < tolerance && std::fabs( sineTerm.getHigh( ) ) < tolerance * std::fabs( sine.getHigh( ) ) )
+        {
+            break;
+        }
+    }
+}
+
+//! Function to compute the sine and cosine of a double-double number, using reduction of the argument to |x| <= pi/4
+inline void computeSineAndCosine( const DoubleDouble& number, DoubleDouble& sine, DoubleDouble& cosine )
+{
+    if( !std::isfinite( number.getHigh( ) ) )
+    {
+        sine = DoubleDouble( std::numeric_limits< double >::quiet_NaN( ) );
+        cosine = sine;
+        return;
+    }
+
+    // Reduce argument modulo 2 pi, and subsequently modulo pi/2
+    DoubleDouble reducedArgument = number - double_double_constants::TWO_PI *
+            round( number / double_double_constants::TWO_PI );
+    double quadrant = std::floor( reducedArgument.getHigh( ) / double_double_constants::HALF_PI.getHigh( ) + 0.5 );
+    reducedArgument = reducedArgument - double_double_constants::HALF_PI * quadrant;
+
+    DoubleDouble reducedSine, reducedCosine;
+    computeReducedSineAndCosine( reducedArgument, reducedSine, reducedCosine );
+
+    switch( static_cast< int >( quadrant ) )
+    {
+    case 0:
+        sine = reducedSine;
+        cosine = reducedCosine;
+        break;
+    case 1:
+        sine = reducedCosine;
+        cosine = -reducedSine;
+        break;
+    case -1:
+        sine = -reducedCosine;
+        cosine = reducedSine;
+        break;
+    default:
+        sine = -reducedSine;
+        cosine = -reducedCosine;
+        break;
+    }
+}
+
+} // namespace double_double_detail
+
+//! Function to compute the sine of a double-double number
+inline DoubleDouble sin( const DoubleDouble& number )
+{
+    DoubleDouble sine, cosine;
+    double_double_detail::computeSineAndCosine( number, sine, cosine );
+    return sine;
+}
+
+//! Function to compute the cosine of a double-double number
+inline DoubleDouble cos( const DoubleDouble& number )
+{
+    DoubleDouble sine, cosine;
+    double_double_detail::computeSineAndCosine( number, sine, cosine );
+    return cosine;
+}
+
+//! Function to compute the tangent of a double-double number
+inline DoubleDouble tan( const DoubleDouble& number )
+{
+    DoubleDouble sine, cosine;
+    double_double_detail::computeSineAndCosine( number, sine, cosine );
+    return sine / cosine;
+}
+
+//! Function to compute the four-quadrant inverse tangent of two double-double numbers
+/*!
+ *  Function to compute the four-quadrant inverse tangent of two double-double numbers, from the double precision estimate,
+ *  with a single Newton-Raphson iteration on the sine or cosine of the angle (whichever is better conditioned).
+ */
+inline DoubleDouble atan2( const DoubleDouble& y, const DoubleDouble& x )
+{
+    if( x.getHigh( ) == 0.0 && y.getHigh( ) == 0.0 )
+    {
+        return DoubleDouble( std::atan2( y.getHigh( ), x.getHigh( ) ) );
+    }
+    if( !std::isfinite( x.getHigh( ) ) || !std::isfinite( y.getHigh( ) ) )
+    {
+        return DoubleDouble( std::atan2( y.getHigh( ), x.getHigh( ) ) );
+    }
+
+    DoubleDouble angle = DoubleDouble( std::atan2( y.getHigh( ), x.getHigh( ) ) );
+    DoubleDouble radius = sqrt( square( x ) + square( y ) );
+    DoubleDouble normalizedX = x / radius;
+    DoubleDouble normalizedY = y / radius;
+
+    DoubleDouble sine, cosine;
+    double_double_detail::computeSineAndCosine( angle, sine, cosine );
+    if( std::fabs( normalizedX.getHigh( ) ) > std::fabs( normalizedY.getHigh( ) ) )
+    {
+        angle = angle + ( normalizedY - sine ) / cosine;
+    }
+    else
+    {
+        angle = angle - ( normalizedX - cosine ) / sine;
+    }
+    return angle;
+}
+
+//! Function to compute the inverse tangent of a double-double number
+inline DoubleDouble atan( const DoubleDouble& number )
+{
+    return atan2( number, DoubleDouble( 1.0 ) );
+}
+
+//! Function to compute the inverse sine of a double-double number
+inline DoubleDouble asin( const DoubleDouble& number )
+{
+    if( abs( number ) > 1.0 )
+    {
+        return DoubleDouble( std::numeric_limits< double >::quiet_NaN( ) );
+    }
+    return atan2( number, sqrt( 1.0 - square( number ) ) );
+}
+
+//! Function to compute the inverse cosine of a double-double number
+inline DoubleDouble acos( const DoubleDouble& number )
+{
+    if( abs( number ) > 1.0 )
+    {
+        return DoubleDouble( std::numeric_limits< double >::quiet_NaN( ) );
+    }
+    return atan2( sqrt( 1.0 - square( number ) ), number );
+}
+
+//! Function to compute the hyperbolic sine of a double-double number
+inline DoubleDouble sinh( const DoubleDouble& number )
+{
+    if( std::fabs( number.getHigh( ) ) < 1.0E-2 )
+    {
+        // Use Taylor series to avoid cancellation
+        DoubleDouble squaredNumber = square( number );
+        DoubleDouble term = number;
+        DoubleDouble result = number;
+        for( int i = 1; i < 12; i++ )
+        {
+            term = term * squaredNumber / static_cast< double >( ( 2 * i ) * ( 2 * i + 1 ) );
+            result = result + term;
+        }
+        return result;
+    }
+    DoubleDouble exponential = exp( number );
+    return ldexp( exponential - 1.0 / exponential, -1 );
+}
+
+//! Function to compute the hyperbolic cosine of a double-double number
+inline DoubleDouble cosh( const DoubleDouble& number )
+{
+    DoubleDouble exponential = exp( number );
+    return ldexp( exponential + 1.0 / exponential, -1 );
+}
+
+//! Function to compute the hyperbolic tangent of a double-double number
+inline DoubleDouble tanh( const DoubleDouble& number )
+{
+    if( std::fabs( number.getHigh( ) ) > 40.0 )
+    {
+        return DoubleDouble( ( number.getHigh( ) > 0.0 ) ? 1.0 : -1.0 );
+    }
+    return sinh( number ) / cosh( number );
+}
+
+//! Function to compute the remainder of the division of two double-double numbers (with sign of the dividend)
+inline DoubleDouble fmod( const DoubleDouble& dividend, const DoubleDouble& divisor )
+{
+    DoubleDouble quotient = dividend / divisor;
+    DoubleDouble truncatedQuotient = ( quotient.getHigh( ) < 0.0 ) ? ceil( quotient ) : floor( quotient );
+    return dividend - truncatedQuotient * divisor;
+}
+
+//! Function to convert a double-double number to a string, in scientific notation
+/*!
+ *  Function to convert a double-double number to a string, in scientific notation with the given number of significant
+ *  digits (at most 32 of which are meaningful).
+ *  \param number Number that is to be converted
+ *  \param numberOfDigits Number of significant digits
+ *  \return String representation of number
+ */
+inline std::string toString( const DoubleDouble& number, const int numberOfDigits = 32 )
+{
+    if( !std::isfinite( number.getHigh( ) ) )
+    {
+        std::ostringstream stream;
+        stream << number.getHigh( );
+        return stream.str( );
+    }
+    else if( number.getHigh( ) == 0.0 )
+    {
+        return std::string( "0" );
+    }
+
+    // Normalize the number to the range [1, 10)
+    DoubleDouble absoluteValue = abs( number );
+    int decimalExponent = static_cast< int >( std::floor( std::log10( absoluteValue.getHigh( ) ) ) );
+    DoubleDouble mantissa = absoluteValue / pow( DoubleDouble( 10.0 ), decimalExponent );
+    if( mantissa >= 10.0 )
+    {
+        mantissa = mantissa / 10.0;
+        decimalExponent++;
+    }
+    else if( mantissa < 1.0 )
+    {
+        mantissa = mantissa * 10.0;
+        decimalExponent--;
+    }
+
+    // Extract digits, with one additional digit for rounding
+    int digitsToPrint = std::max( numberOfDigits, 1 );
+    std::vector< int > digits( digitsToPrint + 1 );
+    for( int i = 0; i <= digitsToPrint; i++ )
+    {
+        int digit = static_cast< int >( std::floor( mantissa.getHigh( ) ) );
+        digit = std::min( std::max( digit, 0 ), 9 );
+        digits[ i ] = digit;
+        mantissa = ( mantissa - static_cast< double >( digit ) ) * 10.0;
+    }
+
+    // Round last digit
+    if( digits[ digitsToPrint ] >= 5 )
+    {
+        int i = digitsToPrint - 1;
+        while( i >= 0 && ++digits[ i ] == 10 )
+        {
+            digits[ i ] = 0;
+            i--;
+        }
+        if( i < 0 )
+        {
+            digits.insert( digits.begin( ), 1 );
+            decimalExponent++;
+        }
+    }
+
+    std::string outputString = ( number.getHigh( ) < 0.0 ) ? "-" : "";
+    outputString += std::to_string( digits[ 0 ] );
+    if( digitsToPrint > 1 )
+    {
+        outputString += ".";
+        for( int i = 1; i < digitsToPrint; i++ )
+        {
+            outputString += std::to_string( digits[ i ] );
+        }
+    }
+    outputString += "e" + std::string( decimalExponent < 0 ? "-" : "+" ) +
+            ( std::abs( decimalExponent ) < 10 ? "0" : "" ) + std::to_string( std::abs( decimalExponent ) );
+    return outputString;
+}
+
+//! Function to parse a double-double number from a string (decimal or scientific notation)
+/*!
+ *  Function to parse a double-double number from a string (decimal or scientific notation), retaining the full
+ *  double-double precision of the input.
+ *  \param numberString String that is to be parsed
+ *  \return Parsed number
+ */
+inline DoubleDouble doubleDoubleFromString( const std::string& numberString )
+{
+    DoubleDouble result( 0.0 );
+    std::size_t index = 0;
+    while( index < numberString.size( ) && std::isspace( static_cast< unsigned char >( numberString[ index ] ) ) )
+    {
+        index++;
+    }
+
+    bool isNegative = false;
+    if( index < numberString.size( ) && ( numberString[ index ] == '-' || numberString[ index ] == '+' ) )
+    {
+        isNegative = ( numberString[ index ] == '-' );
+        index++;
+    }
+
+    int numberOfDecimals = 0;
+    bool isPastDecimalPoint = false;
+    bool isDigitFound = false;
+    for( ; index < numberString.size( ); index++ )
+    {
+        char currentCharacter = numberString[ index ];
+        if( std::isdigit( static_cast< unsigned char >( currentCharacter ) ) )
+        {
+            result = result * 10.0 + static_cast< double >( currentCharacter - '0' );
+            isDigitFound = true;
+            if( isPastDecimalPoint )
+            {
+                numberOfDecimals++;
+            }
+        }
+        else if( currentCharacter == '.' && !isPastDecimalPoint )
+        {
+            isPastDecimalPoint = true;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    int exponent = 0;
+    if( index < numberString.size( ) && ( numberString[ index ] == 'e' || numberString[ index ] == 'E' ) )
+    {
+        exponent = std::stoi( numberString.substr( index + 1 ) );
+    }
+
+    if( !isDigitFound )
+    {
+        throw std::runtime_error( "Error when parsing double-double number from string " + numberString );
+    }
+
+    exponent -= numberOfDecimals;
+    if( exponent != 0 )
+    {
+        result = ( exponent > 0 ) ? result * pow( DoubleDouble( 10.0 ), exponent ) :
+                                    result / pow( DoubleDouble( 10.0 ), -exponent );
+    }
+    return isNegative ? -result : result;
+}
+
+//! Output operator for double-double numbers
+/*!
+ *  Output operator for double-double numbers. If the precision of the stream exceeds that of a double, the number is
+ *  written in scientific notation with the requested number of significant digits. Otherwise, the double precision value
+ *  is written, using the formatting settings of the stream.
+ */
+inline std::ostream& operator<<( std::ostream& stream, const DoubleDouble& number )
+{
+    if( stream.precision( ) > std::numeric_limits< double >::max_digits10 )
+    {
+        stream << toString( number, static_cast< int >( stream.precision( ) ) );
+    }
+    else
+    {
+        stream << number.getHigh( );
+    }
+    return stream;
+}
+
+} // namespace double_double
+
+//! Function to parse a double-double number from a string (declared in tudat namespace, as it can not be found by ADL)
+using double_double::doubleDoubleFromString;
+
+} // namespace tudat
+
+namespace std
+{
+
+//! Specialization of numeric limits for double-double numbers
+template< >
+class numeric_limits< tudat::DoubleDouble >
+{
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr bool has_signaling_NaN = true;
+    static constexpr float_denorm_style has_denorm = denorm_absent;
+    static constexpr bool has_denorm_loss = false;
+    static constexpr float_round_style round_style = round_to_nearest;
+    static constexpr bool is_iec559 = false;
+    static constexpr bool is_bounded = true;
+    static constexpr bool is_modulo = false;
+    static constexpr int digits = 106;
+    static constexpr int digits10 = 31;
+    static constexpr int max_digits10 = 33;
+    static constexpr int radix = 2;
+    static constexpr int min_exponent = numeric_limits< double >::min_exponent + 53;
+    static constexpr int min_exponent10 = numeric_limits< double >::min_exponent10 + 16;
+    static constexpr int max_exponent = numeric_limits< double >::max_exponent;
+    static constexpr int max_exponent10 = numeric_limits< double >::max_exponent10;
+    static constexpr bool traps = false;
+    static constexpr bool tinyness_before = false;
+
+    static constexpr tudat::DoubleDouble min( ) noexcept
+    {
+        // Smallest number for which the low part does not underflow
+        return tudat::DoubleDouble( 2.0041683600089728e-292 );
+    }
+    static constexpr tudat::DoubleDouble lowest( ) noexcept
+    {
+        return tudat::DoubleDouble( numeric_limits< double >::lowest( ) );
+    }
+    static constexpr tudat::DoubleDouble max( ) noexcept
+    {
+        return tudat::DoubleDouble::fromNormalizedComponents( 1.79769313486231570815e+308, 9.97920154767359795037e+291 );
+    }
+    static constexpr tudat::DoubleDouble epsilon( ) noexcept
+    {
+        return tudat::DoubleDouble( tudat::double_double_constants::EPSILON );
+    }
+    static constexpr tudat::DoubleDouble round_error( ) noexcept
+    {
+        return tudat::DoubleDouble( 0.5 );
+    }
+    static constexpr tudat::DoubleDouble infinity( ) noexcept
+    {
+        return tudat::DoubleDouble( numeric_limits< double >::infinity( ) );
+    }
+    static constexpr tudat::DoubleDouble quiet_NaN( ) noexcept
+    {
+        return tudat::DoubleDouble( numeric_limits< double >::quiet_NaN( ) );
+    }
+    static constexpr tudat::DoubleDouble signaling_NaN( ) noexcept
+    {
+        return tudat::DoubleDouble( numeric_limits< double >::signaling_NaN( ) );
+    }
+    static constexpr tudat::DoubleDouble denorm_min( ) noexcept
+    {
+        return min( );
+    }
+};
+
+} // namespace std
+
+namespace Eigen
+{
+
+//! Specialization of Eigen numerical traits for double-double numbers
+template< >
+struct NumTraits< tudat::DoubleDouble >: GenericNumTraits< tudat::DoubleDouble >
+{
+    typedef tudat::DoubleDouble Real;
+    typedef tudat::DoubleDouble NonInteger;
+    typedef tudat::DoubleDouble Nested;
+    typedef tudat::DoubleDouble Literal;
+
+    enum
+    {
+        IsComplex = 0,
+        IsInteger = 0,
+        IsSigned = 1,
+        RequireInitialization = 1,
+        ReadCost = 2,
+        AddCost = 20,
+        MulCost = 10
+    };
+
+    static inline Real epsilon( )
+    {
+        return std::numeric_limits< tudat::DoubleDouble >::epsilon( );
+    }
+
+    static inline Real dummy_precision( )
+    {
+        return Real( 1.0E-28 );
+    }
+
+    static inline int digits10( )
+    {
+        return std::numeric_limits< tudat::DoubleDouble >::digits10;
+    }
+};
+
+//! Definition of scalar types resulting from binary operations of double-double with double numbers
+template< typename BinaryOp >
+struct ScalarBinaryOpTraits< tudat::DoubleDouble, double, BinaryOp >
+{
+    typedef tudat::DoubleDouble ReturnType;
+};
+
+template< typename BinaryOp >
+struct ScalarBinaryOpTraits< double, tudat::DoubleDouble, BinaryOp >
+{
+    typedef tudat::DoubleDouble ReturnType;
+};
+
+template< typename BinaryOp >
+struct ScalarBinaryOpTraits< tudat::DoubleDouble, long double, BinaryOp >
+{
+    typedef tudat::DoubleDouble ReturnType;
+};
+
+template< typename BinaryOp >
+struct ScalarBinaryOpTraits< long double, tudat::DoubleDouble, BinaryOp >
+{
+    typedef tudat::DoubleDouble ReturnType;
+};
+
+} // namespace Eigen
+
+#endif // TUDAT_DOUBLEDOUBLE_H
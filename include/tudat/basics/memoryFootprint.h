@@ -0,0 +1,171 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_MEMORYFOOTPRINT_H
+#define TUDAT_MEMORYFOOTPRINT_H
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Estimated bookkeeping size (in bytes) of a single node of a std::map, in addition to the size of its key and value
+const std::size_t MAP_NODE_OVERHEAD = 4 * sizeof( void* );
+
+//! Function to retrieve the heap memory held by an object without heap storage, which is zero
+/*!
+ *  Function to retrieve the heap memory held by an object without heap storage (e.g. a scalar, a fixed-size Eigen object or
+ *  a Time object), which is zero. This function is used for all types for which no other overload is defined.
+ *  \return Zero
+ */
+template< typename ValueType >
+std::size_t getHeapMemorySize( const ValueType& value );
+
+//! Function to retrieve the heap memory held by an Eigen matrix (zero for fixed-size matrices)
+template< typename ScalarType, int Rows, int Columns, int Options, int MaximumRows, int MaximumColumns >
+std::size_t getHeapMemorySize( const Eigen::Matrix< ScalarType, Rows, Columns, Options, MaximumRows, MaximumColumns >& matrix );
+
+//! Function to retrieve the heap memory held by a string (zero if the string is stored inside the object)
+inline std::size_t getHeapMemorySize( const std::string& value );
+
+//! Function to retrieve the heap memory held by a pair (sum of the heap memory held by both entries)
+template< typename FirstType, typename SecondType >
+std::size_t getHeapMemorySize( const std::pair< FirstType, SecondType >& value );
+
+//! Function to retrieve the heap memory held by a vector, including the heap memory held by its entries
+template< typename ValueType, typename AllocatorType >
+std::size_t getHeapMemorySize( const std::vector< ValueType, AllocatorType >& value );
+
+//! Function to retrieve the (estimated) heap memory held by a map, including the heap memory held by its keys and values
+template< typename KeyType, typename ValueType, typename CompareType, typename AllocatorType >
+std::size_t getHeapMemorySize( const std::map< KeyType, ValueType, CompareType, AllocatorType >& value );
+
+template< typename ValueType >
+std::size_t getHeapMemorySize( const ValueType& )
+{
+    return 0;
+}
+
+template< typename ScalarType, int Rows, int Columns, int Options, int MaximumRows, int MaximumColumns >
+std::size_t getHeapMemorySize( const Eigen::Matrix< ScalarType, Rows, Columns, Options, MaximumRows, MaximumColumns >& matrix )
+{
+    return ( Rows == Eigen::Dynamic || Columns == Eigen::Dynamic ) ?
+                static_cast< std::size_t >( matrix.size( ) ) * sizeof( ScalarType ) : 0;
+}
+
+std::size_t getHeapMemorySize( const std::string& value )
+{
+    return ( value.capacity( ) >= sizeof( std::string ) ) ? value.capacity( ) + 1 : 0;
+}
+
+template< typename FirstType, typename SecondType >
+std::size_t getHeapMemorySize( const std::pair< FirstType, SecondType >& value )
+{
+    return getHeapMemorySize( value.first ) + getHeapMemorySize( value.second );
+}
+
+template< typename ValueType, typename AllocatorType >
+std::size_t getHeapMemorySize( const std::vector< ValueType, AllocatorType >& value )
+{
+    std::size_t heapMemorySize = value.capacity( ) * sizeof( ValueType );
+    for( unsigned int i = 0; i < value.size( ); i++ )
+    {
+        heapMemorySize += getHeapMemorySize( value[ i ] );
+    }
+    return heapMemorySize;
+}
+
+template< typename KeyType, typename ValueType, typename CompareType, typename AllocatorType >
+std::size_t getHeapMemorySize( const std::map< KeyType, ValueType, CompareType, AllocatorType >& value )
+{
+    std::size_t heapMemorySize = value.size( ) * ( sizeof( std::pair< const KeyType, ValueType > ) + MAP_NODE_OVERHEAD );
+    for( auto valueIterator = value.begin( ); valueIterator != value.end( ); valueIterator++ )
+    {
+        heapMemorySize += getHeapMemorySize( valueIterator->first ) + getHeapMemorySize( valueIterator->second );
+    }
+    return heapMemorySize;
+}
+
+//! Class to report the (heap) memory held by a set of objects, per category
+/*!
+ *  Class to report the (heap) memory held by a set of objects (e.g. propagation results, state transition matrix
+ *  interpolators or observations), as a list of named categories with the number of bytes held by the objects in each
+ *  category. Footprints of objects can be combined into a single footprint (see addFootprint), with an optional prefix
+ *  denoting the subsystem (e.g. "observations/"). The sizes are estimates: they include the heap storage of the data
+ *  (matrices, vectors, map nodes), but not the fixed size of the objects themselves, nor the overhead of the allocator.
+ */
+class MemoryFootprint
+{
+public:
+
+    //! Constructor
+    MemoryFootprint( ){ }
+
+    //! Function to add a number of bytes to a category (created if it does not yet exist)
+    /*!
+     *  Function to add a number of bytes to a category (created if it does not yet exist)
+     *  \param category Name of the category
+     *  \param numberOfBytes Number of bytes that is to be added
+     */
+    void addEntry( const std::string& category, const std::size_t numberOfBytes )
+    {
+        entries_[ category ] += numberOfBytes;
+    }
+
+    //! Function to add all entries of another footprint to this footprint
+    /*!
+     *  Function to add all entries of another footprint to this footprint. Entries with equal (prefixed) names are
+     *  summed.
+     *  \param memoryFootprint Footprint that is to be added to this footprint
+     *  \param prefix Prefix for the names of the added categories (if not empty, the names are prefix/category)
+     */
+    void addFootprint( const MemoryFootprint& memoryFootprint, const std::string& prefix = "" );
+
+    //! Function to retrieve the number of bytes per category
+    const std::map< std::string, std::size_t >& getEntries( ) const
+    {
+        return entries_;
+    }
+
+    //! Function to retrieve the number of bytes in a single category (zero if the category does not exist)
+    std::size_t getEntry( const std::string& category ) const
+    {
+        return ( entries_.count( category ) > 0 ) ? entries_.at( category ) : 0;
+    }
+
+    //! Function to retrieve the total number of bytes in all categories
+    std::size_t getTotalSize( ) const;
+
+    //! Function to retrieve the total number of bytes in all categories starting with a given prefix (e.g. "observations/")
+    std::size_t getTotalSize( const std::string& prefix ) const;
+
+    //! Function to retrieve a summary of the footprint, with one line (in MB) per category
+    std::string getSummary( ) const;
+
+private:
+
+    //! Number of bytes per category
+    std::map< std::string, std::size_t > entries_;
+};
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_MEMORYFOOTPRINT_H
@@ -0,0 +1,200 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_MODELEVALUATIONPROFILER_H
+#define TUDAT_MODELEVALUATIONPROFILER_H
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+//! Macro to concatenate two tokens (after macro expansion of the tokens)
+#define TUDAT_PROFILING_CONCATENATE_DETAIL( first, second ) first##second
+#define TUDAT_PROFILING_CONCATENATE( first, second ) TUDAT_PROFILING_CONCATENATE_DETAIL( first, second )
+
+//! Macro to time the remainder of the current scope, and add it to a profiled model (no-op if profiling is not compiled)
+/*!
+ *  Macro to time the remainder of the current scope, and add the wall time to the statistics of a profiled model. The first
+ *  argument is a (shared) pointer to a ModelEvaluationProfiler (no timing is done if it is a nullptr), the second the
+ *  index of the profiled model, as returned by ModelEvaluationProfiler::addProfiledModel (only evaluated if the profiler
+ *  is not a nullptr). Unless Tudat is compiled with
+ *  TUDAT_BUILD_WITH_PROPAGATION_PROFILING, this macro expands to nothing.
+ */
+#if TUDAT_BUILD_WITH_PROPAGATION_PROFILING
+#define TUDAT_PROFILE_MODEL_EVALUATION( profiler, modelIndex ) \
+    ::tudat::utilities::ScopedEvaluationTimer TUDAT_PROFILING_CONCATENATE( tudatScopedEvaluationTimer, __LINE__ )( \
+    profiler.get( ), ( profiler == nullptr ) ? -1 : ( modelIndex ) )
+#else
+#define TUDAT_PROFILE_MODEL_EVALUATION( profiler, modelIndex )
+#endif
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Function to check whether Tudat is compiled with the model evaluation profiling instrumentation
+inline bool isModelEvaluationProfilingAvailable( )
+{
+#if TUDAT_BUILD_WITH_PROPAGATION_PROFILING
+    return true;
+#else
+    return false;
+#endif
+}
+
+//! Function to escape a string for use in a JSON file
+std::string escapeJsonString( const std::string& unescapedString );
+
+//! Accumulated evaluation statistics of a single profiled model
+struct ProfiledModelStatistics
+{
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param category Category of the profiled model (e.g. acceleration_update, environment_update)
+     *  \param modelName Name of the profiled model (e.g. denoting the bodies involved and the model type)
+     */
+    ProfiledModelStatistics( const std::string& category, const std::string& modelName ):
+        category_( category ), modelName_( modelName ), accumulatedWallTime_( 0.0 ), numberOfCalls_( 0 ){ }
+
+    //! Category of the profiled model
+    std::string category_;
+
+    //! Name of the profiled model
+    std::string modelName_;
+
+    //! Wall time (in seconds) accumulated over all calls of the model
+    double accumulatedWallTime_;
+
+    //! Number of calls of the model
+    long long numberOfCalls_;
+};
+
+//! Class to accumulate the wall time and number of calls of a set of models (e.g. during a propagation)
+/*!
+ *  Class to accumulate the wall time and number of calls of a set of models (e.g. during a propagation). Each model is
+ *  registered once, through the addProfiledModel function, after which evaluations are added through the index of the
+ *  model, so that no look-up by name is required during the evaluations. The class is not thread-safe: evaluations of a
+ *  single profiler are to be added from a single thread.
+ */
+class ModelEvaluationProfiler
+{
+public:
+
+    //! Constructor
+    ModelEvaluationProfiler( ){ }
+
+    //! Function to register a model that is to be profiled
+    /*!
+     *  Function to register a model that is to be profiled. If a model with the same category and name is already
+     *  registered, the index of the existing model is returned.
+     *  \param category Category of the profiled model (e.g. acceleration_update, environment_update)
+     *  \param modelName Name of the profiled model (e.g. denoting the bodies involved and the model type)
+     *  \return Index of the profiled model, to be used as input to addEvaluation
+     */
+    int addProfiledModel( const std::string& category, const std::string& modelName );
+
+    //! Function to add the results of a single evaluation of a profiled model
+    /*!
+     *  Function to add the results of a single evaluation of a profiled model
+     *  \param modelIndex Index of the profiled model, as returned by addProfiledModel
+     *  \param wallTime Wall time (in seconds) of the evaluation
+     */
+    void addEvaluation( const int modelIndex, const double wallTime )
+    {
+        modelStatistics_[ modelIndex ].accumulatedWallTime_ += wallTime;
+        modelStatistics_[ modelIndex ].numberOfCalls_++;
+    }
+
+    //! Function to reset the accumulated statistics of all profiled models to zero (models remain registered)
+    void resetStatistics( );
+
+    //! Function to retrieve the accumulated statistics of all profiled models, in order of registration
+    const std::vector< ProfiledModelStatistics >& getModelStatistics( ) const
+    {
+        return modelStatistics_;
+    }
+
+    //! Function to retrieve the wall time accumulated over all models in a given category
+    double getAccumulatedWallTime( const std::string& category ) const;
+
+    //! Function to retrieve the report of the accumulated statistics as a JSON string
+    /*!
+     *  Function to retrieve the report of the accumulated statistics as a JSON string. The report is a JSON object with
+     *  the categories as keys, each containing an object with the model names as keys, each containing a
+     *  "wall_time" (in seconds) and "number_of_calls" entry.
+     *  \return JSON string of accumulated statistics
+     */
+    std::string getJsonReport( ) const;
+
+    //! Function to write the report of the accumulated statistics (see getJsonReport) to a JSON file
+    void writeJsonReport( const std::string& fileName ) const;
+
+private:
+
+    //! Accumulated statistics of all profiled models, in order of registration
+    std::vector< ProfiledModelStatistics > modelStatistics_;
+
+    //! Indices of profiled models in modelStatistics_, with category and model name as key
+    std::map< std::pair< std::string, std::string >, int > modelIndices_;
+};
+
+//! Class that times its own lifetime, and adds it to a profiled model upon destruction
+class ScopedEvaluationTimer
+{
+public:
+
+    //! Constructor, starts timer
+    /*!
+     *  Constructor, starts timer
+     *  \param profiler Profiler to which evaluation is to be added (no timing is done if nullptr)
+     *  \param modelIndex Index of the profiled model
+     */
+    ScopedEvaluationTimer( ModelEvaluationProfiler* profiler, const int modelIndex ):
+        profiler_( profiler ), modelIndex_( modelIndex )
+    {
+        if( profiler_ != nullptr )
+        {
+            startTime_ = std::chrono::steady_clock::now( );
+        }
+    }
+
+    //! Destructor, adds elapsed time to profiler
+    ~ScopedEvaluationTimer( )
+    {
+        if( profiler_ != nullptr )
+        {
+            profiler_->addEvaluation(
+                        modelIndex_, std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime_ ).count( ) );
+        }
+    }
+
+private:
+
+    //! Profiler to which evaluation is to be added
+    ModelEvaluationProfiler* profiler_;
+
+    //! Index of the profiled model
+    int modelIndex_;
+
+    //! Time at which the timer was started
+    std::chrono::steady_clock::time_point startTime_;
+};
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_MODELEVALUATIONPROFILER_H
@@ -0,0 +1,209 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PARALLELIZATION_H
+#define TUDAT_PARALLELIZATION_H
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Function to retrieve the number of concurrent threads supported by the hardware
+/*!
+ * Function to retrieve the number of concurrent threads supported by the hardware. If this number cannot be determined,
+ * a value of 1 is returned.
+ * \return Number of concurrent threads supported by the hardware
+ */
+int getNumberOfHardwareThreads( );
+
+//! Function to retrieve the number of threads that parallel tasks may use in the current context
+/*!
+ * Function to retrieve the number of threads that parallel tasks may use in the current context. This is the number of
+ * threads of the shared task scheduler (see setNumberOfSchedulerThreads), limited by any ScopedThreadLimit that is active
+ * in the calling thread (or in the task from which this function is called). This value is used as default number of
+ * threads by all parallel Tudat features.
+ * \return Number of threads that parallel tasks may use in the current context
+ */
+int getNumberOfAvailableThreads( );
+
+//! Function to set the number of threads of the shared task scheduler
+/*!
+ * Function to set the number of threads of the shared task scheduler, on which all parallel tasks in Tudat are executed
+ * (including the thread calling executeParallelTasks, so that numberOfThreads - 1 worker threads are used). A value of 1
+ * disables all parallelism, which is recommended when Tudat is called from an application that uses its own thread pool.
+ * By default, the number of hardware threads is used, unless the environment variable TUDAT_NUMBER_OF_THREADS is set.
+ * This number is an upper bound for all parallel Tudat features: a larger number of threads requested from any of them
+ * (e.g. through executeParallelTasks or ParallelTaskPool) is reduced to the number of scheduler threads, with a warning
+ * (given once). It may be set larger than the number of hardware threads. The worker threads are (re)started when the
+ * first parallel tasks are executed. This function must not be called while parallel tasks are being executed.
+ * \param numberOfThreads Number of threads of the shared task scheduler (values less than 1 are interpreted as 1)
+ */
+void setNumberOfSchedulerThreads( const int numberOfThreads );
+
+//! Function to retrieve the number of threads of the shared task scheduler
+int getNumberOfSchedulerThreads( );
+
+//! Function to set whether the worker threads of the shared task scheduler are to be bound to a single core
+/*!
+ * Function to set whether the worker threads of the shared task scheduler are to be bound to a single core each (worker i
+ * is bound to core i + 1, modulo the number of hardware threads). This is only supported on Linux, and is ignored on other
+ * platforms. The setting is applied when the worker threads are (re)started, and this function must not be called while
+ * parallel tasks are being executed.
+ * \param bindThreadsToCores Boolean denoting whether the worker threads are to be bound to a single core each
+ */
+void setSchedulerThreadAffinity( const bool bindThreadsToCores );
+
+//! Function to execute a set of independent tasks on the shared task scheduler
+/*!
+ * Function to execute a set of independent tasks on the shared task scheduler. The calling thread, and at most
+ * numberOfThreads - 1 idle worker threads of the scheduler, pick up the tasks in order of their index, so that the tasks with
+ * the lowest index are started first. The function returns when all tasks are completed. If any of the tasks throws an
+ * exception, the remaining (not yet started) tasks are not executed, and the exception of the task with the lowest index is
+ * rethrown in the calling thread once all tasks have finished. If the (available) number of threads is 1 (or less), all
+ * tasks are executed in order in the calling thread.
+ *
+ * This function may be called from inside a task (nested parallelism): the nested tasks are executed on the same worker
+ * threads, so that the total number of threads never exceeds the number of scheduler threads, and idle workers pick up
+ * the most recently started set of tasks first. The number of threads used by the nested tasks is limited to that of the
+ * enclosing set of tasks. Since tasks may be executed sequentially, they must not wait for each other.
+ * \param numberOfTasks Number of tasks that are to be executed
+ * \param taskFunction Function executing a single task, with the index of the task as input
+ * \param numberOfThreads Maximum number of threads over which the tasks are to be distributed. If this is larger than the
+ * number of threads of the shared task scheduler (see setNumberOfSchedulerThreads), the latter is used, and a warning is
+ * given (once per process).
+ */
+void executeParallelTasks(
+        const int numberOfTasks,
+        const std::function< void( const int ) >& taskFunction,
+        const int numberOfThreads = getNumberOfAvailableThreads( ) );
+
+//! Function to execute a set of independent tasks on the shared task scheduler, and reduce their results deterministically
+/*!
+ * Function to execute a set of independent tasks on the shared task scheduler (see executeParallelTasks), and reduce their
+ * results. The results are stored per task, and reduced in order of the task index once all tasks are completed, so that the
+ * result (including its round-off error) is independent of the number of threads and of the order in which the tasks
+ * were executed.
+ * \param numberOfTasks Number of tasks that are to be executed
+ * \param taskFunction Function executing a single task, with the index of the task as input, and its result as output
+ * \param reductionFunction Function combining the reduced result of the preceding tasks (first input) with the result of
+ * the next task (second input)
+ * \param initialValue Value with which the reduction is started (returned if numberOfTasks is 0)
+ * \param numberOfThreads Maximum number of threads over which the tasks are to be distributed
+ * \return Reduced result of all tasks
+ */
+template< typename ResultType >
+ResultType executeParallelReduction(
+        const int numberOfTasks,
+        const std::function< ResultType( const int ) >& taskFunction,
+        const std::function< ResultType( const ResultType&, const ResultType& ) >& reductionFunction,
+        const ResultType& initialValue,
+        const int numberOfThreads = getNumberOfAvailableThreads( ) )
+{
+    std::vector< ResultType > taskResults( std::max( numberOfTasks, 0 ), initialValue );
+    executeParallelTasks( numberOfTasks, [ & ]( const int taskIndex )
+    {
+        taskResults[ taskIndex ] = taskFunction( taskIndex );
+    }, numberOfThreads );
+
+    ResultType reducedResult = initialValue;
+    for( unsigned int i = 0; i < taskResults.size( ); i++ )
+    {
+        reducedResult = reductionFunction( reducedResult, taskResults[ i ] );
+    }
+    return reducedResult;
+}
+
+//! Class to limit the number of threads used by parallel tasks started from the current thread, during its lifetime
+/*!
+ * Class to limit the number of threads used by parallel tasks started from the current thread, during its lifetime. This
+ * allows the number of threads to be configured per simulation (or per call into Tudat), without modifying the settings of
+ * the shared task scheduler. The limit is inherited by (nested) tasks started from the current thread, and limits can only
+ * be tightened by nested objects. A limit of 1 disables parallelism in the current scope.
+ */
+class ScopedThreadLimit
+{
+public:
+
+    //! Constructor, sets the thread limit of the current thread
+    /*!
+     * Constructor, sets the thread limit of the current thread
+     * \param maximumNumberOfThreads Maximum number of threads that parallel tasks may use while this object exists
+     */
+    ScopedThreadLimit( const int maximumNumberOfThreads );
+
+    //! Destructor, restores the previous thread limit of the current thread
+    ~ScopedThreadLimit( );
+
+    ScopedThreadLimit( const ScopedThreadLimit& ) = delete;
+
+    ScopedThreadLimit& operator=( const ScopedThreadLimit& ) = delete;
+
+private:
+
+    //! Thread limit before construction of this object (0 if none)
+    int previousThreadLimit_;
+};
+
+//! Class to repeatedly execute sets of independent tasks, distributed over a fixed number of threads
+/*!
+ * Class to repeatedly execute sets of independent tasks, distributed over a fixed number of threads, such as operations
+ * inside each state derivative evaluation. The tasks are executed on the shared task scheduler (see executeParallelTasks),
+ * so that no threads are created by this class, and nested use (e.g. inside a parallel propagation of multiple arcs) does
+ * not oversubscribe the cores. The distribution of the tasks and the handling of exceptions is identical to that of
+ * executeParallelTasks.
+ */
+class ParallelTaskPool
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param numberOfThreads Maximum number of threads over which the tasks are distributed (including the calling thread),
+     * limited to the number of threads of the shared task scheduler when the tasks are executed
+     */
+    ParallelTaskPool( const int numberOfThreads ):
+        numberOfThreads_( numberOfThreads < 1 ? 1 : numberOfThreads ){ }
+
+    //! Function to execute a set of independent tasks, distributed over the threads of the pool
+    /*!
+     * Function to execute a set of independent tasks, distributed over the threads of the pool (see executeParallelTasks).
+     * The function returns when all tasks are completed.
+     * \param numberOfTasks Number of tasks that are to be executed
+     * \param taskFunction Function executing a single task, with the index of the task as input
+     */
+    void executeTasks( const int numberOfTasks, const std::function< void( const int ) >& taskFunction )
+    {
+        executeParallelTasks( numberOfTasks, taskFunction, numberOfThreads_ );
+    }
+
+    //! Function to retrieve the number of threads over which the tasks are distributed
+    int getNumberOfThreads( )
+    {
+        return numberOfThreads_;
+    }
+
+private:
+
+    //! Maximum number of threads over which the tasks are distributed
+    int numberOfThreads_;
+};
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_PARALLELIZATION_H
@@ -0,0 +1,131 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PROCESS_COMMUNICATOR_H
+#define TUDAT_PROCESS_COMMUNICATOR_H
+
+#include <memory>
+#include <utility>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Base class for the communication between a group of processes that jointly perform a computation
+/*!
+ * Base class for the communication between a group of processes that jointly perform a computation (e.g. a multi-arc
+ * estimation in which the arcs are distributed over the processes). All functions of this class are collective operations:
+ * they must be called by all processes of the group, in the same order, and with the same data sizes.
+ */
+class ProcessCommunicator
+{
+public:
+
+    //! Destructor
+    virtual ~ProcessCommunicator( ){ }
+
+    //! Function to retrieve the index of the current process in the group (0 for the root process)
+    virtual int getProcessIndex( ) = 0;
+
+    //! Function to retrieve the number of processes in the group
+    virtual int getNumberOfProcesses( ) = 0;
+
+    //! Function to replace the given data by its sum over all processes
+    /*!
+     * Function to replace the given data by its (element-wise) sum over all processes
+     * \param data Data that is to be summed (modified by this function)
+     * \param dataSize Number of entries of the data
+     */
+    virtual void sumOverProcesses( double* data, const int dataSize ) = 0;
+
+    //! Function to replace the given data by its minimum over all processes
+    /*!
+     * Function to replace the given data by its (element-wise) minimum over all processes
+     * \param data Data of which the minimum is to be taken (modified by this function)
+     * \param dataSize Number of entries of the data
+     */
+    virtual void minimumOverProcesses( double* data, const int dataSize ) = 0;
+
+    //! Function to replace the given data by its maximum over all processes
+    /*!
+     * Function to replace the given data by its (element-wise) maximum over all processes
+     * \param data Data of which the maximum is to be taken (modified by this function)
+     * \param dataSize Number of entries of the data
+     */
+    virtual void maximumOverProcesses( double* data, const int dataSize ) = 0;
+
+    //! Function to replace the given data on all processes by that of the root process
+    /*!
+     * Function to replace the given data on all processes by that of the root process
+     * \param data Data that is to be broadcast (input on the root process, output on all other processes)
+     * \param dataSize Number of entries of the data
+     */
+    virtual void broadcastFromRootProcess( double* data, const int dataSize ) = 0;
+
+    //! Function to check whether the current process is the root process
+    bool isRootProcess( )
+    {
+        return getProcessIndex( ) == 0;
+    }
+};
+
+//! Process communicator for a group consisting of only the current process
+/*!
+ * Process communicator for a group consisting of only the current process, for which all collective operations leave
+ * the data unchanged.
+ */
+class SingleProcessCommunicator: public ProcessCommunicator
+{
+public:
+
+    int getProcessIndex( ){ return 0; }
+
+    int getNumberOfProcesses( ){ return 1; }
+
+    void sumOverProcesses( double*, const int ){ }
+
+    void minimumOverProcesses( double*, const int ){ }
+
+    void maximumOverProcesses( double*, const int ){ }
+
+    void broadcastFromRootProcess( double*, const int ){ }
+};
+
+//! Function to create a process communicator for all processes of the current MPI job
+/*!
+ * Function to create a process communicator for all processes of the current MPI job (MPI_COMM_WORLD). MPI is
+ * initialized by this function if this has not yet been done by the application (in which case it is finalized at program
+ * exit). Only available if Tudat is compiled with TUDAT_BUILD_WITH_MPI; an exception is thrown otherwise.
+ * \return Process communicator for all processes of the current MPI job
+ */
+std::shared_ptr< ProcessCommunicator > createMpiProcessCommunicator( );
+
+//! Function to determine the contiguous range of items that is assigned to a process
+/*!
+ * Function to determine the contiguous range of items (e.g. arcs) that is assigned to a process, when dividing a number of
+ * items over a number of processes in contiguous ranges of (nearly) equal size, in order of the process index.
+ * \param numberOfItems Total number of items
+ * \param processIndex Index of the process
+ * \param numberOfProcesses Number of processes
+ * \return Index of the first item, and index one beyond the last item, assigned to the process
+ */
+inline std::pair< int, int > getProcessItemRange( const int numberOfItems, const int processIndex, const int numberOfProcesses )
+{
+    return std::make_pair( static_cast< int >( static_cast< long long >( processIndex ) * numberOfItems / numberOfProcesses ),
+                           static_cast< int >( static_cast< long long >( processIndex + 1 ) * numberOfItems / numberOfProcesses ) );
+}
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_PROCESS_COMMUNICATOR_H
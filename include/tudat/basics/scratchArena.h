@@ -0,0 +1,201 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_SCRATCHARENA_H
+#define TUDAT_SCRATCHARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Monotonic arena of scratch memory for temporaries that live for a single (state derivative) function evaluation.
+/*!
+ *  Monotonic arena of scratch memory for temporaries that live for a single (state derivative) function evaluation.
+ *  Memory is handed out by bumping an offset into a block of doubles, and is released all at once by the reset function.
+ *  When a request does not fit in the current block, a new block is allocated from the heap. At the next reset, all blocks
+ *  are consolidated into a single block with the size of the largest total usage encountered so far, so that after the
+ *  first few evaluations (i.e. in the steady-state of a propagation) no heap allocations are made by the arena.
+ *
+ *  The arena is not thread-safe: each thread (e.g. each DynamicsStateDerivativeModel) must use its own arena. Memory
+ *  returned by the arena is only valid until the next call to reset.
+ */
+class ScratchArena
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param initialCapacity Number of doubles for which memory is allocated on construction
+     */
+    ScratchArena( const std::size_t initialCapacity = 0 );
+
+    //! Function to retrieve a block of uninitialized scratch memory
+    /*!
+     *  Function to retrieve a block of uninitialized scratch memory, valid until the next call to reset.
+     *  \param numberOfEntries Number of doubles in the block
+     *  \return Pointer to the first entry of the block
+     */
+    double* allocate( const std::size_t numberOfEntries );
+
+    //! Function to retrieve an uninitialized scratch vector
+    /*!
+     *  Function to retrieve an uninitialized scratch vector, valid until the next call to reset.
+     *  \param size Size of the vector
+     *  \return Map to the scratch memory of the vector
+     */
+    Eigen::Map< Eigen::VectorXd > allocateVector( const int size )
+    {
+        return Eigen::Map< Eigen::VectorXd >( allocate( static_cast< std::size_t >( size ) ), size );
+    }
+
+    //! Function to retrieve an uninitialized scratch matrix
+    /*!
+     *  Function to retrieve an uninitialized (column-major) scratch matrix, valid until the next call to reset.
+     *  \param rows Number of rows of the matrix
+     *  \param columns Number of columns of the matrix
+     *  \return Map to the scratch memory of the matrix
+     */
+    Eigen::Map< Eigen::MatrixXd > allocateMatrix( const int rows, const int columns )
+    {
+        return Eigen::Map< Eigen::MatrixXd >(
+                    allocate( static_cast< std::size_t >( rows ) * static_cast< std::size_t >( columns ) ), rows, columns );
+    }
+
+    //! Function to release all scratch memory handed out since the last reset.
+    /*!
+     *  Function to release all scratch memory handed out since the last reset. If more than one block was needed since the
+     *  last reset, the blocks are replaced by a single block that can hold the largest total usage encountered so far.
+     */
+    void reset( );
+
+    //! Function to retrieve the number of doubles currently handed out by the arena
+    std::size_t getCurrentUsage( ) const
+    {
+        return currentUsage_;
+    }
+
+    //! Function to retrieve the largest number of doubles handed out by the arena between two resets
+    std::size_t getHighWaterMark( ) const
+    {
+        return highWaterMark_;
+    }
+
+    //! Function to retrieve the number of doubles for which memory is currently held by the arena
+    std::size_t getCapacity( ) const;
+
+    //! Function to retrieve the number of heap allocations made by the arena since its creation
+    int getNumberOfBlockAllocations( ) const
+    {
+        return numberOfBlockAllocations_;
+    }
+
+private:
+
+    //! Function to add a new block of memory to the arena
+    void addBlock( const std::size_t blockSize );
+
+    //! Blocks of memory held by the arena (in order of allocation; only the last one is used for new requests)
+    std::vector< std::unique_ptr< double[ ] > > blocks_;
+
+    //! Sizes (in number of doubles) of the entries of blocks_
+    std::vector< std::size_t > blockSizes_;
+
+    //! Number of doubles handed out from the last entry of blocks_
+    std::size_t currentBlockOffset_;
+
+    //! Number of doubles handed out since the last reset
+    std::size_t currentUsage_;
+
+    //! Largest number of doubles handed out between two resets
+    std::size_t highWaterMark_;
+
+    //! Number of heap allocations made by the arena since its creation
+    int numberOfBlockAllocations_;
+};
+
+//! Function to retrieve the scratch arena that is active in the current thread
+/*!
+ *  Function to retrieve the scratch arena that is active in the current thread, as set by a ScopedScratchArena object.
+ *  Models that need temporaries during a state derivative evaluation may obtain them from this arena. If no arena is
+ *  active (i.e. outside of a state derivative evaluation), a nullptr is returned, and the model should use regular
+ *  (heap-allocated) temporaries.
+ *  \return Scratch arena that is active in the current thread (nullptr if none)
+ */
+ScratchArena* getCurrentScratchArena( );
+
+//! Function to retrieve a scratch matrix from the arena that is active in the current thread, if any
+/*!
+ *  Function to retrieve an uninitialized scratch matrix from the arena that is active in the current thread. If no arena
+ *  is active, the memory of the (resized) fallbackMatrix is used instead, so that models can use this function regardless
+ *  of whether they are evaluated inside a state derivative evaluation.
+ *  \param rows Number of rows of the matrix
+ *  \param columns Number of columns of the matrix
+ *  \param fallbackMatrix Matrix of which the memory is used if no arena is active (must outlive the returned map)
+ *  \return Map to the scratch memory of the matrix
+ */
+inline Eigen::Map< Eigen::MatrixXd > getScratchMatrix(
+        const int rows, const int columns, Eigen::MatrixXd& fallbackMatrix )
+{
+    ScratchArena* currentArena = getCurrentScratchArena( );
+    if( currentArena != nullptr )
+    {
+        return currentArena->allocateMatrix( rows, columns );
+    }
+    else
+    {
+        fallbackMatrix.resize( rows, columns );
+        return Eigen::Map< Eigen::MatrixXd >( fallbackMatrix.data( ), rows, columns );
+    }
+}
+
+//! Class that activates a scratch arena in the current thread for the lifetime of the object
+/*!
+ *  Class that activates a scratch arena in the current thread for the lifetime of the object. On construction, the arena
+ *  is reset, and set as the arena returned by getCurrentScratchArena. On destruction, the previously active arena (if any)
+ *  is restored, so that nested evaluations (e.g. of a different simulator) are supported.
+ */
+class ScopedScratchArena
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param arena Arena that is to be reset, and activated in the current thread
+     */
+    ScopedScratchArena( ScratchArena& arena );
+
+    //! Destructor, restores the previously active arena
+    ~ScopedScratchArena( );
+
+    ScopedScratchArena( const ScopedScratchArena& ) = delete;
+
+    ScopedScratchArena& operator=( const ScopedScratchArena& ) = delete;
+
+private:
+
+    //! Arena that was active in the current thread before the creation of this object
+    ScratchArena* previousArena_;
+};
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_SCRATCHARENA_H
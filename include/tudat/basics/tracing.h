@@ -0,0 +1,168 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_TRACING_H
+#define TUDAT_TRACING_H
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+//! Macro to concatenate two tokens (after macro expansion of the tokens)
+#define TUDAT_TRACING_CONCATENATE_DETAIL( first, second ) first##second
+#define TUDAT_TRACING_CONCATENATE( first, second ) TUDAT_TRACING_CONCATENATE_DETAIL( first, second )
+
+//! Macro to record the remainder of the current scope as a trace event (if tracing is enabled)
+/*!
+ *  Macro to record the remainder of the current scope as a trace event, if tracing is enabled at the start of the scope.
+ *  The name and category must be string literals (or otherwise have static storage duration), as only the pointers are
+ *  stored. If tracing is disabled, the cost of this macro is a single (relaxed) atomic load.
+ */
+#define TUDAT_TRACE_SCOPE( name, category ) \
+    ::tudat::utilities::ScopedTraceEvent TUDAT_TRACING_CONCATENATE( tudatScopedTraceEvent, __LINE__ )( name, category )
+
+//! Macro to record the remainder of the current scope as a trace event with an index (e.g. arc or iteration number)
+#define TUDAT_TRACE_SCOPE_WITH_INDEX( name, category, index ) \
+    ::tudat::utilities::ScopedTraceEvent TUDAT_TRACING_CONCATENATE( tudatScopedTraceEvent, __LINE__ )( \
+    name, category, static_cast< long long >( index ) )
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Name of the environment variable that, if set, enables tracing and defines the file to which the trace is written at exit
+const char* const TRACE_FILE_ENVIRONMENT_VARIABLE = "TUDAT_TRACE_FILE";
+
+//! Single (complete) trace event, denoting a named interval of wall time on a single thread
+struct TraceEvent
+{
+    //! Name of the event
+    const char* name_;
+
+    //! Category of the event (e.g. propagation, estimation)
+    const char* category_;
+
+    //! Start time of the event, in microseconds since the trace reference epoch
+    double startTime_;
+
+    //! Duration of the event, in microseconds
+    double duration_;
+
+    //! Index associated with the event (e.g. arc or iteration number), not exported if negative
+    long long index_;
+};
+
+namespace tracing_detail
+{
+
+//! Flag denoting whether tracing is enabled
+extern std::atomic< bool > isTracingEnabled;
+
+//! Function to retrieve the time since the trace reference epoch, in microseconds
+double getTraceTime( );
+
+//! Function to add an event to the trace buffer of the current thread
+void addTraceEvent( const TraceEvent& traceEvent );
+
+} // namespace tracing_detail
+
+//! Function to check whether tracing is enabled
+inline bool isTracingEnabled( )
+{
+    return tracing_detail::isTracingEnabled.load( std::memory_order_relaxed );
+}
+
+//! Function to enable or disable tracing
+/*!
+ *  Function to enable or disable tracing. Events recorded while tracing was enabled are retained when tracing is disabled,
+ *  until clearTraceEvents is called. Tracing can also be enabled at start-up by setting the environment variable
+ *  TUDAT_TRACE_FILE to the name of the file to which the trace is to be written when the process exits.
+ *  \param enableTracing Boolean denoting whether tracing is to be enabled
+ */
+void setTracingEnabled( const bool enableTracing );
+
+//! Function to remove all recorded trace events (of all threads)
+/*!
+ *  Function to remove all recorded trace events (of all threads). Must not be called while traced code is running
+ *  on other threads.
+ */
+void clearTraceEvents( );
+
+//! Function to retrieve all recorded trace events (of all threads), with the associated thread indices
+/*!
+ *  Function to retrieve all recorded trace events (of all threads), with the associated thread indices (numbered in the
+ *  order in which the threads first recorded an event). Must not be called while traced code is running on other threads.
+ *  \return List of pairs of thread index and recorded trace event
+ */
+std::vector< std::pair< int, TraceEvent > > getTraceEvents( );
+
+//! Function to retrieve the recorded trace events as a JSON string in the Chrome trace event format
+/*!
+ *  Function to retrieve the recorded trace events as a JSON string in the Chrome trace event format, which can be viewed
+ *  in the Perfetto UI (ui.perfetto.dev) or in chrome://tracing. Must not be called while traced code is running on other
+ *  threads.
+ *  \return JSON string of the recorded trace events
+ */
+std::string getChromeTraceJson( );
+
+//! Function to write the recorded trace events to a file in the Chrome trace event format (see getChromeTraceJson)
+void writeChromeTrace( const std::string& fileName );
+
+//! Class that records its own lifetime as a trace event, if tracing is enabled upon its construction
+class ScopedTraceEvent
+{
+public:
+
+    //! Constructor, starts recording the event if tracing is enabled
+    /*!
+     *  Constructor, starts recording the event if tracing is enabled
+     *  \param name Name of the event (must have static storage duration)
+     *  \param category Category of the event (must have static storage duration)
+     *  \param index Index associated with the event (not exported if negative)
+     */
+    ScopedTraceEvent( const char* name, const char* category, const long long index = -1 ):
+        isRecording_( isTracingEnabled( ) )
+    {
+        if( isRecording_ )
+        {
+            traceEvent_.name_ = name;
+            traceEvent_.category_ = category;
+            traceEvent_.index_ = index;
+            traceEvent_.startTime_ = tracing_detail::getTraceTime( );
+        }
+    }
+
+    //! Destructor, adds the event to the trace buffer of the current thread
+    ~ScopedTraceEvent( )
+    {
+        if( isRecording_ )
+        {
+            traceEvent_.duration_ = tracing_detail::getTraceTime( ) - traceEvent_.startTime_;
+            tracing_detail::addTraceEvent( traceEvent_ );
+        }
+    }
+
+private:
+
+    //! Boolean denoting whether the event is recorded
+    bool isRecording_;
+
+    //! Event that is recorded
+    TraceEvent traceEvent_;
+};
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_TRACING_H
@@ -15,6 +15,7 @@
 #include <type_traits>
 
 #include "tudat/basics/timeType.h"
+#include "tudat/basics/doubleDouble.h"
 
 namespace tudat
 {
@@ -67,6 +68,11 @@ struct is_state_scalar< long double > {
   static const bool value = true;
 };
 
+template< >
+struct is_state_scalar< DoubleDouble > {
+  static const bool value = true;
+};
+
 template< typename T >
 struct is_time_type {
   static const bool value = false;
@@ -91,6 +97,12 @@ struct is_state_scalar_and_time_type {
 template <typename TimeType>
 struct scalar_type;
 
+template <>
+struct scalar_type< float >
+{
+    using value_type = float;
+};
+
 template <>
 struct scalar_type< double >
 {
@@ -103,6 +115,12 @@ struct scalar_type< long double >
     using value_type = long double;
 };
 
+template <>
+struct scalar_type< DoubleDouble >
+{
+    using value_type = DoubleDouble;
+};
+
 template <>
 struct scalar_type< Time >
 {
@@ -63,4 +63,19 @@
 #define TUDAT_DEPRECATED( message, expression ) expression
 #endif
 
+//! Mark a function as callable from both host and CUDA device code.
+/*!
+ * Functions marked with this macro are compiled for the device when included in a CUDA source (compiled with nvcc),
+ * and as regular host functions otherwise. This allows the same implementation to be used by a CUDA kernel and by
+ * its host (CPU) fallback, when Tudat is built without TUDAT_BUILD_WITH_CUDA.
+ *
+ * Example:
+ * TUDAT_HOST_DEVICE inline double square( const double value ) { return value * value; }
+ */
+#ifdef __CUDACC__
+#define TUDAT_HOST_DEVICE __host__ __device__
+#else
+#define TUDAT_HOST_DEVICE
+#endif
+
 #endif // TUDAT_UTILITY_MACROS_H
@@ -0,0 +1,136 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_JSONBATCHRUNNER_H
+#define TUDAT_JSONBATCHRUNNER_H
+
+#include "tudat/basics/parallelization.h"
+
+#include "tudat/interface/json/jsonInterface.h"
+
+namespace tudat
+{
+
+namespace json_interface
+{
+
+//! Class for managing a single JSON-based simulation that is part of a batch (see runJsonSimulationBatch).
+/*!
+ * Class for managing a single JSON-based simulation that is part of a batch. Identical to JsonSimulationManager, except
+ * that the Spice settings are only parsed (and not loaded), since the Spice kernels are shared by all simulations in the
+ * batch, and are loaded once by runJsonSimulationBatch.
+ */
+template< typename TimeType = double, typename StateScalarType = double >
+class JsonBatchCaseSimulationManager: public JsonSimulationManager< TimeType, StateScalarType >
+{
+public:
+
+    //! Constructor from JSON object.
+    /*!
+     * Constructor.
+     * \param jsonObject The root JSON object of this simulation (i.e. base object of batch, with case patch applied).
+     * \param initialClockTime Initial clock time from which the cumulative CPU time during the propagation will be
+     * computed.
+     */
+    JsonBatchCaseSimulationManager(
+            const nlohmann::json& jsonObject,
+            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) ):
+        JsonSimulationManager< TimeType, StateScalarType >( jsonObject, initialClockTime ){ }
+
+protected:
+
+    //! Reset spiceSettings_ from the current jsonObject_, without (re)loading the kernels.
+    void resetSpice( )
+    {
+        this->spiceSettings_ = nullptr;
+        updateFromJSONIfDefined( this->spiceSettings_, this->jsonObject_, Keys::spice );
+    }
+};
+
+//! Function to run a batch of JSON-based simulations, defined as variations of a single base input file.
+/*!
+ * Function to run a batch of JSON-based simulations, defined as variations of a single base input file, in a single
+ * process. The base input file is read and parsed once (and cached, see getCachedDeserializedJSON), after which the
+ * settings of each simulation are obtained by applying a patch to a copy of the base settings (see applyJSONPatch),
+ * e.g. { "integrator.stepSize": 20, "bodies.Asterix.mass": 500 }. The Spice kernels are loaded only once, from the settings
+ * in the base input file; the patches are not allowed to modify these settings. Environment data that is loaded on
+ * demand and shared between simulations (e.g. Earth orientation and space weather data) is likewise read only once.
+ * The simulations are distributed over the requested number of threads.
+ * \param baseInputFilePath Path to the root JSON input file with the base settings. Can be absolute or relative (to the
+ * working directory). The working directory is changed to the directory of this file.
+ * \param casePatches List of patches, one per simulation, each containing the key paths and values to be modified
+ * w.r.t. the base settings.
+ * \param numberOfThreads Number of threads over which the simulations are to be distributed.
+ * \param exportResults Whether the results of each simulation are to be exported, according to their export settings.
+ * \return List of simulation managers, in the order of the patches, containing the settings and results of each
+ * simulation.
+ */
+template< typename TimeType = double, typename StateScalarType = double >
+std::vector< std::shared_ptr< JsonSimulationManager< TimeType, StateScalarType > > > runJsonSimulationBatch(
+        const std::string& baseInputFilePath,
+        const std::vector< nlohmann::json >& casePatches,
+        const int numberOfThreads = 1,
+        const bool exportResults = true )
+{
+    const boost::filesystem::path inputFilePath = getPathForJSONFile( baseInputFilePath );
+    const std::shared_ptr< const nlohmann::json > baseJsonObject = getCachedDeserializedJSON( inputFilePath );
+
+    for ( unsigned int i = 0; i < casePatches.size( ); ++i )
+    {
+        if( !casePatches.at( i ).is_object( ) )
+        {
+            throw std::runtime_error( "Error in JSON simulation batch, patch of case " + std::to_string( i ) +
+                                      " is not an object." );
+        }
+        for ( nlohmann::json::const_iterator it = casePatches.at( i ).begin( ); it != casePatches.at( i ).end( ); ++it )
+        {
+            if ( KeyPath( it.key( ) ).front( ) == Keys::spice )
+            {
+                throw std::runtime_error( "Error in JSON simulation batch, patch of case " + std::to_string( i ) +
+                                          " modifies Spice settings, which are shared by all cases." );
+            }
+        }
+    }
+
+    // Relative paths in the input are resolved w.r.t. the working directory, which is shared by all threads
+    boost::filesystem::current_path( inputFilePath.parent_path( ) );
+
+    // Load Spice kernels once for all cases
+    std::shared_ptr< SpiceSettings > spiceSettings;
+    updateFromJSONIfDefined( spiceSettings, *baseJsonObject, Keys::spice );
+    loadSpiceKernels( spiceSettings );
+
+    std::vector< std::shared_ptr< JsonSimulationManager< TimeType, StateScalarType > > > simulationManagers(
+                casePatches.size( ) );
+    utilities::executeParallelTasks(
+                casePatches.size( ), [ & ]( const int caseIndex )
+    {
+        nlohmann::json caseJsonObject = *baseJsonObject;
+        applyJSONPatch( caseJsonObject, casePatches.at( caseIndex ) );
+
+        std::shared_ptr< JsonSimulationManager< TimeType, StateScalarType > > simulationManager =
+                std::make_shared< JsonBatchCaseSimulationManager< TimeType, StateScalarType > >( caseJsonObject );
+        simulationManager->updateSettings( );
+        simulationManager->runPropagation( );
+        if ( exportResults )
+        {
+            simulationManager->exportResults( );
+        }
+        simulationManagers.at( caseIndex ) = simulationManager;
+    }, numberOfThreads );
+
+    return simulationManagers;
+}
+
+} // namespace json_interface
+
+} // namespace tudat
+
+#endif // TUDAT_JSONBATCHRUNNER_H
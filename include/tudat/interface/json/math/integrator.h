@@ -30,10 +30,11 @@ static std::map< AvailableIntegrators, std::string > integratorTypes =
     { rungeKuttaVariableStepSize, "rungeKuttaVariableStepSize" },
     { adamsBashforthMoulton, "adamsBashforthMoulton" },
     { bulirschStoer, "bulirschStoer" },
+    { gaussJackson, "gaussJackson" },
 };
 
 //! `AvailableIntegrators` not supported by `json_interface`.
-static std::vector< AvailableIntegrators > unsupportedIntegratorTypes = { };
+static std::vector< AvailableIntegrators > unsupportedIntegratorTypes = { gaussJackson };
 
 //! Convert `AvailableIntegrators` to `json`.
 inline void to_json( nlohmann::json& jsonObject, const AvailableIntegrators& availableIntegrator )
@@ -11,6 +11,8 @@
 #ifndef TUDAT_JSONINTERFACE_MODULAR_H
 #define TUDAT_JSONINTERFACE_MODULAR_H
 
+#include <memory>
+
 #include <boost/filesystem.hpp>
 
 #include <nlohmann/json.hpp>
@@ -57,6 +59,33 @@ boost::filesystem::path getPathForJSONFile( const std::string& file, const boost
  */
 nlohmann::json getDeserializedJSON( const boost::filesystem::path& inputFilePath );
 
+//! Update the keys of a `json` object with the values of the keys of another `json` object.
+/*!
+ * Update the keys of \p jsonObject with the values of the keys of \p patch, in the same way as the elements of an
+ * array of objects in an input file are merged. The keys of \p patch can be key paths (e.g. "integrator.stepSize" or
+ * "bodies.Asterix.mass"), in which case only the value at the end of the key path is replaced.
+ * \param jsonObject The `json` object to be updated (passed by reference).
+ * \param patch The `json` object containing the keys (paths) and values to be set.
+ * \param filePath The file from which \p patch was retrieved, if any (used in error messages only).
+ */
+void applyJSONPatch( nlohmann::json& jsonObject, const nlohmann::json& patch,
+                     const boost::filesystem::path& filePath = boost::filesystem::path( ) );
+
+//! Read and parse a `json` object from a file, reusing the result of previous calls.
+/*!
+ * Read and parse a `json` object from a file, including its imported modular files (see getDeserializedJSON). The
+ * result is cached, so that subsequent calls for the same file (e.g. the base input file of a batch of simulations)
+ * return the same read-only object without reading and parsing the file again. The file is read again if its
+ * modification time has changed. Note that changes in files imported by the root file are not detected (use
+ * clearDeserializedJSONCache in that case).
+ * \param inputFilePath Path to the root JSON file.
+ * \return Object containing the keys defined in the original file and all the imported files.
+ */
+std::shared_ptr< const nlohmann::json > getCachedDeserializedJSON( const boost::filesystem::path& inputFilePath );
+
+//! Clear the cache of deserialized `json` objects used by getCachedDeserializedJSON.
+void clearDeserializedJSONCache( );
+
 }  // namespace json_interface
 
 }  // namespace tudat
@@ -115,8 +115,9 @@ ExceptionResponseType getResponseToEvent( const nlohmann::json& jsonObject, cons
 // ACCESS HISTORY
 
 //! Global variable containing all the key paths that were accessed since clearAccessHistory() was called for the
-//! last time (or since this variable was initialized).
-extern std::set< KeyPath > accessedKeyPaths;
+//! last time (or since this variable was initialized). The history is kept per thread, so that several simulations can
+//! be set up concurrently (each in a single thread, see runJsonSimulationBatch).
+extern thread_local std::set< KeyPath > accessedKeyPaths;
 
 //! Clear the global variable accessedKeyPaths.
 /*!
@@ -160,6 +160,40 @@ Eigen::Vector6d calculateDoodsonFundamentalArguments(
  */
 Eigen::Vector6d calculateDoodsonFundamentalArguments( const double tdbTime );
 
+//! Function to convert Delaunay fundamental arguments and (GMST + pi) to Doodson arguments.
+/*!
+ * Function to convert Delaunay fundamental arguments and (GMST + pi) to Doodson arguments.
+ * \param delaunayArgumentsWithGmst Delaunay fundamental arguments and (GMST + pi), in the order (GMST + pi), l, l', F, D,
+ * Omega (see calculateDelaunayFundamentalArgumentsWithGmst)
+ * \return Doodson arguments, in the order (GMST + pi - s), s, h, p, N', p_{s}.
+ */
+Eigen::Vector6d convertDelaunayWithGmstToDoodsonFundamentalArguments( const Eigen::Vector6d& delaunayArgumentsWithGmst );
+
+//! Function to retrieve the Delaunay fundamental arguments and (GMST + pi), shared by all models evaluated at the same epoch.
+/*!
+ * Function to retrieve the Delaunay fundamental arguments and (GMST + pi) at the requested epoch, as computed by
+ * calculateDelaunayFundamentalArgumentsWithGmst. The most recently computed argument sets are stored per thread, keyed by
+ * the combination of TDB, TT and UT1, so that the models evaluated at the same epoch (e.g. short-period Earth orientation
+ * corrections and tidal deformation models) compute the arguments only once.
+ * \param tdbTime Time in TDB at which the arguments are to be calculated, in seconds since J2000.
+ * \param terrestrialTime Time in TT at which the arguments are to be calculated, in seconds since J2000.
+ * \param universalTime1 Time in UT1 at which the arguments are to be calculated, in seconds since J2000.
+ * \return Delaunay fundamental arguments and (GMST + pi) at the requested time.
+ */
+Eigen::Vector6d getSharedDelaunayFundamentalArgumentsWithGmst(
+        const double tdbTime, const double terrestrialTime, const double universalTime1 );
+
+//! Function to retrieve the approximate Delaunay fundamental arguments and (GMST + pi), shared by all models evaluated at the same epoch.
+/*!
+ * Function to retrieve the Delaunay fundamental arguments and (GMST + pi) at the requested epoch, as computed by
+ * calculateApproximateDelaunayFundamentalArgumentsWithGmst (TT and TDB assumed equal, as are UTC and UT1). The argument
+ * sets are stored as in getSharedDelaunayFundamentalArgumentsWithGmst, but keyed by TDB only, so that they are not shared
+ * with argument sets computed from explicitly provided TT and UT1.
+ * \param tdbTime Time in TDB at which the arguments are to be calculated, in seconds since J2000.
+ * \return Delaunay fundamental arguments and (GMST + pi) at the requested time.
+ */
+Eigen::Vector6d getSharedApproximateDelaunayFundamentalArgumentsWithGmst( const double tdbTime );
+
 } // namespace sofa_interfaces
 
 } // namespace tudat
@@ -24,6 +24,9 @@
 #ifndef TUDAT_SPICE_INTERFACE_H
 #define TUDAT_SPICE_INTERFACE_H
 
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -32,6 +35,7 @@
 
 #include "tudat/basics/basicTypedefs.h"
 #include "tudat/io/basicInputOutput.h"
+#include "tudat/math/basic/mathematicalConstants.h"
 
 extern "C" {
 #include <cspice/SpiceUsr.h>
@@ -44,6 +48,81 @@ namespace tudat {
 
 namespace spice_interface {
 
+//! Class containing the statistics on the (serialized) access to CSPICE
+/*!
+ *  Class containing the statistics on the access to CSPICE through the functions in this file. Since CSPICE is not
+ *  thread-safe, all calls are serialized by a single mutex (see getSpiceAccessMutex). A call is counted as contended when
+ *  the mutex was held by another thread when the call was made, in which case the time waiting for the mutex is added to
+ *  the total waiting time. A high fraction of contended calls indicates that SPICE-backed bodies limit the performance of a
+ *  parallel simulation, which may be resolved by pre-sampling the SPICE ephemerides (see
+ *  BodyListSettings::setSpiceEphemerisPreSampling).
+ */
+class SpiceAccessStatistics
+{
+public:
+
+    //! Constructor
+    SpiceAccessStatistics( const unsigned long long numberOfCalls = 0,
+                           const unsigned long long numberOfContendedCalls = 0,
+                           const unsigned long long numberOfCacheHits = 0,
+                           const double totalWaitingTime = 0.0 ):
+        numberOfCalls_( numberOfCalls ), numberOfContendedCalls_( numberOfContendedCalls ),
+        numberOfCacheHits_( numberOfCacheHits ), totalWaitingTime_( totalWaitingTime ){ }
+
+    //! Number of calls to CSPICE
+    unsigned long long numberOfCalls_;
+
+    //! Number of calls to CSPICE for which the mutex was held by another thread
+    unsigned long long numberOfContendedCalls_;
+
+    //! Number of requests that were retrieved from the (per-thread) result cache, without calling CSPICE
+    unsigned long long numberOfCacheHits_;
+
+    //! Total time (in seconds, summed over all threads) spent waiting for the mutex
+    double totalWaitingTime_;
+};
+
+//! Class containing the report on the Spice kernels that were loaded (see getSpiceKernelLoadingReport)
+/*!
+ *  Class containing the report on the Spice kernels that were loaded since the kernel pool was last cleared, and the
+ *  SPK kernels that were registered for loading on demand, but were not (yet) required (see
+ *  registerSpiceKernelForLoadingOnDemand).
+ */
+class SpiceKernelLoadingReport
+{
+public:
+
+    //! Constructor
+    SpiceKernelLoadingReport( ): totalLoadingTime_( 0.0 ){ }
+
+    //! Kernels that were loaded (in order of loading), with the time (in seconds) taken to load each of them
+    std::vector< std::pair< std::string, double > > loadedKernels_;
+
+    //! SPK kernels that are registered for loading on demand, but have not been loaded
+    std::vector< std::string > pendingKernels_;
+
+    //! Total time (in seconds) taken to load the kernels
+    double totalLoadingTime_;
+};
+
+//! Function to retrieve the mutex by which all access to CSPICE is serialized
+/*!
+ *  Function to retrieve the (recursive) mutex by which all access to CSPICE through the functions in this file is
+ *  serialized. Code calling CSPICE functions directly, while other threads may use the functions in this file, must lock
+ *  this mutex for the duration of its CSPICE calls.
+ *  \return Mutex by which access to CSPICE is serialized
+ */
+std::recursive_mutex& getSpiceAccessMutex( );
+
+//! Function to retrieve the statistics on the access to CSPICE since the last reset
+SpiceAccessStatistics getSpiceAccessStatistics( );
+
+//! Function to reset the statistics on the access to CSPICE
+void resetSpiceAccessStatistics( );
+
+//! Function to print the statistics on the access to CSPICE since the last reset
+void printSpiceAccessStatistics( );
+
 //! @get_docstring(convert_julian_date_to_ephemeris_time)
 double convertJulianDateToEphemerisTime(const double julianDate);
 
@@ -66,9 +145,44 @@ Eigen::Vector3d getBodyCartesianPositionAtEpoch(const std::string &targetBodyNam
                                                 const std::string &aberrationCorrections,
                                                 const double ephemerisTime);
 
+//! Function to retrieve the Cartesian states of a body at a set of equidistant epochs, sharing the result within the process
+/*!
+ *  Function to retrieve the Cartesian states of a body at the epochs initialTime, initialTime + timeStep, ..., up to (but
+ *  not including) finalTime, using getBodyCartesianStateAtEpoch (without aberration corrections). The result is retained
+ *  for the lifetime of the process (or until clearSpiceStateHistoryCache is called, or the kernel pool is modified), so
+ *  that subsequent calls with identical input (for instance when creating the default bodies repeatedly) do not call
+ *  CSPICE again. This function may be called from multiple threads concurrently.
+ *  \param targetBodyName Name of the body of which the state is to be retrieved
+ *  \param observerBodyName Name of the body relative to which the state is to be retrieved
+ *  \param referenceFrameName Name of the frame in which the state is to be expressed
+ *  \param initialTime First epoch at which the state is to be retrieved
+ *  \param finalTime Epoch up to which the state is to be retrieved
+ *  \param timeStep Time step between the epochs at which the state is to be retrieved
+ *  \return States of the body (in m and m/s), with the epochs as keys
+ */
+std::shared_ptr< const std::map< double, Eigen::Vector6d > > getBodyCartesianStateHistory(
+        const std::string &targetBodyName, const std::string &observerBodyName,
+        const std::string &referenceFrameName, const double initialTime,
+        const double finalTime, const double timeStep );
+
+//! Function to clear the cache of state histories used by getBodyCartesianStateHistory
+void clearSpiceStateHistoryCache( );
+
 //! @get_docstring(get_cartesian_state_from_tle_at_epoch)
 Eigen::Vector6d getCartesianStateFromTleAtEpoch(double epoch, std::shared_ptr<ephemerides::Tle> tle);
 
+//! Get Cartesian states of a satellite from its two-line element set at a list of epochs.
+/*!
+ * Get Cartesian states of a satellite from its two-line element set, at a list of epochs, in the True Equator, Mean Equinox
+ * frame (see getCartesianStateFromTleAtEpoch). Spice is locked only once for all epochs, so that the SGP4/SDP4
+ * propagator is initialized for the given elements only once.
+ * \param epochs Epochs (in seconds since J2000) at which the states are to be computed.
+ * \param tle TLE object of which the states are to be computed.
+ * \return Cartesian states (in m and m/s) at the given epochs, with one column per epoch.
+ */
+Eigen::Matrix< double, 6, Eigen::Dynamic > getCartesianStatesFromTleAtEpochs(
+        const std::vector< double >& epochs, std::shared_ptr<ephemerides::Tle> tle );
+
 //! @get_docstring(compute_rotation_quaternion_between_frames)
 Eigen::Quaterniond computeRotationQuaternionBetweenFrames(const std::string &originalFrame,
                                                           const std::string &newFrame,
@@ -113,6 +227,10 @@ int convertBodyNameToNaifId(const std::string &bodyName);
 bool checkBodyPropertyInKernelPool(const std::string &bodyName, const std::string &bodyProperty);
 
 //! @get_docstring(load_kernel)
+/*!
+ *  Loading a kernel is serialized with all other access to CSPICE, and invalidates the per-thread result caches of
+ *  the state and rotation functions in this file.
+ */
 void loadSpiceKernelInTudat(const std::string &fileName);
 
 //! @get_docstring(get_total_count_of_kernels_loaded)
@@ -126,9 +244,65 @@ std::vector<std::string> getStandardSpiceKernels(const std::vector<std::string>
                                                      std::vector<std::string>());
 
 //! @get_docstring(load_standard_kernels)
+/*!
+ *  All kernels are loaded while holding the CSPICE access mutex, so that no other thread can query CSPICE while only a part
+ *  of the kernels is loaded. Kernels should nonetheless be loaded before starting any parallel computation that uses SPICE.
+ */
 void loadStandardSpiceKernels(const std::vector<std::string> alternativeEphemerisKernels =
                                   std::vector<std::string>());
 
+//! Function to register a Spice kernel for loading on demand
+/*!
+ *  Function to register a Spice kernel for loading on demand. SPK kernels (.bsp files) are not loaded, but are added to
+ *  the list of pending kernels, from which only those kernels that are required for the bodies and time interval of a
+ *  simulation are loaded (see loadPendingSpiceKernelsForBodies, which is called by createSystemOfBodies). All other
+ *  kernels (which are typically small) are loaded directly.
+ *  \param fileName Name (including path) of the kernel
+ */
+void registerSpiceKernelForLoadingOnDemand(const std::string &fileName);
+
+//! Function to register the standard Spice kernels for loading on demand
+/*!
+ *  Function to register the standard Spice kernels (see getStandardSpiceKernels) for loading on demand (see
+ *  registerSpiceKernelForLoadingOnDemand), as an alternative to loadStandardSpiceKernels. Only the SPK kernels required
+ *  for the bodies and time interval of a simulation are then loaded by createSystemOfBodies, which reduces the start-up
+ *  time and memory use of simulations that only use a few bodies. Note that Spice ephemerides that are not created by
+ *  createSystemOfBodies require the pending kernels to be loaded explicitly (see loadPendingSpiceKernelsForBodies and
+ *  loadAllPendingSpiceKernels).
+ *  \param alternativeEphemerisKernels List of SPK kernels that replace the standard SPK kernels (if non-empty)
+ */
+void loadStandardSpiceKernelsOnDemand(const std::vector<std::string> alternativeEphemerisKernels =
+                                          std::vector<std::string>());
+
+//! Function to retrieve the list of SPK kernels that are registered for loading on demand, but have not yet been loaded
+std::vector<std::string> getPendingSpiceKernels();
+
+//! Function to load the pending SPK kernels that are required for the states of a list of bodies in a time interval
+/*!
+ *  Function to load the pending SPK kernels (see registerSpiceKernelForLoadingOnDemand) that are required for the states
+ *  of a list of bodies in a time interval. The segments of each kernel are read from the file (without loading it), and
+ *  a kernel is loaded if it contains a segment for any of the bodies that overlaps the time interval. The center bodies
+ *  of these segments (and the barycenters of planets) are in turn added to the list of bodies, so that the full chain
+ *  of states to the solar system barycenter is available. If the NAIF ID of any of the bodies cannot be determined, all
+ *  pending kernels are loaded.
+ *  \param bodyNames Names of the bodies of which the states are required
+ *  \param startTime Start of the time interval in which the states are required (unbounded if NaN)
+ *  \param endTime End of the time interval in which the states are required (unbounded if NaN)
+ *  \return List of kernels that were loaded
+ */
+std::vector<std::string> loadPendingSpiceKernelsForBodies(const std::vector<std::string> &bodyNames,
+                                                          const double startTime = TUDAT_NAN,
+                                                          const double endTime = TUDAT_NAN);
+
+//! Function to load all SPK kernels that are registered for loading on demand, but have not yet been loaded
+void loadAllPendingSpiceKernels();
+
+//! Function to retrieve the report on the kernels that were loaded since the kernel pool was last cleared
+SpiceKernelLoadingReport getSpiceKernelLoadingReport();
+
+//! Function to print the report on the kernels that were loaded since the kernel pool was last cleared
+void printSpiceKernelLoadingReport();
+
 }// namespace spice_interface
 }// namespace tudat
 
@@ -125,6 +125,9 @@ public:
             Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
             const double secondsSinceEpoch );
 
+    //! Function to check whether the rotation depends only on time (true for this class)
+    bool isTimeDependentOnly( ){ return true; }
+
 private:
 
     std::string spiceFrameName_;
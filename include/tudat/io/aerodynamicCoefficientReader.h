@@ -11,6 +11,7 @@
 #include <map>
 #include "tudat/basics/utilities.h"
 
+#include "tudat/io/binaryCoefficientTable.h"
 #include "tudat/io/multiDimensionalArrayReader.h"
 
 namespace tudat
@@ -210,6 +211,68 @@ readAerodynamicCoefficients( const std::map< int, std::string >& fileNames )
                     coefficientArrays.at( 0 ), coefficientArrays.at( 1 ), coefficientArrays.at( 2 ) ), independentVariables );
 }
 
+//! Function to convert aerodynamic coefficients of N independent variables from text files to a binary coefficient table
+/*!
+ *  Function to convert aerodynamic force and moment coefficients of N independent variables from (text) coefficient files
+ *  to a single binary coefficient table (see writeBinaryCoefficientTable), with 6 components per coefficient: the three
+ *  force coefficients, followed by the three moment coefficients.
+ *  \param forceCoefficientFiles Map of file names for force coefficients (see readAerodynamicCoefficients)
+ *  \param momentCoefficientFiles Map of file names for moment coefficients (see readAerodynamicCoefficients). If empty,
+ *  the moment coefficients are set to zero.
+ *  \param binaryFileName Name (including path) of the binary file that is to be written
+ */
+template< unsigned int NumberOfDimensions >
+void convertGivenSizeAerodynamicCoefficientFilesToBinaryTable(
+        const std::map< int, std::string >& forceCoefficientFiles,
+        const std::map< int, std::string >& momentCoefficientFiles,
+        const std::string& binaryFileName )
+{
+    std::pair< boost::multi_array< Eigen::Vector3d, static_cast< size_t >( NumberOfDimensions ) >,
+            std::vector< std::vector< double > > > forceCoefficients =
+            readAerodynamicCoefficients< NumberOfDimensions >( forceCoefficientFiles );
+
+    // Store force and moment coefficients of each data point consecutively
+    std::vector< double > coefficients( 6 * forceCoefficients.first.num_elements( ), 0.0 );
+    for( unsigned int i = 0; i < forceCoefficients.first.num_elements( ); i++ )
+    {
+        Eigen::Map< Eigen::Vector3d >( coefficients.data( ) + 6 * i ) = forceCoefficients.first.data( )[ i ];
+    }
+
+    if( momentCoefficientFiles.size( ) > 0 )
+    {
+        std::pair< boost::multi_array< Eigen::Vector3d, static_cast< size_t >( NumberOfDimensions ) >,
+                std::vector< std::vector< double > > > momentCoefficients =
+                readAerodynamicCoefficients< NumberOfDimensions >( momentCoefficientFiles );
+        if( !compareIndependentVariables( forceCoefficients.second, momentCoefficients.second ) )
+        {
+            throw std::runtime_error( "Error when converting aerodynamic coefficients to binary table, "
+                                      "force and moment independent variables are inconsistent" );
+        }
+
+        for( unsigned int i = 0; i < momentCoefficients.first.num_elements( ); i++ )
+        {
+            Eigen::Map< Eigen::Vector3d >( coefficients.data( ) + 6 * i + 3 ) = momentCoefficients.first.data( )[ i ];
+        }
+    }
+
+    writeBinaryCoefficientTable( binaryFileName, forceCoefficients.second, coefficients.data( ), 6 );
+}
+
+//! Function to convert aerodynamic coefficients from text files to a binary coefficient table
+/*!
+ *  Function to convert aerodynamic force and moment coefficients from (text) coefficient files to a single binary
+ *  coefficient table (see convertGivenSizeAerodynamicCoefficientFilesToBinaryTable), with the number of independent
+ *  variables determined from the files.
+ *  \param forceCoefficientFiles Map of file names for force coefficients (see readAerodynamicCoefficients)
+ *  \param momentCoefficientFiles Map of file names for moment coefficients (see readAerodynamicCoefficients). If empty,
+ *  the moment coefficients are set to zero.
+ *  \param binaryFileName Name (including path) of the binary file that is to be written
+ */
+void convertAerodynamicCoefficientFilesToBinaryTable(
+        const std::map< int, std::string >& forceCoefficientFiles,
+        const std::map< int, std::string >& momentCoefficientFiles,
+        const std::string& binaryFileName );
+
 } // namespace input_output
 
 } // namespace tudat
@@ -22,7 +22,9 @@
 #include <iostream>
 #include <limits>
 #include <map>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
 #include <utility>
 
@@ -30,6 +32,7 @@
 
 #include <boost/filesystem.hpp>
 
+#include <tudat/io/bufferedTextFileWriter.h>
 #include <tudat/io/streamFilters.h>
 
 #include <tudat/paths.hpp>
@@ -185,6 +188,57 @@ void writeValueToStream(
   stream << std::endl;
 }
 
+//! Write a value to a buffered text file writer.
+/*!
+ * Write a value to a buffered text file writer, left-aligned at a specified
+ * precision, with the same layout as writeValueToStream(). Value is preceded
+ * by delimiter followed by a space, and followed by an end-of-line character.
+ * Helper function for writeDataMapToTextFile(). \tparam ValueType Type of the
+ * value to write. \param writer Writer to write to. \param value Value to
+ * write. \param precision Precision to write the value with. \param delimiter
+ * Delimiter to precede the value.
+ */
+template <typename ValueType,
+          typename std::enable_if<
+              !std::is_base_of<Eigen::EigenBase<ValueType>, ValueType>::value,
+              int>::type = 0>
+void writeValueToBuffer(BufferedTextFileWriter &writer, const ValueType &value,
+                        const int precision, const std::string &delimiter) {
+  writer.writeString(delimiter);
+  writer.writeCharacter(' ');
+  writer.writeValue(value, precision, precision + 1);
+  writer.writeCharacter('\n');
+}
+
+//! Write an Eigen type to a buffered text file writer.
+/*!
+ * Write an Eigen type to a buffered text file writer, row-by-row and
+ * left-aligned at a specified precision, with the same layout as
+ * writeValueToStream(). Helper function for writeDataMapToTextFile().
+ * \tparam Derived Eigen expression type to write. \param writer Writer to
+ * write to. \param value Value to write. \param precision Precision to write
+ * the value with. \param delimiter Delimiter to precede the value. \param
+ * endLineAfterRow Boolean to denote whether a new line is to be started after
+ * each row of the matrix
+ */
+template <typename Derived>
+void writeValueToBuffer(BufferedTextFileWriter &writer,
+                        const Eigen::MatrixBase<Derived> &value,
+                        const int precision, const std::string &delimiter,
+                        const bool endLineAfterRow = 0) {
+  for (int i = 0; i < value.rows(); i++) {
+    for (int j = 0; j < value.cols(); j++) {
+      writer.writeString(delimiter);
+      writer.writeCharacter(' ');
+      writer.writeValue(value(i, j), precision, precision + 1);
+    }
+    if (endLineAfterRow) {
+      writer.writeCharacter('\n');
+    }
+  }
+  writer.writeCharacter('\n');
+}
+
 //! Convert number to string with specified number of decimals.
 /*!
  * Convert number to string with specified number of decimals.
@@ -235,17 +289,17 @@ void writeDataMapToTextFile(InputIterator iteratorDataMap, InputIterator last,
   // Open output file.
   std::string outputDirectoryAndFilename =
       outputDirectory.string() + "/" + outputFilename;
-  std::ofstream outputFile_(outputDirectoryAndFilename.c_str());
+  BufferedTextFileWriter outputFile_(outputDirectoryAndFilename);
 
   // Write file header to file.
-  outputFile_ << fileHeader;
+  outputFile_.writeString(fileHeader);
 
   // Loop over map of propagation history.
   for (; iteratorDataMap != last; iteratorDataMap++) {
     // Print map data to output file.
-    outputFile_ << std::setprecision(precisionOfKeyType) << std::left
-                << std::setw(precisionOfKeyType + 1) << iteratorDataMap->first;
-    writeValueToStream(outputFile_, iteratorDataMap->second,
+    outputFile_.writeValue(iteratorDataMap->first, precisionOfKeyType,
+                           precisionOfKeyType + 1);
+    writeValueToBuffer(outputFile_, iteratorDataMap->second,
                        precisionOfValueType, delimiter);
   }
 
@@ -399,17 +453,69 @@ void writeMatrixToFile(
   // Open output file.
   std::string outputDirectoryAndFilename =
       outputDirectory.string() + "/" + outputFilename;
-  std::ofstream outputFile_(outputDirectoryAndFilename.c_str());
+  BufferedTextFileWriter outputFile_(outputDirectoryAndFilename);
 
   // Write header
-  outputFile_ << header;
+  outputFile_.writeString(header);
 
-  writeValueToStream(outputFile_, matrixToWrite, precisionOfMatrixEntries,
+  writeValueToBuffer(outputFile_, matrixToWrite, precisionOfMatrixEntries,
                      delimiter, true);
 
   outputFile_.close();
 }
 
+//! Write data, stored as a list of keys and a matrix of values, to text file.
+/*!
+ * Writes data to text file, with the same layout as writeDataMapToTextFile(),
+ * without requiring the data to be stored in a map (for instance for the
+ * concatenated times and observations of an observation collection). Row i of
+ * the values is written after key i.
+ * \tparam KeyType Data type for keys.
+ * \tparam Derived Eigen expression type of values.
+ * \param keys List of keys.
+ * \param values Matrix of values, with one row per key.
+ * \param outputFilename Output filename.
+ * \param outputDirectory Output directory. It will be created if it does not
+ * exist. \param fileHeader Text to be placed at the head of the output file.
+ * \param precisionOfKeyType Number of significant digits of keys to output.
+ * \param precisionOfValueType Number of significant digits of values to output
+ * (negative for shortest round-trip representation). \param delimiter
+ * Delimiter character, to delimit data entries in file.
+ */
+template <typename KeyType, typename Derived>
+void writeDataToTextFile(const std::vector<KeyType> &keys,
+                         const Eigen::MatrixBase<Derived> &values,
+                         const std::string &outputFilename,
+                         const boost::filesystem::path &outputDirectory,
+                         const std::string &fileHeader = "",
+                         const int precisionOfKeyType = 16,
+                         const int precisionOfValueType = 16,
+                         const std::string &delimiter = "\t") {
+  if (static_cast<int>(keys.size()) != values.rows()) {
+    throw std::runtime_error(
+        "Error when writing data to text file " + outputFilename +
+        ", number of keys (" + std::to_string(keys.size()) +
+        ") is not equal to number of rows of values (" +
+        std::to_string(values.rows()) + ")");
+  }
+
+  // Check if output directory exists; create it if it doesn't.
+  if (!boost::filesystem::exists(outputDirectory)) {
+    boost::filesystem::create_directories(outputDirectory);
+  }
+
+  BufferedTextFileWriter outputFile_(outputDirectory.string() + "/" +
+                                     outputFilename);
+  outputFile_.writeString(fileHeader);
+  for (unsigned int i = 0; i < keys.size(); i++) {
+    outputFile_.writeValue(keys.at(i), precisionOfKeyType,
+                           precisionOfKeyType + 1);
+    writeValueToBuffer(outputFile_, values.row(i), precisionOfValueType,
+                       delimiter);
+  }
+  outputFile_.close();
+}
+
 //! Write map of state/dependent variable IDs to text file.
 /*!
  * Write state/dependent variable IDs from a map to text file. Such a map is, for example,
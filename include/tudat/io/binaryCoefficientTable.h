@@ -0,0 +1,142 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_BINARY_COEFFICIENT_TABLE_H
+#define TUDAT_BINARY_COEFFICIENT_TABLE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tudat/io/memoryMappedFile.h"
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Version of the binary coefficient table format that is written by this code.
+static const uint32_t BINARY_COEFFICIENT_TABLE_VERSION = 1;
+
+//! Alignment (in bytes) of the start of the coefficient data in a binary coefficient table file.
+static const std::size_t BINARY_COEFFICIENT_TABLE_DATA_ALIGNMENT = 64;
+
+//! Function to write a table of coefficients, defined on a structured grid of N independent variables, to a binary file
+/*!
+ *  Function to write a table of coefficients, defined on a structured grid of N independent variables, to a binary file.
+ *  The file starts with an 8-byte identifier ("TUDATCTB"), followed by the format version, a byte order mark, the
+ *  number of independent variables and the number of components of each coefficient (all 32-bit unsigned integers), and
+ *  the offset of the coefficient data w.r.t. the start of the file (64-bit unsigned integer). This is followed by the
+ *  number of data points of each independent variable (64-bit unsigned integers), the data points of all independent
+ *  variables (double precision), and, starting at a multiple of BINARY_COEFFICIENT_TABLE_DATA_ALIGNMENT bytes, the
+ *  coefficients (double precision). The coefficients are stored in row-major order of the independent variables (i.e. as
+ *  in a boost::multi_array), with all components of a single coefficient stored consecutively.
+ *  \param fileName Name (including path) of the file that is to be written
+ *  \param independentVariables Data points of each of the independent variables
+ *  \param coefficients Pointer to the first entry of the coefficients, stored as described above
+ *  \param numberOfComponents Number of components of each coefficient
+ */
+void writeBinaryCoefficientTable(
+        const std::string& fileName,
+        const std::vector< std::vector< double > >& independentVariables,
+        const double* coefficients,
+        const unsigned int numberOfComponents );
+
+//! Class providing read-only access to a binary coefficient table, mapped into memory
+/*!
+ *  Class providing read-only access to a binary coefficient table (see writeBinaryCoefficientTable), mapped into memory.
+ *  The coefficients are not copied or parsed when the table is loaded, but are accessed directly from the memory mapping,
+ *  which is retained for the lifetime of this object. Objects of this class are typically created with the
+ *  loadBinaryCoefficientTable function, so that tables are shared by all users in the process.
+ */
+class BinaryCoefficientTable
+{
+public:
+
+    //! Constructor, maps the file into memory and checks its contents
+    /*!
+     *  Constructor, maps the file into memory and checks its contents. An exception is thrown if the file is not a valid
+     *  binary coefficient table, or was written with an unsupported version or different byte order.
+     *  \param fileName Name (including path) of the file that is to be loaded
+     */
+    BinaryCoefficientTable( const std::string& fileName );
+
+    //! Function to retrieve the number of independent variables of the coefficients
+    unsigned int getNumberOfDimensions( ) const
+    {
+        return independentVariables_.size( );
+    }
+
+    //! Function to retrieve the number of components of each coefficient
+    unsigned int getNumberOfComponents( ) const
+    {
+        return numberOfComponents_;
+    }
+
+    //! Function to retrieve the data points of each of the independent variables
+    const std::vector< std::vector< double > >& getIndependentVariables( ) const
+    {
+        return independentVariables_;
+    }
+
+    //! Function to retrieve the total number of coefficients (product of the number of points per independent variable)
+    std::size_t getNumberOfCoefficients( ) const
+    {
+        return numberOfCoefficients_;
+    }
+
+    //! Function to retrieve the pointer to the first entry of the coefficients (valid for the lifetime of this object)
+    const double* getCoefficients( ) const
+    {
+        return coefficients_;
+    }
+
+    //! Function to retrieve the name of the file from which the table is loaded
+    std::string getFileName( ) const
+    {
+        return mappedFile_->getFileName( );
+    }
+
+private:
+
+    //! Memory mapping of the file
+    std::shared_ptr< MemoryMappedFile > mappedFile_;
+
+    //! Number of components of each coefficient
+    unsigned int numberOfComponents_;
+
+    //! Data points of each of the independent variables
+    std::vector< std::vector< double > > independentVariables_;
+
+    //! Total number of coefficients
+    std::size_t numberOfCoefficients_;
+
+    //! Pointer to the first entry of the coefficients, in the memory mapping
+    const double* coefficients_;
+};
+
+//! Function to load a binary coefficient table, sharing a single copy of each table within the process
+/*!
+ *  Function to load a binary coefficient table. Tables are cached by file name, so that repeated calls for the same file
+ *  (for instance when creating many SystemOfBodies objects in a Monte Carlo analysis) return the same object, as long as
+ *  any user of the table still exists, without mapping the file again. This function may be called from multiple threads
+ *  concurrently.
+ *  \param fileName Name (including path) of the file that is to be loaded
+ *  \return Table loaded from the file
+ */
+std::shared_ptr< BinaryCoefficientTable > loadBinaryCoefficientTable( const std::string& fileName );
+
+} // namespace input_output
+
+} // namespace tudat
+
+#endif // TUDAT_BINARY_COEFFICIENT_TABLE_H
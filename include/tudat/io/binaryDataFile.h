@@ -0,0 +1,196 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_BINARY_DATA_FILE_H
+#define TUDAT_BINARY_DATA_FILE_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/io/memoryMappedFile.h"
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Version of the binary data file format that is written by this code.
+static const uint32_t BINARY_DATA_FILE_VERSION = 1;
+
+//! Function to check whether a file is a binary columnar data file
+/*!
+ *  Function to check whether a file is a binary columnar data file (see writeBinaryDataFile), by checking the identifier
+ *  at the start of the file.
+ *  \param fileName Name (including path) of the file that is to be checked
+ *  \return True if the file exists and starts with the identifier of a binary columnar data file
+ */
+bool isBinaryDataFile( const std::string& fileName );
+
+//! Function to write a list of keys, with a vector of values per key, to a binary columnar data file
+/*!
+ *  Function to write a list of keys (typically epochs), with a vector of values per key, to a binary columnar data file.
+ *  The file starts with an 8-byte identifier ("TUDATCOL"), followed by the format version, a byte order mark, the
+ *  number of value columns and the length of the header text (all 32-bit unsigned integers), and the number of rows
+ *  (64-bit unsigned integer). This is followed by the header text and, starting at a multiple of 8 bytes, the keys and
+ *  each of the value columns (double precision), with all entries of a column stored contiguously. All data is written
+ *  in the byte order of the platform (little-endian on all supported platforms).
+ *  \param fileName Name (including path) of the file that is to be written
+ *  \param keys List of keys
+ *  \param values Values, with one row per key (and one column per value entry)
+ *  \param header Header text (for instance describing the contents of the columns)
+ */
+void writeBinaryDataFile(
+        const std::string& fileName,
+        const std::vector< double >& keys,
+        const Eigen::MatrixXd& values,
+        const std::string& header = "" );
+
+//! Function to write a map of data to a binary columnar data file
+/*!
+ *  Function to write a map of data (for instance a state or dependent variable history) to a binary columnar data file
+ *  (see writeBinaryDataFile).
+ *  \param dataMap Map of data, with keys convertible to double, and scalar or Eigen column vector values (all of the same
+ *  size)
+ *  \param fileName Name (including path) of the file that is to be written
+ *  \param header Header text (for instance describing the contents of the columns)
+ */
+template< typename KeyType, typename ScalarType, int NumberOfRows >
+void writeDataMapToBinaryFile(
+        const std::map< KeyType, Eigen::Matrix< ScalarType, NumberOfRows, 1 > >& dataMap,
+        const std::string& fileName,
+        const std::string& header = "" )
+{
+    std::vector< double > keys;
+    keys.reserve( dataMap.size( ) );
+    Eigen::MatrixXd values = Eigen::MatrixXd::Zero(
+                dataMap.size( ), dataMap.size( ) == 0 ? 0 : dataMap.begin( )->second.rows( ) );
+
+    int rowIndex = 0;
+    for( auto it : dataMap )
+    {
+        if( it.second.rows( ) != values.cols( ) )
+        {
+            throw std::runtime_error( "Error when writing binary data file " + fileName + ", data sizes are inconsistent." );
+        }
+        keys.push_back( static_cast< double >( it.first ) );
+        values.row( rowIndex ) = it.second.transpose( ).template cast< double >( );
+        rowIndex++;
+    }
+    writeBinaryDataFile( fileName, keys, values, header );
+}
+
+//! Function to write a map of scalar data to a binary columnar data file
+/*!
+ *  Function to write a map of scalar data to a binary columnar data file (see writeBinaryDataFile).
+ *  \param dataMap Map of data, with keys and values convertible to double
+ *  \param fileName Name (including path) of the file that is to be written
+ *  \param header Header text (for instance describing the contents of the columns)
+ */
+template< typename KeyType >
+void writeDataMapToBinaryFile(
+        const std::map< KeyType, double >& dataMap,
+        const std::string& fileName,
+        const std::string& header = "" )
+{
+    std::vector< double > keys;
+    keys.reserve( dataMap.size( ) );
+    Eigen::MatrixXd values = Eigen::MatrixXd::Zero( dataMap.size( ), 1 );
+
+    int rowIndex = 0;
+    for( auto it : dataMap )
+    {
+        keys.push_back( static_cast< double >( it.first ) );
+        values( rowIndex, 0 ) = it.second;
+        rowIndex++;
+    }
+    writeBinaryDataFile( fileName, keys, values, header );
+}
+
+//! Class providing read-only access to a binary columnar data file, mapped into memory
+/*!
+ *  Class providing read-only access to a binary columnar data file (see writeBinaryDataFile), mapped into memory. The
+ *  keys and columns are not copied when the file is loaded, but are accessed directly from the memory mapping, which is
+ *  retained for the lifetime of this object.
+ */
+class BinaryDataFile
+{
+public:
+
+    //! Constructor, maps the file into memory and checks its contents
+    /*!
+     *  Constructor, maps the file into memory and checks its contents. An exception is thrown if the file is not a valid
+     *  binary data file, or was written with an unsupported version or different byte order.
+     *  \param fileName Name (including path) of the file that is to be loaded
+     */
+    BinaryDataFile( const std::string& fileName );
+
+    //! Function to retrieve the number of rows (keys) in the file
+    std::size_t getNumberOfRows( ) const
+    {
+        return numberOfRows_;
+    }
+
+    //! Function to retrieve the number of value columns in the file
+    unsigned int getNumberOfColumns( ) const
+    {
+        return numberOfColumns_;
+    }
+
+    //! Function to retrieve the header text of the file
+    std::string getHeader( ) const
+    {
+        return header_;
+    }
+
+    //! Function to retrieve the keys, mapped from the file
+    Eigen::Map< const Eigen::VectorXd > getKeys( ) const
+    {
+        return Eigen::Map< const Eigen::VectorXd >( data_, numberOfRows_ );
+    }
+
+    //! Function to retrieve the values, mapped from the file, with one row per key
+    Eigen::Map< const Eigen::MatrixXd > getValues( ) const
+    {
+        return Eigen::Map< const Eigen::MatrixXd >( data_ + numberOfRows_, numberOfRows_, numberOfColumns_ );
+    }
+
+    //! Function to retrieve the contents of the file as a map, with a vector of values per key
+    std::map< double, Eigen::VectorXd > getDataMap( ) const;
+
+private:
+
+    //! Memory mapping of the file
+    std::shared_ptr< MemoryMappedFile > mappedFile_;
+
+    //! Number of rows (keys) in the file
+    std::size_t numberOfRows_;
+
+    //! Number of value columns in the file
+    unsigned int numberOfColumns_;
+
+    //! Header text of the file
+    std::string header_;
+
+    //! Pointer to the first key, in the memory mapping (followed by the value columns)
+    const double* data_;
+};
+
+} // namespace input_output
+
+} // namespace tudat
+
+#endif // TUDAT_BINARY_DATA_FILE_H
@@ -0,0 +1,179 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_BINARY_GRAVITY_FIELD_FILE_H
+#define TUDAT_BINARY_GRAVITY_FIELD_FILE_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <Eigen/Core>
+
+#include "tudat/io/memoryMappedFile.h"
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Version of the binary gravity field file format that is written by this code.
+static const uint32_t BINARY_GRAVITY_FIELD_FILE_VERSION = 1;
+
+//! Function to write spherical harmonic coefficients to a binary gravity field file
+/*!
+ *  Function to write spherical harmonic coefficients to a binary gravity field file, typically used as a cache of a text
+ *  gravity field file. The file starts with an 8-byte identifier ("TUDATSHC"), followed by the format version, a byte
+ *  order mark, the maximum degree and the length of the header line (all 32-bit unsigned integers), the size and
+ *  modification time of the source file (64-bit integers, used to detect outdated caches), the header line of the source
+ *  file, one checksum per degree (64-bit unsigned integers) and a checksum of all preceding data. The coefficients are
+ *  stored after this (starting at a multiple of 8 bytes), per degree and then per order (with 0 <= order <= degree), with
+ *  the cosine and sine coefficient of each degree and order stored consecutively (double precision). The coefficients up
+ *  to a given degree are therefore stored contiguously at the start of the data.
+ *  \param fileName Name (including path) of the file that is to be written
+ *  \param cosineCoefficients Cosine coefficients, with (degree, order) as (row, column); must be square
+ *  \param sineCoefficients Sine coefficients, with (degree, order) as (row, column); must be square
+ *  \param headerLine Header line of the source file (empty if the source file has no header)
+ *  \param sourceFileSize Size of the source file (in bytes)
+ *  \param sourceModificationTime Modification time of the source file
+ */
+void writeBinaryGravityFieldFile(
+        const std::string& fileName,
+        const Eigen::MatrixXd& cosineCoefficients,
+        const Eigen::MatrixXd& sineCoefficients,
+        const std::string& headerLine,
+        const int64_t sourceFileSize,
+        const int64_t sourceModificationTime );
+
+//! Class providing read-only access to a binary gravity field file, mapped into memory
+/*!
+ *  Class providing read-only access to a binary gravity field file (see writeBinaryGravityFieldFile), mapped into
+ *  memory. The header of the file is checked at construction. The coefficients are only accessed when they are
+ *  extracted, so that only the part of the file up to the requested maximum degree is read from disk. The checksums of
+ *  each degree are verified on first extraction. Objects of this class are typically created with the
+ *  loadBinaryGravityFieldFile function, so that the (read-only) coefficients are shared by all users in the process.
+ */
+class BinaryGravityFieldFile
+{
+public:
+
+    //! Constructor, maps the file into memory and checks its header
+    /*!
+     *  Constructor, maps the file into memory and checks its header. An exception is thrown if the file is not a valid
+     *  binary gravity field file, was written with an unsupported version or different byte order, or if the checksum of
+     *  the header is not correct.
+     *  \param fileName Name (including path) of the file that is to be loaded
+     */
+    BinaryGravityFieldFile( const std::string& fileName );
+
+    //! Function to retrieve the maximum degree (and order) of the coefficients in the file
+    int getMaximumDegree( ) const
+    {
+        return maximumDegree_;
+    }
+
+    //! Function to retrieve the header line of the source file
+    std::string getHeaderLine( ) const
+    {
+        return headerLine_;
+    }
+
+    //! Function to retrieve the size of the source file (in bytes)
+    int64_t getSourceFileSize( ) const
+    {
+        return sourceFileSize_;
+    }
+
+    //! Function to retrieve the modification time of the source file
+    int64_t getSourceModificationTime( ) const
+    {
+        return sourceModificationTime_;
+    }
+
+    //! Function to extract the coefficients up to a given degree and order
+    /*!
+     *  Function to extract the coefficients up to a given degree and order. Coefficients above the maximum degree of the
+     *  file are set to zero. An exception is thrown if the checksum of any of the degrees that are read is not correct.
+     *  This function may be called from multiple threads concurrently.
+     *  \param maximumDegree Maximum degree of the coefficients that are to be extracted
+     *  \param maximumOrder Maximum order of the coefficients that are to be extracted
+     *  \param cosineCoefficients Cosine coefficients, of size (maximumDegree + 1) x (maximumOrder + 1) (returned by
+     *  reference)
+     *  \param sineCoefficients Sine coefficients, of size (maximumDegree + 1) x (maximumOrder + 1) (returned by
+     *  reference)
+     */
+    void extractCoefficients( const int maximumDegree, const int maximumOrder,
+                              Eigen::MatrixXd& cosineCoefficients, Eigen::MatrixXd& sineCoefficients );
+
+    //! Function to retrieve the name of the file from which the coefficients are loaded
+    std::string getFileName( ) const
+    {
+        return mappedFile_->getFileName( );
+    }
+
+private:
+
+    //! Function to verify the checksums of all degrees up to the given degree (if not yet done)
+    void verifyChecksums( const int maximumDegree );
+
+    //! Memory mapping of the file
+    std::shared_ptr< MemoryMappedFile > mappedFile_;
+
+    //! Maximum degree (and order) of the coefficients in the file
+    int maximumDegree_;
+
+    //! Header line of the source file
+    std::string headerLine_;
+
+    //! Size of the source file (in bytes)
+    int64_t sourceFileSize_;
+
+    //! Modification time of the source file
+    int64_t sourceModificationTime_;
+
+    //! Pointer to the checksums of each degree, in the memory mapping
+    const char* degreeChecksums_;
+
+    //! Pointer to the first coefficient, in the memory mapping
+    const double* coefficients_;
+
+    //! Maximum degree up to which the checksums have been verified
+    int verifiedDegree_;
+
+    //! Mutex for the verification of the checksums
+    std::mutex verificationMutex_;
+};
+
+//! Function to load a binary gravity field file, sharing a single copy of each file within the process
+/*!
+ *  Function to load a binary gravity field file. Files are cached by file name, so that repeated calls for the same file
+ *  (for instance when creating many SystemOfBodies objects in a Monte Carlo analysis) return the same object, as long as
+ *  any user of the file still exists, without mapping the file again. This function may be called from multiple threads
+ *  concurrently.
+ *  \param fileName Name (including path) of the file that is to be loaded
+ *  \return Binary gravity field file
+ */
+std::shared_ptr< BinaryGravityFieldFile > loadBinaryGravityFieldFile( const std::string& fileName );
+
+//! Function to remove a binary gravity field file from the cache of loadBinaryGravityFieldFile
+/*!
+ *  Function to remove a binary gravity field file from the cache of loadBinaryGravityFieldFile, for instance when the
+ *  file has been found to be outdated and is to be regenerated. Existing users of the file are not affected.
+ *  \param fileName Name (including path) of the file that is to be removed from the cache
+ */
+void unloadBinaryGravityFieldFile( const std::string& fileName );
+
+} // namespace input_output
+
+} // namespace tudat
+
+#endif // TUDAT_BINARY_GRAVITY_FIELD_FILE_H
@@ -0,0 +1,201 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_BINARY_MULTI_ARRAY_FILE_H
+#define TUDAT_BINARY_MULTI_ARRAY_FILE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/multi_array.hpp>
+
+#include "tudat/io/memoryMappedFile.h"
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Version of the binary multi-array file format that is written by this code.
+static const uint32_t BINARY_MULTI_ARRAY_FILE_VERSION = 1;
+
+//! Function to check whether a file is a binary multi-array file
+/*!
+ *  Function to check whether a file is a binary multi-array file (see writeBinaryMultiArrayFile), by checking the
+ *  identifier at the start of the file.
+ *  \param fileName Name (including path) of the file that is to be checked
+ *  \return True if the file exists and starts with the identifier of a binary multi-array file
+ */
+bool isBinaryMultiArrayFile( const std::string& fileName );
+
+//! Function to write data on a structured grid, as a function of N independent variables, to a binary file
+/*!
+ *  Function to write data on a structured grid, as a function of N independent variables, to a binary file. This is the
+ *  binary equivalent of the coefficient files read by readCoefficientsFile. The file starts with an 8-byte identifier
+ *  ("TUDATMDA"), followed by the format version, a byte order mark, the number of independent variables and a reserved
+ *  entry (all 32-bit unsigned integers), and the number of values of each independent variable (64-bit unsigned integers).
+ *  This is followed by the values of each of the independent variables and the data on the grid (all double precision),
+ *  stored in the storage order of a boost::multi_array (last index varying fastest). All data is written in the byte order
+ *  of the platform (little-endian on all supported platforms).
+ *  \param fileName Name (including path) of the file that is to be written
+ *  \param independentVariables Values of each of the independent variables at which the data is defined
+ *  \param data Pointer to the data on the grid, with last index varying fastest
+ */
+void writeBinaryMultiArrayFile(
+        const std::string& fileName,
+        const std::vector< std::vector< double > >& independentVariables,
+        const double* data );
+
+//! Function to write a multi-array, and the values of the independent variables at which it is defined, to a binary file
+/*!
+ *  Function to write a multi-array, and the values of the independent variables at which it is defined, to a binary file
+ *  (see writeBinaryMultiArrayFile).
+ *  \param fileName Name (including path) of the file that is to be written
+ *  \param independentVariables Values of each of the independent variables at which the data is defined
+ *  \param multiArray Multi-array that is to be written
+ */
+template< std::size_t NumberOfDimensions >
+void writeMultiArrayToBinaryFile(
+        const std::string& fileName,
+        const std::vector< std::vector< double > >& independentVariables,
+        const boost::multi_array< double, NumberOfDimensions >& multiArray )
+{
+    if( independentVariables.size( ) != NumberOfDimensions )
+    {
+        throw std::runtime_error( "Error when writing binary multi-array file " + fileName + ", expected " +
+                                  std::to_string( NumberOfDimensions ) + " independent variables, got " +
+                                  std::to_string( independentVariables.size( ) ) );
+    }
+    for( unsigned int i = 0; i < NumberOfDimensions; i++ )
+    {
+        if( multiArray.shape( )[ i ] != independentVariables.at( i ).size( ) )
+        {
+            throw std::runtime_error( "Error when writing binary multi-array file " + fileName +
+                                      ", size of multi-array is inconsistent with independent variables." );
+        }
+    }
+
+    if( multiArray.storage_order( ) == boost::c_storage_order( ) )
+    {
+        writeBinaryMultiArrayFile( fileName, independentVariables, multiArray.data( ) );
+    }
+    else
+    {
+        std::vector< std::size_t > shape( multiArray.shape( ), multiArray.shape( ) + NumberOfDimensions );
+        boost::multi_array< double, NumberOfDimensions > reorderedMultiArray( shape );
+        reorderedMultiArray = multiArray;
+        writeBinaryMultiArrayFile( fileName, independentVariables, reorderedMultiArray.data( ) );
+    }
+}
+
+//! Class providing read-only access to a binary multi-array file, mapped into memory
+/*!
+ *  Class providing read-only access to a binary multi-array file (see writeBinaryMultiArrayFile), mapped into memory. The
+ *  data on the grid is not copied when the file is loaded, but is accessed directly from the memory mapping (which is
+ *  retained for the lifetime of this object), and can be used directly as a (read-only) multi-array.
+ */
+class BinaryMultiArrayFile
+{
+public:
+
+    //! Constructor, maps the file into memory and checks its contents
+    /*!
+     *  Constructor, maps the file into memory and checks its contents. An exception is thrown if the file is not a valid
+     *  binary multi-array file, or was written with an unsupported version or different byte order.
+     *  \param fileName Name (including path) of the file that is to be loaded
+     */
+    BinaryMultiArrayFile( const std::string& fileName );
+
+    //! Function to retrieve the number of independent variables of the data
+    unsigned int getNumberOfIndependentVariables( ) const
+    {
+        return independentVariables_.size( );
+    }
+
+    //! Function to retrieve the values of each of the independent variables at which the data is defined
+    const std::vector< std::vector< double > >& getIndependentVariables( ) const
+    {
+        return independentVariables_;
+    }
+
+    //! Function to retrieve the number of values of each of the independent variables
+    std::vector< std::size_t > getShape( ) const;
+
+    //! Function to retrieve the data on the grid as a multi-array, mapped from the file
+    /*!
+     *  Function to retrieve the data on the grid as a (read-only) multi-array, mapped from the file without copying. The
+     *  returned multi-array is valid for the lifetime of this object only.
+     *  \return Multi-array referencing the data in the file
+     */
+    template< std::size_t NumberOfDimensions >
+    boost::const_multi_array_ref< double, NumberOfDimensions > getMultiArrayReference( ) const
+    {
+        checkNumberOfDimensions( NumberOfDimensions );
+        return boost::const_multi_array_ref< double, NumberOfDimensions >( data_, getShape( ) );
+    }
+
+    //! Function to retrieve a copy of the data on the grid as a multi-array
+    /*!
+     *  Function to retrieve a copy of the data on the grid as a multi-array
+     *  \return Multi-array containing the data in the file
+     */
+    template< std::size_t NumberOfDimensions >
+    boost::multi_array< double, NumberOfDimensions > getMultiArray( ) const
+    {
+        checkNumberOfDimensions( NumberOfDimensions );
+        boost::multi_array< double, NumberOfDimensions > multiArray( getShape( ) );
+        std::copy( data_, data_ + multiArray.num_elements( ), multiArray.data( ) );
+        return multiArray;
+    }
+
+private:
+
+    //! Function to check whether the data has the expected number of independent variables (throws exception if not)
+    void checkNumberOfDimensions( const std::size_t numberOfDimensions ) const;
+
+    //! Name (including path) of the file
+    std::string fileName_;
+
+    //! Memory mapping of the file
+    std::shared_ptr< MemoryMappedFile > mappedFile_;
+
+    //! Values of each of the independent variables at which the data is defined
+    std::vector< std::vector< double > > independentVariables_;
+
+    //! Pointer to the data on the grid, in the memory mapping
+    const double* data_;
+};
+
+//! Function to read a multi-array, and the values of the independent variables at which it is defined, from a binary file
+/*!
+ *  Function to read a multi-array, and the values of the independent variables at which it is defined, from a binary
+ *  multi-array file (see writeBinaryMultiArrayFile).
+ *  \param fileName Name (including path) of the file
+ *  \return Pair: first entry containing multi-array of coefficients, second containing list of independent variables at
+ *  which coefficients are defined.
+ */
+template< std::size_t NumberOfDimensions >
+std::pair< boost::multi_array< double, NumberOfDimensions >, std::vector< std::vector< double > > >
+readMultiArrayAndIndependentVariablesFromBinaryFile( const std::string& fileName )
+{
+    BinaryMultiArrayFile binaryFile( fileName );
+    return std::make_pair( binaryFile.getMultiArray< NumberOfDimensions >( ), binaryFile.getIndependentVariables( ) );
+}
+
+} // namespace input_output
+
+} // namespace tudat
+
+#endif // TUDAT_BINARY_MULTI_ARRAY_FILE_H
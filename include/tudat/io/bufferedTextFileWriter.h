@@ -0,0 +1,170 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_BUFFERED_TEXT_FILE_WRITER_H
+#define TUDAT_BUFFERED_TEXT_FILE_WRITER_H
+
+#include <charconv>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Class to write formatted text to a file, using an internal buffer that is written to the file in large blocks
+/*!
+ *  Class to write formatted text to a file, using an internal buffer that is written to the file in large blocks.
+ *  Floating-point and integer values are formatted with std::to_chars, without the locale and stream state handling of
+ *  iostreams. For a non-negative precision, the output is identical to that of an std::ostream with
+ *  std::setprecision( precision ) (i.e. printf-style %g formatting). For a negative precision, the shortest
+ *  representation that reads back to exactly the same value is written. Values of other types are formatted through an
+ *  std::ostringstream. The buffer is written to file when it is full, and when the writer is flushed, closed or destroyed.
+ */
+class BufferedTextFileWriter
+{
+public:
+
+    //! Constructor, opens the file
+    /*!
+     *  Constructor, opens the file (overwriting any existing file). An exception is thrown if the file cannot be opened.
+     *  \param fileName Name (including path) of the file that is to be written
+     *  \param bufferSize Size (in bytes) of the internal buffer
+     */
+    BufferedTextFileWriter( const std::string& fileName, const std::size_t bufferSize = 1 << 20 );
+
+    //! Destructor, writes any remaining contents of the buffer to the file
+    ~BufferedTextFileWriter( );
+
+    //! Function to write a string
+    /*!
+     *  Function to write a string
+     *  \param data Pointer to the first character that is to be written
+     *  \param size Number of characters that are to be written
+     */
+    void writeString( const char* data, const std::size_t size );
+
+    //! Function to write a string
+    /*!
+     *  Function to write a string
+     *  \param text String that is to be written
+     */
+    void writeString( const std::string& text )
+    {
+        writeString( text.data( ), text.size( ) );
+    }
+
+    //! Function to write a single character
+    /*!
+     *  Function to write a single character
+     *  \param character Character that is to be written
+     */
+    void writeCharacter( const char character )
+    {
+        if( bufferPosition_ == buffer_.size( ) )
+        {
+            flush( );
+        }
+        buffer_[ bufferPosition_++ ] = character;
+    }
+
+    //! Function to write a value, left-aligned in a field of a given minimum width
+    /*!
+     *  Function to write a value, left-aligned in a field of a given minimum width (padded with spaces), equivalent to
+     *  stream << std::setprecision( precision ) << std::left << std::setw( width ) << value for a non-negative precision.
+     *  \param value Value that is to be written
+     *  \param precision Number of significant digits with which floating-point values are written; if negative, the
+     *  shortest representation that reads back to the same value is written.
+     *  \param width Minimum number of characters that is written
+     */
+    template< typename ValueType >
+    void writeValue( const ValueType& value, const int precision, const int width = 0 )
+    {
+        char formattedValue[ 64 ];
+        std::to_chars_result result;
+        result.ec = std::errc::value_too_large;
+
+        if constexpr( std::is_floating_point< ValueType >::value )
+        {
+            result = ( precision < 0 ) ?
+                        std::to_chars( formattedValue, formattedValue + 64, value ) :
+                        std::to_chars( formattedValue, formattedValue + 64, value, std::chars_format::general, precision );
+        }
+        else if constexpr( std::is_integral< ValueType >::value && !std::is_same< ValueType, bool >::value )
+        {
+            result = std::to_chars( formattedValue, formattedValue + 64, value );
+        }
+
+        if( result.ec == std::errc( ) )
+        {
+            writeString( formattedValue, static_cast< std::size_t >( result.ptr - formattedValue ) );
+            writePadding( static_cast< int >( result.ptr - formattedValue ), width );
+        }
+        else
+        {
+            // Use iostream formatting for other types, or values that are too long to format directly.
+            std::ostringstream valueStream;
+            valueStream << std::setprecision( precision < 0 ? 17 : precision ) << value;
+            std::string valueString = valueStream.str( );
+            writeString( valueString );
+            writePadding( static_cast< int >( valueString.size( ) ), width );
+        }
+    }
+
+    //! Function to write the contents of the buffer to the file
+    void flush( );
+
+    //! Function to write the contents of the buffer to the file, and close the file
+    /*!
+     *  Function to write the contents of the buffer to the file, and close the file. An exception is thrown if any of the
+     *  contents could not be written to the file. No further text may be written after this function is called.
+     */
+    void close( );
+
+private:
+
+    //! Function to write spaces, to fill a field of a given width
+    /*!
+     *  Function to write spaces, to fill a field of a given width
+     *  \param numberOfWrittenCharacters Number of characters already written in the field
+     *  \param width Width of the field
+     */
+    void writePadding( int numberOfWrittenCharacters, const int width )
+    {
+        for( ; numberOfWrittenCharacters < width; numberOfWrittenCharacters++ )
+        {
+            writeCharacter( ' ' );
+        }
+    }
+
+    //! Name (including path) of the file that is written
+    std::string fileName_;
+
+    //! Stream to which the buffer is written
+    std::ofstream fileStream_;
+
+    //! Buffer in which text is formatted, before it is written to file
+    std::vector< char > buffer_;
+
+    //! Number of characters currently in the buffer
+    std::size_t bufferPosition_;
+};
+
+} // namespace input_output
+
+} // namespace tudat
+
+#endif // TUDAT_BUFFERED_TEXT_FILE_WRITER_H
@@ -8,18 +8,21 @@
  *    http://tudat.tudelft.nl/LICENSE.
  *
  *    Notes
- *      If tabs are used as spaces, it doesn't work. The seperator should also be tabs then.
+ *      Whitespace (spaces and tabs) is always used as separator, in addition to the user-defined separators.
  *
  */
 
 #ifndef TUDAT_MATRIX_TEXT_FILEREADER_H
 #define TUDAT_MATRIX_TEXT_FILEREADER_H
 
+#include <charconv>
+#include <memory>
 #include <string>
 #include <vector>
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
+#include <type_traits>
 
 #include <Eigen/Core>
 
@@ -31,6 +34,8 @@
 #include <boost/iostreams/filtering_stream.hpp>
 #include <boost/lexical_cast.hpp>
 
+#include "tudat/basics/parallelization.h"
+#include "tudat/io/memoryMappedFile.h"
 #include "tudat/io/streamFilters.h"
 
 namespace tudat
@@ -38,15 +43,193 @@ namespace tudat
 namespace input_output
 {
 
+//! Lookup tables of the character types used when parsing separated numeric text.
+struct NumericTextFormat
+{
+    //! Constructor
+    /*!
+     * Constructor
+     * \param separators Separators used, every character in the string will be used as separator. Whitespace
+     * (space, tab and carriage return) is always used as separator as well.
+     * \param skipLinesCharacter Comment characters, every character in the string starts a comment that runs until
+     * the end of the line. Lines starting with a comment character are removed completely.
+     */
+    NumericTextFormat( const std::string& separators, const std::string& skipLinesCharacter );
+
+    //! Boolean per character, denoting whether it is a separator.
+    bool isSeparator_[ 256 ];
+
+    //! Boolean per character, denoting whether it starts a comment.
+    bool isCommentCharacter_[ 256 ];
+};
+
+//! Range of lines in separated numeric text, which is parsed as a single task.
+struct NumericTextChunk
+{
+    //! Pointer to the first character of the chunk.
+    const char* begin_;
+
+    //! Pointer to one past the last character of the chunk.
+    const char* end_;
+
+    //! Index of the first data line of the chunk, w.r.t. the first data line of the full text.
+    std::size_t firstRow_;
+
+    //! Number of data lines in the chunk.
+    std::size_t numberOfRows_;
+};
+
+//! Function to retrieve the next data line from separated numeric text.
+/*!
+ * Function to retrieve the next data line from separated numeric text, starting at a given position. Comments are
+ * removed from each line, after which lines that contain only whitespace are skipped.
+ * \param position Position from which the next line is searched; set to the start of the subsequent line (returned by
+ * reference).
+ * \param end Pointer to one past the last character of the text.
+ * \param format Character types used for parsing.
+ * \param lineBegin Pointer to the first character of the data line (returned by reference).
+ * \param lineEnd Pointer to one past the last character of the data line, excluding comments (returned by reference).
+ * \return True if a data line was found, false if the end of the text was reached.
+ */
+bool getNextNumericTextDataLine( const char*& position, const char* end, const NumericTextFormat& format,
+                                 const char*& lineBegin, const char*& lineEnd );
+
+//! Function to count the number of fields in a line of separated numeric text.
+/*!
+ * Function to count the number of fields in a line of separated numeric text, where consecutive separators are
+ * treated as a single separator.
+ * \param lineBegin Pointer to the first character of the line.
+ * \param lineEnd Pointer to one past the last character of the line.
+ * \param format Character types used for parsing.
+ * \return Number of fields in the line.
+ */
+unsigned int countNumericTextFields( const char* lineBegin, const char* lineEnd, const NumericTextFormat& format );
+
+//! Function to split separated numeric text into chunks of complete lines, and count the data lines in each chunk.
+/*!
+ * Function to split separated numeric text into chunks of complete lines (of approximately equal size), and count the
+ * data lines in each chunk, so that the chunks can be parsed concurrently into preallocated storage.
+ * \param begin Pointer to the first character of the text (after the header lines).
+ * \param end Pointer to one past the last character of the text.
+ * \param format Character types used for parsing.
+ * \param numberOfChunks Number of chunks into which the text is to be split (fewer chunks are returned for short
+ * texts).
+ * \param numberOfThreads Number of threads used to count the data lines.
+ * \return Chunks of the text, in order.
+ */
+std::vector< NumericTextChunk > splitNumericTextIntoChunks(
+        const char* begin, const char* end, const NumericTextFormat& format,
+        const int numberOfChunks, const int numberOfThreads );
+
+//! Function to skip header lines at the start of separated numeric text.
+/*!
+ * Function to skip header lines at the start of separated numeric text. Lines that start with a comment character are
+ * not counted as header lines (and are skipped as well), all other lines (including empty lines) are.
+ * \param begin Pointer to the first character of the text.
+ * \param end Pointer to one past the last character of the text.
+ * \param format Character types used for parsing.
+ * \param numberOfHeaderLines Number of header lines that is to be skipped.
+ * \return Pointer to the first character after the header lines.
+ */
+const char* skipNumericTextHeaderLines( const char* begin, const char* end, const NumericTextFormat& format,
+                                        const int numberOfHeaderLines );
+
+//! Function to parse a single field of separated numeric text.
+/*!
+ * Function to parse a single field of separated numeric text. Floating-point types are parsed with std::from_chars,
+ * which does not allocate memory. Other types, and fields that can not be parsed by std::from_chars, are parsed with
+ * boost::lexical_cast (which throws an exception for invalid fields).
+ * \param fieldBegin Pointer to the first character of the field.
+ * \param fieldEnd Pointer to one past the last character of the field.
+ * \return Value of the field.
+ */
+template< typename ScalarType >
+ScalarType parseNumericTextField( const char* fieldBegin, const char* fieldEnd )
+{
+    if constexpr( std::is_floating_point< ScalarType >::value )
+    {
+        const char* numberBegin = ( fieldBegin != fieldEnd && *fieldBegin == '+' ) ? fieldBegin + 1 : fieldBegin;
+        ScalarType value;
+        std::from_chars_result result = std::from_chars( numberBegin, fieldEnd, value );
+        if( result.ec == std::errc( ) && result.ptr == fieldEnd )
+        {
+            return value;
+        }
+    }
+    return boost::lexical_cast< ScalarType >( std::string( fieldBegin, fieldEnd ) );
+}
+
+//! Function to parse a chunk of separated numeric text into the rows of a preallocated matrix.
+/*!
+ * Function to parse a chunk of separated numeric text into the rows of a preallocated matrix.
+ * \param chunk Chunk of text that is to be parsed, with its first row in the matrix.
+ * \param format Character types used for parsing.
+ * \param dataMatrix Matrix into which the chunk is parsed, with the number of columns equal to the number of fields per
+ * line (rows of the chunk are modified, returned by reference).
+ */
+template< typename ScalarType >
+void parseNumericTextChunk( const NumericTextChunk& chunk, const NumericTextFormat& format,
+                            Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic >& dataMatrix )
+{
+    const int numberOfColumns = dataMatrix.cols( );
+    const char* position = chunk.begin_;
+    const char* lineBegin;
+    const char* lineEnd;
+    std::size_t rowIndex = chunk.firstRow_;
+    while( getNextNumericTextDataLine( position, chunk.end_, format, lineBegin, lineEnd ) )
+    {
+        int columnIndex = 0;
+        const char* current = lineBegin;
+        while( current < lineEnd )
+        {
+            // Skip separators, and find end of field
+            while( current < lineEnd && format.isSeparator_[ static_cast< unsigned char >( *current ) ] )
+            {
+                current++;
+            }
+            if( current == lineEnd )
+            {
+                break;
+            }
+            const char* fieldBegin = current;
+            while( current < lineEnd && !format.isSeparator_[ static_cast< unsigned char >( *current ) ] )
+            {
+                current++;
+            }
+
+            if( columnIndex >= numberOfColumns )
+            {
+                throw std::runtime_error( "Number of colums in row " + std::to_string( rowIndex ) + " is " +
+                                          std::to_string( countNumericTextFields( lineBegin, lineEnd, format ) ) +
+                                          "; should be " + std::to_string( numberOfColumns ) );
+            }
+            dataMatrix( rowIndex, columnIndex ) = parseNumericTextField< ScalarType >( fieldBegin, current );
+            columnIndex++;
+        }
+
+        if( columnIndex != numberOfColumns )
+        {
+            throw std::runtime_error( "Number of colums in row " + std::to_string( rowIndex ) + " is " +
+                                      std::to_string( columnIndex ) + "; should be " + std::to_string( numberOfColumns ) );
+        }
+        rowIndex++;
+    }
+}
+
 //! Read the file and return the data matrix.
 /*!
  * Read a textfile whith separated (space, tab, comma etc...) numbers. The class returns these
  * numbers as a matrixXd. The first line with numbers is used to define the number of columns.
+ * The file is mapped into memory, and parsed without intermediate copies of lines or fields: the data lines are first
+ * counted (in chunks of lines), after which the matrix is allocated, and each chunk is parsed directly into its rows.
+ * Both steps can be distributed over multiple threads.
  * \param relativePath Relative path to file.
  * \param separators Separators used, every character in the string will be used as separators.
- *         (multiple seperators possible).
- * \param skipLinesCharacter Skip lines starting with this character.
+ *         (multiple seperators possible). Whitespace is always used as separator.
+ * \param skipLinesCharacter Skip lines starting with this character (and remove comments starting with this character
+ *         from all other lines).
  * \param numberOfHeaderLines Number of header lines, i.e., number of lines to be skipped at the beginning of the file.
+ * \param numberOfThreads Number of threads used to parse the file.
  * \return The data matrix.
  */
 template< typename ScalarType = double >
@@ -54,100 +237,46 @@ Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic > readMatrixFromFile(
         const std::string& relativePath,
         const std::string& separators = "\t ;,",
         const std::string& skipLinesCharacter = "%",
-        const int numberOfHeaderLines = 0 )
+        const int numberOfHeaderLines = 0,
+        const int numberOfThreads = 1 )
 {
-    // Open input and output.
-    std::fstream file( relativePath.c_str( ), std::ios::in );
-    if ( file.fail( ) )
+    std::shared_ptr< MemoryMappedFile > mappedFile;
+    try
     {
-        throw std::runtime_error( "Data file could not be opened:" + relativePath );
-    }
-
-    std::stringstream filteredStream( std::ios::in | std::ios::out );
-    {
-        // Filter the file stream. This needs to be in its own scope, because filtering_stream::
-        // flush( ) does not work if the underlying end point is a stringstream, so the flush has
-        // to be forced by letting the filtering_stream go out of scope.
-        boost::iostreams::filtering_ostream filterProcessor;
-        for ( unsigned int i = 0; i < skipLinesCharacter.size( ); i++ )
-        {
-            // Remove all comments from the stream.
-            filterProcessor.push( input_output::stream_filters::RemoveComment(
-                                      skipLinesCharacter[ i ], true ) );
-        }
-
-        // Add the output to the filter chain.
-        filterProcessor.push( filteredStream );
-
-        // Copy the input to the filter.
-        boost::iostreams::copy( file, filterProcessor );
+        mappedFile = std::make_shared< MemoryMappedFile >( relativePath );
     }
-
-    // Seek stream back to start.
-    filteredStream.seekg( 0, std::ios::beg );
-
-    // Read the filtered stream into lines.
-    std::vector< std::string > lines_;
-    int numberOfLinesParsed = 0;
-    while ( !filteredStream.eof( ) )
+    catch( const std::runtime_error& )
     {
-        std::string line_;
-        getline( filteredStream, line_ );
-        if ( numberOfLinesParsed >= numberOfHeaderLines )
-        {
-            if ( !line_.empty( ) )
-            {
-                boost::trim_all( line_ );
-                lines_.push_back( line_ );
-            }
-        }
-        numberOfLinesParsed++;
+        throw std::runtime_error( "Data file could not be opened:" + relativePath );
     }
+    const char* begin = mappedFile->getData( );
+    const char* end = begin + mappedFile->getSize( );
+    NumericTextFormat format( separators, skipLinesCharacter );
 
-    // If there are no lines, return an empty matrix.
-    if ( lines_.empty( ) )
+    // Skip header, and determine the number of columns from the first data line.
+    begin = skipNumericTextHeaderLines( begin, end, format, numberOfHeaderLines );
+    const char* position = begin;
+    const char* firstLineBegin;
+    const char* firstLineEnd;
+    if( !getNextNumericTextDataLine( position, end, format, firstLineBegin, firstLineEnd ) )
     {
+        // If there are no lines, return an empty matrix.
         return Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic >( );
     }
+    const unsigned int numberOfColumns = countNumericTextFields( firstLineBegin, firstLineEnd, format );
 
-    const std::string realSeparators = std::string( separators ) + " ";
-
-    // Determine the number of columns from.
-    std::vector< std::string > lineSplit_;
-    boost::algorithm::split( lineSplit_, lines_[ 0 ], boost::is_any_of( realSeparators ),
-            boost::algorithm::token_compress_on );
-    const unsigned int numberOfColumns = lineSplit_.size( );
-
-    // Initialize the matrix with sizes obtained from the number of lines and the entries in the
-    // first line.
-    Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic > dataMatrix_( lines_.size( ), numberOfColumns );
-    for ( int rowIndex = 0; rowIndex < dataMatrix_.rows( ); rowIndex++ )
+    // Count the data lines per chunk, and parse chunks into the rows of the preallocated matrix.
+    std::vector< NumericTextChunk > chunks = splitNumericTextIntoChunks(
+                begin, end, format, numberOfThreads > 1 ? 4 * numberOfThreads : 1, numberOfThreads );
+    Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic > dataMatrix(
+                chunks.back( ).firstRow_ + chunks.back( ).numberOfRows_, numberOfColumns );
+    utilities::executeParallelTasks(
+                chunks.size( ), [ & ]( const int chunkIndex )
     {
-        lineSplit_.clear( );
-
-        // Read current line and split into separate entries.
-        boost::algorithm::split( lineSplit_, lines_[ rowIndex ],
-                                 boost::is_any_of( realSeparators ),
-                                 boost::algorithm::token_compress_on );
-
-        // Check if number of column entries in line matches the number of columns in the matrix.
-        // If not, throw a runtime error.
-        if ( lineSplit_.size( ) != numberOfColumns )
-        {
-            throw std::runtime_error( "Number of colums in row " + std::to_string( rowIndex )
-                   + " is " + std::to_string( lineSplit_.size( ) ) + "; should be " + std::to_string( numberOfColumns ) );
-        }
-
-        // Put single line entries into matrix as doubles.
-        for ( int columnIndex = 0; columnIndex < dataMatrix_.cols( ); columnIndex++ )
-        {
-            boost::trim( lineSplit_.at( columnIndex ) );
-            dataMatrix_( rowIndex, columnIndex ) =
-                    boost::lexical_cast< ScalarType >( lineSplit_.at( columnIndex ) );
-        }
-    }
+        parseNumericTextChunk< ScalarType >( chunks.at( chunkIndex ), format, dataMatrix );
+    }, numberOfThreads );
 
-    return dataMatrix_;
+    return dataMatrix;
 }
 
 } // namespace input_output
@@ -0,0 +1,92 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_MEMORY_MAPPED_FILE_H
+#define TUDAT_MEMORY_MAPPED_FILE_H
+
+#include <string>
+#include <vector>
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Class providing read-only access to the full contents of a binary file through a memory mapping
+/*!
+ *  Class providing read-only access to the full contents of a binary file through a memory mapping. The file is mapped
+ *  into memory at construction, and unmapped when the object is destroyed, so that pointers into the data retrieved
+ *  from this object are valid for the lifetime of the object only. Contents of the file are loaded by the operating system
+ *  on access, so that only those parts of the file that are actually used are read from disk. On platforms where memory
+ *  mapping is not supported, the full file is read into a buffer instead (aligned to a double-precision boundary, as is
+ *  the start of the mapping).
+ */
+class MemoryMappedFile
+{
+public:
+
+    //! Constructor, maps the file into memory
+    /*!
+     *  Constructor, maps the file into memory. An exception is thrown if the file can not be opened.
+     *  \param fileName Name (including path) of the file that is to be mapped
+     */
+    MemoryMappedFile( const std::string& fileName );
+
+    //! Destructor, unmaps the file
+    ~MemoryMappedFile( );
+
+    //! Copy constructor (deleted, the mapping is owned by a single object)
+    MemoryMappedFile( const MemoryMappedFile& ) = delete;
+
+    //! Assignment operator (deleted, the mapping is owned by a single object)
+    MemoryMappedFile& operator=( const MemoryMappedFile& ) = delete;
+
+    //! Function to retrieve the pointer to the start of the file contents
+    const char* getData( ) const
+    {
+        return data_;
+    }
+
+    //! Function to retrieve the size of the file (in bytes)
+    std::size_t getSize( ) const
+    {
+        return size_;
+    }
+
+    //! Function to retrieve the name of the file that is mapped
+    std::string getFileName( ) const
+    {
+        return fileName_;
+    }
+
+private:
+
+    //! Name of the file that is mapped
+    std::string fileName_;
+
+    //! Pointer to the start of the file contents
+    const char* data_;
+
+    //! Size of the file (in bytes)
+    std::size_t size_;
+
+    //! Boolean denoting whether data_ points to a memory mapping (true) or to readBuffer_ (false)
+    bool isMapped_;
+
+    //! Buffer containing the file contents, if the file is not mapped into memory
+    std::vector< double > readBuffer_;
+};
+
+} // namespace input_output
+
+} // namespace tudat
+
+#endif // TUDAT_MEMORY_MAPPED_FILE_H
@@ -15,6 +15,8 @@
 
 #include <Eigen/Core>
 
+#include "tudat/io/binaryMultiArrayFile.h"
+
 namespace tudat
 {
 
@@ -96,7 +98,8 @@ int getNumberOfIndependentVariablesInCoefficientFile( const std::string& fileNam
  *  Interface class for reading coefficients as a function of N independent variables from a file. This class is used instead
  *  of a single templated free function to  allow multi-arrays of different sizes to be created using the same interface.
  *  NOTE: The possibility of using a single  templated implementation for arbitrary multi-array size should be investigated
- *  in the future.
+ *  in the future. Coefficients can be read from a text file (see readCoefficientsFile), or from a binary file written by
+ *  writeBinaryMultiArrayFile (detected automatically from the file contents), which is loaded without parsing.
  */
 template< unsigned int NumberOfDimensions >
 class MultiArrayFileReader
@@ -157,6 +160,12 @@ public:
     readMultiArrayAndIndependentVariables(
             const std::string fileName )
     {
+        // Read binary file directly, if provided
+        if( isBinaryMultiArrayFile( fileName ) )
+        {
+            return readMultiArrayAndIndependentVariablesFromBinaryFile< 1 >( fileName );
+        }
+
         std::vector< std::vector< double > > independentVariables;
         Eigen::MatrixXd coefficientBlock;
         
@@ -211,6 +220,12 @@ public:
     readMultiArrayAndIndependentVariables(
             const std::string fileName )
     {
+        // Read binary file directly, if provided
+        if( isBinaryMultiArrayFile( fileName ) )
+        {
+            return readMultiArrayAndIndependentVariablesFromBinaryFile< 2 >( fileName );
+        }
+
         std::vector< std::vector< double > > independentVariables;
         Eigen::MatrixXd coefficientBlock;
         
@@ -266,6 +281,12 @@ public:
     readMultiArrayAndIndependentVariables(
             const std::string fileName )
     {
+        // Read binary file directly, if provided
+        if( isBinaryMultiArrayFile( fileName ) )
+        {
+            return readMultiArrayAndIndependentVariablesFromBinaryFile< 3 >( fileName );
+        }
+
         std::vector< std::vector< double > > independentVariables;
         Eigen::MatrixXd coefficientBlock;
         
@@ -324,6 +345,12 @@ public:
     readMultiArrayAndIndependentVariables(
             const std::string fileName )
     {
+        // Read binary file directly, if provided
+        if( isBinaryMultiArrayFile( fileName ) )
+        {
+            return readMultiArrayAndIndependentVariablesFromBinaryFile< 4 >( fileName );
+        }
+
         std::vector< std::vector< double > > independentVariables;
         Eigen::MatrixXd coefficientBlock;
 
@@ -19,6 +19,7 @@
 #include <Eigen/Core>
 
 #include "tudat/basics/basicTypedefs.h"
+#include "tudat/io/binaryMultiArrayFile.h"
 
 namespace tudat
 {
@@ -391,6 +392,60 @@ public:
 
 };
 
+//! Function to write multi-dimensional array data and independent variables to binary files.
+/*!
+ *  Function to write multi-dimensional array data and independent variables to binary files, one file per coefficient,
+ *  in the format written by writeBinaryMultiArrayFile. These files can be read by the MultiArrayFileReader (and hence
+ *  by the aerodynamic coefficient and tabulated atmosphere readers) in the same way as the text files written by the
+ *  MultiArrayFileWriter, but without loss of precision and without parsing.
+ *  \tparam NumberOfIndependentVariables Number of independent variables.
+ *  \tparam NumberOfCoefficients Number of coefficients.
+ *  \param fileNamesMap Map of files where coefficients need to be saved. Each coefficient is saved in a separate file, thus
+ *      number of files has to match number of coefficients.
+ *  \param independentVariables Vector of independent variable vectors.
+ *  \param dependentVariables Multi-array of dependent variables for each independent variable.
+ */
+template< unsigned int NumberOfIndependentVariables, unsigned int NumberOfCoefficients >
+void writeMultiArrayAndIndependentVariablesToBinaryFiles(
+        const std::map< int, std::string >& fileNamesMap,
+        const std::vector< std::vector< double > >& independentVariables,
+        const boost::multi_array< Eigen::Matrix< double, NumberOfCoefficients, 1 >, NumberOfIndependentVariables >&
+        dependentVariables )
+{
+    // Check consistency of inputs
+    if ( fileNamesMap.size( ) > NumberOfCoefficients )
+    {
+        throw std::runtime_error( "Error while saving multi-dimensional aerodynamic coefficients to binary file. "
+                                  "Number of coefficients does not match number of input files." );
+    }
+
+    // Set dependent variables in storage order of binary file (last index varying fastest)
+    std::vector< std::size_t > shape( dependentVariables.shape( ),
+                                      dependentVariables.shape( ) + NumberOfIndependentVariables );
+    boost::multi_array< Eigen::Matrix< double, NumberOfCoefficients, 1 >, NumberOfIndependentVariables >
+            orderedDependentVariables( shape );
+    orderedDependentVariables = dependentVariables;
+
+    boost::multi_array< double, NumberOfIndependentVariables > coefficientMultiArray( shape );
+    for ( std::map< int, std::string >::const_iterator fileIterator = fileNamesMap.begin( );
+          fileIterator != fileNamesMap.end( ); fileIterator++ )
+    {
+        // Create directory (if it does not exist)
+        if ( !boost::filesystem::path( fileIterator->second ).parent_path( ).empty( ) &&
+             !boost::filesystem::exists( boost::filesystem::path( fileIterator->second ).parent_path( ) ) )
+        {
+            boost::filesystem::create_directories( boost::filesystem::path( fileIterator->second ).parent_path( ) );
+        }
+
+        // Extract current coefficient, and write to file
+        for ( std::size_t i = 0; i < orderedDependentVariables.num_elements( ); i++ )
+        {
+            coefficientMultiArray.data( )[ i ] = orderedDependentVariables.data( )[ i ]( fileIterator->first );
+        }
+        writeMultiArrayToBinaryFile( fileIterator->second, independentVariables, coefficientMultiArray );
+    }
+}
+
 } // namespace input_output
 
 } // namespace tudat
@@ -20,15 +20,37 @@
 
 #include <Eigen/Core>
 
+#include "tudat/io/binaryDataFile.h"
+
 namespace tudat
 {
 
 namespace input_output
 {
 
+//! Function to check whether a binary data file contains the expected number of values per epoch (throws exception if not)
+/*!
+ *  Function to check whether a binary data file contains the expected number of values per epoch (throws exception if not)
+ *  \param binaryFile Binary data file that is to be checked
+ *  \param expectedNumberOfColumns Expected number of values per epoch
+ *  \param fileName Name of the file (for error message)
+ */
+inline void checkBinaryHistoryFileSize(
+        const BinaryDataFile& binaryFile, const int expectedNumberOfColumns, const std::string& fileName )
+{
+    if( static_cast< int >( binaryFile.getNumberOfColumns( ) ) != expectedNumberOfColumns )
+    {
+        throw std::runtime_error( "Error when reading history from binary file " + fileName + ", found " +
+                                  std::to_string( binaryFile.getNumberOfColumns( ) ) + " values per epoch, expected " +
+                                  std::to_string( expectedNumberOfColumns ) );
+    }
+}
+
 //! Function to read a time history of Eigen MatrixXd data from a file
 /*!
- *  Function to read a time history of Eigen MatrixXd data from a file, as a map with time (key) and associated MatrixXd (value)
+ *  Function to read a time history of Eigen MatrixXd data from a file, as a map with time (key) and associated MatrixXd (value).
+ *  The file may be a text file, or a binary file written by writeBinaryDataFile (with the matrix entries of each epoch
+ *  stored row by row), which is detected automatically from its contents.
  *  \param singleMatrixRows Number of rows per matrix
  *  \param singleMatrixColumns Number of columns per matrix
  *  \param fileName File name to load
@@ -40,6 +62,29 @@ std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynam
 {
     std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > > matrixHistory;
 
+    // Read binary file directly, if provided
+    if( isBinaryDataFile( fileName ) )
+    {
+        BinaryDataFile binaryFile( fileName );
+        checkBinaryHistoryFileSize( binaryFile, singleMatrixRows * singleMatrixColumns, fileName );
+
+        Eigen::Map< const Eigen::VectorXd > times = binaryFile.getKeys( );
+        Eigen::Map< const Eigen::MatrixXd > values = binaryFile.getValues( );
+        Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > currentMatrix( singleMatrixRows, singleMatrixColumns );
+        for( int k = 0; k < times.rows( ); k++ )
+        {
+            for( int i = 0; i < singleMatrixRows; i++ )
+            {
+                for( int j = 0; j < singleMatrixColumns; j++ )
+                {
+                    currentMatrix( i, j ) = static_cast< StateScalarType >( values( k, i * singleMatrixColumns + j ) );
+                }
+            }
+            matrixHistory[ static_cast< TimeType >( times( k ) ) ] = currentMatrix;
+        }
+        return matrixHistory;
+    }
+
     std::ifstream fileStream;
     fileStream.open( fileName );
     if ( !fileStream.is_open( ) )
@@ -74,7 +119,9 @@ std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynam
 
 //! Function to read a time history of Eigen VectorXd data from a file
 /*!
- *  Function to read a time history of Eigen VectorXd data from a file, as a map with time (key) and associated VectorXd (value)
+ *  Function to read a time history of Eigen VectorXd data from a file, as a map with time (key) and associated VectorXd (value).
+ *  The file may be a text file, or a binary file written by writeBinaryDataFile or writeDataMapToBinaryFile, which is
+ *  detected automatically from its contents.
  *  \param singleMatrixRows Number of rows per vector
  *  \param fileName File name to load
  *  \return Vector history from file.
@@ -85,6 +132,22 @@ std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > readVe
 {
     std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > matrixHistory;
 
+    // Read binary file directly, if provided
+    if( isBinaryDataFile( fileName ) )
+    {
+        BinaryDataFile binaryFile( fileName );
+        checkBinaryHistoryFileSize( binaryFile, singleMatrixRows, fileName );
+
+        Eigen::Map< const Eigen::VectorXd > times = binaryFile.getKeys( );
+        Eigen::Map< const Eigen::MatrixXd > values = binaryFile.getValues( );
+        for( int k = 0; k < times.rows( ); k++ )
+        {
+            matrixHistory[ static_cast< TimeType >( times( k ) ) ] =
+                    values.row( k ).transpose( ).template cast< StateScalarType >( );
+        }
+        return matrixHistory;
+    }
+
     std::ifstream fileStream;
     fileStream.open( fileName );
     if ( !fileStream.is_open( ) )
@@ -116,7 +179,9 @@ std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > readVe
 
 //! Function to read a time history of scalar data from a file
 /*!
- *  Function to read a time history of scalar data from a file, as a map with time (key) and associated scalar (value)
+ *  Function to read a time history of scalar data from a file, as a map with time (key) and associated scalar (value).
+ *  The file may be a text file, or a binary file written by writeBinaryDataFile or writeDataMapToBinaryFile, which is
+ *  detected automatically from its contents.
  *  \param fileName File name to load
  *  \return Scalar history from file.
  */
@@ -124,6 +189,22 @@ template< typename S, typename T >
 std::map< S, T > readScalarHistoryFromFile( const std::string& fileName )
 {
     std::map< S, T > dataMap;
+
+    // Read binary file directly, if provided
+    if( isBinaryDataFile( fileName ) )
+    {
+        BinaryDataFile binaryFile( fileName );
+        checkBinaryHistoryFileSize( binaryFile, 1, fileName );
+
+        Eigen::Map< const Eigen::VectorXd > keys = binaryFile.getKeys( );
+        Eigen::Map< const Eigen::MatrixXd > values = binaryFile.getValues( );
+        for( int k = 0; k < keys.rows( ); k++ )
+        {
+            dataMap[ static_cast< S >( keys( k ) ) ] = static_cast< T >( values( k, 0 ) );
+        }
+        return dataMap;
+    }
+
     std::ifstream fileStream;
     fileStream.open( fileName );
     S key;
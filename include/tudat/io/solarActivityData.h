@@ -19,8 +19,11 @@
 #ifndef TUDAT_SOLAR_ACTIVITY_DATA_H
 #define TUDAT_SOLAR_ACTIVITY_DATA_H
 
+#include <cmath>
 #include <string>
 #include <map>
+#include <stdexcept>
+#include <vector>
 
 #include <Eigen/Core>
 
@@ -28,8 +31,6 @@
 
 #include "tudat/astro/basic_astro/timeConversions.h"
 #include "tudat/basics/utilities.h"
-#include "tudat/math/interpolators/lookupScheme.h"
-#include "tudat/astro/basic_astro/timeConversions.h"
 
 namespace tudat
 {
@@ -170,36 +171,115 @@ typedef std::shared_ptr< SolarActivityData > SolarActivityDataPtr;
 //! Data map of SolarActivityData structure Pointers
 typedef std::map< double , SolarActivityDataPtr >  SolarActivityDataMap ;
 
+//! Class providing fast lookup of solar activity data per day
+/*!
+ * Class providing fast lookup of solar activity data per day. In addition to the map of solar activity data (with
+ * Julian day at the start of each day as key), the data is stored in a contiguous array with one entry per day, so
+ * that the data at a given epoch is retrieved in O(1) time. Days that are not in the data map (if any) are assigned the
+ * data of the most recent day that is. Objects of this class are not modified after construction, and may be shared by
+ * any number of atmosphere models (see loadSolarActivityData).
+ */
 struct SolarActivityContainer
 {
+    //! Constructor
+    /*!
+     * Constructor
+     * \param solarActivityDataMap Map of solar activity data, with Julian day at the start of each day as key
+     */
     SolarActivityContainer(
             const std::map< double, SolarActivityDataPtr >& solarActivityDataMap ):
         solarActivityDataMap_( solarActivityDataMap )
     {
-
-        lookUpScheme_ = std::make_shared< interpolators::BinarySearchLookupScheme< double > >(
-                    utilities::createVectorFromMapKeys( solarActivityDataMap ) );
+        if( solarActivityDataMap_.size( ) == 0 )
+        {
+            throw std::runtime_error( "Error when creating solar activity container, no data provided" );
+        }
+
+        // Create day-indexed list of data
+        firstJulianDay_ = solarActivityDataMap_.begin( )->first;
+        int numberOfDays = static_cast< int >( std::round( solarActivityDataMap_.rbegin( )->first - firstJulianDay_ ) ) + 1;
+        dailySolarActivityData_.resize( numberOfDays );
+        for( auto it = solarActivityDataMap_.begin( ); it != solarActivityDataMap_.end( ); it++ )
+        {
+            auto nextIterator = std::next( it );
+            int currentDayIndex = static_cast< int >( std::round( it->first - firstJulianDay_ ) );
+            int nextDayIndex = ( nextIterator == solarActivityDataMap_.end( ) ) ?
+                        numberOfDays : static_cast< int >( std::round( nextIterator->first - firstJulianDay_ ) );
+            for( int i = currentDayIndex; i < nextDayIndex; i++ )
+            {
+                dailySolarActivityData_[ i ] = it->second;
+            }
+        }
     }
 
-    std::shared_ptr< SolarActivityData > getSolarActivityData( const double time )
+    //! Function to retrieve the solar activity data at a given epoch
+    /*!
+     * Function to retrieve the solar activity data of the day that contains a given epoch. For epochs before the first
+     * (after the last) day, the data of the first (last) day is returned.
+     * \param time Epoch at which the data is to be retrieved (seconds since J2000)
+     * \return Solar activity data of the day that contains the epoch
+     */
+    std::shared_ptr< SolarActivityData > getSolarActivityData( const double time ) const
     {
         double julianDay = basic_astrodynamics::convertSecondsSinceEpochToJulianDay( time );
         return getSolarActivityDataAtJulianDay( julianDay );
     }
 
-    std::shared_ptr< SolarActivityData > getSolarActivityDataAtJulianDay( const double julianDay )
+    //! Function to retrieve the solar activity data at a given Julian day
+    /*!
+     * Function to retrieve the solar activity data of the day that contains a given Julian day. For Julian days before
+     * the first (after the last) day, the data of the first (last) day is returned.
+     * \param julianDay Julian day at which the data is to be retrieved
+     * \return Solar activity data of the day that contains the Julian day
+     */
+    std::shared_ptr< SolarActivityData > getSolarActivityDataAtJulianDay( const double julianDay ) const
+    {
+        return dailySolarActivityData_[ getDayIndex( julianDay ) ];
+    }
+
+    //! Function to retrieve the index of the day that contains a given Julian day (limited to the range of the data)
+    int getDayIndex( const double julianDay ) const
+    {
+        double daysSinceStart = std::floor( julianDay - firstJulianDay_ );
+        if( !( daysSinceStart > 0.0 ) )
+        {
+            return 0;
+        }
+        else if( daysSinceStart >= static_cast< double >( dailySolarActivityData_.size( ) ) )
+        {
+            return static_cast< int >( dailySolarActivityData_.size( ) ) - 1;
+        }
+        return static_cast< int >( daysSinceStart );
+    }
+
+    //! Function to retrieve the Julian day at the start of the first day of data
+    double getFirstJulianDay( ) const
     {
-        int nearestJulianDay = lookUpScheme_->getIndependentVariableValue(
-                    lookUpScheme_->findNearestLowerNeighbour( julianDay ) );
-        return solarActivityDataMap_.at( nearestJulianDay );
+        return firstJulianDay_;
     }
 
+    //! Function to retrieve the Julian day at the start of the last day of data
+    double getLastJulianDay( ) const
+    {
+        return firstJulianDay_ + static_cast< double >( dailySolarActivityData_.size( ) - 1 );
+    }
+
+    //! Function to retrieve the map of solar activity data
+    const std::map< double, SolarActivityDataPtr >& getSolarActivityDataMap( ) const
+    {
+        return solarActivityDataMap_;
+    }
 
 private:
 
+     //! Map of solar activity data, with Julian day at the start of each day as key
      std::map< double, SolarActivityDataPtr > solarActivityDataMap_;
 
-     std::shared_ptr< interpolators::LookUpScheme< double > > lookUpScheme_;
+     //! Julian day at the start of the first day of data
+     double firstJulianDay_;
+
+     //! Solar activity data for each day, starting at firstJulianDay_
+     std::vector< SolarActivityDataPtr > dailySolarActivityData_;
 
 };
 
@@ -212,6 +292,25 @@ private:
  */
 SolarActivityDataMap readSolarActivityData( std::string filePath ) ;
 
+//! Function to load a SpaceWeather data file, sharing a single copy of the data of each file within the process
+/*!
+ * Function to load a SpaceWeather data file, sharing a single copy of the data of each file within the process. The
+ * file is parsed on the first call for a given file, and the result is retained for the lifetime of the process (or
+ * until clearSolarActivityDataCache is called), so that subsequent calls (for instance when creating many atmosphere
+ * models in a Monte Carlo analysis) do not read the file again. The file is parsed again if its size or modification
+ * time has changed. This function may be called from multiple threads concurrently.
+ * \param filePath Path of the SpaceWeather data file
+ * \return Container of the solar activity data in the file
+ */
+std::shared_ptr< SolarActivityContainer > loadSolarActivityData( const std::string& filePath );
+
+//! Function to clear the cache of solar activity data used by loadSolarActivityData
+/*!
+ * Function to clear the cache of solar activity data used by loadSolarActivityData. Existing users of the data are not
+ * affected.
+ */
+void clearSolarActivityDataCache( );
+
 } // namespace solar_activity
 } // namespace input_output
 } // namespace tudat
@@ -112,6 +112,25 @@ Eigen::Matrix< ScalarType, 3, 1 > convertCartesianToSpherical( const Eigen::Matr
     return convertedSphericalCoordinates_;
 }
 
+//! Convert a batch of spherical (radius, zenith, azimuth) to Cartesian (x,y,z) coordinates.
+/*!
+ * Converts a batch of spherical to Cartesian coordinates (see convertSphericalToCartesian). The computations are performed
+ * on all points at once, as Eigen array operations (allowing the compiler to vectorize them).
+ * \param sphericalCoordinates Spherical coordinates, radius, zenith and azimuth (in that order), one point per column.
+ * \return Cartesian coordinates, one point per column.
+ */
+Eigen::Matrix3Xd convertSphericalToCartesianBatch( const Eigen::Matrix3Xd& sphericalCoordinates );
+
+//! Convert a batch of Cartesian (x,y,z) to spherical (radius, zenith, azimuth) coordinates.
+/*!
+ * Converts a batch of Cartesian to spherical coordinates (see convertCartesianToSpherical). The computations are performed
+ * on all points at once, as Eigen array operations (allowing the compiler to vectorize them). As for the single-point
+ * conversion, the zenith and azimuth of points at the origin are set to zero.
+ * \param cartesianCoordinates Cartesian coordinates, one point per column.
+ * \return Spherical coordinates, radius, zenith and azimuth (in that order), one point per column.
+ */
+Eigen::Matrix3Xd convertCartesianToSphericalBatch( const Eigen::Matrix3Xd& cartesianCoordinates );
+
 //! Spherical coordinate indices.
 /*!
   * Spherical coordinate indices, for position and velocity components. With r the radius, theta
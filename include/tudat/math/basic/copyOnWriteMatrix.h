@@ -0,0 +1,158 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_COPY_ON_WRITE_MATRIX_H
+#define TUDAT_COPY_ON_WRITE_MATRIX_H
+
+#include <memory>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace basic_mathematics
+{
+
+//! Matrix with reference-counted storage, which is shared by all copies of the object until it is modified.
+/*!
+ *  Matrix with reference-counted storage, which is shared by all copies of the object until it is modified. Copying an
+ *  object of this type only copies a pointer to the storage. The storage is duplicated only when non-const access is
+ *  requested (see getMutableMatrix) while it is shared with another object, so that modifying one copy never affects
+ *  the others. Used to prevent large coefficient matrices (e.g. those of high-degree spherical harmonic gravity fields)
+ *  from being duplicated in settings, environment models and estimation parameters that use the same values.
+ *  Note that copying and modifying objects that share storage is not synchronized: an object must not be modified
+ *  while it is being copied in another thread.
+ */
+class CopyOnWriteMatrix
+{
+public:
+
+    //! Constructor, creates storage with an empty matrix.
+    CopyOnWriteMatrix( ):
+        storage_( std::make_shared< Eigen::MatrixXd >( ) ){ }
+
+    //! Constructor from matrix, which is copied to new storage.
+    /*!
+     *  Constructor from matrix, which is copied to new storage.
+     *  \param matrix Matrix that is to be stored.
+     */
+    CopyOnWriteMatrix( const Eigen::MatrixXd& matrix ):
+        storage_( std::make_shared< Eigen::MatrixXd >( matrix ) ){ }
+
+    //! Constructor from matrix, which is moved to new storage.
+    /*!
+     *  Constructor from matrix, which is moved to new storage.
+     *  \param matrix Matrix that is to be stored.
+     */
+    CopyOnWriteMatrix( Eigen::MatrixXd&& matrix ):
+        storage_( std::make_shared< Eigen::MatrixXd >( std::move( matrix ) ) ){ }
+
+    //! Function to retrieve the (read-only) matrix.
+    /*!
+     *  Function to retrieve the (read-only) matrix. The reference is invalidated when this object is modified or
+     *  assigned to.
+     *  \return Stored matrix.
+     */
+    const Eigen::MatrixXd& getMatrix( ) const
+    {
+        return *storage_;
+    }
+
+    //! Function to retrieve the matrix for modification, duplicating the storage first if it is shared.
+    /*!
+     *  Function to retrieve the matrix for modification. If the storage is shared with another object, it is
+     *  duplicated first, so that the modification is not visible to the other object.
+     *  \return Stored matrix, owned only by this object.
+     */
+    Eigen::MatrixXd& getMutableMatrix( )
+    {
+        if( storage_.use_count( ) > 1 )
+        {
+            storage_ = std::make_shared< Eigen::MatrixXd >( *storage_ );
+        }
+        return *storage_;
+    }
+
+    //! Function to reset the matrix.
+    /*!
+     *  Function to reset the matrix. The new values are written to the existing storage if it is owned only by this
+     *  object, and to new storage otherwise (leaving the values seen by other objects unchanged).
+     *  \param matrix New matrix that is to be stored.
+     */
+    void setMatrix( const Eigen::MatrixXd& matrix )
+    {
+        if( storage_.use_count( ) > 1 )
+        {
+            storage_ = std::make_shared< Eigen::MatrixXd >( matrix );
+        }
+        else
+        {
+            *storage_ = matrix;
+        }
+    }
+
+    //! Function to check whether the storage is shared with another object.
+    /*!
+     *  Function to check whether the storage is shared with another object.
+     *  \return True if the storage is shared with another object.
+     */
+    bool isStorageShared( ) const
+    {
+        return storage_.use_count( ) > 1;
+    }
+
+    //! Function to check whether this object shares its storage with another object.
+    /*!
+     *  Function to check whether this object shares its storage with another object.
+     *  \param otherMatrix Object with which the storage is to be compared.
+     *  \return True if both objects use the same storage.
+     */
+    bool sharesStorageWith( const CopyOnWriteMatrix& otherMatrix ) const
+    {
+        return storage_ == otherMatrix.storage_;
+    }
+
+    //! Function to retrieve the number of rows of the matrix.
+    Eigen::Index rows( ) const
+    {
+        return storage_->rows( );
+    }
+
+    //! Function to retrieve the number of columns of the matrix.
+    Eigen::Index cols( ) const
+    {
+        return storage_->cols( );
+    }
+
+    //! Function to retrieve a single (read-only) entry of the matrix.
+    double operator( )( const Eigen::Index row, const Eigen::Index column ) const
+    {
+        return ( *storage_ )( row, column );
+    }
+
+    //! Function to retrieve a (read-only) block of the matrix.
+    Eigen::Block< const Eigen::MatrixXd > block( const Eigen::Index startRow, const Eigen::Index startColumn,
+                                                const Eigen::Index numberOfRows, const Eigen::Index numberOfColumns ) const
+    {
+        return getMatrix( ).block( startRow, startColumn, numberOfRows, numberOfColumns );
+    }
+
+private:
+
+    //! Storage of the matrix, shared between copies of this object until modified.
+    std::shared_ptr< Eigen::MatrixXd > storage_;
+};
+
+} // namespace basic_mathematics
+
+} // namespace tudat
+
+#endif // TUDAT_COPY_ON_WRITE_MATRIX_H
@@ -0,0 +1,100 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_FORWARD_MODE_DIFFERENTIATION_H
+#define TUDAT_FORWARD_MODE_DIFFERENTIATION_H
+
+#include <Eigen/Core>
+#include <unsupported/Eigen/AutoDiff>
+
+namespace tudat
+{
+
+namespace automatic_differentiation
+{
+
+//! Dual number type, holding a value and its derivatives w.r.t. a fixed number of independent variables
+/*!
+ *  Dual number type (forward-mode automatic differentiation), holding a value and its derivatives w.r.t. a fixed number
+ *  of independent variables. Evaluating a function templated on its scalar type with arguments of this type provides the
+ *  function value and its exact derivatives w.r.t. all independent variables in a single pass.
+ */
+template< int NumberOfIndependentVariables >
+using DualScalar = Eigen::AutoDiffScalar< Eigen::Matrix< double, NumberOfIndependentVariables, 1 > >;
+
+//! Dual number type with derivatives w.r.t. a Cartesian state
+typedef DualScalar< 6 > StateDualScalar;
+
+//! Cartesian state of dual numbers
+typedef Eigen::Matrix< StateDualScalar, 6, 1 > StateDualVector;
+
+//! Three-dimensional vector of dual numbers with derivatives w.r.t. a Cartesian state (e.g. an acceleration)
+typedef Eigen::Matrix< StateDualScalar, 3, 1 > Vector3StateDual;
+
+//! Function to create a vector of dual numbers, with each entry an independent variable
+/*!
+ *  Function to create a vector of dual numbers, with each entry an independent variable (i.e. the derivative of entry i
+ *  is the i-th unit vector).
+ *  \param value Values of the independent variables
+ *  \return Vector of dual numbers, seeded for the computation of derivatives w.r.t. its entries
+ */
+template< int NumberOfIndependentVariables >
+Eigen::Matrix< DualScalar< NumberOfIndependentVariables >, NumberOfIndependentVariables, 1 > getSeededDualVector(
+        const Eigen::Matrix< double, NumberOfIndependentVariables, 1 >& value )
+{
+    Eigen::Matrix< DualScalar< NumberOfIndependentVariables >, NumberOfIndependentVariables, 1 > dualVector;
+    for( int i = 0; i < NumberOfIndependentVariables; i++ )
+    {
+        dualVector( i ) = DualScalar< NumberOfIndependentVariables >( value( i ), NumberOfIndependentVariables, i );
+    }
+    return dualVector;
+}
+
+//! Function to retrieve the values of a vector of dual numbers
+template< int NumberOfRows, int NumberOfIndependentVariables >
+Eigen::Matrix< double, NumberOfRows, 1 > getDualVectorValue(
+        const Eigen::Matrix< DualScalar< NumberOfIndependentVariables >, NumberOfRows, 1 >& dualVector )
+{
+    Eigen::Matrix< double, NumberOfRows, 1 > value;
+    for( int i = 0; i < NumberOfRows; i++ )
+    {
+        value( i ) = dualVector( i ).value( );
+    }
+    return value;
+}
+
+//! Function to retrieve the derivatives of a vector of dual numbers w.r.t. the independent variables
+/*!
+ *  Function to retrieve the derivatives of a vector of dual numbers w.r.t. the independent variables. Entries that do not
+ *  depend on the independent variables (for which no derivatives are stored) have zero derivatives.
+ *  \param dualVector Vector of dual numbers
+ *  \return Jacobian of the vector w.r.t. the independent variables
+ */
+template< int NumberOfRows, int NumberOfIndependentVariables >
+Eigen::Matrix< double, NumberOfRows, NumberOfIndependentVariables > getDualVectorJacobian(
+        const Eigen::Matrix< DualScalar< NumberOfIndependentVariables >, NumberOfRows, 1 >& dualVector )
+{
+    Eigen::Matrix< double, NumberOfRows, NumberOfIndependentVariables > jacobian =
+            Eigen::Matrix< double, NumberOfRows, NumberOfIndependentVariables >::Zero( );
+    for( int i = 0; i < NumberOfRows; i++ )
+    {
+        if( dualVector( i ).derivatives( ).size( ) == NumberOfIndependentVariables )
+        {
+            jacobian.row( i ) = dualVector( i ).derivatives( ).transpose( );
+        }
+    }
+    return jacobian;
+}
+
+} // namespace automatic_differentiation
+
+} // namespace tudat
+
+#endif // TUDAT_FORWARD_MODE_DIFFERENTIATION_H
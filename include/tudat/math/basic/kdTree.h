@@ -0,0 +1,453 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Friedman J.H., Bentley J.L., Finkel R.A. An Algorithm for Finding Best Matches in Logarithmic Expected Time.
+ *          ACM Transactions on Mathematical Software, 3(3), 1977.
+ *
+ */
+
+#ifndef TUDAT_KD_TREE_H
+#define TUDAT_KD_TREE_H
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/basics/parallelization.h"
+
+namespace tudat
+{
+namespace basic_mathematics
+{
+
+//! Class for nearest neighbour and radius queries on a fixed set of points, using a k-d tree.
+/*!
+ *  Class for nearest neighbour and radius queries on a fixed set of points, using a k-d tree (Friedman et al., 1977).
+ *  The tree is constructed once, in O(n log n) time, by recursively splitting the points at the median of the
+ *  coordinate with the largest spread. The points are stored contiguously, in tree order, so that the points in a leaf
+ *  are adjacent in memory. Queries are const (and may be performed concurrently), and return the indices of the points
+ *  in the matrix provided to the constructor. Points at equal distance to a query point are ordered by ascending index,
+ *  so that the results are identical to those of an exhaustive search over the points, in their original order.
+ *  \tparam NumberOfDimensions Dimension of the points (Eigen::Dynamic to set the dimension at run time).
+ */
+template< int NumberOfDimensions = 3 >
+class KdTree
+{
+public:
+
+    //! Typedef for a single point (and query point)
+    typedef Eigen::Matrix< double, NumberOfDimensions, 1 > PointType;
+
+    //! Typedef for a query result: index of point in input matrix, and distance to query point
+    typedef std::pair< int, double > NeighbourType;
+
+    //! Constructor
+    /*!
+     *  Constructor, builds the tree from a set of points.
+     *  \param points Matrix with one point per row (e.g. the vertices of a polyhedron, one vertex per row).
+     *  \param maximumLeafSize Maximum number of points in a leaf of the tree, below which the points are no longer split.
+     */
+    KdTree( const Eigen::MatrixXd& points, const int maximumLeafSize = 8 ):
+        numberOfDimensions_( static_cast< int >( points.cols( ) ) ),
+        maximumLeafSize_( maximumLeafSize )
+    {
+        if( NumberOfDimensions != Eigen::Dynamic && points.cols( ) != NumberOfDimensions )
+        {
+            throw std::runtime_error( "Error when creating k-d tree: points have dimension " +
+                                      std::to_string( points.cols( ) ) + ", expected " +
+                                      std::to_string( NumberOfDimensions ) );
+        }
+        else if( numberOfDimensions_ < 1 )
+        {
+            throw std::runtime_error( "Error when creating k-d tree: points have no coordinates" );
+        }
+        else if( maximumLeafSize_ < 1 )
+        {
+            throw std::runtime_error( "Error when creating k-d tree: maximum leaf size must be positive" );
+        }
+
+        pointIndices_.resize( points.rows( ) );
+        std::iota( pointIndices_.begin( ), pointIndices_.end( ), 0 );
+
+        if( points.rows( ) > 0 )
+        {
+            nodes_.reserve( 2 * points.rows( ) / maximumLeafSize_ + 1 );
+            buildNode( points, 0, static_cast< int >( points.rows( ) ) );
+        }
+
+        // Store points contiguously, in the order of the leaves
+        sortedPoints_.resize( numberOfDimensions_, points.rows( ) );
+        treePositionOfPoints_.resize( points.rows( ) );
+        for( unsigned int i = 0; i < pointIndices_.size( ); i++ )
+        {
+            sortedPoints_.col( i ) = points.row( pointIndices_.at( i ) ).transpose( );
+            treePositionOfPoints_[ pointIndices_.at( i ) ] = static_cast< int >( i );
+        }
+    }
+
+    //! Function to find the nearest neighbour of a point
+    /*!
+     *  Function to find the nearest neighbour of a point
+     *  \param queryPoint Point for which the nearest neighbour is to be found.
+     *  \param distance Distance from query point to its nearest neighbour (returned by reference).
+     *  \return Index of nearest neighbour (-1 if the tree is empty).
+     */
+    int findNearestNeighbour( const PointType& queryPoint, double& distance ) const
+    {
+        std::vector< NeighbourType > neighbours = findNearestNeighbours( queryPoint, 1 );
+        if( neighbours.size( ) == 0 )
+        {
+            distance = std::numeric_limits< double >::infinity( );
+            return -1;
+        }
+        distance = neighbours.at( 0 ).second;
+        return neighbours.at( 0 ).first;
+    }
+
+    //! Function to find the nearest neighbour of a point, starting from an initial guess
+    /*!
+     *  Function to find the nearest neighbour of a point, starting from an initial guess (e.g. the nearest neighbour of a
+     *  previous, nearby, query point). The distance to the initial guess is used as the initial search radius, so that a
+     *  good guess limits the search to the part of the tree close to the query point. The result is identical to that
+     *  of the function without initial guess.
+     *  \param queryPoint Point for which the nearest neighbour is to be found.
+     *  \param distance Distance from query point to its nearest neighbour (returned by reference).
+     *  \param initialGuessIndex Index (in input matrix) of the point used as initial guess (ignored if out of range).
+     *  \return Index of nearest neighbour (-1 if the tree is empty).
+     */
+    int findNearestNeighbour( const PointType& queryPoint, double& distance, const int initialGuessIndex ) const
+    {
+        checkQueryPoint( queryPoint );
+        if( initialGuessIndex < 0 || initialGuessIndex >= getNumberOfPoints( ) )
+        {
+            return findNearestNeighbour( queryPoint, distance );
+        }
+
+        std::priority_queue< std::pair< double, int > > nearestNeighbours;
+        nearestNeighbours.push( std::make_pair(
+                                    ( sortedPoints_.col( treePositionOfPoints_[ initialGuessIndex ] ) - queryPoint ).squaredNorm( ),
+                                    initialGuessIndex ) );
+        searchNearestNeighbours( queryPoint, 0, 1, nearestNeighbours );
+
+        distance = std::sqrt( nearestNeighbours.top( ).first );
+        return nearestNeighbours.top( ).second;
+    }
+
+    //! Function to find the k nearest neighbours of a point
+    /*!
+     *  Function to find the k nearest neighbours of a point
+     *  \param queryPoint Point for which the nearest neighbours are to be found.
+     *  \param numberOfNeighbours Number of neighbours k that is to be found (fewer are returned if the tree contains
+     *  fewer points).
+     *  \return List of nearest neighbours (index and distance), sorted by ascending distance.
+     */
+    std::vector< NeighbourType > findNearestNeighbours( const PointType& queryPoint,
+                                                        const unsigned int numberOfNeighbours ) const
+    {
+        checkQueryPoint( queryPoint );
+
+        // Maximum heap of (squared distance, index) of current set of nearest neighbours
+        std::priority_queue< std::pair< double, int > > nearestNeighbours;
+        if( numberOfNeighbours > 0 && nodes_.size( ) > 0 )
+        {
+            searchNearestNeighbours( queryPoint, 0, numberOfNeighbours, nearestNeighbours );
+        }
+
+        std::vector< NeighbourType > neighbours( nearestNeighbours.size( ) );
+        for( int i = static_cast< int >( neighbours.size( ) ) - 1; i >= 0; i-- )
+        {
+            neighbours[ i ] = std::make_pair( nearestNeighbours.top( ).second,
+                                              std::sqrt( nearestNeighbours.top( ).first ) );
+            nearestNeighbours.pop( );
+        }
+        return neighbours;
+    }
+
+    //! Function to find all points within a given distance of a point
+    /*!
+     *  Function to find all points within a given distance of a point
+     *  \param queryPoint Point for which the neighbours are to be found.
+     *  \param radius Maximum distance (inclusive) between query point and neighbours.
+     *  \return List of neighbours (index and distance), sorted by ascending distance.
+     */
+    std::vector< NeighbourType > findNeighboursWithinRadius( const PointType& queryPoint, const double radius ) const
+    {
+        checkQueryPoint( queryPoint );
+
+        std::vector< std::pair< double, int > > neighboursInRadius;
+        if( radius >= 0.0 && nodes_.size( ) > 0 )
+        {
+            searchNeighboursWithinRadius( queryPoint, 0, radius * radius, neighboursInRadius );
+        }
+        std::sort( neighboursInRadius.begin( ), neighboursInRadius.end( ) );
+
+        std::vector< NeighbourType > neighbours( neighboursInRadius.size( ) );
+        for( unsigned int i = 0; i < neighbours.size( ); i++ )
+        {
+            neighbours[ i ] = std::make_pair( neighboursInRadius.at( i ).second,
+                                              std::sqrt( neighboursInRadius.at( i ).first ) );
+        }
+        return neighbours;
+    }
+
+    //! Function to find the k nearest neighbours of a set of points, distributed over a number of threads
+    /*!
+     *  Function to find the k nearest neighbours of a set of points, distributed over a number of threads
+     *  \param queryPoints Matrix with one query point per row.
+     *  \param numberOfNeighbours Number of neighbours k that is to be found for each query point.
+     *  \param numberOfThreads Number of threads over which the queries are distributed.
+     *  \return List of nearest neighbours for each query point (see single-point findNearestNeighbours).
+     */
+    std::vector< std::vector< NeighbourType > > findNearestNeighboursOfPoints( const Eigen::MatrixXd& queryPoints,
+                                                                               const unsigned int numberOfNeighbours,
+                                                                               const int numberOfThreads = 1 ) const
+    {
+        std::vector< std::vector< NeighbourType > > neighbours( queryPoints.rows( ) );
+        executeBatchQuery( queryPoints, numberOfThreads, [ & ]( const int i )
+        {
+            neighbours[ i ] = findNearestNeighbours( queryPoints.row( i ).transpose( ), numberOfNeighbours );
+        } );
+        return neighbours;
+    }
+
+    //! Function to find all points within a given distance of a set of points, distributed over a number of threads
+    /*!
+     *  Function to find all points within a given distance of a set of points, distributed over a number of threads
+     *  \param queryPoints Matrix with one query point per row.
+     *  \param radius Maximum distance (inclusive) between query points and neighbours.
+     *  \param numberOfThreads Number of threads over which the queries are distributed.
+     *  \return List of neighbours for each query point (see single-point findNeighboursWithinRadius).
+     */
+    std::vector< std::vector< NeighbourType > > findNeighboursWithinRadiusOfPoints( const Eigen::MatrixXd& queryPoints,
+                                                                                    const double radius,
+                                                                                    const int numberOfThreads = 1 ) const
+    {
+        std::vector< std::vector< NeighbourType > > neighbours( queryPoints.rows( ) );
+        executeBatchQuery( queryPoints, numberOfThreads, [ & ]( const int i )
+        {
+            neighbours[ i ] = findNeighboursWithinRadius( queryPoints.row( i ).transpose( ), radius );
+        } );
+        return neighbours;
+    }
+
+    //! Function to retrieve the number of points in the tree
+    int getNumberOfPoints( ) const
+    {
+        return static_cast< int >( pointIndices_.size( ) );
+    }
+
+    //! Function to retrieve the dimension of the points in the tree
+    int getNumberOfDimensions( ) const
+    {
+        return numberOfDimensions_;
+    }
+
+private:
+
+    //! Node of the tree
+    struct KdTreeNode
+    {
+        //! First position (in tree order) of points in node
+        int begin;
+
+        //! Position (in tree order) after last point in node
+        int end;
+
+        //! Coordinate along which node is split (-1 for leaf)
+        int splitDimension;
+
+        //! Coordinate value at which node is split
+        double splitValue;
+
+        //! Indices of child nodes, containing points below/at and above/at split value
+        int lowerChild;
+        int upperChild;
+    };
+
+    //! Function to recursively create the tree node for a range of points (in tree order), returns index of node
+    int buildNode( const Eigen::MatrixXd& points, const int begin, const int end )
+    {
+        int nodeIndex = static_cast< int >( nodes_.size( ) );
+        nodes_.push_back( { begin, end, -1, 0.0, -1, -1 } );
+
+        if( end - begin > maximumLeafSize_ )
+        {
+            // Split along coordinate with largest spread
+            Eigen::VectorXd minimumValues = points.row( pointIndices_.at( begin ) ).transpose( );
+            Eigen::VectorXd maximumValues = minimumValues;
+            for( int i = begin + 1; i < end; i++ )
+            {
+                minimumValues = minimumValues.cwiseMin( points.row( pointIndices_.at( i ) ).transpose( ) );
+                maximumValues = maximumValues.cwiseMax( points.row( pointIndices_.at( i ) ).transpose( ) );
+            }
+
+            int splitDimension;
+            if( ( maximumValues - minimumValues ).maxCoeff( &splitDimension ) > 0.0 )
+            {
+                // Partition points around median
+                int middle = begin + ( end - begin ) / 2;
+                std::nth_element( pointIndices_.begin( ) + begin, pointIndices_.begin( ) + middle,
+                                  pointIndices_.begin( ) + end, [ & ]( const int first, const int second )
+                {
+                    return points( first, splitDimension ) < points( second, splitDimension );
+                } );
+
+                nodes_[ nodeIndex ].splitDimension = splitDimension;
+                nodes_[ nodeIndex ].splitValue = points( pointIndices_.at( middle ), splitDimension );
+
+                int lowerChild = buildNode( points, begin, middle );
+                int upperChild = buildNode( points, middle, end );
+                nodes_[ nodeIndex ].lowerChild = lowerChild;
+                nodes_[ nodeIndex ].upperChild = upperChild;
+            }
+        }
+        return nodeIndex;
+    }
+
+    //! Function to recursively update the k nearest neighbours with the points in a node
+    void searchNearestNeighbours( const PointType& queryPoint, const int nodeIndex, const unsigned int numberOfNeighbours,
+                                  std::priority_queue< std::pair< double, int > >& nearestNeighbours ) const
+    {
+        const KdTreeNode& node = nodes_[ nodeIndex ];
+        if( node.splitDimension < 0 )
+        {
+            for( int i = node.begin; i < node.end; i++ )
+            {
+                std::pair< double, int > candidate(
+                            ( sortedPoints_.col( i ) - queryPoint ).squaredNorm( ), pointIndices_[ i ] );
+                if( nearestNeighbours.size( ) < numberOfNeighbours )
+                {
+                    nearestNeighbours.push( candidate );
+                }
+                else if( candidate < nearestNeighbours.top( ) )
+                {
+                    nearestNeighbours.pop( );
+                    nearestNeighbours.push( candidate );
+                }
+            }
+        }
+        else
+        {
+            // Search child containing query point first, and other child only if it may contain closer points
+            double distanceToSplit = queryPoint( node.splitDimension ) - node.splitValue;
+            int nearChild = ( distanceToSplit < 0.0 ) ? node.lowerChild : node.upperChild;
+            int farChild = ( distanceToSplit < 0.0 ) ? node.upperChild : node.lowerChild;
+
+            searchNearestNeighbours( queryPoint, nearChild, numberOfNeighbours, nearestNeighbours );
+            if( nearestNeighbours.size( ) < numberOfNeighbours ||
+                    distanceToSplit * distanceToSplit <= nearestNeighbours.top( ).first )
+            {
+                searchNearestNeighbours( queryPoint, farChild, numberOfNeighbours, nearestNeighbours );
+            }
+        }
+    }
+
+    //! Function to recursively add the points in a node that are within a given squared distance of the query point
+    void searchNeighboursWithinRadius( const PointType& queryPoint, const int nodeIndex, const double squaredRadius,
+                                       std::vector< std::pair< double, int > >& neighboursInRadius ) const
+    {
+        const KdTreeNode& node = nodes_[ nodeIndex ];
+        if( node.splitDimension < 0 )
+        {
+            for( int i = node.begin; i < node.end; i++ )
+            {
+                double squaredDistance = ( sortedPoints_.col( i ) - queryPoint ).squaredNorm( );
+                if( squaredDistance <= squaredRadius )
+                {
+                    neighboursInRadius.push_back( std::make_pair( squaredDistance, pointIndices_[ i ] ) );
+                }
+            }
+        }
+        else
+        {
+            double distanceToSplit = queryPoint( node.splitDimension ) - node.splitValue;
+            if( distanceToSplit <= 0.0 || distanceToSplit * distanceToSplit <= squaredRadius )
+            {
+                searchNeighboursWithinRadius( queryPoint, node.lowerChild, squaredRadius, neighboursInRadius );
+            }
+            if( distanceToSplit >= 0.0 || distanceToSplit * distanceToSplit <= squaredRadius )
+            {
+                searchNeighboursWithinRadius( queryPoint, node.upperChild, squaredRadius, neighboursInRadius );
+            }
+        }
+    }
+
+    //! Function to check the dimension of a query point
+    void checkQueryPoint( const PointType& queryPoint ) const
+    {
+        if( queryPoint.rows( ) != numberOfDimensions_ )
+        {
+            throw std::runtime_error( "Error in k-d tree query: query point has dimension " +
+                                      std::to_string( queryPoint.rows( ) ) + ", expected " +
+                                      std::to_string( numberOfDimensions_ ) );
+        }
+    }
+
+    //! Function to execute a query for each of a set of points, distributed over a number of threads
+    template< typename QueryFunction >
+    void executeBatchQuery( const Eigen::MatrixXd& queryPoints, const int numberOfThreads,
+                            const QueryFunction& queryFunction ) const
+    {
+        if( queryPoints.rows( ) > 0 && queryPoints.cols( ) != numberOfDimensions_ )
+        {
+            throw std::runtime_error( "Error in k-d tree query: query points have dimension " +
+                                      std::to_string( queryPoints.cols( ) ) + ", expected " +
+                                      std::to_string( numberOfDimensions_ ) );
+        }
+
+        // Distribute queries over tasks of (approximately) equal size
+        const int numberOfQueries = static_cast< int >( queryPoints.rows( ) );
+        const int numberOfTasks = std::max( 1, std::min( numberOfQueries, 4 * numberOfThreads ) );
+        utilities::executeParallelTasks( numberOfTasks, [ & ]( const int taskIndex )
+        {
+            for( int i = taskIndex * numberOfQueries / numberOfTasks;
+                 i < ( taskIndex + 1 ) * numberOfQueries / numberOfTasks; i++ )
+            {
+                queryFunction( i );
+            }
+        }, numberOfThreads );
+    }
+
+    //! Dimension of the points
+    int numberOfDimensions_;
+
+    //! Maximum number of points in a leaf of the tree
+    int maximumLeafSize_;
+
+    //! Nodes of the tree (root node at index 0)
+    std::vector< KdTreeNode > nodes_;
+
+    //! Indices (in input matrix) of the points, in tree order
+    std::vector< int > pointIndices_;
+
+    //! Points (one per column), in tree order
+    Eigen::Matrix< double, NumberOfDimensions, Eigen::Dynamic > sortedPoints_;
+
+    //! Position in tree order of each point (inverse of pointIndices_)
+    std::vector< int > treePositionOfPoints_;
+
+};
+
+extern template class KdTree< 3 >;
+extern template class KdTree< Eigen::Dynamic >;
+
+} // namespace basic_mathematics
+
+} // namespace tudat
+
+#endif // TUDAT_KD_TREE_H
@@ -16,25 +16,48 @@
 #define TUDAT_LEASTSQUARESESTIMATION_H
 
 #include <map>
+#include <memory>
+#include <vector>
 
 #include <Eigen/Core>
 #include <Eigen/SVD>
 
 #include <boost/function.hpp>
 
+#include "tudat/basics/processCommunicator.h"
+
 namespace tudat
 {
 
 namespace linear_algebra
 {
 
+//! Types of linear solver that can be used to solve the equations of a least squares problem
+/*!
+ *  Types of linear solver that can be used to solve the equations of a least squares problem. The SVD-based solvers are
+ *  the most robust (also for near-singular problems), but the most expensive. The Cholesky (LLT) and LDLT solvers
+ *  decompose the (symmetric) normal matrix, and are much faster for large numbers of parameters (LLT requires a
+ *  positive definite matrix, and can therefore not be used with constraints). The column-pivoting QR solver
+ *  decomposes the weighted design matrix directly when it is available (so that the condition number of the problem is
+ *  not squared by forming the normal matrix), and the normal matrix otherwise. When Eigen is configured to use LAPACK
+ *  (EIGEN_USE_LAPACKE), the SVD and QR decompositions are evaluated by LAPACK.
+ */
+enum LinearSolverType
+{
+    jacobi_svd_solver,
+    bdc_svd_solver,
+    llt_solver,
+    ldlt_solver,
+    column_pivoting_qr_solver
+};
+
 //! Function to get condition number of matrix (using SVD decomposition)
 /*!
  *  Function to get condition number of matrix (using SVD decomposition)
  * \param designMatrix Matrix for which condition number is to be computed
  * \return Condition number of matrix
  */
-double getConditionNumberOfDesignMatrix( const Eigen::MatrixXd designMatrix );
+double getConditionNumberOfDesignMatrix( const Eigen::MatrixXd& designMatrix );
 
 //! Function to get condition number of matrix from SVD decomposition
 /*!
@@ -44,6 +67,14 @@ double getConditionNumberOfDesignMatrix( const Eigen::MatrixXd designMatrix );
  */
 double getConditionNumberOfDecomposedMatrix( const Eigen::JacobiSVD< Eigen::MatrixXd >& singularValueDecomposition );
 
+//! Function to get condition number of matrix from singular values
+/*!
+ *  Function to get condition number of matrix from singular values
+ * \param singularValues Singular values of matrix (in decreasing order)
+ * \return Condition number of matrix
+ */
+double getConditionNumberFromSingularValues( const Eigen::VectorXd& singularValues );
+
 //! Solve system of equations with SVD decomposition, checking condition number in the process
 /*!
  * Solve system of equations with SVD decomposition, checking condition number in the process. This function solves
@@ -54,10 +85,29 @@ double getConditionNumberOfDecomposedMatrix( const Eigen::JacobiSVD< Eigen::Matr
  * (warning printed when exceeded)
  * \return Solution x of matrix equation A*x=b
  */
-Eigen::VectorXd solveSystemOfEquationsWithSvd( const Eigen::MatrixXd matrixToInvert,
-                                               const Eigen::VectorXd rightHandSideVector,
+Eigen::VectorXd solveSystemOfEquationsWithSvd( const Eigen::MatrixXd& matrixToInvert,
+                                               const Eigen::VectorXd& rightHandSideVector,
                                                const double limitConditionNumberForWarning = 1.0E8 );
 
+//! Solve system of equations with selected linear solver, checking condition number in the process
+/*!
+ * Solve system of equations with selected linear solver, checking condition number in the process. This function solves
+ * A*x = b for the vector x. For the SVD solvers, the condition number is computed from the singular values, for the
+ * other solvers it is estimated from the decomposition (reciprocal condition number estimate for LLT/LDLT, ratio of
+ * extreme diagonal entries of R for QR), without performing an additional decomposition. The condition number is only
+ * evaluated if limitConditionNumberForWarning is not NaN.
+ * \param matrixToInvert Matrix A that is to be inverted to solve the equation (must be symmetric for LLT/LDLT solvers)
+ * \param rightHandSideVector Vector on the righthandside of the matrix equation that is to be solved
+ * \param solverType Type of linear solver that is to be used
+ * \param limitConditionNumberForWarning Maximum value of the condition number of the covariance matrix that is allowed
+ * (warning printed when exceeded)
+ * \return Solution x of matrix equation A*x=b
+ */
+Eigen::VectorXd solveSystemOfEquations( const Eigen::MatrixXd& matrixToInvert,
+                                        const Eigen::VectorXd& rightHandSideVector,
+                                        const LinearSolverType solverType = jacobi_svd_solver,
+                                        const double limitConditionNumberForWarning = 1.0E8 );
+
 //! Function to multiply information matrix by diagonal weights matrix
 /*!
  * Function to multiply information matrix by diagonal weights matrix
@@ -104,6 +154,23 @@ Eigen::MatrixXd calculateInverseOfUpdatedCovarianceMatrix(
         const Eigen::VectorXd& diagonalOfWeightMatrix,
         const double limitConditionNumberForWarning = 1.0E8 );
 
+//! Function to compute inverse of covariance matrix at current iteration from the normal matrix of the observations
+/*!
+ * Function to compute inverse of covariance matrix at current iteration from the normal matrix of the observations,
+ * including influence of a priori information and (optionally) linear constraints on the parameters.
+ * \param normalMatrix Normal matrix H^T W H of the observations, with H the design matrix and W the (diagonal) weights
+ * matrix
+ * \param inverseOfAPrioriCovarianceMatrix Inverse of a priori covariance matrix
+ * \param constraintMultiplier Multiplier for estimated parameter that defines linear constraint
+ * \param constraintRightHandside Right-hand side estimation linear constraint
+ * \return Inverse of covariance matrix at current iteration (augmented with constraints, if any)
+ */
+Eigen::MatrixXd calculateInverseOfUpdatedCovarianceMatrixFromNormalMatrix(
+        const Eigen::MatrixXd& normalMatrix,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const Eigen::MatrixXd& constraintMultiplier = Eigen::MatrixXd( 0, 0 ),
+        const Eigen::VectorXd& constraintRightHandside = Eigen::VectorXd( 0 ) );
+
 Eigen::MatrixXd calculateConsiderParametersCovarianceContribution(
         const Eigen::MatrixXd& normalisedCovarianceMatrix,
         const Eigen::MatrixXd& designMatrix,
@@ -111,6 +178,72 @@ Eigen::MatrixXd calculateConsiderParametersCovarianceContribution(
         const Eigen::MatrixXd& considerDesignMatrix,
         const Eigen::MatrixXd& considerCovariance );
 
+//! Function to compute the contribution of consider parameters to the covariance from the normal matrices
+/*!
+ * Function to compute the contribution of consider parameters to the covariance, from the normal matrix between the
+ * estimated and consider parameters (so that the design matrices need not be available).
+ * \param normalisedCovarianceMatrix Covariance matrix of the estimated parameters
+ * \param considerNormalMatrix Normal matrix H^T W H_c of the observations, with H and H_c the design matrices w.r.t.
+ * estimated and consider parameters, respectively, and W the (diagonal) weights matrix
+ * \param considerCovariance Covariance matrix of the consider parameters
+ * \return Contribution of consider parameters to the covariance of the estimated parameters
+ */
+Eigen::MatrixXd calculateConsiderParametersCovarianceContributionFromNormalMatrix(
+        const Eigen::MatrixXd& normalisedCovarianceMatrix,
+        const Eigen::MatrixXd& considerNormalMatrix,
+        const Eigen::MatrixXd& considerCovariance );
+
+//! Function to perform an iteration of least squares estimation from the normal equations and a priori information
+/*!
+ * Function to perform an iteration of least squares estimation from the normal equations and a priori information. The
+ * normal matrix and right-hand side may be accumulated from subsets of the observations (see NormalEquationsAccumulator),
+ * so that the full design matrix need not be formed.
+ * \param normalMatrix Normal matrix H^T W H of the observations, with H the design matrix and W the (diagonal) weights
+ * matrix
+ * \param rightHandSide Right-hand side H^T W y of the normal equations, with y the observation residuals
+ * \param inverseOfAPrioriCovarianceMatrix Inverse of a priori covariance matrix
+ * \param limitConditionNumberForWarning Maximum value of the condition number of the covariance matrix that is allowed
+ * (warning printed when exceeded)
+ * \param constraintMultiplier Multiplier for estimated parameter that defines linear constraint
+ * \param constraintRightHandside Right-hand side estimation linear constraint
+ * \param solverType Type of linear solver that is to be used
+ * \return Pair containing: (first: parameter adjustment, second: inverse covariance)
+ */
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromInformationMatrix(
+        const Eigen::MatrixXd& normalMatrix,
+        const Eigen::VectorXd& rightHandSide,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const double limitConditionNumberForWarning = 1.0E8,
+        const Eigen::MatrixXd& constraintMultiplier = Eigen::MatrixXd( 0, 0 ),
+        const Eigen::VectorXd& constraintRightHandside = Eigen::VectorXd( 0 ),
+        const LinearSolverType solverType = jacobi_svd_solver );
+
+//! Function to perform an iteration of least squares estimation by column-pivoting QR decomposition of the design matrix
+/*!
+ * Function to perform an iteration of least squares estimation by column-pivoting QR decomposition of the weighted design
+ * matrix, augmented with the square root of the a priori information matrix. Since the normal matrix is not decomposed,
+ * the condition number of the problem that is solved is not squared. The inverse covariance matrix is computed from the
+ * design matrix in the usual manner.
+ * \param designMatrix Matrix containing partial derivatives of observations (rows) w.r.t. estimated parameters
+ * (columns)
+ * \param observationResiduals Difference between measured and simulated observations
+ * \param diagonalOfWeightMatrix Diagonal of observation weights matrix (assumes all weights to be uncorrelated)
+ * \param inverseOfAPrioriCovarianceMatrix Inverse of a priori covariance matrix (must be positive semi-definite)
+ * \param limitConditionNumberForWarning Maximum value of the (estimated) condition number of the normal matrix that is
+ * allowed (warning printed when exceeded)
+ * \param designMatrixConsiderParameters Matrix containing partial derivatives of observations w.r.t. consider parameters
+ * \param considerParametersDeviations Deviations of consider parameters w.r.t. their nominal values
+ * \return Pair containing: (first: parameter adjustment, second: inverse covariance)
+ */
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentWithQrDecomposition(
+        const Eigen::MatrixXd& designMatrix,
+        const Eigen::VectorXd& observationResiduals,
+        const Eigen::VectorXd& diagonalOfWeightMatrix,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const double limitConditionNumberForWarning = 1.0E8,
+        const Eigen::MatrixXd& designMatrixConsiderParameters = Eigen::MatrixXd( 0, 0 ),
+        const Eigen::VectorXd& considerParametersDeviations = Eigen::VectorXd( 0 ) );
+
 //! Function to perform an iteration least squares estimation from information matrix, weights and residuals and a priori
 //! information
 /*!
@@ -126,6 +259,10 @@ Eigen::MatrixXd calculateConsiderParametersCovarianceContribution(
  * \param limitConditionNumberForWarning Maximum value of the condition number of the covariance matrix that is allowed
  * \param constraintMultiplier Multiplier for estimated parameter that defines linear constraint
  * \param constraintRightHandside Right-hand side estimation linear constraint
+ * \param designMatrixConsiderParameters Matrix containing partial derivatives of observations w.r.t. consider parameters
+ * \param considerParametersDeviations Deviations of consider parameters w.r.t. their nominal values
+ * \param solverType Type of linear solver that is to be used (column-pivoting QR is applied to the weighted design
+ * matrix, augmented with the a priori information, if no constraints are used)
  * \return Pair containing: (first: parameter adjustment, second: inverse covariance)
  */
 std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromDesignMatrix(
@@ -137,7 +274,8 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromD
         const Eigen::MatrixXd& constraintMultiplier = Eigen::MatrixXd( 0, 0 ),
         const Eigen::VectorXd& constraintRightHandside = Eigen::VectorXd( 0 ),
         const Eigen::MatrixXd& designMatrixConsiderParameters = Eigen::MatrixXd( 0, 0 ),
-        const Eigen::VectorXd& considerParametersDeviations = Eigen::VectorXd( 0 ) );
+        const Eigen::VectorXd& considerParametersDeviations = Eigen::VectorXd( 0 ),
+        const LinearSolverType solverType = jacobi_svd_solver );
 
 //! Function to perform an iteration of least squares estimation from information matrix, weights and residuals
 /*!
@@ -203,6 +341,309 @@ std::vector< double > getLeastSquaresPolynomialFit(
         const std::map< double, double >& independentDependentValueMap,
         const std::vector< double >& polynomialPowers );
 
+//! Class to accumulate the normal equations of a least squares problem from consecutive blocks of observations
+/*!
+ * Class to accumulate the normal matrix H^T W H and right-hand side H^T W y of a least squares problem from consecutive
+ * blocks of observations (rows of the design matrix H, with diagonal weights matrix W and residuals y), so that the full
+ * design matrix is never stored. In addition, the extreme values of each column of the design matrix are stored, from
+ * which the normalization terms of the design matrix are computed in the same manner as for a fully stored design
+ * matrix (column normalization to the range [-1,1]).
+ */
+class NormalEquationsAccumulator
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor, initializes all accumulated quantities to zero
+     * \param numberOfParameters Number of parameters (columns of the design matrix)
+     */
+    NormalEquationsAccumulator( const int numberOfParameters = 0 );
+
+    //! Function to add the contribution of a block of observations to the normal equations
+    /*!
+     * Function to add the contribution of a block of observations to the normal equations
+     * \param designMatrixBlock Rows of the design matrix for the current observations
+     * \param residualsBlock Residuals of the current observations
+     * \param weightsBlock Weights of the current observations
+     * \param nonZeroColumns Indices of the columns of the design matrix block that may be non-zero (in increasing order).
+     * Only the contributions of these columns are added to the normal equations, all other columns must be zero. If empty
+     * (default), all columns are used.
+     */
+    void addObservations( const Eigen::Ref< const Eigen::MatrixXd >& designMatrixBlock,
+                          const Eigen::Ref< const Eigen::VectorXd >& residualsBlock,
+                          const Eigen::Ref< const Eigen::VectorXd >& weightsBlock,
+                          const std::vector< int >& nonZeroColumns = std::vector< int >( ) );
+
+    //! Function to add the normal equations accumulated by another object (for the same parameters) to this object
+    /*!
+     * Function to add the normal equations accumulated by another object (for the same parameters) to this object
+     * \param otherNormalEquations Object that is to be added
+     */
+    void addNormalEquations( const NormalEquationsAccumulator& otherNormalEquations );
+
+    //! Function to compute the normalization terms of the columns of the design matrix
+    /*!
+     * Function to compute the normalization terms of the columns of the design matrix: the entry of each column with
+     * largest absolute value (or 1.0 for an all-zero column).
+     * \return Vector with scaling values for normalization
+     */
+    Eigen::VectorXd getNormalizationTerms( ) const;
+
+    //! Function to retrieve the accumulated normal matrix H^T W H
+    const Eigen::MatrixXd& getNormalMatrix( ) const
+    {
+        return normalMatrix_;
+    }
+
+    //! Function to retrieve the accumulated right-hand side H^T W y
+    const Eigen::VectorXd& getRightHandSide( ) const
+    {
+        return rightHandSide_;
+    }
+
+    //! Function to retrieve the number of observations that have been added
+    int getNumberOfObservations( ) const
+    {
+        return numberOfObservations_;
+    }
+
+private:
+
+    //! Accumulated normal matrix H^T W H
+    Eigen::MatrixXd normalMatrix_;
+
+    //! Accumulated right-hand side H^T W y
+    Eigen::VectorXd rightHandSide_;
+
+    //! Minimum value of each column of the design matrix
+    Eigen::VectorXd designMatrixColumnMinima_;
+
+    //! Maximum value of each column of the design matrix
+    Eigen::VectorXd designMatrixColumnMaxima_;
+
+    //! Number of observations that have been added
+    int numberOfObservations_;
+};
+
+//! Class to accumulate the block-structured normal equations of a least squares problem with arc-local parameters
+/*!
+ * Class to accumulate the normal equations of a least squares problem from consecutive blocks of observations (see
+ * NormalEquationsAccumulator), for a problem in which the parameters are divided into global parameters, and parameters
+ * that are local to a single arc (e.g. arc-wise initial states or per-arc biases in a multi-arc estimation). Each
+ * observation may depend on the global parameters and on the local parameters of at most a single arc, so that the normal
+ * matrix is block-structured: only the global-global block, and the local-local and local-global blocks of each arc are
+ * stored (memory scales linearly with the number of arcs). The arc to which an observation belongs is determined from the
+ * non-zero entries of its row of the design matrix; an observation that does not depend on any local parameter only
+ * contributes to the global blocks. An exception is thrown if an observation depends on the local parameters of more than
+ * one arc. The normal equations are solved by performLeastSquaresAdjustmentWithArcLocalParameterReduction.
+ */
+class ArcWiseNormalEquationsAccumulator
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor, initializes all accumulated quantities to zero
+     * \param numberOfParameters Number of parameters (columns of the design matrix)
+     * \param arcLocalParameterIndices List (per arc) of the indices of the parameters that are local to that arc. All
+     * parameters not in this list are global parameters.
+     */
+    ArcWiseNormalEquationsAccumulator(
+            const int numberOfParameters = 0,
+            const std::vector< std::vector< int > >& arcLocalParameterIndices = std::vector< std::vector< int > >( ) );
+
+    //! Function to add the contribution of a block of observations to the normal equations
+    /*!
+     * Function to add the contribution of a block of observations to the normal equations
+     * \param designMatrixBlock Rows of the design matrix for the current observations
+     * \param residualsBlock Residuals of the current observations
+     * \param weightsBlock Weights of the current observations
+     * \param nonZeroColumns Indices of the columns of the design matrix block that may be non-zero (in increasing order).
+     * Only the contributions of these columns are added to the normal equations, all other columns must be zero. If empty
+     * (default), all columns are used.
+     */
+    void addObservations( const Eigen::Ref< const Eigen::MatrixXd >& designMatrixBlock,
+                          const Eigen::Ref< const Eigen::VectorXd >& residualsBlock,
+                          const Eigen::Ref< const Eigen::VectorXd >& weightsBlock,
+                          const std::vector< int >& nonZeroColumns = std::vector< int >( ) );
+
+    //! Function to add the normal equations accumulated by another object (for the same parameters) to this object
+    /*!
+     * Function to add the normal equations accumulated by another object (for the same parameters and division into arcs)
+     * to this object
+     * \param otherNormalEquations Object that is to be added
+     */
+    void addNormalEquations( const ArcWiseNormalEquationsAccumulator& otherNormalEquations );
+
+    //! Function to combine the normal equations accumulated by the processes of a group
+    /*!
+     * Function to combine the normal equations accumulated by the processes of a group, when the observations (and arcs)
+     * are distributed over the processes. The global blocks, the number of observations and the extreme values of the
+     * design matrix columns are combined over all processes, so that these are identical on all processes afterwards. The
+     * local blocks of the arcs are not communicated: each process must only have added observations of the arcs assigned to
+     * it (see getProcessItemRange), which are eliminated by that process in
+     * performLeastSquaresAdjustmentWithArcLocalParameterReduction.
+     * \param processCommunicator Object used for the communication between the processes
+     */
+    void reduceOverProcesses( const std::shared_ptr< utilities::ProcessCommunicator > processCommunicator );
+
+    //! Function to compute the normalization terms of the columns of the design matrix
+    /*!
+     * Function to compute the normalization terms of the columns of the design matrix, in the same manner as
+     * NormalEquationsAccumulator::getNormalizationTerms
+     * \return Vector with scaling values for normalization
+     */
+    Eigen::VectorXd getNormalizationTerms( ) const;
+
+    //! Function to assemble the full (dense) normal matrix H^T W H from the accumulated blocks
+    Eigen::MatrixXd getFullNormalMatrix( ) const;
+
+    //! Function to assemble the full right-hand side H^T W y from the accumulated blocks
+    Eigen::VectorXd getFullRightHandSide( ) const;
+
+    //! Function to retrieve the number of parameters
+    int getNumberOfParameters( ) const
+    {
+        return numberOfParameters_;
+    }
+
+    //! Function to retrieve the number of arcs
+    int getNumberOfArcs( ) const
+    {
+        return arcLocalParameterIndices_.size( );
+    }
+
+    //! Function to retrieve the indices of the global parameters
+    const std::vector< int >& getGlobalParameterIndices( ) const
+    {
+        return globalParameterIndices_;
+    }
+
+    //! Function to retrieve the indices of the local parameters, per arc
+    const std::vector< std::vector< int > >& getArcLocalParameterIndices( ) const
+    {
+        return arcLocalParameterIndices_;
+    }
+
+    //! Function to retrieve the accumulated normal matrix block of the global parameters
+    const Eigen::MatrixXd& getGlobalNormalMatrix( ) const
+    {
+        return globalNormalMatrix_;
+    }
+
+    //! Function to retrieve the accumulated right-hand side block of the global parameters
+    const Eigen::VectorXd& getGlobalRightHandSide( ) const
+    {
+        return globalRightHandSide_;
+    }
+
+    //! Function to retrieve the accumulated normal matrix blocks of the local parameters of each arc
+    const std::vector< Eigen::MatrixXd >& getArcLocalNormalMatrices( ) const
+    {
+        return arcLocalNormalMatrices_;
+    }
+
+    //! Function to retrieve the accumulated normal matrix blocks between the local (rows) and global (columns) parameters
+    const std::vector< Eigen::MatrixXd >& getArcLocalGlobalNormalMatrices( ) const
+    {
+        return arcLocalGlobalNormalMatrices_;
+    }
+
+    //! Function to retrieve the accumulated right-hand side blocks of the local parameters of each arc
+    const std::vector< Eigen::VectorXd >& getArcLocalRightHandSides( ) const
+    {
+        return arcLocalRightHandSides_;
+    }
+
+    //! Function to retrieve the number of observations that have been added
+    int getNumberOfObservations( ) const
+    {
+        return numberOfObservations_;
+    }
+
+private:
+
+    //! Number of parameters (columns of the design matrix)
+    int numberOfParameters_;
+
+    //! Indices of the local parameters, per arc
+    std::vector< std::vector< int > > arcLocalParameterIndices_;
+
+    //! Indices of the global parameters
+    std::vector< int > globalParameterIndices_;
+
+    //! Indices of all local parameters (in increasing order)
+    std::vector< int > localParameterIndices_;
+
+    //! Arc index of each parameter (-1 for global parameters)
+    std::vector< int > parameterArcIndices_;
+
+    //! Index of each parameter in the list of global parameters, or in the list of local parameters of its arc
+    std::vector< int > parameterBlockIndices_;
+
+    //! Accumulated normal matrix block of the global parameters
+    Eigen::MatrixXd globalNormalMatrix_;
+
+    //! Accumulated right-hand side block of the global parameters
+    Eigen::VectorXd globalRightHandSide_;
+
+    //! Accumulated normal matrix blocks of the local parameters, per arc
+    std::vector< Eigen::MatrixXd > arcLocalNormalMatrices_;
+
+    //! Accumulated normal matrix blocks between the local (rows) and global (columns) parameters, per arc
+    std::vector< Eigen::MatrixXd > arcLocalGlobalNormalMatrices_;
+
+    //! Accumulated right-hand side blocks of the local parameters, per arc
+    std::vector< Eigen::VectorXd > arcLocalRightHandSides_;
+
+    //! Minimum value of each column of the design matrix
+    Eigen::VectorXd designMatrixColumnMinima_;
+
+    //! Maximum value of each column of the design matrix
+    Eigen::VectorXd designMatrixColumnMaxima_;
+
+    //! Number of observations that have been added
+    int numberOfObservations_;
+};
+
+//! Function to perform an iteration of least squares estimation from block-structured normal equations
+/*!
+ * Function to perform an iteration of least squares estimation from block-structured normal equations (see
+ * ArcWiseNormalEquationsAccumulator), by eliminating the local parameters of each arc from the normal equations (Schur
+ * complement). The reduced normal equations of the global parameters are solved with the requested linear solver, after
+ * which the local parameters of each arc are obtained by back-substitution. The elimination and back-substitution of the
+ * arcs is distributed over the requested number of threads; the contributions of the arcs to the reduced normal equations
+ * are summed in a fixed order, so that the result is deterministic for a given number of threads. The local blocks are
+ * decomposed with an LDLT decomposition. The a priori covariance may not correlate the local parameters of different arcs.
+ *
+ * If a process communicator is provided, the arcs are distributed over the processes of the group in contiguous ranges (see
+ * getProcessItemRange), and the normal equations must have been combined over the processes
+ * (ArcWiseNormalEquationsAccumulator::reduceOverProcesses). Each process eliminates its own arcs, after which the
+ * contributions to the reduced normal equations are summed over the processes. The reduced normal equations are solved by
+ * the root process, and only the resulting adjustment of the global parameters is broadcast. Each process then computes the
+ * local parameters of its own arcs, and the full parameter adjustment is combined over the processes, so that it is
+ * identical on all processes. The (dense) normalized inverse covariance is also combined over the processes.
+ * \param normalEquations Block-structured (unnormalized) normal equations of the observations
+ * \param normalizationTerms Normalization terms of the parameters, by which the columns of the design matrix are divided
+ * \param inverseOfAPrioriCovarianceMatrix Inverse of (normalized) a priori covariance matrix
+ * \param limitConditionNumberForWarning Maximum value of the condition number of the (reduced) normal matrices that is
+ * allowed (warning printed when exceeded). No check is performed if this value is NaN.
+ * \param solverType Type of linear solver that is to be used for the reduced normal equations
+ * \param numberOfThreads Number of threads over which the arcs (of the current process) are distributed
+ * \param processCommunicator Object used for the communication between the processes over which the arcs are
+ * distributed (nullptr if all arcs are processed by the current process)
+ * \return Pair containing: (first: normalized parameter adjustment, second: normalized inverse covariance)
+ */
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentWithArcLocalParameterReduction(
+        const ArcWiseNormalEquationsAccumulator& normalEquations,
+        const Eigen::VectorXd& normalizationTerms,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const double limitConditionNumberForWarning = 1.0E8,
+        const LinearSolverType solverType = jacobi_svd_solver,
+        const int numberOfThreads = 1,
+        const std::shared_ptr< utilities::ProcessCommunicator > processCommunicator = nullptr );
+
 //! Function to perform a non-linear least squares estimation with the Levenberg-Marquardt method.
 /*!
  *  Function to perform a non-linear least squares estimation. The non-linear least squares method is an iterative
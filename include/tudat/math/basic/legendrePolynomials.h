@@ -40,6 +40,8 @@
 #include <boost/circular_buffer.hpp>
 #include <functional>
 #include <memory>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 
@@ -51,6 +53,22 @@ namespace tudat
 namespace basic_mathematics
 {
 
+//! Types of recursion used to compute the geodesy-normalized Legendre polynomials in a LegendreCache
+/*!
+ *  Types of recursion used to compute the geodesy-normalized Legendre polynomials in a LegendreCache. The standard
+ *  recursion computes the sectoral polynomials, which scale with the cosine of the latitude to the power order, in double
+ *  precision. These underflow for high orders (from an order of several hundred, depending on latitude), after which all
+ *  polynomials of that order computed from them by the degree recursion are zero. The extended range recursion performs
+ *  both recursions on 'X-numbers' (a double and an integer exponent of 2^960, see Fukushima, 2012, J. Geod. 86:271-285),
+ *  and converts the results to double precision, so that the polynomials are correct up to degrees of several thousands.
+ *  Where the standard recursion does not underflow, the results of both recursions are identical.
+ */
+enum LegendreRecursionType
+{
+    standard_legendre_recursion,
+    extended_range_legendre_recursion
+};
+
 //! Class for creating and accessing a back-end cache of Legendre polynomials.
 class LegendreCache
 {
@@ -122,7 +140,14 @@ public:
     * \param order Order of requested Legendre polynomial.
     * \return Legendre polynomial value.
     */
-    double getLegendrePolynomial( const int degree, const int order );
+    double getLegendrePolynomial( const int degree, const int order )
+    {
+        if( degree > maximumDegree_ || order > maximumOrder_ )
+        {
+            throwMaximumDegreeOrOrderExceededError( "", degree, order );
+        }
+        return ( order > degree ) ? 0.0 : legendreValues_[ degreeOffsets_[ degree ] + order ];
+    }
 
     //! Get first derivative of Legendre polynomial value from the cache.
     /*!
@@ -131,7 +156,14 @@ public:
     * \param order Order of requested Legendre polynomial.
     * \return First derivative of Legendre polynomial value.
     */
-    double getLegendrePolynomialDerivative( const int degree, const int order );
+    double getLegendrePolynomialDerivative( const int degree, const int order )
+    {
+        if( degree > maximumDegree_ || order > maximumOrder_ )
+        {
+            throwMaximumDegreeOrOrderExceededError( " first derivatives", degree, order );
+        }
+        return ( order > degree ) ? 0.0 : legendreDerivatives_[ degreeOffsets_[ degree ] + order ];
+    }
 
     //! Get second derivative of Legendre polynomial value from the cache.
     /*!
@@ -140,7 +172,18 @@ public:
     * \param order Order of requested Legendre polynomial.
     * \return Second derivative of Legendre polynomial value.
     */
-    double getLegendrePolynomialSecondDerivative( const int degree, const int order );
+    double getLegendrePolynomialSecondDerivative( const int degree, const int order )
+    {
+        if( degree > maximumDegree_ || order > maximumOrder_ )
+        {
+            throwMaximumDegreeOrOrderExceededError( " second derivatives", degree, order );
+        }
+        else if( !computeSecondDerivatives_ )
+        {
+            throw std::runtime_error( "Error when requesting legendre cache second derivatives, no computations performed" );
+        }
+        return ( order > degree ) ? 0.0 : legendreSecondDerivatives_[ degreeOffsets_[ degree ] + order ];
+    }
 
     //! Function to get the maximum degree of cache.
     /*!
@@ -190,10 +233,57 @@ public:
      * \param computeSecondDerivatives Boolean denoting whether the second derivatives of the Legendre polynomials are
      * to be computed when calling update function.
      */
-    void setComputeSecondDerivatives( const bool computeSecondDerivatives )
+    void setComputeSecondDerivatives( const bool computeSecondDerivatives );
+
+    //! Get pointer to the Legendre polynomial values of a single degree in the cache.
+    /*!
+     * Get pointer to the Legendre polynomial values of a single degree in the cache, as computed by last call to update
+     * function. The values are stored contiguously for orders 0 to min( degree, getMaximumOrder( ) ). Used by summation
+     * kernels that process all orders of a single degree at once.
+     * \param degree Degree of the Legendre polynomials
+     * \return Pointer to the Legendre polynomial values of the degree
+     */
+    const double* getLegendrePolynomialValuesOfDegree( const int degree ) const
     {
-        computeSecondDerivatives_ = computeSecondDerivatives;
-        currentPolynomialParameter_ = TUDAT_NAN;
+        return legendreValues_.data( ) + degreeOffsets_[ degree ];
+    }
+
+    //! Get pointer to the first derivatives of the Legendre polynomial values of a single degree in the cache.
+    /*!
+     * Get pointer to the first derivatives of the Legendre polynomial values of a single degree in the cache, as computed
+     * by last call to update function, with the same ordering as getLegendrePolynomialValuesOfDegree.
+     * \param degree Degree of the Legendre polynomials
+     * \return Pointer to the first derivatives of the Legendre polynomial values of the degree
+     */
+    const double* getLegendrePolynomialDerivativeValuesOfDegree( const int degree ) const
+    {
+        return legendreDerivatives_.data( ) + degreeOffsets_[ degree ];
+    }
+
+    //! Function to get the memory used by the cached values and recursion coefficients
+    /*!
+     * Function to get the memory used by the cached values and recursion coefficients (excluding the fixed-size members
+     * of the object itself)
+     * \return Memory used by cache, in bytes
+     */
+    std::size_t getMemoryFootprint( ) const;
+
+    //! Function to set the type of recursion used to compute the Legendre polynomials when calling update function
+    /*!
+     * Function to set the type of recursion used to compute the Legendre polynomials when calling update function (see
+     * LegendreRecursionType). The extended range recursion is only available for geodesy-normalized polynomials.
+     * \param recursionType Type of recursion used to compute the Legendre polynomials
+     */
+    void setRecursionType( const LegendreRecursionType recursionType );
+
+    //! Function to get the type of recursion used to compute the Legendre polynomials when calling update function
+    /*!
+     * Function to get the type of recursion used to compute the Legendre polynomials when calling update function
+     * \return Type of recursion used to compute the Legendre polynomials
+     */
+    LegendreRecursionType getRecursionType( )
+    {
+        return recursionType_;
     }
 
     double getVerticalLegendreValuesComputationMultipliersOne( const int degree, const int order );
@@ -202,6 +292,30 @@ public:
 
 private:
 
+    //! Function to compute the geodesy-normalized Legendre polynomials using the standard recursion
+    /*!
+     * Function to compute the geodesy-normalized Legendre polynomials at the current polynomial parameter using the
+     * standard recursion (see LegendreRecursionType), and store them in legendreValues_.
+     */
+    void computeGeodesyLegendrePolynomials( );
+
+    //! Function to throw an error for a request of a value outside of the cache
+    /*!
+     * Function to throw an error for a request of a value outside of the cache
+     * \param valueType Type of value that was requested (empty for polynomial, or derivative type)
+     * \param degree Requested degree
+     * \param order Requested order
+     */
+    void throwMaximumDegreeOrOrderExceededError(
+            const std::string& valueType, const int degree, const int order ) const;
+
+    //! Function to compute the geodesy-normalized Legendre polynomials using the extended range recursion
+    /*!
+     * Function to compute the geodesy-normalized Legendre polynomials at the current polynomial parameter using the
+     * extended range recursion (see LegendreRecursionType), and store them in legendreValues_.
+     */
+    void computeExtendedRangeGeodesyLegendrePolynomials( );
+
     //! Maximum degree of cache.
     int maximumDegree_;
 
@@ -216,29 +330,34 @@ private:
 
     double currentOneOverPolynomialParameterComplement_;
 
-    //! List of current values of Legendre polynomials at degree and order (n,m)
+    //! Start of each degree in the packed (triangular) storage of all per degree and order values
     /*!
-     * List of current values of Legendre polynomials at degree and order (n,m). The corresponding polynomial is at entry
-     * n * ( maximumOrder_ + 1 ) + m.
+     * Start of each degree in the packed (triangular) storage of all per degree and order values: the value at degree
+     * and order (n,m) is at entry degreeOffsets_[ n ] + m, with m <= min( n, maximumOrder_ ). Entry maximumDegree_ + 1
+     * is the total number of entries.
      */
+    std::vector< int > degreeOffsets_;
+
+    //! List of current values of Legendre polynomials at degree and order (n,m), in packed storage (see degreeOffsets_)
     std::vector< double > legendreValues_;
 
+    //! Pre-computed first multipliers of the degree recursion at degree and order (n,m), in packed storage
     std::vector< double > verticalLegendreValuesComputationMultipliersOne_;
 
+    //! Pre-computed second multipliers of the degree recursion at degree and order (n,m), in packed storage
     std::vector< double > verticalLegendreValuesComputationMultipliersTwo_;
 
-    //! List of current values of first derivatives of Legendre polynomials at degree and order (n,m)
-    /*!
-     * List of current values of first derivatives of Legendre polynomials at degree and order (n,m).
-     * The corresponding polynomial is at entry n * ( maximumOrder_ + 1 ) + m.
-     */
+    //! Pre-computed multipliers of the sectoral recursion at degree n, sqrt( ( 2n + 1 ) / ( 6n ) )
+    std::vector< double > sectoralLegendreValuesComputationMultipliers_;
+
+    //! Pre-computed multipliers of the degree recursion at degree n that are independent of order, sqrt( 2n - 1 )
+    std::vector< double > degreeLegendreValuesComputationMultipliers_;
+
+    //! List of current values of first derivatives of Legendre polynomials at degree and order (n,m), in packed storage
     std::vector< double > legendreDerivatives_;
 
-    //! List of current values of second derivatives of Legendre polynomials at degree and order (n,m)
-    /*!
-     * List of current values of second derivatives of Legendre polynomials at degree and order (n,m).
-     * The corresponding polynomial is at entry n * ( maximumOrder_ + 1 ) + m.
-     */
+    //! List of current values of second derivatives of Legendre polynomials at degree and order (n,m), in packed storage
+    //! (only allocated if second derivatives are computed).
     std::vector< double > legendreSecondDerivatives_;
 
     //! Function from which to compute the Legendre polynomials.
@@ -247,10 +366,8 @@ private:
     //! Boolean denoting whether the Legendre polynomials are geodesy-normalized or unnormalized
     bool useGeodesyNormalization_;
 
-    //! Vector of ratio of reference radius over current radius to power i, with i the entry in the vector.
-    std::vector< double > referenceRadiusRatioPowers_;
-
-    //! Prec-computed normalization factors that are to be used for computation fo Legendre polynomial derivative
+    //! Prec-computed normalization factors that are to be used for computation fo Legendre polynomial derivative, in
+    //! packed storage
     std::vector< double > derivativeNormalizations_;
 
     //! Boolean denoting whether the first derivatives of the Legendre polynomials are to be computed when calling
@@ -259,7 +376,13 @@ private:
 
     //! Boolean denoting whether the second derivatives of the Legendre polynomials are to be computed when calling
     //! update function.
-    bool computeSecondDerivatives_;
+    bool computeSecondDerivatives_{false};
+
+    //! Type of recursion used to compute the Legendre polynomials when calling update function
+    LegendreRecursionType recursionType_{standard_legendre_recursion};
+
+    //! Lowest degree per order from which the extended range recursion is continued in double precision
+    std::vector< int > firstDoublePrecisionDegrees_;
 
 
 };
@@ -12,9 +12,10 @@
 #ifndef TUDAT_SPHERICAL_HARMONICS_H
 #define TUDAT_SPHERICAL_HARMONICS_H
 
-#include <Eigen/Core>
-
+#include <memory>
+#include <vector>
 
+#include <Eigen/Core>
 
 #include "tudat/math/basic/legendrePolynomials.h"
 
@@ -23,6 +24,173 @@ namespace tudat
 namespace basic_mathematics
 {
 
+//! Types of implementation of the summation over all degrees and orders of a spherical harmonic gravity field
+/*!
+ *  Types of implementation of the summation over all degrees and orders of a spherical harmonic gravity field. The
+ *  standard summation evaluates the terms one by one. The packed summation processes all orders of a single degree in
+ *  one loop over contiguously stored coefficients and Legendre polynomials (with scalar instructions), and the vectorized
+ *  summation does the same using the widest SIMD instruction set available on the machine (AVX-512 or AVX2/FMA, selected
+ *  at run time; if neither is available, the packed summation is used). The packed and vectorized summations change the
+ *  order of the floating point operations, so that their results are identical to those of the standard summation up to
+ *  round-off only. The Cartesian summation uses a different (singularity-free) formulation, in which the terms of the
+ *  expansion are computed by a recursion in Cartesian coordinates (Cunningham, 1970; see
+ *  CartesianSphericalHarmonicsRecursion), so that no conversion to spherical coordinates, treatment of the poles and
+ *  transformation of the gradient are needed. Its results are equal to those of the other summations up to round-off.
+ */
+enum SphericalHarmonicsSummationType
+{
+    standard_spherical_harmonics_summation,
+    packed_spherical_harmonics_summation,
+    vectorized_spherical_harmonics_summation,
+    cartesian_spherical_harmonics_summation
+};
+
+//! Class for the recursive computation of the Cartesian (Cunningham) terms of a spherical harmonic expansion.
+/*!
+ *  Class for the recursive computation of the geodesy-normalized Cartesian terms V_nm and W_nm (Cunningham, 1970;
+ *  Montenbruck & Gill, 2000, Section 3.2.4) of a spherical harmonic expansion, which are defined by
+ *  V_nm + i W_nm = N_nm ( R / r )^( n + 1 ) P_nm( sin( latitude ) ) exp( i m longitude ), with N_nm the geodesy
+ *  normalization factor and R the reference radius. The terms are computed directly from the Cartesian position, so that
+ *  no conversion to spherical coordinates is needed, and the resulting acceleration is free of singularities at the poles.
+ *  The factors of the recursion, and of the acceleration expressed in these terms (see getPotentialGradientFactors), are
+ *  precomputed when the maximum degree and order are reset.
+ */
+class CartesianSphericalHarmonicsRecursion
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param maximumDegree Maximum degree to which terms are computed
+     * \param maximumOrder Maximum order to which terms are computed
+     */
+    CartesianSphericalHarmonicsRecursion( const int maximumDegree = 0, const int maximumOrder = 0 )
+    {
+        resetMaximumDegreeAndOrder( maximumDegree, maximumOrder );
+    }
+
+    //! Function to reset the maximum degree and order, and to precompute the recursion factors
+    /*!
+     * Function to reset the maximum degree and order, and to precompute the recursion factors
+     * \param maximumDegree Maximum degree to which terms are computed
+     * \param maximumOrder Maximum order to which terms are computed (limited to maximumDegree)
+     */
+    void resetMaximumDegreeAndOrder( const int maximumDegree, const int maximumOrder );
+
+    //! Function to compute the terms V_nm and W_nm at the given position
+    /*!
+     * Function to compute the terms V_nm and W_nm at the given position, for all degrees and orders up to the current
+     * maximum values. The terms are not recomputed if the position and reference radius are equal to those of the
+     * previous update (e.g. when the recursion is shared by several models evaluated at the same relative position).
+     * \param position Cartesian position (in the frame of the spherical harmonic expansion)
+     * \param referenceRadius Reference radius of the spherical harmonic expansion
+     */
+    void update( const Eigen::Vector3d& position, const double referenceRadius );
+
+    //! Function to retrieve the real term V_nm of given degree and order
+    double getRealTerm( const int degree, const int order ) const
+    {
+        return realTerms_[ getTermIndex( degree, order ) ];
+    }
+
+    //! Function to retrieve the imaginary term W_nm of given degree and order
+    double getImaginaryTerm( const int degree, const int order ) const
+    {
+        return imaginaryTerms_[ getTermIndex( degree, order ) ];
+    }
+
+    //! Function to retrieve pointer to real terms V_nm, packed per degree (index degree * ( degree + 1 ) / 2 + order)
+    const double* getRealTerms( ) const
+    {
+        return realTerms_.data( );
+    }
+
+    //! Function to retrieve pointer to imaginary terms W_nm, packed in the same manner as getRealTerms
+    const double* getImaginaryTerms( ) const
+    {
+        return imaginaryTerms_.data( );
+    }
+
+    //! Function to retrieve the factors with which terms of degree n + 1 contribute to the gradient of the term (n,m)
+    /*!
+     * Function to retrieve the factors with which terms of degree n + 1 contribute to the gradient of the potential term
+     * (n,m) (with geodesy-normalized coefficients C_nm, S_nm). Denoting the three factors by p, q and f, the gradient of
+     * the term (n,m), divided by GM / R^2, is:
+     * x: p ( -C V_{n+1,m+1} - S W_{n+1,m+1} ) + q ( C V_{n+1,m-1} + S W_{n+1,m-1} ),
+     * y: p ( -C W_{n+1,m+1} + S V_{n+1,m+1} ) + q ( -C W_{n+1,m-1} + S V_{n+1,m-1} ),
+     * z: f ( -C V_{n+1,m} - S W_{n+1,m} ),
+     * with q = 0 for m = 0 (for which the terms of order m - 1 are not defined).
+     * \param degree Degree n of potential term (at most maximum degree - 1)
+     * \param order Order m of potential term (at most maximum order - 1)
+     * \return Factors p, q and f, stored in this order
+     */
+    const double* getPotentialGradientFactors( const int degree, const int order ) const
+    {
+        return &( gradientFactors_[ 3 * getTermIndex( degree, order ) ] );
+    }
+
+    //! Function to get the maximum degree to which terms are computed
+    int getMaximumDegree( ) const
+    {
+        return maximumDegree_;
+    }
+
+    //! Function to get the maximum order to which terms are computed
+    int getMaximumOrder( ) const
+    {
+        return maximumOrder_;
+    }
+
+    //! Function to get the memory used by the terms and precomputed factors, in bytes
+    std::size_t getMemoryFootprint( ) const
+    {
+        return sizeof( double ) * (
+                    realTerms_.capacity( ) + imaginaryTerms_.capacity( ) + firstDegreeRecursionFactors_.capacity( ) +
+                    secondDegreeRecursionFactors_.capacity( ) + sectoralRecursionFactors_.capacity( ) +
+                    gradientFactors_.capacity( ) );
+    }
+
+private:
+
+    //! Function to get index of term of given degree and order in packed vectors
+    int getTermIndex( const int degree, const int order ) const
+    {
+        return degree * ( degree + 1 ) / 2 + order;
+    }
+
+    //! Maximum degree to which terms are computed.
+    int maximumDegree_;
+
+    //! Maximum order to which terms are computed.
+    int maximumOrder_;
+
+    //! Real terms V_nm (packed, see getTermIndex).
+    std::vector< double > realTerms_;
+
+    //! Imaginary terms W_nm (packed, see getTermIndex).
+    std::vector< double > imaginaryTerms_;
+
+    //! Factors of term of degree n - 1 in degree recursion (packed, see getTermIndex).
+    std::vector< double > firstDegreeRecursionFactors_;
+
+    //! Factors of term of degree n - 2 in degree recursion (packed, see getTermIndex).
+    std::vector< double > secondDegreeRecursionFactors_;
+
+    //! Factors of sectoral recursion, per order.
+    std::vector< double > sectoralRecursionFactors_;
+
+    //! Factors p, q and f of potential gradient of each term (packed, three per term, see getPotentialGradientFactors).
+    std::vector< double > gradientFactors_;
+
+    //! Position at which the terms were last computed (used to skip recomputation for repeated updates).
+    Eigen::Vector3d currentPosition_;
+
+    //! Reference radius with which the terms were last computed.
+    double currentReferenceRadius_;
+
+};
+
 //! Cache object in which variables that are required for the computation of spherical harmonic potential are stored.
 /*!
  *  Cache object in which variables that are required for the computation of spherical harmonic potential are stored.
@@ -166,6 +334,83 @@ public:
         return legendreCache_;
     }
 
+    //! Function to get pointer to the current sines of order times the longitude (entry i denotes sin(i times longitude)).
+    const double* getSinesOfMultipleLongitude( ) const
+    {
+        return sinesOfLongitude_.data( );
+    }
+
+    //! Function to get pointer to the current cosines of order times the longitude (entry i denotes cos(i times longitude)).
+    const double* getCosinesOfMultipleLongitude( ) const
+    {
+        return cosinesOfLongitude_.data( );
+    }
+
+    //! Function to set the type of implementation of the summation over degrees and orders of the spherical harmonic field
+    /*!
+     * Function to set the type of implementation of the summation over degrees and orders of the spherical harmonic field
+     * (see SphericalHarmonicsSummationType) that is used when computing the gravitational acceleration with this cache.
+     * \param summationType Type of implementation of the summation
+     */
+    void setSummationType( const SphericalHarmonicsSummationType summationType )
+    {
+        summationType_ = summationType;
+    }
+
+    //! Function to get the type of implementation of the summation over degrees and orders of the spherical harmonic field
+    SphericalHarmonicsSummationType getSummationType( )
+    {
+        return summationType_;
+    }
+
+    //! Function to get object for computing the Cartesian terms of the spherical harmonic expansion.
+    /*!
+     * Function to get object for computing the Cartesian terms of the spherical harmonic expansion, used by the
+     * cartesian_spherical_harmonics_summation. The object is created (with the maximum degree and order of this cache)
+     * upon the first call to this function.
+     * \return Object for computing the Cartesian terms of the spherical harmonic expansion.
+     */
+    std::shared_ptr< CartesianSphericalHarmonicsRecursion > getCartesianRecursion( )
+    {
+        if( cartesianRecursion_ == nullptr )
+        {
+            cartesianRecursion_ = std::make_shared< CartesianSphericalHarmonicsRecursion >(
+                        maximumDegree_, maximumOrder_ );
+        }
+        return cartesianRecursion_;
+    }
+
+    //! Function to get the memory used by the cached values (including those of the Legendre cache)
+    /*!
+     * Function to get the memory used by the cached values (including those of the Legendre cache, see
+     * LegendreCache::getMemoryFootprint, and of the Cartesian recursion, if it has been created)
+     * \return Memory used by cache, in bytes
+     */
+    std::size_t getMemoryFootprint( ) const
+    {
+        return legendreCache_->getMemoryFootprint( ) + sizeof( double ) * (
+                    sinesOfLongitude_.capacity( ) + cosinesOfLongitude_.capacity( ) +
+                    referenceRadiusRatioPowers_.capacity( ) ) +
+                ( ( cartesianRecursion_ == nullptr ) ? 0 : cartesianRecursion_->getMemoryFootprint( ) );
+    }
+
+    //! Function to set the type of recursion used to compute the Legendre polynomials in the Legendre cache
+    /*!
+     * Function to set the type of recursion used to compute the Legendre polynomials in the Legendre cache (see
+     * LegendreRecursionType). The extended range recursion is required for fields of degree above approximately 1900.
+     * \param recursionType Type of recursion used to compute the Legendre polynomials
+     */
+    void setLegendreRecursionType( const LegendreRecursionType recursionType )
+    {
+        legendreCache_->setRecursionType( recursionType );
+    }
+
+    //! Function to get the type of recursion used to compute the Legendre polynomials in the Legendre cache
+    LegendreRecursionType getLegendreRecursionType( )
+    {
+        return legendreCache_->getRecursionType( );
+    }
+
 private:
 
     //! Update cached values of sines and cosines of longitude/
@@ -240,6 +485,12 @@ private:
     //! Object for caching and computing Legendre polynomials.
     std::shared_ptr< LegendreCache > legendreCache_;
 
+    //! Object for computing the Cartesian terms of the expansion (nullptr until first requested).
+    std::shared_ptr< CartesianSphericalHarmonicsRecursion > cartesianRecursion_;
+
+    //! Type of implementation of the summation over degrees and orders of the spherical harmonic field
+    SphericalHarmonicsSummationType summationType_ = standard_spherical_harmonics_summation;
+
 };
 
 //! Spherical coordinate indices.
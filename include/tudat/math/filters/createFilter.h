@@ -207,6 +207,8 @@ public:
      *      variable has to be part of the ConstantParameterReferences enumeration (custom parameters are supported).
      *  \param customConstantParameters Values of the constant parameters \f$ \alpha \f$ and \f$ \kappa \f$, in case the custom_parameters
      *      enumeration is used in the previous field.
+     *  \param numberOfThreads Number of threads over which the evaluation of the sigma points is distributed (see
+     *      UnscentedKalmanFilter::setNumberOfThreads).
      */
     UnscentedKalmanFilterSettings( const DependentMatrix& systemUncertainty,
                                    const DependentMatrix& measurementUncertainty,
@@ -218,12 +220,14 @@ public:
                                    const ConstantParameterReferences constantValueReference = reference_Wan_and_Van_der_Merwe,
                                    const std::pair< DependentVariableType, DependentVariableType > customConstantParameters =
             std::make_pair( static_cast< DependentVariableType >( TUDAT_NAN ),
-                            static_cast< DependentVariableType >( TUDAT_NAN ) ) ) :
+                            static_cast< DependentVariableType >( TUDAT_NAN ) ),
+                                   const int numberOfThreads = 1 ) :
         FilterSettings< IndependentVariableType, DependentVariableType >( unscented_kalman_filter,
                                                                           systemUncertainty, measurementUncertainty,
                                                                           filteringStepSize, initialTime, initialStateVector,
                                                                           initialCovarianceMatrix, integratorSettings ),
-        constantValueReference_( constantValueReference ), customConstantParameters_( customConstantParameters )
+        constantValueReference_( constantValueReference ), customConstantParameters_( customConstantParameters ),
+        numberOfThreads_( numberOfThreads )
     { }
 
     //! Enumeration denoting the reference to use for the alpha and kappa paramters.
@@ -232,6 +236,9 @@ public:
     //! Custom value of the alpha and kappa paramters.
     const std::pair< DependentVariableType, DependentVariableType > customConstantParameters_;
 
+    //! Number of threads over which the evaluation of the sigma points is distributed.
+    const int numberOfThreads_;
+
 };
 
 //! Function to create a filter object with the use of filter settings.
@@ -327,13 +334,16 @@ createFilter( const std::shared_ptr< FilterSettings< IndependentVariableType, De
         }
 
         // Create filter
-        createdFilter = std::make_shared< UnscentedKalmanFilter< IndependentVariableType, DependentVariableType > >(
+        std::shared_ptr< UnscentedKalmanFilter< IndependentVariableType, DependentVariableType > > unscentedKalmanFilter =
+                std::make_shared< UnscentedKalmanFilter< IndependentVariableType, DependentVariableType > >(
                     systemFunction, measurementFunction,
                     unscentedKalmanFilterSettings->systemUncertainty_, unscentedKalmanFilterSettings->measurementUncertainty_,
                     unscentedKalmanFilterSettings->filteringStepSize_, unscentedKalmanFilterSettings->initialTime_,
                     unscentedKalmanFilterSettings->initialStateEstimate_, unscentedKalmanFilterSettings->initialCovarianceEstimate_,
                     unscentedKalmanFilterSettings->integratorSettings_, unscentedKalmanFilterSettings->constantValueReference_,
                     unscentedKalmanFilterSettings->customConstantParameters_ );
+        unscentedKalmanFilter->setNumberOfThreads( unscentedKalmanFilterSettings->numberOfThreads_ );
+        createdFilter = unscentedKalmanFilter;
         break;
     }
     default:
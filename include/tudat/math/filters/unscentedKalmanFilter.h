@@ -23,6 +23,7 @@
 #ifndef TUDAT_UNSCENTED_KALMAN_FILTER_H
 #define TUDAT_UNSCENTED_KALMAN_FILTER_H
 
+#include "tudat/basics/parallelization.h"
 #include "tudat/math/filters/kalmanFilter.h"
 
 namespace tudat
@@ -123,6 +124,14 @@ public:
         augmentedCovarianceMatrix_.block( stateDimension_, stateDimension_, stateDimension_, stateDimension_ ) = systemUncertainty;
         augmentedCovarianceMatrix_.block( 2 * stateDimension_, 2 * stateDimension_,
                                           measurementDimension_, measurementDimension_ ) = measurementUncertainty;
+        sigmaPoints_ = DependentMatrix::Zero( augmentedStateDimension_, numberOfSigmaPoints_ );
+        currentSigmaPoint_ = 0;
+
+        // Create one integrator per sigma point, such that the sigma points can be propagated independently
+        if ( this->isStateToBeIntegrated_ )
+        {
+            createSigmaPointIntegrators( integratorSettings );
+        }
     }
 
     //! Destructor.
@@ -137,55 +146,45 @@ public:
     {
         // Compute sigma points
         computeSigmaPoints( this->aPosterioriStateEstimate_, this->aPosterioriCovarianceEstimate_ );
-        historyOfSigmaPoints_[ this->currentTime_ ] = mapOfSigmaPoints_; // store points
+        historyOfSigmaPoints_[ this->currentTime_ ] = sigmaPoints_; // store points
 
         // Prediction step
-        // Compute series of state estimates based on sigma points
-        std::map< unsigned int, DependentVector > sigmaPointsStateEstimates;
-        for ( sigmaPointConstantIterator_ = mapOfSigmaPoints_.begin( );
-              sigmaPointConstantIterator_ != mapOfSigmaPoints_.end( ); sigmaPointConstantIterator_++ )
+        // Compute series of state estimates based on sigma points (one column per sigma point)
+        DependentMatrix sigmaPointsStateEstimates;
+        computeSigmaPointEstimates( sigmaPointsStateEstimates, stateDimension_,
+                                    [ this ]( const unsigned int sigmaPointIndex )
         {
-            currentSigmaPoint_ = sigmaPointConstantIterator_->first;
-            sigmaPointsStateEstimates[ currentSigmaPoint_ ] = this->predictState(
-                        sigmaPointConstantIterator_->second.segment( 0, stateDimension_ ) );
-        }
+            return predictSigmaPointState( sigmaPointIndex );
+        } );
 
         // Compute the weighted average to find the a-priori state vector
-        DependentVector aPrioriStateEstimate = DependentVector::Zero( stateDimension_ );
-        computeWeightedAverageFromSigmaPointEstimates( aPrioriStateEstimate, sigmaPointsStateEstimates );
+        DependentVector aPrioriStateEstimate = computeWeightedAverageFromSigmaPointEstimates( sigmaPointsStateEstimates );
 
         // Compute the weighted average to find the a-priori covariance matrix
-        DependentMatrix aPrioriCovarianceEstimate = DependentMatrix::Zero( stateDimension_, stateDimension_ );
-        computeWeightedAverageFromSigmaPointEstimates( aPrioriCovarianceEstimate, aPrioriStateEstimate, sigmaPointsStateEstimates );
+        DependentMatrix stateDeviations = sigmaPointsStateEstimates.colwise( ) - aPrioriStateEstimate;
+        DependentMatrix aPrioriCovarianceEstimate =
+                computeWeightedAverageFromSigmaPointDeviations( stateDeviations, stateDeviations );
 
         // Re-compute sigma points
         computeSigmaPoints( aPrioriStateEstimate, aPrioriCovarianceEstimate );
 
-        // Compute series of measurement estimates based on sigma points
-        std::map< unsigned int, DependentVector > sigmaPointsMeasurementEstimates;
-        for ( sigmaPointConstantIterator_ = mapOfSigmaPoints_.begin( );
-              sigmaPointConstantIterator_ != mapOfSigmaPoints_.end( ); sigmaPointConstantIterator_++ )
+        // Compute series of measurement estimates based on sigma points (one column per sigma point)
+        DependentMatrix sigmaPointsMeasurementEstimates;
+        computeSigmaPointEstimates( sigmaPointsMeasurementEstimates, measurementDimension_,
+                                    [ this ]( const unsigned int sigmaPointIndex )
         {
-            currentSigmaPoint_ = sigmaPointConstantIterator_->first;
-            sigmaPointsMeasurementEstimates[ currentSigmaPoint_ ] = this->measurementFunction_(
-                        this->currentTime_, sigmaPointConstantIterator_->second.segment( 0, stateDimension_ ) );
-        }
+            return computeSigmaPointMeasurement( sigmaPointIndex );
+        } );
 
         // Compute the weighted average to find the expected measurement vector
-        DependentVector measurementEstimate = DependentVector::Zero( measurementDimension_ );
-        computeWeightedAverageFromSigmaPointEstimates( measurementEstimate, sigmaPointsMeasurementEstimates );
+        DependentVector measurementEstimate = computeWeightedAverageFromSigmaPointEstimates( sigmaPointsMeasurementEstimates );
 
         // Compute innovation and cross-correlation matrices
-        DependentMatrix innovationMatrix = DependentMatrix::Zero( measurementDimension_, measurementDimension_ );
-        computeWeightedAverageFromSigmaPointEstimates( innovationMatrix, measurementEstimate, sigmaPointsMeasurementEstimates );
-        DependentMatrix crossCorrelationMatrix = DependentMatrix::Zero( stateDimension_, measurementDimension_ );
-        for ( sigmaPointConstantIterator_ = sigmaPointsStateEstimates.begin( );
-              sigmaPointConstantIterator_ != sigmaPointsStateEstimates.end( ); sigmaPointConstantIterator_++ )
-        {
-            crossCorrelationMatrix += covarianceEstimationWeights_.at( sigmaPointConstantIterator_->first ) *
-                    ( sigmaPointConstantIterator_->second - aPrioriStateEstimate ) *
-                    ( sigmaPointsMeasurementEstimates[ sigmaPointConstantIterator_->first ] - measurementEstimate ).transpose( );
-        }
+        DependentMatrix measurementDeviations = sigmaPointsMeasurementEstimates.colwise( ) - measurementEstimate;
+        DependentMatrix innovationMatrix =
+                computeWeightedAverageFromSigmaPointDeviations( measurementDeviations, measurementDeviations );
+        DependentMatrix crossCorrelationMatrix =
+                computeWeightedAverageFromSigmaPointDeviations( stateDeviations, measurementDeviations );
 
         // Compute Kalman gain
         DependentMatrix kalmanGain = crossCorrelationMatrix * innovationMatrix.inverse( );
@@ -203,23 +202,26 @@ public:
      */
     std::map< IndependentVariableType, DependentMatrix > getHistoryOfSigmaPoints( )
     {
-        // Convert map of maps into map of Eigen::Matrix
-        DependentVector vectorOfSigmaPoints;
-        std::map< IndependentVariableType, DependentMatrix > mapOfSigmaPointsHistory;
-        for ( typename std::map< IndependentVariableType, std::map< unsigned int, DependentVector > >::const_iterator
-              mapIterator = historyOfSigmaPoints_.begin( ); mapIterator != historyOfSigmaPoints_.end( ); mapIterator++ )
-        {
-            // Extract current map of sigma points and turn it into a vector
-            vectorOfSigmaPoints = utilities::createConcatenatedEigenMatrixFromMapValues( mapIterator->second );
+        return historyOfSigmaPoints_;
+    }
 
-            // Reshape the vector into a matrix and store it into the output map
-            Eigen::Map< Eigen::MatrixXd > matrixOfSigmaPoints( vectorOfSigmaPoints.data( ),
-                                                               augmentedStateDimension_, numberOfSigmaPoints_ );
-            mapOfSigmaPointsHistory[ mapIterator->first ] = matrixOfSigmaPoints;
+    //! Function to set the number of threads over which the sigma points are distributed.
+    /*!
+     *  Function to set the number of threads over which the evaluation of the system and measurement functions for the
+     *  sigma points is distributed (one task per sigma point). If more than one thread is used, the system and measurement
+     *  functions input by the user are called concurrently, and must therefore be thread-safe.
+     *  \param numberOfThreads Number of threads to use (sigma points are evaluated serially for a value of 1).
+     */
+    void setNumberOfThreads( const int numberOfThreads )
+    {
+        if ( numberOfThreads > 1 )
+        {
+            parallelTaskPool_ = std::make_shared< utilities::ParallelTaskPool >( numberOfThreads );
+        }
+        else
+        {
+            parallelTaskPool_ = nullptr;
         }
-
-        // Give output
-        return mapOfSigmaPointsHistory;
     }
 
 private:
@@ -236,7 +238,7 @@ private:
                                           const DependentVector& currentStateVector )
     {
         return inputSystemFunction_( currentTime, currentStateVector ) +
-                mapOfSigmaPoints_[ currentSigmaPoint_ ].segment( stateDimension_, stateDimension_ ); // add system noise
+                sigmaPoints_.block( stateDimension_, currentSigmaPoint_, stateDimension_, 1 ); // add system noise
     }
 
     //! Function to create the function that defines the system model.
@@ -251,7 +253,98 @@ private:
                                                const DependentVector& currentStateVector )
     {
         return inputMeasurementFunction_( currentTime, currentStateVector ) +
-                mapOfSigmaPoints_[ currentSigmaPoint_ ].segment( 2 * stateDimension_, measurementDimension_ ); // add measurement noise
+                sigmaPoints_.block( 2 * stateDimension_, currentSigmaPoint_, measurementDimension_, 1 ); // add measurement noise
+    }
+
+    //! Function to create the integrators used to propagate the individual sigma points.
+    /*!
+     *  Function to create the integrators used to propagate the individual sigma points. Each integrator uses the system
+     *  function input by the user, to which the system noise of its own sigma point is added. Since the integrators share
+     *  no data, the sigma points can be propagated concurrently.
+     *  \param integratorSettings Pointer to integration settings.
+     */
+    void createSigmaPointIntegrators( const std::shared_ptr< IntegratorSettings > integratorSettings )
+    {
+        sigmaPointIntegrators_.resize( numberOfSigmaPoints_ );
+        for ( unsigned int i = 0; i < numberOfSigmaPoints_; i++ )
+        {
+            Function sigmaPointSystemFunction = [ this, i ]( const IndependentVariableType currentTime,
+                    const DependentVector& currentStateVector ) -> DependentVector
+            {
+                return inputSystemFunction_( currentTime, currentStateVector ) +
+                        sigmaPoints_.block( stateDimension_, i, stateDimension_, 1 ); // add system noise
+            };
+            sigmaPointIntegrators_.at( i ) = numerical_integrators::createIntegrator< IndependentVariableType, DependentVector >(
+                        sigmaPointSystemFunction, this->aPosterioriStateEstimate_, this->currentTime_, integratorSettings );
+            if ( integratorSettings->integratorType_ == numerical_integrators::rungeKuttaVariableStepSize )
+            {
+                sigmaPointIntegrators_.at( i )->setStepSizeControl( false );
+            }
+        }
+    }
+
+    //! Function to predict the state for the next time step, starting from one of the sigma points.
+    /*!
+     *  Function to predict the state for the next time step, starting from one of the sigma points, with either the
+     *  integrator of the sigma point, or the system function input by the user (with the system noise of the sigma point
+     *  added).
+     *  \param sigmaPointIndex Index of the sigma point.
+     *  \return Predicted state at the next time step.
+     */
+    DependentVector predictSigmaPointState( const unsigned int sigmaPointIndex )
+    {
+        if ( this->isStateToBeIntegrated_ )
+        {
+            sigmaPointIntegrators_.at( sigmaPointIndex )->modifyCurrentIntegrationVariables(
+                        sigmaPoints_.block( 0, sigmaPointIndex, stateDimension_, 1 ), this->currentTime_ );
+            return sigmaPointIntegrators_.at( sigmaPointIndex )->performIntegrationStep( this->filteringStepSize_ );
+        }
+        else
+        {
+            return inputSystemFunction_( this->currentTime_, sigmaPoints_.block( 0, sigmaPointIndex, stateDimension_, 1 ) ) +
+                    sigmaPoints_.block( stateDimension_, sigmaPointIndex, stateDimension_, 1 ); // add system noise
+        }
+    }
+
+    //! Function to compute the measurement estimate for one of the sigma points.
+    /*!
+     *  Function to compute the measurement estimate for one of the sigma points, with the measurement function input by
+     *  the user (with the measurement noise of the sigma point added).
+     *  \param sigmaPointIndex Index of the sigma point.
+     *  \return Estimated measurement.
+     */
+    DependentVector computeSigmaPointMeasurement( const unsigned int sigmaPointIndex )
+    {
+        return inputMeasurementFunction_( this->currentTime_, sigmaPoints_.block( 0, sigmaPointIndex, stateDimension_, 1 ) ) +
+                sigmaPoints_.block( 2 * stateDimension_, sigmaPointIndex, measurementDimension_, 1 ); // add measurement noise
+    }
+
+    //! Function to compute a function of each of the sigma points, optionally distributed over multiple threads.
+    /*!
+     *  Function to compute a function of each of the sigma points (e.g., the predicted state or the estimated
+     *  measurement), optionally distributed over multiple threads (see setNumberOfThreads).
+     *  \param sigmaPointEstimates Matrix in which the estimates are stored, one column per sigma point (returned by reference).
+     *  \param estimateDimension Size of the estimate of a single sigma point.
+     *  \param estimateFunction Function computing the estimate of a single sigma point, with the sigma point index as input.
+     */
+    void computeSigmaPointEstimates( DependentMatrix& sigmaPointEstimates, const unsigned int estimateDimension,
+                                     const std::function< DependentVector( const unsigned int ) >& estimateFunction )
+    {
+        sigmaPointEstimates.resize( estimateDimension, numberOfSigmaPoints_ );
+        if ( parallelTaskPool_ != nullptr )
+        {
+            parallelTaskPool_->executeTasks( static_cast< int >( numberOfSigmaPoints_ ), [ & ]( const int sigmaPointIndex )
+            {
+                sigmaPointEstimates.col( sigmaPointIndex ) = estimateFunction( sigmaPointIndex );
+            } );
+        }
+        else
+        {
+            for ( unsigned int i = 0; i < numberOfSigmaPoints_; i++ )
+            {
+                sigmaPointEstimates.col( i ) = estimateFunction( i );
+            }
+        }
     }
 
     //! Function to clear the history of stored variables for derived class-specific variables.
@@ -340,67 +433,40 @@ private:
             }
         }
 
-        // Loop over sigma points and assign value
-        for ( unsigned int i = 0; i < numberOfSigmaPoints_; i++ )
-        {
-            if ( i == 0 )
-            {
-                mapOfSigmaPoints_[ i ] = augmentedStateVector_;
-            }
-            else if ( i < ( augmentedCovarianceMatrixSquareRoot.cols( ) + 1 ) )
-            {
-                mapOfSigmaPoints_[ i ] = augmentedStateVector_ + constantParameters_.at( gamma_index ) *
-                        augmentedCovarianceMatrixSquareRoot.col( i - 1 );
-            }
-            else
-            {
-                mapOfSigmaPoints_[ i ] = augmentedStateVector_ - constantParameters_.at( gamma_index ) *
-                        augmentedCovarianceMatrixSquareRoot.col( ( i - 1 ) - augmentedCovarianceMatrixSquareRoot.cols( ) );
-            }
-        }
+        // Assign sigma points: central point, followed by the points on either side along each square-root column
+        const unsigned int numberOfColumns = augmentedCovarianceMatrixSquareRoot.cols( );
+        const DependentMatrix scaledSquareRoot = constantParameters_.at( gamma_index ) * augmentedCovarianceMatrixSquareRoot;
+        sigmaPoints_.col( 0 ) = augmentedStateVector_;
+        sigmaPoints_.middleCols( 1, numberOfColumns ) = scaledSquareRoot.colwise( ) + augmentedStateVector_;
+        sigmaPoints_.middleCols( 1 + numberOfColumns, numberOfColumns ) =
+                ( -scaledSquareRoot ).colwise( ) + augmentedStateVector_;
     }
 
     //! Function to compute the weighted average of the state and measurement vectors.
     /*!
-     *  Function to compute the weighted average of the state and measurement vectors.
-     *  \param weightedAverageVector Vector to which the weighted average is added (initially set to zero).
-     *  \param sigmaPointEstimates Map of the sigma points generated by the computeSigmaPoints function.
+     *  Function to compute the weighted average of the state and measurement vectors, as a matrix-vector product.
+     *  \param sigmaPointEstimates Matrix of state or measurement estimates, one column per sigma point.
      *  \return Weighted average of the state or measurement vector, i.e., the new a-priori state and the
-     *      measurement estimates (returned by reference).
+     *      measurement estimates.
      */
-    void computeWeightedAverageFromSigmaPointEstimates( DependentVector& weightedAverageVector,
-                                                        const std::map< unsigned int, DependentVector >& sigmaPointEstimates )
+    DependentVector computeWeightedAverageFromSigmaPointEstimates( const DependentMatrix& sigmaPointEstimates )
     {
-        // Loop over each sigma point
-        for ( sigmaPointConstantIterator_ = sigmaPointEstimates.begin( );
-              sigmaPointConstantIterator_ != sigmaPointEstimates.end( ); sigmaPointConstantIterator_++ )
-        {
-            weightedAverageVector += stateEstimationWeights_.at( sigmaPointConstantIterator_->first ) *
-                    sigmaPointConstantIterator_->second;
-        }
+        return sigmaPointEstimates * stateEstimationWeights_;
     }
 
-    //! Function to compute the weighted average of the covariance and innovation matrices.
+    //! Function to compute the weighted average of the covariance, innovation and cross-correlation matrices.
     /*!
-     *  Function to compute the weighted average of the covariance and innovation matrices.
-     *  \param weightedAverageMatrix Matrix to which the weighted average is added (initially set to zero).
-     *  \param referenceVector Vector representing the a-priori state or measurement estimates.
-     *  \param sigmaPointEstimates Map of the sigma points generated by the computeSigmaPoints function.
-     *  \return Weighted average of the covariance and innovation matrices, i.e., the new a-priori covariance and the
-     *      innovation estimates (returned by reference).
+     *  Function to compute the weighted average of the covariance, innovation and cross-correlation matrices, as a matrix
+     *  product of the deviations of the sigma point estimates w.r.t. their weighted average.
+     *  \param firstDeviations Deviations of the first set of estimates (state or measurement), one column per sigma point.
+     *  \param secondDeviations Deviations of the second set of estimates (state or measurement), one column per sigma point.
+     *  \return Weighted average of the outer products of the deviations, i.e., the new a-priori covariance, the
+     *      innovation or the cross-correlation estimates.
      */
-    void computeWeightedAverageFromSigmaPointEstimates( DependentMatrix& weightedAverageMatrix,
-                                                        const DependentVector& referenceVector,
-                                                        const std::map< unsigned int, DependentVector >& sigmaPointEstimates )
+    DependentMatrix computeWeightedAverageFromSigmaPointDeviations( const DependentMatrix& firstDeviations,
+                                                                    const DependentMatrix& secondDeviations )
     {
-        // Loop over each sigma point
-        for ( sigmaPointConstantIterator_ = sigmaPointEstimates.begin( );
-              sigmaPointConstantIterator_ != sigmaPointEstimates.end( ); sigmaPointConstantIterator_++ )
-        {
-            weightedAverageMatrix += covarianceEstimationWeights_.at( sigmaPointConstantIterator_->first ) *
-                    ( sigmaPointConstantIterator_->second - referenceVector ) *
-                    ( sigmaPointConstantIterator_->second - referenceVector ).transpose( );
-        }
+        return firstDeviations * covarianceEstimationWeights_.asDiagonal( ) * secondDeviations.transpose( );
     }
 
     //! Function to correct the covariance for the next time step.
@@ -443,10 +509,10 @@ private:
     std::vector< DependentVariableType > constantParameters_;
 
     //! Vector of weights used for the computation of the weighted average of the state and measurement vectors.
-    std::vector< DependentVariableType > stateEstimationWeights_;
+    DependentVector stateEstimationWeights_;
 
     //! Vector of weights used for the computation of the weighted average of the covariance and innovation matrices.
-    std::vector< DependentVariableType > covarianceEstimationWeights_;
+    DependentVector covarianceEstimationWeights_;
 
     //! Augmented state vector.
     /*!
@@ -462,27 +528,30 @@ private:
      */
     DependentMatrix augmentedCovarianceMatrix_;
 
-    //! Map of sigma points.
+    //! Matrix of sigma points.
     /*!
-     *  Map of sigma points, as output by the computeSigmaPoints function. See the description of this function for more
-     *  details of the sigma points and their use.
+     *  Matrix of sigma points (one augmented state per column), as output by the computeSigmaPoints function. See the
+     *  description of this function for more details of the sigma points and their use.
      */
-    std::map< unsigned int, DependentVector > mapOfSigmaPoints_;
-
-    //! Map of map of sigma points, used to store the history of sigma points.
-    std::map< IndependentVariableType, std::map< unsigned int, DependentVector > > historyOfSigmaPoints_;
+    DependentMatrix sigmaPoints_;
 
-    //! Constant iterator to loop over sigma points (introduced for convenience).
-    typename std::map< unsigned int, DependentVector >::const_iterator sigmaPointConstantIterator_;
+    //! Map of matrices of sigma points, used to store the history of sigma points.
+    std::map< IndependentVariableType, DependentMatrix > historyOfSigmaPoints_;
 
     //! Integer specifying current sigma point.
     /*!
-     *  Integer specifying current sigma point, while iterating over the mapOfSigmaPoints_. This parameter is specifically used
-     *  when evaluating the systemFunction_ and measurementFunction_, such that the correct value of system and measurement
-     *  noise can be added.
+     *  Integer specifying the sigma point of which the system and measurement noise are added when evaluating the
+     *  systemFunction_ and measurementFunction_ of the base class. The sigma points themselves are evaluated with
+     *  predictSigmaPointState and computeSigmaPointMeasurement, which take the index of the sigma point as input.
      */
     unsigned int currentSigmaPoint_;
 
+    //! Integrators used to propagate the individual sigma points (empty if the system function is not integrated).
+    std::vector< std::shared_ptr< Integrator > > sigmaPointIntegrators_;
+
+    //! Thread pool over which the sigma points are distributed (nullptr if they are evaluated serially).
+    std::shared_ptr< utilities::ParallelTaskPool > parallelTaskPool_;
+
 };
 
 //! Typedef for a filter with double data type.
@@ -558,14 +627,12 @@ template< typename IndependentVariableType, typename DependentVariableType >
 void UnscentedKalmanFilter< IndependentVariableType, DependentVariableType >::generateEstimationWeights( )
 {
     // Generate state and covariance estimation weights
-    stateEstimationWeights_.push_back( constantParameters_.at( lambda_index ) /
-                                       ( augmentedStateDimension_ + constantParameters_.at( lambda_index ) ) );
-    for ( unsigned int i = 1; i < numberOfSigmaPoints_; i++ )
-    {
-        stateEstimationWeights_.push_back( 1.0 / ( 2.0 * ( augmentedStateDimension_ + constantParameters_.at( lambda_index ) ) ) );
-    }
+    stateEstimationWeights_ = DependentVector::Constant(
+                numberOfSigmaPoints_, 1.0 / ( 2.0 * ( augmentedStateDimension_ + constantParameters_.at( lambda_index ) ) ) );
+    stateEstimationWeights_( 0 ) = constantParameters_.at( lambda_index ) /
+            ( augmentedStateDimension_ + constantParameters_.at( lambda_index ) );
     covarianceEstimationWeights_ = stateEstimationWeights_;
-    covarianceEstimationWeights_.at( 0 ) += 1.0 - std::pow( constantParameters_.at( alpha_index ), 2 ) +
+    covarianceEstimationWeights_( 0 ) += 1.0 - std::pow( constantParameters_.at( alpha_index ), 2 ) +
             constantParameters_.at( beta_index );
 }
 
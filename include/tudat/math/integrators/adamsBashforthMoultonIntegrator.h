@@ -21,9 +21,11 @@
 #ifndef TUDAT_ADAMS_BASHFORTH_MOULTON_INTEGRATOR_H
 #define TUDAT_ADAMS_BASHFORTH_MOULTON_INTEGRATOR_H
 
-#include <deque>
 #include <algorithm>
 #include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 #include <memory>
 
@@ -39,6 +41,152 @@ namespace tudat
 namespace numerical_integrators
 {
 
+//! Fixed-capacity ring buffer storing the history of a multi-step integrator, with the most recent entry at index 0
+/*!
+ * Fixed-capacity ring buffer storing the history of states (or state derivatives) of a multi-step integrator, with the
+ * most recent entry at index 0. The storage of the entries is allocated once, and re-used when entries are added and
+ * removed, so that (for dynamically sized state types) no heap allocations are needed once each slot has been assigned a
+ * value of the final size. Adding an entry to a full buffer increases its capacity.
+ * \tparam EntryType Type of the entries (state or state derivative)
+ */
+template< typename EntryType >
+class IntegrationHistoryBuffer
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param capacity Initial number of entries for which storage is allocated
+     */
+    IntegrationHistoryBuffer( const unsigned int capacity = 1 ):
+        entries_( std::max( capacity, 1u ) ), startIndex_( 0 ), size_( 0 ){ }
+
+    //! Function to retrieve the number of entries in the history
+    unsigned int size( ) const
+    {
+        return size_;
+    }
+
+    //! Function to retrieve the entry at a given index (0 is the most recent entry)
+    const EntryType& at( const unsigned int index ) const
+    {
+        if( index >= size_ )
+        {
+            throw std::out_of_range( "Error when retrieving entry " + std::to_string( index ) +
+                                     " from integration history of size " + std::to_string( size_ ) );
+        }
+        return entries_[ ( startIndex_ + index ) % entries_.size( ) ];
+    }
+
+    //! Function to retrieve the entry at a given index (0 is the most recent entry), which may be modified
+    EntryType& at( const unsigned int index )
+    {
+        return const_cast< EntryType& >( static_cast< const IntegrationHistoryBuffer& >( *this ).at( index ) );
+    }
+
+    //! Function to retrieve the most recent entry
+    const EntryType& front( ) const
+    {
+        return at( 0 );
+    }
+
+    //! Function to retrieve the oldest entry
+    const EntryType& back( ) const
+    {
+        return at( size_ - 1 );
+    }
+
+    //! Function to add an entry as the most recent entry, returning the (re-used) storage that is to be assigned by the caller
+    EntryType& pushFront( )
+    {
+        if( size_ == entries_.size( ) )
+        {
+            increaseCapacity( );
+        }
+        startIndex_ = ( startIndex_ + entries_.size( ) - 1 ) % entries_.size( );
+        size_++;
+        return entries_[ startIndex_ ];
+    }
+
+    //! Function to add an entry as the most recent entry
+    void pushFront( const EntryType& entry )
+    {
+        pushFront( ) = entry;
+    }
+
+    //! Function to add an entry as the oldest entry, returning the (re-used) storage that is to be assigned by the caller
+    EntryType& pushBack( )
+    {
+        if( size_ == entries_.size( ) )
+        {
+            increaseCapacity( );
+        }
+        size_++;
+        return entries_[ ( startIndex_ + size_ - 1 ) % entries_.size( ) ];
+    }
+
+    //! Function to add an entry as the oldest entry
+    void pushBack( const EntryType& entry )
+    {
+        pushBack( ) = entry;
+    }
+
+    //! Function to remove the most recent entry
+    void popFront( )
+    {
+        if( size_ > 0 )
+        {
+            startIndex_ = ( startIndex_ + 1 ) % entries_.size( );
+            size_--;
+        }
+    }
+
+    //! Function to remove the oldest entries, such that at most a given number of entries remains
+    void truncate( const unsigned int maximumSize )
+    {
+        size_ = std::min( size_, maximumSize );
+    }
+
+    //! Function to remove all entries (storage is retained)
+    void clear( )
+    {
+        startIndex_ = 0;
+        size_ = 0;
+    }
+
+    //! Function to swap the contents of two buffers (without copying the entries)
+    void swap( IntegrationHistoryBuffer& otherBuffer )
+    {
+        entries_.swap( otherBuffer.entries_ );
+        std::swap( startIndex_, otherBuffer.startIndex_ );
+        std::swap( size_, otherBuffer.size_ );
+    }
+
+private:
+
+    //! Function to double the capacity of the buffer, retaining the entries
+    void increaseCapacity( )
+    {
+        std::vector< EntryType > newEntries( 2 * entries_.size( ) );
+        for( unsigned int i = 0; i < size_; i++ )
+        {
+            std::swap( newEntries[ i ], entries_[ ( startIndex_ + i ) % entries_.size( ) ] );
+        }
+        entries_.swap( newEntries );
+        startIndex_ = 0;
+    }
+
+    //! Storage of the entries (ring buffer, entry i is at index ( startIndex_ + i ) modulo the capacity)
+    std::vector< EntryType > entries_;
+
+    //! Index in entries_ of the most recent entry
+    unsigned int startIndex_;
+
+    //! Number of entries in the history
+    unsigned int size_;
+};
+
 //! Adams-Bashforth-Moulton Variable Order and Stepsize integrator.
 /*!
  * Class that implements the Adams-Bashforth-Moulton integrator, variable order, variable
@@ -141,10 +289,17 @@ public:
 
 
         
-        // Start filling the state and state derivative history deques.
-        stateHistory_.push_front( currentState_ );
-        derivHistory_.push_front( this->stateDerivativeFunction_(
-                                      currentIndependentVariable_, currentState_ ));
+        // Allocate the state and state derivative histories for the maximum order that is supported by the coefficients
+        // (twice the order to facilitate doubling, plus the new state and the state re-inserted upon rollback)
+        unsigned int historyCapacity = 2 * 12 + 2;
+        stateHistory_ = IntegrationHistoryBuffer< StateType >( historyCapacity );
+        derivHistory_ = IntegrationHistoryBuffer< StateType >( historyCapacity );
+        temporaryStateHistory_ = IntegrationHistoryBuffer< StateType >( historyCapacity );
+        temporaryDerivativeHistory_ = IntegrationHistoryBuffer< StateType >( historyCapacity );
+
+        // Start filling the state and state derivative histories.
+        stateHistory_.pushFront( currentState_ );
+        derivHistory_.pushFront( ) = this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ );
     }
 
     //! Default constructor.
@@ -183,8 +338,8 @@ public:
               minimumStepSize,
               maximumStepSize,
               initialStepSize,
-              StateType::Constant( initialState.rows( ), initialState.cols( ), std::fabs( relativeErrorTolerance ) ),
-              StateType::Constant( initialState.rows( ), initialState.cols( ), std::fabs( absoluteErrorTolerance ) ),
+              StateType::Constant( initialState.rows( ), initialState.cols( ), std::fabs( static_cast< double >( relativeErrorTolerance ) ) ),
+              StateType::Constant( initialState.rows( ), initialState.cols( ), std::fabs( static_cast< double >( absoluteErrorTolerance ) ) ),
               bandwidth ) { }
     
     ~AdamsBashforthMoultonIntegrator( ){ }
@@ -248,17 +403,11 @@ public:
         // If stepSize is not same as old, clear the step-size dependent histories.
         if ( stepSize != stepSize_ )
         {
-            // Pop all values from the history deque (the history is
+            // Pop all values from the history (the history is
             // invalid as it is dependent on the stepSize), except for
             // the current state and state derivative.
-            while ( stateHistory_.size( ) > 1 )
-            {
-                stateHistory_.pop_back( );
-            }
-            while ( derivHistory_.size( ) > 1 )
-            {
-                derivHistory_.pop_back( );
-            }
+            stateHistory_.truncate( 1 );
+            derivHistory_.truncate( 1 );
             stepSize_ = stepSize;
         }
         return performIntegrationStep( );
@@ -281,20 +430,15 @@ public:
 
         // Remove old elements so enough are left to calculate predicted and corrected.
         // max twice the order, to facilitatie a doubling, halving, and order change.
-        while ( stateHistory_.size( ) > order_ * 2 )
-        {
-            stateHistory_.pop_back( );
-        }
-        while ( derivHistory_.size( ) > order_ * 2 )
-        {
-            derivHistory_.pop_back( );
-        }
+        stateHistory_.truncate( order_ * 2 );
+        derivHistory_.truncate( order_ * 2 );
         unsigned int sizeStateHistory = stateHistory_.size( );
         unsigned int sizeDerivativeHistory = derivHistory_.size( );
         unsigned int possibleOrder = std::min( sizeStateHistory, sizeDerivativeHistory );
 
-        StateType correctedState;
-        StateType predictedState;
+        // Pre-allocated work variables (re-used between steps)
+        StateType& correctedState = correctedState_;
+        StateType& predictedState = predictedState_;
 
         // Check if enough history steps are available to perform AM
         // step if not use a single-step method.
@@ -304,28 +448,28 @@ public:
         }
         else
         {
-            StateType predictedState = performPredictorStep( order_, false );
+            performPredictorStep( order_, false, predictedState );
             predictedDerivative_ = this->stateDerivativeFunction_( currentIndependentVariable_ +
                                                                    stepSize_, predictedState );
-            correctedState  = performCorrectorStep( predictedState, order_, false );
-            absoluteError_ = estimateAbsoluteError( predictedState, correctedState, order_ );
-            relativeError_ = estimateRelativeError( predictedState, correctedState, absoluteError_ );
+            performCorrectorStep( predictedState, order_, false, correctedState );
+            estimateAbsoluteError( predictedState, correctedState, order_, absoluteError_ );
+            estimateRelativeError( predictedState, correctedState, absoluteError_, relativeError_ );
         }
 
         // Change order to one that gives a higher predicted accuracy
         // Add tolenaces
-        StateType predictorAbsoluteError;
-        StateType predictorRelativeError;
+        StateType& predictorAbsoluteError = predictorAbsoluteError_;
+        StateType& predictorRelativeError = predictorRelativeError_;
         
         // If order is not fixed, order is not max yet and enough
         // history is available, then predict the error of an order
         // more.
         if ( !fixedOrder_ && order_ < maximumOrder_ && order_ < possibleOrder )
         {
-            predictedState = performPredictorStep( order_ + 1, false );
-            correctedState = performCorrectorStep( predictedState, order_ + 1, false );
-            predictorAbsoluteError = estimateAbsoluteError( predictedState, correctedState, order_ + 1 );
-            predictorRelativeError = estimateRelativeError( predictedState, correctedState, predictorAbsoluteError );
+            performPredictorStep( order_ + 1, false, predictedState );
+            performCorrectorStep( predictedState, order_ + 1, false, correctedState );
+            estimateAbsoluteError( predictedState, correctedState, order_ + 1, predictorAbsoluteError );
+            estimateRelativeError( predictedState, correctedState, predictorAbsoluteError, predictorRelativeError );
 
             // If the predicted error is less than the current error,
             // increase the error.
@@ -340,10 +484,10 @@ public:
         }
         else if ( !fixedOrder_ && order_ > minimumOrder_ && order_ - 1 <= possibleOrder )
         {
-            predictedState = performPredictorStep( order_ - 1, false );
-            correctedState = performCorrectorStep( predictedState, order_ - 1, false );
-            predictorAbsoluteError = estimateAbsoluteError( predictedState, correctedState, order_ - 1 );
-            predictorRelativeError = estimateRelativeError( predictedState, correctedState, predictorAbsoluteError );
+            performPredictorStep( order_ - 1, false, predictedState );
+            performCorrectorStep( predictedState, order_ - 1, false, correctedState );
+            estimateAbsoluteError( predictedState, correctedState, order_ - 1, predictorAbsoluteError );
+            estimateRelativeError( predictedState, correctedState, predictorAbsoluteError, predictorRelativeError );
             // If it is less than the current order, lower the order.
             if ( errorCompare( predictorAbsoluteError, predictorRelativeError, absoluteError_, relativeError_ ) )
             {
@@ -365,11 +509,13 @@ public:
         if ( errorTooLarge( predictorAbsoluteError, predictorRelativeError )
              && std::fabs( stepSize_ / 2.0 )> minimumStepSize_ && !fixedStepSize_ )
         {
-            // Set up new data for halving
-            std::deque< StateType > tempStateHistory;
-            std::deque< StateType > tempDerivativeHistory;
-            StateType midState = currentState_;
-            StateDerivativeType midDerivative = midState;
+            this->numberOfRejectedSteps_++;
+
+            // Set up new data for halving (in pre-allocated history)
+            IntegrationHistoryBuffer< StateType >& tempStateHistory = temporaryStateHistory_;
+            IntegrationHistoryBuffer< StateType >& tempDerivativeHistory = temporaryDerivativeHistory_;
+            tempStateHistory.clear( );
+            tempDerivativeHistory.clear( );
             unsigned int interpolationStateIndex;
             unsigned int interpolationDerivativeIndex;
 
@@ -391,11 +537,13 @@ public:
                 // If states are even, they already exist, no need to interpolate
                 if ( i % 2 == 0 )
                 {
-                    tempStateHistory.push_back( stateHistory_.at( i / 2 ));
-                    tempDerivativeHistory.push_back( derivHistory_.at( i / 2 ));
+                    tempStateHistory.pushBack( stateHistory_.at( i / 2 ));
+                    tempDerivativeHistory.pushBack( derivHistory_.at( i / 2 ));
                 } else {
                     // Reset midpoint state and deriv to zero
-                    midState = 0 * midState;
+                    StateType& midState = tempStateHistory.pushBack( );
+                    StateType& midDerivative = tempDerivativeHistory.pushBack( );
+                    midState = 0 * currentState_;
                     midDerivative = midState;
                     interpolationDerivativeIndex = ( order_ - 1 ) * ( order_ - 1 ) + ( i - 1 ) / 2;
                     interpolationStateIndex = interpolationDerivativeIndex - order_ + 1;
@@ -409,14 +557,12 @@ public:
                                 + interpolationCoefficients[ interpolationDerivativeIndex ][ order_ + j ] *
                                 derivHistory_.at( j );
                     }
-                    tempStateHistory.push_back( midState );
-                    tempDerivativeHistory.push_back( midDerivative );
                 }
             }
             
             // Set the new history and stepsize
-            stateHistory_ = tempStateHistory;
-            derivHistory_ = tempDerivativeHistory;
+            stateHistory_.swap( tempStateHistory );
+            derivHistory_.swap( tempDerivativeHistory );
             stepSize_ = stepSize_ / 2.0;
             
             // Temporarily turn halving off.
@@ -445,33 +591,36 @@ public:
             //    is neglibile. This assumption saves one function evaluation.
             // It's possible to reuse previously defined variables here except for correctedState
             // which is still used below.
-            predictedState = performPredictorStep( order_ , true );
-            StateType doubleStepCorrectedState = performCorrectorStep( predictedState, order_, true );
-            predictorAbsoluteError = estimateAbsoluteError( predictedState, doubleStepCorrectedState, order_ );
-            predictorRelativeError = estimateRelativeError( predictedState, doubleStepCorrectedState,
-                                                            predictorAbsoluteError );
+            performPredictorStep( order_ , true, predictedState );
+            StateType& doubleStepCorrectedState = doubleStepCorrectedState_;
+            performCorrectorStep( predictedState, order_, true, doubleStepCorrectedState );
+            estimateAbsoluteError( predictedState, doubleStepCorrectedState, order_, predictorAbsoluteError );
+            estimateRelativeError( predictedState, doubleStepCorrectedState,
+                                   predictorAbsoluteError, predictorRelativeError );
 
             // Only update the history if the error will not be too large
             if ( !errorTooLarge( predictorAbsoluteError, predictorRelativeError ) )
             {
                 // Note that the history should be at least 7 to allow successful
                 // continuation of the AM scheme.
-                std::deque< StateType > tempStateHistory;
-                std::deque< StateType > tempDerivativeHistory;
-                
+                IntegrationHistoryBuffer< StateType >& tempStateHistory = temporaryStateHistory_;
+                IntegrationHistoryBuffer< StateType >& tempDerivativeHistory = temporaryDerivativeHistory_;
+                tempStateHistory.clear( );
+                tempDerivativeHistory.clear( );
+
                 // Use old history to fill new history, skipping every other entry starting at 1
                 for( unsigned int i = 1; i < sizeStateHistory; i += 2 )
                 {
-                    tempStateHistory.push_back( stateHistory_.at( i ));
+                    tempStateHistory.pushBack( stateHistory_.at( i ));
                 }
                 for( unsigned int i = 1; i < sizeDerivativeHistory; i += 2 )
                 {
-                    tempDerivativeHistory.push_back( derivHistory_.at( i ));
+                    tempDerivativeHistory.pushBack( derivHistory_.at( i ));
                 }
                 
                 // Set the new history and stepsize
-                stateHistory_ = tempStateHistory;
-                derivHistory_ = tempDerivativeHistory;
+                stateHistory_.swap( tempStateHistory );
+                derivHistory_.swap( tempDerivativeHistory );
                 stepSize_ = stepSize_ * 2.0;
             }
         } // end if ( errorTooSmall( ...
@@ -479,9 +628,8 @@ public:
         // Move computed state to history
         currentIndependentVariable_ += lastStepSize_;
         currentState_ = correctedState;
-        stateHistory_.push_front( currentState_ );
-        derivHistory_.push_front( this->stateDerivativeFunction_(
-                                      currentIndependentVariable_, currentState_ ) );
+        stateHistory_.pushFront( currentState_ );
+        derivHistory_.pushFront( ) = this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ );
         return currentState_;
     }
 
@@ -501,16 +649,15 @@ public:
         }
         currentIndependentVariable_ = lastIndependentVariable_;
         stepSize_ = lastStepSize_;
-        stateHistory_.push_back( lastState_ );
-        derivHistory_.push_back( lastDerivative_ );
-        stateHistory_.pop_front( );
-        derivHistory_.pop_front( );
-        derivHistory_.pop_front( );
+        stateHistory_.pushBack( lastState_ );
+        derivHistory_.pushBack( lastDerivative_ );
+        stateHistory_.popFront( );
+        derivHistory_.popFront( );
+        derivHistory_.popFront( );
         currentState_ = stateHistory_.front( );
         // Recalculate the derivative in order to make sure that all
         // update functions inside state derivative model get reactivated
-        derivHistory_.push_front( this->stateDerivativeFunction_(
-                                      currentIndependentVariable_, currentState_ ) );
+        derivHistory_.pushFront( ) = this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ );
         return true;
     }
 
@@ -529,8 +676,8 @@ public:
         currentState_ = newState;
 
         // Clear the history and initiate with new state and derivative.
-        stateHistory_[ 0 ] = currentState_;
-        derivHistory_[ 0 ] = this->stateDerivativeFunction_(
+        stateHistory_.at( 0 ) = currentState_;
+        derivHistory_.at( 0 ) = this->stateDerivativeFunction_(
                     currentIndependentVariable_, currentState_ );
         if ( !allowRollback )
         {
@@ -539,12 +686,88 @@ public:
 
     }
 
+    //! Function to retrieve the internal state of the integrator, from which the integration can be continued identically
+    /*!
+     * Function to retrieve the internal state of the integrator, from which the integration can be continued identically
+     * using resetFromCheckpoint. Next to the current and previous state, the current order, order and step size control
+     * flags, and the state and state derivative histories are stored.
+     * \return Internal state of the integrator
+     */
+    NumericalIntegratorCheckpoint< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+    getCheckpoint( ) const
+    {
+        NumericalIntegratorCheckpoint< IndependentVariableType, StateType, StateDerivativeType, TimeStepType > checkpoint;
+        checkpoint.currentIndependentVariable_ = currentIndependentVariable_;
+        checkpoint.currentState_ = currentState_;
+        checkpoint.lastIndependentVariable_ = lastIndependentVariable_;
+        checkpoint.lastState_ = lastState_;
+        checkpoint.stepSize_ = stepSize_;
+
+        checkpoint.additionalIntegerValues_ = { static_cast< int >( order_ ), fixedStepSize_, fixedOrder_,
+                                                static_cast< int >( stateHistory_.size( ) ) };
+        checkpoint.additionalStepSizes_ = { lastStepSize_ };
+        checkpoint.additionalStates_ = { absoluteError_, relativeError_ };
+        for( unsigned int i = 0; i < stateHistory_.size( ); i++ )
+        {
+            checkpoint.additionalStates_.push_back( stateHistory_.at( i ) );
+        }
+        for( unsigned int i = 0; i < derivHistory_.size( ); i++ )
+        {
+            checkpoint.additionalStates_.push_back( derivHistory_.at( i ) );
+        }
+        checkpoint.additionalStateDerivatives_ = { lastDerivative_ };
+        return checkpoint;
+    }
+
+    //! Function to reset the internal state of the integrator to a checkpoint
+    /*!
+     * Function to reset the internal state of the integrator to a checkpoint, as retrieved from getCheckpoint of an
+     * integrator of the same type and settings.
+     * \param checkpoint Internal state of the integrator to which it is to be reset
+     */
+    void resetFromCheckpoint(
+            const NumericalIntegratorCheckpoint< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >& checkpoint )
+    {
+        if( checkpoint.additionalIntegerValues_.size( ) != 4 || checkpoint.additionalStepSizes_.size( ) != 1 ||
+                checkpoint.additionalStateDerivatives_.size( ) != 1 ||
+                checkpoint.additionalStates_.size( ) < 2 + static_cast< unsigned int >( checkpoint.additionalIntegerValues_.at( 3 ) ) )
+        {
+            throw std::runtime_error( "Error when resetting ABM integrator from checkpoint, checkpoint is not compatible" );
+        }
+
+        currentIndependentVariable_ = checkpoint.currentIndependentVariable_;
+        currentState_ = checkpoint.currentState_;
+        lastIndependentVariable_ = checkpoint.lastIndependentVariable_;
+        lastState_ = checkpoint.lastState_;
+        stepSize_ = checkpoint.stepSize_;
+
+        order_ = static_cast< unsigned int >( checkpoint.additionalIntegerValues_.at( 0 ) );
+        fixedStepSize_ = checkpoint.additionalIntegerValues_.at( 1 );
+        fixedOrder_ = checkpoint.additionalIntegerValues_.at( 2 );
+        lastStepSize_ = checkpoint.additionalStepSizes_.at( 0 );
+        absoluteError_ = checkpoint.additionalStates_.at( 0 );
+        relativeError_ = checkpoint.additionalStates_.at( 1 );
+
+        unsigned int numberOfHistoryStates = static_cast< unsigned int >( checkpoint.additionalIntegerValues_.at( 3 ) );
+        stateHistory_.clear( );
+        derivHistory_.clear( );
+        for( unsigned int i = 2; i < 2 + numberOfHistoryStates; i++ )
+        {
+            stateHistory_.pushBack( checkpoint.additionalStates_.at( i ) );
+        }
+        for( unsigned int i = 2 + numberOfHistoryStates; i < checkpoint.additionalStates_.size( ); i++ )
+        {
+            derivHistory_.pushBack( checkpoint.additionalStates_.at( i ) );
+        }
+        lastDerivative_ = checkpoint.additionalStateDerivatives_.at( 0 );
+    }
+
     //! Return maximum truncation error.
     /*!
      * Return the truncation error to be estimated by computError( ).
      * \return Double value of the truncation error.
      */
-    double getMaximumError( ){ return absoluteError_.cwiseMin( relativeError_ ).array( ).maxCoeff( ); }
+    double getMaximumError( ){ return static_cast< double >( absoluteError_.cwiseMin( relativeError_ ).array( ).maxCoeff( ) ); }
 
     //! Return absolute truncation error.
     /*!
@@ -858,7 +1081,7 @@ protected:
         }
         
         // Even if a different step size is suggested, let's stick with the old one, since the goal is to start
-        // filling up the deque at a constant stepsize interval
+        // filling up the history at a constant stepsize interval
         stepSize_ = lastStepSize_; // singleStepIntegrator_.getNextStepSize( );
 
         // Disregard the ABAM error control in the performIntegrationStep function when using single steps.
@@ -873,20 +1096,19 @@ protected:
      * Using the order find predicted estimate using the Adams-Bashforth predictor
      * \param order Order of the integration.
      * \param doubleStep Boolean if stepsize should be considered double, true for estimating doubling error.
-     * \return state after predictor step
+     * \param predictedState State after predictor step (returned by reference)
      */
-    StateType performPredictorStep( unsigned int order, bool doubleStep )
+    void performPredictorStep( unsigned int order, bool doubleStep, StateType& predictedState )
     {
         // Calculate predicted state
         unsigned int stepsToSkip = static_cast< unsigned int>( doubleStep );
         TimeStepType stepSize = stepSize_ * static_cast< double >( stepsToSkip + 1 );
-        StateType predictedState = stateHistory_.at( stepsToSkip );
+        predictedState = stateHistory_.at( stepsToSkip );
         for ( unsigned int i = 0; i < order; i++ )
         {
             predictedState += extrapolationCoefficients[ order * 2 - 2 ][ i ] * stepSize *
                     derivHistory_.at( i * ( stepsToSkip + 1 ) + stepsToSkip );
         }
-        return predictedState;
     }
 
     //! Perform correcter step.
@@ -895,20 +1117,20 @@ protected:
      * \param predictedState by the predictor.
      * \param order of the integration.
      * \param doubleStep boolean if stepsize should be considered double, true for estimating doubling error.
-     * \return  after corrector step
+     * \param correctedState State after corrector step (returned by reference)
      */
-    StateType performCorrectorStep( StateType predictedState, unsigned int order, bool doubleStep )
+    void performCorrectorStep( const StateType& predictedState, unsigned int order, bool doubleStep,
+                               StateType& correctedState )
     {
         unsigned int stepsToSkip = static_cast< unsigned int>( doubleStep );
         TimeStepType stepSize = stepSize_ * static_cast< double >( stepsToSkip + 1 );
-        StateType correctedState = stateHistory_.at( stepsToSkip ) + extrapolationCoefficients[ order * 2 - 1 ][ 0 ] *
+        correctedState = stateHistory_.at( stepsToSkip ) + extrapolationCoefficients[ order * 2 - 1 ][ 0 ] *
                 stepSize * predictedDerivative_;
         for ( unsigned int i = 1; i < order; i++ )
         {
             correctedState += stepSize * extrapolationCoefficients[ order * 2 - 1 ][ i ] *
                     derivHistory_.at( ( i - 1 ) * ( stepsToSkip + 1 ) + stepsToSkip );
         }
-        return correctedState;
     }
 
     //! Estimate the absolute error
@@ -917,12 +1139,13 @@ protected:
      * \param predictedState by the predictor.
      * \param correctedState by the corrector.
      * \param order of the integration.
-     * \return absolute error vector.
+     * \param absoluteError absolute error vector (returned by reference).
      */
-    StateType estimateAbsoluteError( StateType predictedState, StateType correctedState, unsigned int order )
+    void estimateAbsoluteError( const StateType& predictedState, const StateType& correctedState, unsigned int order,
+                                StateType& absoluteError )
     {
         // Estimate the maximum truncation error
-        return truncationErrorCoefficients[ order ] * ( predictedState - correctedState ).cwiseAbs( ).array( );
+        absoluteError = truncationErrorCoefficients[ order ] * ( predictedState - correctedState ).cwiseAbs( ).array( );
     }
 
     //! Estimate the relative error
@@ -931,12 +1154,13 @@ protected:
      * \param predictedState by the predictor.
      * \param correctedState by the corrector.
      * \param absoluteError
-     * \return relative error vector.
+     * \param relativeError relative error vector (returned by reference).
      */
-    StateType estimateRelativeError( StateType predictedState, StateType correctedState, StateType absoluteError )
+    void estimateRelativeError( const StateType& predictedState, const StateType& correctedState,
+                                const StateType& absoluteError, StateType& relativeError )
     {
         // Estimate the maximum truncation error
-        return absoluteError.cwiseQuotient( ( correctedState.cwiseAbs( ) ).cwiseMax( predictedState.cwiseAbs( ) ) );
+        relativeError = absoluteError.cwiseQuotient( ( correctedState.cwiseAbs( ) ).cwiseMax( predictedState.cwiseAbs( ) ) );
     }
 
     //! Compare two errors
@@ -949,17 +1173,17 @@ protected:
      * \param relativeError2 relative error two.
      * \return true if one is better than two, false otherwise.
      */
-    bool errorCompare( StateType absoluteError1, StateType relativeError1,
-                       StateType absoluteError2, StateType relativeError2 )
+    bool errorCompare( const StateType& absoluteError1, const StateType& relativeError1,
+                       const StateType& absoluteError2, const StateType& relativeError2 )
     {
         // Find compound error
-        StateType c1 = absoluteError1.cwiseMin( relativeError1 );
-        StateType c2 = absoluteError2.cwiseMin( relativeError2 );
+        auto c1 = absoluteError1.cwiseMin( relativeError1 );
+        auto c2 = absoluteError2.cwiseMin( relativeError2 );
         bool oneBetter = true;
         if( strictCompare_ )
         {
             // Needs to be better or equal for each component
-            for( int i = 0; i < c1.size( ); ++i )
+            for( int i = 0; i < absoluteError1.size( ); ++i )
             {
                 oneBetter = oneBetter && ( c1( i ) <= c2( i ) );
             }
@@ -978,7 +1202,7 @@ protected:
      * \param relativeError relative error.
      * \return true if one error is too big, false if within limits
      */
-    bool errorTooLarge( StateType absoluteError, StateType relativeError )
+    bool errorTooLarge( const StateType& absoluteError, const StateType& relativeError )
     {
         bool belowLimit = true;
         // All components needs to be below the upper limit (tol)
@@ -999,7 +1223,7 @@ protected:
      * \param relativeError relative error.
      * \return true if one error is too small, false if within limits
      */
-    bool errorTooSmall( StateType absoluteError, StateType relativeError )
+    bool errorTooSmall( const StateType& absoluteError, const StateType& relativeError )
     {
         bool belowLimit = true;
         // All components need to be above lower limit ( tol / bw )
@@ -1023,15 +1247,36 @@ protected:
 
     //! State history.
     /*!
-     * History of states, dynamic deque size depends on order.
+     * History of states (most recent first), number of entries depends on order.
      */
-    std::deque<StateType> stateHistory_;
+    IntegrationHistoryBuffer< StateType > stateHistory_;
 
     //! Derivative history.
     /*!
-     * History of derivatives, dynamic deque size depends on order.
+     * History of derivatives (most recent first), number of entries depends on order.
      */
-    std::deque<StateType> derivHistory_;
+    IntegrationHistoryBuffer< StateType > derivHistory_;
+
+    //! State history used while halving or doubling the step size, swapped with stateHistory_ afterwards.
+    IntegrationHistoryBuffer< StateType > temporaryStateHistory_;
+
+    //! Derivative history used while halving or doubling the step size, swapped with derivHistory_ afterwards.
+    IntegrationHistoryBuffer< StateType > temporaryDerivativeHistory_;
+
+    //! Predicted state of current step (pre-allocated work variable of performIntegrationStep( )).
+    StateType predictedState_;
+
+    //! Corrected state of current step (pre-allocated work variable of performIntegrationStep( )).
+    StateType correctedState_;
+
+    //! Corrected state of doubled step (pre-allocated work variable of performIntegrationStep( )).
+    StateType doubleStepCorrectedState_;
+
+    //! Absolute error of order/step size change (pre-allocated work variable of performIntegrationStep( )).
+    StateType predictorAbsoluteError_;
+
+    //! Relative error of order/step size change (pre-allocated work variable of performIntegrationStep( )).
+    StateType predictorRelativeError_;
 
     //! Last state.
     /*!
@@ -1056,6 +1301,11 @@ extern template class AdamsBashforthMoultonIntegrator < double, Eigen::VectorXd,
 extern template class AdamsBashforthMoultonIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
 extern template class AdamsBashforthMoultonIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
 
+#if( TUDAT_BUILD_WITH_EXTENDED_PRECISION_PROPAGATION_TOOLS )
+extern template class AdamsBashforthMoultonIntegrator < double, VectorXdd, VectorXdd >;
+extern template class AdamsBashforthMoultonIntegrator < Time, VectorXdd, VectorXdd, long double >;
+#endif
+
 
 //! Typedef of Adam-Bashforh-Moulton integrator (state/state derivative = VectorXd, independent variable = double).
 /*!
@@ -12,12 +12,14 @@
 #ifndef TUDAT_BULIRSCH_STOER_VARIABLE_STEP_SIZE_INTEGRATOR_H
 #define TUDAT_BULIRSCH_STOER_VARIABLE_STEP_SIZE_INTEGRATOR_H
 
+#include <algorithm>
 #include <cmath>
 
 #include <boost/assign/std/vector.hpp>
 
 #include <Eigen/Core>
 
+#include <tudat/basics/parallelization.h>
 #include <tudat/math/integrators/stepSizeController.h>
 #include <tudat/math/integrators/numericalIntegrator.h>
 #include <tudat/math/basic/mathematicalConstants.h>
@@ -95,13 +97,7 @@ public:
             stepSizeValidator_( stepSizeValidator )
         {
             maximumStepIndex_ = sequence_.size( ) - 1;
-            subSteps_.resize( maximumStepIndex_ + 1 );
-
-            integratedStates_.resize( maximumStepIndex_ + 1  );
-            for( unsigned int i = 0; i < maximumStepIndex_ + 1 ; i++ )
-            {
-                integratedStates_[ i ].resize( maximumStepIndex_ + 1  );
-            }
+            allocateWorkspace( );
 
             useFixedStep_ = false;
             stepSizeController_->initialize( initialState );
@@ -121,13 +117,7 @@ public:
         stepSizeValidator_( nullptr )
     {
         maximumStepIndex_ = sequence_.size( ) - 1;
-        subSteps_.resize( maximumStepIndex_ + 1 );
-
-        integratedStates_.resize( maximumStepIndex_ + 1  );
-        for( unsigned int i = 0; i < maximumStepIndex_ + 1 ; i++ )
-        {
-            integratedStates_[ i ].resize( maximumStepIndex_ + 1  );
-        }
+        allocateWorkspace( );
 
         useFixedStep_ = true;
     }
@@ -170,13 +160,7 @@ public:
         stepSize_( initialStepSize )
     {
         maximumStepIndex_ = sequence_.size( ) - 1;
-        subSteps_.resize( maximumStepIndex_ + 1 );
-
-        integratedStates_.resize( maximumStepIndex_ + 1  );
-        for( unsigned int i = 0; i < maximumStepIndex_ + 1 ; i++ )
-        {
-            integratedStates_[ i ].resize( maximumStepIndex_ + 1  );
-        }
+        allocateWorkspace( );
 
         useFixedStep_ = false;
         if( ( initialStepSize == minimumStepSize ) && ( initialStepSize == maximumStepSize ) &&
@@ -235,17 +219,12 @@ public:
         sequence_( sequence ), stepSize_( stepSize )
     {
         maximumStepIndex_ = sequence_.size( ) - 1;
-        subSteps_.resize( maximumStepIndex_ + 1 );
-
-        integratedStates_.resize( maximumStepIndex_ + 1  );
-        for( unsigned int i = 0; i < maximumStepIndex_ + 1 ; i++ )
-        {
-            integratedStates_[ i ].resize( maximumStepIndex_ + 1  );
-        }
+        allocateWorkspace( );
 
         useFixedStep_ = false;
         if( ( stepSize == minimumStepSize ) && ( stepSize == maximumStepSize ) &&
-            std::isinf( relativeErrorTolerance ) && std::isinf( absoluteErrorTolerance ) )
+            std::isinf( static_cast< double >( relativeErrorTolerance ) ) &&
+            std::isinf( static_cast< double >( absoluteErrorTolerance ) ) )
         {
             useFixedStep_ = true;
         }
@@ -292,7 +271,10 @@ public:
 
     // Perform a single integration step.
     /*
-     * Perform a single integration step and compute a new step size.
+     * Perform a single integration step and compute a new step size. The modified mid-point sequences are computed
+     * in pre-allocated workspaces, either serially or distributed over the threads set by setNumberOfThreads. If
+     * adaptive order selection is used (see setUseAdaptiveOrder), the number of rows of the extrapolation tableau that
+     * is computed is selected for each step.
      * \param stepSize The step size to take. If the time step is too large to satisfy the error
      *          constraints, the step is redone until the error constraint is satisfied.
      * \return The state at the end of the interval.
@@ -304,12 +286,6 @@ public:
             throw std::runtime_error( "Error in BS integrator, step size is NaN" );
         }
 
-        StateType stateAtFirstPoint_;
-        StateType stateAtCenterPoint_;
-        StateType stateAtLastPoint_;
-
-        bool stepSuccessful = 0;
-
         // Compute sub steps to take.
         for ( unsigned int p = 0; p <  subSteps_.size( ); p++ )
         {
@@ -317,55 +293,57 @@ public:
                         sequence_.at( p ) );
         }
 
-        double errorScaleTerm = TUDAT_NAN;
-        for( unsigned int i = 0; i <= maximumStepIndex_; i++ )
+        // State derivative at start of step is identical for all sequences
+        initialStateDerivative_ = this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ );
+
+        unsigned int acceptedStepIndex = maximumStepIndex_;
+        bool stepSuccessful = false;
+        bool adaptiveOrderUsed = ( parallelTaskPool_ == nullptr ) && useAdaptiveOrder_ && !useFixedStep_ &&
+                ( maximumStepIndex_ > 1 );
+        if( parallelTaskPool_ != nullptr )
         {
-            // Compute Euler step and set as state at center point for use with mid-point method.
-            stateAtCenterPoint_ = currentState_ + subSteps_.at( i )
-                    * this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ );
-
-            // Apply modified mid-point rule.
-            stateAtFirstPoint_ = currentState_;
-            IndependentVariableType independentVariableAtFirstPoint_ = currentIndependentVariable_;
-            for ( unsigned int j = 0; j < sequence_.at( i ) - 1; j++ )
+            // Compute all sequences concurrently, starting with the longest, and extrapolate afterwards
+            parallelTaskPool_->executeTasks(
+                        maximumStepIndex_ + 1, [ this, stepSize ]( const int taskIndex )
             {
-                stateAtLastPoint_ = executeMidPointMethod(
-                            stateAtFirstPoint_, stateAtCenterPoint_,
-                            independentVariableAtFirstPoint_, subSteps_.at( i ) );
+                computeModifiedMidPointSequence( maximumStepIndex_ - taskIndex, stepSize );
+            } );
 
-                if ( j < sequence_.at( i ) - 2 )
-                {
-                    stateAtFirstPoint_ = stateAtCenterPoint_;
-                    stateAtCenterPoint_ = stateAtLastPoint_;
-                    independentVariableAtFirstPoint_ += subSteps_.at( i );
-                }
+            for( unsigned int i = 1; i <= maximumStepIndex_; i++ )
+            {
+                extrapolateTableauRow( i );
             }
-
-            // Apply end-point correction.
-            integratedStates_[ i ][ 0 ]
-                    = 0.5 * ( stateAtLastPoint_ + stateAtCenterPoint_+ subSteps_.at( i ) * this->stateDerivativeFunction_(
-                                  currentIndependentVariable_ + stepSize, stateAtLastPoint_ ) );
-
-            for ( unsigned int k = 1; k < i + 1; k++ )
+        }
+        else if( adaptiveOrderUsed )
+        {
+            stepSuccessful = performAdaptiveOrderExtrapolation( stepSize, acceptedStepIndex );
+        }
+        else
+        {
+            for( unsigned int i = 0; i <= maximumStepIndex_; i++ )
             {
-                integratedStates_[ i ][ k ] =
-                        integratedStates_[ i ][ k - 1 ] + 1.0 /
-                        ( pow( subSteps_.at( i - k ), 2.0 ) / std::pow( subSteps_.at( i ), 2.0 ) - 1.0 )
-                        * ( integratedStates_[ i ][ k - 1 ] - integratedStates_[ i - 1 ][ k - 1 ] );
+                computeModifiedMidPointSequence( i, stepSize );
+                extrapolateTableauRow( i );
             }
         }
 
-        if( computeNextStepSizeAndValidateResult(
-            integratedStates_.at( maximumStepIndex_ ).at( maximumStepIndex_ - 1 ),
-            integratedStates_.at( maximumStepIndex_ ).at( maximumStepIndex_ ), stepSize ) )
+        if( !adaptiveOrderUsed )
+        {
+            stepSuccessful = computeNextStepSizeAndValidateResult(
+                        integratedStates_.at( maximumStepIndex_ ).at( maximumStepIndex_ - 1 ),
+                        integratedStates_.at( maximumStepIndex_ ).at( maximumStepIndex_ ), stepSize );
+        }
+
+        if( stepSuccessful )
         {
             this->lastIndependentVariable_ = this->currentIndependentVariable_;
             this->lastState_ = this->currentState_;
             this->currentIndependentVariable_ += stepSize;
-            currentState_ = integratedStates_[ maximumStepIndex_ ][ maximumStepIndex_ ];
+            currentState_ = integratedStates_[ acceptedStepIndex ][ acceptedStepIndex ];
         }
         else
         {
+            this->numberOfRejectedSteps_++;
             performIntegrationStep( this->stepSize_ );
         }
 
@@ -385,6 +363,7 @@ public:
                 lowerOrderEstimate, higherOrderEstimate, stepSize );
             std::pair< TimeStepType, bool > validatedNewStepSizePair = stepSizeValidator_->validateStep(
                 recommendedNewStepSizePair, stepSize );
+            stepSizeController_->updateStepHistory( validatedNewStepSizePair.second );
 
             this->stepSize_ = validatedNewStepSizePair.first;
             return validatedNewStepSizePair.second;
@@ -440,6 +419,39 @@ public:
         }
     }
 
+    // Set number of threads over which the modified mid-point sequences are distributed.
+    /*
+     * Set number of threads over which the modified mid-point sequences of each step are distributed (one task per
+     * sequence). If more than one thread is used, the state derivative function will be called concurrently, and must
+     * be thread-safe. Adaptive order selection is not used when the sequences are computed concurrently.
+     * \param numberOfThreads Number of threads to use (sequences are computed serially for a value of 1)
+     */
+    void setNumberOfThreads( const int numberOfThreads )
+    {
+        if( numberOfThreads > 1 )
+        {
+            parallelTaskPool_ = std::make_shared< utilities::ParallelTaskPool >( numberOfThreads );
+        }
+        else
+        {
+            parallelTaskPool_ = nullptr;
+        }
+    }
+
+    // Set whether the order of each step is selected adaptively.
+    /*
+     * Set whether the order of each step is selected adaptively (see performAdaptiveOrderExtrapolation). If true, only
+     * the rows of the extrapolation tableau up to the current target row (plus at most one) are computed in each step.
+     * Otherwise, all rows are always computed. Adaptive order selection is not used if the mid-point sequences are
+     * distributed over multiple threads, or if a fixed step size is used. The order used in the step size controller is
+     * temporarily reset for each row, so any (custom) controller must compute its step size estimate from its order
+     * \param useAdaptiveOrder Boolean denoting whether the order of each step is selected adaptively
+     */
+    void setUseAdaptiveOrder( const bool useAdaptiveOrder )
+    {
+        useAdaptiveOrder_ = useAdaptiveOrder;
+    }
+
 private:
 
     // Current independent variable.
@@ -480,6 +492,31 @@ private:
     TimeStepType stepSize_;
 
 
+    // Allocate workspaces for sub steps, extrapolation tableau and modified mid-point sequences.
+    void allocateWorkspace( )
+    {
+        subSteps_.resize( maximumStepIndex_ + 1 );
+
+        integratedStates_.resize( maximumStepIndex_ + 1  );
+        for( unsigned int i = 0; i < maximumStepIndex_ + 1 ; i++ )
+        {
+            integratedStates_[ i ].resize( maximumStepIndex_ + 1  );
+        }
+
+        statesAtFirstPoint_.resize( maximumStepIndex_ + 1 );
+        statesAtCenterPoint_.resize( maximumStepIndex_ + 1 );
+        statesAtLastPoint_.resize( maximumStepIndex_ + 1 );
+
+        recommendedStepSizes_.resize( maximumStepIndex_ + 1 );
+        numberOfEvaluationsPerRow_.resize( maximumStepIndex_ + 1 );
+        for( unsigned int i = 0; i < maximumStepIndex_ + 1 ; i++ )
+        {
+            numberOfEvaluationsPerRow_[ i ] = static_cast< double >( sequence_.at( i ) ) +
+                    ( i == 0 ? 1.0 : numberOfEvaluationsPerRow_[ i - 1 ] );
+        }
+        targetStepIndex_ = maximumStepIndex_;
+    }
+
     // Execute mid-point method.
     /*
      * Executes mid-point method, given a known state and state derivative.
@@ -487,17 +524,158 @@ private:
      * \param stateAtCenterPoint State at center point.
      * \param independentVariableAtFirstPoint Independent variable at first point.
      * \param subStepSize Sub step size between successive states used by mid-point method.
-     * \return Result of midpoint method
+     * \param stateAtLastPoint Result of midpoint method (returned by reference)
      */
-    StateType executeMidPointMethod( StateType stateAtFirstPoint, StateType stateAtCenterPoint,
-                                     const IndependentVariableType independentVariableAtFirstPoint,
-                                     const IndependentVariableType subStepSize )
+    void executeMidPointMethod( const StateType& stateAtFirstPoint, const StateType& stateAtCenterPoint,
+                                const IndependentVariableType independentVariableAtFirstPoint,
+                                const IndependentVariableType subStepSize,
+                                StateType& stateAtLastPoint )
     {
-        return stateAtFirstPoint + 2.0 * subStepSize
+        stateAtLastPoint = stateAtFirstPoint + 2.0 * subStepSize
                 * this->stateDerivativeFunction_( independentVariableAtFirstPoint + subStepSize,
                                                   stateAtCenterPoint );
     }
 
+    // Compute modified mid-point sequence for a single entry of the sequence, and set first column of tableau.
+    /*
+     * Compute modified mid-point sequence for a single entry of the sequence, using the workspace of that entry, and
+     * set the result (with end-point correction) in the first column of the extrapolation tableau. Sequences for
+     * different entries are independent, and may be computed concurrently.
+     * \param sequenceIndex Index of entry in sequence_ for which the mid-point sequence is to be computed
+     * \param stepSize Step size that is taken
+     */
+    void computeModifiedMidPointSequence( const unsigned int sequenceIndex, const TimeStepType stepSize )
+    {
+        StateType& stateAtFirstPoint = statesAtFirstPoint_[ sequenceIndex ];
+        StateType& stateAtCenterPoint = statesAtCenterPoint_[ sequenceIndex ];
+        StateType& stateAtLastPoint = statesAtLastPoint_[ sequenceIndex ];
+        const double subStepSize = subSteps_.at( sequenceIndex );
+
+        // Compute Euler step and set as state at center point for use with mid-point method.
+        stateAtCenterPoint = currentState_ + subStepSize * initialStateDerivative_;
+
+        // Apply modified mid-point rule.
+        stateAtFirstPoint = currentState_;
+        IndependentVariableType independentVariableAtFirstPoint = currentIndependentVariable_;
+        for ( unsigned int j = 0; j < sequence_.at( sequenceIndex ) - 1; j++ )
+        {
+            executeMidPointMethod( stateAtFirstPoint, stateAtCenterPoint,
+                                   independentVariableAtFirstPoint, subStepSize, stateAtLastPoint );
+
+            if ( j < sequence_.at( sequenceIndex ) - 2 )
+            {
+                // Shift states, last point is overwritten in next iteration
+                stateAtFirstPoint.swap( stateAtCenterPoint );
+                stateAtCenterPoint.swap( stateAtLastPoint );
+                independentVariableAtFirstPoint += subStepSize;
+            }
+        }
+
+        // Apply end-point correction.
+        integratedStates_[ sequenceIndex ][ 0 ]
+                = 0.5 * ( stateAtLastPoint + stateAtCenterPoint + subStepSize * this->stateDerivativeFunction_(
+                              currentIndependentVariable_ + stepSize, stateAtLastPoint ) );
+    }
+
+    // Compute a row of the extrapolation tableau from its first column and the preceding row.
+    void extrapolateTableauRow( const unsigned int i )
+    {
+        for ( unsigned int k = 1; k < i + 1; k++ )
+        {
+            integratedStates_[ i ][ k ] =
+                    integratedStates_[ i ][ k - 1 ] + 1.0 /
+                    ( std::pow( subSteps_.at( i - k ), 2.0 ) / std::pow( subSteps_.at( i ), 2.0 ) - 1.0 )
+                    * ( integratedStates_[ i ][ k - 1 ] - integratedStates_[ i - 1 ][ k - 1 ] );
+        }
+    }
+
+    // Perform the extrapolation for a single step with adaptive order selection.
+    /*
+     * Perform the extrapolation for a single step with adaptive order selection, using a simplified version of the
+     * order and step size control of Hairer et al. (1993, Section II.9). The tableau is computed up to the current
+     * target row, and extended by one row if the error tolerances are not met at the target row. For each row, the
+     * step size is estimated from the step size controller (with its order reduced by two for each row below the last
+     * one), and the target
+     * row for the next step is chosen to minimize the number of state derivative evaluations per unit step.
+     * \param stepSize Step size that is taken
+     * \param acceptedStepIndex Index of the row of the tableau from which the state is taken if the step is
+     * accepted (returned by reference)
+     * \return True if the step is accepted, false if it has to be redone (with step size stepSize_)
+     */
+    bool performAdaptiveOrderExtrapolation( const TimeStepType stepSize, unsigned int& acceptedStepIndex )
+    {
+        const double defaultIntegratorOrder = stepSizeController_->getIntegratorOrder( );
+
+        std::pair< TimeStepType, bool > recommendedNewStepSizePair;
+        unsigned int newTargetStepIndex = targetStepIndex_;
+        bool stepAccepted = false;
+        for( unsigned int i = 0; i <= targetStepIndex_ + 1 && i <= maximumStepIndex_; i++ )
+        {
+            computeModifiedMidPointSequence( i, stepSize );
+            extrapolateTableauRow( i );
+
+            if( i + 1 >= targetStepIndex_ )
+            {
+                stepSizeController_->setIntegratorOrder(
+                            std::max( defaultIntegratorOrder - 2.0 * static_cast< double >( maximumStepIndex_ - i ), 1.0 ) );
+                recommendedStepSizes_[ i ] = stepSizeController_->computeNewStepSize(
+                            integratedStates_[ i ][ i - 1 ], integratedStates_[ i ][ i ], stepSize );
+
+                if( i == targetStepIndex_ && recommendedStepSizes_[ i ].second )
+                {
+                    // Select order for next step from work per unit step of current and previous row
+                    double currentWork = numberOfEvaluationsPerRow_[ i ] / recommendedStepSizes_[ i ].first;
+                    double previousWork = numberOfEvaluationsPerRow_[ i - 1 ] / recommendedStepSizes_[ i - 1 ].first;
+                    recommendedNewStepSizePair = recommendedStepSizes_[ i ];
+                    if( i > 2 && previousWork < 0.8 * currentWork )
+                    {
+                        newTargetStepIndex = i - 1;
+                        recommendedNewStepSizePair.first = recommendedStepSizes_[ i - 1 ].first;
+                    }
+                    else if( i < maximumStepIndex_ && currentWork < 0.9 * previousWork )
+                    {
+                        newTargetStepIndex = i + 1;
+                        recommendedNewStepSizePair.first *=
+                                numberOfEvaluationsPerRow_[ i + 1 ] / numberOfEvaluationsPerRow_[ i ];
+                    }
+                    acceptedStepIndex = i;
+                    stepAccepted = true;
+                    break;
+                }
+                else if( i == targetStepIndex_ + 1 )
+                {
+                    // Accept step at increased order, if tolerances are met
+                    if( recommendedStepSizes_[ i ].second )
+                    {
+                        newTargetStepIndex = i;
+                        recommendedNewStepSizePair = recommendedStepSizes_[ i ];
+                        acceptedStepIndex = i;
+                        stepAccepted = true;
+                    }
+                    else
+                    {
+                        recommendedNewStepSizePair = recommendedStepSizes_[ targetStepIndex_ ];
+                    }
+                }
+                else if( i == maximumStepIndex_ )
+                {
+                    recommendedNewStepSizePair = recommendedStepSizes_[ i ];
+                }
+            }
+        }
+        stepSizeController_->setIntegratorOrder( defaultIntegratorOrder );
+
+        std::pair< TimeStepType, bool > validatedNewStepSizePair = stepSizeValidator_->validateStep(
+                    std::make_pair( recommendedNewStepSizePair.first, stepAccepted ), stepSize );
+        stepSizeController_->updateStepHistory( validatedNewStepSizePair.second );
+        this->stepSize_ = validatedNewStepSizePair.first;
+        if( validatedNewStepSizePair.second )
+        {
+            targetStepIndex_ = newTargetStepIndex;
+        }
+        return validatedNewStepSizePair.second;
+    }
+
     std::vector< std::vector< StateType > > integratedStates_;
 
     unsigned int maximumStepIndex_;
@@ -511,12 +689,43 @@ private:
 
     bool useFixedStep_;
 
+    // Boolean denoting whether the order of each step is selected adaptively
+    bool useAdaptiveOrder_ = false;
+
+    // Pool of threads over which the modified mid-point sequences are distributed (nullptr if computed serially)
+    std::shared_ptr< utilities::ParallelTaskPool > parallelTaskPool_;
+
+    // State derivative at the start of the current step
+    StateDerivativeType initialStateDerivative_;
+
+    // Workspaces (per entry of the sequence) for the states at first point of the modified mid-point method
+    std::vector< StateType > statesAtFirstPoint_;
+
+    // Workspaces (per entry of the sequence) for the states at center point of the modified mid-point method
+    std::vector< StateType > statesAtCenterPoint_;
+
+    // Workspaces (per entry of the sequence) for the states at last point of the modified mid-point method
+    std::vector< StateType > statesAtLastPoint_;
+
+    // Row of the tableau from which the state is taken in the next step, if adaptive order selection is used
+    unsigned int targetStepIndex_;
+
+    // Step sizes (and acceptance) recommended from each row of the tableau in the current step (adaptive order only)
+    std::vector< std::pair< TimeStepType, bool > > recommendedStepSizes_;
+
+    // Number of state derivative evaluations needed to compute each row of the tableau
+    std::vector< double > numberOfEvaluationsPerRow_;
+
 };
 
 extern template class BulirschStoerVariableStepSizeIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
 extern template class BulirschStoerVariableStepSizeIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
 extern template class BulirschStoerVariableStepSizeIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
 
+#if( TUDAT_BUILD_WITH_EXTENDED_PRECISION_PROPAGATION_TOOLS )
+extern template class BulirschStoerVariableStepSizeIntegrator < double, VectorXdd, VectorXdd >;
+#endif
+
 
 // Typedef of variable-step size Bulirsch-Stoer integrator (state/state derivative = VectorXd,
 // independent variable = double).
@@ -22,6 +22,7 @@
 #include "tudat/math/integrators/rungeKutta4Integrator.h"
 #include "tudat/math/integrators/rungeKuttaFixedStepSizeIntegrator.h"
 #include "tudat/math/integrators/euler.h"
+#include "tudat/math/integrators/gaussJacksonIntegrator.h"
 #include "tudat/math/integrators/adamsBashforthMoultonIntegrator.h"
 #include "tudat/math/integrators/rungeKuttaVariableStepSizeIntegrator.h"
 #include "tudat/math/integrators/stepSizeController.h"
@@ -41,7 +42,8 @@ enum AvailableIntegrators
     rungeKuttaFixedStepSize,
     rungeKuttaVariableStepSize,
     bulirschStoer,
-    adamsBashforthMoulton
+    adamsBashforthMoulton,
+    gaussJackson
 };
 
 class IntegratorStepSizeValidationSettings
@@ -105,11 +107,28 @@ public:
 
     virtual ~IntegratorStepSizeControlSettings( ){ }
 
+    // Function to use a PI (proportional-integral) step-size controller instead of the elementary controller
+    // (see IntegratorStepSizeController::setProportionalIntegralControl)
+    void setProportionalIntegralControl( const double integralExponent = 0.7,
+                                         const double proportionalExponent = 0.4,
+                                         const bool usePredictivePostRejectionControl = true )
+    {
+        useProportionalIntegralControl_ = true;
+        integralExponent_ = integralExponent;
+        proportionalExponent_ = proportionalExponent;
+        usePredictivePostRejectionControl_ = usePredictivePostRejectionControl;
+    }
+
     StepSizeControlTypes stepSizeControlType_;
     double safetyFactorForNextStepSize_;
     double minimumFactorDecreaseForNextStepSize_;
     double maximumFactorDecreaseForNextStepSize_;
 
+    bool useProportionalIntegralControl_ = false;
+    double integralExponent_ = 0.7;
+    double proportionalExponent_ = 0.4;
+    bool usePredictivePostRejectionControl_ = true;
+
 };
 
 template< typename ToleranceType >
@@ -301,6 +320,13 @@ std::shared_ptr< IntegratorStepSizeController< TimeStepType, StateType > > creat
         throw std::runtime_error( "Error, did not recognize step size control type " + std::to_string(
             stepSizeControlSettings->stepSizeControlType_ ) );
     }
+
+    if( stepSizeControlSettings->useProportionalIntegralControl_ )
+    {
+        stepSizeController->setProportionalIntegralControl(
+            stepSizeControlSettings->integralExponent_, stepSizeControlSettings->proportionalExponent_,
+            stepSizeControlSettings->usePredictivePostRejectionControl_ );
+    }
     return stepSizeController;
 }
 
@@ -472,10 +498,13 @@ public:
 
     virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
     {
-        return std::make_shared< MultiStageVariableStepSizeSettings< IndependentVariableType> >(
-            this->initialTimeStep_, coefficientSet_,
-            stepSizeControlSettings_, stepSizeAcceptanceSettings_,
-            this->assessTerminationOnMinorSteps_ );
+        std::shared_ptr< MultiStageVariableStepSizeSettings< IndependentVariableType > > clonedSettings =
+                std::make_shared< MultiStageVariableStepSizeSettings< IndependentVariableType> >(
+                this->initialTimeStep_, coefficientSet_,
+                stepSizeControlSettings_, stepSizeAcceptanceSettings_,
+                this->assessTerminationOnMinorSteps_ );
+        clonedSettings->useDenseOutput_ = this->useDenseOutput_;
+        return clonedSettings;
     }
 
     // Destructor.
@@ -490,6 +519,10 @@ public:
     std::shared_ptr< IntegratorStepSizeControlSettings > stepSizeControlSettings_;
 
     std::shared_ptr< IntegratorStepSizeValidationSettings > stepSizeAcceptanceSettings_;
+
+    // Boolean denoting whether a continuous extension (dense output) is maintained for each step, which is then used
+    // to determine the state at an exact termination condition (see RungeKuttaVariableStepSizeIntegrator::setDenseOutput).
+    bool useDenseOutput_ = false;
 };
 
 
@@ -548,11 +581,14 @@ public:
 
     virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
     {
-        return std::make_shared< RungeKuttaVariableStepSizeBaseSettings< IndependentVariableType> >(
-                    areTolerancesDefinedAsScalar_, this->initialTimeDeprecated_, this->initialTimeStep_, coefficientSet_,
-                    minimumStepSize_, maximumStepSize_, this->assessTerminationOnMinorSteps_,
-                    safetyFactorForNextStepSize_, maximumFactorIncreaseForNextStepSize_, minimumFactorDecreaseForNextStepSize_,
-                    exceptionIfMinimumStepExceeded_ );
+        std::shared_ptr< RungeKuttaVariableStepSizeBaseSettings< IndependentVariableType > > clonedSettings =
+                std::make_shared< RungeKuttaVariableStepSizeBaseSettings< IndependentVariableType> >(
+                        areTolerancesDefinedAsScalar_, this->initialTimeDeprecated_, this->initialTimeStep_, coefficientSet_,
+                        minimumStepSize_, maximumStepSize_, this->assessTerminationOnMinorSteps_,
+                        safetyFactorForNextStepSize_, maximumFactorIncreaseForNextStepSize_, minimumFactorDecreaseForNextStepSize_,
+                        exceptionIfMinimumStepExceeded_ );
+        clonedSettings->useDenseOutput_ = this->useDenseOutput_;
+        return clonedSettings;
     }
 
     // Virtual destructor.
@@ -587,6 +623,10 @@ public:
 
     bool exceptionIfMinimumStepExceeded_;
 
+    // Boolean denoting whether a continuous extension (dense output) is maintained for each step, which is then used
+    // to determine the state at an exact termination condition (see RungeKuttaVariableStepSizeIntegrator::setDenseOutput).
+    bool useDenseOutput_ = false;
+
 };
 
 // Class to define settings of variable step RK numerical integrator with scalar tolerances.
@@ -639,12 +679,15 @@ public:
 
     virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
     {
-        return std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< IndependentVariableType> >(
-                    this->initialTimeDeprecated_, this->initialTimeStep_, this->coefficientSet_,
-                    this->minimumStepSize_, this->maximumStepSize_, relativeErrorTolerance_, absoluteErrorTolerance_,
-                    this->assessTerminationOnMinorSteps_,
-                    this->safetyFactorForNextStepSize_, this->maximumFactorIncreaseForNextStepSize_, this->minimumFactorDecreaseForNextStepSize_,
-                    this->exceptionIfMinimumStepExceeded_ );
+        std::shared_ptr< RungeKuttaVariableStepSizeSettingsScalarTolerances< IndependentVariableType > > clonedSettings =
+                std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< IndependentVariableType> >(
+                        this->initialTimeDeprecated_, this->initialTimeStep_, this->coefficientSet_,
+                        this->minimumStepSize_, this->maximumStepSize_, relativeErrorTolerance_, absoluteErrorTolerance_,
+                        this->assessTerminationOnMinorSteps_,
+                        this->safetyFactorForNextStepSize_, this->maximumFactorIncreaseForNextStepSize_, this->minimumFactorDecreaseForNextStepSize_,
+                        this->exceptionIfMinimumStepExceeded_ );
+        clonedSettings->useDenseOutput_ = this->useDenseOutput_;
+        return clonedSettings;
     }
     // Constructor.
     /*
@@ -773,12 +816,15 @@ public:
 
     virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
     {
-        return std::make_shared< RungeKuttaVariableStepSizeSettingsVectorTolerances< IndependentVariableType> >(
-                    this->initialTimeDeprecated_, this->initialTimeStep_, this->coefficientSet_,
-                    this->minimumStepSize_, this->maximumStepSize_, relativeErrorTolerance_, absoluteErrorTolerance_,
-                    this->assessTerminationOnMinorSteps_,
-                    this->safetyFactorForNextStepSize_, this->maximumFactorIncreaseForNextStepSize_, this->minimumFactorDecreaseForNextStepSize_,
-                    this->exceptionIfMinimumStepExceeded_ );
+        std::shared_ptr< RungeKuttaVariableStepSizeSettingsVectorTolerances< IndependentVariableType > > clonedSettings =
+                std::make_shared< RungeKuttaVariableStepSizeSettingsVectorTolerances< IndependentVariableType> >(
+                        this->initialTimeDeprecated_, this->initialTimeStep_, this->coefficientSet_,
+                        this->minimumStepSize_, this->maximumStepSize_, relativeErrorTolerance_, absoluteErrorTolerance_,
+                        this->assessTerminationOnMinorSteps_,
+                        this->safetyFactorForNextStepSize_, this->maximumFactorIncreaseForNextStepSize_, this->minimumFactorDecreaseForNextStepSize_,
+                        this->exceptionIfMinimumStepExceeded_ );
+        clonedSettings->useDenseOutput_ = this->useDenseOutput_;
+        return clonedSettings;
     }
 
     // Destructor.
@@ -863,10 +909,13 @@ public:
 
     virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
     {
-        return std::make_shared< BulirschStoerIntegratorSettings< IndependentVariableType> >(
+        std::shared_ptr< BulirschStoerIntegratorSettings< IndependentVariableType> > clonedSettings =
+                std::make_shared< BulirschStoerIntegratorSettings< IndependentVariableType> >(
                     this->initialTimeStep_, extrapolationSequence_, maximumNumberOfSteps_,
                     stepSizeControlSettings_,
                     stepSizeAcceptanceSettings_, this->assessTerminationOnMinorSteps_ );
+        clonedSettings->useAdaptiveOrder_ = this->useAdaptiveOrder_;
+        return clonedSettings;
     }
 
     // Destructor.
@@ -885,6 +934,8 @@ public:
 
     std::shared_ptr< IntegratorStepSizeValidationSettings > stepSizeAcceptanceSettings_;
 
+    // Boolean denoting whether the number of extrapolations is selected adaptively for each step
+    bool useAdaptiveOrder_ = false;
 
 };
 
@@ -978,6 +1029,78 @@ public:
 
 };
 
+// Class to define settings of the fixed step Gauss-Jackson numerical integrator
+/*
+ *  Class to define settings of the fixed step (summed form) Gauss-Jackson numerical integrator, for second-order equations
+ *  of motion (state consisting of blocks of Cartesian position and velocity, optionally with the variational
+ *  equations in additional columns).
+ */
+template< typename IndependentVariableType = double >
+class GaussJacksonSettings: public IntegratorSettings< IndependentVariableType >
+{
+public:
+
+    // Constructor
+    /*
+     *  Constructor for Gauss-Jackson integrator settings.
+     *  \param initialTime Start time (independent variable) of numerical integration.
+     *  \param fixedStep Fixed time (independent variable) step used in numerical integration.
+     *  \param order Order of the integrator (default 8).
+     *  \param numberOfCorrectorIterations Number of times the corrector is applied in each step (default 1).
+     *  \param evaluateCorrectedState Whether the state derivative is re-evaluated at the corrected state of each step
+     *      (PECE, default) or not (PEC).
+     *  \param assessTerminationOnMinorSteps Whether the propagation termination
+     *      conditions should be evaluated during the intermediate sub-steps of the integrator (`true`) or only at the end of
+     *      each integration step (`false`).
+     *  \param startupTolerance Relative tolerance for the convergence of the startup iterations.
+     *  \param maximumNumberOfStartupIterations Maximum number of startup iterations.
+     */
+    GaussJacksonSettings(
+            const IndependentVariableType initialTime,
+            const IndependentVariableType fixedStep,
+            const int order = 8,
+            const int numberOfCorrectorIterations = 1,
+            const bool evaluateCorrectedState = true,
+            const bool assessTerminationOnMinorSteps = false,
+            const double startupTolerance = 1.0E-14,
+            const int maximumNumberOfStartupIterations = 50 ):
+        IntegratorSettings< IndependentVariableType >(
+            gaussJackson, initialTime, fixedStep, assessTerminationOnMinorSteps ),
+        order_( order ), numberOfCorrectorIterations_( numberOfCorrectorIterations ),
+        evaluateCorrectedState_( evaluateCorrectedState ), startupTolerance_( startupTolerance ),
+        maximumNumberOfStartupIterations_( maximumNumberOfStartupIterations ) { }
+
+    virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< GaussJacksonSettings< IndependentVariableType > >(
+                    this->initialTimeDeprecated_, this->initialTimeStep_, order_, numberOfCorrectorIterations_,
+                    evaluateCorrectedState_, this->assessTerminationOnMinorSteps_, startupTolerance_,
+                    maximumNumberOfStartupIterations_ );
+    }
+
+    // Destructor
+    /*
+     *  Destructor
+     */
+    ~GaussJacksonSettings( ){ }
+
+    // Order of integrator
+    int order_;
+
+    // Number of times the corrector is applied in each step
+    int numberOfCorrectorIterations_;
+
+    // Whether the state derivative is re-evaluated at the corrected state of each step
+    bool evaluateCorrectedState_;
+
+    // Relative tolerance for the convergence of the startup iterations
+    double startupTolerance_;
+
+    // Maximum number of startup iterations
+    int maximumNumberOfStartupIterations_;
+
+};
+
 template< typename IndependentVariableType = double >
 inline std::shared_ptr< IntegratorSettings< IndependentVariableType > > eulerSettingsDeprecated(
         const IndependentVariableType initialTime,
@@ -1155,6 +1278,62 @@ inline std::shared_ptr< IntegratorSettings< IndependentVariableType > > multiSta
         initialTimeStep, coefficientSet, stepSizeControlSettings, stepSizeAcceptanceSettings, assessTerminationOnMinorSteps );
 }
 
+// Function to set whether a variable step RK integrator maintains a continuous extension (dense output) for each step
+/*
+ *  Function to set whether a variable step RK integrator maintains a continuous extension (dense output) for each step,
+ *  which is then used to determine the state at an exact termination condition, instead of repeating (part of) the last
+ *  integration step (see RungeKuttaVariableStepSizeIntegrator::setDenseOutput)
+ *  \param integratorSettings Settings of the integrator (must be for a variable step RK integrator)
+ *  \param useDenseOutput Boolean denoting whether dense output is to be used
+ */
+template< typename IndependentVariableType = double >
+void setIntegratorDenseOutput(
+        const std::shared_ptr< IntegratorSettings< IndependentVariableType > > integratorSettings,
+        const bool useDenseOutput = true )
+{
+    if( std::dynamic_pointer_cast< RungeKuttaVariableStepSizeBaseSettings< IndependentVariableType > >(
+                integratorSettings ) != nullptr )
+    {
+        std::dynamic_pointer_cast< RungeKuttaVariableStepSizeBaseSettings< IndependentVariableType > >(
+                    integratorSettings )->useDenseOutput_ = useDenseOutput;
+    }
+    else if( std::dynamic_pointer_cast< MultiStageVariableStepSizeSettings< IndependentVariableType > >(
+                 integratorSettings ) != nullptr )
+    {
+        std::dynamic_pointer_cast< MultiStageVariableStepSizeSettings< IndependentVariableType > >(
+                    integratorSettings )->useDenseOutput_ = useDenseOutput;
+    }
+    else
+    {
+        throw std::runtime_error( "Error when setting integrator dense output, only available for variable step RK integrators" );
+    }
+}
+
+// Function to set whether a Bulirsch-Stoer integrator selects the number of extrapolations adaptively for each step
+/*
+ *  Function to set whether a Bulirsch-Stoer integrator selects the number of extrapolations (and therefore the order)
+ *  adaptively for each step, to minimize the number of state derivative evaluations per unit step
+ *  (see BulirschStoerVariableStepSizeIntegrator::setUseAdaptiveOrder)
+ *  \param integratorSettings Settings of the integrator (must be for a Bulirsch-Stoer integrator)
+ *  \param useAdaptiveOrder Boolean denoting whether adaptive order selection is to be used
+ */
+template< typename IndependentVariableType = double >
+void setBulirschStoerAdaptiveOrder(
+        const std::shared_ptr< IntegratorSettings< IndependentVariableType > > integratorSettings,
+        const bool useAdaptiveOrder = true )
+{
+    if( std::dynamic_pointer_cast< BulirschStoerIntegratorSettings< IndependentVariableType > >(
+                integratorSettings ) != nullptr )
+    {
+        std::dynamic_pointer_cast< BulirschStoerIntegratorSettings< IndependentVariableType > >(
+                    integratorSettings )->useAdaptiveOrder_ = useAdaptiveOrder;
+    }
+    else
+    {
+        throw std::runtime_error( "Error when setting adaptive order, only available for Bulirsch-Stoer integrators" );
+    }
+}
+
 
 template< typename IndependentVariableType = double >
 inline std::shared_ptr< IntegratorSettings< IndependentVariableType > > bulirschStoerVariableStepIntegratorSettings(
@@ -1359,6 +1538,19 @@ inline std::shared_ptr< IntegratorSettings< IndependentVariableType > > adamsBas
         assessTerminationOnMinorSteps, 1.0 );
 }
 
+template< typename IndependentVariableType = double >
+inline std::shared_ptr< IntegratorSettings< IndependentVariableType > > gaussJacksonSettings(
+    const IndependentVariableType fixedStep,
+    const int order = 8,
+    const int numberOfCorrectorIterations = 1,
+    const bool evaluateCorrectedState = true,
+    const bool assessTerminationOnMinorSteps = false )
+{
+    return std::make_shared< GaussJacksonSettings< IndependentVariableType > >(
+        TUDAT_NAN, fixedStep, order, numberOfCorrectorIterations, evaluateCorrectedState,
+        assessTerminationOnMinorSteps );
+}
+
 // Function to create a numerical integrator.
 /*
  *  Function to create a numerical integrator from given integrator settings, state derivative function and initial state.
@@ -1527,6 +1719,13 @@ DependentVariableType, IndependentVariableStepType > > createIntegrator(
                       static_cast< IndependentVariableStepType >( vectorTolerancesIntegratorSettings->minimumFactorDecreaseForNextStepSize_ ),
                       vectorTolerancesIntegratorSettings->exceptionIfMinimumStepExceeded_ );
             }
+
+            if( variableStepIntegratorSettings->useDenseOutput_ )
+            {
+                std::dynamic_pointer_cast< RungeKuttaVariableStepSizeIntegrator
+                    <IndependentVariableType, DependentVariableType, DependentVariableType, IndependentVariableStepType> >(
+                        integrator )->setDenseOutput( true );
+            }
         }
         else
         {
@@ -1555,6 +1754,12 @@ DependentVariableType, IndependentVariableStepType > > createIntegrator(
                 ( coefficients, stateDerivativeFunction, initialTime, initialState,
                   static_cast< IndependentVariableStepType >( integratorSettings->initialTimeStep_ ),
                   stepSizeController, stepSizeValidator );
+            if( variableStepIntegratorSettings->useDenseOutput_ )
+            {
+                std::dynamic_pointer_cast< RungeKuttaVariableStepSizeIntegrator
+                    <IndependentVariableType, DependentVariableType, DependentVariableType, IndependentVariableStepType> >(
+                        integrator )->setDenseOutput( true );
+            }
 
         }
         break;
@@ -1615,6 +1820,13 @@ DependentVariableType, IndependentVariableStepType > > createIntegrator(
                       stateDerivativeFunction, initialTime, initialState,
                       static_cast< IndependentVariableStepType >( integratorSettings->initialTimeStep_ ),
                       stepSizeController, stepSizeValidator );
+
+                if( bulirschStoerIntegratorSettings->useAdaptiveOrder_ )
+                {
+                    std::dynamic_pointer_cast< BulirschStoerVariableStepSizeIntegrator
+                        <IndependentVariableType, DependentVariableType, DependentVariableType, IndependentVariableStepType> >(
+                            integrator )->setUseAdaptiveOrder( true );
+                }
             }
             else
             {
@@ -1692,6 +1904,30 @@ DependentVariableType, IndependentVariableStepType > > createIntegrator(
         }
         break;
     }
+    case gaussJackson:
+    {
+        std::shared_ptr< GaussJacksonSettings< IndependentVariableType > > gaussJacksonIntegratorSettings =
+                std::dynamic_pointer_cast< GaussJacksonSettings< IndependentVariableType > >( integratorSettings );
+
+        // Check that integrator type has been cast properly
+        if ( gaussJacksonIntegratorSettings == nullptr )
+        {
+            throw std::runtime_error( "Error, type of integrator settings (GaussJacksonSettings) not compatible with "
+                                      "selected integrator (derived class of IntegratorSettings must be GaussJacksonSettings "
+                                      "for this type)." );
+        }
+
+        integrator = std::make_shared< GaussJacksonIntegrator
+                < IndependentVariableType, DependentVariableType, DependentVariableType, IndependentVariableStepType > >
+                ( stateDerivativeFunction, initialTime, initialState,
+                  static_cast< IndependentVariableStepType >( integratorSettings->initialTimeStep_ ),
+                  gaussJacksonIntegratorSettings->order_,
+                  gaussJacksonIntegratorSettings->numberOfCorrectorIterations_,
+                  gaussJacksonIntegratorSettings->evaluateCorrectedState_,
+                  gaussJacksonIntegratorSettings->startupTolerance_,
+                  gaussJacksonIntegratorSettings->maximumNumberOfStartupIterations_ );
+        break;
+    }
     default:
         throw std::runtime_error( "Error, integrator " +  std::to_string( integratorSettings->integratorType_ ) + " not found." );
     }
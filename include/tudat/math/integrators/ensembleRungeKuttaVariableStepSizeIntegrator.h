@@ -0,0 +1,602 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Montenbruck, O., Gill, E. Satellite Orbits: Models, Methods, Applications, Springer, 2005.
+ *
+ */
+
+#ifndef TUDAT_ENSEMBLE_RUNGE_KUTTA_VARIABLE_STEP_SIZE_INTEGRATOR_H
+#define TUDAT_ENSEMBLE_RUNGE_KUTTA_VARIABLE_STEP_SIZE_INTEGRATOR_H
+
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/math/integrators/rungeKuttaCoefficients.h"
+#include "tudat/math/integrators/stepSizeController.h"
+
+namespace tudat
+{
+
+namespace numerical_integrators
+{
+
+//! Class for the lock-step integration of an ensemble of independent members with a variable step-size Runge-Kutta method
+/*!
+ * Class for the lock-step integration of an ensemble of independent members (e.g. the samples of a Monte Carlo analysis)
+ * that share the same state derivative function, using any of the embedded Runge-Kutta coefficient sets of the
+ * RungeKuttaVariableStepSizeIntegrator. Each member has its own independent variable, step size and per-element error
+ * control (identical to that of the PerElementIntegratorStepSizeController and BasicIntegratorStepSizeValidator).
+ * The states of all members are stored in structure-of-arrays layout (one row per member, one column per state entry),
+ * so that each state entry is contiguous over all members, and the stage combinations of all members are computed
+ * with vectorized operations. In each lock-step, all members attempt a step with their own step size, and the state
+ * derivative function is evaluated once per stage for the ensemble as a whole. Members for which the step is rejected
+ * keep their state and retry with a reduced step in the next lock-step, while the other members advance. Members that
+ * have reached the end of the integration interval are masked out (step size of zero), so that their state is unchanged.
+ */
+template< typename IndependentVariableType = double, typename StateScalarType = double >
+class EnsembleRungeKuttaVariableStepSizeIntegrator
+{
+public:
+
+    //! Typedef for the states (or state derivatives) of the ensemble, with one row per member.
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > EnsembleStateType;
+
+    //! Typedef for the independent variables (or step sizes) of the ensemble, with one entry per member.
+    typedef Eigen::Matrix< IndependentVariableType, Eigen::Dynamic, 1 > EnsembleIndependentVariableType;
+
+    //! Typedef for the per-state-entry error tolerances.
+    typedef Eigen::Matrix< StateScalarType, 1, Eigen::Dynamic > ErrorToleranceType;
+
+    //! Typedef for the state derivative function of the ensemble.
+    /*!
+     * Typedef for the state derivative function of the ensemble, which takes the independent variables (one entry per
+     * member) and states (one row per member) as input, and returns the state derivatives (one row per member). The
+     * function is called for all members, including those that are masked out, which are evaluated at their current state.
+     */
+    typedef std::function< EnsembleStateType( const EnsembleIndependentVariableType&, const EnsembleStateType& ) >
+    EnsembleStateDerivativeFunction;
+
+    //! Constructor.
+    /*!
+     * Constructor, taking coefficients, the ensemble state derivative function, initial conditions, step size bounds and
+     * per-state-entry error tolerances as argument.
+     * \param coefficients Coefficients to use with this integrator (must be a variable step-size coefficient set).
+     * \param stateDerivativeFunction State derivative function of the ensemble.
+     * \param intervalStart The start of the integration interval (equal for all members).
+     * \param initialStates The initial states of the members, one row per member.
+     * \param initialStepSize The initial step size (equal for all members).
+     * \param minimumStepSize The minimum step size to take.
+     * \param maximumStepSize The maximum step size to take.
+     * \param relativeErrorTolerance The relative error tolerance for each state entry.
+     * \param absoluteErrorTolerance The absolute error tolerance for each state entry.
+     * \param safetyFactorForNextStepSize Safety factor used to scale prediction of next step size.
+     * \param maximumFactorIncreaseForNextStepSize Maximum factor increase for next step size.
+     * \param minimumFactorDecreaseForNextStepSize Maximum factor decrease for next step size.
+     * \param exceptionIfMinimumStepExceeded Boolean denoting whether an exception is thrown if the step size of a
+     * member drops below the minimum step size (if false, the minimum step size is used for that member).
+     */
+    EnsembleRungeKuttaVariableStepSizeIntegrator(
+            const RungeKuttaCoefficients& coefficients,
+            const EnsembleStateDerivativeFunction& stateDerivativeFunction,
+            const IndependentVariableType intervalStart,
+            const EnsembleStateType& initialStates,
+            const IndependentVariableType initialStepSize,
+            const IndependentVariableType minimumStepSize,
+            const IndependentVariableType maximumStepSize,
+            const ErrorToleranceType& relativeErrorTolerance,
+            const ErrorToleranceType& absoluteErrorTolerance,
+            const double safetyFactorForNextStepSize = 0.8,
+            const double maximumFactorIncreaseForNextStepSize = 4.0,
+            const double minimumFactorDecreaseForNextStepSize = 0.1,
+            const bool exceptionIfMinimumStepExceeded = true );
+
+    //! Constructor, with error tolerances equal for all state entries.
+    /*!
+     * Constructor, with relative and absolute error tolerances equal for all state entries. See the constructor with
+     * per-state-entry error tolerances for details.
+     */
+    EnsembleRungeKuttaVariableStepSizeIntegrator(
+            const RungeKuttaCoefficients& coefficients,
+            const EnsembleStateDerivativeFunction& stateDerivativeFunction,
+            const IndependentVariableType intervalStart,
+            const EnsembleStateType& initialStates,
+            const IndependentVariableType initialStepSize,
+            const IndependentVariableType minimumStepSize,
+            const IndependentVariableType maximumStepSize,
+            const StateScalarType relativeErrorTolerance,
+            const StateScalarType absoluteErrorTolerance,
+            const double safetyFactorForNextStepSize = 0.8,
+            const double maximumFactorIncreaseForNextStepSize = 4.0,
+            const double minimumFactorDecreaseForNextStepSize = 0.1,
+            const bool exceptionIfMinimumStepExceeded = true ):
+        EnsembleRungeKuttaVariableStepSizeIntegrator(
+            coefficients, stateDerivativeFunction, intervalStart, initialStates, initialStepSize,
+            minimumStepSize, maximumStepSize,
+            ErrorToleranceType::Constant( initialStates.cols( ), relativeErrorTolerance ),
+            ErrorToleranceType::Constant( initialStates.cols( ), absoluteErrorTolerance ),
+            safetyFactorForNextStepSize, maximumFactorIncreaseForNextStepSize, minimumFactorDecreaseForNextStepSize,
+            exceptionIfMinimumStepExceeded ){ }
+
+    //! Perform a single lock-step for all active members.
+    /*!
+     * Performs a single lock-step, in which each active member attempts a step with its own step size (as retrieved by
+     * getNextStepSizes). Members for which the step is accepted advance their independent variable and state, members for
+     * which the step is rejected keep their state, and retry with the reduced step size in the next lock-step.
+     * \return Number of members for which the step was accepted.
+     */
+    int performIntegrationStep( );
+
+    //! Integrate all members to the end of the interval.
+    /*!
+     * Integrates all members to the end of the interval, performing lock-steps until all members have exactly reached the
+     * end of the interval. The step of each member is limited such that it does not exceed the end of the interval, after
+     * which the member is masked out.
+     * \param intervalEnd The value of the independent variable at the end of the interval to integrate over.
+     * \return The states of all members at the end of the interval, one row per member.
+     */
+    EnsembleStateType integrateTo( const IndependentVariableType intervalEnd );
+
+    //! Get the current states of all members.
+    /*!
+     * Returns the current states of all members, one row per member.
+     * \return Current states of all members.
+     */
+    EnsembleStateType getCurrentStates( ) const
+    {
+        return currentStates_;
+    }
+
+    //! Get the current independent variables of all members.
+    /*!
+     * Returns the current independent variables of all members.
+     * \return Current independent variables of all members.
+     */
+    EnsembleIndependentVariableType getCurrentIndependentVariables( ) const
+    {
+        return currentIndependentVariables_;
+    }
+
+    //! Get the step sizes of the next step of all members.
+    /*!
+     * Returns the step sizes to be used for the next step of all members.
+     * \return Step sizes of the next step of all members.
+     */
+    EnsembleIndependentVariableType getNextStepSizes( ) const
+    {
+        return stepSizes_;
+    }
+
+    //! Get the number of members of the ensemble.
+    /*!
+     * Returns the number of members of the ensemble.
+     * \return Number of members of the ensemble.
+     */
+    int getNumberOfMembers( ) const
+    {
+        return currentStates_.rows( );
+    }
+
+    //! Get the number of accepted steps of each member.
+    /*!
+     * Returns the number of accepted steps of each member, since the creation of the integrator.
+     * \return Number of accepted steps of each member.
+     */
+    Eigen::VectorXi getNumberOfAcceptedSteps( ) const
+    {
+        return numberOfAcceptedSteps_;
+    }
+
+    //! Get the number of rejected steps of each member.
+    /*!
+     * Returns the number of rejected steps of each member, since the creation of the integrator.
+     * \return Number of rejected steps of each member.
+     */
+    Eigen::VectorXi getNumberOfRejectedSteps( ) const
+    {
+        return numberOfRejectedSteps_;
+    }
+
+    //! Get the number of lock-steps that have been performed.
+    /*!
+     * Returns the number of lock-steps that have been performed, since the creation of the integrator. The ensemble state
+     * derivative function is called once per stage for each lock-step.
+     * \return Number of lock-steps that have been performed.
+     */
+    int getNumberOfLockSteps( ) const
+    {
+        return numberOfLockSteps_;
+    }
+
+    //! Get the number of lock-steps in which each member was active.
+    /*!
+     * Returns the number of lock-steps in which each member was active (i.e. not masked out), since the creation of the
+     * integrator. The difference with the total number of lock-steps indicates the number of discarded state derivative
+     * evaluations of the member.
+     * \return Number of lock-steps in which each member was active.
+     */
+    Eigen::VectorXi getNumberOfActiveLockSteps( ) const
+    {
+        return numberOfAcceptedSteps_ + numberOfRejectedSteps_;
+    }
+
+    //! Get the coefficients of the integrator.
+    /*!
+     * Returns the coefficients of the integrator.
+     * \return Coefficients of the integrator.
+     */
+    RungeKuttaCoefficients getCoefficients( ) const
+    {
+        return coefficients_;
+    }
+
+protected:
+
+    //! Compute the next step size of a member, and determine whether its current step is accepted.
+    /*!
+     * Computes the next step size of a member from its maximum relative truncation error, and determines whether its
+     * current step is accepted, using the same procedure as the PerElementIntegratorStepSizeController and the
+     * BasicIntegratorStepSizeValidator.
+     * \param member Index of the member
+     * \param maximumErrorInState Maximum relative truncation error of the member in the current step
+     * \param stepSize Step size of the member in the current step
+     * \return True if the current step of the member is accepted
+     */
+    bool computeNextStepSizeAndValidateResult(
+            const int member, const StateScalarType maximumErrorInState, const IndependentVariableType stepSize );
+
+    //! Coefficients for the integrator, as defined by the Butcher tableau.
+    RungeKuttaCoefficients coefficients_;
+
+    //! State derivative function of the ensemble.
+    EnsembleStateDerivativeFunction stateDerivativeFunction_;
+
+    //! Current independent variables of the members.
+    EnsembleIndependentVariableType currentIndependentVariables_;
+
+    //! Current states of the members (one row per member).
+    EnsembleStateType currentStates_;
+
+    //! Step sizes of the next step of the members.
+    EnsembleIndependentVariableType stepSizes_;
+
+    //! Minimum step size.
+    IndependentVariableType minimumStepSize_;
+
+    //! Maximum step size.
+    IndependentVariableType maximumStepSize_;
+
+    //! Relative error tolerance for each state entry.
+    ErrorToleranceType relativeErrorTolerance_;
+
+    //! Absolute error tolerance for each state entry.
+    ErrorToleranceType absoluteErrorTolerance_;
+
+    //! Safety factor used to scale prediction of next step size.
+    double safetyFactorForNextStepSize_;
+
+    //! Maximum factor increase for next step size.
+    double maximumFactorIncreaseForNextStepSize_;
+
+    //! Minimum factor decrease for next step size.
+    double minimumFactorDecreaseForNextStepSize_;
+
+    //! Boolean denoting whether an exception is thrown if the step size of a member drops below the minimum step size.
+    bool exceptionIfMinimumStepExceeded_;
+
+    //! List of columns with non-zero a-coefficients, per stage (zero coefficients are skipped in the stage combinations).
+    std::vector< std::vector< int > > nonZeroACoefficientColumns_;
+
+    //! Boolean per member denoting whether the member takes part in the current lock-step.
+    std::vector< bool > isMemberActive_;
+
+    //! Step sizes of the members in the current lock-step (zero for members that are masked out).
+    EnsembleIndependentVariableType lockStepSizes_;
+
+    //! State derivatives of the ensemble, per stage (i.e. values of k_{i} in Runge-Kutta scheme).
+    std::vector< EnsembleStateType > currentStateDerivatives_;
+
+    //! Work variable for the intermediate states of each stage.
+    EnsembleStateType intermediateStates_;
+
+    //! Work variable for the lower order estimates of the states at the end of the step.
+    EnsembleStateType lowerOrderEstimates_;
+
+    //! Work variable for the higher order estimates of the states at the end of the step.
+    EnsembleStateType higherOrderEstimates_;
+
+    //! Number of accepted steps of each member.
+    Eigen::VectorXi numberOfAcceptedSteps_;
+
+    //! Number of rejected steps of each member.
+    Eigen::VectorXi numberOfRejectedSteps_;
+
+    //! Number of lock-steps that have been performed.
+    int numberOfLockSteps_ = 0;
+};
+
+//! Constructor.
+template< typename IndependentVariableType, typename StateScalarType >
+EnsembleRungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateScalarType >::
+EnsembleRungeKuttaVariableStepSizeIntegrator(
+        const RungeKuttaCoefficients& coefficients,
+        const EnsembleStateDerivativeFunction& stateDerivativeFunction,
+        const IndependentVariableType intervalStart,
+        const EnsembleStateType& initialStates,
+        const IndependentVariableType initialStepSize,
+        const IndependentVariableType minimumStepSize,
+        const IndependentVariableType maximumStepSize,
+        const ErrorToleranceType& relativeErrorTolerance,
+        const ErrorToleranceType& absoluteErrorTolerance,
+        const double safetyFactorForNextStepSize,
+        const double maximumFactorIncreaseForNextStepSize,
+        const double minimumFactorDecreaseForNextStepSize,
+        const bool exceptionIfMinimumStepExceeded ):
+    coefficients_( coefficients ),
+    stateDerivativeFunction_( stateDerivativeFunction ),
+    currentIndependentVariables_( EnsembleIndependentVariableType::Constant( initialStates.rows( ), intervalStart ) ),
+    currentStates_( initialStates ),
+    stepSizes_( EnsembleIndependentVariableType::Constant( initialStates.rows( ), initialStepSize ) ),
+    minimumStepSize_( std::fabs( minimumStepSize ) ),
+    maximumStepSize_( std::fabs( maximumStepSize ) ),
+    relativeErrorTolerance_( relativeErrorTolerance ),
+    absoluteErrorTolerance_( absoluteErrorTolerance ),
+    safetyFactorForNextStepSize_( safetyFactorForNextStepSize ),
+    maximumFactorIncreaseForNextStepSize_( maximumFactorIncreaseForNextStepSize ),
+    minimumFactorDecreaseForNextStepSize_( minimumFactorDecreaseForNextStepSize ),
+    exceptionIfMinimumStepExceeded_( exceptionIfMinimumStepExceeded ),
+    isMemberActive_( initialStates.rows( ), true ),
+    numberOfAcceptedSteps_( Eigen::VectorXi::Zero( initialStates.rows( ) ) ),
+    numberOfRejectedSteps_( Eigen::VectorXi::Zero( initialStates.rows( ) ) )
+{
+    // Raise error if a fixed step coefficient set is used with this variable step integrator.
+    if( coefficients_.isFixedStepSize )
+    {
+        throw std::runtime_error( "Error when creating ensemble variable step-size RK integrator, fixed step coefficients are used (" +
+                                  coefficients_.name + ")." );
+    }
+
+    if( relativeErrorTolerance_.cols( ) != initialStates.cols( ) ||
+            absoluteErrorTolerance_.cols( ) != initialStates.cols( ) )
+    {
+        throw std::runtime_error( "Error when creating ensemble variable step-size RK integrator, size of tolerances (" +
+                                  std::to_string( relativeErrorTolerance_.cols( ) ) + ", " +
+                                  std::to_string( absoluteErrorTolerance_.cols( ) ) +
+                                  ") is incompatible with state size (" + std::to_string( initialStates.cols( ) ) + ")." );
+    }
+
+    // Determine non-zero a-coefficients of each stage
+    const int numberOfStages = coefficients_.cCoefficients.rows( );
+    nonZeroACoefficientColumns_.resize( numberOfStages );
+    for( int stage = 0; stage < numberOfStages; stage++ )
+    {
+        for( int column = 0; column < stage; column++ )
+        {
+            if( coefficients_.aCoefficients( stage, column ) != 0.0 )
+            {
+                nonZeroACoefficientColumns_[ stage ].push_back( column );
+            }
+        }
+    }
+    currentStateDerivatives_.resize( numberOfStages );
+}
+
+//! Perform a single lock-step for all active members.
+template< typename IndependentVariableType, typename StateScalarType >
+int EnsembleRungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateScalarType >::performIntegrationStep( )
+{
+    const int numberOfMembers = currentStates_.rows( );
+
+    // Set step sizes of current lock-step, masking out inactive members.
+    lockStepSizes_.resize( numberOfMembers );
+    for( int member = 0; member < numberOfMembers; member++ )
+    {
+        lockStepSizes_( member ) = isMemberActive_[ member ] ? stepSizes_( member ) : IndependentVariableType( 0.0 );
+        if( !( lockStepSizes_( member ) == lockStepSizes_( member ) ) )
+        {
+            throw std::invalid_argument( "Error in ensemble RK integrator, step size of member " +
+                                         std::to_string( member ) + " is NaN" );
+        }
+    }
+
+    // Compute the k_i state derivatives per stage, and update the lower and higher order estimates.
+    lowerOrderEstimates_ = currentStates_;
+    higherOrderEstimates_ = currentStates_;
+    for( unsigned int stage = 0; stage < currentStateDerivatives_.size( ); stage++ )
+    {
+        // Compute the intermediate states, skipping the zero a-coefficients.
+        intermediateStates_ = currentStates_;
+        for( const int column: nonZeroACoefficientColumns_[ stage ] )
+        {
+            intermediateStates_.array( ) += currentStateDerivatives_[ column ].array( ).colwise( ) *
+                    ( lockStepSizes_ * coefficients_.aCoefficients( stage, column ) ).array( ).template
+                    cast< StateScalarType >( );
+        }
+
+        // Compute the state derivatives of all members.
+        currentStateDerivatives_[ stage ] = stateDerivativeFunction_(
+                    currentIndependentVariables_ + coefficients_.cCoefficients( stage ) * lockStepSizes_,
+                    intermediateStates_ );
+
+        // Update the estimates.
+        if( coefficients_.bCoefficients( 0, stage ) != 0.0 )
+        {
+            lowerOrderEstimates_.array( ) += currentStateDerivatives_[ stage ].array( ).colwise( ) *
+                    ( coefficients_.bCoefficients( 0, stage ) * lockStepSizes_ ).array( ).template cast< StateScalarType >( );
+        }
+        if( coefficients_.bCoefficients( 1, stage ) != 0.0 )
+        {
+            higherOrderEstimates_.array( ) += currentStateDerivatives_[ stage ].array( ).colwise( ) *
+                    ( coefficients_.bCoefficients( 1, stage ) * lockStepSizes_ ).array( ).template cast< StateScalarType >( );
+        }
+    }
+    numberOfLockSteps_++;
+
+    // Compute the maximum relative truncation error of each member.
+    const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > maximumErrorsInState =
+            ( ( lowerOrderEstimates_ - higherOrderEstimates_ ).array( ).abs( ) /
+              ( ( lowerOrderEstimates_.array( ).abs( ).rowwise( ) * relativeErrorTolerance_.array( ) ).rowwise( ) +
+                absoluteErrorTolerance_.array( ) ) ).rowwise( ).maxCoeff( );
+
+    // Accept or reject the step of each active member, and compute its next step size.
+    const EnsembleStateType& acceptedEstimates =
+            ( coefficients_.orderEstimateToIntegrate == RungeKuttaCoefficients::lower ) ?
+                lowerOrderEstimates_ : higherOrderEstimates_;
+    int numberOfAcceptedMembers = 0;
+    for( int member = 0; member < numberOfMembers; member++ )
+    {
+        if( !isMemberActive_[ member ] )
+        {
+            continue;
+        }
+
+        if( computeNextStepSizeAndValidateResult(
+                    member, maximumErrorsInState( member ), lockStepSizes_( member ) ) )
+        {
+            currentIndependentVariables_( member ) += lockStepSizes_( member );
+            currentStates_.row( member ) = acceptedEstimates.row( member );
+            numberOfAcceptedSteps_( member )++;
+            numberOfAcceptedMembers++;
+        }
+        else
+        {
+            numberOfRejectedSteps_( member )++;
+        }
+    }
+
+    return numberOfAcceptedMembers;
+}
+
+//! Integrate all members to the end of the interval.
+template< typename IndependentVariableType, typename StateScalarType >
+typename EnsembleRungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateScalarType >::EnsembleStateType
+EnsembleRungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateScalarType >::integrateTo(
+        const IndependentVariableType intervalEnd )
+{
+    const int numberOfMembers = currentStates_.rows( );
+    std::vector< bool > isStepToIntervalEnd( numberOfMembers, false );
+
+    bool isAnyMemberActive = true;
+    while( isAnyMemberActive )
+    {
+        // Limit the step of each member that has not reached the end of the interval, such that it does not exceed
+        // the end of the interval, and mask out the other members.
+        isAnyMemberActive = false;
+        for( int member = 0; member < numberOfMembers; member++ )
+        {
+            const IndependentVariableType remainingInterval = intervalEnd - currentIndependentVariables_( member );
+            isMemberActive_[ member ] = ( remainingInterval != 0.0 );
+            isStepToIntervalEnd[ member ] = false;
+            if( isMemberActive_[ member ] )
+            {
+                isAnyMemberActive = true;
+                if( remainingInterval * stepSizes_( member ) < 0.0 )
+                {
+                    throw std::runtime_error( "Error in ensemble RK integrator, step size of member " +
+                                              std::to_string( member ) + " is in direction opposite to interval end." );
+                }
+                else if( std::fabs( remainingInterval ) <=
+                         std::fabs( stepSizes_( member ) ) * ( 1.0 + std::numeric_limits< IndependentVariableType >::epsilon( ) ) )
+                {
+                    stepSizes_( member ) = remainingInterval;
+                    isStepToIntervalEnd[ member ] = true;
+                }
+            }
+        }
+
+        if( isAnyMemberActive )
+        {
+            const Eigen::VectorXi previousNumberOfAcceptedSteps = numberOfAcceptedSteps_;
+            performIntegrationStep( );
+
+            // Set the independent variable of members that accepted a step to the end of the interval exactly (to
+            // prevent additional steps due to rounding errors)
+            for( int member = 0; member < numberOfMembers; member++ )
+            {
+                if( isStepToIntervalEnd[ member ] &&
+                        numberOfAcceptedSteps_( member ) != previousNumberOfAcceptedSteps( member ) )
+                {
+                    currentIndependentVariables_( member ) = intervalEnd;
+                }
+            }
+        }
+    }
+
+    // Reactivate all members for subsequent calls to performIntegrationStep.
+    std::fill( isMemberActive_.begin( ), isMemberActive_.end( ), true );
+
+    return currentStates_;
+}
+
+//! Compute the next step size of a member, and determine whether its current step is accepted.
+template< typename IndependentVariableType, typename StateScalarType >
+bool EnsembleRungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateScalarType >::
+computeNextStepSizeAndValidateResult(
+        const int member, const StateScalarType maximumErrorInState, const IndependentVariableType stepSize )
+{
+    const bool tolerancesMet = maximumErrorInState <= 1.0;
+
+    // Compute the new step size (Montenbruck and Gill, 2005), with the order of the lower order estimate.
+    const double timeStepRatio = safetyFactorForNextStepSize_ * std::pow(
+                1.0 / static_cast< double >( maximumErrorInState ),
+                1.0 / static_cast< double >( coefficients_.lowerOrder + 1 ) );
+
+    IndependentVariableType newStepSize;
+    if( timeStepRatio <= minimumFactorDecreaseForNextStepSize_ )
+    {
+        newStepSize = stepSize * minimumFactorDecreaseForNextStepSize_;
+    }
+    else if( timeStepRatio >= maximumFactorIncreaseForNextStepSize_ )
+    {
+        newStepSize = stepSize * maximumFactorIncreaseForNextStepSize_;
+    }
+    else
+    {
+        newStepSize = stepSize * timeStepRatio;
+    }
+
+    // Validate the new step size.
+    if( std::fabs( newStepSize ) < minimumStepSize_ )
+    {
+        if( exceptionIfMinimumStepExceeded_ )
+        {
+            throw std::runtime_error( "Error in ensemble step-size control of member " + std::to_string( member ) +
+                                      ", minimum step size " + std::to_string( minimumStepSize_ ) +
+                                      " is higher than required time step " + std::to_string( newStepSize ) );
+        }
+        newStepSize = ( stepSize < 0.0 ? -1.0 : 1.0 ) * minimumStepSize_;
+    }
+    else if( std::fabs( newStepSize ) > maximumStepSize_ )
+    {
+        newStepSize = ( stepSize < 0.0 ? -1.0 : 1.0 ) * maximumStepSize_;
+    }
+
+    if( !( newStepSize == newStepSize ) )
+    {
+        throw std::runtime_error( "Error in ensemble step-size control of member " + std::to_string( member ) +
+                                  ", recommended step is NaN" );
+    }
+
+    stepSizes_( member ) = newStepSize;
+    return tolerancesMet;
+}
+
+extern template class EnsembleRungeKuttaVariableStepSizeIntegrator< double, double >;
+
+} // namespace numerical_integrators
+
+} // namespace tudat
+
+#endif // TUDAT_ENSEMBLE_RUNGE_KUTTA_VARIABLE_STEP_SIZE_INTEGRATOR_H
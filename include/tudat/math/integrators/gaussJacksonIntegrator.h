@@ -0,0 +1,890 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Berry, M.M. and Healy, L.M., Implementation of Gauss-Jackson integration for orbit propagation,
+ *          The Journal of the Astronautical Sciences, 52(3), 331-357, 2004.
+ *
+ */
+
+#ifndef TUDAT_GAUSS_JACKSON_INTEGRATOR_H
+#define TUDAT_GAUSS_JACKSON_INTEGRATOR_H
+
+#include <cmath>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/basics/utilities.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+#include "tudat/math/integrators/numericalIntegrator.h"
+#include "tudat/math/integrators/rungeKutta4Integrator.h"
+
+namespace tudat
+{
+
+namespace numerical_integrators
+{
+
+//! Class containing the coefficients of a (summed form) Gauss-Jackson integrator of a given order.
+/*!
+ *  Class containing the coefficients of a (summed form) Gauss-Jackson integrator of a given order, for which order + 1
+ *  accelerations at equidistant points (a stencil) are used. The velocity and position at a point n are obtained from the
+ *  first sum s_n and second sum S_n of the (scaled) accelerations a_j as v_n / h = s_n + sum_j c_j a_j and
+ *  r_n / h^2 = S_n + sum_j d_j a_j, where the sums are updated as s_n = s_{n-1} + ( a_{n-1} + a_n ) / 2 and
+ *  S_n = S_{n-1} + s_{n-1} + a_{n-1} / 2 (Berry and Healy, 2004). The coefficients c_j and d_j are computed at
+ *  construction for each point of the stencil, and for the point directly after the stencil (predictor), from the
+ *  interpolating polynomial through the accelerations.
+ */
+class GaussJacksonCoefficients
+{
+public:
+
+    //! Constructor, computes the coefficients
+    /*!
+     *  Constructor, computes the coefficients
+     *  \param order Order of the integrator (number of accelerations in stencil minus one)
+     */
+    GaussJacksonCoefficients( const int order );
+
+    //! Function to retrieve the order of the integrator
+    int getOrder( ) const
+    {
+        return order_;
+    }
+
+    //! Function to retrieve the first sum (velocity) coefficients, one row per point of the stencil at which the velocity is computed
+    const Eigen::MatrixXd& getFirstSumCoefficients( ) const
+    {
+        return firstSumCoefficients_;
+    }
+
+    //! Function to retrieve the second sum (position) coefficients, one row per point of the stencil at which the position is computed
+    const Eigen::MatrixXd& getSecondSumCoefficients( ) const
+    {
+        return secondSumCoefficients_;
+    }
+
+    //! Function to retrieve the velocity predictor coefficients
+    /*!
+     *  Function to retrieve the velocity predictor coefficients, with which the velocity at point n + 1 is obtained from
+     *  the first sum at point n and the accelerations at points n - order,...,n as v_{n+1} / h = s_n + sum_j c_j a_j
+     *  \return Velocity predictor coefficients
+     */
+    const Eigen::VectorXd& getVelocityPredictorCoefficients( ) const
+    {
+        return velocityPredictorCoefficients_;
+    }
+
+    //! Function to retrieve the position predictor coefficients
+    /*!
+     *  Function to retrieve the position predictor coefficients, with which the position at point n + 1 is obtained from
+     *  the sums at point n and the accelerations at points n - order,...,n as r_{n+1} / h^2 = S_n + s_n + sum_j d_j a_j
+     *  \return Position predictor coefficients
+     */
+    const Eigen::VectorXd& getPositionPredictorCoefficients( ) const
+    {
+        return positionPredictorCoefficients_;
+    }
+
+    //! Function to compute coefficients for integration of the interpolating polynomial through accelerations at given nodes
+    /*!
+     *  Function to compute coefficients for integration of the interpolating polynomial through accelerations at given
+     *  (arbitrary) nodes over a fraction theta of a step (in ordinate form). Starting from point 0, the position and
+     *  velocity at theta are obtained as r( theta ) = r_0 + theta h v_0 + h^2 sum_j d_j a_j and
+     *  v( theta ) = v_0 + h sum_j c_j a_j. Used for steps that are not equal to the nominal step size.
+     *  \param nodes Nodes (in units of the nominal step, w.r.t. the start point of the step) of the accelerations
+     *  \param stepFraction Fraction of the nominal step over which the polynomial is integrated
+     *  \param positionCoefficients Coefficients d_j (returned by reference)
+     *  \param velocityCoefficients Coefficients c_j (returned by reference)
+     */
+    static void computeOrdinateIntegrationCoefficients(
+            const std::vector< long double >& nodes,
+            const long double stepFraction,
+            Eigen::VectorXd& positionCoefficients,
+            Eigen::VectorXd& velocityCoefficients );
+
+private:
+
+    //! Order of the integrator
+    int order_;
+
+    //! First sum (velocity) coefficients, one row per point of the stencil at which the velocity is computed
+    Eigen::MatrixXd firstSumCoefficients_;
+
+    //! Second sum (position) coefficients, one row per point of the stencil at which the position is computed
+    Eigen::MatrixXd secondSumCoefficients_;
+
+    //! Velocity predictor coefficients (see getVelocityPredictorCoefficients)
+    Eigen::VectorXd velocityPredictorCoefficients_;
+
+    //! Position predictor coefficients (see getPositionPredictorCoefficients)
+    Eigen::VectorXd positionPredictorCoefficients_;
+};
+
+//! Class that implements the (fixed step, summed form) Gauss-Jackson integrator for second-order equations of motion.
+/*!
+ *  Class that implements the (fixed step, summed form) Gauss-Jackson integrator for second-order equations of motion
+ *  (Berry and Healy, 2004), which requires (nominally) one or two state derivative evaluations per step. The state must
+ *  consist of blocks of six rows, with the first three rows of each block a position, and the last three a velocity, and
+ *  the derivative of the position rows equal to the velocity rows (e.g. the Cartesian states of a Cowell propagation, with
+ *  or without the state transition and sensitivity matrices of the variational equations in the additional columns).
+ *  For each step, the position and velocity are predicted, the accelerations are evaluated and the position and velocity
+ *  are corrected (repeated for the number of corrector iterations), after which the accelerations are (optionally)
+ *  evaluated at the corrected state (PECE mode; PEC if not evaluated).
+ *
+ *  The integrator is started by computing initial estimates of the state at the first order + 1 points (using an RK4
+ *  integrator), which are then iterated on using the Gauss-Jackson corrector until convergence. The startup is performed
+ *  forward from the current epoch (no points before the current epoch are used), and is repeated if the state is modified
+ *  (e.g. impulsive maneuvers), or after a step that is not equal to the nominal step. Such steps (e.g. final step to a
+ *  given end time) are taken by integrating the interpolating polynomial through the accelerations in the stencil.
+ *  Note that the propagation termination function is not evaluated for the startup points.
+ */
+template< typename IndependentVariableType = double, typename StateType = Eigen::VectorXd,
+          typename StateDerivativeType = StateType, typename TimeStepType = IndependentVariableType >
+class GaussJacksonIntegrator :
+        public NumericalIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+{
+public:
+
+    //! Typedef of the base class.
+    typedef NumericalIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType > Base;
+
+    //! Typedef to the state derivative function.
+    typedef typename Base::StateDerivativeFunction StateDerivativeFunction;
+
+    //! Typedef of the scalar type of the state.
+    typedef typename StateType::Scalar StateScalarType;
+
+    //! Typedef of the matrix type used for the positions, velocities, accelerations and sums (three rows per block).
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > SecondOrderStateType;
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param stateDerivativeFunction State derivative function.
+     *  \param intervalStart The start of the integration interval.
+     *  \param initialState The initial state (blocks of three position and three velocity rows).
+     *  \param stepSize Fixed step size of the integrator
+     *  \param order Order of the integrator (default 8)
+     *  \param numberOfCorrectorIterations Number of times the corrector is applied in each step (default 1)
+     *  \param evaluateCorrectedState Boolean denoting whether the state derivative is evaluated at the corrected state of
+     *  each step, and used for the next steps (PECE, two evaluations per step by default); if false, the state derivative
+     *  evaluated at the predicted state is used (PEC, one evaluation per step by default).
+     *  \param startupTolerance Relative tolerance for the convergence of the startup iterations
+     *  \param maximumNumberOfStartupIterations Maximum number of startup iterations (exception thrown if exceeded)
+     */
+    GaussJacksonIntegrator(
+            const StateDerivativeFunction& stateDerivativeFunction,
+            const IndependentVariableType intervalStart,
+            const StateType& initialState,
+            const TimeStepType stepSize,
+            const int order = 8,
+            const int numberOfCorrectorIterations = 1,
+            const bool evaluateCorrectedState = true,
+            const double startupTolerance = 1.0E-14,
+            const int maximumNumberOfStartupIterations = 50 ):
+        Base( stateDerivativeFunction ),
+        currentIndependentVariable_( intervalStart ), currentState_( initialState ),
+        lastIndependentVariable_( intervalStart ), lastState_( initialState ),
+        stepSize_( stepSize ), coefficients_( order ), order_( order ),
+        numberOfCorrectorIterations_( numberOfCorrectorIterations ),
+        evaluateCorrectedState_( evaluateCorrectedState ),
+        startupTolerance_( startupTolerance ),
+        maximumNumberOfStartupIterations_( maximumNumberOfStartupIterations ),
+        historyIsInitialized_( false ), startupPointIndex_( 0 ), latestAccelerationIndex_( 0 ),
+        lastStepType_( no_step ), historyWasInitializedBeforePartialStep_( false )
+    {
+        if( initialState.rows( ) % 6 != 0 )
+        {
+            throw std::runtime_error( "Error in Gauss-Jackson integrator, state must consist of blocks of three position and "
+                                      "three velocity rows, but has " + std::to_string( initialState.rows( ) ) + " rows." );
+        }
+
+        if( numberOfCorrectorIterations_ < 1 )
+        {
+            throw std::runtime_error( "Error in Gauss-Jackson integrator, at least one corrector iteration is required." );
+        }
+
+        numberOfBlocks_ = static_cast< int >( initialState.rows( ) ) / 6;
+        numberOfColumns_ = static_cast< int >( initialState.cols( ) );
+
+        // Allocate history and workspaces
+        accelerationHistory_.resize( order_ + 2 );
+        for( unsigned int i = 0; i < accelerationHistory_.size( ); i++ )
+        {
+            accelerationHistory_[ i ] = SecondOrderStateType::Zero( 3 * numberOfBlocks_, numberOfColumns_ );
+        }
+        firstSum_ = SecondOrderStateType::Zero( 3 * numberOfBlocks_, numberOfColumns_ );
+        secondSum_ = firstSum_;
+        previousFirstSum_ = firstSum_;
+        previousSecondSum_ = firstSum_;
+        newFirstSum_ = firstSum_;
+        newSecondSum_ = firstSum_;
+        positions_ = firstSum_;
+        velocities_ = firstSum_;
+        partialStepAcceleration_ = firstSum_;
+        startupStates_.resize( order_ + 1 );
+        startupPositions_.resize( order_ + 1, firstSum_ );
+        startupVelocities_.resize( order_ + 1, firstSum_ );
+    }
+
+    //! Destructor
+    ~GaussJacksonIntegrator( ){ }
+
+    //! Get step size of the next step.
+    /*!
+     *  Returns the step size of the next step (nominal step size of the integrator).
+     *  \return Step size to be used for the next step.
+     */
+    TimeStepType getNextStepSize( ) const
+    {
+        return stepSize_;
+    }
+
+    //! Get current state.
+    /*!
+     *  Returns the current state of the integrator.
+     *  \return Current integrated state.
+     */
+    StateType getCurrentState( ) const
+    {
+        return currentState_;
+    }
+
+    //! Returns the current independent variable.
+    /*!
+     *  Returns the current value of the independent variable of the integrator.
+     *  \return Current independent variable.
+     */
+    IndependentVariableType getCurrentIndependentVariable( ) const
+    {
+        return currentIndependentVariable_;
+    }
+
+    //! Perform a single integration step.
+    /*!
+     *  Perform a single integration step. If the step size is equal to the nominal step size of the integrator, a
+     *  Gauss-Jackson step is taken (performing the startup procedure first, if needed). Otherwise, the step is taken by
+     *  integrating the interpolating polynomial through the accelerations in the stencil (see class description).
+     *  \param stepSize The step size to take.
+     *  \return The state at the end of the interval.
+     */
+    StateType performIntegrationStep( const TimeStepType stepSize )
+    {
+        if( !historyIsInitialized_ )
+        {
+            performStartup( );
+        }
+
+        if( stepSize != stepSize_ )
+        {
+            return performPartialStep( stepSize );
+        }
+
+        if( startupPointIndex_ < order_ )
+        {
+            // Retrieve state from startup procedure
+            lastIndependentVariable_ = currentIndependentVariable_;
+            lastState_ = currentState_;
+            startupPointIndex_++;
+            currentIndependentVariable_ += stepSize_;
+            currentState_ = startupStates_.at( startupPointIndex_ );
+            lastStepType_ = startup_step;
+        }
+        else
+        {
+            performGaussJacksonStep( );
+        }
+
+        return currentState_;
+    }
+
+    //! Rollback internal state to the last state.
+    /*!
+     *  Performs rollback of the internal state (including acceleration history and sums) to the last state. This function
+     *  can only be called once after calling integrateTo( ) or performIntegrationStep( ).
+     *  \return True if the rollback was successful.
+     */
+    bool rollbackToPreviousState( )
+    {
+        if( currentIndependentVariable_ == lastIndependentVariable_ || lastStepType_ == no_step )
+        {
+            return false;
+        }
+
+        switch( lastStepType_ )
+        {
+        case startup_step:
+            startupPointIndex_--;
+            historyIsInitialized_ = true;
+            break;
+        case gauss_jackson_step:
+            latestAccelerationIndex_ = ( latestAccelerationIndex_ + order_ + 1 ) % ( order_ + 2 );
+            firstSum_ = previousFirstSum_;
+            secondSum_ = previousSecondSum_;
+            historyIsInitialized_ = true;
+            break;
+        case partial_step:
+            historyIsInitialized_ = historyWasInitializedBeforePartialStep_;
+            break;
+        default:
+            break;
+        }
+
+        currentIndependentVariable_ = lastIndependentVariable_;
+        currentState_ = lastState_;
+        lastStepType_ = no_step;
+        return true;
+    }
+
+    //! Get previous independent variable.
+    IndependentVariableType getPreviousIndependentVariable( )
+    {
+        return lastIndependentVariable_;
+    }
+
+    //! Get previous state value.
+    StateType getPreviousState( )
+    {
+        return lastState_;
+    }
+
+    //! Replace the state with a new value.
+    /*!
+     *  Replace the state with a new value. If the new state differs from the current state, the acceleration history is
+     *  discarded, and the startup procedure is repeated at the next step.
+     *  \param newState The value of the new state.
+     *  \param allowRollback Boolean denoting whether roll-back should be allowed.
+     */
+    void modifyCurrentState( const StateType& newState, const bool allowRollback = false )
+    {
+        if( newState != currentState_ )
+        {
+            currentState_ = newState;
+            historyIsInitialized_ = false;
+        }
+
+        if ( !allowRollback )
+        {
+            lastIndependentVariable_ = currentIndependentVariable_;
+            lastStepType_ = no_step;
+        }
+    }
+
+    //! Modify the state and time for the current step.
+    /*!
+     *  Modify the state and time for the current step. The acceleration history is discarded, and the startup procedure is
+     *  repeated at the next step.
+     *  \param newState The new state to set the current state to.
+     *  \param newTime The time to set the current time to.
+     *  \param allowRollback Boolean denoting whether roll-back should be allowed.
+     */
+    void modifyCurrentIntegrationVariables( const StateType& newState, const IndependentVariableType newTime,
+                                            const bool allowRollback = false )
+    {
+        currentState_ = newState;
+        currentIndependentVariable_ = newTime;
+        historyIsInitialized_ = false;
+        if ( !allowRollback )
+        {
+            lastIndependentVariable_ = currentIndependentVariable_;
+            lastStepType_ = no_step;
+        }
+    }
+
+    //! Function to retrieve the coefficients of the integrator
+    const GaussJacksonCoefficients& getCoefficients( ) const
+    {
+        return coefficients_;
+    }
+
+private:
+
+    //! Types of step that can be undone by rollbackToPreviousState
+    enum GaussJacksonStepTypes
+    {
+        no_step,
+        startup_step,
+        gauss_jackson_step,
+        partial_step
+    };
+
+    //! Function to retrieve the acceleration at a given point of the stencil ending at the point with given history index
+    SecondOrderStateType& getStencilAcceleration( const int stencilIndex, const int lastHistoryIndex )
+    {
+        return accelerationHistory_[ ( lastHistoryIndex + 2 * ( order_ + 2 ) - order_ + stencilIndex ) % ( order_ + 2 ) ];
+    }
+
+    //! Function to split a state into its position and velocity rows
+    void splitState( const StateType& state, SecondOrderStateType& positions, SecondOrderStateType& velocities )
+    {
+        for( int i = 0; i < numberOfBlocks_; i++ )
+        {
+            positions.block( 3 * i, 0, 3, numberOfColumns_ ) = state.block( 6 * i, 0, 3, numberOfColumns_ );
+            velocities.block( 3 * i, 0, 3, numberOfColumns_ ) = state.block( 6 * i + 3, 0, 3, numberOfColumns_ );
+        }
+    }
+
+    //! Function to merge position and velocity rows into a state
+    void mergeState( const SecondOrderStateType& positions, const SecondOrderStateType& velocities, StateType& state )
+    {
+        state = currentState_;
+        for( int i = 0; i < numberOfBlocks_; i++ )
+        {
+            state.block( 6 * i, 0, 3, numberOfColumns_ ) = positions.block( 3 * i, 0, 3, numberOfColumns_ );
+            state.block( 6 * i + 3, 0, 3, numberOfColumns_ ) = velocities.block( 3 * i, 0, 3, numberOfColumns_ );
+        }
+    }
+
+    //! Function to evaluate the state derivative, and retrieve the accelerations (scaled with the step size squared)
+    void evaluateAccelerations( const IndependentVariableType time, const StateType& state,
+                                SecondOrderStateType& scaledAccelerations )
+    {
+        stateDerivative_ = this->stateDerivativeFunction_( time, state );
+        for( int i = 0; i < numberOfBlocks_; i++ )
+        {
+            scaledAccelerations.block( 3 * i, 0, 3, numberOfColumns_ ) =
+                    stateDerivative_.block( 6 * i + 3, 0, 3, numberOfColumns_ );
+        }
+    }
+
+    //! Function to compute weighted sum of accelerations in the stencil ending at the given history index
+    void addWeightedAccelerations( const Eigen::VectorXd& coefficients, const int lastHistoryIndex,
+                                   SecondOrderStateType& sum )
+    {
+        for( int j = 0; j <= order_; j++ )
+        {
+            sum += static_cast< StateScalarType >( coefficients( j ) ) * getStencilAcceleration( j, lastHistoryIndex );
+        }
+    }
+
+    //! Function to check whether the propagation termination function is reached at an intermediate evaluation
+    bool isTerminationConditionReached( const IndependentVariableType time )
+    {
+        if( this->propagationTerminationFunction_( static_cast< double >( time ), TUDAT_NAN ) )
+        {
+            this->propagationTerminationConditionReachedDuringStep_ = true;
+            return true;
+        }
+        return false;
+    }
+
+    //! Function to perform the startup procedure at the current state
+    /*!
+     *  Function to perform the startup procedure at the current state, computing the states, accelerations and sums at the
+     *  order + 1 nominal steps starting at the current epoch (see class description).
+     */
+    void performStartup( )
+    {
+        const StateScalarType scaledStepSize = static_cast< StateScalarType >( stepSize_ );
+        const StateScalarType squaredScaledStepSize = scaledStepSize * scaledStepSize;
+        const StateScalarType half = mathematical_constants::getFloatingInteger< StateScalarType >( 1 ) /
+                mathematical_constants::getFloatingInteger< StateScalarType >( 2 );
+
+        // Check that state derivative is consistent with a second-order system
+        startupStates_[ 0 ] = currentState_;
+        splitState( currentState_, startupPositions_[ 0 ], startupVelocities_[ 0 ] );
+        evaluateAccelerations( currentIndependentVariable_, currentState_, accelerationHistory_[ 0 ] );
+        for( int i = 0; i < numberOfBlocks_; i++ )
+        {
+            StateScalarType velocityNorm = startupVelocities_[ 0 ].block( 3 * i, 0, 3, numberOfColumns_ ).cwiseAbs( ).maxCoeff( );
+            StateScalarType difference =
+                    ( stateDerivative_.block( 6 * i, 0, 3, numberOfColumns_ ) -
+                      startupVelocities_[ 0 ].block( 3 * i, 0, 3, numberOfColumns_ ) ).cwiseAbs( ).maxCoeff( );
+            if( !( difference <= 1.0E-10 * velocityNorm ) )
+            {
+                throw std::runtime_error( "Error in Gauss-Jackson integrator, derivative of position rows is not equal to "
+                                          "velocity rows; only states consisting of Cartesian position and velocity "
+                                          "blocks are supported." );
+            }
+        }
+
+        // Compute initial estimates of states at startup points
+        RungeKutta4Integrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType > startupIntegrator(
+                    this->stateDerivativeFunction_, currentIndependentVariable_, currentState_, stepSize_ );
+        std::vector< IndependentVariableType > startupTimes( order_ + 1, currentIndependentVariable_ );
+        for( int k = 1; k <= order_; k++ )
+        {
+            startupStates_[ k ] = startupIntegrator.performIntegrationStep( stepSize_ );
+            startupTimes[ k ] = startupIntegrator.getCurrentIndependentVariable( );
+            splitState( startupStates_[ k ], startupPositions_[ k ], startupVelocities_[ k ] );
+            evaluateAccelerations( startupTimes[ k ], startupStates_[ k ], accelerationHistory_[ k ] );
+        }
+        latestAccelerationIndex_ = order_;
+
+        // Iterate on startup states using Gauss-Jackson corrector
+        const Eigen::MatrixXd& firstSumCoefficients = coefficients_.getFirstSumCoefficients( );
+        const Eigen::MatrixXd& secondSumCoefficients = coefficients_.getSecondSumCoefficients( );
+        bool isConverged = false;
+        int numberOfIterations = 0;
+        while( !isConverged )
+        {
+            if( numberOfIterations >= maximumNumberOfStartupIterations_ )
+            {
+                throw std::runtime_error( "Error in Gauss-Jackson integrator, startup procedure did not converge in " +
+                                          std::to_string( maximumNumberOfStartupIterations_ ) + " iterations." );
+            }
+
+            // Compute sums at initial point
+            firstSum_ = startupVelocities_[ 0 ] / scaledStepSize;
+            secondSum_ = startupPositions_[ 0 ] / squaredScaledStepSize;
+            for( int j = 0; j <= order_; j++ )
+            {
+                firstSum_ -= static_cast< StateScalarType >( firstSumCoefficients( 0, j ) ) * accelerationHistory_[ j ];
+                secondSum_ -= static_cast< StateScalarType >( secondSumCoefficients( 0, j ) ) * accelerationHistory_[ j ];
+            }
+
+            // Update sums, and correct position and velocity, at each startup point
+            StateScalarType maximumRelativeChange = mathematical_constants::getFloatingInteger< StateScalarType >( 0 );
+            for( int k = 1; k <= order_; k++ )
+            {
+                secondSum_ += firstSum_ + half * accelerationHistory_[ k - 1 ];
+                firstSum_ += half * ( accelerationHistory_[ k - 1 ] + accelerationHistory_[ k ] );
+
+                positions_ = secondSum_;
+                velocities_ = firstSum_;
+                for( int j = 0; j <= order_; j++ )
+                {
+                    positions_ += static_cast< StateScalarType >( secondSumCoefficients( k, j ) ) * accelerationHistory_[ j ];
+                    velocities_ += static_cast< StateScalarType >( firstSumCoefficients( k, j ) ) * accelerationHistory_[ j ];
+                }
+                positions_ *= squaredScaledStepSize;
+                velocities_ *= scaledStepSize;
+
+                maximumRelativeChange = std::max(
+                            maximumRelativeChange, getRelativeChange( startupPositions_[ k ], positions_ ) );
+                maximumRelativeChange = std::max(
+                            maximumRelativeChange, getRelativeChange( startupVelocities_[ k ], velocities_ ) );
+                startupPositions_[ k ] = positions_;
+                startupVelocities_[ k ] = velocities_;
+            }
+
+            // Re-evaluate accelerations at startup points
+            for( int k = 1; k <= order_; k++ )
+            {
+                mergeState( startupPositions_[ k ], startupVelocities_[ k ], startupStates_[ k ] );
+                evaluateAccelerations( startupTimes[ k ], startupStates_[ k ], accelerationHistory_[ k ] );
+            }
+
+            isConverged = ( maximumRelativeChange <= static_cast< StateScalarType >( startupTolerance_ ) );
+            numberOfIterations++;
+        }
+
+        // Compute sums at last point of startup, with final accelerations
+        firstSum_ = startupVelocities_[ 0 ] / scaledStepSize;
+        secondSum_ = startupPositions_[ 0 ] / squaredScaledStepSize;
+        for( int j = 0; j <= order_; j++ )
+        {
+            firstSum_ -= static_cast< StateScalarType >( firstSumCoefficients( 0, j ) ) * accelerationHistory_[ j ];
+            secondSum_ -= static_cast< StateScalarType >( secondSumCoefficients( 0, j ) ) * accelerationHistory_[ j ];
+        }
+        for( int k = 1; k <= order_; k++ )
+        {
+            secondSum_ += firstSum_ + half * accelerationHistory_[ k - 1 ];
+            firstSum_ += half * ( accelerationHistory_[ k - 1 ] + accelerationHistory_[ k ] );
+        }
+
+        startupPointIndex_ = 0;
+        historyIsInitialized_ = true;
+    }
+
+    //! Function to compute the maximum change of a matrix, relative to its maximum absolute value
+    StateScalarType getRelativeChange( const SecondOrderStateType& oldValue, const SecondOrderStateType& newValue )
+    {
+        StateScalarType maximumValue = newValue.cwiseAbs( ).maxCoeff( );
+        StateScalarType maximumChange = ( newValue - oldValue ).cwiseAbs( ).maxCoeff( );
+        if( maximumValue > mathematical_constants::getFloatingInteger< StateScalarType >( 0 ) )
+        {
+            return maximumChange / maximumValue;
+        }
+        else
+        {
+            return maximumChange;
+        }
+    }
+
+    //! Function to perform a Gauss-Jackson step with the nominal step size from the last point of the stencil
+    void performGaussJacksonStep( )
+    {
+        const StateScalarType scaledStepSize = static_cast< StateScalarType >( stepSize_ );
+        const StateScalarType squaredScaledStepSize = scaledStepSize * scaledStepSize;
+        const StateScalarType half = mathematical_constants::getFloatingInteger< StateScalarType >( 1 ) /
+                mathematical_constants::getFloatingInteger< StateScalarType >( 2 );
+        const int newAccelerationIndex = ( latestAccelerationIndex_ + 1 ) % ( order_ + 2 );
+        const IndependentVariableType newIndependentVariable = currentIndependentVariable_ + stepSize_;
+        const SecondOrderStateType& currentAcceleration = accelerationHistory_[ latestAccelerationIndex_ ];
+        SecondOrderStateType& newAcceleration = accelerationHistory_[ newAccelerationIndex ];
+
+        // Predict position and velocity
+        positions_ = secondSum_ + firstSum_;
+        velocities_ = firstSum_;
+        addWeightedAccelerations( coefficients_.getPositionPredictorCoefficients( ), latestAccelerationIndex_, positions_ );
+        addWeightedAccelerations( coefficients_.getVelocityPredictorCoefficients( ), latestAccelerationIndex_, velocities_ );
+        positions_ *= squaredScaledStepSize;
+        velocities_ *= scaledStepSize;
+
+        // Evaluate and correct (accelerations overwritten in history retained, in case the step is not completed)
+        overwrittenAcceleration_ = newAcceleration;
+        newSecondSum_ = secondSum_ + firstSum_ + half * currentAcceleration;
+        const Eigen::VectorXd firstSumCorrectorCoefficients = coefficients_.getFirstSumCoefficients( ).row( order_ ).transpose( );
+        const Eigen::VectorXd secondSumCorrectorCoefficients = coefficients_.getSecondSumCoefficients( ).row( order_ ).transpose( );
+        for( int i = 0; i < numberOfCorrectorIterations_; i++ )
+        {
+            mergeState( positions_, velocities_, newState_ );
+            evaluateAccelerations( newIndependentVariable, newState_, newAcceleration );
+            if( isTerminationConditionReached( newIndependentVariable ) )
+            {
+                newAcceleration = overwrittenAcceleration_;
+                return;
+            }
+
+            newFirstSum_ = firstSum_ + half * ( currentAcceleration + newAcceleration );
+            positions_ = newSecondSum_;
+            velocities_ = newFirstSum_;
+            addWeightedAccelerations( secondSumCorrectorCoefficients, newAccelerationIndex, positions_ );
+            addWeightedAccelerations( firstSumCorrectorCoefficients, newAccelerationIndex, velocities_ );
+            positions_ *= squaredScaledStepSize;
+            velocities_ *= scaledStepSize;
+        }
+        mergeState( positions_, velocities_, newState_ );
+
+        // Evaluate accelerations at corrected state, for use in next steps
+        if( evaluateCorrectedState_ )
+        {
+            evaluateAccelerations( newIndependentVariable, newState_, newAcceleration );
+            if( isTerminationConditionReached( newIndependentVariable ) )
+            {
+                newAcceleration = overwrittenAcceleration_;
+                return;
+            }
+            newFirstSum_ = firstSum_ + half * ( currentAcceleration + newAcceleration );
+        }
+
+        // Update history and sums
+        previousFirstSum_ = firstSum_;
+        previousSecondSum_ = secondSum_;
+        firstSum_ = newFirstSum_;
+        secondSum_ = newSecondSum_;
+        latestAccelerationIndex_ = newAccelerationIndex;
+
+        lastIndependentVariable_ = currentIndependentVariable_;
+        lastState_ = currentState_;
+        currentIndependentVariable_ = newIndependentVariable;
+        currentState_ = newState_;
+        lastStepType_ = gauss_jackson_step;
+    }
+
+    //! Function to perform a step that is not equal to the nominal step size
+    /*!
+     *  Function to perform a step that is not equal to the nominal step size, by integrating the interpolating polynomial
+     *  through the accelerations in the stencil. During the startup phase, the full (startup) stencil is used. Otherwise,
+     *  the step is predicted using the stencil ending at the current point, after which the accelerations are evaluated
+     *  at the end of the step, and the step is corrected using the polynomial through these accelerations and the last
+     *  order accelerations of the stencil. The acceleration history is not updated, so that the startup procedure is
+     *  repeated at the next step, unless the step is rolled back.
+     *  \param stepSize Step size to take
+     *  \return State at the end of the step
+     */
+    StateType performPartialStep( const TimeStepType stepSize )
+    {
+        const StateScalarType scaledStepSize = static_cast< StateScalarType >( stepSize_ );
+        const StateScalarType squaredScaledStepSize = scaledStepSize * scaledStepSize;
+        const long double stepFraction = static_cast< long double >( stepSize ) / static_cast< long double >( stepSize_ );
+        const IndependentVariableType newIndependentVariable = currentIndependentVariable_ + stepSize;
+
+        SecondOrderStateType currentPositions = positions_;
+        SecondOrderStateType currentVelocities = velocities_;
+        splitState( currentState_, currentPositions, currentVelocities );
+
+        // Predict state (or compute from startup stencil)
+        int lastHistoryIndex = latestAccelerationIndex_;
+        int currentPointIndex = ( startupPointIndex_ < order_ ) ? startupPointIndex_ : order_;
+        std::vector< long double > nodes( order_ + 1 );
+        for( int j = 0; j <= order_; j++ )
+        {
+            nodes[ j ] = static_cast< long double >( j - currentPointIndex );
+        }
+        Eigen::VectorXd positionCoefficients, velocityCoefficients;
+        GaussJacksonCoefficients::computeOrdinateIntegrationCoefficients(
+                    nodes, stepFraction, positionCoefficients, velocityCoefficients );
+
+        positions_ = currentPositions + static_cast< StateScalarType >( stepFraction ) * scaledStepSize * currentVelocities;
+        velocities_ = currentVelocities;
+        for( int j = 0; j <= order_; j++ )
+        {
+            positions_ += squaredScaledStepSize * static_cast< StateScalarType >( positionCoefficients( j ) ) *
+                    getStencilAcceleration( j, lastHistoryIndex );
+            velocities_ += scaledStepSize * static_cast< StateScalarType >( velocityCoefficients( j ) ) *
+                    getStencilAcceleration( j, lastHistoryIndex );
+        }
+
+        // Evaluate and correct, if beyond end of stencil
+        if( currentPointIndex == order_ )
+        {
+            mergeState( positions_, velocities_, newState_ );
+            evaluateAccelerations( newIndependentVariable, newState_, partialStepAcceleration_ );
+            if( isTerminationConditionReached( newIndependentVariable ) )
+            {
+                return currentState_;
+            }
+
+            for( int j = 0; j < order_; j++ )
+            {
+                nodes[ j ] = static_cast< long double >( j + 1 - order_ );
+            }
+            nodes[ order_ ] = stepFraction;
+            GaussJacksonCoefficients::computeOrdinateIntegrationCoefficients(
+                        nodes, stepFraction, positionCoefficients, velocityCoefficients );
+
+            positions_ = currentPositions + static_cast< StateScalarType >( stepFraction ) * scaledStepSize * currentVelocities;
+            velocities_ = currentVelocities;
+            for( int j = 0; j <= order_; j++ )
+            {
+                const SecondOrderStateType& acceleration =
+                        ( j < order_ ) ? getStencilAcceleration( j + 1, lastHistoryIndex ) : partialStepAcceleration_;
+                positions_ += squaredScaledStepSize * static_cast< StateScalarType >( positionCoefficients( j ) ) *
+                        acceleration;
+                velocities_ += scaledStepSize * static_cast< StateScalarType >( velocityCoefficients( j ) ) * acceleration;
+            }
+        }
+        mergeState( positions_, velocities_, newState_ );
+
+        lastIndependentVariable_ = currentIndependentVariable_;
+        lastState_ = currentState_;
+        currentIndependentVariable_ = newIndependentVariable;
+        currentState_ = newState_;
+
+        lastStepType_ = partial_step;
+        historyWasInitializedBeforePartialStep_ = historyIsInitialized_;
+        historyIsInitialized_ = false;
+
+        return currentState_;
+    }
+
+    //! Current independent variable.
+    IndependentVariableType currentIndependentVariable_;
+
+    //! Current state.
+    StateType currentState_;
+
+    //! Last independent variable.
+    IndependentVariableType lastIndependentVariable_;
+
+    //! Last state.
+    StateType lastState_;
+
+    //! Nominal (fixed) step size
+    TimeStepType stepSize_;
+
+    //! Coefficients of the integrator
+    GaussJacksonCoefficients coefficients_;
+
+    //! Order of the integrator
+    int order_;
+
+    //! Number of times the corrector is applied in each step
+    int numberOfCorrectorIterations_;
+
+    //! Boolean denoting whether the state derivative is evaluated at the corrected state of each step
+    bool evaluateCorrectedState_;
+
+    //! Relative tolerance for the convergence of the startup iterations
+    double startupTolerance_;
+
+    //! Maximum number of startup iterations
+    int maximumNumberOfStartupIterations_;
+
+    //! Number of blocks of six rows in the state
+    int numberOfBlocks_;
+
+    //! Number of columns in the state
+    int numberOfColumns_;
+
+    //! Boolean denoting whether the acceleration history and sums are valid for the current state
+    bool historyIsInitialized_;
+
+    //! Index of the current point in the startup stencil (equal to order if startup phase is finished)
+    int startupPointIndex_;
+
+    //! Index in accelerationHistory_ of the accelerations at the last point of the stencil
+    int latestAccelerationIndex_;
+
+    //! Type of the last step (to be undone by rollbackToPreviousState)
+    GaussJacksonStepTypes lastStepType_;
+
+    //! Value of historyIsInitialized_ before the last (partial) step
+    bool historyWasInitializedBeforePartialStep_;
+
+    //! Ring buffer of (order + 2) accelerations, of which the last order + 1 form the stencil
+    std::vector< SecondOrderStateType > accelerationHistory_;
+
+    //! First sum at the last point of the stencil
+    SecondOrderStateType firstSum_;
+
+    //! Second sum at the last point of the stencil
+    SecondOrderStateType secondSum_;
+
+    //! First sum before the last step (for rollback)
+    SecondOrderStateType previousFirstSum_;
+
+    //! Second sum before the last step (for rollback)
+    SecondOrderStateType previousSecondSum_;
+
+    //! Pre-declared first sum at new point, to prevent many (de-)allocations
+    SecondOrderStateType newFirstSum_;
+
+    //! Pre-declared second sum at new point, to prevent many (de-)allocations
+    SecondOrderStateType newSecondSum_;
+
+    //! Pre-declared positions, to prevent many (de-)allocations
+    SecondOrderStateType positions_;
+
+    //! Pre-declared velocities, to prevent many (de-)allocations
+    SecondOrderStateType velocities_;
+
+    //! Accelerations in history that are overwritten by the current step
+    SecondOrderStateType overwrittenAcceleration_;
+
+    //! Pre-declared accelerations at the end of a partial step, to prevent many (de-)allocations
+    SecondOrderStateType partialStepAcceleration_;
+
+    //! Pre-declared state at the end of a step, to prevent many (de-)allocations
+    StateType newState_;
+
+    //! Pre-declared state derivative, to prevent many (de-)allocations
+    StateDerivativeType stateDerivative_;
+
+    //! States at the points of the startup stencil
+    std::vector< StateType > startupStates_;
+
+    //! Positions at the points of the startup stencil
+    std::vector< SecondOrderStateType > startupPositions_;
+
+    //! Velocities at the points of the startup stencil
+    std::vector< SecondOrderStateType > startupVelocities_;
+};
+
+extern template class GaussJacksonIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
+extern template class GaussJacksonIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
+extern template class GaussJacksonIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
+
+#if( TUDAT_BUILD_WITH_EXTENDED_PRECISION_PROPAGATION_TOOLS )
+extern template class GaussJacksonIntegrator < double, VectorXdd, VectorXdd >;
+extern template class GaussJacksonIntegrator < Time, VectorXdd, VectorXdd, long double >;
+#endif
+
+//! Typedef of Gauss-Jackson integrator (state/state derivative = VectorXd, independent variable = double).
+typedef GaussJacksonIntegrator< > GaussJacksonIntegratorXd;
+
+} // namespace numerical_integrators
+
+} // namespace tudat
+
+#endif // TUDAT_GAUSS_JACKSON_INTEGRATOR_H
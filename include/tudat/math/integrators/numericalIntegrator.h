@@ -17,10 +17,12 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include <Eigen/Core>
 
 #include "tudat/basics/basicTypedefs.h"
+#include "tudat/basics/doubleDouble.h"
 #include "tudat/basics/timeType.h"
 #include "tudat/basics/utilityMacros.h"
 #include "tudat/math/basic/mathematicalConstants.h"
@@ -31,6 +33,45 @@ namespace tudat
 namespace numerical_integrators
 {
 
+//! Internal state of a numerical integrator, from which the integration can be continued identically
+/*!
+ * Internal state of a numerical integrator, from which the integration can be continued identically (e.g. after saving
+ * it to a checkpoint file). Next to the current and previous independent variable and state, and the step size, the
+ * quantities specific to the integrator (e.g. the state and derivative history of a multi-step method) are stored in the
+ * additional* members, in an order defined by the integrator.
+ */
+template< typename IndependentVariableType = double, typename StateType = Eigen::VectorXd,
+          typename StateDerivativeType = StateType, typename TimeStepType = IndependentVariableType >
+struct NumericalIntegratorCheckpoint
+{
+    //! Current independent variable of integrator.
+    IndependentVariableType currentIndependentVariable_;
+
+    //! Current state of integrator.
+    StateType currentState_;
+
+    //! Previous independent variable of integrator (used for rollback).
+    IndependentVariableType lastIndependentVariable_;
+
+    //! Previous state of integrator (used for rollback).
+    StateType lastState_;
+
+    //! Step size to be used for the next step.
+    TimeStepType stepSize_;
+
+    //! Additional integer/boolean quantities of integrator (e.g. current order).
+    std::vector< int > additionalIntegerValues_;
+
+    //! Additional step sizes of integrator (e.g. previous step size).
+    std::vector< TimeStepType > additionalStepSizes_;
+
+    //! Additional states of integrator (e.g. state history).
+    std::vector< StateType > additionalStates_;
+
+    //! Additional state derivatives of integrator (e.g. state derivative history).
+    std::vector< StateDerivativeType > additionalStateDerivatives_;
+};
+
 //! Base class for the numerical integrators.
 /*!
  * Base class for numerical integrators.
@@ -129,6 +170,32 @@ public:
         throw std::runtime_error( "Function getPreviousState not implemented in this integrator" );
     }
 
+    //! Function to check whether a continuous extension (dense output) is available for the last step
+    /*!
+     * Function to check whether a continuous extension (dense output) is available for the last step, i.e. whether the
+     * state at any epoch between the previous and current independent variable can be retrieved with getDenseOutputState,
+     * without performing an additional integration step. Derived classes that provide dense output should override this.
+     * \return True if dense output is available for the last step.
+     */
+    virtual bool isDenseOutputAvailable( )
+    {
+        return false;
+    }
+
+    //! Function to retrieve the state at a given epoch inside the last step from the continuous extension
+    /*!
+     * Function to retrieve the state at a given epoch between the previous and current independent variable from the
+     * continuous extension (dense output) of the last step. Derived classes that provide dense output should override this.
+     * If not implemented, throws error.
+     * \param independentVariable Value of independent variable at which the state is to be retrieved
+     * \return State at requested independent variable
+     */
+    virtual StateType getDenseOutputState( const IndependentVariableType independentVariable )
+    {
+        TUDAT_UNUSED_PARAMETER( independentVariable );
+        throw std::runtime_error( "Function getDenseOutputState not implemented in this integrator" );
+    }
+
     //! Perform an integration to a specified independent variable value.
     /*!
      * Performs an integration to independentVariableEnd with initial state and initial independent
@@ -190,6 +257,17 @@ public:
         propagationTerminationFunction_ = terminationFunction;
     }
 
+    //! Function to retrieve the number of rejected integration steps
+    /*!
+     *  Function to retrieve the number of integration steps that were rejected (and redone with a smaller step size) by
+     *  the step-size control since the creation of the integrator. Always zero for fixed step-size integrators.
+     *  \return Number of rejected integration steps
+     */
+    int getNumberOfRejectedSteps( ) const
+    {
+        return numberOfRejectedSteps_;
+    }
+
     //! Function to toggle the use of step-size control
     /*!
      * Function to toggle the use of step-size control. To be implemented in derived classes with variable step sizes
@@ -233,6 +311,33 @@ public:
                                   "been implemented in this integrator." );
     }
 
+    //! Function to retrieve the internal state of the integrator, from which the integration can be continued identically
+    /*!
+     * Function to retrieve the internal state of the integrator, from which the integration can be continued identically
+     * using resetFromCheckpoint. Derived classes that support checkpointing should override this; if not implemented,
+     * throws error.
+     * \return Internal state of the integrator
+     */
+    virtual NumericalIntegratorCheckpoint< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+    getCheckpoint( ) const
+    {
+        throw std::runtime_error( "Error in numerical integrator, checkpointing is not supported for this integrator." );
+    }
+
+    //! Function to reset the internal state of the integrator to a checkpoint
+    /*!
+     * Function to reset the internal state of the integrator to a checkpoint, as retrieved from getCheckpoint of an
+     * integrator of the same type and settings. Derived classes that support checkpointing should override this; if not
+     * implemented, throws error.
+     * \param checkpoint Internal state of the integrator to which it is to be reset
+     */
+    virtual void resetFromCheckpoint(
+            const NumericalIntegratorCheckpoint< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >& checkpoint )
+    {
+        TUDAT_UNUSED_PARAMETER( checkpoint );
+        throw std::runtime_error( "Error in numerical integrator, checkpointing is not supported for this integrator." );
+    }
+
 protected:
 
     //! Function that returns the state derivative.
@@ -257,6 +362,9 @@ protected:
      *  checked during the integration subteps.
      */
     std::function< bool( const double, const double ) > propagationTerminationFunction_;
+
+    //! Number of integration steps rejected by the step-size control, since the creation of the integrator
+    int numberOfRejectedSteps_ = 0;
 };
 
 
@@ -264,6 +372,11 @@ extern template class NumericalIntegrator < double, Eigen::VectorXd, Eigen::Vect
 extern template class NumericalIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
 extern template class NumericalIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
 
+#if( TUDAT_BUILD_WITH_EXTENDED_PRECISION_PROPAGATION_TOOLS )
+extern template class NumericalIntegrator < double, VectorXdd, VectorXdd >;
+extern template class NumericalIntegrator < Time, VectorXdd, VectorXdd, long double >;
+#endif
+
 //! Perform an integration to a specified independent variable value.
 template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
 StateType NumericalIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >::integrateTo(
@@ -69,6 +69,11 @@ extern template class ReinitializableNumericalIntegrator < double, Eigen::Vector
 extern template class ReinitializableNumericalIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
 extern template class ReinitializableNumericalIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
 
+#if( TUDAT_BUILD_WITH_EXTENDED_PRECISION_PROPAGATION_TOOLS )
+extern template class ReinitializableNumericalIntegrator < double, VectorXdd, VectorXdd >;
+extern template class ReinitializableNumericalIntegrator < Time, VectorXdd, VectorXdd, long double >;
+#endif
+
 //! Typedef for shared-pointer to default, re-initializable numerical integrator.
 /*!
  * Typedef for shared-pointer to a default, re-initializable numerical integrator
@@ -89,6 +89,11 @@ extern template class RungeKutta4Integrator < double, Eigen::VectorXd, Eigen::Ve
 extern template class RungeKutta4Integrator < double, Eigen::Vector6d, Eigen::Vector6d >;
 extern template class RungeKutta4Integrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
 
+#if( TUDAT_BUILD_WITH_EXTENDED_PRECISION_PROPAGATION_TOOLS )
+extern template class RungeKutta4Integrator < double, VectorXdd, VectorXdd >;
+extern template class RungeKutta4Integrator < Time, VectorXdd, VectorXdd, long double >;
+#endif
+
 
 //! Typedef of RK4 integrator (state/state derivative = VectorXd, independent variable = double).
 /*!
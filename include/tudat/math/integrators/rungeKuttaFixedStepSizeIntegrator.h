@@ -308,6 +308,40 @@ public:
         }
     }
 
+    //! Function to retrieve the internal state of the integrator, from which the integration can be continued identically
+    /*!
+     * Function to retrieve the internal state of the integrator, from which the integration can be continued identically
+     * using resetFromCheckpoint.
+     * \return Internal state of the integrator
+     */
+    NumericalIntegratorCheckpoint< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+    getCheckpoint( ) const
+    {
+        NumericalIntegratorCheckpoint< IndependentVariableType, StateType, StateDerivativeType, TimeStepType > checkpoint;
+        checkpoint.currentIndependentVariable_ = currentIndependentVariable_;
+        checkpoint.currentState_ = currentState_;
+        checkpoint.lastIndependentVariable_ = lastIndependentVariable_;
+        checkpoint.lastState_ = lastState_;
+        checkpoint.stepSize_ = stepSize_;
+        return checkpoint;
+    }
+
+    //! Function to reset the internal state of the integrator to a checkpoint
+    /*!
+     * Function to reset the internal state of the integrator to a checkpoint, as retrieved from getCheckpoint of an
+     * integrator of the same type and settings.
+     * \param checkpoint Internal state of the integrator to which it is to be reset
+     */
+    void resetFromCheckpoint(
+            const NumericalIntegratorCheckpoint< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >& checkpoint )
+    {
+        currentIndependentVariable_ = checkpoint.currentIndependentVariable_;
+        currentState_ = checkpoint.currentState_;
+        lastIndependentVariable_ = checkpoint.lastIndependentVariable_;
+        lastState_ = checkpoint.lastState_;
+        stepSize_ = checkpoint.stepSize_;
+    }
+
 protected:
 
     //! Current independent variable.
@@ -360,6 +394,11 @@ extern template class RungeKuttaFixedStepSizeIntegrator < double, Eigen::VectorX
 extern template class RungeKuttaFixedStepSizeIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
 extern template class RungeKuttaFixedStepSizeIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
 
+#if( TUDAT_BUILD_WITH_EXTENDED_PRECISION_PROPAGATION_TOOLS )
+extern template class RungeKuttaFixedStepSizeIntegrator < double, VectorXdd, VectorXdd >;
+extern template class RungeKuttaFixedStepSizeIntegrator < Time, VectorXdd, VectorXdd, long double >;
+#endif
+
 
 //! Typedef of RK fixed-step integrator (state/state derivative = VectorXd, independent variable = double).
 /*!
@@ -30,6 +30,7 @@
 #include "tudat/basics/utilityMacros.h"
 #include "tudat/math/integrators/reinitializableNumericalIntegrator.h"
 #include "tudat/math/integrators/rungeKuttaCoefficients.h"
+#include "tudat/math/integrators/staticRungeKuttaCoefficients.h"
 #include "tudat/math/integrators/stepSizeController.h"
 
 namespace tudat
@@ -156,6 +157,9 @@ public:
             stepSizeValidator->resetMinimumIntegrationTimeStepHandling( set_to_minimum_step_silently );
         }
         stepSizeValidator_ = stepSizeValidator;
+
+        // Check if the stage loop unrolled at compile time can be used for these coefficients.
+        staticCoefficientSet_ = getMatchingStaticRungeKuttaCoefficientSet( coefficients_ );
     }
 
     //! Default constructor.
@@ -208,9 +212,9 @@ public:
     {
         stepSizeController_ = std::make_shared< PerElementIntegratorStepSizeController< TimeStepType, StateType > >(
             StateType::Constant( initialState.rows( ), initialState.cols( ),
-                                 std::fabs( relativeErrorTolerance ) ),
+                                 std::fabs( static_cast< double >( relativeErrorTolerance ) ) ),
             StateType::Constant( initialState.rows( ), initialState.cols( ),
-                                 std::fabs( absoluteErrorTolerance ) ),
+                                 std::fabs( static_cast< double >( absoluteErrorTolerance ) ) ),
             static_cast< double >( safetyFactorForNextStepSize ), coefficients_.lowerOrder + 1,
             static_cast< double >( minimumFactorDecreaseForNextStepSize ),
             static_cast< double >( maximumFactorIncreaseForNextStepSize) );
@@ -233,6 +237,9 @@ public:
         {
             throw std::runtime_error( "Error when creating variable step-size RK integrator, fixed step coefficients are used ("+ coefficients_.name +")." );
         }
+
+        // Check if the stage loop unrolled at compile time can be used for these coefficients.
+        staticCoefficientSet_ = getMatchingStaticRungeKuttaCoefficientSet( coefficients_ );
     }
 
     RungeKuttaVariableStepSizeIntegrator(
@@ -260,6 +267,9 @@ public:
         {
             throw std::runtime_error( "Error when creating variable step-size RK integrator, fixed step coefficients are used ("+ coefficients_.name +")." );
         }
+
+        // Check if the stage loop unrolled at compile time can be used for these coefficients.
+        staticCoefficientSet_ = getMatchingStaticRungeKuttaCoefficientSet( coefficients_ );
     }
 
     //! Get step size of the next step.
@@ -294,7 +304,8 @@ public:
      */
     std::vector< StateDerivativeType > getCurrentStateDerivatives( )
     {
-        return currentStateDerivatives_;
+        return std::vector< StateDerivativeType >(
+                    currentStateDerivatives_.begin( ), currentStateDerivatives_.begin( ) + numberOfEvaluatedStages_ );
     }
 
     //! Perform a single integration step.
@@ -321,6 +332,12 @@ public:
             return false;
         }
 
+        // Remove node at end of undone step from dense output
+        if( denseOutputTimes_.size( ) > 0 && denseOutputTimes_.back( ) == this->currentIndependentVariable_ )
+        {
+            removeLastDenseOutputNode( );
+        }
+
         this->currentIndependentVariable_ = this->lastIndependentVariable_;
         this->currentState_ = this->lastState_;
         return true;
@@ -358,6 +375,10 @@ public:
      */
     void modifyCurrentState( const StateType& newState, const bool allowRollback = false )
     {
+        if( !( newState == currentState_ ) )
+        {
+            resetDenseOutput( );
+        }
         currentState_ = newState;
         if ( !allowRollback )
         {
@@ -375,6 +396,7 @@ public:
     void modifyCurrentIntegrationVariables( const StateType& newState, const IndependentVariableType newTime,
                                             const bool allowRollback = false )
     {
+        resetDenseOutput( );
         currentState_ = newState;
         currentIndependentVariable_ = newTime;
         if ( !allowRollback )
@@ -383,6 +405,41 @@ public:
         }
     }
 
+    //! Function to retrieve the internal state of the integrator, from which the integration can be continued identically
+    /*!
+     * Function to retrieve the internal state of the integrator, from which the integration can be continued identically
+     * using resetFromCheckpoint.
+     * \return Internal state of the integrator
+     */
+    NumericalIntegratorCheckpoint< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+    getCheckpoint( ) const
+    {
+        NumericalIntegratorCheckpoint< IndependentVariableType, StateType, StateDerivativeType, TimeStepType > checkpoint;
+        checkpoint.currentIndependentVariable_ = currentIndependentVariable_;
+        checkpoint.currentState_ = currentState_;
+        checkpoint.lastIndependentVariable_ = lastIndependentVariable_;
+        checkpoint.lastState_ = lastState_;
+        checkpoint.stepSize_ = stepSize_;
+        return checkpoint;
+    }
+
+    //! Function to reset the internal state of the integrator to a checkpoint
+    /*!
+     * Function to reset the internal state of the integrator to a checkpoint, as retrieved from getCheckpoint of an
+     * integrator of the same type and settings. The dense output of the last step is cleared.
+     * \param checkpoint Internal state of the integrator to which it is to be reset
+     */
+    void resetFromCheckpoint(
+            const NumericalIntegratorCheckpoint< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >& checkpoint )
+    {
+        resetDenseOutput( );
+        currentIndependentVariable_ = checkpoint.currentIndependentVariable_;
+        currentState_ = checkpoint.currentState_;
+        lastIndependentVariable_ = checkpoint.lastIndependentVariable_;
+        lastState_ = checkpoint.lastState_;
+        stepSize_ = checkpoint.stepSize_;
+    }
+
     //! Function to toggle the use of step-size control
     /*!
      * Function to toggle the use of step-size control
@@ -409,8 +466,177 @@ public:
         return stepSizeValidator_;
     }
 
+    //! Function to set whether the stage loop unrolled at compile time is to be used (if available for the coefficients)
+    /*!
+     * Function to set whether the stage loop unrolled at compile time is to be used. This loop is used by default if the
+     * coefficients of the integrator are identical to one of the StaticRungeKuttaCoefficients specializations, and
+     * skips all structural zeros of the Butcher tableau when computing the intermediate states and the lower and higher
+     * order estimates. The results are identical to those of the runtime stage loop.
+     * \param useStaticCoefficients Boolean denoting whether the compile-time stage loop is to be used
+     */
+    void setUseStaticCoefficients( const bool useStaticCoefficients )
+    {
+        useStaticCoefficients_ = useStaticCoefficients;
+    }
+
+    //! Function to retrieve the coefficient set for which the stage loop is unrolled at compile time
+    /*!
+     * Function to retrieve the coefficient set for which the stage loop is unrolled at compile time.
+     * \return Coefficient set for which the stage loop is unrolled at compile time (undefinedCoefficientSet if the
+     * runtime stage loop is used)
+     */
+    CoefficientSets getStaticCoefficientSet( ) const
+    {
+        return useStaticCoefficients_ ? staticCoefficientSet_ : undefinedCoefficientSet;
+    }
+
+    //! Function to set whether a continuous extension (dense output) is to be maintained for each accepted step
+    /*!
+     * Function to set whether a continuous extension (dense output) is to be maintained for each accepted step. The
+     * continuous extension is a Hermite interpolant through the states and state derivatives at the boundaries of the
+     * last step, extended with those at the start of the step before it when available (quintic instead of cubic
+     * polynomial). The state derivative at the end of the step is computed only when the dense output is first
+     * requested for the step, and is reused as the first stage of the next step, so that no additional state derivative
+     * evaluations are required. Since the dense output is of lower order than the integrator itself, its error will
+     * typically be larger than the local error of the integration step.
+     * \param useDenseOutput Boolean denoting whether dense output is to be maintained
+     */
+    void setDenseOutput( const bool useDenseOutput )
+    {
+        useDenseOutput_ = useDenseOutput;
+        resetDenseOutput( );
+    }
+
+    //! Function to retrieve whether a continuous extension (dense output) is maintained for each accepted step
+    bool getDenseOutput( )
+    {
+        return useDenseOutput_;
+    }
+
+    //! Function to check whether a continuous extension (dense output) is available for the last step
+    /*!
+     * Function to check whether a continuous extension (dense output) is available for the last step. This is the case
+     * if dense output is used (see setDenseOutput), and the state has not been modified since the last accepted step.
+     * \return True if dense output is available for the last step.
+     */
+    virtual bool isDenseOutputAvailable( )
+    {
+        return useDenseOutput_ && denseOutputTimes_.size( ) > 1 &&
+                denseOutputTimes_.back( ) == currentIndependentVariable_;
+    }
+
+    //! Function to retrieve the state at a given epoch inside the last step from the continuous extension
+    /*!
+     * Function to retrieve the state at a given epoch between the previous and current independent variable from the
+     * continuous extension (dense output) of the last step (see setDenseOutput).
+     * \param independentVariable Value of independent variable at which the state is to be retrieved
+     * \return State at requested independent variable
+     */
+    virtual StateType getDenseOutputState( const IndependentVariableType independentVariable );
+
 protected:
 
+    //! Function to remove all nodes from the continuous extension (dense output)
+    void resetDenseOutput( )
+    {
+        denseOutputTimes_.clear( );
+        denseOutputStates_.clear( );
+        denseOutputStateDerivatives_.clear( );
+        isLastDenseOutputStateDerivativeSet_ = false;
+    }
+
+    //! Function to remove the node at the end of the last step from the continuous extension (dense output)
+    void removeLastDenseOutputNode( )
+    {
+        denseOutputTimes_.pop_back( );
+        denseOutputStates_.pop_back( );
+        denseOutputStateDerivatives_.pop_back( );
+
+        // State derivatives at all remaining nodes are known (first stages of accepted steps)
+        isLastDenseOutputStateDerivativeSet_ = ( denseOutputTimes_.size( ) > 0 );
+    }
+
+    //! Function to add the results of an accepted step as node of the continuous extension (dense output)
+    /*!
+     * Function to add the results of an accepted step as node of the continuous extension (dense output). Must be called
+     * before the current state and independent variable are updated to the end of the step.
+     * \param stepSize Size of the accepted step
+     * \param newState State at the end of the accepted step
+     */
+    void addDenseOutputNode( const TimeStepType stepSize, const StateType& newState );
+
+    //! Function to compute the state derivatives of all stages, and the lower and higher order estimates (runtime loop)
+    /*!
+     * Function to compute the state derivatives of all stages, and the lower and higher order estimates at the end of the
+     * step, looping over the runtime coefficients of the Butcher tableau.
+     * \param stepSize Step size of the current step
+     * \param lowerOrderEstimate Lower order estimate of the state at the end of the step (returned by reference)
+     * \param higherOrderEstimate Higher order estimate of the state at the end of the step (returned by reference)
+     * \return False if the propagation termination condition was reached during one of the stages, true otherwise
+     */
+    bool computeStages( const TimeStepType stepSize, StateType& lowerOrderEstimate, StateType& higherOrderEstimate );
+
+    //! Function to compute the state derivatives of all stages, and the lower and higher order estimates (unrolled loop)
+    /*!
+     * Function to compute the state derivatives of all stages, and the lower and higher order estimates at the end of the
+     * step, with the loops over the stages and over the coefficients of the Butcher tableau unrolled at compile time.
+     * \param stepSize Step size of the current step
+     * \param lowerOrderEstimate Lower order estimate of the state at the end of the step (returned by reference)
+     * \param higherOrderEstimate Higher order estimate of the state at the end of the step (returned by reference)
+     * \return False if the propagation termination condition was reached during one of the stages, true otherwise
+     */
+    template< CoefficientSets CoefficientSet >
+    bool computeStagesWithStaticCoefficients(
+            const TimeStepType stepSize, StateType& lowerOrderEstimate, StateType& higherOrderEstimate )
+    {
+        return computeStagesWithStaticCoefficients< CoefficientSet >(
+                    stepSize, lowerOrderEstimate, higherOrderEstimate,
+                    std::make_integer_sequence< int, StaticRungeKuttaCoefficients< CoefficientSet >::numberOfStages >( ) );
+    }
+
+    //! Function to compute the state derivatives of all stages, and the lower and higher order estimates (unrolled loop)
+    template< CoefficientSets CoefficientSet, int... Stages >
+    bool computeStagesWithStaticCoefficients(
+            const TimeStepType stepSize, StateType& lowerOrderEstimate, StateType& higherOrderEstimate,
+            std::integer_sequence< int, Stages... > )
+    {
+        // Evaluate the stages in order, stopping at the first stage for which the termination condition is reached.
+        if( !( computeStageWithStaticCoefficients< CoefficientSet, Stages >( stepSize ) && ... ) )
+        {
+            return false;
+        }
+
+        computeStaticTableauRowCombination< CoefficientSet, true, 0 >(
+                    this->currentState_, stepSize, currentStateDerivatives_, lowerOrderEstimate );
+        computeStaticTableauRowCombination< CoefficientSet, true, 1 >(
+                    this->currentState_, stepSize, currentStateDerivatives_, higherOrderEstimate );
+        return true;
+    }
+
+    //! Function to compute the intermediate state and state derivative of a single stage (unrolled loop)
+    template< CoefficientSets CoefficientSet, int Stage >
+    bool computeStageWithStaticCoefficients( const TimeStepType stepSize )
+    {
+        computeStaticTableauRowCombination< CoefficientSet, false, Stage >(
+                    this->currentState_, stepSize, currentStateDerivatives_, intermediateState_ );
+        return evaluateStageStateDerivative(
+                    Stage, StaticRungeKuttaCoefficients< CoefficientSet >::cCoefficients[ Stage ], stepSize,
+                    intermediateState_ );
+    }
+
+    //! Function to evaluate the state derivative of a single stage, from its intermediate state
+    /*!
+     * Function to evaluate the state derivative of a single stage, from its intermediate state. The state derivative at
+     * the current state is reused if already computed for the dense output.
+     * \param stage Index of the stage
+     * \param cCoefficient c-coefficient of the stage (fraction of the step at which the stage is evaluated)
+     * \param stepSize Step size of the current step
+     * \param intermediateState Intermediate state of the stage
+     * \return False if the propagation termination condition was reached during the stage, true otherwise
+     */
+    bool evaluateStageStateDerivative( const int stage, const double cCoefficient, const TimeStepType stepSize,
+                                       const StateType& intermediateState );
+
     //! Computes the next step size and validates the result.
     /*!
      * Computes the next step size based on a higher and lower order estimate, determines if the
@@ -480,6 +706,23 @@ protected:
      */
     std::vector< StateDerivativeType > currentStateDerivatives_;
 
+    //! Number of entries of currentStateDerivatives_ that have been evaluated in the current step.
+    int numberOfEvaluatedStages_ = 0;
+
+    //! Coefficient set with compile-time Butcher tableau identical to coefficients_ (undefinedCoefficientSet if none)
+    CoefficientSets staticCoefficientSet_ = undefinedCoefficientSet;
+
+    //! Boolean denoting whether the stage loop unrolled at compile time is used (if staticCoefficientSet_ is defined)
+    bool useStaticCoefficients_ = true;
+
+    //! Work variable for the intermediate state of each stage (member to prevent reallocation during each step)
+    StateType intermediateState_;
+
+    //! Work variable for the lower order estimate of the state at the end of the step
+    StateType lowerOrderEstimate_;
+
+    //! Work variable for the higher order estimate of the state at the end of the step
+    StateType higherOrderEstimate_;
 
 
     std::shared_ptr< IntegratorStepSizeController< TimeStepType, StateType > > stepSizeController_;
@@ -489,12 +732,33 @@ protected:
     //! Boolean denoting whether step size control is to be used
     bool useStepSizeControl_;
 
+    //! Boolean denoting whether a continuous extension (dense output) is maintained for each accepted step
+    bool useDenseOutput_ = false;
+
+    //! Values of independent variable at the nodes of the continuous extension (end of last accepted steps)
+    std::vector< IndependentVariableType > denseOutputTimes_;
+
+    //! States at the nodes of the continuous extension
+    std::vector< StateType > denseOutputStates_;
+
+    //! State derivatives at the nodes of the continuous extension (last entry only valid if
+    //! isLastDenseOutputStateDerivativeSet_ is true)
+    std::vector< StateDerivativeType > denseOutputStateDerivatives_;
+
+    //! Boolean denoting whether the state derivative at the last node of the continuous extension has been computed
+    bool isLastDenseOutputStateDerivativeSet_ = false;
+
 };
 
 extern template class RungeKuttaVariableStepSizeIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
 extern template class RungeKuttaVariableStepSizeIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
 extern template class RungeKuttaVariableStepSizeIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
 
+#if( TUDAT_BUILD_WITH_EXTENDED_PRECISION_PROPAGATION_TOOLS )
+extern template class RungeKuttaVariableStepSizeIntegrator < double, VectorXdd, VectorXdd >;
+extern template class RungeKuttaVariableStepSizeIntegrator < Time, VectorXdd, VectorXdd, long double >;
+#endif
+
 
 //! Perform a single integration step.
 template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
@@ -507,45 +771,45 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
         throw std::invalid_argument( "Error in RKF integrator, step size is NaN" );
     }
 
-    // Define and allocated vector for the number of stages.
-    currentStateDerivatives_.clear( );
-    currentStateDerivatives_.reserve( this->coefficients_.cCoefficients.rows( ) );
-
-    // Define lower and higher order estimates.
-    StateType lowerOrderEstimate( this->currentState_ ), higherOrderEstimate( this->currentState_ );
-
-    // Compute the k_i state derivatives per stage.
-    for ( int stage = 0; stage < this->coefficients_.cCoefficients.rows( ); stage++ )
+    // Allocate vector for the number of stages (storage of the entries is reused in subsequent steps).
+    if( static_cast< int >( currentStateDerivatives_.size( ) ) != this->coefficients_.cCoefficients.rows( ) )
     {
-        // Compute the intermediate state to pass to the state derivative for this stage.
-        StateType intermediateState( this->currentState_ );
-
-        // Compute the intermediate state.
-        for ( int column = 0; column < stage; column++ )
-        {
-            intermediateState += stepSize * this->coefficients_.aCoefficients( stage, column ) *
-                    currentStateDerivatives_[ column ];
-        }
-
-        // Compute the state derivative.
-        const IndependentVariableType time = this->currentIndependentVariable_ +
-                this->coefficients_.cCoefficients( stage ) * stepSize;
-        currentStateDerivatives_.push_back( this->stateDerivativeFunction_( time, intermediateState ) );
-
-        // Check if propagation should terminate because the propagation termination condition has been reached
-        // while computing the intermediate state.
-        // If so, return immediately the current state (not recomputed yet), which will be discarded.
-        if ( this->propagationTerminationFunction_( static_cast< double >( time ), TUDAT_NAN ) )
-        {
-            this->propagationTerminationConditionReachedDuringStep_ = true;
-            return this->currentState_;
-        }
+        currentStateDerivatives_.resize( this->coefficients_.cCoefficients.rows( ) );
+    }
+    numberOfEvaluatedStages_ = 0;
+
+    // Compute the k_i state derivatives per stage, and the lower and higher order estimates (in pre-allocated work
+    // variables). If the propagation termination condition has been reached while computing the intermediate states,
+    // return immediately the current state (not recomputed yet), which will be discarded.
+    StateType& lowerOrderEstimate = lowerOrderEstimate_;
+    StateType& higherOrderEstimate = higherOrderEstimate_;
+    bool isStepCompleted = false;
+    switch( getStaticCoefficientSet( ) )
+    {
+    case rungeKuttaFehlberg45:
+        isStepCompleted = computeStagesWithStaticCoefficients< rungeKuttaFehlberg45 >(
+                    stepSize, lowerOrderEstimate, higherOrderEstimate );
+        break;
+    case rungeKuttaFehlberg78:
+        isStepCompleted = computeStagesWithStaticCoefficients< rungeKuttaFehlberg78 >(
+                    stepSize, lowerOrderEstimate, higherOrderEstimate );
+        break;
+    case rungeKutta87DormandPrince:
+        isStepCompleted = computeStagesWithStaticCoefficients< rungeKutta87DormandPrince >(
+                    stepSize, lowerOrderEstimate, higherOrderEstimate );
+        break;
+    case rungeKuttaFeagin1210:
+        isStepCompleted = computeStagesWithStaticCoefficients< rungeKuttaFeagin1210 >(
+                    stepSize, lowerOrderEstimate, higherOrderEstimate );
+        break;
+    default:
+        isStepCompleted = computeStages( stepSize, lowerOrderEstimate, higherOrderEstimate );
+        break;
+    }
 
-        // Update the estimate.
-        lowerOrderEstimate += this->coefficients_.bCoefficients( 0, stage ) * stepSize *
-                currentStateDerivatives_[ stage ];
-        higherOrderEstimate += this->coefficients_.bCoefficients( 1, stage ) * stepSize *
-                currentStateDerivatives_[ stage ];
+    if( !isStepCompleted )
+    {
+        return this->currentState_;
     }
 
     // Determine if the error was within bounds and compute a new step size.
@@ -553,6 +817,12 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
                                                higherOrderEstimate, stepSize ) )
     {
         // Accept the current step.
+        if( useDenseOutput_ )
+        {
+            addDenseOutputNode( stepSize, ( this->coefficients_.orderEstimateToIntegrate == RungeKuttaCoefficients::lower ) ?
+                                    lowerOrderEstimate : higherOrderEstimate );
+        }
+
         this->lastIndependentVariable_ = this->currentIndependentVariable_;
         this->lastState_ = this->currentState_;
         this->currentIndependentVariable_ += stepSize;
@@ -574,10 +844,202 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
     else
     {
         // Reject current step.
+        this->numberOfRejectedSteps_++;
         return performIntegrationStep( this->stepSize_ );
     }
 }
 
+//! Compute the state derivatives of all stages, and the lower and higher order estimates (runtime loop).
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+bool RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+::computeStages( const TimeStepType stepSize, StateType& lowerOrderEstimate, StateType& higherOrderEstimate )
+{
+    lowerOrderEstimate = this->currentState_;
+    higherOrderEstimate = this->currentState_;
+
+    for ( int stage = 0; stage < this->coefficients_.cCoefficients.rows( ); stage++ )
+    {
+        // Compute the intermediate state to pass to the state derivative for this stage.
+        StateType& intermediateState = intermediateState_;
+        intermediateState = this->currentState_;
+
+        // Compute the intermediate state.
+        for ( int column = 0; column < stage; column++ )
+        {
+            intermediateState += stepSize * this->coefficients_.aCoefficients( stage, column ) *
+                    currentStateDerivatives_[ column ];
+        }
+
+        if( !evaluateStageStateDerivative( stage, this->coefficients_.cCoefficients( stage ), stepSize, intermediateState ) )
+        {
+            return false;
+        }
+
+        // Update the estimate.
+        lowerOrderEstimate += this->coefficients_.bCoefficients( 0, stage ) * stepSize *
+                currentStateDerivatives_[ stage ];
+        higherOrderEstimate += this->coefficients_.bCoefficients( 1, stage ) * stepSize *
+                currentStateDerivatives_[ stage ];
+    }
+    return true;
+}
+
+//! Evaluate the state derivative of a single stage, from its intermediate state.
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+bool RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+::evaluateStageStateDerivative( const int stage, const double cCoefficient, const TimeStepType stepSize,
+                                const StateType& intermediateState )
+{
+    // Compute the state derivative (reusing that at the current state if already computed for dense output).
+    const IndependentVariableType time = this->currentIndependentVariable_ + cCoefficient * stepSize;
+    if( stage == 0 && isLastDenseOutputStateDerivativeSet_ && cCoefficient == 0.0 &&
+            denseOutputTimes_.back( ) == this->currentIndependentVariable_ )
+    {
+        currentStateDerivatives_[ stage ] = denseOutputStateDerivatives_.back( );
+    }
+    else
+    {
+        currentStateDerivatives_[ stage ] = this->stateDerivativeFunction_( time, intermediateState );
+    }
+    numberOfEvaluatedStages_++;
+
+    // Check if propagation should terminate because the propagation termination condition has been reached
+    // while computing the intermediate state.
+    if ( this->propagationTerminationFunction_( static_cast< double >( time ), TUDAT_NAN ) )
+    {
+        this->propagationTerminationConditionReachedDuringStep_ = true;
+        return false;
+    }
+    return true;
+}
+
+//! Add the results of an accepted step as node of the continuous extension (dense output).
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+void RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+::addDenseOutputNode( const TimeStepType stepSize, const StateType& newState )
+{
+    // Set node at start of step, using first stage as state derivative (or start new interpolant if not consistent)
+    if( this->coefficients_.cCoefficients( 0 ) != 0.0 )
+    {
+        throw std::runtime_error( "Error in RK integrator, dense output requires first stage at start of step (" +
+                                  this->coefficients_.name + ")." );
+    }
+
+    if( denseOutputTimes_.size( ) > 0 && denseOutputTimes_.back( ) == this->currentIndependentVariable_ )
+    {
+        denseOutputStateDerivatives_.back( ) = currentStateDerivatives_.at( 0 );
+    }
+    else
+    {
+        resetDenseOutput( );
+        denseOutputTimes_.push_back( this->currentIndependentVariable_ );
+        denseOutputStates_.push_back( this->currentState_ );
+        denseOutputStateDerivatives_.push_back( currentStateDerivatives_.at( 0 ) );
+    }
+
+    // Set node at end of step (state derivative is computed when dense output is requested)
+    denseOutputTimes_.push_back( this->currentIndependentVariable_ + stepSize );
+    denseOutputStates_.push_back( newState );
+    denseOutputStateDerivatives_.push_back( currentStateDerivatives_.at( 0 ) );
+    isLastDenseOutputStateDerivativeSet_ = false;
+
+    // Retain nodes at boundaries of the last two steps
+    if( denseOutputTimes_.size( ) > 3 )
+    {
+        denseOutputTimes_.erase( denseOutputTimes_.begin( ) );
+        denseOutputStates_.erase( denseOutputStates_.begin( ) );
+        denseOutputStateDerivatives_.erase( denseOutputStateDerivatives_.begin( ) );
+    }
+}
+
+//! Retrieve the state at a given epoch inside the last step from the continuous extension.
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+StateType RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+::getDenseOutputState( const IndependentVariableType independentVariable )
+{
+    typedef typename StateType::Scalar StateScalarType;
+
+    if( !isDenseOutputAvailable( ) )
+    {
+        throw std::runtime_error( "Error in RK integrator, dense output is not available for current step." );
+    }
+
+    int numberOfNodes = denseOutputTimes_.size( );
+    TimeStepType lastStepSize = static_cast< TimeStepType >(
+                denseOutputTimes_.at( numberOfNodes - 1 ) - denseOutputTimes_.at( numberOfNodes - 2 ) );
+    TimeStepType timeInStep = static_cast< TimeStepType >( independentVariable - denseOutputTimes_.at( numberOfNodes - 2 ) );
+    if( timeInStep / lastStepSize < -1.0E-8 || timeInStep / lastStepSize > 1.0 + 1.0E-8 )
+    {
+        throw std::runtime_error( "Error in RK integrator, requested dense output is outside of last step." );
+    }
+
+    // Compute state derivative at end of step, if not yet done (it is reused as first stage of next step)
+    if( !isLastDenseOutputStateDerivativeSet_ )
+    {
+        denseOutputStateDerivatives_.back( ) = this->stateDerivativeFunction_(
+                    denseOutputTimes_.back( ), denseOutputStates_.back( ) );
+        isLastDenseOutputStateDerivativeSet_ = true;
+    }
+
+    // Only use node at start of step before last one if the step sizes are of similar order, to prevent loss of precision
+    int firstNode = numberOfNodes - 2;
+    if( numberOfNodes > 2 )
+    {
+        TimeStepType stepSizeRatio = static_cast< TimeStepType >(
+                    denseOutputTimes_.at( numberOfNodes - 2 ) - denseOutputTimes_.at( numberOfNodes - 3 ) ) / lastStepSize;
+        if( stepSizeRatio > 0.1 && stepSizeRatio < 10.0 )
+        {
+            firstNode = numberOfNodes - 3;
+        }
+    }
+
+    // Compute coefficients of Hermite interpolant in Newton form (divided differences with each node used twice)
+    int numberOfCoefficients = 2 * ( numberOfNodes - firstNode );
+    std::vector< StateType > coefficients;
+    std::vector< TimeStepType > nodeTimes;
+    coefficients.reserve( numberOfCoefficients );
+    nodeTimes.reserve( numberOfCoefficients );
+    for( int i = firstNode; i < numberOfNodes; i++ )
+    {
+        for( int j = 0; j < 2; j++ )
+        {
+            coefficients.push_back( denseOutputStates_.at( i ) );
+            nodeTimes.push_back( static_cast< TimeStepType >( denseOutputTimes_.at( i ) - denseOutputTimes_.at( firstNode ) ) );
+        }
+    }
+
+    for( int i = numberOfCoefficients - 1; i > 0; i-- )
+    {
+        if( i % 2 == 1 )
+        {
+            coefficients[ i ] = denseOutputStateDerivatives_.at( firstNode + i / 2 );
+        }
+        else
+        {
+            coefficients[ i ] = ( coefficients[ i ] - coefficients[ i - 1 ] ) *
+                    static_cast< StateScalarType >( 1.0 / ( nodeTimes[ i ] - nodeTimes[ i - 1 ] ) );
+        }
+    }
+    for( int order = 2; order < numberOfCoefficients; order++ )
+    {
+        for( int i = numberOfCoefficients - 1; i >= order; i-- )
+        {
+            coefficients[ i ] = ( coefficients[ i ] - coefficients[ i - 1 ] ) *
+                    static_cast< StateScalarType >( 1.0 / ( nodeTimes[ i ] - nodeTimes[ i - order ] ) );
+        }
+    }
+
+    // Evaluate interpolant
+    TimeStepType interpolationTime = static_cast< TimeStepType >( independentVariable - denseOutputTimes_.at( firstNode ) );
+    StateType interpolatedState = coefficients[ numberOfCoefficients - 1 ];
+    for( int i = numberOfCoefficients - 2; i >= 0; i-- )
+    {
+        interpolatedState = coefficients[ i ] +
+                static_cast< StateScalarType >( interpolationTime - nodeTimes[ i ] ) * interpolatedState;
+    }
+    return interpolatedState;
+}
+
 //! Compute the next step size and validate the result.
 template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
 bool
@@ -595,6 +1057,7 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
             lowerOrderEstimate, higherOrderEstimate, stepSize );
         std::pair< TimeStepType, bool > validatedNewStepSizePair = stepSizeValidator_->validateStep(
             recommendedNewStepSizePair, stepSize );
+        stepSizeController_->updateStepHistory( validatedNewStepSizePair.second );
 
         this->stepSize_ = validatedNewStepSizePair.first;
         return validatedNewStepSizePair.second;
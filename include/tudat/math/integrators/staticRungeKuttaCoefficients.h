@@ -0,0 +1,629 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Fehlberg, E. Classical Fifth-, Sixth-, Seventh-, and Eighth-Order Runge-Kutta Formulas With
+ *          Stepsize Control, Marshall Spaceflight Center, NASA TR R-278, 1968.
+ *      Montenbruck, O., Gill, E. Satellite Orbits: Models, Methods, Applications, Springer, 2005.
+ *      Feagin, T. High-order explicit Runge-Kutta methods using m-symmetry. Neural, Parallel & Scientific
+ *          Computations, 20(3-4), 437-458, 2012.
+ *
+ *    Notes
+ *      The coefficient sets defined in this file are the single definition of these sets: the runtime
+ *      RungeKuttaCoefficients objects returned by RungeKuttaCoefficients::get are filled from them.
+ *
+ */
+
+#ifndef TUDAT_STATIC_RUNGE_KUTTA_COEFFICIENTS_H
+#define TUDAT_STATIC_RUNGE_KUTTA_COEFFICIENTS_H
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/math/integrators/rungeKuttaCoefficients.h"
+
+namespace tudat
+{
+namespace numerical_integrators
+{
+
+//! Butcher tableau of a Runge-Kutta coefficient set, defined at compile time.
+/*!
+ *  Butcher tableau of a Runge-Kutta coefficient set, defined at compile time. Specializations are provided for the
+ *  coefficient sets for which the variable step-size integrator uses a stage loop that is unrolled at compile time, with
+ *  the (structural) zero coefficients of the tableau removed from the stage combinations. Each specialization
+ *  defines the number of stages, the orders of the embedded methods, and the a-, b- and c-coefficients, with the same
+ *  layout as the corresponding members of RungeKuttaCoefficients.
+ */
+template< CoefficientSets CoefficientSet >
+struct StaticRungeKuttaCoefficients;
+
+//! Runge-Kutta-Fehlberg 4(5) coefficients, taken from (Fehlberg, 1968).
+template< >
+struct StaticRungeKuttaCoefficients< rungeKuttaFehlberg45 >
+{
+    static constexpr int numberOfStages = 6;
+    static constexpr unsigned int lowerOrder = 4;
+    static constexpr unsigned int higherOrder = 5;
+    static constexpr RungeKuttaCoefficients::OrderEstimateToIntegrate orderEstimateToIntegrate =
+            RungeKuttaCoefficients::lower;
+    static constexpr const char* name = "Runge-Kutta-Fehlberg 4/5";
+
+    static constexpr double aCoefficients[ 6 ][ 5 ] =
+    {
+        { },
+        { 1.0 / 4.0 },
+        { 3.0 / 32.0, 9.0 / 32.0 },
+        { 1932.0 / 2197.0, -7200.0 / 2197.0, 7296.0 / 2197.0 },
+        { 439.0 / 216.0, -8.0, 3680.0 / 513.0, -845.0 / 4104.0 },
+        { -8.0 / 27.0, 2.0, -3544.0 / 2565.0, 1859.0 / 4104.0, -11.0 / 40.0 }
+    };
+
+    static constexpr double bCoefficients[ 2 ][ 6 ] =
+    {
+        { 25.0 / 216.0, 0.0, 1408.0 / 2565.0, 2197.0 / 4104.0, -1.0 / 5.0 },
+        { 16.0 / 135.0, 0.0, 6656.0 / 12825.0, 28561.0 / 56430.0, -9.0 / 50.0, 2.0 / 55.0 }
+    };
+
+    static constexpr double cCoefficients[ 6 ] =
+    { 0.0, 1.0 / 4.0, 3.0 / 8.0, 12.0 / 13.0, 1.0, 1.0 / 2.0 };
+};
+
+//! Runge-Kutta-Fehlberg 7(8) coefficients, taken from (Fehlberg, 1968).
+template< >
+struct StaticRungeKuttaCoefficients< rungeKuttaFehlberg78 >
+{
+    static constexpr int numberOfStages = 13;
+    static constexpr unsigned int lowerOrder = 7;
+    static constexpr unsigned int higherOrder = 8;
+    static constexpr RungeKuttaCoefficients::OrderEstimateToIntegrate orderEstimateToIntegrate =
+            RungeKuttaCoefficients::lower;
+    static constexpr const char* name = "Runge-Kutta-Fehlberg 7/8";
+
+    static constexpr double aCoefficients[ 13 ][ 12 ] =
+    {
+        { },
+        { 2.0 / 27.0 },
+        { 1.0 / 36.0, 1.0 / 12.0 },
+        { 1.0 / 24.0, 0.0, 1.0 / 8.0 },
+        { 5.0 / 12.0, 0.0, -25.0 / 16.0, 25.0 / 16.0 },
+        { 1.0 / 20.0, 0.0, 0.0, 1.0 / 4.0, 1.0 / 5.0 },
+        { -25.0 / 108.0, 0.0, 0.0, 125.0 / 108.0, -65.0 / 27.0, 125.0 / 54.0 },
+        { 31.0 / 300.0, 0.0, 0.0, 0.0, 61.0 / 225.0, -2.0 / 9.0, 13.0 / 900.0 },
+        { 2.0, 0.0, 0.0, -53.0 / 6.0, 704.0 / 45.0, -107.0 / 9.0, 67.0 / 90.0, 3.0 },
+        { -91.0 / 108.0, 0.0, 0.0, 23.0 / 108.0, -976.0 / 135.0, 311.0 / 54.0, -19.0 / 60.0, 17.0 / 6.0, -1.0 / 12.0 },
+        { 2383.0 / 4100.0, 0.0, 0.0, -341.0 / 164.0, 4496.0 / 1025.0, -301.0 / 82.0, 2133.0 / 4100.0, 45.0 / 82.0,
+          45.0 / 164.0, 18.0 / 41.0 },
+        { 3.0 / 205.0, 0.0, 0.0, 0.0, 0.0, -6.0 / 41.0, -3.0 / 205.0, -3.0 / 41.0, 3.0 / 41.0, 6.0 / 41.0 },
+        { -1777.0 / 4100.0, 0.0, 0.0, -341.0 / 164.0, 4496.0 / 1025.0, -289.0 / 82.0, 2193.0 / 4100.0, 51.0 / 82.0,
+          33.0 / 164.0, 12.0 / 41.0, 0.0, 1.0 }
+    };
+
+    static constexpr double bCoefficients[ 2 ][ 13 ] =
+    {
+        { 41.0 / 840.0, 0.0, 0.0, 0.0, 0.0, 34.0 / 105.0, 9.0 / 35.0, 9.0 / 35.0, 9.0 / 280.0, 9.0 / 280.0,
+          41.0 / 840.0 },
+        { 0.0, 0.0, 0.0, 0.0, 0.0, 34.0 / 105.0, 9.0 / 35.0, 9.0 / 35.0, 9.0 / 280.0, 9.0 / 280.0, 0.0, 41.0 / 840.0,
+          41.0 / 840.0 }
+    };
+
+    static constexpr double cCoefficients[ 13 ] =
+    { 0.0, 2.0 / 27.0, 1.0 / 9.0, 1.0 / 6.0, 5.0 / 12.0, 1.0 / 2.0, 5.0 / 6.0, 1.0 / 6.0, 2.0 / 3.0, 1.0 / 3.0, 1.0,
+      0.0, 1.0 };
+};
+
+//! Runge-Kutta 8(7) Dormand-Prince coefficients, taken from (Montenbruck and Gill, 2005).
+template< >
+struct StaticRungeKuttaCoefficients< rungeKutta87DormandPrince >
+{
+    static constexpr int numberOfStages = 13;
+    static constexpr unsigned int lowerOrder = 7;
+    static constexpr unsigned int higherOrder = 8;
+    static constexpr RungeKuttaCoefficients::OrderEstimateToIntegrate orderEstimateToIntegrate =
+            RungeKuttaCoefficients::higher;
+    static constexpr const char* name = "Runge-Kutta 8/7 Dormand-Prince";
+
+    static constexpr double aCoefficients[ 13 ][ 12 ] =
+    {
+        { },
+        { 1.0 / 18.0 },
+        { 1.0 / 48.0, 1.0 / 16.0 },
+        { 1.0 / 32.0, 0.0, 3.0 / 32.0 },
+        { 5.0 / 16.0, 0.0, -75.0 / 64.0, 75.0 / 64.0 },
+        { 3.0 / 80.0, 0.0, 0.0, 3.0 / 16.0, 3.0 / 20.0 },
+        { 29443841.0 / 614563906.0, 0.0, 0.0, 77736538.0 / 692538347.0, -28693883.0 / 1125000000.0,
+          23124283.0 / 1800000000.0 },
+        { 16016141.0 / 946692911.0, 0.0, 0.0, 61564180.0 / 158732637.0, 22789713.0 / 633445777.0,
+          545815736.0 / 2771057229.0, -180193667.0 / 1043307555.0 },
+        { 39632708.0 / 573591083.0, 0.0, 0.0, -433636366.0 / 683701615.0, -421739975.0 / 2616292301.0,
+          100302831.0 / 723423059.0, 790204164.0 / 839813087.0, 800635310.0 / 3783071287.0 },
+        { 246121993.0 / 1340847787.0, 0.0, 0.0, -37695042795.0 / 15268766246.0, -309121744.0 / 1061227803.0,
+          -12992083.0 / 490766935.0, 6005943493.0 / 2108947869.0, 393006217.0 / 1396673457.0,
+          123872331.0 / 1001029789.0 },
+        { -1028468189.0 / 846180014.0, 0.0, 0.0, 8478235783.0 / 508512852.0, 1311729495.0 / 1432422823.0,
+          -10304129995.0 / 1701304382.0, -48777925059.0 / 3047939560.0, 15336726248.0 / 1032824649.0,
+          -45442868181.0 / 3398467696.0, 3065993473.0 / 597172653.0 },
+        { 185892177.0 / 718116043.0, 0.0, 0.0, -3185094517.0 / 667107341.0, -477755414.0 / 1098053517.0,
+          -703635378.0 / 230739211.0, 5731566787.0 / 1027545527.0, 5232866602.0 / 850066563.0,
+          -4093664535.0 / 808688257.0, 3962137247.0 / 1805957418.0, 65686358.0 / 487910083.0 },
+        { 403863854.0 / 491063109.0, 0.0, 0.0, -5068492393.0 / 434740067.0, -411421997.0 / 543043805.0,
+          652783627.0 / 914296604.0, 11173962825.0 / 925320556.0, -13158990841.0 / 6184727034.0,
+          3936647629.0 / 1978049680.0, -160528059.0 / 685178525.0, 248638103.0 / 1413531060.0 }
+    };
+
+    static constexpr double bCoefficients[ 2 ][ 13 ] =
+    {
+        { 13451932.0 / 455176623.0, 0.0, 0.0, 0.0, 0.0, -808719846.0 / 976000145.0, 1757004468.0 / 5645159321.0,
+          656045339.0 / 265891186.0, -3867574721.0 / 1518517206.0, 465885868.0 / 322736535.0, 53011238.0 / 667516719.0,
+          2.0 / 45.0 },
+        { 14005451.0 / 335480064.0, 0.0, 0.0, 0.0, 0.0, -59238493.0 / 1068277825.0, 181606767.0 / 758867731.0,
+          561292985.0 / 797845732.0, -1041891430.0 / 1371343529.0, 760417239.0 / 1151165299.0,
+          118820643.0 / 751138087.0, -528747749.0 / 2220607170.0, 1.0 / 4.0 }
+    };
+
+    static constexpr double cCoefficients[ 13 ] =
+    { 0.0, 1.0 / 18.0, 1.0 / 12.0, 1.0 / 8.0, 5.0 / 16.0, 3.0 / 8.0, 59.0 / 400.0, 93.0 / 200.0,
+      5490023248.0 / 9719169821.0, 13.0 / 20.0, 1201146811.0 / 1299019798.0, 1.0, 1.0 };
+};
+
+//! Runge-Kutta-Feagin 12(10) coefficients, taken from (Feagin, 2012).
+template< >
+struct StaticRungeKuttaCoefficients< rungeKuttaFeagin1210 >
+{
+    static constexpr int numberOfStages = 25;
+    static constexpr unsigned int lowerOrder = 10;
+    static constexpr unsigned int higherOrder = 12;
+    static constexpr RungeKuttaCoefficients::OrderEstimateToIntegrate orderEstimateToIntegrate =
+            RungeKuttaCoefficients::higher;
+    static constexpr const char* name = "Runge-Kutta-Feagin 12/10";
+
+    static constexpr double aCoefficients[ 25 ][ 24 ] =
+    {
+        { },
+        { 0.200000000000000000000000000000000000000000000000000000000000 },
+        { -0.216049382716049382716049382716049382716049382716049382716049,
+          0.771604938271604938271604938271604938271604938271604938271605 },
+        { 0.208333333333333333333333333333333333333333333333333333333333, 0.0,
+          0.625000000000000000000000000000000000000000000000000000000000 },
+        { 0.193333333333333333333333333333333333333333333333333333333333, 0.0,
+          0.220000000000000000000000000000000000000000000000000000000000,
+          -0.0800000000000000000000000000000000000000000000000000000000000 },
+        { 0.100000000000000000000000000000000000000000000000000000000000, 0.0, 0.0,
+          0.400000000000000000000000000000000000000000000000000000000000,
+          0.500000000000000000000000000000000000000000000000000000000000 },
+        { 0.103364471650010477570395435690481791543342708330349879244197, 0.0, 0.0,
+          0.124053094528946761061581889237115328211074784955180298044074,
+          0.483171167561032899288836480451962508724109257517289177302380,
+          -0.0387530245694763252085681443767620580395733302341368038804290 },
+        { 0.124038261431833324081904585980175168140024670698633612292480, 0.0, 0.0, 0.0,
+          0.217050632197958486317846256953159942875916353757734167684657,
+          0.0137455792075966759812907801835048190594443990939408530842918,
+          -0.0661095317267682844455831341498149531672668252085016565917546 },
+        { 0.0914774894856882983144991846980432197088832099976660100090486, 0.0, 0.0, 0.0, 0.0,
+          -0.00544348523717469689965754944144838611346156873847009178068318,
+          0.0680716801688453518578515120895103863112751730758794372203952,
+          0.408394315582641046727306852653894780093303185664924644551239 },
+        { 0.0890013652502551018954509355423841780143232697403434118692699, 0.0, 0.0, 0.0, 0.0,
+          0.00499528226645532360197793408420692800405891149406814091955810,
+          0.397918238819828997341739603001347156083435060931424970826304,
+          0.427930210752576611068192608300897981558240730580396406312359,
+          -0.0865117637557827005740277475955029103267246394128995965941585 },
+        { 0.0695087624134907543112693906409809822706021061685544615255758, 0.0, 0.0, 0.0, 0.0,
+          0.129146941900176461970759579482746551122871751501482634045487,
+          1.53073638102311295076342566143214939031177504112433874313011,
+          0.577874761129140052546751349454576715334892100418571882718036,
+          -0.951294772321088980532340837388859453930924498799228648050949,
+          -0.408276642965631951497484981519757463459627174520978426909934 },
+        { 0.0444861403295135866269453507092463581620165501018684152933313, 0.0, 0.0, 0.0, 0.0,
+          -0.00380476867056961731984232686574547203016331563626856065717964,
+          0.0106955064029624200721262602809059154469206077644957399593972,
+          0.0209616244499904333296674205928919920806734650660039898074652,
+          -0.0233146023259321786648561431551978077665337818756053603898847,
+          0.00263265981064536974369934736325334761174975280887405725010964,
+          0.00315472768977025060103545855572111407955208306374459723959783 },
+        { 0.0194588815119755475588801096525317761242073762016273186231215, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+          0.0000678512949171812509306121653452367476194364781259165332321534,
+          -0.0000429795859049273623271005330230162343568863387724883603675550,
+          0.0000176358982260285155407485928953302139937553442829975734148981,
+          0.0653866627415027051009595231385181033549511358787382098351924 },
+        { 0.206836835664277105916828174798272361078909196043446411598231, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+          0.0166796067104156472828045866664696450306326505094792505215514,
+          -0.00879501563200710214457024178249986591130234990219959208704979,
+          0.00346675455362463910824462315246379209427513654098596403637231,
+          -0.861264460105717678161432562258351242030270498966891201799225,
+          0.908651882074050281096239478469262145034957129939256789178785 },
+        { 0.0203926084654484010091511314676925686038504449562413004562382, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+          0.0869469392016685948675400555583947505833954460930940959577347,
+          -0.0191649630410149842286436611791405053287170076602337673587681,
+          0.00655629159493663287364871573244244516034828755253746024098838,
+          0.0987476128127434780903798528674033899738924968006632201445462,
+          0.00535364695524996055083260173615567408717110247274021056118319,
+          0.301167864010967916837091303817051676920059229784957479998077 },
+        { 0.228410433917778099547115412893004398779136994596948545722283, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+          -0.498707400793025250635016567442511512138603770959682292383042,
+          0.134841168335724478552596703792570104791700727205981058201689,
+          -0.0387458244055834158439904226924029230935161059142806805674360,
+          -1.27473257473474844240388430824908952380979292713250350199641,
+          1.43916364462877165201184452437038081875299303577911839630524,
+          -0.214007467967990254219503540827349569639028092344812795499026,
+          0.958202417754430239892724139109781371059908874605153648768037 },
+        { 2.00222477655974203614249646012506747121440306225711721209798, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+          2.06701809961524912091954656438138595825411859673341600679555,
+          0.623978136086139541957471279831494466155292316167021080663140,
+          -0.0462283685500311430283203554129062069391947101880112723185773,
+          -8.84973288362649614860075246727118949286604835457092701094630,
+          7.74257707850855976227437225791835589560188590785037197433615,
+          -0.588358519250869210993353314127711745644125882130941202896436,
+          -1.10683733362380649395704708016953056176195769617014899442903,
+          -0.929529037579203999778397238291233214220788057511899747507074 },
+        { 3.13789533412073442934451608989888796808161259330322100268310, 0.0, 0.0, 0.0, 0.0,
+          0.129146941900176461970759579482746551122871751501482634045487,
+          1.53073638102311295076342566143214939031177504112433874313011,
+          0.577874761129140052546751349454576715334892100418571882718036,
+          5.42088263055126683050056840891857421941300558851862156403363,
+          0.231546926034829304872663800877643660904880180835945693836936,
+          0.0759292995578913560162301311785251873561801342333194895292058,
+          -12.3729973380186513287414553402595806591349822617535905976253,
+          9.85455883464769543935957209317369202080367765721777101906955,
+          0.0859111431370436529579357709052367772889980495122329601159540,
+          -5.65242752862643921117182090081762761180392602644189218673969,
+          -1.94300935242819610883833776782364287728724899124166920477873,
+          -0.128352601849404542018428714319344620742146491335612353559923 },
+        { 1.38360054432196014878538118298167716825163268489922519995564, 0.0, 0.0, 0.0, 0.0,
+          0.00499528226645532360197793408420692800405891149406814091955810,
+          0.397918238819828997341739603001347156083435060931424970826304,
+          0.427930210752576611068192608300897981558240730580396406312359,
+          -1.30299107424475770916551439123047573342071475998399645982146,
+          0.661292278669377029097112528107513072734573412294008071500699,
+          -0.144559774306954349765969393688703463900585822441545655530145,
+          -6.96576034731798203467853867461083919356792248105919255460819,
+          6.65808543235991748353408295542210450632193197576935120716437,
+          -1.66997375108841486404695805725510845049807969199236227575796,
+          2.06413702318035263832289040301832647130604651223986452170089,
+          -0.674743962644306471862958129570837723192079875998405058648892,
+          -0.00115618834794939500490703608435907610059605754935305582045729,
+          -0.00544057908677007389319819914241631024660726585015012485938593 },
+        { 0.951236297048287669474637975894973552166903378983475425758226, 0.0, 0.0, 0.0,
+          0.217050632197958486317846256953159942875916353757734167684657,
+          0.0137455792075966759812907801835048190594443990939408530842918,
+          -0.0661095317267682844455831341498149531672668252085016565917546, 0.0,
+          0.152281696736414447136604697040747131921486432699422112099617,
+          -0.337741018357599840802300793133998004354643424457539667670080,
+          -0.0192825981633995781534949199286824400469353110630787982121133,
+          -3.68259269696866809932409015535499603576312120746888880201882,
+          3.16197870406982063541533528419683854018352080342887002331312,
+          -0.370462522106885290716991856022051125477943482284080569177386,
+          -0.0514974200365440434996434456698127984941168616474316871020314,
+          -0.000829625532120152946787043541792848416659382675202720677536554,
+          0.00000279801041419278598986586589070027583961355402640879503213503,
+          0.0418603916412360287969841020776788461794119440689356178942252,
+          0.279084255090877355915660874555379649966282167560126269290222 },
+        { 0.103364471650010477570395435690481791543342708330349879244197, 0.0, 0.0,
+          0.124053094528946761061581889237115328211074784955180298044074,
+          0.483171167561032899288836480451962508724109257517289177302380,
+          -0.0387530245694763252085681443767620580395733302341368038804290, 0.0,
+          -0.438313820361122420391059788940960176420682836652600698580091, 0.0,
+          -0.218636633721676647685111485017151199362509373698288330593486,
+          -0.0312334764394719229981634995206440349766174759626578122323015, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+          0.0312334764394719229981634995206440349766174759626578122323015,
+          0.218636633721676647685111485017151199362509373698288330593486,
+          0.438313820361122420391059788940960176420682836652600698580091 },
+        { 0.193333333333333333333333333333333333333333333333333333333333, 0.0,
+          0.220000000000000000000000000000000000000000000000000000000000,
+          -0.0800000000000000000000000000000000000000000000000000000000000, 0.0, 0.0,
+          0.0984256130499315928152900286856048243348202521491288575952143,
+          -0.196410889223054653446526504390100417677539095340135532418849, 0.0,
+          0.436457930493068729391826122587949137609670676712525034763317,
+          0.0652613721675721098560370939805555698350543810708414716730270, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+          -0.0652613721675721098560370939805555698350543810708414716730270,
+          -0.436457930493068729391826122587949137609670676712525034763317,
+          0.196410889223054653446526504390100417677539095340135532418849,
+          -0.0984256130499315928152900286856048243348202521491288575952143 },
+        { -0.216049382716049382716049382716049382716049382716049382716049,
+          0.771604938271604938271604938271604938271604938271604938271605, 0.0, 0.0,
+          -0.666666666666666666666666666666666666666666666666666666666667, 0.0,
+          -0.390696469295978451446999802258495981249099665294395945559163, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+          0.0, 0.0, 0.0, 0.0, 0.390696469295978451446999802258495981249099665294395945559163,
+          0.666666666666666666666666666666666666666666666666666666666667 },
+        { 0.200000000000000000000000000000000000000000000000000000000000, 0.0,
+          -0.164609053497942386831275720164609053497942386831275720164609, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+          0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+          0.164609053497942386831275720164609053497942386831275720164609 },
+        { 1.47178724881110408452949550989023611293535315518571691939396,
+          0.787500000000000000000000000000000000000000000000000000000000,
+          0.421296296296296296296296296296296296296296296296296296296296, 0.0,
+          0.291666666666666666666666666666666666666666666666666666666667, 0.0,
+          0.348600717628329563206854421629657569274689947367847465753757,
+          0.229499544768994849582890233710555447073823569666506700662510,
+          5.79046485790481979159831978177003471098279506036722411333192,
+          0.418587511856506868874073759426596207226461447604248151080016,
+          0.307039880222474002649653817490106690389251482313213999386651,
+          -4.68700905350603332214256344683853248065574415794742040470287,
+          3.13571665593802262152038152399873856554395436199962915429076,
+          1.40134829710965720817510506275620441055845017313930508348898,
+          -5.52931101439499023629010306005764336421276055777658156400910,
+          -0.853138235508063349309546894974784906188927508039552519557498,
+          0.103575780373610140411804607167772795518293914458500175573749,
+          -0.140474416950600941142546901202132534870665923700034957196546,
+          -0.418587511856506868874073759426596207226461447604248151080016,
+          -0.229499544768994849582890233710555447073823569666506700662510,
+          -0.348600717628329563206854421629657569274689947367847465753757,
+          -0.291666666666666666666666666666666666666666666666666666666667,
+          -0.421296296296296296296296296296296296296296296296296296296296,
+          -0.787500000000000000000000000000000000000000000000000000000000 }
+    };
+
+    static constexpr double bCoefficients[ 2 ][ 25 ] =
+    {
+        { 0.0238095238095238095238095238095238095238095238095238095238095, 1.0 / 10.0,
+          0.0312500000000000000000000000000000000000000000000000000000000, 0.0,
+          0.0416666666666666666666666666666666666666666666666666666666667, 0.0,
+          0.0500000000000000000000000000000000000000000000000000000000000,
+          0.0500000000000000000000000000000000000000000000000000000000000, 0.0,
+          0.100000000000000000000000000000000000000000000000000000000000,
+          0.0714285714285714285714285714285714285714285714285714285714286, 0.0,
+          0.138413023680782974005350203145033146748813640089941234591267,
+          0.215872690604931311708935511140681138965472074195773051123019,
+          0.243809523809523809523809523809523809523809523809523809523810,
+          0.215872690604931311708935511140681138965472074195773051123019,
+          0.138413023680782974005350203145033146748813640089941234591267,
+          -0.0714285714285714285714285714285714285714285714285714285714286,
+          -0.100000000000000000000000000000000000000000000000000000000000,
+          -0.0500000000000000000000000000000000000000000000000000000000000,
+          -0.0500000000000000000000000000000000000000000000000000000000000,
+          -0.0416666666666666666666666666666666666666666666666666666666667,
+          -0.0312500000000000000000000000000000000000000000000000000000000, -1.0 / 10.0,
+          0.0238095238095238095238095238095238095238095238095238095238095 },
+        { 0.0238095238095238095238095238095238095238095238095238095238095,
+          0.0234375000000000000000000000000000000000000000000000000000000,
+          0.0312500000000000000000000000000000000000000000000000000000000, 0.0,
+          0.0416666666666666666666666666666666666666666666666666666666667, 0.0,
+          0.0500000000000000000000000000000000000000000000000000000000000,
+          0.0500000000000000000000000000000000000000000000000000000000000, 0.0,
+          0.100000000000000000000000000000000000000000000000000000000000,
+          0.0714285714285714285714285714285714285714285714285714285714286, 0.0,
+          0.138413023680782974005350203145033146748813640089941234591267,
+          0.215872690604931311708935511140681138965472074195773051123019,
+          0.243809523809523809523809523809523809523809523809523809523810,
+          0.215872690604931311708935511140681138965472074195773051123019,
+          0.138413023680782974005350203145033146748813640089941234591267,
+          -0.0714285714285714285714285714285714285714285714285714285714286,
+          -0.100000000000000000000000000000000000000000000000000000000000,
+          -0.0500000000000000000000000000000000000000000000000000000000000,
+          -0.0500000000000000000000000000000000000000000000000000000000000,
+          -0.0416666666666666666666666666666666666666666666666666666666667,
+          -0.0312500000000000000000000000000000000000000000000000000000000,
+          -0.0234375000000000000000000000000000000000000000000000000000000,
+          0.0238095238095238095238095238095238095238095238095238095238095 }
+    };
+
+    static constexpr double cCoefficients[ 25 ] =
+    { 0.0, 0.200000000000000000000000000000000000000000000000000000000000,
+      0.555555555555555555555555555555555555555555555555555555555556,
+      0.833333333333333333333333333333333333333333333333333333333333,
+      0.333333333333333333333333333333333333333333333333333333333333,
+      1.00000000000000000000000000000000000000000000000000000000000,
+      0.671835709170513812712245661002797570438953420568682550710222,
+      0.288724941110620201935458488967024976908118598341806976469674,
+      0.562500000000000000000000000000000000000000000000000000000000,
+      0.833333333333333333333333333333333333333333333333333333333333,
+      0.947695431179199287562380162101836721649589325892740646458322,
+      0.0548112876863802643887753674810754475842153612931128785028369,
+      0.0848880518607165350639838930162674302064148175640019542045934,
+      0.265575603264642893098114059045616835297201264164077621448665,
+      0.500000000000000000000000000000000000000000000000000000000000,
+      0.734424396735357106901885940954383164702798735835922378551335,
+      0.915111948139283464936016106983732569793585182435998045795407,
+      0.947695431179199287562380162101836721649589325892740646458322,
+      0.833333333333333333333333333333333333333333333333333333333333,
+      0.288724941110620201935458488967024976908118598341806976469674,
+      0.671835709170513812712245661002797570438953420568682550710222,
+      0.333333333333333333333333333333333333333333333333333333333333,
+      0.555555555555555555555555555555555555555555555555555555555556,
+      0.200000000000000000000000000000000000000000000000000000000000,
+      1.00000000000000000000000000000000000000000000000000000000000 };
+};
+
+//! Function to check whether a compile-time Butcher tableau is available for a given coefficient set.
+/*!
+ * Function to check whether a compile-time Butcher tableau (StaticRungeKuttaCoefficients specialization) is available
+ * for a given coefficient set.
+ * \param coefficientSet Coefficient set that is to be checked
+ * \return True if compile-time Butcher tableau is available
+ */
+constexpr bool hasStaticRungeKuttaCoefficients( const CoefficientSets coefficientSet )
+{
+    return coefficientSet == rungeKuttaFehlberg45 || coefficientSet == rungeKuttaFehlberg78 ||
+            coefficientSet == rungeKutta87DormandPrince || coefficientSet == rungeKuttaFeagin1210;
+}
+
+//! Function to retrieve the coefficient set for which the compile-time Butcher tableau is identical to given coefficients.
+/*!
+ * Function to retrieve the coefficient set for which the compile-time Butcher tableau is identical to the given runtime
+ * coefficients (both the orders and all a-, b- and c-coefficients are compared).
+ * \param coefficients Runtime coefficients for which the compile-time equivalent is to be found
+ * \return Coefficient set with identical compile-time tableau (undefinedCoefficientSet if none exists)
+ */
+CoefficientSets getMatchingStaticRungeKuttaCoefficientSet( const RungeKuttaCoefficients& coefficients );
+
+//! Function to retrieve a coefficient from a row of a compile-time Butcher tableau.
+/*!
+ * Function to retrieve a coefficient from a row of a compile-time Butcher tableau.
+ * \tparam CoefficientSet Coefficient set from which the coefficient is to be retrieved
+ * \tparam IsWeightRow Boolean denoting whether the row is a row of b-coefficients (true) or a-coefficients (false)
+ * \tparam Row Index of the row of coefficients
+ * \param column Index of the column of the coefficient
+ * \return Value of the coefficient
+ */
+template< CoefficientSets CoefficientSet, bool IsWeightRow, int Row >
+constexpr double getStaticTableauCoefficient( const int column )
+{
+    if constexpr( IsWeightRow )
+    {
+        return StaticRungeKuttaCoefficients< CoefficientSet >::bCoefficients[ Row ][ column ];
+    }
+    else
+    {
+        return StaticRungeKuttaCoefficients< CoefficientSet >::aCoefficients[ Row ][ column ];
+    }
+}
+
+//! Function to retrieve the number of state derivatives that are combined by a row of a compile-time Butcher tableau.
+template< CoefficientSets CoefficientSet, bool IsWeightRow, int Row >
+constexpr int getNumberOfStaticTableauColumns( )
+{
+    return IsWeightRow ? StaticRungeKuttaCoefficients< CoefficientSet >::numberOfStages : Row;
+}
+
+//! Function to retrieve the number of non-zero coefficients in a row of a compile-time Butcher tableau.
+template< CoefficientSets CoefficientSet, bool IsWeightRow, int Row >
+constexpr int getNumberOfNonZeroStaticTableauCoefficients( )
+{
+    int numberOfNonZeroCoefficients = 0;
+    for( int column = 0; column < getNumberOfStaticTableauColumns< CoefficientSet, IsWeightRow, Row >( ); column++ )
+    {
+        if( getStaticTableauCoefficient< CoefficientSet, IsWeightRow, Row >( column ) != 0.0 )
+        {
+            numberOfNonZeroCoefficients++;
+        }
+    }
+    return numberOfNonZeroCoefficients;
+}
+
+//! Function to retrieve the column indices of the non-zero coefficients in a row of a compile-time Butcher tableau.
+template< CoefficientSets CoefficientSet, bool IsWeightRow, int Row, int NumberOfNonZeroCoefficients >
+constexpr std::array< int, NumberOfNonZeroCoefficients > getNonZeroStaticTableauColumns( )
+{
+    std::array< int, NumberOfNonZeroCoefficients > nonZeroColumns = { };
+    int currentIndex = 0;
+    for( int column = 0; column < getNumberOfStaticTableauColumns< CoefficientSet, IsWeightRow, Row >( ); column++ )
+    {
+        if( getStaticTableauCoefficient< CoefficientSet, IsWeightRow, Row >( column ) != 0.0 )
+        {
+            nonZeroColumns[ currentIndex ] = column;
+            currentIndex++;
+        }
+    }
+    return nonZeroColumns;
+}
+
+//! Function to compute the linear combination of state derivatives for a row of a compile-time Butcher tableau
+/*!
+ * Function to compute the linear combination of state derivatives for a row of a compile-time Butcher tableau, for a
+ * given list of indices into the non-zero coefficients of the row. The combination is evaluated as a single Eigen
+ * expression, with the terms added in the same order as the runtime stage loop: (( x + h a_0 k_0 ) + h a_1 k_1 ) + ...
+ * \param initialState State at the start of the step
+ * \param stepSize Step size
+ * \param stateDerivatives State derivatives (k_i) of the stages
+ * \param combinedState Linear combination of state and state derivatives (returned by reference)
+ */
+template< CoefficientSets CoefficientSet, bool IsWeightRow, int Row,
+          typename StateType, typename StateDerivativeType, typename TimeStepType, std::size_t... Indices >
+void computeStaticTableauRowCombination(
+        const StateType& initialState,
+        const TimeStepType stepSize,
+        const std::vector< StateDerivativeType >& stateDerivatives,
+        StateType& combinedState,
+        std::index_sequence< Indices... > )
+{
+    constexpr std::array< int, sizeof...( Indices ) > nonZeroColumns =
+            getNonZeroStaticTableauColumns< CoefficientSet, IsWeightRow, Row, sizeof...( Indices ) >( );
+    combinedState = ( initialState + ... + (
+                          ( stepSize * getStaticTableauCoefficient< CoefficientSet, IsWeightRow, Row >(
+                                nonZeroColumns[ Indices ] ) ) * stateDerivatives[ nonZeroColumns[ Indices ] ] ) );
+}
+
+//! Function to compute the linear combination of state derivatives for a row of a compile-time Butcher tableau
+/*!
+ * Function to compute the linear combination of state derivatives for a row of a compile-time Butcher tableau, skipping
+ * all zero coefficients of the row at compile time.
+ * \param initialState State at the start of the step
+ * \param stepSize Step size
+ * \param stateDerivatives State derivatives (k_i) of the stages
+ * \param combinedState Linear combination of state and state derivatives (returned by reference)
+ */
+template< CoefficientSets CoefficientSet, bool IsWeightRow, int Row,
+          typename StateType, typename StateDerivativeType, typename TimeStepType >
+void computeStaticTableauRowCombination(
+        const StateType& initialState,
+        const TimeStepType stepSize,
+        const std::vector< StateDerivativeType >& stateDerivatives,
+        StateType& combinedState )
+{
+    computeStaticTableauRowCombination< CoefficientSet, IsWeightRow, Row >(
+                initialState, stepSize, stateDerivatives, combinedState,
+                std::make_index_sequence<
+                getNumberOfNonZeroStaticTableauCoefficients< CoefficientSet, IsWeightRow, Row >( ) >( ) );
+}
+
+//! Function to set the runtime coefficients of a Runge-Kutta method from its compile-time Butcher tableau.
+/*!
+ * Function to set the runtime coefficients of a Runge-Kutta method from its compile-time Butcher tableau.
+ * \param coefficients Runtime coefficients that are to be set (returned by reference)
+ */
+template< CoefficientSets CoefficientSet >
+void setRungeKuttaCoefficientsFromStaticTableau( RungeKuttaCoefficients& coefficients )
+{
+    typedef StaticRungeKuttaCoefficients< CoefficientSet > StaticCoefficients;
+    const int numberOfStages = StaticCoefficients::numberOfStages;
+
+    coefficients.lowerOrder = StaticCoefficients::lowerOrder;
+    coefficients.higherOrder = StaticCoefficients::higherOrder;
+    coefficients.orderEstimateToIntegrate = StaticCoefficients::orderEstimateToIntegrate;
+
+    coefficients.aCoefficients = Eigen::MatrixXd::Zero( numberOfStages, numberOfStages - 1 );
+    coefficients.bCoefficients = Eigen::MatrixXd::Zero( 2, numberOfStages );
+    coefficients.cCoefficients = Eigen::VectorXd::Zero( numberOfStages );
+    for( int i = 0; i < numberOfStages; i++ )
+    {
+        for( int j = 0; j < numberOfStages - 1; j++ )
+        {
+            coefficients.aCoefficients( i, j ) = StaticCoefficients::aCoefficients[ i ][ j ];
+        }
+        coefficients.bCoefficients( 0, i ) = StaticCoefficients::bCoefficients[ 0 ][ i ];
+        coefficients.bCoefficients( 1, i ) = StaticCoefficients::bCoefficients[ 1 ][ i ];
+        coefficients.cCoefficients( i ) = StaticCoefficients::cCoefficients[ i ];
+    }
+    coefficients.name = StaticCoefficients::name;
+}
+
+//! Function to check whether runtime coefficients are identical to a compile-time Butcher tableau.
+/*!
+ * Function to check whether runtime coefficients are identical to a compile-time Butcher tableau.
+ * \param coefficients Runtime coefficients that are to be compared
+ * \return True if orders and all coefficients are identical
+ */
+template< CoefficientSets CoefficientSet >
+bool areRungeKuttaCoefficientsEqualToStaticTableau( const RungeKuttaCoefficients& coefficients )
+{
+    RungeKuttaCoefficients staticCoefficients;
+    setRungeKuttaCoefficientsFromStaticTableau< CoefficientSet >( staticCoefficients );
+
+    return ( !coefficients.isFixedStepSize ) &&
+            coefficients.lowerOrder == staticCoefficients.lowerOrder &&
+            coefficients.higherOrder == staticCoefficients.higherOrder &&
+            coefficients.orderEstimateToIntegrate == staticCoefficients.orderEstimateToIntegrate &&
+            coefficients.aCoefficients.rows( ) == staticCoefficients.aCoefficients.rows( ) &&
+            coefficients.aCoefficients.cols( ) == staticCoefficients.aCoefficients.cols( ) &&
+            coefficients.bCoefficients.rows( ) == staticCoefficients.bCoefficients.rows( ) &&
+            coefficients.bCoefficients.cols( ) == staticCoefficients.bCoefficients.cols( ) &&
+            coefficients.cCoefficients.rows( ) == staticCoefficients.cCoefficients.rows( ) &&
+            coefficients.aCoefficients == staticCoefficients.aCoefficients &&
+            coefficients.bCoefficients == staticCoefficients.bCoefficients &&
+            coefficients.cCoefficients == staticCoefficients.cCoefficients;
+}
+
+} // namespace numerical_integrators
+
+} // namespace tudat
+
+#endif // TUDAT_STATIC_RUNGE_KUTTA_COEFFICIENTS_H
@@ -10,6 +10,9 @@
  *    References
  *      Burden, R.L., Faires, J.D. Numerical Analysis, 7th Edition, Books/Cole, 2001.
  *      Montenbruck, O., Gill, E. Satellite Orbits: Models, Methods, Applications, Springer, 2005.
+ *      Gustafsson, K. Control theoretic techniques for stepsize selection in explicit Runge-Kutta methods,
+ *          ACM Transactions on Mathematical Software, 17(4), 533-554, 1991.
+ *      Hairer, E., Wanner, G. Solving Ordinary Differential Equations II, 2nd Edition, Springer, 1996.
  *
  */
 
@@ -19,6 +22,8 @@
 
 
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
 #include <memory>
 
@@ -183,27 +188,136 @@ public:
     virtual ~IntegratorStepSizeController( )
     { }
 
-    virtual void initialize( const StateType& state ){ }
+    virtual void initialize( const StateType& state )
+    {
+        resetStepHistory( );
+    }
 
     virtual std::pair< TimeStepType, bool > computeNewStepSize(
         const StateType &firstStateEstimate,
         const StateType &secondStateEstimate,
         const TimeStepType &currentStep ) = 0;
 
+    // Function to reset the order of the integrator, used in the exponent of the step size estimate
+    void setIntegratorOrder( const double integratorOrder )
+    {
+        integratorOrder_ = integratorOrder;
+    }
+
+    // Function to retrieve the order of the integrator, used in the exponent of the step size estimate
+    double getIntegratorOrder( )
+    {
+        return integratorOrder_;
+    }
+
+    // Function to use a PI (proportional-integral) controller, instead of the elementary controller, for the step
+    // size estimate (Gustafsson, 1991; Hairer and Wanner, 1996). For an accepted step, the step size ratio is then
+    // safety * err_n^( -integralExponent / order ) * err_n-1^( proportionalExponent / order ), with err_n-1 the
+    // error of the previous accepted step. If predictive post-rejection control is used, the step size is not
+    // increased directly after a rejected step, and the reduction after a repeated rejection uses the order
+    // estimated from the errors of the two rejected attempts.
+    void setProportionalIntegralControl( const double integralExponent = 0.7,
+                                         const double proportionalExponent = 0.4,
+                                         const bool usePredictivePostRejectionControl = true )
+    {
+        useProportionalIntegralControl_ = true;
+        integralExponent_ = integralExponent;
+        proportionalExponent_ = proportionalExponent;
+        usePredictivePostRejectionControl_ = usePredictivePostRejectionControl;
+    }
+
+    // Function to retrieve whether the PI controller is used
+    bool getUseProportionalIntegralControl( )
+    {
+        return useProportionalIntegralControl_;
+    }
+
+    // Function to update the step history of the controller, to be called by the integrator once it has decided
+    // whether the step for which computeNewStepSize was last called is accepted.
+    void updateStepHistory( const bool stepAccepted )
+    {
+        if( stepAccepted )
+        {
+            previousAcceptedError_ = std::max( lastErrorEstimate_, minimumHistoryError_ );
+            previousStepRejected_ = false;
+        }
+        else
+        {
+            previousRejectedError_ = lastErrorEstimate_;
+            previousRejectedStep_ = lastStepSize_;
+            previousStepRejected_ = true;
+        }
+    }
+
+    // Function to clear the step history of the controller (e.g. when restarting the integration)
+    void resetStepHistory( )
+    {
+        previousAcceptedError_ = TUDAT_NAN;
+        previousRejectedError_ = TUDAT_NAN;
+        previousRejectedStep_ = TUDAT_NAN;
+        previousStepRejected_ = false;
+    }
 
 protected:
 
+    // Function to compute the step size ratio from the error estimate using the PI controller
+    double computeProportionalIntegralTimeStepRatio(
+        const double errorEstimate, const TimeStepType& currentStep, const bool tolerancesMet )
+    {
+        const double boundedError = std::max( errorEstimate, minimumHistoryError_ );
+        double timeStepRatio;
+        if( tolerancesMet )
+        {
+            timeStepRatio = safetyFactorForNextStepSize_ *
+                std::pow( boundedError, -integralExponent_ / integratorOrder_ );
+            if( previousAcceptedError_ == previousAcceptedError_ )
+            {
+                timeStepRatio *= std::pow( previousAcceptedError_, proportionalExponent_ / integratorOrder_ );
+            }
+
+            // Do not increase the step size directly after a rejection
+            if( usePredictivePostRejectionControl_ && previousStepRejected_ )
+            {
+                timeStepRatio = std::min( timeStepRatio, 1.0 );
+            }
+        }
+        else
+        {
+            // For a repeated rejection, estimate the effective order from the two last attempts.
+            double effectiveOrder = integratorOrder_;
+            if( usePredictivePostRejectionControl_ && previousStepRejected_ &&
+                ( previousRejectedError_ > boundedError ) && ( std::fabs( previousRejectedStep_ ) > std::fabs( currentStep ) ) )
+            {
+                const double estimatedOrder = std::log( previousRejectedError_ / boundedError ) /
+                    std::log( static_cast< double >( previousRejectedStep_ / currentStep ) );
+                if( estimatedOrder == estimatedOrder )
+                {
+                    effectiveOrder = std::min( std::max( estimatedOrder, 1.0 ), integratorOrder_ );
+                }
+            }
+            timeStepRatio = safetyFactorForNextStepSize_ * std::pow( boundedError, -1.0 / effectiveOrder );
+        }
+        return timeStepRatio;
+    }
+
     std::pair< TimeStepType, bool > computeTimeStepFromErrorEstimate(
         const TimeStepType& maximumErrorInState,
         const TimeStepType& currentStep )
     {
+        bool tolerancesMet = maximumErrorInState <= 1.0;
+
+        // Store error of this step, which is added to the history when the integrator calls updateStepHistory
+        lastErrorEstimate_ = static_cast< double >( maximumErrorInState );
+        lastStepSize_ = currentStep;
+
         // Compute the new step size. This is based off of the equation given in
-        // (Montenbruck and Gill, 2005).
-        const TimeStepType timeStepRatio = safetyFactorForNextStepSize_
-                                           * std::pow( 1.0 / static_cast< double >( maximumErrorInState ),
-                                                       1.0 / static_cast< double >( integratorOrder_ ) );
+        // (Montenbruck and Gill, 2005), or uses the PI controller, if selected.
+        const TimeStepType timeStepRatio = useProportionalIntegralControl_ ?
+            static_cast< TimeStepType >( computeProportionalIntegralTimeStepRatio(
+                lastErrorEstimate_, currentStep, tolerancesMet ) ) :
+            safetyFactorForNextStepSize_ * std::pow( 1.0 / static_cast< double >( maximumErrorInState ),
+                                                     1.0 / static_cast< double >( integratorOrder_ ) );
 
-        bool tolerancesMet = maximumErrorInState <= 1.0;
         if ( timeStepRatio <= minimumFactorDecreaseForNextStepSize_ )
         {
             return std::make_pair( currentStep * minimumFactorDecreaseForNextStepSize_, tolerancesMet );
@@ -220,12 +334,35 @@ protected:
 
     const double safetyFactorForNextStepSize_;
 
-    const double integratorOrder_;
+    double integratorOrder_;
 
     const double minimumFactorDecreaseForNextStepSize_;
 
     const double maximumFactorDecreaseForNextStepSize_;
 
+    bool useProportionalIntegralControl_ = false;
+
+    double integralExponent_ = 0.7;
+
+    double proportionalExponent_ = 0.4;
+
+    bool usePredictivePostRejectionControl_ = true;
+
+    // Lower bound of errors used in step size ratios, to prevent excessive growth from (near-)zero error estimates
+    const double minimumHistoryError_ = 1.0E-4;
+
+    double lastErrorEstimate_ = TUDAT_NAN;
+
+    TimeStepType lastStepSize_ = TUDAT_NAN;
+
+    double previousAcceptedError_ = TUDAT_NAN;
+
+    double previousRejectedError_ = TUDAT_NAN;
+
+    TimeStepType previousRejectedStep_ = TUDAT_NAN;
+
+    bool previousStepRejected_ = false;
+
 };
 
 template< typename TimeStepType, typename StateType = Eigen::VectorXd >
@@ -262,6 +399,7 @@ public:
 
     void initialize( const StateType& state )
     {
+        this->resetStepHistory( );
         if( !tolerancesSet_ )
         {
             relativeErrorTolerance_ = StateType::Constant( state.rows( ), state.cols( ),
@@ -308,7 +446,7 @@ public:
         const typename StateType::Scalar maximumErrorInState_
             = relativeTruncationError_.array( ).abs( ).maxCoeff( );
         
-        return this->computeTimeStepFromErrorEstimate( maximumErrorInState_, currentStep );
+        return this->computeTimeStepFromErrorEstimate( static_cast< TimeStepType >( maximumErrorInState_ ), currentStep );
 
     }
 
@@ -369,6 +507,7 @@ public:
 
     void initialize( const StateType& state )
     {
+        this->resetStepHistory( );
         if( blocksToCheck_.size( ) == 0 )
         {
             if( blocksToCheckFunction_ == nullptr )
@@ -459,7 +598,7 @@ public:
         const typename StateType::Scalar maximumErrorInState_
             = relativeTruncationError_.array( ).abs( ).maxCoeff( );
 
-        return this->computeTimeStepFromErrorEstimate( maximumErrorInState_, currentStep );
+        return this->computeTimeStepFromErrorEstimate( static_cast< TimeStepType >( maximumErrorInState_ ), currentStep );
 
     }
 
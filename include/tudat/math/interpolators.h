@@ -11,6 +11,7 @@
 #ifndef TUDAT_INTERPOLATORS_H
 #define TUDAT_INTERPOLATORS_H
 
+#include "interpolators/arcCursor.h"
 #include "interpolators/createInterpolator.h"
 #include "interpolators/cubicSplineInterpolator.h"
 #include "interpolators/hermiteCubicSplineInterpolator.h"
@@ -0,0 +1,125 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_ARC_CURSOR_H
+#define TUDAT_ARC_CURSOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace tudat
+{
+
+namespace interpolators
+{
+
+//! Class to retrieve the index of the arc in which a given time lies, for a fixed list of arc start times.
+/*!
+ *  Class to retrieve the index of the arc in which a given time lies, for a fixed list of arc start times (as used by
+ *  arc-wise estimated parameters). The arc index found during the previous call is stored, so that for (nearly) monotonic
+ *  requests, as made during a numerical integration, the arc index is retrieved in constant time: the bounds of the current
+ *  and next arc are checked, and a binary search is performed only if the requested time lies outside of these. The final
+ *  arc has no upper bound; times before the start of the first arc (or NaN) have arc index -1.
+ *  The stored index is atomic, and any value of it yields the correct result, so that a single cursor may be shared by
+ *  the models and partials using the same arc-wise parameter, also when these are evaluated concurrently.
+ */
+class ArcCursor
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param arcStartTimes Times at which the arcs start (in ascending order)
+     */
+    ArcCursor( const std::vector< double >& arcStartTimes ):
+        arcStartTimes_( arcStartTimes ), currentArcIndex_( 0 )
+    {
+        if( arcStartTimes_.size( ) == 0 )
+        {
+            throw std::runtime_error( "Error when creating arc cursor, no arc start times provided" );
+        }
+
+        for( unsigned int i = 1; i < arcStartTimes_.size( ); i++ )
+        {
+            if( !( arcStartTimes_.at( i ) > arcStartTimes_.at( i - 1 ) ) )
+            {
+                throw std::runtime_error( "Error when creating arc cursor, arc start times are not in ascending order" );
+            }
+        }
+
+        // Add maximum time to end of arc list, so that the final arc needs no special treatment
+        arcStartTimes_.push_back( std::numeric_limits< double >::infinity( ) );
+    }
+
+    //! Function to retrieve the index of the arc in which the given time lies.
+    /*!
+     *  Function to retrieve the index of the arc in which the given time lies, and store it as guess for the next call.
+     *  \param time Time for which the arc index is to be retrieved
+     *  \return Index of the arc in which the given time lies (-1 if time is before the start of the first arc)
+     */
+    int getArcIndex( const double time )
+    {
+        int arcIndex = currentArcIndex_.load( std::memory_order_relaxed );
+
+        // Check current arc, and the subsequent arc
+        if( !( arcStartTimes_[ arcIndex ] <= time ) || !( time < arcStartTimes_[ arcIndex + 1 ] ) )
+        {
+            if( !( time >= arcStartTimes_.front( ) ) )
+            {
+                return -1;
+            }
+            else if( time >= arcStartTimes_[ arcIndex + 1 ] && arcIndex + 2 < static_cast< int >( arcStartTimes_.size( ) ) &&
+                     time < arcStartTimes_[ arcIndex + 2 ] )
+            {
+                arcIndex++;
+            }
+            else
+            {
+                arcIndex = std::min( static_cast< int >(
+                                         std::upper_bound( arcStartTimes_.begin( ), arcStartTimes_.end( ), time ) -
+                                         arcStartTimes_.begin( ) ) - 1, getNumberOfArcs( ) - 1 );
+            }
+            currentArcIndex_.store( arcIndex, std::memory_order_relaxed );
+        }
+        return arcIndex;
+    }
+
+    //! Function to retrieve the number of arcs
+    int getNumberOfArcs( )
+    {
+        return static_cast< int >( arcStartTimes_.size( ) ) - 1;
+    }
+
+    //! Function to retrieve the times at which the arcs start
+    std::vector< double > getArcStartTimes( )
+    {
+        return std::vector< double >( arcStartTimes_.begin( ), arcStartTimes_.end( ) - 1 );
+    }
+
+private:
+
+    //! Times at which the arcs start, with infinity appended as the end time of the final arc.
+    std::vector< double > arcStartTimes_;
+
+    //! Index of the arc found during the previous call (atomic, so that the cursor may be used concurrently)
+    std::atomic< int > currentArcIndex_;
+
+};
+
+} // namespace interpolators
+
+} // namespace tudat
+
+#endif // TUDAT_ARC_CURSOR_H
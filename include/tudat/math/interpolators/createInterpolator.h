@@ -23,6 +23,7 @@
 #include "tudat/math/interpolators/piecewiseConstantInterpolator.h"
 
 #include "tudat/math/interpolators/multiLinearInterpolator.h"
+#include "tudat/math/interpolators/oneDimensionalInterpolatorCursor.h"
 
 #include "tudat/io/mapTextFileReader.h"
 
@@ -589,6 +590,21 @@ std::shared_ptr< OneDimensionalInterpolator< IndependentType, DependentType > >
                                              firstDerivativeOfDependentVariables );
 }
 
+//! Function to create a cursor for an existing interpolator, for use in concurrent interpolation
+/*!
+ *  Function to create a cursor for an existing interpolator, i.e. an interpolator that shares all data of the
+ *  existing interpolator (without copying it), but which has its own look-up scheme state. This allows the same
+ *  interpolator to be used from multiple threads, with one cursor per thread, without duplicating the data.
+ *  \param interpolator Interpolator for which a cursor is to be created
+ *  \return Interpolator cursor, sharing the data of the given interpolator.
+ */
+template< typename IndependentType, typename DependentType >
+std::shared_ptr< OneDimensionalInterpolator< IndependentType, DependentType > > cloneCursor(
+        const std::shared_ptr< OneDimensionalInterpolator< IndependentType, DependentType > > interpolator )
+{
+    return std::make_shared< OneDimensionalInterpolatorCursor< IndependentType, DependentType > >( interpolator );
+}
+
 //! Function to create a multi-dimensional interpolator
 /*!
  *  Function to create a multi-dimensional interpolator from the data that is to be interpolated,
@@ -16,6 +16,7 @@
 #ifndef TUDAT_CUBIC_SPLINE_INTERPOLATOR_H
 #define TUDAT_CUBIC_SPLINE_INTERPOLATOR_H
 
+#include <algorithm>
 #include <cmath>
 #include <Eigen/Core>
 
@@ -286,6 +287,23 @@ public:
      *  \return Interpolated dependent variable value.
      */
     DependentVariableType interpolate( const IndependentVariableType targetIndependentVariableValue )
+    {
+        return interpolate( targetIndependentVariableValue, *lookUpScheme_ );
+    }
+
+    //! Function interpolates dependent variable value at given independent variable value, using given look-up scheme.
+    /*!
+     *  Function interpolates dependent variable value, as the single-argument interpolate function, but using
+     *  the given look-up scheme (cursor), instead of the look-up scheme of this object. Since the interpolator is
+     *  not modified, this function may be called concurrently, with a separate look-up scheme per thread.
+     *  \param targetIndependentVariableValue Target independent variable value at which point
+     *      the interpolation is performed.
+     *  \param lookUpScheme Look-up scheme (created from the independent variables of this interpolator)
+     *      that is used to find the interval in which the independent variable lies.
+     *  \return Interpolated dependent variable value.
+     */
+    DependentVariableType interpolate( const IndependentVariableType targetIndependentVariableValue,
+                                       LookUpScheme< IndependentVariableType >& lookUpScheme )
     {
         // Check whether boundary handling needs to be applied, if independent variable is beyond its defined range.
         DependentVariableType interpolatedValue;
@@ -298,14 +316,83 @@ public:
 
         // Determine the lower entry in the table corresponding to the target independent variable
         // value.
-        int lowerEntry_ = lookUpScheme_->findNearestLowerNeighbour(
+        int lowerEntry_ = lookUpScheme.findNearestLowerNeighbour(
                     targetIndependentVariableValue );
 
+        // The interpolated dependent variable value.
+        return evaluateSpline( targetIndependentVariableValue, lowerEntry_ );
+    }
+
+    //! Function interpolates dependent variable values at a set of independent variable values.
+    /*!
+     *  Function interpolates dependent variable values at a set of independent variable values, with results identical
+     *  to those of the single-value interpolate function. If the independent variable values are sorted in ascending
+     *  order, the look-up scheme is only used for the first value, and the interval of each subsequent value is found
+     *  by walking upwards from that of the previous one.
+     *  \param targetIndependentVariableValues Target independent variable values at which the interpolation is
+     *      performed.
+     *  \param interpolatedValues Interpolated dependent variable values (returned by reference).
+     */
+    void interpolate( const std::vector< IndependentVariableType >& targetIndependentVariableValues,
+                      std::vector< DependentVariableType >& interpolatedValues )
+    {
+        interpolatedValues.resize( targetIndependentVariableValues.size( ) );
+
+        const bool walkThroughValues = std::is_sorted(
+                    targetIndependentVariableValues.begin( ), targetIndependentVariableValues.end( ) );
+        int lowerEntry = -1;
+        for( unsigned int i = 0; i < targetIndependentVariableValues.size( ); i++ )
+        {
+            // Check whether boundary handling needs to be applied
+            bool useValue = false;
+            this->checkBoundaryCase( interpolatedValues[ i ], useValue, targetIndependentVariableValues[ i ] );
+            if( useValue )
+            {
+                continue;
+            }
+
+            // Determine lower entry, and evaluate spline
+            if( walkThroughValues && lowerEntry >= 0 )
+            {
+                lowerEntry = this->findNearestLowerNeighbourFromEntry( targetIndependentVariableValues[ i ], lowerEntry );
+            }
+            else
+            {
+                lowerEntry = lookUpScheme_->findNearestLowerNeighbour( targetIndependentVariableValues[ i ] );
+            }
+            interpolatedValues[ i ] = evaluateSpline( targetIndependentVariableValues[ i ], lowerEntry );
+        }
+    }
+
+    InterpolatorTypes getInterpolatorType( ){ return cubic_spline_interpolator; }
+
+    //! Function to retrieve the heap memory held by the interpolator (including second derivatives of curve), in bytes
+    std::size_t getHeapMemorySize( ) const
+    {
+        return OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::getHeapMemorySize( ) +
+                utilities::getHeapMemorySize( secondDerivativeOfCurve_ );
+    }
+
+protected:
+
+private:
+
+    //! Function to evaluate the spline at a given independent variable value, in a given interval.
+    /*!
+     *  Function to evaluate the spline at a given independent variable value, using the polynomial of the given
+     *  interval (see Press W.H., et al., 2002).
+     *  \param targetIndependentVariableValue Target independent variable value at which the spline is evaluated.
+     *  \param lowerEntry Index of lower bound of interval of which the polynomial is used.
+     *  \return Interpolated dependent variable value.
+     */
+    DependentVariableType evaluateSpline( const IndependentVariableType targetIndependentVariableValue,
+                                          const int lowerEntry ) const
+    {
         // Get independent variable values bounding interval in which requested value lies.
         IndependentVariableType lowerValue, upperValue;
         ScalarType squareDifference;
-        lowerValue = independentValues_[ lowerEntry_ ];
-        upperValue = independentValues_[ lowerEntry_ + 1 ];
+        lowerValue = independentValues_[ lowerEntry ];
+        upperValue = independentValues_[ lowerEntry + 1 ];
 
         // Calculate coefficients A,B,C,D (see Numerical (Press W.H., et al., 2002))
         squareDifference = static_cast< ScalarType >( upperValue - lowerValue ) *
@@ -319,18 +406,12 @@ public:
                 mathematical_constants::getFloatingInteger< ScalarType >( 6.0 ) * squareDifference;
 
         // The interpolated dependent variable value.
-        return coefficientA_ * dependentValues_[ lowerEntry_ ] +
-                coefficientB_ * dependentValues_[ lowerEntry_ + 1 ] +
-                coefficientC_ * secondDerivativeOfCurve_[ lowerEntry_ ] +
-                coefficientD_ * secondDerivativeOfCurve_[ lowerEntry_ + 1 ];
+        return coefficientA_ * dependentValues_[ lowerEntry ] +
+                coefficientB_ * dependentValues_[ lowerEntry + 1 ] +
+                coefficientC_ * secondDerivativeOfCurve_[ lowerEntry ] +
+                coefficientD_ * secondDerivativeOfCurve_[ lowerEntry + 1 ];
     }
 
-    InterpolatorTypes getInterpolatorType( ){ return cubic_spline_interpolator; }
-
-protected:
-
-private:
-
     //! Calculates the second derivatives of the curve.
     /*!
      *  This function calculates the second derivatives of the curve at the nodes, assuming
@@ -12,6 +12,7 @@
 #ifndef TUDAT_HERMITE_CUBIC_SPLINE_INTERPOLATOR_H
 #define TUDAT_HERMITE_CUBIC_SPLINE_INTERPOLATOR_H
 
+#include <algorithm>
 #include <Eigen/Core>
 #include <vector>
 
@@ -160,6 +161,23 @@ public:
      *  \return Interpolated value of interpolated dependent variable.
      */
     DependentVariableType interpolate( const IndependentVariableType targetIndependentVariableValue )
+    {
+        return interpolate( targetIndependentVariableValue, *lookUpScheme_ );
+    }
+
+    //! Function interpolates dependent variable value at given independent variable value, using given look-up scheme.
+    /*!
+     *  Function interpolates dependent variable value, as the single-argument interpolate function, but using
+     *  the given look-up scheme (cursor), instead of the look-up scheme of this object. Since the interpolator is
+     *  not modified, this function may be called concurrently, with a separate look-up scheme per thread.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *      is to take place.
+     *  \param lookUpScheme Look-up scheme (created from the independent variables of this interpolator)
+     *      that is used to find the interval in which the independent variable lies.
+     *  \return Interpolated value of interpolated dependent variable.
+     */
+    DependentVariableType interpolate( const IndependentVariableType targetIndependentVariableValue,
+                                       LookUpScheme< IndependentVariableType >& lookUpScheme )
     {
         // Check whether boundary handling needs to be applied, if independent variable is beyond its defined range.
         DependentVariableType targetValue;
@@ -171,18 +189,50 @@ public:
         }
 
         // Determine the lower entry in the table corresponding to the target independent variable value.
-        int lowerEntry_ = lookUpScheme_->findNearestLowerNeighbour( targetIndependentVariableValue );
+        int lowerEntry_ = lookUpScheme.findNearestLowerNeighbour( targetIndependentVariableValue );
 
         // Compute Hermite spline
-        ScalarType factor = static_cast< ScalarType >( targetIndependentVariableValue - independentValues_[ lowerEntry_ ] ) /
-                static_cast< ScalarType >( independentValues_[ lowerEntry_ + 1 ] - independentValues_[ lowerEntry_ ] );
-        targetValue =
-                coefficients_[ 0 ][ lowerEntry_ ] * factor * factor * factor +
-                coefficients_[ 1 ][ lowerEntry_ ] * factor * factor +
-                coefficients_[ 2 ][ lowerEntry_ ] * factor +
-                coefficients_[ 3 ][ lowerEntry_ ] ;
-
-        return targetValue;
+        return evaluateSpline( targetIndependentVariableValue, lowerEntry_ );
+    }
+
+    //! Function interpolates dependent variable values at a set of independent variable values.
+    /*!
+     *  Function interpolates dependent variable values at a set of independent variable values, with results identical
+     *  to those of the single-value interpolate function. If the independent variable values are sorted in ascending
+     *  order, the look-up scheme is only used for the first value, and the interval of each subsequent value is found
+     *  by walking upwards from that of the previous one.
+     *  \param targetIndependentVariableValues Values of independent variable at which interpolation is to take place.
+     *  \param targetValues Interpolated values of dependent variable (returned by reference).
+     */
+    void interpolate( const std::vector< IndependentVariableType >& targetIndependentVariableValues,
+                      std::vector< DependentVariableType >& targetValues )
+    {
+        targetValues.resize( targetIndependentVariableValues.size( ) );
+
+        const bool walkThroughValues = std::is_sorted(
+                    targetIndependentVariableValues.begin( ), targetIndependentVariableValues.end( ) );
+        int lowerEntry = -1;
+        for( unsigned int i = 0; i < targetIndependentVariableValues.size( ); i++ )
+        {
+            // Check whether boundary handling needs to be applied
+            bool useValue = false;
+            this->checkBoundaryCase( targetValues[ i ], useValue, targetIndependentVariableValues[ i ] );
+            if( useValue )
+            {
+                continue;
+            }
+
+            // Determine lower entry, and compute Hermite spline
+            if( walkThroughValues && lowerEntry >= 0 )
+            {
+                lowerEntry = this->findNearestLowerNeighbourFromEntry( targetIndependentVariableValues[ i ], lowerEntry );
+            }
+            else
+            {
+                lowerEntry = lookUpScheme_->findNearestLowerNeighbour( targetIndependentVariableValues[ i ] );
+            }
+            targetValues[ i ] = evaluateSpline( targetIndependentVariableValues[ i ], lowerEntry );
+        }
     }
 
     InterpolatorTypes getInterpolatorType( ){ return hermite_spline_interpolator; }
@@ -230,6 +280,18 @@ protected:
 
 private:
 
+    //! Function to evaluate the Hermite spline at a given independent variable value, in a given interval.
+    DependentVariableType evaluateSpline( const IndependentVariableType targetIndependentVariableValue,
+                                          const int lowerEntry ) const
+    {
+        ScalarType factor = static_cast< ScalarType >( targetIndependentVariableValue - independentValues_[ lowerEntry ] ) /
+                static_cast< ScalarType >( independentValues_[ lowerEntry + 1 ] - independentValues_[ lowerEntry ] );
+        return coefficients_[ 0 ][ lowerEntry ] * factor * factor * factor +
+                coefficients_[ 1 ][ lowerEntry ] * factor * factor +
+                coefficients_[ 2 ][ lowerEntry ] * factor +
+                coefficients_[ 3 ][ lowerEntry ] ;
+    }
+
     //! Derivatives of dependent variable to independent variable
     std::vector< DependentVariableType > derivativeValues_ ;
 
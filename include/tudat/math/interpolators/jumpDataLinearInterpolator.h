@@ -152,6 +152,23 @@ public:
      *  \return Interpolated value of dependent variable.
      */
     DependentVariableType interpolate( const IndependentVariableType independentVariableValue )
+    {
+        return interpolate( independentVariableValue, *lookUpScheme_ );
+    }
+
+    //! Function interpolates dependent variable value at given independent variable value, using given look-up scheme.
+    /*!
+     *  Function interpolates dependent variable value, as the single-argument interpolate function, but using
+     *  the given look-up scheme (cursor), instead of the look-up scheme of this object. Since the interpolator is
+     *  not modified, this function may be called concurrently, with a separate look-up scheme per thread.
+     *  \param independentVariableValue Value of independent variable at which interpolation
+     *  is to take place.
+     *  \param lookUpScheme Look-up scheme (created from the independent variables of this interpolator)
+     *      that is used to find the interval in which the independent variable lies.
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolate( const IndependentVariableType independentVariableValue,
+                                       LookUpScheme< IndependentVariableType >& lookUpScheme )
     {
         // Check whether boundary handling needs to be applied, if independent variable is beyond its defined range.
         DependentVariableType interpolatedValue;
@@ -163,7 +180,7 @@ public:
         }
 
         // Lookup nearest lower index.
-        int newNearestLowerIndex = lookUpScheme_->findNearestLowerNeighbour( independentVariableValue );
+        int newNearestLowerIndex = lookUpScheme.findNearestLowerNeighbour( independentVariableValue );
 
 
         // Check if jump occurs
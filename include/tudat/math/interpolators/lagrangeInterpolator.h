@@ -43,9 +43,11 @@ enum LagrangeInterpolatorBoundaryHandling
 /*!
  *  Class to perform Lagrange polynomial interpolation from a set of independent and
  *  dependent values, as well as the order of the interpolation. Note that this class is optimized
- *  for many function calls to interpolate, since the denominators for
- *  the interpolations are pre-computed for all interpolation intervals.
- *  See e.g. http://mathworld.wolfram.com/LagrangeInterpolatingPolynomial.html for
+ *  for many function calls to interpolate, since the barycentric weights for
+ *  the interpolations are pre-computed for all interpolation intervals. The interpolating polynomial is
+ *  evaluated using the second (true) form of the barycentric formula (Berrut and Trefethen, 2004), which requires
+ *  O(numberOfStages) operations per interpolation, and provides the derivative of the polynomial at little
+ *  additional cost. See e.g. http://mathworld.wolfram.com/LagrangeInterpolatingPolynomial.html for
  *  mathematical details.
  */
 template< typename IndependentVariableType, typename DependentVariableType,
@@ -133,13 +135,10 @@ public:
         // Create lookup scheme from independent variable values.
         this->makeLookupScheme( selectedLookupScheme );
 
-        // Calculate denominators for each interval, to prevent recalculations dueint each
+        // Calculate barycentric weights for each interval, to prevent recalculations during each
         // interpolation call.
-        initializeDenominators( );
+        initializeBarycentricWeights( );
         initializeBoundaryInterpolators( selectedLookupScheme );
-
-        // Pre-allocate cache vector for computational efficiency.
-        independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
     }
 
     //! Constructor from map of independent/dependent data.
@@ -214,12 +213,10 @@ public:
         // Create lookup scheme from independent variable data points.
         this->makeLookupScheme( selectedLookupScheme );
 
-        // Calculate denominators for each interval, to prevent recalculations dueint each
-        //interpolation call.
-        initializeDenominators( );
+        // Calculate barycentric weights for each interval, to prevent recalculations during each
+        // interpolation call.
+        initializeBarycentricWeights( );
         initializeBoundaryInterpolators( selectedLookupScheme );
-
-        independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
     }
 
     //! Destructor.
@@ -242,18 +239,70 @@ public:
      */
     DependentVariableType interpolate( const IndependentVariableType targetIndependentVariableValue )
     {
-        // Check whether boundary handling needs to be applied, if independent variable is beyond its defined range.
+        return interpolate( targetIndependentVariableValue, *lookUpScheme_ );
+    }
+
+    //! Function interpolates dependent variable value at given independent variable value, using given look-up scheme.
+    /*!
+     *  Function interpolates dependent variable value, as the single-argument interpolate function, but using
+     *  the given look-up scheme (cursor), instead of the look-up scheme of this object. Since the interpolator is
+     *  not modified, this function may be called concurrently, with a separate look-up scheme per thread.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *      is to take place.
+     *  \param lookUpScheme Look-up scheme (created from the independent variables of this interpolator)
+     *      that is used to find the interval in which the independent variable lies.
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolate( const IndependentVariableType targetIndependentVariableValue,
+                                       LookUpScheme< IndependentVariableType >& lookUpScheme )
+    {
         DependentVariableType interpolatedValue = zeroEntry_;
+        interpolate( targetIndependentVariableValue, interpolatedValue, lookUpScheme );
+        return interpolatedValue;
+    }
+
+    //! Function interpolates dependent variable value at given independent variable value, into a given output.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value, as the single-argument
+     *  interpolate function, but accumulates the result directly into the given output. When the centered
+     *  Lagrange polynomial is used, and the output is of the correct size, no dependent variable temporaries are
+     *  created.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *      is to take place.
+     *  \param interpolatedValue Interpolated value of dependent variable (returned by reference).
+     */
+    void interpolate( const IndependentVariableType targetIndependentVariableValue,
+                      DependentVariableType& interpolatedValue )
+    {
+        interpolate( targetIndependentVariableValue, interpolatedValue, *lookUpScheme_ );
+    }
+
+    //! Function interpolates dependent variable value at given independent variable value, into a given output, using
+    //! given look-up scheme.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value into a given output, as the
+     *  two-argument function, but using the given look-up scheme (cursor), instead of the look-up scheme of this object.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *      is to take place.
+     *  \param interpolatedValue Interpolated value of dependent variable (returned by reference).
+     *  \param lookUpScheme Look-up scheme (created from the independent variables of this interpolator)
+     *      that is used to find the interval in which the independent variable lies.
+     */
+    void interpolate( const IndependentVariableType targetIndependentVariableValue,
+                      DependentVariableType& interpolatedValue,
+                      LookUpScheme< IndependentVariableType >& lookUpScheme )
+    {
+        // Check whether boundary handling needs to be applied, if independent variable is beyond its defined range.
         bool useValue = false;
         this->checkBoundaryCase( interpolatedValue, useValue, targetIndependentVariableValue );
         if( useValue )
         {
-            return interpolatedValue;
+            return;
         }
 
         // Determine the lower entry in the table corresponding to the target independent variable
         // value.
-        int lowerEntry = lookUpScheme_->findNearestLowerNeighbour(
+        int lowerEntry = lookUpScheme.findNearestLowerNeighbour(
                     targetIndependentVariableValue );
 
         // Check if requested interval is inside region in which centered lagrange interpolation
@@ -286,52 +335,94 @@ public:
         }
         else
         {
-            // Initialize repeated numerator to 1
-            ScalarType repeatedNumerator =
-                    mathematical_constants::getFloatingInteger< ScalarType >( 1 );
-
-            // Check if requested independent variable is equal to data point
-            if( independentValues_[ lowerEntry ] == targetIndependentVariableValue )
-            {
-                interpolatedValue = dependentValues_[ lowerEntry ];
-            }
-            else if( independentValues_[ lowerEntry + 1 ] == targetIndependentVariableValue )
-            {
-                interpolatedValue = dependentValues_[ lowerEntry + 1 ];
-            }
-            else if( independentValues_[ lowerEntry - 1 ] == targetIndependentVariableValue )
-            {
-                interpolatedValue = dependentValues_[ lowerEntry - 1 ];
-            }
-            else
+            evaluateBarycentricPolynomial< DependentVariableType >(
+                        targetIndependentVariableValue, lowerEntry, interpolatedValue, nullptr,
+                        [ this ]( const int index ) -> const DependentVariableType&
             {
-                // Set up repeated numerator and cache of independent variable values from which
-                // interpolant is created.
-                int j = 0;
-                for( int i = 0; i <= 2 * offsetEntries_ + 1; i++ )
-                {
-                    j = i + lowerEntry - offsetEntries_;
-                    independentVariableDifferenceCache[ i ] =
-                            static_cast< ScalarType >(
-                                targetIndependentVariableValue - independentValues_[ j ] );
+                return dependentValues_[ index ];
+            } );
+        }
+    }
 
-                    repeatedNumerator *= independentVariableDifferenceCache[ i ];
+    //! Function interpolates dependent variable value, and its derivative, at given independent variable value.
+    /*!
+     *  Function interpolates dependent variable value, and its derivative w.r.t. the independent variable, at given
+     *  independent variable value, accumulating the results directly into the given outputs. Both are obtained from
+     *  the centered Lagrange polynomial in barycentric form, so that the derivative requires only one additional
+     *  accumulation per data point. Since the derivative is only available where the centered polynomial is used,
+     *  an exception is thrown if the independent variable is in the boundary region of the domain, or outside of it.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *      is to take place.
+     *  \param interpolatedValue Interpolated value of dependent variable (returned by reference).
+     *  \param interpolatedDerivative Derivative of interpolated dependent variable w.r.t. independent variable
+     *      (returned by reference).
+     */
+    void interpolateWithDerivative( const IndependentVariableType targetIndependentVariableValue,
+                                    DependentVariableType& interpolatedValue,
+                                    DependentVariableType& interpolatedDerivative )
+    {
+        int lowerEntry = -1;
+        if( this->checkInterpolationBoundary( targetIndependentVariableValue ) == 0 )
+        {
+            lowerEntry = lookUpScheme_->findNearestLowerNeighbour( targetIndependentVariableValue );
+        }
 
-                }
+        if( lowerEntry < offsetEntries_ || lowerEntry >= numberOfIndependentValues_ - offsetEntries_ - 1 )
+        {
+            throw std::runtime_error(
+                        "Error: Lagrange interpolator derivative only available where centered interpolation is used." );
+        }
 
-                // Evaluate interpolating polynomial at requested data point.
-                for( int i = 0; i < numberOfStages_; i++ )
-                {
-                    j = i + lowerEntry - offsetEntries_;
-                    interpolatedValue += dependentValues_[ j ]  *
-                            ( repeatedNumerator /
-                              ( independentVariableDifferenceCache[ i ] *
-                                denominators[ lowerEntry ][ j - lowerEntry + offsetEntries_ ] ) );
-                }
-            }
+        evaluateBarycentricPolynomial< DependentVariableType >(
+                    targetIndependentVariableValue, lowerEntry, interpolatedValue, &interpolatedDerivative,
+                    [ this ]( const int index ) -> const DependentVariableType&
+        {
+            return dependentValues_[ index ];
+        } );
+    }
+
+    //! Function interpolates a block of rows of a (matrix) dependent variable at given independent variable value.
+    /*!
+     *  Function interpolates a block of rows of a (matrix) dependent variable at given independent variable value,
+     *  writing the result directly into the given block, which determines the number of rows and columns that are
+     *  interpolated. Only the requested rows of the tabulated dependent variables are used, so that no full matrix is
+     *  evaluated or allocated. At the boundaries of the interpolation domain (where the boundary interpolators or
+     *  boundary handling are used), the full dependent variable is interpolated, and the block is retrieved from it.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation is to take place.
+     *  \param startRow Index of first row of dependent variable that is to be interpolated
+     *  \param interpolatedRows Block into which the interpolated rows are written (returned by reference).
+     */
+    template< typename BlockType >
+    void interpolateRows( const IndependentVariableType targetIndependentVariableValue,
+                          const int startRow,
+                          BlockType interpolatedRows )
+    {
+        const int numberOfRows = interpolatedRows.rows( );
+        const int numberOfColumns = interpolatedRows.cols( );
+
+        int lowerEntry = -1;
+        if( this->boundaryHandling_ == extrapolate_at_boundary ||
+                this->checkInterpolationBoundary( targetIndependentVariableValue ) == 0 )
+        {
+            lowerEntry = lookUpScheme_->findNearestLowerNeighbour( targetIndependentVariableValue );
         }
 
-        return interpolatedValue;
+        // Interpolate full dependent variable if centered interpolation can not be used
+        if( lowerEntry < offsetEntries_ || lowerEntry >= numberOfIndependentValues_ - offsetEntries_ - 1 )
+        {
+            interpolatedRows = interpolate( targetIndependentVariableValue ).block(
+                        startRow, 0, numberOfRows, numberOfColumns );
+        }
+        else
+        {
+            // Evaluate interpolating polynomial at requested data point, for requested rows only.
+            evaluateBarycentricPolynomial< BlockType >(
+                        targetIndependentVariableValue, lowerEntry, interpolatedRows, nullptr,
+                        [ & ]( const int index )
+            {
+                return dependentValues_[ index ].block( startRow, 0, numberOfRows, numberOfColumns );
+            } );
+        }
     }
 
     //! Function to retrieve the number of stages of interpolator
@@ -351,18 +442,200 @@ public:
         return lagrangeBoundaryHandling_;
     }
 
+    //! Function to reset the data points of the interpolator, reusing its existing storage.
+    /*!
+     *  Function to reset the data points of the interpolator, without creating a new interpolator. The new data is
+     *  copied into the existing vectors, so that no reallocation takes place if the number of data points does not
+     *  increase. If the independent variables are identical to the current ones (e.g. when resetting a propagation
+     *  history with unchanged output times), the look-up scheme and barycentric weights are retained, and only the
+     *  dependent variables and boundary interpolators are updated. Since the interpolator is modified, this function
+     *  may not be called while the interpolator is being used (by another thread, or through a cursor).
+     *  \param independentVariables Vector of values of independent variables that are used, must be
+     *      sorted in ascending order.
+     *  \param dependentVariables Vector of values of dependent variables that are used.
+     */
+    void resetData( const std::vector< IndependentVariableType >& independentVariables,
+                    const std::vector< DependentVariableType >& dependentVariables )
+    {
+        // Check consistency of input data.
+        if( independentVariables.size( ) != dependentVariables.size( ) )
+        {
+            throw std::runtime_error( "Error: indep. and dep. variables incompatible when resetting Lagrange interpolator." );
+        }
+
+        if( independentVariables.size( ) < static_cast< unsigned int >( numberOfStages_ ) )
+        {
+            throw std::runtime_error( "Error when resetting Lagrange interpolator, input is of size " +
+                                      std::to_string( independentVariables.size( ) ) +
+                                      ". This is smaller than the number of points needed for interpolator, which is " +
+                                      std::to_string( numberOfStages_ ) );
+        }
+
+        // Reset independent variables, if changed
+        bool independentVariablesAreUnchanged = ( independentVariables == independentValues_ );
+        if( !independentVariablesAreUnchanged )
+        {
+            if( !std::is_sorted( independentVariables.begin( ), independentVariables.end( ) ) )
+            {
+                throw std::runtime_error( "Error when resetting lagrange interpolator, input vector with independent variables should be in ascending order" );
+            }
+            independentValues_.assign( independentVariables.begin( ), independentVariables.end( ) );
+            numberOfIndependentValues_ = static_cast< int >( independentValues_.size( ) );
+        }
+
+        // Reset dependent variables
+        dependentValues_.assign( dependentVariables.begin( ), dependentVariables.end( ) );
+        zeroEntry_ = dependentValues_[ 0 ] - dependentValues_[ 0 ];
+
+        // Update look-up scheme and barycentric weights, if needed, and boundary interpolators.
+        if( !independentVariablesAreUnchanged )
+        {
+            this->makeLookupScheme( this->selectedLookupScheme_ );
+            initializeBarycentricWeights( );
+        }
+        initializeBoundaryInterpolators( this->selectedLookupScheme_ );
+    }
+
+    //! Function to retrieve the heap memory held by the interpolator (including barycentric weights and boundary
+    //! interpolators), in bytes
+    std::size_t getHeapMemorySize( ) const
+    {
+        std::size_t heapMemorySize =
+                OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::getHeapMemorySize( ) +
+                utilities::getHeapMemorySize( barycentricWeights_ );
+        if( beginInterpolator_ != nullptr )
+        {
+            heapMemorySize += beginInterpolator_->getHeapMemorySize( );
+        }
+        if( endInterpolator_ != nullptr )
+        {
+            heapMemorySize += endInterpolator_->getHeapMemorySize( );
+        }
+        return heapMemorySize;
+    }
+
 
 protected:
 
 private:
 
-    //! Function called at initialization which pre-computes the denominators of the
+    //! Function to evaluate the centered interpolating polynomial (and optionally its derivative) in barycentric form.
+    /*!
+     *  Function to evaluate the centered interpolating polynomial in the given interval using the second form of the
+     *  barycentric formula, p( x ) = sum_i c_i f_i / sum_i c_i, with c_i = w_i / ( x - x_i ). The derivative is
+     *  computed from p'( x ) = sum_i c_i ( p( x ) - f_i ) / ( x - x_i ) / sum_i c_i. If the independent variable
+     *  coincides with a data point x_k, the value f_k is used directly, and the derivative is computed from
+     *  p'( x_k ) = sum_{i!=k} ( w_i / w_k ) ( f_i - f_k ) / ( x_k - x_i ). The results are accumulated directly into
+     *  the outputs, so that no dependent variable temporaries are created.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation is to take place.
+     *  \param lowerEntry Nearest lower data point of independent variable value (must be in centered region).
+     *  \param interpolatedValue Interpolated value (returned by reference).
+     *  \param interpolatedDerivative Pointer to interpolated derivative (returned by reference), not computed if nullptr.
+     *  \param getDependentValue Function returning the (part of the) dependent variable at a given data point index.
+     */
+    template< typename OutputType, typename DependentValueFunction >
+    void evaluateBarycentricPolynomial(
+            const IndependentVariableType targetIndependentVariableValue,
+            const int lowerEntry,
+            OutputType& interpolatedValue,
+            OutputType* interpolatedDerivative,
+            const DependentValueFunction& getDependentValue )
+    {
+        const std::vector< ScalarType >& currentWeights = barycentricWeights_[ lowerEntry ];
+        const int startIndex = lowerEntry - offsetEntries_;
+
+        ScalarType coefficientSum = mathematical_constants::getFloatingInteger< ScalarType >( 0 );
+        ScalarType derivativeCoefficientSum = mathematical_constants::getFloatingInteger< ScalarType >( 0 );
+
+        // Accumulate (unnormalized) value and derivative, the first term initializes the outputs.
+        int dataPointIndex = -1;
+        for( int i = 0; i < numberOfStages_; i++ )
+        {
+            ScalarType independentVariableDifference = static_cast< ScalarType >(
+                        targetIndependentVariableValue - independentValues_[ i + startIndex ] );
+
+            // Check if requested independent variable is equal to data point
+            if( independentVariableDifference == mathematical_constants::getFloatingInteger< ScalarType >( 0 ) )
+            {
+                dataPointIndex = i;
+                break;
+            }
+
+            ScalarType barycentricCoefficient = currentWeights[ i ] / independentVariableDifference;
+            coefficientSum += barycentricCoefficient;
+            if( i == 0 )
+            {
+                interpolatedValue = getDependentValue( startIndex ) * barycentricCoefficient;
+            }
+            else
+            {
+                interpolatedValue += getDependentValue( i + startIndex ) * barycentricCoefficient;
+            }
+
+            if( interpolatedDerivative != nullptr )
+            {
+                ScalarType derivativeCoefficient = barycentricCoefficient / independentVariableDifference;
+                derivativeCoefficientSum += derivativeCoefficient;
+                if( i == 0 )
+                {
+                    *interpolatedDerivative = getDependentValue( startIndex ) * derivativeCoefficient;
+                }
+                else
+                {
+                    *interpolatedDerivative += getDependentValue( i + startIndex ) * derivativeCoefficient;
+                }
+            }
+        }
+
+        if( dataPointIndex < 0 )
+        {
+            ScalarType inverseCoefficientSum = mathematical_constants::getFloatingInteger< ScalarType >( 1 ) /
+                    coefficientSum;
+            interpolatedValue *= inverseCoefficientSum;
+            if( interpolatedDerivative != nullptr )
+            {
+                *interpolatedDerivative *= -inverseCoefficientSum;
+                *interpolatedDerivative += interpolatedValue * ( derivativeCoefficientSum * inverseCoefficientSum );
+            }
+        }
+        else
+        {
+            interpolatedValue = getDependentValue( dataPointIndex + startIndex );
+            if( interpolatedDerivative != nullptr )
+            {
+                bool isFirstTerm = true;
+                for( int i = 0; i < numberOfStages_; i++ )
+                {
+                    if( i != dataPointIndex )
+                    {
+                        ScalarType derivativeCoefficient = currentWeights[ i ] / (
+                                    currentWeights[ dataPointIndex ] * static_cast< ScalarType >(
+                                        independentValues_[ dataPointIndex + startIndex ] -
+                                    independentValues_[ i + startIndex ] ) );
+                        if( isFirstTerm )
+                        {
+                            *interpolatedDerivative =
+                                    ( getDependentValue( i + startIndex ) - interpolatedValue ) * derivativeCoefficient;
+                            isFirstTerm = false;
+                        }
+                        else
+                        {
+                            *interpolatedDerivative +=
+                                    ( getDependentValue( i + startIndex ) - interpolatedValue ) * derivativeCoefficient;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    //! Function called at initialization which pre-computes the barycentric weights of the
     //! interpolants at each interval.
     /*!
-     *  Function called at initialization which pre-computes the denominators of the interpolants
-     *  at each interval, i.e. each interval between two subsequent independent variable values.
+     *  Function called at initialization which pre-computes the barycentric weights w_j = 1 / prod_{k!=j}( x_j - x_k )
+     *  of the interpolants at each interval, i.e. each interval between two subsequent independent variable values.
      */
-    void initializeDenominators( )
+    void initializeBarycentricWeights( )
     {
         // Check validity of requested number of stages"
         if( numberOfStages_ % 2 != 0 )
@@ -379,31 +652,32 @@ private:
         // Determine offset from boundary of interpolation interval where interpolant is valid.
         offsetEntries_ = numberOfStages_ / 2 - 1;
 
-        // Iterate over all intervals and calculate denominators
+        // Iterate over all intervals and calculate barycentric weights
         int currentIterationStart;
-        denominators.resize( numberOfIndependentValues_ );
+        ScalarType currentDenominator;
+        barycentricWeights_.resize( numberOfIndependentValues_ );
         for( int i = offsetEntries_; i < numberOfIndependentValues_ - offsetEntries_ - 1 ; i++ )
         {
             // Determine start index in independent variables for current polynomial
             currentIterationStart = i - offsetEntries_;
 
-            denominators[ i ].resize( 2 * offsetEntries_ + 2 );
+            barycentricWeights_[ i ].resize( numberOfStages_ );
 
-            // Calculate all denominators for single interval.
+            // Calculate all weights for single interval.
             for( int j = 0; j < numberOfStages_; j++ )
             {
-                denominators[ i ][ j ] =
-                        mathematical_constants::getFloatingInteger< ScalarType >( 1 );
-
+                currentDenominator = mathematical_constants::getFloatingInteger< ScalarType >( 1 );
                 for( int k = 0; k < numberOfStages_; k++ )
                 {
                     if( k != j )
                     {
-                        denominators[ i ][ j ] *= static_cast< ScalarType >(
+                        currentDenominator *= static_cast< ScalarType >(
                                     independentValues_[ j + currentIterationStart ] -
                                 independentValues_[ k + currentIterationStart ] );
                     }
                 }
+                barycentricWeights_[ i ][ j ] = mathematical_constants::getFloatingInteger< ScalarType >( 1 ) /
+                        currentDenominator;
             }
         }
     }
@@ -451,16 +725,17 @@ private:
                 endMap[ independentValues_.at( i ) ] = dependentValues_.at( i );
             }
 
-            // Create cubic spline interpolators
+            // Create cubic spline interpolators (with a look-up scheme without state, so that the interpolator can be used
+            // concurrently with different look-up schemes, see interpolate( IndependentVariableType, LookUpScheme& ) )
             beginInterpolator_ = std::make_shared< CubicSplineInterpolator
-                    < IndependentVariableType, DependentVariableType, ScalarType > >( startMap );
+                    < IndependentVariableType, DependentVariableType, ScalarType > >( startMap, binarySearch );
             endInterpolator_ = std::make_shared< CubicSplineInterpolator
-                    < IndependentVariableType, DependentVariableType, ScalarType > >( endMap );
+                    < IndependentVariableType, DependentVariableType, ScalarType > >( endMap, binarySearch );
         }
     }
 
-    //! Pre-computed denominators to be used in interpolation
-    std::vector< std::vector< ScalarType > > denominators;
+    //! Pre-computed barycentric weights to be used in interpolation, per interval
+    std::vector< std::vector< ScalarType > > barycentricWeights_;
 
     //! Zero entry for dependent variables
     /*!
@@ -483,8 +758,6 @@ private:
      */
     int offsetEntries_;
 
-    std::vector< ScalarType > independentVariableDifferenceCache;
-
     //! Interpolator to be used at beginning of domain.
     std::shared_ptr< OneDimensionalInterpolator
     < IndependentVariableType, DependentVariableType > > beginInterpolator_;
@@ -12,9 +12,14 @@
 #ifndef TUDAT_LOOK_UP_SCHEME_H
 #define TUDAT_LOOK_UP_SCHEME_H
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
 #include <vector>
 #include <iostream>
 #include <memory>
+#include <string>
 
 #include "tudat/math/basic/nearestNeighbourSearch.h"
 
@@ -31,13 +36,16 @@ enum AvailableLookupScheme
 {
     undefinedScheme,
     huntingAlgorithm,
-    binarySearch
+    binarySearch,
+    uniformGrid
 };
 
 //! Look-up scheme class for nearest left neighbour search.
 /*!
  * Look-up scheme class for nearest left neighbour search,
- * allows for different types of look-up scheme with a single interface.
+ * allows for different types of look-up scheme with a single interface. The vector in which the lookup is performed is
+ * stored as immutable shared data, so that look-up schemes with separate state (e.g. the previous index of the hunting
+ * algorithm), for instance one per thread, can be created cheaply (see cloneCursor).
  * \tparam IndependentVariableType Type of entries of vector in which lookup is to be performed.
  */
 template< typename IndependentVariableType >
@@ -52,7 +60,18 @@ public:
      * lookup procedure.
      */
     LookUpScheme( const std::vector< IndependentVariableType >& independentVariableValues )
-        : independentVariableValues_( independentVariableValues )
+        : LookUpScheme( std::make_shared< const std::vector< IndependentVariableType > >( independentVariableValues ) )
+    { }
+
+    //! Constructor, used to set shared data vector.
+    /*!
+     * Constructor, used to set shared data vector.
+     * \param independentVariableValues vector of independent variable values in which to perform
+     * lookup procedure, shared with other look-up schemes.
+     */
+    LookUpScheme( const std::shared_ptr< const std::vector< IndependentVariableType > >& independentVariableValues )
+        : independentVariableValuesPointer_( independentVariableValues ),
+          independentVariableValues_( *independentVariableValuesPointer_ )
     { }
 
     //! Destructor.
@@ -70,6 +89,25 @@ public:
      */
     virtual int findNearestLowerNeighbour( const IndependentVariableType valueToLookup ) = 0;
 
+    //! Function to create a look-up scheme of the same type, with separate state, sharing the data vector of this object.
+    /*!
+     * Function to create a look-up scheme of the same type, with separate state (i.e. as if newly created), sharing the
+     * data vector of this object, so that no independent variable values are copied. Concurrent lookups may then be
+     * performed using a separate look-up scheme for each thread.
+     * \return Look-up scheme of the same type, with separate state
+     */
+    virtual std::shared_ptr< LookUpScheme< IndependentVariableType > > cloneCursor( ) const = 0;
+
+    //! Function to retrieve the (shared) vector in which lookup is performed
+    /*!
+     * Function to retrieve the (shared) vector in which lookup is performed
+     * \return Vector of independent variable values in which lookup is performed
+     */
+    std::shared_ptr< const std::vector< IndependentVariableType > > getIndependentVariableValues( ) const
+    {
+        return independentVariableValuesPointer_;
+    }
+
     IndependentVariableType getMinimumValue( )
     {
         return independentVariableValues_.at( 0 );
@@ -85,11 +123,15 @@ public:
     }
 protected:
 
+    //! Shared vector of independent variable values in which lookup is to be performed.
+    std::shared_ptr< const std::vector< IndependentVariableType > > independentVariableValuesPointer_;
+
     //! Vector of independent variable values in which lookup is to be performed.
     /*!
-     * Vector of independent variable values in which lookup is to be performed.
+     * Vector of independent variable values in which lookup is to be performed (reference to the vector in
+     * independentVariableValuesPointer_).
      */
-    std::vector< IndependentVariableType > independentVariableValues_;
+    const std::vector< IndependentVariableType >& independentVariableValues_;
 };
 
 //! Look-up scheme class for nearest left neighbour search using hunting algorithm.
@@ -117,6 +159,19 @@ public:
           previousNearestLowerIndex_( 0 )
     { }
 
+    //! Constructor, used to set shared data vector.
+    /*!
+     *  Constructor, used to set shared data vector. Initializes guess from 'previous' request to 0.
+     * \param independentVariableValues vector of independent variable values in which to perform
+     * lookup procedure, shared with other look-up schemes.
+     */
+    HuntingAlgorithmLookupScheme( const std::shared_ptr< const std::vector< IndependentVariableType > >&
+                                  independentVariableValues )
+        : LookUpScheme< IndependentVariableType >( independentVariableValues ),
+          isFirstLookupDone( 0 ),
+          previousNearestLowerIndex_( 0 )
+    { }
+
     //! Default destructor
     /*!
      *  Default destructor
@@ -137,20 +192,24 @@ public:
         int newNearestLowerIndex = 0;
 
         // If this is first call of function, use binary search.
-        if ( !isFirstLookupDone )
+        if ( !isFirstLookupDone.load( std::memory_order_relaxed ) )
         {
             newNearestLowerIndex = basic_mathematics::computeNearestLeftNeighborUsingBinarySearch
                     < IndependentVariableType >( independentVariableValues_, valueToLookup );
-            isFirstLookupDone = 1;
+            isFirstLookupDone.store( true, std::memory_order_relaxed );
         }
 
         else
         {
+            // Retrieve guess from previous call (any valid index yields the correct result, so that concurrent
+            // lookups only affect the efficiency of the search)
+            int previousNearestLowerIndex = previousNearestLowerIndex_.load( std::memory_order_relaxed );
+
             // If requested value is in same interval, return same value as previous time.
             if ( basic_mathematics::isIndependentVariableInInterval< IndependentVariableType >
-                 ( previousNearestLowerIndex_, valueToLookup, independentVariableValues_ ) )
+                 ( previousNearestLowerIndex, valueToLookup, independentVariableValues_ ) )
             {
-                newNearestLowerIndex = previousNearestLowerIndex_;
+                newNearestLowerIndex = previousNearestLowerIndex;
 
             }
 
@@ -160,30 +219,37 @@ public:
                 newNearestLowerIndex =
                         basic_mathematics::findNearestLeftNeighbourUsingHuntingAlgorithm<
                         IndependentVariableType >
-                        (  valueToLookup, previousNearestLowerIndex_, independentVariableValues_ );
+                        (  valueToLookup, previousNearestLowerIndex, independentVariableValues_ );
 
             }
         }
 
         // Set calculated value for use in next call.
-        previousNearestLowerIndex_ = newNearestLowerIndex;
+        previousNearestLowerIndex_.store( newNearestLowerIndex, std::memory_order_relaxed );
 
         return newNearestLowerIndex;
     }
 
+    //! Function to create a hunting algorithm look-up scheme, with separate state, sharing the data vector of this object.
+    std::shared_ptr< LookUpScheme< IndependentVariableType > > cloneCursor( ) const
+    {
+        return std::make_shared< HuntingAlgorithmLookupScheme< IndependentVariableType > >(
+                    this->independentVariableValuesPointer_ );
+    }
+
 private:
 
     //! Boolean to denote whether a lookup has been done.
     /*!
      * Boolean to denote whether a lookup has been done.
      */
-    bool isFirstLookupDone;
+    std::atomic< bool > isFirstLookupDone;
 
     //! Nearest left index during previous call.
     /*!
-     * Nearest left index during previous call
+     * Nearest left index during previous call (atomic, so that the lookup may be performed concurrently)
      */
-    int previousNearestLowerIndex_;
+    std::atomic< int > previousNearestLowerIndex_;
 };
 
 //! Look-up scheme class for nearest left neighbour search using binary search algorithm.
@@ -209,6 +275,17 @@ public:
         : LookUpScheme< IndependentVariableType >( independentVariableValues )
     { }
 
+    //! Constructor, used to set shared data vector.
+    /*!
+     * Constructor, used to set shared data vector.
+     * \param independentVariableValues vector of independent variable values in which to perform
+     * lookup procedure, shared with other look-up schemes.
+     */
+    BinarySearchLookupScheme(
+            const std::shared_ptr< const std::vector< IndependentVariableType > >& independentVariableValues )
+        : LookUpScheme< IndependentVariableType >( independentVariableValues )
+    { }
+
     //! Default destructor
     /*!
      *  Default destructor
@@ -228,6 +305,327 @@ public:
                 < IndependentVariableType >( independentVariableValues_, valueToLookup );
     }
 
+    //! Function to create a binary search look-up scheme, sharing the data vector of this object.
+    std::shared_ptr< LookUpScheme< IndependentVariableType > > cloneCursor( ) const
+    {
+        return std::make_shared< BinarySearchLookupScheme< IndependentVariableType > >(
+                    this->independentVariableValuesPointer_ );
+    }
+
+};
+
+//! Function to check whether a vector of independent variable values is equidistant (to within a given tolerance).
+/*!
+ * Function to check whether a vector of (strictly increasing) independent variable values is equidistant, i.e. whether
+ * all values deviate from x_0 + i * dx by at most the given fraction of the average spacing dx.
+ * \param independentVariableValues Vector of independent variable values that is to be checked
+ * \param relativeTolerance Maximum deviation of the values from the uniform grid, as a fraction of the average spacing
+ * \return True if the values are equidistant to within the tolerance (false for less than two values)
+ */
+template< typename IndependentVariableType >
+bool isIndependentVariableGridUniform(
+        const std::vector< IndependentVariableType >& independentVariableValues,
+        const double relativeTolerance = 1.0E-8 )
+{
+    const int numberOfValues = static_cast< int >( independentVariableValues.size( ) );
+    if( numberOfValues < 2 )
+    {
+        return false;
+    }
+
+    const double averageSpacing = static_cast< double >(
+                independentVariableValues.at( numberOfValues - 1 ) - independentVariableValues.at( 0 ) ) /
+            static_cast< double >( numberOfValues - 1 );
+    if( !( averageSpacing > 0.0 ) || std::isinf( averageSpacing ) )
+    {
+        return false;
+    }
+
+    for( int i = 1; i < numberOfValues - 1; i++ )
+    {
+        if( !( std::fabs( static_cast< double >( independentVariableValues[ i ] - independentVariableValues[ 0 ] ) -
+                          static_cast< double >( i ) * averageSpacing ) <= relativeTolerance * averageSpacing ) )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//! Look-up scheme class for nearest left neighbour search in equidistant independent variable values.
+/*!
+ * Look-up scheme class for nearest left neighbour search in equidistant independent variable values (e.g. tabulated
+ * data, or propagation results with a fixed step size). The index of the nearest left neighbour is computed directly from
+ * the distance to the first value and the (average) spacing, and is subsequently corrected by comparison with the
+ * neighbouring values, so that the result is identical to that of the other look-up schemes, also in the presence of
+ * rounding errors in the grid. A look-up is O(1), independent of the number of values and the order of the requests.
+ * The values are checked to be equidistant (to within the tolerance) upon construction.
+ * \tparam IndependentVariableType Type of entries of vector in which lookup is to be performed.
+ */
+template< typename IndependentVariableType >
+class UniformGridLookupScheme: public LookUpScheme< IndependentVariableType >
+{
+public:
+
+    using LookUpScheme< IndependentVariableType >::independentVariableValues_;
+
+    //! Constructor, used to set data vector.
+    /*!
+     * Constructor, used to set data vector.
+     * \param independentVariableValues vector of equidistant independent variable values in which to perform
+     * lookup procedure.
+     * \param relativeTolerance Maximum deviation of the values from the uniform grid, as a fraction of the spacing
+     */
+    UniformGridLookupScheme( const std::vector< IndependentVariableType >& independentVariableValues,
+                             const double relativeTolerance = 1.0E-8 )
+        : LookUpScheme< IndependentVariableType >( independentVariableValues )
+    {
+        if( !isIndependentVariableGridUniform( independentVariableValues, relativeTolerance ) )
+        {
+            throw std::runtime_error( "Error when creating uniform grid lookup scheme, independent variable values are not equidistant" );
+        }
+
+        maximumIndex_ = static_cast< int >( independentVariableValues_.size( ) ) - 2;
+        inverseSpacing_ = static_cast< double >( maximumIndex_ + 1 ) / static_cast< double >(
+                    independentVariableValues_.at( maximumIndex_ + 1 ) - independentVariableValues_.at( 0 ) );
+    }
+
+    //! Default destructor
+    ~UniformGridLookupScheme( ){ }
+
+    //! Find nearest left neighbour.
+    /*!
+     * Function finds nearest left neighbour of given value in independentVariableValues_.
+     * \param valueToLookup Value of which nearest neaighbour is to be determined.
+     * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
+     * to valueToLookup.
+     */
+    int findNearestLowerNeighbour( const IndependentVariableType valueToLookup )
+    {
+        // Compute index from distance to first value (values outside the grid are mapped to the first/last interval).
+        const double scaledDistance =
+                static_cast< double >( valueToLookup - independentVariableValues_[ 0 ] ) * inverseSpacing_;
+        int nearestLowerIndex;
+        if( !( scaledDistance > 0.0 ) )
+        {
+            nearestLowerIndex = 0;
+        }
+        else if( scaledDistance >= static_cast< double >( maximumIndex_ ) )
+        {
+            nearestLowerIndex = maximumIndex_;
+        }
+        else
+        {
+            nearestLowerIndex = static_cast< int >( scaledDistance );
+        }
+
+        // Correct index for rounding errors, and deviations of the values from the uniform grid.
+        while( nearestLowerIndex > 0 && valueToLookup < independentVariableValues_[ nearestLowerIndex ] )
+        {
+            nearestLowerIndex--;
+        }
+        while( nearestLowerIndex < maximumIndex_ && !( valueToLookup < independentVariableValues_[ nearestLowerIndex + 1 ] ) )
+        {
+            nearestLowerIndex++;
+        }
+
+        return nearestLowerIndex;
+    }
+
+    //! Function to create a uniform grid look-up scheme, sharing the data vector of this object.
+    std::shared_ptr< LookUpScheme< IndependentVariableType > > cloneCursor( ) const
+    {
+        // Copy this object (which has no state), to prevent repeated check of the grid
+        return std::make_shared< UniformGridLookupScheme< IndependentVariableType > >( *this );
+    }
+
+private:
+
+    //! Index of the last interval of the grid (number of values minus two).
+    int maximumIndex_;
+
+    //! Inverse of the (average) spacing of the grid.
+    double inverseSpacing_;
+};
+
+//! Function to create a look-up scheme of the selected type.
+/*!
+ * Function to create a look-up scheme of the selected type. If the hunting algorithm or binary search is selected, and
+ * the independent variable values are equidistant (to within a relative tolerance of 1.0E-8 of the spacing), the
+ * UniformGridLookupScheme is created instead, which provides identical results with an O(1) look-up.
+ * \param independentVariableValues vector of independent variable values in which to perform lookup procedure.
+ * \param selectedScheme Type of look-up scheme that is to be created
+ * \param detectUniformGrid Boolean denoting whether the uniform grid look-up is automatically used for equidistant values
+ * \return Look-up scheme
+ */
+template< typename IndependentVariableType >
+std::shared_ptr< LookUpScheme< IndependentVariableType > > createLookupScheme(
+        const std::vector< IndependentVariableType >& independentVariableValues,
+        const AvailableLookupScheme selectedScheme,
+        const bool detectUniformGrid = true )
+{
+    std::shared_ptr< LookUpScheme< IndependentVariableType > > lookUpScheme;
+    if( ( selectedScheme == huntingAlgorithm || selectedScheme == binarySearch ) && detectUniformGrid &&
+            isIndependentVariableGridUniform( independentVariableValues ) )
+    {
+        lookUpScheme = std::make_shared< UniformGridLookupScheme< IndependentVariableType > >(
+                    independentVariableValues );
+    }
+    else
+    {
+        switch( selectedScheme )
+        {
+        case binarySearch:
+            lookUpScheme = std::make_shared< BinarySearchLookupScheme< IndependentVariableType > >(
+                        independentVariableValues );
+            break;
+        case huntingAlgorithm:
+            // Create hunting scheme, which uses an intial guess from previous look-ups.
+            lookUpScheme = std::make_shared< HuntingAlgorithmLookupScheme< IndependentVariableType > >(
+                        independentVariableValues );
+            break;
+        case uniformGrid:
+            lookUpScheme = std::make_shared< UniformGridLookupScheme< IndependentVariableType > >(
+                        independentVariableValues );
+            break;
+        default:
+            throw std::runtime_error( "Error: lookup scheme " + std::to_string( selectedScheme ) + " not found when making scheme" );
+        }
+    }
+    return lookUpScheme;
+}
+
+//! Look-up scheme class for finding the current arc from a list of sorted, contiguous arc boundaries.
+/*!
+ * Look-up scheme class for finding the current arc from a list of sorted, contiguous arc boundaries, where arc i spans
+ * the interval [independentVariableValues_[i], independentVariableValues_[i+1]). Values before the first boundary are
+ * associated with the first arc, values after the last boundary with the last arc. The boundaries are checked to be
+ * strictly increasing upon construction. Since observations (and other time-ordered data) are typically processed in
+ * order, the arc found in the previous call, and the arc following it, are checked first, so that a lookup is O(1) for
+ * sorted input. Otherwise, a binary search is used.
+ * \tparam IndependentVariableType Type of entries of vector in which lookup is to be performed.
+ */
+template< typename IndependentVariableType >
+class ArcBoundaryLookupScheme: public LookUpScheme< IndependentVariableType >
+{
+public:
+
+    using LookUpScheme< IndependentVariableType >::independentVariableValues_;
+
+    //! Constructor, used to set arc boundaries.
+    /*!
+     * Constructor, used to set arc boundaries.
+     * \param arcBoundaries Sorted list of arc boundaries (at least two entries), with arc i spanning the interval from
+     * entry i to entry i+1.
+     */
+    ArcBoundaryLookupScheme( const std::vector< IndependentVariableType >& arcBoundaries )
+        : LookUpScheme< IndependentVariableType >( arcBoundaries ),
+          numberOfArcs_( static_cast< int >( arcBoundaries.size( ) ) - 1 ),
+          previousArcIndex_( 0 )
+    {
+        if( numberOfArcs_ < 1 )
+        {
+            throw std::runtime_error( "Error when creating arc boundary lookup scheme, at least two boundaries are required" );
+        }
+
+        for( int i = 0; i < numberOfArcs_; i++ )
+        {
+            if( !( arcBoundaries.at( i ) < arcBoundaries.at( i + 1 ) ) )
+            {
+                throw std::runtime_error( "Error when creating arc boundary lookup scheme, arc boundaries are not strictly increasing" );
+            }
+        }
+    }
+
+    //! Copy constructor, copying the arc found in the previous call of the copied object.
+    ArcBoundaryLookupScheme( const ArcBoundaryLookupScheme< IndependentVariableType >& lookUpSchemeToCopy )
+        : LookUpScheme< IndependentVariableType >( lookUpSchemeToCopy ),
+          numberOfArcs_( lookUpSchemeToCopy.numberOfArcs_ ),
+          previousArcIndex_( lookUpSchemeToCopy.previousArcIndex_.load( std::memory_order_relaxed ) )
+    { }
+
+    //! Default destructor
+    ~ArcBoundaryLookupScheme( ){ }
+
+    //! Find index of arc in which the given value lies.
+    /*!
+     * Find index of arc in which the given value lies (with values outside the arc boundaries associated with the first or
+     * last arc).
+     * \param valueToLookup Value for which the current arc is to be determined.
+     * \return Index of the arc in which valueToLookup lies.
+     */
+    int findNearestLowerNeighbour( const IndependentVariableType valueToLookup )
+    {
+        // Check current and next arc, then perform binary search
+        int arcIndex = previousArcIndex_.load( std::memory_order_relaxed );
+        if( !isValueInArc( arcIndex, valueToLookup ) )
+        {
+            if( isValueInArc( arcIndex + 1, valueToLookup ) )
+            {
+                arcIndex++;
+            }
+            else
+            {
+                arcIndex = static_cast< int >(
+                            std::upper_bound( independentVariableValues_.begin( ) + 1,
+                                              independentVariableValues_.end( ) - 1, valueToLookup ) -
+                            independentVariableValues_.begin( ) ) - 1;
+            }
+            previousArcIndex_.store( arcIndex, std::memory_order_relaxed );
+        }
+        return arcIndex;
+    }
+
+    //! Find indices of arcs for a list of sorted values.
+    /*!
+     * Find indices of arcs for a list of sorted values, in a single sweep over the list and the arc boundaries (values that
+     * are not sorted are handled correctly, but at the cost of a binary search).
+     * \param valuesToLookup List of values for which the current arc is to be determined.
+     * \return Indices of the arcs in which the entries of valuesToLookup lie.
+     */
+    std::vector< int > findNearestLowerNeighbours( const std::vector< IndependentVariableType >& valuesToLookup )
+    {
+        std::vector< int > arcIndices( valuesToLookup.size( ) );
+        for( unsigned int i = 0; i < valuesToLookup.size( ); i++ )
+        {
+            arcIndices[ i ] = findNearestLowerNeighbour( valuesToLookup[ i ] );
+        }
+        return arcIndices;
+    }
+
+    //! Function to create an arc boundary look-up scheme, with separate state, sharing the data vector of this object.
+    std::shared_ptr< LookUpScheme< IndependentVariableType > > cloneCursor( ) const
+    {
+        std::shared_ptr< ArcBoundaryLookupScheme< IndependentVariableType > > lookUpScheme =
+                std::make_shared< ArcBoundaryLookupScheme< IndependentVariableType > >( *this );
+        lookUpScheme->previousArcIndex_ = 0;
+        return lookUpScheme;
+    }
+
+    //! Function to retrieve the number of arcs
+    int getNumberOfArcs( )
+    {
+        return numberOfArcs_;
+    }
+
+private:
+
+    //! Function to check whether value lies in given arc (with the first and last arc extended to infinity).
+    bool isValueInArc( const int arcIndex, const IndependentVariableType value )
+    {
+        if( arcIndex >= numberOfArcs_ )
+        {
+            return false;
+        }
+        return ( arcIndex == 0 || !( value < independentVariableValues_[ arcIndex ] ) ) &&
+                ( arcIndex == numberOfArcs_ - 1 || value < independentVariableValues_[ arcIndex + 1 ] );
+    }
+
+    //! Number of arcs defined by the boundaries.
+    int numberOfArcs_;
+
+    //! Index of arc found in previous call (atomic, so that the lookup may be performed concurrently)
+    std::atomic< int > previousArcIndex_;
 };
 
 //! Typedef for shared-pointer to LookUpScheme object with double-type entries.
@@ -241,6 +639,10 @@ HuntingAlgorithmLookupSchemeDoublePointer;
 typedef std::shared_ptr< BinarySearchLookupScheme< double > >
 BinarySearchLookupSchemeDoublePointer;
 
+//! Typedef for shared-pointer to UniformGridLookupScheme object with double-type entries.
+typedef std::shared_ptr< UniformGridLookupScheme< double > >
+UniformGridLookupSchemeDoublePointer;
+
 } // namespace interpolators
 } // namespace tudat
 
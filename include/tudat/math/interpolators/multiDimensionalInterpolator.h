@@ -316,34 +316,11 @@ protected:
      */
     void makeLookupSchemes( const AvailableLookupScheme selectedScheme )
     {
-        // Find which type of scheme is used.
+        // Create scheme per dimension (using the uniform grid look-up if the independent variables are equidistant)
         lookUpSchemes_.resize( NumberOfDimensions );
-        switch ( selectedScheme )
+        for( unsigned int i = 0; i < NumberOfDimensions; i++ )
         {
-        case binarySearch:
-        {
-            for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
-            {
-                // Create binary search look up scheme.
-                lookUpSchemes_[ i ] = std::shared_ptr< LookUpScheme< IndependentVariableType > >
-                        ( new BinarySearchLookupScheme< IndependentVariableType >(
-                              independentValues_[ i ] ) );
-            }
-            break;
-        }
-        case huntingAlgorithm:
-        {
-            for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
-            {
-                // Create hunting scheme, which uses an intial guess from previous look-ups.
-                lookUpSchemes_[ i ] = std::shared_ptr< LookUpScheme< IndependentVariableType > >
-                        ( new HuntingAlgorithmLookupScheme< IndependentVariableType >(
-                              independentValues_[ i ] ) );
-            }
-            break;
-        }
-        default:
-            throw std::runtime_error( "Error: lookup scheme not found when making scheme for N-D interpolator." );
+            lookUpSchemes_[ i ] = createLookupScheme( independentValues_[ i ], selectedScheme );
         }
     }
 
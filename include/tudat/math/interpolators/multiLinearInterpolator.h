@@ -30,6 +30,7 @@
 #ifndef TUDAT_MULTI_LINEAR_INTERPOLATOR_H
 #define TUDAT_MULTI_LINEAR_INTERPOLATOR_H
 
+#include <array>
 #include <vector>
 
 #include <boost/array.hpp>
@@ -50,7 +51,11 @@ namespace interpolators
 //! Class for performing multi-linear interpolation for arbitrary number of independent variables.
 /*!
  * Class for performing multi-linear interpolation for arbitrary number of independent variables.
- * Interpolation is calculated recursively over all dimensions of independent variables. Note
+ * The dependent data is stored contiguously in row-major order, and accessed directly using precomputed strides.
+ * Interpolation is performed by retrieving the dependent variables at the 2^N corners of the grid cell (using
+ * precomputed offsets w.r.t. the first corner), and subsequently reducing these dimension by dimension, starting with
+ * the last dimension, using linear interpolation. This requires no recursion or branching, and evaluates all entries of
+ * vector-valued dependent variables in a single pass. Note
  * that the types (i.e. double, float) of all independent variables must be the same.
  * \tparam IndependentVariableType Type for independent variables.
  * \tparam DependentVariableType Type for dependent variable.
@@ -124,8 +129,59 @@ public:
             }
         }
 
-        // Create lookup scheme from independent variable data points.
+        // Create lookup scheme from independent variable data points, and determine layout of dependent data
         this->makeLookupSchemes( selectedLookupScheme );
+        computeDataLayout( );
+    }
+
+    //! Constructor taking independent variable data, and dependent variable data that is stored externally.
+    /*!
+     *  Constructor taking independent variable data, and a pointer to dependent variable data that is stored externally
+     *  (for instance in a memory-mapped file), in row-major order (as in a boost::multi_array), which is not copied.
+     *  The shared pointer keeps the storage of the data alive for the lifetime of the interpolator (an aliasing
+     *  shared pointer may be used to point into a larger object). Since the dependent data is not copied, the
+     *  getDependentValues function returns an empty array for interpolators created with this constructor.
+     *  \param independentValues Vector of vectors containing data points of independent variables,
+     *      each must be sorted in ascending order.
+     *  \param externalDependentData Pointer to first entry of dependent data at each point of hyper-rectangular grid
+     *      formed by independent variable points.
+     *  \param selectedLookupScheme Identifier of lookupscheme from enum. This algorithm is used
+     *      to find the nearest lower data point in the independent variables when requesting
+     *      interpolation.
+     *  \param boundaryHandling Vector of boundary handling methods, in case independent variable is outside the
+     *      specified range.
+     *  \param defaultExtrapolationValue Vector of pairs of default values to be used for extrapolation, in case
+     *      of use_default_value or use_default_value_with_warning as methods for boundaryHandling.
+     */
+    MultiLinearInterpolator(
+            const std::vector< std::vector< IndependentVariableType > >& independentValues,
+            const std::shared_ptr< const DependentVariableType >& externalDependentData,
+            const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm,
+            const std::vector< BoundaryInterpolationType >& boundaryHandling =
+            std::vector< BoundaryInterpolationType >( NumberOfDimensions, extrapolate_at_boundary ),
+            const std::vector< std::pair< DependentVariableType, DependentVariableType > >& defaultExtrapolationValue =
+            std::vector< std::pair< DependentVariableType, DependentVariableType > >(
+                NumberOfDimensions, std::make_pair( IdentityElement::getAdditionIdentity< DependentVariableType >( ),
+                                                    IdentityElement::getAdditionIdentity< DependentVariableType >( ) ) ) ) :
+        MultiDimensionalInterpolator< IndependentVariableType, DependentVariableType, NumberOfDimensions >(
+            boundaryHandling, defaultExtrapolationValue ),
+        externalDependentData_( externalDependentData )
+    {
+        independentValues_ = independentValues;
+
+        if ( independentValues.size( ) != NumberOfDimensions )
+        {
+            throw std::runtime_error( "Error: dimension of independent value vector provided to constructor "
+                                      "incompatible with template parameter." );
+        }
+
+        if ( externalDependentData_ == nullptr )
+        {
+            throw std::runtime_error( "Error: no external dependent data provided to multi-linear interpolator." );
+        }
+
+        this->makeLookupSchemes( selectedLookupScheme );
+        computeDataLayout( );
     }
 
     //! Constructor taking independent and dependent variable data.
@@ -181,45 +237,69 @@ public:
         }
 
         // Create local copy of current independent variables
-        std::vector< IndependentVariableType > localIndependentValuesToInterpolate = independentValuesToInterpolate;
+        std::array< IndependentVariableType, NumberOfDimensions > localIndependentValuesToInterpolate;
+        std::copy( independentValuesToInterpolate.begin( ), independentValuesToInterpolate.end( ),
+                   localIndependentValuesToInterpolate.begin( ) );
 
         // Check that independent variables are in range
         bool useValue = false;
         DependentVariableType currentDependentVariable;
         for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
         {
-            this->checkBoundaryCase( i, useValue, localIndependentValuesToInterpolate.at( i ), currentDependentVariable );
+            this->checkBoundaryCase( i, useValue, localIndependentValuesToInterpolate[ i ], currentDependentVariable );
             if ( useValue )
             {
                 return currentDependentVariable;
             }
         }
 
-        // Determine the nearest lower neighbours.
-        std::vector< int > nearestLowerIndices;
-        nearestLowerIndices.resize( NumberOfDimensions );
+        // Determine the nearest lower neighbours, the associated fractions, and the index of the first cell corner
+        std::array< IndependentVariableType, NumberOfDimensions > upperFractions;
+        std::array< IndependentVariableType, NumberOfDimensions > lowerFractions;
+        int firstCornerIndex = 0;
         for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
         {
-            nearestLowerIndices[ i ] = lookUpSchemes_[ i ]->findNearestLowerNeighbour(
+            const std::vector< IndependentVariableType >& currentIndependentValues = independentValues_[ i ];
+            int nearestLowerIndex = lookUpSchemes_[ i ]->findNearestLowerNeighbour(
                         localIndependentValuesToInterpolate[ i ] );
+
+            upperFractions[ i ] = ( localIndependentValuesToInterpolate[ i ] - currentIndependentValues[ nearestLowerIndex ] ) /
+                    ( currentIndependentValues[ nearestLowerIndex + 1 ] - currentIndependentValues[ nearestLowerIndex ] );
+            lowerFractions[ i ] = -( localIndependentValuesToInterpolate[ i ] - currentIndependentValues[ nearestLowerIndex + 1 ] ) /
+                    ( currentIndependentValues[ nearestLowerIndex + 1 ] - currentIndependentValues[ nearestLowerIndex ] );
+            firstCornerIndex += nearestLowerIndex * dataStrides_[ i ];
         }
 
-        // Initialize function evaluation indices to -1 for debugging purposes.
-        boost::array< unsigned int, NumberOfDimensions > interpolationIndices;
-        for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
+        // Interpolate in last dimension, directly from the dependent data at the cell corners
+        const DependentVariableType* cornerData =
+                ( externalDependentData_ != nullptr ? externalDependentData_.get( ) : dependentData_.data( ) ) +
+                firstCornerIndex;
+        const IndependentVariableType upperFraction = upperFractions[ NumberOfDimensions - 1 ];
+        const IndependentVariableType lowerFraction = lowerFractions[ NumberOfDimensions - 1 ];
+        std::array< DependentVariableType, NumberOfCorners / 2 > cellValues;
+        for ( unsigned int i = 0; i < NumberOfCorners / 2; i++ )
         {
-            interpolationIndices[ i ] = -1;
+            cellValues[ i ] = upperFraction * cornerData[ cornerOffsets_[ 2 * i + 1 ] ] +
+                    lowerFraction * cornerData[ cornerOffsets_[ 2 * i ] ];
         }
 
-        // Call first step of interpolation, this function calls itself at subsequent independent
-        // variable dimensions to evaluate and properly scale dependent variable table values at
-        // all 2^n grid edges.
-        return performRecursiveInterpolationStep( 0, localIndependentValuesToInterpolate,
-                                                  interpolationIndices, nearestLowerIndices );
+        // Successively interpolate in the remaining dimensions (halving the number of values in each step)
+        for ( int i = static_cast< int >( NumberOfDimensions ) - 2; i >= 0; i-- )
+        {
+            for ( unsigned int j = 0; j < ( 1u << i ); j++ )
+            {
+                cellValues[ j ] = upperFractions[ i ] * cellValues[ 2 * j + 1 ] + lowerFractions[ i ] * cellValues[ 2 * j ];
+            }
+        }
+
+        return cellValues[ 0 ];
     }
 
 private:
 
+    //! Number of corners of a grid cell
+    static const unsigned int NumberOfCorners = 1u << NumberOfDimensions;
+
     //! Make the lookup scheme that is to be used.
     /*!
      * This function creates the look up scheme that is to be used in determining the interval of
@@ -230,114 +310,49 @@ private:
      */
     void makeLookupSchemes( const AvailableLookupScheme selectedScheme )
     {
+        // Create scheme per dimension (using the uniform grid look-up if the independent variables are equidistant)
         lookUpSchemes_.resize( NumberOfDimensions );
-        // Find which type of scheme is used.
-        switch( selectedScheme )
+        for( unsigned int i = 0; i < NumberOfDimensions; i++ )
         {
-        case binarySearch:
-
-            for( unsigned int i = 0; i < NumberOfDimensions; i++ )
-            {
-                // Create binary search look up scheme.
-                lookUpSchemes_[ i ] = std::shared_ptr< LookUpScheme< IndependentVariableType > >
-                        ( new BinarySearchLookupScheme< IndependentVariableType >(
-                              independentValues_[ i ] ) );
-            }
-
-            break;
-
-        case huntingAlgorithm:
-
-            for( unsigned int i = 0; i < NumberOfDimensions; i++ )
-            {
-                // Create hunting scheme, which uses an intial guess from previous look-ups.
-                lookUpSchemes_[ i ] = std::shared_ptr< LookUpScheme< IndependentVariableType > >
-                        ( new HuntingAlgorithmLookupScheme< IndependentVariableType >(
-                              independentValues_[ i ] ) );
-            }
-
-            break;
-
-        default:
-
-            throw std::runtime_error( "Warning: lookup scheme not found when making scheme for 1-D interpolator" );
+            lookUpSchemes_[ i ] = createLookupScheme( independentValues_[ i ], selectedScheme );
         }
     }
 
-    //! Perform the step in a single dimension of the interpolation process.
-    /*!
-     * Function calculates single dimension of the interpolation process. Function calls itself if
-     * final dimension not yet reached. Calling this function with currentDimension = 0 will result
-     * in 2^{NumberOfDimensions} number of calls to the function at currentDimension =
-     * NumberOfDimensions -1. As such, the complete series of calls, starting at currentDimension =
-     * 0, retrieves the dependent variable values at all edges of the grid hyper-rectangle and
-     * properly scales them.
-     * \param currentDimension Dimension in which this interpolation step is to be performed.
-     * \param independentValuesToInterpolate Vector of values of independent variables at which
-     *          interpolation is to be performed.
-     * \param currentArrayIndices Array of indices modified at index = currentDimension at each
-     *          call of function. Variable is passed to dependentData in highest step to return
-     *          data for interpolation.
-     * \param nearestLowerIndices Indices in subvectors of independentValues_ vector. That is, the
-     *  n-th entry of nearestLowerIndices represent the nearest lower neighbour in the n-th
-     *  interpolation dimension of the independent variable vectors.
-     * \return Interpolated value in a single dimension
-     */
-    DependentVariableType performRecursiveInterpolationStep(
-            const unsigned int currentDimension,
-            const std::vector< IndependentVariableType >& independentValuesToInterpolate,
-            boost::array< unsigned int, NumberOfDimensions > currentArrayIndices,
-            const std::vector< int >& nearestLowerIndices )
+    //! Compute strides of (row-major) dependent data, and offsets of the cell corners w.r.t. the first corner
+    void computeDataLayout( )
     {
-        IndependentVariableType upperFraction, lowerFraction;
-        DependentVariableType upperContribution, lowerContribution;
-
-        // Calculate fractions of data points above and below independent
-        // variable value to be added to interpolated value.
-        upperFraction = ( independentValuesToInterpolate[ currentDimension ] -
-                          independentValues_[ currentDimension ]
-                          [ nearestLowerIndices[ currentDimension ] ] ) /
-                ( independentValues_[ currentDimension ]
-                  [ nearestLowerIndices[ currentDimension ] + 1 ] -
-                independentValues_[ currentDimension ]
-                [ nearestLowerIndices[ currentDimension ] ] );
-        lowerFraction = -( independentValuesToInterpolate[ currentDimension ] -
-                           independentValues_[ currentDimension ]
-                           [ nearestLowerIndices[ currentDimension ] + 1 ] ) /
-                ( independentValues_[ currentDimension ]
-                  [ nearestLowerIndices[ currentDimension ] + 1 ] -
-                independentValues_[ currentDimension ]
-                [ nearestLowerIndices[ currentDimension ] ] );
-
-        // If at top dimension, call dependent variable data.
-        if ( currentDimension == NumberOfDimensions - 1 )
+        int currentStride = 1;
+        for ( int i = static_cast< int >( NumberOfDimensions ) - 1; i >= 0; i-- )
         {
-            currentArrayIndices[ NumberOfDimensions - 1 ] = nearestLowerIndices[ currentDimension ];
-            lowerContribution = dependentData_( currentArrayIndices );
-            currentArrayIndices[ NumberOfDimensions - 1 ] = nearestLowerIndices[ currentDimension ]
-                    + 1;
-            upperContribution = dependentData_( currentArrayIndices );
+            dataStrides_[ i ] = currentStride;
+            currentStride *= static_cast< int >( independentValues_[ i ].size( ) );
         }
-
-        // If at lower dimension, update currentArrayIndices and call function with
-        // currentDimension++.
-        else
+        for ( unsigned int i = 0; i < NumberOfCorners; i++ )
         {
-            currentArrayIndices[ currentDimension ] = nearestLowerIndices[ currentDimension ];
-            lowerContribution = performRecursiveInterpolationStep(
-                        currentDimension + 1, independentValuesToInterpolate,
-                        currentArrayIndices, nearestLowerIndices );
-            currentArrayIndices[ currentDimension ] = nearestLowerIndices[ currentDimension ] + 1;
-            upperContribution = performRecursiveInterpolationStep(
-                        currentDimension + 1, independentValuesToInterpolate,
-                        currentArrayIndices, nearestLowerIndices );
+            cornerOffsets_[ i ] = 0;
+            for ( unsigned int j = 0; j < NumberOfDimensions; j++ )
+            {
+                if( ( i >> ( NumberOfDimensions - 1 - j ) ) & 1u )
+                {
+                    cornerOffsets_[ i ] += dataStrides_[ j ];
+                }
+            }
         }
-
-        // Return interpolated value.
-        DependentVariableType returnValue = upperFraction * upperContribution +
-                lowerFraction * lowerContribution;
-        return returnValue;
     }
+
+    //! Dependent data stored outside of the interpolator (nullptr if dependentData_ is used).
+    std::shared_ptr< const DependentVariableType > externalDependentData_;
+
+    //! Strides (in number of entries) of each dimension in the (row-major, contiguous) dependent data.
+    std::array< int, NumberOfDimensions > dataStrides_;
+
+    //! Offsets of the entries of the grid cell corners in the dependent data, w.r.t. the first corner.
+    /*!
+     * Offsets of the entries of the grid cell corners in the dependent data, w.r.t. the first corner. Bit
+     * ( NumberOfDimensions - 1 - j ) of the corner index denotes whether the upper or lower value is used in dimension j,
+     * so that the corners are ordered as in the (row-major) dependent data.
+     */
+    std::array< int, NumberOfCorners > cornerOffsets_;
 };
 
 extern template class MultiLinearInterpolator< double, Eigen::Vector6d, 1 >;
@@ -23,6 +23,7 @@
 #include "tudat/math/interpolators/interpolator.h"
 
 #include "tudat/basics/identityElements.h"
+#include "tudat/basics/memoryFootprint.h"
 
 namespace tudat
 {
@@ -125,6 +126,41 @@ public:
     virtual DependentVariableType
     interpolate( const IndependentVariableType independentVariableValue ) = 0;
 
+    //! Function to perform interpolation, using given look-up scheme.
+    /*!
+     *  This function performs the interpolation, using the given look-up scheme (cursor) to find the interval in which
+     *  the independent variable lies, instead of the look-up scheme of this object. Implementations do not modify the
+     *  interpolator, so that this function may be called concurrently from several threads, provided that each uses a
+     *  separate look-up scheme (e.g. created from getLookUpScheme( )->cloneCursor( ) ).
+     *  \param independentVariableValue Independent variable value at which the value of the
+     *      dependent variable is to be determined.
+     *  \param lookUpScheme Look-up scheme, created from the independent variables of this interpolator.
+     *  \return Interpolated value of dependent variable.
+     */
+    virtual DependentVariableType
+    interpolate( const IndependentVariableType independentVariableValue,
+                 LookUpScheme< IndependentVariableType >& lookUpScheme ) = 0;
+
+    //! Function to perform interpolation at a set of independent variable values.
+    /*!
+     *  Function to perform interpolation at a set of independent variable values, storing the results in the given
+     *  vector (which is resized as needed, so that it may be reused for subsequent calls without reallocation). This
+     *  default implementation calls the single-value interpolate function for each value. Derived classes may override
+     *  it to evaluate the values more efficiently (e.g. by walking through sorted values without repeated lookup).
+     *  \param independentVariableValues Independent variable values at which the value of the
+     *      dependent variable is to be determined.
+     *  \param dependentVariableValues Interpolated values of dependent variable (returned by reference).
+     */
+    virtual void interpolate( const std::vector< IndependentVariableType >& independentVariableValues,
+                              std::vector< DependentVariableType >& dependentVariableValues )
+    {
+        dependentVariableValues.resize( independentVariableValues.size( ) );
+        for( unsigned int i = 0; i < independentVariableValues.size( ); i++ )
+        {
+            dependentVariableValues[ i ] = interpolate( independentVariableValues[ i ] );
+        }
+    }
+
     //! Function to perform interpolation, with non-const input argument.
     /*!
      *  This function performs the interpolation, with non-const input argument. Function calls the interpolate function and is
@@ -165,7 +201,7 @@ public:
      *  Function to return the ector with independent variables used by the interpolator.
      *  \return Independent variables used by the interpolator.
      */
-    std::vector< IndependentVariableType > getIndependentValues( )
+    virtual std::vector< IndependentVariableType > getIndependentValues( )
     {
         return independentValues_;
     }
@@ -175,11 +211,22 @@ public:
      *  Function to return the ector with dependent variables used by the interpolator.
      *  \return Dependent variables used by the interpolator.
      */
-    std::vector< DependentVariableType > getDependentValues( )
+    virtual std::vector< DependentVariableType > getDependentValues( )
     {
         return dependentValues_;
     }
 
+    //! Function to retrieve the heap memory held by the interpolator, in bytes
+    /*!
+     *  Function to retrieve the heap memory held by the interpolator, in bytes. By default, the memory of the independent and
+     *  dependent values is included; derived classes add the memory of their pre-computed interpolation data.
+     *  \return Heap memory held by the interpolator
+     */
+    virtual std::size_t getHeapMemorySize( ) const
+    {
+        return utilities::getHeapMemorySize( independentValues_ ) + utilities::getHeapMemorySize( dependentValues_ );
+    }
+
     BoundaryInterpolationType getBoundaryHandling( )
     {
         return boundaryHandling_;
@@ -333,40 +380,41 @@ protected:
         }
     }
 
+    //! Function to find the nearest lower neighbour of a value, searching upwards from a given entry.
+    /*!
+     *  Function to find the nearest lower neighbour of a value in independentValues_, searching upwards from a given
+     *  entry (e.g. the nearest lower neighbour of the previous value, when interpolating at sorted values). The result
+     *  is identical to that of the look-up schemes, provided that the given entry is not above the nearest lower
+     *  neighbour. The search is linear, so that a walk through m sorted values takes O(n + m) comparisons.
+     *  \param targetIndependentVariable Value of which nearest lower neighbour is to be determined.
+     *  \param lowerEntry Entry from which the search is started.
+     *  \return Index of nearest lower neighbour (at most the index of the second-to-last entry).
+     */
+    int findNearestLowerNeighbourFromEntry( const IndependentVariableType& targetIndependentVariable, int lowerEntry )
+    {
+        const int maximumLowerEntry = static_cast< int >( independentValues_.size( ) ) - 2;
+        while( lowerEntry < maximumLowerEntry && !( targetIndependentVariable < independentValues_[ lowerEntry + 1 ] ) )
+        {
+            lowerEntry++;
+        }
+        return lowerEntry;
+    }
+
     //! Make look-up scheme that is to be used.
     /*!
      * This function creates the look-up scheme that is to be used in determining the interval of
      * the independent variable grid where the interpolation is to be performed. It takes the type
      * of lookup scheme as an enum and constructs the look-up scheme from the independentValues_
-     * that have been set previously.
+     * that have been set previously. If the hunting algorithm or binary search is selected, and the independentValues_
+     * are equidistant, the (equivalent) uniform grid look-up scheme is used.
      * \param selectedScheme Type of look-up scheme that is to be used
      */
     void makeLookupScheme( const AvailableLookupScheme selectedScheme )
     {
         selectedLookupScheme_ = selectedScheme;
 
-        // Find which type of scheme is used.
-        switch ( selectedLookupScheme_ )
-        {
-        case binarySearch:
-        {
-            // Create binary search look up scheme.
-            lookUpScheme_ = std::shared_ptr< LookUpScheme< IndependentVariableType > >
-                    ( new BinarySearchLookupScheme< IndependentVariableType >
-                      ( independentValues_ ) );
-            break;
-        }
-        case huntingAlgorithm:
-        {
-            // Create hunting scheme, which uses an intial guess from previous look-ups.
-            lookUpScheme_ = std::shared_ptr< LookUpScheme< IndependentVariableType > >
-                    ( new HuntingAlgorithmLookupScheme< IndependentVariableType >
-                      ( independentValues_ ) );
-            break;
-        }
-        default:
-            throw std::runtime_error( "Warning: lookup scheme not found when making scheme for 1-D interpolator" );
-        }
+        // Create scheme (using the uniform grid look-up if the independent variables are equidistant)
+        lookUpScheme_ = createLookupScheme( independentValues_, selectedLookupScheme_ );
     }
 
     //! Pointer to look up scheme.
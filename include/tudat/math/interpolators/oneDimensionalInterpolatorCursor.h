@@ -0,0 +1,143 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_ONE_DIMENSIONAL_INTERPOLATOR_CURSOR_H
+#define TUDAT_ONE_DIMENSIONAL_INTERPOLATOR_CURSOR_H
+
+#include <memory>
+#include <stdexcept>
+
+#include "tudat/math/interpolators/oneDimensionalInterpolator.h"
+
+namespace tudat
+{
+
+namespace interpolators
+{
+
+//! Interpolator that shares the data of an existing interpolator, with its own look-up scheme.
+/*!
+ *  Interpolator that shares the data of an existing one-dimensional interpolator (independent/dependent values, spline
+ *  coefficients, etc.), but which has its own look-up scheme (cursor), containing the state of the search for the
+ *  interval in which the independent variable lies. Creating an object of this type is cheap, as none of the data of the
+ *  interpolator is copied. Interpolators of this type can be used (for instance, one per thread) to perform
+ *  interpolations concurrently, since the shared interpolator is not modified during the interpolation. Any modification
+ *  of the shared interpolator (e.g. resetting its dependent values) applies to all of its cursors. If the independent
+ *  variables of the shared interpolator are reset (see LagrangeInterpolator::resetData), the look-up scheme of the
+ *  cursor is recreated upon the next interpolation.
+ *  \tparam IndependentVariableType Type of independent variable
+ *  \tparam DependentVariableType Type of dependent variable
+ */
+template< typename IndependentVariableType, typename DependentVariableType >
+class OneDimensionalInterpolatorCursor : public OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >
+{
+public:
+
+    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::interpolate;
+
+    //! Constructor.
+    /*!
+     *  Constructor, creates a new look-up scheme of the same type as the given interpolator, sharing its data.
+     *  \param interpolator Interpolator of which the data is to be used (if this is itself a cursor, the interpolator
+     *      of that cursor is used).
+     */
+    OneDimensionalInterpolatorCursor(
+            const std::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
+            interpolator ):
+        OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >(
+            interpolator->getBoundaryHandling( ), interpolator->getDefaultExtrapolationValue( ) ),
+        interpolator_( interpolator )
+    {
+        // Share data with original interpolator, if a cursor is provided
+        std::shared_ptr< OneDimensionalInterpolatorCursor< IndependentVariableType, DependentVariableType > >
+                interpolatorCursor = std::dynamic_pointer_cast<
+                OneDimensionalInterpolatorCursor< IndependentVariableType, DependentVariableType > >( interpolator );
+        if( interpolatorCursor != nullptr )
+        {
+            interpolator_ = interpolatorCursor->getInterpolator( );
+        }
+
+        if( interpolator_->getLookUpScheme( ) == nullptr )
+        {
+            throw std::runtime_error( "Error when creating interpolator cursor, interpolator has no look-up scheme" );
+        }
+
+        this->lookUpScheme_ = interpolator_->getLookUpScheme( )->cloneCursor( );
+        this->selectedLookupScheme_ = interpolator_->getSelectedLookupScheme( );
+    }
+
+    //! Destructor.
+    ~OneDimensionalInterpolatorCursor( ){ }
+
+    //! Function interpolates dependent variable value at given independent variable value.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value, using the shared
+     *  interpolator, and the look-up scheme of this object.
+     *  \param independentVariableValue Value of independent variable at which interpolation is to take place.
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolate( const IndependentVariableType independentVariableValue )
+    {
+        // Recreate look-up scheme if the independent variables of the shared interpolator have been reset
+        if( this->lookUpScheme_->getIndependentVariableValues( ) !=
+                interpolator_->getLookUpScheme( )->getIndependentVariableValues( ) )
+        {
+            this->lookUpScheme_ = interpolator_->getLookUpScheme( )->cloneCursor( );
+        }
+        return interpolator_->interpolate( independentVariableValue, *this->lookUpScheme_ );
+    }
+
+    //! Function interpolates dependent variable value at given independent variable value, using given look-up scheme.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value, using the shared
+     *  interpolator, and the given look-up scheme.
+     *  \param independentVariableValue Value of independent variable at which interpolation is to take place.
+     *  \param lookUpScheme Look-up scheme, created from the independent variables of the shared interpolator.
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolate( const IndependentVariableType independentVariableValue,
+                                       LookUpScheme< IndependentVariableType >& lookUpScheme )
+    {
+        return interpolator_->interpolate( independentVariableValue, lookUpScheme );
+    }
+
+    //! Function to return the vector with independent variables used by the shared interpolator.
+    std::vector< IndependentVariableType > getIndependentValues( )
+    {
+        return interpolator_->getIndependentValues( );
+    }
+
+    //! Function to return the vector with dependent variables used by the shared interpolator.
+    std::vector< DependentVariableType > getDependentValues( )
+    {
+        return interpolator_->getDependentValues( );
+    }
+
+    InterpolatorTypes getInterpolatorType( ){ return interpolator_->getInterpolatorType( ); }
+
+    //! Function to retrieve the interpolator of which the data is shared.
+    std::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > > getInterpolator( )
+    {
+        return interpolator_;
+    }
+
+private:
+
+    //! Interpolator of which the data is shared (and which is used to perform the interpolation).
+    std::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > > interpolator_;
+
+};
+
+} // namespace interpolators
+
+} // namespace tudat
+
+#endif // TUDAT_ONE_DIMENSIONAL_INTERPOLATOR_CURSOR_H
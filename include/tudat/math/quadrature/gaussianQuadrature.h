@@ -65,25 +65,40 @@ void readGaussianQuadratureWeights(
 }
 
 //! Container object for Gauss quadrature nodes and weights (templated by data variable type, e.g. float, double, long double)
+/*!
+ *  Container object for Gauss quadrature nodes and weights. All nodes and weights are read from file, and expanded to the
+ *  full set of nodes/weights for each order, upon construction. The object is not modified afterwards, so that it may be
+ *  shared by any number of quadrature objects, and read concurrently from multiple threads. A single, lazily created,
+ *  object per data variable type is provided by getGaussQuadratureNodesAndWeights.
+ */
 template< typename IndependentVariableType >
 struct GaussQuadratureNodesAndWeights
 {
     //! Typedef for vector of IndependentVariableType scalar type
     typedef Eigen::Array< IndependentVariableType, Eigen::Dynamic, 1 > IndependentVariableArray;
 
-    //! COnstructor, reads nodes and weights from file
+    //! Constructor, reads nodes and weights from file, and computes full set of nodes and weights for each order
     GaussQuadratureNodesAndWeights( )
     {
         readGaussianQuadratureNodes< IndependentVariableType >( uniqueNodes_ );
         readGaussianQuadratureWeights< IndependentVariableType >( uniqueWeights_ );
+
+        for( auto nodeIterator: uniqueNodes_ )
+        {
+            if( uniqueWeights_.count( nodeIterator.first ) > 0 )
+            {
+                nodes_[ nodeIterator.first ] = computeNodes( nodeIterator.first );
+                weights_[ nodeIterator.first ] = computeWeights( nodeIterator.first );
+            }
+        }
     }
 
     //! Get the unique nodes for a specified order `n`.
     /*!
      * \param numberOfNodes The number of nodes or weight factors.
-     * \return `uniqueNodes_[n]`, after reading the text file with the tabulated nodes if necessary.
+     * \return `uniqueNodes_[n]`, as read from the text file with the tabulated nodes.
      */
-    IndependentVariableArray getUniqueNodes( const unsigned int numberOfNodes )
+    const IndependentVariableArray& getUniqueNodes( const unsigned int numberOfNodes ) const
     {
         if ( uniqueNodes_.count( numberOfNodes ) == 0 )
         {
@@ -98,9 +113,9 @@ struct GaussQuadratureNodesAndWeights
     /*!
      * Get the unique weight factors for a specified order.
      * \param order The number of nodes or weight factors.
-     * \return `uniqueWeights_ at entry order`, after reading the text file with the tabulated nodes if necessary.
+     * \return `uniqueWeights_ at entry order`, as read from the text file with the tabulated weights.
      */
-    IndependentVariableArray getUniqueWeights( const unsigned int order )
+    const IndependentVariableArray& getUniqueWeights( const unsigned int order ) const
     {
         if ( uniqueWeights_.count( order ) == 0 )
         {
@@ -111,126 +126,132 @@ struct GaussQuadratureNodesAndWeights
         return uniqueWeights_.at( order );
     }
 
-    //! Get all the nodes at given order from uniqueNodes_
+    //! Get all the nodes at given order
     /*!
-    * Get all the nodes at given order from uniqueNodes_
+    * Get all the nodes at given order
     * \param order The number of nodes or weight factors.
-    * \return `uniqueWeights_ at entry order`, after reading the text file with the tabulated nodes if necessary.
+    * \return `nodes_ at entry order`
     */
-    IndependentVariableArray getNodes( const unsigned int order )
+    const IndependentVariableArray& getNodes( const unsigned int order ) const
     {
         if ( nodes_.count( order ) == 0 )
         {
-            IndependentVariableArray newNodes( order );
-
-            // Include node 0.0 if order is odd
-            unsigned int i = 0;
-            if ( order % 2 == 1 )
-            {
-                newNodes.row( i++ ) = 0.0;
-            }
-
-            // Include ± nodes
-            IndependentVariableArray uniqueNodes_ = getUniqueNodes( order );
-            for ( int j = 0; j < uniqueNodes_.size( ); j++ )
-            {
-                newNodes.row( i++ ) = -uniqueNodes_[ j ];
-                newNodes.row( i++ ) =  uniqueNodes_[ j ];
-            }
-
-            nodes_[ order ] = newNodes;
+            std::string errorMessage = "Error in Gaussian quadrature, nodes not available for n=" +
+                    std::to_string( order );
+            throw std::runtime_error( errorMessage );
         }
-
         return nodes_.at( order );
     }
 
-    //! Get all the weight factors (i.e. n weight factors for nth order) from uniqueWeights_
-    IndependentVariableArray getWeights( const unsigned int n )
+    //! Get all the weight factors (i.e. n weight factors for nth order)
+    const IndependentVariableArray& getWeights( const unsigned int n ) const
     {
         if ( weights_.count( n ) == 0 )
         {
-            IndependentVariableArray newWeights( n );
-            IndependentVariableArray orderNWeights = getUniqueWeights( n );
-
-            // Include non-repeated weight factor if n is odd
-            unsigned int i = 0;
-            int j = 0;
-            if ( n % 2 == 1 )
-            {
-                newWeights.row( i++ ) = orderNWeights[ j++ ];
-            }
-
-            // Include repeated weight factors
-            for ( ; j < orderNWeights.size( ); j++ )
-            {
-                newWeights.row( i++ ) = orderNWeights[ j ];
-                newWeights.row( i++ ) = orderNWeights[ j ];
-            }
-
-            weights_[ n ] = newWeights;
+            std::string errorMessage = "Error in Gaussian quadrature, weights not available for n=" +
+                    std::to_string( n );
+            throw std::runtime_error( errorMessage );
         }
-
         return weights_.at( n );
     }
 
     //! Map containing the nodes read from the text file (currently up to `n = 64`).
     //! The following relation holds: `size( uniqueNodes_[n] ) = floor( n / 2 )`
     //! For the actual nodes, the following must hold: `size( nodes[n] ) = n`
-    //! The actual nodes are generated from `uniqueNodes_` by `getNodes()`
+    //! The actual nodes are generated from `uniqueNodes_` by `computeNodes()`
     std::map< unsigned int, IndependentVariableArray > uniqueNodes_;
     std::map< unsigned int, IndependentVariableArray > nodes_;
 
     //! Map containing the weight factors read from the text file (currently up to `n = 64`).
     //! The following relation holds: `size( uniqueWeights_[n] ) = ceil( n / 2 )`
     //! For the actual weight factors, the following must hold: `size( uniqueWeights_[n] ) = n`
-    //! The actual weight factors are generated from `uniqueWeights_` by `getWeights()`
+    //! The actual weight factors are generated from `uniqueWeights_` by `computeWeights()`
     std::map< unsigned int, IndependentVariableArray > uniqueWeights_;
     std::map< unsigned int, IndependentVariableArray > weights_;
 
-};
+private:
+
+    //! Compute all the nodes at given order from uniqueNodes_
+    IndependentVariableArray computeNodes( const unsigned int order ) const
+    {
+        IndependentVariableArray newNodes( order );
+
+        // Include node 0.0 if order is odd
+        unsigned int i = 0;
+        if ( order % 2 == 1 )
+        {
+            newNodes.row( i++ ) = 0.0;
+        }
+
+        // Include ± nodes
+        const IndependentVariableArray& uniqueNodes = getUniqueNodes( order );
+        for ( int j = 0; j < uniqueNodes.size( ); j++ )
+        {
+            newNodes.row( i++ ) = -uniqueNodes[ j ];
+            newNodes.row( i++ ) =  uniqueNodes[ j ];
+        }
 
-//! Object containing nodes/weights for long double Gauss quadrature
-static const std::shared_ptr< GaussQuadratureNodesAndWeights< long double > > longDoubleGaussQuadratureNodesAndWeights =
-        std::make_shared< GaussQuadratureNodesAndWeights< long double > >( );
+        return newNodes;
+    }
 
-//! Object containing nodes/weights for double Gauss quadrature
-static const std::shared_ptr< GaussQuadratureNodesAndWeights< double > > doubleGaussQuadratureNodesAndWeights =
-        std::make_shared< GaussQuadratureNodesAndWeights< double > >( );
+    //! Compute all the weight factors (i.e. n weight factors for nth order) from uniqueWeights_
+    IndependentVariableArray computeWeights( const unsigned int n ) const
+    {
+        IndependentVariableArray newWeights( n );
+        const IndependentVariableArray& orderNWeights = getUniqueWeights( n );
 
-//! Object containing nodes/weights for float Gauss quadrature
-static const std::shared_ptr< GaussQuadratureNodesAndWeights< float > > floatGaussQuadratureNodesAndWeights =
-        std::make_shared< GaussQuadratureNodesAndWeights< float > >( );
+        // Include non-repeated weight factor if n is odd
+        unsigned int i = 0;
+        int j = 0;
+        if ( n % 2 == 1 )
+        {
+            newWeights.row( i++ ) = orderNWeights[ j++ ];
+        }
+
+        // Include repeated weight factors
+        for ( ; j < orderNWeights.size( ); j++ )
+        {
+            newWeights.row( i++ ) = orderNWeights[ j ];
+            newWeights.row( i++ ) = orderNWeights[ j ];
+        }
 
-//! Function to create Gauss quadrature node/weight container
+        return newWeights;
+    }
+
+};
+
+//! Function to retrieve Gauss quadrature node/weight container
 /*!
- *  Function to create Gauss quadrature node/weight container, templated by independent variable type
+ *  Function to retrieve Gauss quadrature node/weight container, templated by independent variable type. For each type,
+ *  a single container is created (in a thread-safe manner) upon the first call, and shared by all subsequent calls, so
+ *  that the nodes and weights are read from file only once per process.
  *  \return Gauss quadrature node/weight container
  */
 template< typename IndependentVariableType >
 std::shared_ptr< GaussQuadratureNodesAndWeights< IndependentVariableType > >
 getGaussQuadratureNodesAndWeights( );
 
-//! Function to create Gauss quadrature node/weight container with long double precision.
+//! Function to retrieve Gauss quadrature node/weight container with long double precision.
 /*!
- *  Function to create Gauss quadrature node/weight container with long double precision.
+ *  Function to retrieve Gauss quadrature node/weight container with long double precision.
  *  \return Gauss quadrature node/weight container
  */
 template< >
 std::shared_ptr< GaussQuadratureNodesAndWeights< long double > >
 getGaussQuadratureNodesAndWeights( );
 
-//! Function to create Gauss quadrature node/weight container with double precision.
+//! Function to retrieve Gauss quadrature node/weight container with double precision.
 /*!
- *  Function to create Gauss quadrature node/weight container with double precision.
+ *  Function to retrieve Gauss quadrature node/weight container with double precision.
  *  \return Gauss quadrature node/weight container
  */
 template< >
 std::shared_ptr< GaussQuadratureNodesAndWeights< double > >
 getGaussQuadratureNodesAndWeights( );
 
-//! Function to create Gauss quadrature node/weight container with float precision.
+//! Function to retrieve Gauss quadrature node/weight container with float precision.
 /*!
- *  Function to create Gauss quadrature node/weight container with float precision.
+ *  Function to retrieve Gauss quadrature node/weight container with float precision.
  *  \return Gauss quadrature node/weight container
  */
 template< >
@@ -251,6 +272,9 @@ public:
     typedef Eigen::Array< DependentVariableType, Eigen::Dynamic, 1 > DependentVariableArray;
     typedef Eigen::Array< IndependentVariableType, Eigen::Dynamic, 1 > IndependentVariableArray;
 
+    //! Typedef for function evaluating the integrand at all nodes at once (output returned by reference)
+    typedef std::function< void( const IndependentVariableArray&, DependentVariableArray& ) > BatchIntegrandFunction;
+
     //! Constructor.
     /*!
      * Constructor
@@ -269,6 +293,26 @@ public:
         gaussQuadratureNodesAndWeights_ = getGaussQuadratureNodesAndWeights< IndependentVariableType >( );
     }
 
+    //! Constructor, with integrand that is evaluated at all nodes at once.
+    /*!
+     * Constructor, with integrand that is evaluated at all nodes at once (e.g. to vectorize the evaluation, or to reuse
+     * intermediate quantities that are shared between nodes).
+     * \param batchIntegrand Function to be integrated numerically, with the values of the independent variable at all
+     * nodes as input, and the integrand at each of these values as output (returned by reference).
+     * \param lowerLimit Lower limit for the integral.
+     * \param upperLimit Upper limit for the integral.
+     * \param numberOfNodes Number of nodes (i.e. nodes) at which the integrand will be evaluated.
+     * Must be an integer value between 2 and 64.
+     */
+    GaussianQuadrature( const BatchIntegrandFunction batchIntegrand,
+                        const IndependentVariableType lowerLimit, const IndependentVariableType upperLimit,
+                        const unsigned int numberOfNodes ):
+        batchIntegrand_ ( batchIntegrand ), lowerLimit_( lowerLimit ), upperLimit_ ( upperLimit ),
+        numberOfNodes_( numberOfNodes ), quadratureHasBeenPerformed_( false )
+    {
+        gaussQuadratureNodesAndWeights_ = getGaussQuadratureNodesAndWeights< IndependentVariableType >( );
+    }
+
     //! Reset the current Gaussian quadrature.
     /*!
      * The nodes and weights are not read/computed again if they had already been used previously.
@@ -283,6 +327,29 @@ public:
                 const unsigned int numberOfNodes )
     {
         integrand_ = integrand;
+        batchIntegrand_ = nullptr;
+        lowerLimit_ = lowerLimit;
+        upperLimit_ = upperLimit;
+        numberOfNodes_ = numberOfNodes;
+        quadratureHasBeenPerformed_ = false;
+    }
+
+    //! Reset the current Gaussian quadrature, with integrand that is evaluated at all nodes at once.
+    /*!
+     * Reset the current Gaussian quadrature, with integrand that is evaluated at all nodes at once.
+     * \param batchIntegrand Function to be integrated numerically, with the values of the independent variable at all
+     * nodes as input, and the integrand at each of these values as output (returned by reference).
+     * \param lowerLimit Lower limit for the integral.
+     * \param upperLimit Upper limit for the integral.
+     * \param numberOfNodes Number of nodes (i.e. nodes) at which the integrand will be evaluated.
+     * Must be an integer value between 2 and 64.
+     */
+    void reset( const BatchIntegrandFunction batchIntegrand,
+                const IndependentVariableType lowerLimit, const IndependentVariableType upperLimit,
+                const unsigned int numberOfNodes )
+    {
+        integrand_ = nullptr;
+        batchIntegrand_ = batchIntegrand;
         lowerLimit_ = lowerLimit;
         upperLimit_ = upperLimit;
         numberOfNodes_ = numberOfNodes;
@@ -298,7 +365,7 @@ public:
     {
         if ( ! quadratureHasBeenPerformed_ )
         {
-            if ( integrand_ == nullptr )
+            if ( integrand_ == nullptr && batchIntegrand_ == nullptr )
             {
                 throw std::runtime_error(
                             "The integrand for the Gaussian quadrature has not been set." );
@@ -334,20 +401,36 @@ protected:
     void performQuadrature( )
     {
         // Determine the values of the auxiliary independent variable (nodes)
-        const IndependentVariableArray nodes = gaussQuadratureNodesAndWeights_->getNodes( numberOfNodes_ );
+        const IndependentVariableArray& nodes = gaussQuadratureNodesAndWeights_->getNodes( numberOfNodes_ );
 
         // Determine the values of the weight factors
-        const IndependentVariableArray weights = gaussQuadratureNodesAndWeights_->getWeights( numberOfNodes_ );
+        const IndependentVariableArray& weights = gaussQuadratureNodesAndWeights_->getWeights( numberOfNodes_ );
 
         // Change of variable -> from range [-1, 1] to range [lowerLimit, upperLimit]
-        const IndependentVariableArray independentVariables =
-                0.5 * ( ( upperLimit_ - lowerLimit_ ) * nodes + upperLimit_ + lowerLimit_ );
+        independentVariables_ = 0.5 * ( ( upperLimit_ - lowerLimit_ ) * nodes + upperLimit_ + lowerLimit_ );
 
         // Determine the value of the dependent variable
         DependentVariableArray weighedIntegrands( numberOfNodes_ );
-        for ( unsigned int i = 0; i < numberOfNodes_; i++ )
+        if( batchIntegrand_ != nullptr )
         {
-            weighedIntegrands( i ) = weights( i ) * integrand_( independentVariables( i ) );
+            batchIntegrand_( independentVariables_, integrands_ );
+            if( integrands_.rows( ) != static_cast< int >( numberOfNodes_ ) )
+            {
+                throw std::runtime_error( "Error in Gaussian quadrature, batch integrand returned " +
+                                          std::to_string( integrands_.rows( ) ) + " values, expected " +
+                                          std::to_string( numberOfNodes_ ) );
+            }
+            for ( unsigned int i = 0; i < numberOfNodes_; i++ )
+            {
+                weighedIntegrands( i ) = weights( i ) * integrands_( i );
+            }
+        }
+        else
+        {
+            for ( unsigned int i = 0; i < numberOfNodes_; i++ )
+            {
+                weighedIntegrands( i ) = weights( i ) * integrand_( independentVariables_( i ) );
+            }
         }
 
         quadratureResult_ = 0.5 * ( upperLimit_ - lowerLimit_ ) * weighedIntegrands.sum( );
@@ -359,6 +442,9 @@ private:
     //! Function returning the integrand.
     std::function< DependentVariableType( IndependentVariableType ) > integrand_;
 
+    //! Function returning the integrand at all nodes at once (used instead of integrand_, if set).
+    BatchIntegrandFunction batchIntegrand_;
+
     //! Lower limit for the integral.
     IndependentVariableType lowerLimit_;
 
@@ -374,8 +460,15 @@ private:
     //! Computed value of the quadrature, as computed by last call to performQuadrature.
     DependentVariableType quadratureResult_;
 
+    //! Shared (read-only) container of nodes and weights.
     std::shared_ptr< GaussQuadratureNodesAndWeights< IndependentVariableType > > gaussQuadratureNodesAndWeights_;
 
+    //! Values of the independent variable at the nodes, as computed by last call to performQuadrature.
+    IndependentVariableArray independentVariables_;
+
+    //! Values of the integrand at the nodes, as computed by last call to performQuadrature with batch integrand.
+    DependentVariableArray integrands_;
+
 };
 
 } // namespace numerical_quadrature
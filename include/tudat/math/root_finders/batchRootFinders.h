@@ -0,0 +1,289 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_BATCH_ROOT_FINDERS_H
+#define TUDAT_BATCH_ROOT_FINDERS_H
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include <Eigen/Core>
+
+#include "tudat/math/root_finders/terminationConditions.h"
+
+namespace tudat
+{
+namespace root_finders
+{
+
+//! Function to check whether all roots of a batch have converged, and handle non-converged roots if not.
+/*!
+ *  Function to check whether all roots of a batch have converged, and handle the non-converged roots (after the
+ *  maximum number of iterations) according to the given setting, as is done by checkMaximumIterationsExceeded for a
+ *  single root.
+ *  \param isRootConverged Flags indicating for each root whether it has converged.
+ *  \param maximumIterationHandling Handling of roots that have not converged.
+ */
+inline void checkBatchRootConvergence( const Eigen::Array< bool, Eigen::Dynamic, 1 >& isRootConverged,
+                                       const MaximumIterationHandling maximumIterationHandling )
+{
+    if( !isRootConverged.all( ) )
+    {
+        std::string errorMessage = "Batch root-finder did not converge within maximum number of iterations for " +
+                std::to_string( isRootConverged.rows( ) - isRootConverged.count( ) ) + " of " +
+                std::to_string( isRootConverged.rows( ) ) + " roots!";
+        switch( maximumIterationHandling )
+        {
+        case accept_result:
+            break;
+        case accept_result_with_warning:
+            std::cerr << errorMessage << std::endl;
+            break;
+        case throw_exception:
+            throw std::runtime_error( errorMessage );
+            break;
+        }
+    }
+}
+
+//! Find the roots of a batch of independent scalar functions, using the Newton-Raphson method.
+/*!
+ *  Find the roots of a batch of independent scalar functions (e.g. Kepler's equation for a set of mean anomalies),
+ *  using the Newton-Raphson method (see NewtonRaphson class), iterating on all roots simultaneously. The functions and
+ *  their derivatives are evaluated for all roots at once, by a single call to the evaluator, which may therefore be
+ *  vectorized. Each root is iterated until the relative change in the root is below the tolerance (as for the
+ *  RootRelativeToleranceTerminationCondition), or its function value is exactly zero. Converged roots are no longer
+ *  modified, but remain part of the (contiguous) arrays on which the evaluator is called.
+ *  \tparam RootFunctionEvaluator Type of evaluator, which is called as
+ *  evaluator( rootValues, functionValues, firstDerivativeValues ), with the latter two returned by reference.
+ *  \param rootFunctionEvaluator Evaluator of the functions, and their first derivatives.
+ *  \param roots Initial guesses of the roots as input, roots as output (returned by reference).
+ *  \param relativeTolerance Relative change in root below which a root is converged.
+ *  \param maximumNumberOfIterations Maximum number of iterations.
+ *  \param maximumIterationHandling Handling of roots that have not converged within the maximum number of iterations.
+ *  \return Flags indicating for each root whether it has converged.
+ */
+template< typename RootFunctionEvaluator, typename ScalarType >
+Eigen::Array< bool, Eigen::Dynamic, 1 > findRootsUsingNewtonRaphson(
+        const RootFunctionEvaluator& rootFunctionEvaluator,
+        Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& roots,
+        const typename std::common_type< ScalarType >::type relativeTolerance,
+        const unsigned int maximumNumberOfIterations = 100,
+        const MaximumIterationHandling maximumIterationHandling = throw_exception )
+{
+    typedef Eigen::Array< ScalarType, Eigen::Dynamic, 1 > ArrayType;
+
+    ArrayType functionValues( roots.rows( ) ), firstDerivativeValues( roots.rows( ) ), nextRoots( roots.rows( ) );
+
+    rootFunctionEvaluator( roots, functionValues, firstDerivativeValues );
+    Eigen::Array< bool, Eigen::Dynamic, 1 > isRootConverged = ( functionValues == ScalarType( 0 ) );
+    for( unsigned int iteration = 0; iteration < maximumNumberOfIterations && !isRootConverged.all( ); iteration++ )
+    {
+        // Update non-converged roots
+        nextRoots = roots - functionValues / firstDerivativeValues;
+        Eigen::Array< bool, Eigen::Dynamic, 1 > isUpdateConverged =
+                ( ( nextRoots - roots ) / nextRoots ).abs( ) < relativeTolerance;
+        roots = isRootConverged.select( roots, nextRoots );
+
+        rootFunctionEvaluator( roots, functionValues, firstDerivativeValues );
+        isRootConverged = isRootConverged || isUpdateConverged || ( functionValues == ScalarType( 0 ) );
+    }
+
+    checkBatchRootConvergence( isRootConverged, maximumIterationHandling );
+    return isRootConverged;
+}
+
+//! Find the roots of a batch of independent scalar functions, using Halley's method.
+/*!
+ *  Find the roots of a batch of independent scalar functions, using Halley's method (see HalleyRootFinder class),
+ *  iterating on all roots simultaneously. Convergence is handled as for findRootsUsingNewtonRaphson.
+ *  \tparam RootFunctionEvaluator Type of evaluator, which is called as
+ *  evaluator( rootValues, functionValues, firstDerivativeValues, secondDerivativeValues ), with the latter three
+ *  returned by reference.
+ *  \param rootFunctionEvaluator Evaluator of the functions, and their first and second derivatives.
+ *  \param roots Initial guesses of the roots as input, roots as output (returned by reference).
+ *  \param relativeTolerance Relative change in root below which a root is converged.
+ *  \param maximumNumberOfIterations Maximum number of iterations.
+ *  \param maximumIterationHandling Handling of roots that have not converged within the maximum number of iterations.
+ *  \return Flags indicating for each root whether it has converged.
+ */
+template< typename RootFunctionEvaluator, typename ScalarType >
+Eigen::Array< bool, Eigen::Dynamic, 1 > findRootsUsingHalley(
+        const RootFunctionEvaluator& rootFunctionEvaluator,
+        Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& roots,
+        const typename std::common_type< ScalarType >::type relativeTolerance,
+        const unsigned int maximumNumberOfIterations = 100,
+        const MaximumIterationHandling maximumIterationHandling = throw_exception )
+{
+    typedef Eigen::Array< ScalarType, Eigen::Dynamic, 1 > ArrayType;
+
+    ArrayType functionValues( roots.rows( ) ), firstDerivativeValues( roots.rows( ) ),
+            secondDerivativeValues( roots.rows( ) ), nextRoots( roots.rows( ) );
+
+    rootFunctionEvaluator( roots, functionValues, firstDerivativeValues, secondDerivativeValues );
+    Eigen::Array< bool, Eigen::Dynamic, 1 > isRootConverged = ( functionValues == ScalarType( 0 ) );
+    for( unsigned int iteration = 0; iteration < maximumNumberOfIterations && !isRootConverged.all( ); iteration++ )
+    {
+        // Update non-converged roots
+        nextRoots = roots - ( ScalarType( 2 ) * functionValues * firstDerivativeValues ) /
+                ( ScalarType( 2 ) * firstDerivativeValues * firstDerivativeValues -
+                  functionValues * secondDerivativeValues );
+        Eigen::Array< bool, Eigen::Dynamic, 1 > isUpdateConverged =
+                ( ( nextRoots - roots ) / nextRoots ).abs( ) < relativeTolerance;
+        roots = isRootConverged.select( roots, nextRoots );
+
+        rootFunctionEvaluator( roots, functionValues, firstDerivativeValues, secondDerivativeValues );
+        isRootConverged = isRootConverged || isUpdateConverged || ( functionValues == ScalarType( 0 ) );
+    }
+
+    checkBatchRootConvergence( isRootConverged, maximumIterationHandling );
+    return isRootConverged;
+}
+
+//! Find the roots of a batch of independent scalar functions, using the secant method.
+/*!
+ *  Find the roots of a batch of independent scalar functions, using the secant method (see SecantRootFinder class),
+ *  iterating on all roots simultaneously, so that no derivatives are required. Convergence is handled as for
+ *  findRootsUsingNewtonRaphson.
+ *  \tparam RootFunctionEvaluator Type of evaluator, which is called as evaluator( rootValues, functionValues ), with the
+ *  latter returned by reference.
+ *  \param rootFunctionEvaluator Evaluator of the functions.
+ *  \param firstInitialGuesses First initial guesses of the roots.
+ *  \param roots Second initial guesses of the roots as input, roots as output (returned by reference).
+ *  \param relativeTolerance Relative change in root below which a root is converged.
+ *  \param maximumNumberOfIterations Maximum number of iterations.
+ *  \param maximumIterationHandling Handling of roots that have not converged within the maximum number of iterations.
+ *  \return Flags indicating for each root whether it has converged.
+ */
+template< typename RootFunctionEvaluator, typename ScalarType >
+Eigen::Array< bool, Eigen::Dynamic, 1 > findRootsUsingSecant(
+        const RootFunctionEvaluator& rootFunctionEvaluator,
+        const Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& firstInitialGuesses,
+        Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& roots,
+        const typename std::common_type< ScalarType >::type relativeTolerance,
+        const unsigned int maximumNumberOfIterations = 100,
+        const MaximumIterationHandling maximumIterationHandling = throw_exception )
+{
+    typedef Eigen::Array< ScalarType, Eigen::Dynamic, 1 > ArrayType;
+
+    if( firstInitialGuesses.rows( ) != roots.rows( ) )
+    {
+        throw std::runtime_error( "Error in batch secant root finder, inconsistent number of initial guesses." );
+    }
+
+    ArrayType previousRoots = firstInitialGuesses;
+    ArrayType previousFunctionValues( roots.rows( ) ), functionValues( roots.rows( ) ), nextRoots( roots.rows( ) );
+
+    rootFunctionEvaluator( previousRoots, previousFunctionValues );
+    rootFunctionEvaluator( roots, functionValues );
+    Eigen::Array< bool, Eigen::Dynamic, 1 > isRootConverged = ( functionValues == ScalarType( 0 ) );
+    for( unsigned int iteration = 0; iteration < maximumNumberOfIterations && !isRootConverged.all( ); iteration++ )
+    {
+        // Update non-converged roots
+        nextRoots = roots - functionValues * ( roots - previousRoots ) / ( functionValues - previousFunctionValues );
+        Eigen::Array< bool, Eigen::Dynamic, 1 > isUpdateConverged =
+                ( ( nextRoots - roots ) / nextRoots ).abs( ) < relativeTolerance;
+        previousRoots = isRootConverged.select( previousRoots, roots );
+        previousFunctionValues = isRootConverged.select( previousFunctionValues, functionValues );
+        roots = isRootConverged.select( roots, nextRoots );
+
+        rootFunctionEvaluator( roots, functionValues );
+        isRootConverged = isRootConverged || isUpdateConverged || ( functionValues == ScalarType( 0 ) );
+    }
+
+    checkBatchRootConvergence( isRootConverged, maximumIterationHandling );
+    return isRootConverged;
+}
+
+//! Find the roots of a batch of independent scalar functions, using the bisection method.
+/*!
+ *  Find the roots of a batch of independent scalar functions, using the bisection method (see Bisection class),
+ *  iterating on all roots simultaneously. Each root is bracketed by a lower and upper bound, at which the function
+ *  values must have different sign. Convergence is handled as for findRootsUsingNewtonRaphson.
+ *  \tparam RootFunctionEvaluator Type of evaluator, which is called as evaluator( rootValues, functionValues ), with the
+ *  latter returned by reference.
+ *  \param rootFunctionEvaluator Evaluator of the functions.
+ *  \param lowerBounds Lower bounds of the interval in which each root is located.
+ *  \param upperBounds Upper bounds of the interval in which each root is located.
+ *  \param roots Roots (returned by reference).
+ *  \param relativeTolerance Relative change in root below which a root is converged.
+ *  \param maximumNumberOfIterations Maximum number of iterations.
+ *  \param maximumIterationHandling Handling of roots that have not converged within the maximum number of iterations.
+ *  \return Flags indicating for each root whether it has converged.
+ */
+template< typename RootFunctionEvaluator, typename ScalarType >
+Eigen::Array< bool, Eigen::Dynamic, 1 > findRootsUsingBisection(
+        const RootFunctionEvaluator& rootFunctionEvaluator,
+        const Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& lowerBounds,
+        const Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& upperBounds,
+        Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& roots,
+        const typename std::common_type< ScalarType >::type relativeTolerance,
+        const unsigned int maximumNumberOfIterations = 100,
+        const MaximumIterationHandling maximumIterationHandling = throw_exception )
+{
+    typedef Eigen::Array< ScalarType, Eigen::Dynamic, 1 > ArrayType;
+
+    if( lowerBounds.rows( ) != upperBounds.rows( ) )
+    {
+        throw std::runtime_error( "Error in batch bisection root finder, inconsistent number of bounds." );
+    }
+
+    ArrayType currentLowerBounds = lowerBounds;
+    ArrayType currentUpperBounds = upperBounds;
+    ArrayType lowerBoundFunctionValues( lowerBounds.rows( ) ), upperBoundFunctionValues( lowerBounds.rows( ) );
+    ArrayType functionValues( lowerBounds.rows( ) ), previousRoots( lowerBounds.rows( ) );
+
+    rootFunctionEvaluator( currentLowerBounds, lowerBoundFunctionValues );
+    rootFunctionEvaluator( currentUpperBounds, upperBoundFunctionValues );
+    if( ( lowerBoundFunctionValues * upperBoundFunctionValues > ScalarType( 0 ) ).any( ) )
+    {
+        throw std::runtime_error( "The Bisection algorithm requires that the values at the upper, "
+                                  "and lower bounds have a different sign." );
+    }
+
+    // Start at midpoint of interval, unless a bound is a root
+    roots = ( lowerBoundFunctionValues == ScalarType( 0 ) ).select(
+                currentLowerBounds, ( upperBoundFunctionValues == ScalarType( 0 ) ).select(
+                    currentUpperBounds, ( currentLowerBounds + currentUpperBounds ) / ScalarType( 2 ) ) );
+    Eigen::Array< bool, Eigen::Dynamic, 1 > isRootConverged =
+            ( lowerBoundFunctionValues == ScalarType( 0 ) ) || ( upperBoundFunctionValues == ScalarType( 0 ) );
+
+    rootFunctionEvaluator( roots, functionValues );
+    isRootConverged = isRootConverged || ( functionValues == ScalarType( 0 ) );
+    for( unsigned int iteration = 0; iteration < maximumNumberOfIterations && !isRootConverged.all( ); iteration++ )
+    {
+        // Keep subinterval with function values of opposite sign at bounds
+        Eigen::Array< bool, Eigen::Dynamic, 1 > replaceUpperBound =
+                functionValues * lowerBoundFunctionValues < ScalarType( 0 );
+        currentUpperBounds = replaceUpperBound.select( roots, currentUpperBounds );
+        upperBoundFunctionValues = replaceUpperBound.select( functionValues, upperBoundFunctionValues );
+        currentLowerBounds = replaceUpperBound.select( currentLowerBounds, roots );
+        lowerBoundFunctionValues = replaceUpperBound.select( lowerBoundFunctionValues, functionValues );
+
+        // Update non-converged roots to midpoint of interval
+        previousRoots = roots;
+        roots = isRootConverged.select( roots, ( currentLowerBounds + currentUpperBounds ) / ScalarType( 2 ) );
+
+        rootFunctionEvaluator( roots, functionValues );
+        isRootConverged = isRootConverged || ( ( roots - previousRoots ) / roots ).abs( ) < relativeTolerance ||
+                ( functionValues == ScalarType( 0 ) );
+    }
+
+    checkBatchRootConvergence( isRootConverged, maximumIterationHandling );
+    return isRootConverged;
+}
+
+} // namespace root_finders
+} // namespace tudat
+
+#endif // TUDAT_BATCH_ROOT_FINDERS_H
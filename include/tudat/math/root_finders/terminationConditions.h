@@ -21,6 +21,8 @@
 #include <memory>
 #include <vector>
 
+#include "tudat/math/basic/mathematicalConstants.h"
+
 namespace tudat
 {
 namespace root_finders
@@ -0,0 +1,157 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Salmon J.K., et al. Parallel random numbers: as easy as 1, 2, 3. Proceedings of the International Conference
+ *          for High Performance Computing, Networking, Storage and Analysis, 2011.
+ */
+
+#ifndef TUDAT_COUNTER_BASED_RANDOM_NUMBER_GENERATOR_H
+#define TUDAT_COUNTER_BASED_RANDOM_NUMBER_GENERATOR_H
+
+#include <array>
+#include <cstdint>
+
+namespace tudat
+{
+
+namespace statistics
+{
+
+//! Counter-based (Philox4x32-10) uniform random number generator, producing an independent stream per stream index.
+/*!
+ *  Counter-based uniform random number generator, implementing the Philox4x32-10 algorithm (Salmon et al., 2011). Each
+ *  output block is computed directly from the seed (key) and a counter, consisting of the stream index and the index of
+ *  the block in the stream. Consequently, creating a generator for any (seed, stream index) pair is cheap, and the
+ *  streams for different stream indices are statistically independent. By using one stream per sample index (instead of
+ *  a single generator shared between threads), parallel Monte Carlo sampling is thread-safe and produces results that are
+ *  bit-identical regardless of the number of threads. The class satisfies the requirements of a uniform random number
+ *  generator, so that it may be used with the boost (and std) random distributions.
+ */
+class PhiloxRandomNumberGenerator
+{
+public:
+
+    //! Type of generated random numbers.
+    typedef uint32_t result_type;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param seed Seed of random number generator, shared by all streams.
+     *  \param streamIndex Index of the stream of random numbers (typically the index of the sample).
+     */
+    PhiloxRandomNumberGenerator( const uint64_t seed, const uint64_t streamIndex = 0 ):
+        key_( { { static_cast< uint32_t >( seed ), static_cast< uint32_t >( seed >> 32 ) } } ),
+        streamIndex_( streamIndex ), blockIndex_( 0 ), outputIndex_( 4 ){ }
+
+    //! Function to retrieve the minimum value that can be generated.
+    static constexpr result_type min( )
+    {
+        return 0;
+    }
+
+    //! Function to retrieve the maximum value that can be generated.
+    static constexpr result_type max( )
+    {
+        return 0xFFFFFFFF;
+    }
+
+    //! Function to generate the next random number in the stream.
+    result_type operator( )( )
+    {
+        if( outputIndex_ == 4 )
+        {
+            computeOutputBlock( );
+            blockIndex_++;
+            outputIndex_ = 0;
+        }
+        return outputBlock_[ outputIndex_++ ];
+    }
+
+    //! Function to skip a number of random numbers in the stream (without computing them).
+    /*!
+     *  Function to skip a number of random numbers in the stream (without computing them).
+     *  \param numberOfValues Number of random numbers that is to be skipped.
+     */
+    void discard( uint64_t numberOfValues )
+    {
+        // Skip values remaining in current block
+        while( numberOfValues > 0 && outputIndex_ < 4 )
+        {
+            outputIndex_++;
+            numberOfValues--;
+        }
+
+        // Skip full blocks, and part of next block
+        if( numberOfValues > 0 )
+        {
+            blockIndex_ += numberOfValues / 4;
+            outputIndex_ = 4;
+            for( unsigned int i = 0; i < numberOfValues % 4; i++ )
+            {
+                operator( )( );
+            }
+        }
+    }
+
+    //! Function to retrieve the index of the stream of random numbers.
+    uint64_t getStreamIndex( ) const
+    {
+        return streamIndex_;
+    }
+
+private:
+
+    //! Function to compute the block of four random numbers for the current counter (10 Philox rounds).
+    void computeOutputBlock( )
+    {
+        std::array< uint32_t, 4 > counter = { { static_cast< uint32_t >( blockIndex_ ),
+                                                static_cast< uint32_t >( blockIndex_ >> 32 ),
+                                                static_cast< uint32_t >( streamIndex_ ),
+                                                static_cast< uint32_t >( streamIndex_ >> 32 ) } };
+        std::array< uint32_t, 2 > key = key_;
+
+        for( unsigned int round = 0; round < 10; round++ )
+        {
+            const uint64_t firstProduct = static_cast< uint64_t >( 0xD2511F53 ) * counter[ 0 ];
+            const uint64_t secondProduct = static_cast< uint64_t >( 0xCD9E8D57 ) * counter[ 2 ];
+
+            counter = { { static_cast< uint32_t >( secondProduct >> 32 ) ^ counter[ 1 ] ^ key[ 0 ],
+                          static_cast< uint32_t >( secondProduct ),
+                          static_cast< uint32_t >( firstProduct >> 32 ) ^ counter[ 3 ] ^ key[ 1 ],
+                          static_cast< uint32_t >( firstProduct ) } };
+
+            key[ 0 ] += 0x9E3779B9;
+            key[ 1 ] += 0xBB67AE85;
+        }
+        outputBlock_ = counter;
+    }
+
+    //! Key of the generator, computed from the seed.
+    std::array< uint32_t, 2 > key_;
+
+    //! Index of the stream of random numbers.
+    uint64_t streamIndex_;
+
+    //! Index in the stream of the next block of four random numbers that is to be computed.
+    uint64_t blockIndex_;
+
+    //! Index in outputBlock_ of the next random number that is to be returned.
+    unsigned int outputIndex_;
+
+    //! Current block of four random numbers.
+    std::array< uint32_t, 4 > outputBlock_;
+};
+
+} // namespace statistics
+
+} // namespace tudat
+
+#endif // TUDAT_COUNTER_BASED_RANDOM_NUMBER_GENERATOR_H
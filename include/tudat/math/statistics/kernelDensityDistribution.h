@@ -15,6 +15,7 @@
 
 #include <memory>
 
+#include "tudat/math/basic/kdTree.h"
 #include "tudat/math/statistics/continuousProbabilityDistributions.h"
 #include "tudat/math/statistics/boostProbabilityDistributions.h"
 namespace tudat
@@ -23,6 +24,48 @@ namespace tudat
 namespace statistics
 {
 
+//! Function to evaluate the pdf of a single (one-dimensional) Gaussian kernel
+/*!
+ *  Function to evaluate the pdf of a single (one-dimensional) Gaussian kernel, identical to the pdf of a boost normal
+ *  distribution, but without the overhead of creating a distribution object.
+ *  \param mean Kernel mean
+ *  \param bandWidth Kernel bandwidth (standard deviation)
+ *  \param independentVariable Value of independent variable
+ *  \return Evaluated pdf
+ */
+double evaluateGaussianKernelPdf( const double mean, const double bandWidth, const double independentVariable );
+
+//! Function to evaluate the cdf of a single (one-dimensional) Gaussian kernel
+/*!
+ *  Function to evaluate the cdf of a single (one-dimensional) Gaussian kernel, identical to the cdf of a boost normal
+ *  distribution, but without the overhead of creating a distribution object.
+ *  \param mean Kernel mean
+ *  \param bandWidth Kernel bandwidth (standard deviation)
+ *  \param independentVariable Value of independent variable
+ *  \return Evaluated cdf
+ */
+double evaluateGaussianKernelCdf( const double mean, const double bandWidth, const double independentVariable );
+
+//! Function to evaluate the pdf of a single (one-dimensional) Epanechnikov kernel
+/*!
+ *  Function to evaluate the pdf of a single (one-dimensional) Epanechnikov kernel
+ *  \param mean Kernel mean
+ *  \param bandWidth Kernel bandwidth
+ *  \param independentVariable Value of independent variable
+ *  \return Evaluated pdf
+ */
+double evaluateEpanechnikovKernelPdf( const double mean, const double bandWidth, const double independentVariable );
+
+//! Function to evaluate the cdf of a single (one-dimensional) Epanechnikov kernel
+/*!
+ *  Function to evaluate the cdf of a single (one-dimensional) Epanechnikov kernel
+ *  \param mean Kernel mean
+ *  \param bandWidth Kernel bandwidth
+ *  \param independentVariable Value of independent variable
+ *  \return Evaluated cdf
+ */
+double evaluateEpanechnikovKernelCdf( const double mean, const double bandWidth, const double independentVariable );
+
 //! Class for Probability distribution using a single Epanechnikov kernel
 class EpanechnikovKernelDistribution: public tudat::statistics::ContinuousProbabilityDistribution< double >
 {
@@ -76,6 +119,10 @@ enum KernelType
  *  Class that uses random samples to generate a multivariate probability distribution using Kernel Density distribution.
  *  The bandwidth of the kernels may be supplied by the user, or an optimal distrubution may be computed by this class
  *  At present, the user has the choice of a Gaussian or Epanechnikov distribution for the kernels.
+ *  The samples are stored contiguously, and the kernels are evaluated directly from the samples and bandwidths. By
+ *  default, the pdf is evaluated exactly, by summing over all kernels. For large sample sets, an approximate evaluation
+ *  may be selected (see setPdfEvaluationTolerance), in which only the kernels close to the evaluation point are summed,
+ *  using a k-d tree of the samples.
  */
 class KernelDensityDistribution: public tudat::statistics::ContinuousProbabilityDistribution< Eigen::VectorXd >
 {
@@ -95,13 +142,16 @@ public:
      * deviation computed from the samples/
      * \param manualBandwidth Vector of bandwidths for each dimension that is to be used in the kernels. By default this
      * vector is empty and not used. Optimal bandwidths (scaled by bandWidthFactor) are used in this default case.
+     * \param numberOfThreads Number of threads over which the computation of the optimal bandwidth, and the batch
+     * evaluation of the pdf and cdf, are distributed.
      */
     KernelDensityDistribution(
             const std::vector< Eigen::VectorXd >& samples,
             const double bandWidthFactor = 1.0,
             const KernelType kernel_type = KernelType::gaussian_kernel,
             const Eigen::VectorXd& manualStandardDeviation = Eigen::VectorXd::Zero( 0 ),
-            const Eigen::VectorXd& manualBandwidth = Eigen::VectorXd::Zero( 0 ) );
+            const Eigen::VectorXd& manualBandwidth = Eigen::VectorXd::Zero( 0 ),
+            const int numberOfThreads = 1 );
 
     //! Function to evaluate pdf of distribution
     /*!
@@ -119,6 +169,47 @@ public:
      */
     double evaluateCdf( const Eigen::VectorXd& independentVariables );
 
+    //! Function to evaluate pdf of distribution at a set of points
+    /*!
+     *  Function to evaluate probability distribution function at a set of points, distributed over the number of threads
+     *  provided to the constructor.
+     *  \param independentVariables Values of independent variables, with one point per column
+     *  \return Evaluated pdf at each point
+     */
+    Eigen::VectorXd evaluatePdfs( const Eigen::MatrixXd& independentVariables );
+
+    //! Function to evaluate cdf of distribution at a set of points
+    /*!
+     *  Function to evaluate cumulative distribution function at a set of points, distributed over the number of threads
+     *  provided to the constructor.
+     *  \param independentVariables Values of independent variables, with one point per column
+     *  \return Evaluated cdf at each point
+     */
+    Eigen::VectorXd evaluateCdfs( const Eigen::MatrixXd& independentVariables );
+
+    //! Function to set the tolerance for approximate evaluation of the pdf
+    /*!
+     *  Function to set the tolerance for approximate evaluation of the pdf (in evaluatePdf and evaluatePdfs). If the
+     *  tolerance is positive, only the kernels within a given number of bandwidths of the evaluation point are summed,
+     *  which are found from a k-d tree of the samples (scaled by the bandwidth). For Gaussian kernels, the number of
+     *  bandwidths is set such that each neglected kernel has a pdf below the tolerance times its maximum value, so that
+     *  the absolute error of the pdf is below the tolerance times the maximum pdf of a single kernel. For Epanechnikov
+     *  kernels, only kernels that are zero at the evaluation point are neglected, so that the evaluation is exact. A
+     *  tolerance of zero (default) selects the exact evaluation, summing over all kernels.
+     *  \param pdfEvaluationTolerance Tolerance for approximate evaluation of the pdf
+     */
+    void setPdfEvaluationTolerance( const double pdfEvaluationTolerance );
+
+    //! Function to retrieve the tolerance for approximate evaluation of the pdf
+    /*!
+     * Function to retrieve the tolerance for approximate evaluation of the pdf (see setPdfEvaluationTolerance)
+     * \return Tolerance for approximate evaluation of the pdf
+     */
+    double getPdfEvaluationTolerance( )
+    {
+        return pdfEvaluationTolerance_;
+    }
+
     //! Function to evaluate probability density of marginal (in one or more dimensions) distribution.
     /*!
      * Function to evaluate probability density of marginal (in one or more dimensions) distribution,
@@ -221,7 +312,7 @@ public:
     void setBandWidth( const Eigen::VectorXd& bandWidth )
     {
         bandWidth_ = bandWidth;
-        generateKernelPointerMatrix( ); // Reset kernels
+        resetKernels( ); // Reset kernels
     }
 
     //! Function to retrieve the sample mean.
@@ -269,42 +360,53 @@ protected:
 
 private:
 
-    //! Function that constructs a single kernel.
+    //! Function that checks the bandwidths, and resets the kernel density distribution for the current bandwidths
     /*!
-     * Function that constructs a single kernel, called iteratively to construct the full multivariate kernel density.
-     * \param mean Mean value of kernel that is to be created.
-     * \param bandWidth Bandwidth of kernel thatr is to be created.
-     * \return Probability distribution for single kernel.
+     *  Function that checks the bandwidths, and resets the kernel density distribution for the current bandwidths. The
+     *  k-d tree used for the approximate pdf evaluation (which depends on the bandwidths) is cleared, and recreated when
+     *  required.
      */
-    std::shared_ptr< ContinuousProbabilityDistribution< double > > constructKernel(
-            const double mean, const double bandWidth )
+    void resetKernels( );
+
+    //! Function to evaluate the pdf of the kernel of a single sample, in a single dimension
+    double evaluateKernelPdf( const int sampleIndex, const int dimension, const double independentVariable ) const
     {
-        std::shared_ptr< ContinuousProbabilityDistribution< double > > kernelPointer;
+        return ( kernelType_ == KernelType::gaussian_kernel ) ?
+                    evaluateGaussianKernelPdf(
+                        sampleMatrix_( dimension, sampleIndex ), bandWidth_( dimension ), independentVariable ) :
+                    evaluateEpanechnikovKernelPdf(
+                        sampleMatrix_( dimension, sampleIndex ), bandWidth_( dimension ), independentVariable );
+    }
 
-        // Check kernel type and create selected kernel.
-        if( kernelType_ == KernelType::epanechnikov_kernel )
-        {
-            kernelPointer = std::make_shared< EpanechnikovKernelDistribution >( mean, bandWidth );
-        }
-        else if( kernelType_ == KernelType::gaussian_kernel )
-        {
-            kernelPointer = createBoostRandomVariable(
-                        normal_boost_distribution, { mean, bandWidth } );
-        }
-        else
+    //! Function to evaluate the cdf of the kernel of a single sample, in a single dimension
+    double evaluateKernelCdf( const int sampleIndex, const int dimension, const double independentVariable ) const
+    {
+        return ( kernelType_ == KernelType::gaussian_kernel ) ?
+                    evaluateGaussianKernelCdf(
+                        sampleMatrix_( dimension, sampleIndex ), bandWidth_( dimension ), independentVariable ) :
+                    evaluateEpanechnikovKernelCdf(
+                        sampleMatrix_( dimension, sampleIndex ), bandWidth_( dimension ), independentVariable );
+    }
+
+    //! Function to evaluate the pdf of the kernel of a single sample, in all dimensions
+    double evaluateKernelPdf( const int sampleIndex, const Eigen::VectorXd& independentVariables ) const
+    {
+        double kernelPdf = 1.0;
+        for( int currentDimension = 0; currentDimension < dimensions_; currentDimension++ )
         {
-            throw std::runtime_error( "Error when constructing probability kernels, kernel type not recognized" );
+            kernelPdf *= evaluateKernelPdf( sampleIndex, currentDimension, independentVariables( currentDimension ) );
         }
-
-        return kernelPointer;
+        return kernelPdf;
     }
 
-    //! Function that generates the kernel density distribution based on the samples and kernel type that is provided
-    /*!
-     *  Function that generates the kernel density distribution based on the samples and kernel type that is provided.
-     *  This function iteratively calls the constructKernel function to create a kernel for each entry in each sample.
-     */
-    void generateKernelPointerMatrix( );
+    //! Function to compute the pdf (exactly, or approximately using the k-d tree, if it has been created)
+    double computePdf( const Eigen::VectorXd& independentVariables ) const;
+
+    //! Function to compute the cdf
+    double computeCdf( const Eigen::VectorXd& independentVariables ) const;
+
+    //! Function to create the k-d tree of the samples (scaled by the bandwidth), if it is required and not yet created
+    void createScaledSampleTree( );
 
     //! Function that computes and sets the sample mean.
     /*!
@@ -326,14 +428,6 @@ private:
      */
     void scaleSamplesWithVariance( const Eigen::VectorXd& standardDeviation );
 
-    //! Function to retrieve the sample set median
-    /*!
-     * Function to retrieve the sample set median
-     * \param samples Set of samples from which the (per entry) median is to be computed.
-     * \return Sample set median
-     */
-    Eigen::VectorXd getMedian( const std::vector< Eigen::VectorXd >& samples );
-
     //! Datasamples
     std::vector< Eigen::VectorXd > dataSamples_;
 
@@ -361,8 +455,20 @@ private:
     //! Number of datasamples
     int numberOfSamples_;
 
-    //! Matrix (vector of vectors) of 1D kernel pointers that define full kernel density distribution.
-    std::vector< std::vector< std::shared_ptr< ContinuousProbabilityDistribution< double > > > > kernelPointersMatrix_;
+    //! Datasamples, stored contiguously with one sample per column (used for evaluation of kernels).
+    Eigen::MatrixXd sampleMatrix_;
+
+    //! Number of threads over which bandwidth computation and batch evaluation are distributed.
+    int numberOfThreads_;
+
+    //! Tolerance for approximate evaluation of the pdf (exact evaluation if zero).
+    double pdfEvaluationTolerance_;
+
+    //! Radius (in units of bandwidth) within which kernels are summed for approximate evaluation of the pdf.
+    double scaledKernelCutoffRadius_;
+
+    //! K-d tree of the samples, scaled by the bandwidth (nullptr if approximate pdf evaluation is not used).
+    std::shared_ptr< basic_mathematics::KdTree< Eigen::Dynamic > > scaledSampleTree_;
 
 };
 
@@ -122,6 +122,41 @@ std::vector< Eigen::VectorXd > generateGaussianRandomSample(
 
 
 
+//! Fill matrix with independently and identically uniformly distributed random numbers.
+/*!
+ *  Function to fill a matrix with independently and identically uniformly distributed random numbers, where each column
+ *  represents a single sample. The entries of each column are generated from their own stream of a counter-based random
+ *  number generator (see PhiloxRandomNumberGenerator), with the (global) sample index as stream index. As a result, the
+ *  samples may be generated in parallel, and are bit-identical regardless of the number of threads, and regardless of
+ *  whether a sample set is generated at once or in chunks (using the firstSampleIndex argument).
+ *  \param randomMatrix Matrix that is to be filled with random numbers (returned by reference; size is not modified).
+ *  \param seed Seed of random number generator.
+ *  \param lowerBound Lower bound of the distribution.
+ *  \param upperBound Upper bound of the distribution.
+ *  \param numberOfThreads Number of threads over which the samples are distributed.
+ *  \param firstSampleIndex Global index of the sample in the first column of the matrix.
+ */
+void fillUniformRandomMatrix(
+        Eigen::MatrixXd& randomMatrix, const uint64_t seed,
+        const double lowerBound = 0.0, const double upperBound = 1.0,
+        const int numberOfThreads = 1, const uint64_t firstSampleIndex = 0 );
+
+//! Fill matrix with independently and identically Gaussian distributed random numbers.
+/*!
+ *  Function to fill a matrix with independently and identically Gaussian distributed random numbers, where each column
+ *  represents a single sample. The random numbers are reproducible in the same manner as for fillUniformRandomMatrix.
+ *  \param randomMatrix Matrix that is to be filled with random numbers (returned by reference; size is not modified).
+ *  \param seed Seed of random number generator.
+ *  \param mean Mean value of the distribution.
+ *  \param standardDeviation Standard deviation of the distribution.
+ *  \param numberOfThreads Number of threads over which the samples are distributed.
+ *  \param firstSampleIndex Global index of the sample in the first column of the matrix.
+ */
+void fillGaussianRandomMatrix(
+        Eigen::MatrixXd& randomMatrix, const uint64_t seed,
+        const double mean = 0.0, const double standardDeviation = 1.0,
+        const int numberOfThreads = 1, const uint64_t firstSampleIndex = 0 );
+
 #if USE_GSL
 
 //! Generate sample of random vectors, using a Sobol sampling algorithm.
@@ -20,6 +20,7 @@
 
 
 #include "tudat/math/statistics/boostProbabilityDistributions.h"
+#include "tudat/math/statistics/counterBasedRandomNumberGenerator.h"
 
 namespace tudat
 {
@@ -38,7 +39,7 @@ public:
      *  Constructor, sets the seed for the base random number generator.
      *  \param seed Seed of random number generator (default is pseudo-random time(0))
      */
-    RandomVariableGenerator( const double seed ):randomNumberGenerator_( seed ){ }
+    RandomVariableGenerator( const double seed ):randomNumberGenerator_( seed ), seed_( seed ){ }
 
     //! Destructor
     virtual ~RandomVariableGenerator( ){ }
@@ -52,10 +53,19 @@ public:
      */
     virtual DependentVariableType getRandomVariableValue( ) = 0;
 
+    //! Function to retrieve the seed of the random number generator
+    double getSeed( ) const
+    {
+        return seed_;
+    }
+
 protected:
 
     //! Uniform (0,1) random number generator, to be mapped to specific distribution by derived classes.
     boost::random::mt19937 randomNumberGenerator_;
+
+    //! Seed of random number generator.
+    double seed_;
 };
 
 //! Random number generator generated directly from inverse cdf function of probability distribution
@@ -95,6 +105,24 @@ public:
         return randomVariable_->evaluateInverseCdf( randomUniformCdfGenerator_( ) );
     }
 
+    //! Function to generate random number from an independent, reproducible, stream
+    /*!
+     *  This function generates a random number from the distribution defined by randomVariable_, using the stream with the
+     *  given index of a counter-based generator (see PhiloxRandomNumberGenerator) with the same seed as this object. In
+     *  contrast to getRandomVariableValue( ), this function does not modify this object, so that it may be called
+     *  concurrently from multiple threads. Using the sample index as stream index, the generated samples are identical
+     *  regardless of the number of threads (and order) in which they are generated.
+     *  \param streamIndex Index of the stream from which the random number is generated (typically the sample index).
+     *  \return Randomly generated number of from given distribution
+     */
+    double getRandomVariableValueFromStream( const uint64_t streamIndex ) const
+    {
+        PhiloxRandomNumberGenerator streamGenerator(
+                    static_cast< uint64_t >( static_cast< int64_t >( seed_ ) ), streamIndex );
+        return randomVariable_->evaluateInverseCdf(
+                    boost::random::uniform_01< double >( )( streamGenerator ) );
+    }
+
 private:
 
     //! Probability distribution from which random number is generated.
@@ -0,0 +1,319 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_STREAMING_STATISTICS_H
+#define TUDAT_STREAMING_STATISTICS_H
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/basics/processCommunicator.h"
+
+namespace tudat
+{
+
+namespace statistics
+{
+
+//! Class to estimate the quantiles of a stream of samples, using a bounded amount of memory
+/*!
+ * Class to estimate the quantiles of a stream of (scalar) samples, using a bounded amount of memory, by means of a merging
+ * t-digest (Dunning and Ertl, 2019). The samples are represented by a sorted list of weighted centroids, the size of which
+ * is limited by the compression parameter. Centroids near the extremes of the distribution are kept small, so that the
+ * tail quantiles are estimated more accurately than the central quantiles. New samples are first stored in a buffer, which
+ * is merged into the centroids when it is full. Two sketches can be merged, so that samples can be processed by different
+ * threads or processes, and combined afterwards. The minimum and maximum values are tracked exactly.
+ */
+class StreamingQuantileSketch
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param compression Compression parameter, defining the (approximate) maximum number of centroids. A larger value
+     * improves the accuracy of the quantile estimates, at the expense of memory and computation time.
+     */
+    StreamingQuantileSketch( const double compression = 100.0 );
+
+    //! Function to add a single sample to the sketch
+    /*!
+     * Function to add a single sample to the sketch
+     * \param sample Value of sample that is to be added
+     */
+    void addSample( const double sample )
+    {
+        addCentroid( sample, 1.0 );
+    }
+
+    //! Function to merge another sketch into this sketch
+    /*!
+     * Function to merge another sketch into this sketch, after which this sketch represents the union of the samples of both
+     * \param otherSketch Sketch that is to be merged into this sketch
+     */
+    void merge( const StreamingQuantileSketch& otherSketch );
+
+    //! Function to retrieve an estimate of a quantile of the samples
+    /*!
+     * Function to retrieve an estimate of a quantile of the samples, interpolating linearly between the centroids (and the
+     * minimum and maximum value at the extremes).
+     * \param quantile Quantile that is to be estimated (between 0 and 1)
+     * \return Estimate of the quantile (NaN if no samples are added)
+     */
+    double getQuantile( const double quantile ) const;
+
+    //! Function to retrieve the number of samples that have been added
+    double getNumberOfSamples( ) const
+    {
+        return totalWeight_;
+    }
+
+    //! Function to retrieve the minimum value of the samples
+    double getMinimum( ) const
+    {
+        return minimum_;
+    }
+
+    //! Function to retrieve the maximum value of the samples
+    double getMaximum( ) const
+    {
+        return maximum_;
+    }
+
+    //! Function to retrieve the compression parameter
+    double getCompression( ) const
+    {
+        return compression_;
+    }
+
+    //! Function to retrieve the current number of centroids (after merging the buffer)
+    int getNumberOfCentroids( ) const
+    {
+        mergeBuffer( );
+        return centroids_.size( );
+    }
+
+    //! Function to append the contents of the sketch to a list of values (for communication between processes)
+    void serialize( std::vector< double >& data ) const;
+
+    //! Function to reset the contents of the sketch from a list of values, as created by serialize
+    /*!
+     * Function to reset the contents of the sketch from a list of values, as created by serialize
+     * \param data List of values from which the sketch is to be read
+     * \param currentIndex Index in data from which the sketch is to be read, incremented by the number of values read
+     */
+    void deserialize( const std::vector< double >& data, int& currentIndex );
+
+private:
+
+    //! Function to add a weighted centroid to the buffer, merging the buffer if it is full
+    void addCentroid( const double mean, const double weight );
+
+    //! Function to merge the buffer into the list of centroids
+    void mergeBuffer( ) const;
+
+    //! Function to compute the scale function k( q ) of the t-digest, with q the normalized cumulative weight
+    double computeScaleFunction( const double normalizedWeight ) const;
+
+    //! Function to compute the inverse of the scale function of the t-digest
+    double computeInverseScaleFunction( const double scaleFunction ) const;
+
+    //! Compression parameter
+    double compression_;
+
+    //! Maximum number of centroids in the buffer
+    unsigned int maximumBufferSize_;
+
+    //! Total weight (number of samples) of all centroids, including those in the buffer
+    double totalWeight_;
+
+    //! Minimum value of the samples
+    double minimum_;
+
+    //! Maximum value of the samples
+    double maximum_;
+
+    //! List of merged centroids (mean and weight), sorted by mean
+    mutable std::vector< std::pair< double, double > > centroids_;
+
+    //! List of centroids (mean and weight) that have not yet been merged
+    mutable std::vector< std::pair< double, double > > buffer_;
+};
+
+//! Class to compute the statistics of a stream of vector-valued samples, using a constant amount of memory
+/*!
+ * Class to compute the statistics of a stream of vector-valued samples, using an amount of memory that is independent of the
+ * number of samples: the sample mean and covariance (using the update of Welford, 1962), the minimum and maximum of each
+ * entry and (optionally) estimates of the quantiles of each entry (see StreamingQuantileSketch). Two objects can be merged
+ * (using the pairwise update of Chan et al., 1979), so that samples can be processed by different threads or processes, and
+ * combined afterwards. If an object without samples is merged with another object, it adopts the sample size and quantile
+ * settings of the other object. The sample size is set by the first sample that is added, if it is not provided to the
+ * constructor.
+ */
+class StreamingSampleStatistics
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param sampleSize Size of the samples (may be 0, in which case it is set by the first sample that is added)
+     * \param quantileCompression Compression parameter of the quantile sketch of each entry (see StreamingQuantileSketch).
+     * If this value is not positive, no quantiles are computed.
+     */
+    StreamingSampleStatistics( const int sampleSize = 0, const double quantileCompression = 100.0 );
+
+    //! Function to add a single sample
+    /*!
+     * Function to add a single sample
+     * \param sample Value of sample that is to be added
+     */
+    void addSample( const Eigen::VectorXd& sample );
+
+    //! Function to merge the statistics of another object into this object
+    /*!
+     * Function to merge the statistics of another object into this object, after which this object represents the union of
+     * the samples of both
+     * \param otherStatistics Object of which the statistics are to be merged into this object
+     */
+    void merge( const StreamingSampleStatistics& otherStatistics );
+
+    //! Function to combine the statistics computed by the processes of a group
+    /*!
+     * Function to combine the statistics computed by the processes of a group, after which the statistics are identical on
+     * all processes, and represent the union of the samples of all processes. The contributions of the processes are merged
+     * in order of the process index, so that the result is independent of the communication pattern.
+     * \param processCommunicator Object used for the communication between the processes
+     */
+    void mergeOverProcesses( const std::shared_ptr< utilities::ProcessCommunicator > processCommunicator );
+
+    //! Function to remove all samples, retaining the sample size and quantile settings
+    void reset( )
+    {
+        resetSampleSize( sampleSize_ );
+    }
+
+    //! Function to retrieve the number of samples that have been added
+    int getNumberOfSamples( ) const
+    {
+        return numberOfSamples_;
+    }
+
+    //! Function to retrieve the size of the samples
+    int getSampleSize( ) const
+    {
+        return sampleSize_;
+    }
+
+    //! Function to retrieve the sample mean
+    Eigen::VectorXd getMean( ) const
+    {
+        return mean_;
+    }
+
+    //! Function to retrieve the (unbiased) sample covariance
+    /*!
+     * Function to retrieve the (unbiased) sample covariance, normalized by the number of samples minus one (consistent with
+     * computeSampleVariance)
+     * \return Sample covariance (NaN if fewer than two samples are added)
+     */
+    Eigen::MatrixXd getCovariance( ) const;
+
+    //! Function to retrieve the (unbiased) sample variance of each entry
+    Eigen::VectorXd getVariance( ) const
+    {
+        return getCovariance( ).diagonal( );
+    }
+
+    //! Function to retrieve the minimum value of each entry
+    Eigen::VectorXd getMinimum( ) const
+    {
+        return minimum_;
+    }
+
+    //! Function to retrieve the maximum value of each entry
+    Eigen::VectorXd getMaximum( ) const
+    {
+        return maximum_;
+    }
+
+    //! Function to retrieve an estimate of a quantile of a single entry
+    /*!
+     * Function to retrieve an estimate of a quantile of a single entry (see StreamingQuantileSketch::getQuantile)
+     * \param entryIndex Index of the entry for which the quantile is to be estimated
+     * \param quantile Quantile that is to be estimated (between 0 and 1)
+     * \return Estimate of the quantile
+     */
+    double getQuantile( const int entryIndex, const double quantile ) const;
+
+    //! Function to retrieve an estimate of a quantile of all entries
+    Eigen::VectorXd getQuantiles( const double quantile ) const;
+
+    //! Function to append the contents of the object to a list of values (for communication between processes)
+    void serialize( std::vector< double >& data ) const;
+
+    //! Function to reset the contents of the object from a list of values, as created by serialize
+    /*!
+     * Function to reset the contents of the object from a list of values, as created by serialize
+     * \param data List of values from which the object is to be read
+     * \param currentIndex Index in data from which the object is to be read, incremented by the number of values read
+     */
+    void deserialize( const std::vector< double >& data, int& currentIndex );
+
+private:
+
+    //! Function to set the size of the samples, and reset the statistics
+    void resetSampleSize( const int sampleSize );
+
+    //! Size of the samples
+    int sampleSize_;
+
+    //! Compression parameter of the quantile sketches (no quantiles are computed if not positive)
+    double quantileCompression_;
+
+    //! Number of samples that have been added
+    int numberOfSamples_;
+
+    //! Sample mean
+    Eigen::VectorXd mean_;
+
+    //! Sum of the outer products of the deviations of the samples from the mean
+    Eigen::MatrixXd sumOfSquaredDeviations_;
+
+    //! Minimum value of each entry
+    Eigen::VectorXd minimum_;
+
+    //! Maximum value of each entry
+    Eigen::VectorXd maximum_;
+
+    //! Quantile sketch of each entry
+    std::vector< StreamingQuantileSketch > quantileSketches_;
+};
+
+//! Function to combine a list of statistics computed by the processes of a group
+/*!
+ * Function to combine a list of statistics computed by the processes of a group (see
+ * StreamingSampleStatistics::mergeOverProcesses), using a single exchange of data for the full list. All processes must
+ * provide a list of the same length.
+ * \param statistics List of statistics that are to be combined
+ * \param processCommunicator Object used for the communication between the processes
+ */
+void mergeStatisticsOverProcesses( std::vector< StreamingSampleStatistics >& statistics,
+                                   const std::shared_ptr< utilities::ProcessCommunicator > processCommunicator );
+
+} // namespace statistics
+
+} // namespace tudat
+
+#endif // TUDAT_STREAMING_STATISTICS_H
@@ -44,6 +44,7 @@
 //#include "tudat/astro/reference_frames/dependentOrientationCalculator.h"
 #include "tudat/astro/system_models/vehicleSystems.h"
 #include "tudat/basics/basicTypedefs.h"
+#include "tudat/basics/memoryFootprint.h"
 #include "tudat/math/basic/numericalDerivative.h"
 
 namespace tudat {
@@ -258,6 +259,8 @@ class RigidBodyProperties {
         isBodyInPropagation_ = isBodyInPropagation;
     }
 
+    //! Function to create a copy of this object, with its own current mass properties (see SystemOfBodies::clone)
+    virtual std::shared_ptr< RigidBodyProperties > clone( ) const = 0;
 
 protected:
     
@@ -378,6 +381,11 @@ public:
         }
     }
 
+    virtual std::shared_ptr< RigidBodyProperties > clone( ) const
+    {
+        return std::make_shared< TimeDependentRigidBodyProperties >( *this );
+    }
+
 protected:
 
     std::function< double( const double ) > massFunction_;
@@ -429,6 +437,11 @@ public:
         isMassComputed_ = true;
     }
 
+    virtual std::shared_ptr< RigidBodyProperties > clone( ) const
+    {
+        return std::make_shared< MassDependentRigidBodyProperties >( *this );
+    }
+
 protected:
 
     std::function< Eigen::Vector3d( const double ) > centerOfMassFunction_;
@@ -510,6 +523,11 @@ public:
         isBodyInPropagation_ = isBodyInPropagation;
     }
 
+    virtual std::shared_ptr< RigidBodyProperties > clone( ) const
+    {
+        return std::make_shared< FromGravityFieldRigidBodyProperties >( *this );
+    }
+
 protected:
 
     const std::shared_ptr< gravitation::GravityFieldModel > gravityFieldModel_;
@@ -539,6 +557,8 @@ public:
     Body( const Eigen::Vector6d& state =
             Eigen::Vector6d::Zero( ) )
         : bodyIsGlobalFrameOrigin_( -1 ), currentState_( state ), timeOfCurrentState_( TUDAT_NAN ),
+          isCurrentStateInLongPrecision_( false ),
+          numberOfEphemerisStateRequests_( 0 ), numberOfEphemerisStateCacheHits_( 0 ),
           ephemerisFrameToBaseFrame_( std::make_shared< BaseStateInterfaceImplementation< double, double > >(
                                           "", [ = ]( const double ){ return Eigen::Vector6d::Zero( ); } ) ),
           currentRotationToLocalFrame_( Eigen::Quaterniond( Eigen::Matrix3d::Identity( ) ) ),
@@ -546,6 +566,9 @@ public:
           currentRotationToLocalFrameDerivative_( Eigen::Matrix3d::Zero( ) ),
           currentAngularVelocityVectorInGlobalFrame_( Eigen::Vector3d::Zero( ) ),
           currentAngularVelocityVectorInLocalFrame_( Eigen::Vector3d::Zero( ) ),
+          timeOfCurrentRotation_( TUDAT_NAN ), timeOfCurrentRotationalState_( TUDAT_NAN ),
+          rotationModelModificationsOfCurrentRotation_( 0 ),
+          numberOfRotationalStateRequests_( 0 ), numberOfRotationalStateCacheHits_( 0 ),
           bodyName_( "unnamed_body" )
     {
         currentLongState_ = currentState_.cast< long double >( );
@@ -598,6 +621,7 @@ public:
     void setState(const Eigen::Vector6d &state)
     {
         currentState_ = state;
+        timeOfCurrentState_ = Time( TUDAT_NAN );
         isStateSet_ = true;
     }
 
@@ -611,6 +635,7 @@ public:
     void setLongState(const Eigen::Matrix<long double, 6, 1> &longState) {
         currentLongState_ = longState;
         currentState_ = longState.cast<double>();
+        timeOfCurrentState_ = Time( TUDAT_NAN );
         isStateSet_ = true;
 
     }
@@ -628,13 +653,17 @@ public:
     /*!
      * Templated function to set the current state of the body from its ephemeris and
      * global-to-ephemeris-frame function. It sets both the currentState_ and currentLongState_ variables. F
-     * FUndamental coputation is done on state with StateScalarType precision as a function of TimeType time
+     * FUndamental coputation is done on state with StateScalarType precision as a function of TimeType time.
+     * The state is only recomputed if it was not yet computed at the requested time, or if it was computed with lower
+     * precision than requested.
      * \param time Time at which the global state is to be set.
      */
     template<typename StateScalarType = double, typename TimeType = double>
     void setStateFromEphemeris(const TimeType &time)
     {
-        if (!(static_cast<Time>(time) == timeOfCurrentState_))
+        numberOfEphemerisStateRequests_++;
+        const bool isLongPrecisionRequested = ( sizeof( StateScalarType ) != 8 );
+        if (!(static_cast<Time>(time) == timeOfCurrentState_) || ( isLongPrecisionRequested && !isCurrentStateInLongPrecision_ ) )
         {
             if( bodyEphemeris_ == nullptr )
             {
@@ -681,6 +710,11 @@ public:
             }
 
             timeOfCurrentState_ = static_cast<TimeType>(time);
+            isCurrentStateInLongPrecision_ = isLongPrecisionRequested;
+        }
+        else
+        {
+            numberOfEphemerisStateCacheHits_++;
         }
         isStateSet_ = true;
     }
@@ -849,9 +883,16 @@ public:
      */
     void setCurrentRotationToLocalFrameFromEphemeris( const double time )
     {
+        numberOfRotationalStateRequests_++;
         if( rotationalEphemeris_!= nullptr )
         {
+            if( static_cast< Time >( time ) == timeOfCurrentRotation_ && isCurrentRotationFromUnmodifiedRotationModel( ) )
+            {
+                numberOfRotationalStateCacheHits_++;
+                return;
+            }
             currentRotationToLocalFrame_ = rotationalEphemeris_->getRotationToTargetFrame( time );
+            rotationModelModificationsOfCurrentRotation_ = rotationalEphemeris_->getNumberOfModifications( );
         }
 //        else if( dependentOrientationCalculator_ != nullptr )
 //        {
@@ -863,6 +904,8 @@ public:
                         "Error, no rotation model found in Body::setCurrentRotationToLocalFrameFromEphemeris" );
         }
         currentRotationToGlobalFrame_ = currentRotationToLocalFrame_.inverse( );
+        timeOfCurrentRotation_ = static_cast< Time >( time );
+        timeOfCurrentRotationalState_ = Time( TUDAT_NAN );
         isRotationSet_ = true;
     }
 
@@ -870,17 +913,25 @@ public:
     /*!
      * Function to set the full rotational state at (rotation from global to body-fixed frame
      * rotation matrix derivative from global to body-fixed frame and angular velocity vector in the
-     * global frame) at given time, using the rotationalEphemeris_ member object.
+     * global frame) at given time, using the rotationalEphemeris_ member object. If the rotation model depends only on
+     * time, the rotational state is only recomputed if it was not yet computed at the requested time.
      * \param time Time at which the angular velocity vector in the global frame is to be retrieved.
      */
     template< typename TimeType >
     void setCurrentRotationalStateToLocalFrameFromEphemeris( const TimeType time )
     {
+        numberOfRotationalStateRequests_++;
         if( rotationalEphemeris_ != nullptr )
         {
+            if( static_cast< Time >( time ) == timeOfCurrentRotationalState_ && isCurrentRotationFromUnmodifiedRotationModel( ) )
+            {
+                numberOfRotationalStateCacheHits_++;
+                return;
+            }
             rotationalEphemeris_->getFullRotationalQuantitiesToTargetFrameTemplated< TimeType >(
                         currentRotationToLocalFrame_, currentRotationToLocalFrameDerivative_,
                         currentAngularVelocityVectorInGlobalFrame_, time );
+            rotationModelModificationsOfCurrentRotation_ = rotationalEphemeris_->getNumberOfModifications( );
             currentAngularVelocityVectorInLocalFrame_ = currentRotationToLocalFrame_ * currentAngularVelocityVectorInGlobalFrame_;
         }
 //        else if( dependentOrientationCalculator_ != nullptr )
@@ -896,6 +947,8 @@ public:
                         "Error, no rotationalEphemeris_ found in Body::setCurrentRotationalStateToLocalFrameFromEphemeris" );
         }
         currentRotationToGlobalFrame_ = currentRotationToLocalFrame_.inverse( );
+        timeOfCurrentRotation_ = static_cast< Time >( time );
+        timeOfCurrentRotationalState_ = static_cast< Time >( time );
         isRotationSet_ = true;
 
     }
@@ -926,6 +979,8 @@ public:
     currentRotationToLocalFrameDerivative_ = linear_algebra::getCrossProductMatrix(
                                                  currentRotationalStateFromLocalToGlobalFrame.block< 3, 1 >(4, 0 ))
         * currentRotationMatrixToLocalFrame;
+    timeOfCurrentRotation_ = Time( TUDAT_NAN );
+    timeOfCurrentRotationalState_ = Time( TUDAT_NAN );
     isRotationSet_ = true;
 
   }
@@ -1152,6 +1207,27 @@ public:
     void setAtmosphereModel(
             const std::shared_ptr<aerodynamics::AtmosphereModel> atmosphereModel) {
         atmosphereModel_ = atmosphereModel;
+        atmosphereModelCreationFunction_ = nullptr;
+    }
+
+    //! Function to set the function that creates the atmosphere model of the body when it is first retrieved.
+    /*!
+     *  Function to set the function that creates the atmosphere model of the body when it is first retrieved (by
+     *  getAtmosphereModel), so that the atmosphere model is not created if it is never used. Note that the creation is not
+     *  synchronized: the atmosphere model must be retrieved before the body is used from multiple threads.
+     *  \param atmosphereModelCreationFunction Function that creates the atmosphere model of the body.
+     */
+    void setAtmosphereModelCreationFunction(
+            const std::function< std::shared_ptr< aerodynamics::AtmosphereModel >( ) > atmosphereModelCreationFunction )
+    {
+        atmosphereModel_ = nullptr;
+        atmosphereModelCreationFunction_ = atmosphereModelCreationFunction;
+    }
+
+    //! Function to check whether the atmosphere model is yet to be created upon first retrieval
+    bool isAtmosphereModelCreationPending( )
+    {
+        return atmosphereModelCreationFunction_ != nullptr;
     }
 
     //! Function to set the rotation model of the body.
@@ -1165,6 +1241,8 @@ public:
 //            std::cerr << "Warning when setting rotational ephemeris, dependentOrientationCalculator_ already found, NOT setting closure" << std::endl;
 //        }
         rotationalEphemeris_ = rotationalEphemeris;
+        timeOfCurrentRotation_ = Time( TUDAT_NAN );
+        timeOfCurrentRotationalState_ = Time( TUDAT_NAN );
     }
 
     //! Function to set the shape model of the body.
@@ -1324,6 +1402,11 @@ public:
      *  \return Atmosphere model of the body.
      */
     std::shared_ptr<aerodynamics::AtmosphereModel> getAtmosphereModel() {
+        if( atmosphereModelCreationFunction_ != nullptr )
+        {
+            atmosphereModel_ = atmosphereModelCreationFunction_( );
+            atmosphereModelCreationFunction_ = nullptr;
+        }
         return atmosphereModel_;
     }
 
@@ -1691,6 +1774,71 @@ public:
         return static_cast< double >( timeOfCurrentState_ );
     }
 
+    //! Function to indicate that the rotational state needs to be recomputed on next call to
+    //! setCurrentRotationalStateToLocalFrameFromEphemeris or setCurrentRotationToLocalFrameFromEphemeris.
+    /*!
+     * Function to indicate that the rotational state needs to be recomputed on next call to
+     * setCurrentRotationalStateToLocalFrameFromEphemeris or setCurrentRotationToLocalFrameFromEphemeris, and to reset the
+     * current time of the rotation model. To be called when the rotation model is modified (e.g. its parameters are
+     * reset).
+     */
+    void recomputeRotationalStateOnNextCall( )
+    {
+        timeOfCurrentRotation_ = Time( TUDAT_NAN );
+        timeOfCurrentRotationalState_ = Time( TUDAT_NAN );
+        if( rotationalEphemeris_ != nullptr )
+        {
+            rotationalEphemeris_->resetCurrentTime( );
+        }
+    }
+
+    //! Function to retrieve the number of calls to setStateFromEphemeris since the last reset of the statistics
+    unsigned int getNumberOfEphemerisStateRequests( )
+    {
+        return numberOfEphemerisStateRequests_;
+    }
+
+    //! Function to retrieve the number of calls to setStateFromEphemeris for which the state was already computed
+    /*!
+     * Function to retrieve the number of calls to setStateFromEphemeris (since the last reset of the statistics) for which
+     * the state was already computed at the requested time, so that the ephemeris did not need to be evaluated.
+     * \return Number of calls to setStateFromEphemeris that used the current (cached) state
+     */
+    unsigned int getNumberOfEphemerisStateCacheHits( )
+    {
+        return numberOfEphemerisStateCacheHits_;
+    }
+
+    //! Function to retrieve the number of calls to set the rotational state from the rotation model since the last reset
+    //! of the statistics
+    unsigned int getNumberOfRotationalStateRequests( )
+    {
+        return numberOfRotationalStateRequests_;
+    }
+
+    //! Function to retrieve the number of calls to set the rotational state from the rotation model for which the
+    //! rotational state was already computed
+    /*!
+     * Function to retrieve the number of calls to setCurrentRotationalStateToLocalFrameFromEphemeris and
+     * setCurrentRotationToLocalFrameFromEphemeris (since the last reset of the statistics) for which the rotational state
+     * was already computed at the requested time, so that the rotation model did not need to be evaluated.
+     * \return Number of calls to set the rotational state that used the current (cached) rotational state
+     */
+    unsigned int getNumberOfRotationalStateCacheHits( )
+    {
+        return numberOfRotationalStateCacheHits_;
+    }
+
+    //! Function to reset the statistics on the calls to setStateFromEphemeris, and to set the rotational state from the
+    //! rotation model
+    void resetEphemerisStateCacheStatistics( )
+    {
+        numberOfEphemerisStateRequests_ = 0;
+        numberOfEphemerisStateCacheHits_ = 0;
+        numberOfRotationalStateRequests_ = 0;
+        numberOfRotationalStateCacheHits_ = 0;
+    }
+
 
     //! Function to retrieve variable denoting whether this body is the global frame origin
     /*!
@@ -1723,10 +1871,36 @@ public:
 
     std::string getBodyName( ){ return bodyName_; }
 
+    //! Function to create a copy of this body, for use in a replica of the system of bodies (see SystemOfBodies::clone)
+    /*!
+     *  Function to create a copy of this body, for use in a replica of the system of bodies (see SystemOfBodies::clone).
+     *  The current state, orientation and mass properties are copied, environment models with per-evaluation state
+     *  (look-up state of tabulated ephemerides, current aerodynamic coefficients) are copied without copying their data,
+     *  and all other environment models are shared with the copy. Models that are bound to other bodies (flight
+     *  conditions, base frame state interface) are not copied, and are recreated from the replica. An exception is thrown
+     *  if the body contains a model that can neither be shared nor copied.
+     *  \return Copy of this body
+     */
+    std::shared_ptr< Body > clone( ) const;
+
     void setBodyName( const std::string bodyName ){ bodyName_ = bodyName; }
 
 protected:
 private:
+
+    //! Function to check whether the current rotation was computed by the current (unmodified) rotation model
+    /*!
+     *  Function to check whether the current rotation was computed by the rotation model, and may be reused at the same
+     *  epoch: the rotation model must depend only on time, and must not have been modified since the rotation was computed
+     *  (e.g. by an estimatable parameter changing its rotation rate).
+     *  \return True if the current rotation may be reused at the epoch at which it was computed
+     */
+    bool isCurrentRotationFromUnmodifiedRotationModel( )
+    {
+        return rotationalEphemeris_->isTimeDependentOnly( ) &&
+                ( rotationModelModificationsOfCurrentRotation_ == rotationalEphemeris_->getNumberOfModifications( ) );
+    }
+
     //! Variable denoting whether this body is the global frame origin (1 if true, 0 if false, -1 if not yet set)
     int bodyIsGlobalFrameOrigin_;
 
@@ -1745,6 +1919,15 @@ private:
     //! Time at which state was last set from ephemeris
     Time timeOfCurrentState_;
 
+    //! Boolean denoting whether the state at timeOfCurrentState_ was computed with long double precision
+    bool isCurrentStateInLongPrecision_;
+
+    //! Number of calls to setStateFromEphemeris since the last reset of the statistics
+    unsigned int numberOfEphemerisStateRequests_;
+
+    //! Number of calls to setStateFromEphemeris for which the state at the requested time was already computed
+    unsigned int numberOfEphemerisStateCacheHits_;
+
     //! Class returning the state of this body's ephemeris origin w.r.t. the global origin (as typically created by
     //! setGlobalFrameBodyEphemerides function).
     std::shared_ptr<BaseStateInterface> ephemerisFrameToBaseFrame_;
@@ -1761,6 +1944,22 @@ private:
     //! Current angular velocity vector for body's rotation, expressed in the body-fixed frame.
     Eigen::Vector3d currentAngularVelocityVectorInLocalFrame_;
 
+    //! Time at which the rotation was last set from the rotation model
+    Time timeOfCurrentRotation_;
+
+    //! Time at which the full rotational state (including its derivative) was last set from the rotation model
+    Time timeOfCurrentRotationalState_;
+
+    //! Number of modifications of the rotation model (see RotationalEphemeris::getNumberOfModifications) when the rotation
+    //! was last set from the rotation model
+    unsigned int rotationModelModificationsOfCurrentRotation_;
+
+    //! Number of calls to set the rotational state from the rotation model since the last reset of the statistics
+    unsigned int numberOfRotationalStateRequests_;
+
+    //! Number of calls to set the rotational state from the rotation model for which it was already computed
+    unsigned int numberOfRotationalStateCacheHits_;
+
 //    //! Mass of body (default set to zero, calculated from GravityFieldModel when it is set).
 //    double currentMass_;
 
@@ -1785,6 +1984,9 @@ private:
     //! Atmosphere model of body.
     std::shared_ptr<aerodynamics::AtmosphereModel> atmosphereModel_;
 
+    //! Function creating the atmosphere model of body upon its first retrieval (nullptr if none or already created).
+    std::function< std::shared_ptr< aerodynamics::AtmosphereModel >( ) > atmosphereModelCreationFunction_;
+
     //! Shape model of body.
     std::shared_ptr<basic_astrodynamics::BodyShapeModel> shapeModel_;
 
@@ -2175,6 +2377,29 @@ public:
         bodyMap_.erase( bodyName );
 
     }
+
+    //! Function to create a replica of the system of bodies, for instance for use in a separate thread
+    /*!
+     *  Function to create a replica of the system of bodies, for instance for use in a separate thread, without
+     *  recreating the environment models (see Body::clone). Each body of the replica is a new Body object, with a copy of
+     *  the mutable (per-evaluation) state of the original, while read-only data (gravity field coefficients, tabulated
+     *  data, shape models, etc.) is shared with the original by reference. The frame definitions of the replica are
+     *  processed, so that its bodies refer only to each other. Acceleration models, propagator settings, etc. are bound to
+     *  the bodies from which they are created, and must be created anew from the replica (e.g. using
+     *  createAccelerationModelsMap).
+     *  \return Replica of the system of bodies
+     */
+    SystemOfBodies clone( ) const;
+
+    //! Function to retrieve the (heap) memory held by the data-heavy environment models of the bodies
+    /*!
+     *  Function to retrieve the (heap) memory held by the data-heavy environment models of the bodies: tabulated
+     *  ephemerides (including integrated and multi-arc ephemerides) and spherical harmonic gravity field coefficients.
+     *  Coefficients that are shared between bodies (or between this object and its clones) are counted once.
+     *  \return Memory held by the environment models
+     */
+    utilities::MemoryFootprint getMemoryFootprint( ) const;
+
 private:
 
     std::string frameOrigin_;
@@ -2205,6 +2430,40 @@ std::string getGlobalFrameOrigin(const SystemOfBodies &bodies);
 void setAreBodiesInPropagation(const SystemOfBodies &bodies,
                                const bool areBodiesInPropagation);
 
+//! Function to check whether two sets of bodies share any Body object
+/*!
+ * Function to check whether two sets of bodies share any Body object (i.e. whether any of the Body pointers in the two
+ * sets are identical). Sets of bodies that do not share any Body object can be used concurrently in separate threads.
+ * Only the Body objects themselves are compared: environment models assigned to different Body objects (e.g. the same
+ * ephemeris object set for bodies in both sets) are not detected, and must be safe for concurrent use. State outside of
+ * the bodies is not considered either. In particular, all Spice-backed models use the single CSPICE kernel pool, which is
+ * not thread-safe. This is safe only because all calls to CSPICE are serialized (see
+ * spice_interface::getSpiceAccessMutex), so concurrently used sets of bodies with Spice-backed models contend for this
+ * mutex, and Spice kernels must not be loaded or cleared while the sets are in use.
+ * \param firstBodies First set of body objects
+ * \param secondBodies Second set of body objects
+ * \return True if any Body object is contained in both sets of bodies, false otherwise
+ */
+bool doSystemsOfBodiesShareBodies( const SystemOfBodies& firstBodies,
+                                   const SystemOfBodies& secondBodies );
+
+//! Function to reset the statistics on the reuse of the ephemeris states of all bodies
+/*!
+ * Function to reset the statistics on the reuse of the ephemeris states of all bodies (see
+ * Body::resetEphemerisStateCacheStatistics)
+ * \param bodies List of body objects.
+ */
+void resetEphemerisStateCacheStatistics( const SystemOfBodies& bodies );
+
+//! Function to print the statistics on the reuse of the ephemeris states of all bodies
+/*!
+ * Function to print, for each body for which the state has been set from its ephemeris since the last reset of the
+ * statistics, the number of requested states, and the number of requests for which the state at the requested time was
+ * already computed (so that all models using the state of the body at a given time share a single ephemeris evaluation)
+ * \param bodies List of body objects.
+ */
+void printEphemerisStateCacheStatistics( const SystemOfBodies& bodies );
+
 //! Function to compute the acceleration of a body, using its ephemeris and finite differences
 /*!
  *  Function to compute the acceleration of a body, using its ephemeris and 8th order finite difference and 100 s time step
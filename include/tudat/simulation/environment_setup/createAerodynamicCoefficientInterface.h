@@ -11,6 +11,7 @@
 #ifndef TUDAT_CREATEAERODYNAMICCOEFFICIENTINTERFACE_H
 #define TUDAT_CREATEAERODYNAMICCOEFFICIENTINTERFACE_H
 
+#include <cstdint>
 #include <memory>
 
 
@@ -20,6 +21,7 @@
 #include "tudat/simulation/environment_setup/createAerodynamicControlSurfaces.h"
 #include "tudat/math/interpolators/multiLinearInterpolator.h"
 #include "tudat/math/interpolators/createInterpolator.h"
+#include "tudat/io/binaryCoefficientTable.h"
 #include "tudat/paths.hpp"
 
 namespace tudat
@@ -1062,6 +1064,78 @@ private:
 
 };
 
+//  Object for setting aerodynamic coefficients from a binary coefficient table.
+/*
+ *  Object for setting aerodynamic coefficients from a binary coefficient table (see input_output::BinaryCoefficientTable),
+ *  with 6 components per entry (force coefficients, followed by moment coefficients), as created by
+ *  input_output::convertAerodynamicCoefficientFilesToBinaryTable. The coefficients are not copied into the interpolator,
+ *  but are interpolated directly from the memory-mapped table, which is shared by all coefficient interfaces (in any
+ *  SystemOfBodies) created from it.
+ */
+class BinaryTabulatedAerodynamicCoefficientSettings: public AerodynamicCoefficientSettings
+{
+public:
+
+    //  Constructor, sets properties of aerodynamic coefficients.
+    /*
+     *  Constructor, sets properties of aerodynamic coefficients.
+     *  \param coefficientTable Table containing force and moment coefficients, and independent variables.
+     *  \param referenceLength Reference length with which aerodynamic moments are non-dimensionalized.
+     *  \param referenceArea Reference area with which aerodynamic forces and moments are non-dimensionalized.
+     *  \param momentReferencePoint Point w.r.t. aerodynamic moment is calculated
+     *  \param independentVariableNames Vector with identifiers the physical meaning of each
+     *  independent variable of the aerodynamic coefficients.
+     *  \param forceCoefficientsFrame Frame in which the force coefficients are defined.
+     *  \param momentCoefficientsFrame Frame in which the moment coefficients are defined.
+     *  \param addForceContributionToMoments Boolean denoting whether the moment due to the force about the moment
+     *  reference point is to be added to the moment coefficients.
+     *  \param interpolatorSettings Pointer to an interpolator settings object (must be of type multi_linear_interpolator).
+     */
+    BinaryTabulatedAerodynamicCoefficientSettings(
+            const std::shared_ptr< input_output::BinaryCoefficientTable > coefficientTable,
+            const double referenceLength,
+            const double referenceArea,
+            const Eigen::Vector3d& momentReferencePoint,
+            const std::vector< aerodynamics::AerodynamicCoefficientsIndependentVariables > independentVariableNames,
+            const aerodynamics::AerodynamicCoefficientFrames forceCoefficientsFrame = aerodynamics::negative_aerodynamic_frame_coefficients,
+            const aerodynamics::AerodynamicCoefficientFrames momentCoefficientsFrame = aerodynamics::body_fixed_frame_coefficients,
+            const bool addForceContributionToMoments = false,
+            const std::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings = nullptr ) :
+        AerodynamicCoefficientSettings(
+            tabulated_coefficients, referenceLength, referenceArea, momentReferencePoint,
+            independentVariableNames, forceCoefficientsFrame, momentCoefficientsFrame, addForceContributionToMoments,
+            interpolatorSettings ),
+        coefficientTable_( coefficientTable )
+    {
+        if( coefficientTable_->getNumberOfComponents( ) != 6 )
+        {
+            throw std::runtime_error( "Error when creating binary tabulated aerodynamic coefficient settings from " +
+                                      coefficientTable_->getFileName( ) + ", expected 6 components per entry, found " +
+                                      std::to_string( coefficientTable_->getNumberOfComponents( ) ) );
+        }
+
+        if( coefficientTable_->getNumberOfDimensions( ) != independentVariableNames.size( ) )
+        {
+            throw std::runtime_error( "Error when creating binary tabulated aerodynamic coefficient settings from " +
+                                      coefficientTable_->getFileName( ) + ", number of independent variables (" +
+                                      std::to_string( coefficientTable_->getNumberOfDimensions( ) ) +
+                                      ") is inconsistent with number of independent variable names (" +
+                                      std::to_string( independentVariableNames.size( ) ) + ")" );
+        }
+    }
+
+    //  Function to return the table containing the coefficients.
+    std::shared_ptr< input_output::BinaryCoefficientTable > getCoefficientTable( )
+    {
+        return coefficientTable_;
+    }
+
+private:
+
+    //  Table containing the force and moment coefficients, and independent variables.
+    std::shared_ptr< input_output::BinaryCoefficientTable > coefficientTable_;
+};
+
 // 1-dimensional case
 //! @get_docstring(oneDimensionalTabulatedAerodynamicCoefficientSettings)
 inline std::shared_ptr< AerodynamicCoefficientSettings > oneDimensionalTabulatedAerodynamicCoefficientSettings(
@@ -1353,6 +1427,32 @@ readTabulatedAerodynamicCoefficientsFromFiles(
         const aerodynamics::AerodynamicCoefficientFrames forceCoefficientFrame = aerodynamics::negative_aerodynamic_frame_coefficients,
         const std::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings = nullptr );
 
+//  Function to create aerodynamic coefficient settings from a binary coefficient table file
+/*
+ *  Function to create aerodynamic coefficient settings from a binary coefficient table file, as created by
+ *  input_output::convertAerodynamicCoefficientFilesToBinaryTable. The file is memory-mapped, and shared by all settings
+ *  (and coefficient interfaces) created from the same file in the process (see input_output::loadBinaryCoefficientTable).
+ *  \param binaryFileName Name (including path) of the binary coefficient table file
+ *  \param referenceLength Reference length with which aerodynamic moments are non-dimensionalized.
+ *  \param referenceArea Reference area with which aerodynamic forces and moments are non-dimensionalized.
+ *  \param independentVariableNames Physical meaning of the independent variables of the aerodynamic coefficients
+ *  \param forceCoefficientFrame Frame in which the force coefficients are defined.
+ *  \param momentCoefficientFrame Frame in which the moment coefficients are defined.
+ *  \param momentReferencePoint Point w.r.t. aerodynamic moment is calculated (if defined, the moment due to the force
+ *  is added to the moment coefficients).
+ *  \param interpolatorSettings Pointer to an interpolator settings object (must be of type multi_linear_interpolator).
+ *  \return Settings for creation of aerodynamic coefficient interface, based on the table in the file
+ */
+std::shared_ptr< AerodynamicCoefficientSettings > readTabulatedAerodynamicCoefficientsFromBinaryFile(
+        const std::string& binaryFileName,
+        const double referenceLength,
+        const double referenceArea,
+        const std::vector< aerodynamics::AerodynamicCoefficientsIndependentVariables > independentVariableNames,
+        const aerodynamics::AerodynamicCoefficientFrames forceCoefficientFrame = aerodynamics::negative_aerodynamic_frame_coefficients,
+        const aerodynamics::AerodynamicCoefficientFrames momentCoefficientFrame = aerodynamics::body_fixed_frame_coefficients,
+        const Eigen::Vector3d& momentReferencePoint = Eigen::Vector3d::Constant( TUDAT_NAN ),
+        const std::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings = nullptr );
+
 //  Function to create an aerodynamic coefficient interface containing constant coefficients.
 /*  
  *  Function to create an aerodynamic coefficient interface containing constant coefficients,
@@ -1453,36 +1553,29 @@ createTabulatedCoefficientAerodynamicCoefficientInterface(
                                   "inconsistent variable name vector dimensioning" );
     }
 
-    // Create interpolators for coefficients.
-    std::shared_ptr< MultiDimensionalInterpolator < double, Eigen::Vector3d, NumberOfDimensions > > forceInterpolator;
-    std::shared_ptr< MultiDimensionalInterpolator< double, Eigen::Vector3d, NumberOfDimensions > > momentInterpolator;
+    // Create single interpolator for concatenated force and moment coefficients, so that the lookup and interpolation
+    // weights are computed once per evaluation.
+    boost::multi_array< Eigen::Vector6d, static_cast< size_t >( NumberOfDimensions ) > coefficients =
+            concatenateForceAndMomentCoefficientArrays< NumberOfDimensions >( forceCoefficients, momentCoefficients );
+    std::shared_ptr< MultiDimensionalInterpolator< double, Eigen::Vector6d, NumberOfDimensions > > coefficientInterpolator;
     if ( interpolatorSettings == nullptr )
     {
-        forceInterpolator = createMultiDimensionalInterpolator< double, Eigen::Vector3d, NumberOfDimensions >(
-                    independentVariables, forceCoefficients,
-                    std::make_shared< InterpolatorSettings >( multi_linear_interpolator, huntingAlgorithm, false,
-                                                              std::vector< BoundaryInterpolationType >( NumberOfDimensions,
-                                                                                                        use_boundary_value ) ) );
-        momentInterpolator = createMultiDimensionalInterpolator< double, Eigen::Vector3d, NumberOfDimensions >(
-                    independentVariables, momentCoefficients,
+        coefficientInterpolator = createMultiDimensionalInterpolator< double, Eigen::Vector6d, NumberOfDimensions >(
+                    independentVariables, coefficients,
                     std::make_shared< InterpolatorSettings >( multi_linear_interpolator, huntingAlgorithm, false,
                                                               std::vector< BoundaryInterpolationType >( NumberOfDimensions,
                                                                                                         use_boundary_value ) ) );
     }
     else
     {
-        forceInterpolator = createMultiDimensionalInterpolator< double, Eigen::Vector3d, NumberOfDimensions >(
-                    independentVariables, forceCoefficients, interpolatorSettings );
-        momentInterpolator = createMultiDimensionalInterpolator< double, Eigen::Vector3d, NumberOfDimensions >(
-                    independentVariables, momentCoefficients, interpolatorSettings );
+        coefficientInterpolator = createMultiDimensionalInterpolator< double, Eigen::Vector6d, NumberOfDimensions >(
+                    independentVariables, coefficients, interpolatorSettings );
     }
 
     // Create aerodynamic coefficient interface.
     return std::make_shared< aerodynamics::CustomAerodynamicCoefficientInterface >(
-                std::bind( &MultiDimensionalInterpolator< double, Eigen::Vector3d, NumberOfDimensions >::interpolate,
-                           forceInterpolator, std::placeholders::_1 ),
-                std::bind( &MultiDimensionalInterpolator< double, Eigen::Vector3d, NumberOfDimensions >::interpolate,
-                           momentInterpolator, std::placeholders::_1 ),
+                std::bind( &MultiDimensionalInterpolator< double, Eigen::Vector6d, NumberOfDimensions >::interpolate,
+                           coefficientInterpolator, std::placeholders::_1 ),
                 referenceLength, referenceArea, momentReferencePoint,
                 independentVariableNames,
                 forceCoefficientsFrame, momentCoefficientsFrame );
@@ -1544,6 +1637,110 @@ createTabulatedCoefficientAerodynamicCoefficientInterface(
     }
 }
 
+//  Factory function for aerodynamic coefficient interface from binary tabulated coefficient settings (N-D).
+/*
+ *  Factory function for aerodynamic coefficient interface from binary tabulated coefficient settings, with N
+ *  independent variables. The force and moment coefficients are interpolated by a single multi-linear interpolator,
+ *  directly from the memory-mapped table (which is retained by the interpolator). If the coefficients in the table are
+ *  not sufficiently aligned for direct access, they are copied into the interpolator instead.
+ *  \param coefficientSettings Settings for aerodynamic coefficient interface.
+ *  \param body Name of body for which coefficient interface is to be made.
+ *  \return Tabulated aerodynamic coefficient interface pointer.
+ */
+template< unsigned int NumberOfDimensions >
+std::shared_ptr< aerodynamics::AerodynamicCoefficientInterface >
+createBinaryTabulatedCoefficientAerodynamicCoefficientInterface(
+        const std::shared_ptr< BinaryTabulatedAerodynamicCoefficientSettings > coefficientSettings,
+        const std::string& body )
+{
+    using namespace tudat::interpolators;
+
+    std::shared_ptr< input_output::BinaryCoefficientTable > coefficientTable = coefficientSettings->getCoefficientTable( );
+    if( coefficientTable->getNumberOfDimensions( ) != NumberOfDimensions )
+    {
+        throw std::runtime_error( "Error, expected binary tabulated aerodynamic coefficients of size " +
+                                  std::to_string( NumberOfDimensions ) + " for body " + body );
+    }
+
+    // Retrieve interpolation settings
+    std::shared_ptr< InterpolatorSettings > interpolatorSettings = coefficientSettings->getInterpolatorSettings( );
+    if( interpolatorSettings == nullptr )
+    {
+        interpolatorSettings = std::make_shared< InterpolatorSettings >(
+                    multi_linear_interpolator, huntingAlgorithm, false,
+                    std::vector< BoundaryInterpolationType >( NumberOfDimensions, use_boundary_value ) );
+    }
+    else if( interpolatorSettings->getInterpolatorType( ) != multi_linear_interpolator )
+    {
+        throw std::runtime_error( "Error when creating binary tabulated aerodynamic coefficients for body " + body +
+                                  ", only multi-linear interpolation is supported" );
+    }
+
+    std::vector< BoundaryInterpolationType > boundaryHandling = interpolatorSettings->getBoundaryHandling( );
+    if( boundaryHandling.empty( ) )
+    {
+        boundaryHandling = std::vector< BoundaryInterpolationType >( NumberOfDimensions, extrapolate_at_boundary );
+    }
+    else if( boundaryHandling.size( ) != NumberOfDimensions )
+    {
+        throw std::runtime_error( "Error when creating binary tabulated aerodynamic coefficients for body " + body +
+                                  ", the number of boundary handling methods does not match the number of dimensions" );
+    }
+
+    // Create interpolator, directly using the table data if possible.
+    std::shared_ptr< MultiDimensionalInterpolator< double, Eigen::Vector6d, NumberOfDimensions > > coefficientInterpolator;
+    const double* coefficients = coefficientTable->getCoefficients( );
+    if( reinterpret_cast< std::uintptr_t >( coefficients ) % alignof( Eigen::Vector6d ) == 0 )
+    {
+        coefficientInterpolator = std::make_shared< MultiLinearInterpolator< double, Eigen::Vector6d, NumberOfDimensions > >(
+                    coefficientTable->getIndependentVariables( ),
+                    std::shared_ptr< const Eigen::Vector6d >(
+                        coefficientTable, reinterpret_cast< const Eigen::Vector6d* >( coefficients ) ),
+                    interpolatorSettings->getSelectedLookupScheme( ), boundaryHandling );
+    }
+    else
+    {
+        std::vector< size_t > tableShape;
+        for( unsigned int i = 0; i < NumberOfDimensions; i++ )
+        {
+            tableShape.push_back( coefficientTable->getIndependentVariables( ).at( i ).size( ) );
+        }
+
+        boost::multi_array< Eigen::Vector6d, static_cast< size_t >( NumberOfDimensions ) > coefficientArray;
+        coefficientArray.resize( tableShape );
+        for( unsigned int i = 0; i < coefficientArray.num_elements( ); i++ )
+        {
+            coefficientArray.data( )[ i ] = Eigen::Map< const Eigen::Vector6d >( coefficients + 6 * i );
+        }
+        coefficientInterpolator = std::make_shared< MultiLinearInterpolator< double, Eigen::Vector6d, NumberOfDimensions > >(
+                    coefficientTable->getIndependentVariables( ), coefficientArray,
+                    interpolatorSettings->getSelectedLookupScheme( ), boundaryHandling );
+    }
+
+    // Create aerodynamic coefficient interface.
+    return std::make_shared< aerodynamics::CustomAerodynamicCoefficientInterface >(
+                std::bind( &MultiDimensionalInterpolator< double, Eigen::Vector6d, NumberOfDimensions >::interpolate,
+                           coefficientInterpolator, std::placeholders::_1 ),
+                coefficientSettings->getReferenceLength( ), coefficientSettings->getReferenceArea( ),
+                coefficientSettings->getMomentReferencePoint( ),
+                coefficientSettings->getIndependentVariableNames( ),
+                coefficientSettings->getForceCoefficientsFrame( ), coefficientSettings->getMomentCoefficientsFrame( ) );
+}
+
+//  Factory function for aerodynamic coefficient interface from binary tabulated coefficient settings.
+/*
+ *  Factory function for aerodynamic coefficient interface from binary tabulated coefficient settings, calling the
+ *  templated createBinaryTabulatedCoefficientAerodynamicCoefficientInterface for the number of independent variables of
+ *  the table.
+ *  \param coefficientSettings Settings for aerodynamic coefficient interface.
+ *  \param body Name of body for which coefficient interface is to be made.
+ *  \return Tabulated aerodynamic coefficient interface pointer.
+ */
+std::shared_ptr< aerodynamics::AerodynamicCoefficientInterface >
+createBinaryTabulatedCoefficientAerodynamicCoefficientInterface(
+        const std::shared_ptr< BinaryTabulatedAerodynamicCoefficientSettings > coefficientSettings,
+        const std::string& body );
+
 std::shared_ptr< aerodynamics::AerodynamicMomentContributionInterface > createMomentContributionInterface(
     const aerodynamics::AerodynamicCoefficientFrames forceCoefficientFrame,
     const aerodynamics::AerodynamicCoefficientFrames momentCoefficientFrame,
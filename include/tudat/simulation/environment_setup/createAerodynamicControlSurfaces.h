@@ -11,6 +11,7 @@
 #ifndef TUDAT_CREATEAERODYNAMICCONTROLSURFACES_H
 #define TUDAT_CREATEAERODYNAMICCONTROLSURFACES_H
 
+#include <algorithm>
 #include <vector>
 
 #include <memory>
@@ -374,6 +375,36 @@ readTabulatedControlIncrementAerodynamicCoefficientsFromFiles(
         const std::map< int, std::string > forceCoefficientFiles,
         const std::vector< aerodynamics::AerodynamicCoefficientsIndependentVariables > independentVariableNames );
 
+//! Function to concatenate multi-arrays of force and moment coefficients into a single multi-array of 6D vectors.
+/*!
+ *  Function to concatenate multi-arrays of force and moment coefficients into a single multi-array of 6D vectors, with
+ *  the force coefficients as the first three and the moment coefficients as the last three entries.
+ *  \param forceCoefficients Values of force coefficients at the tabulated independent variables.
+ *  \param momentCoefficients Values of moment coefficients at the tabulated independent variables (same shape as
+ *  forceCoefficients).
+ *  \return Concatenated force and moment coefficients.
+ */
+template< unsigned int NumberOfDimensions >
+boost::multi_array< Eigen::Vector6d, static_cast< size_t >( NumberOfDimensions ) > concatenateForceAndMomentCoefficientArrays(
+        const boost::multi_array< Eigen::Vector3d, static_cast< size_t >( NumberOfDimensions ) >& forceCoefficients,
+        const boost::multi_array< Eigen::Vector3d, static_cast< size_t >( NumberOfDimensions ) >& momentCoefficients )
+{
+    if( !std::equal( forceCoefficients.shape( ), forceCoefficients.shape( ) + NumberOfDimensions,
+                     momentCoefficients.shape( ) ) )
+    {
+        throw std::runtime_error( "Error when concatenating aerodynamic coefficients, "
+                                  "force and moment coefficients have inconsistent dimensions" );
+    }
+
+    boost::multi_array< Eigen::Vector6d, static_cast< size_t >( NumberOfDimensions ) > coefficients(
+                std::vector< size_t >( forceCoefficients.shape( ), forceCoefficients.shape( ) + NumberOfDimensions ) );
+    for( size_t i = 0; i < forceCoefficients.num_elements( ); i++ )
+    {
+        coefficients.data( )[ i ] << forceCoefficients.data( )[ i ], momentCoefficients.data( )[ i ];
+    }
+    return coefficients;
+}
+
 //! Function to create control surface aerodynamic coefficient settings from user-defined coefficients.
 /*!
  * Function to create control surface aerodynamic coefficient settings from crom user-defined coefficients.
@@ -410,26 +441,19 @@ createTabulatedControlSurfaceIncrementAerodynamicCoefficientInterface(
 
     }
 
-    // Create interpolators for coefficients.
+    // Create single interpolator for concatenated force and moment coefficients.
     std::shared_ptr< interpolators::MultiLinearInterpolator
-            < double, Eigen::Vector3d, NumberOfDimensions > > forceInterpolator =
+            < double, Eigen::Vector6d, NumberOfDimensions > > coefficientInterpolator =
             std::make_shared< interpolators::MultiLinearInterpolator
-            < double, Eigen::Vector3d, NumberOfDimensions > >(
-                independentVariables, forceCoefficients );
-    std::shared_ptr< interpolators::MultiLinearInterpolator
-            < double, Eigen::Vector3d, NumberOfDimensions > > momentInterpolator =
-            std::make_shared< interpolators::MultiLinearInterpolator
-            < double, Eigen::Vector3d, NumberOfDimensions > >(
-                independentVariables, momentCoefficients );
+            < double, Eigen::Vector6d, NumberOfDimensions > >(
+                independentVariables,
+                concatenateForceAndMomentCoefficientArrays< NumberOfDimensions >( forceCoefficients, momentCoefficients ) );
 
     // Create aerodynamic coefficient interface.
     return  std::make_shared< aerodynamics::CustomControlSurfaceIncrementAerodynamicInterface >(
                 std::bind( &interpolators::MultiLinearInterpolator
-                             < double, Eigen::Vector3d, NumberOfDimensions >::interpolate,
-                             forceInterpolator, std::placeholders::_1 ),
-                std::bind( &interpolators::MultiLinearInterpolator
-                             < double, Eigen::Vector3d, NumberOfDimensions >::interpolate,
-                             momentInterpolator, std::placeholders::_1 ),
+                             < double, Eigen::Vector6d, NumberOfDimensions >::interpolate,
+                             coefficientInterpolator, std::placeholders::_1 ),
                 independentVariableNames );
 }
 
@@ -13,6 +13,8 @@
 
 #include "tudat/astro/ephemerides/ephemeris.h"
 #include "tudat/astro/basic_astro/accelerationModel.h"
+#include "tudat/basics/parallelization.h"
+#include "tudat/basics/tracing.h"
 
 #include "tudat/simulation/environment_setup/body.h"
 #include "tudat/simulation/environment_setup/createEphemeris.h"
@@ -118,11 +120,13 @@ public:
 
     BodyListSettings( const std::string frameOrigin = "SSB", const std::string frameOrientation = "ECLIPJ2000" ):
         bodySettings_( std::map< std::string, std::shared_ptr< BodySettings > >( ) ),
-        frameOrigin_( frameOrigin ), frameOrientation_( frameOrientation ){ }
+        frameOrigin_( frameOrigin ), frameOrientation_( frameOrientation ),
+        numberOfThreadsForModelCreation_( 1 ), createModelsOnFirstUse_( false ){ }
 
     BodyListSettings( const std::map< std::string, std::shared_ptr< BodySettings > >& bodySettings,
                       const std::string frameOrigin = "SSB", const std::string frameOrientation = "ECLIPJ2000" ):
-        bodySettings_( bodySettings ), frameOrigin_( frameOrigin ), frameOrientation_( frameOrientation ){ }
+        bodySettings_( bodySettings ), frameOrigin_( frameOrigin ), frameOrientation_( frameOrientation ),
+        numberOfThreadsForModelCreation_( 1 ), createModelsOnFirstUse_( false ){ }
 
     std::shared_ptr< BodySettings > at( const std::string& bodyName ) const
     {
@@ -171,6 +175,43 @@ public:
 
     std::map< std::string, std::shared_ptr< BodySettings > > getMap( ) const { return bodySettings_; }
 
+    // Set settings for replacing all direct Spice ephemerides by pre-sampled ephemerides (nullptr to disable)
+    void setSpiceEphemerisPreSampling( const std::shared_ptr< SpiceEphemerisPreSamplingSettings > preSamplingSettings )
+    {
+        spiceEphemerisPreSamplingSettings_ = preSamplingSettings;
+    }
+
+    void setSpiceEphemerisPreSampling( const double startTime, const double endTime,
+                                       const double positionTolerance = 1.0E-3, const double velocityTolerance = 1.0E-6 )
+    {
+        spiceEphemerisPreSamplingSettings_ = std::make_shared< SpiceEphemerisPreSamplingSettings >(
+                    startTime, endTime, positionTolerance, velocityTolerance );
+    }
+
+    std::shared_ptr< SpiceEphemerisPreSamplingSettings > getSpiceEphemerisPreSamplingSettings( ) const
+    {
+        return spiceEphemerisPreSamplingSettings_;
+    }
+
+    // Set number of threads over which the creation of body models that do not depend on other bodies (ephemeris,
+    // atmosphere, shape and gravity field models) is distributed by createSystemOfBodies (default 1)
+    void setNumberOfThreadsForModelCreation( const int numberOfThreads )
+    {
+        numberOfThreadsForModelCreation_ = numberOfThreads;
+    }
+
+    int getNumberOfThreadsForModelCreation( ) const { return numberOfThreadsForModelCreation_; }
+
+    // Set whether models that are expensive to create, and not required by other body models (atmosphere models), are
+    // only created when first retrieved from the body (e.g. when creating the accelerations), instead of by
+    // createSystemOfBodies (default false)
+    void setCreateModelsOnFirstUse( const bool createModelsOnFirstUse )
+    {
+        createModelsOnFirstUse_ = createModelsOnFirstUse;
+    }
+
+    bool getCreateModelsOnFirstUse( ) const { return createModelsOnFirstUse_; }
+
 
 private:
 
@@ -179,6 +220,15 @@ private:
     std::string frameOrigin_;
 
     std::string frameOrientation_;
+
+    // Settings for replacing all direct Spice ephemerides by pre-sampled ephemerides (nullptr if not used)
+    std::shared_ptr< SpiceEphemerisPreSamplingSettings > spiceEphemerisPreSamplingSettings_;
+
+    // Number of threads over which the creation of body models that do not depend on other bodies is distributed
+    int numberOfThreadsForModelCreation_;
+
+    // Boolean denoting whether models that are expensive to create are only created when first retrieved from the body
+    bool createModelsOnFirstUse_;
 };
 
 void setSimpleRotationSettingsFromSpice(
@@ -195,6 +245,19 @@ void setSimpleRotationSettingsFromSpice(
 std::vector< std::pair< std::string, std::shared_ptr< BodySettings > > > determineBodyCreationOrder(
         const std::map< std::string, std::shared_ptr< BodySettings > >& bodySettings );
 
+//! Function to load the pending Spice kernels that are required by the ephemerides in a list of body settings
+/*!
+ * Function to load the pending Spice kernels (see spice_interface::registerSpiceKernelForLoadingOnDemand) that are
+ * required by the Spice-based ephemerides in a list of body settings (see
+ * spice_interface::loadPendingSpiceKernelsForBodies). The required bodies are the bodies with a Spice-based ephemeris,
+ * and their ephemeris origins (as well as the global frame origin). If all Spice-based ephemerides are interpolated or
+ * pre-sampled (see BodyListSettings::setSpiceEphemerisPreSampling), only kernels covering the union of their time
+ * intervals are loaded; otherwise, the time interval is unbounded. Called by createSystemOfBodies.
+ * \param bodySettings Settings for the bodies that are to be created
+ * \return List of kernels that were loaded
+ */
+std::vector< std::string > loadPendingSpiceKernelsForBodySettings( const BodyListSettings& bodySettings );
+
 //! Function to create a map of bodies objects.
 /*!
  *  Function to create a map of body objects based on model-specific settings for the bodies,
@@ -207,9 +270,17 @@ template< typename StateScalarType = double , typename TimeType = double >
 SystemOfBodies createSystemOfBodies(
         const BodyListSettings& bodySettings )
 {
+    TUDAT_TRACE_SCOPE( "create_bodies", "environment" );
+
     std::vector< std::pair< std::string, std::shared_ptr< BodySettings > > > orderedBodySettings
             = determineBodyCreationOrder( bodySettings.getMap( ) );
 
+    // Load Spice kernels registered for loading on demand, if required by the bodies
+    if( spice_interface::getPendingSpiceKernels( ).size( ) > 0 )
+    {
+        loadPendingSpiceKernelsForBodySettings( bodySettings );
+    }
+
     // Declare map of bodies that is to be returned.
     SystemOfBodies bodyList = SystemOfBodies(
                 bodySettings.getFrameOrigin( ), bodySettings.getFrameOrientation( ) );
@@ -230,39 +301,51 @@ SystemOfBodies createSystemOfBodies(
         }
     }
 
-    // Create ephemeris objects for each body (if required).
-    for( unsigned int i = 0; i < orderedBodySettings.size( ); i++ )
+    // Create ephemeris, atmosphere and shape model objects for each body (if required). These models do not depend on
+    // other bodies, and are created in parallel (if requested).
+    const int numberOfThreads = bodySettings.getNumberOfThreadsForModelCreation( );
+    utilities::executeParallelTasks(
+                orderedBodySettings.size( ), [ & ]( const int i )
     {
-        if( orderedBodySettings.at( i ).second->ephemerisSettings != nullptr )
+        const std::string& bodyName = orderedBodySettings.at( i ).first;
+        std::shared_ptr< EphemerisSettings > ephemerisSettings = orderedBodySettings.at( i ).second->ephemerisSettings;
+        if( ephemerisSettings != nullptr )
         {
-            bodyList.at( orderedBodySettings.at( i ).first )->setEphemeris(
-                        createBodyEphemeris< StateScalarType, TimeType >(
-                            orderedBodySettings.at( i ).second->ephemerisSettings,
-                                             orderedBodySettings.at( i ).first ) );
+            // Check if ephemeris is a (single-arc) direct Spice ephemeris that is to be pre-sampled
+            bool preSampleEphemeris = ( bodySettings.getSpiceEphemerisPreSamplingSettings( ) != nullptr ) &&
+                    ( ephemerisSettings->getEphemerisType( ) == direct_spice_ephemeris ) &&
+                    !ephemerisSettings->getMakeMultiArcEphemeris( );
+
+            std::shared_ptr< ephemerides::Ephemeris > bodyEphemeris = createBodyEphemeris< StateScalarType, TimeType >(
+                        ephemerisSettings, bodyName );
+            if( preSampleEphemeris )
+            {
+                bodyEphemeris = getPreSampledEphemeris(
+                            bodyEphemeris, bodySettings.getSpiceEphemerisPreSamplingSettings( ) );
+            }
+            bodyList.at( bodyName )->setEphemeris( bodyEphemeris );
         }
-    }
 
-    // Create atmosphere model objects for each body (if required).
-    for( unsigned int i = 0; i < orderedBodySettings.size( ); i++ )
-    {
-        if( orderedBodySettings.at( i ).second->atmosphereSettings != nullptr )
+        std::shared_ptr< AtmosphereSettings > atmosphereSettings = orderedBodySettings.at( i ).second->atmosphereSettings;
+        if( atmosphereSettings != nullptr )
         {
-            bodyList.at( orderedBodySettings.at( i ).first )->setAtmosphereModel(
-                        createAtmosphereModel( orderedBodySettings.at( i ).second->atmosphereSettings,
-                                               orderedBodySettings.at( i ).first ) );
+            if( bodySettings.getCreateModelsOnFirstUse( ) )
+            {
+                bodyList.at( bodyName )->setAtmosphereModelCreationFunction(
+                            [ = ]( ){ return createAtmosphereModel( atmosphereSettings, bodyName ); } );
+            }
+            else
+            {
+                bodyList.at( bodyName )->setAtmosphereModel( createAtmosphereModel( atmosphereSettings, bodyName ) );
+            }
         }
-    }
 
-    // Create body shape model objects for each body (if required).
-    for( unsigned int i = 0; i < orderedBodySettings.size( ); i++ )
-    {
         if( orderedBodySettings.at( i ).second->shapeModelSettings != nullptr )
         {
-            bodyList.at( orderedBodySettings.at( i ).first )->setShapeModel(
-                        createBodyShapeModel( orderedBodySettings.at( i ).second->shapeModelSettings,
-                                              orderedBodySettings.at( i ).first ) );
+            bodyList.at( bodyName )->setShapeModel(
+                        createBodyShapeModel( orderedBodySettings.at( i ).second->shapeModelSettings, bodyName ) );
         }
-    }
+    }, numberOfThreads );
 
     // Create rotation model objects for each body (if required).
     for( unsigned int i = 0; i < orderedBodySettings.size( ); i++ )
@@ -275,8 +358,9 @@ SystemOfBodies createSystemOfBodies(
         }
     }
 
-    // Create gravity field model objects for each body (if required).
-    for( unsigned int i = 0; i < orderedBodySettings.size( ); i++ )
+    // Create gravity field model objects for each body (if required), in parallel (if requested).
+    utilities::executeParallelTasks(
+                orderedBodySettings.size( ), [ & ]( const int i )
     {
         if( orderedBodySettings.at( i ).second->gravityFieldSettings != nullptr )
         {
@@ -285,7 +369,7 @@ SystemOfBodies createSystemOfBodies(
                                                  orderedBodySettings.at( i ).first, bodyList,
                                                  orderedBodySettings.at( i ).second->gravityFieldVariationSettings ) );
         }
-    }
+    }, numberOfThreads );
 
 
     for( unsigned int i = 0; i < orderedBodySettings.size( ); i++ )
@@ -20,6 +20,7 @@
 #include "tudat/astro/basic_astro/orbitalElementConversions.h"
 #include "tudat/astro/ephemerides/ephemeris.h"
 #include "tudat/astro/ephemerides/tabulatedEphemeris.h"
+#include "tudat/astro/ephemerides/chebyshevEphemeris.h"
 #include "tudat/astro/ephemerides/tleEphemeris.h"
 #include "tudat/astro/ephemerides/customEphemeris.h"
 #include "tudat/astro/ephemerides/keplerEphemeris.h"
@@ -55,7 +56,8 @@ enum EphemerisType
     custom_ephemeris,
     direct_tle_ephemeris,
     interpolated_tle_ephemeris,
-    scaled_ephemeris
+    scaled_ephemeris,
+    chebyshev_tabulated_ephemeris
 };
 
 // Class for providing settings for ephemeris model.
@@ -720,6 +722,73 @@ private:
     std::map< double, Eigen::Vector6d > bodyStateHistory_;
 };
 
+// EphemerisSettings derived class for defining settings of an ephemeris created by fitting Chebyshev polynomials to
+// tabulated data.
+/*
+ *  EphemerisSettings derived class for defining settings of an ephemeris created by fitting Chebyshev polynomials to
+ *  tabulated data (see ChebyshevCartesianEphemeris). Compared to the TabulatedEphemerisSettings, the resulting ephemeris
+ *  is fitted once (to within the given tolerances), after which each state evaluation is a direct (allocation-free)
+ *  evaluation of the Chebyshev series in the segment in which the epoch lies.
+ */
+class ChebyshevTabulatedEphemerisSettings: public EphemerisSettings
+{
+public:
+
+    // Constructor.
+    /*
+     *  Constructor.
+     *  \param bodyStateHistory Data map (time as key, Cartesian state as values) defining data
+     *  to which the Chebyshev ephemeris is to be fitted.
+     *  \param positionTolerance Maximum permitted position error of the fit w.r.t. the tabulated data.
+     *  \param velocityTolerance Maximum permitted velocity error of the fit w.r.t. the tabulated data.
+     *  \param polynomialDegree Degree of the Chebyshev series of each state component in each segment.
+     *  \param frameOrigin Name of body relative to which the ephemeris is to be calculated
+     *        (optional "SSB" by default).
+     *  \param frameOrientation Orientatioan of the reference frame in which the epehemeris is to be
+     *          calculated (optional, "ECLIPJ2000" by default).
+     */
+    ChebyshevTabulatedEphemerisSettings(
+            const std::map< double, Eigen::Vector6d >& bodyStateHistory,
+            const double positionTolerance = 1.0E-3,
+            const double velocityTolerance = 1.0E-6,
+            const int polynomialDegree = 12,
+            std::string frameOrigin = "SSB",
+            std::string frameOrientation = "ECLIPJ2000" ):
+        EphemerisSettings( chebyshev_tabulated_ephemeris, frameOrigin, frameOrientation ),
+        bodyStateHistory_( bodyStateHistory ), positionTolerance_( positionTolerance ),
+        velocityTolerance_( velocityTolerance ), polynomialDegree_( polynomialDegree ){ }
+
+    // Function returning data map defining discrete data to which the ephemeris is to be fitted.
+    std::map< double, Eigen::Vector6d > getBodyStateHistory( )
+    { return bodyStateHistory_; }
+
+    // Function returning maximum permitted position error of the fit
+    double getPositionTolerance( )
+    { return positionTolerance_; }
+
+    // Function returning maximum permitted velocity error of the fit
+    double getVelocityTolerance( )
+    { return velocityTolerance_; }
+
+    // Function returning degree of the Chebyshev series in each segment
+    int getPolynomialDegree( )
+    { return polynomialDegree_; }
+
+private:
+
+    // Data map (time as key, Cartesian state as values) defining data to which the ephemeris is to be fitted.
+    std::map< double, Eigen::Vector6d > bodyStateHistory_;
+
+    // Maximum permitted position error of the fit
+    double positionTolerance_;
+
+    // Maximum permitted velocity error of the fit
+    double velocityTolerance_;
+
+    // Degree of the Chebyshev series in each segment
+    int polynomialDegree_;
+};
+
 class AutoGeneratedTabulatedEphemerisSettings: public EphemerisSettings
 {
 public:
@@ -851,6 +920,85 @@ private:
 };
 
 
+// Class defining settings for automatically replacing Spice-based ephemerides by pre-sampled (Chebyshev) ephemerides.
+/*
+ *  Class defining settings for automatically replacing Spice-based ephemerides by pre-sampled (Chebyshev) ephemerides,
+ *  on a given time interval (see ChebyshevCartesianEphemeris). Each body with a direct Spice ephemeris is fitted once, to
+ *  within the given position and velocity tolerance (w.r.t. the Spice states), after which all state queries are served
+ *  from memory, without any calls to Spice. Note that the time interval should cover all epochs at which the ephemerides
+ *  are evaluated (including light-time corrections, etc.), since the pre-sampled ephemerides throw an exception outside
+ *  of this interval.
+ */
+class SpiceEphemerisPreSamplingSettings
+{
+public:
+
+    // Constructor.
+    /*
+     *  Constructor.
+     *  \param startTime Start of the interval on which the ephemerides are pre-sampled
+     *  \param endTime End of the interval on which the ephemerides are pre-sampled
+     *  \param positionTolerance Maximum permitted position error of the pre-sampled ephemerides w.r.t. Spice
+     *  \param velocityTolerance Maximum permitted velocity error of the pre-sampled ephemerides w.r.t. Spice
+     *  \param polynomialDegree Degree of the Chebyshev series of each state component in each segment.
+     *  \param minimumSegmentDuration Minimum duration of a Chebyshev segment
+     */
+    SpiceEphemerisPreSamplingSettings(
+            const double startTime,
+            const double endTime,
+            const double positionTolerance = 1.0E-3,
+            const double velocityTolerance = 1.0E-6,
+            const int polynomialDegree = 12,
+            const double minimumSegmentDuration = 60.0 ):
+        startTime_( startTime ), endTime_( endTime ), positionTolerance_( positionTolerance ),
+        velocityTolerance_( velocityTolerance ), polynomialDegree_( polynomialDegree ),
+        minimumSegmentDuration_( minimumSegmentDuration ){ }
+
+    double getStartTime( ){ return startTime_; }
+
+    double getEndTime( ){ return endTime_; }
+
+    double getPositionTolerance( ){ return positionTolerance_; }
+
+    double getVelocityTolerance( ){ return velocityTolerance_; }
+
+    int getPolynomialDegree( ){ return polynomialDegree_; }
+
+    double getMinimumSegmentDuration( ){ return minimumSegmentDuration_; }
+
+private:
+
+    // Start of the interval on which the ephemerides are pre-sampled
+    double startTime_;
+
+    // End of the interval on which the ephemerides are pre-sampled
+    double endTime_;
+
+    // Maximum permitted position error of the pre-sampled ephemerides w.r.t. Spice
+    double positionTolerance_;
+
+    // Maximum permitted velocity error of the pre-sampled ephemerides w.r.t. Spice
+    double velocityTolerance_;
+
+    // Degree of the Chebyshev series of each state component in each segment.
+    int polynomialDegree_;
+
+    // Minimum duration of a Chebyshev segment
+    double minimumSegmentDuration_;
+};
+
+// Function to create a pre-sampled (Chebyshev) ephemeris from an existing ephemeris model
+/*
+ *  Function to create a pre-sampled (Chebyshev) ephemeris from an existing ephemeris model, by fitting the Chebyshev
+ *  segments directly to the states of the original model, on the interval defined in the settings.
+ *  \param ephemerisToSample Ephemeris model that is to be pre-sampled
+ *  \param preSamplingSettings Settings for the pre-sampling (interval, tolerances, polynomial degree)
+ *  \return Pre-sampled ephemeris model, with the reference frame of the original model
+ */
+std::shared_ptr< ephemerides::ChebyshevCartesianEphemeris > getPreSampledEphemeris(
+        const std::shared_ptr< ephemerides::Ephemeris > ephemerisToSample,
+        const std::shared_ptr< SpiceEphemerisPreSamplingSettings > preSamplingSettings );
+
 // Function to create a tabulated ephemeris using data from Spice.
 /*
  *  Function to create a tabulated ephemeris using data from Spice.
@@ -883,14 +1031,23 @@ std::shared_ptr< ephemerides::Ephemeris > createTabulatedEphemerisFromSpice(
 
     std::map< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > > timeHistoryOfState;
 
-    // Calculate state from spice at given time intervals and store in timeHistoryOfState.
-    TimeType currentTime = initialTime;
-    while( currentTime < endTime )
+    if constexpr( std::is_same< TimeType, double >::value && std::is_same< StateScalarType, double >::value )
     {
-        timeHistoryOfState[ currentTime ] = spice_interface::getBodyCartesianStateAtEpoch(
-                    body, observerName, referenceFrameName, "none", static_cast< double >( currentTime ) ).
-                template cast< StateScalarType >( );
-        currentTime += timeStep;
+        // Retrieve states from the process-wide cache, computing them from spice only if not yet available
+        timeHistoryOfState = *spice_interface::getBodyCartesianStateHistory(
+                    body, observerName, referenceFrameName, initialTime, endTime, timeStep );
+    }
+    else
+    {
+        // Calculate state from spice at given time intervals and store in timeHistoryOfState.
+        TimeType currentTime = initialTime;
+        while( currentTime < endTime )
+        {
+            timeHistoryOfState[ currentTime ] = spice_interface::getBodyCartesianStateAtEpoch(
+                        body, observerName, referenceFrameName, "none", static_cast< double >( currentTime ) ).
+                    template cast< StateScalarType >( );
+            currentTime += timeStep;
+        }
     }
 
     // Create interpolator.
@@ -1051,6 +1208,30 @@ inline std::shared_ptr< EphemerisSettings > tabulatedEphemerisSettings(
             ephemerisSettings, startTime, endTime, timeStep, interpolatorSettings );
 }
 
+inline std::shared_ptr< EphemerisSettings > chebyshevTabulatedEphemerisSettings(
+        const std::map< double, Eigen::Vector6d >& bodyStateHistory,
+        const double positionTolerance = 1.0E-3,
+        const double velocityTolerance = 1.0E-6,
+        const int polynomialDegree = 12,
+        std::string frameOrigin = "SSB",
+        std::string frameOrientation = "ECLIPJ2000" )
+{
+    return std::make_shared< ChebyshevTabulatedEphemerisSettings >(
+            bodyStateHistory, positionTolerance, velocityTolerance, polynomialDegree, frameOrigin, frameOrientation );
+}
+
+inline std::shared_ptr< SpiceEphemerisPreSamplingSettings > spiceEphemerisPreSamplingSettings(
+        const double startTime,
+        const double endTime,
+        const double positionTolerance = 1.0E-3,
+        const double velocityTolerance = 1.0E-6,
+        const int polynomialDegree = 12,
+        const double minimumSegmentDuration = 60.0 )
+{
+    return std::make_shared< SpiceEphemerisPreSamplingSettings >(
+            startTime, endTime, positionTolerance, velocityTolerance, polynomialDegree, minimumSegmentDuration );
+}
+
 //! @get_docstring(constantEphemerisSettings)
 inline std::shared_ptr< EphemerisSettings > constantEphemerisSettings(
 		const Eigen::Vector6d& constantState,
@@ -1256,6 +1437,30 @@ std::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
             }
             break;
         }
+        case chebyshev_tabulated_ephemeris:
+        {
+            // Check consistency of type and class.
+            std::shared_ptr< ChebyshevTabulatedEphemerisSettings > chebyshevEphemerisSettings =
+                    std::dynamic_pointer_cast< ChebyshevTabulatedEphemerisSettings >( ephemerisSettings );
+            if( chebyshevEphemerisSettings == nullptr )
+            {
+                throw std::runtime_error(
+                            "Error, expected Chebyshev tabulated ephemeris settings for body " + bodyName );
+            }
+            else
+            {
+                // Create corresponding ephemeris object (empty if no state history is provided, for instance when
+                // it is to be set from numerically propagated states).
+                ephemeris = std::make_shared< ChebyshevCartesianEphemeris >(
+                            chebyshevEphemerisSettings->getBodyStateHistory( ),
+                            chebyshevEphemerisSettings->getPositionTolerance( ),
+                            chebyshevEphemerisSettings->getVelocityTolerance( ),
+                            chebyshevEphemerisSettings->getPolynomialDegree( ),
+                            chebyshevEphemerisSettings->getFrameOrigin( ),
+                            chebyshevEphemerisSettings->getFrameOrientation( ) );
+            }
+            break;
+        }
         case auto_generated_tabulated_ephemeris:
         {
             // Check consistency of type and class.
@@ -18,12 +18,15 @@
 #include <boost/algorithm/string/trim.hpp>
 #include <memory>
 
+#include "tudat/io/binaryGravityFieldFile.h"
+#include "tudat/math/basic/copyOnWriteMatrix.h"
 #include "tudat/simulation/environment_setup/body.h"
 #include "tudat/simulation/environment_setup/createGravityFieldVariations.h"
 #include "tudat/astro/gravitation/gravityFieldModel.h"
 #include "tudat/astro/gravitation/sphericalHarmonicsGravityField.h"
 #include "tudat/astro/gravitation/gravityFieldVariations.h"
 #include "tudat/astro/gravitation/polyhedronGravityField.h"
+#include "tudat/astro/gravitation/hybridPolyhedronGravityField.h"
 #include "tudat/astro/gravitation/ringGravityField.h"
 
 namespace tudat
@@ -168,8 +171,8 @@ public:
         std::tuple< Eigen::MatrixXd, Eigen::MatrixXd, double > degreeTwoField = gravitation::getDegreeTwoSphericalHarmonicCoefficients(
                 inertiaTensor_, gravitationalParameter_, referenceRadius_ );
 
-        cosineCoefficients_.block( 2, 0, 1, 3 ) = std::get< 0 >( degreeTwoField ).block( 2, 0, 1, 3 );
-        sineCoefficients_.block( 2, 1, 1, 2 ) = std::get< 1 >( degreeTwoField ).block( 2, 1, 1, 2 );
+        cosineCoefficients_.getMutableMatrix( ).block( 2, 0, 1, 3 ) = std::get< 0 >( degreeTwoField ).block( 2, 0, 1, 3 );
+        sineCoefficients_.getMutableMatrix( ).block( 2, 1, 1, 2 ) = std::get< 1 >( degreeTwoField ).block( 2, 1, 1, 2 );
         scaledMeanMomentOfInertia_ = std::get< 2 >( degreeTwoField );
 
     }
@@ -203,7 +206,11 @@ public:
      *  Function to return cosine spherical harmonic coefficients (geodesy normalized).
      *  \return Cosine spherical harmonic coefficients (geodesy normalized).
      */
-    Eigen::MatrixXd getCosineCoefficients( ){ return cosineCoefficients_; }
+    Eigen::MatrixXd getCosineCoefficients( ){ return cosineCoefficients_.getMatrix( ); }
+
+    // Function to return (shared) storage of cosine spherical harmonic coefficients, used to create the gravity field
+    // without copying the coefficients.
+    basic_mathematics::CopyOnWriteMatrix getSharedCosineCoefficients( ){ return cosineCoefficients_; }
 
 
     Eigen::Matrix3d getInertiaTensor( ){ return inertiaTensor_; }
@@ -212,16 +219,20 @@ public:
 
     void setScaledMeanMomentOfInertia( const double scaledMeanMomentOfInertia ){ scaledMeanMomentOfInertia_ = scaledMeanMomentOfInertia; }
 
-    void resetCosineCoefficients( const Eigen::MatrixXd cosineCoefficients ){ cosineCoefficients_ = cosineCoefficients; }
+    void resetCosineCoefficients( const Eigen::MatrixXd cosineCoefficients ){ cosineCoefficients_.setMatrix( cosineCoefficients ); }
 
     // Function to return sine spherical harmonic coefficients (geodesy normalized).
     /*
      *  Function to return sine spherical harmonic coefficients (geodesy normalized).
      *  \return Sine spherical harmonic coefficients (geodesy normalized).
      */
-    Eigen::MatrixXd getSineCoefficients( ){ return sineCoefficients_; }
+    Eigen::MatrixXd getSineCoefficients( ){ return sineCoefficients_.getMatrix( ); }
+
+    // Function to return (shared) storage of sine spherical harmonic coefficients, used to create the gravity field
+    // without copying the coefficients.
+    basic_mathematics::CopyOnWriteMatrix getSharedSineCoefficients( ){ return sineCoefficients_; }
 
-    void resetSineCoefficients( const Eigen::MatrixXd sineCoefficients ){ sineCoefficients_ = sineCoefficients; }
+    void resetSineCoefficients( const Eigen::MatrixXd sineCoefficients ){ sineCoefficients_.setMatrix( sineCoefficients ); }
 
     // Function to return identifier for body-fixed reference frame.
     /*
@@ -272,11 +283,11 @@ protected:
 
     Eigen::Matrix3d inertiaTensor_;
 
-    // Cosine spherical harmonic coefficients (geodesy normalized).
-    Eigen::MatrixXd cosineCoefficients_;
+    // Cosine spherical harmonic coefficients (geodesy normalized), shared with the gravity fields created from them.
+    basic_mathematics::CopyOnWriteMatrix cosineCoefficients_;
 
-    // Sine spherical harmonic coefficients (geodesy normalized).
-    Eigen::MatrixXd sineCoefficients_;
+    // Sine spherical harmonic coefficients (geodesy normalized), shared with the gravity fields created from them.
+    basic_mathematics::CopyOnWriteMatrix sineCoefficients_;
 
     // Identifier for body-fixed reference frame to which the coefficients are referred.
     std::string associatedReferenceFrame_;
@@ -419,6 +430,71 @@ protected:
 
 };
 
+// Derived class of PolyhedronGravityFieldSettings defining settings of a polyhedron gravity field with a spherical
+// harmonic far field.
+/*
+ *  Derived class of PolyhedronGravityFieldSettings defining settings of a polyhedron gravity field, which is replaced by
+ *  a spherical harmonic expansion of the polyhedron (computed upon creation) far from the body, with a smooth blending
+ *  region in between (see gravitation::HybridPolyhedronGravityField).
+ */
+class HybridPolyhedronGravityFieldSettings: public PolyhedronGravityFieldSettings
+{
+public:
+    // Constructor.
+    /*
+     *  Constructor.
+     *  \param gravitationalParameter Gravitational parameter of the polyhedron.
+     *  \param verticesCoordinates Cartesian coordinates of each vertex (one row per vertex, 3 columns).
+     *  \param verticesDefiningEachFacet Index (0 based) of the vertices constituting each facet (one row per facet, 3 columns).
+     *  \param associatedReferenceFrame Identifier for body-fixed reference frame to which the polyhedron is referred.
+     *  \param maximumDegree Maximum degree (and order) of the spherical harmonic far-field expansion.
+     *  \param innerSwitchDistance Distance at which the blending from polyhedron to spherical harmonic model starts.
+     *  \param outerSwitchDistance Distance at which the blending from polyhedron to spherical harmonic model ends.
+     *  \param gravitationalConstant Gravitational constant.
+     */
+    HybridPolyhedronGravityFieldSettings( const double gravitationalParameter,
+                                          const Eigen::MatrixXd& verticesCoordinates,
+                                          const Eigen::MatrixXi& verticesDefiningEachFacet,
+                                          const std::string& associatedReferenceFrame,
+                                          const int maximumDegree,
+                                          const double innerSwitchDistance,
+                                          const double outerSwitchDistance,
+                                          const double gravitationalConstant = physical_constants::GRAVITATIONAL_CONSTANT ):
+        PolyhedronGravityFieldSettings( gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet,
+                                        associatedReferenceFrame, gravitationalConstant ),
+        maximumDegree_( maximumDegree ),
+        innerSwitchDistance_( innerSwitchDistance ),
+        outerSwitchDistance_( outerSwitchDistance )
+    { }
+
+    //! Destructor
+    virtual ~HybridPolyhedronGravityFieldSettings( ){ }
+
+    // Function to return the maximum degree of the spherical harmonic far-field expansion.
+    int getMaximumDegree( )
+    { return maximumDegree_; }
+
+    // Function to return the distance at which the blending from polyhedron to spherical harmonic model starts.
+    double getInnerSwitchDistance( )
+    { return innerSwitchDistance_; }
+
+    // Function to return the distance at which the blending from polyhedron to spherical harmonic model ends.
+    double getOuterSwitchDistance( )
+    { return outerSwitchDistance_; }
+
+protected:
+
+    // Maximum degree (and order) of the spherical harmonic far-field expansion.
+    int maximumDegree_;
+
+    // Distance at which the blending from polyhedron to spherical harmonic model starts.
+    double innerSwitchDistance_;
+
+    // Distance at which the blending from polyhedron to spherical harmonic model ends.
+    double outerSwitchDistance_;
+
+};
+
 // Derived class of GravityFieldSettings defining settings of polyhedron gravity
 // field representation.
 // References: Precise computation of acceleration due to uniform ring or disk, Toshio Fukushima (2010), Celestial Mechanics
@@ -719,20 +795,84 @@ std::shared_ptr< SphericalHarmonicsGravityFieldSettings > createHomogeneousTriAx
  *  Degree, Order, Cosine Coefficient, Sine Coefficients
  *  Subsequent columns may be present in the file, but are ignored when parsing.
  *  All coefficients not defined in the file are set to zero (except C(0,0) which is always 1.0)
+ *  If useBinaryCache is true, the coefficients are read from a binary cache of the file (see loadGravityFieldCacheFile),
+ *  which is created on the first call for a given file, so that only the coefficients up to the requested degree are
+ *  read, without text parsing.
  *  \param fileName Name of PDS gravity field file to be loaded.
  *  \param maximumDegree Maximum degree of gravity field to be loaded.
  *  \param maximumOrder Maximum order of gravity field to be loaded.
  *  \param gravitationalParameterIndex
  *  \param referenceRadiusIndex
  *  \param coefficients Spherical harmonics coefficients (first is cosine, second is sine).
+ *  \param useBinaryCache Boolean denoting whether the binary cache of the file is to be used
  *  \return Pair of gravitational parameter and reference radius, values are non-NaN if
  *  gravitationalParameterIndex and referenceRadiusIndex are >=0.
  */
 std::pair< double, double > readGravityFieldFile(
         const std::string& fileName, const int maximumDegree, const int maximumOrder,
         std::pair< Eigen::MatrixXd, Eigen::MatrixXd >& coefficients,
+        const int gravitationalParameterIndex = -1, const int referenceRadiusIndex = -1,
+        const bool useBinaryCache = true );
+
+// Function to get the name of the binary cache file of a gravity field text file
+/*
+ *  Function to get the name of the binary cache file of a gravity field text file, which is stored in the same
+ *  directory as the text file.
+ *  \param fileName Name of gravity field text file
+ *  \param hasHeader Boolean denoting whether the first line of the text file is a header
+ *  \return Name of the binary cache file
+ */
+std::string getGravityFieldCacheFileName( const std::string& fileName, const bool hasHeader );
+
+// Function to load the binary cache of a gravity field text file, creating or updating it if required
+/*
+ *  Function to load the binary cache of a gravity field text file (see input_output::BinaryGravityFieldFile). If the
+ *  cache does not exist, is invalid, or was created from a text file with a different size or modification time, the
+ *  full text file is parsed and the cache is (re)written. The cache is written to a temporary file first, which is then
+ *  renamed, so that concurrent processes never read a partially written cache. This temporary file is created before the
+ *  text file is parsed, so that the full text file is not parsed if the cache directory is not writable (e.g. a
+ *  read-only data directory). A cache that could not be written is not attempted again for the remainder of the
+ *  process. The cache is mapped into memory, and is shared by all users in the process.
+ *  \param fileName Name of gravity field text file
+ *  \param hasHeader Boolean denoting whether the first line of the text file is a header
+ *  \return Binary cache of the file, or nullptr if the cache could not be written (in which case the caller reads the
+ *  required coefficients from the text file directly)
+ */
+std::shared_ptr< input_output::BinaryGravityFieldFile > loadGravityFieldCacheFile(
+        const std::string& fileName, const bool hasHeader );
+
+// Function to load the coefficients of a gravity field file, sharing a single copy of the coefficients within the process
+/*
+ *  Function to load the coefficients of a gravity field file (see readGravityFieldFile), sharing a single copy of the
+ *  coefficients within the process. The file is read on the first call for a given file and maximum degree/order, and
+ *  the result is retained for the lifetime of the process (or until clearGravityFieldCoefficientsCache is called), so
+ *  that subsequent calls (for instance when creating the default bodies repeatedly) only copy a reference to the
+ *  coefficients. Since the coefficients are returned as copy-on-write matrices, modifying them does not affect other
+ *  users. The file is read again if its size or modification time has changed. This function may be called from
+ *  multiple threads concurrently.
+ *  \param fileName Name of gravity field file to be loaded.
+ *  \param maximumDegree Maximum degree of gravity field to be loaded.
+ *  \param maximumOrder Maximum order of gravity field to be loaded.
+ *  \param cosineCoefficients Cosine coefficients (returned by reference)
+ *  \param sineCoefficients Sine coefficients (returned by reference)
+ *  \param gravitationalParameterIndex Index at which the gravitational parameter can be found in the header
+ *  \param referenceRadiusIndex Index at which the reference radius can be found in the header
+ *  \return Pair of gravitational parameter and reference radius, values are non-NaN if
+ *  gravitationalParameterIndex and referenceRadiusIndex are >=0.
+ */
+std::pair< double, double > loadGravityFieldCoefficients(
+        const std::string& fileName, const int maximumDegree, const int maximumOrder,
+        basic_mathematics::CopyOnWriteMatrix& cosineCoefficients,
+        basic_mathematics::CopyOnWriteMatrix& sineCoefficients,
         const int gravitationalParameterIndex = -1, const int referenceRadiusIndex = -1 );
 
+// Function to clear the cache of gravity field coefficients used by loadGravityFieldCoefficients
+/*
+ *  Function to clear the cache of gravity field coefficients used by loadGravityFieldCoefficients. Existing users of the
+ *  coefficients are not affected.
+ */
+void clearGravityFieldCoefficientsCache( );
+
 // Function to create a gravity field model.
 /*
  *  Function to create a gravity field model based on model-specific settings for the gravity field.
@@ -824,6 +964,21 @@ inline std::shared_ptr< GravityFieldSettings > polyhedronGravitySettingsFromMu(
             gravitationalConstant );
 }
 
+inline std::shared_ptr< GravityFieldSettings > hybridPolyhedronGravitySettingsFromMu(
+        const double gravitationalParameter,
+        const Eigen::MatrixXd verticesCoordinates,
+        const Eigen::MatrixXi verticesDefiningEachFacet,
+        const std::string& associatedReferenceFrame,
+        const int maximumDegree,
+        const double innerSwitchDistance,
+        const double outerSwitchDistance,
+        const double gravitationalConstant = physical_constants::GRAVITATIONAL_CONSTANT )
+{
+    return std::make_shared< HybridPolyhedronGravityFieldSettings >(
+            gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet, associatedReferenceFrame,
+            maximumDegree, innerSwitchDistance, outerSwitchDistance, gravitationalConstant );
+}
+
 inline std::shared_ptr< GravityFieldSettings > ringGravitySettings(
         const double gravitationalParameter,
         const double ringRadius,
@@ -13,6 +13,7 @@
 
 #include "tudat/simulation/environment_setup/body.h"
 #include "tudat/astro/ground_stations/groundStation.h"
+#include "tudat/astro/ground_stations/groundStationNetwork.h"
 #include "tudat/astro/observation_models/linkTypeDefs.h"
 
 
@@ -238,6 +239,25 @@ void createGroundStation(
 std::vector< std::pair< std::string, std::string > > getGroundStationsLinkEndList(
         const std::shared_ptr< Body > body );
 
+//! Function to tabulate the body deformation of all ground stations over a given interval
+/*!
+ * Function to tabulate the body deformation (e.g. tidal displacement) of all ground stations over a given interval, so
+ * that the (expensive) calculation of the displacement at each observation and partial evaluation is replaced by an
+ * interpolation (see ground_stations::tabulateBodyDeformationStationMotion). This function should be called after all
+ * body deformation models and ground stations have been created.
+ * \param bodies List of body objects, the stations of which are modified
+ * \param startTime Start time of the interval on which the displacement is tabulated
+ * \param endTime End time of the interval on which the displacement is tabulated
+ * \param timeStep Time step of the tabulation
+ * \param numberOfInterpolationPoints Number of points used in the Lagrange interpolation (even, between 4 and 12)
+ */
+void tabulateGroundStationBodyDeformations(
+        const SystemOfBodies& bodies,
+        const double startTime,
+        const double endTime,
+        const double timeStep = 1800.0,
+        const int numberOfInterpolationPoints = 8 );
+
 
 //! Function to create an ephemeris for a reference point on a body
 /*!
@@ -408,6 +428,36 @@ std::vector< double >  getTargetElevationAngles(
         const std::string groundStationName,
         const std::vector< double > times );
 
+//! Function to create a network of ground stations on a body, for which states and pointing angles are computed in one pass
+/*!
+ * Function to create a network of ground stations on a body, for which states and pointing angles are computed in one pass
+ * (see GroundStationNetwork)
+ * \param body Body on which the ground stations are located
+ * \param groundStationNames Names of the ground stations that are to be included in the network (in the given order). If
+ * empty (default), all ground stations of the body are included.
+ * \return Network of ground stations
+ */
+std::shared_ptr< ground_stations::GroundStationNetwork > createGroundStationNetwork(
+        const std::shared_ptr< Body > body,
+        const std::vector< std::string >& groundStationNames = std::vector< std::string >( ) );
+
+//! Function to compute the elevation angles of a target body, as observed from all stations of a network, at a list of times
+/*!
+ * Function to compute the elevation angles of a target body, as observed from all stations of a network, at a list of times.
+ * The rotation model of the observing body is evaluated only once per time for all stations. Note that light-time effects
+ * are not taken into account.
+ * \param observingBody Body on which the ground stations are located
+ * \param targetBody Body for which the elevation angles are to be computed
+ * \param groundStationNetwork Network of ground stations located on observingBody
+ * \param times Times at which the elevation angles are to be computed
+ * \return Elevation angles, with a row per time and a column per station (in the order of the network)
+ */
+Eigen::MatrixXd getTargetElevationAnglesForNetwork(
+        const std::shared_ptr< Body > observingBody,
+        const std::shared_ptr< Body > targetBody,
+        const std::shared_ptr< ground_stations::GroundStationNetwork > groundStationNetwork,
+        const std::vector< double >& times );
+
 
 } // namespace simulation_setup
 
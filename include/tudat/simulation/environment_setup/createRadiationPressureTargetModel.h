@@ -138,8 +138,26 @@ public:
         return panels_;
     }
 
+    /*!
+     * Set table of precomputed self-shadowing factors of the panels (one row per panel, in the order of the panel
+     * settings).
+     *
+     * @param selfShadowingTable Self-shadowing table
+     */
+    void setSelfShadowingTable(const std::shared_ptr<electromagnetism::PanelSelfShadowingTable>& selfShadowingTable)
+    {
+        selfShadowingTable_ = selfShadowingTable;
+    }
+
+    std::shared_ptr<electromagnetism::PanelSelfShadowingTable> getSelfShadowingTable() const
+    {
+        return selfShadowingTable_;
+    }
+
 private:
     std::vector<Panel> panels_;
+
+    std::shared_ptr<electromagnetism::PanelSelfShadowingTable> selfShadowingTable_;
 };
 
 /*!
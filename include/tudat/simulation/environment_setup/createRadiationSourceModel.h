@@ -476,6 +476,21 @@ public:
         return originalSourceToSourceOccultingBodies_;
     }
 
+    /*!
+     * Set the number of threads over which the panel irradiance evaluations are distributed.
+     *
+     * @param numberOfThreads Number of threads (default 1)
+     */
+    void setNumberOfThreads(const int numberOfThreads)
+    {
+        numberOfThreads_ = numberOfThreads;
+    }
+
+    int getNumberOfThreads() const
+    {
+        return numberOfThreads_;
+    }
+
 private:
     std::vector<std::shared_ptr<PanelRadiosityModelSettings>> panelRadiosityModelSettings_;
     const std::vector<int> numberOfPanelsPerRing_;
@@ -483,6 +498,8 @@ private:
     // If the same occulting bodies are to be used for all original sources, there will be a single entry
     // with an emptry string as key
     std::map<std::string, std::vector<std::string>> originalSourceToSourceOccultingBodies_;
+    // Number of threads over which the panel irradiance evaluations are distributed
+    int numberOfThreads_{1};
 };
 
 /*!
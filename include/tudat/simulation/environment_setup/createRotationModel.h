@@ -22,6 +22,7 @@
 #include "tudat/astro/ephemerides/rotationalEphemeris.h"
 #include "tudat/astro/ephemerides/directionBasedRotationalEphemeris.h"
 #include "tudat/astro/ephemerides/tabulatedRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/interpolatedRotationalEphemeris.h"
 #include "tudat/astro/basic_astro/physicalConstants.h"
 #include "tudat/astro/basic_astro/unitConversions.h"
 #include "tudat/interface/sofa/earthOrientation.h"
@@ -53,6 +54,32 @@ enum RotationModelType
     custom_rotation_model
 };
 
+//Struct that holds settings for interpolating a pre-tabulated rotation model (instead of evaluating it directly)
+struct RotationModelTabulationSettings
+{
+    //Constructor
+    /*
+     *  Constructor
+     *  \param startTime Start time of the interval on which the rotation is tabulated
+     *  \param endTime End time of the interval on which the rotation is tabulated
+     *  \param angularAccuracy Maximum permitted error of the interpolated rotation (in radians)
+     */
+    RotationModelTabulationSettings(
+            const double startTime,
+            const double endTime,
+            const double angularAccuracy = 1.0E-10 ):
+        startTime_( startTime ), endTime_( endTime ), angularAccuracy_( angularAccuracy ){ }
+
+    //Start time of the interval on which the rotation is tabulated
+    double startTime_;
+
+    //End time of the interval on which the rotation is tabulated
+    double endTime_;
+
+    //Maximum permitted error of the interpolated rotation (in radians)
+    double angularAccuracy_;
+};
+
 //Class for providing settings for rotation model.
 /*
  *  Class for providing settings for automatic rotation model creation. This class is a
@@ -121,6 +148,24 @@ public:
         originalFrame_ = originalFrame;
     }
 
+    //Function to retrieve the settings for interpolating the pre-tabulated rotation model (nullptr if not used)
+    std::shared_ptr< RotationModelTabulationSettings > getTabulationSettings( )
+    {
+        return tabulationSettings_;
+    }
+
+    //Function to set the settings for interpolating the pre-tabulated rotation model
+    /*
+     * Function to set the settings for interpolating the pre-tabulated rotation model, so that the rotation model is
+     * evaluated only when creating the tabulation (and outside of the tabulated interval), see
+     * ephemerides::InterpolatedRotationalEphemeris. If nullptr, the rotation model is evaluated directly.
+     * \param tabulationSettings Settings for interpolating the pre-tabulated rotation model
+     */
+    void setTabulationSettings( const std::shared_ptr< RotationModelTabulationSettings > tabulationSettings )
+    {
+        tabulationSettings_ = tabulationSettings;
+    }
+
 protected:
 
     //Type of rotation model that is to be created.
@@ -132,6 +177,9 @@ protected:
     //Base frame of rotation model.
     std::string targetFrame_;
 
+    //Settings for interpolating the pre-tabulated rotation model (nullptr if the model is evaluated directly)
+    std::shared_ptr< RotationModelTabulationSettings > tabulationSettings_;
+
 };
 
 class SpiceRotationModelSettings: public RotationModelSettings
@@ -253,6 +301,39 @@ struct EopCorrectionSettings
     std::vector< std::string > argumentMultipliersFile_;
 };
 
+//Struct that holds settings for interpolating pre-tabulated Earth orientation angles (instead of computing them directly)
+struct EarthOrientationInterpolationSettings
+{
+    //Constructor
+    /*
+     *  Constructor
+     *  \param startTime Start time of the interval on which the Earth orientation angles are tabulated
+     *  \param endTime End time of the interval on which the Earth orientation angles are tabulated
+     *  \param angularAccuracy Maximum permitted error of the interpolated angles (in radians; error in UT1 is converted to
+     *  an error in Earth rotation angle)
+     *  \param numberOfInterpolationPoints Number of points used in the Lagrange interpolation
+     */
+    EarthOrientationInterpolationSettings(
+            const double startTime,
+            const double endTime,
+            const double angularAccuracy = 1.0E-11,
+            const int numberOfInterpolationPoints = 8 ):
+        startTime_( startTime ), endTime_( endTime ), angularAccuracy_( angularAccuracy ),
+        numberOfInterpolationPoints_( numberOfInterpolationPoints ){ }
+
+    //Start time of the interval on which the Earth orientation angles are tabulated
+    double startTime_;
+
+    //End time of the interval on which the Earth orientation angles are tabulated
+    double endTime_;
+
+    //Maximum permitted error of the interpolated angles (in radians)
+    double angularAccuracy_;
+
+    //Number of points used in the Lagrange interpolation
+    int numberOfInterpolationPoints_;
+};
+
 //Settings for creating a GCRS<->ITRS rotation model
 class GcrsToItrsRotationModelSettings: public RotationModelSettings
 {
@@ -298,7 +379,7 @@ public:
         RotationModelSettings( gcrs_to_itrs_rotation_model, baseFrameName, "ITRS" ),
         inputTimeScale_( inputTimeScale ), nutationTheory_( nutationTheory ), eopFile_( eopFile ),
         eopFileFormat_( "C04" ), ut1CorrectionSettings_( ut1CorrectionSettings ),
-        polarMotionCorrectionSettings_( polarMotionCorrectionSettings ){ }
+        polarMotionCorrectionSettings_( polarMotionCorrectionSettings ), interpolationSettings_( nullptr ){ }
 
     //Destructor
     ~GcrsToItrsRotationModelSettings( ){ }
@@ -362,6 +443,24 @@ public:
         return polarMotionCorrectionSettings_;
     }
 
+    //Function to retrieve the settings for interpolating pre-tabulated Earth orientation angles (nullptr if not used)
+    std::shared_ptr< EarthOrientationInterpolationSettings > getInterpolationSettings( )
+    {
+        return interpolationSettings_;
+    }
+
+    //Function to set the settings for interpolating pre-tabulated Earth orientation angles
+    /*
+     * Function to set the settings for interpolating pre-tabulated Earth orientation angles, so that the full Earth orientation
+     * model is evaluated only when creating the tabulation (and outside of the tabulated interval). If nullptr, the Earth
+     * orientation angles are computed directly at each evaluation of the rotation model.
+     * \param interpolationSettings Settings for interpolating pre-tabulated Earth orientation angles
+     */
+    void setInterpolationSettings( const std::shared_ptr< EarthOrientationInterpolationSettings > interpolationSettings )
+    {
+        interpolationSettings_ = interpolationSettings;
+    }
+
 private:
 
     //Time scale in which input to the rotation model class is provided
@@ -382,6 +481,9 @@ private:
     //Settings for short-period polar motion variations
     std::shared_ptr< EopCorrectionSettings > polarMotionCorrectionSettings_;
 
+    //Settings for interpolating pre-tabulated Earth orientation angles (nullptr if angles are computed directly)
+    std::shared_ptr< EarthOrientationInterpolationSettings > interpolationSettings_;
+
 };
 //#endif
 
@@ -1045,6 +1147,55 @@ inline std::shared_ptr< RotationModelSettings > gcrsToItrsRotationModelSettings(
                 );
 }
 
+//! Function to create settings for a GCRS<->ITRS rotation model, with Earth orientation angles interpolated from tabulated values
+/*!
+ *  Function to create settings for a GCRS<->ITRS rotation model, in which the Earth orientation angles (X, Y, s, x_p, y_p) and
+ *  UT1 are pre-tabulated on the interval [startTime, endTime], and interpolated to within the given angular accuracy.
+ *  \param startTime Start time of the interval on which the Earth orientation angles are tabulated
+ *  \param endTime End time of the interval on which the Earth orientation angles are tabulated
+ *  \param angularAccuracy Maximum permitted error of the interpolated angles (in radians)
+ *  \param nutationTheory IAU precession-nutation theory that is to be used.
+ *  \param baseFrameName Name of base frame (GCRS or J2000)
+ *  \return Settings for GCRS<->ITRS rotation model
+ */
+inline std::shared_ptr< RotationModelSettings > interpolatedGcrsToItrsRotationModelSettings(
+        const double startTime,
+        const double endTime,
+        const double angularAccuracy = 1.0E-11,
+        const basic_astrodynamics::IAUConventions nutationTheory = basic_astrodynamics::iau_2006,
+        const std::string baseFrameName = "GCRS" )
+{
+    std::shared_ptr< GcrsToItrsRotationModelSettings > rotationModelSettings =
+            std::make_shared< GcrsToItrsRotationModelSettings >( nutationTheory, baseFrameName );
+    rotationModelSettings->setInterpolationSettings(
+                std::make_shared< EarthOrientationInterpolationSettings >( startTime, endTime, angularAccuracy ) );
+    return rotationModelSettings;
+}
+
+//! Function to modify rotation model settings such that the rotation is interpolated from pre-tabulated values
+/*!
+ *  Function to modify rotation model settings such that the rotation model is tabulated (quaternion and angular
+ *  velocity) on the interval [startTime, endTime] when it is created, and interpolated to within the given angular
+ *  accuracy, instead of being evaluated at each rotation query (see ephemerides::InterpolatedRotationalEphemeris). Intended
+ *  for rotation models that are expensive to evaluate, such as the GCRS<->ITRS, planetary, Spice and synchronous
+ *  rotation models. Not supported for rotation models that depend on the propagated state of a body.
+ *  \param rotationModelSettings Settings for the rotation model that is to be tabulated (modified by this function)
+ *  \param startTime Start time of the interval on which the rotation is tabulated
+ *  \param endTime End time of the interval on which the rotation is tabulated
+ *  \param angularAccuracy Maximum permitted error of the interpolated rotation (in radians)
+ *  \return Input rotation model settings, with the tabulation settings set
+ */
+inline std::shared_ptr< RotationModelSettings > preTabulatedRotationModelSettings(
+        const std::shared_ptr< RotationModelSettings > rotationModelSettings,
+        const double startTime,
+        const double endTime,
+        const double angularAccuracy = 1.0E-10 )
+{
+    rotationModelSettings->setTabulationSettings(
+                std::make_shared< RotationModelTabulationSettings >( startTime, endTime, angularAccuracy ) );
+    return rotationModelSettings;
+}
+
 //! @get_docstring(synchronousRotationModelSettings)
 inline std::shared_ptr< RotationModelSettings > synchronousRotationModelSettings(
         const std::string& centralBodyName,
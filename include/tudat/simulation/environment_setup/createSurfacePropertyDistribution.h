@@ -128,6 +128,22 @@ public:
         return sineCoefficients_;
     }
 
+    /*!
+     * Set resolution of the latitude/longitude grid on which the expansion is tabulated and interpolated, which is
+     * recommended for dynamically paneled sources with a high-degree expansion.
+     *
+     * @param interpolationGridResolution Angular grid resolution [rad], NaN to evaluate the full expansion
+     */
+    void setInterpolationGridResolution(double interpolationGridResolution)
+    {
+        interpolationGridResolution_ = interpolationGridResolution;
+    }
+
+    double getInterpolationGridResolution() const
+    {
+        return interpolationGridResolution_;
+    }
+
 private:
     SphericalHarmonicsSurfacePropertyDistributionModel model_;
 
@@ -136,6 +152,9 @@ private:
 
     // Sine spherical harmonic coefficients (not normalized)
     Eigen::MatrixXd sineCoefficients_;
+
+    // Resolution of interpolation grid, NaN if expansion is evaluated directly
+    double interpolationGridResolution_{TUDAT_NAN};
 };
 
 enum class SecondDegreeZonalPeriodicSurfacePropertyDistributionModel
@@ -30,6 +30,7 @@
 #include "tudat/astro/orbit_determination/acceleration_partials/panelledRadiationPressureAccelerationPartial.h"
 #include "tudat/astro/orbit_determination/acceleration_partials/thrustAccelerationPartial.h"
 #include "tudat/astro/orbit_determination/acceleration_partials/yarkovskyAccelerationPartial.h"
+#include "tudat/astro/orbit_determination/acceleration_partials/customAccelerationPartial.h"
 #include "tudat/astro/orbit_determination/observation_partials/rotationMatrixPartial.h"
 #include "tudat/simulation/estimation_setup/createCartesianStatePartials.h"
 #include "tudat/astro/basic_astro/accelerationModelTypes.h"
@@ -501,7 +502,8 @@ std::shared_ptr< acceleration_partials::AccelerationPartial > createAnalyticalAc
                           flightConditions,
                           std::bind( &Body::getState, acceleratedBody.second ),
                           std::bind( &Body::setState, acceleratedBody.second, std::placeholders::_1 ),
-                          acceleratedBody.first, acceleratingBody.first );
+                          acceleratedBody.first, acceleratingBody.first,
+                          std::bind( &Body::getCurrentAngularVelocityVectorInGlobalFrame, acceleratingBody.second ) );
             }
         }
         break;
@@ -545,8 +547,27 @@ std::shared_ptr< acceleration_partials::AccelerationPartial > createAnalyticalAc
         break;
     }
     case custom_acceleration:
-        std::cerr<<"Warning, custom acceleration partials implicitly set to zero - depending on thrust guidance model, this may provide biased results for variational equations"<<std::endl;
+    {
+        // Check if identifier is consistent with type.
+        std::shared_ptr< CustomAccelerationModel > customAcceleration =
+                std::dynamic_pointer_cast< CustomAccelerationModel >( accelerationModel );
+        if( customAcceleration == nullptr )
+        {
+            throw std::runtime_error(
+                        "Acceleration class type does not match acceleration type enum (custom) set when making acceleration partial." );
+        }
+        // Use exact (dual number) partials if the acceleration is defined as a function of state
+        else if( customAcceleration->hasStatePartials( ) )
+        {
+            accelerationPartial = std::make_shared< CustomAccelerationPartial >(
+                        customAcceleration, acceleratedBody.first, acceleratingBody.first );
+        }
+        else
+        {
+            std::cerr<<"Warning, custom acceleration partials implicitly set to zero - depending on thrust guidance model, this may provide biased results for variational equations"<<std::endl;
+        }
         break;
+    }
     case thrust_acceleration:
     {
         // Check if identifier is consistent with type.
@@ -349,6 +349,99 @@ createSingleLinkObservationPartials(
     return std::make_pair( observationPartials, positionScaling );
 }
 
+//! Class that creates and stores the one-way range partials of the constituent links of composite observables
+/*!
+ *  Class that creates and stores the one-way range partials of the constituent links of composite observables (n-way
+ *  range and two-way Doppler). For each combination of one-way link ends and light-time calculator, the partials
+ *  (and associated OneWayRangeScaling object) are created only once, and are shared by all composite observables that
+ *  contain this link. As the light-time calculators themselves are shared between observation models through the
+ *  LightTimeCalculatorRegistry, an n-way range and a two-way Doppler observable of the same link will use the same
+ *  one-way range partials. Each partial is wrapped in a CachedObservationPartial, so that, when caching is enabled
+ *  (see setPartialCaching), the one-way range partials of a link are computed only once per epoch.
+ */
+template< typename ParameterType, typename TimeType = double >
+class OneWayRangePartialRegistry
+{
+public:
+
+    //! Typedef for the one-way range partials of a single link, and the associated scaling object
+    typedef std::pair< std::map< std::pair< int, int >, std::shared_ptr< ObservationPartial< 1 > > >,
+    std::shared_ptr< PositionPartialScaling > > OneWayRangePartialsAndScaling;
+
+    //! Constructor
+    OneWayRangePartialRegistry( ){ }
+
+    //! Function to retrieve the one-way range partials of a single link, creating them if they do not yet exist
+    /*!
+     *  Function to retrieve the one-way range partials of a single link, creating them if they do not yet exist
+     *  for the given link ends and light-time calculator.
+     *  \param linkEnds Link ends (transmitter and receiver) of the one-way link
+     *  \param lightTimeCalculator Light-time calculator of the one-way link
+     *  \param bodies List of all bodies, for creating the partials
+     *  \param parametersToEstimate Set of parameters that are to be estimated
+     *  \return One-way range partials (wrapped in CachedObservationPartial objects), and associated scaling object
+     */
+    OneWayRangePartialsAndScaling getOneWayRangePartials(
+            const observation_models::LinkEnds& linkEnds,
+            const std::shared_ptr< observation_models::LightTimeCalculator< ParameterType, TimeType > > lightTimeCalculator,
+            const simulation_setup::SystemOfBodies& bodies,
+            const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ParameterType > > parametersToEstimate )
+    {
+        std::pair< observation_models::LinkEnds,
+                std::shared_ptr< observation_models::LightTimeCalculator< ParameterType, TimeType > > > registryKey =
+                std::make_pair( linkEnds, lightTimeCalculator );
+        if( oneWayRangePartials_.count( registryKey ) == 0 )
+        {
+            OneWayRangePartialsAndScaling currentPartials =
+                    createSingleLinkObservationPartials< ParameterType, 1, TimeType >(
+                        std::make_shared< observation_models::OneWayRangeObservationModel< ParameterType, TimeType > >(
+                            linkEnds, lightTimeCalculator ), bodies, parametersToEstimate, false );
+
+            // Wrap partials, so that they can be computed once per epoch
+            for( auto partialIterator : currentPartials.first )
+            {
+                std::shared_ptr< CachedObservationPartial< 1 > > cachedPartial =
+                        std::make_shared< CachedObservationPartial< 1 > >( partialIterator.second );
+                cachedPartials_.push_back( cachedPartial );
+                currentPartials.first[ partialIterator.first ] = cachedPartial;
+            }
+            oneWayRangePartials_[ registryKey ] = currentPartials;
+        }
+        return oneWayRangePartials_.at( registryKey );
+    }
+
+    //! Function to set whether the one-way range partials are stored per epoch (clearing the stored partials)
+    /*!
+     *  Function to set whether the one-way range partials are stored per epoch (clearing the stored partials). Caching should
+     *  only be enabled during a single pass over the observations, as the partials are invalidated by changes in the
+     *  environment (e.g. by a parameter update)
+     *  \param useCaching Boolean denoting whether the partials are to be stored
+     */
+    void setPartialCaching( const bool useCaching )
+    {
+        for( unsigned int i = 0; i < cachedPartials_.size( ); i++ )
+        {
+            cachedPartials_.at( i )->setPartialCaching( useCaching );
+        }
+    }
+
+    //! Function to retrieve the number of links for which one-way range partials have been created
+    int getNumberOfRegisteredLinks( )
+    {
+        return oneWayRangePartials_.size( );
+    }
+
+private:
+
+    //! One-way range partials and scaling object per combination of link ends and light-time calculator
+    std::map< std::pair< observation_models::LinkEnds,
+    std::shared_ptr< observation_models::LightTimeCalculator< ParameterType, TimeType > > >,
+    OneWayRangePartialsAndScaling > oneWayRangePartials_;
+
+    //! List of all created partials
+    std::vector< std::shared_ptr< CachedObservationPartial< 1 > > > cachedPartials_;
+};
+
 }
 
 }
@@ -54,6 +54,9 @@ namespace observation_partials
  *  requested bodies)
  *  \param lightTimeCorrections List of light time correction partials to be used (empty by default). First vector entry is
  *  index of link in 2-way link ends (up and downlink), second vector is list of light-time corrections.
+ *  \param oneWayRangePartialRegistry Registry from which the one-way range partials of the up- and downlink are
+ *  retrieved, so that they are shared with other composite observables of the same links (if nullptr, the partials are
+ *  created for this observable only).
  *  \return Set of observation partials with associated indices in complete vector of parameters that are estimated,
  *  representing all  necessary two-way Doppler partials of a single link end, and TwoWayDopplerScaling, object, used for
  *  scaling the position partial members of all TwoWayDopplerPartials in link end.
@@ -63,7 +66,8 @@ std::pair< SingleLinkObservationPartialList, std::shared_ptr< PositionPartialSca
         const std::shared_ptr< observation_models::ObservationModel< 1, ParameterType, TimeType > > observationModel,
         const simulation_setup::SystemOfBodies& bodies,
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ParameterType > > parametersToEstimate,
-        const bool useBiasPartials = true  )
+        const bool useBiasPartials = true,
+        const std::shared_ptr< OneWayRangePartialRegistry< ParameterType, TimeType > > oneWayRangePartialRegistry = nullptr )
 
 {    
     std::shared_ptr< observation_models::TwoWayDopplerObservationModel< ParameterType, TimeType > >  twoWayObservationModel =
@@ -129,11 +133,21 @@ std::pair< SingleLinkObservationPartialList, std::shared_ptr< PositionPartialSca
                     createSingleLinkObservationPartials< ParameterType, 1, TimeType >(
                         currentDopplerModel, bodies, parametersToEstimate, false ) );
 
-        constituentOneWayRangePartials.push_back(
-                    createSingleLinkObservationPartials< ParameterType, 1, TimeType >(
-                        std::make_shared< observation_models::OneWayRangeObservationModel< ParameterType, TimeType > >(
-                            currentLinkEnds, currentDopplerModel->getLightTimeCalculator( ) ), bodies,
-                        parametersToEstimate, false ) );
+        if( oneWayRangePartialRegistry != nullptr )
+        {
+            constituentOneWayRangePartials.push_back(
+                        oneWayRangePartialRegistry->getOneWayRangePartials(
+                            currentLinkEnds, currentDopplerModel->getLightTimeCalculator( ), bodies,
+                            parametersToEstimate ) );
+        }
+        else
+        {
+            constituentOneWayRangePartials.push_back(
+                        createSingleLinkObservationPartials< ParameterType, 1, TimeType >(
+                            std::make_shared< observation_models::OneWayRangeObservationModel< ParameterType, TimeType > >(
+                                currentLinkEnds, currentDopplerModel->getLightTimeCalculator( ) ), bodies,
+                            parametersToEstimate, false ) );
+        }
     }
 
     // Retrieve sorted (by parameter index and link index) one-way range partials and (by link index) opne-way range partials
@@ -11,6 +11,9 @@
 #ifndef TUDAT_CREATELIGHTTIMECALCULATOR_H
 #define TUDAT_CREATELIGHTTIMECALCULATOR_H
 
+#include <map>
+#include <tuple>
+
 #include "tudat/astro/ephemerides/compositeEphemeris.h"
 #include "tudat/astro/observation_models/lightTimeSolution.h"
 #include "tudat/astro/observation_models/linkTypeDefs.h"
@@ -65,6 +68,83 @@ createLightTimeCalculator(
               lightTimeConvergenceCriteria );
 }
 
+//! Class to create light-time calculation objects that are shared between observation models
+/*!
+ *  Class to create light-time calculation objects that are shared between observation models, so that (with solution
+ *  caching enabled, see LightTimeCalculator::setSolutionCaching) the light time of a given link at a given epoch is solved
+ *  only once, even if it is required by multiple observables (e.g. range, Doppler and angular position of the same
+ *  link, or the legs of two-way observables) and their partials. A single calculator is created for each combination of
+ *  transmitter, receiver, list of light-time correction settings and convergence criteria. The light-time correction
+ *  settings are compared by identity (i.e. the same settings objects must be used for the calculator to be shared), the
+ *  convergence criteria are compared by value.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+class LightTimeCalculatorRegistry
+{
+public:
+
+    //! Constructor
+    LightTimeCalculatorRegistry( ){ }
+
+    //! Function to retrieve the light-time calculation object for a given link, creating it if it does not exist yet
+    /*!
+     *  Function to retrieve the light-time calculation object for a given link, creating it if it does not exist yet
+     *  \param transmittingLinkEnd Identifier for transmitting link end.
+     *  \param receivingLinkEnd Identifier for receiving link end.
+     *  \param bodies List of body objects that comprises the environment
+     *  \param lightTimeCorrections List of light time corrections (w.r.t. Euclidean distance) that are applied when
+     *  computing light time.
+     *  \param lightTimeConvergenceCriteria Convergence criteria of the light-time iteration
+     *  \return Light-time calculation object for the given link
+     */
+    std::shared_ptr< LightTimeCalculator< ObservationScalarType, TimeType > > getLightTimeCalculator(
+            const LinkEndId& transmittingLinkEnd,
+            const LinkEndId& receivingLinkEnd,
+            const simulation_setup::SystemOfBodies& bodies,
+            const std::vector< std::shared_ptr< LightTimeCorrectionSettings > >& lightTimeCorrections,
+            const std::shared_ptr< LightTimeConvergenceCriteria > lightTimeConvergenceCriteria )
+    {
+        LightTimeCalculatorKey calculatorKey = std::make_tuple(
+                    transmittingLinkEnd, receivingLinkEnd, lightTimeCorrections,
+                    lightTimeConvergenceCriteria->iterateCorrections_,
+                    lightTimeConvergenceCriteria->maximumNumberOfIterations_,
+                    static_cast< int >( lightTimeConvergenceCriteria->failureHandling_ ),
+                    lightTimeConvergenceCriteria->getAbsoluteTolerance< ObservationScalarType >( ) );
+
+        if( lightTimeCalculators_.count( calculatorKey ) == 0 )
+        {
+            lightTimeCalculators_[ calculatorKey ] = createLightTimeCalculator< ObservationScalarType, TimeType >(
+                        simulation_setup::getLinkEndCompleteEphemerisFunction< TimeType, ObservationScalarType >(
+                            transmittingLinkEnd, bodies ),
+                        simulation_setup::getLinkEndCompleteEphemerisFunction< TimeType, ObservationScalarType >(
+                            receivingLinkEnd, bodies ),
+                        bodies, lightTimeCorrections, transmittingLinkEnd, receivingLinkEnd, lightTimeConvergenceCriteria );
+        }
+        return lightTimeCalculators_.at( calculatorKey );
+    }
+
+    //! Function to retrieve all light-time calculation objects that have been created by this object
+    std::vector< std::shared_ptr< LightTimeCalculator< ObservationScalarType, TimeType > > > getLightTimeCalculators( )
+    {
+        std::vector< std::shared_ptr< LightTimeCalculator< ObservationScalarType, TimeType > > > lightTimeCalculators;
+        for( auto it : lightTimeCalculators_ )
+        {
+            lightTimeCalculators.push_back( it.second );
+        }
+        return lightTimeCalculators;
+    }
+
+private:
+
+    //! Typedef for the identifier of a light-time calculator (link ends, corrections and convergence criteria)
+    typedef std::tuple< LinkEndId, LinkEndId, std::vector< std::shared_ptr< LightTimeCorrectionSettings > >,
+    bool, int, int, double > LightTimeCalculatorKey;
+
+    //! Light-time calculation objects that have been created by this object
+    std::map< LightTimeCalculatorKey, std::shared_ptr< LightTimeCalculator< ObservationScalarType, TimeType > > >
+    lightTimeCalculators_;
+};
+
 //! Function to create a light-time calculation object
 /*!
  *  Function to create a light-time calculation object from light time correction settings environment and link end
@@ -74,6 +154,9 @@ createLightTimeCalculator(
  *  \param bodies List of body objects that comprises the environment
  *  \param lightTimeCorrections List of light time corrections (w.r.t. Euclidean distance) that are applied when computing
  *  light time.
+ *  \param lightTimeConvergenceCriteria Convergence criteria of the light-time iteration
+ *  \param lightTimeCalculatorRegistry Object from which a (shared) light-time calculator is retrieved. If nullptr (default),
+ *  a new light-time calculator is created.
  */
 template< typename ObservationScalarType = double, typename TimeType = double >
 std::shared_ptr< observation_models::LightTimeCalculator< ObservationScalarType, TimeType > >
@@ -84,8 +167,15 @@ createLightTimeCalculator(
         const std::vector< std::shared_ptr< LightTimeCorrectionSettings > >& lightTimeCorrections =
         std::vector< std::shared_ptr< LightTimeCorrectionSettings > >( ),
         const std::shared_ptr< LightTimeConvergenceCriteria > lightTimeConvergenceCriteria
-        = std::make_shared< LightTimeConvergenceCriteria >( ) )
+        = std::make_shared< LightTimeConvergenceCriteria >( ),
+        const std::shared_ptr< LightTimeCalculatorRegistry< ObservationScalarType, TimeType > > lightTimeCalculatorRegistry
+        = nullptr )
 {
+    if( lightTimeCalculatorRegistry != nullptr )
+    {
+        return lightTimeCalculatorRegistry->getLightTimeCalculator(
+                    transmittingLinkEnd, receivingLinkEnd, bodies, lightTimeCorrections, lightTimeConvergenceCriteria );
+    }
 
     // Get link end state functions and create light time calculator.
     return createLightTimeCalculator< ObservationScalarType, TimeType >(
@@ -45,6 +45,9 @@ namespace observation_partials
  *  requested bodies)
  *  \param lightTimeCorrections List of light time correction partials to be used (empty by default). First vector entry is
  *  index of link in n-way link ends, second vector is list of light-time corrections.
+ *  \param oneWayRangePartialRegistry Registry from which the one-way range partials of the constituent links are
+ *  retrieved, so that they are shared with other composite observables of the same links (if nullptr, the partials are
+ *  created for this observable only).
  *  \return Set of observation partials with associated indices in complete vector of parameters that are estimated,
  *  representing all  necessary n-way range partials of a single link end, and NWayRangeScaling, object, used for
  *  scaling the position partial members of all NWayRangePartials in link end.
@@ -54,7 +57,8 @@ std::pair< SingleLinkObservationPartialList, std::shared_ptr< PositionPartialSca
         const std::shared_ptr< observation_models::ObservationModel< 1, ParameterType, TimeType > > observationModel,
         const simulation_setup::SystemOfBodies& bodies,
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ParameterType > > parametersToEstimate,
-        const bool useBiasPartials = true )
+        const bool useBiasPartials = true,
+        const std::shared_ptr< OneWayRangePartialRegistry< ParameterType, TimeType > > oneWayRangePartialRegistry = nullptr )
 {
     using namespace observation_models;
 
@@ -97,11 +101,20 @@ std::pair< SingleLinkObservationPartialList, std::shared_ptr< PositionPartialSca
                     observation_models::getNWayLinkEnumFromIndex( i + 1, numberOfLinkEnds ) );
 
         // Create onw-way range partials for current link
-        constituentOneWayRangePartials[ i ] =
-                createSingleLinkObservationPartials< ParameterType, 1, TimeType >
-                ( std::make_shared< OneWayRangeObservationModel< ParameterType, TimeType > >(
-                      currentLinkEnds, nWayRangeObservationModel->getLightTimeCalculators( ).at( i ) ),
-                  bodies, parametersToEstimate, false );
+        if( oneWayRangePartialRegistry != nullptr )
+        {
+            constituentOneWayRangePartials[ i ] = oneWayRangePartialRegistry->getOneWayRangePartials(
+                        currentLinkEnds, nWayRangeObservationModel->getLightTimeCalculators( ).at( i ),
+                        bodies, parametersToEstimate );
+        }
+        else
+        {
+            constituentOneWayRangePartials[ i ] =
+                    createSingleLinkObservationPartials< ParameterType, 1, TimeType >
+                    ( std::make_shared< OneWayRangeObservationModel< ParameterType, TimeType > >(
+                          currentLinkEnds, nWayRangeObservationModel->getLightTimeCalculators( ).at( i ) ),
+                      bodies, parametersToEstimate, false );
+        }
     }
 
     // Retrieve sorted (by parameter index and link index) one-way range partials and (by link index) opne-way range partials
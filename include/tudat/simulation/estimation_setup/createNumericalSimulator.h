@@ -93,6 +93,9 @@ std::shared_ptr< propagators::DynamicsSimulator< StateScalarType, TimeType > > c
 *  (default true) after propagation and resetting of state transition interface.
 *  \param integrateEquationsOnCreation Boolean to denote whether equations should be integrated immediately at the
 *  end of this contructor.
+*  \param arcWiseBodies List of bodies that are to be used for the propagation of each arc, for multi- and hybrid-arc dynamics
+*  only (see MultiArcVariationalEquationsSolver and HybridArcVariationalEquationsSolver; empty by default, in which case bodies
+*  is used for all arcs)
 *  \return Variational equations solver object
 */
 template< typename StateScalarType = double, typename TimeType = double >
@@ -101,8 +104,15 @@ createVariationalEquationsSolver(
         const simulation_setup::SystemOfBodies& bodies,
         const std::shared_ptr< propagators::PropagatorSettings< StateScalarType > > propagatorSettings,
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet<  StateScalarType > > parametersToEstimate,
-        const bool integrateEquationsOnCreation = 1 )
+        const bool integrateEquationsOnCreation = 1,
+        const std::vector< simulation_setup::SystemOfBodies >& arcWiseBodies = std::vector< simulation_setup::SystemOfBodies >( ) )
 {
+    if( arcWiseBodies.size( ) > 0 &&
+            std::dynamic_pointer_cast< propagators::SingleArcPropagatorSettings< StateScalarType, TimeType > >( propagatorSettings ) != nullptr )
+    {
+        throw std::runtime_error( "Error when creating variational equations solver, arc-wise bodies are only supported for multi- and hybrid-arc dynamics" );
+    }
+
     if( std::dynamic_pointer_cast< propagators::SingleArcPropagatorSettings< StateScalarType, TimeType > >( propagatorSettings ) != nullptr )
     {
         return std::make_shared< propagators::SingleArcVariationalEquationsSolver< StateScalarType, TimeType > >(
@@ -113,13 +123,13 @@ createVariationalEquationsSolver(
     {
         return std::make_shared< propagators::MultiArcVariationalEquationsSolver< StateScalarType, TimeType > >(
                     bodies, std::dynamic_pointer_cast< propagators::MultiArcPropagatorSettings< StateScalarType, TimeType > >(
-                        propagatorSettings ), parametersToEstimate, integrateEquationsOnCreation );
+                        propagatorSettings ), parametersToEstimate, integrateEquationsOnCreation, arcWiseBodies );
     }
     else if( std::dynamic_pointer_cast< propagators::HybridArcPropagatorSettings< StateScalarType, TimeType > >( propagatorSettings ) != nullptr )
     {
         return std::make_shared< propagators::HybridArcVariationalEquationsSolver< StateScalarType, TimeType > >(
                     bodies, std::dynamic_pointer_cast< propagators::HybridArcPropagatorSettings< StateScalarType, TimeType > >(
-                        propagatorSettings ), parametersToEstimate, integrateEquationsOnCreation );
+                        propagatorSettings ), parametersToEstimate, integrateEquationsOnCreation, arcWiseBodies );
     }
     else
     {
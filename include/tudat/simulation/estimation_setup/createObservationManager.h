@@ -433,6 +433,11 @@ void performObservationParameterEstimationClosure(
  *  \param bodies Map of Body objects that comprise the environment
  *  \param parametersToEstimate Object containing the list of all parameters that are to be estimated
  *  \param stateTransitionMatrixInterface Object used to compute the state transition/sensitivity matrix at a given time
+ *  \param dependentVariablesInterface Object used to compute dependent variables at a given time
+ *  \param lightTimeCalculatorRegistry Object from which light-time calculators are retrieved, so that they are shared
+ *  with other observation models (default nullptr: new light-time calculators are created).
+ *  \param oneWayRangePartialRegistry Object from which the one-way range partials of the constituent links of composite
+ *  observables are retrieved, so that they are shared with other observables (default nullptr: new partials are created).
  *  \return Object that simulates the observations of a given type and associated partials
  */
 template< int ObservationSize = 1, typename ObservationScalarType, typename TimeType >
@@ -445,7 +450,10 @@ std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > cre
         const std::shared_ptr< propagators::CombinedStateTransitionAndSensitivityMatrixInterface >
         stateTransitionMatrixInterface,
         const std::shared_ptr< propagators::DependentVariablesInterface< TimeType > > dependentVariablesInterface =
-                std::shared_ptr< propagators::DependentVariablesInterface< TimeType > >( ) )
+                std::shared_ptr< propagators::DependentVariablesInterface< TimeType > >( ),
+        const std::shared_ptr< LightTimeCalculatorRegistry< ObservationScalarType, TimeType > > lightTimeCalculatorRegistry = nullptr,
+        const std::shared_ptr< observation_partials::OneWayRangePartialRegistry< ObservationScalarType, TimeType > >
+        oneWayRangePartialRegistry = nullptr )
 {
     using namespace observation_models;
     using namespace observation_partials;
@@ -453,7 +461,7 @@ std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > cre
     // Create observation simulator
     std::shared_ptr< ObservationSimulator< ObservationSize, ObservationScalarType, TimeType > > observationSimulator =
             createObservationSimulator< ObservationSize, ObservationScalarType, TimeType >(
-                observableType, observationModelSettingsList, bodies );
+                observableType, observationModelSettingsList, bodies, lightTimeCalculatorRegistry );
 
     performObservationParameterEstimationClosure(
                 observationSimulator, parametersToEstimate );
@@ -466,7 +474,8 @@ std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > cre
     {
         observationPartialsAndScaler =
                 createObservablePartialsList(
-                    observationSimulator->getObservationModels( ), bodies, parametersToEstimate, true, dependentVariablesInterface );
+                    observationSimulator->getObservationModels( ), bodies, parametersToEstimate, true, dependentVariablesInterface,
+                    oneWayRangePartialRegistry );
     }
 
     // Split position partial scaling and observation partial objects.
@@ -491,6 +500,11 @@ std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > cre
  *  \param bodies Map of Body objects that comprise the environment
  *  \param parametersToEstimate Object containing the list of all parameters that are to be estimated
  *  \param stateTransitionMatrixInterface Object used to compute the state transition/sensitivity matrix at a given time
+ *  \param dependentVariablesInterface Object used to compute dependent variables at a given time
+ *  \param lightTimeCalculatorRegistry Object from which light-time calculators are retrieved, so that they are shared
+ *  with other observation models (default nullptr: new light-time calculators are created).
+ *  \param oneWayRangePartialRegistry Object from which the one-way range partials of the constituent links of composite
+ *  observables are retrieved, so that they are shared with other observables (default nullptr: new partials are created).
  *  \return Object that simulates the observations of a given type and associated partials
  */
 template< typename ObservationScalarType, typename TimeType >
@@ -501,7 +515,10 @@ std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > cre
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > > parametersToEstimate,
         const std::shared_ptr< propagators::CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionMatrixInterface,
         const std::shared_ptr< propagators::DependentVariablesInterface< TimeType > > dependentVariablesInterface =
-                std::shared_ptr< propagators::DependentVariablesInterface< TimeType > >( ) )
+                std::shared_ptr< propagators::DependentVariablesInterface< TimeType > >( ),
+        const std::shared_ptr< LightTimeCalculatorRegistry< ObservationScalarType, TimeType > > lightTimeCalculatorRegistry = nullptr,
+        const std::shared_ptr< observation_partials::OneWayRangePartialRegistry< ObservationScalarType, TimeType > >
+        oneWayRangePartialRegistry = nullptr )
 {
     std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > observationManager;
     switch( observableType )
@@ -509,57 +526,68 @@ std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > cre
     case one_way_range:
         observationManager = createObservationManager< 1, ObservationScalarType, TimeType >(
                     observableType, observationModelSettingsList, bodies, parametersToEstimate,
-                    stateTransitionMatrixInterface, dependentVariablesInterface );
+                    stateTransitionMatrixInterface, dependentVariablesInterface, lightTimeCalculatorRegistry,
+                    oneWayRangePartialRegistry );
         break;
     case n_way_range:
         observationManager = createObservationManager< 1, ObservationScalarType, TimeType >(
                     observableType, observationModelSettingsList, bodies, parametersToEstimate,
-                    stateTransitionMatrixInterface, dependentVariablesInterface );
+                    stateTransitionMatrixInterface, dependentVariablesInterface, lightTimeCalculatorRegistry,
+                    oneWayRangePartialRegistry );
         break;
     case one_way_doppler:
         observationManager = createObservationManager< 1, ObservationScalarType, TimeType >(
                     observableType, observationModelSettingsList, bodies, parametersToEstimate,
-                    stateTransitionMatrixInterface, dependentVariablesInterface );
+                    stateTransitionMatrixInterface, dependentVariablesInterface, lightTimeCalculatorRegistry,
+                    oneWayRangePartialRegistry );
         break;
     case two_way_doppler:
         observationManager = createObservationManager< 1, ObservationScalarType, TimeType >(
                     observableType, observationModelSettingsList, bodies, parametersToEstimate,
-                    stateTransitionMatrixInterface, dependentVariablesInterface );
+                    stateTransitionMatrixInterface, dependentVariablesInterface, lightTimeCalculatorRegistry,
+                    oneWayRangePartialRegistry );
         break;
     case one_way_differenced_range:
         observationManager = createObservationManager< 1, ObservationScalarType, TimeType >(
                     observableType, observationModelSettingsList, bodies, parametersToEstimate,
-                    stateTransitionMatrixInterface, dependentVariablesInterface );
+                    stateTransitionMatrixInterface, dependentVariablesInterface, lightTimeCalculatorRegistry,
+                    oneWayRangePartialRegistry );
         break;
     case angular_position:
         observationManager = createObservationManager< 2, ObservationScalarType, TimeType >(
                     observableType, observationModelSettingsList, bodies, parametersToEstimate,
-                    stateTransitionMatrixInterface, dependentVariablesInterface );
+                    stateTransitionMatrixInterface, dependentVariablesInterface, lightTimeCalculatorRegistry,
+                    oneWayRangePartialRegistry );
         break;
     case position_observable:
         observationManager = createObservationManager< 3, ObservationScalarType, TimeType >(
                     observableType, observationModelSettingsList, bodies, parametersToEstimate,
-                    stateTransitionMatrixInterface, dependentVariablesInterface );
+                    stateTransitionMatrixInterface, dependentVariablesInterface, lightTimeCalculatorRegistry,
+                    oneWayRangePartialRegistry );
         break;
     case euler_angle_313_observable:
         observationManager = createObservationManager< 3, ObservationScalarType, TimeType >(
                     observableType, observationModelSettingsList, bodies, parametersToEstimate,
-                    stateTransitionMatrixInterface, dependentVariablesInterface );
+                    stateTransitionMatrixInterface, dependentVariablesInterface, lightTimeCalculatorRegistry,
+                    oneWayRangePartialRegistry );
         break;
     case velocity_observable:
         observationManager = createObservationManager< 3, ObservationScalarType, TimeType >(
                     observableType, observationModelSettingsList, bodies, parametersToEstimate,
-                    stateTransitionMatrixInterface, dependentVariablesInterface );
+                    stateTransitionMatrixInterface, dependentVariablesInterface, lightTimeCalculatorRegistry,
+                    oneWayRangePartialRegistry );
         break;
     case relative_angular_position:
         observationManager = createObservationManager< 2, ObservationScalarType, TimeType >(
                 observableType, observationModelSettingsList, bodies, parametersToEstimate,
-                        stateTransitionMatrixInterface, dependentVariablesInterface );
+                        stateTransitionMatrixInterface, dependentVariablesInterface, lightTimeCalculatorRegistry,
+                    oneWayRangePartialRegistry );
         break;
     case relative_position_observable:
         observationManager = createObservationManager< 3, ObservationScalarType, TimeType >(
                 observableType, observationModelSettingsList, bodies, parametersToEstimate,
-                stateTransitionMatrixInterface, dependentVariablesInterface );
+                stateTransitionMatrixInterface, dependentVariablesInterface, lightTimeCalculatorRegistry,
+                    oneWayRangePartialRegistry );
         break;
     default:
         throw std::runtime_error(
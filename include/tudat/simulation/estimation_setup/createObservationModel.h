@@ -1446,12 +1446,15 @@ public:
      * \param linkEnds Link ends for observation model that is to be created
      * \param observationSettings Settings for observation model that is to be created.
      * \param bodies List of body objects that comprises the environment
+     * \param lightTimeCalculatorRegistry Object from which light-time calculators are retrieved, so that they are shared
+     * with other observation models (default nullptr: new light-time calculators are created).
      * \return Observation model of required settings.
      */
     static std::shared_ptr< observation_models::ObservationModel<
     ObservationSize, ObservationScalarType, TimeType > > createObservationModel(
             const std::shared_ptr< ObservationModelSettings > observationSettings,
-            const simulation_setup::SystemOfBodies &bodies );
+            const simulation_setup::SystemOfBodies &bodies,
+            const std::shared_ptr< LightTimeCalculatorRegistry< ObservationScalarType, TimeType > > lightTimeCalculatorRegistry = nullptr );
 };
 
 //! Interface class for creating observation models of size 1.
@@ -1466,12 +1469,15 @@ public:
      * \param linkEnds Link ends for observation model that is to be created
      * \param observationSettings Settings for observation model that is to be created (must be for observation model if size 1).
      * \param bodies List of body objects that comprises the environment
+     * \param lightTimeCalculatorRegistry Object from which light-time calculators are retrieved, so that they are shared
+     * with other observation models (default nullptr: new light-time calculators are created).
      * \return Observation model of required settings.
      */
     static std::shared_ptr< observation_models::ObservationModel<
     1, ObservationScalarType, TimeType > > createObservationModel(
             const std::shared_ptr< ObservationModelSettings > observationSettings,
-            const simulation_setup::SystemOfBodies &bodies )
+            const simulation_setup::SystemOfBodies &bodies,
+            const std::shared_ptr< LightTimeCalculatorRegistry< ObservationScalarType, TimeType > > lightTimeCalculatorRegistry = nullptr )
     {
         using namespace observation_models;
 
@@ -1514,7 +1520,8 @@ public:
                     ObservationScalarType, TimeType > >(
                         linkEnds, createLightTimeCalculator< ObservationScalarType, TimeType >(
                             linkEnds.at( transmitter ), linkEnds.at( receiver ),
-                            bodies, observationSettings->lightTimeCorrectionsList_ ),
+                            bodies, observationSettings->lightTimeCorrectionsList_,
+                            std::make_shared< LightTimeConvergenceCriteria >( ), lightTimeCalculatorRegistry ),
                         observationBias );
 
             break;
@@ -1554,7 +1561,8 @@ public:
                             linkEnds,
                             createLightTimeCalculator< ObservationScalarType, TimeType >(
                                 linkEnds.at( transmitter ), linkEnds.at( receiver ),
-                                bodies, observationSettings->lightTimeCorrectionsList_ ),
+                                bodies, observationSettings->lightTimeCorrectionsList_,
+                                std::make_shared< LightTimeConvergenceCriteria >( ), lightTimeCalculatorRegistry ),
                             observationBias,
                             std::function< ObservationScalarType( const TimeType ) >( ),
                             std::function< ObservationScalarType( const TimeType ) >( ),
@@ -1586,7 +1594,8 @@ public:
                             linkEnds,
                             createLightTimeCalculator< ObservationScalarType, TimeType >(
                                 linkEnds.at( transmitter ), linkEnds.at( receiver ),
-                                bodies, observationSettings->lightTimeCorrectionsList_ ),
+                                bodies, observationSettings->lightTimeCorrectionsList_,
+                                std::make_shared< LightTimeConvergenceCriteria >( ), lightTimeCalculatorRegistry ),
                             transmitterProperTimeRate,
                             receiverProperTimeRate,
                             observationBias,
@@ -1650,11 +1659,11 @@ public:
                             std::dynamic_pointer_cast< OneWayDopplerObservationModel< ObservationScalarType, TimeType > >(
                                 ObservationModelCreator< 1, ObservationScalarType, TimeType >::createObservationModel(
                                     std::make_shared< ObservationModelSettings >(
-                                        one_way_doppler, uplinkLinkEnds, observationSettings->lightTimeCorrectionsList_ ), bodies ) ),
+                                        one_way_doppler, uplinkLinkEnds, observationSettings->lightTimeCorrectionsList_ ), bodies, lightTimeCalculatorRegistry ) ),
                             std::dynamic_pointer_cast< OneWayDopplerObservationModel< ObservationScalarType, TimeType > >(
                                 ObservationModelCreator< 1, ObservationScalarType, TimeType >::createObservationModel(
                                     std::make_shared< ObservationModelSettings >(
-                                        one_way_doppler, downlinkLinkEnds, observationSettings->lightTimeCorrectionsList_ ), bodies ) ),
+                                        one_way_doppler, downlinkLinkEnds, observationSettings->lightTimeCorrectionsList_ ), bodies, lightTimeCalculatorRegistry ) ),
                             observationBias );
             }
             else
@@ -1664,10 +1673,10 @@ public:
                             linkEnds,
                             std::dynamic_pointer_cast< OneWayDopplerObservationModel< ObservationScalarType, TimeType > >(
                                 ObservationModelCreator< 1, ObservationScalarType, TimeType >::createObservationModel(
-                                    twoWayDopplerSettings->uplinkOneWayDopplerSettings_, bodies ) ),
+                                    twoWayDopplerSettings->uplinkOneWayDopplerSettings_, bodies, lightTimeCalculatorRegistry ) ),
                             std::dynamic_pointer_cast< OneWayDopplerObservationModel< ObservationScalarType, TimeType > >(
                                 ObservationModelCreator< 1, ObservationScalarType, TimeType >::createObservationModel(
-                                    twoWayDopplerSettings->downlinkOneWayDopplerSettings_, bodies ) ),
+                                    twoWayDopplerSettings->downlinkOneWayDopplerSettings_, bodies, lightTimeCalculatorRegistry ) ),
                             observationBias, twoWayDopplerSettings->normalizeWithSpeedOfLight_ );
             }
 
@@ -1799,14 +1808,16 @@ public:
                                 createLightTimeCalculator< ObservationScalarType, TimeType >(
                                     transmitterIterator->second, receiverIterator->second,
                                     bodies, nWayRangeObservationSettings->oneWayRangeObsevationSettings_.at( i )->
-                                    lightTimeCorrectionsList_ ) );
+                                    lightTimeCorrectionsList_,
+                                    std::make_shared< LightTimeConvergenceCriteria >( ), lightTimeCalculatorRegistry ) );
                 }
                 else
                 {
                     lightTimeCalculators.push_back(
                                 createLightTimeCalculator< ObservationScalarType, TimeType >(
                                     transmitterIterator->second, receiverIterator->second,
-                                    bodies, observationSettings->lightTimeCorrectionsList_ ) );
+                                    bodies, observationSettings->lightTimeCorrectionsList_,
+                                    std::make_shared< LightTimeConvergenceCriteria >( ), lightTimeCalculatorRegistry ) );
                 }
 
                 transmitterIterator++;
@@ -1888,12 +1899,15 @@ public:
      * \param linkEnds Link ends for observation model that is to be created
      * \param observationSettings Settings for observation model that is to be created (must be for observation model if size 1).
      * \param bodies List of body objects that comprises the environment
+     * \param lightTimeCalculatorRegistry Object from which light-time calculators are retrieved, so that they are shared
+     * with other observation models (default nullptr: new light-time calculators are created).
      * \return Observation model of required settings.
      */
     static std::shared_ptr< observation_models::ObservationModel<
     2, ObservationScalarType, TimeType > > createObservationModel(
             const std::shared_ptr< ObservationModelSettings > observationSettings,
-            const simulation_setup::SystemOfBodies &bodies )
+            const simulation_setup::SystemOfBodies &bodies,
+            const std::shared_ptr< LightTimeCalculatorRegistry< ObservationScalarType, TimeType > > lightTimeCalculatorRegistry = nullptr )
     {
         using namespace observation_models;
         std::shared_ptr< observation_models::ObservationModel<
@@ -1937,7 +1951,8 @@ public:
                         linkEnds,
                         createLightTimeCalculator< ObservationScalarType, TimeType >(
                             linkEnds.at( transmitter ), linkEnds.at( receiver ),
-                            bodies, observationSettings->lightTimeCorrectionsList_ ),
+                            bodies, observationSettings->lightTimeCorrectionsList_,
+                            std::make_shared< LightTimeConvergenceCriteria >( ), lightTimeCalculatorRegistry ),
                         observationBias );
 
             break;
@@ -1978,9 +1993,11 @@ public:
             observationModel = std::make_shared< RelativeAngularPositionObservationModel<
                     ObservationScalarType, TimeType > >(
                         linkEnds, createLightTimeCalculator< ObservationScalarType, TimeType >(
-                            linkEnds.at( transmitter ), linkEnds.at( receiver ), bodies, observationSettings->lightTimeCorrectionsList_ ),
+                            linkEnds.at( transmitter ), linkEnds.at( receiver ), bodies, observationSettings->lightTimeCorrectionsList_,
+                            std::make_shared< LightTimeConvergenceCriteria >( ), lightTimeCalculatorRegistry ),
                         createLightTimeCalculator< ObservationScalarType, TimeType >(
-                            linkEnds.at( transmitter2 ), linkEnds.at( receiver ), bodies, observationSettings->lightTimeCorrectionsList_ ), observationBias );
+                            linkEnds.at( transmitter2 ), linkEnds.at( receiver ), bodies, observationSettings->lightTimeCorrectionsList_,
+                            std::make_shared< LightTimeConvergenceCriteria >( ), lightTimeCalculatorRegistry ), observationBias );
 
             break;
         }
@@ -2009,11 +2026,14 @@ public:
      * \param linkEnds Link ends for observation model that is to be created
      * \param observationSettings Settings for observation model that is to be created (must be for observation model if size 1).
      * \param bodies List of body objects that comprises the environment
+     * \param lightTimeCalculatorRegistry Object from which light-time calculators are retrieved, so that they are shared
+     * with other observation models (default nullptr: new light-time calculators are created).
      * \return Observation model of required settings.
      */
     static std::shared_ptr< observation_models::ObservationModel< 3, ObservationScalarType, TimeType > > createObservationModel(
             const std::shared_ptr< ObservationModelSettings > observationSettings,
-            const simulation_setup::SystemOfBodies &bodies )
+            const simulation_setup::SystemOfBodies &bodies,
+            const std::shared_ptr< LightTimeCalculatorRegistry< ObservationScalarType, TimeType > > lightTimeCalculatorRegistry = nullptr )
     {
         using namespace observation_models;
         std::shared_ptr< observation_models::ObservationModel<
@@ -2232,13 +2252,16 @@ public:
  *  \param settingsPerLinkEnds Map of settings for the observation models that are to be created in the simulator object: one
  *  for each required set of link ends (each settings object must be consistent with observableType).
  *  \param bodies Map of Body objects that comprise the environment
+ *  \param lightTimeCalculatorRegistry Object from which light-time calculators are retrieved, so that they are shared
+ *  with other observation models (default nullptr: new light-time calculators are created).
  *  \return Object that simulates the observables according to the provided settings.
  */
 template< int ObservationSize = 1, typename ObservationScalarType = double, typename TimeType = double >
 std::shared_ptr< ObservationSimulator< ObservationSize, ObservationScalarType, TimeType > > createObservationSimulator(
         const ObservableType observableType,
         const std::vector< std::shared_ptr< ObservationModelSettings  > > settingsList,
-        const simulation_setup::SystemOfBodies &bodies )
+        const simulation_setup::SystemOfBodies &bodies,
+        const std::shared_ptr< LightTimeCalculatorRegistry< ObservationScalarType, TimeType > > lightTimeCalculatorRegistry = nullptr )
 {
     std::map< LinkEnds, std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > >
             observationModels;
@@ -2248,7 +2271,7 @@ std::shared_ptr< ObservationSimulator< ObservationSize, ObservationScalarType, T
     {
         observationModels[ settingsList.at( i )->linkEnds_.linkEnds_ ] = ObservationModelCreator<
                 ObservationSize, ObservationScalarType, TimeType >::createObservationModel(
-                    settingsList.at( i ), bodies );
+                    settingsList.at( i ), bodies, lightTimeCalculatorRegistry );
     }
 
     return std::make_shared< ObservationSimulator< ObservationSize, ObservationScalarType, TimeType > >(
@@ -2257,7 +2280,11 @@ std::shared_ptr< ObservationSimulator< ObservationSize, ObservationScalarType, T
 
 //! Function to create a map of object to simulate observations (one object for each type of observable).
 /*!
- *  Function to create a map of object to simulate observations (one object for each type of observable).
+ *  Function to create a map of object to simulate observations (one object for each type of observable). The light-time
+ *  calculators of all created observation models are created from a single LightTimeCalculatorRegistry, so that they are
+ *  shared between the observation models of the same link (with the same light-time correction settings objects). The
+ *  shared calculators are set in each observation simulator, to allow light-time solution caching during a single
+ *  simulation pass (see setLightTimeSolutionCaching).
  *  \param observationSettingsList List of settings for the observation models that are to be created in the simulator object
  *  \param bodies Map of Body objects that comprise the environment
  *  \return List of objects that simulate the observables according to the provided settings.
@@ -2270,6 +2297,8 @@ std::vector< std::shared_ptr< ObservationSimulatorBase< ObservationScalarType, T
     std::vector< std::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > > observationSimulators;
     std::map< ObservableType, std::vector< std::shared_ptr< ObservationModelSettings > > > sortedObservationSettingsList =
             sortObservationModelSettingsByType( observationSettingsList );
+    std::shared_ptr< LightTimeCalculatorRegistry< ObservationScalarType, TimeType > > lightTimeCalculatorRegistry =
+            std::make_shared< LightTimeCalculatorRegistry< ObservationScalarType, TimeType > >( );
 
     // Iterate over all observables
     for( auto it : sortedObservationSettingsList )
@@ -2282,25 +2311,31 @@ std::vector< std::shared_ptr< ObservationSimulatorBase< ObservationScalarType, T
         case 1:
         {
             observationSimulators.push_back( createObservationSimulator< 1, ObservationScalarType, TimeType >(
-                                                 observableType, it.second, bodies ) );
+                                                 observableType, it.second, bodies, lightTimeCalculatorRegistry ) );
             break;
         }
         case 2:
         {
             observationSimulators.push_back( createObservationSimulator< 2, ObservationScalarType, TimeType >(
-                                                 observableType, it.second, bodies ) );
+                                                 observableType, it.second, bodies, lightTimeCalculatorRegistry ) );
             break;
         }
         case 3:
         {
             observationSimulators.push_back( createObservationSimulator< 3, ObservationScalarType, TimeType >(
-                                                 observableType, it.second, bodies ) );
+                                                 observableType, it.second, bodies, lightTimeCalculatorRegistry ) );
             break;
         }
         default:
             throw std::runtime_error( "Error, cannot create observation simulator for size other than 1,2 and 3 ");
         }
     }
+
+    // Set shared light-time calculators in all simulators
+    for( unsigned int i = 0; i < observationSimulators.size( ); i++ )
+    {
+        observationSimulators.at( i )->setSharedLightTimeCalculators( lightTimeCalculatorRegistry->getLightTimeCalculators( ) );
+    }
     return observationSimulators;
 }
 
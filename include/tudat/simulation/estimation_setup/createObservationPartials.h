@@ -87,6 +87,10 @@ public:
      * \param observationModelList List of observation models, with the link ends of map key, for which partials are to be created
      * \param bodies Map of body objects that comprises the environment
      * \param parametersToEstimate Parameters for which partial derivatives are to be computed
+     * \param useBiasPartials Boolean to denote whether this function should create partials w.r.t. observation bias parameters
+     * \param dependentVariablesInterface Interface to the dependent variables of the propagation
+     * \param oneWayRangePartialRegistry Registry from which one-way range partials of constituent links of composite
+     * observables are retrieved (if nullptr, they are created per observable)
      * \return Map with list of observation partials. Key is associated link ends. Value is a list of observation partial
      * objects, one for each parameter w.r.t. which the observation partial is non-zero (in general). The format is a pair
      * with:
@@ -101,7 +105,9 @@ public:
             const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > > parametersToEstimate,
             const bool useBiasPartials = true,
             const std::shared_ptr< propagators::DependentVariablesInterface< TimeType > > dependentVariablesInterface =
-                    std::shared_ptr< propagators::DependentVariablesInterface< TimeType > >( ) );
+                    std::shared_ptr< propagators::DependentVariablesInterface< TimeType > >( ),
+            const std::shared_ptr< OneWayRangePartialRegistry< ObservationScalarType, TimeType > > oneWayRangePartialRegistry =
+                    nullptr );
 };
 
 //! Interface class for creating observation partials for observables of size 1.
@@ -117,6 +123,10 @@ public:
      * \param observationModelList List of observation models, with the link ends of map key, for which partials are to be created
      * \param bodies Map of body objects that comprises the environment
      * \param parametersToEstimate Parameters for which partial derivatives are to be computed
+     * \param useBiasPartials Boolean to denote whether this function should create partials w.r.t. observation bias parameters
+     * \param dependentVariablesInterface Interface to the dependent variables of the propagation
+     * \param oneWayRangePartialRegistry Registry from which one-way range partials of constituent links of composite
+     * observables are retrieved (if nullptr, they are created per observable)
      * \return Map with list of observation partials. Key is associated link ends. Value is a list of observation partial
      * objects, one for each parameter w.r.t. which the observation partial is non-zero (in general). The format is a pair
      * with:
@@ -131,7 +141,9 @@ public:
             const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > > parametersToEstimate,
             const bool useBiasPartials = true,
             const std::shared_ptr< propagators::DependentVariablesInterface< TimeType > > dependentVariablesInterface =
-                    std::shared_ptr< propagators::DependentVariablesInterface< TimeType > >( ) )
+                    std::shared_ptr< propagators::DependentVariablesInterface< TimeType > >( ),
+            const std::shared_ptr< OneWayRangePartialRegistry< ObservationScalarType, TimeType > > oneWayRangePartialRegistry =
+                    nullptr )
     {
         std::pair< std::map< std::pair< int, int >,
                 std::shared_ptr< ObservationPartial< 1 > > >, std::shared_ptr< PositionPartialScaling > > observationPartials;
@@ -148,7 +160,7 @@ public:
         case observation_models::two_way_doppler:
 //            throw std::runtime_error( "Error, two-way instantaneous Doppler observable currently failing in unit tests, please contact Tudat support" );
             observationPartials = createTwoWayDopplerPartials< ObservationScalarType, TimeType >(
-                        observationModel, bodies, parametersToEstimate, useBiasPartials );
+                        observationModel, bodies, parametersToEstimate, useBiasPartials, oneWayRangePartialRegistry );
             break;
         case observation_models::one_way_differenced_range:
             observationPartials = createDifferencedObservablePartials< ObservationScalarType, TimeType, 1 >(
@@ -156,7 +168,7 @@ public:
             break;
         case observation_models::n_way_range:
             observationPartials = createNWayRangePartials< ObservationScalarType >(
-                        observationModel, bodies, parametersToEstimate, useBiasPartials );
+                        observationModel, bodies, parametersToEstimate, useBiasPartials, oneWayRangePartialRegistry );
             break;
         case observation_models::n_way_differenced_range:
             observationPartials = createDifferencedObservablePartials< ObservationScalarType, TimeType, 1 >(
@@ -186,6 +198,10 @@ public:
      * \param observationModelList List of observation models, with the link ends of map key, for which partials are to be created
      * \param bodies Map of body objects that comprises the environment
      * \param parametersToEstimate Parameters for which partial derivatives are to be computed
+     * \param useBiasPartials Boolean to denote whether this function should create partials w.r.t. observation bias parameters
+     * \param dependentVariablesInterface Interface to the dependent variables of the propagation
+     * \param oneWayRangePartialRegistry Registry from which one-way range partials of constituent links of composite
+     * observables are retrieved (if nullptr, they are created per observable)
      * \return Map with list of observation partials. Key is associated link ends. Value is a list of observation partial
      * objects, one for each parameter w.r.t. which the observation partial is non-zero (in general). The format is a pair
      * with:
@@ -200,7 +216,9 @@ public:
             const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > > parametersToEstimate,
             const bool useBiasPartials = true,
             const std::shared_ptr< propagators::DependentVariablesInterface< TimeType > > dependentVariablesInterface =
-                    std::shared_ptr< propagators::DependentVariablesInterface< TimeType > > ( ) )
+                    std::shared_ptr< propagators::DependentVariablesInterface< TimeType > > ( ),
+            const std::shared_ptr< OneWayRangePartialRegistry< ObservationScalarType, TimeType > > oneWayRangePartialRegistry =
+                    nullptr )
     {
         std::pair< std::map< std::pair< int, int >,
                 std::shared_ptr< ObservationPartial< 2 > > >, std::shared_ptr< PositionPartialScaling > > observationPartials;
@@ -239,6 +257,10 @@ public:
      * \param observationModelList List of observation models, with the link ends of map key, for which partials are to be created
      * \param bodies Map of body objects that comprises the environment
      * \param parametersToEstimate Parameters for which partial derivatives are to be computed
+     * \param useBiasPartials Boolean to denote whether this function should create partials w.r.t. observation bias parameters
+     * \param dependentVariablesInterface Interface to the dependent variables of the propagation
+     * \param oneWayRangePartialRegistry Registry from which one-way range partials of constituent links of composite
+     * observables are retrieved (if nullptr, they are created per observable)
      * \return Map with list of observation partials. Key is associated link ends. Value is a list of observation partial
      * objects, one for each parameter w.r.t. which the observation partial is non-zero (in general). The format is a pair
      * with:
@@ -253,7 +275,9 @@ public:
             const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > > parametersToEstimate,
             const bool useBiasPartials = true,
             const std::shared_ptr< propagators::DependentVariablesInterface< TimeType > > dependentVariablesInterface =
-                    std::shared_ptr< propagators::DependentVariablesInterface< TimeType > >( ) )
+                    std::shared_ptr< propagators::DependentVariablesInterface< TimeType > >( ),
+            const std::shared_ptr< OneWayRangePartialRegistry< ObservationScalarType, TimeType > > oneWayRangePartialRegistry =
+                    nullptr )
     {
         std::pair< std::map< std::pair< int, int >,
                 std::shared_ptr< ObservationPartial< 3 > > >, std::shared_ptr< PositionPartialScaling > > observationPartials;
@@ -298,7 +322,9 @@ std::shared_ptr< PositionPartialScaling > > > createObservablePartialsList(
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > > parametersToEstimate,
         const bool useBiasPartials = true,
         const std::shared_ptr< propagators::DependentVariablesInterface< TimeType > > dependentVariablesInterface =
-                std::shared_ptr< propagators::DependentVariablesInterface< TimeType > >( ) )
+                std::shared_ptr< propagators::DependentVariablesInterface< TimeType > >( ),
+        const std::shared_ptr< OneWayRangePartialRegistry< ObservationScalarType, TimeType > > oneWayRangePartialRegistry =
+                nullptr )
 {
     std::map< observation_models::LinkEnds,
     std::pair< std::map< std::pair< int, int >, std::shared_ptr< ObservationPartial< ObservationSize > > > ,
@@ -316,7 +342,8 @@ std::shared_ptr< PositionPartialScaling > > > createObservablePartialsList(
             throw std::runtime_error( "Error when creating differenced observation partials, input models are inconsistent" );
         }
         partialsList[ it.first ] =  ObservationPartialCreator< ObservationSize, ObservationScalarType, TimeType >::createObservationPartials(
-                    it.second, bodies, parametersToEstimate, useBiasPartials, dependentVariablesInterface );
+                    it.second, bodies, parametersToEstimate, useBiasPartials, dependentVariablesInterface,
+                    oneWayRangePartialRegistry );
     }
 
     return partialsList;
@@ -262,6 +262,56 @@ std::map< LinkEnds, std::vector< std::shared_ptr< ObservationViabilityCalculator
         const std::vector< std::shared_ptr< ObservationViabilitySettings > >& observationViabilitySettings );
 
 
+//! Function to compute the geometric states of the link ends of an observation, at a single time
+/*!
+ * Function to compute the geometric states of the link ends of an observation, with all link ends evaluated at the same
+ * time (i.e. without light-time corrections). The states and times are provided in the same order as those returned
+ * by the associated observation model (see getLinkEndIndicesForLinkEndTypeAtObservable), so that they may be used as
+ * input to observation viability calculators.
+ * \param linkEndStateFunctions State functions of the link ends
+ * \param linkEndIndices Indices in link end times/states for each link end (same order as linkEndStateFunctions)
+ * \param time Time at which the link end states are to be computed
+ * \param linkEndStates Geometric states of the link ends (returned by reference)
+ * \param linkEndTimes Times of the link ends, all equal to input time (returned by reference)
+ */
+void getGeometricLinkEndStatesAndTimes(
+        const std::vector< std::function< Eigen::Vector6d( const double ) > >& linkEndStateFunctions,
+        const std::vector< std::vector< int > >& linkEndIndices,
+        const double time,
+        std::vector< Eigen::Vector6d >& linkEndStates,
+        std::vector< double >& linkEndTimes );
+
+//! Function to compute the time intervals in which an observation is viable, using geometric link end states
+/*!
+ * Function to compute the time intervals in which an observation is viable, using geometric link end states (all link
+ * ends evaluated at the same time, see getGeometricLinkEndStatesAndTimes). The viability is evaluated on an equidistant
+ * grid, and the boundaries of the windows in which it changes are refined by bisection. Since the geometric states differ
+ * from the light-time corrected states used in the actual observations, each window is extended on both sides by the
+ * maximum geometric light time along the signal path (as evaluated on the grid) plus the boundary tolerance, and
+ * overlapping windows are merged. This function is intended to pre-screen observation times before computing the full
+ * observations (for which the viability calculators must still be applied). Windows that are shorter than the grid step
+ * may be missed, so the step is to be chosen well below the duration of the shortest expected window.
+ * \param bodies Map of body objects that constitutes the environment
+ * \param linkEnds Link ends of the observation
+ * \param observableType Type of observable
+ * \param viabilityCalculators List of viability calculators for the observation
+ * \param startTime Start time of the interval in which windows are to be computed
+ * \param endTime End time of the interval in which windows are to be computed
+ * \param coarseTimeStep Step of the grid at which viability is evaluated
+ * \param boundaryTolerance Tolerance to which the boundaries of the windows are refined
+ * \return List of start and end times of the windows in which the observation may be viable
+ */
+std::vector< std::pair< double, double > > computeGeometricObservationViabilityWindows(
+        const simulation_setup::SystemOfBodies& bodies,
+        const LinkEnds& linkEnds,
+        const ObservableType observableType,
+        const std::vector< std::shared_ptr< ObservationViabilityCalculator > >& viabilityCalculators,
+        const double startTime,
+        const double endTime,
+        const double coarseTimeStep,
+        const double boundaryTolerance = 1.0 );
+
+
 } // namespace observation_models
 
 } // namespace tudat
@@ -232,6 +232,84 @@ std::map< propagators::IntegratedStateType, orbit_determination::StateDerivative
 return stateDerivativePartials;
 }
 
+//! Function to check whether two sets of state derivative models are built from the same (acceleration, torque, mass-rate) models
+/*!
+ *  Function to check whether two sets of state derivative models are built from the same acceleration, torque and mass-rate
+ *  model objects (i.e. whether the partials created by createStateDerivativePartials for the two sets would be identical, if
+ *  created with the same environment and parameters). This is the case for the arcs of a multi-arc propagation for which
+ *  the same AccelerationMap (TorqueModelMap, MassRateModelMap) is provided to the propagator settings.
+ *  \param firstStateDerivativeModels First list of state derivative models, ordered by state type (key)
+ *  \param secondStateDerivativeModels Second list of state derivative models, ordered by state type (key)
+ *  \return True if both lists contain the same state types, with state derivative models built from the same models.
+ */
+template< typename StateScalarType, typename TimeType >
+bool areStateDerivativeModelsBuiltFromSameModels(
+        const std::unordered_map< propagators::IntegratedStateType,
+        std::vector< std::shared_ptr< propagators::SingleStateTypeDerivative< StateScalarType, TimeType > > > >&
+        firstStateDerivativeModels,
+        const std::unordered_map< propagators::IntegratedStateType,
+        std::vector< std::shared_ptr< propagators::SingleStateTypeDerivative< StateScalarType, TimeType > > > >&
+        secondStateDerivativeModels )
+{
+    if( firstStateDerivativeModels.size( ) != secondStateDerivativeModels.size( ) )
+    {
+        return false;
+    }
+
+    for( auto stateDerivativeIterator : firstStateDerivativeModels )
+    {
+        if( secondStateDerivativeModels.count( stateDerivativeIterator.first ) == 0 )
+        {
+            return false;
+        }
+        else if( stateDerivativeIterator.second.size( ) != 1 ||
+                 secondStateDerivativeModels.at( stateDerivativeIterator.first ).size( ) != 1 )
+        {
+            return false;
+        }
+
+        std::shared_ptr< propagators::SingleStateTypeDerivative< StateScalarType, TimeType > > firstModel =
+                stateDerivativeIterator.second.at( 0 );
+        std::shared_ptr< propagators::SingleStateTypeDerivative< StateScalarType, TimeType > > secondModel =
+                secondStateDerivativeModels.at( stateDerivativeIterator.first ).at( 0 );
+
+        // Compare the (pointers to) the models from which the state derivatives are built
+        switch( stateDerivativeIterator.first )
+        {
+        case propagators::translational_state:
+            if( std::dynamic_pointer_cast< propagators::NBodyStateDerivative< StateScalarType, TimeType > >(
+                        firstModel )->getFullAccelerationsMap( ) !=
+                    std::dynamic_pointer_cast< propagators::NBodyStateDerivative< StateScalarType, TimeType > >(
+                        secondModel )->getFullAccelerationsMap( ) )
+            {
+                return false;
+            }
+            break;
+        case propagators::rotational_state:
+            if( std::dynamic_pointer_cast< propagators::RotationalMotionStateDerivative< StateScalarType, TimeType > >(
+                        firstModel )->getTorquesMap( ) !=
+                    std::dynamic_pointer_cast< propagators::RotationalMotionStateDerivative< StateScalarType, TimeType > >(
+                        secondModel )->getTorquesMap( ) )
+            {
+                return false;
+            }
+            break;
+        case propagators::body_mass_state:
+            if( std::dynamic_pointer_cast< propagators::BodyMassStateDerivative< StateScalarType, TimeType > >(
+                        firstModel )->getMassRateModels( ) !=
+                    std::dynamic_pointer_cast< propagators::BodyMassStateDerivative< StateScalarType, TimeType > >(
+                        secondModel )->getMassRateModels( ) )
+            {
+                return false;
+            }
+            break;
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
 extern template std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap > createStateDerivativePartials< double, double >(
         const std::unordered_map< propagators::IntegratedStateType,
         std::vector< std::shared_ptr< propagators::SingleStateTypeDerivative< double, double > > > >
@@ -0,0 +1,616 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_OBSERVATIONARCHIVE_H
+#define TUDAT_OBSERVATIONARCHIVE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/io/memoryMappedFile.h"
+#include "tudat/astro/observation_models/observationModel.h"
+#include "tudat/simulation/estimation_setup/observations.h"
+
+namespace tudat
+{
+
+namespace observation_models
+{
+
+//! Version of the binary observation archive format that is written by this code.
+static const uint32_t OBSERVATION_ARCHIVE_VERSION = 1;
+
+//! Header of a single record (observations of a single observable type and set of link ends) in an observation archive
+/*!
+ *  Header of a single record in a binary observation archive. The file starts with an 8-byte identifier ("TUDATOBS"),
+ *  followed by the format version and a byte order mark (both 32-bit unsigned integers). The file header is followed by
+ *  any number of records, each starting with this header, and followed by (all blocks padded to a multiple of 8 bytes):
+ *  - For each link end: its type, the lengths of its body and station name (and one unused 32-bit integer), and the
+ *    characters of these names.
+ *  - For each ancilliary setting: its type and number of values (as 32-bit integers), followed by the values.
+ *  - The observation times, each split into a high and low part, such that time = high + low (double precision), with
+ *    all high parts stored first.
+ *  - The observations (double precision), with the entries of each single observation stored consecutively.
+ *  - The observation dependent variables (double precision), with the entries for each observation stored consecutively.
+ *  The time, observation and dependent variable arrays can therefore be accessed directly from a memory mapping of the
+ *  file, without parsing or copying. Since records are self-contained, new records can be appended to an existing file.
+ */
+struct ObservationArchiveRecordHeader
+{
+    //! Size of the full record, including this header (in bytes)
+    uint64_t recordSize_;
+
+    //! Observable type of the observations in the record
+    int32_t observableType_;
+
+    //! Link end type at which the observation times are defined
+    int32_t referenceLinkEnd_;
+
+    //! Number of link ends of the observations in the record
+    int32_t numberOfLinkEnds_;
+
+    //! Size of a single observation
+    int32_t singleObservationSize_;
+
+    //! Number of observations in the record
+    uint64_t numberOfObservations_;
+
+    //! Size of the dependent variables of a single observation (0 if no dependent variables are stored)
+    int32_t dependentVariableSize_;
+
+    //! Number of ancilliary settings stored in the record
+    int32_t numberOfAncilliaryEntries_;
+
+    //! Boolean (stored as integer) denoting whether the observation times in the record are sorted in ascending order
+    int32_t isTimeSorted_;
+
+    //! Unused entry, for alignment of the subsequent entries (set to 0)
+    int32_t reserved_;
+
+    //! Minimum observation time in the record, split into high and low part
+    double minimumObservationTime_[ 2 ];
+
+    //! Maximum observation time in the record, split into high and low part
+    double maximumObservationTime_[ 2 ];
+};
+
+//! Contents of a single record that is to be written to an observation archive
+/*!
+ *  Contents of a single record that is to be written to an observation archive (see ObservationArchiveRecordHeader),
+ *  created from a SingleObservationSet by the createObservationArchiveRecordContents function.
+ */
+struct ObservationArchiveRecordContents
+{
+    //! Observable type of the observations
+    ObservableType observableType_;
+
+    //! Link ends of the observations
+    LinkEnds linkEnds_;
+
+    //! Link end type at which the observation times are defined
+    LinkEndType referenceLinkEnd_;
+
+    //! Size of a single observation
+    int singleObservationSize_;
+
+    //! Size of the dependent variables of a single observation (0 if no dependent variables are stored)
+    int dependentVariableSize_;
+
+    //! Ancilliary settings of the observations (single values are stored as vector of size 1)
+    std::map< ObservationAncilliarySimulationVariable, std::vector< double > > ancilliaryData_;
+
+    //! High parts of the observation times
+    std::vector< double > observationTimesHigh_;
+
+    //! Low parts of the observation times
+    std::vector< double > observationTimesLow_;
+
+    //! Concatenated observations
+    std::vector< double > observations_;
+
+    //! Concatenated dependent variables
+    std::vector< double > dependentVariables_;
+};
+
+//! View on a single record in a memory-mapped observation archive
+/*!
+ *  View on a single record in a memory-mapped observation archive, created by the ObservationArchiveReader. The link ends
+ *  and ancilliary settings are parsed when the archive is opened, but the time, observation and dependent variable arrays
+ *  point directly into the memory mapping (and are valid for the lifetime of the ObservationArchiveReader only).
+ */
+struct ObservationArchiveRecord
+{
+    //! Header of the record
+    const ObservationArchiveRecordHeader* header_;
+
+    //! Observable type of the observations in the record
+    ObservableType observableType_;
+
+    //! Link ends of the observations in the record
+    LinkEnds linkEnds_;
+
+    //! Link end type at which the observation times are defined
+    LinkEndType referenceLinkEnd_;
+
+    //! Ancilliary settings of the observations (single values are stored as vector of size 1)
+    std::map< ObservationAncilliarySimulationVariable, std::vector< double > > ancilliaryData_;
+
+    //! High parts of the observation times
+    const double* observationTimesHigh_;
+
+    //! Low parts of the observation times
+    const double* observationTimesLow_;
+
+    //! Concatenated observations
+    const double* observations_;
+
+    //! Concatenated dependent variables (nullptr if none are stored)
+    const double* dependentVariables_;
+};
+
+//! Class to provide access to the records of a binary observation archive through a memory mapping
+/*!
+ *  Class to provide access to the records of a binary observation archive (see ObservationArchiveRecordHeader) through a
+ *  memory mapping of the file. When creating the object, the file and record headers are checked and the (small) link end
+ *  and ancilliary setting blocks are parsed, the observation data itself is not read (see ObservationArchiveRecord).
+ */
+class ObservationArchiveReader
+{
+public:
+
+    //! Constructor, maps the archive into memory and interprets the record headers
+    /*!
+     *  Constructor, maps the archive into memory and interprets the record headers. An exception is thrown if the file is
+     *  not a valid observation archive, or was written with an unsupported version or different byte order.
+     *  \param fileName Name (including path) of the archive
+     */
+    ObservationArchiveReader( const std::string& fileName );
+
+    //! Function to retrieve the records in the archive
+    const std::vector< ObservationArchiveRecord >& getRecords( )
+    {
+        return records_;
+    }
+
+    //! Function to retrieve the version of the archive format with which the file was written
+    uint32_t getVersion( )
+    {
+        return version_;
+    }
+
+private:
+
+    //! Memory mapping of the archive
+    std::shared_ptr< input_output::MemoryMappedFile > mappedFile_;
+
+    //! Version of the archive format with which the file was written
+    uint32_t version_;
+
+    //! Records in the archive
+    std::vector< ObservationArchiveRecord > records_;
+};
+
+//! Function to write records to a binary observation archive
+/*!
+ *  Function to write records to a binary observation archive (see ObservationArchiveRecordHeader).
+ *  \param records Contents of the records that are to be written
+ *  \param fileName Name (including path) of the archive
+ *  \param appendToFile Boolean denoting whether the records are to be appended to the archive (if it exists). If false,
+ *  any existing file is overwritten.
+ */
+void writeObservationArchiveRecords(
+        const std::vector< ObservationArchiveRecordContents >& records,
+        const std::string& fileName,
+        const bool appendToFile = false );
+
+//! Function to split a time into a high and low part (in double precision), for storage in an observation archive
+template< typename TimeType >
+void splitObservationArchiveTime( const TimeType time, double& highPart, double& lowPart )
+{
+    highPart = static_cast< double >( time );
+    lowPart = static_cast< double >( time - TimeType( highPart ) );
+}
+
+//! Function to reconstruct a time from its high and low part, as stored in an observation archive
+template< typename TimeType >
+TimeType getObservationArchiveTime( const double highPart, const double lowPart )
+{
+    return TimeType( highPart ) + lowPart;
+}
+
+//! Function to create the contents of an observation archive record from a set of observations
+/*!
+ *  Function to create the contents of an observation archive record from a set of observations. The observations and
+ *  dependent variables are stored in double precision. The times are stored as a high and low part (see
+ *  splitObservationArchiveTime), so that Time objects are stored to (nearly) their full precision. The doppler integration
+ *  time and retransmission delays from the ancilliary settings are stored, the dependent variable calculator is not.
+ *  \param observationSet Set of observations that is to be stored
+ *  \return Contents of the archive record
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+ObservationArchiveRecordContents createObservationArchiveRecordContents(
+        const std::shared_ptr< SingleObservationSet< ObservationScalarType, TimeType > > observationSet )
+{
+    ObservationArchiveRecordContents recordContents;
+    recordContents.observableType_ = observationSet->getObservableType( );
+    recordContents.linkEnds_ = observationSet->getLinkEnds( ).linkEnds_;
+    recordContents.referenceLinkEnd_ = observationSet->getReferenceLinkEnd( );
+    recordContents.singleObservationSize_ = observationSet->getSingleObservableSize( );
+
+    // Retrieve ancilliary settings
+    std::shared_ptr< ObservationAncilliarySimulationSettings< TimeType > > ancilliarySettings =
+            observationSet->getAncilliarySettings( );
+    if( ancilliarySettings != nullptr )
+    {
+        double integrationTime = ancilliarySettings->getAncilliaryDoubleData( doppler_integration_time, false );
+        if( integrationTime == integrationTime )
+        {
+            recordContents.ancilliaryData_[ doppler_integration_time ] = std::vector< double >( { integrationTime } );
+        }
+
+        std::vector< double > retransmissionDelays =
+                ancilliarySettings->getAncilliaryDoubleVectorData( retransmission_delays, false );
+        if( retransmissionDelays.size( ) > 0 )
+        {
+            recordContents.ancilliaryData_[ retransmission_delays ] = retransmissionDelays;
+        }
+    }
+
+    // Retrieve times and observations
+    const std::vector< TimeType >& observationTimes = observationSet->getObservationTimes( );
+    recordContents.observationTimesHigh_.resize( observationTimes.size( ) );
+    recordContents.observationTimesLow_.resize( observationTimes.size( ) );
+    for( unsigned int i = 0; i < observationTimes.size( ); i++ )
+    {
+        splitObservationArchiveTime( observationTimes.at( i ), recordContents.observationTimesHigh_[ i ],
+                                     recordContents.observationTimesLow_[ i ] );
+    }
+
+    const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& observationsVector =
+            observationSet->getObservationsVector( );
+    recordContents.observations_.resize( observationsVector.rows( ) );
+    Eigen::Map< Eigen::VectorXd >( recordContents.observations_.data( ), observationsVector.rows( ) ) =
+            observationsVector.template cast< double >( );
+
+    // Retrieve dependent variables
+    std::vector< Eigen::VectorXd > dependentVariables = observationSet->getObservationsDependentVariables( );
+    recordContents.dependentVariableSize_ = 0;
+    if( dependentVariables.size( ) > 0 )
+    {
+        if( dependentVariables.size( ) != observationTimes.size( ) )
+        {
+            throw std::runtime_error( "Error when writing observations to archive, number of dependent variables (" +
+                                      std::to_string( dependentVariables.size( ) ) +
+                                      ") is inconsistent with number of observations (" +
+                                      std::to_string( observationTimes.size( ) ) + ")." );
+        }
+
+        recordContents.dependentVariableSize_ = dependentVariables.at( 0 ).rows( );
+        recordContents.dependentVariables_.resize( recordContents.dependentVariableSize_ * dependentVariables.size( ) );
+        for( unsigned int i = 0; i < dependentVariables.size( ); i++ )
+        {
+            if( dependentVariables.at( i ).rows( ) != recordContents.dependentVariableSize_ )
+            {
+                throw std::runtime_error( "Error when writing observations to archive, dependent variables are not of consistent size." );
+            }
+            std::copy( dependentVariables.at( i ).data( ),
+                       dependentVariables.at( i ).data( ) + recordContents.dependentVariableSize_,
+                       recordContents.dependentVariables_.begin( ) + i * recordContents.dependentVariableSize_ );
+        }
+    }
+
+    return recordContents;
+}
+
+//! Class to incrementally write observations to a binary observation archive
+/*!
+ *  Class to incrementally write observations to a binary observation archive (see ObservationArchiveRecordHeader), for
+ *  instance while the observations are being simulated (see simulateObservationsToArchive). The archive is opened upon
+ *  construction, and each record is appended and flushed to disk as soon as it is provided, so that the observations
+ *  need not all be kept in memory, and the records written so far remain readable if the process is interrupted. Records
+ *  may be written from multiple threads concurrently.
+ */
+class ObservationArchiveWriter
+{
+public:
+
+    //! Constructor, opens the archive for writing
+    /*!
+     *  Constructor, opens the archive for writing
+     *  \param fileName Name (including path) of the archive
+     *  \param appendToFile Boolean denoting whether the records are to be appended to the archive (if it exists). If
+     *  false, any existing file is overwritten.
+     */
+    ObservationArchiveWriter( const std::string& fileName, const bool appendToFile = false );
+
+    //! Destructor, closes the archive
+    ~ObservationArchiveWriter( );
+
+    //! Function to append a single record to the archive, and flush it to disk
+    /*!
+     *  Function to append a single record to the archive, and flush it to disk
+     *  \param record Contents of the record that is to be written
+     */
+    void writeRecord( const ObservationArchiveRecordContents& record );
+
+    //! Function to append a set of observations to the archive (as a single record), and flush it to disk
+    /*!
+     *  Function to append a set of observations to the archive (as a single record, see
+     *  createObservationArchiveRecordContents), and flush it to disk
+     *  \param observationSet Set of observations that is to be written
+     */
+    template< typename ObservationScalarType = double, typename TimeType = double >
+    void writeObservationSet(
+            const std::shared_ptr< SingleObservationSet< ObservationScalarType, TimeType > > observationSet )
+    {
+        writeRecord( createObservationArchiveRecordContents( observationSet ) );
+    }
+
+    //! Function to retrieve the name of the archive
+    std::string getFileName( )
+    {
+        return fileName_;
+    }
+
+    //! Function to retrieve the number of records written by this object
+    std::size_t getNumberOfWrittenRecords( )
+    {
+        std::lock_guard< std::mutex > lock( writeMutex_ );
+        return numberOfWrittenRecords_;
+    }
+
+    //! Function to retrieve the number of observations written by this object
+    std::size_t getNumberOfWrittenObservations( )
+    {
+        std::lock_guard< std::mutex > lock( writeMutex_ );
+        return numberOfWrittenObservations_;
+    }
+
+private:
+
+    //! Name (including path) of the archive
+    std::string fileName_;
+
+    //! Stream to which the archive is written
+    std::ofstream archiveStream_;
+
+    //! Mutex for writing to the archive
+    std::mutex writeMutex_;
+
+    //! Number of records written by this object
+    std::size_t numberOfWrittenRecords_;
+
+    //! Number of observations written by this object
+    std::size_t numberOfWrittenObservations_;
+};
+
+//! Function to write an observation collection to a binary observation archive
+/*!
+ *  Function to write an observation collection to a binary observation archive, with one record for each observation set
+ *  in the collection (see ObservationArchiveRecordHeader and createObservationArchiveRecordContents).
+ *  \param observationCollection Observations that are to be written
+ *  \param fileName Name (including path) of the archive
+ *  \param appendToFile Boolean denoting whether the observations are to be appended to the archive (if it exists). If
+ *  false, any existing file is overwritten.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+void writeObservationCollectionToArchive(
+        const std::shared_ptr< ObservationCollection< ObservationScalarType, TimeType > > observationCollection,
+        const std::string& fileName,
+        const bool appendToFile = false )
+{
+    std::vector< ObservationArchiveRecordContents > records;
+    for( auto observableIterator : observationCollection->getObservations( ) )
+    {
+        for( auto linkEndIterator : observableIterator.second )
+        {
+            for( unsigned int i = 0; i < linkEndIterator.second.size( ); i++ )
+            {
+                records.push_back( createObservationArchiveRecordContents( linkEndIterator.second.at( i ) ) );
+            }
+        }
+    }
+    writeObservationArchiveRecords( records, fileName, appendToFile );
+}
+
+//! Function to load (a selection of) the observations in a binary observation archive
+/*!
+ *  Function to load (a selection of) the observations in a binary observation archive. The archive is memory-mapped, so
+ *  that only the records (and, for records with sorted times, only the parts of the records) that are selected are read
+ *  from disk. Each record in the archive that contains selected observations results in a single observation set.
+ *  \param fileName Name (including path) of the archive
+ *  \param startTime Start of the time interval for which observations are loaded
+ *  \param endTime End of the time interval for which observations are loaded
+ *  \param linkEndsToLoad List of link ends for which observations are loaded (all link ends if empty)
+ *  \param observableTypesToLoad List of observables types which are loaded (all observable types if empty)
+ *  \param selectTimeInterval Boolean denoting whether only observations in [startTime, endTime] are loaded (if false,
+ *  the startTime and endTime inputs are not used)
+ *  \return Collection of the selected observations
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::shared_ptr< ObservationCollection< ObservationScalarType, TimeType > > loadObservationCollectionFromArchive(
+        const std::string& fileName,
+        const TimeType startTime,
+        const TimeType endTime,
+        const std::vector< LinkEnds >& linkEndsToLoad = std::vector< LinkEnds >( ),
+        const std::vector< ObservableType >& observableTypesToLoad = std::vector< ObservableType >( ),
+        const bool selectTimeInterval = true )
+{
+    ObservationArchiveReader archiveReader( fileName );
+
+    std::vector< std::shared_ptr< SingleObservationSet< ObservationScalarType, TimeType > > > observationSets;
+    for( const ObservationArchiveRecord& record : archiveReader.getRecords( ) )
+    {
+        // Check if record is selected
+        if( observableTypesToLoad.size( ) > 0 &&
+                std::find( observableTypesToLoad.begin( ), observableTypesToLoad.end( ), record.observableType_ ) ==
+                observableTypesToLoad.end( ) )
+        {
+            continue;
+        }
+
+        if( linkEndsToLoad.size( ) > 0 &&
+                std::find( linkEndsToLoad.begin( ), linkEndsToLoad.end( ), record.linkEnds_ ) == linkEndsToLoad.end( ) )
+        {
+            continue;
+        }
+
+        const int numberOfObservations = static_cast< int >( record.header_->numberOfObservations_ );
+        if( numberOfObservations == 0 )
+        {
+            continue;
+        }
+        else if( selectTimeInterval && (
+                getObservationArchiveTime< TimeType >( record.header_->maximumObservationTime_[ 0 ],
+                                                       record.header_->maximumObservationTime_[ 1 ] ) < startTime ||
+                endTime < getObservationArchiveTime< TimeType >( record.header_->minimumObservationTime_[ 0 ],
+                                                                 record.header_->minimumObservationTime_[ 1 ] ) ) )
+        {
+            continue;
+        }
+
+        auto getTime = [ & ]( const int index )
+        {
+            return getObservationArchiveTime< TimeType >(
+                        record.observationTimesHigh_[ index ], record.observationTimesLow_[ index ] );
+        };
+
+        // Determine indices of selected observations
+        std::vector< int > selectedIndices;
+        if( !selectTimeInterval )
+        {
+            selectedIndices.resize( numberOfObservations );
+            for( int i = 0; i < numberOfObservations; i++ )
+            {
+                selectedIndices[ i ] = i;
+            }
+        }
+        else if( record.header_->isTimeSorted_ )
+        {
+            int lowerIndex = 0, upperIndex = numberOfObservations;
+            while( lowerIndex < upperIndex )
+            {
+                int middleIndex = lowerIndex + ( upperIndex - lowerIndex ) / 2;
+                if( getTime( middleIndex ) < startTime )
+                {
+                    lowerIndex = middleIndex + 1;
+                }
+                else
+                {
+                    upperIndex = middleIndex;
+                }
+            }
+
+            for( int i = lowerIndex; i < numberOfObservations && !( endTime < getTime( i ) ); i++ )
+            {
+                selectedIndices.push_back( i );
+            }
+        }
+        else
+        {
+            for( int i = 0; i < numberOfObservations; i++ )
+            {
+                TimeType currentTime = getTime( i );
+                if( !( currentTime < startTime ) && !( endTime < currentTime ) )
+                {
+                    selectedIndices.push_back( i );
+                }
+            }
+        }
+
+        if( selectedIndices.size( ) == 0 )
+        {
+            continue;
+        }
+
+        // Retrieve selected observations
+        const int singleObservationSize = record.header_->singleObservationSize_;
+        const int dependentVariableSize = record.header_->dependentVariableSize_;
+        std::vector< TimeType > observationTimes( selectedIndices.size( ) );
+        Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > observationsVector(
+                    singleObservationSize * selectedIndices.size( ) );
+        std::vector< Eigen::VectorXd > dependentVariables;
+        for( unsigned int i = 0; i < selectedIndices.size( ); i++ )
+        {
+            observationTimes[ i ] = getTime( selectedIndices.at( i ) );
+            observationsVector.segment( i * singleObservationSize, singleObservationSize ) =
+                    Eigen::Map< const Eigen::VectorXd >(
+                        record.observations_ + selectedIndices.at( i ) * singleObservationSize,
+                        singleObservationSize ).template cast< ObservationScalarType >( );
+            if( dependentVariableSize > 0 )
+            {
+                dependentVariables.push_back(
+                            Eigen::Map< const Eigen::VectorXd >(
+                                record.dependentVariables_ + selectedIndices.at( i ) * dependentVariableSize,
+                                dependentVariableSize ) );
+            }
+        }
+
+        // Recreate ancilliary settings
+        std::shared_ptr< ObservationAncilliarySimulationSettings< TimeType > > ancilliarySettings;
+        if( record.ancilliaryData_.size( ) > 0 )
+        {
+            ancilliarySettings = std::make_shared< ObservationAncilliarySimulationSettings< TimeType > >( );
+            for( auto ancilliaryIterator : record.ancilliaryData_ )
+            {
+                if( ancilliaryIterator.first == doppler_integration_time )
+                {
+                    ancilliarySettings->setAncilliaryDoubleData(
+                                ancilliaryIterator.first, ancilliaryIterator.second.at( 0 ) );
+                }
+                else
+                {
+                    ancilliarySettings->setAncilliaryDoubleVectorData(
+                                ancilliaryIterator.first, ancilliaryIterator.second );
+                }
+            }
+        }
+
+        observationSets.push_back(
+                    std::make_shared< SingleObservationSet< ObservationScalarType, TimeType > >(
+                        record.observableType_, record.linkEnds_, observationsVector, observationTimes,
+                        record.referenceLinkEnd_, dependentVariables, nullptr, ancilliarySettings ) );
+    }
+
+    return std::make_shared< ObservationCollection< ObservationScalarType, TimeType > >( observationSets );
+}
+
+//! Function to load (a selection of) the observations in a binary observation archive, for all observation times
+/*!
+ *  Function to load (a selection of) the observations in a binary observation archive, for all observation times (see
+ *  loadObservationCollectionFromArchive function with time interval for details).
+ *  \param fileName Name (including path) of the archive
+ *  \param linkEndsToLoad List of link ends for which observations are loaded (all link ends if empty)
+ *  \param observableTypesToLoad List of observables types which are loaded (all observable types if empty)
+ *  \return Collection of the selected observations
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::shared_ptr< ObservationCollection< ObservationScalarType, TimeType > > loadObservationCollectionFromArchive(
+        const std::string& fileName,
+        const std::vector< LinkEnds >& linkEndsToLoad = std::vector< LinkEnds >( ),
+        const std::vector< ObservableType >& observableTypesToLoad = std::vector< ObservableType >( ) )
+{
+    return loadObservationCollectionFromArchive< ObservationScalarType, TimeType >(
+                fileName, TimeType( 0.0 ), TimeType( 0.0 ), linkEndsToLoad, observableTypesToLoad, false );
+}
+
+} // namespace observation_models
+
+} // namespace tudat
+
+#endif // TUDAT_OBSERVATIONARCHIVE_H
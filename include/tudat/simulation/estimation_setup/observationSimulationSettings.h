@@ -115,6 +115,156 @@ protected:
     double noiseMean_;
 };
 
+//! Base class to generate the noise of a set of observations in a single call
+/*!
+ *  Base class to generate the noise of a set of observations in a single call, so that the random numbers can be generated
+ *  into a contiguous buffer, instead of through a function call per observation (see
+ *  ObservationSimulationSettings::setObservationNoiseGenerator). The noise of consecutive calls continues the same noise
+ *  sequence, so that observations simulated in chunks receive the same noise as when simulated at once.
+ */
+class ObservationNoiseGenerator
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param observationSize Size of a single observation
+     */
+    ObservationNoiseGenerator( const int observationSize ):
+        observationSize_( observationSize ){ }
+
+    //! Destructor
+    virtual ~ObservationNoiseGenerator( ){ }
+
+    //! Function to generate the noise for a list of consecutive observations
+    /*!
+     * Function to generate the noise for a list of consecutive observations
+     * \param observationTimes Times of the observations, in the order in which they are simulated
+     * \param noiseValues Noise of the observations, with one column per observation (returned by reference)
+     */
+    virtual void generateNoise( const std::vector< double >& observationTimes, Eigen::MatrixXd& noiseValues ) = 0;
+
+    //! Function to generate the noise for a single observation
+    /*!
+     * Function to generate the noise for a single observation, used for the (per-observation) noise function of the
+     * observation simulation settings.
+     * \param observationTime Time of the observation
+     * \return Noise of the observation
+     */
+    Eigen::VectorXd generateSingleObservationNoise( const double observationTime );
+
+    //! Function to retrieve the size of a single observation
+    int getObservationSize( )
+    {
+        return observationSize_;
+    }
+
+protected:
+
+    //! Size of a single observation
+    int observationSize_;
+};
+
+//! Class to generate independent Gaussian observation noise
+/*!
+ *  Class to generate independent Gaussian observation noise. The noise of observation i (counted over all calls) is
+ *  drawn from counter-based random number stream i (see fillGaussianRandomMatrix), so that the noise can be generated
+ *  in parallel, and is independent of the number of threads and the division of the observations over calls.
+ */
+class GaussianObservationNoiseGenerator: public ObservationNoiseGenerator
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param standardDeviation Standard deviation of the noise
+     * \param mean Mean of the noise
+     * \param seed Seed of the random number generator
+     * \param observationSize Size of a single observation
+     * \param numberOfThreads Number of threads over which the noise is generated
+     */
+    GaussianObservationNoiseGenerator(
+            const double standardDeviation,
+            const double mean,
+            const int seed,
+            const int observationSize,
+            const int numberOfThreads = 1 ):
+        ObservationNoiseGenerator( observationSize ),
+        standardDeviation_( standardDeviation ), mean_( mean ), seed_( seed ), numberOfThreads_( numberOfThreads ),
+        numberOfGeneratedObservations_( 0 ){ }
+
+    //! Destructor
+    ~GaussianObservationNoiseGenerator( ){ }
+
+    //! Function to generate the noise for a list of consecutive observations
+    void generateNoise( const std::vector< double >& observationTimes, Eigen::MatrixXd& noiseValues );
+
+protected:
+
+    //! Standard deviation of the noise
+    double standardDeviation_;
+
+    //! Mean of the noise
+    double mean_;
+
+    //! Seed of the random number generator
+    int seed_;
+
+    //! Number of threads over which the noise is generated
+    int numberOfThreads_;
+
+    //! Number of observations for which noise has been generated (index of random number stream of next observation)
+    uint64_t numberOfGeneratedObservations_;
+};
+
+//! Class to generate time-correlated Gaussian observation noise
+/*!
+ *  Class to generate time-correlated Gaussian observation noise, modelled as a first-order Gauss-Markov process with
+ *  given (steady-state) standard deviation and correlation time. The correlation coefficient between the noise of two
+ *  consecutive observations separated by dt is exp(-dt/tau). The white noise driving the process is generated in bulk
+ *  (in the same manner as GaussianObservationNoiseGenerator), after which the recursion is applied. The noise of the
+ *  first observation is drawn from the steady-state distribution.
+ */
+class TimeCorrelatedGaussianObservationNoiseGenerator: public GaussianObservationNoiseGenerator
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param standardDeviation Steady-state standard deviation of the noise
+     * \param correlationTime Correlation time of the noise
+     * \param seed Seed of the random number generator
+     * \param observationSize Size of a single observation
+     * \param numberOfThreads Number of threads over which the white noise is generated
+     */
+    TimeCorrelatedGaussianObservationNoiseGenerator(
+            const double standardDeviation,
+            const double correlationTime,
+            const int seed,
+            const int observationSize,
+            const int numberOfThreads = 1 );
+
+    //! Destructor
+    ~TimeCorrelatedGaussianObservationNoiseGenerator( ){ }
+
+    //! Function to generate the noise for a list of consecutive observations
+    void generateNoise( const std::vector< double >& observationTimes, Eigen::MatrixXd& noiseValues );
+
+protected:
+
+    //! Correlation time of the noise
+    double correlationTime_;
+
+    //! Time of the last observation for which noise was generated (NaN if none)
+    double previousObservationTime_;
+
+    //! Noise of the last observation for which noise was generated
+    Eigen::VectorXd previousNoise_;
+};
+
 //! Base struct for defining times at which observations are to be simulated.
 /*!
  *  Base struct for defining times at which observations are to be simulated. Here, only the link end from which the
@@ -189,6 +339,7 @@ struct ObservationSimulationSettings
             const std::function< Eigen::VectorXd( const double ) >& observationNoiseFunction )
     {
         observationNoiseFunction_ = observationNoiseFunction;
+        observationNoiseGenerator_ = nullptr;
     }
 
     void setObservationNoiseFunction(
@@ -196,6 +347,33 @@ struct ObservationSimulationSettings
     {
         observationNoiseFunction_ = getNoiseFunctionForObservable(
                     observationNoiseFunction, observableType_ );
+        observationNoiseGenerator_ = nullptr;
+    }
+
+    //! Function to set an object generating the noise of all simulated observations of these settings in bulk
+    /*!
+     * Function to set an object generating the noise of all simulated observations of these settings in bulk. The
+     * noise function (used for single observations) is set to generate the noise of a single observation from the same
+     * object. The generator is removed when a noise function is set (see setObservationNoiseFunction).
+     * \param observationNoiseGenerator Object generating the noise
+     */
+    void setObservationNoiseGenerator(
+            const std::shared_ptr< ObservationNoiseGenerator > observationNoiseGenerator )
+    {
+        observationNoiseGenerator_ = observationNoiseGenerator;
+        observationNoiseFunction_ = nullptr;
+        if( observationNoiseGenerator_ != nullptr )
+        {
+            observationNoiseFunction_ = std::bind(
+                        &ObservationNoiseGenerator::generateSingleObservationNoise, observationNoiseGenerator_,
+                        std::placeholders::_1 );
+        }
+    }
+
+    //! Function to retrieve the object generating the noise of the simulated observations in bulk (nullptr if none)
+    std::shared_ptr< ObservationNoiseGenerator > getObservationNoiseGenerator( )
+    {
+        return observationNoiseGenerator_;
     }
 
     std::shared_ptr< ObservationDependentVariableCalculator > getDependentVariableCalculator( )
@@ -229,6 +407,9 @@ protected:
     // Function to generate noise to add to observations that are to be simulated
     std::function< Eigen::VectorXd( const double ) > observationNoiseFunction_;
 
+    // Object to generate noise to add to observations that are to be simulated in bulk (nullptr if not used)
+    std::shared_ptr< ObservationNoiseGenerator > observationNoiseGenerator_;
+
     std::shared_ptr< ObservationDependentVariableCalculator > dependentVariableCalculator_;
 
     std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings < TimeType > > ancilliarySettings_;
@@ -458,13 +639,24 @@ void addGaussianNoiseToSingleObservationSimulationSettings(
         const std::shared_ptr< ObservationSimulationSettings< TimeType > >& observationSimulationSettings,
         const double observationNoiseAmplitude )
 {
-    std::function< Eigen::VectorXd( const double ) > noiseFunction =
-            statistics::getIndependentGaussianNoiseFunction(
-                observationNoiseAmplitude, 0.0, noiseSeed, observation_models::getObservableSize(
-                    observationSimulationSettings->getObservableType( ) ) );
+    observationSimulationSettings->setObservationNoiseGenerator(
+                std::make_shared< GaussianObservationNoiseGenerator >(
+                    observationNoiseAmplitude, 0.0, noiseSeed, observation_models::getObservableSize(
+                        observationSimulationSettings->getObservableType( ) ) ) );
     noiseSeed++;
+}
 
-    observationSimulationSettings->setObservationNoiseFunction( noiseFunction );
+template< typename TimeType = double >
+void addTimeCorrelatedGaussianNoiseToSingleObservationSimulationSettings(
+        const std::shared_ptr< ObservationSimulationSettings< TimeType > >& observationSimulationSettings,
+        const double observationNoiseAmplitude,
+        const double correlationTime )
+{
+    observationSimulationSettings->setObservationNoiseGenerator(
+                std::make_shared< TimeCorrelatedGaussianObservationNoiseGenerator >(
+                    observationNoiseAmplitude, correlationTime, noiseSeed, observation_models::getObservableSize(
+                        observationSimulationSettings->getObservableType( ) ) ) );
+    noiseSeed++;
 }
 
 template< typename TimeType = double >
@@ -551,6 +743,20 @@ void addGaussianNoiseFunctionToObservationSimulationSettings(
                 observationSimulationSettings, modificationFunction, args ... );
 }
 
+template< typename TimeType = double, typename... ArgTypes  >
+void addTimeCorrelatedGaussianNoiseFunctionToObservationSimulationSettings(
+        const std::vector< std::shared_ptr< ObservationSimulationSettings< TimeType > > >& observationSimulationSettings,
+        const double observationNoiseAmplitude,
+        const double correlationTime,
+        ArgTypes... args )
+{
+    std::function< void( const std::shared_ptr< ObservationSimulationSettings< TimeType > > ) > modificationFunction =
+            std::bind( &addTimeCorrelatedGaussianNoiseToSingleObservationSimulationSettings< TimeType >,
+                       std::placeholders::_1, observationNoiseAmplitude, correlationTime );
+    modifyObservationSimulationSettings(
+                observationSimulationSettings, modificationFunction, args ... );
+}
+
 template< typename TimeType = double, typename... ArgTypes  >
 void addDependentVariablesToObservationSimulationSettings(
         const std::vector< std::shared_ptr< ObservationSimulationSettings< TimeType > > >& observationSimulationSettings,
@@ -19,6 +19,7 @@
 #include <Eigen/Core>
 
 #include "tudat/basics/basicTypedefs.h"
+#include "tudat/basics/memoryFootprint.h"
 #include "tudat/basics/timeType.h"
 #include "tudat/basics/tudatTypeTraits.h"
 #include "tudat/basics/utilities.h"
@@ -33,6 +34,12 @@ namespace tudat
 namespace observation_models
 {
 
+//! Class containing a set of observations of a single observable type and set of link ends
+/*!
+ *  Class containing a set of observations of a single observable type and set of link ends. The observations are stored
+ *  contiguously in a single vector (the observable entries of observation i are stored at indices
+ *  i * singleObservationSize, ..., ( i + 1 ) * singleObservationSize - 1), together with the observation times.
+ */
 template< typename ObservationScalarType = double, typename TimeType = double,
           typename std::enable_if< is_state_scalar_and_time_type< ObservationScalarType, TimeType >::value, int >::type = 0 >
 class SingleObservationSet
@@ -45,30 +52,50 @@ public:
             const std::vector< TimeType > observationTimes,
             const LinkEndType referenceLinkEnd,
             const std::vector< Eigen::VectorXd >& observationsDependentVariables =
-            std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >( ),
+            std::vector< Eigen::VectorXd >( ),
             const std::shared_ptr< simulation_setup::ObservationDependentVariableCalculator > dependentVariableCalculator = nullptr,
             const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings < TimeType > > ancilliarySettings = nullptr ):
         observableType_( observableType ),
         linkEnds_( linkEnds ),
-        observations_( observations ),
+        singleObservationSize_( observations.size( ) > 0 ? observations.at( 0 ).rows( ) : 0 ),
+        observationsVector_( createConcatenatedObservationsVector( observations ) ),
         observationTimes_( observationTimes ),
         referenceLinkEnd_( referenceLinkEnd ),
         observationsDependentVariables_( observationsDependentVariables ),
         dependentVariableCalculator_( dependentVariableCalculator ),
         ancilliarySettings_( ancilliarySettings ),
-        numberOfObservations_( observations_.size( ) )
+        numberOfObservations_( observations.size( ) )
     {
-        if( observations_.size( ) != observationTimes_.size( ) )
+        if( observations.size( ) != observationTimes_.size( ) )
         {
             throw std::runtime_error( "Error when making SingleObservationSet, input sizes are inconsistent." );
         }
+    }
 
-        for( unsigned int i = 1; i < observations.size( ); i++ )
+    SingleObservationSet(
+            const ObservableType observableType,
+            const LinkDefinition& linkEnds,
+            const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& observationsVector,
+            const std::vector< TimeType > observationTimes,
+            const LinkEndType referenceLinkEnd,
+            const std::vector< Eigen::VectorXd >& observationsDependentVariables =
+            std::vector< Eigen::VectorXd >( ),
+            const std::shared_ptr< simulation_setup::ObservationDependentVariableCalculator > dependentVariableCalculator = nullptr,
+            const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings < TimeType > > ancilliarySettings = nullptr ):
+        observableType_( observableType ),
+        linkEnds_( linkEnds ),
+        singleObservationSize_( observationTimes.size( ) > 0 ? getObservableSize( observableType ) : 0 ),
+        observationsVector_( observationsVector ),
+        observationTimes_( observationTimes ),
+        referenceLinkEnd_( referenceLinkEnd ),
+        observationsDependentVariables_( observationsDependentVariables ),
+        dependentVariableCalculator_( dependentVariableCalculator ),
+        ancilliarySettings_( ancilliarySettings ),
+        numberOfObservations_( observationTimes.size( ) )
+    {
+        if( observationsVector_.rows( ) != singleObservationSize_ * numberOfObservations_ )
         {
-            if( observations.at( i ).rows( ) != observations.at( i - 1 ).rows( ) )
-            {
-                throw std::runtime_error( "Error when making SingleObservationSet, input observables not of consistent size." );
-            }
+            throw std::runtime_error( "Error when making SingleObservationSet, input sizes are inconsistent." );
         }
     }
 
@@ -84,10 +111,20 @@ public:
 
     std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > getObservations( )
     {
-        return observations_;
+        std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > observations;
+        for( int i = 0; i < numberOfObservations_; i++ )
+        {
+            observations.push_back( getObservation( i ) );
+        }
+        return observations;
+    }
+
+    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > getObservation( const int index )
+    {
+        return observationsVector_.segment( index * singleObservationSize_, singleObservationSize_ );
     }
 
-    std::vector< TimeType > getObservationTimes( )
+    const std::vector< TimeType >& getObservationTimes( )
     {
         return observationTimes_;
     }
@@ -102,29 +139,20 @@ public:
         return numberOfObservations_;
     }
 
-    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > getObservationsVector( )
+    int getSingleObservableSize( )
     {
-        int singleObservableSize = 0;
-        if( numberOfObservations_ != 0 )
-        {
-            singleObservableSize = observations_.at( 0 ).rows( );
-        }
+        return singleObservationSize_;
+    }
 
-        Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > observationsVector =
-                Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >::Zero(
-                    singleObservableSize * numberOfObservations_ );
-        for( unsigned int i = 0; i < observations_.size( ); i++ )
-        {
-            observationsVector.segment( i * singleObservableSize, singleObservableSize ) =
-                    observations_.at( i );
-        }
-        return observationsVector;
+    const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& getObservationsVector( )
+    {
+        return observationsVector_;
     }
 
     std::map< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > getObservationsHistory( )
     {
         return utilities::createMapFromVectors< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >(
-                    observationTimes_, observations_ );
+                    observationTimes_, getObservations( ) );
     }
 
 
@@ -150,15 +178,40 @@ public:
         return ancilliarySettings_;
     }
 
+    //! Function to retrieve the heap memory held by the observations, times and dependent variables in this set, in bytes
+    std::size_t getHeapMemorySize( ) const
+    {
+        return utilities::getHeapMemorySize( observationsVector_ ) + utilities::getHeapMemorySize( observationTimes_ ) +
+                utilities::getHeapMemorySize( observationsDependentVariables_ );
+    }
+
 
 
 private:
 
+    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > createConcatenatedObservationsVector(
+            const std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >& observations )
+    {
+        Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > observationsVector =
+                Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >::Zero( singleObservationSize_ * observations.size( ) );
+        for( unsigned int i = 0; i < observations.size( ); i++ )
+        {
+            if( observations.at( i ).rows( ) != singleObservationSize_ )
+            {
+                throw std::runtime_error( "Error when making SingleObservationSet, input observables not of consistent size." );
+            }
+            observationsVector.segment( i * singleObservationSize_, singleObservationSize_ ) = observations.at( i );
+        }
+        return observationsVector;
+    }
+
     const ObservableType observableType_;
 
     const LinkDefinition linkEnds_;
 
-    const std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > observations_;
+    const int singleObservationSize_;
+
+    const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > observationsVector_;
 
     const std::vector< TimeType > observationTimes_;
 
@@ -214,27 +267,27 @@ public:
         setConcatenatedObservationsAndTimes( );
     }
 
-    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > getObservationVector( )
+    const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& getObservationVector( )
     {
         return concatenatedObservations_;
     }
 
-    std::vector< TimeType > getConcatenatedTimeVector( )
+    const std::vector< TimeType >& getConcatenatedTimeVector( )
     {
         return concatenatedTimes_;
     }
 
-    std::vector< int > getConcatenatedLinkEndIds( )
+    const std::vector< int >& getConcatenatedLinkEndIds( )
     {
         return concatenatedLinkEndIds_;
     }
 
-    std::map< observation_models::LinkEnds, int > getLinkEndIdentifierMap( )
+    const std::map< observation_models::LinkEnds, int >& getLinkEndIdentifierMap( )
     {
         return linkEndIds_;
     }
 
-    std::map< int, observation_models::LinkEnds > getInverseLinkEndIdentifierMap( )
+    const std::map< int, observation_models::LinkEnds >& getInverseLinkEndIdentifierMap( )
     {
         return inverseLinkEndIds_;
     }
@@ -243,24 +296,24 @@ public:
 
 
 
-    std::map< ObservableType, std::map< LinkEnds, std::vector< std::pair< int, int > > > > getObservationSetStartAndSize( )
+    const std::map< ObservableType, std::map< LinkEnds, std::vector< std::pair< int, int > > > >& getObservationSetStartAndSize( )
     {
         return observationSetStartAndSize_;
     }
 
-    std::map< ObservableType, std::map< LinkEnds, std::pair< int, int > > > getObservationTypeAndLinkEndStartAndSize( )
+    const std::map< ObservableType, std::map< LinkEnds, std::pair< int, int > > >& getObservationTypeAndLinkEndStartAndSize( )
     {
         return observationTypeAndLinkEndStartAndSize_;
     }
 
-    std::map< ObservableType, std::map< int, std::vector< std::pair< int, int > > > > getObservationSetStartAndSizePerLinkEndIndex( )
+    const std::map< ObservableType, std::map< int, std::vector< std::pair< int, int > > > >& getObservationSetStartAndSizePerLinkEndIndex( )
     {
         return observationSetStartAndSizePerLinkEndIndex_;
     }
 
 
 
-    std::map< ObservableType, std::pair< int, int > > getObservationTypeStartAndSize( )
+    const std::map< ObservableType, std::pair< int, int > >& getObservationTypeStartAndSize( )
     {
         return observationTypeStartAndSize_;
     }
@@ -270,11 +323,128 @@ public:
         return totalObservableSize_;
     }
 
-    SortedObservationSets getObservations( )
+    const SortedObservationSets& getObservations( )
     {
         return observationSetList_;
     }
 
+    //! Function to retrieve the (heap) memory held by the observation collection
+    /*!
+     *  Function to retrieve the (heap) memory held by the observation collection: the single observation sets, the
+     *  concatenated observations (with times and link end ids) and the index ranges of the observations.
+     *  \return Memory held by the observation collection
+     */
+    utilities::MemoryFootprint getMemoryFootprint( ) const
+    {
+        utilities::MemoryFootprint memoryFootprint;
+
+        std::size_t observationSetsSize = 0;
+        for( auto observableIterator : observationSetList_ )
+        {
+            for( auto linkEndIterator : observableIterator.second )
+            {
+                for( unsigned int i = 0; i < linkEndIterator.second.size( ); i++ )
+                {
+                    observationSetsSize += linkEndIterator.second.at( i )->getHeapMemorySize( );
+                }
+            }
+        }
+        memoryFootprint.addEntry( "observation_sets", observationSetsSize );
+        memoryFootprint.addEntry( "concatenated_observations",
+                                  utilities::getHeapMemorySize( concatenatedObservations_ ) +
+                                  utilities::getHeapMemorySize( concatenatedTimes_ ) +
+                                  utilities::getHeapMemorySize( concatenatedLinkEndIds_ ) );
+        memoryFootprint.addEntry( "observation_indices",
+                                  utilities::getHeapMemorySize( observationSetStartAndSize_ ) +
+                                  utilities::getHeapMemorySize( observationSetStartAndSizePerLinkEndIndex_ ) +
+                                  utilities::getHeapMemorySize( observationTypeAndLinkEndStartAndSize_ ) );
+        return memoryFootprint;
+    }
+
+    //! Function to retrieve the index range of all observations of a given observable type
+    /*!
+     *  Function to retrieve the index range of all observations of a given observable type, in the concatenated
+     *  observation, time and link end id vectors (see getObservationVector, getConcatenatedTimeVector and
+     *  getConcatenatedLinkEndIds). The returned ranges (start index and size) can be used to access the observations
+     *  without copying them (e.g. getObservationVector( ).segment( start, size ) ).
+     *  \param observableType Observable type for which the index ranges are to be retrieved
+     *  \return Index ranges (start index and size) of the requested observations (empty if none exist)
+     */
+    std::vector< std::pair< int, int > > getObservationIndexRanges( const ObservableType observableType )
+    {
+        std::vector< std::pair< int, int > > indexRanges;
+        if( observationTypeStartAndSize_.count( observableType ) != 0 )
+        {
+            indexRanges.push_back( observationTypeStartAndSize_.at( observableType ) );
+        }
+        return indexRanges;
+    }
+
+    //! Function to retrieve the index range of all observations of a given observable type and set of link ends
+    /*!
+     *  Function to retrieve the index range of all observations of a given observable type and set of link ends, in the
+     *  concatenated observation, time and link end id vectors (see getObservationIndexRanges( observableType )).
+     *  \param observableType Observable type for which the index ranges are to be retrieved
+     *  \param linkEnds Link ends for which the index ranges are to be retrieved
+     *  \return Index ranges (start index and size) of the requested observations (empty if none exist)
+     */
+    std::vector< std::pair< int, int > > getObservationIndexRanges(
+            const ObservableType observableType, const LinkEnds& linkEnds )
+    {
+        std::vector< std::pair< int, int > > indexRanges;
+        if( observationTypeAndLinkEndStartAndSize_.count( observableType ) != 0 )
+        {
+            if( observationTypeAndLinkEndStartAndSize_.at( observableType ).count( linkEnds ) != 0 )
+            {
+                indexRanges.push_back( observationTypeAndLinkEndStartAndSize_.at( observableType ).at( linkEnds ) );
+            }
+        }
+        return indexRanges;
+    }
+
+    //! Function to retrieve the index ranges of all observations within a given time window
+    /*!
+     *  Function to retrieve the index ranges of all observations within a given time window (including its bounds), in the
+     *  concatenated observation, time and link end id vectors, optionally restricted to a given set of index ranges (e.g.
+     *  those of a single observable and set of link ends, see getObservationIndexRanges). Each returned range contains
+     *  consecutive entries inside the time window. The concatenated times are not required to be sorted.
+     *  \param startTime Start time of the window
+     *  \param endTime End time of the window
+     *  \param indexRanges Index ranges to which the search is restricted (default: all observations)
+     *  \return Index ranges (start index and size) of the observations in the time window
+     */
+    std::vector< std::pair< int, int > > getObservationIndexRangesInTimeWindow(
+            const TimeType startTime, const TimeType endTime,
+            const std::vector< std::pair< int, int > >& indexRanges = { { 0, -1 } } )
+    {
+        std::vector< std::pair< int, int > > indexRangesInWindow;
+        for( unsigned int i = 0; i < indexRanges.size( ); i++ )
+        {
+            int rangeStart = indexRanges.at( i ).first;
+            int rangeEnd = ( indexRanges.at( i ).second < 0 ) ? totalObservableSize_ :
+                                                                rangeStart + indexRanges.at( i ).second;
+            int currentStart = -1;
+            for( int j = rangeStart; j < rangeEnd; j++ )
+            {
+                bool isInWindow = !( concatenatedTimes_[ j ] < startTime ) && !( endTime < concatenatedTimes_[ j ] );
+                if( isInWindow && currentStart < 0 )
+                {
+                    currentStart = j;
+                }
+                else if( !isInWindow && currentStart >= 0 )
+                {
+                    indexRangesInWindow.push_back( std::make_pair( currentStart, j - currentStart ) );
+                    currentStart = -1;
+                }
+            }
+            if( currentStart >= 0 )
+            {
+                indexRangesInWindow.push_back( std::make_pair( currentStart, rangeEnd - currentStart ) );
+            }
+        }
+        return indexRangesInWindow;
+    }
+
     std::vector< std::shared_ptr< SingleObservationSet< ObservationScalarType, TimeType > > > getSingleLinkAndTypeObservationSets(
             const ObservableType observableType,
             const LinkDefinition linkEnds )
@@ -365,7 +535,12 @@ public:
 
     std::vector< LinkEnds > getConcatenatedLinkEndIdNames( )
     {
-        return concatenatedLinkEndIdNames_;
+        std::vector< LinkEnds > concatenatedLinkEndIdNames( concatenatedLinkEndIds_.size( ) );
+        for( unsigned int i = 0; i < concatenatedLinkEndIds_.size( ); i++ )
+        {
+            concatenatedLinkEndIdNames[ i ] = inverseLinkEndIds_.at( concatenatedLinkEndIds_.at( i ) );
+        }
+        return concatenatedLinkEndIdNames;
     }
 
 
@@ -433,7 +608,6 @@ private:
         concatenatedObservations_ = Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >::Zero( totalObservableSize_ );
         concatenatedTimes_.resize( totalObservableSize_ );
         concatenatedLinkEndIds_.resize( totalObservableSize_ );
-        concatenatedLinkEndIdNames_.resize( totalObservableSize_ );
 
 
         int observationCounter = 0;
@@ -464,25 +638,30 @@ private:
                 {
                     std::pair< int, int > startAndSize =
                             observationSetStartAndSize_.at( currentObservableType ).at( currentLinkEnds ).at( i );
-                    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > currentObservables =
-                            Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >::Zero( startAndSize.second );
+                    if( startAndSize.second == 0 )
+                    {
+                        continue;
+                    }
+                    else if( linkEndIterator.second.at( i )->getSingleObservableSize( ) != observableSize )
+                    {
+                        throw std::runtime_error( "Error when making ObservationCollection, size of observations of type " +
+                                                  getObservableName( currentObservableType ) + " is inconsistent" );
+                    }
 
-                    std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > currentObservationSet =
-                            linkEndIterator.second.at( i )->getObservations( );
-                    std::vector< TimeType > currentObservationTimes =
+                    // Copy observations as single block, and set times and link end ids per entry
+                    concatenatedObservations_.segment( startAndSize.first, startAndSize.second ) =
+                            linkEndIterator.second.at( i )->getObservationsVector( );
+                    const std::vector< TimeType >& currentObservationTimes =
                             linkEndIterator.second.at( i )->getObservationTimes( );
-                    for( unsigned int j = 0; j < currentObservationSet.size( ); j++ )
+                    for( unsigned int j = 0; j < currentObservationTimes.size( ); j++ )
                     {
-                        currentObservables.segment( j * observableSize, observableSize ) = currentObservationSet.at( j );
                         for( int k = 0; k < observableSize; k++ )
                         {
-                            concatenatedTimes_[ observationCounter ] = currentObservationTimes.at( j );
+                            concatenatedTimes_[ observationCounter ] = currentObservationTimes[ j ];
                             concatenatedLinkEndIds_[ observationCounter ] = currentStationId;
-                            concatenatedLinkEndIdNames_[ observationCounter ] = currentLinkEnds;
                             observationCounter++;
                         }
                     }
-                    concatenatedObservations_.segment( startAndSize.first, startAndSize.second ) = currentObservables;
                 }
             }
         }
@@ -504,8 +683,6 @@ private:
 
     std::vector< int > concatenatedLinkEndIds_;
 
-    std::vector< LinkEnds > concatenatedLinkEndIdNames_;
-
     std::map< observation_models::LinkEnds, int > linkEndIds_;
 
     std::map< int, observation_models::LinkEnds > inverseLinkEndIds_;
@@ -653,7 +830,7 @@ inline std::shared_ptr< SingleObservationSet< ObservationScalarType, TimeType >
 {
     return std::make_shared< SingleObservationSet< ObservationScalarType, TimeType > >(
                 observableType, linkEnds, observations, observationTimes, referenceLinkEnd,
-                std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >( ), nullptr, ancilliarySettings );
+                std::vector< Eigen::VectorXd >( ), nullptr, ancilliarySettings );
 }
 
 //template< typename ObservationScalarType = double, typename TimeType = double,
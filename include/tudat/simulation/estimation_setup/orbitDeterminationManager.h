@@ -12,14 +12,23 @@
 #define TUDAT_ORBITDETERMINATIONMANAGER_H
 
 #include <algorithm>
+#include <limits>
+#include <numeric>
 
 
 
+#include "tudat/basics/parallelization.h"
+#include "tudat/basics/processCommunicator.h"
+#include "tudat/basics/tracing.h"
 #include "tudat/io/basicInputOutput.h"
 #include "tudat/math/basic/leastSquaresEstimation.h"
 #include "tudat/astro/observation_models/observationManager.h"
 #include "tudat/astro/orbit_determination/podInputOutputTypes.h"
+#include "tudat/astro/orbit_determination/estimatable_parameters/constantDragCoefficient.h"
+#include "tudat/astro/orbit_determination/estimatable_parameters/empiricalAccelerationCoefficients.h"
 #include "tudat/astro/orbit_determination/estimatable_parameters/initialTranslationalState.h"
+#include "tudat/astro/orbit_determination/estimatable_parameters/observationBiasParameter.h"
+#include "tudat/astro/orbit_determination/estimatable_parameters/radiationPressureCoefficient.h"
 #include "tudat/simulation/estimation_setup/variationalEquationsSolver.h"
 #include "tudat/simulation/estimation_setup/createObservationManager.h"
 #include "tudat/simulation/estimation_setup/createNumericalSimulator.h"
@@ -77,6 +86,129 @@ namespace simulation_setup
 //    return concatenatedWeights;
 //}
 
+//! Function to determine the arc-local parameters of a multi-arc estimation
+/*!
+ *  Function to determine, for each arc of a multi-arc estimation, the indices (in the estimated parameter vector) of the
+ *  parameters that are local to that arc: the arc-wise initial states of the bodies in the arc, and the entries of
+ *  arc-wise parameters (observation biases, empirical accelerations, drag and radiation pressure coefficients) for which
+ *  the parameter arc lies within the arc of the dynamics. Arc-wise parameters with arcs spanning more than one arc of the
+ *  dynamics, and all other parameters, are global parameters. The arcs of the dynamics are defined by the arc start times
+ *  of the multi-arc initial state parameters, with each arc ending at the start of the next arc.
+ *  \param parametersToEstimate Set of estimated parameters
+ *  \return List (per arc of the dynamics) of the indices of the parameters that are local to that arc
+ */
+template< typename InitialStateParameterType >
+std::vector< std::vector< int > > getArcLocalParameterIndices(
+        const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< InitialStateParameterType > > parametersToEstimate )
+{
+    using namespace estimatable_parameters;
+
+    std::vector< double > arcStartTimes = parametersToEstimate->getArcStartingTimes( );
+    if( arcStartTimes.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when determining arc-local parameters, no multi-arc initial state parameters found" );
+    }
+    std::vector< std::vector< int > > arcLocalParameterIndices( arcStartTimes.size( ) );
+
+    // Function to add entries of an arc-wise parameter (starting at given index, with given size per arc) to the arc of the
+    // dynamics that contains each parameter arc. For parameters of which the arcs end at the start of the next parameter
+    // arc, the full parameter arc must lie in a single arc of the dynamics
+    auto addArcWiseParameterEntries = [ & ]( const int startIndex, const int singleArcParameterSize,
+            const std::vector< double >& parameterArcStartTimes, const bool parameterArcsEndAtNextArc )
+    {
+        for( unsigned int i = 0; i < parameterArcStartTimes.size( ); i++ )
+        {
+            double parameterArcStartTime = parameterArcStartTimes.at( i );
+            double parameterArcEndTime = parameterArcStartTime;
+            if( parameterArcsEndAtNextArc )
+            {
+                parameterArcEndTime = ( i + 1 < parameterArcStartTimes.size( ) ) ?
+                            parameterArcStartTimes.at( i + 1 ) : std::numeric_limits< double >::infinity( );
+            }
+
+            double timeTolerance = std::max( 4.0 * std::fabs( parameterArcStartTime ) * std::numeric_limits< double >::epsilon( ), 1.0E-12 );
+            int arcIndex = static_cast< int >( std::upper_bound( arcStartTimes.begin( ), arcStartTimes.end( ),
+                                                                 parameterArcStartTime + timeTolerance ) - arcStartTimes.begin( ) ) - 1;
+            if( arcIndex >= 0 && ( arcIndex + 1 == static_cast< int >( arcStartTimes.size( ) ) ||
+                                   parameterArcEndTime <= arcStartTimes.at( arcIndex + 1 ) + timeTolerance ) )
+            {
+                for( int j = 0; j < singleArcParameterSize; j++ )
+                {
+                    arcLocalParameterIndices[ arcIndex ].push_back( startIndex + i * singleArcParameterSize + j );
+                }
+            }
+        }
+    };
+
+    // Add arc-wise initial states
+    std::map< int, std::shared_ptr< EstimatableParameter< Eigen::Matrix< InitialStateParameterType, Eigen::Dynamic, 1 > > > >
+            initialStateParameters = parametersToEstimate->getInitialStateParameters( );
+    for( auto parameterIterator : initialStateParameters )
+    {
+        if( parameterIterator.second->getParameterName( ).first == arc_wise_initial_body_state )
+        {
+            std::shared_ptr< ArcWiseInitialTranslationalStateParameter< InitialStateParameterType > > arcWiseStateParameter =
+                    std::dynamic_pointer_cast< ArcWiseInitialTranslationalStateParameter< InitialStateParameterType > >(
+                        parameterIterator.second );
+            if( arcWiseStateParameter != nullptr )
+            {
+                addArcWiseParameterEntries( parameterIterator.first, 6, arcWiseStateParameter->getArcStartTimes( ), false );
+            }
+        }
+    }
+
+    // Add arc-wise vector parameters
+    std::map< int, std::shared_ptr< EstimatableParameter< Eigen::VectorXd > > > vectorParameters =
+            parametersToEstimate->getVectorParameters( );
+    for( auto parameterIterator : vectorParameters )
+    {
+        std::vector< double > parameterArcStartTimes;
+        switch( parameterIterator.second->getParameterName( ).first )
+        {
+        case arcwise_constant_additive_observation_bias:
+        case arcwise_constant_relative_observation_bias:
+            parameterArcStartTimes = std::dynamic_pointer_cast< ArcWiseObservationBiasParameter >(
+                        parameterIterator.second )->getArcStartTimes( );
+            break;
+        case arc_wise_time_drift_observation_bias:
+            parameterArcStartTimes = std::dynamic_pointer_cast< ArcWiseTimeDriftBiasParameter >(
+                        parameterIterator.second )->getArcStartTimes( );
+            break;
+        case arc_wise_time_observation_bias:
+            parameterArcStartTimes = std::dynamic_pointer_cast< ArcWiseTimeBiasParameter >(
+                        parameterIterator.second )->getArcStartTimes( );
+            break;
+        case arc_wise_empirical_acceleration_coefficients:
+            parameterArcStartTimes = std::dynamic_pointer_cast< ArcWiseEmpiricalAccelerationCoefficientsParameter >(
+                        parameterIterator.second )->getArcStartTimes( );
+            break;
+        case arc_wise_constant_drag_coefficient:
+            parameterArcStartTimes = std::dynamic_pointer_cast< ArcWiseConstantDragCoefficient >(
+                        parameterIterator.second )->getArcStartTimes( );
+            break;
+        case arc_wise_radiation_pressure_coefficient:
+            parameterArcStartTimes = std::dynamic_pointer_cast< ArcWiseRadiationPressureCoefficient >(
+                        parameterIterator.second )->getArcStartTimes( );
+            break;
+        default:
+            break;
+        }
+
+        if( parameterArcStartTimes.size( ) > 0 )
+        {
+            addArcWiseParameterEntries(
+                        parameterIterator.first, parameterIterator.second->getParameterSize( ) / parameterArcStartTimes.size( ),
+                        parameterArcStartTimes, true );
+        }
+    }
+
+    for( unsigned int i = 0; i < arcLocalParameterIndices.size( ); i++ )
+    {
+        std::sort( arcLocalParameterIndices[ i ].begin( ), arcLocalParameterIndices[ i ].end( ) );
+    }
+    return arcLocalParameterIndices;
+}
+
 //! Top-level class for performing orbit determination.
 /*!
  *  Top-level class for performing orbit determination. All required propagation/estimation settings are provided to
@@ -248,12 +380,14 @@ public:
             parametersToEstimate,
             const std::vector< std::shared_ptr< observation_models::ObservationModelSettings > >& observationSettingsList,
             const std::shared_ptr< propagators::PropagatorSettings< ObservationScalarType > > propagatorSettings,
-            const bool propagateOnCreation = true ):
+            const bool propagateOnCreation = true,
+            const std::vector< SystemOfBodies >& arcWiseBodies = std::vector< SystemOfBodies >( ) ):
         parametersToEstimate_( parametersToEstimate ),
         considerParameters_( parametersToEstimate_->getConsiderParameters( ) ),
         bodies_( bodies )
     {
-        initializeOrbitDeterminationManager( bodies, observationSettingsList, propagatorSettings, propagateOnCreation );
+        initializeOrbitDeterminationManager( bodies, observationSettingsList, propagatorSettings, propagateOnCreation,
+                                             arcWiseBodies );
     }
 
     std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > > getParametersToEstimate( )
@@ -280,6 +414,22 @@ public:
         return observationManagers_;
     }
 
+    //! Function to retrieve the structural sparsity of the design matrix
+    /*!
+     *  Function to retrieve the structural sparsity of the design matrix: the indices (in the full vector of estimated and
+     *  consider parameters, in increasing order) of the columns of the design matrix that may be non-zero, per observable
+     *  type and set of link ends. The columns of observation link properties (e.g. observation biases) for which no partial
+     *  exists for the given link ends are omitted. All other columns are included, as they may enter the observation
+     *  through the state transition/sensitivity matrix. These lists are used to skip the zero blocks when assembling the
+     *  design matrix and normal equations.
+     *  \return Indices of possibly non-zero columns of the design matrix, per observable type and set of link ends
+     */
+    const std::map< observation_models::ObservableType, std::map< observation_models::LinkEnds, std::vector< int > > >&
+    getDesignMatrixSparsity( ) const
+    {
+        return designMatrixSparsity_;
+    }
+
     //! Function to retrieve map of all observation simulators
     /*!
      *  Function to retrieve map of all observation simulators. A single observation simulators can simulate observations all
@@ -382,66 +532,84 @@ public:
             Eigen::VectorXd& residuals,
             const bool calculateResiduals = true )
     {
+        TUDAT_TRACE_SCOPE( "design_matrix", "estimation" );
+
         // Initialize return data.
         designMatrix = Eigen::MatrixXd::Zero( totalObservationSize, totalNumberParameters_ );
         residuals = Eigen::VectorXd::Zero( totalObservationSize );
 
-        typename observation_models::ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets
+        const typename observation_models::ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets&
                 sortedObservations = observationsCollection->getObservations( );
 
-//        std::cout << "start calculateObservationMatrixAndResiduals" << "\n\n";
+        // Solve light time of each link, compute the partials of links shared by composite observables, and interpolate the
+        // state transition matrix rows of each body, only once per epoch for all observables (environment and propagated dynamics are fixed during this function)
+        observation_models::setLightTimeSolutionCaching( getObservationSimulators( ), true );
+        oneWayRangePartialRegistry_->setPartialCaching( true );
+        if( stateTransitionAndSensitivityMatrixInterface_ != nullptr )
+        {
+            stateTransitionAndSensitivityMatrixInterface_->setMatrixCaching( true );
+        }
 
-        // Iterate over all observable types in observationsAndTimes
-        for( auto observablesIterator : sortedObservations )
+        // Retrieve all observation sets, and the segments of consecutive epochs in which they are processed
+        std::vector< std::tuple< observation_models::ObservableType, observation_models::LinkEnds, int > > observationSets =
+                getObservationSetsToProcess( observationsCollection, false );
+        const int maximumNumberOfObservationsPerSegment = std::numeric_limits< int >::max( );
+
+        if( numberOfDesignMatrixThreads_ > 1 )
         {
-            observation_models::ObservableType currentObservableType = observablesIterator.first;
+            // Determine groups of sets that share no observation model objects
+            std::vector< std::vector< int > > workerObservationSets = distributeObservationSetsOverThreads(
+                        observationsCollection, observationSets );
 
-            // Iterate over all link ends for current observable type in observationsAndTimes
-            for( auto dataIterator : observablesIterator.second )
+            // Compute residuals and partials of each group in a separate thread
+            utilities::executeParallelTasks(
+                        workerObservationSets.size( ), [ & ]( const int workerIndex )
             {
-                observation_models::LinkEnds currentLinkEnds = dataIterator.first;
-                for( unsigned int i = 0; i < dataIterator.second.size( ); i++ )
+                std::vector< std::tuple< int, int, int > > observationSegments = getObservationSegmentsToProcess(
+                            observationsCollection, observationSets, workerObservationSets.at( workerIndex ),
+                            maximumNumberOfObservationsPerSegment );
+                for( unsigned int j = 0; j < observationSegments.size( ); j++ )
                 {
-                    std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > currentObservations =
-                            dataIterator.second.at( i );
-                    std::pair< int, int > observationIndices = observationsCollection->getObservationSetStartAndSize( ).at(
-                                currentObservableType ).at( currentLinkEnds ).at( i );
-
-                    // Compute estimated ranges and range partials from current parameter estimate.
-                    std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials;
-                    observationsWithPartials = observationManagers_[ currentObservableType ]->
-                            computeObservationsWithPartials(
-                                currentObservations->getObservationTimes( ), currentLinkEnds,
-                                currentObservations->getReferenceLinkEnd( ),
-                                currentObservations->getAncilliarySettings( ) );
-
-                    // Compute residuals for current link ends and observabel type.
-                    if( calculateResiduals )
-                    {
-                        residuals.segment( observationIndices.first, observationIndices.second ) =
-                                ( currentObservations->getObservationsVector( ) - observationsWithPartials.first ).template cast< double >( );
-
-                    }
-
-                    // Set current observation partials in matrix of all partials
-                    designMatrix.block( observationIndices.first, 0, observationIndices.second, totalNumberParameters_ ) =
-                            observationsWithPartials.second;
-
+                    calculateObservationSegmentDesignMatrixAndResiduals(
+                                observationsCollection, observationSets.at( std::get< 0 >( observationSegments.at( j ) ) ),
+                                std::get< 1 >( observationSegments.at( j ) ), std::get< 2 >( observationSegments.at( j ) ),
+                                designMatrix, residuals, calculateResiduals );
                 }
-
+            }, numberOfDesignMatrixThreads_ );
+        }
+        else
+        {
+            std::vector< int > allObservationSets( observationSets.size( ) );
+            std::iota( allObservationSets.begin( ), allObservationSets.end( ), 0 );
+            std::vector< std::tuple< int, int, int > > observationSegments = getObservationSegmentsToProcess(
+                        observationsCollection, observationSets, allObservationSets, maximumNumberOfObservationsPerSegment );
+            for( unsigned int j = 0; j < observationSegments.size( ); j++ )
+            {
+                calculateObservationSegmentDesignMatrixAndResiduals(
+                            observationsCollection, observationSets.at( std::get< 0 >( observationSegments.at( j ) ) ),
+                            std::get< 1 >( observationSegments.at( j ) ), std::get< 2 >( observationSegments.at( j ) ),
+                            designMatrix, residuals, calculateResiduals );
             }
+        }
+        observation_models::setLightTimeSolutionCaching( getObservationSimulators( ), false );
+        oneWayRangePartialRegistry_->setPartialCaching( false );
+        if( stateTransitionAndSensitivityMatrixInterface_ != nullptr )
+        {
+            stateTransitionAndSensitivityMatrixInterface_->setMatrixCaching( false );
+        }
 
-            if( calculateResiduals )
+        if( calculateResiduals )
+        {
+            for( auto observablesIterator : sortedObservations )
             {
-                std::pair< int, int > observableStartAndSize = observationsCollection->getObservationTypeStartAndSize( ).at( currentObservableType );
+                std::pair< int, int > observableStartAndSize = observationsCollection->getObservationTypeStartAndSize( ).at(
+                            observablesIterator.first );
 
                 observation_models::checkObservationResidualDiscontinuities(
                             residuals.block( observableStartAndSize.first, 0, observableStartAndSize.second, 1 ),
-                            currentObservableType );
+                            observablesIterator.first );
             }
         }
-//        std::cout << "end calculateObservationMatrixAndResiduals" << "\n\n";
-
     }
 
     void calculateDesignMatrix(
@@ -455,6 +623,150 @@ public:
 
     }
 
+    //! Function to calculate the normal equations and residuals, without storing the full design matrix
+    /*!
+     *  Function to calculate the normal equations (H^T W H and H^T W y) and residuals y, based on the state transition
+     *  matrix, sensitivity matrix and body states resulting from the previous numerical integration iteration. The partials
+     *  are computed for blocks of at most maximumNumberOfObservationsPerBlock observations at a time, and added to the
+     *  normal equations, so that the full design matrix H is never stored. When using more than one thread (see
+     *  setNumberOfDesignMatrixThreads), each thread accumulates the normal equations of its groups of observation sets,
+     *  which are then summed in thread order (so that the result is deterministic for a given number of threads).
+     *  \param observationsCollection Full set of observations
+     *  \param weightsMatrixDiagonals Diagonal of the observation weights matrix (same order as observations)
+     *  \param maximumNumberOfObservationsPerBlock Maximum number of observations for which the partials are computed at once
+     *  \param normalEquations Normal equations w.r.t. the full parameter vector (estimated and consider parameters), with
+     *  right-hand side zero if residuals are not calculated (returned by reference). Either dense
+     *  (NormalEquationsAccumulator) or block-structured per arc (ArcWiseNormalEquationsAccumulator, with the arc-local
+     *  parameters as set by estimateParameters).
+     *  \param residuals Residuals of computed w.r.t. input observable values (returned by reference)
+     *  \param calculateResiduals Boolean denoting whether residuals are to be computed
+     */
+    template< typename NormalEquationsType = linear_algebra::NormalEquationsAccumulator >
+    void calculateNormalEquationsAndResiduals(
+            const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
+            const Eigen::VectorXd& weightsMatrixDiagonals,
+            const int maximumNumberOfObservationsPerBlock,
+            NormalEquationsType& normalEquations,
+            Eigen::VectorXd& residuals,
+            const bool calculateResiduals = true )
+    {
+        TUDAT_TRACE_SCOPE( "normal_equations", "estimation" );
+
+        // Initialize return data.
+        resetNormalEquations( normalEquations );
+        residuals = Eigen::VectorXd::Zero( observationsCollection->getTotalObservableSize( ) );
+
+        // Check whether observation sets are distributed over processes (only those of the current process are used)
+        bool distributeOverProcesses = isDistributedOverProcesses( normalEquations );
+        std::vector< std::tuple< observation_models::ObservableType, observation_models::LinkEnds, int > > observationSets =
+                getObservationSetsToProcess( observationsCollection, distributeOverProcesses );
+
+        // Accumulate normal equations of each thread, and sum per-thread results in thread order
+        std::vector< NormalEquationsType > workerNormalEquations( std::max( numberOfDesignMatrixThreads_, 1 ), normalEquations );
+        setObservationCaching( true );
+        accumulateObservationSetsNormalEquations(
+                    observationsCollection, observationSets, weightsMatrixDiagonals, maximumNumberOfObservationsPerBlock,
+                    workerNormalEquations, residuals, calculateResiduals );
+        setObservationCaching( false );
+        for( unsigned int i = 0; i < workerNormalEquations.size( ); i++ )
+        {
+            normalEquations.addNormalEquations( workerNormalEquations.at( i ) );
+        }
+
+        finalizeNormalEquationsAndResiduals(
+                    observationsCollection, normalEquations, residuals, calculateResiduals, distributeOverProcesses );
+    }
+
+    //! Function to calculate the normal equations and residuals, processing the observations of each arc after its propagation
+    /*!
+     *  Function to calculate the normal equations and residuals (see calculateNormalEquationsAndResiduals) for a multi-arc
+     *  estimation, propagating the variational equations of each arc for the current parameter estimate, and processing the
+     *  observations of the arc directly after its propagation (see
+     *  MultiArcVariationalEquationsSolver::integrateVariationalEquationsPerArc), such that the state transition and
+     *  sensitivity matrix histories of all arcs are never stored simultaneously. The equations of motion must have been
+     *  propagated for the current parameter estimate beforehand, and each observation set must lie within a single arc.
+     *  After this function, the state transition matrix interface contains no interpolators.
+     *  \param observationsCollection Full set of observations
+     *  \param weightsMatrixDiagonals Diagonal of the observation weights matrix (same order as observations)
+     *  \param maximumNumberOfObservationsPerBlock Maximum number of observations for which the partials are computed at once
+     *  \param normalEquations Normal equations w.r.t. the full parameter vector (returned by reference), see
+     *  calculateNormalEquationsAndResiduals.
+     *  \param residuals Residuals of computed w.r.t. input observable values (returned by reference)
+     *  \param calculateResiduals Boolean denoting whether residuals are to be computed
+     */
+    template< typename NormalEquationsType = linear_algebra::NormalEquationsAccumulator >
+    void calculatePipelinedNormalEquationsAndResiduals(
+            const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
+            const Eigen::VectorXd& weightsMatrixDiagonals,
+            const int maximumNumberOfObservationsPerBlock,
+            NormalEquationsType& normalEquations,
+            Eigen::VectorXd& residuals,
+            const bool calculateResiduals = true )
+    {
+        TUDAT_TRACE_SCOPE( "normal_equations", "estimation" );
+
+        std::shared_ptr< propagators::MultiArcVariationalEquationsSolver< ObservationScalarType, TimeType > > multiArcSolver =
+                std::dynamic_pointer_cast< propagators::MultiArcVariationalEquationsSolver< ObservationScalarType, TimeType > >(
+                    variationalEquationsSolver_ );
+        if( multiArcSolver == nullptr )
+        {
+            throw std::runtime_error( "Error when calculating normal equations per arc, multi-arc variational equations solver is required" );
+        }
+
+        // Initialize return data.
+        resetNormalEquations( normalEquations );
+        residuals = Eigen::VectorXd::Zero( observationsCollection->getTotalObservableSize( ) );
+
+        // Retrieve observation sets (of current process), and assign them to the arcs
+        bool distributeOverProcesses = isDistributedOverProcesses( normalEquations );
+        std::vector< std::tuple< observation_models::ObservableType, observation_models::LinkEnds, int > > observationSets =
+                getObservationSetsToProcess( observationsCollection, distributeOverProcesses );
+
+        std::vector< double > arcStartTimes = multiArcSolver->getPropagatorSettings( )->getArcStartTimes( );
+        std::vector< std::vector< std::tuple< observation_models::ObservableType, observation_models::LinkEnds, int > > >
+                arcObservationSets( arcStartTimes.size( ) );
+        for( unsigned int i = 0; i < observationSets.size( ); i++ )
+        {
+            std::pair< int, int > observationArcRange = getObservationSetArcRange(
+                        observationsCollection, std::get< 0 >( observationSets.at( i ) ), std::get< 1 >( observationSets.at( i ) ),
+                        std::get< 2 >( observationSets.at( i ) ), arcStartTimes );
+            if( observationArcRange.first != observationArcRange.second )
+            {
+                throw std::runtime_error( "Error when calculating normal equations per arc, observation set spans arcs " +
+                                          std::to_string( observationArcRange.first ) + " to " +
+                                          std::to_string( observationArcRange.second ) );
+            }
+            arcObservationSets.at( std::max( observationArcRange.first, 0 ) ).push_back( observationSets.at( i ) );
+        }
+
+        // Propagate variational equations, and accumulate normal equations of each arc directly after its propagation
+        std::vector< NormalEquationsType > workerNormalEquations( std::max( numberOfDesignMatrixThreads_, 1 ), normalEquations );
+        setObservationCaching( true );
+        try
+        {
+            multiArcSolver->integrateVariationalEquationsPerArc( [ & ]( const int arcIndex )
+            {
+                TUDAT_TRACE_SCOPE_WITH_INDEX( "arc_normal_equations", "estimation", arcIndex );
+                accumulateObservationSetsNormalEquations(
+                            observationsCollection, arcObservationSets.at( arcIndex ), weightsMatrixDiagonals,
+                            maximumNumberOfObservationsPerBlock, workerNormalEquations, residuals, calculateResiduals );
+            } );
+        }
+        catch( ... )
+        {
+            setObservationCaching( false );
+            throw;
+        }
+        setObservationCaching( false );
+        for( unsigned int i = 0; i < workerNormalEquations.size( ); i++ )
+        {
+            normalEquations.addNormalEquations( workerNormalEquations.at( i ) );
+        }
+
+        finalizeNormalEquationsAndResiduals(
+                    observationsCollection, normalEquations, residuals, calculateResiduals, distributeOverProcesses );
+    }
+
     Eigen::MatrixXd normalizeAprioriCovariance(
             const Eigen::MatrixXd& inverseAPrioriCovariance,
             const Eigen::VectorXd& normalizationValues )
@@ -603,9 +915,54 @@ public:
             fullParameterEstimate.segment( numberEstimatedParameters_, numberConsiderParameters_ ) = considerParametersValues_;
         }
 
-        // Compute design matrices (estimated and consider), and residuals (empty for covariance analysis)
         bool exceptionDuringPropagation = false;
         std::shared_ptr< propagators::SimulationResults< ObservationScalarType, TimeType > > simulationResults;
+
+        if( estimationInput->getAccumulateNormalEquations( ) )
+        {
+            // Compute normal equations, without storing design matrix
+            linear_algebra::NormalEquationsAccumulator normalEquations;
+            Eigen::VectorXd residuals;
+            performPreEstimationStepsWithNormalEquations(
+                        estimationInput, fullParameterEstimate, false, 0, exceptionDuringPropagation, simulationResults,
+                        normalEquations, residuals );
+
+            // Normalise normal equations and inverse a priori covariance
+            Eigen::VectorXd normalizationTerms, considerNormalizationTerms, normalizedRightHandSide;
+            Eigen::MatrixXd normalizedNormalMatrix, normalizedConsiderNormalMatrix;
+            getNormalizedNormalEquations( normalEquations, normalizationTerms, considerNormalizationTerms,
+                                          normalizedNormalMatrix, normalizedRightHandSide, normalizedConsiderNormalMatrix );
+            Eigen::MatrixXd normalizedInverseAprioriCovarianceMatrix = normalizeAprioriCovariance(
+                    estimationInput->getInverseOfAprioriCovariance( numberEstimatedParameters_ ), normalizationTerms );
+
+            // Retrieve constraints
+            Eigen::MatrixXd constraintStateMultiplier;
+            Eigen::VectorXd constraintRightHandSide;
+            parametersToEstimate_->getConstraints( constraintStateMultiplier, constraintRightHandSide );
+
+            // Compute inverse of updated covariance
+            Eigen::MatrixXd inverseNormalizedCovariance = linear_algebra::calculateInverseOfUpdatedCovarianceMatrixFromNormalMatrix(
+                    normalizedNormalMatrix, normalizedInverseAprioriCovarianceMatrix, constraintStateMultiplier, constraintRightHandSide );
+
+            // Compute contribution consider parameters
+            Eigen::MatrixXd covarianceContributionConsiderParameters = Eigen::MatrixXd::Zero( 0, 0 );
+            if ( considerParametersIncluded_ )
+            {
+                covarianceContributionConsiderParameters = linear_algebra::calculateConsiderParametersCovarianceContributionFromNormalMatrix(
+                        inverseNormalizedCovariance.inverse( ), normalizedConsiderNormalMatrix,
+                        normalizeCovariance( estimationInput->getConsiderCovariance( ), considerNormalizationTerms ) );
+            }
+
+            std::shared_ptr< CovarianceAnalysisOutput< ObservationScalarType, TimeType > > covarianceOutput =
+                    std::make_shared< CovarianceAnalysisOutput< ObservationScalarType, TimeType > >(
+                        Eigen::MatrixXd::Zero( 0, 0 ), estimationInput->getWeightsMatrixDiagonals( ), normalizationTerms,
+                        inverseNormalizedCovariance, Eigen::MatrixXd::Zero( 0, 0 ), considerNormalizationTerms,
+                        covarianceContributionConsiderParameters, exceptionDuringPropagation );
+            setOutputMemoryFootprint( covarianceOutput, estimationInput );
+            return covarianceOutput;
+        }
+
+        // Compute design matrices (estimated and consider), and residuals (empty for covariance analysis)
         std::pair< std::pair< Eigen::MatrixXd, Eigen::MatrixXd >, Eigen::VectorXd > designMatricesAndResiduals = performPreEstimationSteps(
                 estimationInput, fullParameterEstimate, false, 0, exceptionDuringPropagation, simulationResults );
         Eigen::MatrixXd designMatrixEstimatedParameters = designMatricesAndResiduals.first.first;
@@ -669,10 +1026,67 @@ public:
                      designMatrixEstimatedParameters, estimationInput->getWeightsMatrixDiagonals( ), normalizationTerms,
                     inverseNormalizedCovariance, designMatrixConsiderParameters, considerNormalizationTerms, covarianceContributionConsiderParameters,
                     exceptionDuringPropagation );
+        setOutputMemoryFootprint( estimationOutput, estimationInput );
 
         return estimationOutput;
     }
 
+    //! Function to create an object with which covariance analyses can be repeated without recomputing the partials
+    /*!
+     *  Function to create an object with which covariance analyses can be repeated with different observation weights,
+     *  subsets of the observation sets, and a priori and consider covariances (see CovarianceSensitivityAnalysis). The
+     *  variational equations are propagated and the observation partials are computed once, as in computeCovariance (always
+     *  forming the full design matrix, regardless of the getAccumulateNormalEquations setting), after which they are stored
+     *  per observation set. The weights and covariances in the input are not used.
+     *  \param estimationInput Object containing the observations for which the partials are to be computed
+     *  \return Object with which covariance analyses can be performed from the stored partials
+     */
+    std::shared_ptr< CovarianceSensitivityAnalysis< ObservationScalarType, TimeType > > createCovarianceSensitivityAnalysis(
+            const std::shared_ptr< CovarianceAnalysisInput< ObservationScalarType, TimeType > > estimationInput )
+    {
+        // Define full parameters values
+        Eigen::VectorXd parameterValues = parametersToEstimate_->template getFullParameterValues< ObservationScalarType >( );
+        ParameterVectorType fullParameterEstimate;
+        fullParameterEstimate.resize( totalNumberParameters_ );
+        fullParameterEstimate.segment( 0, numberEstimatedParameters_ ) = parameterValues;
+        if ( considerParametersIncluded_ )
+        {
+            fullParameterEstimate.segment( numberEstimatedParameters_, numberConsiderParameters_ ) = considerParametersValues_;
+        }
+
+        // Compute design matrices (estimated and consider)
+        bool exceptionDuringPropagation = false;
+        std::shared_ptr< propagators::SimulationResults< ObservationScalarType, TimeType > > simulationResults;
+        std::pair< std::pair< Eigen::MatrixXd, Eigen::MatrixXd >, Eigen::VectorXd > designMatricesAndResiduals = performPreEstimationSteps(
+                estimationInput, fullParameterEstimate, false, 0, exceptionDuringPropagation, simulationResults );
+        if( exceptionDuringPropagation )
+        {
+            throw std::runtime_error( "Error when creating covariance sensitivity analysis, exception caught during propagation" );
+        }
+
+        // Normalise partials
+        Eigen::MatrixXd designMatrixEstimatedParameters = designMatricesAndResiduals.first.first.block(
+                    0, 0, designMatricesAndResiduals.first.first.rows( ), numberEstimatedParameters_ );
+        Eigen::VectorXd normalizationTerms = normalizeDesignMatrix( designMatrixEstimatedParameters );
+
+        Eigen::MatrixXd designMatrixConsiderParameters = Eigen::MatrixXd::Zero( 0, 0 );
+        Eigen::VectorXd considerNormalizationTerms = Eigen::VectorXd::Zero( 0 );
+        if ( considerParametersIncluded_ )
+        {
+            designMatrixConsiderParameters = designMatricesAndResiduals.first.second;
+            considerNormalizationTerms = normalizeDesignMatrix( designMatrixConsiderParameters );
+        }
+
+        // Retrieve constraints
+        Eigen::MatrixXd constraintStateMultiplier;
+        Eigen::VectorXd constraintRightHandSide;
+        parametersToEstimate_->getConstraints( constraintStateMultiplier, constraintRightHandSide );
+
+        return std::make_shared< CovarianceSensitivityAnalysis< ObservationScalarType, TimeType > >(
+                    estimationInput->getObservationCollection( ), designMatrixEstimatedParameters, normalizationTerms,
+                    designMatrixConsiderParameters, considerNormalizationTerms, constraintStateMultiplier, constraintRightHandSide );
+    }
+
     //! Function to perform parameter estimation from measurement data.
     /*!
      *  Function to perform parameter estimation, including orbit determination, i.e. body initial states, from measurement data.
@@ -692,12 +1106,87 @@ public:
         // Get number of observations
         int totalNumberOfObservations = estimationInput->getObservationCollection( )->getTotalObservableSize( );
 
+        // Check whether normal equations are accumulated, instead of forming full design matrix
+        bool accumulateNormalEquations = estimationInput->getAccumulateNormalEquations( ) ||
+                estimationInput->getReduceArcLocalParameters( ) || estimationInput->getPipelinedArcProcessing( );
+        int numberOfStoredDesignMatrixRows = accumulateNormalEquations ? 0 : totalNumberOfObservations;
+
+        // Check whether arc-local parameters are eliminated, and determine these parameters for each arc
+        bool reduceArcLocalParameters = estimationInput->getReduceArcLocalParameters( );
+        if( reduceArcLocalParameters )
+        {
+            if( considerParametersIncluded_ )
+            {
+                throw std::runtime_error( "Error when estimating parameters, arc-local parameter reduction is not supported with consider parameters" );
+            }
+            if( parametersToEstimate_->getConstraintSize( ) > 0 )
+            {
+                throw std::runtime_error( "Error when estimating parameters, arc-local parameter reduction is not supported with constraints" );
+            }
+            arcLocalParameterIndices_ = getArcLocalParameterIndices( parametersToEstimate_ );
+            arcStartTimes_ = parametersToEstimate_->getArcStartingTimes( );
+        }
+        else if( processCommunicator_ != nullptr )
+        {
+            throw std::runtime_error( "Error when estimating parameters, distribution over processes requires arc-local parameter reduction" );
+        }
+
+        // Check whether the observations of each arc are processed directly after the propagation of the arc
+        bool pipelinedArcProcessing = estimationInput->getPipelinedArcProcessing( );
+        if( pipelinedArcProcessing )
+        {
+            if( std::dynamic_pointer_cast< propagators::MultiArcVariationalEquationsSolver< ObservationScalarType, TimeType > >(
+                        variationalEquationsSolver_ ) == nullptr )
+            {
+                throw std::runtime_error( "Error when estimating parameters, pipelined arc processing requires multi-arc dynamics" );
+            }
+            if( estimationInput->getSaveStateHistoryForEachIteration( ) )
+            {
+                throw std::runtime_error( "Error when estimating parameters, pipelined arc processing is not supported when saving the state history for each iteration" );
+            }
+        }
+
+        // Determine parameters for which the partials are reused between iterations
+        std::vector< int > reusedPartialsIndices = estimationInput->getReusedPartialsParameterIndices( );
+        std::vector< int > reusedPartialsFullIndices;
+        if( reusedPartialsIndices.size( ) > 0 )
+        {
+            if( accumulateNormalEquations )
+            {
+                throw std::runtime_error( "Error when estimating parameters, reuse of partials is not supported when accumulating normal equations" );
+            }
+            std::vector< int > estimatedParameterIndices = getEstimatedParameterIndicesInFullParameterVector( );
+            for( unsigned int i = 0; i < reusedPartialsIndices.size( ); i++ )
+            {
+                if( reusedPartialsIndices.at( i ) < 0 || reusedPartialsIndices.at( i ) >= static_cast< int >( numberEstimatedParameters_ ) )
+                {
+                    throw std::runtime_error( "Error when estimating parameters, index " + std::to_string( reusedPartialsIndices.at( i ) ) +
+                                              " of parameter for which partials are reused is out of bounds" );
+                }
+                reusedPartialsFullIndices.push_back( estimatedParameterIndices.at( reusedPartialsIndices.at( i ) ) );
+            }
+        }
+        // Retrieve settings for the reweighting of the observations within each iteration
+        std::shared_ptr< ObservationReweightingSettings > reweightingSettings =
+                estimationInput->getObservationReweightingSettings( );
+        if( reweightingSettings != nullptr && accumulateNormalEquations )
+        {
+            throw std::runtime_error( "Error when estimating parameters, reweighting of observations is not supported when accumulating normal equations" );
+        }
+        Eigen::VectorXd nominalWeights = estimationInput->getWeightsMatrixDiagonals( );
+        Eigen::VectorXd currentWeights = nominalWeights;
+
+        bool computeReusedPartials = true;
+        Eigen::MatrixXd reusedPartials;
+        Eigen::VectorXd reusedPartialsScaling;
+        ParameterVectorType parameterEstimateForReusedPartials;
+
         // Declare variables to be returned (i.e. results from best iteration)
         double bestResidual = TUDAT_NAN;
         ParameterVectorType bestParameterEstimate = ParameterVectorType::Constant( numberEstimatedParameters_, TUDAT_NAN );
         Eigen::VectorXd bestTransformationData = Eigen::VectorXd::Constant( numberEstimatedParameters_, TUDAT_NAN );
         Eigen::VectorXd bestResiduals = Eigen::VectorXd::Constant( totalNumberOfObservations, TUDAT_NAN );
-        Eigen::MatrixXd bestDesignMatrixEstimatedParameters = Eigen::MatrixXd::Constant( totalNumberOfObservations, totalNumberParameters_, TUDAT_NAN );
+        Eigen::MatrixXd bestDesignMatrixEstimatedParameters = Eigen::MatrixXd::Constant( numberOfStoredDesignMatrixRows, totalNumberParameters_, TUDAT_NAN );
         Eigen::VectorXd bestWeightsMatrixDiagonal = Eigen::VectorXd::Constant( totalNumberOfObservations, TUDAT_NAN );
         Eigen::MatrixXd bestInverseNormalizedCovarianceMatrix = Eigen::MatrixXd::Constant( numberEstimatedParameters_, numberEstimatedParameters_, TUDAT_NAN );
 
@@ -706,7 +1195,7 @@ public:
         if ( considerParametersIncluded_ )
         {
             bestConsiderTransformationData = Eigen::VectorXd::Constant( numberConsiderParameters_, TUDAT_NAN );
-            bestDesignMatrixConsiderParameters = Eigen::MatrixXd::Constant( totalNumberOfObservations, numberConsiderParameters_, TUDAT_NAN );
+            bestDesignMatrixConsiderParameters = Eigen::MatrixXd::Constant( numberOfStoredDesignMatrixRows, numberConsiderParameters_, TUDAT_NAN );
             bestConsiderCovarianceContribution = Eigen::MatrixXd::Constant( numberEstimatedParameters_, numberEstimatedParameters_, TUDAT_NAN );
         }
         else
@@ -737,6 +1226,8 @@ public:
         int numberOfIterations = 0;
         while( true )
         {
+            TUDAT_TRACE_SCOPE_WITH_INDEX( "estimation_iteration", "estimation", numberOfIterations );
+
             oldParameterEstimate = newParameterEstimate;
             newFullParameterEstimate.segment( 0, numberEstimatedParameters_ ) = newParameterEstimate;
             if ( considerParametersIncluded_ )
@@ -744,20 +1235,68 @@ public:
                 newFullParameterEstimate.segment( numberEstimatedParameters_, numberConsiderParameters_ ) = considerParametersValues_;
             }
 
-            // Compute design matrices (for estimated and consider parameters) and residuals.
             std::shared_ptr< propagators::SimulationResults< ObservationScalarType, TimeType > > simulationResults;
-            std::pair< std::pair< Eigen::MatrixXd, Eigen::MatrixXd >, Eigen::VectorXd > designMatricesAndResiduals = performPreEstimationSteps(
-                    estimationInput, newFullParameterEstimate, true, numberOfIterations, exceptionDuringPropagation, simulationResults );
-            Eigen::VectorXd residuals = designMatricesAndResiduals.second;
-            Eigen::MatrixXd designMatrixEstimatedParameters = designMatricesAndResiduals.first.first;
-            Eigen::MatrixXd designMatrixConsiderParameters;
-            if ( considerParametersIncluded_ )
+            Eigen::VectorXd residuals;
+            Eigen::MatrixXd designMatrixEstimatedParameters;
+            Eigen::MatrixXd designMatrixConsiderParameters = Eigen::MatrixXd::Zero( 0, 0 );
+            linear_algebra::NormalEquationsAccumulator normalEquations;
+            linear_algebra::ArcWiseNormalEquationsAccumulator arcWiseNormalEquations;
+            if( reduceArcLocalParameters )
             {
-                designMatrixConsiderParameters = designMatricesAndResiduals.first.second;
+                // Compute block-structured normal equations and residuals.
+                performPreEstimationStepsWithNormalEquations(
+                        estimationInput, newFullParameterEstimate, true, numberOfIterations, exceptionDuringPropagation, simulationResults,
+                        arcWiseNormalEquations, residuals, pipelinedArcProcessing );
+            }
+            else if( accumulateNormalEquations )
+            {
+                // Compute normal equations (for estimated and consider parameters) and residuals.
+                performPreEstimationStepsWithNormalEquations(
+                        estimationInput, newFullParameterEstimate, true, numberOfIterations, exceptionDuringPropagation, simulationResults,
+                        normalEquations, residuals, pipelinedArcProcessing );
             }
             else
             {
-                designMatrixConsiderParameters = Eigen::MatrixXd::Zero( 0, 0 );
+                // Skip computation of partials that are reused from a previous iteration
+                if( reusedPartialsIndices.size( ) > 0 && !computeReusedPartials )
+                {
+                    setSkippedPartialParameterIndices( reusedPartialsFullIndices );
+                }
+
+                // Compute design matrices (for estimated and consider parameters) and residuals.
+                std::pair< std::pair< Eigen::MatrixXd, Eigen::MatrixXd >, Eigen::VectorXd > designMatricesAndResiduals = performPreEstimationSteps(
+                        estimationInput, newFullParameterEstimate, true, numberOfIterations, exceptionDuringPropagation, simulationResults );
+                residuals = designMatricesAndResiduals.second;
+                designMatrixEstimatedParameters = designMatricesAndResiduals.first.first;
+                if ( considerParametersIncluded_ )
+                {
+                    designMatrixConsiderParameters = designMatricesAndResiduals.first.second;
+                }
+
+                // Store newly computed partials that are to be reused, or set reused partials in design matrix
+                if( reusedPartialsIndices.size( ) > 0 )
+                {
+                    setSkippedPartialParameterIndices( std::vector< int >( ) );
+                    if( computeReusedPartials )
+                    {
+                        reusedPartials.resize( designMatrixEstimatedParameters.rows( ), reusedPartialsIndices.size( ) );
+                        reusedPartialsScaling.resize( reusedPartialsIndices.size( ) );
+                        for( unsigned int i = 0; i < reusedPartialsIndices.size( ); i++ )
+                        {
+                            reusedPartials.col( i ) = designMatrixEstimatedParameters.col( reusedPartialsIndices.at( i ) );
+                            reusedPartialsScaling( i ) = reusedPartials.col( i ).cwiseAbs( ).maxCoeff( );
+                        }
+                        parameterEstimateForReusedPartials = oldParameterEstimate;
+                        computeReusedPartials = false;
+                    }
+                    else
+                    {
+                        for( unsigned int i = 0; i < reusedPartialsIndices.size( ); i++ )
+                        {
+                            designMatrixEstimatedParameters.col( reusedPartialsIndices.at( i ) ) = reusedPartials.col( i );
+                        }
+                    }
+                }
             }
 
             // Set simulation results
@@ -766,17 +1305,34 @@ public:
                 simulationResultsPerIteration.push_back( simulationResults );
             }
 
-            // Normalise estimated parameters partials and inverse apriori covariance
-            Eigen::VectorXd normalizationTerms = normalizeDesignMatrix( designMatrixEstimatedParameters );
+            // Normalise estimated parameters partials (or normal equations) and inverse apriori covariance
+            Eigen::VectorXd normalizationTerms, normalizationTermsConsider, normalizedRightHandSide;
+            Eigen::MatrixXd normalizedNormalMatrix, normalizedConsiderNormalMatrix;
+            if( reduceArcLocalParameters )
+            {
+                normalizationTerms = arcWiseNormalEquations.getNormalizationTerms( );
+            }
+            else if( accumulateNormalEquations )
+            {
+                getNormalizedNormalEquations( normalEquations, normalizationTerms, normalizationTermsConsider,
+                                              normalizedNormalMatrix, normalizedRightHandSide, normalizedConsiderNormalMatrix );
+            }
+            else
+            {
+                normalizationTerms = normalizeDesignMatrix( designMatrixEstimatedParameters );
+            }
             Eigen::MatrixXd normalizedInverseAprioriCovarianceMatrix = normalizeAprioriCovariance(
                     estimationInput->getInverseOfAprioriCovariance( numberEstimatedParameters_ ), normalizationTerms );
 
             // Normalise partials w.r.t. consider parameters, consider covariance and parameters deviations
-            Eigen::VectorXd normalizationTermsConsider, normalizedConsiderParametersDeviation;
+            Eigen::VectorXd normalizedConsiderParametersDeviation;
             Eigen::MatrixXd normalizedConsiderCovariance;
             if ( considerParametersIncluded_ )
             {
-                normalizationTermsConsider = normalizeDesignMatrix( designMatrixConsiderParameters );
+                if( !accumulateNormalEquations )
+                {
+                    normalizationTermsConsider = normalizeDesignMatrix( designMatrixConsiderParameters );
+                }
                 normalizedConsiderCovariance = normalizeCovariance( estimationInput->getConsiderCovariance( ), normalizationTermsConsider );
                 normalizedConsiderParametersDeviation = estimationInput->considerParametersDeviations_.cwiseProduct( normalizationTermsConsider );
             }
@@ -801,11 +1357,62 @@ public:
                 {
                     conditionNumberCheck = TUDAT_NAN;
                 }
+
                 // Perform LSQ inversion
-                leastSquaresOutput = std::move( linear_algebra::performLeastSquaresAdjustmentFromDesignMatrix(
-                        designMatrixEstimatedParameters, residuals, estimationInput->getWeightsMatrixDiagonals( ),
-                        normalizedInverseAprioriCovarianceMatrix, conditionNumberCheck, constraintStateMultiplier, constraintRightHandSide,
-                        designMatrixConsiderParameters, normalizedConsiderParametersDeviation ) );
+                TUDAT_TRACE_SCOPE( "least_squares_solution", "estimation" );
+                if( reduceArcLocalParameters )
+                {
+                    leastSquaresOutput = std::move( linear_algebra::performLeastSquaresAdjustmentWithArcLocalParameterReduction(
+                            arcWiseNormalEquations, normalizationTerms, normalizedInverseAprioriCovarianceMatrix,
+                            conditionNumberCheck, estimationInput->getLinearSolverType( ), numberOfDesignMatrixThreads_,
+                            processCommunicator_ ) );
+                }
+                else if( accumulateNormalEquations )
+                {
+                    if( normalizedConsiderParametersDeviation.size( ) > 0 )
+                    {
+                        normalizedRightHandSide += normalizedConsiderNormalMatrix * normalizedConsiderParametersDeviation;
+                    }
+                    leastSquaresOutput = std::move( linear_algebra::performLeastSquaresAdjustmentFromInformationMatrix(
+                            normalizedNormalMatrix, normalizedRightHandSide, normalizedInverseAprioriCovarianceMatrix,
+                            conditionNumberCheck, constraintStateMultiplier, constraintRightHandSide,
+                            estimationInput->getLinearSolverType( ) ) );
+                }
+                else
+                {
+                    // Solve, and (if requested) update the weights from the post-fit residuals and solve again, reusing the
+                    // design matrix, until the weights are converged
+                    int numberOfReweightingIterations = 0;
+                    while( true )
+                    {
+                        leastSquaresOutput = std::move( linear_algebra::performLeastSquaresAdjustmentFromDesignMatrix(
+                                designMatrixEstimatedParameters, residuals, currentWeights,
+                                normalizedInverseAprioriCovarianceMatrix, conditionNumberCheck, constraintStateMultiplier, constraintRightHandSide,
+                                designMatrixConsiderParameters, normalizedConsiderParametersDeviation,
+                                estimationInput->getLinearSolverType( ) ) );
+
+                        if( reweightingSettings == nullptr ||
+                                numberOfReweightingIterations >= reweightingSettings->getMaximumNumberOfReweightingIterations( ) )
+                        {
+                            break;
+                        }
+
+                        Eigen::VectorXd postFitResiduals = residuals - designMatrixEstimatedParameters *
+                                leastSquaresOutput.first.segment( 0, numberEstimatedParameters_ );
+                        if( normalizedConsiderParametersDeviation.size( ) > 0 )
+                        {
+                            postFitResiduals -= designMatrixConsiderParameters * normalizedConsiderParametersDeviation;
+                        }
+                        Eigen::VectorXd updatedWeights = reweightingSettings->computeWeights( nominalWeights, postFitResiduals );
+                        numberOfReweightingIterations++;
+
+                        if( reweightingSettings->areWeightsConverged( nominalWeights, currentWeights, updatedWeights ) )
+                        {
+                            break;
+                        }
+                        currentWeights = updatedWeights;
+                    }
+                }
 
                 if( constraintStateMultiplier.rows( ) > 0 )
                 {
@@ -825,10 +1432,15 @@ public:
 
             // Compute contribution consider parameters
             Eigen::MatrixXd covarianceContributionConsiderParameters;
-            if ( considerParametersIncluded_ )
+            if ( considerParametersIncluded_ && accumulateNormalEquations )
+            {
+                covarianceContributionConsiderParameters = linear_algebra::calculateConsiderParametersCovarianceContributionFromNormalMatrix(
+                        ( leastSquaresOutput.second ).inverse( ), normalizedConsiderNormalMatrix, normalizedConsiderCovariance );
+            }
+            else if ( considerParametersIncluded_ )
             {
                 covarianceContributionConsiderParameters = linear_algebra::calculateConsiderParametersCovarianceContribution(
-                        ( leastSquaresOutput.second ).inverse( ), designMatrixEstimatedParameters, estimationInput->getWeightsMatrixDiagonals( ),
+                        ( leastSquaresOutput.second ).inverse( ), designMatrixEstimatedParameters, currentWeights,
                         designMatrixConsiderParameters, normalizedConsiderCovariance );
             }
             else
@@ -836,8 +1448,17 @@ public:
                 covarianceContributionConsiderParameters = Eigen::MatrixXd::Zero( 0, 0 );
             }
 
-            // Calculate mean residual for current iteration.
-            residualRms = linear_algebra::getVectorEntryRootMeanSquare( residuals );
+            // Calculate mean residual for current iteration (excluding rejected observations, if reweighting).
+            int numberOfAcceptedObservations = ( currentWeights.array( ) > 0.0 ).count( );
+            if( reweightingSettings != nullptr && numberOfAcceptedObservations > 0 )
+            {
+                residualRms = std::sqrt( ( currentWeights.array( ) > 0.0 ).select( residuals.array( ).square( ), 0.0 ).sum( ) /
+                                         static_cast< double >( numberOfAcceptedObservations ) );
+            }
+            else
+            {
+                residualRms = linear_algebra::getVectorEntryRootMeanSquare( residuals );
+            }
             rmsResidualHistory.push_back( residualRms );
 
             if( estimationInput->getSaveResidualsAndParametersFromEachIteration( ) )
@@ -868,7 +1489,7 @@ public:
                         bestDesignMatrixConsiderParameters = std::move( designMatrixConsiderParameters );
                     }
                 }
-                bestWeightsMatrixDiagonal = std::move( estimationInput->getWeightsMatrixDiagonals( ) );
+                bestWeightsMatrixDiagonal = currentWeights;
                 bestTransformationData = std::move( normalizationTerms );
                 bestInverseNormalizedCovarianceMatrix = std::move( leastSquaresOutput.second );
                 bestIteration = numberOfIterations;
@@ -909,6 +1530,22 @@ public:
                 {
                     std::cout << "Parameter update" << parameterAddition.transpose( ) << std::endl;
                 }
+
+                // Check whether reused partials are to be recomputed, due to large change in associated parameters
+                double partialsRefreshTolerance = estimationInput->getPartialsRefreshTolerance( );
+                if( reusedPartialsIndices.size( ) > 0 && partialsRefreshTolerance == partialsRefreshTolerance )
+                {
+                    for( unsigned int i = 0; i < reusedPartialsIndices.size( ); i++ )
+                    {
+                        int currentIndex = reusedPartialsIndices.at( i );
+                        if( std::fabs( static_cast< double >( newParameterEstimate( currentIndex ) -
+                                                              parameterEstimateForReusedPartials( currentIndex ) ) ) *
+                                reusedPartialsScaling( i ) > partialsRefreshTolerance )
+                        {
+                            computeReusedPartials = true;
+                        }
+                    }
+                }
             }
 
             if( terminateLoop )
@@ -934,6 +1571,7 @@ public:
         {
             estimationOutput->setSimulationResults( simulationResultsPerIteration );
         }
+        setOutputMemoryFootprint( estimationOutput, estimationInput );
 
         return estimationOutput;
     }
@@ -1062,30 +1700,151 @@ public:
         return stateTransitionAndSensitivityMatrixInterface_;
     }
 
-protected:
-
-    //! Function called by either constructor to initialize the object.
+    //! Function to retrieve the (heap) memory held by the objects used in the estimation, per subsystem
     /*!
-     *  Function called by either constructor to initialize the object.
-     *  \param bodies Map of body objects with names of bodies, storing all environment models used in simulation.
-     *  \param observationSettingsMap Sets of observation model settings per link ends (i.e. transmitter, receiver, etc.)
-     *  for which measurement data is to be provided in orbit determination process
-     *  (through estimateParameters function)
-     *  \param integratorSettings Settings for numerical integrator.
-     *  \param propagatorSettings Settings for propagator.
-     *  \param propagateOnCreation Boolean denoting whether initial propagatoon is to be performed upon object creation (default
-     *  true)
+     *  Function to retrieve the (heap) memory held by the objects used in the estimation, per subsystem: the environment
+     *  models of the bodies (prefix "bodies"), the observations (prefix "observations", if provided), the current
+     *  propagation results of the dynamics and variational equations (prefix "propagation_results") and the state
+     *  transition and sensitivity matrix interface (prefix "state_transition_interface"). The design matrix and covariance
+     *  matrices are added to the footprint stored in the output of estimateParameters and computeCovariance.
+     *  \param observationCollection Observations used in the estimation (ignored if nullptr)
+     *  \return Memory held by the objects used in the estimation
      */
-    void initializeOrbitDeterminationManager(
-            const SystemOfBodies &bodies,
-            const std::vector< std::shared_ptr< observation_models::ObservationModelSettings > >& observationSettingsList,
-            const std::shared_ptr< propagators::PropagatorSettings< ObservationScalarType > > propagatorSettings,
-            const bool propagateOnCreation = true )
+    utilities::MemoryFootprint getMemoryFootprint(
+            const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > >
+            observationCollection = nullptr )
     {
-        propagators::toggleIntegratedResultSettings< ObservationScalarType, TimeType >( propagatorSettings );
-        using namespace numerical_integrators;
-        using namespace orbit_determination;
-        using namespace observation_models;
+        utilities::MemoryFootprint memoryFootprint;
+        memoryFootprint.addFootprint( bodies_.getMemoryFootprint( ), "bodies" );
+        if( observationCollection != nullptr )
+        {
+            memoryFootprint.addFootprint( observationCollection->getMemoryFootprint( ), "observations" );
+        }
+        if( variationalEquationsSolver_ != nullptr &&
+                variationalEquationsSolver_->getVariationalPropagationResults( ) != nullptr )
+        {
+            memoryFootprint.addFootprint( variationalEquationsSolver_->getVariationalPropagationResults( )->getMemoryFootprint( ),
+                                          "propagation_results" );
+        }
+        if( stateTransitionAndSensitivityMatrixInterface_ != nullptr )
+        {
+            memoryFootprint.addFootprint( stateTransitionAndSensitivityMatrixInterface_->getMemoryFootprint( ),
+                                          "state_transition_interface" );
+        }
+        return memoryFootprint;
+    }
+
+    //! Function to set the number of threads over which the design matrix and residuals are computed
+    /*!
+     *  Function to set the number of threads over which the design matrix and residuals are computed (default 1). When
+     *  using more than one thread, the observation sets are divided into groups such that no two groups share any
+     *  observation model, light-time calculator or observation partial objects. Two sets are put in the same group if they
+     *  have the same observable type and link ends, or if their link ends have any pair of link end ids in common (which
+     *  is a precondition for sharing a light-time calculator). The groups are distributed over the threads (balancing
+     *  the number of observations per thread), and each thread processes the sets of its groups in their original order.
+     *  Since each set writes only its own rows of the design matrix and residuals, and the objects of each group are
+     *  called in the same order as in the serial case, the output is identical to that of a single thread. The environment
+     *  models (ephemerides, rotation models, ground station states) and the state transition/sensitivity matrix
+     *  interface are shared by all threads, and are evaluated concurrently; this is supported by the models as created
+     *  by the environment setup, but not necessarily for custom models that store intermediate results.
+     *  \param numberOfThreads Number of threads that is to be used (1 for serial computation)
+     */
+    void setNumberOfDesignMatrixThreads( const int numberOfThreads )
+    {
+        if( numberOfThreads < 1 )
+        {
+            throw std::runtime_error( "Error when setting number of design matrix threads, number must be positive" );
+        }
+        numberOfDesignMatrixThreads_ = numberOfThreads;
+    }
+
+    //! Function to retrieve the number of threads over which the design matrix and residuals are computed
+    int getNumberOfDesignMatrixThreads( )
+    {
+        return numberOfDesignMatrixThreads_;
+    }
+
+    //! Function to set whether the observations of all sets are processed in order of observation time
+    /*!
+     *  Function to set whether the observations and partials of all observation sets are computed in order of observation
+     *  time (default false). By default, the sets are processed one after the other (ordered by observable type, link ends
+     *  and index of the set), so that each set sweeps the full time span, and the interpolators of the state
+     *  transition/sensitivity matrices and of the environment models jump back and forth in time for each set. When
+     *  enabled, the epochs of all sets (per thread, see setNumberOfDesignMatrixThreads) are merged and sorted by time, and
+     *  the observations are computed in segments of consecutive epochs of a single set in this ordering (see
+     *  getObservationSegmentsToProcess). The results are set in the same rows of the design matrix and residuals as for the
+     *  default ordering, so that these are identical. When accumulating normal equations, the contributions are added in a
+     *  different order, so that these differ by rounding errors only. Since each segment requires a separate call to the
+     *  observation manager, this is beneficial mainly for sets with interleaved observation times, in combination with the
+     *  caching of light-time solutions and state transition matrices per epoch.
+     *  \param useTimeOrderedProcessing Boolean denoting whether observations are processed in order of observation time
+     */
+    void setTimeOrderedObservationProcessing( const bool useTimeOrderedProcessing )
+    {
+        useTimeOrderedObservationProcessing_ = useTimeOrderedProcessing;
+    }
+
+    //! Function to retrieve whether the observations of all sets are processed in order of observation time
+    bool getTimeOrderedObservationProcessing( )
+    {
+        return useTimeOrderedObservationProcessing_;
+    }
+
+    //! Function to set the object used to distribute a multi-arc estimation over a group of processes
+    /*!
+     *  Function to set the object used to distribute a multi-arc estimation over a group of processes (e.g. the MPI
+     *  processes created by utilities::createMpiProcessCommunicator), which is only supported in combination with arc-local
+     *  parameter reduction (see EstimationInput). Each process must create this object with identical settings and call
+     *  estimateParameters with identical input. The arcs are divided over the processes in contiguous ranges (see
+     *  utilities::getProcessItemRange), and each process computes the partials and normal equations of only the observation
+     *  sets in its own arcs (an exception is thrown if a set spans the arcs of more than one process), and eliminates the
+     *  local parameters of these arcs. Only the global normal equations, the arc reductions of these equations, the residuals
+     *  and the parameter adjustment are communicated, so that the estimation output is identical on all processes. Note that
+     *  the dynamics of all arcs are still propagated by each process.
+     *  \param processCommunicator Object used for the communication between the processes (nullptr to disable distribution)
+     */
+    void setProcessCommunicator( const std::shared_ptr< utilities::ProcessCommunicator > processCommunicator )
+    {
+        processCommunicator_ = processCommunicator;
+    }
+
+    //! Function to retrieve the object used to distribute a multi-arc estimation over a group of processes
+    std::shared_ptr< utilities::ProcessCommunicator > getProcessCommunicator( )
+    {
+        return processCommunicator_;
+    }
+
+protected:
+
+    //! Function called by either constructor to initialize the object.
+    /*!
+     *  Function called by either constructor to initialize the object.
+     *  \param bodies Map of body objects with names of bodies, storing all environment models used in simulation.
+     *  \param observationSettingsMap Sets of observation model settings per link ends (i.e. transmitter, receiver, etc.)
+     *  for which measurement data is to be provided in orbit determination process
+     *  (through estimateParameters function)
+     *  \param integratorSettings Settings for numerical integrator.
+     *  \param propagatorSettings Settings for propagator.
+     *  \param propagateOnCreation Boolean denoting whether initial propagatoon is to be performed upon object creation (default
+     *  true)
+     *  \param arcWiseBodies List of bodies that are to be used for the propagation of each arc, for multi- and hybrid-arc dynamics
+     *  only (see MultiArcVariationalEquationsSolver and HybridArcVariationalEquationsSolver; empty by default, in which case
+     *  bodies is used for all arcs)
+     */
+    void initializeOrbitDeterminationManager(
+            const SystemOfBodies &bodies,
+            const std::vector< std::shared_ptr< observation_models::ObservationModelSettings > >& observationSettingsList,
+            const std::shared_ptr< propagators::PropagatorSettings< ObservationScalarType > > propagatorSettings,
+            const bool propagateOnCreation = true,
+            const std::vector< SystemOfBodies >& arcWiseBodies = std::vector< SystemOfBodies >( ) )
+    {
+        propagators::toggleIntegratedResultSettings< ObservationScalarType, TimeType >( propagatorSettings );
+        using namespace numerical_integrators;
+        using namespace orbit_determination;
+        using namespace observation_models;
+
+        numberOfDesignMatrixThreads_ = 1;
+        useTimeOrderedObservationProcessing_ = false;
 
         // Detect whether consider parameters are included
         considerParametersIncluded_ = false;
@@ -1123,7 +1882,7 @@ protected:
         if( integrateAndEstimateOrbit_ )
         {
             variationalEquationsSolver_ = simulation_setup::createVariationalEquationsSolver< ObservationScalarType, TimeType >(
-                    bodies, propagatorSettings, fullParameters_, propagateOnCreation );
+                    bodies, propagatorSettings, fullParameters_, propagateOnCreation, arcWiseBodies );
         }
 
         if( integrateAndEstimateOrbit_ )
@@ -1150,6 +1909,10 @@ protected:
         // Iterate over all observables and create observation managers.
         std::map< ObservableType, std::vector< std::shared_ptr< ObservationModelSettings > > > sortedObservationSettingsList =
                 sortObservationModelSettingsByType( observationSettingsList );
+        std::shared_ptr< LightTimeCalculatorRegistry< ObservationScalarType, TimeType > > lightTimeCalculatorRegistry =
+                std::make_shared< LightTimeCalculatorRegistry< ObservationScalarType, TimeType > >( );
+        oneWayRangePartialRegistry_ =
+                std::make_shared< observation_partials::OneWayRangePartialRegistry< ObservationScalarType, TimeType > >( );
         for( auto it : sortedObservationSettingsList )
         {
             // Call createObservationSimulator of required observation size
@@ -1161,9 +1924,20 @@ protected:
                         observableType,
                         it.second,
                         bodies, fullParameters_ /*parametersToEstimate_*/,
-                        stateTransitionAndSensitivityMatrixInterface_, dependentVariablesInterface_ );
+                        stateTransitionAndSensitivityMatrixInterface_, dependentVariablesInterface_,
+                        lightTimeCalculatorRegistry, oneWayRangePartialRegistry_ );
+        }
+
+        // Set light-time calculators that are shared between observables
+        for( auto it : observationManagers_ )
+        {
+            it.second->getObservationSimulator( )->setSharedLightTimeCalculators(
+                        lightTimeCalculatorRegistry->getLightTimeCalculators( ) );
         }
 
+        // Determine which blocks of the design matrix are structurally non-zero
+        createDesignMatrixSparsity( );
+
         // Set current parameter estimate from body initial states and parameter set.
         currentParameterEstimate_ = parametersToEstimate_->template getFullParameterValues< ObservationScalarType >( );
         currentFullParameterValues_ = fullParameters_->template getFullParameterValues< ObservationScalarType >( );
@@ -1178,6 +1952,798 @@ protected:
 
     }
 
+    //! Function to determine the structural sparsity of the design matrix (see getDesignMatrixSparsity)
+    void createDesignMatrixSparsity( )
+    {
+        // Determine which columns are associated with observation link properties
+        std::vector< bool > isObservationLinkPropertyColumn( totalNumberParameters_, false );
+        std::map< int, std::shared_ptr< estimatable_parameters::EstimatableParameter< double > > > doubleParameters =
+                fullParameters_->getDoubleParameters( );
+        for( auto parameterIterator : doubleParameters )
+        {
+            if( estimatable_parameters::isParameterObservationLinkProperty( parameterIterator.second->getParameterName( ).first ) )
+            {
+                isObservationLinkPropertyColumn[ parameterIterator.first ] = true;
+            }
+        }
+        std::map< int, std::shared_ptr< estimatable_parameters::EstimatableParameter< Eigen::VectorXd > > > vectorParameters =
+                fullParameters_->getVectorParameters( );
+        for( auto parameterIterator : vectorParameters )
+        {
+            if( estimatable_parameters::isParameterObservationLinkProperty( parameterIterator.second->getParameterName( ).first ) )
+            {
+                for( int i = 0; i < parameterIterator.second->getParameterSize( ); i++ )
+                {
+                    isObservationLinkPropertyColumn[ parameterIterator.first + i ] = true;
+                }
+            }
+        }
+
+        nonLinkPropertyDesignMatrixColumns_.clear( );
+        for( unsigned int i = 0; i < totalNumberParameters_; i++ )
+        {
+            if( !isObservationLinkPropertyColumn.at( i ) )
+            {
+                nonLinkPropertyDesignMatrixColumns_.push_back( i );
+            }
+        }
+
+        // Add columns of observation link properties for which partials exist, per observable type and link ends
+        designMatrixSparsity_.clear( );
+        for( auto managerIterator : observationManagers_ )
+        {
+            std::map< observation_models::LinkEnds, std::vector< std::pair< int, int > > > partialParameterIndices =
+                    managerIterator.second->getPartialParameterIndices( );
+            for( auto linkEndIterator : partialParameterIndices )
+            {
+                std::vector< bool > isNonZeroColumn( totalNumberParameters_ );
+                for( unsigned int i = 0; i < totalNumberParameters_; i++ )
+                {
+                    isNonZeroColumn[ i ] = !isObservationLinkPropertyColumn.at( i );
+                }
+                for( unsigned int i = 0; i < linkEndIterator.second.size( ); i++ )
+                {
+                    for( int j = 0; j < linkEndIterator.second.at( i ).second; j++ )
+                    {
+                        isNonZeroColumn[ linkEndIterator.second.at( i ).first + j ] = true;
+                    }
+                }
+
+                std::vector< int >& currentNonZeroColumns = designMatrixSparsity_[ managerIterator.first ][ linkEndIterator.first ];
+                for( unsigned int i = 0; i < totalNumberParameters_; i++ )
+                {
+                    if( isNonZeroColumn.at( i ) )
+                    {
+                        currentNonZeroColumns.push_back( i );
+                    }
+                }
+            }
+        }
+    }
+
+    //! Function to retrieve the indices of the possibly non-zero columns of the design matrix for given observables
+    /*!
+     *  Function to retrieve the indices of the possibly non-zero columns of the design matrix for given observable type and
+     *  link ends (see getDesignMatrixSparsity)
+     *  \param observableType Observable type of the observations
+     *  \param linkEnds Link ends of the observations
+     *  \return Indices of the possibly non-zero columns of the design matrix
+     */
+    const std::vector< int >& getNonZeroDesignMatrixColumns(
+            const observation_models::ObservableType observableType,
+            const observation_models::LinkEnds& linkEnds ) const
+    {
+        auto observableIterator = designMatrixSparsity_.find( observableType );
+        if( observableIterator != designMatrixSparsity_.end( ) )
+        {
+            auto linkEndIterator = observableIterator->second.find( linkEnds );
+            if( linkEndIterator != observableIterator->second.end( ) )
+            {
+                return linkEndIterator->second;
+            }
+        }
+        return nonLinkPropertyDesignMatrixColumns_;
+    }
+
+    //! Function to compute the residuals and partials of a segment of an observation set, and set them in the full vector/matrix
+    /*!
+     *  Function to compute the residuals and partials of a segment of consecutive epochs of a single observation set, and
+     *  set them in the rows of the full residual vector and design matrix that are associated with these epochs.
+     *  \param observationsCollection Full set of observations
+     *  \param observationSet Observable type, link ends and index of the set (in list of sets with given observable type and
+     *  link ends)
+     *  \param firstEpochIndex Index (in the set) of the first epoch of the segment
+     *  \param numberOfEpochs Number of epochs in the segment
+     *  \param designMatrix Full design matrix, to which partials of current segment are added (returned by reference)
+     *  \param residuals Full residual vector, to which residuals of current segment are added (returned by reference)
+     *  \param calculateResiduals Boolean denoting whether residuals are to be computed
+     */
+    void calculateObservationSegmentDesignMatrixAndResiduals(
+            const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
+            const std::tuple< observation_models::ObservableType, observation_models::LinkEnds, int >& observationSet,
+            const int firstEpochIndex,
+            const int numberOfEpochs,
+            Eigen::MatrixXd& designMatrix,
+            Eigen::VectorXd& residuals,
+            const bool calculateResiduals )
+    {
+        const observation_models::ObservableType observableType = std::get< 0 >( observationSet );
+        const observation_models::LinkEnds& linkEnds = std::get< 1 >( observationSet );
+        std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > currentObservations =
+                observationsCollection->getObservations( ).at( observableType ).at( linkEnds ).at( std::get< 2 >( observationSet ) );
+        const int singleObservableSize = currentObservations->getSingleObservableSize( );
+        const int currentStartIndex = observationsCollection->getObservationSetStartAndSize( ).at(
+                    observableType ).at( linkEnds ).at( std::get< 2 >( observationSet ) ).first +
+                firstEpochIndex * singleObservableSize;
+        const int currentSize = numberOfEpochs * singleObservableSize;
+
+        // Compute estimated ranges and range partials from current parameter estimate.
+        const std::vector< TimeType >& observationTimes = currentObservations->getObservationTimes( );
+        std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials;
+        {
+            TUDAT_TRACE_SCOPE( "observation_partials", "estimation" );
+            observationsWithPartials = observationManagers_.at( observableType )->computeObservationsWithPartials(
+                        ( numberOfEpochs == static_cast< int >( observationTimes.size( ) ) ) ? observationTimes :
+                            std::vector< TimeType >( observationTimes.begin( ) + firstEpochIndex,
+                                                     observationTimes.begin( ) + firstEpochIndex + numberOfEpochs ),
+                        linkEnds, currentObservations->getReferenceLinkEnd( ),
+                        currentObservations->getAncilliarySettings( ) );
+        }
+
+        // Compute residuals for current link ends and observabel type.
+        if( calculateResiduals )
+        {
+            residuals.segment( currentStartIndex, currentSize ) =
+                    ( currentObservations->getObservationsVector( ).segment(
+                          firstEpochIndex * singleObservableSize, currentSize ) -
+                      observationsWithPartials.first ).template cast< double >( );
+        }
+
+        // Set current observation partials in matrix of all partials (zero blocks are skipped, matrix is initialized to zero)
+        const std::vector< int >& nonZeroColumns = getNonZeroDesignMatrixColumns( observableType, linkEnds );
+        designMatrix( Eigen::seqN( currentStartIndex, currentSize ), nonZeroColumns ) =
+                observationsWithPartials.second( Eigen::all, nonZeroColumns );
+    }
+
+    //! Function to add the normal equations of a segment of an observation set, and compute its residuals
+    /*!
+     *  Function to add the normal equations of a segment of consecutive epochs of a single observation set, and compute its
+     *  residuals (see calculateNormalEquationsAndResiduals).
+     *  \param observationsCollection Full set of observations
+     *  \param observationSet Observable type, link ends and index of the set (in list of sets with given observable type and
+     *  link ends)
+     *  \param firstEpochIndex Index (in the set) of the first epoch of the segment
+     *  \param numberOfEpochs Number of epochs in the segment
+     *  \param weightsMatrixDiagonals Diagonal of the observation weights matrix (same order as observations)
+     *  \param normalEquations Normal equations, to which the contribution of the segment is added (returned by reference)
+     *  \param residuals Full residual vector, to which residuals of current segment are added (returned by reference)
+     *  \param calculateResiduals Boolean denoting whether residuals are to be computed
+     */
+    template< typename NormalEquationsType >
+    void calculateObservationSegmentNormalEquationsAndResiduals(
+            const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
+            const std::tuple< observation_models::ObservableType, observation_models::LinkEnds, int >& observationSet,
+            const int firstEpochIndex,
+            const int numberOfEpochs,
+            const Eigen::VectorXd& weightsMatrixDiagonals,
+            NormalEquationsType& normalEquations,
+            Eigen::VectorXd& residuals,
+            const bool calculateResiduals )
+    {
+        const observation_models::ObservableType observableType = std::get< 0 >( observationSet );
+        const observation_models::LinkEnds& linkEnds = std::get< 1 >( observationSet );
+        std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > currentObservations =
+                observationsCollection->getObservations( ).at( observableType ).at( linkEnds ).at( std::get< 2 >( observationSet ) );
+        const int singleObservableSize = currentObservations->getSingleObservableSize( );
+        const int currentStartIndex = observationsCollection->getObservationSetStartAndSize( ).at(
+                    observableType ).at( linkEnds ).at( std::get< 2 >( observationSet ) ).first +
+                firstEpochIndex * singleObservableSize;
+        const int currentBlockSize = numberOfEpochs * singleObservableSize;
+
+        // Compute observations and partials for current block of epochs
+        const std::vector< TimeType >& observationTimes = currentObservations->getObservationTimes( );
+        std::vector< TimeType > currentTimes(
+                    observationTimes.begin( ) + firstEpochIndex, observationTimes.begin( ) + firstEpochIndex + numberOfEpochs );
+        std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials;
+        {
+            TUDAT_TRACE_SCOPE( "observation_partials", "estimation" );
+            observationsWithPartials = observationManagers_.at( observableType )->computeObservationsWithPartials(
+                        currentTimes, linkEnds, currentObservations->getReferenceLinkEnd( ),
+                        currentObservations->getAncilliarySettings( ) );
+        }
+
+        if( calculateResiduals )
+        {
+            residuals.segment( currentStartIndex, currentBlockSize ) =
+                    ( currentObservations->getObservationsVector( ).segment(
+                          firstEpochIndex * singleObservableSize, currentBlockSize ) -
+                      observationsWithPartials.first ).template cast< double >( );
+        }
+
+        // Add block to normal equations
+        normalEquations.addObservations(
+                    observationsWithPartials.second, residuals.segment( currentStartIndex, currentBlockSize ),
+                    weightsMatrixDiagonals.segment( currentStartIndex, currentBlockSize ),
+                    getNonZeroDesignMatrixColumns( observableType, linkEnds ) );
+    }
+
+    //! Function to divide a list of observation sets into the segments of consecutive epochs in which they are processed
+    /*!
+     *  Function to divide a list of observation sets into the segments of consecutive epochs in which their observations
+     *  and partials are computed. By default, the sets are processed one after the other, each in blocks of at most
+     *  maximumNumberOfObservationsPerBlock observations. When using time-ordered processing (see
+     *  setTimeOrderedObservationProcessing), the epochs of all sets are merged and sorted by observation time (epochs with
+     *  equal time in the order of the sets), and each segment is a run of consecutive epochs of a single set in this
+     *  ordering, of at most maximumNumberOfObservationsPerBlock observations.
+     *  \param observationsCollection Full set of observations
+     *  \param observationSets List of observation sets (observable type, link ends and index of set)
+     *  \param setIndices Indices (in observationSets) of the sets that are to be processed
+     *  \param maximumNumberOfObservationsPerBlock Maximum number of observations in a segment (at least one epoch is always
+     *  included)
+     *  \return Segments in order of processing, each defined by the index of the set in observationSets, the index of the
+     *  first epoch in the set and the number of epochs
+     */
+    std::vector< std::tuple< int, int, int > > getObservationSegmentsToProcess(
+            const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
+            const std::vector< std::tuple< observation_models::ObservableType, observation_models::LinkEnds, int > >& observationSets,
+            const std::vector< int >& setIndices,
+            const int maximumNumberOfObservationsPerBlock )
+    {
+        // Retrieve observation times and maximum number of epochs per segment of each set
+        std::vector< const std::vector< TimeType >* > setObservationTimes;
+        std::vector< int > maximumNumberOfEpochsPerBlock;
+        for( unsigned int i = 0; i < setIndices.size( ); i++ )
+        {
+            const std::tuple< observation_models::ObservableType, observation_models::LinkEnds, int >& currentSet =
+                    observationSets.at( setIndices.at( i ) );
+            std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > currentObservations =
+                    observationsCollection->getObservations( ).at( std::get< 0 >( currentSet ) ).at(
+                        std::get< 1 >( currentSet ) ).at( std::get< 2 >( currentSet ) );
+            setObservationTimes.push_back( &currentObservations->getObservationTimes( ) );
+            maximumNumberOfEpochsPerBlock.push_back(
+                        std::max( maximumNumberOfObservationsPerBlock / currentObservations->getSingleObservableSize( ), 1 ) );
+        }
+
+        std::vector< std::tuple< int, int, int > > observationSegments;
+        if( !useTimeOrderedObservationProcessing_ )
+        {
+            for( unsigned int i = 0; i < setIndices.size( ); i++ )
+            {
+                const int numberOfEpochs = setObservationTimes.at( i )->size( );
+                for( int blockStart = 0; blockStart < numberOfEpochs; blockStart += maximumNumberOfEpochsPerBlock.at( i ) )
+                {
+                    observationSegments.push_back(
+                                std::make_tuple( setIndices.at( i ), blockStart,
+                                                 std::min( maximumNumberOfEpochsPerBlock.at( i ), numberOfEpochs - blockStart ) ) );
+                }
+            }
+        }
+        else
+        {
+            // Sort epochs of all sets by time (as index in setIndices and index of epoch in set)
+            std::vector< std::pair< int, int > > sortedEpochs;
+            for( unsigned int i = 0; i < setIndices.size( ); i++ )
+            {
+                for( unsigned int j = 0; j < setObservationTimes.at( i )->size( ); j++ )
+                {
+                    sortedEpochs.push_back( std::make_pair( i, j ) );
+                }
+            }
+            std::stable_sort( sortedEpochs.begin( ), sortedEpochs.end( ),
+                              [ & ]( const std::pair< int, int >& firstEpoch, const std::pair< int, int >& secondEpoch )
+            {
+                return setObservationTimes[ firstEpoch.first ]->at( firstEpoch.second ) <
+                        setObservationTimes[ secondEpoch.first ]->at( secondEpoch.second );
+            } );
+
+            // Merge runs of consecutive epochs of the same set into segments
+            for( unsigned int i = 0; i < sortedEpochs.size( ); i++ )
+            {
+                const int currentSet = sortedEpochs.at( i ).first;
+                if( observationSegments.size( ) > 0 && i > 0 && sortedEpochs.at( i - 1 ).first == currentSet &&
+                        sortedEpochs.at( i - 1 ).second + 1 == sortedEpochs.at( i ).second &&
+                        std::get< 2 >( observationSegments.back( ) ) < maximumNumberOfEpochsPerBlock.at( currentSet ) )
+                {
+                    std::get< 2 >( observationSegments.back( ) )++;
+                }
+                else
+                {
+                    observationSegments.push_back(
+                                std::make_tuple( setIndices.at( currentSet ), sortedEpochs.at( i ).second, 1 ) );
+                }
+            }
+        }
+        return observationSegments;
+    }
+
+    //! Function to set the memory footprint of the objects used in the estimation, and of the output, in the output object
+    template< typename OutputType >
+    void setOutputMemoryFootprint(
+            const std::shared_ptr< OutputType > output,
+            const std::shared_ptr< CovarianceAnalysisInput< ObservationScalarType, TimeType > > estimationInput )
+    {
+        output->memoryFootprint_ = getMemoryFootprint( estimationInput->getObservationCollection( ) );
+        output->memoryFootprint_.addFootprint( output->getOutputMemoryFootprint( ), "estimation_output" );
+    }
+
+    //! Function to reset dense normal equations to zero, for the full parameter vector
+    void resetNormalEquations( linear_algebra::NormalEquationsAccumulator& normalEquations )
+    {
+        normalEquations = linear_algebra::NormalEquationsAccumulator( totalNumberParameters_ );
+    }
+
+    //! Function to reset block-structured normal equations to zero, for the full parameter vector and current arc-local parameters
+    void resetNormalEquations( linear_algebra::ArcWiseNormalEquationsAccumulator& normalEquations )
+    {
+        normalEquations = linear_algebra::ArcWiseNormalEquationsAccumulator( totalNumberParameters_, arcLocalParameterIndices_ );
+    }
+
+    //! Function to check whether dense normal equations are distributed over processes (never the case)
+    bool isDistributedOverProcesses( const linear_algebra::NormalEquationsAccumulator& )
+    {
+        return false;
+    }
+
+    //! Function to check whether block-structured normal equations are distributed over processes
+    bool isDistributedOverProcesses( const linear_algebra::ArcWiseNormalEquationsAccumulator& )
+    {
+        return processCommunicator_ != nullptr;
+    }
+
+    //! Function to combine dense normal equations over processes (not supported, see isDistributedOverProcesses)
+    void reduceNormalEquationsOverProcesses( linear_algebra::NormalEquationsAccumulator& )
+    {
+        throw std::runtime_error( "Error, dense normal equations cannot be distributed over processes" );
+    }
+
+    //! Function to combine block-structured normal equations over processes
+    void reduceNormalEquationsOverProcesses( linear_algebra::ArcWiseNormalEquationsAccumulator& normalEquations )
+    {
+        normalEquations.reduceOverProcesses( processCommunicator_ );
+    }
+
+    //! Function to determine the arcs in which the first and last observation of an observation set lie
+    /*!
+     *  Function to determine the arcs in which the first and last observation of an observation set lie (observations
+     *  before the first arc are assigned to the first arc).
+     *  \param observationsCollection Full set of observations
+     *  \param observableType Observable type of the observation set
+     *  \param linkEnds Link ends of the observation set
+     *  \param setIndex Index of the observation set for the given observable type and link ends
+     *  \param arcStartTimes Start times of the arcs
+     *  \return Indices of the arcs of the first and last observation (-1 for both if the set is empty)
+     */
+    std::pair< int, int > getObservationSetArcRange(
+            const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
+            const observation_models::ObservableType observableType,
+            const observation_models::LinkEnds& linkEnds,
+            const int setIndex,
+            const std::vector< double >& arcStartTimes )
+    {
+        const std::vector< TimeType >& observationTimes = observationsCollection->getObservations( ).at(
+                    observableType ).at( linkEnds ).at( setIndex )->getObservationTimes( );
+        if( observationTimes.size( ) == 0 )
+        {
+            return std::make_pair( -1, -1 );
+        }
+
+        auto getArcIndex = [ & ]( const TimeType time )
+        {
+            int arcIndex = static_cast< int >( std::upper_bound(
+                        arcStartTimes.begin( ), arcStartTimes.end( ), static_cast< double >( time ) ) - arcStartTimes.begin( ) ) - 1;
+            return std::max( arcIndex, 0 );
+        };
+        return std::make_pair( getArcIndex( *std::min_element( observationTimes.begin( ), observationTimes.end( ) ) ),
+                               getArcIndex( *std::max_element( observationTimes.begin( ), observationTimes.end( ) ) ) );
+    }
+
+    //! Function to check whether an observation set lies in the arcs assigned to the current process
+    /*!
+     *  Function to check whether an observation set lies in the arcs assigned to the current process (see
+     *  setProcessCommunicator), based on the arcs of the dynamics in which its first and last observation times lie
+     *  (see getObservationSetArcRange).
+     *  \param observationsCollection Full set of observations
+     *  \param observableType Observable type of the observation set
+     *  \param linkEnds Link ends of the observation set
+     *  \param setIndex Index of the observation set for the given observable type and link ends
+     *  \return True if the observation set is assigned to the current process
+     */
+    bool isObservationSetOfCurrentProcess(
+            const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
+            const observation_models::ObservableType observableType,
+            const observation_models::LinkEnds& linkEnds,
+            const int setIndex )
+    {
+        std::pair< int, int > processArcRange = utilities::getProcessItemRange(
+                    arcLocalParameterIndices_.size( ), processCommunicator_->getProcessIndex( ), processCommunicator_->getNumberOfProcesses( ) );
+
+        std::pair< int, int > observationArcRange = getObservationSetArcRange(
+                    observationsCollection, observableType, linkEnds, setIndex, arcStartTimes_ );
+        if( observationArcRange.first < 0 )
+        {
+            return processCommunicator_->isRootProcess( );
+        }
+        int firstArc = observationArcRange.first;
+        int lastArc = observationArcRange.second;
+
+        bool firstArcOfCurrentProcess = ( firstArc >= processArcRange.first && firstArc < processArcRange.second );
+        bool lastArcOfCurrentProcess = ( lastArc >= processArcRange.first && lastArc < processArcRange.second );
+        if( firstArcOfCurrentProcess != lastArcOfCurrentProcess )
+        {
+            throw std::runtime_error( "Error when distributing observations over processes, observation set spans arcs " +
+                                      std::to_string( firstArc ) + " to " + std::to_string( lastArc ) +
+                                      ", which are assigned to different processes" );
+        }
+        return firstArcOfCurrentProcess;
+    }
+
+    //! Function to determine the index in the full parameter vector of each entry of the estimated parameter vector
+    std::vector< int > getEstimatedParameterIndicesInFullParameterVector( )
+    {
+        std::vector< int > estimatedParameterIndices( numberEstimatedParameters_ );
+        for( unsigned int i = 0; i < indicesAndSizeEstimatedParameters_.size( ); i++ )
+        {
+            for( int j = 0; j < indicesAndSizeEstimatedParameters_[ i ].second; j++ )
+            {
+                estimatedParameterIndices[ indicesAndSizeEstimatedParameters_[ i ].first.first + j ] =
+                        indicesAndSizeEstimatedParameters_[ i ].first.second + j;
+            }
+        }
+        return estimatedParameterIndices;
+    }
+
+    //! Function to set the entries of the full parameter vector for which no observation partials are to be computed
+    /*!
+     *  Function to set the entries of the full parameter vector for which no observation partials are to be computed, for
+     *  all observation managers (see ObservationManagerBase::setSkippedPartialParameterIndices)
+     *  \param parameterIndices Indices in full parameter vector for which no partials are computed (empty for all partials)
+     */
+    void setSkippedPartialParameterIndices( const std::vector< int >& parameterIndices )
+    {
+        for( auto managerIterator : observationManagers_ )
+        {
+            managerIterator.second->setSkippedPartialParameterIndices( parameterIndices );
+        }
+    }
+
+    //! Function to extract the normalized normal equations of the estimated and consider parameters
+    /*!
+     *  Function to extract the normalized normal equations of the estimated and consider parameters from the normal
+     *  equations w.r.t. the full parameter vector. The normalization is identical to that applied to the design matrix
+     *  when it is fully stored (see normalizeDesignMatrix).
+     *  \param normalEquations Normal equations w.r.t. the full parameter vector
+     *  \param normalizationTerms Normalization terms of the estimated parameters (returned by reference)
+     *  \param considerNormalizationTerms Normalization terms of the consider parameters (returned by reference)
+     *  \param normalizedNormalMatrix Normalized normal matrix of the estimated parameters (returned by reference)
+     *  \param normalizedRightHandSide Normalized right-hand side of the estimated parameters (returned by reference)
+     *  \param normalizedConsiderNormalMatrix Normalized normal matrix between the estimated and consider parameters
+     *  (returned by reference)
+     */
+    void getNormalizedNormalEquations(
+            const linear_algebra::NormalEquationsAccumulator& normalEquations,
+            Eigen::VectorXd& normalizationTerms,
+            Eigen::VectorXd& considerNormalizationTerms,
+            Eigen::MatrixXd& normalizedNormalMatrix,
+            Eigen::VectorXd& normalizedRightHandSide,
+            Eigen::MatrixXd& normalizedConsiderNormalMatrix )
+    {
+        // Determine index in full parameter vector of each estimated and consider parameter entry
+        std::vector< int > estimatedParameterIndices = getEstimatedParameterIndicesInFullParameterVector( );
+        std::vector< int > considerParameterIndices( numberConsiderParameters_ );
+        for( unsigned int i = 0; i < indicesAndSizeConsiderParameters_.size( ); i++ )
+        {
+            for( int j = 0; j < indicesAndSizeConsiderParameters_[ i ].second; j++ )
+            {
+                considerParameterIndices[ indicesAndSizeConsiderParameters_[ i ].first.first + j ] =
+                        indicesAndSizeConsiderParameters_[ i ].first.second + j;
+            }
+        }
+
+        Eigen::VectorXd fullNormalizationTerms = normalEquations.getNormalizationTerms( );
+        const Eigen::MatrixXd& normalMatrix = normalEquations.getNormalMatrix( );
+        const Eigen::VectorXd& rightHandSide = normalEquations.getRightHandSide( );
+
+        normalizationTerms = Eigen::VectorXd::Zero( numberEstimatedParameters_ );
+        normalizedNormalMatrix = Eigen::MatrixXd::Zero( numberEstimatedParameters_, numberEstimatedParameters_ );
+        normalizedRightHandSide = Eigen::VectorXd::Zero( numberEstimatedParameters_ );
+        for( unsigned int i = 0; i < numberEstimatedParameters_; i++ )
+        {
+            normalizationTerms( i ) = fullNormalizationTerms( estimatedParameterIndices[ i ] );
+        }
+        for( unsigned int i = 0; i < numberEstimatedParameters_; i++ )
+        {
+            normalizedRightHandSide( i ) = rightHandSide( estimatedParameterIndices[ i ] ) / normalizationTerms( i );
+            for( unsigned int j = 0; j < numberEstimatedParameters_; j++ )
+            {
+                normalizedNormalMatrix( i, j ) = normalMatrix( estimatedParameterIndices[ i ], estimatedParameterIndices[ j ] ) /
+                        ( normalizationTerms( i ) * normalizationTerms( j ) );
+            }
+        }
+
+        considerNormalizationTerms = Eigen::VectorXd::Zero( numberConsiderParameters_ );
+        normalizedConsiderNormalMatrix = Eigen::MatrixXd::Zero( numberEstimatedParameters_, numberConsiderParameters_ );
+        for( unsigned int i = 0; i < numberConsiderParameters_; i++ )
+        {
+            considerNormalizationTerms( i ) = fullNormalizationTerms( considerParameterIndices[ i ] );
+        }
+        for( unsigned int i = 0; i < numberEstimatedParameters_; i++ )
+        {
+            for( unsigned int j = 0; j < numberConsiderParameters_; j++ )
+            {
+                normalizedConsiderNormalMatrix( i, j ) = normalMatrix( estimatedParameterIndices[ i ], considerParameterIndices[ j ] ) /
+                        ( normalizationTerms( i ) * considerNormalizationTerms( j ) );
+            }
+        }
+    }
+
+    //! Function to set whether light time solutions, shared link partials and state transition matrices are cached per epoch
+    /*!
+     *  Function to set whether the light time of each link is solved, the one-way range partials of links shared by
+     *  composite observables (see OneWayRangePartialRegistry) are computed, and the state transition matrix rows of each body
+     *  are interpolated, only once per epoch for all observables. Only to be enabled while the environment and propagated
+     *  dynamics are fixed.
+     *  \param useCaching Boolean denoting whether caching is to be used
+     */
+    void setObservationCaching( const bool useCaching )
+    {
+        observation_models::setLightTimeSolutionCaching( getObservationSimulators( ), useCaching );
+        oneWayRangePartialRegistry_->setPartialCaching( useCaching );
+        if( stateTransitionAndSensitivityMatrixInterface_ != nullptr )
+        {
+            stateTransitionAndSensitivityMatrixInterface_->setMatrixCaching( useCaching );
+        }
+    }
+
+    //! Function to retrieve all observation sets that are to be processed by the current process
+    /*!
+     *  Function to retrieve all observation sets that are to be processed by the current process, in the order of the
+     *  observation collection
+     *  \param observationsCollection Full set of observations
+     *  \param distributeOverProcesses Boolean denoting whether only the sets of the current process are retrieved (see
+     *  isObservationSetOfCurrentProcess)
+     *  \return List of observation sets (observable type, link ends and index of set)
+     */
+    std::vector< std::tuple< observation_models::ObservableType, observation_models::LinkEnds, int > > getObservationSetsToProcess(
+            const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
+            const bool distributeOverProcesses )
+    {
+        std::vector< std::tuple< observation_models::ObservableType, observation_models::LinkEnds, int > > observationSets;
+        for( auto observablesIterator : observationsCollection->getObservations( ) )
+        {
+            for( auto dataIterator : observablesIterator.second )
+            {
+                for( unsigned int i = 0; i < dataIterator.second.size( ); i++ )
+                {
+                    if( !distributeOverProcesses || isObservationSetOfCurrentProcess(
+                                observationsCollection, observablesIterator.first, dataIterator.first, i ) )
+                    {
+                        observationSets.push_back( std::make_tuple( observablesIterator.first, dataIterator.first, i ) );
+                    }
+                }
+            }
+        }
+        return observationSets;
+    }
+
+    //! Function to add the normal equations and residuals of a list of observation sets to the per-thread normal equations
+    /*!
+     *  Function to add the normal equations and residuals of a list of observation sets to the per-thread normal equations.
+     *  When using more than one thread, the sets are distributed over the threads (see
+     *  distributeObservationSetsOverThreads), each of which adds its normal equations to its own entry of
+     *  workerNormalEquations. The observations of each thread are processed in segments of consecutive epochs (see
+     *  getObservationSegmentsToProcess).
+     *  \param observationsCollection Full set of observations
+     *  \param observationSets List of observation sets (observable type, link ends and index of set) to process
+     *  \param weightsMatrixDiagonals Diagonal of the observation weights matrix (same order as observations)
+     *  \param maximumNumberOfObservationsPerBlock Maximum number of observations for which the partials are computed at once
+     *  \param workerNormalEquations Normal equations accumulated by each thread, one entry per thread (modified by reference)
+     *  \param residuals Residuals of computed w.r.t. input observable values (entries of processed sets modified by reference)
+     *  \param calculateResiduals Boolean denoting whether residuals are to be computed
+     */
+    template< typename NormalEquationsType >
+    void accumulateObservationSetsNormalEquations(
+            const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
+            const std::vector< std::tuple< observation_models::ObservableType, observation_models::LinkEnds, int > >& observationSets,
+            const Eigen::VectorXd& weightsMatrixDiagonals,
+            const int maximumNumberOfObservationsPerBlock,
+            std::vector< NormalEquationsType >& workerNormalEquations,
+            Eigen::VectorXd& residuals,
+            const bool calculateResiduals )
+    {
+        if( workerNormalEquations.size( ) > 1 )
+        {
+            // Determine groups of sets that share no observation model objects, and process each in a separate thread
+            std::vector< std::vector< int > > workerObservationSets = distributeObservationSetsOverThreads(
+                        observationsCollection, observationSets );
+            utilities::executeParallelTasks(
+                        workerObservationSets.size( ), [ & ]( const int workerIndex )
+            {
+                std::vector< std::tuple< int, int, int > > observationSegments = getObservationSegmentsToProcess(
+                            observationsCollection, observationSets, workerObservationSets.at( workerIndex ),
+                            maximumNumberOfObservationsPerBlock );
+                for( unsigned int j = 0; j < observationSegments.size( ); j++ )
+                {
+                    calculateObservationSegmentNormalEquationsAndResiduals(
+                                observationsCollection, observationSets.at( std::get< 0 >( observationSegments.at( j ) ) ),
+                                std::get< 1 >( observationSegments.at( j ) ), std::get< 2 >( observationSegments.at( j ) ),
+                                weightsMatrixDiagonals, workerNormalEquations.at( workerIndex ), residuals, calculateResiduals );
+                }
+            }, workerNormalEquations.size( ) );
+        }
+        else
+        {
+            std::vector< int > allObservationSets( observationSets.size( ) );
+            std::iota( allObservationSets.begin( ), allObservationSets.end( ), 0 );
+            std::vector< std::tuple< int, int, int > > observationSegments = getObservationSegmentsToProcess(
+                        observationsCollection, observationSets, allObservationSets, maximumNumberOfObservationsPerBlock );
+            for( unsigned int j = 0; j < observationSegments.size( ); j++ )
+            {
+                calculateObservationSegmentNormalEquationsAndResiduals(
+                            observationsCollection, observationSets.at( std::get< 0 >( observationSegments.at( j ) ) ),
+                            std::get< 1 >( observationSegments.at( j ) ), std::get< 2 >( observationSegments.at( j ) ),
+                            weightsMatrixDiagonals, workerNormalEquations.at( 0 ), residuals, calculateResiduals );
+            }
+        }
+    }
+
+    //! Function to combine the normal equations and residuals over processes, and check the residuals for discontinuities
+    /*!
+     *  Function to combine the normal equations and residuals over processes (if distributed), and check the residuals
+     *  for discontinuities (if calculated).
+     *  \param observationsCollection Full set of observations
+     *  \param normalEquations Normal equations of current process (modified by reference)
+     *  \param residuals Residuals of current process (modified by reference)
+     *  \param calculateResiduals Boolean denoting whether residuals are computed
+     *  \param distributeOverProcesses Boolean denoting whether the observation sets are distributed over processes
+     */
+    template< typename NormalEquationsType >
+    void finalizeNormalEquationsAndResiduals(
+            const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
+            NormalEquationsType& normalEquations,
+            Eigen::VectorXd& residuals,
+            const bool calculateResiduals,
+            const bool distributeOverProcesses )
+    {
+        // Combine normal equations and residuals of all processes (residuals of other processes' sets are zero)
+        if( distributeOverProcesses )
+        {
+            reduceNormalEquationsOverProcesses( normalEquations );
+            processCommunicator_->sumOverProcesses( residuals.data( ), residuals.size( ) );
+        }
+
+        if( calculateResiduals )
+        {
+            for( auto observablesIterator : observationsCollection->getObservations( ) )
+            {
+                std::pair< int, int > observableStartAndSize = observationsCollection->getObservationTypeStartAndSize( ).at(
+                            observablesIterator.first );
+
+                observation_models::checkObservationResidualDiscontinuities(
+                            residuals.block( observableStartAndSize.first, 0, observableStartAndSize.second, 1 ),
+                            observablesIterator.first );
+            }
+        }
+    }
+
+    //! Function to distribute observation sets over threads, such that no two threads share any observation model objects
+    /*!
+     *  Function to distribute observation sets over threads, such that no two threads share any observation model objects
+     *  (see setNumberOfDesignMatrixThreads). The sets are first divided into groups, after which the groups are assigned
+     *  to the threads in order of decreasing number of observations, each to the thread with the fewest observations so
+     *  far. The distribution depends only on the observation sets and the number of threads.
+     *  \param observationsCollection Full set of observations
+     *  \param observationSets List of observation sets (observable type, link ends and index of set)
+     *  \return Indices (in observationSets) of sets assigned to each thread, in increasing order
+     */
+    std::vector< std::vector< int > > distributeObservationSetsOverThreads(
+            const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
+            const std::vector< std::tuple< observation_models::ObservableType, observation_models::LinkEnds, int > >& observationSets )
+    {
+        // Determine groups of sets, merging sets with common observation models or link end id pairs (union-find)
+        std::vector< int > groupParents( observationSets.size( ) );
+        for( unsigned int i = 0; i < observationSets.size( ); i++ )
+        {
+            groupParents[ i ] = i;
+        }
+        std::function< int( const int ) > findGroup = [ & ]( const int setIndex )
+        {
+            int currentIndex = setIndex;
+            while( groupParents[ currentIndex ] != currentIndex )
+            {
+                groupParents[ currentIndex ] = groupParents[ groupParents[ currentIndex ] ];
+                currentIndex = groupParents[ currentIndex ];
+            }
+            return currentIndex;
+        };
+
+        std::map< std::pair< observation_models::ObservableType, observation_models::LinkEnds >, int > firstSetOfModel;
+        std::map< std::pair< observation_models::LinkEndId, observation_models::LinkEndId >, int > firstSetOfLinkEndPair;
+        for( unsigned int i = 0; i < observationSets.size( ); i++ )
+        {
+            std::vector< int > setsToMerge;
+
+            std::pair< observation_models::ObservableType, observation_models::LinkEnds > modelKey =
+                    std::make_pair( std::get< 0 >( observationSets.at( i ) ), std::get< 1 >( observationSets.at( i ) ) );
+            if( firstSetOfModel.count( modelKey ) == 0 )
+            {
+                firstSetOfModel[ modelKey ] = i;
+            }
+            setsToMerge.push_back( firstSetOfModel.at( modelKey ) );
+
+            std::vector< observation_models::LinkEndId > linkEndIds;
+            for( auto linkEndIterator : std::get< 1 >( observationSets.at( i ) ) )
+            {
+                if( std::find( linkEndIds.begin( ), linkEndIds.end( ), linkEndIterator.second ) == linkEndIds.end( ) )
+                {
+                    linkEndIds.push_back( linkEndIterator.second );
+                }
+            }
+            std::sort( linkEndIds.begin( ), linkEndIds.end( ) );
+            for( unsigned int j = 0; j < linkEndIds.size( ); j++ )
+            {
+                for( unsigned int k = j + 1; k < linkEndIds.size( ); k++ )
+                {
+                    std::pair< observation_models::LinkEndId, observation_models::LinkEndId > pairKey =
+                            std::make_pair( linkEndIds.at( j ), linkEndIds.at( k ) );
+                    if( firstSetOfLinkEndPair.count( pairKey ) == 0 )
+                    {
+                        firstSetOfLinkEndPair[ pairKey ] = i;
+                    }
+                    setsToMerge.push_back( firstSetOfLinkEndPair.at( pairKey ) );
+                }
+            }
+
+            for( unsigned int j = 0; j < setsToMerge.size( ); j++ )
+            {
+                int firstGroup = findGroup( i );
+                int secondGroup = findGroup( setsToMerge.at( j ) );
+                if( firstGroup != secondGroup )
+                {
+                    groupParents[ std::max( firstGroup, secondGroup ) ] = std::min( firstGroup, secondGroup );
+                }
+            }
+        }
+
+        // Retrieve sets and number of observations per group (groups ordered by their first set)
+        std::map< int, std::vector< int > > groupSets;
+        std::map< int, int > groupNumberOfObservations;
+        for( unsigned int i = 0; i < observationSets.size( ); i++ )
+        {
+            int currentGroup = findGroup( i );
+            groupSets[ currentGroup ].push_back( i );
+            groupNumberOfObservations[ currentGroup ] += observationsCollection->getObservationSetStartAndSize( ).at(
+                        std::get< 0 >( observationSets.at( i ) ) ).at( std::get< 1 >( observationSets.at( i ) ) ).at(
+                        std::get< 2 >( observationSets.at( i ) ) ).second;
+        }
+
+        // Assign largest groups first, each to thread with fewest observations
+        std::vector< std::pair< int, int > > groupsToAssign;
+        for( auto groupIterator : groupNumberOfObservations )
+        {
+            groupsToAssign.push_back( std::make_pair( -groupIterator.second, groupIterator.first ) );
+        }
+        std::sort( groupsToAssign.begin( ), groupsToAssign.end( ) );
+
+        int numberOfThreads = std::min( numberOfDesignMatrixThreads_, static_cast< int >( groupsToAssign.size( ) ) );
+        std::vector< std::vector< int > > threadSets( numberOfThreads );
+        std::vector< int > threadNumberOfObservations( numberOfThreads, 0 );
+        for( unsigned int i = 0; i < groupsToAssign.size( ); i++ )
+        {
+            int currentThread = std::min_element( threadNumberOfObservations.begin( ), threadNumberOfObservations.end( ) ) -
+                    threadNumberOfObservations.begin( );
+            threadNumberOfObservations[ currentThread ] -= groupsToAssign.at( i ).first;
+            threadSets[ currentThread ].insert( threadSets[ currentThread ].end( ),
+                                                groupSets.at( groupsToAssign.at( i ).second ).begin( ),
+                                                groupSets.at( groupsToAssign.at( i ).second ).end( ) );
+        }
+
+        for( unsigned int i = 0; i < threadSets.size( ); i++ )
+        {
+            std::sort( threadSets[ i ].begin( ), threadSets[ i ].end( ) );
+        }
+        return threadSets;
+    }
+
     //! Function to create full parameters set with estimated and consider parameters.
     void setFullParametersSet( )
     {
@@ -1242,23 +2808,21 @@ protected:
     }
 
 
-    std::pair< std::pair< Eigen::MatrixXd, Eigen::MatrixXd >, Eigen::VectorXd > performPreEstimationSteps(
+    void resetParameterEstimateForIteration(
             std::shared_ptr< CovarianceAnalysisInput< ObservationScalarType, TimeType > > estimationInput,
             ParameterVectorType& newParameterEstimate,
-            const bool calculateResiduals,
             const int numberOfIterations,
             bool& exceptionDuringPropagation,
-            std::shared_ptr< propagators::SimulationResults< ObservationScalarType, TimeType > >& simulationResults )
+            std::shared_ptr< propagators::SimulationResults< ObservationScalarType, TimeType > >& simulationResults,
+            const bool integrateDynamicsOnly = false )
     {
-        // Get number of observations
-        int totalNumberOfObservations = estimationInput->getObservationCollection( )->getTotalObservableSize( );
-
         // Re-integrate equations of motion and variational equations with new parameter estimate.
         try
         {
             if( ( numberOfIterations > 0 ) || ( estimationInput->getReintegrateEquationsOnFirstIteration( ) ) )
             {
-                resetParameterEstimate( newParameterEstimate, estimationInput->getReintegrateVariationalEquations( ) );
+                resetParameterEstimate( newParameterEstimate,
+                                        estimationInput->getReintegrateVariationalEquations( ) && !integrateDynamicsOnly );
             }
 
             if( std::dynamic_pointer_cast< EstimationInput< ObservationScalarType, TimeType > >( estimationInput ) != nullptr )
@@ -1275,6 +2839,21 @@ protected:
                      error.what( )<<std::endl<<"Terminating estimation"<<std::endl;
             exceptionDuringPropagation = true;
         }
+    }
+
+    std::pair< std::pair< Eigen::MatrixXd, Eigen::MatrixXd >, Eigen::VectorXd > performPreEstimationSteps(
+            std::shared_ptr< CovarianceAnalysisInput< ObservationScalarType, TimeType > > estimationInput,
+            ParameterVectorType& newParameterEstimate,
+            const bool calculateResiduals,
+            const int numberOfIterations,
+            bool& exceptionDuringPropagation,
+            std::shared_ptr< propagators::SimulationResults< ObservationScalarType, TimeType > >& simulationResults )
+    {
+        // Get number of observations
+        int totalNumberOfObservations = estimationInput->getObservationCollection( )->getTotalObservableSize( );
+
+        resetParameterEstimateForIteration(
+                    estimationInput, newParameterEstimate, numberOfIterations, exceptionDuringPropagation, simulationResults );
 
         if( estimationInput->getPrintOutput( ) )
         {
@@ -1301,6 +2880,44 @@ protected:
         return std::make_pair( designMatrices, residuals );
     }
 
+    template< typename NormalEquationsType >
+    void performPreEstimationStepsWithNormalEquations(
+            std::shared_ptr< CovarianceAnalysisInput< ObservationScalarType, TimeType > > estimationInput,
+            ParameterVectorType& newParameterEstimate,
+            const bool calculateResiduals,
+            const int numberOfIterations,
+            bool& exceptionDuringPropagation,
+            std::shared_ptr< propagators::SimulationResults< ObservationScalarType, TimeType > >& simulationResults,
+            NormalEquationsType& normalEquations,
+            Eigen::VectorXd& residuals,
+            const bool pipelinedArcProcessing = false )
+    {
+        // Propagate only the dynamics if the variational equations are propagated arc by arc below
+        resetParameterEstimateForIteration(
+                    estimationInput, newParameterEstimate, numberOfIterations, exceptionDuringPropagation, simulationResults,
+                    pipelinedArcProcessing );
+
+        if( estimationInput->getPrintOutput( ) )
+        {
+            std::cout << "Accumulating normal equations and residuals " <<
+                         estimationInput->getObservationCollection( )->getTotalObservableSize( ) << std::endl;
+        }
+
+        // Calculate residuals and normal equations (w.r.t. estimated and consider parameters) for current parameter estimate.
+        if( pipelinedArcProcessing )
+        {
+            calculatePipelinedNormalEquationsAndResiduals(
+                        estimationInput->getObservationCollection( ), estimationInput->getWeightsMatrixDiagonals( ),
+                        estimationInput->getMaximumNumberOfObservationsPerBlock( ), normalEquations, residuals, calculateResiduals );
+        }
+        else
+        {
+            calculateNormalEquationsAndResiduals(
+                        estimationInput->getObservationCollection( ), estimationInput->getWeightsMatrixDiagonals( ),
+                        estimationInput->getMaximumNumberOfObservationsPerBlock( ), normalEquations, residuals, calculateResiduals );
+        }
+    }
+
     std::pair< Eigen::MatrixXd, Eigen::MatrixXd > separateEstimatedAndConsiderDesignMatrices(
             const Eigen::MatrixXd& designMatrix,
             const int numberObservations )
@@ -1372,6 +2989,10 @@ protected:
     //! Object used to interpolate the numerically integrated result of the dependent variables.
     std::shared_ptr< propagators::DependentVariablesInterface< TimeType > > dependentVariablesInterface_;
 
+    //! Object storing the one-way range partials of the constituent links of composite observables, shared between observables
+    std::shared_ptr< observation_partials::OneWayRangePartialRegistry< ObservationScalarType, TimeType > >
+    oneWayRangePartialRegistry_;
+
     //! Container object for indices and sizes of consider parameters in the full estimated parameters set.
     std::vector< std::pair< std::pair< int, int >, int > > indicesAndSizeConsiderParameters_;
 
@@ -1381,6 +3002,27 @@ protected:
     //! Boolean denoting whether consider parameters are included in the orbit determination
     bool considerParametersIncluded_;
 
+    //! Number of threads over which the design matrix and residuals are computed
+    int numberOfDesignMatrixThreads_;
+
+    //! Boolean denoting whether the observations of all sets are processed in order of observation time
+    bool useTimeOrderedObservationProcessing_;
+
+    //! Indices of the arc-local parameters of each arc, used when eliminating arc-local parameters (see estimateParameters)
+    std::vector< std::vector< int > > arcLocalParameterIndices_;
+
+    //! Start times of the arcs of the dynamics, used when eliminating arc-local parameters (see estimateParameters)
+    std::vector< double > arcStartTimes_;
+
+    //! Object used for the communication between the processes over which the arcs are distributed (nullptr if not distributed)
+    std::shared_ptr< utilities::ProcessCommunicator > processCommunicator_;
+
+    //! Indices of the possibly non-zero columns of the design matrix, per observable type and link ends
+    std::map< observation_models::ObservableType, std::map< observation_models::LinkEnds, std::vector< int > > > designMatrixSparsity_;
+
+    //! Indices of the columns of the design matrix that are not associated with observation link properties
+    std::vector< int > nonLinkPropertyDesignMatrixColumns_;
+
 };
 
 //extern template class OrbitDeterminationManager< double, double >;
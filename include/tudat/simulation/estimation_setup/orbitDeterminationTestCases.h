@@ -670,7 +670,12 @@ std::pair< Eigen::VectorXd, bool >  executeEarthOrbiterBiasEstimation(
         const bool estimateAbsoluteBiases = true,
         const bool omitRangeData = false,
         const bool useMultiArcBiases = false,
-        const bool estimateTimeBiases = false )
+        const bool estimateTimeBiases = false,
+        const int numberOfDesignMatrixThreads = 1,
+        const bool accumulateNormalEquations = false,
+        const bool reuseBiasPartials = false,
+        const bool rejectOutliers = false,
+        const bool useTimeOrderedProcessing = false )
 {
 
     const int numberOfDaysOfData = 1;
@@ -1142,6 +1147,8 @@ std::pair< Eigen::VectorXd, bool >  executeEarthOrbiterBiasEstimation(
             OrbitDeterminationManager< StateScalarType, TimeType >(
                 bodies, parametersToEstimate, observationSettingsList,
                 integratorSettings, propagatorSettings );
+    orbitDeterminationManager.setNumberOfDesignMatrixThreads( numberOfDesignMatrixThreads );
+    orbitDeterminationManager.setTimeOrderedObservationProcessing( useTimeOrderedProcessing );
 
     std::vector< TimeType > baseTimeList;
     double observationTimeStart = initialEphemerisTime + 600.0;
@@ -1179,6 +1186,35 @@ std::pair< Eigen::VectorXd, bool >  executeEarthOrbiterBiasEstimation(
     std::shared_ptr< ObservationCollection< StateScalarType, TimeType > > simulatedObservations = simulateObservations< StateScalarType, TimeType >(
                 measurementSimulationInput, orbitDeterminationManager.getObservationSimulators( ), bodies );
 
+    // Corrupt one observation of each range observation set, to be rejected by reweighting the observations
+    if( rejectOutliers )
+    {
+        typename ObservationCollection< StateScalarType, TimeType >::SortedObservationSets corruptedObservationSets =
+                simulatedObservations->getObservations( );
+        for( auto& observableIterator : corruptedObservationSets )
+        {
+            if( observableIterator.first == one_way_range || observableIterator.first == n_way_range )
+            {
+                for( auto& linkEndIterator : observableIterator.second )
+                {
+                    for( unsigned int i = 0; i < linkEndIterator.second.size( ); i++ )
+                    {
+                        std::shared_ptr< SingleObservationSet< StateScalarType, TimeType > > currentObservationSet =
+                                linkEndIterator.second.at( i );
+                        std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > corruptedObservations =
+                                currentObservationSet->getObservations( );
+                        corruptedObservations.at( corruptedObservations.size( ) / 2 )( 0 ) += 1.0E4;
+                        linkEndIterator.second.at( i ) = std::make_shared< SingleObservationSet< StateScalarType, TimeType > >(
+                                    observableIterator.first, currentObservationSet->getLinkEnds( ), corruptedObservations,
+                                    currentObservationSet->getObservationTimes( ), currentObservationSet->getReferenceLinkEnd( ) );
+                    }
+                }
+            }
+        }
+        simulatedObservations = std::make_shared< ObservationCollection< StateScalarType, TimeType > >(
+                    corruptedObservationSets );
+    }
+
     // Perturb parameter estimate
     Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > initialParameterEstimate =
             parametersToEstimate->template getFullParameterValues< StateScalarType >( );
@@ -1235,6 +1271,16 @@ std::pair< Eigen::VectorXd, bool >  executeEarthOrbiterBiasEstimation(
     estimationInput->setConstantPerObservableWeightsMatrix( weightPerObservable );
     estimationInput->defineEstimationSettings( true, false, false, true, true );
     estimationInput->setConvergenceChecker( std::make_shared< EstimationConvergenceChecker >( numberOfIterations ) );
+    estimationInput->setNormalEquationsAccumulation( accumulateNormalEquations, 150 );
+    if( reuseBiasPartials )
+    {
+        estimationInput->setPartialsReuse(
+        { std::make_pair( 6, parametersToEstimate->getParameterSetSize( ) - 6 ) } );
+    }
+    if( rejectOutliers )
+    {
+        estimationInput->setObservationReweighting( std::make_shared< ObservationReweightingSettings >( 1.0E3 ) );
+    }
 
     // Perform estimation
     std::shared_ptr< EstimationOutput< StateScalarType > > estimationOutput = orbitDeterminationManager.estimateParameters(
@@ -0,0 +1,424 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_SEQUENTIALORBITDETERMINATIONFILTER_H
+#define TUDAT_SEQUENTIALORBITDETERMINATIONFILTER_H
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+
+#include "tudat/simulation/estimation_setup/observations.h"
+#include "tudat/simulation/estimation_setup/orbitDeterminationManager.h"
+
+namespace tudat
+{
+
+namespace simulation_setup
+{
+
+//! Sequential (Kalman-type) orbit determination filter, using the full dynamical and observation models of an
+//! OrbitDeterminationManager.
+/*!
+ *  Sequential orbit determination filter, using the full dynamical and observation models of a single-arc
+ *  OrbitDeterminationManager. The filter state is the full vector of estimated parameters of the manager, where the
+ *  initial state parameters denote the state at the current filter epoch. Observations are processed in time order, in
+ *  update windows: in each window, the equations of motion and variational equations are integrated from the current
+ *  epoch (using the models, integrator, observation managers and environment already created by the manager), and
+ *  each observation in the window is processed by a (Joseph-form) Kalman measurement update of the deviation w.r.t.
+ *  this reference trajectory (conventional Kalman filter formulation). At the end of each window, the deviation is
+ *  mapped to the new epoch with the state transition and sensitivity matrices, and added to the reference trajectory,
+ *  which is then used as the new reference for the next window (extended Kalman filter formulation, with
+ *  relinearization at window boundaries).
+ *
+ *  A window contains all observations within the maximum update interval of its first observation, and ends a
+ *  light-time margin after its last observation (so that the light-time solutions of all observations in the window are
+ *  within the propagated interval). Consequently, the signal travel time of all observations must be smaller than
+ *  this margin, and the current filter epoch must precede the first observation to be processed by at least this
+ *  margin. Observations that are separated by less than twice the margin are always processed in the same window.
+ *  Only estimated parameters are supported (no consider parameters), and the numerical solution of the equations of
+ *  motion is retained after propagation (the clear-numerical-solution output setting is turned off by this class).
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+class SequentialOrbitDeterminationFilter
+{
+public:
+
+    //! Typedef for vector of parameters
+    typedef Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > ParameterVectorType;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param orbitDeterminationManager Single-arc orbit determination manager defining the dynamical and observation
+     *  models, and the estimated parameters. Its current parameter estimate, and the initial time of its propagator
+     *  settings, define the initial filter estimate and epoch.
+     *  \param initialCovariance Covariance of the initial filter estimate
+     *  \param maximumUpdateInterval Maximum duration over which observations are processed w.r.t. a single reference
+     *  trajectory (see class description).
+     *  \param lightTimeMargin Margin by which each window is extended beyond its last observation (must exceed the
+     *  signal travel time of all observations).
+     *  \param stateProcessNoiseRate Rate of change of the process noise covariance of the propagated states (square
+     *  matrix of the size of the initial state parameters, or empty for no process noise). At the end of each window,
+     *  this matrix times the window duration is added to the covariance of the states.
+     */
+    SequentialOrbitDeterminationFilter(
+            const std::shared_ptr< OrbitDeterminationManager< ObservationScalarType, TimeType > > orbitDeterminationManager,
+            const Eigen::MatrixXd& initialCovariance,
+            const TimeType maximumUpdateInterval,
+            const TimeType lightTimeMargin = 60.0,
+            const Eigen::MatrixXd& stateProcessNoiseRate = Eigen::MatrixXd::Zero( 0, 0 ) ):
+        orbitDeterminationManager_( orbitDeterminationManager ),
+        currentCovariance_( initialCovariance ),
+        maximumUpdateInterval_( maximumUpdateInterval ),
+        lightTimeMargin_( lightTimeMargin ),
+        stateProcessNoiseRate_( stateProcessNoiseRate )
+    {
+        std::shared_ptr< propagators::SingleArcVariationalEquationsSolver< ObservationScalarType, TimeType > >
+                variationalEquationsSolver = std::dynamic_pointer_cast<
+                propagators::SingleArcVariationalEquationsSolver< ObservationScalarType, TimeType > >(
+                    orbitDeterminationManager_->getVariationalEquationsSolver( ) );
+        if( variationalEquationsSolver == nullptr )
+        {
+            throw std::runtime_error( "Error when creating sequential orbit determination filter, only single-arc dynamics is supported." );
+        }
+        propagatorSettings_ = variationalEquationsSolver->getDynamicsSimulator( )->getPropagatorSettings( );
+        propagatorSettings_->getOutputSettings( )->setClearNumericalSolutions( false );
+        equationsOfMotionSolver_ = variationalEquationsSolver;
+
+        if( orbitDeterminationManager_->getParametersToEstimate( )->getConsiderParameters( ) != nullptr )
+        {
+            throw std::runtime_error( "Error when creating sequential orbit determination filter, consider parameters are not supported." );
+        }
+
+        currentParameterEstimate_ = orbitDeterminationManager_->getCurrentParameterEstimate( );
+        currentEpoch_ = propagatorSettings_->getInitialTime( );
+        numberOfParameters_ = currentParameterEstimate_.rows( );
+        numberOfStates_ = orbitDeterminationManager_->getParametersToEstimate( )->getInitialDynamicalStateParameterSize( );
+
+        if( currentCovariance_.rows( ) != numberOfParameters_ || currentCovariance_.cols( ) != numberOfParameters_ )
+        {
+            throw std::runtime_error( "Error when creating sequential orbit determination filter, initial covariance size is inconsistent." );
+        }
+        if( stateProcessNoiseRate_.size( ) > 0 &&
+                ( stateProcessNoiseRate_.rows( ) != numberOfStates_ || stateProcessNoiseRate_.cols( ) != numberOfStates_ ) )
+        {
+            throw std::runtime_error( "Error when creating sequential orbit determination filter, process noise size is inconsistent." );
+        }
+        if( !( maximumUpdateInterval_ > 0.0 ) || lightTimeMargin_ < 0.0 )
+        {
+            throw std::runtime_error( "Error when creating sequential orbit determination filter, update interval must be positive and light-time margin non-negative." );
+        }
+    }
+
+    //! Function to process a set of observations
+    /*!
+     *  Function to process a set of observations, updating the filter estimate and covariance, and moving the filter
+     *  epoch to the end of the last update window. This function may be called repeatedly with new observations, which
+     *  must all be later than the current filter epoch.
+     *  \param observationCollection Observations that are to be processed
+     *  \param observationWeights Weights of the observations (inverse of the noise variance), in the order of the
+     *  concatenated observation vector of the observation collection
+     *  \return Pre-fit residuals (innovations) of the observations, in the order of the concatenated observation vector
+     *  of the observation collection
+     */
+    Eigen::VectorXd processObservations(
+            const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationCollection,
+            const Eigen::VectorXd& observationWeights )
+    {
+        using namespace observation_models;
+
+        if( observationWeights.rows( ) != observationCollection->getTotalObservableSize( ) )
+        {
+            throw std::runtime_error( "Error when processing observations in sequential filter, weight vector size is inconsistent." );
+        }
+
+        // Create list of all observation epochs, sorted by time
+        std::vector< ObservationEpoch > observationEpochs;
+        for( auto observableIterator : observationCollection->getObservations( ) )
+        {
+            for( auto linkEndIterator : observableIterator.second )
+            {
+                const std::vector< std::pair< int, int > >& setStartAndSize =
+                        observationCollection->getObservationSetStartAndSize( ).at( observableIterator.first ).at( linkEndIterator.first );
+                for( unsigned int i = 0; i < linkEndIterator.second.size( ); i++ )
+                {
+                    std::shared_ptr< SingleObservationSet< ObservationScalarType, TimeType > > observationSet =
+                            linkEndIterator.second.at( i );
+                    const std::vector< TimeType >& observationTimes = observationSet->getObservationTimes( );
+                    for( unsigned int j = 0; j < observationTimes.size( ); j++ )
+                    {
+                        observationEpochs.push_back(
+                                    ObservationEpoch( observationTimes.at( j ), observationSet, j,
+                                                      setStartAndSize.at( i ).first + j * observationSet->getSingleObservableSize( ) ) );
+                    }
+                }
+            }
+        }
+        std::stable_sort( observationEpochs.begin( ), observationEpochs.end( ),
+                          [ ]( const ObservationEpoch& first, const ObservationEpoch& second ){ return first.time_ < second.time_; } );
+
+        if( observationEpochs.size( ) > 0 && observationEpochs.at( 0 ).time_ < currentEpoch_ )
+        {
+            throw std::runtime_error( "Error when processing observations in sequential filter, observations precede current filter epoch." );
+        }
+
+        Eigen::VectorXd preFitResiduals = Eigen::VectorXd::Zero( observationCollection->getTotalObservableSize( ) );
+        unsigned int windowStartIndex = 0;
+        while( windowStartIndex < observationEpochs.size( ) )
+        {
+            // Determine observations in current window
+            unsigned int windowEndIndex = windowStartIndex + 1;
+            while( windowEndIndex < observationEpochs.size( ) &&
+                   ( observationEpochs.at( windowEndIndex ).time_ - observationEpochs.at( windowStartIndex ).time_ <= maximumUpdateInterval_ ||
+                     observationEpochs.at( windowEndIndex ).time_ - observationEpochs.at( windowEndIndex - 1 ).time_ < 2.0 * lightTimeMargin_ ) )
+            {
+                windowEndIndex++;
+            }
+
+            // Propagate reference trajectory and variational equations over window
+            TimeType windowEndEpoch = observationEpochs.at( windowEndIndex - 1 ).time_ + lightTimeMargin_;
+            propagateReferenceTrajectory( windowEndEpoch );
+
+            // Process observations w.r.t. reference trajectory at current epoch
+            Eigen::VectorXd parameterDeviation = Eigen::VectorXd::Zero( numberOfParameters_ );
+            for( unsigned int i = windowStartIndex; i < windowEndIndex; i++ )
+            {
+                preFitResiduals.segment( observationEpochs.at( i ).startIndex_,
+                                         observationEpochs.at( i ).observationSet_->getSingleObservableSize( ) ) =
+                        performMeasurementUpdate( observationEpochs.at( i ), observationWeights, parameterDeviation );
+            }
+
+            // Map estimate and covariance to end of window
+            mapEstimateToWindowEnd( parameterDeviation );
+            windowStartIndex = windowEndIndex;
+        }
+
+        return preFitResiduals;
+    }
+
+    //! Function to process a set of observations, using a single weight for all observations
+    /*!
+     *  Function to process a set of observations, using a single weight for all observations (see overloaded function).
+     *  \param observationCollection Observations that are to be processed
+     *  \param constantObservationWeight Weight of all observations (inverse of the noise variance)
+     *  \return Pre-fit residuals (innovations) of the observations, in the order of the concatenated observation vector
+     *  of the observation collection
+     */
+    Eigen::VectorXd processObservations(
+            const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationCollection,
+            const double constantObservationWeight )
+    {
+        return processObservations(
+                    observationCollection, Eigen::VectorXd::Constant(
+                        observationCollection->getTotalObservableSize( ), constantObservationWeight ) );
+    }
+
+    //! Function to propagate the filter estimate and covariance to a later epoch, without processing observations
+    /*!
+     *  Function to propagate the filter estimate and covariance to a later epoch, without processing observations
+     *  \param newEpoch Epoch to which the filter is to be propagated
+     */
+    void propagateToEpoch( const TimeType newEpoch )
+    {
+        if( newEpoch < currentEpoch_ )
+        {
+            throw std::runtime_error( "Error when propagating sequential filter, new epoch precedes current filter epoch." );
+        }
+        else if( newEpoch > currentEpoch_ )
+        {
+            propagateReferenceTrajectory( newEpoch );
+            mapEstimateToWindowEnd( Eigen::VectorXd::Zero( numberOfParameters_ ) );
+        }
+    }
+
+    //! Function to retrieve the current filter epoch
+    TimeType getCurrentEpoch( )
+    {
+        return currentEpoch_;
+    }
+
+    //! Function to retrieve the current parameter estimate (with initial state parameters at current filter epoch)
+    ParameterVectorType getCurrentParameterEstimate( )
+    {
+        return currentParameterEstimate_;
+    }
+
+    //! Function to retrieve the covariance of the current parameter estimate
+    Eigen::MatrixXd getCurrentCovariance( )
+    {
+        return currentCovariance_;
+    }
+
+    //! Function to retrieve the orbit determination manager used by the filter
+    std::shared_ptr< OrbitDeterminationManager< ObservationScalarType, TimeType > > getOrbitDeterminationManager( )
+    {
+        return orbitDeterminationManager_;
+    }
+
+private:
+
+    //! Single observation epoch (in an observation set) that is to be processed
+    struct ObservationEpoch
+    {
+        ObservationEpoch( const TimeType time,
+                          const std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > observationSet,
+                          const int indexInSet, const int startIndex ):
+            time_( time ), observationSet_( observationSet ), indexInSet_( indexInSet ), startIndex_( startIndex ){ }
+
+        TimeType time_;
+
+        std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > observationSet_;
+
+        //! Index of observation epoch in observation set
+        int indexInSet_;
+
+        //! Index of observation in concatenated observation vector of the observation collection
+        int startIndex_;
+    };
+
+    //! Function to integrate the equations of motion and variational equations from the current epoch to a later epoch
+    void propagateReferenceTrajectory( const TimeType windowEndEpoch )
+    {
+        propagatorSettings_->resetInitialTime( currentEpoch_ );
+        propagatorSettings_->resetTerminationSettings(
+                    std::make_shared< propagators::PropagationTimeTerminationSettings >(
+                        static_cast< double >( windowEndEpoch ), true ) );
+        orbitDeterminationManager_->resetParameterEstimate( currentParameterEstimate_, true );
+    }
+
+    //! Function to perform a measurement update for a single observation epoch, w.r.t. the current reference trajectory
+    /*!
+     *  Function to perform a measurement update for a single observation epoch, w.r.t. the current reference trajectory
+     *  \param observationEpoch Observation epoch that is to be processed
+     *  \param observationWeights Weights of all observations (see processObservations)
+     *  \param parameterDeviation Deviation of the estimate w.r.t. the reference trajectory at the current epoch (updated
+     *  by this function).
+     *  \return Pre-fit residual of the observation
+     */
+    Eigen::VectorXd performMeasurementUpdate(
+            const ObservationEpoch& observationEpoch,
+            const Eigen::VectorXd& observationWeights,
+            Eigen::VectorXd& parameterDeviation )
+    {
+        std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > observationSet =
+                observationEpoch.observationSet_;
+        int observableSize = observationSet->getSingleObservableSize( );
+
+        // Compute observation and partials w.r.t. parameters at current epoch
+        std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >, Eigen::MatrixXd > observationsAndPartials =
+                orbitDeterminationManager_->getObservationManager( observationSet->getObservableType( ) )->computeObservationsWithPartials(
+                    std::vector< TimeType >( { observationEpoch.time_ } ), observationSet->getLinkEnds( ).linkEnds_,
+                    observationSet->getReferenceLinkEnd( ), observationSet->getAncilliarySettings( ) );
+        const Eigen::MatrixXd& partials = observationsAndPartials.second;
+        if( partials.rows( ) != observableSize || partials.cols( ) != numberOfParameters_ )
+        {
+            throw std::runtime_error( "Error when processing observations in sequential filter, observation partials size is inconsistent." );
+        }
+
+        // Compute residual and Kalman gain
+        Eigen::VectorXd preFitResidual =
+                ( observationSet->getObservation( observationEpoch.indexInSet_ ) - observationsAndPartials.first ).template cast< double >( );
+        Eigen::VectorXd residual = preFitResidual - partials * parameterDeviation;
+        Eigen::MatrixXd observationCovariance =
+                observationWeights.segment( observationEpoch.startIndex_, observableSize ).cwiseInverse( ).asDiagonal( );
+        Eigen::MatrixXd covarianceTimesPartials = currentCovariance_ * partials.transpose( );
+        Eigen::MatrixXd kalmanGain = covarianceTimesPartials *
+                ( partials * covarianceTimesPartials + observationCovariance ).inverse( );
+
+        // Update deviation and covariance (Joseph form)
+        parameterDeviation += kalmanGain * residual;
+        Eigen::MatrixXd updateMatrix = Eigen::MatrixXd::Identity( numberOfParameters_, numberOfParameters_ ) - kalmanGain * partials;
+        currentCovariance_ = updateMatrix * currentCovariance_ * updateMatrix.transpose( ) +
+                kalmanGain * observationCovariance * kalmanGain.transpose( );
+
+        return preFitResidual;
+    }
+
+    //! Function to map the estimate and covariance from the current epoch to the end of the current update window
+    /*!
+     *  Function to map the estimate and covariance from the current epoch to the end of the current update window, using
+     *  the current reference trajectory and state transition and sensitivity matrices, and adding process noise. The
+     *  final epoch of the reference trajectory becomes the new filter epoch.
+     *  \param parameterDeviation Deviation of the estimate w.r.t. the reference trajectory at the current epoch
+     */
+    void mapEstimateToWindowEnd( const Eigen::VectorXd& parameterDeviation )
+    {
+        const std::map< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >& stateHistory =
+                equationsOfMotionSolver_->getEquationsOfMotionSolution( );
+        if( stateHistory.size( ) == 0 )
+        {
+            throw std::runtime_error( "Error when mapping estimate in sequential filter, no reference trajectory found." );
+        }
+        TimeType windowEndEpoch = stateHistory.rbegin( )->first;
+
+        // Retrieve full mapping matrix of parameters from current epoch to window end
+        Eigen::MatrixXd mappingMatrix = Eigen::MatrixXd::Identity( numberOfParameters_, numberOfParameters_ );
+        mappingMatrix.topRows( numberOfStates_ ) =
+                orbitDeterminationManager_->getStateTransitionAndSensitivityMatrixInterface( )->
+                getFullCombinedStateTransitionAndSensitivityMatrix( static_cast< double >( windowEndEpoch ) );
+
+        // Update estimate, using reference states at end of window
+        Eigen::VectorXd mappedDeviation = mappingMatrix * parameterDeviation;
+        currentParameterEstimate_.segment( 0, numberOfStates_ ) = stateHistory.rbegin( )->second.segment( 0, numberOfStates_ );
+        currentParameterEstimate_ += mappedDeviation.template cast< ObservationScalarType >( );
+
+        // Update covariance
+        currentCovariance_ = mappingMatrix * currentCovariance_ * mappingMatrix.transpose( );
+        if( stateProcessNoiseRate_.size( ) > 0 )
+        {
+            currentCovariance_.block( 0, 0, numberOfStates_, numberOfStates_ ) +=
+                    stateProcessNoiseRate_ * static_cast< double >( windowEndEpoch - currentEpoch_ );
+        }
+        currentEpoch_ = windowEndEpoch;
+    }
+
+    //! Orbit determination manager defining the dynamical and observation models
+    std::shared_ptr< OrbitDeterminationManager< ObservationScalarType, TimeType > > orbitDeterminationManager_;
+
+    //! Object used to integrate the equations of motion and variational equations
+    std::shared_ptr< propagators::SingleArcVariationalEquationsSolver< ObservationScalarType, TimeType > > equationsOfMotionSolver_;
+
+    //! Propagator settings used by orbitDeterminationManager_, reset for each update window
+    std::shared_ptr< propagators::SingleArcPropagatorSettings< ObservationScalarType, TimeType > > propagatorSettings_;
+
+    //! Current parameter estimate (with initial state parameters at currentEpoch_)
+    ParameterVectorType currentParameterEstimate_;
+
+    //! Covariance of currentParameterEstimate_
+    Eigen::MatrixXd currentCovariance_;
+
+    //! Current filter epoch
+    TimeType currentEpoch_;
+
+    //! Maximum duration over which observations are processed w.r.t. a single reference trajectory
+    TimeType maximumUpdateInterval_;
+
+    //! Margin by which each window is extended beyond its last observation
+    TimeType lightTimeMargin_;
+
+    //! Rate of change of the process noise covariance of the propagated states
+    Eigen::MatrixXd stateProcessNoiseRate_;
+
+    //! Number of estimated parameters
+    int numberOfParameters_;
+
+    //! Number of initial state parameters
+    int numberOfStates_;
+};
+
+} // namespace simulation_setup
+
+} // namespace tudat
+
+#endif // TUDAT_SEQUENTIALORBITDETERMINATIONFILTER_H
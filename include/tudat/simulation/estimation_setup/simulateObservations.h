@@ -11,12 +11,16 @@
 #ifndef TUDAT_SIMULATEOBSERVATIONS_H
 #define TUDAT_SIMULATEOBSERVATIONS_H
 
+#include <algorithm>
 #include <memory>
 
 #include <functional>
 
 #include "tudat/astro/observation_models/observationSimulator.h"
 #include "tudat/simulation/estimation_setup/observations.h"
+#include "tudat/simulation/estimation_setup/observationArchive.h"
+#include "tudat/basics/parallelization.h"
+#include "tudat/basics/tracing.h"
 #include "tudat/basics/utilities.h"
 #include "tudat/math/statistics/randomVariableGenerator.h"
 #include "tudat/simulation/environment_setup/body.h"
@@ -67,6 +71,39 @@ void addNoiseAndDependentVariableToObservation(
 }
 
 
+//! Function to generate the noise of a list of observations in a single call
+/*!
+ *  Function to generate the noise of a list of observations in a single call, checking that the size of the noise is
+ *  consistent with the observable.
+ *  \param noiseGenerator Object generating the noise
+ *  \param observationTimes Times of the observations, in the order in which they are simulated
+ *  \param observableType Type of observable for which the noise is generated
+ *  \return Noise of the observations, with one column per observation
+ */
+template< int ObservationSize = 1, typename TimeType = double >
+Eigen::MatrixXd generateObservationNoise(
+        const std::shared_ptr< ObservationNoiseGenerator > noiseGenerator,
+        const std::vector< TimeType >& observationTimes,
+        const observation_models::ObservableType observableType )
+{
+    std::vector< double > noiseTimes( observationTimes.size( ) );
+    for( unsigned int i = 0; i < observationTimes.size( ); i++ )
+    {
+        noiseTimes[ i ] = static_cast< double >( observationTimes.at( i ) );
+    }
+
+    Eigen::MatrixXd noiseValues;
+    noiseGenerator->generateNoise( noiseTimes, noiseValues );
+    if( noiseValues.rows( ) != ObservationSize || noiseValues.cols( ) != static_cast< int >( observationTimes.size( ) ) )
+    {
+        throw std::runtime_error(
+                    "Error wen simulating observation noise, size of noise (" + std::to_string( noiseValues.rows( ) ) +
+                    ") and size of observable (" + std::to_string( ObservationSize ) +
+                    ") are not compatible for observable type: " + observation_models::getObservableName( observableType ) );
+    }
+    return noiseValues;
+}
+
 //! Function to simulate an observable, checking whether it is viable according to settings passed to this function
 /*!
  *  Function to simulate an observable, checking whether it is viable according to settings passed to this function
@@ -122,6 +159,11 @@ std::tuple< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >, bool, Eig
  *  \param referenceLinkEnd Model Reference link end for observables
  *  \param linkViabilityCalculators List of observation viability calculators, which are used to reject simulated
  *  observation if they dont fulfill a given (set of) conditions, e.g. minimum elevation angle (default none).
+ *  \param noiseFunction Function generating the noise of a single observation (default none)
+ *  \param dependentVariableCalculator Object computing the dependent variables of the observations (default none)
+ *  \param ancilliarySettings Ancilliary settings for the observation model
+ *  \param noiseGenerator Object generating the noise of all viable observations in a single call. If provided, this is
+ *  used instead of the noiseFunction (default none).
  *  \return Observations at given time (concatenated in an Eigen vector) and associated times.
  */
 template< int ObservationSize = 1, typename ObservationScalarType = double, typename TimeType = double >
@@ -136,25 +178,65 @@ simulateObservationsWithCheck(
         std::vector< std::shared_ptr< observation_models::ObservationViabilityCalculator > >( ),
         const std::function< Eigen::VectorXd( const double ) > noiseFunction = nullptr,
         const std::shared_ptr< ObservationDependentVariableCalculator > dependentVariableCalculator = nullptr,
-        const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings < TimeType > > ancilliarySettings = nullptr )
+        const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings < TimeType > > ancilliarySettings = nullptr,
+        const std::shared_ptr< ObservationNoiseGenerator > noiseGenerator = nullptr )
 {
     std::map< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > observations;
-    std::tuple< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >, bool, Eigen::VectorXd > simulatedObservation;
     std::vector< Eigen::VectorXd > dependentVariables;
 
+    // Simulate observables, and retrieve link end times and states, at all times
+    Eigen::Matrix< ObservationScalarType, ObservationSize, Eigen::Dynamic > calculatedObservations;
+    Eigen::MatrixXd linkEndTimes, linkEndStates;
+    observationModel->computeObservationsWithLinkEndDataAtTimes(
+                observationTimes, referenceLinkEnd, calculatedObservations, linkEndTimes, linkEndStates, ancilliarySettings );
+
+    Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > calculatedObservation;
+    Eigen::VectorXd currentDependentVariables;
+    std::vector< Eigen::Vector6d > vectorOfStates;
+    std::vector< double > vectorOfTimes;
+    std::vector< unsigned int > viableObservationIndices;
     for( unsigned int i = 0; i < observationTimes.size( ); i++ )
     {
-        simulatedObservation = simulateObservationWithCheck< ObservationSize, ObservationScalarType, TimeType >(
-                    observationTimes.at( i ), observationModel, referenceLinkEnd, linkViabilityCalculators, noiseFunction,
-                    dependentVariableCalculator, ancilliarySettings );
+        observation_models::getLinkEndDataFromBatchColumn( i, linkEndTimes, linkEndStates, vectorOfTimes, vectorOfStates );
 
         // Check if receiving station can view transmitting station.
-        if( std::get< 1 >( simulatedObservation ) )
+        if( isObservationViable( vectorOfStates, vectorOfTimes, linkViabilityCalculators ) )
+        {
+            calculatedObservation = calculatedObservations.col( i );
+            currentDependentVariables = Eigen::VectorXd::Zero( 0 );
+            addNoiseAndDependentVariableToObservation< ObservationSize , ObservationScalarType, TimeType >(
+                        calculatedObservation, observationTimes.at( i ), currentDependentVariables,
+                        vectorOfStates, vectorOfTimes, observationModel->getObservableType( ),
+                        ( noiseGenerator == nullptr ) ? noiseFunction : nullptr, dependentVariableCalculator );
+            calculatedObservations.col( i ) = calculatedObservation;
+
+            viableObservationIndices.push_back( i );
+            dependentVariables.push_back( currentDependentVariables );
+        }
+    }
+
+    // Generate noise of all viable observations at once
+    if( noiseGenerator != nullptr && viableObservationIndices.size( ) > 0 )
+    {
+        std::vector< TimeType > viableObservationTimes;
+        for( unsigned int i = 0; i < viableObservationIndices.size( ); i++ )
         {
-            // If viable, add observable and time to vector of simulated data.
-            observations[ observationTimes[ i ] ] = std::get< 0 >( simulatedObservation );
-            dependentVariables.push_back( std::get< 2 >( simulatedObservation ) );
+            viableObservationTimes.push_back( observationTimes.at( viableObservationIndices.at( i ) ) );
         }
+        Eigen::MatrixXd noiseValues = generateObservationNoise< ObservationSize, TimeType >(
+                    noiseGenerator, viableObservationTimes, observationModel->getObservableType( ) );
+        for( unsigned int i = 0; i < viableObservationIndices.size( ); i++ )
+        {
+            calculatedObservations.col( viableObservationIndices.at( i ) ) +=
+                    noiseValues.col( i ).template cast< ObservationScalarType >( );
+        }
+    }
+
+    // Add viable observables and times to vector of simulated data.
+    for( unsigned int i = 0; i < viableObservationIndices.size( ); i++ )
+    {
+        observations[ observationTimes.at( viableObservationIndices.at( i ) ) ] =
+                calculatedObservations.col( viableObservationIndices.at( i ) );
     }
 
     // Return pair of simulated ranges and reception times.
@@ -184,13 +266,14 @@ simulateObservationsWithCheckAndLinkEndIdOutput(
         std::vector< std::shared_ptr< observation_models::ObservationViabilityCalculator > >( ),
         const std::function< Eigen::VectorXd( const double ) > noiseFunction = nullptr,
         const std::shared_ptr< ObservationDependentVariableCalculator > dependentVariableCalculator = nullptr,
-        const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings < TimeType > > ancilliarySettings = nullptr )
+        const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings < TimeType > > ancilliarySettings = nullptr,
+        const std::shared_ptr< ObservationNoiseGenerator > noiseGenerator = nullptr )
 {
     std::tuple< std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >,
     std::vector< TimeType >, std::vector< Eigen::VectorXd > >  simulatedObservations =
             simulateObservationsWithCheck< ObservationSize, ObservationScalarType, TimeType >(
                 observationTimes, observationModel, referenceLinkEnd, linkViabilityCalculators,
-                noiseFunction, dependentVariableCalculator, ancilliarySettings );
+                noiseFunction, dependentVariableCalculator, ancilliarySettings, noiseGenerator );
 
     return std::make_shared< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >(
                 observationModel->getObservableType( ), observationModel->getLinkEnds( ),
@@ -198,10 +281,80 @@ simulateObservationsWithCheckAndLinkEndIdOutput(
                 dependentVariableCalculator, ancilliarySettings );
 }
 
+//! Data of a single simulated, viable, observation, prior to the addition of noise and dependent variables
+template< typename ObservationScalarType = double, typename TimeType = double >
+struct ViableSimulatedObservation
+{
+    //! Observation time (at reference link end)
+    TimeType observationTime;
+
+    //! Observation value, without noise
+    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > observation;
+
+    //! States of the link ends, as computed by the observation model
+    std::vector< Eigen::Vector6d > linkEndStates;
+
+    //! Times of the link ends, as computed by the observation model
+    std::vector< double > linkEndTimes;
+};
+
+//! Function to simulate observables at given times, retaining only those that are viable
+/*!
+ *  Function to simulate observables at given times, retaining only those that are viable according to the viability
+ *  calculators. No noise or dependent variables are computed, but the link end states and times of each observation are
+ *  retained, so that these can be added afterwards (see addNoiseAndDependentVariableToObservation).
+ *  \param observationTimes Times at which observables are to be computed
+ *  \param observationModel Model used to compute observables
+ *  \param referenceLinkEnd Model Reference link end for observables
+ *  \param linkViabilityCalculators List of observation viability calculators
+ *  \param ancilliarySettings Ancilliary settings for the observation model
+ *  \return Viable observations, in the order of the input times
+ */
+template< int ObservationSize = 1, typename ObservationScalarType = double, typename TimeType = double >
+std::vector< ViableSimulatedObservation< ObservationScalarType, TimeType > > simulateViableObservations(
+        const std::vector< TimeType >& observationTimes,
+        const std::shared_ptr< observation_models::ObservationModel< ObservationSize, ObservationScalarType, TimeType > > observationModel,
+        const observation_models::LinkEndType referenceLinkEnd,
+        const std::vector< std::shared_ptr< observation_models::ObservationViabilityCalculator > >& linkViabilityCalculators,
+        const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings < TimeType > > ancilliarySettings = nullptr )
+{
+    std::vector< ViableSimulatedObservation< ObservationScalarType, TimeType > > viableObservations;
+
+    // Compute observations, and states and times of link ends, at all times
+    Eigen::Matrix< ObservationScalarType, ObservationSize, Eigen::Dynamic > observations;
+    Eigen::MatrixXd linkEndTimes, linkEndStates;
+    observationModel->computeObservationsWithLinkEndDataAtTimes(
+                observationTimes, referenceLinkEnd, observations, linkEndTimes, linkEndStates, ancilliarySettings );
+
+    ViableSimulatedObservation< ObservationScalarType, TimeType > currentObservation;
+    for( unsigned int i = 0; i < observationTimes.size( ); i++ )
+    {
+        currentObservation.observationTime = observationTimes.at( i );
+        currentObservation.observation = observations.col( i );
+        observation_models::getLinkEndDataFromBatchColumn(
+                    i, linkEndTimes, linkEndStates, currentObservation.linkEndTimes, currentObservation.linkEndStates );
+
+        if( isObservationViable( currentObservation.linkEndStates, currentObservation.linkEndTimes, linkViabilityCalculators ) )
+        {
+            viableObservations.push_back( currentObservation );
+        }
+    }
+    return viableObservations;
+}
+
+//! Function to simulate observables for per-arc observation settings, retaining only those that are viable
+/*!
+ *  Function to simulate observables for per-arc observation settings, retaining only those that are viable according to
+ *  the arc-defining constraint and the additional viability settings. No noise or dependent variables are computed
+ *  (see simulateViableObservations).
+ *  \param observationsToSimulate Settings for the observations that are to be simulated
+ *  \param observationModel Model used to compute observables
+ *  \param bodies Bodies from which the viability calculators are created
+ *  \return Viable observations, in order of increasing time
+ */
 template< typename ObservationScalarType = double, typename TimeType = double,
           int ObservationSize = 1 >
-std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >
-simulatePerArcSingleObservationSet(
+std::vector< ViableSimulatedObservation< ObservationScalarType, TimeType > > simulatePerArcViableObservations(
         const std::shared_ptr< PerArcObservationSimulationSettings< TimeType > > observationsToSimulate,
         const std::shared_ptr< observation_models::ObservationModel< ObservationSize, ObservationScalarType, TimeType > > observationModel,
         const SystemOfBodies& bodies )
@@ -297,40 +450,113 @@ simulatePerArcSingleObservationSet(
                 observationsToSimulate->getObservableType( ),
                 observationsToSimulate->additionalViabilitySettingsList_ );
 
-    std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > observations;
-    std::vector< TimeType > observationTimes;
-    std::vector< Eigen::VectorXd > observationsDependentVariables;
-
-    Eigen::VectorXd currentDependentVariable;
+    std::vector< ViableSimulatedObservation< ObservationScalarType, TimeType > > viableObservations;
+    ViableSimulatedObservation< ObservationScalarType, TimeType > currentViableObservation;
     for( unsigned int i = 0; i < simulatedObservations.size( ); i++ )
     {
         for( auto it : simulatedObservations.at( i ) )
         {
             SingleObservationData singleObservation = it.second;
-            currentObservation = std::get< 0 >( singleObservation );
             vectorOfStates = std::get< 1 >( singleObservation );
             vectorOfTimes = std::get< 2 >( singleObservation );
-            currentDependentVariable = Eigen::VectorXd::Zero( 0 );
 
             observationFeasible = isObservationViable( vectorOfStates, vectorOfTimes, additionalViabilityCalculators );
             if( observationFeasible )
             {
-                addNoiseAndDependentVariableToObservation< ObservationSize , ObservationScalarType, TimeType >(
-                            currentObservation, it.first, currentDependentVariable, vectorOfStates, vectorOfTimes,
-                            observationModel->getObservableType( ),
-                            observationsToSimulate->getObservationNoiseFunction( ),
-                            observationsToSimulate->getDependentVariableCalculator( ) );
-                observations.push_back( currentObservation );
-                observationTimes.push_back( it.first );
-                observationsDependentVariables.push_back( currentDependentVariable );
+                currentViableObservation.observationTime = it.first;
+                currentViableObservation.observation = std::get< 0 >( singleObservation );
+                currentViableObservation.linkEndStates = vectorOfStates;
+                currentViableObservation.linkEndTimes = vectorOfTimes;
+                viableObservations.push_back( currentViableObservation );
             }
         }
     }
 
+    return viableObservations;
+}
+
+//! Function to create an observation set from viable observations, adding noise and dependent variables
+/*!
+ *  Function to create an observation set from viable observations (see simulateViableObservations), adding the noise and
+ *  dependent variables defined by the observation settings in the order of the viable observations. In case an observation
+ *  time occurs multiple times, only the last observation at that time is retained.
+ *  \param observationsToSimulate Settings for the observations that were simulated
+ *  \param viableObservations Viable observations, without noise
+ *  \return Observation set with noise and dependent variables
+ */
+template< typename ObservationScalarType = double, typename TimeType = double,
+          int ObservationSize = 1 >
+std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >
+createSingleObservationSetFromViableObservations(
+        const std::shared_ptr< ObservationSimulationSettings< TimeType > > observationsToSimulate,
+        const std::vector< ViableSimulatedObservation< ObservationScalarType, TimeType > >& viableObservations )
+{
+    std::map< TimeType, std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >, Eigen::VectorXd > >
+            observationsAndDependentVariables;
+
+    // Generate noise of all viable observations at once, if possible
+    std::shared_ptr< ObservationNoiseGenerator > noiseGenerator = observationsToSimulate->getObservationNoiseGenerator( );
+    Eigen::MatrixXd noiseValues;
+    if( noiseGenerator != nullptr && viableObservations.size( ) > 0 )
+    {
+        std::vector< TimeType > viableObservationTimes;
+        for( unsigned int i = 0; i < viableObservations.size( ); i++ )
+        {
+            viableObservationTimes.push_back( viableObservations.at( i ).observationTime );
+        }
+        noiseValues = generateObservationNoise< ObservationSize, TimeType >(
+                    noiseGenerator, viableObservationTimes, observationsToSimulate->getObservableType( ) );
+    }
+
+    Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > currentObservation;
+    Eigen::VectorXd currentDependentVariable;
+    for( unsigned int i = 0; i < viableObservations.size( ); i++ )
+    {
+        currentObservation = viableObservations.at( i ).observation;
+        currentDependentVariable = Eigen::VectorXd::Zero( 0 );
+        addNoiseAndDependentVariableToObservation< ObservationSize , ObservationScalarType, TimeType >(
+                    currentObservation, viableObservations.at( i ).observationTime, currentDependentVariable,
+                    viableObservations.at( i ).linkEndStates, viableObservations.at( i ).linkEndTimes,
+                    observationsToSimulate->getObservableType( ),
+                    ( noiseGenerator == nullptr ) ? observationsToSimulate->getObservationNoiseFunction( ) : nullptr,
+                    observationsToSimulate->getDependentVariableCalculator( ) );
+        if( noiseGenerator != nullptr )
+        {
+            currentObservation += noiseValues.col( i ).template cast< ObservationScalarType >( );
+        }
+        observationsAndDependentVariables[ viableObservations.at( i ).observationTime ] =
+                std::make_pair( currentObservation, currentDependentVariable );
+    }
+
+    std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > observations;
+    std::vector< TimeType > observationTimes;
+    std::vector< Eigen::VectorXd > observationsDependentVariables;
+    for( auto it : observationsAndDependentVariables )
+    {
+        observationTimes.push_back( it.first );
+        observations.push_back( it.second.first );
+        observationsDependentVariables.push_back( it.second.second );
+    }
+
     return std::make_shared< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >(
-                observationModel->getObservableType( ), observationModel->getLinkEnds( ),
-                observations, observationTimes, referenceLinkEnd, observationsDependentVariables,
-                observationsToSimulate->getDependentVariableCalculator( ), ancilliarySettings );
+                observationsToSimulate->getObservableType( ), observationsToSimulate->getLinkEnds( ).linkEnds_,
+                observations, observationTimes, observationsToSimulate->getReferenceLinkEndType( ),
+                observationsDependentVariables, observationsToSimulate->getDependentVariableCalculator( ),
+                observationsToSimulate->getAncilliarySettings( ) );
+}
+
+template< typename ObservationScalarType = double, typename TimeType = double,
+          int ObservationSize = 1 >
+std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >
+simulatePerArcSingleObservationSet(
+        const std::shared_ptr< PerArcObservationSimulationSettings< TimeType > > observationsToSimulate,
+        const std::shared_ptr< observation_models::ObservationModel< ObservationSize, ObservationScalarType, TimeType > > observationModel,
+        const SystemOfBodies& bodies )
+{
+    return createSingleObservationSetFromViableObservations< ObservationScalarType, TimeType, ObservationSize >(
+                observationsToSimulate,
+                simulatePerArcViableObservations< ObservationScalarType, TimeType, ObservationSize >(
+                    observationsToSimulate, observationModel, bodies ) );
 }
 
 //! Function to compute observations at times defined by settings object using a given observation model
@@ -377,7 +603,8 @@ simulateSingleObservationSet(
                     observationsToSimulate->getReferenceLinkEndType( ),
                     currentObservationViabilityCalculators, noiseFunction,
                     observationsToSimulate->getDependentVariableCalculator( ),
-                    tabulatedObservationSettings->getAncilliarySettings( ) );
+                    tabulatedObservationSettings->getAncilliarySettings( ),
+                    observationsToSimulate->getObservationNoiseGenerator( ) );
 
     }
     else if( std::dynamic_pointer_cast< PerArcObservationSimulationSettings< TimeType > >( observationsToSimulate ) != nullptr )
@@ -420,6 +647,91 @@ simulateSingleObservationSet(
                 bodies );
 }
 
+//! Function to retrieve the observation times that lie inside a list of windows
+/*!
+ *  Function to retrieve the observation times that lie inside a list of windows (including the window boundaries)
+ *  \param observationTimes Observation times that are to be filtered
+ *  \param windows List of start and end times of windows, sorted and non-overlapping
+ *  \return Observation times that lie inside the windows, in the order of the input times
+ */
+template< typename TimeType = double >
+std::vector< TimeType > getObservationTimesInWindows(
+        const std::vector< TimeType >& observationTimes,
+        const std::vector< std::pair< double, double > >& windows )
+{
+    std::vector< TimeType > filteredObservationTimes;
+    for( unsigned int i = 0; i < observationTimes.size( ); i++ )
+    {
+        double currentTime = static_cast< double >( observationTimes.at( i ) );
+
+        // Find first window that does not end before current time
+        auto windowIterator = std::lower_bound(
+                    windows.begin( ), windows.end( ), currentTime,
+                    [ ]( const std::pair< double, double >& window, const double time ){ return window.second < time; } );
+        if( windowIterator != windows.end( ) && windowIterator->first <= currentTime )
+        {
+            filteredObservationTimes.push_back( observationTimes.at( i ) );
+        }
+    }
+    return filteredObservationTimes;
+}
+
+//! Function to remove observation times at which the observations are geometrically not viable from simulation settings
+/*!
+ *  Function to remove observation times at which the observations are geometrically not viable from the simulation
+ *  settings, prior to the simulation of the observations. For each tabulated simulation settings object with viability
+ *  settings, the windows in which the observations may be viable are computed on a coarse grid, using geometric link
+ *  end states (see computeGeometricObservationViabilityWindows), and observation times outside of these windows are
+ *  removed. This prevents the full observations (including light-time solutions) from being computed at times that are
+ *  subsequently rejected by the viability calculators. Since the windows are extended by a margin that accounts for the
+ *  light time, the subsequently simulated observations are identical to those obtained without the pre-screening,
+ *  provided that no viability window is shorter than the coarse time step. Other simulation settings are not modified.
+ *  \param observationsToSimulate List of observation simulation settings, modified by this function
+ *  \param bodies Map of body objects that constitutes the environment
+ *  \param coarseTimeStep Step of the grid at which viability is evaluated
+ *  \param boundaryTolerance Tolerance to which the boundaries of the windows are refined
+ */
+template< typename TimeType = double >
+void prescreenObservationSimulationTimes(
+        const std::vector< std::shared_ptr< ObservationSimulationSettings< TimeType > > >& observationsToSimulate,
+        const SystemOfBodies& bodies,
+        const double coarseTimeStep,
+        const double boundaryTolerance = 1.0 )
+{
+    for( unsigned int i = 0; i < observationsToSimulate.size( ); i++ )
+    {
+        std::shared_ptr< TabulatedObservationSimulationSettings< TimeType > > tabulatedObservationSettings =
+                std::dynamic_pointer_cast< TabulatedObservationSimulationSettings< TimeType > >( observationsToSimulate.at( i ) );
+        if( tabulatedObservationSettings == nullptr || tabulatedObservationSettings->simulationTimes_.size( ) == 0 )
+        {
+            continue;
+        }
+
+        std::vector< std::shared_ptr< observation_models::ObservationViabilityCalculator > > viabilityCalculators =
+                observation_models::createObservationViabilityCalculators(
+                    bodies,
+                    tabulatedObservationSettings->getLinkEnds( ).linkEnds_,
+                    tabulatedObservationSettings->getObservableType( ),
+                    tabulatedObservationSettings->getViabilitySettingsList( ) );
+        if( viabilityCalculators.size( ) == 0 )
+        {
+            continue;
+        }
+
+        // Compute viability windows over full interval of observation times
+        std::vector< TimeType >& simulationTimes = tabulatedObservationSettings->simulationTimes_;
+        std::vector< std::pair< double, double > > viabilityWindows =
+                observation_models::computeGeometricObservationViabilityWindows(
+                    bodies, tabulatedObservationSettings->getLinkEnds( ).linkEnds_,
+                    tabulatedObservationSettings->getObservableType( ), viabilityCalculators,
+                    static_cast< double >( *std::min_element( simulationTimes.begin( ), simulationTimes.end( ) ) ),
+                    static_cast< double >( *std::max_element( simulationTimes.begin( ), simulationTimes.end( ) ) ),
+                    coarseTimeStep, boundaryTolerance );
+
+        simulationTimes = getObservationTimesInWindows( simulationTimes, viabilityWindows );
+    }
+}
+
 //! Function to simulate observations from set of observables and link and sets
 /*!
  *  Function to simulate observations from set of observables, link ends and observation time settings
@@ -437,9 +749,14 @@ std::shared_ptr< observation_models::ObservationCollection< ObservationScalarTyp
         const std::vector< std::shared_ptr< observation_models::ObservationSimulatorBase< ObservationScalarType, TimeType > > >& observationSimulators,
         const SystemOfBodies bodies )
 {
+    TUDAT_TRACE_SCOPE( "simulate_observations", "observation" );
+
     // Declare return map.
     typename observation_models::ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets sortedObservations;
 
+    // Solve light time of each link only once per epoch for all observables
+    observation_models::setLightTimeSolutionCaching( observationSimulators, true );
+
     // Iterate over all observables.
     for( unsigned int i = 0; i < observationsToSimulate.size( ); i++ )
     {
@@ -505,12 +822,399 @@ std::shared_ptr< observation_models::ObservationCollection< ObservationScalarTyp
 
         }
     }
+    observation_models::setLightTimeSolutionCaching( observationSimulators, false );
+
     std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationCollection =
             std::make_shared< observation_models::ObservationCollection< ObservationScalarType, TimeType > >( sortedObservations );
 
     return observationCollection;
 }
 
+//! Function to simulate observations for single observable and single set of link ends, in chunks of epochs
+/*!
+ *  Function to simulate observations for single observable and single set of link ends, in chunks of epochs. For
+ *  tabulated settings, the observation times are divided into chunks of consecutive epochs, and the observations of each
+ *  chunk are passed to the sink as soon as they are simulated. Per-arc settings (for which the arcs are determined
+ *  sequentially) are simulated as a single chunk. Since the epochs are processed in the same order, the concatenated
+ *  chunks are identical to the observation set simulated by simulateSingleObservationSet. Empty chunks are not passed
+ *  to the sink.
+ *  \param observationsToSimulate Object that computes/defines settings for observation times/reference link end
+ *  \param observationSimulator Observation simulator for observable for which observations are to be calculated.
+ *  \param bodies Map of body objects that constitutes the environment
+ *  \param maximumNumberOfEpochsPerChunk Maximum number of epochs of tabulated settings that is simulated in a chunk
+ *  \param observationSetSink Function that is called with the observations of each chunk
+ */
+template< typename ObservationScalarType = double, typename TimeType = double, int ObservationSize = 1 >
+void simulateSingleObservationSetInChunks(
+        const std::shared_ptr< ObservationSimulationSettings< TimeType > > observationsToSimulate,
+        const std::shared_ptr< observation_models::ObservationSimulator< ObservationSize, ObservationScalarType, TimeType > > observationSimulator,
+        const SystemOfBodies& bodies,
+        const int maximumNumberOfEpochsPerChunk,
+        const std::function< void( const std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > ) >&
+        observationSetSink )
+{
+    if( observationSimulator == nullptr )
+    {
+        throw std::runtime_error( "Error when simulating single observation set, Observation simulator is nullptr" );
+    }
+
+    std::shared_ptr< observation_models::ObservationModel< ObservationSize, ObservationScalarType, TimeType > > observationModel =
+            observationSimulator->getObservationModel( observationsToSimulate->getLinkEnds( ).linkEnds_ );
+
+    std::shared_ptr< TabulatedObservationSimulationSettings< TimeType > > tabulatedObservationSettings =
+            std::dynamic_pointer_cast< TabulatedObservationSimulationSettings< TimeType > >( observationsToSimulate );
+    if( tabulatedObservationSettings != nullptr )
+    {
+        std::vector< std::shared_ptr< observation_models::ObservationViabilityCalculator > > currentObservationViabilityCalculators =
+                observation_models::createObservationViabilityCalculators(
+                    bodies,
+                    observationsToSimulate->getLinkEnds( ).linkEnds_,
+                    observationsToSimulate->getObservableType( ),
+                    observationsToSimulate->getViabilitySettingsList( ) );
+
+        // Simulate and output observations chunk by chunk
+        const std::vector< TimeType >& simulationTimes = tabulatedObservationSettings->simulationTimes_;
+        for( unsigned int firstTimeIndex = 0; firstTimeIndex < simulationTimes.size( );
+             firstTimeIndex += maximumNumberOfEpochsPerChunk )
+        {
+            const unsigned int endTimeIndex = std::min(
+                        firstTimeIndex + static_cast< unsigned int >( maximumNumberOfEpochsPerChunk ),
+                        static_cast< unsigned int >( simulationTimes.size( ) ) );
+            std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > simulatedObservations =
+                    simulateObservationsWithCheckAndLinkEndIdOutput< ObservationSize, ObservationScalarType, TimeType >(
+                        std::vector< TimeType >( simulationTimes.begin( ) + firstTimeIndex,
+                                                 simulationTimes.begin( ) + endTimeIndex ),
+                        observationModel, observationsToSimulate->getReferenceLinkEndType( ),
+                        currentObservationViabilityCalculators, observationsToSimulate->getObservationNoiseFunction( ),
+                        observationsToSimulate->getDependentVariableCalculator( ),
+                        tabulatedObservationSettings->getAncilliarySettings( ),
+                        observationsToSimulate->getObservationNoiseGenerator( ) );
+            if( simulatedObservations->getNumberOfObservables( ) > 0 )
+            {
+                observationSetSink( simulatedObservations );
+            }
+        }
+    }
+    else
+    {
+        std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > simulatedObservations =
+                simulateSingleObservationSet< ObservationScalarType, TimeType, ObservationSize >(
+                    observationsToSimulate, observationModel, bodies );
+        if( simulatedObservations != nullptr && simulatedObservations->getNumberOfObservables( ) > 0 )
+        {
+            observationSetSink( simulatedObservations );
+        }
+    }
+}
+
+//! Function to simulate observations from set of observables and link and sets, passing the results to a sink
+/*!
+ *  Function to simulate observations from set of observables, link ends and observation time settings, passing the
+ *  observations to a sink as soon as each chunk of epochs of each settings object is simulated (see
+ *  simulateSingleObservationSetInChunks), instead of collecting all observations in memory. This allows (for instance)
+ *  observations of long campaigns to be written to disk during the simulation (see simulateObservationsToArchive).
+ *  \param observationsToSimulate List of observation time settings per link end set per observable type.
+ *  \param observationSimulators List of Observation simulators per link end set per observable type.
+ *  \param bodies Map of body objects that constitutes the environment
+ *  \param observationSetSink Function that is called with the observations of each chunk, in the order of the settings
+ *  and epochs
+ *  \param maximumNumberOfEpochsPerChunk Maximum number of epochs of tabulated settings that is simulated in a chunk
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+void simulateObservationsToSink(
+        const std::vector< std::shared_ptr< ObservationSimulationSettings< TimeType > > >& observationsToSimulate,
+        const std::vector< std::shared_ptr< observation_models::ObservationSimulatorBase< ObservationScalarType, TimeType > > >& observationSimulators,
+        const SystemOfBodies& bodies,
+        const std::function< void( const std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > ) >&
+        observationSetSink,
+        const int maximumNumberOfEpochsPerChunk = 10000 )
+{
+    if( maximumNumberOfEpochsPerChunk < 1 )
+    {
+        throw std::runtime_error( "Error when simulating observations, maximum number of epochs per chunk must be positive" );
+    }
+
+    // Solve light time of each link only once per epoch for all observables
+    observation_models::setLightTimeSolutionCaching( observationSimulators, true );
+
+    for( unsigned int i = 0; i < observationsToSimulate.size( ); i++ )
+    {
+        observation_models::ObservableType observableType = observationsToSimulate.at( i )->getObservableType( );
+        int observationSize = observation_models::getObservableSize( observableType );
+        switch( observationSize )
+        {
+        case 1:
+            simulateSingleObservationSetInChunks< ObservationScalarType, TimeType, 1 >(
+                        observationsToSimulate.at( i ),
+                        observation_models::getObservationSimulatorOfType< 1 >( observationSimulators, observableType ),
+                        bodies, maximumNumberOfEpochsPerChunk, observationSetSink );
+            break;
+        case 2:
+            simulateSingleObservationSetInChunks< ObservationScalarType, TimeType, 2 >(
+                        observationsToSimulate.at( i ),
+                        observation_models::getObservationSimulatorOfType< 2 >( observationSimulators, observableType ),
+                        bodies, maximumNumberOfEpochsPerChunk, observationSetSink );
+            break;
+        case 3:
+            simulateSingleObservationSetInChunks< ObservationScalarType, TimeType, 3 >(
+                        observationsToSimulate.at( i ),
+                        observation_models::getObservationSimulatorOfType< 3 >( observationSimulators, observableType ),
+                        bodies, maximumNumberOfEpochsPerChunk, observationSetSink );
+            break;
+        default:
+            throw std::runtime_error( "Error, simulation of observations not yet implemented for size " +
+                                      std::to_string( observationSize ) );
+        }
+    }
+    observation_models::setLightTimeSolutionCaching( observationSimulators, false );
+}
+
+//! Function to simulate observations from set of observables and link and sets, writing them to a binary archive
+/*!
+ *  Function to simulate observations from set of observables, link ends and observation time settings, writing the
+ *  observations to a binary observation archive (see ObservationArchiveWriter) as soon as each chunk of epochs is
+ *  simulated (see simulateObservationsToSink). The memory use is therefore bounded by the size of a single chunk, and the
+ *  chunks that were written remain available if the simulation is interrupted. The archive can be read with
+ *  loadObservationCollectionFromArchive; each chunk is stored as a separate record (and is therefore loaded as a
+ *  separate observation set).
+ *  \param observationsToSimulate List of observation time settings per link end set per observable type.
+ *  \param observationSimulators List of Observation simulators per link end set per observable type.
+ *  \param bodies Map of body objects that constitutes the environment
+ *  \param fileName Name (including path) of the archive
+ *  \param maximumNumberOfEpochsPerChunk Maximum number of epochs of tabulated settings that is simulated in a chunk
+ *  \param appendToFile Boolean denoting whether the observations are to be appended to the archive (if it exists). If
+ *  false, any existing file is overwritten.
+ *  \return Number of observations that was written to the archive
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::size_t simulateObservationsToArchive(
+        const std::vector< std::shared_ptr< ObservationSimulationSettings< TimeType > > >& observationsToSimulate,
+        const std::vector< std::shared_ptr< observation_models::ObservationSimulatorBase< ObservationScalarType, TimeType > > >& observationSimulators,
+        const SystemOfBodies& bodies,
+        const std::string& fileName,
+        const int maximumNumberOfEpochsPerChunk = 10000,
+        const bool appendToFile = false )
+{
+    observation_models::ObservationArchiveWriter archiveWriter( fileName, appendToFile );
+    simulateObservationsToSink< ObservationScalarType, TimeType >(
+                observationsToSimulate, observationSimulators, bodies,
+                [ & ]( const std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > observationSet )
+    {
+        archiveWriter.writeObservationSet( observationSet );
+    }, maximumNumberOfEpochsPerChunk );
+    return archiveWriter.getNumberOfWrittenObservations( );
+}
+
+//! Function to simulate the viable observations of a subset of the epochs of a single observation settings object
+/*!
+ *  Function to simulate the viable observations of a subset of the epochs of a single observation settings object (see
+ *  simulateViableObservations), using observation simulators and bodies that may be specific to the current thread. For
+ *  per-arc settings, the subset must contain all epochs, as the arcs are determined sequentially.
+ *  \param observationsToSimulate Settings for the observations that are to be simulated
+ *  \param observationSimulators List of observation simulators from which the observation model is retrieved
+ *  \param bodies Bodies from which the viability calculators are created
+ *  \param firstTimeIndex Index of first epoch of tabulated settings that is to be simulated
+ *  \param numberOfTimes Number of epochs of tabulated settings that are to be simulated
+ *  \return Viable observations
+ */
+template< typename ObservationScalarType = double, typename TimeType = double, int ObservationSize = 1 >
+std::vector< ViableSimulatedObservation< ObservationScalarType, TimeType > > simulateViableObservationsOfSettings(
+        const std::shared_ptr< ObservationSimulationSettings< TimeType > > observationsToSimulate,
+        const std::vector< std::shared_ptr< observation_models::ObservationSimulatorBase< ObservationScalarType, TimeType > > >& observationSimulators,
+        const SystemOfBodies& bodies,
+        const int firstTimeIndex,
+        const int numberOfTimes )
+{
+    std::shared_ptr< observation_models::ObservationSimulator< ObservationSize, ObservationScalarType, TimeType > > observationSimulator =
+            observation_models::getObservationSimulatorOfType< ObservationSize >(
+                observationSimulators, observationsToSimulate->getObservableType( ) );
+    if( observationSimulator == nullptr )
+    {
+        throw std::runtime_error( "Error when simulating observation: dynamic cast to size " +
+                                  std::to_string( ObservationSize ) + " is nullptr" );
+    }
+    std::shared_ptr< observation_models::ObservationModel< ObservationSize, ObservationScalarType, TimeType > > observationModel =
+            observationSimulator->getObservationModel( observationsToSimulate->getLinkEnds( ).linkEnds_ );
+
+    std::vector< ViableSimulatedObservation< ObservationScalarType, TimeType > > viableObservations;
+    if( std::dynamic_pointer_cast< TabulatedObservationSimulationSettings< TimeType > >( observationsToSimulate ) != nullptr )
+    {
+        std::shared_ptr< TabulatedObservationSimulationSettings< TimeType > > tabulatedObservationSettings =
+                std::dynamic_pointer_cast< TabulatedObservationSimulationSettings< TimeType > >( observationsToSimulate );
+
+        std::vector< std::shared_ptr< observation_models::ObservationViabilityCalculator > > currentObservationViabilityCalculators =
+                observation_models::createObservationViabilityCalculators(
+                    bodies,
+                    observationsToSimulate->getLinkEnds( ).linkEnds_,
+                    observationsToSimulate->getObservableType( ),
+                    observationsToSimulate->getViabilitySettingsList( ) );
+
+        viableObservations = simulateViableObservations< ObservationSize, ObservationScalarType, TimeType >(
+                    std::vector< TimeType >( tabulatedObservationSettings->simulationTimes_.begin( ) + firstTimeIndex,
+                                             tabulatedObservationSettings->simulationTimes_.begin( ) + firstTimeIndex + numberOfTimes ),
+                    observationModel, observationsToSimulate->getReferenceLinkEndType( ),
+                    currentObservationViabilityCalculators, tabulatedObservationSettings->getAncilliarySettings( ) );
+    }
+    else if( std::dynamic_pointer_cast< PerArcObservationSimulationSettings< TimeType > >( observationsToSimulate ) != nullptr )
+    {
+        viableObservations = simulatePerArcViableObservations< ObservationScalarType, TimeType, ObservationSize >(
+                    std::dynamic_pointer_cast< PerArcObservationSimulationSettings< TimeType > >( observationsToSimulate ),
+                    observationModel, bodies );
+    }
+    return viableObservations;
+}
+
+//! Function to simulate observations from set of observables and link and sets, distributed over a number of threads
+/*!
+ *  Function to simulate observations from set of observables, link ends and observation time settings, distributed over a
+ *  number of worker threads. To simulate observations concurrently, each worker requires its own SystemOfBodies and its
+ *  own observation simulators (created from the bodies of the same worker), so that no light-time calculators, viability
+ *  calculators or environment models are shared between threads. The observation settings are divided into tasks:
+ *  tabulated settings are split into chunks of consecutive epochs, while per-arc settings (for which the arcs are
+ *  determined sequentially) form a single task. Task t is executed by worker ( t mod number of workers ).
+ *  The noise and dependent variables are added afterwards in the calling thread, in the order of the settings and
+ *  epochs, using the noise functions and dependent variable calculators of the settings. As a result, the returned
+ *  observation collection is identical to that of simulateObservations, and independent of the number of workers.
+ *  \param observationsToSimulate List of observation time settings per link end set per observable type.
+ *  \param workerObservationSimulators List of observation simulators, one entry per worker thread.
+ *  \param workerBodies List of bodies, one entry per worker thread. Entries must not share any Body objects.
+ *  \param maximumNumberOfEpochsPerTask Maximum number of epochs of tabulated settings that is simulated in a single task
+ *  \return Simulated observation values and associated times for requested observable types and link end sets.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > simulateObservationsInParallel(
+        const std::vector< std::shared_ptr< ObservationSimulationSettings< TimeType > > >& observationsToSimulate,
+        const std::vector< std::vector< std::shared_ptr< observation_models::ObservationSimulatorBase< ObservationScalarType, TimeType > > > >&
+        workerObservationSimulators,
+        const std::vector< SystemOfBodies >& workerBodies,
+        const int maximumNumberOfEpochsPerTask = 1000 )
+{
+    if( workerBodies.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when simulating observations in parallel, no bodies provided" );
+    }
+    else if( workerBodies.size( ) != workerObservationSimulators.size( ) )
+    {
+        throw std::runtime_error( "Error when simulating observations in parallel, number of bodies (" +
+                                  std::to_string( workerBodies.size( ) ) + ") and observation simulator lists (" +
+                                  std::to_string( workerObservationSimulators.size( ) ) + ") is not equal" );
+    }
+    else if( maximumNumberOfEpochsPerTask < 1 )
+    {
+        throw std::runtime_error( "Error when simulating observations in parallel, maximum number of epochs per task must be positive" );
+    }
+
+    for( unsigned int i = 0; i < workerBodies.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < i; j++ )
+        {
+            if( doSystemsOfBodiesShareBodies( workerBodies.at( i ), workerBodies.at( j ) ) )
+            {
+                throw std::runtime_error( "Error when simulating observations in parallel, bodies of worker " +
+                                          std::to_string( j ) + " and " + std::to_string( i ) + " are not independent" );
+            }
+        }
+    }
+
+    // Define tasks: settings index, first epoch index and number of epochs
+    std::vector< std::tuple< int, int, int > > tasks;
+    for( unsigned int i = 0; i < observationsToSimulate.size( ); i++ )
+    {
+        std::shared_ptr< TabulatedObservationSimulationSettings< TimeType > > tabulatedObservationSettings =
+                std::dynamic_pointer_cast< TabulatedObservationSimulationSettings< TimeType > >( observationsToSimulate.at( i ) );
+        if( tabulatedObservationSettings != nullptr )
+        {
+            int numberOfTimes = tabulatedObservationSettings->simulationTimes_.size( );
+            for( int j = 0; j < numberOfTimes; j += maximumNumberOfEpochsPerTask )
+            {
+                tasks.push_back( std::make_tuple( i, j, std::min( maximumNumberOfEpochsPerTask, numberOfTimes - j ) ) );
+            }
+        }
+        else
+        {
+            tasks.push_back( std::make_tuple( i, 0, 0 ) );
+        }
+    }
+
+    // Simulate viable observations of all tasks
+    int numberOfTasks = tasks.size( );
+    int numberOfWorkers = workerBodies.size( );
+    std::vector< std::vector< ViableSimulatedObservation< ObservationScalarType, TimeType > > > taskObservations( numberOfTasks );
+    utilities::executeParallelTasks(
+                numberOfWorkers, [ & ]( const int workerIndex )
+    {
+        observation_models::setLightTimeSolutionCaching( workerObservationSimulators.at( workerIndex ), true );
+        for( int taskIndex = workerIndex; taskIndex < numberOfTasks; taskIndex += numberOfWorkers )
+        {
+            std::shared_ptr< ObservationSimulationSettings< TimeType > > currentSettings =
+                    observationsToSimulate.at( std::get< 0 >( tasks.at( taskIndex ) ) );
+            int observationSize = observation_models::getObservableSize( currentSettings->getObservableType( ) );
+            switch( observationSize )
+            {
+            case 1:
+                taskObservations[ taskIndex ] = simulateViableObservationsOfSettings< ObservationScalarType, TimeType, 1 >(
+                            currentSettings, workerObservationSimulators.at( workerIndex ), workerBodies.at( workerIndex ),
+                            std::get< 1 >( tasks.at( taskIndex ) ), std::get< 2 >( tasks.at( taskIndex ) ) );
+                break;
+            case 2:
+                taskObservations[ taskIndex ] = simulateViableObservationsOfSettings< ObservationScalarType, TimeType, 2 >(
+                            currentSettings, workerObservationSimulators.at( workerIndex ), workerBodies.at( workerIndex ),
+                            std::get< 1 >( tasks.at( taskIndex ) ), std::get< 2 >( tasks.at( taskIndex ) ) );
+                break;
+            case 3:
+                taskObservations[ taskIndex ] = simulateViableObservationsOfSettings< ObservationScalarType, TimeType, 3 >(
+                            currentSettings, workerObservationSimulators.at( workerIndex ), workerBodies.at( workerIndex ),
+                            std::get< 1 >( tasks.at( taskIndex ) ), std::get< 2 >( tasks.at( taskIndex ) ) );
+                break;
+            default:
+                throw std::runtime_error( "Error, simulation of observations not yet implemented for size " +
+                                          std::to_string( observationSize ) );
+            }
+        }
+        observation_models::setLightTimeSolutionCaching( workerObservationSimulators.at( workerIndex ), false );
+    }, numberOfWorkers );
+
+    // Merge tasks of each settings object (in order), and add noise and dependent variables
+    typename observation_models::ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets sortedObservations;
+    int currentTaskIndex = 0;
+    for( unsigned int i = 0; i < observationsToSimulate.size( ); i++ )
+    {
+        std::vector< ViableSimulatedObservation< ObservationScalarType, TimeType > > viableObservations;
+        while( currentTaskIndex < numberOfTasks && std::get< 0 >( tasks.at( currentTaskIndex ) ) == static_cast< int >( i ) )
+        {
+            viableObservations.insert( viableObservations.end( ), taskObservations.at( currentTaskIndex ).begin( ),
+                                       taskObservations.at( currentTaskIndex ).end( ) );
+            currentTaskIndex++;
+        }
+
+        observation_models::ObservableType observableType = observationsToSimulate.at( i )->getObservableType( );
+        observation_models::LinkEnds linkEnds = observationsToSimulate.at( i )->getLinkEnds( ).linkEnds_;
+        switch( observation_models::getObservableSize( observableType ) )
+        {
+        case 1:
+            sortedObservations[ observableType ][ linkEnds ].push_back(
+                        createSingleObservationSetFromViableObservations< ObservationScalarType, TimeType, 1 >(
+                            observationsToSimulate.at( i ), viableObservations ) );
+            break;
+        case 2:
+            sortedObservations[ observableType ][ linkEnds ].push_back(
+                        createSingleObservationSetFromViableObservations< ObservationScalarType, TimeType, 2 >(
+                            observationsToSimulate.at( i ), viableObservations ) );
+            break;
+        case 3:
+            sortedObservations[ observableType ][ linkEnds ].push_back(
+                        createSingleObservationSetFromViableObservations< ObservationScalarType, TimeType, 3 >(
+                            observationsToSimulate.at( i ), viableObservations ) );
+            break;
+        default:
+            throw std::runtime_error( "Error, simulation of observations not yet implemented for size " +
+                                      std::to_string( observation_models::getObservableSize( observableType ) ) );
+        }
+    }
+
+    return std::make_shared< observation_models::ObservationCollection< ObservationScalarType, TimeType > >( sortedObservations );
+}
+
 template< typename ObservationScalarType = double, typename TimeType = double >
 std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > setExistingObservations(
         const std::map< observation_models::ObservableType, std::pair< observation_models::LinkEnds,
@@ -15,11 +15,15 @@
 #include <boost/tuple/tuple.hpp>
 #include <boost/tuple/tuple_comparison.hpp>
 #include <boost/tuple/tuple_io.hpp>
+#include <mutex>
 
+#include "tudat/basics/parallelization.h"
+#include "tudat/basics/tracing.h"
 #include "tudat/basics/utilities.h"
 
 #include "tudat/astro/basic_astro/accelerationModel.h"
 #include "tudat/math/interpolators/interpolator.h"
+#include "tudat/math/interpolators/lagrangeInterpolator.h"
 #include "tudat/math/basic/linearAlgebra.h"
 
 #include "tudat/astro/orbit_determination/estimatable_parameters/estimatableParameter.h"
@@ -36,6 +40,211 @@ namespace propagators
 {
 
 
+//! Settings for the retention of the numerical solution of the variational equations
+/*!
+ *  Settings for the retention of the numerical solution of the variational equations. By default, the state transition
+ *  and sensitivity matrices are retained (and interpolated) at all epochs at which the propagation results are produced.
+ *  If the epochs at which the matrices are needed (typically the observation times) are known in advance, only the data
+ *  points that are needed to interpolate the matrices at (or within a margin of) these epochs can be retained. The matrices
+ *  interpolated at these epochs are then identical to those obtained from the full solution, but the matrices interpolated
+ *  at any other epoch are not accurate. The margin should be chosen such that it covers the offset between the retained
+ *  epochs and the times at which the matrices are evaluated (e.g. the light time between the link ends of an observation).
+ *
+ *  Optionally, the retained matrices are stored in single precision, halving their memory. The interpolated matrices then
+ *  have a relative error of the order of 1.0E-7 (the machine precision of a float). As the matrices only determine the
+ *  partials of the observations, this affects the convergence of the estimation, and the resulting covariance at this
+ *  level, but not the residuals (which are computed from the double-precision propagation of the dynamics).
+ */
+class VariationalEquationsRetentionSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param retainedEpochs Epochs at which the state transition and sensitivity matrices are to be retained (all epochs
+     *  are retained if empty)
+     *  \param retainedEpochMargin Margin around the retained epochs within which the matrices are to be retained
+     *  \param useSinglePrecision Boolean denoting whether the retained matrices are to be stored in single precision
+     */
+    VariationalEquationsRetentionSettings(
+            const std::vector< double >& retainedEpochs = std::vector< double >( ),
+            const double retainedEpochMargin = 0.0,
+            const bool useSinglePrecision = false ):
+        retainedEpochs_( retainedEpochs ), retainedEpochMargin_( retainedEpochMargin ),
+        useSinglePrecision_( useSinglePrecision )
+    {
+        if( retainedEpochMargin_ < 0.0 )
+        {
+            throw std::runtime_error( "Error when creating variational equations retention settings, margin is negative" );
+        }
+        std::sort( retainedEpochs_.begin( ), retainedEpochs_.end( ) );
+    }
+
+    //! Function to retrieve the epochs at which the matrices are to be retained (sorted in ascending order)
+    /*!
+     *  Function to retrieve the epochs at which the matrices are to be retained (sorted in ascending order)
+     *  \return Epochs at which the matrices are to be retained
+     */
+    const std::vector< double >& getRetainedEpochs( ) const
+    {
+        return retainedEpochs_;
+    }
+
+    //! Function to retrieve the margin around the retained epochs within which the matrices are to be retained
+    /*!
+     *  Function to retrieve the margin around the retained epochs within which the matrices are to be retained
+     *  \return Margin around the retained epochs within which the matrices are to be retained
+     */
+    double getRetainedEpochMargin( ) const
+    {
+        return retainedEpochMargin_;
+    }
+
+    //! Function to retrieve whether the retained matrices are to be stored in single precision
+    /*!
+     *  Function to retrieve whether the retained matrices are to be stored in single precision
+     *  \return Boolean denoting whether the retained matrices are to be stored in single precision
+     */
+    bool useSinglePrecision( ) const
+    {
+        return useSinglePrecision_;
+    }
+
+private:
+
+    //! Epochs at which the matrices are to be retained (sorted in ascending order)
+    std::vector< double > retainedEpochs_;
+
+    //! Margin around the retained epochs within which the matrices are to be retained
+    double retainedEpochMargin_;
+
+    //! Boolean denoting whether the retained matrices are to be stored in single precision
+    bool useSinglePrecision_;
+};
+
+//! Lagrange interpolator of a matrix, of which the data points are stored in single precision
+/*!
+ *  Lagrange interpolator of a matrix, of which the data points (and interpolation weights) are stored in single precision,
+ *  halving the memory of the data points w.r.t. a double-precision interpolator. The interpolated matrices are returned in
+ *  double precision, with a relative error of the order of the machine precision of a float.
+ */
+class SinglePrecisionMatrixInterpolator: public interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd >
+{
+public:
+
+    using interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd >::interpolate;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param dataMap Map of (double-precision) data points, of which single-precision copies are stored
+     *  \param numberOfStages Number of data points used by the Lagrange interpolation
+     */
+    SinglePrecisionMatrixInterpolator(
+            const std::map< double, Eigen::MatrixXd >& dataMap,
+            const int numberOfStages )
+    {
+        std::map< double, Eigen::MatrixXf > singlePrecisionDataMap;
+        for( auto dataIterator : dataMap )
+        {
+            singlePrecisionDataMap[ dataIterator.first ] = dataIterator.second.cast< float >( );
+        }
+        singlePrecisionInterpolator_ = std::make_shared< interpolators::LagrangeInterpolator< double, Eigen::MatrixXf, float > >(
+                    singlePrecisionDataMap, numberOfStages );
+    }
+
+    //! Function to interpolate the matrix at a given time
+    /*!
+     *  Function to interpolate the matrix at a given time
+     *  \param targetIndependentVariableValue Time at which the matrix is to be interpolated
+     *  \return Interpolated matrix
+     */
+    Eigen::MatrixXd interpolate( const double targetIndependentVariableValue )
+    {
+        return singlePrecisionInterpolator_->interpolate( targetIndependentVariableValue ).cast< double >( );
+    }
+
+    //! Function to interpolate the matrix at a given time, using a given look-up scheme
+    /*!
+     *  Function to interpolate the matrix at a given time, using a given look-up scheme
+     *  \param targetIndependentVariableValue Time at which the matrix is to be interpolated
+     *  \param lookUpScheme Look-up scheme (created from the times of the data points) used to find the nearest data point
+     *  \return Interpolated matrix
+     */
+    Eigen::MatrixXd interpolate( const double targetIndependentVariableValue,
+                                 interpolators::LookUpScheme< double >& lookUpScheme )
+    {
+        return singlePrecisionInterpolator_->interpolate( targetIndependentVariableValue, lookUpScheme ).cast< double >( );
+    }
+
+    //! Function to retrieve the times of the data points
+    /*!
+     *  Function to retrieve the times of the data points
+     *  \return Times of the data points
+     */
+    std::vector< double > getIndependentValues( )
+    {
+        return singlePrecisionInterpolator_->getIndependentValues( );
+    }
+
+    //! Function to retrieve (double-precision copies of) the matrices at the data points
+    /*!
+     *  Function to retrieve (double-precision copies of) the matrices at the data points
+     *  \return Matrices at the data points
+     */
+    std::vector< Eigen::MatrixXd > getDependentValues( )
+    {
+        std::vector< Eigen::MatrixXd > dependentValues;
+        for( const Eigen::MatrixXf& singlePrecisionValue : singlePrecisionInterpolator_->getDependentValues( ) )
+        {
+            dependentValues.push_back( singlePrecisionValue.cast< double >( ) );
+        }
+        return dependentValues;
+    }
+
+    //! Function to retrieve the heap memory held by the (single-precision) interpolator
+    /*!
+     *  Function to retrieve the heap memory held by the (single-precision) interpolator
+     *  \return Heap memory held by the interpolator
+     */
+    std::size_t getHeapMemorySize( ) const
+    {
+        return singlePrecisionInterpolator_->getHeapMemorySize( );
+    }
+
+    //! Function to retrieve the type of the interpolator
+    /*!
+     *  Function to retrieve the type of the interpolator
+     *  \return Type of the interpolator
+     */
+    interpolators::InterpolatorTypes getInterpolatorType( )
+    {
+        return interpolators::lagrange_interpolator;
+    }
+
+private:
+
+    //! Lagrange interpolator of the single-precision data points
+    std::shared_ptr< interpolators::LagrangeInterpolator< double, Eigen::MatrixXf, float > > singlePrecisionInterpolator_;
+};
+
+//! Function to determine which entries of the numerical solution of the variational equations are to be retained
+/*!
+ *  Function to determine which entries of the numerical solution of the variational equations are to be retained, given
+ *  the retention settings. For each retained epoch, all data points used to interpolate the matrices within the margin
+ *  around the epoch are retained. The data points at the start and end of the solution, which are used by the boundary
+ *  interpolators of the Lagrange interpolator, are always retained.
+ *  \param solutionEpochs Epochs of the numerical solution (sorted in ascending order)
+ *  \param retentionSettings Settings for the retention of the solution (all entries are retained if nullptr)
+ *  \param numberOfInterpolationPoints Number of data points used by the Lagrange interpolation of the solution
+ *  \return List of booleans denoting, for each entry of solutionEpochs, whether it is to be retained
+ */
+std::vector< bool > getRetainedVariationalSolutionEntries(
+        const std::vector< double >& solutionEpochs,
+        const std::shared_ptr< VariationalEquationsRetentionSettings > retentionSettings,
+        const int numberOfInterpolationPoints );
+
 //! Base class to manage and execute the numerical integration of equations of motion and variational equations.
 /*!
  *  Base class to manage and execute the numerical integration of equations of motion and variational equations.
@@ -70,6 +279,7 @@ public:
         bodies_( bodies ),
         stateTransitionMatrixSize_( parametersToEstimate_->getInitialDynamicalStateParameterSize( ) ),
         parameterVectorSize_( parametersToEstimate_->getParameterSetSize( ) ),
+        propagatedParameterVectorSize_( parameterVectorSize_ ),
         clearNumericalSolution_( clearNumericalSolution )
     { }
 
@@ -138,6 +348,28 @@ public:
 
     virtual std::shared_ptr< SimulationResults< StateScalarType, TimeType > > getVariationalPropagationResults( ) = 0;
 
+    //! Function to set the settings for the retention of the numerical solution of the variational equations
+    /*!
+     *  Function to set the settings for the retention of the numerical solution of the variational equations, which are
+     *  used from the next integration of the variational equations onwards.
+     *  \param retentionSettings Settings for the retention of the solution (all epochs retained in double precision if
+     *  nullptr)
+     */
+    virtual void setVariationalSolutionRetention(
+            const std::shared_ptr< VariationalEquationsRetentionSettings > retentionSettings )
+    {
+        retentionSettings_ = retentionSettings;
+    }
+
+    //! Function to retrieve the settings for the retention of the numerical solution of the variational equations
+    /*!
+     *  Function to retrieve the settings for the retention of the numerical solution of the variational equations
+     *  \return Settings for the retention of the solution (nullptr if all epochs are retained in double precision)
+     */
+    std::shared_ptr< VariationalEquationsRetentionSettings > getVariationalSolutionRetention( )
+    {
+        return retentionSettings_;
+    }
 
 protected:
 
@@ -159,13 +391,13 @@ protected:
 
         // Initialize initial conditions to zeros.
         MatrixType varSystemInitialState = MatrixType( stateTransitionMatrixSize_,
-                                                       parameterVectorSize_ + 1 ).setZero( );
+                                                       propagatedParameterVectorSize_ + 1 ).setZero( );
 
         // Set initial state transition matrix to identity
         varSystemInitialState.block( 0, 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ).setIdentity( );
 
         // Set initial body states to current estimate of initial body states.
-        varSystemInitialState.block( 0, parameterVectorSize_,
+        varSystemInitialState.block( 0, propagatedParameterVectorSize_,
                                      stateTransitionMatrixSize_, 1 ) = initialStateEstimate;
 
         return varSystemInitialState;
@@ -201,6 +433,9 @@ protected:
     //! Number of rows in sensitivity matrix
     int parameterVectorSize_;
 
+    //! Number of columns of the propagated state transition and sensitivity matrix (excluding omitted, dynamics-free, parameters)
+    int propagatedParameterVectorSize_;
+
     //! Boolean to determine whether to clear the raw numerical solution member variables after propagation
     /*!
      *  Boolean to determine whether to clear the raw numerical solution member variables after propagation
@@ -208,6 +443,9 @@ protected:
      */
     bool clearNumericalSolution_;
 
+    //! Settings for the retention of the numerical solution of the variational equations (nullptr if all is retained)
+    std::shared_ptr< VariationalEquationsRetentionSettings > retentionSettings_;
+
     //! Object used for interpolating numerical results of state transition and sensitivity matrix.
     std::shared_ptr< CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionInterface_;
 };
@@ -270,6 +508,8 @@ void setVariationalEquationsSolution(
  *  is state transition matrix history, second entry is sensitivity matrix history.
  * \param clearRawSolution Boolean denoting whether to clear entries of variationalEquationsSolution after creation
  * of interpolators.
+ * \param retentionSettings Settings for the retention of the numerical results (all results are retained in double
+ * precision if nullptr). Entries of the numerical results that are not retained are removed from the input maps.
  */
 void createStateTransitionAndSensitivityMatrixInterpolator(
         std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >&
@@ -278,7 +518,8 @@ void createStateTransitionAndSensitivityMatrixInterpolator(
         sensitivityMatrixInterpolator,
         std::map< double, Eigen::MatrixXd >& stateTransitionSolution,
         std::map< double, Eigen::MatrixXd >& sensitivitySolution,
-        const bool clearRawSolution = 1 );
+        const bool clearRawSolution = 1,
+        const std::shared_ptr< VariationalEquationsRetentionSettings > retentionSettings = nullptr );
 
 //! Function to check the consistency between propagation settings of equations of motion, and estimated parameters.
 /*!
@@ -793,10 +1034,19 @@ public:
                     dynamicsSimulator_->getDynamicsStateDerivative( )->getStateTypeStartIndices( ) );
         dynamicsSimulator_->getDynamicsStateDerivative( )->addVariationalEquations( variationalEquationsObject_ );
 
+        // Sensitivity matrix columns of parameters without influence on the dynamics are identically zero, and are not propagated
+        std::vector< int > propagatedSensitivityColumnIndices =
+                variationalEquationsObject_->omitDynamicsFreeParameterColumns( );
+        this->propagatedParameterVectorSize_ = variationalEquationsObject_->getNumberOfParameterValues( );
+
         // Create object that will contain and process the propagation results
         variationalPropagationResults_ = std::make_shared< SingleArcVariationalSimulationResults< StateScalarType, TimeType>>(
                 dynamicsSimulator_->getSingleArcPropagationResults( ),
                 this->stateTransitionMatrixSize_, this->parameterVectorSize_ - this->stateTransitionMatrixSize_ );
+        if( this->propagatedParameterVectorSize_ < this->parameterVectorSize_ )
+        {
+            variationalPropagationResults_->setPropagatedSensitivityColumnIndices( propagatedSensitivityColumnIndices );
+        }
 
         // Integrate variational equations from initial state estimate.
         if( integrateEquationsOnCreation )
@@ -867,6 +1117,7 @@ public:
     void integrateVariationalAndDynamicalEquations(
             const VectorType& initialStateEstimate, const bool integrateEquationsConcurrently )
     {
+        TUDAT_TRACE_SCOPE( "single_arc_variational_equations", "propagation" );
         if( integrateEquationsConcurrently )
         {
             // Create initial conditions from new estimate.
@@ -987,6 +1238,8 @@ private:
      */
     void resetVariationalEquationsInterpolators( )
     {
+        TUDAT_TRACE_SCOPE( "variational_interpolators", "propagation" );
+
         using namespace interpolators;
         using namespace utilities;
 
@@ -1002,7 +1255,7 @@ private:
                         stateTransitionMatrixInterpolator, sensitivityMatrixInterpolator,
                         variationalPropagationResults_->getStateTransitionSolution( ),
                         variationalPropagationResults_->getSensitivitySolution( ),
-                        this->clearNumericalSolution_ );
+                        this->clearNumericalSolution_, this->retentionSettings_ );
 
         }
         catch( const std::exception& caughtException )
@@ -1163,13 +1416,21 @@ public:
      *  end of this contructor (default false).
      *  \param resetMultiArcDynamicsAfterPropagation Boolean denoting whether to reset the multi-arc dynamics after
      *  propagation (default true).
+     *  \param arcWiseBodies List of bodies that are to be used for the propagation of each arc (empty by default, in which
+     *  case the bodies input is used for all arcs). Arcs for which the environments share no Body objects are propagated
+     *  concurrently (together with their variational equations) if more than one thread is set in the multi-arc output
+     *  settings (see MultiArcDynamicsSimulator). The propagated dynamics are set in the bodies input after propagation.
+     *  Physical parameters that are estimated must be defined consistently in all environments; their values are only
+     *  reset in the bodies input by resetParameterEstimate.
      */
 
     MultiArcVariationalEquationsSolver(
             const simulation_setup::SystemOfBodies& bodies,
             const std::shared_ptr< MultiArcPropagatorSettings< StateScalarType, TimeType > > propagatorSettings,
             const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > parametersToEstimate,
-            const bool integrateEquationsOnCreation = false ):
+            const bool integrateEquationsOnCreation = false,
+            const std::vector< simulation_setup::SystemOfBodies >& arcWiseBodies =
+            std::vector< simulation_setup::SystemOfBodies >( ) ):
         VariationalEquationsSolver< StateScalarType, TimeType >(
             bodies, parametersToEstimate, propagatorSettings != nullptr ?
                 propagatorSettings->getOutputSettingsWithCheck( )->getClearNumericalSolutions( ) : false  ),
@@ -1207,7 +1468,7 @@ public:
         }
 
         dynamicsSimulator_ =  std::make_shared< MultiArcDynamicsSimulator< StateScalarType, TimeType > >(
-                    bodies, propagatorSettings, false );
+                    bodies, propagatorSettings, false, arcWiseBodies );
 
         std::vector< std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > > singleArcDynamicsSimulators =
                 dynamicsSimulator_->getSingleArcDynamicsSimulators( );
@@ -1224,14 +1485,40 @@ public:
                 dynamicsSimulator_->getMultiArcPropagationResults( )->getMultiArcDependentVariablesInterface( ) );
 
 
+        std::vector< std::map< IntegratedStateType, orbit_determination::StateDerivativePartialsMap > >
+                arcWiseStateDerivativePartials;
         for( unsigned int i = 0; i < singleArcDynamicsSimulators.size( ); i++ )
         {
             dynamicsStateDerivatives_.push_back( singleArcDynamicsSimulators.at( i )->getDynamicsStateDerivative( ) );
 
-            // Create variational equations objects.
-            std::map< IntegratedStateType, orbit_determination::StateDerivativePartialsMap > stateDerivativePartials =
-                    simulation_setup::createStateDerivativePartials< StateScalarType, TimeType >(
-                        dynamicsStateDerivatives_.at( i )->getStateDerivativeModels( ), bodies, arcWiseParametersToEstimate_[ i ] );
+            // Reuse the partials of a previous arc if the dynamics of both arcs are built from the same models (in the same
+            // environment, in which case the arcs are not propagated concurrently), with the same parameters
+            int arcWithSharedPartials = -1;
+            if( arcWiseBodies.size( ) == 0 )
+            {
+                for( unsigned int j = 0; j < i; j++ )
+                {
+                    if( areArcPartialsShareable( i, j ) )
+                    {
+                        arcWithSharedPartials = j;
+                        break;
+                    }
+                }
+            }
+
+            // Create variational equations objects, using environment of current arc.
+            std::map< IntegratedStateType, orbit_determination::StateDerivativePartialsMap > stateDerivativePartials;
+            if( arcWithSharedPartials >= 0 )
+            {
+                stateDerivativePartials = arcWiseStateDerivativePartials.at( arcWithSharedPartials );
+            }
+            else
+            {
+                stateDerivativePartials = simulation_setup::createStateDerivativePartials< StateScalarType, TimeType >(
+                            dynamicsStateDerivatives_.at( i )->getStateDerivativeModels( ),
+                            ( arcWiseBodies.size( ) > 0 ) ? arcWiseBodies.at( i ) : bodies, arcWiseParametersToEstimate_[ i ] );
+            }
+            arcWiseStateDerivativePartials.push_back( stateDerivativePartials );
 
             std::shared_ptr< VariationalEquations > variationalEquationsObject_ =
                     std::make_shared< VariationalEquations >(
@@ -1356,6 +1643,7 @@ public:
     void integrateVariationalAndDynamicalEquations(
             const std::vector< VectorType >& initialStateEstimate, const bool integrateEquationsConcurrently )
     {
+        TUDAT_TRACE_SCOPE( "multi_arc_variational_equations", "propagation" );
 
         // Propagate variational equations and equations of motion concurrently
         if( integrateEquationsConcurrently )
@@ -1374,6 +1662,85 @@ public:
 
     }
 
+    //! Function to integrate the variational equations arc by arc, processing and releasing the results of each arc.
+    /*!
+     *  Function to integrate the variational equations (concurrently with the equations of motion) arc by arc, for the
+     *  current initial states, without storing the results of all arcs at once. Directly after the propagation of an arc,
+     *  the state transition and sensitivity matrix interpolators of that arc are set in the stateTransitionInterface_ and the
+     *  arcProcessingFunction is called for the arc, after which the interpolators and the propagation results of the arc are
+     *  released (the state history is retained if the initial state of any arc is taken from the preceding arc). The
+     *  interpolators of all other arcs are nullptr while an arc is processed, and remain so at the end of this function.
+     *
+     *  The environment is not updated with the propagated dynamics: the equations of motion must have been propagated for
+     *  the same initial states beforehand (e.g. by resetParameterEstimate without variational equations), so that the
+     *  processed arcs see the corresponding environment. The arcProcessingFunction is never called concurrently, but when
+     *  arcs are propagated concurrently (see MultiArcDynamicsSimulator), it is called while other arcs are being propagated,
+     *  so that it may only use environment models that are not modified by the propagation (i.e. no Body objects of the
+     *  arc-wise environments).
+     *  \param arcProcessingFunction Function processing the variational equations solution of a single arc (arc index as
+     *  input), called once for each arc
+     */
+    void integrateVariationalEquationsPerArc( const std::function< void( const int ) >& arcProcessingFunction )
+    {
+        TUDAT_TRACE_SCOPE( "multi_arc_variational_equations", "propagation" );
+
+        // Set arc times of state transition interface (from propagation of dynamics), with no interpolators for any arc
+        std::vector< double > arcStartTimesToUse = dynamicsSimulator_->getArcStartTimes( );
+        std::vector< double > arcEndTimesToUse = dynamicsSimulator_->getArcEndTimes( );
+        resetStateTransitionInterface(
+                    std::vector< std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > > >( numberOfArcs_, nullptr ),
+                    std::vector< std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > > >( numberOfArcs_, nullptr ),
+                    arcStartTimesToUse, arcEndTimesToUse );
+        std::shared_ptr< MultiArcCombinedStateTransitionAndSensitivityMatrixInterface< StateScalarType > > multiArcStateTransitionInterface =
+                std::dynamic_pointer_cast< MultiArcCombinedStateTransitionAndSensitivityMatrixInterface< StateScalarType > >(
+                    stateTransitionInterface_ );
+
+        std::shared_ptr< MultiArcInitialStateProvider< StateScalarType > > initialStateProvider =
+                getInitialStateProvider( propagatorSettings_->getInitialStateList( ) );
+        bool retainStateHistory = initialStateProvider->isAnyArcInitialStateFromPreviousArc( );
+
+        std::mutex arcProcessingMutex;
+        dynamicsSimulator_->template integrateEquationsOfMotion< MultiArcVariationalResults >(
+                    variationalPropagationResults_, initialStateProvider, [ & ]( const int arcIndex )
+        {
+            std::shared_ptr< SingleArcVariationalSimulationResults< StateScalarType, TimeType > > arcResults =
+                    variationalPropagationResults_->getSingleArcResults( ).at( arcIndex );
+
+            // Create interpolators of current arc (releasing the raw variational equations solution)
+            std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > > stateTransitionMatrixInterpolator;
+            std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > > sensitivityMatrixInterpolator;
+            createStateTransitionAndSensitivityMatrixInterpolator(
+                        stateTransitionMatrixInterpolator, sensitivityMatrixInterpolator,
+                        arcResults->getStateTransitionSolution( ), arcResults->getSensitivitySolution( ), true,
+                        this->retentionSettings_ );
+
+            // Process current arc, and release its interpolators and results
+            {
+                std::lock_guard< std::mutex > lock( arcProcessingMutex );
+                multiArcStateTransitionInterface->resetSingleArcMatrixInterpolators(
+                            arcIndex, stateTransitionMatrixInterpolator, sensitivityMatrixInterpolator );
+                try
+                {
+                    arcProcessingFunction( arcIndex );
+                }
+                catch( ... )
+                {
+                    multiArcStateTransitionInterface->resetSingleArcMatrixInterpolators( arcIndex, nullptr, nullptr );
+                    throw;
+                }
+                multiArcStateTransitionInterface->resetSingleArcMatrixInterpolators( arcIndex, nullptr, nullptr );
+            }
+            if( !retainStateHistory )
+            {
+                arcResults->clearSolutionMaps( );
+            }
+        }, false );
+
+        // Ensure consistency between parameters and propagator settings
+        setPropagatorSettingsMultiArcStatesInEstimatedDynamicalParameters<StateScalarType, TimeType>(
+                parametersToEstimate_, propagatorSettings_ );
+    }
+
     //! Function to return object used for numerically propagating and managing the solution of the equations of motion.
     /*!
      * Function to return object used for numerically propagating and managing the solution of the equations of motion.
@@ -1474,6 +1841,16 @@ public:
         return arcWiseParametersToEstimate_;
     }
 
+    //! Function to retrieve propagator settings used for equations of motion
+    /*!
+     * Function to retrieve propagator settings used for equations of motion
+     * \return Propagator settings used for equations of motion
+     */
+    std::shared_ptr< MultiArcPropagatorSettings< StateScalarType, TimeType > > getPropagatorSettings( )
+    {
+        return propagatorSettings_;
+    }
+
 
    std::shared_ptr< MultiArcVariationalResults > getMultiArcVariationalPropagationResults()
    {
@@ -1498,6 +1875,8 @@ private:
      */
     void resetVariationalEquationsInterpolators( )
     {
+        TUDAT_TRACE_SCOPE( "variational_interpolators", "propagation" );
+
         using namespace interpolators;
 
         // Allocate interpolator vectors
@@ -1511,12 +1890,16 @@ private:
         // Create interpolators.
         std::vector< double > arcStartTimesToUse;
         std::vector< double > arcEndTimesToUse;
-
         for( unsigned int i = 0; i < variationalPropagationResults_->getSingleArcResults( ).size( ); i++ )
         {
             arcStartTimesToUse.push_back( dynamicsSimulator_->getArcStartTimes( ).at( i ) );
             arcEndTimesToUse.push_back( dynamicsSimulator_->getArcEndTimes( ).at( i ) );
+        }
 
+        // Interpolators of each arc are created independently (and concurrently, if multiple threads are used)
+        utilities::executeParallelTasks(
+                    variationalPropagationResults_->getSingleArcResults( ).size( ), [ & ]( const int i )
+        {
             try
             {
                 createStateTransitionAndSensitivityMatrixInterpolator(
@@ -1524,7 +1907,7 @@ private:
                             sensitivityMatrixInterpolators[ i ],
                             variationalPropagationResults_->getSingleArcResults( ).at( i )->getStateTransitionSolution( ),
                             variationalPropagationResults_->getSingleArcResults( ).at( i )->getSensitivitySolution( ),
-                            this->clearNumericalSolution_ );
+                            this->clearNumericalSolution_, this->retentionSettings_ );
             }
             catch( const std::exception& caughtException )
             {
@@ -1533,10 +1916,28 @@ private:
                 std::cerr << "The problem may be that there is an insufficient number of data points (epochs) at which propagation results are produced for one or more arcs. Integrated results are given at" +
                              std::to_string( variationalPropagationResults_->getSingleArcResults( ).at( 0 )->getStateTransitionSolution( ).size( ) ) + " epochs"<< std::endl;
             }
+        }, propagatorSettings_->getOutputSettings( )->getNumberOfThreads( ) );
 
+        resetStateTransitionInterface(
+                    stateTransitionMatrixInterpolators, sensitivityMatrixInterpolators, arcStartTimesToUse, arcEndTimesToUse );
+    }
 
-        }
-
+    //! Function to create the state transition matrix interface if needed, and to reset its interpolators otherwise
+    /*!
+     *  Function to create the state transition matrix interface if needed, and to reset its interpolators otherwise
+     *  \param stateTransitionMatrixInterpolators Interpolators of the state transition matrix of each arc
+     *  \param sensitivityMatrixInterpolators Interpolators of the sensitivity matrix of each arc
+     *  \param arcStartTimesToUse Start times of the propagation of each arc
+     *  \param arcEndTimesToUse End times of the propagation of each arc
+     */
+    void resetStateTransitionInterface(
+            const std::vector< std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > > >&
+            stateTransitionMatrixInterpolators,
+            const std::vector< std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > > >&
+            sensitivityMatrixInterpolators,
+            const std::vector< double >& arcStartTimesToUse,
+            const std::vector< double >& arcEndTimesToUse )
+    {
         // Create stare transition matrix interface if needed, reset otherwise.
         if( stateTransitionInterface_ == nullptr )
         {
@@ -1569,6 +1970,52 @@ private:
         return partialIndices;
     }
 
+    //! Function to check whether the state derivative partials of one arc can be used for another arc
+    /*!
+     *  Function to check whether the state derivative partials of one arc can be used for another arc, which is the case
+     *  if the state derivative models of both arcs are built from the same acceleration, torque and mass-rate models, and the
+     *  same parameters are estimated for both arcs (the arc-wise initial state parameters being identified by their names).
+     *  \param firstArc Index of first arc
+     *  \param secondArc Index of second arc
+     *  \return True if partials of the two arcs can be shared.
+     */
+    bool areArcPartialsShareable( const int firstArc, const int secondArc )
+    {
+        std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > firstParameters =
+                arcWiseParametersToEstimate_.at( firstArc );
+        std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > secondParameters =
+                arcWiseParametersToEstimate_.at( secondArc );
+
+        if( firstParameters->getEstimatedDoubleParameters( ) != secondParameters->getEstimatedDoubleParameters( ) ||
+                firstParameters->getEstimatedVectorParameters( ) != secondParameters->getEstimatedVectorParameters( ) )
+        {
+            return false;
+        }
+
+        std::vector< std::shared_ptr< estimatable_parameters::EstimatableParameter<
+                Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > > > firstInitialStateParameters =
+                firstParameters->getEstimatedInitialStateParameters( );
+        std::vector< std::shared_ptr< estimatable_parameters::EstimatableParameter<
+                Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > > > secondInitialStateParameters =
+                secondParameters->getEstimatedInitialStateParameters( );
+        if( firstInitialStateParameters.size( ) != secondInitialStateParameters.size( ) )
+        {
+            return false;
+        }
+        for( unsigned int i = 0; i < firstInitialStateParameters.size( ); i++ )
+        {
+            if( firstInitialStateParameters.at( i )->getParameterName( ) !=
+                    secondInitialStateParameters.at( i )->getParameterName( ) )
+            {
+                return false;
+            }
+        }
+
+        return simulation_setup::areStateDerivativeModelsBuiltFromSameModels< StateScalarType, TimeType >(
+                    dynamicsStateDerivatives_.at( firstArc )->getStateDerivativeModels( ),
+                    dynamicsStateDerivatives_.at( secondArc )->getStateDerivativeModels( ) );
+    }
+
     //! Object to propagate the dynamics for all arcs.
     std::shared_ptr< MultiArcDynamicsSimulator< StateScalarType, TimeType > > dynamicsSimulator_;
 
@@ -1644,17 +2091,34 @@ public:
     using VariationalEquationsSolver< StateScalarType, TimeType >::parameterVectorSize_;
     using VariationalEquationsSolver< StateScalarType, TimeType >::stateTransitionInterface_;
 
+    //! Constructor
+    /*!
+     *  Constructor, sets up object for automatic evaluation and numerical integration of variational equations and equations of motion.
+     *  \param bodies Map of bodies (with names) of all bodies in integration.
+     *  \param propagatorSettings Settings for propagator.
+     *  \param parametersToEstimate Object containing all parameters that are to be estimated and their current settings and values.
+     *  \param integrateEquationsOnCreation Boolean to denote whether equations should be integrated immediately at the
+     *  end of this contructor (default false).
+     *  \param arcWiseBodies List of bodies that are to be used for the propagation of each arc of the multi-arc component
+     *  (empty by default, in which case the bodies input is used for all arcs). Since the single-arc bodies are propagated
+     *  along with the multi-arc bodies in each arc, the single-arc accelerations of each arc must then be created from the
+     *  corresponding environment, and provided through HybridArcPropagatorSettings::setArcWiseSingleArcPropagatorSettings.
+     *  The arcs of the multi-arc component are then propagated concurrently (after the single-arc propagation) if more
+     *  than one thread is set in the multi-arc output settings (see MultiArcVariationalEquationsSolver).
+     */
     HybridArcVariationalEquationsSolver(
             const simulation_setup::SystemOfBodies& bodies,
             const std::shared_ptr< HybridArcPropagatorSettings< StateScalarType, TimeType > > propagatorSettings,
             const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > parametersToEstimate,
-            const bool integrateEquationsOnCreation = false ):
+            const bool integrateEquationsOnCreation = false,
+            const std::vector< simulation_setup::SystemOfBodies >& arcWiseBodies =
+            std::vector< simulation_setup::SystemOfBodies >( ) ):
         VariationalEquationsSolver< StateScalarType, TimeType >(
             bodies, parametersToEstimate, propagatorSettings != nullptr ?
                 propagatorSettings->getOutputSettingsWithCheck( )->getClearNumericalSolutions( ) : false )
     {
         initializeHybridArcVariationalEquationsSolver(
-                    bodies, propagatorSettings, integrateEquationsOnCreation );
+                    bodies, propagatorSettings, integrateEquationsOnCreation, arcWiseBodies );
     }
 
     //! Constructor
@@ -1706,7 +2170,9 @@ public:
     void initializeHybridArcVariationalEquationsSolver(
             const simulation_setup::SystemOfBodies& bodies,
             const std::shared_ptr< PropagatorSettings< StateScalarType > > propagatorSettings,
-            const bool integrateEquationsOnCreation )
+            const bool integrateEquationsOnCreation,
+            const std::vector< simulation_setup::SystemOfBodies >& arcWiseBodies =
+            std::vector< simulation_setup::SystemOfBodies >( ) )
     {
         // Cast propagator settings to correct type and check validity
         originalPopagatorSettings_ =
@@ -1716,6 +2182,13 @@ public:
             throw std::runtime_error( "Error when making HybridArcVariationalEquationsSolver, input propagation settings are not hybrid arc" );
         }
 
+        // Check consistency of arc-wise environments with single-arc models used in each arc
+        if( arcWiseBodies.size( ) > 0 && originalPopagatorSettings_->getArcWiseSingleArcPropagatorSettings( ).size( ) == 0 )
+        {
+            throw std::runtime_error( "Error when making HybridArcVariationalEquationsSolver, arc-wise bodies provided, but no arc-wise "
+                                      "single-arc propagator settings are defined" );
+        }
+
         // Retrive arc properties
         singleArcInitialTime_ = originalPopagatorSettings_->getSingleArcPropagatorSettings( )->getInitialTime( );
         int numberOfArcs = originalPopagatorSettings_->getMultiArcPropagatorSettings( )->getNmberOfArcs( );
@@ -1736,7 +2209,7 @@ public:
                 getExtendedMultiPropagatorSettings(
                     originalPopagatorSettings_->getSingleArcPropagatorSettings( ),
                     originalPopagatorSettings_->getMultiArcPropagatorSettings( ),
-                    numberOfArcs );
+                    numberOfArcs, originalPopagatorSettings_->getArcWiseSingleArcPropagatorSettings( ) );
 
         multiArcDynamicsSize_ = extendedMultiArcSettings->getConventionalStateSize( );
         for ( unsigned int i = 0 ; i < arcStartTimes_.size( ) ; i++ )
@@ -1755,6 +2228,8 @@ public:
         // Create multi-arc solver with original parameter set
         extendedMultiArcSettings->getOutputSettings( )->setClearNumericalSolutions( false );
         extendedMultiArcSettings->getOutputSettings( )->setIntegratedResult( false );
+        extendedMultiArcSettings->getOutputSettings( )->setNumberOfThreads(
+                    originalPopagatorSettings_->getMultiArcPropagatorSettings( )->getOutputSettings( )->getNumberOfThreads( ) );
 
         originalMultiArcSolver_ = std::make_shared< MultiArcVariationalEquationsSolver< StateScalarType, TimeType > >(
                     bodies, originalPopagatorSettings_->getMultiArcPropagatorSettings( ),
@@ -1767,7 +2242,7 @@ public:
 
         multiArcSolver_ = std::make_shared< MultiArcVariationalEquationsSolver< StateScalarType, TimeType > >(
                     bodies, extendedMultiArcSettings,
-                    multiArcParametersToEstimate_, false );
+                    multiArcParametersToEstimate_, false, arcWiseBodies );
 
         for( unsigned int i = 0; i < multiArcSolver_->getDynamicsStateDerivatives( ).size( ); i++ )
         {
@@ -1819,6 +2294,8 @@ public:
     void integrateVariationalAndDynamicalEquations(
             const VectorType& initialStateEstimate, const bool integrateEquationsConcurrently )
     {
+        TUDAT_TRACE_SCOPE( "hybrid_arc_variational_equations", "propagation" );
+
         // TODO: do process depdendent variables in original multi-arc solver, do not process dependent variables in
         // extended solver. Also add dependent variables to original multi-arc solver.
 
@@ -2010,6 +2487,20 @@ public:
         throw std::runtime_error( "Error, getDynamicsSimulatorBase not implemented in hyrbid arc propagator" );
     }
 
+    //! Function to set the settings for the retention of the numerical solution of the variational equations
+    /*!
+     *  Function to set the settings for the retention of the numerical solution of the variational equations, for both the
+     *  single- and multi-arc solution.
+     *  \param retentionSettings Settings for the retention of the solution (all epochs retained in double precision if
+     *  nullptr)
+     */
+    void setVariationalSolutionRetention(
+            const std::shared_ptr< VariationalEquationsRetentionSettings > retentionSettings )
+    {
+        this->retentionSettings_ = retentionSettings;
+        singleArcSolver_->setVariationalSolutionRetention( retentionSettings );
+        multiArcSolver_->setVariationalSolutionRetention( retentionSettings );
+    }
 
     std::shared_ptr< MultiArcVariationalEquationsSolver< StateScalarType, TimeType > > getMultiArcSolver( )
     {
@@ -18,7 +18,10 @@
 #include "propagation_setup/createStateDerivativeModel.h"
 #include "propagation_setup/createTorqueModel.h"
 #include "propagation_setup/dynamicsSimulator.h"
+#include "propagation_setup/ensembleDynamicsSimulator.h"
+#include "propagation_setup/propagationTransferTrajectoryFullProblem.h"
 #include "propagation_setup/environmentUpdater.h"
+#include "propagation_setup/pararealDynamicsSimulator.h"
 #include "propagation_setup/propagationCR3BPFullProblem.h"
 //#include "propagation_setup/propagationLambertTargeterFullProblem.h"
 #include "propagation_setup/propagationOutput.h"
@@ -106,11 +106,20 @@ public:
      *  Constructor to set maximum degree and order that is to be taken into account.
      *  \param maximumDegree Maximum degree
      *  \param maximumOrder Maximum order
+     *  \param summationType Type of implementation of the summation over all degrees and orders (e.g. spherical or
+     *  Cartesian formulation, see basic_mathematics::SphericalHarmonicsSummationType)
+     *  \param degreeTruncationTolerance Tolerance on the acceleration [m/s^2] used to select the maximum degree that is
+     *  evaluated at each time step, from the distance to the body (NaN to always use maximumDegree, see
+     *  SphericalHarmonicsGravitationalAccelerationModel::setDegreeTruncationTolerance)
      */
     SphericalHarmonicAccelerationSettings( const int maximumDegree,
-                                           const int maximumOrder ):
+                                           const int maximumOrder,
+                                           const basic_mathematics::SphericalHarmonicsSummationType summationType =
+            basic_mathematics::standard_spherical_harmonics_summation,
+                                           const double degreeTruncationTolerance = TUDAT_NAN ):
         AccelerationSettings( basic_astrodynamics::spherical_harmonic_gravity ),
-        maximumDegree_( maximumDegree ), maximumOrder_( maximumOrder ){ }
+        maximumDegree_( maximumDegree ), maximumOrder_( maximumOrder ), summationType_( summationType ),
+        degreeTruncationTolerance_( degreeTruncationTolerance ){ }
 
 
     // Maximum degree that is to be used for spherical harmonic acceleration
@@ -118,13 +127,23 @@ public:
 
     // Maximum order that is to be used for spherical harmonic acceleration
     int maximumOrder_;
+
+    // Type of implementation of the summation over all degrees and orders
+    basic_mathematics::SphericalHarmonicsSummationType summationType_;
+
+    // Tolerance on the acceleration used to select the evaluated maximum degree from the distance (NaN if not used)
+    double degreeTruncationTolerance_;
 };
 
 //! @get_docstring(sphericalHarmonicAcceleration)
 inline std::shared_ptr< AccelerationSettings > sphericalHarmonicAcceleration(
-        const int maximumDegree, const int maximumOrder )
+        const int maximumDegree, const int maximumOrder,
+        const basic_mathematics::SphericalHarmonicsSummationType summationType =
+        basic_mathematics::standard_spherical_harmonics_summation,
+        const double degreeTruncationTolerance = TUDAT_NAN )
 {
-    return std::make_shared< SphericalHarmonicAccelerationSettings >( maximumDegree, maximumOrder );
+    return std::make_shared< SphericalHarmonicAccelerationSettings >(
+                maximumDegree, maximumOrder, summationType, degreeTruncationTolerance );
 }
 
 // Class for providing acceleration settings for mutual spherical harmonics acceleration model.
@@ -605,7 +624,47 @@ public:
             std::bind( &applyAccelerationScalingFunction, accelerationFunction, scalingFunction,
                        std::placeholders::_1 ) ){ }
 
+    //! Constructor for an acceleration that depends on the state of the body undergoing the acceleration
+    /*!
+     *  Constructor for an acceleration that depends on the (inertial) state of the body undergoing the acceleration. The
+     *  same acceleration function, evaluated with dual numbers, is used to compute the exact partial derivatives of the
+     *  acceleration w.r.t. the state (see stateDependentCustomAccelerationSettings for creating both from a single
+     *  function).
+     *  \param stateDependentAccelerationFunction Acceleration as a function of time and state
+     *  \param dualAccelerationFunction Acceleration as a function of time and state, evaluated with dual numbers
+     *  \param scalingFunction Function of time with which the acceleration is multiplied (none if nullptr)
+     */
+    CustomAccelerationSettings(
+            const std::function< Eigen::Vector3d( const double, const Eigen::Vector6d& ) > stateDependentAccelerationFunction,
+            const std::function< automatic_differentiation::Vector3StateDual(
+                const double, const automatic_differentiation::StateDualVector& ) > dualAccelerationFunction,
+            const std::function< double( const double) > scalingFunction = nullptr ):
+        AccelerationSettings( basic_astrodynamics::custom_acceleration ),
+        stateDependentAccelerationFunction_( stateDependentAccelerationFunction ),
+        dualAccelerationFunction_( dualAccelerationFunction )
+    {
+        if( scalingFunction != nullptr )
+        {
+            stateDependentAccelerationFunction_ = [ = ]( const double time, const Eigen::Vector6d& state )
+            {
+                return Eigen::Vector3d( scalingFunction( time ) * stateDependentAccelerationFunction( time, state ) );
+            };
+            dualAccelerationFunction_ = [ = ]( const double time, const automatic_differentiation::StateDualVector& state )
+            {
+                return automatic_differentiation::Vector3StateDual(
+                            scalingFunction( time ) * dualAccelerationFunction( time, state ) );
+            };
+        }
+    }
+
     std::function< Eigen::Vector3d( const double ) > accelerationFunction_;
+
+    //! Acceleration as a function of time and state (nullptr if acceleration depends on time only)
+    std::function< Eigen::Vector3d( const double, const Eigen::Vector6d& ) > stateDependentAccelerationFunction_;
+
+    //! Acceleration as a function of time and state, evaluated with dual numbers (nullptr if not available)
+    std::function< automatic_differentiation::Vector3StateDual(
+        const double, const automatic_differentiation::StateDualVector& ) > dualAccelerationFunction_;
 };
 
 //! @get_docstring(customAccelerationSettings)
@@ -625,6 +684,33 @@ inline std::shared_ptr< AccelerationSettings > customAccelerationSettings(
     }
 }
 
+//! Function to create settings for a custom acceleration depending on the state of the body undergoing acceleration
+/*!
+ *  Function to create settings for a custom acceleration depending on the (inertial) state of the body undergoing
+ *  acceleration. The acceleration function must be generic in its scalar type (e.g. a lambda with auto arguments, using
+ *  only Eigen operations and unqualified math functions), returning a 3-vector with the scalar type of the state. It is
+ *  instantiated both for double and for dual numbers, so that exact partials of the acceleration w.r.t. the state are
+ *  available for the variational equations, instead of being set to zero as for the time-only custom acceleration.
+ *  \param accelerationFunction Function of time and state (of any scalar type) returning the acceleration
+ *  \param scalingFunction Function of time with which the acceleration is multiplied (none if nullptr)
+ *  \return Custom acceleration settings
+ */
+template< typename AccelerationFunctionType >
+std::shared_ptr< AccelerationSettings > stateDependentCustomAccelerationSettings(
+        const AccelerationFunctionType& accelerationFunction,
+        const std::function< double( const double ) > scalingFunction = nullptr )
+{
+    return std::make_shared< CustomAccelerationSettings >(
+                [ = ]( const double time, const Eigen::Vector6d& state )
+    {
+        return Eigen::Vector3d( accelerationFunction( time, state ) );
+    },
+    [ = ]( const double time, const automatic_differentiation::StateDualVector& state )
+    {
+        return automatic_differentiation::Vector3StateDual( accelerationFunction( time, state ) );
+    }, scalingFunction );
+}
+
 // Class for providing settings for a direct tidal acceleration model, with approach of Lainey et al. (2007, 2009, ..)
 /*
  *  Class for providing settings for a direct tidal acceleration model, with approach of Lainey et al. (2007, 2009, ..).
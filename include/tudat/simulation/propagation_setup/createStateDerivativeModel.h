@@ -280,6 +280,20 @@ createTranslationalStateDerivativeModel(
         throw std::runtime_error( "Error, did not recognize translational state propagation type: " +
                                   std::to_string( translationPropagatorSettings->propagator_ ) );
     }
+
+    // Set parallel update of acceleration models, if requested
+    if( translationPropagatorSettings->getNumberOfAccelerationThreads( ) > 1 )
+    {
+        std::dynamic_pointer_cast< NBodyStateDerivative< StateScalarType, TimeType > >( stateDerivativeModel )->
+                setNumberOfParallelThreads( translationPropagatorSettings->getNumberOfAccelerationThreads( ) );
+    }
+
+    // Evaluate point-mass accelerations between propagated bodies with single kernel, if requested
+    if( translationPropagatorSettings->getUseMutualPointMassGravityKernel( ) )
+    {
+        std::dynamic_pointer_cast< NBodyStateDerivative< StateScalarType, TimeType > >( stateDerivativeModel )->
+                useMutualPointMassGravityKernel( );
+    }
     return stateDerivativeModel;
 }
 
@@ -0,0 +1,348 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_DEVICEENSEMBLEDYNAMICSSIMULATOR_H
+#define TUDAT_DEVICEENSEMBLEDYNAMICSSIMULATOR_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/math/integrators/createNumericalIntegrator.h"
+#include "tudat/simulation/environment_setup/body.h"
+#include "tudat/simulation/propagation_setup/accelerationSettings.h"
+#include "tudat/simulation/propagation_setup/ensembleDevicePropagation.h"
+#include "tudat/simulation/propagation_setup/propagationTerminationSettings.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Function to check whether device ensemble propagation runs on a CUDA device in this build
+/*!
+ *  Function to check whether the propagation of ensembles by DeviceEnsembleDynamicsSimulator runs on a CUDA device in
+ *  this build, i.e. whether Tudat is built with TUDAT_BUILD_WITH_CUDA. Otherwise, the same propagation is performed on
+ *  host threads.
+ *  \return True if device ensemble propagation runs on a CUDA device
+ */
+bool isDeviceEnsemblePropagationOnCudaDevice( );
+
+//! Settings for the conversion of the environment to its device representation, and for the device propagation
+class DeviceEnsemblePropagationSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param ephemerisTabulationTimeStep Time step with which the states of the perturbing bodies (and radiation
+     *  source) are tabulated, for cubic Hermite interpolation on the device
+     *  \param atmosphereTabulationAltitudeStep Altitude step with which the density of a tabulated atmosphere is
+     *  resampled, for linear interpolation of the logarithm of the density on the device
+     *  \param maximumMembersPerDeviceBatch Maximum number of members that is propagated in a single call to the device
+     *  (limiting the device memory that is used)
+     *  \param maximumNumberOfSteps Maximum number of (accepted and rejected) steps per member, after which the
+     *  propagation of the member is terminated
+     */
+    DeviceEnsemblePropagationSettings( const double ephemerisTabulationTimeStep = 300.0,
+                                       const double atmosphereTabulationAltitudeStep = 500.0,
+                                       const int maximumMembersPerDeviceBatch = 262144,
+                                       const int maximumNumberOfSteps = 10000000 ):
+        ephemerisTabulationTimeStep_( ephemerisTabulationTimeStep ),
+        atmosphereTabulationAltitudeStep_( atmosphereTabulationAltitudeStep ),
+        maximumMembersPerDeviceBatch_( maximumMembersPerDeviceBatch ),
+        maximumNumberOfSteps_( maximumNumberOfSteps ){ }
+
+    //! Time step with which the states of the perturbing bodies are tabulated
+    double ephemerisTabulationTimeStep_;
+
+    //! Altitude step with which the density of a tabulated atmosphere is resampled
+    double atmosphereTabulationAltitudeStep_;
+
+    //! Maximum number of members that is propagated in a single call to the device
+    int maximumMembersPerDeviceBatch_;
+
+    //! Maximum number of (accepted and rejected) steps per member
+    int maximumNumberOfSteps_;
+};
+
+//! Results of a device ensemble propagation, stored per output epoch in columnar layout
+class DeviceEnsemblePropagationResults
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param outputEpochs Output epochs of the propagation
+     *  \param numberOfMembers Number of members of the ensemble
+     *  \param stateData States of the members at the output epochs, with entry i of the state of member m at output
+     *  epoch k stored in entry ( 6 * k + i ) * numberOfMembers + m
+     *  \param memberStatus Status of each member at the end of the propagation
+     *  \param numberOfAcceptedSteps Number of accepted steps of each member
+     *  \param numberOfRejectedSteps Number of rejected steps of each member
+     */
+    DeviceEnsemblePropagationResults( const std::vector< double >& outputEpochs,
+                                      const int numberOfMembers,
+                                      const std::vector< double >& stateData,
+                                      const std::vector< DeviceEnsembleMemberStatus >& memberStatus,
+                                      const Eigen::VectorXi& numberOfAcceptedSteps,
+                                      const Eigen::VectorXi& numberOfRejectedSteps );
+
+    //! Function to retrieve the output epochs of the propagation
+    std::vector< double > getOutputEpochs( ) const
+    {
+        return outputEpochs_;
+    }
+
+    //! Function to retrieve the number of members of the ensemble
+    int getNumberOfMembers( ) const
+    {
+        return numberOfMembers_;
+    }
+
+    //! Function to retrieve the states of the members, in columnar layout
+    /*!
+     *  Function to retrieve the states of the members at all output epochs, with entry i of the state of member m at
+     *  output epoch k stored in entry ( 6 * k + i ) * numberOfMembers + m, so that each state entry at each epoch is
+     *  stored contiguously for all members. States after the termination of a member are NaN.
+     *  \return States of the members at the output epochs
+     */
+    const std::vector< double >& getStateData( ) const
+    {
+        return stateData_;
+    }
+
+    //! Function to retrieve the states of all members at a single output epoch
+    /*!
+     *  Function to retrieve the states of all members at a single output epoch, with one row per member (as the member
+     *  initial states of EnsembleDynamicsSimulator::propagateEnsemble)
+     *  \param epochIndex Index of the output epoch
+     *  \return States of all members at the output epoch
+     */
+    Eigen::MatrixXd getStatesAtOutputEpoch( const int epochIndex ) const;
+
+    //! Function to retrieve the state history of a single member
+    /*!
+     *  Function to retrieve the state history of a single member, w.r.t. the central body, for the output epochs up to
+     *  the termination of the member
+     *  \param memberIndex Index of the member
+     *  \return State history of the member
+     */
+    std::map< double, Eigen::VectorXd > getMemberStateHistory( const int memberIndex ) const;
+
+    //! Function to retrieve the status of each member at the end of the propagation
+    std::vector< DeviceEnsembleMemberStatus > getMemberStatus( ) const
+    {
+        return memberStatus_;
+    }
+
+    //! Function to check whether the propagation of all members was successful
+    bool integrationCompletedSuccessfully( ) const;
+
+    //! Function to retrieve the number of accepted steps of each member
+    Eigen::VectorXi getNumberOfAcceptedSteps( ) const
+    {
+        return numberOfAcceptedSteps_;
+    }
+
+    //! Function to retrieve the number of rejected steps of each member
+    Eigen::VectorXi getNumberOfRejectedSteps( ) const
+    {
+        return numberOfRejectedSteps_;
+    }
+
+    //! Function to write the states of the members to a binary columnar data file
+    /*!
+     *  Function to write the states of the members to a binary columnar data file (see
+     *  input_output::writeBinaryDataFile), with the output epochs as keys, and column 6 * m + i containing entry i of
+     *  the state of member m.
+     *  \param fileName Name (including path) of the file that is to be written
+     */
+    void writeToBinaryFile( const std::string& fileName ) const;
+
+private:
+
+    //! Output epochs of the propagation
+    std::vector< double > outputEpochs_;
+
+    //! Number of members of the ensemble
+    int numberOfMembers_;
+
+    //! States of the members at the output epochs, in columnar layout (see getStateData)
+    std::vector< double > stateData_;
+
+    //! Status of each member at the end of the propagation
+    std::vector< DeviceEnsembleMemberStatus > memberStatus_;
+
+    //! Number of accepted steps of each member
+    Eigen::VectorXi numberOfAcceptedSteps_;
+
+    //! Number of rejected steps of each member
+    Eigen::VectorXi numberOfRejectedSteps_;
+};
+
+//! Class for the propagation of a large ensemble of trajectories with a simplified dynamical model on a CUDA device
+/*!
+ *  Class for the propagation of a large ensemble of trajectories (e.g. for dispersion analyses or debris clouds) of a
+ *  single body w.r.t. a central body on a CUDA device, with one device thread per member. When Tudat is built without
+ *  TUDAT_BUILD_WITH_CUDA, the same simplified propagation is performed on host threads. Only a subset of the
+ *  acceleration models and integrators is supported, which is converted to a plain-data representation when this object
+ *  is created. Settings outside of this subset are rejected with an exception (no fallback to a full propagation with
+ *  the regular dynamics simulator is made). The supported settings are:
+ *
+ *  - Point mass gravity of the central body, or spherical harmonic gravity of the central body with order 0 and degree
+ *    at most 6 (i.e. the J2-J6 terms). The central body must have a SimpleRotationalEphemeris if zonal terms or drag
+ *    are used.
+ *  - Point mass gravity of third bodies, of which the states are tabulated on the host.
+ *  - Aerodynamic acceleration due to the central body, with constant drag-only aerodynamic coefficients (no control
+ *    surfaces) and constant body mass, a spherical central body shape, no wind model, and an exponential atmosphere or
+ *    tabulated atmosphere depending on altitude only. The atmosphere co-rotates with the central body.
+ *  - Cannonball radiation pressure without occulting bodies, with a constant radiation pressure coefficient and
+ *    constant source power.
+ *  - Fixed step size Runge-Kutta integrators, and variable step size Runge-Kutta integrators with scalar per-element
+ *    tolerances (without proportional-integral control).
+ *  - Termination at a given time.
+ *
+ *  The members differ in their initial state, and (optionally) in a scaling factor of the drag and of the radiation
+ *  pressure acceleration (e.g. to sample uncertain drag and radiation pressure coefficients). The results are stored at
+ *  a fixed output time step, in columnar layout (see DeviceEnsemblePropagationResults).
+ */
+class DeviceEnsembleDynamicsSimulator
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor, converts the environment and settings to the device representation, throwing an exception if they
+     *  are not supported (see class description). The environment is only evaluated when this object is created.
+     *  \param bodies Bodies of the environment
+     *  \param accelerationSettings Settings for the accelerations acting on the propagated body (no other bodies may
+     *  be included)
+     *  \param propagatedBody Name of the propagated body
+     *  \param centralBody Name of the central body w.r.t. which the body is propagated
+     *  \param integratorSettings Settings of the (Runge-Kutta) integrator
+     *  \param initialTime Initial time of the propagation
+     *  \param terminationSettings Termination settings of the propagation (time termination only)
+     *  \param outputTimeStep Time step with which the states of the members are stored (the final time is always
+     *  included). The step of the integrator is limited such that each output epoch is exactly reached.
+     *  \param deviceSettings Settings for the conversion of the environment to its device representation
+     */
+    DeviceEnsembleDynamicsSimulator(
+            const simulation_setup::SystemOfBodies& bodies,
+            const simulation_setup::SelectedAccelerationMap& accelerationSettings,
+            const std::string& propagatedBody,
+            const std::string& centralBody,
+            const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings,
+            const double initialTime,
+            const std::shared_ptr< PropagationTerminationSettings > terminationSettings,
+            const double outputTimeStep,
+            const std::shared_ptr< DeviceEnsemblePropagationSettings > deviceSettings =
+            std::make_shared< DeviceEnsemblePropagationSettings >( ) );
+
+    //! Function to propagate all members of the ensemble on the device
+    /*!
+     *  Function to propagate all members of the ensemble on the device. If Tudat is not built with CUDA support, the
+     *  same per-member propagation (see propagateEnsembleMember) is performed on the host, with the members of each
+     *  batch distributed over the available threads (see utilities::getNumberOfAvailableThreads).
+     *  \param memberInitialStates Initial Cartesian states of the members w.r.t. the central body, with one row per
+     *  member (as for EnsembleDynamicsSimulator::propagateEnsemble)
+     *  \param dragScalingFactors Scaling factor of the drag acceleration of each member (default 1 for all members)
+     *  \param radiationPressureScalingFactors Scaling factor of the radiation pressure acceleration of each member
+     *  (default 1 for all members)
+     *  \return Propagation results of all members
+     */
+    std::shared_ptr< DeviceEnsemblePropagationResults > propagateEnsemble(
+            const Eigen::MatrixXd& memberInitialStates,
+            const Eigen::VectorXd& dragScalingFactors = Eigen::VectorXd( ),
+            const Eigen::VectorXd& radiationPressureScalingFactors = Eigen::VectorXd( ) ) const;
+
+    //! Function to retrieve the device representation of the dynamical model and integrator
+    DeviceEnsembleDynamicsModel getDeviceDynamicsModel( ) const
+    {
+        return model_;
+    }
+
+    //! Function to retrieve the names of the bodies of which the states are tabulated for use on the device
+    std::vector< std::string > getTabulatedBodies( ) const
+    {
+        return tabulatedBodies_;
+    }
+
+    //! Function to retrieve the output epochs of the propagation
+    std::vector< double > getOutputEpochs( ) const
+    {
+        return outputEpochs_;
+    }
+
+private:
+
+    //! Function to set the gravity field model of the central body in the device representation
+    void setCentralBodyGravity( const simulation_setup::SystemOfBodies& bodies,
+                                const std::shared_ptr< simulation_setup::AccelerationSettings > accelerationSettings );
+
+    //! Function to set the atmosphere and aerodynamic model in the device representation
+    void setAerodynamicModel( const simulation_setup::SystemOfBodies& bodies, const double initialTime );
+
+    //! Function to set the cannonball radiation pressure model in the device representation
+    void setRadiationPressureModel( const simulation_setup::SystemOfBodies& bodies,
+                                    const std::string& sourceBody, const double initialTime );
+
+    //! Function to set the pole direction and rotation rate of the central body in the device representation
+    void setCentralBodyRotation( const simulation_setup::SystemOfBodies& bodies, const double initialTime,
+                                 const std::string& modelName );
+
+    //! Function to set the integrator in the device representation
+    void setIntegrator( const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings );
+
+    //! Function to tabulate the states of the perturbing bodies w.r.t. the central body
+    void tabulateBodyStates( const simulation_setup::SystemOfBodies& bodies );
+
+    //! Name of the propagated body
+    std::string propagatedBody_;
+
+    //! Name of the central body
+    std::string centralBody_;
+
+    //! Settings for the conversion of the environment to its device representation
+    std::shared_ptr< DeviceEnsemblePropagationSettings > deviceSettings_;
+
+    //! Device representation of the dynamical model and integrator
+    DeviceEnsembleDynamicsModel model_;
+
+    //! Output epochs of the propagation
+    std::vector< double > outputEpochs_;
+
+    //! Names of the bodies of which the states are tabulated
+    std::vector< std::string > tabulatedBodies_;
+
+    //! Gravitational parameters of the tabulated bodies (zero for a body that only acts as radiation source)
+    std::vector< double > tabulatedBodyGravitationalParameters_;
+
+    //! Tabulated states of the perturbing bodies (see propagateEnsembleOnDevice)
+    std::vector< double > tabulatedBodyStates_;
+
+    //! Tabulated logarithm of the atmospheric density (see propagateEnsembleOnDevice)
+    std::vector< double > tabulatedLogarithmicDensities_;
+
+    //! Butcher tableau of the integrator (see propagateEnsembleOnDevice)
+    std::vector< double > rungeKuttaCoefficients_;
+};
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_DEVICEENSEMBLEDYNAMICSSIMULATOR_H
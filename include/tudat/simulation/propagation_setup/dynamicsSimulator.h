@@ -11,6 +11,7 @@
 #ifndef TUDAT_DYNAMICSSIMULATOR_H
 #define TUDAT_DYNAMICSSIMULATOR_H
 
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <chrono>
@@ -19,6 +20,8 @@
 
 #include "tudat/basics/tudatTypeTraits.h"
 #include "tudat/basics/utilities.h"
+#include "tudat/basics/parallelization.h"
+#include "tudat/basics/tracing.h"
 #include "tudat/astro/propagators/nBodyStateDerivative.h"
 #include "tudat/astro/ephemerides/frameManager.h"
 #include "tudat/simulation/propagation_setup/propagationSettings.h"
@@ -28,6 +31,7 @@
 #include "tudat/simulation/propagation_setup/propagationResults.h"
 #include "tudat/simulation/propagation_setup/createEnvironmentUpdater.h"
 #include "tudat/simulation/propagation_setup/propagationTermination.h"
+#include "tudat/simulation/propagation_setup/perturbingBodyEphemerisInterpolation.h"
 #include "tudat/astro/propagators/dynamicsStateDerivativeModel.h"
 #include "tudat/math/interpolators/lagrangeInterpolator.h"
 #include "tudat/simulation/propagation_setup/dependentVariablesInterface.h"
@@ -61,6 +65,9 @@ Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > getInitialStatesOfBodiesFrom
             Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >::Zero( bodiesToIntegrate.size( ) * 6, 1 );
     std::shared_ptr< ephemerides::Ephemeris > ephemerisOfCurrentBody;
 
+    // Evaluate states of frames shared by multiple origin corrections only once
+    frameManager->startFrameStateMemoisation( );
+
     // Iterate over all bodies.
     for( unsigned int i = 0; i < bodiesToIntegrate.size( ) ; i++ )
     {
@@ -68,6 +75,7 @@ Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > getInitialStatesOfBodiesFrom
 
         if ( !ephemerisOfCurrentBody )
         {
+            frameManager->stopFrameStateMemoisation( );
             throw std::runtime_error( "Could not determine initial state for body " + bodiesToIntegrate.at( i ) +
                                       " because it does not have a valid Ephemeris object." );
         }
@@ -85,6 +93,8 @@ Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > getInitialStatesOfBodiesFrom
                     StateScalarType, TimeType >( initialTime );
         }
     }
+    frameManager->stopFrameStateMemoisation( );
+
     return systemInitialState;
 }
 
@@ -294,7 +304,8 @@ void printPropagatedDependentVariableContent (
         static void printGenericSingleArcPostPropagationMessages(
                 const std::shared_ptr< PropagationPrintSettings > printSettings,
                 const std::string& propagationEndHeader,
-                const std::shared_ptr< SingleArcSimulationResults< StateScalarType, TimeType > > propagationResults )
+                const std::shared_ptr< SingleArcSimulationResults< StateScalarType, TimeType > > propagationResults,
+                const simulation_setup::SystemOfBodies& bodies )
         {
             // Retrieve and print number of total function evaluations
             if ( printSettings->printPostPropagation( ) )
@@ -327,6 +338,10 @@ void printPropagatedDependentVariableContent (
                     }
                     printStateVectorContent( propagationResults->getProcessedStateIds( ),"Processed state vector" );
                 }
+                if( printSettings->getPrintEphemerisStateCacheStatistics( ) )
+                {
+                    simulation_setup::printEphemerisStateCacheStatistics( bodies );
+                }
                 std::cout<<std::endl;
             }
             if( printSettings->printAnyOutput( ) )
@@ -349,7 +364,8 @@ void printPropagatedDependentVariableContent (
             static void printSingleArcPostPropagationMessages(
                     const std::shared_ptr< PropagationPrintSettings > printSettings,
                     const std::string& propagationEndHeader,
-                    const std::shared_ptr< SingleArcSimulationResults< StateScalarType, TimeType > > propagationResults );
+                    const std::shared_ptr< SingleArcSimulationResults< StateScalarType, TimeType > > propagationResults,
+                    const simulation_setup::SystemOfBodies& bodies );
         };
 
         template< typename StateScalarType, typename TimeType >
@@ -381,9 +397,10 @@ void printPropagatedDependentVariableContent (
             static void printSingleArcPostPropagationMessages(
                     const std::shared_ptr< PropagationPrintSettings > printSettings,
                     const std::string& propagationEndHeader,
-                    const std::shared_ptr< SingleArcSimulationResults< StateScalarType, TimeType > > propagationResults )
+                    const std::shared_ptr< SingleArcSimulationResults< StateScalarType, TimeType > > propagationResults,
+                    const simulation_setup::SystemOfBodies& bodies )
             {
-                printGenericSingleArcPostPropagationMessages( printSettings, propagationEndHeader, propagationResults );
+                printGenericSingleArcPostPropagationMessages( printSettings, propagationEndHeader, propagationResults, bodies );
             }
 
         };
@@ -405,7 +422,7 @@ void printPropagatedDependentVariableContent (
                 }
                 if( printSettings->getPrintPropagatedStateData( ) )
                 {
-                    int totalNumberOfColumns = propagationResults->getStateTransitionMatrixSize( ) + propagationResults->getSensitivityMatrixSize( ) + 1;
+                    int totalNumberOfColumns = propagationResults->getStateTransitionMatrixSize( ) + propagationResults->getPropagatedSensitivityMatrixSize( ) + 1;
                     std::cout<<"PROPAGATED STATE DETAILS:"<<std::endl;
                     std::cout<<"Propagating state transition matrix Phi(=dx/dx0), Sensitivity matrix S(=dx/dp), and state vector y as single matrix [Phi┊S┊y]], total size ["<<
                         std::to_string( propagationResults->getDynamicsResults( )->getPropagatedStateSize( ) )<<" x "<<std::to_string( totalNumberOfColumns )<< "], "<<std::endl;
@@ -428,11 +445,13 @@ void printPropagatedDependentVariableContent (
             static void printSingleArcPostPropagationMessages(
                     const std::shared_ptr< PropagationPrintSettings > printSettings,
                     const std::string& propagationEndHeader,
-                    const std::shared_ptr< SingleArcVariationalSimulationResults< StateScalarType, TimeType > > propagationResults )
+                    const std::shared_ptr< SingleArcVariationalSimulationResults< StateScalarType, TimeType > > propagationResults,
+                    const simulation_setup::SystemOfBodies& bodies )
             {
                 printGenericSingleArcPostPropagationMessages(
                         printSettings, propagationEndHeader,
-                        SingleArcResultsRetriever< SingleArcVariationalSimulationResults< StateScalarType, TimeType >, StateScalarType, TimeType >::getSingleArcSimulationResults( propagationResults )  );
+                        SingleArcResultsRetriever< SingleArcVariationalSimulationResults< StateScalarType, TimeType >, StateScalarType, TimeType >::getSingleArcSimulationResults( propagationResults ),
+                        bodies );
             }
         };
 
@@ -625,7 +644,7 @@ public:
 template< typename StateScalarType, typename TimeType, int NumberOfColumns >
 struct PostProcessingFunctionProvider
 {
-    static std::function< void( Eigen::Matrix< StateScalarType, Eigen::Dynamic, NumberOfColumns >& ) > getPostProcessingFunction(
+    static std::function< void( Eigen::Matrix< StateScalarType, Eigen::Dynamic, NumberOfColumns >&, const TimeType ) > getPostProcessingFunction(
             const std::shared_ptr< DynamicsStateDerivativeModel< TimeType, StateScalarType > > stateDerivateModel )
     {
         throw std::runtime_error( "Error, post-processing function can only be retrieved for single-column or dynamic size" );
@@ -636,24 +655,24 @@ struct PostProcessingFunctionProvider
 template< typename StateScalarType, typename TimeType >
 struct PostProcessingFunctionProvider< StateScalarType, TimeType, 1 >
 {
-    static std::function< void( Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& ) > getPostProcessingFunction(
+    static std::function< void( Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >&, const TimeType ) > getPostProcessingFunction(
             const std::shared_ptr< DynamicsStateDerivativeModel< TimeType, StateScalarType > > stateDerivateModel )
     {
         return std::bind(
                 &DynamicsStateDerivativeModel< TimeType, StateScalarType >::postProcessState,
-                stateDerivateModel, std::placeholders::_1 );;
+                stateDerivateModel, std::placeholders::_1, std::placeholders::_2 );
     }
 };
 
 template< typename StateScalarType, typename TimeType >
 struct PostProcessingFunctionProvider< StateScalarType, TimeType, Eigen::Dynamic >
 {
-    static std::function< void( Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& ) > getPostProcessingFunction(
+    static std::function< void( Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >&, const TimeType ) > getPostProcessingFunction(
             const std::shared_ptr< DynamicsStateDerivativeModel< TimeType, StateScalarType > > stateDerivateModel )
     {
         return std::bind(
                 &DynamicsStateDerivativeModel< TimeType, StateScalarType >::postProcessStateAndVariationalEquations,
-                stateDerivateModel, std::placeholders::_1 );
+                stateDerivateModel, std::placeholders::_1, std::placeholders::_2 );
     }
 };
 
@@ -701,6 +720,28 @@ public:
         }
         checkPropagatedStatesFeasibility( propagatorSettings_, bodies_ );
 
+        // Enable dense output of the integrator, if results are to be saved at a fixed interval
+        if( !std::isnan( outputSettings_->getFixedResultsSaveInterval( ) ) )
+        {
+            try
+            {
+                numerical_integrators::setIntegratorDenseOutput( integratorSettings_, true );
+            }
+            catch( const std::runtime_error& error )
+            {
+                throw std::runtime_error( "Error in dynamics simulator, saving results at a fixed interval requires dense "
+                                          "output: " + std::string( error.what( ) ) );
+            }
+        }
+
+        if( !propagatorSettings_->getOutputSettings( )->getStoreResultsInMemory( ) &&
+                ( propagatorSettings_->getOutputSettings( )->getSetIntegratedResult( ) ||
+                  propagatorSettings_->getOutputSettings( )->getUpdateDependentVariableInterpolator( ) ) )
+        {
+            throw std::runtime_error( "Error in dynamics simulator, propagation results cannot be used to reset the environment or "
+                                      "dependent variable interpolator when the results are not stored in memory." );
+        }
+
         // Create objects that reset the environment (e.g. ephemerides) after propagation is required
         if( propagatorSettings_->getOutputSettings( )->getSetIntegratedResult( ) )
         {
@@ -738,6 +779,36 @@ public:
                 std::bind( &DynamicsStateDerivativeModel< TimeType, StateScalarType >::computeStateDerivative,
                            dynamicsStateDerivative_, std::placeholders::_1, std::placeholders::_2 );
 
+        // Create object that profiles the model evaluations, if requested
+        if( outputSettings_->getProfileModelEvaluations( ) )
+        {
+            if( !utilities::isModelEvaluationProfilingAvailable( ) )
+            {
+                throw std::runtime_error( "Error in dynamics simulator, model evaluation profiling requested, but Tudat is not "
+                                          "compiled with TUDAT_BUILD_WITH_PROPAGATION_PROFILING." );
+            }
+            modelEvaluationProfiler_ = std::make_shared< utilities::ModelEvaluationProfiler >( );
+            environmentUpdater_->setModelEvaluationProfiler( modelEvaluationProfiler_ );
+            dynamicsStateDerivative_->setModelEvaluationProfiler( modelEvaluationProfiler_ );
+        }
+
+        // Create object that fits the ephemerides of the perturbing bodies before the propagation, if requested
+        if( outputSettings_->getPerturbingBodyEphemerisInterpolationSettings( ) != nullptr )
+        {
+            std::vector< std::string > propagatedBodies;
+            std::map< IntegratedStateType, std::vector< std::tuple< std::string, std::string, PropagatorType > > >
+                    propagatedStateTypesAndBodies = getIntegratedTypeAndBodyList( propagatorSettings_ );
+            if( propagatedStateTypesAndBodies.count( translational_state ) > 0 )
+            {
+                for( auto bodyEntry : propagatedStateTypesAndBodies.at( translational_state ) )
+                {
+                    propagatedBodies.push_back( std::get< 0 >( bodyEntry ) );
+                }
+            }
+            perturbingBodyEphemerisInterpolator_ = std::make_shared< PerturbingBodyEphemerisInterpolator >(
+                        outputSettings_->getPerturbingBodyEphemerisInterpolationSettings( ), propagatedBodies );
+        }
+
         // Create object that determines if the propagation is to be terminated
         propagationTerminationCondition_ = createPropagationTerminationConditions(
                     propagatorSettings_->getTerminationSettings( ), bodies_,
@@ -764,14 +835,13 @@ public:
         // Create functions that compute the dependent variables
         if( propagatorSettings_->getDependentVariablesToSave( ).size( ) > 0 )
         {
-            std::pair< std::function< Eigen::VectorXd( ) >, std::map< std::pair< int, int >, std::string > > dependentVariableData =
-                    createDependentVariableListFunction< TimeType, StateScalarType >(
+            dependentVariablesWriter_ = createDependentVariablesWriter< TimeType, StateScalarType >(
                         propagatorSettings_->getDependentVariablesToSave( ), bodies_,
-                        orderedDependentVariableSettings_,
+                        orderedDependentVariableSettings_, dependentVariableIds_,
                         dynamicsStateDerivative_->getStateDerivativeModels( ),
                         predefinedStateDerivativeModels.stateDerivativePartials_ );
-            dependentVariablesFunctions_ = dependentVariableData.first;
-            dependentVariableIds_ = dependentVariableData.second;
+            dependentVariablesFunctions_ = std::bind(
+                        &DependentVariablesWriter::evaluateDependentVariables, dependentVariablesWriter_ );
         }
 
         // Create object that will contain and process the propagation results
@@ -782,11 +852,19 @@ public:
                 dependentVariableIds_,
                 orderedDependentVariableSettings_ );
 
+        std::shared_ptr< DynamicsStateDerivativeModel< TimeType, StateScalarType > > dynamicsStateDerivative = dynamicsStateDerivative_;
+        int numberOfResultConversionThreads =
+                propagatorSettings_->getOutputSettingsWithCheck( )->getNumberOfResultConversionThreads( );
         propagationResults_= std::make_shared< SingleArcSimulationResults< StateScalarType, TimeType > >(
                     integratedStateAndBodyList, propagatorSettings_->getOutputSettingsWithCheck( ),
-                    std::bind( &DynamicsStateDerivativeModel< TimeType, StateScalarType >::convertNumericalStateSolutionsToOutputSolutions,
-                               dynamicsStateDerivative_,
-                               std::placeholders::_1, std::placeholders::_2 ), dependentVariableInterface, sequentialPropagation_ ) ;
+                    [ = ]( std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& convertedSolution,
+                           const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& rawSolution )
+                    { dynamicsStateDerivative->convertNumericalStateSolutionsToOutputSolutions( convertedSolution, rawSolution ); },
+                    dependentVariableInterface, sequentialPropagation_,
+                    [ = ]( utilities::ContiguousTimeHistory< TimeType, StateScalarType >& convertedSolution,
+                           const utilities::ContiguousTimeHistory< TimeType, StateScalarType >& rawSolution )
+                    { dynamicsStateDerivative->convertNumericalStateSolutionsToOutputSolutions(
+                            convertedSolution, rawSolution, numberOfResultConversionThreads ); } );
 
         // Integrate equations of motion if required.
         if( areEquationsOfMotionToBeIntegrated )
@@ -872,9 +950,12 @@ public:
     void integrateEquationsOfMotion(
             const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& initialStates )
     {
+        finalPropagationCheckpoint_ = sequentialPropagation_ ? std::make_shared< SingleArcPropagationCheckpoint<
+                Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >, TimeType, typename scalar_type< TimeType >::value_type > >( ) :
+                                                                nullptr;
         integrateEquationsOfMotion< SingleArcSimulationResults< StateScalarType, TimeType > >(
             dynamicsStateDerivative_->convertFromOutputSolution( initialStates, propagatorSettings_->getInitialTime( ) ),
-                propagationResults_ );
+                propagationResults_, finalPropagationCheckpoint_ );
     }
 
     void integrate(
@@ -886,13 +967,28 @@ public:
     template< typename SimulationResults >
     void integrateEquationsOfMotion(
             const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& processedInitialState,
-            const std::shared_ptr< SimulationResults > propagationResults )
+            const std::shared_ptr< SimulationResults > propagationResults,
+            const std::shared_ptr< SingleArcPropagationCheckpoint<
+            Eigen::Matrix< StateScalarType, Eigen::Dynamic, SimulationResults::number_of_columns >, TimeType,
+            typename scalar_type< TimeType >::value_type > > finalCheckpoint = nullptr )
     {
+        TUDAT_TRACE_SCOPE( "single_arc_propagation", "propagation" );
         performPropagationPreProcessingSteps( propagationResults );
-        propagateDynamics< SimulationResults >( processedInitialState,
-                           propagationResults,
-                           PostProcessingFunctionProvider< StateScalarType, TimeType, SimulationResults::number_of_columns >::
-                                   getPostProcessingFunction( dynamicsStateDerivative_ ) );
+        replacePerturbingBodyEphemerides( propagatorSettings_->getInitialTime( ) );
+        try
+        {
+            propagateDynamics< SimulationResults >( processedInitialState,
+                               propagationResults,
+                               PostProcessingFunctionProvider< StateScalarType, TimeType, SimulationResults::number_of_columns >::
+                                       getPostProcessingFunction( dynamicsStateDerivative_ ),
+                               nullptr, finalCheckpoint );
+        }
+        catch( ... )
+        {
+            restorePerturbingBodyEphemerides( );
+            throw;
+        }
+        restorePerturbingBodyEphemerides( );
         performPropagationPostProcessingSteps( propagationResults );
     }
 
@@ -968,6 +1064,17 @@ public:
         return environmentUpdater_;
     }
 
+    //! Function to get the object that fits the ephemerides of the perturbing bodies before the propagation
+    /*!
+     * Function to get the object that fits the ephemerides of the perturbing bodies before the propagation (see
+     * SingleArcPropagatorProcessingSettings::setPerturbingBodyEphemerisInterpolationSettings).
+     * \return Object that fits the ephemerides of the perturbing bodies (nullptr if the ephemerides are not fitted)
+     */
+    std::shared_ptr< PerturbingBodyEphemerisInterpolator > getPerturbingBodyEphemerisInterpolator( )
+    {
+        return perturbingBodyEphemerisInterpolator_;
+    }
+
     //! Function to get the object that updates and returns state derivative
     /*!
      * Function to get the object that updates current environment and returns state derivative from single function call
@@ -1030,6 +1137,12 @@ public:
         return dependentVariablesFunctions_;
     }
 
+    //! Function to retrieve the object that writes the dependent variables directly into the propagation results
+    std::shared_ptr< DependentVariablesWriter > getDependentVariablesWriter( )
+    {
+        return dependentVariablesWriter_;
+    }
+
     //! Function to reset the object that checks whether the simulation has finished from
     //! (newly defined) propagation settings.
     /*!
@@ -1044,6 +1157,136 @@ public:
                     dynamicsStateDerivative_->getStateDerivativeModels( ) );
     }
 
+    //! Function to re-run the propagation with a new initial state and (optionally) new termination settings.
+    /*!
+     *  Function to re-run the propagation with a new initial state and (optionally) new termination settings. This is the
+     *  fast path for repeated propagations with the same dynamical model (e.g. Monte Carlo analyses): all environment,
+     *  acceleration and state derivative models, as well as the dependent variable functions and results object, of this
+     *  simulator are reused, and only the termination conditions are recreated. The results of the previous propagation
+     *  are overwritten. To also modify the initial time, call resetInitialPropagationTime before this function. Changes
+     *  made to the existing environment models (e.g. new body masses or gravity field coefficients) are taken into
+     *  account; see also the overload of this function that takes a parameter set.
+     *  \param initialStates Initial state vector that is to be used for numerical integration (in conventional, not
+     *  propagator-specific, form; see integrateEquationsOfMotion).
+     *  \param terminationSettings New termination settings (if nullptr, the current termination settings are used).
+     */
+    void resetAndIntegrateEquationsOfMotion(
+            const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& initialStates,
+            const std::shared_ptr< PropagationTerminationSettings > terminationSettings = nullptr )
+    {
+        if( terminationSettings != nullptr )
+        {
+            propagatorSettings_->resetTerminationSettings( terminationSettings );
+        }
+        propagatorSettings_->resetInitialStates( initialStates );
+        integrateEquationsOfMotion( propagatorSettings_->getInitialStates( ) );
+    }
+
+    //! Function to re-run the propagation with new parameter values, a new initial state and (optionally) new termination
+    //! settings.
+    /*!
+     *  Function to re-run the propagation with new parameter values, a new initial state and (optionally) new termination
+     *  settings. The parameter values are reset through the parameter set (which must have been created for the bodies
+     *  used by this simulator), after which the propagation is performed as by resetAndIntegrateEquationsOfMotion.
+     *  Note that initial state parameters in the parameter set are only updated in the set, and are not used as the
+     *  initial state of the propagation.
+     *  \param initialStates Initial state vector that is to be used for numerical integration (in conventional, not
+     *  propagator-specific, form; see integrateEquationsOfMotion).
+     *  \param parameterSet Set of parameters defining the properties of the environment that are to be reset.
+     *  \param parameterValues New values of the parameters in parameterSet (in the order of
+     *  EstimatableParameterSet::getFullParameterValues).
+     *  \param terminationSettings New termination settings (if nullptr, the current termination settings are used).
+     */
+    template< typename ParameterScalar >
+    void resetAndIntegrateEquationsOfMotion(
+            const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& initialStates,
+            const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ParameterScalar > > parameterSet,
+            const Eigen::Matrix< ParameterScalar, Eigen::Dynamic, 1 >& parameterValues,
+            const std::shared_ptr< PropagationTerminationSettings > terminationSettings = nullptr )
+    {
+        if( parameterSet == nullptr )
+        {
+            throw std::runtime_error( "Error when resetting dynamics simulator, no parameter set provided." );
+        }
+        parameterSet->resetParameterValues( parameterValues );
+        resetAndIntegrateEquationsOfMotion( initialStates, terminationSettings );
+    }
+
+    //! Function to continue the last propagation from its final state, up to new termination settings
+    /*!
+     *  Function to continue the last propagation (performed by integrateEquationsOfMotion or
+     *  resetAndIntegrateEquationsOfMotion) from its final state, up to new termination settings (e.g. a later final time).
+     *  The propagation is resumed from the internal state of the integrator after the final step of the last propagation
+     *  (including the state history of multi-step integrators, and the step size of variable step-size integrators), so
+     *  that the results are identical to a single propagation up to the new termination conditions (except for the
+     *  epoch at which the last propagation was terminated, if it was terminated exactly on its termination condition).
+     *  For integrators that do not support this, the integrator is restarted from the final state. The new results
+     *  are appended to the existing results object (including the dependent variables, computation times and number of
+     *  function evaluations), and the environment (e.g. TabulatedCartesianEphemeris of propagated bodies) is updated
+     *  with the full results, as for a regular propagation. Result sinks are restarted, and receive the results from the
+     *  final epoch of the last propagation onwards. The environment models are not reset, so this function should not be
+     *  combined with changes to them. Not available for non-sequential propagations, or if the results of the last
+     *  propagation have been cleared.
+     *  \param terminationSettings New termination settings (replacing those in the propagator settings). If nullptr, the
+     *  current termination settings are used.
+     */
+    void extendPropagation( const std::shared_ptr< PropagationTerminationSettings > terminationSettings )
+    {
+        if( !sequentialPropagation_ )
+        {
+            throw std::runtime_error( "Error when extending propagation, only sequential propagations can be extended." );
+        }
+        else if( finalPropagationCheckpoint_ == nullptr || !propagationResults_->integrationCompletedSuccessfully( ) )
+        {
+            throw std::runtime_error( "Error when extending propagation, no successfully completed propagation is available." );
+        }
+
+        // Retrieve results of last propagation, to which new results are appended
+        std::shared_ptr< SingleArcPropagationCheckpoint< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >, TimeType,
+                typename scalar_type< TimeType >::value_type > > continuationCheckpoint = finalPropagationCheckpoint_;
+        continuationCheckpoint->solutionHistory_ = propagationResults_->getEquationsOfMotionNumericalSolutionRaw( );
+        continuationCheckpoint->dependentVariableHistory_ = propagationResults_->getDependentVariableHistory( );
+        continuationCheckpoint->cumulativeComputationTimeHistory_ = propagationResults_->getCumulativeComputationTimeHistory( );
+        std::map< TimeType, unsigned int > previousNumberOfFunctionEvaluations =
+                propagationResults_->getCumulativeNumberOfFunctionEvaluations( );
+        PropagationStepStatistics previousStepStatistics = propagationResults_->getStepStatistics( );
+
+        if( terminationSettings != nullptr )
+        {
+            propagatorSettings_->resetTerminationSettings( terminationSettings );
+        }
+
+        TUDAT_TRACE_SCOPE( "single_arc_propagation", "propagation" );
+        TimeType continuationTime = continuationCheckpoint->integratorCheckpoint_.currentIndependentVariable_;
+        Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > continuationState =
+                continuationCheckpoint->integratorCheckpoint_.currentState_;
+        finalPropagationCheckpoint_ = std::make_shared< SingleArcPropagationCheckpoint<
+                Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >, TimeType, typename scalar_type< TimeType >::value_type > >( );
+
+        performPropagationPreProcessingSteps( propagationResults_ );
+        replacePerturbingBodyEphemerides( continuationTime );
+        try
+        {
+            propagateDynamics< SingleArcSimulationResults< StateScalarType, TimeType > >(
+                        continuationState, propagationResults_,
+                        PostProcessingFunctionProvider< StateScalarType, TimeType, 1 >::getPostProcessingFunction(
+                            dynamicsStateDerivative_ ),
+                        continuationCheckpoint, finalPropagationCheckpoint_, continuationTime );
+        }
+        catch( ... )
+        {
+            restorePerturbingBodyEphemerides( );
+            finalPropagationCheckpoint_ = nullptr;
+            throw;
+        }
+        restorePerturbingBodyEphemerides( );
+
+        PropagationStepStatistics stepStatistics = propagationResults_->getStepStatistics( );
+        stepStatistics.addStatistics( previousStepStatistics );
+        propagationResults_->setStepStatistics( stepStatistics );
+        performPropagationPostProcessingSteps( propagationResults_, previousNumberOfFunctionEvaluations );
+    }
+
     //! This function updates the environment with the numerical solution of the propagation.
     /*!
      *  This function updates the environment with the numerical solution of the propagation. It sets
@@ -1056,6 +1299,7 @@ public:
         {
             try {
                 // Create and set interpolators for ephemerides
+                propagationResults_->synchronizeSolutionMaps( );
                 resetIntegratedStates( propagationResults_->equationsOfMotionNumericalSolution_,
                                        integratedStateProcessors_ );
             }
@@ -1129,6 +1373,7 @@ public:
      */
     const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& getEquationsOfMotionNumericalSolution( )
     {
+        propagationResults_->synchronizeSolutionMaps( );
         return propagationResults_->equationsOfMotionNumericalSolution_;
     }
 
@@ -1139,6 +1384,7 @@ public:
      */
     const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& getEquationsOfMotionNumericalSolutionRaw( )
     {
+        propagationResults_->synchronizeSolutionMaps( );
         return propagationResults_->equationsOfMotionNumericalSolutionRaw_;
     }
 
@@ -1149,6 +1395,7 @@ public:
      */
     const std::map< TimeType, Eigen::VectorXd >& getDependentVariableHistory( )
     {
+        propagationResults_->synchronizeSolutionMaps( );
         return propagationResults_->dependentVariableHistory_;
     }
 
@@ -1232,6 +1479,12 @@ protected:
      */
     std::shared_ptr< EnvironmentUpdater< StateScalarType, TimeType > > environmentUpdater_;
 
+    //! Object to which the model evaluations are profiled (nullptr if not profiled)
+    std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler_;
+
+    //! Object that fits the ephemerides of the perturbing bodies before the propagation (nullptr if not fitted)
+    std::shared_ptr< PerturbingBodyEphemerisInterpolator > perturbingBodyEphemerisInterpolator_;
+
     //! Interface object that updates current environment and returns state derivative from single function call.
     std::shared_ptr< DynamicsStateDerivativeModel< TimeType, StateScalarType > > dynamicsStateDerivative_;
 
@@ -1257,6 +1510,9 @@ protected:
     //! Function returning dependent variables (during numerical propagation)
     std::function< Eigen::VectorXd( ) > dependentVariablesFunctions_;
 
+    //! Object writing dependent variables directly into the propagation results (during numerical propagation)
+    std::shared_ptr< DependentVariablesWriter > dependentVariablesWriter_;
+
 //    std::map< std::pair< int, int >, std::string > dependentVariableIds_;
 //
 //    std::map< std::pair< int, int >, std::string > processedStateIds_;
@@ -1273,6 +1529,10 @@ protected:
     //! Boolean denoting whether the propagation is performing sequentially, or both forward and backward (default = true).
     bool sequentialPropagation_;
 
+    //! State of the last propagation after its final step, from which it can be continued (see extendPropagation)
+    std::shared_ptr< SingleArcPropagationCheckpoint< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >, TimeType,
+    typename scalar_type< TimeType >::value_type > > finalPropagationCheckpoint_;
+
 
 private:
 
@@ -1290,25 +1550,52 @@ private:
     void propagateDynamics(
             const Eigen::Matrix< StateScalarType, Eigen::Dynamic, SimulationResults::number_of_columns >& processedInitialState,
             const std::shared_ptr< SimulationResults > propagationResults,
-            const std::function< void( Eigen::Matrix< StateScalarType, Eigen::Dynamic, SimulationResults::number_of_columns >& ) > statePostProcessingFunction )
+            const std::function< void( Eigen::Matrix< StateScalarType, Eigen::Dynamic, SimulationResults::number_of_columns >&,
+                                       const TimeType ) > statePostProcessingFunction,
+            const std::shared_ptr< SingleArcPropagationCheckpoint<
+            Eigen::Matrix< StateScalarType, Eigen::Dynamic, SimulationResults::number_of_columns >, TimeType,
+            typename scalar_type< TimeType >::value_type > > continuationCheckpoint = nullptr,
+            const std::shared_ptr< SingleArcPropagationCheckpoint<
+            Eigen::Matrix< StateScalarType, Eigen::Dynamic, SimulationResults::number_of_columns >, TimeType,
+            typename scalar_type< TimeType >::value_type > > finalCheckpoint = nullptr,
+            const TimeType continuationTime = TUDAT_NAN )
     {
         // Integrate equations of motion numerically.
         simulation_setup::setAreBodiesInPropagation( bodies_, true );
         dynamicsStateDerivative_->updateStateDerivativeModelSettings( processedInitialState.block(
                 0, processedInitialState.cols( ) - 1, processedInitialState.rows(), 1  ) );
 
+        // Create function to convert dynamics state to conventional form, for streaming to result sinks
+        std::function< Eigen::VectorXd( const Eigen::Matrix< StateScalarType, Eigen::Dynamic, SimulationResults::number_of_columns >&,
+                                        const TimeType ) > sinkStateConversionFunction = nullptr;
+        if( propagatorSettings_->getOutputSettings( )->getResultSinks( ).size( ) > 0 )
+        {
+            std::shared_ptr< DynamicsStateDerivativeModel< TimeType, StateScalarType > > dynamicsStateDerivative = dynamicsStateDerivative_;
+            sinkStateConversionFunction = [ = ](
+                    const Eigen::Matrix< StateScalarType, Eigen::Dynamic, SimulationResults::number_of_columns >& state,
+                    const TimeType time )
+            {
+                return Eigen::VectorXd( dynamicsStateDerivative->convertToOutputSolution(
+                                            state.col( state.cols( ) - 1 ), time ).template cast< double >( ) );
+            };
+        }
+
         if ( sequentialPropagation_ )
         {
             integrateEquations< SimulationResults, Eigen::Matrix< StateScalarType, Eigen::Dynamic, SimulationResults::number_of_columns >, TimeType >(
                     stateDerivativeFunction_,
                     processedInitialState ,
-                    propagatorSettings_->getInitialTime( ),
+                    ( continuationCheckpoint == nullptr ) ? propagatorSettings_->getInitialTime( ) : continuationTime,
                     integratorSettings_,
                     propagationTerminationCondition_,
                     propagationResults,
                     dependentVariablesFunctions_,
                     statePostProcessingFunction,
-                    propagatorSettings_->getOutputSettings( ) );
+                    propagatorSettings_->getOutputSettings( ),
+                    sinkStateConversionFunction,
+                    dependentVariablesWriter_,
+                    continuationCheckpoint,
+                    finalCheckpoint );
         }
         else
         {
@@ -1323,7 +1610,9 @@ private:
                     propagationResults,
                     dependentVariablesFunctions_,
                     statePostProcessingFunction,
-                    propagatorSettings_->getOutputSettings( ) );
+                    propagatorSettings_->getOutputSettings( ),
+                    sinkStateConversionFunction,
+                    dependentVariablesWriter_ );
 
             integratorSettings_->initialTimeStep_ *= -1.0;
             integrateEquations< SimulationResults, Eigen::Matrix< StateScalarType, Eigen::Dynamic, SimulationResults::number_of_columns >, TimeType >(
@@ -1335,7 +1624,9 @@ private:
                     propagationResults,
                     dependentVariablesFunctions_,
                     statePostProcessingFunction,
-                    propagatorSettings_->getOutputSettings( ) );
+                    propagatorSettings_->getOutputSettings( ),
+                    sinkStateConversionFunction,
+                    dependentVariablesWriter_ );
             integratorSettings_->initialTimeStep_ *= -1.0;
         }
 
@@ -1347,6 +1638,7 @@ private:
      *  Function to perform steps necessary to reset all relevant models for the upcoming propagation:
      *  - Whether to propagate dynamics and/or vatiational equations
      *  - Reset counter of function evaluations to zero
+     *  - Force recomputation of all environment models
      *  - Reset termination conditions
      *  - Empty object holding the numerical simulation results of the previous run
      *  - Print messages to terminal, as requested by user settings
@@ -1359,7 +1651,16 @@ private:
         dynamicsStateDerivative_->setPropagationSettings( std::vector< IntegratedStateType >( ), true, SimulationResults::is_variational );
         dynamicsStateDerivative_->resetFunctionEvaluationCounter( );
         dynamicsStateDerivative_->resetCumulativeFunctionEvaluationCounter( );
+        environmentUpdater_->resetCurrentTime( );
         resetPropagationTerminationConditions( );
+        if( modelEvaluationProfiler_ != nullptr )
+        {
+            modelEvaluationProfiler_->resetStatistics( );
+        }
+        if( outputSettings_->getPrintSettings( )->getPrintEphemerisStateCacheStatistics( ) )
+        {
+            simulation_setup::resetEphemerisStateCacheStatistics( bodies_ );
+        }
 
         // Empty solution maps
         propagationResults->reset( );
@@ -1370,6 +1671,29 @@ private:
                 propagationResults );
     }
 
+    //! Function to replace the ephemerides of the perturbing bodies by fits over the propagation interval (if requested)
+    void replacePerturbingBodyEphemerides( const TimeType propagationStartTime )
+    {
+        if( perturbingBodyEphemerisInterpolator_ != nullptr )
+        {
+            std::pair< double, double > interpolationInterval = getPerturbingBodyEphemerisInterpolationInterval(
+                        static_cast< double >( propagationStartTime ),
+                        propagatorSettings_->getTerminationSettings( ),
+                        outputSettings_->getPerturbingBodyEphemerisInterpolationSettings( ) );
+            perturbingBodyEphemerisInterpolator_->replaceEphemerides(
+                        bodies_, interpolationInterval.first, interpolationInterval.second );
+        }
+    }
+
+    //! Function to restore the ephemerides of the perturbing bodies after the propagation (if they were replaced)
+    void restorePerturbingBodyEphemerides( )
+    {
+        if( perturbingBodyEphemerisInterpolator_ != nullptr )
+        {
+            perturbingBodyEphemerisInterpolator_->restoreEphemerides( );
+        }
+    }
+
     //! Function to perform steps necessary to finalize the propagation
     /*
      *  Function to perform steps necessary to finalize the propagation
@@ -1380,14 +1704,36 @@ private:
      */
     template< typename SimulationResults >
     void performPropagationPostProcessingSteps(
-            const std::shared_ptr< SimulationResults > propagationResults )
+            const std::shared_ptr< SimulationResults > propagationResults,
+            const std::map< TimeType, unsigned int >& previousNumberOfFunctionEvaluations =
+            std::map< TimeType, unsigned int >( ) )
     {
-        // Retrieve number of cumulative function evaluations
-        propagationResults->finalizePropagation( dynamicsStateDerivative_->getCumulativeNumberOfFunctionEvaluations( ) );
+        // Retrieve number of cumulative function evaluations (appended to those of previous propagation, if continued)
+        std::map< TimeType, unsigned int > cumulativeNumberOfFunctionEvaluations =
+                dynamicsStateDerivative_->getCumulativeNumberOfFunctionEvaluations( );
+        if( previousNumberOfFunctionEvaluations.size( ) > 0 )
+        {
+            unsigned int previousTotalNumberOfFunctionEvaluations = std::max(
+                        previousNumberOfFunctionEvaluations.begin( )->second,
+                        previousNumberOfFunctionEvaluations.rbegin( )->second );
+            std::map< TimeType, unsigned int > appendedNumberOfFunctionEvaluations = previousNumberOfFunctionEvaluations;
+            for( auto evaluationsIterator : cumulativeNumberOfFunctionEvaluations )
+            {
+                appendedNumberOfFunctionEvaluations[ evaluationsIterator.first ] =
+                        previousTotalNumberOfFunctionEvaluations + evaluationsIterator.second;
+            }
+            cumulativeNumberOfFunctionEvaluations = appendedNumberOfFunctionEvaluations;
+        }
+        propagationResults->finalizePropagation( cumulativeNumberOfFunctionEvaluations );
+        if( modelEvaluationProfiler_ != nullptr )
+        {
+            propagationResults->setModelEvaluationProfile(
+                        std::make_shared< utilities::ModelEvaluationProfiler >( *modelEvaluationProfiler_ ) );
+        }
         PropagationPrintingInterface< SimulationResults, StateScalarType, TimeType >::printSingleArcPostPropagationMessages(
                 outputSettings_->getPrintSettings( ),
                                                outputSettings_->getPropagationEndHeader( ),
-                                               propagationResults );
+                                               propagationResults, bodies_ );
         processNumericalEquationsOfMotionSolution( );
     }
 };
@@ -1582,6 +1928,24 @@ public:
         updateInitialStates_ = false;
     }
 
+    //! Function to check whether the initial state of any arc is to be retrieved from the propagation of the preceding arc
+    /*!
+     * Function to check whether the initial state of any arc is to be retrieved from the propagation of the preceding arc
+     * (denoted by NaN entries in the list of arc initial states).
+     * \return True if any arc initial state is to be retrieved from the preceding arc
+     */
+    bool isAnyArcInitialStateFromPreviousArc( )
+    {
+        for( unsigned int i = 0; i < initialStatesList_.size( ); i++ )
+        {
+            if( linear_algebra::doesMatrixHaveNanEntries( initialStatesList_.at( i ) ) )
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
     bool getUpdateInitialStates( )
     {
         return updateInitialStates_;
@@ -1681,11 +2045,69 @@ void checkPropagationResultsObjectConsistency(
     }
 }
 
+//! Function to determine groups of arcs that can be propagated concurrently
+/*!
+ * Function to determine groups of arcs that can be propagated concurrently. Two arcs are placed in the same group if their
+ * SystemOfBodies objects share any Body object (directly, or through other arcs in the group). Arcs within a single group
+ * must be propagated sequentially, while separate groups can be propagated concurrently. Shared state outside of the
+ * Body objects is not considered (see simulation_setup::doSystemsOfBodiesShareBodies). In particular, arcs using
+ * Spice-backed ephemerides or rotation models are not grouped together for this reason. This is safe because all CSPICE
+ * calls are serialized by a single mutex, but such arcs contend for this mutex when propagated concurrently (which may be
+ * avoided by pre-sampling the Spice ephemerides, see BodyListSettings::setSpiceEphemerisPreSampling).
+ * \param arcWiseBodies List of SystemOfBodies objects, used for each of the arcs
+ * \return List of groups of arc indices (with the arc indices in each group, and the groups themselves, in ascending order)
+ */
+inline std::vector< std::vector< int > > getIndependentArcGroups(
+        const std::vector< simulation_setup::SystemOfBodies >& arcWiseBodies )
+{
+    std::vector< std::vector< int > > arcGroups;
+    for( unsigned int i = 0; i < arcWiseBodies.size( ); i++ )
+    {
+        // Find all existing groups with which the current arc shares bodies
+        std::vector< int > dependentGroups;
+        for( unsigned int j = 0; j < arcGroups.size( ); j++ )
+        {
+            for( unsigned int k = 0; k < arcGroups.at( j ).size( ); k++ )
+            {
+                if( simulation_setup::doSystemsOfBodiesShareBodies(
+                        arcWiseBodies.at( i ), arcWiseBodies.at( arcGroups.at( j ).at( k ) ) ) )
+                {
+                    dependentGroups.push_back( j );
+                    break;
+                }
+            }
+        }
+
+        // Create new group, or merge all dependent groups into first one, and add current arc
+        if( dependentGroups.size( ) == 0 )
+        {
+            arcGroups.push_back( std::vector< int >( { static_cast< int >( i ) } ) );
+        }
+        else
+        {
+            std::vector< int >& mergedGroup = arcGroups.at( dependentGroups.at( 0 ) );
+            for( int j = static_cast< int >( dependentGroups.size( ) ) - 1; j > 0; j-- )
+            {
+                mergedGroup.insert( mergedGroup.end( ), arcGroups.at( dependentGroups.at( j ) ).begin( ),
+                                    arcGroups.at( dependentGroups.at( j ) ).end( ) );
+                arcGroups.erase( arcGroups.begin( ) + dependentGroups.at( j ) );
+            }
+            mergedGroup.push_back( i );
+            std::sort( mergedGroup.begin( ), mergedGroup.end( ) );
+        }
+    }
+    return arcGroups;
+}
+
 //! Class for performing full numerical integration of a dynamical system over multiple arcs.
 /*!
  *  Class for performing full numerical integration of a dynamical system over multiple arcs, equations of motion are set up
  *  for each arc (and need not be equal for each arc). In this class, the governing equations are set once,
  *  but can be re-integrated for different initial conditions using the same instance of the class.
+ *  Arcs can be propagated concurrently (see MultiArcPropagatorProcessingSettings::setNumberOfThreads), provided that they
+ *  are defined on separate environments (provided by the arcWiseBodies constructor input, with the acceleration, torque,
+ *  etc. models in the arc propagator settings created from the same environment), and that no arc initial state
+ *  is obtained from the preceding arc. The propagation results are identical to those of a sequential propagation.
  */
 template< typename StateScalarType = double, typename TimeType = double >
 class MultiArcDynamicsSimulator: public DynamicsSimulator< StateScalarType, TimeType > {
@@ -1694,10 +2116,24 @@ public:
     typedef MultiArcSimulationResults<SingleArcSimulationResults, StateScalarType, TimeType> MultiArcResults;
     using DynamicsSimulator<StateScalarType, TimeType>::bodies_;
 
+    //! Constructor of multi-arc simulator
+    /*!
+     *  Constructor of multi-arc simulator
+     *  \param bodies Map of bodies (with names) of all bodies in integration. The integrated results are used to update
+     *  this environment (if requested by the output settings).
+     *  \param propagatorSettings Propagator settings for dynamics (must be of multi arc type)
+     *  \param areEquationsOfMotionToBeIntegrated Boolean to denote whether equations of motion should be integrated at
+     *  the end of the contructor or not.
+     *  \param arcWiseBodies List of bodies that are to be used for the propagation of each arc (empty by default, in which
+     *  case the bodies input is used for all arcs). Arcs for which the environments do not share any Body objects can be
+     *  propagated concurrently.
+     */
     MultiArcDynamicsSimulator(
             const simulation_setup::SystemOfBodies &bodies,
             const std::shared_ptr<MultiArcPropagatorSettings<StateScalarType, TimeType> > propagatorSettings,
-            const bool areEquationsOfMotionToBeIntegrated = true ) :
+            const bool areEquationsOfMotionToBeIntegrated = true,
+            const std::vector< simulation_setup::SystemOfBodies >& arcWiseBodies =
+            std::vector< simulation_setup::SystemOfBodies >( ) ) :
             DynamicsSimulator<StateScalarType, TimeType>(
                     bodies, propagatorSettings ),
             multiArcPropagatorSettings_( propagatorSettings )
@@ -1712,12 +2148,34 @@ public:
             std::vector<std::shared_ptr<SingleArcPropagatorSettings<StateScalarType, TimeType> > > singleArcSettings =
                     multiArcPropagatorSettings_->getSingleArcSettings( );
 
+            if( arcWiseBodies.size( ) != 0 && arcWiseBodies.size( ) != singleArcSettings.size( ) )
+            {
+                throw std::runtime_error( "Error when creating multi-arc dynamics simulator, " +
+                                          std::to_string( arcWiseBodies.size( ) ) + " arc-wise environments provided for " +
+                                          std::to_string( singleArcSettings.size( ) ) + " arcs." );
+            }
+
+            // Determine which arcs can be propagated concurrently
+            if( arcWiseBodies.size( ) > 0 )
+            {
+                independentArcGroups_ = getIndependentArcGroups( arcWiseBodies );
+            }
+            else
+            {
+                independentArcGroups_.resize( 1 );
+                for ( unsigned int i = 0; i < singleArcSettings.size( ); i++ )
+                {
+                    independentArcGroups_.at( 0 ).push_back( i );
+                }
+            }
+
             // Create dynamics simulators
             std::vector<std::shared_ptr<SingleArcSimulationResults<StateScalarType, TimeType> > > singleArcResults;
             for ( unsigned int i = 0; i < singleArcSettings.size( ); i++ ) {
                 singleArcDynamicsSimulators_.push_back(
                         std::make_shared<SingleArcDynamicsSimulator<StateScalarType, TimeType> >(
-                                bodies, singleArcSettings.at( i ), false ));
+                                ( arcWiseBodies.size( ) > 0 ) ? arcWiseBodies.at( i ) : bodies,
+                                singleArcSettings.at( i ), false ));
                 singleArcResults.push_back( singleArcDynamicsSimulators_.at( i )->getSingleArcPropagationResults( ));
                 singleArcDynamicsSimulators_.at( i )->createAndSetIntegratedStateProcessors( );
             }
@@ -1863,10 +2321,24 @@ public:
     }
 
 
+    //! This function numerically (re-)integrates the equations of motion for all arcs, storing results in given object
+    /*!
+     *  This function numerically (re-)integrates the equations of motion for all arcs, storing the results in the given
+     *  object (which may include the variational equations).
+     *  \param propagationResults Object in which the results of all arcs are stored
+     *  \param initialStateProvider Object providing the initial state of each arc
+     *  \param arcPropagationCompletedFunction Function that is called (with the arc index as input) directly after the
+     *  propagation of each arc, from the thread that propagated the arc. When arcs are propagated concurrently (see
+     *  constructor), this function may be called concurrently for different arcs. None by default.
+     *  \param processSolution Boolean denoting whether the environment is to be updated with the propagated dynamics after
+     *  the propagation of all arcs (if requested by the output settings, see processNumericalEquationsOfMotionSolution)
+     */
     template< typename MultiArcSimulationResults >
     void integrateEquationsOfMotion(
             const std::shared_ptr< MultiArcSimulationResults > propagationResults,
-            const std::shared_ptr< MultiArcInitialStateProvider< StateScalarType > > initialStateProvider )
+            const std::shared_ptr< MultiArcInitialStateProvider< StateScalarType > > initialStateProvider,
+            const std::function< void( const int ) >& arcPropagationCompletedFunction = std::function< void( const int ) >( ),
+            const bool processSolution = true )
     {
         checkPropagationResultsObjectConsistency< StateScalarType, TimeType, MultiArcSimulationResults >(
                 propagationResults_,
@@ -1881,15 +2353,49 @@ public:
 
         printPrePropagationMessages( );
 
+        int numberOfThreads = multiArcPropagatorSettings_->getOutputSettings( )->getNumberOfThreads( );
+        if( numberOfThreads > 1 && independentArcGroups_.size( ) > 1 &&
+                !initialStateProvider->isAnyArcInitialStateFromPreviousArc( ) )
+        {
+            // Retrieve all arc initial states before propagation, none depend on preceding arc
+            for( unsigned int i = 0; i < singleArcDynamicsSimulators_.size( ); i++ )
+            {
+                arcInitialStateList.push_back( getArcInitialState( i, initialStateProvider ) );
+            }
 
-        // Propagate dynamics for each arc
-        for( unsigned int i = 0; i < singleArcDynamicsSimulators_.size( ); i++ )
+            // Propagate groups of arcs concurrently, with the arcs in each group propagated in order
+            utilities::executeParallelTasks(
+                        independentArcGroups_.size( ), [ & ]( const int groupIndex )
+            {
+                for( int arcIndex : independentArcGroups_.at( groupIndex ) )
+                {
+                    TUDAT_TRACE_SCOPE_WITH_INDEX( "arc_propagation", "propagation", arcIndex );
+                    singleArcDynamicsSimulators_.at( arcIndex )->template integrateEquationsOfMotion<
+                            typename MultiArcSimulationResults::single_arc_type >(
+                                arcInitialStateList.at( arcIndex ), propagationResults->getSingleArcResults( ).at( arcIndex ) );
+                    if( arcPropagationCompletedFunction )
+                    {
+                        arcPropagationCompletedFunction( arcIndex );
+                    }
+                }
+            }, numberOfThreads );
+        }
+        else
         {
-            currentArcInitialState = getArcInitialState( i, initialStateProvider );
-            arcInitialStateList.push_back( currentArcInitialState );
+            // Propagate dynamics for each arc
+            for( unsigned int i = 0; i < singleArcDynamicsSimulators_.size( ); i++ )
+            {
+                TUDAT_TRACE_SCOPE_WITH_INDEX( "arc_propagation", "propagation", i );
+                currentArcInitialState = getArcInitialState( i, initialStateProvider );
+                arcInitialStateList.push_back( currentArcInitialState );
 
-            singleArcDynamicsSimulators_.at( i )->template integrateEquationsOfMotion<
-                    typename MultiArcSimulationResults::single_arc_type >( currentArcInitialState, propagationResults->getSingleArcResults( ).at( i ) );
+                singleArcDynamicsSimulators_.at( i )->template integrateEquationsOfMotion<
+                        typename MultiArcSimulationResults::single_arc_type >( currentArcInitialState, propagationResults->getSingleArcResults( ).at( i ) );
+                if( arcPropagationCompletedFunction )
+                {
+                    arcPropagationCompletedFunction( i );
+                }
+            }
         }
 
         printPostPropagationMessages( );
@@ -1909,7 +2415,10 @@ public:
                         newInitialStates );
         }
 
-        processNumericalEquationsOfMotionSolution( );
+        if( processSolution )
+        {
+            processNumericalEquationsOfMotionSolution( );
+        }
     }
 
 
@@ -2139,6 +2648,9 @@ protected:
 
     std::shared_ptr< MultiArcResults > propagationResults_;
 
+    //! Groups of arc indices that can be propagated concurrently (arcs within each group are propagated sequentially)
+    std::vector< std::vector< int > > independentArcGroups_;
+
 };
 
 
@@ -0,0 +1,627 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Montenbruck, O. and Gill, E., Satellite Orbits: Models, Methods, and Applications, Springer, 2005.
+ */
+
+#ifndef TUDAT_ENSEMBLEDEVICEPROPAGATION_H
+#define TUDAT_ENSEMBLEDEVICEPROPAGATION_H
+
+#include <cmath>
+
+#include "tudat/basics/utilityMacros.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Maximum degree of the zonal gravity field of the central body that is supported by the device propagation
+constexpr int maximumDeviceZonalDegree = 6;
+
+//! Maximum number of stages of the Runge-Kutta method that is supported by the device propagation
+constexpr int maximumNumberOfDeviceRungeKuttaStages = 35;
+
+//! Atmosphere models that are supported by the device propagation
+enum DeviceAtmosphereModelTypes
+{
+    no_device_atmosphere = 0,
+    exponential_device_atmosphere = 1,
+    tabulated_device_atmosphere = 2
+};
+
+//! Status of a member at the end of the device propagation
+enum DeviceEnsembleMemberStatus
+{
+    device_member_propagation_successful = 0,
+    device_member_minimum_step_exceeded = 1,
+    device_member_non_finite_state = 2,
+    device_member_maximum_number_of_steps_exceeded = 3
+};
+
+//! Plain-data description of the (simplified) dynamical model and integrator of a device ensemble propagation
+/*!
+ *  Plain-data description of the dynamical model and integrator of a device ensemble propagation, as extracted from the
+ *  environment and settings by DeviceEnsembleDynamicsSimulator. All states and positions are w.r.t. the central body,
+ *  in the global frame orientation. The tabulated data (states of perturbing bodies, atmospheric density, Butcher
+ *  tableau) are passed separately to propagateEnsembleOnDevice.
+ */
+struct DeviceEnsembleDynamicsModel
+{
+    //! Gravitational parameter of the central body (zero if it exerts no gravitational acceleration)
+    double centralBodyGravitationalParameter = 0.0;
+
+    //! Reference radius of the zonal gravity field of the central body
+    double centralBodyReferenceRadius = 0.0;
+
+    //! Maximum degree of the zonal gravity field of the central body (zero for a point mass)
+    int maximumZonalDegree = 0;
+
+    //! Unnormalized zonal cosine coefficients of the central body (entry n for degree n, i.e. -J_n)
+    double zonalCoefficients[ maximumDeviceZonalDegree + 1 ] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+
+    //! Direction of the rotation axis of the central body (unit vector)
+    double poleDirection[ 3 ] = { 0.0, 0.0, 1.0 };
+
+    //! Rotation rate of the central body about its pole
+    double rotationRate = 0.0;
+
+    //! Number of bodies of which the states are tabulated (third bodies and radiation source)
+    int numberOfTabulatedBodies = 0;
+
+    //! Boolean denoting whether the indirect terms of the third-body accelerations are included
+    bool useIndirectThirdBodyTerms = true;
+
+    //! First epoch of the tabulated states of the perturbing bodies
+    double tabulationStartTime = 0.0;
+
+    //! Step of the epochs of the tabulated states of the perturbing bodies
+    double tabulationTimeStep = 0.0;
+
+    //! Number of epochs of the tabulated states of the perturbing bodies
+    int numberOfTabulationEpochs = 0;
+
+    //! Atmosphere model of the central body
+    DeviceAtmosphereModelTypes atmosphereModelType = no_device_atmosphere;
+
+    //! Radius of the (spherical) shape of the central body, used to compute altitudes
+    double shapeRadius = 0.0;
+
+    //! Density at zero altitude of the exponential atmosphere
+    double densityAtZeroAltitude = 0.0;
+
+    //! Scale height of the exponential atmosphere
+    double scaleHeight = 0.0;
+
+    //! Lowest altitude of the tabulated atmosphere
+    double tabulatedAtmosphereMinimumAltitude = 0.0;
+
+    //! Altitude step of the tabulated atmosphere
+    double tabulatedAtmosphereAltitudeStep = 0.0;
+
+    //! Number of altitudes of the tabulated atmosphere
+    int numberOfTabulatedAtmosphereAltitudes = 0;
+
+    //! Drag coefficient times reference area, divided by mass, of the propagated body (nominal member)
+    double ballisticDragFactor = 0.0;
+
+    //! Index of the radiation source in the tabulated bodies (-1 if no radiation pressure is used)
+    int radiationSourceIndex = -1;
+
+    //! Radiation pressure of the source at unit distance (i.e. emitted power divided by 4 pi times the speed of light)
+    double radiationPressureAtUnitDistance = 0.0;
+
+    //! Radiation pressure coefficient times area, divided by mass, of the propagated body (nominal member)
+    double radiationPressureFactor = 0.0;
+
+    //! Number of stages of the Runge-Kutta method
+    int numberOfStages = 0;
+
+    //! Boolean denoting whether the step size is controlled from the embedded error estimate
+    bool useVariableStepSize = false;
+
+    //! Order of the lower order estimate of the Runge-Kutta method (used by the step-size control)
+    int lowerOrder = 0;
+
+    //! Boolean denoting whether the higher (instead of the lower) order estimate is integrated, for variable step size
+    bool integrateHigherOrderEstimate = false;
+
+    //! Initial (or fixed) step size
+    double initialStepSize = 0.0;
+
+    //! Minimum step size of the step-size control
+    double minimumStepSize = 0.0;
+
+    //! Maximum step size of the step-size control
+    double maximumStepSize = 0.0;
+
+    //! Relative error tolerance of the step-size control
+    double relativeErrorTolerance = 0.0;
+
+    //! Absolute error tolerance of the step-size control
+    double absoluteErrorTolerance = 0.0;
+
+    //! Safety factor used to scale the prediction of the next step size
+    double safetyFactorForNextStepSize = 0.8;
+
+    //! Maximum factor increase for the next step size
+    double maximumFactorIncreaseForNextStepSize = 4.0;
+
+    //! Minimum factor decrease for the next step size
+    double minimumFactorDecreaseForNextStepSize = 0.1;
+
+    //! Boolean denoting whether a member is terminated if its step size drops below the minimum step size
+    bool terminateIfMinimumStepExceeded = true;
+
+    //! Maximum number of (accepted and rejected) steps per member
+    int maximumNumberOfSteps = 0;
+};
+
+//! Function to compute the position of a tabulated body by cubic Hermite interpolation of its tabulated states
+TUDAT_HOST_DEVICE inline void interpolateTabulatedBodyPosition(
+        const DeviceEnsembleDynamicsModel& model,
+        const double* tabulatedBodyStates,
+        const int bodyIndex,
+        const double time,
+        double* position )
+{
+    // Find interval (limited to the tabulated range)
+    const double scaledTime = ( time - model.tabulationStartTime ) / model.tabulationTimeStep;
+    int lowerIndex = static_cast< int >( std::floor( scaledTime ) );
+    lowerIndex = lowerIndex < 0 ? 0 : ( lowerIndex > model.numberOfTabulationEpochs - 2 ?
+                                            model.numberOfTabulationEpochs - 2 : lowerIndex );
+    const double s = scaledTime - static_cast< double >( lowerIndex );
+
+    // Compute Hermite basis functions
+    const double s2 = s * s;
+    const double s3 = s2 * s;
+    const double lowerPositionWeight = 2.0 * s3 - 3.0 * s2 + 1.0;
+    const double lowerVelocityWeight = ( s3 - 2.0 * s2 + s ) * model.tabulationTimeStep;
+    const double upperPositionWeight = -2.0 * s3 + 3.0 * s2;
+    const double upperVelocityWeight = ( s3 - s2 ) * model.tabulationTimeStep;
+
+    const double* lowerState = tabulatedBodyStates + 6 * ( bodyIndex * model.numberOfTabulationEpochs + lowerIndex );
+    const double* upperState = lowerState + 6;
+    for( int i = 0; i < 3; i++ )
+    {
+        position[ i ] = lowerPositionWeight * lowerState[ i ] + lowerVelocityWeight * lowerState[ i + 3 ] +
+                upperPositionWeight * upperState[ i ] + upperVelocityWeight * upperState[ i + 3 ];
+    }
+}
+
+//! Function to compute the atmospheric density at a given altitude
+TUDAT_HOST_DEVICE inline double computeAtmosphericDensity(
+        const DeviceEnsembleDynamicsModel& model,
+        const double* tabulatedLogarithmicDensities,
+        const double altitude )
+{
+    if( model.atmosphereModelType == exponential_device_atmosphere )
+    {
+        return model.densityAtZeroAltitude * std::exp( -altitude / model.scaleHeight );
+    }
+    else
+    {
+        // Interpolate logarithm of density linearly, using the boundary values outside of the table
+        const double scaledAltitude = ( altitude - model.tabulatedAtmosphereMinimumAltitude ) /
+                model.tabulatedAtmosphereAltitudeStep;
+        if( scaledAltitude <= 0.0 )
+        {
+            return std::exp( tabulatedLogarithmicDensities[ 0 ] );
+        }
+        else if( scaledAltitude >= static_cast< double >( model.numberOfTabulatedAtmosphereAltitudes - 1 ) )
+        {
+            return std::exp( tabulatedLogarithmicDensities[ model.numberOfTabulatedAtmosphereAltitudes - 1 ] );
+        }
+        const int lowerIndex = static_cast< int >( scaledAltitude );
+        const double fraction = scaledAltitude - static_cast< double >( lowerIndex );
+        return std::exp( ( 1.0 - fraction ) * tabulatedLogarithmicDensities[ lowerIndex ] +
+                    fraction * tabulatedLogarithmicDensities[ lowerIndex + 1 ] );
+    }
+}
+
+//! Function to compute the time derivative of the translational state of a single member
+TUDAT_HOST_DEVICE inline void computeStateDerivative(
+        const DeviceEnsembleDynamicsModel& model,
+        const double* tabulatedBodyGravitationalParameters,
+        const double* tabulatedBodyStates,
+        const double* tabulatedLogarithmicDensities,
+        const double dragScalingFactor,
+        const double radiationPressureScalingFactor,
+        const double time,
+        const double* state,
+        double* stateDerivative )
+{
+    const double distance = std::sqrt( state[ 0 ] * state[ 0 ] + state[ 1 ] * state[ 1 ] + state[ 2 ] * state[ 2 ] );
+    double acceleration[ 3 ] = { 0.0, 0.0, 0.0 };
+
+    // Gravitational acceleration of central body, with zonal terms computed from the Legendre polynomials of the sine of
+    // the latitude w.r.t. the pole (and their derivatives)
+    if( model.centralBodyGravitationalParameter != 0.0 )
+    {
+        double radialSum = 1.0;
+        double latitudinalSum = 0.0;
+        const double sineOfLatitude = ( state[ 0 ] * model.poleDirection[ 0 ] + state[ 1 ] * model.poleDirection[ 1 ] +
+                state[ 2 ] * model.poleDirection[ 2 ] ) / distance;
+        if( model.maximumZonalDegree > 0 )
+        {
+            const double radiusRatio = model.centralBodyReferenceRadius / distance;
+            double radiusPowerTerm = radiusRatio;
+            double previousPolynomial = 1.0, currentPolynomial = sineOfLatitude;
+            double previousDerivative = 0.0, currentDerivative = 1.0;
+            for( int degree = 1; degree <= model.maximumZonalDegree; degree++ )
+            {
+                if( degree > 1 )
+                {
+                    const double doubleDegree = static_cast< double >( degree );
+                    const double nextPolynomial = ( ( 2.0 * doubleDegree - 1.0 ) * sineOfLatitude * currentPolynomial -
+                                                    ( doubleDegree - 1.0 ) * previousPolynomial ) / doubleDegree;
+                    const double nextDerivative = previousDerivative + ( 2.0 * doubleDegree - 1.0 ) * currentPolynomial;
+                    previousPolynomial = currentPolynomial;
+                    currentPolynomial = nextPolynomial;
+                    previousDerivative = currentDerivative;
+                    currentDerivative = nextDerivative;
+                }
+                radialSum += static_cast< double >( degree + 1 ) * model.zonalCoefficients[ degree ] *
+                        radiusPowerTerm * currentPolynomial;
+                latitudinalSum += model.zonalCoefficients[ degree ] * radiusPowerTerm * currentDerivative;
+                radiusPowerTerm *= radiusRatio;
+            }
+        }
+
+        const double accelerationMagnitude = model.centralBodyGravitationalParameter / ( distance * distance );
+        for( int i = 0; i < 3; i++ )
+        {
+            const double radialUnitVectorEntry = state[ i ] / distance;
+            acceleration[ i ] -= accelerationMagnitude * (
+                        radialSum * radialUnitVectorEntry -
+                        latitudinalSum * ( model.poleDirection[ i ] - sineOfLatitude * radialUnitVectorEntry ) );
+        }
+    }
+
+    // Point mass gravity of third bodies, and radiation pressure
+    for( int body = 0; body < model.numberOfTabulatedBodies; body++ )
+    {
+        double bodyPosition[ 3 ];
+        interpolateTabulatedBodyPosition( model, tabulatedBodyStates, body, time, bodyPosition );
+        const double relativePosition[ 3 ] = { bodyPosition[ 0 ] - state[ 0 ], bodyPosition[ 1 ] - state[ 1 ],
+                                               bodyPosition[ 2 ] - state[ 2 ] };
+        const double relativeDistance = std::sqrt( relativePosition[ 0 ] * relativePosition[ 0 ] +
+                                              relativePosition[ 1 ] * relativePosition[ 1 ] +
+                                              relativePosition[ 2 ] * relativePosition[ 2 ] );
+
+        const double gravitationalParameter = tabulatedBodyGravitationalParameters[ body ];
+        if( gravitationalParameter != 0.0 )
+        {
+            const double directTerm = gravitationalParameter /
+                    ( relativeDistance * relativeDistance * relativeDistance );
+            double indirectTerm = 0.0;
+            if( model.useIndirectThirdBodyTerms )
+            {
+                const double bodyDistance = std::sqrt( bodyPosition[ 0 ] * bodyPosition[ 0 ] +
+                                                  bodyPosition[ 1 ] * bodyPosition[ 1 ] +
+                                                  bodyPosition[ 2 ] * bodyPosition[ 2 ] );
+                indirectTerm = gravitationalParameter / ( bodyDistance * bodyDistance * bodyDistance );
+            }
+            for( int i = 0; i < 3; i++ )
+            {
+                acceleration[ i ] += directTerm * relativePosition[ i ] - indirectTerm * bodyPosition[ i ];
+            }
+        }
+
+        // Cannonball radiation pressure, directed away from the source
+        if( body == model.radiationSourceIndex )
+        {
+            const double radiationAcceleration = model.radiationPressureAtUnitDistance /
+                    ( relativeDistance * relativeDistance ) * model.radiationPressureFactor *
+                    radiationPressureScalingFactor;
+            for( int i = 0; i < 3; i++ )
+            {
+                acceleration[ i ] -= radiationAcceleration * relativePosition[ i ] / relativeDistance;
+            }
+        }
+    }
+
+    // Drag, w.r.t. an atmosphere co-rotating with the central body
+    if( model.atmosphereModelType != no_device_atmosphere )
+    {
+        const double density = computeAtmosphericDensity(
+                    model, tabulatedLogarithmicDensities, distance - model.shapeRadius );
+        const double* pole = model.poleDirection;
+        const double airspeedVelocity[ 3 ] =
+        { state[ 3 ] - model.rotationRate * ( pole[ 1 ] * state[ 2 ] - pole[ 2 ] * state[ 1 ] ),
+          state[ 4 ] - model.rotationRate * ( pole[ 2 ] * state[ 0 ] - pole[ 0 ] * state[ 2 ] ),
+          state[ 5 ] - model.rotationRate * ( pole[ 0 ] * state[ 1 ] - pole[ 1 ] * state[ 0 ] ) };
+        const double airspeed = std::sqrt( airspeedVelocity[ 0 ] * airspeedVelocity[ 0 ] +
+                                      airspeedVelocity[ 1 ] * airspeedVelocity[ 1 ] +
+                                      airspeedVelocity[ 2 ] * airspeedVelocity[ 2 ] );
+        const double dragTerm = 0.5 * density * airspeed * model.ballisticDragFactor * dragScalingFactor;
+        for( int i = 0; i < 3; i++ )
+        {
+            acceleration[ i ] -= dragTerm * airspeedVelocity[ i ];
+        }
+    }
+
+    for( int i = 0; i < 3; i++ )
+    {
+        stateDerivative[ i ] = state[ i + 3 ];
+        stateDerivative[ i + 3 ] = acceleration[ i ];
+    }
+}
+
+//! Function to propagate a single member of the ensemble
+/*!
+ *  Function to propagate a single member of the ensemble, from each output epoch to the next, with the last step to
+ *  each output epoch limited such that it ends at the output epoch. For variable step size integration, the step-size
+ *  control is the same as that of EnsembleRungeKuttaVariableStepSizeIntegrator (Montenbruck and Gill, 2005), except
+ *  that a step at the minimum step size is always accepted if the member is not terminated when the minimum step size
+ *  is exceeded. This function is called by the CUDA kernel (one device thread per member), and by its host fallback
+ *  when Tudat is built without TUDAT_BUILD_WITH_CUDA, so that both produce the same results. Input and output as in
+ *  propagateEnsembleOnDevice, of which only the entries of the given member are used or set.
+ *  \param member Index of the member that is to be propagated
+ */
+TUDAT_HOST_DEVICE inline void propagateEnsembleMember(
+        const int member,
+        const DeviceEnsembleDynamicsModel& model,
+        const double* tabulatedBodyGravitationalParameters,
+        const double* tabulatedBodyStates,
+        const double* tabulatedLogarithmicDensities,
+        const double* rungeKuttaCoefficients,
+        const double* outputEpochs,
+        const int numberOfOutputEpochs,
+        const double* initialStates,
+        const double* dragScalingFactors,
+        const double* radiationPressureScalingFactors,
+        const int numberOfMembers,
+        double* outputStates,
+        int* memberStatus,
+        int* numberOfAcceptedSteps,
+        int* numberOfRejectedSteps )
+{
+    const int numberOfStages = model.numberOfStages;
+    const double* aCoefficients = rungeKuttaCoefficients;
+    const double* cCoefficients = aCoefficients + numberOfStages * numberOfStages;
+    const double* lowerOrderBCoefficients = cCoefficients + numberOfStages;
+    const double* higherOrderBCoefficients = lowerOrderBCoefficients + numberOfStages;
+
+    const double dragScalingFactor = dragScalingFactors[ member ];
+    const double radiationPressureScalingFactor = radiationPressureScalingFactors[ member ];
+
+    double state[ 6 ], intermediateState[ 6 ], lowerOrderEstimate[ 6 ], higherOrderEstimate[ 6 ];
+    double stateDerivatives[ maximumNumberOfDeviceRungeKuttaStages ][ 6 ];
+    for( int i = 0; i < 6; i++ )
+    {
+        state[ i ] = initialStates[ 6 * member + i ];
+        outputStates[ i * numberOfMembers + member ] = state[ i ];
+    }
+
+    double time = outputEpochs[ 0 ];
+    double stepSize = model.initialStepSize;
+    int acceptedSteps = 0, rejectedSteps = 0;
+    int status = device_member_propagation_successful;
+    int outputIndex = 1;
+    for( ; outputIndex < numberOfOutputEpochs && status == device_member_propagation_successful; outputIndex++ )
+    {
+        const double outputEpoch = outputEpochs[ outputIndex ];
+        while( time != outputEpoch )
+        {
+            if( acceptedSteps + rejectedSteps >= model.maximumNumberOfSteps )
+            {
+                status = device_member_maximum_number_of_steps_exceeded;
+                break;
+            }
+
+            // Limit step such that it does not exceed the output epoch
+            const double remainingInterval = outputEpoch - time;
+            const bool isStepToOutputEpoch =
+                    std::fabs( remainingInterval ) <= std::fabs( stepSize ) * ( 1.0 + 2.0E-16 );
+            const double currentStepSize = isStepToOutputEpoch ? remainingInterval : stepSize;
+
+            // Compute state derivatives of each stage, and the lower and higher order estimates
+            for( int i = 0; i < 6; i++ )
+            {
+                lowerOrderEstimate[ i ] = state[ i ];
+                higherOrderEstimate[ i ] = state[ i ];
+            }
+            for( int stage = 0; stage < numberOfStages; stage++ )
+            {
+                for( int i = 0; i < 6; i++ )
+                {
+                    intermediateState[ i ] = state[ i ];
+                }
+                for( int column = 0; column < stage; column++ )
+                {
+                    const double coefficient = aCoefficients[ stage * numberOfStages + column ];
+                    if( coefficient != 0.0 )
+                    {
+                        for( int i = 0; i < 6; i++ )
+                        {
+                            intermediateState[ i ] += currentStepSize * coefficient * stateDerivatives[ column ][ i ];
+                        }
+                    }
+                }
+                computeStateDerivative(
+                            model, tabulatedBodyGravitationalParameters, tabulatedBodyStates,
+                            tabulatedLogarithmicDensities, dragScalingFactor, radiationPressureScalingFactor,
+                            time + cCoefficients[ stage ] * currentStepSize, intermediateState,
+                            stateDerivatives[ stage ] );
+                for( int i = 0; i < 6; i++ )
+                {
+                    lowerOrderEstimate[ i ] +=
+                            currentStepSize * lowerOrderBCoefficients[ stage ] * stateDerivatives[ stage ][ i ];
+                }
+                if( model.useVariableStepSize )
+                {
+                    for( int i = 0; i < 6; i++ )
+                    {
+                        higherOrderEstimate[ i ] +=
+                                currentStepSize * higherOrderBCoefficients[ stage ] * stateDerivatives[ stage ][ i ];
+                    }
+                }
+            }
+
+            bool isStepAccepted = true;
+            if( model.useVariableStepSize )
+            {
+                // Compute maximum relative truncation error, and next step size
+                double maximumErrorInState = 0.0;
+                for( int i = 0; i < 6; i++ )
+                {
+                    const double error = std::fabs( lowerOrderEstimate[ i ] - higherOrderEstimate[ i ] ) /
+                            ( std::fabs( lowerOrderEstimate[ i ] ) * model.relativeErrorTolerance +
+                              model.absoluteErrorTolerance );
+                    maximumErrorInState = error > maximumErrorInState ? error : maximumErrorInState;
+                }
+                isStepAccepted = maximumErrorInState <= 1.0;
+
+                const double timeStepRatio = model.safetyFactorForNextStepSize *
+                        std::pow( 1.0 / maximumErrorInState, 1.0 / static_cast< double >( model.lowerOrder + 1 ) );
+                double newStepSize;
+                if( timeStepRatio <= model.minimumFactorDecreaseForNextStepSize )
+                {
+                    newStepSize = currentStepSize * model.minimumFactorDecreaseForNextStepSize;
+                }
+                else if( timeStepRatio >= model.maximumFactorIncreaseForNextStepSize )
+                {
+                    newStepSize = currentStepSize * model.maximumFactorIncreaseForNextStepSize;
+                }
+                else
+                {
+                    newStepSize = currentStepSize * timeStepRatio;
+                }
+
+                // Validate new step size
+                const double stepSign = currentStepSize < 0.0 ? -1.0 : 1.0;
+                if( std::fabs( newStepSize ) < model.minimumStepSize )
+                {
+                    if( model.terminateIfMinimumStepExceeded )
+                    {
+                        status = device_member_minimum_step_exceeded;
+                        break;
+                    }
+                    if( std::fabs( currentStepSize ) <= model.minimumStepSize * ( 1.0 + 2.0E-16 ) )
+                    {
+                        isStepAccepted = true;
+                    }
+                    newStepSize = stepSign * model.minimumStepSize;
+                }
+                else if( std::fabs( newStepSize ) > model.maximumStepSize )
+                {
+                    newStepSize = stepSign * model.maximumStepSize;
+                }
+                stepSize = newStepSize;
+            }
+
+            if( !isStepAccepted )
+            {
+                rejectedSteps++;
+                continue;
+            }
+
+            // Update state of member
+            const double* acceptedEstimate = ( model.useVariableStepSize && model.integrateHigherOrderEstimate ) ?
+                        higherOrderEstimate : lowerOrderEstimate;
+            bool isStateFinite = std::isfinite( stepSize );
+            for( int i = 0; i < 6; i++ )
+            {
+                state[ i ] = acceptedEstimate[ i ];
+                isStateFinite = isStateFinite && std::isfinite( state[ i ] );
+            }
+            time = isStepToOutputEpoch ? outputEpoch : time + currentStepSize;
+            acceptedSteps++;
+
+            if( !isStateFinite )
+            {
+                status = device_member_non_finite_state;
+                break;
+            }
+        }
+
+        if( status == device_member_propagation_successful )
+        {
+            for( int i = 0; i < 6; i++ )
+            {
+                outputStates[ ( 6 * outputIndex + i ) * numberOfMembers + member ] = state[ i ];
+            }
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    // Set states after termination of the member to NaN
+    for( ; outputIndex < numberOfOutputEpochs; outputIndex++ )
+    {
+        for( int i = 0; i < 6; i++ )
+        {
+            outputStates[ ( 6 * outputIndex + i ) * numberOfMembers + member ] = std::nan( "" );
+        }
+    }
+
+    memberStatus[ member ] = status;
+    numberOfAcceptedSteps[ member ] = acceptedSteps;
+    numberOfRejectedSteps[ member ] = rejectedSteps;
+}
+
+//! Function to propagate an ensemble of translational states with a simplified dynamical model on a CUDA device
+/*!
+ *  Function to propagate an ensemble of translational states with a simplified dynamical model on a CUDA device, with
+ *  one device thread per member (see propagateEnsembleMember). This function is only defined when Tudat is built with
+ *  TUDAT_BUILD_WITH_CUDA, and is called through DeviceEnsembleDynamicsSimulator::propagateEnsemble. All arrays are in
+ *  host memory; the transfer to and from the device is handled by this function.
+ *  \param model Dynamical model and integrator settings
+ *  \param tabulatedBodyGravitationalParameters Gravitational parameters of the tabulated bodies (zero for a body that
+ *  only acts as radiation source)
+ *  \param tabulatedBodyStates States of the tabulated bodies w.r.t. the central body, with the state of body b at
+ *  tabulation epoch i stored in entries 6 * ( b * numberOfTabulationEpochs + i ) to 6 * ( b * numberOfTabulationEpochs
+ *  + i ) + 5
+ *  \param tabulatedLogarithmicDensities Natural logarithm of the atmospheric density at each altitude of the tabulated
+ *  atmosphere (unused for other atmosphere models)
+ *  \param rungeKuttaCoefficients Butcher tableau, stored as the a-coefficients (row-major, numberOfStages x
+ *  numberOfStages), followed by the c-coefficients and the b-coefficients of the lower and higher order estimates, each
+ *  with numberOfStages entries. For fixed step size integration, the lower order b-coefficients are those of the
+ *  integrated estimate, and the higher order b-coefficients are not used
+ *  \param outputEpochs Epochs at which the states are to be saved, of which the first is the initial time
+ *  \param numberOfOutputEpochs Number of output epochs
+ *  \param initialStates Initial states of the members (6 x numberOfMembers, column-major)
+ *  \param dragScalingFactors Scaling factor of the drag acceleration of each member (numberOfMembers entries)
+ *  \param radiationPressureScalingFactors Scaling factor of the radiation pressure acceleration of each member
+ *  (numberOfMembers entries)
+ *  \param numberOfMembers Number of members that are to be propagated
+ *  \param outputStates States at the output epochs (returned by reference), with entry i of the state of member m at
+ *  output epoch k stored in entry ( 6 * k + i ) * numberOfMembers + m (NaN after the termination of a member)
+ *  \param memberStatus Status of each member at the end of the propagation (returned by reference, see
+ *  DeviceEnsembleMemberStatus)
+ *  \param numberOfAcceptedSteps Number of accepted steps of each member (returned by reference)
+ *  \param numberOfRejectedSteps Number of rejected steps of each member (returned by reference)
+ */
+void propagateEnsembleOnDevice(
+        const DeviceEnsembleDynamicsModel& model,
+        const double* tabulatedBodyGravitationalParameters,
+        const double* tabulatedBodyStates,
+        const double* tabulatedLogarithmicDensities,
+        const double* rungeKuttaCoefficients,
+        const double* outputEpochs,
+        const int numberOfOutputEpochs,
+        const double* initialStates,
+        const double* dragScalingFactors,
+        const double* radiationPressureScalingFactors,
+        const int numberOfMembers,
+        double* outputStates,
+        int* memberStatus,
+        int* numberOfAcceptedSteps,
+        int* numberOfRejectedSteps );
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_ENSEMBLEDEVICEPROPAGATION_H
@@ -0,0 +1,304 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_ENSEMBLEDYNAMICSSIMULATOR_H
+#define TUDAT_ENSEMBLEDYNAMICSSIMULATOR_H
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/basics/parallelization.h"
+#include "tudat/simulation/propagation_setup/dynamicsSimulator.h"
+#include "tudat/simulation/propagation_setup/ensembleStatistics.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Class for the propagation of an ensemble of single-arc trajectories with the same dynamical model
+/*!
+ *  Class for the propagation of an ensemble of single-arc trajectories (members) with the same dynamical model, for instance
+ *  for Monte Carlo dispersion analyses. The members differ in their initial state and (optionally) in a number of
+ *  environment parameters, which are set for each member through a user-defined function before the member is propagated.
+ *  The environment, acceleration models, integrator etc. are created only once per worker thread, and reused for all
+ *  members that the worker propagates. To propagate members concurrently, each worker requires its own SystemOfBodies
+ *  and its own propagator settings (with the state derivative models created from the bodies of the same worker).
+ *  Member m is propagated by worker ( m mod number of workers ), so that the distribution of members over workers is
+ *  deterministic. The results of each member are stored in a separate SingleArcSimulationResults object. Alternatively
+ *  (see setEnsembleStatistics), only the statistics of the ensemble are retained, which are updated as each member finishes.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class EnsembleDynamicsSimulator
+{
+public:
+
+    //! Typedef for the function that sets the member-specific environment parameters
+    typedef std::function< void( const int, const simulation_setup::SystemOfBodies& ) > MemberEnvironmentModifier;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param workerBodies List of bodies, one entry per worker thread. Entries must not share any Body objects.
+     *  \param workerPropagatorSettings List of propagator settings, one entry per worker thread, with the state derivative
+     *  models of each entry created from the corresponding entry of workerBodies. The settings must not reset the
+     *  environment after propagation (setIntegratedResult must be false).
+     *  \param memberEnvironmentModifier Function that is called (with the member index and the bodies of the worker as
+     *  input) before the propagation of each member, to set the member-specific environment parameters. Since the bodies
+     *  are reused for subsequent members, this function must set all member-specific parameters for each member (default
+     *  none).
+     */
+    EnsembleDynamicsSimulator(
+            const std::vector< simulation_setup::SystemOfBodies >& workerBodies,
+            const std::vector< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > >& workerPropagatorSettings,
+            const MemberEnvironmentModifier memberEnvironmentModifier = nullptr ):
+        workerBodies_( workerBodies ),
+        memberEnvironmentModifier_( memberEnvironmentModifier ),
+        retainMemberResults_( true )
+    {
+        if( workerBodies.size( ) == 0 )
+        {
+            throw std::runtime_error( "Error when creating ensemble dynamics simulator, no bodies provided" );
+        }
+        else if( workerBodies.size( ) != workerPropagatorSettings.size( ) )
+        {
+            throw std::runtime_error( "Error when creating ensemble dynamics simulator, number of bodies (" +
+                                      std::to_string( workerBodies.size( ) ) + ") and propagator settings (" +
+                                      std::to_string( workerPropagatorSettings.size( ) ) + ") is not equal" );
+        }
+
+        for( unsigned int i = 0; i < workerBodies.size( ); i++ )
+        {
+            for( unsigned int j = 0; j < i; j++ )
+            {
+                if( simulation_setup::doSystemsOfBodiesShareBodies( workerBodies.at( i ), workerBodies.at( j ) ) )
+                {
+                    throw std::runtime_error( "Error when creating ensemble dynamics simulator, bodies of worker " +
+                                              std::to_string( j ) + " and " + std::to_string( i ) + " are not independent" );
+                }
+            }
+
+            if( workerPropagatorSettings.at( i )->getOutputSettingsWithCheck( )->getSetIntegratedResult( ) )
+            {
+                throw std::runtime_error( "Error when creating ensemble dynamics simulator, propagated results cannot be used to reset "
+                                          "the environment for an ensemble" );
+            }
+
+            workerDynamicsSimulators_.push_back(
+                        std::make_shared< SingleArcDynamicsSimulator< StateScalarType, TimeType > >(
+                            workerBodies.at( i ), workerPropagatorSettings.at( i ), false ) );
+        }
+    }
+
+    //! Constructor for propagation of an ensemble using a single thread
+    /*!
+     *  Constructor for propagation of an ensemble using a single thread
+     *  \param bodies Bodies used for the propagation of all members
+     *  \param propagatorSettings Propagator settings used for all members (must be created from bodies)
+     *  \param memberEnvironmentModifier Function that is called before the propagation of each member, to set the
+     *  member-specific environment parameters.
+     */
+    EnsembleDynamicsSimulator(
+            const simulation_setup::SystemOfBodies& bodies,
+            const std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > propagatorSettings,
+            const MemberEnvironmentModifier memberEnvironmentModifier = nullptr ):
+        EnsembleDynamicsSimulator(
+            std::vector< simulation_setup::SystemOfBodies >( { bodies } ),
+            std::vector< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > >( { propagatorSettings } ),
+            memberEnvironmentModifier ){ }
+
+    //! Function to propagate all members of the ensemble
+    /*!
+     *  Function to propagate all members of the ensemble. Previously stored member results (and ensemble statistics) are
+     *  discarded.
+     *  \param memberInitialStates Initial states of the members, stored in structure-of-arrays layout: one row per member,
+     *  and one column per state entry (so that each state entry is stored contiguously for all members). The states must
+     *  be in the conventional (i.e. not propagator-specific) form, as for SingleArcDynamicsSimulator.
+     */
+    void propagateEnsemble(
+            const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& memberInitialStates )
+    {
+        int numberOfMembers = memberInitialStates.rows( );
+        int numberOfWorkers = workerDynamicsSimulators_.size( );
+
+        if( memberInitialStates.cols( ) !=
+                workerDynamicsSimulators_.at( 0 )->getPropagatorSettings( )->getConventionalStateSize( ) )
+        {
+            throw std::runtime_error( "Error when propagating ensemble, member state size (" +
+                                      std::to_string( memberInitialStates.cols( ) ) + ") is incompatible with propagator settings" );
+        }
+
+        memberResults_.clear( );
+        memberResults_.resize( numberOfMembers );
+
+        // Each worker accumulates the statistics of its own members, which are merged in order of worker index afterwards
+        workerEnsembleStatistics_.clear( );
+        if( ensembleStatistics_ != nullptr )
+        {
+            ensembleStatistics_->reset( );
+            for( int i = 0; i < numberOfWorkers; i++ )
+            {
+                workerEnsembleStatistics_.push_back(
+                            std::make_shared< EnsembleStatisticsAccumulator< StateScalarType, TimeType > >( *ensembleStatistics_ ) );
+            }
+        }
+
+        utilities::executeParallelTasks(
+                    numberOfWorkers, [ & ]( const int workerIndex )
+        {
+            for( int memberIndex = workerIndex; memberIndex < numberOfMembers; memberIndex += numberOfWorkers )
+            {
+                propagateMember( workerIndex, memberIndex, memberInitialStates.row( memberIndex ).transpose( ) );
+            }
+        }, numberOfWorkers );
+
+        for( unsigned int i = 0; i < workerEnsembleStatistics_.size( ); i++ )
+        {
+            ensembleStatistics_->merge( *workerEnsembleStatistics_.at( i ) );
+        }
+        workerEnsembleStatistics_.clear( );
+    }
+
+    //! Function to set the object in which the statistics of the ensemble are accumulated
+    /*!
+     *  Function to set the object in which the statistics of the ensemble are accumulated during each subsequent call to
+     *  propagateEnsemble (which resets its contents). Each worker adds the results of a member to its own copy of the object
+     *  as soon as the member is propagated, and the copies are merged into the object after all members are propagated.
+     *  \param ensembleStatistics Object in which the statistics of the ensemble are to be accumulated (nullptr if no
+     *  statistics are to be computed)
+     *  \param retainMemberResults Boolean denoting whether the results of the members are to be retained after their
+     *  statistics are computed. If false, the results of each member are discarded after they are added to the statistics
+     *  (and getMemberResults returns nullptr for all members), so that the memory use is independent of the number of
+     *  members.
+     */
+    void setEnsembleStatistics(
+            const std::shared_ptr< EnsembleStatisticsAccumulator< StateScalarType, TimeType > > ensembleStatistics,
+            const bool retainMemberResults = false )
+    {
+        ensembleStatistics_ = ensembleStatistics;
+        retainMemberResults_ = ( ensembleStatistics == nullptr ) || retainMemberResults;
+    }
+
+    //! Function to retrieve the object in which the statistics of the ensemble are accumulated
+    std::shared_ptr< EnsembleStatisticsAccumulator< StateScalarType, TimeType > > getEnsembleStatistics( )
+    {
+        return ensembleStatistics_;
+    }
+
+    //! Function to retrieve the propagation results of all members
+    /*!
+     *  Function to retrieve the propagation results of all members, from the last call to propagateEnsemble
+     *  \return Propagation results of all members
+     */
+    std::vector< std::shared_ptr< SingleArcSimulationResults< StateScalarType, TimeType > > > getMemberResults( )
+    {
+        return memberResults_;
+    }
+
+    //! Function to retrieve the propagation results of a single member
+    /*!
+     *  Function to retrieve the propagation results of a single member, from the last call to propagateEnsemble
+     *  \param memberIndex Index of member for which results are to be retrieved
+     *  \return Propagation results of the requested member
+     */
+    std::shared_ptr< SingleArcSimulationResults< StateScalarType, TimeType > > getMemberResults( const int memberIndex )
+    {
+        if( memberIndex < 0 || memberIndex >= static_cast< int >( memberResults_.size( ) ) )
+        {
+            throw std::runtime_error( "Error when retrieving ensemble member results, member index " +
+                                      std::to_string( memberIndex ) + " is not available" );
+        }
+        return memberResults_.at( memberIndex );
+    }
+
+    //! Function to retrieve the number of worker threads used for the propagation
+    /*!
+     *  Function to retrieve the number of worker threads used for the propagation
+     *  \return Number of worker threads used for the propagation
+     */
+    int getNumberOfWorkers( )
+    {
+        return workerDynamicsSimulators_.size( );
+    }
+
+    //! Function to retrieve the dynamics simulators used by each worker thread
+    /*!
+     *  Function to retrieve the dynamics simulators used by each worker thread
+     *  \return Dynamics simulators used by each worker thread
+     */
+    std::vector< std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > > getWorkerDynamicsSimulators( )
+    {
+        return workerDynamicsSimulators_;
+    }
+
+private:
+
+    //! Function to propagate a single member, using the simulator of a given worker
+    void propagateMember( const int workerIndex, const int memberIndex,
+                          const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& memberInitialState )
+    {
+        std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > dynamicsSimulator =
+                workerDynamicsSimulators_.at( workerIndex );
+
+        if( memberEnvironmentModifier_ != nullptr )
+        {
+            memberEnvironmentModifier_( memberIndex, workerBodies_.at( workerIndex ) );
+        }
+
+        // Create results object for member, with same settings as that of the simulator, and propagate
+        std::shared_ptr< SingleArcSimulationResults< StateScalarType, TimeType > > currentMemberResults =
+                std::make_shared< SingleArcSimulationResults< StateScalarType, TimeType > >(
+                    *dynamicsSimulator->getSingleArcPropagationResults( ) );
+        dynamicsSimulator->template integrateEquationsOfMotion< SingleArcSimulationResults< StateScalarType, TimeType > >(
+                    dynamicsSimulator->getDynamicsStateDerivative( )->convertFromOutputSolution(
+                        memberInitialState, dynamicsSimulator->getPropagatorSettings( )->getInitialTime( ) ),
+                    currentMemberResults );
+
+        if( workerEnsembleStatistics_.size( ) > 0 )
+        {
+            workerEnsembleStatistics_.at( workerIndex )->addMember( currentMemberResults );
+        }
+        if( retainMemberResults_ )
+        {
+            memberResults_.at( memberIndex ) = currentMemberResults;
+        }
+    }
+
+    //! Bodies used by each of the worker threads
+    std::vector< simulation_setup::SystemOfBodies > workerBodies_;
+
+    //! Function that sets the member-specific environment parameters
+    MemberEnvironmentModifier memberEnvironmentModifier_;
+
+    //! Dynamics simulators used by each of the worker threads
+    std::vector< std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > > workerDynamicsSimulators_;
+
+    //! Propagation results of each of the members, from the last call to propagateEnsemble
+    std::vector< std::shared_ptr< SingleArcSimulationResults< StateScalarType, TimeType > > > memberResults_;
+
+    //! Object in which the statistics of the ensemble are accumulated (nullptr if none)
+    std::shared_ptr< EnsembleStatisticsAccumulator< StateScalarType, TimeType > > ensembleStatistics_;
+
+    //! Objects in which each of the worker threads accumulates the statistics of its members, during propagateEnsemble
+    std::vector< std::shared_ptr< EnsembleStatisticsAccumulator< StateScalarType, TimeType > > > workerEnsembleStatistics_;
+
+    //! Boolean denoting whether the results of the members are retained (see setEnsembleStatistics)
+    bool retainMemberResults_;
+};
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_ENSEMBLEDYNAMICSSIMULATOR_H
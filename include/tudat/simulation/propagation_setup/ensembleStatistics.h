@@ -0,0 +1,299 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_ENSEMBLESTATISTICS_H
+#define TUDAT_ENSEMBLESTATISTICS_H
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/basics/processCommunicator.h"
+#include "tudat/math/interpolators/createInterpolator.h"
+#include "tudat/math/statistics/streamingStatistics.h"
+#include "tudat/simulation/propagation_setup/propagationResults.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Class to accumulate the statistics of the states and dependent variables of an ensemble of propagations
+/*!
+ *  Class to accumulate the statistics (mean, covariance, extreme values and quantiles, see
+ *  statistics::StreamingSampleStatistics) of the states and dependent variables of an ensemble of single-arc propagations
+ *  (e.g. a Monte Carlo analysis) at a fixed set of epochs. The results of each member are added as soon as its propagation
+ *  is finished, after which they may be discarded, so that the memory use is independent of the number of members. The
+ *  member results are interpolated to the statistics epochs, unless an epoch is part of the member's output (as is the case
+ *  for a fixed-step integrator with the statistics epochs on the step grid). Members that do not cover a statistics epoch
+ *  (e.g. due to early termination) do not contribute to the statistics at that epoch. Accumulators filled by different
+ *  threads or processes can be merged.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class EnsembleStatisticsAccumulator
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param statisticsEpochs Epochs at which the statistics are to be computed
+     *  \param quantileCompression Compression parameter of the quantile sketches (see statistics::StreamingQuantileSketch).
+     *  If this value is not positive, no quantiles are computed.
+     *  \param interpolatorSettings Settings for the interpolation of the member results to the statistics epochs
+     */
+    EnsembleStatisticsAccumulator(
+            const std::vector< TimeType >& statisticsEpochs,
+            const double quantileCompression = 100.0,
+            const std::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings =
+            std::make_shared< interpolators::LagrangeInterpolatorSettings >( 8 ) ):
+        statisticsEpochs_( statisticsEpochs ),
+        interpolatorSettings_( interpolatorSettings ),
+        numberOfMembers_( 0 )
+    {
+        stateStatistics_.resize( statisticsEpochs_.size( ), statistics::StreamingSampleStatistics( 0, quantileCompression ) );
+        dependentVariableStatistics_.resize(
+                    statisticsEpochs_.size( ), statistics::StreamingSampleStatistics( 0, quantileCompression ) );
+    }
+
+    //! Function to add the results of a single member to the statistics
+    /*!
+     *  Function to add the (processed) state and dependent variable history of a single member to the statistics
+     *  \param memberResults Propagation results of the member
+     */
+    void addMember( const std::shared_ptr< SingleArcSimulationResults< StateScalarType, TimeType > > memberResults )
+    {
+        std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& stateHistory =
+                memberResults->getEquationsOfMotionNumericalSolution( );
+        addHistoryToStatistics( stateHistory, stateStatistics_ );
+
+        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory = memberResults->getDependentVariableHistory( );
+        if( dependentVariableHistory.size( ) > 0 )
+        {
+            addHistoryToStatistics( dependentVariableHistory, dependentVariableStatistics_ );
+        }
+        numberOfMembers_++;
+    }
+
+    //! Function to merge the statistics of another accumulator into this accumulator
+    /*!
+     *  Function to merge the statistics of another accumulator (with the same statistics epochs) into this accumulator
+     *  \param otherAccumulator Accumulator of which the statistics are to be merged into this accumulator
+     */
+    void merge( const EnsembleStatisticsAccumulator< StateScalarType, TimeType >& otherAccumulator )
+    {
+        if( otherAccumulator.statisticsEpochs_ != statisticsEpochs_ )
+        {
+            throw std::runtime_error( "Error when merging ensemble statistics, statistics epochs are not equal" );
+        }
+
+        for( unsigned int i = 0; i < statisticsEpochs_.size( ); i++ )
+        {
+            stateStatistics_[ i ].merge( otherAccumulator.stateStatistics_.at( i ) );
+            dependentVariableStatistics_[ i ].merge( otherAccumulator.dependentVariableStatistics_.at( i ) );
+        }
+        numberOfMembers_ += otherAccumulator.numberOfMembers_;
+    }
+
+    //! Function to combine the statistics accumulated by the processes of a group
+    /*!
+     *  Function to combine the statistics accumulated by the processes of a group (each having propagated a subset of the
+     *  members, e.g. as determined by utilities::getProcessItemRange), after which the statistics are identical on all
+     *  processes (see statistics::mergeStatisticsOverProcesses).
+     *  \param processCommunicator Object used for the communication between the processes
+     */
+    void mergeOverProcesses( const std::shared_ptr< utilities::ProcessCommunicator > processCommunicator )
+    {
+        std::vector< statistics::StreamingSampleStatistics > allStatistics = stateStatistics_;
+        allStatistics.insert( allStatistics.end( ), dependentVariableStatistics_.begin( ), dependentVariableStatistics_.end( ) );
+        statistics::mergeStatisticsOverProcesses( allStatistics, processCommunicator );
+
+        stateStatistics_.assign( allStatistics.begin( ), allStatistics.begin( ) + statisticsEpochs_.size( ) );
+        dependentVariableStatistics_.assign( allStatistics.begin( ) + statisticsEpochs_.size( ), allStatistics.end( ) );
+
+        double numberOfMembers = static_cast< double >( numberOfMembers_ );
+        processCommunicator->sumOverProcesses( &numberOfMembers, 1 );
+        numberOfMembers_ = static_cast< int >( numberOfMembers );
+    }
+
+    //! Function to remove the contributions of all members
+    void reset( )
+    {
+        for( unsigned int i = 0; i < statisticsEpochs_.size( ); i++ )
+        {
+            stateStatistics_[ i ].reset( );
+            dependentVariableStatistics_[ i ].reset( );
+        }
+        numberOfMembers_ = 0;
+    }
+
+    //! Function to retrieve the number of members that have been added
+    int getNumberOfMembers( ) const
+    {
+        return numberOfMembers_;
+    }
+
+    //! Function to retrieve the epochs at which the statistics are computed
+    std::vector< TimeType > getStatisticsEpochs( ) const
+    {
+        return statisticsEpochs_;
+    }
+
+    //! Function to retrieve the statistics of the states, one entry per statistics epoch
+    const std::vector< statistics::StreamingSampleStatistics >& getStateStatistics( ) const
+    {
+        return stateStatistics_;
+    }
+
+    //! Function to retrieve the statistics of the dependent variables, one entry per statistics epoch
+    const std::vector< statistics::StreamingSampleStatistics >& getDependentVariableStatistics( ) const
+    {
+        return dependentVariableStatistics_;
+    }
+
+    //! Function to retrieve the history of the mean state
+    std::map< TimeType, Eigen::VectorXd > getStateMeanHistory( ) const
+    {
+        return getStatisticsHistory< Eigen::VectorXd >(
+                    stateStatistics_, [ ]( const statistics::StreamingSampleStatistics& epochStatistics )
+        { return epochStatistics.getMean( ); } );
+    }
+
+    //! Function to retrieve the history of the state covariance
+    std::map< TimeType, Eigen::MatrixXd > getStateCovarianceHistory( ) const
+    {
+        return getStatisticsHistory< Eigen::MatrixXd >(
+                    stateStatistics_, [ ]( const statistics::StreamingSampleStatistics& epochStatistics )
+        { return epochStatistics.getCovariance( ); } );
+    }
+
+    //! Function to retrieve the history of (an estimate of) a quantile of the state entries
+    std::map< TimeType, Eigen::VectorXd > getStateQuantileHistory( const double quantile ) const
+    {
+        return getStatisticsHistory< Eigen::VectorXd >(
+                    stateStatistics_, [ = ]( const statistics::StreamingSampleStatistics& epochStatistics )
+        { return epochStatistics.getQuantiles( quantile ); } );
+    }
+
+    //! Function to retrieve the history of the mean dependent variables
+    std::map< TimeType, Eigen::VectorXd > getDependentVariableMeanHistory( ) const
+    {
+        return getStatisticsHistory< Eigen::VectorXd >(
+                    dependentVariableStatistics_, [ ]( const statistics::StreamingSampleStatistics& epochStatistics )
+        { return epochStatistics.getMean( ); } );
+    }
+
+    //! Function to retrieve the history of the dependent variable covariance
+    std::map< TimeType, Eigen::MatrixXd > getDependentVariableCovarianceHistory( ) const
+    {
+        return getStatisticsHistory< Eigen::MatrixXd >(
+                    dependentVariableStatistics_, [ ]( const statistics::StreamingSampleStatistics& epochStatistics )
+        { return epochStatistics.getCovariance( ); } );
+    }
+
+    //! Function to retrieve the history of (an estimate of) a quantile of the dependent variables
+    std::map< TimeType, Eigen::VectorXd > getDependentVariableQuantileHistory( const double quantile ) const
+    {
+        return getStatisticsHistory< Eigen::VectorXd >(
+                    dependentVariableStatistics_, [ = ]( const statistics::StreamingSampleStatistics& epochStatistics )
+        { return epochStatistics.getQuantiles( quantile ); } );
+    }
+
+private:
+
+    //! Function to add the values of a history at the statistics epochs to the statistics
+    template< typename ScalarType >
+    void addHistoryToStatistics( const std::map< TimeType, Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > >& history,
+                                 std::vector< statistics::StreamingSampleStatistics >& epochStatistics )
+    {
+        if( history.size( ) == 0 )
+        {
+            return;
+        }
+
+        TimeType historyStartTime = std::min( history.begin( )->first, history.rbegin( )->first );
+        TimeType historyEndTime = std::max( history.begin( )->first, history.rbegin( )->first );
+
+        // Interpolator is only created if one of the statistics epochs is not part of the history
+        std::shared_ptr< interpolators::OneDimensionalInterpolator< TimeType, Eigen::VectorXd > > historyInterpolator;
+        for( unsigned int i = 0; i < statisticsEpochs_.size( ); i++ )
+        {
+            TimeType currentEpoch = statisticsEpochs_.at( i );
+            if( currentEpoch < historyStartTime || currentEpoch > historyEndTime )
+            {
+                continue;
+            }
+
+            auto historyIterator = history.find( currentEpoch );
+            if( historyIterator != history.end( ) )
+            {
+                epochStatistics[ i ].addSample( historyIterator->second.template cast< double >( ) );
+            }
+            else
+            {
+                if( historyInterpolator == nullptr )
+                {
+                    std::map< TimeType, Eigen::VectorXd > doubleHistory;
+                    for( auto it : history )
+                    {
+                        doubleHistory[ it.first ] = it.second.template cast< double >( );
+                    }
+                    historyInterpolator = interpolators::createOneDimensionalInterpolator(
+                                doubleHistory, interpolatorSettings_ );
+                }
+                epochStatistics[ i ].addSample( historyInterpolator->interpolate( currentEpoch ) );
+            }
+        }
+    }
+
+    //! Function to retrieve the history of a given statistic, for all epochs with at least one sample
+    template< typename StatisticType >
+    std::map< TimeType, StatisticType > getStatisticsHistory(
+            const std::vector< statistics::StreamingSampleStatistics >& epochStatistics,
+            const std::function< StatisticType( const statistics::StreamingSampleStatistics& ) > statisticFunction ) const
+    {
+        std::map< TimeType, StatisticType > statisticsHistory;
+        for( unsigned int i = 0; i < statisticsEpochs_.size( ); i++ )
+        {
+            if( epochStatistics.at( i ).getNumberOfSamples( ) > 0 )
+            {
+                statisticsHistory[ statisticsEpochs_.at( i ) ] = statisticFunction( epochStatistics.at( i ) );
+            }
+        }
+        return statisticsHistory;
+    }
+
+    //! Epochs at which the statistics are computed
+    std::vector< TimeType > statisticsEpochs_;
+
+    //! Settings for the interpolation of the member results to the statistics epochs
+    std::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings_;
+
+    //! Statistics of the states, one entry per statistics epoch
+    std::vector< statistics::StreamingSampleStatistics > stateStatistics_;
+
+    //! Statistics of the dependent variables, one entry per statistics epoch
+    std::vector< statistics::StreamingSampleStatistics > dependentVariableStatistics_;
+
+    //! Number of members that have been added
+    int numberOfMembers_;
+};
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_ENSEMBLESTATISTICS_H
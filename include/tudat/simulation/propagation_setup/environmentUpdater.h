@@ -24,9 +24,14 @@
 #include <boost/tuple/tuple_io.hpp>
 
 #include "tudat/simulation/environment_setup/body.h"
+#include "tudat/astro/ephemerides/constantRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/itrsToGcrsRotationModel.h"
+#include "tudat/astro/ephemerides/simpleRotationalEphemeris.h"
 #include "tudat/astro/gravitation/timeDependentSphericalHarmonicsGravityField.h"
+#include "tudat/interface/spice/spiceRotationalEphemeris.h"
 #include "tudat/simulation/propagation_setup/propagationSettings.h"
 #include "tudat/astro/propagators/environmentUpdateTypes.h"
+#include "tudat/basics/modelEvaluationProfiler.h"
 
 namespace tudat
 {
@@ -39,7 +44,10 @@ namespace propagators
  *  Class used to update the environment during numerical integration. The class ensures that the
  *  current state of the numerical integration is properly set, and that all the environment models
  *  that are used during the numerical integration are updated to the current time and state in the
- *  correct order.
+ *  correct order. The required updates are compiled once (upon construction) into a flat, ordered list of update
+ *  steps, with the bodies of the integrated states resolved beforehand. Models that depend only on time (e.g. ephemerides
+ *  of bodies that are not propagated, and rotation models that do not depend on the propagated states) are not recomputed
+ *  when they are already current at the requested time.
  */
 template< typename StateScalarType, typename TimeType >
 class EnvironmentUpdater
@@ -69,6 +77,9 @@ public:
             std::vector< std::tuple< std::string, std::string, PropagatorType > > >( ) ) ):
         bodyList_( bodyList ), integratedStates_( integratedStates )
     {
+        // Retrieve bodies of which the states are numerically integrated
+        setIntegratedStateBodies( );
+
         // Set update function to be evaluated as dependent variables of state and time during each
         // integration time step.
         setUpdateFunctions( updateSettings );
@@ -105,9 +116,10 @@ public:
                                       std::to_string( integratedStates_.size( ) ) );
         }
 
-        for( unsigned int i = 0; i < resetFunctionVector_.size( ); i++ )
+        // Reset models that are to be recomputed, regardless of their current time
+        for( unsigned int i = 0; i < stateDependentResetFunctions_.size( ); i++ )
         {
-            resetFunctionVector_.at( i ).template get< 2 >( )( );
+            stateDependentResetFunctions_[ i ]( );
         }
 
         // Set integrated state variables in environment.
@@ -118,14 +130,146 @@ public:
 
         // Evaluate time-dependent update functions (dependent variables of state and time)
         // determined by setUpdateFunctions
-        for( unsigned int i = 0; i < updateFunctionVector_.size( ); i++ )
+        for( unsigned int i = 0; i < updateSteps_.size( ); i++ )
+        {
+            EnvironmentUpdateStep& currentStep = updateSteps_[ i ];
+            if( currentStep.isTimeDependentOnly_ )
+            {
+                if( currentStep.timeOfLastUpdate_ == currentTime )
+                {
+                    continue;
+                }
+                currentStep.timeOfLastUpdate_ = currentTime;
+            }
+            TUDAT_PROFILE_MODEL_EVALUATION( modelEvaluationProfiler_, currentStep.profilingIndex_ );
+            currentStep.updateFunction_( currentTime );
+        }
+    }
+
+    //! Function to force all environment models to be recomputed upon the next update
+    /*!
+     * Function to force all environment models to be recomputed upon the next update, including those that depend only on
+     * time, and are otherwise not recomputed when called repeatedly with the same time. This function is to be called
+     * when the environment is modified by any means other than this object (e.g. before the start of a propagation).
+     */
+    void resetCurrentTime( )
+    {
+        for( unsigned int i = 0; i < resetFunctionVector_.size( ); i++ )
+        {
+            resetFunctionVector_.at( i ).template get< 2 >( )( );
+        }
+
+        for( unsigned int i = 0; i < updateSteps_.size( ); i++ )
+        {
+            updateSteps_[ i ].timeOfLastUpdate_ = static_cast< TimeType >( TUDAT_NAN );
+        }
+    }
+
+    //! Function to retrieve the ordered list of environment models that are updated
+    /*!
+     * Function to retrieve the ordered list of environment models that are updated, with each entry denoting the
+     * type of environment model and the body to which it belongs
+     * \return Ordered list of environment models that are updated
+     */
+    std::vector< std::pair< EnvironmentModelsToUpdate, std::string > > getUpdateOrder( )
+    {
+        std::vector< std::pair< EnvironmentModelsToUpdate, std::string > > updateOrder;
+        for( unsigned int i = 0; i < updateSteps_.size( ); i++ )
         {
-            updateFunctionVector_.at( i ).template get< 2 >( )( currentTime );
+            updateOrder.push_back( std::make_pair( updateSteps_[ i ].modelType_, updateSteps_[ i ].bodyName_ ) );
         }
+        return updateOrder;
+    }
+
+    //! Function to set the object to which the evaluations of the environment model updates are to be profiled
+    /*!
+     * Function to set the object to which the evaluations of the environment model updates are to be profiled, registering
+     * each update step (environment_update category), and the aerodynamic coefficient evaluation of each vehicle
+     * (aerodynamic_coefficient_update category)
+     * \param modelEvaluationProfiler Object to which model evaluations are to be profiled (nullptr to disable profiling)
+     */
+    void setModelEvaluationProfiler(
+            const std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler )
+    {
+        modelEvaluationProfiler_ = modelEvaluationProfiler;
+        registerProfiledUpdateSteps( );
     }
 
 private:
 
+    //! Single step in the (ordered) list of environment model updates
+    struct EnvironmentUpdateStep
+    {
+        //! Type of environment model that is updated
+        EnvironmentModelsToUpdate modelType_;
+
+        //! Name of body to which environment model belongs
+        std::string bodyName_;
+
+        //! Function that updates the environment model to the current time
+        std::function< void( const double ) > updateFunction_;
+
+        //! Boolean denoting whether the environment model depends only on time (and not on the propagated states)
+        bool isTimeDependentOnly_;
+
+        //! Time of last update of environment model (only used if isTimeDependentOnly_ is true)
+        TimeType timeOfLastUpdate_;
+
+        //! Index of update step in modelEvaluationProfiler_ (only used if profiler is set)
+        int profilingIndex_ = -1;
+    };
+
+    //! Function to register the update steps in modelEvaluationProfiler_ (if set)
+    void registerProfiledUpdateSteps( )
+    {
+        for( unsigned int i = 0; i < updateSteps_.size( ); i++ )
+        {
+            updateSteps_[ i ].profilingIndex_ = ( modelEvaluationProfiler_ == nullptr ) ? -1 :
+                modelEvaluationProfiler_->addProfiledModel(
+                        "environment_update", updateSteps_[ i ].bodyName_ + ": " +
+                        getEnvironmentUpdateTypeName( updateSteps_[ i ].modelType_ ) );
+
+            // Profile aerodynamic coefficient evaluation of each vehicle separately
+            if( updateSteps_[ i ].modelType_ == vehicle_flight_conditions_update )
+            {
+                std::shared_ptr< aerodynamics::AerodynamicCoefficientInterface > coefficientInterface =
+                        bodyList_.at( updateSteps_[ i ].bodyName_ )->getAerodynamicCoefficientInterface( );
+                if( coefficientInterface != nullptr )
+                {
+                    coefficientInterface->setModelEvaluationProfiler(
+                                modelEvaluationProfiler_, updateSteps_[ i ].bodyName_ );
+                }
+            }
+        }
+    }
+
+    //! Function to retrieve the body objects of which the states are numerically integrated
+    void setIntegratedStateBodies( )
+    {
+        integratedStateBodies_[ translational_state ] = std::vector< std::shared_ptr< simulation_setup::Body > >( );
+        integratedStateBodies_[ rotational_state ] = std::vector< std::shared_ptr< simulation_setup::Body > >( );
+        integratedStateBodies_[ body_mass_state ] = std::vector< std::shared_ptr< simulation_setup::Body > >( );
+        for( auto stateIterator : integratedStates_ )
+        {
+            std::vector< std::shared_ptr< simulation_setup::Body > > currentBodies;
+            if( stateIterator.first == translational_state || stateIterator.first == rotational_state ||
+                    stateIterator.first == body_mass_state )
+            {
+                for( unsigned int i = 0; i < stateIterator.second.size( ); i++ )
+                {
+                    std::string bodyName = std::get< 0 >( stateIterator.second.at( i ) );
+                    if( bodyList_.count( bodyName ) == 0 )
+                    {
+                        throw std::runtime_error(
+                                    "Error when creating environment updater, could not find integrated body " + bodyName );
+                    }
+                    currentBodies.push_back( bodyList_.at( bodyName ) );
+                }
+            }
+            integratedStateBodies_[ stateIterator.first ] = currentBodies;
+        }
+    }
+
     //! Function to set numerically integrated states in environment.
     /*!
      * Function to set numerically integrated states in environment.  Note that these states must
@@ -148,21 +292,22 @@ private:
             case translational_state:
             {
                 // Set translational states for bodies provided as input.
-                for( unsigned int i = 0; i < integratedStates_[ translational_state ].size( ); i++ )
+                const std::vector< std::shared_ptr< simulation_setup::Body > >& bodiesWithIntegratedStates =
+                        integratedStateBodies_.at( translational_state );
+                for( unsigned int i = 0; i < bodiesWithIntegratedStates.size( ); i++ )
                 {
-                    bodyList_.at( std::get< 0 >( integratedStates_[ translational_state ][ i ] ) )->template
-                            setTemplatedState< StateScalarType >(
+                    bodiesWithIntegratedStates[ i ]->template setTemplatedState< StateScalarType >(
                                 integratedStateIterator_->second.segment( i * 6, 6 ) );
                 }
                 break;
             }
             case rotational_state:
             {
-                std::vector< std::tuple< std::string, std::string, PropagatorType > > bodiesWithIntegratedStates =
-                        integratedStates_.at( rotational_state );
+                const std::vector< std::shared_ptr< simulation_setup::Body > >& bodiesWithIntegratedStates =
+                        integratedStateBodies_.at( rotational_state );
                 for( unsigned int i = 0; i < bodiesWithIntegratedStates.size( ); i++ )
                 {
-                    bodyList_.at( std::get< 0 >( bodiesWithIntegratedStates[ i ] ) )->setCurrentRotationalStateToLocalFrame(
+                    bodiesWithIntegratedStates[ i ]->setCurrentRotationalStateToLocalFrame(
                                 integratedStateIterator_->second.segment( i * 7, 7 ).template cast< double >( ) );
                 }
                 break;
@@ -170,13 +315,12 @@ private:
             case body_mass_state:
             {
                 // Set mass for bodies provided as input.
-                std::vector< std::tuple< std::string, std::string, PropagatorType > > bodiesWithIntegratedMass =
-                        integratedStates_.at( body_mass_state );
+                const std::vector< std::shared_ptr< simulation_setup::Body > >& bodiesWithIntegratedMass =
+                        integratedStateBodies_.at( body_mass_state );
 
                 for( unsigned int i = 0; i < bodiesWithIntegratedMass.size( ); i++ )
                 {
-                    bodyList_.at( std::get< 0 >( bodiesWithIntegratedMass[ i ] ) )
-                            ->setCurrentPropagatedBodyMass( integratedStateIterator_->second( i ) );
+                    bodiesWithIntegratedMass[ i ]->setCurrentPropagatedBodyMass( integratedStateIterator_->second( i ) );
                 }
                 break;
             }
@@ -210,23 +354,22 @@ private:
             case translational_state:
             {
                 // Iterate over all integrated translational states.
-                std::vector< std::tuple< std::string, std::string, PropagatorType > > bodiesWithIntegratedStates =
-                        integratedStates_[ translational_state ];
+                const std::vector< std::shared_ptr< simulation_setup::Body > >& bodiesWithIntegratedStates =
+                        integratedStateBodies_.at( translational_state );
                 for( unsigned int i = 0; i < bodiesWithIntegratedStates.size( ); i++ )
                 {
-                    bodyList_.at( std::get< 0 >( bodiesWithIntegratedStates[ i ] ) )->
-                            template setStateFromEphemeris< StateScalarType, TimeType >( currentTime );
+                    bodiesWithIntegratedStates[ i ]->template setStateFromEphemeris< StateScalarType, TimeType >( currentTime );
 
                 }
                 break;
             }
             case rotational_state:
             {
-                std::vector< std::tuple< std::string, std::string, PropagatorType > > bodiesWithIntegratedStates =
-                        integratedStates_.at( rotational_state );
+                const std::vector< std::shared_ptr< simulation_setup::Body > >& bodiesWithIntegratedStates =
+                        integratedStateBodies_.at( rotational_state );
                 for( unsigned int i = 0; i < bodiesWithIntegratedStates.size( ); i++ )
                 {
-                    bodyList_.at( std::get< 0 >( bodiesWithIntegratedStates[ i ] ) )->template setCurrentRotationalStateToLocalFrameFromEphemeris< TimeType >(
+                    bodiesWithIntegratedStates[ i ]->template setCurrentRotationalStateToLocalFrameFromEphemeris< TimeType >(
                                 currentTime );
                 }
                 break;
@@ -234,12 +377,11 @@ private:
             case body_mass_state:
             {
                 // Iterate over all integrated masses.
-                std::vector< std::tuple< std::string, std::string, PropagatorType > > bodiesWithIntegratedStates =
-                        integratedStates_.at( body_mass_state );
+                const std::vector< std::shared_ptr< simulation_setup::Body > >& bodiesWithIntegratedStates =
+                        integratedStateBodies_.at( body_mass_state );
                 for( unsigned int i = 0; i < bodiesWithIntegratedStates.size( ); i++ )
                 {
-                    bodyList_.at( std::get< 0 >( bodiesWithIntegratedStates[ i ] ) )->
-                            updateMass( currentTime );
+                    bodiesWithIntegratedStates[ i ]->updateMass( currentTime );
 
                 }
                 break;
@@ -603,9 +745,8 @@ private:
                                     resetFunctionVector_.push_back(
                                                 boost::make_tuple(
                                                     body_rotational_state_update, currentBodies.at( i ),
-                                                    std::bind( &ephemerides::RotationalEphemeris::
-                                                               resetCurrentTime, bodyList_.at( currentBodies.at( i ) )->
-                                                               getRotationalEphemeris( ) ) ) );
+                                                    std::bind( &simulation_setup::Body::recomputeRotationalStateOnNextCall,
+                                                               bodyList_.at( currentBodies.at( i ) ) ) ) );
                                 }
                             }
                             else
@@ -686,6 +827,11 @@ private:
                                                        ::TimeDependentSphericalHarmonicsGravityField
                                                        ::update,
                                                        gravityField, std::placeholders::_1 ) ) );
+                            resetFunctionVector_.push_back(
+                                boost::make_tuple(
+                                    spherical_harmonic_gravity_field_update, currentBodies.at( i ),
+                                    std::bind( &gravitation::TimeDependentSphericalHarmonicsGravityField::resetCurrentTime,
+                                               gravityField ) ) );
                         }
                         // If no sh field at all, throw eeror.
                         else if( std::dynamic_pointer_cast< gravitation::SphericalHarmonicsGravityField >
@@ -819,6 +965,95 @@ private:
 
         // Set update order of functions.
         setUpdateFunctionOrder( );
+
+        // Compile ordered list of update steps
+        compileUpdateSteps( );
+    }
+
+    //! Function to determine whether the update of an environment model depends only on time
+    /*!
+     * Function to determine whether the update of an environment model depends only on time, and not on the propagated
+     * states (in which case, the model need not be recomputed when called repeatedly at the same time). Only the
+     * translational states of bodies for which the (chain of) ephemeris origin(s) is not propagated, the rotational
+     * states of bodies with a rotation model that is directly defined as a function of time, and time-dependent spherical
+     * harmonic gravity fields with only time-dependent variations (e.g. periodic or tabulated) are identified as such.
+     * \param modelType Type of environment model
+     * \param bodyName Name of body to which environment model belongs
+     * \return True if update of environment model depends only on time
+     */
+    bool isUpdateTimeDependentOnly( const EnvironmentModelsToUpdate modelType, const std::string& bodyName )
+    {
+        bool isTimeDependentOnly = false;
+        if( modelType == body_translational_state_update )
+        {
+            std::vector< std::string > integratedTranslationalStates;
+            if( integratedStates_.count( translational_state ) > 0 )
+            {
+                integratedTranslationalStates = utilities::getFirstTupleEntryVector( integratedStates_.at( translational_state ) );
+            }
+
+            // Check if any of the ephemeris origins of the body is propagated
+            isTimeDependentOnly = true;
+            std::string currentBody = bodyName;
+            unsigned int numberOfBodies = bodyList_.getMap( ).size( );
+            for( unsigned int i = 0; i <= numberOfBodies; i++ )
+            {
+                if( std::find( integratedTranslationalStates.begin( ), integratedTranslationalStates.end( ), currentBody ) !=
+                        integratedTranslationalStates.end( ) )
+                {
+                    isTimeDependentOnly = false;
+                    break;
+                }
+                else if( bodyList_.count( currentBody ) == 0 || bodyList_.at( currentBody )->getEphemeris( ) == nullptr )
+                {
+                    break;
+                }
+                currentBody = bodyList_.at( currentBody )->getEphemeris( )->getReferenceFrameOrigin( );
+            }
+        }
+        else if( modelType == body_rotational_state_update )
+        {
+            std::shared_ptr< ephemerides::RotationalEphemeris > rotationModel =
+                    bodyList_.at( bodyName )->getRotationalEphemeris( );
+            isTimeDependentOnly = ( rotationModel != nullptr ) && rotationModel->isTimeDependentOnly( );
+        }
+        else if( modelType == spherical_harmonic_gravity_field_update )
+        {
+            std::shared_ptr< gravitation::TimeDependentSphericalHarmonicsGravityField > gravityField =
+                    std::dynamic_pointer_cast< gravitation::TimeDependentSphericalHarmonicsGravityField >(
+                        bodyList_.at( bodyName )->getGravityFieldModel( ) );
+            isTimeDependentOnly = ( gravityField != nullptr ) && gravityField->areVariationsTimeDependentOnly( );
+        }
+        return isTimeDependentOnly;
+    }
+
+    //! Function to compile the ordered list of update steps and reset functions that are called during each update
+    void compileUpdateSteps( )
+    {
+        updateSteps_.clear( );
+        for( unsigned int i = 0; i < updateFunctionVector_.size( ); i++ )
+        {
+            EnvironmentUpdateStep currentStep;
+            currentStep.modelType_ = updateFunctionVector_.at( i ).template get< 0 >( );
+            currentStep.bodyName_ = updateFunctionVector_.at( i ).template get< 1 >( );
+            currentStep.updateFunction_ = updateFunctionVector_.at( i ).template get< 2 >( );
+            currentStep.isTimeDependentOnly_ = isUpdateTimeDependentOnly( currentStep.modelType_, currentStep.bodyName_ );
+            currentStep.timeOfLastUpdate_ = static_cast< TimeType >( TUDAT_NAN );
+            updateSteps_.push_back( currentStep );
+        }
+        registerProfiledUpdateSteps( );
+
+        // Models that depend only on time are reset only by resetCurrentTime (the translational state of a body
+        // is not recomputed from its ephemeris if it is already current).
+        stateDependentResetFunctions_.clear( );
+        for( unsigned int i = 0; i < resetFunctionVector_.size( ); i++ )
+        {
+            if( !isUpdateTimeDependentOnly( resetFunctionVector_.at( i ).template get< 0 >( ),
+                                            resetFunctionVector_.at( i ).template get< 1 >( ) ) )
+            {
+                stateDependentResetFunctions_.push_back( resetFunctionVector_.at( i ).template get< 2 >( ) );
+            }
+        }
     }
 
     //! List of body objects, this list encompasses all environment object in the simulation.
@@ -844,6 +1079,17 @@ private:
     //! time step).
     std::vector< boost::tuple< EnvironmentModelsToUpdate, std::string, std::function< void( ) > > > resetFunctionVector_;
 
+    //! Ordered list of update steps that is evaluated during each update (compiled from updateFunctionVector_)
+    std::vector< EnvironmentUpdateStep > updateSteps_;
+
+    //! List of reset functions that is evaluated before each update (excluding those of models that depend only on time)
+    std::vector< std::function< void( ) > > stateDependentResetFunctions_;
+
+    //! Object to which the environment model updates are profiled (nullptr if not profiled)
+    std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfiler_;
+
+    //! Body objects of which the translational, rotational and mass states are numerically integrated
+    std::map< IntegratedStateType, std::vector< std::shared_ptr< simulation_setup::Body > > > integratedStateBodies_;
 
 
 
@@ -0,0 +1,526 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Lions, J.-L., Maday, Y. and Turinici, G., A "parareal" in time discretization of PDE's,
+ *          Comptes Rendus de l'Academie des Sciences, Series I, 332, 661-668, 2001.
+ */
+
+#ifndef TUDAT_PARAREALDYNAMICSSIMULATOR_H
+#define TUDAT_PARAREALDYNAMICSSIMULATOR_H
+
+#include <iostream>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/basics/parallelization.h"
+#include "tudat/simulation/propagation_setup/dynamicsSimulator.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Class defining the settings for a parallel-in-time (Parareal) propagation
+class PararealSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param numberOfTimeSlices Number of time slices into which the propagation interval is divided
+     *  \param maximumNumberOfIterations Maximum number of Parareal iterations (fine propagations of the time slices). If
+     *  equal to the number of time slices, the (exact) sequential fine solution is obtained if the iteration does not converge
+     *  earlier. If negative (default), it is set equal to the number of time slices.
+     *  \param relativeConvergenceTolerance Convergence tolerance of the iterations: the iteration is converged if, for each
+     *  time slice, the infinity norm of the correction to the initial state, divided by the infinity norm of that state, is
+     *  below this value.
+     *  \param printIterationDiagnostics Boolean denoting whether the maximum correction of each iteration is to be printed
+     */
+    PararealSettings( const int numberOfTimeSlices,
+                      const int maximumNumberOfIterations = -1,
+                      const double relativeConvergenceTolerance = 1.0E-12,
+                      const bool printIterationDiagnostics = false ):
+        numberOfTimeSlices_( numberOfTimeSlices ),
+        maximumNumberOfIterations_( maximumNumberOfIterations < 0 ? numberOfTimeSlices : maximumNumberOfIterations ),
+        relativeConvergenceTolerance_( relativeConvergenceTolerance ),
+        printIterationDiagnostics_( printIterationDiagnostics )
+    {
+        if( numberOfTimeSlices_ < 1 )
+        {
+            throw std::runtime_error( "Error when creating Parareal settings, at least one time slice is required" );
+        }
+        if( maximumNumberOfIterations_ < 1 )
+        {
+            throw std::runtime_error( "Error when creating Parareal settings, at least one iteration is required" );
+        }
+    }
+
+    //! Number of time slices into which the propagation interval is divided
+    int numberOfTimeSlices_;
+
+    //! Maximum number of Parareal iterations
+    int maximumNumberOfIterations_;
+
+    //! Convergence tolerance of the iterations (see constructor)
+    double relativeConvergenceTolerance_;
+
+    //! Boolean denoting whether the maximum correction of each iteration is to be printed
+    bool printIterationDiagnostics_;
+};
+
+//! Function to create settings for a parallel-in-time (Parareal) propagation
+/*!
+ *  Function to create settings for a parallel-in-time (Parareal) propagation (see PararealSettings constructor)
+ */
+inline std::shared_ptr< PararealSettings > pararealSettings(
+        const int numberOfTimeSlices,
+        const int maximumNumberOfIterations = -1,
+        const double relativeConvergenceTolerance = 1.0E-12,
+        const bool printIterationDiagnostics = false )
+{
+    return std::make_shared< PararealSettings >(
+                numberOfTimeSlices, maximumNumberOfIterations, relativeConvergenceTolerance, printIterationDiagnostics );
+}
+
+//! Class for the parallel-in-time (Parareal) propagation of a single arc (experimental)
+/*!
+ *  Class for the parallel-in-time (Parareal) propagation of a single arc, for long propagations that cannot be
+ *  parallelized otherwise. The propagation interval is divided into N time slices. A cheap coarse propagator G (e.g.
+ *  low-degree gravity field, large steps) is used to sequentially compute initial estimates U_n of the state at the start
+ *  of each slice. In each iteration, all slices are then propagated concurrently with the (accurate) fine propagator F,
+ *  after which the slice initial states are corrected sequentially as U_{n+1} <- G( U_n ) + F( U_n^{old} ) - G( U_n^{old} ).
+ *  After k iterations, the first k slices are identical to a sequential fine propagation. The iterations are repeated until
+ *  the corrections of the slice initial states are below the tolerance, or the maximum number of iterations is reached.
+ *  Slices of which the initial state is unchanged w.r.t. the previous iteration are not propagated again.
+ *
+ *  As for the EnsembleDynamicsSimulator, each worker thread requires its own SystemOfBodies and its own (fine)
+ *  propagator settings. The coarse propagator settings (with state derivative models created from the coarse bodies) are
+ *  only used sequentially, between fine iterations, so that the coarse bodies may be shared with a worker. The propagation
+ *  interval is defined by the initial time and time termination settings of the coarse propagator settings. The initial
+ *  times and termination settings of all propagator settings are modified during the propagation, and restored afterwards.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class PararealDynamicsSimulator
+{
+public:
+
+    //! Typedef for the state vector type
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > StateVectorType;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param workerBodies List of bodies, one entry per worker thread, used for the fine propagation. Entries must not
+     *  share any Body objects.
+     *  \param workerPropagatorSettings List of fine propagator settings, one entry per worker thread, with the state
+     *  derivative models of each entry created from the corresponding entry of workerBodies.
+     *  \param coarseBodies Bodies used for the coarse propagation
+     *  \param coarsePropagatorSettings Coarse propagator settings (created from coarseBodies), of which the initial time,
+     *  initial state and (time) termination settings define the propagation.
+     *  \param pararealSettings Settings for the Parareal iterations
+     */
+    PararealDynamicsSimulator(
+            const std::vector< simulation_setup::SystemOfBodies >& workerBodies,
+            const std::vector< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > >& workerPropagatorSettings,
+            const simulation_setup::SystemOfBodies& coarseBodies,
+            const std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > coarsePropagatorSettings,
+            const std::shared_ptr< PararealSettings > pararealSettings ):
+        workerPropagatorSettings_( workerPropagatorSettings ),
+        coarsePropagatorSettings_( coarsePropagatorSettings ),
+        pararealSettings_( pararealSettings ),
+        numberOfIterations_( 0 ), isConverged_( false ),
+        numberOfFineFunctionEvaluations_( 0 ), numberOfCoarseFunctionEvaluations_( 0 )
+    {
+        if( workerBodies.size( ) == 0 )
+        {
+            throw std::runtime_error( "Error when creating Parareal dynamics simulator, no bodies provided" );
+        }
+        else if( workerBodies.size( ) != workerPropagatorSettings.size( ) )
+        {
+            throw std::runtime_error( "Error when creating Parareal dynamics simulator, number of bodies (" +
+                                      std::to_string( workerBodies.size( ) ) + ") and propagator settings (" +
+                                      std::to_string( workerPropagatorSettings.size( ) ) + ") is not equal" );
+        }
+        else if( pararealSettings_ == nullptr )
+        {
+            throw std::runtime_error( "Error when creating Parareal dynamics simulator, no Parareal settings provided" );
+        }
+
+        std::shared_ptr< PropagationTimeTerminationSettings > timeTerminationSettings =
+                std::dynamic_pointer_cast< PropagationTimeTerminationSettings >(
+                    coarsePropagatorSettings_->getTerminationSettings( ) );
+        if( timeTerminationSettings == nullptr )
+        {
+            throw std::runtime_error( "Error when creating Parareal dynamics simulator, only time termination settings are "
+                                      "supported" );
+        }
+        initialTime_ = coarsePropagatorSettings_->getInitialTime( );
+        finalTime_ = timeTerminationSettings->terminationTime_;
+
+        for( unsigned int i = 0; i < workerBodies.size( ); i++ )
+        {
+            for( unsigned int j = 0; j < i; j++ )
+            {
+                if( simulation_setup::doSystemsOfBodiesShareBodies( workerBodies.at( i ), workerBodies.at( j ) ) )
+                {
+                    throw std::runtime_error( "Error when creating Parareal dynamics simulator, bodies of worker " +
+                                              std::to_string( j ) + " and " + std::to_string( i ) + " are not independent" );
+                }
+            }
+
+            if( workerPropagatorSettings.at( i )->getOutputSettingsWithCheck( )->getSetIntegratedResult( ) )
+            {
+                throw std::runtime_error( "Error when creating Parareal dynamics simulator, propagated results cannot be used to "
+                                          "reset the environment for a Parareal propagation" );
+            }
+
+            workerDynamicsSimulators_.push_back(
+                        std::make_shared< SingleArcDynamicsSimulator< StateScalarType, TimeType > >(
+                            workerBodies.at( i ), workerPropagatorSettings.at( i ), false ) );
+        }
+
+        if( coarsePropagatorSettings_->getOutputSettingsWithCheck( )->getSetIntegratedResult( ) )
+        {
+            throw std::runtime_error( "Error when creating Parareal dynamics simulator, coarse propagated results cannot be used "
+                                      "to reset the environment" );
+        }
+        coarseDynamicsSimulator_ = std::make_shared< SingleArcDynamicsSimulator< StateScalarType, TimeType > >(
+                    coarseBodies, coarsePropagatorSettings_, false );
+
+        if( coarsePropagatorSettings_->getConventionalStateSize( ) !=
+                workerPropagatorSettings_.at( 0 )->getConventionalStateSize( ) )
+        {
+            throw std::runtime_error( "Error when creating Parareal dynamics simulator, coarse and fine state sizes are not equal" );
+        }
+    }
+
+    //! Function to perform the Parareal propagation
+    /*!
+     *  Function to perform the Parareal propagation, starting from the initial state of the coarse propagator settings.
+     *  Previously stored results are discarded.
+     */
+    void propagate( )
+    {
+        propagate( coarsePropagatorSettings_->getInitialStates( ) );
+    }
+
+    //! Function to perform the Parareal propagation from a given initial state
+    /*!
+     *  Function to perform the Parareal propagation from a given initial state. Previously stored results are discarded.
+     *  \param initialState Initial state, in the conventional (i.e. not propagator-specific) form.
+     */
+    void propagate( const StateVectorType& initialState )
+    {
+        const int numberOfSlices = pararealSettings_->numberOfTimeSlices_;
+
+        // Store settings that are modified during the propagation
+        std::vector< TimeType > originalInitialTimes;
+        std::vector< std::shared_ptr< PropagationTerminationSettings > > originalTerminationSettings;
+        for( unsigned int i = 0; i < workerPropagatorSettings_.size( ); i++ )
+        {
+            originalInitialTimes.push_back( workerPropagatorSettings_.at( i )->getInitialTime( ) );
+            originalTerminationSettings.push_back( workerPropagatorSettings_.at( i )->getTerminationSettings( ) );
+        }
+        std::shared_ptr< PropagationTerminationSettings > originalCoarseTerminationSettings =
+                coarsePropagatorSettings_->getTerminationSettings( );
+
+        // Define time slices
+        sliceBoundaryTimes_.resize( numberOfSlices + 1 );
+        for( int i = 0; i <= numberOfSlices; i++ )
+        {
+            sliceBoundaryTimes_[ i ] = static_cast< double >( initialTime_ ) + static_cast< double >( i ) *
+                    ( finalTime_ - static_cast< double >( initialTime_ ) ) / static_cast< double >( numberOfSlices );
+        }
+        sliceBoundaryTimes_[ 0 ] = initialTime_;
+
+        // Reset results
+        sliceResults_.clear( );
+        sliceResults_.resize( numberOfSlices );
+        maximumRelativeCorrections_.clear( );
+        numberOfIterations_ = 0;
+        isConverged_ = false;
+        numberOfFineFunctionEvaluations_ = 0;
+        numberOfCoarseFunctionEvaluations_ = 0;
+
+        // Compute initial estimates of slice initial states with coarse propagator
+        sliceInitialStates_.resize( numberOfSlices + 1 );
+        sliceInitialStates_[ 0 ] = initialState;
+        std::vector< StateVectorType > coarseSliceFinalStates( numberOfSlices );
+        for( int i = 0; i < numberOfSlices; i++ )
+        {
+            coarseSliceFinalStates[ i ] = propagateCoarseSlice( i, sliceInitialStates_.at( i ) );
+            sliceInitialStates_[ i + 1 ] = coarseSliceFinalStates.at( i );
+        }
+
+        std::vector< StateVectorType > fineSliceInitialStates( numberOfSlices );
+        std::vector< StateVectorType > fineSliceFinalStates( numberOfSlices );
+        std::vector< bool > isSlicePropagated( numberOfSlices, false );
+        while( !isConverged_ && numberOfIterations_ < pararealSettings_->maximumNumberOfIterations_ )
+        {
+            // Determine which slices require a (new) fine propagation
+            std::vector< int > slicesToPropagate;
+            for( int i = 0; i < numberOfSlices; i++ )
+            {
+                if( !isSlicePropagated.at( i ) || !( fineSliceInitialStates.at( i ) == sliceInitialStates_.at( i ) ) )
+                {
+                    slicesToPropagate.push_back( i );
+                    fineSliceInitialStates[ i ] = sliceInitialStates_.at( i );
+                }
+            }
+
+            // Propagate slices concurrently with fine propagator
+            int numberOfWorkers = workerDynamicsSimulators_.size( );
+            int numberOfSlicesToPropagate = slicesToPropagate.size( );
+            utilities::executeParallelTasks(
+                        numberOfWorkers, [ & ]( const int workerIndex )
+            {
+                for( int i = workerIndex; i < numberOfSlicesToPropagate; i += numberOfWorkers )
+                {
+                    int sliceIndex = slicesToPropagate.at( i );
+                    fineSliceFinalStates[ sliceIndex ] = propagateFineSlice(
+                                workerIndex, sliceIndex, fineSliceInitialStates.at( sliceIndex ) );
+                }
+            }, numberOfWorkers );
+            for( int i = 0; i < numberOfSlicesToPropagate; i++ )
+            {
+                isSlicePropagated[ slicesToPropagate.at( i ) ] = true;
+                numberOfFineFunctionEvaluations_ += static_cast< int >(
+                            sliceResults_.at( slicesToPropagate.at( i ) )->getTotalNumberOfFunctionEvaluations( ) );
+            }
+            numberOfIterations_++;
+
+            // Correct slice initial states sequentially
+            double maximumRelativeCorrection = 0.0;
+            for( int i = 0; i < numberOfSlices; i++ )
+            {
+                StateVectorType newCoarseSliceFinalState;
+                if( sliceInitialStates_.at( i ) == fineSliceInitialStates.at( i ) )
+                {
+                    newCoarseSliceFinalState = coarseSliceFinalStates.at( i );
+                }
+                else
+                {
+                    newCoarseSliceFinalState = propagateCoarseSlice( i, sliceInitialStates_.at( i ) );
+                }
+
+                StateVectorType newSliceInitialState =
+                        newCoarseSliceFinalState + fineSliceFinalStates.at( i ) - coarseSliceFinalStates.at( i );
+                StateScalarType stateNorm = newSliceInitialState.cwiseAbs( ).maxCoeff( );
+                StateScalarType correctionNorm = ( newSliceInitialState - sliceInitialStates_.at( i + 1 ) ).cwiseAbs( ).maxCoeff( );
+                if( stateNorm > 0.0 )
+                {
+                    correctionNorm /= stateNorm;
+                }
+                maximumRelativeCorrection = std::max( maximumRelativeCorrection, static_cast< double >( correctionNorm ) );
+
+                coarseSliceFinalStates[ i ] = newCoarseSliceFinalState;
+                sliceInitialStates_[ i + 1 ] = newSliceInitialState;
+            }
+            maximumRelativeCorrections_.push_back( maximumRelativeCorrection );
+            isConverged_ = ( maximumRelativeCorrection <= pararealSettings_->relativeConvergenceTolerance_ );
+
+            if( pararealSettings_->printIterationDiagnostics_ )
+            {
+                std::cout << "Parareal iteration " << numberOfIterations_ << ": " << numberOfSlicesToPropagate
+                          << " slices propagated, maximum relative correction " << maximumRelativeCorrection << std::endl;
+            }
+        }
+
+        // Restore settings
+        for( unsigned int i = 0; i < workerPropagatorSettings_.size( ); i++ )
+        {
+            workerPropagatorSettings_.at( i )->resetInitialTime( originalInitialTimes.at( i ) );
+            workerPropagatorSettings_.at( i )->resetTerminationSettings( originalTerminationSettings.at( i ) );
+        }
+        coarsePropagatorSettings_->resetInitialTime( initialTime_ );
+        coarsePropagatorSettings_->resetTerminationSettings( originalCoarseTerminationSettings );
+    }
+
+    //! Function to retrieve the (fine) propagation results of each time slice, from the last iteration
+    std::vector< std::shared_ptr< SingleArcSimulationResults< StateScalarType, TimeType > > > getSliceResults( )
+    {
+        return sliceResults_;
+    }
+
+    //! Function to retrieve the full state history, concatenated from the fine propagation results of each time slice
+    /*!
+     *  Function to retrieve the full state history, concatenated from the fine propagation results of each time slice from
+     *  the last iteration (conventional states). At the boundaries of the time slices, the initial state of the next slice
+     *  is used.
+     *  \return Full state history of the propagation
+     */
+    std::map< TimeType, StateVectorType > getEquationsOfMotionNumericalSolution( )
+    {
+        std::map< TimeType, StateVectorType > stateHistory;
+        for( unsigned int i = 0; i < sliceResults_.size( ); i++ )
+        {
+            if( sliceResults_.at( i ) != nullptr )
+            {
+                for( auto stateIterator : sliceResults_.at( i )->getEquationsOfMotionNumericalSolution( ) )
+                {
+                    stateHistory[ stateIterator.first ] = stateIterator.second;
+                }
+            }
+        }
+        return stateHistory;
+    }
+
+    //! Function to retrieve the initial states of the time slices (and the final state), after the last correction
+    std::vector< StateVectorType > getSliceInitialStates( )
+    {
+        return sliceInitialStates_;
+    }
+
+    //! Function to retrieve the times at the boundaries of the time slices
+    std::vector< TimeType > getSliceBoundaryTimes( )
+    {
+        return sliceBoundaryTimes_;
+    }
+
+    //! Function to retrieve the number of Parareal iterations performed in the last propagation
+    int getNumberOfIterations( )
+    {
+        return numberOfIterations_;
+    }
+
+    //! Function to retrieve whether the iterations converged in the last propagation
+    bool getIsConverged( )
+    {
+        return isConverged_;
+    }
+
+    //! Function to retrieve the maximum relative correction to the slice initial states, for each iteration
+    std::vector< double > getMaximumRelativeCorrections( )
+    {
+        return maximumRelativeCorrections_;
+    }
+
+    //! Function to retrieve the total number of state derivative evaluations of the fine propagations
+    int getNumberOfFineFunctionEvaluations( )
+    {
+        return numberOfFineFunctionEvaluations_;
+    }
+
+    //! Function to retrieve the total number of state derivative evaluations of the coarse propagations
+    int getNumberOfCoarseFunctionEvaluations( )
+    {
+        return numberOfCoarseFunctionEvaluations_;
+    }
+
+    //! Function to retrieve the number of worker threads used for the fine propagation
+    int getNumberOfWorkers( )
+    {
+        return workerDynamicsSimulators_.size( );
+    }
+
+private:
+
+    //! Function to propagate a single time slice with a given dynamics simulator, and return the final state
+    StateVectorType propagateSlice(
+            const std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > dynamicsSimulator,
+            const std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > propagatorSettings,
+            const int sliceIndex,
+            const StateVectorType& sliceInitialState,
+            std::shared_ptr< SingleArcSimulationResults< StateScalarType, TimeType > >& sliceResults )
+    {
+        propagatorSettings->resetInitialTime( sliceBoundaryTimes_.at( sliceIndex ) );
+        propagatorSettings->resetTerminationSettings(
+                    propagationTimeTerminationSettings(
+                        static_cast< double >( sliceBoundaryTimes_.at( sliceIndex + 1 ) ), true ) );
+
+        sliceResults = std::make_shared< SingleArcSimulationResults< StateScalarType, TimeType > >(
+                    *dynamicsSimulator->getSingleArcPropagationResults( ) );
+        dynamicsSimulator->template integrateEquationsOfMotion< SingleArcSimulationResults< StateScalarType, TimeType > >(
+                    dynamicsSimulator->getDynamicsStateDerivative( )->convertFromOutputSolution(
+                        sliceInitialState, sliceBoundaryTimes_.at( sliceIndex ) ),
+                    sliceResults );
+
+        if( !sliceResults->integrationCompletedSuccessfully( ) ||
+                sliceResults->getEquationsOfMotionNumericalSolution( ).size( ) == 0 )
+        {
+            throw std::runtime_error( "Error in Parareal propagation, propagation of time slice " + std::to_string( sliceIndex ) +
+                                      " did not complete successfully" );
+        }
+        return sliceResults->getEquationsOfMotionNumericalSolution( ).rbegin( )->second;
+    }
+
+    //! Function to propagate a single time slice with the fine propagator of a given worker
+    StateVectorType propagateFineSlice( const int workerIndex, const int sliceIndex, const StateVectorType& sliceInitialState )
+    {
+        return propagateSlice( workerDynamicsSimulators_.at( workerIndex ), workerPropagatorSettings_.at( workerIndex ),
+                               sliceIndex, sliceInitialState, sliceResults_.at( sliceIndex ) );
+    }
+
+    //! Function to propagate a single time slice with the coarse propagator
+    StateVectorType propagateCoarseSlice( const int sliceIndex, const StateVectorType& sliceInitialState )
+    {
+        std::shared_ptr< SingleArcSimulationResults< StateScalarType, TimeType > > coarseResults;
+        StateVectorType sliceFinalState = propagateSlice(
+                    coarseDynamicsSimulator_, coarsePropagatorSettings_, sliceIndex, sliceInitialState, coarseResults );
+        numberOfCoarseFunctionEvaluations_ += static_cast< int >( coarseResults->getTotalNumberOfFunctionEvaluations( ) );
+        return sliceFinalState;
+    }
+
+    //! Fine propagator settings used by each of the worker threads
+    std::vector< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > > workerPropagatorSettings_;
+
+    //! Fine dynamics simulators used by each of the worker threads
+    std::vector< std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > > workerDynamicsSimulators_;
+
+    //! Coarse propagator settings
+    std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > coarsePropagatorSettings_;
+
+    //! Coarse dynamics simulator
+    std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > coarseDynamicsSimulator_;
+
+    //! Settings for the Parareal iterations
+    std::shared_ptr< PararealSettings > pararealSettings_;
+
+    //! Initial time of the propagation
+    TimeType initialTime_;
+
+    //! Final time of the propagation
+    double finalTime_;
+
+    //! Times at the boundaries of the time slices
+    std::vector< TimeType > sliceBoundaryTimes_;
+
+    //! Initial states of the time slices (and final state), after the last correction
+    std::vector< StateVectorType > sliceInitialStates_;
+
+    //! Fine propagation results of each time slice, from the last iteration
+    std::vector< std::shared_ptr< SingleArcSimulationResults< StateScalarType, TimeType > > > sliceResults_;
+
+    //! Number of Parareal iterations performed in the last propagation
+    int numberOfIterations_;
+
+    //! Boolean denoting whether the iterations converged in the last propagation
+    bool isConverged_;
+
+    //! Maximum relative correction to the slice initial states, for each iteration
+    std::vector< double > maximumRelativeCorrections_;
+
+    //! Total number of state derivative evaluations of the fine propagations
+    int numberOfFineFunctionEvaluations_;
+
+    //! Total number of state derivative evaluations of the coarse propagations
+    int numberOfCoarseFunctionEvaluations_;
+};
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_PARAREALDYNAMICSSIMULATOR_H
@@ -0,0 +1,135 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PERTURBINGBODYEPHEMERISINTERPOLATION_H
+#define TUDAT_PERTURBINGBODYEPHEMERISINTERPOLATION_H
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "tudat/astro/ephemerides/preInterpolatedEphemeris.h"
+#include "tudat/simulation/environment_setup/body.h"
+#include "tudat/simulation/propagation_setup/propagationProcessingSettings.h"
+#include "tudat/simulation/propagation_setup/propagationTerminationSettings.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Function to determine the time interval over which the ephemerides of the perturbing bodies are to be fitted
+/*!
+ *  Function to determine the time interval over which the ephemerides of the perturbing bodies are to be fitted, from the
+ *  initial time and termination settings of the propagation, extended by the time buffer in the interpolation settings.
+ *  The final time is taken from the interpolation settings if it is provided there, and from the time termination
+ *  condition(s) otherwise (an exception is thrown if the propagation is not bounded by any time termination condition).
+ *  \param initialTime Initial time of the propagation
+ *  \param terminationSettings Termination settings of the propagation
+ *  \param interpolationSettings Settings for the fits of the ephemerides
+ *  \return Time interval over which the ephemerides are to be fitted
+ */
+std::pair< double, double > getPerturbingBodyEphemerisInterpolationInterval(
+        const double initialTime,
+        const std::shared_ptr< PropagationTerminationSettings > terminationSettings,
+        const std::shared_ptr< PerturbingBodyEphemerisInterpolationSettings > interpolationSettings );
+
+//! Class that temporarily replaces the ephemerides of perturbing bodies by Chebyshev fits during a propagation
+/*!
+ *  Class that temporarily replaces the ephemerides of perturbing bodies by Chebyshev fits (see PreInterpolatedEphemeris)
+ *  during a propagation. Each body with an ephemeris that is not propagated, not explicitly excluded, and not constant or
+ *  Chebyshev already, has its ephemeris replaced when calling replaceEphemerides, and restored when calling
+ *  restoreEphemerides. The fits are retained, and reused for subsequent propagations, as long as the body's ephemeris is
+ *  the same object (and, for a tabulated ephemeris, uses the same interpolator) and the propagation interval is covered
+ *  by the fitted interval. This ensures that the fits are made only once in an estimation, where the perturbing bodies
+ *  remain fixed over the iterations.
+ */
+class PerturbingBodyEphemerisInterpolator
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param interpolationSettings Settings for the fits of the ephemerides
+     *  \param propagatedBodies Names of the bodies of which the translational state is propagated (of which the
+     *  ephemerides are not replaced)
+     */
+    PerturbingBodyEphemerisInterpolator(
+            const std::shared_ptr< PerturbingBodyEphemerisInterpolationSettings > interpolationSettings,
+            const std::vector< std::string >& propagatedBodies );
+
+    //! Function to replace the ephemerides of the perturbing bodies by Chebyshev fits
+    /*!
+     *  Function to replace the ephemerides of the perturbing bodies by Chebyshev fits over the given interval (creating
+     *  or refitting the fits where needed). An exception is thrown if the ephemerides are already replaced.
+     *  \param bodies Bodies of which the ephemerides are to be replaced
+     *  \param startTime Start of the interval over which the ephemerides are used
+     *  \param endTime End of the interval over which the ephemerides are used
+     */
+    void replaceEphemerides( const simulation_setup::SystemOfBodies& bodies,
+                             const double startTime, const double endTime );
+
+    //! Function to restore the original ephemerides of the perturbing bodies (if they were replaced)
+    void restoreEphemerides( );
+
+    //! Function to check whether the ephemerides of the perturbing bodies are currently replaced
+    bool areEphemeridesReplaced( )
+    {
+        return ( replacedEphemerides_.size( ) > 0 );
+    }
+
+    //! Function to retrieve the Chebyshev fits of the ephemerides, with the body names as key
+    std::map< std::string, std::shared_ptr< ephemerides::PreInterpolatedEphemeris > > getInterpolatedEphemerides( )
+    {
+        return interpolatedEphemerides_;
+    }
+
+    //! Function to retrieve the number of ephemeris fits made by this object since its creation
+    int getNumberOfEphemerisFits( )
+    {
+        return numberOfEphemerisFits_;
+    }
+
+private:
+
+    //! Function to check whether the existing fit of the ephemeris of a body can be used for a given interval
+    bool isExistingFitValid( const std::string& bodyName,
+                             const std::shared_ptr< ephemerides::Ephemeris > bodyEphemeris,
+                             const double startTime, const double endTime );
+
+    //! Settings for the fits of the ephemerides
+    std::shared_ptr< PerturbingBodyEphemerisInterpolationSettings > interpolationSettings_;
+
+    //! Names of bodies of which the ephemerides are not replaced
+    std::set< std::string > bodiesToExclude_;
+
+    //! Chebyshev fits of the ephemerides, with the body names as key
+    std::map< std::string, std::shared_ptr< ephemerides::PreInterpolatedEphemeris > > interpolatedEphemerides_;
+
+    //! Interpolators of the tabulated ephemerides at the time of their fit, with the body names as key
+    std::map< std::string, const void* > fittedTabulatedEphemerisInterpolators_;
+
+    //! Bodies of which the ephemerides are currently replaced, with their original ephemerides
+    std::vector< std::pair< std::shared_ptr< simulation_setup::Body >,
+    std::shared_ptr< ephemerides::Ephemeris > > > replacedEphemerides_;
+
+    //! Number of ephemeris fits made by this object since its creation
+    int numberOfEphemerisFits_;
+};
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_PERTURBINGBODYEPHEMERISINTERPOLATION_H
@@ -17,6 +17,7 @@
 #include "tudat/astro/basic_astro/astrodynamicsFunctions.h"
 #include "tudat/astro/aerodynamics/aerodynamics.h"
 #include "tudat/astro/ephemerides/frameManager.h"
+#include "tudat/astro/propagators/dependentVariablesWriter.h"
 #include "tudat/astro/propagators/dynamicsStateDerivativeModel.h"
 #include "tudat/astro/propagators/rotationalMotionStateDerivative.h"
 #include "tudat/simulation/environment_setup/body.h"
@@ -394,6 +395,76 @@ Eigen::VectorXd getConstellationMinimumVisibleDistance(
     const double limitAngle,
     const double time );
 
+//! Function to retrieve the acceleration model of which the acceleration is to be saved as dependent variable
+/*!
+ *  Function to retrieve the acceleration model of which the acceleration is to be saved as a single acceleration
+ *  dependent variable, and to ensure that it is updated during the propagation (if it is a removed central acceleration)
+ *  \param dependentVariableSettings Settings for dependent variable (must be of type
+ *  SingleAccelerationDependentVariableSaveSettings).
+ *  \param stateDerivativeModels List of state derivative models used in simulations (sorted by dynamics type as key).
+ *  \return Acceleration model of which the acceleration is to be saved
+ */
+template< typename TimeType = double, typename StateScalarType = double >
+std::shared_ptr< basic_astrodynamics::AccelerationModel3d > getAccelerationModelForDependentVariable(
+        const std::shared_ptr< SingleDependentVariableSaveSettings > dependentVariableSettings,
+        const std::unordered_map< IntegratedStateType,
+        std::vector< std::shared_ptr< SingleStateTypeDerivative< StateScalarType, TimeType > > > >& stateDerivativeModels )
+{
+    // Check input consistency.
+    std::shared_ptr< SingleAccelerationDependentVariableSaveSettings > accelerationDependentVariableSettings =
+            std::dynamic_pointer_cast< SingleAccelerationDependentVariableSaveSettings >( dependentVariableSettings );
+    if( accelerationDependentVariableSettings == nullptr )
+    {
+        std::string errorMessage= "Error, inconsistent inout when creating dependent variable function of type single_acceleration_dependent_variable";
+        throw std::runtime_error( errorMessage );
+    }
+
+    // Retrieve list of suitable acceleration models (size should be one to avoid ambiguities)
+    std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > >
+            listOfSuitableAccelerationModels = getAccelerationBetweenBodies(
+                accelerationDependentVariableSettings->associatedBody_,
+                accelerationDependentVariableSettings->secondaryBody_,
+                stateDerivativeModels, accelerationDependentVariableSettings->accelerationModelType_ );
+
+    // Check if third-body counterpart of acceleration is found
+    if( listOfSuitableAccelerationModels.size( ) == 0 && basic_astrodynamics::isAccelerationDirectGravitational(
+                accelerationDependentVariableSettings->accelerationModelType_ ) )
+    {
+        listOfSuitableAccelerationModels = getAccelerationBetweenBodies(
+                    accelerationDependentVariableSettings->associatedBody_,
+                    accelerationDependentVariableSettings->secondaryBody_,
+                    stateDerivativeModels, basic_astrodynamics::getAssociatedThirdBodyAcceleration(
+                        accelerationDependentVariableSettings->accelerationModelType_  ) );
+    }
+
+    if( listOfSuitableAccelerationModels.size( ) != 1 )
+    {
+        std::string errorMessage = "Error when getting acceleration between bodies " +
+                accelerationDependentVariableSettings->associatedBody_ + " and " +
+                accelerationDependentVariableSettings->secondaryBody_ + " of type " +
+                getAccelerationModelName(
+                    accelerationDependentVariableSettings->accelerationModelType_ ) +
+                ", no such acceleration found";
+        throw std::runtime_error( errorMessage );
+    }
+
+    std::shared_ptr< NBodyStateDerivative< StateScalarType, TimeType > > nBodyModel =
+            getTranslationalStateDerivativeModelForBody(
+                accelerationDependentVariableSettings->associatedBody_, stateDerivativeModels );
+    std::map< std::string, std::shared_ptr< gravitation::CentralGravitationalAccelerationModel3d > > removedAcceleration =
+            nBodyModel->getRemovedCentralAcceleration( );
+    if( removedAcceleration.count( accelerationDependentVariableSettings->associatedBody_ ) > 0 )
+    {
+        if( listOfSuitableAccelerationModels.at( 0 ) ==
+                removedAcceleration.at( accelerationDependentVariableSettings->associatedBody_ ) )
+        {
+            nBodyModel->setUpdateRemovedAcceleration( accelerationDependentVariableSettings->associatedBody_ );
+        }
+    }
+
+    return listOfSuitableAccelerationModels.at( 0 );
+}
+
 //! Function to create a function returning a requested dependent variable value (of type VectorXd).
 /*!
  *  Function to create a function returning a requested dependent variable value (of type VectorXd), retrieved from
@@ -500,64 +571,10 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
     }
     case single_acceleration_dependent_variable:
     {
-        // Check input consistency.
-        std::shared_ptr< SingleAccelerationDependentVariableSaveSettings > accelerationDependentVariableSettings =
-                std::dynamic_pointer_cast< SingleAccelerationDependentVariableSaveSettings >( dependentVariableSettings );
-        if( accelerationDependentVariableSettings == nullptr )
-        {
-            std::string errorMessage= "Error, inconsistent inout when creating dependent variable function of type single_acceleration_dependent_variable";
-            throw std::runtime_error( errorMessage );
-        }
-        else
-        {
-            // Retrieve list of suitable acceleration models (size should be one to avoid ambiguities)
-            std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > >
-                    listOfSuitableAccelerationModels = getAccelerationBetweenBodies(
-                        accelerationDependentVariableSettings->associatedBody_,
-                        accelerationDependentVariableSettings->secondaryBody_,
-                        stateDerivativeModels, accelerationDependentVariableSettings->accelerationModelType_ );
-
-            // Check if third-body counterpart of acceleration is found
-            if( listOfSuitableAccelerationModels.size( ) == 0 && basic_astrodynamics::isAccelerationDirectGravitational(
-                        accelerationDependentVariableSettings->accelerationModelType_ ) )
-            {
-                listOfSuitableAccelerationModels = getAccelerationBetweenBodies(
-                            accelerationDependentVariableSettings->associatedBody_,
-                            accelerationDependentVariableSettings->secondaryBody_,
-                            stateDerivativeModels, basic_astrodynamics::getAssociatedThirdBodyAcceleration(
-                                accelerationDependentVariableSettings->accelerationModelType_  ) );
-            }
-
-            if( listOfSuitableAccelerationModels.size( ) != 1 )
-            {
-                std::string errorMessage = "Error when getting acceleration between bodies " +
-                        accelerationDependentVariableSettings->associatedBody_ + " and " +
-                        accelerationDependentVariableSettings->secondaryBody_ + " of type " +
-                        getAccelerationModelName(
-                            accelerationDependentVariableSettings->accelerationModelType_ ) +
-                        ", no such acceleration found";
-                throw std::runtime_error( errorMessage );
-            }
-            else
-            {
-                std::shared_ptr< NBodyStateDerivative< StateScalarType, TimeType > > nBodyModel =
-                        getTranslationalStateDerivativeModelForBody( bodyWithProperty, stateDerivativeModels );
-                std::map< std::string, std::shared_ptr< gravitation::CentralGravitationalAccelerationModel3d > > removedAcceleration =
-                        nBodyModel->getRemovedCentralAcceleration( );
-                if( removedAcceleration.count( accelerationDependentVariableSettings->associatedBody_ ) > 0 )
-                {
-                    if( listOfSuitableAccelerationModels.at( 0 ) ==
-                            removedAcceleration.at( accelerationDependentVariableSettings->associatedBody_ ) )
-                    {
-                        nBodyModel->setUpdateRemovedAcceleration( accelerationDependentVariableSettings->associatedBody_ );
-                    }
-                }
-
-                variableFunction = std::bind( &basic_astrodynamics::AccelerationModel3d::getAcceleration,
-                                              listOfSuitableAccelerationModels.at( 0 ) );
-                parameterSize = 3;
-            }
-        }
+        variableFunction = std::bind( &basic_astrodynamics::AccelerationModel3d::getAcceleration,
+                                      getAccelerationModelForDependentVariable(
+                                          dependentVariableSettings, stateDerivativeModels ) );
+        parameterSize = 3;
         break;
     }
     case spherical_harmonic_acceleration_norm_terms_dependent_variable:
@@ -932,6 +949,9 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                         bodies, bodyWithProperty, secondaryBody );
         }
 
+        bodies.at( bodyWithProperty )->getFlightConditions( )->addRequiredUpdateComponent(
+                    aerodynamics::aerodynamic_coefficients_update );
+
         variableFunction = std::bind(
                     &aerodynamics::AerodynamicCoefficientInterface::getCurrentForceCoefficients,
                     std::dynamic_pointer_cast< aerodynamics::AtmosphericFlightConditions >(
@@ -949,6 +969,9 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                         bodies, bodyWithProperty, secondaryBody );
         }
 
+        bodies.at( bodyWithProperty )->getFlightConditions( )->addRequiredUpdateComponent(
+                    aerodynamics::aerodynamic_coefficients_update );
+
         variableFunction = std::bind(
                     &aerodynamics::AerodynamicCoefficientInterface::getCurrentMomentCoefficients,
                     std::dynamic_pointer_cast< aerodynamics::AtmosphericFlightConditions >(
@@ -966,6 +989,9 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                     bodies, bodyWithProperty, secondaryBody );
         }
 
+        bodies.at( bodyWithProperty )->getFlightConditions( )->addRequiredUpdateComponent(
+                    aerodynamics::aerodynamic_coefficients_update );
+
         variableFunction = std::bind(
                 &aerodynamics::AerodynamicCoefficientInterface::getCurrentControlSurfaceFreeForceCoefficients,
                 std::dynamic_pointer_cast< aerodynamics::AtmosphericFlightConditions >(
@@ -983,6 +1009,9 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                     bodies, bodyWithProperty, secondaryBody );
         }
 
+        bodies.at( bodyWithProperty )->getFlightConditions( )->addRequiredUpdateComponent(
+                    aerodynamics::aerodynamic_coefficients_update );
+
         variableFunction = std::bind(
                 &aerodynamics::AerodynamicCoefficientInterface::getCurrentControlSurfaceFreeMomentCoefficients,
                 std::dynamic_pointer_cast< aerodynamics::AtmosphericFlightConditions >(
@@ -1009,6 +1038,9 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                         bodies, bodyWithProperty, secondaryBody );
             }
 
+            bodies.at( bodyWithProperty )->getFlightConditions( )->addRequiredUpdateComponent(
+                        aerodynamics::aerodynamic_coefficients_update );
+
             variableFunction = std::bind(
                     &aerodynamics::AerodynamicCoefficientInterface::getCurrentForceCoefficientIncrement,
                     std::dynamic_pointer_cast< aerodynamics::AtmosphericFlightConditions >(
@@ -1036,6 +1068,9 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                         bodies, bodyWithProperty, secondaryBody );
             }
 
+            bodies.at( bodyWithProperty )->getFlightConditions( )->addRequiredUpdateComponent(
+                        aerodynamics::aerodynamic_coefficients_update );
+
             variableFunction = std::bind(
                     &aerodynamics::AerodynamicCoefficientInterface::getCurrentMomentCoefficientIncrement,
                     std::dynamic_pointer_cast< aerodynamics::AtmosphericFlightConditions >(
@@ -1072,6 +1107,9 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
             throw std::runtime_error( errorMessage );
         }
 
+        bodies.at( bodyWithProperty )->getFlightConditions( )->addRequiredUpdateComponent(
+                    aerodynamics::body_orientation_angles_update );
+
         std::function< Eigen::Quaterniond( ) > rotationFunction =
                 std::bind( &reference_frames::AerodynamicAngleCalculator::getRotationQuaternionBetweenFrames,
                            bodies.at( bodyWithProperty )->getFlightConditions( )->getAerodynamicAngleCalculator( ),
@@ -1618,6 +1656,76 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
     return std::make_pair( variableFunction, parameterSize );
 }
 
+//! Function to create a function returning a requested 3-dimensional dependent variable value (of type Vector3d).
+/*!
+ *  Function to create a function returning a requested 3-dimensional dependent variable value, as a fixed-size vector (so
+ *  that no memory is allocated when evaluating it). This function is only implemented for a subset of the dependent
+ *  variable types (relative position/velocity, total and single acceleration); for other types, an empty function is
+ *  returned, and the function from getVectorDependentVariableFunction is to be used instead.
+ *  \param dependentVariableSettings Settings for dependent variable that is to be returned by function created here.
+ *  \param bodies List of bodies to use in simulations (containing full environment).
+ *  \param stateDerivativeModels List of state derivative models used in simulations (sorted by dynamics type as key).
+ *  \return Function returning requested dependent variable (empty if not implemented for the dependent variable type).
+ *  NOTE: The environment and state derivative models need to be updated to current state and independent variable before
+ *  computation is performed.
+ */
+template< typename TimeType = double, typename StateScalarType = double >
+std::function< Eigen::Vector3d( ) > getThreeDimensionalDependentVariableFunction(
+        const std::shared_ptr< SingleDependentVariableSaveSettings > dependentVariableSettings,
+        const simulation_setup::SystemOfBodies& bodies,
+        const std::unordered_map< IntegratedStateType,
+        std::vector< std::shared_ptr< SingleStateTypeDerivative< StateScalarType, TimeType > > > >& stateDerivativeModels )
+{
+    std::function< Eigen::Vector3d( ) > variableFunction;
+
+    const std::string& bodyWithProperty = dependentVariableSettings->associatedBody_;
+    const std::string& secondaryBody = dependentVariableSettings->secondaryBody_;
+
+    switch( dependentVariableSettings->dependentVariableType_ )
+    {
+    case relative_position_dependent_variable:
+    case relative_velocity_dependent_variable:
+    {
+        if( secondaryBody == "SSB" )
+        {
+            break;
+        }
+
+        std::shared_ptr< simulation_setup::Body > firstBody = bodies.at( bodyWithProperty );
+        std::shared_ptr< simulation_setup::Body > secondBody = bodies.at( secondaryBody );
+        if( dependentVariableSettings->dependentVariableType_ == relative_position_dependent_variable )
+        {
+            variableFunction = [ = ]( ){ return Eigen::Vector3d( firstBody->getPosition( ) - secondBody->getPosition( ) ); };
+        }
+        else
+        {
+            variableFunction = [ = ]( ){ return Eigen::Vector3d( firstBody->getVelocity( ) - secondBody->getVelocity( ) ); };
+        }
+        break;
+    }
+    case total_acceleration_dependent_variable:
+    {
+        std::shared_ptr< NBodyStateDerivative< StateScalarType, TimeType > > nBodyModel =
+                getTranslationalStateDerivativeModelForBody( bodyWithProperty, stateDerivativeModels );
+        nBodyModel->setUpdateRemovedAcceleration( bodyWithProperty );
+        variableFunction = std::bind( &NBodyStateDerivative< StateScalarType, TimeType >::getTotalAccelerationForBody,
+                                      nBodyModel, bodyWithProperty );
+        break;
+    }
+    case single_acceleration_dependent_variable:
+    {
+        std::shared_ptr< basic_astrodynamics::AccelerationModel3d > accelerationModel =
+                getAccelerationModelForDependentVariable( dependentVariableSettings, stateDerivativeModels );
+        variableFunction = [ = ]( ){ return accelerationModel->getAcceleration( ); };
+        break;
+    }
+    default:
+        break;
+    }
+
+    return variableFunction;
+}
+
 //! Acces element at index function
 /*!
  * Acces element at index function
@@ -1949,6 +2057,14 @@ std::function< double( ) > getDoubleDependentVariableFunction(
                 throw std::runtime_error( errorMessage );
             }
 
+            if( bodyAerodynamicAngleVariableSaveSettings->angle_ == reference_frames::angle_of_attack ||
+                    bodyAerodynamicAngleVariableSaveSettings->angle_ == reference_frames::angle_of_sideslip ||
+                    bodyAerodynamicAngleVariableSaveSettings->angle_ == reference_frames::bank_angle )
+            {
+                bodies.at( bodyWithProperty )->getFlightConditions( )->addRequiredUpdateComponent(
+                            aerodynamics::body_orientation_angles_update );
+            }
+
             variableFunction = std::bind( &reference_frames::AerodynamicAngleCalculator::getAerodynamicAngle,
                                           bodies.at( bodyWithProperty )->getFlightConditions( )->getAerodynamicAngleCalculator( ),
                                           bodyAerodynamicAngleVariableSaveSettings->angle_ );
@@ -2484,6 +2600,33 @@ std::function< double( ) > getDoubleDependentVariableFunction(
 
             break;
         }
+        case spherical_harmonic_evaluated_maximum_degree_dependent_variable:
+        {
+            // Retrieve spherical harmonic acceleration (for a third-body acceleration, the degree used for the direct
+            // acceleration on the body undergoing the acceleration is returned)
+            std::shared_ptr< basic_astrodynamics::AccelerationModel3d > sphericalHarmonicAcceleration =
+                    getSphericalHarmonicAccelerationForDependentVariables(
+                        dependentVariableSettings, stateDerivativeModels, true );
+
+            std::shared_ptr< gravitation::SphericalHarmonicsGravitationalAccelerationModel > directSphericalHarmonicAcceleration =
+                    std::dynamic_pointer_cast< gravitation::SphericalHarmonicsGravitationalAccelerationModel >(
+                        sphericalHarmonicAcceleration );
+            if( std::dynamic_pointer_cast< gravitation::ThirdBodySphericalHarmonicsGravitationalAccelerationModel >(
+                         sphericalHarmonicAcceleration ) != nullptr )
+            {
+                directSphericalHarmonicAcceleration =
+                        std::dynamic_pointer_cast< gravitation::ThirdBodySphericalHarmonicsGravitationalAccelerationModel >(
+                            sphericalHarmonicAcceleration )->getAccelerationModelForBodyUndergoingAcceleration( );
+            }
+
+            if( directSphericalHarmonicAcceleration == nullptr )
+            {
+                throw std::runtime_error( "Error when getting spherical_harmonic_evaluated_maximum_degree_dependent_variable, did not recognize acceleration model." );
+            }
+            variableFunction = [=]( ){ return static_cast< double >(
+                            directSphericalHarmonicAcceleration->getCurrentMaximumDegree( ) ); };
+            break;
+        }
         case custom_dependent_variable:
         {
             std::shared_ptr< CustomDependentVariableSaveSettings > customVariableSettings =
@@ -2536,80 +2679,115 @@ Eigen::VectorXd getVectorFromDoubleFunction( const std::function< double( ) >& d
  * \return Concatenated results from input functions.
  */
 Eigen::VectorXd evaluateListOfVectorFunctions(
-        const std::vector< std::pair< std::function< Eigen::VectorXd( ) >, int > > vectorFunctionList,
+        const std::vector< std::pair< std::function< Eigen::VectorXd( ) >, int > >& vectorFunctionList,
         const int totalSize );
 
-//! Function to create a function that evaluates a list of dependent variables and concatenates the results.
+//! Function to create an object that evaluates a list of dependent variables directly into a preallocated vector
 /*!
- *  Function to create a function that evaluates a list of dependent variables and concatenates the results.
- *  Dependent variables functions are created inside this function from a list of settings on their required
- *  types/properties.
- *  \param saveSettings Object containing types and other properties of dependent variables.
+ *  Function to create an object that evaluates a list of dependent variables directly into a preallocated vector (such as
+ *  a row of a contiguous results history), with each variable written at its index in the full list of dependent
+ *  variables. Scalar variables, and the 3-dimensional variables for which getThreeDimensionalDependentVariableFunction is
+ *  implemented, are evaluated without allocating memory. Dependent variables functions are created inside this function
+ *  from a list of settings on their required types/properties.
+ *  \param dependentVariables Settings for the dependent variables, in the order in which they are to be saved
  *  \param bodies List of bodies to use in simulations (containing full environment).
+ *  \param orderedDependentVariables Settings for the dependent variables, with their start index and size as key
+ *  (returned by reference)
+ *  \param dependentVariableIds Ids of the dependent variables, with their start index and size as key (returned by
+ *  reference)
  *  \param stateDerivativeModels List of state derivative models used in simulations (sorted by dynamics type as key)
- *  \return Pair with function returning requested dependent variable values, and list variable names with start entries.
- *  NOTE: The environment and state derivative models need to
- *  be updated to current state and independent variable before computation is performed.
+ *  \param stateDerivativePartials List of state derivative partials used in simulations (sorted by dynamics type as key).
+ *  \return Object that writes the requested dependent variables into a preallocated vector. NOTE: The environment and
+ *  state derivative models need to be updated to current state and independent variable before computation is performed.
  */
 template< typename TimeType = double, typename StateScalarType = double >
-std::pair< std::function< Eigen::VectorXd( ) >, std::map< std::pair< int, int >, std::string > > createDependentVariableListFunction(
+std::shared_ptr< DependentVariablesWriter > createDependentVariablesWriter(
         const std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables,
         const simulation_setup::SystemOfBodies& bodies,
         std::map< std::pair< int, int >, std::shared_ptr< SingleDependentVariableSaveSettings > >& orderedDependentVariables,
+        std::map< std::pair< int, int >, std::string >& dependentVariableIds,
         const std::unordered_map< IntegratedStateType,
         std::vector< std::shared_ptr< SingleStateTypeDerivative< StateScalarType, TimeType > > > >& stateDerivativeModels,
         const std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap >& stateDerivativePartials =
         std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap >( ) )
 {
-    // create list of vector parameters
-    std::vector< std::pair< std::function< Eigen::VectorXd( ) >, int > > vectorFunctionList;
-    std::vector< std::pair< std::string, int > > vectorVariableList;
+    std::shared_ptr< DependentVariablesWriter > dependentVariablesWriter = std::make_shared< DependentVariablesWriter >( );
+    dependentVariableIds.clear( );
 
     for( std::shared_ptr< SingleDependentVariableSaveSettings > variable: dependentVariables )
     {
-        std::pair< std::function< Eigen::VectorXd( ) >, int > vectorFunction;
+        int startIndex = dependentVariablesWriter->getTotalSize( );
+
         // Create double parameter
         if( isScalarDependentVariable( variable ) )
         {
 #if(TUDAT_BUILD_WITH_ESTIMATION_TOOLS )
-            std::function< double( ) > doubleFunction =
-                    getDoubleDependentVariableFunction( variable, bodies, stateDerivativeModels, stateDerivativePartials );
+            dependentVariablesWriter->addScalarVariable(
+                        getDoubleDependentVariableFunction( variable, bodies, stateDerivativeModels, stateDerivativePartials ) );
 #else
-            std::function< double( ) > doubleFunction =
-                    getDoubleDependentVariableFunction( variable, bodies, stateDerivativeModels );
+            dependentVariablesWriter->addScalarVariable(
+                        getDoubleDependentVariableFunction( variable, bodies, stateDerivativeModels ) );
 #endif
-            vectorFunction = std::make_pair( std::bind( &getVectorFromDoubleFunction, doubleFunction ), 1 );
         }
-        // Create vector parameter
+        // Create vector parameter, using fixed-size vector if possible
         else
         {
+            std::function< Eigen::Vector3d( ) > threeDimensionalFunction =
+                    getThreeDimensionalDependentVariableFunction( variable, bodies, stateDerivativeModels );
+            if( threeDimensionalFunction != nullptr )
+            {
+                dependentVariablesWriter->addThreeDimensionalVariable( threeDimensionalFunction );
+            }
+            else
+            {
 #if(TUDAT_BUILD_WITH_ESTIMATION_TOOLS )
-            vectorFunction = getVectorDependentVariableFunction(
-                        variable, bodies, stateDerivativeModels, stateDerivativePartials );
+                std::pair< std::function< Eigen::VectorXd( ) >, int > vectorFunction = getVectorDependentVariableFunction(
+                            variable, bodies, stateDerivativeModels, stateDerivativePartials );
 #else
-            vectorFunction =
-                    getVectorDependentVariableFunction( variable, bodies, stateDerivativeModels );
+                std::pair< std::function< Eigen::VectorXd( ) >, int > vectorFunction =
+                        getVectorDependentVariableFunction( variable, bodies, stateDerivativeModels );
 #endif
+                dependentVariablesWriter->addVectorVariable( vectorFunction.first, vectorFunction.second );
+            }
         }
-        vectorFunctionList.push_back( vectorFunction );
-        vectorVariableList.push_back( std::make_pair( getDependentVariableId( variable ), vectorFunction.second ) );
+
+        // Set variable id/index
+        int variableSize = dependentVariablesWriter->getTotalSize( ) - startIndex;
+        dependentVariableIds[ { startIndex, variableSize } ] = getDependentVariableId( variable );
+        orderedDependentVariables[ { startIndex, variableSize } ] = variable;
     }
 
-    // Set list of variable ids/indices in correc otder.
-    int totalVariableSize = 0;
-    std::map< std::pair< int, int >, std::string > dependentVariableIds;
+    return dependentVariablesWriter;
+}
 
-    int variableCounter = 0;
-    for( std::pair< std::string, int > vectorVariable: vectorVariableList )
-    {
-        dependentVariableIds[ { totalVariableSize, vectorVariable.second } ] = vectorVariable.first;
-        orderedDependentVariables[ { totalVariableSize, vectorVariable.second } ] = dependentVariables.at( variableCounter );
-        variableCounter++;
-        totalVariableSize += vectorVariable.second;
-    }
+//! Function to create a function that evaluates a list of dependent variables and concatenates the results.
+/*!
+ *  Function to create a function that evaluates a list of dependent variables and concatenates the results.
+ *  Dependent variables functions are created inside this function from a list of settings on their required
+ *  types/properties (see createDependentVariablesWriter).
+ *  \param saveSettings Object containing types and other properties of dependent variables.
+ *  \param bodies List of bodies to use in simulations (containing full environment).
+ *  \param stateDerivativeModels List of state derivative models used in simulations (sorted by dynamics type as key)
+ *  \return Pair with function returning requested dependent variable values, and list variable names with start entries.
+ *  NOTE: The environment and state derivative models need to
+ *  be updated to current state and independent variable before computation is performed.
+ */
+template< typename TimeType = double, typename StateScalarType = double >
+std::pair< std::function< Eigen::VectorXd( ) >, std::map< std::pair< int, int >, std::string > > createDependentVariableListFunction(
+        const std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables,
+        const simulation_setup::SystemOfBodies& bodies,
+        std::map< std::pair< int, int >, std::shared_ptr< SingleDependentVariableSaveSettings > >& orderedDependentVariables,
+        const std::unordered_map< IntegratedStateType,
+        std::vector< std::shared_ptr< SingleStateTypeDerivative< StateScalarType, TimeType > > > >& stateDerivativeModels,
+        const std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap >& stateDerivativePartials =
+        std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap >( ) )
+{
+    std::map< std::pair< int, int >, std::string > dependentVariableIds;
+    std::shared_ptr< DependentVariablesWriter > dependentVariablesWriter = createDependentVariablesWriter(
+                dependentVariables, bodies, orderedDependentVariables, dependentVariableIds,
+                stateDerivativeModels, stateDerivativePartials );
 
-    // Create function conatenating function results.
-    return std::make_pair( std::bind( &evaluateListOfVectorFunctions, vectorFunctionList, totalVariableSize ),
+    return std::make_pair( std::bind( &DependentVariablesWriter::evaluateDependentVariables, dependentVariablesWriter ),
                            dependentVariableIds );
 }
 
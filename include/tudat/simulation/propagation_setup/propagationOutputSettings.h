@@ -136,7 +136,8 @@ enum PropagationDependentVariables
     received_irradiance = 63,
     received_fraction = 64,
     visible_and_emitting_source_panel_count = 65,
-    visible_source_area = 66
+    visible_source_area = 66,
+    spherical_harmonic_evaluated_maximum_degree_dependent_variable = 67
 };
 
 // Functional base class for defining settings for dependent variables that are to be saved during propagation
@@ -1388,6 +1389,15 @@ inline std::shared_ptr< SingleDependentVariableSaveSettings > visibleSourceAreaD
             visible_source_area, targetBody, sourceBody);
 }
 
+inline std::shared_ptr< SingleDependentVariableSaveSettings > sphericalHarmonicEvaluatedMaximumDegreeDependentVariable(
+        const std::string& bodyUndergoingAcceleration,
+        const std::string& bodyExertingAcceleration )
+{
+    return std::make_shared< SingleDependentVariableSaveSettings >(
+            spherical_harmonic_evaluated_maximum_degree_dependent_variable,
+            bodyUndergoingAcceleration, bodyExertingAcceleration );
+}
+
 } // namespace propagators
 
 } // namespace tudat
@@ -39,7 +39,7 @@ public:
             const bool printPropagatedStateData = false,
             const bool printInitialAndFinalConditions = false,
             const bool printDependentVariableDuringPropagation = false,
-            const bool printProcessedStateData = false ): printArcIndex_( false )
+            const bool printProcessedStateData = false ): printEphemerisStateCacheStatistics_( false ), printArcIndex_( false )
     {
         reset( printNumberOfFunctionEvaluations,
                printDependentVariableData, resultsPrintFrequencyInSeconds, resultsPrintFrequencyInSteps,
@@ -107,6 +107,12 @@ public:
     { printDependentVariableDuringPropagation_ = printDependentVariableDuringPropagation; }
 
 
+    bool getPrintEphemerisStateCacheStatistics( ){ return printEphemerisStateCacheStatistics_; }
+
+    void setPrintEphemerisStateCacheStatistics( const bool printEphemerisStateCacheStatistics )
+    { printEphemerisStateCacheStatistics_ = printEphemerisStateCacheStatistics; }
+
+
     bool printCurrentStep(
             const int stepsSinceLastPrint, const double timeSinceLastPrint )
     {
@@ -136,7 +142,8 @@ public:
     // Check if any output is to be printed before propagation
     bool printPostPropagation( )
     {
-        return ( printNumberOfFunctionEvaluations_ || printTerminationReason_ || printPropagationTime_ || printInitialAndFinalConditions_ || printProcessedStateData_ );
+        return ( printNumberOfFunctionEvaluations_ || printTerminationReason_ || printPropagationTime_ || printInitialAndFinalConditions_ || printProcessedStateData_ ||
+                 printEphemerisStateCacheStatistics_ );
     }
 
     // Check if any output is to be printed during propagation
@@ -193,6 +200,7 @@ public:
         printPropagatedStateData_ = printSettings->getPrintPropagatedStateData( );
         printInitialAndFinalConditions_ = printSettings->getPrintInitialAndFinalConditions( );
         printProcessedStateData_ = printSettings->getPrintProcessedStateData( );
+        printEphemerisStateCacheStatistics_ = printSettings->getPrintEphemerisStateCacheStatistics( );
 
     }
 
@@ -200,6 +208,7 @@ public:
     void disableAllPrinting( )
     {
         reset( false, false, TUDAT_NAN, 0, false, false, false, false, false, false );
+        printEphemerisStateCacheStatistics_ = false;
     }
 
     // Print everything, but keep print interval during propagation the same
@@ -226,6 +235,7 @@ private:
     bool printInitialAndFinalConditions_;
     bool printDependentVariableDuringPropagation_;
     bool printProcessedStateData_;
+    bool printEphemerisStateCacheStatistics_;
 
     bool printArcIndex_;
 
@@ -11,6 +11,7 @@
 #ifndef TUDAT_PROPAGATIONPROCESSINGSETTINGS_H
 #define TUDAT_PROPAGATIONPROCESSINGSETTINGS_H
 
+#include <cmath>
 #include <vector>
 #include <string>
 #include <map>
@@ -20,6 +21,7 @@
 #include <Eigen/Core>
 
 #include "tudat/simulation/propagation_setup/propagationPrintSettings.h"
+#include "tudat/simulation/propagation_setup/propagationResultSinks.h"
 
 namespace tudat
 {
@@ -89,6 +91,58 @@ protected:
     bool updateDependentVariableInterpolator_;
 };
 
+//! Class defining settings for fitting the ephemerides of perturbing bodies before a propagation (see
+//! SingleArcPropagatorProcessingSettings::setPerturbingBodyEphemerisInterpolationSettings).
+class PerturbingBodyEphemerisInterpolationSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param positionTolerance Maximum permitted position error of the fit w.r.t. the original ephemerides
+     *  \param velocityTolerance Maximum permitted velocity error of the fit w.r.t. the original ephemerides
+     *  \param polynomialDegree Degree of the Chebyshev series of each state component in each segment
+     *  \param minimumSegmentDuration Minimum duration of a Chebyshev segment
+     *  \param timeBuffer Time by which the fitted interval is extended beyond the propagation interval on either side
+     *  \param bodiesToExclude Names of bodies of which the ephemeris is not to be fitted
+     *  \param finalTime Final time of the propagation interval, required if it can not be determined from the
+     *  termination settings (i.e. if these contain no time termination condition)
+     */
+    PerturbingBodyEphemerisInterpolationSettings(
+            const double positionTolerance = 1.0E-3,
+            const double velocityTolerance = 1.0E-6,
+            const int polynomialDegree = 12,
+            const double minimumSegmentDuration = 60.0,
+            const double timeBuffer = 3600.0,
+            const std::vector< std::string >& bodiesToExclude = std::vector< std::string >( ),
+            const double finalTime = TUDAT_NAN ):
+        positionTolerance_( positionTolerance ), velocityTolerance_( velocityTolerance ),
+        polynomialDegree_( polynomialDegree ), minimumSegmentDuration_( minimumSegmentDuration ),
+        timeBuffer_( timeBuffer ), bodiesToExclude_( bodiesToExclude ), finalTime_( finalTime ){ }
+
+    //! Maximum permitted position error of the fit w.r.t. the original ephemerides
+    double positionTolerance_;
+
+    //! Maximum permitted velocity error of the fit w.r.t. the original ephemerides
+    double velocityTolerance_;
+
+    //! Degree of the Chebyshev series of each state component in each segment
+    int polynomialDegree_;
+
+    //! Minimum duration of a Chebyshev segment
+    double minimumSegmentDuration_;
+
+    //! Time by which the fitted interval is extended beyond the propagation interval on either side
+    double timeBuffer_;
+
+    //! Names of bodies of which the ephemeris is not to be fitted
+    std::vector< std::string > bodiesToExclude_;
+
+    //! Final time of the propagation interval (NaN if it is to be determined from the termination settings)
+    double finalTime_;
+};
+
 //! Base class for defining output and processing settings for single-arc propagation.
 //! In addition to implementing base class functionality, it defines the output
 //! that is to b printed to a terminal during a single-arc propagation (in the printSettings_ member)
@@ -136,6 +190,30 @@ public:
         return resultsSaveFrequencyInSeconds_;
     }
 
+    //! Function to set a fixed interval at which the results are saved, using the dense output of the integrator
+    /*!
+     *  Function to set a fixed interval at which the results are saved. The states are then saved exactly at the epochs
+     *  initialTime + i * fixedResultsSaveInterval (and at the final epoch) using the dense output of the integrator (which
+     *  is enabled automatically, and requires a variable step Runge-Kutta integrator), independently of the integration
+     *  steps. Dependent variables (and the environment updates they require) are only computed at these epochs. This
+     *  setting overrides the save frequency in steps and seconds.
+     *  \param fixedResultsSaveInterval Interval at which the results are saved (NaN to save at integration steps)
+     */
+    void setFixedResultsSaveInterval( const double fixedResultsSaveInterval )
+    {
+        if( !( fixedResultsSaveInterval > 0.0 ) && !std::isnan( fixedResultsSaveInterval ) )
+        {
+            throw std::runtime_error( "Error when setting fixed interval for saving propagation results, interval must be "
+                                      "positive" );
+        }
+        fixedResultsSaveInterval_ = fixedResultsSaveInterval;
+    }
+
+    double getFixedResultsSaveInterval( )
+    {
+        return fixedResultsSaveInterval_;
+    }
+
     bool saveCurrentStep(
             const int stepsSinceLastSave, const double timeSinceLastSave )
     {
@@ -151,6 +229,182 @@ public:
         return saveCurrentStep;
     }
 
+    //! Function to set whether the numerical results are stored in contiguous memory (see ContiguousTimeHistory)
+    /*!
+     *  Function to set whether the numerical results are stored in contiguous memory (see ContiguousTimeHistory), instead of
+     *  in maps with time as key. The dependent variables are then written directly into contiguous storage during the
+     *  propagation, and the (processed) state histories after the propagation. The map-based results are still
+     *  available through the results object, but are only created when requested.
+     *  \param useContiguousResultStorage Boolean denoting whether the numerical results are stored in contiguous memory
+     */
+    void setUseContiguousResultStorage( const bool useContiguousResultStorage )
+    {
+        useContiguousResultStorage_ = useContiguousResultStorage;
+    }
+
+    bool getUseContiguousResultStorage( )
+    {
+        return useContiguousResultStorage_;
+    }
+
+    //! Function to set the maximum number of threads over which the conversion of the state history is distributed
+    /*!
+     *  Function to set the maximum number of threads over which the conversion of the propagated state history to the
+     *  conventional (e.g. Cartesian) form is distributed, when propagating in a non-Cartesian formulation (e.g. Kepler,
+     *  modified equinoctial or USM7 elements). Only used when storing the results in contiguous memory (see
+     *  setUseContiguousResultStorage), for which the states are converted in batches after the propagation.
+     *  \param numberOfResultConversionThreads Maximum number of threads over which the conversion is distributed
+     */
+    void setNumberOfResultConversionThreads( const int numberOfResultConversionThreads )
+    {
+        if( numberOfResultConversionThreads < 1 )
+        {
+            throw std::runtime_error( "Error in single-arc output settings, number of result conversion threads must be at "
+                                      "least 1, but is " + std::to_string( numberOfResultConversionThreads ) );
+        }
+        numberOfResultConversionThreads_ = numberOfResultConversionThreads;
+    }
+
+    int getNumberOfResultConversionThreads( )
+    {
+        return numberOfResultConversionThreads_;
+    }
+
+    //! Function to add a sink to which the results at each output epoch are streamed during the propagation
+    /*!
+     *  Function to add a sink to which the results at each output epoch are streamed during the propagation (see
+     *  PropagationResultSink). The results at an output epoch are passed to the sinks once the next output epoch has been
+     *  computed (or the propagation has terminated), since the final epoch may still be modified when propagating to an
+     *  exact termination condition.
+     *  \param resultSink Sink that is to be added
+     */
+    void addResultSink( const std::shared_ptr< PropagationResultSink > resultSink )
+    {
+        if( resultSink == nullptr )
+        {
+            throw std::runtime_error( "Error when adding propagation result sink, no sink provided" );
+        }
+        resultSinks_.push_back( resultSink );
+    }
+
+    void clearResultSinks( )
+    {
+        resultSinks_.clear( );
+    }
+
+    std::vector< std::shared_ptr< PropagationResultSink > > getResultSinks( )
+    {
+        return resultSinks_;
+    }
+
+    //! Function to set whether the full history of the numerical results is to be stored in memory
+    /*!
+     *  Function to set whether the full history of the numerical results is to be stored in memory. If false, only the
+     *  results at the initial and final epoch are stored during the propagation, so that the memory usage is independent
+     *  of the propagation duration (typically used in combination with result sinks, see addResultSink). This setting can
+     *  not be combined with resetting the environment using the propagation results, or updating the dependent variable
+     *  interpolator.
+     *  \param storeResultsInMemory Boolean denoting whether the full history of the numerical results is to be stored in memory
+     */
+    void setStoreResultsInMemory( const bool storeResultsInMemory )
+    {
+        storeResultsInMemory_ = storeResultsInMemory;
+    }
+
+    bool getStoreResultsInMemory( )
+    {
+        return storeResultsInMemory_;
+    }
+
+    //! Function to set whether the wall time and number of calls of the models are profiled during the propagation
+    /*!
+     *  Function to set whether the wall time and number of calls of the models (environment updates, acceleration and torque
+     *  models, and the parts of the state derivative computation) are profiled during the propagation. The resulting
+     *  profile is available from the propagation results (see SingleArcSimulationResults::getModelEvaluationProfile).
+     *  This setting requires Tudat to be compiled with TUDAT_BUILD_WITH_PROPAGATION_PROFILING.
+     *  \param profileModelEvaluations Boolean denoting whether the models are profiled during the propagation
+     */
+    void setProfileModelEvaluations( const bool profileModelEvaluations )
+    {
+        profileModelEvaluations_ = profileModelEvaluations;
+    }
+
+    bool getProfileModelEvaluations( )
+    {
+        return profileModelEvaluations_;
+    }
+
+    //! Function to set the settings for fitting the ephemerides of the perturbing bodies before the propagation
+    /*!
+     *  Function to set the settings for fitting the ephemerides of the perturbing bodies before the propagation. If set,
+     *  the ephemeris of each body that is not propagated (and is not constant or already a Chebyshev ephemeris) is
+     *  replaced by Chebyshev segments fitted to it over the propagation interval (see PreInterpolatedEphemeris) at the
+     *  start of the propagation, and restored at the end. The fits are retained by the dynamics simulator, and reused in
+     *  subsequent propagations over the same interval (e.g. in the iterations of an estimation), as long as the
+     *  ephemeris of the body is not replaced or reset.
+     *  \param ephemerisInterpolationSettings Settings for the fits (none are made if nullptr)
+     */
+    void setPerturbingBodyEphemerisInterpolationSettings(
+            const std::shared_ptr< PerturbingBodyEphemerisInterpolationSettings > ephemerisInterpolationSettings )
+    {
+        ephemerisInterpolationSettings_ = ephemerisInterpolationSettings;
+    }
+
+    std::shared_ptr< PerturbingBodyEphemerisInterpolationSettings > getPerturbingBodyEphemerisInterpolationSettings( )
+    {
+        return ephemerisInterpolationSettings_;
+    }
+
+    //! Function to set the file to which the full state of the propagation is periodically written as a checkpoint
+    /*!
+     *  Function to set the file to which the full state of the propagation (integrator state, state of the propagation
+     *  loop and results accumulated up to the current epoch) is periodically written as a binary checkpoint, from which
+     *  the propagation can be resumed identically (see setResumeFromCheckpointFile). The checkpoint is written at the end
+     *  of an accepted integration step, after the termination conditions are checked, and replaces the previous checkpoint.
+     *  \param checkpointFile Name of the checkpoint file (no checkpoints are written if empty)
+     *  \param numberOfStepsBetweenCheckpoints Number of integration steps between two subsequent checkpoints
+     */
+    void setCheckpointFile( const std::string& checkpointFile, const int numberOfStepsBetweenCheckpoints )
+    {
+        if( numberOfStepsBetweenCheckpoints < 1 )
+        {
+            throw std::runtime_error( "Error when setting propagation checkpoint file, number of steps between checkpoints "
+                                      "must be at least 1" );
+        }
+        checkpointFile_ = checkpointFile;
+        numberOfStepsBetweenCheckpoints_ = numberOfStepsBetweenCheckpoints;
+    }
+
+    std::string getCheckpointFile( )
+    {
+        return checkpointFile_;
+    }
+
+    int getNumberOfStepsBetweenCheckpoints( )
+    {
+        return numberOfStepsBetweenCheckpoints_;
+    }
+
+    //! Function to set the checkpoint file from which the propagation is to be resumed
+    /*!
+     *  Function to set the checkpoint file (see setCheckpointFile) from which the propagation is to be resumed. The
+     *  integration is then continued from the epoch of the checkpoint, with the same integrator state and the results
+     *  accumulated up to the checkpoint, so that the results are identical to those of an uninterrupted propagation with
+     *  the same settings. The termination settings may differ from those of the propagation that wrote the checkpoint
+     *  (e.g. to branch a number of propagations from a common checkpoint). Result sinks only receive the epochs after the
+     *  checkpoint.
+     *  \param resumeFromCheckpointFile Name of the checkpoint file (propagation starts from initial state if empty)
+     */
+    void setResumeFromCheckpointFile( const std::string& resumeFromCheckpointFile )
+    {
+        resumeFromCheckpointFile_ = resumeFromCheckpointFile;
+    }
+
+    std::string getResumeFromCheckpointFile( )
+    {
+        return resumeFromCheckpointFile_;
+    }
+
 
 
     bool printAnyOutput( )
@@ -190,6 +444,8 @@ private:
 
     double resultsSaveFrequencyInSeconds_;
 
+    double fixedResultsSaveInterval_ = TUDAT_NAN;
+
     const std::shared_ptr< PropagationPrintSettings > printSettings_;
 
     void setAsMultiArc( const unsigned int arcIndex, const bool printArcIndex )
@@ -202,6 +458,24 @@ private:
     bool isPartOfMultiArc_;
     int arcIndex_;
 
+    bool useContiguousResultStorage_ = false;
+
+    int numberOfResultConversionThreads_ = 1;
+
+    std::vector< std::shared_ptr< PropagationResultSink > > resultSinks_;
+
+    bool storeResultsInMemory_ = true;
+
+    bool profileModelEvaluations_ = false;
+
+    std::shared_ptr< PerturbingBodyEphemerisInterpolationSettings > ephemerisInterpolationSettings_;
+
+    std::string checkpointFile_;
+
+    int numberOfStepsBetweenCheckpoints_ = 1;
+
+    std::string resumeFromCheckpointFile_;
+
     friend class MultiArcPropagatorProcessingSettings;
 };
 
@@ -369,6 +643,28 @@ public:
         return singleArcSettings_;
     }
 
+    //! Function to set the maximum number of threads over which independent arcs are propagated concurrently
+    /*!
+     * Function to set the maximum number of threads over which independent arcs are propagated concurrently. Arcs can only
+     * be propagated concurrently if they use separate SystemOfBodies objects, and if their initial state is not obtained
+     * from the propagation of the preceding arc (see MultiArcDynamicsSimulator). A value of 1 (default) results in
+     * sequential propagation of the arcs.
+     * \param numberOfThreads Maximum number of threads over which independent arcs are propagated
+     */
+    void setNumberOfThreads( const int numberOfThreads )
+    {
+        if( numberOfThreads < 1 )
+        {
+            throw std::runtime_error( "Error in multi-arc output settings, number of threads must be at least 1, but is " +
+                                      std::to_string( numberOfThreads ) );
+        }
+        numberOfThreads_ = numberOfThreads;
+    }
+
+    int getNumberOfThreads( )
+    {
+        return numberOfThreads_;
+    }
 
 protected:
 
@@ -386,6 +682,8 @@ protected:
 
     bool isPartOfHybridArc_;
 
+    int numberOfThreads_ = 1;
+
 private:
 
 
@@ -0,0 +1,365 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PROPAGATIONRESULTSINKS_H
+#define TUDAT_PROPAGATIONRESULTSINKS_H
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Base class for objects to which the results at each output epoch are streamed during a propagation
+/*!
+ *  Base class for objects (sinks) to which the results at each output epoch are streamed during a single-arc propagation,
+ *  so that the results can be processed (e.g. written to a file) while propagating, without storing the full history in
+ *  memory. Sinks are added to the propagation through SingleArcPropagatorProcessingSettings::addResultSink. For each
+ *  propagation (or propagation leg, for non-sequential propagations), startPropagation is called first, then
+ *  processEpoch for each output epoch (in the order in which they are propagated), and finally finalizePropagation.
+ *  The states that are provided are in the conventional (i.e. not propagator-specific) form.
+ */
+class PropagationResultSink
+{
+public:
+
+    //! Constructor
+    PropagationResultSink( ){ }
+
+    //! Destructor
+    virtual ~PropagationResultSink( ){ }
+
+    //! Function called before the first output epoch of a propagation is processed
+    virtual void startPropagation( ){ }
+
+    //! Function to process the results at a single output epoch
+    /*!
+     *  Function to process the results at a single output epoch
+     *  \param time Output epoch
+     *  \param state Propagated state at output epoch, in conventional form
+     *  \param dependentVariables Dependent variables at output epoch (empty if none are saved)
+     */
+    virtual void processEpoch( const double time, const Eigen::VectorXd& state, const Eigen::VectorXd& dependentVariables ) = 0;
+
+    //! Function called after the last output epoch of a propagation has been processed
+    virtual void finalizePropagation( ){ }
+};
+
+//! Sink that writes the results at each output epoch to a binary file
+/*!
+ *  Sink that writes the results at each output epoch to a binary file. Each epoch is written as a single record, consisting
+ *  of the epoch (double), the state size and dependent variable size (both 32-bit integers), followed by the state and
+ *  dependent variable entries (doubles), all in native byte order. The file is (re)created at the start of each
+ *  propagation, unless the results are to be appended. The file can be read using readPropagationResultsFromBinaryFile.
+ */
+class BinaryFilePropagationResultSink: public PropagationResultSink
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param fileName Name of the file to which the results are to be written
+     *  \param appendToFile Boolean denoting whether results of subsequent propagations are appended to the file (if
+     *  false, the file is overwritten at the start of each propagation).
+     */
+    BinaryFilePropagationResultSink( const std::string& fileName, const bool appendToFile = false ):
+        fileName_( fileName ), appendToFile_( appendToFile ){ }
+
+    //! Destructor
+    ~BinaryFilePropagationResultSink( ){ }
+
+    void startPropagation( );
+
+    void processEpoch( const double time, const Eigen::VectorXd& state, const Eigen::VectorXd& dependentVariables );
+
+    void finalizePropagation( );
+
+    //! Function to retrieve the name of the file to which the results are written
+    std::string getFileName( )
+    {
+        return fileName_;
+    }
+
+private:
+
+    //! Name of the file to which the results are written
+    std::string fileName_;
+
+    //! Boolean denoting whether results of subsequent propagations are appended to the file
+    bool appendToFile_;
+
+    //! Stream to which the results are written
+    std::ofstream outputStream_;
+};
+
+//! Function to read the results of a propagation that were written by a BinaryFilePropagationResultSink
+/*!
+ *  Function to read the results of a propagation that were written by a BinaryFilePropagationResultSink
+ *  \param fileName Name of the file that is to be read
+ *  \param stateHistory History of propagated states (returned by reference)
+ *  \param dependentVariableHistory History of dependent variables (returned by reference; empty if none were saved)
+ */
+void readPropagationResultsFromBinaryFile(
+        const std::string& fileName,
+        std::map< double, Eigen::VectorXd >& stateHistory,
+        std::map< double, Eigen::VectorXd >& dependentVariableHistory );
+
+//! Sink that passes the results at each output epoch to a user-defined function
+class CallbackPropagationResultSink: public PropagationResultSink
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param epochProcessingFunction Function that is called with the results at each output epoch (epoch, state and
+     *  dependent variables as input)
+     */
+    CallbackPropagationResultSink(
+            const std::function< void( const double, const Eigen::VectorXd&, const Eigen::VectorXd& ) > epochProcessingFunction ):
+        epochProcessingFunction_( epochProcessingFunction )
+    {
+        if( epochProcessingFunction == nullptr )
+        {
+            throw std::runtime_error( "Error when creating callback propagation result sink, no function provided" );
+        }
+    }
+
+    //! Destructor
+    ~CallbackPropagationResultSink( ){ }
+
+    void processEpoch( const double time, const Eigen::VectorXd& state, const Eigen::VectorXd& dependentVariables )
+    {
+        epochProcessingFunction_( time, state, dependentVariables );
+    }
+
+private:
+
+    //! Function that is called with the results at each output epoch
+    std::function< void( const double, const Eigen::VectorXd&, const Eigen::VectorXd& ) > epochProcessingFunction_;
+};
+
+//! Sink that retains the results at the last N output epochs of a propagation
+/*!
+ *  Sink that retains the results at the last N output epochs of a propagation, in a fixed-size ring buffer (the memory
+ *  for which is allocated upon processing the first epoch). Older results are overwritten.
+ */
+class RingBufferPropagationResultSink: public PropagationResultSink
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param bufferSize Number of output epochs that are retained
+     */
+    RingBufferPropagationResultSink( const int bufferSize );
+
+    //! Destructor
+    ~RingBufferPropagationResultSink( ){ }
+
+    void startPropagation( );
+
+    void processEpoch( const double time, const Eigen::VectorXd& state, const Eigen::VectorXd& dependentVariables );
+
+    //! Function to retrieve the number of output epochs that are currently retained
+    int getNumberOfStoredEpochs( )
+    {
+        return numberOfStoredEpochs_;
+    }
+
+    //! Function to retrieve the number of output epochs processed since the start of the last propagation
+    int getNumberOfProcessedEpochs( )
+    {
+        return numberOfProcessedEpochs_;
+    }
+
+    //! Function to retrieve the retained states, with time as key
+    std::map< double, Eigen::VectorXd > getStateHistory( );
+
+    //! Function to retrieve the retained dependent variables, with time as key
+    std::map< double, Eigen::VectorXd > getDependentVariableHistory( );
+
+private:
+
+    //! Number of output epochs that are retained
+    int bufferSize_;
+
+    //! Retained output epochs
+    std::vector< double > times_;
+
+    //! Retained states (one column per entry in buffer)
+    Eigen::MatrixXd states_;
+
+    //! Retained dependent variables (one column per entry in buffer)
+    Eigen::MatrixXd dependentVariables_;
+
+    //! Index in buffer at which next epoch is to be stored
+    int nextIndex_;
+
+    //! Number of output epochs that are currently retained
+    int numberOfStoredEpochs_;
+
+    //! Number of output epochs processed since the start of the last propagation
+    int numberOfProcessedEpochs_;
+};
+
+//! Sink that passes the results to another sink on a background thread
+/*!
+ *  Sink that passes the results to another sink on a background thread, so that the (e.g. file output) operations of that
+ *  sink overlap with the propagation. The results are passed through a queue of bounded size; if the queue is full,
+ *  the propagation waits until the background thread has processed an entry, so that the memory usage is bounded. The
+ *  finalizePropagation function waits until all results have been processed. Exceptions thrown by the sink on the
+ *  background thread are rethrown by the next call to processEpoch or finalizePropagation.
+ */
+class AsynchronousPropagationResultSink: public PropagationResultSink
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param processingSink Sink that is to be called on the background thread
+     *  \param maximumQueueSize Maximum number of output epochs that are waiting to be processed
+     */
+    AsynchronousPropagationResultSink(
+            const std::shared_ptr< PropagationResultSink > processingSink,
+            const int maximumQueueSize = 1024 );
+
+    //! Destructor, waits for all queued results to be processed, and stops the background thread
+    ~AsynchronousPropagationResultSink( );
+
+    void startPropagation( );
+
+    void processEpoch( const double time, const Eigen::VectorXd& state, const Eigen::VectorXd& dependentVariables );
+
+    void finalizePropagation( );
+
+    //! Function to retrieve the sink that is called on the background thread
+    std::shared_ptr< PropagationResultSink > getProcessingSink( )
+    {
+        return processingSink_;
+    }
+
+private:
+
+    //! Type of task that is queued for the background thread
+    enum QueuedTaskType
+    {
+        start_propagation_task,
+        process_epoch_task,
+        finalize_propagation_task
+    };
+
+    //! Task that is queued for the background thread
+    struct QueuedTask
+    {
+        QueuedTaskType taskType;
+        double time;
+        Eigen::VectorXd state;
+        Eigen::VectorXd dependentVariables;
+    };
+
+    //! Function to add a task to the queue, waiting if the queue is full
+    void addTaskToQueue( QueuedTask&& task );
+
+    //! Function to wait until all queued tasks have been processed
+    void waitForEmptyQueue( );
+
+    //! Function to rethrow exception caught on background thread, if any
+    void rethrowCaughtException( );
+
+    //! Function run by the background thread
+    void processQueuedTasks( );
+
+    //! Sink that is called on the background thread
+    std::shared_ptr< PropagationResultSink > processingSink_;
+
+    //! Maximum number of tasks that are waiting to be processed
+    unsigned int maximumQueueSize_;
+
+    //! Tasks that are waiting to be processed
+    std::deque< QueuedTask > taskQueue_;
+
+    //! Boolean denoting whether the background thread is executing a task
+    bool isTaskInProgress_;
+
+    //! Boolean denoting whether the background thread is to stop
+    bool stopProcessing_;
+
+    //! Exception thrown by the sink on the background thread (nullptr if none)
+    std::exception_ptr caughtException_;
+
+    //! Mutex for access to queue and associated variables
+    std::mutex queueMutex_;
+
+    //! Condition variable signalling change in queue
+    std::condition_variable queueCondition_;
+
+    //! Background thread
+    std::thread processingThread_;
+};
+
+//! Function to create a sink that writes the propagation results to a binary file
+/*!
+ *  Function to create a sink that writes the propagation results to a binary file (see BinaryFilePropagationResultSink)
+ *  \param fileName Name of the file to which the results are to be written
+ *  \param writeInBackground Boolean denoting whether the file is to be written on a background thread
+ *  \param appendToFile Boolean denoting whether results of subsequent propagations are appended to the file
+ *  \return Sink that writes the propagation results to a binary file
+ */
+inline std::shared_ptr< PropagationResultSink > binaryFileResultSink(
+        const std::string& fileName,
+        const bool writeInBackground = true,
+        const bool appendToFile = false )
+{
+    std::shared_ptr< PropagationResultSink > fileSink =
+            std::make_shared< BinaryFilePropagationResultSink >( fileName, appendToFile );
+    if( writeInBackground )
+    {
+        fileSink = std::make_shared< AsynchronousPropagationResultSink >( fileSink );
+    }
+    return fileSink;
+}
+
+//! Function to create a sink that passes the propagation results to a user-defined function
+inline std::shared_ptr< PropagationResultSink > callbackResultSink(
+        const std::function< void( const double, const Eigen::VectorXd&, const Eigen::VectorXd& ) > epochProcessingFunction )
+{
+    return std::make_shared< CallbackPropagationResultSink >( epochProcessingFunction );
+}
+
+//! Function to create a sink that retains the propagation results at the last N output epochs
+inline std::shared_ptr< RingBufferPropagationResultSink > ringBufferResultSink( const int bufferSize )
+{
+    return std::make_shared< RingBufferPropagationResultSink >( bufferSize );
+}
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_PROPAGATIONRESULTSINKS_H
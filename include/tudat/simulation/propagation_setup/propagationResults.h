@@ -5,9 +5,14 @@
 #ifndef TUDAT_PROPAGATIONRESULTS_H
 #define TUDAT_PROPAGATIONRESULTS_H
 
+#include <algorithm>
+#include <cmath>
 #include <map>
 #include <string>
 
+#include "tudat/basics/contiguousTimeHistory.h"
+#include "tudat/basics/memoryFootprint.h"
+#include "tudat/basics/modelEvaluationProfiler.h"
 #include "tudat/simulation/propagation_setup/propagationProcessingSettings.h"
 #include "tudat/simulation/propagation_setup/propagationTermination.h"
 #include "tudat/simulation/propagation_setup/dependentVariablesInterface.h"
@@ -46,9 +51,63 @@ namespace tudat
 
             virtual std::shared_ptr< DependentVariablesInterface< TimeType > > getDependentVariablesInterface( ) = 0;
 
+            //! Function to retrieve the (heap) memory held by the numerical results, per type of result
+            virtual utilities::MemoryFootprint getMemoryFootprint( ) const = 0;
+
         };
 
 
+        //! Statistics of the integration steps taken during a single-arc propagation
+        struct PropagationStepStatistics
+        {
+            //! Number of integration steps that were accepted (excluding steps to reach an exact termination condition)
+            int numberOfAcceptedSteps_ = 0;
+
+            //! Number of integration steps that were rejected by the step-size control (and redone with smaller step)
+            int numberOfRejectedSteps_ = 0;
+
+            //! Total number of evaluations of the state derivative function
+            unsigned int numberOfFunctionEvaluations_ = 0;
+
+            //! Smallest (absolute) accepted step size (NaN if no step was taken)
+            double minimumStepSize_ = TUDAT_NAN;
+
+            //! Largest (absolute) accepted step size (NaN if no step was taken)
+            double maximumStepSize_ = TUDAT_NAN;
+
+            //! Function to add an accepted step of the given size to the statistics
+            void addAcceptedStep( const double stepSize )
+            {
+                const double absoluteStepSize = std::fabs( stepSize );
+                if( numberOfAcceptedSteps_ == 0 )
+                {
+                    minimumStepSize_ = absoluteStepSize;
+                    maximumStepSize_ = absoluteStepSize;
+                }
+                else
+                {
+                    minimumStepSize_ = std::min( minimumStepSize_, absoluteStepSize );
+                    maximumStepSize_ = std::max( maximumStepSize_, absoluteStepSize );
+                }
+                numberOfAcceptedSteps_++;
+            }
+
+            //! Function to add the statistics of another (e.g. preceding) part of the propagation to these statistics
+            void addStatistics( const PropagationStepStatistics& statisticsToAdd )
+            {
+                if( statisticsToAdd.numberOfAcceptedSteps_ > 0 )
+                {
+                    minimumStepSize_ = ( numberOfAcceptedSteps_ == 0 ) ? statisticsToAdd.minimumStepSize_ :
+                                                                       std::min( minimumStepSize_, statisticsToAdd.minimumStepSize_ );
+                    maximumStepSize_ = ( numberOfAcceptedSteps_ == 0 ) ? statisticsToAdd.maximumStepSize_ :
+                                                                       std::max( maximumStepSize_, statisticsToAdd.maximumStepSize_ );
+                }
+                numberOfAcceptedSteps_ += statisticsToAdd.numberOfAcceptedSteps_;
+                numberOfRejectedSteps_ += statisticsToAdd.numberOfRejectedSteps_;
+                numberOfFunctionEvaluations_ += statisticsToAdd.numberOfFunctionEvaluations_;
+            }
+        };
+
         template<typename StateScalarType, typename TimeType>
         class SingleArcDynamicsSimulator;
 
@@ -76,7 +135,10 @@ namespace tudat
                                        const std::function< void ( std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >&,
                                                                    const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& ) > rawSolutionConversionFunction,
                                        const std::shared_ptr< SingleArcDependentVariablesInterface< TimeType > > dependentVariableInterface,
-                                       const bool sequentialPropagation = true ) :
+                                       const bool sequentialPropagation = true,
+                                       const std::function< void ( utilities::ContiguousTimeHistory< TimeType, StateScalarType >&,
+                                                                   const utilities::ContiguousTimeHistory< TimeType, StateScalarType >& ) >
+                                       contiguousRawSolutionConversionFunction = nullptr ) :
                     SimulationResults<StateScalarType, TimeType>(),
                     processedStateIds_(getProcessedStateStrings( integratedStateAndBodyList ) ),
                     propagatedStateIds_( getPropagatedStateStrings( integratedStateAndBodyList ) ),
@@ -85,6 +147,7 @@ namespace tudat
                     dependentVariableInterface_( dependentVariableInterface ),
                     sequentialPropagation_( sequentialPropagation ),
                     rawSolutionConversionFunction_( rawSolutionConversionFunction ),
+                    contiguousRawSolutionConversionFunction_( contiguousRawSolutionConversionFunction ),
                     propagationIsPerformed_(false),
                     solutionIsCleared_( false ),
                     onlyProcessedSolutionSet_( false ),
@@ -100,14 +163,18 @@ namespace tudat
                 propagationIsPerformed_ = false;
                 solutionIsCleared_ = false;
                 onlyProcessedSolutionSet_ = false;
+                modelEvaluationProfile_ = nullptr;
+                stepStatistics_ = PropagationStepStatistics( );
                 propagationTerminationReason_ = std::make_shared<PropagationTerminationDetails>(propagation_never_run);
             }
             
             void manuallySetSecondaryData( const std::shared_ptr< SingleArcSimulationResults< StateScalarType, TimeType > > resultsToCopy )
             {
+                releaseContiguousSolution( );
                 dependentVariableHistory_ = resultsToCopy->getDependentVariableHistory( );
                 cumulativeComputationTimeHistory_ =  resultsToCopy->getCumulativeComputationTimeHistory( );
                 cumulativeNumberOfFunctionEvaluations_ =  resultsToCopy->getCumulativeNumberOfFunctionEvaluations( );
+                stepStatistics_ = resultsToCopy->getStepStatistics( );
                 propagationTerminationReason_ = resultsToCopy->getPropagationTerminationReason( );
                 propagationIsPerformed_ = true;
             }
@@ -120,6 +187,14 @@ namespace tudat
                     const std::map<TimeType, unsigned int>& cumulativeNumberOfFunctionEvaluations,
                     std::shared_ptr <PropagationTerminationDetails> propagationTerminationReason )
             {
+                if( isContiguousResultStorageUsed( ) )
+                {
+                    reset( equationsOfMotionNumericalSolutionRaw,
+                           utilities::ContiguousTimeHistory< TimeType, double >( dependentVariableHistory ),
+                           cumulativeComputationTimeHistory, cumulativeNumberOfFunctionEvaluations, propagationTerminationReason );
+                    return;
+                }
+
                 if ( sequentialPropagation_ || !isPropagationOngoing_ )
                 {
                     reset( );
@@ -146,11 +221,122 @@ namespace tudat
 
             }
 
+            //! Function that sets new numerical results of a propagation, with dependent variables stored contiguously
+            /*!
+             *  Function that sets new numerical results of a propagation, after the propagation of the dynamics, with the
+             *  dependent variables provided in contiguous storage (as filled during the propagation when contiguous result
+             *  storage is used, see SingleArcPropagatorProcessingSettings::setUseContiguousResultStorage). In that case,
+             *  the raw and processed state histories are stored contiguously as well, and the maps are only created when
+             *  requested. Otherwise, the dependent variables are converted to a map, and stored as such.
+             */
+            void reset(
+                    const std::map <TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >>& equationsOfMotionNumericalSolutionRaw,
+                    const utilities::ContiguousTimeHistory< TimeType, double >& dependentVariableHistory,
+                    const std::map<TimeType, double>& cumulativeComputationTimeHistory,
+                    const std::map<TimeType, unsigned int>& cumulativeNumberOfFunctionEvaluations,
+                    std::shared_ptr <PropagationTerminationDetails> propagationTerminationReason )
+            {
+                if( !isContiguousResultStorageUsed( ) )
+                {
+                    reset( equationsOfMotionNumericalSolutionRaw, dependentVariableHistory.toMap( ),
+                           cumulativeComputationTimeHistory, cumulativeNumberOfFunctionEvaluations, propagationTerminationReason );
+                    return;
+                }
+
+                utilities::ContiguousTimeHistory< TimeType, StateScalarType > currentNumericalSolutionRaw(
+                            equationsOfMotionNumericalSolutionRaw );
+                utilities::ContiguousTimeHistory< TimeType, double > currentDependentVariableHistory = dependentVariableHistory;
+                currentDependentVariableHistory.sortByTime( );
+
+                if ( sequentialPropagation_ || !isPropagationOngoing_ )
+                {
+                    reset( );
+                    equationsOfMotionNumericalSolutionRawTable_ = std::move( currentNumericalSolutionRaw );
+                    dependentVariableTable_ = std::move( currentDependentVariableHistory );
+                    cumulativeComputationTimeHistory_ = cumulativeComputationTimeHistory;
+                    cumulativeNumberOfFunctionEvaluations_ = cumulativeNumberOfFunctionEvaluations;
+
+                    if ( !sequentialPropagation_ )
+                    {
+                        isPropagationOngoing_ = true;
+                    }
+                }
+                else
+                {
+                    equationsOfMotionNumericalSolutionRawTable_.merge( currentNumericalSolutionRaw );
+                    dependentVariableTable_.merge( currentDependentVariableHistory );
+                    cumulativeComputationTimeHistory_.insert ( cumulativeComputationTimeHistory.begin( ), cumulativeComputationTimeHistory.end( ) );
+                    cumulativeNumberOfFunctionEvaluations_.insert( cumulativeNumberOfFunctionEvaluations.begin( ), cumulativeNumberOfFunctionEvaluations.end( ) );
+                    isPropagationOngoing_ = false;
+                }
+
+                // Convert raw solution directly into contiguous storage, if possible
+                if( contiguousRawSolutionConversionFunction_ != nullptr )
+                {
+                    contiguousRawSolutionConversionFunction_(
+                                equationsOfMotionNumericalSolutionTable_, equationsOfMotionNumericalSolutionRawTable_ );
+                }
+                else
+                {
+                    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > convertedSolution;
+                    rawSolutionConversionFunction_( convertedSolution, equationsOfMotionNumericalSolutionRawTable_.toMap( ) );
+                    equationsOfMotionNumericalSolutionTable_ =
+                            utilities::ContiguousTimeHistory< TimeType, StateScalarType >( convertedSolution );
+                }
+
+                solutionStoredContiguously_ = true;
+                areSolutionMapsSynchronized_ = false;
+                propagationTerminationReason_ = propagationTerminationReason;
+            }
+
+            //! Function to check whether the numerical results are to be stored in contiguous memory
+            bool isContiguousResultStorageUsed( )
+            {
+                return ( outputSettings_ != nullptr ) && outputSettings_->getUseContiguousResultStorage( );
+            }
+
+            //! Function to check whether the numerical results are currently stored in contiguous memory
+            bool isSolutionStoredContiguously( )
+            {
+                return solutionStoredContiguously_;
+            }
+
+            //! Function to create the maps of the state and dependent variable histories from the contiguous storage
+            /*!
+             *  Function to create the maps of the state and dependent variable histories from the contiguous storage, if the
+             *  results are stored contiguously, and the maps have not yet been created. This function is called by the
+             *  functions that retrieve the maps, but not by those that retrieve the contiguous storage.
+             */
+            void synchronizeSolutionMaps( )
+            {
+                if( solutionStoredContiguously_ && !areSolutionMapsSynchronized_ )
+                {
+                    equationsOfMotionNumericalSolution_ = equationsOfMotionNumericalSolutionTable_.toMap( );
+                    equationsOfMotionNumericalSolutionRaw_ = equationsOfMotionNumericalSolutionRawTable_.toMap( );
+                    dependentVariableHistory_ = dependentVariableTable_.toMap( );
+                    areSolutionMapsSynchronized_ = true;
+                }
+            }
+
             //! Function to clear all maps with numerical results, but *not* signal that a new propagation will start,
             //! this is typically done to save memory usage (and is called using the clearNumericalSolution setting
             //! of the PropagatorProcessingSettings
             void clearSolutionMaps( )
             {
+                // Retain initial and final time of the cleared solution (see getArcInitialAndFinalTime)
+                clearedSolutionTimesAreSet_ = ( solutionStoredContiguously_ && !equationsOfMotionNumericalSolutionRawTable_.empty( ) ) ||
+                        equationsOfMotionNumericalSolutionRaw_.size( ) > 0;
+                if( clearedSolutionTimesAreSet_ )
+                {
+                    clearedSolutionInitialAndFinalTime_ = getArcInitialAndFinalTime( );
+                }
+
+                equationsOfMotionNumericalSolutionTable_.clearAndRelease( );
+                equationsOfMotionNumericalSolutionRawTable_.clearAndRelease( );
+                dependentVariableTable_.clearAndRelease( );
+                solutionStoredContiguously_ = false;
+                areSolutionMapsSynchronized_ = true;
+
                 equationsOfMotionNumericalSolution_.clear();
                 equationsOfMotionNumericalSolutionRaw_.clear();
                 dependentVariableHistory_.clear();
@@ -162,8 +348,17 @@ namespace tudat
             //! Get initial and final propagation time from raw results
             std::pair< TimeType, TimeType > getArcInitialAndFinalTime( )
             {
-                if( equationsOfMotionNumericalSolutionRaw_.size( ) == 0 )
+                if( solutionStoredContiguously_ && !equationsOfMotionNumericalSolutionRawTable_.empty( ) )
+                {
+                    return std::make_pair( equationsOfMotionNumericalSolutionRawTable_.getFirstTime( ),
+                                           equationsOfMotionNumericalSolutionRawTable_.getLastTime( ) );
+                }
+                else if( equationsOfMotionNumericalSolutionRaw_.size( ) == 0 )
                 {
+                    if( solutionIsCleared_ && clearedSolutionTimesAreSet_ )
+                    {
+                        return clearedSolutionInitialAndFinalTime_;
+                    }
                     throw std::runtime_error( "Error when getting single-arc dynamics initial and final times; no results set" );
                 }
                 return std::make_pair( equationsOfMotionNumericalSolutionRaw_.begin( )->first, equationsOfMotionNumericalSolutionRaw_.rbegin( )->first );
@@ -173,14 +368,56 @@ namespace tudat
             void finalizePropagation( const std::map<TimeType, unsigned int> cumulativeNumberOfFunctionEvaluations )
             {
                 cumulativeNumberOfFunctionEvaluations_ = cumulativeNumberOfFunctionEvaluations;
+                if( cumulativeNumberOfFunctionEvaluations_.size( ) > 0 )
+                {
+                    stepStatistics_.numberOfFunctionEvaluations_ = std::max(
+                                cumulativeNumberOfFunctionEvaluations_.begin( )->second,
+                                cumulativeNumberOfFunctionEvaluations_.rbegin( )->second );
+                }
                 propagationIsPerformed_ = true;
             }
 
+            //! Function to set the profile of the model evaluations of the propagation
+            void setModelEvaluationProfile( const std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfile )
+            {
+                modelEvaluationProfile_ = modelEvaluationProfile;
+            }
+
+            //! Function to set the statistics of the integration steps of the propagation
+            void setStepStatistics( const PropagationStepStatistics& stepStatistics )
+            {
+                stepStatistics_ = stepStatistics;
+            }
+
+            //! Function to retrieve the statistics of the integration steps of the propagation
+            /*!
+             *  Function to retrieve the statistics of the integration steps of the propagation: number of accepted and
+             *  rejected steps, number of state derivative evaluations, and smallest and largest accepted step size.
+             *  \return Statistics of the integration steps of the propagation
+             */
+            PropagationStepStatistics getStepStatistics( ) const
+            {
+                return stepStatistics_;
+            }
+
+            //! Function to retrieve the profile of the model evaluations of the propagation
+            /*!
+             *  Function to retrieve the profile of the model evaluations (wall time and number of calls per model) of the
+             *  propagation, which is only available if requested through the
+             *  SingleArcPropagatorProcessingSettings::setProfileModelEvaluations function (nullptr otherwise).
+             *  \return Profile of the model evaluations of the propagation
+             */
+            std::shared_ptr< utilities::ModelEvaluationProfiler > getModelEvaluationProfile( )
+            {
+                return modelEvaluationProfile_;
+            }
+
             //! Manually set processed numerical solution, to be used when this object *is not* used in the
             //! propagation loop, but *is* used to store the numerical results
             void setEquationsOfMotionNumericalSolution(
                     const std::map <TimeType, Eigen::Matrix<StateScalarType, Eigen::Dynamic, 1>> & equationsOfMotionNumericalSolution )
             {
+                releaseContiguousSolution( );
                 onlyProcessedSolutionSet_ = true;
                 equationsOfMotionNumericalSolution_ = equationsOfMotionNumericalSolution;
             }
@@ -209,6 +446,7 @@ namespace tudat
                 {
                     checkAvailabilityOfSolution( "equations of motion numerical solution", false );
                 }
+                synchronizeSolutionMaps( );
                 return equationsOfMotionNumericalSolution_;
             }
 
@@ -216,15 +454,38 @@ namespace tudat
             getEquationsOfMotionNumericalSolutionRaw( )
             {
                 checkAvailabilityOfSolution( "equations of motion unprocessed numerical solution" );
+                synchronizeSolutionMaps( );
                 return equationsOfMotionNumericalSolutionRaw_;
             }
 
             std::map <TimeType, Eigen::VectorXd> &getDependentVariableHistory( )
             {
                 checkAvailabilityOfSolution( "dependent variable history", false );
+                synchronizeSolutionMaps( );
                 return dependentVariableHistory_;
             }
 
+            //! Function to retrieve the contiguously stored history of the processed state (see isContiguousResultStorageUsed)
+            const utilities::ContiguousTimeHistory< TimeType, StateScalarType >& getEquationsOfMotionNumericalSolutionTable( )
+            {
+                checkAvailabilityOfContiguousSolution( "equations of motion numerical solution", false );
+                return equationsOfMotionNumericalSolutionTable_;
+            }
+
+            //! Function to retrieve the contiguously stored history of the propagated state (see isContiguousResultStorageUsed)
+            const utilities::ContiguousTimeHistory< TimeType, StateScalarType >& getEquationsOfMotionNumericalSolutionRawTable( )
+            {
+                checkAvailabilityOfContiguousSolution( "equations of motion unprocessed numerical solution", true );
+                return equationsOfMotionNumericalSolutionRawTable_;
+            }
+
+            //! Function to retrieve the contiguously stored dependent variable history (see isContiguousResultStorageUsed)
+            const utilities::ContiguousTimeHistory< TimeType, double >& getDependentVariableTable( )
+            {
+                checkAvailabilityOfContiguousSolution( "dependent variable history", false );
+                return dependentVariableTable_;
+            }
+
             std::map<TimeType, double> &getCumulativeComputationTimeHistory( )
             {
                 checkAvailabilityOfSolution( "cumulative computation time history", false );
@@ -351,12 +612,33 @@ namespace tudat
 
             void updateDependentVariableInterface( )
             {
-                if( dependentVariableHistory_.size( ) > 0 && dependentVariableInterface_ != nullptr )
+                if( dependentVariableInterface_ == nullptr )
+                {
+                    return;
+                }
+
+                std::vector< TimeType > dependentVariableTimes;
+                std::vector< Eigen::VectorXd > dependentVariableValues;
+                if( solutionStoredContiguously_ )
+                {
+                    dependentVariableTimes = dependentVariableTable_.getTimes( );
+                    dependentVariableValues.reserve( dependentVariableTable_.size( ) );
+                    for( int i = 0; i < dependentVariableTable_.size( ); i++ )
+                    {
+                        dependentVariableValues.push_back( dependentVariableTable_.getValue( i ) );
+                    }
+                }
+                else
+                {
+                    dependentVariableTimes = utilities::createVectorFromMapKeys< Eigen::VectorXd, TimeType >( dependentVariableHistory_ );
+                    dependentVariableValues = utilities::createVectorFromMapValues< Eigen::VectorXd, TimeType >( dependentVariableHistory_ );
+                }
+
+                if( dependentVariableTimes.size( ) > 0 )
                 {
                     std::shared_ptr< interpolators::LagrangeInterpolator< TimeType, Eigen::VectorXd > > dependentVariablesInterpolator =
                             std::make_shared< interpolators::LagrangeInterpolator< TimeType, Eigen::VectorXd > >(
-                                    utilities::createVectorFromMapKeys< Eigen::VectorXd, TimeType >( dependentVariableHistory_ ),
-                                    utilities::createVectorFromMapValues< Eigen::VectorXd, TimeType >( dependentVariableHistory_ ), 8 );
+                                    dependentVariableTimes, dependentVariableValues, 8 );
                     dependentVariableInterface_->updateDependentVariablesInterpolator( dependentVariablesInterpolator );
                 }
             }
@@ -371,9 +653,57 @@ namespace tudat
                 return getSingleArcDependentVariablesInterface( );
             }
 
+            //! Function to retrieve the (heap) memory held by the numerical results, per type of result
+            /*!
+             *  Function to retrieve the (heap) memory held by the numerical results, per type of result (state history,
+             *  propagated state history, dependent variable history and computation time history). Both the maps and the
+             *  contiguous storage (if any) are included.
+             *  \return Memory held by the numerical results
+             */
+            utilities::MemoryFootprint getMemoryFootprint( ) const
+            {
+                utilities::MemoryFootprint memoryFootprint;
+                memoryFootprint.addEntry(
+                            "state_history", utilities::getHeapMemorySize( equationsOfMotionNumericalSolution_ ) +
+                            equationsOfMotionNumericalSolutionTable_.getHeapMemorySize( ) );
+                memoryFootprint.addEntry(
+                            "propagated_state_history", utilities::getHeapMemorySize( equationsOfMotionNumericalSolutionRaw_ ) +
+                            equationsOfMotionNumericalSolutionRawTable_.getHeapMemorySize( ) );
+                memoryFootprint.addEntry(
+                            "dependent_variable_history", utilities::getHeapMemorySize( dependentVariableHistory_ ) +
+                            dependentVariableTable_.getHeapMemorySize( ) );
+                memoryFootprint.addEntry(
+                            "computation_time_history", utilities::getHeapMemorySize( cumulativeComputationTimeHistory_ ) +
+                            utilities::getHeapMemorySize( cumulativeNumberOfFunctionEvaluations_ ) );
+                return memoryFootprint;
+            }
+
 
         private:
 
+            //! Function to check if contiguous storage that is requested is available
+            void checkAvailabilityOfContiguousSolution( const std::string& dataToRetrieve, const bool checkEomOnly )
+            {
+                checkAvailabilityOfSolution( dataToRetrieve, checkEomOnly );
+                if( !solutionStoredContiguously_ )
+                {
+                    throw std::runtime_error( "Error when retrieving contiguous " + dataToRetrieve + ", results are not stored contiguously." );
+                }
+            }
+
+            //! Function to make the maps the only storage of the numerical results (e.g. before they are modified directly)
+            void releaseContiguousSolution( )
+            {
+                if( solutionStoredContiguously_ )
+                {
+                    synchronizeSolutionMaps( );
+                    equationsOfMotionNumericalSolutionTable_.clearAndRelease( );
+                    equationsOfMotionNumericalSolutionRawTable_.clearAndRelease( );
+                    dependentVariableTable_.clearAndRelease( );
+                    solutionStoredContiguously_ = false;
+                }
+            }
+
             //! Map of state history of numerically integrated bodies.
             /*!
              *  Map of state history of numerically integrated bodies, i.e. the result of the numerical integration, transformed
@@ -395,6 +725,21 @@ namespace tudat
             //! Map of dependent variable history that was saved during numerical propagation.
             std::map <TimeType, Eigen::VectorXd> dependentVariableHistory_;
 
+            //! Processed state history, stored contiguously (only used if results are stored contiguously).
+            utilities::ContiguousTimeHistory< TimeType, StateScalarType > equationsOfMotionNumericalSolutionTable_;
+
+            //! Propagated state history, stored contiguously (only used if results are stored contiguously).
+            utilities::ContiguousTimeHistory< TimeType, StateScalarType > equationsOfMotionNumericalSolutionRawTable_;
+
+            //! Dependent variable history, stored contiguously (only used if results are stored contiguously).
+            utilities::ContiguousTimeHistory< TimeType, double > dependentVariableTable_;
+
+            //! Boolean denoting whether the state and dependent variable histories are stored contiguously
+            bool solutionStoredContiguously_ = false;
+
+            //! Boolean denoting whether the maps with results have been created from the contiguous storage
+            bool areSolutionMapsSynchronized_ = true;
+
             //! Map of cumulative computation time history that was saved during numerical propagation.
             std::map<TimeType, double> cumulativeComputationTimeHistory_;
 
@@ -420,15 +765,31 @@ namespace tudat
             const std::function< void ( std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >&,
                                         const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& ) > rawSolutionConversionFunction_;
 
+            //! Function to convert the contiguously stored propagated solution to conventional solution
+            const std::function< void ( utilities::ContiguousTimeHistory< TimeType, StateScalarType >&,
+                                        const utilities::ContiguousTimeHistory< TimeType, StateScalarType >& ) > contiguousRawSolutionConversionFunction_;
+
             bool propagationIsPerformed_;
 
             bool solutionIsCleared_;
 
+            //! Boolean denoting whether clearedSolutionInitialAndFinalTime_ is set
+            bool clearedSolutionTimesAreSet_ = false;
+
+            //! Initial and final time of the raw solution before it was last cleared
+            std::pair< TimeType, TimeType > clearedSolutionInitialAndFinalTime_;
+
             bool onlyProcessedSolutionSet_;
 
             //! Event that triggered the termination of the propagation
             std::shared_ptr <PropagationTerminationDetails> propagationTerminationReason_;
 
+            //! Profile of the model evaluations of the propagation (nullptr if not requested)
+            std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfile_;
+
+            //! Statistics of the integration steps of the propagation
+            PropagationStepStatistics stepStatistics_;
+
             friend class SingleArcDynamicsSimulator<StateScalarType, TimeType>;
 
 //            friend class MultiArcSimulationResults<StateScalarType, TimeType, NumberOfStateColumns >;
@@ -452,7 +813,8 @@ namespace tudat
                                                    const int sensitivityMatrixSize ):
             singleArcDynamicsResults_( singleArcDynamicsResults ),
             stateTransitionMatrixSize_( stateTransitionMatrixSize ),
-            sensitivityMatrixSize_( sensitivityMatrixSize )
+            sensitivityMatrixSize_( sensitivityMatrixSize ),
+            areSensitivityColumnsOmitted_( false )
             {
 
             }
@@ -480,6 +842,23 @@ namespace tudat
                         propagationTerminationReason );
             }
 
+            void reset(
+                    std::map <TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >>& fullSolution,
+                    const utilities::ContiguousTimeHistory< TimeType, double >& dependentVariableHistory,
+                    const std::map<TimeType, double>& cumulativeComputationTimeHistory,
+                    const std::map<TimeType, unsigned int>& cumulativeNumberOfFunctionEvaluations,
+                    std::shared_ptr <PropagationTerminationDetails> propagationTerminationReason )
+            {
+                std::map <TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >> equationsOfMotionNumericalSolutionRaw;
+                splitSolution( fullSolution, equationsOfMotionNumericalSolutionRaw );
+                singleArcDynamicsResults_->reset(
+                        equationsOfMotionNumericalSolutionRaw,
+                        dependentVariableHistory,
+                        cumulativeComputationTimeHistory,
+                        cumulativeNumberOfFunctionEvaluations,
+                        propagationTerminationReason );
+            }
+
             void manuallySetSecondaryData( const std::shared_ptr< SingleArcVariationalSimulationResults< StateScalarType, TimeType > > resultsToCopy )
             {
                 singleArcDynamicsResults_->manuallySetSecondaryData( resultsToCopy->getDynamicsResults( ) );
@@ -490,11 +869,26 @@ namespace tudat
                     const std::map <TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >>& fullSolution,
                     std::map <TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >>& equationsOfMotionNumericalSolutionRaw )
             {
+                const int propagatedSensitivityMatrixSize = getPropagatedSensitivityMatrixSize( );
                 for( auto it : fullSolution )
                 {
                     stateTransitionSolution_[ static_cast< double >( it.first ) ] = it.second.block( 0, 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ).template cast< double >( );
-                    sensitivitySolution_[ static_cast< double >( it.first ) ] = it.second.block( 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_, sensitivityMatrixSize_ ).template cast< double >( );
-                    equationsOfMotionNumericalSolutionRaw[ static_cast< double >( it.first ) ] = it.second.block( 0, stateTransitionMatrixSize_ + sensitivityMatrixSize_, stateTransitionMatrixSize_, 1 );
+                    if( propagatedSensitivityMatrixSize == sensitivityMatrixSize_ )
+                    {
+                        sensitivitySolution_[ static_cast< double >( it.first ) ] = it.second.block( 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_, sensitivityMatrixSize_ ).template cast< double >( );
+                    }
+                    else
+                    {
+                        // Omitted columns are identically zero
+                        Eigen::MatrixXd& currentSensitivity = sensitivitySolution_[ static_cast< double >( it.first ) ];
+                        currentSensitivity.setZero( stateTransitionMatrixSize_, sensitivityMatrixSize_ );
+                        for( int i = 0; i < propagatedSensitivityMatrixSize; i++ )
+                        {
+                            currentSensitivity.col( propagatedSensitivityColumnIndices_.at( i ) ) =
+                                    it.second.col( stateTransitionMatrixSize_ + i ).template cast< double >( );
+                        }
+                    }
+                    equationsOfMotionNumericalSolutionRaw[ static_cast< double >( it.first ) ] = it.second.block( 0, stateTransitionMatrixSize_ + propagatedSensitivityMatrixSize, stateTransitionMatrixSize_, 1 );
                 }
             }
 
@@ -510,6 +904,16 @@ namespace tudat
                 singleArcDynamicsResults_->finalizePropagation( cumulativeNumberOfFunctionEvaluations );
             }
 
+            void setModelEvaluationProfile( const std::shared_ptr< utilities::ModelEvaluationProfiler > modelEvaluationProfile )
+            {
+                singleArcDynamicsResults_->setModelEvaluationProfile( modelEvaluationProfile );
+            }
+
+            void setStepStatistics( const PropagationStepStatistics& stepStatistics )
+            {
+                singleArcDynamicsResults_->setStepStatistics( stepStatistics );
+            }
+
             std::map < double, Eigen::MatrixXd >& getStateTransitionSolution( )
             {
                 return stateTransitionSolution_;
@@ -529,7 +933,8 @@ namespace tudat
             {
                 if( stateTransitionSolution_.size( ) == 0 )
                 {
-                    throw std::runtime_error( "Error when getting single-arc variational initial and final times; no results set" );
+                    // Use times of dynamics solution, if variational solution is already released (throws if neither is set)
+                    return singleArcDynamicsResults_->getArcInitialAndFinalTime( );
                 }
                 return std::make_pair( stateTransitionSolution_.begin( )->first, stateTransitionSolution_.rbegin( )->first );
             }
@@ -544,6 +949,26 @@ namespace tudat
                 return sensitivityMatrixSize_;
             }
 
+            //! Function to set the columns of the sensitivity matrix that are propagated (others are identically zero)
+            /*!
+             * Function to set the columns of the sensitivity matrix that are propagated, with the other columns being identically
+             * zero (see VariationalEquations::omitDynamicsFreeParameterColumns). The numerical solution then contains only the
+             * propagated columns, which are inserted in the full sensitivity matrix by splitSolution.
+             * \param propagatedSensitivityColumnIndices Indices (in the full sensitivity matrix) of the propagated columns
+             */
+            void setPropagatedSensitivityColumnIndices( const std::vector< int >& propagatedSensitivityColumnIndices )
+            {
+                propagatedSensitivityColumnIndices_ = propagatedSensitivityColumnIndices;
+                areSensitivityColumnsOmitted_ = true;
+            }
+
+            //! Function to retrieve the number of sensitivity matrix columns that is propagated
+            int getPropagatedSensitivityMatrixSize( )
+            {
+                return areSensitivityColumnsOmitted_ ?
+                            static_cast< int >( propagatedSensitivityColumnIndices_.size( ) ) : sensitivityMatrixSize_;
+            }
+
             std::shared_ptr< SingleArcDependentVariablesInterface< TimeType > > getSingleArcDependentVariablesInterface( )
             {
                 return singleArcDynamicsResults_->getSingleArcDependentVariablesInterface( );
@@ -554,6 +979,17 @@ namespace tudat
                 return getSingleArcDependentVariablesInterface( );
             }
 
+            //! Function to retrieve the (heap) memory held by the numerical results (dynamics and variational equations)
+            utilities::MemoryFootprint getMemoryFootprint( ) const
+            {
+                utilities::MemoryFootprint memoryFootprint = singleArcDynamicsResults_->getMemoryFootprint( );
+                memoryFootprint.addEntry( "state_transition_matrix_history",
+                                          utilities::getHeapMemorySize( stateTransitionSolution_ ) );
+                memoryFootprint.addEntry( "sensitivity_matrix_history",
+                                          utilities::getHeapMemorySize( sensitivitySolution_ ) );
+                return memoryFootprint;
+            }
+
 
         protected:
             const std::shared_ptr< SingleArcSimulationResults< StateScalarType, TimeType > > singleArcDynamicsResults_;
@@ -562,6 +998,12 @@ namespace tudat
 
             const int sensitivityMatrixSize_;
 
+            //! Indices (in the full sensitivity matrix) of the propagated columns (if areSensitivityColumnsOmitted_ is true)
+            std::vector< int > propagatedSensitivityColumnIndices_;
+
+            //! Boolean denoting whether only the columns in propagatedSensitivityColumnIndices_ are propagated
+            bool areSensitivityColumnsOmitted_;
+
             std::map < double, Eigen::MatrixXd > stateTransitionSolution_;
 
             std::map < double, Eigen::MatrixXd > sensitivitySolution_;
@@ -821,6 +1263,17 @@ namespace tudat
                 return getMultiArcDependentVariablesInterface( );
             }
 
+            //! Function to retrieve the (heap) memory held by the numerical results, summed over all arcs
+            utilities::MemoryFootprint getMemoryFootprint( ) const
+            {
+                utilities::MemoryFootprint memoryFootprint;
+                for( unsigned int i = 0; i < singleArcResults_.size( ); i++ )
+                {
+                    memoryFootprint.addFootprint( singleArcResults_.at( i )->getMemoryFootprint( ) );
+                }
+                return memoryFootprint;
+            }
+
             void updateDependentVariableInterface( )
             {
                 std::vector<std::shared_ptr<interpolators::OneDimensionalInterpolator<TimeType, Eigen::VectorXd> > > dependentVariablesInterpolators;
@@ -975,6 +1428,15 @@ namespace tudat
                 return getHybridArcDependentVariablesInterface( );
             }
 
+            //! Function to retrieve the (heap) memory held by the numerical results, for the single- and multi-arc results
+            utilities::MemoryFootprint getMemoryFootprint( ) const
+            {
+                utilities::MemoryFootprint memoryFootprint;
+                memoryFootprint.addFootprint( singleArcResults_->getMemoryFootprint( ), "single_arc" );
+                memoryFootprint.addFootprint( multiArcResults_->getMemoryFootprint( ), "multi_arc" );
+                return memoryFootprint;
+            }
+
             void updateDependentVariableInterface( )
             {
                 singleArcResults_->updateDependentVariableInterface( );
@@ -747,6 +747,35 @@ public:
         return outputSettings_;
     }
 
+    //! Function to set the single-arc settings to be used in the propagation of each arc of the multi-arc component
+    /*!
+     * Function to set the single-arc settings to be used in the propagation of each arc of the multi-arc component, when
+     * the single-arc bodies are propagated along with the multi-arc bodies in each arc (see
+     * HybridArcVariationalEquationsSolver). Each entry must describe the same dynamics as the single-arc settings, with the
+     * acceleration models created from the environment of the corresponding arc, such that arcs with separate environments
+     * can be propagated concurrently. If not set (default), the single-arc settings are used in all arcs.
+     * \param arcWiseSingleArcPropagatorSettings Single-arc settings to be used in each arc of the multi-arc component
+     */
+    void setArcWiseSingleArcPropagatorSettings(
+            const std::vector< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > >&
+            arcWiseSingleArcPropagatorSettings )
+    {
+        if( arcWiseSingleArcPropagatorSettings.size( ) != 0 &&
+                static_cast< int >( arcWiseSingleArcPropagatorSettings.size( ) ) != multiArcPropagatorSettings_->getNmberOfArcs( ) )
+        {
+            throw std::runtime_error( "Error when setting arc-wise single-arc settings in hybrid-arc settings, " +
+                                      std::to_string( arcWiseSingleArcPropagatorSettings.size( ) ) + " settings provided for " +
+                                      std::to_string( multiArcPropagatorSettings_->getNmberOfArcs( ) ) + " arcs" );
+        }
+        arcWiseSingleArcPropagatorSettings_ = arcWiseSingleArcPropagatorSettings;
+    }
+
+    //! Function to retrieve the single-arc settings to be used in the propagation of each arc of the multi-arc component
+    std::vector< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > > getArcWiseSingleArcPropagatorSettings( )
+    {
+        return arcWiseSingleArcPropagatorSettings_;
+    }
+
 //    void processHybridArcOutputSettings( const bool clearNumericalSolution, const bool setIntegratedResult )
 //    {
 //        singleArcPropagatorSettings_->getOutputSettingsWithCheck( )->setClearNumericalSolutions( clearNumericalSolution );
@@ -764,6 +793,9 @@ protected:
 
     std::shared_ptr< HybridArcPropagatorProcessingSettings > outputSettings_;
 
+    //! Single-arc settings to be used in the propagation of each arc of the multi-arc component (empty if not set)
+    std::vector< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > > arcWiseSingleArcPropagatorSettings_;
+
     //! Size of total single-arc initial state
     int singleArcStateSize_;
 
@@ -855,10 +887,14 @@ public:
 
     virtual std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > clone( )
     {
-        return std::make_shared< TranslationalStatePropagatorSettings< StateScalarType, TimeType > >(
+        std::shared_ptr< TranslationalStatePropagatorSettings< StateScalarType, TimeType > > clonedSettings =
+                std::make_shared< TranslationalStatePropagatorSettings< StateScalarType, TimeType > >(
                     centralBodies_, accelerationsMap_, bodiesToIntegrate_, this->initialStates_, this->initialTime_, this->integratorSettings_,
                     this->terminationSettings_, propagator_, this->dependentVariablesToSave_,
                     std::make_shared< SingleArcPropagatorProcessingSettings >( *this->outputSettings_ ) );
+        clonedSettings->setNumberOfAccelerationThreads( numberOfAccelerationThreads_ );
+        clonedSettings->setUseMutualPointMassGravityKernel( useMutualPointMassGravityKernel_ );
+        return clonedSettings;
     }
 
     //! Constructor for fixed propagation time stopping conditions, providing an alreay-created accelerations map.
@@ -998,6 +1034,48 @@ public:
                     ( this->stateSize_ + bodiesToIntegrate_.size( ) ) : this->stateSize_;
     }
 
+    //! Function to set the number of threads over which the acceleration models of the propagated bodies are updated
+    /*!
+     * Function to set the number of threads over which the acceleration models of the propagated bodies are updated
+     * (see NBodyStateDerivative::setNumberOfParallelThreads). Using more than one thread is only beneficial for
+     * propagations of many bodies, and requires the acceleration models acting on different bodies to be independent.
+     * \param numberOfAccelerationThreads Number of threads that is to be used (1 for serial update)
+     */
+    void setNumberOfAccelerationThreads( const int numberOfAccelerationThreads )
+    {
+        if( numberOfAccelerationThreads < 1 )
+        {
+            throw std::runtime_error( "Error when setting number of acceleration threads, number must be positive, but is "
+                                      + std::to_string( numberOfAccelerationThreads ) );
+        }
+        numberOfAccelerationThreads_ = numberOfAccelerationThreads;
+    }
+
+    //! Function to retrieve the number of threads over which the acceleration models of the propagated bodies are updated
+    int getNumberOfAccelerationThreads( ) const
+    {
+        return numberOfAccelerationThreads_;
+    }
+
+    //! Function to set whether the point-mass accelerations between the propagated bodies are evaluated by a single kernel
+    /*!
+     * Function to set whether the point-mass accelerations between the propagated bodies are evaluated by a single
+     * all-pairs kernel, instead of by the separate acceleration models (see
+     * NBodyStateDerivative::useMutualPointMassGravityKernel). This is beneficial for propagations of many mutually
+     * attracting bodies (e.g. ephemeris integration of planets and asteroids).
+     * \param useMutualPointMassGravityKernel Boolean denoting whether the kernel is to be used
+     */
+    void setUseMutualPointMassGravityKernel( const bool useMutualPointMassGravityKernel )
+    {
+        useMutualPointMassGravityKernel_ = useMutualPointMassGravityKernel;
+    }
+
+    //! Function to retrieve whether the point-mass accelerations between the propagated bodies are evaluated by a single kernel
+    bool getUseMutualPointMassGravityKernel( ) const
+    {
+        return useMutualPointMassGravityKernel_;
+    }
+
 private:
 
     void verifyInput( )
@@ -1032,6 +1110,12 @@ private:
      */
     basic_astrodynamics::AccelerationMap accelerationsMap_;
 
+    //! Number of threads over which the acceleration models of the propagated bodies are updated
+    int numberOfAccelerationThreads_ = 1;
+
+    //! Boolean denoting whether the point-mass accelerations between the propagated bodies are evaluated by a single kernel
+    bool useMutualPointMassGravityKernel_ = false;
+
 };
 
 
@@ -1699,6 +1783,9 @@ customStatePropagatorSettings(
  *  multi-arc settings.
  *  \param multiArcSettings Multi-arc settings that are to be extended
  *  \param numberofArcs Number of arcs in which the single-arc dynamics is to be split
+ *  \param arcWiseSingleArcSettings Single-arc settings from which the single-arc accelerations in each arc are taken (see
+ *  HybridArcPropagatorSettings::setArcWiseSingleArcPropagatorSettings; empty by default, in which case the accelerations of
+ *  singleArcSettings are used in all arcs)
  *  \return Multi-arc propagator settings by merging an existing multi-arc with single-arc settings
  */
 template< typename StateScalarType = double, typename TimeType = double >
@@ -1706,7 +1793,9 @@ template< typename StateScalarType = double, typename TimeType = double >
 std::shared_ptr< MultiArcPropagatorSettings< StateScalarType, TimeType > > getExtendedMultiPropagatorSettings(
         const std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > singleArcSettings,
         const std::shared_ptr< MultiArcPropagatorSettings< StateScalarType, TimeType > > multiArcSettings,
-        const int numberofArcs )
+        const int numberofArcs,
+        const std::vector< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > >& arcWiseSingleArcSettings =
+        std::vector< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > >( ) )
 {
     std::vector< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > > constituentSingleArcSettings;
 
@@ -1742,9 +1831,24 @@ std::shared_ptr< MultiArcPropagatorSettings< StateScalarType, TimeType > > getEx
             std::vector< std::string > fullCentralBodies = singleArcTranslationalSettings->centralBodies_;
             fullCentralBodies.insert( fullCentralBodies.end( ), multiArcCentralBodies.begin( ), multiArcCentralBodies.end( ) );
 
-            // Create full accelerations map
+            // Create full accelerations map (with single-arc accelerations of current arc, if provided)
+            std::shared_ptr< TranslationalStatePropagatorSettings< StateScalarType, TimeType > > currentSingleArcTranslationalSettings =
+                    singleArcTranslationalSettings;
+            if( arcWiseSingleArcSettings.size( ) > 0 )
+            {
+                currentSingleArcTranslationalSettings =
+                        std::dynamic_pointer_cast< TranslationalStatePropagatorSettings< StateScalarType, TimeType > >(
+                            arcWiseSingleArcSettings.at( i ) );
+                if( currentSingleArcTranslationalSettings == nullptr ||
+                        currentSingleArcTranslationalSettings->bodiesToIntegrate_ != singleArcTranslationalSettings->bodiesToIntegrate_ )
+                {
+                    throw std::runtime_error(
+                                "Error when making multi-arc propagator settings from single arc. Single-arc settings of arc " +
+                                std::to_string( i ) + " not consistent with single-arc input." );
+                }
+            }
             basic_astrodynamics::AccelerationMap multiArcAccelerationsMap = currentArcTranslationalSettings->getAccelerationsMap( );
-            basic_astrodynamics::AccelerationMap fullAccelerationsMap = singleArcTranslationalSettings->getAccelerationsMap( );
+            basic_astrodynamics::AccelerationMap fullAccelerationsMap = currentSingleArcTranslationalSettings->getAccelerationsMap( );
             fullAccelerationsMap.insert( multiArcAccelerationsMap.begin( ), multiArcAccelerationsMap.end( ) );
 
             // Create full list of propagated bodies
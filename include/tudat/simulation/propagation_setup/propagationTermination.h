@@ -419,6 +419,22 @@ public:
         return isConditionMetWhenStopping_;
     }
 
+    //! Function to reset the list denoting which of the constituent termination conditions were met when stopping.
+    /*!
+     *  Function to reset the list denoting which of the constituent termination conditions were met when stopping. Used
+     *  after the propagation has been terminated on an exact condition, to flag only those events that occur at (or, if all
+     *  conditions are to be met, before) the final time.
+     *  \param isConditionMetWhenStopping List denoting for each constituent condition whether it was met when stopping.
+     */
+    void resetIsConditionMetWhenStopping( const std::vector< bool >& isConditionMetWhenStopping )
+    {
+        if( isConditionMetWhenStopping.size( ) != propagationTerminationCondition_.size( ) )
+        {
+            throw std::runtime_error( "Error when resetting list of met hybrid termination conditions, size is incompatible" );
+        }
+        isConditionMetWhenStopping_ = isConditionMetWhenStopping;
+    }
+
 private:
 
     //! List of termination conditions that are checked when calling checkStopCondition is called.
@@ -704,16 +720,12 @@ public:
     //! Function to retrieve list of booleans, denoting for each of the constituent stopping conditions whether or not is was met.
     /*!
      * Function to retrieve list of booleans, denoting for each of the constituent stopping conditions whether or not is was met.
+     * If the propagation was terminated on an exact condition, only the events located at (or, if all conditions are to be
+     * met, before) the final time are flagged; simultaneous events (within root finder tolerance) are all flagged.
      * \return List of booleans, denoting for each of the constituent stopping conditions whether or not is was met.
      */
     std::vector< bool > getWasConditionMetWhenStopping( )
     {
-        if( terminationOnExactCondition_ )
-        {
-            std::cerr << "Warning when retrieving list of conditions that were met in hybrid propagation "
-                         "termination details. propagation was terminated on exact conditions using root finder, "
-                         "list of conditions may not be reliable" << std::endl;
-        }
         return isConditionMetWhenStopping_;
     }
 
@@ -0,0 +1,138 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PROPAGATION_TRANSFER_TRAJECTORY_FULL_PROBLEM_H
+#define TUDAT_PROPAGATION_TRANSFER_TRAJECTORY_FULL_PROBLEM_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/mission_segments/transferTrajectory.h"
+#include "tudat/simulation/propagation_setup/dynamicsSimulator.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Typedef for the function that creates the propagator settings for a single part of a transfer leg
+/*!
+ *  Typedef for the function that creates the propagator settings for the full-dynamics propagation of a single part
+ *  (from the midpoint of a leg segment towards one of its boundaries) of a transfer trajectory. The input of the
+ *  function is: the bodies with which the state derivative models are to be created, the index of the leg, the initial
+ *  Cartesian state (w.r.t. the central body of the transfer trajectory), the initial time and the final time. The final
+ *  time is smaller than the initial time for a backward propagation, in which case the integrator settings must use a
+ *  negative time step. The function is called concurrently by different threads (each with its own bodies), so it must
+ *  not modify any shared state.
+ */
+typedef std::function< std::shared_ptr< SingleArcPropagatorSettings< double > >(
+        const simulation_setup::SystemOfBodies&, const int, const Eigen::Vector6d&, const double, const double ) >
+TransferLegPropagatorSettingsFunction;
+
+//! Results of the full-dynamics propagation of a single leg of a transfer trajectory
+/*!
+ *  Results of the full-dynamics propagation of a single leg of a transfer trajectory. The leg is split into segments at
+ *  its impulsive maneuvers (if any), and each segment is propagated forward and backward from its midpoint, starting
+ *  from the patched-conic state at the midpoint.
+ */
+struct TransferLegFullProblemResults
+{
+    //! Times at the boundaries of the segments (leg departure time, maneuver times and leg arrival time)
+    std::vector< double > segmentBoundaryTimes_;
+
+    //! Propagated state history from the midpoint to the end of each segment
+    std::vector< std::map< double, Eigen::VectorXd > > forwardStateHistories_;
+
+    //! Propagated state history from the midpoint to the start of each segment
+    std::vector< std::map< double, Eigen::VectorXd > > backwardStateHistories_;
+
+    //! Dependent variable history from the midpoint to the end of each segment
+    std::vector< std::map< double, Eigen::VectorXd > > forwardDependentVariableHistories_;
+
+    //! Dependent variable history from the midpoint to the start of each segment
+    std::vector< std::map< double, Eigen::VectorXd > > backwardDependentVariableHistories_;
+
+    //! Patched-conic state at the leg departure time
+    Eigen::Vector6d patchedConicDepartureState_;
+
+    //! Patched-conic state at the leg arrival time
+    Eigen::Vector6d patchedConicArrivalState_;
+
+    //! Function to retrieve the number of segments of the leg
+    int getNumberOfSegments( ) const
+    {
+        return static_cast< int >( forwardStateHistories_.size( ) );
+    }
+
+    //! Function to retrieve the difference between the propagated and patched-conic state at leg departure
+    /*!
+     *  Function to retrieve the difference between the propagated state (at the end of the backward propagation of the
+     *  first segment) and the patched-conic state at leg departure
+     *  \return Difference between the propagated and patched-conic state at leg departure
+     */
+    Eigen::Vector6d getDepartureStateDifference( ) const;
+
+    //! Function to retrieve the difference between the propagated and patched-conic state at leg arrival
+    /*!
+     *  Function to retrieve the difference between the propagated state (at the end of the forward propagation of the
+     *  last segment) and the patched-conic state at leg arrival
+     *  \return Difference between the propagated and patched-conic state at leg arrival
+     */
+    Eigen::Vector6d getArrivalStateDifference( ) const;
+
+    //! Function to retrieve the propagated state history of the full leg
+    /*!
+     *  Function to retrieve the propagated state history of the full leg, merging the backward and forward histories of
+     *  all segments. At a maneuver time, the state after the maneuver is retained.
+     *  \return Propagated state history of the full leg
+     */
+    std::map< double, Eigen::VectorXd > getStateHistory( ) const;
+};
+
+//! Function to propagate the full dynamics along all legs of a transfer trajectory
+/*!
+ *  Function to propagate the full dynamics along all legs of a (previously evaluated) transfer trajectory, for instance to
+ *  verify an optimised multiple gravity-assist trajectory. Each leg is split into segments at its impulsive maneuvers,
+ *  and each segment is propagated forward and backward from its midpoint, starting from the patched-conic state at the
+ *  midpoint. Since each of these propagations depends only on the patched-conic solution, they are all independent, and
+ *  are distributed over the worker threads (propagation p is performed by worker p mod number of workers). Each worker
+ *  creates the state derivative models of its propagations from its own bodies, so that no environment models are shared
+ *  between threads. The results are merged in leg order, independently of the number of workers.
+ *  \param transferTrajectory Transfer trajectory that is to be propagated (must have been evaluated)
+ *  \param workerBodies List of bodies, one entry per worker thread. Entries must not share any Body objects.
+ *  \param propagatorSettingsFunction Function that creates the propagator settings of a single propagation. The settings
+ *  must not reset the environment after propagation (setIntegratedResult must be false).
+ *  \return Full-dynamics propagation results of each leg
+ */
+std::vector< TransferLegFullProblemResults > propagateTransferTrajectoryFullProblem(
+        const std::shared_ptr< mission_segments::TransferTrajectory > transferTrajectory,
+        const std::vector< simulation_setup::SystemOfBodies >& workerBodies,
+        const TransferLegPropagatorSettingsFunction propagatorSettingsFunction );
+
+//! Function to retrieve the difference between the full-dynamics and patched-conic states at the leg boundaries
+/*!
+ *  Function to retrieve the difference between the full-dynamics and patched-conic states at the departure and arrival
+ *  of each leg
+ *  \param fullProblemResults Full-dynamics propagation results of each leg, from propagateTransferTrajectoryFullProblem
+ *  \return Differences in Cartesian state at departure (first) and arrival (second), with the leg index as key
+ */
+std::map< int, std::pair< Eigen::Vector6d, Eigen::Vector6d > > getDifferenceFullProblemWrtTransferTrajectory(
+        const std::vector< TransferLegFullProblemResults >& fullProblemResults );
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_PROPAGATION_TRANSFER_TRAJECTORY_FULL_PROBLEM_H
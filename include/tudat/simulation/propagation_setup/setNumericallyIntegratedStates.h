@@ -16,6 +16,7 @@
 #include "tudat/simulation/environment_setup/body.h"
 #include "tudat/astro/ephemerides/frameManager.h"
 #include "tudat/astro/ephemerides/multiArcEphemeris.h"
+#include "tudat/astro/ephemerides/chebyshevEphemeris.h"
 #include "tudat/astro/ephemerides/tabulatedEphemeris.h"
 #include "tudat/astro/ephemerides/tabulatedRotationalEphemeris.h"
 #include "tudat/simulation/propagation_setup/propagationSettings.h"
@@ -75,38 +76,108 @@ std::shared_ptr< interpolators::OneDimensionalInterpolator< TimeType, Eigen::Mat
 createStateInterpolator(
         const std::map< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > >& stateMap );
 
+//! Function to create an interpolator for the new translational state of a body, or reset an existing one in place.
+/*!
+ * Function to create an interpolator for the new translational state of a body, of the same type as that produced by
+ * createStateInterpolator. If an existing interpolator of this type is provided, its data is reset in place (see
+ * LagrangeInterpolator::resetData), so that its storage and, for unchanged state times, its look-up scheme and
+ * barycentric weights are reused. Otherwise, a new interpolator is created.
+ * \param stateTimes Times of new state history (sorted in ascending order)
+ * \param states New state history, w.r.t. the required ephemeris origin, at stateTimes.
+ * \param existingInterpolator Interpolator that is to be reset, if of the correct type (nullptr if none).
+ * \return Lagrange interpolator (order 6) that produces the required continuous state.
+ */
+template< typename TimeType, typename StateScalarType >
+std::shared_ptr< interpolators::OneDimensionalInterpolator< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > > >
+createOrResetStateInterpolator(
+        const std::vector< TimeType >& stateTimes,
+        const std::vector< Eigen::Matrix< StateScalarType, 6, 1 > >& states,
+        const std::shared_ptr< interpolators::OneDimensionalInterpolator< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > > >
+        existingInterpolator = nullptr )
+{
+    using namespace tudat::interpolators;
+
+    std::shared_ptr< LagrangeInterpolator< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > > > lagrangeInterpolator =
+            std::dynamic_pointer_cast< LagrangeInterpolator< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > > >(
+                existingInterpolator );
+    if( lagrangeInterpolator != nullptr && lagrangeInterpolator->getNumberOfStages( ) == 6 &&
+            lagrangeInterpolator->getLagrangeBoundaryHandling( ) == lagrange_cubic_spline_boundary_interpolation &&
+            lagrangeInterpolator->getBoundaryHandling( ) == throw_exception_at_boundary )
+    {
+        lagrangeInterpolator->resetData( stateTimes, states );
+        return lagrangeInterpolator;
+    }
+    else
+    {
+        return std::make_shared< LagrangeInterpolator< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > > >(
+                    stateTimes, states, 6, huntingAlgorithm, lagrange_cubic_spline_boundary_interpolation,
+                    throw_exception_at_boundary );
+    }
+}
+
 //! Function to reset the tabulated ephemeris of a body
 /*!
- * Function to reset the tabulated ephemeris of a body
- * \param ephemerisInput New state history that is to be set
- * \param tabulatedEphemeris Ephemeris in which the ephemerisInput is to be set.
+ * Function to reset the tabulated ephemeris of a body, reusing its existing interpolator if possible
+ * (see createOrResetStateInterpolator)
+ * \param stateTimes Times of new state history that is to be set
+ * \param states New state history that is to be set
+ * \param tabulatedEphemeris Ephemeris in which the new state history is to be set.
  */
 template< typename StateTimeType, typename StateScalarType, typename EphemerisTimeType, typename EphemerisScalarType  >
 void resetIntegratedEphemerisOfBody(
-        const std::map< StateTimeType, Eigen::Matrix< StateScalarType, 6, 1 > >& ephemerisInput,
+        const std::vector< StateTimeType >& stateTimes,
+        const std::vector< Eigen::Matrix< StateScalarType, 6, 1 > >& states,
         const std::shared_ptr< ephemerides::TabulatedCartesianEphemeris< EphemerisScalarType, EphemerisTimeType > > tabulatedEphemeris )
 {
-    std::map< EphemerisTimeType, Eigen::Matrix< EphemerisScalarType, 6, 1 > > castEphemerisInput;
-    utilities::castMatrixMap< StateTimeType, StateScalarType, EphemerisTimeType, EphemerisScalarType, 6, 1 >(
-                ephemerisInput, castEphemerisInput );
-    
-    std::shared_ptr< interpolators::OneDimensionalInterpolator< EphemerisTimeType, Eigen::Matrix< EphemerisScalarType, 6, 1 > > >
-            ephemerisInterpolator = createStateInterpolator( castEphemerisInput );
-    tabulatedEphemeris->resetInterpolator( ephemerisInterpolator );
+    std::vector< EphemerisTimeType > castStateTimes( stateTimes.size( ) );
+    std::vector< Eigen::Matrix< EphemerisScalarType, 6, 1 > > castStates( states.size( ) );
+    for( unsigned int i = 0; i < stateTimes.size( ); i++ )
+    {
+        castStateTimes[ i ] = static_cast< EphemerisTimeType >( stateTimes[ i ] );
+        castStates[ i ] = states[ i ].template cast< EphemerisScalarType >( );
+    }
+
+    tabulatedEphemeris->resetInterpolator(
+                createOrResetStateInterpolator( castStateTimes, castStates, tabulatedEphemeris->getInterpolator( ) ) );
+}
+
+//! Function to reset the Chebyshev ephemeris of a body
+/*!
+ * Function to reset the Chebyshev ephemeris of a body, by refitting its segments to the new state history
+ * \param stateTimes Times of new state history that is to be set
+ * \param states New state history that is to be set
+ * \param chebyshevEphemeris Ephemeris in which the new state history is to be set.
+ */
+template< typename StateTimeType, typename StateScalarType >
+void resetIntegratedEphemerisOfBody(
+        const std::vector< StateTimeType >& stateTimes,
+        const std::vector< Eigen::Matrix< StateScalarType, 6, 1 > >& states,
+        const std::shared_ptr< ephemerides::ChebyshevCartesianEphemeris > chebyshevEphemeris )
+{
+    std::map< double, Eigen::Vector6d > castEphemerisInput;
+    for( unsigned int i = 0; i < stateTimes.size( ); i++ )
+    {
+        castEphemerisInput[ static_cast< double >( stateTimes[ i ] ) ] = states[ i ].template cast< double >( );
+    }
+    chebyshevEphemeris->resetStateHistory( castEphemerisInput );
 }
 
 //! Function to reset the tabulated ephemeris of a body
 /*!
  * Function to reset the tabulated ephemeris of a body, this requires the requested body to possess
- * an ephemeris of type TabulatedCartesianEphemeris< StateScalarType, TimeType >
+ * an ephemeris of type TabulatedCartesianEphemeris< StateScalarType, TimeType > (or another tabulated ephemeris type,
+ * such as a ChebyshevCartesianEphemeris). The interpolator of an existing tabulated ephemeris is reset in place, if
+ * possible (see createOrResetStateInterpolator).
  * \param bodies List of bodies used in simulations.
- * \param ephemerisInput New state history of the body
+ * \param stateTimes Times of new state history of the body (sorted in ascending order)
+ * \param states New state history of the body
  * \param bodyToIntegrate Name of body for which the ephemeris is to be reset.
  */
 template< typename TimeType, typename StateScalarType >
 void resetIntegratedEphemerisOfBody(
         const simulation_setup::SystemOfBodies& bodies,
-        const std::map< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > >& ephemerisInput,
+        const std::vector< TimeType >& stateTimes,
+        const std::vector< Eigen::Matrix< StateScalarType, 6, 1 > >& states,
         const std::string& bodyToIntegrate )
 {
     using namespace tudat::interpolators;
@@ -129,15 +200,21 @@ void resetIntegratedEphemerisOfBody(
     // Else, update existing tabulated ephemeris
     else
     {
-        if( std::dynamic_pointer_cast< TabulatedCartesianEphemeris< StateScalarType, TimeType > >(
+        if( std::dynamic_pointer_cast< ChebyshevCartesianEphemeris >(
+                    bodies.at( bodyToIntegrate )->getEphemeris( ) ) != nullptr )
+        {
+            resetIntegratedEphemerisOfBody(
+                        stateTimes, states, std::dynamic_pointer_cast< ChebyshevCartesianEphemeris >(
+                            bodies.at( bodyToIntegrate )->getEphemeris( ) ) );
+        }
+        else if( std::dynamic_pointer_cast< TabulatedCartesianEphemeris< StateScalarType, TimeType > >(
                     bodies.at( bodyToIntegrate )->getEphemeris( ) ) != nullptr )
         {
-            std::shared_ptr< OneDimensionalInterpolator< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > > >
-                    ephemerisInterpolator = createStateInterpolator( ephemerisInput );
             std::shared_ptr< TabulatedCartesianEphemeris< StateScalarType, TimeType > > tabulatedEphemeris =
                     std::dynamic_pointer_cast< TabulatedCartesianEphemeris< StateScalarType, TimeType > >(
                         bodies.at( bodyToIntegrate )->getEphemeris( ) );
-            tabulatedEphemeris->resetInterpolator( ephemerisInterpolator );
+            tabulatedEphemeris->resetInterpolator(
+                        createOrResetStateInterpolator( stateTimes, states, tabulatedEphemeris->getInterpolator( ) ) );
         }
         else
         {
@@ -145,28 +222,28 @@ void resetIntegratedEphemerisOfBody(
                         bodies.at( bodyToIntegrate )->getEphemeris( ) ) != nullptr )
             {
                 resetIntegratedEphemerisOfBody(
-                            ephemerisInput, std::dynamic_pointer_cast< TabulatedCartesianEphemeris< double, double > >(
+                            stateTimes, states, std::dynamic_pointer_cast< TabulatedCartesianEphemeris< double, double > >(
                                 bodies.at( bodyToIntegrate )->getEphemeris( ) ) );
             }
             else if( std::dynamic_pointer_cast< TabulatedCartesianEphemeris< long double, double > >(
                          bodies.at( bodyToIntegrate )->getEphemeris( ) ) != nullptr )
             {
                 resetIntegratedEphemerisOfBody(
-                            ephemerisInput, std::dynamic_pointer_cast< TabulatedCartesianEphemeris< long double, double > >(
+                            stateTimes, states, std::dynamic_pointer_cast< TabulatedCartesianEphemeris< long double, double > >(
                                 bodies.at( bodyToIntegrate )->getEphemeris( ) ) );
             }
             else if( std::dynamic_pointer_cast< TabulatedCartesianEphemeris< double, Time > >(
                          bodies.at( bodyToIntegrate )->getEphemeris( ) ) != nullptr )
             {
                 resetIntegratedEphemerisOfBody(
-                            ephemerisInput, std::dynamic_pointer_cast< TabulatedCartesianEphemeris< double, Time > >(
+                            stateTimes, states, std::dynamic_pointer_cast< TabulatedCartesianEphemeris< double, Time > >(
                                 bodies.at( bodyToIntegrate )->getEphemeris( ) ) );
             }
             else if( std::dynamic_pointer_cast< TabulatedCartesianEphemeris< long double, Time > >(
                          bodies.at( bodyToIntegrate )->getEphemeris( ) ) != nullptr )
             {
                 resetIntegratedEphemerisOfBody(
-                            ephemerisInput, std::dynamic_pointer_cast< TabulatedCartesianEphemeris< long double, Time > >(
+                            stateTimes, states, std::dynamic_pointer_cast< TabulatedCartesianEphemeris< long double, Time > >(
                                 bodies.at( bodyToIntegrate )->getEphemeris( ) ) );
             }
             else
@@ -177,6 +254,24 @@ void resetIntegratedEphemerisOfBody(
     }
 }
 
+//! Function to reset the tabulated ephemeris of a body
+/*!
+ * Function to reset the tabulated ephemeris of a body from a state history map (see overload with vector input)
+ * \param bodies List of bodies used in simulations.
+ * \param ephemerisInput New state history of the body
+ * \param bodyToIntegrate Name of body for which the ephemeris is to be reset.
+ */
+template< typename TimeType, typename StateScalarType >
+void resetIntegratedEphemerisOfBody(
+        const simulation_setup::SystemOfBodies& bodies,
+        const std::map< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > >& ephemerisInput,
+        const std::string& bodyToIntegrate )
+{
+    resetIntegratedEphemerisOfBody(
+                bodies, utilities::createVectorFromMapKeys( ephemerisInput ), utilities::createVectorFromMapValues( ephemerisInput ),
+                bodyToIntegrate );
+}
+
 //! Function to convert output of translational motion to input for the ephemeris.
 /*!
  * Function to convert output of translational motion from the numerical integrator to the required
@@ -227,32 +322,70 @@ void convertNumericalSolutionToEphemerisInput(
     }
 }
 
-//! Function to extract the numerical solution for the translational dynamics of a single body from full propagation history.
+//! Function to convert output of translational motion to input for the ephemeris, as contiguous vectors.
 /*!
- * Function to extract the numerical solution for the translational dynamics of a single body from full propagation history.
- * Function can perform frame translation if required.
- * \param bodiesToIntegrate List of names of bodies which are numericall integrated (in the order in
- * which they are in the equationsOfMotionNumericalSolution map.
- * \param translationalStateStartIndex Index in entries of equationsOfMotionNumericalSolution where the translational states start
- * \param bodyForWhichToRetrieveState Name of body for which the states are to be extracted
- * \param equationsOfMotionNumericalSolution Numerical solution of dynamics, with translational results in Cartesian elements
- * w.r.t. integratation origins.
- * \param ephemerisInput State history of requested body (returned by reference)
+ * Function to convert output of translational motion to input for the ephemeris, as the function with map output, but
+ * storing the times and states in separate vectors. The vectors are resized as needed, so that their storage may be
+ * reused for subsequent calls.
+ * \param bodyIndex Index of integrated body for which the state is to be retrieved
+ * \param startIndex Index in entries of equationsOfMotionNumericalSolution where the translational states start.
+ * \param equationsOfMotionNumericalSolution Full numerical solution of numerical integrator,
+ * already converted to Cartesian states (w.r.t. the integration origin of the body of bodyIndex)
+ * \param ephemerisTimes Times of state history of body bodyIndex (returned by reference).
+ * \param ephemerisStates State history of body bodyIndex w.r.t. the origin with which its ephemeris is defined
+ * (returned by reference).
+ * \param integrationToEphemerisFrameFunction Function to provide the state of the ephemeris origin
+ * of the current body w.r.t. its integration origin.
+*/
+template< typename TimeType, typename StateScalarType >
+void convertNumericalSolutionToEphemerisInput(
+        const int bodyIndex,
+        const int startIndex,
+        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >&
+        equationsOfMotionNumericalSolution,
+        std::vector< TimeType >& ephemerisTimes,
+        std::vector< Eigen::Matrix< StateScalarType, 6, 1 > >& ephemerisStates,
+        const std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) >
+        integrationToEphemerisFrameFunction = nullptr )
+{
+    ephemerisTimes.resize( equationsOfMotionNumericalSolution.size( ) );
+    ephemerisStates.resize( equationsOfMotionNumericalSolution.size( ) );
+
+    int currentIndex = 0;
+    for( typename std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >::const_iterator
+         bodyIterator = equationsOfMotionNumericalSolution.begin( );
+         bodyIterator != equationsOfMotionNumericalSolution.end( ); bodyIterator++ )
+    {
+        ephemerisTimes[ currentIndex ] = bodyIterator->first;
+        ephemerisStates[ currentIndex ] = bodyIterator->second.block( startIndex + 6 * bodyIndex, 0, 6, 1 );
+
+        // Add required translation from integrationToEphemerisFrameFunction
+        if( integrationToEphemerisFrameFunction != nullptr )
+        {
+            ephemerisStates[ currentIndex ] -= integrationToEphemerisFrameFunction( bodyIterator->first );
+        }
+        currentIndex++;
+    }
+}
+
+//! Function to retrieve the index of a body in the list of propagated bodies, and its ephemeris frame function.
+/*!
+ * Function to retrieve the index of a body in the list of propagated bodies, and the function providing the state of its
+ * ephemeris origin w.r.t. its integration origin (if any).
+ * \param bodiesToIntegrate List of names of bodies which are numerically integrated
+ * \param bodyForWhichToRetrieveState Name of body for which the index and function are to be retrieved
  * \param bodyIndex Index of bodyForWhichToRetrieveState in bodiesToIntegrate (returned by reference)
  * \param integrationToEphemerisFrameFunctions Function to provide the states of the ephemeris
  * origins of each body w.r.t. their respective integration origins.
+ * \return Function providing state of ephemeris origin of body w.r.t. its integration origin (nullptr if not required)
  */
 template< typename TimeType, typename StateScalarType >
-void getSingleBodyStateHistoryFromPropagationOutpiut(
+std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > getIntegrationToEphemerisFrameFunctionOfBody(
         const std::vector< std::string >& bodiesToIntegrate,
-        const int translationalStateStartIndex,
         const std::string& bodyForWhichToRetrieveState,
-        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution,
-        std::map< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > >& ephemerisInput,
         int& bodyIndex,
         const std::map< std::string, std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >&
-        integrationToEphemerisFrameFunctions =
-        std::map< std::string, std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >( ) )
+        integrationToEphemerisFrameFunctions )
 {
     // Get index of current body to be updated in bodiesToIntegrate.
     std::vector< std::string >::const_iterator bodyFindIterator = std::find(
@@ -271,12 +404,85 @@ void getSingleBodyStateHistoryFromPropagationOutpiut(
         integrationToEphemerisFrameFunction =
                 integrationToEphemerisFrameFunctions.at( bodiesToIntegrate.at( bodyIndex ) );
     }
-    
+
+    return integrationToEphemerisFrameFunction;
+}
+
+//! Function to extract the numerical solution for the translational dynamics of a single body from full propagation history.
+/*!
+ * Function to extract the numerical solution for the translational dynamics of a single body from full propagation history.
+ * Function can perform frame translation if required.
+ * \param bodiesToIntegrate List of names of bodies which are numericall integrated (in the order in
+ * which they are in the equationsOfMotionNumericalSolution map.
+ * \param translationalStateStartIndex Index in entries of equationsOfMotionNumericalSolution where the translational states start
+ * \param bodyForWhichToRetrieveState Name of body for which the states are to be extracted
+ * \param equationsOfMotionNumericalSolution Numerical solution of dynamics, with translational results in Cartesian elements
+ * w.r.t. integratation origins.
+ * \param ephemerisInput State history of requested body (returned by reference)
+ * \param bodyIndex Index of bodyForWhichToRetrieveState in bodiesToIntegrate (returned by reference)
+ * \param integrationToEphemerisFrameFunctions Function to provide the states of the ephemeris
+ * origins of each body w.r.t. their respective integration origins.
+ */
+template< typename TimeType, typename StateScalarType >
+void getSingleBodyStateHistoryFromPropagationOutpiut(
+        const std::vector< std::string >& bodiesToIntegrate,
+        const int translationalStateStartIndex,
+        const std::string& bodyForWhichToRetrieveState,
+        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution,
+        std::map< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > >& ephemerisInput,
+        int& bodyIndex,
+        const std::map< std::string, std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >&
+        integrationToEphemerisFrameFunctions =
+        std::map< std::string, std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >( ) )
+{
+    std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > integrationToEphemerisFrameFunction =
+            getIntegrationToEphemerisFrameFunctionOfBody(
+                bodiesToIntegrate, bodyForWhichToRetrieveState, bodyIndex, integrationToEphemerisFrameFunctions );
+
     // Create and reset interpolator.
     convertNumericalSolutionToEphemerisInput(
                 bodyIndex, translationalStateStartIndex, equationsOfMotionNumericalSolution, ephemerisInput, integrationToEphemerisFrameFunction );
 }
 
+//! Function to extract the numerical solution for the translational dynamics of a single body, as contiguous vectors.
+/*!
+ * Function to extract the numerical solution for the translational dynamics of a single body from full propagation history,
+ * as the function with map output, but storing the times and states in separate vectors (see
+ * convertNumericalSolutionToEphemerisInput).
+ * \param bodiesToIntegrate List of names of bodies which are numericall integrated (in the order in
+ * which they are in the equationsOfMotionNumericalSolution map.
+ * \param translationalStateStartIndex Index in entries of equationsOfMotionNumericalSolution where the translational states start
+ * \param bodyForWhichToRetrieveState Name of body for which the states are to be extracted
+ * \param equationsOfMotionNumericalSolution Numerical solution of dynamics, with translational results in Cartesian elements
+ * w.r.t. integratation origins.
+ * \param ephemerisTimes Times of state history of requested body (returned by reference)
+ * \param ephemerisStates State history of requested body (returned by reference)
+ * \param bodyIndex Index of bodyForWhichToRetrieveState in bodiesToIntegrate (returned by reference)
+ * \param integrationToEphemerisFrameFunctions Function to provide the states of the ephemeris
+ * origins of each body w.r.t. their respective integration origins.
+ */
+template< typename TimeType, typename StateScalarType >
+void getSingleBodyStateHistoryFromPropagationOutpiut(
+        const std::vector< std::string >& bodiesToIntegrate,
+        const int translationalStateStartIndex,
+        const std::string& bodyForWhichToRetrieveState,
+        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution,
+        std::vector< TimeType >& ephemerisTimes,
+        std::vector< Eigen::Matrix< StateScalarType, 6, 1 > >& ephemerisStates,
+        int& bodyIndex,
+        const std::map< std::string, std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >&
+        integrationToEphemerisFrameFunctions =
+        std::map< std::string, std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >( ) )
+{
+    std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > integrationToEphemerisFrameFunction =
+            getIntegrationToEphemerisFrameFunctionOfBody(
+                bodiesToIntegrate, bodyForWhichToRetrieveState, bodyIndex, integrationToEphemerisFrameFunctions );
+
+    convertNumericalSolutionToEphemerisInput(
+                bodyIndex, translationalStateStartIndex, equationsOfMotionNumericalSolution, ephemerisTimes, ephemerisStates,
+                integrationToEphemerisFrameFunction );
+}
+
 //! Create and reset ephemerides interpolator
 /*!
  * Creates and resets the interpolator for the ephemerides of the integrated bodies from the
@@ -304,25 +510,27 @@ void createAndSetInterpolatorsForEphemerides(
 {
     using namespace tudat::interpolators;
     
-    std::map< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > > ephemerisInput;
+    // Create contiguous ephemeris input, storage is reused for all bodies
+    std::vector< TimeType > ephemerisTimes;
+    std::vector< Eigen::Matrix< StateScalarType, 6, 1 > > ephemerisStates;
     int bodyIndex;
     
-    // Iterate over all bodies that are integrated numerically and create state interpolator.
+    // Iterate over all bodies that are integrated numerically and create (or reset) state interpolator.
     for( unsigned int i = 0; i < ephemerisUpdateOrder.size( ); i++ )
     {
-        ephemerisInput.clear( );
         getSingleBodyStateHistoryFromPropagationOutpiut(
                     bodiesToIntegrate, startIndex, ephemerisUpdateOrder.at( i ), equationsOfMotionNumericalSolution,
-                    ephemerisInput, bodyIndex, integrationToEphemerisFrameFunctions );
+                    ephemerisTimes, ephemerisStates, bodyIndex, integrationToEphemerisFrameFunctions );
         resetIntegratedEphemerisOfBody(
-                    bodies, ephemerisInput, bodiesToIntegrate.at( bodyIndex ) );
+                    bodies, ephemerisTimes, ephemerisStates, bodiesToIntegrate.at( bodyIndex ) );
     }
 }
 
 //! Resets the ephemerides of the integrated bodies from the numerical integration results.
 /*!
  * Resets the ephemerides of the integrated bodies from the numerical integration results, and
- * performs associated computation for ephemeris-dependent environment variables.
+ * performs associated computation for ephemeris-dependent environment variables. The interpolators of existing tabulated
+ * ephemerides are reset in place, if possible (see createOrResetStateInterpolator).
  * \param bodies List of bodies used in simulations.
  * \param bodiesToIntegrate List of names of bodies which are numerically integrated (in the order in
  * which they are in the equationsOfMotionNumericalSolution map.
@@ -377,7 +585,8 @@ void resetIntegratedEphemerides(
 //! Resets the ephemerides of the integrated bodies from the numerical multi-arc integration results.
 /*!
  * Resets the ephemerides of the integrated bodies from the numerical multi-arc integration results, and
- * performs associated computation for ephemeris-dependent environment variables.
+ * performs associated computation for ephemeris-dependent environment variables. The tabulated arc ephemerides that are
+ * already set for a body are reused, with their interpolators reset in place (see createOrResetStateInterpolator).
  * \param bodies List of bodies used in simulations.
  * \param equationsOfMotionNumericalSolution Numerical multi-arc solution of translational equations of
  * motion, in Cartesian elements w.r.t. integratation origins (one vector entry represents one arc).
@@ -437,6 +646,13 @@ void resetMultiArcIntegratedEphemerides(
     std::map< std::string, std::vector< std::shared_ptr< Ephemeris > > > arcEphemerisListPerBody;
     std::map< std::string, std::vector< double > > arcStartingTimesPerBody;
     std::map< std::string, int > counterArcPerBody;
+
+    // Arc ephemerides set before this update, which are reset in place if possible
+    std::map< std::string, std::vector< std::shared_ptr< Ephemeris > > > previousArcEphemerisListPerBody;
+
+    // Create contiguous ephemeris input, storage is reused for all arcs and bodies
+    std::vector< TimeType > currentArcTimes;
+    std::vector< Eigen::Matrix< StateScalarType, 6, 1 > > currentArcStates;
     for ( unsigned int arc = 0 ; arc < arcStartTimes.size( ) ; arc++ )
     {
         for ( unsigned int i = 0 ; i < ephemerisUpdateOrder.at( arc ).size( ) ; i++ )
@@ -466,6 +682,11 @@ void resetMultiArcIntegratedEphemerides(
                 throw std::runtime_error("Error when resetting ephemeris of body " + bodiesToIntegrate.at( arc ).at( bodyIndex ) +
                                          ", original ephemeris is of incompatible type");
             }
+            if( counterArcCurrentBody == 0 )
+            {
+                previousArcEphemerisListPerBody[ bodiesToIntegrate.at( arc ).at( bodyIndex ) ] =
+                        currentBodyEphemeris->getSingleArcEphemerides( );
+            }
 
             //            std::vector<std::shared_ptr<Ephemeris> > arcEphemerisList;
             //            for ( unsigned int j = 0; j < arcStartTimes.size( ); j++ )
@@ -483,19 +704,38 @@ void resetMultiArcIntegratedEphemerides(
                 }
             }
 
-            std::map<TimeType, Eigen::Matrix<StateScalarType, 6, 1> > currentArcSolution;
             convertNumericalSolutionToEphemerisInput(
                         bodyIndex, startIndexAndSize.first,
-                        equationsOfMotionNumericalSolution.at( arc ), currentArcSolution, integrationToEphemerisFrameFunction );
-
-            // Create interpolator.
-            std::shared_ptr<OneDimensionalInterpolator< TimeType, Eigen::Matrix<StateScalarType, 6, 1 > > >
-                    ephemerisInterpolator = createStateInterpolator( currentArcSolution );
+                        equationsOfMotionNumericalSolution.at( arc ), currentArcTimes, currentArcStates,
+                        integrationToEphemerisFrameFunction );
+
+            // Reset interpolator of previous arc ephemeris in place if possible, create new arc ephemeris otherwise.
+            const std::vector< std::shared_ptr< Ephemeris > >& previousArcEphemerides =
+                    previousArcEphemerisListPerBody.at( bodiesToIntegrate.at( arc ).at( bodyIndex ) );
+            std::shared_ptr< TabulatedCartesianEphemeris< StateScalarType, TimeType > > previousArcEphemeris;
+            if( counterArcCurrentBody < static_cast< int >( previousArcEphemerides.size( ) ) )
+            {
+                previousArcEphemeris = std::dynamic_pointer_cast< TabulatedCartesianEphemeris< StateScalarType, TimeType > >(
+                            previousArcEphemerides.at( counterArcCurrentBody ) );
+            }
 
-            arcEphemerisListPerBody[ bodiesToIntegrate.at( arc ).at( bodyIndex ) ].push_back(
-                        std::make_shared< TabulatedCartesianEphemeris< StateScalarType, TimeType > >(
-                            ephemerisInterpolator, currentBodyEphemeris->getReferenceFrameOrigin( ),
-                            currentBodyEphemeris->getReferenceFrameOrientation( ) ) );
+            if( previousArcEphemeris != nullptr &&
+                    previousArcEphemeris->getReferenceFrameOrigin( ) == currentBodyEphemeris->getReferenceFrameOrigin( ) &&
+                    previousArcEphemeris->getReferenceFrameOrientation( ) == currentBodyEphemeris->getReferenceFrameOrientation( ) )
+            {
+                previousArcEphemeris->resetInterpolator(
+                            createOrResetStateInterpolator( currentArcTimes, currentArcStates,
+                                                            previousArcEphemeris->getInterpolator( ) ) );
+                arcEphemerisListPerBody[ bodiesToIntegrate.at( arc ).at( bodyIndex ) ].push_back( previousArcEphemeris );
+            }
+            else
+            {
+                arcEphemerisListPerBody[ bodiesToIntegrate.at( arc ).at( bodyIndex ) ].push_back(
+                            std::make_shared< TabulatedCartesianEphemeris< StateScalarType, TimeType > >(
+                                createOrResetStateInterpolator( currentArcTimes, currentArcStates ),
+                                currentBodyEphemeris->getReferenceFrameOrigin( ),
+                                currentBodyEphemeris->getReferenceFrameOrientation( ) ) );
+            }
 
             arcStartingTimesPerBody[ bodiesToIntegrate.at( arc ).at( bodyIndex ) ].push_back( arcStartTimes.at( arc ) );
 
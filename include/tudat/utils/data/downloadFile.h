@@ -8,16 +8,72 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#ifndef TUDAT_DOWNLOAD_FILE_H
+#define TUDAT_DOWNLOAD_FILE_H
+
+#include <future>
+#include <string>
+#include <vector>
+
 namespace tudat {
 namespace utils {
 namespace data {
 
+// Download a file to the local data directory (prefix, default homedir/.tudat),
+// and return the path to the file (or to the extracted directory for zip files).
+//
+// Downloads are written to a temporary '.part' file, which is resumed if a
+// previous download was interrupted, and renamed once complete. Access to each
+// file is locked, so that the same file can safely be requested by several
+// threads and processes at once. If an expected SHA-256 checksum (hex) is
+// given, the downloaded file is validated against it, and the file is also
+// stored in a content-addressed cache (prefix/.content), from which files with
+// the same checksum are retrieved without downloading.
 std::string download_file(const char *remote_url,
                           const char *cache = "true",
                           int verbosity = 1,
                           bool try_unzip = true,
-                          const char *prefix = nullptr);
+                          const char *prefix = nullptr,
+                          const char *sha256 = nullptr);
+
+// Description of a single file that is to be downloaded by download_files.
+struct download_request {
+    // URL of the file.
+    std::string remote_url;
+
+    // Expected SHA-256 checksum (hex) of the file, not checked if empty.
+    std::string sha256 = "";
+
+    // Whether to extract the file if it is a zip file.
+    bool try_unzip = true;
+};
+
+// Download a list of files concurrently (see download_file), and return the
+// paths to the files, in the order of the requests. If any of the downloads
+// fails, the other downloads are completed, after which an exception is
+// thrown.
+std::vector<std::string> download_files(
+    const std::vector<download_request> &requests,
+    const char *cache = "true",
+    int verbosity = 1,
+    int number_of_threads = 4,
+    const char *prefix = nullptr);
+
+// Start downloading a list of files in the background (see download_files),
+// for instance before the simulation is set up. The returned future provides
+// the paths to the files once all downloads have completed.
+std::shared_future<std::vector<std::string>> prefetch_files(
+    const std::vector<download_request> &requests,
+    const char *cache = "true",
+    int verbosity = 0,
+    int number_of_threads = 4,
+    const char *prefix = nullptr);
+
+// Compute the SHA-256 checksum (hex) of a file.
+std::string compute_sha256(const std::string &file_name);
 
 } // namespace data
 } // namespace utils
 } // namespace tudat
+
+#endif // TUDAT_DOWNLOAD_FILE_H
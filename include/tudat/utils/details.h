@@ -14,6 +14,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
+#include <stdexcept>
 #include <string>
 
 #define MAX_PATH 255
@@ -35,17 +36,20 @@ bool file_exists(const char *fileName) {
     return infile.good();
 }
 
-void download_file_from_source(const char *remote_url, const char *filename) {
-    char curl_cmd[1200];
+void download_file_from_source(const char *remote_url, const char *filename,
+                               bool resume = false) {
+    std::string curl_cmd;
     int curl_ret;
 
     // create curl command
-    strcpy(curl_cmd, "curl -o "); // output to filename
-    strcat(curl_cmd, filename);
-    strcat(curl_cmd, " -L ");           // allow follow redirect
-    strcat(curl_cmd, remote_url);       // remote url
-    strcat(curl_cmd, " --create-dirs"); // create directory if not exists
-    curl_ret = system(curl_cmd);
+    curl_cmd = "curl -f -o \"" + std::string(filename) + "\""; // output to filename
+    curl_cmd += " -L";                                         // allow follow redirect
+    if (resume) {
+        curl_cmd += " -C -"; // continue partial download
+    }
+    curl_cmd += " \"" + std::string(remote_url) + "\""; // remote url
+    curl_cmd += " --create-dirs"; // create directory if not exists
+    curl_ret = system(curl_cmd.c_str());
 
     // post download checks
     if (0 != curl_ret) {
@@ -32,6 +32,8 @@ void AerodynamicCoefficientInterface::updateFullCurrentCoefficients(
     const double currentTime,
     const bool addMomentContributionIfPresent )
 {
+    TUDAT_PROFILE_MODEL_EVALUATION( modelEvaluationProfiler_, coefficientUpdateProfilingIndex_ );
+
     updateCurrentCoefficients( independentVariables, currentTime );
 
     if( controlSurfaceIndependentVariables.size( ) != 0 )
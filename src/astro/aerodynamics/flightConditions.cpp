@@ -15,9 +15,12 @@
 
 
 #include "tudat/astro/aerodynamics/aerodynamics.h"
+#include "tudat/astro/aerodynamics/exponentialAtmosphere.h"
 #include "tudat/astro/aerodynamics/flightConditions.h"
 #include "tudat/astro/aerodynamics/standardAtmosphere.h"
 #include "tudat/astro/basic_astro/oblateSpheroidBodyShapeModel.h"
+#include "tudat/astro/basic_astro/sphericalBodyShapeModel.h"
+#include "tudat/math/basic/coordinateConversions.h"
 #include "tudat/math/basic/mathematicalConstants.h"
 
 namespace tudat
@@ -35,7 +38,10 @@ FlightConditions::FlightConditions( const std::shared_ptr< basic_astrodynamics::
     shapeModel_( shapeModel ),
     centralBody_( centralBodyName ),
     aerodynamicAngleCalculator_( aerodynamicAngleCalculator ),
-    currentTime_( TUDAT_NAN )
+    currentTime_( TUDAT_NAN ),
+    useDemandDrivenUpdates_( false ),
+    updateBodyOrientationAngles_( true ),
+    updateAerodynamicCoefficients_( true )
 {
     // Link body-state function.
     bodyCenteredPseudoBodyFixedStateFunction_ = std::bind(
@@ -71,7 +77,7 @@ void FlightConditions::updateConditions( const double currentTime )
         currentBodyCenteredAirspeedBasedBodyFixedState_ = bodyCenteredPseudoBodyFixedStateFunction_( );
 
         // Update angles from aerodynamic to body-fixed frame (if relevant).
-        if( aerodynamicAngleCalculator_!= nullptr )
+        if( aerodynamicAngleCalculator_!= nullptr && updateBodyOrientationAngles_ )
         {
             aerodynamicAngleCalculator_->update( currentTime, true );
         }
@@ -138,17 +144,23 @@ void AtmosphericFlightConditions::updateConditions( const double currentTime )
         // Calculate state of vehicle in global frame and corotating frame.
         currentBodyCenteredAirspeedBasedBodyFixedState_ = bodyCenteredPseudoBodyFixedStateFunction_( );
 
-        updateAerodynamicCoefficientInput( );
+        if( updateAerodynamicCoefficients_ )
+        {
+            updateAerodynamicCoefficientInput( );
+        }
 
         // Update angles from aerodynamic to body-fixed frame (if relevant).
-        if( aerodynamicAngleCalculator_!= nullptr )
+        if( aerodynamicAngleCalculator_!= nullptr && updateBodyOrientationAngles_ )
         {
             aerodynamicAngleCalculator_->update( currentTime, true );
-            updateAerodynamicCoefficientInput( );
+            if( updateAerodynamicCoefficients_ )
+            {
+                updateAerodynamicCoefficientInput( );
+            }
         }
 
         // Update aerodynamic coefficients.
-        if( aerodynamicCoefficientInterface_ != nullptr )
+        if( aerodynamicCoefficientInterface_ != nullptr && updateAerodynamicCoefficients_ )
         {
             aerodynamicCoefficientInterface_->updateFullCurrentCoefficients(
                         aerodynamicCoefficientIndependentVariables_, controlSurfaceAerodynamicCoefficientIndependentVariables_,
@@ -173,6 +185,47 @@ void AtmosphericFlightConditions::updateAtmosphereInput( )
 }
 
 
+//! Function to compute the gradient of the current density w.r.t. the body-fixed position of the vehicle
+Eigen::Vector3d AtmosphericFlightConditions::getCurrentDensityGradient( const double positionPerturbation )
+{
+    Eigen::Vector3d currentPosition = currentBodyCenteredAirspeedBasedBodyFixedState_.segment( 0, 3 );
+    Eigen::Vector3d densityGradient;
+
+    std::shared_ptr< ExponentialAtmosphere > exponentialAtmosphere =
+            std::dynamic_pointer_cast< ExponentialAtmosphere >( atmosphereModel_ );
+    if( exponentialAtmosphere != nullptr &&
+            std::dynamic_pointer_cast< basic_astrodynamics::SphericalBodyShapeModel >( shapeModel_ ) != nullptr )
+    {
+        // Density only depends on altitude, which changes along radial direction
+        densityGradient = -getCurrentDensity( ) / exponentialAtmosphere->getScaleHeight( ) * currentPosition.normalized( );
+    }
+    else
+    {
+        // Compute gradient by central difference of atmosphere model
+        Eigen::Vector3d perturbedPosition, perturbedSphericalPosition;
+        double upperturbedDensity, downperturbedDensity;
+        for( unsigned int i = 0; i < 3; i++ )
+        {
+            perturbedPosition = currentPosition;
+            perturbedPosition( i ) += positionPerturbation;
+            perturbedSphericalPosition = coordinate_conversions::convertCartesianToSpherical< double >( perturbedPosition );
+            upperturbedDensity = atmosphereModel_->getDensity(
+                        shapeModel_->getAltitude( perturbedPosition ), perturbedSphericalPosition( 2 ),
+                        mathematical_constants::PI / 2.0 - perturbedSphericalPosition( 1 ), currentTime_ );
+
+            perturbedPosition = currentPosition;
+            perturbedPosition( i ) -= positionPerturbation;
+            perturbedSphericalPosition = coordinate_conversions::convertCartesianToSpherical< double >( perturbedPosition );
+            downperturbedDensity = atmosphereModel_->getDensity(
+                        shapeModel_->getAltitude( perturbedPosition ), perturbedSphericalPosition( 2 ),
+                        mathematical_constants::PI / 2.0 - perturbedSphericalPosition( 1 ), currentTime_ );
+
+            densityGradient( i ) = ( upperturbedDensity - downperturbedDensity ) / ( 2.0 * positionPerturbation );
+        }
+    }
+    return densityGradient;
+}
+
 //! Function to (compute and) retrieve the value of an independent variable of aerodynamic coefficients
 double AtmosphericFlightConditions::getAerodynamicCoefficientIndependentVariable(
         const AerodynamicCoefficientsIndependentVariables independentVariableType,
@@ -251,18 +304,26 @@ void AtmosphericFlightConditions::updateAerodynamicCoefficientInput( )
                     aerodynamicCoefficientInterface_->getIndependentVariableName( i )));
         }
 
-        controlSurfaceAerodynamicCoefficientIndependentVariables_.clear( );
+        // Update control surface independent variables in place, to prevent reallocation at each update
+        if( controlSurfaceAerodynamicCoefficientIndependentVariables_.size( ) !=
+                aerodynamicCoefficientInterface_->getNumberOfControlSurfaces( ) )
+        {
+            controlSurfaceAerodynamicCoefficientIndependentVariables_.clear( );
+        }
         for ( unsigned int i = 0; i < aerodynamicCoefficientInterface_->getNumberOfControlSurfaces( ); i++ )
         {
-            std::string currentControlSurface = aerodynamicCoefficientInterface_->getControlSurfaceName( i );
-            for ( unsigned int j = 0; j <
-                                      aerodynamicCoefficientInterface_->getNumberOfControlSurfaceIndependentVariables(
-                                          currentControlSurface ); j++ )
+            const std::string& currentControlSurface = aerodynamicCoefficientInterface_->getControlSurfaceName( i );
+            std::vector< double >& currentControlSurfaceIndependentVariables =
+                    controlSurfaceAerodynamicCoefficientIndependentVariables_[ currentControlSurface ];
+            currentControlSurfaceIndependentVariables.resize(
+                        aerodynamicCoefficientInterface_->getNumberOfControlSurfaceIndependentVariables(
+                            currentControlSurface ) );
+            for ( unsigned int j = 0; j < currentControlSurfaceIndependentVariables.size( ); j++ )
             {
-                controlSurfaceAerodynamicCoefficientIndependentVariables_[ currentControlSurface ].push_back(
+                currentControlSurfaceIndependentVariables[ j ] =
                     getAerodynamicCoefficientIndependentVariable(
                         aerodynamicCoefficientInterface_->getControlSurfaceIndependentVariableName(
-                            currentControlSurface, j ), currentControlSurface ));
+                            currentControlSurface, j ), currentControlSurface );
             }
         }
     }
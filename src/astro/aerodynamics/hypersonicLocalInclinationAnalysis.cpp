@@ -26,6 +26,7 @@
 
 #include <Eigen/Geometry>
 
+#include "tudat/basics/parallelization.h"
 #include "tudat/math/basic/mathematicalConstants.h"
 
 #include "tudat/astro/aerodynamics/aerodynamics.h"
@@ -178,16 +179,19 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
         const double referenceArea,
         const double referenceLength,
         const Eigen::Vector3d& momentReferencePoint,
-        const bool savePressureCoefficients )
+        const bool savePressureCoefficients,
+        const int numberOfThreads )
     : AerodynamicCoefficientGenerator< 3, 6 >(
           dataPointsOfIndependentVariables, referenceLength, referenceArea,
           momentReferencePoint, { mach_number_dependent, angle_of_attack_dependent, angle_of_sideslip_dependent },
           positive_aerodynamic_frame_coefficients, positive_aerodynamic_frame_coefficients ),
-      stagnationPressureCoefficient( 2.0 ),
       ratioOfSpecificHeats( 1.4 ),
       selectedMethods_( selectedMethods ),
-      savePressureCoefficients_( savePressureCoefficients )
+      savePressureCoefficients_( savePressureCoefficients ),
+      numberOfThreads_( 1 )
 {
+    setNumberOfThreads( numberOfThreads );
+
     // Set geometry if it is a single surface.
     if ( std::dynamic_pointer_cast< SingleSurfaceGeometry > ( inputVehicleSurface ) !=
          std::shared_ptr< SingleSurfaceGeometry >( ) )
@@ -256,17 +260,50 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
         }
     }
 
-    // Allocate memory for panel inclinations and pressureCoefficient_.
+    if( selectedMethods_.size( ) != 2 || selectedMethods_.at( 0 ).size( ) < vehicleParts_.size( ) ||
+            selectedMethods_.at( 1 ).size( ) < vehicleParts_.size( ) )
+    {
+        throw std::runtime_error( "Error in hypersonic local inclination analysis, selected methods not provided for all " +
+                                  std::to_string( vehicleParts_.size( ) ) + " vehicle parts." );
+    }
+
+    // Allocate memory for panel inclinations.
     inclination_.resize( vehicleParts_.size( ) );
-    pressureCoefficient_.resize( vehicleParts_.size( ) );
     for ( unsigned int i = 0 ; i < vehicleParts_.size( ); i++ )
     {
         inclination_[ i ].resize( vehicleParts_[ i ]->getNumberOfLines( ) );
-        pressureCoefficient_[ i ].resize( vehicleParts_[ i ]->getNumberOfLines( ) );
         for ( int j = 0 ; j < vehicleParts_[ i ]->getNumberOfLines( ) ; j++ )
         {
             inclination_[ i ][ j ].resize( vehicleParts_[ i ]->getNumberOfPoints( ) );
-            pressureCoefficient_[ i ][ j ].resize( vehicleParts_[ i ]->getNumberOfPoints( ) );
+        }
+    }
+
+    // Precompute panel geometry, stored contiguously per part, and the per-panel contributions to the coefficients.
+    panelSurfaceNormals_.resize( vehicleParts_.size( ) );
+    panelForceCoefficientContributions_.resize( vehicleParts_.size( ) );
+    panelMomentCoefficientContributions_.resize( vehicleParts_.size( ) );
+    for ( unsigned int k = 0 ; k < vehicleParts_.size( ); k++ )
+    {
+        int numberOfPanelPoints = vehicleParts_[ k ]->getNumberOfPoints( ) - 1;
+        int numberOfPanels = ( vehicleParts_[ k ]->getNumberOfLines( ) - 1 ) * numberOfPanelPoints;
+        panelSurfaceNormals_[ k ].resize( 3, numberOfPanels );
+        panelForceCoefficientContributions_[ k ].resize( 3, numberOfPanels );
+        panelMomentCoefficientContributions_[ k ].resize( 3, numberOfPanels );
+
+        for ( int i = 0 ; i < vehicleParts_[ k ]->getNumberOfLines( ) - 1 ; i++ )
+        {
+            for ( int j = 0 ; j < numberOfPanelPoints ; j++ )
+            {
+                int panelIndex = i * numberOfPanelPoints + j;
+                double panelArea = vehicleParts_[ k ]->getPanelArea( i, j );
+                panelSurfaceNormals_[ k ].col( panelIndex ) = vehicleParts_[ k ]->getPanelSurfaceNormal( i, j );
+                panelForceCoefficientContributions_[ k ].col( panelIndex ) =
+                        -panelArea * panelSurfaceNormals_[ k ].col( panelIndex ) / referenceArea_;
+                panelMomentCoefficientContributions_[ k ].col( panelIndex ) =
+                        -panelArea * ( vehicleParts_[ k ]->getPanelCentroid( i, j ) - momentReferencePoint_ ).cross(
+                            Eigen::Vector3d( panelSurfaceNormals_[ k ].col( panelIndex ) ) ) /
+                        ( referenceLength_ * referenceArea_ );
+            }
         }
     }
 
@@ -278,6 +315,11 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
     }
 
     isCoefficientGenerated_.resize( numberOfPointsPerIndependentVariables );
+    partCoefficients_.resize( vehicleParts_.size( ) );
+    for ( unsigned int i = 0 ; i < vehicleParts_.size( ); i++ )
+    {
+        partCoefficients_[ i ].resize( numberOfPointsPerIndependentVariables );
+    }
 
     std::fill( isCoefficientGenerated_.origin( ),
                isCoefficientGenerated_.origin( ) + isCoefficientGenerated_.num_elements( ), 0 );
@@ -299,30 +341,135 @@ Vector6d HypersonicLocalInclinationAnalysis::getAerodynamicCoefficientsDataPoint
     return aerodynamicCoefficients_( independentVariables );
 }
 
+//! Function to reset the local inclination methods of a single vehicle part.
+void HypersonicLocalInclinationAnalysis::setSelectedMethods(
+        const int partNumber, const int compressionMethod, const int expansionMethod )
+{
+    if( partNumber < 0 || partNumber >= static_cast< int >( vehicleParts_.size( ) ) )
+    {
+        throw std::runtime_error( "Error when setting local inclination methods, part number " +
+                                  std::to_string( partNumber ) + " does not exist." );
+    }
+
+    if( selectedMethods_[ 0 ][ partNumber ] != compressionMethod ||
+            selectedMethods_[ 1 ][ partNumber ] != expansionMethod )
+    {
+        selectedMethods_[ 0 ][ partNumber ] = compressionMethod;
+        selectedMethods_[ 1 ][ partNumber ] = expansionMethod;
+
+        // Recompute contribution of modified part only, and update database.
+        computePartCoefficients( { partNumber } );
+        sumPartCoefficients( );
+        createInterpolator( );
+    }
+}
+
+//! Function to set the number of threads over which the coefficient evaluation is distributed.
+void HypersonicLocalInclinationAnalysis::setNumberOfThreads( const int numberOfThreads )
+{
+    if( numberOfThreads < 1 )
+    {
+        throw std::runtime_error( "Error when setting number of threads of hypersonic local inclination analysis: number (" +
+                                  std::to_string( numberOfThreads ) + ") must be at least 1." );
+    }
+    numberOfThreads_ = numberOfThreads;
+}
+
 //! Generate aerodynamic database.
 void HypersonicLocalInclinationAnalysis::generateCoefficients( )
 {
-    // Allocate variable to pass to coefficient determination for independent
-    // variable indices.
-    boost::array< int, 3 > independentVariableIndices;
+    // Allocate containers for pressure coefficients before distributing computations over threads.
+    if( savePressureCoefficients_ )
+    {
+        std::vector< std::vector< std::vector< double > > > emptyPressureCoefficients( vehicleParts_.size( ) );
+        for ( unsigned int i = 0 ; i < vehicleParts_.size( ); i++ )
+        {
+            emptyPressureCoefficients[ i ].resize(
+                        vehicleParts_[ i ]->getNumberOfLines( ),
+                        std::vector< double >( vehicleParts_[ i ]->getNumberOfPoints( ), 0.0 ) );
+        }
+
+        boost::array< int, 3 > independentVariableIndices;
+        for ( unsigned int i = 0 ; i < dataPointsOfIndependentVariables_[ 0 ].size( ) ; i++ )
+        {
+            independentVariableIndices[ 0 ] = i;
+            for ( unsigned int j = 0 ; j < dataPointsOfIndependentVariables_[ 1 ].size( ) ; j++ )
+            {
+                independentVariableIndices[ 1 ] = j;
+                for ( unsigned int k = 0 ; k < dataPointsOfIndependentVariables_[ 2 ].size( ) ; k++ )
+                {
+                    independentVariableIndices[ 2 ] = k;
+                    pressureCoefficientList_[ independentVariableIndices ] = emptyPressureCoefficients;
+                }
+            }
+        }
+    }
+
+    // Compute contributions of all parts, and sum them.
+    std::vector< int > partNumbers;
+    for ( unsigned int i = 0 ; i < vehicleParts_.size( ) ; i++ )
+    {
+        partNumbers.push_back( i );
+    }
+    computePartCoefficients( partNumbers );
+    sumPartCoefficients( );
+}
+
+//! Compute the contributions of a set of vehicle parts to the aerodynamic coefficients.
+void HypersonicLocalInclinationAnalysis::computePartCoefficients( const std::vector< int >& partNumbers )
+{
+    const int numberOfAnglesOfSideslip = dataPointsOfIndependentVariables_[ 2 ].size( );
+    const int numberOfAttitudes = dataPointsOfIndependentVariables_[ 1 ].size( ) * numberOfAnglesOfSideslip;
 
-    // Iterate over all combinations of independent variables.
-    for ( unsigned int i = 0 ; i < dataPointsOfIndependentVariables_[ 0 ].size( ) ; i++ )
+    // Each task handles all Mach numbers at a single combination of angle of attack and sideslip.
+    utilities::executeParallelTasks(
+                numberOfAttitudes, [ & ]( const int attitudeIndex )
     {
-        independentVariableIndices[ 0 ] = i;
-        for ( unsigned  int j = 0 ; j < dataPointsOfIndependentVariables_[
-              1 ].size( ) ; j++ )
+        boost::array< int, 3 > independentVariableIndices;
+        independentVariableIndices[ 1 ] = attitudeIndex / numberOfAnglesOfSideslip;
+        independentVariableIndices[ 2 ] = attitudeIndex % numberOfAnglesOfSideslip;
+
+        double angleOfAttack = dataPointsOfIndependentVariables_[ 1 ][ independentVariableIndices[ 1 ] ];
+        double angleOfSideslip = dataPointsOfIndependentVariables_[ 2 ][ independentVariableIndices[ 2 ] ];
+        Eigen::Vector3d freestreamVelocityDirection(
+                    cos( angleOfAttack ) * cos( angleOfSideslip ),
+                    sin( angleOfSideslip ),
+                    sin( angleOfAttack ) * cos( angleOfSideslip ) );
+
+        Eigen::VectorXd inclinations;
+        Eigen::VectorXd pressureCoefficients;
+        for( unsigned int k = 0; k < partNumbers.size( ); k++ )
         {
-            independentVariableIndices[ 1 ] = j;
-            for ( unsigned  int k = 0 ; k < dataPointsOfIndependentVariables_[
-                  2 ].size( ) ; k++ )
+            const int partNumber = partNumbers.at( k );
+            determinePanelInclinations( partNumber, freestreamVelocityDirection, inclinations );
+
+            for( unsigned int i = 0; i < dataPointsOfIndependentVariables_[ 0 ].size( ); i++ )
             {
-                independentVariableIndices[ 2 ] = k;
+                independentVariableIndices[ 0 ] = i;
+                partCoefficients_[ partNumber ]( independentVariableIndices ) = determinePartCoefficients(
+                            partNumber, dataPointsOfIndependentVariables_[ 0 ][ i ], inclinations, pressureCoefficients );
 
-                determineVehicleCoefficients( independentVariableIndices );
+                if( savePressureCoefficients_ )
+                {
+                    savePartPressureCoefficients( partNumber, independentVariableIndices, pressureCoefficients );
+                }
             }
+        }
+    }, numberOfThreads_ );
+}
 
+//! Sum the contributions of all vehicle parts to the aerodynamic coefficients.
+void HypersonicLocalInclinationAnalysis::sumPartCoefficients( )
+{
+    for( unsigned int i = 0; i < aerodynamicCoefficients_.num_elements( ); i++ )
+    {
+        Vector6d coefficients = Vector6d::Zero( );
+        for ( unsigned int j = 0 ; j < vehicleParts_.size( ) ; j++ )
+        {
+            coefficients += partCoefficients_[ j ].data( )[ i ];
         }
+        aerodynamicCoefficients_.data( )[ i ] = coefficients;
+        isCoefficientGenerated_.data( )[ i ] = 1;
     }
 }
 
@@ -330,19 +477,32 @@ void HypersonicLocalInclinationAnalysis::generateCoefficients( )
 void HypersonicLocalInclinationAnalysis::determineVehicleCoefficients(
         const boost::array< int, 3 > independentVariableIndices )
 {
+    double machNumber = dataPointsOfIndependentVariables_[ 0 ][ independentVariableIndices[ 0 ] ];
+    double angleOfAttack = dataPointsOfIndependentVariables_[ 1 ][ independentVariableIndices[ 1 ] ];
+    double angleOfSideslip = dataPointsOfIndependentVariables_[ 2 ][ independentVariableIndices[ 2 ] ];
+    Eigen::Vector3d freestreamVelocityDirection(
+                cos( angleOfAttack ) * cos( angleOfSideslip ),
+                sin( angleOfSideslip ),
+                sin( angleOfAttack ) * cos( angleOfSideslip ) );
+
     // Declare coefficients vector and initialize to zeros.
     Vector6d coefficients = Vector6d::Zero( );
 
     // Loop over all vehicle parts, calculate aerodynamic coefficients and add
     // to aerodynamicCoefficients_.
+    Eigen::VectorXd inclinations;
+    Eigen::VectorXd pressureCoefficients;
     for ( unsigned int i = 0 ; i < vehicleParts_.size( ) ; i++ )
     {
-        coefficients += determinePartCoefficients( i, independentVariableIndices );
-    }
+        determinePanelInclinations( i, freestreamVelocityDirection, inclinations );
+        partCoefficients_[ i ]( independentVariableIndices ) = determinePartCoefficients(
+                    i, machNumber, inclinations, pressureCoefficients );
+        coefficients += partCoefficients_[ i ]( independentVariableIndices );
 
-    if( savePressureCoefficients_ )
-    {
-        pressureCoefficientList_[ independentVariableIndices ] = pressureCoefficient_;
+        if( savePressureCoefficients_ && pressureCoefficientList_.count( independentVariableIndices ) != 0 )
+        {
+            savePartPressureCoefficients( i, independentVariableIndices, pressureCoefficients );
+        }
     }
 
     aerodynamicCoefficients_( independentVariableIndices ) = coefficients;
@@ -351,167 +511,80 @@ void HypersonicLocalInclinationAnalysis::determineVehicleCoefficients(
 
 //! Determine aerodynamic coefficients of a single vehicle part.
 Vector6d HypersonicLocalInclinationAnalysis::determinePartCoefficients(
-        const int partNumber, const boost::array< int, 3 > independentVariableIndices )
+        const int partNumber, const double machNumber,
+        const Eigen::VectorXd& inclinations, Eigen::VectorXd& pressureCoefficients ) const
 {
-    // Declare and determine angles of attack and sideslip for analysis.
-    double angleOfAttack =  dataPointsOfIndependentVariables_[ 1 ]
-            [ independentVariableIndices[ 1 ] ];
-
-    double angleOfSideslip =  dataPointsOfIndependentVariables_[ 2 ]
-            [ independentVariableIndices[ 2 ] ];
-
-    // Declare partCoefficient vector.
-    Vector6d partCoefficients = Vector6d::Zero( );
+    // Determine pressure coefficients of all panels on part.
+    pressureCoefficients.resize( inclinations.rows( ) );
+    updateCompressionPressures( machNumber, partNumber, inclinations, pressureCoefficients );
+    updateExpansionPressures( machNumber, partNumber, inclinations, pressureCoefficients );
 
-    // Check whether the inclinations of the vehicle part have already been computed.
-    if ( previouslyComputedInclinations_.count( std::pair< double, double >(
-                                                    angleOfAttack, angleOfSideslip ) ) == 0 )
-    {
-        // Determine panel inclinations for part.
-        determineInclinations( angleOfAttack, angleOfSideslip );
-
-        // Add panel inclinations to container
-        previouslyComputedInclinations_[ std::pair< double, double >(
-                    angleOfAttack, angleOfSideslip ) ] = inclination_;
-    }
-
-    else
-    {
-        // Fetch inclinations from container
-        inclination_ = previouslyComputedInclinations_[ std::pair< double, double >(
-                    angleOfAttack, angleOfSideslip ) ];
-    }
-
-    // Set pressureCoefficient_ array for given independent variables.
-    determinePressureCoefficients( partNumber, independentVariableIndices );
-
-    // Calculate force coefficients from pressure coefficients.
-    partCoefficients.segment( 0, 3 ) = calculateForceCoefficients( partNumber );
-
-    // Calculate moment coefficients from pressure coefficients.
-    partCoefficients.segment( 3, 3 ) = calculateMomentCoefficients( partNumber );
+    // Calculate force and moment coefficients from pressure coefficients.
+    Vector6d partCoefficients;
+    partCoefficients.segment( 0, 3 ) = panelForceCoefficientContributions_[ partNumber ] * pressureCoefficients;
+    partCoefficients.segment( 3, 3 ) = panelMomentCoefficientContributions_[ partNumber ] * pressureCoefficients;
 
     return partCoefficients;
 }
 
-//! Determine the pressure coefficients on a single vehicle part.
-void HypersonicLocalInclinationAnalysis::determinePressureCoefficients(
-        const int partNumber, const boost::array< int, 3 > independentVariableIndices )
+//! Determine inclination angles of the panels on a given part.
+void HypersonicLocalInclinationAnalysis::determinePanelInclinations(
+        const int partNumber, const Eigen::Vector3d& freestreamVelocityDirection,
+        Eigen::VectorXd& inclinations ) const
 {
-    // Retrieve Mach number.
-    double machNumber = dataPointsOfIndependentVariables_[ 0 ]
-            [ independentVariableIndices[ 0 ] ];
-
-    // Determine stagnation point pressure coefficients. Value is computed once
-    // here to prevent its calculation in inner loop.
-    stagnationPressureCoefficient = computeStagnationPressure(
-                machNumber, ratioOfSpecificHeats );
-
-    updateCompressionPressures( machNumber, partNumber );
-    updateExpansionPressures( machNumber, partNumber );
+    // Determine inclination angles from inner product between surface normals and free-stream direction.
+    inclinations = PI / 2.0 - ( panelSurfaceNormals_[ partNumber ].transpose( ) *
+                                freestreamVelocityDirection ).array( ).acos( );
 }
 
-//! Determine force coefficients from pressure coefficients.
-Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateForceCoefficients(
-        const int partNumber )
+//! Function to save the pressure coefficients of a single part at a single set of independent variables.
+void HypersonicLocalInclinationAnalysis::savePartPressureCoefficients(
+        const int partNumber, const boost::array< int, 3 >& independentVariableIndices,
+        const Eigen::VectorXd& pressureCoefficients )
 {
-    // Declare force coefficient vector and intialize to zeros.
-    Eigen::Vector3d forceCoefficients = Eigen::Vector3d::Zero( );
-
-    // Loop over all panels and add pressures, scaled by panel area, to force
-    // coefficients.
+    std::vector< std::vector< double > >& partPressureCoefficients =
+            pressureCoefficientList_.at( independentVariableIndices ).at( partNumber );
+    int numberOfPanelPoints = vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1;
     for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
     {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++)
+        for ( int j = 0 ; j < numberOfPanelPoints ; j++ )
         {
-            forceCoefficients -=
-                    pressureCoefficient_[ partNumber ][ i ][ j ] *
-                    vehicleParts_[ partNumber ]->getPanelArea( i, j ) *
-                    vehicleParts_[ partNumber ]->getPanelSurfaceNormal( i, j );
+            partPressureCoefficients[ i ][ j ] = pressureCoefficients( i * numberOfPanelPoints + j );
         }
     }
-
-    // Normalize result by reference area.
-    forceCoefficients /= referenceArea_;
-
-    return forceCoefficients;
-}
-
-//! Determine moment coefficients from pressure coefficients.
-Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateMomentCoefficients(
-        const int partNumber )
-{
-    // Declare moment coefficient vector and intialize to zeros.
-    Eigen::Vector3d momentCoefficients = Eigen::Vector3d::Zero( );
-
-    // Declare moment arm for panel moment determination.
-    Eigen::Vector3d referenceDistance;
-
-    // Loop over all panels and add moments due pressures.
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
-    {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
-        {
-            // Determine moment arm for given panel centroid.
-            referenceDistance = ( vehicleParts_[ partNumber ]->getPanelCentroid( i, j ) -
-                                  momentReferencePoint_ );
-
-            momentCoefficients -=
-                    pressureCoefficient_[ partNumber ][ i ][ j ] *
-                    vehicleParts_[ partNumber ]->getPanelArea( i, j ) *
-                    ( referenceDistance.cross( vehicleParts_[ partNumber ]->
-                                               getPanelSurfaceNormal( i, j ) ) );
-        }
-    }
-
-    // Scale result by reference length and area.
-    momentCoefficients /= ( referenceLength_ * referenceArea_ );
-
-    return momentCoefficients;
 }
 
 //! Determines the inclination angle of panels on a single part.
 void HypersonicLocalInclinationAnalysis::determineInclinations( const double angleOfAttack,
                                                                 const double angleOfSideslip )
 {
-    // Declare free-stream velocity vector.
-    Eigen::Vector3d freestreamVelocityDirection;
-
     // Set freestream velocity vector in body frame.
-    double freestreamVelocityDirectionX = cos( angleOfAttack )* cos( angleOfSideslip );
-    double freestreamVelocityDirectionY = sin( angleOfSideslip );
-    double freestreamVelocityDirectionZ = sin( angleOfAttack ) * cos( angleOfSideslip );
-    freestreamVelocityDirection( 0 ) = freestreamVelocityDirectionX;
-    freestreamVelocityDirection( 1 ) = freestreamVelocityDirectionY;
-    freestreamVelocityDirection( 2 ) = freestreamVelocityDirectionZ;
-
-    // Declare cosine of inclination angle.
-    double cosineOfInclination;
+    Eigen::Vector3d freestreamVelocityDirection(
+                cos( angleOfAttack ) * cos( angleOfSideslip ),
+                sin( angleOfSideslip ),
+                sin( angleOfAttack ) * cos( angleOfSideslip ) );
 
-    // Loop over all panels of given vehicle part and set inclination angles.
+    // Loop over all panels of all vehicle parts and set inclination angles.
+    Eigen::VectorXd inclinations;
     for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
     {
+        determinePanelInclinations( k, freestreamVelocityDirection, inclinations );
+
+        int numberOfPanelPoints = vehicleParts_[ k ]->getNumberOfPoints( ) - 1;
         for ( int i = 0 ; i < vehicleParts_[ k ]->getNumberOfLines( ) - 1 ; i++ )
         {
-            for ( int j = 0 ; j < vehicleParts_[ k ]->getNumberOfPoints( ) - 1 ; j++ )
+            for ( int j = 0 ; j < numberOfPanelPoints ; j++ )
             {
-
-                // Determine cosine of inclination angle from inner product between
-                // surface normal and free-stream direction.
-                cosineOfInclination = vehicleParts_[ k ]->
-                        getPanelSurfaceNormal( i, j ).
-                        dot( freestreamVelocityDirection );
-
-                // Set inclination angle.
-                inclination_[ k ][ i ][ j ] = PI / 2.0 - acos( cosineOfInclination );
+                inclination_[ k ][ i ][ j ] = inclinations( i * numberOfPanelPoints + j );
             }
         }
     }
 }
 
 //! Determine compression pressure coefficients on all parts.
-void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const double machNumber,
-                                                                     const int partNumber )
+void HypersonicLocalInclinationAnalysis::updateCompressionPressures(
+        const double machNumber, const int partNumber,
+        const Eigen::VectorXd& inclinations, Eigen::VectorXd& pressureCoefficients ) const
 {
     int method = selectedMethods_[ 0 ][ partNumber ];
 
@@ -526,9 +599,10 @@ void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const doubl
         break;
 
     case 1:
+        // Determine stagnation point pressure coefficient, for flow which has passed through a normal shock wave.
         pressureFunction =
                 std::bind( aerodynamics::computeModifiedNewtonianPressureCoefficient, std::placeholders::_1,
-                           stagnationPressureCoefficient );
+                           computeStagnationPressure( machNumber, ratioOfSpecificHeats ) );
         break;
 
     case 2:
@@ -579,23 +653,20 @@ void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const doubl
         break;
     }
 
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1; i++ )
+    for ( int i = 0 ; i < inclinations.rows( ) ; i++ )
     {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
+        if ( inclinations( i ) > 0 )
         {
-            if ( inclination_[ partNumber ][ i ][ j ] > 0 )
-            {
-                // If panel inclination is positive, calculate pressure coefficient.
-                pressureCoefficient_[ partNumber ][ i ][ j ] =
-                        pressureFunction( inclination_[ partNumber ][ i ][ j ] );
-            }
+            // If panel inclination is positive, calculate pressure coefficient.
+            pressureCoefficients( i ) = pressureFunction( inclinations( i ) );
         }
     }
 }
 
 //! Determines expansion pressure coefficients on all parts.
-void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double machNumber,
-                                                                   const int partNumber )
+void HypersonicLocalInclinationAnalysis::updateExpansionPressures(
+        const double machNumber, const int partNumber,
+        const Eigen::VectorXd& inclinations, Eigen::VectorXd& pressureCoefficients ) const
 {
     // Get analysis method of part to analyze.
     int method = selectedMethods_[ 1 ][ partNumber ];
@@ -622,17 +693,13 @@ void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double
         }
 
         // Iterate over all panels on part.
-        for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+        const double expansionPressureCoefficient = pressureFunction( );
+        for ( int i = 0 ; i < inclinations.rows( ) ; i++ )
         {
-            for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
+            if ( inclinations( i ) <= 0 )
             {
-                if ( inclination_[ partNumber ][ i ][ j ] <= 0 )
-                {
-                    // If panel inclination is negative, calculate pressure using
-                    // Van Dyke unified method.
-                    pressureCoefficient_[ partNumber ][ i ][ j ] =
-                            pressureFunction( );
-                }
+                // If panel inclination is negative, set (inclination-independent) pressure coefficient.
+                pressureCoefficients( i ) = expansionPressureCoefficient;
             }
         }
     }
@@ -671,17 +738,12 @@ void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double
         }
 
         // Iterate over all panels on part.
-        for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+        for ( int i = 0 ; i < inclinations.rows( ) ; i++ )
         {
-            for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
+            if ( inclinations( i ) <= 0 )
             {
-                if ( inclination_[ partNumber ][ i ][ j ] <= 0 )
-                {
-                    // If panel inclination is negative, calculate pressure using
-                    // Van Dyke unified method.
-                    pressureCoefficient_[ partNumber ][ i ][ j ] =
-                            pressureFunction( inclination_[ partNumber ][ i ][ j ] );
-                }
+                // If panel inclination is negative, calculate pressure coefficient.
+                pressureCoefficients( i ) = pressureFunction( inclinations( i ) );
             }
         }
     }
@@ -8,9 +8,11 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <iostream>
+#include <limits>
+
 #include "tudat/astro/aerodynamics/nrlmsise00Atmosphere.h"
 #include "tudat/math/basic/mathematicalConstants.h"
-#include <iostream>
 
 //! Tudat library namespace.
 namespace tudat
@@ -18,6 +20,26 @@ namespace tudat
 namespace aerodynamics
 {
 
+//! Function to set the input of the NRLMSISE00 model (input_, aph_ and flags_ members)
+void NRLMSISE00Atmosphere::setModelInput(
+        const NRLMSISE00Input& inputData, const double altitude, const double longitude, const double latitude )
+{
+    std::copy( inputData.apVector.begin( ), inputData.apVector.end( ), aph_.a );
+    std::copy( inputData.switches.begin( ), inputData.switches.end( ), flags_.switches);
+
+    input_.g_lat  = latitude * 180.0 / mathematical_constants::PI; // rad to deg
+    input_.g_long = longitude * 180.0 / mathematical_constants::PI; // rad to deg
+    input_.alt    = altitude * 1.0E-3; // m to km
+    input_.year   = inputData.year;
+    input_.doy    = inputData.dayOfTheYear;
+    input_.sec    = inputData.secondOfTheDay;
+    input_.lst    = inputData.localSolarTime;
+    input_.f107   = inputData.f107;
+    input_.f107A  = inputData.f107a;
+    input_.ap     = inputData.apDaily;
+    input_.ap_a   = &aph_;
+}
+
 void NRLMSISE00Atmosphere::computeProperties(
         const double altitude, const double longitude,
         const double latitude, const double time )
@@ -35,24 +57,90 @@ void NRLMSISE00Atmosphere::computeProperties(
     // Retrieve input data.
     inputData_ = nrlmsise00InputFunction_(
                 altitude, longitude, latitude, time );
-    std::copy( inputData_.apVector.begin( ), inputData_.apVector.end( ), aph_.a );
-    std::copy( inputData_.switches.begin( ), inputData_.switches.end( ), flags_.switches);
 
-    input_.g_lat  = latitude * 180.0 / mathematical_constants::PI; // rad to deg
-    input_.g_long = longitude * 180.0 / mathematical_constants::PI; // rad to deg
-    input_.alt    = altitude * 1.0E-3; // m to km
-    input_.year   = inputData_.year;
-    input_.doy    = inputData_.dayOfTheYear;
-    input_.sec    = inputData_.secondOfTheDay;
-    input_.lst    = inputData_.localSolarTime;
-    input_.f107   = inputData_.f107;
-    input_.f107A  = inputData_.f107a;
-    input_.ap     = inputData_.apDaily;
-    input_.ap_a   = &aph_;
+    computeModelOutput( altitude, longitude, latitude, time );
+    computePropertiesFromModelOutput( );
+}
 
-    // Call NRLMSISE00
-    gtd7(&input_, &flags_, &output_);
+//! Function to compute the model output (output_ member) from the current input data (inputData_ member)
+void NRLMSISE00Atmosphere::computeModelOutput(
+        const double altitude, const double longitude,
+        const double latitude, const double time )
+{
+    if( tabulationSettings_ != nullptr && altitude >= tabulationSettings_->minimumAltitude_ &&
+            altitude <= tabulationSettings_->maximumAltitude_ )
+    {
+        // Interpolate NRLMSISE00 output from grid
+        updateTabulationReference( altitude, longitude, latitude, time );
+        computeTabulatedModelOutput( altitude, latitude, inputData_.localSolarTime, output_ );
+    }
+    else
+    {
+        // Call NRLMSISE00
+        setModelInput( inputData_, altitude, longitude, latitude );
+        gtd7(&input_, &flags_, &output_);
+    }
+}
 
+//! Function to compute the atmospheric properties at a set of points
+void NRLMSISE00Atmosphere::computeMultiPointProperties(
+        const Eigen::VectorXd& altitudes, const Eigen::VectorXd& longitudes,
+        const Eigen::VectorXd& latitudes, const Eigen::VectorXd& times,
+        NRLMSISE00MultiPointOutput& output )
+{
+    const int numberOfPoints = altitudes.rows( );
+    if( longitudes.rows( ) != numberOfPoints || latitudes.rows( ) != numberOfPoints ||
+            times.rows( ) != numberOfPoints )
+    {
+        throw std::runtime_error( "Error when computing NRLMSISE00 properties at multiple points, input sizes are "
+                                  "inconsistent: " + std::to_string( altitudes.rows( ) ) + ", " +
+                                  std::to_string( longitudes.rows( ) ) + ", " + std::to_string( latitudes.rows( ) ) +
+                                  ", " + std::to_string( times.rows( ) ) );
+    }
+    output.resize( numberOfPoints );
+
+    NRLMSISE00Input epochInputData;
+    for( int i = 0; i < numberOfPoints; i++ )
+    {
+        // Retrieve input data, re-using the time-dependent input for consecutive points at the same epoch
+        if( nrlmsise00EpochInputFunction_ != nullptr )
+        {
+            if( i == 0 || times( i ) != times( i - 1 ) )
+            {
+                epochInputData = nrlmsise00EpochInputFunction_( times( i ) );
+            }
+            inputData_ = epochInputData;
+            inputData_.localSolarTime = computeNrlmsiseLocalSolarTime(
+                        inputData_.secondOfTheDay, longitudes( i ) );
+        }
+        else
+        {
+            inputData_ = nrlmsise00InputFunction_( altitudes( i ), longitudes( i ), latitudes( i ), times( i ) );
+        }
+
+        computeModelOutput( altitudes( i ), longitudes( i ), latitudes( i ), times( i ) );
+        computePropertiesFromModelOutput( );
+
+        output.densities_( i ) = density_;
+        output.temperatures_( i ) = temperature_;
+        output.exosphericTemperatures_( i ) = output_.t[ 0 ];
+        output.pressures_( i ) = pressure_;
+        output.meanMolarMasses_( i ) = meanMolarMass_;
+        output.speedsOfSound_( i ) = speedOfSound_;
+        output.meanFreePaths_( i ) = meanFreePath_;
+        for( unsigned int j = 0; j < numberDensities_.size( ); j++ )
+        {
+            output.numberDensities_( i, j ) = numberDensities_[ j ];
+        }
+    }
+
+    // Member variables no longer correspond to the last single-point query
+    resetHashKey( );
+}
+
+//! Function to compute the atmospheric properties from the current model output (output_ member)
+void NRLMSISE00Atmosphere::computePropertiesFromModelOutput( )
+{
     // Retrieve density and temperature
     density_ = output_.d[ 5 ] * 1000.0; // GM/CM3 to kg/M3
     temperature_ = output_.t[1];
@@ -116,6 +204,263 @@ void NRLMSISE00Atmosphere::computeProperties(
     }
 }
 
+//! Function to set the settings for the tabulated evaluation of the model
+void NRLMSISE00Atmosphere::setTabulationSettings(
+        const std::shared_ptr< NRLMSISE00TabulationSettings > tabulationSettings )
+{
+    tabulationSettings_ = tabulationSettings;
+    isTabulationReferenceSet_ = false;
+    tabulatedNodeValues_.clear( );
+    isTabulatedNodeComputed_.clear( );
+    resetHashKey( );
+
+    if( tabulationSettings_ != nullptr )
+    {
+        if( !( tabulationSettings_->maximumAltitude_ > tabulationSettings_->minimumAltitude_ ) ||
+                !( tabulationSettings_->altitudeStep_ > 0.0 ) || !( tabulationSettings_->latitudeStep_ > 0.0 ) ||
+                !( tabulationSettings_->localSolarTimeStep_ > 0.0 ) ||
+                !( tabulationSettings_->epochWindowDuration_ > 0.0 ) )
+        {
+            throw std::runtime_error( "Error in NRLMSISE00 tabulation settings, altitude range, grid steps and epoch "
+                                      "window duration must be positive." );
+        }
+
+        // Set grid, adjusting steps to fit an integer number of steps in the ranges
+        numberOfTabulationAltitudes_ = std::max(
+                    2, static_cast< int >( std::round( ( tabulationSettings_->maximumAltitude_ -
+                                                         tabulationSettings_->minimumAltitude_ ) /
+                                                       tabulationSettings_->altitudeStep_ ) ) + 1 );
+        tabulationAltitudeStep_ = ( tabulationSettings_->maximumAltitude_ - tabulationSettings_->minimumAltitude_ ) /
+                static_cast< double >( numberOfTabulationAltitudes_ - 1 );
+
+        numberOfTabulationLatitudes_ = std::max(
+                    2, static_cast< int >( std::round( mathematical_constants::PI /
+                                                       tabulationSettings_->latitudeStep_ ) ) + 1 );
+        tabulationLatitudeStep_ = mathematical_constants::PI / static_cast< double >( numberOfTabulationLatitudes_ - 1 );
+
+        numberOfTabulationLocalSolarTimes_ = std::max(
+                    2, static_cast< int >( std::round( 24.0 / tabulationSettings_->localSolarTimeStep_ ) ) );
+        tabulationLocalSolarTimeStep_ = 24.0 / static_cast< double >( numberOfTabulationLocalSolarTimes_ );
+
+        const int numberOfNodes =
+                numberOfTabulationAltitudes_ * numberOfTabulationLatitudes_ * numberOfTabulationLocalSolarTimes_;
+        tabulatedNodeValues_.resize( numberOfNodes * numberOfTabulatedValues_ );
+        isTabulatedNodeComputed_.resize( numberOfNodes );
+    }
+}
+
+//! Function to reset the grid for the tabulated evaluation, if required
+void NRLMSISE00Atmosphere::updateTabulationReference(
+        const double altitude, const double longitude, const double latitude, const double time )
+{
+    const long long windowIndex = static_cast< long long >(
+                std::floor( time / tabulationSettings_->epochWindowDuration_ ) );
+
+    if( !isTabulationReferenceSet_ || windowIndex != tabulationWindowIndex_ ||
+            inputData_.f107 != tabulationReferenceInput_.f107 ||
+            inputData_.f107a != tabulationReferenceInput_.f107a ||
+            inputData_.apDaily != tabulationReferenceInput_.apDaily ||
+            inputData_.apVector != tabulationReferenceInput_.apVector ||
+            inputData_.switches != tabulationReferenceInput_.switches )
+    {
+        // Retrieve input at middle of epoch window, using space weather of current query
+        tabulationReferenceInput_ = nrlmsise00InputFunction_(
+                    altitude, longitude, latitude,
+                    ( static_cast< double >( windowIndex ) + 0.5 ) * tabulationSettings_->epochWindowDuration_ );
+        tabulationReferenceInput_.f107 = inputData_.f107;
+        tabulationReferenceInput_.f107a = inputData_.f107a;
+        tabulationReferenceInput_.apDaily = inputData_.apDaily;
+        tabulationReferenceInput_.apVector = inputData_.apVector;
+        tabulationReferenceInput_.switches = inputData_.switches;
+
+        tabulationWindowIndex_ = windowIndex;
+        isTabulationReferenceSet_ = true;
+        std::fill( isTabulatedNodeComputed_.begin( ), isTabulatedNodeComputed_.end( ), 0 );
+    }
+}
+
+//! Function to evaluate the model directly at a given point of the grid of the tabulated evaluation
+void NRLMSISE00Atmosphere::evaluateModelAtTabulationPoint(
+        const double altitude, const double latitude, const double localSolarTime, nrlmsise_output& output )
+{
+    NRLMSISE00Input pointInput = tabulationReferenceInput_;
+    pointInput.localSolarTime = localSolarTime;
+
+    // Set longitude consistent with local solar time, at reference time
+    const double longitude = ( localSolarTime - pointInput.secondOfTheDay / 3600.0 ) * 15.0 *
+            mathematical_constants::PI / 180.0;
+
+    setModelInput( pointInput, altitude, longitude, latitude );
+    gtd7( &input_, &flags_, &output );
+}
+
+//! Function to convert model output to the values that are tabulated
+void NRLMSISE00Atmosphere::convertModelOutputToTabulatedValues(
+        const nrlmsise_output& output, double* tabulatedValues )
+{
+    // Densities are interpolated logarithmically; zero densities (e.g. O, H and N at low altitude) are floored.
+    static const double minimumDensity = std::numeric_limits< double >::min( );
+    tabulatedValues[ 0 ] = std::log( std::max( output.d[ 5 ], minimumDensity ) );
+    tabulatedValues[ 1 ] = output.t[ 0 ];
+    tabulatedValues[ 2 ] = output.t[ 1 ];
+    for( unsigned int i = 0; i < 5; i++ )
+    {
+        tabulatedValues[ 3 + i ] = std::log( std::max( output.d[ i ], minimumDensity ) );
+    }
+    for( unsigned int i = 6; i < 9; i++ )
+    {
+        tabulatedValues[ 2 + i ] = std::log( std::max( output.d[ i ], minimumDensity ) );
+    }
+}
+
+//! Function to convert tabulated values to model output
+void NRLMSISE00Atmosphere::convertTabulatedValuesToModelOutput(
+        const double* tabulatedValues, nrlmsise_output& output )
+{
+    output.d[ 5 ] = std::exp( tabulatedValues[ 0 ] );
+    output.t[ 0 ] = tabulatedValues[ 1 ];
+    output.t[ 1 ] = tabulatedValues[ 2 ];
+    for( unsigned int i = 0; i < 5; i++ )
+    {
+        output.d[ i ] = std::exp( tabulatedValues[ 3 + i ] );
+    }
+    for( unsigned int i = 6; i < 9; i++ )
+    {
+        output.d[ i ] = std::exp( tabulatedValues[ 2 + i ] );
+    }
+}
+
+//! Function to retrieve the tabulated values at a grid node, evaluating the node if this has not yet been done
+const double* NRLMSISE00Atmosphere::getTabulatedNodeValues(
+        const int altitudeIndex, const int latitudeIndex, const int localSolarTimeIndex )
+{
+    const int nodeIndex = ( altitudeIndex * numberOfTabulationLatitudes_ + latitudeIndex ) *
+            numberOfTabulationLocalSolarTimes_ + localSolarTimeIndex;
+    double* nodeValues = tabulatedNodeValues_.data( ) + nodeIndex * numberOfTabulatedValues_;
+
+    if( !isTabulatedNodeComputed_[ nodeIndex ] )
+    {
+        nrlmsise_output nodeOutput;
+        evaluateModelAtTabulationPoint(
+                    tabulationSettings_->minimumAltitude_ + altitudeIndex * tabulationAltitudeStep_,
+                    -mathematical_constants::PI / 2.0 + latitudeIndex * tabulationLatitudeStep_,
+                    localSolarTimeIndex * tabulationLocalSolarTimeStep_, nodeOutput );
+        convertModelOutputToTabulatedValues( nodeOutput, nodeValues );
+        isTabulatedNodeComputed_[ nodeIndex ] = 1;
+    }
+    return nodeValues;
+}
+
+//! Function to compute the model output by interpolation in the grid of the tabulated evaluation
+void NRLMSISE00Atmosphere::computeTabulatedModelOutput(
+        const double altitude, const double latitude, const double localSolarTime, nrlmsise_output& output )
+{
+    // Find grid cell and position in cell, in each dimension (local solar time is periodic)
+    const double scaledAltitude = ( altitude - tabulationSettings_->minimumAltitude_ ) / tabulationAltitudeStep_;
+    const int altitudeIndex = std::max( 0, std::min( static_cast< int >( scaledAltitude ),
+                                                     numberOfTabulationAltitudes_ - 2 ) );
+    const double altitudeFraction = scaledAltitude - altitudeIndex;
+
+    const double scaledLatitude = ( latitude + mathematical_constants::PI / 2.0 ) / tabulationLatitudeStep_;
+    const int latitudeIndex = std::max( 0, std::min( static_cast< int >( std::floor( scaledLatitude ) ),
+                                                     numberOfTabulationLatitudes_ - 2 ) );
+    const double latitudeFraction = scaledLatitude - latitudeIndex;
+
+    double wrappedLocalSolarTime = std::fmod( localSolarTime, 24.0 );
+    if( wrappedLocalSolarTime < 0.0 )
+    {
+        wrappedLocalSolarTime += 24.0;
+    }
+    const double scaledLocalSolarTime = wrappedLocalSolarTime / tabulationLocalSolarTimeStep_;
+    const int localSolarTimeIndex = std::min( static_cast< int >( scaledLocalSolarTime ),
+                                              numberOfTabulationLocalSolarTimes_ - 1 );
+    const double localSolarTimeFraction = scaledLocalSolarTime - localSolarTimeIndex;
+    const int localSolarTimeIndices[ 2 ] =
+    { localSolarTimeIndex, ( localSolarTimeIndex + 1 ) % numberOfTabulationLocalSolarTimes_ };
+
+    // Interpolate tabulated values from the eight corners of the grid cell
+    double tabulatedValues[ numberOfTabulatedValues_ ] = { };
+    for( int corner = 0; corner < 8; corner++ )
+    {
+        const int altitudeOffset = corner & 1;
+        const int latitudeOffset = ( corner >> 1 ) & 1;
+        const int localSolarTimeOffset = ( corner >> 2 ) & 1;
+
+        const double weight =
+                ( altitudeOffset ? altitudeFraction : 1.0 - altitudeFraction ) *
+                ( latitudeOffset ? latitudeFraction : 1.0 - latitudeFraction ) *
+                ( localSolarTimeOffset ? localSolarTimeFraction : 1.0 - localSolarTimeFraction );
+
+        const double* nodeValues = getTabulatedNodeValues(
+                    altitudeIndex + altitudeOffset, latitudeIndex + latitudeOffset,
+                    localSolarTimeIndices[ localSolarTimeOffset ] );
+        for( int i = 0; i < numberOfTabulatedValues_; i++ )
+        {
+            tabulatedValues[ i ] += weight * nodeValues[ i ];
+        }
+    }
+
+    convertTabulatedValuesToModelOutput( tabulatedValues, output );
+}
+
+//! Function to compute the maximum relative error in the density due to the tabulation
+double NRLMSISE00Atmosphere::computeMaximumTabulatedDensityError( )
+{
+    double maximumError = 0.0;
+    if( tabulationSettings_ == nullptr || !isTabulationReferenceSet_ )
+    {
+        return maximumError;
+    }
+
+    // Save current model input, which is modified by the evaluations below
+    const nrlmsise_input currentInput = input_;
+    const nrlmsise_flags currentFlags = flags_;
+    const ap_array currentAp = aph_;
+
+    nrlmsise_output directOutput, interpolatedOutput;
+    for( int i = 0; i < numberOfTabulationAltitudes_ - 1; i++ )
+    {
+        for( int j = 0; j < numberOfTabulationLatitudes_ - 1; j++ )
+        {
+            for( int k = 0; k < numberOfTabulationLocalSolarTimes_; k++ )
+            {
+                // Check if all corners of cell have been evaluated
+                bool isCellComputed = true;
+                for( int corner = 0; corner < 8; corner++ )
+                {
+                    const int nodeIndex =
+                            ( ( i + ( corner & 1 ) ) * numberOfTabulationLatitudes_ + j + ( ( corner >> 1 ) & 1 ) ) *
+                            numberOfTabulationLocalSolarTimes_ +
+                            ( k + ( ( corner >> 2 ) & 1 ) ) % numberOfTabulationLocalSolarTimes_;
+                    isCellComputed = isCellComputed && isTabulatedNodeComputed_[ nodeIndex ];
+                }
+
+                // Compare interpolated and direct density at center of cell
+                if( isCellComputed )
+                {
+                    const double altitude = tabulationSettings_->minimumAltitude_ +
+                            ( static_cast< double >( i ) + 0.5 ) * tabulationAltitudeStep_;
+                    const double latitude = -mathematical_constants::PI / 2.0 +
+                            ( static_cast< double >( j ) + 0.5 ) * tabulationLatitudeStep_;
+                    const double localSolarTime = ( static_cast< double >( k ) + 0.5 ) * tabulationLocalSolarTimeStep_;
+
+                    computeTabulatedModelOutput( altitude, latitude, localSolarTime, interpolatedOutput );
+                    evaluateModelAtTabulationPoint( altitude, latitude, localSolarTime, directOutput );
+                    maximumError = std::max(
+                                maximumError, std::fabs( interpolatedOutput.d[ 5 ] / directOutput.d[ 5 ] - 1.0 ) );
+                }
+            }
+        }
+    }
+
+    input_ = currentInput;
+    flags_ = currentFlags;
+    aph_ = currentAp;
+    input_.ap_a = &aph_;
+
+    return maximumError;
+}
+
 //! Overloaded ostream to print class information.
 std::ostream& operator << ( std::ostream& stream,
                             NRLMSISE00Input& nrlmsiseInput ){
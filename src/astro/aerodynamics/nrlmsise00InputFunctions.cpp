@@ -32,17 +32,48 @@ std::vector< double >  eigenToStlVector(
     return stdVector;
 }
 
-//! NRLMSISE00Input function
-NRLMSISE00Input nrlmsiseInputFunction( const double altitude, const double longitude,
-                                       const double latitude, const double time,
-                                       const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap,
-                                       const bool adjustSolarTime,
-                                       const double localSolarTime ) {
-    using namespace tudat::input_output::solar_activity;
-
+//! Function to compute the time-dependent NRLMSISE00 input from the solar activity data of the current day
+static NRLMSISE00Input computeNrlmsiseEpochInput(
+        const double time, const double julianDay,
+        const tudat::input_output::solar_activity::SolarActivityDataPtr solarActivity )
+{
     // Declare input data class member
     NRLMSISE00Input nrlmsiseInputData;
 
+    // Compute julian date at the first of januari
+    double julianDate1Jan = tudat::basic_astrodynamics::convertCalendarDateToJulianDay(
+                solarActivity->year, 1, 1, 0, 0, 0.0 );
+
+    nrlmsiseInputData.year = solarActivity->year; // int
+    nrlmsiseInputData.dayOfTheYear = julianDay - julianDate1Jan + 1;
+    nrlmsiseInputData.secondOfTheDay = time -
+            tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch( julianDay,
+                                                            tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+
+    if( solarActivity->fluxQualifier == 1 )
+    { // requires adjustment
+        nrlmsiseInputData.f107 = solarActivity->solarRadioFlux107Adjusted;
+        nrlmsiseInputData.f107a = solarActivity->centered81DaySolarRadioFlux107Adjusted;
+    }
+    else
+    { // no adjustment required
+        nrlmsiseInputData.f107 = solarActivity->solarRadioFlux107Observed;
+        nrlmsiseInputData.f107a = solarActivity->centered81DaySolarRadioFlux107Observed;
+    }
+    nrlmsiseInputData.apDaily = solarActivity->planetaryEquivalentAmplitudeAverage;
+    nrlmsiseInputData.apVector = eigenToStlVector( solarActivity->planetaryEquivalentAmplitudeVector );
+
+    nrlmsiseInputData.localSolarTime = computeNrlmsiseLocalSolarTime( nrlmsiseInputData.secondOfTheDay, 0.0 );
+
+    return nrlmsiseInputData;
+}
+
+//! NRLMSISE00 epoch input function
+NRLMSISE00Input nrlmsiseEpochInputFunction(
+        const double time, const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap )
+{
+    using namespace tudat::input_output::solar_activity;
+
     // Julian dates
     double julianDate = tudat::basic_astrodynamics::convertSecondsSinceEpochToJulianDay(
                 time, basic_astrodynamics::JULIAN_DAY_ON_J2000 );
@@ -66,40 +97,70 @@ NRLMSISE00Input nrlmsiseInputFunction( const double altitude, const double longi
         solarActivity = solarActivityMap.at( julianDay );
     }
 
+    return computeNrlmsiseEpochInput( time, julianDay, solarActivity );
+}
 
-    // Compute julian date at the first of januari
-    double julianDate1Jan = tudat::basic_astrodynamics::convertCalendarDateToJulianDay(
-                solarActivity->year, 1, 1, 0, 0, 0.0 );
+//! NRLMSISE00 epoch input function, using day-indexed solar activity data
+NRLMSISE00Input nrlmsiseEpochInputFunction(
+        const double time,
+        const std::shared_ptr< tudat::input_output::solar_activity::SolarActivityContainer > solarActivityContainer )
+{
+    // Julian dates
+    double julianDate = tudat::basic_astrodynamics::convertSecondsSinceEpochToJulianDay(
+                time, basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+    double julianDay = std::floor( julianDate - 0.5 ) + 0.5;
 
-    nrlmsiseInputData.year = solarActivity->year; // int
-    nrlmsiseInputData.dayOfTheYear = julianDay - julianDate1Jan + 1;
-    nrlmsiseInputData.secondOfTheDay = time -
-            tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch( julianDay,
-                                                            tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+    if( julianDay - solarActivityContainer->getLastJulianDay( ) > 30 )
+    {
+        throw std::runtime_error( "Error when retrieving solar activity data at JD" + std::to_string( julianDate ) +
+                                  ", most recent data is more than 30 days old" );
+    }
 
-    if( solarActivity->fluxQualifier == 1 )
-    { // requires adjustment
-        nrlmsiseInputData.f107 = solarActivity->solarRadioFlux107Adjusted;
-        nrlmsiseInputData.f107a = solarActivity->centered81DaySolarRadioFlux107Adjusted;
+    return computeNrlmsiseEpochInput(
+                time, julianDay, solarActivityContainer->getSolarActivityDataAtJulianDay( julianDay ) );
+}
+
+//! NRLMSISE00Input function
+NRLMSISE00Input nrlmsiseInputFunction( const double altitude, const double longitude,
+                                       const double latitude, const double time,
+                                       const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap,
+                                       const bool adjustSolarTime,
+                                       const double localSolarTime ) {
+    // Compute time-dependent input
+    NRLMSISE00Input nrlmsiseInputData = nrlmsiseEpochInputFunction( time, solarActivityMap );
+
+    // Compute local solar time
+    if( adjustSolarTime )
+    {
+        nrlmsiseInputData.localSolarTime = localSolarTime;
     }
     else
-    { // no adjustment required
-        nrlmsiseInputData.f107 = solarActivity->solarRadioFlux107Observed;
-        nrlmsiseInputData.f107a = solarActivity->centered81DaySolarRadioFlux107Observed;
+    {
+        nrlmsiseInputData.localSolarTime = computeNrlmsiseLocalSolarTime( nrlmsiseInputData.secondOfTheDay, longitude );
     }
-    nrlmsiseInputData.apDaily = solarActivity->planetaryEquivalentAmplitudeAverage;
-    nrlmsiseInputData.apVector = eigenToStlVector( solarActivity->planetaryEquivalentAmplitudeVector );
+
+    return nrlmsiseInputData;
+}
+
+//! NRLMSISE00Input function, using day-indexed solar activity data
+NRLMSISE00Input nrlmsiseInputFunction(
+        const double altitude, const double longitude,
+        const double latitude, const double time,
+        const std::shared_ptr< tudat::input_output::solar_activity::SolarActivityContainer > solarActivityContainer,
+        const bool adjustSolarTime,
+        const double localSolarTime )
+{
+    // Compute time-dependent input
+    NRLMSISE00Input nrlmsiseInputData = nrlmsiseEpochInputFunction( time, solarActivityContainer );
 
     // Compute local solar time
-    // Hrs since begin of the day at longitude 0 (GMT) + Hrs passed at current longitude
     if( adjustSolarTime )
     {
         nrlmsiseInputData.localSolarTime = localSolarTime;
     }
     else
     {
-        nrlmsiseInputData.localSolarTime = nrlmsiseInputData.secondOfTheDay / 3600.0
-                + longitude / ( tudat::mathematical_constants::PI / 12.0 );
+        nrlmsiseInputData.localSolarTime = computeNrlmsiseLocalSolarTime( nrlmsiseInputData.secondOfTheDay, longitude );
     }
 
     return nrlmsiseInputData;
@@ -11,6 +11,7 @@
 
 #include "tudat/astro/aerodynamics/tabulatedAtmosphere.h"
 
+#include <algorithm>
 #include <iostream>
 
 #include "tudat/io/matrixTextFileReader.h"
@@ -186,36 +187,23 @@ void TabulatedAtmosphere::createAtmosphereInterpolators( )
             }
         }
 
-        // Create interpolators for density, pressure and temperature
-        interpolatorForDensity_ = std::make_shared< CubicSplineInterpolatorDouble >(
-                    independentVariablesData_.at( 0 ), dependentVariablesData.at( dependentVariableIndices_.at( 0 ) ),
-                    huntingAlgorithm, boundaryHandling_.at( 0 ), defaultExtrapolationValue_.at( dependentVariableIndices_.at( 0 ) ).at( 0 ) );
-        interpolatorForPressure_ = std::make_shared< CubicSplineInterpolatorDouble >(
-                    independentVariablesData_.at( 0 ), dependentVariablesData.at( dependentVariableIndices_.at( 1 ) ),
-                    huntingAlgorithm, boundaryHandling_.at( 0 ), defaultExtrapolationValue_.at( dependentVariableIndices_.at( 1 ) ).at( 0 ) );
-        interpolatorForTemperature_ = std::make_shared< CubicSplineInterpolatorDouble >(
-                    independentVariablesData_.at( 0 ), dependentVariablesData.at( dependentVariableIndices_.at( 2 ) ),
-                    huntingAlgorithm, boundaryHandling_.at( 0 ), defaultExtrapolationValue_.at( dependentVariableIndices_.at( 2 ) ).at( 0 ) );
-
-        // Create remaining interpolators, if requested by user
-        if ( dependentVariablesDependency_.at( 3 ) )
+        // Create single interpolator for all dependent variables
+        std::vector< Eigen::Vector6d > combinedDependentVariablesData(
+                    numberOfRowsInFile, Eigen::Vector6d::Zero( ) );
+        for ( unsigned int j = 0; j < dependentVariablesDependency_.size( ); j++ )
         {
-            interpolatorForGasConstant_ = std::make_shared< CubicSplineInterpolatorDouble >(
-                        independentVariablesData_.at( 0 ), dependentVariablesData.at( dependentVariableIndices_.at( 3 ) ),
-                        huntingAlgorithm, boundaryHandling_.at( 0 ), defaultExtrapolationValue_.at( dependentVariableIndices_.at( 3 ) ).at( 0 ) );
-        }
-        if ( dependentVariablesDependency_.at( 4 ) )
-        {
-            interpolatorForSpecificHeatRatio_ = std::make_shared< CubicSplineInterpolatorDouble >(
-                        independentVariablesData_.at( 0 ), dependentVariablesData.at( dependentVariableIndices_.at( 4 ) ),
-                        huntingAlgorithm, boundaryHandling_.at( 0 ), defaultExtrapolationValue_.at( dependentVariableIndices_.at( 4 ) ).at( 0 ) );
-        }
-        if ( dependentVariablesDependency_.at( 5 ) )
-        {
-            interpolatorForMolarMass_ = std::make_shared< CubicSplineInterpolatorDouble >(
-                        independentVariablesData_.at( 0 ), dependentVariablesData.at( dependentVariableIndices_.at( 5 ) ),
-                        huntingAlgorithm, boundaryHandling_.at( 0 ), defaultExtrapolationValue_.at( dependentVariableIndices_.at( 5 ) ).at( 0 ) );
+            if ( isDependentVariableInterpolated( j ) )
+            {
+                for ( unsigned int i = 0; i < numberOfRowsInFile; i++ )
+                {
+                    combinedDependentVariablesData.at( i )( j ) =
+                            dependentVariablesData.at( dependentVariableIndices_.at( j ) ).at( i );
+                }
+            }
         }
+        dependentVariablesInterpolator_ = std::make_shared< CubicSplineInterpolator< double, Eigen::Vector6d > >(
+                    independentVariablesData_.at( 0 ), combinedDependentVariablesData, huntingAlgorithm,
+                    boundaryHandling_.at( 0 ), getCombinedDefaultExtrapolationValues( ).at( 0 ) );
         break;
     }
     case 2:
@@ -253,41 +241,85 @@ void TabulatedAtmosphere::createMultiDimensionalAtmosphereInterpolators( )
     // Assign independent variables
     independentVariablesData_ = tabulatedAtmosphereData.second;
 
-    // Create interpolators for density, pressure and temperature
-    interpolatorForDensity_ =
-            std::make_shared< MultiLinearInterpolator< double, double, NumberOfIndependentVariables > >(
-                independentVariablesData_, tabulatedAtmosphereData.first.at( dependentVariableIndices_.at( 0 ) ),
-                huntingAlgorithm, boundaryHandling_, defaultExtrapolationValue_.at( dependentVariableIndices_.at( 0 ) ) );
-    interpolatorForPressure_ =
-            std::make_shared< MultiLinearInterpolator< double, double, NumberOfIndependentVariables > >(
-                independentVariablesData_, tabulatedAtmosphereData.first.at( dependentVariableIndices_.at( 1 ) ),
-                huntingAlgorithm, boundaryHandling_, defaultExtrapolationValue_.at( dependentVariableIndices_.at( 1 ) ) );
-    interpolatorForTemperature_ =
-            std::make_shared< MultiLinearInterpolator< double, double, NumberOfIndependentVariables > >(
-                independentVariablesData_, tabulatedAtmosphereData.first.at( dependentVariableIndices_.at( 2 ) ),
-                huntingAlgorithm, boundaryHandling_, defaultExtrapolationValue_.at( dependentVariableIndices_.at( 2 ) ) );
-
-    // Create remaining interpolators, if requested by user
-    if ( dependentVariablesDependency_.at( 3 ) )
+    // Combine dependent variables into single multi-array
+    const boost::multi_array< double, static_cast< size_t >( NumberOfIndependentVariables ) >& firstDependentVariableData =
+            tabulatedAtmosphereData.first.at( 0 );
+    boost::multi_array< Eigen::Vector6d, static_cast< size_t >( NumberOfIndependentVariables ) >
+            combinedDependentVariablesData( reinterpret_cast< boost::array< size_t, NumberOfIndependentVariables > const& >(
+                                                *firstDependentVariableData.shape( ) ) );
+    std::fill_n( combinedDependentVariablesData.data( ), combinedDependentVariablesData.num_elements( ),
+                 Eigen::Vector6d::Zero( ) );
+    for ( unsigned int j = 0; j < dependentVariablesDependency_.size( ); j++ )
+    {
+        if ( isDependentVariableInterpolated( j ) )
+        {
+            const double* currentDependentVariableData =
+                    tabulatedAtmosphereData.first.at( dependentVariableIndices_.at( j ) ).data( );
+            for ( unsigned int i = 0; i < combinedDependentVariablesData.num_elements( ); i++ )
+            {
+                combinedDependentVariablesData.data( )[ i ]( j ) = currentDependentVariableData[ i ];
+            }
+        }
+    }
+
+    // Create single interpolator for all dependent variables
+    dependentVariablesInterpolator_ =
+            std::make_shared< MultiLinearInterpolator< double, Eigen::Vector6d, NumberOfIndependentVariables > >(
+                independentVariablesData_, combinedDependentVariablesData, huntingAlgorithm, boundaryHandling_,
+                getCombinedDefaultExtrapolationValues( ) );
+}
+
+//! Function to retrieve the default extrapolation values of all dependent variables combined
+std::vector< std::pair< Eigen::Vector6d, Eigen::Vector6d > > TabulatedAtmosphere::getCombinedDefaultExtrapolationValues( )
+{
+    std::vector< std::pair< Eigen::Vector6d, Eigen::Vector6d > > combinedDefaultExtrapolationValues(
+                numberOfIndependentVariables_, std::make_pair( Eigen::Vector6d::Zero( ), Eigen::Vector6d::Zero( ) ) );
+    for ( unsigned int j = 0; j < dependentVariablesDependency_.size( ); j++ )
     {
-        interpolatorForGasConstant_ =
-                std::make_shared< MultiLinearInterpolator< double, double, NumberOfIndependentVariables > >(
-                    independentVariablesData_, tabulatedAtmosphereData.first.at( dependentVariableIndices_.at( 3 ) ),
-                    huntingAlgorithm, boundaryHandling_, defaultExtrapolationValue_.at( dependentVariableIndices_.at( 3 ) ) );
+        if ( isDependentVariableInterpolated( j ) )
+        {
+            for ( unsigned int i = 0; i < numberOfIndependentVariables_; i++ )
+            {
+                const std::pair< double, double >& currentDefaultValues =
+                        defaultExtrapolationValue_.at( dependentVariableIndices_.at( j ) ).at( i );
+                combinedDefaultExtrapolationValues.at( i ).first( j ) = currentDefaultValues.first;
+                combinedDefaultExtrapolationValues.at( i ).second( j ) = currentDefaultValues.second;
+            }
+        }
     }
-    if ( dependentVariablesDependency_.at( 4 ) )
+    return combinedDefaultExtrapolationValues;
+}
+
+//! Function to update the dependent variables (currentDependentVariables_) to the given conditions.
+void TabulatedAtmosphere::updateDependentVariables( const double altitude, const double longitude,
+                                                    const double latitude, const double time )
+{
+    // Get list of independent variables
+    for ( unsigned int i = 0; i < numberOfIndependentVariables_; i++ )
     {
-        interpolatorForSpecificHeatRatio_ =
-                std::make_shared< MultiLinearInterpolator< double, double, NumberOfIndependentVariables > >(
-                    independentVariablesData_, tabulatedAtmosphereData.first.at( dependentVariableIndices_.at( 4 ) ),
-                    huntingAlgorithm, boundaryHandling_, defaultExtrapolationValue_.at( dependentVariableIndices_.at( 4 ) ) );
+        switch ( independentVariables_[ i ] )
+        {
+        case altitude_dependent_atmosphere:
+            independentVariableData_[ i ] = altitude;
+            break;
+        case longitude_dependent_atmosphere:
+            independentVariableData_[ i ] = longitude;
+            break;
+        case latitude_dependent_atmosphere:
+            independentVariableData_[ i ] = latitude;
+            break;
+        case time_dependent_atmosphere:
+            independentVariableData_[ i ] = time;
+            break;
+        }
     }
-    if ( dependentVariablesDependency_.at( 5 ) )
+
+    // Interpolate all dependent variables, if independent variables have changed
+    if ( !areCurrentDependentVariablesSet_ || independentVariableData_ != currentIndependentVariableData_ )
     {
-        interpolatorForMolarMass_ =
-                std::make_shared< MultiLinearInterpolator< double, double, NumberOfIndependentVariables > >(
-                    independentVariablesData_, tabulatedAtmosphereData.first.at( dependentVariableIndices_.at( 5 ) ),
-                    huntingAlgorithm, boundaryHandling_, defaultExtrapolationValue_.at( dependentVariableIndices_.at( 5 ) ) );
+        currentDependentVariables_ = dependentVariablesInterpolator_->interpolate( independentVariableData_ );
+        currentIndependentVariableData_ = independentVariableData_;
+        areCurrentDependentVariablesSet_ = true;
     }
 }
 
@@ -9,12 +9,17 @@
  *
  *    References
  *      Montebruck O, Gill E. Satellite Orbits, Springer, 2000.
+ *      Vermeille H. Direct transformation from geocentric coordinates to geodetic coordinates, Journal of Geodesy,
+ *          76(8), 451-454, 2002.
  *
  */
 
+#include <algorithm>
+#include <functional>
 #include <vector>
 #include <cmath>
 
+#include "tudat/basics/parallelization.h"
 #include "tudat/math/basic/coordinateConversions.h"
 
 #include "tudat/astro/basic_astro/geodeticCoordinateConversions.h"
@@ -188,6 +193,163 @@ Eigen::Vector3d convertCartesianToGeodeticCoordinates( const Eigen::Vector3d car
     return geodeticCoordinates;
 }
 
+//! Calculate geodetic coordinates of a position vector, using a closed-form method.
+Eigen::Vector3d convertCartesianToGeodeticCoordinatesClosedForm( const Eigen::Vector3d& cartesianCoordinates,
+                                                                 const double equatorialRadius,
+                                                                 const double flattening )
+{
+    const double eccentricitySquared = flattening * ( 2.0 - flattening );
+    const double eccentricityToFourth = eccentricitySquared * eccentricitySquared;
+    const double horizontalDistanceSquared =
+            cartesianCoordinates.x( ) * cartesianCoordinates.x( ) + cartesianCoordinates.y( ) * cartesianCoordinates.y( );
+
+    // Compute auxiliary quantities, Vermeille (2002)
+    double p = horizontalDistanceSquared / ( equatorialRadius * equatorialRadius );
+    double q = ( 1.0 - eccentricitySquared ) * cartesianCoordinates.z( ) * cartesianCoordinates.z( ) /
+            ( equatorialRadius * equatorialRadius );
+    double r = ( p + q - eccentricityToFourth ) / 6.0;
+
+    // Use iterative method close to center of body, where closed-form method is not valid
+    if( !( r > 0.0 ) )
+    {
+        return convertCartesianToGeodeticCoordinates(
+                    cartesianCoordinates, equatorialRadius, flattening,
+                    GEODETIC_CONVERSION_FALLBACK_TOLERANCE * equatorialRadius );
+    }
+
+    double s = eccentricityToFourth * p * q / ( 4.0 * r * r * r );
+    double t = std::cbrt( 1.0 + s + std::sqrt( s * ( 2.0 + s ) ) );
+    double u = r * ( 1.0 + t + 1.0 / t );
+    double v = std::sqrt( u * u + eccentricityToFourth * q );
+    double w = eccentricitySquared * ( u + v - q ) / ( 2.0 * v );
+    double k = std::sqrt( u + v + w * w ) - w;
+    double d = k * std::sqrt( horizontalDistanceSquared ) / ( k + eccentricitySquared );
+    double distanceInMeridianPlane = std::sqrt( d * d + cartesianCoordinates.z( ) * cartesianCoordinates.z( ) );
+
+    return ( Eigen::Vector3d( )
+             << ( k + eccentricitySquared - 1.0 ) / k * distanceInMeridianPlane,
+             2.0 * std::atan2( cartesianCoordinates.z( ), d + distanceInMeridianPlane ),
+             std::atan2( cartesianCoordinates.y( ), cartesianCoordinates.x( ) ) ).finished( );
+}
+
+//! Minimum number of points per task when distributing a batch coordinate conversion over multiple threads
+const int MINIMUM_NUMBER_OF_POINTS_PER_CONVERSION_TASK = 1024;
+
+//! Function to execute a batch coordinate conversion on contiguous blocks of columns, distributed over a number of threads
+void executeBlockwiseConversion( const int numberOfPoints,
+                                 const std::function< void( const int, const int ) >& convertBlock,
+                                 const int numberOfThreads )
+{
+    int numberOfTasks = std::min( numberOfThreads, numberOfPoints / MINIMUM_NUMBER_OF_POINTS_PER_CONVERSION_TASK );
+    if( numberOfTasks <= 1 )
+    {
+        convertBlock( 0, numberOfPoints );
+    }
+    else
+    {
+        int pointsPerTask = ( numberOfPoints + numberOfTasks - 1 ) / numberOfTasks;
+        utilities::executeParallelTasks(
+                    numberOfTasks, [ & ]( const int taskIndex )
+        {
+            int startIndex = taskIndex * pointsPerTask;
+            convertBlock( startIndex, std::min( numberOfPoints, startIndex + pointsPerTask ) - startIndex );
+        }, numberOfThreads );
+    }
+}
+
+//! Calculate geodetic coordinates of a batch of position vectors, using a closed-form method.
+Eigen::Matrix3Xd convertCartesianToGeodeticCoordinatesBatch( const Eigen::Matrix3Xd& cartesianCoordinates,
+                                                             const double equatorialRadius,
+                                                             const double flattening,
+                                                             const int numberOfThreads )
+{
+    const double eccentricitySquared = flattening * ( 2.0 - flattening );
+    const double eccentricityToFourth = eccentricitySquared * eccentricitySquared;
+    const double equatorialRadiusSquared = equatorialRadius * equatorialRadius;
+
+    Eigen::Matrix3Xd geodeticCoordinates( 3, cartesianCoordinates.cols( ) );
+    executeBlockwiseConversion(
+                static_cast< int >( cartesianCoordinates.cols( ) ),
+                [ & ]( const int startIndex, const int numberOfPoints )
+    {
+        Eigen::ArrayXd x = cartesianCoordinates.row( 0 ).segment( startIndex, numberOfPoints ).transpose( ).array( );
+        Eigen::ArrayXd y = cartesianCoordinates.row( 1 ).segment( startIndex, numberOfPoints ).transpose( ).array( );
+        Eigen::ArrayXd z = cartesianCoordinates.row( 2 ).segment( startIndex, numberOfPoints ).transpose( ).array( );
+
+        // Compute auxiliary quantities for all points, Vermeille (2002)
+        Eigen::ArrayXd horizontalDistanceSquared = x.square( ) + y.square( );
+        Eigen::ArrayXd p = horizontalDistanceSquared / equatorialRadiusSquared;
+        Eigen::ArrayXd q = ( 1.0 - eccentricitySquared ) / equatorialRadiusSquared * z.square( );
+        Eigen::ArrayXd r = ( p + q - eccentricityToFourth ) / 6.0;
+        Eigen::ArrayXd s = eccentricityToFourth * p * q / ( 4.0 * r.cube( ) );
+        Eigen::ArrayXd t = ( 1.0 + s + ( s * ( 2.0 + s ) ).sqrt( ) ).pow( 1.0 / 3.0 );
+        Eigen::ArrayXd u = r * ( 1.0 + t + t.inverse( ) );
+        Eigen::ArrayXd v = ( u.square( ) + eccentricityToFourth * q ).sqrt( );
+        Eigen::ArrayXd w = eccentricitySquared * ( u + v - q ) / ( 2.0 * v );
+        Eigen::ArrayXd k = ( u + v + w.square( ) ).sqrt( ) - w;
+        Eigen::ArrayXd d = k * horizontalDistanceSquared.sqrt( ) / ( k + eccentricitySquared );
+        Eigen::ArrayXd distanceInMeridianPlane = ( d.square( ) + z.square( ) ).sqrt( );
+
+        geodeticCoordinates.row( 0 ).segment( startIndex, numberOfPoints ).array( ) =
+                ( k + eccentricitySquared - 1.0 ) / k * distanceInMeridianPlane;
+        geodeticCoordinates.row( 1 ).segment( startIndex, numberOfPoints ).array( ) =
+                2.0 * z.binaryExpr( d + distanceInMeridianPlane, [ ]( const double numerator, const double denominator )
+        {
+            return std::atan2( numerator, denominator );
+        } );
+        geodeticCoordinates.row( 2 ).segment( startIndex, numberOfPoints ).array( ) =
+                y.binaryExpr( x, [ ]( const double numerator, const double denominator )
+        {
+            return std::atan2( numerator, denominator );
+        } );
+
+        // Use iterative method close to center of body, where closed-form method is not valid
+        for( int i = 0; i < numberOfPoints; i++ )
+        {
+            if( !( r( i ) > 0.0 ) )
+            {
+                geodeticCoordinates.col( startIndex + i ) = convertCartesianToGeodeticCoordinates(
+                            cartesianCoordinates.col( startIndex + i ), equatorialRadius, flattening,
+                            GEODETIC_CONVERSION_FALLBACK_TOLERANCE * equatorialRadius );
+            }
+        }
+    }, numberOfThreads );
+
+    return geodeticCoordinates;
+}
+
+//! Calculate the Cartesian positions of a batch of geodetic coordinates.
+Eigen::Matrix3Xd convertGeodeticToCartesianCoordinatesBatch( const Eigen::Matrix3Xd& geodeticCoordinates,
+                                                             const double equatorialRadius,
+                                                             const double flattening,
+                                                             const int numberOfThreads )
+{
+    Eigen::Matrix3Xd cartesianCoordinates( 3, geodeticCoordinates.cols( ) );
+    executeBlockwiseConversion(
+                static_cast< int >( geodeticCoordinates.cols( ) ),
+                [ & ]( const int startIndex, const int numberOfPoints )
+    {
+        Eigen::ArrayXd altitude = geodeticCoordinates.row( 0 ).segment( startIndex, numberOfPoints ).transpose( ).array( );
+        Eigen::ArrayXd latitude = geodeticCoordinates.row( 1 ).segment( startIndex, numberOfPoints ).transpose( ).array( );
+        Eigen::ArrayXd longitude = geodeticCoordinates.row( 2 ).segment( startIndex, numberOfPoints ).transpose( ).array( );
+
+        // Calculate Cartesian coordinates for all points, Montenbruck and Gill (2000), Eq. (5.82).
+        Eigen::ArrayXd sineLatitude = latitude.sin( );
+        Eigen::ArrayXd centerOffset = equatorialRadius /
+                ( 1.0 - flattening * ( 2.0 - flattening ) * sineLatitude.square( ) ).sqrt( );
+        Eigen::ArrayXd horizontalDistance = ( centerOffset + altitude ) * latitude.cos( );
+
+        cartesianCoordinates.row( 0 ).segment( startIndex, numberOfPoints ).array( ) =
+                horizontalDistance * longitude.cos( );
+        cartesianCoordinates.row( 1 ).segment( startIndex, numberOfPoints ).array( ) =
+                horizontalDistance * longitude.sin( );
+        cartesianCoordinates.row( 2 ).segment( startIndex, numberOfPoints ).array( ) =
+                ( ( 1.0 - flattening ) * ( 1.0 - flattening ) * centerOffset + altitude ) * sineLatitude;
+    }, numberOfThreads );
+
+    return cartesianCoordinates;
+}
+
 } // namespace tudat
 
 } // namespace coordinate_conversions
@@ -15,6 +15,8 @@
 
 #include <Eigen/Core>
 #include <cmath>
+#include <iterator>
+#include <stdexcept>
 
 #include "tudat/astro/basic_astro/missionGeometry.h"
 #include "tudat/math/basic/mathematicalConstants.h"
@@ -148,6 +150,270 @@ double computeShadowFunction( const Eigen::Vector3d& occultedBodyPosition,
     return shadowFunction;
 }
 
+//! Compute the shadow function for a batch of satellite positions.
+Eigen::VectorXd computeShadowFunctions( const Eigen::Matrix3Xd& occultedBodyPositions,
+                                        const double occultedBodyRadius,
+                                        const Eigen::Matrix3Xd& occultingBodyPositions,
+                                        const double occultingBodyRadius,
+                                        const Eigen::Matrix3Xd& satellitePositions )
+{
+    if( occultedBodyPositions.cols( ) != satellitePositions.cols( ) ||
+            occultingBodyPositions.cols( ) != satellitePositions.cols( ) )
+    {
+        throw std::runtime_error( "Error when computing shadow functions, inconsistent number of positions" );
+    }
+
+    Eigen::VectorXd shadowFunctions( satellitePositions.cols( ) );
+    for( int i = 0; i < satellitePositions.cols( ); i++ )
+    {
+        shadowFunctions( i ) = computeShadowFunction(
+                    occultedBodyPositions.col( i ), occultedBodyRadius,
+                    occultingBodyPositions.col( i ), occultingBodyRadius,
+                    satellitePositions.col( i ) );
+    }
+    return shadowFunctions;
+}
+
+//! Compute the clearance of the line of sight between two points w.r.t. a spherical body.
+double computeLineOfSightClearance( const Eigen::Vector3d& observerPosition,
+                                    const Eigen::Vector3d& targetPosition,
+                                    const Eigen::Vector3d& occultingBodyPosition,
+                                    const double occultingBodyRadius )
+{
+    const Eigen::Vector3d lineOfSight = targetPosition - observerPosition;
+    const Eigen::Vector3d relativeBodyPosition = occultingBodyPosition - observerPosition;
+
+    // Compute fraction of line of sight at which it is closest to the body center
+    const double lineOfSightLengthSquared = lineOfSight.squaredNorm( );
+    double closestApproachFraction = 0.0;
+    if( lineOfSightLengthSquared > 0.0 )
+    {
+        closestApproachFraction = std::min( std::max(
+                    lineOfSight.dot( relativeBodyPosition ) / lineOfSightLengthSquared, 0.0 ), 1.0 );
+    }
+
+    return ( relativeBodyPosition - closestApproachFraction * lineOfSight ).norm( ) - occultingBodyRadius;
+}
+
+//! Compute the clearance of the line of sight between two points w.r.t. a spherical body, for a batch of positions.
+Eigen::VectorXd computeLineOfSightClearances( const Eigen::Matrix3Xd& observerPositions,
+                                              const Eigen::Matrix3Xd& targetPositions,
+                                              const Eigen::Matrix3Xd& occultingBodyPositions,
+                                              const double occultingBodyRadius )
+{
+    if( targetPositions.cols( ) != observerPositions.cols( ) ||
+            occultingBodyPositions.cols( ) != observerPositions.cols( ) )
+    {
+        throw std::runtime_error( "Error when computing line of sight clearances, inconsistent number of positions" );
+    }
+
+    const Eigen::Matrix3Xd linesOfSight = targetPositions - observerPositions;
+    const Eigen::Matrix3Xd relativeBodyPositions = occultingBodyPositions - observerPositions;
+
+    // Compute fraction of each line of sight at which it is closest to the body center
+    const Eigen::ArrayXd lineOfSightLengthsSquared = linesOfSight.colwise( ).squaredNorm( ).transpose( ).array( );
+    const Eigen::ArrayXd projectedBodyPositions =
+            linesOfSight.cwiseProduct( relativeBodyPositions ).colwise( ).sum( ).transpose( ).array( );
+    const Eigen::ArrayXd closestApproachFractions = ( lineOfSightLengthsSquared > 0.0 ).select(
+                ( projectedBodyPositions / lineOfSightLengthsSquared ).max( 0.0 ).min( 1.0 ), 0.0 );
+
+    return ( relativeBodyPositions - linesOfSight * closestApproachFractions.matrix( ).asDiagonal( ) ).
+            colwise( ).norm( ).transpose( ).array( ) - occultingBodyRadius;
+}
+
+//! Extract the time windows during which an event is active, from its evaluation on a (coarse) grid of epochs.
+std::vector< std::pair< double, double > > extractEventWindows(
+        const std::vector< double >& epochs,
+        const std::vector< bool >& isEventActive,
+        const std::function< bool( const double ) > isEventActiveFunction,
+        const double timeTolerance )
+{
+    if( epochs.size( ) != isEventActive.size( ) )
+    {
+        throw std::runtime_error( "Error when extracting event windows, inconsistent number of epochs and event states" );
+    }
+
+    std::vector< std::pair< double, double > > eventWindows;
+    if( epochs.size( ) == 0 )
+    {
+        return eventWindows;
+    }
+
+    double currentWindowStart = epochs.at( 0 );
+    for( unsigned int i = 1; i < epochs.size( ); i++ )
+    {
+        if( isEventActive.at( i ) != isEventActive.at( i - 1 ) )
+        {
+            // Refine epoch of event state change by bisection
+            double lowerEpoch = epochs.at( i - 1 );
+            double upperEpoch = epochs.at( i );
+            if( isEventActiveFunction != nullptr )
+            {
+                while( upperEpoch - lowerEpoch > timeTolerance )
+                {
+                    double middleEpoch = 0.5 * ( lowerEpoch + upperEpoch );
+                    if( middleEpoch <= lowerEpoch || middleEpoch >= upperEpoch )
+                    {
+                        break;
+                    }
+                    else if( isEventActiveFunction( middleEpoch ) == isEventActive.at( i - 1 ) )
+                    {
+                        lowerEpoch = middleEpoch;
+                    }
+                    else
+                    {
+                        upperEpoch = middleEpoch;
+                    }
+                }
+            }
+
+            // Set window entry (first epoch at which event is active) or exit (last epoch at which event is active)
+            if( isEventActive.at( i ) )
+            {
+                currentWindowStart = upperEpoch;
+            }
+            else
+            {
+                eventWindows.push_back( std::make_pair( currentWindowStart, lowerEpoch ) );
+            }
+        }
+    }
+
+    if( isEventActive.back( ) )
+    {
+        eventWindows.push_back( std::make_pair( currentWindowStart, epochs.back( ) ) );
+    }
+
+    return eventWindows;
+}
+
+//! Interpolate the position from a Cartesian state history, using cubic Hermite interpolation.
+Eigen::Vector3d interpolatePositionFromStateHistory(
+        const std::map< double, Eigen::VectorXd >& stateHistory,
+        const double epoch )
+{
+    if( stateHistory.size( ) < 2 )
+    {
+        throw std::runtime_error( "Error when interpolating position from state history, at least two epochs are required" );
+    }
+    else if( stateHistory.begin( )->second.rows( ) < 6 )
+    {
+        throw std::runtime_error( "Error when interpolating position from state history, Cartesian state is required" );
+    }
+
+    // Find epochs bracketing requested epoch
+    std::map< double, Eigen::VectorXd >::const_iterator upperIterator = stateHistory.lower_bound( epoch );
+    if( upperIterator == stateHistory.end( ) )
+    {
+        upperIterator = std::prev( stateHistory.end( ) );
+    }
+    else if( upperIterator->first == epoch )
+    {
+        return upperIterator->second.segment( 0, 3 );
+    }
+    else if( upperIterator == stateHistory.begin( ) )
+    {
+        upperIterator++;
+    }
+    std::map< double, Eigen::VectorXd >::const_iterator lowerIterator = std::prev( upperIterator );
+
+    // Evaluate cubic Hermite basis functions
+    const double timeStep = upperIterator->first - lowerIterator->first;
+    const double normalizedTime = std::min( std::max( ( epoch - lowerIterator->first ) / timeStep, 0.0 ), 1.0 );
+    const double normalizedTimeSquared = normalizedTime * normalizedTime;
+    const double normalizedTimeCubed = normalizedTimeSquared * normalizedTime;
+
+    return ( 2.0 * normalizedTimeCubed - 3.0 * normalizedTimeSquared + 1.0 ) * lowerIterator->second.segment( 0, 3 ) +
+            ( normalizedTimeCubed - 2.0 * normalizedTimeSquared + normalizedTime ) * timeStep *
+            lowerIterator->second.segment( 3, 3 ) +
+            ( -2.0 * normalizedTimeCubed + 3.0 * normalizedTimeSquared ) * upperIterator->second.segment( 0, 3 ) +
+            ( normalizedTimeCubed - normalizedTimeSquared ) * timeStep * upperIterator->second.segment( 3, 3 );
+}
+
+//! Compute the eclipse windows of a satellite, from its (propagated) state history.
+std::vector< std::pair< double, double > > computeEclipseWindows(
+        const std::map< double, Eigen::VectorXd >& satelliteStateHistory,
+        const std::function< Eigen::Vector3d( const double ) > occultedBodyPositionFunction,
+        const double occultedBodyRadius,
+        const std::function< Eigen::Vector3d( const double ) > occultingBodyPositionFunction,
+        const double occultingBodyRadius,
+        const double shadowFunctionThreshold,
+        const double timeTolerance )
+{
+    // Retrieve positions at epochs of state history
+    std::vector< double > epochs;
+    epochs.reserve( satelliteStateHistory.size( ) );
+    Eigen::Matrix3Xd satellitePositions( 3, satelliteStateHistory.size( ) );
+    Eigen::Matrix3Xd occultedBodyPositions( 3, satelliteStateHistory.size( ) );
+    Eigen::Matrix3Xd occultingBodyPositions( 3, satelliteStateHistory.size( ) );
+    for( auto stateIterator : satelliteStateHistory )
+    {
+        satellitePositions.col( epochs.size( ) ) = stateIterator.second.segment( 0, 3 );
+        occultedBodyPositions.col( epochs.size( ) ) = occultedBodyPositionFunction( stateIterator.first );
+        occultingBodyPositions.col( epochs.size( ) ) = occultingBodyPositionFunction( stateIterator.first );
+        epochs.push_back( stateIterator.first );
+    }
+
+    // Evaluate shadow function on grid
+    Eigen::VectorXd shadowFunctions = computeShadowFunctions(
+                occultedBodyPositions, occultedBodyRadius, occultingBodyPositions, occultingBodyRadius, satellitePositions );
+    std::vector< bool > isEclipsed( epochs.size( ) );
+    for( unsigned int i = 0; i < epochs.size( ); i++ )
+    {
+        isEclipsed[ i ] = shadowFunctions( i ) < shadowFunctionThreshold;
+    }
+
+    return extractEventWindows(
+                epochs, isEclipsed, [ & ]( const double epoch )
+    {
+        return computeShadowFunction(
+                    occultedBodyPositionFunction( epoch ), occultedBodyRadius,
+                    occultingBodyPositionFunction( epoch ), occultingBodyRadius,
+                    interpolatePositionFromStateHistory( satelliteStateHistory, epoch ) ) < shadowFunctionThreshold;
+    }, timeTolerance );
+}
+
+//! Compute the windows during which a target is visible from a satellite, from the satellite's state history.
+std::vector< std::pair< double, double > > computeVisibilityWindows(
+        const std::map< double, Eigen::VectorXd >& satelliteStateHistory,
+        const std::function< Eigen::Vector3d( const double ) > targetPositionFunction,
+        const std::function< Eigen::Vector3d( const double ) > occultingBodyPositionFunction,
+        const double occultingBodyRadius,
+        const double timeTolerance )
+{
+    // Retrieve positions at epochs of state history
+    std::vector< double > epochs;
+    epochs.reserve( satelliteStateHistory.size( ) );
+    Eigen::Matrix3Xd satellitePositions( 3, satelliteStateHistory.size( ) );
+    Eigen::Matrix3Xd targetPositions( 3, satelliteStateHistory.size( ) );
+    Eigen::Matrix3Xd occultingBodyPositions( 3, satelliteStateHistory.size( ) );
+    for( auto stateIterator : satelliteStateHistory )
+    {
+        satellitePositions.col( epochs.size( ) ) = stateIterator.second.segment( 0, 3 );
+        targetPositions.col( epochs.size( ) ) = targetPositionFunction( stateIterator.first );
+        occultingBodyPositions.col( epochs.size( ) ) = occultingBodyPositionFunction( stateIterator.first );
+        epochs.push_back( stateIterator.first );
+    }
+
+    // Evaluate line of sight clearance on grid
+    Eigen::VectorXd lineOfSightClearances = computeLineOfSightClearances(
+                satellitePositions, targetPositions, occultingBodyPositions, occultingBodyRadius );
+    std::vector< bool > isVisible( epochs.size( ) );
+    for( unsigned int i = 0; i < epochs.size( ); i++ )
+    {
+        isVisible[ i ] = lineOfSightClearances( i ) > 0.0;
+    }
+
+    return extractEventWindows(
+                epochs, isVisible, [ & ]( const double epoch )
+    {
+        return computeLineOfSightClearance(
+                    interpolatePositionFromStateHistory( satelliteStateHistory, epoch ),
+                    targetPositionFunction( epoch ), occultingBodyPositionFunction( epoch ),
+                    occultingBodyRadius ) > 0.0;
+    }, timeTolerance );
+}
+
 double computeSphereOfInfluence( const double distanceToCentralBody,
                                  const double ratioOfOrbitingToCentralBodyMass )
 {
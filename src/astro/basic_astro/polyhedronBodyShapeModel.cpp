@@ -8,7 +8,10 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <algorithm>
+
 #include "tudat/astro/basic_astro/polyhedronBodyShapeModel.h"
+#include "tudat/astro/basic_astro/polyhedronPreprocessing.h"
 #include "tudat/astro/gravitation/polyhedronGravityField.h"
 
 namespace tudat
@@ -34,92 +37,40 @@ double PolyhedronBodyShapeModel::getAltitude( const Eigen::Vector3d& bodyFixedPo
     // Compute altitude using distance to vertices, facets and edges
     else
     {
-        const unsigned int numberOfFacets = verticesDefiningEachFacet_.rows();
-        const unsigned int numberOfEdges = verticesDefiningEachEdge_.rows();
-
-        std::vector< unsigned int > verticesToTest;
         std::vector< unsigned int > edgesToTest;
         std::vector< unsigned int > facetsToTest;
 
-        // Select vertices connected to the closest vertex
-        for (unsigned int edge = 0; edge < numberOfEdges; ++edge)
+        // Select edges and facets adjacent to the vertices connected to the closest vertex
+        for ( unsigned int edgeOfClosestVertex : edgesAdjacentToEachVertex_.at( closestVertex ) )
         {
-            if ( closestVertex == static_cast< unsigned int >( verticesDefiningEachEdge_(edge, 0) ) )
-            {
-                verticesToTest.push_back( verticesDefiningEachEdge_(edge, 1) );
-            }
-            else if ( closestVertex == static_cast< unsigned int >( verticesDefiningEachEdge_(edge, 1) ) )
-            {
-                verticesToTest.push_back( verticesDefiningEachEdge_(edge, 0) );
-            }
-        }
-
-        // Loop over selected vertices
-        for ( unsigned int vertex : verticesToTest )
-        {
-            // Loop over the edges and select the ones that include the selected vertex
-            for ( unsigned int edge = 0; edge < numberOfEdges; ++edge )
-            {
-                // If the edge isn't in the list of edges to test, check whether it should be added to it
-                if ( std::count( edgesToTest.begin(), edgesToTest.end(), edge ) == 0)
-                {
-                    if ( static_cast< unsigned int >( verticesDefiningEachEdge_(edge, 0) ) == vertex ||
-                         static_cast< unsigned int >( verticesDefiningEachEdge_(edge, 1) )  == vertex )
-                    {
-                        edgesToTest.push_back( edge );
-                    }
-                }
-            }
-
-            // Loop over the facets and select the ones that include the selected vertex
-            for ( unsigned int facet = 0; facet < numberOfFacets; ++facet )
+            unsigned int vertex = static_cast< unsigned int >( verticesDefiningEachEdge_( edgeOfClosestVertex, 0 ) );
+            if ( vertex == closestVertex )
             {
-                // If the edge isn't in the list of edges to test, check whether it should be added to it
-                if ( std::count( facetsToTest.begin(), facetsToTest.end(), facet ) == 0)
-                {
-                    if ( static_cast< unsigned int >( verticesDefiningEachFacet_(facet, 0) ) == vertex ||
-                         static_cast< unsigned int >( verticesDefiningEachEdge_(facet, 1) ) == vertex ||
-                         static_cast< unsigned int >( verticesDefiningEachFacet_(facet, 2) ) == vertex  )
-                    {
-                        facetsToTest.push_back( facet );
-                    }
-                }
+                vertex = static_cast< unsigned int >( verticesDefiningEachEdge_( edgeOfClosestVertex, 1 ) );
             }
-        }
 
-        // Create matrix with vertices defining each edge to be tested
-        Eigen::MatrixXi verticesDefiningEachEdgeToTest = Eigen::MatrixXi::Constant(
-                    edgesToTest.size( ), 2, -1 );
-        unsigned int counter = 0;
-        for ( unsigned int edge : edgesToTest )
-        {
-            verticesDefiningEachEdgeToTest(counter,0) = verticesDefiningEachEdge_(edge,0);
-            verticesDefiningEachEdgeToTest(counter,1) = verticesDefiningEachEdge_(edge,1);
-            ++counter;
+            edgesToTest.insert( edgesToTest.end( ), edgesAdjacentToEachVertex_.at( vertex ).begin( ),
+                                edgesAdjacentToEachVertex_.at( vertex ).end( ) );
+            facetsToTest.insert( facetsToTest.end( ), facetsAdjacentToEachVertex_.at( vertex ).begin( ),
+                                 facetsAdjacentToEachVertex_.at( vertex ).end( ) );
         }
 
-        // Create matrix with vertices defining each facet to be tested
-        Eigen::MatrixXi verticesDefiningEachFacetToTest = Eigen::MatrixXi::Constant(
-                    facetsToTest.size( ), 3, -1 );
-        counter = 0;
-        for ( unsigned int facet : facetsToTest )
-        {
-            verticesDefiningEachFacetToTest(counter,0) = verticesDefiningEachFacet_(facet,0);
-            verticesDefiningEachFacetToTest(counter,1) = verticesDefiningEachFacet_(facet,1);
-            verticesDefiningEachFacetToTest(counter,2) = verticesDefiningEachFacet_(facet,2);
-            ++counter;
-        }
+        // Remove duplicate edges and facets
+        std::sort( edgesToTest.begin( ), edgesToTest.end( ) );
+        edgesToTest.erase( std::unique( edgesToTest.begin( ), edgesToTest.end( ) ), edgesToTest.end( ) );
+        std::sort( facetsToTest.begin( ), facetsToTest.end( ) );
+        facetsToTest.erase( std::unique( facetsToTest.begin( ), facetsToTest.end( ) ), facetsToTest.end( ) );
 
         // Compute distance to closest edge and facet, using limited set of edges and facets
-        double distanceToFacet = computeDistanceToClosestFacet(bodyFixedPosition, verticesDefiningEachFacetToTest);
-        double distanceToEdge = computeDistanceToClosestEdge(bodyFixedPosition, verticesDefiningEachEdgeToTest);
+        double distanceToFacet = computeDistanceToClosestFacet( bodyFixedPosition, facetsToTest );
+        double distanceToEdge = computeDistanceToClosestEdge( bodyFixedPosition, edgesToTest );
 
         // Altitude is the minimum distance to any of the polyhedrin features
         altitude = std::min({distanceToVertex, distanceToFacet, distanceToEdge});
     }
 
-    // Select the altitude sign if necessary
-    if ( computeAltitudeWithSign_ )
+    // Select the altitude sign if necessary (points outside the enclosing sphere are outside the polyhedron)
+    if ( computeAltitudeWithSign_ && !( bodyFixedPosition.norm( ) > boundingSphereRadius_ ) )
     {
         // Compute coordinates of vertices with respect to field point
         Eigen::MatrixXd verticesCoordinatesRelativeToFieldPoint;
@@ -149,40 +100,65 @@ double PolyhedronBodyShapeModel::computeDistanceToClosestVertex(
         const Eigen::Vector3d& bodyFixedPosition,
         unsigned int& closestVertexId )
 {
-    const unsigned int numberOfVertices = verticesCoordinates_.rows();
+    // Select the vertex with smallest distance (and lowest index, if multiple vertices are at the same distance)
+    double distance;
+    closestVertexId = static_cast< unsigned int >( verticesTree_->findNearestNeighbour(
+                bodyFixedPosition, distance, findVertexCloseToPreviousClosestVertex( bodyFixedPosition ) ) );
+    previousClosestVertex_.store( static_cast< int >( closestVertexId ), std::memory_order_relaxed );
 
-    // Initialize distance
-    double distance = std::numeric_limits< double >::infinity( );
+    return distance;
+}
+
+int PolyhedronBodyShapeModel::findVertexCloseToPreviousClosestVertex( const Eigen::Vector3d& bodyFixedPosition )
+{
+    int currentVertex = previousClosestVertex_.load( std::memory_order_relaxed );
+    if ( currentVertex < 0 || justComputeDistanceToVertices_ )
+    {
+        return currentVertex;
+    }
 
-    // Loop over vertices and select the one with smallest distance
-    for (unsigned int vertex = 0; vertex < numberOfVertices; ++vertex)
+    // Move to the adjacent vertex closest to the field point, until no adjacent vertex is closer
+    double currentSquaredDistance =
+            ( verticesCoordinates_.row( currentVertex ).transpose( ) - bodyFixedPosition ).squaredNorm( );
+    bool isCloserVertexFound = true;
+    while ( isCloserVertexFound )
     {
-        Eigen::Vector3d vertexCoordinates = verticesCoordinates_.block<1,3>(vertex, 0);
-        double distanceToVertex = ( vertexCoordinates - bodyFixedPosition ).norm( );
-        if ( distanceToVertex < distance )
+        isCloserVertexFound = false;
+        const int vertexToExpand = currentVertex;
+        for ( unsigned int edge : edgesAdjacentToEachVertex_.at( vertexToExpand ) )
         {
-            distance = distanceToVertex;
-            closestVertexId = vertex;
+            int adjacentVertex = verticesDefiningEachEdge_( edge, 0 );
+            if ( adjacentVertex == vertexToExpand )
+            {
+                adjacentVertex = verticesDefiningEachEdge_( edge, 1 );
+            }
+
+            double squaredDistance =
+                    ( verticesCoordinates_.row( adjacentVertex ).transpose( ) - bodyFixedPosition ).squaredNorm( );
+            if ( squaredDistance < currentSquaredDistance )
+            {
+                currentVertex = adjacentVertex;
+                currentSquaredDistance = squaredDistance;
+                isCloserVertexFound = true;
+            }
         }
     }
 
-    return distance;
+    return currentVertex;
 }
 
 double PolyhedronBodyShapeModel::computeDistanceToClosestFacet (
         const Eigen::Vector3d& bodyFixedPosition,
-        const Eigen::MatrixXi& verticesDefiningEachFacetToEvaluate )
+        const std::vector< unsigned int >& facetsToEvaluate )
 {
-    const unsigned int numberOfFacets = verticesDefiningEachFacetToEvaluate.rows();
-
     // Initialize distance: initial value set to NAN
     double distance = TUDAT_NAN;
 
-    for ( unsigned int facet = 0; facet < numberOfFacets; ++facet )
+    for ( unsigned int facet : facetsToEvaluate )
     {
-        Eigen::Vector3d vertex0 = verticesCoordinates_.block<1,3>(verticesDefiningEachFacetToEvaluate(facet,0),0);
-        Eigen::Vector3d vertex1 = verticesCoordinates_.block<1,3>(verticesDefiningEachFacetToEvaluate(facet,1),0);
-        Eigen::Vector3d vertex2 = verticesCoordinates_.block<1,3>(verticesDefiningEachFacetToEvaluate(facet,2),0);
+        Eigen::Vector3d vertex0 = verticesCoordinates_.block<1,3>(verticesDefiningEachFacet_(facet,0),0);
+        Eigen::Vector3d vertex1 = verticesCoordinates_.block<1,3>(verticesDefiningEachFacet_(facet,1),0);
+        Eigen::Vector3d vertex2 = verticesCoordinates_.block<1,3>(verticesDefiningEachFacet_(facet,2),0);
 
         // Compute outward-pointing vector normal to facet
         Eigen::Vector3d facetNormal = ((vertex1 - vertex0).cross(vertex2 - vertex1)).normalized();
@@ -222,17 +198,15 @@ double PolyhedronBodyShapeModel::computeDistanceToClosestFacet (
 
 double PolyhedronBodyShapeModel::computeDistanceToClosestEdge (
         const Eigen::Vector3d& bodyFixedPosition,
-        const Eigen::MatrixXi& verticesDefiningEachEdgeToEvaluate )
+        const std::vector< unsigned int >& edgesToEvaluate )
 {
-    const unsigned int numberOfEdges = verticesDefiningEachEdgeToEvaluate.rows();
-
     // Initialize distance: initial value set to NAN
     double distance = TUDAT_NAN;
 
-    for (unsigned int edge = 0; edge < numberOfEdges; ++edge)
+    for ( unsigned int edge : edgesToEvaluate )
     {
-        Eigen::Vector3d vertex0 = verticesCoordinates_.block<1,3>(verticesDefiningEachEdgeToEvaluate(edge,0),0);
-        Eigen::Vector3d vertex1 = verticesCoordinates_.block<1,3>(verticesDefiningEachEdgeToEvaluate(edge,1),0);
+        Eigen::Vector3d vertex0 = verticesCoordinates_.block<1,3>(verticesDefiningEachEdge_(edge,0),0);
+        Eigen::Vector3d vertex1 = verticesCoordinates_.block<1,3>(verticesDefiningEachEdge_(edge,1),0);
 
         Eigen::Vector3d r_v0_p = bodyFixedPosition - vertex0;
         Eigen::Vector3d r_v0_v1 = vertex1 - vertex0;
@@ -263,61 +237,26 @@ double PolyhedronBodyShapeModel::computeDistanceToClosestEdge (
 
 void PolyhedronBodyShapeModel::computeVerticesDefiningEachEdge( )
 {
-    const unsigned int numberOfVertices = verticesCoordinates_.rows();
-    const unsigned int numberOfFacets = verticesDefiningEachFacet_.rows();
-    const unsigned int numberOfEdges = 3 * ( numberOfVertices - 2 );
-
-    verticesDefiningEachEdge_ = Eigen::MatrixXi::Constant( numberOfEdges, 2, -1 );
+    // Retrieve edges from preprocessed polyhedron data, which is shared with gravity field models of same polyhedron
+    verticesDefiningEachEdge_ = getPolyhedronPreprocessedData(
+                verticesCoordinates_, verticesDefiningEachFacet_ )->verticesDefiningEachEdge;
+}
 
-    unsigned int numberOfInsertedEdges = 0;
-    for ( unsigned int facet = 0; facet < numberOfFacets; ++facet )
+void PolyhedronBodyShapeModel::computeFeaturesAdjacentToEachVertex( )
+{
+    edgesAdjacentToEachVertex_.assign( verticesCoordinates_.rows( ), std::vector< unsigned int >( ) );
+    for ( unsigned int edge = 0; edge < static_cast< unsigned int >( verticesDefiningEachEdge_.rows( ) ); ++edge )
     {
-        // Extract edges from face
-        std::vector< std::vector< int > > edgesToInsert;
-        const int vertex0 = verticesDefiningEachFacet_(facet,0);
-        const int vertex1 = verticesDefiningEachFacet_(facet,1);
-        const int vertex2 = verticesDefiningEachFacet_(facet,2);
-        edgesToInsert.push_back( { vertex0, vertex1 } );
-        edgesToInsert.push_back( { vertex1, vertex2 } );
-        edgesToInsert.push_back( { vertex2, vertex0 } );
-
-        // Check if all edges of the facet have been included in verticesDefiningEachEdge. If so, remove the edge from
-        // the edgesToInsert vector and add the facet to facetsDefiningEachEdge
-        for ( unsigned int edge = 0; ( edge < numberOfInsertedEdges && !edgesToInsert.empty() ); ++edge )
-        {
-            // Loop over edges of current facet still to be inserted
-            for ( unsigned int i = 0; i < edgesToInsert.size(); ++i)
-            {
-                if ( ( edgesToInsert.at(i).at(0) == verticesDefiningEachEdge_(edge, 0) && edgesToInsert.at(i).at(1) == verticesDefiningEachEdge_(edge, 1) ) ||
-                        ( edgesToInsert.at(i).at(0) == verticesDefiningEachEdge_(edge, 1) && edgesToInsert.at(i).at(1) == verticesDefiningEachEdge_(edge, 0) ) )
-                {
-                    edgesToInsert.erase(edgesToInsert.begin() + i);
-                }
-            }
-        }
-
-        // Check if any of the facet's edges still needs to be added to verticesDefiningEachEdge, and add it/them if so
-        for ( unsigned int i = 0; i < edgesToInsert.size(); ++i)
-        {
-            verticesDefiningEachEdge_(numberOfInsertedEdges,0) = edgesToInsert.at(i).at(0);
-            verticesDefiningEachEdge_(numberOfInsertedEdges,1) = edgesToInsert.at(i).at(1);
-            ++numberOfInsertedEdges;
-        }
+        edgesAdjacentToEachVertex_.at( verticesDefiningEachEdge_( edge, 0 ) ).push_back( edge );
+        edgesAdjacentToEachVertex_.at( verticesDefiningEachEdge_( edge, 1 ) ).push_back( edge );
     }
 
-    // Sanity checks
-    if ( numberOfInsertedEdges != numberOfEdges )
-    {
-        throw std::runtime_error( "Extracted number of polyhedron edges not correct." );
-    }
-    for ( unsigned int i = 0; i < numberOfEdges; ++i )
+    facetsAdjacentToEachVertex_.assign( verticesCoordinates_.rows( ), std::vector< unsigned int >( ) );
+    for ( unsigned int facet = 0; facet < static_cast< unsigned int >( verticesDefiningEachFacet_.rows( ) ); ++facet )
     {
-        for (unsigned int j : {0,1} )
+        for ( unsigned int i = 0; i < 3; ++i )
         {
-            if ( verticesDefiningEachEdge_(i,j) != verticesDefiningEachEdge_(i,j) )
-            {
-                throw std::runtime_error( "The vertices defining some edge were not selected." );
-            }
+            facetsAdjacentToEachVertex_.at( verticesDefiningEachFacet_( facet, i ) ).push_back( facet );
         }
     }
 }
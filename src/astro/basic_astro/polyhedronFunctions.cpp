@@ -12,6 +12,7 @@
 #include "tudat/astro/basic_astro/polyhedronFuntions.h"
 #include "tudat/math/basic/polyhedron.h"
 #include "tudat/math/basic/mathematicalConstants.h"
+#include "tudat/math/basic/legendrePolynomials.h"
 
 namespace tudat
 {
@@ -191,5 +192,151 @@ Eigen::Matrix3d computePolyhedronInertiaTensor (const Eigen::MatrixXd& verticesC
     return computePolyhedronInertiaTensor( verticesCoordinates, verticesDefiningEachFacet, density );
 }
 
+double computePolyhedronBrillouinSphereRadius( const Eigen::MatrixXd& verticesCoordinates )
+{
+    return verticesCoordinates.rowwise( ).norm( ).maxCoeff( );
+}
+
+//! Function to compute the nodes and weights of a Gauss-Legendre quadrature rule on the interval [0,1].
+static void computeUnitIntervalGaussLegendreRule( const int numberOfNodes,
+                                                  std::vector< double >& nodes,
+                                                  std::vector< double >& weights )
+{
+    nodes.resize( numberOfNodes );
+    weights.resize( numberOfNodes );
+    for( int i = 0; i < numberOfNodes; i++ )
+    {
+        // Find root of Legendre polynomial by Newton iteration, starting from Chebyshev-type approximation
+        double x = std::cos( mathematical_constants::PI * ( i + 0.75 ) / ( numberOfNodes + 0.5 ) );
+        double derivative = 0.0;
+        for( int iteration = 0; iteration < 100; iteration++ )
+        {
+            double currentValue = 1.0, previousValue = 0.0;
+            for( int degree = 1; degree <= numberOfNodes; degree++ )
+            {
+                const double secondPreviousValue = previousValue;
+                previousValue = currentValue;
+                currentValue = ( ( 2.0 * degree - 1.0 ) * x * previousValue - ( degree - 1.0 ) * secondPreviousValue ) /
+                        degree;
+            }
+            derivative = numberOfNodes * ( x * currentValue - previousValue ) / ( x * x - 1.0 );
+            const double correction = currentValue / derivative;
+            x -= correction;
+            if( std::fabs( correction ) < 1.0E-15 )
+            {
+                break;
+            }
+        }
+        nodes[ i ] = 0.5 * ( 1.0 - x );
+        weights[ i ] = 1.0 / ( ( 1.0 - x * x ) * derivative * derivative );
+    }
+}
+
+void computePolyhedronSphericalHarmonicCoefficients( const Eigen::MatrixXd& verticesCoordinates,
+                                                     const Eigen::MatrixXi& verticesDefiningEachFacet,
+                                                     const int maximumDegree,
+                                                     const double referenceRadius,
+                                                     Eigen::MatrixXd& cosineCoefficients,
+                                                     Eigen::MatrixXd& sineCoefficients )
+{
+    // Check if inputs are valid
+    basic_mathematics::checkValidityOfPolyhedronSettings ( verticesCoordinates, verticesDefiningEachFacet );
+    if( maximumDegree < 0 )
+    {
+        throw std::runtime_error( "Error when computing polyhedron spherical harmonic coefficients: maximum degree (" +
+                                  std::to_string( maximumDegree ) + ") must be non-negative." );
+    }
+
+    // Define collapsed Gauss-Legendre rule (Duffy transformation of unit cube to unit tetrahedron). The Jacobian adds two
+    // degrees to the integrand in the first and one degree in the second coordinate, which the rule integrates exactly.
+    const int numberOfNodes = maximumDegree / 2 + 2;
+    std::vector< double > nodes, weights;
+    computeUnitIntervalGaussLegendreRule( numberOfNodes, nodes, weights );
+
+    std::vector< Eigen::Vector4d > unitTetrahedronNodesAndWeights;
+    for( int i = 0; i < numberOfNodes; i++ )
+    {
+        for( int j = 0; j < numberOfNodes; j++ )
+        {
+            for( int k = 0; k < numberOfNodes; k++ )
+            {
+                const double a = nodes[ i ], b = nodes[ j ], c = nodes[ k ];
+                unitTetrahedronNodesAndWeights.push_back(
+                            Eigen::Vector4d( a, ( 1.0 - a ) * b, ( 1.0 - a ) * ( 1.0 - b ) * c,
+                                             weights[ i ] * weights[ j ] * weights[ k ] *
+                                             ( 1.0 - a ) * ( 1.0 - a ) * ( 1.0 - b ) ) );
+            }
+        }
+    }
+
+    basic_mathematics::LegendreCache legendreCache( maximumDegree, maximumDegree, true );
+    std::vector< double > cosinesOfLongitude( maximumDegree + 1 ), sinesOfLongitude( maximumDegree + 1 );
+    std::vector< double > radiusRatioPowers( maximumDegree + 1 );
+
+    cosineCoefficients.setZero( maximumDegree + 1, maximumDegree + 1 );
+    sineCoefficients.setZero( maximumDegree + 1, maximumDegree + 1 );
+    double volume = 0.0;
+
+    for( int facet = 0; facet < verticesDefiningEachFacet.rows( ); facet++ )
+    {
+        // Tetrahedron formed by origin and facet, with signed volume
+        Eigen::Matrix3d tetrahedronVertices;
+        for( int vertex = 0; vertex < 3; vertex++ )
+        {
+            tetrahedronVertices.col( vertex ) =
+                    verticesCoordinates.row( verticesDefiningEachFacet( facet, vertex ) ).transpose( );
+        }
+        const double jacobianDeterminant = tetrahedronVertices.determinant( );
+        volume += jacobianDeterminant / 6.0;
+
+        for( unsigned int node = 0; node < unitTetrahedronNodesAndWeights.size( ); node++ )
+        {
+            const Eigen::Vector3d position = tetrahedronVertices * unitTetrahedronNodesAndWeights[ node ].segment( 0, 3 );
+            const double weight = unitTetrahedronNodesAndWeights[ node ]( 3 ) * jacobianDeterminant;
+
+            const double radius = position.norm( );
+            const double horizontalRadius = std::sqrt( position( 0 ) * position( 0 ) + position( 1 ) * position( 1 ) );
+            legendreCache.update( position( 2 ) / radius );
+
+            // Compute trigonometric functions of multiples of longitude, and powers of radius ratio, by recursion
+            cosinesOfLongitude[ 0 ] = 1.0;
+            sinesOfLongitude[ 0 ] = 0.0;
+            const double cosineOfLongitude = ( horizontalRadius > 0.0 ) ? position( 0 ) / horizontalRadius : 1.0;
+            const double sineOfLongitude = ( horizontalRadius > 0.0 ) ? position( 1 ) / horizontalRadius : 0.0;
+            radiusRatioPowers[ 0 ] = 1.0;
+            for( int i = 1; i <= maximumDegree; i++ )
+            {
+                cosinesOfLongitude[ i ] = cosinesOfLongitude[ i - 1 ] * cosineOfLongitude -
+                        sinesOfLongitude[ i - 1 ] * sineOfLongitude;
+                sinesOfLongitude[ i ] = sinesOfLongitude[ i - 1 ] * cosineOfLongitude +
+                        cosinesOfLongitude[ i - 1 ] * sineOfLongitude;
+                radiusRatioPowers[ i ] = radiusRatioPowers[ i - 1 ] * radius / referenceRadius;
+            }
+
+            for( int degree = 0; degree <= maximumDegree; degree++ )
+            {
+                const double* legendrePolynomials = legendreCache.getLegendrePolynomialValuesOfDegree( degree );
+                const double degreeWeight = weight * radiusRatioPowers[ degree ];
+                for( int order = 0; order <= degree; order++ )
+                {
+                    cosineCoefficients( degree, order ) +=
+                            degreeWeight * legendrePolynomials[ order ] * cosinesOfLongitude[ order ];
+                    sineCoefficients( degree, order ) +=
+                            degreeWeight * legendrePolynomials[ order ] * sinesOfLongitude[ order ];
+                }
+            }
+        }
+    }
+
+    // Normalize coefficients: C_nm = 1 / ( ( 2n + 1 ) V ) * integral of ( r / R )^n P_nm cos( m lambda ) over volume
+    for( int degree = 0; degree <= maximumDegree; degree++ )
+    {
+        const double normalization = 1.0 / ( ( 2.0 * degree + 1.0 ) * volume );
+        cosineCoefficients.row( degree ) *= normalization;
+        sineCoefficients.row( degree ) *= normalization;
+    }
+    sineCoefficients.col( 0 ).setZero( );
+}
+
 } // namespace basic_astrodynamics
 } // namespace tudat
\ No newline at end of file
@@ -0,0 +1,480 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+#include <boost/filesystem.hpp>
+
+#include <Eigen/Geometry>
+
+#include "tudat/astro/basic_astro/polyhedronPreprocessing.h"
+#include "tudat/io/memoryMappedFile.h"
+
+namespace tudat
+{
+
+namespace basic_astrodynamics
+{
+
+//! Identifier at the start of each preprocessed polyhedron file
+static const char POLYHEDRON_FILE_IDENTIFIER[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'P', 'L', 'Y' };
+
+//! Version of the preprocessed polyhedron file format
+static const uint32_t POLYHEDRON_FILE_VERSION = 1;
+
+//! Byte order mark, to detect files written on platforms with different byte order
+static const uint32_t POLYHEDRON_FILE_BYTE_ORDER_MARK = 0x01020304;
+
+//! Size of the file header of a preprocessed polyhedron file
+static const std::size_t POLYHEDRON_FILE_HEADER_SIZE = 48;
+
+//! Function to add a block of memory to a 64-bit FNV-1a hash
+static void addToFnvHash( uint64_t& hash, const void* data, const std::size_t size )
+{
+    const unsigned char* bytes = static_cast< const unsigned char* >( data );
+    for( std::size_t i = 0; i < size; i++ )
+    {
+        hash ^= bytes[ i ];
+        hash *= 1099511628211ULL;
+    }
+}
+
+//! Function to compute a hash of the vertices and facets of a polyhedron.
+uint64_t computePolyhedronHash( const Eigen::MatrixXd& verticesCoordinates,
+                                const Eigen::MatrixXi& verticesDefiningEachFacet )
+{
+    uint64_t hash = 14695981039346656037ULL;
+    const uint64_t sizes[ 4 ] = { static_cast< uint64_t >( verticesCoordinates.rows( ) ),
+                                  static_cast< uint64_t >( verticesCoordinates.cols( ) ),
+                                  static_cast< uint64_t >( verticesDefiningEachFacet.rows( ) ),
+                                  static_cast< uint64_t >( verticesDefiningEachFacet.cols( ) ) };
+    addToFnvHash( hash, sizes, sizeof( sizes ) );
+    addToFnvHash( hash, verticesCoordinates.data( ), verticesCoordinates.size( ) * sizeof( double ) );
+    addToFnvHash( hash, verticesDefiningEachFacet.data( ), verticesDefiningEachFacet.size( ) * sizeof( int ) );
+    return hash;
+}
+
+//! Function to compute the vertices and facets defining each edge, according to Werner and Scheeres (1997).
+static void computeVerticesAndFacetsDefiningEachEdge( PolyhedronPreprocessedData& preprocessedData )
+{
+    const Eigen::MatrixXi& verticesDefiningEachFacet = preprocessedData.verticesDefiningEachFacet;
+    const unsigned int numberOfVertices = preprocessedData.verticesCoordinates.rows( );
+    const unsigned int numberOfFacets = verticesDefiningEachFacet.rows( );
+    const unsigned int numberOfEdges = 3 * ( numberOfVertices - 2 );
+
+    Eigen::MatrixXi& verticesDefiningEachEdge = preprocessedData.verticesDefiningEachEdge;
+    Eigen::MatrixXi& facetsDefiningEachEdge = preprocessedData.facetsDefiningEachEdge;
+    verticesDefiningEachEdge = Eigen::MatrixXi::Constant( numberOfEdges, 2, -1 );
+    facetsDefiningEachEdge = Eigen::MatrixXi::Constant( numberOfEdges, 2, -1 );
+
+    // Index of each inserted edge, with the (sorted) indices of its two vertices as key
+    std::unordered_map< uint64_t, unsigned int > edgeIndices;
+    edgeIndices.reserve( numberOfEdges );
+
+    unsigned int numberOfInsertedEdges = 0;
+    for ( unsigned int facet = 0; facet < numberOfFacets; ++facet )
+    {
+        for ( unsigned int i = 0; i < 3; ++i )
+        {
+            const int vertexA = verticesDefiningEachFacet( facet, i );
+            const int vertexB = verticesDefiningEachFacet( facet, ( i + 1 ) % 3 );
+            const uint64_t edgeKey = ( static_cast< uint64_t >( std::min( vertexA, vertexB ) ) << 32 ) |
+                    static_cast< uint32_t >( std::max( vertexA, vertexB ) );
+
+            // If edge was already inserted (by other facet), add current facet as second facet defining the edge;
+            // otherwise, insert edge
+            auto edgeIterator = edgeIndices.find( edgeKey );
+            if ( edgeIterator != edgeIndices.end( ) )
+            {
+                facetsDefiningEachEdge( edgeIterator->second, 1 ) = facet;
+            }
+            else
+            {
+                if ( numberOfInsertedEdges >= numberOfEdges )
+                {
+                    throw std::runtime_error( "Extracted number of polyhedron edges not correct." );
+                }
+                verticesDefiningEachEdge( numberOfInsertedEdges, 0 ) = vertexA;
+                verticesDefiningEachEdge( numberOfInsertedEdges, 1 ) = vertexB;
+                facetsDefiningEachEdge( numberOfInsertedEdges, 0 ) = facet;
+                edgeIndices[ edgeKey ] = numberOfInsertedEdges;
+                ++numberOfInsertedEdges;
+            }
+        }
+    }
+
+    // Sanity checks
+    if ( numberOfInsertedEdges != numberOfEdges )
+    {
+        throw std::runtime_error( "Extracted number of polyhedron edges not correct." );
+    }
+    for ( unsigned int i = 0; i < numberOfEdges; ++i )
+    {
+        for (unsigned int j : {0,1} )
+        {
+            if ( verticesDefiningEachEdge(i,j) < 0 )
+            {
+                throw std::runtime_error( "The vertices defining some edge were not selected." );
+            }
+            else if ( facetsDefiningEachEdge(i,j) < 0 )
+            {
+                throw std::runtime_error( "The facets defining some edge were not selected." );
+            }
+        }
+    }
+}
+
+//! Function to compute the facet normals and facet dyads, according to Werner and Scheeres (1997).
+static void computeFacetNormalsAndDyads( PolyhedronPreprocessedData& preprocessedData )
+{
+    const Eigen::MatrixXd& verticesCoordinates = preprocessedData.verticesCoordinates;
+    const Eigen::MatrixXi& verticesDefiningEachFacet = preprocessedData.verticesDefiningEachFacet;
+    const unsigned int numberOfFacets = verticesDefiningEachFacet.rows();
+
+    preprocessedData.facetNormalVectors.resize(numberOfFacets);
+    preprocessedData.facetDyads.resize(numberOfFacets);
+
+    // Loop over facets, and for each facet compute the facet normal and the facet dyad
+    for (unsigned int facet = 0; facet < numberOfFacets; ++facet)
+    {
+        Eigen::Vector3d vertex0 = verticesCoordinates.block<1,3>(verticesDefiningEachFacet(facet,0),0);
+        Eigen::Vector3d vertex1 = verticesCoordinates.block<1,3>(verticesDefiningEachFacet(facet,1),0);
+        Eigen::Vector3d vertex2 = verticesCoordinates.block<1,3>(verticesDefiningEachFacet(facet,2),0);
+
+        // Compute outward-pointing vector normal to facet
+        Eigen::Vector3d& facetNormalVector = preprocessedData.facetNormalVectors.at(facet);
+        facetNormalVector = (vertex1 - vertex0).cross(vertex2 - vertex1);
+        facetNormalVector.normalize();
+
+        // Compute facet dyad (outer product)
+        preprocessedData.facetDyads.at(facet) = facetNormalVector * facetNormalVector.transpose();
+    }
+}
+
+//! Function to compute the edge dyads, according to Werner and Scheeres (1997).
+static void computeEdgeDyads( PolyhedronPreprocessedData& preprocessedData )
+{
+    const Eigen::MatrixXd& verticesCoordinates = preprocessedData.verticesCoordinates;
+    const Eigen::MatrixXi& verticesDefiningEachFacet = preprocessedData.verticesDefiningEachFacet;
+    const Eigen::MatrixXi& verticesDefiningEachEdge = preprocessedData.verticesDefiningEachEdge;
+    const Eigen::MatrixXi& facetsDefiningEachEdge = preprocessedData.facetsDefiningEachEdge;
+    const unsigned int numberOfEdges = verticesDefiningEachEdge.rows();
+
+    preprocessedData.edgeDyads.resize(numberOfEdges);
+
+    // Loop over edges, and for each edge compute the edge dyad
+    for (unsigned int edge = 0; edge < numberOfEdges; ++edge)
+    {
+        Eigen::Vector3d vertex0 = verticesCoordinates.block<1,3>(verticesDefiningEachEdge(edge,0),0);
+        Eigen::Vector3d vertex1 = verticesCoordinates.block<1,3>(verticesDefiningEachEdge(edge,1),0);
+
+        // Compute edge normals, with arbitrary direction
+        Eigen::Vector3d facetNormalFacetA = preprocessedData.facetNormalVectors.at(facetsDefiningEachEdge(edge, 0) );
+        Eigen::Vector3d edgeNormalFacetA = ( vertex0 - vertex1).cross(facetNormalFacetA );
+        edgeNormalFacetA.normalize();
+        Eigen::Vector3d facetNormalFacetB = preprocessedData.facetNormalVectors.at(facetsDefiningEachEdge(edge, 1) );
+        Eigen::Vector3d edgeNormalFacetB = ( vertex0 - vertex1).cross(facetNormalFacetB );
+        edgeNormalFacetB.normalize();
+
+        // Check order of vertices for the facet associated with edgeNormalA, and correct the edge normal directions based on that
+        int vertex0FacetAIndex = -1, vertex1FacetAIndex = -1;
+        for (int facetVertex = 0; facetVertex < 3; ++facetVertex )
+        {
+            if ( verticesDefiningEachFacet(facetsDefiningEachEdge(edge,0), facetVertex) == verticesDefiningEachEdge(edge, 0) )
+            {
+                vertex0FacetAIndex = facetVertex;
+            }
+            else if ( verticesDefiningEachFacet(facetsDefiningEachEdge(edge,0), facetVertex) == verticesDefiningEachEdge(edge, 1) )
+            {
+                vertex1FacetAIndex = facetVertex;
+            }
+        }
+
+        if( vertex0FacetAIndex < 0 || vertex1FacetAIndex < 0 )
+        {
+            throw std::runtime_error( "Error when computing edge dyads in polyhedron gravity field; could not identify vertices" );
+        }
+
+        if (( vertex0FacetAIndex == vertex1FacetAIndex + 1) || ( vertex0FacetAIndex == 0 && vertex1FacetAIndex == 2 ) )
+        {
+            edgeNormalFacetB = - edgeNormalFacetB;
+        }
+        else
+        {
+            edgeNormalFacetA = - edgeNormalFacetA;
+        }
+
+        // Compute edge dyads: outer product
+        preprocessedData.edgeDyads.at(edge) =
+                facetNormalFacetA * edgeNormalFacetA.transpose() + facetNormalFacetB * edgeNormalFacetB.transpose();
+    }
+}
+
+//! Function to compute the preprocessed data of a polyhedron.
+std::shared_ptr< PolyhedronPreprocessedData > computePolyhedronPreprocessedData(
+        const Eigen::MatrixXd& verticesCoordinates,
+        const Eigen::MatrixXi& verticesDefiningEachFacet )
+{
+    std::shared_ptr< PolyhedronPreprocessedData > preprocessedData = std::make_shared< PolyhedronPreprocessedData >( );
+    preprocessedData->verticesCoordinates = verticesCoordinates;
+    preprocessedData->verticesDefiningEachFacet = verticesDefiningEachFacet;
+
+    computeVerticesAndFacetsDefiningEachEdge( *preprocessedData );
+    computeFacetNormalsAndDyads( *preprocessedData );
+    computeEdgeDyads( *preprocessedData );
+
+    return preprocessedData;
+}
+
+//! Function to write the preprocessed data of a polyhedron to a binary file.
+void writePolyhedronPreprocessedDataToBinaryFile(
+        const std::string& fileName,
+        const PolyhedronPreprocessedData& preprocessedData )
+{
+    std::ofstream dataStream( fileName, std::ios::binary | std::ios::trunc );
+    if( !dataStream.is_open( ) )
+    {
+        throw std::runtime_error( "Error when writing preprocessed polyhedron file " + fileName +
+                                  ", file could not be opened." );
+    }
+
+    // Write header
+    const uint64_t sizes[ 4 ] = {
+        computePolyhedronHash( preprocessedData.verticesCoordinates, preprocessedData.verticesDefiningEachFacet ),
+        static_cast< uint64_t >( preprocessedData.verticesCoordinates.rows( ) ),
+        static_cast< uint64_t >( preprocessedData.verticesDefiningEachFacet.rows( ) ),
+        static_cast< uint64_t >( preprocessedData.verticesDefiningEachEdge.rows( ) ) };
+    dataStream.write( POLYHEDRON_FILE_IDENTIFIER, 8 );
+    dataStream.write( reinterpret_cast< const char* >( &POLYHEDRON_FILE_VERSION ), sizeof( uint32_t ) );
+    dataStream.write( reinterpret_cast< const char* >( &POLYHEDRON_FILE_BYTE_ORDER_MARK ), sizeof( uint32_t ) );
+    dataStream.write( reinterpret_cast< const char* >( sizes ), sizeof( sizes ) );
+
+    // Write floating point data first (so that it is aligned), followed by the indices
+    dataStream.write( reinterpret_cast< const char* >( preprocessedData.verticesCoordinates.data( ) ),
+                      preprocessedData.verticesCoordinates.size( ) * sizeof( double ) );
+    for( const Eigen::Vector3d& facetNormal: preprocessedData.facetNormalVectors )
+    {
+        dataStream.write( reinterpret_cast< const char* >( facetNormal.data( ) ), 3 * sizeof( double ) );
+    }
+    for( const std::vector< Eigen::MatrixXd >* dyads: { &preprocessedData.facetDyads, &preprocessedData.edgeDyads } )
+    {
+        for( const Eigen::MatrixXd& dyad: *dyads )
+        {
+            dataStream.write( reinterpret_cast< const char* >( dyad.data( ) ), 9 * sizeof( double ) );
+        }
+    }
+    for( const Eigen::MatrixXi* indices: { &preprocessedData.verticesDefiningEachFacet,
+                                           &preprocessedData.verticesDefiningEachEdge,
+                                           &preprocessedData.facetsDefiningEachEdge } )
+    {
+        dataStream.write( reinterpret_cast< const char* >( indices->data( ) ), indices->size( ) * sizeof( int ) );
+    }
+
+    if( !dataStream )
+    {
+        throw std::runtime_error( "Error when writing preprocessed polyhedron file " + fileName +
+                                  ", file could not be written." );
+    }
+}
+
+//! Function to read the preprocessed data of a polyhedron from a binary file.
+std::shared_ptr< PolyhedronPreprocessedData > readPolyhedronPreprocessedDataFromBinaryFile(
+        const std::string& fileName,
+        const Eigen::MatrixXd& verticesCoordinates,
+        const Eigen::MatrixXi& verticesDefiningEachFacet )
+{
+    if( !boost::filesystem::exists( fileName ) )
+    {
+        return nullptr;
+    }
+
+    input_output::MemoryMappedFile mappedFile( fileName );
+    const char* fileData = mappedFile.getData( );
+    const std::size_t fileSize = mappedFile.getSize( );
+
+    // Check header
+    if( fileSize < POLYHEDRON_FILE_HEADER_SIZE || std::memcmp( fileData, POLYHEDRON_FILE_IDENTIFIER, 8 ) != 0 )
+    {
+        return nullptr;
+    }
+    uint32_t version, byteOrderMark;
+    uint64_t sizes[ 4 ];
+    std::memcpy( &version, fileData + 8, sizeof( uint32_t ) );
+    std::memcpy( &byteOrderMark, fileData + 12, sizeof( uint32_t ) );
+    std::memcpy( sizes, fileData + 16, sizeof( sizes ) );
+    const uint64_t numberOfVertices = sizes[ 1 ], numberOfFacets = sizes[ 2 ], numberOfEdges = sizes[ 3 ];
+    if( version != POLYHEDRON_FILE_VERSION || byteOrderMark != POLYHEDRON_FILE_BYTE_ORDER_MARK ||
+            sizes[ 0 ] != computePolyhedronHash( verticesCoordinates, verticesDefiningEachFacet ) ||
+            numberOfVertices != static_cast< uint64_t >( verticesCoordinates.rows( ) ) ||
+            numberOfFacets != static_cast< uint64_t >( verticesDefiningEachFacet.rows( ) ) ||
+            verticesCoordinates.cols( ) != 3 || verticesDefiningEachFacet.cols( ) != 3 )
+    {
+        return nullptr;
+    }
+    const std::size_t expectedFileSize = POLYHEDRON_FILE_HEADER_SIZE +
+            ( 3 * numberOfVertices + 3 * numberOfFacets + 9 * numberOfFacets + 9 * numberOfEdges ) * sizeof( double ) +
+            ( 3 * numberOfFacets + 4 * numberOfEdges ) * sizeof( int );
+    if( fileSize != expectedFileSize )
+    {
+        return nullptr;
+    }
+
+    // Check that the file was written for the same polyhedron (and not just one with the same hash)
+    const char* currentData = fileData + POLYHEDRON_FILE_HEADER_SIZE;
+    const std::size_t verticesSize = verticesCoordinates.size( ) * sizeof( double );
+    const std::size_t facetsSize = verticesDefiningEachFacet.size( ) * sizeof( int );
+    const char* facetsData = fileData + expectedFileSize - facetsSize - 4 * numberOfEdges * sizeof( int );
+    if( std::memcmp( currentData, verticesCoordinates.data( ), verticesSize ) != 0 ||
+            std::memcmp( facetsData, verticesDefiningEachFacet.data( ), facetsSize ) != 0 )
+    {
+        return nullptr;
+    }
+    currentData += verticesSize;
+
+    // Copy data from memory mapping
+    std::shared_ptr< PolyhedronPreprocessedData > preprocessedData = std::make_shared< PolyhedronPreprocessedData >( );
+    preprocessedData->verticesCoordinates = verticesCoordinates;
+    preprocessedData->verticesDefiningEachFacet = verticesDefiningEachFacet;
+
+    preprocessedData->facetNormalVectors.resize( numberOfFacets );
+    for( Eigen::Vector3d& facetNormal: preprocessedData->facetNormalVectors )
+    {
+        std::memcpy( facetNormal.data( ), currentData, 3 * sizeof( double ) );
+        currentData += 3 * sizeof( double );
+    }
+    preprocessedData->facetDyads.resize( numberOfFacets );
+    preprocessedData->edgeDyads.resize( numberOfEdges );
+    for( std::vector< Eigen::MatrixXd >* dyads: { &preprocessedData->facetDyads, &preprocessedData->edgeDyads } )
+    {
+        for( Eigen::MatrixXd& dyad: *dyads )
+        {
+            dyad.resize( 3, 3 );
+            std::memcpy( dyad.data( ), currentData, 9 * sizeof( double ) );
+            currentData += 9 * sizeof( double );
+        }
+    }
+    currentData += facetsSize;
+    preprocessedData->verticesDefiningEachEdge.resize( numberOfEdges, 2 );
+    preprocessedData->facetsDefiningEachEdge.resize( numberOfEdges, 2 );
+    for( Eigen::MatrixXi* indices: { &preprocessedData->verticesDefiningEachEdge,
+                                     &preprocessedData->facetsDefiningEachEdge } )
+    {
+        std::memcpy( indices->data( ), currentData, indices->size( ) * sizeof( int ) );
+        currentData += indices->size( ) * sizeof( int );
+    }
+
+    return preprocessedData;
+}
+
+//! Process-wide caches of preprocessed polyhedron data, and mutex for their access
+struct PolyhedronPreprocessedDataCache
+{
+    std::mutex cacheMutex;
+
+    //! Directory in which preprocessed data is cached on disk (empty if disabled)
+    std::string cacheDirectory;
+
+    //! Preprocessed data that is currently in use, with hash of polyhedron as key
+    std::multimap< uint64_t, std::weak_ptr< const PolyhedronPreprocessedData > > dataInUse;
+};
+
+//! Function to retrieve the process-wide cache of preprocessed polyhedron data, created on first use
+static PolyhedronPreprocessedDataCache& getPolyhedronPreprocessedDataCache( )
+{
+    static PolyhedronPreprocessedDataCache polyhedronPreprocessedDataCache;
+    return polyhedronPreprocessedDataCache;
+}
+
+//! Function to set the directory in which preprocessed polyhedron data is cached on disk.
+void setPolyhedronPreprocessedDataCacheDirectory( const std::string& cacheDirectory )
+{
+    PolyhedronPreprocessedDataCache& cache = getPolyhedronPreprocessedDataCache( );
+    std::lock_guard< std::mutex > lock( cache.cacheMutex );
+    cache.cacheDirectory = cacheDirectory;
+}
+
+//! Function to retrieve the directory in which preprocessed polyhedron data is cached on disk (empty if disabled).
+std::string getPolyhedronPreprocessedDataCacheDirectory( )
+{
+    PolyhedronPreprocessedDataCache& cache = getPolyhedronPreprocessedDataCache( );
+    std::lock_guard< std::mutex > lock( cache.cacheMutex );
+    return cache.cacheDirectory;
+}
+
+//! Function to retrieve the preprocessed data of a polyhedron, reusing previously computed data where possible.
+std::shared_ptr< const PolyhedronPreprocessedData > getPolyhedronPreprocessedData(
+        const Eigen::MatrixXd& verticesCoordinates,
+        const Eigen::MatrixXi& verticesDefiningEachFacet )
+{
+    const uint64_t hash = computePolyhedronHash( verticesCoordinates, verticesDefiningEachFacet );
+
+    // Lock for the full retrieval, so that the same polyhedron is never preprocessed twice concurrently
+    PolyhedronPreprocessedDataCache& cache = getPolyhedronPreprocessedDataCache( );
+    std::lock_guard< std::mutex > lock( cache.cacheMutex );
+
+    // Check if data is currently in use (removing expired entries with the same hash)
+    auto range = cache.dataInUse.equal_range( hash );
+    for( auto it = range.first; it != range.second; )
+    {
+        std::shared_ptr< const PolyhedronPreprocessedData > preprocessedData = it->second.lock( );
+        if( preprocessedData == nullptr )
+        {
+            it = cache.dataInUse.erase( it );
+        }
+        else if( preprocessedData->verticesCoordinates == verticesCoordinates &&
+                 preprocessedData->verticesDefiningEachFacet == verticesDefiningEachFacet )
+        {
+            return preprocessedData;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    // Read data from disk cache if available, compute it otherwise
+    std::shared_ptr< PolyhedronPreprocessedData > preprocessedData;
+    std::string cacheFile;
+    if( !cache.cacheDirectory.empty( ) )
+    {
+        std::ostringstream fileNameStream;
+        fileNameStream << "polyhedron_" << std::hex << std::setw( 16 ) << std::setfill( '0' ) << hash << ".bin";
+        cacheFile = ( boost::filesystem::path( cache.cacheDirectory ) / fileNameStream.str( ) ).string( );
+        preprocessedData = readPolyhedronPreprocessedDataFromBinaryFile(
+                    cacheFile, verticesCoordinates, verticesDefiningEachFacet );
+    }
+
+    if( preprocessedData == nullptr )
+    {
+        preprocessedData = computePolyhedronPreprocessedData( verticesCoordinates, verticesDefiningEachFacet );
+        if( !cacheFile.empty( ) )
+        {
+            // Write to temporary file first, so that other processes never read a partially written file
+            boost::filesystem::create_directories( cache.cacheDirectory );
+            const std::string temporaryFile = boost::filesystem::unique_path( cacheFile + ".%%%%%%" ).string( );
+            writePolyhedronPreprocessedDataToBinaryFile( temporaryFile, *preprocessedData );
+            boost::filesystem::rename( temporaryFile, cacheFile );
+        }
+    }
+
+    cache.dataInUse.insert( std::make_pair( hash, preprocessedData ) );
+    return preprocessedData;
+}
+
+} // namespace basic_astrodynamics
+
+} // namespace tudat
@@ -9,8 +9,19 @@
  *
  */
 
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <ctime>
+#include <mutex>
+
+#include <boost/filesystem.hpp>
+
 #include "tudat/astro/basic_astro/unitConversions.h"
 #include "tudat/astro/earth_orientation/eopReader.h"
+#include "tudat/io/memoryMappedFile.h"
 
 namespace tudat
 {
@@ -18,10 +29,105 @@ namespace tudat
 namespace earth_orientation
 {
 
+//! Maximum number of fields of an EOP file line that are processed
+static const int MAXIMUM_NUMBER_OF_EOP_FIELDS = 17;
+
+//! Number of fields of a line of data in a C04 EOP file
+static const int NUMBER_OF_C04_DATA_FIELDS = 16;
+
+//! Function to split a line of an EOP file into whitespace-separated fields
+/*!
+ * Function to split a line of an EOP file into whitespace-separated fields
+ * \param lineBegin Pointer to the start of the line
+ * \param lineEnd Pointer to the end of the line (excluding newline)
+ * \param fieldBegins Pointers to the start of the fields (returned by reference)
+ * \param fieldEnds Pointers to the end of the fields (returned by reference)
+ * \return Number of fields in the line (limited to MAXIMUM_NUMBER_OF_EOP_FIELDS)
+ */
+static int splitEopFileLine( const char* lineBegin, const char* lineEnd,
+                             const char* fieldBegins[ ], const char* fieldEnds[ ] )
+{
+    int numberOfFields = 0;
+    const char* current = lineBegin;
+    while( current < lineEnd && numberOfFields < MAXIMUM_NUMBER_OF_EOP_FIELDS )
+    {
+        while( current < lineEnd && std::isspace( static_cast< unsigned char >( *current ) ) )
+        {
+            current++;
+        }
+        if( current == lineEnd )
+        {
+            break;
+        }
+        fieldBegins[ numberOfFields ] = current;
+        while( current < lineEnd && !std::isspace( static_cast< unsigned char >( *current ) ) )
+        {
+            current++;
+        }
+        fieldEnds[ numberOfFields ] = current;
+        numberOfFields++;
+    }
+    return numberOfFields;
+}
+
+//! Function to retrieve the next line of an EOP file
+/*!
+ * Function to retrieve the next line of an EOP file
+ * \param position Current position in the file, set to the start of the next line (modified by reference)
+ * \param end End of the file
+ * \return Pointer to the end of the current line (excluding newline)
+ */
+static const char* getNextEopFileLine( const char*& position, const char* end )
+{
+    const char* lineEnd = static_cast< const char* >(
+                std::memchr( position, '\n', static_cast< std::size_t >( end - position ) ) );
+    if( lineEnd == nullptr )
+    {
+        position = end;
+        return end;
+    }
+    position = lineEnd + 1;
+    return lineEnd;
+}
+
+//! Function to parse a single field of an EOP file as a double
+static double parseEopFileField( const char* fieldBegin, const char* fieldEnd, const std::string& fileName )
+{
+    double value;
+    std::from_chars_result result = std::from_chars( fieldBegin, fieldEnd, value );
+    if( result.ec != std::errc( ) || result.ptr != fieldEnd )
+    {
+        throw std::runtime_error( "Error when reading EOP file " + fileName + ", could not parse value " +
+                                  std::string( fieldBegin, fieldEnd ) );
+    }
+    return value;
+}
+
+//! Function to find the modified Julian day of the first line of data at or after a given position in an EOP file
+static bool getFirstEopFileDataLineDay( const char* position, const char* end, double& modifiedJulianDay,
+                                        const std::string& fileName )
+{
+    const char* fieldBegins[ MAXIMUM_NUMBER_OF_EOP_FIELDS ];
+    const char* fieldEnds[ MAXIMUM_NUMBER_OF_EOP_FIELDS ];
+    while( position < end )
+    {
+        const char* lineBegin = position;
+        const char* lineEnd = getNextEopFileLine( position, end );
+        if( splitEopFileLine( lineBegin, lineEnd, fieldBegins, fieldEnds ) == NUMBER_OF_C04_DATA_FIELDS )
+        {
+            modifiedJulianDay = parseEopFileField( fieldBegins[ 3 ], fieldEnds[ 3 ], fileName );
+            return true;
+        }
+    }
+    return false;
+}
+
 //! Constructor
 EOPReader::EOPReader( const std::string& eopFile,
                       const std::string& format,
-                      const basic_astrodynamics::IAUConventions nutationTheory )
+                      const basic_astrodynamics::IAUConventions nutationTheory,
+                      const double startTime,
+                      const double endTime )
 {
     if( format != "C04" )
     {
@@ -31,83 +137,222 @@ EOPReader::EOPReader( const std::string& eopFile,
     {
         std::cerr << ( "Warning, only IAU2000 nutation theory format currently supported by reader." ) << std::endl;
     }
-    readEopFile( eopFile );
+    if( !( startTime <= endTime ) )
+    {
+        throw std::runtime_error( "Error when reading EOP file, start of time window is after end of window." );
+    }
+
+    // Convert time window to modified Julian days, including margin for interpolation
+    double mjdOnJ2000 = basic_astrodynamics::JULIAN_DAY_ON_J2000 - basic_astrodynamics::JULIAN_DAY_AT_0_MJD;
+    readEopFile( eopFile,
+                 std::floor( startTime / physical_constants::JULIAN_DAY + mjdOnJ2000 ) - EOP_READER_WINDOW_MARGIN,
+                 std::ceil( endTime / physical_constants::JULIAN_DAY + mjdOnJ2000 ) + EOP_READER_WINDOW_MARGIN );
+}
+
+//! Function to retrieve the index of the last day at or before a given modified Julian day
+int EOPReader::getDayIndex( const double modifiedJulianDay ) const
+{
+    if( modifiedJulianDays_.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when retrieving EOP data index, no data has been read." );
+    }
+
+    int numberOfDays = static_cast< int >( modifiedJulianDays_.size( ) );
+    if( !( modifiedJulianDay > modifiedJulianDays_.front( ) ) )
+    {
+        return 0;
+    }
+    else if( modifiedJulianDay >= modifiedJulianDays_.back( ) )
+    {
+        return numberOfDays - 1;
+    }
+    else if( areDaysConsecutive_ )
+    {
+        return static_cast< int >( std::floor( modifiedJulianDay - modifiedJulianDays_.front( ) ) );
+    }
+    else
+    {
+        return static_cast< int >( std::upper_bound( modifiedJulianDays_.begin( ), modifiedJulianDays_.end( ),
+                                                     modifiedJulianDay ) - modifiedJulianDays_.begin( ) ) - 1;
+    }
 }
 
 //! Function to read EOP file
-void EOPReader::readEopFile( const std::string& fileName )
+void EOPReader::readEopFile( const std::string& fileName,
+                             const double startModifiedJulianDay,
+                             const double endModifiedJulianDay )
 {
     using namespace tudat::unit_conversions;
 
-    // Open file and create file stream.
-    std::fstream stream( fileName.c_str( ), std::ios::in );
-
-    // Check if file opened correctly.
-    if ( stream.fail( ) )
+    // Map file into memory
+    std::shared_ptr< input_output::MemoryMappedFile > mappedFile;
+    try
+    {
+        mappedFile = std::make_shared< input_output::MemoryMappedFile >( fileName );
+    }
+    catch( const std::runtime_error& )
     {
         throw std::runtime_error( "Data file could not be opened." + fileName );
     }
+    const char* position = mappedFile->getData( );
+    const char* end = position + mappedFile->getSize( );
 
-    // Initialize boolean that gets set to true once the file header is passed.
-    bool isHeaderPassed = 0;
+    const char* fieldBegins[ MAXIMUM_NUMBER_OF_EOP_FIELDS ];
+    const char* fieldEnds[ MAXIMUM_NUMBER_OF_EOP_FIELDS ];
 
-    // Line based parsing
-    std::string line;
-    std::vector< std::string > vectorOfIndividualStrings;
-    while ( !stream.fail( ) && !stream.eof( ) )
+    // Find line with entry names, and check entry names.
+    bool isHeaderPassed = false;
+    while( !isHeaderPassed && position < end )
     {
-        // Get line from stream
-        std::getline( stream, line );
-
-        // Trim input string (removes all leading and trailing whitespaces).
-        boost::algorithm::trim( line );
-
-        // Split string into multiple strings, each containing one element from a line from the
-        // data file.
-        boost::algorithm::split( vectorOfIndividualStrings,
-                                 line,
-                                 boost::algorithm::is_any_of( " " ),
-                                 boost::algorithm::token_compress_on );
-
-        // If first line before data is found, check entry names and set isHeaderPassed to true.
-        if( !isHeaderPassed && vectorOfIndividualStrings[ 0 ] == "Date" )
+        const char* lineBegin = position;
+        const char* lineEnd = getNextEopFileLine( position, end );
+        int numberOfFields = splitEopFileLine( lineBegin, lineEnd, fieldBegins, fieldEnds );
+        if( numberOfFields > 0 && std::string( fieldBegins[ 0 ], fieldEnds[ 0 ] ) == "Date" )
         {
-            if( vectorOfIndividualStrings[ 6 ] == "dPsi" )
+            if( numberOfFields > 6 && std::string( fieldBegins[ 6 ], fieldEnds[ 6 ] ) == "dPsi" )
             {
                 throw std::runtime_error( "Warning, found dPsi, expected dX as CIP offset in GCRS, wrong nutation format requested" );
             }
-            else if( vectorOfIndividualStrings[ 7 ] == "dEps" )
+            else if( numberOfFields > 7 && std::string( fieldBegins[ 7 ], fieldEnds[ 7 ] ) == "dEps" )
             {
                 throw std::runtime_error( "Warning, found dEps, expected dY as CIP offset in GCRS, wrong nutation format requested" );
             }
-
-            isHeaderPassed = 1;
+            isHeaderPassed = true;
         }
+    }
 
-        // Read line of data and set values.
-        if( isHeaderPassed && vectorOfIndividualStrings.size( ) == 16 )
+    // Locate start of time window by bisection (data is sorted by date), so that preceding data need not be parsed.
+    if( std::isfinite( startModifiedJulianDay ) )
+    {
+        const char* lowerBound = position;
+        const char* upperBound = end;
+        while( upperBound - lowerBound > 4096 )
         {
+            const char* middle = lowerBound + ( upperBound - lowerBound ) / 2;
+            getNextEopFileLine( middle, upperBound );
 
-            // Read pole positions.
-            cipInItrs[ std::stod( vectorOfIndividualStrings[ 3 ] ) ].x( ) =
-                    convertArcSecondsToRadians< double >( std::stod( vectorOfIndividualStrings[ 4 ] ) );
-            cipInItrs[ std::stod( vectorOfIndividualStrings[ 3 ] ) ].y( ) =
-                    convertArcSecondsToRadians< double >( std::stod( vectorOfIndividualStrings[ 5 ] ) );
+            double modifiedJulianDay;
+            if( !getFirstEopFileDataLineDay( middle, upperBound, modifiedJulianDay, fileName ) ||
+                    modifiedJulianDay >= startModifiedJulianDay )
+            {
+                upperBound = middle;
+            }
+            else
+            {
+                lowerBound = middle;
+            }
+        }
+        position = lowerBound;
+    }
 
-            // Read UTC-UT1 and LOD corrections
-            ut1MinusUtc[ std::stod( vectorOfIndividualStrings[ 3 ] ) ] =
-                    std::stod( vectorOfIndividualStrings[ 6 ] );
-            lengthOfDayOffset[ std::stod( vectorOfIndividualStrings[ 3 ] ) ] =
-                    std::stod( vectorOfIndividualStrings[ 7 ] );
+    // Read data lines in time window
+    areDaysConsecutive_ = true;
+    while( position < end )
+    {
+        const char* lineBegin = position;
+        const char* lineEnd = getNextEopFileLine( position, end );
+        if( splitEopFileLine( lineBegin, lineEnd, fieldBegins, fieldEnds ) != NUMBER_OF_C04_DATA_FIELDS )
+        {
+            continue;
+        }
 
-            // Read precession-nutation corrections.
-            cipInGcrsCorrection[ std::stod( vectorOfIndividualStrings[ 3 ] ) ].x( ) =
-                    convertArcSecondsToRadians< double >( std::stod( vectorOfIndividualStrings[ 8 ] ) );
-            cipInGcrsCorrection[ std::stod( vectorOfIndividualStrings[ 3 ] ) ].y( ) =
-                    convertArcSecondsToRadians< double >( std::stod( vectorOfIndividualStrings[ 9 ] ) );
+        double modifiedJulianDay = parseEopFileField( fieldBegins[ 3 ], fieldEnds[ 3 ], fileName );
+        if( modifiedJulianDay < startModifiedJulianDay )
+        {
+            continue;
+        }
+        else if( modifiedJulianDay > endModifiedJulianDay )
+        {
+            break;
+        }
 
+        if( modifiedJulianDays_.size( ) > 0 && modifiedJulianDay != modifiedJulianDays_.back( ) + 1.0 )
+        {
+            if( !( modifiedJulianDay > modifiedJulianDays_.back( ) ) )
+            {
+                throw std::runtime_error( "Error when reading EOP file " + fileName + ", data is not sorted by date." );
+            }
+            areDaysConsecutive_ = false;
         }
+        modifiedJulianDays_.push_back( modifiedJulianDay );
+
+        // Read pole positions, UTC-UT1 and LOD corrections, and precession-nutation corrections.
+        eopData_.push_back( convertArcSecondsToRadians< double >(
+                                parseEopFileField( fieldBegins[ 4 ], fieldEnds[ 4 ], fileName ) ) );
+        eopData_.push_back( convertArcSecondsToRadians< double >(
+                                parseEopFileField( fieldBegins[ 5 ], fieldEnds[ 5 ], fileName ) ) );
+        eopData_.push_back( parseEopFileField( fieldBegins[ 6 ], fieldEnds[ 6 ], fileName ) );
+        eopData_.push_back( parseEopFileField( fieldBegins[ 7 ], fieldEnds[ 7 ], fileName ) );
+        eopData_.push_back( convertArcSecondsToRadians< double >(
+                                parseEopFileField( fieldBegins[ 8 ], fieldEnds[ 8 ], fileName ) ) );
+        eopData_.push_back( convertArcSecondsToRadians< double >(
+                                parseEopFileField( fieldBegins[ 9 ], fieldEnds[ 9 ], fileName ) ) );
+    }
+}
+
+//! Cached EOP data of a single file, with the properties of the file from which it was read
+struct CachedEOPReader
+{
+    //! Size of the file (in bytes) when it was read
+    uintmax_t fileSize;
+
+    //! Modification time of the file when it was read
+    std::time_t modificationTime;
+
+    //! Reader containing the EOP data of the file
+    std::shared_ptr< EOPReader > eopReader;
+};
+
+//! Cache of EOP data, with file name and format as key, and mutex for its access
+struct EOPReaderCache
+{
+    std::mutex cacheMutex;
+
+    std::map< std::pair< std::string, std::string >, CachedEOPReader > cachedReaders;
+};
+
+//! Function to retrieve the (process-wide) cache of EOP data, created on first use (which may be during static
+//! initialization of default time converters)
+static EOPReaderCache& getEOPReaderCache( )
+{
+    static EOPReaderCache eopReaderCache;
+    return eopReaderCache;
+}
+
+//! Function to load the EOP data of a file, sharing a single copy of the data of each file within the process
+std::shared_ptr< EOPReader > loadEOPReader(
+        const std::string& eopFile,
+        const std::string& format,
+        const basic_astrodynamics::IAUConventions nutationTheory )
+{
+    boost::system::error_code errorCode;
+    uintmax_t fileSize = boost::filesystem::file_size( eopFile, errorCode );
+    std::time_t modificationTime = errorCode ? 0 : boost::filesystem::last_write_time( eopFile, errorCode );
+
+    // Parse file if it is not yet in the cache, or if it has changed since it was parsed. The lock is held while
+    // parsing, so that concurrent requests for the same file wait for the result instead of parsing it again.
+    EOPReaderCache& eopReaderCache = getEOPReaderCache( );
+    std::lock_guard< std::mutex > cacheLock( eopReaderCache.cacheMutex );
+    auto cacheIterator = eopReaderCache.cachedReaders.find( std::make_pair( eopFile, format ) );
+    if( cacheIterator == eopReaderCache.cachedReaders.end( ) || errorCode ||
+            cacheIterator->second.fileSize != fileSize || cacheIterator->second.modificationTime != modificationTime )
+    {
+        CachedEOPReader cachedReader;
+        cachedReader.fileSize = fileSize;
+        cachedReader.modificationTime = modificationTime;
+        cachedReader.eopReader = std::make_shared< EOPReader >( eopFile, format, nutationTheory );
+        cacheIterator = eopReaderCache.cachedReaders.insert_or_assign(
+                    std::make_pair( eopFile, format ), cachedReader ).first;
     }
+    return cacheIterator->second.eopReader;
+}
+
+//! Function to clear the cache of EOP data used by loadEOPReader
+void clearEOPReaderCache( )
+{
+    EOPReaderCache& eopReaderCache = getEOPReaderCache( );
+    std::lock_guard< std::mutex > cacheLock( eopReaderCache.cacheMutex );
+    eopReaderCache.cachedReaders.clear( );
 }
 
 }
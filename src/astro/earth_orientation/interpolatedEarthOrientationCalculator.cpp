@@ -0,0 +1,171 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+
+#include "tudat/astro/earth_orientation/interpolatedEarthOrientationCalculator.h"
+
+namespace tudat
+{
+
+namespace earth_orientation
+{
+
+//! Constructor, tabulates the earth orientation angles
+InterpolatedEarthOrientationAnglesCalculator::InterpolatedEarthOrientationAnglesCalculator(
+        const std::shared_ptr< EarthOrientationAnglesCalculator > anglesCalculator,
+        const basic_astrodynamics::TimeScales inputTimeScale,
+        const double startTime,
+        const double endTime,
+        const double angularAccuracy,
+        const int numberOfInterpolationPoints,
+        const double initialTimeStep,
+        const double minimumTimeStep ):
+    anglesCalculator_( anglesCalculator ), inputTimeScale_( inputTimeScale ),
+    startTime_( startTime ), endTime_( endTime ), numberOfInterpolationPoints_( numberOfInterpolationPoints ),
+    maximumInterpolationError_( TUDAT_NAN )
+{
+    if( numberOfInterpolationPoints_ < 4 || numberOfInterpolationPoints_ > 12 || numberOfInterpolationPoints_ % 2 != 0 )
+    {
+        throw std::runtime_error( "Error when creating interpolated Earth orientation, number of interpolation points (" +
+                                  std::to_string( numberOfInterpolationPoints_ ) + ") must be even, and between 4 and 12" );
+    }
+
+    if( !( endTime_ > startTime_ ) )
+    {
+        throw std::runtime_error( "Error when creating interpolated Earth orientation, end time must be larger than start time" );
+    }
+
+    // Compute denominators of Lagrange polynomials, for nodes at 0, 1, ...,  N-1
+    lagrangeDenominators_.resize( numberOfInterpolationPoints_ );
+    for( int i = 0; i < numberOfInterpolationPoints_; i++ )
+    {
+        lagrangeDenominators_[ i ] = 1.0;
+        for( int j = 0; j < numberOfInterpolationPoints_; j++ )
+        {
+            if( j != i )
+            {
+                lagrangeDenominators_[ i ] *= static_cast< double >( i - j );
+            }
+        }
+    }
+
+    // Conversion of UT1 error to error in Earth rotation angle
+    const double earthRotationAngleRate = 2.0 * mathematical_constants::PI / 86400.0 * 1.00273781191135448;
+
+    // Refine time step until required accuracy is met
+    double currentTimeStep = std::min( initialTimeStep,
+                                       ( endTime_ - startTime_ ) / static_cast< double >( numberOfInterpolationPoints_ ) );
+    while( true )
+    {
+        tabulateValues( currentTimeStep );
+
+        // Check interpolation error at midpoints between tabulation points
+        maximumInterpolationError_ = 0.0;
+        Eigen::Vector6d interpolatedValues;
+        for( int i = 0; i < numberOfTabulationPoints_ - 1; i++ )
+        {
+            double currentTime = std::min( startTime_ + ( static_cast< double >( i ) + 0.5 ) * timeStep_, endTime_ );
+            interpolateValues( currentTime, interpolatedValues );
+            Eigen::Vector6d interpolationError = ( interpolatedValues - computeValuesDirectly( currentTime ) ).cwiseAbs( );
+            interpolationError( 5 ) *= earthRotationAngleRate;
+            maximumInterpolationError_ = std::max( maximumInterpolationError_, interpolationError.maxCoeff( ) );
+        }
+
+        if( maximumInterpolationError_ <= angularAccuracy )
+        {
+            break;
+        }
+        else if( currentTimeStep / 2.0 < minimumTimeStep )
+        {
+            std::cerr << "Warning when creating interpolated Earth orientation, required accuracy of "
+                      << angularAccuracy << " rad not met at minimum time step of " << timeStep_
+                      << " s; maximum error is " << maximumInterpolationError_ << " rad" << std::endl;
+            break;
+        }
+        currentTimeStep /= 2.0;
+    }
+}
+
+//! Function to tabulate the angles with the given time step
+void InterpolatedEarthOrientationAnglesCalculator::tabulateValues( const double timeStep )
+{
+    // Set equidistant grid that covers full interval (last point may be beyond end time)
+    numberOfTabulationPoints_ = static_cast< int >( std::ceil( ( endTime_ - startTime_ ) / timeStep - 1.0E-9 ) ) + 1;
+    numberOfTabulationPoints_ = std::max( numberOfTabulationPoints_, numberOfInterpolationPoints_ );
+    timeStep_ = timeStep;
+    inverseTimeStep_ = 1.0 / timeStep_;
+
+    tabulatedValues_.resize( 6 * numberOfTabulationPoints_ );
+    for( int i = 0; i < numberOfTabulationPoints_; i++ )
+    {
+        Eigen::Vector6d currentValues = computeValuesDirectly( startTime_ + static_cast< double >( i ) * timeStep_ );
+        for( int j = 0; j < 6; j++ )
+        {
+            tabulatedValues_[ 6 * i + j ] = currentValues( j );
+        }
+    }
+}
+
+//! Function to compute the tabulated quantities (X, Y, s, x_p, y_p, UT1 minus input time) directly
+Eigen::Vector6d InterpolatedEarthOrientationAnglesCalculator::computeValuesDirectly( const double timeValue )
+{
+    std::pair< Eigen::Vector5d, double > anglesAndUt1 =
+            anglesCalculator_->getRotationAnglesFromItrsToGcrs< double >( timeValue, inputTimeScale_ );
+
+    Eigen::Vector6d values;
+    values.segment< 5 >( 0 ) = anglesAndUt1.first;
+    values( 5 ) = anglesAndUt1.second - timeValue;
+    return values;
+}
+
+//! Function to interpolate the tabulated quantities (X, Y, s, x_p, y_p, UT1 minus input time)
+void InterpolatedEarthOrientationAnglesCalculator::interpolateValues(
+        const double timeValue, Eigen::Vector6d& interpolatedValues )
+{
+    // Determine first node of the interpolation stencil (centered on the interval containing the time if possible)
+    double scaledTime = ( timeValue - startTime_ ) * inverseTimeStep_;
+    int firstNode = static_cast< int >( std::floor( scaledTime ) ) - ( numberOfInterpolationPoints_ / 2 - 1 );
+    firstNode = std::max( 0, std::min( firstNode, numberOfTabulationPoints_ - numberOfInterpolationPoints_ ) );
+
+    // Compute Lagrange weights at normalized time w.r.t. first node
+    double normalizedTime = scaledTime - static_cast< double >( firstNode );
+    double weights[ 12 ];
+    for( int i = 0; i < numberOfInterpolationPoints_; i++ )
+    {
+        double numerator = 1.0;
+        for( int j = 0; j < numberOfInterpolationPoints_; j++ )
+        {
+            if( j != i )
+            {
+                numerator *= ( normalizedTime - static_cast< double >( j ) );
+            }
+        }
+        weights[ i ] = numerator / lagrangeDenominators_[ i ];
+    }
+
+    // Compute weighted sum of tabulated values
+    interpolatedValues.setZero( );
+    const double* currentValues = tabulatedValues_.data( ) + 6 * firstNode;
+    for( int i = 0; i < numberOfInterpolationPoints_; i++ )
+    {
+        for( int j = 0; j < 6; j++ )
+        {
+            interpolatedValues( j ) += weights[ i ] * currentValues[ j ];
+        }
+        currentValues += 6;
+    }
+}
+
+} // namespace earth_orientation
+
+} // namespace tudat
@@ -9,6 +9,8 @@
  *
  */
 
+#include <atomic>
+
 #include "tudat/astro/earth_orientation/shortPeriodEarthOrientationCorrectionCalculator.h"
 
 namespace tudat
@@ -17,40 +19,50 @@ namespace tudat
 namespace earth_orientation
 {
 
+//! Function to calculate the Delaunay fundamental arguments with GMST, reusing the last result in the current thread
+Eigen::Vector6d calculateMemoisedDelaunayFundamentalArgumentsWithGmst( const double tdbTime )
+{
+    return sofa_interface::getSharedApproximateDelaunayFundamentalArgumentsWithGmst( tdbTime );
+}
+
+//! Function to retrieve a unique identifier for a new short-period correction calculator (used to memoise its results).
+unsigned int getNewShortPeriodCorrectionCalculatorId( )
+{
+    static std::atomic< unsigned int > lastCalculatorId( 0 );
+    return ++lastCalculatorId;
+}
+
+//! Function to retrieve per-thread buffers for the phase angles, and their sines and cosines, of short-period corrections.
+void getShortPeriodCorrectionBuffers( const int numberOfTerms, double*& phaseAngles, double*& sines, double*& cosines )
+{
+    thread_local std::vector< double > correctionBuffer;
+    if( static_cast< int >( correctionBuffer.size( ) ) < 3 * numberOfTerms )
+    {
+        correctionBuffer.resize( 3 * numberOfTerms );
+    }
+    phaseAngles = correctionBuffer.data( );
+    sines = phaseAngles + numberOfTerms;
+    cosines = sines + numberOfTerms;
+}
+
 //! Function to sum all the corrcetion terms.
 template< >
 double ShortPeriodEarthOrientationCorrectionCalculator< double >::sumCorrectionTerms( const Eigen::Vector6d& arguments )
 {
-#ifdef TUDAT_TEST_INSTALL
-    static std::string state = "install";
-#else
-    static std::string state = "build";
-#endif
-
-    // Initialize corrections to zero.
-    double currentCorrection = 0;
-    double tideAngle = 0.0;
-
-    // Iterate over all correction types
-    for( unsigned int i = 0; i < argumentAmplitudes_.size( ); i++ )
+    int numberOfTerms = combinedArgumentMultipliers_.rows( );
+    if( numberOfTerms == 0 )
     {
-        Eigen::MatrixXd currentArgumentMultipliers = argumentMultipliers_.at( i );
-        Eigen::MatrixXd currentAmplitudes = argumentAmplitudes_.at( i );
-
-        // Iterte over all libration corrections.
-        for( int i = 0; i < currentAmplitudes.rows( ); i++ )
-        {
-            // Calculate current phase angle of tide.
-            tideAngle = ( arguments.transpose( ) *
-                          currentArgumentMultipliers.block( i, 0, 1, 6 ).transpose( ) )( 0, 0 );
-
-            currentCorrection += currentAmplitudes( i, 0 ) * std::sin( tideAngle ) +
-                    currentAmplitudes( i, 1 ) * std::cos( tideAngle );
-        }
+        return 0.0;
     }
 
+    // Compute sine and cosine of phase angles of all terms
+    double* sines;
+    double* cosines;
+    computeTrigonometricTerms( arguments, sines, cosines );
 
-    return currentCorrection;
+    // Sum all terms
+    return sineAmplitudes_.row( 0 ).dot( Eigen::Map< const Eigen::VectorXd >( sines, numberOfTerms ) ) +
+            cosineAmplitudes_.row( 0 ).dot( Eigen::Map< const Eigen::VectorXd >( cosines, numberOfTerms ) );
 }
 
 //! Function to sum all the corrcetion terms.
@@ -58,38 +70,21 @@ template< >
 Eigen::Vector2d ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d >::sumCorrectionTerms(
         const Eigen::Vector6d& arguments )
 {
-#ifdef TUDAT_TEST_INSTALL
-        static std::string state = "install";
-#else
-        static std::string state = "build";
-#endif
-
-    // Initialize corrections to zero.
-    Eigen::Vector2d currentCorrection = Eigen::Vector2d::Zero( );
-    double tideAngle = 0.0;
-
-    // Iterate over all correction types
-    for( unsigned int i = 0; i < argumentAmplitudes_.size( ); i++ )
+    int numberOfTerms = combinedArgumentMultipliers_.rows( );
+    if( numberOfTerms == 0 )
     {
-        Eigen::MatrixXd currentArgumentMultipliers = argumentMultipliers_.at( i );
-        Eigen::MatrixXd currentAmplitudes = argumentAmplitudes_.at( i );
-
-        // Iterte over all libration corrections.
-        for( int i = 0; i < currentAmplitudes.rows( ); i++ )
-        {
-            // Calculate current phase angle of tide.
-            tideAngle = ( arguments.transpose( ) *
-                          currentArgumentMultipliers.block( i, 0, 1, 6 ).transpose( ) )( 0, 0 );
-
-            // Calculate and add sine and cosine terms
-            currentCorrection.x( ) += currentAmplitudes( i, 0 ) * std::sin( tideAngle ) +
-                    currentAmplitudes( i, 1 ) * std::cos( tideAngle );
-            currentCorrection.y( ) += currentAmplitudes( i, 2 ) * std::sin( tideAngle ) +
-                    currentAmplitudes( i, 3 ) * std::cos( tideAngle );
-        }
+        return Eigen::Vector2d::Zero( );
     }
 
+    // Compute sine and cosine of phase angles of all terms
+    double* sines;
+    double* cosines;
+    computeTrigonometricTerms( arguments, sines, cosines );
 
+    // Sum all terms
+    Eigen::Vector2d currentCorrection;
+    currentCorrection.noalias( ) = sineAmplitudes_ * Eigen::Map< const Eigen::VectorXd >( sines, numberOfTerms );
+    currentCorrection.noalias( ) += cosineAmplitudes_ * Eigen::Map< const Eigen::VectorXd >( cosines, numberOfTerms );
     return currentCorrection;
 }
 
@@ -106,7 +101,7 @@ std::shared_ptr< ShortPeriodEarthOrientationCorrectionCalculator< double > > get
                 std::vector< std::string >{
                     tudat::paths::getEarthOrientationDataFilesPath(  ) + "/utcLibrationFundamentalArgumentMultipliers.txt",
                     tudat::paths::getEarthOrientationDataFilesPath(  ) + "/utcOceanTidesFundamentalArgumentMultipliers.txt" },
-                std::bind( &sofa_interface::calculateApproximateDelaunayFundamentalArgumentsWithGmst, std::placeholders::_1 ) );
+                std::bind( &calculateMemoisedDelaunayFundamentalArgumentsWithGmst, std::placeholders::_1 ) );
 }
 
 //! Function to retrieve the default polar motion short-period correction calculator
@@ -126,7 +121,7 @@ std::shared_ptr< ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2
                     "/polarMotionLibrationFundamentalArgumentMultipliersQuasiDiurnalOnly.txt",
                     tudat::paths::getEarthOrientationDataFilesPath(  ) +
                     "/polarMotionOceanTidesFundamentalArgumentMultipliers.txt" },
-                std::bind( &sofa_interface::calculateApproximateDelaunayFundamentalArgumentsWithGmst, std::placeholders::_1 ) );
+                std::bind( &calculateMemoisedDelaunayFundamentalArgumentsWithGmst, std::placeholders::_1 ) );
 
 }
 
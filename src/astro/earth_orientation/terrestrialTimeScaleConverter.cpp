@@ -61,7 +61,21 @@ void TerrestrialTimeScaleConverter::setCurrentGroundStation< Time >( const Eigen
     previousEarthFixedPositionSplit_ = currentGroundStation;
 }
 
+//! Function to retrieve list of recently converted times at double precision
+template< >
+std::vector< std::pair< CurrentTimes< double >, Eigen::Vector3d > >&
+TerrestrialTimeScaleConverter::getConversionCache< double >( )
+{
+    return conversionCacheEntries_;
+}
 
+//! Function to retrieve list of recently converted times at Time precision
+template< >
+std::vector< std::pair< CurrentTimes< Time >, Eigen::Vector3d > >&
+TerrestrialTimeScaleConverter::getConversionCache< Time >( )
+{
+    return conversionCacheEntriesSplit_;
+}
 
 //! Function to create the default Earth time scales conversion object
 std::shared_ptr< TerrestrialTimeScaleConverter > createDefaultTimeConverter( const std::shared_ptr< EOPReader > eopReader )
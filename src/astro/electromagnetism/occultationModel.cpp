@@ -10,7 +10,10 @@
 
 #include "tudat/astro/electromagnetism/occultationModel.h"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <stdexcept>
 
 #include <Eigen/Core>
 
@@ -28,20 +31,110 @@ void OccultationModel::updateMembers(const double currentTime)
     if(currentTime_ != currentTime)
     {
         currentTime_ = currentTime;
+        isLastReceivedFractionFromExtendedSourceValid_ = false;
         updateMembers_(currentTime);
     }
 }
 
-double SingleOccultingBodyOccultationModel::evaluateReceivedFractionFromExtendedSource(
+double OccultationModel::evaluateReceivedFractionFromExtendedSource(
         const Eigen::Vector3d& occultedSourcePosition,
         const std::shared_ptr<basic_astrodynamics::BodyShapeModel>& occultedSourceShapeModel,
         const Eigen::Vector3d& targetPosition) const
 {
+    // Use known received fraction if target is in a fully illuminated or umbra phase of the reference trajectory
+    const ConstantReceivedFractionInterval* currentInterval = findCurrentConstantReceivedFractionInterval();
+    if (currentInterval != nullptr)
+    {
+        return currentInterval->receivedFraction;
+    }
+
+    // Reuse result if the same geometry has already been evaluated at the current time
+    if (isLastReceivedFractionFromExtendedSourceValid_ &&
+        lastOccultedSourceShapeModel_ == occultedSourceShapeModel.get() &&
+        lastOccultedSourcePosition_ == occultedSourcePosition &&
+        lastTargetPosition_ == targetPosition)
+    {
+        return lastReceivedFractionFromExtendedSource_;
+    }
+
+    lastReceivedFractionFromExtendedSource_ = computeReceivedFractionFromExtendedSource(
+            occultedSourcePosition, occultedSourceShapeModel, targetPosition);
+    lastOccultedSourcePosition_ = occultedSourcePosition;
+    lastOccultedSourceShapeModel_ = occultedSourceShapeModel.get();
+    lastTargetPosition_ = targetPosition;
+    isLastReceivedFractionFromExtendedSourceValid_ = !std::isnan(currentTime_);
+
+    return lastReceivedFractionFromExtendedSource_;
+}
+
+void OccultationModel::setConstantReceivedFractionIntervals(
+        const std::vector<ConstantReceivedFractionInterval>& constantReceivedFractionIntervals)
+{
+    for (unsigned int i = 0; i < constantReceivedFractionIntervals.size(); i++)
+    {
+        if (constantReceivedFractionIntervals[i].endTime < constantReceivedFractionIntervals[i].startTime ||
+            (i > 0 && constantReceivedFractionIntervals[i].startTime < constantReceivedFractionIntervals[i - 1].endTime))
+        {
+            throw std::runtime_error(
+                    "Error when setting constant received fraction intervals, intervals must be sorted and non-overlapping");
+        }
+    }
+
+    constantReceivedFractionIntervals_ = constantReceivedFractionIntervals;
+    currentConstantReceivedFractionIntervalIndex_ = 0;
+    isLastReceivedFractionFromExtendedSourceValid_ = false;
+}
+
+const ConstantReceivedFractionInterval* OccultationModel::findCurrentConstantReceivedFractionInterval() const
+{
+    if (constantReceivedFractionIntervals_.empty() || std::isnan(currentTime_))
+    {
+        return nullptr;
+    }
+
+    // Check interval found in previous call first, since consecutive evaluations are typically close in time
+    const ConstantReceivedFractionInterval* currentInterval =
+            &constantReceivedFractionIntervals_[currentConstantReceivedFractionIntervalIndex_];
+    if (currentTime_ < currentInterval->startTime || currentTime_ > currentInterval->endTime)
+    {
+        auto nextInterval = std::upper_bound(
+                constantReceivedFractionIntervals_.begin(), constantReceivedFractionIntervals_.end(), currentTime_,
+                [](const double time, const ConstantReceivedFractionInterval& interval)
+                { return time < interval.startTime; });
+        if (nextInterval == constantReceivedFractionIntervals_.begin())
+        {
+            return nullptr;
+        }
+
+        currentConstantReceivedFractionIntervalIndex_ =
+                static_cast<unsigned int>(std::distance(constantReceivedFractionIntervals_.begin(), nextInterval) - 1);
+        currentInterval = &constantReceivedFractionIntervals_[currentConstantReceivedFractionIntervalIndex_];
+        if (currentTime_ > currentInterval->endTime)
+        {
+            return nullptr;
+        }
+    }
+    return currentInterval;
+}
+
+double SingleOccultingBodyOccultationModel::computeReceivedFractionFromExtendedSource(
+        const Eigen::Vector3d& occultedSourcePosition,
+        const std::shared_ptr<basic_astrodynamics::BodyShapeModel>& occultedSourceShapeModel,
+        const Eigen::Vector3d& targetPosition) const
+{
+    const double occultedSourceRadius = occultedSourceShapeModel->getAverageRadius();
+    const double occultingBodyRadius = occultingBodyShapeModel_->getAverageRadius();
+    if (isTargetFullyIlluminatedByExtendedSource(
+            occultedSourcePosition, occultedSourceRadius, occultingBodyPosition, occultingBodyRadius, targetPosition))
+    {
+        return 1.0;
+    }
+
     const auto shadowFunction = mission_geometry::computeShadowFunction(
             occultedSourcePosition,
-            occultedSourceShapeModel->getAverageRadius(),
+            occultedSourceRadius,
             occultingBodyPosition,
-            occultingBodyShapeModel_->getAverageRadius(),
+            occultingBodyRadius,
             targetPosition);
     return shadowFunction;
 }
@@ -63,21 +156,30 @@ void SingleOccultingBodyOccultationModel::updateMembers_(double currentTime)
     occultingBodyPosition = occultingBodyPositionFunction_();
 }
 
-double SimpleMultipleOccultingBodyOccultationModel::evaluateReceivedFractionFromExtendedSource(
+double SimpleMultipleOccultingBodyOccultationModel::computeReceivedFractionFromExtendedSource(
         const Eigen::Vector3d& occultedSourcePosition,
         const std::shared_ptr<basic_astrodynamics::BodyShapeModel>& occultedSourceShapeModel,
         const Eigen::Vector3d& targetPosition) const
 {
+    const double occultedSourceRadius = occultedSourceShapeModel->getAverageRadius();
     double totalShadowFunction = 1.0;
     double shadowFunctionOfBody;
     unsigned int numberOfCurrentlyOccultingBodies = 0;
     for (unsigned int i = 0; i < getNumberOfOccultingBodies(); i++)
     {
+        const double occultingBodyRadius = occultingBodyShapeModels_[i]->getAverageRadius();
+        if (isTargetFullyIlluminatedByExtendedSource(
+                occultedSourcePosition, occultedSourceRadius, occultingBodyPositions[i], occultingBodyRadius,
+                targetPosition))
+        {
+            continue;
+        }
+
         shadowFunctionOfBody = mission_geometry::computeShadowFunction(
                 occultedSourcePosition,
-                occultedSourceShapeModel->getAverageRadius(),
+                occultedSourceRadius,
                 occultingBodyPositions[i],
-                occultingBodyShapeModels_[i]->getAverageRadius(),
+                occultingBodyRadius,
                 targetPosition);
         totalShadowFunction *= shadowFunctionOfBody;
 
@@ -127,6 +229,23 @@ bool evaluatePointToPointVisibilityWithOccultation(
         double occultingBodyRadius,
         const Eigen::Vector3d& targetPosition)
 {
+    // Line of sight is clear if the segment between source and target does not come closer to the occulting body
+    // center than its radius. This check avoids the trigonometric functions below in the common case.
+    const Eigen::Vector3d sourceToTargetVector = targetPosition - occultedSourcePosition;
+    const double squaredSourceToTargetDistance = sourceToTargetVector.squaredNorm();
+    double closestApproachFraction = 0.0;
+    if (squaredSourceToTargetDistance > 0.0)
+    {
+        closestApproachFraction = std::min(std::max(
+                (occultingBodyPosition - occultedSourcePosition).dot(sourceToTargetVector) / squaredSourceToTargetDistance,
+                0.0), 1.0);
+    }
+    if ((occultedSourcePosition + closestApproachFraction * sourceToTargetVector - occultingBodyPosition).squaredNorm() >
+        occultingBodyRadius * occultingBodyRadius)
+    {
+        return true;
+    }
+
     // Vallado (2013), Sec. 5.3.3
     const Eigen::Vector3d sourceToOccultingBodyVector = occultedSourcePosition - occultingBodyPosition;
     const Eigen::Vector3d targetToOccultingBodyVector = targetPosition - occultingBodyPosition;
@@ -139,5 +258,109 @@ bool evaluatePointToPointVisibilityWithOccultation(
     return isSourceVisibleFromTarget;
 }
 
+bool isTargetFullyIlluminatedByExtendedSource(
+        const Eigen::Vector3d& occultedSourcePosition,
+        const double occultedSourceRadius,
+        const Eigen::Vector3d& occultingBodyPosition,
+        const double occultingBodyRadius,
+        const Eigen::Vector3d& targetPosition)
+{
+    const Eigen::Vector3d targetToSourceVector = occultedSourcePosition - targetPosition;
+    const Eigen::Vector3d targetToOccultingBodyVector = occultingBodyPosition - targetPosition;
+    const double targetToSourceDistance = targetToSourceVector.norm();
+    const double targetToOccultingBodyDistance = targetToOccultingBodyVector.norm();
+
+    // Sines of apparent radii of source and occulting body; no conclusion possible if target is inside either body
+    const double sineOfSourceApparentRadius = occultedSourceRadius / targetToSourceDistance;
+    const double sineOfOccultingBodyApparentRadius = occultingBodyRadius / targetToOccultingBodyDistance;
+    if (!(sineOfSourceApparentRadius < 1.0 && sineOfOccultingBodyApparentRadius < 1.0))
+    {
+        return false;
+    }
+
+    // Apparent disks do not overlap if the apparent separation exceeds the sum of the apparent radii. Since both
+    // angles are in [0, pi], this is evaluated from their cosines
+    const double cosineOfApparentSeparation = targetToSourceVector.dot(targetToOccultingBodyVector) /
+            (targetToSourceDistance * targetToOccultingBodyDistance);
+    const double cosineOfSumOfApparentRadii =
+            std::sqrt((1.0 - sineOfSourceApparentRadius * sineOfSourceApparentRadius) *
+                      (1.0 - sineOfOccultingBodyApparentRadius * sineOfOccultingBodyApparentRadius)) -
+            sineOfSourceApparentRadius * sineOfOccultingBodyApparentRadius;
+    return cosineOfApparentSeparation < cosineOfSumOfApparentRadii;
+}
+
+std::vector<ConstantReceivedFractionInterval> computeConstantReceivedFractionIntervals(
+        const std::function<double(double)>& receivedFractionFunction,
+        const double startTime,
+        const double endTime,
+        const double timeStep,
+        const double timeTolerance)
+{
+    if (!(timeStep > 0.0) || !(timeTolerance > 0.0) || endTime < startTime)
+    {
+        throw std::runtime_error(
+                "Error when computing constant received fraction intervals, invalid time range, step or tolerance");
+    }
+
+    // Phase of target: 1 if fully illuminated, 0 if in umbra, -1 if in penumbra
+    auto computePhase = [&](const double time)
+    {
+        const double receivedFraction = receivedFractionFunction(time);
+        return receivedFraction == 1.0 ? 1 : (receivedFraction == 0.0 ? 0 : -1);
+    };
+
+    // Find latest time in (lowerTime, upperTime) for which phase equals that at lowerTime (if phaseAtLower is true), or
+    // earliest time for which phase equals that at upperTime (otherwise)
+    auto refinePhaseBoundary = [&](double lowerTime, double upperTime, const int phase, const bool phaseAtLower)
+    {
+        while (upperTime - lowerTime > timeTolerance)
+        {
+            const double middleTime = 0.5 * (lowerTime + upperTime);
+            if ((computePhase(middleTime) == phase) == phaseAtLower)
+            {
+                lowerTime = middleTime;
+            }
+            else
+            {
+                upperTime = middleTime;
+            }
+        }
+        return phaseAtLower ? lowerTime : upperTime;
+    };
+
+    std::vector<ConstantReceivedFractionInterval> constantReceivedFractionIntervals;
+    double previousTime = startTime;
+    int previousPhase = computePhase(startTime);
+    double currentIntervalStartTime = startTime;
+    while (previousTime < endTime)
+    {
+        const double currentTime = std::min(previousTime + timeStep, endTime);
+        const int currentPhase = computePhase(currentTime);
+        if (currentPhase != previousPhase)
+        {
+            // Close interval of previous phase, and find start of interval of current phase
+            if (previousPhase >= 0)
+            {
+                constantReceivedFractionIntervals.push_back(
+                        {currentIntervalStartTime, refinePhaseBoundary(previousTime, currentTime, previousPhase, true),
+                         static_cast<double>(previousPhase)});
+            }
+            if (currentPhase >= 0)
+            {
+                currentIntervalStartTime = refinePhaseBoundary(previousTime, currentTime, currentPhase, false);
+            }
+        }
+        previousTime = currentTime;
+        previousPhase = currentPhase;
+    }
+    if (previousPhase >= 0)
+    {
+        constantReceivedFractionIntervals.push_back(
+                {currentIntervalStartTime, endTime, static_cast<double>(previousPhase)});
+    }
+
+    return constantReceivedFractionIntervals;
+}
+
 } // electromagnetism
 } // tudat
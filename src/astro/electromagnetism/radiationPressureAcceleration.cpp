@@ -46,7 +46,7 @@ Eigen::Vector3d IsotropicPointSourceRadiationPressureAcceleration::calculateAcce
     Eigen::Vector3d targetCenterPositionInSourceFrame = targetCenterPositionInGlobalFrame - sourceCenterPositionInGlobalFrame;
     sourceToTargetReceivedFraction = sourceToTargetOccultationModel_->evaluateReceivedFractionFromExtendedSource(
             sourceCenterPositionInGlobalFrame, sourceBodyShapeModel_, targetCenterPositionInGlobalFrame);
-    auto sourceIrradiance = sourceModel_->evaluateIrradianceAtPosition(targetCenterPositionInSourceFrame).front().first;
+    auto sourceIrradiance = sourceModel_->evaluatePointIrradianceAtPosition(targetCenterPositionInSourceFrame);
     auto occultedSourceIrradiance = sourceIrradiance * sourceToTargetReceivedFraction;
 
     // Update dependent variable
@@ -10,6 +10,11 @@
 
 #include "tudat/astro/electromagnetism/radiationPressureTargetModel.h"
 
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
 #include <Eigen/Core>
 
 #include "tudat/astro/basic_astro/physicalConstants.h"
@@ -43,21 +48,47 @@ Eigen::Vector3d PaneledRadiationPressureTargetModel::evaluateRadiationPressureFo
         double sourceIrradiance,
         const Eigen::Vector3d& sourceToTargetDirection) const
 {
-    Eigen::Vector3d force = Eigen::Vector3d::Zero();
-    for (auto& panel : panels_)
+    // Only panels with their front side towards the source are illuminated
+    const Eigen::ArrayXd cosBetweenNormalAndIncoming =
+            -(panelSurfaceNormals_.transpose() * sourceToTargetDirection).array();
+    Eigen::ArrayXd effectiveAreas =
+            (cosBetweenNormalAndIncoming > 0).select(panelAreas_.array() * cosBetweenNormalAndIncoming, 0.0);
+    if (selfShadowingTable_ != nullptr)
+    {
+        effectiveAreas *= selfShadowingTable_->evaluateIlluminatedFractions(sourceToTargetDirection).array();
+    }
+
+    // Sum reaction vectors of specular-diffuse-mix panels, Montenbruck (2014) Eq. 5 and 6
+    const Eigen::VectorXd surfaceNormalWeights = effectiveAreas *
+            (diffuseReactionCoefficients_.array() + specularReactionCoefficients_.array() * cosBetweenNormalAndIncoming);
+    Eigen::Vector3d force = (effectiveAreas * incidenceReactionCoefficients_.array()).sum() * sourceToTargetDirection -
+            panelSurfaceNormals_ * surfaceNormalWeights;
+
+    // Add reaction vectors of other panels
+    for (const unsigned int i : genericReflectionLawPanelIndices_)
     {
-        const auto surfaceNormal = panel.getSurfaceNormal();
-        const double cosBetweenNormalAndIncoming = (-sourceToTargetDirection).dot(surfaceNormal);
-        if (cosBetweenNormalAndIncoming > 0)
+        if (effectiveAreas(i) > 0)
         {
-            const double effectiveArea = panel.getArea() * cosBetweenNormalAndIncoming;
-            const auto radiationPressure = sourceIrradiance / physical_constants::SPEED_OF_LIGHT;
-            const auto reactionVector =
-                    panel.getReflectionLaw()->evaluateReactionVector(surfaceNormal, sourceToTargetDirection);
-            force += radiationPressure * effectiveArea * reactionVector;
+            force += effectiveAreas(i) * panels_[i].getReflectionLaw()->evaluateReactionVector(
+                    panelSurfaceNormals_.col(i), sourceToTargetDirection);
         }
     }
-    return force;
+
+    const auto radiationPressure = sourceIrradiance / physical_constants::SPEED_OF_LIGHT;
+    return radiationPressure * force;
+}
+
+void PaneledRadiationPressureTargetModel::setSelfShadowingTable(
+        const std::shared_ptr<PanelSelfShadowingTable>& selfShadowingTable)
+{
+    if (selfShadowingTable != nullptr && selfShadowingTable->getNumberOfPanels() != panels_.size())
+    {
+        throw std::runtime_error(
+                "Error when setting self-shadowing table of paneled target: table has " +
+                std::to_string(selfShadowingTable->getNumberOfPanels()) + " panels, but target has " +
+                std::to_string(panels_.size()) + " panels.");
+    }
+    selfShadowingTable_ = selfShadowingTable;
 }
 
 void PaneledRadiationPressureTargetModel::updateMembers_(double currentTime)
@@ -66,12 +97,158 @@ void PaneledRadiationPressureTargetModel::updateMembers_(double currentTime)
     {
         panel.updateMembers();
     }
+    updatePanelArrays();
+}
+
+void PaneledRadiationPressureTargetModel::initializePanelArrays()
+{
+    const unsigned int numberOfPanels = panels_.size();
+    panelSurfaceNormals_ = Eigen::Matrix3Xd::Zero(3, numberOfPanels);
+    panelAreas_.resize(numberOfPanels);
+    incidenceReactionCoefficients_.resize(numberOfPanels);
+    diffuseReactionCoefficients_.resize(numberOfPanels);
+    specularReactionCoefficients_.resize(numberOfPanels);
+    updatePanelArrays();
+}
+
+void PaneledRadiationPressureTargetModel::updatePanelArrays()
+{
+    // Reflection coefficients are retrieved every time step, since reflection laws may be modified externally
+    genericReflectionLawPanelIndices_.clear();
+    for (unsigned int i = 0; i < panels_.size(); ++i)
+    {
+        const Panel& panel = panels_[i];
+        if (panel.isSurfaceNormalSet_)
+        {
+            panelSurfaceNormals_.col(i) = panel.surfaceNormal_;
+        }
+        panelAreas_(i) = panel.getArea();
+
+        const auto specularDiffuseMixReflectionLaw =
+                std::dynamic_pointer_cast<SpecularDiffuseMixReflectionLaw>(panel.reflectionLaw_);
+        if (specularDiffuseMixReflectionLaw != nullptr)
+        {
+            const double absorptivity = specularDiffuseMixReflectionLaw->getAbsorptivity();
+            const double diffuseReflectivity = specularDiffuseMixReflectionLaw->getDiffuseReflectivity();
+
+            incidenceReactionCoefficients_(i) = absorptivity + diffuseReflectivity;
+            diffuseReactionCoefficients_(i) = 2. / 3 * diffuseReflectivity;
+            if (specularDiffuseMixReflectionLaw->isWithInstantaneousReradiation())
+            {
+                // Instantaneous Lambertian reradiation behaves like diffuse Lambertian reflection
+                diffuseReactionCoefficients_(i) += 2. / 3 * absorptivity;
+            }
+            specularReactionCoefficients_(i) = 2 * specularDiffuseMixReflectionLaw->getSpecularReflectivity();
+        }
+        else
+        {
+            incidenceReactionCoefficients_(i) = 0;
+            diffuseReactionCoefficients_(i) = 0;
+            specularReactionCoefficients_(i) = 0;
+            genericReflectionLawPanelIndices_.push_back(i);
+        }
+    }
 }
 
 void PaneledRadiationPressureTargetModel::Panel::updateMembers()
 {
     // Evaluate only once per timestep since surface normal function could be expensive to evaluate
     surfaceNormal_ = surfaceNormalFunction_();
+    isSurfaceNormalSet_ = true;
+}
+
+PanelSelfShadowingTable::PanelSelfShadowingTable(
+        const Eigen::MatrixXd& illuminatedFractions,
+        unsigned int numberOfLatitudes,
+        unsigned int numberOfLongitudes) :
+        illuminatedFractions_(illuminatedFractions),
+        numberOfLatitudes_(numberOfLatitudes),
+        numberOfLongitudes_(numberOfLongitudes)
+{
+    if (numberOfLatitudes_ < 2 || numberOfLongitudes_ < 1)
+    {
+        throw std::runtime_error(
+                "Error when creating panel self-shadowing table: at least 2 latitudes and 1 longitude are required.");
+    }
+    if (illuminatedFractions_.cols() != numberOfLatitudes_ * numberOfLongitudes_)
+    {
+        throw std::runtime_error(
+                "Error when creating panel self-shadowing table: number of columns (" +
+                std::to_string(illuminatedFractions_.cols()) + ") is inconsistent with grid size (" +
+                std::to_string(numberOfLatitudes_) + " x " + std::to_string(numberOfLongitudes_) + ").");
+    }
+    if (illuminatedFractions_.size() > 0 &&
+            (illuminatedFractions_.minCoeff() < 0 || illuminatedFractions_.maxCoeff() > 1))
+    {
+        throw std::runtime_error(
+                "Error when creating panel self-shadowing table: illuminated fractions must be between 0 and 1.");
+    }
+}
+
+Eigen::VectorXd PanelSelfShadowingTable::evaluateIlluminatedFractions(
+        const Eigen::Vector3d& sourceToTargetDirection) const
+{
+    using mathematical_constants::PI;
+
+    // Latitude and longitude of source direction as seen from target
+    const Eigen::Vector3d sourceDirection = -sourceToTargetDirection.normalized();
+    const double latitude = std::asin(std::min(std::max(sourceDirection.z(), -1.0), 1.0));
+    const double longitude = std::atan2(sourceDirection.y(), sourceDirection.x());
+
+    // Find grid cell, longitudes are periodic
+    const double scaledLatitude = (latitude + PI / 2) / PI * (numberOfLatitudes_ - 1);
+    const unsigned int lowerLatitudeIndex = std::min(
+            static_cast<unsigned int>(std::max(std::floor(scaledLatitude), 0.0)), numberOfLatitudes_ - 2);
+    const double latitudeFraction = scaledLatitude - lowerLatitudeIndex;
+
+    const double scaledLongitude = (longitude + PI) / (2 * PI) * numberOfLongitudes_;
+    const unsigned int lowerLongitudeIndex = std::min(
+            static_cast<unsigned int>(std::max(std::floor(scaledLongitude), 0.0)), numberOfLongitudes_ - 1);
+    const double longitudeFraction = scaledLongitude - lowerLongitudeIndex;
+    const unsigned int upperLongitudeIndex = (lowerLongitudeIndex + 1) % numberOfLongitudes_;
+
+    // Bilinear interpolation
+    const unsigned int lowerRow = lowerLatitudeIndex * numberOfLongitudes_;
+    const unsigned int upperRow = lowerRow + numberOfLongitudes_;
+    return (1 - latitudeFraction) * ((1 - longitudeFraction) * illuminatedFractions_.col(lowerRow + lowerLongitudeIndex) +
+                                     longitudeFraction * illuminatedFractions_.col(lowerRow + upperLongitudeIndex)) +
+            latitudeFraction * ((1 - longitudeFraction) * illuminatedFractions_.col(upperRow + lowerLongitudeIndex) +
+                                longitudeFraction * illuminatedFractions_.col(upperRow + upperLongitudeIndex));
+}
+
+std::shared_ptr<PanelSelfShadowingTable> createPanelSelfShadowingTable(
+        const std::function<Eigen::VectorXd(const Eigen::Vector3d&)>& illuminatedFractionFunction,
+        unsigned int numberOfPanels,
+        unsigned int numberOfLatitudes,
+        unsigned int numberOfLongitudes)
+{
+    using mathematical_constants::PI;
+
+    Eigen::MatrixXd illuminatedFractions(numberOfPanels, numberOfLatitudes * numberOfLongitudes);
+    for (unsigned int i = 0; i < numberOfLatitudes; ++i)
+    {
+        const double latitude = (numberOfLatitudes > 1) ? -PI / 2 + PI * i / (numberOfLatitudes - 1) : 0;
+        for (unsigned int j = 0; j < numberOfLongitudes; ++j)
+        {
+            const double longitude = -PI + 2 * PI * j / numberOfLongitudes;
+            const Eigen::Vector3d sourceToTargetDirection = -Eigen::Vector3d(
+                    std::cos(latitude) * std::cos(longitude),
+                    std::cos(latitude) * std::sin(longitude),
+                    std::sin(latitude));
+
+            const Eigen::VectorXd currentIlluminatedFractions = illuminatedFractionFunction(sourceToTargetDirection);
+            if (currentIlluminatedFractions.rows() != numberOfPanels)
+            {
+                throw std::runtime_error(
+                        "Error when creating panel self-shadowing table: function returned " +
+                        std::to_string(currentIlluminatedFractions.rows()) + " values, expected " +
+                        std::to_string(numberOfPanels) + ".");
+            }
+            illuminatedFractions.col(i * numberOfLongitudes + j) = currentIlluminatedFractions;
+        }
+    }
+
+    return std::make_shared<PanelSelfShadowingTable>(illuminatedFractions, numberOfLatitudes, numberOfLongitudes);
 }
 } // tudat
 } // electromagnetism
@@ -10,6 +10,9 @@
 
 #include "tudat/astro/electromagnetism/radiationSourceModel.h"
 
+#include <algorithm>
+#include <stdexcept>
+#include <string>
 #include <vector>
 #include <utility>
 #include <memory>
@@ -55,6 +58,29 @@ double RadiationSourceModel::evaluateTotalIrradianceAtPosition(
     return totalIrradiance;
 }
 
+std::shared_ptr<OccultationModel> RadiationSourceModel::getSharedTargetOccultationModel(
+        const std::vector<std::string>& occultingBodyNames) const
+{
+    std::vector<std::string> sortedOccultingBodyNames = occultingBodyNames;
+    std::sort(sortedOccultingBodyNames.begin(), sortedOccultingBodyNames.end());
+
+    auto occultationModelIterator = sharedTargetOccultationModels_.find(sortedOccultingBodyNames);
+    if (occultationModelIterator == sharedTargetOccultationModels_.end())
+    {
+        return nullptr;
+    }
+    return occultationModelIterator->second;
+}
+
+void RadiationSourceModel::addSharedTargetOccultationModel(
+        const std::vector<std::string>& occultingBodyNames,
+        const std::shared_ptr<OccultationModel>& occultationModel)
+{
+    std::vector<std::string> sortedOccultingBodyNames = occultingBodyNames;
+    std::sort(sortedOccultingBodyNames.begin(), sortedOccultingBodyNames.end());
+    sharedTargetOccultationModels_[sortedOccultingBodyNames] = occultationModel;
+}
+
 //*********************************************************************************************
 //   Isotropic point radiation source
 //*********************************************************************************************
@@ -62,20 +88,26 @@ double RadiationSourceModel::evaluateTotalIrradianceAtPosition(
 IrradianceWithSourceList IsotropicPointRadiationSourceModel::evaluateIrradianceAtPosition(
         const Eigen::Vector3d& targetPosition)
 {
-    double distanceSourceToTargetSquared = targetPosition.squaredNorm();
-    auto luminosity = luminosityModel_->getLuminosity();
+    // The radiation of an isotropic point source originates from the source center
+    return IrradianceWithSourceList { std::make_pair(
+            evaluatePointIrradianceAtPosition(targetPosition), Eigen::Vector3d::Zero()) };
+}
 
+double IsotropicPointRadiationSourceModel::evaluatePointIrradianceAtPosition(
+        const Eigen::Vector3d& targetPosition) const
+{
+    double distanceSourceToTargetSquared = targetPosition.squaredNorm();
     auto sphereArea = 4 * PI * distanceSourceToTargetSquared;
 
     // Since the source is isotropic, the radiation is uniformly distributed in all directions
-    auto irradiance = luminosity / sphereArea;
-    // The radiation of an isotropic point source originates from the source center
-    return IrradianceWithSourceList { std::make_pair(irradiance, Eigen::Vector3d::Zero()) };
+    return getCurrentLuminosity() / sphereArea;
 }
 
 void IsotropicPointRadiationSourceModel::updateMembers_(double currentTime)
 {
+    // Retrieve luminosity once per epoch for all targets
     luminosityModel_->updateMembers(currentTime);
+    currentLuminosity_ = luminosityModel_->getLuminosity();
 }
 
 //*********************************************************************************************
@@ -177,7 +209,8 @@ DynamicallyPaneledRadiationSourceModel::DynamicallyPaneledRadiationSourceModel(
         const std::shared_ptr<basic_astrodynamics::BodyShapeModel>& sourceBodyShapeModel,
         std::unique_ptr<SourcePanelRadiosityModelUpdater> sourcePanelRadiosityModelUpdater,
         const std::vector<std::unique_ptr<SourcePanelRadiosityModel>>& baseRadiosityModels,
-        const std::vector<int>& numberOfPanelsPerRing) :
+        const std::vector<int>& numberOfPanelsPerRing,
+        const int numberOfThreads) :
         PaneledRadiationSourceModel(sourceBodyShapeModel, std::move(sourcePanelRadiosityModelUpdater)),
         numberOfPanelsPerRing_(numberOfPanelsPerRing)
 {
@@ -204,41 +237,171 @@ DynamicallyPaneledRadiationSourceModel::DynamicallyPaneledRadiationSourceModel(
                 Eigen::Vector3d(TUDAT_NAN, TUDAT_NAN, TUDAT_NAN),
                 std::move(radiosityModels));
     }
+
+    // Azimuthal directions of ring panels only depend on the ring layout, so are computed once
+    ringPanelAzimuthDirections_.resize(2, numberOfPanels - 1);
+    unsigned int currentPanelIndex = 0;
+    for (const auto& numberOfPanelsInCurrentRing : numberOfPanelsPerRing)
+    {
+        const double angularResolutionAzimuth = 2 * PI / numberOfPanelsInCurrentRing;
+        for (int currentPanelNumber = 0; currentPanelNumber < numberOfPanelsInCurrentRing; currentPanelNumber++)
+        {
+            ringPanelAzimuthDirections_(0, currentPanelIndex) = cos(currentPanelNumber * angularResolutionAzimuth);
+            ringPanelAzimuthDirections_(1, currentPanelIndex) = sin(currentPanelNumber * angularResolutionAzimuth);
+            currentPanelIndex++;
+        }
+    }
+
+    panelSurfaceNormals_.resize(3, numberOfPanels);
+    panelAreas_.resize(numberOfPanels);
+    panelIrradiances_.resize(numberOfPanels);
+
+    setNumberOfThreads(numberOfThreads);
 }
 
 IrradianceWithSourceList DynamicallyPaneledRadiationSourceModel::evaluateIrradianceAtPosition(
         const Eigen::Vector3d& targetPosition)
 {
-    // Generate center points of panels in spherical coordinates
-    const auto panelProperties = generatePaneledSphericalCap_EqualProjectedAttenuatedArea(
-            targetPosition, numberOfPanelsPerRing_, sourceBodyShapeModel_->getAverageRadius());
-    const auto panelCenters = std::get<0>(panelProperties);
-    const auto polarAngles = std::get<1>(panelProperties);
-    const auto azimuthAngles = std::get<2>(panelProperties);
-    const auto areas = std::get<3>(panelProperties);
-
-    for (unsigned int i = 0; i < numberOfPanels; ++i)
+    // Panels only depend on the target position and current time, so reuse previous result for same target position
+    if (isLastIrradianceListValid_ && targetPosition == lastTargetPosition_)
     {
-        const auto& relativeCenter = panelCenters[i];
-        const Eigen::Vector3d surfaceNormal = relativeCenter.normalized();
-        const auto polarAngle = polarAngles[i];
-        const auto azimuthAngle = azimuthAngles[i];
-        const auto area = areas[i];
+        return lastIrradiances_;
+    }
 
-        panels_[i].setRelativeCenter(relativeCenter, polarAngle, azimuthAngle);
-        panels_[i].setSurfaceNormal(surfaceNormal);
-        panels_[i].setArea(area);
+    updatePanelGeometry(targetPosition);
 
+    for (unsigned int i = 0; i < numberOfPanels; ++i)
+    {
         // Always update (independently of current time) because evaluation may come from different targets each call
         panels_[i].updateMembers(currentTime_);
         sourcePanelRadiosityModelUpdater_->updatePanel(panels_[i]);
     }
 
-    return PaneledRadiationSourceModel::evaluateIrradianceAtPosition(targetPosition);
+    // Panel is visible if target is in front of it, i.e. (targetPosition - panelCenter) . panelSurfaceNormal > 0,
+    // with panelCenter = bodyRadius * panelSurfaceNormal
+    const double bodyRadius = sourceBodyShapeModel_->getAverageRadius();
+    const Eigen::VectorXd targetHeightsAbovePanels =
+            (panelSurfaceNormals_.transpose() * targetPosition).array() - bodyRadius;
+
+    // Evaluate irradiance due to each panel, which is the sum of the irradiances from all of its radiosity models
+    auto evaluatePanelIrradiance = [&](const int i)
+    {
+        double irradiance = 0;
+        if (targetHeightsAbovePanels(i) > 0)
+        {
+            const Panel& panel = panels_[i];
+            const Eigen::Vector3d targetPositionRelativeToPanel = targetPosition - panel.getRelativeCenter();
+            for (auto& radiosityModel : panel.getRadiosityModels())
+            {
+                irradiance += radiosityModel->evaluateIrradianceAtPosition(
+                        panelAreas_(i), panel.getSurfaceNormal(), targetPositionRelativeToPanel);
+            }
+        }
+        panelIrradiances_(i) = irradiance;
+    };
+    if (threadPool_ == nullptr)
+    {
+        for (unsigned int i = 0; i < numberOfPanels; ++i)
+        {
+            evaluatePanelIrradiance(i);
+        }
+    }
+    else
+    {
+        threadPool_->executeTasks(numberOfPanels, evaluatePanelIrradiance);
+    }
+
+    // Do not add panels to list if they do not contribute to irradiance at target location
+    // This prevents unnecessary evaluations in the radiation pressure acceleration
+    visibleArea = (targetHeightsAbovePanels.array() > 0).select(panelAreas_, 0.0).sum();
+    lastIrradiances_.clear();
+    for (unsigned int i = 0; i < numberOfPanels; ++i)
+    {
+        if (panelIrradiances_(i) > 0)
+        {
+            lastIrradiances_.emplace_back(panelIrradiances_(i), panels_[i].getRelativeCenter());
+        }
+    }
+
+    lastTargetPosition_ = targetPosition;
+    isLastIrradianceListValid_ = true;
+    return lastIrradiances_;
+}
+
+void DynamicallyPaneledRadiationSourceModel::setNumberOfThreads(const int numberOfThreads)
+{
+    if (numberOfThreads < 1)
+    {
+        throw std::runtime_error( "Error when setting number of threads of dynamically paneled radiation source: number (" +
+                                  std::to_string( numberOfThreads ) + ") must be at least 1." );
+    }
+
+    if (numberOfThreads != numberOfThreads_ || (numberOfThreads > 1 && threadPool_ == nullptr))
+    {
+        numberOfThreads_ = numberOfThreads;
+        if (numberOfThreads_ > 1)
+        {
+            threadPool_ = std::make_shared<utilities::ParallelTaskPool>(numberOfThreads_);
+        }
+        else
+        {
+            threadPool_ = nullptr;
+        }
+    }
+}
+
+void DynamicallyPaneledRadiationSourceModel::updatePanelGeometry(const Eigen::Vector3d& targetPosition)
+{
+    // The panels are generated as if the target were above the north pole ("pole-aligned frame"), then rotated to the
+    // actual position ("target-aligned frame"), as in generatePaneledSphericalCap_EqualProjectedAttenuatedArea
+    const double bodyRadius = sourceBodyShapeModel_->getAverageRadius();
+    const std::vector<double> betas = computeRingBoundaryAngles_EqualProjectedAttenuatedArea(
+            targetPosition.norm(), numberOfPanelsPerRing_, bodyRadius);
+    const Eigen::Matrix3d rotationFromPoleAlignedToTargetAlignedFrame =
+            Eigen::Quaterniond::FromTwoVectors(Eigen::Vector3d::UnitZ(), targetPosition).toRotationMatrix();
+
+    // Central cap
+    panelSurfaceNormals_.col(0) = targetPosition.normalized();
+    panelAreas_(0) = 2 * PI * bodyRadius * bodyRadius * (1 - cos(betas.front()));
+
+    // Rings, with ring center polar-angle-wise halfway between both boundaries
+    unsigned int currentPanelIndex = 1;
+    for (unsigned int currentRingNumber = 0; currentRingNumber < numberOfPanelsPerRing_.size(); currentRingNumber++)
+    {
+        const int numberOfPanelsInCurrentRing = numberOfPanelsPerRing_[currentRingNumber];
+        const double ringCenterAngle = (betas[currentRingNumber] + betas[currentRingNumber + 1]) / 2;
+        const double panelArea = 2 * PI * bodyRadius * bodyRadius *
+                (cos(betas[currentRingNumber]) - cos(betas[currentRingNumber + 1])) / numberOfPanelsInCurrentRing;
+
+        panelSurfaceNormals_.block(0, currentPanelIndex, 2, numberOfPanelsInCurrentRing) =
+                sin(ringCenterAngle) * ringPanelAzimuthDirections_.middleCols(
+                        currentPanelIndex - 1, numberOfPanelsInCurrentRing);
+        panelSurfaceNormals_.block(2, currentPanelIndex, 1, numberOfPanelsInCurrentRing).setConstant(
+                cos(ringCenterAngle));
+        panelAreas_.segment(currentPanelIndex, numberOfPanelsInCurrentRing).setConstant(panelArea);
+        currentPanelIndex += numberOfPanelsInCurrentRing;
+    }
+    panelSurfaceNormals_.rightCols(numberOfPanels - 1) =
+            rotationFromPoleAlignedToTargetAlignedFrame * panelSurfaceNormals_.rightCols(numberOfPanels - 1);
+
+    // Set panel properties; surface normal is unit vector from source center to panel center for sphere
+    for (unsigned int i = 0; i < numberOfPanels; ++i)
+    {
+        const Eigen::Vector3d surfaceNormal = panelSurfaceNormals_.col(i);
+        const Eigen::Vector3d relativeCenter = bodyRadius * surfaceNormal;
+        const Eigen::Vector3d relativeCenterSpherical =
+                coordinate_conversions::convertCartesianToSpherical(relativeCenter);
+
+        panels_[i].setRelativeCenter(
+                relativeCenter, relativeCenterSpherical[1], computeModulo(relativeCenterSpherical[2], 2 * PI));
+        panels_[i].setSurfaceNormal(surfaceNormal);
+        panels_[i].setArea(panelAreas_(i));
+    }
 }
 
 void DynamicallyPaneledRadiationSourceModel::updateMembers_(double currentTime)
 {
+    isLastIrradianceListValid_ = false;
     sourcePanelRadiosityModelUpdater_->updateMembers(currentTime);
 }
 
@@ -273,7 +436,7 @@ void SourcePanelRadiosityModelUpdater::updateMembers(const double currentTime)
             // If other types than isotropic point sources are supported as original source, rotate to original source frame here
             Eigen::Vector3d sourceCenterPositionInOriginalSourceFrame = sourceCenterPositionInGlobalFrame - originalSourceCenterPositionInGlobalFrame;
             originalSourceUnoccultedIrradiances_[originalSourceName] =
-                    originalSourceModels_[originalSourceName]->evaluateIrradianceAtPosition(sourceCenterPositionInOriginalSourceFrame).front().first;
+                    originalSourceModels_[originalSourceName]->evaluatePointIrradianceAtPosition(sourceCenterPositionInOriginalSourceFrame);
 
             Eigen::Vector3d originalSourceToSourceDirectionInSourceFrame =
                     sourceRotationFromGlobalToLocalFrame
@@ -466,6 +629,37 @@ generatePaneledSphericalCap_EqualAngularResolution(
     return std::make_tuple(panelCenters, polarAngles, azimuthAngles, areas);
 }
 
+std::vector<double> computeRingBoundaryAngles_EqualProjectedAttenuatedArea(
+        double r_s,
+        const std::vector<int>& numberOfPanelsPerRing,
+        double R_e)
+{
+    // Algorithm adapted from Knocke (1989), Appendix A, see generatePaneledSphericalCap_EqualProjectedAttenuatedArea
+    // for nomenclature
+    std::vector<double> betas;
+
+    int N = 1;
+    for (const auto& N_s : numberOfPanelsPerRing) {
+        N += N_s;
+    }
+
+    const auto zeta_m = asin(R_e / r_s);
+    const auto zeta_1 = acos((N - 1 + cos(zeta_m)) / N);
+    const auto gamma_1 = asin(std::min(1.0, r_s * sin(zeta_1) / R_e));
+    betas.push_back(gamma_1 - zeta_1);
+
+    int k = 1;
+    for (const auto& N_s : numberOfPanelsPerRing) {
+        k += N_s;
+        auto zeta_i = acos(k * cos(zeta_1) - k + 1);
+        // min is necessary because argument may slightly exceed 1.0 due to floating point errors
+        auto gamma_i = asin(std::min(1.0, r_s * sin(zeta_i) / R_e));
+        betas.push_back(gamma_i - zeta_i);
+    }
+
+    return betas;
+}
+
 std::tuple<std::vector<Eigen::Vector3d>, std::vector<double>, std::vector<double>, std::vector<double>>
 generatePaneledSphericalCap_EqualProjectedAttenuatedArea(
         const Eigen::Vector3d& targetPosition,
@@ -492,33 +686,14 @@ generatePaneledSphericalCap_EqualProjectedAttenuatedArea(
     std::vector<double> azimuthAngles;
     std::vector<double> areas;
 
-    std::vector<double> betas;
-
     const Eigen::Quaterniond rotationFromPoleAlignedToTargetAlignedFrame =
             Eigen::Quaterniond::FromTwoVectors(Eigen::Vector3d::UnitZ(), targetPosition);
 
     const auto numberOfRings = numberOfPanelsPerRing.size();
-    int N = 1;
-    for (const auto& N_s : numberOfPanelsPerRing) {
-        N += N_s;
-    }
-
-    const auto r_s = targetPosition.norm();
 
     // Calculate ring boundaries
-    const auto zeta_m = asin(R_e / r_s);
-    const auto zeta_1 = acos((N - 1 + cos(zeta_m)) / N);
-    const auto gamma_1 = asin(std::min(1.0, r_s * sin(zeta_1) / R_e));
-    betas.push_back(gamma_1 - zeta_1);
-
-    int k = 1;
-    for (const auto& N_s : numberOfPanelsPerRing) {
-        k += N_s;
-        auto zeta_i = acos(k * cos(zeta_1) - k + 1);
-        // min is necessary because argument may slightly exceed 1.0 due to floating point errors
-        auto gamma_i = asin(std::min(1.0, r_s * sin(zeta_i) / R_e));
-        betas.push_back(gamma_i - zeta_i);
-    }
+    const std::vector<double> betas = computeRingBoundaryAngles_EqualProjectedAttenuatedArea(
+            targetPosition.norm(), numberOfPanelsPerRing, R_e);
 
     // Create central cap
     const Eigen::Vector3d centralCapCenterInTargetAlignedFrameCartesian = targetPosition.normalized() * R_e;
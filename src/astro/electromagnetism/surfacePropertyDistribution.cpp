@@ -10,6 +10,10 @@
 
 #include "tudat/astro/electromagnetism/surfacePropertyDistribution.h"
 
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
 #include "tudat/math/basic/legendrePolynomials.h"
 #include "tudat/astro/basic_astro/physicalConstants.h"
 
@@ -31,6 +35,76 @@ void SurfacePropertyDistribution::updateMembers(const double currentTime)
 double SphericalHarmonicsSurfacePropertyDistribution::getValue(
         double latitude,
         double longitude)
+{
+    if (gridValues_.size() > 0)
+    {
+        return interpolateFromGrid(latitude, longitude);
+    }
+    return evaluateExpansion(latitude, longitude);
+}
+
+void SphericalHarmonicsSurfacePropertyDistribution::setInterpolationGridResolution(double gridResolution)
+{
+    if (std::isnan(gridResolution))
+    {
+        gridResolution_ = TUDAT_NAN;
+        gridValues_.resize(0, 0);
+        return;
+    }
+    if (!(gridResolution > 0))
+    {
+        throw std::runtime_error(
+                "Error when setting interpolation grid of spherical harmonics surface property distribution; "
+                "resolution must be positive" );
+    }
+    gridResolution_ = gridResolution;
+
+    // Grid nodes are equally spaced, with spacing not exceeding requested resolution
+    const int numberOfLatitudes = static_cast<int>(std::ceil(PI / gridResolution)) + 1;
+    const int numberOfLongitudes = std::max(static_cast<int>(std::ceil(2 * PI / gridResolution)), 1);
+    gridLatitudeStep_ = PI / (numberOfLatitudes - 1);
+    gridLongitudeStep_ = 2 * PI / numberOfLongitudes;
+
+    Eigen::MatrixXd gridValues(numberOfLatitudes, numberOfLongitudes);
+    for (int i = 0; i < numberOfLatitudes; ++i)
+    {
+        for (int j = 0; j < numberOfLongitudes; ++j)
+        {
+            gridValues(i, j) = evaluateExpansion(-PI / 2 + i * gridLatitudeStep_, -PI + j * gridLongitudeStep_);
+        }
+    }
+    gridValues_ = gridValues;
+}
+
+double SphericalHarmonicsSurfacePropertyDistribution::interpolateFromGrid(
+        double latitude,
+        double longitude) const
+{
+    const int numberOfLatitudes = gridValues_.rows();
+    const int numberOfLongitudes = gridValues_.cols();
+
+    const double scaledLatitude = (latitude + PI / 2) / gridLatitudeStep_;
+    const int lowerLatitudeIndex = std::min(std::max(static_cast<int>(std::floor(scaledLatitude)), 0), numberOfLatitudes - 2);
+    const double latitudeFraction = scaledLatitude - lowerLatitudeIndex;
+
+    // Longitude is periodic
+    double scaledLongitude = (longitude + PI) / gridLongitudeStep_;
+    scaledLongitude -= numberOfLongitudes * std::floor(scaledLongitude / numberOfLongitudes);
+    const int lowerLongitudeIndex = std::min(static_cast<int>(scaledLongitude), numberOfLongitudes - 1);
+    const double longitudeFraction = scaledLongitude - lowerLongitudeIndex;
+    const int upperLongitudeIndex = (lowerLongitudeIndex + 1) % numberOfLongitudes;
+
+    return (1 - latitudeFraction) * (
+                (1 - longitudeFraction) * gridValues_(lowerLatitudeIndex, lowerLongitudeIndex) +
+                longitudeFraction * gridValues_(lowerLatitudeIndex, upperLongitudeIndex)) +
+            latitudeFraction * (
+                (1 - longitudeFraction) * gridValues_(lowerLatitudeIndex + 1, lowerLongitudeIndex) +
+                longitudeFraction * gridValues_(lowerLatitudeIndex + 1, upperLongitudeIndex));
+}
+
+double SphericalHarmonicsSurfacePropertyDistribution::evaluateExpansion(
+        double latitude,
+        double longitude)
 {
     sphericalHarmonicsCache_.update(TUDAT_NAN, sin(latitude), longitude, TUDAT_NAN);
 
@@ -0,0 +1,291 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+#include "tudat/astro/ephemerides/chebyshevEphemeris.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Constructor, fits the Chebyshev segments to the tabulated data.
+ChebyshevCartesianEphemeris::ChebyshevCartesianEphemeris(
+        const std::map< double, Eigen::Vector6d >& stateHistory,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const int polynomialDegree,
+        const std::string referenceFrameOrigin,
+        const std::string referenceFrameOrientation ):
+    Ephemeris( referenceFrameOrigin, referenceFrameOrientation ),
+    positionTolerance_( positionTolerance ), velocityTolerance_( velocityTolerance ),
+    polynomialDegree_( polynomialDegree ), startTime_( TUDAT_NAN ), endTime_( TUDAT_NAN ),
+    segmentDuration_( TUDAT_NAN ), inverseSegmentDuration_( TUDAT_NAN ), numberOfSegments_( 0 ),
+    maximumPositionFitError_( TUDAT_NAN ), maximumVelocityFitError_( TUDAT_NAN )
+{
+    if( polynomialDegree_ < 1 )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, polynomial degree must be at least 1" );
+    }
+
+    if( stateHistory.size( ) > 0 )
+    {
+        resetStateHistory( stateHistory );
+    }
+}
+
+//! Constructor, fits the Chebyshev segments to a state function.
+ChebyshevCartesianEphemeris::ChebyshevCartesianEphemeris(
+        const std::function< Eigen::Vector6d( const double ) >& stateFunction,
+        const double startTime,
+        const double endTime,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const int polynomialDegree,
+        const double minimumSegmentDuration,
+        const std::string referenceFrameOrigin,
+        const std::string referenceFrameOrientation ):
+    Ephemeris( referenceFrameOrigin, referenceFrameOrientation ),
+    positionTolerance_( positionTolerance ), velocityTolerance_( velocityTolerance ),
+    polynomialDegree_( polynomialDegree ), startTime_( TUDAT_NAN ), endTime_( TUDAT_NAN ),
+    segmentDuration_( TUDAT_NAN ), inverseSegmentDuration_( TUDAT_NAN ), numberOfSegments_( 0 ),
+    maximumPositionFitError_( TUDAT_NAN ), maximumVelocityFitError_( TUDAT_NAN )
+{
+    if( polynomialDegree_ < 1 )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, polynomial degree must be at least 1" );
+    }
+
+    resetStateFunction( stateFunction, startTime, endTime, minimumSegmentDuration );
+}
+
+//! Function to refit the Chebyshev segments to new tabulated data.
+void ChebyshevCartesianEphemeris::resetStateHistory( const std::map< double, Eigen::Vector6d >& stateHistory )
+{
+    // Lagrange interpolation used to retrieve states at Chebyshev nodes requires at least 8 data points
+    const int numberOfLagrangeStages = 8;
+    if( stateHistory.size( ) < static_cast< unsigned int >( numberOfLagrangeStages ) )
+    {
+        throw std::runtime_error( "Error when fitting Chebyshev ephemeris, at least " +
+                                  std::to_string( numberOfLagrangeStages ) + " tabulated states are required, " +
+                                  std::to_string( stateHistory.size( ) ) + " found" );
+    }
+
+    startTime_ = stateHistory.begin( )->first;
+    endTime_ = stateHistory.rbegin( )->first;
+
+    // Retrieve states at arbitrary epochs from Lagrange interpolation through the tabulated data, using an off-centered
+    // stencil near the edges of the data (rather than a lower-order boundary interpolator)
+    std::vector< double > tabulatedTimes;
+    std::vector< Eigen::Vector6d > tabulatedStates;
+    for( const auto& stateIterator : stateHistory )
+    {
+        tabulatedTimes.push_back( stateIterator.first );
+        tabulatedStates.push_back( stateIterator.second );
+    }
+    std::function< Eigen::Vector6d( const double ) > stateFunction = [ = ]( const double time )
+    {
+        int firstIndex = static_cast< int >(
+                    std::upper_bound( tabulatedTimes.begin( ), tabulatedTimes.end( ), time ) - tabulatedTimes.begin( ) ) -
+                numberOfLagrangeStages / 2;
+        firstIndex = std::max( 0, std::min( firstIndex, static_cast< int >( tabulatedTimes.size( ) ) - numberOfLagrangeStages ) );
+
+        Eigen::Vector6d interpolatedState = Eigen::Vector6d::Zero( );
+        for( int i = firstIndex; i < firstIndex + numberOfLagrangeStages; i++ )
+        {
+            double lagrangeWeight = 1.0;
+            for( int j = firstIndex; j < firstIndex + numberOfLagrangeStages; j++ )
+            {
+                if( j != i )
+                {
+                    lagrangeWeight *= ( time - tabulatedTimes[ j ] ) / ( tabulatedTimes[ i ] - tabulatedTimes[ j ] );
+                }
+            }
+            interpolatedState += lagrangeWeight * tabulatedStates[ i ];
+        }
+        return interpolatedState;
+    };
+
+    // Increase number of segments until segments become shorter than the time step of the tabulated data (at which
+    // point the data no longer constrains the fit)
+    fitToStateFunction( stateFunction, stateHistory, static_cast< int >( stateHistory.size( ) ) - 1 );
+}
+
+//! Function to refit the Chebyshev segments to a state function
+void ChebyshevCartesianEphemeris::resetStateFunction(
+        const std::function< Eigen::Vector6d( const double ) >& stateFunction,
+        const double startTime,
+        const double endTime,
+        const double minimumSegmentDuration )
+{
+    if( !( endTime > startTime ) )
+    {
+        throw std::runtime_error( "Error when fitting Chebyshev ephemeris, end time must be larger than start time" );
+    }
+    startTime_ = startTime;
+    endTime_ = endTime;
+
+    fitToStateFunction( stateFunction, std::map< double, Eigen::Vector6d >( ),
+                        std::max( 1, static_cast< int >( std::ceil( ( endTime_ - startTime_ ) / minimumSegmentDuration ) ) ) );
+}
+
+//! Function to fit the Chebyshev segments to a state function, increasing the number of segments until tolerance is met
+void ChebyshevCartesianEphemeris::fitToStateFunction(
+        const std::function< Eigen::Vector6d( const double ) >& stateFunction,
+        const std::map< double, Eigen::Vector6d >& stateHistory,
+        const int maximumNumberOfSegments )
+{
+    // Increase number of (equal-duration) segments until tolerance is met (limited to level of round-off error of the
+    // states), or until the maximum number of segments is reached
+    const double roundOffLevel = 100.0 * std::numeric_limits< double >::epsilon( );
+    int numberOfSegments = 1;
+    while( true )
+    {
+        double maximumPositionNorm = 0.0, maximumVelocityNorm = 0.0;
+        fitSegments( stateHistory, stateFunction, numberOfSegments, maximumPositionNorm, maximumVelocityNorm );
+        if( maximumPositionFitError_ <= std::max( positionTolerance_, roundOffLevel * maximumPositionNorm ) &&
+                maximumVelocityFitError_ <= std::max( velocityTolerance_, roundOffLevel * maximumVelocityNorm ) )
+        {
+            break;
+        }
+        else if( numberOfSegments >= maximumNumberOfSegments )
+        {
+            std::cerr << "Warning when fitting Chebyshev ephemeris, tolerance could not be met; maximum position error is "
+                      << maximumPositionFitError_ << ", maximum velocity error is " << maximumVelocityFitError_
+                      << std::endl;
+            break;
+        }
+        numberOfSegments = std::min( 2 * numberOfSegments, maximumNumberOfSegments );
+    }
+}
+
+//! Function to compute the Chebyshev coefficients of all segments, for a given number of segments
+void ChebyshevCartesianEphemeris::fitSegments( const std::map< double, Eigen::Vector6d >& stateHistory,
+                                               const std::function< Eigen::Vector6d( const double ) >& stateFunction,
+                                               const int numberOfSegments,
+                                               double& maximumPositionNorm,
+                                               double& maximumVelocityNorm )
+{
+    numberOfSegments_ = numberOfSegments;
+    segmentDuration_ = ( endTime_ - startTime_ ) / static_cast< double >( numberOfSegments_ );
+    inverseSegmentDuration_ = 1.0 / segmentDuration_;
+
+    const int numberOfNodes = polynomialDegree_ + 1;
+    coefficients_.resize( numberOfSegments_ * 6 * numberOfNodes );
+
+    // Compute normalized Chebyshev nodes, and cosine terms used for the (discrete) Chebyshev transform
+    std::vector< double > normalizedNodes( numberOfNodes );
+    Eigen::MatrixXd transformMatrix = Eigen::MatrixXd( numberOfNodes, numberOfNodes );
+    for( int k = 0; k < numberOfNodes; k++ )
+    {
+        double nodeAngle = mathematical_constants::PI * ( static_cast< double >( k ) + 0.5 ) /
+                static_cast< double >( numberOfNodes );
+        normalizedNodes[ k ] = std::cos( nodeAngle );
+        for( int j = 0; j < numberOfNodes; j++ )
+        {
+            transformMatrix( j, k ) = ( ( j == 0 ) ? 1.0 : 2.0 ) * std::cos( static_cast< double >( j ) * nodeAngle ) /
+                    static_cast< double >( numberOfNodes );
+        }
+    }
+
+    // Compute Chebyshev coefficients in each segment, and check fit in between nodes (w.r.t. state function)
+    Eigen::MatrixXd nodeStates = Eigen::MatrixXd( 6, numberOfNodes );
+    Eigen::Vector6d fittedState;
+    maximumPositionFitError_ = 0.0;
+    maximumVelocityFitError_ = 0.0;
+    for( int i = 0; i < numberOfSegments_; i++ )
+    {
+        double segmentStartTime = startTime_ + static_cast< double >( i ) * segmentDuration_;
+        for( int k = 0; k < numberOfNodes; k++ )
+        {
+            nodeStates.col( k ) = stateFunction( segmentStartTime + 0.5 * ( normalizedNodes[ k ] + 1.0 ) * segmentDuration_ );
+            maximumPositionNorm = std::max( maximumPositionNorm, nodeStates.block( 0, k, 3, 1 ).norm( ) );
+            maximumVelocityNorm = std::max( maximumVelocityNorm, nodeStates.block( 3, k, 3, 1 ).norm( ) );
+        }
+
+        Eigen::Map< Eigen::MatrixXd >( coefficients_.data( ) + i * 6 * numberOfNodes, 6, numberOfNodes ) =
+                nodeStates * transformMatrix.transpose( );
+
+        for( int k = 0; k < numberOfNodes - 1; k++ )
+        {
+            double checkNode = 0.5 * ( normalizedNodes[ k ] + normalizedNodes[ k + 1 ] );
+            evaluateSegment( i, checkNode, fittedState );
+            Eigen::Vector6d stateError = fittedState - stateFunction(
+                        segmentStartTime + 0.5 * ( checkNode + 1.0 ) * segmentDuration_ );
+            maximumPositionFitError_ = std::max( maximumPositionFitError_, stateError.segment( 0, 3 ).norm( ) );
+            maximumVelocityFitError_ = std::max( maximumVelocityFitError_, stateError.segment( 3, 3 ).norm( ) );
+        }
+    }
+
+    // Check fit at tabulated states (if any)
+    for( const auto& stateIterator : stateHistory )
+    {
+        Eigen::Vector6d stateError = getCartesianState( stateIterator.first ) - stateIterator.second;
+        maximumPositionFitError_ = std::max( maximumPositionFitError_, stateError.segment( 0, 3 ).norm( ) );
+        maximumVelocityFitError_ = std::max( maximumVelocityFitError_, stateError.segment( 3, 3 ).norm( ) );
+    }
+}
+
+//! Function to compute the state in a given segment, at a given normalized time (in [-1,1])
+void ChebyshevCartesianEphemeris::evaluateSegment(
+        const int segmentIndex, const double normalizedTime, Eigen::Vector6d& state )
+{
+    // Evaluate Chebyshev series of all state components simultaneously, using Clenshaw's recurrence
+    typedef Eigen::Map< const Eigen::Vector6d > CoefficientVector;
+    const double* segmentCoefficients = coefficients_.data( ) + segmentIndex * 6 * ( polynomialDegree_ + 1 );
+    const double twiceNormalizedTime = 2.0 * normalizedTime;
+
+    Eigen::Vector6d currentTerm = Eigen::Vector6d::Zero( );
+    Eigen::Vector6d previousTerm = Eigen::Vector6d::Zero( );
+    Eigen::Vector6d nextTerm;
+    for( int k = polynomialDegree_; k > 0; k-- )
+    {
+        nextTerm = CoefficientVector( segmentCoefficients + 6 * k ) + twiceNormalizedTime * currentTerm - previousTerm;
+        previousTerm = currentTerm;
+        currentTerm = nextTerm;
+    }
+    state = CoefficientVector( segmentCoefficients ) + normalizedTime * currentTerm - previousTerm;
+}
+
+//! Get cartesian state from ephemeris.
+Eigen::Vector6d ChebyshevCartesianEphemeris::getCartesianState(
+        const double secondsSinceEpoch )
+{
+    if( numberOfSegments_ == 0 )
+    {
+        throw std::runtime_error( "Error when calling ChebyshevCartesianEphemeris, no state history defined" );
+    }
+    else if( !( secondsSinceEpoch >= startTime_ && secondsSinceEpoch <= endTime_ ) )
+    {
+        throw std::runtime_error( "Error when calling ChebyshevCartesianEphemeris, requested time " +
+                                  std::to_string( secondsSinceEpoch ) + " is outside fitted interval [" +
+                                  std::to_string( startTime_ ) + ", " + std::to_string( endTime_ ) + "]" );
+    }
+
+    // Retrieve segment index directly from (constant) segment duration
+    int segmentIndex = std::min( static_cast< int >( ( secondsSinceEpoch - startTime_ ) * inverseSegmentDuration_ ),
+                                 numberOfSegments_ - 1 );
+    double normalizedTime = 2.0 * ( ( secondsSinceEpoch - startTime_ ) * inverseSegmentDuration_ -
+                                    static_cast< double >( segmentIndex ) ) - 1.0;
+
+    Eigen::Vector6d state;
+    evaluateSegment( segmentIndex, normalizedTime, state );
+    return state;
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
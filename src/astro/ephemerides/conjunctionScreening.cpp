@@ -0,0 +1,571 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+#include "tudat/astro/ephemerides/conjunctionScreening.h"
+#include "tudat/basics/parallelization.h"
+#include "tudat/math/basic/functionProxy.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+#include "tudat/math/root_finders/bisection.h"
+#include "tudat/math/root_finders/terminationConditions.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Function to create a function that returns the covariance of an object, propagated by its state transition matrix
+std::function< Eigen::Matrix6d( const double ) > createPropagatedCovarianceFunction(
+        const Eigen::Matrix6d& initialCovariance,
+        const std::function< Eigen::Matrix6d( const double ) >& stateTransitionMatrixFunction )
+{
+    return [ = ]( const double time )
+    {
+        const Eigen::Matrix6d stateTransitionMatrix = stateTransitionMatrixFunction( time );
+        return Eigen::Matrix6d( stateTransitionMatrix * initialCovariance * stateTransitionMatrix.transpose( ) );
+    };
+}
+
+//! Relative state of a pair of objects at both ends of a step of the screening grid, interpolated by a cubic Hermite
+//! polynomial over the step
+class RelativeHermiteInterpolant
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param initialRelativeState Relative state at the start of the step
+     *  \param finalRelativeState Relative state at the end of the step
+     *  \param stepSize Size of the step
+     */
+    RelativeHermiteInterpolant( const Eigen::Vector6d& initialRelativeState,
+                                const Eigen::Vector6d& finalRelativeState,
+                                const double stepSize ):
+        initialRelativeState_( initialRelativeState ), finalRelativeState_( finalRelativeState ), stepSize_( stepSize ){ }
+
+    //! Function to compute the interpolated relative state at a given time since the start of the step
+    Eigen::Vector6d getRelativeState( const double timeSinceStepStart ) const
+    {
+        const double s = timeSinceStepStart / stepSize_;
+        const double s2 = s * s;
+        const double s3 = s2 * s;
+
+        Eigen::Vector6d relativeState;
+        relativeState.segment< 3 >( 0 ) =
+                ( 2.0 * s3 - 3.0 * s2 + 1.0 ) * initialRelativeState_.segment< 3 >( 0 ) +
+                stepSize_ * ( s3 - 2.0 * s2 + s ) * initialRelativeState_.segment< 3 >( 3 ) +
+                ( -2.0 * s3 + 3.0 * s2 ) * finalRelativeState_.segment< 3 >( 0 ) +
+                stepSize_ * ( s3 - s2 ) * finalRelativeState_.segment< 3 >( 3 );
+        relativeState.segment< 3 >( 3 ) =
+                ( 6.0 * s2 - 6.0 * s ) / stepSize_ * initialRelativeState_.segment< 3 >( 0 ) +
+                ( 3.0 * s2 - 4.0 * s + 1.0 ) * initialRelativeState_.segment< 3 >( 3 ) +
+                ( -6.0 * s2 + 6.0 * s ) / stepSize_ * finalRelativeState_.segment< 3 >( 0 ) +
+                ( 3.0 * s2 - 2.0 * s ) * finalRelativeState_.segment< 3 >( 3 );
+        return relativeState;
+    }
+
+    //! Function to compute the derivative of half the squared relative distance (i.e. relative position times velocity)
+    double getRangeRateFunction( const double timeSinceStepStart ) const
+    {
+        const Eigen::Vector6d relativeState = getRelativeState( timeSinceStepStart );
+        return relativeState.segment< 3 >( 0 ).dot( relativeState.segment< 3 >( 3 ) );
+    }
+
+private:
+
+    //! Relative state at the start of the step
+    Eigen::Vector6d initialRelativeState_;
+
+    //! Relative state at the end of the step
+    Eigen::Vector6d finalRelativeState_;
+
+    //! Size of the step
+    double stepSize_;
+};
+
+//! Function to find the root of a function in a bracketing interval, using the bisection method
+/*!
+ *  Function to find the root of a function in a bracketing interval, using the bisection method, with an absolute
+ *  tolerance on the root.
+ *  \param rootFunction Function of which the root is to be found
+ *  \param lowerBound Lower bound of the interval containing the root
+ *  \param upperBound Upper bound of the interval containing the root
+ *  \param tolerance Absolute tolerance on the root
+ *  \return Root of the function
+ */
+double findRootInInterval( const std::function< double( const double ) >& rootFunction,
+                           const double lowerBound,
+                           const double upperBound,
+                           const double tolerance )
+{
+    root_finders::Bisection< >::TerminationFunction terminationConditionFunction =
+            std::bind( &root_finders::RootAbsoluteToleranceTerminationCondition< double >::checkTerminationCondition,
+                       std::make_shared< root_finders::RootAbsoluteToleranceTerminationCondition< double > >(
+                           tolerance ),
+                       std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4,
+                       std::placeholders::_5 );
+    root_finders::Bisection< > bisection( terminationConditionFunction, lowerBound, upperBound );
+    return bisection.execute( basic_mathematics::univariateProxy( rootFunction ) );
+}
+
+//! Function to compute the maximum deviation of the cubic Hermite interpolant of a trajectory from the chord of a step
+/*!
+ *  Function to compute an upper bound for the deviation of the cubic Hermite interpolant of a trajectory from the
+ *  straight line between the positions at both ends of a step. With c the mean velocity over the step, the deviation at
+ *  normalized time s is h * s * ( 1 - s ) * ( ( 1 - s ) * ( v0 - c ) - s * ( v1 - c ) ), which is bounded by
+ *  h / 4 * max( |v0 - c|, |v1 - c| ).
+ *  \param initialState State at the start of the step
+ *  \param finalState State at the end of the step
+ *  \param stepSize Size of the step
+ *  \return Upper bound for the deviation of the interpolant from the chord
+ */
+double computeMaximumChordDeviation( const Eigen::Vector6d& initialState,
+                                     const Eigen::Vector6d& finalState,
+                                     const double stepSize )
+{
+    const Eigen::Vector3d meanVelocity = ( finalState.segment< 3 >( 0 ) - initialState.segment< 3 >( 0 ) ) / stepSize;
+    return stepSize / 4.0 * std::max( ( initialState.segment< 3 >( 3 ) - meanVelocity ).norm( ),
+                                       ( finalState.segment< 3 >( 3 ) - meanVelocity ).norm( ) );
+}
+
+//! Maximum number of cells of the spatial hash into which the box of a single object is inserted
+const double maximumNumberOfHashCellsPerObject = 64.0;
+
+//! Close approach found by the screening, with the index of the step of the grid in which it was found
+struct GridConjunctionEvent
+{
+    //! Close approach
+    ConjunctionEvent event;
+
+    //! Index of the step of the grid in which the close approach was found
+    int stepIndex;
+};
+
+//! Function to key a cell of the spatial hash
+long long getSpatialHashKey( const long long xIndex, const long long yIndex, const long long zIndex )
+{
+    // Indices are wrapped to 21 bits; cells that share a key are merged, which does not affect the result
+    const long long mask = ( 1LL << 21 ) - 1;
+    return ( xIndex & mask ) | ( ( yIndex & mask ) << 21 ) | ( ( zIndex & mask ) << 42 );
+}
+
+//! Function to screen a single step of the grid for close approaches
+/*!
+ *  Function to screen a single step of the grid for close approaches, using the spatial hash and radial range prefilters,
+ *  and root-finding on the relative Hermite interpolant, as described for screenCatalogueForConjunctions.
+ *  \param catalogueStates States of the objects, stored contiguously per epoch
+ *  \param epochs Epochs of the grid
+ *  \param numberOfObjects Number of objects in the catalogue
+ *  \param stepIndex Index of the step that is to be screened
+ *  \param minimumDistances Lower bound of the distance of each object from the central body over the grid
+ *  \param maximumDistances Upper bound of the distance of each object from the central body over the grid
+ *  \param settings Settings for the screening
+ *  \param spatialHash Spatial hash, reused between calls to limit rehashing (cleared by this function)
+ *  \param events Close approaches found in the step (appended by reference)
+ */
+void screenGridStepForConjunctions(
+        const Eigen::Matrix< double, 6, Eigen::Dynamic >& catalogueStates,
+        const std::vector< double >& epochs,
+        const int numberOfObjects,
+        const int stepIndex,
+        const std::vector< double >& minimumDistances,
+        const std::vector< double >& maximumDistances,
+        const ConjunctionScreeningSettings& settings,
+        std::unordered_map< long long, std::vector< int > >& spatialHash,
+        std::vector< GridConjunctionEvent >& events )
+{
+    const double stepSize = epochs.at( stepIndex + 1 ) - epochs.at( stepIndex );
+    const int initialColumn = stepIndex * numberOfObjects;
+    const int finalColumn = ( stepIndex + 1 ) * numberOfObjects;
+
+    // Compute box containing the interpolated trajectory of each object over the step, padded by half the screening
+    // distance, so that the boxes of two objects overlap if they can come within the screening distance of each other
+    Eigen::Matrix3Xd boxMinima( 3, numberOfObjects ), boxMaxima( 3, numberOfObjects );
+    std::vector< double > boxSizes( numberOfObjects );
+    for( int i = 0; i < numberOfObjects; i++ )
+    {
+        const Eigen::Vector6d initialState = catalogueStates.col( initialColumn + i );
+        const Eigen::Vector6d finalState = catalogueStates.col( finalColumn + i );
+        const double padding = computeMaximumChordDeviation( initialState, finalState, stepSize ) +
+                settings.screeningDistance_ / 2.0;
+        boxMinima.col( i ) = initialState.segment< 3 >( 0 ).cwiseMin( finalState.segment< 3 >( 0 ) ).array( ) - padding;
+        boxMaxima.col( i ) = initialState.segment< 3 >( 0 ).cwiseMax( finalState.segment< 3 >( 0 ) ).array( ) + padding;
+        boxSizes[ i ] = ( boxMaxima.col( i ) - boxMinima.col( i ) ).maxCoeff( );
+    }
+
+    // Set cell size of spatial hash to median box size, so that most boxes cover at most eight cells
+    std::nth_element( boxSizes.begin( ), boxSizes.begin( ) + numberOfObjects / 2, boxSizes.end( ) );
+    const double cellSize = std::max( boxSizes[ numberOfObjects / 2 ], settings.screeningDistance_ );
+
+    // Function to check a pair of objects against the filters, and find its close approach in the step (if any)
+    auto processPair = [ & ]( const int firstObject, const int secondObject )
+    {
+        // Apply perigee/apogee filter
+        if( minimumDistances[ firstObject ] - settings.screeningDistance_ > maximumDistances[ secondObject ] ||
+                minimumDistances[ secondObject ] - settings.screeningDistance_ > maximumDistances[ firstObject ] )
+        {
+            return;
+        }
+
+        // Find minimum of relative distance in step (each minimum is assigned to the step in which it lies, or at the
+        // end of which it lies)
+        const RelativeHermiteInterpolant relativeInterpolant(
+                    catalogueStates.col( initialColumn + secondObject ) - catalogueStates.col( initialColumn + firstObject ),
+                    catalogueStates.col( finalColumn + secondObject ) - catalogueStates.col( finalColumn + firstObject ),
+                    stepSize );
+        if( !( relativeInterpolant.getRangeRateFunction( 0.0 ) < 0.0 &&
+               relativeInterpolant.getRangeRateFunction( stepSize ) >= 0.0 ) )
+        {
+            return;
+        }
+
+        const double timeSinceStepStart = findRootInInterval(
+                    std::bind( &RelativeHermiteInterpolant::getRangeRateFunction, &relativeInterpolant,
+                               std::placeholders::_1 ),
+                    0.0, stepSize, settings.timeOfClosestApproachTolerance_ );
+        const Eigen::Vector6d relativeState = relativeInterpolant.getRelativeState( timeSinceStepStart );
+        const double missDistance = relativeState.segment< 3 >( 0 ).norm( );
+        if( missDistance <= settings.screeningDistance_ )
+        {
+            GridConjunctionEvent gridEvent;
+            gridEvent.event.firstObjectIndex = firstObject;
+            gridEvent.event.secondObjectIndex = secondObject;
+            gridEvent.event.timeOfClosestApproach = epochs.at( stepIndex ) + timeSinceStepStart;
+            gridEvent.event.missDistance = missDistance;
+            gridEvent.event.relativeState = relativeState;
+            gridEvent.event.combinedPositionCovariance.setZero( );
+            gridEvent.event.isCovarianceAvailable = false;
+            gridEvent.stepIndex = stepIndex;
+            events.push_back( gridEvent );
+        }
+    };
+
+    // Insert boxes into spatial hash (boxes covering a large number of cells are instead checked against all objects)
+    spatialHash.clear( );
+    std::vector< int > largeObjects;
+    std::vector< bool > isLargeObject( numberOfObjects, false );
+    for( int i = 0; i < numberOfObjects; i++ )
+    {
+        const Eigen::Vector3d minimumCell = ( boxMinima.col( i ) / cellSize ).array( ).floor( );
+        const Eigen::Vector3d maximumCell = ( boxMaxima.col( i ) / cellSize ).array( ).floor( );
+        if( ( maximumCell - minimumCell + Eigen::Vector3d::Ones( ) ).prod( ) > maximumNumberOfHashCellsPerObject )
+        {
+            largeObjects.push_back( i );
+            isLargeObject[ i ] = true;
+            continue;
+        }
+
+        for( long long x = minimumCell.x( ); x <= maximumCell.x( ); x++ )
+        {
+            for( long long y = minimumCell.y( ); y <= maximumCell.y( ); y++ )
+            {
+                for( long long z = minimumCell.z( ); z <= maximumCell.z( ); z++ )
+                {
+                    spatialHash[ getSpatialHashKey( x, y, z ) ].push_back( i );
+                }
+            }
+        }
+    }
+
+    // Check pairs of objects that share a cell, processing each pair only in the cell containing the lower corner of the
+    // overlap of their boxes (so that it is processed only once)
+    for( const auto& cellIterator : spatialHash )
+    {
+        const std::vector< int >& cellObjects = cellIterator.second;
+        for( unsigned int i = 0; i < cellObjects.size( ); i++ )
+        {
+            for( unsigned int j = i + 1; j < cellObjects.size( ); j++ )
+            {
+                const int firstObject = std::min( cellObjects[ i ], cellObjects[ j ] );
+                const int secondObject = std::max( cellObjects[ i ], cellObjects[ j ] );
+                const Eigen::Vector3d overlapMinimum = boxMinima.col( firstObject ).cwiseMax(
+                            boxMinima.col( secondObject ) );
+                const Eigen::Vector3d overlapMaximum = boxMaxima.col( firstObject ).cwiseMin(
+                            boxMaxima.col( secondObject ) );
+                if( ( overlapMinimum.array( ) > overlapMaximum.array( ) ).any( ) )
+                {
+                    continue;
+                }
+                const Eigen::Vector3d overlapCell = ( overlapMinimum / cellSize ).array( ).floor( );
+                if( getSpatialHashKey( overlapCell.x( ), overlapCell.y( ), overlapCell.z( ) ) == cellIterator.first )
+                {
+                    processPair( firstObject, secondObject );
+                }
+            }
+        }
+    }
+
+    // Check pairs with at least one object with a large box
+    for( unsigned int i = 0; i < largeObjects.size( ); i++ )
+    {
+        const int largeObject = largeObjects[ i ];
+        for( int otherObject = 0; otherObject < numberOfObjects; otherObject++ )
+        {
+            if( otherObject == largeObject || ( isLargeObject[ otherObject ] && otherObject < largeObject ) )
+            {
+                continue;
+            }
+            const Eigen::Vector3d overlapMinimum = boxMinima.col( largeObject ).cwiseMax( boxMinima.col( otherObject ) );
+            const Eigen::Vector3d overlapMaximum = boxMaxima.col( largeObject ).cwiseMin( boxMaxima.col( otherObject ) );
+            if( ( overlapMinimum.array( ) <= overlapMaximum.array( ) ).all( ) )
+            {
+                processPair( std::min( largeObject, otherObject ), std::max( largeObject, otherObject ) );
+            }
+        }
+    }
+}
+
+//! Function to screen a catalogue for close approaches, retaining the step of the grid in which each was found
+std::vector< GridConjunctionEvent > screenCatalogueForGridConjunctions(
+        const Eigen::Matrix< double, 6, Eigen::Dynamic >& catalogueStates,
+        const std::vector< double >& epochs,
+        const int numberOfObjects,
+        const ConjunctionScreeningSettings& settings )
+{
+    const int numberOfEpochs = static_cast< int >( epochs.size( ) );
+    if( numberOfObjects < 1 || catalogueStates.cols( ) != static_cast< long >( numberOfEpochs ) * numberOfObjects )
+    {
+        throw std::runtime_error( "Error when screening catalogue for conjunctions, number of states (" +
+                                  std::to_string( catalogueStates.cols( ) ) + ") is incompatible with number of " +
+                                  "objects (" + std::to_string( numberOfObjects ) + ") and epochs (" +
+                                  std::to_string( numberOfEpochs ) + ")" );
+    }
+    if( numberOfEpochs < 2 )
+    {
+        throw std::runtime_error( "Error when screening catalogue for conjunctions, at least two epochs are required" );
+    }
+    for( int i = 1; i < numberOfEpochs; i++ )
+    {
+        if( !( epochs.at( i ) > epochs.at( i - 1 ) ) )
+        {
+            throw std::runtime_error( "Error when screening catalogue for conjunctions, epochs are not increasing" );
+        }
+    }
+    if( settings.numberOfThreads_ < 1 )
+    {
+        throw std::runtime_error( "Error when screening catalogue for conjunctions, number of threads must be at least 1" );
+    }
+
+    // Compute range of distance from central body of each object (lower bound from the distance of each chord, and
+    // deviation of the interpolant from it)
+    const int numberOfSteps = numberOfEpochs - 1;
+    std::vector< double > minimumDistances( numberOfObjects, TUDAT_NAN );
+    std::vector< double > maximumDistances( numberOfObjects, TUDAT_NAN );
+    utilities::executeParallelTasks( settings.numberOfThreads_, [ & ]( const int threadIndex )
+    {
+        for( int i = threadIndex; i < numberOfObjects; i += settings.numberOfThreads_ )
+        {
+            double minimumDistance = std::numeric_limits< double >::infinity( );
+            double maximumDistance = 0.0;
+            for( int j = 0; j < numberOfSteps; j++ )
+            {
+                const Eigen::Vector6d initialState = catalogueStates.col( j * numberOfObjects + i );
+                const Eigen::Vector6d finalState = catalogueStates.col( ( j + 1 ) * numberOfObjects + i );
+                const double chordDeviation = computeMaximumChordDeviation(
+                            initialState, finalState, epochs.at( j + 1 ) - epochs.at( j ) );
+
+                const Eigen::Vector3d chord = finalState.segment< 3 >( 0 ) - initialState.segment< 3 >( 0 );
+                const double chordFraction = ( chord.squaredNorm( ) > 0.0 ) ?
+                            std::min( std::max( -initialState.segment< 3 >( 0 ).dot( chord ) / chord.squaredNorm( ),
+                                                0.0 ), 1.0 ) : 0.0;
+                minimumDistance = std::min(
+                            minimumDistance,
+                            ( initialState.segment< 3 >( 0 ) + chordFraction * chord ).norm( ) - chordDeviation );
+                maximumDistance = std::max(
+                            maximumDistance,
+                            std::max( initialState.segment< 3 >( 0 ).norm( ), finalState.segment< 3 >( 0 ).norm( ) ) +
+                            chordDeviation );
+            }
+            minimumDistances[ i ] = minimumDistance;
+            maximumDistances[ i ] = maximumDistance;
+        }
+    }, settings.numberOfThreads_ );
+
+    // Screen one time window per thread
+    const int numberOfWindows = std::min( numberOfSteps, settings.numberOfThreads_ );
+    std::vector< std::vector< GridConjunctionEvent > > windowEvents( numberOfWindows );
+    utilities::executeParallelTasks( numberOfWindows, [ & ]( const int windowIndex )
+    {
+        std::unordered_map< long long, std::vector< int > > spatialHash;
+        const int firstStep = static_cast< long long >( windowIndex ) * numberOfSteps / numberOfWindows;
+        const int lastStep = static_cast< long long >( windowIndex + 1 ) * numberOfSteps / numberOfWindows;
+        for( int stepIndex = firstStep; stepIndex < lastStep; stepIndex++ )
+        {
+            screenGridStepForConjunctions(
+                        catalogueStates, epochs, numberOfObjects, stepIndex, minimumDistances, maximumDistances,
+                        settings, spatialHash, windowEvents[ windowIndex ] );
+        }
+    }, settings.numberOfThreads_ );
+
+    std::vector< GridConjunctionEvent > events;
+    for( int i = 0; i < numberOfWindows; i++ )
+    {
+        events.insert( events.end( ), windowEvents[ i ].begin( ), windowEvents[ i ].end( ) );
+    }
+    std::sort( events.begin( ), events.end( ), [ ]( const GridConjunctionEvent& first,
+               const GridConjunctionEvent& second )
+    {
+        if( first.event.firstObjectIndex != second.event.firstObjectIndex )
+        {
+            return first.event.firstObjectIndex < second.event.firstObjectIndex;
+        }
+        else if( first.event.secondObjectIndex != second.event.secondObjectIndex )
+        {
+            return first.event.secondObjectIndex < second.event.secondObjectIndex;
+        }
+        return first.event.timeOfClosestApproach < second.event.timeOfClosestApproach;
+    } );
+    return events;
+}
+
+//! Function to compute the combined position covariance of a set of close approaches
+void computeConjunctionCovariances(
+        std::vector< ConjunctionEvent >& events,
+        const int numberOfObjects,
+        const std::vector< std::function< Eigen::Matrix6d( const double ) > >& covarianceFunctions )
+{
+    if( covarianceFunctions.size( ) == 0 )
+    {
+        return;
+    }
+    else if( static_cast< int >( covarianceFunctions.size( ) ) != numberOfObjects )
+    {
+        throw std::runtime_error( "Error when screening for conjunctions, number of covariance functions (" +
+                                  std::to_string( covarianceFunctions.size( ) ) + ") is not equal to number of " +
+                                  "objects (" + std::to_string( numberOfObjects ) + ")" );
+    }
+
+    for( unsigned int i = 0; i < events.size( ); i++ )
+    {
+        ConjunctionEvent& event = events[ i ];
+        event.combinedPositionCovariance =
+                covarianceFunctions.at( event.firstObjectIndex )( event.timeOfClosestApproach ).block< 3, 3 >( 0, 0 ) +
+                covarianceFunctions.at( event.secondObjectIndex )( event.timeOfClosestApproach ).block< 3, 3 >( 0, 0 );
+        event.isCovarianceAvailable = true;
+    }
+}
+
+//! Function to screen a catalogue of objects, of which the states are given on a common grid of epochs, for close approaches
+std::vector< ConjunctionEvent > screenCatalogueForConjunctions(
+        const Eigen::Matrix< double, 6, Eigen::Dynamic >& catalogueStates,
+        const std::vector< double >& epochs,
+        const int numberOfObjects,
+        const ConjunctionScreeningSettings& settings,
+        const std::vector< std::function< Eigen::Matrix6d( const double ) > >& covarianceFunctions )
+{
+    const std::vector< GridConjunctionEvent > gridEvents = screenCatalogueForGridConjunctions(
+                catalogueStates, epochs, numberOfObjects, settings );
+
+    std::vector< ConjunctionEvent > events;
+    events.reserve( gridEvents.size( ) );
+    for( unsigned int i = 0; i < gridEvents.size( ); i++ )
+    {
+        events.push_back( gridEvents[ i ].event );
+    }
+    computeConjunctionCovariances( events, numberOfObjects, covarianceFunctions );
+    return events;
+}
+
+//! Function to screen a set of ephemerides for close approaches
+std::vector< ConjunctionEvent > screenEphemeridesForConjunctions(
+        const std::vector< std::shared_ptr< Ephemeris > >& ephemerides,
+        const double startTime,
+        const double endTime,
+        const ConjunctionScreeningSettings& settings,
+        const std::vector< std::function< Eigen::Matrix6d( const double ) > >& covarianceFunctions )
+{
+    if( !( endTime > startTime ) || !( settings.timeStep_ > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when screening ephemerides for conjunctions, end time must be after start time, "
+                                  "and time step must be positive" );
+    }
+    if( settings.numberOfThreads_ < 1 )
+    {
+        throw std::runtime_error( "Error when screening ephemerides for conjunctions, number of threads must be at "
+                                  "least 1" );
+    }
+
+    // Define grid of epochs, with steps no larger than the requested step, ending at the end time
+    const int numberOfObjects = static_cast< int >( ephemerides.size( ) );
+    const int numberOfSteps = static_cast< int >( std::ceil( ( endTime - startTime ) / settings.timeStep_ ) );
+    std::vector< double > epochs( numberOfSteps + 1 );
+    for( int i = 0; i <= numberOfSteps; i++ )
+    {
+        epochs[ i ] = startTime + ( endTime - startTime ) * static_cast< double >( i ) /
+                static_cast< double >( numberOfSteps );
+    }
+
+    // Sample states of all objects (each ephemeris is only accessed by a single thread)
+    Eigen::Matrix< double, 6, Eigen::Dynamic > catalogueStates( 6, ( numberOfSteps + 1 ) * numberOfObjects );
+    utilities::executeParallelTasks( numberOfObjects, [ & ]( const int objectIndex )
+    {
+        for( int i = 0; i <= numberOfSteps; i++ )
+        {
+            catalogueStates.col( i * numberOfObjects + objectIndex ) =
+                    ephemerides.at( objectIndex )->getCartesianState( epochs[ i ] );
+        }
+    }, settings.numberOfThreads_ );
+
+    const std::vector< GridConjunctionEvent > gridEvents = screenCatalogueForGridConjunctions(
+                catalogueStates, epochs, numberOfObjects, settings );
+
+    // Refine time of closest approach using states from ephemerides
+    std::vector< ConjunctionEvent > events;
+    events.reserve( gridEvents.size( ) );
+    for( unsigned int i = 0; i < gridEvents.size( ); i++ )
+    {
+        ConjunctionEvent event = gridEvents[ i ].event;
+        const std::shared_ptr< Ephemeris > firstEphemeris = ephemerides.at( event.firstObjectIndex );
+        const std::shared_ptr< Ephemeris > secondEphemeris = ephemerides.at( event.secondObjectIndex );
+        const std::function< Eigen::Vector6d( const double ) > relativeStateFunction =
+                [ = ]( const double time )
+        {
+            return Eigen::Vector6d( secondEphemeris->getCartesianState( time ) -
+                                    firstEphemeris->getCartesianState( time ) );
+        };
+        const std::function< double( const double ) > rangeRateFunction = [ = ]( const double time )
+        {
+            const Eigen::Vector6d relativeState = relativeStateFunction( time );
+            return relativeState.segment< 3 >( 0 ).dot( relativeState.segment< 3 >( 3 ) );
+        };
+
+        // Retain result of grid interpolation if the minimum is not bracketed by the step for the ephemerides (which may
+        // occur if it lies close to the end of the step)
+        const double stepStart = epochs.at( gridEvents[ i ].stepIndex );
+        const double stepEnd = epochs.at( gridEvents[ i ].stepIndex + 1 );
+        if( rangeRateFunction( stepStart ) < 0.0 && rangeRateFunction( stepEnd ) >= 0.0 )
+        {
+            event.timeOfClosestApproach = findRootInInterval(
+                        rangeRateFunction, stepStart, stepEnd, settings.timeOfClosestApproachTolerance_ );
+            event.relativeState = relativeStateFunction( event.timeOfClosestApproach );
+            event.missDistance = event.relativeState.segment< 3 >( 0 ).norm( );
+        }
+
+        if( event.missDistance <= settings.screeningDistance_ )
+        {
+            events.push_back( event );
+        }
+    }
+
+    computeConjunctionCovariances( events, numberOfObjects, covarianceFunctions );
+    return events;
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
@@ -38,7 +38,8 @@ bool isFrameInertial( const std::string& frame )
 
 //! Constructor from named list of ephemerides.
 ReferenceFrameManager::ReferenceFrameManager(
-        const std::map< std::string, std::shared_ptr< Ephemeris > >& ephemerisMap )
+        const std::map< std::string, std::shared_ptr< Ephemeris > >& ephemerisMap ):
+    currentMemoisationIndex_( std::make_shared< int >( -1 ) ), numberOfMemoisations_( 0 )
 {
     // Set name of global base frame.
     frameIndexList_[ getBaseFrameName( ) ] = -1;
@@ -47,6 +48,38 @@ ReferenceFrameManager::ReferenceFrameManager(
     setEphemerides( ephemerisMap );
 }
 
+//! Function to retrieve the objects computing the (memoised) frame states, with double precision state and time
+template< >
+std::map< std::shared_ptr< Ephemeris >, std::shared_ptr< MemoisedFrameState< double, double > > >&
+ReferenceFrameManager::getMemoisedFrameStates< double, double >( )
+{
+    return memoisedFrameStates_;
+}
+
+//! Function to retrieve the objects computing the (memoised) frame states, with long double precision state
+template< >
+std::map< std::shared_ptr< Ephemeris >, std::shared_ptr< MemoisedFrameState< long double, double > > >&
+ReferenceFrameManager::getMemoisedFrameStates< long double, double >( )
+{
+    return memoisedFrameStatesLong_;
+}
+
+//! Function to retrieve the objects computing the (memoised) frame states, with Time precision time
+template< >
+std::map< std::shared_ptr< Ephemeris >, std::shared_ptr< MemoisedFrameState< double, Time > > >&
+ReferenceFrameManager::getMemoisedFrameStates< double, Time >( )
+{
+    return memoisedFrameStatesSplitTime_;
+}
+
+//! Function to retrieve the objects computing the (memoised) frame states, with long double state and Time precision time
+template< >
+std::map< std::shared_ptr< Ephemeris >, std::shared_ptr< MemoisedFrameState< long double, Time > > >&
+ReferenceFrameManager::getMemoisedFrameStates< long double, Time >( )
+{
+    return memoisedFrameStatesLongSplitTime_;
+}
+
 //! Function to determine frame levels and base frames of all frames.
 void ReferenceFrameManager::setEphemerides(
         const std::map< std::string, std::shared_ptr< Ephemeris > >& additionalEphemerides )
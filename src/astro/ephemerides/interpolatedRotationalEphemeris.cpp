@@ -0,0 +1,250 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+
+#include "tudat/astro/ephemerides/interpolatedRotationalEphemeris.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Constructor, tabulates the rotation of the original rotation model
+InterpolatedRotationalEphemeris::InterpolatedRotationalEphemeris(
+        const std::shared_ptr< RotationalEphemeris > originalRotationalEphemeris,
+        const double startTime,
+        const double endTime,
+        const double angularAccuracy,
+        const double initialTimeStep,
+        const double minimumTimeStep ):
+    RotationalEphemeris( originalRotationalEphemeris->getBaseFrameOrientation( ),
+                         originalRotationalEphemeris->getTargetFrameOrientation( ) ),
+    originalRotationalEphemeris_( originalRotationalEphemeris ),
+    startTime_( startTime ), endTime_( endTime ), maximumInterpolationError_( TUDAT_NAN )
+{
+    if( !( endTime_ > startTime_ ) )
+    {
+        throw std::runtime_error( "Error when creating interpolated rotation model, end time must be larger than start time" );
+    }
+
+    // Refine time step until required accuracy is met
+    double currentTimeStep = std::min( initialTimeStep, ( endTime_ - startTime_ ) / 2.0 );
+    while( true )
+    {
+        tabulateRotation( currentTimeStep );
+
+        // Check interpolation error at midpoints between tabulation points
+        maximumInterpolationError_ = 0.0;
+        Eigen::Quaterniond interpolatedRotation;
+        Eigen::Vector3d interpolatedAngularVelocity;
+        for( int i = 0; i < numberOfTabulationPoints_ - 1; i++ )
+        {
+            double currentTime = std::min( startTime_ + ( static_cast< double >( i ) + 0.5 ) * timeStep_, endTime_ );
+            interpolateRotation( currentTime, interpolatedRotation, interpolatedAngularVelocity );
+            maximumInterpolationError_ = std::max(
+                        maximumInterpolationError_, interpolatedRotation.angularDistance(
+                            originalRotationalEphemeris_->getRotationToBaseFrame( currentTime ) ) );
+        }
+
+        if( maximumInterpolationError_ <= angularAccuracy )
+        {
+            break;
+        }
+        else if( currentTimeStep / 2.0 < minimumTimeStep )
+        {
+            std::cerr << "Warning when creating interpolated rotation model, required accuracy of "
+                      << angularAccuracy << " rad not met at minimum time step of " << timeStep_
+                      << " s; maximum error is " << maximumInterpolationError_ << " rad" << std::endl;
+            break;
+        }
+        currentTimeStep /= 2.0;
+    }
+}
+
+//! Get rotation quaternion from target frame to base frame.
+Eigen::Quaterniond InterpolatedRotationalEphemeris::getRotationToBaseFrame( const double secondsSinceEpoch )
+{
+    if( !isTimeInTabulatedInterval( secondsSinceEpoch ) )
+    {
+        return originalRotationalEphemeris_->getRotationToBaseFrame( secondsSinceEpoch );
+    }
+
+    Eigen::Vector4d quaternion, quaternionDerivative;
+    interpolateQuaternion( secondsSinceEpoch, quaternion, quaternionDerivative );
+    quaternion.normalize( );
+    return Eigen::Quaterniond( quaternion( 0 ), quaternion( 1 ), quaternion( 2 ), quaternion( 3 ) );
+}
+
+//! Function to retrieve the angular velocity vector of the body, expressed in the base frame.
+Eigen::Vector3d InterpolatedRotationalEphemeris::getRotationalVelocityVectorInBaseFrame( const double secondsSinceEpoch )
+{
+    if( !isTimeInTabulatedInterval( secondsSinceEpoch ) )
+    {
+        return originalRotationalEphemeris_->getRotationalVelocityVectorInBaseFrame( secondsSinceEpoch );
+    }
+
+    Eigen::Quaterniond rotationToBaseFrame;
+    Eigen::Vector3d angularVelocityInBaseFrame;
+    interpolateRotation( secondsSinceEpoch, rotationToBaseFrame, angularVelocityInBaseFrame );
+    return angularVelocityInBaseFrame;
+}
+
+//! Function to retrieve the angular velocity vector of the body, expressed in the target (body-fixed) frame.
+Eigen::Vector3d InterpolatedRotationalEphemeris::getRotationalVelocityVectorInTargetFrame( const double secondsSinceEpoch )
+{
+    if( !isTimeInTabulatedInterval( secondsSinceEpoch ) )
+    {
+        return originalRotationalEphemeris_->getRotationalVelocityVectorInTargetFrame( secondsSinceEpoch );
+    }
+
+    Eigen::Quaterniond rotationToBaseFrame;
+    Eigen::Vector3d angularVelocityInBaseFrame;
+    interpolateRotation( secondsSinceEpoch, rotationToBaseFrame, angularVelocityInBaseFrame );
+    return rotationToBaseFrame.inverse( ) * angularVelocityInBaseFrame;
+}
+
+//! Function to calculate the derivative of the rotation matrix from base frame to target frame.
+Eigen::Matrix3d InterpolatedRotationalEphemeris::getDerivativeOfRotationToTargetFrame( const double secondsSinceEpoch )
+{
+    if( !isTimeInTabulatedInterval( secondsSinceEpoch ) )
+    {
+        return originalRotationalEphemeris_->getDerivativeOfRotationToTargetFrame( secondsSinceEpoch );
+    }
+
+    Eigen::Quaterniond rotationToBaseFrame;
+    Eigen::Vector3d angularVelocityInBaseFrame;
+    interpolateRotation( secondsSinceEpoch, rotationToBaseFrame, angularVelocityInBaseFrame );
+    return getDerivativeOfRotationMatrixToFrame(
+                rotationToBaseFrame.inverse( ).toRotationMatrix( ), angularVelocityInBaseFrame );
+}
+
+//! Function to calculate the full rotational state at given time
+void InterpolatedRotationalEphemeris::getFullRotationalQuantitiesToTargetFrame(
+        Eigen::Quaterniond& currentRotationToLocalFrame,
+        Eigen::Matrix3d& currentRotationToLocalFrameDerivative,
+        Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
+        const double secondsSinceEpoch )
+{
+    if( !isTimeInTabulatedInterval( secondsSinceEpoch ) )
+    {
+        originalRotationalEphemeris_->getFullRotationalQuantitiesToTargetFrame(
+                    currentRotationToLocalFrame, currentRotationToLocalFrameDerivative,
+                    currentAngularVelocityVectorInGlobalFrame, secondsSinceEpoch );
+        return;
+    }
+
+    Eigen::Quaterniond rotationToBaseFrame;
+    interpolateRotation( secondsSinceEpoch, rotationToBaseFrame, currentAngularVelocityVectorInGlobalFrame );
+    currentRotationToLocalFrame = rotationToBaseFrame.inverse( );
+    currentRotationToLocalFrameDerivative = getDerivativeOfRotationMatrixToFrame(
+                currentRotationToLocalFrame.toRotationMatrix( ), currentAngularVelocityVectorInGlobalFrame );
+}
+
+//! Function to tabulate the rotation with the given time step
+void InterpolatedRotationalEphemeris::tabulateRotation( const double timeStep )
+{
+    // Set equidistant grid that covers full interval (last point may be beyond end time)
+    numberOfTabulationPoints_ = static_cast< int >( std::ceil( ( endTime_ - startTime_ ) / timeStep - 1.0E-9 ) ) + 1;
+    numberOfTabulationPoints_ = std::max( numberOfTabulationPoints_, 2 );
+    timeStep_ = timeStep;
+    inverseTimeStep_ = 1.0 / timeStep_;
+
+    tabulatedValues_.resize( 8 * numberOfTabulationPoints_ );
+    Eigen::Vector4d previousQuaternion = Eigen::Vector4d::Zero( );
+    for( int i = 0; i < numberOfTabulationPoints_; i++ )
+    {
+        double currentTime = startTime_ + static_cast< double >( i ) * timeStep_;
+        Eigen::Quaterniond currentRotation = originalRotationalEphemeris_->getRotationToBaseFrame( currentTime );
+        Eigen::Vector3d angularVelocity = originalRotationalEphemeris_->getRotationalVelocityVectorInBaseFrame( currentTime );
+
+        // Select sign of quaternion such that it is continuous over the grid
+        Eigen::Vector4d quaternion( currentRotation.w( ), currentRotation.x( ), currentRotation.y( ), currentRotation.z( ) );
+        if( quaternion.dot( previousQuaternion ) < 0.0 )
+        {
+            quaternion *= -1.0;
+        }
+        previousQuaternion = quaternion;
+
+        // Compute quaternion derivative as 0.5 * ( 0, omega ) * q, with omega the angular velocity in the base frame
+        Eigen::Vector3d vectorPart = quaternion.segment< 3 >( 1 );
+        double* currentValues = tabulatedValues_.data( ) + 8 * i;
+        for( int j = 0; j < 4; j++ )
+        {
+            currentValues[ j ] = quaternion( j );
+        }
+        currentValues[ 4 ] = -0.5 * angularVelocity.dot( vectorPart );
+        Eigen::Vector3d vectorPartDerivative = 0.5 * ( quaternion( 0 ) * angularVelocity + angularVelocity.cross( vectorPart ) );
+        for( int j = 0; j < 3; j++ )
+        {
+            currentValues[ 5 + j ] = vectorPartDerivative( j );
+        }
+    }
+}
+
+//! Function to interpolate the (unnormalized) quaternion from target to base frame, and its time derivative
+void InterpolatedRotationalEphemeris::interpolateQuaternion(
+        const double timeValue, Eigen::Vector4d& quaternion, Eigen::Vector4d& quaternionDerivative ) const
+{
+    // Determine interval containing the time, and normalized time in this interval
+    double scaledTime = ( timeValue - startTime_ ) * inverseTimeStep_;
+    int lowerNode = std::max( 0, std::min( static_cast< int >( std::floor( scaledTime ) ), numberOfTabulationPoints_ - 2 ) );
+    double normalizedTime = scaledTime - static_cast< double >( lowerNode );
+
+    // Compute cubic Hermite basis functions (for derivatives scaled to unit interval) and their derivatives
+    double normalizedTime2 = normalizedTime * normalizedTime;
+    double normalizedTime3 = normalizedTime2 * normalizedTime;
+    double lowerValueWeight = 2.0 * normalizedTime3 - 3.0 * normalizedTime2 + 1.0;
+    double lowerDerivativeWeight = ( normalizedTime3 - 2.0 * normalizedTime2 + normalizedTime ) * timeStep_;
+    double upperValueWeight = -2.0 * normalizedTime3 + 3.0 * normalizedTime2;
+    double upperDerivativeWeight = ( normalizedTime3 - normalizedTime2 ) * timeStep_;
+
+    double lowerValueWeightDerivative = ( 6.0 * normalizedTime2 - 6.0 * normalizedTime ) * inverseTimeStep_;
+    double lowerDerivativeWeightDerivative = 3.0 * normalizedTime2 - 4.0 * normalizedTime + 1.0;
+    double upperValueWeightDerivative = -lowerValueWeightDerivative;
+    double upperDerivativeWeightDerivative = 3.0 * normalizedTime2 - 2.0 * normalizedTime;
+
+    const double* lowerValues = tabulatedValues_.data( ) + 8 * lowerNode;
+    const double* upperValues = lowerValues + 8;
+    for( int j = 0; j < 4; j++ )
+    {
+        quaternion( j ) = lowerValueWeight * lowerValues[ j ] + lowerDerivativeWeight * lowerValues[ 4 + j ] +
+                upperValueWeight * upperValues[ j ] + upperDerivativeWeight * upperValues[ 4 + j ];
+        quaternionDerivative( j ) =
+                lowerValueWeightDerivative * lowerValues[ j ] + lowerDerivativeWeightDerivative * lowerValues[ 4 + j ] +
+                upperValueWeightDerivative * upperValues[ j ] + upperDerivativeWeightDerivative * upperValues[ 4 + j ];
+    }
+}
+
+//! Function to compute the rotation to base frame, and angular velocity vector in base frame, from interpolation
+void InterpolatedRotationalEphemeris::interpolateRotation(
+        const double timeValue, Eigen::Quaterniond& rotationToBaseFrame, Eigen::Vector3d& angularVelocityInBaseFrame ) const
+{
+    Eigen::Vector4d quaternion, quaternionDerivative;
+    interpolateQuaternion( timeValue, quaternion, quaternionDerivative );
+
+    // Compute angular velocity as vector part of 2 * dq/dt * conj( q ) / |q|^2 (valid for unnormalized q)
+    double squaredNorm = quaternion.squaredNorm( );
+    Eigen::Vector3d vectorPart = quaternion.segment< 3 >( 1 );
+    Eigen::Vector3d vectorPartDerivative = quaternionDerivative.segment< 3 >( 1 );
+    angularVelocityInBaseFrame = 2.0 / squaredNorm * (
+                quaternion( 0 ) * vectorPartDerivative - quaternionDerivative( 0 ) * vectorPart -
+                vectorPartDerivative.cross( vectorPart ) );
+
+    quaternion /= std::sqrt( squaredNorm );
+    rotationToBaseFrame = Eigen::Quaterniond( quaternion( 0 ), quaternion( 1 ), quaternion( 2 ), quaternion( 3 ) );
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
@@ -171,5 +171,61 @@ Eigen::Vector6d KeplerEphemeris::getCartesianState(
     return currentCartesianState;
 }
 
+//! Function to get states from ephemeris at a batch of epochs.
+Eigen::Matrix< double, Eigen::Dynamic, 6 > KeplerEphemeris::getCartesianStates(
+        const std::vector< double >& secondsSinceEpoch )
+{
+    using namespace tudat::orbital_element_conversions;
+
+    const int numberOfEpochs = secondsSinceEpoch.size( );
+    Eigen::ArrayXd propagationTimes =
+            Eigen::Map< const Eigen::ArrayXd >( secondsSinceEpoch.data( ), numberOfEpochs ) - epochOfInitialState_;
+    Eigen::ArrayXd eccentricities = Eigen::ArrayXd::Constant( numberOfEpochs, eccentricity_ );
+
+    // Calculate eccentric anomalies at all epochs.
+    Eigen::ArrayXd eccentricAnomalies;
+    if( !isOrbitHyperbolic_ )
+    {
+        eccentricAnomalies = convertMeanAnomaliesToEccentricAnomalies< double >(
+                    eccentricities, initialMeanAnomaly_ + convertElapsedTimeToEllipticalMeanAnomalyChange(
+                        1.0, centralBodyGravitationalParameter_, semiMajorAxis_ ) * propagationTimes );
+    }
+    else
+    {
+        eccentricAnomalies = convertMeanAnomaliesToHyperbolicEccentricAnomalies< double >(
+                    eccentricities, initialMeanAnomaly_ + convertElapsedTimeToHyperbolicMeanAnomalyChange(
+                        1.0, centralBodyGravitationalParameter_, semiMajorAxis_ ) * propagationTimes );
+    }
+
+    // Calculate true anomalies.
+    Eigen::ArrayXd cosineOfTrueAnomalies( numberOfEpochs ), sineOfTrueAnomalies( numberOfEpochs );
+    for( int i = 0; i < numberOfEpochs; i++ )
+    {
+        double trueAnomaly = convertEccentricAnomalyToTrueAnomaly( eccentricAnomalies( i ), eccentricity_ );
+        cosineOfTrueAnomalies( i ) = std::cos( trueAnomaly );
+        sineOfTrueAnomalies( i ) = std::sin( trueAnomaly );
+    }
+
+    // Definition of position and velocity in the perifocal coordinate system.
+    Eigen::Matrix< double, Eigen::Dynamic, 2 > perifocalPositions( numberOfEpochs, 2 );
+    Eigen::Matrix< double, Eigen::Dynamic, 2 > perifocalVelocities( numberOfEpochs, 2 );
+    Eigen::ArrayXd radialDistances = semiLatusRectum_ / ( 1.0 + eccentricity_ * cosineOfTrueAnomalies );
+    perifocalPositions.col( 0 ) = ( radialDistances * cosineOfTrueAnomalies ).matrix( );
+    perifocalPositions.col( 1 ) = ( radialDistances * sineOfTrueAnomalies ).matrix( );
+
+    const double velocityScaling = std::sqrt( centralBodyGravitationalParameter_ / semiLatusRectum_ );
+    perifocalVelocities.col( 0 ) = ( -velocityScaling * sineOfTrueAnomalies ).matrix( );
+    perifocalVelocities.col( 1 ) = ( velocityScaling * ( eccentricity_ + cosineOfTrueAnomalies ) ).matrix( );
+
+    // Rotate orbital plane to correct orientation.
+    Eigen::Matrix< double, 3, 2 > rotationFromOrbitalPlane =
+            rotationFromOrbitalPlane_.toRotationMatrix( ).leftCols( 2 );
+    Eigen::Matrix< double, Eigen::Dynamic, 6 > cartesianStates( numberOfEpochs, 6 );
+    cartesianStates.leftCols( 3 ) = perifocalPositions * rotationFromOrbitalPlane.transpose( );
+    cartesianStates.rightCols( 3 ) = perifocalVelocities * rotationFromOrbitalPlane.transpose( );
+
+    return cartesianStates;
+}
+
 } // namespace ephemerides
 } // namespace tudat
@@ -0,0 +1,47 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <stdexcept>
+
+#include "tudat/astro/ephemerides/preInterpolatedEphemeris.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Constructor, fits the Chebyshev segments to the original ephemeris
+PreInterpolatedEphemeris::PreInterpolatedEphemeris(
+        const std::shared_ptr< Ephemeris > originalEphemeris,
+        const double startTime,
+        const double endTime,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const int polynomialDegree,
+        const double minimumSegmentDuration ):
+    Ephemeris( originalEphemeris->getReferenceFrameOrigin( ), originalEphemeris->getReferenceFrameOrientation( ) ),
+    originalEphemeris_( originalEphemeris ), startTime_( startTime ), endTime_( endTime )
+{
+    if( !( endTime_ > startTime_ ) )
+    {
+        throw std::runtime_error( "Error when creating pre-interpolated ephemeris, end time must be larger than start time" );
+    }
+
+    std::shared_ptr< Ephemeris > ephemerisToFit = originalEphemeris_;
+    chebyshevEphemeris_ = std::make_shared< ChebyshevCartesianEphemeris >(
+                [ = ]( const double time ){ return ephemerisToFit->getCartesianState( time ); },
+                startTime_, endTime_, positionTolerance, velocityTolerance, polynomialDegree, minimumSegmentDuration,
+                referenceFrameOrigin_, referenceFrameOrientation_ );
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
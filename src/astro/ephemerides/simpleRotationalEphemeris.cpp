@@ -61,6 +61,7 @@ void SimpleRotationalEphemeris::resetInitialPoleRightAscensionAndDeclination(
     // Reset angles in vector of Euler angles.
     initialEulerAngles_.x( ) = rightAscension;
     initialEulerAngles_.y( ) = declination;
+    registerModification( );
 }
 
 } // namespace tudat
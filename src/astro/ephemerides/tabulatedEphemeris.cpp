@@ -7,6 +7,7 @@
  *    a copy of the license with this file. If not, please or visit:
  *    http://tudat.tudelft.nl/LICENSE.
  */
+#include "tudat/astro/ephemerides/chebyshevEphemeris.h"
 #include "tudat/astro/ephemerides/tabulatedEphemeris.h"
 
 namespace tudat
@@ -222,7 +223,8 @@ bool isTabulatedEphemeris( const std::shared_ptr< Ephemeris > ephemeris )
     if( ( std::dynamic_pointer_cast< TabulatedCartesianEphemeris< double, double > >( ephemeris ) != nullptr ) ||
             ( std::dynamic_pointer_cast< TabulatedCartesianEphemeris< long double, double > >( ephemeris ) != nullptr ) ||
             ( std::dynamic_pointer_cast< TabulatedCartesianEphemeris< long double, Time > >( ephemeris ) != nullptr ) ||
-            ( std::dynamic_pointer_cast< TabulatedCartesianEphemeris< double, Time > >( ephemeris ) != nullptr ) )
+            ( std::dynamic_pointer_cast< TabulatedCartesianEphemeris< double, Time > >( ephemeris ) != nullptr ) ||
+            ( std::dynamic_pointer_cast< ChebyshevCartesianEphemeris >( ephemeris ) != nullptr ) )
     {
         objectIsTabulated = 1;
     }
@@ -261,6 +263,11 @@ std::pair< double, double > getTabulatedEphemerisSafeInterval( const std::shared
         safeInterval = std::dynamic_pointer_cast< TabulatedCartesianEphemeris< double, Time > >(
                     ephemeris )->getSafeInterpolationInterval( );
     }
+    else if( std::dynamic_pointer_cast< ChebyshevCartesianEphemeris >( ephemeris ) != nullptr )
+    {
+        safeInterval = std::dynamic_pointer_cast< ChebyshevCartesianEphemeris >(
+                    ephemeris )->getSafeInterpolationInterval( );
+    }
     return safeInterval;
 }
 
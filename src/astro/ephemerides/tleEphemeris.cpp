@@ -11,6 +11,7 @@
 
 #include "tudat/astro/ephemerides/tleEphemeris.h"
 #include "tudat/astro/basic_astro/unitConversions.h"
+#include "tudat/basics/parallelization.h"
 #include "tudat/interface/spice/spiceInterface.h"
 #include "tudat/interface/sofa/earthOrientation.h"
 #include "tudat/interface/sofa/sofaTimeConversions.h"
@@ -49,54 +50,99 @@ namespace ephemerides
         const Eigen::Vector6d cartesianStateAtEpochTEME =
                 spice_interface::getCartesianStateFromTleAtEpoch( secondsSinceEpoch, tle_ );
 
-		Eigen::Vector3d positionTEME = cartesianStateAtEpochTEME.head( 3 );
-		Eigen::Vector3d velocityTEME = cartesianStateAtEpochTEME.tail( 3 );
+		Eigen::Matrix3d rotationFromTeme = getRotationMatrixFromTemeFrame( secondsSinceEpoch, referenceFrameOrientation_ );
 
-		// First, rotate to the True Of Date (TOD) frame.
-		double equationOfEquinoxes = sofa_interface::calculateEquationOfEquinoxes( secondsSinceEpoch );
+		Eigen::Vector6d cartesianState;
+		cartesianState << rotationFromTeme * cartesianStateAtEpochTEME.head( 3 ),
+				rotationFromTeme * cartesianStateAtEpochTEME.tail( 3 );
+		return cartesianState;
+	}
 
-		// Rotate around pole (z-axis)
-		Eigen::AngleAxisd rotationObject = Eigen::AngleAxisd( equationOfEquinoxes, Eigen::Vector3d::UnitZ( ) );
-		Eigen::Vector3d positionTOD = rotationObject.toRotationMatrix( ) * positionTEME;
-		Eigen::Vector3d velocityTOD = rotationObject.toRotationMatrix( ) * velocityTEME;
-
-		// These angles (zeta, z, and theta) do not really have descriptive names. For a description of the precession geometry and these angles,
-		// see pages 226-228 and figure 3-31 in Vallado (2013).
-		double precessionAngleModToGcrfZeta;
-		double precessionAngleModToGcrfZ;
-		double precessionAngleModToGcrfTheta;
-		sofa_interface::getPrecessionAngles(precessionAngleModToGcrfZeta, precessionAngleModToGcrfZ, precessionAngleModToGcrfTheta,
-				secondsSinceEpoch );
-
-		// Now that we have our state vector in the TOD frame, we need to obtain the combined precession + nutation matrix from Sofa
-		// (according to the 1976/1980 model)
-		Eigen::Matrix3d precessionNutationMatrix = sofa_interface::getPrecessionNutationMatrix( secondsSinceEpoch );
-		// Multiply by inverted matrix to get to J2000
-		Eigen::Vector3d  positionJ2000 = precessionNutationMatrix.transpose( ) * positionTOD;
-		Eigen::Vector3d  velocityJ2000 = precessionNutationMatrix.transpose( ) * velocityTOD;
-
-		if( referenceFrameOrientation_ == "J2000" )
+	Eigen::Matrix3d getRotationMatrixFromTemeFrame( const double secondsSinceEpoch, const std::string& targetFrameOrientation )
+	{
+		if( targetFrameOrientation != "J2000" && targetFrameOrientation != "ECLIPJ2000" )
 		{
-			Eigen::Vector6d stateJ2000;
-			stateJ2000 << positionJ2000, velocityJ2000;
-			return stateJ2000;
+			throw std::runtime_error( "TLE state conversion to target frame " + targetFrameOrientation + " is currently unsupported." );
 		}
-		else if( referenceFrameOrientation_ == "ECLIPJ2000" )
+
+		// First, rotate to the True Of Date (TOD) frame, around pole (z-axis)
+		double equationOfEquinoxes = sofa_interface::calculateEquationOfEquinoxes( secondsSinceEpoch );
+		Eigen::Matrix3d rotationToTod = Eigen::AngleAxisd( equationOfEquinoxes, Eigen::Vector3d::UnitZ( ) ).toRotationMatrix( );
+
+		// Obtain the combined precession + nutation matrix from Sofa (according to the 1976/1980 model), and multiply by
+		// inverted matrix to get to J2000
+		Eigen::Matrix3d rotationToJ2000 =
+				sofa_interface::getPrecessionNutationMatrix( secondsSinceEpoch ).transpose( ) * rotationToTod;
+
+		if( targetFrameOrientation == "ECLIPJ2000" )
 		{
-			Eigen::Quaterniond itrsToEclipticQuaternion = spice_interface::computeRotationQuaternionBetweenFrames(
-					"J2000", "ECLIPJ2000", secondsSinceEpoch );
-			Eigen::Vector3d positionEclipJ2000 = itrsToEclipticQuaternion * positionJ2000;
-			Eigen::Vector3d velocityEclipJ2000 = itrsToEclipticQuaternion * velocityJ2000;
-			Eigen::Vector6d stateEclipJ2000;
-			stateEclipJ2000 << positionEclipJ2000, velocityEclipJ2000;
-			return stateEclipJ2000;
+			return spice_interface::computeRotationQuaternionBetweenFrames(
+					"J2000", "ECLIPJ2000", secondsSinceEpoch ).toRotationMatrix( ) * rotationToJ2000;
 		}
-		else
+		return rotationToJ2000;
+	}
+
+	std::vector< std::shared_ptr< Tle > > createTlesFromTwoLineElementData(
+			const std::vector< input_output::TwoLineElementData >& twoLineElementData )
+	{
+		std::vector< std::shared_ptr< Tle > > tles;
+		tles.reserve( twoLineElementData.size( ) );
+		for( unsigned int i = 0; i < twoLineElementData.size( ); i++ )
 		{
-			throw std::runtime_error( "TLE state conversion to target frame " + referenceFrameOrientation_ + " is currently unsupported." );
+			// Last two strings contain the two element lines (first one contains the name, if any)
+			const std::vector< std::string >& tleStrings = twoLineElementData.at( i ).twoLineElementStrings;
+			if( tleStrings.size( ) < 2 )
+			{
+				throw std::runtime_error( "Error when creating TLE from two-line element data, no element lines found for object " +
+										  std::to_string( i ) );
+			}
+			tles.push_back( std::make_shared< Tle >( tleStrings.at( tleStrings.size( ) - 2 ),
+													 tleStrings.at( tleStrings.size( ) - 1 ) ) );
 		}
+		return tles;
+	}
+
+	Eigen::Matrix< double, 6, Eigen::Dynamic > propagateTleCatalogue(
+			const std::vector< std::shared_ptr< Tle > >& tles,
+			const std::vector< double >& epochs,
+			const std::string& referenceFrameOrientation,
+			const int numberOfThreads )
+	{
+		const int numberOfObjects = tles.size( );
+		const int numberOfEpochs = epochs.size( );
+
+		// Compute rotation from TEME frame once per epoch, as it is identical for all objects
+		std::vector< Eigen::Matrix3d > rotationsFromTeme( numberOfEpochs );
+		utilities::executeParallelTasks(
+					numberOfEpochs, [ & ]( const int epochIndex )
+		{
+			rotationsFromTeme[ epochIndex ] = getRotationMatrixFromTemeFrame(
+						epochs.at( epochIndex ), referenceFrameOrientation );
+		}, numberOfThreads );
+
+		// Propagate each object to all epochs in the TEME frame, and store states contiguously per epoch
+		Eigen::Matrix< double, 6, Eigen::Dynamic > cartesianStates( 6, numberOfEpochs * numberOfObjects );
+		utilities::executeParallelTasks(
+					numberOfObjects, [ & ]( const int objectIndex )
+		{
+			Eigen::Matrix< double, 6, Eigen::Dynamic > objectStatesTeme =
+					spice_interface::getCartesianStatesFromTleAtEpochs( epochs, tles.at( objectIndex ) );
+			for( int epochIndex = 0; epochIndex < numberOfEpochs; epochIndex++ )
+			{
+				cartesianStates.col( epochIndex * numberOfObjects + objectIndex ) = objectStatesTeme.col( epochIndex );
+			}
+		}, numberOfThreads );
+
+		// Rotate the states of all objects at each epoch to the target frame at once
+		utilities::executeParallelTasks(
+					numberOfEpochs, [ & ]( const int epochIndex )
+		{
+			auto epochStates = cartesianStates.middleCols( epochIndex * numberOfObjects, numberOfObjects );
+			epochStates.topRows( 3 ) = rotationsFromTeme[ epochIndex ] * epochStates.topRows( 3 );
+			epochStates.bottomRows( 3 ) = rotationsFromTeme[ epochIndex ] * epochStates.bottomRows( 3 );
+		}, numberOfThreads );
 
-		return cartesianStateAtEpochTEME;
+		return cartesianStates;
 	}
 
 	Tle::Tle( const std::string& lines )
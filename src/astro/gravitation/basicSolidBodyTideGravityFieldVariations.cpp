@@ -113,16 +113,35 @@ void BasicSolidBodyTideGravityFieldVariations::setBodyGeometryParameters(
     iLongitude = mathematical_constants::COMPLEX_I * relativeDeformingBodySphericalPosition.z( );
     sineOfLatitude = std::sin( mathematical_constants::PI / 2.0 -
                                relativeDeformingBodySphericalPosition.y( ) );
+
+    // Set phase factors of all orders by recursion.
+    const std::complex< double > firstOrderPhaseFactor = std::exp( -iLongitude );
+    tidePhaseFactors_[ 0 ] = std::complex< double >( 1.0, 0.0 );
+    for( unsigned int m = 1; m < tidePhaseFactors_.size( ); m++ )
+    {
+        tidePhaseFactors_[ m ] = tidePhaseFactors_[ m - 1 ] * firstOrderPhaseFactor;
+    }
 }
 
 //! Function for calculating spherical harmonic coefficient corrections.
 std::pair< Eigen::MatrixXd, Eigen::MatrixXd > BasicSolidBodyTideGravityFieldVariations::
 calculateBasicSphericalHarmonicsCorrections(
         const double time )
+{
+    Eigen::MatrixXd cTermCorrections, sTermCorrections;
+    calculateSphericalHarmonicsCorrectionBlocks( time, cTermCorrections, sTermCorrections );
+    return std::make_pair( cTermCorrections, sTermCorrections );
+}
+
+//! Function for calculating spherical harmonic coefficient corrections into existing matrices.
+void BasicSolidBodyTideGravityFieldVariations::calculateSphericalHarmonicsCorrectionBlocks(
+        const double time,
+        Eigen::MatrixXd& cTermCorrections,
+        Eigen::MatrixXd& sTermCorrections )
 {
     // Initialize corrections to zero.
-    Eigen::MatrixXd cTermCorrections = Eigen::MatrixXd::Zero( numberOfDegrees_, numberOfOrders_ );
-    Eigen::MatrixXd sTermCorrections = Eigen::MatrixXd::Zero( numberOfDegrees_, numberOfOrders_ );
+    cTermCorrections.setZero( numberOfDegrees_, numberOfOrders_ );
+    sTermCorrections.setZero( numberOfDegrees_, numberOfOrders_ );
 
     // Iterate over all bodies causing deformation and calculate and add associated corrections
     for( unsigned int i = 0; i < deformingBodyStateFunctions_.size( ); i++ )
@@ -138,8 +157,6 @@ calculateBasicSphericalHarmonicsCorrections(
             correctionFunctions[ j ]( cTermCorrections, sTermCorrections );
         }
     }
-
-    return std::make_pair( cTermCorrections, sTermCorrections );
 }
 
 //! Calculates basic solid body gravity field corrections due to single body.
@@ -155,21 +172,20 @@ void BasicSolidBodyTideGravityFieldVariations::addBasicSolidBodyTideCorrections(
     //    // Iterate over all love
     std::complex< double > stokesCoefficientCorrection( 0.0, 0.0 );
 
-    for( auto loveNumberIt : loveNumbers_ )
+    for( const auto& loveNumberIt : loveNumbers_ )
     {
         unsigned int n = static_cast< unsigned int >( loveNumberIt.first );
         radiusRatioPower = basic_mathematics::raiseToIntegerPower( radiusRatio, n + 1 );
+        const double degreeFactor = massRatio * radiusRatioPower / ( 2.0 * static_cast< double >( n ) + 1.0 );
 
         for( unsigned int m = 0; ( m <= n && m < loveNumberIt.second.size( ) ); m++ )
         {
             updateTidalAmplitudeAndArgument( n, m );
 
-            // Calculate and add coefficients.
-            stokesCoefficientCorrection =
-                    calculateSolidBodyTideSingleCoefficientSetCorrectionFromAmplitude(
-                        loveNumbers_[ n ][ m ], massRatio, radiusRatioPower, tideAmplitude,
-                    tideArgument, n, m );
-
+            // Calculate and add coefficients (equal to calculateSolidBodyTideSingleCoefficientSetCorrectionFromAmplitude,
+            // with exp( -tideArgument ) taken from the phase factors of the current body)
+            stokesCoefficientCorrection = loveNumberIt.second[ m ] * degreeFactor * tideAmplitude *
+                    geodesyNormalizationFactors_( n, m ) * tidePhaseFactors_[ m ];
 
             currentCosineCorrections_( n - 2, m ) += stokesCoefficientCorrection.real( );
             if( m != 0 )
@@ -39,20 +39,18 @@ void PairInterpolationInterface::getCosineSinePair(
 void GravityFieldVariations::addSphericalHarmonicsCorrections(
         const double time, Eigen::MatrixXd& sineCoefficients, Eigen::MatrixXd& cosineCoefficients )
 {
-    // Calculate corrections.
-    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > correctionPair =
-            calculateSphericalHarmonicsCorrections( time );
+    // Calculate corrections into preallocated blocks.
+    calculateSphericalHarmonicsCorrectionBlocks( time, cosineCorrectionBlock_, sineCorrectionBlock_ );
 
     // Add corrections to existing values
     sineCoefficients.block( minimumDegree_, minimumOrder_, numberOfDegrees_, numberOfOrders_ )
-            += correctionPair.second;
+            += sineCorrectionBlock_;
     lastSineCorrection_.block( minimumDegree_, minimumOrder_, numberOfDegrees_, numberOfOrders_ )
-            = correctionPair.second;
-
+            = sineCorrectionBlock_;
     cosineCoefficients.block( minimumDegree_, minimumOrder_, numberOfDegrees_, numberOfOrders_ )
-            += correctionPair.first;
+            += cosineCorrectionBlock_;
     lastCosineCorrection_.block( minimumDegree_, minimumOrder_, numberOfDegrees_, numberOfOrders_ )
-            = correctionPair.first;
+            = cosineCorrectionBlock_;
 }
 
 //! Function to retrieve a variation object of given type (and name if necessary).
@@ -268,6 +266,21 @@ GravityFieldVariationsSet::getVariationFunctions( )
     return variationFunctions;
 }
 
+//! Function to determine whether the variation functions depend only on time
+bool GravityFieldVariationsSet::areVariationsTimeDependentOnly( )
+{
+    for( unsigned int i = 0; i < variationObjects_.size( ); i++ )
+    {
+        // Interpolated variations are precomputed, and are a function of time only
+        if( ( createInterpolator_.count( i ) == 0 ) &&
+                ( variationType_.at( i ) != periodic_variation ) && ( variationType_.at( i ) != tabulated_variation ) )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 //! Function to retrieve the tidal gravity field variation with the specified bodies causing deformation
 std::shared_ptr< GravityFieldVariations > GravityFieldVariationsSet::getDirectTidalGravityFieldVariation(
         const std::vector< std::string >& namesOfBodiesCausingDeformation )
@@ -0,0 +1,114 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include "tudat/astro/gravitation/hybridPolyhedronGravityField.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+HybridPolyhedronGravityField::HybridPolyhedronGravityField(
+        const double gravitationalParameter,
+        const Eigen::MatrixXd& verticesCoordinates,
+        const Eigen::MatrixXi& verticesDefiningEachFacet,
+        const int maximumDegree,
+        const double innerSwitchDistance,
+        const double outerSwitchDistance,
+        const std::string& fixedReferenceFrame,
+        const std::function< void( ) > updateInertiaTensor ):
+    PolyhedronGravityField( gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet, fixedReferenceFrame,
+                            updateInertiaTensor ),
+    innerSwitchDistance_( innerSwitchDistance ),
+    outerSwitchDistance_( outerSwitchDistance )
+{
+    const double brillouinSphereRadius = basic_astrodynamics::computePolyhedronBrillouinSphereRadius(
+                verticesCoordinates );
+    if( !( innerSwitchDistance_ > brillouinSphereRadius ) )
+    {
+        throw std::runtime_error(
+                    "Error when creating hybrid polyhedron gravity field: inner switch distance (" +
+                    std::to_string( innerSwitchDistance_ ) + ") must be larger than radius of Brillouin sphere (" +
+                    std::to_string( brillouinSphereRadius ) + "), inside which spherical harmonic expansion diverges." );
+    }
+    if( outerSwitchDistance_ < innerSwitchDistance_ )
+    {
+        throw std::runtime_error(
+                    "Error when creating hybrid polyhedron gravity field: outer switch distance (" +
+                    std::to_string( outerSwitchDistance_ ) + ") is smaller than inner switch distance (" +
+                    std::to_string( innerSwitchDistance_ ) + ")." );
+    }
+
+    // Compute spherical harmonic expansion of polyhedron
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    basic_astrodynamics::computePolyhedronSphericalHarmonicCoefficients(
+                verticesCoordinates, verticesDefiningEachFacet, maximumDegree, brillouinSphereRadius,
+                cosineCoefficients, sineCoefficients );
+
+    farFieldGravityField_ = std::make_shared< SphericalHarmonicsGravityField >(
+                gravitationalParameter, brillouinSphereRadius, cosineCoefficients, sineCoefficients,
+                fixedReferenceFrame );
+}
+
+double HybridPolyhedronGravityField::getGravitationalPotential( const Eigen::Vector3d& bodyFixedPosition )
+{
+    double weight, weightDerivative;
+    computeHybridGravityFieldBlendingWeight(
+                bodyFixedPosition.norm( ), innerSwitchDistance_, outerSwitchDistance_, weight, weightDerivative );
+
+    double potential = 0.0;
+    if( weight > 0.0 )
+    {
+        potential += weight * farFieldGravityField_->getGravitationalPotential( bodyFixedPosition );
+    }
+    if( weight < 1.0 )
+    {
+        potential += ( 1.0 - weight ) * PolyhedronGravityField::getGravitationalPotential( bodyFixedPosition );
+    }
+    return potential;
+}
+
+Eigen::Vector3d HybridPolyhedronGravityField::getGradientOfPotential( const Eigen::Vector3d& bodyFixedPosition )
+{
+    double weight, weightDerivative;
+    computeHybridGravityFieldBlendingWeight(
+                bodyFixedPosition.norm( ), innerSwitchDistance_, outerSwitchDistance_, weight, weightDerivative );
+
+    Eigen::Vector3d gradient = Eigen::Vector3d::Zero( );
+    if( weight > 0.0 )
+    {
+        gradient += weight * farFieldGravityField_->getGradientOfPotential( bodyFixedPosition );
+    }
+    if( weight < 1.0 )
+    {
+        gradient += ( 1.0 - weight ) * PolyhedronGravityField::getGradientOfPotential( bodyFixedPosition );
+    }
+    return gradient;
+}
+
+double HybridPolyhedronGravityField::getLaplacianOfPotential( const Eigen::Vector3d& bodyFixedPosition )
+{
+    double weight, weightDerivative;
+    computeHybridGravityFieldBlendingWeight(
+                bodyFixedPosition.norm( ), innerSwitchDistance_, outerSwitchDistance_, weight, weightDerivative );
+
+    double laplacian = 0.0;
+    if( weight < 1.0 )
+    {
+        laplacian = ( 1.0 - weight ) * PolyhedronGravityField::getLaplacianOfPotential( bodyFixedPosition );
+    }
+    return laplacian;
+}
+
+} // namespace gravitation
+
+} // namespace tudat
@@ -0,0 +1,199 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include "tudat/astro/gravitation/mutualPointMassGravityKernel.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Constructor
+MutualPointMassGravityKernel::MutualPointMassGravityKernel(
+        const std::vector< std::function< void( Eigen::Vector3d& ) > >& positionFunctions,
+        const std::vector< std::function< double( ) > >& gravitationalParameterFunctions,
+        const Eigen::Matrix< bool, Eigen::Dynamic, Eigen::Dynamic >& interactionMask ):
+    positionFunctions_( positionFunctions ),
+    gravitationalParameterFunctions_( gravitationalParameterFunctions ),
+    numberOfBodies_( positionFunctions.size( ) ),
+    currentTime_( TUDAT_NAN )
+{
+    if( static_cast< int >( gravitationalParameterFunctions_.size( ) ) != numberOfBodies_ ||
+            interactionMask.rows( ) != numberOfBodies_ || interactionMask.cols( ) != numberOfBodies_ )
+    {
+        throw std::runtime_error( "Error when creating mutual point-mass gravity kernel, input sizes are inconsistent" );
+    }
+
+    interactionMask_ = interactionMask.cast< double >( ).array( );
+    transposedInteractionMask_ = interactionMask_.transpose( );
+    numberOfInteractions_ = interactionMask.count( );
+    for( int i = 0; i < numberOfBodies_; i++ )
+    {
+        if( interactionMask( i, i ) )
+        {
+            throw std::runtime_error( "Error when creating mutual point-mass gravity kernel, body " + std::to_string( i ) +
+                                      " may not exert an acceleration on itself" );
+        }
+
+        for( int j = 0; j < numberOfBodies_; j++ )
+        {
+            if( interactionMask( i, j ) && gravitationalParameterFunctions_.at( j ) == nullptr )
+            {
+                throw std::runtime_error( "Error when creating mutual point-mass gravity kernel, no gravitational parameter "
+                                          "provided for body " + std::to_string( j ) );
+            }
+        }
+    }
+
+    positionsX_ = positionsY_ = positionsZ_ = Eigen::ArrayXd::Zero( numberOfBodies_ );
+    gravitationalParameters_ = Eigen::ArrayXd::Zero( numberOfBodies_ );
+    accelerationsX_ = accelerationsY_ = accelerationsZ_ = Eigen::ArrayXd::Zero( numberOfBodies_ );
+    scratchArrays_.push_back( Eigen::ArrayXXd::Zero( numberOfBodies_, 4 ) );
+}
+
+//! Function to update the accelerations of all bodies to the current time
+void MutualPointMassGravityKernel::update(
+        const double currentTime, const std::shared_ptr< utilities::ParallelTaskPool > parallelTaskPool )
+{
+    if( !( currentTime_ == currentTime ) )
+    {
+        // Retrieve current positions and gravitational parameters of all bodies
+        for( int i = 0; i < numberOfBodies_; i++ )
+        {
+            positionFunctions_[ i ]( currentPosition_ );
+            positionsX_( i ) = currentPosition_.x( );
+            positionsY_( i ) = currentPosition_.y( );
+            positionsZ_( i ) = currentPosition_.z( );
+            gravitationalParameters_( i ) = ( gravitationalParameterFunctions_[ i ] == nullptr ) ?
+                        0.0 : gravitationalParameterFunctions_[ i ]( );
+        }
+
+        if( parallelTaskPool == nullptr || parallelTaskPool->getNumberOfThreads( ) == 1 )
+        {
+            computeSymmetricAccelerations( );
+        }
+        else
+        {
+            // Distribute bodies over tasks, each with its own scratch arrays
+            const int numberOfTasks = std::min( numberOfBodies_, 4 * parallelTaskPool->getNumberOfThreads( ) );
+            if( static_cast< int >( scratchArrays_.size( ) ) != numberOfTasks )
+            {
+                scratchArrays_.resize( numberOfTasks, Eigen::ArrayXXd::Zero( numberOfBodies_, 4 ) );
+            }
+
+            parallelTaskPool->executeTasks(
+                        numberOfTasks, [ this, numberOfTasks ]( const int taskIndex )
+            {
+                const int firstBodyIndex = ( taskIndex * numberOfBodies_ ) / numberOfTasks;
+                const int lastBodyIndex = ( ( taskIndex + 1 ) * numberOfBodies_ ) / numberOfTasks;
+                computeAccelerationsOfBodies( firstBodyIndex, lastBodyIndex - firstBodyIndex, scratchArrays_[ taskIndex ] );
+            } );
+        }
+
+        currentTime_ = currentTime;
+    }
+}
+
+//! Function to compute the accelerations of all bodies, evaluating each pair once
+void MutualPointMassGravityKernel::computeSymmetricAccelerations( )
+{
+    accelerationsX_.setZero( );
+    accelerationsY_.setZero( );
+    accelerationsZ_.setZero( );
+
+    Eigen::ArrayXXd& scratchArrays = scratchArrays_[ 0 ];
+    for( int i = 0; i < numberOfBodies_ - 1; i++ )
+    {
+        // Compute relative positions and inverse cube of distances to all bodies with higher index
+        const int numberOfPairs = numberOfBodies_ - i - 1;
+        auto relativePositionX = scratchArrays.col( 0 ).head( numberOfPairs );
+        auto relativePositionY = scratchArrays.col( 1 ).head( numberOfPairs );
+        auto relativePositionZ = scratchArrays.col( 2 ).head( numberOfPairs );
+        auto inverseCubeOfDistance = scratchArrays.col( 3 ).head( numberOfPairs );
+
+        relativePositionX = positionsX_.tail( numberOfPairs ) - positionsX_( i );
+        relativePositionY = positionsY_.tail( numberOfPairs ) - positionsY_( i );
+        relativePositionZ = positionsZ_.tail( numberOfPairs ) - positionsZ_( i );
+        inverseCubeOfDistance = relativePositionX.square( ) + relativePositionY.square( ) + relativePositionZ.square( );
+        inverseCubeOfDistance = ( inverseCubeOfDistance * inverseCubeOfDistance.sqrt( ) ).inverse( );
+
+        // Add accelerations exerted on body i
+        const double gravitationalParameterOfBody = gravitationalParameters_( i );
+        accelerationsX_( i ) += ( interactionMask_.row( i ).tail( numberOfPairs ).transpose( ) *
+                                  gravitationalParameters_.tail( numberOfPairs ) * inverseCubeOfDistance *
+                                  relativePositionX ).sum( );
+        accelerationsY_( i ) += ( interactionMask_.row( i ).tail( numberOfPairs ).transpose( ) *
+                                  gravitationalParameters_.tail( numberOfPairs ) * inverseCubeOfDistance *
+                                  relativePositionY ).sum( );
+        accelerationsZ_( i ) += ( interactionMask_.row( i ).tail( numberOfPairs ).transpose( ) *
+                                  gravitationalParameters_.tail( numberOfPairs ) * inverseCubeOfDistance *
+                                  relativePositionZ ).sum( );
+
+        // Add accelerations exerted by body i (reusing the inverse cube of the distances)
+        inverseCubeOfDistance *= gravitationalParameterOfBody *
+                transposedInteractionMask_.row( i ).tail( numberOfPairs ).transpose( );
+        accelerationsX_.tail( numberOfPairs ) -= inverseCubeOfDistance * relativePositionX;
+        accelerationsY_.tail( numberOfPairs ) -= inverseCubeOfDistance * relativePositionY;
+        accelerationsZ_.tail( numberOfPairs ) -= inverseCubeOfDistance * relativePositionZ;
+    }
+}
+
+//! Function to compute the accelerations of a range of bodies, evaluating all pairs each body is part of
+void MutualPointMassGravityKernel::computeAccelerationsOfBodies(
+        const int firstBodyIndex, const int numberOfBodiesInRange, Eigen::ArrayXXd& scratchArrays )
+{
+    for( int i = firstBodyIndex; i < firstBodyIndex + numberOfBodiesInRange; i++ )
+    {
+        accelerationsX_( i ) = 0.0;
+        accelerationsY_( i ) = 0.0;
+        accelerationsZ_( i ) = 0.0;
+
+        // Add contributions of bodies with lower and higher index (excluding the body itself)
+        addAccelerationContributions( i, 0, i, scratchArrays );
+        addAccelerationContributions( i, i + 1, numberOfBodies_ - i - 1, scratchArrays );
+    }
+}
+
+//! Function to add the contributions of a contiguous range of bodies to the acceleration of a single body
+void MutualPointMassGravityKernel::addAccelerationContributions(
+        const int bodyIndex, const int firstExertingBodyIndex, const int numberOfExertingBodies,
+        Eigen::ArrayXXd& scratchArrays )
+{
+    if( numberOfExertingBodies == 0 )
+    {
+        return;
+    }
+
+    auto relativePositionX = scratchArrays.col( 0 ).head( numberOfExertingBodies );
+    auto relativePositionY = scratchArrays.col( 1 ).head( numberOfExertingBodies );
+    auto relativePositionZ = scratchArrays.col( 2 ).head( numberOfExertingBodies );
+    auto accelerationFactor = scratchArrays.col( 3 ).head( numberOfExertingBodies );
+
+    relativePositionX = positionsX_.segment( firstExertingBodyIndex, numberOfExertingBodies ) - positionsX_( bodyIndex );
+    relativePositionY = positionsY_.segment( firstExertingBodyIndex, numberOfExertingBodies ) - positionsY_( bodyIndex );
+    relativePositionZ = positionsZ_.segment( firstExertingBodyIndex, numberOfExertingBodies ) - positionsZ_( bodyIndex );
+    accelerationFactor = relativePositionX.square( ) + relativePositionY.square( ) + relativePositionZ.square( );
+    accelerationFactor = interactionMask_.row( bodyIndex ).segment( firstExertingBodyIndex, numberOfExertingBodies ).transpose( ) *
+            gravitationalParameters_.segment( firstExertingBodyIndex, numberOfExertingBodies ) *
+            ( accelerationFactor * accelerationFactor.sqrt( ) ).inverse( );
+
+    accelerationsX_( bodyIndex ) += ( accelerationFactor * relativePositionX ).sum( );
+    accelerationsY_( bodyIndex ) += ( accelerationFactor * relativePositionY ).sum( );
+    accelerationsZ_( bodyIndex ) += ( accelerationFactor * relativePositionZ ).sum( );
+}
+
+} // namespace gravitation
+
+} // namespace tudat
@@ -24,6 +24,34 @@ Eigen::MatrixXd setDegreeAndOrderCoefficientToZero(
     return newCoefficients;
 }
 
+//! Function to set the number of threads over which the computation of the acceleration is distributed.
+void MutualSphericalHarmonicsGravitationalAccelerationModel::setNumberOfThreads( const int numberOfThreads )
+{
+    if( numberOfThreads < 1 )
+    {
+        throw std::runtime_error( "Error when setting number of threads of mutual spherical harmonic acceleration: number (" +
+                                  std::to_string( numberOfThreads ) + ") must be at least 1." );
+    }
+    else if( numberOfThreads > 1 && sphericalHarmonicsCachesAreShared_ )
+    {
+        throw std::runtime_error( "Error when setting number of threads of mutual spherical harmonic acceleration: "
+                                  "the expansions of both bodies use the same cache." );
+    }
+
+    numberOfThreads_ = numberOfThreads;
+    if( numberOfThreads_ > 1 )
+    {
+        if( threadPool_ == nullptr )
+        {
+            threadPool_ = std::make_shared< utilities::ParallelTaskPool >( 2 );
+        }
+    }
+    else
+    {
+        threadPool_ = nullptr;
+    }
+}
+
 
 
 }
@@ -53,18 +53,25 @@ PeriodicGravityFieldVariations::PeriodicGravityFieldVariations(
 std::pair< Eigen::MatrixXd, Eigen::MatrixXd > PeriodicGravityFieldVariations::calculateSphericalHarmonicsCorrections(
         const double time )
 {
-    Eigen::MatrixXd cosineCorrections = Eigen::MatrixXd::Zero( numberOfDegrees_, numberOfOrders_ );
-    Eigen::MatrixXd sineCorrections = Eigen::MatrixXd::Zero( numberOfDegrees_, numberOfOrders_ );
+    Eigen::MatrixXd cosineCorrections, sineCorrections;
+    calculateSphericalHarmonicsCorrectionBlocks( time, cosineCorrections, sineCorrections );
+    return std::make_pair( cosineCorrections, sineCorrections );
+}
+
+void PeriodicGravityFieldVariations::calculateSphericalHarmonicsCorrectionBlocks(
+        const double time,
+        Eigen::MatrixXd& cosineCorrections,
+        Eigen::MatrixXd& sineCorrections )
+{
+    cosineCorrections.setZero( numberOfDegrees_, numberOfOrders_ );
+    sineCorrections.setZero( numberOfDegrees_, numberOfOrders_ );
 
     for( unsigned int i = 0; i < frequencies_.size( ); i++ )
     {
-        cosineCorrections += cosineAmplitudes_.at( i ) * std::cos(
-                    frequencies_.at( i ) * ( time - referenceEpoch_ ) + phases_.at( i ) );
-        sineCorrections += sineAmplitudes_.at( i ) * std::sin(
-                    frequencies_.at( i ) * ( time - referenceEpoch_ ) + phases_.at( i ) );
+        const double currentArgument = frequencies_.at( i ) * ( time - referenceEpoch_ ) + phases_.at( i );
+        cosineCorrections += cosineAmplitudes_.at( i ) * std::cos( currentArgument );
+        sineCorrections += sineAmplitudes_.at( i ) * std::sin( currentArgument );
     }
-
-    return std::make_pair( cosineCorrections, sineCorrections );
 }
 
 } // namespace gravitation
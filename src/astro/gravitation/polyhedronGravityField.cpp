@@ -9,6 +9,8 @@
  *
  */
 
+#include <algorithm>
+
 #include "tudat/astro/gravitation/polyhedronGravityField.h"
 
 namespace tudat
@@ -17,171 +19,364 @@ namespace tudat
 namespace gravitation
 {
 
-void PolyhedronGravityCache::update (const Eigen::Vector3d& currentBodyFixedPosition)
+//! Number of facets or edges that are processed in a single block by the polyhedron gravity cache.
+static const int POLYHEDRON_BLOCK_SIZE = 4096;
+
+//! Function to store the (symmetric) dyads as their unique entries, with one row per dyad.
+static void packPolyhedronDyads( const std::vector< Eigen::MatrixXd >& dyads,
+                                 Eigen::Matrix< double, Eigen::Dynamic, 6 >& dyadEntries )
 {
-    if ( currentBodyFixedPosition != currentBodyFixedPosition_ )
+    dyadEntries.resize( dyads.size( ), 6 );
+    for( unsigned int i = 0; i < dyads.size( ); ++i )
     {
-        currentBodyFixedPosition_ = currentBodyFixedPosition;
+        if( dyads.at( i ).rows( ) != 3 || dyads.at( i ).cols( ) != 3 )
+        {
+            throw std::runtime_error( "Error when creating polyhedron gravity cache: dyad " + std::to_string( i ) +
+                                      " is not a 3x3 matrix." );
+        }
 
-        // Compute coordinates of vertices with respect to field point
-        basic_mathematics::calculatePolyhedronVerticesCoordinatesRelativeToFieldPoint(
-                currentVerticesCoordinatesRelativeToFieldPoint_, currentBodyFixedPosition_, verticesCoordinates_);
+        // Dyads are symmetric (Werner and Scheeres, 1997); the mean of the off-diagonal entries removes round-off
+        const Eigen::MatrixXd& dyad = dyads.at( i );
+        dyadEntries( i, 0 ) = dyad( 0, 0 );
+        dyadEntries( i, 1 ) = 0.5 * ( dyad( 0, 1 ) + dyad( 1, 0 ) );
+        dyadEntries( i, 2 ) = 0.5 * ( dyad( 0, 2 ) + dyad( 2, 0 ) );
+        dyadEntries( i, 3 ) = dyad( 1, 1 );
+        dyadEntries( i, 4 ) = 0.5 * ( dyad( 1, 2 ) + dyad( 2, 1 ) );
+        dyadEntries( i, 5 ) = dyad( 2, 2 );
+    }
+}
 
-        // Compute per-facet factor
-        basic_mathematics::calculatePolyhedronPerFacetFactor(
-                currentPerFacetFactor_, currentVerticesCoordinatesRelativeToFieldPoint_, verticesDefiningEachFacet_);
+PolyhedronGravityCache::PolyhedronGravityCache(
+        const Eigen::MatrixXd& verticesCoordinates,
+        const Eigen::MatrixXi& verticesDefiningEachFacet,
+        const Eigen::MatrixXi& verticesDefiningEachEdge,
+        const std::vector< Eigen::MatrixXd >& facetDyads,
+        const std::vector< Eigen::MatrixXd >& edgeDyads,
+        const int numberOfThreads ):
+    verticesCoordinates_( verticesCoordinates ),
+    verticesDefiningEachFacet_( verticesDefiningEachFacet ),
+    verticesDefiningEachEdge_( verticesDefiningEachEdge ),
+    computeSums_( facetDyads.size( ) > 0 ),
+    numberOfThreads_( 1 )
+{
+    currentBodyFixedPosition_ = (Eigen::Vector3d() << TUDAT_NAN, TUDAT_NAN, TUDAT_NAN).finished();
 
-        // Compute per-edge factor
-        basic_mathematics::calculatePolyhedronPerEdgeFactor(
-                currentPerEdgeFactor_, currentVerticesCoordinatesRelativeToFieldPoint_, verticesDefiningEachEdge_);
+    if( computeSums_ )
+    {
+        if( static_cast< int >( facetDyads.size( ) ) != verticesDefiningEachFacet_.rows( ) ||
+                static_cast< int >( edgeDyads.size( ) ) != verticesDefiningEachEdge_.rows( ) )
+        {
+            throw std::runtime_error(
+                        "Error when creating polyhedron gravity cache: number of facet dyads (" +
+                        std::to_string( facetDyads.size( ) ) + ") or edge dyads (" + std::to_string( edgeDyads.size( ) ) +
+                        ") is not consistent with number of facets (" +
+                        std::to_string( verticesDefiningEachFacet_.rows( ) ) + ") or edges (" +
+                        std::to_string( verticesDefiningEachEdge_.rows( ) ) + ")." );
+        }
+        packPolyhedronDyads( facetDyads, facetDyadEntries_ );
+        packPolyhedronDyads( edgeDyads, edgeDyadEntries_ );
     }
+
+    numberOfFacetBlocks_ = ( verticesDefiningEachFacet_.rows( ) + POLYHEDRON_BLOCK_SIZE - 1 ) / POLYHEDRON_BLOCK_SIZE;
+    numberOfEdgeBlocks_ = ( verticesDefiningEachEdge_.rows( ) + POLYHEDRON_BLOCK_SIZE - 1 ) / POLYHEDRON_BLOCK_SIZE;
+
+    currentPerFacetFactor_.resize( verticesDefiningEachFacet_.rows( ) );
+    currentPerEdgeFactor_.resize( verticesDefiningEachEdge_.rows( ) );
+    currentFacetBlockSums_.resize( numberOfFacetBlocks_ );
+    currentEdgeBlockSums_.resize( numberOfEdgeBlocks_ );
+    currentBlockHessianSums_.resize( numberOfFacetBlocks_ + numberOfEdgeBlocks_ );
+
+    currentPerFacetGradientSum_.setConstant( TUDAT_NAN );
+    currentPerEdgeGradientSum_.setConstant( TUDAT_NAN );
+    currentPerFacetPotentialSum_ = TUDAT_NAN;
+    currentPerEdgePotentialSum_ = TUDAT_NAN;
+    currentPerFacetFactorSum_ = TUDAT_NAN;
+
+    setNumberOfThreads( numberOfThreads );
 }
 
-void PolyhedronGravityField::computeVerticesAndFacetsDefiningEachEdge ( )
+void PolyhedronGravityCache::setNumberOfThreads( const int numberOfThreads )
 {
-    const unsigned int numberOfVertices = verticesCoordinates_.rows();
-    const unsigned int numberOfFacets = verticesDefiningEachFacet_.rows();
-    const unsigned int numberOfEdges = 3 * ( numberOfVertices - 2 );
-
-    verticesDefiningEachEdge_ = Eigen::MatrixXi::Constant( numberOfEdges, 2, -1 );
-    facetsDefiningEachEdge_ = Eigen::MatrixXi::Constant( numberOfEdges, 2, -1 );
+    if( numberOfThreads < 1 )
+    {
+        throw std::runtime_error( "Error when setting number of threads of polyhedron gravity cache: number (" +
+                                  std::to_string( numberOfThreads ) + ") must be at least 1." );
+    }
 
-    unsigned int numberOfInsertedEdges = 0;
-    for ( unsigned int facet = 0; facet < numberOfFacets; ++facet )
+    if( numberOfThreads != numberOfThreads_ || ( numberOfThreads > 1 && threadPool_ == nullptr ) )
     {
-        // Extract edges from face
-        std::vector< std::vector< int > > edgesToInsert;
-        const int vertex0 = verticesDefiningEachFacet_(facet,0);
-        const int vertex1 = verticesDefiningEachFacet_(facet,1);
-        const int vertex2 = verticesDefiningEachFacet_(facet,2);
-        edgesToInsert.push_back( { vertex0, vertex1 } );
-        edgesToInsert.push_back( { vertex1, vertex2 } );
-        edgesToInsert.push_back( { vertex2, vertex0 } );
-
-        // Check if all edges of the facet have been included in verticesDefiningEachEdge. If so, remove the edge from
-        // the edgesToInsert vector and add the facet to facetsDefiningEachEdge
-        for ( unsigned int edge = 0; edge < numberOfInsertedEdges && !edgesToInsert.empty(); ++edge )
+        numberOfThreads_ = numberOfThreads;
+        if( numberOfThreads_ > 1 )
         {
-            // Loop over edges of current facet still to be inserted
-            for ( unsigned int i = 0; i < edgesToInsert.size(); ++i)
-            {
-                if ( ( edgesToInsert.at(i).at(0) == verticesDefiningEachEdge_(edge, 0) && edgesToInsert.at(i).at(1) == verticesDefiningEachEdge_(edge, 1) ) ||
-                        ( edgesToInsert.at(i).at(0) == verticesDefiningEachEdge_(edge, 1) && edgesToInsert.at(i).at(1) == verticesDefiningEachEdge_(edge, 0) ) )
-                {
-                    edgesToInsert.erase(edgesToInsert.begin() + i);
-                    facetsDefiningEachEdge_(edge, 1) = facet;
-                }
-            }
+            threadPool_ = std::make_shared< utilities::ParallelTaskPool >( numberOfThreads_ );
         }
-
-        // Check if any of the facet's edges still needs to be added to verticesDefiningEachEdge, and add it/them if so
-        for ( unsigned int i = 0; i < edgesToInsert.size(); ++i)
+        else
         {
-            verticesDefiningEachEdge_(numberOfInsertedEdges,0) = edgesToInsert.at(i).at(0);
-            verticesDefiningEachEdge_(numberOfInsertedEdges,1) = edgesToInsert.at(i).at(1);
-            facetsDefiningEachEdge_(numberOfInsertedEdges, 0) = facet;
-            ++numberOfInsertedEdges;
+            threadPool_ = nullptr;
         }
     }
+}
 
-    // Sanity checks
-    if ( numberOfInsertedEdges != numberOfEdges )
+void PolyhedronGravityCache::executeTasks( const int numberOfTasks,
+                                           const std::function< void( const int ) >& taskFunction )
+{
+    if( threadPool_ == nullptr || numberOfTasks == 1 )
     {
-        throw std::runtime_error( "Extracted number of polyhedron edges not correct." );
+        for( int i = 0; i < numberOfTasks; i++ )
+        {
+            taskFunction( i );
+        }
     }
-    for ( unsigned int i = 0; i < numberOfEdges; ++i )
+    else
     {
-        for (unsigned int j : {0,1} )
+        threadPool_->executeTasks( numberOfTasks, taskFunction );
+    }
+}
+
+void PolyhedronGravityCache::updateFacetBlock( const int block )
+{
+    const int firstFacet = block * POLYHEDRON_BLOCK_SIZE;
+    const int endFacet = std::min( firstFacet + POLYHEDRON_BLOCK_SIZE,
+                                   static_cast< int >( verticesDefiningEachFacet_.rows( ) ) );
+
+    const double* x = currentVerticesCoordinatesRelativeToFieldPoint_.col( 0 ).data( );
+    const double* y = currentVerticesCoordinatesRelativeToFieldPoint_.col( 1 ).data( );
+    const double* z = currentVerticesCoordinatesRelativeToFieldPoint_.col( 2 ).data( );
+    const int* vertexI = verticesDefiningEachFacet_.col( 0 ).data( );
+    const int* vertexJ = verticesDefiningEachFacet_.col( 1 ).data( );
+    const int* vertexK = verticesDefiningEachFacet_.col( 2 ).data( );
+    double* perFacetFactor = currentPerFacetFactor_.data( );
+
+    double gradientSumX = 0.0, gradientSumY = 0.0, gradientSumZ = 0.0, potentialSum = 0.0, factorSum = 0.0;
+    for( int facet = firstFacet; facet < endFacet; ++facet )
+    {
+        // Retrieve position vectors of facet's vertices relative to field point
+        const int i = vertexI[ facet ], j = vertexJ[ facet ], k = vertexK[ facet ];
+        const double xI = x[ i ], yI = y[ i ], zI = z[ i ];
+        const double xJ = x[ j ], yJ = y[ j ], zJ = z[ j ];
+        const double xK = x[ k ], yK = y[ k ], zK = z[ k ];
+
+        // Compute per-facet factor (Eq. 27 of Werner and Scheeres, 1997)
+        const double normI = std::sqrt( xI * xI + yI * yI + zI * zI );
+        const double normJ = std::sqrt( xJ * xJ + yJ * yJ + zJ * zJ );
+        const double normK = std::sqrt( xK * xK + yK * yK + zK * zK );
+        const double numerator =
+                xI * ( yJ * zK - zJ * yK ) + yI * ( zJ * xK - xJ * zK ) + zI * ( xJ * yK - yJ * xK );
+        double factor = 0.0;
+        if( numerator != 0.0 )
         {
-            if ( verticesDefiningEachEdge_(i,j) < 0 )
-            {
-                throw std::runtime_error( "The vertices defining some edge were not selected." );
-            }
-            else if ( facetsDefiningEachEdge_(i,j) < 0 )
-            {
-                throw std::runtime_error( "The facets defining some edge were not selected." );
-            }
+            factor = 2.0 * std::atan2(
+                        numerator, normI * normJ * normK +
+                        normI * ( xJ * xK + yJ * yK + zJ * zK ) +
+                        normJ * ( xK * xI + yK * yI + zK * zI ) +
+                        normK * ( xI * xJ + yI * yJ + zI * zJ ) );
+        }
+        perFacetFactor[ facet ] = factor;
+        factorSum += factor;
+
+        if( computeSums_ )
+        {
+            const double fXX = facetDyadEntries_( facet, 0 ), fXY = facetDyadEntries_( facet, 1 ),
+                    fXZ = facetDyadEntries_( facet, 2 ), fYY = facetDyadEntries_( facet, 3 ),
+                    fYZ = facetDyadEntries_( facet, 4 ), fZZ = facetDyadEntries_( facet, 5 );
+
+            // Gradient term, with vector to facet centroid
+            const double xC = ( xI + xJ + xK ) / 3.0, yC = ( yI + yJ + yK ) / 3.0, zC = ( zI + zJ + zK ) / 3.0;
+            gradientSumX += ( fXX * xC + fXY * yC + fXZ * zC ) * factor;
+            gradientSumY += ( fXY * xC + fYY * yC + fYZ * zC ) * factor;
+            gradientSumZ += ( fXZ * xC + fYZ * yC + fZZ * zC ) * factor;
+
+            // Potential term, with vector to first vertex
+            potentialSum += ( xI * ( fXX * xI + fXY * yI + fXZ * zI ) +
+                              yI * ( fXY * xI + fYY * yI + fYZ * zI ) +
+                              zI * ( fXZ * xI + fYZ * yI + fZZ * zI ) ) * factor;
         }
     }
+
+    currentFacetBlockSums_[ block ].gradientSum << gradientSumX, gradientSumY, gradientSumZ;
+    currentFacetBlockSums_[ block ].potentialSum = potentialSum;
+    currentFacetBlockSums_[ block ].factorSum = factorSum;
 }
 
-void PolyhedronGravityField::computeFacetNormalsAndDyads ( )
+void PolyhedronGravityCache::updateEdgeBlock( const int block )
 {
-    const unsigned int numberOfFacets = verticesDefiningEachFacet_.rows();
+    const int firstEdge = block * POLYHEDRON_BLOCK_SIZE;
+    const int endEdge = std::min( firstEdge + POLYHEDRON_BLOCK_SIZE,
+                                  static_cast< int >( verticesDefiningEachEdge_.rows( ) ) );
 
-    facetNormalVectors_.resize(numberOfFacets);
-    facetDyads_.resize(numberOfFacets);
+    const double* x = currentVerticesCoordinatesRelativeToFieldPoint_.col( 0 ).data( );
+    const double* y = currentVerticesCoordinatesRelativeToFieldPoint_.col( 1 ).data( );
+    const double* z = currentVerticesCoordinatesRelativeToFieldPoint_.col( 2 ).data( );
+    const int* vertexI = verticesDefiningEachEdge_.col( 0 ).data( );
+    const int* vertexJ = verticesDefiningEachEdge_.col( 1 ).data( );
+    double* perEdgeFactor = currentPerEdgeFactor_.data( );
 
-    // Loop over facets, and for each facet compute the facet normal and the facet dyad
-    for (unsigned int facet = 0; facet < numberOfFacets; ++facet)
+    double gradientSumX = 0.0, gradientSumY = 0.0, gradientSumZ = 0.0, potentialSum = 0.0, factorSum = 0.0;
+    for( int edge = firstEdge; edge < endEdge; ++edge )
     {
-        Eigen::Vector3d vertex0 = verticesCoordinates_.block<1,3>(verticesDefiningEachFacet_(facet,0),0);
-        Eigen::Vector3d vertex1 = verticesCoordinates_.block<1,3>(verticesDefiningEachFacet_(facet,1),0);
-        Eigen::Vector3d vertex2 = verticesCoordinates_.block<1,3>(verticesDefiningEachFacet_(facet,2),0);
+        // Retrieve position vectors of edge's vertices relative to field point
+        const int i = vertexI[ edge ], j = vertexJ[ edge ];
+        const double xI = x[ i ], yI = y[ i ], zI = z[ i ];
+        const double xJ = x[ j ], yJ = y[ j ], zJ = z[ j ];
+
+        // Compute per-edge factor (Eq. 7 of Werner and Scheeres, 1997); see calculatePolyhedronPerEdgeFactor for the
+        // treatment of the singularity at the edges
+        const double normI = std::sqrt( xI * xI + yI * yI + zI * zI );
+        const double normJ = std::sqrt( xJ * xJ + yJ * yJ + zJ * zJ );
+        const double edgeLength = std::sqrt(
+                    ( xI - xJ ) * ( xI - xJ ) + ( yI - yJ ) * ( yI - yJ ) + ( zI - zJ ) * ( zI - zJ ) );
+        const double denominator = normI + normJ - edgeLength;
+        double factor = 0.0;
+        if( !( std::abs( denominator ) < 1e-18 ) )
+        {
+            factor = std::log( ( normI + normJ + edgeLength ) / denominator );
+        }
+        perEdgeFactor[ edge ] = factor;
+        factorSum += factor;
+
+        if( computeSums_ )
+        {
+            const double eXX = edgeDyadEntries_( edge, 0 ), eXY = edgeDyadEntries_( edge, 1 ),
+                    eXZ = edgeDyadEntries_( edge, 2 ), eYY = edgeDyadEntries_( edge, 3 ),
+                    eYZ = edgeDyadEntries_( edge, 4 ), eZZ = edgeDyadEntries_( edge, 5 );
 
-        // Compute outward-pointing vector normal to facet
-        facetNormalVectors_.at(facet) = (vertex1 - vertex0).cross(vertex2 - vertex1);
-        facetNormalVectors_.at(facet).normalize();
+            // Gradient term, with vector to edge midpoint
+            const double xC = ( xI + xJ ) / 2.0, yC = ( yI + yJ ) / 2.0, zC = ( zI + zJ ) / 2.0;
+            gradientSumX += ( eXX * xC + eXY * yC + eXZ * zC ) * factor;
+            gradientSumY += ( eXY * xC + eYY * yC + eYZ * zC ) * factor;
+            gradientSumZ += ( eXZ * xC + eYZ * yC + eZZ * zC ) * factor;
 
-        // Compute facet dyad (outer product)
-        facetDyads_.at(facet) = facetNormalVectors_.at(facet) * facetNormalVectors_.at(facet).transpose();
+            // Potential term, with vector to first vertex
+            potentialSum += ( xI * ( eXX * xI + eXY * yI + eXZ * zI ) +
+                              yI * ( eXY * xI + eYY * yI + eYZ * zI ) +
+                              zI * ( eXZ * xI + eYZ * yI + eZZ * zI ) ) * factor;
+        }
     }
 
+    currentEdgeBlockSums_[ block ].gradientSum << gradientSumX, gradientSumY, gradientSumZ;
+    currentEdgeBlockSums_[ block ].potentialSum = potentialSum;
+    currentEdgeBlockSums_[ block ].factorSum = factorSum;
 }
 
-void PolyhedronGravityField::computeEdgeDyads ( )
+void PolyhedronGravityCache::update (const Eigen::Vector3d& currentBodyFixedPosition)
 {
-    const unsigned int numberOfEdges = verticesDefiningEachEdge_.rows();
+    if ( currentBodyFixedPosition != currentBodyFixedPosition_ )
+    {
+        currentBodyFixedPosition_ = currentBodyFixedPosition;
 
-    edgeDyads_.resize(numberOfEdges);
+        // Compute coordinates of vertices with respect to field point
+        basic_mathematics::calculatePolyhedronVerticesCoordinatesRelativeToFieldPoint(
+                currentVerticesCoordinatesRelativeToFieldPoint_, currentBodyFixedPosition_, verticesCoordinates_);
 
-    // Loop over edges, and for each edge compute the edge dyad
-    for (unsigned int edge = 0; edge < numberOfEdges; ++edge)
-    {
-        Eigen::Vector3d vertex0 = verticesCoordinates_.block<1,3>(verticesDefiningEachEdge_(edge,0),0);
-        Eigen::Vector3d vertex1 = verticesCoordinates_.block<1,3>(verticesDefiningEachEdge_(edge,1),0);
-
-        // Compute edge normals, with arbitrary direction
-        Eigen::Vector3d facetNormalFacetA = facetNormalVectors_.at(facetsDefiningEachEdge_(edge, 0) );
-        Eigen::Vector3d edgeNormalFacetA = ( vertex0 - vertex1).cross(facetNormalFacetA );
-        edgeNormalFacetA.normalize();
-        Eigen::Vector3d facetNormalFacetB = facetNormalVectors_.at(facetsDefiningEachEdge_(edge, 1) );
-        Eigen::Vector3d edgeNormalFacetB = ( vertex0 - vertex1).cross(facetNormalFacetB );
-        edgeNormalFacetB.normalize();
-
-        // Check order of vertices for the facet associated with edgeNormalA, and correct the edge normal directions based on that
-        int vertex0FacetAIndex = -1, vertex1FacetAIndex = -1;
-        for (int facetVertex = 0; facetVertex < 3; ++facetVertex )
+        // Compute per-facet and per-edge factors and sums, for all blocks of facets and edges
+        executeTasks( numberOfFacetBlocks_ + numberOfEdgeBlocks_, [ this ]( const int task )
         {
-            if ( verticesDefiningEachFacet_(facetsDefiningEachEdge_(edge,0), facetVertex) == verticesDefiningEachEdge_(edge, 0) )
+            if( task < numberOfFacetBlocks_ )
             {
-                vertex0FacetAIndex = facetVertex;
+                updateFacetBlock( task );
             }
-            else if ( verticesDefiningEachFacet_(facetsDefiningEachEdge_(edge,0), facetVertex) == verticesDefiningEachEdge_(edge, 1) )
+            else
             {
-                vertex1FacetAIndex = facetVertex;
+                updateEdgeBlock( task - numberOfFacetBlocks_ );
             }
+        } );
+
+        // Add partial sums of all blocks, in fixed order
+        currentPerFacetGradientSum_.setZero( );
+        currentPerFacetPotentialSum_ = 0.0;
+        currentPerFacetFactorSum_ = 0.0;
+        for( int block = 0; block < numberOfFacetBlocks_; block++ )
+        {
+            currentPerFacetGradientSum_ += currentFacetBlockSums_[ block ].gradientSum;
+            currentPerFacetPotentialSum_ += currentFacetBlockSums_[ block ].potentialSum;
+            currentPerFacetFactorSum_ += currentFacetBlockSums_[ block ].factorSum;
         }
 
-        if( vertex0FacetAIndex < 0 || vertex1FacetAIndex < 0 )
+        currentPerEdgeGradientSum_.setZero( );
+        currentPerEdgePotentialSum_ = 0.0;
+        for( int block = 0; block < numberOfEdgeBlocks_; block++ )
         {
-            throw std::runtime_error( "Error when computing edge dyads in polyhedron gravity field; could not identify vertices" );
+            currentPerEdgeGradientSum_ += currentEdgeBlockSums_[ block ].gradientSum;
+            currentPerEdgePotentialSum_ += currentEdgeBlockSums_[ block ].potentialSum;
         }
+    }
+}
+
+void PolyhedronGravityCache::checkDyadsAreAvailable( const std::string& quantity )
+{
+    if( !computeSums_ )
+    {
+        throw std::runtime_error( "Error when computing polyhedron " + quantity +
+                                  " from cache: facet and edge dyads were not provided." );
+    }
+}
+
+double PolyhedronGravityCache::getGravitationalPotential( const double gravitationalConstantTimesDensity )
+{
+    checkDyadsAreAvailable( "potential" );
+    return 0.5 * gravitationalConstantTimesDensity * ( currentPerEdgePotentialSum_ - currentPerFacetPotentialSum_ );
+}
+
+Eigen::Vector3d PolyhedronGravityCache::getGradientOfPotential( const double gravitationalConstantTimesDensity )
+{
+    checkDyadsAreAvailable( "gradient of potential" );
+    return - gravitationalConstantTimesDensity * ( currentPerEdgeGradientSum_ - currentPerFacetGradientSum_ );
+}
 
+Eigen::Matrix3d PolyhedronGravityCache::getHessianOfPotential( const double gravitationalConstantTimesDensity )
+{
+    checkDyadsAreAvailable( "hessian of potential" );
 
-        if (( vertex0FacetAIndex == vertex1FacetAIndex + 1) || ( vertex0FacetAIndex == 0 && vertex1FacetAIndex == 2 ) )
+    // Compute sums of dyads times factors (edge terms positive, facet terms negative), for all blocks
+    executeTasks( numberOfFacetBlocks_ + numberOfEdgeBlocks_, [ this ]( const int task )
+    {
+        const bool isFacetBlock = ( task < numberOfFacetBlocks_ );
+        const int block = isFacetBlock ? task : task - numberOfFacetBlocks_;
+        const Eigen::Matrix< double, Eigen::Dynamic, 6 >& dyadEntries =
+                isFacetBlock ? facetDyadEntries_ : edgeDyadEntries_;
+        const Eigen::VectorXd& factors = isFacetBlock ? currentPerFacetFactor_ : currentPerEdgeFactor_;
+
+        const int first = block * POLYHEDRON_BLOCK_SIZE;
+        const int end = std::min( first + POLYHEDRON_BLOCK_SIZE, static_cast< int >( factors.rows( ) ) );
+
+        double sums[ 6 ] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+        for( int entry = 0; entry < 6; entry++ )
         {
-            edgeNormalFacetB = - edgeNormalFacetB;
+            const double* dyadEntry = dyadEntries.col( entry ).data( );
+            for( int i = first; i < end; i++ )
+            {
+                sums[ entry ] += dyadEntry[ i ] * factors( i );
+            }
         }
-        else
+
+        if( !isFacetBlock )
         {
-            edgeNormalFacetA = - edgeNormalFacetA;
+            for( int i = first; i < end; i++ )
+            {
+                if ( factors( i ) == 0 )
+                {
+                    // When computing the per edge factor, it is taken to be 0 at edges singularities (see function
+                    // calculatePolyhedronPerEdgeFactor, and reference within). This is not valid when computing the
+                    // hessian matrix!
+                    throw std::runtime_error( "Computation of hessian matrix has a singularity for points at edges." );
+                }
+            }
         }
 
-        // Compute edge dyads: outer product
-        edgeDyads_.at(edge) = facetNormalFacetA * edgeNormalFacetA.transpose() + facetNormalFacetB * edgeNormalFacetB.transpose();
+        const double sign = isFacetBlock ? -1.0 : 1.0;
+        currentBlockHessianSums_[ task ] <<
+            sums[ 0 ], sums[ 1 ], sums[ 2 ],
+            sums[ 1 ], sums[ 3 ], sums[ 4 ],
+            sums[ 2 ], sums[ 4 ], sums[ 5 ];
+        currentBlockHessianSums_[ task ] *= sign;
+    } );
 
+    Eigen::Matrix3d hessianSum = Eigen::Matrix3d::Zero( );
+    for( unsigned int i = 0; i < currentBlockHessianSums_.size( ); i++ )
+    {
+        hessianSum += currentBlockHessianSums_[ i ];
     }
+    return gravitationalConstantTimesDensity * hessianSum;
 }
 
 } // namespace gravitation
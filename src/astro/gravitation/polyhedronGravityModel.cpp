@@ -31,46 +31,105 @@ void PolyhedronGravitationalAccelerationModel::updateMembers( const double curre
 
         currentRelativePosition_ = rotationToIntegrationFrame_.inverse( ) * currentInertialRelativePosition_;
 
-        polyhedronCache_->update( currentRelativePosition_ );
-
-        // Compute the current acceleration
-        currentAccelerationInBodyFixedFrame_ = basic_mathematics::calculatePolyhedronGradientOfGravitationalPotential(
-                gravitationalParameterFunction_() / volumeFunction_(),
-                polyhedronCache_->getVerticesCoordinatesRelativeToFieldPoint(),
-                getVerticesDefiningEachFacet_(),
-                getVerticesDefiningEachEdge_(),
-                getFacetDyads_(),
-                getEdgeDyads_(),
-                polyhedronCache_->getPerFacetFactor(),
-                polyhedronCache_->getPerEdgeFactor() );
+        const double gravitationalConstantTimesDensity = gravitationalParameterFunction_( ) / volumeFunction_( );
 
-        currentAcceleration_ = rotationToIntegrationFrame_ * currentAccelerationInBodyFixedFrame_;
+        // Determine which models are to be evaluated
+        if( farFieldAccelerationModel_ != nullptr )
+        {
+            computeHybridGravityFieldBlendingWeight(
+                    currentRelativePosition_.norm( ), innerSwitchDistance_, outerSwitchDistance_,
+                    currentFarFieldWeight_, currentFarFieldWeightDerivative_ );
+        }
 
-        // Compute the current gravitational potential
-        if ( updatePotential_ )
+        currentFarFieldAccelerationCorrectionInBodyFixedFrame_.setZero( );
+        if( currentFarFieldWeight_ < 1.0 )
         {
-            currentPotential_ = basic_mathematics::calculatePolyhedronGravitationalPotential(
-                    gravitationalParameterFunction_( ) / volumeFunction_( ),
-                    polyhedronCache_->getVerticesCoordinatesRelativeToFieldPoint( ),
-                    getVerticesDefiningEachFacet_( ),
-                    getVerticesDefiningEachEdge_( ),
-                    getFacetDyads_( ),
-                    getEdgeDyads_( ),
-                    polyhedronCache_->getPerFacetFactor( ),
-                    polyhedronCache_->getPerEdgeFactor( ) );
+            polyhedronCache_->update( currentRelativePosition_ );
+
+            // Compute the current acceleration
+            currentAccelerationInBodyFixedFrame_ = polyhedronCache_->getGradientOfPotential(
+                    gravitationalConstantTimesDensity );
+
+            // Compute the current gravitational potential
+            if ( updatePotential_ )
+            {
+                currentPotential_ = polyhedronCache_->getGravitationalPotential( gravitationalConstantTimesDensity );
+            }
+
+            // Compute the current laplacian
+            if ( updateLaplacianOfPotential_ )
+            {
+                currentLaplacianOfPotential_ = polyhedronCache_->getLaplacianOfPotential(
+                        gravitationalConstantTimesDensity );
+            }
         }
 
-        // Compute the current laplacian
-        if ( updateLaplacianOfPotential_ )
+        // Compute far-field model, and blend with polyhedron if required
+        if( currentFarFieldWeight_ > 0.0 )
         {
-            currentLaplacianOfPotential_ = basic_mathematics::calculatePolyhedronLaplacianOfGravitationalPotential(
-                    gravitationalParameterFunction_( ) / volumeFunction_( ),
-                    polyhedronCache_->getPerFacetFactor( ) );
+            farFieldAccelerationModel_->updateMembers( currentTime );
+            const Eigen::Vector3d farFieldAcceleration = farFieldAccelerationModel_->getAccelerationInBodyFixedFrame( );
+            if( currentFarFieldWeight_ < 1.0 )
+            {
+                currentFarFieldAccelerationCorrectionInBodyFixedFrame_ =
+                        farFieldAcceleration - currentAccelerationInBodyFixedFrame_;
+                currentAccelerationInBodyFixedFrame_ +=
+                        currentFarFieldWeight_ * currentFarFieldAccelerationCorrectionInBodyFixedFrame_;
+                if ( updatePotential_ )
+                {
+                    currentPotential_ += currentFarFieldWeight_ * (
+                            farFieldAccelerationModel_->getCurrentPotential( ) - currentPotential_ );
+                }
+                if ( updateLaplacianOfPotential_ )
+                {
+                    currentLaplacianOfPotential_ *= ( 1.0 - currentFarFieldWeight_ );
+                }
+            }
+            else
+            {
+                currentAccelerationInBodyFixedFrame_ = farFieldAcceleration;
+                if ( updatePotential_ )
+                {
+                    currentPotential_ = farFieldAccelerationModel_->getCurrentPotential( );
+                }
+                if ( updateLaplacianOfPotential_ )
+                {
+                    currentLaplacianOfPotential_ = 0.0;
+                }
+            }
         }
+
+        currentAcceleration_ = rotationToIntegrationFrame_ * currentAccelerationInBodyFixedFrame_;
     }
 }
 
 
+void PolyhedronGravitationalAccelerationModel::setFarFieldAccelerationModel(
+        const std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > farFieldAccelerationModel,
+        const double innerSwitchDistance,
+        const double outerSwitchDistance )
+{
+    if( farFieldAccelerationModel == nullptr )
+    {
+        throw std::runtime_error( "Error when setting far-field model of polyhedron acceleration: model is empty." );
+    }
+    if( outerSwitchDistance < innerSwitchDistance )
+    {
+        throw std::runtime_error(
+                    "Error when setting far-field model of polyhedron acceleration: outer switch distance (" +
+                    std::to_string( outerSwitchDistance ) + ") is smaller than inner switch distance (" +
+                    std::to_string( innerSwitchDistance ) + ")." );
+    }
+
+    farFieldAccelerationModel_ = farFieldAccelerationModel;
+    farFieldAccelerationModel_->resetUpdatePotential( updatePotential_ );
+    innerSwitchDistance_ = innerSwitchDistance;
+    outerSwitchDistance_ = outerSwitchDistance;
+
+    // Force recomputation upon next update
+    this->currentTime_ = TUDAT_NAN;
+}
+
 } // namespace gravitation
 
 } // namespace tudat
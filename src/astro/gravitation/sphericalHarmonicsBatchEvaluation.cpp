@@ -0,0 +1,517 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "tudat/astro/gravitation/sphericalHarmonicsBatchEvaluation.h"
+#include "tudat/basics/parallelization.h"
+#include "tudat/math/basic/coordinateConversions.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+#include "tudat/math/basic/sphericalHarmonics.h"
+#include "tudat/astro/gravitation/sphericalHarmonicsDeviceEvaluation.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Set of points with identical distance and latitude, evaluated together by the ring-wise algorithm
+struct SphericalHarmonicsEvaluationRing
+{
+    //! Distance of the points from the center of the body
+    double distance;
+
+    //! Sine of the latitude of the points
+    double sineOfLatitude;
+
+    //! Index of the first point of the ring in the list of sorted point indices
+    int firstPoint;
+
+    //! Number of points in the ring
+    int numberOfPoints;
+};
+
+//! Geodesy-normalized coefficients, stored degree by degree in packed (triangular) order
+struct PackedSphericalHarmonicCoefficients
+{
+    //! Constructor, packs the coefficients
+    PackedSphericalHarmonicCoefficients( const Eigen::MatrixXd& cosineCoefficients,
+                                         const Eigen::MatrixXd& sineCoefficients )
+    {
+        if( cosineCoefficients.rows( ) != sineCoefficients.rows( ) ||
+                cosineCoefficients.cols( ) != sineCoefficients.cols( ) )
+        {
+            throw std::runtime_error( "Error when evaluating spherical harmonic field at multiple points, sine and cosine "
+                                      "coefficient sizes are incompatible" );
+        }
+        if( cosineCoefficients.rows( ) == 0 || cosineCoefficients.cols( ) == 0 )
+        {
+            throw std::runtime_error( "Error when evaluating spherical harmonic field at multiple points, no coefficients "
+                                      "provided" );
+        }
+
+        maximumDegree = cosineCoefficients.rows( ) - 1;
+        maximumOrder = std::min( maximumDegree, static_cast< int >( cosineCoefficients.cols( ) ) - 1 );
+
+        degreeOffsets.resize( maximumDegree + 2 );
+        degreeOffsets[ 0 ] = 0;
+        for( int degree = 0; degree <= maximumDegree; degree++ )
+        {
+            degreeOffsets[ degree + 1 ] = degreeOffsets[ degree ] + std::min( degree, maximumOrder ) + 1;
+        }
+
+        cosineValues.resize( degreeOffsets[ maximumDegree + 1 ] );
+        sineValues.resize( degreeOffsets[ maximumDegree + 1 ] );
+        for( int degree = 0; degree <= maximumDegree; degree++ )
+        {
+            for( int order = 0; order <= std::min( degree, maximumOrder ); order++ )
+            {
+                cosineValues[ degreeOffsets[ degree ] + order ] = cosineCoefficients( degree, order );
+                sineValues[ degreeOffsets[ degree ] + order ] = sineCoefficients( degree, order );
+            }
+        }
+    }
+
+    //! Maximum degree of coefficients
+    int maximumDegree;
+
+    //! Maximum order of coefficients (limited to maximum degree)
+    int maximumOrder;
+
+    //! Start of each degree in packed storage
+    std::vector< int > degreeOffsets;
+
+    //! Cosine coefficients in packed storage
+    std::vector< double > cosineValues;
+
+    //! Sine coefficients in packed storage
+    std::vector< double > sineValues;
+};
+
+//! Function to evaluate the potential and gradient at all points of a set of rings
+/*!
+ *  Function to evaluate the potential and gradient at all points of a set of rings, using the ring-wise algorithm
+ *  described in computeGeodesyNormalizedPotentialAndGradientAtPoints
+ *  \param rings Rings that are to be evaluated
+ *  \param sortedPointIndices List of point indices, in which the indices of the points of each ring are contiguous
+ *  \param bodyFixedPositions Cartesian positions of the points
+ *  \param longitudes Longitudes of the points
+ *  \param gravitationalParameter Gravitational parameter of massive body
+ *  \param referenceRadius Reference radius of spherical harmonic field expansion
+ *  \param coefficients Packed geodesy-normalized coefficients
+ *  \param recursionType Type of recursion used to compute the Legendre polynomials
+ *  \param potentials Potential at each of the points (returned by reference, entries of points in rings are set)
+ *  \param gradients Gradient of the potential at each of the points (returned by reference, entries of points in rings
+ *  are set)
+ */
+void evaluatePotentialAndGradientOnRings(
+        const std::vector< SphericalHarmonicsEvaluationRing >& rings,
+        const std::vector< int >& sortedPointIndices,
+        const Eigen::Matrix3Xd& bodyFixedPositions,
+        const std::vector< double >& longitudes,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const PackedSphericalHarmonicCoefficients& coefficients,
+        const basic_mathematics::LegendreRecursionType recursionType,
+        double* potentials,
+        Eigen::Matrix3Xd& gradients )
+{
+    const int maximumDegree = coefficients.maximumDegree;
+    const int maximumOrder = coefficients.maximumOrder;
+    const double preMultiplier = gravitationalParameter / referenceRadius;
+
+    // Legendre cache is created up to one order higher than required, so that derivatives of all orders are available
+    basic_mathematics::LegendreCache legendreCache(
+                maximumDegree, std::min( maximumDegree, maximumOrder + 1 ), true );
+    legendreCache.setRecursionType( recursionType );
+
+    // Per order sums over all degrees of (potential, radial and latitudinal gradient) terms
+    std::vector< double > cosinePotentialSums( maximumOrder + 1 ), sinePotentialSums( maximumOrder + 1 );
+    std::vector< double > cosineRadialSums( maximumOrder + 1 ), sineRadialSums( maximumOrder + 1 );
+    std::vector< double > cosineLatitudinalSums( maximumOrder + 1 ), sineLatitudinalSums( maximumOrder + 1 );
+
+    for( unsigned int ringIndex = 0; ringIndex < rings.size( ); ringIndex++ )
+    {
+        const SphericalHarmonicsEvaluationRing& ring = rings.at( ringIndex );
+        legendreCache.update( ring.sineOfLatitude );
+        const double cosineOfLatitude = legendreCache.getCurrentPolynomialParameterComplement( );
+        const double radiusRatio = referenceRadius / ring.distance;
+
+        // Compute sums over all degrees, per order
+        std::fill( cosinePotentialSums.begin( ), cosinePotentialSums.end( ), 0.0 );
+        std::fill( sinePotentialSums.begin( ), sinePotentialSums.end( ), 0.0 );
+        std::fill( cosineRadialSums.begin( ), cosineRadialSums.end( ), 0.0 );
+        std::fill( sineRadialSums.begin( ), sineRadialSums.end( ), 0.0 );
+        std::fill( cosineLatitudinalSums.begin( ), cosineLatitudinalSums.end( ), 0.0 );
+        std::fill( sineLatitudinalSums.begin( ), sineLatitudinalSums.end( ), 0.0 );
+
+        double radiusPowerTerm = radiusRatio;
+        for( int degree = 0; degree <= maximumDegree; degree++ )
+        {
+            const double* legendrePolynomials = legendreCache.getLegendrePolynomialValuesOfDegree( degree );
+            const double* legendrePolynomialDerivatives =
+                    legendreCache.getLegendrePolynomialDerivativeValuesOfDegree( degree );
+            const double* cosineCoefficients = coefficients.cosineValues.data( ) + coefficients.degreeOffsets[ degree ];
+            const double* sineCoefficients = coefficients.sineValues.data( ) + coefficients.degreeOffsets[ degree ];
+            const double degreePlusOne = static_cast< double >( degree ) + 1.0;
+
+            const int numberOfOrders = std::min( degree, maximumOrder ) + 1;
+            for( int order = 0; order < numberOfOrders; order++ )
+            {
+                const double polynomialTerm = radiusPowerTerm * legendrePolynomials[ order ];
+                const double derivativeTerm = radiusPowerTerm * legendrePolynomialDerivatives[ order ];
+                cosinePotentialSums[ order ] += polynomialTerm * cosineCoefficients[ order ];
+                sinePotentialSums[ order ] += polynomialTerm * sineCoefficients[ order ];
+                cosineRadialSums[ order ] += degreePlusOne * polynomialTerm * cosineCoefficients[ order ];
+                sineRadialSums[ order ] += degreePlusOne * polynomialTerm * sineCoefficients[ order ];
+                cosineLatitudinalSums[ order ] += derivativeTerm * cosineCoefficients[ order ];
+                sineLatitudinalSums[ order ] += derivativeTerm * sineCoefficients[ order ];
+            }
+            radiusPowerTerm *= radiusRatio;
+        }
+
+        // Evaluate potential and gradient at each longitude of ring
+        for( int i = 0; i < ring.numberOfPoints; i++ )
+        {
+            const int pointIndex = sortedPointIndices[ ring.firstPoint + i ];
+            const double cosineOfLongitude = std::cos( longitudes[ pointIndex ] );
+            const double sineOfLongitude = std::sin( longitudes[ pointIndex ] );
+
+            double cosineOfOrderLongitude = 1.0;
+            double sineOfOrderLongitude = 0.0;
+            double potentialSum = 0.0, radialSum = 0.0, latitudinalSum = 0.0, longitudinalSum = 0.0;
+            for( int order = 0; order <= maximumOrder; order++ )
+            {
+                potentialSum += cosinePotentialSums[ order ] * cosineOfOrderLongitude +
+                        sinePotentialSums[ order ] * sineOfOrderLongitude;
+                radialSum += cosineRadialSums[ order ] * cosineOfOrderLongitude +
+                        sineRadialSums[ order ] * sineOfOrderLongitude;
+                latitudinalSum += cosineLatitudinalSums[ order ] * cosineOfOrderLongitude +
+                        sineLatitudinalSums[ order ] * sineOfOrderLongitude;
+                longitudinalSum += static_cast< double >( order ) * (
+                            sinePotentialSums[ order ] * cosineOfOrderLongitude -
+                            cosinePotentialSums[ order ] * sineOfOrderLongitude );
+
+                // Compute trigonometric functions of next order by angle addition
+                const double previousCosineOfOrderLongitude = cosineOfOrderLongitude;
+                cosineOfOrderLongitude = previousCosineOfOrderLongitude * cosineOfLongitude -
+                        sineOfOrderLongitude * sineOfLongitude;
+                sineOfOrderLongitude = sineOfOrderLongitude * cosineOfLongitude +
+                        previousCosineOfOrderLongitude * sineOfLongitude;
+            }
+
+            potentials[ pointIndex ] = preMultiplier * potentialSum;
+
+            Eigen::Vector3d sphericalGradient;
+            sphericalGradient( basic_mathematics::radiusIndex ) = -preMultiplier / ring.distance * radialSum;
+            sphericalGradient( basic_mathematics::latitudeIndex ) = preMultiplier * cosineOfLatitude * latitudinalSum;
+            sphericalGradient( basic_mathematics::longitudeIndex ) = preMultiplier * longitudinalSum;
+            gradients.col( pointIndex ) = coordinate_conversions::getSphericalToCartesianGradientMatrix(
+                        bodyFixedPositions.col( pointIndex ) ) * sphericalGradient;
+        }
+    }
+}
+
+//! Function to distribute the evaluation of a set of rings over a number of threads
+void evaluatePotentialAndGradientOnRingsInParallel(
+        const std::vector< SphericalHarmonicsEvaluationRing >& rings,
+        const std::vector< int >& sortedPointIndices,
+        const Eigen::Matrix3Xd& bodyFixedPositions,
+        const std::vector< double >& longitudes,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const Eigen::MatrixXd& cosineCoefficients,
+        const Eigen::MatrixXd& sineCoefficients,
+        const int numberOfThreads,
+        const basic_mathematics::LegendreRecursionType recursionType,
+        double* potentials,
+        Eigen::Matrix3Xd& gradients )
+{
+    if( numberOfThreads < 1 )
+    {
+        throw std::runtime_error( "Error when evaluating spherical harmonic field at multiple points, number of threads "
+                                  "must be at least 1" );
+    }
+
+    const PackedSphericalHarmonicCoefficients coefficients( cosineCoefficients, sineCoefficients );
+
+    // Distribute rings over one chunk per thread (rings have near-identical cost), each processed with its own cache
+    const int numberOfRings = static_cast< int >( rings.size( ) );
+    const int numberOfChunks = std::min( numberOfRings, numberOfThreads );
+    std::vector< std::vector< SphericalHarmonicsEvaluationRing > > ringChunks( numberOfChunks );
+    for( int i = 0; i < numberOfRings; i++ )
+    {
+        ringChunks[ static_cast< long long >( i ) * numberOfChunks / numberOfRings ].push_back( rings[ i ] );
+    }
+
+    utilities::executeParallelTasks(
+                numberOfChunks, [ & ]( const int chunkIndex )
+    {
+        evaluatePotentialAndGradientOnRings(
+                    ringChunks[ chunkIndex ], sortedPointIndices, bodyFixedPositions, longitudes,
+                    gravitationalParameter, referenceRadius, coefficients, recursionType, potentials, gradients );
+    }, numberOfThreads );
+}
+
+//! Function to check whether a backend for batched spherical harmonic field evaluation runs on a CUDA device
+bool isSphericalHarmonicsBatchEvaluationOnDevice( const SphericalHarmonicsBatchEvaluationBackend backend )
+{
+    return ( backend == cuda_batch_evaluation ) && TUDAT_BUILD_WITH_CUDA;
+}
+
+//! Function to evaluate the potential and gradient at a set of points, with one (device or host) thread per point
+/*!
+ *  Function to evaluate the potential and gradient at a set of points with
+ *  computeGeodesyNormalizedPotentialAndGradientAtSinglePoint, packing the coefficients (and the Legendre recursion
+ *  coefficients) order by order. When Tudat is built with TUDAT_BUILD_WITH_CUDA, the points are evaluated on a CUDA
+ *  device by computeGeodesyNormalizedPotentialAndGradientOnDevice. Otherwise, the same function is evaluated on the host,
+ *  with the points distributed over the requested number of threads.
+ *  \param bodyFixedPositions Cartesian positions of the points
+ *  \param gravitationalParameter Gravitational parameter of massive body
+ *  \param referenceRadius Reference radius of spherical harmonic field expansion
+ *  \param cosineCoefficients Cosine spherical harmonic coefficients (geodesy normalized)
+ *  \param sineCoefficients Sine spherical harmonic coefficients (geodesy normalized)
+ *  \param numberOfThreads Number of threads over which the points are distributed (host evaluation only)
+ *  \param potentials Potential at each of the points (returned by reference, must be allocated)
+ *  \param gradients Gradient of the potential at each of the points (returned by reference, must be allocated)
+ */
+void evaluatePotentialAndGradientPointwise(
+        const Eigen::Matrix3Xd& bodyFixedPositions,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const Eigen::MatrixXd& cosineCoefficients,
+        const Eigen::MatrixXd& sineCoefficients,
+        const int numberOfThreads,
+        double* potentials,
+        Eigen::Matrix3Xd& gradients )
+{
+    if( numberOfThreads < 1 )
+    {
+        throw std::runtime_error( "Error when evaluating spherical harmonic field at multiple points, number of threads "
+                                  "must be at least 1" );
+    }
+
+    // Check input using degree-wise packing, and repack order by order
+    const PackedSphericalHarmonicCoefficients coefficients( cosineCoefficients, sineCoefficients );
+    const int maximumDegree = coefficients.maximumDegree;
+    const int maximumOrder = coefficients.maximumOrder;
+
+    std::vector< int > orderOffsets( maximumOrder + 2 );
+    orderOffsets[ 0 ] = 0;
+    for( int order = 0; order <= maximumOrder; order++ )
+    {
+        orderOffsets[ order + 1 ] = orderOffsets[ order ] + maximumDegree - order + 1;
+    }
+
+    const int numberOfCoefficients = orderOffsets[ maximumOrder + 1 ];
+    std::vector< double > orderPackedCosineCoefficients( numberOfCoefficients );
+    std::vector< double > orderPackedSineCoefficients( numberOfCoefficients );
+    for( int order = 0; order <= maximumOrder; order++ )
+    {
+        for( int degree = order; degree <= maximumDegree; degree++ )
+        {
+            orderPackedCosineCoefficients[ orderOffsets[ order ] + degree - order ] = cosineCoefficients( degree, order );
+            orderPackedSineCoefficients[ orderOffsets[ order ] + degree - order ] = sineCoefficients( degree, order );
+        }
+    }
+
+    // Precompute coefficients of the column recursion, and of the derivative w.r.t. latitude
+    std::vector< double > firstRecursionCoefficients( numberOfCoefficients, 0.0 );
+    std::vector< double > secondRecursionCoefficients( numberOfCoefficients, 0.0 );
+    std::vector< double > derivativeCoefficients( numberOfCoefficients, 0.0 );
+    for( int order = 0; order <= maximumOrder; order++ )
+    {
+        const double doubleOrder = static_cast< double >( order );
+        for( int degree = order + 1; degree <= maximumDegree; degree++ )
+        {
+            const int index = orderOffsets[ order ] + degree - order;
+            const double doubleDegree = static_cast< double >( degree );
+            const double degreeMinusOrder = doubleDegree - doubleOrder;
+            const double degreePlusOrder = doubleDegree + doubleOrder;
+            firstRecursionCoefficients[ index ] = std::sqrt(
+                        ( 2.0 * doubleDegree - 1.0 ) * ( 2.0 * doubleDegree + 1.0 ) /
+                        ( degreeMinusOrder * degreePlusOrder ) );
+            if( degree > order + 1 )
+            {
+                secondRecursionCoefficients[ index ] = std::sqrt(
+                            ( 2.0 * doubleDegree + 1.0 ) * ( degreePlusOrder - 1.0 ) * ( degreeMinusOrder - 1.0 ) /
+                            ( degreeMinusOrder * degreePlusOrder * ( 2.0 * doubleDegree - 3.0 ) ) );
+            }
+            derivativeCoefficients[ index ] = std::sqrt(
+                        ( 2.0 * doubleDegree + 1.0 ) * degreeMinusOrder * degreePlusOrder /
+                        ( 2.0 * doubleDegree - 1.0 ) );
+        }
+    }
+
+    const int numberOfPoints = bodyFixedPositions.cols( );
+    for( int i = 0; i < numberOfPoints; i++ )
+    {
+        if( bodyFixedPositions( 0, i ) == 0.0 && bodyFixedPositions( 1, i ) == 0.0 )
+        {
+            throw std::runtime_error( "Error when evaluating spherical harmonic field at multiple points with pointwise "
+                                      "evaluation, gradient is singular at the poles" );
+        }
+    }
+
+#if TUDAT_BUILD_WITH_CUDA
+    computeGeodesyNormalizedPotentialAndGradientOnDevice(
+                bodyFixedPositions.data( ), numberOfPoints, gravitationalParameter, referenceRadius,
+                maximumDegree, maximumOrder, orderPackedCosineCoefficients.data( ), orderPackedSineCoefficients.data( ),
+                orderOffsets.data( ), firstRecursionCoefficients.data( ), secondRecursionCoefficients.data( ),
+                derivativeCoefficients.data( ), potentials, gradients.data( ) );
+#else
+    // Distribute points over one chunk per thread
+    const int numberOfChunks = std::max( 1, std::min( numberOfPoints, numberOfThreads ) );
+    utilities::executeParallelTasks(
+                numberOfChunks, [ & ]( const int chunkIndex )
+    {
+        const int firstPoint = static_cast< long long >( chunkIndex ) * numberOfPoints / numberOfChunks;
+        const int lastPoint = static_cast< long long >( chunkIndex + 1 ) * numberOfPoints / numberOfChunks;
+        for( int i = firstPoint; i < lastPoint; i++ )
+        {
+            computeGeodesyNormalizedPotentialAndGradientAtSinglePoint(
+                        bodyFixedPositions.data( ) + 3 * i, gravitationalParameter, referenceRadius, maximumDegree,
+                        maximumOrder, orderPackedCosineCoefficients.data( ), orderPackedSineCoefficients.data( ),
+                        orderOffsets.data( ), firstRecursionCoefficients.data( ), secondRecursionCoefficients.data( ),
+                        derivativeCoefficients.data( ), potentials[ i ], gradients.data( ) + 3 * i );
+        }
+    }, numberOfThreads );
+#endif
+}
+
+//! Function to compute the potential and its gradient of a geodesy-normalized spherical harmonic field at a set of points
+void computeGeodesyNormalizedPotentialAndGradientAtPoints(
+        const Eigen::Matrix3Xd& bodyFixedPositions,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const Eigen::MatrixXd& cosineCoefficients,
+        const Eigen::MatrixXd& sineCoefficients,
+        Eigen::VectorXd& potentials,
+        Eigen::Matrix3Xd& gradients,
+        const int numberOfThreads,
+        const basic_mathematics::LegendreRecursionType recursionType,
+        const SphericalHarmonicsBatchEvaluationBackend backend )
+{
+    const int numberOfPoints = bodyFixedPositions.cols( );
+    potentials.resize( numberOfPoints );
+    gradients.resize( 3, numberOfPoints );
+
+    if( backend == cuda_batch_evaluation )
+    {
+        evaluatePotentialAndGradientPointwise(
+                    bodyFixedPositions, gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients,
+                    numberOfThreads, potentials.data( ), gradients );
+        return;
+    }
+
+    // Compute distance, sine of latitude and longitude of each point
+    std::vector< double > distances( numberOfPoints );
+    std::vector< double > sinesOfLatitude( numberOfPoints );
+    std::vector< double > longitudes( numberOfPoints );
+    for( int i = 0; i < numberOfPoints; i++ )
+    {
+        Eigen::Vector3d sphericalPosition = coordinate_conversions::convertCartesianToSpherical(
+                    Eigen::Vector3d( bodyFixedPositions.col( i ) ) );
+        distances[ i ] = sphericalPosition( 0 );
+        sinesOfLatitude[ i ] = std::sin( mathematical_constants::PI / 2.0 - sphericalPosition( 1 ) );
+        longitudes[ i ] = sphericalPosition( 2 );
+    }
+
+    // Sort points by distance and latitude, and group points with identical distance and latitude into rings
+    std::vector< int > sortedPointIndices( numberOfPoints );
+    std::iota( sortedPointIndices.begin( ), sortedPointIndices.end( ), 0 );
+    std::sort( sortedPointIndices.begin( ), sortedPointIndices.end( ), [ & ]( const int first, const int second )
+    {
+        return ( distances[ first ] < distances[ second ] ) ||
+                ( distances[ first ] == distances[ second ] && sinesOfLatitude[ first ] < sinesOfLatitude[ second ] );
+    } );
+
+    std::vector< SphericalHarmonicsEvaluationRing > rings;
+    for( int i = 0; i < numberOfPoints; i++ )
+    {
+        const int pointIndex = sortedPointIndices[ i ];
+        if( rings.empty( ) ||
+                distances[ pointIndex ] != rings.back( ).distance ||
+                sinesOfLatitude[ pointIndex ] != rings.back( ).sineOfLatitude )
+        {
+            rings.push_back( SphericalHarmonicsEvaluationRing{
+                                 distances[ pointIndex ], sinesOfLatitude[ pointIndex ], i, 0 } );
+        }
+        rings.back( ).numberOfPoints++;
+    }
+
+    evaluatePotentialAndGradientOnRingsInParallel(
+                rings, sortedPointIndices, bodyFixedPositions, longitudes, gravitationalParameter, referenceRadius,
+                cosineCoefficients, sineCoefficients, numberOfThreads, recursionType, potentials.data( ), gradients );
+}
+
+//! Function to compute the potential and its gradient of a geodesy-normalized spherical harmonic field on a regular grid
+void computeGeodesyNormalizedPotentialAndGradientOnGrid(
+        const double distance,
+        const Eigen::VectorXd& latitudes,
+        const Eigen::VectorXd& longitudes,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const Eigen::MatrixXd& cosineCoefficients,
+        const Eigen::MatrixXd& sineCoefficients,
+        Eigen::MatrixXd& potentials,
+        Eigen::Matrix3Xd& gradients,
+        const int numberOfThreads,
+        const basic_mathematics::LegendreRecursionType recursionType,
+        const SphericalHarmonicsBatchEvaluationBackend backend )
+{
+    const int numberOfLatitudes = latitudes.rows( );
+    const int numberOfLongitudes = longitudes.rows( );
+    const int numberOfPoints = numberOfLatitudes * numberOfLongitudes;
+    potentials.resize( numberOfLatitudes, numberOfLongitudes );
+    gradients.resize( 3, numberOfPoints );
+
+    // Define points (in order of storage of potentials matrix) and one ring per latitude
+    Eigen::Matrix3Xd bodyFixedPositions( 3, numberOfPoints );
+    std::vector< double > pointLongitudes( numberOfPoints );
+    std::vector< int > sortedPointIndices( numberOfPoints );
+    std::vector< SphericalHarmonicsEvaluationRing > rings( numberOfLatitudes );
+    for( int i = 0; i < numberOfLatitudes; i++ )
+    {
+        rings[ i ] = SphericalHarmonicsEvaluationRing{
+                distance, std::sin( latitudes( i ) ), i * numberOfLongitudes, numberOfLongitudes };
+        for( int j = 0; j < numberOfLongitudes; j++ )
+        {
+            const int pointIndex = i + j * numberOfLatitudes;
+            bodyFixedPositions.col( pointIndex ) =
+                    distance * Eigen::Vector3d( std::cos( latitudes( i ) ) * std::cos( longitudes( j ) ),
+                                                std::cos( latitudes( i ) ) * std::sin( longitudes( j ) ),
+                                                std::sin( latitudes( i ) ) );
+            pointLongitudes[ pointIndex ] = longitudes( j );
+            sortedPointIndices[ i * numberOfLongitudes + j ] = pointIndex;
+        }
+    }
+
+    if( backend == cuda_batch_evaluation )
+    {
+        evaluatePotentialAndGradientPointwise(
+                    bodyFixedPositions, gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients,
+                    numberOfThreads, potentials.data( ), gradients );
+        return;
+    }
+
+    evaluatePotentialAndGradientOnRingsInParallel(
+                rings, sortedPointIndices, bodyFixedPositions, pointLongitudes, gravitationalParameter, referenceRadius,
+                cosineCoefficients, sineCoefficients, numberOfThreads, recursionType, potentials.data( ), gradients );
+}
+
+} // namespace gravitation
+
+} // namespace tudat
@@ -0,0 +1,168 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <stdexcept>
+#include <string>
+
+#include <cuda_runtime.h>
+
+#include "tudat/astro/gravitation/sphericalHarmonicsDeviceEvaluation.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Function to throw an exception if a CUDA runtime call failed
+void checkCudaError( const cudaError_t error, const std::string& operation )
+{
+    if( error != cudaSuccess )
+    {
+        throw std::runtime_error( "Error when evaluating spherical harmonic field on CUDA device, " + operation +
+                                  " failed: " + std::string( cudaGetErrorString( error ) ) );
+    }
+}
+
+//! Array in device memory, released on destruction
+template< typename ScalarType >
+class DeviceArray
+{
+public:
+
+    //! Constructor, allocates the array (and copies the host data to it, if provided)
+    DeviceArray( const int size, const ScalarType* hostData = nullptr ):
+        size_( size ), data_( nullptr )
+    {
+        checkCudaError( cudaMalloc( &data_, sizeof( ScalarType ) * size_ ), "memory allocation" );
+        if( hostData != nullptr )
+        {
+            checkCudaError( cudaMemcpy( data_, hostData, sizeof( ScalarType ) * size_, cudaMemcpyHostToDevice ),
+                            "copy to device" );
+        }
+    }
+
+    //! Destructor, releases the array
+    ~DeviceArray( )
+    {
+        cudaFree( data_ );
+    }
+
+    DeviceArray( const DeviceArray& ) = delete;
+
+    DeviceArray& operator=( const DeviceArray& ) = delete;
+
+    //! Function to copy the contents of the array to host memory
+    void copyToHost( ScalarType* hostData ) const
+    {
+        checkCudaError( cudaMemcpy( hostData, data_, sizeof( ScalarType ) * size_, cudaMemcpyDeviceToHost ),
+                        "copy to host" );
+    }
+
+    //! Function to retrieve the device pointer to the array
+    ScalarType* data( ) const
+    {
+        return data_;
+    }
+
+private:
+
+    //! Number of entries in the array
+    int size_;
+
+    //! Device pointer to the array
+    ScalarType* data_;
+};
+
+//! Kernel evaluating the potential and its gradient at a single point per thread
+/*!
+ *  Kernel evaluating the potential and its gradient at a single point per thread, using
+ *  computeGeodesyNormalizedPotentialAndGradientAtSinglePoint. Input and output as in
+ *  computeGeodesyNormalizedPotentialAndGradientOnDevice.
+ */
+__global__ void computeGeodesyNormalizedPotentialAndGradientKernel(
+        const double* bodyFixedPositions,
+        const int numberOfPoints,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const int maximumDegree,
+        const int maximumOrder,
+        const double* cosineCoefficients,
+        const double* sineCoefficients,
+        const int* orderOffsets,
+        const double* firstRecursionCoefficients,
+        const double* secondRecursionCoefficients,
+        const double* derivativeCoefficients,
+        double* potentials,
+        double* gradients )
+{
+    const int pointIndex = blockIdx.x * blockDim.x + threadIdx.x;
+    if( pointIndex >= numberOfPoints )
+    {
+        return;
+    }
+
+    computeGeodesyNormalizedPotentialAndGradientAtSinglePoint(
+                bodyFixedPositions + 3 * pointIndex, gravitationalParameter, referenceRadius, maximumDegree,
+                maximumOrder, cosineCoefficients, sineCoefficients, orderOffsets, firstRecursionCoefficients,
+                secondRecursionCoefficients, derivativeCoefficients, potentials[ pointIndex ],
+                gradients + 3 * pointIndex );
+}
+
+//! Function to compute the potential and its gradient of a geodesy-normalized spherical harmonic field on a CUDA device
+void computeGeodesyNormalizedPotentialAndGradientOnDevice(
+        const double* bodyFixedPositions,
+        const int numberOfPoints,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const int maximumDegree,
+        const int maximumOrder,
+        const double* cosineCoefficients,
+        const double* sineCoefficients,
+        const int* orderOffsets,
+        const double* firstRecursionCoefficients,
+        const double* secondRecursionCoefficients,
+        const double* derivativeCoefficients,
+        double* potentials,
+        double* gradients )
+{
+    if( numberOfPoints == 0 )
+    {
+        return;
+    }
+
+    const int numberOfCoefficients = orderOffsets[ maximumOrder + 1 ];
+    DeviceArray< double > devicePositions( 3 * numberOfPoints, bodyFixedPositions );
+    DeviceArray< double > deviceCosineCoefficients( numberOfCoefficients, cosineCoefficients );
+    DeviceArray< double > deviceSineCoefficients( numberOfCoefficients, sineCoefficients );
+    DeviceArray< int > deviceOrderOffsets( maximumOrder + 2, orderOffsets );
+    DeviceArray< double > deviceFirstRecursionCoefficients( numberOfCoefficients, firstRecursionCoefficients );
+    DeviceArray< double > deviceSecondRecursionCoefficients( numberOfCoefficients, secondRecursionCoefficients );
+    DeviceArray< double > deviceDerivativeCoefficients( numberOfCoefficients, derivativeCoefficients );
+    DeviceArray< double > devicePotentials( numberOfPoints );
+    DeviceArray< double > deviceGradients( 3 * numberOfPoints );
+
+    const int threadsPerBlock = 128;
+    const int numberOfBlocks = ( numberOfPoints + threadsPerBlock - 1 ) / threadsPerBlock;
+    computeGeodesyNormalizedPotentialAndGradientKernel<<< numberOfBlocks, threadsPerBlock >>>(
+            devicePositions.data( ), numberOfPoints, gravitationalParameter, referenceRadius, maximumDegree,
+            maximumOrder, deviceCosineCoefficients.data( ), deviceSineCoefficients.data( ), deviceOrderOffsets.data( ),
+            deviceFirstRecursionCoefficients.data( ), deviceSecondRecursionCoefficients.data( ),
+            deviceDerivativeCoefficients.data( ), devicePotentials.data( ), deviceGradients.data( ) );
+    checkCudaError( cudaGetLastError( ), "kernel launch" );
+    checkCudaError( cudaDeviceSynchronize( ), "kernel execution" );
+
+    devicePotentials.copyToHost( potentials );
+    deviceGradients.copyToHost( gradients );
+}
+
+} // namespace gravitation
+
+} // namespace tudat
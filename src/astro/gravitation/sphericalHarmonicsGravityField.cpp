@@ -18,6 +18,7 @@
 
 #include "tudat/astro/basic_astro/physicalConstants.h"
 #include "tudat/astro/gravitation/sphericalHarmonicsGravityField.h"
+#include "tudat/astro/gravitation/sphericalHarmonicsSummationKernels.h"
 #include "tudat/math/basic/coordinateConversions.h"
 #include "tudat/math/basic/basicMathematicsFunctions.h"
 #include "tudat/math/basic/legendrePolynomials.h"
@@ -46,6 +47,17 @@ Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSum(
         const bool saveSeparateTerms,
         const Eigen::Matrix3d& accelerationRotation )
 {
+    // Use Cartesian formulation, without conversion to spherical coordinates, if requested (not available when saving
+    // separate terms)
+    if( !saveSeparateTerms && sphericalHarmonicsCache->getSummationType( ) ==
+            basic_mathematics::cartesian_spherical_harmonics_summation )
+    {
+        return accelerationRotation * computeGeodesyNormalizedCartesianGradient(
+                    positionOfBodySubjectToAcceleration, gravitationalParameter, equatorialRadius,
+                    cosineHarmonicCoefficients, sineHarmonicCoefficients,
+                    *( sphericalHarmonicsCache->getCartesianRecursion( ) ) );
+    }
+
     // Set highest degree and order.
     const int highestDegree = cosineHarmonicCoefficients.rows( );
     const int highestOrder = cosineHarmonicCoefficients.cols( );
@@ -74,6 +86,18 @@ Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSum(
     Eigen::Matrix3d transformationToCartesianCoordinates = coordinate_conversions::getSphericalToCartesianGradientMatrix(
                 positionOfBodySubjectToAcceleration );
 
+    // Sum all orders of each degree at once, if requested (not available when saving separate terms)
+    if( !saveSeparateTerms && sphericalHarmonicsCache->getSummationType( ) !=
+            basic_mathematics::standard_spherical_harmonics_summation )
+    {
+        sphericalGradient = computeGeodesyNormalizedSphericalGradientPerDegree(
+                    sphericalpositionOfBodySubjectToAcceleration( 0 ), preMultiplier,
+                    cosineHarmonicCoefficients, sineHarmonicCoefficients, *sphericalHarmonicsCache,
+                    sphericalHarmonicsCache->getSummationType( ) ==
+                    basic_mathematics::vectorized_spherical_harmonics_summation );
+        return accelerationRotation * ( transformationToCartesianCoordinates * sphericalGradient );
+    }
+
     // Loop through all degrees.
     for ( int degree = 0; degree < highestDegree; degree++ )
     {
@@ -0,0 +1,388 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include "tudat/astro/gravitation/sphericalHarmonicsSummationKernels.h"
+
+// SIMD kernels are compiled for x86 with GCC/Clang, using function-specific target attributes, so that they can be
+// selected at run time without compiling the rest of Tudat for a specific instruction set.
+#if ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define TUDAT_SPHERICAL_HARMONICS_SIMD_KERNELS 1
+#include <immintrin.h>
+#else
+#define TUDAT_SPHERICAL_HARMONICS_SIMD_KERNELS 0
+#endif
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Instruction sets for which the spherical harmonics summation is implemented
+enum SphericalHarmonicsInstructionSet
+{
+    scalar_instruction_set,
+    avx2_instruction_set,
+    avx512_instruction_set
+};
+
+//! Function to detect the widest instruction set for the spherical harmonics summation that is supported by the machine
+SphericalHarmonicsInstructionSet detectSphericalHarmonicsInstructionSet( )
+{
+#if TUDAT_SPHERICAL_HARMONICS_SIMD_KERNELS
+    __builtin_cpu_init( );
+    if( __builtin_cpu_supports( "avx512f" ) )
+    {
+        return avx512_instruction_set;
+    }
+    else if( __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" ) )
+    {
+        return avx2_instruction_set;
+    }
+#endif
+    return scalar_instruction_set;
+}
+
+//! Function to retrieve the widest instruction set for the spherical harmonics summation (detected once)
+SphericalHarmonicsInstructionSet getSphericalHarmonicsInstructionSet( )
+{
+    static const SphericalHarmonicsInstructionSet instructionSet = detectSphericalHarmonicsInstructionSet( );
+    return instructionSet;
+}
+
+//! Function to retrieve the name of the instruction set used for the vectorized spherical harmonics summation
+std::string getVectorizedSphericalHarmonicsInstructionSet( )
+{
+    switch( getSphericalHarmonicsInstructionSet( ) )
+    {
+    case avx512_instruction_set:
+        return "avx512";
+    case avx2_instruction_set:
+        return "avx2";
+    default:
+        return "scalar";
+    }
+}
+
+//! Function to sum the terms of a range of orders of a single degree, using scalar instructions
+void sumGeodesyNormalizedGradientTermsScalar(
+        const double* legendrePolynomials,
+        const double* legendrePolynomialDerivatives,
+        const double* cosineCoefficients,
+        const double* sineCoefficients,
+        const double* cosinesOfLongitude,
+        const double* sinesOfLongitude,
+        const int startOrder,
+        const int numberOfOrders,
+        double& radialSum,
+        double& latitudinalSum,
+        double& longitudinalSum )
+{
+    for( int order = startOrder; order < numberOfOrders; order++ )
+    {
+        const double cosineTerm = cosineCoefficients[ order ] * cosinesOfLongitude[ order ] +
+                sineCoefficients[ order ] * sinesOfLongitude[ order ];
+        const double sineTerm = sineCoefficients[ order ] * cosinesOfLongitude[ order ] -
+                cosineCoefficients[ order ] * sinesOfLongitude[ order ];
+        radialSum += legendrePolynomials[ order ] * cosineTerm;
+        latitudinalSum += legendrePolynomialDerivatives[ order ] * cosineTerm;
+        longitudinalSum += static_cast< double >( order ) * legendrePolynomials[ order ] * sineTerm;
+    }
+}
+
+#if TUDAT_SPHERICAL_HARMONICS_SIMD_KERNELS
+
+//! Function to sum the terms of all orders of a single degree, using AVX2/FMA instructions
+__attribute__( ( target( "avx2,fma" ) ) )
+void sumGeodesyNormalizedGradientTermsAvx2(
+        const double* legendrePolynomials,
+        const double* legendrePolynomialDerivatives,
+        const double* cosineCoefficients,
+        const double* sineCoefficients,
+        const double* cosinesOfLongitude,
+        const double* sinesOfLongitude,
+        const int numberOfOrders,
+        double& radialSum,
+        double& latitudinalSum,
+        double& longitudinalSum )
+{
+    __m256d radialTerms = _mm256_setzero_pd( );
+    __m256d latitudinalTerms = _mm256_setzero_pd( );
+    __m256d longitudinalTerms = _mm256_setzero_pd( );
+    __m256d orders = _mm256_set_pd( 3.0, 2.0, 1.0, 0.0 );
+    const __m256d orderIncrement = _mm256_set1_pd( 4.0 );
+
+    int order = 0;
+    for( ; order + 4 <= numberOfOrders; order += 4 )
+    {
+        const __m256d cosineCoefficient = _mm256_loadu_pd( cosineCoefficients + order );
+        const __m256d sineCoefficient = _mm256_loadu_pd( sineCoefficients + order );
+        const __m256d cosineOfLongitude = _mm256_loadu_pd( cosinesOfLongitude + order );
+        const __m256d sineOfLongitude = _mm256_loadu_pd( sinesOfLongitude + order );
+        const __m256d legendrePolynomial = _mm256_loadu_pd( legendrePolynomials + order );
+
+        const __m256d cosineTerm = _mm256_fmadd_pd(
+                    cosineCoefficient, cosineOfLongitude, _mm256_mul_pd( sineCoefficient, sineOfLongitude ) );
+        const __m256d sineTerm = _mm256_fmsub_pd(
+                    sineCoefficient, cosineOfLongitude, _mm256_mul_pd( cosineCoefficient, sineOfLongitude ) );
+
+        radialTerms = _mm256_fmadd_pd( legendrePolynomial, cosineTerm, radialTerms );
+        latitudinalTerms = _mm256_fmadd_pd(
+                    _mm256_loadu_pd( legendrePolynomialDerivatives + order ), cosineTerm, latitudinalTerms );
+        longitudinalTerms = _mm256_fmadd_pd( _mm256_mul_pd( orders, legendrePolynomial ), sineTerm, longitudinalTerms );
+        orders = _mm256_add_pd( orders, orderIncrement );
+    }
+
+    double radialTermsArray[ 4 ], latitudinalTermsArray[ 4 ], longitudinalTermsArray[ 4 ];
+    _mm256_storeu_pd( radialTermsArray, radialTerms );
+    _mm256_storeu_pd( latitudinalTermsArray, latitudinalTerms );
+    _mm256_storeu_pd( longitudinalTermsArray, longitudinalTerms );
+    for( int i = 0; i < 4; i++ )
+    {
+        radialSum += radialTermsArray[ i ];
+        latitudinalSum += latitudinalTermsArray[ i ];
+        longitudinalSum += longitudinalTermsArray[ i ];
+    }
+
+    sumGeodesyNormalizedGradientTermsScalar(
+                legendrePolynomials, legendrePolynomialDerivatives, cosineCoefficients, sineCoefficients,
+                cosinesOfLongitude, sinesOfLongitude, order, numberOfOrders, radialSum, latitudinalSum, longitudinalSum );
+}
+
+//! Function to sum the terms of all orders of a single degree, using AVX-512 instructions
+__attribute__( ( target( "avx512f" ) ) )
+void sumGeodesyNormalizedGradientTermsAvx512(
+        const double* legendrePolynomials,
+        const double* legendrePolynomialDerivatives,
+        const double* cosineCoefficients,
+        const double* sineCoefficients,
+        const double* cosinesOfLongitude,
+        const double* sinesOfLongitude,
+        const int numberOfOrders,
+        double& radialSum,
+        double& latitudinalSum,
+        double& longitudinalSum )
+{
+    __m512d radialTerms = _mm512_setzero_pd( );
+    __m512d latitudinalTerms = _mm512_setzero_pd( );
+    __m512d longitudinalTerms = _mm512_setzero_pd( );
+    __m512d orders = _mm512_set_pd( 7.0, 6.0, 5.0, 4.0, 3.0, 2.0, 1.0, 0.0 );
+    const __m512d orderIncrement = _mm512_set1_pd( 8.0 );
+
+    int order = 0;
+    for( ; order + 8 <= numberOfOrders; order += 8 )
+    {
+        const __m512d cosineCoefficient = _mm512_loadu_pd( cosineCoefficients + order );
+        const __m512d sineCoefficient = _mm512_loadu_pd( sineCoefficients + order );
+        const __m512d cosineOfLongitude = _mm512_loadu_pd( cosinesOfLongitude + order );
+        const __m512d sineOfLongitude = _mm512_loadu_pd( sinesOfLongitude + order );
+        const __m512d legendrePolynomial = _mm512_loadu_pd( legendrePolynomials + order );
+
+        const __m512d cosineTerm = _mm512_fmadd_pd(
+                    cosineCoefficient, cosineOfLongitude, _mm512_mul_pd( sineCoefficient, sineOfLongitude ) );
+        const __m512d sineTerm = _mm512_fmsub_pd(
+                    sineCoefficient, cosineOfLongitude, _mm512_mul_pd( cosineCoefficient, sineOfLongitude ) );
+
+        radialTerms = _mm512_fmadd_pd( legendrePolynomial, cosineTerm, radialTerms );
+        latitudinalTerms = _mm512_fmadd_pd(
+                    _mm512_loadu_pd( legendrePolynomialDerivatives + order ), cosineTerm, latitudinalTerms );
+        longitudinalTerms = _mm512_fmadd_pd( _mm512_mul_pd( orders, legendrePolynomial ), sineTerm, longitudinalTerms );
+        orders = _mm512_add_pd( orders, orderIncrement );
+    }
+
+    radialSum += _mm512_reduce_add_pd( radialTerms );
+    latitudinalSum += _mm512_reduce_add_pd( latitudinalTerms );
+    longitudinalSum += _mm512_reduce_add_pd( longitudinalTerms );
+
+    sumGeodesyNormalizedGradientTermsScalar(
+                legendrePolynomials, legendrePolynomialDerivatives, cosineCoefficients, sineCoefficients,
+                cosinesOfLongitude, sinesOfLongitude, order, numberOfOrders, radialSum, latitudinalSum, longitudinalSum );
+}
+
+#endif
+
+//! Function to sum the terms of all orders of a single degree of a geodesy-normalized spherical harmonic gradient
+void sumGeodesyNormalizedGradientTermsOfDegree(
+        const double* legendrePolynomials,
+        const double* legendrePolynomialDerivatives,
+        const double* cosineCoefficients,
+        const double* sineCoefficients,
+        const double* cosinesOfLongitude,
+        const double* sinesOfLongitude,
+        const int numberOfOrders,
+        const bool useVectorization,
+        double& radialSum,
+        double& latitudinalSum,
+        double& longitudinalSum )
+{
+    radialSum = 0.0;
+    latitudinalSum = 0.0;
+    longitudinalSum = 0.0;
+
+#if TUDAT_SPHERICAL_HARMONICS_SIMD_KERNELS
+    if( useVectorization )
+    {
+        switch( getSphericalHarmonicsInstructionSet( ) )
+        {
+        case avx512_instruction_set:
+            sumGeodesyNormalizedGradientTermsAvx512(
+                        legendrePolynomials, legendrePolynomialDerivatives, cosineCoefficients, sineCoefficients,
+                        cosinesOfLongitude, sinesOfLongitude, numberOfOrders, radialSum, latitudinalSum, longitudinalSum );
+            return;
+        case avx2_instruction_set:
+            sumGeodesyNormalizedGradientTermsAvx2(
+                        legendrePolynomials, legendrePolynomialDerivatives, cosineCoefficients, sineCoefficients,
+                        cosinesOfLongitude, sinesOfLongitude, numberOfOrders, radialSum, latitudinalSum, longitudinalSum );
+            return;
+        default:
+            break;
+        }
+    }
+#endif
+
+    sumGeodesyNormalizedGradientTermsScalar(
+                legendrePolynomials, legendrePolynomialDerivatives, cosineCoefficients, sineCoefficients,
+                cosinesOfLongitude, sinesOfLongitude, 0, numberOfOrders, radialSum, latitudinalSum, longitudinalSum );
+}
+
+//! Function to compute the spherical gradient of a geodesy-normalized spherical harmonic potential, degree by degree
+Eigen::Vector3d computeGeodesyNormalizedSphericalGradientPerDegree(
+        const double distance,
+        const double preMultiplier,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients,
+        basic_mathematics::SphericalHarmonicsCache& sphericalHarmonicsCache,
+        const bool useVectorization )
+{
+    const int highestDegree = cosineHarmonicCoefficients.rows( );
+    const int highestOrder = cosineHarmonicCoefficients.cols( );
+
+    basic_mathematics::LegendreCache& legendreCache = *sphericalHarmonicsCache.getLegendreCache( );
+    if( highestDegree - 1 > legendreCache.getMaximumDegree( ) ||
+            std::min( highestDegree, highestOrder ) - 1 > legendreCache.getMaximumOrder( ) )
+    {
+        throw std::runtime_error( "Error when computing spherical harmonic gradient per degree, maximum degree or order of "
+                                  "cache exceeded" );
+    }
+
+    const double* cosinesOfLongitude = sphericalHarmonicsCache.getCosinesOfMultipleLongitude( );
+    const double* sinesOfLongitude = sphericalHarmonicsCache.getSinesOfMultipleLongitude( );
+    const double cosineOfLatitude = legendreCache.getCurrentPolynomialParameterComplement( );
+
+    // Coefficients of a single degree are copied to contiguous memory (matrices are stored column-major)
+    thread_local std::vector< double > cosineCoefficientsOfDegree;
+    thread_local std::vector< double > sineCoefficientsOfDegree;
+    if( static_cast< int >( cosineCoefficientsOfDegree.size( ) ) < highestOrder )
+    {
+        cosineCoefficientsOfDegree.resize( highestOrder );
+        sineCoefficientsOfDegree.resize( highestOrder );
+    }
+
+    Eigen::Vector3d sphericalGradient = Eigen::Vector3d::Zero( );
+    double radialSum, latitudinalSum, longitudinalSum;
+    for( int degree = 0; degree < highestDegree; degree++ )
+    {
+        const int numberOfOrders = std::min( degree + 1, highestOrder );
+        for( int order = 0; order < numberOfOrders; order++ )
+        {
+            cosineCoefficientsOfDegree[ order ] = cosineHarmonicCoefficients( degree, order );
+            sineCoefficientsOfDegree[ order ] = sineHarmonicCoefficients( degree, order );
+        }
+
+        sumGeodesyNormalizedGradientTermsOfDegree(
+                    legendreCache.getLegendrePolynomialValuesOfDegree( degree ),
+                    legendreCache.getLegendrePolynomialDerivativeValuesOfDegree( degree ),
+                    cosineCoefficientsOfDegree.data( ), sineCoefficientsOfDegree.data( ),
+                    cosinesOfLongitude, sinesOfLongitude, numberOfOrders, useVectorization,
+                    radialSum, latitudinalSum, longitudinalSum );
+
+        const double radiusPowerTerm = preMultiplier * sphericalHarmonicsCache.getReferenceRadiusRatioPowers( degree + 1 );
+        sphericalGradient( basic_mathematics::radiusIndex ) -=
+                radiusPowerTerm / distance * ( static_cast< double >( degree ) + 1.0 ) * radialSum;
+        sphericalGradient( basic_mathematics::latitudeIndex ) += radiusPowerTerm * cosineOfLatitude * latitudinalSum;
+        sphericalGradient( basic_mathematics::longitudeIndex ) += radiusPowerTerm * longitudinalSum;
+    }
+
+    return sphericalGradient;
+}
+
+//! Function to compute the gradient of a geodesy-normalized spherical harmonic potential in Cartesian coordinates
+Eigen::Vector3d computeGeodesyNormalizedCartesianGradient(
+        const Eigen::Vector3d& position,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients,
+        basic_mathematics::CartesianSphericalHarmonicsRecursion& cartesianRecursion )
+{
+    // Terms up to one degree and order above those of the coefficients are required.
+    const int numberOfDegrees = cosineHarmonicCoefficients.rows( );
+    const int numberOfOrders = std::min< int >( cosineHarmonicCoefficients.cols( ), numberOfDegrees );
+    if( cartesianRecursion.getMaximumDegree( ) < numberOfDegrees ||
+            cartesianRecursion.getMaximumOrder( ) < numberOfOrders )
+    {
+        cartesianRecursion.resetMaximumDegreeAndOrder(
+                    std::max( numberOfDegrees, cartesianRecursion.getMaximumDegree( ) ),
+                    std::max( numberOfOrders, cartesianRecursion.getMaximumOrder( ) ) );
+    }
+    cartesianRecursion.update( position, referenceRadius );
+
+    const double* realTerms = cartesianRecursion.getRealTerms( );
+    const double* imaginaryTerms = cartesianRecursion.getImaginaryTerms( );
+
+    double xGradient = 0.0;
+    double yGradient = 0.0;
+    double zGradient = 0.0;
+    for( int degree = 0; degree < numberOfDegrees; degree++ )
+    {
+        // Index of term of degree + 1 and order 0
+        const int nextDegreeIndex = ( degree + 1 ) * ( degree + 2 ) / 2;
+        for( int order = 0; order <= degree && order < numberOfOrders; order++ )
+        {
+            const double cosineCoefficient = cosineHarmonicCoefficients( degree, order );
+            const double sineCoefficient = sineHarmonicCoefficients( degree, order );
+            const double* gradientFactors = cartesianRecursion.getPotentialGradientFactors( degree, order );
+
+            const int higherOrderIndex = nextDegreeIndex + order + 1;
+            xGradient -= gradientFactors[ 0 ] * (
+                        cosineCoefficient * realTerms[ higherOrderIndex ] +
+                        sineCoefficient * imaginaryTerms[ higherOrderIndex ] );
+            yGradient -= gradientFactors[ 0 ] * (
+                        cosineCoefficient * imaginaryTerms[ higherOrderIndex ] -
+                        sineCoefficient * realTerms[ higherOrderIndex ] );
+            if( order > 0 )
+            {
+                const int lowerOrderIndex = nextDegreeIndex + order - 1;
+                xGradient += gradientFactors[ 1 ] * (
+                            cosineCoefficient * realTerms[ lowerOrderIndex ] +
+                            sineCoefficient * imaginaryTerms[ lowerOrderIndex ] );
+                yGradient -= gradientFactors[ 1 ] * (
+                            cosineCoefficient * imaginaryTerms[ lowerOrderIndex ] -
+                            sineCoefficient * realTerms[ lowerOrderIndex ] );
+            }
+
+            const int sameOrderIndex = nextDegreeIndex + order;
+            zGradient -= gradientFactors[ 2 ] * (
+                        cosineCoefficient * realTerms[ sameOrderIndex ] +
+                        sineCoefficient * imaginaryTerms[ sameOrderIndex ] );
+        }
+    }
+
+    return gravitationalParameter / ( referenceRadius * referenceRadius ) *
+            Eigen::Vector3d( xGradient, yGradient, zGradient );
+}
+
+} // namespace gravitation
+
+} // namespace tudat
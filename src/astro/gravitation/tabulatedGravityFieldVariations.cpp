@@ -115,6 +115,20 @@ calculateSphericalHarmonicsCorrections(
                            cosineSinePair.block( 0, numberOfOrders_, numberOfDegrees_, numberOfOrders_ ) );
 }
 
+//! Function for calculating corrections by interpolating tabulated corrections, into existing matrices.
+void TabulatedGravityFieldVariations::calculateSphericalHarmonicsCorrectionBlocks(
+        const double time,
+        Eigen::MatrixXd& cosineCorrections,
+        Eigen::MatrixXd& sineCorrections )
+{
+    // Interpolate corrections
+    interpolatedCosineSinePair_ = variationInterpolator_->interpolate( time );
+
+    // Split interpolated concatenated matrix into output.
+    cosineCorrections = interpolatedCosineSinePair_.block( 0, 0, numberOfDegrees_, numberOfOrders_ );
+    sineCorrections = interpolatedCosineSinePair_.block( 0, numberOfOrders_, numberOfDegrees_, numberOfOrders_ );
+}
+
 } // namespace gravitation
 
 } // namespace tudat
@@ -27,6 +27,8 @@ void TimeDependentSphericalHarmonicsGravityField::setFieldVariationSettings(
 {
     // Set new variation set.
     gravityFieldVariationsSet_ = gravityFieldVariationUpdateSettings;
+    resetAllCoefficients_ = true;
+    currentTime_ = TUDAT_NAN;
 
     // Update correction functions if necessary.
     if( updateCorrections )
@@ -40,22 +42,55 @@ void TimeDependentSphericalHarmonicsGravityField::clearVariations( )
 {
     gravityFieldVariationsSet_ = std::shared_ptr< GravityFieldVariationsSet >( );
     correctionFunctions_.clear( );
+    areVariationsTimeDependentOnly_ = true;
+    resetAllCoefficients_ = true;
+    currentTime_ = TUDAT_NAN;
 }
 
 
 //! Update gravity field to current time.
 void TimeDependentSphericalHarmonicsGravityField::update( const double time )
 {
-    // Initialize current coefficients to nominal values.
-    sineCoefficients_ = nominalSineCoefficients_;
-    cosineCoefficients_ = nominalCosineCoefficients_;
+    // Skip update if coefficients are already computed at current time
+    if( areVariationsTimeDependentOnly_ && ( time == currentTime_ ) )
+    {
+        return;
+    }
+
+    // Initialize current coefficients to nominal values: all of them if required (sharing the storage of the nominal
+    // coefficients until a correction is added), otherwise only the block that is modified by the corrections.
+    if( resetAllCoefficients_ || ( sineCoefficients_.rows( ) != nominalSineCoefficients_.rows( ) ) ||
+            ( sineCoefficients_.cols( ) != nominalSineCoefficients_.cols( ) ) ||
+            ( cosineCoefficients_.rows( ) != nominalCosineCoefficients_.rows( ) ) ||
+            ( cosineCoefficients_.cols( ) != nominalCosineCoefficients_.cols( ) ) )
+    {
+        sineCoefficients_ = nominalSineCoefficients_;
+        cosineCoefficients_ = nominalCosineCoefficients_;
+        resetAllCoefficients_ = false;
+    }
+    else if( maximumVariationDegree_ >= 0 && maximumVariationOrder_ >= 0 )
+    {
+        const int numberOfRows = std::min< int >( maximumVariationDegree_ + 1, nominalCosineCoefficients_.rows( ) );
+        const int numberOfColumns = std::min< int >( maximumVariationOrder_ + 1, nominalCosineCoefficients_.cols( ) );
+        if( !sineCoefficients_.sharesStorageWith( nominalSineCoefficients_ ) )
+        {
+            sineCoefficients_.getMutableMatrix( ).block( 0, 0, numberOfRows, numberOfColumns ) =
+                    nominalSineCoefficients_.block( 0, 0, numberOfRows, numberOfColumns );
+        }
+        if( !cosineCoefficients_.sharesStorageWith( nominalCosineCoefficients_ ) )
+        {
+            cosineCoefficients_.getMutableMatrix( ).block( 0, 0, numberOfRows, numberOfColumns ) =
+                    nominalCosineCoefficients_.block( 0, 0, numberOfRows, numberOfColumns );
+        }
+    }
 
     // Iterate over all corrections.
     for( unsigned int i = 0; i < correctionFunctions_.size( ); i++ )
     {
         // Add correction of this iteration to current coefficients.
-        correctionFunctions_[ i ]( time, sineCoefficients_, cosineCoefficients_ );
+        correctionFunctions_[ i ]( time, sineCoefficients_.getMutableMatrix( ), cosineCoefficients_.getMutableMatrix( ) );
     }
+    currentTime_ = time;
 }
 
 } // namespace gravitation
@@ -0,0 +1,93 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include "tudat/astro/ground_stations/bodyDeformationModel.h"
+
+namespace tudat
+{
+
+namespace ground_stations
+{
+
+//! Function to create a tabulated version of a station motion model, if it is a body deformation motion model
+std::shared_ptr< StationMotionModel > getTabulatedBodyDeformationStationMotion(
+        const std::shared_ptr< StationMotionModel > stationMotionModel,
+        const std::shared_ptr< GroundStationState > groundStationState,
+        const double startTime,
+        const double endTime,
+        const double timeStep,
+        const int numberOfInterpolationPoints )
+{
+    // Retrieve original model, if already tabulated
+    std::shared_ptr< StationMotionModel > originalModel = stationMotionModel;
+    if( std::dynamic_pointer_cast< TabulatedStationMotionModel >( stationMotionModel ) != nullptr )
+    {
+        originalModel = std::dynamic_pointer_cast< TabulatedStationMotionModel >( stationMotionModel )->getOriginalModel( );
+    }
+
+    std::shared_ptr< BodyDeformationStationMotionModel > bodyDeformationModel =
+            std::dynamic_pointer_cast< BodyDeformationStationMotionModel >( originalModel );
+    if( bodyDeformationModel == nullptr )
+    {
+        return nullptr;
+    }
+    else if( bodyDeformationModel->getBodyDeformationModels( ).size( ) == 0 )
+    {
+        return bodyDeformationModel;
+    }
+    else
+    {
+        return std::make_shared< TabulatedStationMotionModel >(
+                    bodyDeformationModel, groundStationState, startTime, endTime, timeStep, numberOfInterpolationPoints );
+    }
+}
+
+//! Function to replace the body deformation motion of a ground station by values tabulated over a given interval
+bool tabulateBodyDeformationStationMotion(
+        const std::shared_ptr< GroundStationState > groundStationState,
+        const double startTime,
+        const double endTime,
+        const double timeStep,
+        const int numberOfInterpolationPoints )
+{
+    bool isBodyDeformationFound = false;
+
+    std::shared_ptr< StationMotionModel > stationMotionModel = groundStationState->getStationMotionModel( );
+    std::shared_ptr< StationMotionModel > tabulatedModel = getTabulatedBodyDeformationStationMotion(
+                stationMotionModel, groundStationState, startTime, endTime, timeStep, numberOfInterpolationPoints );
+    if( tabulatedModel != nullptr )
+    {
+        groundStationState->setStationMotionModel( tabulatedModel );
+        isBodyDeformationFound = true;
+    }
+    else if( std::dynamic_pointer_cast< CombinedStationMotionModel >( stationMotionModel ) != nullptr )
+    {
+        std::shared_ptr< CombinedStationMotionModel > combinedModel =
+                std::dynamic_pointer_cast< CombinedStationMotionModel >( stationMotionModel );
+        std::vector< std::shared_ptr< StationMotionModel > > modelList = combinedModel->getModelList( );
+        for( unsigned int i = 0; i < modelList.size( ); i++ )
+        {
+            tabulatedModel = getTabulatedBodyDeformationStationMotion(
+                        modelList.at( i ), groundStationState, startTime, endTime, timeStep, numberOfInterpolationPoints );
+            if( tabulatedModel != nullptr )
+            {
+                modelList[ i ] = tabulatedModel;
+                isBodyDeformationFound = true;
+            }
+        }
+        combinedModel->setModelList( modelList );
+    }
+
+    return isBodyDeformationFound;
+}
+
+} // namespace ground_stations
+
+} // namespace tudat
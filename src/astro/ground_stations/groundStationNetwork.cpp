@@ -0,0 +1,128 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include "tudat/astro/ground_stations/groundStationNetwork.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace ground_stations
+{
+
+//! Constructor
+GroundStationNetwork::GroundStationNetwork(
+        const std::vector< std::shared_ptr< GroundStation > >& groundStations,
+        const std::shared_ptr< ephemerides::RotationalEphemeris > bodyRotationModel ):
+    groundStations_( groundStations ),
+    numberOfStations_( static_cast< int >( groundStations.size( ) ) ),
+    bodyRotationModel_( bodyRotationModel ),
+    currentTime_( TUDAT_NAN )
+{
+    if( bodyRotationModel_ == nullptr )
+    {
+        throw std::runtime_error( "Error when creating ground station network, no body rotation model provided" );
+    }
+
+    for( int i = 0; i < numberOfStations_; i++ )
+    {
+        if( groundStations_.at( i ) == nullptr )
+        {
+            throw std::runtime_error( "Error when creating ground station network, station " +
+                                      std::to_string( i ) + " is not defined" );
+        }
+        stationNames_.push_back( groundStations_.at( i )->getStationId( ) );
+    }
+
+    bodyFixedStationStates_.resize( 6, numberOfStations_ );
+    inertialStationStates_.resize( 6, numberOfStations_ );
+    eastUnitVectors_.resize( 3, numberOfStations_ );
+    northUnitVectors_.resize( 3, numberOfStations_ );
+    upUnitVectors_.resize( 3, numberOfStations_ );
+    relativeTargetPositions_.resize( 3, numberOfStations_ );
+}
+
+//! Function to update the body-fixed and inertial states of all stations to the given time
+void GroundStationNetwork::updateStationStates( const double time )
+{
+    if( time == currentTime_ )
+    {
+        return;
+    }
+
+    // Retrieve body-fixed states and topocentric frames of all stations
+    Eigen::Matrix3d currentRotationToTopocentricFrame;
+    for( int i = 0; i < numberOfStations_; i++ )
+    {
+        std::shared_ptr< GroundStationState > stationState = groundStations_[ i ]->getNominalStationState( );
+        bodyFixedStationStates_.col( i ) = stationState->getCartesianStateInTime( time );
+
+        currentRotationToTopocentricFrame = stationState->getRotationMatrixFromBodyFixedToTopocentricFrame( time );
+        eastUnitVectors_.col( i ) = currentRotationToTopocentricFrame.row( 0 ).transpose( );
+        northUnitVectors_.col( i ) = currentRotationToTopocentricFrame.row( 1 ).transpose( );
+        upUnitVectors_.col( i ) = currentRotationToTopocentricFrame.row( 2 ).transpose( );
+    }
+
+    // Evaluate body rotation once for all stations
+    Eigen::Quaterniond currentRotationToBodyFixedFrame;
+    Eigen::Matrix3d currentRotationToBodyFixedFrameDerivative;
+    Eigen::Vector3d currentAngularVelocityVector;
+    bodyRotationModel_->getFullRotationalQuantitiesToTargetFrame(
+                currentRotationToBodyFixedFrame, currentRotationToBodyFixedFrameDerivative,
+                currentAngularVelocityVector, time );
+    currentRotationToBaseFrame_ = Eigen::Matrix3d( currentRotationToBodyFixedFrame.inverse( ) );
+
+    // Transform states of all stations to base frame
+    inertialStationStates_.topRows( 3 ).noalias( ) = currentRotationToBaseFrame_ * bodyFixedStationStates_.topRows( 3 );
+    inertialStationStates_.bottomRows( 3 ).noalias( ) = currentRotationToBaseFrame_ * bodyFixedStationStates_.bottomRows( 3 );
+    inertialStationStates_.bottomRows( 3 ).noalias( ) +=
+            currentRotationToBodyFixedFrameDerivative.transpose( ) * bodyFixedStationStates_.topRows( 3 );
+
+    currentTime_ = time;
+}
+
+//! Function to compute the elevation and azimuth angles from all stations to given target positions.
+void GroundStationNetwork::calculatePointingAnglesToTargets(
+        const Eigen::Matrix3Xd& targetPositions,
+        const double time,
+        Eigen::VectorXd& elevationAngles,
+        Eigen::VectorXd& azimuthAngles )
+{
+    if( targetPositions.cols( ) != numberOfStations_ )
+    {
+        throw std::runtime_error( "Error when computing pointing angles of ground station network, number of targets (" +
+                                  std::to_string( targetPositions.cols( ) ) + ") is not equal to number of stations (" +
+                                  std::to_string( numberOfStations_ ) + ")" );
+    }
+
+    updateStationStates( time );
+
+    // Compute body-fixed relative positions of all targets in a single product
+    relativeTargetPositions_.noalias( ) = currentRotationToBaseFrame_.transpose( ) *
+            ( targetPositions - inertialStationStates_.topRows( 3 ) );
+
+    // Compute topocentric (ENU) components of all relative positions
+    Eigen::ArrayXd eastComponents = ( eastUnitVectors_.cwiseProduct( relativeTargetPositions_ ) ).colwise( ).sum( ).transpose( );
+    Eigen::ArrayXd northComponents = ( northUnitVectors_.cwiseProduct( relativeTargetPositions_ ) ).colwise( ).sum( ).transpose( );
+    Eigen::ArrayXd upComponents = ( upUnitVectors_.cwiseProduct( relativeTargetPositions_ ) ).colwise( ).sum( ).transpose( );
+
+    elevationAngles.resize( numberOfStations_ );
+    azimuthAngles.resize( numberOfStations_ );
+    elevationAngles = upComponents.binaryExpr(
+                ( eastComponents.square( ) + northComponents.square( ) ).sqrt( ),
+                [ ]( const double up, const double horizontal ){ return std::atan2( up, horizontal ); } ).matrix( );
+    azimuthAngles = eastComponents.binaryExpr(
+                northComponents,
+                [ ]( const double east, const double north ){ return std::atan2( east, north ); } ).matrix( );
+}
+
+} // namespace ground_stations
+
+} // namespace tudat
@@ -191,6 +191,101 @@ Eigen::Vector6d PiecewiseConstantStationMotionModel::getBodyFixedStationMotion(
     return stationMotion;
 }
 
+//! Constructor, tabulates the station motion
+TabulatedStationMotionModel::TabulatedStationMotionModel(
+        const std::shared_ptr< StationMotionModel > originalModel,
+        const std::shared_ptr< GroundStationState > groundStationState,
+        const double startTime,
+        const double endTime,
+        const double timeStep,
+        const int numberOfInterpolationPoints ):
+    originalModel_( originalModel ), startTime_( startTime ), endTime_( endTime ), timeStep_( timeStep ),
+    numberOfInterpolationPoints_( numberOfInterpolationPoints )
+{
+    if( numberOfInterpolationPoints_ < 4 || numberOfInterpolationPoints_ > 12 || numberOfInterpolationPoints_ % 2 != 0 )
+    {
+        throw std::runtime_error( "Error when creating tabulated station motion, number of interpolation points (" +
+                                  std::to_string( numberOfInterpolationPoints_ ) + ") must be even, and between 4 and 12." );
+    }
+    else if( !( endTime_ > startTime_ ) || !( timeStep_ > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating tabulated station motion, time interval or time step is invalid." );
+    }
+
+    // Compute Lagrange denominators for equidistant nodes
+    lagrangeDenominators_.resize( numberOfInterpolationPoints_ );
+    for( int i = 0; i < numberOfInterpolationPoints_; i++ )
+    {
+        lagrangeDenominators_[ i ] = 1.0;
+        for( int j = 0; j < numberOfInterpolationPoints_; j++ )
+        {
+            if( j != i )
+            {
+                lagrangeDenominators_[ i ] *= static_cast< double >( i - j );
+            }
+        }
+    }
+
+    // Set equidistant grid that covers full interval (last point may be beyond end time), and tabulate motion
+    numberOfTabulationPoints_ = static_cast< int >( std::ceil( ( endTime_ - startTime_ ) / timeStep_ - 1.0E-9 ) ) + 1;
+    numberOfTabulationPoints_ = std::max( numberOfTabulationPoints_, numberOfInterpolationPoints_ );
+    tabulatedValues_.resize( 6 * numberOfTabulationPoints_ );
+    for( int i = 0; i < numberOfTabulationPoints_; i++ )
+    {
+        Eigen::Vector6d currentMotion = originalModel_->getBodyFixedStationMotion(
+                    startTime_ + static_cast< double >( i ) * timeStep_, groundStationState );
+        for( int j = 0; j < 6; j++ )
+        {
+            tabulatedValues_[ 6 * i + j ] = currentMotion( j );
+        }
+    }
+}
+
+//! Function to compute the station motion, by interpolating the tabulated values
+Eigen::Vector6d TabulatedStationMotionModel::getBodyFixedStationMotion(
+        const double time,
+        const std::shared_ptr< ground_stations::GroundStationState > groundStationState )
+{
+    if( !( time >= startTime_ && time <= endTime_ ) )
+    {
+        return originalModel_->getBodyFixedStationMotion( time, groundStationState );
+    }
+
+    // Determine first node of the interpolation stencil (centered on the interval containing the time if possible)
+    double scaledTime = ( time - startTime_ ) / timeStep_;
+    int firstNode = static_cast< int >( std::floor( scaledTime ) ) - ( numberOfInterpolationPoints_ / 2 - 1 );
+    firstNode = std::max( 0, std::min( firstNode, numberOfTabulationPoints_ - numberOfInterpolationPoints_ ) );
+
+    // Compute Lagrange weights at normalized time w.r.t. first node
+    double normalizedTime = scaledTime - static_cast< double >( firstNode );
+    double weights[ 12 ];
+    for( int i = 0; i < numberOfInterpolationPoints_; i++ )
+    {
+        double numerator = 1.0;
+        for( int j = 0; j < numberOfInterpolationPoints_; j++ )
+        {
+            if( j != i )
+            {
+                numerator *= ( normalizedTime - static_cast< double >( j ) );
+            }
+        }
+        weights[ i ] = numerator / lagrangeDenominators_[ i ];
+    }
+
+    // Compute weighted sum of tabulated values
+    Eigen::Vector6d stationMotion = Eigen::Vector6d::Zero( );
+    const double* currentValues = tabulatedValues_.data( ) + 6 * firstNode;
+    for( int i = 0; i < numberOfInterpolationPoints_; i++ )
+    {
+        for( int j = 0; j < 6; j++ )
+        {
+            stationMotion( j ) += weights[ i ] * currentValues[ j ];
+        }
+        currentValues += 6;
+    }
+    return stationMotion;
+}
+
 }
 
 }
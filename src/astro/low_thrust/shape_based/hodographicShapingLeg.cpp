@@ -12,6 +12,7 @@
 
 #include "tudat/astro/low_thrust/shape_based/hodographicShapingLeg.h"
 #include "tudat/math/basic/coordinateConversions.h"
+#include "tudat/math/quadrature/gaussianQuadrature.h"
 
 namespace tudat
 {
@@ -61,6 +62,8 @@ HodographicShapingLeg::HodographicShapingLeg(
     // Define numerical quadrature settings, required to compute the current polar angle and final deltaV.
     quadratureSettings_ = std::make_shared< numerical_quadrature::GaussianQuadratureSettings< double > >( 0.0, 64 );
 
+    // Values at quadrature nodes are computed upon first evaluation of the transfer
+    timeOfFlightOfQuadratureNodeValues_ = TUDAT_NAN;
 }
 
 void HodographicShapingLeg::computeTransfer( )
@@ -87,11 +90,101 @@ void HodographicShapingLeg::computeTransfer( )
         throw std::runtime_error( "Error when updating hodographic shaping object, number of inputs is inconsistent" );
     }
 
+    updateTimeOfFlightDependentValues( );
+    thrustAccelerationVectorCache_.clear( );
+
     updateFreeCoefficients( );
     satisfyBoundaryConditions( );
     legTotalDeltaV_ = computeDeltaV( );
 }
 
+//! Update values of the velocity function components at the quadrature nodes, and boundary-value matrices
+void HodographicShapingLeg::updateTimeOfFlightDependentValues( )
+{
+    // The base functions only depend on the time since departure, so the values only need to be recomputed if the time
+    // of flight (and therefore the location of the quadrature nodes) has changed.
+    if( timeOfFlight_ == timeOfFlightOfQuadratureNodeValues_ )
+    {
+        return;
+    }
+
+    // Retrieve Gaussian quadrature nodes and weights, and transform to interval [0, timeOfFlight]
+    const unsigned int numberOfQuadratureNodes = std::dynamic_pointer_cast<
+            numerical_quadrature::GaussianQuadratureSettings< double > >( quadratureSettings_ )->numberOfNodes_;
+    std::shared_ptr< numerical_quadrature::GaussQuadratureNodesAndWeights< double > > nodesAndWeights =
+            numerical_quadrature::getGaussQuadratureNodesAndWeights< double >( );
+    quadratureNodeTimes_ = 0.5 * timeOfFlight_ * ( nodesAndWeights->getNodes( numberOfQuadratureNodes ) + 1.0 );
+    quadratureNodeWeights_ = 0.5 * timeOfFlight_ * nodesAndWeights->getWeights( numberOfQuadratureNodes );
+
+    const int numberOfRadialComponents = radialVelocityFunction_->getNumberOfCompositeFunctionComponents( );
+    const int numberOfNormalComponents = normalVelocityFunction_->getNumberOfCompositeFunctionComponents( );
+    const int numberOfAxialComponents = axialVelocityFunction_->getNumberOfCompositeFunctionComponents( );
+
+    radialVelocityComponentsAtQuadratureNodes_.resize( numberOfQuadratureNodes, numberOfRadialComponents );
+    radialVelocityComponentDerivativesAtQuadratureNodes_.resize( numberOfQuadratureNodes, numberOfRadialComponents );
+    radialVelocityComponentIntegralsAtQuadratureNodes_.resize( numberOfQuadratureNodes, numberOfRadialComponents );
+    normalVelocityComponentsAtQuadratureNodes_.resize( numberOfQuadratureNodes, numberOfNormalComponents );
+    normalVelocityComponentDerivativesAtQuadratureNodes_.resize( numberOfQuadratureNodes, numberOfNormalComponents );
+    axialVelocityComponentDerivativesAtQuadratureNodes_.resize( numberOfQuadratureNodes, numberOfAxialComponents );
+    axialVelocityComponentIntegralsAtQuadratureNodes_.resize( numberOfQuadratureNodes, numberOfAxialComponents );
+
+    // Evaluate all velocity function components at the quadrature nodes
+    for( unsigned int i = 0; i < numberOfQuadratureNodes; i++ )
+    {
+        const double currentTime = quadratureNodeTimes_( i );
+        for( int j = 0; j < numberOfRadialComponents; j++ )
+        {
+            radialVelocityComponentsAtQuadratureNodes_( i, j ) =
+                    radialVelocityFunction_->getComponentFunctionCurrentValue( j, currentTime );
+            radialVelocityComponentDerivativesAtQuadratureNodes_( i, j ) =
+                    radialVelocityFunction_->getComponentFunctionDerivativeCurrentValue( j, currentTime );
+            radialVelocityComponentIntegralsAtQuadratureNodes_( i, j ) =
+                    radialVelocityFunction_->getComponentFunctionIntegralCurrentValue( j, currentTime )
+                    - radialVelocityFunction_->getComponentFunctionIntegralCurrentValue( j, 0.0 );
+        }
+
+        for( int j = 0; j < numberOfNormalComponents; j++ )
+        {
+            normalVelocityComponentsAtQuadratureNodes_( i, j ) =
+                    normalVelocityFunction_->getComponentFunctionCurrentValue( j, currentTime );
+            normalVelocityComponentDerivativesAtQuadratureNodes_( i, j ) =
+                    normalVelocityFunction_->getComponentFunctionDerivativeCurrentValue( j, currentTime );
+        }
+
+        for( int j = 0; j < numberOfAxialComponents; j++ )
+        {
+            axialVelocityComponentDerivativesAtQuadratureNodes_( i, j ) =
+                    axialVelocityFunction_->getComponentFunctionDerivativeCurrentValue( j, currentTime );
+            axialVelocityComponentIntegralsAtQuadratureNodes_( i, j ) =
+                    axialVelocityFunction_->getComponentFunctionIntegralCurrentValue( j, currentTime )
+                    - axialVelocityFunction_->getComponentFunctionIntegralCurrentValue( j, 0.0 );
+        }
+    }
+
+    // Compute inverse of matrices containing boundary values.
+    inverseMatrixRadialBoundaryValues_ = computeInverseMatrixRadialOrAxialBoundaries( radialVelocityFunction_ );
+    inverseMatrixNormalBoundaryValues_ = computeInverseMatrixNormalBoundaries( normalVelocityFunction_ );
+    inverseMatrixAxialBoundaryValues_ = computeInverseMatrixRadialOrAxialBoundaries( axialVelocityFunction_ );
+
+    timeOfFlightOfQuadratureNodeValues_ = timeOfFlight_;
+}
+
+//! Compute radial distance at the quadrature nodes, from the values of the radial velocity function components.
+Eigen::ArrayXd HodographicShapingLeg::computeRadialDistanceAtQuadratureNodes( )
+{
+    Eigen::ArrayXd radialDistances =
+            ( radialVelocityComponentIntegralsAtQuadratureNodes_ *
+              radialVelocityFunction_->getCompositeFunctionCoefficients( ) ).array( ) + radialBoundaryConditions_[ 0 ];
+
+    // Check if computed radial distance is valid
+    if ( ( radialDistances < 0.0 ).any( ) )
+    {
+        throw std::runtime_error( "Error when computing radial distance in hodographic shaping: computed distance is negative." );
+    }
+
+    return radialDistances;
+}
+
 void HodographicShapingLeg::updateFreeCoefficients( )
 {
     fullCoefficientsRadialVelocityFunction_.segment( 0, 3 ).setZero( );
@@ -157,12 +250,7 @@ void HodographicShapingLeg::satisfyBoundaryConditions( )
     axialBoundaryConditions_.push_back( initialCylindricalState[ 5 ] );
     axialBoundaryConditions_.push_back( finalCylindricalState[ 5 ] );
 
-    // Compute inverse of matrices containing boundary values.
-    inverseMatrixRadialBoundaryValues_ = computeInverseMatrixRadialOrAxialBoundaries( radialVelocityFunction_ );
-    inverseMatrixNormalBoundaryValues_ = computeInverseMatrixNormalBoundaries( normalVelocityFunction_ );
-    inverseMatrixAxialBoundaryValues_ = computeInverseMatrixRadialOrAxialBoundaries(axialVelocityFunction_ );
-
-    // Satisfy boundary conditions.
+    // Satisfy boundary conditions (inverse of matrices containing boundary values is updated with time of flight).
     satisfyRadialBoundaryConditions( fullCoefficientsRadialVelocityFunction_.segment(3, numberOfFreeRadialCoefficients_ ) );
     satisfyNormalBoundaryConditions( fullCoefficientsNormalVelocityFunction_.segment(3, numberOfFreeNormalCoefficients_ ) );
     satisfyAxialBoundaryConditions( fullCoefficientsAxialVelocityFunction_.segment(3, numberOfFreeAxialCoefficients_ ) );
@@ -342,46 +430,6 @@ void HodographicShapingLeg::satisfyNormalBoundaryConditions( const Eigen::Vector
 
 }
 
-// Define angular velocity due to the third component of the composite function only.
-double HodographicShapingLeg::computeDerivativePolarAngleDueToThirdComponent(
-        const double timeSinceDeparture, const Eigen::Vector2d& matrixK )
-{
-
-    double angularVelocityDueToThirdComponent = (
-                matrixK( 0 ) * normalVelocityFunction_->getComponentFunctionCurrentValue( 0, timeSinceDeparture )
-                + matrixK( 1 ) * normalVelocityFunction_->getComponentFunctionCurrentValue( 1, timeSinceDeparture )
-                + normalVelocityFunction_->getComponentFunctionCurrentValue( 2, timeSinceDeparture ) ) /
-            computeCurrentRadialDistance( timeSinceDeparture );
-
-    return angularVelocityDueToThirdComponent;
-
-}
-
-
-// Define the angular velocity due to all the other components of the composite function, once combined.
-double HodographicShapingLeg::computeDerivativePolarAngleDueToOtherComponents(
-        const double timeSinceDeparture, const Eigen::Vector2d& matrixL, const Eigen::VectorXd& freeCoefficients )
-{
-
-    // Compute angular velocity associated with free coefficients
-    double angularVelocityDueToFreeCoefficients = 0.0;
-    for(int j = 0 ; j < numberOfFreeNormalCoefficients_ ; j++ )
-    {
-        angularVelocityDueToFreeCoefficients += freeCoefficients( j )
-                * normalVelocityFunction_->getComponentFunctionCurrentValue( j + 3 , timeSinceDeparture );
-    }
-    angularVelocityDueToFreeCoefficients = angularVelocityDueToFreeCoefficients / computeCurrentRadialDistance( timeSinceDeparture );
-
-    // Compute angular velocity associated with fixed coefficients (first and second coefficient)
-    double angularVelocityDueToFirstAndSecondCoefficients =
-            ( matrixL( 0 ) * normalVelocityFunction_->getComponentFunctionCurrentValue( 0 , timeSinceDeparture )
-            + matrixL( 1 ) * normalVelocityFunction_->getComponentFunctionCurrentValue( 1 , timeSinceDeparture ) ) /
-            computeCurrentRadialDistance( timeSinceDeparture );
-
-    return angularVelocityDueToFreeCoefficients + angularVelocityDueToFirstAndSecondCoefficients;
-
-}
-
 double HodographicShapingLeg::computeThirdFixedCoefficientAxialVelocity ( const Eigen::VectorXd& freeCoefficients ){
 
     // Compute the third fixed coefficient of the normal velocity composite function, so that the condition on the final
@@ -416,23 +464,24 @@ double HodographicShapingLeg::computeThirdFixedCoefficientAxialVelocity ( const
     matrixK = inverseMatrixNormalBoundaryValues_ * initialAndFinalValuesThirdComponentFunction;
 
 
-    // Define angular velocity due to the third component of the composite function only.
-    std::function< double( const double ) > derivativePolarAngleDueToThirdComponent =
-            std::bind( &HodographicShapingLeg::computeDerivativePolarAngleDueToThirdComponent, this, std::placeholders::_1, matrixK );
-
-    // Define the angular velocity due to all the other components of the composite function, once combined.
-    std::function< double( const double ) > derivativePolarAngleDueToOtherComponents  =
-            std::bind( &HodographicShapingLeg::computeDerivativePolarAngleDueToOtherComponents, this, std::placeholders::_1, matrixL, freeCoefficients );
+    // Define coefficients of the normal velocity function components that contribute to the angular velocity due to the
+    // third component (scaled with the third coefficient), and due to all the other components.
+    Eigen::VectorXd coefficientsDueToThirdComponent = Eigen::VectorXd::Zero( numberOfFreeNormalCoefficients_ + 3 );
+    coefficientsDueToThirdComponent.segment( 0, 2 ) = matrixK;
+    coefficientsDueToThirdComponent( 2 ) = 1.0;
 
-    // Define numerical quadratures.
-    std::shared_ptr< numerical_quadrature::NumericalQuadrature< double, double > > integratorPolarAngleDueToThirdComponent =
-            numerical_quadrature::createQuadrature( derivativePolarAngleDueToThirdComponent, quadratureSettings_, timeOfFlight_ );
+    Eigen::VectorXd coefficientsDueToOtherComponents = Eigen::VectorXd::Zero( numberOfFreeNormalCoefficients_ + 3 );
+    coefficientsDueToOtherComponents.segment( 0, 2 ) = matrixL;
+    coefficientsDueToOtherComponents.segment( 3, numberOfFreeNormalCoefficients_ ) = freeCoefficients;
 
-    std::shared_ptr< numerical_quadrature::NumericalQuadrature< double, double > > integratorPolarAngleDueToOtherComponents =
-            numerical_quadrature::createQuadrature( derivativePolarAngleDueToOtherComponents, quadratureSettings_, timeOfFlight_ );
+    // Integrate the angular velocity due to both sets of components, from the component values at the quadrature nodes.
+    Eigen::ArrayXd weightsOverRadialDistance = quadratureNodeWeights_ / computeRadialDistanceAtQuadratureNodes( );
+    double polarAngleDueToThirdComponent =
+            ( weightsOverRadialDistance * ( normalVelocityComponentsAtQuadratureNodes_ * coefficientsDueToThirdComponent ).array( ) ).sum( );
+    double polarAngleDueToOtherComponents =
+            ( weightsOverRadialDistance * ( normalVelocityComponentsAtQuadratureNodes_ * coefficientsDueToOtherComponents ).array( ) ).sum( );
 
-    return ( normalBoundaryConditions_[ 2 ] - integratorPolarAngleDueToOtherComponents->getQuadrature() )
-           / integratorPolarAngleDueToThirdComponent->getQuadrature();
+    return ( normalBoundaryConditions_[ 2 ] - polarAngleDueToOtherComponents ) / polarAngleDueToThirdComponent;
 
 }
 
@@ -621,16 +670,37 @@ Eigen::Vector3d HodographicShapingLeg::computeThrustAccelerationDirection(
 //! Compute DeltaV.
 double HodographicShapingLeg::computeDeltaV( )
 {
-    // Define the derivative of the deltaV, ie thrust acceleration function, as a function of time.
-    std::function< double( const double ) > derivativeFunctionDeltaV =
-            std::bind(&HodographicShapingLeg::computeThrustAccelerationMagnitude, this,
-                      std::placeholders::_1 );
-
-    // Define numerical quadrature.
-    std::shared_ptr< numerical_quadrature::NumericalQuadrature< double, double > > quadrature =
-            numerical_quadrature::createQuadrature(derivativeFunctionDeltaV, quadratureSettings_, timeOfFlight_ );
-
-    return quadrature->getQuadrature( );
+    // Compute position and velocity function values at the quadrature nodes, from the values of the components.
+    const Eigen::VectorXd radialCoefficients = radialVelocityFunction_->getCompositeFunctionCoefficients( );
+    const Eigen::VectorXd normalCoefficients = normalVelocityFunction_->getCompositeFunctionCoefficients( );
+    const Eigen::VectorXd axialCoefficients = axialVelocityFunction_->getCompositeFunctionCoefficients( );
+
+    Eigen::ArrayXd radialDistance = computeRadialDistanceAtQuadratureNodes( );
+    Eigen::ArrayXd axialDistance =
+            ( axialVelocityComponentIntegralsAtQuadratureNodes_ * axialCoefficients ).array( ) + axialBoundaryConditions_[ 0 ];
+    Eigen::ArrayXd radialVelocity = ( radialVelocityComponentsAtQuadratureNodes_ * radialCoefficients ).array( );
+    Eigen::ArrayXd normalVelocity = ( normalVelocityComponentsAtQuadratureNodes_ * normalCoefficients ).array( );
+
+    // Compute thrust acceleration components in cylindrical coordinates (see computeThrustAccelerationInCylindricalCoordinates).
+    // Since the conversion to Cartesian coordinates is a rotation about the z-axis, the polar angle is not needed to
+    // compute the magnitude of the thrust acceleration.
+    Eigen::ArrayXd gravitationalAccelerationOverDistance = centralBodyGravitationalParameter_ /
+            ( radialDistance.square( ) + axialDistance.square( ) ).pow( 1.5 );
+    Eigen::ArrayXd angularVelocity = normalVelocity / radialDistance;
+
+    Eigen::ArrayXd radialThrustAcceleration =
+            ( radialVelocityComponentDerivativesAtQuadratureNodes_ * radialCoefficients ).array( )
+            - angularVelocity * normalVelocity + gravitationalAccelerationOverDistance * radialDistance;
+    Eigen::ArrayXd normalThrustAcceleration =
+            ( normalVelocityComponentDerivativesAtQuadratureNodes_ * normalCoefficients ).array( )
+            + angularVelocity * radialVelocity;
+    Eigen::ArrayXd axialThrustAcceleration =
+            ( axialVelocityComponentDerivativesAtQuadratureNodes_ * axialCoefficients ).array( )
+            + gravitationalAccelerationOverDistance * axialDistance;
+
+    // Integrate the thrust acceleration magnitude over the time of flight
+    return ( quadratureNodeWeights_ * ( radialThrustAcceleration.square( ) + normalThrustAcceleration.square( ) +
+                                        axialThrustAcceleration.square( ) ).sqrt( ) ).sum( );
 }
 
 
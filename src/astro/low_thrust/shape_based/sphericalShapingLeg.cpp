@@ -13,12 +13,96 @@
 #include "tudat/astro/basic_astro/celestialBodyConstants.h"
 #include "tudat/math/basic/coordinateConversions.h"
 #include "tudat/astro/low_thrust/shape_based/sphericalShapingLeg.h"
+#include "tudat/math/quadrature/gaussianQuadrature.h"
 
 namespace tudat
 {
 namespace shape_based_methods
 {
 
+//! Compute scalar function D (Eq. 7.62 of Roegiers (2014)), from the radial distance and elevation angle, and their first
+//! and second derivatives w.r.t. azimuth angle (entries 0, 1 and 2 of the input vectors).
+static double computeScalarFunctionDFromShape( const Eigen::Vector3d& radialDistance, const Eigen::Vector3d& elevationAngle )
+{
+    return - radialDistance( 2 ) + 2.0 * std::pow( radialDistance( 1 ), 2.0 ) / radialDistance( 0 )
+            + radialDistance( 1 ) * elevationAngle( 1 )
+            * ( elevationAngle( 2 ) - std::sin( elevationAngle( 0 ) ) * std::cos( elevationAngle( 0 ) ) )
+            / ( std::pow( elevationAngle( 1 ), 2.0 ) + std::pow( std::cos( elevationAngle( 0 ) ), 2.0 ) )
+            + radialDistance( 0 ) * ( std::pow( elevationAngle( 1 ), 2.0 ) + std::pow( std::cos( elevationAngle( 0 ) ), 2.0 ) );
+}
+
+//! Compute derivative of scalar function D (Eq. 7.63 of Roegiers (2014)) w.r.t. azimuth angle, from the radial distance and
+//! elevation angle, and their first, second and third derivatives w.r.t. azimuth angle (entries 0-3 of the input vectors).
+static double computeDerivativeScalarFunctionDFromShape( const Eigen::Vector4d& radialDistance, const Eigen::Vector4d& elevationAngle )
+{
+    // Define constants F1, F2, F3 and F4 as proposed in... (ADD REFERENCE).
+    double F1 = std::pow( elevationAngle( 1 ), 2.0 ) + std::pow( std::cos( elevationAngle( 0 ) ), 2.0 );
+    double F2 = elevationAngle( 2 ) - std::sin( 2.0 * elevationAngle( 0 ) ) / 2.0;
+    double F3 = std::cos( 2.0 * elevationAngle( 0 ) ) + 2.0 * std::pow( elevationAngle( 1 ), 2.0 ) + 1.0;
+    double F4 = 2.0 * elevationAngle( 2 ) - std::sin( 2.0 * elevationAngle( 0 ) );
+
+    return  F1 * radialDistance( 1 ) - radialDistance( 3 )
+            - 2.0 * std::pow( radialDistance( 1 ), 3.0 ) / std::pow( radialDistance( 0 ), 2.0 )
+            + 4.0 * radialDistance( 1 ) * radialDistance( 2 ) / radialDistance( 0 )
+            + F4 * elevationAngle( 1 ) * radialDistance( 0 )
+            + 2.0 * elevationAngle( 1 ) * radialDistance( 1 )
+            * ( elevationAngle( 3 ) - elevationAngle( 1 ) * std::cos( 2.0 * elevationAngle( 0 ) ) ) / F3
+            + F2 * elevationAngle( 1 ) * radialDistance( 2 ) / F1
+            + F2 * radialDistance( 1 ) * elevationAngle( 2 ) / F1
+            - 4.0 * F4 * F2 * std::pow( elevationAngle( 1 ), 2.0 ) * radialDistance( 1 ) / std::pow( F3, 2.0 );
+}
+
+//! Compute normalized velocity in spherical coordinates parametrized by azimuth angle, from the radial distance and
+//! elevation angle, and their first derivatives w.r.t. azimuth angle (entries 0 and 1 of the input vectors).
+static Eigen::Vector3d computeNormalizedVelocityParametrizedByAzimuthAngleFromShape(
+        const Eigen::Vector2d& radialDistance, const Eigen::Vector2d& elevationAngle )
+{
+    return ( Eigen::Vector3d() << radialDistance( 1 ),
+             radialDistance( 0 ) * std::cos( elevationAngle( 0 ) ),
+             radialDistance( 0 ) * elevationAngle( 1 ) ).finished();
+}
+
+//! Compute normalized acceleration in spherical coordinates parametrized by azimuth angle, from the radial distance and
+//! elevation angle, and their first and second derivatives w.r.t. azimuth angle (entries 0, 1 and 2 of the input vectors).
+static Eigen::Vector3d computeNormalizedAccelerationParametrizedByAzimuthAngleFromShape(
+        const Eigen::Vector3d& radialDistance, const Eigen::Vector3d& elevationAngle )
+{
+    Eigen::Vector3d accelerationParametrizedByAzimuthAngle;
+    accelerationParametrizedByAzimuthAngle[ 0 ] = radialDistance( 2 )
+            - radialDistance( 0 ) * ( std::pow( elevationAngle( 1 ), 2.0 ) + std::pow( std::cos( elevationAngle( 0 ) ), 2.0 ) );
+    accelerationParametrizedByAzimuthAngle[ 1 ] = 2.0 * radialDistance( 1 ) * std::cos( elevationAngle( 0 ) )
+            - 2.0 * radialDistance( 0 ) * elevationAngle( 1 ) * std::sin( elevationAngle( 0 ) );
+    accelerationParametrizedByAzimuthAngle[ 2 ] = 2.0 * radialDistance( 1 ) * elevationAngle( 1 )
+            + radialDistance( 0 ) * ( elevationAngle( 2 ) + std::sin( elevationAngle( 0 ) ) * std::cos( elevationAngle( 0 ) ) );
+    return accelerationParametrizedByAzimuthAngle;
+}
+
+//! Compute normalized thrust acceleration in spherical coordinates, from the radial distance and elevation angle, and
+//! their first, second and third derivatives w.r.t. azimuth angle (entries 0-3 of the input vectors).
+static Eigen::Vector3d computeNormalizedThrustAccelerationInSphericalCoordinatesFromShape(
+        const Eigen::Vector4d& radialDistance, const Eigen::Vector4d& elevationAngle,
+        const double centralBodyGravitationalParameter )
+{
+    // Compute scalar function of the time equation, and its derivative w.r.t. azimuth angle.
+    double scalarFunctionTimeEquation = computeScalarFunctionDFromShape(
+                radialDistance.segment< 3 >( 0 ), elevationAngle.segment< 3 >( 0 ) );
+    double derivativeScalarFunctionTimeEquation = computeDerivativeScalarFunctionDFromShape( radialDistance, elevationAngle );
+
+    // Compute first and second derivatives of the azimuth angle w.r.t. time.
+    double firstDerivativeAzimuthAngleWrtTime = std::sqrt(
+                centralBodyGravitationalParameter / ( scalarFunctionTimeEquation * std::pow( radialDistance( 0 ), 2.0 ) ) );
+    double secondDerivativeAzimuthAngleWrtTime = - std::pow( firstDerivativeAzimuthAngleWrtTime, 2.0 )
+            * ( derivativeScalarFunctionTimeEquation / ( 2.0 * scalarFunctionTimeEquation ) + radialDistance( 1 ) / radialDistance( 0 ) );
+
+    // Compute and return the current thrust acceleration vector in spherical coordinates.
+    return std::pow( firstDerivativeAzimuthAngleWrtTime, 2.0 ) * computeNormalizedAccelerationParametrizedByAzimuthAngleFromShape(
+                radialDistance.segment< 3 >( 0 ), elevationAngle.segment< 3 >( 0 ) )
+            + secondDerivativeAzimuthAngleWrtTime * computeNormalizedVelocityParametrizedByAzimuthAngleFromShape(
+                radialDistance.segment< 2 >( 0 ), elevationAngle.segment< 2 >( 0 ) )
+            + centralBodyGravitationalParameter / std::pow( radialDistance( 0 ), 3.0 )
+            * ( Eigen::Vector3d() << radialDistance( 0 ), 0.0, 0.0 ).finished();
+}
+
 SphericalShapingLeg::SphericalShapingLeg(const std::shared_ptr<ephemerides::Ephemeris> departureBodyEphemeris,
                                          const std::shared_ptr<ephemerides::Ephemeris> arrivalBodyEphemeris,
                                          const double centralBodyGravitationalParameter,
@@ -48,6 +132,9 @@ SphericalShapingLeg::SphericalShapingLeg(const std::shared_ptr<ephemerides::Ephe
     elevationAngleCompositeFunction_ = std::make_shared< CompositeElevationFunctionSphericalShaping >(
                 Eigen::VectorXd( coefficientsElevationAngleFunction_ ) );
 
+    // Values at quadrature nodes are computed upon first evaluation of the transfer
+    azimuthRangeOfQuadratureNodeValues_ = std::make_pair( TUDAT_NAN, TUDAT_NAN );
+
     // Define functions that return the departure and arrival velocities
     departureVelocityFunction_ = [=]( ){ return departureBodyState_.segment( 3, 3 ); };
     arrivalVelocityFunction_ = [=]( ){ return arrivalBodyState_.segment( 3, 3 ); };
@@ -86,6 +173,8 @@ SphericalShapingLeg::SphericalShapingLeg(const std::shared_ptr<ephemerides::Ephe
     elevationAngleCompositeFunction_ = std::make_shared< CompositeElevationFunctionSphericalShaping >(
             Eigen::VectorXd( coefficientsElevationAngleFunction_ ) );
 
+    // Values at quadrature nodes are computed upon first evaluation of the transfer
+    azimuthRangeOfQuadratureNodeValues_ = std::make_pair( TUDAT_NAN, TUDAT_NAN );
 }
 
 void SphericalShapingLeg::computeTransfer( )
@@ -167,6 +256,11 @@ void SphericalShapingLeg::computeTransfer( )
 
     // Define settings for numerical quadrature, to be used to compute time of flight and final deltaV.
     quadratureSettings_ = std::make_shared< numerical_quadrature::GaussianQuadratureSettings < double > >( initialAzimuthAngle_, 16 );
+    updateAzimuthDependentValues( );
+    thrustAccelerationVectorCache_.clear( );
+
+    // Compute inverse of boundary conditions matrix, which is independent of the free coefficient.
+    inverseMatrixBoundaryConditions_ = computeInverseMatrixBoundaryConditions( );
 
     // Update value of boundary conditions of free coefficient a2
     // computeFreeCoefficientBoundaries();
@@ -246,6 +340,84 @@ double SphericalShapingLeg::convertAzimuthToTime( const double currentAzimuthAng
     return currentTime;
 }
 
+void SphericalShapingLeg::updateAzimuthDependentValues( )
+{
+    // The base functions only depend on the azimuth angle, so the values only need to be recomputed if the azimuth range
+    // (and therefore the location of the quadrature nodes) has changed.
+    if( azimuthRangeOfQuadratureNodeValues_.first == initialAzimuthAngle_ &&
+            azimuthRangeOfQuadratureNodeValues_.second == finalAzimuthAngle_ )
+    {
+        return;
+    }
+
+    // Retrieve Gaussian quadrature nodes and weights, and transform to interval [initialAzimuth, finalAzimuth]
+    const unsigned int numberOfQuadratureNodes = std::dynamic_pointer_cast<
+            numerical_quadrature::GaussianQuadratureSettings< double > >( quadratureSettings_ )->numberOfNodes_;
+    std::shared_ptr< numerical_quadrature::GaussQuadratureNodesAndWeights< double > > nodesAndWeights =
+            numerical_quadrature::getGaussQuadratureNodesAndWeights< double >( );
+    Eigen::ArrayXd quadratureNodeAzimuthAngles = 0.5 * ( ( finalAzimuthAngle_ - initialAzimuthAngle_ ) *
+            nodesAndWeights->getNodes( numberOfQuadratureNodes ) + finalAzimuthAngle_ + initialAzimuthAngle_ );
+    quadratureNodeWeights_ = 0.5 * ( finalAzimuthAngle_ - initialAzimuthAngle_ ) *
+            nodesAndWeights->getWeights( numberOfQuadratureNodes );
+
+    // Evaluate all components (and derivatives up to third order) at the quadrature nodes
+    radialDistanceComponentsAtQuadratureNodes_.assign( 4, Eigen::MatrixXd( numberOfQuadratureNodes, 7 ) );
+    elevationAngleComponentsAtQuadratureNodes_.assign( 4, Eigen::MatrixXd( numberOfQuadratureNodes, 4 ) );
+    for( unsigned int i = 0; i < numberOfQuadratureNodes; i++ )
+    {
+        const double currentAzimuthAngle = quadratureNodeAzimuthAngles( i );
+        for( int j = 0; j < 7; j++ )
+        {
+            radialDistanceComponentsAtQuadratureNodes_[ 0 ]( i, j ) =
+                    radialDistanceCompositeFunction_->getComponentFunctionCurrentValue( j, currentAzimuthAngle );
+            radialDistanceComponentsAtQuadratureNodes_[ 1 ]( i, j ) =
+                    radialDistanceCompositeFunction_->getComponentFunctionFirstDerivative( j, currentAzimuthAngle );
+            radialDistanceComponentsAtQuadratureNodes_[ 2 ]( i, j ) =
+                    radialDistanceCompositeFunction_->getComponentFunctionSecondDerivative( j, currentAzimuthAngle );
+            radialDistanceComponentsAtQuadratureNodes_[ 3 ]( i, j ) =
+                    radialDistanceCompositeFunction_->getComponentFunctionThirdDerivative( j, currentAzimuthAngle );
+        }
+
+        for( int j = 0; j < 4; j++ )
+        {
+            elevationAngleComponentsAtQuadratureNodes_[ 0 ]( i, j ) =
+                    elevationAngleCompositeFunction_->getComponentFunctionCurrentValue( j, currentAzimuthAngle );
+            elevationAngleComponentsAtQuadratureNodes_[ 1 ]( i, j ) =
+                    elevationAngleCompositeFunction_->getComponentFunctionFirstDerivative( j, currentAzimuthAngle );
+            elevationAngleComponentsAtQuadratureNodes_[ 2 ]( i, j ) =
+                    elevationAngleCompositeFunction_->getComponentFunctionSecondDerivative( j, currentAzimuthAngle );
+            elevationAngleComponentsAtQuadratureNodes_[ 3 ]( i, j ) =
+                    elevationAngleCompositeFunction_->getComponentFunctionThirdDerivative( j, currentAzimuthAngle );
+        }
+    }
+
+    azimuthRangeOfQuadratureNodeValues_ = std::make_pair( initialAzimuthAngle_, finalAzimuthAngle_ );
+}
+
+void SphericalShapingLeg::computeShapeAtQuadratureNodes( Eigen::Matrix< double, Eigen::Dynamic, 4 >& radialDistanceAtNodes,
+                                                         Eigen::Matrix< double, Eigen::Dynamic, 4 >& elevationAngleAtNodes )
+{
+    // Compute sum of (derivatives of) components, weighted by the current coefficients
+    Eigen::Matrix< double, Eigen::Dynamic, 4 > radialComponentsSum( quadratureNodeWeights_.rows( ), 4 );
+    elevationAngleAtNodes.resize( quadratureNodeWeights_.rows( ), 4 );
+    for( int i = 0; i < 4; i++ )
+    {
+        radialComponentsSum.col( i ) = radialDistanceComponentsAtQuadratureNodes_[ i ] * coefficientsRadialDistanceFunction_;
+        elevationAngleAtNodes.col( i ) = elevationAngleComponentsAtQuadratureNodes_[ i ] * coefficientsElevationAngleFunction_;
+    }
+
+    // Radial distance is the inverse of the sum of its components (see CompositeRadialFunctionSphericalShaping)
+    radialDistanceAtNodes.resize( quadratureNodeWeights_.rows( ), 4 );
+    radialDistanceAtNodes.col( 0 ) = radialComponentsSum.col( 0 ).cwiseInverse( );
+    radialDistanceAtNodes.col( 1 ) = - radialComponentsSum.col( 1 ).cwiseProduct( radialDistanceAtNodes.col( 0 ).cwiseAbs2( ) );
+    radialDistanceAtNodes.col( 2 ) = - radialComponentsSum.col( 2 ).cwiseProduct( radialDistanceAtNodes.col( 0 ).cwiseAbs2( ) )
+            + 2.0 * radialComponentsSum.col( 0 ).cwiseProduct( radialDistanceAtNodes.col( 1 ).cwiseAbs2( ) );
+    radialDistanceAtNodes.col( 3 ) = - radialComponentsSum.col( 3 ).cwiseProduct( radialDistanceAtNodes.col( 0 ).cwiseAbs2( ) )
+            - 2.0 * radialDistanceAtNodes.col( 0 ).cwiseProduct( radialDistanceAtNodes.col( 1 ) ).cwiseProduct( radialComponentsSum.col( 2 ) )
+            + 2.0 * radialComponentsSum.col( 1 ).cwiseProduct( radialDistanceAtNodes.col( 1 ).cwiseAbs2( ) )
+            + 4.0 * radialComponentsSum.col( 0 ).cwiseProduct( radialDistanceAtNodes.col( 1 ) ).cwiseProduct( radialDistanceAtNodes.col( 2 ) );
+}
+
 Eigen::MatrixXd SphericalShapingLeg::computeInverseMatrixBoundaryConditions( )
 {
     Eigen::MatrixXd matrixBoundaryConditions = Eigen::MatrixXd::Zero( 10, 10 );
@@ -349,9 +521,7 @@ void SphericalShapingLeg::satisfyBoundaryConditions( double freeCoefficient )
 
     vectorSecondComponentContribution *= freeCoefficient;
 
-    Eigen::MatrixXd inverseMatrixBoundaryConditions = computeInverseMatrixBoundaryConditions();
-
-    Eigen::MatrixXd compositeFunctionCoefficients = inverseMatrixBoundaryConditions * ( vectorBoundaryValues - vectorSecondComponentContribution );
+    Eigen::MatrixXd compositeFunctionCoefficients = inverseMatrixBoundaryConditions_ * ( vectorBoundaryValues - vectorSecondComponentContribution );
 
     for ( int i = 0 ; i < 6 ; i++ )
     {
@@ -378,54 +548,64 @@ void SphericalShapingLeg::satisfyBoundaryConditions( double freeCoefficient )
 
 double SphericalShapingLeg::computeScalarFunctionD(double currentAzimuthAngle )
 {
-    double radialFunctionValue = radialDistanceCompositeFunction_->evaluateCompositeFunction( currentAzimuthAngle );
-    double firstDerivativeRadialFunction = radialDistanceCompositeFunction_->evaluateCompositeFunctionFirstDerivative( currentAzimuthAngle );
-    double secondDerivativeRadialFunction = radialDistanceCompositeFunction_->evaluateCompositeFunctionSecondDerivative( currentAzimuthAngle );
-
-    double elevationFunctionValue = elevationAngleCompositeFunction_->evaluateCompositeFunction( currentAzimuthAngle );
-    double firstDerivativeElevationFunction = elevationAngleCompositeFunction_->evaluateCompositeFunctionFirstDerivative( currentAzimuthAngle );
-    double secondDerivativeElevationFunction = elevationAngleCompositeFunction_->evaluateCompositeFunctionSecondDerivative( currentAzimuthAngle );
-
-    return - secondDerivativeRadialFunction + 2.0 * std::pow( firstDerivativeRadialFunction, 2.0 ) / radialFunctionValue
-            + firstDerivativeRadialFunction * firstDerivativeElevationFunction
-            * ( secondDerivativeElevationFunction - std::sin( elevationFunctionValue ) * std::cos( elevationFunctionValue ) )
-            / ( std::pow( firstDerivativeElevationFunction, 2.0 ) + std::pow( std::cos( elevationFunctionValue ), 2.0 ) )
-            + radialFunctionValue * ( std::pow( firstDerivativeElevationFunction, 2.0 ) + std::pow( std::cos( elevationFunctionValue ), 2.0 ) );
+    Eigen::Vector3d radialDistance(
+                radialDistanceCompositeFunction_->evaluateCompositeFunction( currentAzimuthAngle ),
+                radialDistanceCompositeFunction_->evaluateCompositeFunctionFirstDerivative( currentAzimuthAngle ),
+                radialDistanceCompositeFunction_->evaluateCompositeFunctionSecondDerivative( currentAzimuthAngle ) );
+    Eigen::Vector3d elevationAngle(
+                elevationAngleCompositeFunction_->evaluateCompositeFunction( currentAzimuthAngle ),
+                elevationAngleCompositeFunction_->evaluateCompositeFunctionFirstDerivative( currentAzimuthAngle ),
+                elevationAngleCompositeFunction_->evaluateCompositeFunctionSecondDerivative( currentAzimuthAngle ) );
+
+    return computeScalarFunctionDFromShape( radialDistance, elevationAngle );
 }
 
 double SphericalShapingLeg::computeDerivativeScalarFunctionD(double currentAzimuthAngle )
 {
-    double radialFunctionValue = radialDistanceCompositeFunction_->evaluateCompositeFunction( currentAzimuthAngle );
-    double firstDerivativeRadialFunction = radialDistanceCompositeFunction_->evaluateCompositeFunctionFirstDerivative( currentAzimuthAngle );
-    double secondDerivativeRadialFunction = radialDistanceCompositeFunction_->evaluateCompositeFunctionSecondDerivative( currentAzimuthAngle );
-    double thirdDerivativeRadialFunction = radialDistanceCompositeFunction_->evaluateCompositeFunctionThirdDerivative( currentAzimuthAngle );
-
-    double elevationFunctionValue = elevationAngleCompositeFunction_->evaluateCompositeFunction( currentAzimuthAngle );
-    double firstDerivativeElevationFunction = elevationAngleCompositeFunction_->evaluateCompositeFunctionFirstDerivative( currentAzimuthAngle );
-    double secondDerivativeElevationFunction = elevationAngleCompositeFunction_->evaluateCompositeFunctionSecondDerivative( currentAzimuthAngle );
-    double thirdDerivativeElevationFunction = elevationAngleCompositeFunction_->evaluateCompositeFunctionThirdDerivative( currentAzimuthAngle );
-
-    // Define constants F1, F2, F3 and F4 as proposed in... (ADD REFERENCE).
-    double F1 = std::pow( firstDerivativeElevationFunction, 2.0 ) + std::pow( std::cos( elevationFunctionValue ), 2.0 );
-    double F2 = secondDerivativeElevationFunction - std::sin( 2.0 * elevationFunctionValue ) / 2.0;
-    double F3 = std::cos( 2.0 * elevationFunctionValue ) + 2.0 * std::pow( firstDerivativeElevationFunction, 2.0 ) + 1.0;
-    double F4 = 2.0 * secondDerivativeElevationFunction - std::sin( 2.0 * elevationFunctionValue );
-
-    return  F1 * firstDerivativeRadialFunction - thirdDerivativeRadialFunction
-            - 2.0 * std::pow( firstDerivativeRadialFunction, 3.0 ) / std::pow( radialFunctionValue, 2.0 )
-            + 4.0 * firstDerivativeRadialFunction * secondDerivativeRadialFunction / radialFunctionValue
-            + F4 * firstDerivativeElevationFunction * radialFunctionValue
-            + 2.0 * firstDerivativeElevationFunction * firstDerivativeRadialFunction
-            * ( thirdDerivativeElevationFunction - firstDerivativeElevationFunction * std::cos( 2.0 * elevationFunctionValue ) ) / F3
-            + F2 * firstDerivativeElevationFunction * secondDerivativeRadialFunction / F1
-            + F2 * firstDerivativeRadialFunction * secondDerivativeElevationFunction / F1
-            - 4.0 * F4 * F2 * std::pow( firstDerivativeElevationFunction, 2.0 ) * firstDerivativeRadialFunction / std::pow( F3, 2.0 );
+    Eigen::Vector4d radialDistance(
+                radialDistanceCompositeFunction_->evaluateCompositeFunction( currentAzimuthAngle ),
+                radialDistanceCompositeFunction_->evaluateCompositeFunctionFirstDerivative( currentAzimuthAngle ),
+                radialDistanceCompositeFunction_->evaluateCompositeFunctionSecondDerivative( currentAzimuthAngle ),
+                radialDistanceCompositeFunction_->evaluateCompositeFunctionThirdDerivative( currentAzimuthAngle ) );
+    Eigen::Vector4d elevationAngle(
+                elevationAngleCompositeFunction_->evaluateCompositeFunction( currentAzimuthAngle ),
+                elevationAngleCompositeFunction_->evaluateCompositeFunctionFirstDerivative( currentAzimuthAngle ),
+                elevationAngleCompositeFunction_->evaluateCompositeFunctionSecondDerivative( currentAzimuthAngle ),
+                elevationAngleCompositeFunction_->evaluateCompositeFunctionThirdDerivative( currentAzimuthAngle ) );
+
+    return computeDerivativeScalarFunctionDFromShape( radialDistance, elevationAngle );
 }
 
 
 double SphericalShapingLeg::computeNormalizedTimeOfFlight()
 {
-    return convertAzimuthToTime(finalAzimuthAngle_);
+    // Compute shape at quadrature nodes, from values of composite function components
+    Eigen::Matrix< double, Eigen::Dynamic, 4 > radialDistanceAtNodes, elevationAngleAtNodes;
+    computeShapeAtQuadratureNodes( radialDistanceAtNodes, elevationAngleAtNodes );
+
+    // Integrate derivative of time w.r.t. azimuth angle (see convertAzimuthToTime) over full azimuth range
+    double timeOfFlight = 0.0;
+    for( int i = 0; i < quadratureNodeWeights_.rows( ); i++ )
+    {
+        double scalarFunctionTimeEquation = computeScalarFunctionDFromShape(
+                    radialDistanceAtNodes.block< 1, 3 >( i, 0 ).transpose( ), elevationAngleAtNodes.block< 1, 3 >( i, 0 ).transpose( ) );
+
+        // Check that the trajectory is feasible, ie curved toward the central body.
+        if ( scalarFunctionTimeEquation < 0.0 )
+        {
+            throw std::runtime_error ( "Error, trajectory not curved toward the central body, and thus not feasible." );
+        }
+
+        timeOfFlight += quadratureNodeWeights_( i ) * std::sqrt(
+                    scalarFunctionTimeEquation * std::pow( radialDistanceAtNodes( i, 0 ), 2.0 ) / centralBodyGravitationalParameter_ );
+    }
+
+    if( timeOfFlight != timeOfFlight )
+    {
+        throw std::runtime_error( "Error in spherical shaping, converting azimuth to time resulted in NaN value, this could be a result of poorly defined ephemerides or gravitational parameter." );
+    }
+
+    return timeOfFlight;
 }
 
 
@@ -550,65 +730,52 @@ Eigen::Vector3d SphericalShapingLeg::computeNormalizedVelocityParametrizedByAzim
 {
 
     // Retrieve current radial distance and elevation angle, as well as their derivatives w.r.t. azimuth angle.
-    double radialDistance = radialDistanceCompositeFunction_->evaluateCompositeFunction( currentAzimuthAngle );
-    double derivativeRadialDistance = radialDistanceCompositeFunction_->evaluateCompositeFunctionFirstDerivative( currentAzimuthAngle );
-    double elevationAngle = elevationAngleCompositeFunction_->evaluateCompositeFunction( currentAzimuthAngle );
-    double derivativeElevationAngle = elevationAngleCompositeFunction_->evaluateCompositeFunctionFirstDerivative( currentAzimuthAngle );
+    Eigen::Vector2d radialDistance(
+                radialDistanceCompositeFunction_->evaluateCompositeFunction( currentAzimuthAngle ),
+                radialDistanceCompositeFunction_->evaluateCompositeFunctionFirstDerivative( currentAzimuthAngle ) );
+    Eigen::Vector2d elevationAngle(
+                elevationAngleCompositeFunction_->evaluateCompositeFunction( currentAzimuthAngle ),
+                elevationAngleCompositeFunction_->evaluateCompositeFunctionFirstDerivative( currentAzimuthAngle ) );
 
     // Compute and return velocity vector parametrized by azimuth angle.
-    return ( Eigen::Vector3d() << derivativeRadialDistance,
-             radialDistance * std::cos( elevationAngle ),
-             radialDistance * derivativeElevationAngle ).finished();
+    return computeNormalizedVelocityParametrizedByAzimuthAngleFromShape( radialDistance, elevationAngle );
 }
 
 
 Eigen::Vector3d SphericalShapingLeg::computeNormalizedThrustAccelerationParametrizedByAzimuthAngle(const double currentAzimuthAngle )
 {
     // Retrieve spherical coordinates and their derivatives w.r.t. to the azimuth angle.
-    double radialDistance = radialDistanceCompositeFunction_->evaluateCompositeFunction( currentAzimuthAngle );
-    double firstDerivativeRadialDistance = radialDistanceCompositeFunction_->evaluateCompositeFunctionFirstDerivative( currentAzimuthAngle );
-    double secondDerivativeRadialDistance = radialDistanceCompositeFunction_->evaluateCompositeFunctionSecondDerivative( currentAzimuthAngle );
-    double elevationAngle = elevationAngleCompositeFunction_->evaluateCompositeFunction( currentAzimuthAngle );
-    double firstDerivativeElevationAngle = elevationAngleCompositeFunction_->evaluateCompositeFunctionFirstDerivative( currentAzimuthAngle );
-    double secondDerivativeElevationAngle = elevationAngleCompositeFunction_->evaluateCompositeFunctionSecondDerivative( currentAzimuthAngle );
+    Eigen::Vector3d radialDistance(
+                radialDistanceCompositeFunction_->evaluateCompositeFunction( currentAzimuthAngle ),
+                radialDistanceCompositeFunction_->evaluateCompositeFunctionFirstDerivative( currentAzimuthAngle ),
+                radialDistanceCompositeFunction_->evaluateCompositeFunctionSecondDerivative( currentAzimuthAngle ) );
+    Eigen::Vector3d elevationAngle(
+                elevationAngleCompositeFunction_->evaluateCompositeFunction( currentAzimuthAngle ),
+                elevationAngleCompositeFunction_->evaluateCompositeFunctionFirstDerivative( currentAzimuthAngle ),
+                elevationAngleCompositeFunction_->evaluateCompositeFunctionSecondDerivative( currentAzimuthAngle ) );
 
     // Compute and return acceleration vector parametrized by the azimuth angle theta.
-    Eigen::Vector3d accelerationParametrizedByAzimuthAngle;
-    accelerationParametrizedByAzimuthAngle[ 0 ] = secondDerivativeRadialDistance
-            - radialDistance * ( std::pow( firstDerivativeElevationAngle, 2.0 ) + std::pow( std::cos( elevationAngle ), 2.0 ) );
-    accelerationParametrizedByAzimuthAngle[ 1 ] = 2.0 * firstDerivativeRadialDistance * std::cos( elevationAngle )
-            - 2.0 * radialDistance * firstDerivativeElevationAngle * std::sin( elevationAngle );
-    accelerationParametrizedByAzimuthAngle[ 2 ] = 2.0 * firstDerivativeRadialDistance * firstDerivativeElevationAngle
-            + radialDistance * ( secondDerivativeElevationAngle + std::sin( elevationAngle ) * std::cos( elevationAngle ) );
-
-    return accelerationParametrizedByAzimuthAngle;
+    return computeNormalizedAccelerationParametrizedByAzimuthAngleFromShape( radialDistance, elevationAngle );
 
 }
 
 
 Eigen::Vector3d SphericalShapingLeg::computeNormalizedThrustAccelerationInSphericalCoordinates(const double currentAzimuthAngle )
 {
-    // Compute current radial distance.
-    double radialDistance = radialDistanceCompositeFunction_->evaluateCompositeFunction( currentAzimuthAngle );
-
-    // Compute first and second derivatives of the azimuth angle w.r.t. time.
-    double firstDerivativeAzimuthAngleWrtTime = computeFirstDerivativeAzimuthAngleWrtTime( currentAzimuthAngle );
-    double secondDerivativeAzimuthAngleWrtTime = computeSecondDerivativeAzimuthAngleWrtTime( currentAzimuthAngle );
-
-    // Compute velocity vector parametrized by azimuth angle theta.
-    Eigen::Vector3d velocityParametrizedByAzimuthAngle = computeNormalizedVelocityParametrizedByAzimuthAngle(
-            currentAzimuthAngle);
-
-    // Compute acceleration vector parametrized by azimuth angle theta.
-    Eigen::Vector3d accelerationParametrizedByAzimuthAngle = computeNormalizedThrustAccelerationParametrizedByAzimuthAngle(
-            currentAzimuthAngle);
-
-
-    // Compute and return the current thrust acceleration vector in spherical coordinates.
-    return std::pow( firstDerivativeAzimuthAngleWrtTime, 2.0 ) * accelerationParametrizedByAzimuthAngle
-            + secondDerivativeAzimuthAngleWrtTime * velocityParametrizedByAzimuthAngle
-            + centralBodyGravitationalParameter_ / std::pow( radialDistance, 3.0 ) * ( Eigen::Vector3d() << radialDistance, 0.0, 0.0 ).finished();
-
+    // Retrieve spherical coordinates and their derivatives w.r.t. to the azimuth angle.
+    Eigen::Vector4d radialDistance(
+                radialDistanceCompositeFunction_->evaluateCompositeFunction( currentAzimuthAngle ),
+                radialDistanceCompositeFunction_->evaluateCompositeFunctionFirstDerivative( currentAzimuthAngle ),
+                radialDistanceCompositeFunction_->evaluateCompositeFunctionSecondDerivative( currentAzimuthAngle ),
+                radialDistanceCompositeFunction_->evaluateCompositeFunctionThirdDerivative( currentAzimuthAngle ) );
+    Eigen::Vector4d elevationAngle(
+                elevationAngleCompositeFunction_->evaluateCompositeFunction( currentAzimuthAngle ),
+                elevationAngleCompositeFunction_->evaluateCompositeFunctionFirstDerivative( currentAzimuthAngle ),
+                elevationAngleCompositeFunction_->evaluateCompositeFunctionSecondDerivative( currentAzimuthAngle ),
+                elevationAngleCompositeFunction_->evaluateCompositeFunctionThirdDerivative( currentAzimuthAngle ) );
+
+    return computeNormalizedThrustAccelerationInSphericalCoordinatesFromShape(
+                radialDistance, elevationAngle, centralBodyGravitationalParameter_ );
 }
 
 
@@ -685,25 +852,29 @@ Eigen::Vector3d SphericalShapingLeg::computeThrustAccelerationDirection (const d
 
 double SphericalShapingLeg::computeDeltaV( )
 {
-    // Define function to integrate: time derivative of the deltaV multiplied by a factor which changes the variable of
-    // integration from the time to the azimuth
-    std::function< double( const double ) > derivativeFunctionDeltaV = [ = ] ( const double currentAzimuthAngle )
+    // Compute shape at quadrature nodes, from values of composite function components
+    Eigen::Matrix< double, Eigen::Dynamic, 4 > radialDistanceAtNodes, elevationAngleAtNodes;
+    computeShapeAtQuadratureNodes( radialDistanceAtNodes, elevationAngleAtNodes );
+
+    // Integrate time derivative of the deltaV multiplied by a factor which changes the variable of integration from the
+    // time to the azimuth
+    double deltaV = 0.0;
+    for( int i = 0; i < quadratureNodeWeights_.rows( ); i++ )
     {
-        double thrustAcceleration = computeNormalizedThrustAccelerationInSphericalCoordinates(currentAzimuthAngle).norm();
-        double derivativeOfTimeWithRespectToAzimuth = std::sqrt(computeScalarFunctionD(currentAzimuthAngle)
-                * std::pow( radialDistanceCompositeFunction_->evaluateCompositeFunction( currentAzimuthAngle ), 2.0 )
-                / centralBodyGravitationalParameter_ );
-
-        return thrustAcceleration * derivativeOfTimeWithRespectToAzimuth;
+        Eigen::Vector4d radialDistance = radialDistanceAtNodes.row( i ).transpose( );
+        Eigen::Vector4d elevationAngle = elevationAngleAtNodes.row( i ).transpose( );
 
-    };
+        double thrustAcceleration = computeNormalizedThrustAccelerationInSphericalCoordinatesFromShape(
+                    radialDistance, elevationAngle, centralBodyGravitationalParameter_ ).norm( );
+        double derivativeOfTimeWithRespectToAzimuth = std::sqrt(
+                    computeScalarFunctionDFromShape( radialDistance.segment< 3 >( 0 ), elevationAngle.segment< 3 >( 0 ) )
+                    * std::pow( radialDistance( 0 ), 2.0 ) / centralBodyGravitationalParameter_ );
 
-    // Define numerical quadrature from quadrature settings.
-    std::shared_ptr< numerical_quadrature::NumericalQuadrature< double, double > > quadrature =
-            numerical_quadrature::createQuadrature( derivativeFunctionDeltaV, quadratureSettings_, finalAzimuthAngle_ );
+        deltaV += quadratureNodeWeights_( i ) * thrustAcceleration * derivativeOfTimeWithRespectToAzimuth;
+    }
 
     // Return dimensional deltaV
-    return quadrature->getQuadrature( ) * physical_constants::ASTRONOMICAL_UNIT / physical_constants::JULIAN_YEAR;
+    return deltaV * physical_constants::ASTRONOMICAL_UNIT / physical_constants::JULIAN_YEAR;
 }
 
 
@@ -10,15 +10,56 @@
  */
 
 
+#include <cmath>
 #include <iostream>
 #include "tudat/astro/low_thrust/simsFlanaganModel.h"
+#include "tudat/math/basic/numericalDerivative.h"
 #include "tudat/math/quadrature/createNumericalQuadrature.h"
+#include "tudat/simulation/environment_setup/createSystemModel.h"
 
 namespace tudat
 {
 namespace low_thrust_trajectories
 {
 
+//! Name of the engine model that is added to the propagated body for the thrust of the leg.
+static const std::string SIMS_FLANAGAN_ENGINE_NAME = "SimsFlanaganEngine";
+
+//! Propagate a Cartesian state along an unperturbed Kepler orbit over a given time interval.
+static Eigen::Vector6d propagateKeplerArc(
+        const Eigen::Vector6d& initialState, const double propagationTime, const double centralBodyGravitationalParameter )
+{
+    return orbital_element_conversions::convertKeplerianToCartesianElements(
+                orbital_element_conversions::propagateKeplerOrbit(
+                    orbital_element_conversions::convertCartesianToKeplerianElements(
+                        initialState, centralBodyGravitationalParameter ),
+                    propagationTime, centralBodyGravitationalParameter ), centralBodyGravitationalParameter );
+}
+
+//! Propagate a Cartesian state, and its partials w.r.t. the throttles, along an unperturbed Kepler orbit.
+static void propagateKeplerArcWithPartials(
+        Eigen::Vector6d& state, Eigen::MatrixXd& statePartials,
+        const double propagationTime, const double centralBodyGravitationalParameter )
+{
+    std::function< Eigen::VectorXd( const Eigen::VectorXd& ) > keplerArcFunction =
+            [ = ]( const Eigen::VectorXd& initialState ) -> Eigen::VectorXd
+    {
+        return propagateKeplerArc( initialState, propagationTime, centralBodyGravitationalParameter );
+    };
+
+    // Compute state transition matrix, perturbing positions and velocities relative to their norm (rather than per
+    // component), so that (near-)zero components are not perturbed below the accuracy of the Kepler propagation
+    Eigen::MatrixXd stateTransitionMatrix( 6, 6 );
+    for( int i = 0; i < 6; i++ )
+    {
+        stateTransitionMatrix.col( i ) = numerical_derivatives::computeCentralDifference(
+                    Eigen::VectorXd( state ), i, keplerArcFunction,
+                    std::pow( 2.0, -14 ) * state.segment( 3 * ( i / 3 ), 3 ).norm( ), std::pow( 2.0, -14 ) );
+    }
+    statePartials = stateTransitionMatrix * statePartials;
+    state = propagateKeplerArc( state, propagationTime, centralBodyGravitationalParameter );
+}
+
 int SimsFlanaganModel::convertTimeToLegSegment( double currentTime )
 {
     int indexSegment;
@@ -42,8 +83,10 @@ int SimsFlanaganModel::convertTimeToLegSegment( double currentTime )
     return indexSegment;
 }
 
-std::shared_ptr< simulation_setup::ThrustAccelerationSettings > SimsFlanaganModel::getConstantThrustAccelerationSettingsPerSegment(
-        unsigned int indexSegment )
+std::shared_ptr< simulation_setup::AccelerationSettings > SimsFlanaganModel::getConstantThrustAccelerationSettingsPerSegment(
+        const unsigned int indexSegment,
+        const simulation_setup::SystemOfBodies& bodies,
+        const std::string& bodyToPropagate )
 {
     // Define (constant) thrust magnitude function.
     std::function< double( const double ) > thrustMagnitudeFunction = [ = ]( const double currentTime )
@@ -52,9 +95,8 @@ std::shared_ptr< simulation_setup::ThrustAccelerationSettings > SimsFlanaganMode
     };
 
     // Define thrust magnitude settings from thrust magnitude function.
-    std::shared_ptr< simulation_setup::FromFunctionThrustMagnitudeSettings > thrustMagnitudeSettings
-            = std::make_shared< simulation_setup::FromFunctionThrustMagnitudeSettings >(
-                thrustMagnitudeFunction, specificImpulseFunction_ );
+    std::shared_ptr< simulation_setup::ThrustMagnitudeSettings > thrustMagnitudeSettings =
+            simulation_setup::fromFunctionThrustMagnitudeSettings( thrustMagnitudeFunction, specificImpulseFunction_ );
 
     // Define thrust direction function (constant over one leg segment).
     std::function< Eigen::Vector3d( const double ) > thrustDirectionFunction = [ = ]( const double currentTime )
@@ -62,17 +104,10 @@ std::shared_ptr< simulation_setup::ThrustAccelerationSettings > SimsFlanaganMode
         return throttles_[ indexSegment ].normalized( );
     };
 
-
-    // Define thrust direction settings from the direction of thrust acceleration retrieved from the shaping method.
-    std::shared_ptr< simulation_setup::CustomThrustDirectionSettings > thrustDirectionSettings =
-            std::make_shared< simulation_setup::CustomThrustDirectionSettings >( thrustDirectionFunction );
-
-    // Define thrust acceleration settings.
-    std::shared_ptr< simulation_setup::ThrustAccelerationSettings > thrustAccelerationSettings =
-            std::make_shared< simulation_setup::ThrustAccelerationSettings >(
-                thrustDirectionSettings, thrustMagnitudeSettings );
-
-    return thrustAccelerationSettings;
+    // Add engine model to body (with thrust direction in the body-fixed frame), and define thrust acceleration settings.
+    simulation_setup::addVariableDirectionEngineModel(
+                bodyToPropagate, SIMS_FLANAGAN_ENGINE_NAME, thrustMagnitudeSettings, bodies, thrustDirectionFunction );
+    return simulation_setup::thrustAccelerationFromSingleEngine( SIMS_FLANAGAN_ENGINE_NAME );
 }
 
 basic_astrodynamics::AccelerationMap SimsFlanaganModel::getAccelerationModelPerSegment(
@@ -86,11 +121,11 @@ basic_astrodynamics::AccelerationMap SimsFlanaganModel::getAccelerationModelPerS
     std::map< std::string, std::vector< std::shared_ptr< simulation_setup::AccelerationSettings > > > accelerationsSettings;
 
     // Add point-mass gravitational acceleration from central body.
-    accelerationsSettings[ centralBody ].push_back( std::make_shared< simulation_setup::AccelerationSettings >(
-                                                        basic_astrodynamics::central_gravity ) );
+    accelerationsSettings[ centralBody ].push_back( simulation_setup::pointMassGravityAcceleration( ) );
 
     // Retrieve thrust acceleration settings.
-    accelerationsSettings[ bodyToPropagate ].push_back( getConstantThrustAccelerationSettingsPerSegment( indexSegment ) );
+    accelerationsSettings[ bodyToPropagate ].push_back( getConstantThrustAccelerationSettingsPerSegment(
+                                                           indexSegment, bodies, bodyToPropagate ) );
 
     // Create acceleration map.
     simulation_setup::SelectedAccelerationMap accelerationMap;
@@ -105,38 +140,41 @@ basic_astrodynamics::AccelerationMap SimsFlanaganModel::getAccelerationModelPerS
 }
 
 
-std::shared_ptr< simulation_setup::ThrustAccelerationSettings > SimsFlanaganModel::getThrustAccelerationSettingsFullLeg(
-        const simulation_setup::SystemOfBodies& bodies )
+std::shared_ptr< simulation_setup::AccelerationSettings > SimsFlanaganModel::getThrustAccelerationSettingsFullLeg(
+        const simulation_setup::SystemOfBodies& bodies,
+        const std::string& bodyToPropagate )
 {
     // Define thrust magnitude function.
+    // (time is NaN when the engine model is reset, in which case no segment is selected)
     std::function< double( const double ) > thrustMagnitudeFunction = [ = ]( const double currentTime )
     {
+        if( std::isnan( currentTime ) )
+        {
+            return TUDAT_NAN;
+        }
         int indexSegment = convertTimeToLegSegment( currentTime );
         return maximumThrust_ * throttles_[ indexSegment ].norm();
     };
 
     // Define thrust magnitude settings from thrust magnitude function.
-    std::shared_ptr< simulation_setup::FromFunctionThrustMagnitudeSettings > thrustMagnitudeSettings
-            = std::make_shared< simulation_setup::FromFunctionThrustMagnitudeSettings >(
-                thrustMagnitudeFunction, specificImpulseFunction_ );
+    std::shared_ptr< simulation_setup::ThrustMagnitudeSettings > thrustMagnitudeSettings =
+            simulation_setup::fromFunctionThrustMagnitudeSettings( thrustMagnitudeFunction, specificImpulseFunction_ );
 
     // Define thrust direction function.
     std::function< Eigen::Vector3d( const double ) > thrustDirectionFunction = [ = ]( const double currentTime )
     {
+        if( std::isnan( currentTime ) )
+        {
+            return Eigen::Vector3d::Constant( TUDAT_NAN ).eval( );
+        }
         int indexSegment = convertTimeToLegSegment( currentTime );
-        return throttles_[ indexSegment ].normalized();
+        return throttles_[ indexSegment ].normalized( ).eval( );
     };
 
-    // Define thrust direction settings from the direction of thrust acceleration retrieved from the shaping method.
-    std::shared_ptr< simulation_setup::CustomThrustDirectionSettings > thrustDirectionSettings =
-            std::make_shared< simulation_setup::CustomThrustDirectionSettings >( thrustDirectionFunction );
-
-    // Define thrust acceleration settings.
-    std::shared_ptr< simulation_setup::ThrustAccelerationSettings > thrustAccelerationSettings =
-            std::make_shared< simulation_setup::ThrustAccelerationSettings >(
-                thrustDirectionSettings, thrustMagnitudeSettings );
-
-    return thrustAccelerationSettings;
+    // Add engine model to body (with thrust direction in the body-fixed frame), and define thrust acceleration settings.
+    simulation_setup::addVariableDirectionEngineModel(
+                bodyToPropagate, SIMS_FLANAGAN_ENGINE_NAME, thrustMagnitudeSettings, bodies, thrustDirectionFunction );
+    return simulation_setup::thrustAccelerationFromSingleEngine( SIMS_FLANAGAN_ENGINE_NAME );
 }
 
 basic_astrodynamics::AccelerationMap SimsFlanaganModel::getLowThrustTrajectoryAccelerationMap(
@@ -148,11 +186,10 @@ basic_astrodynamics::AccelerationMap SimsFlanaganModel::getLowThrustTrajectoryAc
     std::map< std::string, std::vector< std::shared_ptr< simulation_setup::AccelerationSettings > > > accelerationsSettings;
 
     // Add point-mass gravitational acceleration from central body.
-    accelerationsSettings[ centralBody ].push_back( std::make_shared< simulation_setup::AccelerationSettings >(
-                                                        basic_astrodynamics::central_gravity ) );
+    accelerationsSettings[ centralBody ].push_back( simulation_setup::pointMassGravityAcceleration( ) );
 
     // Retrieve thrust acceleration settings.
-    accelerationsSettings[ bodyToPropagate ].push_back( getThrustAccelerationSettingsFullLeg( bodies ) );
+    accelerationsSettings[ bodyToPropagate ].push_back( getThrustAccelerationSettingsFullLeg( bodies, bodyToPropagate ) );
 
     // Create acceleration map.
     simulation_setup::SelectedAccelerationMap accelerationMap;
@@ -230,6 +267,81 @@ void SimsFlanaganModel::propagateMassToSegments( )
 }
 
 
+//! Compute partial derivatives of the total deltaV and match point states w.r.t. the throttles.
+void SimsFlanaganModel::computeThrottlePartials(
+        Eigen::MatrixXd& totalDeltaVPartials,
+        Eigen::MatrixXd& matchPointStateForwardPropagationPartials,
+        Eigen::MatrixXd& matchPointStateBackwardPropagationPartials )
+{
+    const int numberOfThrottles = 3 * numberSegments_;
+
+    // Compute partials of the mass at the start of each segment, and of the deltaV applied in each segment
+    // (dm_k+1/dm_k = m_k+1/m_k * ( 1 + |dV_k| / c_k ), dm_k+1/du_k = - m_k+1 * T * dt_k / ( m_k * c_k ) * u_k/|u_k|).
+    Eigen::MatrixXd massPartials = Eigen::MatrixXd::Zero( 1, numberOfThrottles );
+    std::vector< Eigen::MatrixXd > deltaVPartials( numberSegments_ );
+    std::vector< Eigen::Vector3d > deltaVs( numberSegments_ );
+    totalDeltaVPartials = Eigen::MatrixXd::Zero( 1, numberOfThrottles );
+    for( int currentSegment = 0 ; currentSegment < numberSegments_ ; currentSegment++ )
+    {
+        double segmentDuration = ( currentSegment < numberSegmentsForwardPropagation_ ) ?
+                    segmentDurationForwardPropagation_ : segmentDurationBackwardPropagation_;
+        double currentMass = segmentMasses_.at( currentSegment );
+        double deltaVPerThrottle = maximumThrust_ / currentMass * segmentDuration;
+
+        Eigen::Vector3d throttleDirection = Eigen::Vector3d::Zero( );
+        if( throttles_[ currentSegment ].norm( ) > 0.0 )
+        {
+            throttleDirection = throttles_[ currentSegment ].normalized( );
+        }
+
+        // Partials of deltaV vector and magnitude of current segment.
+        deltaVs[ currentSegment ] = deltaVPerThrottle * throttles_[ currentSegment ];
+        deltaVPartials[ currentSegment ] = - deltaVs[ currentSegment ] / currentMass * massPartials;
+        deltaVPartials[ currentSegment ].block( 0, 3 * currentSegment, 3, 3 ) += deltaVPerThrottle * Eigen::Matrix3d::Identity( );
+
+        totalDeltaVPartials -= deltaVs[ currentSegment ].norm( ) / currentMass * massPartials;
+        totalDeltaVPartials.block( 0, 3 * currentSegment, 1, 3 ) += deltaVPerThrottle * throttleDirection.transpose( );
+
+        // Partials of mass at start of next segment.
+        double currentTime = timesAtNodes_[ currentSegment ] +
+                ( timesAtNodes_[ currentSegment + 1 ] - timesAtNodes_[ currentSegment ] ) / 2.0;
+        double exhaustVelocity = specificImpulseFunction_( currentTime ) * physical_constants::SEA_LEVEL_GRAVITATIONAL_ACCELERATION;
+        double nextMass = segmentMasses_.at( currentSegment + 1 );
+
+        massPartials *= nextMass / currentMass * ( 1.0 + deltaVs[ currentSegment ].norm( ) / exhaustVelocity );
+        massPartials.block( 0, 3 * currentSegment, 1, 3 ) -=
+                nextMass * deltaVPerThrottle / exhaustVelocity * throttleDirection.transpose( );
+    }
+
+    // Propagate state and partials from departure to match point.
+    Eigen::Vector6d currentState = stateAtDeparture_;
+    matchPointStateForwardPropagationPartials = Eigen::MatrixXd::Zero( 6, numberOfThrottles );
+    for( int currentSegment = 0 ; currentSegment < numberSegmentsForwardPropagation_ ; currentSegment++ )
+    {
+        propagateKeplerArcWithPartials( currentState, matchPointStateForwardPropagationPartials,
+                                        segmentDurationForwardPropagation_ / 2.0, centralBodyGravitationalParameter_ );
+        currentState.segment( 3, 3 ) += deltaVs[ currentSegment ];
+        matchPointStateForwardPropagationPartials.block( 3, 0, 3, numberOfThrottles ) += deltaVPartials[ currentSegment ];
+        propagateKeplerArcWithPartials( currentState, matchPointStateForwardPropagationPartials,
+                                        segmentDurationForwardPropagation_ / 2.0, centralBodyGravitationalParameter_ );
+    }
+    stateAtMatchPointFromForwardPropagation_ = currentState;
+
+    // Propagate state and partials from arrival to match point.
+    currentState = stateAtArrival_;
+    matchPointStateBackwardPropagationPartials = Eigen::MatrixXd::Zero( 6, numberOfThrottles );
+    for( int currentSegment = numberSegments_ - 1 ; currentSegment >= numberSegmentsForwardPropagation_ ; currentSegment-- )
+    {
+        propagateKeplerArcWithPartials( currentState, matchPointStateBackwardPropagationPartials,
+                                        - segmentDurationBackwardPropagation_ / 2.0, centralBodyGravitationalParameter_ );
+        currentState.segment( 3, 3 ) -= deltaVs[ currentSegment ];
+        matchPointStateBackwardPropagationPartials.block( 3, 0, 3, numberOfThrottles ) -= deltaVPartials[ currentSegment ];
+        propagateKeplerArcWithPartials( currentState, matchPointStateBackwardPropagationPartials,
+                                        - segmentDurationBackwardPropagation_ / 2.0, centralBodyGravitationalParameter_ );
+    }
+    stateAtMatchPointFromBackwardPropagation_ = currentState;
+}
+
 //! Propagate the spacecraft trajectory from departure to match point (forward propagation).
 void SimsFlanaganModel::propagateForwardFromDepartureToMatchPoint( )
 {
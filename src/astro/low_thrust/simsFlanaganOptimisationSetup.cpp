@@ -10,12 +10,38 @@
 
 #include "tudat/astro/low_thrust/simsFlanaganOptimisationSetup.h"
 #include "tudat/astro/low_thrust/simsFlanaganModel.h"
+#include "tudat/basics/parallelization.h"
 
 namespace tudat
 {
 namespace low_thrust_trajectories
 {
 
+//! Weight of the deltaV in the optimisation objective.
+static const double SIMS_FLANAGAN_DELTA_V_WEIGHT = 1.0;
+
+//! Weight of the (squared norm of the scaled) constraint violations in the optimisation objective.
+static const double SIMS_FLANAGAN_CONSTRAINTS_WEIGHT = 10.0;
+
+//! Transform vector of design variables into 3D vector of throttles, for each segment.
+static std::vector< Eigen::Vector3d > getThrottlesFromDesignVariables(
+        const std::vector< double >& designVariables, const int numberSegments )
+{
+    // Check consistency of the size of the design variables vector.
+    if ( designVariables.size( ) != static_cast< unsigned int >( 3 * numberSegments ) )
+    {
+        throw std::runtime_error( "Error, size of the design variables vector unconsistent with number of segments." );
+    }
+
+    std::vector< Eigen::Vector3d > throttles;
+    for ( int i = 0 ; i < numberSegments ; i++ )
+    {
+        throttles.push_back( ( Eigen::Vector3d( ) << designVariables[ i * 3 ],
+                             designVariables[ i * 3 + 1 ], designVariables[ i * 3 + 2 ] ).finished( ) );
+    }
+    return throttles;
+}
+
 SimsFlanaganProblem::SimsFlanaganProblem(
         const Eigen::Vector6d &stateAtDeparture,
         const Eigen::Vector6d &stateAtArrival,
@@ -26,7 +52,8 @@ SimsFlanaganProblem::SimsFlanaganProblem(
         const int numberSegments,
         const double timeOfFlight,
         const std::pair< std::vector< double >, double > initialGuessThrustModel,
-        const double relativeToleranceConstraints ) :
+        const double relativeToleranceConstraints,
+        const int numberOfThreads ) :
     stateAtDeparture_( stateAtDeparture ),
     stateAtArrival_( stateAtArrival ),
     centralBodyGravitationalParameter_( centralBodyGravitationalParameter ),
@@ -36,7 +63,8 @@ SimsFlanaganProblem::SimsFlanaganProblem(
     numberSegments_( numberSegments ),
     timeOfFlight_( timeOfFlight ),
     initialGuessThrustModel_( initialGuessThrustModel ),
-    relativeToleranceConstraints_( relativeToleranceConstraints )
+    relativeToleranceConstraints_( relativeToleranceConstraints ),
+    numberOfThreads_( numberOfThreads )
 {
     // Retrieve initial guess.
     initialGuessThrottles_ = initialGuessThrustModel_.first;
@@ -128,19 +156,7 @@ std::pair< std::vector< double >, std::vector< double > > SimsFlanaganProblem::g
 std::vector< double > SimsFlanaganProblem::fitness( const std::vector< double > &designVariables ) const
 {
     // Transform vector of design variables into 3D vector of throttles.
-    std::vector< Eigen::Vector3d > throttles;
-
-    // Check consistency of the size of the design variables vector.
-    if ( designVariables.size( ) != static_cast< unsigned int >( 3 * numberSegments_ ) )
-    {
-        throw std::runtime_error( "Error, size of the design variables vector unconsistent with number of segments." );
-    }
-
-    for ( int i = 0 ; i < numberSegments_ ; i++ )
-    {
-        throttles.push_back( ( Eigen::Vector3d( ) << designVariables[ i * 3 ],
-                             designVariables[ i * 3 + 1 ], designVariables[ i * 3 + 2 ] ).finished( ) );
-    }
+    std::vector< Eigen::Vector3d > throttles = getThrottlesFromDesignVariables( designVariables, numberSegments_ );
 
     std::vector< double > fitness;
 
@@ -208,9 +224,8 @@ std::vector< double > SimsFlanaganProblem::fitness( const std::vector< double >
         epsilon[ equalityConstraints.size( ) + i ] = inequalityConstraints[ i ] * c[ equalityConstraints.size( ) + i ] + r[ equalityConstraints.size( ) + i ];
     }
 
-    double weightDeltaV = 1.0;
-    double weightConstraints = 10.0;
-    double optimisationObjective = weightDeltaV * deltaV + weightConstraints * ( epsilon.norm( ) * epsilon.norm( ) );
+    double optimisationObjective = SIMS_FLANAGAN_DELTA_V_WEIGHT * deltaV +
+            SIMS_FLANAGAN_CONSTRAINTS_WEIGHT * ( epsilon.norm( ) * epsilon.norm( ) );
 
 
     // Optimisation objectives
@@ -220,6 +235,84 @@ std::vector< double > SimsFlanaganProblem::fitness( const std::vector< double >
     return fitness;
 }
 
+//! Gradient of the fitness function.
+std::vector< double > SimsFlanaganProblem::gradient( const std::vector< double > &designVariables ) const
+{
+    std::vector< Eigen::Vector3d > throttles = getThrottlesFromDesignVariables( designVariables, numberSegments_ );
+
+    // Create Sims Flanagan trajectory leg, and compute partials w.r.t. throttles (also propagates to match point).
+    low_thrust_trajectories::SimsFlanaganModel currentLeg = low_thrust_trajectories::SimsFlanaganModel(
+                stateAtDeparture_, stateAtArrival_, centralBodyGravitationalParameter_, initialSpacecraftMass_,
+                maximumThrust_, specificImpulseFunction_, timeOfFlight_, throttles );
+
+    Eigen::MatrixXd deltaVPartials;
+    Eigen::MatrixXd matchPointStateForwardPropagationPartials;
+    Eigen::MatrixXd matchPointStateBackwardPropagationPartials;
+    currentLeg.computeThrottlePartials(
+                deltaVPartials, matchPointStateForwardPropagationPartials, matchPointStateBackwardPropagationPartials );
+
+    // Gradient of deltaV term.
+    Eigen::VectorXd fitnessGradient = SIMS_FLANAGAN_DELTA_V_WEIGHT * deltaVPartials.transpose( );
+
+    // Gradient of constraint term, for each constraint: d( w * epsilon^2 )/dx = 2 * w * epsilon * c * dg/dx,
+    // with epsilon = g * c + r (see fitness function).
+    double c = 1.0 / relativeToleranceConstraints_;
+    double r = 1.0 - relativeToleranceConstraints_ * c;
+
+    // Continuity of position and velocity at match point.
+    Eigen::Vector6d stateDifferenceAtMatchPoint =
+            currentLeg.getStateAtMatchPointForwardPropagation( ) - currentLeg.getStateAtMatchPointBackwardPropagation( );
+    for ( int i = 0 ; i < 6 ; i++ )
+    {
+        double constraintScaling = ( i < 3 ) ?
+                    physical_constants::ASTRONOMICAL_UNIT : stateAtDeparture_.segment( 3, 3 ).norm( );
+        double epsilon = std::fabs( stateDifferenceAtMatchPoint[ i ] ) / constraintScaling * c + r;
+        double constraintSign = ( stateDifferenceAtMatchPoint[ i ] >= 0.0 ) ? 1.0 : -1.0;
+
+        fitnessGradient += 2.0 * SIMS_FLANAGAN_CONSTRAINTS_WEIGHT * epsilon * c * constraintSign / constraintScaling *
+                ( matchPointStateForwardPropagationPartials.row( i ) - matchPointStateBackwardPropagationPartials.row( i ) ).transpose( );
+    }
+
+    // Magnitude of the normalised thrust vector.
+    for ( unsigned int currentThrottle = 0 ; currentThrottle < throttles.size( ) ; currentThrottle++ )
+    {
+        if ( throttles[ currentThrottle ].norm( ) > 1.0 )
+        {
+            double epsilon = ( throttles[ currentThrottle ].squaredNorm( ) - 1.0 ) * c + r;
+            fitnessGradient.segment( 3 * currentThrottle, 3 ) +=
+                    2.0 * SIMS_FLANAGAN_CONSTRAINTS_WEIGHT * epsilon * c * 2.0 * throttles[ currentThrottle ];
+        }
+    }
+
+    return std::vector< double >( fitnessGradient.data( ), fitnessGradient.data( ) + fitnessGradient.rows( ) );
+}
+
+//! Fitness function for a batch of design variable vectors.
+std::vector< double > SimsFlanaganProblem::batch_fitness( const std::vector< double > &designVariablesBatch ) const
+{
+    const int numberOfDesignVariables = 3 * numberSegments_;
+    if ( designVariablesBatch.size( ) % numberOfDesignVariables != 0 )
+    {
+        throw std::runtime_error( "Error in Sims-Flanagan batch fitness, size of the design variables batch (" +
+                                  std::to_string( designVariablesBatch.size( ) ) + ") is not a multiple of the number of "
+                                  "design variables (" + std::to_string( numberOfDesignVariables ) + ")." );
+    }
+
+    // Each fitness evaluation creates its own trajectory leg, so that evaluations can be done concurrently.
+    const int numberOfEvaluations = designVariablesBatch.size( ) / numberOfDesignVariables;
+    std::vector< double > fitnessBatch( numberOfEvaluations * get_nobj( ) );
+    utilities::executeParallelTasks(
+                numberOfEvaluations, [ & ]( const int evaluationIndex )
+    {
+        std::vector< double > currentFitness = fitness(
+                    std::vector< double >( designVariablesBatch.begin( ) + evaluationIndex * numberOfDesignVariables,
+                                           designVariablesBatch.begin( ) + ( evaluationIndex + 1 ) * numberOfDesignVariables ) );
+        std::copy( currentFitness.begin( ), currentFitness.end( ), fitnessBatch.begin( ) + evaluationIndex * get_nobj( ) );
+    }, numberOfThreads_ );
+
+    return fitnessBatch;
+}
+
 } // namespace low_thrust_trajectories
 
 } // namespace tudat
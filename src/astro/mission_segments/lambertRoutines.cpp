@@ -11,17 +11,17 @@
  *      Battin, R.H. An Introduction to the math and Methods of astro,
  *          AIAA Education Series, 1999.
  *      Izzo, D. lambert_problem.h, keptoolbox.
+ *      Izzo, D. Revisiting Lambert's problem, Celestial Mechanics and Dynamical Astronomy, 121:1-15, 2015.
  *      Gooding, R.H. A procedure for the solution of Lambert's orbital boundary-value problem,
  *          Celestial Mechanics and Dynamical Astronomy, 48:145-165, 1990.
  *
  */
 
+#include <algorithm>
 #include <cmath>
 #include <stdexcept>
-
-
-
-
+#include <string>
+#include <vector>
 
 #include <boost/math/special_functions.hpp>
 
@@ -32,6 +32,7 @@
 #include "tudat/math/basic/mathematicalConstants.h"
 
 #include "tudat/astro/mission_segments/lambertRoutines.h"
+#include "tudat/basics/parallelization.h"
 #include "tudat/math/basic/functionProxy.h"
 
 namespace tudat
@@ -41,260 +42,463 @@ namespace mission_segments
 
 using namespace root_finders;
 
-//! Solve Lambert Problem using Izzo's algorithm.
-void solveLambertProblemIzzo( const Eigen::Vector3d& cartesianPositionAtDeparture,
-                              const Eigen::Vector3d& cartesianPositionAtArrival,
-                              const double timeOfFlight,
-                              const double gravitationalParameter,
-                              Eigen::Vector3d& cartesianVelocityAtDeparture,
-                              Eigen::Vector3d& cartesianVelocityAtArrival,
-                              const bool isRetrograde,
-                              const double convergenceTolerance,
-                              const unsigned int maximumNumberOfIterations )
+//! Geometry of a Lambert problem in the non-dimensional formulation of Izzo (2015).
+struct LambertGeometryIzzo
 {
-    // Sanity check for specified time-of-flight.
-    if ( timeOfFlight <= 0.0 )
+    //! Lambda parameter (sign indicates short or long way).
+    double lambda;
+
+    //! Non-dimensional time of flight.
+    double normalizedTimeOfFlight;
+
+    //! Radial and transverse unit vectors at departure and arrival.
+    Eigen::Vector3d radialUnitVectorAtDeparture;
+    Eigen::Vector3d radialUnitVectorAtArrival;
+    Eigen::Vector3d transverseUnitVectorAtDeparture;
+    Eigen::Vector3d transverseUnitVectorAtArrival;
+
+    //! Radii at departure and arrival, and chord.
+    double radiusAtDeparture;
+    double radiusAtArrival;
+    double chord;
+
+    //! Velocity normalization (sqrt( mu * s / 2 ), with s the semi-perimeter).
+    double gamma;
+};
+
+//! Compute geometry of Lambert problem in the non-dimensional formulation of Izzo (2015), returns false if invalid.
+static bool computeLambertGeometryIzzo( const Eigen::Vector3d& cartesianPositionAtDeparture,
+                                        const Eigen::Vector3d& cartesianPositionAtArrival,
+                                        const double timeOfFlight,
+                                        const double gravitationalParameter,
+                                        const bool isRetrograde,
+                                        LambertGeometryIzzo& geometry )
+{
+    if( !( timeOfFlight > 0.0 ) || !( gravitationalParameter > 0.0 ) )
     {
-        // Throw exception.
-        throw std::runtime_error( "Specified time-of-flight must be strictly positive: " + std::to_string( timeOfFlight ) + " days." );
+        return false;
     }
 
-    // Compute normalizing values.
-    const double distanceNormalizingValue = cartesianPositionAtDeparture.norm( );
-    const double velocityNormalizingValue = std::sqrt( gravitationalParameter /
-                                                       distanceNormalizingValue );
-    const double timeNormalizingValue = distanceNormalizingValue / velocityNormalizingValue;
+    geometry.radiusAtDeparture = cartesianPositionAtDeparture.norm( );
+    geometry.radiusAtArrival = cartesianPositionAtArrival.norm( );
+    geometry.chord = ( cartesianPositionAtArrival - cartesianPositionAtDeparture ).norm( );
+    const double semiPerimeter = ( geometry.chord + geometry.radiusAtDeparture + geometry.radiusAtArrival ) / 2.0;
 
-    // Compute transfer geometry parameters in adimensional units.
-    // Cosine of transfer angle.
-    const double cosineOfTransferAngle =
-            cartesianPositionAtDeparture.dot( cartesianPositionAtArrival )
-            / (distanceNormalizingValue * cartesianPositionAtArrival.norm( ) );
+    geometry.radialUnitVectorAtDeparture = cartesianPositionAtDeparture / geometry.radiusAtDeparture;
+    geometry.radialUnitVectorAtArrival = cartesianPositionAtArrival / geometry.radiusAtArrival;
+    const Eigen::Vector3d angularMomentumUnitVector =
+            geometry.radialUnitVectorAtDeparture.cross( geometry.radialUnitVectorAtArrival ).normalized( );
 
-    // Normalized Cartesian position at arrival.
-    const double normalizedRadiusAtArrival = cartesianPositionAtArrival.norm( )
-            / distanceNormalizingValue;
-
-    // Chord.
-    const double chord = std::sqrt( 1.0 + normalizedRadiusAtArrival
-                                    * ( normalizedRadiusAtArrival - 2.0 * cosineOfTransferAngle ) );
-
-    // Semi-perimeter.
-    const double semiPerimeter = ( 1.0 + normalizedRadiusAtArrival + chord ) / 2.0;
-
-    // Assuming a prograde motion, determine whether the transfer corresponds to the long- or the
-    // short-way solution: longway if x1*y2 - x2*y1 < 0.
-    bool isLongway = false;
-    if ( cartesianPositionAtDeparture.x( ) * cartesianPositionAtArrival.y( )
-         - cartesianPositionAtDeparture.y( ) * cartesianPositionAtArrival.x( ) < 0.0 )
+    // Determine whether transfer is long way (assuming prograde motion about z-axis)
+    geometry.lambda = std::sqrt( std::max( 1.0 - geometry.chord / semiPerimeter, 0.0 ) );
+    if( angularMomentumUnitVector.z( ) < 0.0 )
     {
-        isLongway = true;
+        geometry.lambda = -geometry.lambda;
+        geometry.transverseUnitVectorAtDeparture =
+                geometry.radialUnitVectorAtDeparture.cross( angularMomentumUnitVector );
+        geometry.transverseUnitVectorAtArrival =
+                geometry.radialUnitVectorAtArrival.cross( angularMomentumUnitVector );
     }
-
-    // If retrograde is true, switch longway flag.
-    if ( isRetrograde )
+    else
     {
-        isLongway = !isLongway;
+        geometry.transverseUnitVectorAtDeparture =
+                angularMomentumUnitVector.cross( geometry.radialUnitVectorAtDeparture );
+        geometry.transverseUnitVectorAtArrival =
+                angularMomentumUnitVector.cross( geometry.radialUnitVectorAtArrival );
     }
 
-    // Semi-major axis of the minimum energy ellipse.
-    const double semiMajorAxisOfTheMinimumEnergyEllipse = semiPerimeter / 2.0;
-
-    // Transfer angle.
-    double transferAngle = std::acos( cosineOfTransferAngle );
-    if ( isLongway )
+    if( isRetrograde )
     {
-        transferAngle = 2.0 * mathematical_constants::PI - transferAngle;
+        geometry.lambda = -geometry.lambda;
+        geometry.transverseUnitVectorAtDeparture = -geometry.transverseUnitVectorAtDeparture;
+        geometry.transverseUnitVectorAtArrival = -geometry.transverseUnitVectorAtArrival;
     }
 
-    // Lambda parameter.
-    const double lambdaParameter = std::sqrt( normalizedRadiusAtArrival )
-            * std::cos( transferAngle / 2.0 ) / semiPerimeter;
-
-    // Optimize log(t_spec).
-    const double normalizedSpecifiedTimeOfFlight = timeOfFlight / timeNormalizingValue;
-    const double logarithmOfTheSpecifiedTimeOfFlight = std::log( normalizedSpecifiedTimeOfFlight );
-
-    // Secant Method.
-    // Define initial guesses for abcissae (x) and ordinates (y).
-    double x1 = std::log( 0.5 ), x2 = std::log( 1.5 );
-
-    double y1 = std::log( computeTimeOfFlightIzzo( -0.5, semiPerimeter, chord, isLongway,
-                                                   semiMajorAxisOfTheMinimumEnergyEllipse ) )
-            - logarithmOfTheSpecifiedTimeOfFlight;
+    geometry.normalizedTimeOfFlight = std::sqrt( 2.0 * gravitationalParameter /
+                                                 ( semiPerimeter * semiPerimeter * semiPerimeter ) ) * timeOfFlight;
+    geometry.gamma = std::sqrt( gravitationalParameter * semiPerimeter / 2.0 );
 
-    double y2 = std::log( computeTimeOfFlightIzzo( 0.5, semiPerimeter, chord, isLongway,
-                                                   semiMajorAxisOfTheMinimumEnergyEllipse ) )
-            - logarithmOfTheSpecifiedTimeOfFlight;
+    return ( geometry.normalizedTimeOfFlight == geometry.normalizedTimeOfFlight ) &&
+            ( angularMomentumUnitVector.z( ) == angularMomentumUnitVector.z( ) );
+}
 
-    // Declare and initialize root-finding parameters.
-    double rootFindingError = 1.0, xNew = 0.0, yNew = 0.0;
-    unsigned int iterator = 0;
+//! Compute non-dimensional time of flight as a function of x, using Lagrange's expression (Izzo, 2015).
+static double computeTimeOfFlightLagrangeIzzo(
+        const double xParameter, const int numberOfRevolutions, const double lambda )
+{
+    const double semiMajorAxis = 1.0 / ( 1.0 - xParameter * xParameter );
+    if( semiMajorAxis > 0.0 )
+    {
+        const double alpha = 2.0 * std::acos( xParameter );
+        double beta = 2.0 * std::asin( std::sqrt( lambda * lambda / semiMajorAxis ) );
+        if( lambda < 0.0 )
+        {
+            beta = -beta;
+        }
+        return semiMajorAxis * std::sqrt( semiMajorAxis ) *
+                ( ( alpha - std::sin( alpha ) ) - ( beta - std::sin( beta ) ) +
+                  2.0 * mathematical_constants::PI * numberOfRevolutions ) / 2.0;
+    }
+    else
+    {
+        const double alpha = 2.0 * std::acosh( xParameter );
+        double beta = 2.0 * std::asinh( std::sqrt( -lambda * lambda / semiMajorAxis ) );
+        if( lambda < 0.0 )
+        {
+            beta = -beta;
+        }
+        return -semiMajorAxis * std::sqrt( -semiMajorAxis ) *
+                ( ( beta - std::sinh( beta ) ) - ( alpha - std::sinh( alpha ) ) ) / 2.0;
+    }
+}
 
+//! Compute non-dimensional time of flight as a function of x (Izzo, 2015).
+static double computeTimeOfFlightHouseholderIzzo(
+        const double xParameter, const int numberOfRevolutions, const double lambda )
+{
+    const double battinRange = 0.01;
+    const double lagrangeRange = 0.2;
+    const double distanceToParabola = std::fabs( xParameter - 1.0 );
 
-    // Root-finding loop.
-    while ( ( rootFindingError > convergenceTolerance ) && (y1 != y2)
-            && ( iterator < maximumNumberOfIterations ) )
+    // Use Lagrange's expression in intermediate range around parabolic solution
+    if( distanceToParabola < lagrangeRange && distanceToParabola > battinRange )
     {
-        // Update iterator.
-        iterator++;
-
-        // Compute new x-value.
-        xNew = ( x1 * y2 - y1 * x2 ) / ( y2 - y1 );
+        return computeTimeOfFlightLagrangeIzzo( xParameter, numberOfRevolutions, lambda );
+    }
 
-        // Compute corresponding y-value.
-        yNew = std::log( computeTimeOfFlightIzzo( std::exp( xNew ) - 1.0, semiPerimeter, chord,
-                                                  isLongway,
-                                                  semiMajorAxisOfTheMinimumEnergyEllipse ) )
-                - logarithmOfTheSpecifiedTimeOfFlight;
+    const double lambdaSquared = lambda * lambda;
+    const double energyParameter = xParameter * xParameter - 1.0;
+    const double rho = std::fabs( energyParameter );
+    const double zParameter = std::sqrt( 1.0 + lambdaSquared * energyParameter );
 
-        // Update abcissae and ordinates.
-        x1 = x2;
-        y1 = y2;
-        x2 = xNew;
-        y2 = yNew;
+    // Use Battin's series expression close to parabolic solution
+    if( distanceToParabola < battinRange )
+    {
+        const double eta = zParameter - lambda * xParameter;
+        const double s1 = 0.5 * ( 1.0 - lambda - xParameter * eta );
 
-        // Compute root-finding error.
-        rootFindingError = std::fabs( x1 - xNew );
+        // Evaluate hypergeometric function 2F1( 3, 1, 5/2, s1 )
+        double hypergeometricSum = 1.0;
+        double hypergeometricTerm = 1.0;
+        for( unsigned int j = 0; j < 100 && std::fabs( hypergeometricTerm ) > 1.0E-11; j++ )
+        {
+            hypergeometricTerm = hypergeometricTerm * ( 3.0 + j ) * ( 1.0 + j ) / ( 2.5 + j ) * s1 / ( j + 1.0 );
+            hypergeometricSum += hypergeometricTerm;
+        }
+        const double qParameter = 4.0 / 3.0 * hypergeometricSum;
+        return ( eta * eta * eta * qParameter + 4.0 * lambda * eta ) / 2.0 +
+                numberOfRevolutions * mathematical_constants::PI / std::pow( rho, 1.5 );
     }
-
-    // Verify that root-finder has converged.
-    if ( iterator == maximumNumberOfIterations )
+    // Use Lancaster's expression otherwise
+    else
     {
-        std::string errorMessage = "Lambert Solver did not converge within the maximum number of iterations: " +
-                std::to_string( maximumNumberOfIterations );
-        throw std::runtime_error( errorMessage );
+        const double yParameter = std::sqrt( rho );
+        const double gParameter = xParameter * zParameter - lambda * energyParameter;
+        double dParameter;
+        if( energyParameter < 0.0 )
+        {
+            dParameter = numberOfRevolutions * mathematical_constants::PI + std::acos( gParameter );
+        }
+        else
+        {
+            const double fParameter = yParameter * ( zParameter - lambda * xParameter );
+            dParameter = std::log( fParameter + gParameter );
+        }
+        return ( xParameter - lambda * zParameter - dParameter / yParameter ) / energyParameter;
     }
+}
 
-    // Revert to x parameter.
-    const double xParameter = std::exp( xNew ) - 1.0;
+//! Compute first three derivatives of non-dimensional time of flight w.r.t. x (Izzo, 2015).
+static void computeTimeOfFlightDerivativesIzzo(
+        const double xParameter, const double timeOfFlight, const double lambda,
+        double& firstDerivative, double& secondDerivative, double& thirdDerivative )
+{
+    const double lambdaSquared = lambda * lambda;
+    const double lambdaCubed = lambdaSquared * lambda;
+    const double oneMinusXSquared = 1.0 - xParameter * xParameter;
+    const double yParameter = std::sqrt( 1.0 - lambdaSquared * oneMinusXSquared );
+    const double yParameterSquared = yParameter * yParameter;
+    const double yParameterCubed = yParameterSquared * yParameter;
+
+    firstDerivative = 1.0 / oneMinusXSquared * (
+                3.0 * timeOfFlight * xParameter - 2.0 + 2.0 * lambdaCubed * xParameter / yParameter );
+    secondDerivative = 1.0 / oneMinusXSquared * (
+                3.0 * timeOfFlight + 5.0 * xParameter * firstDerivative +
+                2.0 * ( 1.0 - lambdaSquared ) * lambdaCubed / yParameterCubed );
+    thirdDerivative = 1.0 / oneMinusXSquared * (
+                7.0 * xParameter * secondDerivative + 8.0 * firstDerivative -
+                6.0 * ( 1.0 - lambdaSquared ) * lambdaSquared * lambdaCubed * xParameter /
+                yParameterCubed / yParameterSquared );
+}
 
-    // Determine semi-major axis of the conic.
-    const double semiMajorAxis = semiMajorAxisOfTheMinimumEnergyEllipse
-            / ( 1.0 - xParameter * xParameter );
+//! Compute maximum number of revolutions for given non-dimensional geometry (Izzo, 2015).
+static int computeMaximumNumberOfRevolutionsFromGeometryIzzo( const double lambda, const double normalizedTimeOfFlight )
+{
+    const double lambdaSquared = lambda * lambda;
+    int maximumNumberOfRevolutions = static_cast< int >( std::floor(
+                normalizedTimeOfFlight / mathematical_constants::PI ) );
+    const double zeroRevolutionTimeAtXZero = std::acos( lambda ) + lambda * std::sqrt( 1.0 - lambdaSquared );
+    const double timeAtXZero = zeroRevolutionTimeAtXZero + maximumNumberOfRevolutions * mathematical_constants::PI;
+
+    // Compute minimum time of flight for maximum number of revolutions (Halley iterations), if required
+    if( maximumNumberOfRevolutions > 0 && normalizedTimeOfFlight < timeAtXZero )
+    {
+        double minimumTimeOfFlight = timeAtXZero;
+        double xOld = 0.0, xNew = 0.0;
+        double firstDerivative, secondDerivative, thirdDerivative;
+        for( unsigned int i = 0; i < 12; i++ )
+        {
+            computeTimeOfFlightDerivativesIzzo(
+                        xOld, minimumTimeOfFlight, lambda, firstDerivative, secondDerivative, thirdDerivative );
+            if( firstDerivative != 0.0 )
+            {
+                xNew = xOld - firstDerivative * secondDerivative /
+                        ( secondDerivative * secondDerivative - firstDerivative * thirdDerivative / 2.0 );
+            }
+            const double error = std::fabs( xOld - xNew );
+            minimumTimeOfFlight = computeTimeOfFlightHouseholderIzzo( xNew, maximumNumberOfRevolutions, lambda );
+            xOld = xNew;
+            if( error < 1.0E-13 )
+            {
+                break;
+            }
+        }
+        if( minimumTimeOfFlight > normalizedTimeOfFlight )
+        {
+            maximumNumberOfRevolutions--;
+        }
+    }
+    return maximumNumberOfRevolutions;
+}
 
-    // Declare variables.
-    double etaParameter, etaParameterSquared, psiParameter;
+//! Solve Lambert Problem using Izzo's (2015) algorithm, for a given number of revolutions and branch.
+bool solveLambertProblemIzzoHouseholder( const Eigen::Vector3d& cartesianPositionAtDeparture,
+                                         const Eigen::Vector3d& cartesianPositionAtArrival,
+                                         const double timeOfFlight,
+                                         const double gravitationalParameter,
+                                         Eigen::Vector3d& cartesianVelocityAtDeparture,
+                                         Eigen::Vector3d& cartesianVelocityAtArrival,
+                                         const int numberOfRevolutions,
+                                         const bool isRightBranch,
+                                         const bool isRetrograde,
+                                         const double convergenceTolerance,
+                                         const unsigned int maximumNumberOfIterations )
+{
+    cartesianVelocityAtDeparture.setConstant( TUDAT_NAN );
+    cartesianVelocityAtArrival.setConstant( TUDAT_NAN );
 
-    // If x < 1, the solution is an ellipse.
-    if ( xParameter < 1.0 )
+    LambertGeometryIzzo geometry;
+    if( numberOfRevolutions < 0 || !computeLambertGeometryIzzo(
+                cartesianPositionAtDeparture, cartesianPositionAtArrival, timeOfFlight, gravitationalParameter,
+                isRetrograde, geometry ) )
     {
-        // Alpha parameter.
-        const double alphaParameter = 2.0 * std::acos( xParameter );
+        return false;
+    }
 
-        // Beta parameter.
-        double betaParameter = 2.0 * std::asin( std::sqrt( ( semiPerimeter - chord )
-                                                           / ( 2.0 * semiMajorAxis ) ) );
+    const double lambda = geometry.lambda;
+    const double lambdaSquared = lambda * lambda;
+    const double lambdaCubed = lambdaSquared * lambda;
+    const double normalizedTimeOfFlight = geometry.normalizedTimeOfFlight;
 
-        if ( isLongway )
+    // Compute initial guess for x
+    double xParameter;
+    if( numberOfRevolutions == 0 )
+    {
+        const double timeAtXZero = std::acos( lambda ) + lambda * std::sqrt( 1.0 - lambdaSquared );
+        const double timeAtXOne = 2.0 / 3.0 * ( 1.0 - lambdaCubed );
+        if( normalizedTimeOfFlight >= timeAtXZero )
         {
-            betaParameter = -betaParameter;
+            xParameter = -( normalizedTimeOfFlight - timeAtXZero ) / ( normalizedTimeOfFlight - timeAtXZero + 4.0 );
+        }
+        else if( normalizedTimeOfFlight <= timeAtXOne )
+        {
+            xParameter = timeAtXOne * ( timeAtXOne - normalizedTimeOfFlight ) /
+                    ( 2.0 / 5.0 * ( 1.0 - lambdaSquared * lambdaCubed ) * normalizedTimeOfFlight ) + 1.0;
+        }
+        else
+        {
+            xParameter = std::pow( normalizedTimeOfFlight / timeAtXZero,
+                                   0.69314718055994529 / std::log( timeAtXOne / timeAtXZero ) ) - 1.0;
         }
-
-        // Psi parameter.
-        psiParameter = ( alphaParameter - betaParameter ) / 2.0;
-
-        // Eta parameter.
-        etaParameterSquared = 2.0 * semiMajorAxis * std::sin( psiParameter )
-                * std::sin( psiParameter ) / semiPerimeter;
-        etaParameter = std::sqrt( etaParameterSquared );
     }
-
-    // Otherwise it is a hyperbola.
     else
     {
-        // Alpha parameter.
-        const double alphaParameter = 2.0 * boost::math::acosh( xParameter );
-
-        // Beta parameter.
-        double betaParameter = 2.0 * boost::math::asinh (
-                    std::sqrt( ( semiPerimeter - chord ) / ( -2.0 * semiMajorAxis ) ) );
+        if( numberOfRevolutions > computeMaximumNumberOfRevolutionsFromGeometryIzzo( lambda, normalizedTimeOfFlight ) )
+        {
+            return false;
+        }
 
-        if ( isLongway )
+        if( isRightBranch )
         {
-            betaParameter = -betaParameter;
+            const double temporary = std::pow( 8.0 * normalizedTimeOfFlight /
+                                               ( numberOfRevolutions * mathematical_constants::PI ), 2.0 / 3.0 );
+            xParameter = ( temporary - 1.0 ) / ( temporary + 1.0 );
         }
+        else
+        {
+            const double temporary = std::pow( ( numberOfRevolutions * mathematical_constants::PI +
+                                                 mathematical_constants::PI ) / ( 8.0 * normalizedTimeOfFlight ),
+                                               2.0 / 3.0 );
+            xParameter = ( temporary - 1.0 ) / ( temporary + 1.0 );
+        }
+    }
 
-        // Psi parameter.
-        psiParameter = (alphaParameter - betaParameter ) / 2.0;
-
-        // Eta parameter.
-        etaParameterSquared = -2.0 * semiMajorAxis * std::sinh( psiParameter )
-                * std::sinh( psiParameter ) / semiPerimeter;
-        etaParameter = std::sqrt( etaParameterSquared );
-    }
-
-    // Determine semi-latus rectum, p.
-    const double semiLatusRectum = ( normalizedRadiusAtArrival
-                                     / ( semiMajorAxisOfTheMinimumEnergyEllipse
-                                         * etaParameterSquared ) )
-            * std::sin( transferAngle / 2.0 )
-            * std::sin( transferAngle / 2.0 );
-
-    // Determine sigma.
-    const double sigmaParameter =
-            ( 1.0 / ( etaParameter * std::sqrt( semiMajorAxisOfTheMinimumEnergyEllipse ) ) )
-            * ( 2.0 * lambdaParameter * semiMajorAxisOfTheMinimumEnergyEllipse
-                - ( lambdaParameter + xParameter * etaParameter ) );
-
-    // Velocity components at departure.
-    const double radialVelocityAtDeparture = sigmaParameter;
-    const double transverseVelocityAtDeparture = std::sqrt( semiLatusRectum );
-
-    // Velocity components at arrival.
-    const double transverseVelocityAtArrival = transverseVelocityAtDeparture
-            / normalizedRadiusAtArrival;
-    const double radialVelocityAtArrival = ( transverseVelocityAtDeparture
-                                             - transverseVelocityAtArrival )
-                                           / std::tan( transferAngle / 2.0 )
-                                           - radialVelocityAtDeparture;
-
-    // Determine radial unit vectors.
-    const Eigen::Vector3d radialUnitVectorAtDeparture = cartesianPositionAtDeparture.normalized( );
-    const Eigen::Vector3d radialUnitVectorAtArrival = cartesianPositionAtArrival.normalized( );
+    // Solve time of flight equation with Householder iterations
+    double error = 1.0;
+    unsigned int iteration = 0;
+    double firstDerivative, secondDerivative, thirdDerivative;
+    while( error > convergenceTolerance && iteration < maximumNumberOfIterations )
+    {
+        const double currentTimeOfFlight = computeTimeOfFlightHouseholderIzzo(
+                    xParameter, numberOfRevolutions, lambda );
+        computeTimeOfFlightDerivativesIzzo(
+                    xParameter, currentTimeOfFlight, lambda, firstDerivative, secondDerivative, thirdDerivative );
+        const double timeOfFlightError = currentTimeOfFlight - normalizedTimeOfFlight;
+        const double firstDerivativeSquared = firstDerivative * firstDerivative;
+        const double xNew = xParameter - timeOfFlightError *
+                ( firstDerivativeSquared - timeOfFlightError * secondDerivative / 2.0 ) /
+                ( firstDerivative * ( firstDerivativeSquared - timeOfFlightError * secondDerivative ) +
+                  thirdDerivative * timeOfFlightError * timeOfFlightError / 6.0 );
+        error = std::fabs( xParameter - xNew );
+        xParameter = xNew;
+        iteration++;
+    }
 
-    // Determine plane of motion.
-    Eigen::Vector3d angularMomentumVector;
+    if( !( error <= convergenceTolerance ) )
+    {
+        return false;
+    }
 
-    if ( isLongway )
+    // Reconstruct velocities
+    const double rho = ( geometry.radiusAtDeparture - geometry.radiusAtArrival ) / geometry.chord;
+    const double sigma = std::sqrt( 1.0 - rho * rho );
+    const double yParameter = std::sqrt( 1.0 - lambdaSquared + lambdaSquared * xParameter * xParameter );
+    const double radialVelocityAtDeparture = geometry.gamma * (
+                ( lambda * yParameter - xParameter ) - rho * ( lambda * yParameter + xParameter ) ) /
+            geometry.radiusAtDeparture;
+    const double radialVelocityAtArrival = -geometry.gamma * (
+                ( lambda * yParameter - xParameter ) + rho * ( lambda * yParameter + xParameter ) ) /
+            geometry.radiusAtArrival;
+    const double transverseVelocity = geometry.gamma * sigma * ( yParameter + lambda * xParameter );
+
+    cartesianVelocityAtDeparture = radialVelocityAtDeparture * geometry.radialUnitVectorAtDeparture +
+            transverseVelocity / geometry.radiusAtDeparture * geometry.transverseUnitVectorAtDeparture;
+    cartesianVelocityAtArrival = radialVelocityAtArrival * geometry.radialUnitVectorAtArrival +
+            transverseVelocity / geometry.radiusAtArrival * geometry.transverseUnitVectorAtArrival;
+
+    return ( cartesianVelocityAtDeparture.allFinite( ) && cartesianVelocityAtArrival.allFinite( ) );
+}
+
+//! Compute maximum number of revolutions for which a solution to the Lambert problem exists, using Izzo's algorithm.
+int computeMaximumNumberOfRevolutionsIzzo( const Eigen::Vector3d& cartesianPositionAtDeparture,
+                                           const Eigen::Vector3d& cartesianPositionAtArrival,
+                                           const double timeOfFlight,
+                                           const double gravitationalParameter,
+                                           const bool isRetrograde )
+{
+    LambertGeometryIzzo geometry;
+    if( !computeLambertGeometryIzzo( cartesianPositionAtDeparture, cartesianPositionAtArrival, timeOfFlight,
+                                     gravitationalParameter, isRetrograde, geometry ) )
     {
-        angularMomentumVector = radialUnitVectorAtArrival.cross( radialUnitVectorAtDeparture );
+        return -1;
     }
-    else
+    return computeMaximumNumberOfRevolutionsFromGeometryIzzo( geometry.lambda, geometry.normalizedTimeOfFlight );
+}
+
+//! Solve a batch of Lambert problems using Izzo's (2015) algorithm.
+int solveLambertProblemsIzzo( const Eigen::Matrix< double, Eigen::Dynamic, 3 >& cartesianPositionsAtDeparture,
+                              const Eigen::Matrix< double, Eigen::Dynamic, 3 >& cartesianPositionsAtArrival,
+                              const Eigen::VectorXd& timesOfFlight,
+                              const Eigen::VectorXd& gravitationalParameters,
+                              Eigen::Matrix< double, Eigen::Dynamic, 3 >& cartesianVelocitiesAtDeparture,
+                              Eigen::Matrix< double, Eigen::Dynamic, 3 >& cartesianVelocitiesAtArrival,
+                              const int numberOfRevolutions,
+                              const bool isRightBranch,
+                              const bool isRetrograde,
+                              const int numberOfThreads,
+                              const double convergenceTolerance,
+                              const unsigned int maximumNumberOfIterations )
+{
+    const int numberOfProblems = timesOfFlight.rows( );
+    if( cartesianPositionsAtDeparture.rows( ) != numberOfProblems ||
+            cartesianPositionsAtArrival.rows( ) != numberOfProblems ||
+            ( gravitationalParameters.rows( ) != numberOfProblems && gravitationalParameters.rows( ) != 1 ) )
     {
-        angularMomentumVector = radialUnitVectorAtDeparture.cross( radialUnitVectorAtArrival );
+        throw std::runtime_error( "Error when solving batch of " + std::to_string( numberOfProblems ) +
+                                  " Lambert problems, input sizes are inconsistent" );
     }
 
-    // Compute normalized angular momentum vector.
-    const Eigen::Vector3d angularMomentumUnitVector = angularMomentumVector.normalized( );
+    cartesianVelocitiesAtDeparture.resize( numberOfProblems, 3 );
+    cartesianVelocitiesAtArrival.resize( numberOfProblems, 3 );
 
-    // Compute transverse unit vectors.
-    const Eigen::Vector3d transverseUnitVectorAtDeparture =
-            radialUnitVectorAtDeparture.cross( angularMomentumUnitVector );
-    const Eigen::Vector3d transverseUnitVectorAtArrival =
-            radialUnitVectorAtArrival.cross( angularMomentumUnitVector );
+    // Solve the problems in contiguous blocks, one per thread
+    const int usedNumberOfThreads = std::max( 1, std::min( numberOfThreads, numberOfProblems ) );
+    std::vector< int > numberOfFailedProblems( usedNumberOfThreads, 0 );
+    auto solveProblemBlock = [ & ]( const int threadIndex )
+    {
+        const int startIndex = ( numberOfProblems * threadIndex ) / usedNumberOfThreads;
+        const int endIndex = ( numberOfProblems * ( threadIndex + 1 ) ) / usedNumberOfThreads;
 
-    // Reconstruct non-dimensional velocity vectors.
-    cartesianVelocityAtDeparture
-            << radialVelocityAtDeparture * radialUnitVectorAtDeparture.x( )
-               - transverseVelocityAtDeparture * transverseUnitVectorAtDeparture.x( ),
-            radialVelocityAtDeparture * radialUnitVectorAtDeparture.y( )
-            - transverseVelocityAtDeparture * transverseUnitVectorAtDeparture.y( ),
-            radialVelocityAtDeparture * radialUnitVectorAtDeparture.z( )
-            - transverseVelocityAtDeparture * transverseUnitVectorAtDeparture.z( );
+        Eigen::Vector3d velocityAtDeparture, velocityAtArrival;
+        for( int i = startIndex; i < endIndex; i++ )
+        {
+            if( !solveLambertProblemIzzoHouseholder(
+                        cartesianPositionsAtDeparture.row( i ).transpose( ),
+                        cartesianPositionsAtArrival.row( i ).transpose( ),
+                        timesOfFlight( i ), gravitationalParameters( gravitationalParameters.rows( ) == 1 ? 0 : i ),
+                        velocityAtDeparture, velocityAtArrival, numberOfRevolutions, isRightBranch, isRetrograde,
+                        convergenceTolerance, maximumNumberOfIterations ) )
+            {
+                numberOfFailedProblems[ threadIndex ]++;
+            }
+            cartesianVelocitiesAtDeparture.row( i ) = velocityAtDeparture.transpose( );
+            cartesianVelocitiesAtArrival.row( i ) = velocityAtArrival.transpose( );
+        }
+    };
 
-    cartesianVelocityAtArrival
-            << radialVelocityAtArrival * radialUnitVectorAtArrival.x( )
-               - transverseVelocityAtArrival * transverseUnitVectorAtArrival.x( ),
-            radialVelocityAtArrival * radialUnitVectorAtArrival.y( )
-            - transverseVelocityAtArrival * transverseUnitVectorAtArrival.y( ),
-            radialVelocityAtArrival * radialUnitVectorAtArrival.z( )
-            - transverseVelocityAtArrival * transverseUnitVectorAtArrival.z( );
+    if( usedNumberOfThreads == 1 )
+    {
+        solveProblemBlock( 0 );
+    }
+    else
+    {
+        utilities::executeParallelTasks( usedNumberOfThreads, solveProblemBlock, usedNumberOfThreads );
+    }
 
-    // Return dimensions.
-    cartesianVelocityAtDeparture *= velocityNormalizingValue;
-    cartesianVelocityAtArrival *= velocityNormalizingValue;
+    int totalNumberOfFailedProblems = 0;
+    for( int i = 0; i < usedNumberOfThreads; i++ )
+    {
+        totalNumberOfFailedProblems += numberOfFailedProblems[ i ];
+    }
+    return totalNumberOfFailedProblems;
+}
+
+//! Solve Lambert Problem using Izzo's algorithm.
+void solveLambertProblemIzzo( const Eigen::Vector3d& cartesianPositionAtDeparture,
+                              const Eigen::Vector3d& cartesianPositionAtArrival,
+                              const double timeOfFlight,
+                              const double gravitationalParameter,
+                              Eigen::Vector3d& cartesianVelocityAtDeparture,
+                              Eigen::Vector3d& cartesianVelocityAtArrival,
+                              const bool isRetrograde,
+                              const double convergenceTolerance,
+                              const unsigned int maximumNumberOfIterations )
+{
+    // Sanity check for specified time-of-flight.
+    if ( timeOfFlight <= 0.0 )
+    {
+        // Throw exception.
+        throw std::runtime_error( "Specified time-of-flight must be strictly positive: " + std::to_string( timeOfFlight ) + " days." );
+    }
 
+    if( !solveLambertProblemIzzoHouseholder(
+                cartesianPositionAtDeparture, cartesianPositionAtArrival, timeOfFlight, gravitationalParameter,
+                cartesianVelocityAtDeparture, cartesianVelocityAtArrival, 0, false, isRetrograde,
+                convergenceTolerance, maximumNumberOfIterations ) )
+    {
+        throw std::runtime_error( "Lambert Solver did not converge within the maximum number of iterations: " +
+                                  std::to_string( maximumNumberOfIterations ) );
+    }
 }
 
 //! Compute time-of-flight using Lagrange's equation.
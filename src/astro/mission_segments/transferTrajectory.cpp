@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <limits>
+
 #include "tudat/astro/mission_segments/transferTrajectory.h"
 #include "tudat/astro/low_thrust/shape_based/hodographicShapingLeg.h"
 
@@ -13,6 +16,21 @@ void TransferTrajectory::evaluateTrajectory(
         const std::vector< Eigen::VectorXd >& legFreeParameters,
         const std::vector< Eigen::VectorXd >& nodeFreeParameters )
 {
+    int numberOfNodeTimesUsed;
+    evaluateTrajectoryWithinDeltaVBudget(
+                nodeTimes, legFreeParameters, nodeFreeParameters, std::numeric_limits< double >::infinity( ),
+                numberOfNodeTimesUsed );
+}
+
+bool TransferTrajectory::evaluateTrajectoryWithinDeltaVBudget(
+        const std::vector< double >& nodeTimes,
+        const std::vector< Eigen::VectorXd >& legFreeParameters,
+        const std::vector< Eigen::VectorXd >& nodeFreeParameters,
+        const double maximumDeltaV,
+        int& numberOfNodeTimesUsed )
+{
+    isComputed_ = false;
+    numberOfNodeTimesUsed = 0;
     totalDeltaV_ = 0.0;
     totalTimeOfFlight_ = 0.0;
 
@@ -22,25 +40,40 @@ void TransferTrajectory::evaluateTrajectory(
     Eigen::VectorXd legTotalParameters;
     Eigen::VectorXd nodeTotalParameters;
 
-    // Loop over nodes and legs until all are defined
+    // Function to evaluate node, if its incoming and outgoing velocities are available
+    auto evaluateNodeIfPossible = [ & ]( const unsigned int nodeIndex )
+    {
+        if( !nodeEvaluated.at( nodeIndex ) &&
+                ( nodeIndex == 0 || nodes_.at( nodeIndex )->nodeComputesIncomingVelocity( ) ||
+                  legEvaluated.at( nodeIndex - 1 ) ) &&
+                ( nodeIndex == legs_.size( ) || nodes_.at( nodeIndex )->nodeComputesOutgoingVelocity( ) ||
+                  legEvaluated.at( nodeIndex ) ) )
+        {
+            getNodeTotalParameters( nodeTimes, nodeFreeParameters.at( nodeIndex ), nodeIndex, nodeTotalParameters );
+            nodes_.at( nodeIndex )->updateNodeParameters( nodeTotalParameters );
+            nodeEvaluated.at( nodeIndex ) = true;
+            totalDeltaV_ += nodes_.at( nodeIndex )->getNodeDeltaV( );
+            numberOfNodeTimesUsed = std::max( numberOfNodeTimesUsed, static_cast< int >( nodeIndex ) + 1 );
+        }
+        return ( totalDeltaV_ <= maximumDeltaV );
+    };
+
+    // Loop over nodes and legs until all are defined. Nodes are evaluated as soon as possible, so that the Delta V
+    // budget is checked with as few node times as possible
     unsigned int iteration = 0;
     while ( ( std::find(legEvaluated.begin(), legEvaluated.end(), false) != legEvaluated.end() ) ||
             ( std::find(nodeEvaluated.begin(), nodeEvaluated.end(), false) != nodeEvaluated.end() ) )
     {
         ++iteration;
 
-        // First node
-        if ( !nodeEvaluated.at( 0 ) && ( nodes_.at( 0 )->nodeComputesOutgoingVelocity( ) || legEvaluated.at( 0 ) ) )
-        {
-            getNodeTotalParameters( nodeTimes, nodeFreeParameters.at( 0 ), 0, nodeTotalParameters );
-            nodes_.at( 0 )->updateNodeParameters( nodeTotalParameters );
-            nodeEvaluated.at( 0 ) = true;
-            totalDeltaV_ += nodes_.at( 0 )->getNodeDeltaV( );
-        }
-
-        // Legs and intermediate nodes
         for( unsigned int i = 0; i < legs_.size( ); i++ )
         {
+            // Evaluate node i, if it computes its own outgoing velocity
+            if( !evaluateNodeIfPossible( i ) )
+            {
+                return false;
+            }
+
             // Evaluate leg i
             if ( !legEvaluated.at( i ) && (!nodes_.at( i )->nodeComputesOutgoingVelocity( ) || nodeEvaluated.at( i ) ) &&
                  (!nodes_.at( i+1 )->nodeComputesIncomingVelocity( ) || nodeEvaluated.at( i+1 ) ) )
@@ -50,31 +83,24 @@ void TransferTrajectory::evaluateTrajectory(
                 legEvaluated.at( i ) = true;
                 totalDeltaV_ += legs_.at( i )->getLegDeltaV( );
                 totalTimeOfFlight_ += legs_.at( i )->getLegTimeOfFlight( );
+                numberOfNodeTimesUsed = std::max( numberOfNodeTimesUsed, static_cast< int >( i ) + 2 );
+                if( totalDeltaV_ > maximumDeltaV )
+                {
+                    return false;
+                }
             }
 
-            // Evaluate node i+1 (as long as it isn't the last node)
-            if ( i < legs_.size( ) - 1 )
+            // Evaluate node i, if it uses the velocity of leg i
+            if( !evaluateNodeIfPossible( i ) )
             {
-                if ( !nodeEvaluated.at( i+1 ) && (nodes_.at( i+1 )->nodeComputesIncomingVelocity( ) || legEvaluated.at(i) ) &&
-                     (nodes_.at( i+1 )->nodeComputesOutgoingVelocity( ) || legEvaluated.at(i+1) ) )
-                {
-                    getNodeTotalParameters( nodeTimes, nodeFreeParameters.at( i+1 ), i+1, nodeTotalParameters );
-                    nodes_.at( i+1 )->updateNodeParameters( nodeTotalParameters );
-                    nodeEvaluated.at( i+1 ) = true;
-                    totalDeltaV_ += nodes_.at( i+1 )->getNodeDeltaV( );
-
-                }
+                return false;
             }
         }
 
         // Last node
-        if ( !nodeEvaluated.at( legs_.size( ) ) && ( nodes_.at( legs_.size( ) )->nodeComputesIncomingVelocity( ) ||
-                                                     legEvaluated.at( legs_.size( )-1 ) ) )
+        if( !evaluateNodeIfPossible( legs_.size( ) ) )
         {
-            getNodeTotalParameters(nodeTimes, nodeFreeParameters.at( legs_.size( ) ), legs_.size( ), nodeTotalParameters );
-            nodes_.at( legs_.size( ) )->updateNodeParameters( nodeTotalParameters );
-            nodeEvaluated.at( legs_.size( ) ) = true;
-            totalDeltaV_ += nodes_.at( legs_.size( ) )->getNodeDeltaV( );
+            return false;
         }
 
         if (iteration > legs_.size( ) + nodes_.size() )
@@ -85,6 +111,7 @@ void TransferTrajectory::evaluateTrajectory(
     }
 
     isComputed_ = true;
+    return true;
 }
 
 double TransferTrajectory::getTotalDeltaV( )
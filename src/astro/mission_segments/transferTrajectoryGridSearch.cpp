@@ -0,0 +1,269 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include "tudat/astro/mission_segments/transferTrajectoryGridSearch.h"
+#include "tudat/basics/parallelization.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace mission_segments
+{
+
+//! Constructor
+TransferTrajectoryGridSearch::TransferTrajectoryGridSearch(
+        const std::vector< std::shared_ptr< TransferTrajectory > >& workerTrajectories,
+        const std::vector< Eigen::VectorXd >& legFreeParameters,
+        const std::vector< Eigen::VectorXd >& nodeFreeParameters ):
+    workerTrajectories_( workerTrajectories ), legFreeParameters_( legFreeParameters ),
+    nodeFreeParameters_( nodeFreeParameters ), numberOfPrunedEvaluations_( 0 )
+{
+    if( workerTrajectories_.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when creating transfer trajectory grid search, no trajectories provided" );
+    }
+
+    const int numberOfLegs = workerTrajectories_.at( 0 )->getNumberOfLegs( );
+    const int numberOfNodes = workerTrajectories_.at( 0 )->getNumberOfNodes( );
+    for( unsigned int i = 0; i < workerTrajectories_.size( ); i++ )
+    {
+        if( workerTrajectories_.at( i )->getNumberOfLegs( ) != numberOfLegs ||
+                workerTrajectories_.at( i )->getNumberOfNodes( ) != numberOfNodes )
+        {
+            throw std::runtime_error( "Error when creating transfer trajectory grid search, trajectories of workers 0 and " +
+                                      std::to_string( i ) + " are inconsistent" );
+        }
+
+        for( unsigned int j = 0; j < i; j++ )
+        {
+            if( workerTrajectories_.at( i ) == workerTrajectories_.at( j ) ||
+                    workerTrajectories_.at( i )->getLegs( ).at( 0 ) == workerTrajectories_.at( j )->getLegs( ).at( 0 ) )
+            {
+                throw std::runtime_error( "Error when creating transfer trajectory grid search, trajectories of workers " +
+                                          std::to_string( j ) + " and " + std::to_string( i ) + " share legs" );
+            }
+        }
+    }
+
+    // Set default (empty) free parameters
+    if( legFreeParameters_.size( ) == 0 )
+    {
+        legFreeParameters_.resize( numberOfLegs, Eigen::VectorXd::Zero( 0 ) );
+    }
+    if( nodeFreeParameters_.size( ) == 0 )
+    {
+        nodeFreeParameters_.resize( numberOfNodes, Eigen::VectorXd::Zero( 0 ) );
+    }
+
+    if( static_cast< int >( legFreeParameters_.size( ) ) != numberOfLegs ||
+            static_cast< int >( nodeFreeParameters_.size( ) ) != numberOfNodes )
+    {
+        throw std::runtime_error( "Error when creating transfer trajectory grid search, number of leg (" +
+                                  std::to_string( legFreeParameters_.size( ) ) + ") or node (" +
+                                  std::to_string( nodeFreeParameters_.size( ) ) +
+                                  ") free parameter vectors is inconsistent with trajectory" );
+    }
+}
+
+//! Function to evaluate a single trajectory with a given worker
+double TransferTrajectoryGridSearch::evaluateSingleTrajectory(
+        const int workerIndex,
+        const std::vector< double >& nodeTimes,
+        const double maximumDeltaV,
+        int& numberOfNodeTimesUsed )
+{
+    const std::shared_ptr< TransferTrajectory > trajectory = workerTrajectories_.at( workerIndex );
+    try
+    {
+        if( trajectory->evaluateTrajectoryWithinDeltaVBudget(
+                    nodeTimes, legFreeParameters_, nodeFreeParameters_, maximumDeltaV, numberOfNodeTimesUsed ) )
+        {
+            return trajectory->getTotalDeltaV( );
+        }
+        else
+        {
+            return std::numeric_limits< double >::infinity( );
+        }
+    }
+    catch( const std::exception& )
+    {
+        // Failure may depend on any of the node times, so nothing can be pruned
+        numberOfNodeTimesUsed = trajectory->getNumberOfNodes( );
+        return TUDAT_NAN;
+    }
+}
+
+//! Function to evaluate the total Delta V of the trajectory for a batch of node times
+Eigen::VectorXd TransferTrajectoryGridSearch::evaluateTotalDeltaV(
+        const std::vector< std::vector< double > >& nodeTimesList,
+        const double maximumDeltaV )
+{
+    const int numberOfWorkers = workerTrajectories_.size( );
+    const int numberOfEvaluations = nodeTimesList.size( );
+    Eigen::VectorXd totalDeltaV = Eigen::VectorXd::Constant( numberOfEvaluations, TUDAT_NAN );
+
+    utilities::executeParallelTasks(
+                numberOfWorkers, [ & ]( const int workerIndex )
+    {
+        int numberOfNodeTimesUsed;
+        for( int i = workerIndex; i < numberOfEvaluations; i += numberOfWorkers )
+        {
+            totalDeltaV( i ) = evaluateSingleTrajectory(
+                        workerIndex, nodeTimesList.at( i ), maximumDeltaV, numberOfNodeTimesUsed );
+        }
+    }, numberOfWorkers );
+
+    numberOfPrunedEvaluations_ = 0;
+    return totalDeltaV;
+}
+
+//! Function to evaluate the total Delta V of the trajectory on a grid of departure times and times of flight
+Eigen::VectorXd TransferTrajectoryGridSearch::evaluateTotalDeltaVOnGrid(
+        const std::vector< double >& departureTimes,
+        const std::vector< std::vector< double > >& timesOfFlightPerLeg,
+        const double maximumDeltaV )
+{
+    const int numberOfNodes = workerTrajectories_.at( 0 )->getNumberOfNodes( );
+    if( static_cast< int >( timesOfFlightPerLeg.size( ) ) != numberOfNodes - 1 )
+    {
+        throw std::runtime_error( "Error in transfer trajectory grid search, times of flight provided for " +
+                                  std::to_string( timesOfFlightPerLeg.size( ) ) + " legs, but trajectory has " +
+                                  std::to_string( numberOfNodes - 1 ) + " legs" );
+    }
+
+    // Determine size of grid, and stride of each node time index in (row-major) output
+    std::vector< int > gridSize( numberOfNodes );
+    gridSize.at( 0 ) = departureTimes.size( );
+    for( int j = 1; j < numberOfNodes; j++ )
+    {
+        gridSize.at( j ) = timesOfFlightPerLeg.at( j - 1 ).size( );
+    }
+    std::vector< int > gridStrides( numberOfNodes, 1 );
+    for( int j = numberOfNodes - 2; j >= 0; j-- )
+    {
+        gridStrides.at( j ) = gridStrides.at( j + 1 ) * gridSize.at( j + 1 );
+    }
+    const int numberOfGridPoints = gridStrides.at( 0 ) * gridSize.at( 0 );
+
+    Eigen::VectorXd totalDeltaV = Eigen::VectorXd::Constant( numberOfGridPoints, TUDAT_NAN );
+    if( numberOfGridPoints == 0 )
+    {
+        numberOfPrunedEvaluations_ = 0;
+        return totalDeltaV;
+    }
+
+    // Each worker evaluates the grid points for a subset of the departure times, iterating over the times of flight
+    // in row-major order, so that pruned grid points with identical leading node times are contiguous
+    const int numberOfWorkers = workerTrajectories_.size( );
+    std::atomic< int > numberOfPrunedEvaluations( 0 );
+    utilities::executeParallelTasks(
+                numberOfWorkers, [ & ]( const int workerIndex )
+    {
+        std::vector< int > gridIndices( numberOfNodes );
+        std::vector< double > nodeTimes( numberOfNodes );
+        int numberOfNodeTimesUsed;
+        for( int departureIndex = workerIndex; departureIndex < gridSize.at( 0 ); departureIndex += numberOfWorkers )
+        {
+            std::fill( gridIndices.begin( ), gridIndices.end( ), 0 );
+            gridIndices.at( 0 ) = departureIndex;
+
+            bool isDepartureTimeFinished = false;
+            while( !isDepartureTimeFinished )
+            {
+                // Compute node times, and index of grid point
+                int gridPointIndex = departureIndex * gridStrides.at( 0 );
+                nodeTimes.at( 0 ) = departureTimes.at( departureIndex );
+                for( int j = 1; j < numberOfNodes; j++ )
+                {
+                    nodeTimes.at( j ) = nodeTimes.at( j - 1 ) + timesOfFlightPerLeg.at( j - 1 ).at( gridIndices.at( j ) );
+                    gridPointIndex += gridIndices.at( j ) * gridStrides.at( j );
+                }
+
+                totalDeltaV( gridPointIndex ) = evaluateSingleTrajectory(
+                            workerIndex, nodeTimes, maximumDeltaV, numberOfNodeTimesUsed );
+
+                // If budget is exceeded, prune remaining grid points with identical leading node times
+                int lastIncrementedIndex = numberOfNodes - 1;
+                if( std::isinf( totalDeltaV( gridPointIndex ) ) )
+                {
+                    lastIncrementedIndex = std::max( numberOfNodeTimesUsed - 1, 0 );
+                    int lastPrunedGridPointIndex = gridPointIndex;
+                    for( int j = lastIncrementedIndex + 1; j < numberOfNodes; j++ )
+                    {
+                        lastPrunedGridPointIndex += ( gridSize.at( j ) - 1 - gridIndices.at( j ) ) * gridStrides.at( j );
+                    }
+                    totalDeltaV.segment( gridPointIndex, lastPrunedGridPointIndex - gridPointIndex + 1 ).setConstant(
+                                std::numeric_limits< double >::infinity( ) );
+                    numberOfPrunedEvaluations += lastPrunedGridPointIndex - gridPointIndex;
+                }
+
+                // Move to next grid point
+                for( int j = lastIncrementedIndex + 1; j < numberOfNodes; j++ )
+                {
+                    gridIndices.at( j ) = 0;
+                }
+                int currentIndex = lastIncrementedIndex;
+                while( true )
+                {
+                    if( currentIndex == 0 )
+                    {
+                        isDepartureTimeFinished = true;
+                        break;
+                    }
+                    gridIndices.at( currentIndex )++;
+                    if( gridIndices.at( currentIndex ) < gridSize.at( currentIndex ) )
+                    {
+                        break;
+                    }
+                    gridIndices.at( currentIndex ) = 0;
+                    currentIndex--;
+                }
+            }
+        }
+    }, numberOfWorkers );
+
+    numberOfPrunedEvaluations_ = numberOfPrunedEvaluations;
+    return totalDeltaV;
+}
+
+//! Function to compute the total Delta V of a single-leg trajectory, for a porkchop plot
+Eigen::MatrixXd TransferTrajectoryGridSearch::computePorkchopDeltaV(
+        const std::vector< double >& departureTimes,
+        const std::vector< double >& timesOfFlight,
+        const double maximumDeltaV )
+{
+    if( workerTrajectories_.at( 0 )->getNumberOfLegs( ) != 1 )
+    {
+        throw std::runtime_error( "Error when computing porkchop Delta V, trajectory has " +
+                                  std::to_string( workerTrajectories_.at( 0 )->getNumberOfLegs( ) ) +
+                                  " legs, only single-leg trajectories are supported" );
+    }
+
+    const Eigen::VectorXd totalDeltaV = evaluateTotalDeltaVOnGrid( departureTimes, { timesOfFlight }, maximumDeltaV );
+
+    // Grid is stored in row-major order
+    Eigen::MatrixXd porkchopDeltaV( departureTimes.size( ), timesOfFlight.size( ) );
+    for( unsigned int i = 0; i < departureTimes.size( ); i++ )
+    {
+        porkchopDeltaV.row( i ) = totalDeltaV.segment( i * timesOfFlight.size( ), timesOfFlight.size( ) ).transpose( );
+    }
+    return porkchopDeltaV;
+}
+
+} // namespace mission_segments
+
+} // namespace tudat
@@ -20,6 +20,23 @@ namespace tudat
 namespace observation_models
 {
 
+//! Function to evaluate the positions and gravitational parameters of all perturbing bodies for given link end times
+void FirstOrderLightTimeCorrectionCalculator::updatePerturbingBodyStates(
+        const double transmissionTime, const double receptionTime )
+{
+    currentPpnParameterGamma_ = ppnParameterGammaFunction_( );
+    for( unsigned int i = 0; i < perturbingBodyStateFunctions_.size( ); i++ )
+    {
+        currentPerturbingBodyPositions_.col( i ) = perturbingBodyStateFunctions_[ i ](
+                    transmissionTime + lightTimeEvaluationContribution_.at( i ) * ( receptionTime - transmissionTime ) ).
+                segment( 0, 3 );
+        currentPerturbingBodyGravitationalParameters_( i ) = perturbingBodyGravitationalParameterFunctions_[ i ]( );
+    }
+
+    currentTransmissionTime_ = transmissionTime;
+    currentReceptionTime_ = receptionTime;
+}
+
 //! Function to calculate first order relativistic light time correction due to set of gravitating point masses.
 double FirstOrderLightTimeCorrectionCalculator::calculateLightTimeCorrection(
         const Eigen::Vector6d& transmitterState,
@@ -27,23 +44,19 @@ double FirstOrderLightTimeCorrectionCalculator::calculateLightTimeCorrection(
         const double transmissionTime,
         const double receptionTime )
 {
-    // Retrieve ppn parameter gamma.
-    double ppnParameterGamma = ppnParameterGammaFunction_( );
+    // Evaluate perturbing bodies (always re-evaluated here, since the environment may have changed since the previous call)
+    updatePerturbingBodyStates( transmissionTime, receptionTime );
 
-    // Initialize correction to zero.
-    currentTotalLightTimeCorrection_ = 0.0;
+    // Calculate correction due to all bodies, and add to total.
+    Eigen::VectorXd lightTimeCorrectionComponents = relativity::calculateFirstOrderLightTimeCorrectionsFromCentralBodies(
+                currentPerturbingBodyGravitationalParameters_,
+                transmitterState.segment( 0, 3 ), receiverState.segment( 0, 3 ),
+                currentPerturbingBodyPositions_, currentPpnParameterGamma_ );
 
-    double evaluationTime = TUDAT_NAN;
-    // Iterate over all gravitating bodies.
-    for( unsigned int i = 0; i < perturbingBodyStateFunctions_.size( ); i++ )
+    currentTotalLightTimeCorrection_ = 0.0;
+    for( unsigned int i = 0; i < currentLighTimeCorrectionComponents_.size( ); i++ )
     {
-        evaluationTime = transmissionTime + lightTimeEvaluationContribution_.at( i ) * ( receptionTime - transmissionTime );
-        // Calculate correction due to current body and add to total.
-        currentLighTimeCorrectionComponents_[ i ] = relativity::calculateFirstOrderLightTimeCorrectionFromCentralBody(
-                    perturbingBodyGravitationalParameterFunctions_[ i ]( ),
-                    transmitterState.segment( 0, 3 ), receiverState.segment( 0, 3 ),
-                    perturbingBodyStateFunctions_[ i ]( evaluationTime ).segment( 0, 3 ),
-                    ppnParameterGamma );
+        currentLighTimeCorrectionComponents_[ i ] = lightTimeCorrectionComponents( i );
         currentTotalLightTimeCorrection_ += currentLighTimeCorrectionComponents_[ i ];
     }
 
@@ -59,29 +72,25 @@ calculateLightTimeCorrectionPartialDerivativeWrtLinkEndPosition(
         const double receptionTime,
         const LinkEndType linkEndAtWhichPartialIsEvaluated )
 {
-    // Retrieve ppn parameter gamma.
-    double ppnParameterGamma = ppnParameterGammaFunction_( );
+    // Evaluate perturbing bodies, if not yet done for current link end times
+    if( !( transmissionTime == currentTransmissionTime_ && receptionTime == currentReceptionTime_ ) )
+    {
+        updatePerturbingBodyStates( transmissionTime, receptionTime );
+    }
 
     // Initialize correction to zero.
     Eigen::Matrix< double, 3, 1 > currentTotalLightTimeCorrectionPartial_ = Eigen::Matrix< double, 3, 1 >::Zero( );
 
-    double evaluationTime = TUDAT_NAN;
-
-    Eigen::Vector6d perturbingBodyState;
     // Iterate over all gravitating bodies.
     for( unsigned int i = 0; i < perturbingBodyStateFunctions_.size( ); i++ )
     {
-        evaluationTime = transmissionTime + lightTimeEvaluationContribution_.at( i ) * ( receptionTime - transmissionTime );
-
-        perturbingBodyState = perturbingBodyStateFunctions_[ i ]( evaluationTime );
-
         // Calculate correction due to current body and add to total.
         currentTotalLightTimeCorrectionPartial_ += relativity::calculateFirstOrderCentralBodyLightTimeCorrectionGradient(
-                    perturbingBodyGravitationalParameterFunctions_[ i ]( ),
+                    currentPerturbingBodyGravitationalParameters_( i ),
                     transmitterState.segment( 0, 3 ), receiverState.segment( 0, 3 ),
-                    perturbingBodyStateFunctions_[ i ]( evaluationTime ).segment( 0, 3 ),
+                    currentPerturbingBodyPositions_.col( i ),
                 ( linkEndAtWhichPartialIsEvaluated == receiver ),
-                ppnParameterGamma );
+                currentPpnParameterGamma_ );
     }
 
     return currentTotalLightTimeCorrectionPartial_;
@@ -8,6 +8,7 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include "tudat/math/basic/linearAlgebra.h"
 #include "tudat/astro/orbit_determination/acceleration_partials/aerodynamicAccelerationPartial.h"
 
 namespace tudat
@@ -16,8 +17,84 @@ namespace tudat
 namespace acceleration_partials
 {
 
-//! Function for updating partial w.r.t. the bodies' positions
-void AerodynamicAccelerationPartial::update( const double currentTime )
+//! Function to check whether the models used for the acceleration allow the state partials to be computed analytically
+bool AerodynamicAccelerationPartial::checkAnalyticalStatePartialSupport( )
+{
+    if( !centralBodyAngularVelocityFunction_ )
+    {
+        return false;
+    }
+
+    // Wind velocity would introduce additional position dependency of airspeed
+    if( flightConditions_->getAerodynamicAngleCalculator( )->getWindModel( ) != nullptr )
+    {
+        return false;
+    }
+
+    std::shared_ptr< aerodynamics::AerodynamicCoefficientInterface > coefficientInterface =
+            flightConditions_->getAerodynamicCoefficientInterface( );
+    if( coefficientInterface == nullptr || coefficientInterface->getNumberOfControlSurfaces( ) > 0 )
+    {
+        return false;
+    }
+
+    // Drag force is only along airspeed velocity if coefficients are given in aerodynamic frame
+    if( coefficientInterface->getForceCoefficientsFrame( ) != aerodynamics::negative_aerodynamic_frame_coefficients &&
+            coefficientInterface->getForceCoefficientsFrame( ) != aerodynamics::positive_aerodynamic_frame_coefficients )
+    {
+        return false;
+    }
+
+    // Coefficients may only depend on time (not on state-dependent variables)
+    std::vector< aerodynamics::AerodynamicCoefficientsIndependentVariables > independentVariables =
+            coefficientInterface->getIndependentVariableNames( );
+    for( unsigned int i = 0; i < independentVariables.size( ); i++ )
+    {
+        if( independentVariables.at( i ) != aerodynamics::time_dependent )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//! Function to compute the state partials analytically from the current flight conditions
+void AerodynamicAccelerationPartial::computeAnalyticalStatePartials( )
+{
+    Eigen::Vector3d currentAcceleration = aerodynamicAcceleration_->getAcceleration( );
+    double currentDensity = flightConditions_->getCurrentDensity( );
+
+    if( currentDensity == 0.0 )
+    {
+        currentAccelerationStatePartials_.setZero( );
+        return;
+    }
+
+    // Retrieve airspeed-based velocity in inertial frame
+    Eigen::Quaterniond rotationToInertialFrame =
+            flightConditions_->getAerodynamicAngleCalculator( )->getRotationQuaternionBetweenFrames(
+                reference_frames::corotating_frame, reference_frames::inertial_frame );
+    Eigen::Vector3d airspeedVelocity = rotationToInertialFrame * flightConditions_->getCurrentAirspeedBasedVelocity( );
+    double airspeed = airspeedVelocity.norm( );
+    Eigen::Vector3d airspeedDirection = airspeedVelocity / airspeed;
+
+    // Acceleration is parallel to airspeed velocity: a = k * density * airspeed * airspeedVelocity
+    double accelerationMultiplier = currentAcceleration.dot( airspeedDirection ) / airspeed;
+    Eigen::Matrix3d partialWrtAirspeedVelocity = accelerationMultiplier * (
+                Eigen::Matrix3d::Identity( ) + airspeedDirection * airspeedDirection.transpose( ) );
+
+    // Compute partial w.r.t. position, from density gradient and rotation of atmosphere
+    Eigen::Vector3d densityGradient = rotationToInertialFrame * flightConditions_->getCurrentDensityGradient(
+                bodyStatePerturbations_( 0 ) );
+    currentAccelerationStatePartials_.block( 0, 0, 3, 3 ) =
+            currentAcceleration * densityGradient.transpose( ) / currentDensity -
+            partialWrtAirspeedVelocity * linear_algebra::getCrossProductMatrix( centralBodyAngularVelocityFunction_( ) );
+    currentAccelerationStatePartials_.block( 0, 3, 3, 3 ) = partialWrtAirspeedVelocity;
+}
+
+//! Function to compute the state partials numerically, by updating the flight conditions and acceleration for perturbed states
+void AerodynamicAccelerationPartial::computeNumericalStatePartials( const double currentTime )
 {
     Eigen::Vector6d nominalState = vehicleStateGetFunction_( );
     Eigen::Vector6d perturbedState;
@@ -66,6 +143,30 @@ void AerodynamicAccelerationPartial::update( const double currentTime )
     vehicleStateSetFunction_( nominalState );
     flightConditions_->updateConditions( currentTime );
     aerodynamicAcceleration_->updateMembers( currentTime );
+}
+
+
+//! Function for updating partial w.r.t. the bodies' positions
+void AerodynamicAccelerationPartial::update( const double currentTime )
+{
+    // Analytical partials require a pure drag force along the airspeed velocity
+    areStatePartialsAnalytical_ = false;
+    if( areAnalyticalStatePartialsSupported_ )
+    {
+        Eigen::Vector3d currentForceCoefficients =
+                flightConditions_->getAerodynamicCoefficientInterface( )->getCurrentForceCoefficients( );
+        areStatePartialsAnalytical_ = ( currentForceCoefficients( 1 ) == 0.0 && currentForceCoefficients( 2 ) == 0.0 &&
+                                        flightConditions_->getCurrentAirspeed( ) > 0.0 );
+    }
+
+    if( areStatePartialsAnalytical_ )
+    {
+        computeAnalyticalStatePartials( );
+    }
+    else
+    {
+        computeNumericalStatePartials( currentTime );
+    }
 
     currentTime_ = currentTime;
 }
@@ -199,12 +199,9 @@ void EmpiricalAccelerationPartial::wrtArcWiseEmpiricalAccelerationCoefficient(
     partialDerivativeMatrix = Eigen::MatrixXd::Zero( 3, parameter->getParameterSize( ) );
 
     // Retrieve arc of current time.
-    std::shared_ptr< interpolators::LookUpScheme< double > > currentArcIndexLookUp =
-            parameter->getArcTimeLookupScheme( );
-    if( currentArcIndexLookUp->getMinimumValue( ) <= currentTime_ )
+    int currentArc = parameter->getArcCursor( )->getArcIndex( currentTime_ );
+    if( currentArc >= 0 )
     {
-        int currentArc = currentArcIndexLookUp->findNearestLowerNeighbour( currentTime_ );
-
         // Set current partial matrix
         partialDerivativeMatrix.block(
                     0, currentArc * singleArcParameterSize, 3, singleArcParameterSize ) =
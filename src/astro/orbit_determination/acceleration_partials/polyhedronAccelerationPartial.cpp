@@ -11,6 +11,7 @@
 #include "tudat/astro/orbit_determination/acceleration_partials/polyhedronAccelerationPartial.h"
 #include "tudat/math/basic/polyhedron.h"
 #include "tudat/astro/orbit_determination/acceleration_partials/centralGravityAccelerationPartial.h"
+#include "tudat/astro/orbit_determination/acceleration_partials/sphericalHarmonicPartialFunctions.h"
 
 namespace tudat
 {
@@ -27,8 +28,7 @@ PolyhedronGravityPartial::PolyhedronGravityPartial (
     gravitationalParameterFunction_( accelerationModel->getGravitationalParameterFunction( ) ),
     volumeFunction_( accelerationModel->getVolumeFunction( ) ),
     polyhedronCache_( accelerationModel->getPolyhedronCache() ),
-    facetDyads_( accelerationModel->getFacetDyadsFunction( )( ) ),
-    edgeDyads_( accelerationModel->getEdgeDyadsFunction( )( ) ),
+    accelerationModel_( accelerationModel ),
     positionFunctionOfAcceleratedBody_( std::bind( &gravitation::PolyhedronGravitationalAccelerationModel::
                                                    getCurrentPositionOfBodySubjectToAcceleration, accelerationModel ) ),
     positionFunctionOfAcceleratingBody_( std::bind( &gravitation::PolyhedronGravitationalAccelerationModel::
@@ -41,7 +41,11 @@ PolyhedronGravityPartial::PolyhedronGravityPartial (
                                 accelerationModel, std::placeholders::_1 ) ),
     rotationMatrixPartials_( rotationMatrixPartials )
 {
-
+    if( accelerationModel->getFarFieldAccelerationModel( ) != nullptr )
+    {
+        accelerationModel->getFarFieldAccelerationModel( )->getSphericalHarmonicsCache( )->getLegendreCache( )->
+                setComputeSecondDerivatives( 1 );
+    }
 }
 
 void PolyhedronGravityPartial::update( const double currentTime )
@@ -57,11 +61,34 @@ void PolyhedronGravityPartial::update( const double currentTime )
         Eigen::Matrix3d currentRotationToBodyFixedFrame_ = fromBodyFixedToIntegrationFrameRotation_( ).inverse( );
 
         // Calculate partial of acceleration wrt position of body undergoing acceleration.
-        currentBodyFixedPartialWrtPosition_ = basic_mathematics::calculatePolyhedronHessianOfGravitationalPotential(
-                gravitationalParameterFunction_() / volumeFunction_(),
-                facetDyads_, edgeDyads_,
-                polyhedronCache_->getPerFacetFactor(),
-                polyhedronCache_->getPerEdgeFactor() );
+        const double farFieldWeight = accelerationModel_->getCurrentFarFieldWeight( );
+        currentBodyFixedPartialWrtPosition_.setZero( );
+        if( farFieldWeight < 1.0 )
+        {
+            currentBodyFixedPartialWrtPosition_ = ( 1.0 - farFieldWeight ) * polyhedronCache_->getHessianOfPotential(
+                    gravitationalParameterFunction_() / volumeFunction_() );
+        }
+
+        // Add partial of far-field model, and of blending weight, if required
+        if( farFieldWeight > 0.0 )
+        {
+            std::shared_ptr< gravitation::SphericalHarmonicsGravitationalAccelerationModel > farFieldAccelerationModel =
+                    accelerationModel_->getFarFieldAccelerationModel( );
+            const Eigen::Vector3d bodyFixedPosition = accelerationModel_->getCurrentRelativePosition( );
+
+            currentBodyFixedPartialWrtPosition_ += farFieldWeight *
+                    computePartialDerivativeOfBodyFixedSphericalHarmonicAcceleration(
+                        bodyFixedPosition,
+                        farFieldAccelerationModel->getReferenceRadius( ),
+                        farFieldAccelerationModel->getGravitationalParameterFunction( )( ),
+                        farFieldAccelerationModel->getCosineHarmonicCoefficientsFunction( )( ),
+                        farFieldAccelerationModel->getSineHarmonicCoefficientsFunction( )( ),
+                        farFieldAccelerationModel->getSphericalHarmonicsCache( ) );
+
+            currentBodyFixedPartialWrtPosition_ +=
+                    accelerationModel_->getCurrentFarFieldAccelerationCorrectionInBodyFixedFrame( ) *
+                    ( accelerationModel_->getCurrentFarFieldWeightDerivative( ) * bodyFixedPosition.normalized( ) ).transpose( );
+        }
 
         currentPartialWrtVelocity_.setZero( );
         currentPartialWrtPosition_.setZero( );
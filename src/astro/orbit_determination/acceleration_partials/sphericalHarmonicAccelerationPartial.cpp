@@ -30,6 +30,7 @@ SphericalHarmonicsGravityPartial::SphericalHarmonicsGravityPartial(
         const std::vector< std::shared_ptr< orbit_determination::TidalLoveNumberPartialInterface > >&
         tidalLoveNumberPartialInterfaces ):
     AccelerationPartial( acceleratedBody, acceleratingBody, basic_astrodynamics::spherical_harmonic_gravity ),
+    accelerationModel_( accelerationModel ),
     gravitationalParameterFunction_( accelerationModel->getGravitationalParameterFunction( ) ),
     bodyReferenceRadius_( std::bind( &gravitation::SphericalHarmonicsGravitationalAccelerationModel::getReferenceRadius,
                                      accelerationModel ) ),
@@ -320,28 +321,33 @@ void SphericalHarmonicsGravityPartial::update( const double currentTime )
         // Update acceleration model
         updateFunction_( currentTime );
 
-        // Calculate Cartesian position in frame fixed to body exerting acceleration
+        // Retrieve Cartesian position in frame fixed to body exerting acceleration, as used by acceleration model (so that
+        // the spherical harmonics cache, which it shares with the acceleration, need not be recomputed)
         Eigen::Matrix3d currentRotationToBodyFixedFrame_ = fromBodyFixedToIntegrationFrameRotation_( ).inverse( );
-        bodyFixedPosition_ = currentRotationToBodyFixedFrame_ *
-                ( positionFunctionOfAcceleratedBody_( ) - positionFunctionOfAcceleratingBody_( ) );
+        bodyFixedPosition_ = accelerationModel_->getCurrentRelativePosition( );
 
         // Calculate spherical position in frame fixed to body exerting acceleration
         bodyFixedSphericalPosition_ = convertCartesianToSpherical( bodyFixedPosition_ );
         bodyFixedSphericalPosition_( 1 ) = mathematical_constants::PI / 2.0 - bodyFixedSphericalPosition_( 1 );
 
-        // Get spherical harmonic coefficients
-        currentCosineCoefficients_ = cosineCoefficients_( );
-        currentSineCoefficients_ = sineCoefficients_( );
+        // Get spherical harmonic coefficients, as used by acceleration model at current time
+        currentCosineCoefficients_ = accelerationModel_->getCurrentCosineHarmonicCoefficients( );
+        currentSineCoefficients_ = accelerationModel_->getCurrentSineHarmonicCoefficients( );
 
         // Update trogonometric functions of multiples of longitude.
         sphericalHarmonicCache_->update(
                     bodyFixedSphericalPosition_( 0 ), std::sin( bodyFixedSphericalPosition_( 1 ) ),
                     bodyFixedSphericalPosition_( 2 ), bodyReferenceRadius_( ) );
 
-        // Calculate partial of acceleration wrt position of body undergoing acceleration.
+        // Calculate partial of acceleration wrt position of body undergoing acceleration. The spherical potential gradient
+        // is retrieved from the body-fixed acceleration of the acceleration model, so that only the second derivatives
+        // of the potential are computed here (from the Legendre polynomials in the shared cache).
+        currentSphericalToCartesianGradientMatrix_ = getSphericalToCartesianGradientMatrix( bodyFixedPosition_ );
         currentBodyFixedPartialWrtPosition_ = computePartialDerivativeOfBodyFixedSphericalHarmonicAcceleration(
-                    bodyFixedPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
-                    currentCosineCoefficients_, currentSineCoefficients_, sphericalHarmonicCache_ );
+                    bodyFixedPosition_, bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
+                    currentCosineCoefficients_, currentSineCoefficients_, sphericalHarmonicCache_,
+                    currentSphericalToCartesianGradientMatrix_.inverse( ) * accelerationModel_->getAccelerationInBodyFixedFrame( ),
+                    currentSphericalToCartesianGradientMatrix_ );
 
         currentPartialWrtVelocity_.setZero( );
         currentPartialWrtPosition_.setZero( );
@@ -402,6 +408,24 @@ void SphericalHarmonicsGravityPartial::update( const double currentTime )
     }
 }
 
+//! Function to set the partials wrt coefficients that are omitted by the acceleration model to zero.
+void SphericalHarmonicsGravityPartial::setPartialsOfTruncatedCoefficientsToZero(
+        const std::vector< std::pair< int, int > >& blockIndices,
+        Eigen::MatrixXd& partialDerivatives )
+{
+    if( !std::isnan( accelerationModel_->getDegreeTruncationTolerance( ) ) )
+    {
+        const int currentMaximumDegree = accelerationModel_->getCurrentMaximumDegree( );
+        for( unsigned int i = 0; i < blockIndices.size( ); i++ )
+        {
+            if( blockIndices.at( i ).first > currentMaximumDegree )
+            {
+                partialDerivatives.col( i ).setZero( );
+            }
+        }
+    }
+}
+
 //! Function to calculate the partial of the acceleration wrt a set of cosine coefficients.
 void SphericalHarmonicsGravityPartial::wrtCosineCoefficientBlock(
         const std::vector< std::pair< int, int > >& blockIndices,
@@ -410,9 +434,10 @@ void SphericalHarmonicsGravityPartial::wrtCosineCoefficientBlock(
     calculateSphericalHarmonicGravityWrtCCoefficients(
                 bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
                 sphericalHarmonicCache_,
-                blockIndices, coordinate_conversions::getSphericalToCartesianGradientMatrix(
-                    bodyFixedPosition_ ), fromBodyFixedToIntegrationFrameRotation_( ), partialDerivatives,
+                blockIndices, currentSphericalToCartesianGradientMatrix_,
+                fromBodyFixedToIntegrationFrameRotation_( ), partialDerivatives,
                 maximumDegree_, maximumOrder_ );
+    setPartialsOfTruncatedCoefficientsToZero( blockIndices, partialDerivatives );
 }
 
 //! Function to calculate the partial of the acceleration wrt a set of sine coefficients.
@@ -423,9 +448,10 @@ void SphericalHarmonicsGravityPartial::wrtSineCoefficientBlock(
     calculateSphericalHarmonicGravityWrtSCoefficients(
                 bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
                 sphericalHarmonicCache_,
-                blockIndices, coordinate_conversions::getSphericalToCartesianGradientMatrix(
-                    bodyFixedPosition_ ), fromBodyFixedToIntegrationFrameRotation_( ), partialDerivatives,
+                blockIndices, currentSphericalToCartesianGradientMatrix_,
+                fromBodyFixedToIntegrationFrameRotation_( ), partialDerivatives,
                 maximumDegree_, maximumOrder_ );
+    setPartialsOfTruncatedCoefficientsToZero( blockIndices, partialDerivatives );
 }
 
 //! Function to calculate an acceleration partial wrt a rotational parameter.
@@ -485,8 +511,8 @@ void SphericalHarmonicsGravityPartial::wrtTidalModelParameter(
             calculateSphericalHarmonicGravityWrtCCoefficients(
                         bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
                         sphericalHarmonicCache_,
-                        blockIndices, coordinate_conversions::getSphericalToCartesianGradientMatrix(
-                            bodyFixedPosition_ ), fromBodyFixedToIntegrationFrameRotation_( ), currentPartialContribution,
+                        blockIndices, currentSphericalToCartesianGradientMatrix_,
+                        fromBodyFixedToIntegrationFrameRotation_( ), currentPartialContribution,
                         maximumDegree_, maximumOrder_  );
 
             partialMatrix.block( 0, 0, 3, singleOrderPartialSize ) +=
@@ -497,8 +523,8 @@ void SphericalHarmonicsGravityPartial::wrtTidalModelParameter(
             calculateSphericalHarmonicGravityWrtSCoefficients(
                         bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
                         sphericalHarmonicCache_,
-                        blockIndices, coordinate_conversions::getSphericalToCartesianGradientMatrix(
-                            bodyFixedPosition_ ), fromBodyFixedToIntegrationFrameRotation_( ), currentPartialContribution,
+                        blockIndices, currentSphericalToCartesianGradientMatrix_,
+                        fromBodyFixedToIntegrationFrameRotation_( ), currentPartialContribution,
                         maximumDegree_, maximumOrder_  );
 
             partialMatrix.block( 0, 0, 3, singleOrderPartialSize ) +=
@@ -509,8 +535,8 @@ void SphericalHarmonicsGravityPartial::wrtTidalModelParameter(
             calculateSphericalHarmonicGravityWrtCCoefficients(
                         bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
                         sphericalHarmonicCache_,
-                        blockIndices, coordinate_conversions::getSphericalToCartesianGradientMatrix(
-                            bodyFixedPosition_ ), fromBodyFixedToIntegrationFrameRotation_( ), currentPartialContribution,
+                        blockIndices, currentSphericalToCartesianGradientMatrix_,
+                        fromBodyFixedToIntegrationFrameRotation_( ), currentPartialContribution,
                         maximumDegree_, maximumOrder_  );
 
             partialMatrix.block( 0, i * singleOrderPartialSize, 3, singleOrderPartialSize ) +=
@@ -519,8 +545,8 @@ void SphericalHarmonicsGravityPartial::wrtTidalModelParameter(
             calculateSphericalHarmonicGravityWrtSCoefficients(
                         bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
                         sphericalHarmonicCache_,
-                        blockIndices, coordinate_conversions::getSphericalToCartesianGradientMatrix(
-                            bodyFixedPosition_ ), fromBodyFixedToIntegrationFrameRotation_( ), currentPartialContribution,
+                        blockIndices, currentSphericalToCartesianGradientMatrix_,
+                        fromBodyFixedToIntegrationFrameRotation_( ), currentPartialContribution,
                         maximumDegree_, maximumOrder_  );
 
             partialMatrix.block( 0, i * singleOrderPartialSize, 3, singleOrderPartialSize ) +=
@@ -0,0 +1,286 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *        Koon, W.S., Lo, M.W., Marsden, J.E., Ross, S.D., "Dynamical Systems, the Three-Body Problem and Space
+ *          Mission Design", 2011.
+ *        Howell, K.C., "Three-dimensional, periodic, 'halo' orbits", Celestial Mechanics 32, 53-71, 1984.
+ *
+ */
+
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+#include <string>
+
+#include <Eigen/Eigenvalues>
+#include <Eigen/LU>
+
+#include "tudat/astro/gravitation/jacobiEnergy.h"
+#include "tudat/astro/propagators/circularRestrictedThreeBodyPeriodicOrbits.h"
+
+namespace tudat
+{
+namespace propagators
+{
+
+//! Function to compute the x-coordinate of a collinear libration point of the CR3BP
+double computeCr3bpCollinearLibrationPointPosition( const double massParameter, const int librationPointIndex )
+{
+    // Set initial guess from Hill's approximation
+    const double hillRadius = std::cbrt( massParameter / 3.0 );
+    double xPosition;
+    switch( librationPointIndex )
+    {
+    case 1:
+        xPosition = 1.0 - massParameter - hillRadius;
+        break;
+    case 2:
+        xPosition = 1.0 - massParameter + hillRadius;
+        break;
+    case 3:
+        xPosition = -1.0 - 5.0 / 12.0 * massParameter;
+        break;
+    default:
+        throw std::runtime_error( "Error when computing collinear libration point, index " +
+                                  std::to_string( librationPointIndex ) + " is invalid" );
+    }
+
+    // Solve equilibrium condition along x-axis with Newton iterations
+    for( unsigned int i = 0; i < 50; i++ )
+    {
+        const double distanceToPrimary = std::fabs( xPosition + massParameter );
+        const double distanceToSecondary = std::fabs( xPosition - 1.0 + massParameter );
+        const double primaryTerm = ( 1.0 - massParameter ) /
+                ( distanceToPrimary * distanceToPrimary * distanceToPrimary );
+        const double secondaryTerm = massParameter /
+                ( distanceToSecondary * distanceToSecondary * distanceToSecondary );
+
+        const double acceleration = xPosition - primaryTerm * ( xPosition + massParameter ) -
+                secondaryTerm * ( xPosition - 1.0 + massParameter );
+        const double accelerationDerivative = 1.0 + 2.0 * primaryTerm + 2.0 * secondaryTerm;
+
+        const double correction = acceleration / accelerationDerivative;
+        xPosition -= correction;
+        if( std::fabs( correction ) < 1.0E-15 )
+        {
+            break;
+        }
+    }
+    return xPosition;
+}
+
+//! Function to correct an initial state to a periodic orbit that is symmetric w.r.t. the xz-plane
+Cr3bpPeriodicOrbit correctSymmetricCr3bpPeriodicOrbit(
+        const CircularRestrictedThreeBodyPropagator& propagator,
+        const Eigen::Vector6d& initialStateGuess,
+        const Cr3bpFixedInitialStateComponent fixedComponent,
+        const double tolerance,
+        const unsigned int maximumNumberOfIterations,
+        const double maximumHalfPeriod )
+{
+    const bool isOrbitPlanar = ( initialStateGuess( 2 ) == 0.0 && initialStateGuess( 5 ) == 0.0 );
+    const int freePositionIndex = ( fixedComponent == fix_initial_x_position ) ? 2 : 0;
+
+    // Enforce symmetric initial state
+    Eigen::Vector6d initialState = initialStateGuess;
+    initialState( 1 ) = 0.0;
+    initialState( 3 ) = 0.0;
+    initialState( 5 ) = 0.0;
+
+    Cr3bpPropagationResult halfPeriodResult;
+    bool isConverged = false;
+    unsigned int numberOfIterations = 0;
+    while( !isConverged )
+    {
+        halfPeriodResult = propagator.propagateToCrossing( initialState, 0.0, maximumHalfPeriod, 1, 1, true );
+        if( !halfPeriodResult.isCrossingDetected_ )
+        {
+            throw std::runtime_error( "Error in CR3BP differential correction, no xz-plane crossing found within " +
+                                      std::to_string( maximumHalfPeriod ) );
+        }
+
+        const Eigen::Vector6d& crossingState = halfPeriodResult.finalState_;
+        const Eigen::Matrix6d& stateTransitionMatrix = halfPeriodResult.stateTransitionMatrix_;
+        if( std::fabs( crossingState( 3 ) ) < tolerance && std::fabs( crossingState( 5 ) ) < tolerance )
+        {
+            isConverged = true;
+            break;
+        }
+
+        if( numberOfIterations >= maximumNumberOfIterations )
+        {
+            throw std::runtime_error( "Error in CR3BP differential correction, no convergence after " +
+                                      std::to_string( maximumNumberOfIterations ) + " iterations" );
+        }
+        numberOfIterations++;
+
+        // Compute sensitivity of targets at the crossing, including variation of crossing time (y = 0)
+        const Eigen::Vector6d crossingStateDerivative =
+                computeCr3bpStateDerivative( propagator.getMassParameter( ), crossingState );
+        Eigen::Matrix< double, 2, 6 > targetSensitivity;
+        targetSensitivity.row( 0 ) = stateTransitionMatrix.row( 3 ) -
+                ( crossingStateDerivative( 3 ) / crossingState( 4 ) ) * stateTransitionMatrix.row( 1 );
+        targetSensitivity.row( 1 ) = stateTransitionMatrix.row( 5 ) -
+                ( crossingStateDerivative( 5 ) / crossingState( 4 ) ) * stateTransitionMatrix.row( 1 );
+
+        if( isOrbitPlanar )
+        {
+            initialState( 4 ) -= crossingState( 3 ) / targetSensitivity( 0, 4 );
+        }
+        else
+        {
+            Eigen::Matrix2d correctionMatrix;
+            correctionMatrix << targetSensitivity( 0, freePositionIndex ), targetSensitivity( 0, 4 ),
+                    targetSensitivity( 1, freePositionIndex ), targetSensitivity( 1, 4 );
+            const Eigen::Vector2d correction = correctionMatrix.partialPivLu( ).solve(
+                        -Eigen::Vector2d( crossingState( 3 ), crossingState( 5 ) ) );
+            initialState( freePositionIndex ) += correction( 0 );
+            initialState( 4 ) += correction( 1 );
+        }
+    }
+
+    Cr3bpPeriodicOrbit periodicOrbit;
+    periodicOrbit.initialState_ = initialState;
+    periodicOrbit.period_ = 2.0 * halfPeriodResult.finalTime_;
+    periodicOrbit.monodromyMatrix_ = propagator.propagateStateAndTransitionMatrix(
+                initialState, 0.0, periodicOrbit.period_ ).stateTransitionMatrix_;
+    periodicOrbit.jacobiEnergy_ = gravitation::computeJacobiEnergy( propagator.getMassParameter( ), initialState );
+    periodicOrbit.numberOfIterations_ = numberOfIterations;
+    return periodicOrbit;
+}
+
+//! Function to compute a family of symmetric periodic orbits with natural parameter continuation
+std::vector< Cr3bpPeriodicOrbit > continueSymmetricCr3bpPeriodicOrbitFamily(
+        const CircularRestrictedThreeBodyPropagator& propagator,
+        const Eigen::Vector6d& initialStateGuess,
+        const Cr3bpFixedInitialStateComponent fixedComponent,
+        const double continuationStepSize,
+        const unsigned int numberOfOrbits,
+        const double tolerance,
+        const unsigned int maximumNumberOfIterations )
+{
+    const bool isOrbitPlanar = ( initialStateGuess( 2 ) == 0.0 && initialStateGuess( 5 ) == 0.0 );
+    if( isOrbitPlanar && fixedComponent != fix_initial_x_position )
+    {
+        throw std::runtime_error( "Error in CR3BP continuation, planar orbits must be continued in x-position" );
+    }
+    const int fixedPositionIndex = ( fixedComponent == fix_initial_x_position ) ? 0 : 2;
+
+    std::vector< Cr3bpPeriodicOrbit > family;
+    Eigen::Vector6d currentGuess = initialStateGuess;
+    for( unsigned int i = 0; i < numberOfOrbits; i++ )
+    {
+        // Predict initial state from previous members of the family
+        if( i == 1 )
+        {
+            currentGuess = family.at( 0 ).initialState_;
+            currentGuess( fixedPositionIndex ) += continuationStepSize;
+        }
+        else if( i > 1 )
+        {
+            currentGuess = 2.0 * family.at( i - 1 ).initialState_ - family.at( i - 2 ).initialState_;
+        }
+
+        try
+        {
+            family.push_back( correctSymmetricCr3bpPeriodicOrbit(
+                                  propagator, currentGuess, fixedComponent, tolerance, maximumNumberOfIterations ) );
+        }
+        catch( std::runtime_error& )
+        {
+            break;
+        }
+    }
+    return family;
+}
+
+//! Function to compute the stability index of a periodic orbit from the eigenvalues of its monodromy matrix
+double computeCr3bpStabilityIndex( const Cr3bpPeriodicOrbit& periodicOrbit )
+{
+    const double maximumEigenvalueMagnitude =
+            Eigen::EigenSolver< Eigen::Matrix6d >( periodicOrbit.monodromyMatrix_, false ).eigenvalues( )
+            .cwiseAbs( ).maxCoeff( );
+    return 0.5 * ( maximumEigenvalueMagnitude + 1.0 / maximumEigenvalueMagnitude );
+}
+
+//! Function to compute the initial states of the invariant manifold of a periodic orbit
+std::vector< Eigen::Vector6d > computeCr3bpManifoldInitialStates(
+        const CircularRestrictedThreeBodyPropagator& propagator,
+        const Cr3bpPeriodicOrbit& periodicOrbit,
+        const unsigned int numberOfPoints,
+        const double perturbationSize,
+        const bool computeUnstableManifold,
+        const bool positiveBranch )
+{
+    // Select real eigenvalue with largest (unstable) or smallest (stable) magnitude
+    Eigen::EigenSolver< Eigen::Matrix6d > eigenSolver( periodicOrbit.monodromyMatrix_ );
+    int selectedIndex = -1;
+    for( int i = 0; i < 6; i++ )
+    {
+        const std::complex< double > eigenvalue = eigenSolver.eigenvalues( )( i );
+        if( std::fabs( eigenvalue.imag( ) ) > 1.0E-8 * std::abs( eigenvalue ) )
+        {
+            continue;
+        }
+        if( selectedIndex < 0 ||
+                ( computeUnstableManifold &&
+                  std::fabs( eigenvalue.real( ) ) > std::fabs( eigenSolver.eigenvalues( )( selectedIndex ).real( ) ) ) ||
+                ( !computeUnstableManifold &&
+                  std::fabs( eigenvalue.real( ) ) < std::fabs( eigenSolver.eigenvalues( )( selectedIndex ).real( ) ) ) )
+        {
+            selectedIndex = i;
+        }
+    }
+
+    const double selectedEigenvalueMagnitude =
+            ( selectedIndex < 0 ) ? 1.0 : std::fabs( eigenSolver.eigenvalues( )( selectedIndex ).real( ) );
+    if( ( computeUnstableManifold && selectedEigenvalueMagnitude <= 1.0 + 1.0E-6 ) ||
+            ( !computeUnstableManifold && selectedEigenvalueMagnitude >= 1.0 - 1.0E-6 ) )
+    {
+        throw std::runtime_error( "Error when computing CR3BP manifold, periodic orbit has no hyperbolic eigenvalue" );
+    }
+    // Orient eigenvector towards positive x, so that the branch is consistently defined
+    Eigen::Vector6d eigenvector = eigenSolver.eigenvectors( ).col( selectedIndex ).real( );
+    if( eigenvector( 0 ) < 0.0 )
+    {
+        eigenvector *= -1.0;
+    }
+    const double branchSign = positiveBranch ? 1.0 : -1.0;
+
+    // Map eigenvector along orbit, propagating state and state transition matrix between subsequent points
+    std::vector< Eigen::Vector6d > manifoldInitialStates;
+    manifoldInitialStates.reserve( numberOfPoints );
+    Eigen::Vector6d currentState = periodicOrbit.initialState_;
+    Eigen::Matrix6d currentStateTransitionMatrix = Eigen::Matrix6d::Identity( );
+    double currentTime = 0.0;
+    for( unsigned int i = 0; i < numberOfPoints; i++ )
+    {
+        const double pointTime = periodicOrbit.period_ * static_cast< double >( i ) /
+                static_cast< double >( numberOfPoints );
+        if( pointTime > currentTime )
+        {
+            Cr3bpPropagationResult segmentResult = propagator.propagateStateAndTransitionMatrix(
+                        currentState, currentTime, pointTime, nullptr, currentStateTransitionMatrix );
+            currentState = segmentResult.finalState_;
+            currentStateTransitionMatrix = segmentResult.stateTransitionMatrix_;
+            currentTime = pointTime;
+        }
+
+        const Eigen::Vector6d mappedEigenvector = currentStateTransitionMatrix * eigenvector;
+        manifoldInitialStates.push_back(
+                    currentState + ( branchSign * perturbationSize / mappedEigenvector.segment< 3 >( 0 ).norm( ) ) *
+                    mappedEigenvector );
+    }
+    return manifoldInitialStates;
+}
+
+} // namespace propagators
+
+} // namespace tudat
@@ -0,0 +1,453 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *        Koon, W.S., Lo, M.W., Marsden, J.E., Ross, S.D., "Dynamical Systems, the Three-Body Problem and Space
+ *          Mission Design", 2011.
+ *        Montenbruck, O., Gill, E. Satellite Orbits: Models, Methods, Applications, Springer, 2005.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "tudat/astro/propagators/circularRestrictedThreeBodyPropagator.h"
+#include "tudat/math/integrators/staticRungeKuttaCoefficients.h"
+
+namespace tudat
+{
+namespace propagators
+{
+
+namespace
+{
+
+//! Coefficient set used by the CR3BP propagator
+constexpr numerical_integrators::CoefficientSets cr3bpCoefficientSet = numerical_integrators::rungeKutta87DormandPrince;
+
+//! Compile-time Butcher tableau used by the CR3BP propagator
+typedef numerical_integrators::StaticRungeKuttaCoefficients< cr3bpCoefficientSet > Cr3bpCoefficients;
+
+//! Function to compute the acceleration and the pseudo-potential Hessian at a given position in the CR3BP
+void computeCr3bpAccelerationAndHessian(
+        const double massParameter,
+        const Eigen::Vector6d& state,
+        Eigen::Vector3d& acceleration,
+        Eigen::Matrix3d* pseudoPotentialHessian )
+{
+    const Eigen::Vector3d relativePositionToPrimary( state( 0 ) + massParameter, state( 1 ), state( 2 ) );
+    const Eigen::Vector3d relativePositionToSecondary( state( 0 ) - 1.0 + massParameter, state( 1 ), state( 2 ) );
+
+    const double inverseDistanceToPrimary = 1.0 / relativePositionToPrimary.norm( );
+    const double inverseDistanceToSecondary = 1.0 / relativePositionToSecondary.norm( );
+
+    const double primaryTerm = ( 1.0 - massParameter ) *
+            inverseDistanceToPrimary * inverseDistanceToPrimary * inverseDistanceToPrimary;
+    const double secondaryTerm = massParameter *
+            inverseDistanceToSecondary * inverseDistanceToSecondary * inverseDistanceToSecondary;
+
+    acceleration = -primaryTerm * relativePositionToPrimary - secondaryTerm * relativePositionToSecondary;
+    acceleration( 0 ) += state( 0 ) + 2.0 * state( 4 );
+    acceleration( 1 ) += state( 1 ) - 2.0 * state( 3 );
+
+    if( pseudoPotentialHessian != nullptr )
+    {
+        *pseudoPotentialHessian =
+                ( 3.0 * primaryTerm * inverseDistanceToPrimary * inverseDistanceToPrimary ) *
+                ( relativePositionToPrimary * relativePositionToPrimary.transpose( ) ) +
+                ( 3.0 * secondaryTerm * inverseDistanceToSecondary * inverseDistanceToSecondary ) *
+                ( relativePositionToSecondary * relativePositionToSecondary.transpose( ) );
+        pseudoPotentialHessian->diagonal( ).array( ) -= ( primaryTerm + secondaryTerm );
+        ( *pseudoPotentialHessian )( 0, 0 ) += 1.0;
+        ( *pseudoPotentialHessian )( 1, 1 ) += 1.0;
+    }
+}
+
+//! Function to compute the derivative of the propagated state only
+void computeCr3bpDerivative( const double massParameter, const Eigen::Vector6d& value, Eigen::Vector6d& derivative )
+{
+    derivative = computeCr3bpStateDerivative( massParameter, value );
+}
+
+//! Function to compute the derivative of the propagated state and state transition matrix
+void computeCr3bpDerivative( const double massParameter, const Cr3bpStateAndTransitionMatrix& value,
+                             Cr3bpStateAndTransitionMatrix& derivative )
+{
+    derivative = computeCr3bpStateAndTransitionMatrixDerivative( massParameter, value );
+}
+
+//! Function to convert a propagated value to a node of the dense output
+Cr3bpStateAndTransitionMatrix getDenseOutputValue( const Eigen::Vector6d& value )
+{
+    Cr3bpStateAndTransitionMatrix denseOutputValue = Cr3bpStateAndTransitionMatrix::Zero( );
+    denseOutputValue.col( 0 ) = value;
+    return denseOutputValue;
+}
+
+//! Function to convert a propagated value to a node of the dense output
+const Cr3bpStateAndTransitionMatrix& getDenseOutputValue( const Cr3bpStateAndTransitionMatrix& value )
+{
+    return value;
+}
+
+//! Function to compute the intermediate value and derivative of a single stage (first stage is provided by caller)
+template< int Stage, typename ValueType >
+void computeCr3bpStage( const double massParameter, const ValueType& currentValue, const double stepSize,
+                        std::vector< ValueType >& stageDerivatives, ValueType& intermediateValue )
+{
+    if constexpr( Stage > 0 )
+    {
+        numerical_integrators::computeStaticTableauRowCombination< cr3bpCoefficientSet, false, Stage >(
+                    currentValue, stepSize, stageDerivatives, intermediateValue );
+        computeCr3bpDerivative( massParameter, intermediateValue, stageDerivatives[ Stage ] );
+    }
+}
+
+//! Function to compute all stages, and the lower and higher order estimates of a single step
+template< typename ValueType, int... Stages >
+void computeCr3bpStep( const double massParameter, const ValueType& currentValue, const double stepSize,
+                       std::vector< ValueType >& stageDerivatives, ValueType& intermediateValue,
+                       ValueType& lowerOrderEstimate, ValueType& higherOrderEstimate,
+                       std::integer_sequence< int, Stages... > )
+{
+    ( computeCr3bpStage< Stages >( massParameter, currentValue, stepSize, stageDerivatives, intermediateValue ), ... );
+
+    numerical_integrators::computeStaticTableauRowCombination< cr3bpCoefficientSet, true, 0 >(
+                currentValue, stepSize, stageDerivatives, lowerOrderEstimate );
+    numerical_integrators::computeStaticTableauRowCombination< cr3bpCoefficientSet, true, 1 >(
+                currentValue, stepSize, stageDerivatives, higherOrderEstimate );
+}
+
+//! Function to compute all stages, and the lower and higher order estimates of a single step
+template< typename ValueType >
+void computeCr3bpStep( const double massParameter, const ValueType& currentValue, const double stepSize,
+                       std::vector< ValueType >& stageDerivatives, ValueType& intermediateValue,
+                       ValueType& lowerOrderEstimate, ValueType& higherOrderEstimate )
+{
+    computeCr3bpStep( massParameter, currentValue, stepSize, stageDerivatives, intermediateValue,
+                      lowerOrderEstimate, higherOrderEstimate,
+                      std::make_integer_sequence< int, Cr3bpCoefficients::numberOfStages >( ) );
+}
+
+} // namespace
+
+//! Function to compute the state derivative in the CR3BP (normalized units, synodic frame)
+Eigen::Vector6d computeCr3bpStateDerivative( const double massParameter, const Eigen::Vector6d& state )
+{
+    Eigen::Vector3d acceleration;
+    computeCr3bpAccelerationAndHessian( massParameter, state, acceleration, nullptr );
+
+    Eigen::Vector6d stateDerivative;
+    stateDerivative << state.segment< 3 >( 3 ), acceleration;
+    return stateDerivative;
+}
+
+//! Function to compute the Jacobian of the CR3BP state derivative w.r.t. the state
+Eigen::Matrix6d computeCr3bpStateDerivativeJacobian( const double massParameter, const Eigen::Vector6d& state )
+{
+    Eigen::Vector3d acceleration;
+    Eigen::Matrix3d pseudoPotentialHessian;
+    computeCr3bpAccelerationAndHessian( massParameter, state, acceleration, &pseudoPotentialHessian );
+
+    Eigen::Matrix6d jacobian = Eigen::Matrix6d::Zero( );
+    jacobian.block< 3, 3 >( 0, 3 ).setIdentity( );
+    jacobian.block< 3, 3 >( 3, 0 ) = pseudoPotentialHessian;
+    jacobian( 3, 4 ) = 2.0;
+    jacobian( 4, 3 ) = -2.0;
+    return jacobian;
+}
+
+//! Function to compute the derivative of the CR3BP state and state transition matrix
+Cr3bpStateAndTransitionMatrix computeCr3bpStateAndTransitionMatrixDerivative(
+        const double massParameter, const Cr3bpStateAndTransitionMatrix& stateAndTransitionMatrix )
+{
+    Eigen::Vector3d acceleration;
+    Eigen::Matrix3d pseudoPotentialHessian;
+    computeCr3bpAccelerationAndHessian(
+                massParameter, stateAndTransitionMatrix.col( 0 ), acceleration, &pseudoPotentialHessian );
+
+    // Exploit block structure of A = [ 0, I; U_rr, 2 Omega ] in dPhi/dt = A Phi
+    Cr3bpStateAndTransitionMatrix derivative;
+    derivative.block< 3, 1 >( 0, 0 ) = stateAndTransitionMatrix.block< 3, 1 >( 3, 0 );
+    derivative.block< 3, 1 >( 3, 0 ) = acceleration;
+    derivative.block< 3, 6 >( 0, 1 ) = stateAndTransitionMatrix.block< 3, 6 >( 3, 1 );
+    derivative.block< 3, 6 >( 3, 1 ).noalias( ) =
+            pseudoPotentialHessian * stateAndTransitionMatrix.block< 3, 6 >( 0, 1 );
+    derivative.block< 1, 6 >( 3, 1 ) += 2.0 * stateAndTransitionMatrix.block< 1, 6 >( 4, 1 );
+    derivative.block< 1, 6 >( 4, 1 ) -= 2.0 * stateAndTransitionMatrix.block< 1, 6 >( 3, 1 );
+    return derivative;
+}
+
+//! Function to interpolate the state and state transition matrix at a given time
+Cr3bpStateAndTransitionMatrix Cr3bpDenseOutput::interpolate( const double time ) const
+{
+    if( times_.size( ) < 2 )
+    {
+        throw std::runtime_error( "Error when interpolating CR3BP dense output, fewer than two nodes available" );
+    }
+
+    const bool isForward = ( times_.back( ) >= times_.front( ) );
+    if( ( isForward && ( time < times_.front( ) || time > times_.back( ) ) ) ||
+            ( !isForward && ( time > times_.front( ) || time < times_.back( ) ) ) )
+    {
+        throw std::runtime_error( "Error when interpolating CR3BP dense output, time " + std::to_string( time ) +
+                                  " is outside of propagation interval" );
+    }
+
+    // Find step containing requested time
+    std::vector< double >::const_iterator upperNode = isForward ?
+                std::lower_bound( times_.begin( ), times_.end( ), time ) :
+                std::lower_bound( times_.begin( ), times_.end( ), time, std::greater< double >( ) );
+    int upperIndex = std::max( 1, static_cast< int >( std::distance( times_.begin( ), upperNode ) ) );
+    int lowerIndex = upperIndex - 1;
+
+    // Evaluate cubic Hermite polynomial
+    const double stepSize = times_.at( upperIndex ) - times_.at( lowerIndex );
+    const double s = ( time - times_.at( lowerIndex ) ) / stepSize;
+    const double sSquared = s * s;
+    const double sCubed = sSquared * s;
+
+    return ( 2.0 * sCubed - 3.0 * sSquared + 1.0 ) * values_.at( lowerIndex ) +
+            ( ( sCubed - 2.0 * sSquared + s ) * stepSize ) * derivatives_.at( lowerIndex ) +
+            ( -2.0 * sCubed + 3.0 * sSquared ) * values_.at( upperIndex ) +
+            ( ( sCubed - sSquared ) * stepSize ) * derivatives_.at( upperIndex );
+}
+
+//! Function to interpolate the state transition matrix at a given time
+Eigen::Matrix6d Cr3bpDenseOutput::interpolateStateTransitionMatrix( const double time ) const
+{
+    if( !isStateTransitionMatrixPropagated_ )
+    {
+        throw std::runtime_error(
+                    "Error when interpolating CR3BP state transition matrix, state transition matrix was not propagated" );
+    }
+    return interpolate( time ).block< 6, 6 >( 0, 1 );
+}
+
+//! Function to propagate the state from an initial to a final time
+Cr3bpPropagationResult CircularRestrictedThreeBodyPropagator::propagateState(
+        const Eigen::Vector6d& initialState,
+        const double initialTime,
+        const double finalTime,
+        const std::shared_ptr< Cr3bpDenseOutput > denseOutput ) const
+{
+    return propagate< 1 >( initialState, initialTime, finalTime, denseOutput, -1, 0, 0 );
+}
+
+//! Function to propagate the state and state transition matrix from an initial to a final time
+Cr3bpPropagationResult CircularRestrictedThreeBodyPropagator::propagateStateAndTransitionMatrix(
+        const Eigen::Vector6d& initialState,
+        const double initialTime,
+        const double finalTime,
+        const std::shared_ptr< Cr3bpDenseOutput > denseOutput,
+        const Eigen::Matrix6d& initialStateTransitionMatrix ) const
+{
+    Cr3bpStateAndTransitionMatrix initialValue;
+    initialValue << initialState, initialStateTransitionMatrix;
+    return propagate< 7 >( initialValue, initialTime, finalTime, denseOutput, -1, 0, 0 );
+}
+
+//! Function to propagate the state (and state transition matrix) to a crossing of a coordinate plane
+Cr3bpPropagationResult CircularRestrictedThreeBodyPropagator::propagateToCrossing(
+        const Eigen::Vector6d& initialState,
+        const double initialTime,
+        const double maximumTime,
+        const int stateIndex,
+        const unsigned int numberOfCrossings,
+        const bool propagateStateTransitionMatrix,
+        const int crossingDirection ) const
+{
+    if( stateIndex < 0 || stateIndex > 5 )
+    {
+        throw std::runtime_error( "Error when propagating CR3BP to crossing, state index " +
+                                  std::to_string( stateIndex ) + " is invalid" );
+    }
+    if( numberOfCrossings == 0 )
+    {
+        throw std::runtime_error( "Error when propagating CR3BP to crossing, number of crossings must be positive" );
+    }
+
+    if( propagateStateTransitionMatrix )
+    {
+        Cr3bpStateAndTransitionMatrix initialValue;
+        initialValue << initialState, Eigen::Matrix6d::Identity( );
+        return propagate< 7 >( initialValue, initialTime, maximumTime, nullptr,
+                               stateIndex, numberOfCrossings, crossingDirection );
+    }
+    else
+    {
+        return propagate< 1 >( initialState, initialTime, maximumTime, nullptr,
+                               stateIndex, numberOfCrossings, crossingDirection );
+    }
+}
+
+//! Function to perform the propagation, for state only (NumberOfColumns = 1) or including the STM (7)
+template< int NumberOfColumns >
+Cr3bpPropagationResult CircularRestrictedThreeBodyPropagator::propagate(
+        const Eigen::Matrix< double, 6, NumberOfColumns >& initialValue,
+        const double initialTime,
+        const double finalTime,
+        const std::shared_ptr< Cr3bpDenseOutput > denseOutput,
+        const int crossingStateIndex,
+        const unsigned int numberOfCrossings,
+        const int crossingDirection ) const
+{
+    typedef Eigen::Matrix< double, 6, NumberOfColumns > ValueType;
+
+    Cr3bpPropagationResult result;
+
+    // Work variables, allocated once per propagation
+    std::vector< ValueType > stageDerivatives( Cr3bpCoefficients::numberOfStages );
+    ValueType intermediateValue, lowerOrderEstimate, higherOrderEstimate;
+
+    const double propagationDirection = ( finalTime >= initialTime ) ? 1.0 : -1.0;
+    double currentTime = initialTime;
+    ValueType currentValue = initialValue;
+    double stepSize = propagationDirection * std::min( initialStepSize_, maximumStepSize_ );
+
+    if( denseOutput != nullptr )
+    {
+        denseOutput->clear( );
+        denseOutput->setIsStateTransitionMatrixPropagated( NumberOfColumns > 1 );
+    }
+
+    // Derivative at the start of the step is reused after a rejected step, and for the dense output
+    computeCr3bpDerivative( massParameter_, currentValue, stageDerivatives[ 0 ] );
+    result.numberOfFunctionEvaluations_++;
+
+    unsigned int numberOfDetectedCrossings = 0;
+    bool isPropagationFinished = ( currentTime == finalTime );
+    while( !isPropagationFinished )
+    {
+        if( result.numberOfAcceptedSteps_ + result.numberOfRejectedSteps_ >= maximumNumberOfSteps_ )
+        {
+            throw std::runtime_error( "Error in CR3BP propagation, maximum number of steps exceeded at t=" +
+                                      std::to_string( currentTime ) );
+        }
+
+        // Truncate step at final time
+        bool isLastStep = false;
+        if( propagationDirection * ( currentTime + stepSize - finalTime ) >= 0.0 )
+        {
+            stepSize = finalTime - currentTime;
+            isLastStep = true;
+        }
+
+        computeCr3bpStep( massParameter_, currentValue, stepSize, stageDerivatives, intermediateValue,
+                          lowerOrderEstimate, higherOrderEstimate );
+        result.numberOfFunctionEvaluations_ += Cr3bpCoefficients::numberOfStages - 1;
+
+        // Compute scaled error of the step, over all propagated entries
+        const double errorNorm =
+                ( ( higherOrderEstimate - lowerOrderEstimate ).array( ).abs( ) /
+                  ( absoluteTolerance_ + relativeTolerance_ *
+                    currentValue.array( ).abs( ).max( higherOrderEstimate.array( ).abs( ) ) ) ).maxCoeff( );
+        if( !std::isfinite( errorNorm ) )
+        {
+            throw std::runtime_error( "Error in CR3BP propagation, non-finite state encountered at t=" +
+                                      std::to_string( currentTime ) );
+        }
+
+        if( errorNorm <= 1.0 )
+        {
+            result.numberOfAcceptedSteps_++;
+
+            // Check for sign change of selected component in direction of crossing
+            if( crossingStateIndex >= 0 )
+            {
+                const double previousComponent = currentValue( crossingStateIndex, 0 );
+                const double newComponent = higherOrderEstimate( crossingStateIndex, 0 );
+                if( previousComponent * newComponent < 0.0 &&
+                        ( crossingDirection == 0 ||
+                          crossingDirection * propagationDirection * ( newComponent - previousComponent ) > 0.0 ) )
+                {
+                    numberOfDetectedCrossings++;
+                }
+
+                if( numberOfDetectedCrossings == numberOfCrossings )
+                {
+                    // Refine step size to crossing with Newton iterations, starting from linear interpolation
+                    double crossingStepSize = stepSize * previousComponent / ( previousComponent - newComponent );
+                    for( unsigned int i = 0; i < 20; i++ )
+                    {
+                        computeCr3bpStep( massParameter_, currentValue, crossingStepSize, stageDerivatives,
+                                          intermediateValue, lowerOrderEstimate, higherOrderEstimate );
+                        result.numberOfFunctionEvaluations_ += Cr3bpCoefficients::numberOfStages;
+
+                        const Eigen::Vector6d crossingState = higherOrderEstimate.col( 0 );
+                        const double stepSizeCorrection = crossingState( crossingStateIndex ) /
+                                computeCr3bpStateDerivative( massParameter_, crossingState )( crossingStateIndex );
+                        crossingStepSize -= stepSizeCorrection;
+                        if( std::fabs( stepSizeCorrection ) <= 4.0 * std::numeric_limits< double >::epsilon( ) *
+                                std::max( 1.0, std::fabs( currentTime + crossingStepSize ) ) )
+                        {
+                            break;
+                        }
+                    }
+                    computeCr3bpStep( massParameter_, currentValue, crossingStepSize, stageDerivatives,
+                                      intermediateValue, lowerOrderEstimate, higherOrderEstimate );
+                    result.numberOfFunctionEvaluations_ += Cr3bpCoefficients::numberOfStages - 1;
+
+                    stepSize = crossingStepSize;
+                    isLastStep = true;
+                    result.isCrossingDetected_ = true;
+                }
+            }
+
+            if( denseOutput != nullptr )
+            {
+                denseOutput->addNode( currentTime, getDenseOutputValue( currentValue ),
+                                      getDenseOutputValue( stageDerivatives[ 0 ] ) );
+            }
+
+            currentTime = isLastStep && !result.isCrossingDetected_ ? finalTime : currentTime + stepSize;
+            currentValue = higherOrderEstimate;
+            computeCr3bpDerivative( massParameter_, currentValue, stageDerivatives[ 0 ] );
+            result.numberOfFunctionEvaluations_++;
+
+            if( isLastStep )
+            {
+                isPropagationFinished = true;
+                break;
+            }
+        }
+        else
+        {
+            result.numberOfRejectedSteps_++;
+        }
+
+        // Compute new step size for an 8(7) method
+        const double stepSizeFactor = ( errorNorm > 0.0 ) ?
+                    std::min( 4.0, std::max( 0.1, 0.9 * std::pow( errorNorm, -1.0 / 8.0 ) ) ) : 4.0;
+        stepSize = propagationDirection * std::min( std::fabs( stepSize ) * stepSizeFactor, maximumStepSize_ );
+    }
+
+    if( denseOutput != nullptr )
+    {
+        denseOutput->addNode( currentTime, getDenseOutputValue( currentValue ),
+                              getDenseOutputValue( stageDerivatives[ 0 ] ) );
+    }
+
+    result.finalTime_ = currentTime;
+    result.finalState_ = currentValue.col( 0 );
+    if constexpr( NumberOfColumns > 1 )
+    {
+        result.stateTransitionMatrix_ = currentValue.template block< 6, 6 >( 0, 1 );
+    }
+    return result;
+}
+
+} // namespace propagators
+
+} // namespace tudat
@@ -0,0 +1,84 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <stdexcept>
+#include <string>
+
+#include "tudat/astro/propagators/dependentVariablesWriter.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Function to add a scalar dependent variable to the end of the list
+int DependentVariablesWriter::addScalarVariable( const std::function< double( ) >& variableFunction )
+{
+    int startIndex = totalSize_;
+    writeFunctions_.push_back( [ = ]( Eigen::Ref< Eigen::VectorXd > dependentVariables )
+    {
+        dependentVariables( startIndex ) = variableFunction( );
+    } );
+    totalSize_ += 1;
+    return startIndex;
+}
+
+//! Function to add a 3-dimensional vector dependent variable to the end of the list
+int DependentVariablesWriter::addThreeDimensionalVariable( const std::function< Eigen::Vector3d( ) >& variableFunction )
+{
+    int startIndex = totalSize_;
+    writeFunctions_.push_back( [ = ]( Eigen::Ref< Eigen::VectorXd > dependentVariables )
+    {
+        dependentVariables.segment< 3 >( startIndex ) = variableFunction( );
+    } );
+    totalSize_ += 3;
+    return startIndex;
+}
+
+//! Function to add a vector dependent variable of arbitrary size to the end of the list
+int DependentVariablesWriter::addVectorVariable( const std::function< Eigen::VectorXd( ) >& variableFunction,
+                                                 const int variableSize )
+{
+    int startIndex = totalSize_;
+    writeFunctions_.push_back( [ = ]( Eigen::Ref< Eigen::VectorXd > dependentVariables )
+    {
+        Eigen::VectorXd currentVariable = variableFunction( );
+        if( currentVariable.rows( ) != variableSize )
+        {
+            throw std::runtime_error( "Error when evaluating dependent variable at index " + std::to_string( startIndex ) +
+                                      ", size is " + std::to_string( currentVariable.rows( ) ) + ", but expected " +
+                                      std::to_string( variableSize ) );
+        }
+        dependentVariables.segment( startIndex, variableSize ) = currentVariable;
+    } );
+    totalSize_ += variableSize;
+    return startIndex;
+}
+
+//! Function to evaluate all dependent variables, and write them into a vector of size getTotalSize( )
+void DependentVariablesWriter::writeDependentVariables( Eigen::Ref< Eigen::VectorXd > dependentVariables ) const
+{
+    if( dependentVariables.rows( ) != totalSize_ )
+    {
+        throw std::runtime_error( "Error when writing dependent variables, output size is " +
+                                  std::to_string( dependentVariables.rows( ) ) + ", but expected " +
+                                  std::to_string( totalSize_ ) );
+    }
+
+    for( unsigned int i = 0; i < writeFunctions_.size( ); i++ )
+    {
+        writeFunctions_[ i ]( dependentVariables );
+    }
+}
+
+} // namespace propagators
+
+} // namespace tudat
@@ -9,6 +9,7 @@
  */
 
 #include <algorithm>
+#include <stdexcept>
 #include "tudat/astro/propagators/environmentUpdateTypes.h"
 
 namespace tudat
@@ -60,6 +61,45 @@ void addEnvironmentUpdates( std::map< propagators::EnvironmentModelsToUpdate,
     }
 }
 
+//! Function to get a string representing an environment update type
+std::string getEnvironmentUpdateTypeName( const EnvironmentModelsToUpdate updateType )
+{
+    std::string updateTypeName;
+    switch( updateType )
+    {
+    case body_translational_state_update:
+        updateTypeName = "translational state";
+        break;
+    case body_rotational_state_update:
+        updateTypeName = "rotational state";
+        break;
+    case spherical_harmonic_gravity_field_update:
+        updateTypeName = "spherical harmonic gravity field";
+        break;
+    case body_mass_update:
+        updateTypeName = "mass";
+        break;
+    case body_mass_distribution_update:
+        updateTypeName = "mass distribution";
+        break;
+    case vehicle_flight_conditions_update:
+        updateTypeName = "flight conditions";
+        break;
+    case radiation_pressure_interface_update:
+        updateTypeName = "radiation pressure interface";
+        break;
+    case radiation_source_model_update:
+        updateTypeName = "radiation source model";
+        break;
+    case radiation_pressure_target_model_update:
+        updateTypeName = "radiation pressure target model";
+        break;
+    default:
+        throw std::runtime_error( "Error, did not recognize environment update type " + std::to_string( updateType ) );
+    }
+    return updateTypeName;
+}
+
 
 }
 
@@ -1,4 +1,7 @@
 
+#include <algorithm>
+
+#include "tudat/basics/parallelization.h"
 #include<tudat/astro/propagators/propagateCovariance.h>
 
 namespace tudat
@@ -54,22 +57,123 @@ void propagateCovariance(
     }
 }
 
+//! Function to propagate full covariance at the initial time to (blocks of) the state covariance at a list of epochs
+void propagateCovarianceAtEpochs(
+        Eigen::MatrixXd& propagatedCovariances,
+        const Eigen::MatrixXd& initialCovariance,
+        const std::shared_ptr< CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionInterface,
+        const std::vector< double >& evaluationTimes,
+        const std::vector< std::pair< int, int > >& outputStateBlocks,
+        const int numberOfThreads )
+{
+    int fullParameterVectorSize = stateTransitionInterface->getFullParameterVectorSize( );
+    if( initialCovariance.rows( ) != fullParameterVectorSize || initialCovariance.cols( ) != fullParameterVectorSize )
+    {
+        throw std::runtime_error( "Error when propagating covariance, sizes are incompatible" );
+    }
+
+    // Determine size of output covariance
+    int outputSize = 0;
+    for( unsigned int i = 0; i < outputStateBlocks.size( ); i++ )
+    {
+        if( outputStateBlocks.at( i ).first < 0 || outputStateBlocks.at( i ).second < 1 ||
+                outputStateBlocks.at( i ).first + outputStateBlocks.at( i ).second >
+                stateTransitionInterface->getStateTransitionMatrixSize( ) )
+        {
+            throw std::runtime_error( "Error when propagating covariance, requested state block is out of bounds" );
+        }
+        outputSize += outputStateBlocks.at( i ).second;
+    }
+    int numberOfEpochs = evaluationTimes.size( );
+    if( outputStateBlocks.size( ) == 0 && numberOfEpochs > 0 )
+    {
+        outputSize = stateTransitionInterface->getFullCombinedStateTransitionAndSensitivityMatrix(
+                    evaluationTimes.at( 0 ), false ).rows( );
+    }
+
+    propagatedCovariances.resize( outputSize, outputSize * numberOfEpochs );
+
+    // Distribute epochs over threads in contiguous ranges, each with its own workspace
+    int numberOfTasks = std::max( 1, std::min( numberOfThreads, numberOfEpochs ) );
+    int epochsPerTask = ( numberOfEpochs + numberOfTasks - 1 ) / numberOfTasks;
+    utilities::executeParallelTasks(
+                numberOfTasks, [ & ]( const int taskIndex )
+    {
+        Eigen::MatrixXd combinedMatrixRows = Eigen::MatrixXd::Zero( outputSize, fullParameterVectorSize );
+        Eigen::MatrixXd covarianceProduct = Eigen::MatrixXd::Zero( outputSize, fullParameterVectorSize );
+        Eigen::MatrixXd currentBlockRows;
+
+        int endEpoch = std::min( numberOfEpochs, ( taskIndex + 1 ) * epochsPerTask );
+        for( int i = taskIndex * epochsPerTask; i < endEpoch; i++ )
+        {
+            // Retrieve (requested rows of) state transition and sensitivity matrix at current epoch
+            if( outputStateBlocks.size( ) == 0 )
+            {
+                combinedMatrixRows = stateTransitionInterface->getFullCombinedStateTransitionAndSensitivityMatrix(
+                            evaluationTimes.at( i ), false );
+                if( combinedMatrixRows.rows( ) != outputSize )
+                {
+                    throw std::runtime_error( "Error when propagating covariance, propagated state size varies over epochs" );
+                }
+            }
+            else
+            {
+                int currentRow = 0;
+                for( unsigned int j = 0; j < outputStateBlocks.size( ); j++ )
+                {
+                    stateTransitionInterface->getFullCombinedStateTransitionAndSensitivityMatrixRows(
+                                evaluationTimes.at( i ), outputStateBlocks.at( j ).first, outputStateBlocks.at( j ).second,
+                                currentBlockRows, false );
+                    combinedMatrixRows.block( currentRow, 0, outputStateBlocks.at( j ).second, fullParameterVectorSize ) =
+                            currentBlockRows;
+                    currentRow += outputStateBlocks.at( j ).second;
+                }
+            }
+
+            // Compute Phi P Phi^T for current epoch
+            covarianceProduct.noalias( ) = combinedMatrixRows * initialCovariance;
+            propagatedCovariances.block( 0, i * outputSize, outputSize, outputSize ).noalias( ) =
+                    covarianceProduct * combinedMatrixRows.transpose( );
+        }
+    }, numberOfTasks );
+}
+
 //! Function to propagate full covariance at the initial time to state covariance at later times
 void propagateCovariance(
         std::map< double, Eigen::MatrixXd >& propagatedCovariance,
         const Eigen::MatrixXd& initialCovariance,
         const std::shared_ptr< CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionInterface,
-        const std::vector< double > evaluationTimes )
+        const std::vector< double > evaluationTimes,
+        const int numberOfThreads )
 {
     if( initialCovariance.rows( ) != stateTransitionInterface->getFullParameterVectorSize( ) )
     {
         throw std::runtime_error( "Error when propagating single-arc covariance, sizes are incompatible" );
     }
 
-    std::map< double, Eigen::MatrixXd > fullVariationalEquationsSolutionHistory;
-    getFullVariationalEquationsSolutionHistory(
-                fullVariationalEquationsSolutionHistory, stateTransitionInterface, evaluationTimes );
-    propagateCovariance( propagatedCovariance, initialCovariance, fullVariationalEquationsSolutionHistory );
+    // Compute covariances in parallel (the size of the propagated state may vary between arcs)
+    std::vector< Eigen::MatrixXd > covarianceList( evaluationTimes.size( ) );
+    int numberOfTasks = std::max( 1, std::min( numberOfThreads, static_cast< int >( evaluationTimes.size( ) ) ) );
+    int epochsPerTask = ( evaluationTimes.size( ) + numberOfTasks - 1 ) / numberOfTasks;
+    utilities::executeParallelTasks(
+                numberOfTasks, [ & ]( const int taskIndex )
+    {
+        Eigen::MatrixXd combinedMatrix;
+        Eigen::MatrixXd covarianceProduct;
+        int endEpoch = std::min( static_cast< int >( evaluationTimes.size( ) ), ( taskIndex + 1 ) * epochsPerTask );
+        for( int i = taskIndex * epochsPerTask; i < endEpoch; i++ )
+        {
+            combinedMatrix = stateTransitionInterface->getFullCombinedStateTransitionAndSensitivityMatrix(
+                        evaluationTimes.at( i ), false );
+            covarianceProduct.noalias( ) = combinedMatrix * initialCovariance;
+            covarianceList[ i ].noalias( ) = covarianceProduct * combinedMatrix.transpose( );
+        }
+    }, numberOfTasks );
+
+    for( unsigned int i = 0; i < evaluationTimes.size( ); i++ )
+    {
+        propagatedCovariance[ evaluationTimes.at( i ) ] = std::move( covarianceList[ i ] );
+    }
 }
 
 std::map< double, Eigen::MatrixXd > propagateCovariance(
@@ -186,11 +290,12 @@ void propagateFormalErrors(
         std::map< double, Eigen::VectorXd >& propagatedFormalErrors,
         const Eigen::MatrixXd& initialCovariance,
         const std::shared_ptr< CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionInterface,
-        const std::vector< double > evaluationTimes )
+        const std::vector< double > evaluationTimes,
+        const int numberOfThreads )
 {
     std::map< double, Eigen::MatrixXd > propagatedCovariance;
     propagateCovariance(
-                propagatedCovariance, initialCovariance, stateTransitionInterface, evaluationTimes );
+                propagatedCovariance, initialCovariance, stateTransitionInterface, evaluationTimes, numberOfThreads );
     convertCovarianceHistoryToFormalErrorHistory( propagatedFormalErrors, propagatedCovariance );
 }
 
@@ -0,0 +1,135 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include "tudat/astro/propagators/propagationCheckpoint.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Identifier at start of binary checkpoint file
+static const char checkpointFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'C', 'P', 'T' };
+
+//! Version of binary checkpoint file format
+static const int checkpointFileVersion = 1;
+
+//! Function to write raw bytes of a value to a binary checkpoint file
+template< typename ValueType >
+void writeRawCheckpointValue( std::ostream& stream, const ValueType& value )
+{
+    stream.write( reinterpret_cast< const char* >( &value ), sizeof( ValueType ) );
+}
+
+//! Function to read raw bytes of a value from a binary checkpoint file
+template< typename ValueType >
+void readRawCheckpointValue( std::istream& stream, ValueType& value )
+{
+    stream.read( reinterpret_cast< char* >( &value ), sizeof( ValueType ) );
+    if( !stream )
+    {
+        throw std::runtime_error( "Error when reading propagation checkpoint, unexpected end of file." );
+    }
+}
+
+//! Function to write a single value to a binary checkpoint file
+void writeCheckpointValue( std::ostream& stream, const int value )
+{
+    writeRawCheckpointValue( stream, static_cast< std::int32_t >( value ) );
+}
+
+//! Function to write a single value to a binary checkpoint file
+void writeCheckpointValue( std::ostream& stream, const double value )
+{
+    writeRawCheckpointValue( stream, value );
+}
+
+//! Function to write a single value to a binary checkpoint file
+void writeCheckpointValue( std::ostream& stream, const long double value )
+{
+    writeRawCheckpointValue( stream, value );
+}
+
+//! Function to write a single value to a binary checkpoint file
+void writeCheckpointValue( std::ostream& stream, const Time& value )
+{
+    writeCheckpointValue( stream, value.getFullPeriods( ) );
+    writeCheckpointValue( stream, value.getSecondsIntoFullPeriod( ) );
+}
+
+//! Function to read a single value from a binary checkpoint file
+void readCheckpointValue( std::istream& stream, int& value )
+{
+    std::int32_t fixedSizeValue;
+    readRawCheckpointValue( stream, fixedSizeValue );
+    value = static_cast< int >( fixedSizeValue );
+}
+
+//! Function to read a single value from a binary checkpoint file
+void readCheckpointValue( std::istream& stream, double& value )
+{
+    readRawCheckpointValue( stream, value );
+}
+
+//! Function to read a single value from a binary checkpoint file
+void readCheckpointValue( std::istream& stream, long double& value )
+{
+    readRawCheckpointValue( stream, value );
+}
+
+//! Function to read a single value from a binary checkpoint file
+void readCheckpointValue( std::istream& stream, Time& value )
+{
+    int fullPeriods;
+    long double secondsIntoFullPeriod;
+    readCheckpointValue( stream, fullPeriods );
+    readCheckpointValue( stream, secondsIntoFullPeriod );
+    value = Time( fullPeriods, secondsIntoFullPeriod );
+}
+
+//! Function to write the header of a binary checkpoint file, identifying the file type and scalar types
+void writeCheckpointHeader( std::ostream& stream, const int timeTypeSize, const int stateScalarTypeSize )
+{
+    stream.write( checkpointFileIdentifier, sizeof( checkpointFileIdentifier ) );
+    writeCheckpointValue( stream, checkpointFileVersion );
+    writeCheckpointValue( stream, timeTypeSize );
+    writeCheckpointValue( stream, stateScalarTypeSize );
+}
+
+//! Function to read and check the header of a binary checkpoint file (see writeCheckpointHeader)
+void readCheckpointHeader( std::istream& stream, const int timeTypeSize, const int stateScalarTypeSize )
+{
+    char fileIdentifier[ sizeof( checkpointFileIdentifier ) ];
+    stream.read( fileIdentifier, sizeof( fileIdentifier ) );
+    if( !stream || !std::equal( fileIdentifier, fileIdentifier + sizeof( fileIdentifier ), checkpointFileIdentifier ) )
+    {
+        throw std::runtime_error( "Error when reading propagation checkpoint, file is not a Tudat checkpoint file." );
+    }
+
+    int fileVersion, fileTimeTypeSize, fileStateScalarTypeSize;
+    readCheckpointValue( stream, fileVersion );
+    readCheckpointValue( stream, fileTimeTypeSize );
+    readCheckpointValue( stream, fileStateScalarTypeSize );
+    if( fileVersion != checkpointFileVersion )
+    {
+        throw std::runtime_error( "Error when reading propagation checkpoint, file format version " +
+                                  std::to_string( fileVersion ) + " is not supported." );
+    }
+    if( fileTimeTypeSize != timeTypeSize || fileStateScalarTypeSize != stateScalarTypeSize )
+    {
+        throw std::runtime_error( "Error when reading propagation checkpoint, time or state scalar type of checkpoint "
+                                  "is not compatible with propagation." );
+    }
+}
+
+} // namespace propagators
+
+} // namespace tudat
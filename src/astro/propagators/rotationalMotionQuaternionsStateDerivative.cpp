@@ -72,7 +72,16 @@ Eigen::Matrix< double, 4, 3 > getAngularVelocityToQuaternionRateMatrix( const Ei
 Eigen::Vector4d calculateQuaternionDerivative( const Eigen::Vector4d& currentQuaternionsToBaseFrame,
                                                const Eigen::Vector3d& angularVelocityVectorInBodyFixedFrame )
 {
-    return getQuaterionToQuaternionRateMatrix( angularVelocityVectorInBodyFixedFrame ) * currentQuaternionsToBaseFrame;
+    // Evaluate product with matrix from getQuaterionToQuaternionRateMatrix element-wise, omitting the zero entries
+    const Eigen::Vector4d& q = currentQuaternionsToBaseFrame;
+    const Eigen::Vector3d& w = angularVelocityVectorInBodyFixedFrame;
+
+    Eigen::Vector4d quaternionDerivative;
+    quaternionDerivative( 0 ) = -w( 0 ) * q( 1 ) - w( 1 ) * q( 2 ) - w( 2 ) * q( 3 );
+    quaternionDerivative( 1 ) = w( 0 ) * q( 0 ) + w( 2 ) * q( 2 ) - w( 1 ) * q( 3 );
+    quaternionDerivative( 2 ) = w( 1 ) * q( 0 ) - w( 2 ) * q( 1 ) + w( 0 ) * q( 3 );
+    quaternionDerivative( 3 ) = w( 2 ) * q( 0 ) + w( 1 ) * q( 1 ) - w( 0 ) * q( 2 );
+    return 0.5 * quaternionDerivative;
 }
 
 template class RotationalMotionQuaternionsStateDerivative< double, double >;
@@ -60,11 +60,8 @@ int getRotationalStateSize( const RotationalPropagatorType propagatorType )
     return stateSize;
 }
 
-//! Function to evaluated the classical rotational equations of motion (Euler equations)
-Eigen::Vector3d evaluateRotationalEquationsOfMotion(
-        const Eigen::Matrix3d& inertiaTensor, const Eigen::Vector3d& totalTorque,
-        const Eigen::Vector3d& angularVelocityVector,
-        const Eigen::Matrix3d& inertiaTensorTimeDerivative )
+//! Function to compute the inverse of an inertia tensor, checking that the inverse is well-defined
+Eigen::Matrix3d computeInverseInertiaTensor( const Eigen::Matrix3d& inertiaTensor )
 {
     Eigen::Matrix3d inverseInertiaTensor = inertiaTensor.inverse( );
     if( inverseInertiaTensor.hasNaN( ) )
@@ -74,7 +71,16 @@ Eigen::Vector3d evaluateRotationalEquationsOfMotion(
 
         throw std::runtime_error( "Error when evaluating rotational equations of motion, inverse inertia tensor contains NaN. ");
     }
-    return inverseInertiaTensor * ( totalTorque );
+    return inverseInertiaTensor;
+}
+
+//! Function to evaluated the classical rotational equations of motion (Euler equations)
+Eigen::Vector3d evaluateRotationalEquationsOfMotion(
+        const Eigen::Matrix3d& inertiaTensor, const Eigen::Vector3d& totalTorque,
+        const Eigen::Vector3d& angularVelocityVector,
+        const Eigen::Matrix3d& inertiaTensorTimeDerivative )
+{
+    return computeInverseInertiaTensor( inertiaTensor ) * ( totalTorque );
 }
 
 template class RotationalMotionStateDerivative< double, double >;
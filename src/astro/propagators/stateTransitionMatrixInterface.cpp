@@ -10,6 +10,7 @@
 
 
 
+#include "tudat/math/interpolators/lagrangeInterpolator.h"
 #include "tudat/astro/propagators/stateTransitionMatrixInterface.h"
 
 namespace tudat
@@ -18,6 +19,26 @@ namespace tudat
 namespace propagators
 {
 
+//! Function to interpolate a block of rows of a matrix-valued interpolator, writing the result into a given block
+void interpolateMatrixRows(
+        const std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > > matrixInterpolator,
+        const double evaluationTime,
+        const int startRow,
+        Eigen::Block< Eigen::MatrixXd > interpolatedRows )
+{
+    std::shared_ptr< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > > lagrangeInterpolator =
+            std::dynamic_pointer_cast< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > >( matrixInterpolator );
+    if( lagrangeInterpolator != nullptr )
+    {
+        lagrangeInterpolator->interpolateRows( evaluationTime, startRow, interpolatedRows );
+    }
+    else
+    {
+        interpolatedRows = matrixInterpolator->interpolate( evaluationTime ).block(
+                    startRow, 0, interpolatedRows.rows( ), interpolatedRows.cols( ) );
+    }
+}
+
 //! Function to reset the state transition and sensitivity matrix interpolators
 void SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::updateMatrixInterpolators(
         const std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
@@ -28,6 +49,7 @@ void SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::updateMatrix
 {
     stateTransitionMatrixInterpolator_ = stateTransitionMatrixInterpolator;
     sensitivityMatrixInterpolator_ = sensitivityMatrixInterpolator;
+    clearMatrixCache( );
 
     // Re-order state partial addition indices to match ephemeris update order (inverted in variational equations object)
     statePartialAdditionIndices_.clear( );
@@ -43,16 +65,18 @@ Eigen::MatrixXd SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::g
         const bool addCentralBodyDependency,
         const std::vector< std::string >& arcDefiningBodies )
 {
-    combinedStateTransitionMatrix_.setZero( );
+    // Matrix is created locally (rather than as member variable), so that function may be called concurrently
+    Eigen::MatrixXd combinedStateTransitionMatrix = Eigen::MatrixXd::Zero(
+                stateTransitionMatrixSize_, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
 
 
     // Set Phi and S matrices.
-    combinedStateTransitionMatrix_.block( 0, 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ) =
+    combinedStateTransitionMatrix.block( 0, 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ) =
             stateTransitionMatrixInterpolator_->interpolate( evaluationTime );
 
     if( sensitivityMatrixSize_ > 0 )
     {
-        combinedStateTransitionMatrix_.block( 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_, sensitivityMatrixSize_ ) =
+        combinedStateTransitionMatrix.block( 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_, sensitivityMatrixSize_ ) =
                 sensitivityMatrixInterpolator_->interpolate( evaluationTime );
     }
 
@@ -60,14 +84,43 @@ Eigen::MatrixXd SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::g
     {
         for( unsigned int i = 0; i < statePartialAdditionIndices_.size( ); i++ )
         {
-            combinedStateTransitionMatrix_.block(
+            combinedStateTransitionMatrix.block(
                     statePartialAdditionIndices_.at( i ).first, 0, 6, stateTransitionMatrixSize_ + sensitivityMatrixSize_ ) +=
-                    combinedStateTransitionMatrix_.block(
+                    combinedStateTransitionMatrix.block(
                             statePartialAdditionIndices_.at( i ).second, 0, 6, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
         }
     }
 
-    return combinedStateTransitionMatrix_;
+    return combinedStateTransitionMatrix;
+}
+
+//! Function to compute a block of rows of the concatenated state transition and sensitivity matrix at a given time.
+void SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::computeFullCombinedStateTransitionAndSensitivityMatrixRows(
+        const double evaluationTime,
+        const int startRow,
+        const int numberOfRows,
+        Eigen::MatrixXd& matrixRows,
+        const bool addCentralBodyDependency,
+        const std::vector< std::string >& arcDefiningBodies )
+{
+    // Central body dependency requires rows of other bodies
+    if( addCentralBodyDependency && statePartialAdditionIndices_.size( ) > 0 )
+    {
+        matrixRows = getCombinedStateTransitionAndSensitivityMatrix(
+                    evaluationTime, addCentralBodyDependency, arcDefiningBodies ).block(
+                    startRow, 0, numberOfRows, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
+    }
+    else
+    {
+        matrixRows.resize( numberOfRows, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
+        interpolateMatrixRows( stateTransitionMatrixInterpolator_, evaluationTime, startRow,
+                               matrixRows.block( 0, 0, numberOfRows, stateTransitionMatrixSize_ ) );
+        if( sensitivityMatrixSize_ > 0 )
+        {
+            interpolateMatrixRows( sensitivityMatrixInterpolator_, evaluationTime, startRow,
+                                   matrixRows.block( 0, stateTransitionMatrixSize_, numberOfRows, sensitivityMatrixSize_ ) );
+        }
+    }
 }
 
 }
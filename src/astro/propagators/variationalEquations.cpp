@@ -7,6 +7,7 @@
  *    a copy of the license with this file. If not, please or visit:
  *    http://tudat.tudelft.nl/LICENSE.
  */
+#include <algorithm>
 #include <map>
 
 
@@ -57,29 +58,13 @@ void VariationalEquations::setBodyStatePartialMatrix( )
         }
     }
 
-    // Iterate over all bodies undergoing accelerations for which initial condition is to be estimated.
-    for( std::map< IntegratedStateType, std::vector< std::multimap< std::pair< int, int >,
-         std::function< void( Eigen::Block< Eigen::MatrixXd > ) > > > >::iterator
-         typeIterator = statePartialList_.begin( ); typeIterator != statePartialList_.end( ); typeIterator++ )
+    // Evaluate all state partial functions determined by setStatePartialFunctionList( )
+    for( unsigned int i = 0; i < statePartialBlocks_.size( ); i++ )
     {
-        int startIndex = stateTypeStartIndices_.at( typeIterator->first );
-        int currentStateSize = getSingleIntegrationSize( typeIterator->first );
-        int entriesToSkipPerEntry = currentStateSize - getGeneralizedAccelerationSize( typeIterator->first );
-
-        for( unsigned int i = 0; i < typeIterator->second.size( ); i++ )
-        {
-            // Iterate over all bodies exerting an acceleration on this body.
-            for( statePartialIterator_ = typeIterator->second.at( i ).begin( );
-                 statePartialIterator_ != typeIterator->second.at( i ).end( );
-                 statePartialIterator_++ )
-            {
-                statePartialIterator_->second(
-                            variationalMatrix_.block(
-                                startIndex + entriesToSkipPerEntry + i* currentStateSize, statePartialIterator_->first.first,
-                                currentStateSize - entriesToSkipPerEntry, statePartialIterator_->first.second ) );
-
-            }
-        }
+        statePartialBlocks_[ i ].partialFunction_(
+                    variationalMatrix_.block(
+                        statePartialBlocks_[ i ].rowIndex_, statePartialBlocks_[ i ].columnIndex_,
+                        statePartialBlocks_[ i ].numberOfRows_, statePartialBlocks_[ i ].numberOfColumns_ ) );
     }
 
     for( unsigned int i = 0; i < statePartialAdditionIndices_.size( ); i++ )
@@ -119,7 +104,7 @@ void VariationalEquations::clearPartials( )
 void VariationalEquations::setStatePartialFunctionList( )
 {
     std::pair< std::function< void( Eigen::Block< Eigen::MatrixXd > ) >, int > currentDerivativeFunction;
-
+    statePartialNonZeroColumnBlocks_.clear( );
 
     // Iterate over all state types
     for( std::map< propagators::IntegratedStateType,
@@ -159,6 +144,15 @@ void VariationalEquations::setStatePartialFunctionList( )
                                                             stateTypeStartIndices_.at( estimatedStateIterator->first ),
                                                             getSingleIntegrationSize( estimatedStateIterator->first ) ),
                                             currentDerivativeFunction.first ) );
+
+                            // Store columns of partial that may be non-zero (e.g. velocity columns skipped for gravity)
+                            statePartialNonZeroColumnBlocks_.push_back(
+                                        std::make_pair( k * getSingleIntegrationSize( estimatedStateIterator->first ) +
+                                                        stateTypeStartIndices_.at( estimatedStateIterator->first ),
+                                                        stateDerivativeTypeIterator_->second.at( i ).at( j )->
+                                                        getNumberOfNonZeroStatePartialColumns(
+                                                            estimatedStateIterator->second.at( k ),
+                                                            estimatedStateIterator->first ) ) );
                         }
                     }
                 }
@@ -168,6 +162,150 @@ void VariationalEquations::setStatePartialFunctionList( )
     }
 }
 
+//! Function to merge a list of (start index, size) pairs into list of sorted, non-overlapping and non-adjacent blocks
+std::vector< std::pair< int, int > > mergeIndexBlocks( std::vector< std::pair< int, int > > indexBlocks )
+{
+    std::sort( indexBlocks.begin( ), indexBlocks.end( ) );
+
+    std::vector< std::pair< int, int > > mergedIndexBlocks;
+    for( unsigned int i = 0; i < indexBlocks.size( ); i++ )
+    {
+        if( mergedIndexBlocks.size( ) > 0 &&
+                indexBlocks.at( i ).first <= mergedIndexBlocks.back( ).first + mergedIndexBlocks.back( ).second )
+        {
+            mergedIndexBlocks.back( ).second = std::max(
+                        mergedIndexBlocks.back( ).second,
+                        indexBlocks.at( i ).first + indexBlocks.at( i ).second - mergedIndexBlocks.back( ).first );
+        }
+        else if( indexBlocks.at( i ).second > 0 )
+        {
+            mergedIndexBlocks.push_back( indexBlocks.at( i ) );
+        }
+    }
+    return mergedIndexBlocks;
+}
+
+//! Function (called by constructor) to assemble the partial function lists into the lists of blocks that are evaluated
+void VariationalEquations::setPartialBlockLists( )
+{
+    statePartialBlocks_.clear( );
+    parameterPartialBlocks_.clear( );
+    kinematicPositionRowIndices_.clear( );
+
+    std::vector< std::pair< int, int > > rowBlocks;
+    std::vector< std::pair< int, int > > columnBlocks;
+
+    // Iterate over all state types
+    for( auto typeIterator : stateDerivativePartialList_ )
+    {
+        int startIndex = stateTypeStartIndices_.at( typeIterator.first );
+        int currentStateSize = getSingleIntegrationSize( typeIterator.first );
+        int entriesToSkipPerEntry = currentStateSize - getGeneralizedAccelerationSize( typeIterator.first );
+
+        for( unsigned int i = 0; i < typeIterator.second.size( ); i++ )
+        {
+            int currentRowIndex = startIndex + entriesToSkipPerEntry + i * currentStateSize;
+            int currentNumberOfRows = currentStateSize - entriesToSkipPerEntry;
+
+            // Set rows for which product with state transition matrix is computed explicitly
+            if( typeIterator.first == translational_state )
+            {
+                kinematicPositionRowIndices_.push_back( startIndex + i * currentStateSize );
+                rowBlocks.push_back( std::make_pair( currentRowIndex, currentNumberOfRows ) );
+            }
+            else
+            {
+                rowBlocks.push_back( std::make_pair( startIndex + i * currentStateSize, currentStateSize ) );
+            }
+
+            if( typeIterator.first == rotational_state )
+            {
+                columnBlocks.push_back( std::make_pair( startIndex + i * currentStateSize, currentStateSize ) );
+            }
+
+            // Add state partial blocks of current body
+            if( statePartialList_.count( typeIterator.first ) > 0 )
+            {
+                for( auto partialIterator : statePartialList_.at( typeIterator.first ).at( i ) )
+                {
+                    statePartialBlocks_.push_back(
+                                VariationalEquationsPartialBlock(
+                                    currentRowIndex, partialIterator.first.first,
+                                    currentNumberOfRows, partialIterator.first.second, partialIterator.second ) );
+                }
+            }
+
+            // Add parameter partial blocks of current body
+            if( parameterPartialList_.count( typeIterator.first ) > 0 )
+            {
+                for( auto partialIterator : parameterPartialList_.at( typeIterator.first ).at( i ) )
+                {
+                    parameterPartialBlocks_.push_back(
+                                VariationalEquationsPartialBlock(
+                                    currentRowIndex, partialIterator.first.first - totalDynamicalStateSize_,
+                                    currentNumberOfRows, partialIterator.first.second, partialIterator.second ) );
+                }
+            }
+        }
+    }
+
+    // Add columns in which state partials may be non-zero
+    columnBlocks.insert( columnBlocks.end( ), statePartialNonZeroColumnBlocks_.begin( ),
+                         statePartialNonZeroColumnBlocks_.end( ) );
+
+    // Add columns to which partials of central bodies are added
+    for( unsigned int i = 0; i < statePartialAdditionIndices_.size( ); i++ )
+    {
+        columnBlocks.push_back( std::make_pair( statePartialAdditionIndices_.at( i ).second, 3 ) );
+    }
+
+    variationalMatrixRowBlocks_ = mergeIndexBlocks( rowBlocks );
+    variationalMatrixColumnBlocks_ = mergeIndexBlocks( columnBlocks );
+}
+
+//! Function to omit the sensitivity matrix columns of parameters that do not influence the dynamics
+std::vector< int > VariationalEquations::omitDynamicsFreeParameterColumns( )
+{
+    if( areDynamicsFreeParameterColumnsOmitted_ )
+    {
+        return propagatedSensitivityColumnIndices_;
+    }
+    areDynamicsFreeParameterColumnsOmitted_ = true;
+
+    // Find columns that can be set by parameter partials
+    const int numberOfStaticParameters = numberOfParameterValues_ - totalDynamicalStateSize_;
+    std::vector< bool > isColumnPropagated( numberOfStaticParameters, false );
+    for( unsigned int i = 0; i < parameterPartialBlocks_.size( ); i++ )
+    {
+        for( int j = 0; j < parameterPartialBlocks_.at( i ).numberOfColumns_; j++ )
+        {
+            isColumnPropagated.at( parameterPartialBlocks_.at( i ).columnIndex_ + j ) = true;
+        }
+    }
+
+    // Set map from full to reduced column index
+    std::vector< int > reducedColumnIndices( numberOfStaticParameters, -1 );
+    for( int i = 0; i < numberOfStaticParameters; i++ )
+    {
+        if( isColumnPropagated.at( i ) )
+        {
+            reducedColumnIndices[ i ] = propagatedSensitivityColumnIndices_.size( );
+            propagatedSensitivityColumnIndices_.push_back( i );
+        }
+    }
+
+    // Columns of a single block are contiguous in the reduced matrix, since all of them are propagated
+    for( unsigned int i = 0; i < parameterPartialBlocks_.size( ); i++ )
+    {
+        parameterPartialBlocks_[ i ].columnIndex_ = reducedColumnIndices.at( parameterPartialBlocks_.at( i ).columnIndex_ );
+    }
+
+    numberOfParameterValues_ = totalDynamicalStateSize_ + propagatedSensitivityColumnIndices_.size( );
+    variationalParameterMatrix_ = Eigen::MatrixXd::Zero(
+                totalDynamicalStateSize_, numberOfParameterValues_ - totalDynamicalStateSize_ );
+
+    return propagatedSensitivityColumnIndices_;
+}
 
 } // namespace propagators
 
@@ -16,22 +16,38 @@ void ThrustAcceleration::updateMembers( const double currentTime )
         currentAcceleration_.setZero( );
         thrustDirectionCalculator_->update( currentTime );
 
-        for( unsigned int i = 0; i < thrustSources_.size( ); i++ )
+        if( !saveThrustContributions_ && orientationBasedThrustDirectionCalculator_ != nullptr )
         {
-            thrustSources_.at( i )->updateEngineModel( currentTime );
-            if( !saveThrustContributions_ )
+            // Sum thrust of all engines in body-fixed frame, and rotate to inertial frame once
+            Eigen::Vector3d bodyFixedAcceleration = Eigen::Vector3d::Zero( );
+            for( unsigned int i = 0; i < thrustSources_.size( ); i++ )
             {
-                currentMassRate_ -= thrustSources_.at( i )->getCurrentMassRate( currentMass_ );
-                currentAcceleration_ += ( thrustSources_.at( i )->getCurrentThrustAcceleration( currentMass_ ) )*
-                        thrustDirectionCalculator_->getInertialThrustDirection( thrustSources_.at( i ) ) ;
+                thrustSources_[ i ]->updateEngineModel( currentTime );
+                currentMassRate_ -= thrustSources_[ i ]->getCurrentMassRate( currentMass_ );
+                bodyFixedAcceleration += thrustSources_[ i ]->getCurrentThrustAcceleration( currentMass_ ) *
+                        thrustSources_[ i ]->getBodyFixedThrustDirection( );
             }
-            else
+            currentAcceleration_ = orientationBasedThrustDirectionCalculator_->getCurrentRotation( ) * bodyFixedAcceleration;
+        }
+        else
+        {
+            for( unsigned int i = 0; i < thrustSources_.size( ); i++ )
             {
-                currentMassRateContributions_[ i ] = thrustSources_.at( i )->getCurrentMassRate( currentMass_ );
-                currentMassRate_ -= currentMassRateContributions_[ i ];
-                currentThrustAccelerationContributions_[ i ] = ( thrustSources_.at( i )->getCurrentThrustAcceleration( currentMass_ )  )*
-                        thrustDirectionCalculator_->getInertialThrustDirection( thrustSources_.at( i ) );
-                currentAcceleration_ += currentThrustAccelerationContributions_[ i ];
+                thrustSources_.at( i )->updateEngineModel( currentTime );
+                if( !saveThrustContributions_ )
+                {
+                    currentMassRate_ -= thrustSources_.at( i )->getCurrentMassRate( currentMass_ );
+                    currentAcceleration_ += ( thrustSources_.at( i )->getCurrentThrustAcceleration( currentMass_ ) )*
+                            thrustDirectionCalculator_->getInertialThrustDirection( thrustSources_.at( i ) ) ;
+                }
+                else
+                {
+                    currentMassRateContributions_[ i ] = thrustSources_.at( i )->getCurrentMassRate( currentMass_ );
+                    currentMassRate_ -= currentMassRateContributions_[ i ];
+                    currentThrustAccelerationContributions_[ i ] = ( thrustSources_.at( i )->getCurrentThrustAcceleration( currentMass_ )  )*
+                            thrustDirectionCalculator_->getInertialThrustDirection( thrustSources_.at( i ) );
+                    currentAcceleration_ += currentThrustAccelerationContributions_[ i ];
+                }
             }
         }
 
@@ -60,51 +60,52 @@ namespace propulsion
             double h = modifiedEquinoctialElements[ orbital_element_conversions::hElementIndex ];
             double k = modifiedEquinoctialElements[ orbital_element_conversions::kElementIndex ];
             double L = modifiedEquinoctialElements[ orbital_element_conversions::trueLongitudeIndex ];
+            double sinL = sinL;
+            double cosL = cosL;
 
-            double w1 = 1.0 + f * std::cos( L ) + g * std::sin( L );
+            double w1 = 1.0 + f * cosL + g * sinL;
             double w2 = 1.0 + h * h + k * k;
 
             // Compute all required auxiliary variables to compute optimal angle alpha.
             double lambdap = costates_[ orbital_element_conversions::semiParameterIndex ] * ( 2.0 * p ) / w1;
-            double lambdaf1 = costates_[ orbital_element_conversions::fElementIndex ] * std::sin( L );
-            double lambdag1 = costates_[ orbital_element_conversions::gElementIndex ] * std::cos( L );
+            double lambdaf1 = costates_[ orbital_element_conversions::fElementIndex ] * sinL;
+            double lambdag1 = costates_[ orbital_element_conversions::gElementIndex ] * cosL;
             double lambdaf2 = costates_[ orbital_element_conversions::fElementIndex ] / w1 *
-                    ( ( w1 + 1.0 ) * std::cos( L ) + f );
-                    //costates_[ orbital_element_conversions::fElementIndex ] * ( ( w1 + 1.0 ) * std::cos( L ) + f ) / w1;
-            double lambdag2 = costates_[ orbital_element_conversions::gElementIndex ] / w1 * ( ( w1 + 1.0 ) * std::sin( L ) + g );
+                    ( ( w1 + 1.0 ) * cosL + f );
+                    //costates_[ orbital_element_conversions::fElementIndex ] * ( ( w1 + 1.0 ) * cosL + f ) / w1;
+            double lambdag2 = costates_[ orbital_element_conversions::gElementIndex ] / w1 * ( ( w1 + 1.0 ) * sinL + g );
 
-            // Compute sinus of the optimal value of angle alpha.
-            double sinOptimalAlpha = - ( lambdaf1 - lambdag1 ) /
+            double alphaNormalization =
                     std::sqrt( ( lambdaf1 - lambdag1 ) * ( lambdaf1 - lambdag1 ) +
                                ( lambdap + lambdaf2 + lambdag2 ) * ( lambdap + lambdaf2 + lambdag2 ) );
 
+            // Compute sinus of the optimal value of angle alpha.
+            double sinOptimalAlpha = - ( lambdaf1 - lambdag1 ) / alphaNormalization;
+
             // Compute cosinus of the optimal value of angle alpha.
-            double cosOptimalAlpha = - ( lambdap + lambdaf2 + lambdag2 ) /
-                    std::sqrt( ( lambdaf1 - lambdag1 ) * ( lambdaf1 - lambdag1 ) +
-                               ( lambdap + lambdaf2 + lambdag2 ) * ( lambdap + lambdaf2 + lambdag2 ) );
+            double cosOptimalAlpha = - ( lambdap + lambdaf2 + lambdag2 ) / alphaNormalization;
 
             // Compute all required auxiliary variables to compute optimal angle beta.
             lambdap = costates_[ orbital_element_conversions::semiParameterIndex ] * ( 2.0 * p ) / w1 * cosOptimalAlpha;
-            lambdaf1 = costates_[ orbital_element_conversions::fElementIndex ] * std::sin( L ) * sinOptimalAlpha;
-            lambdag1 = costates_[ orbital_element_conversions::gElementIndex ] * std::cos( L ) * sinOptimalAlpha;
-            lambdaf2 = costates_[ orbital_element_conversions::fElementIndex ] * ( ( 1.0 + w1 ) * std::cos( L ) + f ) / w1 * cosOptimalAlpha;
-            lambdag2 = costates_[ orbital_element_conversions::gElementIndex ] * ( ( 1.0 + w1 ) * std::sin( L ) + g ) / w1 * cosOptimalAlpha;
-            double lambdaf3 = costates_[ orbital_element_conversions::fElementIndex ] * ( g / w1 ) * ( h * std::sin( L ) - k * std::cos( L ) );
-            double lambdag3 = costates_[ orbital_element_conversions::gElementIndex ] * ( f / w1 ) * ( h * std::sin( L ) - k * std::cos( L ) );
-            double lambdah = costates_[ orbital_element_conversions::hElementIndex ] * ( w2 * std::cos( L ) ) / ( 2.0 * w1 );
-            double lambdak = costates_[ orbital_element_conversions::kElementIndex ] * ( w2 * std::sin( L ) ) / ( 2.0 * w1 );
-
-            // Compute sinus of optimal thrust angle beta.
-            double sinOptimalBeta = - ( - lambdaf3 + lambdag3 + lambdah + lambdak ) /
+            lambdaf1 = costates_[ orbital_element_conversions::fElementIndex ] * sinL * sinOptimalAlpha;
+            lambdag1 = costates_[ orbital_element_conversions::gElementIndex ] * cosL * sinOptimalAlpha;
+            lambdaf2 = costates_[ orbital_element_conversions::fElementIndex ] * ( ( 1.0 + w1 ) * cosL + f ) / w1 * cosOptimalAlpha;
+            lambdag2 = costates_[ orbital_element_conversions::gElementIndex ] * ( ( 1.0 + w1 ) * sinL + g ) / w1 * cosOptimalAlpha;
+            double lambdaf3 = costates_[ orbital_element_conversions::fElementIndex ] * ( g / w1 ) * ( h * sinL - k * cosL );
+            double lambdag3 = costates_[ orbital_element_conversions::gElementIndex ] * ( f / w1 ) * ( h * sinL - k * cosL );
+            double lambdah = costates_[ orbital_element_conversions::hElementIndex ] * ( w2 * cosL ) / ( 2.0 * w1 );
+            double lambdak = costates_[ orbital_element_conversions::kElementIndex ] * ( w2 * sinL ) / ( 2.0 * w1 );
+
+            double betaNormalization =
                     std::sqrt( ( - lambdaf3 + lambdag3 + lambdah + lambdak ) * ( - lambdaf3 + lambdag3 + lambdah + lambdak )
                                + ( lambdap + lambdaf1 - lambdag1 + lambdaf2 + lambdag2 )
                                * ( lambdap + lambdaf1 - lambdag1 + lambdaf2 + lambdag2 ) );
 
+            // Compute sinus of optimal thrust angle beta.
+            double sinOptimalBeta = - ( - lambdaf3 + lambdag3 + lambdah + lambdak ) / betaNormalization;
+
             // Compute cosinus of optimal thrust angle beta.
-            double cosOptimalBeta = - ( lambdap + lambdaf1 - lambdag1 + lambdaf2 + lambdag2 ) /
-                    std::sqrt( ( - lambdaf3 + lambdag3 + lambdah + lambdak ) * ( - lambdaf3 + lambdag3 + lambdah + lambdak )
-                               + ( lambdap + lambdaf1 - lambdag1 + lambdaf2 + lambdag2 )
-                               * ( lambdap + lambdaf1 - lambdag1 + lambdaf2 + lambdag2 ) );
+            double cosOptimalBeta = - ( lambdap + lambdaf1 - lambdag1 + lambdaf2 + lambdag2 ) / betaNormalization;
 
 
             // Switching function for the thrust magnitude.
@@ -157,6 +158,8 @@ namespace propulsion
 
             // Compute specific impulse
             currentSpecificImpulse_ = specificImpulseFunction_( currentSpecificImpulseInputVariables_ );
+
+            currentTime_ = time;
         }
     }
 
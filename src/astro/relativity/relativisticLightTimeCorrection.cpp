@@ -35,6 +35,26 @@ double calculateFirstOrderLightTimeCorrectionFromCentralBody( const double bodyG
 
 }
 
+//! Function to calculate first order relativistic light time corrections due to a set of gravitating point masses.
+Eigen::VectorXd calculateFirstOrderLightTimeCorrectionsFromCentralBodies(
+        const Eigen::VectorXd& bodyGravitationalParameters,
+        const Eigen::Vector3d& transmitterPosition,
+        const Eigen::Vector3d& receiverPosition,
+        const Eigen::Matrix3Xd& centralBodyPositions,
+        const double ppnParameterGamma )
+{
+    // Calculate Euclidean geometric distances between transmitter, receiver and gravitating bodies.
+    Eigen::ArrayXd summedDistances =
+            ( centralBodyPositions.colwise( ) - receiverPosition ).colwise( ).norm( ).transpose( ).array( ) +
+            ( centralBodyPositions.colwise( ) - transmitterPosition ).colwise( ).norm( ).transpose( ).array( );
+    double linkEuclideanDistance = ( transmitterPosition - receiverPosition ).norm( );
+
+    // Calculate and return light time corrections.
+    return ( ( 1.0 + ppnParameterGamma ) * physical_constants::INVERSE_CUBIC_SPEED_OF_LIGHT *
+             bodyGravitationalParameters.array( ) *
+             ( ( summedDistances + linkEuclideanDistance ) / ( summedDistances - linkEuclideanDistance ) ).log( ) ).matrix( );
+}
+
 //! Function to calculate gradient of first order relativistic light time correction due to a gravitating point mass.
 Eigen::Matrix< double, 1, 3 > calculateFirstOrderCentralBodyLightTimeCorrectionGradient(
         const double bodyGravitationalParameter,
@@ -0,0 +1,206 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cerrno>
+#include <cstdlib>
+#include <new>
+
+#include "tudat/basics/allocationCounter.h"
+
+// Allocations are counted by interposing the C allocation functions when using glibc (so that both allocations through
+// operator new, and allocations of Eigen (which calls malloc directly) are counted). On other platforms, only the global
+// operator new is replaced.
+#if TUDAT_BUILD_WITH_PROPAGATION_PROFILING && defined( __GLIBC__ )
+#define TUDAT_COUNT_MALLOC_ALLOCATIONS 1
+#else
+#define TUDAT_COUNT_MALLOC_ALLOCATIONS 0
+#endif
+
+#if TUDAT_COUNT_MALLOC_ALLOCATIONS
+extern "C"
+{
+void* __libc_malloc( std::size_t size );
+void* __libc_calloc( std::size_t numberOfElements, std::size_t elementSize );
+void* __libc_realloc( void* memory, std::size_t size );
+void* __libc_memalign( std::size_t alignment, std::size_t size );
+}
+#endif
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+namespace
+{
+
+//! Number of heap allocations made by the current thread
+/*!
+ *  Number of heap allocations made by the current thread. The initial-exec TLS model is used when counting malloc calls,
+ *  since the general dynamic model may itself call malloc on first access in a thread.
+ */
+#if TUDAT_COUNT_MALLOC_ALLOCATIONS
+thread_local long long numberOfHeapAllocations __attribute__( ( tls_model( "initial-exec" ) ) ) = 0;
+#else
+thread_local long long numberOfHeapAllocations = 0;
+#endif
+
+}
+
+//! Function to retrieve the number of heap allocations made by the current thread
+long long getNumberOfHeapAllocationsInCurrentThread( )
+{
+    return numberOfHeapAllocations;
+}
+
+#if TUDAT_COUNT_MALLOC_ALLOCATIONS
+//! Function to increment the number of heap allocations made by the current thread
+void incrementNumberOfHeapAllocations( )
+{
+    numberOfHeapAllocations++;
+}
+#elif TUDAT_BUILD_WITH_PROPAGATION_PROFILING
+namespace
+{
+
+//! Function to allocate (and count) memory for the replaced global operator new
+void* allocateCountedMemory( const std::size_t size )
+{
+    numberOfHeapAllocations++;
+    void* memory = std::malloc( size == 0 ? 1 : size );
+    if( memory == nullptr )
+    {
+        throw std::bad_alloc( );
+    }
+    return memory;
+}
+
+}
+#endif
+
+} // namespace utilities
+
+} // namespace tudat
+
+#if TUDAT_COUNT_MALLOC_ALLOCATIONS
+
+// Interposed C allocation functions, counting the number of allocations per thread.
+extern "C"
+{
+
+void* malloc( std::size_t size )
+{
+    tudat::utilities::incrementNumberOfHeapAllocations( );
+    return __libc_malloc( size );
+}
+
+void* calloc( std::size_t numberOfElements, std::size_t elementSize )
+{
+    tudat::utilities::incrementNumberOfHeapAllocations( );
+    return __libc_calloc( numberOfElements, elementSize );
+}
+
+void* realloc( void* memory, std::size_t size )
+{
+    tudat::utilities::incrementNumberOfHeapAllocations( );
+    return __libc_realloc( memory, size );
+}
+
+void* memalign( std::size_t alignment, std::size_t size )
+{
+    tudat::utilities::incrementNumberOfHeapAllocations( );
+    return __libc_memalign( alignment, size );
+}
+
+void* aligned_alloc( std::size_t alignment, std::size_t size )
+{
+    tudat::utilities::incrementNumberOfHeapAllocations( );
+    return __libc_memalign( alignment, size );
+}
+
+int posix_memalign( void** memory, std::size_t alignment, std::size_t size )
+{
+    tudat::utilities::incrementNumberOfHeapAllocations( );
+    *memory = __libc_memalign( alignment, size );
+    return ( *memory == nullptr ) ? ENOMEM : 0;
+}
+
+}
+
+#elif TUDAT_BUILD_WITH_PROPAGATION_PROFILING
+
+// Replacements of the global operator new (and matching operator delete), counting the number of allocations per thread.
+
+void* operator new( std::size_t size )
+{
+    return tudat::utilities::allocateCountedMemory( size );
+}
+
+void* operator new[ ]( std::size_t size )
+{
+    return tudat::utilities::allocateCountedMemory( size );
+}
+
+void* operator new( std::size_t size, const std::nothrow_t& ) noexcept
+{
+    try
+    {
+        return tudat::utilities::allocateCountedMemory( size );
+    }
+    catch( ... )
+    {
+        return nullptr;
+    }
+}
+
+void* operator new[ ]( std::size_t size, const std::nothrow_t& ) noexcept
+{
+    try
+    {
+        return tudat::utilities::allocateCountedMemory( size );
+    }
+    catch( ... )
+    {
+        return nullptr;
+    }
+}
+
+void operator delete( void* memory ) noexcept
+{
+    std::free( memory );
+}
+
+void operator delete[ ]( void* memory ) noexcept
+{
+    std::free( memory );
+}
+
+void operator delete( void* memory, std::size_t ) noexcept
+{
+    std::free( memory );
+}
+
+void operator delete[ ]( void* memory, std::size_t ) noexcept
+{
+    std::free( memory );
+}
+
+void operator delete( void* memory, const std::nothrow_t& ) noexcept
+{
+    std::free( memory );
+}
+
+void operator delete[ ]( void* memory, const std::nothrow_t& ) noexcept
+{
+    std::free( memory );
+}
+
+#endif
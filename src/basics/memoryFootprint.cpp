@@ -0,0 +1,72 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <iomanip>
+#include <sstream>
+
+#include "tudat/basics/memoryFootprint.h"
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Function to add all entries of another footprint to this footprint
+void MemoryFootprint::addFootprint( const MemoryFootprint& memoryFootprint, const std::string& prefix )
+{
+    for( auto entryIterator : memoryFootprint.getEntries( ) )
+    {
+        addEntry( ( prefix == "" ) ? entryIterator.first : ( prefix + "/" + entryIterator.first ), entryIterator.second );
+    }
+}
+
+//! Function to retrieve the total number of bytes in all categories
+std::size_t MemoryFootprint::getTotalSize( ) const
+{
+    std::size_t totalSize = 0;
+    for( auto entryIterator : entries_ )
+    {
+        totalSize += entryIterator.second;
+    }
+    return totalSize;
+}
+
+//! Function to retrieve the total number of bytes in all categories starting with a given prefix
+std::size_t MemoryFootprint::getTotalSize( const std::string& prefix ) const
+{
+    std::size_t totalSize = 0;
+    for( auto entryIterator : entries_ )
+    {
+        if( entryIterator.first.compare( 0, prefix.size( ), prefix ) == 0 )
+        {
+            totalSize += entryIterator.second;
+        }
+    }
+    return totalSize;
+}
+
+//! Function to retrieve a summary of the footprint, with one line (in MB) per category
+std::string MemoryFootprint::getSummary( ) const
+{
+    std::ostringstream summaryStream;
+    summaryStream << std::fixed << std::setprecision( 3 );
+    for( auto entryIterator : entries_ )
+    {
+        summaryStream << entryIterator.first << ": " << static_cast< double >( entryIterator.second ) / 1.0E6 << " MB" <<
+                         std::endl;
+    }
+    summaryStream << "Total: " << static_cast< double >( getTotalSize( ) ) / 1.0E6 << " MB" << std::endl;
+    return summaryStream.str( );
+}
+
+} // namespace utilities
+
+} // namespace tudat
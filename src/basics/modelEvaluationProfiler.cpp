@@ -0,0 +1,133 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+#include "tudat/basics/modelEvaluationProfiler.h"
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Function to escape a string for use in a JSON file
+std::string escapeJsonString( const std::string& unescapedString )
+{
+    std::string escapedString;
+    for( unsigned int i = 0; i < unescapedString.size( ); i++ )
+    {
+        char currentCharacter = unescapedString.at( i );
+        if( currentCharacter == '"' || currentCharacter == '\\' )
+        {
+            escapedString += '\\';
+            escapedString += currentCharacter;
+        }
+        else if( static_cast< unsigned char >( currentCharacter ) < 0x20 )
+        {
+            std::ostringstream characterStream;
+            characterStream << "\\u" << std::hex << std::setw( 4 ) << std::setfill( '0' ) <<
+                               static_cast< int >( currentCharacter );
+            escapedString += characterStream.str( );
+        }
+        else
+        {
+            escapedString += currentCharacter;
+        }
+    }
+    return escapedString;
+}
+
+//! Function to register a model that is to be profiled
+int ModelEvaluationProfiler::addProfiledModel( const std::string& category, const std::string& modelName )
+{
+    std::pair< std::string, std::string > modelKey = std::make_pair( category, modelName );
+    if( modelIndices_.count( modelKey ) == 0 )
+    {
+        modelIndices_[ modelKey ] = static_cast< int >( modelStatistics_.size( ) );
+        modelStatistics_.push_back( ProfiledModelStatistics( category, modelName ) );
+    }
+    return modelIndices_.at( modelKey );
+}
+
+//! Function to reset the accumulated statistics of all profiled models to zero (models remain registered)
+void ModelEvaluationProfiler::resetStatistics( )
+{
+    for( unsigned int i = 0; i < modelStatistics_.size( ); i++ )
+    {
+        modelStatistics_[ i ].accumulatedWallTime_ = 0.0;
+        modelStatistics_[ i ].numberOfCalls_ = 0;
+    }
+}
+
+//! Function to retrieve the wall time accumulated over all models in a given category
+double ModelEvaluationProfiler::getAccumulatedWallTime( const std::string& category ) const
+{
+    double accumulatedWallTime = 0.0;
+    for( unsigned int i = 0; i < modelStatistics_.size( ); i++ )
+    {
+        if( modelStatistics_[ i ].category_ == category )
+        {
+            accumulatedWallTime += modelStatistics_[ i ].accumulatedWallTime_;
+        }
+    }
+    return accumulatedWallTime;
+}
+
+//! Function to retrieve the report of the accumulated statistics as a JSON string
+std::string ModelEvaluationProfiler::getJsonReport( ) const
+{
+    // Sort models per category
+    std::map< std::string, std::vector< int > > modelsPerCategory;
+    for( unsigned int i = 0; i < modelStatistics_.size( ); i++ )
+    {
+        modelsPerCategory[ modelStatistics_[ i ].category_ ].push_back( i );
+    }
+
+    std::ostringstream jsonStream;
+    jsonStream << std::setprecision( std::numeric_limits< double >::max_digits10 );
+    jsonStream << "{";
+    for( auto categoryIterator = modelsPerCategory.begin( ); categoryIterator != modelsPerCategory.end( );
+         categoryIterator++ )
+    {
+        jsonStream << ( ( categoryIterator == modelsPerCategory.begin( ) ) ? "\n" : ",\n" );
+        jsonStream << "  \"" << escapeJsonString( categoryIterator->first ) << "\": {";
+        for( unsigned int i = 0; i < categoryIterator->second.size( ); i++ )
+        {
+            const ProfiledModelStatistics& currentStatistics = modelStatistics_.at( categoryIterator->second.at( i ) );
+            jsonStream << ( ( i == 0 ) ? "\n" : ",\n" );
+            jsonStream << "    \"" << escapeJsonString( currentStatistics.modelName_ ) << "\": { \"wall_time\": " <<
+                          currentStatistics.accumulatedWallTime_ << ", \"number_of_calls\": " <<
+                          currentStatistics.numberOfCalls_ << " }";
+        }
+        jsonStream << "\n  }";
+    }
+    jsonStream << "\n}\n";
+    return jsonStream.str( );
+}
+
+//! Function to write the report of the accumulated statistics (see getJsonReport) to a JSON file
+void ModelEvaluationProfiler::writeJsonReport( const std::string& fileName ) const
+{
+    std::ofstream outputFile( fileName );
+    if( !outputFile.is_open( ) )
+    {
+        throw std::runtime_error( "Error when writing model evaluation profile, could not open file " + fileName );
+    }
+    outputFile << getJsonReport( );
+}
+
+} // namespace utilities
+
+} // namespace tudat
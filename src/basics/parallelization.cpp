@@ -0,0 +1,402 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <atomic>
+#include <algorithm>
+#include <condition_variable>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "tudat/basics/parallelization.h"
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+namespace
+{
+
+//! Maximum number of threads that parallel tasks started from the current thread may use (0 if not limited)
+thread_local int currentThreadLimit = 0;
+
+//! Boolean denoting whether a warning has been given that a requested number of threads is reduced to that of the scheduler
+std::atomic< bool > isThreadReductionWarningGiven( false );
+
+//! Set of tasks, as executed by a single call to executeParallelTasks
+struct TaskSet
+{
+    TaskSet( const int numberOfTasks, const std::function< void( const int ) >& taskFunction,
+             const int maximumNumberOfThreads ):
+        numberOfTasks_( numberOfTasks ), taskFunction_( taskFunction ), maximumNumberOfThreads_( maximumNumberOfThreads ),
+        numberOfParticipatingThreads_( 1 ), nextTaskIndex_( 0 ), isTaskFailed_( false ), caughtException_( nullptr ),
+        failedTaskIndex_( numberOfTasks ){ }
+
+    //! Function to pick up and execute tasks of this set, until none remain (or until one has failed)
+    void processTasks( )
+    {
+        // Nested tasks inherit the thread limit of this set
+        int previousThreadLimit = currentThreadLimit;
+        currentThreadLimit = maximumNumberOfThreads_;
+
+        int currentTaskIndex;
+        while( !isTaskFailed_ && ( currentTaskIndex = nextTaskIndex_++ ) < numberOfTasks_ )
+        {
+            try
+            {
+                taskFunction_( currentTaskIndex );
+            }
+            catch( ... )
+            {
+                std::lock_guard< std::mutex > lock( exceptionMutex_ );
+                if( currentTaskIndex < failedTaskIndex_ )
+                {
+                    failedTaskIndex_ = currentTaskIndex;
+                    caughtException_ = std::current_exception( );
+                }
+                isTaskFailed_ = true;
+            }
+        }
+
+        currentThreadLimit = previousThreadLimit;
+    }
+
+    //! Function to check whether an additional thread may (usefully) join the execution of this set
+    bool canBeJoined( ) const
+    {
+        return numberOfParticipatingThreads_ < maximumNumberOfThreads_ && !isTaskFailed_ &&
+                nextTaskIndex_ < numberOfTasks_;
+    }
+
+    //! Number of tasks in the set
+    const int numberOfTasks_;
+
+    //! Function executing a single task of the set
+    const std::function< void( const int ) >& taskFunction_;
+
+    //! Maximum number of threads that may execute tasks of the set (including the thread that started it)
+    const int maximumNumberOfThreads_;
+
+    //! Number of threads currently executing tasks of the set (modified only under lock of the scheduler)
+    int numberOfParticipatingThreads_;
+
+    //! Index of the next task that is to be picked up
+    std::atomic< int > nextTaskIndex_;
+
+    //! Boolean denoting whether any task in the set has thrown an exception
+    std::atomic< bool > isTaskFailed_;
+
+    //! Mutex for access to the caught exception
+    std::mutex exceptionMutex_;
+
+    //! Exception thrown by the task with the lowest index (nullptr if none)
+    std::exception_ptr caughtException_;
+
+    //! Index of the task that threw caughtException_
+    int failedTaskIndex_;
+};
+
+//! Task scheduler shared by all parallel tasks, with a persistent set of worker threads.
+/*!
+ *  Task scheduler shared by all parallel tasks, with a persistent set of worker threads. Each set of tasks is executed by the
+ *  thread that started it, helped by idle worker threads. Idle workers join the most recently started set of tasks that can
+ *  be joined, so that nested sets (started from inside a task) are finished first, and no additional threads are created
+ *  for nested parallelism.
+ */
+class TaskScheduler
+{
+public:
+
+    TaskScheduler( ):
+        numberOfThreads_( getDefaultNumberOfThreads( ) ), bindThreadsToCores_( false ), stopWorkers_( false ){ }
+
+    ~TaskScheduler( )
+    {
+        stopWorkers( );
+    }
+
+    void setNumberOfThreads( const int numberOfThreads )
+    {
+        std::lock_guard< std::mutex > settingsLock( settingsMutex_ );
+        checkNoActiveTaskSets( );
+        stopWorkers( );
+        numberOfThreads_ = std::max( numberOfThreads, 1 );
+    }
+
+    int getNumberOfThreads( )
+    {
+        return numberOfThreads_;
+    }
+
+    void setThreadAffinity( const bool bindThreadsToCores )
+    {
+        std::lock_guard< std::mutex > settingsLock( settingsMutex_ );
+        checkNoActiveTaskSets( );
+        stopWorkers( );
+        bindThreadsToCores_ = bindThreadsToCores;
+    }
+
+    void executeTasks( TaskSet& taskSet )
+    {
+        startWorkers( );
+
+        {
+            std::lock_guard< std::mutex > lock( schedulerMutex_ );
+            activeTaskSets_.push_back( &taskSet );
+        }
+        workAvailableCondition_.notify_all( );
+
+        taskSet.processTasks( );
+
+        // Remove task set (so that no further workers join), and wait for participating workers to finish
+        std::unique_lock< std::mutex > lock( schedulerMutex_ );
+        activeTaskSets_.erase( std::find( activeTaskSets_.begin( ), activeTaskSets_.end( ), &taskSet ) );
+        taskSet.numberOfParticipatingThreads_--;
+        taskSetFinishedCondition_.wait( lock, [ & ]( ){ return taskSet.numberOfParticipatingThreads_ == 0; } );
+    }
+
+private:
+
+    static int getDefaultNumberOfThreads( )
+    {
+        const char* numberOfThreadsVariable = std::getenv( "TUDAT_NUMBER_OF_THREADS" );
+        if( numberOfThreadsVariable != nullptr )
+        {
+            int numberOfThreads = std::atoi( numberOfThreadsVariable );
+            if( numberOfThreads > 0 )
+            {
+                return numberOfThreads;
+            }
+        }
+        return getNumberOfHardwareThreads( );
+    }
+
+    void startWorkers( )
+    {
+        std::lock_guard< std::mutex > settingsLock( settingsMutex_ );
+        if( static_cast< int >( workers_.size( ) ) == numberOfThreads_ - 1 )
+        {
+            return;
+        }
+
+        stopWorkers_ = false;
+        for( int i = 0; i < numberOfThreads_ - 1; i++ )
+        {
+            workers_.push_back( std::thread( &TaskScheduler::runWorker, this ) );
+#ifdef __linux__
+            if( bindThreadsToCores_ )
+            {
+                cpu_set_t cpuSet;
+                CPU_ZERO( &cpuSet );
+                CPU_SET( ( i + 1 ) % getNumberOfHardwareThreads( ), &cpuSet );
+                pthread_setaffinity_np( workers_.back( ).native_handle( ), sizeof( cpu_set_t ), &cpuSet );
+            }
+#endif
+        }
+    }
+
+    void checkNoActiveTaskSets( )
+    {
+        std::lock_guard< std::mutex > lock( schedulerMutex_ );
+        if( activeTaskSets_.size( ) > 0 )
+        {
+            throw std::runtime_error( "Error, cannot modify task scheduler while parallel tasks are being executed" );
+        }
+    }
+
+    void stopWorkers( )
+    {
+        {
+            std::lock_guard< std::mutex > lock( schedulerMutex_ );
+            stopWorkers_ = true;
+        }
+        workAvailableCondition_.notify_all( );
+
+        for( unsigned int i = 0; i < workers_.size( ); i++ )
+        {
+            workers_.at( i ).join( );
+        }
+        workers_.clear( );
+    }
+
+    TaskSet* getTaskSetToJoin( )
+    {
+        for( auto it = activeTaskSets_.rbegin( ); it != activeTaskSets_.rend( ); it++ )
+        {
+            if( ( *it )->canBeJoined( ) )
+            {
+                return *it;
+            }
+        }
+        return nullptr;
+    }
+
+    void runWorker( )
+    {
+        std::unique_lock< std::mutex > lock( schedulerMutex_ );
+        while( true )
+        {
+            TaskSet* taskSet = nullptr;
+            workAvailableCondition_.wait( lock, [ & ]( )
+            {
+                return stopWorkers_ || ( taskSet = getTaskSetToJoin( ) ) != nullptr;
+            } );
+            if( stopWorkers_ )
+            {
+                return;
+            }
+
+            taskSet->numberOfParticipatingThreads_++;
+            lock.unlock( );
+            taskSet->processTasks( );
+            lock.lock( );
+
+            taskSet->numberOfParticipatingThreads_--;
+            if( taskSet->numberOfParticipatingThreads_ == 0 )
+            {
+                taskSetFinishedCondition_.notify_all( );
+            }
+        }
+    }
+
+    //! Number of threads of the scheduler (including the thread starting a set of tasks), atomic since it is read without lock
+    std::atomic< int > numberOfThreads_;
+
+    //! Boolean denoting whether the worker threads are to be bound to a single core each
+    bool bindThreadsToCores_;
+
+    //! Worker threads
+    std::vector< std::thread > workers_;
+
+    //! Mutex for (re)starting and stopping the worker threads
+    std::mutex settingsMutex_;
+
+    //! Mutex for access to the list of active task sets, and their number of participating threads
+    std::mutex schedulerMutex_;
+
+    //! Condition variable signalling that a task set has been started (or that the workers are to stop)
+    std::condition_variable workAvailableCondition_;
+
+    //! Condition variable signalling that a worker has finished its part of a task set
+    std::condition_variable taskSetFinishedCondition_;
+
+    //! Task sets that are currently being executed, in order of starting time
+    std::vector< TaskSet* > activeTaskSets_;
+
+    //! Boolean denoting whether the worker threads are to stop
+    bool stopWorkers_;
+};
+
+//! Function to retrieve the task scheduler shared by all parallel tasks (created upon first use)
+TaskScheduler& getTaskScheduler( )
+{
+    static TaskScheduler taskScheduler;
+    return taskScheduler;
+}
+
+} // namespace
+
+//! Function to retrieve the number of concurrent threads supported by the hardware
+int getNumberOfHardwareThreads( )
+{
+    unsigned int numberOfThreads = std::thread::hardware_concurrency( );
+    return ( numberOfThreads == 0 ) ? 1 : static_cast< int >( numberOfThreads );
+}
+
+//! Function to retrieve the number of threads that parallel tasks may use in the current context
+int getNumberOfAvailableThreads( )
+{
+    int numberOfThreads = getTaskScheduler( ).getNumberOfThreads( );
+    return ( currentThreadLimit > 0 ) ? std::min( numberOfThreads, currentThreadLimit ) : numberOfThreads;
+}
+
+//! Function to set the number of threads of the shared task scheduler
+void setNumberOfSchedulerThreads( const int numberOfThreads )
+{
+    getTaskScheduler( ).setNumberOfThreads( numberOfThreads );
+}
+
+//! Function to retrieve the number of threads of the shared task scheduler
+int getNumberOfSchedulerThreads( )
+{
+    return getTaskScheduler( ).getNumberOfThreads( );
+}
+
+//! Function to set whether the worker threads of the shared task scheduler are to be bound to a single core
+void setSchedulerThreadAffinity( const bool bindThreadsToCores )
+{
+    getTaskScheduler( ).setThreadAffinity( bindThreadsToCores );
+}
+
+//! Function to execute a set of independent tasks on the shared task scheduler
+void executeParallelTasks(
+        const int numberOfTasks,
+        const std::function< void( const int ) >& taskFunction,
+        const int numberOfThreads )
+{
+    int numberOfSchedulerThreads = getTaskScheduler( ).getNumberOfThreads( );
+    if( numberOfThreads > numberOfSchedulerThreads && numberOfTasks > numberOfSchedulerThreads &&
+            !isThreadReductionWarningGiven.exchange( true ) )
+    {
+        std::cerr << "Warning, requested number of threads (" << numberOfThreads << ") exceeds number of threads of the "
+                  << "shared task scheduler (" << numberOfSchedulerThreads << "), using " << numberOfSchedulerThreads
+                  << " threads. The number of scheduler threads is set by setNumberOfSchedulerThreads, or by the "
+                  << "environment variable TUDAT_NUMBER_OF_THREADS. This warning is only given once." << std::endl;
+    }
+
+    int numberOfUsedThreads = std::min( std::min( numberOfThreads, numberOfTasks ), getNumberOfAvailableThreads( ) );
+
+    // Run in calling thread if no concurrency is requested (or available)
+    if( numberOfUsedThreads <= 1 )
+    {
+        for( int i = 0; i < numberOfTasks; i++ )
+        {
+            taskFunction( i );
+        }
+        return;
+    }
+
+    TaskSet taskSet( numberOfTasks, taskFunction, numberOfUsedThreads );
+    getTaskScheduler( ).executeTasks( taskSet );
+
+    if( taskSet.caughtException_ != nullptr )
+    {
+        std::rethrow_exception( taskSet.caughtException_ );
+    }
+}
+
+//! Constructor, sets the thread limit of the current thread
+ScopedThreadLimit::ScopedThreadLimit( const int maximumNumberOfThreads ):
+    previousThreadLimit_( currentThreadLimit )
+{
+    int newThreadLimit = std::max( maximumNumberOfThreads, 1 );
+    currentThreadLimit = ( previousThreadLimit_ > 0 ) ? std::min( previousThreadLimit_, newThreadLimit ) : newThreadLimit;
+}
+
+//! Destructor, restores the previous thread limit of the current thread
+ScopedThreadLimit::~ScopedThreadLimit( )
+{
+    currentThreadLimit = previousThreadLimit_;
+}
+
+} // namespace utilities
+
+} // namespace tudat
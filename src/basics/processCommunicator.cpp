@@ -0,0 +1,124 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cstdlib>
+#include <stdexcept>
+
+#if TUDAT_BUILD_WITH_MPI
+#include <mpi.h>
+#endif
+
+#include "tudat/basics/processCommunicator.h"
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+#if TUDAT_BUILD_WITH_MPI
+
+namespace
+{
+
+//! Function to finalize MPI at program exit (registered if MPI is initialized by Tudat)
+void finalizeMpi( )
+{
+    int isMpiFinalized;
+    MPI_Finalized( &isMpiFinalized );
+    if( !isMpiFinalized )
+    {
+        MPI_Finalize( );
+    }
+}
+
+//! Process communicator for the processes of an MPI communicator
+class MpiProcessCommunicator: public ProcessCommunicator
+{
+public:
+
+    MpiProcessCommunicator( const MPI_Comm communicator ): communicator_( communicator )
+    {
+        MPI_Comm_rank( communicator_, &processIndex_ );
+        MPI_Comm_size( communicator_, &numberOfProcesses_ );
+    }
+
+    int getProcessIndex( ){ return processIndex_; }
+
+    int getNumberOfProcesses( ){ return numberOfProcesses_; }
+
+    void sumOverProcesses( double* data, const int dataSize )
+    {
+        reduceOverProcesses( data, dataSize, MPI_SUM );
+    }
+
+    void minimumOverProcesses( double* data, const int dataSize )
+    {
+        reduceOverProcesses( data, dataSize, MPI_MIN );
+    }
+
+    void maximumOverProcesses( double* data, const int dataSize )
+    {
+        reduceOverProcesses( data, dataSize, MPI_MAX );
+    }
+
+    void broadcastFromRootProcess( double* data, const int dataSize )
+    {
+        if( dataSize > 0 && MPI_Bcast( data, dataSize, MPI_DOUBLE, 0, communicator_ ) != MPI_SUCCESS )
+        {
+            throw std::runtime_error( "Error when broadcasting data from root process, MPI_Bcast failed" );
+        }
+    }
+
+private:
+
+    void reduceOverProcesses( double* data, const int dataSize, const MPI_Op operation )
+    {
+        if( dataSize > 0 && MPI_Allreduce( MPI_IN_PLACE, data, dataSize, MPI_DOUBLE, operation, communicator_ ) != MPI_SUCCESS )
+        {
+            throw std::runtime_error( "Error when reducing data over processes, MPI_Allreduce failed" );
+        }
+    }
+
+    MPI_Comm communicator_;
+
+    int processIndex_;
+
+    int numberOfProcesses_;
+};
+
+} // namespace
+
+//! Function to create a process communicator for all processes of the current MPI job
+std::shared_ptr< ProcessCommunicator > createMpiProcessCommunicator( )
+{
+    int isMpiInitialized;
+    MPI_Initialized( &isMpiInitialized );
+    if( !isMpiInitialized )
+    {
+        MPI_Init( nullptr, nullptr );
+        std::atexit( &finalizeMpi );
+    }
+    return std::make_shared< MpiProcessCommunicator >( MPI_COMM_WORLD );
+}
+
+#else
+
+//! Function to create a process communicator for all processes of the current MPI job
+std::shared_ptr< ProcessCommunicator > createMpiProcessCommunicator( )
+{
+    throw std::runtime_error( "Error when creating MPI process communicator, Tudat was compiled without MPI support (TUDAT_BUILD_WITH_MPI)" );
+}
+
+#endif
+
+} // namespace utilities
+
+} // namespace tudat
@@ -0,0 +1,119 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+
+#include "tudat/basics/scratchArena.h"
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+namespace
+{
+
+//! Scratch arena that is active in the current thread
+thread_local ScratchArena* currentScratchArena = nullptr;
+
+//! Function to round a number of doubles up, so that consecutive blocks remain 32-byte aligned (w.r.t. block start)
+std::size_t getPaddedSize( const std::size_t numberOfEntries )
+{
+    return ( numberOfEntries + 3 ) & ~static_cast< std::size_t >( 3 );
+}
+
+//! Minimum size (in number of doubles) of a block allocated by the arena
+const std::size_t minimumBlockSize = 256;
+
+}
+
+//! Constructor
+ScratchArena::ScratchArena( const std::size_t initialCapacity ):
+    currentBlockOffset_( 0 ), currentUsage_( 0 ), highWaterMark_( 0 ), numberOfBlockAllocations_( 0 )
+{
+    if( initialCapacity > 0 )
+    {
+        addBlock( getPaddedSize( initialCapacity ) );
+    }
+}
+
+//! Function to retrieve a block of uninitialized scratch memory
+double* ScratchArena::allocate( const std::size_t numberOfEntries )
+{
+    std::size_t paddedSize = getPaddedSize( numberOfEntries );
+    if( blocks_.empty( ) || currentBlockOffset_ + paddedSize > blockSizes_.back( ) )
+    {
+        addBlock( std::max( { paddedSize, minimumBlockSize, 2 * getCapacity( ) } ) );
+    }
+
+    double* blockStart = blocks_.back( ).get( ) + currentBlockOffset_;
+    currentBlockOffset_ += paddedSize;
+    currentUsage_ += paddedSize;
+    highWaterMark_ = std::max( highWaterMark_, currentUsage_ );
+    return blockStart;
+}
+
+//! Function to release all scratch memory handed out since the last reset.
+void ScratchArena::reset( )
+{
+    if( blocks_.size( ) > 1 )
+    {
+        blocks_.clear( );
+        blockSizes_.clear( );
+        addBlock( highWaterMark_ );
+    }
+    currentBlockOffset_ = 0;
+    currentUsage_ = 0;
+}
+
+//! Function to retrieve the number of doubles for which memory is currently held by the arena
+std::size_t ScratchArena::getCapacity( ) const
+{
+    std::size_t capacity = 0;
+    for( unsigned int i = 0; i < blockSizes_.size( ); i++ )
+    {
+        capacity += blockSizes_.at( i );
+    }
+    return capacity;
+}
+
+//! Function to add a new block of memory to the arena
+void ScratchArena::addBlock( const std::size_t blockSize )
+{
+    blocks_.push_back( std::unique_ptr< double[ ] >( new double[ blockSize ] ) );
+    blockSizes_.push_back( blockSize );
+    currentBlockOffset_ = 0;
+    numberOfBlockAllocations_++;
+}
+
+//! Function to retrieve the scratch arena that is active in the current thread
+ScratchArena* getCurrentScratchArena( )
+{
+    return currentScratchArena;
+}
+
+//! Constructor
+ScopedScratchArena::ScopedScratchArena( ScratchArena& arena ):
+    previousArena_( currentScratchArena )
+{
+    arena.reset( );
+    currentScratchArena = &arena;
+}
+
+//! Destructor, restores the previously active arena
+ScopedScratchArena::~ScopedScratchArena( )
+{
+    currentScratchArena = previousArena_;
+}
+
+} // namespace utilities
+
+} // namespace tudat
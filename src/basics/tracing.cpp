@@ -0,0 +1,229 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+
+#include "tudat/basics/modelEvaluationProfiler.h"
+#include "tudat/basics/tracing.h"
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+namespace tracing_detail
+{
+
+//! Flag denoting whether tracing is enabled
+std::atomic< bool > isTracingEnabled( false );
+
+namespace
+{
+
+//! Buffer of trace events recorded by a single thread
+struct ThreadTraceBuffer
+{
+    //! Constructor
+    ThreadTraceBuffer( const int threadIndex ): threadIndex_( threadIndex )
+    {
+        traceEvents_.reserve( 1024 );
+    }
+
+    //! Index of the thread (in order in which threads first recorded an event)
+    int threadIndex_;
+
+    //! Events recorded by the thread
+    std::vector< TraceEvent > traceEvents_;
+};
+
+//! Registry of the trace buffers of all threads, and reference epoch of the trace
+struct TraceRegistry
+{
+    //! Constructor, sets the reference epoch of the trace
+    TraceRegistry( ): referenceEpoch_( std::chrono::steady_clock::now( ) ){ }
+
+    //! Mutex for access to the list of buffers (not for access to the buffers themselves)
+    std::mutex registryMutex_;
+
+    //! Trace buffers of all threads that recorded an event
+    std::vector< std::shared_ptr< ThreadTraceBuffer > > threadBuffers_;
+
+    //! Reference epoch of the trace
+    std::chrono::steady_clock::time_point referenceEpoch_;
+};
+
+//! Function to retrieve the process-wide trace registry
+TraceRegistry& getTraceRegistry( )
+{
+    static TraceRegistry traceRegistry;
+    return traceRegistry;
+}
+
+//! Function to retrieve the trace buffer of the current thread (created and registered upon first call on the thread)
+ThreadTraceBuffer& getCurrentThreadTraceBuffer( )
+{
+    thread_local std::shared_ptr< ThreadTraceBuffer > currentThreadBuffer = nullptr;
+    if( currentThreadBuffer == nullptr )
+    {
+        TraceRegistry& traceRegistry = getTraceRegistry( );
+        std::lock_guard< std::mutex > registryLock( traceRegistry.registryMutex_ );
+        currentThreadBuffer = std::make_shared< ThreadTraceBuffer >(
+                    static_cast< int >( traceRegistry.threadBuffers_.size( ) ) );
+        traceRegistry.threadBuffers_.push_back( currentThreadBuffer );
+    }
+    return *currentThreadBuffer;
+}
+
+//! Object that enables tracing upon loading if the trace environment variable is set, and writes the trace upon exit
+class EnvironmentTraceSession
+{
+public:
+
+    //! Constructor, enables tracing if the trace environment variable is set
+    EnvironmentTraceSession( )
+    {
+        // Create registry first, so that it is destroyed after this object
+        getTraceRegistry( );
+
+        const char* traceFile = std::getenv( TRACE_FILE_ENVIRONMENT_VARIABLE );
+        if( traceFile != nullptr && std::string( traceFile ) != "" )
+        {
+            traceFile_ = traceFile;
+            setTracingEnabled( true );
+        }
+    }
+
+    //! Destructor, writes the trace to the file defined by the trace environment variable (if set)
+    ~EnvironmentTraceSession( )
+    {
+        if( traceFile_ != "" )
+        {
+            try
+            {
+                writeChromeTrace( traceFile_ );
+            }
+            catch( const std::exception& caughtException )
+            {
+                std::cerr << "Warning, could not write trace: " << caughtException.what( ) << std::endl;
+            }
+        }
+    }
+
+private:
+
+    //! File to which trace is written upon exit (empty if environment variable is not set)
+    std::string traceFile_;
+};
+
+//! Process-wide trace session defined by the trace environment variable
+EnvironmentTraceSession environmentTraceSession;
+
+}
+
+//! Function to retrieve the time since the trace reference epoch, in microseconds
+double getTraceTime( )
+{
+    return std::chrono::duration< double, std::micro >(
+                std::chrono::steady_clock::now( ) - getTraceRegistry( ).referenceEpoch_ ).count( );
+}
+
+//! Function to add an event to the trace buffer of the current thread
+void addTraceEvent( const TraceEvent& traceEvent )
+{
+    getCurrentThreadTraceBuffer( ).traceEvents_.push_back( traceEvent );
+}
+
+} // namespace tracing_detail
+
+//! Function to enable or disable tracing
+void setTracingEnabled( const bool enableTracing )
+{
+    tracing_detail::isTracingEnabled.store( enableTracing, std::memory_order_relaxed );
+}
+
+//! Function to remove all recorded trace events (of all threads)
+void clearTraceEvents( )
+{
+    tracing_detail::TraceRegistry& traceRegistry = tracing_detail::getTraceRegistry( );
+    std::lock_guard< std::mutex > registryLock( traceRegistry.registryMutex_ );
+    for( unsigned int i = 0; i < traceRegistry.threadBuffers_.size( ); i++ )
+    {
+        traceRegistry.threadBuffers_.at( i )->traceEvents_.clear( );
+    }
+}
+
+//! Function to retrieve all recorded trace events (of all threads), with the associated thread indices
+std::vector< std::pair< int, TraceEvent > > getTraceEvents( )
+{
+    std::vector< std::pair< int, TraceEvent > > traceEvents;
+
+    tracing_detail::TraceRegistry& traceRegistry = tracing_detail::getTraceRegistry( );
+    std::lock_guard< std::mutex > registryLock( traceRegistry.registryMutex_ );
+    for( unsigned int i = 0; i < traceRegistry.threadBuffers_.size( ); i++ )
+    {
+        const tracing_detail::ThreadTraceBuffer& currentBuffer = *traceRegistry.threadBuffers_.at( i );
+        for( unsigned int j = 0; j < currentBuffer.traceEvents_.size( ); j++ )
+        {
+            traceEvents.push_back( std::make_pair( currentBuffer.threadIndex_, currentBuffer.traceEvents_.at( j ) ) );
+        }
+    }
+    return traceEvents;
+}
+
+//! Function to retrieve the recorded trace events as a JSON string in the Chrome trace event format
+std::string getChromeTraceJson( )
+{
+    std::vector< std::pair< int, TraceEvent > > traceEvents = getTraceEvents( );
+
+    std::ostringstream jsonStream;
+    jsonStream << std::fixed << std::setprecision( 3 );
+    jsonStream << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+    for( unsigned int i = 0; i < traceEvents.size( ); i++ )
+    {
+        const TraceEvent& currentEvent = traceEvents.at( i ).second;
+        jsonStream << ( ( i == 0 ) ? "\n" : ",\n" );
+        jsonStream << "  {\"name\": \"" << escapeJsonString( currentEvent.name_ ) <<
+                      "\", \"cat\": \"" << escapeJsonString( currentEvent.category_ ) <<
+                      "\", \"ph\": \"X\", \"ts\": " << currentEvent.startTime_ <<
+                      ", \"dur\": " << currentEvent.duration_ <<
+                      ", \"pid\": 1, \"tid\": " << traceEvents.at( i ).first;
+        if( currentEvent.index_ >= 0 )
+        {
+            jsonStream << ", \"args\": {\"index\": " << currentEvent.index_ << "}";
+        }
+        jsonStream << "}";
+    }
+    jsonStream << "\n]}\n";
+    return jsonStream.str( );
+}
+
+//! Function to write the recorded trace events to a file in the Chrome trace event format (see getChromeTraceJson)
+void writeChromeTrace( const std::string& fileName )
+{
+    std::ofstream outputFile( fileName );
+    if( !outputFile.is_open( ) )
+    {
+        throw std::runtime_error( "Error when writing trace, could not open file " + fileName );
+    }
+    outputFile << getChromeTraceJson( );
+}
+
+} // namespace utilities
+
+} // namespace tudat
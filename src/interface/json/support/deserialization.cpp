@@ -9,6 +9,11 @@
  *
  */
 
+#include <ctime>
+#include <map>
+#include <memory>
+#include <mutex>
+
 #include <boost/regex.hpp>
 
 #include "tudat/interface/json/support/deserialization.h"
@@ -186,6 +191,47 @@ nlohmann::json readJSON( const boost::filesystem::path& filePath, const boost::f
     return jsonObject;
 }
 
+//! Update the keys of a `json` object with the values of the keys of another `json` object.
+void applyJSONPatch( nlohmann::json& jsonObject, const nlohmann::json& patch, const boost::filesystem::path& filePath )
+{
+    for ( nlohmann::json::const_iterator subit = patch.begin( ); subit != patch.end( ); ++subit )
+    {
+        const KeyPath keyPath( subit.key( ) );
+        try
+        {
+            nlohmann::json newValue = subit.value( );
+            for ( unsigned int j = 0; j < keyPath.size( ); ++j )
+            {
+                nlohmann::json updatedsonObject = jsonObject;
+                for ( unsigned int i = 0; i < keyPath.size( ) - j; ++i )
+                {
+                    const std::string key = keyPath.at( i );
+                    if ( i < keyPath.size( ) - 1 - j )
+                    {
+                        updatedsonObject = valueAt( updatedsonObject, key );
+                    }
+                    else
+                    {
+                        valueAt( updatedsonObject, key, true ) = newValue;
+                    }
+                }
+                newValue = updatedsonObject;
+            }
+            jsonObject = newValue;
+        }
+        catch ( ... )
+        {
+            std::cerr << "Could not update value for " << keyPath;
+            if ( ! filePath.empty( ) )
+            {
+                std::cerr << " referenced from file " << filePath;
+            }
+            std::cerr << std::endl;
+            throw;
+        }
+    }
+}
+
 //! Merge an array of JSON input objects.
 /*!
  * @copybrief mergeJSON
@@ -214,38 +260,7 @@ void mergeJSON( nlohmann::json& jsonObject, const boost::filesystem::path& fileP
             }
             else
             {
-                for ( nlohmann::json::iterator subit = subjson.begin( ); subit != subjson.end( ); ++subit )
-                {
-                    const KeyPath keyPath( subit.key( ) );
-                    try
-                    {
-                        nlohmann::json newValue = subit.value( );
-                        for ( unsigned int j = 0; j < keyPath.size( ); ++j )
-                        {
-                            nlohmann::json updatedsonObject = jsonObject;
-                            for ( unsigned int i = 0; i < keyPath.size( ) - j; ++i )
-                            {
-                                const std::string key = keyPath.at( i );
-                                if ( i < keyPath.size( ) - 1 - j )
-                                {
-                                    updatedsonObject = valueAt( updatedsonObject, key );
-                                }
-                                else
-                                {
-                                    valueAt( updatedsonObject, key, true ) = newValue;
-                                }
-                            }
-                            newValue = updatedsonObject;
-                        }
-                        jsonObject = newValue;
-                    }
-                    catch ( ... )
-                    {
-                        std::cerr << "Could not update value for " << keyPath << " referenced from file "
-                                  << filePath << std::endl;
-                        throw;
-                    }
-                }
+                applyJSONPatch( jsonObject, subjson, filePath );
             }
         }
     }
@@ -470,6 +485,65 @@ nlohmann::json getDeserializedJSON( const boost::filesystem::path& filePath )
     return jsonObject;
 }
 
+//! Deserialized `json` object of a single root file, with the modification time of the file when it was read
+struct CachedDeserializedJSON
+{
+    //! Modification time of the root file when it was read
+    std::time_t modificationTime;
+
+    //! Deserialized `json` object
+    std::shared_ptr< const nlohmann::json > jsonObject;
+};
+
+//! Cache of deserialized `json` objects, with root file path as key, and mutex for its access
+struct DeserializedJSONCache
+{
+    std::mutex cacheMutex;
+
+    std::map< std::string, CachedDeserializedJSON > cachedObjects;
+};
+
+//! Function to retrieve the (process-wide) cache of deserialized `json` objects, created on first use
+static DeserializedJSONCache& getDeserializedJSONCache( )
+{
+    static DeserializedJSONCache deserializedJSONCache;
+    return deserializedJSONCache;
+}
+
+//! Read and parse a `json` object from a file (see getDeserializedJSON), reusing the result of previous calls.
+std::shared_ptr< const nlohmann::json > getCachedDeserializedJSON( const boost::filesystem::path& inputFilePath )
+{
+    const boost::filesystem::path filePath = boost::filesystem::canonical( inputFilePath );
+    const std::time_t modificationTime = boost::filesystem::last_write_time( filePath );
+
+    DeserializedJSONCache& cache = getDeserializedJSONCache( );
+    {
+        std::lock_guard< std::mutex > lock( cache.cacheMutex );
+        auto cacheIterator = cache.cachedObjects.find( filePath.string( ) );
+        if ( cacheIterator != cache.cachedObjects.end( ) &&
+             cacheIterator->second.modificationTime == modificationTime )
+        {
+            return cacheIterator->second.jsonObject;
+        }
+    }
+
+    // Deserialize file outside of lock, so that different files can be read concurrently
+    std::shared_ptr< const nlohmann::json > jsonObject =
+            std::make_shared< const nlohmann::json >( getDeserializedJSON( filePath ) );
+
+    std::lock_guard< std::mutex > lock( cache.cacheMutex );
+    cache.cachedObjects[ filePath.string( ) ] = CachedDeserializedJSON{ modificationTime, jsonObject };
+    return jsonObject;
+}
+
+//! Clear the cache of deserialized `json` objects used by getCachedDeserializedJSON.
+void clearDeserializedJSONCache( )
+{
+    DeserializedJSONCache& cache = getDeserializedJSONCache( );
+    std::lock_guard< std::mutex > lock( cache.cacheMutex );
+    cache.cachedObjects.clear( );
+}
+
 }  // namespace json_interface
 
 }  // namespace tudat
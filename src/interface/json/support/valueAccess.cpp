@@ -126,7 +126,7 @@ ExceptionResponseType getResponseToEvent( const nlohmann::json& jsonObject, cons
 
 //! Global variable containing all the key paths that were accessed since clearAccessHistory() was called for the
 //! last time (or since this variable was initialized).
-std::set< KeyPath > accessedKeyPaths = { };
+thread_local std::set< KeyPath > accessedKeyPaths = { };
 
 //! Get all the key paths defined for \p jsonObject.
 /*!
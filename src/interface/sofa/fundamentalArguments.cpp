@@ -86,43 +86,123 @@ Eigen::Vector6d  calculateApproximateDelaunayFundamentalArgumentsWithGmst(
     return calculateDelaunayFundamentalArgumentsWithGmst( tdbTime, tdbTime, convertTTtoUTC( tdbTime ) );
 }
 
+//! Function to convert Delaunay fundamental arguments and (GMST + pi) to Doodson arguments.
+Eigen::Vector6d convertDelaunayWithGmstToDoodsonFundamentalArguments( const Eigen::Vector6d& delaunayArgumentsWithGmst )
+{
+    Eigen::Vector6d doodsonArguments;
+    doodsonArguments( 1 ) = delaunayArgumentsWithGmst( 3 ) + delaunayArgumentsWithGmst( 5 );
+    doodsonArguments( 0 ) = delaunayArgumentsWithGmst( 0 ) - doodsonArguments( 1 );
+    doodsonArguments( 2 ) = doodsonArguments( 1 ) - delaunayArgumentsWithGmst( 4 );
+    doodsonArguments( 3 ) = doodsonArguments( 1 ) - delaunayArgumentsWithGmst( 1 );
+    doodsonArguments( 5 ) = doodsonArguments( 2 ) - delaunayArgumentsWithGmst( 2 );
+    doodsonArguments( 4 ) = -delaunayArgumentsWithGmst( 5 );
+
+    return doodsonArguments;
+}
+
 //! Function to calculate the Doodson arguments at the requested time.
 Eigen::Vector6d calculateDoodsonFundamentalArguments(
         const double tdbTime, const double terrestrialTime, const double universalTime1 )
 {
-    using mathematical_constants::PI;
-
-    // Calculate current centuries since J2000.
-    double julianCenturiesSinceJ2000 = basic_astrodynamics::convertSecondsSinceEpochToJulianCenturiesSinceEpoch( tdbTime );
-
-    // Calculate GMST
-    double greenwichMeanSiderealTime = iauGmst06(
-                basic_astrodynamics::JULIAN_DAY_ON_J2000, universalTime1 / physical_constants::JULIAN_DAY,
-                basic_astrodynamics::JULIAN_DAY_ON_J2000, terrestrialTime / physical_constants::JULIAN_DAY );
+    return convertDelaunayWithGmstToDoodsonFundamentalArguments(
+                getSharedDelaunayFundamentalArgumentsWithGmst( tdbTime, terrestrialTime, universalTime1 ) );
+}
 
-    // Calculate relevant angles.
-    double meanElongationOfMoonFromSun = calculateMeanElongationOfMoonFromSun( julianCenturiesSinceJ2000 );
-    double meanArgumentOfLatitudeOfMoon = calculateMeanArgumentOfLatitudeOfMoon( julianCenturiesSinceJ2000 );
-    double meanAnomalyOfMoon = calculateMeanAnomalyOfMoon( julianCenturiesSinceJ2000 );
-    double meanAnomalyOfSun = calculateMeanAnomalyOfSun( julianCenturiesSinceJ2000 );
-    double longitudeOfMoonsAscendingNode = calculateLongitudeOfMoonsAscendingNode( julianCenturiesSinceJ2000 );
+//! Function to calculate the Doodson arguments at the requested time.
+Eigen::Vector6d calculateDoodsonFundamentalArguments( const double tdbTime )
+{
+    return convertDelaunayWithGmstToDoodsonFundamentalArguments(
+                getSharedApproximateDelaunayFundamentalArgumentsWithGmst( tdbTime ) );
+}
 
-    // Calculate Doodson arguments.
-    Eigen::Vector6d doodsonArguments;
-    doodsonArguments( 1 ) = meanArgumentOfLatitudeOfMoon + longitudeOfMoonsAscendingNode;
-    doodsonArguments( 0 ) = greenwichMeanSiderealTime + PI - doodsonArguments( 1 );
-    doodsonArguments( 2 ) = doodsonArguments( 1 ) - meanElongationOfMoonFromSun;
-    doodsonArguments( 3 ) = doodsonArguments( 1 ) - meanAnomalyOfMoon;
-    doodsonArguments( 5 ) = doodsonArguments( 2 ) - meanAnomalyOfSun;
-    doodsonArguments( 4 ) = -longitudeOfMoonsAscendingNode;
+//! Per-thread store of the most recently computed sets of Delaunay fundamental arguments and (GMST + pi).
+/*!
+ *  Per-thread store of the most recently computed sets of Delaunay fundamental arguments and (GMST + pi). A number of
+ *  sets is kept (instead of only the last one), so that consumers that alternate between a few epochs (e.g. the
+ *  transmission and reception times of an observation) still reuse the arguments. Approximate argument sets (for which TT
+ *  and UT1 are derived from TDB) are keyed by TDB only, and are distinguished from exact ones by isApproximate.
+ */
+class SharedFundamentalArgumentsCache
+{
+public:
+
+    //! Constructor, initializes all entries as invalid
+    SharedFundamentalArgumentsCache( ): nextEntryIndex_( 0 )
+    {
+        for( int i = 0; i < numberOfEntries; i++ )
+        {
+            entries_[ i ].tdbTime = TUDAT_NAN;
+        }
+    }
+
+    //! Function to retrieve the argument set for the given times, computing and storing it if not yet available
+    Eigen::Vector6d getArguments( const bool isApproximate, const double tdbTime,
+                                  const double terrestrialTime, const double universalTime1 )
+    {
+        for( int i = 0; i < numberOfEntries; i++ )
+        {
+            const CacheEntry& currentEntry = entries_[ i ];
+            if( currentEntry.tdbTime == tdbTime && currentEntry.isApproximate == isApproximate &&
+                    ( isApproximate || ( currentEntry.terrestrialTime == terrestrialTime &&
+                                         currentEntry.universalTime1 == universalTime1 ) ) )
+            {
+                return currentEntry.fundamentalArguments;
+            }
+        }
+
+        CacheEntry& newEntry = entries_[ nextEntryIndex_ ];
+        nextEntryIndex_ = ( nextEntryIndex_ + 1 ) % numberOfEntries;
+
+        newEntry.isApproximate = isApproximate;
+        newEntry.tdbTime = tdbTime;
+        newEntry.terrestrialTime = terrestrialTime;
+        newEntry.universalTime1 = universalTime1;
+        newEntry.fundamentalArguments = isApproximate ?
+                    calculateApproximateDelaunayFundamentalArgumentsWithGmst( tdbTime ) :
+                    calculateDelaunayFundamentalArgumentsWithGmst( tdbTime, terrestrialTime, universalTime1 );
+        return newEntry.fundamentalArguments;
+    }
+
+private:
+
+    //! Number of argument sets that is stored
+    static const int numberOfEntries = 4;
+
+    //! Argument set, with the times for which it was computed
+    struct CacheEntry
+    {
+        bool isApproximate;
+        double tdbTime;
+        double terrestrialTime;
+        double universalTime1;
+        Eigen::Vector6d fundamentalArguments;
+    };
+
+    //! Stored argument sets
+    CacheEntry entries_[ numberOfEntries ];
+
+    //! Index of the entry that is overwritten by the next newly computed argument set
+    int nextEntryIndex_;
+};
+
+//! Function to retrieve the per-thread store of fundamental argument sets
+SharedFundamentalArgumentsCache& getSharedFundamentalArgumentsCache( )
+{
+    thread_local SharedFundamentalArgumentsCache sharedFundamentalArgumentsCache;
+    return sharedFundamentalArgumentsCache;
+}
 
-    return doodsonArguments;
+//! Function to retrieve the Delaunay fundamental arguments and (GMST + pi), shared by all models evaluated at the same epoch.
+Eigen::Vector6d getSharedDelaunayFundamentalArgumentsWithGmst(
+        const double tdbTime, const double terrestrialTime, const double universalTime1 )
+{
+    return getSharedFundamentalArgumentsCache( ).getArguments( false, tdbTime, terrestrialTime, universalTime1 );
 }
 
-//! Function to calculate the Doodson arguments at the requested time.
-Eigen::Vector6d calculateDoodsonFundamentalArguments( const double tdbTime )
+//! Function to retrieve the approximate Delaunay fundamental arguments and (GMST + pi), shared by all models evaluated at the same epoch.
+Eigen::Vector6d getSharedApproximateDelaunayFundamentalArgumentsWithGmst( const double tdbTime )
 {
-    return calculateDoodsonFundamentalArguments( tdbTime, tdbTime,  convertTTtoUTC( tdbTime ) );
+    return getSharedFundamentalArgumentsCache( ).getArguments( true, tdbTime, TUDAT_NAN, TUDAT_NAN );
 }
 
 } // namespace sofa_interfaces
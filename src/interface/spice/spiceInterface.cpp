@@ -14,12 +14,192 @@
 #include "tudat/io/basicInputOutput.h"
 #include "tudat/paths.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <map>
 #include <math.h>
+#include <mutex>
+#include <set>
+#include <tuple>
+
+#include <boost/filesystem.hpp>
 
 namespace tudat {
 namespace spice_interface {
 using Eigen::Vector6d;
 
+namespace
+{
+
+//! Mutex by which all calls to CSPICE are serialized
+std::recursive_mutex spiceAccessMutex;
+
+//! Counters for statistics on the access to CSPICE (see SpiceAccessStatistics)
+std::atomic< unsigned long long > numberOfSpiceCalls( 0 );
+std::atomic< unsigned long long > numberOfContendedSpiceCalls( 0 );
+std::atomic< unsigned long long > numberOfSpiceCacheHits( 0 );
+std::atomic< long long > totalSpiceWaitingTimeInNanoSeconds( 0 );
+
+//! Counter that is incremented whenever the kernel pool is modified, to invalidate the per-thread result caches
+std::atomic< unsigned int > spiceKernelPoolVersion( 0 );
+
+//! Class locking the CSPICE access mutex for the duration of its lifetime, and updating the access statistics
+class SpiceAccessLock
+{
+public:
+    SpiceAccessLock( )
+    {
+        numberOfSpiceCalls++;
+        if( !spiceAccessMutex.try_lock( ) )
+        {
+            numberOfContendedSpiceCalls++;
+            std::chrono::steady_clock::time_point waitStartTime = std::chrono::steady_clock::now( );
+            spiceAccessMutex.lock( );
+            totalSpiceWaitingTimeInNanoSeconds += std::chrono::duration_cast< std::chrono::nanoseconds >(
+                        std::chrono::steady_clock::now( ) - waitStartTime ).count( );
+        }
+    }
+
+    ~SpiceAccessLock( )
+    {
+        spiceAccessMutex.unlock( );
+    }
+
+    SpiceAccessLock( const SpiceAccessLock& ) = delete;
+
+    SpiceAccessLock& operator=( const SpiceAccessLock& ) = delete;
+};
+
+//! Class storing the result of the last CSPICE call of a given type (in the present thread), with its input
+/*!
+ *  Class storing the result of the last CSPICE call of a given type, with the (up to three) string inputs and the time for
+ *  which it was computed. Objects of this class are declared thread_local, so that no synchronization is required. The
+ *  stored result is invalidated by any modification of the kernel pool.
+ */
+template< typename ResultType >
+class SpiceResultCache
+{
+public:
+    SpiceResultCache( ): time_( TUDAT_NAN ), kernelPoolVersion_( 0 ){ }
+
+    //! Function to retrieve the stored result, if it was computed for the given input (returns false otherwise).
+    bool retrieveResult( const std::string& firstInput, const std::string& secondInput, const std::string& thirdInput,
+                         const std::string& fourthInput, const double time, ResultType& result )
+    {
+        if( time == time_ && kernelPoolVersion_ == spiceKernelPoolVersion && firstInput == firstInput_ &&
+                secondInput == secondInput_ && thirdInput == thirdInput_ && fourthInput == fourthInput_ )
+        {
+            numberOfSpiceCacheHits++;
+            result = result_;
+            return true;
+        }
+        return false;
+    }
+
+    //! Function to store a newly computed result, with its input
+    void setResult( const std::string& firstInput, const std::string& secondInput, const std::string& thirdInput,
+                    const std::string& fourthInput, const double time, const unsigned int kernelPoolVersion,
+                    const ResultType& result )
+    {
+        firstInput_ = firstInput;
+        secondInput_ = secondInput;
+        thirdInput_ = thirdInput;
+        fourthInput_ = fourthInput;
+        time_ = time;
+        kernelPoolVersion_ = kernelPoolVersion;
+        result_ = result;
+    }
+
+private:
+    std::string firstInput_;
+    std::string secondInput_;
+    std::string thirdInput_;
+    std::string fourthInput_;
+    double time_;
+    unsigned int kernelPoolVersion_;
+    ResultType result_;
+};
+
+//! Per-thread cache of the last state computed by spkezr_c
+thread_local SpiceResultCache< Vector6d > stateResultCache;
+
+//! Per-thread cache of the last position computed by spkpos_c
+thread_local SpiceResultCache< Eigen::Vector3d > positionResultCache;
+
+//! Per-thread cache of the last rotation matrix computed by pxform_c
+thread_local SpiceResultCache< Eigen::Matrix3d > rotationResultCache;
+
+//! Per-thread cache of the last state transformation matrix computed by sxform_c
+thread_local SpiceResultCache< Eigen::Matrix6d > stateRotationResultCache;
+
+//! Function to compute the state transformation matrix between two frames using sxform_c (using the per-thread cache)
+Eigen::Matrix6d computeSpiceStateTransformationMatrix( const std::string &originalFrame,
+                                                       const std::string &newFrame,
+                                                       const double ephemerisTime )
+{
+    static const std::string emptyString = "";
+
+    Eigen::Matrix6d stateTransitionMatrix;
+    if( !stateRotationResultCache.retrieveResult(
+                originalFrame, newFrame, emptyString, emptyString, ephemerisTime, stateTransitionMatrix ) )
+    {
+        double stateTransition[6][6];
+        unsigned int kernelPoolVersion;
+        {
+            SpiceAccessLock spiceLock;
+            kernelPoolVersion = spiceKernelPoolVersion;
+            sxform_c(originalFrame.c_str(), newFrame.c_str(), ephemerisTime, stateTransition);
+        }
+
+        for (unsigned int i = 0; i < 6; i++) {
+            for (unsigned int j = 0; j < 6; j++) {
+                stateTransitionMatrix(i, j) = stateTransition[i][j];
+            }
+        }
+        stateRotationResultCache.setResult(
+                    originalFrame, newFrame, emptyString, emptyString, ephemerisTime, kernelPoolVersion,
+                    stateTransitionMatrix );
+    }
+    return stateTransitionMatrix;
+}
+
+}
+
+//! Function to retrieve the mutex by which all access to CSPICE is serialized
+std::recursive_mutex& getSpiceAccessMutex( )
+{
+    return spiceAccessMutex;
+}
+
+//! Function to retrieve the statistics on the access to CSPICE since the last reset
+SpiceAccessStatistics getSpiceAccessStatistics( )
+{
+    return SpiceAccessStatistics(
+                numberOfSpiceCalls, numberOfContendedSpiceCalls, numberOfSpiceCacheHits,
+                static_cast< double >( totalSpiceWaitingTimeInNanoSeconds ) * 1.0E-9 );
+}
+
+//! Function to reset the statistics on the access to CSPICE
+void resetSpiceAccessStatistics( )
+{
+    numberOfSpiceCalls = 0;
+    numberOfContendedSpiceCalls = 0;
+    numberOfSpiceCacheHits = 0;
+    totalSpiceWaitingTimeInNanoSeconds = 0;
+}
+
+//! Function to print the statistics on the access to CSPICE since the last reset
+void printSpiceAccessStatistics( )
+{
+    SpiceAccessStatistics statistics = getSpiceAccessStatistics( );
+    std::cout << "Spice access statistics: " << statistics.numberOfCalls_ << " calls, "
+              << statistics.numberOfContendedCalls_ << " contended calls ("
+              << statistics.totalWaitingTime_ << " s waiting time), "
+              << statistics.numberOfCacheHits_ << " results reused from cache" << std::endl;
+}
+
 std::string getCorrectedTargetBodyName(
         const std::string &targetBodyName )
 {
@@ -55,6 +235,7 @@ double convertEphemerisTimeToJulianDate(const double ephemerisTime) {
 //! Converts a date string to ephemeris time.
 double convertDateStringToEphemerisTime(const std::string &dateString) {
     double ephemerisTime = 0.0;
+    SpiceAccessLock spiceLock;
     str2et_c(dateString.c_str(), &ephemerisTime);
     return ephemerisTime;
 }
@@ -70,25 +251,40 @@ Vector6d getBodyCartesianStateAtEpoch(
     {
         throw std::invalid_argument( "Error when retrieving Cartesian state from Spice, input time is " + std::to_string(ephemerisTime) );
     }
+    // Check if state was already computed by this thread.
+    Vector6d cartesianStateVector;
+    if( stateResultCache.retrieveResult( targetBodyName, observerBodyName, referenceFrameName, aberrationCorrections,
+                                         ephemerisTime, cartesianStateVector ) )
+    {
+        return cartesianStateVector;
+    }
+
     // Declare variables for cartesian state and light-time to be determined by Spice.
     double stateAtEpoch[6];
     double lightTime;
+    unsigned int kernelPoolVersion;
 
     // Call Spice function to calculate state and light-time.
-    spkezr_c(getCorrectedTargetBodyName( targetBodyName ).c_str(), ephemerisTime, referenceFrameName.c_str(),
-             aberrationCorrections.c_str(),
-             getCorrectedTargetBodyName( observerBodyName ).c_str(), stateAtEpoch,
-             &lightTime);
+    {
+        SpiceAccessLock spiceLock;
+        kernelPoolVersion = spiceKernelPoolVersion;
+        spkezr_c(getCorrectedTargetBodyName( targetBodyName ).c_str(), ephemerisTime, referenceFrameName.c_str(),
+                 aberrationCorrections.c_str(),
+                 getCorrectedTargetBodyName( observerBodyName ).c_str(), stateAtEpoch,
+                 &lightTime);
+    }
 
     // Put result in Eigen Vector.
-    Vector6d cartesianStateVector;
     for (unsigned int i = 0; i < 6; i++) {
         cartesianStateVector(i) = stateAtEpoch[i];
     }
 
     // Convert from km(/s) to m(/s).
-    return unit_conversions::convertKilometersToMeters<Vector6d>(
+    cartesianStateVector = unit_conversions::convertKilometersToMeters<Vector6d>(
                 cartesianStateVector);
+    stateResultCache.setResult( targetBodyName, observerBodyName, referenceFrameName, aberrationCorrections,
+                                ephemerisTime, kernelPoolVersion, cartesianStateVector );
+    return cartesianStateVector;
 }
 
 //! Get Cartesian position of a body, as observed from another body.
@@ -102,25 +298,117 @@ Eigen::Vector3d getBodyCartesianPositionAtEpoch(const std::string &targetBodyNam
     {
         throw std::invalid_argument( "Error when retrieving Cartesian position from Spice, input time is " + std::to_string(ephemerisTime) );
     }
+    // Check if position was already computed by this thread.
+    Eigen::Vector3d cartesianPositionVector;
+    if( positionResultCache.retrieveResult( targetBodyName, observerBodyName, referenceFrameName, aberrationCorrections,
+                                            ephemerisTime, cartesianPositionVector ) )
+    {
+        return cartesianPositionVector;
+    }
+
     // Declare variables for cartesian position and light-time to be determined by Spice.
     double positionAtEpoch[3];
     double lightTime;
+    unsigned int kernelPoolVersion;
 
     // Call Spice function to calculate position and light-time.
-    spkpos_c(getCorrectedTargetBodyName( targetBodyName ).c_str(), ephemerisTime, referenceFrameName.c_str(),
-             aberrationCorrections.c_str(),
-             getCorrectedTargetBodyName( observerBodyName ).c_str(), positionAtEpoch,
-             &lightTime);
+    {
+        SpiceAccessLock spiceLock;
+        kernelPoolVersion = spiceKernelPoolVersion;
+        spkpos_c(getCorrectedTargetBodyName( targetBodyName ).c_str(), ephemerisTime, referenceFrameName.c_str(),
+                 aberrationCorrections.c_str(),
+                 getCorrectedTargetBodyName( observerBodyName ).c_str(), positionAtEpoch,
+                 &lightTime);
+    }
 
     // Put result in Eigen Vector.
-    Eigen::Vector3d cartesianPositionVector;
     for (unsigned int i = 0; i < 3; i++) {
         cartesianPositionVector(i) = positionAtEpoch[i];
     }
 
     // Convert from km to m.
-    return unit_conversions::convertKilometersToMeters<Eigen::Vector3d>(
+    cartesianPositionVector = unit_conversions::convertKilometersToMeters<Eigen::Vector3d>(
                 cartesianPositionVector);
+    positionResultCache.setResult( targetBodyName, observerBodyName, referenceFrameName, aberrationCorrections,
+                                   ephemerisTime, kernelPoolVersion, cartesianPositionVector );
+    return cartesianPositionVector;
+}
+
+//! State histories of bodies, with the version of the kernel pool from which they were computed
+struct SpiceStateHistoryCache
+{
+    std::mutex cacheMutex;
+
+    unsigned int kernelPoolVersion = 0;
+
+    std::map< std::tuple< std::string, std::string, std::string, double, double, double >,
+              std::shared_ptr< const std::map< double, Vector6d > > > cachedStateHistories;
+};
+
+//! Function to retrieve the (process-wide) cache of state histories, created on first use
+static SpiceStateHistoryCache& getSpiceStateHistoryCache( )
+{
+    static SpiceStateHistoryCache stateHistoryCache;
+    return stateHistoryCache;
+}
+
+//! Function to retrieve the Cartesian states of a body at a set of equidistant epochs, sharing the result within the process
+std::shared_ptr< const std::map< double, Vector6d > > getBodyCartesianStateHistory(
+        const std::string &targetBodyName, const std::string &observerBodyName,
+        const std::string &referenceFrameName, const double initialTime,
+        const double finalTime, const double timeStep )
+{
+    if( !( timeStep > 0.0 ) )
+    {
+        throw std::invalid_argument( "Error when retrieving state history from Spice, time step is " +
+                                     std::to_string( timeStep ) );
+    }
+
+    std::tuple< std::string, std::string, std::string, double, double, double > cacheKey =
+            std::make_tuple( targetBodyName, observerBodyName, referenceFrameName, initialTime, finalTime, timeStep );
+
+    // Retrieve states from cache, if they were computed with the current kernel pool
+    SpiceStateHistoryCache& stateHistoryCache = getSpiceStateHistoryCache( );
+    unsigned int kernelPoolVersion = spiceKernelPoolVersion;
+    {
+        std::lock_guard< std::mutex > cacheLock( stateHistoryCache.cacheMutex );
+        if( stateHistoryCache.kernelPoolVersion != kernelPoolVersion )
+        {
+            stateHistoryCache.cachedStateHistories.clear( );
+            stateHistoryCache.kernelPoolVersion = kernelPoolVersion;
+        }
+        auto cacheIterator = stateHistoryCache.cachedStateHistories.find( cacheKey );
+        if( cacheIterator != stateHistoryCache.cachedStateHistories.end( ) )
+        {
+            return cacheIterator->second;
+        }
+    }
+
+    // Compute states, without holding the cache lock (CSPICE access is serialized separately)
+    std::shared_ptr< std::map< double, Vector6d > > stateHistory = std::make_shared< std::map< double, Vector6d > >( );
+    double currentTime = initialTime;
+    while( currentTime < finalTime )
+    {
+        ( *stateHistory )[ currentTime ] = getBodyCartesianStateAtEpoch(
+                    targetBodyName, observerBodyName, referenceFrameName, "none", currentTime );
+        currentTime += timeStep;
+    }
+
+    // Store states, unless the kernel pool was modified while they were computed
+    std::lock_guard< std::mutex > cacheLock( stateHistoryCache.cacheMutex );
+    if( stateHistoryCache.kernelPoolVersion == kernelPoolVersion && spiceKernelPoolVersion == kernelPoolVersion )
+    {
+        stateHistoryCache.cachedStateHistories[ cacheKey ] = stateHistory;
+    }
+    return stateHistory;
+}
+
+//! Function to clear the cache of state histories used by getBodyCartesianStateHistory
+void clearSpiceStateHistoryCache( )
+{
+    SpiceStateHistoryCache& stateHistoryCache = getSpiceStateHistoryCache( );
+    std::lock_guard< std::mutex > cacheLock( stateHistoryCache.cacheMutex );
+    stateHistoryCache.cachedStateHistories.clear( );
 }
 
 //! Get Cartesian state of a satellite from its two-line element set at a specified epoch.
@@ -150,6 +438,7 @@ Vector6d getCartesianStateFromTleAtEpoch(double epoch, std::shared_ptr<ephemerid
     elements[9] = tle->getEpoch();// TLE ephemeris epoch in seconds since J2000
 
     // Call Spice function. Return value is always 0, so no need to save it.
+    SpiceAccessLock spiceLock;
     ev2lin_(&epoch, physicalConstants, elements, stateAtEpoch);
 
     // Put result in Eigen Vector.
@@ -162,6 +451,50 @@ Vector6d getCartesianStateFromTleAtEpoch(double epoch, std::shared_ptr<ephemerid
     return unit_conversions::convertKilometersToMeters<Vector6d>(cartesianStateVector);
 }
 
+//! Get Cartesian states of a satellite from its two-line element set at a list of epochs.
+Eigen::Matrix< double, 6, Eigen::Dynamic > getCartesianStatesFromTleAtEpochs(
+        const std::vector< double >& epochs, std::shared_ptr<ephemerides::Tle> tle )
+{
+    // Physical constants used by CSpice's implementation of SGP4.
+    double physicalConstants[8] = {1.082616E-3, -2.53881E-6, -1.65597E-6, 7.43669161e-2, 120.0, 78.0, 6378.135, 1.0};
+
+    double elements[10];
+    elements[0] = 0.0;
+    elements[1] = 0.0;
+    elements[2] = tle->getBStar();
+    elements[3] = tle->getInclination();
+    elements[4] = tle->getRightAscension();
+    elements[5] = tle->getEccentricity();
+    elements[6] = tle->getArgOfPerigee();
+    elements[7] = tle->getMeanAnomaly();
+    elements[8] = tle->getMeanMotion();
+    elements[9] = tle->getEpoch();
+
+    Eigen::Matrix< double, 6, Eigen::Dynamic > cartesianStates( 6, epochs.size( ) );
+
+    // Keep Spice locked for all epochs, so that calls for other TLEs (from other threads) cannot be interleaved, and the
+    // initialization of the propagator (which ev2lin_ only redoes when its input elements change) is performed only once.
+    SpiceAccessLock spiceLock;
+    double stateAtEpoch[6];
+    for( unsigned int i = 0; i < epochs.size( ); i++ )
+    {
+        double epoch = epochs.at( i );
+        if( !( epoch == epoch ) )
+        {
+            throw std::invalid_argument( "Error when retrieving TLE from Spice, input time is " + std::to_string( epoch ) );
+        }
+        ev2lin_( &epoch, physicalConstants, elements, stateAtEpoch );
+
+        for( unsigned int j = 0; j < 6; j++ )
+        {
+            cartesianStates( j, i ) = stateAtEpoch[ j ];
+        }
+    }
+
+    // Convert from km to m.
+    return 1.0E3 * cartesianStates;
+}
+
 //! Compute quaternion of rotation between two frames.
 Eigen::Quaterniond computeRotationQuaternionBetweenFrames(const std::string &originalFrame,
                                                           const std::string &newFrame,
@@ -171,18 +504,32 @@ Eigen::Quaterniond computeRotationQuaternionBetweenFrames(const std::string &ori
         throw std::invalid_argument( "Error when retrieving rotation quaternion from Spice, input time is " + std::to_string(ephemerisTime) );
     }
 
-    // Declare rotation matrix.
-    double rotationArray[3][3];
-
-    // Calculate rotation matrix.
-    pxform_c(originalFrame.c_str(), newFrame.c_str(), ephemerisTime, rotationArray);
+    static const std::string emptyString = "";
 
-    // Put rotation matrix in Eigen Matrix3d.
+    // Check if rotation matrix was already computed by this thread.
     Eigen::Matrix3d rotationMatrix;
-    for (unsigned int i = 0; i < 3; i++) {
-        for (unsigned int j = 0; j < 3; j++) {
-            rotationMatrix(i, j) = rotationArray[i][j];
+    if( !rotationResultCache.retrieveResult(
+                originalFrame, newFrame, emptyString, emptyString, ephemerisTime, rotationMatrix ) )
+    {
+        // Declare rotation matrix.
+        double rotationArray[3][3];
+        unsigned int kernelPoolVersion;
+
+        // Calculate rotation matrix.
+        {
+            SpiceAccessLock spiceLock;
+            kernelPoolVersion = spiceKernelPoolVersion;
+            pxform_c(originalFrame.c_str(), newFrame.c_str(), ephemerisTime, rotationArray);
+        }
+
+        // Put rotation matrix in Eigen Matrix3d.
+        for (unsigned int i = 0; i < 3; i++) {
+            for (unsigned int j = 0; j < 3; j++) {
+                rotationMatrix(i, j) = rotationArray[i][j];
+            }
         }
+        rotationResultCache.setResult(
+                    originalFrame, newFrame, emptyString, emptyString, ephemerisTime, kernelPoolVersion, rotationMatrix );
     }
 
     // Convert matrix3d to Quaternion.
@@ -206,20 +553,8 @@ Eigen::Matrix6d computeStateRotationMatrixBetweenFrames(const std::string &origi
         throw std::invalid_argument( "Error when retrieving state rotation matrix from Spice, input time is " + std::to_string(ephemerisTime) );
     }
 
-    double stateTransition[6][6];
-
     // Calculate state transition matrix.
-    sxform_c(originalFrame.c_str(), newFrame.c_str(), ephemerisTime, stateTransition);
-
-    // Put rotation matrix in Eigen Matrix6d
-    Eigen::Matrix6d stateTransitionMatrix = Eigen::Matrix6d::Zero();
-    for (unsigned int i = 0; i < 6; i++) {
-        for (unsigned int j = 0; j < 6; j++) {
-            stateTransitionMatrix(i, j) = stateTransition[i][j];
-        }
-    }
-
-    return stateTransitionMatrix;
+    return computeSpiceStateTransformationMatrix( originalFrame, newFrame, ephemerisTime );
 }
 
 //! Computes time derivative of rotation matrix between two frames.
@@ -232,20 +567,12 @@ Eigen::Matrix3d computeRotationMatrixDerivativeBetweenFrames(const std::string &
         throw std::invalid_argument( "Error when retrieving rotation matrix derivative from Spice, input time is " + std::to_string(ephemerisTime) );
     }
 
-    double stateTransition[6][6];
-
     // Calculate state transition matrix.
-    sxform_c(originalFrame.c_str(), newFrame.c_str(), ephemerisTime, stateTransition);
-
-    // Put rotation matrix derivative in Eigen Matrix3d
-    Eigen::Matrix3d matrixDerivative = Eigen::Matrix3d::Zero();
-    for (unsigned int i = 0; i < 3; i++) {
-        for (unsigned int j = 0; j < 3; j++) {
-            matrixDerivative(i, j) = stateTransition[i + 3][j];
-        }
-    }
+    Eigen::Matrix6d stateTransitionMatrix = computeSpiceStateTransformationMatrix(
+                originalFrame, newFrame, ephemerisTime );
 
-    return matrixDerivative;
+    // Retrieve rotation matrix derivative
+    return stateTransitionMatrix.block< 3, 3 >( 3, 0 );
 }
 
 //! Computes the angular velocity of one frame w.r.t. to another frame.
@@ -258,40 +585,41 @@ Eigen::Vector3d getAngularVelocityVectorOfFrameInOriginalFrame(const std::string
         throw std::invalid_argument( "Error when retrieving angular velocity from Spice, input time is " + std::to_string(ephemerisTime) );
     }
 
-    double stateTransition[6][6];
-
     // Calculate state transition matrix.
-    sxform_c(originalFrame.c_str(), newFrame.c_str(), ephemerisTime, stateTransition);
+    Eigen::Matrix6d stateTransitionMatrix = computeSpiceStateTransformationMatrix(
+                originalFrame, newFrame, ephemerisTime );
+
+    double stateTransition[6][6];
+    for (unsigned int i = 0; i < 6; i++) {
+        for (unsigned int j = 0; j < 6; j++) {
+            stateTransition[i][j] = stateTransitionMatrix(i, j);
+        }
+    }
 
     double rotation[3][3];
     double angularVelocity[3];
 
     // Calculate angular velocity vector.
-    xf2rav_c(stateTransition, rotation, angularVelocity);
+    {
+        SpiceAccessLock spiceLock;
+        xf2rav_c(stateTransition, rotation, angularVelocity);
+    }
 
     return (Eigen::Vector3d() << angularVelocity[0], angularVelocity[1], angularVelocity[2]).finished();
 }
 
 std::pair<Eigen::Quaterniond, Eigen::Matrix3d> computeRotationQuaternionAndRotationMatrixDerivativeBetweenFrames(
         const std::string &originalFrame, const std::string &newFrame, const double ephemerisTime) {
-    double stateTransition[6][6];
-
     if( !( ephemerisTime == ephemerisTime )  )
     {
         throw std::invalid_argument( "Error when retrieving rotational state from Spice, input time is " + std::to_string(ephemerisTime) );
     }
 
-    sxform_c(originalFrame.c_str(), newFrame.c_str(), ephemerisTime, stateTransition);
-
-    Eigen::Matrix3d matrixDerivative;
-    Eigen::Matrix3d rotationMatrix;
+    Eigen::Matrix6d stateTransitionMatrix = computeSpiceStateTransformationMatrix(
+                originalFrame, newFrame, ephemerisTime );
 
-    for (unsigned int i = 0; i < 3; i++) {
-        for (unsigned int j = 0; j < 3; j++) {
-            rotationMatrix(i, j) = stateTransition[i][j];
-            matrixDerivative(i, j) = stateTransition[i + 3][j];
-        }
-    }
+    Eigen::Matrix3d rotationMatrix = stateTransitionMatrix.block< 3, 3 >( 0, 0 );
+    Eigen::Matrix3d matrixDerivative = stateTransitionMatrix.block< 3, 3 >( 3, 0 );
     return std::make_pair(Eigen::Quaterniond(rotationMatrix), matrixDerivative);
 }
 
@@ -303,6 +631,7 @@ std::vector<double> getBodyProperties(const std::string &body, const std::string
 
     // Call Spice function to retrieve property.
     SpiceInt numberOfReturnedParameters;
+    SpiceAccessLock spiceLock;
     bodvrd_c(body.c_str(), property.c_str(), maximumNumberOfValues, &numberOfReturnedParameters,
              propertyArray);
 
@@ -323,7 +652,10 @@ double getBodyGravitationalParameter(const std::string &body) {
 
     // Call Spice function to retrieve gravitational parameter.
     SpiceInt numberOfReturnedParameters;
-    bodvrd_c(body.c_str(), "GM", 1, &numberOfReturnedParameters, gravitationalParameter);
+    {
+        SpiceAccessLock spiceLock;
+        bodvrd_c(body.c_str(), "GM", 1, &numberOfReturnedParameters, gravitationalParameter);
+    }
 
     // Convert from km^3/s^2 to m^3/s^2
     return unit_conversions::convertKilometersToMeters<double>(
@@ -339,7 +671,10 @@ double getAverageRadius(const std::string &body) {
 
     // Call Spice function to retrieve gravitational parameter.
     SpiceInt numberOfReturnedParameters;
-    bodvrd_c(body.c_str(), "RADII", 3, &numberOfReturnedParameters, radii);
+    {
+        SpiceAccessLock spiceLock;
+        bodvrd_c(body.c_str(), "RADII", 3, &numberOfReturnedParameters, radii);
+    }
 
     // Compute average and convert from km to m.
     return unit_conversions::convertKilometersToMeters<double>(
@@ -352,7 +687,10 @@ int convertBodyNameToNaifId(const std::string &bodyName) {
     // Convert body name to NAIF ID number.
     SpiceInt bodyNaifId;
     SpiceBoolean isIdFound;
-    bods2c_c(bodyName.c_str(), &bodyNaifId, &isIdFound);
+    {
+        SpiceAccessLock spiceLock;
+        bods2c_c(bodyName.c_str(), &bodyNaifId, &isIdFound);
+    }
 
     // Convert SpiceInt (typedef for long) to int and return.
     return static_cast<int>(bodyNaifId);
@@ -364,74 +702,316 @@ bool checkBodyPropertyInKernelPool(const std::string &bodyName, const std::strin
     const int naifId = convertBodyNameToNaifId(bodyName);
 
     // Determine if property is in pool.
+    SpiceAccessLock spiceLock;
     SpiceBoolean isPropertyInPool = bodfnd_c(naifId, bodyProperty.c_str());
     return static_cast<bool>(isPropertyInPool);
 }
 
+namespace
+{
+
+//! Summary of a single segment of an SPK kernel (see getSpkKernelSegments)
+struct SpkSegmentSummary
+{
+    //! NAIF ID of the body of which the state is given by the segment
+    int targetId;
+
+    //! NAIF ID of the body w.r.t. which the state is given by the segment
+    int centerId;
+
+    //! Start of the time interval covered by the segment (ephemeris time)
+    double startTime;
+
+    //! End of the time interval covered by the segment (ephemeris time)
+    double endTime;
+};
+
+//! Kernels that were loaded since the kernel pool was last cleared, with the time taken to load each of them
+std::vector< std::pair< std::string, double > > loadedSpiceKernels;
+
+//! SPK kernels that are registered for loading on demand, but have not yet been loaded
+std::vector< std::string > pendingSpiceKernels;
+
+//! Segment summaries of the SPK kernels that have been inspected, with the file name as key
+std::map< std::string, std::vector< SpkSegmentSummary > > spkKernelSegments;
+
+//! Function to check whether a kernel file is an SPK kernel, based on its extension
+bool isSpkKernel( const std::string& fileName )
+{
+    std::string extension = boost::filesystem::path( fileName ).extension( ).string( );
+    std::transform( extension.begin( ), extension.end( ), extension.begin( ), ::tolower );
+    return extension == ".bsp";
+}
+
+//! Function to retrieve the segment summaries of an SPK kernel, read from the file without loading it (must be called
+//! while holding the CSPICE access mutex)
+const std::vector< SpkSegmentSummary >& getSpkKernelSegments( const std::string& fileName )
+{
+    if( spkKernelSegments.count( fileName ) == 0 )
+    {
+        if( !boost::filesystem::exists( fileName ) )
+        {
+            throw std::runtime_error( "Error when inspecting Spice kernel " + fileName + ", file does not exist." );
+        }
+
+        // Read the summary (two doubles, six integers) of each segment in the DAF file
+        std::vector< SpkSegmentSummary > segments;
+        SpiceInt handle;
+        SpiceBoolean isSegmentFound;
+        SpiceDouble segmentSummary[ 5 ];
+        SpiceDouble doubleComponents[ 2 ];
+        SpiceInt integerComponents[ 6 ];
+        dafopr_c( fileName.c_str( ), &handle );
+        dafbfs_c( handle );
+        daffna_c( &isSegmentFound );
+        while( isSegmentFound )
+        {
+            dafgs_c( segmentSummary );
+            dafus_c( segmentSummary, 2, 6, doubleComponents, integerComponents );
+            segments.push_back( SpkSegmentSummary{ static_cast< int >( integerComponents[ 0 ] ),
+                                                   static_cast< int >( integerComponents[ 1 ] ),
+                                                   doubleComponents[ 0 ], doubleComponents[ 1 ] } );
+            daffna_c( &isSegmentFound );
+        }
+        dafcls_c( handle );
+        spkKernelSegments[ fileName ] = segments;
+    }
+    return spkKernelSegments.at( fileName );
+}
+
+}
+
 //! Load a Spice kernel.
 void loadSpiceKernelInTudat(const std::string &fileName) {
+    SpiceAccessLock spiceLock;
+    spiceKernelPoolVersion++;
+    std::chrono::steady_clock::time_point loadingStartTime = std::chrono::steady_clock::now( );
     furnsh_c(fileName.c_str());
+    loadedSpiceKernels.push_back(
+                std::make_pair( fileName, std::chrono::duration< double >(
+                                    std::chrono::steady_clock::now( ) - loadingStartTime ).count( ) ) );
+    pendingSpiceKernels.erase( std::remove( pendingSpiceKernels.begin( ), pendingSpiceKernels.end( ), fileName ),
+                               pendingSpiceKernels.end( ) );
+}
+
+//! Function to register a Spice kernel for loading on demand
+void registerSpiceKernelForLoadingOnDemand(const std::string &fileName) {
+    SpiceAccessLock spiceLock;
+    if( !isSpkKernel( fileName ) )
+    {
+        loadSpiceKernelInTudat( fileName );
+    }
+    else if( std::find( pendingSpiceKernels.begin( ), pendingSpiceKernels.end( ), fileName ) ==
+             pendingSpiceKernels.end( ) )
+    {
+        pendingSpiceKernels.push_back( fileName );
+    }
+}
+
+//! Function to retrieve the list of SPK kernels that are registered for loading on demand, but have not yet been loaded
+std::vector<std::string> getPendingSpiceKernels() {
+    SpiceAccessLock spiceLock;
+    return pendingSpiceKernels;
+}
+
+//! Function to load the pending SPK kernels that are required for the states of a list of bodies in a time interval
+std::vector<std::string> loadPendingSpiceKernelsForBodies(const std::vector<std::string> &bodyNames,
+                                                          const double startTime,
+                                                          const double endTime) {
+    SpiceAccessLock spiceLock;
+
+    // Retrieve NAIF IDs of bodies; also require the barycenter of each planet
+    std::set< int > requiredBodyIds;
+    bool loadAllKernels = false;
+    for( const std::string& bodyName : bodyNames )
+    {
+        SpiceInt bodyNaifId;
+        SpiceBoolean isIdFound;
+        bods2c_c( bodyName.c_str( ), &bodyNaifId, &isIdFound );
+        if( !isIdFound )
+        {
+            // Kernels required for unknown bodies cannot be determined, so all kernels are loaded
+            loadAllKernels = true;
+            break;
+        }
+        requiredBodyIds.insert( static_cast< int >( bodyNaifId ) );
+        if( bodyNaifId > 100 && bodyNaifId < 1000 && bodyNaifId % 100 == 99 )
+        {
+            requiredBodyIds.insert( static_cast< int >( bodyNaifId / 100 ) );
+        }
+    }
+
+    std::vector< std::string > kernelsToLoad;
+    if( loadAllKernels )
+    {
+        kernelsToLoad = pendingSpiceKernels;
+    }
+    else
+    {
+        // Candidate kernels: pending kernels, and loaded SPK kernels (only to determine the required center bodies)
+        std::vector< std::pair< std::string, bool > > candidateKernels;
+        for( const std::string& kernel : pendingSpiceKernels )
+        {
+            candidateKernels.push_back( std::make_pair( kernel, true ) );
+        }
+        for( const std::pair< std::string, double >& kernel : loadedSpiceKernels )
+        {
+            if( isSpkKernel( kernel.first ) )
+            {
+                candidateKernels.push_back( std::make_pair( kernel.first, false ) );
+            }
+        }
+
+        // Select kernels with segments for any of the required bodies in the time interval, and add the centers of these
+        // segments to the required bodies, until no further bodies are added.
+        std::vector< bool > isKernelSelected( candidateKernels.size( ), false );
+        bool areBodiesAdded = true;
+        while( areBodiesAdded )
+        {
+            areBodiesAdded = false;
+            for( unsigned int i = 0; i < candidateKernels.size( ); i++ )
+            {
+                for( const SpkSegmentSummary& segment : getSpkKernelSegments( candidateKernels.at( i ).first ) )
+                {
+                    bool isSegmentInInterval = !( segment.endTime < startTime ) && !( segment.startTime > endTime );
+                    if( requiredBodyIds.count( segment.targetId ) > 0 && isSegmentInInterval )
+                    {
+                        isKernelSelected[ i ] = true;
+                        if( requiredBodyIds.insert( segment.centerId ).second )
+                        {
+                            areBodiesAdded = true;
+                        }
+                    }
+                }
+            }
+        }
+
+        for( unsigned int i = 0; i < candidateKernels.size( ); i++ )
+        {
+            if( isKernelSelected.at( i ) && candidateKernels.at( i ).second )
+            {
+                kernelsToLoad.push_back( candidateKernels.at( i ).first );
+            }
+        }
+    }
+
+    for( const std::string& kernel : kernelsToLoad )
+    {
+        loadSpiceKernelInTudat( kernel );
+    }
+    return kernelsToLoad;
+}
+
+//! Function to load all SPK kernels that are registered for loading on demand, but have not yet been loaded
+void loadAllPendingSpiceKernels() {
+    SpiceAccessLock spiceLock;
+    std::vector< std::string > kernelsToLoad = pendingSpiceKernels;
+    for( const std::string& kernel : kernelsToLoad )
+    {
+        loadSpiceKernelInTudat( kernel );
+    }
+}
+
+//! Function to retrieve the report on the kernels that were loaded since the kernel pool was last cleared
+SpiceKernelLoadingReport getSpiceKernelLoadingReport() {
+    SpiceAccessLock spiceLock;
+    SpiceKernelLoadingReport report;
+    report.loadedKernels_ = loadedSpiceKernels;
+    report.pendingKernels_ = pendingSpiceKernels;
+    for( const std::pair< std::string, double >& kernel : loadedSpiceKernels )
+    {
+        report.totalLoadingTime_ += kernel.second;
+    }
+    return report;
+}
+
+//! Function to print the report on the kernels that were loaded since the kernel pool was last cleared
+void printSpiceKernelLoadingReport() {
+    SpiceKernelLoadingReport report = getSpiceKernelLoadingReport( );
+    std::cout << "Spice kernels loaded: " << report.loadedKernels_.size( ) << " ("
+              << report.totalLoadingTime_ << " s loading time), not loaded: "
+              << report.pendingKernels_.size( ) << std::endl;
+    for( const std::pair< std::string, double >& kernel : report.loadedKernels_ )
+    {
+        std::cout << "  loaded:     " << kernel.first << " (" << kernel.second << " s)" << std::endl;
+    }
+    for( const std::string& kernel : report.pendingKernels_ )
+    {
+        std::cout << "  not loaded: " << kernel << std::endl;
+    }
 }
 
 //! Get the amount of loaded Spice kernels.
 int getTotalCountOfKernelsLoaded() {
     SpiceInt count;
+    SpiceAccessLock spiceLock;
     ktotal_c("ALL", &count);
     return count;
 }
 
 //! Clear all Spice kernels.
-void clearSpiceKernels() { kclear_c(); }
+void clearSpiceKernels() {
+    SpiceAccessLock spiceLock;
+    spiceKernelPoolVersion++;
+    kclear_c();
+    loadedSpiceKernels.clear( );
+    pendingSpiceKernels.clear( );
+}
 
 //! Get all standard Spice kernels used in tudat.
 std::vector<std::string> getStandardSpiceKernels(const std::vector<std::string> alternativeEphemerisKernels) {
     std::vector<std::string> standardSpiceKernels;
 
-//    std::string kernelPath = paths::getSpiceKernelPath();
-//    standardSpiceKernels.push_back(kernelPath + "/pck00010.tpc");
+    std::string kernelPath = paths::getSpiceKernelPath();
+    standardSpiceKernels.push_back(kernelPath + "/pck00010.tpc");
 //    standardSpiceKernels.push_back(kernelPath + "/gm_de431.tpc");
+    standardSpiceKernels.push_back(kernelPath + "/inpop19a_TDB_m100_p100_spice.tpc");
+    standardSpiceKernels.push_back(kernelPath + "/NOE-4-2020.tpc");
+    standardSpiceKernels.push_back(kernelPath + "/NOE-5-2021.tpc");
+    standardSpiceKernels.push_back(kernelPath + "/NOE-6-2018-MAIN-v2.tpc");
 
-//    if (alternativeEphemerisKernels.size() == 0) {
-//        standardSpiceKernels.push_back(kernelPath + "/tudat_merged_spk_kernel.bsp");
-//    } else {
-//        for (unsigned int i = 0; i < alternativeEphemerisKernels.size(); i++) {
-//            standardSpiceKernels.push_back(alternativeEphemerisKernels.at(i));
-//        }
-//    }
-//    standardSpiceKernels.push_back(kernelPath + "/naif0012.tls");
+    if (alternativeEphemerisKernels.size() == 0)
+    {
+        standardSpiceKernels.push_back(kernelPath + "/codes_300ast_20100725.bsp");
+        standardSpiceKernels.push_back(kernelPath + "/codes_300ast_20100725.tf");
+        standardSpiceKernels.push_back(kernelPath + "/inpop19a_TDB_m100_p100_spice.bsp");
+        standardSpiceKernels.push_back(kernelPath + "/NOE-4-2020.bsp");
+        standardSpiceKernels.push_back(kernelPath + "/NOE-5-2021.bsp");
+        standardSpiceKernels.push_back(kernelPath + "/NOE-6-2018-MAIN-v2.bsp");
+        standardSpiceKernels.push_back(kernelPath + "/juice_mat_crema_4_0_20220601_20330626_v01.bsp");
+    }
+    else
+    {
+        for (unsigned int i = 0; i < alternativeEphemerisKernels.size(); i++)
+        {
+            standardSpiceKernels.push_back(alternativeEphemerisKernels.at(i));
+        }
+    }
+    standardSpiceKernels.push_back(kernelPath + "/naif0012.tls");
     return standardSpiceKernels;
 }
 
 void loadStandardSpiceKernels(const std::vector<std::string> alternativeEphemerisKernels) {
 
-    std::string kernelPath = paths::getSpiceKernelPath();
-    loadSpiceKernelInTudat(kernelPath + "/pck00010.tpc");
-//    loadSpiceKernelInTudat(kernelPath + "/gm_de431.tpc");
-    loadSpiceKernelInTudat(kernelPath + "/inpop19a_TDB_m100_p100_spice.tpc");
-    loadSpiceKernelInTudat(kernelPath + "/NOE-4-2020.tpc");
-    loadSpiceKernelInTudat(kernelPath + "/NOE-5-2021.tpc");
-    loadSpiceKernelInTudat(kernelPath + "/NOE-6-2018-MAIN-v2.tpc");
+    // Keep access to CSPICE locked until all kernels are loaded.
+    SpiceAccessLock spiceLock;
 
-    if (alternativeEphemerisKernels.size() == 0)
+    std::vector<std::string> standardSpiceKernels = getStandardSpiceKernels(alternativeEphemerisKernels);
+    for (unsigned int i = 0; i < standardSpiceKernels.size(); i++)
     {
+        loadSpiceKernelInTudat(standardSpiceKernels.at(i));
+    }
+}
 
-        loadSpiceKernelInTudat(kernelPath + "/codes_300ast_20100725.bsp");
-        loadSpiceKernelInTudat(kernelPath + "/codes_300ast_20100725.tf");
-        loadSpiceKernelInTudat(kernelPath + "/inpop19a_TDB_m100_p100_spice.bsp");
-        loadSpiceKernelInTudat(kernelPath + "/NOE-4-2020.bsp");
-        loadSpiceKernelInTudat(kernelPath + "/NOE-5-2021.bsp");
-        loadSpiceKernelInTudat(kernelPath + "/NOE-6-2018-MAIN-v2.bsp");
-        loadSpiceKernelInTudat(kernelPath + "/juice_mat_crema_4_0_20220601_20330626_v01.bsp");
+void loadStandardSpiceKernelsOnDemand(const std::vector<std::string> alternativeEphemerisKernels) {
 
-    }
-    else
+    SpiceAccessLock spiceLock;
+
+    std::vector<std::string> standardSpiceKernels = getStandardSpiceKernels(alternativeEphemerisKernels);
+    for (unsigned int i = 0; i < standardSpiceKernels.size(); i++)
     {
-        for (unsigned int i = 0; i < alternativeEphemerisKernels.size(); i++)
-        {
-            loadSpiceKernelInTudat(alternativeEphemerisKernels.at(i));
-        }
+        registerSpiceKernelForLoadingOnDemand(standardSpiceKernels.at(i));
     }
-    loadSpiceKernelInTudat(kernelPath + "/naif0012.tls");
 }
 
 }// namespace spice_interface
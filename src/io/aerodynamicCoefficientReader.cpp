@@ -106,6 +106,41 @@ boost::multi_array< Eigen::Vector3d, 3 > mergeThreeDimensionalCoefficients(
     return vectorArray;
 }
 
+//! Function to convert aerodynamic coefficients from text files to a binary coefficient table
+void convertAerodynamicCoefficientFilesToBinaryTable(
+        const std::map< int, std::string >& forceCoefficientFiles,
+        const std::map< int, std::string >& momentCoefficientFiles,
+        const std::string& binaryFileName )
+{
+    if( forceCoefficientFiles.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when converting aerodynamic coefficients to binary table, no force coefficient files provided" );
+    }
+
+    // Retrieve number of independent variables from file, and call approriate conversion function
+    int numberOfIndependentVariables =
+            getNumberOfIndependentVariablesInCoefficientFile( forceCoefficientFiles.begin( )->second );
+    switch( numberOfIndependentVariables )
+    {
+    case 1:
+        convertGivenSizeAerodynamicCoefficientFilesToBinaryTable< 1 >(
+                    forceCoefficientFiles, momentCoefficientFiles, binaryFileName );
+        break;
+    case 2:
+        convertGivenSizeAerodynamicCoefficientFilesToBinaryTable< 2 >(
+                    forceCoefficientFiles, momentCoefficientFiles, binaryFileName );
+        break;
+    case 3:
+        convertGivenSizeAerodynamicCoefficientFilesToBinaryTable< 3 >(
+                    forceCoefficientFiles, momentCoefficientFiles, binaryFileName );
+        break;
+    default:
+        throw std::runtime_error( "Error when converting aerodynamic coefficients to binary table, found " +
+                                  std::to_string( numberOfIndependentVariables ) +
+                                  " independent variables, up to 3 currently supported" );
+    }
+}
+
 }
 
 }
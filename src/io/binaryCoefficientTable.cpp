@@ -0,0 +1,190 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+
+#include "tudat/io/binaryCoefficientTable.h"
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Identifier at the start of each binary coefficient table
+static const char BINARY_COEFFICIENT_TABLE_IDENTIFIER[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'C', 'T', 'B' };
+
+//! Byte order mark, to detect tables written on platforms with different byte order
+static const uint32_t BINARY_COEFFICIENT_TABLE_BYTE_ORDER_MARK = 0x01020304;
+
+//! Size of the fixed part of the file header of a binary coefficient table
+static const std::size_t BINARY_COEFFICIENT_TABLE_HEADER_SIZE = 32;
+
+//! Function to write a table of coefficients, defined on a structured grid of N independent variables, to a binary file
+void writeBinaryCoefficientTable(
+        const std::string& fileName,
+        const std::vector< std::vector< double > >& independentVariables,
+        const double* coefficients,
+        const unsigned int numberOfComponents )
+{
+    if( independentVariables.size( ) == 0 || numberOfComponents == 0 )
+    {
+        throw std::runtime_error( "Error when writing binary coefficient table " + fileName +
+                                  ", no independent variables or coefficient components provided." );
+    }
+
+    // Determine size of table, and offset of coefficients in file
+    std::size_t numberOfCoefficients = 1;
+    std::size_t numberOfIndependentVariableValues = 0;
+    for( unsigned int i = 0; i < independentVariables.size( ); i++ )
+    {
+        numberOfCoefficients *= independentVariables.at( i ).size( );
+        numberOfIndependentVariableValues += independentVariables.at( i ).size( );
+    }
+    std::size_t independentVariablesEnd = BINARY_COEFFICIENT_TABLE_HEADER_SIZE +
+            independentVariables.size( ) * sizeof( uint64_t ) + numberOfIndependentVariableValues * sizeof( double );
+    uint64_t dataOffset = ( ( independentVariablesEnd + BINARY_COEFFICIENT_TABLE_DATA_ALIGNMENT - 1 ) /
+                            BINARY_COEFFICIENT_TABLE_DATA_ALIGNMENT ) * BINARY_COEFFICIENT_TABLE_DATA_ALIGNMENT;
+
+    std::ofstream tableStream( fileName, std::ios::binary | std::ios::trunc );
+    if( !tableStream.is_open( ) )
+    {
+        throw std::runtime_error( "Error when writing binary coefficient table " + fileName + ", file could not be opened." );
+    }
+
+    // Write header
+    uint32_t numberOfDimensions = independentVariables.size( );
+    uint32_t componentsPerCoefficient = numberOfComponents;
+    tableStream.write( BINARY_COEFFICIENT_TABLE_IDENTIFIER, 8 );
+    tableStream.write( reinterpret_cast< const char* >( &BINARY_COEFFICIENT_TABLE_VERSION ), sizeof( uint32_t ) );
+    tableStream.write( reinterpret_cast< const char* >( &BINARY_COEFFICIENT_TABLE_BYTE_ORDER_MARK ), sizeof( uint32_t ) );
+    tableStream.write( reinterpret_cast< const char* >( &numberOfDimensions ), sizeof( uint32_t ) );
+    tableStream.write( reinterpret_cast< const char* >( &componentsPerCoefficient ), sizeof( uint32_t ) );
+    tableStream.write( reinterpret_cast< const char* >( &dataOffset ), sizeof( uint64_t ) );
+
+    // Write independent variables
+    for( unsigned int i = 0; i < independentVariables.size( ); i++ )
+    {
+        uint64_t numberOfPoints = independentVariables.at( i ).size( );
+        tableStream.write( reinterpret_cast< const char* >( &numberOfPoints ), sizeof( uint64_t ) );
+    }
+    for( unsigned int i = 0; i < independentVariables.size( ); i++ )
+    {
+        tableStream.write( reinterpret_cast< const char* >( independentVariables.at( i ).data( ) ),
+                           independentVariables.at( i ).size( ) * sizeof( double ) );
+    }
+
+    // Pad to aligned start of coefficients, and write coefficients
+    std::vector< char > padding( dataOffset - independentVariablesEnd, 0 );
+    tableStream.write( padding.data( ), padding.size( ) );
+    tableStream.write( reinterpret_cast< const char* >( coefficients ),
+                       numberOfCoefficients * numberOfComponents * sizeof( double ) );
+
+    if( !tableStream )
+    {
+        throw std::runtime_error( "Error when writing binary coefficient table " + fileName + ", file could not be written." );
+    }
+}
+
+//! Constructor, maps the file into memory and checks its contents
+BinaryCoefficientTable::BinaryCoefficientTable( const std::string& fileName ):
+    mappedFile_( std::make_shared< MemoryMappedFile >( fileName ) )
+{
+    const char* tableData = mappedFile_->getData( );
+    std::size_t tableSize = mappedFile_->getSize( );
+
+    // Check file header
+    if( tableSize < BINARY_COEFFICIENT_TABLE_HEADER_SIZE ||
+            std::memcmp( tableData, BINARY_COEFFICIENT_TABLE_IDENTIFIER, 8 ) != 0 )
+    {
+        throw std::runtime_error( "Error when reading binary coefficient table " + fileName +
+                                  ", file is not a binary coefficient table." );
+    }
+
+    uint32_t version;
+    uint32_t byteOrderMark;
+    uint32_t numberOfDimensions;
+    uint32_t numberOfComponents;
+    uint64_t dataOffset;
+    std::memcpy( &version, tableData + 8, sizeof( uint32_t ) );
+    std::memcpy( &byteOrderMark, tableData + 12, sizeof( uint32_t ) );
+    std::memcpy( &numberOfDimensions, tableData + 16, sizeof( uint32_t ) );
+    std::memcpy( &numberOfComponents, tableData + 20, sizeof( uint32_t ) );
+    std::memcpy( &dataOffset, tableData + 24, sizeof( uint64_t ) );
+    if( byteOrderMark != BINARY_COEFFICIENT_TABLE_BYTE_ORDER_MARK )
+    {
+        throw std::runtime_error( "Error when reading binary coefficient table " + fileName +
+                                  ", table was written on platform with different byte order." );
+    }
+    if( version != BINARY_COEFFICIENT_TABLE_VERSION )
+    {
+        throw std::runtime_error( "Error when reading binary coefficient table " + fileName + ", version " +
+                                  std::to_string( version ) + " is not supported." );
+    }
+    numberOfComponents_ = numberOfComponents;
+
+    // Read independent variables
+    std::size_t currentOffset = BINARY_COEFFICIENT_TABLE_HEADER_SIZE + numberOfDimensions * sizeof( uint64_t );
+    if( tableSize < currentOffset )
+    {
+        throw std::runtime_error( "Error when reading binary coefficient table " + fileName + ", file is truncated." );
+    }
+
+    independentVariables_.resize( numberOfDimensions );
+    numberOfCoefficients_ = 1;
+    for( unsigned int i = 0; i < numberOfDimensions; i++ )
+    {
+        uint64_t numberOfPoints;
+        std::memcpy( &numberOfPoints, tableData + BINARY_COEFFICIENT_TABLE_HEADER_SIZE + i * sizeof( uint64_t ),
+                     sizeof( uint64_t ) );
+        if( tableSize < currentOffset + numberOfPoints * sizeof( double ) )
+        {
+            throw std::runtime_error( "Error when reading binary coefficient table " + fileName + ", file is truncated." );
+        }
+
+        independentVariables_[ i ].resize( numberOfPoints );
+        std::memcpy( independentVariables_[ i ].data( ), tableData + currentOffset, numberOfPoints * sizeof( double ) );
+        currentOffset += numberOfPoints * sizeof( double );
+        numberOfCoefficients_ *= numberOfPoints;
+    }
+
+    // Set pointer to coefficients in memory mapping
+    if( dataOffset < currentOffset ||
+            tableSize < dataOffset + numberOfCoefficients_ * numberOfComponents_ * sizeof( double ) )
+    {
+        throw std::runtime_error( "Error when reading binary coefficient table " + fileName +
+                                  ", coefficient data is inconsistent with file size." );
+    }
+    coefficients_ = reinterpret_cast< const double* >( tableData + dataOffset );
+}
+
+//! Function to load a binary coefficient table, sharing a single copy of each table within the process
+std::shared_ptr< BinaryCoefficientTable > loadBinaryCoefficientTable( const std::string& fileName )
+{
+    static std::mutex tableCacheMutex;
+    static std::map< std::string, std::weak_ptr< BinaryCoefficientTable > > tableCache;
+
+    std::lock_guard< std::mutex > cacheLock( tableCacheMutex );
+    std::shared_ptr< BinaryCoefficientTable > table = tableCache[ fileName ].lock( );
+    if( table == nullptr )
+    {
+        table = std::make_shared< BinaryCoefficientTable >( fileName );
+        tableCache[ fileName ] = table;
+    }
+    return table;
+}
+
+} // namespace input_output
+
+} // namespace tudat
@@ -0,0 +1,153 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cstring>
+#include <fstream>
+
+#include "tudat/io/binaryDataFile.h"
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Identifier at the start of each binary data file
+static const char BINARY_DATA_FILE_IDENTIFIER[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'C', 'O', 'L' };
+
+//! Byte order mark, to detect files written on platforms with different byte order
+static const uint32_t BINARY_DATA_FILE_BYTE_ORDER_MARK = 0x01020304;
+
+//! Size of the fixed part of the file header of a binary data file
+static const std::size_t BINARY_DATA_FILE_HEADER_SIZE = 32;
+
+//! Function to compute the offset of the keys in a binary data file
+static std::size_t getBinaryDataFileDataOffset( const std::size_t headerLength )
+{
+    return ( ( BINARY_DATA_FILE_HEADER_SIZE + headerLength + sizeof( double ) - 1 ) / sizeof( double ) ) * sizeof( double );
+}
+
+//! Function to check whether a file is a binary columnar data file
+bool isBinaryDataFile( const std::string& fileName )
+{
+    char identifier[ 8 ];
+    std::ifstream dataStream( fileName, std::ios::binary );
+    dataStream.read( identifier, 8 );
+    return dataStream.gcount( ) == 8 && std::memcmp( identifier, BINARY_DATA_FILE_IDENTIFIER, 8 ) == 0;
+}
+
+//! Function to write a list of keys, with a vector of values per key, to a binary columnar data file
+void writeBinaryDataFile(
+        const std::string& fileName,
+        const std::vector< double >& keys,
+        const Eigen::MatrixXd& values,
+        const std::string& header )
+{
+    if( static_cast< int >( keys.size( ) ) != values.rows( ) )
+    {
+        throw std::runtime_error( "Error when writing binary data file " + fileName + ", number of keys (" +
+                                  std::to_string( keys.size( ) ) + ") is not equal to number of rows of values (" +
+                                  std::to_string( values.rows( ) ) + ")." );
+    }
+
+    std::ofstream dataStream( fileName, std::ios::binary | std::ios::trunc );
+    if( !dataStream.is_open( ) )
+    {
+        throw std::runtime_error( "Error when writing binary data file " + fileName + ", file could not be opened." );
+    }
+
+    // Write header
+    uint32_t numberOfColumns = values.cols( );
+    uint32_t headerLength = header.size( );
+    uint64_t numberOfRows = keys.size( );
+    dataStream.write( BINARY_DATA_FILE_IDENTIFIER, 8 );
+    dataStream.write( reinterpret_cast< const char* >( &BINARY_DATA_FILE_VERSION ), sizeof( uint32_t ) );
+    dataStream.write( reinterpret_cast< const char* >( &BINARY_DATA_FILE_BYTE_ORDER_MARK ), sizeof( uint32_t ) );
+    dataStream.write( reinterpret_cast< const char* >( &numberOfColumns ), sizeof( uint32_t ) );
+    dataStream.write( reinterpret_cast< const char* >( &headerLength ), sizeof( uint32_t ) );
+    dataStream.write( reinterpret_cast< const char* >( &numberOfRows ), sizeof( uint64_t ) );
+    dataStream.write( header.data( ), header.size( ) );
+
+    // Pad to aligned start of data, and write keys and columns (stored contiguously, since matrix is column-major)
+    std::vector< char > padding(
+                getBinaryDataFileDataOffset( header.size( ) ) - BINARY_DATA_FILE_HEADER_SIZE - header.size( ), 0 );
+    dataStream.write( padding.data( ), padding.size( ) );
+    dataStream.write( reinterpret_cast< const char* >( keys.data( ) ), keys.size( ) * sizeof( double ) );
+    dataStream.write( reinterpret_cast< const char* >( values.data( ) ), values.size( ) * sizeof( double ) );
+
+    if( !dataStream )
+    {
+        throw std::runtime_error( "Error when writing binary data file " + fileName + ", file could not be written." );
+    }
+}
+
+//! Constructor, maps the file into memory and checks its contents
+BinaryDataFile::BinaryDataFile( const std::string& fileName ):
+    mappedFile_( std::make_shared< MemoryMappedFile >( fileName ) )
+{
+    const char* fileData = mappedFile_->getData( );
+    std::size_t fileSize = mappedFile_->getSize( );
+
+    // Check file header
+    if( fileSize < BINARY_DATA_FILE_HEADER_SIZE || std::memcmp( fileData, BINARY_DATA_FILE_IDENTIFIER, 8 ) != 0 )
+    {
+        throw std::runtime_error( "Error when reading binary data file " + fileName + ", file is not a binary data file." );
+    }
+
+    uint32_t version;
+    uint32_t byteOrderMark;
+    uint32_t numberOfColumns;
+    uint32_t headerLength;
+    uint64_t numberOfRows;
+    std::memcpy( &version, fileData + 8, sizeof( uint32_t ) );
+    std::memcpy( &byteOrderMark, fileData + 12, sizeof( uint32_t ) );
+    std::memcpy( &numberOfColumns, fileData + 16, sizeof( uint32_t ) );
+    std::memcpy( &headerLength, fileData + 20, sizeof( uint32_t ) );
+    std::memcpy( &numberOfRows, fileData + 24, sizeof( uint64_t ) );
+    if( byteOrderMark != BINARY_DATA_FILE_BYTE_ORDER_MARK )
+    {
+        throw std::runtime_error( "Error when reading binary data file " + fileName +
+                                  ", file was written on platform with different byte order." );
+    }
+    if( version != BINARY_DATA_FILE_VERSION )
+    {
+        throw std::runtime_error( "Error when reading binary data file " + fileName + ", version " +
+                                  std::to_string( version ) + " is not supported." );
+    }
+
+    // Read header text, and set pointer to data in memory mapping
+    std::size_t dataOffset = getBinaryDataFileDataOffset( headerLength );
+    if( fileSize < dataOffset + numberOfRows * ( numberOfColumns + 1 ) * sizeof( double ) )
+    {
+        throw std::runtime_error( "Error when reading binary data file " + fileName + ", file is truncated." );
+    }
+    header_ = std::string( fileData + BINARY_DATA_FILE_HEADER_SIZE, headerLength );
+    numberOfRows_ = numberOfRows;
+    numberOfColumns_ = numberOfColumns;
+    data_ = reinterpret_cast< const double* >( fileData + dataOffset );
+}
+
+//! Function to retrieve the contents of the file as a map, with a vector of values per key
+std::map< double, Eigen::VectorXd > BinaryDataFile::getDataMap( ) const
+{
+    Eigen::Map< const Eigen::VectorXd > keys = getKeys( );
+    Eigen::Map< const Eigen::MatrixXd > values = getValues( );
+
+    std::map< double, Eigen::VectorXd > dataMap;
+    for( std::size_t i = 0; i < numberOfRows_; i++ )
+    {
+        dataMap[ keys( i ) ] = values.row( i ).transpose( );
+    }
+    return dataMap;
+}
+
+} // namespace input_output
+
+} // namespace tudat
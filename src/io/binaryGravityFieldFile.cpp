@@ -0,0 +1,254 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#include "tudat/io/binaryGravityFieldFile.h"
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Identifier at the start of each binary gravity field file
+static const char BINARY_GRAVITY_FIELD_FILE_IDENTIFIER[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'S', 'H', 'C' };
+
+//! Byte order mark, to detect files written on platforms with different byte order
+static const uint32_t BINARY_GRAVITY_FIELD_FILE_BYTE_ORDER_MARK = 0x01020304;
+
+//! Size of the fixed part of the file header of a binary gravity field file
+static const std::size_t BINARY_GRAVITY_FIELD_FILE_HEADER_SIZE = 40;
+
+//! Function to compute the (64-bit FNV-1a) checksum of a block of data
+static uint64_t computeChecksum( const char* data, const std::size_t size )
+{
+    uint64_t checksum = 14695981039346656037ULL;
+    for( std::size_t i = 0; i < size; i++ )
+    {
+        checksum ^= static_cast< uint64_t >( static_cast< unsigned char >( data[ i ] ) );
+        checksum *= 1099511628211ULL;
+    }
+    return checksum;
+}
+
+//! Function to compute the offset of the first coefficient of a given degree, w.r.t. the start of the coefficients
+static std::size_t getDegreeOffset( const int degree )
+{
+    return static_cast< std::size_t >( degree ) * static_cast< std::size_t >( degree + 1 );
+}
+
+//! Function to write spherical harmonic coefficients to a binary gravity field file
+void writeBinaryGravityFieldFile(
+        const std::string& fileName,
+        const Eigen::MatrixXd& cosineCoefficients,
+        const Eigen::MatrixXd& sineCoefficients,
+        const std::string& headerLine,
+        const int64_t sourceFileSize,
+        const int64_t sourceModificationTime )
+{
+    if( cosineCoefficients.rows( ) != cosineCoefficients.cols( ) ||
+            sineCoefficients.rows( ) != cosineCoefficients.rows( ) ||
+            sineCoefficients.cols( ) != cosineCoefficients.cols( ) || cosineCoefficients.rows( ) == 0 )
+    {
+        throw std::runtime_error( "Error when writing binary gravity field file " + fileName +
+                                  ", coefficient matrices must be square and of equal size." );
+    }
+
+    // Store coefficients per degree and order, and compute checksum per degree
+    int maximumDegree = cosineCoefficients.rows( ) - 1;
+    std::vector< double > coefficients( getDegreeOffset( maximumDegree + 1 ) );
+    std::vector< uint64_t > degreeChecksums( maximumDegree + 1 );
+    for( int n = 0; n <= maximumDegree; n++ )
+    {
+        for( int m = 0; m <= n; m++ )
+        {
+            coefficients[ getDegreeOffset( n ) + 2 * m ] = cosineCoefficients( n, m );
+            coefficients[ getDegreeOffset( n ) + 2 * m + 1 ] = sineCoefficients( n, m );
+        }
+        degreeChecksums[ n ] = computeChecksum(
+                    reinterpret_cast< const char* >( coefficients.data( ) + getDegreeOffset( n ) ),
+                    2 * ( n + 1 ) * sizeof( double ) );
+    }
+
+    // Create header, and compute its checksum
+    uint32_t degree = maximumDegree;
+    uint32_t headerLineLength = headerLine.size( );
+    std::vector< char > header( BINARY_GRAVITY_FIELD_FILE_HEADER_SIZE + headerLineLength +
+                                degreeChecksums.size( ) * sizeof( uint64_t ) );
+    std::memcpy( header.data( ), BINARY_GRAVITY_FIELD_FILE_IDENTIFIER, 8 );
+    std::memcpy( header.data( ) + 8, &BINARY_GRAVITY_FIELD_FILE_VERSION, sizeof( uint32_t ) );
+    std::memcpy( header.data( ) + 12, &BINARY_GRAVITY_FIELD_FILE_BYTE_ORDER_MARK, sizeof( uint32_t ) );
+    std::memcpy( header.data( ) + 16, &degree, sizeof( uint32_t ) );
+    std::memcpy( header.data( ) + 20, &headerLineLength, sizeof( uint32_t ) );
+    std::memcpy( header.data( ) + 24, &sourceFileSize, sizeof( int64_t ) );
+    std::memcpy( header.data( ) + 32, &sourceModificationTime, sizeof( int64_t ) );
+    std::memcpy( header.data( ) + BINARY_GRAVITY_FIELD_FILE_HEADER_SIZE, headerLine.data( ), headerLineLength );
+    std::memcpy( header.data( ) + BINARY_GRAVITY_FIELD_FILE_HEADER_SIZE + headerLineLength, degreeChecksums.data( ),
+                 degreeChecksums.size( ) * sizeof( uint64_t ) );
+    uint64_t headerChecksum = computeChecksum( header.data( ), header.size( ) );
+
+    std::ofstream fileStream( fileName, std::ios::binary | std::ios::trunc );
+    if( !fileStream.is_open( ) )
+    {
+        throw std::runtime_error( "Error when writing binary gravity field file " + fileName + ", file could not be opened." );
+    }
+
+    // Write header, and pad to aligned start of coefficients
+    std::size_t headerEnd = header.size( ) + sizeof( uint64_t );
+    std::vector< char > padding( ( sizeof( double ) - headerEnd % sizeof( double ) ) % sizeof( double ), 0 );
+    fileStream.write( header.data( ), header.size( ) );
+    fileStream.write( reinterpret_cast< const char* >( &headerChecksum ), sizeof( uint64_t ) );
+    fileStream.write( padding.data( ), padding.size( ) );
+    fileStream.write( reinterpret_cast< const char* >( coefficients.data( ) ), coefficients.size( ) * sizeof( double ) );
+
+    if( !fileStream )
+    {
+        throw std::runtime_error( "Error when writing binary gravity field file " + fileName + ", file could not be written." );
+    }
+}
+
+//! Constructor, maps the file into memory and checks its header
+BinaryGravityFieldFile::BinaryGravityFieldFile( const std::string& fileName ):
+    mappedFile_( std::make_shared< MemoryMappedFile >( fileName ) ), verifiedDegree_( -1 )
+{
+    const char* fileData = mappedFile_->getData( );
+    std::size_t fileSize = mappedFile_->getSize( );
+
+    // Check file header
+    if( fileSize < BINARY_GRAVITY_FIELD_FILE_HEADER_SIZE ||
+            std::memcmp( fileData, BINARY_GRAVITY_FIELD_FILE_IDENTIFIER, 8 ) != 0 )
+    {
+        throw std::runtime_error( "Error when reading binary gravity field file " + fileName +
+                                  ", file is not a binary gravity field file." );
+    }
+
+    uint32_t version;
+    uint32_t byteOrderMark;
+    uint32_t maximumDegree;
+    uint32_t headerLineLength;
+    std::memcpy( &version, fileData + 8, sizeof( uint32_t ) );
+    std::memcpy( &byteOrderMark, fileData + 12, sizeof( uint32_t ) );
+    std::memcpy( &maximumDegree, fileData + 16, sizeof( uint32_t ) );
+    std::memcpy( &headerLineLength, fileData + 20, sizeof( uint32_t ) );
+    std::memcpy( &sourceFileSize_, fileData + 24, sizeof( int64_t ) );
+    std::memcpy( &sourceModificationTime_, fileData + 32, sizeof( int64_t ) );
+    if( byteOrderMark != BINARY_GRAVITY_FIELD_FILE_BYTE_ORDER_MARK )
+    {
+        throw std::runtime_error( "Error when reading binary gravity field file " + fileName +
+                                  ", file was written on platform with different byte order." );
+    }
+    if( version != BINARY_GRAVITY_FIELD_FILE_VERSION )
+    {
+        throw std::runtime_error( "Error when reading binary gravity field file " + fileName + ", version " +
+                                  std::to_string( version ) + " is not supported." );
+    }
+    maximumDegree_ = maximumDegree;
+
+    // Check header checksum, and file size
+    std::size_t headerSize = BINARY_GRAVITY_FIELD_FILE_HEADER_SIZE + static_cast< std::size_t >( headerLineLength ) +
+            ( static_cast< std::size_t >( maximumDegree ) + 1 ) * sizeof( uint64_t );
+    if( fileSize < headerSize + sizeof( uint64_t ) )
+    {
+        throw std::runtime_error( "Error when reading binary gravity field file " + fileName + ", file is truncated." );
+    }
+
+    uint64_t headerChecksum;
+    std::memcpy( &headerChecksum, fileData + headerSize, sizeof( uint64_t ) );
+    if( headerChecksum != computeChecksum( fileData, headerSize ) )
+    {
+        throw std::runtime_error( "Error when reading binary gravity field file " + fileName + ", header checksum is incorrect." );
+    }
+
+    std::size_t headerEnd = headerSize + sizeof( uint64_t );
+    std::size_t dataOffset = headerEnd + ( sizeof( double ) - headerEnd % sizeof( double ) ) % sizeof( double );
+    if( fileSize < dataOffset + getDegreeOffset( maximumDegree_ + 1 ) * sizeof( double ) )
+    {
+        throw std::runtime_error( "Error when reading binary gravity field file " + fileName +
+                                  ", coefficient data is inconsistent with file size." );
+    }
+
+    headerLine_ = std::string( fileData + BINARY_GRAVITY_FIELD_FILE_HEADER_SIZE, headerLineLength );
+    degreeChecksums_ = fileData + BINARY_GRAVITY_FIELD_FILE_HEADER_SIZE + headerLineLength;
+    coefficients_ = reinterpret_cast< const double* >( fileData + dataOffset );
+}
+
+//! Function to verify the checksums of all degrees up to the given degree (if not yet done)
+void BinaryGravityFieldFile::verifyChecksums( const int maximumDegree )
+{
+    std::lock_guard< std::mutex > verificationLock( verificationMutex_ );
+    for( int n = verifiedDegree_ + 1; n <= maximumDegree; n++ )
+    {
+        uint64_t degreeChecksum;
+        std::memcpy( &degreeChecksum, degreeChecksums_ + n * sizeof( uint64_t ), sizeof( uint64_t ) );
+        if( degreeChecksum != computeChecksum( reinterpret_cast< const char* >( coefficients_ + getDegreeOffset( n ) ),
+                                               2 * ( n + 1 ) * sizeof( double ) ) )
+        {
+            throw std::runtime_error( "Error when reading binary gravity field file " + getFileName( ) +
+                                      ", checksum of degree " + std::to_string( n ) + " is incorrect." );
+        }
+        verifiedDegree_ = n;
+    }
+}
+
+//! Function to extract the coefficients up to a given degree and order
+void BinaryGravityFieldFile::extractCoefficients( const int maximumDegree, const int maximumOrder,
+                                                  Eigen::MatrixXd& cosineCoefficients, Eigen::MatrixXd& sineCoefficients )
+{
+    int degreeToRead = std::min( maximumDegree, maximumDegree_ );
+    verifyChecksums( degreeToRead );
+
+    cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+    sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+    for( int n = 0; n <= degreeToRead; n++ )
+    {
+        const double* degreeCoefficients = coefficients_ + getDegreeOffset( n );
+        for( int m = 0; m <= std::min( n, maximumOrder ); m++ )
+        {
+            cosineCoefficients( n, m ) = degreeCoefficients[ 2 * m ];
+            sineCoefficients( n, m ) = degreeCoefficients[ 2 * m + 1 ];
+        }
+    }
+}
+
+//! Cache of binary gravity field files that are currently loaded, with the file name as key
+static std::map< std::string, std::weak_ptr< BinaryGravityFieldFile > > loadedGravityFieldFiles;
+
+//! Mutex for access to loadedGravityFieldFiles
+static std::mutex loadedGravityFieldFilesMutex;
+
+//! Function to load a binary gravity field file, sharing a single copy of each file within the process
+std::shared_ptr< BinaryGravityFieldFile > loadBinaryGravityFieldFile( const std::string& fileName )
+{
+    std::lock_guard< std::mutex > cacheLock( loadedGravityFieldFilesMutex );
+    std::shared_ptr< BinaryGravityFieldFile > gravityFieldFile = loadedGravityFieldFiles[ fileName ].lock( );
+    if( gravityFieldFile == nullptr )
+    {
+        gravityFieldFile = std::make_shared< BinaryGravityFieldFile >( fileName );
+        loadedGravityFieldFiles[ fileName ] = gravityFieldFile;
+    }
+    return gravityFieldFile;
+}
+
+//! Function to remove a binary gravity field file from the cache of loadBinaryGravityFieldFile
+void unloadBinaryGravityFieldFile( const std::string& fileName )
+{
+    std::lock_guard< std::mutex > cacheLock( loadedGravityFieldFilesMutex );
+    loadedGravityFieldFiles.erase( fileName );
+}
+
+} // namespace input_output
+
+} // namespace tudat
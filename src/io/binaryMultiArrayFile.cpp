@@ -0,0 +1,174 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cstring>
+#include <fstream>
+
+#include "tudat/io/binaryMultiArrayFile.h"
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Identifier at the start of each binary multi-array file
+static const char BINARY_MULTI_ARRAY_FILE_IDENTIFIER[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'M', 'D', 'A' };
+
+//! Byte order mark, to detect files written on platforms with different byte order
+static const uint32_t BINARY_MULTI_ARRAY_FILE_BYTE_ORDER_MARK = 0x01020304;
+
+//! Size of the fixed part of the file header of a binary multi-array file
+static const std::size_t BINARY_MULTI_ARRAY_FILE_HEADER_SIZE = 24;
+
+//! Function to check whether a file is a binary multi-array file
+bool isBinaryMultiArrayFile( const std::string& fileName )
+{
+    char identifier[ 8 ];
+    std::ifstream dataStream( fileName, std::ios::binary );
+    dataStream.read( identifier, 8 );
+    return dataStream.gcount( ) == 8 && std::memcmp( identifier, BINARY_MULTI_ARRAY_FILE_IDENTIFIER, 8 ) == 0;
+}
+
+//! Function to write data on a structured grid, as a function of N independent variables, to a binary file
+void writeBinaryMultiArrayFile(
+        const std::string& fileName,
+        const std::vector< std::vector< double > >& independentVariables,
+        const double* data )
+{
+    std::ofstream dataStream( fileName, std::ios::binary | std::ios::trunc );
+    if( !dataStream.is_open( ) )
+    {
+        throw std::runtime_error( "Error when writing binary multi-array file " + fileName + ", file could not be opened." );
+    }
+
+    // Write header
+    uint32_t numberOfIndependentVariables = independentVariables.size( );
+    uint32_t reservedEntry = 0;
+    dataStream.write( BINARY_MULTI_ARRAY_FILE_IDENTIFIER, 8 );
+    dataStream.write( reinterpret_cast< const char* >( &BINARY_MULTI_ARRAY_FILE_VERSION ), sizeof( uint32_t ) );
+    dataStream.write( reinterpret_cast< const char* >( &BINARY_MULTI_ARRAY_FILE_BYTE_ORDER_MARK ), sizeof( uint32_t ) );
+    dataStream.write( reinterpret_cast< const char* >( &numberOfIndependentVariables ), sizeof( uint32_t ) );
+    dataStream.write( reinterpret_cast< const char* >( &reservedEntry ), sizeof( uint32_t ) );
+
+    std::size_t numberOfDataPoints = 1;
+    for( unsigned int i = 0; i < independentVariables.size( ); i++ )
+    {
+        uint64_t independentVariableSize = independentVariables.at( i ).size( );
+        dataStream.write( reinterpret_cast< const char* >( &independentVariableSize ), sizeof( uint64_t ) );
+        numberOfDataPoints *= independentVariableSize;
+    }
+
+    // Write independent variables and data
+    for( unsigned int i = 0; i < independentVariables.size( ); i++ )
+    {
+        dataStream.write( reinterpret_cast< const char* >( independentVariables.at( i ).data( ) ),
+                          independentVariables.at( i ).size( ) * sizeof( double ) );
+    }
+    dataStream.write( reinterpret_cast< const char* >( data ), numberOfDataPoints * sizeof( double ) );
+
+    if( !dataStream )
+    {
+        throw std::runtime_error( "Error when writing binary multi-array file " + fileName + ", file could not be written." );
+    }
+}
+
+//! Constructor, maps the file into memory and checks its contents
+BinaryMultiArrayFile::BinaryMultiArrayFile( const std::string& fileName ):
+    fileName_( fileName ), mappedFile_( std::make_shared< MemoryMappedFile >( fileName ) )
+{
+    const char* fileData = mappedFile_->getData( );
+    std::size_t fileSize = mappedFile_->getSize( );
+
+    // Check file header
+    if( fileSize < BINARY_MULTI_ARRAY_FILE_HEADER_SIZE ||
+            std::memcmp( fileData, BINARY_MULTI_ARRAY_FILE_IDENTIFIER, 8 ) != 0 )
+    {
+        throw std::runtime_error( "Error when reading binary multi-array file " + fileName +
+                                  ", file is not a binary multi-array file." );
+    }
+
+    uint32_t version;
+    uint32_t byteOrderMark;
+    uint32_t numberOfIndependentVariables;
+    std::memcpy( &version, fileData + 8, sizeof( uint32_t ) );
+    std::memcpy( &byteOrderMark, fileData + 12, sizeof( uint32_t ) );
+    std::memcpy( &numberOfIndependentVariables, fileData + 16, sizeof( uint32_t ) );
+    if( byteOrderMark != BINARY_MULTI_ARRAY_FILE_BYTE_ORDER_MARK )
+    {
+        throw std::runtime_error( "Error when reading binary multi-array file " + fileName +
+                                  ", file was written on platform with different byte order." );
+    }
+    if( version != BINARY_MULTI_ARRAY_FILE_VERSION )
+    {
+        throw std::runtime_error( "Error when reading binary multi-array file " + fileName + ", version " +
+                                  std::to_string( version ) + " is not supported." );
+    }
+
+    // Read sizes of independent variables, and check file size
+    std::size_t dataOffset = BINARY_MULTI_ARRAY_FILE_HEADER_SIZE + numberOfIndependentVariables * sizeof( uint64_t );
+    if( fileSize < dataOffset )
+    {
+        throw std::runtime_error( "Error when reading binary multi-array file " + fileName + ", file is truncated." );
+    }
+
+    std::vector< uint64_t > independentVariableSizes( numberOfIndependentVariables );
+    std::memcpy( independentVariableSizes.data( ), fileData + BINARY_MULTI_ARRAY_FILE_HEADER_SIZE,
+                 numberOfIndependentVariables * sizeof( uint64_t ) );
+
+    std::size_t numberOfIndependentVariableValues = 0;
+    std::size_t numberOfDataPoints = 1;
+    for( unsigned int i = 0; i < numberOfIndependentVariables; i++ )
+    {
+        numberOfIndependentVariableValues += independentVariableSizes.at( i );
+        numberOfDataPoints *= independentVariableSizes.at( i );
+    }
+    if( fileSize < dataOffset + ( numberOfIndependentVariableValues + numberOfDataPoints ) * sizeof( double ) )
+    {
+        throw std::runtime_error( "Error when reading binary multi-array file " + fileName + ", file is truncated." );
+    }
+
+    // Copy (small) lists of independent variables, and set pointer to data in memory mapping
+    const double* currentValue = reinterpret_cast< const double* >( fileData + dataOffset );
+    for( unsigned int i = 0; i < numberOfIndependentVariables; i++ )
+    {
+        independentVariables_.push_back(
+                    std::vector< double >( currentValue, currentValue + independentVariableSizes.at( i ) ) );
+        currentValue += independentVariableSizes.at( i );
+    }
+    data_ = currentValue;
+}
+
+//! Function to retrieve the number of values of each of the independent variables
+std::vector< std::size_t > BinaryMultiArrayFile::getShape( ) const
+{
+    std::vector< std::size_t > shape;
+    for( unsigned int i = 0; i < independentVariables_.size( ); i++ )
+    {
+        shape.push_back( independentVariables_.at( i ).size( ) );
+    }
+    return shape;
+}
+
+//! Function to check whether the data has the expected number of independent variables (throws exception if not)
+void BinaryMultiArrayFile::checkNumberOfDimensions( const std::size_t numberOfDimensions ) const
+{
+    if( independentVariables_.size( ) != numberOfDimensions )
+    {
+        throw std::runtime_error( "Error when reading binary multi-array file " + fileName_ +
+                                  ", wrong number of independent variables found (expected " +
+                                  std::to_string( numberOfDimensions ) + " independent variables, got " +
+                                  std::to_string( independentVariables_.size( ) ) + ")" );
+    }
+}
+
+} // namespace input_output
+
+} // namespace tudat
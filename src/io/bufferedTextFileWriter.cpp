@@ -0,0 +1,80 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "tudat/io/bufferedTextFileWriter.h"
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Constructor, opens the file
+BufferedTextFileWriter::BufferedTextFileWriter( const std::string& fileName, const std::size_t bufferSize ):
+    fileName_( fileName ), fileStream_( fileName ), buffer_( std::max< std::size_t >( bufferSize, 1 ) ), bufferPosition_( 0 )
+{
+    if( !fileStream_.is_open( ) )
+    {
+        throw std::runtime_error( "Error when writing text file " + fileName + ", file could not be opened." );
+    }
+}
+
+//! Destructor, writes any remaining contents of the buffer to the file
+BufferedTextFileWriter::~BufferedTextFileWriter( )
+{
+    if( fileStream_.is_open( ) )
+    {
+        flush( );
+    }
+}
+
+//! Function to write a string
+void BufferedTextFileWriter::writeString( const char* data, const std::size_t size )
+{
+    if( bufferPosition_ + size > buffer_.size( ) )
+    {
+        flush( );
+
+        // Write strings that do not fit in the buffer directly to the file
+        if( size > buffer_.size( ) )
+        {
+            fileStream_.write( data, size );
+            return;
+        }
+    }
+    std::memcpy( buffer_.data( ) + bufferPosition_, data, size );
+    bufferPosition_ += size;
+}
+
+//! Function to write the contents of the buffer to the file
+void BufferedTextFileWriter::flush( )
+{
+    fileStream_.write( buffer_.data( ), bufferPosition_ );
+    bufferPosition_ = 0;
+}
+
+//! Function to write the contents of the buffer to the file, and close the file
+void BufferedTextFileWriter::close( )
+{
+    flush( );
+    fileStream_.close( );
+    if( !fileStream_ )
+    {
+        throw std::runtime_error( "Error when writing text file " + fileName_ + ", file could not be written." );
+    }
+}
+
+} // namespace input_output
+
+} // namespace tudat
@@ -7,122 +7,185 @@
  *    a copy of the license with this file. If not, please or visit:
  *    http://tudat.tudelft.nl/LICENSE.
  *
- *    Notes
- *      If tabs are used as spaces, it doesn't work. The separator should also be tabs then.
- *
  */
 
-#include <vector>
-#include <fstream>
-#include <sstream>
+#include <algorithm>
+#include <cstring>
 
-#include <boost/algorithm/string.hpp>
-#include <boost/algorithm/string/trim.hpp>
-#include <boost/algorithm/string/trim_all.hpp>
-#include <boost/iostreams/device/file.hpp>
-#include <boost/iostreams/copy.hpp>
-#include <boost/iostreams/filtering_stream.hpp>
 #include "tudat/io/matrixTextFileReader.h"
-#include "tudat/io/streamFilters.h"
 
 namespace tudat
 {
 namespace input_output
 {
 
-//! Read the file and return the data matrix.
-Eigen::MatrixXd readMatrixFromFile( const std::string& relativePath, const std::string& separators,
-                                    const std::string& skipLinesCharacter )
+//! Function to check whether a character is whitespace (other than a newline).
+static inline bool isNumericTextWhitespace( const char character )
+{
+    return character == ' ' || character == '\t' || character == '\r' || character == '\v' || character == '\f';
+}
+
+//! Constructor
+NumericTextFormat::NumericTextFormat( const std::string& separators, const std::string& skipLinesCharacter )
 {
-    // Open input and output.
-    std::fstream file( relativePath.c_str( ), std::ios::in );
-    if ( file.fail( ) )
+    std::fill( isSeparator_, isSeparator_ + 256, false );
+    std::fill( isCommentCharacter_, isCommentCharacter_ + 256, false );
+    for( unsigned int i = 0; i < separators.size( ); i++ )
     {
-        throw std::runtime_error( "Data file could not be opened: " + relativePath );
+        isSeparator_[ static_cast< unsigned char >( separators[ i ] ) ] = true;
     }
-
-    std::stringstream filteredStream( std::ios::in | std::ios::out );
+    for( unsigned int i = 0; i < 256; i++ )
     {
-        // Filter the file stream. This needs to be in its own scope, because filtering_stream::
-        // flush( ) does not work if the underlying end point is a stringstream, so the flush has
-        // to be forced by letting the filtering_stream go out of scope.
-        boost::iostreams::filtering_ostream filterProcessor;
-        for ( unsigned int i = 0; i < skipLinesCharacter.size( ); i++ )
+        if( isNumericTextWhitespace( static_cast< char >( i ) ) )
         {
-            // Remove all comments from the stream.
-            filterProcessor.push( input_output::stream_filters::RemoveComment(
-                                      skipLinesCharacter[ i ], true ) );
+            isSeparator_[ i ] = true;
         }
-
-        // Add the output to the filter chain.
-        filterProcessor.push( filteredStream );
-
-        // Copy the input to the filter.
-        boost::iostreams::copy( file, filterProcessor );
     }
+    for( unsigned int i = 0; i < skipLinesCharacter.size( ); i++ )
+    {
+        isCommentCharacter_[ static_cast< unsigned char >( skipLinesCharacter[ i ] ) ] = true;
+    }
+}
 
-    // Seek stream back to start.
-    filteredStream.seekg( 0, std::ios::beg );
-
-    // Read the filtered stream into lines.
-    std::vector< std::string > lines_;
-    while ( !filteredStream.eof( ) )
+//! Function to retrieve the next data line from separated numeric text.
+bool getNextNumericTextDataLine( const char*& position, const char* end, const NumericTextFormat& format,
+                                 const char*& lineBegin, const char*& lineEnd )
+{
+    while( position < end )
     {
-        std::string line_;
-        getline( filteredStream, line_ );
-        if ( !line_.empty( ) )
+        // Find end of current line, and move position to start of next line
+        const char* currentLineBegin = position;
+        const char* currentLineEnd = static_cast< const char* >(
+                    std::memchr( currentLineBegin, '\n', static_cast< std::size_t >( end - currentLineBegin ) ) );
+        if( currentLineEnd == nullptr )
         {
-            boost::trim_all( line_ );
-            lines_.push_back( line_ );
+            currentLineEnd = end;
+            position = end;
+        }
+        else
+        {
+            position = currentLineEnd + 1;
+        }
+
+        // Remove comment, and leading and trailing whitespace
+        for( const char* current = currentLineBegin; current < currentLineEnd; current++ )
+        {
+            if( format.isCommentCharacter_[ static_cast< unsigned char >( *current ) ] )
+            {
+                currentLineEnd = current;
+                break;
+            }
+        }
+        while( currentLineBegin < currentLineEnd && isNumericTextWhitespace( *currentLineBegin ) )
+        {
+            currentLineBegin++;
+        }
+        while( currentLineEnd > currentLineBegin && isNumericTextWhitespace( *( currentLineEnd - 1 ) ) )
+        {
+            currentLineEnd--;
+        }
+
+        if( currentLineBegin < currentLineEnd )
+        {
+            lineBegin = currentLineBegin;
+            lineEnd = currentLineEnd;
+            return true;
         }
     }
+    return false;
+}
 
-    // If there are no lines, return an empty matrix.
-    if ( lines_.empty( ) )
+//! Function to count the number of fields in a line of separated numeric text.
+unsigned int countNumericTextFields( const char* lineBegin, const char* lineEnd, const NumericTextFormat& format )
+{
+    unsigned int numberOfFields = 0;
+    bool isInField = false;
+    for( const char* current = lineBegin; current < lineEnd; current++ )
     {
-        return Eigen::MatrixXd( );
+        bool isSeparator = format.isSeparator_[ static_cast< unsigned char >( *current ) ];
+        if( !isSeparator && !isInField )
+        {
+            numberOfFields++;
+        }
+        isInField = !isSeparator;
     }
+    return numberOfFields;
+}
 
-    const std::string realSeparators = std::string( separators ) + " ";
+//! Function to split separated numeric text into chunks of complete lines, and count the data lines in each chunk.
+std::vector< NumericTextChunk > splitNumericTextIntoChunks(
+        const char* begin, const char* end, const NumericTextFormat& format,
+        const int numberOfChunks, const int numberOfThreads )
+{
+    // Do not split texts into chunks smaller than this size, for which the overhead would be significant
+    static const std::size_t minimumChunkSize = 1 << 16;
 
-    // Determine the number of columns from.
-    std::vector< std::string > lineSplit_;
-    boost::algorithm::split( lineSplit_, lines_[ 0 ], boost::is_any_of( realSeparators ),
-            boost::algorithm::token_compress_on );
-    const unsigned int numberOfColumns = lineSplit_.size( );
+    // Determine chunk boundaries, at the start of a line
+    std::size_t textSize = static_cast< std::size_t >( end - begin );
+    std::size_t maximumNumberOfChunks = std::max< std::size_t >( 1, textSize / minimumChunkSize );
+    std::size_t chunksToUse = std::min( static_cast< std::size_t >( std::max( numberOfChunks, 1 ) ), maximumNumberOfChunks );
 
-    // Initialize the matrix with sizes obtained from the number of lines and the entries in the
-    // first line.
-    Eigen::MatrixXd dataMatrix_( lines_.size( ), numberOfColumns );
-    for ( int rowIndex = 0; rowIndex < dataMatrix_.rows( ); rowIndex++ )
+    std::vector< NumericTextChunk > chunks;
+    const char* chunkBegin = begin;
+    for( std::size_t i = 1; i <= chunksToUse && chunkBegin < end; i++ )
     {
-        lineSplit_.clear( );
-
-        // Read current line and split into separate entries.
-        boost::algorithm::split( lineSplit_, lines_[ rowIndex ],
-                                 boost::is_any_of( realSeparators ),
-                                 boost::algorithm::token_compress_on );
-
-        // Check if number of column entries in line matches the number of columns in the matrix.
-        // If not, throw a runtime error.
-        if ( lineSplit_.size( ) != numberOfColumns )
+        const char* chunkEnd = end;
+        if( i < chunksToUse )
         {
-            throw std::runtime_error(
-                        "Number of columns in row " + std::to_string( rowIndex ) + " is " +
-                        std::to_string( lineSplit_.size( ) ) + " should be " +
-                        std::to_string( numberOfColumns ) );
+            chunkEnd = std::max( begin + ( textSize * i ) / chunksToUse, chunkBegin );
+            const char* nextLineStart = static_cast< const char* >(
+                        std::memchr( chunkEnd, '\n', static_cast< std::size_t >( end - chunkEnd ) ) );
+            chunkEnd = ( nextLineStart == nullptr ) ? end : nextLineStart + 1;
         }
+        chunks.push_back( NumericTextChunk{ chunkBegin, chunkEnd, 0, 0 } );
+        chunkBegin = chunkEnd;
+    }
+    if( chunks.size( ) == 0 )
+    {
+        chunks.push_back( NumericTextChunk{ begin, end, 0, 0 } );
+    }
 
-        // Put single line entries into matrix as doubles.
-        for ( int columnIndex = 0; columnIndex < dataMatrix_.cols( ); columnIndex++ )
+    // Count data lines in each chunk, and set index of first row
+    utilities::executeParallelTasks(
+                chunks.size( ), [ & ]( const int chunkIndex )
+    {
+        const char* position = chunks.at( chunkIndex ).begin_;
+        const char* lineBegin;
+        const char* lineEnd;
+        std::size_t numberOfRows = 0;
+        while( getNextNumericTextDataLine( position, chunks.at( chunkIndex ).end_, format, lineBegin, lineEnd ) )
         {
-            boost::trim( lineSplit_.at( columnIndex ) );
-            dataMatrix_( rowIndex, columnIndex ) =
-                    std::stod( lineSplit_.at( columnIndex ) );
+            numberOfRows++;
         }
+        chunks.at( chunkIndex ).numberOfRows_ = numberOfRows;
+    }, numberOfThreads );
+
+    for( unsigned int i = 1; i < chunks.size( ); i++ )
+    {
+        chunks.at( i ).firstRow_ = chunks.at( i - 1 ).firstRow_ + chunks.at( i - 1 ).numberOfRows_;
     }
+    return chunks;
+}
 
-    return dataMatrix_;
+//! Function to skip header lines at the start of separated numeric text.
+const char* skipNumericTextHeaderLines( const char* begin, const char* end, const NumericTextFormat& format,
+                                        const int numberOfHeaderLines )
+{
+    int numberOfSkippedLines = 0;
+    const char* position = begin;
+    while( position < end && numberOfSkippedLines < numberOfHeaderLines )
+    {
+        // Lines starting with a comment character are removed, and do not count as header lines
+        if( !format.isCommentCharacter_[ static_cast< unsigned char >( *position ) ] )
+        {
+            numberOfSkippedLines++;
+        }
+
+        const char* lineEnd = static_cast< const char* >(
+                    std::memchr( position, '\n', static_cast< std::size_t >( end - position ) ) );
+        position = ( lineEnd == nullptr ) ? end : lineEnd + 1;
+    }
+    return position;
 }
 
 } // namespace input_output
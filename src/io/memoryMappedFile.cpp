@@ -0,0 +1,96 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <fstream>
+#include <stdexcept>
+
+#if !defined( _WIN32 )
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "tudat/io/memoryMappedFile.h"
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Constructor, maps the file into memory
+MemoryMappedFile::MemoryMappedFile( const std::string& fileName ):
+    fileName_( fileName ), data_( nullptr ), size_( 0 ), isMapped_( false )
+{
+#if !defined( _WIN32 )
+    int fileDescriptor = open( fileName.c_str( ), O_RDONLY );
+    if( fileDescriptor < 0 )
+    {
+        throw std::runtime_error( "Error when mapping file " + fileName + " into memory, file could not be opened." );
+    }
+
+    struct stat fileStatus;
+    if( fstat( fileDescriptor, &fileStatus ) != 0 )
+    {
+        close( fileDescriptor );
+        throw std::runtime_error( "Error when mapping file " + fileName + " into memory, file size could not be retrieved." );
+    }
+    size_ = static_cast< std::size_t >( fileStatus.st_size );
+
+    // Empty files can not be mapped, and need no storage
+    if( size_ > 0 )
+    {
+        void* mapping = mmap( nullptr, size_, PROT_READ, MAP_PRIVATE, fileDescriptor, 0 );
+        if( mapping != MAP_FAILED )
+        {
+            data_ = static_cast< const char* >( mapping );
+            isMapped_ = true;
+        }
+    }
+    close( fileDescriptor );
+
+    if( isMapped_ || size_ == 0 )
+    {
+        return;
+    }
+#endif
+
+    // Read full file into buffer, if it could not be mapped
+    std::ifstream fileStream( fileName, std::ios::binary | std::ios::ate );
+    if( !fileStream.is_open( ) )
+    {
+        throw std::runtime_error( "Error when reading file " + fileName + " into memory, file could not be opened." );
+    }
+    size_ = static_cast< std::size_t >( fileStream.tellg( ) );
+    readBuffer_.resize( ( size_ + sizeof( double ) - 1 ) / sizeof( double ) );
+    fileStream.seekg( 0 );
+    fileStream.read( reinterpret_cast< char* >( readBuffer_.data( ) ), size_ );
+    if( !fileStream )
+    {
+        throw std::runtime_error( "Error when reading file " + fileName + " into memory, file could not be read." );
+    }
+    data_ = reinterpret_cast< const char* >( readBuffer_.data( ) );
+}
+
+//! Destructor, unmaps the file
+MemoryMappedFile::~MemoryMappedFile( )
+{
+#if !defined( _WIN32 )
+    if( isMapped_ )
+    {
+        munmap( const_cast< char* >( data_ ), size_ );
+    }
+#endif
+}
+
+} // namespace input_output
+
+} // namespace tudat
@@ -366,6 +366,12 @@ void readCoefficientsFile(
 //! Function to retrieve the number of independent variables that the coefficients in a file are given for.
 int getNumberOfIndependentVariablesInCoefficientFile( const std::string& fileName )
 {
+    // Retrieve number of independent variables from header of binary file, if provided
+    if( isBinaryMultiArrayFile( fileName ) )
+    {
+        return BinaryMultiArrayFile( fileName ).getNumberOfIndependentVariables( );
+    }
+
     // Open file and create file stream.
     std::fstream stream( fileName.c_str( ), std::ios::in );
 
@@ -15,11 +15,15 @@
  *
  */
 
+#include <ctime>
 #include <istream>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <stdexcept>
 
+#include <boost/filesystem.hpp>
+
 #include "tudat/basics/testMacros.h"
 #include "tudat/io/solarActivityData.h"
 #include "tudat/io/parsedDataVectorUtilities.h"
@@ -120,18 +124,79 @@ SolarActivityDataMap readSolarActivityData( std::string filePath )
 
     // Save each line to datamap
     for(int i = 0 ; i < numberOfLines ; i++ ){
+        SolarActivityDataPtr currentSolarActivityData = solarActivityExtractor.extract( parsedDataVector->at( i ) );
         julianDate = tudat::basic_astrodynamics::convertCalendarDateToJulianDay(
-                    solarActivityExtractor.extract( parsedDataVector->at( i ) )->year,
-                    solarActivityExtractor.extract( parsedDataVector->at( i ) )->month,
-                    solarActivityExtractor.extract( parsedDataVector->at( i ) )->day,
+                    currentSolarActivityData->year,
+                    currentSolarActivityData->month,
+                    currentSolarActivityData->day,
                     0, 0, 0.0 ) ;
-        dataMap[ julianDate ] = solarActivityExtractor.extract( parsedDataVector->at( i ) ) ;
+        dataMap[ julianDate ] = currentSolarActivityData;
     }
 
     return dataMap;
 
 }
 
+//! Cached solar activity data of a single file, with the properties of the file from which it was read
+struct CachedSolarActivityData
+{
+    //! Size of the file (in bytes) when it was read
+    uintmax_t fileSize;
+
+    //! Modification time of the file when it was read
+    std::time_t modificationTime;
+
+    //! Solar activity data read from the file
+    std::shared_ptr< SolarActivityContainer > solarActivityContainer;
+};
+
+//! Cache of solar activity data, with file path as key, and mutex for its access
+struct SolarActivityDataCache
+{
+    std::mutex cacheMutex;
+
+    std::map< std::string, CachedSolarActivityData > cachedData;
+};
+
+//! Function to retrieve the (process-wide) cache of solar activity data, created on first use
+static SolarActivityDataCache& getSolarActivityDataCache( )
+{
+    static SolarActivityDataCache solarActivityDataCache;
+    return solarActivityDataCache;
+}
+
+//! Function to load a SpaceWeather data file, sharing a single copy of the data of each file within the process
+std::shared_ptr< SolarActivityContainer > loadSolarActivityData( const std::string& filePath )
+{
+    boost::system::error_code errorCode;
+    uintmax_t fileSize = boost::filesystem::file_size( filePath, errorCode );
+    std::time_t modificationTime = errorCode ? 0 : boost::filesystem::last_write_time( filePath, errorCode );
+
+    // Parse file if it is not yet in the cache, or if it has changed since it was parsed. The lock is held while
+    // parsing, so that concurrent requests for the same file wait for the result instead of parsing it again.
+    SolarActivityDataCache& solarActivityDataCache = getSolarActivityDataCache( );
+    std::lock_guard< std::mutex > cacheLock( solarActivityDataCache.cacheMutex );
+    auto cacheIterator = solarActivityDataCache.cachedData.find( filePath );
+    if( cacheIterator == solarActivityDataCache.cachedData.end( ) || errorCode ||
+            cacheIterator->second.fileSize != fileSize || cacheIterator->second.modificationTime != modificationTime )
+    {
+        CachedSolarActivityData cachedData;
+        cachedData.fileSize = fileSize;
+        cachedData.modificationTime = modificationTime;
+        cachedData.solarActivityContainer = std::make_shared< SolarActivityContainer >( readSolarActivityData( filePath ) );
+        cacheIterator = solarActivityDataCache.cachedData.insert_or_assign( filePath, cachedData ).first;
+    }
+    return cacheIterator->second.solarActivityContainer;
+}
+
+//! Function to clear the cache of solar activity data used by loadSolarActivityData
+void clearSolarActivityDataCache( )
+{
+    SolarActivityDataCache& solarActivityDataCache = getSolarActivityDataCache( );
+    std::lock_guard< std::mutex > cacheLock( solarActivityDataCache.cacheMutex );
+    solarActivityDataCache.cachedData.clear( );
+}
+
 } // solar_activity
 } // input_output
 } // tudat
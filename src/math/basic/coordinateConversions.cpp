@@ -117,6 +117,46 @@ Eigen::Vector6d convertCylindricalToCartesianState(
     return cartesianState;
 }
 
+//! Convert a batch of spherical (radius, zenith, azimuth) to Cartesian (x,y,z) coordinates.
+Eigen::Matrix3Xd convertSphericalToCartesianBatch( const Eigen::Matrix3Xd& sphericalCoordinates )
+{
+    Eigen::Matrix3Xd cartesianCoordinates( 3, sphericalCoordinates.cols( ) );
+
+    Eigen::ArrayXd radius = sphericalCoordinates.row( 0 ).transpose( ).array( );
+    Eigen::ArrayXd zenithAngle = sphericalCoordinates.row( 1 ).transpose( ).array( );
+    Eigen::ArrayXd azimuthAngle = sphericalCoordinates.row( 2 ).transpose( ).array( );
+    Eigen::ArrayXd radiusTimesSineOfZenithAngle = radius * zenithAngle.sin( );
+
+    cartesianCoordinates.row( 0 ).array( ) = radiusTimesSineOfZenithAngle * azimuthAngle.cos( );
+    cartesianCoordinates.row( 1 ).array( ) = radiusTimesSineOfZenithAngle * azimuthAngle.sin( );
+    cartesianCoordinates.row( 2 ).array( ) = radius * zenithAngle.cos( );
+
+    return cartesianCoordinates;
+}
+
+//! Convert a batch of Cartesian (x,y,z) to spherical (radius, zenith, azimuth) coordinates.
+Eigen::Matrix3Xd convertCartesianToSphericalBatch( const Eigen::Matrix3Xd& cartesianCoordinates )
+{
+    Eigen::Matrix3Xd sphericalCoordinates( 3, cartesianCoordinates.cols( ) );
+
+    Eigen::ArrayXd radius = cartesianCoordinates.colwise( ).norm( ).array( ).transpose( );
+    Eigen::ArrayXd isAtOrigin = ( radius < std::numeric_limits< double >::epsilon( ) ).cast< double >( );
+
+    // Set zenith and azimuth to zero for points at origin (for which radius is replaced by 1 to prevent division by 0)
+    sphericalCoordinates.row( 0 ).array( ) = radius;
+    sphericalCoordinates.row( 1 ).array( ) =
+            ( 1.0 - isAtOrigin ) * ( cartesianCoordinates.row( 2 ).transpose( ).array( ) / ( radius + isAtOrigin ) ).
+            min( 1.0 ).max( -1.0 ).acos( );
+    sphericalCoordinates.row( 2 ).array( ) =
+            cartesianCoordinates.row( 1 ).array( ).binaryExpr(
+                cartesianCoordinates.row( 0 ).array( ), [ ]( const double numerator, const double denominator )
+    {
+        return std::atan2( numerator, denominator );
+    } );
+
+    return sphericalCoordinates;
+}
+
 //! Convert Cartesian to cylindrical coordinates.
 Eigen::Vector3d convertCartesianToCylindrical( const Eigen::Vector3d& cartesianCoordinates )
 {
@@ -0,0 +1,24 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include "tudat/math/basic/kdTree.h"
+
+namespace tudat
+{
+namespace basic_mathematics
+{
+
+template class KdTree< 3 >;
+template class KdTree< Eigen::Dynamic >;
+
+} // namespace basic_mathematics
+
+} // namespace tudat
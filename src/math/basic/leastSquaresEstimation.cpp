@@ -11,9 +11,14 @@
 
 #include <cmath>
 #include <iostream>
+#include <limits>
+#include <string>
 
+#include <Eigen/Cholesky>
 #include <Eigen/LU>
+#include <Eigen/QR>
 
+#include "tudat/basics/parallelization.h"
 #include "tudat/basics/utilities.h"
 #include "tudat/math/basic/leastSquaresEstimation.h"
 
@@ -24,22 +29,44 @@ namespace linear_algebra
 {
 
 //! Function to get condition number of matrix (using SVD decomposition)
-double getConditionNumberOfDesignMatrix( const Eigen::MatrixXd designMatrix )
+double getConditionNumberOfDesignMatrix( const Eigen::MatrixXd& designMatrix )
 {
-    return getConditionNumberOfDecomposedMatrix(
-                ( designMatrix.jacobiSvd( Eigen::ComputeThinU | Eigen::ComputeFullV ) ) );
+    // Only singular values are required, singular vectors are not computed
+    return getConditionNumberFromSingularValues( Eigen::JacobiSVD< Eigen::MatrixXd >( designMatrix ).singularValues( ) );
 }
 
 //! Function to get condition number of matrix from SVD decomposition
 double getConditionNumberOfDecomposedMatrix( const Eigen::JacobiSVD< Eigen::MatrixXd >& singularValueDecomposition )
 {
-    Eigen::VectorXd singularValues = singularValueDecomposition.singularValues( );
+    return getConditionNumberFromSingularValues( singularValueDecomposition.singularValues( ) );
+}
+
+//! Function to get condition number of matrix from singular values
+double getConditionNumberFromSingularValues( const Eigen::VectorXd& singularValues )
+{
     return singularValues( 0 ) / singularValues( singularValues.rows( ) - 1 );
 }
 
+//! Function to estimate the condition number of a matrix from its column-pivoting QR decomposition
+double estimateConditionNumberOfQrDecomposedMatrix( const Eigen::ColPivHouseholderQR< Eigen::MatrixXd >& qrDecomposition )
+{
+    // Diagonal entries of R are in order of decreasing magnitude due to column pivoting
+    Eigen::VectorXd diagonalOfR = qrDecomposition.matrixR( ).diagonal( ).cwiseAbs( );
+    return diagonalOfR( 0 ) / diagonalOfR( diagonalOfR.rows( ) - 1 );
+}
+
+//! Function to print a warning if the condition number exceeds the limit value
+void checkConditionNumber( const double conditionNumber, const double limitConditionNumberForWarning )
+{
+    if( conditionNumber > limitConditionNumberForWarning )
+    {
+        std::cerr << "Warning when performing least squares, condition number is " << conditionNumber << std::endl;
+    }
+}
+
 //! Solve system of equations with SVD decomposition, checking condition number in the process
-Eigen::VectorXd solveSystemOfEquationsWithSvd( const Eigen::MatrixXd matrixToInvert,
-                                               const Eigen::VectorXd rightHandSideVector,
+Eigen::VectorXd solveSystemOfEquationsWithSvd( const Eigen::MatrixXd& matrixToInvert,
+                                               const Eigen::VectorXd& rightHandSideVector,
                                                const double limitConditionNumberForWarning )
 {
     Eigen::JacobiSVD< Eigen::MatrixXd > svdDecomposition = matrixToInvert.jacobiSvd(
@@ -56,6 +83,76 @@ Eigen::VectorXd solveSystemOfEquationsWithSvd( const Eigen::MatrixXd matrixToInv
     return svdDecomposition.solve( rightHandSideVector );
 }
 
+//! Solve system of equations with selected linear solver, checking condition number in the process
+Eigen::VectorXd solveSystemOfEquations( const Eigen::MatrixXd& matrixToInvert,
+                                        const Eigen::VectorXd& rightHandSideVector,
+                                        const LinearSolverType solverType,
+                                        const double limitConditionNumberForWarning )
+{
+    bool checkCondition = ( limitConditionNumberForWarning == limitConditionNumberForWarning );
+
+    Eigen::VectorXd solution;
+    switch( solverType )
+    {
+    case jacobi_svd_solver:
+        solution = solveSystemOfEquationsWithSvd( matrixToInvert, rightHandSideVector, limitConditionNumberForWarning );
+        break;
+    case bdc_svd_solver:
+    {
+        Eigen::BDCSVD< Eigen::MatrixXd > svdDecomposition( matrixToInvert, Eigen::ComputeThinU | Eigen::ComputeThinV );
+        if( checkCondition )
+        {
+            checkConditionNumber( getConditionNumberFromSingularValues( svdDecomposition.singularValues( ) ),
+                                  limitConditionNumberForWarning );
+        }
+        solution = svdDecomposition.solve( rightHandSideVector );
+        break;
+    }
+    case llt_solver:
+    {
+        Eigen::LLT< Eigen::MatrixXd > decomposition( matrixToInvert );
+        if( decomposition.info( ) != Eigen::Success )
+        {
+            throw std::runtime_error( "Error when solving system of equations with Cholesky decomposition, matrix is not positive definite" );
+        }
+        if( checkCondition )
+        {
+            checkConditionNumber( 1.0 / decomposition.rcond( ), limitConditionNumberForWarning );
+        }
+        solution = decomposition.solve( rightHandSideVector );
+        break;
+    }
+    case ldlt_solver:
+    {
+        Eigen::LDLT< Eigen::MatrixXd > decomposition( matrixToInvert );
+        if( decomposition.info( ) != Eigen::Success )
+        {
+            throw std::runtime_error( "Error when solving system of equations with LDLT decomposition, decomposition failed" );
+        }
+        if( checkCondition )
+        {
+            checkConditionNumber( 1.0 / decomposition.rcond( ), limitConditionNumberForWarning );
+        }
+        solution = decomposition.solve( rightHandSideVector );
+        break;
+    }
+    case column_pivoting_qr_solver:
+    {
+        Eigen::ColPivHouseholderQR< Eigen::MatrixXd > decomposition( matrixToInvert );
+        if( checkCondition )
+        {
+            checkConditionNumber( estimateConditionNumberOfQrDecomposedMatrix( decomposition ), limitConditionNumberForWarning );
+        }
+        solution = decomposition.solve( rightHandSideVector );
+        break;
+    }
+    default:
+        throw std::runtime_error( "Error when solving system of equations, linear solver type " +
+                                  std::to_string( solverType ) + " not recognized" );
+    }
+    return solution;
+}
+
 //! Function to multiply information matrix by diagonal weights matrix
 Eigen::MatrixXd multiplyDesignMatrixByDiagonalWeightMatrix(
         const Eigen::MatrixXd& designMatrix,
@@ -72,18 +169,15 @@ Eigen::MatrixXd multiplyDesignMatrixByDiagonalWeightMatrix(
     return weightedDesignMatrix;
 }
 
-Eigen::MatrixXd calculateInverseOfUpdatedCovarianceMatrix(
-        const Eigen::MatrixXd& designMatrix,
-        const Eigen::VectorXd& diagonalOfWeightMatrix,
+//! Function to compute inverse of covariance matrix at current iteration from the normal matrix of the observations
+Eigen::MatrixXd calculateInverseOfUpdatedCovarianceMatrixFromNormalMatrix(
+        const Eigen::MatrixXd& normalMatrix,
         const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
         const Eigen::MatrixXd& constraintMultiplier,
-        const Eigen::VectorXd& constraintRightHandside,
-        const double limitConditionNumberForWarning )
+        const Eigen::VectorXd& constraintRightHandside )
 {
     // Add constraints to inverse covariance matrix if required
-    Eigen::MatrixXd inverseOfCovarianceMatrix =
-            inverseOfAPrioriCovarianceMatrix + designMatrix.transpose( ) * multiplyDesignMatrixByDiagonalWeightMatrix(
-                designMatrix, diagonalOfWeightMatrix );
+    Eigen::MatrixXd inverseOfCovarianceMatrix = inverseOfAPrioriCovarianceMatrix + normalMatrix;
     if( constraintMultiplier.rows( ) != 0 )
     {
         if( constraintMultiplier.rows( ) != constraintRightHandside.rows( ) )
@@ -91,7 +185,7 @@ Eigen::MatrixXd calculateInverseOfUpdatedCovarianceMatrix(
             throw std::runtime_error( "Error when performing constrained least-squares, constraints are incompatible" );
         }
 
-        if( constraintMultiplier.cols( ) != designMatrix.cols( ) )
+        if( constraintMultiplier.cols( ) != normalMatrix.cols( ) )
         {
             throw std::runtime_error( "Error when performing constrained least-squares, constraints are incompatible with partials" );
         }
@@ -110,7 +204,19 @@ Eigen::MatrixXd calculateInverseOfUpdatedCovarianceMatrix(
     }
 
     return inverseOfCovarianceMatrix;
+}
 
+Eigen::MatrixXd calculateInverseOfUpdatedCovarianceMatrix(
+        const Eigen::MatrixXd& designMatrix,
+        const Eigen::VectorXd& diagonalOfWeightMatrix,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const Eigen::MatrixXd& constraintMultiplier,
+        const Eigen::VectorXd& constraintRightHandside,
+        const double limitConditionNumberForWarning )
+{
+    return calculateInverseOfUpdatedCovarianceMatrixFromNormalMatrix(
+                designMatrix.transpose( ) * multiplyDesignMatrixByDiagonalWeightMatrix( designMatrix, diagonalOfWeightMatrix ),
+                inverseOfAPrioriCovarianceMatrix, constraintMultiplier, constraintRightHandside );
 }
 
 
@@ -138,6 +244,107 @@ Eigen::MatrixXd calculateConsiderParametersCovarianceContribution(
     * ( considerDesignMatrix.transpose( ) * covarianceTimesWeightedPartials.transpose( ) );
 }
 
+//! Function to compute the contribution of consider parameters to the covariance from the normal matrices
+Eigen::MatrixXd calculateConsiderParametersCovarianceContributionFromNormalMatrix(
+        const Eigen::MatrixXd& normalisedCovarianceMatrix,
+        const Eigen::MatrixXd& considerNormalMatrix,
+        const Eigen::MatrixXd& considerCovariance )
+{
+    Eigen::MatrixXd covarianceTimesConsiderNormalMatrix = normalisedCovarianceMatrix * considerNormalMatrix;
+    return covarianceTimesConsiderNormalMatrix * considerCovariance * covarianceTimesConsiderNormalMatrix.transpose( );
+}
+
+//! Function to perform an iteration of least squares estimation from the normal equations and a priori information
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromInformationMatrix(
+        const Eigen::MatrixXd& normalMatrix,
+        const Eigen::VectorXd& rightHandSide,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const double limitConditionNumberForWarning,
+        const Eigen::MatrixXd& constraintMultiplier,
+        const Eigen::VectorXd& constraintRightHandside,
+        const LinearSolverType solverType )
+{
+    if( solverType == llt_solver && constraintMultiplier.rows( ) != 0 )
+    {
+        throw std::runtime_error( "Error when performing constrained least-squares, Cholesky solver can not be used with constraints" );
+    }
+
+    Eigen::MatrixXd inverseOfCovarianceMatrix = calculateInverseOfUpdatedCovarianceMatrixFromNormalMatrix(
+                normalMatrix, inverseOfAPrioriCovarianceMatrix, constraintMultiplier, constraintRightHandside );
+
+    // Add constraints to right-hand side if required
+    Eigen::VectorXd fullRightHandSide = rightHandSide;
+    if( constraintMultiplier.rows( ) != 0 )
+    {
+        int numberOfConstraints = constraintMultiplier.rows( );
+        int numberOfParameters = constraintMultiplier.cols( );
+
+        fullRightHandSide.conservativeResize( numberOfParameters + numberOfConstraints );
+        fullRightHandSide.segment( numberOfParameters, numberOfConstraints ) = constraintRightHandside;
+    }
+
+    return std::make_pair( solveSystemOfEquations(
+            inverseOfCovarianceMatrix, fullRightHandSide, solverType, limitConditionNumberForWarning ), inverseOfCovarianceMatrix );
+}
+
+//! Function to perform an iteration of least squares estimation by column-pivoting QR decomposition of the design matrix
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentWithQrDecomposition(
+        const Eigen::MatrixXd& designMatrix,
+        const Eigen::VectorXd& observationResiduals,
+        const Eigen::VectorXd& diagonalOfWeightMatrix,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const double limitConditionNumberForWarning,
+        const Eigen::MatrixXd& designMatrixConsiderParameters,
+        const Eigen::VectorXd& considerParametersDeviations )
+{
+    int numberOfObservations = designMatrix.rows( );
+    int numberOfParameters = designMatrix.cols( );
+
+    // Compute square root R^T R of a priori information matrix (if any), through LDLT decomposition P^T L D L^T P
+    Eigen::MatrixXd aprioriSquareRoot = Eigen::MatrixXd::Zero( 0, numberOfParameters );
+    if( !inverseOfAPrioriCovarianceMatrix.isZero( 0.0 ) )
+    {
+        Eigen::LDLT< Eigen::MatrixXd > aprioriDecomposition( inverseOfAPrioriCovarianceMatrix );
+        if( aprioriDecomposition.info( ) != Eigen::Success || ( aprioriDecomposition.vectorD( ).array( ) < 0.0 ).any( ) )
+        {
+            throw std::runtime_error( "Error when performing least squares with QR decomposition, a priori information matrix is not positive semi-definite" );
+        }
+        Eigen::MatrixXd permutationMatrix = aprioriDecomposition.transpositionsP( ) *
+                Eigen::MatrixXd::Identity( numberOfParameters, numberOfParameters );
+        Eigen::MatrixXd lowerTriangularFactor = aprioriDecomposition.matrixL( );
+        aprioriSquareRoot = aprioriDecomposition.vectorD( ).cwiseSqrt( ).asDiagonal( ) *
+                lowerTriangularFactor.transpose( ) * permutationMatrix;
+    }
+
+    // Set up weighted design matrix and residuals, augmented with a priori information
+    Eigen::VectorXd weightsSquareRoot = diagonalOfWeightMatrix.cwiseSqrt( );
+    Eigen::MatrixXd augmentedDesignMatrix = Eigen::MatrixXd( numberOfObservations + aprioriSquareRoot.rows( ), numberOfParameters );
+    augmentedDesignMatrix << weightsSquareRoot.asDiagonal( ) * designMatrix, aprioriSquareRoot;
+
+    Eigen::VectorXd augmentedResiduals = Eigen::VectorXd::Zero( augmentedDesignMatrix.rows( ) );
+    if ( considerParametersDeviations.size( ) > 0 && designMatrixConsiderParameters.size( ) > 0 )
+    {
+        augmentedResiduals.segment( 0, numberOfObservations ) = weightsSquareRoot.cwiseProduct(
+                    observationResiduals + designMatrixConsiderParameters * considerParametersDeviations );
+    }
+    else
+    {
+        augmentedResiduals.segment( 0, numberOfObservations ) = weightsSquareRoot.cwiseProduct( observationResiduals );
+    }
+
+    // Solve least squares problem (condition number of normal matrix is square of that of design matrix)
+    Eigen::ColPivHouseholderQR< Eigen::MatrixXd > qrDecomposition( augmentedDesignMatrix );
+    if( limitConditionNumberForWarning == limitConditionNumberForWarning )
+    {
+        double designMatrixConditionNumber = estimateConditionNumberOfQrDecomposedMatrix( qrDecomposition );
+        checkConditionNumber( designMatrixConditionNumber * designMatrixConditionNumber, limitConditionNumberForWarning );
+    }
+
+    return std::make_pair( Eigen::VectorXd( qrDecomposition.solve( augmentedResiduals ) ),
+                           calculateInverseOfUpdatedCovarianceMatrix(
+                               designMatrix, diagonalOfWeightMatrix, inverseOfAPrioriCovarianceMatrix ) );
+}
+
 //! Function to perform an iteration least squares estimation from information matrix, weights and residuals and a priori
 //! information
 std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromDesignMatrix(
@@ -149,9 +356,17 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromD
         const Eigen::MatrixXd& constraintMultiplier,
         const Eigen::VectorXd& constraintRightHandside,
         const Eigen::MatrixXd& designMatrixConsiderParameters,
-        const Eigen::VectorXd& considerParametersDeviations )
+        const Eigen::VectorXd& considerParametersDeviations,
+        const LinearSolverType solverType )
 {
-    Eigen::VectorXd rightHandSide = Eigen::VectorXd::Zero( observationResiduals.size( ) );
+    if( solverType == column_pivoting_qr_solver && constraintMultiplier.rows( ) == 0 )
+    {
+        return performLeastSquaresAdjustmentWithQrDecomposition(
+                    designMatrix, observationResiduals, diagonalOfWeightMatrix, inverseOfAPrioriCovarianceMatrix,
+                    limitConditionNumberForWarning, designMatrixConsiderParameters, considerParametersDeviations );
+    }
+
+    Eigen::VectorXd rightHandSide;
     if ( considerParametersDeviations.size( ) > 0 && designMatrixConsiderParameters.size( ) > 0 )
     {
         rightHandSide = designMatrix.transpose( ) *
@@ -162,23 +377,10 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromD
         rightHandSide = designMatrix.transpose( ) * ( diagonalOfWeightMatrix.cwiseProduct( observationResiduals ) );
     }
 
-    Eigen::MatrixXd inverseOfCovarianceMatrix = calculateInverseOfUpdatedCovarianceMatrix(
-                designMatrix, diagonalOfWeightMatrix, inverseOfAPrioriCovarianceMatrix,
-                constraintMultiplier, constraintRightHandside );
-
-    // Add constraints to inverse covariance matrix if required
-    if( constraintMultiplier.rows( ) != 0 )
-    {
-        int numberOfConstraints = constraintMultiplier.rows( );
-        int numberOfParameters = constraintMultiplier.cols( );
-
-        rightHandSide.conservativeResize( numberOfParameters + numberOfConstraints );
-        rightHandSide.segment( numberOfParameters, numberOfConstraints ) = constraintRightHandside;
-    }
-
-    return std::make_pair( solveSystemOfEquationsWithSvd(
-            inverseOfCovarianceMatrix, rightHandSide, limitConditionNumberForWarning ), inverseOfCovarianceMatrix );
-
+    return performLeastSquaresAdjustmentFromInformationMatrix(
+                designMatrix.transpose( ) * multiplyDesignMatrixByDiagonalWeightMatrix( designMatrix, diagonalOfWeightMatrix ),
+                rightHandSide, inverseOfAPrioriCovarianceMatrix, limitConditionNumberForWarning,
+                constraintMultiplier, constraintRightHandside, solverType );
 }
 
 //! Function to perform an iteration least squares estimation from information matrix, weights and residuals
@@ -245,6 +447,617 @@ std::vector< double > getLeastSquaresPolynomialFit(
 
 }
 
+//! Constructor
+NormalEquationsAccumulator::NormalEquationsAccumulator( const int numberOfParameters ):
+    normalMatrix_( Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters ) ),
+    rightHandSide_( Eigen::VectorXd::Zero( numberOfParameters ) ),
+    designMatrixColumnMinima_( Eigen::VectorXd::Zero( numberOfParameters ) ),
+    designMatrixColumnMaxima_( Eigen::VectorXd::Zero( numberOfParameters ) ),
+    numberOfObservations_( 0 ){ }
+
+//! Function to add the contribution of a block of observations to the normal equations
+void NormalEquationsAccumulator::addObservations(
+        const Eigen::Ref< const Eigen::MatrixXd >& designMatrixBlock,
+        const Eigen::Ref< const Eigen::VectorXd >& residualsBlock,
+        const Eigen::Ref< const Eigen::VectorXd >& weightsBlock,
+        const std::vector< int >& nonZeroColumns )
+{
+    if( designMatrixBlock.cols( ) != normalMatrix_.cols( ) )
+    {
+        throw std::runtime_error( "Error when accumulating normal equations, number of parameters is inconsistent" );
+    }
+
+    if( designMatrixBlock.rows( ) != residualsBlock.rows( ) || designMatrixBlock.rows( ) != weightsBlock.rows( ) )
+    {
+        throw std::runtime_error( "Error when accumulating normal equations, number of observations is inconsistent" );
+    }
+
+    if( designMatrixBlock.rows( ) == 0 )
+    {
+        return;
+    }
+
+    if( nonZeroColumns.size( ) == 0 )
+    {
+        Eigen::MatrixXd weightedDesignMatrixBlock = weightsBlock.asDiagonal( ) * designMatrixBlock;
+        normalMatrix_.noalias( ) += designMatrixBlock.transpose( ) * weightedDesignMatrixBlock;
+        rightHandSide_.noalias( ) += weightedDesignMatrixBlock.transpose( ) * residualsBlock;
+    }
+    else
+    {
+        // Only add the blocks of the normal equations associated with the non-zero columns
+        Eigen::MatrixXd reducedDesignMatrixBlock = designMatrixBlock( Eigen::all, nonZeroColumns );
+        Eigen::MatrixXd weightedDesignMatrixBlock = weightsBlock.asDiagonal( ) * reducedDesignMatrixBlock;
+        normalMatrix_( nonZeroColumns, nonZeroColumns ) += reducedDesignMatrixBlock.transpose( ) * weightedDesignMatrixBlock;
+        rightHandSide_( nonZeroColumns ) += weightedDesignMatrixBlock.transpose( ) * residualsBlock;
+    }
+
+    // Update extreme values of design matrix columns (first block initializes the values)
+    if( numberOfObservations_ == 0 )
+    {
+        designMatrixColumnMinima_ = designMatrixBlock.colwise( ).minCoeff( ).transpose( );
+        designMatrixColumnMaxima_ = designMatrixBlock.colwise( ).maxCoeff( ).transpose( );
+    }
+    else
+    {
+        designMatrixColumnMinima_ = designMatrixColumnMinima_.cwiseMin( designMatrixBlock.colwise( ).minCoeff( ).transpose( ) );
+        designMatrixColumnMaxima_ = designMatrixColumnMaxima_.cwiseMax( designMatrixBlock.colwise( ).maxCoeff( ).transpose( ) );
+    }
+    numberOfObservations_ += designMatrixBlock.rows( );
+}
+
+//! Function to add the normal equations accumulated by another object (for the same parameters) to this object
+void NormalEquationsAccumulator::addNormalEquations( const NormalEquationsAccumulator& otherNormalEquations )
+{
+    if( otherNormalEquations.normalMatrix_.cols( ) != normalMatrix_.cols( ) )
+    {
+        throw std::runtime_error( "Error when combining normal equations, number of parameters is inconsistent" );
+    }
+
+    if( otherNormalEquations.numberOfObservations_ == 0 )
+    {
+        return;
+    }
+
+    normalMatrix_ += otherNormalEquations.normalMatrix_;
+    rightHandSide_ += otherNormalEquations.rightHandSide_;
+    if( numberOfObservations_ == 0 )
+    {
+        designMatrixColumnMinima_ = otherNormalEquations.designMatrixColumnMinima_;
+        designMatrixColumnMaxima_ = otherNormalEquations.designMatrixColumnMaxima_;
+    }
+    else
+    {
+        designMatrixColumnMinima_ = designMatrixColumnMinima_.cwiseMin( otherNormalEquations.designMatrixColumnMinima_ );
+        designMatrixColumnMaxima_ = designMatrixColumnMaxima_.cwiseMax( otherNormalEquations.designMatrixColumnMaxima_ );
+    }
+    numberOfObservations_ += otherNormalEquations.numberOfObservations_;
+}
+
+//! Function to compute the normalization terms of the columns of the design matrix from their extreme values
+Eigen::VectorXd getNormalizationTermsFromColumnExtrema(
+        const Eigen::VectorXd& designMatrixColumnMinima,
+        const Eigen::VectorXd& designMatrixColumnMaxima )
+{
+    Eigen::VectorXd normalizationTerms = Eigen::VectorXd( designMatrixColumnMinima.rows( ) );
+    for( int i = 0; i < designMatrixColumnMinima.rows( ); i++ )
+    {
+        if( std::fabs( designMatrixColumnMinima( i ) ) > designMatrixColumnMaxima( i ) )
+        {
+            normalizationTerms( i ) = designMatrixColumnMinima( i );
+        }
+        else
+        {
+            normalizationTerms( i ) = designMatrixColumnMaxima( i );
+        }
+        if( normalizationTerms( i ) == 0.0 )
+        {
+            normalizationTerms( i ) = 1.0;
+        }
+    }
+    return normalizationTerms;
+}
+
+//! Function to compute the normalization terms of the columns of the design matrix
+Eigen::VectorXd NormalEquationsAccumulator::getNormalizationTerms( ) const
+{
+    return getNormalizationTermsFromColumnExtrema( designMatrixColumnMinima_, designMatrixColumnMaxima_ );
+}
+
+//! Constructor
+ArcWiseNormalEquationsAccumulator::ArcWiseNormalEquationsAccumulator(
+        const int numberOfParameters,
+        const std::vector< std::vector< int > >& arcLocalParameterIndices ):
+    numberOfParameters_( numberOfParameters ),
+    arcLocalParameterIndices_( arcLocalParameterIndices ),
+    parameterArcIndices_( numberOfParameters, -1 ),
+    designMatrixColumnMinima_( Eigen::VectorXd::Zero( numberOfParameters ) ),
+    designMatrixColumnMaxima_( Eigen::VectorXd::Zero( numberOfParameters ) ),
+    numberOfObservations_( 0 )
+{
+    // Determine arc of each parameter, and check consistency of input
+    for( unsigned int i = 0; i < arcLocalParameterIndices_.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < arcLocalParameterIndices_.at( i ).size( ); j++ )
+        {
+            int currentIndex = arcLocalParameterIndices_.at( i ).at( j );
+            if( currentIndex < 0 || currentIndex >= numberOfParameters_ )
+            {
+                throw std::runtime_error( "Error when creating arc-wise normal equations, local parameter index " +
+                                          std::to_string( currentIndex ) + " of arc " + std::to_string( i ) +
+                                          " is out of range" );
+            }
+            if( parameterArcIndices_.at( currentIndex ) >= 0 )
+            {
+                throw std::runtime_error( "Error when creating arc-wise normal equations, parameter " +
+                                          std::to_string( currentIndex ) + " is local to more than one arc" );
+            }
+            parameterArcIndices_[ currentIndex ] = i;
+        }
+    }
+
+    for( int i = 0; i < numberOfParameters_; i++ )
+    {
+        if( parameterArcIndices_.at( i ) < 0 )
+        {
+            globalParameterIndices_.push_back( i );
+        }
+        else
+        {
+            localParameterIndices_.push_back( i );
+        }
+    }
+
+    parameterBlockIndices_.resize( numberOfParameters_ );
+    for( unsigned int i = 0; i < globalParameterIndices_.size( ); i++ )
+    {
+        parameterBlockIndices_[ globalParameterIndices_.at( i ) ] = i;
+    }
+    for( unsigned int i = 0; i < arcLocalParameterIndices_.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < arcLocalParameterIndices_.at( i ).size( ); j++ )
+        {
+            parameterBlockIndices_[ arcLocalParameterIndices_.at( i ).at( j ) ] = j;
+        }
+    }
+
+    // Initialize normal equation blocks
+    int numberOfGlobalParameters = globalParameterIndices_.size( );
+    globalNormalMatrix_ = Eigen::MatrixXd::Zero( numberOfGlobalParameters, numberOfGlobalParameters );
+    globalRightHandSide_ = Eigen::VectorXd::Zero( numberOfGlobalParameters );
+    for( unsigned int i = 0; i < arcLocalParameterIndices_.size( ); i++ )
+    {
+        int numberOfLocalParameters = arcLocalParameterIndices_.at( i ).size( );
+        arcLocalNormalMatrices_.push_back( Eigen::MatrixXd::Zero( numberOfLocalParameters, numberOfLocalParameters ) );
+        arcLocalGlobalNormalMatrices_.push_back( Eigen::MatrixXd::Zero( numberOfLocalParameters, numberOfGlobalParameters ) );
+        arcLocalRightHandSides_.push_back( Eigen::VectorXd::Zero( numberOfLocalParameters ) );
+    }
+}
+
+//! Function to add the contribution of a block of observations to the normal equations
+void ArcWiseNormalEquationsAccumulator::addObservations(
+        const Eigen::Ref< const Eigen::MatrixXd >& designMatrixBlock,
+        const Eigen::Ref< const Eigen::VectorXd >& residualsBlock,
+        const Eigen::Ref< const Eigen::VectorXd >& weightsBlock,
+        const std::vector< int >& nonZeroColumns )
+{
+    if( designMatrixBlock.cols( ) != numberOfParameters_ )
+    {
+        throw std::runtime_error( "Error when accumulating arc-wise normal equations, number of parameters is inconsistent" );
+    }
+
+    if( designMatrixBlock.rows( ) != residualsBlock.rows( ) || designMatrixBlock.rows( ) != weightsBlock.rows( ) )
+    {
+        throw std::runtime_error( "Error when accumulating arc-wise normal equations, number of observations is inconsistent" );
+    }
+
+    if( designMatrixBlock.rows( ) == 0 )
+    {
+        return;
+    }
+
+    // Select the (possibly) non-zero columns of the global and local parameters, with their indices in the blocks
+    std::vector< int > globalColumns, globalBlockIndices, localColumns;
+    std::vector< std::vector< int > > arcLocalColumns, arcLocalBlockIndices;
+    if( nonZeroColumns.size( ) == 0 )
+    {
+        globalColumns = globalParameterIndices_;
+        localColumns = localParameterIndices_;
+        arcLocalColumns = arcLocalParameterIndices_;
+        globalBlockIndices.resize( globalColumns.size( ) );
+        for( unsigned int i = 0; i < globalColumns.size( ); i++ )
+        {
+            globalBlockIndices[ i ] = i;
+        }
+        arcLocalBlockIndices.resize( arcLocalColumns.size( ) );
+        for( unsigned int i = 0; i < arcLocalColumns.size( ); i++ )
+        {
+            for( unsigned int j = 0; j < arcLocalColumns.at( i ).size( ); j++ )
+            {
+                arcLocalBlockIndices[ i ].push_back( j );
+            }
+        }
+    }
+    else
+    {
+        arcLocalColumns.resize( arcLocalParameterIndices_.size( ) );
+        arcLocalBlockIndices.resize( arcLocalParameterIndices_.size( ) );
+        for( unsigned int i = 0; i < nonZeroColumns.size( ); i++ )
+        {
+            int currentColumn = nonZeroColumns.at( i );
+            if( currentColumn < 0 || currentColumn >= numberOfParameters_ )
+            {
+                throw std::runtime_error( "Error when accumulating arc-wise normal equations, non-zero column index " +
+                                          std::to_string( currentColumn ) + " is out of range" );
+            }
+
+            int parameterArc = parameterArcIndices_.at( currentColumn );
+            if( parameterArc < 0 )
+            {
+                globalColumns.push_back( currentColumn );
+                globalBlockIndices.push_back( parameterBlockIndices_.at( currentColumn ) );
+            }
+            else
+            {
+                localColumns.push_back( currentColumn );
+                arcLocalColumns[ parameterArc ].push_back( currentColumn );
+                arcLocalBlockIndices[ parameterArc ].push_back( parameterBlockIndices_.at( currentColumn ) );
+            }
+        }
+    }
+
+    // Determine arc of each observation from its non-zero partials w.r.t. local parameters
+    std::vector< std::vector< int > > arcObservationIndices( arcLocalParameterIndices_.size( ) );
+    for( int i = 0; i < designMatrixBlock.rows( ); i++ )
+    {
+        int currentArc = -1;
+        for( unsigned int j = 0; j < localColumns.size( ); j++ )
+        {
+            if( designMatrixBlock( i, localColumns[ j ] ) != 0.0 )
+            {
+                int parameterArc = parameterArcIndices_[ localColumns[ j ] ];
+                if( currentArc < 0 )
+                {
+                    currentArc = parameterArc;
+                }
+                else if( currentArc != parameterArc )
+                {
+                    throw std::runtime_error( "Error when accumulating arc-wise normal equations, observation depends on local parameters of arcs " +
+                                              std::to_string( currentArc ) + " and " + std::to_string( parameterArc ) );
+                }
+            }
+        }
+        if( currentArc >= 0 )
+        {
+            arcObservationIndices[ currentArc ].push_back( i );
+        }
+    }
+
+    // Add contribution of all observations to global blocks
+    Eigen::MatrixXd globalDesignMatrixBlock = designMatrixBlock( Eigen::all, globalColumns );
+    Eigen::MatrixXd weightedGlobalDesignMatrixBlock = weightsBlock.asDiagonal( ) * globalDesignMatrixBlock;
+    globalNormalMatrix_( globalBlockIndices, globalBlockIndices ) +=
+            globalDesignMatrixBlock.transpose( ) * weightedGlobalDesignMatrixBlock;
+    globalRightHandSide_( globalBlockIndices ) += weightedGlobalDesignMatrixBlock.transpose( ) * residualsBlock;
+
+    // Add contribution of observations of each arc to local blocks of that arc
+    for( unsigned int i = 0; i < arcObservationIndices.size( ); i++ )
+    {
+        if( arcObservationIndices.at( i ).size( ) == 0 )
+        {
+            continue;
+        }
+
+        Eigen::VectorXd arcWeights = weightsBlock( arcObservationIndices.at( i ) );
+        Eigen::MatrixXd localDesignMatrixBlock = designMatrixBlock( arcObservationIndices.at( i ), arcLocalColumns.at( i ) );
+        Eigen::MatrixXd weightedLocalDesignMatrixBlock = arcWeights.asDiagonal( ) * localDesignMatrixBlock;
+        arcLocalNormalMatrices_[ i ]( arcLocalBlockIndices.at( i ), arcLocalBlockIndices.at( i ) ) +=
+                weightedLocalDesignMatrixBlock.transpose( ) * localDesignMatrixBlock;
+        arcLocalGlobalNormalMatrices_[ i ]( arcLocalBlockIndices.at( i ), globalBlockIndices ) +=
+                weightedLocalDesignMatrixBlock.transpose( ) * globalDesignMatrixBlock( arcObservationIndices.at( i ), Eigen::all );
+        arcLocalRightHandSides_[ i ]( arcLocalBlockIndices.at( i ) ) +=
+                weightedLocalDesignMatrixBlock.transpose( ) * residualsBlock( arcObservationIndices.at( i ) );
+    }
+
+    // Update extreme values of design matrix columns (first block initializes the values)
+    if( numberOfObservations_ == 0 )
+    {
+        designMatrixColumnMinima_ = designMatrixBlock.colwise( ).minCoeff( ).transpose( );
+        designMatrixColumnMaxima_ = designMatrixBlock.colwise( ).maxCoeff( ).transpose( );
+    }
+    else
+    {
+        designMatrixColumnMinima_ = designMatrixColumnMinima_.cwiseMin( designMatrixBlock.colwise( ).minCoeff( ).transpose( ) );
+        designMatrixColumnMaxima_ = designMatrixColumnMaxima_.cwiseMax( designMatrixBlock.colwise( ).maxCoeff( ).transpose( ) );
+    }
+    numberOfObservations_ += designMatrixBlock.rows( );
+}
+
+//! Function to add the normal equations accumulated by another object (for the same parameters) to this object
+void ArcWiseNormalEquationsAccumulator::addNormalEquations( const ArcWiseNormalEquationsAccumulator& otherNormalEquations )
+{
+    if( otherNormalEquations.numberOfParameters_ != numberOfParameters_ ||
+            otherNormalEquations.arcLocalParameterIndices_ != arcLocalParameterIndices_ )
+    {
+        throw std::runtime_error( "Error when combining arc-wise normal equations, parameters are inconsistent" );
+    }
+
+    if( otherNormalEquations.numberOfObservations_ == 0 )
+    {
+        return;
+    }
+
+    globalNormalMatrix_ += otherNormalEquations.globalNormalMatrix_;
+    globalRightHandSide_ += otherNormalEquations.globalRightHandSide_;
+    for( unsigned int i = 0; i < arcLocalParameterIndices_.size( ); i++ )
+    {
+        arcLocalNormalMatrices_[ i ] += otherNormalEquations.arcLocalNormalMatrices_[ i ];
+        arcLocalGlobalNormalMatrices_[ i ] += otherNormalEquations.arcLocalGlobalNormalMatrices_[ i ];
+        arcLocalRightHandSides_[ i ] += otherNormalEquations.arcLocalRightHandSides_[ i ];
+    }
+
+    if( numberOfObservations_ == 0 )
+    {
+        designMatrixColumnMinima_ = otherNormalEquations.designMatrixColumnMinima_;
+        designMatrixColumnMaxima_ = otherNormalEquations.designMatrixColumnMaxima_;
+    }
+    else
+    {
+        designMatrixColumnMinima_ = designMatrixColumnMinima_.cwiseMin( otherNormalEquations.designMatrixColumnMinima_ );
+        designMatrixColumnMaxima_ = designMatrixColumnMaxima_.cwiseMax( otherNormalEquations.designMatrixColumnMaxima_ );
+    }
+    numberOfObservations_ += otherNormalEquations.numberOfObservations_;
+}
+
+//! Function to combine the normal equations accumulated by the processes of a group
+void ArcWiseNormalEquationsAccumulator::reduceOverProcesses(
+        const std::shared_ptr< utilities::ProcessCommunicator > processCommunicator )
+{
+    processCommunicator->sumOverProcesses( globalNormalMatrix_.data( ), globalNormalMatrix_.size( ) );
+    processCommunicator->sumOverProcesses( globalRightHandSide_.data( ), globalRightHandSide_.size( ) );
+
+    // Processes without observations do not contribute to the extreme values of the design matrix columns
+    if( numberOfObservations_ == 0 )
+    {
+        designMatrixColumnMinima_.setConstant( std::numeric_limits< double >::infinity( ) );
+        designMatrixColumnMaxima_.setConstant( -std::numeric_limits< double >::infinity( ) );
+    }
+    processCommunicator->minimumOverProcesses( designMatrixColumnMinima_.data( ), designMatrixColumnMinima_.size( ) );
+    processCommunicator->maximumOverProcesses( designMatrixColumnMaxima_.data( ), designMatrixColumnMaxima_.size( ) );
+
+    double numberOfObservations = static_cast< double >( numberOfObservations_ );
+    processCommunicator->sumOverProcesses( &numberOfObservations, 1 );
+    numberOfObservations_ = static_cast< int >( numberOfObservations );
+    if( numberOfObservations_ == 0 )
+    {
+        designMatrixColumnMinima_.setZero( );
+        designMatrixColumnMaxima_.setZero( );
+    }
+}
+
+//! Function to compute the normalization terms of the columns of the design matrix
+Eigen::VectorXd ArcWiseNormalEquationsAccumulator::getNormalizationTerms( ) const
+{
+    return getNormalizationTermsFromColumnExtrema( designMatrixColumnMinima_, designMatrixColumnMaxima_ );
+}
+
+//! Function to assemble the full (dense) normal matrix H^T W H from the accumulated blocks
+Eigen::MatrixXd ArcWiseNormalEquationsAccumulator::getFullNormalMatrix( ) const
+{
+    Eigen::MatrixXd normalMatrix = Eigen::MatrixXd::Zero( numberOfParameters_, numberOfParameters_ );
+    normalMatrix( globalParameterIndices_, globalParameterIndices_ ) = globalNormalMatrix_;
+    for( unsigned int i = 0; i < arcLocalParameterIndices_.size( ); i++ )
+    {
+        normalMatrix( arcLocalParameterIndices_.at( i ), arcLocalParameterIndices_.at( i ) ) = arcLocalNormalMatrices_.at( i );
+        normalMatrix( arcLocalParameterIndices_.at( i ), globalParameterIndices_ ) = arcLocalGlobalNormalMatrices_.at( i );
+        normalMatrix( globalParameterIndices_, arcLocalParameterIndices_.at( i ) ) =
+                arcLocalGlobalNormalMatrices_.at( i ).transpose( );
+    }
+    return normalMatrix;
+}
+
+//! Function to assemble the full right-hand side H^T W y from the accumulated blocks
+Eigen::VectorXd ArcWiseNormalEquationsAccumulator::getFullRightHandSide( ) const
+{
+    Eigen::VectorXd rightHandSide = Eigen::VectorXd::Zero( numberOfParameters_ );
+    rightHandSide( globalParameterIndices_ ) = globalRightHandSide_;
+    for( unsigned int i = 0; i < arcLocalParameterIndices_.size( ); i++ )
+    {
+        rightHandSide( arcLocalParameterIndices_.at( i ) ) = arcLocalRightHandSides_.at( i );
+    }
+    return rightHandSide;
+}
+
+//! Function to perform an iteration of least squares estimation from block-structured normal equations
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentWithArcLocalParameterReduction(
+        const ArcWiseNormalEquationsAccumulator& normalEquations,
+        const Eigen::VectorXd& normalizationTerms,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const double limitConditionNumberForWarning,
+        const LinearSolverType solverType,
+        const int numberOfThreads,
+        const std::shared_ptr< utilities::ProcessCommunicator > processCommunicator )
+{
+    int numberOfParameters = normalEquations.getNumberOfParameters( );
+    if( normalizationTerms.rows( ) != numberOfParameters || inverseOfAPrioriCovarianceMatrix.rows( ) != numberOfParameters ||
+            inverseOfAPrioriCovarianceMatrix.cols( ) != numberOfParameters )
+    {
+        throw std::runtime_error( "Error when performing least squares with arc-local parameter reduction, input sizes are inconsistent" );
+    }
+    bool checkCondition = ( limitConditionNumberForWarning == limitConditionNumberForWarning );
+
+    const std::vector< int >& globalParameterIndices = normalEquations.getGlobalParameterIndices( );
+    const std::vector< std::vector< int > >& arcLocalParameterIndices = normalEquations.getArcLocalParameterIndices( );
+    int numberOfGlobalParameters = globalParameterIndices.size( );
+    int numberOfArcs = arcLocalParameterIndices.size( );
+
+    // Check that a priori covariance does not correlate local parameters of different arcs
+    std::vector< int > parameterArcIndices( numberOfParameters, -1 );
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        for( unsigned int j = 0; j < arcLocalParameterIndices.at( i ).size( ); j++ )
+        {
+            parameterArcIndices[ arcLocalParameterIndices.at( i ).at( j ) ] = i;
+        }
+    }
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        for( int j = 0; j < numberOfParameters; j++ )
+        {
+            if( parameterArcIndices[ i ] >= 0 && parameterArcIndices[ j ] >= 0 &&
+                    parameterArcIndices[ i ] != parameterArcIndices[ j ] && inverseOfAPrioriCovarianceMatrix( i, j ) != 0.0 )
+            {
+                throw std::runtime_error( "Error when performing least squares with arc-local parameter reduction, a priori covariance correlates local parameters of arcs " +
+                                          std::to_string( parameterArcIndices[ i ] ) + " and " + std::to_string( parameterArcIndices[ j ] ) );
+            }
+        }
+    }
+
+    // Normalize global blocks
+    Eigen::VectorXd globalNormalizationTerms = normalizationTerms( globalParameterIndices );
+    Eigen::MatrixXd reducedNormalMatrix =
+            normalEquations.getGlobalNormalMatrix( ).cwiseQuotient( globalNormalizationTerms * globalNormalizationTerms.transpose( ) ) +
+            inverseOfAPrioriCovarianceMatrix( globalParameterIndices, globalParameterIndices );
+    Eigen::VectorXd reducedRightHandSide = normalEquations.getGlobalRightHandSide( ).cwiseQuotient( globalNormalizationTerms );
+
+    // Determine arcs that are processed by the current process
+    std::pair< int, int > processArcRange = std::make_pair( 0, numberOfArcs );
+    if( processCommunicator != nullptr )
+    {
+        processArcRange = utilities::getProcessItemRange(
+                    numberOfArcs, processCommunicator->getProcessIndex( ), processCommunicator->getNumberOfProcesses( ) );
+    }
+    int numberOfProcessArcs = processArcRange.second - processArcRange.first;
+
+    // Eliminate local parameters of each arc, with the arcs divided in contiguous ranges over the threads
+    int numberOfArcRanges = std::max( std::min( numberOfThreads, numberOfProcessArcs ), 1 );
+    std::vector< Eigen::LDLT< Eigen::MatrixXd > > arcDecompositions( numberOfArcs );
+    std::vector< Eigen::MatrixXd > normalizedArcLocalGlobalMatrices( numberOfArcs );
+    std::vector< Eigen::VectorXd > normalizedArcRightHandSides( numberOfArcs );
+    std::vector< Eigen::MatrixXd > normalMatrixReductions(
+                numberOfArcRanges, Eigen::MatrixXd::Zero( numberOfGlobalParameters, numberOfGlobalParameters ) );
+    std::vector< Eigen::VectorXd > rightHandSideReductions( numberOfArcRanges, Eigen::VectorXd::Zero( numberOfGlobalParameters ) );
+    utilities::executeParallelTasks(
+                numberOfArcRanges, [ & ]( const int rangeIndex )
+    {
+        for( int i = processArcRange.first + rangeIndex * numberOfProcessArcs / numberOfArcRanges;
+             i < processArcRange.first + ( rangeIndex + 1 ) * numberOfProcessArcs / numberOfArcRanges; i++ )
+        {
+            const std::vector< int >& localParameterIndices = arcLocalParameterIndices.at( i );
+            if( localParameterIndices.size( ) == 0 )
+            {
+                continue;
+            }
+
+            // Normalize local blocks of current arc
+            Eigen::VectorXd localNormalizationTerms = normalizationTerms( localParameterIndices );
+            Eigen::MatrixXd localNormalMatrix =
+                    normalEquations.getArcLocalNormalMatrices( ).at( i ).cwiseQuotient(
+                        localNormalizationTerms * localNormalizationTerms.transpose( ) ) +
+                    inverseOfAPrioriCovarianceMatrix( localParameterIndices, localParameterIndices );
+            normalizedArcLocalGlobalMatrices[ i ] =
+                    normalEquations.getArcLocalGlobalNormalMatrices( ).at( i ).cwiseQuotient(
+                        localNormalizationTerms * globalNormalizationTerms.transpose( ) ) +
+                    inverseOfAPrioriCovarianceMatrix( localParameterIndices, globalParameterIndices );
+            normalizedArcRightHandSides[ i ] =
+                    normalEquations.getArcLocalRightHandSides( ).at( i ).cwiseQuotient( localNormalizationTerms );
+
+            arcDecompositions[ i ].compute( localNormalMatrix );
+            if( arcDecompositions[ i ].info( ) != Eigen::Success )
+            {
+                throw std::runtime_error( "Error when performing least squares with arc-local parameter reduction, decomposition of local normal matrix of arc " +
+                                          std::to_string( i ) + " failed" );
+            }
+            if( checkCondition )
+            {
+                checkConditionNumber( 1.0 / arcDecompositions[ i ].rcond( ), limitConditionNumberForWarning );
+            }
+
+            // Add contribution of arc to reduced normal equations of global parameters
+            if( numberOfGlobalParameters > 0 )
+            {
+                Eigen::MatrixXd eliminatedLocalGlobalMatrix = arcDecompositions[ i ].solve( normalizedArcLocalGlobalMatrices[ i ] );
+                normalMatrixReductions[ rangeIndex ].noalias( ) +=
+                        normalizedArcLocalGlobalMatrices[ i ].transpose( ) * eliminatedLocalGlobalMatrix;
+                rightHandSideReductions[ rangeIndex ].noalias( ) +=
+                        eliminatedLocalGlobalMatrix.transpose( ) * normalizedArcRightHandSides[ i ];
+            }
+        }
+    }, numberOfThreads );
+
+    if( processCommunicator != nullptr )
+    {
+        // Sum contributions of the arcs of all processes
+        Eigen::MatrixXd processNormalMatrixReduction = Eigen::MatrixXd::Zero( numberOfGlobalParameters, numberOfGlobalParameters );
+        Eigen::VectorXd processRightHandSideReduction = Eigen::VectorXd::Zero( numberOfGlobalParameters );
+        for( int i = 0; i < numberOfArcRanges; i++ )
+        {
+            processNormalMatrixReduction += normalMatrixReductions.at( i );
+            processRightHandSideReduction += rightHandSideReductions.at( i );
+        }
+        processCommunicator->sumOverProcesses( processNormalMatrixReduction.data( ), processNormalMatrixReduction.size( ) );
+        processCommunicator->sumOverProcesses( processRightHandSideReduction.data( ), processRightHandSideReduction.size( ) );
+        reducedNormalMatrix -= processNormalMatrixReduction;
+        reducedRightHandSide -= processRightHandSideReduction;
+    }
+    else
+    {
+        for( int i = 0; i < numberOfArcRanges; i++ )
+        {
+            reducedNormalMatrix -= normalMatrixReductions.at( i );
+            reducedRightHandSide -= rightHandSideReductions.at( i );
+        }
+    }
+
+    // Solve reduced normal equations for global parameters (by root process only, if distributed over processes)
+    Eigen::VectorXd parameterAdjustment = Eigen::VectorXd::Zero( numberOfParameters );
+    Eigen::VectorXd globalParameterAdjustment = Eigen::VectorXd::Zero( numberOfGlobalParameters );
+    if( numberOfGlobalParameters > 0 )
+    {
+        if( processCommunicator == nullptr || processCommunicator->isRootProcess( ) )
+        {
+            globalParameterAdjustment = solveSystemOfEquations(
+                        reducedNormalMatrix, reducedRightHandSide, solverType, limitConditionNumberForWarning );
+        }
+        if( processCommunicator != nullptr )
+        {
+            processCommunicator->broadcastFromRootProcess( globalParameterAdjustment.data( ), numberOfGlobalParameters );
+        }
+    }
+
+    // Compute local parameters of each arc by back-substitution
+    utilities::executeParallelTasks(
+                numberOfProcessArcs, [ & ]( const int processArcIndex )
+    {
+        int arcIndex = processArcRange.first + processArcIndex;
+        if( arcLocalParameterIndices.at( arcIndex ).size( ) > 0 )
+        {
+            Eigen::VectorXd localParameterAdjustment = arcDecompositions[ arcIndex ].solve(
+                        normalizedArcRightHandSides[ arcIndex ] -
+                        normalizedArcLocalGlobalMatrices[ arcIndex ] * globalParameterAdjustment );
+            parameterAdjustment( arcLocalParameterIndices.at( arcIndex ) ) = localParameterAdjustment;
+        }
+    }, numberOfThreads );
+
+    // Assemble normal matrix; if distributed, each process contributes the local blocks of its own arcs (and the root
+    // process the global block), and the local parameter adjustments are combined
+    Eigen::MatrixXd normalMatrix = normalEquations.getFullNormalMatrix( );
+    if( processCommunicator != nullptr )
+    {
+        if( !processCommunicator->isRootProcess( ) )
+        {
+            normalMatrix( globalParameterIndices, globalParameterIndices ).setZero( );
+        }
+        processCommunicator->sumOverProcesses( normalMatrix.data( ), normalMatrix.size( ) );
+        processCommunicator->sumOverProcesses( parameterAdjustment.data( ), parameterAdjustment.size( ) );
+    }
+    parameterAdjustment( globalParameterIndices ) = globalParameterAdjustment;
+
+    return std::make_pair( parameterAdjustment, Eigen::MatrixXd(
+                               normalMatrix.cwiseQuotient(
+                                   normalizationTerms * normalizationTerms.transpose( ) ) + inverseOfAPrioriCovarianceMatrix ) );
+}
+
 //! Function to perform a non-linear least squares estimation with the Levenberg-Marquardt method.
 Eigen::VectorXd nonLinearLeastSquaresFit(
         const std::function< std::pair< Eigen::VectorXd, Eigen::MatrixXd >( const Eigen::VectorXd& ) >& observationAndJacobianFunctions,
@@ -40,9 +40,6 @@ LegendreCache::LegendreCache( const bool useGeodesyNormalization )
     }
 
     resetMaximumDegreeAndOrder( 1, 1 );
-
-    computeSecondDerivatives_ = 0;
-
 }
 
 //! Constructor
@@ -60,7 +57,6 @@ LegendreCache::LegendreCache( const int maximumDegree, const int maximumOrder, c
     }
 
     resetMaximumDegreeAndOrder( maximumDegree, maximumOrder );
-    computeSecondDerivatives_ = 0;
 }
 
 //! Get Legendre polynomial from cache when possible, and from direct computation otherwise.
@@ -74,16 +70,25 @@ void LegendreCache::update( const double polynomialParameter  )
         currentPolynomialParameterComplement_ = std::sqrt( 1.0 - polynomialParameter * polynomialParameter );
         currentOneOverPolynomialParameterComplement_ = 1.0 / currentPolynomialParameterComplement_;
 
-        LegendreCache& thisReference = *this;
-
-        int jMax = -1;
-        for( int i = 0; i <= maximumDegree_; i++ )
+        if( recursionType_ == extended_range_legendre_recursion )
+        {
+            computeExtendedRangeGeodesyLegendrePolynomials( );
+        }
+        else if( useGeodesyNormalization_ )
+        {
+            computeGeodesyLegendrePolynomials( );
+        }
+        else
         {
-            jMax = std::min( i, maximumOrder_ );
-            for( int j = 0; j <= jMax ; j++ )
+            LegendreCache& thisReference = *this;
+            for( int i = 0; i <= maximumDegree_; i++ )
             {
-                // Compute legendre polynomial
-                legendreValues_[ i * ( maximumOrder_ + 1 ) + j ] = legendrePolynomialFunction_( i, j, thisReference );
+                const int jMax = std::min( i, maximumOrder_ );
+                for( int j = 0; j <= jMax ; j++ )
+                {
+                    // Compute legendre polynomial
+                    legendreValues_[ degreeOffsets_[ i ] + j ] = legendrePolynomialFunction_( i, j, thisReference );
+                }
             }
         }
 
@@ -92,50 +97,45 @@ void LegendreCache::update( const double polynomialParameter  )
         {
             for( int i = 0; i <= maximumDegree_; i++ )
             {
-                jMax = std::min( i, maximumOrder_ );
-                for( int j = 0; j <= jMax ; j++ )
+                const int jMax = std::min( i, maximumOrder_ );
+                const int degreeOffset = degreeOffsets_[ i ];
+                for( int j = 1; j <= jMax ; j++ )
                 {
-                    if( j != 0 )
+                    // Compute legendre polynomial derivative
+                    const int index = degreeOffset + ( j - 1 );
+                    if( useGeodesyNormalization_ )
                     {
-                        // Compute legendre polynomial derivative
-                        if( useGeodesyNormalization_ )
-                        {
-                            legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ] =
-                                    computeGeodesyLegendrePolynomialDerivative(
-                                        j - 1, currentPolynomialParameter_, currentOneOverPolynomialParameterComplement_,
-                                        legendreValues_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ],
-                                    legendreValues_[ i * ( maximumOrder_ + 1 ) + j ],
-                                    derivativeNormalizations_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ] );
-                        }
-                        else
-                        {
-                            legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ] =
-                                    computeLegendrePolynomialDerivative(
-                                        j - 1, currentPolynomialParameter_,
-                                        legendreValues_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ],
-                                    legendreValues_[ i * ( maximumOrder_ + 1 ) + j ] );
-                        }
-
+                        legendreDerivatives_[ index ] =
+                                computeGeodesyLegendrePolynomialDerivative(
+                                    j - 1, currentPolynomialParameter_, currentOneOverPolynomialParameterComplement_,
+                                    legendreValues_[ index ], legendreValues_[ index + 1 ],
+                                derivativeNormalizations_[ index ] );
+                    }
+                    else
+                    {
+                        legendreDerivatives_[ index ] =
+                                computeLegendrePolynomialDerivative(
+                                    j - 1, currentPolynomialParameter_,
+                                    legendreValues_[ index ], legendreValues_[ index + 1 ] );
                     }
                 }
 
                 // Compute legendre polynomial derivative for i = j  (if needed)
                 if( jMax == i )
                 {
+                    const int index = degreeOffset + jMax;
                     if( useGeodesyNormalization_ )
                     {
-                        legendreDerivatives_[ i * ( maximumOrder_ + 1 ) +  jMax ] =
+                        legendreDerivatives_[ index ] =
                                 computeGeodesyLegendrePolynomialDerivative(
                                     jMax, currentPolynomialParameter_, currentOneOverPolynomialParameterComplement_,
-                                    legendreValues_[ i * ( maximumOrder_ + 1 ) + jMax ], 0.0,
-                                derivativeNormalizations_[ i * ( maximumOrder_ + 1 ) + jMax ] );
+                                    legendreValues_[ index ], 0.0, derivativeNormalizations_[ index ] );
                     }
                     else
                     {
-                        legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + jMax ] =
+                        legendreDerivatives_[ index ] =
                                 computeLegendrePolynomialDerivative(
-                                    jMax, currentPolynomialParameter_,
-                                    legendreValues_[ i * ( maximumOrder_ + 1 ) + jMax ], 0.0 );
+                                    jMax, currentPolynomialParameter_, legendreValues_[ index ], 0.0 );
                     }
                 }
             }
@@ -146,59 +146,30 @@ void LegendreCache::update( const double polynomialParameter  )
         {
             for( int i = 0; i <= maximumDegree_; i++ )
             {
-                jMax = std::min( i, maximumOrder_ );
-                for( int j = 0; j <= jMax ; j++ )
+                const int jMax = std::min( i, maximumOrder_ );
+                const int degreeOffset = degreeOffsets_[ i ];
+                for( int j = 1; j <= jMax ; j++ )
                 {
-                    if( j != 0 )
-                    {
-                        // Compute legendre polynomial second derivatives
-                        if( useGeodesyNormalization_ )
-                        {
-                            legendreSecondDerivatives_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ] =
-                                    computeGeodesyLegendrePolynomialSecondDerivative(
-                                        j - 1, currentPolynomialParameter_, currentOneOverPolynomialParameterComplement_,
-                                        legendreValues_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ],
-                                    legendreValues_[ i * ( maximumOrder_ + 1 ) + j ],
-                                    legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ],
-                                    legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + j ],
-                                    derivativeNormalizations_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ] );
-                        }
-                        else
-                        {
-                            legendreSecondDerivatives_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ] =
-                                    computeGeodesyLegendrePolynomialSecondDerivative(
-                                        j - 1, currentPolynomialParameter_,  currentOneOverPolynomialParameterComplement_,
-                                        legendreValues_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ],
-                                    legendreValues_[ i * ( maximumOrder_ + 1 ) + j ],
-                                    legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ],
-                                    legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + j ], 1.0 );
-                        }
-
-                    }
+                    // Compute legendre polynomial second derivatives
+                    const int index = degreeOffset + ( j - 1 );
+                    legendreSecondDerivatives_[ index ] =
+                            computeGeodesyLegendrePolynomialSecondDerivative(
+                                j - 1, currentPolynomialParameter_, currentOneOverPolynomialParameterComplement_,
+                                legendreValues_[ index ], legendreValues_[ index + 1 ],
+                            legendreDerivatives_[ index ], legendreDerivatives_[ index + 1 ],
+                            useGeodesyNormalization_ ? derivativeNormalizations_[ index ] : 1.0 );
                 }
+
                 // Compute legendre polynomial second derivative for i = j  (if needed)
                 if( jMax == i )
                 {
-                    if( useGeodesyNormalization_ )
-                    {
-                        legendreSecondDerivatives_[ i * ( maximumOrder_ + 1 ) +  jMax ] =
-                                computeGeodesyLegendrePolynomialSecondDerivative(
-                                    jMax, currentPolynomialParameter_,  currentOneOverPolynomialParameterComplement_,
-                                    legendreValues_[ i * ( maximumOrder_ + 1 ) + jMax ], 0.0,
-                                legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + jMax ], 0.0,
-                                derivativeNormalizations_[ i * ( maximumOrder_ + 1 ) + jMax ] );
-                    }
-                    else
-                    {
-                        legendreSecondDerivatives_[ i * ( maximumOrder_ + 1 ) +  jMax ] =
-                                computeGeodesyLegendrePolynomialSecondDerivative(
-                                    jMax, currentPolynomialParameter_,  currentOneOverPolynomialParameterComplement_,
-                                    legendreValues_[ i * ( maximumOrder_ + 1 ) + jMax ], 0.0,
-                                legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + jMax ], 0.0,
-                                1.0 );
-                    }
+                    const int index = degreeOffset + jMax;
+                    legendreSecondDerivatives_[ index ] =
+                            computeGeodesyLegendrePolynomialSecondDerivative(
+                                jMax, currentPolynomialParameter_,  currentOneOverPolynomialParameterComplement_,
+                                legendreValues_[ index ], 0.0, legendreDerivatives_[ index ], 0.0,
+                            useGeodesyNormalization_ ? derivativeNormalizations_[ index ] : 1.0 );
                 }
-
             }
         }
     }
@@ -215,33 +186,50 @@ void LegendreCache::resetMaximumDegreeAndOrder( const int maximumDegree, const i
         maximumOrder_ = maximumDegree_;
     }
 
-    legendreValues_.resize( ( maximumDegree_ + 1 ) * ( maximumOrder_ + 1 ) );
-    legendreDerivatives_.resize( ( maximumDegree_ + 1 ) * ( maximumOrder_ + 1 ) );
-    legendreSecondDerivatives_.resize( ( maximumDegree_ + 1 ) * ( maximumOrder_ + 1 ) );
-
-    derivativeNormalizations_.resize( ( maximumDegree_ + 1 ) * ( maximumOrder_ + 1 ) );
-
-    verticalLegendreValuesComputationMultipliersOne_.resize( ( maximumDegree_ + 1 ) * ( maximumOrder_ + 1 ) );
-    verticalLegendreValuesComputationMultipliersTwo_.resize( ( maximumDegree_ + 1 ) * ( maximumOrder_ + 1 ) );
+    // Compute start of each degree in packed storage (degree i holds orders 0 to min( i, maximumOrder_ ))
+    degreeOffsets_.resize( maximumDegree_ + 2 );
+    degreeOffsets_[ 0 ] = 0;
     for( int i = 0; i <= maximumDegree_; i++ )
     {
+        degreeOffsets_[ i + 1 ] = degreeOffsets_[ i ] + std::min( i, maximumOrder_ ) + 1;
+    }
+    const int numberOfEntries = degreeOffsets_[ maximumDegree_ + 1 ];
+
+    legendreValues_.resize( numberOfEntries );
+    legendreDerivatives_.resize( numberOfEntries );
+    legendreSecondDerivatives_.resize( computeSecondDerivatives_ ? numberOfEntries : 0 );
+    firstDoublePrecisionDegrees_.resize( maximumOrder_ + 1 );
+
+    derivativeNormalizations_.resize( numberOfEntries );
+    verticalLegendreValuesComputationMultipliersOne_.resize( numberOfEntries );
+    verticalLegendreValuesComputationMultipliersTwo_.resize( numberOfEntries );
+    sectoralLegendreValuesComputationMultipliers_.resize( maximumDegree_ + 1 );
+    degreeLegendreValuesComputationMultipliers_.resize( maximumDegree_ + 1 );
+    for( int i = 0; i <= maximumDegree_; i++ )
+    {
+        sectoralLegendreValuesComputationMultipliers_[ i ] =
+                std::sqrt( ( 2.0 * static_cast< double >( i ) + 1.0 ) / ( 6.0 * static_cast< double >( i ) ) );
+        degreeLegendreValuesComputationMultipliers_[ i ] = std::sqrt( 2.0 * static_cast< double >( i ) - 1.0 );
+
         for( int j = 0; ( ( j <= i ) && ( j <= maximumOrder_ ) ) ; j++ )
         {
+            const int index = degreeOffsets_[ i ] + j;
+
             // Compute normalization correction factor.
-            derivativeNormalizations_[ i * ( maximumOrder_ + 1 ) + j ] = std::sqrt(
+            derivativeNormalizations_[ index ] = std::sqrt(
                         ( static_cast< double >( i + j + 1 ) )
                         * ( static_cast< double >( i - j ) ) );
 
             // If order is zero apply multiplication factor.
             if ( j == 0 )
             {
-                derivativeNormalizations_[ i * ( maximumOrder_ + 1 ) + j ] *= std::sqrt( 0.5 );
+                derivativeNormalizations_[ index ] *= std::sqrt( 0.5 );
             }
-            verticalLegendreValuesComputationMultipliersOne_[ i * ( maximumOrder_ + 1 ) + j ] =
+            verticalLegendreValuesComputationMultipliersOne_[ index ] =
                     std::sqrt( ( 2.0 * static_cast< double >( i ) + 1.0 )
                                / ( ( static_cast< double >( i + j ) ) *
                                    ( static_cast< double >( i - j ) ) ) );
-            verticalLegendreValuesComputationMultipliersTwo_[ i * ( maximumOrder_ + 1 ) + j ] =
+            verticalLegendreValuesComputationMultipliersTwo_[ index ] =
                     std::sqrt( ( static_cast< double >( i + j ) - 1.0 )
                                * ( static_cast< double >( i - j ) - 1.0 )
                                / ( 2.0 * static_cast< double >( i ) - 3.0 ) );
@@ -252,91 +240,250 @@ void LegendreCache::resetMaximumDegreeAndOrder( const int maximumDegree, const i
     currentPolynomialParameterComplement_ = TUDAT_NAN;
 }
 
+//! Function to reset whether the second derivatives are to be computed when calling update function
+void LegendreCache::setComputeSecondDerivatives( const bool computeSecondDerivatives )
+{
+    computeSecondDerivatives_ = computeSecondDerivatives;
+    legendreSecondDerivatives_.resize( computeSecondDerivatives_ ? legendreValues_.size( ) : 0 );
+    currentPolynomialParameter_ = TUDAT_NAN;
+}
+
+//! Function to get the memory used by the cached values and recursion coefficients
+std::size_t LegendreCache::getMemoryFootprint( ) const
+{
+    return sizeof( double ) * (
+                legendreValues_.capacity( ) + legendreDerivatives_.capacity( ) +
+                legendreSecondDerivatives_.capacity( ) + derivativeNormalizations_.capacity( ) +
+                verticalLegendreValuesComputationMultipliersOne_.capacity( ) +
+                verticalLegendreValuesComputationMultipliersTwo_.capacity( ) +
+                sectoralLegendreValuesComputationMultipliers_.capacity( ) +
+                degreeLegendreValuesComputationMultipliers_.capacity( ) ) +
+            sizeof( int ) * ( degreeOffsets_.capacity( ) + firstDoublePrecisionDegrees_.capacity( ) );
+}
 
-//! Get Legendre polynomial value from the cache.
-double LegendreCache::getLegendrePolynomial(
-        const int degree, const int order )
+//! Function to compute the geodesy-normalized Legendre polynomials using the standard recursion
+void LegendreCache::computeGeodesyLegendrePolynomials( )
 {
-    if( degree > maximumDegree_ || order > maximumOrder_ )
+    const double polynomialParameter = currentPolynomialParameter_;
+
+    legendreValues_[ 0 ] = computeGeodesyLegendrePolynomialExplicit( 0, 0, polynomialParameter );
+    if( maximumDegree_ == 0 )
     {
-        std::string errorMessage = "Error when requesting legendre cache, maximum degree or order exceeded " +
-                std::to_string( degree ) + " " +
-                std::to_string( maximumDegree_ ) + " " +
-                std::to_string( order ) + " " +
-                std::to_string( maximumOrder_ );
-        throw std::runtime_error( errorMessage );
-        return TUDAT_NAN;
+        return;
     }
-    else if( order > degree )
+
+    legendreValues_[ 1 ] = computeGeodesyLegendrePolynomialExplicit( 1, 0, polynomialParameter );
+    const double degreeOneOrderOnePolynomial = computeGeodesyLegendrePolynomialExplicit( 1, 1, polynomialParameter );
+    if( maximumOrder_ > 0 )
     {
-        return 0.0;
+        legendreValues_[ 2 ] = degreeOneOrderOnePolynomial;
     }
-    else
+
+    for( int i = 2; i <= maximumDegree_; i++ )
     {
-        return legendreValues_[ degree * ( maximumOrder_ + 1  ) + order ];
-    };
+        const int jMax = std::min( i, maximumOrder_ );
+        const int degreeOffset = degreeOffsets_[ i ];
+        const int oneDegreePriorOffset = degreeOffsets_[ i - 1 ];
+        const int twoDegreesPriorOffset = degreeOffsets_[ i - 2 ];
+        const double degreeMultiplier = degreeLegendreValuesComputationMultipliers_[ i ] * polynomialParameter;
+
+        // Compute zonal and tesseral polynomials through degree recursion
+        for( int j = 0; j <= std::min( jMax, i - 1 ); j++ )
+        {
+            const int index = degreeOffset + j;
+            legendreValues_[ index ] = verticalLegendreValuesComputationMultipliersOne_[ index ] * (
+                        degreeMultiplier * legendreValues_[ oneDegreePriorOffset + j ] -
+                        verticalLegendreValuesComputationMultipliersTwo_[ index ] *
+                        ( ( j <= i - 2 ) ? legendreValues_[ twoDegreesPriorOffset + j ] : 0.0 ) );
+        }
+
+        // Compute sectoral polynomial through sectoral recursion
+        if( jMax == i )
+        {
+            legendreValues_[ degreeOffset + i ] = sectoralLegendreValuesComputationMultipliers_[ i ] *
+                    degreeOneOrderOnePolynomial * legendreValues_[ oneDegreePriorOffset + i - 1 ];
+        }
+    }
 }
 
-//! Get first derivative of Legendre polynomial value from the cache.
-double LegendreCache::getLegendrePolynomialDerivative(
-        const int degree, const int order )
+//! Radix of the extended range numbers used by LegendreCache::computeExtendedRangeGeodesyLegendrePolynomials (2^960).
+static const double EXTENDED_RANGE_RADIX = std::ldexp( 1.0, 960 );
+
+//! Inverse of the radix of the extended range numbers (2^-960).
+static const double INVERSE_EXTENDED_RANGE_RADIX = std::ldexp( 1.0, -960 );
+
+//! Upper bound of the magnitude of the double part of a normalized extended range number (2^480).
+static const double EXTENDED_RANGE_UPPER_BOUND = std::ldexp( 1.0, 480 );
+
+//! Lower bound of the magnitude of the double part of a normalized extended range number (2^-480).
+static const double EXTENDED_RANGE_LOWER_BOUND = std::ldexp( 1.0, -480 );
+
+//! Function to normalize an extended range number, with value value * 2^(960 exponent)
+static inline void normalizeExtendedRangeNumber( double& value, int& exponent )
 {
-    if( degree > ( maximumDegree_ ) || order > maximumOrder_ )
+    if( std::fabs( value ) >= EXTENDED_RANGE_UPPER_BOUND )
     {
-        std::string errorMessage = "Error when requesting legendre cache first derivatives, maximum degree or order exceeded " +
-                std::to_string( degree ) + " " +
-                std::to_string( maximumDegree_ ) + " " +
-                std::to_string( order ) + " " +
-                std::to_string( maximumOrder_ );
-        throw std::runtime_error( errorMessage );
-        return TUDAT_NAN;
+        value *= INVERSE_EXTENDED_RANGE_RADIX;
+        exponent++;
     }
-    else if( order > degree )
+    else if( std::fabs( value ) < EXTENDED_RANGE_LOWER_BOUND && value != 0.0 )
+    {
+        value *= EXTENDED_RANGE_RADIX;
+        exponent--;
+    }
+}
+
+//! Function to convert an extended range number, with value value * 2^(960 exponent), to a double
+static inline double convertExtendedRangeNumberToDouble( const double value, const int exponent )
+{
+    if( exponent == 0 )
+    {
+        return value;
+    }
+    else if( exponent == -1 )
+    {
+        return value * INVERSE_EXTENDED_RANGE_RADIX;
+    }
+    else if( exponent < -1 )
     {
         return 0.0;
     }
     else
     {
-        return legendreDerivatives_[ degree * ( maximumOrder_ + 1  ) + order ];
-    };
+        return value * EXTENDED_RANGE_RADIX;
+    }
 }
 
-//! Get second derivative of Legendre polynomial value from the cache.
-double LegendreCache::getLegendrePolynomialSecondDerivative(
-        const int degree, const int order )
+//! Function to compute the geodesy-normalized Legendre polynomials using the extended range recursion
+void LegendreCache::computeExtendedRangeGeodesyLegendrePolynomials( )
 {
-    if( degree > ( maximumDegree_  ) || order > maximumOrder_ )
+    const double polynomialParameter = currentPolynomialParameter_;
+    const double degreeOneOrderOnePolynomial = computeGeodesyLegendrePolynomialExplicit( 1, 1, polynomialParameter );
+
+    // Current sectoral polynomial, as extended range number
+    double sectoralValue = 1.0;
+    int sectoralExponent = 0;
+
+    for( int order = 0; order <= maximumOrder_; order++ )
     {
-        std::string errorMessage = "Error when requesting legendre cache second derivatives, maximum degree or order exceeded " +
-                std::to_string( degree ) + " " +
-                std::to_string( maximumDegree_ ) + " " +
-                std::to_string( order ) + " " +
-                std::to_string( maximumOrder_ );
-        throw std::runtime_error( errorMessage );
-        return TUDAT_NAN;
+        // Compute sectoral polynomial with the sectoral recursion
+        if( order == 1 )
+        {
+            sectoralValue = degreeOneOrderOnePolynomial;
+        }
+        else if( order > 1 )
+        {
+            sectoralValue = sectoralLegendreValuesComputationMultipliers_[ order ] *
+                    degreeOneOrderOnePolynomial * sectoralValue;
+            normalizeExtendedRangeNumber( sectoralValue, sectoralExponent );
+        }
+        legendreValues_[ degreeOffsets_[ order ] + order ] =
+                convertExtendedRangeNumberToDouble( sectoralValue, sectoralExponent );
+
+        // Compute polynomials of current order with the degree recursion, as extended range numbers until both
+        // previous values are in the range of a double (after which the polynomials no longer decrease).
+        double oneDegreePriorValue = sectoralValue;
+        int oneDegreePriorExponent = sectoralExponent;
+        double twoDegreesPriorValue = 0.0;
+        int twoDegreesPriorExponent = sectoralExponent;
+
+        int degree = order + 1;
+        for( ; degree <= maximumDegree_ && ( oneDegreePriorExponent != 0 || twoDegreesPriorExponent != 0 ); degree++ )
+        {
+            const int index = degreeOffsets_[ degree ] + order;
+
+            // Bring previous values to common exponent
+            int exponent = oneDegreePriorExponent;
+            double alignedOneDegreePriorValue = oneDegreePriorValue;
+            double alignedTwoDegreesPriorValue = twoDegreesPriorValue;
+            if( twoDegreesPriorExponent < oneDegreePriorExponent )
+            {
+                alignedTwoDegreesPriorValue = ( oneDegreePriorExponent - twoDegreesPriorExponent == 1 ) ?
+                            twoDegreesPriorValue * INVERSE_EXTENDED_RANGE_RADIX : 0.0;
+            }
+            else if( twoDegreesPriorExponent > oneDegreePriorExponent )
+            {
+                exponent = twoDegreesPriorExponent;
+                alignedOneDegreePriorValue = ( twoDegreesPriorExponent - oneDegreePriorExponent == 1 ) ?
+                            oneDegreePriorValue * INVERSE_EXTENDED_RANGE_RADIX : 0.0;
+            }
+
+            double currentValue = verticalLegendreValuesComputationMultipliersOne_[ index ] * (
+                        degreeLegendreValuesComputationMultipliers_[ degree ] * polynomialParameter *
+                        alignedOneDegreePriorValue -
+                        verticalLegendreValuesComputationMultipliersTwo_[ index ] * alignedTwoDegreesPriorValue );
+            normalizeExtendedRangeNumber( currentValue, exponent );
+            legendreValues_[ index ] = convertExtendedRangeNumberToDouble( currentValue, exponent );
+
+            twoDegreesPriorValue = oneDegreePriorValue;
+            twoDegreesPriorExponent = oneDegreePriorExponent;
+            oneDegreePriorValue = currentValue;
+            oneDegreePriorExponent = exponent;
+        }
+        firstDoublePrecisionDegrees_[ order ] = degree;
     }
-    else if( computeSecondDerivatives_ == 0 )
+
+    // Compute remaining polynomials in double precision, degree by degree
+    if( maximumDegree_ > 0 )
     {
-        throw std::runtime_error( "Error when requesting legendre cache second derivatives, no computations performed" );
+        legendreValues_[ 1 ] = computeGeodesyLegendrePolynomialExplicit( 1, 0, polynomialParameter );
+        firstDoublePrecisionDegrees_[ 0 ] = 2;
     }
-    else if( order > degree )
+    for( int degree = 2; degree <= maximumDegree_; degree++ )
     {
-        return 0.0;
+        const int maximumOrderOfDegree = std::min( degree, maximumOrder_ );
+        const int degreeOffset = degreeOffsets_[ degree ];
+        const int oneDegreePriorOffset = degreeOffsets_[ degree - 1 ];
+        const int twoDegreesPriorOffset = degreeOffsets_[ degree - 2 ];
+        const double degreeMultiplier = degreeLegendreValuesComputationMultipliers_[ degree ] * polynomialParameter;
+        for( int order = 0; order <= maximumOrderOfDegree; order++ )
+        {
+            if( degree >= firstDoublePrecisionDegrees_[ order ] )
+            {
+                const int index = degreeOffset + order;
+                legendreValues_[ index ] = verticalLegendreValuesComputationMultipliersOne_[ index ] * (
+                            degreeMultiplier * legendreValues_[ oneDegreePriorOffset + order ] -
+                            verticalLegendreValuesComputationMultipliersTwo_[ index ] *
+                            ( ( order <= degree - 2 ) ? legendreValues_[ twoDegreesPriorOffset + order ] : 0.0 ) );
+            }
+        }
     }
-    else
+}
+
+//! Function to set the type of recursion used to compute the Legendre polynomials when calling update function
+void LegendreCache::setRecursionType( const LegendreRecursionType recursionType )
+{
+    if( recursionType == extended_range_legendre_recursion && !useGeodesyNormalization_ )
     {
-        return legendreSecondDerivatives_[ degree * ( maximumOrder_ + 1  ) + order ];
-    };
+        throw std::runtime_error(
+                    "Error when setting Legendre recursion type, extended range recursion is only available for "
+                    "geodesy-normalized Legendre polynomials" );
+    }
+    recursionType_ = recursionType;
+    currentPolynomialParameter_ = TUDAT_NAN;
+}
+
+//! Function to throw an error for a request of a value outside of the cache
+void LegendreCache::throwMaximumDegreeOrOrderExceededError(
+        const std::string& valueType, const int degree, const int order ) const
+{
+    std::string errorMessage = "Error when requesting legendre cache" + valueType +
+            ", maximum degree or order exceeded " +
+            std::to_string( degree ) + " " +
+            std::to_string( maximumDegree_ ) + " " +
+            std::to_string( order ) + " " +
+            std::to_string( maximumOrder_ );
+    throw std::runtime_error( errorMessage );
 }
 
 double LegendreCache::getVerticalLegendreValuesComputationMultipliersOne( const int degree, const int order )
 {
-    return verticalLegendreValuesComputationMultipliersOne_[ degree * ( maximumOrder_ + 1 ) + order ];
+    return verticalLegendreValuesComputationMultipliersOne_[ degreeOffsets_[ degree ] + order ];
 }
 
 double LegendreCache::getVerticalLegendreValuesComputationMultipliersTwo( const int degree, const int order )
 {
-    return verticalLegendreValuesComputationMultipliersTwo_[ degree * ( maximumOrder_ + 1 ) + order ];
+    return verticalLegendreValuesComputationMultipliersTwo_[ degreeOffsets_[ degree ] + order ];
 }
 
 //! Compute unnormalized associated Legendre polynomial.
@@ -66,15 +66,13 @@ void calculatePolyhedronVerticesCoordinatesRelativeToFieldPoint (
         const Eigen::Vector3d& bodyFixedPosition,
         const Eigen::MatrixXd& verticesCoordinates)
 {
-    const unsigned int numberOfVertices = verticesCoordinates.rows();
-    verticesCoordinatesRelativeToFieldPoint.resize(numberOfVertices, 3);
+    verticesCoordinatesRelativeToFieldPoint.resize( verticesCoordinates.rows( ), 3 );
 
-    const Eigen::MatrixXd bodyFixedPositionMatrix = bodyFixedPosition.transpose();
-
-    for ( unsigned int vertex = 0; vertex < numberOfVertices; ++vertex )
+    // Subtract field point column-wise, so that each coordinate is processed contiguously
+    for ( unsigned int coordinate = 0; coordinate < 3; ++coordinate )
     {
-        verticesCoordinatesRelativeToFieldPoint.block<1,3>(vertex,0) = verticesCoordinates.block<1,3>(vertex,0) -
-                bodyFixedPositionMatrix;
+        verticesCoordinatesRelativeToFieldPoint.col( coordinate ) =
+                verticesCoordinates.col( coordinate ).array( ) - bodyFixedPosition( coordinate );
     }
 }
 
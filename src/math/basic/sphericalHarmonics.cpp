@@ -9,6 +9,7 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
 
 #include <Eigen/Core>
@@ -36,6 +37,140 @@ void SphericalHarmonicsCache::resetMaximumDegreeAndOrder( const int maximumDegre
     sinesOfLongitude_.resize( maximumOrder_ + 1 );
     cosinesOfLongitude_.resize( maximumOrder_ + 1 );
     referenceRadiusRatioPowers_.resize( maximumDegree_ + 2 );
+
+    if( cartesianRecursion_ != nullptr )
+    {
+        cartesianRecursion_->resetMaximumDegreeAndOrder( maximumDegree_, maximumOrder_ );
+    }
+
+    // Force recomputation at next update, so that the newly added entries are computed
+    currentLongitude_ = TUDAT_NAN;
+    referenceRadiusRatio_ = TUDAT_NAN;
+}
+
+//! Function to reset the maximum degree and order, and to precompute the recursion factors
+void CartesianSphericalHarmonicsRecursion::resetMaximumDegreeAndOrder( const int maximumDegree, const int maximumOrder )
+{
+    maximumDegree_ = maximumDegree;
+    maximumOrder_ = std::min( maximumOrder, maximumDegree );
+
+    const int numberOfTerms = ( maximumDegree_ + 1 ) * ( maximumDegree_ + 2 ) / 2;
+    realTerms_.assign( numberOfTerms, 0.0 );
+    imaginaryTerms_.assign( numberOfTerms, 0.0 );
+    firstDegreeRecursionFactors_.assign( numberOfTerms, 0.0 );
+    secondDegreeRecursionFactors_.assign( numberOfTerms, 0.0 );
+    sectoralRecursionFactors_.assign( maximumOrder_ + 1, 0.0 );
+    gradientFactors_.assign( 3 * numberOfTerms, 0.0 );
+
+    // Force recomputation at next update, so that the newly added entries are computed
+    currentPosition_.setConstant( TUDAT_NAN );
+    currentReferenceRadius_ = TUDAT_NAN;
+
+    // Set factors of sectoral recursion, including change in normalization factor from order 0 to 1
+    for( int m = 1; m <= maximumOrder_; m++ )
+    {
+        sectoralRecursionFactors_[ m ] = ( m == 1 ) ? std::sqrt( 3.0 ) :
+                std::sqrt( static_cast< double >( 2 * m + 1 ) / static_cast< double >( 2 * m ) );
+    }
+
+    for( int n = 1; n <= maximumDegree_; n++ )
+    {
+        const double doubleDegree = static_cast< double >( n );
+        for( int m = 0; m < n && m <= maximumOrder_; m++ )
+        {
+            const double doubleOrder = static_cast< double >( m );
+
+            // Set factors of degree recursion
+            firstDegreeRecursionFactors_[ getTermIndex( n, m ) ] = std::sqrt(
+                        ( 2.0 * doubleDegree + 1.0 ) * ( 2.0 * doubleDegree - 1.0 ) /
+                        ( ( doubleDegree - doubleOrder ) * ( doubleDegree + doubleOrder ) ) );
+            if( n - 2 >= m )
+            {
+                secondDegreeRecursionFactors_[ getTermIndex( n, m ) ] = std::sqrt(
+                            ( 2.0 * doubleDegree + 1.0 ) * ( doubleDegree + doubleOrder - 1.0 ) *
+                            ( doubleDegree - doubleOrder - 1.0 ) /
+                            ( ( 2.0 * doubleDegree - 3.0 ) * ( doubleDegree + doubleOrder ) *
+                              ( doubleDegree - doubleOrder ) ) );
+            }
+        }
+    }
+
+    // Set factors of potential gradient, for all terms for which the terms of degree n + 1 are available
+    for( int n = 0; n < maximumDegree_; n++ )
+    {
+        const double doubleDegree = static_cast< double >( n );
+        const double degreeRatio = ( 2.0 * doubleDegree + 1.0 ) / ( 2.0 * doubleDegree + 3.0 );
+        for( int m = 0; m <= n && m < maximumOrder_; m++ )
+        {
+            const double doubleOrder = static_cast< double >( m );
+            double* currentFactors = &( gradientFactors_[ 3 * getTermIndex( n, m ) ] );
+            currentFactors[ 0 ] = std::sqrt( ( ( m == 0 ) ? 0.5 : 0.25 ) * degreeRatio *
+                                             ( doubleDegree + doubleOrder + 1.0 ) * ( doubleDegree + doubleOrder + 2.0 ) );
+            currentFactors[ 1 ] = ( m == 0 ) ? 0.0 : std::sqrt(
+                        ( ( m == 1 ) ? 0.5 : 0.25 ) * degreeRatio *
+                        ( doubleDegree - doubleOrder + 1.0 ) * ( doubleDegree - doubleOrder + 2.0 ) );
+            currentFactors[ 2 ] = std::sqrt( degreeRatio * ( doubleDegree + doubleOrder + 1.0 ) *
+                                             ( doubleDegree - doubleOrder + 1.0 ) );
+        }
+    }
+}
+
+//! Function to compute the terms V_nm and W_nm at the given position
+void CartesianSphericalHarmonicsRecursion::update( const Eigen::Vector3d& position, const double referenceRadius )
+{
+    if( position == currentPosition_ && referenceRadius == currentReferenceRadius_ )
+    {
+        return;
+    }
+    currentPosition_ = position;
+    currentReferenceRadius_ = referenceRadius;
+
+    const double squaredDistance = position.squaredNorm( );
+    const double scaledInverseSquaredDistance = referenceRadius / squaredDistance;
+    const double scaledX = position.x( ) * scaledInverseSquaredDistance;
+    const double scaledY = position.y( ) * scaledInverseSquaredDistance;
+    const double scaledZ = position.z( ) * scaledInverseSquaredDistance;
+    const double squaredRadiusRatio = referenceRadius * scaledInverseSquaredDistance;
+
+    double* realTerms = realTerms_.data( );
+    double* imaginaryTerms = imaginaryTerms_.data( );
+
+    realTerms[ 0 ] = referenceRadius / std::sqrt( squaredDistance );
+    imaginaryTerms[ 0 ] = 0.0;
+
+    for( int m = 0; m <= maximumOrder_; m++ )
+    {
+        // Compute sectoral term from previous sectoral term
+        int currentIndex = getTermIndex( m, m );
+        if( m > 0 )
+        {
+            const int previousIndex = getTermIndex( m - 1, m - 1 );
+            realTerms[ currentIndex ] = sectoralRecursionFactors_[ m ] * (
+                        scaledX * realTerms[ previousIndex ] - scaledY * imaginaryTerms[ previousIndex ] );
+            imaginaryTerms[ currentIndex ] = sectoralRecursionFactors_[ m ] * (
+                        scaledX * imaginaryTerms[ previousIndex ] + scaledY * realTerms[ previousIndex ] );
+        }
+
+        // Compute terms of all higher degrees at current order
+        int previousIndex = currentIndex;
+        int secondPreviousIndex = -1;
+        for( int n = m + 1; n <= maximumDegree_; n++ )
+        {
+            currentIndex = getTermIndex( n, m );
+            realTerms[ currentIndex ] = firstDegreeRecursionFactors_[ currentIndex ] * scaledZ * realTerms[ previousIndex ];
+            imaginaryTerms[ currentIndex ] =
+                    firstDegreeRecursionFactors_[ currentIndex ] * scaledZ * imaginaryTerms[ previousIndex ];
+            if( secondPreviousIndex >= 0 )
+            {
+                realTerms[ currentIndex ] -= secondDegreeRecursionFactors_[ currentIndex ] * squaredRadiusRatio *
+                        realTerms[ secondPreviousIndex ];
+                imaginaryTerms[ currentIndex ] -= secondDegreeRecursionFactors_[ currentIndex ] * squaredRadiusRatio *
+                        imaginaryTerms[ secondPreviousIndex ];
+            }
+            secondPreviousIndex = previousIndex;
+            previousIndex = currentIndex;
+        }
+    }
 }
 
 
@@ -9,6 +9,11 @@ template class AdamsBashforthMoultonIntegrator < double, Eigen::VectorXd, Eigen:
 template class AdamsBashforthMoultonIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
 template class AdamsBashforthMoultonIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
 
+#if( TUDAT_BUILD_WITH_EXTENDED_PRECISION_PROPAGATION_TOOLS )
+template class AdamsBashforthMoultonIntegrator < double, VectorXdd, VectorXdd >;
+template class AdamsBashforthMoultonIntegrator < Time, VectorXdd, VectorXdd, long double >;
+#endif
+
 } // namespace integrators
 } // namespace tudat
 
@@ -50,6 +50,10 @@ template class BulirschStoerVariableStepSizeIntegrator < double, Eigen::VectorXd
 template class BulirschStoerVariableStepSizeIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
 template class BulirschStoerVariableStepSizeIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
 
+#if( TUDAT_BUILD_WITH_EXTENDED_PRECISION_PROPAGATION_TOOLS )
+template class BulirschStoerVariableStepSizeIntegrator < double, VectorXdd, VectorXdd >;
+#endif
+
 
 } // namespace numerical_integrators
 
@@ -0,0 +1,21 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include "tudat/math/integrators/ensembleRungeKuttaVariableStepSizeIntegrator.h"
+
+namespace tudat
+{
+namespace numerical_integrators
+{
+
+template class EnsembleRungeKuttaVariableStepSizeIntegrator< double, double >;
+
+} // namespace numerical_integrators
+} // namespace tudat
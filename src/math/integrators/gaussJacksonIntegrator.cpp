@@ -0,0 +1,211 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Berry, M.M. and Healy, L.M., Implementation of Gauss-Jackson integration for orbit propagation,
+ *          The Journal of the Astronautical Sciences, 52(3), 331-357, 2004.
+ *
+ */
+
+#include <stdexcept>
+#include <string>
+
+#include "tudat/math/integrators/gaussJacksonIntegrator.h"
+
+namespace tudat
+{
+
+namespace numerical_integrators
+{
+
+//! Function to compute ( -1 )^power
+long double getShiftSign( const int power )
+{
+    return ( power % 2 == 0 ) ? 1.0L : -1.0L;
+}
+
+//! Function to compute the monomial coefficients of the Lagrange basis polynomials through a set of nodes
+std::vector< std::vector< long double > > computeLagrangeBasisPolynomials( const std::vector< long double >& nodes )
+{
+    const int numberOfNodes = static_cast< int >( nodes.size( ) );
+    std::vector< std::vector< long double > > basisPolynomials( numberOfNodes );
+    for( int j = 0; j < numberOfNodes; j++ )
+    {
+        std::vector< long double > polynomial( 1, 1.0L );
+        for( int m = 0; m < numberOfNodes; m++ )
+        {
+            if( m != j )
+            {
+                // Multiply polynomial by ( x - x_m ) / ( x_j - x_m )
+                const long double denominator = nodes.at( j ) - nodes.at( m );
+                std::vector< long double > newPolynomial( polynomial.size( ) + 1, 0.0L );
+                for( unsigned int i = 0; i < polynomial.size( ); i++ )
+                {
+                    newPolynomial[ i + 1 ] += polynomial[ i ] / denominator;
+                    newPolynomial[ i ] -= nodes.at( m ) * polynomial[ i ] / denominator;
+                }
+                polynomial = newPolynomial;
+            }
+        }
+        basisPolynomials[ j ] = polynomial;
+    }
+    return basisPolynomials;
+}
+
+//! Function to apply a linear functional (given by its values for the monomials) to each Lagrange basis polynomial
+Eigen::VectorXd applyFunctionalToBasisPolynomials( const std::vector< std::vector< long double > >& basisPolynomials,
+                                                   const std::vector< long double >& monomialValues )
+{
+    Eigen::VectorXd coefficients = Eigen::VectorXd::Zero( basisPolynomials.size( ) );
+    for( unsigned int j = 0; j < basisPolynomials.size( ); j++ )
+    {
+        long double value = 0.0L;
+        for( unsigned int i = 0; i < basisPolynomials.at( j ).size( ); i++ )
+        {
+            value += basisPolynomials.at( j ).at( i ) * monomialValues.at( i );
+        }
+        coefficients( j ) = static_cast< double >( value );
+    }
+    return coefficients;
+}
+
+//! Function to evaluate the Lagrange basis polynomials at a given point
+Eigen::VectorXd evaluateBasisPolynomials( const std::vector< std::vector< long double > >& basisPolynomials,
+                                          const long double point )
+{
+    std::vector< long double > monomialValues( basisPolynomials.size( ) );
+    long double power = 1.0L;
+    for( unsigned int i = 0; i < monomialValues.size( ); i++ )
+    {
+        monomialValues[ i ] = power;
+        power *= point;
+    }
+    return applyFunctionalToBasisPolynomials( basisPolynomials, monomialValues );
+}
+
+//! Constructor, computes the coefficients
+GaussJacksonCoefficients::GaussJacksonCoefficients( const int order ):
+    order_( order )
+{
+    if( order_ < 2 )
+    {
+        throw std::runtime_error( "Error in Gauss-Jackson integrator, order must be at least 2, but is " +
+                                  std::to_string( order_ ) + "." );
+    }
+
+    // Compute binomial coefficients
+    std::vector< std::vector< long double > > binomialCoefficients( order_ + 2 );
+    for( int k = 0; k <= order_ + 1; k++ )
+    {
+        binomialCoefficients[ k ].resize( k + 1 );
+        binomialCoefficients[ k ][ 0 ] = 1.0L;
+        binomialCoefficients[ k ][ k ] = 1.0L;
+        for( int i = 1; i < k; i++ )
+        {
+            binomialCoefficients[ k ][ i ] = binomialCoefficients[ k - 1 ][ i - 1 ] + binomialCoefficients[ k - 1 ][ i ];
+        }
+    }
+
+    // Compute value of first sum functional L (with v_n / h = s_n + L[ a ]) and second sum functional M
+    // (with r_n / h^2 = S_n + M[ a ]) for monomials x^i, with x w.r.t. the point n, from the requirement that
+    // L[ p( x ) ] - L[ p( x - 1 ) ] and M[ p( x ) ] - M[ p( x - 1 ) ] are consistent with the sum updates. The value for
+    // x^order is free, and set to zero.
+    std::vector< long double > firstSumMonomialValues( order_ + 1, 0.0L );
+    std::vector< long double > secondSumMonomialValues( order_ + 1, 0.0L );
+    for( int k = 1; k <= order_; k++ )
+    {
+        long double firstSumValue = getShiftSign( k ) * ( 1.0L / static_cast< long double >( k + 1 ) - 0.5L );
+        for( int i = 0; i <= k - 2; i++ )
+        {
+            firstSumValue += binomialCoefficients[ k ][ i ] * getShiftSign( k - i ) * firstSumMonomialValues[ i ];
+        }
+        firstSumMonomialValues[ k - 1 ] = firstSumValue / static_cast< long double >( k );
+    }
+
+    for( int k = 1; k <= order_; k++ )
+    {
+        long double secondSumValue = getShiftSign( k ) * ( 1.0L / static_cast< long double >( k + 2 ) - 0.5L );
+        for( int i = 0; i <= k; i++ )
+        {
+            secondSumValue += binomialCoefficients[ k ][ i ] * getShiftSign( k - i ) * firstSumMonomialValues[ i ];
+        }
+        for( int i = 0; i <= k - 2; i++ )
+        {
+            secondSumValue += binomialCoefficients[ k ][ i ] * getShiftSign( k - i ) * secondSumMonomialValues[ i ];
+        }
+        secondSumMonomialValues[ k - 1 ] = secondSumValue / static_cast< long double >( k );
+    }
+
+    // Compute coefficients for velocity and position at each point of the stencil
+    firstSumCoefficients_ = Eigen::MatrixXd::Zero( order_ + 1, order_ + 1 );
+    secondSumCoefficients_ = Eigen::MatrixXd::Zero( order_ + 1, order_ + 1 );
+    std::vector< long double > nodes( order_ + 1 );
+    for( int k = 0; k <= order_; k++ )
+    {
+        for( int j = 0; j <= order_; j++ )
+        {
+            nodes[ j ] = static_cast< long double >( j - k );
+        }
+        std::vector< std::vector< long double > > basisPolynomials = computeLagrangeBasisPolynomials( nodes );
+        firstSumCoefficients_.row( k ) =
+                applyFunctionalToBasisPolynomials( basisPolynomials, firstSumMonomialValues ).transpose( );
+        secondSumCoefficients_.row( k ) =
+                applyFunctionalToBasisPolynomials( basisPolynomials, secondSumMonomialValues ).transpose( );
+    }
+
+    // Compute predictor coefficients, for the point after the stencil (including the sum updates to that point)
+    for( int j = 0; j <= order_; j++ )
+    {
+        nodes[ j ] = static_cast< long double >( j - order_ - 1 );
+    }
+    std::vector< std::vector< long double > > basisPolynomials = computeLagrangeBasisPolynomials( nodes );
+    velocityPredictorCoefficients_ =
+            applyFunctionalToBasisPolynomials( basisPolynomials, firstSumMonomialValues ) +
+            0.5 * evaluateBasisPolynomials( basisPolynomials, 0.0L );
+    positionPredictorCoefficients_ =
+            applyFunctionalToBasisPolynomials( basisPolynomials, secondSumMonomialValues );
+    velocityPredictorCoefficients_( order_ ) += 0.5;
+    positionPredictorCoefficients_( order_ ) += 0.5;
+}
+
+//! Function to compute coefficients for integration of the interpolating polynomial through accelerations at given nodes
+void GaussJacksonCoefficients::computeOrdinateIntegrationCoefficients(
+        const std::vector< long double >& nodes,
+        const long double stepFraction,
+        Eigen::VectorXd& positionCoefficients,
+        Eigen::VectorXd& velocityCoefficients )
+{
+    // Compute integrals int_0^theta x^i dx and int_0^theta ( theta - x ) x^i dx
+    std::vector< long double > velocityMonomialValues( nodes.size( ) );
+    std::vector< long double > positionMonomialValues( nodes.size( ) );
+    long double power = stepFraction;
+    for( unsigned int i = 0; i < nodes.size( ); i++ )
+    {
+        velocityMonomialValues[ i ] = power / static_cast< long double >( i + 1 );
+        positionMonomialValues[ i ] = power * stepFraction / static_cast< long double >( ( i + 1 ) * ( i + 2 ) );
+        power *= stepFraction;
+    }
+
+    std::vector< std::vector< long double > > basisPolynomials = computeLagrangeBasisPolynomials( nodes );
+    positionCoefficients = applyFunctionalToBasisPolynomials( basisPolynomials, positionMonomialValues );
+    velocityCoefficients = applyFunctionalToBasisPolynomials( basisPolynomials, velocityMonomialValues );
+}
+
+template class GaussJacksonIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
+template class GaussJacksonIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
+template class GaussJacksonIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
+
+#if( TUDAT_BUILD_WITH_EXTENDED_PRECISION_PROPAGATION_TOOLS )
+template class GaussJacksonIntegrator < double, VectorXdd, VectorXdd >;
+template class GaussJacksonIntegrator < Time, VectorXdd, VectorXdd, long double >;
+#endif
+
+} // namespace numerical_integrators
+
+} // namespace tudat
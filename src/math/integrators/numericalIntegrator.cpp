@@ -9,6 +9,11 @@ template class NumericalIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
 template class NumericalIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
 template class NumericalIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
 
+#if( TUDAT_BUILD_WITH_EXTENDED_PRECISION_PROPAGATION_TOOLS )
+template class NumericalIntegrator < double, VectorXdd, VectorXdd >;
+template class NumericalIntegrator < Time, VectorXdd, VectorXdd, long double >;
+#endif
+
 } // namespace numerical_integrators
 } // namespace tudat
 
@@ -10,6 +10,11 @@ template class ReinitializableNumericalIntegrator < double, Eigen::VectorXd, Eig
 template class ReinitializableNumericalIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
 template class ReinitializableNumericalIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
 
+#if( TUDAT_BUILD_WITH_EXTENDED_PRECISION_PROPAGATION_TOOLS )
+template class ReinitializableNumericalIntegrator < double, VectorXdd, VectorXdd >;
+template class ReinitializableNumericalIntegrator < Time, VectorXdd, VectorXdd, long double >;
+#endif
+
 
 
 } // namespace numerical_integrators
@@ -9,6 +9,11 @@ template class RungeKutta4Integrator < double, Eigen::VectorXd, Eigen::VectorXd
 template class RungeKutta4Integrator < double, Eigen::Vector6d, Eigen::Vector6d >;
 template class RungeKutta4Integrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
 
+#if( TUDAT_BUILD_WITH_EXTENDED_PRECISION_PROPAGATION_TOOLS )
+template class RungeKutta4Integrator < double, VectorXdd, VectorXdd >;
+template class RungeKutta4Integrator < Time, VectorXdd, VectorXdd, long double >;
+#endif
+
 } // namespace numerical_integrators
 } // namespace tudat
 
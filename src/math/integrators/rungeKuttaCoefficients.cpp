@@ -21,6 +21,7 @@
 #include <Eigen/Core>
 
 #include "tudat/math/integrators/rungeKuttaCoefficients.h"
+#include "tudat/math/integrators/staticRungeKuttaCoefficients.h"
 
 namespace tudat
 {
@@ -373,60 +374,9 @@ void initializeThreeEighthRuleRK4Coefficients( RungeKuttaCoefficients&
 void initializeRungeKuttaFehlberg45Coefficients( RungeKuttaCoefficients&
                                                  rungeKuttaFehlberg45Coefficients )
 {
-    // Define characteristics of coefficient set.
-    rungeKuttaFehlberg45Coefficients.lowerOrder = 4;
-    rungeKuttaFehlberg45Coefficients.higherOrder = 5;
-    rungeKuttaFehlberg45Coefficients.orderEstimateToIntegrate = RungeKuttaCoefficients::lower;
-
-    // This coefficient set is taken from (Fehlberg, 1968).
-
-    // Define a-coefficients for the Runge-Kutta-Fehlberg method of order 5
-    // with an embedded 4th-order method for stepsize control and a total of 6 stages.
-    rungeKuttaFehlberg45Coefficients.aCoefficients = Eigen::MatrixXd::Zero( 6, 5 );
-    rungeKuttaFehlberg45Coefficients.aCoefficients( 1, 0 ) = 1.0 / 4.0;
-
-    rungeKuttaFehlberg45Coefficients.aCoefficients( 2, 0 ) = 3.0 / 32.0;
-    rungeKuttaFehlberg45Coefficients.aCoefficients( 2, 1 ) = 9.0 / 32.0;
-
-    rungeKuttaFehlberg45Coefficients.aCoefficients( 3, 0 ) =  1932.0 / 2197.0;
-    rungeKuttaFehlberg45Coefficients.aCoefficients( 3, 1 ) = -7200.0 / 2197.0;
-    rungeKuttaFehlberg45Coefficients.aCoefficients( 3, 2 ) =  7296.0 / 2197.0;
-
-    rungeKuttaFehlberg45Coefficients.aCoefficients( 4, 0 ) = 439.0 / 216.0;
-    rungeKuttaFehlberg45Coefficients.aCoefficients( 4, 1 ) = -8.0;
-    rungeKuttaFehlberg45Coefficients.aCoefficients( 4, 2 ) = 3680.0 / 513.0;
-    rungeKuttaFehlberg45Coefficients.aCoefficients( 4, 3 ) = -845.0 / 4104.0;
-
-    rungeKuttaFehlberg45Coefficients.aCoefficients( 5, 0 ) = -8.0 / 27.0;
-    rungeKuttaFehlberg45Coefficients.aCoefficients( 5, 1 ) = 2.0;
-    rungeKuttaFehlberg45Coefficients.aCoefficients( 5, 2 ) = -3544.0 / 2565.0;
-    rungeKuttaFehlberg45Coefficients.aCoefficients( 5, 3 ) = 1859.0 / 4104.0;
-    rungeKuttaFehlberg45Coefficients.aCoefficients( 5, 4 ) = -11.0 / 40.0;
-
-
-    // Define c-coefficients for the Runge-Kutta-Fehlberg method of order 5
-    // with an embedded 4th-order method for stepsize control and a total of 6 stages.
-    rungeKuttaFehlberg45Coefficients.cCoefficients = Eigen::VectorXd::Zero( 6 );
-    rungeKuttaFehlberg45Coefficients.cCoefficients( 1 ) = 1.0 / 4.0;
-    rungeKuttaFehlberg45Coefficients.cCoefficients( 2 ) = 3.0 / 8.0;
-    rungeKuttaFehlberg45Coefficients.cCoefficients( 3 ) = 12.0 / 13.0;
-    rungeKuttaFehlberg45Coefficients.cCoefficients( 4 ) = 1.0;
-    rungeKuttaFehlberg45Coefficients.cCoefficients( 5 ) = 1.0 / 2.0;
-
-
-    // Define b-coefficients for the Runge-Kutta method of order 5
-    // with an embedded 4th-order method for stepsize control and a total of 6 stages.
-    rungeKuttaFehlberg45Coefficients.bCoefficients = Eigen::MatrixXd::Zero( 2, 6 );
-    rungeKuttaFehlberg45Coefficients.bCoefficients( 0, 0 ) = 25.0 / 216.0;
-    rungeKuttaFehlberg45Coefficients.bCoefficients( 0, 2 ) = 1408.0 / 2565.0;
-    rungeKuttaFehlberg45Coefficients.bCoefficients( 0, 3 ) = 2197.0 / 4104.0;
-    rungeKuttaFehlberg45Coefficients.bCoefficients( 0, 4 ) = -1.0 / 5.0;
-
-    rungeKuttaFehlberg45Coefficients.bCoefficients( 1, 0 ) = 16.0 / 135.0;
-    rungeKuttaFehlberg45Coefficients.bCoefficients( 1, 2 ) = 6656.0 / 12825.0;
-    rungeKuttaFehlberg45Coefficients.bCoefficients( 1, 3 ) = 28561.0 / 56430.0;
-    rungeKuttaFehlberg45Coefficients.bCoefficients( 1, 4 ) = -9.0 / 50.0;
-    rungeKuttaFehlberg45Coefficients.bCoefficients( 1, 5 ) = 2.0 / 55.0;
+    // Coefficients are defined at compile time, and are used directly by the unrolled stage loop of the
+    // variable step-size integrator (see staticRungeKuttaCoefficients.h).
+    setRungeKuttaCoefficientsFromStaticTableau< rungeKuttaFehlberg45 >( rungeKuttaFehlberg45Coefficients );
 
     //// COMMENTED OUT BELOW : alternative coefficients that give slightly different results
     //// but give orders closer to what is expected (4.6~4 and 5=5).
@@ -479,8 +429,6 @@ void initializeRungeKuttaFehlberg45Coefficients( RungeKuttaCoefficients&
     // rungeKuttaFehlberg45Coefficients.bCoefficients( 1, 4 ) = 1.0 / 30.0;
     // rungeKuttaFehlberg45Coefficients.bCoefficients( 1, 5 ) = 6.0 / 25.0;
 
-    // Set the name of these coefficients.
-    rungeKuttaFehlberg45Coefficients.name = "Runge-Kutta-Fehlberg 4/5";
 }
 
 //! Initialize RKF56 coefficients.
@@ -563,257 +511,20 @@ void initializeRungeKuttaFehlberg56Coefficients( RungeKuttaCoefficients&
 void initializeRungeKuttaFehlberg78Coefficients( RungeKuttaCoefficients&
                                                  rungeKuttaFehlberg78Coefficients )
 {
-    // Define characteristics of coefficient set.
-    rungeKuttaFehlberg78Coefficients.lowerOrder = 7;
-    rungeKuttaFehlberg78Coefficients.higherOrder = 8;
-    rungeKuttaFehlberg78Coefficients.orderEstimateToIntegrate = RungeKuttaCoefficients::lower;
+    // Coefficients are defined at compile time, and are used directly by the unrolled stage loop of the
+    // variable step-size integrator (see staticRungeKuttaCoefficients.h).
+    setRungeKuttaCoefficientsFromStaticTableau< rungeKuttaFehlberg78 >( rungeKuttaFehlberg78Coefficients );
 
-    // This coefficient set is taken from (Fehlberg, 1968).
-
-    // Define a-coefficients for the Runge-Kutta-Fehlberg method of order 7
-    // with an embedded 8th-order method for stepsize control and a total of 13 stages.
-    rungeKuttaFehlberg78Coefficients.aCoefficients = Eigen::MatrixXd::Zero( 13, 12 );
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 1, 0 ) = 2.0 / 27.0;
-
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 2, 0 ) = 1.0 / 36.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 2, 1 ) = 1.0 / 12.0;
-
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 3, 0 ) = 1.0 / 24.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 3, 2 ) = 1.0 / 8.0;
-
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 4, 0 ) = 5.0 / 12.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 4, 2 ) = -25.0 / 16.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 4, 3 ) = 25.0 / 16.0;
-
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 5, 0 ) = 1.0 / 20.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 5, 3 ) = 1.0 / 4.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 5, 4 ) = 1.0 / 5.0;
-
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 6, 0 ) = -25.0 / 108.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 6, 3 ) = 125.0 / 108.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 6, 4 ) = -65.0 / 27.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 6, 5 ) = 125.0 / 54.0;
-
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 7, 0 ) = 31.0 / 300.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 7, 4 ) = 61.0 / 225.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 7, 5 ) = -2.0 / 9.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 7, 6 ) = 13.0 / 900.0;
-
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 8, 0 ) = 2.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 8, 3 ) = -53.0 / 6.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 8, 4 ) = 704.0 / 45.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 8, 5 ) = -107.0 / 9.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 8, 6 ) = 67.0 / 90.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 8, 7 ) = 3.0;
-
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 9, 0 ) = -91.0 / 108.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 9, 3 ) = 23.0 / 108.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 9, 4 ) = -976.0 / 135.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 9, 5 ) = 311.0 / 54.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 9, 6 ) = -19.0 / 60.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 9, 7 ) = 17.0 / 6.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 9, 8 ) = -1.0 / 12.0;
-
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 10, 0 ) = 2383.0 / 4100.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 10, 3 ) = -341.0 / 164.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 10, 4 ) = 4496.0 / 1025.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 10, 5 ) = -301.0 / 82.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 10, 6 ) = 2133.0 / 4100.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 10, 7 ) = 45.0 / 82.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 10, 8 ) = 45.0 / 164.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 10, 9 ) = 18.0 / 41.0;
-
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 11, 0 ) = 3.0 / 205.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 11, 5 ) = -6.0 / 41.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 11, 6 ) = -3.0 / 205.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 11, 7 ) = -3.0 / 41.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 11, 8 ) = 3.0 / 41.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 11, 9 ) = 6.0 / 41.0;
-
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 12, 0 ) = -1777.0 / 4100.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 12, 3 ) = -341.0 / 164.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 12, 4 ) = 4496.0 / 1025.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 12, 5 ) = -289.0 / 82.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 12, 6 ) = 2193.0 / 4100.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 12, 7 ) = 51.0 / 82.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 12, 8 ) = 33.0 / 164.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 12, 9 ) = 12.0 / 41.0;
-    rungeKuttaFehlberg78Coefficients.aCoefficients( 12, 11 ) = 1.0;
-
-    // Define c-coefficients for the Runge-Kutta-Fehlberg method of order 8
-    // with an embedded 7th-order method for stepsize control and a total of 13 stages.
-    rungeKuttaFehlberg78Coefficients.cCoefficients = Eigen::VectorXd::Zero( 13 );
-    rungeKuttaFehlberg78Coefficients.cCoefficients( 0 ) = 0.0;
-    rungeKuttaFehlberg78Coefficients.cCoefficients( 1 ) = 2.0 / 27.0;
-    rungeKuttaFehlberg78Coefficients.cCoefficients( 2 ) = 1.0 / 9.0;
-    rungeKuttaFehlberg78Coefficients.cCoefficients( 3 ) = 1.0 / 6.0;
-    rungeKuttaFehlberg78Coefficients.cCoefficients( 4 ) = 5.0 / 12.0;
-    rungeKuttaFehlberg78Coefficients.cCoefficients( 5 ) = 1.0 / 2.0;
-    rungeKuttaFehlberg78Coefficients.cCoefficients( 6 ) = 5.0 / 6.0;
-    rungeKuttaFehlberg78Coefficients.cCoefficients( 7 ) = 1.0 / 6.0;
-    rungeKuttaFehlberg78Coefficients.cCoefficients( 8 ) = 2.0 / 3.0;
-    rungeKuttaFehlberg78Coefficients.cCoefficients( 9 ) = 1.0 / 3.0;
-    rungeKuttaFehlberg78Coefficients.cCoefficients( 10 ) = 1.0;
-    rungeKuttaFehlberg78Coefficients.cCoefficients( 11 ) = 0.0;
-    rungeKuttaFehlberg78Coefficients.cCoefficients( 12 ) = 1.0;
-
-    // Define b-coefficients for the Runge-Kutta method of order 8
-    // with an embedded 7th-order method for stepsize control and a total of 13 stages.
-    rungeKuttaFehlberg78Coefficients.bCoefficients = Eigen::MatrixXd::Zero( 2, 13 );
-    rungeKuttaFehlberg78Coefficients.bCoefficients( 0, 0 ) = 41.0 / 840.0;
-    rungeKuttaFehlberg78Coefficients.bCoefficients( 0, 5 ) = 34.0 / 105.0;
-    rungeKuttaFehlberg78Coefficients.bCoefficients( 0, 6 ) = 9.0 / 35.0;
-    rungeKuttaFehlberg78Coefficients.bCoefficients( 0, 7 ) =
-            rungeKuttaFehlberg78Coefficients.bCoefficients( 0, 6 );
-    rungeKuttaFehlberg78Coefficients.bCoefficients( 0, 8 ) = 9.0 / 280.0;
-    rungeKuttaFehlberg78Coefficients.bCoefficients( 0, 9 ) =
-            rungeKuttaFehlberg78Coefficients.bCoefficients( 0, 8 );
-    rungeKuttaFehlberg78Coefficients.bCoefficients( 0, 10 ) = 41.0 / 840.0;
-
-    rungeKuttaFehlberg78Coefficients.bCoefficients( 1, 5 ) = 34.0 / 105.0;
-    rungeKuttaFehlberg78Coefficients.bCoefficients( 1, 6 ) = 9.0 / 35.0;
-    rungeKuttaFehlberg78Coefficients.bCoefficients( 1, 7 ) =
-            rungeKuttaFehlberg78Coefficients.bCoefficients( 1, 6 );
-    rungeKuttaFehlberg78Coefficients.bCoefficients( 1, 8 ) = 9.0 / 280.0;
-    rungeKuttaFehlberg78Coefficients.bCoefficients( 1, 9 ) =
-            rungeKuttaFehlberg78Coefficients.bCoefficients( 1, 8 );
-    rungeKuttaFehlberg78Coefficients.bCoefficients( 1, 11 ) = 41.0 / 840.0;
-    rungeKuttaFehlberg78Coefficients.bCoefficients( 1, 12 ) =
-            rungeKuttaFehlberg78Coefficients.bCoefficients( 1, 11 );
-
-    // Set the name of these coefficients.
-    rungeKuttaFehlberg78Coefficients.name = "Runge-Kutta-Fehlberg 7/8";
 }
 
 //! Initialize RK87 (Dormand and Prince) coefficients.
 void initializeRungeKutta87DormandPrinceCoefficients(
         RungeKuttaCoefficients& rungeKutta87DormandPrinceCoefficients )
 {
-    // Define characteristics of coefficient set.
-    rungeKutta87DormandPrinceCoefficients.lowerOrder = 7;
-    rungeKutta87DormandPrinceCoefficients.higherOrder = 8;
-    rungeKutta87DormandPrinceCoefficients.orderEstimateToIntegrate
-            = RungeKuttaCoefficients::higher;
-
-    // This coefficient set is taken from (Montenbruck and Gill, 2005).
-
-    // a-coefficients for the Runge-Kutta method of order 8
-    // with an embedded 7th-order method for stepsize control and a total of 13 stages.
-    rungeKutta87DormandPrinceCoefficients.aCoefficients = Eigen::MatrixXd::Zero( 13, 12 );
-
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 1, 0 ) = 1.0 / 18.0;
-
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 2, 0 ) = 1.0 / 48.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 2, 1 ) = 1.0 / 16.0;
-
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 3, 0 ) = 1.0 / 32.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 3, 2 ) = 3.0 / 32.0;
-
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 4, 0 ) = 5.0 / 16.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 4, 2 ) = -75.0 / 64.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 4, 3 ) = 75.0 / 64.0;
-
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 5, 0 ) = 3.0 / 80.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 5, 3 ) = 3.0 / 16.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 5, 4 ) = 3.0 / 20.0;
-
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 6, 0 ) = 29443841.0 / 614563906.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 6, 3 ) = 77736538.0 / 692538347.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 6, 4 ) = -28693883.0 / 1125000000.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 6, 5 ) = 23124283.0 / 1800000000.0;
-
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 7, 0 ) = 16016141.0 / 946692911.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 7, 3 ) = 61564180.0 / 158732637.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 7, 4 ) = 22789713.0 / 633445777.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 7, 5 ) = 545815736.0 / 2771057229.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 7, 6 ) = -180193667.0 / 1043307555.0;
-
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 8, 0 ) = 39632708.0 / 573591083.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 8, 3 ) = -433636366.0 / 683701615.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 8, 4 ) = -421739975.0 / 2616292301.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 8, 5 ) = 100302831.0 / 723423059.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 8, 6 ) = 790204164.0 / 839813087.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 8, 7 ) = 800635310.0 / 3783071287.0;
-
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 9, 0 ) = 246121993.0 / 1340847787.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 9, 3 ) = -37695042795.0 / 15268766246.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 9, 4 ) = -309121744.0 / 1061227803.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 9, 5 ) = -12992083.0 / 490766935.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 9, 6 ) = 6005943493.0 / 2108947869.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 9, 7 ) = 393006217.0 / 1396673457.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 9, 8 ) = 123872331.0 / 1001029789.0;
-
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 10, 0 ) = -1028468189.0 / 846180014.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 10, 3 ) = 8478235783.0 / 508512852.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 10, 4 ) = 1311729495.0 / 1432422823.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 10, 5 ) = -10304129995.0 / 1701304382.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 10, 6 ) = -48777925059.0 / 3047939560.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 10, 7 ) = 15336726248.0 / 1032824649.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 10, 8 ) = -45442868181.0 / 3398467696.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 10, 9 ) = 3065993473.0 / 597172653.0;
-
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 11, 0 ) = 185892177.0 / 718116043.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 11, 3 ) = -3185094517.0 / 667107341.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 11, 4 ) = -477755414.0 / 1098053517.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 11, 5 ) = -703635378.0 / 230739211.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 11, 6 ) = 5731566787.0 / 1027545527.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 11, 7 ) = 5232866602.0 / 850066563.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 11, 8 ) = -4093664535.0 / 808688257.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 11, 9 ) = 3962137247.0 / 1805957418.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 11, 10 ) = 65686358.0 / 487910083.0;
-
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 12, 0 ) = 403863854.0 / 491063109.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 12, 3 ) = -5068492393.0 / 434740067.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 12, 4 ) = -411421997.0 / 543043805.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 12, 5 ) = 652783627.0 / 914296604.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 12, 6 ) = 11173962825.0 / 925320556.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 12, 7 ) = -13158990841.0 / 6184727034.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 12, 8 ) = 3936647629.0 / 1978049680.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 12, 9 ) = -160528059.0 / 685178525.0;
-    rungeKutta87DormandPrinceCoefficients.aCoefficients( 12, 10 ) = 248638103.0 / 1413531060.0;
-
-    // c-coefficients for the Runge-Kutta method of order 8
-    // with an embedded 7th-order method for stepsize control and a total of 13 stages.
-    rungeKutta87DormandPrinceCoefficients.cCoefficients = Eigen::VectorXd::Zero( 13 );
-
-    rungeKutta87DormandPrinceCoefficients.cCoefficients( 1 ) = 1.0 / 18.0;
-    rungeKutta87DormandPrinceCoefficients.cCoefficients( 2 ) = 1.0 / 12.0;
-    rungeKutta87DormandPrinceCoefficients.cCoefficients( 3 ) = 1.0 / 8.0;
-    rungeKutta87DormandPrinceCoefficients.cCoefficients( 4 ) = 5.0 / 16.0;
-    rungeKutta87DormandPrinceCoefficients.cCoefficients( 5 ) = 3.0 / 8.0;
-    rungeKutta87DormandPrinceCoefficients.cCoefficients( 6 ) = 59.0 / 400.0;
-    rungeKutta87DormandPrinceCoefficients.cCoefficients( 7 ) = 93.0 / 200.0;
-    rungeKutta87DormandPrinceCoefficients.cCoefficients( 8 ) = 5490023248.0 / 9719169821.0;
-    rungeKutta87DormandPrinceCoefficients.cCoefficients( 9 ) = 13.0 / 20.0;
-    rungeKutta87DormandPrinceCoefficients.cCoefficients( 10 ) = 1201146811.0 / 1299019798.0;
-    rungeKutta87DormandPrinceCoefficients.cCoefficients( 11 ) = 1.0;
-    rungeKutta87DormandPrinceCoefficients.cCoefficients( 12 ) = 1.0;
-
-    // b-coefficients for the Runge-Kutta method of order 8
-    // with an embedded 7th-order method for stepsize control and a total of 13 stages.
-    rungeKutta87DormandPrinceCoefficients.bCoefficients = Eigen::MatrixXd::Zero( 2, 13 );
-
-    rungeKutta87DormandPrinceCoefficients.bCoefficients( 0, 0 ) = 13451932.0 / 455176623.0;
-    rungeKutta87DormandPrinceCoefficients.bCoefficients( 0, 5 ) = -808719846.0 / 976000145.0;
-    rungeKutta87DormandPrinceCoefficients.bCoefficients( 0, 6 ) = 1757004468.0 / 5645159321.0;
-    rungeKutta87DormandPrinceCoefficients.bCoefficients( 0, 7 ) = 656045339.0 / 265891186.0;
-    rungeKutta87DormandPrinceCoefficients.bCoefficients( 0, 8 ) = -3867574721.0 / 1518517206.0;
-    rungeKutta87DormandPrinceCoefficients.bCoefficients( 0, 9 ) = 465885868.0 / 322736535.0;
-    rungeKutta87DormandPrinceCoefficients.bCoefficients( 0, 10 ) = 53011238.0 / 667516719.0;
-    rungeKutta87DormandPrinceCoefficients.bCoefficients( 0, 11 ) = 2.0 / 45.0;
-
-    rungeKutta87DormandPrinceCoefficients.bCoefficients( 1, 0 ) = 14005451.0 / 335480064.0;
-    rungeKutta87DormandPrinceCoefficients.bCoefficients( 1, 5 ) = -59238493.0 / 1068277825.0;
-    rungeKutta87DormandPrinceCoefficients.bCoefficients( 1, 6 ) = 181606767.0 / 758867731.0;
-    rungeKutta87DormandPrinceCoefficients.bCoefficients( 1, 7 ) = 561292985.0 / 797845732.0;
-    rungeKutta87DormandPrinceCoefficients.bCoefficients( 1, 8 ) = -1041891430.0 / 1371343529.0;
-    rungeKutta87DormandPrinceCoefficients.bCoefficients( 1, 9 ) = 760417239.0 / 1151165299.0;
-    rungeKutta87DormandPrinceCoefficients.bCoefficients( 1, 10 ) = 118820643.0 / 751138087.0;
-    rungeKutta87DormandPrinceCoefficients.bCoefficients( 1, 11 ) = -528747749.0 / 2220607170.0;
-    rungeKutta87DormandPrinceCoefficients.bCoefficients( 1, 12 ) = 1.0 / 4.0;
+    // Coefficients are defined at compile time, and are used directly by the unrolled stage loop of the
+    // variable step-size integrator (see staticRungeKuttaCoefficients.h).
+    setRungeKuttaCoefficientsFromStaticTableau< rungeKutta87DormandPrince >( rungeKutta87DormandPrinceCoefficients );
 
-    // Set the name of these coefficients.
-    rungeKutta87DormandPrinceCoefficients.name = "Runge-Kutta 8/7 Dormand-Prince";
 }
 
 //! Initialize RKF89 coefficients.
@@ -1369,287 +1080,10 @@ void initializeRungeKuttaFeagin108Coefficients(
 void initializeRungeKuttaFeagin1210Coefficients(
         RungeKuttaCoefficients& rungeKutta1210Coefficients )
 {
-    // Define characteristics of coefficient set.
-    rungeKutta1210Coefficients.lowerOrder = 10;
-    rungeKutta1210Coefficients.higherOrder = 12;
-    rungeKutta1210Coefficients.orderEstimateToIntegrate
-            = RungeKuttaCoefficients::higher;
+    // Coefficients are defined at compile time, and are used directly by the unrolled stage loop of the
+    // variable step-size integrator (see staticRungeKuttaCoefficients.h).
+    setRungeKuttaCoefficientsFromStaticTableau< rungeKuttaFeagin1210 >( rungeKutta1210Coefficients );
 
-    // This coefficient set is taken from
-    // Feagin, T. (2012). High-order explicit Runge-Kutta methods using m-symmetry.
-    // Neural, Parallel & Scientific Computations, 20(3-4), 437-458.
-
-    // Define a-coefficients for the Runge-Kutta method.
-    rungeKutta1210Coefficients.aCoefficients = Eigen::MatrixXd::Zero( 25, 24 );
-    rungeKutta1210Coefficients.aCoefficients( 1, 0 ) = 0.200000000000000000000000000000000000000000000000000000000000;
-
-    rungeKutta1210Coefficients.aCoefficients( 2, 0 ) = -0.216049382716049382716049382716049382716049382716049382716049;
-    rungeKutta1210Coefficients.aCoefficients( 2, 1 ) = 0.771604938271604938271604938271604938271604938271604938271605;
-
-    rungeKutta1210Coefficients.aCoefficients( 3, 0 ) = 0.208333333333333333333333333333333333333333333333333333333333;
-    rungeKutta1210Coefficients.aCoefficients( 3, 2 ) = 0.625000000000000000000000000000000000000000000000000000000000;
-
-    rungeKutta1210Coefficients.aCoefficients( 4, 0 ) = 0.193333333333333333333333333333333333333333333333333333333333;
-    rungeKutta1210Coefficients.aCoefficients( 4, 2 ) = 0.220000000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.aCoefficients( 4, 3 ) = -0.0800000000000000000000000000000000000000000000000000000000000;
-
-    rungeKutta1210Coefficients.aCoefficients( 5, 0 ) = 0.100000000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.aCoefficients( 5, 3 ) = 0.400000000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.aCoefficients( 5, 4 ) = 0.500000000000000000000000000000000000000000000000000000000000;
-
-    rungeKutta1210Coefficients.aCoefficients( 6, 0 ) = 0.103364471650010477570395435690481791543342708330349879244197;
-    rungeKutta1210Coefficients.aCoefficients( 6, 3 ) = 0.124053094528946761061581889237115328211074784955180298044074;
-    rungeKutta1210Coefficients.aCoefficients( 6, 4 ) = 0.483171167561032899288836480451962508724109257517289177302380;
-    rungeKutta1210Coefficients.aCoefficients( 6, 5 ) = -0.0387530245694763252085681443767620580395733302341368038804290;
-
-    rungeKutta1210Coefficients.aCoefficients( 7, 0 ) = 0.124038261431833324081904585980175168140024670698633612292480;
-    rungeKutta1210Coefficients.aCoefficients( 7, 4 ) = 0.217050632197958486317846256953159942875916353757734167684657;
-    rungeKutta1210Coefficients.aCoefficients( 7, 5 ) = 0.0137455792075966759812907801835048190594443990939408530842918;
-    rungeKutta1210Coefficients.aCoefficients( 7, 6 ) = -0.0661095317267682844455831341498149531672668252085016565917546;
-
-    rungeKutta1210Coefficients.aCoefficients( 8, 0 ) = 0.0914774894856882983144991846980432197088832099976660100090486;
-    rungeKutta1210Coefficients.aCoefficients( 8, 5 ) = -0.00544348523717469689965754944144838611346156873847009178068318;
-    rungeKutta1210Coefficients.aCoefficients( 8, 6 ) = 0.0680716801688453518578515120895103863112751730758794372203952;
-    rungeKutta1210Coefficients.aCoefficients( 8, 7 ) = 0.408394315582641046727306852653894780093303185664924644551239;
-
-    rungeKutta1210Coefficients.aCoefficients( 9, 0 ) = 0.0890013652502551018954509355423841780143232697403434118692699;
-    rungeKutta1210Coefficients.aCoefficients( 9, 5 ) = 0.00499528226645532360197793408420692800405891149406814091955810;
-    rungeKutta1210Coefficients.aCoefficients( 9, 6 ) = 0.397918238819828997341739603001347156083435060931424970826304;
-    rungeKutta1210Coefficients.aCoefficients( 9, 7 ) = 0.427930210752576611068192608300897981558240730580396406312359;
-    rungeKutta1210Coefficients.aCoefficients( 9, 8 ) = -0.0865117637557827005740277475955029103267246394128995965941585;
-
-    rungeKutta1210Coefficients.aCoefficients( 10, 0 ) = 0.0695087624134907543112693906409809822706021061685544615255758;
-    rungeKutta1210Coefficients.aCoefficients( 10, 5 ) = 0.129146941900176461970759579482746551122871751501482634045487;
-    rungeKutta1210Coefficients.aCoefficients( 10, 6 ) = 1.53073638102311295076342566143214939031177504112433874313011;
-    rungeKutta1210Coefficients.aCoefficients( 10, 7 ) = 0.577874761129140052546751349454576715334892100418571882718036;
-    rungeKutta1210Coefficients.aCoefficients( 10, 8 ) = -0.951294772321088980532340837388859453930924498799228648050949;
-    rungeKutta1210Coefficients.aCoefficients( 10, 9 ) = -0.408276642965631951497484981519757463459627174520978426909934;
-
-    rungeKutta1210Coefficients.aCoefficients( 11, 0 ) = 0.0444861403295135866269453507092463581620165501018684152933313;
-    rungeKutta1210Coefficients.aCoefficients( 11, 5 ) = -0.00380476867056961731984232686574547203016331563626856065717964;
-    rungeKutta1210Coefficients.aCoefficients( 11, 6 ) = 0.0106955064029624200721262602809059154469206077644957399593972;
-    rungeKutta1210Coefficients.aCoefficients( 11, 7 ) = 0.0209616244499904333296674205928919920806734650660039898074652;
-    rungeKutta1210Coefficients.aCoefficients( 11, 8 ) = -0.0233146023259321786648561431551978077665337818756053603898847;
-    rungeKutta1210Coefficients.aCoefficients( 11, 9 ) = 0.00263265981064536974369934736325334761174975280887405725010964;
-    rungeKutta1210Coefficients.aCoefficients( 11, 10 ) = 0.00315472768977025060103545855572111407955208306374459723959783;
-
-    rungeKutta1210Coefficients.aCoefficients( 12, 0 ) = 0.0194588815119755475588801096525317761242073762016273186231215;
-    rungeKutta1210Coefficients.aCoefficients( 12, 8 ) = 0.0000678512949171812509306121653452367476194364781259165332321534;
-    rungeKutta1210Coefficients.aCoefficients( 12, 9 ) = -0.0000429795859049273623271005330230162343568863387724883603675550;
-    rungeKutta1210Coefficients.aCoefficients( 12, 10 ) = 0.0000176358982260285155407485928953302139937553442829975734148981;
-    rungeKutta1210Coefficients.aCoefficients( 12, 11 ) = 0.0653866627415027051009595231385181033549511358787382098351924;
-
-    rungeKutta1210Coefficients.aCoefficients( 13, 0 ) = 0.206836835664277105916828174798272361078909196043446411598231;
-    rungeKutta1210Coefficients.aCoefficients( 13, 8 ) = 0.0166796067104156472828045866664696450306326505094792505215514;
-    rungeKutta1210Coefficients.aCoefficients( 13, 9 ) = -0.00879501563200710214457024178249986591130234990219959208704979;
-    rungeKutta1210Coefficients.aCoefficients( 13, 10 ) = 0.00346675455362463910824462315246379209427513654098596403637231;
-    rungeKutta1210Coefficients.aCoefficients( 13, 11 ) = -0.861264460105717678161432562258351242030270498966891201799225;
-    rungeKutta1210Coefficients.aCoefficients( 13, 12 ) = 0.908651882074050281096239478469262145034957129939256789178785;
-
-    rungeKutta1210Coefficients.aCoefficients( 14, 0 ) = 0.0203926084654484010091511314676925686038504449562413004562382;
-    rungeKutta1210Coefficients.aCoefficients( 14, 8 ) = 0.0869469392016685948675400555583947505833954460930940959577347;
-    rungeKutta1210Coefficients.aCoefficients( 14, 9 ) = -0.0191649630410149842286436611791405053287170076602337673587681;
-    rungeKutta1210Coefficients.aCoefficients( 14, 10 ) = 0.00655629159493663287364871573244244516034828755253746024098838;
-    rungeKutta1210Coefficients.aCoefficients( 14, 11 ) = 0.0987476128127434780903798528674033899738924968006632201445462;
-    rungeKutta1210Coefficients.aCoefficients( 14, 12 ) = 0.00535364695524996055083260173615567408717110247274021056118319;
-    rungeKutta1210Coefficients.aCoefficients( 14, 13 ) = 0.301167864010967916837091303817051676920059229784957479998077;
-
-    rungeKutta1210Coefficients.aCoefficients( 15, 0 ) = 0.228410433917778099547115412893004398779136994596948545722283;
-    rungeKutta1210Coefficients.aCoefficients( 15, 8 ) = -0.498707400793025250635016567442511512138603770959682292383042;
-    rungeKutta1210Coefficients.aCoefficients( 15, 9 ) = 0.134841168335724478552596703792570104791700727205981058201689;
-    rungeKutta1210Coefficients.aCoefficients( 15, 10 ) = -0.0387458244055834158439904226924029230935161059142806805674360;
-    rungeKutta1210Coefficients.aCoefficients( 15, 11 ) = -1.27473257473474844240388430824908952380979292713250350199641;
-    rungeKutta1210Coefficients.aCoefficients( 15, 12 ) = 1.43916364462877165201184452437038081875299303577911839630524;
-    rungeKutta1210Coefficients.aCoefficients( 15, 13 ) = -0.214007467967990254219503540827349569639028092344812795499026;
-    rungeKutta1210Coefficients.aCoefficients( 15, 14 ) = 0.958202417754430239892724139109781371059908874605153648768037;
-
-    rungeKutta1210Coefficients.aCoefficients( 16, 0 ) = 2.00222477655974203614249646012506747121440306225711721209798;
-    rungeKutta1210Coefficients.aCoefficients( 16, 8 ) = 2.06701809961524912091954656438138595825411859673341600679555;
-    rungeKutta1210Coefficients.aCoefficients( 16, 9 ) = 0.623978136086139541957471279831494466155292316167021080663140;
-    rungeKutta1210Coefficients.aCoefficients( 16, 10 ) = -0.0462283685500311430283203554129062069391947101880112723185773;
-    rungeKutta1210Coefficients.aCoefficients( 16, 11 ) = -8.84973288362649614860075246727118949286604835457092701094630;
-    rungeKutta1210Coefficients.aCoefficients( 16, 12 ) = 7.74257707850855976227437225791835589560188590785037197433615;
-    rungeKutta1210Coefficients.aCoefficients( 16, 13 ) = -0.588358519250869210993353314127711745644125882130941202896436;
-    rungeKutta1210Coefficients.aCoefficients( 16, 14 ) = -1.10683733362380649395704708016953056176195769617014899442903;
-    rungeKutta1210Coefficients.aCoefficients( 16, 15 ) = -0.929529037579203999778397238291233214220788057511899747507074;
-
-    rungeKutta1210Coefficients.aCoefficients( 17, 0 ) = 3.13789533412073442934451608989888796808161259330322100268310;
-    rungeKutta1210Coefficients.aCoefficients( 17, 5 ) = 0.129146941900176461970759579482746551122871751501482634045487;
-    rungeKutta1210Coefficients.aCoefficients( 17, 6 ) = 1.53073638102311295076342566143214939031177504112433874313011;
-    rungeKutta1210Coefficients.aCoefficients( 17, 7 ) = 0.577874761129140052546751349454576715334892100418571882718036;
-    rungeKutta1210Coefficients.aCoefficients( 17, 8 ) = 5.42088263055126683050056840891857421941300558851862156403363;
-    rungeKutta1210Coefficients.aCoefficients( 17, 9 ) = 0.231546926034829304872663800877643660904880180835945693836936;
-    rungeKutta1210Coefficients.aCoefficients( 17, 10 ) = 0.0759292995578913560162301311785251873561801342333194895292058;
-    rungeKutta1210Coefficients.aCoefficients( 17, 11 ) = -12.3729973380186513287414553402595806591349822617535905976253;
-    rungeKutta1210Coefficients.aCoefficients( 17, 12 ) = 9.85455883464769543935957209317369202080367765721777101906955;
-    rungeKutta1210Coefficients.aCoefficients( 17, 13 ) = 0.0859111431370436529579357709052367772889980495122329601159540;
-    rungeKutta1210Coefficients.aCoefficients( 17, 14 ) = -5.65242752862643921117182090081762761180392602644189218673969;
-    rungeKutta1210Coefficients.aCoefficients( 17, 15 ) = -1.94300935242819610883833776782364287728724899124166920477873;
-    rungeKutta1210Coefficients.aCoefficients( 17, 16 ) = -0.128352601849404542018428714319344620742146491335612353559923;
-
-    rungeKutta1210Coefficients.aCoefficients( 18, 0 ) = 1.38360054432196014878538118298167716825163268489922519995564;
-    rungeKutta1210Coefficients.aCoefficients( 18, 5 ) = 0.00499528226645532360197793408420692800405891149406814091955810;
-    rungeKutta1210Coefficients.aCoefficients( 18, 6 ) = 0.397918238819828997341739603001347156083435060931424970826304;
-    rungeKutta1210Coefficients.aCoefficients( 18, 7 ) = 0.427930210752576611068192608300897981558240730580396406312359;
-    rungeKutta1210Coefficients.aCoefficients( 18, 8 ) = -1.30299107424475770916551439123047573342071475998399645982146;
-    rungeKutta1210Coefficients.aCoefficients( 18, 9 ) = 0.661292278669377029097112528107513072734573412294008071500699;
-    rungeKutta1210Coefficients.aCoefficients( 18, 10 ) = -0.144559774306954349765969393688703463900585822441545655530145;
-    rungeKutta1210Coefficients.aCoefficients( 18, 11 ) = -6.96576034731798203467853867461083919356792248105919255460819;
-    rungeKutta1210Coefficients.aCoefficients( 18, 12 ) = 6.65808543235991748353408295542210450632193197576935120716437;
-    rungeKutta1210Coefficients.aCoefficients( 18, 13 ) = -1.66997375108841486404695805725510845049807969199236227575796;
-    rungeKutta1210Coefficients.aCoefficients( 18, 14 ) = 2.06413702318035263832289040301832647130604651223986452170089;
-    rungeKutta1210Coefficients.aCoefficients( 18, 15 ) = -0.674743962644306471862958129570837723192079875998405058648892;
-    rungeKutta1210Coefficients.aCoefficients( 18, 16 ) = -0.00115618834794939500490703608435907610059605754935305582045729;
-    rungeKutta1210Coefficients.aCoefficients( 18, 17 ) = -0.00544057908677007389319819914241631024660726585015012485938593;
-
-    rungeKutta1210Coefficients.aCoefficients( 19, 0 ) = 0.951236297048287669474637975894973552166903378983475425758226;
-    rungeKutta1210Coefficients.aCoefficients( 19, 4 ) = 0.217050632197958486317846256953159942875916353757734167684657;
-    rungeKutta1210Coefficients.aCoefficients( 19, 5 ) = 0.0137455792075966759812907801835048190594443990939408530842918;
-    rungeKutta1210Coefficients.aCoefficients( 19, 6 ) = -0.0661095317267682844455831341498149531672668252085016565917546;
-    rungeKutta1210Coefficients.aCoefficients( 19, 8 ) = 0.152281696736414447136604697040747131921486432699422112099617;
-    rungeKutta1210Coefficients.aCoefficients( 19, 9 ) = -0.337741018357599840802300793133998004354643424457539667670080;
-    rungeKutta1210Coefficients.aCoefficients( 19, 10 ) = -0.0192825981633995781534949199286824400469353110630787982121133;
-    rungeKutta1210Coefficients.aCoefficients( 19, 11 ) = -3.68259269696866809932409015535499603576312120746888880201882;
-    rungeKutta1210Coefficients.aCoefficients( 19, 12 ) = 3.16197870406982063541533528419683854018352080342887002331312;
-    rungeKutta1210Coefficients.aCoefficients( 19, 13 ) = -0.370462522106885290716991856022051125477943482284080569177386;
-    rungeKutta1210Coefficients.aCoefficients( 19, 14 ) = -0.0514974200365440434996434456698127984941168616474316871020314;
-    rungeKutta1210Coefficients.aCoefficients( 19, 15 ) = -0.000829625532120152946787043541792848416659382675202720677536554;
-    rungeKutta1210Coefficients.aCoefficients( 19, 16 ) = 0.00000279801041419278598986586589070027583961355402640879503213503;
-    rungeKutta1210Coefficients.aCoefficients( 19, 17 ) = 0.0418603916412360287969841020776788461794119440689356178942252;
-    rungeKutta1210Coefficients.aCoefficients( 19, 18 ) = 0.279084255090877355915660874555379649966282167560126269290222;
-
-    rungeKutta1210Coefficients.aCoefficients( 20, 0 ) = 0.103364471650010477570395435690481791543342708330349879244197;
-    rungeKutta1210Coefficients.aCoefficients( 20, 3 ) = 0.124053094528946761061581889237115328211074784955180298044074;
-    rungeKutta1210Coefficients.aCoefficients( 20, 4 ) = 0.483171167561032899288836480451962508724109257517289177302380;
-    rungeKutta1210Coefficients.aCoefficients( 20, 5 ) = -0.0387530245694763252085681443767620580395733302341368038804290;
-    rungeKutta1210Coefficients.aCoefficients( 20, 7 ) = -0.438313820361122420391059788940960176420682836652600698580091;
-    rungeKutta1210Coefficients.aCoefficients( 20, 9 ) = -0.218636633721676647685111485017151199362509373698288330593486;
-    rungeKutta1210Coefficients.aCoefficients( 20, 10 ) = -0.0312334764394719229981634995206440349766174759626578122323015;
-    rungeKutta1210Coefficients.aCoefficients( 20, 17 ) = 0.0312334764394719229981634995206440349766174759626578122323015;
-    rungeKutta1210Coefficients.aCoefficients( 20, 18 ) = 0.218636633721676647685111485017151199362509373698288330593486;
-    rungeKutta1210Coefficients.aCoefficients( 20, 19 ) = 0.438313820361122420391059788940960176420682836652600698580091;
-
-    rungeKutta1210Coefficients.aCoefficients( 21, 0 ) = 0.193333333333333333333333333333333333333333333333333333333333;
-    rungeKutta1210Coefficients.aCoefficients( 21, 2 ) = 0.220000000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.aCoefficients( 21, 3 ) = -0.0800000000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.aCoefficients( 21, 6 ) = 0.0984256130499315928152900286856048243348202521491288575952143;
-    rungeKutta1210Coefficients.aCoefficients( 21, 7 ) = -0.196410889223054653446526504390100417677539095340135532418849;
-    rungeKutta1210Coefficients.aCoefficients( 21, 9 ) = 0.436457930493068729391826122587949137609670676712525034763317;
-    rungeKutta1210Coefficients.aCoefficients( 21, 10 ) = 0.0652613721675721098560370939805555698350543810708414716730270;
-    rungeKutta1210Coefficients.aCoefficients( 21, 17 ) = -0.0652613721675721098560370939805555698350543810708414716730270;
-    rungeKutta1210Coefficients.aCoefficients( 21, 18 ) = -0.436457930493068729391826122587949137609670676712525034763317;
-    rungeKutta1210Coefficients.aCoefficients( 21, 19 ) = 0.196410889223054653446526504390100417677539095340135532418849;
-    rungeKutta1210Coefficients.aCoefficients( 21, 20 ) = -0.0984256130499315928152900286856048243348202521491288575952143;
-
-    rungeKutta1210Coefficients.aCoefficients( 22, 0 ) = -0.216049382716049382716049382716049382716049382716049382716049;
-    rungeKutta1210Coefficients.aCoefficients( 22, 1 ) = 0.771604938271604938271604938271604938271604938271604938271605;
-    rungeKutta1210Coefficients.aCoefficients( 22, 4 ) = -0.666666666666666666666666666666666666666666666666666666666667;
-    rungeKutta1210Coefficients.aCoefficients( 22, 6 ) = -0.390696469295978451446999802258495981249099665294395945559163;
-    rungeKutta1210Coefficients.aCoefficients( 22, 20 ) = 0.390696469295978451446999802258495981249099665294395945559163;
-    rungeKutta1210Coefficients.aCoefficients( 22, 21 ) = 0.666666666666666666666666666666666666666666666666666666666667;
-
-    rungeKutta1210Coefficients.aCoefficients( 23, 0 ) = 0.200000000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.aCoefficients( 23, 2 ) = -0.164609053497942386831275720164609053497942386831275720164609;
-    rungeKutta1210Coefficients.aCoefficients( 23, 22 ) = 0.164609053497942386831275720164609053497942386831275720164609;
-
-    rungeKutta1210Coefficients.aCoefficients( 24, 0 ) = 1.47178724881110408452949550989023611293535315518571691939396;
-    rungeKutta1210Coefficients.aCoefficients( 24, 1 ) = 0.787500000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.aCoefficients( 24, 2 ) = 0.421296296296296296296296296296296296296296296296296296296296;
-    rungeKutta1210Coefficients.aCoefficients( 24, 4 ) = 0.291666666666666666666666666666666666666666666666666666666667;
-    rungeKutta1210Coefficients.aCoefficients( 24, 6 ) = 0.348600717628329563206854421629657569274689947367847465753757;
-    rungeKutta1210Coefficients.aCoefficients( 24, 7 ) = 0.229499544768994849582890233710555447073823569666506700662510;
-    rungeKutta1210Coefficients.aCoefficients( 24, 8 ) = 5.79046485790481979159831978177003471098279506036722411333192;
-    rungeKutta1210Coefficients.aCoefficients( 24, 9 ) = 0.418587511856506868874073759426596207226461447604248151080016;
-    rungeKutta1210Coefficients.aCoefficients( 24, 10 ) = 0.307039880222474002649653817490106690389251482313213999386651;
-    rungeKutta1210Coefficients.aCoefficients( 24, 11 ) = -4.68700905350603332214256344683853248065574415794742040470287;
-    rungeKutta1210Coefficients.aCoefficients( 24, 12 ) = 3.13571665593802262152038152399873856554395436199962915429076;
-    rungeKutta1210Coefficients.aCoefficients( 24, 13 ) = 1.40134829710965720817510506275620441055845017313930508348898;
-    rungeKutta1210Coefficients.aCoefficients( 24, 14 ) = -5.52931101439499023629010306005764336421276055777658156400910;
-    rungeKutta1210Coefficients.aCoefficients( 24, 15 ) = -0.853138235508063349309546894974784906188927508039552519557498;
-    rungeKutta1210Coefficients.aCoefficients( 24, 16 ) = 0.103575780373610140411804607167772795518293914458500175573749;
-    rungeKutta1210Coefficients.aCoefficients( 24, 17 ) = -0.140474416950600941142546901202132534870665923700034957196546;
-    rungeKutta1210Coefficients.aCoefficients( 24, 18 ) = -0.418587511856506868874073759426596207226461447604248151080016;
-    rungeKutta1210Coefficients.aCoefficients( 24, 19 ) = -0.229499544768994849582890233710555447073823569666506700662510;
-    rungeKutta1210Coefficients.aCoefficients( 24, 20 ) = -0.348600717628329563206854421629657569274689947367847465753757;
-    rungeKutta1210Coefficients.aCoefficients( 24, 21 ) = -0.291666666666666666666666666666666666666666666666666666666667;
-    rungeKutta1210Coefficients.aCoefficients( 24, 22 ) = -0.421296296296296296296296296296296296296296296296296296296296;
-    rungeKutta1210Coefficients.aCoefficients( 24, 23 ) = -0.787500000000000000000000000000000000000000000000000000000000;
-    
-    // Define c-coefficients for the Runge-Kutta method.
-    rungeKutta1210Coefficients.cCoefficients = Eigen::VectorXd::Zero( 25 );
-    rungeKutta1210Coefficients.cCoefficients( 1 ) = 0.200000000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.cCoefficients( 2 ) = 0.555555555555555555555555555555555555555555555555555555555556;
-    rungeKutta1210Coefficients.cCoefficients( 3 ) = 0.833333333333333333333333333333333333333333333333333333333333;
-    rungeKutta1210Coefficients.cCoefficients( 4 ) = 0.333333333333333333333333333333333333333333333333333333333333;
-    rungeKutta1210Coefficients.cCoefficients( 5 ) = 1.00000000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.cCoefficients( 6 ) = 0.671835709170513812712245661002797570438953420568682550710222;
-    rungeKutta1210Coefficients.cCoefficients( 7 ) = 0.288724941110620201935458488967024976908118598341806976469674;
-    rungeKutta1210Coefficients.cCoefficients( 8 ) = 0.562500000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.cCoefficients( 9 ) = 0.833333333333333333333333333333333333333333333333333333333333;
-    rungeKutta1210Coefficients.cCoefficients( 10 ) = 0.947695431179199287562380162101836721649589325892740646458322;
-    rungeKutta1210Coefficients.cCoefficients( 11 ) = 0.0548112876863802643887753674810754475842153612931128785028369;
-    rungeKutta1210Coefficients.cCoefficients( 12 ) = 0.0848880518607165350639838930162674302064148175640019542045934;
-    rungeKutta1210Coefficients.cCoefficients( 13 ) = 0.265575603264642893098114059045616835297201264164077621448665;
-    rungeKutta1210Coefficients.cCoefficients( 14 ) = 0.500000000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.cCoefficients( 15 ) = 0.734424396735357106901885940954383164702798735835922378551335;
-    rungeKutta1210Coefficients.cCoefficients( 16 ) = 0.915111948139283464936016106983732569793585182435998045795407;
-    rungeKutta1210Coefficients.cCoefficients( 17 ) = 0.947695431179199287562380162101836721649589325892740646458322;
-    rungeKutta1210Coefficients.cCoefficients( 18 ) = 0.833333333333333333333333333333333333333333333333333333333333;
-    rungeKutta1210Coefficients.cCoefficients( 19 ) = 0.288724941110620201935458488967024976908118598341806976469674;
-    rungeKutta1210Coefficients.cCoefficients( 20 ) = 0.671835709170513812712245661002797570438953420568682550710222;
-    rungeKutta1210Coefficients.cCoefficients( 21 ) = 0.333333333333333333333333333333333333333333333333333333333333;
-    rungeKutta1210Coefficients.cCoefficients( 22 ) = 0.555555555555555555555555555555555555555555555555555555555556;
-    rungeKutta1210Coefficients.cCoefficients( 23 ) = 0.200000000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.cCoefficients( 24 ) = 1.00000000000000000000000000000000000000000000000000000000000;
-
-    // Define b-coefficients for the Runge-Kutta method.
-    rungeKutta1210Coefficients.bCoefficients = Eigen::MatrixXd::Zero( 2, 25 );
-    rungeKutta1210Coefficients.bCoefficients( 0, 0 ) = 0.0238095238095238095238095238095238095238095238095238095238095;
-    rungeKutta1210Coefficients.bCoefficients( 0, 1 ) = 1.0 / 10.0;
-    rungeKutta1210Coefficients.bCoefficients( 0, 2 ) = 0.0312500000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.bCoefficients( 0, 4 ) = 0.0416666666666666666666666666666666666666666666666666666666667;
-    rungeKutta1210Coefficients.bCoefficients( 0, 6 ) = 0.0500000000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.bCoefficients( 0, 7 ) = 0.0500000000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.bCoefficients( 0, 9 ) = 0.100000000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.bCoefficients( 0, 10 ) = 0.0714285714285714285714285714285714285714285714285714285714286;
-    rungeKutta1210Coefficients.bCoefficients( 0, 12 ) = 0.138413023680782974005350203145033146748813640089941234591267;
-    rungeKutta1210Coefficients.bCoefficients( 0, 13 ) = 0.215872690604931311708935511140681138965472074195773051123019;
-    rungeKutta1210Coefficients.bCoefficients( 0, 14 ) = 0.243809523809523809523809523809523809523809523809523809523810;
-    rungeKutta1210Coefficients.bCoefficients( 0, 15 ) = 0.215872690604931311708935511140681138965472074195773051123019;
-    rungeKutta1210Coefficients.bCoefficients( 0, 16 ) = 0.138413023680782974005350203145033146748813640089941234591267;
-    rungeKutta1210Coefficients.bCoefficients( 0, 17 ) = -0.0714285714285714285714285714285714285714285714285714285714286;
-    rungeKutta1210Coefficients.bCoefficients( 0, 18 ) = -0.100000000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.bCoefficients( 0, 19 ) = -0.0500000000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.bCoefficients( 0, 20 ) = -0.0500000000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.bCoefficients( 0, 21 ) = -0.0416666666666666666666666666666666666666666666666666666666667;
-    rungeKutta1210Coefficients.bCoefficients( 0, 22 ) = -0.0312500000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.bCoefficients( 0, 23 ) = -1.0 / 10.0;
-    rungeKutta1210Coefficients.bCoefficients( 0, 24 ) = 0.0238095238095238095238095238095238095238095238095238095238095;
-    
-    rungeKutta1210Coefficients.bCoefficients( 1, 0 ) = 0.0238095238095238095238095238095238095238095238095238095238095;
-    rungeKutta1210Coefficients.bCoefficients( 1, 1 ) = 0.0234375000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.bCoefficients( 1, 2 ) = 0.0312500000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.bCoefficients( 1, 4 ) = 0.0416666666666666666666666666666666666666666666666666666666667;
-    rungeKutta1210Coefficients.bCoefficients( 1, 6 ) = 0.0500000000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.bCoefficients( 1, 7 ) = 0.0500000000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.bCoefficients( 1, 9 ) = 0.100000000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.bCoefficients( 1, 10 ) = 0.0714285714285714285714285714285714285714285714285714285714286;
-    rungeKutta1210Coefficients.bCoefficients( 1, 12 ) = 0.138413023680782974005350203145033146748813640089941234591267;
-    rungeKutta1210Coefficients.bCoefficients( 1, 13 ) = 0.215872690604931311708935511140681138965472074195773051123019;
-    rungeKutta1210Coefficients.bCoefficients( 1, 14 ) = 0.243809523809523809523809523809523809523809523809523809523810;
-    rungeKutta1210Coefficients.bCoefficients( 1, 15 ) = 0.215872690604931311708935511140681138965472074195773051123019;
-    rungeKutta1210Coefficients.bCoefficients( 1, 16 ) = 0.138413023680782974005350203145033146748813640089941234591267;
-    rungeKutta1210Coefficients.bCoefficients( 1, 17 ) = -0.0714285714285714285714285714285714285714285714285714285714286;
-    rungeKutta1210Coefficients.bCoefficients( 1, 18 ) = -0.100000000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.bCoefficients( 1, 19 ) = -0.0500000000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.bCoefficients( 1, 20 ) = -0.0500000000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.bCoefficients( 1, 21 ) = -0.0416666666666666666666666666666666666666666666666666666666667;
-    rungeKutta1210Coefficients.bCoefficients( 1, 22 ) = -0.0312500000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.bCoefficients( 1, 23 ) = -0.0234375000000000000000000000000000000000000000000000000000000;
-    rungeKutta1210Coefficients.bCoefficients( 1, 24 ) = 0.0238095238095238095238095238095238095238095238095238095238095;
-    
-    // Define the name of the coefficient set.
-    rungeKutta1210Coefficients.name = "Runge-Kutta-Feagin 12/10";
 }
 
 //! Initialize Runge Kutta Feagin 14(12) coefficients.
@@ -2313,6 +1747,31 @@ const RungeKuttaCoefficients& RungeKuttaCoefficients::get(
     }
 }
 
+//! Function to retrieve the coefficient set for which the compile-time Butcher tableau is identical to given coefficients.
+CoefficientSets getMatchingStaticRungeKuttaCoefficientSet( const RungeKuttaCoefficients& coefficients )
+{
+    if( areRungeKuttaCoefficientsEqualToStaticTableau< rungeKuttaFehlberg45 >( coefficients ) )
+    {
+        return rungeKuttaFehlberg45;
+    }
+    else if( areRungeKuttaCoefficientsEqualToStaticTableau< rungeKuttaFehlberg78 >( coefficients ) )
+    {
+        return rungeKuttaFehlberg78;
+    }
+    else if( areRungeKuttaCoefficientsEqualToStaticTableau< rungeKutta87DormandPrince >( coefficients ) )
+    {
+        return rungeKutta87DormandPrince;
+    }
+    else if( areRungeKuttaCoefficientsEqualToStaticTableau< rungeKuttaFeagin1210 >( coefficients ) )
+    {
+        return rungeKuttaFeagin1210;
+    }
+    else
+    {
+        return undefinedCoefficientSet;
+    }
+}
+
 // Function to print the Butcher tableau of a given coefficient set.
 void printButcherTableau( CoefficientSets coefficientSet )
 {
@@ -9,6 +9,11 @@ template class RungeKuttaFixedStepSizeIntegrator < double, Eigen::VectorXd, Eige
 template class RungeKuttaFixedStepSizeIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
 template class RungeKuttaFixedStepSizeIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
 
+#if( TUDAT_BUILD_WITH_EXTENDED_PRECISION_PROPAGATION_TOOLS )
+template class RungeKuttaFixedStepSizeIntegrator < double, VectorXdd, VectorXdd >;
+template class RungeKuttaFixedStepSizeIntegrator < Time, VectorXdd, VectorXdd, long double >;
+#endif
+
 } // namespace numerical_integrators
 } // namespace tudat
 
@@ -9,6 +9,11 @@ template class RungeKuttaVariableStepSizeIntegrator < double, Eigen::VectorXd, E
 template class RungeKuttaVariableStepSizeIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
 template class RungeKuttaVariableStepSizeIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
 
+#if( TUDAT_BUILD_WITH_EXTENDED_PRECISION_PROPAGATION_TOOLS )
+template class RungeKuttaVariableStepSizeIntegrator < double, VectorXdd, VectorXdd >;
+template class RungeKuttaVariableStepSizeIntegrator < Time, VectorXdd, VectorXdd, long double >;
+#endif
+
 } // namespace numerical_integrators
 } // namespace tudat
 
@@ -6,35 +6,44 @@ namespace tudat
 namespace numerical_quadrature
 {
 
-//! Function to create Gauss quadrature node/weight container
+//! Function to retrieve Gauss quadrature node/weight container
 template< typename IndependentVariableType >
 std::shared_ptr< GaussQuadratureNodesAndWeights< IndependentVariableType > >
 getGaussQuadratureNodesAndWeights( )
 {
-    return std::make_shared< GaussQuadratureNodesAndWeights< IndependentVariableType > >( );
+    // Created (once) upon first call; initialization of local static variable is thread-safe
+    static const std::shared_ptr< GaussQuadratureNodesAndWeights< IndependentVariableType > > gaussQuadratureNodesAndWeights =
+            std::make_shared< GaussQuadratureNodesAndWeights< IndependentVariableType > >( );
+    return gaussQuadratureNodesAndWeights;
 }
 
-//! Function to create Gauss quadrature node/weight container with long double precision.
+//! Function to retrieve Gauss quadrature node/weight container with long double precision.
 template< >
 std::shared_ptr< GaussQuadratureNodesAndWeights< long double > >
 getGaussQuadratureNodesAndWeights( )
 {
+    static const std::shared_ptr< GaussQuadratureNodesAndWeights< long double > > longDoubleGaussQuadratureNodesAndWeights =
+            std::make_shared< GaussQuadratureNodesAndWeights< long double > >( );
     return longDoubleGaussQuadratureNodesAndWeights;
 }
 
-//! Function to create Gauss quadrature node/weight container with double precision.
+//! Function to retrieve Gauss quadrature node/weight container with double precision.
 template< >
 std::shared_ptr< GaussQuadratureNodesAndWeights< double > >
 getGaussQuadratureNodesAndWeights( )
 {
+    static const std::shared_ptr< GaussQuadratureNodesAndWeights< double > > doubleGaussQuadratureNodesAndWeights =
+            std::make_shared< GaussQuadratureNodesAndWeights< double > >( );
     return doubleGaussQuadratureNodesAndWeights;
 }
 
-//! Function to create Gauss quadrature node/weight container with float precision.
+//! Function to retrieve Gauss quadrature node/weight container with float precision.
 template< >
 std::shared_ptr< GaussQuadratureNodesAndWeights< float > >
 getGaussQuadratureNodesAndWeights( )
 {
+    static const std::shared_ptr< GaussQuadratureNodesAndWeights< float > > floatGaussQuadratureNodesAndWeights =
+            std::make_shared< GaussQuadratureNodesAndWeights< float > >( );
     return floatGaussQuadratureNodesAndWeights;
 }
 
@@ -42,4 +51,3 @@ getGaussQuadratureNodesAndWeights( )
 } // namespace numerical_quadrature
 
 } // namespace tudat
-
@@ -8,6 +8,10 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/special_functions/erf.hpp>
+
+#include "tudat/basics/parallelization.h"
 #include "tudat/math/statistics/kernelDensityDistribution.h"
 #include "tudat/math/basic/mathematicalConstants.h"
 #include "tudat/math/statistics/basicStatistics.h"
@@ -18,12 +22,30 @@ namespace tudat
 namespace statistics
 {
 
-//! Get probability density
-double EpanechnikovKernelDistribution::evaluatePdf( const double& independentVariable )
+//! Function to evaluate the pdf of a single (one-dimensional) Gaussian kernel
+double evaluateGaussianKernelPdf( const double mean, const double bandWidth, const double independentVariable )
+{
+    // Identical to boost::math::pdf for normal distribution
+    double exponent = independentVariable - mean;
+    exponent *= -exponent;
+    exponent /= 2.0 * bandWidth * bandWidth;
+    return std::exp( exponent ) / ( bandWidth * std::sqrt( 2.0 * boost::math::constants::pi< double >( ) ) );
+}
+
+//! Function to evaluate the cdf of a single (one-dimensional) Gaussian kernel
+double evaluateGaussianKernelCdf( const double mean, const double bandWidth, const double independentVariable )
 {
-    if( ( independentVariable - mean_ ) >= ( -bandWidth_ ) && ( independentVariable - mean_ ) <= ( bandWidth_ ) )
+    // Identical to boost::math::cdf for normal distribution
+    return boost::math::erfc( -( independentVariable - mean ) /
+                              ( bandWidth * boost::math::constants::root_two< double >( ) ) ) / 2.0;
+}
+
+//! Function to evaluate the pdf of a single (one-dimensional) Epanechnikov kernel
+double evaluateEpanechnikovKernelPdf( const double mean, const double bandWidth, const double independentVariable )
+{
+    if( ( independentVariable - mean ) >= ( -bandWidth ) && ( independentVariable - mean ) <= ( bandWidth ) )
     {
-        return ( 3.0 / ( 4.0 * bandWidth_ ) ) * ( 1.0 - std::pow( ( independentVariable - mean_ ) / bandWidth_, 2.0 ) );
+        return ( 3.0 / ( 4.0 * bandWidth ) ) * ( 1.0 - std::pow( ( independentVariable - mean ) / bandWidth, 2.0 ) );
     }
     else
     {
@@ -31,16 +53,16 @@ double EpanechnikovKernelDistribution::evaluatePdf( const double& independentVar
     }
 }
 
-//! Get probability mass
-double EpanechnikovKernelDistribution::evaluateCdf( const double& independentVariable )
+//! Function to evaluate the cdf of a single (one-dimensional) Epanechnikov kernel
+double evaluateEpanechnikovKernelCdf( const double mean, const double bandWidth, const double independentVariable )
 {
-    if( ( independentVariable - mean_ ) >= ( -bandWidth_ ) && ( independentVariable - mean_ ) <= ( bandWidth_ ) )
+    if( ( independentVariable - mean ) >= ( -bandWidth ) && ( independentVariable - mean ) <= ( bandWidth ) )
     {
-        return ( 3.0 / ( 4.0 * bandWidth_ ) ) *
-                ( ( independentVariable - mean_ ) - ( std::pow( ( independentVariable - mean_ ), 3.0 )
-                                                      / ( 3.0 * std::pow( bandWidth_, 2.0 ) ) ) ) + 0.5;
+        return ( 3.0 / ( 4.0 * bandWidth ) ) *
+                ( ( independentVariable - mean ) - ( std::pow( ( independentVariable - mean ), 3.0 )
+                                                      / ( 3.0 * std::pow( bandWidth, 2.0 ) ) ) ) + 0.5;
     }
-    else if( ( independentVariable - mean_ ) < ( -bandWidth_ ) )
+    else if( ( independentVariable - mean ) < ( -bandWidth ) )
     {
         return 0.0;
     }
@@ -51,13 +73,27 @@ double EpanechnikovKernelDistribution::evaluateCdf( const double& independentVar
 
 }
 
+//! Get probability density
+double EpanechnikovKernelDistribution::evaluatePdf( const double& independentVariable )
+{
+    return evaluateEpanechnikovKernelPdf( mean_, bandWidth_, independentVariable );
+}
+
+//! Get probability mass
+double EpanechnikovKernelDistribution::evaluateCdf( const double& independentVariable )
+{
+    return evaluateEpanechnikovKernelCdf( mean_, bandWidth_, independentVariable );
+}
+
 //! Constructor
 KernelDensityDistribution::KernelDensityDistribution(
         const std::vector< Eigen::VectorXd >& samples,
         const double bandWidthFactor,
         const KernelType kernelType,
         const Eigen::VectorXd& standardDeviation,
-        const Eigen::VectorXd& manualBandwidth )
+        const Eigen::VectorXd& manualBandwidth,
+        const int numberOfThreads ):
+    numberOfThreads_( numberOfThreads ), pdfEvaluationTolerance_( 0.0 ), scaledKernelCutoffRadius_( TUDAT_NAN )
 {
     // Load data
     dataSamples_ = samples;
@@ -118,18 +154,25 @@ KernelDensityDistribution::KernelDensityDistribution(
         bandWidth_ = optimalBandwidth_ * bandWidthFactor;
     }
 
-    // Construct kernel matrix rows: samples, cols: dimensions_
+    // Set contiguous sample matrix (cols: samples, rows: dimensions_)
+    sampleMatrix_.resize( dimensions_, numberOfSamples_ );
+    for( int i = 0; i < numberOfSamples_; i++ )
+    {
+        sampleMatrix_.col( i ) = dataSamples_[ i ];
+    }
+
     kernelType_ = kernelType;
+    if( kernelType_ != KernelType::epanechnikov_kernel && kernelType_ != KernelType::gaussian_kernel )
+    {
+        throw std::runtime_error( "Error when constructing probability kernels, kernel type not recognized" );
+    }
 
-    generateKernelPointerMatrix( );
+    resetKernels( );
 }
 
-//! Function that generates the kernel density distribution based on the samples and kernel type that is provided
-void KernelDensityDistribution::generateKernelPointerMatrix( )
+//! Function that checks the bandwidths, and resets the kernel density distribution for the current bandwidths
+void KernelDensityDistribution::resetKernels( )
 {
-    // Clear existing kernels.
-    kernelPointersMatrix_.clear( );
-
     // Check for numerical problems with bandwidths.
     for( int i = 0; i < bandWidth_.rows( ); i++ )
     {
@@ -142,17 +185,41 @@ void KernelDensityDistribution::generateKernelPointerMatrix( )
         }
     }
 
-    // Fill kernel pointer matrix with distribution pointer objects
-    std::vector< std::shared_ptr< ContinuousProbabilityDistribution< double > > > vector( dataSamples_[ 0 ].rows( ) );
+    // Clear tree of samples scaled with previous bandwidth
+    scaledSampleTree_ = nullptr;
+}
 
-    // Iterate over all samples; create kernel for each entry in each sample
-    for( unsigned int i = 0; i < dataSamples_.size( ); i++ )
+//! Function to set the tolerance for approximate evaluation of the pdf
+void KernelDensityDistribution::setPdfEvaluationTolerance( const double pdfEvaluationTolerance )
+{
+    if( !( pdfEvaluationTolerance >= 0.0 && pdfEvaluationTolerance < 1.0 ) )
     {
-        for( unsigned int j = 0; j < vector.size( ); j++ )
-        {
-            vector[ j ] = constructKernel( dataSamples_[ i ]( j ), bandWidth_( j ) );
-        }
-        kernelPointersMatrix_.push_back( vector );
+        throw std::runtime_error( "Error in kernel density distribution, pdf evaluation tolerance " +
+                                  std::to_string( pdfEvaluationTolerance ) + " should be in [0,1)" );
+    }
+    pdfEvaluationTolerance_ = pdfEvaluationTolerance;
+
+    // Set radius (in bandwidths) outside of which kernels are neglected
+    if( kernelType_ == KernelType::gaussian_kernel )
+    {
+        scaledKernelCutoffRadius_ = std::sqrt( -2.0 * std::log( pdfEvaluationTolerance_ ) );
+    }
+    else
+    {
+        // Product of Epanechnikov kernels is zero outside of unit (scaled) box, which is contained in this sphere
+        scaledKernelCutoffRadius_ = std::sqrt( static_cast< double >( dimensions_ ) ) *
+                ( 1.0 + 10.0 * std::numeric_limits< double >::epsilon( ) );
+    }
+}
+
+//! Function to create the k-d tree of the samples (scaled by the bandwidth), if it is required and not yet created
+void KernelDensityDistribution::createScaledSampleTree( )
+{
+    if( pdfEvaluationTolerance_ > 0.0 && scaledSampleTree_ == nullptr )
+    {
+        Eigen::MatrixXd scaledSamples =
+                ( sampleMatrix_.array( ).colwise( ) / bandWidth_.array( ) ).matrix( ).transpose( );
+        scaledSampleTree_ = std::make_shared< basic_mathematics::KdTree< Eigen::Dynamic > >( scaledSamples );
     }
 }
 
@@ -195,20 +262,24 @@ void KernelDensityDistribution::scaleSamplesWithVariance(
 //! Compute the optimal bandwidth
 void KernelDensityDistribution::computeOptimalBandWidth( )
 {
-    optimalBandwidth_ = Eigen::VectorXd::Zero( dimensions_, 1);
-
-    // Calculate sigma (median absolute deviation estimator)
-    Eigen::VectorXd medianOfSamples = getMedian( dataSamples_ );
-
-    std::vector< Eigen::VectorXd > dataSamples2( dataSamples_.size( ) );
-    for( unsigned int i = 0; i < dataSamples_.size( ); i++ )
+    // Calculate sigma (median absolute deviation estimator), independently for each dimension
+    Eigen::VectorXd sigma = Eigen::VectorXd::Zero( dimensions_ );
+    utilities::executeParallelTasks(
+                dimensions_, [ & ]( const int currentDimension )
     {
-        dataSamples2[ i ] = dataSamples_[ i ] - medianOfSamples;
-        dataSamples2[ i ] = dataSamples2[ i ].cwiseAbs( );
-    }
+        std::vector< double > dimensionSamples( dataSamples_.size( ) );
+        for( unsigned int i = 0; i < dataSamples_.size( ); i++ )
+        {
+            dimensionSamples[ i ] = dataSamples_[ i ]( currentDimension );
+        }
+        double medianOfSamples = computeSampleMedian( dimensionSamples );
 
-    Eigen::VectorXd medianOfSamples2 = getMedian( dataSamples2 );
-    Eigen::VectorXd sigma = medianOfSamples2 / 0.6745;
+        for( unsigned int i = 0; i < dataSamples_.size( ); i++ )
+        {
+            dimensionSamples[ i ] = std::fabs( dimensionSamples[ i ] - medianOfSamples );
+        }
+        sigma( currentDimension ) = computeSampleMedian( dimensionSamples ) / 0.6745;
+    }, numberOfThreads_ );
 
     // Calculate optimal Bandwidth
     optimalBandwidth_ = std::pow( 4.0 / ( ( static_cast< double >( dimensions_ ) + 2.0 ) *
@@ -216,60 +287,37 @@ void KernelDensityDistribution::computeOptimalBandWidth( )
                                   1.0 / ( static_cast< double >( dimensions_ )  + 4.0 ) ) * sigma;
 }
 
-//! Function to retrieve the sample set median
-Eigen::VectorXd KernelDensityDistribution::getMedian(
-        const std::vector< Eigen::VectorXd >& samples )
+//! Function to compute the pdf (exactly, or approximately using the k-d tree, if it has been created)
+double KernelDensityDistribution::computePdf( const Eigen::VectorXd& independentVariables ) const
 {
-    int sampleDimensions = samples[ 0 ].rows( );
-    std::vector< std::vector< double > > dataSamplesVectors( sampleDimensions );
+    double propbabilityDensity = 0.0;
 
-    // Create vector of j^th entry from each sample
-    std::vector< double > data( 0 );
-    for( int i = 0; i < sampleDimensions; i++ )
+    if( scaledSampleTree_ == nullptr )
     {
-        for( unsigned int j = 0; j < samples.size( ); j++ )
+        // Iterative over all kernels
+        for( int i = 0; i < numberOfSamples_; i++ )
         {
-            data.push_back( samples[ j ]( i ) );
+            propbabilityDensity += evaluateKernelPdf( i, independentVariables );
         }
-        dataSamplesVectors[ i ] = data;
-        data.clear( );
     }
-
-    // Compute sample median for each entry of samples.
-    Eigen::VectorXd medianOfSamples( sampleDimensions );
-    for( int i = 0; i < sampleDimensions; i++ )
+    else
     {
-        medianOfSamples[ i ] = tudat::statistics::computeSampleMedian( dataSamplesVectors[ i ] );
-    }
-    return medianOfSamples;
-}
-
-//! Get probability density of the kernel density distribution
-double KernelDensityDistribution::evaluatePdf( const Eigen::VectorXd& independentVariables )
-{
-    double propbabilityDensity = 0.0;
-    double currentKernelPdf = 1.0;
-
-    // Iterative over all kernels
-    for( int i = 0; i < numberOfSamples_; i++ )
-    {     
-        currentKernelPdf = 1.0;
-
-        // Compute pdf of current kernel
-        for( int currentDimension = 0; currentDimension < dimensions_; currentDimension++ )
+        // Iterate over kernels close to independent variables
+        std::vector< basic_mathematics::KdTree< Eigen::Dynamic >::NeighbourType > nearbySamples =
+                scaledSampleTree_->findNeighboursWithinRadius(
+                    independentVariables.cwiseQuotient( bandWidth_ ), scaledKernelCutoffRadius_ );
+        for( unsigned int i = 0; i < nearbySamples.size( ); i++ )
         {
-            currentKernelPdf *= kernelPointersMatrix_[ i ][ currentDimension ]->evaluatePdf(
-                        independentVariables( currentDimension ) );
+            propbabilityDensity += evaluateKernelPdf( nearbySamples[ i ].first, independentVariables );
         }
-        propbabilityDensity += currentKernelPdf;
     }
 
     // Average over all kernels
     return propbabilityDensity / static_cast< double >( numberOfSamples_ );
 }
 
-//! Get cumulative probability of the kernel density distribution
-double KernelDensityDistribution::evaluateCdf( const Eigen::VectorXd& independentVariables )
+//! Function to compute the cdf
+double KernelDensityDistribution::computeCdf( const Eigen::VectorXd& independentVariables ) const
 {
     double cumulativeProbability = 0.0;
     double currentKernelCdf = 1.0;
@@ -282,8 +330,7 @@ double KernelDensityDistribution::evaluateCdf( const Eigen::VectorXd& independen
         // Compute cdf of current kernel
         for( int currentDimension = 0; currentDimension < dimensions_; currentDimension++ )
         {
-            currentKernelCdf *= kernelPointersMatrix_[ i ][ currentDimension ]->evaluateCdf(
-                        independentVariables( currentDimension ) );
+            currentKernelCdf *= evaluateKernelCdf( i, currentDimension, independentVariables( currentDimension ) );
         }
         cumulativeProbability += currentKernelCdf;
     }
@@ -292,6 +339,45 @@ double KernelDensityDistribution::evaluateCdf( const Eigen::VectorXd& independen
     return cumulativeProbability / static_cast< double >( numberOfSamples_ );
 }
 
+//! Get probability density of the kernel density distribution
+double KernelDensityDistribution::evaluatePdf( const Eigen::VectorXd& independentVariables )
+{
+    createScaledSampleTree( );
+    return computePdf( independentVariables );
+}
+
+//! Get cumulative probability of the kernel density distribution
+double KernelDensityDistribution::evaluateCdf( const Eigen::VectorXd& independentVariables )
+{
+    return computeCdf( independentVariables );
+}
+
+//! Function to evaluate pdf of distribution at a set of points
+Eigen::VectorXd KernelDensityDistribution::evaluatePdfs( const Eigen::MatrixXd& independentVariables )
+{
+    createScaledSampleTree( );
+
+    Eigen::VectorXd probabilityDensities( independentVariables.cols( ) );
+    utilities::executeParallelTasks(
+                independentVariables.cols( ), [ & ]( const int i )
+    {
+        probabilityDensities( i ) = computePdf( independentVariables.col( i ) );
+    }, numberOfThreads_ );
+    return probabilityDensities;
+}
+
+//! Function to evaluate cdf of distribution at a set of points
+Eigen::VectorXd KernelDensityDistribution::evaluateCdfs( const Eigen::MatrixXd& independentVariables )
+{
+    Eigen::VectorXd cumulativeProbabilities( independentVariables.cols( ) );
+    utilities::executeParallelTasks(
+                independentVariables.cols( ), [ & ]( const int i )
+    {
+        cumulativeProbabilities( i ) = computeCdf( independentVariables.col( i ) );
+    }, numberOfThreads_ );
+    return cumulativeProbabilities;
+}
+
 //! Get cumulative probability of marginal distribution
 double KernelDensityDistribution::evaluateCumulativeMarginalProbability(
         const int marginalDimension, const double independentVariable )
@@ -300,7 +386,7 @@ double KernelDensityDistribution::evaluateCumulativeMarginalProbability(
     double cumulativeProbability = 0.0;
     for( int i = 0; i < numberOfSamples_; i++ )
     {
-        cumulativeProbability += kernelPointersMatrix_[ i ][ marginalDimension ]->evaluateCdf( independentVariable );
+        cumulativeProbability += evaluateKernelCdf( i, marginalDimension, independentVariable );
     }
     return cumulativeProbability / static_cast< double >( numberOfSamples_ );
 }
@@ -320,7 +406,7 @@ double KernelDensityDistribution::evaluateMarginalProbabilityDensity(
         // Compute marginal pdf for current kernel
         for( unsigned int j = 0; j < marginalDimensions.size( ); j++ )
         {
-            marginalPdfOfCurrentKernel *= kernelPointersMatrix_[ i ][ marginalDimensions[ j ] ]->evaluatePdf( independentVariables( j ) );
+            marginalPdfOfCurrentKernel *= evaluateKernelPdf( i, marginalDimensions[ j ], independentVariables( j ) );
         }
 
         probabilityDensity += marginalPdfOfCurrentKernel;
@@ -339,7 +425,7 @@ double KernelDensityDistribution::evaluateMarginalProbabilityDensity(
     // Compute pdf at independentVariable in marginalDimension, averaged over all samples
     for( int i = 0; i < numberOfSamples_; i++ )
     {
-        probabilityDensity += kernelPointersMatrix_[ i ][ marginalDimension ]->evaluatePdf( independentVariable );
+        probabilityDensity += evaluateKernelPdf( i, marginalDimension, independentVariable );
     }
     return probabilityDensity / static_cast< double >( numberOfSamples_ );
 }
@@ -367,14 +453,14 @@ double KernelDensityDistribution::evaluateCumulativeConditionalMarginalProbabili
 
         for( unsigned int j = 0; j < conditionDimensions.size( ); j++ )
         {
-            marginalConditionalCdfOfCurrentKernel *= kernelPointersMatrix_[ i ][ conditionDimensions[ j ] ]->evaluateCdf( conditions[ j ] );
+            marginalConditionalCdfOfCurrentKernel *= evaluateKernelCdf( i, conditionDimensions[ j ], conditions[ j ] );
         }
 
         // Current value of marginalConditionalCdfOfCurrentKernel is the marginal cdf at the given conditional
         normalizationFactor += marginalConditionalCdfOfCurrentKernel;
 
         // Compute cdf for current kernel at marginal dimension
-        marginalConditionalCdfOfCurrentKernel *= kernelPointersMatrix_[ i ][ marginalDimension ]->evaluateCdf( independentVariable );
+        marginalConditionalCdfOfCurrentKernel *= evaluateKernelCdf( i, marginalDimension, independentVariable );
         marginalValue += marginalConditionalCdfOfCurrentKernel;
     }
 
@@ -404,7 +490,7 @@ double KernelDensityDistribution::evaluateConditionalMarginalProbabilityDensity(
         for( unsigned int j = 0; j < conditionDimensions.size( ); j++ )
         {
             marginalConditionalPdfOfCurrentKernel *=
-                    kernelPointersMatrix_[ i ][ conditionDimensions[ j ] ]->evaluatePdf( conditions[ j ] );
+                    evaluateKernelPdf( i, conditionDimensions[ j ], conditions[ j ] );
         }
 
         // Current value of marginalConditionalPdfOfCurrentKernel is the marginal pdf at the given conditional
@@ -412,7 +498,7 @@ double KernelDensityDistribution::evaluateConditionalMarginalProbabilityDensity(
 
         // Compute pdf for current kernel at marginal dimension
         marginalConditionalPdfOfCurrentKernel *=
-                kernelPointersMatrix_[ i ][ marginalDimension ]->evaluatePdf( independentVariable );
+                evaluateKernelPdf( i, marginalDimension, independentVariable );
         marginalValue += marginalConditionalPdfOfCurrentKernel;
     }
 
@@ -8,6 +8,7 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <algorithm>
 #include <cmath>
 
 #include <boost/random.hpp>
@@ -17,6 +18,7 @@
 #include <gsl/gsl_qrng.h>
 #endif
 
+#include "tudat/basics/parallelization.h"
 #include "tudat/math/statistics/randomSampling.h"
 namespace tudat
 {
@@ -24,6 +26,34 @@ namespace tudat
 namespace statistics
 {
 
+//! Function to fill the columns of a matrix with samples, each generated from its own random number stream
+template< typename DistributionType >
+void fillRandomMatrixFromStreams(
+        Eigen::MatrixXd& randomMatrix, const uint64_t seed, const DistributionType& distribution,
+        const int numberOfThreads, const uint64_t firstSampleIndex )
+{
+    // Distribute blocks of columns over threads, to limit the overhead per task
+    static const int numberOfColumnsPerTask = 256;
+    const int numberOfColumns = randomMatrix.cols( );
+    const int numberOfTasks = ( numberOfColumns + numberOfColumnsPerTask - 1 ) / numberOfColumnsPerTask;
+
+    utilities::executeParallelTasks(
+                numberOfTasks, [ & ]( const int taskIndex )
+    {
+        DistributionType columnDistribution = distribution;
+        const int lastColumn = std::min( ( taskIndex + 1 ) * numberOfColumnsPerTask, numberOfColumns );
+        for( int j = taskIndex * numberOfColumnsPerTask; j < lastColumn; j++ )
+        {
+            PhiloxRandomNumberGenerator columnGenerator( seed, firstSampleIndex + j );
+            columnDistribution.reset( );
+            for( int i = 0; i < randomMatrix.rows( ); i++ )
+            {
+                randomMatrix( i, j ) = columnDistribution( columnGenerator );
+            }
+        }
+    }, numberOfThreads );
+}
+
 //! Generate sample of random vectors, with entries of each vector independently, but not identically, distributed.
 std::vector< Eigen::VectorXd > generateRandomSampleFromGenerator(
         const int numberOfSamples,
@@ -137,6 +167,28 @@ std::vector< Eigen::VectorXd > generateGaussianRandomSample(
 }
 
 
+//! Fill matrix with independently and identically uniformly distributed random numbers.
+void fillUniformRandomMatrix(
+        Eigen::MatrixXd& randomMatrix, const uint64_t seed,
+        const double lowerBound, const double upperBound,
+        const int numberOfThreads, const uint64_t firstSampleIndex )
+{
+    fillRandomMatrixFromStreams(
+                randomMatrix, seed, boost::random::uniform_real_distribution< double >( lowerBound, upperBound ),
+                numberOfThreads, firstSampleIndex );
+}
+
+//! Fill matrix with independently and identically Gaussian distributed random numbers.
+void fillGaussianRandomMatrix(
+        Eigen::MatrixXd& randomMatrix, const uint64_t seed,
+        const double mean, const double standardDeviation,
+        const int numberOfThreads, const uint64_t firstSampleIndex )
+{
+    fillRandomMatrixFromStreams(
+                randomMatrix, seed, boost::random::normal_distribution< double >( mean, standardDeviation ),
+                numberOfThreads, firstSampleIndex );
+}
+
 #if USE_GSL
 
 //! Generator random vector using Sobol sampler
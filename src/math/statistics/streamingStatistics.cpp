@@ -0,0 +1,435 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "tudat/math/basic/mathematicalConstants.h"
+#include "tudat/math/statistics/streamingStatistics.h"
+
+namespace tudat
+{
+
+namespace statistics
+{
+
+//! Constructor
+StreamingQuantileSketch::StreamingQuantileSketch( const double compression ):
+    compression_( compression ),
+    totalWeight_( 0.0 ),
+    minimum_( std::numeric_limits< double >::infinity( ) ),
+    maximum_( -std::numeric_limits< double >::infinity( ) )
+{
+    if( !( compression_ > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating quantile sketch, compression must be positive" );
+    }
+    maximumBufferSize_ = static_cast< unsigned int >( 5.0 * std::ceil( compression_ ) );
+    buffer_.reserve( maximumBufferSize_ );
+}
+
+//! Function to merge another sketch into this sketch
+void StreamingQuantileSketch::merge( const StreamingQuantileSketch& otherSketch )
+{
+    otherSketch.mergeBuffer( );
+    for( unsigned int i = 0; i < otherSketch.centroids_.size( ); i++ )
+    {
+        addCentroid( otherSketch.centroids_.at( i ).first, otherSketch.centroids_.at( i ).second );
+    }
+    minimum_ = std::min( minimum_, otherSketch.minimum_ );
+    maximum_ = std::max( maximum_, otherSketch.maximum_ );
+}
+
+//! Function to retrieve an estimate of a quantile of the samples
+double StreamingQuantileSketch::getQuantile( const double quantile ) const
+{
+    if( quantile < 0.0 || quantile > 1.0 )
+    {
+        throw std::runtime_error( "Error when retrieving quantile from sketch, quantile " + std::to_string( quantile ) +
+                                  " is not between 0 and 1" );
+    }
+
+    mergeBuffer( );
+    if( centroids_.size( ) == 0 )
+    {
+        return TUDAT_NAN;
+    }
+    else if( centroids_.size( ) == 1 )
+    {
+        return centroids_.at( 0 ).first;
+    }
+
+    // Each centroid represents the cumulative weight at its center; interpolate between centers (or the extreme values)
+    double targetWeight = quantile * totalWeight_;
+    double centerWeight = 0.5 * centroids_.at( 0 ).second;
+    if( targetWeight <= centerWeight )
+    {
+        return minimum_ + ( centroids_.at( 0 ).first - minimum_ ) * targetWeight / centerWeight;
+    }
+
+    for( unsigned int i = 0; i < centroids_.size( ) - 1; i++ )
+    {
+        double nextCenterWeight = centerWeight + 0.5 * ( centroids_.at( i ).second + centroids_.at( i + 1 ).second );
+        if( targetWeight <= nextCenterWeight )
+        {
+            return centroids_.at( i ).first + ( centroids_.at( i + 1 ).first - centroids_.at( i ).first ) *
+                    ( targetWeight - centerWeight ) / ( nextCenterWeight - centerWeight );
+        }
+        centerWeight = nextCenterWeight;
+    }
+
+    return centroids_.back( ).first + ( maximum_ - centroids_.back( ).first ) *
+            ( targetWeight - centerWeight ) / ( totalWeight_ - centerWeight );
+}
+
+//! Function to append the contents of the sketch to a list of values (for communication between processes)
+void StreamingQuantileSketch::serialize( std::vector< double >& data ) const
+{
+    mergeBuffer( );
+    data.push_back( totalWeight_ );
+    data.push_back( minimum_ );
+    data.push_back( maximum_ );
+    data.push_back( static_cast< double >( centroids_.size( ) ) );
+    for( unsigned int i = 0; i < centroids_.size( ); i++ )
+    {
+        data.push_back( centroids_.at( i ).first );
+        data.push_back( centroids_.at( i ).second );
+    }
+}
+
+//! Function to reset the contents of the sketch from a list of values, as created by serialize
+void StreamingQuantileSketch::deserialize( const std::vector< double >& data, int& currentIndex )
+{
+    totalWeight_ = data.at( currentIndex++ );
+    minimum_ = data.at( currentIndex++ );
+    maximum_ = data.at( currentIndex++ );
+    int numberOfCentroids = static_cast< int >( data.at( currentIndex++ ) );
+
+    buffer_.clear( );
+    centroids_.resize( numberOfCentroids );
+    for( int i = 0; i < numberOfCentroids; i++ )
+    {
+        centroids_[ i ].first = data.at( currentIndex++ );
+        centroids_[ i ].second = data.at( currentIndex++ );
+    }
+}
+
+//! Function to add a weighted centroid to the buffer, merging the buffer if it is full
+void StreamingQuantileSketch::addCentroid( const double mean, const double weight )
+{
+    buffer_.push_back( std::make_pair( mean, weight ) );
+    totalWeight_ += weight;
+    minimum_ = std::min( minimum_, mean );
+    maximum_ = std::max( maximum_, mean );
+
+    if( buffer_.size( ) >= maximumBufferSize_ )
+    {
+        mergeBuffer( );
+    }
+}
+
+//! Function to merge the buffer into the list of centroids
+void StreamingQuantileSketch::mergeBuffer( ) const
+{
+    if( buffer_.size( ) == 0 )
+    {
+        return;
+    }
+
+    buffer_.insert( buffer_.end( ), centroids_.begin( ), centroids_.end( ) );
+    std::sort( buffer_.begin( ), buffer_.end( ) );
+    centroids_.clear( );
+
+    // Merge neighbouring centroids, as long as the merged centroid does not span more than a unit of the scale function
+    double mergedWeight = 0.0;
+    double weightLimit = totalWeight_ * computeInverseScaleFunction( computeScaleFunction( 0.0 ) + 1.0 );
+    std::pair< double, double > currentCentroid = buffer_.at( 0 );
+    for( unsigned int i = 1; i < buffer_.size( ); i++ )
+    {
+        if( mergedWeight + currentCentroid.second + buffer_.at( i ).second <= weightLimit )
+        {
+            currentCentroid.second += buffer_.at( i ).second;
+            currentCentroid.first += ( buffer_.at( i ).first - currentCentroid.first ) *
+                    buffer_.at( i ).second / currentCentroid.second;
+        }
+        else
+        {
+            mergedWeight += currentCentroid.second;
+            centroids_.push_back( currentCentroid );
+            weightLimit = totalWeight_ * computeInverseScaleFunction(
+                        computeScaleFunction( mergedWeight / totalWeight_ ) + 1.0 );
+            currentCentroid = buffer_.at( i );
+        }
+    }
+    centroids_.push_back( currentCentroid );
+    buffer_.clear( );
+}
+
+//! Function to compute the scale function k( q ) of the t-digest, with q the normalized cumulative weight
+double StreamingQuantileSketch::computeScaleFunction( const double normalizedWeight ) const
+{
+    return compression_ / ( 2.0 * mathematical_constants::PI ) *
+            std::asin( std::min( std::max( 2.0 * normalizedWeight - 1.0, -1.0 ), 1.0 ) );
+}
+
+//! Function to compute the inverse of the scale function of the t-digest
+double StreamingQuantileSketch::computeInverseScaleFunction( const double scaleFunction ) const
+{
+    if( scaleFunction >= 0.25 * compression_ )
+    {
+        return 1.0;
+    }
+    return 0.5 * ( std::sin( 2.0 * mathematical_constants::PI * scaleFunction / compression_ ) + 1.0 );
+}
+
+//! Constructor
+StreamingSampleStatistics::StreamingSampleStatistics( const int sampleSize, const double quantileCompression ):
+    quantileCompression_( quantileCompression )
+{
+    if( sampleSize < 0 )
+    {
+        throw std::runtime_error( "Error when creating streaming statistics, sample size must not be negative" );
+    }
+    resetSampleSize( sampleSize );
+}
+
+//! Function to add a single sample
+void StreamingSampleStatistics::addSample( const Eigen::VectorXd& sample )
+{
+    if( sample.rows( ) != sampleSize_ )
+    {
+        if( numberOfSamples_ == 0 )
+        {
+            resetSampleSize( sample.rows( ) );
+        }
+        else
+        {
+            throw std::runtime_error( "Error when adding sample to streaming statistics, sample size (" +
+                                      std::to_string( sample.rows( ) ) + ") is incompatible with previous samples (" +
+                                      std::to_string( sampleSize_ ) + ")" );
+        }
+    }
+
+    // Update mean and sum of squared deviations (Welford, 1962)
+    numberOfSamples_++;
+    Eigen::VectorXd deviationFromPreviousMean = sample - mean_;
+    mean_ += deviationFromPreviousMean / static_cast< double >( numberOfSamples_ );
+    sumOfSquaredDeviations_.noalias( ) += deviationFromPreviousMean * ( sample - mean_ ).transpose( );
+
+    minimum_ = minimum_.cwiseMin( sample );
+    maximum_ = maximum_.cwiseMax( sample );
+    for( unsigned int i = 0; i < quantileSketches_.size( ); i++ )
+    {
+        quantileSketches_[ i ].addSample( sample( i ) );
+    }
+}
+
+//! Function to merge the statistics of another object into this object
+void StreamingSampleStatistics::merge( const StreamingSampleStatistics& otherStatistics )
+{
+    if( otherStatistics.numberOfSamples_ == 0 )
+    {
+        return;
+    }
+    else if( numberOfSamples_ == 0 )
+    {
+        *this = otherStatistics;
+        return;
+    }
+    else if( otherStatistics.sampleSize_ != sampleSize_ )
+    {
+        throw std::runtime_error( "Error when merging streaming statistics, sample sizes (" +
+                                  std::to_string( sampleSize_ ) + " and " +
+                                  std::to_string( otherStatistics.sampleSize_ ) + ") are incompatible" );
+    }
+
+    // Update mean and sum of squared deviations (Chan et al., 1979)
+    double numberOfSamples = static_cast< double >( numberOfSamples_ );
+    double otherNumberOfSamples = static_cast< double >( otherStatistics.numberOfSamples_ );
+    double totalNumberOfSamples = numberOfSamples + otherNumberOfSamples;
+    Eigen::VectorXd meanDifference = otherStatistics.mean_ - mean_;
+
+    mean_ += meanDifference * otherNumberOfSamples / totalNumberOfSamples;
+    sumOfSquaredDeviations_ += otherStatistics.sumOfSquaredDeviations_ +
+            meanDifference * meanDifference.transpose( ) * numberOfSamples * otherNumberOfSamples / totalNumberOfSamples;
+    numberOfSamples_ += otherStatistics.numberOfSamples_;
+
+    minimum_ = minimum_.cwiseMin( otherStatistics.minimum_ );
+    maximum_ = maximum_.cwiseMax( otherStatistics.maximum_ );
+    if( quantileSketches_.size( ) != otherStatistics.quantileSketches_.size( ) )
+    {
+        quantileSketches_.clear( );
+    }
+    for( unsigned int i = 0; i < quantileSketches_.size( ); i++ )
+    {
+        quantileSketches_[ i ].merge( otherStatistics.quantileSketches_.at( i ) );
+    }
+}
+
+//! Function to combine the statistics computed by the processes of a group
+void StreamingSampleStatistics::mergeOverProcesses(
+        const std::shared_ptr< utilities::ProcessCommunicator > processCommunicator )
+{
+    std::vector< StreamingSampleStatistics > statistics = { *this };
+    mergeStatisticsOverProcesses( statistics, processCommunicator );
+    *this = statistics.at( 0 );
+}
+
+//! Function to retrieve the (unbiased) sample covariance
+Eigen::MatrixXd StreamingSampleStatistics::getCovariance( ) const
+{
+    if( numberOfSamples_ < 2 )
+    {
+        return Eigen::MatrixXd::Constant( sampleSize_, sampleSize_, TUDAT_NAN );
+    }
+    return sumOfSquaredDeviations_ / static_cast< double >( numberOfSamples_ - 1 );
+}
+
+//! Function to retrieve an estimate of a quantile of a single entry
+double StreamingSampleStatistics::getQuantile( const int entryIndex, const double quantile ) const
+{
+    if( quantileSketches_.size( ) == 0 && sampleSize_ > 0 )
+    {
+        throw std::runtime_error( "Error when retrieving quantile from streaming statistics, no quantiles are computed" );
+    }
+    else if( entryIndex < 0 || entryIndex >= sampleSize_ )
+    {
+        throw std::runtime_error( "Error when retrieving quantile from streaming statistics, entry " +
+                                  std::to_string( entryIndex ) + " is not available" );
+    }
+    return quantileSketches_.at( entryIndex ).getQuantile( quantile );
+}
+
+//! Function to retrieve an estimate of a quantile of all entries
+Eigen::VectorXd StreamingSampleStatistics::getQuantiles( const double quantile ) const
+{
+    Eigen::VectorXd quantiles = Eigen::VectorXd::Zero( sampleSize_ );
+    for( int i = 0; i < sampleSize_; i++ )
+    {
+        quantiles( i ) = getQuantile( i, quantile );
+    }
+    return quantiles;
+}
+
+//! Function to append the contents of the object to a list of values (for communication between processes)
+void StreamingSampleStatistics::serialize( std::vector< double >& data ) const
+{
+    data.push_back( static_cast< double >( sampleSize_ ) );
+    data.push_back( static_cast< double >( numberOfSamples_ ) );
+    data.push_back( static_cast< double >( quantileSketches_.size( ) ) );
+    data.insert( data.end( ), mean_.data( ), mean_.data( ) + mean_.size( ) );
+    data.insert( data.end( ), sumOfSquaredDeviations_.data( ),
+                 sumOfSquaredDeviations_.data( ) + sumOfSquaredDeviations_.size( ) );
+    data.insert( data.end( ), minimum_.data( ), minimum_.data( ) + minimum_.size( ) );
+    data.insert( data.end( ), maximum_.data( ), maximum_.data( ) + maximum_.size( ) );
+    for( unsigned int i = 0; i < quantileSketches_.size( ); i++ )
+    {
+        quantileSketches_.at( i ).serialize( data );
+    }
+}
+
+//! Function to reset the contents of the object from a list of values, as created by serialize
+void StreamingSampleStatistics::deserialize( const std::vector< double >& data, int& currentIndex )
+{
+    resetSampleSize( static_cast< int >( data.at( currentIndex++ ) ) );
+    numberOfSamples_ = static_cast< int >( data.at( currentIndex++ ) );
+    unsigned int numberOfQuantileSketches = static_cast< unsigned int >( data.at( currentIndex++ ) );
+
+    mean_ = Eigen::Map< const Eigen::VectorXd >( data.data( ) + currentIndex, sampleSize_ );
+    currentIndex += sampleSize_;
+    sumOfSquaredDeviations_ = Eigen::Map< const Eigen::MatrixXd >( data.data( ) + currentIndex, sampleSize_, sampleSize_ );
+    currentIndex += sampleSize_ * sampleSize_;
+    minimum_ = Eigen::Map< const Eigen::VectorXd >( data.data( ) + currentIndex, sampleSize_ );
+    currentIndex += sampleSize_;
+    maximum_ = Eigen::Map< const Eigen::VectorXd >( data.data( ) + currentIndex, sampleSize_ );
+    currentIndex += sampleSize_;
+
+    if( numberOfQuantileSketches != quantileSketches_.size( ) )
+    {
+        throw std::runtime_error( "Error when reading streaming statistics, quantile settings are incompatible" );
+    }
+    for( unsigned int i = 0; i < quantileSketches_.size( ); i++ )
+    {
+        quantileSketches_[ i ].deserialize( data, currentIndex );
+    }
+}
+
+//! Function to set the size of the samples, and reset the statistics
+void StreamingSampleStatistics::resetSampleSize( const int sampleSize )
+{
+    sampleSize_ = sampleSize;
+    numberOfSamples_ = 0;
+    mean_ = Eigen::VectorXd::Zero( sampleSize_ );
+    sumOfSquaredDeviations_ = Eigen::MatrixXd::Zero( sampleSize_, sampleSize_ );
+    minimum_ = Eigen::VectorXd::Constant( sampleSize_, std::numeric_limits< double >::infinity( ) );
+    maximum_ = Eigen::VectorXd::Constant( sampleSize_, -std::numeric_limits< double >::infinity( ) );
+
+    quantileSketches_.clear( );
+    if( quantileCompression_ > 0.0 )
+    {
+        quantileSketches_.resize( sampleSize_, StreamingQuantileSketch( quantileCompression_ ) );
+    }
+}
+
+//! Function to combine a list of statistics computed by the processes of a group
+void mergeStatisticsOverProcesses( std::vector< StreamingSampleStatistics >& statistics,
+                                   const std::shared_ptr< utilities::ProcessCommunicator > processCommunicator )
+{
+    int numberOfProcesses = processCommunicator->getNumberOfProcesses( );
+    int processIndex = processCommunicator->getProcessIndex( );
+    if( numberOfProcesses == 1 )
+    {
+        return;
+    }
+
+    std::vector< double > localData;
+    for( unsigned int i = 0; i < statistics.size( ); i++ )
+    {
+        statistics.at( i ).serialize( localData );
+    }
+
+    // Gather the (variable-size) data of all processes, by summing zero-padded lists
+    std::vector< double > dataSizes( numberOfProcesses, 0.0 );
+    dataSizes[ processIndex ] = static_cast< double >( localData.size( ) );
+    processCommunicator->sumOverProcesses( dataSizes.data( ), numberOfProcesses );
+
+    std::vector< int > dataOffsets( numberOfProcesses + 1, 0 );
+    for( int i = 0; i < numberOfProcesses; i++ )
+    {
+        dataOffsets[ i + 1 ] = dataOffsets.at( i ) + static_cast< int >( dataSizes.at( i ) );
+    }
+    std::vector< double > allData( dataOffsets.back( ), 0.0 );
+    std::copy( localData.begin( ), localData.end( ), allData.begin( ) + dataOffsets.at( processIndex ) );
+    processCommunicator->sumOverProcesses( allData.data( ), allData.size( ) );
+
+    // Merge the contributions in order of process index
+    std::vector< StreamingSampleStatistics > processStatistics = statistics;
+    for( unsigned int i = 0; i < statistics.size( ); i++ )
+    {
+        statistics[ i ].reset( );
+    }
+    for( int i = 0; i < numberOfProcesses; i++ )
+    {
+        int currentIndex = dataOffsets.at( i );
+        for( unsigned int j = 0; j < statistics.size( ); j++ )
+        {
+            processStatistics[ j ].deserialize( allData, currentIndex );
+            statistics[ j ].merge( processStatistics.at( j ) );
+        }
+    }
+}
+
+} // namespace statistics
+
+} // namespace tudat
@@ -8,8 +8,17 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
-
+#include <iostream>
+#include <set>
+
+#include "tudat/astro/aerodynamics/tabulatedAtmosphere.h"
+#include "tudat/astro/ephemerides/constantRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/directionBasedRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/fullPlanetaryRotationModel.h"
+#include "tudat/astro/ephemerides/interpolatedRotationalEphemeris.h"
 #include "tudat/astro/ephemerides/synchronousRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/tabulatedRotationalEphemeris.h"
+#include "tudat/math/interpolators/createInterpolator.h"
 #include "tudat/simulation/environment_setup/body.h"
 
 namespace tudat
@@ -20,6 +29,228 @@ namespace simulation_setup
 
 void Body::getPositionByReference( Eigen::Vector3d& position ) { position = currentState_.segment( 0, 3 ); }
 
+namespace
+{
+
+//! Function to copy a tabulated ephemeris, with its own interpolator look-up state (returns nullptr if not of given type)
+template< typename StateScalarType, typename TimeType >
+std::shared_ptr< ephemerides::Ephemeris > copyTabulatedEphemeris( const std::shared_ptr< ephemerides::Ephemeris > ephemeris )
+{
+    std::shared_ptr< ephemerides::TabulatedCartesianEphemeris< StateScalarType, TimeType > > tabulatedEphemeris =
+            std::dynamic_pointer_cast< ephemerides::TabulatedCartesianEphemeris< StateScalarType, TimeType > >( ephemeris );
+    if( tabulatedEphemeris == nullptr )
+    {
+        return nullptr;
+    }
+
+    typename ephemerides::TabulatedCartesianEphemeris< StateScalarType, TimeType >::StateInterpolatorPointer interpolator =
+            tabulatedEphemeris->getInterpolator( );
+    return std::make_shared< ephemerides::TabulatedCartesianEphemeris< StateScalarType, TimeType > >(
+                ( interpolator == nullptr ) ? nullptr : interpolators::cloneCursor( interpolator ),
+                tabulatedEphemeris->getReferenceFrameOrigin( ), tabulatedEphemeris->getReferenceFrameOrientation( ) );
+}
+
+//! Function to copy an ephemeris for use in a replica of a body, sharing it if it has no per-evaluation state
+std::shared_ptr< ephemerides::Ephemeris > copyEphemerisForReplica( const std::shared_ptr< ephemerides::Ephemeris > ephemeris )
+{
+    std::shared_ptr< ephemerides::Ephemeris > copiedEphemeris;
+    if( ephemeris == nullptr )
+    {
+        return nullptr;
+    }
+    else if( ( copiedEphemeris = copyTabulatedEphemeris< double, double >( ephemeris ) ) != nullptr ||
+             ( copiedEphemeris = copyTabulatedEphemeris< long double, double >( ephemeris ) ) != nullptr ||
+             ( copiedEphemeris = copyTabulatedEphemeris< double, Time >( ephemeris ) ) != nullptr ||
+             ( copiedEphemeris = copyTabulatedEphemeris< long double, Time >( ephemeris ) ) != nullptr )
+    {
+        return copiedEphemeris;
+    }
+    else if( std::shared_ptr< ephemerides::MultiArcEphemeris > multiArcEphemeris =
+             std::dynamic_pointer_cast< ephemerides::MultiArcEphemeris >( ephemeris ) )
+    {
+        // Arc start times are the arc split times, excluding the final (open) bound
+        std::vector< std::shared_ptr< ephemerides::Ephemeris > > singleArcEphemerides =
+                multiArcEphemeris->getSingleArcEphemerides( );
+        std::vector< double > arcSplitTimes = multiArcEphemeris->getArcSplitTimes( );
+        std::map< double, std::shared_ptr< ephemerides::Ephemeris > > copiedSingleArcEphemerides;
+        for( unsigned int i = 0; i < singleArcEphemerides.size( ); i++ )
+        {
+            copiedSingleArcEphemerides[ arcSplitTimes.at( i ) ] = copyEphemerisForReplica( singleArcEphemerides.at( i ) );
+        }
+        return std::make_shared< ephemerides::MultiArcEphemeris >(
+                    copiedSingleArcEphemerides, multiArcEphemeris->getReferenceFrameOrigin( ),
+                    multiArcEphemeris->getReferenceFrameOrientation( ) );
+    }
+    else
+    {
+        return ephemeris;
+    }
+}
+
+//! Function to copy a tabulated rotation model, with its own interpolator look-up state (returns nullptr if not of given type)
+template< typename StateScalarType, typename TimeType >
+std::shared_ptr< ephemerides::RotationalEphemeris > copyTabulatedRotationalEphemeris(
+        const std::shared_ptr< ephemerides::RotationalEphemeris > rotationalEphemeris )
+{
+    std::shared_ptr< ephemerides::TabulatedRotationalEphemeris< StateScalarType, TimeType > > tabulatedRotationalEphemeris =
+            std::dynamic_pointer_cast< ephemerides::TabulatedRotationalEphemeris< StateScalarType, TimeType > >(
+                rotationalEphemeris );
+    if( tabulatedRotationalEphemeris == nullptr )
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr< interpolators::OneDimensionalInterpolator<
+            TimeType, Eigen::Matrix< StateScalarType, 7, 1 > > > interpolator = tabulatedRotationalEphemeris->getInterpolator( );
+    return std::make_shared< ephemerides::TabulatedRotationalEphemeris< StateScalarType, TimeType > >(
+                ( interpolator == nullptr ) ? nullptr : interpolators::cloneCursor( interpolator ),
+                tabulatedRotationalEphemeris->getBaseFrameOrientation( ),
+                tabulatedRotationalEphemeris->getTargetFrameOrientation( ) );
+}
+
+//! Function to copy a rotation model for use in a replica of a body, sharing it if it has no per-evaluation state
+std::shared_ptr< ephemerides::RotationalEphemeris > copyRotationalEphemerisForReplica(
+        const std::shared_ptr< ephemerides::RotationalEphemeris > rotationalEphemeris,
+        const std::string& bodyName )
+{
+    std::shared_ptr< ephemerides::RotationalEphemeris > copiedRotationalEphemeris;
+    if( rotationalEphemeris == nullptr )
+    {
+        return nullptr;
+    }
+    else if( ( copiedRotationalEphemeris = copyTabulatedRotationalEphemeris< double, double >( rotationalEphemeris ) ) != nullptr ||
+             ( copiedRotationalEphemeris = copyTabulatedRotationalEphemeris< long double, double >( rotationalEphemeris ) ) != nullptr ||
+             ( copiedRotationalEphemeris = copyTabulatedRotationalEphemeris< double, Time >( rotationalEphemeris ) ) != nullptr ||
+             ( copiedRotationalEphemeris = copyTabulatedRotationalEphemeris< long double, Time >( rotationalEphemeris ) ) != nullptr )
+    {
+        return copiedRotationalEphemeris;
+    }
+    else if( std::shared_ptr< ephemerides::InterpolatedRotationalEphemeris > interpolatedRotationalEphemeris =
+             std::dynamic_pointer_cast< ephemerides::InterpolatedRotationalEphemeris >( rotationalEphemeris ) )
+    {
+        // Tabulated values are not modified after creation, but the original model is used outside of the tabulated
+        // interval, and must itself be suitable for sharing
+        copyRotationalEphemerisForReplica( interpolatedRotationalEphemeris->getOriginalRotationalEphemeris( ), bodyName );
+        return rotationalEphemeris;
+    }
+    else if( std::shared_ptr< ephemerides::ConstantRotationalEphemeris > constantRotationalEphemeris =
+             std::dynamic_pointer_cast< ephemerides::ConstantRotationalEphemeris >( rotationalEphemeris ) )
+    {
+        return std::make_shared< ephemerides::ConstantRotationalEphemeris >( *constantRotationalEphemeris );
+    }
+    else if( std::dynamic_pointer_cast< ephemerides::AerodynamicAngleRotationalEphemeris >( rotationalEphemeris ) != nullptr ||
+             std::dynamic_pointer_cast< ephemerides::DirectionBasedRotationalEphemeris >( rotationalEphemeris ) != nullptr ||
+             std::dynamic_pointer_cast< ephemerides::SynchronousRotationalEphemeris >( rotationalEphemeris ) != nullptr ||
+             std::dynamic_pointer_cast< ephemerides::PlanetaryRotationModel >( rotationalEphemeris ) != nullptr )
+    {
+        throw std::runtime_error( "Error when copying body " + bodyName +
+                                  ", copying of rotation models that depend on the state of bodies, or that store "
+                                  "intermediate results, is not supported." );
+    }
+    else
+    {
+        return rotationalEphemeris;
+    }
+}
+
+}
+
+//! Function to create a copy of this body, for use in a replica of the system of bodies
+std::shared_ptr< Body > Body::clone( ) const
+{
+    // Check if body contains models that are bound to other bodies, or that modify shared data
+    if( gravityFieldVariationSet_ != nullptr ||
+            std::dynamic_pointer_cast< gravitation::TimeDependentSphericalHarmonicsGravityField >( gravityFieldModel_ ) != nullptr )
+    {
+        throw std::runtime_error( "Error when copying body " + bodyName_ + ", copying of time-variable gravity fields is not supported." );
+    }
+    else if( bodyDeformationModels_.size( ) > 0 || groundStationMap.size( ) > 0 )
+    {
+        throw std::runtime_error( "Error when copying body " + bodyName_ + ", copying of ground stations and deformation models is not supported." );
+    }
+    else if( radiationPressureInterfaces_.size( ) > 0 ||
+             std::dynamic_pointer_cast< electromagnetism::PaneledRadiationSourceModel >( radiationSourceModel_ ) != nullptr ||
+             std::dynamic_pointer_cast< electromagnetism::PaneledRadiationPressureTargetModel >( radiationPressureTargetModel_ ) != nullptr )
+    {
+        throw std::runtime_error( "Error when copying body " + bodyName_ + ", copying of paneled radiation models and radiation pressure interfaces is not supported." );
+    }
+    else if( std::dynamic_pointer_cast< aerodynamics::TabulatedAtmosphere >( atmosphereModel_ ) != nullptr )
+    {
+        throw std::runtime_error( "Error when copying body " + bodyName_ + ", copying of tabulated atmosphere models is not supported." );
+    }
+
+    // Copy current state, orientation and properties, sharing all environment models
+    std::shared_ptr< Body > copiedBody = std::make_shared< Body >( *this );
+
+    // Copy models with per-evaluation state
+    copiedBody->bodyEphemeris_ = copyEphemerisForReplica( bodyEphemeris_ );
+    copiedBody->rotationalEphemeris_ = copyRotationalEphemerisForReplica( rotationalEphemeris_, bodyName_ );
+    if( massProperties_ != nullptr )
+    {
+        copiedBody->massProperties_ = massProperties_->clone( );
+    }
+    if( aerodynamicCoefficientInterface_ != nullptr )
+    {
+        copiedBody->aerodynamicCoefficientInterface_ = aerodynamicCoefficientInterface_->clone( );
+    }
+
+    // Remove models that are bound to the original bodies; these are recreated for the replica
+    copiedBody->aerodynamicFlightConditions_ = nullptr;
+    copiedBody->ephemerisFrameToBaseFrame_ = nullptr;
+
+    return copiedBody;
+}
+
+//! Function to create a replica of the system of bodies
+SystemOfBodies SystemOfBodies::clone( ) const
+{
+    SystemOfBodies copiedBodies( frameOrigin_, frameOrientation_ );
+    for( auto bodyIterator : bodyMap_ )
+    {
+        copiedBodies.addBody( bodyIterator.second->clone( ), bodyIterator.first, false );
+    }
+    copiedBodies.processBodyFrameDefinitions( );
+    return copiedBodies;
+}
+
+//! Function to retrieve the (heap) memory held by the data-heavy environment models of the bodies
+utilities::MemoryFootprint SystemOfBodies::getMemoryFootprint( ) const
+{
+    std::size_t ephemeridesSize = 0;
+    std::size_t coefficientsSize = 0;
+    std::set< const double* > countedCoefficients;
+    for( auto bodyIterator : bodyMap_ )
+    {
+        if( bodyIterator.second->getEphemeris( ) != nullptr )
+        {
+            ephemeridesSize += bodyIterator.second->getEphemeris( )->getHeapMemorySize( );
+        }
+
+        std::shared_ptr< gravitation::SphericalHarmonicsGravityField > sphericalHarmonicsGravityField =
+                std::dynamic_pointer_cast< gravitation::SphericalHarmonicsGravityField >(
+                    bodyIterator.second->getGravityFieldModel( ) );
+        if( sphericalHarmonicsGravityField != nullptr )
+        {
+            std::vector< basic_mathematics::CopyOnWriteMatrix > coefficients =
+            { sphericalHarmonicsGravityField->getSharedCosineCoefficients( ),
+              sphericalHarmonicsGravityField->getSharedSineCoefficients( ) };
+            for( unsigned int i = 0; i < coefficients.size( ); i++ )
+            {
+                if( countedCoefficients.count( coefficients.at( i ).getMatrix( ).data( ) ) == 0 )
+                {
+                    countedCoefficients.insert( coefficients.at( i ).getMatrix( ).data( ) );
+                    coefficientsSize += utilities::getHeapMemorySize( coefficients.at( i ).getMatrix( ) );
+                }
+            }
+        }
+    }
+
+    utilities::MemoryFootprint memoryFootprint;
+    memoryFootprint.addEntry( "ephemerides", ephemeridesSize );
+    memoryFootprint.addEntry( "spherical_harmonic_coefficients", coefficientsSize );
+    return memoryFootprint;
+}
+
 
 //template void Body::setStateFromEphemeris< double, double >( const double& time );
 
@@ -173,6 +404,59 @@ void setAreBodiesInPropagation( const SystemOfBodies& bodies,
     }
 }
 
+//! Function to check whether two sets of bodies share any Body object
+bool doSystemsOfBodiesShareBodies( const SystemOfBodies& firstBodies,
+                                   const SystemOfBodies& secondBodies )
+{
+    for( auto firstBodyIterator : firstBodies.getMap( ) )
+    {
+        for( auto secondBodyIterator : secondBodies.getMap( ) )
+        {
+            if( firstBodyIterator.second == secondBodyIterator.second )
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+//! Function to reset the statistics on the reuse of the ephemeris states of all bodies
+void resetEphemerisStateCacheStatistics( const SystemOfBodies& bodies )
+{
+    for( auto bodyIterator : bodies.getMap( ) )
+    {
+        bodyIterator.second->resetEphemerisStateCacheStatistics( );
+    }
+}
+
+//! Function to print the statistics on the reuse of the ephemeris states of all bodies
+void printEphemerisStateCacheStatistics( const SystemOfBodies& bodies )
+{
+    std::cout << "Ephemeris state evaluations (body: requested states, reused states, ephemeris evaluations):" << std::endl;
+    for( auto bodyIterator : bodies.getMap( ) )
+    {
+        unsigned int numberOfRequests = bodyIterator.second->getNumberOfEphemerisStateRequests( );
+        if( numberOfRequests > 0 )
+        {
+            unsigned int numberOfCacheHits = bodyIterator.second->getNumberOfEphemerisStateCacheHits( );
+            std::cout << "    " << bodyIterator.first << ": " << numberOfRequests << ", " << numberOfCacheHits << ", "
+                      << numberOfRequests - numberOfCacheHits << std::endl;
+        }
+    }
+
+    std::cout << "Rotational state evaluations (body: requested states, reused states, rotation model evaluations):" << std::endl;
+    for( auto bodyIterator : bodies.getMap( ) )
+    {
+        unsigned int numberOfRequests = bodyIterator.second->getNumberOfRotationalStateRequests( );
+        if( numberOfRequests > 0 )
+        {
+            unsigned int numberOfCacheHits = bodyIterator.second->getNumberOfRotationalStateCacheHits( );
+            std::cout << "    " << bodyIterator.first << ": " << numberOfRequests << ", " << numberOfCacheHits << ", "
+                      << numberOfRequests - numberOfCacheHits << std::endl;
+        }
+    }
+}
 
 } // namespace simulation_setup
 
@@ -74,6 +74,23 @@ std::shared_ptr< AerodynamicCoefficientSettings > readTabulatedAerodynamicCoeffi
     return coefficientSettings;
 }
 
+//! Function to create aerodynamic coefficient settings from a binary coefficient table file
+std::shared_ptr< AerodynamicCoefficientSettings > readTabulatedAerodynamicCoefficientsFromBinaryFile(
+        const std::string& binaryFileName,
+        const double referenceLength,
+        const double referenceArea,
+        const std::vector< aerodynamics::AerodynamicCoefficientsIndependentVariables > independentVariableNames,
+        const aerodynamics::AerodynamicCoefficientFrames forceCoefficientFrame,
+        const aerodynamics::AerodynamicCoefficientFrames momentCoefficientFrame,
+        const Eigen::Vector3d& momentReferencePoint,
+        const std::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings )
+{
+    return std::make_shared< BinaryTabulatedAerodynamicCoefficientSettings >(
+                input_output::loadBinaryCoefficientTable( binaryFileName ),
+                referenceLength, referenceArea, momentReferencePoint, independentVariableNames,
+                forceCoefficientFrame, momentCoefficientFrame, !momentReferencePoint.hasNaN( ), interpolatorSettings );
+}
+
 std::shared_ptr< AerodynamicCoefficientSettings > readTabulatedAerodynamicCoefficientsFromFilesDeprecated(
         const std::map< int, std::string > forceCoefficientFiles,
         const std::map< int, std::string > momentCoefficientFiles,
@@ -204,6 +221,47 @@ createZeroParameterAerodynamicCoefficientInterface(
 }
 
 //! Factory function for tabulated (1-D independent variables) aerodynamic coefficient interface from coefficient settings.
+//! Factory function for aerodynamic coefficient interface from binary tabulated coefficient settings.
+std::shared_ptr< aerodynamics::AerodynamicCoefficientInterface >
+createBinaryTabulatedCoefficientAerodynamicCoefficientInterface(
+        const std::shared_ptr< BinaryTabulatedAerodynamicCoefficientSettings > coefficientSettings,
+        const std::string& body )
+{
+    std::shared_ptr< aerodynamics::AerodynamicCoefficientInterface > coefficientInterface;
+    int numberOfDimensions = coefficientSettings->getCoefficientTable( )->getNumberOfDimensions( );
+    switch( numberOfDimensions )
+    {
+    case 1:
+        coefficientInterface = createBinaryTabulatedCoefficientAerodynamicCoefficientInterface< 1 >(
+                    coefficientSettings, body );
+        break;
+    case 2:
+        coefficientInterface = createBinaryTabulatedCoefficientAerodynamicCoefficientInterface< 2 >(
+                    coefficientSettings, body );
+        break;
+    case 3:
+        coefficientInterface = createBinaryTabulatedCoefficientAerodynamicCoefficientInterface< 3 >(
+                    coefficientSettings, body );
+        break;
+    case 4:
+        coefficientInterface = createBinaryTabulatedCoefficientAerodynamicCoefficientInterface< 4 >(
+                    coefficientSettings, body );
+        break;
+    case 5:
+        coefficientInterface = createBinaryTabulatedCoefficientAerodynamicCoefficientInterface< 5 >(
+                    coefficientSettings, body );
+        break;
+    case 6:
+        coefficientInterface = createBinaryTabulatedCoefficientAerodynamicCoefficientInterface< 6 >(
+                    coefficientSettings, body );
+        break;
+    default:
+        throw std::runtime_error( "Error when making binary tabulated aerodynamic coefficient interface, " +
+                                  std::to_string( numberOfDimensions ) + " dimensions not yet implemented" );
+    }
+    return coefficientInterface;
+}
+
 std::shared_ptr< aerodynamics::AerodynamicCoefficientInterface >
 createUnivariateTabulatedCoefficientAerodynamicCoefficientInterface(
         const std::shared_ptr< AerodynamicCoefficientSettings > coefficientSettings,
@@ -223,30 +281,37 @@ createUnivariateTabulatedCoefficientAerodynamicCoefficientInterface(
     else
     {
 
+        // Concatenate force and moment coefficients, so that a single interpolator evaluates both
+        std::map< double, Eigen::Vector3d > forceCoefficients = tabulatedCoefficientSettings->getForceCoefficients( );
+        std::map< double, Eigen::Vector3d > momentCoefficients = tabulatedCoefficientSettings->getMomentCoefficients( );
+        std::map< double, Eigen::Vector6d > coefficients;
+        for( const auto& forceIterator : forceCoefficients )
+        {
+            if( momentCoefficients.count( forceIterator.first ) == 0 )
+            {
+                throw std::runtime_error( "Error when creating tabulated aerodynamic coefficients for body " + body +
+                                          ", force and moment coefficients are defined at different independent variables" );
+            }
+            coefficients[ forceIterator.first ] << forceIterator.second, momentCoefficients.at( forceIterator.first );
+        }
+
         // Retrieve or generate interpolation settings
-        std::shared_ptr< OneDimensionalInterpolator< double, Eigen::Vector3d > > forceInterpolator;
-        std::shared_ptr< OneDimensionalInterpolator< double, Eigen::Vector3d > > momentInterpolator;
+        std::shared_ptr< OneDimensionalInterpolator< double, Eigen::Vector6d > > coefficientInterpolator;
         if ( tabulatedCoefficientSettings->getInterpolatorSettings( ) == nullptr )
         {
-            forceInterpolator = createOneDimensionalInterpolator( tabulatedCoefficientSettings->getForceCoefficients( ),
-                                                                  std::make_shared< InterpolatorSettings >( linear_interpolator ) );
-            momentInterpolator = createOneDimensionalInterpolator( tabulatedCoefficientSettings->getForceCoefficients( ),
-                                                                   std::make_shared< InterpolatorSettings >( linear_interpolator ) );
+            coefficientInterpolator = createOneDimensionalInterpolator(
+                        coefficients, std::make_shared< InterpolatorSettings >( linear_interpolator ) );
         }
         else
         {
-            forceInterpolator = createOneDimensionalInterpolator( tabulatedCoefficientSettings->getForceCoefficients( ),
-                                                                  std::dynamic_pointer_cast< InterpolatorSettings >(
-                                                                      tabulatedCoefficientSettings->getInterpolatorSettings( ) ) );
-            momentInterpolator = createOneDimensionalInterpolator( tabulatedCoefficientSettings->getForceCoefficients( ),
-                                                                   std::dynamic_pointer_cast< InterpolatorSettings >(
-                                                                       tabulatedCoefficientSettings->getInterpolatorSettings( ) ) );
+            coefficientInterpolator = createOneDimensionalInterpolator(
+                        coefficients, std::dynamic_pointer_cast< InterpolatorSettings >(
+                            tabulatedCoefficientSettings->getInterpolatorSettings( ) ) );
         }
 
         // Create aerodynamic coefficient interface.
         return  std::make_shared< aerodynamics::CustomAerodynamicCoefficientInterface >(
-                    std::bind( &Interpolator< double, Eigen::Vector3d >::interpolate, forceInterpolator, std::placeholders::_1 ),
-                    std::bind( &Interpolator< double, Eigen::Vector3d >::interpolate, momentInterpolator, std::placeholders::_1 ),
+                    std::bind( &Interpolator< double, Eigen::Vector6d >::interpolate, coefficientInterpolator, std::placeholders::_1 ),
                     tabulatedCoefficientSettings->getReferenceLength( ),
                     tabulatedCoefficientSettings->getReferenceArea( ),
                     tabulatedCoefficientSettings->getMomentReferencePoint( ),
@@ -378,6 +443,15 @@ createAerodynamicCoefficientInterface(
     }
     case tabulated_coefficients:
     {
+        // Check whether coefficients are defined by a binary table.
+        if( std::dynamic_pointer_cast< BinaryTabulatedAerodynamicCoefficientSettings >( coefficientSettings ) != nullptr )
+        {
+            coefficientInterface = createBinaryTabulatedCoefficientAerodynamicCoefficientInterface(
+                        std::dynamic_pointer_cast< BinaryTabulatedAerodynamicCoefficientSettings >( coefficientSettings ),
+                        body );
+            break;
+        }
+
         // Check number of dimensions of tabulated coefficients.
         int numberOfDimensions = coefficientSettings->getIndependentVariableNames( ).size( );
         switch( numberOfDimensions )
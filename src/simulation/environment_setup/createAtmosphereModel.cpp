@@ -198,8 +198,9 @@ std::shared_ptr< aerodynamics::AtmosphereModel > createAtmosphereModel(
             spaceWeatherFilePath = nrlmsise00AtmosphereSettings->getSpaceWeatherFile( );
         }
 
-        tudat::input_output::solar_activity::SolarActivityDataMap solarActivityData =
-                tudat::input_output::solar_activity::readSolarActivityData( spaceWeatherFilePath ) ;
+        // Load space weather data (parsed once per file, and shared by all atmosphere models)
+        std::shared_ptr< tudat::input_output::solar_activity::SolarActivityContainer > solarActivityData =
+                tudat::input_output::solar_activity::loadSolarActivityData( spaceWeatherFilePath ) ;
 
         // Create atmosphere model using NRLMISE00 input function
         atmosphereModel = std::make_shared< aerodynamics::NRLMSISE00Atmosphere >(
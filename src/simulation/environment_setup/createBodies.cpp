@@ -11,6 +11,7 @@
 #include <iostream>
 #include <cmath>
 #include <memory>
+#include <set>
 
 
 #include <boost/lambda/lambda.hpp>
@@ -153,6 +154,70 @@ std::vector< std::pair< std::string, std::shared_ptr< BodySettings > > > determi
 }
 
 
+//! Function to load the pending Spice kernels that are required by the ephemerides in a list of body settings
+std::vector< std::string > loadPendingSpiceKernelsForBodySettings( const BodyListSettings& bodySettings )
+{
+    std::set< std::string > requiredBodies;
+    requiredBodies.insert( bodySettings.getFrameOrigin( ) );
+
+    double startTime = TUDAT_NAN, endTime = TUDAT_NAN;
+    bool isTimeIntervalBounded = true;
+    bool isTimeIntervalSet = false;
+    std::shared_ptr< SpiceEphemerisPreSamplingSettings > preSamplingSettings =
+            bodySettings.getSpiceEphemerisPreSamplingSettings( );
+
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettingsMap = bodySettings.getMap( );
+    for( auto bodyIterator : bodySettingsMap )
+    {
+        std::shared_ptr< DirectSpiceEphemerisSettings > spiceEphemerisSettings =
+                std::dynamic_pointer_cast< DirectSpiceEphemerisSettings >( bodyIterator.second->ephemerisSettings );
+        if( spiceEphemerisSettings == nullptr )
+        {
+            continue;
+        }
+
+        requiredBodies.insert( ( spiceEphemerisSettings->getBodyNameOverride( ) == "" ) ?
+                                   bodyIterator.first : spiceEphemerisSettings->getBodyNameOverride( ) );
+        requiredBodies.insert( spiceEphemerisSettings->getFrameOrigin( ) );
+
+        // Determine the time interval in which the ephemeris is evaluated
+        double currentStartTime = TUDAT_NAN, currentEndTime = TUDAT_NAN;
+        std::shared_ptr< InterpolatedSpiceEphemerisSettings > interpolatedEphemerisSettings =
+                std::dynamic_pointer_cast< InterpolatedSpiceEphemerisSettings >( spiceEphemerisSettings );
+        if( spiceEphemerisSettings->getEphemerisType( ) == interpolated_spice && interpolatedEphemerisSettings != nullptr )
+        {
+            currentStartTime = interpolatedEphemerisSettings->getInitialTime( );
+            currentEndTime = interpolatedEphemerisSettings->getFinalTime( );
+        }
+        else if( spiceEphemerisSettings->getEphemerisType( ) == direct_spice_ephemeris && preSamplingSettings != nullptr &&
+                 !spiceEphemerisSettings->getMakeMultiArcEphemeris( ) )
+        {
+            currentStartTime = preSamplingSettings->getStartTime( );
+            currentEndTime = preSamplingSettings->getEndTime( );
+        }
+        else
+        {
+            isTimeIntervalBounded = false;
+        }
+
+        if( currentStartTime == currentStartTime && currentEndTime == currentEndTime )
+        {
+            startTime = isTimeIntervalSet ? std::min( startTime, currentStartTime ) : currentStartTime;
+            endTime = isTimeIntervalSet ? std::max( endTime, currentEndTime ) : currentEndTime;
+            isTimeIntervalSet = true;
+        }
+    }
+
+    if( !isTimeIntervalBounded )
+    {
+        startTime = TUDAT_NAN;
+        endTime = TUDAT_NAN;
+    }
+
+    return spice_interface::loadPendingSpiceKernelsForBodies(
+                std::vector< std::string >( requiredBodies.begin( ), requiredBodies.end( ) ), startTime, endTime );
+}
+
 //! Function to create a simplified system of bodies
 simulation_setup::SystemOfBodies createSimplifiedSystemOfBodies(const double secondsSinceJ2000)
 {
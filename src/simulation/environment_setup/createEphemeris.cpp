@@ -21,6 +21,19 @@ namespace simulation_setup
 
 using namespace ephemerides;
 
+//! Function to create a pre-sampled (Chebyshev) ephemeris from an existing ephemeris model
+std::shared_ptr< ephemerides::ChebyshevCartesianEphemeris > getPreSampledEphemeris(
+        const std::shared_ptr< ephemerides::Ephemeris > ephemerisToSample,
+        const std::shared_ptr< SpiceEphemerisPreSamplingSettings > preSamplingSettings )
+{
+    return std::make_shared< ChebyshevCartesianEphemeris >(
+                [ = ]( const double time ){ return ephemerisToSample->getCartesianState( time ); },
+                preSamplingSettings->getStartTime( ), preSamplingSettings->getEndTime( ),
+                preSamplingSettings->getPositionTolerance( ), preSamplingSettings->getVelocityTolerance( ),
+                preSamplingSettings->getPolynomialDegree( ), preSamplingSettings->getMinimumSegmentDuration( ),
+                ephemerisToSample->getReferenceFrameOrigin( ), ephemerisToSample->getReferenceFrameOrientation( ) );
+}
+
 //! Function that retrieves the time interval at which an ephemeris can be safely interrogated
 std::pair< double, double > getSafeInterpolationInterval( const std::shared_ptr< ephemerides::Ephemeris > ephemerisModel )
 {
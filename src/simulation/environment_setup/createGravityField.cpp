@@ -10,11 +10,23 @@
 
 
 
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <set>
+#include <tuple>
+
+#include <boost/filesystem.hpp>
+
 #include "tudat/interface/spice/spiceInterface.h"
 #include "tudat/astro/gravitation/timeDependentSphericalHarmonicsGravityField.h"
 #include "tudat/astro/gravitation/triAxialEllipsoidGravity.h"
 #include "tudat/simulation/environment_setup/createGravityField.h"
 #include "tudat/io/basicInputOutput.h"
+#include "tudat/io/binaryGravityFieldFile.h"
 #include "tudat/astro/basic_astro/polyhedronFuntions.h"
 
 namespace tudat
@@ -136,14 +148,11 @@ FromFileSphericalHarmonicsGravityFieldSettings::FromFileSphericalHarmonicsGravit
     gravitationalParameterIndex_( gravitationalParameterIndex ),
     referenceRadiusIndex_( referenceRadiusIndex )
 {
-    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > coefficients;
     std::pair< double, double > referenceData =
-            readGravityFieldFile( filePath, maximumDegree, maximumOrder, coefficients,
-                                  gravitationalParameterIndex, referenceRadiusIndex );
+            loadGravityFieldCoefficients( filePath, maximumDegree, maximumOrder, cosineCoefficients_, sineCoefficients_,
+                                          gravitationalParameterIndex, referenceRadiusIndex );
     gravitationalParameter_ = gravitationalParameterIndex >= 0 ? referenceData.first : gravitationalParameter;
     referenceRadius_ = referenceRadiusIndex >= 0 ? referenceData.second : referenceRadius;
-    cosineCoefficients_ = coefficients.first;
-    sineCoefficients_ = coefficients.second;
 }
 
 //! Constructor with model included in Tudat.
@@ -161,11 +170,41 @@ FromFileSphericalHarmonicsGravityFieldSettings::FromFileSphericalHarmonicsGravit
 }
 
 
-//! Function to read a gravity field file
-std::pair< double, double  > readGravityFieldFile(
-        const std::string& fileName, const int maximumDegree, const int maximumOrder,
-        std::pair< Eigen::MatrixXd, Eigen::MatrixXd >& coefficients,
-        const int gravitationalParameterIndex, const int referenceRadiusIndex )
+//! Function to retrieve the gravitational parameter and reference radius from the header line of a gravity field file
+static std::pair< double, double > parseGravityFieldFileHeader(
+        const std::string& headerLine, const int gravitationalParameterIndex, const int referenceRadiusIndex )
+{
+    std::string trimmedHeaderLine = boost::algorithm::trim_copy( headerLine );
+    std::vector< std::string > vectorOfIndividualStrings;
+    boost::algorithm::split( vectorOfIndividualStrings,
+                             trimmedHeaderLine,
+                             boost::algorithm::is_any_of( "\t, " ),
+                             boost::algorithm::token_compress_on );
+    if( gravitationalParameterIndex >= static_cast< int >( vectorOfIndividualStrings.size( ) ) ||
+            referenceRadiusIndex >= static_cast< int >( vectorOfIndividualStrings.size( ) ) )
+    {
+        throw std::runtime_error( "Error when reading gravity field file, requested header index exceeds file contents" );
+    }
+
+    return std::make_pair( std::stod( vectorOfIndividualStrings[ gravitationalParameterIndex ] ),
+                           std::stod( vectorOfIndividualStrings[ referenceRadiusIndex ] ) );
+}
+
+//! Function to parse the header line and coefficients of a gravity field text file
+/*!
+ *  Function to parse the header line and coefficients of a gravity field text file (see readGravityFieldFile).
+ *  \param fileName Name of gravity field file to be loaded.
+ *  \param hasHeader Boolean denoting whether the first line of the file is a header
+ *  \param maximumDegree Maximum degree of gravity field to be loaded. If negative, all coefficients in the file are
+ *  loaded, and the returned matrices are square, with size determined by the maximum degree in the file.
+ *  \param maximumOrder Maximum order of gravity field to be loaded (ignored if maximumDegree is negative).
+ *  \param headerLine Header line of the file, empty if hasHeader is false (returned by reference)
+ *  \param cosineCoefficients Cosine coefficients (returned by reference)
+ *  \param sineCoefficients Sine coefficients (returned by reference)
+ */
+static void parseGravityFieldTextFile(
+        const std::string& fileName, const bool hasHeader, const int maximumDegree, const int maximumOrder,
+        std::string& headerLine, Eigen::MatrixXd& cosineCoefficients, Eigen::MatrixXd& sineCoefficients )
 {
     // Attempt to open gravity file.
     std::fstream stream( fileName.c_str( ), std::ios::in );
@@ -179,50 +218,28 @@ std::pair< double, double  > readGravityFieldFile(
     vectorOfIndividualStrings.resize( 4 );
     std::string line;
 
-
-    double gravitationalParameter = TUDAT_NAN;
-    double referenceRadius = TUDAT_NAN;
-
-    if( ( gravitationalParameterIndex >= 0 ) &&
-            ( referenceRadiusIndex >= 0 ) )
+    // Get first line of file, containing the header.
+    headerLine.clear( );
+    if( hasHeader )
     {
-        // Get first line of file.
-        std::getline( stream, line );
-
-        // Get reference radius and gravitational parameter from first line of file.
-        boost::algorithm::trim( line );
-        boost::algorithm::split( vectorOfIndividualStrings,
-                                 line,
-                                 boost::algorithm::is_any_of( "\t, " ),
-                                 boost::algorithm::token_compress_on );
-        if( gravitationalParameterIndex >= static_cast< int >( vectorOfIndividualStrings.size( ) ) ||
-                referenceRadiusIndex >= static_cast< int >( vectorOfIndividualStrings.size( ) ) )
-        {
-            throw std::runtime_error( "Error when reading gravity field file, requested header index exceeds file contents" );
-        }
-
-        gravitationalParameter = std::stod( vectorOfIndividualStrings[ gravitationalParameterIndex ] );
-        referenceRadius = std::stod( vectorOfIndividualStrings[ referenceRadiusIndex ] );
-    }
-    else if( ( !( gravitationalParameterIndex >= 0 ) &&
-               ( referenceRadiusIndex >= 0 ) ) ||
-             ( ( gravitationalParameterIndex >= 0 ) &&
-               !( referenceRadiusIndex >= 0 ) ) )
-    {
-        throw std::runtime_error( "Error when reading gravity field file, must retrieve either both or neither of Re and mu" );
+        std::getline( stream, headerLine );
     }
 
-
     // Declare variables for reading in cosine and sine coefficients.
+    bool readFullFile = ( maximumDegree < 0 );
     int currentDegree = 0, currentOrder = 0;
-    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd( maximumDegree + 1, maximumOrder + 1 );
-    cosineCoefficients.setZero( );
-    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd( maximumDegree + 1, maximumOrder + 1 );
-    sineCoefficients.setZero( );
+    int lastDegreeToRead = readFullFile ? std::numeric_limits< int >::max( ) : maximumDegree;
+    int lastOrderToRead = readFullFile ? std::numeric_limits< int >::max( ) : std::min( maximumDegree, maximumOrder );
+    std::vector< std::tuple< int, int, double, double > > fileCoefficients;
+    if( !readFullFile )
+    {
+        cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+        sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+    }
 
-    // Read coefficients up to required maximum degree and order.
-    while ( !stream.fail( ) && !stream.eof( ) &&
-            ( currentDegree <= maximumDegree && currentOrder < maximumOrder )  )
+    // Read coefficients up to required maximum degree and order (the file is ordered by degree, then by order).
+    while ( !stream.fail( ) && !stream.eof( ) && currentDegree <= lastDegreeToRead &&
+            !( currentDegree == lastDegreeToRead && currentOrder >= lastOrderToRead ) )
     {
         // Read current line
         std::getline( stream, line );
@@ -238,7 +255,7 @@ std::pair< double, double  > readGravityFieldFile(
                                  boost::algorithm::token_compress_on );
 
         // Check current line for consistency
-        if( vectorOfIndividualStrings.size( ) != 0 )
+        if( vectorOfIndividualStrings.size( ) != 0 && !( vectorOfIndividualStrings.size( ) == 1 && line.empty( ) ) )
         {
             if( vectorOfIndividualStrings.size( ) < 4 )
             {
@@ -251,8 +268,15 @@ std::pair< double, double  > readGravityFieldFile(
                 // Read current degree and orde from line.
                 currentDegree = static_cast< int >( std::round( std::stod( vectorOfIndividualStrings[ 0 ] ) ) );
                 currentOrder = static_cast< int >( std::round( std::stod( vectorOfIndividualStrings[ 1 ] ) ) );
+
                 // Set cosine and sine coefficients for current degree and order.
-                if( currentDegree <= maximumDegree && currentOrder <= maximumOrder )
+                if( readFullFile )
+                {
+                    fileCoefficients.push_back(
+                                std::make_tuple( currentDegree, currentOrder, std::stod( vectorOfIndividualStrings[ 2 ] ),
+                                                 std::stod( vectorOfIndividualStrings[ 3 ] ) ) );
+                }
+                else if( currentDegree <= maximumDegree && currentOrder <= maximumOrder )
                 {
                     cosineCoefficients( currentDegree, currentOrder ) =
                             std::stod( vectorOfIndividualStrings[ 2 ] );
@@ -263,6 +287,198 @@ std::pair< double, double  > readGravityFieldFile(
         }
     }
 
+    if( readFullFile )
+    {
+        int maximumFileDegree = 0;
+        for( unsigned int i = 0; i < fileCoefficients.size( ); i++ )
+        {
+            maximumFileDegree = std::max( maximumFileDegree, std::get< 0 >( fileCoefficients.at( i ) ) );
+        }
+
+        cosineCoefficients = Eigen::MatrixXd::Zero( maximumFileDegree + 1, maximumFileDegree + 1 );
+        sineCoefficients = Eigen::MatrixXd::Zero( maximumFileDegree + 1, maximumFileDegree + 1 );
+        for( unsigned int i = 0; i < fileCoefficients.size( ); i++ )
+        {
+            int degree = std::get< 0 >( fileCoefficients.at( i ) );
+            int order = std::get< 1 >( fileCoefficients.at( i ) );
+            if( order > degree || order < 0 )
+            {
+                throw std::runtime_error( "Error when reading gravity field file " + fileName + ", invalid order " +
+                                          std::to_string( order ) + " at degree " + std::to_string( degree ) );
+            }
+            cosineCoefficients( degree, order ) = std::get< 2 >( fileCoefficients.at( i ) );
+            sineCoefficients( degree, order ) = std::get< 3 >( fileCoefficients.at( i ) );
+        }
+    }
+}
+
+//! Function to get the name of the binary cache file of a gravity field text file
+std::string getGravityFieldCacheFileName( const std::string& fileName, const bool hasHeader )
+{
+    return fileName + ( hasHeader ? ".header" : "" ) + ".tudatshc";
+}
+
+//! Binary cache files of gravity field text files that could not be written, with mutex for its access
+struct GravityFieldCacheWriteFailures
+{
+    std::mutex failuresMutex;
+
+    std::set< std::string > cacheFileNames;
+};
+
+//! Function to retrieve the (process-wide) set of binary gravity field cache files that could not be written
+static GravityFieldCacheWriteFailures& getGravityFieldCacheWriteFailures( )
+{
+    static GravityFieldCacheWriteFailures gravityFieldCacheWriteFailures;
+    return gravityFieldCacheWriteFailures;
+}
+
+//! Function to register that a binary gravity field cache file could not be written, warning on the first failure
+static void registerGravityFieldCacheWriteFailure( const std::string& cacheFileName )
+{
+    GravityFieldCacheWriteFailures& writeFailures = getGravityFieldCacheWriteFailures( );
+    std::lock_guard< std::mutex > failuresLock( writeFailures.failuresMutex );
+    if( writeFailures.cacheFileNames.insert( cacheFileName ).second )
+    {
+        std::cerr << "Warning, binary gravity field cache " << cacheFileName << " could not be written, "
+                  << "gravity field file will be parsed as text for the remainder of this process" << std::endl;
+    }
+}
+
+//! Function to check whether a binary gravity field cache file could not be written earlier in this process
+static bool hasGravityFieldCacheWriteFailed( const std::string& cacheFileName )
+{
+    GravityFieldCacheWriteFailures& writeFailures = getGravityFieldCacheWriteFailures( );
+    std::lock_guard< std::mutex > failuresLock( writeFailures.failuresMutex );
+    return writeFailures.cacheFileNames.count( cacheFileName ) > 0;
+}
+
+//! Function to load the binary cache of a gravity field text file, creating or updating it if required
+std::shared_ptr< input_output::BinaryGravityFieldFile > loadGravityFieldCacheFile(
+        const std::string& fileName, const bool hasHeader )
+{
+    boost::filesystem::path filePath( fileName );
+    if( !boost::filesystem::exists( filePath ) )
+    {
+        throw std::runtime_error( "Pds gravity field data file could not be opened: " + fileName );
+    }
+    int64_t sourceFileSize = static_cast< int64_t >( boost::filesystem::file_size( filePath ) );
+    int64_t sourceModificationTime = static_cast< int64_t >( boost::filesystem::last_write_time( filePath ) );
+
+    // Load existing cache, if it is consistent with the text file
+    std::string cacheFileName = getGravityFieldCacheFileName( fileName, hasHeader );
+    if( boost::filesystem::is_regular_file( cacheFileName ) )
+    {
+        try
+        {
+            std::shared_ptr< input_output::BinaryGravityFieldFile > cacheFile =
+                    input_output::loadBinaryGravityFieldFile( cacheFileName );
+            if( cacheFile->getSourceFileSize( ) == sourceFileSize &&
+                    cacheFile->getSourceModificationTime( ) == sourceModificationTime )
+            {
+                return cacheFile;
+            }
+        }
+        catch( const std::runtime_error& )
+        {
+        }
+        input_output::unloadBinaryGravityFieldFile( cacheFileName );
+    }
+
+    // Do not attempt to write a cache that could not be written before, so that the full text file is not parsed again
+    if( hasGravityFieldCacheWriteFailed( cacheFileName ) )
+    {
+        return nullptr;
+    }
+
+    // Create the temporary file to which the cache is written (and which is then renamed, so that other processes never
+    // read a partially written cache) before parsing the full text file, so that the full parse is skipped if the cache
+    // directory is not writable (e.g. a read-only data directory)
+    boost::filesystem::path temporaryCachePath =
+            boost::filesystem::unique_path( cacheFileName + ".%%%%-%%%%-%%%%.tmp" );
+    if( !std::ofstream( temporaryCachePath.string( ), std::ios::binary ) )
+    {
+        registerGravityFieldCacheWriteFailure( cacheFileName );
+        return nullptr;
+    }
+
+    std::string headerLine;
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    boost::system::error_code errorCode;
+    try
+    {
+        parseGravityFieldTextFile( fileName, hasHeader, -1, -1, headerLine, cosineCoefficients, sineCoefficients );
+    }
+    catch( const std::exception& )
+    {
+        boost::filesystem::remove( temporaryCachePath, errorCode );
+        throw;
+    }
+
+    try
+    {
+        input_output::writeBinaryGravityFieldFile(
+                    temporaryCachePath.string( ), cosineCoefficients, sineCoefficients, headerLine,
+                    sourceFileSize, sourceModificationTime );
+        boost::filesystem::rename( temporaryCachePath, cacheFileName );
+        return input_output::loadBinaryGravityFieldFile( cacheFileName );
+    }
+    catch( const std::exception& )
+    {
+        // Cache could not be written, return nullptr to use the text file directly
+        boost::filesystem::remove( temporaryCachePath, errorCode );
+        registerGravityFieldCacheWriteFailure( cacheFileName );
+        return nullptr;
+    }
+}
+
+//! Function to read a gravity field file
+std::pair< double, double  > readGravityFieldFile(
+        const std::string& fileName, const int maximumDegree, const int maximumOrder,
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd >& coefficients,
+        const int gravitationalParameterIndex, const int referenceRadiusIndex,
+        const bool useBinaryCache )
+{
+    bool hasHeader = false;
+    if( ( gravitationalParameterIndex >= 0 ) &&
+            ( referenceRadiusIndex >= 0 ) )
+    {
+        hasHeader = true;
+    }
+    else if( ( !( gravitationalParameterIndex >= 0 ) &&
+               ( referenceRadiusIndex >= 0 ) ) ||
+             ( ( gravitationalParameterIndex >= 0 ) &&
+               !( referenceRadiusIndex >= 0 ) ) )
+    {
+        throw std::runtime_error( "Error when reading gravity field file, must retrieve either both or neither of Re and mu" );
+    }
+
+    // Retrieve coefficients from binary cache if possible, or from the text file otherwise
+    std::string headerLine;
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    std::shared_ptr< input_output::BinaryGravityFieldFile > cacheFile =
+            useBinaryCache ? loadGravityFieldCacheFile( fileName, hasHeader ) : nullptr;
+    if( cacheFile != nullptr )
+    {
+        headerLine = cacheFile->getHeaderLine( );
+        cacheFile->extractCoefficients( maximumDegree, maximumOrder, cosineCoefficients, sineCoefficients );
+    }
+    else
+    {
+        parseGravityFieldTextFile( fileName, hasHeader, maximumDegree, maximumOrder,
+                                   headerLine, cosineCoefficients, sineCoefficients );
+    }
+
+    double gravitationalParameter = TUDAT_NAN;
+    double referenceRadius = TUDAT_NAN;
+    if( hasHeader )
+    {
+        std::pair< double, double > headerData =
+                parseGravityFieldFileHeader( headerLine, gravitationalParameterIndex, referenceRadiusIndex );
+        gravitationalParameter = headerData.first;
+        referenceRadius = headerData.second;
+    }
+
     // Set cosine coefficient at (0,0) to 1.
     cosineCoefficients( 0, 0 ) = 1.0;
     coefficients = std::make_pair( cosineCoefficients, sineCoefficients );
@@ -270,6 +486,87 @@ std::pair< double, double  > readGravityFieldFile(
     return std::make_pair( gravitationalParameter, referenceRadius );
 }
 
+//! Coefficients of a single gravity field file, with the properties of the file from which they were read
+struct CachedGravityFieldCoefficients
+{
+    //! Size of the file (in bytes) when it was read
+    uintmax_t fileSize;
+
+    //! Modification time of the file when it was read
+    std::time_t modificationTime;
+
+    //! Gravitational parameter and reference radius read from the file header
+    std::pair< double, double > referenceData;
+
+    //! Cosine coefficients read from the file
+    basic_mathematics::CopyOnWriteMatrix cosineCoefficients;
+
+    //! Sine coefficients read from the file
+    basic_mathematics::CopyOnWriteMatrix sineCoefficients;
+};
+
+//! Cache of gravity field coefficients, with file name, maximum degree/order and header indices as key, and mutex for
+//! its access
+struct GravityFieldCoefficientsCache
+{
+    std::mutex cacheMutex;
+
+    std::map< std::tuple< std::string, int, int, int, int >, CachedGravityFieldCoefficients > cachedCoefficients;
+};
+
+//! Function to retrieve the (process-wide) cache of gravity field coefficients, created on first use
+static GravityFieldCoefficientsCache& getGravityFieldCoefficientsCache( )
+{
+    static GravityFieldCoefficientsCache gravityFieldCoefficientsCache;
+    return gravityFieldCoefficientsCache;
+}
+
+//! Function to load the coefficients of a gravity field file, sharing a single copy of the coefficients within the process
+std::pair< double, double > loadGravityFieldCoefficients(
+        const std::string& fileName, const int maximumDegree, const int maximumOrder,
+        basic_mathematics::CopyOnWriteMatrix& cosineCoefficients,
+        basic_mathematics::CopyOnWriteMatrix& sineCoefficients,
+        const int gravitationalParameterIndex, const int referenceRadiusIndex )
+{
+    boost::system::error_code errorCode;
+    uintmax_t fileSize = boost::filesystem::file_size( fileName, errorCode );
+    std::time_t modificationTime = errorCode ? 0 : boost::filesystem::last_write_time( fileName, errorCode );
+
+    // Read file if it is not yet in the cache, or if it has changed since it was read. The lock is held while
+    // reading, so that concurrent requests for the same file wait for the result instead of reading it again.
+    GravityFieldCoefficientsCache& coefficientsCache = getGravityFieldCoefficientsCache( );
+    std::lock_guard< std::mutex > cacheLock( coefficientsCache.cacheMutex );
+    std::tuple< std::string, int, int, int, int > cacheKey = std::make_tuple(
+                fileName, maximumDegree, maximumOrder, gravitationalParameterIndex, referenceRadiusIndex );
+    auto cacheIterator = coefficientsCache.cachedCoefficients.find( cacheKey );
+    if( cacheIterator == coefficientsCache.cachedCoefficients.end( ) || errorCode ||
+            cacheIterator->second.fileSize != fileSize || cacheIterator->second.modificationTime != modificationTime )
+    {
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > coefficients;
+        CachedGravityFieldCoefficients cachedCoefficients;
+        cachedCoefficients.fileSize = fileSize;
+        cachedCoefficients.modificationTime = modificationTime;
+        cachedCoefficients.referenceData = readGravityFieldFile(
+                    fileName, maximumDegree, maximumOrder, coefficients,
+                    gravitationalParameterIndex, referenceRadiusIndex );
+        cachedCoefficients.cosineCoefficients = basic_mathematics::CopyOnWriteMatrix( std::move( coefficients.first ) );
+        cachedCoefficients.sineCoefficients = basic_mathematics::CopyOnWriteMatrix( std::move( coefficients.second ) );
+        cacheIterator = coefficientsCache.cachedCoefficients.insert_or_assign( cacheKey, cachedCoefficients ).first;
+    }
+
+    cosineCoefficients = cacheIterator->second.cosineCoefficients;
+    sineCoefficients = cacheIterator->second.sineCoefficients;
+    return cacheIterator->second.referenceData;
+}
+
+//! Function to clear the cache of gravity field coefficients used by loadGravityFieldCoefficients
+void clearGravityFieldCoefficientsCache( )
+{
+    GravityFieldCoefficientsCache& coefficientsCache = getGravityFieldCoefficientsCache( );
+    std::lock_guard< std::mutex > cacheLock( coefficientsCache.cacheMutex );
+    coefficientsCache.cachedCoefficients.clear( );
+}
+
 //! Function to create a gravity field model.
 std::shared_ptr< gravitation::GravityFieldModel > createGravityFieldModel(
         const std::shared_ptr< GravityFieldSettings > gravityFieldSettings,
@@ -341,10 +638,10 @@ std::shared_ptr< gravitation::GravityFieldModel > createGravityFieldModel(
         {
 
             // Check consistency of cosine and sine coefficients.
-            if( ( sphericalHarmonicFieldSettings->getCosineCoefficients( ).rows( ) !=
-                  sphericalHarmonicFieldSettings->getSineCoefficients( ).rows( ) ) ||
-                    ( sphericalHarmonicFieldSettings->getCosineCoefficients( ).cols( ) !=
-                      sphericalHarmonicFieldSettings->getSineCoefficients( ).cols( ) ) )
+            if( ( sphericalHarmonicFieldSettings->getSharedCosineCoefficients( ).rows( ) !=
+                  sphericalHarmonicFieldSettings->getSharedSineCoefficients( ).rows( ) ) ||
+                    ( sphericalHarmonicFieldSettings->getSharedCosineCoefficients( ).cols( ) !=
+                      sphericalHarmonicFieldSettings->getSharedSineCoefficients( ).cols( ) ) )
             {
                 throw std::runtime_error(
                             std::string( "Error when making spherical harmonic field, sine and " ) +
@@ -375,8 +672,8 @@ std::shared_ptr< gravitation::GravityFieldModel > createGravityFieldModel(
                     gravityFieldModel = std::make_shared< SphericalHarmonicsGravityField >(
                                 sphericalHarmonicFieldSettings->getGravitationalParameter( ),
                                 sphericalHarmonicFieldSettings->getReferenceRadius( ),
-                                sphericalHarmonicFieldSettings->getCosineCoefficients( ),
-                                sphericalHarmonicFieldSettings->getSineCoefficients( ),
+                                sphericalHarmonicFieldSettings->getSharedCosineCoefficients( ),
+                                sphericalHarmonicFieldSettings->getSharedSineCoefficients( ),
                                 associatedReferenceFrame,
                                 sphericalHarmonicFieldSettings->getScaledMeanMomentOfInertia( ) );
                 }
@@ -393,8 +690,8 @@ std::shared_ptr< gravitation::GravityFieldModel > createGravityFieldModel(
                     gravityFieldModel = std::make_shared< TimeDependentSphericalHarmonicsGravityField >(
                                 sphericalHarmonicFieldSettings->getGravitationalParameter( ),
                                 sphericalHarmonicFieldSettings->getReferenceRadius( ),
-                                sphericalHarmonicFieldSettings->getCosineCoefficients( ),
-                                sphericalHarmonicFieldSettings->getSineCoefficients( ),
+                                sphericalHarmonicFieldSettings->getSharedCosineCoefficients( ),
+                                sphericalHarmonicFieldSettings->getSharedSineCoefficients( ),
                                 associatedReferenceFrame,
                                 sphericalHarmonicFieldSettings->getScaledMeanMomentOfInertia( ) );
                 }
@@ -439,13 +736,30 @@ std::shared_ptr< gravitation::GravityFieldModel > createGravityFieldModel(
                 }
             }
 
-            // Create and initialize polyhedron gravity field model.
-            gravityFieldModel = std::make_shared< PolyhedronGravityField >(
-                    polyhedronFieldSettings->getGravitationalParameter(),
-                    polyhedronFieldSettings->getVerticesCoordinates(),
-                    polyhedronFieldSettings->getVerticesDefiningEachFacet(),
-                    associatedReferenceFrame,
-                    inertiaTensorUpdateFunction );
+            // Create and initialize polyhedron gravity field model, with spherical harmonic far field if required.
+            std::shared_ptr< HybridPolyhedronGravityFieldSettings > hybridFieldSettings =
+                    std::dynamic_pointer_cast< HybridPolyhedronGravityFieldSettings >( polyhedronFieldSettings );
+            if( hybridFieldSettings != nullptr )
+            {
+                gravityFieldModel = std::make_shared< HybridPolyhedronGravityField >(
+                        hybridFieldSettings->getGravitationalParameter(),
+                        hybridFieldSettings->getVerticesCoordinates(),
+                        hybridFieldSettings->getVerticesDefiningEachFacet(),
+                        hybridFieldSettings->getMaximumDegree( ),
+                        hybridFieldSettings->getInnerSwitchDistance( ),
+                        hybridFieldSettings->getOuterSwitchDistance( ),
+                        associatedReferenceFrame,
+                        inertiaTensorUpdateFunction );
+            }
+            else
+            {
+                gravityFieldModel = std::make_shared< PolyhedronGravityField >(
+                        polyhedronFieldSettings->getGravitationalParameter(),
+                        polyhedronFieldSettings->getVerticesCoordinates(),
+                        polyhedronFieldSettings->getVerticesDefiningEachFacet(),
+                        associatedReferenceFrame,
+                        inertiaTensorUpdateFunction );
+            }
         }
         break;
     }
@@ -177,6 +177,25 @@ std::vector< std::pair< std::string, std::string > > getGroundStationsLinkEndLis
     return stationList;
 }
 
+//! Function to tabulate the body deformation of all ground stations over a given interval
+void tabulateGroundStationBodyDeformations(
+        const SystemOfBodies& bodies,
+        const double startTime,
+        const double endTime,
+        const double timeStep,
+        const int numberOfInterpolationPoints )
+{
+    for( auto bodyIterator : bodies.getMap( ) )
+    {
+        for( auto stationIterator : bodyIterator.second->getGroundStationMap( ) )
+        {
+            ground_stations::tabulateBodyDeformationStationMotion(
+                        stationIterator.second->getNominalStationState( ), startTime, endTime, timeStep,
+                        numberOfInterpolationPoints );
+        }
+    }
+}
+
 std::vector< double >  getTargetElevationAngles(
         const std::shared_ptr< Body > observingBody,
         const std::shared_ptr< Body > targetBody,
@@ -209,6 +228,63 @@ std::vector< double >  getTargetElevationAngles(
     return elevationAngles;
 }
 
+//! Function to create a network of ground stations on a body, for which states and pointing angles are computed in one pass
+std::shared_ptr< ground_stations::GroundStationNetwork > createGroundStationNetwork(
+        const std::shared_ptr< Body > body,
+        const std::vector< std::string >& groundStationNames )
+{
+    std::map< std::string, std::shared_ptr< ground_stations::GroundStation > > groundStationMap =
+            body->getGroundStationMap( );
+
+    std::vector< std::shared_ptr< ground_stations::GroundStation > > groundStations;
+    if( groundStationNames.size( ) == 0 )
+    {
+        for( auto stationIterator : groundStationMap )
+        {
+            groundStations.push_back( stationIterator.second );
+        }
+    }
+    else
+    {
+        for( unsigned int i = 0; i < groundStationNames.size( ); i++ )
+        {
+            if( groundStationMap.count( groundStationNames.at( i ) ) == 0 )
+            {
+                throw std::runtime_error( "Error when creating ground station network, station " + groundStationNames.at( i ) +
+                                          " not found on body " + body->getBodyName( ) );
+            }
+            groundStations.push_back( groundStationMap.at( groundStationNames.at( i ) ) );
+        }
+    }
+
+    if( body->getRotationalEphemeris( ) == nullptr )
+    {
+        throw std::runtime_error( "Error when creating ground station network on body " + body->getBodyName( ) +
+                                  ", body has no rotation model" );
+    }
+
+    return std::make_shared< ground_stations::GroundStationNetwork >( groundStations, body->getRotationalEphemeris( ) );
+}
+
+//! Function to compute the elevation angles of a target body, as observed from all stations of a network, at a list of times
+Eigen::MatrixXd getTargetElevationAnglesForNetwork(
+        const std::shared_ptr< Body > observingBody,
+        const std::shared_ptr< Body > targetBody,
+        const std::shared_ptr< ground_stations::GroundStationNetwork > groundStationNetwork,
+        const std::vector< double >& times )
+{
+    Eigen::MatrixXd elevationAngles = Eigen::MatrixXd::Zero( times.size( ), groundStationNetwork->getNumberOfStations( ) );
+    Eigen::Vector3d relativeTargetPosition;
+    for( unsigned int i = 0; i < times.size( ); i++ )
+    {
+        relativeTargetPosition = ( targetBody->getStateInBaseFrameFromEphemeris( times.at( i ) ) -
+                                   observingBody->getStateInBaseFrameFromEphemeris( times.at( i ) ) ).segment( 0, 3 );
+        elevationAngles.row( i ) = groundStationNetwork->calculateElevationAngles(
+                    relativeTargetPosition, times.at( i ) ).transpose( );
+    }
+    return elevationAngles;
+}
+
 }
 
 }
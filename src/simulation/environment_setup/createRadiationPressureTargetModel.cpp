@@ -120,8 +120,10 @@ std::shared_ptr<electromagnetism::RadiationPressureTargetModel> createRadiationP
                         trackedBodyName);
             }
 
-            radiationPressureTargetModel = std::make_shared<PaneledRadiationPressureTargetModel>(
+            auto paneledTargetModel = std::make_shared<PaneledRadiationPressureTargetModel>(
                 panels, sourceToTargetOccultingBodies);
+            paneledTargetModel->setSelfShadowingTable(paneledTargetModelSettings->getSelfShadowingTable());
+            radiationPressureTargetModel = paneledTargetModel;
             break;
         }
         default:
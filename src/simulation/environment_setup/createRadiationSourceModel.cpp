@@ -317,7 +317,8 @@ std::shared_ptr<electromagnetism::RadiationSourceModel> createRadiationSourceMod
                 sourceBody->getShapeModel(),
                 std::move(sourcePanelRadiosityModelUpdater),
                 radiosityModels,
-                paneledModelSettings->getNumberOfPanelsPerRing());
+                paneledModelSettings->getNumberOfPanelsPerRing(),
+                paneledModelSettings->getNumberOfThreads());
         break;
     }
     default:
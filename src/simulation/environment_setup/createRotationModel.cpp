@@ -190,6 +190,9 @@ void linkTrimmedConditions(
 {
 
 
+    // Trim calculation uses the aerodynamic coefficient input at the current flight conditions
+    flightConditions->addRequiredUpdateComponent( aerodynamics::aerodynamic_coefficients_update );
+
     // Create angle-of-attack function from trim object.
     std::function< std::vector< double >( ) > untrimmedIndependentVariablesFunction =
             std::bind( &aerodynamics::AtmosphericFlightConditions::getAerodynamicCoefficientIndependentVariables,
@@ -457,7 +460,7 @@ std::shared_ptr< ephemerides::RotationalEphemeris > createRotationModel(
         }
         else
         {
-            std::shared_ptr< earth_orientation::EOPReader > eopReader = std::make_shared< earth_orientation::EOPReader >(
+            std::shared_ptr< earth_orientation::EOPReader > eopReader = earth_orientation::loadEOPReader(
                         gcrsToItrsRotationSettings->getEopFile( ),
                         gcrsToItrsRotationSettings->getEopFileFormat( ),
                         gcrsToItrsRotationSettings->getNutationTheory( ) );
@@ -513,9 +516,23 @@ std::shared_ptr< ephemerides::RotationalEphemeris > createRotationModel(
             std::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > earthOrientationCalculator =
                     std::make_shared< earth_orientation::EarthOrientationAnglesCalculator >(
                         polarMotionCalculator, precessionNutationCalculator, terrestrialTimeScaleConverter );
+
+            // Create interpolator for pre-tabulated Earth orientation angles, if requested
+            std::shared_ptr< earth_orientation::InterpolatedEarthOrientationAnglesCalculator > interpolatedAnglesCalculator;
+            std::shared_ptr< EarthOrientationInterpolationSettings > interpolationSettings =
+                    gcrsToItrsRotationSettings->getInterpolationSettings( );
+            if( interpolationSettings != nullptr )
+            {
+                interpolatedAnglesCalculator =
+                        std::make_shared< earth_orientation::InterpolatedEarthOrientationAnglesCalculator >(
+                            earthOrientationCalculator, gcrsToItrsRotationSettings->getInputTimeScale( ),
+                            interpolationSettings->startTime_, interpolationSettings->endTime_,
+                            interpolationSettings->angularAccuracy_, interpolationSettings->numberOfInterpolationPoints_ );
+            }
+
             rotationalEphemeris = std::make_shared< ephemerides::GcrsToItrsRotationModel >(
                         earthOrientationCalculator, gcrsToItrsRotationSettings->getInputTimeScale( ),
-                        gcrsToItrsRotationSettings->getOriginalFrame( ) );
+                        gcrsToItrsRotationSettings->getOriginalFrame( ), interpolatedAnglesCalculator );
 
             break;
         }
@@ -794,6 +811,27 @@ std::shared_ptr< ephemerides::RotationalEphemeris > createRotationModel(
                     std::to_string( rotationModelSettings->getRotationType( ) ) );
     }
 
+    // Replace rotation model by interpolation of its pre-tabulated values, if requested
+    std::shared_ptr< RotationModelTabulationSettings > tabulationSettings = rotationModelSettings->getTabulationSettings( );
+    if( tabulationSettings != nullptr )
+    {
+        switch( rotationModelSettings->getRotationType( ) )
+        {
+        case tabulated_rotation_model:
+        case aerodynamic_angle_based_rotation_model:
+        case pitch_trim_rotation_model:
+        case body_fixed_direction_based_rotation_model:
+        case orbital_state_based_rotation_model:
+            throw std::runtime_error( "Error when creating rotation model for " + body +
+                                      ", pre-tabulation is not supported for rotation model type " +
+                                      std::to_string( rotationModelSettings->getRotationType( ) ) );
+        default:
+            rotationalEphemeris = std::make_shared< InterpolatedRotationalEphemeris >(
+                        rotationalEphemeris, tabulationSettings->startTime_, tabulationSettings->endTime_,
+                        tabulationSettings->angularAccuracy_ );
+        }
+    }
+
     return rotationalEphemeris;
 }
 
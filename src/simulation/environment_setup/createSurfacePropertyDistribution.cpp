@@ -153,9 +153,13 @@ std::shared_ptr<electromagnetism::SurfacePropertyDistribution> createSurfaceProp
                         "Error, expected spherical harmonics surface property distribution for body " + body );
             }
 
-            surfacePropertyDistribution = std::make_shared<SphericalHarmonicsSurfacePropertyDistribution>(
-                    sphericalHarmonicsSurfacePropertyDistributionSettings->getCosineCoefficients(),
-                    sphericalHarmonicsSurfacePropertyDistributionSettings->getSineCoefficients());
+            auto sphericalHarmonicsSurfacePropertyDistribution =
+                    std::make_shared<SphericalHarmonicsSurfacePropertyDistribution>(
+                        sphericalHarmonicsSurfacePropertyDistributionSettings->getCosineCoefficients(),
+                        sphericalHarmonicsSurfacePropertyDistributionSettings->getSineCoefficients());
+            sphericalHarmonicsSurfacePropertyDistribution->setInterpolationGridResolution(
+                    sphericalHarmonicsSurfacePropertyDistributionSettings->getInterpolationGridResolution());
+            surfacePropertyDistribution = sphericalHarmonicsSurfacePropertyDistribution;
             break;
         }
         case SurfacePropertyDistributionType::second_degree_zonal_periodic:
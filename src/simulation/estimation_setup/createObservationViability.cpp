@@ -8,12 +8,15 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <algorithm>
+#include <cmath>
 #include <map>
 
 #include <functional>
 
 
 
+#include "tudat/astro/basic_astro/physicalConstants.h"
 #include "tudat/simulation/estimation_setup/createObservationViability.h"
 
 namespace tudat
@@ -255,6 +258,150 @@ createObservationViabilityCalculators(
 }
 
 
+//! Function to compute the geometric states of the link ends of an observation, at a single time
+void getGeometricLinkEndStatesAndTimes(
+        const std::vector< std::function< Eigen::Vector6d( const double ) > >& linkEndStateFunctions,
+        const std::vector< std::vector< int > >& linkEndIndices,
+        const double time,
+        std::vector< Eigen::Vector6d >& linkEndStates,
+        std::vector< double >& linkEndTimes )
+{
+    for( unsigned int i = 0; i < linkEndStateFunctions.size( ); i++ )
+    {
+        Eigen::Vector6d currentState = linkEndStateFunctions.at( i )( time );
+        for( unsigned int j = 0; j < linkEndIndices.at( i ).size( ); j++ )
+        {
+            linkEndStates[ linkEndIndices.at( i ).at( j ) ] = currentState;
+            linkEndTimes[ linkEndIndices.at( i ).at( j ) ] = time;
+        }
+    }
+}
+
+//! Function to compute the time intervals in which an observation is viable, using geometric link end states
+std::vector< std::pair< double, double > > computeGeometricObservationViabilityWindows(
+        const simulation_setup::SystemOfBodies& bodies,
+        const LinkEnds& linkEnds,
+        const ObservableType observableType,
+        const std::vector< std::shared_ptr< ObservationViabilityCalculator > >& viabilityCalculators,
+        const double startTime,
+        const double endTime,
+        const double coarseTimeStep,
+        const double boundaryTolerance )
+{
+    if( !( coarseTimeStep > 0.0 ) || !( boundaryTolerance > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when computing observation viability windows, time step and tolerance must be positive" );
+    }
+
+    // Retrieve link end state functions, and their indices in the link end states
+    std::vector< std::function< Eigen::Vector6d( const double ) > > linkEndStateFunctions;
+    std::vector< std::vector< int > > linkEndIndices;
+    int numberOfLinkEndStates = 0;
+    for( auto linkEndIterator : linkEnds )
+    {
+        linkEndStateFunctions.push_back(
+                    simulation_setup::getLinkEndCompleteEphemerisFunction< double, double >( linkEndIterator.second, bodies ) );
+        linkEndIndices.push_back( getLinkEndIndicesForLinkEndTypeAtObservable(
+                                      observableType, linkEndIterator.first, linkEnds.size( ) ) );
+        for( unsigned int i = 0; i < linkEndIndices.back( ).size( ); i++ )
+        {
+            numberOfLinkEndStates = std::max( numberOfLinkEndStates, linkEndIndices.back( ).at( i ) + 1 );
+        }
+    }
+
+    std::vector< Eigen::Vector6d > linkEndStates( numberOfLinkEndStates, Eigen::Vector6d::Zero( ) );
+    std::vector< double > linkEndTimes( numberOfLinkEndStates, TUDAT_NAN );
+    double maximumLightTime = 0.0;
+
+    // Function to evaluate viability at a single time (updating maximum light time)
+    auto isViable = [ & ]( const double time )
+    {
+        getGeometricLinkEndStatesAndTimes( linkEndStateFunctions, linkEndIndices, time, linkEndStates, linkEndTimes );
+
+        double currentLightTime = 0.0;
+        for( int i = 0; i + 1 < numberOfLinkEndStates; i += 2 )
+        {
+            currentLightTime += ( linkEndStates.at( i + 1 ) - linkEndStates.at( i ) ).segment( 0, 3 ).norm( ) /
+                    physical_constants::SPEED_OF_LIGHT;
+        }
+        maximumLightTime = std::max( maximumLightTime, currentLightTime );
+
+        return isObservationViable( linkEndStates, linkEndTimes, viabilityCalculators );
+    };
+
+    // Function to find time at which viability changes between two times, returning the time on the non-viable side
+    auto findBoundary = [ & ]( double viableTime, double nonViableTime )
+    {
+        while( std::fabs( viableTime - nonViableTime ) > boundaryTolerance )
+        {
+            double midTime = ( viableTime + nonViableTime ) / 2.0;
+            if( isViable( midTime ) )
+            {
+                viableTime = midTime;
+            }
+            else
+            {
+                nonViableTime = midTime;
+            }
+        }
+        return nonViableTime;
+    };
+
+    // Evaluate viability on grid, and refine window boundaries
+    std::vector< std::pair< double, double > > viabilityWindows;
+    double previousTime = startTime;
+    bool previousViability = isViable( startTime );
+    double currentWindowStart = startTime;
+    bool isLastTime = !( endTime > startTime );
+    while( !isLastTime )
+    {
+        double currentTime = previousTime + coarseTimeStep;
+        if( currentTime >= endTime )
+        {
+            currentTime = endTime;
+            isLastTime = true;
+        }
+
+        bool currentViability = isViable( currentTime );
+        if( currentViability && !previousViability )
+        {
+            currentWindowStart = findBoundary( currentTime, previousTime );
+        }
+        else if( !currentViability && previousViability )
+        {
+            viabilityWindows.push_back( std::make_pair( currentWindowStart, findBoundary( previousTime, currentTime ) ) );
+        }
+
+        previousTime = currentTime;
+        previousViability = currentViability;
+    }
+
+    if( previousViability )
+    {
+        viabilityWindows.push_back( std::make_pair( currentWindowStart, endTime ) );
+    }
+
+    // Extend windows by margin, and merge overlapping windows
+    double margin = maximumLightTime + boundaryTolerance;
+    std::vector< std::pair< double, double > > extendedViabilityWindows;
+    for( unsigned int i = 0; i < viabilityWindows.size( ); i++ )
+    {
+        double currentStart = viabilityWindows.at( i ).first - margin;
+        double currentEnd = viabilityWindows.at( i ).second + margin;
+        if( extendedViabilityWindows.size( ) > 0 && currentStart <= extendedViabilityWindows.back( ).second )
+        {
+            extendedViabilityWindows.back( ).second = currentEnd;
+        }
+        else
+        {
+            extendedViabilityWindows.push_back( std::make_pair( currentStart, currentEnd ) );
+        }
+    }
+
+    return extendedViabilityWindows;
+}
+
+
 } // namespace observation_models
 
 } // namespace tudat
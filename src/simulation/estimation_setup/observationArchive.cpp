@@ -0,0 +1,342 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cstring>
+#include <fstream>
+
+#include "tudat/simulation/estimation_setup/observationArchive.h"
+
+namespace tudat
+{
+
+namespace observation_models
+{
+
+//! Identifier at the start of each observation archive
+static const char OBSERVATION_ARCHIVE_IDENTIFIER[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'O', 'B', 'S' };
+
+//! Byte order mark, to detect archives written on platforms with different byte order
+static const uint32_t OBSERVATION_ARCHIVE_BYTE_ORDER_MARK = 0x01020304;
+
+//! Size of the file header of an observation archive
+static const std::size_t OBSERVATION_ARCHIVE_FILE_HEADER_SIZE = 16;
+
+static_assert( sizeof( ObservationArchiveRecordHeader ) == 80, "Observation archive record header has unexpected size" );
+
+//! Function to round a number of bytes up to a multiple of 8
+std::size_t getObservationArchivePaddedSize( const std::size_t numberOfBytes )
+{
+    return ( ( numberOfBytes + 7 ) / 8 ) * 8;
+}
+
+//! Function to write a block of data to an archive, padded with zeros to a multiple of 8 bytes
+void writeObservationArchiveBlock( std::ofstream& archiveStream, const void* data, const std::size_t numberOfBytes )
+{
+    static const char padding[ 8 ] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    if( numberOfBytes > 0 )
+    {
+        archiveStream.write( static_cast< const char* >( data ), numberOfBytes );
+    }
+    archiveStream.write( padding, getObservationArchivePaddedSize( numberOfBytes ) - numberOfBytes );
+}
+
+//! Constructor, maps the archive into memory and interprets the record headers
+ObservationArchiveReader::ObservationArchiveReader( const std::string& fileName ):
+    mappedFile_( std::make_shared< input_output::MemoryMappedFile >( fileName ) )
+{
+    const char* archiveData = mappedFile_->getData( );
+    const std::size_t archiveSize = mappedFile_->getSize( );
+
+    // Check file header
+    if( archiveSize < OBSERVATION_ARCHIVE_FILE_HEADER_SIZE ||
+            std::memcmp( archiveData, OBSERVATION_ARCHIVE_IDENTIFIER, 8 ) != 0 )
+    {
+        throw std::runtime_error( "Error when reading observation archive " + fileName + ", file is not an observation archive." );
+    }
+
+    uint32_t byteOrderMark;
+    std::memcpy( &version_, archiveData + 8, sizeof( uint32_t ) );
+    std::memcpy( &byteOrderMark, archiveData + 12, sizeof( uint32_t ) );
+    if( byteOrderMark != OBSERVATION_ARCHIVE_BYTE_ORDER_MARK )
+    {
+        throw std::runtime_error( "Error when reading observation archive " + fileName +
+                                  ", archive was written on platform with different byte order." );
+    }
+    else if( version_ > OBSERVATION_ARCHIVE_VERSION )
+    {
+        throw std::runtime_error( "Error when reading observation archive " + fileName + ", archive version " +
+                                  std::to_string( version_ ) + " is not supported (maximum supported version is " +
+                                  std::to_string( OBSERVATION_ARCHIVE_VERSION ) + ")." );
+    }
+
+    // Interpret records
+    std::size_t recordStart = OBSERVATION_ARCHIVE_FILE_HEADER_SIZE;
+    while( recordStart < archiveSize )
+    {
+        if( archiveSize - recordStart < sizeof( ObservationArchiveRecordHeader ) )
+        {
+            throw std::runtime_error( "Error when reading observation archive " + fileName + ", file is truncated." );
+        }
+
+        ObservationArchiveRecord record;
+        record.header_ = reinterpret_cast< const ObservationArchiveRecordHeader* >( archiveData + recordStart );
+        const ObservationArchiveRecordHeader& header = *record.header_;
+        if( header.recordSize_ < sizeof( ObservationArchiveRecordHeader ) || header.recordSize_ > archiveSize - recordStart )
+        {
+            throw std::runtime_error( "Error when reading observation archive " + fileName + ", record size is inconsistent." );
+        }
+        const char* recordEnd = archiveData + recordStart + header.recordSize_;
+
+        record.observableType_ = static_cast< ObservableType >( header.observableType_ );
+        record.referenceLinkEnd_ = static_cast< LinkEndType >( header.referenceLinkEnd_ );
+
+        const char* currentData = archiveData + recordStart + sizeof( ObservationArchiveRecordHeader );
+        auto checkRecordSize = [ & ]( const std::size_t numberOfBytes )
+        {
+            if( numberOfBytes > static_cast< std::size_t >( recordEnd - currentData ) )
+            {
+                throw std::runtime_error( "Error when reading observation archive " + fileName +
+                                          ", record contents are inconsistent with its size." );
+            }
+        };
+
+        // Parse link ends
+        for( int i = 0; i < header.numberOfLinkEnds_; i++ )
+        {
+            int32_t linkEndHeader[ 4 ];
+            checkRecordSize( sizeof( linkEndHeader ) );
+            std::memcpy( linkEndHeader, currentData, sizeof( linkEndHeader ) );
+            currentData += sizeof( linkEndHeader );
+
+            std::size_t namesSize = getObservationArchivePaddedSize( linkEndHeader[ 1 ] + linkEndHeader[ 2 ] );
+            checkRecordSize( namesSize );
+            record.linkEnds_[ static_cast< LinkEndType >( linkEndHeader[ 0 ] ) ] =
+                    LinkEndId( std::string( currentData, linkEndHeader[ 1 ] ),
+                               std::string( currentData + linkEndHeader[ 1 ], linkEndHeader[ 2 ] ) );
+            currentData += namesSize;
+        }
+
+        // Parse ancilliary settings
+        for( int i = 0; i < header.numberOfAncilliaryEntries_; i++ )
+        {
+            int32_t ancilliaryHeader[ 2 ];
+            checkRecordSize( sizeof( ancilliaryHeader ) );
+            std::memcpy( ancilliaryHeader, currentData, sizeof( ancilliaryHeader ) );
+            currentData += sizeof( ancilliaryHeader );
+
+            checkRecordSize( ancilliaryHeader[ 1 ] * sizeof( double ) );
+            const double* ancilliaryValues = reinterpret_cast< const double* >( currentData );
+            record.ancilliaryData_[ static_cast< ObservationAncilliarySimulationVariable >( ancilliaryHeader[ 0 ] ) ] =
+                    std::vector< double >( ancilliaryValues, ancilliaryValues + ancilliaryHeader[ 1 ] );
+            currentData += ancilliaryHeader[ 1 ] * sizeof( double );
+        }
+
+        // Set pointers to data arrays
+        const std::size_t numberOfObservations = header.numberOfObservations_;
+        checkRecordSize( numberOfObservations * sizeof( double ) *
+                         ( 2 + header.singleObservationSize_ + header.dependentVariableSize_ ) );
+        record.observationTimesHigh_ = reinterpret_cast< const double* >( currentData );
+        record.observationTimesLow_ = record.observationTimesHigh_ + numberOfObservations;
+        record.observations_ = record.observationTimesLow_ + numberOfObservations;
+        record.dependentVariables_ = ( header.dependentVariableSize_ > 0 ) ?
+                    record.observations_ + numberOfObservations * header.singleObservationSize_ : nullptr;
+
+        records_.push_back( record );
+        recordStart += header.recordSize_;
+    }
+}
+
+//! Function to open an observation archive for writing, writing the file header if a new archive is started
+static void openObservationArchiveForWriting(
+        std::ofstream& archiveStream,
+        const std::string& fileName,
+        const bool appendToFile )
+{
+    // Check if an existing archive is to be extended
+    bool writeFileHeader = true;
+    if( appendToFile )
+    {
+        std::ifstream existingFile( fileName, std::ios::binary | std::ios::ate );
+        if( existingFile.is_open( ) && existingFile.tellg( ) > 0 )
+        {
+            ObservationArchiveReader existingArchive( fileName );
+            if( existingArchive.getVersion( ) != OBSERVATION_ARCHIVE_VERSION )
+            {
+                throw std::runtime_error( "Error when appending to observation archive " + fileName +
+                                          ", archive was written with different version." );
+            }
+            writeFileHeader = false;
+        }
+    }
+
+    archiveStream.open( fileName, std::ios::binary | ( writeFileHeader ? std::ios::trunc : std::ios::app ) );
+    if( !archiveStream.is_open( ) )
+    {
+        throw std::runtime_error( "Error when writing observation archive " + fileName + ", file could not be opened." );
+    }
+
+    if( writeFileHeader )
+    {
+        archiveStream.write( OBSERVATION_ARCHIVE_IDENTIFIER, 8 );
+        archiveStream.write( reinterpret_cast< const char* >( &OBSERVATION_ARCHIVE_VERSION ), sizeof( uint32_t ) );
+        archiveStream.write( reinterpret_cast< const char* >( &OBSERVATION_ARCHIVE_BYTE_ORDER_MARK ), sizeof( uint32_t ) );
+    }
+}
+
+//! Function to write a single record to an (opened) observation archive
+static void writeObservationArchiveRecord(
+        std::ofstream& archiveStream,
+        const ObservationArchiveRecordContents& record,
+        const std::string& fileName )
+{
+    const std::size_t numberOfObservations = record.observationTimesHigh_.size( );
+    if( record.observationTimesLow_.size( ) != numberOfObservations ||
+            record.observations_.size( ) != numberOfObservations * record.singleObservationSize_ ||
+            record.dependentVariables_.size( ) != numberOfObservations * record.dependentVariableSize_ )
+    {
+        throw std::runtime_error( "Error when writing observation archive " + fileName +
+                                  ", record contents are of inconsistent size." );
+    }
+
+    // Create record header
+    ObservationArchiveRecordHeader header;
+    std::memset( &header, 0, sizeof( header ) );
+    header.observableType_ = static_cast< int32_t >( record.observableType_ );
+    header.referenceLinkEnd_ = static_cast< int32_t >( record.referenceLinkEnd_ );
+    header.numberOfLinkEnds_ = static_cast< int32_t >( record.linkEnds_.size( ) );
+    header.singleObservationSize_ = record.singleObservationSize_;
+    header.numberOfObservations_ = numberOfObservations;
+    header.dependentVariableSize_ = record.dependentVariableSize_;
+    header.numberOfAncilliaryEntries_ = static_cast< int32_t >( record.ancilliaryData_.size( ) );
+    header.isTimeSorted_ = 1;
+
+    std::size_t minimumTimeIndex = 0, maximumTimeIndex = 0;
+    auto isTimeSmaller = [ & ]( const std::size_t index1, const std::size_t index2 )
+    {
+        return ( record.observationTimesHigh_[ index1 ] < record.observationTimesHigh_[ index2 ] ) ||
+                ( record.observationTimesHigh_[ index1 ] == record.observationTimesHigh_[ index2 ] &&
+                  record.observationTimesLow_[ index1 ] < record.observationTimesLow_[ index2 ] );
+    };
+    for( std::size_t i = 1; i < numberOfObservations; i++ )
+    {
+        if( isTimeSmaller( i, i - 1 ) )
+        {
+            header.isTimeSorted_ = 0;
+        }
+        if( isTimeSmaller( i, minimumTimeIndex ) )
+        {
+            minimumTimeIndex = i;
+        }
+        if( isTimeSmaller( maximumTimeIndex, i ) )
+        {
+            maximumTimeIndex = i;
+        }
+    }
+    if( numberOfObservations > 0 )
+    {
+        header.minimumObservationTime_[ 0 ] = record.observationTimesHigh_[ minimumTimeIndex ];
+        header.minimumObservationTime_[ 1 ] = record.observationTimesLow_[ minimumTimeIndex ];
+        header.maximumObservationTime_[ 0 ] = record.observationTimesHigh_[ maximumTimeIndex ];
+        header.maximumObservationTime_[ 1 ] = record.observationTimesLow_[ maximumTimeIndex ];
+    }
+
+    // Compute record size
+    std::size_t recordSize = sizeof( ObservationArchiveRecordHeader );
+    for( auto linkEndIterator : record.linkEnds_ )
+    {
+        recordSize += 4 * sizeof( int32_t ) + getObservationArchivePaddedSize(
+                    linkEndIterator.second.bodyName_.size( ) + linkEndIterator.second.stationName_.size( ) );
+    }
+    for( auto ancilliaryIterator : record.ancilliaryData_ )
+    {
+        recordSize += 2 * sizeof( int32_t ) + ancilliaryIterator.second.size( ) * sizeof( double );
+    }
+    recordSize += sizeof( double ) * ( 2 * numberOfObservations + record.observations_.size( ) +
+                                       record.dependentVariables_.size( ) );
+    header.recordSize_ = recordSize;
+
+    // Write record
+    archiveStream.write( reinterpret_cast< const char* >( &header ), sizeof( header ) );
+    for( auto linkEndIterator : record.linkEnds_ )
+    {
+        std::string linkEndNames = linkEndIterator.second.bodyName_ + linkEndIterator.second.stationName_;
+        int32_t linkEndHeader[ 4 ] = { static_cast< int32_t >( linkEndIterator.first ),
+                                       static_cast< int32_t >( linkEndIterator.second.bodyName_.size( ) ),
+                                       static_cast< int32_t >( linkEndIterator.second.stationName_.size( ) ), 0 };
+        archiveStream.write( reinterpret_cast< const char* >( linkEndHeader ), sizeof( linkEndHeader ) );
+        writeObservationArchiveBlock( archiveStream, linkEndNames.data( ), linkEndNames.size( ) );
+    }
+    for( auto ancilliaryIterator : record.ancilliaryData_ )
+    {
+        int32_t ancilliaryHeader[ 2 ] = { static_cast< int32_t >( ancilliaryIterator.first ),
+                                          static_cast< int32_t >( ancilliaryIterator.second.size( ) ) };
+        archiveStream.write( reinterpret_cast< const char* >( ancilliaryHeader ), sizeof( ancilliaryHeader ) );
+        writeObservationArchiveBlock( archiveStream, ancilliaryIterator.second.data( ),
+                                      ancilliaryIterator.second.size( ) * sizeof( double ) );
+    }
+    writeObservationArchiveBlock( archiveStream, record.observationTimesHigh_.data( ),
+                                  numberOfObservations * sizeof( double ) );
+    writeObservationArchiveBlock( archiveStream, record.observationTimesLow_.data( ),
+                                  numberOfObservations * sizeof( double ) );
+    writeObservationArchiveBlock( archiveStream, record.observations_.data( ),
+                                  record.observations_.size( ) * sizeof( double ) );
+    writeObservationArchiveBlock( archiveStream, record.dependentVariables_.data( ),
+                                  record.dependentVariables_.size( ) * sizeof( double ) );
+}
+
+//! Function to write records to a binary observation archive
+void writeObservationArchiveRecords(
+        const std::vector< ObservationArchiveRecordContents >& records,
+        const std::string& fileName,
+        const bool appendToFile )
+{
+    std::ofstream archiveStream;
+    openObservationArchiveForWriting( archiveStream, fileName, appendToFile );
+
+    for( const ObservationArchiveRecordContents& record : records )
+    {
+        writeObservationArchiveRecord( archiveStream, record, fileName );
+    }
+
+    if( !archiveStream )
+    {
+        throw std::runtime_error( "Error when writing observation archive " + fileName + ", data could not be written." );
+    }
+}
+
+//! Constructor, opens the archive for writing
+ObservationArchiveWriter::ObservationArchiveWriter( const std::string& fileName, const bool appendToFile ):
+    fileName_( fileName ), numberOfWrittenRecords_( 0 ), numberOfWrittenObservations_( 0 )
+{
+    openObservationArchiveForWriting( archiveStream_, fileName_, appendToFile );
+    archiveStream_.flush( );
+}
+
+//! Destructor, closes the archive
+ObservationArchiveWriter::~ObservationArchiveWriter( ){ }
+
+//! Function to append a single record to the archive, and flush it to disk
+void ObservationArchiveWriter::writeRecord( const ObservationArchiveRecordContents& record )
+{
+    std::lock_guard< std::mutex > lock( writeMutex_ );
+    writeObservationArchiveRecord( archiveStream_, record, fileName_ );
+    archiveStream_.flush( );
+    if( !archiveStream_ )
+    {
+        throw std::runtime_error( "Error when writing observation archive " + fileName_ + ", data could not be written." );
+    }
+
+    numberOfWrittenRecords_++;
+    numberOfWrittenObservations_ += record.observationTimesHigh_.size( );
+}
+
+} // namespace observation_models
+
+} // namespace tudat
@@ -1,3 +1,6 @@
+#include <cmath>
+
+#include "tudat/math/statistics/randomSampling.h"
 #include "tudat/simulation/estimation_setup/observationSimulationSettings.h"
 
 namespace tudat
@@ -41,6 +44,64 @@ std::function< Eigen::VectorXd( const double ) > getNoiseFunctionForObservable(
 }
 
 
+//! Function to generate the noise for a single observation
+Eigen::VectorXd ObservationNoiseGenerator::generateSingleObservationNoise( const double observationTime )
+{
+    Eigen::MatrixXd noiseValues;
+    generateNoise( std::vector< double >( { observationTime } ), noiseValues );
+    return noiseValues.col( 0 );
+}
+
+//! Function to generate the noise for a list of consecutive observations
+void GaussianObservationNoiseGenerator::generateNoise(
+        const std::vector< double >& observationTimes, Eigen::MatrixXd& noiseValues )
+{
+    noiseValues.resize( observationSize_, observationTimes.size( ) );
+    statistics::fillGaussianRandomMatrix(
+                noiseValues, static_cast< uint64_t >( seed_ ), mean_, standardDeviation_, numberOfThreads_,
+                numberOfGeneratedObservations_ );
+    numberOfGeneratedObservations_ += observationTimes.size( );
+}
+
+//! Constructor
+TimeCorrelatedGaussianObservationNoiseGenerator::TimeCorrelatedGaussianObservationNoiseGenerator(
+        const double standardDeviation,
+        const double correlationTime,
+        const int seed,
+        const int observationSize,
+        const int numberOfThreads ):
+    GaussianObservationNoiseGenerator( standardDeviation, 0.0, seed, observationSize, numberOfThreads ),
+    correlationTime_( correlationTime ), previousObservationTime_( TUDAT_NAN ),
+    previousNoise_( Eigen::VectorXd::Zero( observationSize ) )
+{
+    if( !( correlationTime_ > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating time-correlated observation noise, correlation time must be positive" );
+    }
+}
+
+//! Function to generate the noise for a list of consecutive observations
+void TimeCorrelatedGaussianObservationNoiseGenerator::generateNoise(
+        const std::vector< double >& observationTimes, Eigen::MatrixXd& noiseValues )
+{
+    // Generate white noise with steady-state standard deviation
+    GaussianObservationNoiseGenerator::generateNoise( observationTimes, noiseValues );
+
+    // Apply first-order Gauss-Markov recursion
+    for( unsigned int i = 0; i < observationTimes.size( ); i++ )
+    {
+        if( previousObservationTime_ == previousObservationTime_ )
+        {
+            double correlationCoefficient = std::exp(
+                        -std::fabs( observationTimes.at( i ) - previousObservationTime_ ) / correlationTime_ );
+            noiseValues.col( i ) = correlationCoefficient * previousNoise_ +
+                    std::sqrt( 1.0 - correlationCoefficient * correlationCoefficient ) * noiseValues.col( i );
+        }
+        previousNoise_ = noiseValues.col( i );
+        previousObservationTime_ = observationTimes.at( i );
+    }
+}
+
 Eigen::VectorXd getIdenticallyAndIndependentlyDistributedNoise(
         const std::function< double( const double ) > noiseFunction,
         const int observationSize,
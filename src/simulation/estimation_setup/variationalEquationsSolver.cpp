@@ -31,41 +31,123 @@ namespace propagators
 //template class MultiArcVariationalEquationsSolver< double, Time >;
 //template class MultiArcVariationalEquationsSolver< long double, Time >;
 
+//! Function to determine which entries of the numerical solution of the variational equations are to be retained
+std::vector< bool > getRetainedVariationalSolutionEntries(
+        const std::vector< double >& solutionEpochs,
+        const std::shared_ptr< VariationalEquationsRetentionSettings > retentionSettings,
+        const int numberOfInterpolationPoints )
+{
+    const int numberOfEpochs = static_cast< int >( solutionEpochs.size( ) );
+    if( retentionSettings == nullptr || retentionSettings->getRetainedEpochs( ).size( ) == 0 )
+    {
+        return std::vector< bool >( numberOfEpochs, true );
+    }
+
+    // Retain data points used by the cubic spline boundary interpolators of the Lagrange interpolator
+    std::vector< bool > isEntryRetained( numberOfEpochs, false );
+    const int numberOfBoundaryPoints = std::min( std::max( numberOfInterpolationPoints / 2, 4 ), numberOfEpochs );
+    for( int i = 0; i < numberOfBoundaryPoints; i++ )
+    {
+        isEntryRetained[ i ] = true;
+        isEntryRetained[ numberOfEpochs - 1 - i ] = true;
+    }
+
+    // Retain data points used by the interpolation within the margin around each retained epoch
+    auto getLowerEntry = [ & ]( const double epoch )
+    {
+        int lowerEntry = static_cast< int >(
+                    std::upper_bound( solutionEpochs.begin( ), solutionEpochs.end( ), epoch ) - solutionEpochs.begin( ) ) - 1;
+        return std::min( std::max( lowerEntry, 0 ), numberOfEpochs - 2 );
+    };
+    const double retainedEpochMargin = retentionSettings->getRetainedEpochMargin( );
+    for( const double retainedEpoch : retentionSettings->getRetainedEpochs( ) )
+    {
+        int firstEntry = std::max( getLowerEntry( retainedEpoch - retainedEpochMargin ) -
+                                   ( numberOfInterpolationPoints / 2 - 1 ), 0 );
+        int lastEntry = std::min( getLowerEntry( retainedEpoch + retainedEpochMargin ) +
+                                  numberOfInterpolationPoints / 2, numberOfEpochs - 1 );
+        for( int i = firstEntry; i <= lastEntry; i++ )
+        {
+            isEntryRetained[ i ] = true;
+        }
+    }
+    return isEntryRetained;
+}
+
+//! Function to remove the entries of a matrix history that are not to be retained
+void removeUnretainedVariationalSolutionEntries(
+        std::map< double, Eigen::MatrixXd >& matrixHistory,
+        const std::shared_ptr< VariationalEquationsRetentionSettings > retentionSettings,
+        const int numberOfInterpolationPoints )
+{
+    std::vector< bool > isEntryRetained = getRetainedVariationalSolutionEntries(
+                utilities::createVectorFromMapKeys< Eigen::MatrixXd, double >( matrixHistory ),
+                retentionSettings, numberOfInterpolationPoints );
+
+    unsigned int currentEntry = 0;
+    for( auto matrixIterator = matrixHistory.begin( ); matrixIterator != matrixHistory.end( ); currentEntry++ )
+    {
+        if( !isEntryRetained.at( currentEntry ) )
+        {
+            matrixIterator = matrixHistory.erase( matrixIterator );
+        }
+        else
+        {
+            matrixIterator++;
+        }
+    }
+}
+
 //! Function to create interpolators for state transition and sensitivity matrices from numerical results.
 void createStateTransitionAndSensitivityMatrixInterpolator(
         std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >& stateTransitionMatrixInterpolator,
         std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >& sensitivityMatrixInterpolator,
         std::map< double, Eigen::MatrixXd >& stateTransitionSolution,
         std::map< double, Eigen::MatrixXd >& sensitivitySolution,
-        const bool clearRawSolution )
+        const bool clearRawSolution,
+        const std::shared_ptr< VariationalEquationsRetentionSettings > retentionSettings )
 {
-    // Create interpolator for state transition matrix.
-    stateTransitionMatrixInterpolator=
-            std::make_shared< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > >(
-                utilities::createVectorFromMapKeys< Eigen::MatrixXd, double >( stateTransitionSolution ),
-                utilities::createVectorFromMapValues< Eigen::MatrixXd, double >( stateTransitionSolution ), 4 );
-//    if( clearRawSolution )
-//    {
-//        variationalEquationsSolution[ 0 ].clear( );
-//    }
-
-    // Create interpolator for sensitivity matrix.
-    sensitivityMatrixInterpolator =
-            std::make_shared< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > >(
-                utilities::createVectorFromMapKeys< Eigen::MatrixXd, double >( sensitivitySolution ),
-                utilities::createVectorFromMapValues< Eigen::MatrixXd, double >( sensitivitySolution ), 4 );
+    const int numberOfInterpolationPoints = 4;
+
+    // Remove entries that are not needed to interpolate the matrices at the retained epochs
+    if( retentionSettings != nullptr )
+    {
+        removeUnretainedVariationalSolutionEntries(
+                    stateTransitionSolution, retentionSettings, numberOfInterpolationPoints );
+        removeUnretainedVariationalSolutionEntries(
+                    sensitivitySolution, retentionSettings, numberOfInterpolationPoints );
+    }
+
+    if( retentionSettings != nullptr && retentionSettings->useSinglePrecision( ) )
+    {
+        // Create single-precision interpolators for state transition and sensitivity matrix.
+        stateTransitionMatrixInterpolator = std::make_shared< SinglePrecisionMatrixInterpolator >(
+                    stateTransitionSolution, numberOfInterpolationPoints );
+        sensitivityMatrixInterpolator = std::make_shared< SinglePrecisionMatrixInterpolator >(
+                    sensitivitySolution, numberOfInterpolationPoints );
+    }
+    else
+    {
+        // Create interpolator for state transition matrix.
+        stateTransitionMatrixInterpolator=
+                std::make_shared< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > >(
+                    utilities::createVectorFromMapKeys< Eigen::MatrixXd, double >( stateTransitionSolution ),
+                    utilities::createVectorFromMapValues< Eigen::MatrixXd, double >( stateTransitionSolution ),
+                    numberOfInterpolationPoints );
+
+        // Create interpolator for sensitivity matrix.
+        sensitivityMatrixInterpolator =
+                std::make_shared< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > >(
+                    utilities::createVectorFromMapKeys< Eigen::MatrixXd, double >( sensitivitySolution ),
+                    utilities::createVectorFromMapValues< Eigen::MatrixXd, double >( sensitivitySolution ),
+                    numberOfInterpolationPoints );
+    }
 
     if( clearRawSolution )
     {
         stateTransitionSolution.clear( );
         sensitivitySolution.clear( );
     }
-
-//    if( clearRawSolution )
-//    {
-//        variationalEquationsSolution[ 1 ].clear( );
-//    }
-
 }
 
 
@@ -439,7 +439,13 @@ createSphericalHarmonicsGravityAcceleration(
                                  sphericalHarmonicsSettings->maximumOrder_ ),
                     std::bind( &Body::getPositionByReference, bodyExertingAcceleration, std::placeholders::_1 ),
                       std::bind( &Body::getCurrentRotationToGlobalFrame,
-                                 bodyExertingAcceleration ), useMutualAttraction );
+                                 bodyExertingAcceleration ), useMutualAttraction,
+                    sphericalHarmonicsGravityField->getSharedSphericalHarmonicsCache(
+                        nameOfBodyUndergoingAcceleration, sphericalHarmonicsSettings->summationType_ ) );
+            if( !std::isnan( sphericalHarmonicsSettings->degreeTruncationTolerance_ ) )
+            {
+                accelerationModel->setDegreeTruncationTolerance( sphericalHarmonicsSettings->degreeTruncationTolerance_ );
+            }
         }
     }
     return accelerationModel;
@@ -667,6 +673,26 @@ createPolyhedronGravityAcceleration(
                         std::bind( &Body::getCurrentRotationToGlobalFrame, bodyExertingAcceleration ),
                         useCentralBodyFixedFrame );
 
+        // Create spherical harmonic far-field acceleration, if required
+        std::shared_ptr< HybridPolyhedronGravityField > hybridGravityField =
+                std::dynamic_pointer_cast< HybridPolyhedronGravityField >( polyhedronGravityField );
+        if( hybridGravityField != nullptr )
+        {
+            std::shared_ptr< SphericalHarmonicsGravityField > farFieldGravityField =
+                    hybridGravityField->getFarFieldGravityField( );
+            accelerationModel->setFarFieldAccelerationModel(
+                        std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                            std::bind( &Body::getPositionByReference, bodyUndergoingAcceleration, std::placeholders::_1 ),
+                            gravitationalParameterFunction,
+                            farFieldGravityField->getReferenceRadius( ),
+                            std::bind( &SphericalHarmonicsGravityField::getCosineCoefficients, farFieldGravityField ),
+                            std::bind( &SphericalHarmonicsGravityField::getSineCoefficients, farFieldGravityField ),
+                            std::bind( &Body::getPositionByReference, bodyExertingAcceleration, std::placeholders::_1 ),
+                            std::bind( &Body::getCurrentRotationToGlobalFrame, bodyExertingAcceleration ),
+                            useCentralBodyFixedFrame ),
+                        hybridGravityField->getInnerSwitchDistance( ),
+                        hybridGravityField->getOuterSwitchDistance( ) );
+        }
     }
     return accelerationModel;
 }
@@ -1048,6 +1074,9 @@ std::shared_ptr< aerodynamics::AerodynamicAcceleration > createAerodynamicAccele
         throw std::runtime_error( "Error when making aerodynamic acceleration, found flight conditions that are not atmospheric." );
     }
 
+    // Aerodynamic acceleration requires aerodynamic coefficients (and body orientation) to be updated
+    bodyFlightConditions->addRequiredUpdateComponent( aerodynamics::aerodynamic_coefficients_update );
+
     // Retrieve frame in which aerodynamic coefficients are defined.
     std::shared_ptr< aerodynamics::AerodynamicCoefficientInterface > aerodynamicCoefficients =
             bodyUndergoingAcceleration->getAerodynamicCoefficientInterface( );
@@ -1164,8 +1193,25 @@ createRadiationPressureAccelerationModel(
                                       "act as occulting body.");
         }
     }
-    auto sourceToTargetOccultationModel = createOccultationModel(sourceToTargetOccultingBodies, bodies);
-    
+
+    // Reuse occultation model of other targets with same occulting bodies, if shared by source
+    std::shared_ptr<electromagnetism::OccultationModel> sourceToTargetOccultationModel;
+    if (source->getRadiationSourceModel()->getTargetOccultationModelSharing())
+    {
+        sourceToTargetOccultationModel =
+                source->getRadiationSourceModel()->getSharedTargetOccultationModel(sourceToTargetOccultingBodies);
+        if (sourceToTargetOccultationModel == nullptr)
+        {
+            sourceToTargetOccultationModel = createOccultationModel(sourceToTargetOccultingBodies, bodies);
+            source->getRadiationSourceModel()->addSharedTargetOccultationModel(
+                    sourceToTargetOccultingBodies, sourceToTargetOccultationModel);
+        }
+    }
+    else
+    {
+        sourceToTargetOccultationModel = createOccultationModel(sourceToTargetOccultingBodies, bodies);
+    }
+
     // Create acceleration model
     if (isotropicPointRadiationSourceModel != nullptr)
     {
@@ -1346,6 +1392,7 @@ std::shared_ptr< electromagnetism::YarkovskyAcceleration > createYarkovskyAccele
 
 
 std::shared_ptr< basic_astrodynamics::CustomAccelerationModel > createCustomAccelerationModel(
+        const std::shared_ptr< Body > bodyUndergoingAcceleration,
         const std::shared_ptr< AccelerationSettings > accelerationSettings,
         const std::string& nameOfBodyUndergoingAcceleration )
 {
@@ -1357,6 +1404,13 @@ std::shared_ptr< basic_astrodynamics::CustomAccelerationModel > createCustomAcce
         throw std::runtime_error( "Error, expected custom acceleration settings when making acceleration model on " +
                                   nameOfBodyUndergoingAcceleration  );
     }
+    else if( customAccelerationSettings->stateDependentAccelerationFunction_ != nullptr )
+    {
+        return std::make_shared< CustomAccelerationModel >(
+                    customAccelerationSettings->stateDependentAccelerationFunction_,
+                    customAccelerationSettings->dualAccelerationFunction_,
+                    std::bind( &Body::getState, bodyUndergoingAcceleration ) );
+    }
     return std::make_shared< CustomAccelerationModel >( customAccelerationSettings->accelerationFunction_ );
 
 }
@@ -1926,6 +1980,7 @@ std::shared_ptr< AccelerationModel< Eigen::Vector3d > > createAccelerationModel(
         break;
     case custom_acceleration:
         accelerationModelPointer = createCustomAccelerationModel(
+                    bodyUndergoingAcceleration,
                     accelerationSettings,
                     nameOfBodyUndergoingAcceleration );
         break;
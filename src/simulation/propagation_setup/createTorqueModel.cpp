@@ -78,6 +78,9 @@ std::shared_ptr< aerodynamics::AerodynamicTorque > createAerodynamicTorqueModel(
         throw std::runtime_error( "Error when making aerodynamic torque, found flight conditions that are not atmospheric." );
     }
 
+    // Aerodynamic torque requires aerodynamic coefficients (and body orientation) to be updated
+    bodyFlightConditions->addRequiredUpdateComponent( aerodynamics::aerodynamic_coefficients_update );
+
     // Retrieve frame in which aerodynamic coefficients are defined.
     std::shared_ptr< aerodynamics::AerodynamicCoefficientInterface > aerodynamicCoefficients =
             bodyUndergoingTorque->getAerodynamicCoefficientInterface( );
@@ -0,0 +1,765 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "tudat/astro/aerodynamics/exponentialAtmosphere.h"
+#include "tudat/astro/aerodynamics/tabulatedAtmosphere.h"
+#include "tudat/astro/basic_astro/accelerationModelTypes.h"
+#include "tudat/astro/basic_astro/physicalConstants.h"
+#include "tudat/astro/basic_astro/sphericalBodyShapeModel.h"
+#include "tudat/astro/ephemerides/frameManager.h"
+#include "tudat/astro/ephemerides/simpleRotationalEphemeris.h"
+#include "tudat/astro/gravitation/sphericalHarmonicsGravityField.h"
+#include "tudat/astro/gravitation/timeDependentSphericalHarmonicsGravityField.h"
+#include "tudat/basics/parallelization.h"
+#include "tudat/io/binaryDataFile.h"
+#include "tudat/math/basic/legendrePolynomials.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+#include "tudat/simulation/propagation_setup/deviceEnsembleDynamicsSimulator.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Function to check whether device ensemble propagation runs on a CUDA device in this build
+bool isDeviceEnsemblePropagationOnCudaDevice( )
+{
+    return TUDAT_BUILD_WITH_CUDA;
+}
+
+//! Constructor
+DeviceEnsemblePropagationResults::DeviceEnsemblePropagationResults(
+        const std::vector< double >& outputEpochs,
+        const int numberOfMembers,
+        const std::vector< double >& stateData,
+        const std::vector< DeviceEnsembleMemberStatus >& memberStatus,
+        const Eigen::VectorXi& numberOfAcceptedSteps,
+        const Eigen::VectorXi& numberOfRejectedSteps ):
+    outputEpochs_( outputEpochs ), numberOfMembers_( numberOfMembers ), stateData_( stateData ),
+    memberStatus_( memberStatus ), numberOfAcceptedSteps_( numberOfAcceptedSteps ),
+    numberOfRejectedSteps_( numberOfRejectedSteps )
+{
+    if( stateData_.size( ) != 6 * outputEpochs_.size( ) * static_cast< unsigned int >( numberOfMembers_ ) ||
+            memberStatus_.size( ) != static_cast< unsigned int >( numberOfMembers_ ) ||
+            numberOfAcceptedSteps_.rows( ) != numberOfMembers_ || numberOfRejectedSteps_.rows( ) != numberOfMembers_ )
+    {
+        throw std::runtime_error( "Error when creating device ensemble propagation results, data sizes are inconsistent" );
+    }
+}
+
+//! Function to retrieve the states of all members at a single output epoch
+Eigen::MatrixXd DeviceEnsemblePropagationResults::getStatesAtOutputEpoch( const int epochIndex ) const
+{
+    if( epochIndex < 0 || epochIndex >= static_cast< int >( outputEpochs_.size( ) ) )
+    {
+        throw std::runtime_error( "Error when retrieving device ensemble states, output epoch index " +
+                                  std::to_string( epochIndex ) + " is not available" );
+    }
+
+    Eigen::MatrixXd states( numberOfMembers_, 6 );
+    for( int i = 0; i < 6; i++ )
+    {
+        states.col( i ) = Eigen::Map< const Eigen::VectorXd >(
+                    stateData_.data( ) + ( 6 * epochIndex + i ) * numberOfMembers_, numberOfMembers_ );
+    }
+    return states;
+}
+
+//! Function to retrieve the state history of a single member
+std::map< double, Eigen::VectorXd > DeviceEnsemblePropagationResults::getMemberStateHistory(
+        const int memberIndex ) const
+{
+    if( memberIndex < 0 || memberIndex >= numberOfMembers_ )
+    {
+        throw std::runtime_error( "Error when retrieving device ensemble member state history, member index " +
+                                  std::to_string( memberIndex ) + " is not available" );
+    }
+
+    std::map< double, Eigen::VectorXd > stateHistory;
+    for( unsigned int k = 0; k < outputEpochs_.size( ); k++ )
+    {
+        Eigen::VectorXd state( 6 );
+        for( int i = 0; i < 6; i++ )
+        {
+            state( i ) = stateData_[ ( 6 * k + i ) * numberOfMembers_ + memberIndex ];
+        }
+
+        // Stop at termination of member
+        if( !state.allFinite( ) )
+        {
+            break;
+        }
+        stateHistory[ outputEpochs_.at( k ) ] = state;
+    }
+    return stateHistory;
+}
+
+//! Function to check whether the propagation of all members was successful
+bool DeviceEnsemblePropagationResults::integrationCompletedSuccessfully( ) const
+{
+    return std::all_of( memberStatus_.begin( ), memberStatus_.end( ), []( const DeviceEnsembleMemberStatus status )
+    { return status == device_member_propagation_successful; } );
+}
+
+//! Function to write the states of the members to a binary columnar data file
+void DeviceEnsemblePropagationResults::writeToBinaryFile( const std::string& fileName ) const
+{
+    Eigen::MatrixXd values( outputEpochs_.size( ), 6 * numberOfMembers_ );
+    for( unsigned int k = 0; k < outputEpochs_.size( ); k++ )
+    {
+        for( int i = 0; i < 6; i++ )
+        {
+            for( int m = 0; m < numberOfMembers_; m++ )
+            {
+                values( k, 6 * m + i ) = stateData_[ ( 6 * k + i ) * numberOfMembers_ + m ];
+            }
+        }
+    }
+    input_output::writeBinaryDataFile(
+                fileName, outputEpochs_, values,
+                "Device ensemble propagation of " + std::to_string( numberOfMembers_ ) +
+                " members; column 6 * m + i contains Cartesian state entry i of member m" );
+}
+
+//! Constructor
+DeviceEnsembleDynamicsSimulator::DeviceEnsembleDynamicsSimulator(
+        const simulation_setup::SystemOfBodies& bodies,
+        const simulation_setup::SelectedAccelerationMap& accelerationSettings,
+        const std::string& propagatedBody,
+        const std::string& centralBody,
+        const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings,
+        const double initialTime,
+        const std::shared_ptr< PropagationTerminationSettings > terminationSettings,
+        const double outputTimeStep,
+        const std::shared_ptr< DeviceEnsemblePropagationSettings > deviceSettings ):
+    propagatedBody_( propagatedBody ), centralBody_( centralBody ), deviceSettings_( deviceSettings )
+{
+    using namespace basic_astrodynamics;
+
+    if( bodies.count( propagatedBody ) == 0 || bodies.count( centralBody ) == 0 )
+    {
+        throw std::runtime_error( "Error when creating device ensemble propagation, propagated body " + propagatedBody +
+                                  " or central body " + centralBody + " not found" );
+    }
+
+    // Check termination settings, and set output epochs
+    std::shared_ptr< PropagationTimeTerminationSettings > timeTerminationSettings =
+            std::dynamic_pointer_cast< PropagationTimeTerminationSettings >( terminationSettings );
+    if( timeTerminationSettings == nullptr )
+    {
+        throw std::runtime_error( "Error when creating device ensemble propagation, only time termination settings are "
+                                  "supported" );
+    }
+    const double finalTime = timeTerminationSettings->terminationTime_;
+    if( !( outputTimeStep > 0.0 ) || finalTime == initialTime )
+    {
+        throw std::runtime_error( "Error when creating device ensemble propagation, output time step must be positive, "
+                                  "and final time must differ from initial time" );
+    }
+    const double propagationDirection = finalTime > initialTime ? 1.0 : -1.0;
+    const int numberOfOutputSteps = static_cast< int >( std::floor( std::fabs( finalTime - initialTime ) / outputTimeStep ) );
+    for( int i = 0; i <= numberOfOutputSteps; i++ )
+    {
+        outputEpochs_.push_back( initialTime + propagationDirection * static_cast< double >( i ) * outputTimeStep );
+    }
+    if( outputEpochs_.back( ) != finalTime )
+    {
+        outputEpochs_.push_back( finalTime );
+    }
+
+    // Retrieve index of tabulated body, adding it to the list if needed
+    auto getTabulatedBodyIndex = [ & ]( const std::string& bodyName )
+    {
+        auto bodyIterator = std::find( tabulatedBodies_.begin( ), tabulatedBodies_.end( ), bodyName );
+        if( bodyIterator != tabulatedBodies_.end( ) )
+        {
+            return static_cast< int >( bodyIterator - tabulatedBodies_.begin( ) );
+        }
+        tabulatedBodies_.push_back( bodyName );
+        tabulatedBodyGravitationalParameters_.push_back( 0.0 );
+        return static_cast< int >( tabulatedBodies_.size( ) ) - 1;
+    };
+
+    // Convert acceleration settings
+    for( auto undergoingIterator : accelerationSettings )
+    {
+        if( undergoingIterator.first != propagatedBody )
+        {
+            throw std::runtime_error( "Error when creating device ensemble propagation, accelerations on " +
+                                      undergoingIterator.first + " provided, only the propagated body (" +
+                                      propagatedBody + ") is supported" );
+        }
+
+        bool isCentralBodyGravitySet = false;
+        for( auto exertingIterator : undergoingIterator.second )
+        {
+            const std::string& exertingBody = exertingIterator.first;
+            if( bodies.count( exertingBody ) == 0 )
+            {
+                throw std::runtime_error( "Error when creating device ensemble propagation, body " + exertingBody +
+                                          " not found" );
+            }
+
+            for( auto settings : exertingIterator.second )
+            {
+                const AvailableAcceleration accelerationType = settings->accelerationType_;
+                if( ( accelerationType == point_mass_gravity || accelerationType == spherical_harmonic_gravity ) &&
+                        exertingBody == centralBody )
+                {
+                    if( isCentralBodyGravitySet )
+                    {
+                        throw std::runtime_error( "Error when creating device ensemble propagation, multiple gravitational "
+                                                  "accelerations of central body " + centralBody + " provided" );
+                    }
+                    setCentralBodyGravity( bodies, settings );
+                    isCentralBodyGravitySet = true;
+                    if( model_.maximumZonalDegree > 0 )
+                    {
+                        setCentralBodyRotation( bodies, initialTime, "zonal gravity field" );
+                    }
+                }
+                else if( accelerationType == point_mass_gravity )
+                {
+                    if( bodies.at( exertingBody )->getGravityFieldModel( ) == nullptr )
+                    {
+                        throw std::runtime_error( "Error when creating device ensemble propagation, body " + exertingBody +
+                                                  " has no gravity field" );
+                    }
+                    const int bodyIndex = getTabulatedBodyIndex( exertingBody );
+                    if( tabulatedBodyGravitationalParameters_.at( bodyIndex ) != 0.0 )
+                    {
+                        throw std::runtime_error( "Error when creating device ensemble propagation, multiple gravitational "
+                                                  "accelerations of " + exertingBody + " provided" );
+                    }
+                    tabulatedBodyGravitationalParameters_.at( bodyIndex ) =
+                            bodies.at( exertingBody )->getGravityFieldModel( )->getGravitationalParameter( );
+                }
+                else if( accelerationType == aerodynamic && exertingBody == centralBody )
+                {
+                    if( model_.atmosphereModelType != no_device_atmosphere )
+                    {
+                        throw std::runtime_error( "Error when creating device ensemble propagation, multiple aerodynamic "
+                                                  "accelerations provided" );
+                    }
+                    setAerodynamicModel( bodies, initialTime );
+                    setCentralBodyRotation( bodies, initialTime, "aerodynamic acceleration" );
+                }
+                else if( accelerationType == cannon_ball_radiation_pressure )
+                {
+                    if( exertingBody == centralBody )
+                    {
+                        throw std::runtime_error( "Error when creating device ensemble propagation, radiation pressure "
+                                                  "source may not be the central body" );
+                    }
+                    else if( model_.radiationSourceIndex >= 0 )
+                    {
+                        throw std::runtime_error( "Error when creating device ensemble propagation, only a single "
+                                                  "radiation pressure source is supported" );
+                    }
+                    setRadiationPressureModel( bodies, exertingBody, initialTime );
+                    model_.radiationSourceIndex = getTabulatedBodyIndex( exertingBody );
+                }
+                else
+                {
+                    throw std::runtime_error( "Error when creating device ensemble propagation, acceleration type " +
+                                              getAccelerationModelName( accelerationType ) + " exerted by " +
+                                              exertingBody + " is not supported" );
+                }
+            }
+        }
+    }
+
+    model_.useIndirectThirdBodyTerms = !ephemerides::isFrameInertial( centralBody );
+    tabulateBodyStates( bodies );
+
+    // Set integrator, with the termination of members after the maximum number of steps
+    setIntegrator( integratorSettings );
+    if( model_.initialStepSize * propagationDirection <= 0.0 )
+    {
+        throw std::runtime_error( "Error when creating device ensemble propagation, initial step size must be in the "
+                                  "direction of the final time" );
+    }
+    model_.maximumNumberOfSteps = deviceSettings_->maximumNumberOfSteps_;
+}
+
+//! Function to propagate all members of the ensemble on the device
+std::shared_ptr< DeviceEnsemblePropagationResults > DeviceEnsembleDynamicsSimulator::propagateEnsemble(
+        const Eigen::MatrixXd& memberInitialStates,
+        const Eigen::VectorXd& dragScalingFactors,
+        const Eigen::VectorXd& radiationPressureScalingFactors ) const
+{
+    const int numberOfMembers = memberInitialStates.rows( );
+    if( memberInitialStates.cols( ) != 6 )
+    {
+        throw std::runtime_error( "Error when propagating ensemble on device, member state size (" +
+                                  std::to_string( memberInitialStates.cols( ) ) + ") must be 6" );
+    }
+    if( ( dragScalingFactors.rows( ) != 0 && dragScalingFactors.rows( ) != numberOfMembers ) ||
+            ( radiationPressureScalingFactors.rows( ) != 0 && radiationPressureScalingFactors.rows( ) != numberOfMembers ) )
+    {
+        throw std::runtime_error( "Error when propagating ensemble on device, number of scaling factors is inconsistent "
+                                  "with number of members (" + std::to_string( numberOfMembers ) + ")" );
+    }
+
+    const int numberOfOutputEpochs = outputEpochs_.size( );
+    std::vector< double > stateData( 6 * numberOfOutputEpochs * numberOfMembers );
+    std::vector< DeviceEnsembleMemberStatus > memberStatus( numberOfMembers );
+    Eigen::VectorXi numberOfAcceptedSteps = Eigen::VectorXi::Zero( numberOfMembers );
+    Eigen::VectorXi numberOfRejectedSteps = Eigen::VectorXi::Zero( numberOfMembers );
+
+    // Propagate members in batches, limiting the memory used on the device
+    const int batchSize = std::max( 1, std::min( deviceSettings_->maximumMembersPerDeviceBatch_, numberOfMembers ) );
+    std::vector< double > batchInitialStates( 6 * batchSize );
+    std::vector< double > batchDragScalingFactors( batchSize ), batchRadiationPressureScalingFactors( batchSize );
+    std::vector< double > batchOutputStates( 6 * numberOfOutputEpochs * batchSize );
+    std::vector< int > batchMemberStatus( batchSize );
+    for( int batchStart = 0; batchStart < numberOfMembers; batchStart += batchSize )
+    {
+        const int currentBatchSize = std::min( batchSize, numberOfMembers - batchStart );
+        for( int m = 0; m < currentBatchSize; m++ )
+        {
+            for( int i = 0; i < 6; i++ )
+            {
+                batchInitialStates[ 6 * m + i ] = memberInitialStates( batchStart + m, i );
+            }
+            batchDragScalingFactors[ m ] = dragScalingFactors.rows( ) == 0 ? 1.0 : dragScalingFactors( batchStart + m );
+            batchRadiationPressureScalingFactors[ m ] = radiationPressureScalingFactors.rows( ) == 0 ?
+                        1.0 : radiationPressureScalingFactors( batchStart + m );
+        }
+
+#if TUDAT_BUILD_WITH_CUDA
+        propagateEnsembleOnDevice(
+                    model_, tabulatedBodyGravitationalParameters_.data( ), tabulatedBodyStates_.data( ),
+                    tabulatedLogarithmicDensities_.data( ), rungeKuttaCoefficients_.data( ), outputEpochs_.data( ),
+                    numberOfOutputEpochs, batchInitialStates.data( ), batchDragScalingFactors.data( ),
+                    batchRadiationPressureScalingFactors.data( ), currentBatchSize, batchOutputStates.data( ),
+                    batchMemberStatus.data( ), numberOfAcceptedSteps.data( ) + batchStart,
+                    numberOfRejectedSteps.data( ) + batchStart );
+#else
+        // Propagate members of batch on the host, distributed over one chunk per thread
+        const int numberOfThreads = utilities::getNumberOfAvailableThreads( );
+        const int numberOfChunks = std::max( 1, std::min( currentBatchSize, numberOfThreads ) );
+        utilities::executeParallelTasks(
+                    numberOfChunks, [ & ]( const int chunkIndex )
+        {
+            const int firstMember = static_cast< long long >( chunkIndex ) * currentBatchSize / numberOfChunks;
+            const int lastMember = static_cast< long long >( chunkIndex + 1 ) * currentBatchSize / numberOfChunks;
+            for( int m = firstMember; m < lastMember; m++ )
+            {
+                propagateEnsembleMember(
+                            m, model_, tabulatedBodyGravitationalParameters_.data( ), tabulatedBodyStates_.data( ),
+                            tabulatedLogarithmicDensities_.data( ), rungeKuttaCoefficients_.data( ),
+                            outputEpochs_.data( ), numberOfOutputEpochs, batchInitialStates.data( ),
+                            batchDragScalingFactors.data( ), batchRadiationPressureScalingFactors.data( ),
+                            currentBatchSize, batchOutputStates.data( ), batchMemberStatus.data( ),
+                            numberOfAcceptedSteps.data( ) + batchStart, numberOfRejectedSteps.data( ) + batchStart );
+            }
+        }, numberOfThreads );
+#endif
+
+        // Copy batch results to columnar layout of full ensemble
+        for( int row = 0; row < 6 * numberOfOutputEpochs; row++ )
+        {
+            std::copy( batchOutputStates.begin( ) + row * currentBatchSize,
+                       batchOutputStates.begin( ) + ( row + 1 ) * currentBatchSize,
+                       stateData.begin( ) + row * numberOfMembers + batchStart );
+        }
+        for( int m = 0; m < currentBatchSize; m++ )
+        {
+            memberStatus[ batchStart + m ] = static_cast< DeviceEnsembleMemberStatus >( batchMemberStatus[ m ] );
+        }
+    }
+
+    return std::make_shared< DeviceEnsemblePropagationResults >(
+                outputEpochs_, numberOfMembers, stateData, memberStatus, numberOfAcceptedSteps, numberOfRejectedSteps );
+}
+
+//! Function to set the gravity field model of the central body in the device representation
+void DeviceEnsembleDynamicsSimulator::setCentralBodyGravity(
+        const simulation_setup::SystemOfBodies& bodies,
+        const std::shared_ptr< simulation_setup::AccelerationSettings > accelerationSettings )
+{
+    std::shared_ptr< gravitation::GravityFieldModel > gravityField = bodies.at( centralBody_ )->getGravityFieldModel( );
+    if( gravityField == nullptr )
+    {
+        throw std::runtime_error( "Error when creating device ensemble propagation, central body " + centralBody_ +
+                                  " has no gravity field" );
+    }
+    model_.centralBodyGravitationalParameter = gravityField->getGravitationalParameter( );
+
+    if( accelerationSettings->accelerationType_ == basic_astrodynamics::spherical_harmonic_gravity )
+    {
+        std::shared_ptr< simulation_setup::SphericalHarmonicAccelerationSettings > sphericalHarmonicSettings =
+                std::dynamic_pointer_cast< simulation_setup::SphericalHarmonicAccelerationSettings >( accelerationSettings );
+        std::shared_ptr< gravitation::SphericalHarmonicsGravityField > sphericalHarmonicField =
+                std::dynamic_pointer_cast< gravitation::SphericalHarmonicsGravityField >( gravityField );
+        if( sphericalHarmonicSettings == nullptr || sphericalHarmonicField == nullptr )
+        {
+            throw std::runtime_error( "Error when creating device ensemble propagation, spherical harmonic settings or "
+                                      "gravity field of " + centralBody_ + " are inconsistent" );
+        }
+        else if( std::dynamic_pointer_cast< gravitation::TimeDependentSphericalHarmonicsGravityField >(
+                     sphericalHarmonicField ) != nullptr )
+        {
+            throw std::runtime_error( "Error when creating device ensemble propagation, time-dependent gravity field of " +
+                                      centralBody_ + " is not supported" );
+        }
+        else if( sphericalHarmonicSettings->maximumOrder_ != 0 ||
+                 sphericalHarmonicSettings->maximumDegree_ > maximumDeviceZonalDegree )
+        {
+            throw std::runtime_error( "Error when creating device ensemble propagation, only zonal spherical harmonic "
+                                      "gravity (order 0, degree up to " + std::to_string( maximumDeviceZonalDegree ) +
+                                      ") is supported, degree " + std::to_string( sphericalHarmonicSettings->maximumDegree_ ) +
+                                      " and order " + std::to_string( sphericalHarmonicSettings->maximumOrder_ ) +
+                                      " requested" );
+        }
+
+        Eigen::MatrixXd cosineCoefficients = sphericalHarmonicField->getCosineCoefficients( );
+        model_.maximumZonalDegree = std::min( sphericalHarmonicSettings->maximumDegree_,
+                                              static_cast< int >( cosineCoefficients.rows( ) ) - 1 );
+        model_.centralBodyReferenceRadius = sphericalHarmonicField->getReferenceRadius( );
+        for( int degree = 1; degree <= model_.maximumZonalDegree; degree++ )
+        {
+            model_.zonalCoefficients[ degree ] = cosineCoefficients( degree, 0 ) * (
+                        sphericalHarmonicField->areCoefficientsGeodesyNormalized( ) ?
+                            basic_mathematics::calculateLegendreGeodesyNormalizationFactor( degree, 0 ) : 1.0 );
+        }
+    }
+}
+
+//! Function to set the atmosphere and aerodynamic model in the device representation
+void DeviceEnsembleDynamicsSimulator::setAerodynamicModel(
+        const simulation_setup::SystemOfBodies& bodies, const double initialTime )
+{
+    std::shared_ptr< simulation_setup::Body > centralBody = bodies.at( centralBody_ );
+    std::shared_ptr< simulation_setup::Body > propagatedBody = bodies.at( propagatedBody_ );
+
+    // Retrieve shape and atmosphere of central body
+    std::shared_ptr< basic_astrodynamics::SphericalBodyShapeModel > shapeModel =
+            std::dynamic_pointer_cast< basic_astrodynamics::SphericalBodyShapeModel >( centralBody->getShapeModel( ) );
+    if( shapeModel == nullptr )
+    {
+        throw std::runtime_error( "Error when creating device ensemble propagation, aerodynamic acceleration requires a "
+                                  "spherical shape model of " + centralBody_ );
+    }
+    model_.shapeRadius = shapeModel->getAverageRadius( );
+
+    std::shared_ptr< aerodynamics::AtmosphereModel > atmosphereModel = centralBody->getAtmosphereModel( );
+    if( atmosphereModel == nullptr )
+    {
+        throw std::runtime_error( "Error when creating device ensemble propagation, central body " + centralBody_ +
+                                  " has no atmosphere" );
+    }
+    else if( atmosphereModel->getWindModel( ) != nullptr )
+    {
+        throw std::runtime_error( "Error when creating device ensemble propagation, wind models are not supported" );
+    }
+
+    if( std::shared_ptr< aerodynamics::ExponentialAtmosphere > exponentialAtmosphere =
+            std::dynamic_pointer_cast< aerodynamics::ExponentialAtmosphere >( atmosphereModel ) )
+    {
+        model_.atmosphereModelType = exponential_device_atmosphere;
+        model_.densityAtZeroAltitude = exponentialAtmosphere->getDensityAtZeroAltitude( );
+        model_.scaleHeight = exponentialAtmosphere->getScaleHeight( );
+    }
+    else if( std::shared_ptr< aerodynamics::TabulatedAtmosphere > tabulatedAtmosphere =
+             std::dynamic_pointer_cast< aerodynamics::TabulatedAtmosphere >( atmosphereModel ) )
+    {
+        if( tabulatedAtmosphere->getIndependentVariables( ) !=
+                std::vector< aerodynamics::AtmosphereIndependentVariables >( { aerodynamics::altitude_dependent_atmosphere } ) )
+        {
+            throw std::runtime_error( "Error when creating device ensemble propagation, only tabulated atmospheres that "
+                                      "depend on altitude only are supported" );
+        }
+
+        // Resample density on uniform altitude grid, covering the table
+        const std::vector< double > altitudes = tabulatedAtmosphere->getIndependentVariablesData( ).at( 0 );
+        const double altitudeRange = altitudes.back( ) - altitudes.front( );
+        const int numberOfIntervals = std::max(
+                    1, static_cast< int >( std::ceil( altitudeRange / deviceSettings_->atmosphereTabulationAltitudeStep_ ) ) );
+        model_.atmosphereModelType = tabulated_device_atmosphere;
+        model_.tabulatedAtmosphereMinimumAltitude = altitudes.front( );
+        model_.tabulatedAtmosphereAltitudeStep = altitudeRange / static_cast< double >( numberOfIntervals );
+        model_.numberOfTabulatedAtmosphereAltitudes = numberOfIntervals + 1;
+        tabulatedLogarithmicDensities_.resize( numberOfIntervals + 1 );
+        for( int i = 0; i <= numberOfIntervals; i++ )
+        {
+            const double density = tabulatedAtmosphere->getDensity(
+                        model_.tabulatedAtmosphereMinimumAltitude +
+                        static_cast< double >( i ) * model_.tabulatedAtmosphereAltitudeStep, 0.0, 0.0, initialTime );
+            if( !( density > 0.0 ) )
+            {
+                throw std::runtime_error( "Error when creating device ensemble propagation, tabulated atmospheric density "
+                                          "must be positive" );
+            }
+            tabulatedLogarithmicDensities_[ i ] = std::log( density );
+        }
+    }
+    else
+    {
+        throw std::runtime_error( "Error when creating device ensemble propagation, only exponential atmospheres and "
+                                  "tabulated atmospheres are supported" );
+    }
+
+    // Retrieve constant drag coefficient
+    std::shared_ptr< aerodynamics::AerodynamicCoefficientInterface > coefficientInterface =
+            propagatedBody->getAerodynamicCoefficientInterface( );
+    if( coefficientInterface == nullptr )
+    {
+        throw std::runtime_error( "Error when creating device ensemble propagation, body " + propagatedBody_ +
+                                  " has no aerodynamic coefficients" );
+    }
+    else if( coefficientInterface->getNumberOfControlSurfaces( ) > 0 ||
+             coefficientInterface->getNumberOfIndependentVariables( ) > 0 )
+    {
+        throw std::runtime_error( "Error when creating device ensemble propagation, only constant aerodynamic "
+                                  "coefficients without control surfaces are supported" );
+    }
+    else if( coefficientInterface->getForceCoefficientsFrame( ) != aerodynamics::negative_aerodynamic_frame_coefficients &&
+             coefficientInterface->getForceCoefficientsFrame( ) != aerodynamics::positive_aerodynamic_frame_coefficients )
+    {
+        throw std::runtime_error( "Error when creating device ensemble propagation, aerodynamic coefficients must be "
+                                  "defined in the aerodynamic frame" );
+    }
+
+    coefficientInterface->updateCurrentCoefficients( std::vector< double >( ), initialTime );
+    const Eigen::Vector3d forceCoefficients = coefficientInterface->getCurrentForceCoefficients( );
+    if( forceCoefficients( 1 ) != 0.0 || forceCoefficients( 2 ) != 0.0 )
+    {
+        throw std::runtime_error( "Error when creating device ensemble propagation, only drag coefficients (no side force "
+                                  "or lift) are supported" );
+    }
+    const double dragCoefficient =
+            ( coefficientInterface->getForceCoefficientsFrame( ) == aerodynamics::negative_aerodynamic_frame_coefficients ) ?
+                forceCoefficients( 0 ) : -forceCoefficients( 0 );
+    model_.ballisticDragFactor = dragCoefficient * coefficientInterface->getReferenceArea( ) /
+            propagatedBody->getBodyMass( );
+}
+
+//! Function to set the cannonball radiation pressure model in the device representation
+void DeviceEnsembleDynamicsSimulator::setRadiationPressureModel(
+        const simulation_setup::SystemOfBodies& bodies, const std::string& sourceBody, const double initialTime )
+{
+    std::shared_ptr< simulation_setup::Body > propagatedBody = bodies.at( propagatedBody_ );
+    if( propagatedBody->getRadiationPressureInterfaces( ).count( sourceBody ) == 0 )
+    {
+        throw std::runtime_error( "Error when creating device ensemble propagation, no radiation pressure interface found "
+                                  "in " + propagatedBody_ + " for body " + sourceBody );
+    }
+    std::shared_ptr< electromagnetism::RadiationPressureInterface > radiationPressureInterface =
+            propagatedBody->getRadiationPressureInterfaces( ).at( sourceBody );
+
+    if( radiationPressureInterface->getOccultingBodyPositions( ).size( ) > 0 )
+    {
+        throw std::runtime_error( "Error when creating device ensemble propagation, radiation pressure with occulting "
+                                  "bodies is not supported" );
+    }
+    const double radiationPressureCoefficient = radiationPressureInterface->getRadiationPressureCoefficient( );
+    if( !( radiationPressureCoefficient == radiationPressureCoefficient ) )
+    {
+        throw std::runtime_error( "Error when creating device ensemble propagation, time-dependent radiation pressure "
+                                  "coefficients are not supported" );
+    }
+
+    model_.radiationPressureAtUnitDistance = radiationPressureInterface->getSourcePowerFunction( )( ) /
+            ( 4.0 * mathematical_constants::PI * physical_constants::SPEED_OF_LIGHT );
+    model_.radiationPressureFactor = radiationPressureCoefficient * radiationPressureInterface->getArea( ) /
+            propagatedBody->getBodyMass( );
+}
+
+//! Function to set the pole direction and rotation rate of the central body in the device representation
+void DeviceEnsembleDynamicsSimulator::setCentralBodyRotation(
+        const simulation_setup::SystemOfBodies& bodies, const double initialTime, const std::string& modelName )
+{
+    std::shared_ptr< ephemerides::SimpleRotationalEphemeris > rotationModel =
+            std::dynamic_pointer_cast< ephemerides::SimpleRotationalEphemeris >(
+                bodies.at( centralBody_ )->getRotationalEphemeris( ) );
+    if( rotationModel == nullptr )
+    {
+        throw std::runtime_error( "Error when creating device ensemble propagation, " + modelName +
+                                  " requires a simple rotation model of " + centralBody_ );
+    }
+    else if( rotationModel->getBaseFrameOrientation( ) != bodies.getFrameOrientation( ) )
+    {
+        throw std::runtime_error( "Error when creating device ensemble propagation, base frame of rotation model of " +
+                                  centralBody_ + " differs from global frame orientation" );
+    }
+
+    const Eigen::Vector3d poleDirection = rotationModel->getRotationToBaseFrame( initialTime ) * Eigen::Vector3d::UnitZ( );
+    for( int i = 0; i < 3; i++ )
+    {
+        model_.poleDirection[ i ] = poleDirection( i );
+    }
+    model_.rotationRate = rotationModel->getRotationRate( );
+}
+
+//! Function to set the integrator in the device representation
+void DeviceEnsembleDynamicsSimulator::setIntegrator(
+        const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings )
+{
+    using namespace numerical_integrators;
+
+    RungeKuttaCoefficients coefficients;
+    Eigen::VectorXd lowerOrderBCoefficients, higherOrderBCoefficients;
+    model_.initialStepSize = integratorSettings->initialTimeStep_;
+    if( integratorSettings->integratorType_ == euler || integratorSettings->integratorType_ == rungeKutta4 )
+    {
+        coefficients = RungeKuttaCoefficients::get(
+                    integratorSettings->integratorType_ == euler ? forwardEuler : rungeKutta4Classic );
+        model_.useVariableStepSize = false;
+    }
+    else if( std::shared_ptr< RungeKuttaFixedStepSizeSettings< double > > fixedStepSettings =
+             std::dynamic_pointer_cast< RungeKuttaFixedStepSizeSettings< double > >( integratorSettings ) )
+    {
+        coefficients = RungeKuttaCoefficients::get( fixedStepSettings->coefficientSet_ );
+        model_.useVariableStepSize = false;
+        if( !coefficients.isFixedStepSize &&
+                fixedStepSettings->orderToUse_ == RungeKuttaCoefficients::OrderEstimateToIntegrate::higher )
+        {
+            lowerOrderBCoefficients = coefficients.bCoefficients.row( 1 ).transpose( );
+        }
+    }
+    else if( std::shared_ptr< MultiStageVariableStepSizeSettings< double > > variableStepSettings =
+             std::dynamic_pointer_cast< MultiStageVariableStepSizeSettings< double > >( integratorSettings ) )
+    {
+        std::shared_ptr< PerElementIntegratorStepSizeControlSettings< double > > controlSettings =
+                std::dynamic_pointer_cast< PerElementIntegratorStepSizeControlSettings< double > >(
+                    variableStepSettings->stepSizeControlSettings_ );
+        if( controlSettings == nullptr || controlSettings->useProportionalIntegralControl_ )
+        {
+            throw std::runtime_error( "Error when creating device ensemble propagation, only per-element step-size control "
+                                      "with scalar tolerances (without proportional-integral control) is supported" );
+        }
+        coefficients = RungeKuttaCoefficients::get( variableStepSettings->coefficientSet_ );
+        model_.useVariableStepSize = true;
+        model_.relativeErrorTolerance = controlSettings->relativeErrorTolerance_;
+        model_.absoluteErrorTolerance = controlSettings->absoluteErrorTolerance_;
+        model_.safetyFactorForNextStepSize = controlSettings->safetyFactorForNextStepSize_;
+        model_.minimumFactorDecreaseForNextStepSize = controlSettings->minimumFactorDecreaseForNextStepSize_;
+        model_.maximumFactorIncreaseForNextStepSize = controlSettings->maximumFactorDecreaseForNextStepSize_;
+        model_.minimumStepSize = std::fabs( variableStepSettings->stepSizeAcceptanceSettings_->minimumStep_ );
+        model_.maximumStepSize = std::fabs( variableStepSettings->stepSizeAcceptanceSettings_->maximumStep_ );
+        model_.terminateIfMinimumStepExceeded =
+                variableStepSettings->stepSizeAcceptanceSettings_->minimumIntegrationTimeStepHandling_ ==
+                throw_exception_below_minimum;
+    }
+    else if( std::shared_ptr< RungeKuttaVariableStepSizeSettingsScalarTolerances< double > > variableStepSettings =
+             std::dynamic_pointer_cast< RungeKuttaVariableStepSizeSettingsScalarTolerances< double > >( integratorSettings ) )
+    {
+        coefficients = RungeKuttaCoefficients::get( variableStepSettings->coefficientSet_ );
+        model_.useVariableStepSize = true;
+        model_.relativeErrorTolerance = variableStepSettings->relativeErrorTolerance_;
+        model_.absoluteErrorTolerance = variableStepSettings->absoluteErrorTolerance_;
+        model_.safetyFactorForNextStepSize = variableStepSettings->safetyFactorForNextStepSize_;
+        model_.minimumFactorDecreaseForNextStepSize = variableStepSettings->minimumFactorDecreaseForNextStepSize_;
+        model_.maximumFactorIncreaseForNextStepSize = variableStepSettings->maximumFactorIncreaseForNextStepSize_;
+        model_.minimumStepSize = std::fabs( variableStepSettings->minimumStepSize_ );
+        model_.maximumStepSize = std::fabs( variableStepSettings->maximumStepSize_ );
+        model_.terminateIfMinimumStepExceeded = variableStepSettings->exceptionIfMinimumStepExceeded_;
+    }
+    else
+    {
+        throw std::runtime_error( "Error when creating device ensemble propagation, only fixed step size Runge-Kutta "
+                                  "integrators and variable step size Runge-Kutta integrators with scalar tolerances are "
+                                  "supported" );
+    }
+
+    const int numberOfStages = coefficients.cCoefficients.rows( );
+    if( model_.useVariableStepSize && coefficients.isFixedStepSize )
+    {
+        throw std::runtime_error( "Error when creating device ensemble propagation, fixed step coefficients are used "
+                                  "with variable step size integrator (" + coefficients.name + ")" );
+    }
+    else if( numberOfStages > maximumNumberOfDeviceRungeKuttaStages )
+    {
+        throw std::runtime_error( "Error when creating device ensemble propagation, number of Runge-Kutta stages (" +
+                                  std::to_string( numberOfStages ) + ") exceeds maximum (" +
+                                  std::to_string( maximumNumberOfDeviceRungeKuttaStages ) + ")" );
+    }
+    model_.numberOfStages = numberOfStages;
+    model_.lowerOrder = coefficients.lowerOrder;
+    model_.integrateHigherOrderEstimate =
+            ( coefficients.orderEstimateToIntegrate == RungeKuttaCoefficients::higher );
+
+    // Pack Butcher tableau (a-coefficients may be stored without the final, zero, column)
+    if( lowerOrderBCoefficients.rows( ) == 0 )
+    {
+        lowerOrderBCoefficients = coefficients.bCoefficients.row( 0 ).transpose( );
+    }
+    higherOrderBCoefficients = model_.useVariableStepSize ?
+                Eigen::VectorXd( coefficients.bCoefficients.row( 1 ).transpose( ) ) :
+                Eigen::VectorXd::Zero( numberOfStages );
+    rungeKuttaCoefficients_.clear( );
+    for( int stage = 0; stage < numberOfStages; stage++ )
+    {
+        for( int column = 0; column < numberOfStages; column++ )
+        {
+            rungeKuttaCoefficients_.push_back(
+                        column < coefficients.aCoefficients.cols( ) ? coefficients.aCoefficients( stage, column ) : 0.0 );
+        }
+    }
+    for( int stage = 0; stage < numberOfStages; stage++ )
+    {
+        rungeKuttaCoefficients_.push_back( coefficients.cCoefficients( stage ) );
+    }
+    for( int stage = 0; stage < numberOfStages; stage++ )
+    {
+        rungeKuttaCoefficients_.push_back( lowerOrderBCoefficients( stage ) );
+    }
+    for( int stage = 0; stage < numberOfStages; stage++ )
+    {
+        rungeKuttaCoefficients_.push_back( higherOrderBCoefficients( stage ) );
+    }
+}
+
+//! Function to tabulate the states of the perturbing bodies w.r.t. the central body
+void DeviceEnsembleDynamicsSimulator::tabulateBodyStates( const simulation_setup::SystemOfBodies& bodies )
+{
+    model_.numberOfTabulatedBodies = tabulatedBodies_.size( );
+    if( model_.numberOfTabulatedBodies == 0 )
+    {
+        return;
+    }
+
+    // Tabulate over the propagation interval, with a margin of two steps on both sides
+    const double timeStep = deviceSettings_->ephemerisTabulationTimeStep_;
+    const double startTime = std::min( outputEpochs_.front( ), outputEpochs_.back( ) ) - 2.0 * timeStep;
+    const double endTime = std::max( outputEpochs_.front( ), outputEpochs_.back( ) ) + 2.0 * timeStep;
+    model_.tabulationStartTime = startTime;
+    model_.tabulationTimeStep = timeStep;
+    model_.numberOfTabulationEpochs = static_cast< int >( std::ceil( ( endTime - startTime ) / timeStep ) ) + 1;
+
+    tabulatedBodyStates_.resize( 6 * model_.numberOfTabulatedBodies * model_.numberOfTabulationEpochs );
+    for( int i = 0; i < model_.numberOfTabulationEpochs; i++ )
+    {
+        const double currentTime = startTime + static_cast< double >( i ) * timeStep;
+        const Eigen::Vector6d centralBodyState =
+                bodies.at( centralBody_ )->getStateInBaseFrameFromEphemeris< double, double >( currentTime );
+        for( int body = 0; body < model_.numberOfTabulatedBodies; body++ )
+        {
+            const Eigen::Vector6d relativeState = bodies.at( tabulatedBodies_.at( body ) )->
+                    getStateInBaseFrameFromEphemeris< double, double >( currentTime ) - centralBodyState;
+            for( int j = 0; j < 6; j++ )
+            {
+                tabulatedBodyStates_[ 6 * ( body * model_.numberOfTabulationEpochs + i ) + j ] = relativeState( j );
+            }
+        }
+    }
+}
+
+} // namespace propagators
+
+} // namespace tudat
@@ -0,0 +1,173 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <stdexcept>
+#include <string>
+
+#include <cuda_runtime.h>
+
+#include "tudat/simulation/propagation_setup/ensembleDevicePropagation.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Function to throw an exception if a CUDA runtime call failed
+void checkCudaError( const cudaError_t error, const std::string& operation )
+{
+    if( error != cudaSuccess )
+    {
+        throw std::runtime_error( "Error when propagating ensemble on CUDA device, " + operation +
+                                  " failed: " + std::string( cudaGetErrorString( error ) ) );
+    }
+}
+
+//! Array in device memory, released on destruction
+template< typename ScalarType >
+class DeviceArray
+{
+public:
+
+    //! Constructor, allocates the array (and copies the host data to it, if provided)
+    DeviceArray( const int size, const ScalarType* hostData = nullptr ):
+        size_( size > 0 ? size : 1 ), data_( nullptr )
+    {
+        checkCudaError( cudaMalloc( &data_, sizeof( ScalarType ) * size_ ), "memory allocation" );
+        if( hostData != nullptr && size > 0 )
+        {
+            checkCudaError( cudaMemcpy( data_, hostData, sizeof( ScalarType ) * size, cudaMemcpyHostToDevice ),
+                            "copy to device" );
+        }
+    }
+
+    //! Destructor, releases the array
+    ~DeviceArray( )
+    {
+        cudaFree( data_ );
+    }
+
+    DeviceArray( const DeviceArray& ) = delete;
+
+    DeviceArray& operator=( const DeviceArray& ) = delete;
+
+    //! Function to copy the contents of the array to host memory
+    void copyToHost( ScalarType* hostData, const int size ) const
+    {
+        checkCudaError( cudaMemcpy( hostData, data_, sizeof( ScalarType ) * size, cudaMemcpyDeviceToHost ),
+                        "copy to host" );
+    }
+
+    //! Function to retrieve the device pointer to the array
+    ScalarType* data( ) const
+    {
+        return data_;
+    }
+
+private:
+
+    //! Number of allocated entries in the array
+    int size_;
+
+    //! Device pointer to the array
+    ScalarType* data_;
+};
+
+//! Kernel propagating a single member per thread, with input and output as in propagateEnsembleOnDevice
+__global__ void propagateEnsembleKernel(
+        const DeviceEnsembleDynamicsModel model,
+        const double* tabulatedBodyGravitationalParameters,
+        const double* tabulatedBodyStates,
+        const double* tabulatedLogarithmicDensities,
+        const double* rungeKuttaCoefficients,
+        const double* outputEpochs,
+        const int numberOfOutputEpochs,
+        const double* initialStates,
+        const double* dragScalingFactors,
+        const double* radiationPressureScalingFactors,
+        const int numberOfMembers,
+        double* outputStates,
+        int* memberStatus,
+        int* numberOfAcceptedSteps,
+        int* numberOfRejectedSteps )
+{
+    const int member = blockIdx.x * blockDim.x + threadIdx.x;
+    if( member < numberOfMembers )
+    {
+        propagateEnsembleMember(
+                    member, model, tabulatedBodyGravitationalParameters, tabulatedBodyStates,
+                    tabulatedLogarithmicDensities, rungeKuttaCoefficients, outputEpochs, numberOfOutputEpochs,
+                    initialStates, dragScalingFactors, radiationPressureScalingFactors, numberOfMembers, outputStates,
+                    memberStatus, numberOfAcceptedSteps, numberOfRejectedSteps );
+    }
+}
+
+//! Function to propagate an ensemble of translational states with a simplified dynamical model on a CUDA device
+void propagateEnsembleOnDevice(
+        const DeviceEnsembleDynamicsModel& model,
+        const double* tabulatedBodyGravitationalParameters,
+        const double* tabulatedBodyStates,
+        const double* tabulatedLogarithmicDensities,
+        const double* rungeKuttaCoefficients,
+        const double* outputEpochs,
+        const int numberOfOutputEpochs,
+        const double* initialStates,
+        const double* dragScalingFactors,
+        const double* radiationPressureScalingFactors,
+        const int numberOfMembers,
+        double* outputStates,
+        int* memberStatus,
+        int* numberOfAcceptedSteps,
+        int* numberOfRejectedSteps )
+{
+    if( numberOfMembers == 0 )
+    {
+        return;
+    }
+
+    DeviceArray< double > deviceGravitationalParameters(
+                model.numberOfTabulatedBodies, tabulatedBodyGravitationalParameters );
+    DeviceArray< double > deviceTabulatedBodyStates(
+                6 * model.numberOfTabulatedBodies * model.numberOfTabulationEpochs, tabulatedBodyStates );
+    DeviceArray< double > deviceLogarithmicDensities(
+                model.atmosphereModelType == tabulated_device_atmosphere ? model.numberOfTabulatedAtmosphereAltitudes : 0,
+                tabulatedLogarithmicDensities );
+    DeviceArray< double > deviceRungeKuttaCoefficients(
+                model.numberOfStages * ( model.numberOfStages + 3 ), rungeKuttaCoefficients );
+    DeviceArray< double > deviceOutputEpochs( numberOfOutputEpochs, outputEpochs );
+    DeviceArray< double > deviceInitialStates( 6 * numberOfMembers, initialStates );
+    DeviceArray< double > deviceDragScalingFactors( numberOfMembers, dragScalingFactors );
+    DeviceArray< double > deviceRadiationPressureScalingFactors( numberOfMembers, radiationPressureScalingFactors );
+    DeviceArray< double > deviceOutputStates( 6 * numberOfOutputEpochs * numberOfMembers );
+    DeviceArray< int > deviceMemberStatus( numberOfMembers );
+    DeviceArray< int > deviceNumberOfAcceptedSteps( numberOfMembers );
+    DeviceArray< int > deviceNumberOfRejectedSteps( numberOfMembers );
+
+    const int threadsPerBlock = 64;
+    const int numberOfBlocks = ( numberOfMembers + threadsPerBlock - 1 ) / threadsPerBlock;
+    propagateEnsembleKernel<<< numberOfBlocks, threadsPerBlock >>>(
+            model, deviceGravitationalParameters.data( ), deviceTabulatedBodyStates.data( ),
+            deviceLogarithmicDensities.data( ), deviceRungeKuttaCoefficients.data( ), deviceOutputEpochs.data( ),
+            numberOfOutputEpochs, deviceInitialStates.data( ), deviceDragScalingFactors.data( ),
+            deviceRadiationPressureScalingFactors.data( ), numberOfMembers, deviceOutputStates.data( ),
+            deviceMemberStatus.data( ), deviceNumberOfAcceptedSteps.data( ), deviceNumberOfRejectedSteps.data( ) );
+    checkCudaError( cudaGetLastError( ), "kernel launch" );
+    checkCudaError( cudaDeviceSynchronize( ), "kernel execution" );
+
+    deviceOutputStates.copyToHost( outputStates, 6 * numberOfOutputEpochs * numberOfMembers );
+    deviceMemberStatus.copyToHost( memberStatus, numberOfMembers );
+    deviceNumberOfAcceptedSteps.copyToHost( numberOfAcceptedSteps, numberOfMembers );
+    deviceNumberOfRejectedSteps.copyToHost( numberOfRejectedSteps, numberOfMembers );
+}
+
+} // namespace propagators
+
+} // namespace tudat
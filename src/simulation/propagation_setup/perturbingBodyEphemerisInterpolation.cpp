@@ -0,0 +1,255 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "tudat/astro/ephemerides/constantEphemeris.h"
+#include "tudat/astro/ephemerides/tabulatedEphemeris.h"
+#include "tudat/simulation/propagation_setup/perturbingBodyEphemerisInterpolation.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+namespace
+{
+
+//! Function to retrieve the epochs of the time termination conditions that bound a propagation
+/*!
+ *  Function to retrieve the epochs of the time termination conditions that bound a propagation
+ *  \param terminationSettings Termination settings of the propagation
+ *  \param terminationTimes Epochs of the time termination conditions (appended to by this function)
+ *  \return True if the propagation is guaranteed to terminate at (or shortly after) one of the terminationTimes
+ */
+bool getBoundingTerminationTimes( const std::shared_ptr< PropagationTerminationSettings > terminationSettings,
+                                  std::vector< double >& terminationTimes )
+{
+    bool isBounded = false;
+    switch( terminationSettings->terminationType_ )
+    {
+    case time_stopping_condition:
+    {
+        terminationTimes.push_back(
+                    std::dynamic_pointer_cast< PropagationTimeTerminationSettings >( terminationSettings )->terminationTime_ );
+        isBounded = true;
+        break;
+    }
+    case hybrid_stopping_condition:
+    {
+        std::shared_ptr< PropagationHybridTerminationSettings > hybridTerminationSettings =
+                std::dynamic_pointer_cast< PropagationHybridTerminationSettings >( terminationSettings );
+
+        // Propagation is bounded if any (single condition) or all (all conditions) of the constituent conditions are bounded
+        isBounded = !hybridTerminationSettings->fulfillSingleCondition_;
+        for( unsigned int i = 0; i < hybridTerminationSettings->terminationSettings_.size( ); i++ )
+        {
+            bool isConditionBounded = getBoundingTerminationTimes(
+                        hybridTerminationSettings->terminationSettings_.at( i ), terminationTimes );
+            if( hybridTerminationSettings->fulfillSingleCondition_ )
+            {
+                isBounded = isBounded || isConditionBounded;
+            }
+            else
+            {
+                isBounded = isBounded && isConditionBounded;
+            }
+        }
+        break;
+    }
+    case non_sequential_stopping_condition:
+    {
+        std::shared_ptr< NonSequentialPropagationTerminationSettings > nonSequentialTerminationSettings =
+                std::dynamic_pointer_cast< NonSequentialPropagationTerminationSettings >( terminationSettings );
+        bool isForwardLegBounded = getBoundingTerminationTimes(
+                    nonSequentialTerminationSettings->forwardTerminationSettings_, terminationTimes );
+        bool isBackwardLegBounded = getBoundingTerminationTimes(
+                    nonSequentialTerminationSettings->backwardTerminationSettings_, terminationTimes );
+        isBounded = isForwardLegBounded && isBackwardLegBounded;
+        break;
+    }
+    default:
+        break;
+    }
+    return isBounded;
+}
+
+//! Function to retrieve the interpolator of a tabulated ephemeris (nullptr if the ephemeris is not tabulated)
+const void* getTabulatedEphemerisInterpolator( const std::shared_ptr< ephemerides::Ephemeris > ephemeris )
+{
+    using namespace ephemerides;
+
+    const void* interpolator = nullptr;
+    if( std::dynamic_pointer_cast< TabulatedCartesianEphemeris< double, double > >( ephemeris ) != nullptr )
+    {
+        interpolator = std::dynamic_pointer_cast< TabulatedCartesianEphemeris< double, double > >(
+                    ephemeris )->getInterpolator( ).get( );
+    }
+    else if( std::dynamic_pointer_cast< TabulatedCartesianEphemeris< long double, double > >( ephemeris ) != nullptr )
+    {
+        interpolator = std::dynamic_pointer_cast< TabulatedCartesianEphemeris< long double, double > >(
+                    ephemeris )->getInterpolator( ).get( );
+    }
+    else if( std::dynamic_pointer_cast< TabulatedCartesianEphemeris< double, Time > >( ephemeris ) != nullptr )
+    {
+        interpolator = std::dynamic_pointer_cast< TabulatedCartesianEphemeris< double, Time > >(
+                    ephemeris )->getInterpolator( ).get( );
+    }
+    else if( std::dynamic_pointer_cast< TabulatedCartesianEphemeris< long double, Time > >( ephemeris ) != nullptr )
+    {
+        interpolator = std::dynamic_pointer_cast< TabulatedCartesianEphemeris< long double, Time > >(
+                    ephemeris )->getInterpolator( ).get( );
+    }
+    return interpolator;
+}
+
+}
+
+//! Function to determine the time interval over which the ephemerides of the perturbing bodies are to be fitted
+std::pair< double, double > getPerturbingBodyEphemerisInterpolationInterval(
+        const double initialTime,
+        const std::shared_ptr< PropagationTerminationSettings > terminationSettings,
+        const std::shared_ptr< PerturbingBodyEphemerisInterpolationSettings > interpolationSettings )
+{
+    std::vector< double > intervalEpochs = { initialTime };
+    if( !std::isnan( interpolationSettings->finalTime_ ) )
+    {
+        intervalEpochs.push_back( interpolationSettings->finalTime_ );
+    }
+    else if( !getBoundingTerminationTimes( terminationSettings, intervalEpochs ) )
+    {
+        throw std::runtime_error( "Error when fitting perturbing body ephemerides, propagation is not bounded by a time "
+                                  "termination condition, and no final time is provided in the interpolation settings" );
+    }
+
+    return std::make_pair(
+                *std::min_element( intervalEpochs.begin( ), intervalEpochs.end( ) ) - interpolationSettings->timeBuffer_,
+                *std::max_element( intervalEpochs.begin( ), intervalEpochs.end( ) ) + interpolationSettings->timeBuffer_ );
+}
+
+//! Constructor
+PerturbingBodyEphemerisInterpolator::PerturbingBodyEphemerisInterpolator(
+        const std::shared_ptr< PerturbingBodyEphemerisInterpolationSettings > interpolationSettings,
+        const std::vector< std::string >& propagatedBodies ):
+    interpolationSettings_( interpolationSettings ), numberOfEphemerisFits_( 0 )
+{
+    if( interpolationSettings_ == nullptr )
+    {
+        throw std::runtime_error( "Error when creating perturbing body ephemeris interpolator, no settings provided" );
+    }
+
+    bodiesToExclude_.insert( propagatedBodies.begin( ), propagatedBodies.end( ) );
+    bodiesToExclude_.insert( interpolationSettings_->bodiesToExclude_.begin( ),
+                             interpolationSettings_->bodiesToExclude_.end( ) );
+}
+
+//! Function to replace the ephemerides of the perturbing bodies by Chebyshev fits
+void PerturbingBodyEphemerisInterpolator::replaceEphemerides(
+        const simulation_setup::SystemOfBodies& bodies,
+        const double startTime, const double endTime )
+{
+    using namespace ephemerides;
+
+    if( areEphemeridesReplaced( ) )
+    {
+        throw std::runtime_error( "Error when replacing perturbing body ephemerides, ephemerides are already replaced" );
+    }
+
+    // Determine (and, where needed, make) the fits of all ephemerides before replacing any of them, so that the
+    // environment is left unmodified if a fit fails.
+    std::vector< std::pair< std::shared_ptr< simulation_setup::Body >,
+            std::shared_ptr< PreInterpolatedEphemeris > > > ephemeridesToSet;
+    for( auto bodyIterator : bodies.getMap( ) )
+    {
+        std::shared_ptr< Ephemeris > bodyEphemeris = bodyIterator.second->getEphemeris( );
+        if( bodiesToExclude_.count( bodyIterator.first ) > 0 || bodyEphemeris == nullptr ||
+                std::dynamic_pointer_cast< ConstantEphemeris >( bodyEphemeris ) != nullptr ||
+                std::dynamic_pointer_cast< ChebyshevCartesianEphemeris >( bodyEphemeris ) != nullptr ||
+                std::dynamic_pointer_cast< PreInterpolatedEphemeris >( bodyEphemeris ) != nullptr )
+        {
+            continue;
+        }
+
+        // Limit fit of tabulated ephemeris to the interval where it is defined
+        double fitStartTime = startTime;
+        double fitEndTime = endTime;
+        const void* tabulatedEphemerisInterpolator = nullptr;
+        if( isTabulatedEphemeris( bodyEphemeris ) )
+        {
+            tabulatedEphemerisInterpolator = getTabulatedEphemerisInterpolator( bodyEphemeris );
+            if( tabulatedEphemerisInterpolator == nullptr )
+            {
+                continue;
+            }
+            std::pair< double, double > safeInterval = getTabulatedEphemerisSafeInterval( bodyEphemeris );
+            fitStartTime = std::max( fitStartTime, safeInterval.first );
+            fitEndTime = std::min( fitEndTime, safeInterval.second );
+            if( !( fitEndTime - fitStartTime > 2.0 * interpolationSettings_->minimumSegmentDuration_ ) )
+            {
+                continue;
+            }
+        }
+
+        if( !isExistingFitValid( bodyIterator.first, bodyEphemeris, fitStartTime, fitEndTime ) )
+        {
+            interpolatedEphemerides_[ bodyIterator.first ] = std::make_shared< PreInterpolatedEphemeris >(
+                        bodyEphemeris, fitStartTime, fitEndTime,
+                        interpolationSettings_->positionTolerance_, interpolationSettings_->velocityTolerance_,
+                        interpolationSettings_->polynomialDegree_, interpolationSettings_->minimumSegmentDuration_ );
+            fittedTabulatedEphemerisInterpolators_[ bodyIterator.first ] = tabulatedEphemerisInterpolator;
+            numberOfEphemerisFits_++;
+        }
+        ephemeridesToSet.push_back( std::make_pair( bodyIterator.second, interpolatedEphemerides_.at( bodyIterator.first ) ) );
+    }
+
+    for( unsigned int i = 0; i < ephemeridesToSet.size( ); i++ )
+    {
+        replacedEphemerides_.push_back( std::make_pair( ephemeridesToSet.at( i ).first,
+                                                        ephemeridesToSet.at( i ).first->getEphemeris( ) ) );
+        ephemeridesToSet.at( i ).first->setEphemeris( ephemeridesToSet.at( i ).second );
+        ephemeridesToSet.at( i ).first->recomputeStateOnNextCall( );
+    }
+}
+
+//! Function to restore the original ephemerides of the perturbing bodies (if they were replaced)
+void PerturbingBodyEphemerisInterpolator::restoreEphemerides( )
+{
+    for( unsigned int i = 0; i < replacedEphemerides_.size( ); i++ )
+    {
+        replacedEphemerides_.at( i ).first->setEphemeris( replacedEphemerides_.at( i ).second );
+        replacedEphemerides_.at( i ).first->recomputeStateOnNextCall( );
+    }
+    replacedEphemerides_.clear( );
+}
+
+//! Function to check whether the existing fit of the ephemeris of a body can be used for a given interval
+bool PerturbingBodyEphemerisInterpolator::isExistingFitValid(
+        const std::string& bodyName,
+        const std::shared_ptr< ephemerides::Ephemeris > bodyEphemeris,
+        const double startTime, const double endTime )
+{
+    bool isFitValid = false;
+    if( interpolatedEphemerides_.count( bodyName ) > 0 )
+    {
+        std::shared_ptr< ephemerides::PreInterpolatedEphemeris > existingFit = interpolatedEphemerides_.at( bodyName );
+        isFitValid = ( existingFit->getOriginalEphemeris( ) == bodyEphemeris ) &&
+                existingFit->isIntervalFitted( startTime, endTime ) &&
+                ( fittedTabulatedEphemerisInterpolators_.at( bodyName ) ==
+                  getTabulatedEphemerisInterpolator( bodyEphemeris ) );
+    }
+    return isFitValid;
+}
+
+} // namespace propagators
+
+} // namespace tudat
@@ -138,13 +138,13 @@ Eigen::VectorXd getVectorFromDoubleFunction( const std::function< double( ) >& d
 
 //! Function to evaluate a set of vector-returning functions and concatenate the results.
 Eigen::VectorXd evaluateListOfVectorFunctions(
-        const std::vector< std::pair< std::function< Eigen::VectorXd( ) >, int > > vectorFunctionList,
+        const std::vector< std::pair< std::function< Eigen::VectorXd( ) >, int > >& vectorFunctionList,
         const int totalSize )
 {
     Eigen::VectorXd variableList = Eigen::VectorXd::Zero( totalSize );
     int currentIndex = 0;
 
-    for( std::pair< std::function< Eigen::VectorXd( ) >, int > vectorFunction: vectorFunctionList )
+    for( const std::pair< std::function< Eigen::VectorXd( ) >, int >& vectorFunction: vectorFunctionList )
     {
         variableList.segment( currentIndex, vectorFunction.second ) = vectorFunction.first( );
         currentIndex += vectorFunction.second;
@@ -486,6 +486,9 @@ int getDependentVariableSize(
     case visible_source_area:
         variableSize = 1;
         break;
+    case spherical_harmonic_evaluated_maximum_degree_dependent_variable:
+        variableSize = 1;
+        break;
     default:
         std::string errorMessage = "Error, did not recognize dependent variable size of type: " +
                 std::to_string( dependentVariableSettings->dependentVariableType_ );
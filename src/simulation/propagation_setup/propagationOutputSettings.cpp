@@ -307,6 +307,9 @@ std::string getDependentVariableName(
     case visible_source_area:
         variableName = "Visible area";
         break;
+    case spherical_harmonic_evaluated_maximum_degree_dependent_variable:
+        variableName = "Spherical harmonic acceleration evaluated maximum degree ";
+        break;
     default:
         std::string errorMessage = "Error, dependent variable " +
                 std::to_string( propagationDependentVariables ) +
@@ -387,6 +390,7 @@ std::string getDependentVariableId(
             ( dependentVariableSettings->dependentVariableType_ == single_acceleration_norm_dependent_variable ) ||
             ( dependentVariableSettings->dependentVariableType_ == spherical_harmonic_acceleration_terms_dependent_variable ) ||
             ( dependentVariableSettings->dependentVariableType_ == spherical_harmonic_acceleration_norm_terms_dependent_variable )  ||
+            ( dependentVariableSettings->dependentVariableType_ == spherical_harmonic_evaluated_maximum_degree_dependent_variable )  ||
             ( dependentVariableSettings->dependentVariableType_ == acceleration_partial_wrt_body_translational_state ) )
     {
         variableId += ", acting on " + dependentVariableSettings->associatedBody_;
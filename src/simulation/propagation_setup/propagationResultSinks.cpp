@@ -0,0 +1,344 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cstdint>
+#include <stdexcept>
+
+#include "tudat/simulation/propagation_setup/propagationResultSinks.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Function called before the first output epoch of a propagation is processed
+void BinaryFilePropagationResultSink::startPropagation( )
+{
+    if( outputStream_.is_open( ) )
+    {
+        outputStream_.close( );
+    }
+
+    std::ios_base::openmode openMode = std::ios::out | std::ios::binary;
+    openMode |= ( appendToFile_ ? std::ios::app : std::ios::trunc );
+    outputStream_.open( fileName_, openMode );
+    if( !outputStream_.is_open( ) )
+    {
+        throw std::runtime_error( "Error when writing propagation results to binary file, could not open " + fileName_ );
+    }
+}
+
+//! Function to write the results at a single output epoch to the file
+void BinaryFilePropagationResultSink::processEpoch(
+        const double time, const Eigen::VectorXd& state, const Eigen::VectorXd& dependentVariables )
+{
+    if( !outputStream_.is_open( ) )
+    {
+        startPropagation( );
+    }
+
+    int32_t stateSize = static_cast< int32_t >( state.rows( ) );
+    int32_t dependentVariableSize = static_cast< int32_t >( dependentVariables.rows( ) );
+
+    outputStream_.write( reinterpret_cast< const char* >( &time ), sizeof( double ) );
+    outputStream_.write( reinterpret_cast< const char* >( &stateSize ), sizeof( int32_t ) );
+    outputStream_.write( reinterpret_cast< const char* >( &dependentVariableSize ), sizeof( int32_t ) );
+    outputStream_.write( reinterpret_cast< const char* >( state.data( ) ), stateSize * sizeof( double ) );
+    outputStream_.write( reinterpret_cast< const char* >( dependentVariables.data( ) ), dependentVariableSize * sizeof( double ) );
+
+    if( !outputStream_.good( ) )
+    {
+        throw std::runtime_error( "Error when writing propagation results to binary file " + fileName_ );
+    }
+}
+
+//! Function called after the last output epoch of a propagation has been processed
+void BinaryFilePropagationResultSink::finalizePropagation( )
+{
+    if( outputStream_.is_open( ) )
+    {
+        outputStream_.close( );
+    }
+}
+
+//! Function to read the results of a propagation that were written by a BinaryFilePropagationResultSink
+void readPropagationResultsFromBinaryFile(
+        const std::string& fileName,
+        std::map< double, Eigen::VectorXd >& stateHistory,
+        std::map< double, Eigen::VectorXd >& dependentVariableHistory )
+{
+    stateHistory.clear( );
+    dependentVariableHistory.clear( );
+
+    std::ifstream inputStream( fileName, std::ios::in | std::ios::binary );
+    if( !inputStream.is_open( ) )
+    {
+        throw std::runtime_error( "Error when reading propagation results from binary file, could not open " + fileName );
+    }
+
+    double time;
+    int32_t stateSize, dependentVariableSize;
+    while( inputStream.read( reinterpret_cast< char* >( &time ), sizeof( double ) ) )
+    {
+        if( !inputStream.read( reinterpret_cast< char* >( &stateSize ), sizeof( int32_t ) ) ||
+                !inputStream.read( reinterpret_cast< char* >( &dependentVariableSize ), sizeof( int32_t ) ) ||
+                stateSize < 0 || dependentVariableSize < 0 )
+        {
+            throw std::runtime_error( "Error when reading propagation results from binary file " + fileName + ", record header is corrupt" );
+        }
+
+        Eigen::VectorXd currentState( stateSize );
+        Eigen::VectorXd currentDependentVariables( dependentVariableSize );
+        if( !inputStream.read( reinterpret_cast< char* >( currentState.data( ) ), stateSize * sizeof( double ) ) ||
+                !inputStream.read( reinterpret_cast< char* >( currentDependentVariables.data( ) ),
+                                   dependentVariableSize * sizeof( double ) ) )
+        {
+            throw std::runtime_error( "Error when reading propagation results from binary file " + fileName + ", record is incomplete" );
+        }
+
+        stateHistory[ time ] = currentState;
+        if( dependentVariableSize > 0 )
+        {
+            dependentVariableHistory[ time ] = currentDependentVariables;
+        }
+    }
+}
+
+//! Constructor
+RingBufferPropagationResultSink::RingBufferPropagationResultSink( const int bufferSize ):
+    bufferSize_( bufferSize ), nextIndex_( 0 ), numberOfStoredEpochs_( 0 ), numberOfProcessedEpochs_( 0 )
+{
+    if( bufferSize < 1 )
+    {
+        throw std::runtime_error( "Error when creating ring buffer propagation result sink, buffer size must be at least 1, but is " +
+                                  std::to_string( bufferSize ) );
+    }
+}
+
+//! Function called before the first output epoch of a propagation is processed
+void RingBufferPropagationResultSink::startPropagation( )
+{
+    nextIndex_ = 0;
+    numberOfStoredEpochs_ = 0;
+    numberOfProcessedEpochs_ = 0;
+}
+
+//! Function to store the results at a single output epoch in the buffer
+void RingBufferPropagationResultSink::processEpoch(
+        const double time, const Eigen::VectorXd& state, const Eigen::VectorXd& dependentVariables )
+{
+    // Allocate buffer upon first epoch, or if sizes have changed
+    if( numberOfStoredEpochs_ == 0 )
+    {
+        if( times_.size( ) != static_cast< unsigned int >( bufferSize_ ) || states_.rows( ) != state.rows( ) ||
+                dependentVariables_.rows( ) != dependentVariables.rows( ) )
+        {
+            times_.resize( bufferSize_ );
+            states_.resize( state.rows( ), bufferSize_ );
+            dependentVariables_.resize( dependentVariables.rows( ), bufferSize_ );
+        }
+    }
+    else if( state.rows( ) != states_.rows( ) || dependentVariables.rows( ) != dependentVariables_.rows( ) )
+    {
+        throw std::runtime_error( "Error when storing propagation results in ring buffer, inconsistent state or dependent variable size" );
+    }
+
+    times_[ nextIndex_ ] = time;
+    states_.col( nextIndex_ ) = state;
+    dependentVariables_.col( nextIndex_ ) = dependentVariables;
+
+    nextIndex_ = ( nextIndex_ + 1 ) % bufferSize_;
+    if( numberOfStoredEpochs_ < bufferSize_ )
+    {
+        numberOfStoredEpochs_++;
+    }
+    numberOfProcessedEpochs_++;
+}
+
+//! Function to retrieve the retained states, with time as key
+std::map< double, Eigen::VectorXd > RingBufferPropagationResultSink::getStateHistory( )
+{
+    std::map< double, Eigen::VectorXd > stateHistory;
+    for( int i = 0; i < numberOfStoredEpochs_; i++ )
+    {
+        int currentIndex = ( nextIndex_ - numberOfStoredEpochs_ + i + bufferSize_ ) % bufferSize_;
+        stateHistory[ times_[ currentIndex ] ] = states_.col( currentIndex );
+    }
+    return stateHistory;
+}
+
+//! Function to retrieve the retained dependent variables, with time as key
+std::map< double, Eigen::VectorXd > RingBufferPropagationResultSink::getDependentVariableHistory( )
+{
+    std::map< double, Eigen::VectorXd > dependentVariableHistory;
+    if( dependentVariables_.rows( ) > 0 )
+    {
+        for( int i = 0; i < numberOfStoredEpochs_; i++ )
+        {
+            int currentIndex = ( nextIndex_ - numberOfStoredEpochs_ + i + bufferSize_ ) % bufferSize_;
+            dependentVariableHistory[ times_[ currentIndex ] ] = dependentVariables_.col( currentIndex );
+        }
+    }
+    return dependentVariableHistory;
+}
+
+//! Constructor
+AsynchronousPropagationResultSink::AsynchronousPropagationResultSink(
+        const std::shared_ptr< PropagationResultSink > processingSink,
+        const int maximumQueueSize ):
+    processingSink_( processingSink ),
+    maximumQueueSize_( maximumQueueSize ),
+    isTaskInProgress_( false ),
+    stopProcessing_( false ),
+    caughtException_( nullptr )
+{
+    if( processingSink == nullptr )
+    {
+        throw std::runtime_error( "Error when creating asynchronous propagation result sink, no sink provided" );
+    }
+    else if( maximumQueueSize < 1 )
+    {
+        throw std::runtime_error( "Error when creating asynchronous propagation result sink, queue size must be at least 1, but is " +
+                                  std::to_string( maximumQueueSize ) );
+    }
+
+    processingThread_ = std::thread( &AsynchronousPropagationResultSink::processQueuedTasks, this );
+}
+
+//! Destructor, waits for all queued results to be processed, and stops the background thread
+AsynchronousPropagationResultSink::~AsynchronousPropagationResultSink( )
+{
+    {
+        std::lock_guard< std::mutex > lock( queueMutex_ );
+        stopProcessing_ = true;
+    }
+    queueCondition_.notify_all( );
+    processingThread_.join( );
+}
+
+void AsynchronousPropagationResultSink::startPropagation( )
+{
+    rethrowCaughtException( );
+    addTaskToQueue( QueuedTask{ start_propagation_task, 0.0, Eigen::VectorXd( ), Eigen::VectorXd( ) } );
+}
+
+void AsynchronousPropagationResultSink::processEpoch(
+        const double time, const Eigen::VectorXd& state, const Eigen::VectorXd& dependentVariables )
+{
+    rethrowCaughtException( );
+    addTaskToQueue( QueuedTask{ process_epoch_task, time, state, dependentVariables } );
+}
+
+void AsynchronousPropagationResultSink::finalizePropagation( )
+{
+    addTaskToQueue( QueuedTask{ finalize_propagation_task, 0.0, Eigen::VectorXd( ), Eigen::VectorXd( ) } );
+    waitForEmptyQueue( );
+    rethrowCaughtException( );
+}
+
+//! Function to add a task to the queue, waiting if the queue is full
+void AsynchronousPropagationResultSink::addTaskToQueue( QueuedTask&& task )
+{
+    {
+        std::unique_lock< std::mutex > lock( queueMutex_ );
+        queueCondition_.wait( lock, [ this ]( ){ return taskQueue_.size( ) < maximumQueueSize_; } );
+        taskQueue_.push_back( std::move( task ) );
+    }
+    queueCondition_.notify_all( );
+}
+
+//! Function to wait until all queued tasks have been processed
+void AsynchronousPropagationResultSink::waitForEmptyQueue( )
+{
+    std::unique_lock< std::mutex > lock( queueMutex_ );
+    queueCondition_.wait( lock, [ this ]( ){ return taskQueue_.empty( ) && !isTaskInProgress_; } );
+}
+
+//! Function to rethrow exception caught on background thread, if any
+void AsynchronousPropagationResultSink::rethrowCaughtException( )
+{
+    std::exception_ptr caughtException = nullptr;
+    {
+        std::lock_guard< std::mutex > lock( queueMutex_ );
+        std::swap( caughtException, caughtException_ );
+    }
+
+    if( caughtException != nullptr )
+    {
+        std::rethrow_exception( caughtException );
+    }
+}
+
+//! Function run by the background thread
+void AsynchronousPropagationResultSink::processQueuedTasks( )
+{
+    while( true )
+    {
+        QueuedTask currentTask;
+        {
+            std::unique_lock< std::mutex > lock( queueMutex_ );
+            queueCondition_.wait( lock, [ this ]( ){ return !taskQueue_.empty( ) || stopProcessing_; } );
+            if( taskQueue_.empty( ) )
+            {
+                return;
+            }
+            currentTask = std::move( taskQueue_.front( ) );
+            taskQueue_.pop_front( );
+            isTaskInProgress_ = true;
+        }
+        queueCondition_.notify_all( );
+
+        // Process task; after an exception, tasks are discarded until the next propagation is started
+        bool isExceptionCaught;
+        {
+            std::lock_guard< std::mutex > lock( queueMutex_ );
+            isExceptionCaught = ( caughtException_ != nullptr );
+        }
+
+        std::exception_ptr currentException = nullptr;
+        if( !isExceptionCaught || currentTask.taskType == start_propagation_task )
+        {
+            try
+            {
+                switch( currentTask.taskType )
+                {
+                case start_propagation_task:
+                    processingSink_->startPropagation( );
+                    break;
+                case process_epoch_task:
+                    processingSink_->processEpoch( currentTask.time, currentTask.state, currentTask.dependentVariables );
+                    break;
+                case finalize_propagation_task:
+                    processingSink_->finalizePropagation( );
+                    break;
+                }
+            }
+            catch( ... )
+            {
+                currentException = std::current_exception( );
+            }
+        }
+
+        {
+            std::lock_guard< std::mutex > lock( queueMutex_ );
+            if( currentException != nullptr && caughtException_ == nullptr )
+            {
+                caughtException_ = currentException;
+            }
+            isTaskInProgress_ = false;
+        }
+        queueCondition_.notify_all( );
+    }
+}
+
+} // namespace propagators
+
+} // namespace tudat
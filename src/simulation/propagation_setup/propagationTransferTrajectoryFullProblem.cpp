@@ -0,0 +1,180 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include "tudat/basics/parallelization.h"
+#include "tudat/simulation/propagation_setup/propagationTransferTrajectoryFullProblem.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Function to retrieve the difference between the propagated and patched-conic state at leg departure
+Eigen::Vector6d TransferLegFullProblemResults::getDepartureStateDifference( ) const
+{
+    if( backwardStateHistories_.size( ) == 0 || backwardStateHistories_.front( ).size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when retrieving departure state difference of transfer leg, no propagation results found" );
+    }
+    return backwardStateHistories_.front( ).begin( )->second.segment( 0, 6 ) - patchedConicDepartureState_;
+}
+
+//! Function to retrieve the difference between the propagated and patched-conic state at leg arrival
+Eigen::Vector6d TransferLegFullProblemResults::getArrivalStateDifference( ) const
+{
+    if( forwardStateHistories_.size( ) == 0 || forwardStateHistories_.back( ).size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when retrieving arrival state difference of transfer leg, no propagation results found" );
+    }
+    return forwardStateHistories_.back( ).rbegin( )->second.segment( 0, 6 ) - patchedConicArrivalState_;
+}
+
+//! Function to retrieve the propagated state history of the full leg
+std::map< double, Eigen::VectorXd > TransferLegFullProblemResults::getStateHistory( ) const
+{
+    std::map< double, Eigen::VectorXd > stateHistory;
+    for( unsigned int i = 0; i < forwardStateHistories_.size( ); i++ )
+    {
+        for( auto it : backwardStateHistories_.at( i ) )
+        {
+            stateHistory[ it.first ] = it.second;
+        }
+        for( auto it : forwardStateHistories_.at( i ) )
+        {
+            stateHistory[ it.first ] = it.second;
+        }
+    }
+    return stateHistory;
+}
+
+//! Function to propagate the full dynamics along all legs of a transfer trajectory
+std::vector< TransferLegFullProblemResults > propagateTransferTrajectoryFullProblem(
+        const std::shared_ptr< mission_segments::TransferTrajectory > transferTrajectory,
+        const std::vector< simulation_setup::SystemOfBodies >& workerBodies,
+        const TransferLegPropagatorSettingsFunction propagatorSettingsFunction )
+{
+    if( workerBodies.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when propagating full problem of transfer trajectory, no bodies provided" );
+    }
+
+    for( unsigned int i = 0; i < workerBodies.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < i; j++ )
+        {
+            if( simulation_setup::doSystemsOfBodiesShareBodies( workerBodies.at( i ), workerBodies.at( j ) ) )
+            {
+                throw std::runtime_error( "Error when propagating full problem of transfer trajectory, bodies of worker " +
+                                          std::to_string( j ) + " and " + std::to_string( i ) + " are not independent" );
+            }
+        }
+    }
+
+    // Split each leg into segments at its maneuvers, and retrieve the patched-conic states at the leg boundaries
+    std::vector< std::shared_ptr< mission_segments::TransferLeg > > legs = transferTrajectory->getLegs( );
+    std::vector< TransferLegFullProblemResults > fullProblemResults( legs.size( ) );
+
+    // List of independent propagations, as (leg index, segment index, forward/backward) combinations
+    std::vector< std::tuple< int, int, bool > > propagationList;
+    for( unsigned int i = 0; i < legs.size( ); i++ )
+    {
+        std::shared_ptr< mission_segments::TransferLeg > currentLeg = legs.at( i );
+        TransferLegFullProblemResults& currentResults = fullProblemResults.at( i );
+
+        currentResults.segmentBoundaryTimes_.push_back( currentLeg->getLegDepartureTime( ) );
+        for( int j = 0; j < currentLeg->getNumberOfImpulsiveManeuvers( ); j++ )
+        {
+            mission_segments::TrajectoryManeuver currentManeuver = currentLeg->getTrajectoryManeuver( j );
+            currentResults.segmentBoundaryTimes_.push_back( currentManeuver.getManeuverTime( ) );
+        }
+        currentResults.segmentBoundaryTimes_.push_back( currentLeg->getLegArrivalTime( ) );
+
+        currentResults.patchedConicDepartureState_ = currentLeg->getStateAlongTrajectory( currentLeg->getLegDepartureTime( ) );
+        currentResults.patchedConicArrivalState_ = currentLeg->getStateAlongTrajectory( currentLeg->getLegArrivalTime( ) );
+
+        int numberOfSegments = currentResults.segmentBoundaryTimes_.size( ) - 1;
+        currentResults.forwardStateHistories_.resize( numberOfSegments );
+        currentResults.backwardStateHistories_.resize( numberOfSegments );
+        currentResults.forwardDependentVariableHistories_.resize( numberOfSegments );
+        currentResults.backwardDependentVariableHistories_.resize( numberOfSegments );
+        for( int j = 0; j < numberOfSegments; j++ )
+        {
+            propagationList.push_back( std::make_tuple( i, j, true ) );
+            propagationList.push_back( std::make_tuple( i, j, false ) );
+        }
+    }
+
+    // Perform the propagations, with each worker using only its own bodies, and storing its results in a
+    // pre-allocated entry, so that the merged results do not depend on the number of workers
+    int numberOfPropagations = propagationList.size( );
+    int numberOfWorkers = workerBodies.size( );
+    utilities::executeParallelTasks(
+                numberOfWorkers, [ & ]( const int workerIndex )
+    {
+        for( int propagationIndex = workerIndex; propagationIndex < numberOfPropagations; propagationIndex += numberOfWorkers )
+        {
+            int legIndex = std::get< 0 >( propagationList.at( propagationIndex ) );
+            int segmentIndex = std::get< 1 >( propagationList.at( propagationIndex ) );
+            bool propagateForward = std::get< 2 >( propagationList.at( propagationIndex ) );
+
+            TransferLegFullProblemResults& currentResults = fullProblemResults.at( legIndex );
+            double segmentStartTime = currentResults.segmentBoundaryTimes_.at( segmentIndex );
+            double segmentEndTime = currentResults.segmentBoundaryTimes_.at( segmentIndex + 1 );
+            double midpointTime = ( segmentStartTime + segmentEndTime ) / 2.0;
+
+            std::shared_ptr< SingleArcPropagatorSettings< double > > propagatorSettings =
+                    propagatorSettingsFunction(
+                        workerBodies.at( workerIndex ), legIndex,
+                        legs.at( legIndex )->getStateAlongTrajectory( midpointTime ), midpointTime,
+                        propagateForward ? segmentEndTime : segmentStartTime );
+            if( propagatorSettings->getOutputSettings( )->getSetIntegratedResult( ) )
+            {
+                throw std::runtime_error( "Error when propagating full problem of transfer trajectory, propagated results cannot "
+                                          "be used to reset the environment" );
+            }
+
+            SingleArcDynamicsSimulator< double > dynamicsSimulator( workerBodies.at( workerIndex ), propagatorSettings );
+            if( propagateForward )
+            {
+                currentResults.forwardStateHistories_.at( segmentIndex ) =
+                        dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+                currentResults.forwardDependentVariableHistories_.at( segmentIndex ) =
+                        dynamicsSimulator.getDependentVariableHistory( );
+            }
+            else
+            {
+                currentResults.backwardStateHistories_.at( segmentIndex ) =
+                        dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+                currentResults.backwardDependentVariableHistories_.at( segmentIndex ) =
+                        dynamicsSimulator.getDependentVariableHistory( );
+            }
+        }
+    }, numberOfWorkers );
+
+    return fullProblemResults;
+}
+
+//! Function to retrieve the difference between the full-dynamics and patched-conic states at the leg boundaries
+std::map< int, std::pair< Eigen::Vector6d, Eigen::Vector6d > > getDifferenceFullProblemWrtTransferTrajectory(
+        const std::vector< TransferLegFullProblemResults >& fullProblemResults )
+{
+    std::map< int, std::pair< Eigen::Vector6d, Eigen::Vector6d > > stateDifferences;
+    for( unsigned int i = 0; i < fullProblemResults.size( ); i++ )
+    {
+        stateDifferences[ i ] = std::make_pair( fullProblemResults.at( i ).getDepartureStateDifference( ),
+                                                fullProblemResults.at( i ).getArrivalStateDifference( ) );
+    }
+    return stateDifferences;
+}
+
+} // namespace propagators
+
+} // namespace tudat
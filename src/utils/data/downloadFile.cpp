@@ -8,21 +8,247 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <cstring>
+#include <exception>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/sync/file_lock.hpp>
+#include <boost/interprocess/sync/scoped_lock.hpp>
+
+#include <tudat/utils/data/downloadFile.h>
 #include <tudat/utils/details.h>
 
 namespace tudat {
 namespace utils {
 namespace data {
 
+namespace {
+
+// SHA-256 round constants (FIPS 180-4)
+const uint32_t sha256_round_constants[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+inline uint32_t rotate_right(uint32_t value, int bits) {
+    return (value >> bits) | (value << (32 - bits));
+}
+
+// process a single 64-byte block of data
+void sha256_process_block(uint32_t state[8], const unsigned char *block) {
+    uint32_t w[64];
+    for (int i = 0; i < 16; i++) {
+        w[i] = (uint32_t(block[4 * i]) << 24) |
+               (uint32_t(block[4 * i + 1]) << 16) |
+               (uint32_t(block[4 * i + 2]) << 8) | uint32_t(block[4 * i + 3]);
+    }
+    for (int i = 16; i < 64; i++) {
+        uint32_t s0 = rotate_right(w[i - 15], 7) ^
+                      rotate_right(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = rotate_right(w[i - 2], 17) ^ rotate_right(w[i - 2], 19) ^
+                      (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+    for (int i = 0; i < 64; i++) {
+        uint32_t s1 =
+            rotate_right(e, 6) ^ rotate_right(e, 11) ^ rotate_right(e, 25);
+        uint32_t ch = (e & f) ^ (~e & g);
+        uint32_t temp1 = h + s1 + ch + sha256_round_constants[i] + w[i];
+        uint32_t s0 =
+            rotate_right(a, 2) ^ rotate_right(a, 13) ^ rotate_right(a, 22);
+        uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+        uint32_t temp2 = s0 + maj;
+        h = g;
+        g = f;
+        f = e;
+        e = d + temp1;
+        d = c;
+        c = b;
+        b = a;
+        a = temp1 + temp2;
+    }
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+// convert checksum to lower case, for comparison
+std::string normalize_checksum(std::string checksum) {
+    std::transform(checksum.begin(), checksum.end(), checksum.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+    return checksum;
+}
+
+// retrieve a mutex per file, to lock access to the file within this process
+// (file locks only synchronize between processes)
+std::shared_ptr<std::mutex> get_file_mutex(const std::string &filename) {
+    static std::mutex file_mutexes_mutex;
+    static std::map<std::string, std::shared_ptr<std::mutex>> file_mutexes;
+
+    std::lock_guard<std::mutex> lock(file_mutexes_mutex);
+    std::shared_ptr<std::mutex> &file_mutex = file_mutexes[filename];
+    if (file_mutex == nullptr) {
+        file_mutex = std::make_shared<std::mutex>();
+    }
+    return file_mutex;
+}
+
+// check whether a file exists and, if a checksum is given, matches it
+bool is_valid_file(const std::string &filename, const std::string &sha256) {
+    if (!details::file_exists(filename.c_str())) {
+        return false;
+    }
+    return sha256.empty() || compute_sha256(filename) == sha256;
+}
+
+// copy a file, using a temporary file so that the target is never partially
+// written
+void copy_file_atomically(const std::string &source,
+                          const std::string &target) {
+    std::string temporary_target = target + ".tmp";
+    boost::filesystem::create_directories(
+        boost::filesystem::path(target).parent_path());
+    boost::filesystem::remove(temporary_target);
+    boost::filesystem::copy_file(source, temporary_target);
+    boost::filesystem::rename(temporary_target, target);
+}
+
+// download a file (resuming a partial download, if present), validate it, and
+// store it in the content-addressed cache
+void download_and_validate(const char *remote_url,
+                           const std::string &filename,
+                           const std::string &sha256,
+                           const std::string &content_filename,
+                           bool allow_resume,
+                           int verbosity) {
+    std::string partial_filename = filename + ".part";
+    bool resume = allow_resume && details::file_exists(partial_filename.c_str());
+    if (!resume) {
+        boost::filesystem::remove(partial_filename);
+    } else if (verbosity > 0) {
+        std::cout << "Resuming partial download of " << remote_url << std::endl;
+    }
+
+    try {
+        details::download_file_from_source(
+            remote_url, partial_filename.c_str(), resume);
+    } catch (const std::runtime_error &) {
+        // server may not support resuming, retry full download
+        if (!resume) {
+            throw;
+        }
+        boost::filesystem::remove(partial_filename);
+        details::download_file_from_source(
+            remote_url, partial_filename.c_str(), false);
+    }
+
+    if (!sha256.empty()) {
+        std::string downloaded_sha256 = compute_sha256(partial_filename);
+        if (downloaded_sha256 != sha256) {
+            boost::filesystem::remove(partial_filename);
+            throw std::runtime_error(
+                "Checksum of file downloaded from " + std::string(remote_url) +
+                " (" + downloaded_sha256 + ") does not match expected checksum (" +
+                sha256 + ")");
+        }
+    }
+    boost::filesystem::rename(partial_filename, filename);
+
+    if (!content_filename.empty()) {
+        copy_file_atomically(filename, content_filename);
+    }
+}
+
+} // namespace
+
+// compute the SHA-256 checksum (hex) of a file
+std::string compute_sha256(const std::string &file_name) {
+    std::ifstream file(file_name, std::ios::binary);
+    if (!file.good()) {
+        throw std::runtime_error("Error computing checksum, file " + file_name +
+                                 " could not be opened");
+    }
+
+    uint32_t state[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                         0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+    uint64_t total_size = 0;
+
+    // process full blocks
+    std::vector<char> buffer(1 << 16);
+    std::size_t buffer_fill = 0;
+    while (file) {
+        file.read(buffer.data() + buffer_fill, buffer.size() - buffer_fill);
+        std::size_t read_size = static_cast<std::size_t>(file.gcount());
+        total_size += read_size;
+        buffer_fill += read_size;
+
+        std::size_t number_of_blocks = buffer_fill / 64;
+        for (std::size_t i = 0; i < number_of_blocks; i++) {
+            sha256_process_block(
+                state,
+                reinterpret_cast<const unsigned char *>(buffer.data()) + 64 * i);
+        }
+        std::memmove(buffer.data(), buffer.data() + 64 * number_of_blocks,
+                     buffer_fill - 64 * number_of_blocks);
+        buffer_fill -= 64 * number_of_blocks;
+    }
+
+    // pad and process final block(s)
+    unsigned char final_blocks[128] = {0};
+    std::memcpy(final_blocks, buffer.data(), buffer_fill);
+    final_blocks[buffer_fill] = 0x80;
+    std::size_t final_size = (buffer_fill < 56) ? 64 : 128;
+    uint64_t total_bits = total_size * 8;
+    for (int i = 0; i < 8; i++) {
+        final_blocks[final_size - 1 - i] =
+            static_cast<unsigned char>(total_bits >> (8 * i));
+    }
+    for (std::size_t i = 0; i < final_size; i += 64) {
+        sha256_process_block(state, final_blocks + i);
+    }
+
+    static const char hex_digits[] = "0123456789abcdef";
+    std::string checksum;
+    for (int i = 0; i < 8; i++) {
+        for (int j = 28; j >= 0; j -= 4) {
+            checksum += hex_digits[(state[i] >> j) & 0xf];
+        }
+    }
+    return checksum;
+}
+
 // verbose level argument
 std::string download_file(const char *remote_url,
                           const char *cache,
                           const int verbosity,
                           bool try_unzip,
-                          const char *prefix) {
+                          const char *prefix,
+                          const char *sha256) {
 
     // prefix_str variable of size MAX_LEN
     char prefix_str[MAX_PATH];
@@ -44,6 +270,14 @@ std::string download_file(const char *remote_url,
     strcat(filename, "/");
     strcat(filename, details::url_to_filename(remote_url).c_str());
 
+    // determine location in content-addressed cache, if checksum is given
+    std::string expected_sha256 =
+        (sha256 == nullptr) ? "" : normalize_checksum(sha256);
+    std::string content_filename =
+        expected_sha256.empty()
+            ? ""
+            : std::string(prefix_str) + "/.content/" + expected_sha256;
+
     if (verbosity > 0) {
         std::cout << "Downloading " << remote_url << " to " << filename
                   << std::endl;
@@ -59,21 +293,40 @@ std::string download_file(const char *remote_url,
         strcpy(ret_path, filename);
     }
 
+    // lock file, for access from other threads and other processes
+    boost::filesystem::create_directories(prefix_str);
+    std::string lock_filename = std::string(filename) + ".lock";
+    { std::ofstream lock_file(lock_filename, std::ios::app); }
+    std::shared_ptr<std::mutex> file_mutex = get_file_mutex(filename);
+    std::lock_guard<std::mutex> thread_lock(*file_mutex);
+    boost::interprocess::file_lock file_lock(lock_filename.c_str());
+    boost::interprocess::scoped_lock<boost::interprocess::file_lock>
+        process_lock(file_lock);
+
     // check if cache string == "true"
     if (cache != nullptr && strcmp(cache, "true") == 0) {
         // check if file exists
-        if (details::file_exists(filename)) {
+        if (is_valid_file(filename, expected_sha256)) {
             // file exists
             if (verbosity > 0) {
                 std::cout << "File cached, skipping download." << std::endl;
             }
             return ret_path;
+        } else if (!content_filename.empty() &&
+                   is_valid_file(content_filename, expected_sha256)) {
+            // file exists in content-addressed cache
+            if (verbosity > 0) {
+                std::cout << "File found in content cache, skipping download."
+                          << std::endl;
+            }
+            copy_file_atomically(content_filename, filename);
         } else {
             // file does not exist
             if (verbosity > 0) {
                 std::cout << "File not cached, downloading." << std::endl;
             }
-            details::download_file_from_source(remote_url, filename);
+            download_and_validate(remote_url, filename, expected_sha256,
+                                  content_filename, true, verbosity);
         }
     } else if (cache != nullptr && strcmp(cache, "update") == 0) {
         // check if file exists
@@ -88,13 +341,15 @@ std::string download_file(const char *remote_url,
                 std::cout << "File not cached, downloading." << std::endl;
             }
         }
-        details::download_file_from_source(remote_url, filename);
+        download_and_validate(remote_url, filename, expected_sha256,
+                              content_filename, false, verbosity);
     } else if (cache != nullptr && strcmp(cache, "false") == 0) {
         // check if file exists
         if (verbosity > 0) {
             std::cout << "Downloading file" << std::endl;
         }
-        details::download_file_from_source(remote_url, filename);
+        download_and_validate(remote_url, filename, expected_sha256,
+                              content_filename, false, verbosity);
     } else {
         throw std::invalid_argument("Invalid cache argument. Valid arguments are "
                                     "'true', 'update', and 'false'.");
@@ -108,6 +363,78 @@ std::string download_file(const char *remote_url,
     // return success
     return ret_path;
 }
+
+// download a list of files concurrently
+std::vector<std::string> download_files(
+    const std::vector<download_request> &requests,
+    const char *cache,
+    int verbosity,
+    int number_of_threads,
+    const char *prefix) {
+    std::vector<std::string> paths(requests.size());
+    std::vector<std::exception_ptr> exceptions(requests.size());
+
+    // each thread retrieves the next request that has not been started yet
+    std::atomic<std::size_t> next_request(0);
+    auto worker = [&]() {
+        for (std::size_t i = next_request++; i < requests.size();
+             i = next_request++) {
+            try {
+                const download_request &request = requests.at(i);
+                paths.at(i) = download_file(
+                    request.remote_url.c_str(), cache, verbosity,
+                    request.try_unzip, prefix,
+                    request.sha256.empty() ? nullptr : request.sha256.c_str());
+            } catch (...) {
+                exceptions.at(i) = std::current_exception();
+            }
+        }
+    };
+
+    std::size_t threads_to_use = std::min<std::size_t>(
+        std::max(number_of_threads, 1), requests.size());
+    std::vector<std::thread> threads;
+    for (std::size_t i = 1; i < threads_to_use; i++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    // rethrow first error, after all downloads have been attempted
+    for (const std::exception_ptr &exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+    return paths;
+}
+
+// start downloading a list of files in the background
+std::shared_future<std::vector<std::string>> prefetch_files(
+    const std::vector<download_request> &requests,
+    const char *cache,
+    int verbosity,
+    int number_of_threads,
+    const char *prefix) {
+    // copy arguments, which must remain valid until downloads are completed
+    std::string cache_str = (cache == nullptr) ? "" : cache;
+    bool has_prefix = (prefix != nullptr);
+    std::string prefix_str = has_prefix ? prefix : "";
+
+    return std::async(std::launch::async,
+                      [=]() {
+                          return download_files(
+                              requests,
+                              cache_str.c_str(),
+                              verbosity,
+                              number_of_threads,
+                              has_prefix ? prefix_str.c_str() : nullptr);
+                      })
+        .share();
+}
+
 } // namespace data
 } // namespace utils
 } // namespace tudat
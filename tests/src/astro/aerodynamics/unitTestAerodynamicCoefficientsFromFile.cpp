@@ -14,6 +14,7 @@
 #include <limits>
 
 
+#include <boost/filesystem.hpp>
 #include <boost/test/tools/floating_point_comparison.hpp>
 #include <boost/test/unit_test.hpp>
 
@@ -425,6 +426,74 @@ BOOST_AUTO_TEST_CASE( testAerodynamicCoefficientsFromFile )
     }
 }
 
+//! Test whether aerodynamic coefficients loaded from binary coefficient table are identical to those from text files
+BOOST_AUTO_TEST_CASE( testAerodynamicCoefficientsFromBinaryFile )
+{
+    using namespace simulation_setup;
+    using namespace aerodynamics;
+
+    SystemOfBodies bodies;
+    bodies.createEmptyBody( "Vehicle" );
+
+    std::map< int, std::string > forceCoefficientFiles;
+    forceCoefficientFiles[ 0 ] = tudat::paths::getTudatTestDataPath( ) + "/aurora_CD.txt";
+    forceCoefficientFiles[ 2 ] = tudat::paths::getTudatTestDataPath( ) + "/aurora_CL.txt";
+    std::map< int, std::string > momentCoefficientFiles;
+    momentCoefficientFiles[ 1 ] = tudat::paths::getTudatTestDataPath( ) + "/aurora_Cm.txt";
+
+    std::string binaryFile =
+            ( boost::filesystem::temp_directory_path( ) /
+              boost::filesystem::unique_path( "tudat_aerodynamic_coefficients_%%%%-%%%%.bin" ) ).string( );
+    input_output::convertAerodynamicCoefficientFilesToBinaryTable(
+                forceCoefficientFiles, momentCoefficientFiles, binaryFile );
+
+    // Create coefficient interfaces from text and binary files
+    std::vector< AerodynamicCoefficientsIndependentVariables > independentVariableNames =
+    { mach_number_dependent, angle_of_attack_dependent };
+    std::shared_ptr< AerodynamicCoefficientInterface > textCoefficientInterface =
+            createAerodynamicCoefficientInterface(
+                readTabulatedAerodynamicCoefficientsFromFiles(
+                    forceCoefficientFiles, momentCoefficientFiles, 60.734, 600.0, independentVariableNames ),
+                "Vehicle", bodies );
+    std::shared_ptr< AerodynamicCoefficientInterface > binaryCoefficientInterface =
+            createAerodynamicCoefficientInterface(
+                readTabulatedAerodynamicCoefficientsFromBinaryFile(
+                    binaryFile, 60.734, 600.0, independentVariableNames ),
+                "Vehicle", bodies );
+    std::shared_ptr< AerodynamicCoefficientInterface > secondBinaryCoefficientInterface =
+            createAerodynamicCoefficientInterface(
+                readTabulatedAerodynamicCoefficientsFromBinaryFile(
+                    binaryFile, 60.734, 600.0, independentVariableNames ),
+                "Vehicle", bodies );
+
+    // Compare coefficients inside and outside of the tabulated range
+    for( double machNumber = 0.5; machNumber < 25.0; machNumber += 1.7 )
+    {
+        for( double angleOfAttack = -0.3; angleOfAttack < 0.8; angleOfAttack += 0.07 )
+        {
+            std::vector< double > independentVariables = { machNumber, angleOfAttack };
+            textCoefficientInterface->updateCurrentCoefficients( independentVariables );
+            binaryCoefficientInterface->updateCurrentCoefficients( independentVariables );
+            secondBinaryCoefficientInterface->updateCurrentCoefficients( independentVariables );
+            for( unsigned int k = 0; k < 3; k++ )
+            {
+                BOOST_CHECK_SMALL( binaryCoefficientInterface->getCurrentForceCoefficients( )( k ) -
+                                   textCoefficientInterface->getCurrentForceCoefficients( )( k ), 1.0E-14 );
+                BOOST_CHECK_SMALL( binaryCoefficientInterface->getCurrentMomentCoefficients( )( k ) -
+                                   textCoefficientInterface->getCurrentMomentCoefficients( )( k ), 1.0E-14 );
+                BOOST_CHECK_EQUAL( secondBinaryCoefficientInterface->getCurrentForceCoefficients( )( k ),
+                                   binaryCoefficientInterface->getCurrentForceCoefficients( )( k ) );
+            }
+        }
+    }
+
+    // Check that inconsistent independent variables are rejected
+    BOOST_CHECK_THROW( readTabulatedAerodynamicCoefficientsFromBinaryFile(
+                           binaryFile, 60.734, 600.0, { mach_number_dependent } ), std::runtime_error );
+
+    boost::filesystem::remove( binaryFile );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
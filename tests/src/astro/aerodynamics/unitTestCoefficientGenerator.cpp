@@ -245,7 +245,9 @@ BOOST_AUTO_TEST_CASE( testAerodynamicCoefficientGeneratorHypersonicLocalInclinat
     }
 }
 
-std::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterface( )
+std::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterface(
+        const std::vector< std::vector< int > >& expansionAndCompressionMethods = { { 1, 5, 5, 1 }, { 6, 3, 3, 3 } },
+        const int numberOfThreads = 1 )
 {
 
     // Create test capsule.
@@ -288,22 +290,11 @@ std::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterf
     independentVariableDataPoints[ 1 ] = angleOfAttackPoints;
     independentVariableDataPoints[ 2 ] =
             getDefaultHypersonicLocalInclinationAngleOfSideslipPoints( );
-    std::vector< std::vector< int > > selectedMethods( 2, std::vector< int >( 4 ));
-
-    selectedMethods[ 0 ][ 0 ] = 1;
-    selectedMethods[ 0 ][ 1 ] = 5;
-    selectedMethods[ 0 ][ 2 ] = 5;
-    selectedMethods[ 0 ][ 3 ] = 1;
-    selectedMethods[ 1 ][ 0 ] = 6;
-    selectedMethods[ 1 ][ 1 ] = 3;
-    selectedMethods[ 1 ][ 2 ] = 3;
-    selectedMethods[ 1 ][ 3 ] = 3;
-
     // Create analysis object and capsule database.
     return std::make_shared< HypersonicLocalInclinationAnalysis >(
                 independentVariableDataPoints, capsule, numberOfLines, numberOfPoints,
-                invertOrders, selectedMethods, PI * pow( capsule->getMiddleRadius( ), 2.0 ),
-                3.9116, momentReference );
+                invertOrders, expansionAndCompressionMethods, PI * pow( capsule->getMiddleRadius( ), 2.0 ),
+                3.9116, momentReference, false, numberOfThreads );
 }
 
 //! Apollo capsule test case.
@@ -392,6 +383,74 @@ BOOST_AUTO_TEST_CASE( testApolloCapsule )
                        toleranceAerodynamicCoefficients5 );
 }
 
+//! Test parallel generation, and recomputation for modified part methods, of the Apollo capsule coefficients.
+BOOST_AUTO_TEST_CASE( testApolloCapsuleParallelAndIncrementalGeneration )
+{
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > serialCoefficientInterface =
+            getApolloCoefficientInterface( );
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > parallelCoefficientInterface =
+            getApolloCoefficientInterface( { { 1, 5, 5, 1 }, { 6, 3, 3, 3 } }, 4 );
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > modifiedCoefficientInterface =
+            getApolloCoefficientInterface( { { 1, 0, 5, 1 }, { 6, 4, 3, 3 } } );
+
+    BOOST_CHECK_EQUAL( parallelCoefficientInterface->getNumberOfThreads( ), 4 );
+    BOOST_CHECK_THROW( parallelCoefficientInterface->setNumberOfThreads( 0 ), std::runtime_error );
+    BOOST_CHECK_THROW( parallelCoefficientInterface->setSelectedMethods( 4, 1, 1 ), std::runtime_error );
+
+    // Modify methods of a single part of the parallel analysis, to match those of the modified analysis
+    parallelCoefficientInterface->setSelectedMethods( 1, 0, 4 );
+    BOOST_CHECK( parallelCoefficientInterface->getSelectedMethods( ) ==
+                 modifiedCoefficientInterface->getSelectedMethods( ) );
+
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > secondParallelCoefficientInterface =
+            getApolloCoefficientInterface( { { 1, 5, 5, 1 }, { 6, 3, 3, 3 } }, 3 );
+
+    boost::array< int, 3 > independentVariables;
+    for( int i = 0; i < serialCoefficientInterface->getNumberOfValuesOfIndependentVariable( 0 ); i++ )
+    {
+        independentVariables[ 0 ] = i;
+        for( int j = 0; j < serialCoefficientInterface->getNumberOfValuesOfIndependentVariable( 1 ); j++ )
+        {
+            independentVariables[ 1 ] = j;
+            for( int k = 0; k < serialCoefficientInterface->getNumberOfValuesOfIndependentVariable( 2 ); k++ )
+            {
+                independentVariables[ 2 ] = k;
+
+                // Check that results are independent of number of threads
+                Vector6d serialCoefficients =
+                        serialCoefficientInterface->getAerodynamicCoefficientsDataPoint( independentVariables );
+                Vector6d parallelCoefficients =
+                        secondParallelCoefficientInterface->getAerodynamicCoefficientsDataPoint( independentVariables );
+                for( int l = 0; l < 6; l++ )
+                {
+                    BOOST_CHECK_EQUAL( serialCoefficients( l ), parallelCoefficients( l ) );
+                }
+
+                // Check that recomputed coefficients match those of analysis created with modified methods
+                Vector6d modifiedCoefficients =
+                        modifiedCoefficientInterface->getAerodynamicCoefficientsDataPoint( independentVariables );
+                Vector6d recomputedCoefficients =
+                        parallelCoefficientInterface->getAerodynamicCoefficientsDataPoint( independentVariables );
+                for( int l = 0; l < 6; l++ )
+                {
+                    BOOST_CHECK_SMALL( modifiedCoefficients( l ) - recomputedCoefficients( l ), 1.0E-14 );
+                }
+                BOOST_CHECK( ( modifiedCoefficients - serialCoefficients ).norm( ) > 0.0 );
+            }
+        }
+    }
+
+    // Check that interpolator is updated after modifying methods
+    std::vector< double > independentVariablesVector = { 15.0, -10.0 * PI / 180.0, 0.5 * PI / 180.0 };
+    modifiedCoefficientInterface->updateCurrentCoefficients( independentVariablesVector );
+    parallelCoefficientInterface->updateCurrentCoefficients( independentVariablesVector );
+    for( int l = 0; l < 6; l++ )
+    {
+        BOOST_CHECK_SMALL( modifiedCoefficientInterface->getCurrentAerodynamicCoefficients( )( l ) -
+                           parallelCoefficientInterface->getCurrentAerodynamicCoefficients( )( l ), 1.0E-14 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -1102,6 +1102,166 @@ BOOST_AUTO_TEST_CASE( test_nrlmise_InputFunction_with_adjustment )
     BOOST_CHECK_CLOSE_FRACTION(verificationData[5]*1000 , computedDensity , 1E-11);
 }
 
+//! Test tabulated evaluation of NRLMSISE-00 model against direct evaluation
+BOOST_AUTO_TEST_CASE( testNRLMSISE00AtmosphereTabulation )
+{
+    using tudat::aerodynamics::NRLMSISE00TabulationSettings;
+
+    // Define input function with local solar time consistent with longitude
+    double f107 = 150.0;
+    std::function< NRLMSISE00Input( double, double, double, double ) > inputFunction =
+            [ & ]( double, double longitude, double, double )
+    {
+        NRLMSISE00Input input = gen_data;
+        input.f107 = f107;
+        input.localSolarTime = input.secondOfTheDay / 3600.0 + longitude * 180.0 / PI / 15.0;
+        return input;
+    };
+
+    NRLMSISE00Atmosphere directModel( inputFunction );
+    NRLMSISE00Atmosphere tabulatedModel( inputFunction );
+    tabulatedModel.setTabulationSettings(
+                std::make_shared< NRLMSISE00TabulationSettings >( 200.0E3, 600.0E3, 2.0E3, 1.0 * PI / 180.0, 0.25 ) );
+
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        // Check that grid is reset when space weather changes
+        if( test == 1 )
+        {
+            f107 = 250.0;
+        }
+
+        for( unsigned int i = 0; i < 50; i++ )
+        {
+            double altitude = 210.0E3 + static_cast< double >( i ) * 7.7E3;
+            double longitude = -3.0 + static_cast< double >( i ) * 0.12;
+            double latitude = -1.2 + static_cast< double >( i ) * 0.047;
+            double time = static_cast< double >( i ) * 60.0;
+
+            BOOST_CHECK_CLOSE_FRACTION( tabulatedModel.getDensity( altitude, longitude, latitude, time ),
+                                        directModel.getDensity( altitude, longitude, latitude, time ), 1.0E-2 );
+            BOOST_CHECK_CLOSE_FRACTION( tabulatedModel.getTemperature( altitude, longitude, latitude, time ),
+                                        directModel.getTemperature( altitude, longitude, latitude, time ), 1.0E-3 );
+        }
+
+        // Check error estimate of tabulation
+        double maximumTabulationError = tabulatedModel.computeMaximumTabulatedDensityError( );
+        BOOST_CHECK( maximumTabulationError > 0.0 );
+        BOOST_CHECK( maximumTabulationError < 1.0E-2 );
+    }
+
+    // Check that model is evaluated directly outside of grid
+    BOOST_CHECK_EQUAL( tabulatedModel.getDensity( 150.0E3, 0.1, 0.2, 0.0 ),
+                       directModel.getDensity( 150.0E3, 0.1, 0.2, 0.0 ) );
+}
+
+//! Test multi-point evaluation of NRLMSISE-00 model against single-point evaluation
+BOOST_AUTO_TEST_CASE( testNRLMSISE00AtmosphereMultiPoint )
+{
+    using namespace tudat::input_output::solar_activity;
+    using tudat::aerodynamics::NRLMSISE00MultiPointOutput;
+    using tudat::aerodynamics::NRLMSISE00TabulationSettings;
+
+    // Create solar activity data for two consecutive days
+    double firstJulianDay = tudat::basic_astrodynamics::convertCalendarDateToJulianDay< double >(
+                2010, 3, 5, 0, 0, 0.0 );
+    SolarActivityDataMap solarActivityData;
+    for( unsigned int day = 0; day < 2; day++ )
+    {
+        SolarActivityDataPtr dailyData = std::make_shared< SolarActivityData >( );
+        dailyData->year = 2010;
+        dailyData->fluxQualifier = 0;
+        dailyData->solarRadioFlux107Observed = 120.0 + 30.0 * day;
+        dailyData->centered81DaySolarRadioFlux107Observed = 110.0 + 5.0 * day;
+        dailyData->planetaryEquivalentAmplitudeAverage = 10.0 + 4.0 * day;
+        dailyData->planetaryEquivalentAmplitudeVector = Eigen::VectorXd::Constant( 8, 10.0 + 4.0 * day );
+        solarActivityData[ firstJulianDay + day ] = dailyData;
+    }
+    double initialTime = tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch(
+                firstJulianDay, tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+
+    // Define input function with local solar time consistent with longitude
+    std::function< NRLMSISE00Input( double, double, double, double ) > inputFunction =
+            [ & ]( double, double longitude, double, double )
+    {
+        NRLMSISE00Input input = gen_data;
+        input.localSolarTime = input.secondOfTheDay / 3600.0 + longitude * 180.0 / PI / 15.0;
+        return input;
+    };
+
+    // Define points, in groups of points at the same epoch
+    int numberOfPoints = 40;
+    Eigen::VectorXd altitudes = Eigen::VectorXd::LinSpaced( numberOfPoints, 150.0E3, 700.0E3 );
+    Eigen::VectorXd longitudes = Eigen::VectorXd::LinSpaced( numberOfPoints, -3.0, 3.0 );
+    Eigen::VectorXd latitudes = Eigen::VectorXd::LinSpaced( numberOfPoints, -1.4, 1.4 );
+    Eigen::VectorXd times = Eigen::VectorXd( numberOfPoints );
+    for( int i = 0; i < numberOfPoints; i++ )
+    {
+        times( i ) = initialTime + static_cast< double >( i / 4 ) * 3.0 * 3600.0;
+    }
+
+    for( unsigned int test = 0; test < 3; test++ )
+    {
+        std::shared_ptr< NRLMSISE00Atmosphere > multiPointModel;
+        std::shared_ptr< NRLMSISE00Atmosphere > singlePointModel;
+        if( test == 0 )
+        {
+            multiPointModel = std::make_shared< NRLMSISE00Atmosphere >( inputFunction );
+            singlePointModel = std::make_shared< NRLMSISE00Atmosphere >( inputFunction );
+        }
+        else
+        {
+            multiPointModel = std::make_shared< NRLMSISE00Atmosphere >( solarActivityData );
+            singlePointModel = std::make_shared< NRLMSISE00Atmosphere >( solarActivityData );
+        }
+
+        // Use tabulated evaluation for both models
+        if( test == 2 )
+        {
+            multiPointModel->setTabulationSettings( std::make_shared< NRLMSISE00TabulationSettings >( ) );
+            singlePointModel->setTabulationSettings( std::make_shared< NRLMSISE00TabulationSettings >( ) );
+        }
+
+        NRLMSISE00MultiPointOutput output;
+        multiPointModel->computeMultiPointProperties( altitudes, longitudes, latitudes, times, output );
+
+        for( int i = 0; i < numberOfPoints; i++ )
+        {
+            double altitude = altitudes( i ), longitude = longitudes( i ), latitude = latitudes( i ), time = times( i );
+            BOOST_CHECK_EQUAL( output.densities_( i ),
+                               singlePointModel->getDensity( altitude, longitude, latitude, time ) );
+            BOOST_CHECK_EQUAL( output.temperatures_( i ),
+                               singlePointModel->getTemperature( altitude, longitude, latitude, time ) );
+            BOOST_CHECK_EQUAL( output.exosphericTemperatures_( i ),
+                               singlePointModel->getFullOutput( altitude, longitude, latitude, time ).second.at( 0 ) );
+            BOOST_CHECK_EQUAL( output.pressures_( i ),
+                               singlePointModel->getPressure( altitude, longitude, latitude, time ) );
+            BOOST_CHECK_EQUAL( output.meanMolarMasses_( i ),
+                               singlePointModel->getMeanMolarMass( altitude, longitude, latitude, time ) );
+            BOOST_CHECK_EQUAL( output.speedsOfSound_( i ),
+                               singlePointModel->getSpeedOfSound( altitude, longitude, latitude, time ) );
+            BOOST_CHECK_EQUAL( output.meanFreePaths_( i ),
+                               singlePointModel->getMeanFreePath( altitude, longitude, latitude, time ) );
+            std::vector< double > numberDensities =
+                    singlePointModel->getNumberDensities( altitude, longitude, latitude, time );
+            for( unsigned int j = 0; j < 8; j++ )
+            {
+                BOOST_CHECK_EQUAL( output.numberDensities_( i, j ), numberDensities.at( j ) );
+            }
+        }
+
+        // Check that single-point evaluation of multi-point model is not affected
+        BOOST_CHECK_EQUAL( multiPointModel->getDensity( altitudes( 0 ), longitudes( 0 ), latitudes( 0 ), times( 0 ) ),
+                           singlePointModel->getDensity( altitudes( 0 ), longitudes( 0 ), latitudes( 0 ), times( 0 ) ) );
+    }
+
+    // Check that inconsistent input is rejected
+    NRLMSISE00Atmosphere atmosphereModel( inputFunction );
+    NRLMSISE00MultiPointOutput output;
+    BOOST_CHECK_THROW( atmosphereModel.computeMultiPointProperties(
+                           altitudes, longitudes, latitudes, times.segment( 0, 10 ), output ), std::runtime_error );
+}
+
 BOOST_AUTO_TEST_CASE( test_nrlmise_FullFileLoad )
 {
 
@@ -251,6 +251,107 @@ BOOST_AUTO_TEST_CASE( testTabulatedDragCoefficient )
 
 }
 
+//! Check that tabulated force and moment coefficients, evaluated through a single (concatenated) interpolator, match
+//! separate interpolation of the force and moment coefficient tables.
+BOOST_AUTO_TEST_CASE( testTabulatedForceAndMomentCoefficientConcatenation )
+{
+    using namespace simulation_setup;
+    using namespace aerodynamics;
+    using namespace interpolators;
+
+    // Define 2-D coefficient tables (Mach number, angle of attack)
+    std::vector< std::vector< double > > independentVariables =
+    { { 2.0, 4.0, 6.0, 8.0 }, { -0.2, 0.0, 0.1, 0.3, 0.5 } };
+    boost::multi_array< Eigen::Vector3d, 2 > forceCoefficients( boost::extents[ 4 ][ 5 ] );
+    boost::multi_array< Eigen::Vector3d, 2 > momentCoefficients( boost::extents[ 4 ][ 5 ] );
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        for( unsigned int j = 0; j < 5; j++ )
+        {
+            const double machNumber = independentVariables.at( 0 ).at( i );
+            const double angleOfAttack = independentVariables.at( 1 ).at( j );
+            forceCoefficients[ i ][ j ] = Eigen::Vector3d(
+                        1.0 + 0.1 * machNumber * angleOfAttack, 0.01 * machNumber, 2.0 * std::sin( angleOfAttack ) );
+            momentCoefficients[ i ][ j ] = Eigen::Vector3d(
+                        0.0, -0.3 * angleOfAttack * angleOfAttack + 0.02 * machNumber, 0.05 * angleOfAttack );
+        }
+    }
+
+    std::vector< AerodynamicCoefficientsIndependentVariables > independentVariableNames =
+    { mach_number_dependent, angle_of_attack_dependent };
+    std::shared_ptr< AerodynamicCoefficientInterface > coefficientInterface =
+            createTabulatedCoefficientAerodynamicCoefficientInterface< 2 >(
+                independentVariables, forceCoefficients, momentCoefficients, independentVariableNames,
+                1.0, 1.0, Eigen::Vector3d::Zero( ) );
+    std::shared_ptr< ControlSurfaceIncrementAerodynamicInterface > controlSurfaceInterface =
+            createTabulatedControlSurfaceIncrementAerodynamicCoefficientInterface< 2 >(
+                independentVariables, forceCoefficients, momentCoefficients,
+                { mach_number_dependent, control_surface_deflection_dependent } );
+
+    // Create separate interpolators for force and moment coefficients
+    MultiLinearInterpolator< double, Eigen::Vector3d, 2 > forceInterpolator(
+                independentVariables, forceCoefficients, huntingAlgorithm,
+                std::vector< BoundaryInterpolationType >( 2, use_boundary_value ) );
+    MultiLinearInterpolator< double, Eigen::Vector3d, 2 > momentInterpolator(
+                independentVariables, momentCoefficients, huntingAlgorithm,
+                std::vector< BoundaryInterpolationType >( 2, use_boundary_value ) );
+    MultiLinearInterpolator< double, Eigen::Vector3d, 2 > controlSurfaceForceInterpolator(
+                independentVariables, forceCoefficients );
+    MultiLinearInterpolator< double, Eigen::Vector3d, 2 > controlSurfaceMomentInterpolator(
+                independentVariables, momentCoefficients );
+
+    for( double machNumber = 1.0; machNumber < 9.0; machNumber += 0.37 )
+    {
+        for( double angleOfAttack = -0.25; angleOfAttack < 0.55; angleOfAttack += 0.033 )
+        {
+            std::vector< double > currentIndependentVariables = { machNumber, angleOfAttack };
+            coefficientInterface->updateCurrentCoefficients( currentIndependentVariables );
+            controlSurfaceInterface->updateCurrentCoefficients( currentIndependentVariables );
+
+            Eigen::Vector3d expectedForceCoefficients = forceInterpolator.interpolate( currentIndependentVariables );
+            Eigen::Vector3d expectedMomentCoefficients = momentInterpolator.interpolate( currentIndependentVariables );
+            Eigen::Vector3d expectedControlSurfaceForceCoefficients =
+                    controlSurfaceForceInterpolator.interpolate( currentIndependentVariables );
+            Eigen::Vector3d expectedControlSurfaceMomentCoefficients =
+                    controlSurfaceMomentInterpolator.interpolate( currentIndependentVariables );
+            for( unsigned int k = 0; k < 3; k++ )
+            {
+                BOOST_CHECK_SMALL( coefficientInterface->getCurrentForceCoefficients( )( k ) -
+                                   expectedForceCoefficients( k ), 1.0E-14 );
+                BOOST_CHECK_SMALL( coefficientInterface->getCurrentMomentCoefficients( )( k ) -
+                                   expectedMomentCoefficients( k ), 1.0E-14 );
+                BOOST_CHECK_SMALL( controlSurfaceInterface->getCurrentForceCoefficients( )( k ) -
+                                   expectedControlSurfaceForceCoefficients( k ), 1.0E-14 );
+                BOOST_CHECK_SMALL( controlSurfaceInterface->getCurrentMomentCoefficients( )( k ) -
+                                   expectedControlSurfaceMomentCoefficients( k ), 1.0E-14 );
+            }
+        }
+    }
+
+    // Check that univariate tables use the moment coefficient table for the moment coefficients
+    std::vector< double > machNumbers = { 1.0, 3.0, 5.0 };
+    std::vector< Eigen::Vector3d > univariateForceCoefficients =
+    { Eigen::Vector3d( 1.0, 0.0, 0.1 ), Eigen::Vector3d( 1.2, 0.0, 0.3 ), Eigen::Vector3d( 1.5, 0.0, 0.2 ) };
+    std::vector< Eigen::Vector3d > univariateMomentCoefficients =
+    { Eigen::Vector3d( 0.0, -0.1, 0.0 ), Eigen::Vector3d( 0.0, -0.4, 0.0 ), Eigen::Vector3d( 0.0, 0.2, 0.0 ) };
+    std::shared_ptr< AerodynamicCoefficientInterface > univariateCoefficientInterface =
+            createUnivariateTabulatedCoefficientAerodynamicCoefficientInterface(
+                std::make_shared< TabulatedAerodynamicCoefficientSettings< 1 > >(
+                    machNumbers, univariateForceCoefficients, univariateMomentCoefficients, 1.0, 1.0,
+                    Eigen::Vector3d::Zero( ), mach_number_dependent ), "Vehicle" );
+
+    univariateCoefficientInterface->updateCurrentCoefficients( { 4.0 } );
+    Eigen::Vector3d expectedForceCoefficients = 0.5 * ( univariateForceCoefficients.at( 1 ) + univariateForceCoefficients.at( 2 ) );
+    Eigen::Vector3d expectedMomentCoefficients = 0.5 * ( univariateMomentCoefficients.at( 1 ) + univariateMomentCoefficients.at( 2 ) );
+    for( unsigned int k = 0; k < 3; k++ )
+    {
+        BOOST_CHECK_SMALL( univariateCoefficientInterface->getCurrentForceCoefficients( )( k ) -
+                           expectedForceCoefficients( k ), 1.0E-15 );
+        BOOST_CHECK_SMALL( univariateCoefficientInterface->getCurrentMomentCoefficients( )( k ) -
+                           expectedMomentCoefficients( k ), 1.0E-15 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
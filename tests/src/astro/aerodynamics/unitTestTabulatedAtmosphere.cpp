@@ -19,8 +19,10 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MAIN
 
+#include <fstream>
 #include <limits>
 
+#include <boost/filesystem.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include "tudat/astro/basic_astro/unitConversions.h"
@@ -408,6 +410,157 @@ BOOST_AUTO_TEST_CASE( testTabulatedAtmosphereExtraVariables )
     BOOST_CHECK_CLOSE_FRACTION( 1.7, tabulatedAtmosphere.getRatioOfSpecificHeats( altitude ), 1.0e-4 );
 }
 
+//! Check that the combined interpolation of all dependent variables matches separate interpolation of each variable.
+BOOST_AUTO_TEST_CASE( testTabulatedAtmosphereCombinedInterpolation )
+{
+    using namespace interpolators;
+
+    // Define (non-equidistant) altitudes and equidistant latitudes of tables
+    std::vector< std::vector< double > > independentVariables( 2 );
+    for ( unsigned int i = 0; i < 30; i++ )
+    {
+        independentVariables[ 0 ].push_back( 1.0E3 * static_cast< double >( i * i ) );
+    }
+    for ( unsigned int i = 0; i < 13; i++ )
+    {
+        independentVariables[ 1 ].push_back( -1.5 + 0.25 * static_cast< double >( i ) );
+    }
+
+    // Define dependent variables (density, pressure, temperature, gas constant)
+    std::vector< boost::multi_array< double, 2 > > dependentVariableData(
+                4, boost::multi_array< double, 2 >( boost::extents[ 30 ][ 13 ] ) );
+    for ( unsigned int i = 0; i < 30; i++ )
+    {
+        for ( unsigned int j = 0; j < 13; j++ )
+        {
+            double altitude = independentVariables[ 0 ][ i ];
+            double latitude = independentVariables[ 1 ][ j ];
+            dependentVariableData[ 0 ][ i ][ j ] = 1.2 * std::exp( -altitude / 8.0E3 ) * ( 1.0 + 0.1 * std::sin( latitude ) );
+            dependentVariableData[ 1 ][ i ][ j ] = 1.0E5 * std::exp( -altitude / 7.5E3 ) * ( 1.0 + 0.2 * latitude );
+            dependentVariableData[ 2 ][ i ][ j ] = 288.0 - 1.0E-3 * altitude + 10.0 * std::cos( latitude );
+            dependentVariableData[ 3 ][ i ][ j ] = 287.0 + 1.0E-4 * altitude + latitude;
+        }
+    }
+
+    // Write tables to files
+    std::string fileNameBase = ( boost::filesystem::temp_directory_path( ) /
+                                 boost::filesystem::unique_path( "tudat_tabulated_atmosphere_%%%%-%%%%" ) ).string( );
+    std::map< int, std::string > oneDimensionalFile = { { 0, fileNameBase + "_1d.dat" } };
+    std::map< int, std::string > twoDimensionalFiles;
+    {
+        std::ofstream oneDimensionalStream( oneDimensionalFile.at( 0 ) );
+        oneDimensionalStream.precision( 17 );
+        for ( unsigned int i = 0; i < 30; i++ )
+        {
+            oneDimensionalStream << independentVariables[ 0 ][ i ];
+            for ( unsigned int k = 0; k < 4; k++ )
+            {
+                oneDimensionalStream << " " << dependentVariableData[ k ][ i ][ 0 ];
+            }
+            oneDimensionalStream << std::endl;
+        }
+
+        for ( unsigned int k = 0; k < 4; k++ )
+        {
+            twoDimensionalFiles[ k ] = fileNameBase + "_2d_" + std::to_string( k ) + ".dat";
+            std::ofstream twoDimensionalStream( twoDimensionalFiles.at( k ) );
+            twoDimensionalStream.precision( 17 );
+            twoDimensionalStream << "2" << std::endl;
+            for ( unsigned int d = 0; d < 2; d++ )
+            {
+                for ( unsigned int i = 0; i < independentVariables[ d ].size( ); i++ )
+                {
+                    twoDimensionalStream << independentVariables[ d ][ i ] << " ";
+                }
+                twoDimensionalStream << std::endl;
+            }
+            for ( unsigned int i = 0; i < 30; i++ )
+            {
+                for ( unsigned int j = 0; j < 13; j++ )
+                {
+                    twoDimensionalStream << dependentVariableData[ k ][ i ][ j ] << " ";
+                }
+                twoDimensionalStream << std::endl;
+            }
+        }
+    }
+
+    // Create atmospheres
+    std::vector< aerodynamics::AtmosphereDependentVariables > dependentVariables =
+    { aerodynamics::density_dependent_atmosphere, aerodynamics::pressure_dependent_atmosphere,
+      aerodynamics::temperature_dependent_atmosphere, aerodynamics::gas_constant_dependent_atmosphere };
+    aerodynamics::TabulatedAtmosphere oneDimensionalAtmosphere(
+                oneDimensionalFile.at( 0 ), dependentVariables, physical_constants::SPECIFIC_GAS_CONSTANT_AIR, 1.4,
+                use_boundary_value );
+    aerodynamics::TabulatedAtmosphere twoDimensionalAtmosphere(
+                twoDimensionalFiles, { aerodynamics::altitude_dependent_atmosphere,
+                                       aerodynamics::latitude_dependent_atmosphere },
+                dependentVariables, { use_boundary_value, use_default_value }, { 0.0, 1.0, 2.0, 3.0 } );
+
+    for ( unsigned int k = 0; k < 4; k++ )
+    {
+        boost::filesystem::remove( twoDimensionalFiles.at( k ) );
+    }
+    boost::filesystem::remove( oneDimensionalFile.at( 0 ) );
+
+    // Create separate interpolators for each dependent variable
+    std::vector< std::shared_ptr< OneDimensionalInterpolator< double, double > > > oneDimensionalInterpolators;
+    std::vector< std::shared_ptr< MultiLinearInterpolator< double, double, 2 > > > twoDimensionalInterpolators;
+    for ( unsigned int k = 0; k < 4; k++ )
+    {
+        std::vector< double > oneDimensionalData;
+        for ( unsigned int i = 0; i < 30; i++ )
+        {
+            oneDimensionalData.push_back( dependentVariableData[ k ][ i ][ 0 ] );
+        }
+        oneDimensionalInterpolators.push_back( std::make_shared< CubicSplineInterpolatorDouble >(
+                                                   independentVariables[ 0 ], oneDimensionalData, huntingAlgorithm,
+                                                   use_boundary_value ) );
+        twoDimensionalInterpolators.push_back( std::make_shared< MultiLinearInterpolator< double, double, 2 > >(
+                                                   independentVariables, dependentVariableData[ k ], huntingAlgorithm,
+                                                   std::vector< BoundaryInterpolationType >{
+                                                       use_boundary_value, use_default_value },
+                                                   std::vector< std::pair< double, double > >{
+                                                       std::make_pair( 0.0, 0.0 ),
+                                                       std::make_pair( double( k ), double( k ) ) } ) );
+    }
+
+    // Compare atmospheres to separate interpolators (including points outside of tables)
+    for ( unsigned int i = 0; i < 100; i++ )
+    {
+        double altitude = -2.0E3 + 9.0E3 * static_cast< double >( i );
+        double latitude = -1.6 + 0.033 * static_cast< double >( i );
+
+        std::vector< double > oneDimensionalResults =
+        { oneDimensionalAtmosphere.getDensity( altitude, 0.0, latitude ),
+          oneDimensionalAtmosphere.getPressure( altitude, 0.0, latitude ),
+          oneDimensionalAtmosphere.getTemperature( altitude, 0.0, latitude ),
+          oneDimensionalAtmosphere.getSpecificGasConstant( altitude, 0.0, latitude ) };
+        std::vector< double > twoDimensionalResults =
+        { twoDimensionalAtmosphere.getDensity( altitude, 0.0, latitude ),
+          twoDimensionalAtmosphere.getPressure( altitude, 0.0, latitude ),
+          twoDimensionalAtmosphere.getTemperature( altitude, 0.0, latitude ),
+          twoDimensionalAtmosphere.getSpecificGasConstant( altitude, 0.0, latitude ) };
+
+        for ( unsigned int k = 0; k < 4; k++ )
+        {
+            BOOST_CHECK_CLOSE_FRACTION( oneDimensionalResults.at( k ),
+                                        oneDimensionalInterpolators.at( k )->interpolate( altitude ),
+                                        std::numeric_limits< double >::epsilon( ) );
+            BOOST_CHECK_CLOSE_FRACTION( twoDimensionalResults.at( k ),
+                                        twoDimensionalInterpolators.at( k )->interpolate( { altitude, latitude } ),
+                                        std::numeric_limits< double >::epsilon( ) );
+        }
+
+        // Check that properties are not affected by variables on which atmosphere does not depend
+        BOOST_CHECK_EQUAL( oneDimensionalAtmosphere.getDensity( altitude, 0.3, latitude + 0.1, 1.0E4 ),
+                           oneDimensionalResults.at( 0 ) );
+
+        // Check that constant properties are retained
+        BOOST_CHECK_EQUAL( twoDimensionalAtmosphere.getRatioOfSpecificHeats( altitude, 0.0, latitude ), 1.4 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
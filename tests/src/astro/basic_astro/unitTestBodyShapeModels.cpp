@@ -287,6 +287,28 @@ BOOST_AUTO_TEST_CASE( testPolyhedronShapeModel )
 
     }
 
+    // Test that consecutive queries (which start the search from the previous closest vertex) give the same altitude as
+    // a single query
+    for ( bool justComputeDistanceToVertices : { true, false } )
+    {
+        PolyhedronBodyShapeModel shapeModel = PolyhedronBodyShapeModel (
+            verticesCoordinates, verticesDefiningEachFacet, true, justComputeDistanceToVertices );
+
+        for ( unsigned int i = 0; i < 200; ++i )
+        {
+            // Positions along trajectory passing over, and through, the polyhedron
+            double angle = 0.1 * static_cast< double >( i );
+            Eigen::Vector3d testCartesianPosition;
+            testCartesianPosition << 10.0 + 15.0 * std::cos( angle ), 5.0 + 8.0 * std::sin( angle ),
+                    5.0 + 7.0 * std::sin( 0.3 * angle );
+
+            PolyhedronBodyShapeModel singleQueryShapeModel = PolyhedronBodyShapeModel (
+                verticesCoordinates, verticesDefiningEachFacet, true, justComputeDistanceToVertices );
+            BOOST_CHECK_EQUAL( shapeModel.getAltitude( testCartesianPosition ),
+                               singleQueryShapeModel.getAltitude( testCartesianPosition ) );
+        }
+    }
+
 }
 
 BOOST_AUTO_TEST_CASE( testHybridShapeModel )
@@ -429,6 +429,33 @@ BOOST_AUTO_TEST_CASE( test_convertMeanAnomalyToEccentricAnomaly_specificInitialG
                        1.0E-13 );
 }
 
+//! Test 8: Test batch conversion against single conversions, for random (including near-parabolic) orbits.
+BOOST_AUTO_TEST_CASE( test_convertMeanAnomaliesToEccentricAnomalies )
+{
+    boost::mt19937 randomNumbergenerator( 42 );
+    boost::random::uniform_real_distribution< > distribution( 0.0, 1.0 );
+
+    const int numberOfSamples = 10000;
+    Eigen::ArrayXd eccentricities( numberOfSamples ), meanAnomalies( numberOfSamples );
+    for( int i = 0; i < numberOfSamples; i++ )
+    {
+        eccentricities( i ) = ( i % 10 == 0 ) ? 1.0 - std::pow( 10.0, -8.0 * distribution( randomNumbergenerator ) ) :
+                                                0.99 * distribution( randomNumbergenerator );
+        meanAnomalies( i ) = 100.0 * ( distribution( randomNumbergenerator ) - 0.5 );
+    }
+
+    Eigen::ArrayXd eccentricAnomalies = convertMeanAnomaliesToEccentricAnomalies( eccentricities, meanAnomalies );
+    for( int i = 0; i < numberOfSamples; i++ )
+    {
+        BOOST_CHECK_SMALL( eccentricAnomalies( i ) - convertMeanAnomalyToEccentricAnomaly(
+                               eccentricities( i ), meanAnomalies( i ) ), 1.0E-13 );
+    }
+
+    // Check invalid input
+    eccentricities( 0 ) = 1.0;
+    BOOST_CHECK_THROW( convertMeanAnomaliesToEccentricAnomalies( eccentricities, meanAnomalies ), std::runtime_error );
+}
+
 // End Boost test suite.
 BOOST_AUTO_TEST_SUITE_END( )
 
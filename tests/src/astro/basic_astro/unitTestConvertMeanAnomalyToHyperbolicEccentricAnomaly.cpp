@@ -396,6 +396,38 @@ BOOST_AUTO_TEST_CASE( test_convertMeanAnomalyToHyperbolicEccentricAnomaly_specif
 }
 
 // End Boost test suite.
+//! Test batch conversion against single conversions, for random (including near-parabolic) orbits.
+BOOST_AUTO_TEST_CASE( test_convertMeanAnomaliesToHyperbolicEccentricAnomalies )
+{
+    boost::mt19937 randomNumbergenerator( 42 );
+    boost::random::uniform_real_distribution< > distribution( 0.0, 1.0 );
+
+    const int numberOfSamples = 10000;
+    Eigen::ArrayXd eccentricities( numberOfSamples ), hyperbolicMeanAnomalies( numberOfSamples );
+    for( int i = 0; i < numberOfSamples; i++ )
+    {
+        eccentricities( i ) = ( i % 10 == 0 ) ? 1.0 + std::pow( 10.0, -6.0 * distribution( randomNumbergenerator ) ) :
+                                                1.0 + 100.0 * distribution( randomNumbergenerator );
+        hyperbolicMeanAnomalies( i ) = ( distribution( randomNumbergenerator ) - 0.5 ) *
+                std::pow( 10.0, 8.0 * distribution( randomNumbergenerator ) );
+    }
+
+    Eigen::ArrayXd hyperbolicEccentricAnomalies = convertMeanAnomaliesToHyperbolicEccentricAnomalies(
+                eccentricities, hyperbolicMeanAnomalies );
+    for( int i = 0; i < numberOfSamples; i++ )
+    {
+        double expectedHyperbolicEccentricAnomaly = convertMeanAnomalyToHyperbolicEccentricAnomaly(
+                    eccentricities( i ), hyperbolicMeanAnomalies( i ) );
+        BOOST_CHECK_SMALL( ( hyperbolicEccentricAnomalies( i ) - expectedHyperbolicEccentricAnomaly ) /
+                           std::max( 1.0, std::fabs( expectedHyperbolicEccentricAnomaly ) ), 1.0E-13 );
+    }
+
+    // Check invalid input
+    eccentricities( 0 ) = 1.0;
+    BOOST_CHECK_THROW( convertMeanAnomaliesToHyperbolicEccentricAnomalies( eccentricities, hyperbolicMeanAnomalies ),
+                       std::runtime_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
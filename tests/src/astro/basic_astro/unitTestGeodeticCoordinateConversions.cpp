@@ -21,6 +21,8 @@
 #include "tudat/basics/testMacros.h"
 
 #include "tudat/astro/basic_astro/geodeticCoordinateConversions.h"
+#include "tudat/math/basic/coordinateConversions.h"
+#include "tudat/math/basic/mathematicalConstants.h"
 
 namespace tudat
 {
@@ -83,6 +85,114 @@ BOOST_AUTO_TEST_CASE( testGeodeticCoordinateConversions )
     }
 }
 
+BOOST_AUTO_TEST_CASE( testBatchGeodeticCoordinateConversions )
+{
+    using namespace coordinate_conversions;
+
+    // Central body characteristics (WGS84 Earth ellipsoid).
+    const double flattening = 1.0 / 298.257223563;
+    const double equatorialRadius = 6378137.0;
+
+    // Create geodetic positions, from below the surface to far beyond it, including points over the poles and equator
+    const int numberOfAltitudes = 12;
+    const int numberOfLatitudes = 37;
+    const int numberOfLongitudes = 12;
+    const double altitudes[ numberOfAltitudes ] =
+    { -1.0E5, -1.0E4, -10.0, 0.0, 1.0, 400.0E3, 1.0E6, 2.0E7, 3.6E7, 1.0E8, 1234.5, -2345.6 };
+
+    Eigen::Matrix3Xd geodeticPositions( 3, numberOfAltitudes * numberOfLatitudes * numberOfLongitudes );
+    int currentIndex = 0;
+    for( int i = 0; i < numberOfAltitudes; i++ )
+    {
+        for( int j = 0; j < numberOfLatitudes; j++ )
+        {
+            for( int k = 0; k < numberOfLongitudes; k++ )
+            {
+                geodeticPositions.col( currentIndex++ ) <<
+                    altitudes[ i ],
+                    -mathematical_constants::PI / 2.0 + mathematical_constants::PI * static_cast< double >( j ) /
+                        static_cast< double >( numberOfLatitudes - 1 ),
+                    -mathematical_constants::PI + 2.0 * mathematical_constants::PI * static_cast< double >( k ) /
+                        static_cast< double >( numberOfLongitudes );
+            }
+        }
+    }
+
+    // Convert to Cartesian positions, and add points close to the center of the body
+    const int numberOfGeodeticPositions = static_cast< int >( geodeticPositions.cols( ) );
+    Eigen::Matrix3Xd cartesianPositions( 3, numberOfGeodeticPositions + 3 );
+    for( int i = 0; i < numberOfGeodeticPositions; i++ )
+    {
+        cartesianPositions.col( i ) = convertGeodeticToCartesianCoordinates(
+                    geodeticPositions.col( i ), equatorialRadius, flattening );
+    }
+    cartesianPositions.col( numberOfGeodeticPositions ) << 0.0, 0.0, 1.0E3;
+    cartesianPositions.col( numberOfGeodeticPositions + 1 ) << 1.0E3, 0.0, 0.0;
+    cartesianPositions.col( numberOfGeodeticPositions + 2 ) << 1.0, -2.0, 3.0;
+
+    // Check batch geodetic-to-Cartesian conversion against single-point conversion
+    for( int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads += 3 )
+    {
+        Eigen::Matrix3Xd batchCartesianPositions = convertGeodeticToCartesianCoordinatesBatch(
+                    geodeticPositions, equatorialRadius, flattening, numberOfThreads );
+        BOOST_CHECK_EQUAL( batchCartesianPositions.cols( ), numberOfGeodeticPositions );
+        for( int i = 0; i < numberOfGeodeticPositions; i++ )
+        {
+            for( int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_SMALL( batchCartesianPositions( j, i ) - cartesianPositions( j, i ),
+                                   1.0E-15 * cartesianPositions.col( i ).norm( ) );
+            }
+        }
+    }
+
+    // Check closed-form and batch Cartesian-to-geodetic conversion against iterative conversion
+    for( int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads += 3 )
+    {
+        Eigen::Matrix3Xd batchGeodeticPositions = convertCartesianToGeodeticCoordinatesBatch(
+                    cartesianPositions, equatorialRadius, flattening, numberOfThreads );
+        for( int i = 0; i < cartesianPositions.cols( ); i++ )
+        {
+            Eigen::Vector3d iterativeGeodeticPosition = convertCartesianToGeodeticCoordinates(
+                        cartesianPositions.col( i ), equatorialRadius, flattening, 1.0E-9 );
+            Eigen::Vector3d closedFormGeodeticPosition = convertCartesianToGeodeticCoordinatesClosedForm(
+                        cartesianPositions.col( i ), equatorialRadius, flattening );
+
+            // Altitude differences are at the level of the round-off of the position
+            double altitudeTolerance = 1.0E-8 + 1.0E-15 * cartesianPositions.col( i ).norm( );
+            BOOST_CHECK_SMALL( closedFormGeodeticPosition( 0 ) - iterativeGeodeticPosition( 0 ), altitudeTolerance );
+            BOOST_CHECK_SMALL( closedFormGeodeticPosition( 1 ) - iterativeGeodeticPosition( 1 ), 1.0E-14 );
+            BOOST_CHECK_SMALL( batchGeodeticPositions( 0, i ) - closedFormGeodeticPosition( 0 ), altitudeTolerance );
+            BOOST_CHECK_SMALL( batchGeodeticPositions( 1, i ) - closedFormGeodeticPosition( 1 ), 1.0E-14 );
+
+            // Longitude is undefined on the polar axis
+            if( cartesianPositions.col( i ).segment( 0, 2 ).norm( ) > 1.0E-6 )
+            {
+                BOOST_CHECK_SMALL( closedFormGeodeticPosition( 2 ) - iterativeGeodeticPosition( 2 ), 1.0E-15 );
+                BOOST_CHECK_SMALL( batchGeodeticPositions( 2, i ) - iterativeGeodeticPosition( 2 ), 1.0E-15 );
+            }
+        }
+    }
+
+    // Check batch spherical coordinate conversions against single-point conversions
+    Eigen::Matrix3Xd batchSphericalPositions = convertCartesianToSphericalBatch( cartesianPositions );
+    Eigen::Matrix3Xd batchRecomputedCartesianPositions = convertSphericalToCartesianBatch( batchSphericalPositions );
+    for( int i = 0; i < cartesianPositions.cols( ); i++ )
+    {
+        Eigen::Vector3d sphericalPosition = convertCartesianToSpherical< double >( cartesianPositions.col( i ) );
+        Eigen::Vector3d recomputedCartesianPosition = convertSphericalToCartesian< double >( sphericalPosition );
+        BOOST_CHECK_SMALL( batchSphericalPositions( 0, i ) - sphericalPosition( 0 ),
+                           1.0E-15 * sphericalPosition( 0 ) );
+        BOOST_CHECK_SMALL( batchSphericalPositions( 1, i ) - sphericalPosition( 1 ), 1.0E-15 );
+        BOOST_CHECK_SMALL( batchSphericalPositions( 2, i ) - sphericalPosition( 2 ), 1.0E-15 );
+        for( int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( batchRecomputedCartesianPositions( j, i ) - recomputedCartesianPosition( j ),
+                               1.0E-15 * sphericalPosition( 0 ) );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -288,5 +288,41 @@ BOOST_AUTO_TEST_CASE( testMeanAnomalyAgainstMeanMotion )
                            static_cast< double >( 5.0 * std::numeric_limits< double >::epsilon( ) ) );
     }
 }
+//! Test 7: Comparison of batch propagation (of mixed elliptic and hyperbolic orbits) with single propagations.
+BOOST_AUTO_TEST_CASE( testPropagateKeplerOrbits )
+{
+    const double gravitationalParameter = 398600.4415e9;
+
+    // Set elliptic and hyperbolic orbits, and propagation times
+    Eigen::Vector6d ellipticElements = getODTBXBenchmarkData( ).begin( )->second;
+    Eigen::Vector6d hyperbolicElements = ellipticElements;
+    hyperbolicElements( semiMajorAxisIndex ) *= -1.0;
+    hyperbolicElements( eccentricityIndex ) = 1.5;
+    hyperbolicElements( trueAnomalyIndex ) = 0.5;
+
+    const int numberOfOrbits = 20;
+    Eigen::Matrix< double, Eigen::Dynamic, 6 > initialStates( numberOfOrbits, 6 );
+    Eigen::ArrayXd propagationTimes( numberOfOrbits );
+    for( int i = 0; i < numberOfOrbits; i++ )
+    {
+        initialStates.row( i ) = ( ( i % 3 == 0 ) ? hyperbolicElements : ellipticElements ).transpose( );
+        initialStates( i, trueAnomalyIndex ) += 0.05 * static_cast< double >( i );
+        propagationTimes( i ) = 3600.0 * static_cast< double >( i - numberOfOrbits / 2 );
+    }
+
+    Eigen::Matrix< double, Eigen::Dynamic, 6 > finalStates =
+            propagateKeplerOrbits( initialStates, propagationTimes, gravitationalParameter );
+    for( int i = 0; i < numberOfOrbits; i++ )
+    {
+        Eigen::Vector6d expectedFinalState = propagateKeplerOrbit< double >(
+                    initialStates.row( i ).transpose( ), propagationTimes( i ), gravitationalParameter );
+        for( int j = 0; j < 5; j++ )
+        {
+            BOOST_CHECK_EQUAL( finalStates( i, j ), expectedFinalState( j ) );
+        }
+        BOOST_CHECK_SMALL( finalStates( i, trueAnomalyIndex ) - expectedFinalState( trueAnomalyIndex ), 1.0E-12 );
+    }
+}
+
 } // namespace unit_tests
 } // namespace tudat
@@ -344,6 +344,104 @@ BOOST_AUTO_TEST_CASE( testIsOrbitRetrograde )
     BOOST_CHECK( isExceptionFound );
 }
 
+//! Unit test for batch shadow function and line of sight clearance computations.
+BOOST_AUTO_TEST_CASE( testBatchShadowFunctionAndLineOfSightClearance )
+{
+    using namespace mission_geometry;
+
+    // Define random positions of satellite and bodies, such that all shadow conditions occur
+    const int numberOfPositions = 200;
+    Eigen::Matrix3Xd occultedBodyPositions = 1.0E3 * Eigen::Matrix3Xd::Random( 3, numberOfPositions );
+    occultedBodyPositions.row( 0 ).array( ) += 1.0E4;
+    Eigen::Matrix3Xd occultingBodyPositions = Eigen::Matrix3Xd::Random( 3, numberOfPositions );
+    Eigen::Matrix3Xd satellitePositions = 3.0 * Eigen::Matrix3Xd::Random( 3, numberOfPositions );
+
+    Eigen::VectorXd shadowFunctions = computeShadowFunctions(
+                occultedBodyPositions, 500.0, occultingBodyPositions, 1.0, satellitePositions );
+    Eigen::VectorXd lineOfSightClearances = computeLineOfSightClearances(
+                satellitePositions, occultedBodyPositions, occultingBodyPositions, 1.0 );
+    for( int i = 0; i < numberOfPositions; i++ )
+    {
+        BOOST_CHECK_EQUAL( shadowFunctions( i ), computeShadowFunction(
+                               occultedBodyPositions.col( i ), 500.0, occultingBodyPositions.col( i ), 1.0,
+                               satellitePositions.col( i ) ) );
+        BOOST_CHECK_SMALL( lineOfSightClearances( i ) - computeLineOfSightClearance(
+                               satellitePositions.col( i ), occultedBodyPositions.col( i ),
+                               occultingBodyPositions.col( i ), 1.0 ), 1.0E-12 );
+    }
+
+    // Check line of sight clearance for simple geometries
+    BOOST_CHECK_CLOSE_FRACTION( computeLineOfSightClearance(
+                                    Eigen::Vector3d( -2.0, 0.5, 0.0 ), Eigen::Vector3d( 2.0, 0.5, 0.0 ),
+                                    Eigen::Vector3d::Zero( ), 1.0 ), -0.5, 1.0E-15 );
+    BOOST_CHECK_CLOSE_FRACTION( computeLineOfSightClearance(
+                                    Eigen::Vector3d( -2.0, 2.0, 0.0 ), Eigen::Vector3d( 2.0, 2.0, 0.0 ),
+                                    Eigen::Vector3d::Zero( ), 1.0 ), 1.0, 1.0E-15 );
+    BOOST_CHECK_CLOSE_FRACTION( computeLineOfSightClearance(
+                                    Eigen::Vector3d( 2.0, 0.0, 0.0 ), Eigen::Vector3d( 3.0, 0.0, 0.0 ),
+                                    Eigen::Vector3d::Zero( ), 1.0 ), 1.0, 1.0E-15 );
+}
+
+//! Unit test for eclipse and visibility windows, computed from a (circular) state history.
+BOOST_AUTO_TEST_CASE( testEclipseAndVisibilityWindows )
+{
+    using namespace mission_geometry;
+    using mathematical_constants::PI;
+
+    // Create state history of circular orbit (radius 2, unit angular velocity) around unit sphere at origin
+    double orbitRadius = 2.0;
+    auto getCircularOrbitState = [ = ]( const double time )
+    {
+        Eigen::VectorXd state = Eigen::VectorXd::Zero( 6 );
+        state << orbitRadius * std::cos( time ), orbitRadius * std::sin( time ), 0.0,
+                -orbitRadius * std::sin( time ), orbitRadius * std::cos( time ), 0.0;
+        return state;
+    };
+    std::map< double, Eigen::VectorXd > stateHistory;
+    for( int i = 0; i <= 80; i++ )
+    {
+        stateHistory[ 0.1 * i ] = getCircularOrbitState( 0.1 * i );
+    }
+
+    // Check eclipse windows, for distant point-like light source along positive x-axis
+    std::vector< std::pair< double, double > > eclipseWindows = computeEclipseWindows(
+                stateHistory, [ ]( const double ){ return Eigen::Vector3d( 1.0E8, 0.0, 0.0 ); }, 1.0E-3,
+                [ ]( const double ){ return Eigen::Vector3d::Zero( ); }, 1.0, 1.0, 1.0E-8 );
+    BOOST_CHECK_EQUAL( eclipseWindows.size( ), 1 );
+    BOOST_CHECK_SMALL( eclipseWindows.at( 0 ).first - 5.0 * PI / 6.0, 1.0E-5 );
+    BOOST_CHECK_SMALL( eclipseWindows.at( 0 ).second - 7.0 * PI / 6.0, 1.0E-5 );
+
+    // Check visibility windows of a target on the positive x-axis; line of sight is blocked when the satellite crosses
+    // the tangent lines from the target to the sphere
+    Eigen::Vector3d targetPosition( 10.0, 0.0, 0.0 );
+    std::vector< std::pair< double, double > > visibilityWindows = computeVisibilityWindows(
+                stateHistory, [ = ]( const double ){ return targetPosition; },
+                [ ]( const double ){ return Eigen::Vector3d::Zero( ); }, 1.0, 1.0E-8 );
+    BOOST_CHECK_EQUAL( visibilityWindows.size( ), 2 );
+    BOOST_CHECK_EQUAL( visibilityWindows.at( 0 ).first, 0.0 );
+    BOOST_CHECK_EQUAL( visibilityWindows.at( 1 ).second, 8.0 );
+    std::vector< double > eventEpochs = { visibilityWindows.at( 0 ).second, visibilityWindows.at( 1 ).first };
+    for( unsigned int i = 0; i < eventEpochs.size( ); i++ )
+    {
+        BOOST_CHECK_SMALL( computeLineOfSightClearance(
+                               getCircularOrbitState( eventEpochs.at( i ) ).segment( 0, 3 ), targetPosition,
+                               Eigen::Vector3d::Zero( ), 1.0 ), 1.0E-5 );
+    }
+    BOOST_CHECK_SMALL( eventEpochs.at( 0 ) + eventEpochs.at( 1 ) - 2.0 * PI, 1.0E-5 );
+
+    // Check windows on grid without refinement
+    std::vector< std::pair< double, double > > gridWindows = extractEventWindows(
+                { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 }, { true, false, true, true, false, true },
+                std::function< bool( const double ) >( ), 1.0E-3 );
+    BOOST_CHECK_EQUAL( gridWindows.size( ), 3 );
+    BOOST_CHECK_EQUAL( gridWindows.at( 0 ).first, 0.0 );
+    BOOST_CHECK_EQUAL( gridWindows.at( 0 ).second, 0.0 );
+    BOOST_CHECK_EQUAL( gridWindows.at( 1 ).first, 2.0 );
+    BOOST_CHECK_EQUAL( gridWindows.at( 1 ).second, 3.0 );
+    BOOST_CHECK_EQUAL( gridWindows.at( 2 ).first, 5.0 );
+    BOOST_CHECK_EQUAL( gridWindows.at( 2 ).second, 5.0 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
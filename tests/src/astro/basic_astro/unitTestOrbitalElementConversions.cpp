@@ -42,6 +42,7 @@
 #include <Eigen/Core>
 
 #include "tudat/astro/basic_astro/orbitalElementConversions.h"
+#include "tudat/astro/basic_astro/batchElementConversions.h"
 #include "tudat/basics/testMacros.h"
 #include "tudat/math/basic/mathematicalConstants.h"
 #include "tudat/basics/basicTypedefs.h"
@@ -1675,6 +1676,82 @@ BOOST_AUTO_TEST_CASE( testMeanToTrueAnomalyConversion )
     }
 }
 
+//! Test if batch conversions (serial and parallel) are identical to the conversions of the individual states
+BOOST_AUTO_TEST_CASE( testBatchElementConversions )
+{
+    using namespace orbital_element_conversions;
+
+    const double earthGravitationalParameter = 3.986004418E14;
+
+    // Create batch of (elliptical, prograde and retrograde) Keplerian states
+    const int numberOfStates = 1000;
+    Eigen::Matrix< double, 6, Eigen::Dynamic > keplerianElements( 6, numberOfStates );
+    for( int i = 0; i < numberOfStates; i++ )
+    {
+        double fraction = static_cast< double >( i ) / static_cast< double >( numberOfStates );
+        keplerianElements.col( i ) << 7.0E6 + 3.0E7 * fraction, 0.001 + 0.8 * fraction,
+                0.1 + 2.9 * fraction, 0.1 + 6.0 * fraction, 1.0 + 4.0 * fraction, 6.0 * fraction;
+    }
+
+    for( int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads += 3 )
+    {
+        // Check Keplerian <-> Cartesian conversions
+        Eigen::Matrix< double, 6, Eigen::Dynamic > cartesianElements =
+                convertKeplerianToCartesianElementsBatch( keplerianElements, earthGravitationalParameter, numberOfThreads );
+        Eigen::Matrix< double, 6, Eigen::Dynamic > recomputedKeplerianElements =
+                convertCartesianToKeplerianElementsBatch( cartesianElements, earthGravitationalParameter, numberOfThreads );
+
+        // Check modified equinoctial <-> Cartesian conversions (without retrograde factor)
+        Eigen::Matrix< double, 6, Eigen::Dynamic > modifiedEquinoctialElements =
+                convertCartesianToModifiedEquinoctialElementsBatch(
+                    cartesianElements, earthGravitationalParameter, false, numberOfThreads );
+        Eigen::Matrix< double, 6, Eigen::Dynamic > cartesianElementsFromModifiedEquinoctial =
+                convertModifiedEquinoctialToCartesianElementsBatch(
+                    modifiedEquinoctialElements, earthGravitationalParameter, false, numberOfThreads );
+
+        // Check USM7 <-> Cartesian conversions
+        Eigen::Matrix< double, 7, Eigen::Dynamic > unifiedStateModelElements =
+                convertCartesianToUnifiedStateModelQuaternionsElementsBatch(
+                    cartesianElements, earthGravitationalParameter, numberOfThreads );
+        Eigen::Matrix< double, 6, Eigen::Dynamic > cartesianElementsFromUnifiedStateModel =
+                convertUnifiedStateModelQuaternionsToCartesianElementsBatch(
+                    unifiedStateModelElements, earthGravitationalParameter, false, numberOfThreads );
+
+        BOOST_CHECK_EQUAL( cartesianElements.cols( ), numberOfStates );
+        BOOST_CHECK_EQUAL( unifiedStateModelElements.cols( ), numberOfStates );
+        for( int i = 0; i < numberOfStates; i++ )
+        {
+            // Batch conversions must be identical to single-state conversions
+            Eigen::Vector6d currentKeplerianElements = keplerianElements.col( i );
+            Eigen::Vector6d currentCartesianElements = convertKeplerianToCartesianElements(
+                        currentKeplerianElements, earthGravitationalParameter );
+            for( int j = 0; j < 6; j++ )
+            {
+                BOOST_CHECK_EQUAL( cartesianElements( j, i ), currentCartesianElements( j ) );
+            }
+            Eigen::Vector6d currentModifiedEquinoctialElements = convertCartesianToModifiedEquinoctialElements(
+                        currentCartesianElements, earthGravitationalParameter, false );
+            for( int j = 0; j < 6; j++ )
+            {
+                BOOST_CHECK_EQUAL( modifiedEquinoctialElements( j, i ), currentModifiedEquinoctialElements( j ) );
+            }
+
+            // Round trips must reproduce the input states
+            Eigen::Vector6d keplerianDifference = recomputedKeplerianElements.col( i ) - keplerianElements.col( i );
+            BOOST_CHECK_SMALL( std::fabs( keplerianDifference( 0 ) ) / keplerianElements( 0, i ), 1.0E-12 );
+            BOOST_CHECK_SMALL( keplerianDifference.segment( 1, 5 ).cwiseAbs( ).maxCoeff( ), 1.0E-10 );
+            for( int j = 0; j < 2; j++ )
+            {
+                double currentNorm = currentCartesianElements.segment( 3 * j, 3 ).norm( );
+                BOOST_CHECK_SMALL( ( cartesianElementsFromModifiedEquinoctial.block( 3 * j, i, 3, 1 ) -
+                                     currentCartesianElements.segment( 3 * j, 3 ) ).norm( ) / currentNorm, 1.0E-12 );
+                BOOST_CHECK_SMALL( ( cartesianElementsFromUnifiedStateModel.block( 3 * j, i, 3, 1 ) -
+                                     currentCartesianElements.segment( 3 * j, 3 ) ).norm( ) / currentNorm, 1.0E-12 );
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
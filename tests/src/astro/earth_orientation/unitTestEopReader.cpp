@@ -12,7 +12,11 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MAIN
 
+#include <fstream>
+#include <iomanip>
 #include <limits>
+
+#include <boost/filesystem.hpp>
 #include <boost/test/unit_test.hpp>
 
 
@@ -229,6 +233,73 @@ BOOST_AUTO_TEST_CASE( testLeapSecondIdentification )
 }
 
 
+//! Check whether reading a time window of an EOP file, and sharing EOP data through loadEOPReader, is done correctly
+BOOST_AUTO_TEST_CASE( testEopReaderTimeWindowAndCache )
+{
+    // Write synthetic C04 file, with 3000 consecutive days
+    std::string fileName = ( boost::filesystem::temp_directory_path( ) /
+                             boost::filesystem::unique_path( "tudat_eop_%%%%%%%%.txt" ) ).string( );
+    double firstModifiedJulianDay = 50000.0;
+    int numberOfDays = 3000;
+    {
+        std::ofstream eopFile( fileName );
+        eopFile << "# Synthetic EOP file" << std::endl;
+        eopFile << "Date MJD x y UT1-UTC LOD dX dY x_Err y_Err UT1-UTC_Err LOD_Err dX_Err dY_Err" << std::endl;
+        eopFile << "     \"s s s s s s s s s s s\"" << std::endl << std::endl;
+        eopFile << std::setprecision( 17 );
+        for( int i = 0; i < numberOfDays; i++ )
+        {
+            eopFile << "2000 1 1 " << firstModifiedJulianDay + i << " " << 0.001 * i << " " << -0.002 * i << " "
+                    << 0.1 - 1.0E-4 * i << " " << 1.0E-5 * i << " " << 2.0E-6 * i << " " << -3.0E-6 * i
+                    << " 0 0 0 0 0 0" << std::endl;
+        }
+    }
+
+    // Read full file, and time window of file
+    double arcSecondToRadian = 4.848136811095359935899141E-6;
+    double startTime = ( firstModifiedJulianDay + 1000.0 + basic_astrodynamics::JULIAN_DAY_AT_0_MJD -
+                         basic_astrodynamics::JULIAN_DAY_ON_J2000 ) * physical_constants::JULIAN_DAY;
+    double endTime = startTime + 100.0 * physical_constants::JULIAN_DAY;
+    std::shared_ptr< EOPReader > fullEopReader = std::make_shared< EOPReader >(
+                fileName, "C04", basic_astrodynamics::iau_2006 );
+    std::shared_ptr< EOPReader > windowedEopReader = std::make_shared< EOPReader >(
+                fileName, "C04", basic_astrodynamics::iau_2006, startTime, endTime );
+
+    BOOST_CHECK_EQUAL( fullEopReader->getNumberOfDays( ), numberOfDays );
+    BOOST_CHECK_EQUAL( windowedEopReader->getNumberOfDays( ), 101 + 2 * EOP_READER_WINDOW_MARGIN );
+    BOOST_CHECK_EQUAL( windowedEopReader->getModifiedJulianDays( ).front( ),
+                       firstModifiedJulianDay + 1000.0 - EOP_READER_WINDOW_MARGIN );
+
+    // Check data of each day against data in file, and against full file
+    for( int i = 0; i < windowedEopReader->getNumberOfDays( ); i++ )
+    {
+        double modifiedJulianDay = windowedEopReader->getModifiedJulianDays( ).at( i );
+        int fullIndex = static_cast< int >( modifiedJulianDay - firstModifiedJulianDay );
+        BOOST_CHECK_EQUAL( windowedEopReader->getDayIndex( modifiedJulianDay + 0.5 ), i );
+        BOOST_CHECK_EQUAL( fullEopReader->getDayIndex( modifiedJulianDay + 0.5 ), fullIndex );
+
+        Eigen::Vector6d eopData = windowedEopReader->getEopDataOfDay( i );
+        Eigen::Vector6d fullEopData = fullEopReader->getEopDataOfDay( fullIndex );
+        for( int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_EQUAL( eopData( j ), fullEopData( j ) );
+        }
+        BOOST_CHECK_CLOSE_FRACTION( eopData( 0 ), 0.001 * fullIndex * arcSecondToRadian, 1.0E-14 );
+        BOOST_CHECK_CLOSE_FRACTION( eopData( 2 ), 0.1 - 1.0E-4 * fullIndex, 1.0E-14 );
+        BOOST_CHECK_CLOSE_FRACTION( eopData( 5 ), -3.0E-6 * fullIndex * arcSecondToRadian, 1.0E-14 );
+    }
+    BOOST_CHECK_EQUAL( fullEopReader->getDayIndex( firstModifiedJulianDay - 10.0 ), 0 );
+    BOOST_CHECK_EQUAL( fullEopReader->getDayIndex( firstModifiedJulianDay + 1.0E6 ), numberOfDays - 1 );
+
+    // Check that EOP data is shared, and reloaded when cache is cleared
+    std::shared_ptr< EOPReader > sharedEopReader = loadEOPReader( fileName, "C04", basic_astrodynamics::iau_2006 );
+    BOOST_CHECK_EQUAL( sharedEopReader, loadEOPReader( fileName, "C04", basic_astrodynamics::iau_2006 ) );
+    BOOST_CHECK_EQUAL( sharedEopReader->getNumberOfDays( ), numberOfDays );
+    clearEOPReaderCache( );
+    BOOST_CHECK( sharedEopReader != loadEOPReader( fileName, "C04", basic_astrodynamics::iau_2006 ) );
+
+    boost::filesystem::remove( fileName );
+}
 
 BOOST_AUTO_TEST_SUITE_END( )
 
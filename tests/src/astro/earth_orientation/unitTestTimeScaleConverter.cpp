@@ -404,6 +404,72 @@ BOOST_AUTO_TEST_CASE( testTimeScaleConversionDuringLeapSeconds )
     }
 }
 
+//! Test if times retrieved from conversion cache (for alternating stations), and converted in batch, are correct
+BOOST_AUTO_TEST_CASE( testTimeScaleConversionCache )
+{
+    std::shared_ptr< TerrestrialTimeScaleConverter > timeScaleConverter =
+            createStandardEarthOrientationCalculator( )->getTerrestrialTimeScaleConverter( );
+    std::shared_ptr< TerrestrialTimeScaleConverter > comparisonTimeScaleConverter =
+            createStandardEarthOrientationCalculator( )->getTerrestrialTimeScaleConverter( );
+    comparisonTimeScaleConverter->setConversionCacheSize( 0 );
+
+    // Define station positions
+    std::vector< Eigen::Vector3d > stationPositions;
+    stationPositions.push_back( ( Eigen::Vector3d( ) << -5492333.306498738, -2453018.508911721, 2113645.653406073 ).finished( ) );
+    stationPositions.push_back( ( Eigen::Vector3d( ) << 4075539.0, 931735.0, 4801629.0 ).finished( ) );
+    stationPositions.push_back( ( Eigen::Vector3d( ) << -2353621.0, -4641341.0, 3677052.0 ).finished( ) );
+
+    std::vector< double > inputTimes;
+    for( int i = 0; i < 5; i++ )
+    {
+        inputTimes.push_back( 1.0E8 + static_cast< double >( i ) * 60.0 );
+    }
+
+    // Convert times for each station in turn, as when computing several observables at the same epochs
+    unsigned int numberOfComputedConversions = 0;
+    for( int k = 0; k < 3; k++ )
+    {
+        for( unsigned int i = 0; i < inputTimes.size( ); i++ )
+        {
+            for( unsigned int j = 0; j < stationPositions.size( ); j++ )
+            {
+                double tdb = timeScaleConverter->getCurrentTime< double >(
+                            utc_scale, tdb_scale, inputTimes.at( i ), stationPositions.at( j ) );
+                double ut1 = timeScaleConverter->getCurrentTime< double >(
+                            utc_scale, ut1_scale, inputTimes.at( i ), stationPositions.at( j ) );
+                double expectedTdb = comparisonTimeScaleConverter->getCurrentTime< double >(
+                            utc_scale, tdb_scale, inputTimes.at( i ), stationPositions.at( j ) );
+                double expectedUt1 = comparisonTimeScaleConverter->getCurrentTime< double >(
+                            utc_scale, ut1_scale, inputTimes.at( i ), stationPositions.at( j ) );
+                BOOST_CHECK_EQUAL( tdb, expectedTdb );
+                BOOST_CHECK_EQUAL( ut1, expectedUt1 );
+
+                if( k == 0 )
+                {
+                    numberOfComputedConversions++;
+                }
+            }
+        }
+    }
+
+    // All 15 epoch/station combinations fit in the (default) cache, so only the first pass requires computations
+    BOOST_CHECK_EQUAL( timeScaleConverter->getNumberOfConversionCacheHits( ), 2 * numberOfComputedConversions );
+    BOOST_CHECK_EQUAL( comparisonTimeScaleConverter->getNumberOfConversionCacheHits( ), 0 );
+
+    // Check batch conversion
+    for( unsigned int j = 0; j < stationPositions.size( ); j++ )
+    {
+        std::vector< double > convertedTimes = timeScaleConverter->getCurrentTimes< double >(
+                    utc_scale, tt_scale, inputTimes, stationPositions.at( j ) );
+        BOOST_CHECK_EQUAL( convertedTimes.size( ), inputTimes.size( ) );
+        for( unsigned int i = 0; i < inputTimes.size( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( convertedTimes.at( i ), comparisonTimeScaleConverter->getCurrentTime< double >(
+                                   utc_scale, tt_scale, inputTimes.at( i ), stationPositions.at( j ) ) );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -11,12 +11,14 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MAIN
 
+#include <cmath>
 #include <iostream>
 
 #include <boost/test/unit_test.hpp>
 
 #include "tudat/astro/electromagnetism/occultationModel.h"
 #include "tudat/astro/basic_astro/sphericalBodyShapeModel.h"
+#include "tudat/astro/basic_astro/missionGeometry.h"
 
 
 namespace tudat
@@ -279,6 +281,107 @@ BOOST_AUTO_TEST_CASE( testEvaluateVisibilityWithOccultation_Commutativity )
     ));
 }
 
+// Test that fast illumination check is consistent with shadow function
+BOOST_AUTO_TEST_CASE( testIsTargetFullyIlluminatedByExtendedSource )
+{
+    const Eigen::Vector3d sourcePosition(-1.5e11, 0, 0);
+    const double sourceRadius = 7e8;
+    const Eigen::Vector3d occultingBodyPosition(0, 0, 0);
+    const double occultingBodyRadius = 6.4e6;
+
+    unsigned int numberOfIlluminatedPoints = 0;
+    unsigned int numberOfOccultedPoints = 0;
+    for (double x = -5.0e7; x <= 5.0e7; x += 1.23e6)
+    {
+        for (double y = -1.0e7; y <= 1.0e7; y += 1.7e5)
+        {
+            const Eigen::Vector3d targetPosition(x, y, 0.3 * y);
+            if (targetPosition.norm() < occultingBodyRadius)
+            {
+                continue;
+            }
+
+            const double shadowFunction = mission_geometry::computeShadowFunction(
+                    sourcePosition, sourceRadius, occultingBodyPosition, occultingBodyRadius, targetPosition);
+            if (isTargetFullyIlluminatedByExtendedSource(
+                    sourcePosition, sourceRadius, occultingBodyPosition, occultingBodyRadius, targetPosition))
+            {
+                BOOST_CHECK_EQUAL(shadowFunction, 1.0);
+                numberOfIlluminatedPoints++;
+            }
+            else if (shadowFunction < 1.0)
+            {
+                numberOfOccultedPoints++;
+            }
+        }
+    }
+
+    BOOST_CHECK(numberOfIlluminatedPoints > 0);
+    BOOST_CHECK(numberOfOccultedPoints > 0);
+}
+
+// Test computation and use of intervals with constant received fraction along a reference trajectory
+BOOST_AUTO_TEST_CASE( testConstantReceivedFractionIntervals )
+{
+    const Eigen::Vector3d sourcePosition(1.5e11, 0, 0);
+    const auto sourceShapeModel = std::make_shared<tudat::basic_astrodynamics::SphericalBodyShapeModel>(7e8);
+    const auto occultingBodyShapeModel = std::make_shared<tudat::basic_astrodynamics::SphericalBodyShapeModel>(6.4e6);
+
+    // Circular orbit of target around occulting body, in plane containing source
+    const double orbitRadius = 7.0e6;
+    const double meanMotion = 1.0e-3;
+    auto targetPositionFunction = [=](const double time)
+    {
+        return Eigen::Vector3d(orbitRadius * std::cos(meanMotion * time), orbitRadius * std::sin(meanMotion * time), 0);
+    };
+
+    SingleOccultingBodyOccultationModel occultationModel(
+            "Earth", [] () { return Eigen::Vector3d::Zero().eval(); }, occultingBodyShapeModel);
+    auto receivedFractionFunction = [&](const double time)
+    {
+        occultationModel.updateMembers(time);
+        return occultationModel.evaluateReceivedFractionFromExtendedSource(
+                sourcePosition, sourceShapeModel, targetPositionFunction(time));
+    };
+
+    const double orbitalPeriod = 2.0 * mathematical_constants::PI / meanMotion;
+    const std::vector<ConstantReceivedFractionInterval> intervals = computeConstantReceivedFractionIntervals(
+            receivedFractionFunction, 0.0, 2.0 * orbitalPeriod, 30.0, 1.0E-3);
+
+    // Two orbits starting in sunlight: lit, umbra, lit, umbra, lit
+    BOOST_CHECK_EQUAL(intervals.size(), 5);
+    for (unsigned int i = 0; i < intervals.size(); i++)
+    {
+        BOOST_CHECK_EQUAL(intervals.at(i).receivedFraction, ((i % 2 == 0) ? 1.0 : 0.0));
+        BOOST_CHECK(intervals.at(i).startTime <= intervals.at(i).endTime);
+        if (i > 0)
+        {
+            // Entry and exit are separated by penumbra
+            BOOST_CHECK(intervals.at(i).startTime > intervals.at(i - 1).endTime);
+            BOOST_CHECK(intervals.at(i).startTime - intervals.at(i - 1).endTime < 30.0);
+        }
+    }
+
+    // Check that intervals reproduce received fraction, both inside and outside of the intervals
+    std::vector<double> directReceivedFractions;
+    std::vector<double> testTimes;
+    for (double time = 0.0; time < 2.0 * orbitalPeriod; time += 0.7)
+    {
+        testTimes.push_back(time);
+        directReceivedFractions.push_back(receivedFractionFunction(time));
+    }
+
+    occultationModel.setConstantReceivedFractionIntervals(intervals);
+    for (unsigned int i = 0; i < testTimes.size(); i++)
+    {
+        BOOST_CHECK_EQUAL(receivedFractionFunction(testTimes.at(i)), directReceivedFractions.at(i));
+    }
+
+    // Check that inconsistent intervals are rejected
+    BOOST_CHECK_THROW(occultationModel.setConstantReceivedFractionIntervals({{10.0, 20.0, 1.0}, {15.0, 30.0, 0.0}}),
+                      std::runtime_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace unit_tests
@@ -1306,6 +1306,97 @@ BOOST_AUTO_TEST_CASE( testRadiationPressureAcceleration_DynamicallyPaneledSource
     }
 }
 
+//! Test whether sharing occultation models between targets of an isotropic point source reproduces separate models
+BOOST_AUTO_TEST_CASE( testRadiationPressureAcceleration_IsotropicPointSource_SharedTargetOccultation )
+{
+    using namespace tudat::simulation_setup;
+
+    spice_interface::loadStandardSpiceKernels( );
+
+    const double testTime = 1.0E7;
+    auto bodies = createSystemOfBodies(getDefaultBodySettings({"Sun", "Earth"}, testTime - 3600.0, testTime + 3600.0));
+    auto sourceModel =
+            std::dynamic_pointer_cast<IsotropicPointRadiationSourceModel>(bodies.at("Sun")->getRadiationSourceModel());
+
+    // Create two co-located targets near the Earth's shadow boundary, and one target on the day side
+    bodies.at("Sun")->setStateFromEphemeris(testTime);
+    bodies.at("Earth")->setStateFromEphemeris(testTime);
+    const Eigen::Vector3d sunDirection =
+            (bodies.at("Sun")->getPosition() - bodies.at("Earth")->getPosition()).normalized();
+    const Eigen::Vector3d perpendicularDirection = sunDirection.cross(Eigen::Vector3d::UnitZ()).normalized();
+    const std::vector<Eigen::Vector3d> targetPositions = {
+            bodies.at("Earth")->getPosition() - 7000.0E3 * sunDirection + 6378.0E3 * perpendicularDirection,
+            bodies.at("Earth")->getPosition() - 7000.0E3 * sunDirection + 6378.0E3 * perpendicularDirection,
+            bodies.at("Earth")->getPosition() + 7000.0E3 * sunDirection };
+    std::vector<std::string> targetNames = {"Vehicle1", "Vehicle2", "Vehicle3"};
+    for (unsigned int i = 0; i < targetNames.size(); i++)
+    {
+        bodies.createEmptyBody(targetNames.at(i));
+        bodies.at(targetNames.at(i))->setConstantBodyMass(400.0);
+        bodies.at(targetNames.at(i))->setRadiationPressureTargetModel(
+                std::make_shared<CannonballRadiationPressureTargetModel>(
+                        4.0, 1.2, std::map<std::string, std::vector<std::string>>{{"Sun", {"Earth"}}}));
+        Eigen::Vector6d targetState = Eigen::Vector6d::Zero();
+        targetState.segment(0, 3) = targetPositions.at(i);
+        bodies.at(targetNames.at(i))->setState(targetState);
+    }
+
+    SelectedAccelerationMap accelerationMap;
+    for (unsigned int i = 0; i < targetNames.size(); i++)
+    {
+        accelerationMap[targetNames.at(i)]["Sun"].push_back(radiationPressureAcceleration());
+    }
+
+    // Create accelerations with separate and with shared occultation models
+    auto separateAccelerationModelMap = createAccelerationModelsMap(
+            bodies, accelerationMap, targetNames, std::vector<std::string>(targetNames.size(), "Earth"));
+    sourceModel->setTargetOccultationModelSharing(true);
+    auto sharedAccelerationModelMap = createAccelerationModelsMap(
+            bodies, accelerationMap, targetNames, std::vector<std::string>(targetNames.size(), "Earth"));
+
+    std::vector<std::shared_ptr<IsotropicPointSourceRadiationPressureAcceleration>> separateAccelerations, sharedAccelerations;
+    for (unsigned int i = 0; i < targetNames.size(); i++)
+    {
+        separateAccelerations.push_back(std::dynamic_pointer_cast<IsotropicPointSourceRadiationPressureAcceleration>(
+                separateAccelerationModelMap.at(targetNames.at(i)).at("Sun").at(0)));
+        sharedAccelerations.push_back(std::dynamic_pointer_cast<IsotropicPointSourceRadiationPressureAcceleration>(
+                sharedAccelerationModelMap.at(targetNames.at(i)).at("Sun").at(0)));
+    }
+    BOOST_CHECK(separateAccelerations.at(0)->getSourceToTargetOccultationModel() !=
+                separateAccelerations.at(1)->getSourceToTargetOccultationModel());
+    BOOST_CHECK(sharedAccelerations.at(0)->getSourceToTargetOccultationModel() ==
+                sharedAccelerations.at(1)->getSourceToTargetOccultationModel());
+    BOOST_CHECK(sharedAccelerations.at(0)->getSourceToTargetOccultationModel() ==
+                sharedAccelerations.at(2)->getSourceToTargetOccultationModel());
+
+    sourceModel->updateMembers(testTime);
+    for (unsigned int i = 0; i < targetNames.size(); i++)
+    {
+        separateAccelerations.at(i)->updateMembers(testTime);
+        sharedAccelerations.at(i)->updateMembers(testTime);
+    }
+
+    // Check that target in penumbra is tested, and that accelerations are identical
+    BOOST_CHECK(sharedAccelerations.at(0)->getSourceToTargetReceivedFraction() > 0.0);
+    BOOST_CHECK(sharedAccelerations.at(0)->getSourceToTargetReceivedFraction() < 1.0);
+    for (unsigned int i = 0; i < targetNames.size(); i++)
+    {
+        BOOST_CHECK_EQUAL(separateAccelerations.at(i)->getSourceToTargetReceivedFraction(),
+                          sharedAccelerations.at(i)->getSourceToTargetReceivedFraction());
+        for (unsigned int j = 0; j < 3; j++)
+        {
+            BOOST_CHECK_EQUAL(separateAccelerations.at(i)->getAcceleration()(j),
+                              sharedAccelerations.at(i)->getAcceleration()(j));
+        }
+    }
+
+    // Check irradiance from luminosity retrieved at update
+    const Eigen::Vector3d targetPositionInSourceFrame = targetPositions.at(2) - bodies.at("Sun")->getPosition();
+    BOOST_CHECK_EQUAL(sourceModel->evaluatePointIrradianceAtPosition(targetPositionInSourceFrame),
+                      sourceModel->evaluateIrradianceAtPosition(targetPositionInSourceFrame).front().first);
+    BOOST_CHECK_EQUAL(sourceModel->getCurrentLuminosity(), sourceModel->getLuminosityModel()->getLuminosity());
+}
+
 
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -21,6 +21,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "tudat/basics/testMacros.h"
+#include "tudat/astro/basic_astro/physicalConstants.h"
 #include "tudat/astro/electromagnetism/radiationPressureTargetModel.h"
 #include "tudat/astro/electromagnetism/radiationSourceModel.h"
 #include "tudat/math/basic/coordinateConversions.h"
@@ -205,6 +206,127 @@ BOOST_AUTO_TEST_CASE( testRadiationPressureTargetModel_EquivalentSphere )
     TUDAT_CHECK_MATRIX_CLOSE(cannonballForce, paneledForce, 1e-3);
 }
 
+//! Reflection law with the same reaction vector as a specular-diffuse-mix law, but not derived from it
+class GenericTestReflectionLaw : public ReflectionLaw
+{
+public:
+    explicit GenericTestReflectionLaw(const std::shared_ptr<ReflectionLaw>& reflectionLaw) :
+            reflectionLaw_(reflectionLaw) {}
+
+    double evaluateReflectedFraction(
+            const Eigen::Vector3d& surfaceNormal,
+            const Eigen::Vector3d& incomingDirection,
+            const Eigen::Vector3d& observerDirection) const override
+    {
+        return reflectionLaw_->evaluateReflectedFraction(surfaceNormal, incomingDirection, observerDirection);
+    }
+
+    Eigen::Vector3d evaluateReactionVector(
+            const Eigen::Vector3d& surfaceNormal,
+            const Eigen::Vector3d& incomingDirection) const override
+    {
+        return reflectionLaw_->evaluateReactionVector(surfaceNormal, incomingDirection);
+    }
+
+private:
+    std::shared_ptr<ReflectionLaw> reflectionLaw_;
+};
+
+//! Check if vectorized force summation agrees with summation of reaction vectors of individual panels
+BOOST_AUTO_TEST_CASE( testPaneledRadiationPressureTargetModel_VectorizedSummation )
+{
+    const double sourceIrradiance = 1361;
+    const std::vector<std::shared_ptr<ReflectionLaw>> reflectionLaws {
+        std::make_shared<SpecularDiffuseMixReflectionLaw>(0.2, 0.5, 0.3),
+        std::make_shared<SpecularDiffuseMixReflectionLaw>(0.6, 0.1, 0.3, true),
+        std::make_shared<LambertianReflectionLaw>(0.4),
+        std::make_shared<GenericTestReflectionLaw>(std::make_shared<SpecularDiffuseMixReflectionLaw>(0.3, 0.3, 0.4, true))
+    };
+
+    std::vector<TargetPanel> panels;
+    const auto pairOfAngleVectors = generateEvenlySpacedPoints_Staggered(40);
+    for (unsigned int i = 0; i < 40; ++i)
+    {
+        const Eigen::Vector3d surfaceNormal = coordinate_conversions::convertSphericalToCartesian(
+                Eigen::Vector3d(1, std::get<0>(pairOfAngleVectors)[i], std::get<1>(pairOfAngleVectors)[i]));
+        panels.emplace_back(0.5 + 0.1 * i, surfaceNormal, reflectionLaws.at(i % reflectionLaws.size()));
+    }
+    PaneledRadiationPressureTargetModel targetModel(panels);
+    targetModel.updateMembers(TUDAT_NAN);
+
+    for (const Eigen::Vector3d& sourceToTargetDirection : {
+            Eigen::Vector3d(Eigen::Vector3d(4, 3, -1).normalized()),
+            Eigen::Vector3d(Eigen::Vector3d(-0.2, 0.1, 1).normalized()),
+            Eigen::Vector3d(Eigen::Vector3d(0, -1, 0)) })
+    {
+        Eigen::Vector3d expectedForce = Eigen::Vector3d::Zero();
+        for (const auto& panel : targetModel.getPanels())
+        {
+            const double cosBetweenNormalAndIncoming = (-sourceToTargetDirection).dot(panel.getSurfaceNormal());
+            if (cosBetweenNormalAndIncoming > 0)
+            {
+                expectedForce += sourceIrradiance / physical_constants::SPEED_OF_LIGHT * panel.getArea() *
+                        cosBetweenNormalAndIncoming *
+                        panel.getReflectionLaw()->evaluateReactionVector(panel.getSurfaceNormal(), sourceToTargetDirection);
+            }
+        }
+
+        const Eigen::Vector3d actualForce =
+                targetModel.evaluateRadiationPressureForce(sourceIrradiance, sourceToTargetDirection);
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(actualForce, expectedForce, 1e-14);
+    }
+}
+
+//! Check self-shadowing of panels with precomputed table
+BOOST_AUTO_TEST_CASE( testPaneledRadiationPressureTargetModel_SelfShadowing )
+{
+    using mathematical_constants::PI;
+
+    const double sourceIrradiance = 1000;
+    const auto reflectionLaw = std::make_shared<SpecularDiffuseMixReflectionLaw>(0.2, 0.4, 0.4);
+    PaneledRadiationPressureTargetModel targetModel({
+            TargetPanel(2, Eigen::Vector3d(0, 0, 1), reflectionLaw),
+            TargetPanel(3, Eigen::Vector3d(1, 1, 1).normalized(), reflectionLaw)
+    });
+    targetModel.updateMembers(TUDAT_NAN);
+
+    // Illuminated fraction of first panel is linear in source latitude, second panel is fully shadowed
+    auto illuminatedFractionFunction = [=](const Eigen::Vector3d& sourceToTargetDirection)
+    {
+        const double latitude = std::asin(-sourceToTargetDirection.z());
+        return Eigen::Vector2d((latitude + PI / 2) / PI, 0);
+    };
+    const auto selfShadowingTable = createPanelSelfShadowingTable(illuminatedFractionFunction, 2, 19, 36);
+    BOOST_CHECK_EQUAL(selfShadowingTable->getNumberOfPanels(), 2);
+    BOOST_CHECK_EQUAL(selfShadowingTable->getIlluminatedFractions().cols(), 19 * 36);
+
+    const Eigen::Vector3d sourceToTargetDirection = Eigen::Vector3d(-0.3, -0.5, -1).normalized();
+    const Eigen::VectorXd illuminatedFractions = selfShadowingTable->evaluateIlluminatedFractions(sourceToTargetDirection);
+    BOOST_CHECK_CLOSE_FRACTION(illuminatedFractions(0), illuminatedFractionFunction(sourceToTargetDirection)(0), 1e-12);
+    BOOST_CHECK_EQUAL(illuminatedFractions(1), 0);
+
+    // Only first panel contributes, scaled by illuminated fraction
+    PaneledRadiationPressureTargetModel singlePanelModel({
+            TargetPanel(2 * illuminatedFractions(0), Eigen::Vector3d(0, 0, 1), reflectionLaw) });
+    singlePanelModel.updateMembers(TUDAT_NAN);
+    const Eigen::Vector3d expectedForce =
+            singlePanelModel.evaluateRadiationPressureForce(sourceIrradiance, sourceToTargetDirection);
+
+    const Eigen::Vector3d unshadowedForce =
+            targetModel.evaluateRadiationPressureForce(sourceIrradiance, sourceToTargetDirection);
+    targetModel.setSelfShadowingTable(selfShadowingTable);
+    const Eigen::Vector3d shadowedForce =
+            targetModel.evaluateRadiationPressureForce(sourceIrradiance, sourceToTargetDirection);
+
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(shadowedForce, expectedForce, 1e-14);
+    BOOST_CHECK(shadowedForce.norm() < unshadowedForce.norm());
+
+    // Table with wrong number of panels is rejected
+    BOOST_CHECK_THROW(targetModel.setSelfShadowingTable(
+            std::make_shared<PanelSelfShadowingTable>(Eigen::MatrixXd::Ones(3, 2 * 4), 2, 4)), std::runtime_error);
+    BOOST_CHECK_THROW(PanelSelfShadowingTable(Eigen::MatrixXd::Ones(2, 7), 2, 4), std::runtime_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace unit_tests
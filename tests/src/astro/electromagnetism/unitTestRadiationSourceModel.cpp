@@ -435,6 +435,86 @@ BOOST_AUTO_TEST_CASE( testDynamicallyPaneledRadiationSourceModel_PanelMoving )
     }
 }
 
+//! Test dynamically paneled source on whether parallel and serial panel evaluation give identical results
+BOOST_AUTO_TEST_CASE( testDynamicallyPaneledRadiationSourceModel_Parallel )
+{
+    const auto radius = 6000e3;
+    const std::vector<int> numberOfPanelsPerRing {6, 12, 18};
+
+    std::vector<std::shared_ptr<DynamicallyPaneledRadiationSourceModel>> radiationSourceModels;
+    for (int numberOfThreads : {1, 4})
+    {
+        std::vector<std::unique_ptr<SourcePanelRadiosityModel>> baseRadiosityModels;
+        baseRadiosityModels.push_back(std::make_unique<ConstantSourcePanelRadiosityModel>(2.5));
+
+        // Constant radiosity does not depend on original source
+        const std::map<std::string, std::shared_ptr<IsotropicPointRadiationSourceModel>>& originalSourceModels {};
+        const std::map<std::string, std::shared_ptr<basic_astrodynamics::BodyShapeModel>>& originalSourceBodyShapeModels {};
+        const std::map<std::string, std::function<Eigen::Vector3d()>>& originalSourcePositionFunctions {};
+        const std::map<std::string, std::shared_ptr<OccultationModel>>& originalSourceToSourceOccultationModels {};
+        auto sourcePanelRadiosityModelUpdater = std::make_unique<SourcePanelRadiosityModelUpdater>(
+                    [] { return Eigen::Vector3d::Zero(); },
+                    [] { return Eigen::Quaterniond::Identity(); },
+                    originalSourceModels, originalSourceBodyShapeModels, originalSourcePositionFunctions, originalSourceToSourceOccultationModels);
+
+        radiationSourceModels.push_back(std::make_shared<DynamicallyPaneledRadiationSourceModel>(
+                std::make_shared<basic_astrodynamics::SphericalBodyShapeModel>(radius),
+                std::move(sourcePanelRadiosityModelUpdater),
+                baseRadiosityModels,
+                numberOfPanelsPerRing,
+                numberOfThreads));
+    }
+    BOOST_CHECK_EQUAL(radiationSourceModels.at(1)->getNumberOfThreads(), 4);
+
+    const std::vector<Eigen::Vector3d> targetPositions {
+        (radius + 700e3) * Eigen::Vector3d(0.3, -0.2, 0.9).normalized(),
+        (radius + 20000e3) * Eigen::Vector3d(-0.6, 0.1, -0.4).normalized(),
+        (radius + 500e3) * Eigen::Vector3d(0, 0, -1) };
+
+    for (unsigned int i = 0; i < targetPositions.size(); ++i)
+    {
+        const Eigen::Vector3d& targetPosition = targetPositions.at(i);
+        for (auto& radiationSourceModel : radiationSourceModels)
+        {
+            radiationSourceModel->updateMembers(i);
+        }
+
+        const auto serialIrradianceList = radiationSourceModels.at(0)->evaluateIrradianceAtPosition(targetPosition);
+        const auto parallelIrradianceList = radiationSourceModels.at(1)->evaluateIrradianceAtPosition(targetPosition);
+
+        BOOST_CHECK_EQUAL(serialIrradianceList.size(), parallelIrradianceList.size());
+        auto parallelIt = parallelIrradianceList.begin();
+        for (const auto& serialIrradiance : serialIrradianceList)
+        {
+            BOOST_CHECK_EQUAL(serialIrradiance.first, parallelIt->first);
+            BOOST_CHECK_EQUAL(serialIrradiance.second, parallelIt->second);
+            ++parallelIt;
+        }
+        BOOST_CHECK_EQUAL(radiationSourceModels.at(0)->getVisibleArea(), radiationSourceModels.at(1)->getVisibleArea());
+
+        // Repeated evaluation at same position should give same result
+        const auto repeatedIrradianceList = radiationSourceModels.at(1)->evaluateIrradianceAtPosition(targetPosition);
+        BOOST_CHECK(repeatedIrradianceList == parallelIrradianceList);
+
+        // Cached ring layout should give same panels as generating the spherical cap directly
+        const auto expectedPanels = generatePaneledSphericalCap_EqualProjectedAttenuatedArea(
+                targetPosition, numberOfPanelsPerRing, radius);
+        const auto& expectedPanelCenters = std::get<0>(expectedPanels);
+        const auto& expectedAreas = std::get<3>(expectedPanels);
+        const auto& actualPanels = radiationSourceModels.at(0)->getPanels();
+        BOOST_CHECK_EQUAL(actualPanels.size(), expectedPanelCenters.size());
+        for (unsigned int j = 0; j < actualPanels.size(); ++j)
+        {
+            BOOST_CHECK_CLOSE_FRACTION(actualPanels.at(j).getArea(), expectedAreas.at(j), 1e-12);
+            for (int k = 0; k < 3; ++k)
+            {
+                BOOST_CHECK_SMALL(actualPanels.at(j).getRelativeCenter()(k) - expectedPanelCenters.at(j)(k),
+                                  1e-12 * radius);
+            }
+        }
+    }
+}
+
 //! Test polar/azimuth angle to latitude/longitude conversion in constructor
 BOOST_AUTO_TEST_CASE( testPaneledRadiationSourceModelPanel )
 {
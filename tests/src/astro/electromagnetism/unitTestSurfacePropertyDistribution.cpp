@@ -113,6 +113,45 @@ BOOST_AUTO_TEST_CASE( testSphericalHarmonicsSurfacePropertyDistribution )
     }
 }
 
+//! Test interpolation of spherical harmonics surface property distribution from tabulated grid
+BOOST_AUTO_TEST_CASE( testSphericalHarmonicsSurfacePropertyDistribution_Interpolation )
+{
+    Eigen::MatrixXd cosineCoefficients(3, 3);
+    cosineCoefficients << 0.3, 0.0, 0.0,
+                          0.02, 0.01, 0.0,
+                          -0.05, 0.004, 0.001;
+
+    Eigen::MatrixXd sineCoefficients(3, 3);
+    sineCoefficients << 0.0, 0.0, 0.0,
+                        0.0, 0.03, 0.0,
+                        0.0, -0.002, 0.003;
+
+    SphericalHarmonicsSurfacePropertyDistribution exactDistributionModel(cosineCoefficients, sineCoefficients);
+    SphericalHarmonicsSurfacePropertyDistribution interpolatedDistributionModel(cosineCoefficients, sineCoefficients);
+    interpolatedDistributionModel.setInterpolationGridResolution(PI / 720);
+    BOOST_CHECK_EQUAL(interpolatedDistributionModel.getInterpolationGridResolution(), PI / 720);
+
+    // Interpolation error is second order in grid resolution
+    for (const double latitude : {-PI / 2, -1.2, -0.3, 0.0, 0.7, 1.5, PI / 2})
+    {
+        for (const double longitude : {-PI, -2.9, -0.1, 1.0, 3.1, PI, 4 * PI + 0.2})
+        {
+            BOOST_CHECK_SMALL(interpolatedDistributionModel.getValue(latitude, longitude) -
+                              exactDistributionModel.getValue(latitude, longitude), 1.0e-6);
+        }
+    }
+
+    // Grid nodes are exact
+    BOOST_CHECK_CLOSE_FRACTION(interpolatedDistributionModel.getValue(PI / 4, PI / 2),
+                               exactDistributionModel.getValue(PI / 4, PI / 2), 1.0e-12);
+
+    // Disable interpolation
+    interpolatedDistributionModel.setInterpolationGridResolution(TUDAT_NAN);
+    BOOST_CHECK_EQUAL(interpolatedDistributionModel.getValue(0.7, 1.0), exactDistributionModel.getValue(0.7, 1.0));
+
+    BOOST_CHECK_THROW(interpolatedDistributionModel.setInterpolationGridResolution(-1.0), std::runtime_error);
+}
+
 //! Test if second-degree zonal surface property distribution is zonal
 BOOST_AUTO_TEST_CASE( testSecondDegreeZonalPeriodicSurfacePropertyDistribution_Zonality )
 {
@@ -0,0 +1,256 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/astro/ephemerides/conjunctionScreening.h"
+#include "tudat/astro/ephemerides/customEphemeris.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_conjunction_screening )
+
+//! Function to compute the state on a circular orbit about the Earth.
+/*!
+ *  Function to compute the state on a circular orbit about the Earth, with given radius, inclination and right ascension
+ *  of ascending node, passing through the ascending node at a given time.
+ */
+Eigen::Vector6d computeCircularOrbitState( const double time,
+                                           const double radius,
+                                           const double inclination,
+                                           const double ascendingNodeLongitude,
+                                           const double nodePassageTime )
+{
+    const double angularVelocity = std::sqrt( 3.986004418E14 / ( radius * radius * radius ) );
+    const double argumentOfLatitude = angularVelocity * ( time - nodePassageTime );
+
+    const Eigen::Vector3d nodeDirection( std::cos( ascendingNodeLongitude ), std::sin( ascendingNodeLongitude ), 0.0 );
+    const Eigen::Vector3d normalDirection(
+                std::sin( inclination ) * std::sin( ascendingNodeLongitude ),
+                -std::sin( inclination ) * std::cos( ascendingNodeLongitude ), std::cos( inclination ) );
+    const Eigen::Vector3d inPlaneDirection = normalDirection.cross( nodeDirection );
+
+    Eigen::Vector6d state;
+    state.segment< 3 >( 0 ) = radius * ( std::cos( argumentOfLatitude ) * nodeDirection +
+                                         std::sin( argumentOfLatitude ) * inPlaneDirection );
+    state.segment< 3 >( 3 ) = radius * angularVelocity * ( -std::sin( argumentOfLatitude ) * nodeDirection +
+                                                           std::cos( argumentOfLatitude ) * inPlaneDirection );
+    return state;
+}
+
+//! Function to create a set of circular orbits, of which several have close approaches
+std::vector< std::function< Eigen::Vector6d( const double ) > > getTestOrbits( )
+{
+    std::vector< std::function< Eigen::Vector6d( const double ) > > orbits;
+
+    // Pair crossing at the ascending node at t = 1000 s, with a radial separation of 500 m
+    orbits.push_back( std::bind( &computeCircularOrbitState, std::placeholders::_1, 7.0E6, 0.0, 0.0, 1000.0 ) );
+    orbits.push_back( std::bind( &computeCircularOrbitState, std::placeholders::_1, 7.0E6 + 500.0, 1.2, 0.0, 1000.0 ) );
+
+    // Set of orbits at similar altitudes, with different orientations and phasing
+    for( int i = 0; i < 38; i++ )
+    {
+        orbits.push_back( std::bind( &computeCircularOrbitState, std::placeholders::_1, 6.98E6 + 1.0E3 * i,
+                                     0.1 + 0.04 * i, 0.3 * i, 250.0 * i ) );
+    }
+
+    // Orbits at much higher altitude, which are removed by the perigee/apogee filter
+    for( int i = 0; i < 10; i++ )
+    {
+        orbits.push_back( std::bind( &computeCircularOrbitState, std::placeholders::_1, 2.0E7 + 1.0E3 * i,
+                                     0.5 + 0.05 * i, 0.2 * i, 100.0 * i ) );
+    }
+    return orbits;
+}
+
+//! Test screening of a catalogue against the analytical solution, and against a brute-force search.
+BOOST_AUTO_TEST_CASE( testCatalogueScreening )
+{
+    const std::vector< std::function< Eigen::Vector6d( const double ) > > orbits = getTestOrbits( );
+    const int numberOfObjects = orbits.size( );
+    const double screeningDistance = 50.0E3;
+
+    // Sample states on grid
+    std::vector< double > epochs;
+    for( int i = 0; i <= 300; i++ )
+    {
+        epochs.push_back( 20.0 * i );
+    }
+    Eigen::Matrix< double, 6, Eigen::Dynamic > catalogueStates( 6, epochs.size( ) * numberOfObjects );
+    for( unsigned int i = 0; i < epochs.size( ); i++ )
+    {
+        for( int j = 0; j < numberOfObjects; j++ )
+        {
+            catalogueStates.col( i * numberOfObjects + j ) = orbits.at( j )( epochs.at( i ) );
+        }
+    }
+
+    std::vector< ephemerides::ConjunctionEvent > events = ephemerides::screenCatalogueForConjunctions(
+                catalogueStates, epochs, numberOfObjects,
+                ephemerides::ConjunctionScreeningSettings( screeningDistance, 20.0, 1 ) );
+    std::vector< ephemerides::ConjunctionEvent > parallelEvents = ephemerides::screenCatalogueForConjunctions(
+                catalogueStates, epochs, numberOfObjects,
+                ephemerides::ConjunctionScreeningSettings( screeningDistance, 20.0, 4 ) );
+
+    // Check analytical close approach (Hermite interpolation with 20 s steps is accurate to well below a meter)
+    bool isAnalyticalEventFound = false;
+    for( unsigned int i = 0; i < events.size( ); i++ )
+    {
+        if( events.at( i ).firstObjectIndex == 0 && events.at( i ).secondObjectIndex == 1 &&
+                std::fabs( events.at( i ).timeOfClosestApproach - 1000.0 ) < 1.0 )
+        {
+            isAnalyticalEventFound = true;
+            BOOST_CHECK_SMALL( events.at( i ).timeOfClosestApproach - 1000.0, 1.0E-3 );
+            BOOST_CHECK_SMALL( events.at( i ).missDistance - 500.0, 1.0 );
+            BOOST_CHECK_EQUAL( events.at( i ).isCovarianceAvailable, false );
+        }
+    }
+    BOOST_CHECK( isAnalyticalEventFound );
+
+    // Check result independent of number of threads
+    BOOST_CHECK_EQUAL( events.size( ), parallelEvents.size( ) );
+    for( unsigned int i = 0; i < std::min( events.size( ), parallelEvents.size( ) ); i++ )
+    {
+        BOOST_CHECK_EQUAL( events.at( i ).firstObjectIndex, parallelEvents.at( i ).firstObjectIndex );
+        BOOST_CHECK_EQUAL( events.at( i ).secondObjectIndex, parallelEvents.at( i ).secondObjectIndex );
+        BOOST_CHECK_EQUAL( events.at( i ).timeOfClosestApproach, parallelEvents.at( i ).timeOfClosestApproach );
+        BOOST_CHECK_EQUAL( events.at( i ).missDistance, parallelEvents.at( i ).missDistance );
+    }
+
+    // Find all close approaches by brute force, from local minima of distance at 0.5 s resolution
+    int numberOfBruteForceEvents = 0;
+    for( int first = 0; first < numberOfObjects; first++ )
+    {
+        for( int second = first + 1; second < numberOfObjects; second++ )
+        {
+            double previousDistance = TUDAT_NAN, currentDistance = TUDAT_NAN;
+            for( double time = epochs.front( ); time <= epochs.back( ); time += 0.5 )
+            {
+                const double nextDistance = ( orbits.at( second )( time ) - orbits.at( first )( time ) ).segment< 3 >(
+                            0 ).norm( );
+                if( currentDistance < previousDistance && currentDistance <= nextDistance &&
+                        currentDistance < screeningDistance )
+                {
+                    numberOfBruteForceEvents++;
+
+                    // Check that the event has been found by the screening
+                    bool isEventFound = false;
+                    for( unsigned int i = 0; i < events.size( ); i++ )
+                    {
+                        if( events.at( i ).firstObjectIndex == first && events.at( i ).secondObjectIndex == second &&
+                                std::fabs( events.at( i ).timeOfClosestApproach - ( time - 0.5 ) ) < 0.5 )
+                        {
+                            isEventFound = true;
+
+                            // Check miss distance against sampled minimum, and against exact distance at TCA
+                            const double timeOfClosestApproach = events.at( i ).timeOfClosestApproach;
+                            BOOST_CHECK( events.at( i ).missDistance <= currentDistance + 1.0 );
+                            BOOST_CHECK_SMALL( events.at( i ).missDistance - (
+                                                   orbits.at( second )( timeOfClosestApproach ) -
+                                                   orbits.at( first )( timeOfClosestApproach ) ).segment< 3 >( 0 ).norm( ),
+                                               1.0 );
+                        }
+                    }
+                    BOOST_CHECK( isEventFound );
+                }
+                previousDistance = currentDistance;
+                currentDistance = nextDistance;
+            }
+        }
+    }
+    BOOST_CHECK( numberOfBruteForceEvents > 1 );
+    BOOST_CHECK_EQUAL( static_cast< int >( events.size( ) ), numberOfBruteForceEvents );
+
+    // Check that objects at high altitude do not appear in events
+    for( unsigned int i = 0; i < events.size( ); i++ )
+    {
+        BOOST_CHECK( events.at( i ).secondObjectIndex < 40 );
+        BOOST_CHECK( events.at( i ).missDistance <= screeningDistance );
+    }
+
+    // Check input errors
+    BOOST_CHECK_THROW( ephemerides::screenCatalogueForConjunctions(
+                           catalogueStates, epochs, numberOfObjects + 1,
+                           ephemerides::ConjunctionScreeningSettings( screeningDistance, 20.0 ) ), std::runtime_error );
+}
+
+//! Test screening of ephemerides, including refinement with the ephemerides and computation of covariances.
+BOOST_AUTO_TEST_CASE( testEphemerisScreening )
+{
+    const std::vector< std::function< Eigen::Vector6d( const double ) > > orbits = getTestOrbits( );
+    const int numberOfObjects = orbits.size( );
+
+    std::vector< std::shared_ptr< ephemerides::Ephemeris > > objectEphemerides;
+    std::vector< std::function< Eigen::Matrix6d( const double ) > > covarianceFunctions;
+    for( int i = 0; i < numberOfObjects; i++ )
+    {
+        objectEphemerides.push_back( std::make_shared< ephemerides::CustomEphemeris >( orbits.at( i ), "Earth", "J2000" ) );
+
+        // Define covariance growing linearly along-track, by a state transition matrix of linear motion
+        const Eigen::Matrix6d initialCovariance = ( 1.0 + i ) * Eigen::Matrix6d::Identity( );
+        covarianceFunctions.push_back( ephemerides::createPropagatedCovarianceFunction(
+                                           initialCovariance, [ ]( const double time )
+        {
+            Eigen::Matrix6d stateTransitionMatrix = Eigen::Matrix6d::Identity( );
+            stateTransitionMatrix.block< 3, 3 >( 0, 3 ) = time * Eigen::Matrix3d::Identity( );
+            return stateTransitionMatrix;
+        } ) );
+    }
+
+    // Use coarse steps, so that the result relies on the refinement using the ephemerides
+    std::vector< ephemerides::ConjunctionEvent > events = ephemerides::screenEphemeridesForConjunctions(
+                objectEphemerides, 0.0, 6000.0, ephemerides::ConjunctionScreeningSettings( 50.0E3, 60.0, 2, 1.0E-8 ),
+                covarianceFunctions );
+
+    bool isAnalyticalEventFound = false;
+    for( unsigned int i = 0; i < events.size( ); i++ )
+    {
+        if( events.at( i ).firstObjectIndex == 0 && events.at( i ).secondObjectIndex == 1 &&
+                std::fabs( events.at( i ).timeOfClosestApproach - 1000.0 ) < 1.0 )
+        {
+            isAnalyticalEventFound = true;
+            BOOST_CHECK_SMALL( events.at( i ).timeOfClosestApproach - 1000.0, 1.0E-6 );
+            BOOST_CHECK_SMALL( events.at( i ).missDistance - 500.0, 1.0E-6 );
+            BOOST_CHECK_SMALL( ( events.at( i ).relativeState - (
+                                     orbits.at( 1 )( 1000.0 ) - orbits.at( 0 )( 1000.0 ) ) ).norm( ), 1.0E-3 );
+        }
+
+        // Check combined covariance
+        const double time = events.at( i ).timeOfClosestApproach;
+        const double expectedVariance = ( 2.0 + events.at( i ).firstObjectIndex + events.at( i ).secondObjectIndex ) *
+                ( 1.0 + time * time );
+        BOOST_CHECK( events.at( i ).isCovarianceAvailable );
+        BOOST_CHECK_CLOSE_FRACTION( events.at( i ).combinedPositionCovariance( 0, 0 ), expectedVariance, 1.0E-14 );
+        BOOST_CHECK_EQUAL( events.at( i ).combinedPositionCovariance( 0, 1 ), 0.0 );
+    }
+    BOOST_CHECK( isAnalyticalEventFound );
+
+    covarianceFunctions.pop_back( );
+    BOOST_CHECK_THROW( ephemerides::screenEphemeridesForConjunctions(
+                           objectEphemerides, 0.0, 6000.0, ephemerides::ConjunctionScreeningSettings( 50.0E3, 60.0 ),
+                           covarianceFunctions ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
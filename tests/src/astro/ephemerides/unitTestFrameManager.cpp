@@ -141,6 +141,62 @@ BOOST_AUTO_TEST_CASE( test_FrameManager )
 
 }
 
+//! Test whether states of frames shared by multiple composite ephemerides are evaluated once per epoch when memoised
+BOOST_AUTO_TEST_CASE( test_FrameManagerStateMemoisation )
+{
+    // Create ephemerides that count the number of evaluations
+    std::map< std::string, int > numberOfEvaluations;
+    std::map< std::string, std::shared_ptr< Ephemeris > > ephemerisList;
+    std::vector< std::pair< std::string, std::string > > framesAndOrigins =
+    { { "EMB", getBaseFrameName( ) }, { "Earth", "EMB" }, { "Moon", "EMB" }, { "LAGEOS", "Earth" }, { "LRO", "Moon" } };
+    for( unsigned int i = 0; i < framesAndOrigins.size( ); i++ )
+    {
+        std::string frameName = framesAndOrigins.at( i ).first;
+        Eigen::Vector6d frameState = Eigen::Vector6d::Constant( static_cast< double >( i + 1 ) );
+        ephemerisList[ frameName ] = std::make_shared< ConstantEphemeris >(
+                    [ =, &numberOfEvaluations ]( ){ numberOfEvaluations[ frameName ]++; return frameState; },
+                framesAndOrigins.at( i ).second, "ECLIPJ2000" );
+    }
+
+    ReferenceFrameManager frameManager( ephemerisList );
+    std::shared_ptr< Ephemeris > lageosFromSsb = frameManager.getEphemeris( getBaseFrameName( ), "LAGEOS" );
+    std::shared_ptr< Ephemeris > lroFromSsb = frameManager.getEphemeris( getBaseFrameName( ), "LRO" );
+    std::shared_ptr< Ephemeris > lroFromLageos = frameManager.getEphemeris( "LAGEOS", "LRO" );
+
+    // Compute states without memoisation
+    Eigen::Vector6d lageosState = lageosFromSsb->getCartesianState( 0.0 );
+    Eigen::Vector6d lroState = lroFromSsb->getCartesianState( 0.0 );
+    Eigen::Vector6d lroFromLageosState = lroFromLageos->getCartesianState( 0.0 );
+    BOOST_CHECK_EQUAL( numberOfEvaluations[ "EMB" ], 2 );
+    BOOST_CHECK_EQUAL( numberOfEvaluations[ "Earth" ], 2 );
+    BOOST_CHECK_EQUAL( numberOfEvaluations[ "Moon" ], 2 );
+
+    // Compute states with memoisation, at two epochs
+    numberOfEvaluations.clear( );
+    frameManager.startFrameStateMemoisation( );
+    for( int i = 0; i < 2; i++ )
+    {
+        for( int j = 0; j < 2; j++ )
+        {
+            double currentTime = static_cast< double >( i ) * 60.0;
+            BOOST_CHECK_EQUAL( ( lageosFromSsb->getCartesianState( currentTime ) - lageosState ).norm( ), 0.0 );
+            BOOST_CHECK_EQUAL( ( lroFromSsb->getCartesianState( currentTime ) - lroState ).norm( ), 0.0 );
+            BOOST_CHECK_EQUAL( ( lroFromLageos->getCartesianState( currentTime ) - lroFromLageosState ).norm( ), 0.0 );
+        }
+    }
+    frameManager.stopFrameStateMemoisation( );
+
+    // Each frame is evaluated once per epoch
+    for( unsigned int i = 0; i < framesAndOrigins.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( numberOfEvaluations[ framesAndOrigins.at( i ).first ], 2 );
+    }
+
+    // Check that frames are re-evaluated after memoisation is stopped
+    lroFromSsb->getCartesianState( 0.0 );
+    BOOST_CHECK_EQUAL( numberOfEvaluations[ "EMB" ], 3 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -173,6 +173,51 @@ BOOST_AUTO_TEST_CASE( test_ItrsToGcrsRotationAgainstSofaCookbook )
     }
 }
 
+//! Test ITRS <-> GCRS rotation with interpolated Earth orientation angles, by comparing against direct computation
+BOOST_AUTO_TEST_CASE( test_ItrsToGcrsRotationWithInterpolatedAngles )
+{
+    std::shared_ptr< EarthOrientationAnglesCalculator > anglesCalculator =
+            earth_orientation::createStandardEarthOrientationCalculator( );
+
+    // Create interpolated angles over two days, and rotation models with and without interpolation
+    double startTime = 1.0E8;
+    double endTime = startTime + 2.0 * 86400.0;
+    double angularAccuracy = 1.0E-11;
+    std::shared_ptr< InterpolatedEarthOrientationAnglesCalculator > interpolatedAnglesCalculator =
+            std::make_shared< InterpolatedEarthOrientationAnglesCalculator >(
+                anglesCalculator, tdb_scale, startTime, endTime, angularAccuracy );
+    BOOST_CHECK( interpolatedAnglesCalculator->getMaximumInterpolationError( ) <= angularAccuracy );
+
+    std::shared_ptr< GcrsToItrsRotationModel > directRotationModel =
+            std::make_shared< GcrsToItrsRotationModel >( anglesCalculator, tdb_scale );
+    std::shared_ptr< GcrsToItrsRotationModel > interpolatedRotationModel =
+            std::make_shared< GcrsToItrsRotationModel >( anglesCalculator, tdb_scale, "GCRS", interpolatedAnglesCalculator );
+
+    // Compare rotation (and its derivative) in and outside of tabulated interval
+    for( double testTime = startTime - 3600.0; testTime < endTime + 3600.0; testTime += 1234.5 )
+    {
+        Eigen::Matrix3d directRotation = directRotationModel->getRotationToBaseFrame( testTime ).toRotationMatrix( );
+        Eigen::Matrix3d interpolatedRotation = interpolatedRotationModel->getRotationToBaseFrame( testTime ).toRotationMatrix( );
+        Eigen::Matrix3d interpolatedRotationFromTime =
+                interpolatedRotationModel->getRotationToBaseFrameFromExtendedTime( Time( testTime ) ).toRotationMatrix( );
+        Eigen::Matrix3d directRotationDerivative = directRotationModel->getDerivativeOfRotationToBaseFrame( testTime );
+        Eigen::Matrix3d interpolatedRotationDerivative =
+                interpolatedRotationModel->getDerivativeOfRotationToBaseFrame( testTime );
+
+        for( unsigned int i = 0; i < 3; i++ )
+        {
+            for( unsigned int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( directRotation( i, j ) - interpolatedRotation( i, j ) ), 5.0 * angularAccuracy );
+                BOOST_CHECK_SMALL( std::fabs( directRotation( i, j ) - interpolatedRotationFromTime( i, j ) ),
+                                   5.0 * angularAccuracy );
+                BOOST_CHECK_SMALL( std::fabs( directRotationDerivative( i, j ) - interpolatedRotationDerivative( i, j ) ),
+                                   5.0 * angularAccuracy * 7.3E-5 );
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -103,6 +103,36 @@ BOOST_AUTO_TEST_CASE( testKeplerEphemerisHyperbolic )
     }
 }
 
+//! Test 3: Comparison of batch evaluation of KeplerEphemeris with single evaluations.
+BOOST_AUTO_TEST_CASE( testKeplerEphemerisBatchEvaluation )
+{
+    for( int test = 0; test < 2; test++ )
+    {
+        // Create elliptical (test 0) or hyperbolic (test 1) ephemeris
+        PropagationHistory benchmarkData = ( test == 0 ) ? getODTBXBenchmarkData( ) : getGTOPBenchmarkData( );
+        const double gravitationalParameter = ( test == 0 ) ? 398600.4415e9 : getGTOPGravitationalParameter( );
+        ephemerides::KeplerEphemeris keplerEphemeris(
+                    benchmarkData.begin( )->second, 0.0, gravitationalParameter );
+
+        std::vector< double > epochs;
+        for( auto stateIterator : benchmarkData )
+        {
+            epochs.push_back( stateIterator.first );
+            epochs.push_back( -0.5 * stateIterator.first );
+        }
+
+        Eigen::Matrix< double, Eigen::Dynamic, 6 > cartesianStates = keplerEphemeris.getCartesianStates( epochs );
+        BOOST_CHECK_EQUAL( cartesianStates.rows( ), static_cast< int >( epochs.size( ) ) );
+        for( unsigned int i = 0; i < epochs.size( ); i++ )
+        {
+            Eigen::Vector6d expectedState = keplerEphemeris.getCartesianState( epochs.at( i ) );
+            Eigen::Vector6d computedState = cartesianStates.row( i ).transpose( );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( computedState.segment( 0, 3 ), expectedState.segment( 0, 3 ), 1.0E-12 );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( computedState.segment( 3, 3 ), expectedState.segment( 3, 3 ), 1.0E-12 );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -18,6 +18,9 @@
 #include "tudat/basics/testMacros.h"
 
 #include "tudat/astro/ephemerides/approximatePlanetPositions.h"
+#include "tudat/astro/ephemerides/chebyshevEphemeris.h"
+#include "tudat/astro/ephemerides/constantEphemeris.h"
+#include "tudat/astro/ephemerides/multiArcEphemeris.h"
 #include "tudat/astro/ephemerides/tabulatedEphemeris.h"
 #include "tudat/basics/basicTypedefs.h"
 #include "tudat/math/interpolators/cubicSplineInterpolator.h"
@@ -174,6 +177,124 @@ BOOST_AUTO_TEST_CASE( testTabulatedEphemeris )
 
 }
 
+//! Test the functionality of the Chebyshev ephemeris, fitted to tabulated data
+BOOST_AUTO_TEST_CASE( testChebyshevEphemeris )
+{
+    using namespace ephemerides;
+
+    // Generate state history map from ephemeris
+    std::shared_ptr< ApproximateJplEphemeris > marsNominalEphemeris =
+            std::make_shared< ApproximateJplEphemeris >( "Mars" );
+    std::map< double, Eigen::Vector6d > marsStateHistoryMap = getStateHistoryMap< Eigen::Vector6d >(
+                marsNominalEphemeris );
+
+    // Create Chebyshev ephemeris from state history
+    const double positionTolerance = 5.0E-2;
+    const double velocityTolerance = 1.0E-8;
+    std::shared_ptr< ChebyshevCartesianEphemeris > chebyshevEphemeris =
+            std::make_shared< ChebyshevCartesianEphemeris >(
+                marsStateHistoryMap, positionTolerance, velocityTolerance, 8, "SSB", "J2000" );
+
+    BOOST_CHECK( isTabulatedEphemeris( chebyshevEphemeris ) );
+    BOOST_CHECK_EQUAL( getTabulatedEphemerisSafeInterval( chebyshevEphemeris ).first, 0.0 );
+    BOOST_CHECK_EQUAL( getTabulatedEphemerisSafeInterval( chebyshevEphemeris ).second, 1.0E7 );
+    BOOST_CHECK( chebyshevEphemeris->getNumberOfSegments( ) > 1 );
+    BOOST_CHECK( chebyshevEphemeris->getMaximumFitErrors( ).first <= positionTolerance );
+    BOOST_CHECK( chebyshevEphemeris->getMaximumFitErrors( ).second <= velocityTolerance );
+
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        std::shared_ptr< ApproximateJplEphemeris > nominalEphemeris = marsNominalEphemeris;
+
+        // Reset Chebyshev ephemeris with new data
+        if( test == 1 )
+        {
+            nominalEphemeris = std::make_shared< ApproximateJplEphemeris >( "Jupiter" );
+            chebyshevEphemeris->resetStateHistory( getStateHistoryMap( nominalEphemeris ) );
+            BOOST_CHECK( chebyshevEphemeris->getMaximumFitErrors( ).first <= positionTolerance );
+            BOOST_CHECK( chebyshevEphemeris->getMaximumFitErrors( ).second <= velocityTolerance );
+        }
+
+        // Compare Chebyshev and direct ephemeris, at (and in between) tabulated epochs, and at the edges of the interval
+        std::vector< double > testTimes = { 0.0, 1.9337E5, 5.836392E6, 6.0E6, 9.99999E6, 1.0E7 };
+        for( unsigned int i = 0; i < testTimes.size( ); i++ )
+        {
+            Eigen::Vector6d stateDifference = chebyshevEphemeris->getCartesianState( testTimes.at( i ) ) -
+                    nominalEphemeris->getCartesianState( testTimes.at( i ) );
+            BOOST_CHECK_SMALL( stateDifference.segment( 0, 3 ).norm( ), positionTolerance );
+            BOOST_CHECK_SMALL( stateDifference.segment( 3, 3 ).norm( ), velocityTolerance );
+        }
+    }
+
+    // Check that ephemeris cannot be evaluated outside of tabulated interval
+    bool isExceptionCaught = false;
+    try
+    {
+        chebyshevEphemeris->getCartesianState( 1.0E7 + 1.0 );
+    }
+    catch( std::runtime_error const& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+}
+
+//! Test the selection of the arc ephemeris in the multi-arc ephemeris
+BOOST_AUTO_TEST_CASE( testMultiArcEphemerisArcSelection )
+{
+    using namespace ephemerides;
+
+    // Test equidistant (O(1) lookup) and non-equidistant arc start times
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        std::vector< double > arcStartTimes = { 0.0, 10.0, 20.0, 30.0, 40.0 };
+        if( test == 1 )
+        {
+            arcStartTimes = { 0.0, 5.0, 20.0, 21.0, 40.0 };
+        }
+
+        // Create arc ephemerides, with the arc index as state entry.
+        std::map< double, std::shared_ptr< Ephemeris > > singleArcEphemerides;
+        for( unsigned int i = 0; i < arcStartTimes.size( ); i++ )
+        {
+            singleArcEphemerides[ arcStartTimes.at( i ) ] = std::make_shared< ConstantEphemeris >(
+                        Eigen::Vector6d::Constant( static_cast< double >( i ) ) );
+        }
+        MultiArcEphemeris multiArcEphemeris( singleArcEphemerides );
+
+        // Check arc selection in forward, backward and random order
+        std::vector< double > testTimes = { -100.0, 0.0, 4.9, 5.0, 9.99, 10.0, 15.0, 20.0, 20.5, 21.0, 39.9, 40.0, 1.0E6 };
+        std::vector< double > testTimesToEvaluate = testTimes;
+        testTimesToEvaluate.insert( testTimesToEvaluate.end( ), testTimes.rbegin( ), testTimes.rend( ) );
+        testTimesToEvaluate.push_back( 21.0 );
+        testTimesToEvaluate.push_back( -1.0 );
+        testTimesToEvaluate.push_back( 40.0 );
+        testTimesToEvaluate.push_back( 15.0 );
+
+        for( unsigned int i = 0; i < testTimesToEvaluate.size( ); i++ )
+        {
+            double currentTime = testTimesToEvaluate.at( i );
+            int expectedArc = static_cast< int >(
+                        std::upper_bound( arcStartTimes.begin( ) + 1, arcStartTimes.end( ), currentTime ) -
+                        arcStartTimes.begin( ) ) - 1;
+            BOOST_CHECK_EQUAL( multiArcEphemeris.getCartesianState( currentTime )( 0 ), expectedArc );
+            BOOST_CHECK_EQUAL( multiArcEphemeris.getCartesianLongState( currentTime )( 0 ), expectedArc );
+            BOOST_CHECK_EQUAL( multiArcEphemeris.getCartesianStateFromExtendedTime( Time( currentTime ) )( 0 ), expectedArc );
+        }
+    }
+
+    // Check that arc start times that are not strictly increasing are rejected.
+    std::map< double, std::shared_ptr< Ephemeris > > noArcEphemerides;
+    MultiArcEphemeris multiArcEphemeris( noArcEphemerides );
+    std::vector< std::shared_ptr< Ephemeris > > arcEphemerides(
+                2, std::make_shared< ConstantEphemeris >( Eigen::Vector6d::Zero( ) ) );
+    BOOST_CHECK_THROW( multiArcEphemeris.resetSingleArcEphemerides( arcEphemerides, { 10.0, 10.0 } ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( multiArcEphemeris.resetSingleArcEphemerides( arcEphemerides, { 10.0 } ),
+                       std::runtime_error );
+    BOOST_CHECK_NO_THROW( multiArcEphemeris.resetSingleArcEphemerides( arcEphemerides, { 0.0, 10.0 } ) );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -21,6 +21,7 @@
 #include "tudat/math/basic/linearAlgebra.h"
 #include "tudat/math/interpolators/lagrangeInterpolator.h"
 #include "tudat/astro/ephemerides/tabulatedRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/interpolatedRotationalEphemeris.h"
 #include "tudat/astro/basic_astro/physicalConstants.h"
 #include "tudat/interface/spice/spiceInterface.h"
 #include "tudat/io/basicInputOutput.h"
@@ -163,6 +164,128 @@ BOOST_AUTO_TEST_CASE( testTabulatedRotationalEphemeris )
 
 }
 
+//! Rotation model with precession, nutation and rotation about the body-fixed z-axis, with analytical angular velocity
+class PrecessingRotationalEphemeris: public RotationalEphemeris
+{
+public:
+    PrecessingRotationalEphemeris( ):
+        RotationalEphemeris( "ECLIPJ2000", "Body_Fixed" ),
+        precessionRate_( 1.0E-7 ), obliquity_( 0.4 ), nutationAmplitude_( 1.0E-4 ), nutationFrequency_( 2.0E-6 ),
+        rotationRate_( 7.0E-5 ){ }
+
+    Eigen::Quaterniond getRotationToBaseFrame( const double time )
+    {
+        return Eigen::AngleAxisd( precessionRate_ * time, Eigen::Vector3d::UnitZ( ) ) *
+                Eigen::AngleAxisd( obliquity_ + nutationAmplitude_ * std::sin( nutationFrequency_ * time ),
+                                   Eigen::Vector3d::UnitX( ) ) *
+                Eigen::AngleAxisd( rotationRate_ * time, Eigen::Vector3d::UnitZ( ) );
+    }
+
+    Eigen::Quaterniond getRotationToTargetFrame( const double time )
+    {
+        return getRotationToBaseFrame( time ).inverse( );
+    }
+
+    Eigen::Vector3d getRotationalVelocityVectorInBaseFrame( const double time )
+    {
+        Eigen::Quaterniond precessionRotation( Eigen::AngleAxisd( precessionRate_ * time, Eigen::Vector3d::UnitZ( ) ) );
+        Eigen::Quaterniond nutationRotation( Eigen::AngleAxisd(
+                    obliquity_ + nutationAmplitude_ * std::sin( nutationFrequency_ * time ), Eigen::Vector3d::UnitX( ) ) );
+        return precessionRate_ * Eigen::Vector3d::UnitZ( ) + precessionRotation * (
+                    nutationAmplitude_ * nutationFrequency_ * std::cos( nutationFrequency_ * time ) * Eigen::Vector3d::UnitX( ) +
+                    nutationRotation * ( rotationRate_ * Eigen::Vector3d::UnitZ( ) ) );
+    }
+
+    Eigen::Matrix3d getDerivativeOfRotationToTargetFrame( const double time )
+    {
+        return getDerivativeOfRotationMatrixToFrame(
+                    Eigen::Matrix3d( getRotationToTargetFrame( time ) ), getRotationalVelocityVectorInBaseFrame( time ) );
+    }
+
+    Eigen::Matrix3d getDerivativeOfRotationToBaseFrame( const double time )
+    {
+        return getDerivativeOfRotationToTargetFrame( time ).transpose( );
+    }
+
+private:
+    double precessionRate_;
+    double obliquity_;
+    double nutationAmplitude_;
+    double nutationFrequency_;
+    double rotationRate_;
+};
+
+//! Test interpolation of pre-tabulated rotation model, by comparing with direct evaluation of the rotation model
+BOOST_AUTO_TEST_CASE( testInterpolatedRotationalEphemeris )
+{
+    std::shared_ptr< RotationalEphemeris > originalRotationModel = std::make_shared< PrecessingRotationalEphemeris >( );
+
+    double startTime = 1.0E8;
+    double endTime = startTime + 2.0 * physical_constants::JULIAN_DAY;
+    double angularAccuracy = 1.0E-10;
+    std::shared_ptr< InterpolatedRotationalEphemeris > interpolatedRotationModel =
+            std::make_shared< InterpolatedRotationalEphemeris >(
+                originalRotationModel, startTime, endTime, angularAccuracy );
+
+    BOOST_CHECK_EQUAL( interpolatedRotationModel->getBaseFrameOrientation( ), "ECLIPJ2000" );
+    BOOST_CHECK_EQUAL( interpolatedRotationModel->getTargetFrameOrientation( ), "Body_Fixed" );
+    BOOST_CHECK( interpolatedRotationModel->getMaximumInterpolationError( ) <= angularAccuracy );
+    BOOST_CHECK( interpolatedRotationModel->getTimeStep( ) < 3600.0 );
+
+    // Compare interpolated and directly computed rotation at (non-node) times in the tabulated interval, and at its edges
+    std::vector< double > testTimes;
+    for( int i = 0; i < 1000; i++ )
+    {
+        testTimes.push_back( startTime + ( endTime - startTime ) * ( static_cast< double >( i ) + 0.37 ) / 1000.0 );
+    }
+    testTimes.push_back( startTime );
+    testTimes.push_back( endTime );
+
+    for( double currentTime : testTimes )
+    {
+        Eigen::Quaterniond expectedRotationToBaseFrame = originalRotationModel->getRotationToBaseFrame( currentTime );
+        Eigen::Vector3d expectedAngularVelocity = originalRotationModel->getRotationalVelocityVectorInBaseFrame( currentTime );
+        Eigen::Matrix3d expectedRotationDerivative = originalRotationModel->getDerivativeOfRotationToTargetFrame( currentTime );
+
+        BOOST_CHECK_SMALL( interpolatedRotationModel->getRotationToBaseFrame( currentTime ).angularDistance(
+                               expectedRotationToBaseFrame ), 2.0 * angularAccuracy );
+        BOOST_CHECK_SMALL( interpolatedRotationModel->getRotationToTargetFrame( currentTime ).angularDistance(
+                               expectedRotationToBaseFrame.inverse( ) ), 2.0 * angularAccuracy );
+        BOOST_CHECK_SMALL( ( interpolatedRotationModel->getRotationalVelocityVectorInBaseFrame( currentTime ) -
+                             expectedAngularVelocity ).norm( ), 1.0E-8 * expectedAngularVelocity.norm( ) );
+        BOOST_CHECK_SMALL( ( interpolatedRotationModel->getRotationalVelocityVectorInTargetFrame( currentTime ) -
+                             expectedRotationToBaseFrame.inverse( ) * expectedAngularVelocity ).norm( ),
+                           1.0E-8 * expectedAngularVelocity.norm( ) );
+        BOOST_CHECK_SMALL( ( interpolatedRotationModel->getDerivativeOfRotationToTargetFrame( currentTime ) -
+                             expectedRotationDerivative ).norm( ), 1.0E-8 * expectedRotationDerivative.norm( ) );
+
+        // Check that full rotational state is consistent with individual functions
+        Eigen::Quaterniond rotationToTargetFrame;
+        Eigen::Matrix3d rotationDerivative;
+        Eigen::Vector3d angularVelocity;
+        interpolatedRotationModel->getFullRotationalQuantitiesToTargetFrame(
+                    rotationToTargetFrame, rotationDerivative, angularVelocity, currentTime );
+        BOOST_CHECK_SMALL( rotationToTargetFrame.angularDistance(
+                               interpolatedRotationModel->getRotationToTargetFrame( currentTime ) ), 1.0E-15 );
+        BOOST_CHECK_SMALL( ( rotationDerivative - interpolatedRotationModel->getDerivativeOfRotationToTargetFrame(
+                                 currentTime ) ).norm( ), 1.0E-15 * rotationDerivative.norm( ) );
+        BOOST_CHECK_SMALL( ( angularVelocity - interpolatedRotationModel->getRotationalVelocityVectorInBaseFrame(
+                                 currentTime ) ).norm( ), 1.0E-15 * angularVelocity.norm( ) );
+    }
+
+    // Check that original model is used outside of tabulated interval
+    for( double currentTime : { startTime - 100.0, endTime + 100.0 } )
+    {
+        BOOST_CHECK_EQUAL( interpolatedRotationModel->getRotationToBaseFrame( currentTime ).coeffs( ),
+                           originalRotationModel->getRotationToBaseFrame( currentTime ).coeffs( ) );
+        BOOST_CHECK_EQUAL( interpolatedRotationModel->getRotationalVelocityVectorInBaseFrame( currentTime ),
+                           originalRotationModel->getRotationalVelocityVectorInBaseFrame( currentTime ) );
+    }
+
+    BOOST_CHECK_THROW( std::make_shared< InterpolatedRotationalEphemeris >(
+                           originalRotationModel, endTime, startTime, angularAccuracy ), std::runtime_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
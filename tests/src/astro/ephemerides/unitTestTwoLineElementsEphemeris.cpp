@@ -61,6 +61,56 @@ BOOST_AUTO_TEST_CASE( testTwoLineElementsEphemeris )
 
 }
 
+//! Test the propagation of a catalogue of two-line elements to a common grid of epochs
+BOOST_AUTO_TEST_CASE( testTwoLineElementsCataloguePropagation )
+{
+	using namespace tudat;
+	using namespace tudat::ephemerides;
+
+	// Create catalogue data as read from a two-line elements file (name line, followed by two element lines)
+	std::vector< input_output::TwoLineElementData > catalogueData( 2 );
+	catalogueData[ 0 ].twoLineElementStrings =
+	{ "VANGUARD 1",
+	  "1 00005U 58002B   00179.78495062  .00000023  00000-0  28098-4 0  4753",
+	  "2 00005  34.2682 348.7242 1859667 331.7664  19.3264 10.82419157413667" };
+	catalogueData[ 1 ].twoLineElementStrings =
+	{ "DELTA 1 DEB",
+	  "1 06251U 62025E   06176.82412014  .00008885  00000-0  12808-3 0  3985",
+	  "2 06251  58.0579  54.0425 0030035 139.1568 221.1854 15.56387291  6774" };
+	std::vector< std::shared_ptr< Tle > > tles = createTlesFromTwoLineElementData( catalogueData );
+	BOOST_CHECK_EQUAL( tles.size( ), 2 );
+
+	// Define common grid of epochs
+	std::vector< double > epochs;
+	for( int i = 0; i < 5; i++ )
+	{
+		epochs.push_back( tles.at( 1 )->getEpoch( ) + static_cast< double >( i ) * 3600.0 );
+	}
+
+	for( std::string frameOrientation : { "J2000", "ECLIPJ2000" } )
+	{
+		// Propagate full catalogue, and compare with states of individual ephemerides
+		Eigen::Matrix< double, 6, Eigen::Dynamic > catalogueStates = propagateTleCatalogue(
+					tles, epochs, frameOrientation, 2 );
+		BOOST_CHECK_EQUAL( catalogueStates.cols( ), 10 );
+
+		for( unsigned int j = 0; j < tles.size( ); j++ )
+		{
+			TleEphemeris tleEphemeris( "Earth", frameOrientation, tles.at( j ), false );
+			for( unsigned int i = 0; i < epochs.size( ); i++ )
+			{
+				Eigen::Vector6d catalogueState = catalogueStates.col( i * tles.size( ) + j );
+				Eigen::Vector6d ephemerisState = tleEphemeris.getCartesianState( epochs.at( i ) );
+				BOOST_CHECK_SMALL( ( catalogueState - ephemerisState ).segment( 0, 3 ).norm( ), 1.0E-6 );
+				BOOST_CHECK_SMALL( ( catalogueState - ephemerisState ).segment( 3, 3 ).norm( ), 1.0E-9 );
+			}
+		}
+	}
+
+	// Check that an unsupported frame is rejected
+	BOOST_CHECK_THROW( propagateTleCatalogue( tles, epochs, "IAU_Earth" ), std::runtime_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -332,6 +332,29 @@ BOOST_AUTO_TEST_CASE( testSphericalGravitationalTorque )
         {
             BOOST_CHECK_SMALL( std::fabs( torqueError( i ) ), 1.0E-14 * currentExplicitTorque.norm( ) );
         }
+
+        // Create spherical harmonic acceleration of the Moon on the Earth, and check that it shares its cache with the torque
+        std::shared_ptr< SphericalHarmonicGravitationalTorqueModel > sphericalHarmonicTorqueModel =
+                std::dynamic_pointer_cast< SphericalHarmonicGravitationalTorqueModel >(
+                    sphercialHarmonicGravitationalTorque );
+        std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > sphericalHarmonicAcceleration =
+                std::dynamic_pointer_cast< SphericalHarmonicsGravitationalAccelerationModel >(
+                    createSphericalHarmonicsGravityAcceleration(
+                        bodies.at( "Earth" ), bodies.at( "Moon" ), "Earth", "Moon",
+                        std::make_shared< SphericalHarmonicAccelerationSettings >( 4, 4 ), false ) );
+        BOOST_CHECK( sphericalHarmonicAcceleration->getSphericalHarmonicsCache( ) ==
+                     sphericalHarmonicTorqueModel->getSphericalHarmonicAcceleration( )->getSphericalHarmonicsCache( ) );
+
+        // Recompute torque after the acceleration has updated the shared cache (to a larger degree), and check result
+        sphericalHarmonicAcceleration->updateMembers( evaluationTime );
+        sphericalHarmonicTorqueModel->getSphericalHarmonicAcceleration( )->resetCurrentTime( );
+        sphericalHarmonicTorqueModel->updateMembers( evaluationTime );
+        Eigen::Vector3d recomputedSphericalHarmonicTorque = sphericalHarmonicTorqueModel->getTorque( );
+        for( unsigned int i = 0; i < 3; i++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( recomputedSphericalHarmonicTorque( i ) - currentSphericalHarmonicTorque( i ) ),
+                               1.0E-15 * currentSphericalHarmonicTorque.norm( ) );
+        }
     }
 }
 
@@ -22,6 +22,7 @@
 
 #include "tudat/astro/gravitation/basicSolidBodyTideGravityFieldVariations.h"
 #include "tudat/astro/gravitation/gravityFieldVariations.h"
+#include "tudat/astro/gravitation/periodicGravityFieldVariations.h"
 #include "tudat/astro/gravitation/timeDependentSphericalHarmonicsGravityField.h"
 #include "tudat/astro/gravitation/tabulatedGravityFieldVariations.h"
 #include "tudat/interface/spice/spiceInterface.h"
@@ -514,6 +515,150 @@ BOOST_AUTO_TEST_CASE( testPeriodicGravityFieldVariations )
 }
 
 
+BOOST_AUTO_TEST_CASE( testInPlaceGravityFieldVariationUpdate )
+{
+    // Define nominal field
+    Eigen::MatrixXd nominalCosineCoefficients = Eigen::MatrixXd::Zero( 10, 10 );
+    Eigen::MatrixXd nominalSineCoefficients = Eigen::MatrixXd::Zero( 10, 10 );
+    for( int i = 0; i < 10; i++ )
+    {
+        for( int j = 0; j <= i; j++ )
+        {
+            nominalCosineCoefficients( i, j ) = 1.0E-6 / static_cast< double >( i + j + 1 );
+            if( j > 0 )
+            {
+                nominalSineCoefficients( i, j ) = -2.0E-7 / static_cast< double >( i + 1 );
+            }
+        }
+    }
+    nominalCosineCoefficients( 0, 0 ) = 1.0;
+
+    // Create periodic variations
+    std::vector< Eigen::MatrixXd > cosineAmplitudes, sineAmplitudes;
+    std::vector< double > frequencies, phases;
+    double referenceEpoch;
+    int minimumDegree, minimumOrder;
+    getPeriodicGravityFieldVariationSettings(
+                cosineAmplitudes, sineAmplitudes, frequencies, phases, referenceEpoch, minimumDegree, minimumOrder, 2 );
+    std::shared_ptr< PeriodicGravityFieldVariations > periodicVariations =
+            std::make_shared< PeriodicGravityFieldVariations >(
+                cosineAmplitudes, sineAmplitudes, frequencies, phases, referenceEpoch, minimumDegree, minimumOrder );
+
+    // Create tidal variations, raised by a single body with a settable position.
+    Eigen::Vector6d deformingBodyState = Eigen::Vector6d::Zero( );
+    deformingBodyState.segment( 0, 3 ) << 2.0E8, -1.0E8, 5.0E7;
+    std::map< int, std::vector< std::complex< double > > > loveNumbers;
+    loveNumbers[ 2 ] = std::vector< std::complex< double > >( 3, std::complex< double >( 0.3, 1.0E-3 ) );
+    loveNumbers[ 3 ] = std::vector< std::complex< double > >( 4, std::complex< double >( 0.1, -2.0E-4 ) );
+    double massRatio = 0.0123;
+    double referenceRadius = 6.4E6;
+    std::shared_ptr< BasicSolidBodyTideGravityFieldVariations > tidalVariations =
+            std::make_shared< BasicSolidBodyTideGravityFieldVariations >(
+                [ ]( const double ){ return Eigen::Vector6d::Zero( ).eval( ); },
+                [ ]( const double ){ return Eigen::Quaterniond( Eigen::Matrix3d::Identity( ) ); },
+                std::vector< std::function< Eigen::Vector6d( const double ) > >(
+                    { [ & ]( const double ){ return deformingBodyState; } } ),
+                referenceRadius, [ ]( ){ return 1.0; },
+                std::vector< std::function< double( ) > >( { [ = ]( ){ return massRatio; } } ),
+                loveNumbers, std::vector< std::string >( { "Moon" } ) );
+
+    // Check tidal corrections of all degrees against direct computation
+    {
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > directCorrections =
+                calculateSolidBodyTideSingleCoefficientSetCorrectionFromAmplitude(
+                    loveNumbers, massRatio, referenceRadius, deformingBodyState.segment( 0, 3 ), 3, 3 );
+        Eigen::MatrixXd cosineCorrections, sineCorrections;
+        tidalVariations->calculateSphericalHarmonicsCorrectionBlocks( 0.0, cosineCorrections, sineCorrections );
+        BOOST_CHECK_EQUAL( cosineCorrections.rows( ), 2 );
+        BOOST_CHECK_EQUAL( cosineCorrections.cols( ), 4 );
+        for( int i = 0; i < 2; i++ )
+        {
+            for( int j = 0; j < 4; j++ )
+            {
+                BOOST_CHECK_SMALL( cosineCorrections( i, j ) - directCorrections.first( i + 2, j ),
+                                   1.0E-15 * std::fabs( directCorrections.first( 2, 0 ) ) );
+                BOOST_CHECK_SMALL( sineCorrections( i, j ) - directCorrections.second( i + 2, j ),
+                                   1.0E-15 * std::fabs( directCorrections.first( 2, 0 ) ) );
+            }
+        }
+    }
+
+    for( int test = 0; test < 2; test++ )
+    {
+        std::vector< std::shared_ptr< GravityFieldVariations > > variationObjects = { periodicVariations };
+        std::vector< BodyDeformationTypes > variationTypes = { periodic_variation };
+        std::vector< std::string > variationIdentifiers = { "" };
+        if( test == 1 )
+        {
+            variationObjects.push_back( tidalVariations );
+            variationTypes.push_back( basic_solid_body );
+            variationIdentifiers.push_back( "Moon" );
+        }
+
+        std::shared_ptr< TimeDependentSphericalHarmonicsGravityField > timeDependentGravityField =
+                std::make_shared< TimeDependentSphericalHarmonicsGravityField >(
+                    3.986E14, referenceRadius, nominalCosineCoefficients, nominalSineCoefficients,
+                    std::make_shared< GravityFieldVariationsSet >( variationObjects, variationTypes, variationIdentifiers ) );
+        BOOST_CHECK_EQUAL( timeDependentGravityField->areVariationsTimeDependentOnly( ), ( test == 0 ) );
+
+        // Update at a sequence of times, and compare with separately computed corrections
+        std::vector< double > testTimes = { 1.0E7, 2.0E7, 2.0E7, 1.0E7 };
+        for( unsigned int k = 0; k < testTimes.size( ); k++ )
+        {
+            timeDependentGravityField->update( testTimes.at( k ) );
+
+            Eigen::MatrixXd expectedCosineCoefficients = nominalCosineCoefficients;
+            Eigen::MatrixXd expectedSineCoefficients = nominalSineCoefficients;
+            for( unsigned int j = 0; j < variationObjects.size( ); j++ )
+            {
+                std::pair< Eigen::MatrixXd, Eigen::MatrixXd > corrections =
+                        variationObjects.at( j )->calculateSphericalHarmonicsCorrections( testTimes.at( k ) );
+                expectedCosineCoefficients.block(
+                            variationObjects.at( j )->getMinimumDegree( ), variationObjects.at( j )->getMinimumOrder( ),
+                            corrections.first.rows( ), corrections.first.cols( ) ) += corrections.first;
+                expectedSineCoefficients.block(
+                            variationObjects.at( j )->getMinimumDegree( ), variationObjects.at( j )->getMinimumOrder( ),
+                            corrections.second.rows( ), corrections.second.cols( ) ) += corrections.second;
+            }
+
+            for( int i = 0; i < 10; i++ )
+            {
+                for( int j = 0; j < 10; j++ )
+                {
+                    BOOST_CHECK_SMALL( timeDependentGravityField->getCosineCoefficients( )( i, j ) -
+                                       expectedCosineCoefficients( i, j ), 1.0E-18 );
+                    BOOST_CHECK_SMALL( timeDependentGravityField->getSineCoefficients( )( i, j ) -
+                                       expectedSineCoefficients( i, j ), 1.0E-18 );
+                }
+            }
+        }
+
+        // Modify coefficients directly, and check that they are only recomputed at the same time if the variations
+        // depend on the state of other bodies
+        timeDependentGravityField->setCosineCoefficients( Eigen::MatrixXd::Zero( 10, 10 ) );
+        timeDependentGravityField->update( testTimes.back( ) );
+        BOOST_CHECK_EQUAL( timeDependentGravityField->getCosineCoefficients( )( 0, 0 ), ( test == 0 ) ? 0.0 : 1.0 );
+
+        timeDependentGravityField->resetCurrentTime( );
+        timeDependentGravityField->update( testTimes.back( ) );
+        BOOST_CHECK_EQUAL( timeDependentGravityField->getCosineCoefficients( )( 0, 0 ), 1.0 );
+
+        // Modify nominal coefficients, and check that they are always used at the next update
+        timeDependentGravityField->setNominalCosineCoefficient( 0, 0, 2.0 );
+        timeDependentGravityField->update( testTimes.back( ) );
+        BOOST_CHECK_EQUAL( timeDependentGravityField->getCosineCoefficients( )( 0, 0 ), 2.0 );
+
+        // Modify state of tide-raising body, and check that tidal corrections are updated at the same time
+        if( test == 1 )
+        {
+            Eigen::MatrixXd previousCosineCoefficients = timeDependentGravityField->getCosineCoefficients( );
+            deformingBodyState.segment( 0, 3 ) *= 0.9;
+            timeDependentGravityField->update( testTimes.back( ) );
+            BOOST_CHECK( timeDependentGravityField->getCosineCoefficients( )( 2, 0 ) != previousCosineCoefficients( 2, 0 ) );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -232,6 +232,17 @@ BOOST_AUTO_TEST_CASE( testMutualSphericalHarmonicGravity )
                            15.0 * std::numeric_limits< double >::epsilon( ) * expectedAcceleration.norm( ) );
     }
 
+    // Check that concurrent computation of the two expansions gives identical results
+    BOOST_CHECK_THROW( mutualDirectJupiterIoShGravity->setNumberOfThreads( 0 ), std::runtime_error );
+    mutualDirectJupiterIoShGravity->setNumberOfThreads( 2 );
+    BOOST_CHECK_EQUAL( mutualDirectJupiterIoShGravity->getNumberOfThreads( ), 2 );
+    mutualDirectJupiterIoShGravity->updateMembers( );
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_EQUAL( mutualDirectJupiterIoShGravity->getAcceleration( )( i ), mutualDirectJupiterIoShGravityAcceleration( i ) );
+    }
+    mutualDirectJupiterIoShGravity->setNumberOfThreads( 1 );
+
     // Create mutual spherical harmonic gravity between Io and Jupiter on Jupiter, Io fixed (mu = Io + Jupiter)
     std::shared_ptr< AccelerationSettings > mutualDirectJupiterIoShGravitySettings2 =
             std::make_shared< MutualSphericalHarmonicAccelerationSettings >( 2, 2, 7, 7 );
@@ -19,6 +19,7 @@
 
 #include <boost/test/tools/floating_point_comparison.hpp>
 #include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
 
 #include "tudat/basics/testMacros.h"
 #include "tudat/astro/gravitation/polyhedronGravityField.h"
@@ -238,6 +239,211 @@ BOOST_AUTO_TEST_CASE( testGravityComputation )
     }
 }
 
+//! Test the blocked (and multi-threaded) computations in the cache against the direct computations, for a polyhedron
+//! with multiple blocks of facets and edges.
+BOOST_AUTO_TEST_CASE( testBlockedAndParallelComputation )
+{
+    // Create polyhedron approximating a sphere, with vertices on rings of constant latitude
+    const double radius = 1.0E3;
+    const int numberOfLatitudes = 60;
+    const int numberOfLongitudes = 50;
+    const int numberOfVertices = 2 + ( numberOfLatitudes - 1 ) * numberOfLongitudes;
+
+    Eigen::MatrixXd verticesCoordinates( numberOfVertices, 3 );
+    verticesCoordinates.row( 0 ) << 0.0, 0.0, radius;
+    verticesCoordinates.row( numberOfVertices - 1 ) << 0.0, 0.0, -radius;
+    for( int i = 1; i < numberOfLatitudes; i++ )
+    {
+        const double colatitude = mathematical_constants::PI * static_cast< double >( i ) / numberOfLatitudes;
+        for( int j = 0; j < numberOfLongitudes; j++ )
+        {
+            const double longitude = 2.0 * mathematical_constants::PI * static_cast< double >( j ) / numberOfLongitudes;
+            verticesCoordinates.row( 1 + ( i - 1 ) * numberOfLongitudes + j ) <<
+                radius * std::sin( colatitude ) * std::cos( longitude ),
+                radius * std::sin( colatitude ) * std::sin( longitude ),
+                radius * std::cos( colatitude );
+        }
+    }
+
+    std::vector< Eigen::Vector3i > facets;
+    for( int j = 0; j < numberOfLongitudes; j++ )
+    {
+        const int nextJ = ( j + 1 ) % numberOfLongitudes;
+        facets.push_back( Eigen::Vector3i( 0, 1 + j, 1 + nextJ ) );
+        for( int i = 1; i < numberOfLatitudes - 1; i++ )
+        {
+            const int upper = 1 + ( i - 1 ) * numberOfLongitudes;
+            const int lower = upper + numberOfLongitudes;
+            facets.push_back( Eigen::Vector3i( upper + j, lower + j, lower + nextJ ) );
+            facets.push_back( Eigen::Vector3i( upper + j, lower + nextJ, upper + nextJ ) );
+        }
+        const int lastRing = 1 + ( numberOfLatitudes - 2 ) * numberOfLongitudes;
+        facets.push_back( Eigen::Vector3i( numberOfVertices - 1, lastRing + nextJ, lastRing + j ) );
+    }
+    Eigen::MatrixXi verticesDefiningEachFacet( facets.size( ), 3 );
+    for( unsigned int i = 0; i < facets.size( ); i++ )
+    {
+        verticesDefiningEachFacet.row( i ) = facets.at( i ).transpose( );
+    }
+
+    const double gravitationalParameter = 1.0E3;
+    gravitation::PolyhedronGravityField gravityField = gravitation::PolyhedronGravityField(
+        gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet );
+    const double gravitationalConstantTimesDensity = gravitationalParameter / gravityField.getVolume( );
+
+    // Check that the facets and edges are processed in multiple blocks
+    BOOST_CHECK( gravityField.getVerticesDefiningEachFacet( ).rows( ) > 4096 );
+    BOOST_CHECK( gravityField.getVerticesDefiningEachEdge( ).rows( ) > 2 * 4096 );
+
+    for( const Eigen::Vector3d& bodyFixedPosition :
+         { Eigen::Vector3d( 1.3E3, -2.0E2, 4.0E2 ), Eigen::Vector3d( 1.0E2, 2.0E2, -3.0E2 ) } )
+    {
+        // Compute values with cache (single thread)
+        gravityField.setNumberOfThreads( 1 );
+        const double computedPotential = gravityField.getGravitationalPotential( bodyFixedPosition );
+        const Eigen::Vector3d computedGradient = gravityField.getGradientOfPotential( bodyFixedPosition );
+        const double computedLaplacian = gravityField.getLaplacianOfPotential( bodyFixedPosition );
+        const Eigen::Matrix3d computedHessian = gravityField.getHessianOfPotential( bodyFixedPosition );
+
+        // Compute values directly
+        Eigen::MatrixXd verticesCoordinatesRelativeToFieldPoint;
+        Eigen::VectorXd perFacetFactor, perEdgeFactor;
+        basic_mathematics::calculatePolyhedronVerticesCoordinatesRelativeToFieldPoint(
+                verticesCoordinatesRelativeToFieldPoint, bodyFixedPosition, verticesCoordinates );
+        basic_mathematics::calculatePolyhedronPerFacetFactor(
+                perFacetFactor, verticesCoordinatesRelativeToFieldPoint, verticesDefiningEachFacet );
+        basic_mathematics::calculatePolyhedronPerEdgeFactor(
+                perEdgeFactor, verticesCoordinatesRelativeToFieldPoint, gravityField.getVerticesDefiningEachEdge( ) );
+
+        const double expectedPotential = basic_mathematics::calculatePolyhedronGravitationalPotential(
+                gravitationalConstantTimesDensity, verticesCoordinatesRelativeToFieldPoint, verticesDefiningEachFacet,
+                gravityField.getVerticesDefiningEachEdge( ), gravityField.getFacetDyads( ), gravityField.getEdgeDyads( ),
+                perFacetFactor, perEdgeFactor );
+        const Eigen::Vector3d expectedGradient = basic_mathematics::calculatePolyhedronGradientOfGravitationalPotential(
+                gravitationalConstantTimesDensity, verticesCoordinatesRelativeToFieldPoint, verticesDefiningEachFacet,
+                gravityField.getVerticesDefiningEachEdge( ), gravityField.getFacetDyads( ), gravityField.getEdgeDyads( ),
+                perFacetFactor, perEdgeFactor );
+        const double expectedLaplacian = basic_mathematics::calculatePolyhedronLaplacianOfGravitationalPotential(
+                gravitationalConstantTimesDensity, perFacetFactor );
+        const Eigen::Matrix3d expectedHessian = basic_mathematics::calculatePolyhedronHessianOfGravitationalPotential(
+                gravitationalConstantTimesDensity, gravityField.getFacetDyads( ), gravityField.getEdgeDyads( ),
+                perFacetFactor, perEdgeFactor );
+
+        BOOST_CHECK_SMALL( std::fabs( computedPotential - expectedPotential ), 1.0E-12 * std::fabs( expectedPotential ) );
+        BOOST_CHECK_SMALL( ( computedGradient - expectedGradient ).norm( ), 1.0E-10 * expectedGradient.norm( ) );
+        BOOST_CHECK_SMALL( std::fabs( computedLaplacian - expectedLaplacian ),
+                           1.0E-12 * gravitationalConstantTimesDensity );
+        BOOST_CHECK_SMALL( ( computedHessian - expectedHessian ).norm( ), 1.0E-10 * expectedHessian.norm( ) );
+        BOOST_CHECK_EQUAL( ( computedHessian - computedHessian.transpose( ) ).norm( ), 0.0 );
+
+        // Check that results do not depend on number of threads (first moving to another point, to force an update)
+        gravityField.setNumberOfThreads( 3 );
+        gravityField.getGravitationalPotential( 2.0 * bodyFixedPosition );
+        for( int i = 0; i < 3; i++ )
+        {
+            BOOST_CHECK_EQUAL( computedGradient( i ), gravityField.getGradientOfPotential( bodyFixedPosition )( i ) );
+        }
+        BOOST_CHECK_EQUAL( computedPotential, gravityField.getGravitationalPotential( bodyFixedPosition ) );
+        BOOST_CHECK_EQUAL( computedLaplacian, gravityField.getLaplacianOfPotential( bodyFixedPosition ) );
+        BOOST_CHECK_EQUAL( ( computedHessian - gravityField.getHessianOfPotential( bodyFixedPosition ) ).norm( ), 0.0 );
+    }
+
+    BOOST_CHECK_THROW( gravityField.setNumberOfThreads( 0 ), std::runtime_error );
+}
+
+//! Test sharing and on-disk caching of preprocessed polyhedron data
+BOOST_AUTO_TEST_CASE( testPreprocessedDataCache )
+{
+    using namespace basic_astrodynamics;
+
+    // Define cuboid
+    Eigen::MatrixXd verticesCoordinates(8,3);
+    verticesCoordinates <<
+        0.0, 0.0, 0.0,
+        20.0, 0.0, 0.0,
+        0.0, 10.0, 0.0,
+        20.0, 10.0, 0.0,
+        0.0, 0.0, 10.0,
+        20.0, 0.0, 10.0,
+        0.0, 10.0, 10.0,
+        20.0, 10.0, 10.0;
+    Eigen::MatrixXi verticesDefiningEachFacet(12,3);
+    verticesDefiningEachFacet <<
+        2, 1, 0,
+        1, 2, 3,
+        4, 2, 0,
+        2, 4, 6,
+        1, 4, 0,
+        4, 1, 5,
+        6, 5, 7,
+        5, 6, 4,
+        3, 6, 7,
+        6, 3, 2,
+        5, 3, 7,
+        3, 5, 1;
+
+    const boost::filesystem::path cacheDirectory =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( "tudat_polyhedron_%%%%%%%%" );
+    setPolyhedronPreprocessedDataCacheDirectory( cacheDirectory.string( ) );
+
+    {
+        // Check that preprocessed data is shared by gravity fields of the same polyhedron, and written to disk once
+        gravitation::PolyhedronGravityField gravityField1 = gravitation::PolyhedronGravityField(
+                1.0E3, verticesCoordinates, verticesDefiningEachFacet );
+        gravitation::PolyhedronGravityField gravityField2 = gravitation::PolyhedronGravityField(
+                2.0E3, verticesCoordinates, verticesDefiningEachFacet );
+        BOOST_CHECK_EQUAL( &gravityField1.getFacetDyads( ), &gravityField2.getFacetDyads( ) );
+        BOOST_CHECK_EQUAL( std::distance( boost::filesystem::directory_iterator( cacheDirectory ),
+                                          boost::filesystem::directory_iterator( ) ), 1 );
+    }
+
+    // Check that data read from disk is identical to computed data
+    const std::string cacheFile = boost::filesystem::directory_iterator( cacheDirectory )->path( ).string( );
+    std::shared_ptr< PolyhedronPreprocessedData > computedData =
+            computePolyhedronPreprocessedData( verticesCoordinates, verticesDefiningEachFacet );
+    std::shared_ptr< PolyhedronPreprocessedData > readData =
+            readPolyhedronPreprocessedDataFromBinaryFile( cacheFile, verticesCoordinates, verticesDefiningEachFacet );
+    BOOST_REQUIRE( readData != nullptr );
+    BOOST_CHECK( readData->verticesDefiningEachEdge == computedData->verticesDefiningEachEdge );
+    BOOST_CHECK( readData->facetsDefiningEachEdge == computedData->facetsDefiningEachEdge );
+    BOOST_CHECK_EQUAL( readData->facetNormalVectors.size( ), computedData->facetNormalVectors.size( ) );
+    BOOST_CHECK_EQUAL( readData->edgeDyads.size( ), 18 );
+    for( unsigned int i = 0; i < computedData->facetDyads.size( ); i++ )
+    {
+        BOOST_CHECK( readData->facetNormalVectors.at( i ) == computedData->facetNormalVectors.at( i ) );
+        BOOST_CHECK( readData->facetDyads.at( i ) == computedData->facetDyads.at( i ) );
+    }
+    for( unsigned int i = 0; i < computedData->edgeDyads.size( ); i++ )
+    {
+        BOOST_CHECK( readData->edgeDyads.at( i ) == computedData->edgeDyads.at( i ) );
+    }
+
+    // Check that file is not used for a different polyhedron
+    Eigen::MatrixXd modifiedVerticesCoordinates = verticesCoordinates;
+    modifiedVerticesCoordinates( 7, 2 ) = 11.0;
+    BOOST_CHECK( readPolyhedronPreprocessedDataFromBinaryFile(
+                     cacheFile, modifiedVerticesCoordinates, verticesDefiningEachFacet ) == nullptr );
+
+    // Check that gravity field created from cached data is identical to one created without cache
+    const Eigen::Vector3d bodyFixedPosition( 30.0, -5.0, 12.0 );
+    gravitation::PolyhedronGravityField cachedGravityField = gravitation::PolyhedronGravityField(
+            1.0E3, verticesCoordinates, verticesDefiningEachFacet );
+    const Eigen::Vector3d cachedGradient = cachedGravityField.getGradientOfPotential( bodyFixedPosition );
+
+    setPolyhedronPreprocessedDataCacheDirectory( "" );
+    boost::filesystem::remove_all( cacheDirectory );
+    gravitation::PolyhedronGravityField gravityField = gravitation::PolyhedronGravityField(
+            1.0E3, modifiedVerticesCoordinates, verticesDefiningEachFacet );
+    BOOST_CHECK( !boost::filesystem::exists( cacheDirectory ) );
+    BOOST_CHECK( cachedGradient != gravityField.getGradientOfPotential( bodyFixedPosition ) );
+    for( int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_EQUAL( cachedGradient( i ), gravitation::PolyhedronGravityField(
+                               1.0E3, verticesCoordinates, verticesDefiningEachFacet ).getGradientOfPotential(
+                               bodyFixedPosition )( i ) );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace tudat
@@ -23,6 +23,7 @@
 #include "tudat/basics/testMacros.h"
 #include "tudat/astro/gravitation/polyhedronGravityField.h"
 #include "tudat/astro/gravitation/polyhedronGravityModel.h"
+#include "tudat/astro/gravitation/hybridPolyhedronGravityField.h"
 
 namespace tudat
 {
@@ -174,6 +175,148 @@ BOOST_AUTO_TEST_CASE( testGravityComputation )
     }
 }
 
+//! Test computation of gravity field and acceleration with spherical harmonic far-field model.
+BOOST_AUTO_TEST_CASE( testHybridGravityComputation )
+{
+    // Define cuboid polyhedron, centered at origin
+    const double w = 10.0; // width
+    const double h = 8.0; // height
+    const double l = 20.0; // length
+    Eigen::MatrixXd verticesCoordinates(8,3);
+    verticesCoordinates <<
+        0.0, 0.0, 0.0,
+        l, 0.0, 0.0,
+        0.0, w, 0.0,
+        l, w, 0.0,
+        0.0, 0.0, h,
+        l, 0.0, h,
+        0.0, w, h,
+        l, w, h;
+    verticesCoordinates.rowwise( ) -= Eigen::RowVector3d( l / 2.0, w / 2.0, h / 2.0 );
+    Eigen::MatrixXi verticesDefiningEachFacet(12,3);
+    verticesDefiningEachFacet <<
+        2, 1, 0,
+        1, 2, 3,
+        4, 2, 0,
+        2, 4, 6,
+        1, 4, 0,
+        4, 1, 5,
+        6, 5, 7,
+        5, 6, 4,
+        3, 6, 7,
+        6, 3, 2,
+        5, 3, 7,
+        3, 5, 1;
+
+    const double gravitationalParameter = 6.67259e-11 * 2670.0 * w * h * l;
+    const double brillouinRadius = std::sqrt( w * w + h * h + l * l ) / 2.0;
+    const double innerSwitchDistance = 4.0 * brillouinRadius;
+    const double outerSwitchDistance = 6.0 * brillouinRadius;
+
+    // Check blending weight, and its derivative
+    double weight, weightDerivative;
+    gravitation::computeHybridGravityFieldBlendingWeight( 0.5 * innerSwitchDistance, innerSwitchDistance,
+                                                          outerSwitchDistance, weight, weightDerivative );
+    BOOST_CHECK_EQUAL( weight, 0.0 );
+    BOOST_CHECK_EQUAL( weightDerivative, 0.0 );
+    gravitation::computeHybridGravityFieldBlendingWeight( 2.0 * outerSwitchDistance, innerSwitchDistance,
+                                                          outerSwitchDistance, weight, weightDerivative );
+    BOOST_CHECK_EQUAL( weight, 1.0 );
+    BOOST_CHECK_EQUAL( weightDerivative, 0.0 );
+    {
+        const double distance = innerSwitchDistance + 0.3 * ( outerSwitchDistance - innerSwitchDistance );
+        const double distancePerturbation = 1.0E-4;
+        double upperWeight, lowerWeight, dummyDerivative;
+        gravitation::computeHybridGravityFieldBlendingWeight( distance, innerSwitchDistance,
+                                                              outerSwitchDistance, weight, weightDerivative );
+        gravitation::computeHybridGravityFieldBlendingWeight( distance + distancePerturbation, innerSwitchDistance,
+                                                              outerSwitchDistance, upperWeight, dummyDerivative );
+        gravitation::computeHybridGravityFieldBlendingWeight( distance - distancePerturbation, innerSwitchDistance,
+                                                              outerSwitchDistance, lowerWeight, dummyDerivative );
+        BOOST_CHECK_CLOSE_FRACTION( weight, 0.216, 1.0E-14 );
+        BOOST_CHECK_CLOSE_FRACTION( weightDerivative, ( upperWeight - lowerWeight ) / ( 2.0 * distancePerturbation ), 1.0E-8 );
+    }
+
+    // Check that inconsistent switch distances are rejected
+    BOOST_CHECK_THROW( gravitation::HybridPolyhedronGravityField(
+                           gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet, 8,
+                           0.5 * brillouinRadius, outerSwitchDistance ), std::runtime_error );
+    BOOST_CHECK_THROW( gravitation::HybridPolyhedronGravityField(
+                           gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet, 8,
+                           outerSwitchDistance, innerSwitchDistance ), std::runtime_error );
+
+    gravitation::PolyhedronGravityField polyhedronGravityField = gravitation::PolyhedronGravityField(
+        gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet );
+    std::shared_ptr< gravitation::HybridPolyhedronGravityField > hybridGravityField =
+            std::make_shared< gravitation::HybridPolyhedronGravityField >(
+                gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet, 8,
+                innerSwitchDistance, outerSwitchDistance );
+    std::shared_ptr< gravitation::SphericalHarmonicsGravityField > farFieldGravityField =
+            hybridGravityField->getFarFieldGravityField( );
+
+    // Check far-field coefficients against analytical values for a homogeneous cuboid
+    BOOST_CHECK_CLOSE_FRACTION( farFieldGravityField->getReferenceRadius( ), brillouinRadius, 1.0E-15 );
+    BOOST_CHECK_CLOSE_FRACTION(
+                farFieldGravityField->getCosineCoefficients( )( 2, 0 ),
+                ( 2.0 * h * h - l * l - w * w ) / ( 24.0 * std::sqrt( 5.0 ) * brillouinRadius * brillouinRadius ), 1.0E-12 );
+    BOOST_CHECK_CLOSE_FRACTION(
+                farFieldGravityField->getCosineCoefficients( )( 2, 2 ),
+                ( l * l - w * w ) / ( 8.0 * std::sqrt( 15.0 ) * brillouinRadius * brillouinRadius ), 1.0E-12 );
+    BOOST_CHECK_SMALL( farFieldGravityField->getCosineCoefficients( )( 2, 1 ), 1.0E-15 );
+    BOOST_CHECK_SMALL( farFieldGravityField->getSineCoefficients( )( 2, 2 ), 1.0E-15 );
+
+    const Eigen::Vector3d unitDirection = Eigen::Vector3d( 0.6, -0.3, 0.5 ).normalized( );
+    for( const double distance : { 2.0 * brillouinRadius, 5.0 * brillouinRadius, 8.0 * brillouinRadius } )
+    {
+        const Eigen::Vector3d bodyFixedPosition = distance * unitDirection;
+
+        double farFieldWeight, farFieldWeightDerivative;
+        gravitation::computeHybridGravityFieldBlendingWeight(
+                    distance, innerSwitchDistance, outerSwitchDistance, farFieldWeight, farFieldWeightDerivative );
+
+        // Check field against blended polyhedron and spherical harmonic values
+        const Eigen::Vector3d polyhedronGradient = polyhedronGravityField.getGradientOfPotential( bodyFixedPosition );
+        const Eigen::Vector3d farFieldGradient = farFieldGravityField->getGradientOfPotential( bodyFixedPosition );
+        const Eigen::Vector3d expectedGradient =
+                ( 1.0 - farFieldWeight ) * polyhedronGradient + farFieldWeight * farFieldGradient;
+        const double expectedPotential =
+                ( 1.0 - farFieldWeight ) * polyhedronGravityField.getGravitationalPotential( bodyFixedPosition ) +
+                farFieldWeight * farFieldGravityField->getGravitationalPotential( bodyFixedPosition );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    expectedGradient, hybridGravityField->getGradientOfPotential( bodyFixedPosition ), 1.0E-14 );
+        BOOST_CHECK_CLOSE_FRACTION(
+                    expectedPotential, hybridGravityField->getGravitationalPotential( bodyFixedPosition ), 1.0E-14 );
+
+        // Check that the far-field model is accurate in the blending region and beyond
+        if( distance > innerSwitchDistance )
+        {
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( polyhedronGradient, farFieldGradient, 1.0E-8 );
+        }
+
+        // Check acceleration model against field
+        std::function< void( Eigen::Vector3d& ) > bodyFixedPositionFunction =
+                [ = ]( Eigen::Vector3d& positionOfBodySubjectToAcceleration ){
+            positionOfBodySubjectToAcceleration = bodyFixedPosition; };
+        std::shared_ptr< gravitation::PolyhedronGravitationalAccelerationModel > gravityModel =
+                std::make_shared< gravitation::PolyhedronGravitationalAccelerationModel >(
+                    bodyFixedPositionFunction, gravitationalParameter, hybridGravityField->getVolume( ),
+                    verticesCoordinates, verticesDefiningEachFacet, hybridGravityField->getVerticesDefiningEachEdge( ),
+                    hybridGravityField->getFacetDyads( ), hybridGravityField->getEdgeDyads( ) );
+        gravityModel->setFarFieldAccelerationModel(
+                    std::make_shared< gravitation::SphericalHarmonicsGravitationalAccelerationModel >(
+                        bodyFixedPositionFunction, gravitationalParameter, farFieldGravityField->getReferenceRadius( ),
+                        farFieldGravityField->getCosineCoefficients( ), farFieldGravityField->getSineCoefficients( ) ),
+                    innerSwitchDistance, outerSwitchDistance );
+        gravityModel->resetUpdatePotential( true );
+        gravityModel->updateMembers( 0.0 );
+
+        BOOST_CHECK_SMALL( gravityModel->getCurrentFarFieldWeight( ) - farFieldWeight, 1.0E-14 );
+        BOOST_CHECK_SMALL( gravityModel->getCurrentFarFieldWeightDerivative( ) - farFieldWeightDerivative, 1.0E-14 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedGradient, gravityModel->getAcceleration( ), 1.0E-14 );
+        BOOST_CHECK_CLOSE_FRACTION( expectedPotential, gravityModel->getCurrentPotential( ), 1.0E-14 );
+    }
+}
+
 //! Test the functionality of the polyhedron gravity field class.
 BOOST_AUTO_TEST_SUITE( test_polyhedron_gravity_model )
 
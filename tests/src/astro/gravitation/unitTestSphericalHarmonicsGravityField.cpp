@@ -15,6 +15,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "tudat/astro/gravitation/sphericalHarmonicsGravityField.h"
+#include "tudat/astro/gravitation/timeDependentSphericalHarmonicsGravityField.h"
 #include "tudat/basics/testMacros.h"
 #include "tudat/astro/gravitation/gravityFieldModel.h"
 
@@ -205,6 +206,234 @@ BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalFieldFromFiniteDiffere
 }
 
 
+//! Test batched evaluation of potential and gradient, at set of points and on grid, against single-point evaluation
+BOOST_AUTO_TEST_CASE( testBatchedPotentialAndGradient )
+{
+    // Define (synthetic) geodesy-normalized coefficients up to degree 60 and order 50
+    const double gravitationalParameter = 3.986004418e14;
+    const double referenceRadius = 6378137.0;
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( 61, 51 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( 61, 51 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    for( int degree = 2; degree <= 60; degree++ )
+    {
+        for( int order = 0; order <= std::min( degree, 50 ); order++ )
+        {
+            cosineCoefficients( degree, order ) = 1.0E-5 * std::sin( 1.3 * degree + 0.7 * order ) /
+                    static_cast< double >( degree * degree );
+            sineCoefficients( degree, order ) = ( order == 0 ) ? 0.0 :
+                    1.0E-5 * std::cos( 0.9 * degree - 1.1 * order ) / static_cast< double >( degree * degree );
+        }
+    }
+    gravitation::SphericalHarmonicsGravityField gravityField(
+                gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients );
+
+    // Define points, of which several share distance and latitude
+    Eigen::Matrix3Xd positions( 3, 40 );
+    for( int i = 0; i < 20; i++ )
+    {
+        positions.col( i ) = ( 6.6E6 + 1.0E4 * i ) * Eigen::Vector3d(
+                    std::cos( 0.1 * i - 1.0 ) * std::cos( 0.7 * i ), std::cos( 0.1 * i - 1.0 ) * std::sin( 0.7 * i ),
+                    std::sin( 0.1 * i - 1.0 ) );
+    }
+    for( int i = 20; i < 40; i++ )
+    {
+        positions.col( i ) = 7.0E6 * Eigen::Vector3d(
+                    std::cos( 0.45 ) * std::cos( 0.3 * i ), std::cos( 0.45 ) * std::sin( 0.3 * i ), std::sin( 0.45 ) );
+    }
+
+    // Compare batched evaluation with single-point evaluation, and serial with parallel evaluation
+    Eigen::VectorXd potentials, parallelPotentials;
+    Eigen::Matrix3Xd gradients, parallelGradients;
+    gravityField.getGravitationalPotentialAndGradientAtPoints( positions, potentials, gradients );
+    gravityField.getGravitationalPotentialAndGradientAtPoints( positions, parallelPotentials, parallelGradients, 3 );
+    BOOST_CHECK_EQUAL( potentials.rows( ), 40 );
+    BOOST_CHECK_EQUAL( gradients.cols( ), 40 );
+    for( int i = 0; i < 40; i++ )
+    {
+        Eigen::Vector3d position = positions.col( i );
+        BOOST_CHECK_CLOSE_FRACTION( potentials( i ), gravityField.getGravitationalPotential( position ), 1.0E-13 );
+        Eigen::Vector3d expectedGradient = gravityField.getGradientOfPotential( position );
+        for( int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( gradients( j, i ) - expectedGradient( j ) ), 1.0E-13 * expectedGradient.norm( ) );
+            BOOST_CHECK_EQUAL( gradients( j, i ), parallelGradients( j, i ) );
+        }
+        BOOST_CHECK_EQUAL( potentials( i ), parallelPotentials( i ) );
+    }
+
+    // Compare evaluation on grid with single-point evaluation
+    Eigen::VectorXd latitudes = Eigen::VectorXd::LinSpaced( 7, -1.5, 1.5 );
+    Eigen::VectorXd longitudes = Eigen::VectorXd::LinSpaced( 12, -3.0, 3.0 );
+    Eigen::MatrixXd gridPotentials;
+    Eigen::Matrix3Xd gridGradients;
+    gravityField.getGravitationalPotentialAndGradientOnGrid(
+                6.9E6, latitudes, longitudes, gridPotentials, gridGradients, 2 );
+    BOOST_CHECK_EQUAL( gridPotentials.rows( ), 7 );
+    BOOST_CHECK_EQUAL( gridPotentials.cols( ), 12 );
+    for( int i = 0; i < latitudes.rows( ); i++ )
+    {
+        for( int j = 0; j < longitudes.rows( ); j++ )
+        {
+            Eigen::Vector3d position = 6.9E6 * Eigen::Vector3d(
+                        std::cos( latitudes( i ) ) * std::cos( longitudes( j ) ),
+                        std::cos( latitudes( i ) ) * std::sin( longitudes( j ) ), std::sin( latitudes( i ) ) );
+            BOOST_CHECK_CLOSE_FRACTION( gridPotentials( i, j ), gravityField.getGravitationalPotential( position ), 1.0E-13 );
+            Eigen::Vector3d expectedGradient = gravityField.getGradientOfPotential( position );
+            for( int k = 0; k < 3; k++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( gridGradients( k, i + j * latitudes.rows( ) ) - expectedGradient( k ) ),
+                                   1.0E-13 * expectedGradient.norm( ) );
+            }
+        }
+    }
+
+    BOOST_CHECK_THROW( gravityField.getGravitationalPotentialAndGradientAtPoints( positions, potentials, gradients, 0 ),
+                       std::runtime_error );
+}
+
+//! Test batched evaluation of potential and gradient by the CUDA backend, against the CPU (reference) backend. Without
+//! TUDAT_BUILD_WITH_CUDA, this tests the host evaluation of the per-point algorithm used by the device kernel.
+BOOST_AUTO_TEST_CASE( testBatchedPotentialAndGradientBackends )
+{
+    using namespace gravitation;
+
+    BOOST_CHECK( !isSphericalHarmonicsBatchEvaluationOnDevice( cpu_batch_evaluation ) );
+    BOOST_CHECK_EQUAL( isSphericalHarmonicsBatchEvaluationOnDevice( cuda_batch_evaluation ),
+                       static_cast< bool >( TUDAT_BUILD_WITH_CUDA ) );
+
+    // Create field up to degree 300, which requires the scaled recursion of the CUDA backend at high latitudes
+    const int maximumDegree = 300;
+    const int maximumOrder = 250;
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    for( int degree = 2; degree <= maximumDegree; degree++ )
+    {
+        for( int order = 0; order <= std::min( degree, maximumOrder ); order++ )
+        {
+            cosineCoefficients( degree, order ) = 1.0E-5 * std::sin( 1.3 * degree + 0.7 * order ) /
+                    static_cast< double >( degree * degree );
+            sineCoefficients( degree, order ) = ( order == 0 ) ? 0.0 :
+                    1.0E-5 * std::cos( 0.9 * degree - 1.1 * order ) / static_cast< double >( degree * degree );
+        }
+    }
+    SphericalHarmonicsGravityField gravityField(
+                3.986004418E14, 6378137.0, cosineCoefficients, sineCoefficients );
+
+    // Define points at a range of distances, latitudes (up to 85 degrees) and longitudes
+    Eigen::Matrix3Xd positions( 3, 60 );
+    for( int i = 0; i < 60; i++ )
+    {
+        const double latitude = -1.48 + 0.05 * i;
+        positions.col( i ) = ( 6.5E6 + 1.0E4 * i ) * Eigen::Vector3d(
+                    std::cos( latitude ) * std::cos( 0.7 * i ), std::cos( latitude ) * std::sin( 0.7 * i ),
+                    std::sin( latitude ) );
+    }
+
+    Eigen::VectorXd potentials, devicePotentials;
+    Eigen::Matrix3Xd gradients, deviceGradients;
+    gravityField.getGravitationalPotentialAndGradientAtPoints( positions, potentials, gradients );
+
+    Eigen::VectorXd latitudes = Eigen::VectorXd::LinSpaced( 7, -1.5, 1.5 );
+    Eigen::VectorXd longitudes = Eigen::VectorXd::LinSpaced( 12, -3.0, 3.0 );
+    Eigen::MatrixXd gridPotentials, deviceGridPotentials;
+    Eigen::Matrix3Xd gridGradients, deviceGridGradients;
+    gravityField.getGravitationalPotentialAndGradientOnGrid(
+                6.9E6, latitudes, longitudes, gridPotentials, gridGradients );
+
+    gravityField.getGravitationalPotentialAndGradientAtPoints(
+                positions, devicePotentials, deviceGradients, 3, cuda_batch_evaluation );
+    for( int i = 0; i < positions.cols( ); i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( devicePotentials( i ), potentials( i ), 1.0E-12 );
+        for( int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( deviceGradients( j, i ) - gradients( j, i ) ),
+                               1.0E-12 * gradients.col( i ).norm( ) );
+        }
+    }
+
+    gravityField.getGravitationalPotentialAndGradientOnGrid(
+                6.9E6, latitudes, longitudes, deviceGridPotentials, deviceGridGradients, 1, cuda_batch_evaluation );
+    BOOST_CHECK_EQUAL( deviceGridPotentials.rows( ), latitudes.rows( ) );
+    BOOST_CHECK_EQUAL( deviceGridPotentials.cols( ), longitudes.rows( ) );
+    for( int i = 0; i < gridGradients.cols( ); i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( deviceGridPotentials( i ), gridPotentials( i ), 1.0E-12 );
+        for( int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( deviceGridGradients( j, i ) - gridGradients( j, i ) ),
+                               1.0E-12 * gridGradients.col( i ).norm( ) );
+        }
+    }
+
+    // Gradient is singular at the poles
+    positions.col( 0 ) = Eigen::Vector3d( 0.0, 0.0, 7.0E6 );
+    BOOST_CHECK_THROW( gravityField.getGravitationalPotentialAndGradientAtPoints(
+                           positions, devicePotentials, deviceGradients, 1, cuda_batch_evaluation ),
+                       std::runtime_error );
+}
+
+//! Test sharing of coefficient storage between gravity fields, and copy-on-write when modifying the coefficients.
+BOOST_AUTO_TEST_CASE( testSharedCoefficientStorage )
+{
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( 5, 5 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( 5, 5 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    cosineCoefficients( 2, 0 ) = -4.84165371736E-4;
+    cosineCoefficients( 3, 1 ) = 2.03046201047864E-6;
+    sineCoefficients( 3, 1 ) = 2.48200415856872E-7;
+
+    // Create two fields from the same coefficient storage
+    basic_mathematics::CopyOnWriteMatrix sharedCosineCoefficients( cosineCoefficients );
+    basic_mathematics::CopyOnWriteMatrix sharedSineCoefficients( sineCoefficients );
+    gravitation::SphericalHarmonicsGravityField firstField(
+                3.986004418E14, 6378137.0, sharedCosineCoefficients, sharedSineCoefficients );
+    gravitation::SphericalHarmonicsGravityField secondField(
+                3.986004418E14, 6378137.0, sharedCosineCoefficients, sharedSineCoefficients );
+    BOOST_CHECK( firstField.getSharedCosineCoefficients( ).sharesStorageWith( sharedCosineCoefficients ) );
+    BOOST_CHECK( secondField.getSharedCosineCoefficients( ).sharesStorageWith( sharedCosineCoefficients ) );
+    BOOST_CHECK( secondField.getSharedSineCoefficients( ).sharesStorageWith( sharedSineCoefficients ) );
+
+    const Eigen::Vector3d testPosition( 7.0E6, -1.0E6, 2.0E6 );
+    const double nominalPotential = firstField.getGravitationalPotential( testPosition );
+
+    // Modify coefficients of first field: storage is duplicated, second field and original storage are unchanged
+    Eigen::MatrixXd perturbedCosineCoefficients = cosineCoefficients;
+    perturbedCosineCoefficients( 2, 0 ) *= 2.0;
+    firstField.setCosineCoefficients( perturbedCosineCoefficients );
+    BOOST_CHECK( !firstField.getSharedCosineCoefficients( ).sharesStorageWith( sharedCosineCoefficients ) );
+    BOOST_CHECK( secondField.getSharedCosineCoefficients( ).sharesStorageWith( sharedCosineCoefficients ) );
+    BOOST_CHECK( firstField.getSharedSineCoefficients( ).sharesStorageWith( sharedSineCoefficients ) );
+    BOOST_CHECK_EQUAL( firstField.getCosineCoefficients( )( 2, 0 ), perturbedCosineCoefficients( 2, 0 ) );
+    BOOST_CHECK_EQUAL( secondField.getCosineCoefficients( )( 2, 0 ), cosineCoefficients( 2, 0 ) );
+    BOOST_CHECK_EQUAL( sharedCosineCoefficients( 2, 0 ), cosineCoefficients( 2, 0 ) );
+    BOOST_CHECK_EQUAL( secondField.getGravitationalPotential( testPosition ), nominalPotential );
+    BOOST_CHECK( firstField.getGravitationalPotential( testPosition ) != nominalPotential );
+
+    // Modify coefficients of unshared storage in place
+    firstField.setCosineCoefficients( cosineCoefficients );
+    BOOST_CHECK_EQUAL( firstField.getGravitationalPotential( testPosition ), nominalPotential );
+    BOOST_CHECK_THROW( firstField.setCosineCoefficients( Eigen::MatrixXd::Zero( 4, 4 ) ), std::runtime_error );
+
+    // Check that time-dependent field without variations keeps the storage of its nominal coefficients
+    gravitation::TimeDependentSphericalHarmonicsGravityField timeDependentField(
+                3.986004418E14, 6378137.0, sharedCosineCoefficients, sharedSineCoefficients );
+    timeDependentField.update( 0.0 );
+    BOOST_CHECK( timeDependentField.getSharedCosineCoefficients( ).sharesStorageWith( sharedCosineCoefficients ) );
+    BOOST_CHECK( timeDependentField.getSharedSineCoefficients( ).sharesStorageWith( sharedSineCoefficients ) );
+    BOOST_CHECK_EQUAL( timeDependentField.getGravitationalPotential( testPosition ), nominalPotential );
+
+    // Modifying a nominal coefficient detaches the nominal and current coefficients from the shared storage
+    timeDependentField.setNominalCosineCoefficient( 2, 0, perturbedCosineCoefficients( 2, 0 ) );
+    timeDependentField.update( 0.0 );
+    BOOST_CHECK( !timeDependentField.getSharedCosineCoefficients( ).sharesStorageWith( sharedCosineCoefficients ) );
+    BOOST_CHECK_EQUAL( timeDependentField.getCosineCoefficients( )( 2, 0 ), perturbedCosineCoefficients( 2, 0 ) );
+    BOOST_CHECK_EQUAL( sharedCosineCoefficients( 2, 0 ), cosineCoefficients( 2, 0 ) );
+    BOOST_CHECK_EQUAL( secondField.getGravitationalPotential( testPosition ), nominalPotential );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace tudat
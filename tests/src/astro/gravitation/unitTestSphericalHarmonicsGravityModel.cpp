@@ -38,6 +38,7 @@
 #include "tudat/basics/testMacros.h"
 
 #include "tudat/astro/gravitation/sphericalHarmonicsGravityModel.h"
+#include "tudat/astro/gravitation/sphericalHarmonicsSummationKernels.h"
 #include "tudat/math/basic/sphericalHarmonics.h"
 
 namespace tudat
@@ -342,6 +343,272 @@ BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalPotentialWrapperClass
     BOOST_CHECK_EQUAL( expectedPotential, potential );
 }
 
+// Test whether packed and vectorized summation of high-degree field are equal to standard summation, up to round-off.
+BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalAccelerationSummationTypes )
+{
+    using namespace gravitation;
+    using namespace basic_mathematics;
+
+    BOOST_CHECK( getVectorizedSphericalHarmonicsInstructionSet( ) == "avx512" ||
+                 getVectorizedSphericalHarmonicsInstructionSet( ) == "avx2" ||
+                 getVectorizedSphericalHarmonicsInstructionSet( ) == "scalar" );
+
+    // Define (synthetic) geodesy-normalized coefficients up to degree and order 120 (with odd number of orders for the
+    // highest degrees, to test the treatment of orders that are not part of a full SIMD vector)
+    const double gravitationalParameter = 3.986004418e14;
+    const double planetaryRadius = 6378137.0;
+    const int maximumDegree = 120;
+    const int maximumOrder = 117;
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    cosineCoefficients( 2, 0 ) = -4.84165E-4;
+    for( int degree = 2; degree <= maximumDegree; degree++ )
+    {
+        for( int order = ( degree == 2 ) ? 1 : 0; order <= std::min( degree, maximumOrder ); order++ )
+        {
+            cosineCoefficients( degree, order ) = 1.0E-5 * std::sin( 1.3 * degree + 0.7 * order ) /
+                    static_cast< double >( degree * degree );
+            if( order > 0 )
+            {
+                sineCoefficients( degree, order ) = 1.0E-5 * std::cos( 0.9 * degree - 1.1 * order ) /
+                        static_cast< double >( degree * degree );
+            }
+        }
+    }
+
+    std::vector< Eigen::Vector3d > positions;
+    positions.push_back( Eigen::Vector3d( 6.7e6, 0.3e6, -0.2e6 ) );
+    positions.push_back( Eigen::Vector3d( -1.0e6, 2.5e6, 6.4e6 ) );
+    positions.push_back( Eigen::Vector3d( 4.0e6, -5.0e6, 1.0e6 ) );
+
+    for( unsigned int i = 0; i < positions.size( ); i++ )
+    {
+        Eigen::Vector3d position = positions.at( i );
+        std::vector< Eigen::Vector3d > accelerations;
+        for( unsigned int summationType = 0; summationType < 3; summationType++ )
+        {
+            std::shared_ptr< SphericalHarmonicsCache > sphericalHarmonicsCache =
+                    std::make_shared< SphericalHarmonicsCache >( );
+            sphericalHarmonicsCache->setSummationType( static_cast< SphericalHarmonicsSummationType >( summationType ) );
+            BOOST_CHECK_EQUAL( sphericalHarmonicsCache->getSummationType( ), summationType );
+
+            SphericalHarmonicsGravitationalAccelerationModelPointer earthGravity
+                    = std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                        [ & ]( Eigen::Vector3d& input ){ input = position; }, gravitationalParameter, planetaryRadius,
+                        cosineCoefficients, sineCoefficients,
+                        [ ]( Eigen::Vector3d& input ){ input = Eigen::Vector3d::Zero( ); },
+                        [ ]( ){ return Eigen::Quaterniond( Eigen::AngleAxisd( 0.3, Eigen::Vector3d::UnitZ( ) ) ); },
+                        false, sphericalHarmonicsCache );
+            earthGravity->updateMembers( 0.0 );
+            accelerations.push_back( earthGravity->getAcceleration( ) );
+        }
+
+        // Check that packed and vectorized summation are equal to standard summation, up to round-off
+        for( unsigned int summationType = 1; summationType < 3; summationType++ )
+        {
+            for( int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( accelerations.at( summationType )( j ) - accelerations.at( 0 )( j ) ),
+                                   1.0E-14 * accelerations.at( 0 ).norm( ) );
+            }
+        }
+
+        // Check that extended range Legendre recursion gives identical result (no underflow at this degree)
+        std::shared_ptr< SphericalHarmonicsCache > extendedRangeCache = std::make_shared< SphericalHarmonicsCache >( );
+        extendedRangeCache->setLegendreRecursionType( extended_range_legendre_recursion );
+        BOOST_CHECK_EQUAL( extendedRangeCache->getLegendreRecursionType( ), extended_range_legendre_recursion );
+        SphericalHarmonicsGravitationalAccelerationModelPointer extendedRangeEarthGravity
+                = std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                    [ & ]( Eigen::Vector3d& input ){ input = position; }, gravitationalParameter, planetaryRadius,
+                    cosineCoefficients, sineCoefficients,
+                    [ ]( Eigen::Vector3d& input ){ input = Eigen::Vector3d::Zero( ); },
+                    [ ]( ){ return Eigen::Quaterniond( Eigen::AngleAxisd( 0.3, Eigen::Vector3d::UnitZ( ) ) ); },
+                    false, extendedRangeCache );
+        extendedRangeEarthGravity->updateMembers( 0.0 );
+        for( int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_EQUAL( extendedRangeEarthGravity->getAcceleration( )( j ), accelerations.at( 0 )( j ) );
+        }
+    }
+}
+
+// Test whether Cartesian formulation is equal to standard formulation, up to round-off, and whether it is regular at the poles.
+BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalAccelerationCartesianFormulation )
+{
+    using namespace gravitation;
+    using namespace basic_mathematics;
+
+    const double gravitationalParameter = 3.986004418e14;
+    const double planetaryRadius = 6378137.0;
+
+    std::vector< Eigen::Vector3d > positions;
+    positions.push_back( Eigen::Vector3d( 6.7e6, 0.3e6, -0.2e6 ) );
+    positions.push_back( Eigen::Vector3d( -1.0e6, 2.5e6, 6.4e6 ) );
+    positions.push_back( Eigen::Vector3d( 4.0e6, -5.0e6, 1.0e6 ) );
+
+    std::vector< int > maximumDegrees = { 4, 8, 20, 50 };
+    for( unsigned int k = 0; k < maximumDegrees.size( ); k++ )
+    {
+        // Define (synthetic) geodesy-normalized coefficients, with maximum order below maximum degree for one case
+        const int maximumDegree = maximumDegrees.at( k );
+        const int maximumOrder = ( k == 2 ) ? maximumDegree - 3 : maximumDegree;
+        Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+        Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+        cosineCoefficients( 0, 0 ) = 1.0;
+        cosineCoefficients( 2, 0 ) = -4.84165E-4;
+        for( int degree = 2; degree <= maximumDegree; degree++ )
+        {
+            for( int order = ( degree == 2 ) ? 1 : 0; order <= std::min( degree, maximumOrder ); order++ )
+            {
+                cosineCoefficients( degree, order ) = 1.0E-5 * std::sin( 1.3 * degree + 0.7 * order ) /
+                        static_cast< double >( degree * degree );
+                if( order > 0 )
+                {
+                    sineCoefficients( degree, order ) = 1.0E-5 * std::cos( 0.9 * degree - 1.1 * order ) /
+                            static_cast< double >( degree * degree );
+                }
+            }
+        }
+
+        for( unsigned int i = 0; i <= positions.size( ); i++ )
+        {
+            // Last test position is (close to) the pole
+            Eigen::Vector3d position = ( i < positions.size( ) ) ? positions.at( i ) : Eigen::Vector3d( 1.0, 0.0, -7.0E6 );
+
+            std::vector< Eigen::Vector3d > accelerations;
+            for( unsigned int test = 0; test < 2; test++ )
+            {
+                std::shared_ptr< SphericalHarmonicsCache > sphericalHarmonicsCache =
+                        std::make_shared< SphericalHarmonicsCache >( );
+                if( test == 1 )
+                {
+                    sphericalHarmonicsCache->setSummationType( cartesian_spherical_harmonics_summation );
+                }
+
+                SphericalHarmonicsGravitationalAccelerationModelPointer earthGravity
+                        = std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                            [ & ]( Eigen::Vector3d& input ){ input = position; }, gravitationalParameter, planetaryRadius,
+                            cosineCoefficients, sineCoefficients,
+                            [ ]( Eigen::Vector3d& input ){ input = Eigen::Vector3d::Zero( ); },
+                            [ ]( ){ return Eigen::Quaterniond( Eigen::AngleAxisd( 0.3, Eigen::Vector3d::UnitZ( ) ) ); },
+                            false, sphericalHarmonicsCache );
+                earthGravity->updateMembers( 0.0 );
+                accelerations.push_back( earthGravity->getAcceleration( ) );
+            }
+
+            if( i < positions.size( ) )
+            {
+                for( int j = 0; j < 3; j++ )
+                {
+                    BOOST_CHECK_SMALL( std::fabs( accelerations.at( 1 )( j ) - accelerations.at( 0 )( j ) ),
+                                       1.0E-14 * accelerations.at( 0 ).norm( ) );
+                }
+            }
+            else
+            {
+                // Check that Cartesian formulation at the pole is consistent with standard formulation close to the pole
+                position.x( ) = 0.0;
+                std::shared_ptr< SphericalHarmonicsCache > sphericalHarmonicsCache =
+                        std::make_shared< SphericalHarmonicsCache >( );
+                sphericalHarmonicsCache->setSummationType( cartesian_spherical_harmonics_summation );
+                std::map< std::pair< int, int >, Eigen::Vector3d > dummyMap;
+                Eigen::Vector3d poleAcceleration = computeGeodesyNormalizedGravitationalAccelerationSum(
+                            position, gravitationalParameter, planetaryRadius, cosineCoefficients, sineCoefficients,
+                            sphericalHarmonicsCache, dummyMap );
+                Eigen::Vector3d nearPoleAcceleration = Eigen::AngleAxisd( 0.3, Eigen::Vector3d::UnitZ( ) ).inverse( ) *
+                        accelerations.at( 0 );
+                for( int j = 0; j < 3; j++ )
+                {
+                    BOOST_CHECK_SMALL( std::fabs( poleAcceleration( j ) - nearPoleAcceleration( j ) ),
+                                       1.0E-6 * poleAcceleration.norm( ) );
+                }
+            }
+        }
+    }
+}
+
+// Test truncation of spherical harmonic expansion as a function of distance
+BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalAccelerationDegreeTruncation )
+{
+    using namespace gravitation;
+
+    // Define (synthetic) geodesy-normalized coefficients up to degree and order 60
+    const double gravitationalParameter = 3.986004418e14;
+    const double planetaryRadius = 6378137.0;
+    const int maximumDegree = 60;
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    cosineCoefficients( 2, 0 ) = -4.84165E-4;
+    for( int degree = 2; degree <= maximumDegree; degree++ )
+    {
+        for( int order = ( degree == 2 ) ? 1 : 0; order <= degree; order++ )
+        {
+            cosineCoefficients( degree, order ) = 1.0E-5 * std::sin( 1.3 * degree + 0.7 * order ) /
+                    static_cast< double >( degree * degree );
+            if( order > 0 )
+            {
+                sineCoefficients( degree, order ) = 1.0E-5 * std::cos( 0.9 * degree - 1.1 * order ) /
+                        static_cast< double >( degree * degree );
+            }
+        }
+    }
+
+    Eigen::Vector3d position;
+    SphericalHarmonicsGravitationalAccelerationModelPointer fullGravity
+            = std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                [ & ]( Eigen::Vector3d& input ){ input = position; }, gravitationalParameter, planetaryRadius,
+                cosineCoefficients, sineCoefficients );
+    SphericalHarmonicsGravitationalAccelerationModelPointer truncatedGravity
+            = std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                [ & ]( Eigen::Vector3d& input ){ input = position; }, gravitationalParameter, planetaryRadius,
+                cosineCoefficients, sineCoefficients );
+    BOOST_CHECK( std::isnan( truncatedGravity->getDegreeTruncationTolerance( ) ) );
+
+    const double tolerance = 1.0E-9;
+    truncatedGravity->setDegreeTruncationTolerance( tolerance );
+    truncatedGravity->setSaveSphericalHarmonicTermsSeparately( true );
+    BOOST_CHECK_THROW( truncatedGravity->setDegreeTruncationTolerance( -1.0 ), std::runtime_error );
+
+    // Evaluate acceleration at increasing and decreasing distance
+    int previousDegree = maximumDegree + 1;
+    std::vector< double > distances = { 6.8E6, 8.0E6, 1.2E7, 2.6E7, 4.2E7, 3.8E8, 2.6E7, 6.8E6 };
+    for( unsigned int i = 0; i < distances.size( ); i++ )
+    {
+        position = distances.at( i ) * Eigen::Vector3d( 0.6, -0.48, 0.64 );
+        fullGravity->updateMembers( static_cast< double >( i ) );
+        truncatedGravity->updateMembers( static_cast< double >( i ) );
+
+        // Check that evaluated degree decreases with distance, and that the difference w.r.t. the full expansion is
+        // below tolerance
+        const int currentDegree = truncatedGravity->getCurrentMaximumDegree( );
+        BOOST_CHECK( currentDegree <= maximumDegree );
+        if( i < 6 )
+        {
+            BOOST_CHECK( currentDegree <= previousDegree );
+        }
+        previousDegree = currentDegree;
+
+        // Omitted contribution is an estimate (RMS over the sphere), not a strict bound
+        BOOST_CHECK_SMALL( ( truncatedGravity->getAcceleration( ) - fullGravity->getAcceleration( ) ).norm( ), 2.0 * tolerance );
+        BOOST_CHECK_EQUAL( truncatedGravity->getCurrentCosineHarmonicCoefficients( ).rows( ), currentDegree + 1 );
+
+        // Check that contributions of omitted terms are zero
+        Eigen::VectorXd termNorms = truncatedGravity->getConcatenatedAccelerationComponentNorms(
+        { std::make_pair( 2, 0 ), std::make_pair( maximumDegree, maximumDegree ) } );
+        BOOST_CHECK( termNorms( 0 ) > 0.0 );
+        BOOST_CHECK_EQUAL( termNorms( 1 ) == 0.0, currentDegree < maximumDegree );
+    }
+
+    // Check that expansion is (nearly) fully evaluated close to the body, and truncated to low degree far from it
+    BOOST_CHECK( previousDegree > maximumDegree / 2 );
+    truncatedGravity->updateMembers( 100.0 );
+    position = 3.8E8 * Eigen::Vector3d::UnitX( );
+    truncatedGravity->updateMembers( 101.0 );
+    BOOST_CHECK( truncatedGravity->getCurrentMaximumDegree( ) <= 2 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -11,6 +11,8 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MAIN
 
+#include <limits>
+
 #include <boost/test/unit_test.hpp>
 
 #include "tudat/basics/testMacros.h"
@@ -389,6 +391,87 @@ BOOST_AUTO_TEST_CASE( test_GroundStationTimeVaryingState )
     }
 }
 
+//! Test if tabulated body deformation of ground stations reproduces the directly computed deformation.
+BOOST_AUTO_TEST_CASE( test_GroundStationTabulatedBodyDeformation )
+{
+    spice_interface::loadStandardSpiceKernels( );
+
+    std::vector< std::string > bodyNames = { "Earth", "Sun", "Moon" };
+    BodyListSettings bodySettings = getDefaultBodySettings( bodyNames );
+    std::map< int, std::pair< double, double > > loveNumbers;
+    loveNumbers[ 2 ] = std::make_pair( 0.6, 0.0 );
+    bodySettings.at( "Earth" )->bodyDeformationSettings.push_back(
+                std::make_shared< BasicSolidBodyDeformationSettings >(
+                    std::vector< std::string >( { "Moon", "Sun" } ), loveNumbers ) );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+
+    // Create station with only body deformation, and station with additional linear motion
+    const Eigen::Vector3d nominalStationState( 1917032.190, 6029782.349, -801376.113 );
+    Eigen::Vector3d linearMotion = ( Eigen::Vector3d( ) << 2.1, 0.5 , -1.5 ).finished( ) / physical_constants::JULIAN_YEAR;
+    createGroundStation( bodies.at( "Earth" ), "Station1", nominalStationState );
+    createGroundStation( bodies.at( "Earth" ), "Station2", nominalStationState, cartesian_position,
+                         { std::make_shared< LinearGroundStationMotionSettings >( linearMotion, 0.0 ) } );
+
+    std::vector< std::shared_ptr< GroundStationState > > stationStates;
+    stationStates.push_back( bodies.at( "Earth" )->getGroundStation( "Station1" )->getNominalStationState( ) );
+    stationStates.push_back( bodies.at( "Earth" )->getGroundStation( "Station2" )->getNominalStationState( ) );
+
+    // Compute station positions before tabulation
+    double startTime = 1.0E7, endTime = 1.0E7 + 5.0 * physical_constants::JULIAN_DAY;
+    std::vector< double > testTimes;
+    for( int i = 0; i < 250; i++ )
+    {
+        testTimes.push_back( startTime - 3600.0 + 1800.0 * static_cast< double >( i ) + 12.3 );
+    }
+
+    std::vector< std::vector< Eigen::Vector3d > > directPositions( stationStates.size( ) );
+    for( unsigned int i = 0; i < stationStates.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < testTimes.size( ); j++ )
+        {
+            directPositions[ i ].push_back( stationStates.at( i )->getCartesianPositionInTime( testTimes.at( j ) ) );
+        }
+    }
+
+    // Tabulate deformation, and compare station positions
+    tabulateGroundStationBodyDeformations( bodies, startTime, endTime );
+
+    BOOST_CHECK_EQUAL( ( std::dynamic_pointer_cast< TabulatedStationMotionModel >(
+                             stationStates.at( 0 )->getStationMotionModel( ) ) != nullptr ), true );
+    std::shared_ptr< CombinedStationMotionModel > combinedModel =
+            std::dynamic_pointer_cast< CombinedStationMotionModel >( stationStates.at( 1 )->getStationMotionModel( ) );
+    BOOST_CHECK_EQUAL( ( combinedModel != nullptr ), true );
+    BOOST_CHECK_EQUAL( ( std::dynamic_pointer_cast< TabulatedStationMotionModel >(
+                             combinedModel->getModelList( ).at( 0 ) ) != nullptr ), true );
+    BOOST_CHECK_EQUAL( ( std::dynamic_pointer_cast< LinearStationMotionModel >(
+                             combinedModel->getModelList( ).at( 1 ) ) != nullptr ), true );
+
+    for( unsigned int i = 0; i < stationStates.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < testTimes.size( ); j++ )
+        {
+            Eigen::Vector3d positionDifference =
+                    stationStates.at( i )->getCartesianPositionInTime( testTimes.at( j ) ) - directPositions.at( i ).at( j );
+            if( testTimes.at( j ) >= startTime && testTimes.at( j ) <= endTime )
+            {
+                BOOST_CHECK_SMALL( positionDifference.norm( ), 1.0E-6 );
+            }
+            else
+            {
+                BOOST_CHECK_SMALL( positionDifference.norm( ), std::numeric_limits< double >::epsilon( ) * 1.0E8 );
+            }
+        }
+    }
+
+    // Check that repeated tabulation starts from original model
+    tabulateGroundStationBodyDeformations( bodies, startTime, endTime, 900.0 );
+    std::shared_ptr< TabulatedStationMotionModel > tabulatedModel =
+            std::dynamic_pointer_cast< TabulatedStationMotionModel >( stationStates.at( 0 )->getStationMotionModel( ) );
+    BOOST_CHECK_EQUAL( tabulatedModel->getTimeStep( ), 900.0 );
+    BOOST_CHECK_EQUAL( ( std::dynamic_pointer_cast< BodyDeformationStationMotionModel >(
+                             tabulatedModel->getOriginalModel( ) ) != nullptr ), true );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -18,6 +18,8 @@
 #include "tudat/astro/basic_astro/unitConversions.h"
 #include "tudat/astro/ground_stations/pointingAnglesCalculator.h"
 #include "tudat/astro/ground_stations/groundStationState.h"
+#include "tudat/astro/ground_stations/groundStationNetwork.h"
+#include "tudat/astro/ephemerides/simpleRotationalEphemeris.h"
 #include "tudat/astro/basic_astro/sphericalBodyShapeModel.h"
 #include "tudat/math/basic/coordinateConversions.h"
 #include "tudat/simulation/environment_setup/body.h"
@@ -190,6 +192,93 @@ BOOST_AUTO_TEST_CASE( test_PointingAnglesCalculatorHorizons )
 
 }
 
+BOOST_AUTO_TEST_CASE( test_GroundStationNetwork )
+{
+    // Create body with simple rotation model
+    SystemOfBodies bodies;
+    bodies.createEmptyBody( "Earth" );
+    std::shared_ptr< RotationalEphemeris > earthRotationModel = std::make_shared< SimpleRotationalEphemeris >(
+                0.3, 1.1, 0.5, 7.292115E-5, 0.0, "ECLIPJ2000", "IAU_Earth" );
+    bodies.at( "Earth" )->setRotationalEphemeris( earthRotationModel );
+    bodies.at( "Earth" )->setShapeModel( std::make_shared< SphericalBodyShapeModel >( 6378.0E3 ) );
+
+    // Create set of ground stations, one of which moves in the body-fixed frame
+    std::vector< std::string > stationNames;
+    for( int i = 0; i < 12; i++ )
+    {
+        stationNames.push_back( "Station" + std::to_string( i ) );
+        Eigen::Vector3d stationPosition =
+                ( Eigen::Vector3d( ) << 6378.0E3 + 100.0 * i, -1.2 + 0.2 * i,
+                  convertDegreesToRadians( 30.0 * i ) - mathematical_constants::PI ).finished( );
+
+        std::vector< std::shared_ptr< GroundStationMotionSettings > > stationMotionSettings;
+        if( i == 3 )
+        {
+            stationMotionSettings.push_back( std::make_shared< LinearGroundStationMotionSettings >(
+                                                 Eigen::Vector3d( 0.1, -0.2, 0.05 ) ) );
+        }
+        createGroundStation( bodies.at( "Earth" ), stationNames.at( i ), stationPosition,
+                             coordinate_conversions::spherical_position, stationMotionSettings );
+    }
+
+    // Create network with stations in reverse order
+    std::vector< std::string > networkStationNames = stationNames;
+    std::reverse( networkStationNames.begin( ), networkStationNames.end( ) );
+    std::shared_ptr< GroundStationNetwork > stationNetwork =
+            createGroundStationNetwork( bodies.at( "Earth" ), networkStationNames );
+    BOOST_CHECK_EQUAL( stationNetwork->getNumberOfStations( ), 12 );
+
+    Eigen::Vector3d targetPosition( 2.0E7, -1.5E7, 3.0E6 );
+    Eigen::VectorXd elevationAngles, azimuthAngles;
+    std::vector< double > testTimes = { -3600.0, 0.0, 1.0E5, 1.0E7 };
+    for( double testTime : testTimes )
+    {
+        const Eigen::Matrix< double, 6, Eigen::Dynamic >& stationStates =
+                stationNetwork->getStationStatesInBaseFrame( testTime );
+        stationNetwork->calculatePointingAngles( targetPosition, testTime, elevationAngles, azimuthAngles );
+
+        // Compare against states and pointing angles of individual stations
+        for( int i = 0; i < stationNetwork->getNumberOfStations( ); i++ )
+        {
+            std::shared_ptr< GroundStation > currentStation =
+                    bodies.at( "Earth" )->getGroundStation( networkStationNames.at( i ) );
+            Eigen::Vector6d expectedState = transformStateToInertialOrientation< double, double >(
+                        currentStation->getStateInPlanetFixedFrame< double, double >( testTime ), testTime,
+                        earthRotationModel );
+            for( int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( expectedState( j ) - stationStates( j, i ) ), 1.0E-8 );
+                BOOST_CHECK_SMALL( std::fabs( expectedState( j + 3 ) - stationStates( j + 3, i ) ), 1.0E-12 );
+            }
+
+            Eigen::Vector3d relativePosition = targetPosition - expectedState.segment( 0, 3 );
+            std::pair< double, double > expectedPointingAngles =
+                    currentStation->getPointingAnglesCalculator( )->calculatePointingAngles( relativePosition, testTime );
+            BOOST_CHECK_SMALL( std::fabs( expectedPointingAngles.first - elevationAngles( i ) ), 1.0E-12 );
+            BOOST_CHECK_SMALL( std::fabs( expectedPointingAngles.second - azimuthAngles( i ) ), 1.0E-12 );
+        }
+    }
+
+    // Check that station position changes are used by the network
+    bodies.at( "Earth" )->getGroundStation( networkStationNames.at( 0 ) )->getNominalStationState( )->
+            resetGroundStationPositionAtEpoch( Eigen::Vector3d( 1.0E6, 2.0E6, 6.0E6 ) );
+    stationNetwork->resetCurrentTime( );
+    BOOST_CHECK_SMALL( ( stationNetwork->getStationStatesInBodyFixedFrame( 0.0 ).block( 0, 0, 3, 1 ) -
+                         Eigen::Vector3d( 1.0E6, 2.0E6, 6.0E6 ) ).norm( ), 1.0E-12 );
+
+    // Check that station names are checked
+    bool exceptionCaught = false;
+    try
+    {
+        createGroundStationNetwork( bodies.at( "Earth" ), { "Station0", "Station12" } );
+    }
+    catch( std::runtime_error const& )
+    {
+        exceptionCaught = true;
+    }
+    BOOST_CHECK( exceptionCaught );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -938,6 +938,26 @@ BOOST_AUTO_TEST_CASE( test_hodographic_shaping_with_free_parameters )
     // Check initial and final state on output list
     TUDAT_CHECK_MATRIX_CLOSE_FRACTION( cartesianStateDepartureBody, statesAlongTrajectory.begin( )->second, 1.0E-5 );
     TUDAT_CHECK_MATRIX_CLOSE_FRACTION( cartesianStateArrivalBody, statesAlongTrajectory.rbegin( )->second, 1.0E-5 );
+
+    // Check that values cached at the quadrature nodes are correctly updated when free coefficients and time of flight change
+    double originalDeltaV = hodographicShapingLeg.getLegDeltaV( );
+    hodographicShapingLeg.updateLegParameters(
+            ( Eigen::VectorXd( 9 ) << julianDate, julianDate + timeOfFlight  * physical_constants::JULIAN_DAY,
+            numberOfRevolutions,  freeCoefficientsRadialVelocityFunction, freeCoefficientsNormalVelocityFunction,
+            1.1 * freeCoefficientsAxialVelocityFunction ).finished( ) );
+    BOOST_CHECK( std::fabs( hodographicShapingLeg.getLegDeltaV( ) - originalDeltaV ) > 1.0 );
+
+    hodographicShapingLeg.updateLegParameters(
+            ( Eigen::VectorXd( 9 ) << julianDate, julianDate + 1.2 * timeOfFlight  * physical_constants::JULIAN_DAY,
+            numberOfRevolutions,  freeCoefficientsRadialVelocityFunction, freeCoefficientsNormalVelocityFunction,
+            freeCoefficientsAxialVelocityFunction ).finished( ) );
+    BOOST_CHECK( std::fabs( hodographicShapingLeg.getLegDeltaV( ) - originalDeltaV ) > 1.0 );
+
+    hodographicShapingLeg.updateLegParameters(
+            ( Eigen::VectorXd( 9 ) << julianDate, julianDate + timeOfFlight  * physical_constants::JULIAN_DAY,
+            numberOfRevolutions,  freeCoefficientsRadialVelocityFunction, freeCoefficientsNormalVelocityFunction,
+            freeCoefficientsAxialVelocityFunction ).finished( ) );
+    BOOST_CHECK_CLOSE_FRACTION( hodographicShapingLeg.getLegDeltaV( ), originalDeltaV, 1.0E-12 );
 }
 
 //    /// Second Earth-Mercury transfer.
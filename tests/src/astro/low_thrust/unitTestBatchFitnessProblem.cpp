@@ -0,0 +1,179 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/astro/low_thrust/batchFitnessProblem.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+//! Test problem (Rosenbrock function with one inequality constraint), with reusable per-worker state
+class RosenbrockTestProblem
+{
+public:
+
+    RosenbrockTestProblem( const int dimension = 4 ):
+        dimension_( dimension ), workBuffer_( std::make_shared< std::vector< double > >( ) ),
+        numberOfEvaluations_( std::make_shared< int >( 0 ) ) { }
+
+    std::vector< double > fitness( const std::vector< double >& decisionVector ) const
+    {
+        if( static_cast< int >( decisionVector.size( ) ) != dimension_ )
+        {
+            throw std::runtime_error( "Wrong size of decision vector" );
+        }
+
+        // Reuse buffer, mimicking leg objects that are re-evaluated for each decision vector
+        workBuffer_->assign( decisionVector.begin( ), decisionVector.end( ) );
+        ( *numberOfEvaluations_ )++;
+
+        double objective = 0.0;
+        double squaredNorm = 0.0;
+        for( int i = 0; i < dimension_ - 1; i++ )
+        {
+            objective += 100.0 * std::pow( workBuffer_->at( i + 1 ) - workBuffer_->at( i ) * workBuffer_->at( i ), 2 ) +
+                    std::pow( 1.0 - workBuffer_->at( i ), 2 );
+        }
+        for( int i = 0; i < dimension_; i++ )
+        {
+            squaredNorm += workBuffer_->at( i ) * workBuffer_->at( i );
+        }
+        return { objective, squaredNorm - 2.0 };
+    }
+
+    std::pair< std::vector< double >, std::vector< double > > get_bounds( ) const
+    {
+        return { std::vector< double >( dimension_, -2.0 ), std::vector< double >( dimension_, 2.0 ) };
+    }
+
+    std::size_t get_nic( ) const
+    {
+        return 1;
+    }
+
+    int getNumberOfEvaluations( ) const
+    {
+        return *numberOfEvaluations_;
+    }
+
+private:
+
+    int dimension_;
+
+    std::shared_ptr< std::vector< double > > workBuffer_;
+
+    std::shared_ptr< int > numberOfEvaluations_;
+};
+
+BOOST_AUTO_TEST_SUITE( test_batch_fitness_problem )
+
+//! Test if batch fitness evaluation is identical to serial evaluation, and independent of number of workers
+BOOST_AUTO_TEST_CASE( testBatchFitnessEvaluation )
+{
+    using namespace low_thrust_trajectories;
+
+    const int dimension = 4;
+    const int populationSize = 37;
+
+    // Create population
+    std::vector< double > decisionVectors( populationSize * dimension );
+    for( unsigned int i = 0; i < decisionVectors.size( ); i++ )
+    {
+        decisionVectors.at( i ) = 2.0 * std::sin( 0.37 * static_cast< double >( i ) + 0.1 );
+    }
+
+    // Compute fitness serially
+    RosenbrockTestProblem serialProblem( dimension );
+    std::vector< double > serialFitness;
+    for( int i = 0; i < populationSize; i++ )
+    {
+        std::vector< double > currentFitness = serialProblem.fitness(
+                    std::vector< double >( decisionVectors.begin( ) + i * dimension,
+                                           decisionVectors.begin( ) + ( i + 1 ) * dimension ) );
+        serialFitness.insert( serialFitness.end( ), currentFitness.begin( ), currentFitness.end( ) );
+    }
+
+    for( int numberOfWorkers = 1; numberOfWorkers <= 6; numberOfWorkers++ )
+    {
+        std::vector< RosenbrockTestProblem > workerProblems;
+        for( int i = 0; i < numberOfWorkers; i++ )
+        {
+            workerProblems.push_back( RosenbrockTestProblem( dimension ) );
+        }
+        BatchFitnessProblem< RosenbrockTestProblem > batchProblem( workerProblems );
+        BOOST_CHECK_EQUAL( batchProblem.get_nobj( ), 1 );
+        BOOST_CHECK_EQUAL( batchProblem.get_nec( ), 0 );
+        BOOST_CHECK_EQUAL( batchProblem.get_nic( ), 1 );
+
+        // Evaluate twice, to check reuse of thread pool
+        for( int j = 0; j < 2; j++ )
+        {
+            std::vector< double > batchFitness = batchProblem.batch_fitness( decisionVectors );
+            BOOST_CHECK_EQUAL( batchFitness.size( ), serialFitness.size( ) );
+            for( unsigned int i = 0; i < serialFitness.size( ); i++ )
+            {
+                BOOST_CHECK_EQUAL( batchFitness.at( i ), serialFitness.at( i ) );
+            }
+        }
+
+        // Check deterministic distribution of work over workers
+        for( int i = 0; i < numberOfWorkers; i++ )
+        {
+            int expectedNumberOfEvaluations = 2 * ( ( populationSize - i + numberOfWorkers - 1 ) / numberOfWorkers );
+            BOOST_CHECK_EQUAL( batchProblem.getWorkerProblem( i ).getNumberOfEvaluations( ),
+                               expectedNumberOfEvaluations );
+        }
+
+        // Check that copies evaluate correctly
+        BatchFitnessProblem< RosenbrockTestProblem > copiedBatchProblem = batchProblem;
+        std::vector< double > copiedBatchFitness = copiedBatchProblem.batch_fitness( decisionVectors );
+        for( unsigned int i = 0; i < serialFitness.size( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( copiedBatchFitness.at( i ), serialFitness.at( i ) );
+        }
+    }
+
+    // Check that empty batch is handled
+    BatchFitnessProblem< RosenbrockTestProblem > batchProblem( { RosenbrockTestProblem( dimension ),
+                                                                 RosenbrockTestProblem( dimension ) } );
+    BOOST_CHECK_EQUAL( batchProblem.batch_fitness( std::vector< double >( ) ).size( ), 0 );
+}
+
+//! Test if errors are caught in batch fitness evaluation
+BOOST_AUTO_TEST_CASE( testBatchFitnessErrors )
+{
+    using namespace low_thrust_trajectories;
+
+    BOOST_CHECK_THROW( BatchFitnessProblem< RosenbrockTestProblem >(
+                           std::vector< RosenbrockTestProblem >( ) ), std::runtime_error );
+    BOOST_CHECK_THROW( BatchFitnessProblem< RosenbrockTestProblem >( RosenbrockTestProblem( 4 ), 0 ),
+                       std::runtime_error );
+
+    // Check that inconsistent batch size is detected
+    BatchFitnessProblem< RosenbrockTestProblem > batchProblem( RosenbrockTestProblem( 4 ), 3 );
+    BOOST_CHECK_THROW( batchProblem.batch_fitness( std::vector< double >( 10, 0.5 ) ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
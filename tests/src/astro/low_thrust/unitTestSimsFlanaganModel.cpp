@@ -0,0 +1,176 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/astro/basic_astro/physicalConstants.h"
+#include "tudat/astro/low_thrust/simsFlanaganModel.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace low_thrust_trajectories;
+
+BOOST_AUTO_TEST_SUITE( test_sims_flanagan_model )
+
+//! Create Sims-Flanagan model for a heliocentric transfer, with given throttles
+SimsFlanaganModel createTestModel( std::vector< Eigen::Vector3d >& throttles )
+{
+    double centralBodyGravitationalParameter = 1.32712440018e20;
+    double departureRadius = physical_constants::ASTRONOMICAL_UNIT;
+    double arrivalRadius = 1.5 * physical_constants::ASTRONOMICAL_UNIT;
+    Eigen::Vector6d stateAtDeparture, stateAtArrival;
+    stateAtDeparture << departureRadius, 0.0, 0.0, 0.0, std::sqrt( centralBodyGravitationalParameter / departureRadius ), 0.0;
+    stateAtArrival << -0.2 * arrivalRadius, 0.98 * arrivalRadius, 0.01 * physical_constants::ASTRONOMICAL_UNIT,
+            -0.98 * std::sqrt( centralBodyGravitationalParameter / arrivalRadius ),
+            -0.2 * std::sqrt( centralBodyGravitationalParameter / arrivalRadius ), 0.0;
+
+    return SimsFlanaganModel(
+                stateAtDeparture, stateAtArrival, centralBodyGravitationalParameter, 2000.0, 0.8,
+                [ ]( const double currentTime ){ return 3000.0 + 1.0E-6 * currentTime; },
+                250.0 * physical_constants::JULIAN_DAY, throttles );
+}
+
+//! Test analytical partials of deltaV and match point states w.r.t. throttles, against central differences
+BOOST_AUTO_TEST_CASE( test_Sims_Flanagan_throttle_partials )
+{
+    // Define throttles (odd number of segments, so that forward and backward propagation have different segment durations)
+    int numberOfSegments = 7;
+    std::vector< Eigen::Vector3d > throttles;
+    for( int i = 0; i < numberOfSegments; i++ )
+    {
+        throttles.push_back( Eigen::Vector3d(
+                                 0.6 * std::sin( 5.1 * i + 0.3 ), 0.6 * std::sin( 5.1 * i + 2.0 ),
+                                 0.3 * std::sin( 5.1 * i + 3.7 ) ) );
+    }
+
+    // Compute partials, and check consistency of match point states with regular propagation
+    SimsFlanaganModel model = createTestModel( throttles );
+    Eigen::MatrixXd deltaVPartials, forwardStatePartials, backwardStatePartials;
+    model.computeThrottlePartials( deltaVPartials, forwardStatePartials, backwardStatePartials );
+    BOOST_CHECK_EQUAL( deltaVPartials.rows( ), 1 );
+    BOOST_CHECK_EQUAL( deltaVPartials.cols( ), 3 * numberOfSegments );
+    BOOST_CHECK_EQUAL( forwardStatePartials.rows( ), 6 );
+    BOOST_CHECK_EQUAL( backwardStatePartials.cols( ), 3 * numberOfSegments );
+
+    Eigen::Vector6d forwardState = model.getStateAtMatchPointForwardPropagation( );
+    Eigen::Vector6d backwardState = model.getStateAtMatchPointBackwardPropagation( );
+    model.propagateForwardFromDepartureToMatchPoint( );
+    model.propagateBackwardFromArrivalToMatchPoint( );
+    for( int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( forwardState( i ), model.getStateAtMatchPointForwardPropagation( )( i ), 1.0E-12 );
+        BOOST_CHECK_CLOSE_FRACTION( backwardState( i ), model.getStateAtMatchPointBackwardPropagation( )( i ), 1.0E-12 );
+    }
+
+    // Compare with central differences
+    double throttleStep = 1.0E-5;
+    for( int i = 0; i < 3 * numberOfSegments; i++ )
+    {
+        std::vector< Eigen::Vector3d > upperThrottles = throttles;
+        std::vector< Eigen::Vector3d > lowerThrottles = throttles;
+        upperThrottles[ i / 3 ]( i % 3 ) += throttleStep;
+        lowerThrottles[ i / 3 ]( i % 3 ) -= throttleStep;
+
+        SimsFlanaganModel upperModel = createTestModel( upperThrottles );
+        SimsFlanaganModel lowerModel = createTestModel( lowerThrottles );
+        upperModel.propagateForwardFromDepartureToMatchPoint( );
+        upperModel.propagateBackwardFromArrivalToMatchPoint( );
+        lowerModel.propagateForwardFromDepartureToMatchPoint( );
+        lowerModel.propagateBackwardFromArrivalToMatchPoint( );
+
+        double numericalDeltaVPartial =
+                ( upperModel.getTotalDeltaV( ) - lowerModel.getTotalDeltaV( ) ) / ( 2.0 * throttleStep );
+        BOOST_CHECK_SMALL( deltaVPartials( 0, i ) - numericalDeltaVPartial, 1.0E-6 * deltaVPartials.norm( ) );
+
+        Eigen::Vector6d numericalForwardStatePartial =
+                ( upperModel.getStateAtMatchPointForwardPropagation( ) -
+                  lowerModel.getStateAtMatchPointForwardPropagation( ) ) / ( 2.0 * throttleStep );
+        Eigen::Vector6d numericalBackwardStatePartial =
+                ( upperModel.getStateAtMatchPointBackwardPropagation( ) -
+                  lowerModel.getStateAtMatchPointBackwardPropagation( ) ) / ( 2.0 * throttleStep );
+        for( int j = 0; j < 2; j++ )
+        {
+            BOOST_CHECK_SMALL( ( forwardStatePartials.block( 3 * j, i, 3, 1 ) -
+                                 numericalForwardStatePartial.segment( 3 * j, 3 ) ).norm( ),
+                               1.0E-6 * forwardStatePartials.block( 3 * j, 0, 3, 3 * numberOfSegments ).norm( ) );
+            BOOST_CHECK_SMALL( ( backwardStatePartials.block( 3 * j, i, 3, 1 ) -
+                                 numericalBackwardStatePartial.segment( 3 * j, 3 ) ).norm( ),
+                               1.0E-6 * backwardStatePartials.block( 3 * j, 0, 3, 3 * numberOfSegments ).norm( ) );
+        }
+
+        // Forward match point state is independent of throttles in backward propagation (mass at arrival, from which
+        // backward propagation starts, does depend on all throttles)
+        if( i / 3 >= ( numberOfSegments + 1 ) / 2 )
+        {
+            BOOST_CHECK_EQUAL( forwardStatePartials.col( i ).norm( ), 0.0 );
+        }
+    }
+}
+
+//! Test thrust acceleration created from the Sims-Flanagan model, using an engine model added to the propagated body
+BOOST_AUTO_TEST_CASE( test_Sims_Flanagan_thrust_acceleration )
+{
+    int numberOfSegments = 4;
+    std::vector< Eigen::Vector3d > throttles;
+    for( int i = 0; i < numberOfSegments; i++ )
+    {
+        throttles.push_back( Eigen::Vector3d( 0.2 * ( i + 1 ), -0.1 * i, 0.3 ) );
+    }
+    SimsFlanaganModel model = createTestModel( throttles );
+
+    simulation_setup::BodyListSettings bodySettings( "SSB", "ECLIPJ2000" );
+    bodySettings.addSettings( "Sun" );
+    bodySettings.at( "Sun" )->ephemerisSettings = simulation_setup::constantEphemerisSettings( Eigen::Vector6d::Zero( ) );
+    bodySettings.at( "Sun" )->gravityFieldSettings = simulation_setup::centralGravitySettings( 1.32712440018e20 );
+    simulation_setup::SystemOfBodies bodies = simulation_setup::createSystemOfBodies( bodySettings );
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.at( "Vehicle" )->setConstantBodyMass( 1500.0 );
+
+    basic_astrodynamics::AccelerationMap accelerationMap =
+            model.getLowThrustTrajectoryAccelerationMap( bodies, "Vehicle", "Sun" );
+    BOOST_CHECK_EQUAL( accelerationMap.at( "Vehicle" ).at( "Sun" ).size( ), 1 );
+    BOOST_CHECK_EQUAL( accelerationMap.at( "Vehicle" ).at( "Vehicle" ).size( ), 1 );
+    BOOST_CHECK( bodies.at( "Vehicle" )->getVehicleSystems( )->getEngineModels( ).size( ) == 1 );
+
+    // Check thrust acceleration in the middle of each segment (with body-fixed frame aligned with propagation frame)
+    Eigen::Vector7d identityRotationalState = Eigen::Vector7d::Zero( );
+    identityRotationalState( 0 ) = 1.0;
+    bodies.at( "Vehicle" )->setCurrentRotationalStateToLocalFrame( identityRotationalState );
+    std::shared_ptr< basic_astrodynamics::AccelerationModel3d > thrustAcceleration =
+            accelerationMap.at( "Vehicle" ).at( "Vehicle" ).at( 0 );
+    double timeOfFlight = model.getTimeOfFlight( );
+    std::vector< double > testTimes = { 0.125 * timeOfFlight, 0.375 * timeOfFlight, 0.625 * timeOfFlight, 0.875 * timeOfFlight };
+    for( int i = 0; i < numberOfSegments; i++ )
+    {
+        thrustAcceleration->resetCurrentTime( );
+        thrustAcceleration->updateMembers( testTimes.at( i ) );
+        Eigen::Vector3d expectedAcceleration = model.getMaximumThrustValue( ) * throttles.at( i ) / 1500.0;
+        for( int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( thrustAcceleration->getAcceleration( )( j ) - expectedAcceleration( j ),
+                               1.0E-15 * expectedAcceleration.norm( ) );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,104 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/astro/basic_astro/physicalConstants.h"
+#include "tudat/astro/low_thrust/simsFlanaganOptimisationSetup.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace low_thrust_trajectories;
+
+BOOST_AUTO_TEST_SUITE( test_sims_flanagan_optimisation_setup )
+
+//! Test analytical gradient and batch fitness of Sims-Flanagan optimisation problem, against finite differences and
+//! single fitness evaluations, respectively.
+BOOST_AUTO_TEST_CASE( test_Sims_Flanagan_gradient_and_batch_fitness )
+{
+    double centralBodyGravitationalParameter = 1.32712440018e20;
+    double departureRadius = physical_constants::ASTRONOMICAL_UNIT;
+    double arrivalRadius = 1.5 * physical_constants::ASTRONOMICAL_UNIT;
+    Eigen::Vector6d stateAtDeparture, stateAtArrival;
+    stateAtDeparture << departureRadius, 0.0, 0.0, 0.0, std::sqrt( centralBodyGravitationalParameter / departureRadius ), 0.0;
+    stateAtArrival << -0.2 * arrivalRadius, 0.98 * arrivalRadius, 0.01 * physical_constants::ASTRONOMICAL_UNIT,
+            -0.98 * std::sqrt( centralBodyGravitationalParameter / arrivalRadius ),
+            -0.2 * std::sqrt( centralBodyGravitationalParameter / arrivalRadius ), 0.0;
+
+    int numberSegments = 6;
+    SimsFlanaganProblem problem(
+                stateAtDeparture, stateAtArrival, centralBodyGravitationalParameter, 2000.0, 0.8,
+                [ ]( const double ){ return 3000.0; }, numberSegments, 250.0 * physical_constants::JULIAN_DAY,
+                std::make_pair( std::vector< double >( ), TUDAT_NAN ), 1.0e-2, 4 );
+
+    // Define throttles, with magnitude exceeding 1 for the first segment
+    std::vector< double > throttles;
+    for( int i = 0; i < 3 * numberSegments; i++ )
+    {
+        throttles.push_back( 0.6 * std::sin( 1.7 * i + 0.3 ) );
+    }
+    throttles[ 0 ] = 0.9;
+    throttles[ 1 ] = 0.8;
+
+    // Compare gradient with central differences of fitness
+    std::vector< double > gradient = problem.gradient( throttles );
+    BOOST_CHECK_EQUAL( gradient.size( ), throttles.size( ) );
+    double maximumGradient = 0.0;
+    for( unsigned int i = 0; i < gradient.size( ); i++ )
+    {
+        maximumGradient = std::max( maximumGradient, std::fabs( gradient[ i ] ) );
+    }
+    for( unsigned int i = 0; i < throttles.size( ); i++ )
+    {
+        double throttleStep = 1.0E-5;
+        std::vector< double > upperThrottles = throttles;
+        std::vector< double > lowerThrottles = throttles;
+        upperThrottles[ i ] += throttleStep;
+        lowerThrottles[ i ] -= throttleStep;
+        double numericalGradient =
+                ( problem.fitness( upperThrottles )[ 0 ] - problem.fitness( lowerThrottles )[ 0 ] ) / ( 2.0 * throttleStep );
+        BOOST_CHECK_SMALL( ( gradient[ i ] - numericalGradient ) / maximumGradient, 1.0E-7 );
+    }
+
+    // Compare batch fitness with single fitness evaluations
+    int numberOfEvaluations = 7;
+    std::vector< double > throttlesBatch;
+    for( int j = 0; j < numberOfEvaluations; j++ )
+    {
+        for( unsigned int i = 0; i < throttles.size( ); i++ )
+        {
+            throttlesBatch.push_back( ( 1.0 - 0.1 * j ) * throttles[ i ] );
+        }
+    }
+    std::vector< double > fitnessBatch = problem.batch_fitness( throttlesBatch );
+    BOOST_CHECK_EQUAL( fitnessBatch.size( ), numberOfEvaluations );
+    for( int j = 0; j < numberOfEvaluations; j++ )
+    {
+        BOOST_CHECK_EQUAL( fitnessBatch[ j ], problem.fitness(
+                               std::vector< double >( throttlesBatch.begin( ) + j * throttles.size( ),
+                                                      throttlesBatch.begin( ) + ( j + 1 ) * throttles.size( ) ) )[ 0 ] );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
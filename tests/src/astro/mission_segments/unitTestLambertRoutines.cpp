@@ -564,6 +564,108 @@ BOOST_AUTO_TEST_CASE( testsolveLambertProblemGoodingElliptical )
     BOOST_CHECK_SMALL( testInertialVelocityAtArrival.z( ), tolerance );
 }
 
+//! Test the Householder-based Izzo Lambert routine for multi-revolution transfers, and the batch Lambert routine.
+BOOST_AUTO_TEST_CASE( testSolveLambertProblemIzzoHouseholderMultiRevolution )
+{
+    // Set tolerance.
+    const double tolerance = 1.0e-8;
+
+    // Define problem (tested using output from Keplerian_Toolbox PyKEP, see unitTestMultiRevolutionLambertTargeterIzzo)
+    const Eigen::Vector3d departurePosition( 4949101.422118526, 859402.44303969538, -151535.83799466802 );
+    const Eigen::Vector3d arrivalPosition( 3648349.9884584765, 4281879.3154454567, -755010.85145052616 );
+    const double timeOfFlight = 1.0307431655832210e+004;
+    const double gravitationalParameter = 398600.4418e9;
+
+    // Expected velocities at departure, for 0 revolutions and left/right branches of 1-4 revolutions
+    std::vector< Eigen::Vector3d > expectedVelocitiesAtDeparture;
+    expectedVelocitiesAtDeparture.push_back( Eigen::Vector3d( 10096.683162831092, 4333.9040463806396, -764.1842151784972 ) );
+    expectedVelocitiesAtDeparture.push_back( Eigen::Vector3d( 8918.2511158620255, 4409.3440789101496, -777.48632833897398 ) );
+    expectedVelocitiesAtDeparture.push_back( Eigen::Vector3d( -1265.9264854521089, 10660.067181950877, -1879.6574603427925 ) );
+    expectedVelocitiesAtDeparture.push_back( Eigen::Vector3d( 7764.4367242290973, 4541.6234715146611, -800.81075424687731 ) );
+    expectedVelocitiesAtDeparture.push_back( Eigen::Vector3d( -515.62716630712907, 9592.5976150608458, -1691.4337746149008 ) );
+    expectedVelocitiesAtDeparture.push_back( Eigen::Vector3d( 6500.2809323521278, 4773.7410262238855, -841.73934183818676 ) );
+    expectedVelocitiesAtDeparture.push_back( Eigen::Vector3d( 339.85968372598705, 8524.895950642951, -1503.1691638306909 ) );
+    expectedVelocitiesAtDeparture.push_back( Eigen::Vector3d( 4812.3627329648789, 5280.0203047688119, -931.01003841927343 ) );
+    expectedVelocitiesAtDeparture.push_back( Eigen::Vector3d( 1618.0817850471631, 7225.3760295124985, -1274.0287397672555 ) );
+
+    // Check maximum number of revolutions
+    BOOST_CHECK_EQUAL( mission_segments::computeMaximumNumberOfRevolutionsIzzo(
+                           departurePosition, arrivalPosition, timeOfFlight, gravitationalParameter ), 4 );
+
+    // Check solution for each number of revolutions and branch
+    Eigen::Vector3d velocityAtDeparture, velocityAtArrival;
+    for( unsigned int i = 0; i < expectedVelocitiesAtDeparture.size( ); i++ )
+    {
+        const int numberOfRevolutions = ( i + 1 ) / 2;
+        const bool isRightBranch = ( i > 0 ) && ( i % 2 == 0 );
+        BOOST_CHECK( mission_segments::solveLambertProblemIzzoHouseholder(
+                         departurePosition, arrivalPosition, timeOfFlight, gravitationalParameter,
+                         velocityAtDeparture, velocityAtArrival, numberOfRevolutions, isRightBranch ) );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( velocityAtDeparture, expectedVelocitiesAtDeparture.at( i ), tolerance );
+
+        // Check that arrival position is reached after the time of flight (with an additional revolution if required)
+        const double semiMajorAxis = 1.0 / ( 2.0 / departurePosition.norm( ) -
+                                             velocityAtDeparture.squaredNorm( ) / gravitationalParameter );
+        const double orbitalPeriod = 2.0 * mathematical_constants::PI *
+                std::sqrt( semiMajorAxis * semiMajorAxis * semiMajorAxis / gravitationalParameter );
+        const Eigen::Vector6d finalCartesianState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                    orbital_element_conversions::propagateKeplerOrbit(
+                        orbital_element_conversions::convertCartesianToKeplerianElements(
+                            ( Eigen::Vector6d( ) << departurePosition, velocityAtDeparture ).finished( ),
+                            gravitationalParameter ),
+                        timeOfFlight - numberOfRevolutions * orbitalPeriod, gravitationalParameter ),
+                    gravitationalParameter );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( ( finalCartesianState.segment( 0, 3 ) ), arrivalPosition, 1.0E-8 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( ( finalCartesianState.segment( 3, 3 ) ), velocityAtArrival, 1.0E-8 );
+    }
+
+    // Check that no solution is found for too many revolutions
+    BOOST_CHECK( !mission_segments::solveLambertProblemIzzoHouseholder(
+                     departurePosition, arrivalPosition, timeOfFlight, gravitationalParameter,
+                     velocityAtDeparture, velocityAtArrival, 5 ) );
+    BOOST_CHECK( velocityAtDeparture.hasNaN( ) );
+
+    // Solve batch of problems with varying time of flight (last one infeasible), serially and in parallel
+    const int numberOfProblems = 101;
+    Eigen::Matrix< double, Eigen::Dynamic, 3 > departurePositions( numberOfProblems, 3 );
+    Eigen::Matrix< double, Eigen::Dynamic, 3 > arrivalPositions( numberOfProblems, 3 );
+    Eigen::VectorXd timesOfFlight( numberOfProblems );
+    for( int i = 0; i < numberOfProblems; i++ )
+    {
+        departurePositions.row( i ) = departurePosition.transpose( );
+        arrivalPositions.row( i ) = arrivalPosition.transpose( );
+        timesOfFlight( i ) = timeOfFlight * ( 0.8 + 0.004 * i );
+    }
+    timesOfFlight( numberOfProblems - 1 ) = -timeOfFlight;
+
+    Eigen::Matrix< double, Eigen::Dynamic, 3 > serialVelocitiesAtDeparture, serialVelocitiesAtArrival;
+    Eigen::Matrix< double, Eigen::Dynamic, 3 > parallelVelocitiesAtDeparture, parallelVelocitiesAtArrival;
+    BOOST_CHECK_EQUAL( mission_segments::solveLambertProblemsIzzo(
+                           departurePositions, arrivalPositions, timesOfFlight,
+                           Eigen::VectorXd::Constant( 1, gravitationalParameter ),
+                           serialVelocitiesAtDeparture, serialVelocitiesAtArrival, 1, true ), 1 );
+    BOOST_CHECK_EQUAL( mission_segments::solveLambertProblemsIzzo(
+                           departurePositions, arrivalPositions, timesOfFlight,
+                           Eigen::VectorXd::Constant( numberOfProblems, gravitationalParameter ),
+                           parallelVelocitiesAtDeparture, parallelVelocitiesAtArrival, 1, true, false, 3 ), 1 );
+
+    for( int i = 0; i < numberOfProblems - 1; i++ )
+    {
+        mission_segments::solveLambertProblemIzzoHouseholder(
+                    departurePosition, arrivalPosition, timesOfFlight( i ), gravitationalParameter,
+                    velocityAtDeparture, velocityAtArrival, 1, true );
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_EQUAL( serialVelocitiesAtDeparture( i, j ), velocityAtDeparture( j ) );
+            BOOST_CHECK_EQUAL( serialVelocitiesAtArrival( i, j ), velocityAtArrival( j ) );
+            BOOST_CHECK_EQUAL( parallelVelocitiesAtDeparture( i, j ), velocityAtDeparture( j ) );
+            BOOST_CHECK_EQUAL( parallelVelocitiesAtArrival( i, j ), velocityAtArrival( j ) );
+        }
+    }
+    BOOST_CHECK( serialVelocitiesAtDeparture.row( numberOfProblems - 1 ).hasNaN( ) );
+    BOOST_CHECK( parallelVelocitiesAtArrival.row( numberOfProblems - 1 ).hasNaN( ) );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
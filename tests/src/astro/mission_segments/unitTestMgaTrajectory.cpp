@@ -39,6 +39,7 @@
 #include "tudat/astro/ephemerides/constantEphemeris.h"
 #include "tudat/astro/gravitation/gravityFieldModel.h"
 #include "tudat/astro/mission_segments/createTransferTrajectory.h"
+#include "tudat/astro/mission_segments/transferTrajectoryGridSearch.h"
 #include "tudat/simulation/environment_setup/body.h"
 #include "tudat/simulation/environment_setup/createBodies.h"
 #include "tudat/simulation/environment_setup/defaultBodies.h"
@@ -1487,6 +1488,189 @@ BOOST_AUTO_TEST_CASE( testMGA1DSMVFTrajectory2 )
 }
 
 
+
+//! Test parallel grid search over node times, with and without Delta V budget
+BOOST_AUTO_TEST_CASE( testTransferTrajectoryGridSearch )
+{
+    // Set transfer order and settings (Cassini 1 sequence, all unpowered)
+    std::vector< std::string > bodyOrder = {
+        "Earth", "Venus", "Venus", "Earth", "Jupiter", "Saturn" };
+    int numberOfNodes = bodyOrder.size( );
+
+    std::map< std::string, double > minimumPeriapses;
+    minimumPeriapses[ "Venus" ] = 6351800.0;
+    minimumPeriapses[ "Earth" ] = 6678000.0;
+    minimumPeriapses[ "Jupiter" ] =  600000000.0;
+    minimumPeriapses[ "Saturn" ] = 65000000.0;
+
+    std::vector< std::shared_ptr< TransferLegSettings > > transferLegSettings;
+    std::vector< std::shared_ptr< TransferNodeSettings > > transferNodeSettings;
+    getMgaTransferTrajectorySettingsWithoutDsm(
+                transferLegSettings, transferNodeSettings, bodyOrder,
+                std::make_pair( std::numeric_limits< double >::infinity( ), 0.0 ),
+                std::make_pair( 1.0895e8 / 0.02, 0.98 ),
+                minimumPeriapses );
+
+    // Create one trajectory (with its own bodies) per worker, and a separate trajectory for direct evaluation
+    int numberOfWorkers = 3;
+    std::vector< std::shared_ptr< TransferTrajectory > > workerTrajectories;
+    for( int i = 0; i < numberOfWorkers + 1; i++ )
+    {
+        workerTrajectories.push_back(
+                    createTransferTrajectory(
+                        createSimplifiedSystemOfBodies( ), transferLegSettings, transferNodeSettings, bodyOrder, "Sun" ) );
+    }
+    std::shared_ptr< TransferTrajectory > directTrajectory = workerTrajectories.back( );
+    workerTrajectories.pop_back( );
+
+    // Define grid around ideal Cassini 1 trajectory
+    double JD = physical_constants::JULIAN_DAY;
+    std::vector< double > departureTimes = { ( -789.8117 - 0.5 - 20.0 ) * JD, ( -789.8117 - 0.5 ) * JD,
+                                             ( -789.8117 - 0.5 + 20.0 ) * JD, ( -789.8117 - 0.5 + 40.0 ) * JD };
+    std::vector< std::vector< double > > timesOfFlight =
+    { { 158.302027105278 * JD, 178.302027105278 * JD },
+      { 449.385873819743 * JD, 409.385873819743 * JD },
+      { 54.7489684339665 * JD },
+      { 1024.36205846918 * JD, 1104.36205846918 * JD },
+      { 4552.30796805542 * JD, 4352.30796805542 * JD } };
+
+    std::vector< Eigen::VectorXd > transferLegFreeParameters( numberOfNodes - 1, Eigen::VectorXd( 0 ) );
+    std::vector< Eigen::VectorXd > transferNodeFreeParameters( numberOfNodes, Eigen::VectorXd( 0 ) );
+
+    // Compute Delta V directly at each grid point (in row-major order)
+    std::vector< std::vector< double > > gridNodeTimes;
+    std::vector< double > directDeltaV;
+    for( unsigned int i = 0; i < departureTimes.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < 16; j++ )
+        {
+            std::vector< double > nodeTimes = { departureTimes.at( i ) };
+            std::vector< int > timeOfFlightIndices = { ( j / 8 ) % 2, ( j / 4 ) % 2, 0, ( j / 2 ) % 2, j % 2 };
+            for( int k = 0; k < numberOfNodes - 1; k++ )
+            {
+                nodeTimes.push_back( nodeTimes.at( k ) + timesOfFlight.at( k ).at( timeOfFlightIndices.at( k ) ) );
+            }
+            gridNodeTimes.push_back( nodeTimes );
+
+            try
+            {
+                directTrajectory->evaluateTrajectory(
+                            nodeTimes, transferLegFreeParameters, transferNodeFreeParameters );
+                directDeltaV.push_back( directTrajectory->getTotalDeltaV( ) );
+            }
+            catch( const std::exception& )
+            {
+                directDeltaV.push_back( TUDAT_NAN );
+            }
+        }
+    }
+    BOOST_CHECK_CLOSE_FRACTION( directDeltaV.at( 16 ), 4930.72686847243, 1.0E-3 );
+
+    // Evaluate grid and batch, in parallel and serial, without budget
+    TransferTrajectoryGridSearch parallelGridSearch( workerTrajectories );
+    TransferTrajectoryGridSearch serialGridSearch( { workerTrajectories.at( 0 ) } );
+
+    std::vector< Eigen::VectorXd > computedDeltaV;
+    computedDeltaV.push_back( parallelGridSearch.evaluateTotalDeltaVOnGrid( departureTimes, timesOfFlight ) );
+    computedDeltaV.push_back( serialGridSearch.evaluateTotalDeltaVOnGrid( departureTimes, timesOfFlight ) );
+    computedDeltaV.push_back( parallelGridSearch.evaluateTotalDeltaV( gridNodeTimes ) );
+    BOOST_CHECK_EQUAL( parallelGridSearch.getNumberOfPrunedEvaluations( ), 0 );
+
+    for( unsigned int i = 0; i < computedDeltaV.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( computedDeltaV.at( i ).rows( ), static_cast< int >( directDeltaV.size( ) ) );
+        for( unsigned int j = 0; j < directDeltaV.size( ); j++ )
+        {
+            if( directDeltaV.at( j ) == directDeltaV.at( j ) )
+            {
+                BOOST_CHECK_EQUAL( computedDeltaV.at( i )( j ), directDeltaV.at( j ) );
+            }
+            else
+            {
+                BOOST_CHECK( computedDeltaV.at( i )( j ) != computedDeltaV.at( i )( j ) );
+            }
+        }
+    }
+
+    // Evaluate grid with budget, and check that only (and all) trajectories exceeding the budget are pruned
+    double deltaVBudget = 1.5 * directDeltaV.at( 16 );
+    Eigen::VectorXd parallelBudgetDeltaV = parallelGridSearch.evaluateTotalDeltaVOnGrid(
+                departureTimes, timesOfFlight, deltaVBudget );
+    Eigen::VectorXd serialBudgetDeltaV = serialGridSearch.evaluateTotalDeltaVOnGrid(
+                departureTimes, timesOfFlight, deltaVBudget );
+    BOOST_CHECK_EQUAL( parallelGridSearch.getNumberOfPrunedEvaluations( ),
+                       serialGridSearch.getNumberOfPrunedEvaluations( ) );
+
+    int numberOfExceedingTrajectories = 0;
+    for( unsigned int j = 0; j < directDeltaV.size( ); j++ )
+    {
+        for( unsigned int i = 0; i < 2; i++ )
+        {
+            double currentDeltaV = ( i == 0 ) ? parallelBudgetDeltaV( j ) : serialBudgetDeltaV( j );
+            if( directDeltaV.at( j ) > deltaVBudget )
+            {
+                BOOST_CHECK( std::isinf( currentDeltaV ) );
+            }
+            else if( directDeltaV.at( j ) == directDeltaV.at( j ) )
+            {
+                BOOST_CHECK_EQUAL( currentDeltaV, directDeltaV.at( j ) );
+            }
+            else
+            {
+                BOOST_CHECK( currentDeltaV != currentDeltaV || std::isinf( currentDeltaV ) );
+            }
+        }
+        if( directDeltaV.at( j ) > deltaVBudget )
+        {
+            numberOfExceedingTrajectories++;
+        }
+    }
+    BOOST_CHECK( numberOfExceedingTrajectories > 0 );
+    BOOST_CHECK( numberOfExceedingTrajectories < static_cast< int >( directDeltaV.size( ) ) );
+
+    // Evaluate grid with budget that is exceeded by all trajectories, and check that grid points are pruned
+    Eigen::VectorXd lowBudgetDeltaV = parallelGridSearch.evaluateTotalDeltaVOnGrid(
+                departureTimes, timesOfFlight, 1.0 );
+    for( unsigned int j = 0; j < directDeltaV.size( ); j++ )
+    {
+        BOOST_CHECK( std::isinf( lowBudgetDeltaV( j ) ) || directDeltaV.at( j ) != directDeltaV.at( j ) );
+    }
+    BOOST_CHECK( parallelGridSearch.getNumberOfPrunedEvaluations( ) > 0 );
+
+    // Check porkchop for single leg
+    std::vector< std::string > singleLegBodyOrder = { "Earth", "Venus" };
+    std::vector< std::shared_ptr< TransferLegSettings > > singleLegSettings;
+    std::vector< std::shared_ptr< TransferNodeSettings > > singleLegNodeSettings;
+    getMgaTransferTrajectorySettingsWithoutDsm(
+                singleLegSettings, singleLegNodeSettings, singleLegBodyOrder,
+                std::make_pair( std::numeric_limits< double >::infinity( ), 0.0 ),
+                std::make_pair( std::numeric_limits< double >::infinity( ), 0.0 ) );
+    std::vector< std::shared_ptr< TransferTrajectory > > singleLegTrajectories;
+    for( int i = 0; i < numberOfWorkers + 1; i++ )
+    {
+        singleLegTrajectories.push_back(
+                    createTransferTrajectory(
+                        createSimplifiedSystemOfBodies( ), singleLegSettings, singleLegNodeSettings,
+                        singleLegBodyOrder, "Sun" ) );
+    }
+    std::shared_ptr< TransferTrajectory > directSingleLegTrajectory = singleLegTrajectories.back( );
+    singleLegTrajectories.pop_back( );
+
+    std::vector< double > porkchopTimesOfFlight = { 120.0 * JD, 150.0 * JD, 180.0 * JD };
+    Eigen::MatrixXd porkchopDeltaV = TransferTrajectoryGridSearch( singleLegTrajectories ).computePorkchopDeltaV(
+                departureTimes, porkchopTimesOfFlight );
+    for( unsigned int i = 0; i < departureTimes.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < porkchopTimesOfFlight.size( ); j++ )
+        {
+            directSingleLegTrajectory->evaluateTrajectory(
+                        { departureTimes.at( i ), departureTimes.at( i ) + porkchopTimesOfFlight.at( j ) },
+                        { Eigen::VectorXd( 0 ) }, { Eigen::VectorXd( 0 ), Eigen::VectorXd( 0 ) } );
+            BOOST_CHECK_EQUAL( porkchopDeltaV( i, j ), directSingleLegTrajectory->getTotalDeltaV( ) );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
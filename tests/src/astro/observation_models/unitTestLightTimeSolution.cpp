@@ -233,6 +233,77 @@ BOOST_AUTO_TEST_CASE( testLightWithSpice )
                                 1E-14 );
 }
 
+//! Test warm start of light-time iteration from preceding solutions
+BOOST_AUTO_TEST_CASE( testLightTimeWarmStart )
+{
+    // Define state functions: transmitter on circular orbit, receiver in linear motion at large distance
+    std::function< Eigen::Vector6d( const double ) > transmitterStateFunction = [ ]( const double time )
+    {
+        double orbitalRate = 2.0E-7;
+        double orbitRadius = 1.5E11;
+        Eigen::Vector6d state;
+        state << orbitRadius * std::cos( orbitalRate * time ), orbitRadius * std::sin( orbitalRate * time ), 0.0,
+                -orbitRadius * orbitalRate * std::sin( orbitalRate * time ), orbitRadius * orbitalRate * std::cos( orbitalRate * time ), 0.0;
+        return state;
+    };
+    std::function< Eigen::Vector6d( const double ) > receiverStateFunction = [ ]( const double time )
+    {
+        Eigen::Vector6d state;
+        state << 4.0E11 + 1.0E4 * time, -2.0E11, 1.0E10, 1.0E4, 0.0, 0.0;
+        return state;
+    };
+
+    // Create light-time calculators with and without warm start, with a (time-dependent) light-time correction
+    std::vector< LightTimeCorrectionFunction > lightTimeCorrections;
+    lightTimeCorrections.push_back(
+                [ ]( const Eigen::Vector6d&, const Eigen::Vector6d&, const double transmissionTime, const double )
+    { return 1.0E-6 * std::sin( 1.0E-5 * transmissionTime ); } );
+
+    for( int iterateCorrections = 0; iterateCorrections < 2; iterateCorrections++ )
+    {
+        std::shared_ptr< LightTimeConvergenceCriteria > convergenceCriteria =
+                std::make_shared< LightTimeConvergenceCriteria >( iterateCorrections == 1 );
+        LightTimeCalculator< double, double > coldStartCalculator(
+                    transmitterStateFunction, receiverStateFunction, lightTimeCorrections, convergenceCriteria );
+        LightTimeCalculator< double, double > warmStartCalculator(
+                    transmitterStateFunction, receiverStateFunction, lightTimeCorrections, convergenceCriteria );
+        warmStartCalculator.setWarmStart( true, 60.0 );
+        BOOST_CHECK_EQUAL( warmStartCalculator.getUseWarmStart( ), true );
+
+        // Compute light times at 1 Hz, at reception and transmission time
+        for( int reception = 0; reception < 2; reception++ )
+        {
+            int numberOfColdStartIterations = 0;
+            int numberOfWarmStartIterations = 0;
+            for( int i = 0; i < 100; i++ )
+            {
+                double currentTime = 1.0E6 + static_cast< double >( i );
+                double coldStartLightTime = coldStartCalculator.calculateLightTime( currentTime, reception == 1 );
+                numberOfColdStartIterations += coldStartCalculator.getNumberOfIterationsOfLastSolution( );
+                double warmStartLightTime = warmStartCalculator.calculateLightTime( currentTime, reception == 1 );
+                numberOfWarmStartIterations += warmStartCalculator.getNumberOfIterationsOfLastSolution( );
+
+                // Check that the solution is unaffected, and that the number of iterations is reduced after two epochs
+                BOOST_CHECK_SMALL( std::fabs( coldStartLightTime - warmStartLightTime ),
+                                   10.0 * getDefaultLightTimeTolerance< double >( ) );
+                if( i > 1 )
+                {
+                    BOOST_CHECK_EQUAL( warmStartCalculator.getNumberOfIterationsOfLastSolution( ) <= 2, true );
+                    BOOST_CHECK_EQUAL( warmStartCalculator.getNumberOfIterationsOfLastSolution( ) <
+                                       coldStartCalculator.getNumberOfIterationsOfLastSolution( ), true );
+                }
+            }
+            BOOST_CHECK_EQUAL( numberOfWarmStartIterations < numberOfColdStartIterations, true );
+        }
+
+        // Check that prediction is not used beyond maximum time interval
+        warmStartCalculator.calculateLightTime( 2.0E6, true );
+        BOOST_CHECK_EQUAL( warmStartCalculator.getNumberOfIterationsOfLastSolution( ),
+                           ( coldStartCalculator.calculateLightTime( 2.0E6, true ),
+                             coldStartCalculator.getNumberOfIterationsOfLastSolution( ) ) );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,326 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <fstream>
+#include <limits>
+#include <string>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/simulation/estimation_setup/observationArchive.h"
+#include "tudat/simulation/estimation_setup/observations.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::observation_models;
+
+BOOST_AUTO_TEST_SUITE( test_observation_collection )
+
+BOOST_AUTO_TEST_CASE( testObservationCollectionIndexRanges )
+{
+    LinkEnds linkEnds1;
+    linkEnds1[ transmitter ] = LinkEndId( "Earth", "Station1" );
+    linkEnds1[ receiver ] = LinkEndId( "Spacecraft", "" );
+
+    LinkEnds linkEnds2;
+    linkEnds2[ transmitter ] = LinkEndId( "Earth", "Station2" );
+    linkEnds2[ receiver ] = LinkEndId( "Spacecraft", "" );
+
+    // Create range observation sets for two links, and an angular position observation set
+    std::vector< std::shared_ptr< SingleObservationSet< > > > observationSets;
+    std::vector< double > rangeTimes1, rangeTimes2, angularPositionTimes;
+    std::vector< Eigen::VectorXd > ranges1, ranges2, angularPositions;
+    for( int i = 0; i < 10; i++ )
+    {
+        rangeTimes1.push_back( 100.0 * static_cast< double >( i ) );
+        ranges1.push_back( Eigen::VectorXd::Constant( 1, static_cast< double >( i ) ) );
+        rangeTimes2.push_back( 50.0 + 100.0 * static_cast< double >( i ) );
+        ranges2.push_back( Eigen::VectorXd::Constant( 1, static_cast< double >( 100 + i ) ) );
+        angularPositionTimes.push_back( 1000.0 - 100.0 * static_cast< double >( i ) );
+        angularPositions.push_back( ( Eigen::VectorXd( 2 ) << static_cast< double >( i ), -static_cast< double >( i ) ).finished( ) );
+    }
+    observationSets.push_back( std::make_shared< SingleObservationSet< > >(
+                                   one_way_range, linkEnds1, ranges1, rangeTimes1, receiver ) );
+    observationSets.push_back( std::make_shared< SingleObservationSet< > >(
+                                   one_way_range, linkEnds2, ranges2, rangeTimes2, receiver ) );
+    observationSets.push_back( std::make_shared< SingleObservationSet< > >(
+                                   angular_position, linkEnds1, angularPositions, angularPositionTimes, receiver ) );
+
+    // Check contiguous storage of observations
+    BOOST_CHECK_EQUAL( observationSets.at( 2 )->getSingleObservableSize( ), 2 );
+    BOOST_CHECK_EQUAL( observationSets.at( 2 )->getObservationsVector( ).rows( ), 20 );
+    for( int i = 0; i < 10; i++ )
+    {
+        BOOST_CHECK_EQUAL( observationSets.at( 2 )->getObservationsVector( )( 2 * i ), static_cast< double >( i ) );
+        BOOST_CHECK_EQUAL( observationSets.at( 2 )->getObservationsVector( )( 2 * i + 1 ), -static_cast< double >( i ) );
+        BOOST_CHECK_EQUAL( observationSets.at( 2 )->getObservations( ).at( i )( 1 ), -static_cast< double >( i ) );
+    }
+
+    // Check creation from contiguous observations vector
+    std::shared_ptr< SingleObservationSet< > > vectorObservationSet = std::make_shared< SingleObservationSet< > >(
+                angular_position, linkEnds1, observationSets.at( 2 )->getObservationsVector( ), angularPositionTimes, receiver );
+    BOOST_CHECK_EQUAL( vectorObservationSet->getNumberOfObservables( ), 10 );
+    BOOST_CHECK_EQUAL( ( vectorObservationSet->getObservation( 3 ) - angularPositions.at( 3 ) ).norm( ), 0.0 );
+
+    bool exceptionThrown = false;
+    try
+    {
+        std::make_shared< SingleObservationSet< > >(
+                    angular_position, linkEnds1, ranges1.at( 0 ), angularPositionTimes, receiver );
+    }
+    catch( const std::runtime_error& )
+    {
+        exceptionThrown = true;
+    }
+    BOOST_CHECK_EQUAL( exceptionThrown, true );
+
+    // Create collection; range observations are stored first, each link contiguously (link ends are sorted)
+    std::shared_ptr< ObservationCollection< > > observationCollection =
+            std::make_shared< ObservationCollection< > >( observationSets );
+    BOOST_CHECK_EQUAL( observationCollection->getTotalObservableSize( ), 40 );
+
+    const Eigen::VectorXd& observationVector = observationCollection->getObservationVector( );
+    const std::vector< double >& times = observationCollection->getConcatenatedTimeVector( );
+    const std::vector< int >& linkEndIds = observationCollection->getConcatenatedLinkEndIds( );
+    BOOST_CHECK_EQUAL( &observationVector, &observationCollection->getObservationVector( ) );
+
+    // Check ranges per observable and per link
+    std::vector< std::pair< int, int > > rangeIndices = observationCollection->getObservationIndexRanges( one_way_range );
+    BOOST_CHECK_EQUAL( rangeIndices.size( ), 1 );
+    BOOST_CHECK_EQUAL( rangeIndices.at( 0 ).first, 0 );
+    BOOST_CHECK_EQUAL( rangeIndices.at( 0 ).second, 20 );
+
+    std::vector< std::pair< int, int > > secondLinkIndices =
+            observationCollection->getObservationIndexRanges( one_way_range, linkEnds2 );
+    BOOST_CHECK_EQUAL( secondLinkIndices.size( ), 1 );
+    BOOST_CHECK_EQUAL( secondLinkIndices.at( 0 ).second, 10 );
+    Eigen::VectorXd secondLinkRanges = observationVector.segment( secondLinkIndices.at( 0 ).first, secondLinkIndices.at( 0 ).second );
+    for( int i = 0; i < 10; i++ )
+    {
+        BOOST_CHECK_EQUAL( secondLinkRanges( i ), ranges2.at( i )( 0 ) );
+        BOOST_CHECK_EQUAL( times.at( secondLinkIndices.at( 0 ).first + i ), rangeTimes2.at( i ) );
+        BOOST_CHECK_EQUAL( linkEndIds.at( secondLinkIndices.at( 0 ).first + i ),
+                           observationCollection->getLinkEndIdentifierMap( ).at( linkEnds2 ) );
+    }
+    BOOST_CHECK_EQUAL( observationCollection->getObservationIndexRanges( n_way_range ).size( ), 0 );
+    BOOST_CHECK_EQUAL( observationCollection->getObservationIndexRanges( angular_position, linkEnds2 ).size( ), 0 );
+
+    std::vector< LinkEnds > linkEndNames = observationCollection->getConcatenatedLinkEndIdNames( );
+    BOOST_CHECK_EQUAL( linkEndNames.size( ), 40 );
+    BOOST_CHECK_EQUAL( linkEndNames.at( secondLinkIndices.at( 0 ).first ) == linkEnds2, true );
+
+    // Check ranges in time window, for all observations and for angular positions only
+    std::vector< std::pair< int, int > > windowIndices =
+            observationCollection->getObservationIndexRangesInTimeWindow( 240.0, 460.0 );
+    int numberOfEntriesInWindow = 0;
+    for( unsigned int i = 0; i < windowIndices.size( ); i++ )
+    {
+        for( int j = windowIndices.at( i ).first; j < windowIndices.at( i ).first + windowIndices.at( i ).second; j++ )
+        {
+            BOOST_CHECK_EQUAL( times.at( j ) >= 240.0 && times.at( j ) <= 460.0, true );
+            numberOfEntriesInWindow++;
+        }
+    }
+    int expectedNumberOfEntriesInWindow = 0;
+    for( unsigned int i = 0; i < times.size( ); i++ )
+    {
+        if( times.at( i ) >= 240.0 && times.at( i ) <= 460.0 )
+        {
+            expectedNumberOfEntriesInWindow++;
+        }
+    }
+    BOOST_CHECK_EQUAL( numberOfEntriesInWindow, expectedNumberOfEntriesInWindow );
+    BOOST_CHECK_EQUAL( numberOfEntriesInWindow, 9 );
+
+    std::vector< std::pair< int, int > > angularPositionWindowIndices =
+            observationCollection->getObservationIndexRangesInTimeWindow(
+                300.0, 500.0, observationCollection->getObservationIndexRanges( angular_position ) );
+    BOOST_CHECK_EQUAL( angularPositionWindowIndices.size( ), 1 );
+    BOOST_CHECK_EQUAL( angularPositionWindowIndices.at( 0 ).first, 20 + 2 * 5 );
+    BOOST_CHECK_EQUAL( angularPositionWindowIndices.at( 0 ).second, 6 );
+}
+
+BOOST_AUTO_TEST_CASE( testObservationArchive )
+{
+    LinkEnds linkEnds1;
+    linkEnds1[ transmitter ] = LinkEndId( "Earth", "Station1" );
+    linkEnds1[ receiver ] = LinkEndId( "Spacecraft", "" );
+
+    LinkEnds linkEnds2;
+    linkEnds2[ transmitter ] = LinkEndId( "Earth", "Station2" );
+    linkEnds2[ retransmitter ] = LinkEndId( "Spacecraft", "" );
+    linkEnds2[ receiver ] = LinkEndId( "Earth", "Station1" );
+
+    // Create range observation sets (second with unsorted times and dependent variables), and Doppler observation set
+    // with ancilliary settings
+    std::vector< Time > rangeTimes1, rangeTimes2, dopplerTimes;
+    std::vector< Eigen::Matrix< long double, Eigen::Dynamic, 1 > > ranges1, ranges2, dopplers;
+    std::vector< Eigen::VectorXd > dependentVariables2;
+    for( int i = 0; i < 10; i++ )
+    {
+        rangeTimes1.push_back( Time( 100000 + i, 0.123456789012345678L ) );
+        ranges1.push_back( Eigen::Matrix< long double, Eigen::Dynamic, 1 >::Constant( 1, 1.0E8 + i ) );
+        rangeTimes2.push_back( Time( 100000, 1000.0L - 100.0L * i ) );
+        ranges2.push_back( Eigen::Matrix< long double, Eigen::Dynamic, 1 >::Constant( 1, 2.0E8 + i ) );
+        dependentVariables2.push_back( ( Eigen::VectorXd( 2 ) << i, -i ).finished( ) );
+        dopplerTimes.push_back( Time( 100000, 50.0L * i ) );
+        dopplers.push_back( Eigen::Matrix< long double, Eigen::Dynamic, 1 >::Constant( 1, 1.0E-5 * i ) );
+    }
+
+    std::shared_ptr< ObservationAncilliarySimulationSettings< Time > > dopplerAncilliarySettings =
+            std::make_shared< ObservationAncilliarySimulationSettings< Time > >( );
+    dopplerAncilliarySettings->setAncilliaryDoubleData( doppler_integration_time, 60.0 );
+    dopplerAncilliarySettings->setAncilliaryDoubleVectorData( retransmission_delays, { 1.0E-6 } );
+
+    std::vector< std::shared_ptr< SingleObservationSet< long double, Time > > > observationSets;
+    observationSets.push_back( std::make_shared< SingleObservationSet< long double, Time > >(
+                                   one_way_range, linkEnds1, ranges1, rangeTimes1, receiver ) );
+    observationSets.push_back( std::make_shared< SingleObservationSet< long double, Time > >(
+                                   n_way_range, linkEnds2, ranges2, rangeTimes2, receiver, dependentVariables2 ) );
+    std::vector< std::shared_ptr< SingleObservationSet< long double, Time > > > appendedObservationSets;
+    appendedObservationSets.push_back( std::make_shared< SingleObservationSet< long double, Time > >(
+                                           two_way_doppler, linkEnds2, dopplers, dopplerTimes, receiver,
+                                           std::vector< Eigen::VectorXd >( ), nullptr, dopplerAncilliarySettings ) );
+
+    // Write archive in two steps
+    std::string archiveFile =
+            ( boost::filesystem::temp_directory_path( ) /
+              boost::filesystem::unique_path( "tudat_observation_archive_%%%%-%%%%.bin" ) ).string( );
+    writeObservationCollectionToArchive(
+                std::make_shared< ObservationCollection< long double, Time > >( observationSets ), archiveFile );
+    writeObservationCollectionToArchive(
+                std::make_shared< ObservationCollection< long double, Time > >( appendedObservationSets ), archiveFile, true );
+
+    {
+        ObservationArchiveReader archiveReader( archiveFile );
+        BOOST_CHECK_EQUAL( archiveReader.getVersion( ), OBSERVATION_ARCHIVE_VERSION );
+        BOOST_CHECK_EQUAL( archiveReader.getRecords( ).size( ), 3 );
+    }
+
+    // Load full archive, and compare to original observations
+    std::shared_ptr< ObservationCollection< long double, Time > > loadedCollection =
+            loadObservationCollectionFromArchive< long double, Time >( archiveFile );
+    observationSets.push_back( appendedObservationSets.at( 0 ) );
+    for( unsigned int i = 0; i < observationSets.size( ); i++ )
+    {
+        std::shared_ptr< SingleObservationSet< long double, Time > > originalSet = observationSets.at( i );
+        std::shared_ptr< SingleObservationSet< long double, Time > > loadedSet =
+                loadedCollection->getObservations( ).at( originalSet->getObservableType( ) ).at(
+                    originalSet->getLinkEnds( ).linkEnds_ ).at( 0 );
+
+        BOOST_CHECK_EQUAL( loadedSet->getReferenceLinkEnd( ), originalSet->getReferenceLinkEnd( ) );
+        BOOST_CHECK_EQUAL( loadedSet->getNumberOfObservables( ), originalSet->getNumberOfObservables( ) );
+        for( int j = 0; j < originalSet->getNumberOfObservables( ); j++ )
+        {
+            BOOST_CHECK_EQUAL( loadedSet->getObservationTimes( ).at( j ).getFullPeriods( ),
+                               originalSet->getObservationTimes( ).at( j ).getFullPeriods( ) );
+            BOOST_CHECK_SMALL( static_cast< double >(
+                                   loadedSet->getObservationTimes( ).at( j ).getSecondsIntoFullPeriod( ) -
+                                   originalSet->getObservationTimes( ).at( j ).getSecondsIntoFullPeriod( ) ), 1.0E-15 );
+            BOOST_CHECK_EQUAL( static_cast< double >( loadedSet->getObservation( j )( 0 ) ),
+                               static_cast< double >( originalSet->getObservation( j )( 0 ) ) );
+        }
+        BOOST_CHECK_EQUAL( loadedSet->getObservationsDependentVariables( ).size( ),
+                           originalSet->getObservationsDependentVariables( ).size( ) );
+        for( unsigned int j = 0; j < originalSet->getObservationsDependentVariables( ).size( ); j++ )
+        {
+            BOOST_CHECK_EQUAL( ( loadedSet->getObservationsDependentVariables( ).at( j ) -
+                                 originalSet->getObservationsDependentVariables( ).at( j ) ).norm( ), 0.0 );
+        }
+    }
+
+    std::shared_ptr< ObservationAncilliarySimulationSettings< Time > > loadedAncilliarySettings =
+            loadedCollection->getObservations( ).at( two_way_doppler ).at( linkEnds2 ).at( 0 )->getAncilliarySettings( );
+    BOOST_CHECK_EQUAL( loadedAncilliarySettings->getAncilliaryDoubleData( doppler_integration_time ), 60.0 );
+    BOOST_CHECK_EQUAL( loadedAncilliarySettings->getAncilliaryDoubleVectorData( retransmission_delays ).size( ), 1 );
+    BOOST_CHECK_EQUAL( loadedAncilliarySettings->getAncilliaryDoubleVectorData( retransmission_delays ).at( 0 ), 1.0E-6 );
+    BOOST_CHECK_EQUAL( loadedCollection->getObservations( ).at( one_way_range ).at( linkEnds1 ).at( 0 )->getAncilliarySettings( ),
+                       nullptr );
+
+    // Load observations in time window, for sorted and unsorted records
+    Time startTime = Time( 100000, 250.0L ), endTime = Time( 100003, 0.2L );
+    std::shared_ptr< ObservationCollection< long double, Time > > windowCollection =
+            loadObservationCollectionFromArchive< long double, Time >( archiveFile, startTime, endTime );
+    BOOST_CHECK_EQUAL( windowCollection->getObservations( ).at( one_way_range ).at( linkEnds1 ).at( 0 )->getNumberOfObservables( ), 3 );
+    BOOST_CHECK_EQUAL( windowCollection->getObservations( ).at( n_way_range ).at( linkEnds2 ).at( 0 )->getNumberOfObservables( ), 8 );
+    BOOST_CHECK_EQUAL( windowCollection->getObservations( ).at( two_way_doppler ).at( linkEnds2 ).at( 0 )->getNumberOfObservables( ), 5 );
+    for( auto observableIterator : windowCollection->getObservations( ) )
+    {
+        for( auto linkEndIterator : observableIterator.second )
+        {
+            for( unsigned int i = 0; i < linkEndIterator.second.size( ); i++ )
+            {
+                for( Time currentTime : linkEndIterator.second.at( i )->getObservationTimes( ) )
+                {
+                    BOOST_CHECK_EQUAL( ( currentTime < startTime ), false );
+                    BOOST_CHECK_EQUAL( ( endTime < currentTime ), false );
+                }
+            }
+        }
+    }
+
+    // Load observations of single link and observable
+    std::shared_ptr< ObservationCollection< long double, Time > > linkCollection =
+            loadObservationCollectionFromArchive< long double, Time >( archiveFile, { linkEnds2 }, { two_way_doppler } );
+    BOOST_CHECK_EQUAL( linkCollection->getObservations( ).size( ), 1 );
+    BOOST_CHECK_EQUAL( linkCollection->getTotalObservableSize( ), 10 );
+
+    // Check that non-archive files are rejected
+    {
+        std::ofstream invalidFile( archiveFile, std::ios::binary | std::ios::trunc );
+        invalidFile << "Not an observation archive";
+    }
+    BOOST_CHECK_THROW( ObservationArchiveReader archiveReader( archiveFile ), std::runtime_error );
+
+    // Write archive incrementally, and check that it is identical to archive written in one step
+    std::string incrementalArchiveFile =
+            ( boost::filesystem::temp_directory_path( ) /
+              boost::filesystem::unique_path( "tudat_observation_archive_%%%%-%%%%.bin" ) ).string( );
+    writeObservationCollectionToArchive(
+                std::make_shared< ObservationCollection< long double, Time > >( observationSets ), archiveFile );
+    {
+        ObservationArchiveWriter archiveWriter( incrementalArchiveFile );
+        for( unsigned int i = 0; i < observationSets.size( ); i++ )
+        {
+            archiveWriter.writeObservationSet( observationSets.at( i ) );
+            BOOST_CHECK_EQUAL( archiveWriter.getNumberOfWrittenRecords( ), i + 1 );
+
+            // Check that records written so far can be read while archive is still open
+            ObservationArchiveReader archiveReader( incrementalArchiveFile );
+            BOOST_CHECK_EQUAL( archiveReader.getRecords( ).size( ), i + 1 );
+        }
+        BOOST_CHECK_EQUAL( archiveWriter.getNumberOfWrittenObservations( ), 30 );
+    }
+
+    std::ifstream fullArchiveStream( archiveFile, std::ios::binary );
+    std::ifstream incrementalArchiveStream( incrementalArchiveFile, std::ios::binary );
+    std::string fullArchiveContents( ( std::istreambuf_iterator< char >( fullArchiveStream ) ),
+                                     std::istreambuf_iterator< char >( ) );
+    std::string incrementalArchiveContents( ( std::istreambuf_iterator< char >( incrementalArchiveStream ) ),
+                                            std::istreambuf_iterator< char >( ) );
+    BOOST_CHECK_EQUAL( fullArchiveContents.size( ), incrementalArchiveContents.size( ) );
+    BOOST_CHECK( fullArchiveContents == incrementalArchiveContents );
+
+    boost::filesystem::remove( archiveFile );
+    boost::filesystem::remove( incrementalArchiveFile );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}
+
+}
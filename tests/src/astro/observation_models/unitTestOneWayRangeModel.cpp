@@ -252,6 +252,87 @@ BOOST_AUTO_TEST_CASE( testOneWayRangeModel )
 
 }
 
+//! Test whether the one-way range observations at a list of times are consistent with those computed one by one
+BOOST_AUTO_TEST_CASE( testOneWayRangeModelAtTimes )
+{
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Create bodies
+    std::vector< std::string > bodiesToCreate = { "Earth", "Sun", "Mars" };
+    SystemOfBodies bodies = createSystemOfBodies( getDefaultBodySettings( bodiesToCreate ) );
+
+    // Define link ends for observations.
+    LinkEnds linkEnds;
+    linkEnds[ transmitter ] = std::make_pair< std::string, std::string >( "Earth" , ""  );
+    linkEnds[ receiver ] = std::make_pair< std::string, std::string >( "Mars" , ""  );
+
+    // Create observation model, with light-time correction and bias
+    std::vector< std::shared_ptr< LightTimeCorrectionSettings > > lightTimeCorrectionSettings;
+    lightTimeCorrectionSettings.push_back( std::make_shared< FirstOrderRelativisticLightTimeCorrectionSettings >(
+                                               std::vector< std::string >( { "Sun" } ) ) );
+    std::shared_ptr< ObservationModelSettings > observableSettings = std::make_shared< ObservationModelSettings >
+            ( one_way_range, linkEnds, lightTimeCorrectionSettings,
+              std::make_shared< ConstantObservationBiasSettings >(
+                  ( Eigen::Matrix< double, 1, 1 >( ) << 2.56294 ).finished( ), true ) );
+    std::shared_ptr< ObservationModel< 1, double, double > > observationModel =
+            ObservationModelCreator< 1, double, double >::createObservationModel(
+                observableSettings, bodies );
+    std::shared_ptr< LightTimeCalculator< double, double > > lightTimeCalculator =
+            std::dynamic_pointer_cast< OneWayRangeObservationModel< double, double > >(
+                observationModel )->getLightTimeCalculator( );
+
+    // Define observation times
+    std::vector< double > observationTimes;
+    for( int i = 0; i < 50; i++ )
+    {
+        observationTimes.push_back( 3.0 * 86400.0 + static_cast< double >( i ) * 60.0 );
+    }
+
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        LinkEndType referenceLinkEnd = ( test == 0 ) ? receiver : transmitter;
+
+        // Compute observations at all times at once
+        Eigen::Matrix< double, 1, Eigen::Dynamic > observations;
+        Eigen::MatrixXd linkEndTimes, linkEndStates;
+        observationModel->computeObservationsWithLinkEndDataAtTimes(
+                    observationTimes, referenceLinkEnd, observations, linkEndTimes, linkEndStates );
+        BOOST_CHECK_EQUAL( observations.cols( ), observationTimes.size( ) );
+        BOOST_CHECK_EQUAL( linkEndTimes.rows( ), 2 );
+        BOOST_CHECK_EQUAL( linkEndStates.rows( ), 12 );
+
+        // Check that warm start of light-time calculator is only used inside batch computation
+        BOOST_CHECK_EQUAL( lightTimeCalculator->getUseWarmStart( ), false );
+
+        // Compare against observations computed one by one
+        std::vector< double > currentLinkEndTimes;
+        std::vector< Eigen::Vector6d > currentLinkEndStates;
+        for( unsigned int i = 0; i < observationTimes.size( ); i++ )
+        {
+            double currentObservation = observationModel->computeObservationsWithLinkEndData(
+                        observationTimes.at( i ), referenceLinkEnd, currentLinkEndTimes, currentLinkEndStates )( 0 );
+            BOOST_CHECK_SMALL( observations( 0, i ) - currentObservation, 1.0E-3 );
+
+            for( unsigned int j = 0; j < 2; j++ )
+            {
+                BOOST_CHECK_SMALL( linkEndTimes( j, i ) - currentLinkEndTimes.at( j ), 1.0E-11 );
+                for( unsigned int k = 0; k < 3; k++ )
+                {
+                    BOOST_CHECK_SMALL( linkEndStates( 6 * j + k, i ) - currentLinkEndStates.at( j )( k ), 1.0E-3 );
+                    BOOST_CHECK_SMALL( linkEndStates( 6 * j + k + 3, i ) - currentLinkEndStates.at( j )( k + 3 ), 1.0E-9 );
+                }
+            }
+        }
+    }
+
+    // Check empty list of times
+    Eigen::Matrix< double, 1, Eigen::Dynamic > observations;
+    Eigen::MatrixXd linkEndTimes, linkEndStates;
+    observationModel->computeObservationsWithLinkEndDataAtTimes(
+                std::vector< double >( ), receiver, observations, linkEndTimes, linkEndStates );
+    BOOST_CHECK_EQUAL( observations.cols( ), 0 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
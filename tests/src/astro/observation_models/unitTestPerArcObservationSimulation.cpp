@@ -334,6 +334,341 @@ BOOST_AUTO_TEST_CASE( testObservationNoiseModels )
 }
 
 
+//! Create bodies for the parallel observation simulation test
+SystemOfBodies createParallelObservationTestBodies( )
+{
+    double initialEphemerisTime = double( 1.0E7 );
+
+    BodyListSettings bodySettings =
+            getDefaultBodySettings( { "Earth", "Moon", "Sun" } );
+    bodySettings.at( "Earth" )->rotationModelSettings = std::make_shared< SimpleRotationModelSettings >(
+                "ECLIPJ2000", "IAU_Earth",
+                spice_interface::computeRotationQuaternionBetweenFrames(
+                    "ECLIPJ2000", "IAU_Earth", initialEphemerisTime ),
+                initialEphemerisTime, 2.0 * mathematical_constants::PI /
+                ( physical_constants::JULIAN_DAY ) );
+
+    Eigen::Vector6d spacecraftOrbitalElements;
+    spacecraftOrbitalElements( semiMajorAxisIndex ) = 2000.0E3;
+    spacecraftOrbitalElements( eccentricityIndex ) = 0.05;
+    spacecraftOrbitalElements( inclinationIndex ) = 1.5;
+    spacecraftOrbitalElements( argumentOfPeriapsisIndex ) = 0.0;
+    spacecraftOrbitalElements( longitudeOfAscendingNodeIndex ) = 0.0;
+    spacecraftOrbitalElements( trueAnomalyIndex ) = 0.0;
+    bodySettings.addSettings( "LunarOrbiter" );
+    bodySettings.at( "LunarOrbiter" )->ephemerisSettings =
+            keplerEphemerisSettings( spacecraftOrbitalElements, 0.0, getBodyGravitationalParameter( "Moon" ), "Moon" );
+
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+
+    createGroundStation( bodies.at( "Earth" ), "Station1", ( Eigen::Vector3d( ) << 0.0, 0.35, 0.0 ).finished( ), geodetic_position );
+    createGroundStation( bodies.at( "Earth" ), "Station2", ( Eigen::Vector3d( ) << 0.0, -0.55, 2.0 ).finished( ), geodetic_position );
+
+    return bodies;
+}
+
+//! Test whether observations simulated in parallel are identical to those simulated in a single thread
+BOOST_AUTO_TEST_CASE( testParallelObservationSimulation )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Create bodies for serial simulation, and for each of the workers
+    int numberOfWorkers = 3;
+    SystemOfBodies bodies = createParallelObservationTestBodies( );
+    std::vector< SystemOfBodies > workerBodies;
+    for( int i = 0; i < numberOfWorkers; i++ )
+    {
+        workerBodies.push_back( createParallelObservationTestBodies( ) );
+    }
+
+    // Define link ends and observation models
+    std::vector< LinkEnds > linkEndsList( 2 );
+    linkEndsList[ 0 ][ transmitter ] = std::make_pair< std::string, std::string >( "Earth", "Station1" );
+    linkEndsList[ 0 ][ receiver ] = std::make_pair< std::string, std::string >( "LunarOrbiter", "" );
+    linkEndsList[ 1 ][ transmitter ] = std::make_pair< std::string, std::string >( "Earth", "Station2" );
+    linkEndsList[ 1 ][ receiver ] = std::make_pair< std::string, std::string >( "LunarOrbiter", "" );
+
+    std::vector< std::shared_ptr< ObservationModelSettings > > observationSettingsList;
+    for( unsigned int i = 0; i < linkEndsList.size( ); i++ )
+    {
+        observationSettingsList.push_back( std::make_shared< ObservationModelSettings >( one_way_range, linkEndsList.at( i ) ) );
+        observationSettingsList.push_back( std::make_shared< ObservationModelSettings >( angular_position, linkEndsList.at( i ) ) );
+    }
+
+    // Create observation simulators from each set of bodies
+    std::vector< std::shared_ptr< ObservationSimulatorBase< double, double > > >  observationSimulators =
+            createObservationSimulators( observationSettingsList, bodies );
+    std::vector< std::vector< std::shared_ptr< ObservationSimulatorBase< double, double > > > > workerObservationSimulators;
+    for( int i = 0; i < numberOfWorkers; i++ )
+    {
+        workerObservationSimulators.push_back( createObservationSimulators( observationSettingsList, workerBodies.at( i ) ) );
+    }
+
+    // Define tabulated and per-arc observation simulation settings
+    double startTime = physical_constants::JULIAN_YEAR;
+    std::vector< double > observationTimes;
+    for( int i = 0; i < 2000; i++ )
+    {
+        observationTimes.push_back( startTime + static_cast< double >( i ) * 120.0 );
+    }
+
+    std::vector< std::shared_ptr< ObservationSimulationSettings< double > > > measurementSimulationInput;
+    for( unsigned int i = 0; i < linkEndsList.size( ); i++ )
+    {
+        std::vector< std::shared_ptr< observation_models::ObservationViabilitySettings > > viabilitySettings =
+        { elevationAngleViabilitySettings( linkEndsList.at( i ).at( transmitter ).getDualStringLinkEnd( ), 0.0 ) };
+        measurementSimulationInput.push_back(
+                    std::make_shared< TabulatedObservationSimulationSettings< > >(
+                        one_way_range, linkEndsList.at( i ), observationTimes, receiver, viabilitySettings ) );
+        measurementSimulationInput.push_back(
+                    std::make_shared< TabulatedObservationSimulationSettings< > >(
+                        angular_position, linkEndsList.at( i ), observationTimes, receiver, viabilitySettings ) );
+        measurementSimulationInput.push_back(
+                    std::make_shared< PerArcObservationSimulationSettings< double > >(
+                        one_way_range, linkEndsList.at( i ), startTime, startTime + 3.0 * physical_constants::JULIAN_DAY, 60.0,
+                        viabilitySettings.at( 0 ) ) );
+    }
+
+    for( int test = 0; test < 2; test++ )
+    {
+        // Add noise with identical random number sequence to both simulations
+        std::vector< std::shared_ptr< ObservationCollection< > > > simulatedObservations;
+        for( int parallelSimulation = 0; parallelSimulation < 2; parallelSimulation++ )
+        {
+            if( test == 1 )
+            {
+                std::function< double( ) > inputFreeNoiseFunction = createBoostContinuousRandomVariableGeneratorFunction(
+                            normal_boost_distribution, { 0.0, 1.0 }, 0.0 );
+                std::function< double( const double ) > noiseFunction =
+                        std::bind( &utilities::evaluateFunctionWithoutInputArgumentDependency< double, const double >,
+                                   inputFreeNoiseFunction, std::placeholders::_1 );
+                addNoiseFunctionToObservationSimulationSettings( measurementSimulationInput, noiseFunction );
+            }
+
+            if( parallelSimulation == 0 )
+            {
+                simulatedObservations.push_back( simulateObservations< double, double >(
+                                                     measurementSimulationInput, observationSimulators, bodies ) );
+            }
+            else
+            {
+                simulatedObservations.push_back( simulateObservationsInParallel< double, double >(
+                                                     measurementSimulationInput, workerObservationSimulators, workerBodies, 250 ) );
+            }
+        }
+
+        // Check that results are identical
+        std::vector< double > serialTimes = simulatedObservations.at( 0 )->getConcatenatedTimeVector( );
+        std::vector< double > parallelTimes = simulatedObservations.at( 1 )->getConcatenatedTimeVector( );
+        Eigen::VectorXd serialObservations = simulatedObservations.at( 0 )->getObservationVector( );
+        Eigen::VectorXd parallelObservations = simulatedObservations.at( 1 )->getObservationVector( );
+
+        BOOST_CHECK_EQUAL( serialTimes.size( ) > 0, true );
+        BOOST_CHECK_EQUAL( serialTimes.size( ), parallelTimes.size( ) );
+        BOOST_CHECK_EQUAL( serialObservations.rows( ), parallelObservations.rows( ) );
+        for( unsigned int i = 0; i < serialTimes.size( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( serialTimes.at( i ), parallelTimes.at( i ) );
+        }
+        for( int i = 0; i < serialObservations.rows( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( serialObservations( i ), parallelObservations( i ) );
+        }
+    }
+
+    // Check that bodies shared between workers are rejected
+    std::vector< SystemOfBodies > sharedWorkerBodies = { bodies, bodies };
+    std::vector< std::vector< std::shared_ptr< ObservationSimulatorBase< double, double > > > > sharedWorkerObservationSimulators =
+    { observationSimulators, observationSimulators };
+    BOOST_CHECK_THROW( simulateObservationsInParallel(
+                           measurementSimulationInput, sharedWorkerObservationSimulators, sharedWorkerBodies ),
+                       std::runtime_error );
+}
+
+//! Test whether pre-screening of observation times using geometric viability windows leaves simulated observations unchanged
+BOOST_AUTO_TEST_CASE( testGeometricViabilityPrescreening )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    SystemOfBodies bodies = createParallelObservationTestBodies( );
+
+    // Define link ends and observation models
+    LinkEnds linkEnds;
+    linkEnds[ transmitter ] = std::make_pair< std::string, std::string >( "Earth", "Station1" );
+    linkEnds[ receiver ] = std::make_pair< std::string, std::string >( "LunarOrbiter", "" );
+
+    std::vector< std::shared_ptr< ObservationModelSettings > > observationSettingsList;
+    observationSettingsList.push_back( std::make_shared< ObservationModelSettings >( one_way_range, linkEnds ) );
+    observationSettingsList.push_back( std::make_shared< ObservationModelSettings >( angular_position, linkEnds ) );
+    std::vector< std::shared_ptr< ObservationSimulatorBase< double, double > > >  observationSimulators =
+            createObservationSimulators( observationSettingsList, bodies );
+
+    // Define observation times, with elevation angle and lunar occultation constraints
+    double startTime = physical_constants::JULIAN_YEAR;
+    std::vector< double > observationTimes;
+    for( int i = 0; i < 5000; i++ )
+    {
+        observationTimes.push_back( startTime + static_cast< double >( i ) * 60.0 );
+    }
+    std::vector< std::shared_ptr< observation_models::ObservationViabilitySettings > > viabilitySettings =
+    { elevationAngleViabilitySettings( linkEnds.at( transmitter ).getDualStringLinkEnd( ), 15.0 * mathematical_constants::PI / 180.0 ),
+      bodyOccultationViabilitySettings( linkEnds.at( receiver ).getDualStringLinkEnd( ), "Moon" ) };
+
+    std::vector< std::vector< std::shared_ptr< ObservationSimulationSettings< double > > > > measurementSimulationInput( 2 );
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        measurementSimulationInput[ i ].push_back(
+                    std::make_shared< TabulatedObservationSimulationSettings< > >(
+                        one_way_range, linkEnds, observationTimes, receiver, viabilitySettings ) );
+        measurementSimulationInput[ i ].push_back(
+                    std::make_shared< TabulatedObservationSimulationSettings< > >(
+                        angular_position, linkEnds, observationTimes, transmitter, viabilitySettings ) );
+    }
+
+    // Pre-screen observation times of second set of settings
+    prescreenObservationSimulationTimes( measurementSimulationInput[ 1 ], bodies, 600.0, 0.1 );
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        std::vector< double > prescreenedTimes = std::dynamic_pointer_cast< TabulatedObservationSimulationSettings< > >(
+                    measurementSimulationInput[ 1 ].at( i ) )->simulationTimes_;
+        BOOST_CHECK_EQUAL( prescreenedTimes.size( ) > 0, true );
+        BOOST_CHECK_EQUAL( prescreenedTimes.size( ) < observationTimes.size( ), true );
+    }
+
+    // Check that simulated observations are identical
+    std::shared_ptr< ObservationCollection< > > fullObservations = simulateObservations< double, double >(
+                measurementSimulationInput[ 0 ], observationSimulators, bodies );
+    std::shared_ptr< ObservationCollection< > > prescreenedObservations = simulateObservations< double, double >(
+                measurementSimulationInput[ 1 ], observationSimulators, bodies );
+
+    std::vector< double > fullTimes = fullObservations->getConcatenatedTimeVector( );
+    std::vector< double > prescreenedObservationTimes = prescreenedObservations->getConcatenatedTimeVector( );
+    Eigen::VectorXd fullObservationVector = fullObservations->getObservationVector( );
+    Eigen::VectorXd prescreenedObservationVector = prescreenedObservations->getObservationVector( );
+
+    BOOST_CHECK_EQUAL( fullTimes.size( ) > 0, true );
+    BOOST_CHECK_EQUAL( fullTimes.size( ), prescreenedObservationTimes.size( ) );
+    BOOST_CHECK_EQUAL( fullObservationVector.rows( ), prescreenedObservationVector.rows( ) );
+    for( unsigned int i = 0; i < fullTimes.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( fullTimes.at( i ), prescreenedObservationTimes.at( i ) );
+    }
+    // Light-time solutions may differ to within their convergence tolerance, due to the warm-started iterations
+    for( int i = 0; i < fullObservationVector.rows( ); i++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( fullObservationVector( i ) - prescreenedObservationVector( i ) ), 1.0E-3 );
+    }
+
+    // Check retrieval of times in windows
+    std::vector< std::pair< double, double > > windows = { { 1.0, 2.0 }, { 4.0, 6.0 } };
+    std::vector< double > testTimes = { 0.0, 1.0, 1.5, 3.0, 5.0, 6.0, 7.0 };
+    std::vector< double > timesInWindows = getObservationTimesInWindows( testTimes, windows );
+    std::vector< double > expectedTimesInWindows = { 1.0, 1.5, 5.0, 6.0 };
+    BOOST_CHECK_EQUAL( timesInWindows.size( ), expectedTimesInWindows.size( ) );
+    for( unsigned int i = 0; i < timesInWindows.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( timesInWindows.at( i ), expectedTimesInWindows.at( i ) );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testSharedLightTimeCalculators )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    SystemOfBodies bodies = createParallelObservationTestBodies( );
+
+    // Define link ends and observation models for range, Doppler and angular position of the same link
+    LinkEnds linkEnds;
+    linkEnds[ transmitter ] = std::make_pair< std::string, std::string >( "Earth", "Station1" );
+    linkEnds[ receiver ] = std::make_pair< std::string, std::string >( "LunarOrbiter", "" );
+
+    std::vector< std::shared_ptr< ObservationModelSettings > > observationSettingsList;
+    observationSettingsList.push_back( std::make_shared< ObservationModelSettings >( one_way_range, linkEnds ) );
+    observationSettingsList.push_back( std::make_shared< ObservationModelSettings >( one_way_doppler, linkEnds ) );
+    observationSettingsList.push_back( std::make_shared< ObservationModelSettings >( angular_position, linkEnds ) );
+    std::vector< std::shared_ptr< ObservationSimulatorBase< double, double > > > observationSimulators =
+            createObservationSimulators( observationSettingsList, bodies );
+
+    // Create observation simulators with separate light-time calculators
+    std::vector< std::shared_ptr< ObservationSimulatorBase< double, double > > > separateObservationSimulators;
+    for( unsigned int i = 0; i < observationSettingsList.size( ); i++ )
+    {
+        separateObservationSimulators.push_back(
+                    createObservationSimulators( { observationSettingsList.at( i ) }, bodies ).at( 0 ) );
+    }
+
+    // Check that a single light-time calculator is shared by all observation models
+    std::shared_ptr< OneWayRangeObservationModel< > > rangeModel =
+            std::dynamic_pointer_cast< OneWayRangeObservationModel< > >(
+                getObservationSimulatorOfType< 1 >( observationSimulators, one_way_range )->getObservationModel( linkEnds ) );
+    std::shared_ptr< OneWayDopplerObservationModel< > > dopplerModel =
+            std::dynamic_pointer_cast< OneWayDopplerObservationModel< > >(
+                getObservationSimulatorOfType< 1 >( observationSimulators, one_way_doppler )->getObservationModel( linkEnds ) );
+    std::shared_ptr< AngularPositionObservationModel< > > angularPositionModel =
+            std::dynamic_pointer_cast< AngularPositionObservationModel< > >(
+                getObservationSimulatorOfType< 2 >( observationSimulators, angular_position )->getObservationModel( linkEnds ) );
+    std::shared_ptr< LightTimeCalculator< > > lightTimeCalculator = rangeModel->getLightTimeCalculator( );
+
+    BOOST_CHECK_EQUAL( dopplerModel->getLightTimeCalculator( ) == lightTimeCalculator, true );
+    BOOST_CHECK_EQUAL( angularPositionModel->getLightTimeCalculator( ) == lightTimeCalculator, true );
+    for( unsigned int i = 0; i < observationSimulators.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( observationSimulators.at( i )->getSharedLightTimeCalculators( ).size( ), 1 );
+    }
+
+    // Check that cached solutions are reused by other observables at the same epoch
+    double startTime = physical_constants::JULIAN_YEAR;
+    setLightTimeSolutionCaching( observationSimulators, true );
+    BOOST_CHECK_EQUAL( lightTimeCalculator->getUseSolutionCaching( ), true );
+
+    double range = rangeModel->computeObservations( startTime, receiver )( 0 );
+    BOOST_CHECK_EQUAL( lightTimeCalculator->getNumberOfCachedSolutions( ), 1 );
+    BOOST_CHECK_EQUAL( lightTimeCalculator->getNumberOfIterationsOfLastSolution( ) > 0, true );
+
+    angularPositionModel->computeObservations( startTime, receiver );
+    dopplerModel->computeObservations( startTime, receiver );
+    BOOST_CHECK_EQUAL( lightTimeCalculator->getNumberOfCachedSolutions( ), 1 );
+    BOOST_CHECK_EQUAL( lightTimeCalculator->getNumberOfIterationsOfLastSolution( ), 0 );
+    BOOST_CHECK_EQUAL( rangeModel->computeObservations( startTime, receiver )( 0 ), range );
+
+    setLightTimeSolutionCaching( observationSimulators, false );
+    BOOST_CHECK_EQUAL( lightTimeCalculator->getUseSolutionCaching( ), false );
+    BOOST_CHECK_EQUAL( lightTimeCalculator->getNumberOfCachedSolutions( ), 0 );
+
+    // Check that observations simulated with shared and separate light-time calculators are equal
+    std::vector< double > observationTimes;
+    for( int i = 0; i < 1000; i++ )
+    {
+        observationTimes.push_back( startTime + static_cast< double >( i ) * 60.0 );
+    }
+    std::vector< std::shared_ptr< ObservationSimulationSettings< double > > > measurementSimulationInput;
+    for( unsigned int i = 0; i < observationSettingsList.size( ); i++ )
+    {
+        measurementSimulationInput.push_back(
+                    std::make_shared< TabulatedObservationSimulationSettings< > >(
+                        observationSettingsList.at( i )->observableType_, linkEnds, observationTimes, receiver ) );
+    }
+
+    std::shared_ptr< ObservationCollection< > > sharedObservations = simulateObservations< double, double >(
+                measurementSimulationInput, observationSimulators, bodies );
+    std::shared_ptr< ObservationCollection< > > separateObservations = simulateObservations< double, double >(
+                measurementSimulationInput, separateObservationSimulators, bodies );
+    BOOST_CHECK_EQUAL( lightTimeCalculator->getNumberOfCachedSolutions( ), 0 );
+
+    Eigen::VectorXd sharedObservationVector = sharedObservations->getObservationVector( );
+    Eigen::VectorXd separateObservationVector = separateObservations->getObservationVector( );
+    BOOST_CHECK_EQUAL( sharedObservationVector.rows( ), separateObservationVector.rows( ) );
+
+    // Light-time solutions may differ to within their convergence tolerance, due to the warm-started iterations
+    for( int i = 0; i < sharedObservationVector.rows( ); i++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( sharedObservationVector( i ) - separateObservationVector( i ) ), 1.0E-3 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -398,6 +398,74 @@ BOOST_AUTO_TEST_CASE( testObservationNoiseModels )
         }
 }
 
+//! Test whether observation noise generated in bulk is reproducible, and has the requested statistical properties
+BOOST_AUTO_TEST_CASE( testBulkObservationNoiseGeneration )
+{
+    const int numberOfObservations = 100000;
+    std::vector< double > observationTimes;
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        observationTimes.push_back( 10.0 * static_cast< double >( i ) );
+    }
+    std::vector< double > firstTimes( observationTimes.begin( ), observationTimes.begin( ) + 1000 );
+    std::vector< double > secondTimes( observationTimes.begin( ) + 1000, observationTimes.end( ) );
+
+    const double standardDeviation = 2.0;
+    const double correlationTime = 100.0;
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        std::vector< std::shared_ptr< ObservationNoiseGenerator > > noiseGenerators;
+        for( unsigned int i = 0; i < 4; i++ )
+        {
+            // Use different number of threads for each generator, with identical seed
+            if( test == 0 )
+            {
+                noiseGenerators.push_back( std::make_shared< GaussianObservationNoiseGenerator >(
+                                               standardDeviation, 0.5, 42, 2, ( i == 1 ) ? 4 : 1 ) );
+            }
+            else
+            {
+                noiseGenerators.push_back( std::make_shared< TimeCorrelatedGaussianObservationNoiseGenerator >(
+                                               standardDeviation, correlationTime, 42, 2, ( i == 1 ) ? 4 : 1 ) );
+            }
+        }
+
+        // Generate noise at once, in parallel, in two chunks, and per observation
+        Eigen::MatrixXd fullNoise, parallelNoise, firstChunkNoise, secondChunkNoise;
+        noiseGenerators.at( 0 )->generateNoise( observationTimes, fullNoise );
+        noiseGenerators.at( 1 )->generateNoise( observationTimes, parallelNoise );
+        noiseGenerators.at( 2 )->generateNoise( firstTimes, firstChunkNoise );
+        noiseGenerators.at( 2 )->generateNoise( secondTimes, secondChunkNoise );
+
+        BOOST_CHECK_EQUAL( fullNoise.rows( ), 2 );
+        BOOST_CHECK_EQUAL( fullNoise.cols( ), numberOfObservations );
+        BOOST_CHECK( fullNoise == parallelNoise );
+        BOOST_CHECK( fullNoise.block( 0, 0, 2, 1000 ) == firstChunkNoise );
+        BOOST_CHECK( fullNoise.block( 0, 1000, 2, numberOfObservations - 1000 ) == secondChunkNoise );
+        for( unsigned int i = 0; i < 10; i++ )
+        {
+            BOOST_CHECK( fullNoise.col( i ) == noiseGenerators.at( 3 )->generateSingleObservationNoise( observationTimes.at( i ) ) );
+        }
+
+        // Check statistics of noise
+        for( int i = 0; i < 2; i++ )
+        {
+            Eigen::VectorXd currentNoise = fullNoise.row( i ).transpose( );
+            double mean = currentNoise.mean( );
+            double computedStandardDeviation = std::sqrt( ( currentNoise.array( ) - mean ).square( ).mean( ) );
+            BOOST_CHECK_SMALL( mean - ( ( test == 0 ) ? 0.5 : 0.0 ), ( test == 0 ) ? 0.02 : 0.1 );
+            BOOST_CHECK_CLOSE_FRACTION( computedStandardDeviation, standardDeviation, ( test == 0 ) ? 1.0E-2 : 3.0E-2 );
+
+            // Check lag-one autocorrelation of noise
+            double autoCorrelation =
+                    ( ( currentNoise.segment( 0, numberOfObservations - 1 ).array( ) - mean ) *
+                      ( currentNoise.segment( 1, numberOfObservations - 1 ).array( ) - mean ) ).mean( ) /
+                    ( computedStandardDeviation * computedStandardDeviation );
+            BOOST_CHECK_SMALL( autoCorrelation - ( ( test == 0 ) ? 0.0 : std::exp( -10.0 / correlationTime ) ), 1.0E-2 );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
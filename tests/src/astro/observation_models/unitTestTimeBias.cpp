@@ -26,6 +26,7 @@
 #include "tudat/simulation/estimation_setup/createObservationModel.h"
 #include "tudat/simulation/environment_setup/defaultBodies.h"
 #include "tudat/simulation/environment_setup/createBodies.h"
+#include "tudat/astro/orbit_determination/observation_partials/observationPartial.h"
 
 namespace tudat
 {
@@ -217,6 +218,85 @@ BOOST_AUTO_TEST_CASE( testArcWiseTimeBias )
 
 
 
+}
+
+//! Test arc lookup for arc-wise biases, and associated partials, with sorted and unsorted observation times
+BOOST_AUTO_TEST_CASE( testArcWiseBiasLookup )
+{
+    std::vector< double > arcStartTimes = { 0.0, 100.0, 250.0, 400.0 };
+    std::vector< Eigen::Matrix< double, 1, 1 > > arcBiases;
+    std::vector< double > referenceEpochs;
+    for( unsigned int i = 0; i < arcStartTimes.size( ); i++ )
+    {
+        arcBiases.push_back( ( Eigen::Matrix< double, 1, 1 >( ) << static_cast< double >( i + 1 ) ).finished( ) );
+        referenceEpochs.push_back( arcStartTimes.at( i ) + 10.0 );
+    }
+
+    // Create arc-wise biases and partials, sharing the arc lookup scheme
+    std::shared_ptr< ConstantArcWiseObservationBias< 1 > > absoluteBias =
+            std::make_shared< ConstantArcWiseObservationBias< 1 > >( arcStartTimes, arcBiases, 0 );
+    std::shared_ptr< ArcWiseTimeDriftBias< 1 > > timeDriftBias =
+            std::make_shared< ArcWiseTimeDriftBias< 1 > >( arcStartTimes, arcBiases, 0, referenceEpochs );
+    LinkEnds linkEnds;
+    linkEnds[ receiver ] = LinkEndId( "Earth", "Station" );
+    observation_partials::ObservationPartialWrtArcWiseAbsoluteBias< 1 > absoluteBiasPartial(
+                one_way_range, linkEnds, absoluteBias->getLookupScheme( ), 0, arcStartTimes.size( ) );
+    observation_partials::ObservationPartialWrtArcWiseTimeDriftBias< 1 > timeDriftBiasPartial(
+                one_way_range, linkEnds, timeDriftBias->getLookupScheme( ), 0, arcStartTimes.size( ), referenceEpochs );
+
+    // Sorted times (including arc boundaries, and times before/after the first/last arc), followed by unsorted times
+    std::vector< double > testTimes = { -50.0, 0.0, 50.0, 99.9, 100.0, 180.0, 250.0, 399.0, 400.0, 1.0E9,
+                                        120.0, 10.0, 500.0, 260.0, 110.0, -1.0, 300.0 };
+    std::vector< int > expectedArcIndices = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 1, 0, 3, 2, 1, 0, 2 };
+
+    std::vector< Eigen::Vector6d > linkEndStates = { Eigen::Vector6d::Zero( ) };
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        int expectedArcIndex = expectedArcIndices.at( i );
+        std::vector< double > linkEndTimes = { testTimes.at( i ) };
+
+        // Check biases
+        BOOST_CHECK_EQUAL( absoluteBias->getObservationBias( linkEndTimes, linkEndStates )( 0 ),
+                           arcBiases.at( expectedArcIndex )( 0 ) );
+        BOOST_CHECK_CLOSE_FRACTION(
+                    timeDriftBias->getObservationBias( linkEndTimes, linkEndStates )( 0 ),
+                    arcBiases.at( expectedArcIndex )( 0 ) * ( testTimes.at( i ) - referenceEpochs.at( expectedArcIndex ) ),
+                    std::numeric_limits< double >::epsilon( ) );
+
+        // Check that only the entry of the current arc is non-zero in the partials
+        Eigen::MatrixXd absolutePartial = absoluteBiasPartial.calculatePartial( linkEndStates, linkEndTimes ).at( 0 ).first;
+        Eigen::MatrixXd timeDriftPartial = timeDriftBiasPartial.calculatePartial( linkEndStates, linkEndTimes ).at( 0 ).first;
+        for( unsigned int j = 0; j < arcStartTimes.size( ); j++ )
+        {
+            bool isCurrentArc = ( static_cast< int >( j ) == expectedArcIndex );
+            BOOST_CHECK_EQUAL( absolutePartial( 0, j ),
+                               ( ( isCurrentArc && testTimes.at( i ) >= arcStartTimes.at( 0 ) ) ? 1.0 : 0.0 ) );
+            BOOST_CHECK_EQUAL( timeDriftPartial( j ),
+                               ( isCurrentArc ? ( testTimes.at( i ) - referenceEpochs.at( j ) ) : 0.0 ) );
+        }
+    }
+
+    // Check arc indices using single sweep over times
+    interpolators::ArcBoundaryLookupScheme< double > arcLookupScheme(
+                std::vector< double >( { 0.0, 100.0, 250.0, 400.0, std::numeric_limits< double >::max( ) } ) );
+    BOOST_CHECK_EQUAL( arcLookupScheme.getNumberOfArcs( ), 4 );
+    std::vector< int > arcIndices = arcLookupScheme.findNearestLowerNeighbours( testTimes );
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( arcIndices.at( i ), expectedArcIndices.at( i ) );
+    }
+
+    // Check that unsorted arc start times are rejected
+    bool isExceptionCaught = false;
+    try
+    {
+        ConstantArcWiseObservationBias< 1 > invalidBias( { 0.0, 250.0, 100.0, 400.0 }, arcBiases, 0 );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
 }
 
 BOOST_AUTO_TEST_SUITE_END( )
@@ -671,6 +671,96 @@ BOOST_AUTO_TEST_CASE( testAerodynamicAccelerationPartials )
 }
 
 
+//! Test analytical state partials of aerodynamic acceleration (drag only), for tabulated and exponential atmosphere
+BOOST_AUTO_TEST_CASE( testAnalyticalAerodynamicAccelerationPartials )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        // Create Earth object (with default tabulated atmosphere for test case 0, and exponential atmosphere for case 1)
+        BodyListSettings defaultBodySettings =
+                getDefaultBodySettings( { "Earth" } );
+        defaultBodySettings.at( "Earth" )->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >(
+                    Eigen::Vector6d::Zero( ) );
+        if( testCase == 1 )
+        {
+            defaultBodySettings.at( "Earth" )->atmosphereSettings = std::make_shared< ExponentialAtmosphereSettings >(
+                        7.2E3, 290.0, 1.225 );
+        }
+        SystemOfBodies bodies = createSystemOfBodies( defaultBodySettings );
+
+        // Create vehicle objects, with drag-only aerodynamic coefficients
+        double vehicleMass = 5.0E3;
+        bodies.createEmptyBody( "Vehicle" );
+        bodies.at( "Vehicle" )->setConstantBodyMass( vehicleMass );
+        std::shared_ptr< AerodynamicCoefficientSettings > aerodynamicCoefficientSettings =
+                std::make_shared< ConstantAerodynamicCoefficientSettings >( 2.0, 2.2 * Eigen::Vector3d::UnitX( ) );
+        bodies.at( "Vehicle" )->setAerodynamicCoefficientInterface(
+                    createAerodynamicCoefficientInterface( aerodynamicCoefficientSettings, "Vehicle", bodies ) );
+
+        // Set vehicle state
+        Eigen::Vector6d vehicleSphericalState;
+        vehicleSphericalState( SphericalOrbitalStateElementIndices::radiusIndex ) =
+                spice_interface::getAverageRadius( "Earth" ) + 250.0E3;
+        vehicleSphericalState( SphericalOrbitalStateElementIndices::latitudeIndex ) = 0.3;
+        vehicleSphericalState( SphericalOrbitalStateElementIndices::longitudeIndex ) = 1.2;
+        vehicleSphericalState( SphericalOrbitalStateElementIndices::speedIndex ) = 7.7E3;
+        vehicleSphericalState( SphericalOrbitalStateElementIndices::flightPathIndex ) =
+                0.1 * mathematical_constants::PI / 180.0;
+        vehicleSphericalState( SphericalOrbitalStateElementIndices::headingAngleIndex ) = 0.6;
+        Eigen::Vector6d systemInitialState = tudat::ephemerides::transformStateToTargetFrame(
+                    convertSphericalOrbitalToCartesianState(
+                        vehicleSphericalState ), 0.0, bodies.at( "Earth" )->getRotationalEphemeris( ) );
+
+        bodies.at( "Earth" )->setStateFromEphemeris( 0.0 );
+        bodies.at( "Earth" )->setCurrentRotationalStateToLocalFrameFromEphemeris( 0.0 );
+        bodies.at( "Vehicle" )->setState( systemInitialState );
+
+        // Create acceleration and partial
+        std::shared_ptr< basic_astrodynamics::AccelerationModel3d > accelerationModel =
+                simulation_setup::createAerodynamicAcceleratioModel(
+                    bodies.at( "Vehicle" ), bodies.at( "Earth" ), "Vehicle", "Earth" );
+        bodies.at( "Vehicle" )->getFlightConditions( )->updateConditions( 0.0 );
+        accelerationModel->updateMembers( 0.0 );
+
+        std::shared_ptr< AerodynamicAccelerationPartial > aerodynamicAccelerationPartial =
+                std::dynamic_pointer_cast< AerodynamicAccelerationPartial >(
+                    createAnalyticalAccelerationPartial(
+                        accelerationModel, std::make_pair( "Vehicle", bodies.at( "Vehicle" ) ),
+                        std::make_pair( "Earth", bodies.at( "Earth" ) ), bodies ) );
+
+        // Calculate analytical partials, and check that analytical computation was used
+        aerodynamicAccelerationPartial->update( 0.0 );
+        BOOST_CHECK_EQUAL( aerodynamicAccelerationPartial->getAreStatePartialsAnalytical( ), true );
+
+        Eigen::MatrixXd partialWrtVehiclePosition = Eigen::Matrix3d::Zero( );
+        aerodynamicAccelerationPartial->wrtPositionOfAcceleratedBody( partialWrtVehiclePosition.block( 0, 0, 3, 3 ) );
+        Eigen::MatrixXd partialWrtVehicleVelocity = Eigen::Matrix3d::Zero( );
+        aerodynamicAccelerationPartial->wrtVelocityOfAcceleratedBody( partialWrtVehicleVelocity.block( 0, 0, 3, 3 ) );
+
+        // Calculate numerical partials.
+        std::function< void( ) > environmentUpdateFunction =
+                std::bind( &updateFlightConditionsWithPerturbedState, bodies.at( "Vehicle" )->getFlightConditions( ), 0.0 );
+        std::function< void( Eigen::Vector6d ) > vehicleStateSetFunction =
+                std::bind( &Body::setState, bodies.at( "Vehicle" ), std::placeholders::_1 );
+
+        Eigen::Matrix3d testPartialWrtVehiclePosition = calculateAccelerationWrtStatePartials(
+                    vehicleStateSetFunction, accelerationModel, bodies.at( "Vehicle" )->getState( ),
+                    Eigen::Vector3d::Constant( 1.0 ), 0, environmentUpdateFunction );
+        Eigen::Matrix3d testPartialWrtVehicleVelocity = calculateAccelerationWrtStatePartials(
+                    vehicleStateSetFunction, accelerationModel, bodies.at( "Vehicle" )->getState( ),
+                    Eigen::Vector3d::Constant( 1.0E-3 ), 3, environmentUpdateFunction );
+
+        // Compare numerical and analytical results.
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( testPartialWrtVehiclePosition,
+                                           partialWrtVehiclePosition, 1.0E-6 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( testPartialWrtVehicleVelocity,
+                                           partialWrtVehicleVelocity, 1.0E-6 );
+    }
+}
+
 BOOST_AUTO_TEST_CASE( testRelativisticAccelerationPartial )
 {
     // Create earth and vehicle bodies.
@@ -1593,6 +1683,92 @@ BOOST_AUTO_TEST_CASE( testYarkovskyPartials )
                                        partialWrtSunYarkovskyParameter, 1.0E-8 );
 }
 
+BOOST_AUTO_TEST_CASE( testCustomAccelerationPartials )
+{
+    // Create empty bodies, earth and vehicle.
+    std::shared_ptr< Body > earth = std::make_shared< Body >( );
+    std::shared_ptr< Body > vehicle = std::make_shared< Body >( );
+
+    SystemOfBodies bodies;
+    bodies.addBody( earth, "Earth" );
+    bodies.addBody( vehicle, "Vehicle" );
+
+    // Set current state of earth and vehicle.
+    Eigen::Vector6d vehicleState;
+    vehicleState << 7.0E6, 1.0E5, -2.0E5, 100.0, 7.5E3, 10.0;
+    earth->setState( Eigen::Vector6d::Zero( ) );
+    vehicle->setState( vehicleState );
+
+    // Define custom acceleration (point mass gravity and quadratic drag), generic in its scalar type
+    double gravitationalParameter = 3.986004418E14;
+    double dragFactor = 1.0E-9;
+    auto customAccelerationFunction = [ = ]( const double time, const auto& state )
+    {
+        typedef typename std::decay< decltype( state ) >::type::Scalar ScalarType;
+        Eigen::Matrix< ScalarType, 3, 1 > position = state.template segment< 3 >( 0 );
+        Eigen::Matrix< ScalarType, 3, 1 > velocity = state.template segment< 3 >( 3 );
+        ScalarType distance = position.norm( );
+        ScalarType speed = velocity.norm( );
+        return Eigen::Matrix< ScalarType, 3, 1 >(
+                    -gravitationalParameter * position / ( distance * distance * distance ) -
+                    dragFactor * ( 1.0 + time / 86400.0 ) * speed * velocity );
+    };
+
+    // Create custom acceleration, and check that it is equal to the (directly evaluated) function
+    std::shared_ptr< CustomAccelerationModel > customAccelerationModel =
+            std::dynamic_pointer_cast< CustomAccelerationModel >(
+                createAccelerationModel(
+                    vehicle, earth, stateDependentCustomAccelerationSettings( customAccelerationFunction ),
+                    "Vehicle", "Earth" ) );
+    customAccelerationModel->updateMembers( 3600.0 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( customAccelerationModel->getAcceleration( ),
+                                       customAccelerationFunction( 3600.0, vehicleState ),
+                                       std::numeric_limits< double >::epsilon( ) );
+    customAccelerationModel->resetCurrentTime( );
+
+    // Create custom acceleration partial (exact partials from dual numbers).
+    std::shared_ptr< AccelerationPartial > customPartial =
+            createAnalyticalAccelerationPartial( customAccelerationModel, std::make_pair( "Vehicle", vehicle ),
+                                                 std::make_pair( "Earth", earth ), bodies );
+    BOOST_CHECK( std::dynamic_pointer_cast< CustomAccelerationPartial >( customPartial ) != nullptr );
+
+    // Calculate partials.
+    customPartial->update( 3600.0 );
+    Eigen::MatrixXd partialWrtVehiclePosition = Eigen::Matrix3d::Zero( );
+    customPartial->wrtPositionOfAcceleratedBody( partialWrtVehiclePosition.block( 0, 0, 3, 3 ) );
+    Eigen::MatrixXd partialWrtVehicleVelocity = Eigen::Matrix3d::Zero( );
+    customPartial->wrtVelocityOfAcceleratedBody( partialWrtVehicleVelocity.block( 0, 0, 3, 3 ), 1, 0, 0 );
+    Eigen::MatrixXd partialWrtEarthPosition = Eigen::Matrix3d::Zero( );
+    customPartial->wrtPositionOfAcceleratingBody( partialWrtEarthPosition.block( 0, 0, 3, 3 ) );
+
+    // Calculate numerical partials.
+    Eigen::Vector3d positionPerturbation;
+    positionPerturbation << 100.0, 100.0, 100.0;
+    Eigen::Vector3d velocityPerturbation;
+    velocityPerturbation << 1.0, 1.0, 1.0;
+    std::function< void( Eigen::Vector6d ) > vehicleStateSetFunction =
+            std::bind( &Body::setState, vehicle, std::placeholders::_1 );
+    Eigen::Matrix3d testPartialWrtVehiclePosition = calculateAccelerationWrtStatePartials(
+                vehicleStateSetFunction, customAccelerationModel, vehicle->getState( ), positionPerturbation, 0,
+                emptyFunction, 3600.0 );
+    Eigen::Matrix3d testPartialWrtVehicleVelocity = calculateAccelerationWrtStatePartials(
+                vehicleStateSetFunction, customAccelerationModel, vehicle->getState( ), velocityPerturbation, 3,
+                emptyFunction, 3600.0 );
+
+    // Compare numerical and analytical results.
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( testPartialWrtVehiclePosition, partialWrtVehiclePosition, 1.0E-6 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( testPartialWrtVehicleVelocity, partialWrtVehicleVelocity, 1.0E-6 );
+    BOOST_CHECK_EQUAL( partialWrtEarthPosition.norm( ), 0.0 );
+
+    // Check that time-only custom accelerations do not provide state partials.
+    std::shared_ptr< CustomAccelerationModel > timeOnlyAccelerationModel =
+            std::dynamic_pointer_cast< CustomAccelerationModel >(
+                createAccelerationModel(
+                    vehicle, earth, customAccelerationSettings(
+                        [ ]( const double ){ return Eigen::Vector3d::UnitX( ); } ), "Vehicle", "Earth" ) );
+    BOOST_CHECK( !timeOnlyAccelerationModel->hasStatePartials( ) );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
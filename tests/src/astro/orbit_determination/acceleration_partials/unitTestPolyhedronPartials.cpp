@@ -346,6 +346,125 @@ BOOST_AUTO_TEST_CASE( testPolyhedronAccelerationPartialWithSynchronousRotation )
 }
 
 
+//! Unit test to check partials of polyhedron acceleration with spherical harmonic far field, inside the blending region
+BOOST_AUTO_TEST_CASE( testHybridPolyhedronAccelerationPartial )
+{
+    // Create empty bodies, earth and vehicle.
+    std::shared_ptr< simulation_setup::Body > earth = std::make_shared< simulation_setup::Body >( );
+    std::shared_ptr< simulation_setup::Body > vehicle = std::make_shared< simulation_setup::Body >( );
+
+    const double gravitationalParameter = 3.986004418e14;
+
+    // Define cuboid polyhedron dimensions
+    const double w = 6378137.0 / 2; // width
+    const double h = 6378137.0 / 3; // height
+    const double l = 6378137.0 / 4; // length
+
+    // Define cuboid
+    Eigen::MatrixXd verticesCoordinates(8,3);
+    verticesCoordinates <<
+        0.0, 0.0, 0.0,
+        l, 0.0, 0.0,
+        0.0, w, 0.0,
+        l, w, 0.0,
+        0.0, 0.0, h,
+        l, 0.0, h,
+        0.0, w, h,
+        l, w, h;
+    Eigen::MatrixXi verticesDefiningEachFacet(12,3);
+    verticesDefiningEachFacet <<
+        2, 1, 0,
+        1, 2, 3,
+        4, 2, 0,
+        2, 4, 6,
+        1, 4, 0,
+        4, 1, 5,
+        6, 5, 7,
+        5, 6, 4,
+        3, 6, 7,
+        6, 3, 2,
+        5, 3, 7,
+        3, 5, 1;
+
+    simulation_setup::SystemOfBodies bodies;
+    bodies.addBody( earth, "Earth" );
+    bodies.addBody( vehicle, "Vehicle" );
+
+    std::shared_ptr< ephemerides::SimpleRotationalEphemeris > simpleRotationalEphemeris =
+            std::make_shared< ephemerides::SimpleRotationalEphemeris >(
+                Eigen::Quaterniond( Eigen::AngleAxisd( 0.3, Eigen::Vector3d::UnitZ( ) ) ),
+                2.0 * mathematical_constants::PI / 86400.0,
+                1.0E7,
+                "ECLIPJ2000" , "IAU_Earth" );
+    earth->setRotationalEphemeris( simpleRotationalEphemeris );
+
+    // Create polyhedron gravity field with spherical harmonic far field, and set vehicle in blending region
+    const double innerSwitchDistance = 7.0E6;
+    const double outerSwitchDistance = 9.0E6;
+    std::shared_ptr< tudat::gravitation::HybridPolyhedronGravityField > earthGravityField =
+            std::dynamic_pointer_cast< gravitation::HybridPolyhedronGravityField  >(
+                simulation_setup::createGravityFieldModel(
+                    simulation_setup::hybridPolyhedronGravitySettingsFromMu(
+                        gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet, "IAU_Earth",
+                        8, innerSwitchDistance, outerSwitchDistance ), "Earth", bodies ) );
+    BOOST_CHECK( earthGravityField != nullptr );
+    earth->setGravityFieldModel( earthGravityField );
+
+    double testTime = 1.0E6;
+    earth->setState( Eigen::Vector6d::Zero( ) );
+    earth->setCurrentRotationToLocalFrameFromEphemeris( testTime );
+
+    Eigen::Vector6d vehicleState;
+    vehicleState << 5.0E6, -4.0E6, 3.0E6, 2.0E3, 5.0E3, -3.0E3;
+    vehicle->setState( vehicleState );
+
+    // Create acceleration due Earth on vehicle.
+    std::shared_ptr< simulation_setup::AccelerationSettings > accelerationSettings =
+            std::make_shared< simulation_setup::AccelerationSettings >( basic_astrodynamics::polyhedron_gravity );
+    std::shared_ptr< gravitation::PolyhedronGravitationalAccelerationModel > gravitationalAcceleration =
+            std::dynamic_pointer_cast< gravitation::PolyhedronGravitationalAccelerationModel >(
+                createAccelerationModel( vehicle, earth, accelerationSettings, "Vehicle", "Earth" ) );
+    BOOST_CHECK( gravitationalAcceleration->getFarFieldAccelerationModel( ) != nullptr );
+    gravitationalAcceleration->updateMembers( testTime );
+    BOOST_CHECK( gravitationalAcceleration->getCurrentFarFieldWeight( ) > 0.0 );
+    BOOST_CHECK( gravitationalAcceleration->getCurrentFarFieldWeight( ) < 1.0 );
+
+    // Create state modification functions for bodies.
+    std::function< void( Eigen::Vector6d ) > earthStateSetFunction =
+            std::bind( &simulation_setup::Body::setState, earth, std::placeholders::_1  );
+    std::function< void( Eigen::Vector6d ) > vehicleStateSetFunction =
+            std::bind( &simulation_setup::Body::setState, vehicle, std::placeholders::_1  );
+
+    // Create acceleration partial object.
+    std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > > parameterSet =
+            createParametersToEstimate(
+                std::vector< std::shared_ptr< estimatable_parameters::EstimatableParameterSettings > >( ), bodies );
+    std::shared_ptr< acceleration_partials::PolyhedronGravityPartial > accelerationPartial =
+            std::dynamic_pointer_cast< acceleration_partials::PolyhedronGravityPartial > (
+                createAnalyticalAccelerationPartial(
+                    gravitationalAcceleration,
+                    std::make_pair( "Vehicle", vehicle ),
+                    std::make_pair( "Earth", earth ),
+                    bodies, parameterSet ) );
+    accelerationPartial->update( testTime );
+
+    Eigen::MatrixXd partialWrtVehiclePosition = Eigen::Matrix3d::Zero( );
+    accelerationPartial->wrtPositionOfAcceleratedBody( partialWrtVehiclePosition.block( 0, 0, 3, 3 ) );
+    Eigen::MatrixXd partialWrtEarthPosition = Eigen::Matrix3d::Zero( );
+    accelerationPartial->wrtPositionOfAcceleratingBody( partialWrtEarthPosition.block( 0, 0, 3, 3 ) );
+
+    // Calculate numerical partials.
+    Eigen::Vector3d positionPerturbation;
+    positionPerturbation << 10.0, 10.0, 10.0;
+    Eigen::Matrix3d testPartialWrtVehiclePosition = acceleration_partials::calculateAccelerationWrtStatePartials(
+                vehicleStateSetFunction, gravitationalAcceleration, vehicle->getState( ), positionPerturbation, 0 );
+    Eigen::Matrix3d testPartialWrtEarthPosition = acceleration_partials::calculateAccelerationWrtStatePartials(
+                earthStateSetFunction, gravitationalAcceleration, earth->getState( ), positionPerturbation, 0 );
+
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( testPartialWrtVehiclePosition, partialWrtVehiclePosition, 1.0E-6 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( testPartialWrtEarthPosition, partialWrtEarthPosition, 1.0E-6 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -169,6 +169,92 @@ BOOST_AUTO_TEST_CASE( testnWayRangePartials )
 }
 
 
+//! Test whether one-way range partials of constituent links are correctly shared between n-way range observables
+BOOST_AUTO_TEST_CASE( testSharedOneWayRangePartials )
+{
+    // Define and create ground stations.
+    std::vector< std::pair< std::string, std::string > > groundStations;
+    groundStations.resize( 2 );
+    groundStations[ 0 ] = std::make_pair( "Earth", "Graz" );
+    groundStations[ 1 ] = std::make_pair( "Mars", "MSL" );
+
+    // Set link ends for two-way range
+    LinkDefinition linkEnds;
+    linkEnds[ transmitter ] = groundStations[ 0 ];
+    linkEnds[ reflector1 ] = groundStations[ 1 ];
+    linkEnds[ receiver ] = groundStations[ 0 ];
+
+    // Create environment
+    SystemOfBodies bodies = setupEnvironment( groundStations, 1.0E7, 1.2E7, 1.1E7, true );
+
+    // Generate n-way range model
+    std::vector< std::shared_ptr< observation_models::ObservationModelSettings > > legObservationModels;
+    for( unsigned int i = 0; i < 2; i ++ )
+    {
+        legObservationModels.push_back(
+                    std::make_shared< observation_models::ObservationModelSettings >(
+                        one_way_range, getSingleLegLinkEnds( linkEnds.linkEnds_, i ) ) );
+    }
+    std::shared_ptr< ObservationModel< 1 > > nWayRangeModel =
+            observation_models::ObservationModelCreator< 1, double, double >::createObservationModel(
+                std::make_shared< observation_models::NWayRangeObservationSettings >(
+                    legObservationModels ), bodies );
+
+    // Create parameter objects.
+    std::shared_ptr< EstimatableParameterSet< double > > fullEstimatableParameterSet =
+            createEstimatableParameters( bodies, 1.1E7 );
+
+    // Create partials twice with shared one-way range partials, and once without
+    std::shared_ptr< OneWayRangePartialRegistry< double, double > > oneWayRangePartialRegistry =
+            std::make_shared< OneWayRangePartialRegistry< double, double > >( );
+    std::vector< std::pair< SingleLinkObservationPartialList, std::shared_ptr< PositionPartialScaling > > > sharedPartialSets;
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        sharedPartialSets.push_back(
+                    ObservationPartialCreator< 1, double, double >::createObservationPartials(
+                        nWayRangeModel, bodies, fullEstimatableParameterSet, true, nullptr, oneWayRangePartialRegistry ) );
+    }
+    std::pair< SingleLinkObservationPartialList, std::shared_ptr< PositionPartialScaling > > independentPartialSet =
+            ObservationPartialCreator< 1, double, double >::createObservationPartials(
+                nWayRangeModel, bodies, fullEstimatableParameterSet );
+
+    // Check that one-way range partials are created only once for each link
+    BOOST_CHECK_EQUAL( oneWayRangePartialRegistry->getNumberOfRegisteredLinks( ), 2 );
+    BOOST_CHECK_EQUAL( sharedPartialSets.at( 0 ).first.size( ), independentPartialSet.first.size( ) );
+
+    // Compute partials with caching enabled, and compare to partials computed without shared one-way range partials
+    oneWayRangePartialRegistry->setPartialCaching( true );
+    std::vector< Eigen::Vector6d > vectorOfStates;
+    std::vector< double > vectorOfTimes;
+    Eigen::VectorXd currentObservation = nWayRangeModel->computeObservationsWithLinkEndData(
+                1.1E7, receiver, vectorOfTimes, vectorOfStates );
+
+    independentPartialSet.second->update( vectorOfStates, vectorOfTimes, receiver, currentObservation );
+    for( unsigned int i = 0; i < sharedPartialSets.size( ); i++ )
+    {
+        sharedPartialSets.at( i ).second->update( vectorOfStates, vectorOfTimes, receiver, currentObservation );
+        for( auto partialIterator : independentPartialSet.first )
+        {
+            std::vector< std::pair< Eigen::Matrix< double, 1, Eigen::Dynamic >, double > > expectedPartials =
+                    partialIterator.second->calculatePartial( vectorOfStates, vectorOfTimes, receiver, currentObservation );
+            std::vector< std::pair< Eigen::Matrix< double, 1, Eigen::Dynamic >, double > > sharedPartials =
+                    sharedPartialSets.at( i ).first.at( partialIterator.first )->calculatePartial(
+                        vectorOfStates, vectorOfTimes, receiver, currentObservation );
+
+            BOOST_CHECK_EQUAL( sharedPartials.size( ), expectedPartials.size( ) );
+            for( unsigned int j = 0; j < sharedPartials.size( ); j++ )
+            {
+                BOOST_CHECK_EQUAL( sharedPartials.at( j ).second, expectedPartials.at( j ).second );
+                TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                            sharedPartials.at( j ).first, expectedPartials.at( j ).first,
+                            std::numeric_limits< double >::epsilon( ) );
+            }
+        }
+    }
+    oneWayRangePartialRegistry->setPartialCaching( false );
+}
+
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
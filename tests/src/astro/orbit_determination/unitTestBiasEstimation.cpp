@@ -104,6 +104,124 @@ BOOST_AUTO_TEST_CASE( test_EstimationFromPosition )
     BOOST_CHECK_EQUAL( executeEarthOrbiterBiasEstimation( true, false, true, true, true, false ).second, true );
 }
 
+//! Test whether design matrix computation distributed over several threads reproduces the serial estimation exactly
+BOOST_AUTO_TEST_CASE( test_ParallelDesignMatrixEstimation )
+{
+    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        bool estimateRangeBiases = ( testCase == 0 );
+        Eigen::VectorXd serialError = executeEarthOrbiterBiasEstimation< double, double >(
+                    estimateRangeBiases, true, false, true, false, false, false, 1 ).first;
+        Eigen::VectorXd parallelError = executeEarthOrbiterBiasEstimation< double, double >(
+                    estimateRangeBiases, true, false, true, false, false, false, 4 ).first;
+
+        BOOST_CHECK_EQUAL( serialError.rows( ), parallelError.rows( ) );
+        for( int i = 0; i < serialError.rows( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( serialError( i ), parallelError( i ) );
+        }
+    }
+}
+
+//! Test whether accumulating the normal equations per block of observations reproduces the estimation from the full design matrix
+BOOST_AUTO_TEST_CASE( test_NormalEquationsAccumulationEstimation )
+{
+    for( unsigned int numberOfThreads = 1; numberOfThreads < 3; numberOfThreads++ )
+    {
+        std::pair< Eigen::VectorXd, bool > designMatrixResult = executeEarthOrbiterBiasEstimation< double, double >(
+                    true, true, false, true, false, false, false, 1, false );
+        std::pair< Eigen::VectorXd, bool > normalEquationsResult = executeEarthOrbiterBiasEstimation< double, double >(
+                    true, true, false, true, false, false, false, numberOfThreads, true );
+
+        BOOST_CHECK_EQUAL( normalEquationsResult.second, false );
+        BOOST_CHECK_EQUAL( designMatrixResult.first.rows( ), normalEquationsResult.first.rows( ) );
+        for( int i = 0; i < designMatrixResult.first.rows( ); i++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( designMatrixResult.first( i ) - normalEquationsResult.first( i ) ),
+                               ( i < 3 ) ? 1.0E-3 : ( ( i < 6 ) ? 1.0E-6 : 1.0E-3 ) );
+        }
+    }
+}
+
+//! Test whether reusing the bias partials from the first iteration reproduces the estimation with recomputed partials
+BOOST_AUTO_TEST_CASE( test_ReusedBiasPartialsEstimation )
+{
+    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        // Absolute range biases have constant partials, relative biases have partials proportional to the observable
+        bool estimateAbsoluteBiases = ( testCase == 0 );
+        Eigen::VectorXd recomputedPartialsError = executeEarthOrbiterBiasEstimation< double, double >(
+                    true, true, false, estimateAbsoluteBiases, false, false, false, 1, false, false ).first;
+        std::pair< Eigen::VectorXd, bool > reusedPartialsResult = executeEarthOrbiterBiasEstimation< double, double >(
+                    true, true, false, estimateAbsoluteBiases, false, false, false, 1, false, true );
+
+        BOOST_CHECK_EQUAL( reusedPartialsResult.second, false );
+        BOOST_CHECK_EQUAL( recomputedPartialsError.rows( ), reusedPartialsResult.first.rows( ) );
+        for( int i = 0; i < recomputedPartialsError.rows( ); i++ )
+        {
+            if( estimateAbsoluteBiases )
+            {
+                BOOST_CHECK_EQUAL( recomputedPartialsError( i ), reusedPartialsResult.first( i ) );
+            }
+            else
+            {
+                BOOST_CHECK_SMALL( std::fabs( recomputedPartialsError( i ) - reusedPartialsResult.first( i ) ),
+                                   ( i < 3 ) ? 1.0E-3 : ( ( i < 6 ) ? 1.0E-6 : 1.0E-9 ) );
+            }
+        }
+    }
+}
+
+//! Test whether reweighting the observations rejects corrupted range observations, reproducing the estimation from clean data
+BOOST_AUTO_TEST_CASE( test_OutlierRejectionEstimation )
+{
+    Eigen::VectorXd cleanDataError = executeEarthOrbiterBiasEstimation< double, double >(
+                true, true, false, true, false, false, false, 1, false, false, false ).first;
+    std::pair< Eigen::VectorXd, bool > outlierRejectionResult = executeEarthOrbiterBiasEstimation< double, double >(
+                true, true, false, true, false, false, false, 1, false, false, true );
+
+    BOOST_CHECK_EQUAL( outlierRejectionResult.second, false );
+    BOOST_CHECK_EQUAL( cleanDataError.rows( ), outlierRejectionResult.first.rows( ) );
+    for( int i = 0; i < cleanDataError.rows( ); i++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( cleanDataError( i ) - outlierRejectionResult.first( i ) ),
+                           ( i < 3 ) ? 1.0E-3 : ( ( i < 6 ) ? 1.0E-6 : 1.0E-3 ) );
+    }
+}
+
+//! Test whether processing the observations of all sets in order of observation time reproduces the default estimation
+BOOST_AUTO_TEST_CASE( test_TimeOrderedObservationProcessing )
+{
+    for( unsigned int testCase = 0; testCase < 3; testCase++ )
+    {
+        // Full design matrix (serial and with two threads), and accumulated normal equations
+        int numberOfThreads = ( testCase == 1 ) ? 2 : 1;
+        bool accumulateNormalEquations = ( testCase == 2 );
+        Eigen::VectorXd defaultOrderError = executeEarthOrbiterBiasEstimation< double, double >(
+                    true, true, false, true, false, false, false, numberOfThreads, accumulateNormalEquations,
+                    false, false, false ).first;
+        std::pair< Eigen::VectorXd, bool > timeOrderedResult = executeEarthOrbiterBiasEstimation< double, double >(
+                    true, true, false, true, false, false, false, numberOfThreads, accumulateNormalEquations,
+                    false, false, true );
+
+        BOOST_CHECK_EQUAL( timeOrderedResult.second, false );
+        BOOST_CHECK_EQUAL( defaultOrderError.rows( ), timeOrderedResult.first.rows( ) );
+        for( int i = 0; i < defaultOrderError.rows( ); i++ )
+        {
+            // Design matrix is identical; normal equations are summed in a different order
+            if( !accumulateNormalEquations )
+            {
+                BOOST_CHECK_EQUAL( defaultOrderError( i ), timeOrderedResult.first( i ) );
+            }
+            else
+            {
+                BOOST_CHECK_SMALL( std::fabs( defaultOrderError( i ) - timeOrderedResult.first( i ) ),
+                                   ( i < 3 ) ? 1.0E-3 : ( ( i < 6 ) ? 1.0E-6 : 1.0E-3 ) );
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
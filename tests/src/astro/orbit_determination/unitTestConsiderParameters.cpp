@@ -347,6 +347,62 @@ BOOST_AUTO_TEST_CASE( testConsiderParameters )
     // Check consistency
     TUDAT_CHECK_MATRIX_CLOSE_FRACTION( updatedParameters, computedUpdatedParameters, 1.0e-12 );
 
+    // Create covariance sensitivity analysis, and check that it reproduces the covariance analysis
+    std::shared_ptr< CovarianceSensitivityAnalysis< double, double > > sensitivityAnalysis =
+            orbitDeterminationManager.createCovarianceSensitivityAnalysis( covarianceInput );
+    std::shared_ptr< CovarianceAnalysisOutput< double, double > > sweepOutput = sensitivityAnalysis->computeCovariance(
+                covarianceInput->getWeightsMatrixDiagonals( ), Eigen::MatrixXd::Zero( 0, 0 ), considerCovariance );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( sweepOutput->unnormalizedCovarianceMatrix_, covariance, 1.0e-10 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( sweepOutput->unnormalizedCovarianceWithConsiderParameters_,
+                                       covarianceOutput->unnormalizedCovarianceWithConsiderParameters_, 1.0e-10 );
+
+    // Check covariance analysis with modified weights and a priori covariance
+    std::shared_ptr< CovarianceAnalysisInput< double, double  > > modifiedCovarianceInput =
+            std::make_shared< CovarianceAnalysisInput< double, double > >(
+                observationsAndTimes, 1.0E-3 * computedNormalisedInvCovariance.cwiseProduct(
+                    normalisationTerms * normalisationTerms.transpose( ) ), considerCovariance );
+    std::vector< double > weightPerSet;
+    for( unsigned int i = 0; i < sensitivityAnalysis->getObservationSets( ).size( ); i++ )
+    {
+        weightPerSet.push_back( 1.0 / std::pow( 1.0 + static_cast< double >( i ), 2 ) );
+        modifiedCovarianceInput->setConstantSingleObservableAndLinkEndsWeights(
+                    std::get< 0 >( sensitivityAnalysis->getObservationSets( ).at( i ) ),
+                    std::get< 1 >( sensitivityAnalysis->getObservationSets( ).at( i ) ), weightPerSet.at( i ) );
+    }
+    std::shared_ptr< CovarianceAnalysisOutput< double, double > > modifiedCovarianceOutput =
+            orbitDeterminationManager.computeCovariance( modifiedCovarianceInput );
+
+    sweepOutput = sensitivityAnalysis->computeCovariance(
+                modifiedCovarianceInput->getWeightsMatrixDiagonals( ), modifiedCovarianceInput->getInverseOfAprioriCovariance( ),
+                considerCovariance );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( sweepOutput->unnormalizedCovarianceWithConsiderParameters_,
+                                       modifiedCovarianceOutput->unnormalizedCovarianceWithConsiderParameters_, 1.0e-10 );
+
+    sweepOutput = sensitivityAnalysis->computeCovarianceWithConstantSetWeights(
+                weightPerSet, modifiedCovarianceInput->getInverseOfAprioriCovariance( ), considerCovariance );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( sweepOutput->unnormalizedCovarianceWithConsiderParameters_,
+                                       modifiedCovarianceOutput->unnormalizedCovarianceWithConsiderParameters_, 1.0e-10 );
+
+    // Check that selecting a subset of observation sets is equivalent to setting zero weights for the other sets
+    std::vector< int > selectedSets = sensitivityAnalysis->getObservationSetIndices(
+                observation_models::position_observable, linkEndsList.at( 0 ) );
+    std::vector< int > otherSelectedSets = sensitivityAnalysis->getObservationSetIndices(
+                observation_models::position_observable, linkEndsList.at( 2 ) );
+    selectedSets.insert( selectedSets.end( ), otherSelectedSets.begin( ), otherSelectedSets.end( ) );
+    std::vector< double > subsetWeightPerSet( weightPerSet.size( ), 0.0 );
+    for( unsigned int i = 0; i < selectedSets.size( ); i++ )
+    {
+        subsetWeightPerSet.at( selectedSets.at( i ) ) = weightPerSet.at( selectedSets.at( i ) );
+    }
+    std::shared_ptr< CovarianceAnalysisOutput< double, double > > subsetOutput =
+            sensitivityAnalysis->computeCovarianceWithConstantSetWeights(
+                weightPerSet, modifiedCovarianceInput->getInverseOfAprioriCovariance( ), considerCovariance, selectedSets );
+    std::shared_ptr< CovarianceAnalysisOutput< double, double > > zeroWeightOutput =
+            sensitivityAnalysis->computeCovarianceWithConstantSetWeights(
+                subsetWeightPerSet, modifiedCovarianceInput->getInverseOfAprioriCovariance( ), considerCovariance );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( subsetOutput->unnormalizedCovarianceWithConsiderParameters_,
+                                       zeroWeightOutput->unnormalizedCovarianceWithConsiderParameters_, 1.0e-12 );
+
 }
 
 BOOST_AUTO_TEST_SUITE_END( )
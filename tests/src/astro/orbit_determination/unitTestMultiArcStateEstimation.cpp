@@ -52,7 +52,10 @@ using namespace tudat::basic_astrodynamics;
 
 template< typename ObservationScalarType = double , typename TimeType = double , typename StateScalarType  = double >
 Eigen::VectorXd  executeParameterEstimation(
-        const int linkArcs )
+        const int linkArcs,
+        const bool reduceArcLocalParameters = false,
+        const int numberOfThreads = 1,
+        const bool pipelinedArcProcessing = false )
 {
     //Load spice kernels.f
     std::string kernelsPath = paths::getSpiceKernelPath( );
@@ -233,9 +236,24 @@ Eigen::VectorXd  executeParameterEstimation(
     }
 
     std::vector< std::shared_ptr< ObservationSimulationSettings< TimeType > > > measurementSimulationInput;
-    measurementSimulationInput.push_back(
-                std::make_shared< TabulatedObservationSimulationSettings< TimeType > >(
-                    one_way_range, linkEnds2[ 0 ], initialObservationTimes, receiver ) );
+    if( !pipelinedArcProcessing )
+    {
+        measurementSimulationInput.push_back(
+                    std::make_shared< TabulatedObservationSimulationSettings< TimeType > >(
+                        one_way_range, linkEnds2[ 0 ], initialObservationTimes, receiver ) );
+    }
+    else
+    {
+        // Simulate separate observation set for each arc
+        for( unsigned int i = 0; i < integrationArcStartTimes.size( ); i++ )
+        {
+            measurementSimulationInput.push_back(
+                        std::make_shared< TabulatedObservationSimulationSettings< TimeType > >(
+                            one_way_range, linkEnds2[ 0 ], std::vector< TimeType >(
+                                initialObservationTimes.begin( ) + i * numberOfObservationsPerArc,
+                                initialObservationTimes.begin( ) + ( i + 1 ) * numberOfObservationsPerArc ), receiver ) );
+        }
+    }
 
     std::shared_ptr< ObservationCollection< ObservationScalarType, TimeType > > observationsAndTimes = simulateObservations< ObservationScalarType, TimeType >(
                 measurementSimulationInput, orbitDeterminationManager.getObservationSimulators( ), bodies  );
@@ -266,6 +284,16 @@ Eigen::VectorXd  executeParameterEstimation(
     std::shared_ptr< CovarianceAnalysisInput< ObservationScalarType, TimeType > > covarianceInput =
             std::make_shared< CovarianceAnalysisInput< ObservationScalarType, TimeType > >(
                 observationsAndTimes );
+    if( reduceArcLocalParameters )
+    {
+        estimationInput->setArcLocalParameterReduction( true );
+        orbitDeterminationManager.setNumberOfDesignMatrixThreads( numberOfThreads );
+    }
+    if( pipelinedArcProcessing )
+    {
+        estimationInput->setPipelinedArcProcessing( true );
+        orbitDeterminationManager.setNumberOfDesignMatrixThreads( numberOfThreads );
+    }
 
     std::shared_ptr< EstimationOutput< StateScalarType, TimeType > > estimationOutput = orbitDeterminationManager.estimateParameters(
                 estimationInput );
@@ -326,6 +354,55 @@ BOOST_AUTO_TEST_CASE( test_MultiArcStateEstimation )
 
 }
 
+BOOST_AUTO_TEST_CASE( test_MultiArcStateEstimationWithArcLocalParameterReduction )
+{
+    // Execute test with arc initial states eliminated from normal equations (serial and with arcs distributed over threads)
+    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        Eigen::VectorXd parameterError = executeParameterEstimation< double, double, double >(
+                    0, true, ( testCase == 0 ) ? 1 : 2 );
+        int numberOfEstimatedArcs = ( parameterError.rows( ) - 3 ) / 6;
+
+        for( int i = 0; i < numberOfEstimatedArcs; i++ )
+        {
+            for( unsigned int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( parameterError( i * 6 + j ) ), 1E-1 );
+                BOOST_CHECK_SMALL( std::fabs( parameterError( i * 6 + j + 3 ) ), 1.0E-7  );
+            }
+        }
+
+        BOOST_CHECK_SMALL( std::fabs( parameterError( parameterError.rows( ) - 3 ) ), 1.0E-17 );
+        BOOST_CHECK_SMALL( std::fabs( parameterError( parameterError.rows( ) - 2 ) ), 1.0E-9 );
+        BOOST_CHECK_SMALL( std::fabs( parameterError( parameterError.rows( ) - 1 ) ), 1.0E-9 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( test_MultiArcStateEstimationWithPipelinedArcProcessing )
+{
+    // Execute test with observations of each arc processed directly after its propagation (with dense normal equations
+    // in serial, and with arc initial states eliminated from normal equations using two threads)
+    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        Eigen::VectorXd parameterError = executeParameterEstimation< double, double, double >(
+                    0, ( testCase == 1 ), ( testCase == 0 ) ? 1 : 2, true );
+        int numberOfEstimatedArcs = ( parameterError.rows( ) - 3 ) / 6;
+
+        for( int i = 0; i < numberOfEstimatedArcs; i++ )
+        {
+            for( unsigned int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( parameterError( i * 6 + j ) ), 1E-1 );
+                BOOST_CHECK_SMALL( std::fabs( parameterError( i * 6 + j + 3 ) ), 1.0E-7  );
+            }
+        }
+
+        BOOST_CHECK_SMALL( std::fabs( parameterError( parameterError.rows( ) - 3 ) ), 1.0E-17 );
+        BOOST_CHECK_SMALL( std::fabs( parameterError( parameterError.rows( ) - 2 ) ), 1.0E-9 );
+        BOOST_CHECK_SMALL( std::fabs( parameterError( parameterError.rows( ) - 1 ) ), 1.0E-9 );
+    }
+}
+
 template< typename ObservationScalarType = double , typename TimeType = double , typename StateScalarType  = double >
 Eigen::VectorXd  executeMultiBodyMultiArcParameterEstimation( )
 {
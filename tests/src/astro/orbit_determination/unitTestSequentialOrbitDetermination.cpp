@@ -0,0 +1,163 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/astro/basic_astro/keplerPropagator.h"
+#include "tudat/astro/basic_astro/orbitalElementConversions.h"
+#include "tudat/astro/ephemerides/tabulatedEphemeris.h"
+#include "tudat/simulation/estimation_setup/sequentialOrbitDeterminationFilter.h"
+#include "tudat/simulation/estimation_setup/simulateObservations.h"
+#include "tudat/simulation/environment_setup/createBodies.h"
+#include "tudat/simulation/propagation_setup/createAccelerationModels.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace simulation_setup;
+using namespace propagators;
+using namespace numerical_integrators;
+using namespace observation_models;
+using namespace estimatable_parameters;
+using namespace orbital_element_conversions;
+
+BOOST_AUTO_TEST_SUITE( test_sequential_orbit_determination )
+
+//! Test sequential filter, by estimating the state of a vehicle and the gravitational parameter of the Earth from
+//! ideal position observations, and comparing the final estimate to the analytical (Keplerian) true state.
+BOOST_AUTO_TEST_CASE( testSequentialOrbitDeterminationFilter )
+{
+    double earthGravitationalParameter = 3.986004418E14;
+
+    // Create environment with point-mass Earth and vehicle
+    BodyListSettings bodySettings = BodyListSettings( "Earth", "ECLIPJ2000" );
+    bodySettings.addSettings( "Earth" );
+    bodySettings.at( "Earth" )->ephemerisSettings = constantEphemerisSettings( Eigen::Vector6d::Zero( ), "SSB" );
+    bodySettings.at( "Earth" )->gravityFieldSettings = centralGravitySettings( earthGravitationalParameter );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.at( "Vehicle" )->setEphemeris( std::make_shared< ephemerides::TabulatedCartesianEphemeris< > >(
+                std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Vector6d > >( ), "Earth", "ECLIPJ2000" ) );
+
+    // Create propagator settings
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back( pointMassGravityAcceleration( ) );
+    basic_astrodynamics::AccelerationMap accelerationModels = createAccelerationModelsMap(
+                bodies, accelerationSettings, { "Vehicle" }, { "Earth" } );
+
+    Eigen::Vector6d initialKeplerianState;
+    initialKeplerianState << 7200.0E3, 0.05, 1.2, 0.3, 2.1, 0.4;
+    Eigen::Vector6d initialState = convertKeplerianToCartesianElements( initialKeplerianState, earthGravitationalParameter );
+
+    double initialTime = 0.0;
+    double observationMargin = 10.0;
+    std::shared_ptr< SingleArcPropagatorSettings< double > > propagatorSettings = translationalStatePropagatorSettings< double >(
+                { "Earth" }, accelerationModels, { "Vehicle" }, initialState, initialTime,
+                rungeKuttaFixedStepSettings( 10.0, CoefficientSets::rungeKuttaFehlberg78 ),
+                propagationTimeTerminationSettings( 3.0 * 3600.0 ) );
+
+    // Create estimated parameters and orbit determination manager
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames;
+    parameterNames.push_back( std::make_shared< InitialTranslationalStateEstimatableParameterSettings< double > >(
+                                  "Vehicle", initialState, "Earth" ) );
+    parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Earth", gravitational_parameter ) );
+    std::shared_ptr< EstimatableParameterSet< double > > parametersToEstimate =
+            createParametersToEstimate< double, double >( parameterNames, bodies, propagatorSettings );
+
+    LinkEnds linkEnds;
+    linkEnds[ observed_body ] = LinkEndId( "Vehicle", "" );
+    std::vector< std::shared_ptr< ObservationModelSettings > > observationSettingsList;
+    observationSettingsList.push_back( positionObservableSettings( linkEnds ) );
+
+    std::shared_ptr< OrbitDeterminationManager< double, double > > orbitDeterminationManager =
+            std::make_shared< OrbitDeterminationManager< double, double > >(
+                bodies, parametersToEstimate, observationSettingsList, propagatorSettings );
+
+    // Simulate observations from true dynamics
+    std::vector< double > observationTimes;
+    for( double time = initialTime + observationMargin; time < initialTime + 3.0 * 3600.0; time += 60.0 )
+    {
+        observationTimes.push_back( time );
+    }
+    std::vector< std::shared_ptr< ObservationSimulationSettings< double > > > measurementSimulationInput;
+    measurementSimulationInput.push_back( tabulatedObservationSimulationSettings< double >(
+                                              position_observable, linkEnds, observationTimes, observed_body ) );
+    std::shared_ptr< ObservationCollection< double, double > > simulatedObservations = simulateObservations< double, double >(
+                measurementSimulationInput, orbitDeterminationManager->getObservationSimulators( ), bodies );
+
+    // Perturb initial estimate, and define a-priori covariance
+    Eigen::VectorXd truthParameters = parametersToEstimate->getFullParameterValues< double >( );
+    Eigen::VectorXd parameterPerturbation = Eigen::VectorXd::Zero( 7 );
+    parameterPerturbation << 100.0, -50.0, 70.0, 0.1, -0.05, 0.08, 1.0E8;
+    orbitDeterminationManager->resetParameterEstimate( truthParameters + parameterPerturbation );
+
+    Eigen::VectorXd aPrioriSigmas = Eigen::VectorXd::Zero( 7 );
+    aPrioriSigmas << 1.0E3, 1.0E3, 1.0E3, 1.0, 1.0, 1.0, 1.0E9;
+    Eigen::MatrixXd aPrioriCovariance = aPrioriSigmas.cwiseProduct( aPrioriSigmas ).asDiagonal( );
+
+    // Process observations in update windows of (at most) half an hour
+    SequentialOrbitDeterminationFilter< double, double > filter(
+                orbitDeterminationManager, aPrioriCovariance, 1800.0, observationMargin );
+    Eigen::VectorXd preFitResiduals = filter.processObservations( simulatedObservations, 1.0 );
+
+    BOOST_CHECK_EQUAL( filter.getCurrentEpoch( ), observationTimes.back( ) + observationMargin );
+    BOOST_CHECK_EQUAL( preFitResiduals.rows( ), 3 * static_cast< int >( observationTimes.size( ) ) );
+    BOOST_CHECK( preFitResiduals.segment( 0, 3 ).norm( ) > 10.0 );
+    BOOST_CHECK( preFitResiduals.segment( preFitResiduals.rows( ) - 3, 3 ).norm( ) < 1.0E-2 );
+
+    // Compare final estimate to true state
+    double finalTime = filter.getCurrentEpoch( );
+    Eigen::Vector6d trueFinalState = convertKeplerianToCartesianElements(
+                propagateKeplerOrbit( initialKeplerianState, finalTime - initialTime, earthGravitationalParameter ),
+                earthGravitationalParameter );
+    Eigen::VectorXd finalEstimate = filter.getCurrentParameterEstimate( );
+    Eigen::MatrixXd finalCovariance = filter.getCurrentCovariance( );
+
+    BOOST_CHECK_SMALL( ( finalEstimate.segment( 0, 3 ) - trueFinalState.segment( 0, 3 ) ).norm( ), 1.0E-3 );
+    BOOST_CHECK_SMALL( ( finalEstimate.segment( 3, 3 ) - trueFinalState.segment( 3, 3 ) ).norm( ), 1.0E-6 );
+    BOOST_CHECK_CLOSE_FRACTION( finalEstimate( 6 ), earthGravitationalParameter, 1.0E-10 );
+    for( int i = 0; i < 7; i++ )
+    {
+        BOOST_CHECK( finalCovariance( i, i ) < aPrioriCovariance( i, i ) );
+    }
+
+    // Check that observations preceding the filter epoch are rejected, and propagate filter without observations
+    bool isExceptionCaught = false;
+    try
+    {
+        filter.processObservations( simulatedObservations, 1.0 );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+
+    filter.propagateToEpoch( finalTime + 600.0 );
+    trueFinalState = convertKeplerianToCartesianElements(
+                propagateKeplerOrbit( initialKeplerianState, finalTime + 600.0 - initialTime, earthGravitationalParameter ),
+                earthGravitationalParameter );
+    BOOST_CHECK_EQUAL( filter.getCurrentEpoch( ), finalTime + 600.0 );
+    BOOST_CHECK_SMALL( ( filter.getCurrentParameterEstimate( ).segment( 0, 3 ) - trueFinalState.segment( 0, 3 ) ).norm( ), 1.0E-3 );
+    BOOST_CHECK_EQUAL( filter.getCurrentCovariance( )( 6, 6 ), finalCovariance( 6, 6 ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
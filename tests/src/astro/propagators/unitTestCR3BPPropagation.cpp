@@ -16,6 +16,8 @@
 #include <Eigen/Core>
 
 #include "tudat/simulation/simulation.h"
+#include "tudat/astro/gravitation/jacobiEnergy.h"
+#include "tudat/astro/propagators/circularRestrictedThreeBodyPeriodicOrbits.h"
 namespace tudat
 {
 namespace unit_tests
@@ -141,6 +143,163 @@ BOOST_AUTO_TEST_CASE( testCR3BPPropagation )
     }
 }
 
+//! Test dedicated CR3BP propagator against reference states, the general propagation and finite differences
+BOOST_AUTO_TEST_CASE( testFastCR3BPPropagation )
+{
+    using namespace tudat::propagators;
+
+    // Propagate first test case of testCR3BPPropagation, and compare to reference values of Y. Liu
+    Eigen::Vector6d initialState;
+    initialState << 0.994, 0.853, 0.312, 0.195, -0.211, 0.15;
+    Eigen::Vector6d expectedFinalState;
+    expectedFinalState << -1.34313636385140, -1.54200249942130, -0.416194453794142,  -0.863033291171519,
+            1.12530842202949, 0.181821699265344;
+
+    CircularRestrictedThreeBodyPropagator referenceCasePropagator( 2.528e-5, 1.0E-13, 1.0E-13 );
+    Cr3bpPropagationResult propagationResult = referenceCasePropagator.propagateState( initialState, 0.0, 20.0 );
+    BOOST_CHECK_EQUAL( propagationResult.finalTime_, 20.0 );
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( propagationResult.finalState_( i ) - expectedFinalState( i ) ), 1.0E-10 );
+    }
+
+    // Check state derivative against general CR3BP state derivative model
+    const double massParameter = 1.21506683e-2;
+    initialState << 1.05, 0.13, 0.02, 0.2, 0.2, -0.01;
+    StateDerivativeCircularRestrictedThreeBodyProblem stateDerivativeModel( massParameter );
+    Eigen::Vector6d stateDerivativeDifference = stateDerivativeModel.computeStateDerivative( 0.0, initialState ) -
+            computeCr3bpStateDerivative( massParameter, initialState );
+    BOOST_CHECK_SMALL( stateDerivativeDifference.norm( ), 1.0E-14 );
+
+    // Check backward propagation
+    CircularRestrictedThreeBodyPropagator propagator( massParameter );
+    Eigen::Vector6d finalState = propagator.propagateState( initialState, 0.0, 5.0 ).finalState_;
+    Cr3bpPropagationResult backwardPropagationResult = propagator.propagateState( finalState, 5.0, 0.0 );
+    BOOST_CHECK_EQUAL( backwardPropagationResult.finalTime_, 0.0 );
+    BOOST_CHECK_SMALL( ( backwardPropagationResult.finalState_ - initialState ).norm( ), 1.0E-10 );
+
+    // Check closed-form state transition matrix against central differences
+    Cr3bpPropagationResult stateTransitionMatrixResult =
+            propagator.propagateStateAndTransitionMatrix( initialState, 0.0, 2.0 );
+    BOOST_CHECK_SMALL( ( stateTransitionMatrixResult.finalState_ -
+                         propagator.propagateState( initialState, 0.0, 2.0 ).finalState_ ).norm( ), 1.0E-11 );
+    Eigen::Matrix6d numericalStateTransitionMatrix;
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        Eigen::Vector6d perturbation = Eigen::Vector6d::Zero( );
+        perturbation( i ) = 1.0E-6;
+        numericalStateTransitionMatrix.col( i ) =
+                ( propagator.propagateState( initialState + perturbation, 0.0, 2.0 ).finalState_ -
+                  propagator.propagateState( initialState - perturbation, 0.0, 2.0 ).finalState_ ) / 2.0E-6;
+    }
+    BOOST_CHECK_SMALL( ( numericalStateTransitionMatrix - stateTransitionMatrixResult.stateTransitionMatrix_ ).norm( ) /
+                       stateTransitionMatrixResult.stateTransitionMatrix_.norm( ), 1.0E-8 );
+
+    // Check dense output against direct propagation to intermediate time
+    std::shared_ptr< Cr3bpDenseOutput > denseOutput = std::make_shared< Cr3bpDenseOutput >( );
+    propagator.propagateStateAndTransitionMatrix( initialState, 0.0, 2.0, denseOutput );
+    BOOST_CHECK_EQUAL( denseOutput->getNodeTimes( ).front( ), 0.0 );
+    BOOST_CHECK_EQUAL( denseOutput->getNodeTimes( ).back( ), 2.0 );
+    BOOST_CHECK_SMALL( ( denseOutput->interpolateState( 1.234 ) -
+                         propagator.propagateState( initialState, 0.0, 1.234 ).finalState_ ).norm( ), 1.0E-6 );
+    BOOST_CHECK_SMALL( ( denseOutput->interpolateStateTransitionMatrix( 2.0 ) -
+                         stateTransitionMatrixResult.stateTransitionMatrix_ ).norm( ), 1.0E-12 );
+    BOOST_CHECK_THROW( denseOutput->interpolateState( 2.5 ), std::runtime_error );
+
+    // Check plane crossing detection
+    Cr3bpPropagationResult crossingResult = propagator.propagateToCrossing( initialState, 0.0, 20.0, 2, 1, false );
+    BOOST_CHECK( crossingResult.isCrossingDetected_ );
+    BOOST_CHECK_SMALL( crossingResult.finalState_( 2 ), 1.0E-14 );
+    BOOST_CHECK_SMALL( ( crossingResult.finalState_ - propagator.propagateState(
+                             initialState, 0.0, crossingResult.finalTime_ ).finalState_ ).norm( ), 1.0E-11 );
+}
+
+//! Test differential correction, continuation and manifolds of CR3BP periodic orbits in the Earth-Moon system
+BOOST_AUTO_TEST_CASE( testCR3BPPeriodicOrbits )
+{
+    using namespace tudat::propagators;
+
+    const double massParameter = 1.21506683e-2;
+    CircularRestrictedThreeBodyPropagator propagator( massParameter );
+
+    // Check libration point positions against equilibrium condition
+    for( int librationPoint = 1; librationPoint <= 3; librationPoint++ )
+    {
+        Eigen::Vector6d librationPointState = Eigen::Vector6d::Zero( );
+        librationPointState( 0 ) = computeCr3bpCollinearLibrationPointPosition( massParameter, librationPoint );
+        BOOST_CHECK_SMALL( computeCr3bpStateDerivative( massParameter, librationPointState ).norm( ), 1.0E-14 );
+    }
+    const double l1Position = computeCr3bpCollinearLibrationPointPosition( massParameter, 1 );
+    BOOST_CHECK( l1Position > 0.83 && l1Position < 0.84 );
+
+    // Correct planar Lyapunov orbit around L1
+    Eigen::Vector6d lyapunovInitialStateGuess;
+    lyapunovInitialStateGuess << l1Position - 0.01, 0.0, 0.0, 0.0, 0.09, 0.0;
+    Cr3bpPeriodicOrbit lyapunovOrbit = correctSymmetricCr3bpPeriodicOrbit(
+                propagator, lyapunovInitialStateGuess, fix_initial_x_position );
+    BOOST_CHECK_EQUAL( lyapunovOrbit.initialState_( 0 ), lyapunovInitialStateGuess( 0 ) );
+    BOOST_CHECK_SMALL( lyapunovOrbit.initialState_( 2 ), std::numeric_limits< double >::min( ) );
+
+    Eigen::Vector6d finalLyapunovState = propagator.propagateState(
+                lyapunovOrbit.initialState_, 0.0, lyapunovOrbit.period_ ).finalState_;
+    BOOST_CHECK_SMALL( ( finalLyapunovState - lyapunovOrbit.initialState_ ).norm( ), 1.0E-9 );
+    BOOST_CHECK_SMALL( gravitation::computeJacobiEnergy( massParameter, finalLyapunovState ) -
+                       lyapunovOrbit.jacobiEnergy_, 1.0E-11 );
+
+    // Monodromy matrix is symplectic, and L1 Lyapunov orbits are highly unstable
+    BOOST_CHECK_CLOSE_FRACTION( lyapunovOrbit.monodromyMatrix_.determinant( ), 1.0, 1.0E-6 );
+    BOOST_CHECK( computeCr3bpStabilityIndex( lyapunovOrbit ) > 100.0 );
+
+    // Continue Lyapunov family, and check that the energy decreases monotonically with increasing amplitude
+    std::vector< Cr3bpPeriodicOrbit > lyapunovFamily = continueSymmetricCr3bpPeriodicOrbitFamily(
+                propagator, lyapunovInitialStateGuess, fix_initial_x_position, -0.001, 10 );
+    BOOST_CHECK_EQUAL( lyapunovFamily.size( ), 10 );
+    for( unsigned int i = 1; i < lyapunovFamily.size( ); i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( lyapunovFamily.at( i ).initialState_( 0 ),
+                                    lyapunovInitialStateGuess( 0 ) - 0.001 * static_cast< double >( i ), 1.0E-12 );
+        BOOST_CHECK( lyapunovFamily.at( i ).jacobiEnergy_ < lyapunovFamily.at( i - 1 ).jacobiEnergy_ );
+    }
+
+    // Correct and continue southern L1 halo family, with fixed out-of-plane amplitude
+    Eigen::Vector6d haloInitialStateGuess;
+    haloInitialStateGuess << 0.8234, 0.0, -0.0224, 0.0, 0.1343, 0.0;
+    std::vector< Cr3bpPeriodicOrbit > haloFamily = continueSymmetricCr3bpPeriodicOrbitFamily(
+                propagator, haloInitialStateGuess, fix_initial_z_position, -0.005, 5 );
+    BOOST_CHECK_EQUAL( haloFamily.size( ), 5 );
+    for( unsigned int i = 0; i < haloFamily.size( ); i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( haloFamily.at( i ).initialState_( 2 ),
+                                    haloInitialStateGuess( 2 ) - 0.005 * static_cast< double >( i ), 1.0E-12 );
+        Eigen::Vector6d finalHaloState = propagator.propagateState(
+                    haloFamily.at( i ).initialState_, 0.0, haloFamily.at( i ).period_ ).finalState_;
+        BOOST_CHECK_SMALL( ( finalHaloState - haloFamily.at( i ).initialState_ ).norm( ), 1.0E-9 );
+    }
+
+    // Check manifold initial states: displaced from the orbit by the perturbation size, along the mapped eigenvector
+    std::vector< Eigen::Vector6d > unstableManifoldStates = computeCr3bpManifoldInitialStates(
+                propagator, lyapunovOrbit, 8, 1.0E-6, true, true );
+    std::vector< Eigen::Vector6d > stableManifoldStates = computeCr3bpManifoldInitialStates(
+                propagator, lyapunovOrbit, 8, 1.0E-6, false, false );
+    BOOST_CHECK_EQUAL( unstableManifoldStates.size( ), 8 );
+    for( unsigned int i = 0; i < unstableManifoldStates.size( ); i++ )
+    {
+        Eigen::Vector6d orbitState = propagator.propagateState(
+                    lyapunovOrbit.initialState_, 0.0, lyapunovOrbit.period_ * static_cast< double >( i ) / 8.0 ).finalState_;
+        BOOST_CHECK_CLOSE_FRACTION( ( unstableManifoldStates.at( i ) - orbitState ).segment( 0, 3 ).norm( ),
+                                    1.0E-6, 1.0E-6 );
+        BOOST_CHECK_CLOSE_FRACTION( ( stableManifoldStates.at( i ) - orbitState ).segment( 0, 3 ).norm( ),
+                                    1.0E-6, 1.0E-6 );
+    }
+
+    // Perturbation along unstable direction grows by the unstable eigenvalue over one period
+    Eigen::Vector6d perturbedFinalState = propagator.propagateState(
+                unstableManifoldStates.at( 0 ), 0.0, lyapunovOrbit.period_ ).finalState_;
+    const double unstableEigenvalue = 2.0 * computeCr3bpStabilityIndex( lyapunovOrbit );
+    BOOST_CHECK_CLOSE_FRACTION( ( perturbedFinalState - lyapunovOrbit.initialState_ ).segment( 0, 3 ).norm( ),
+                                1.0E-6 * unstableEigenvalue, 1.0E-2 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -0,0 +1,118 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <map>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/testMacros.h"
+#include "tudat/math/interpolators/lagrangeInterpolator.h"
+#include "tudat/astro/propagators/propagateCovariance.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::propagators;
+using namespace tudat::interpolators;
+
+BOOST_AUTO_TEST_SUITE( test_covariance_propagation )
+
+//! Test whether batched covariance propagation (full state and marginal blocks) reproduces the per-epoch propagation
+BOOST_AUTO_TEST_CASE( testBatchedCovariancePropagation )
+{
+    const int stateSize = 6;
+    const int numberOfParameters = 8;
+
+    // Create (arbitrary) state transition and sensitivity matrix histories
+    std::srand( 42 );
+    std::map< double, Eigen::MatrixXd > stateTransitionMatrixHistory, sensitivityMatrixHistory;
+    for( int i = 0; i < 50; i++ )
+    {
+        double currentTime = 100.0 * static_cast< double >( i );
+        stateTransitionMatrixHistory[ currentTime ] = Eigen::MatrixXd::Identity( stateSize, stateSize ) +
+                0.01 * static_cast< double >( i ) * Eigen::MatrixXd::Random( stateSize, stateSize );
+        sensitivityMatrixHistory[ currentTime ] =
+                0.01 * static_cast< double >( i ) * Eigen::MatrixXd::Random( stateSize, numberOfParameters - stateSize );
+    }
+    std::shared_ptr< CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionInterface =
+            std::make_shared< SingleArcCombinedStateTransitionAndSensitivityMatrixInterface >(
+                std::make_shared< LagrangeInterpolator< double, Eigen::MatrixXd > >( stateTransitionMatrixHistory, 8 ),
+                std::make_shared< LagrangeInterpolator< double, Eigen::MatrixXd > >( sensitivityMatrixHistory, 8 ),
+                stateSize, numberOfParameters, std::vector< std::pair< int, int > >( ) );
+
+    // Define initial covariance
+    Eigen::MatrixXd randomMatrix = Eigen::MatrixXd::Random( numberOfParameters, numberOfParameters );
+    Eigen::MatrixXd initialCovariance = randomMatrix * randomMatrix.transpose( );
+
+    std::vector< double > evaluationTimes;
+    for( int i = 0; i < 37; i++ )
+    {
+        evaluationTimes.push_back( 1000.0 + 75.0 * static_cast< double >( i ) );
+    }
+
+    // Propagate covariance per epoch
+    std::map< double, Eigen::MatrixXd > propagatedCovariance;
+    propagateCovariance( propagatedCovariance, initialCovariance, stateTransitionInterface, evaluationTimes );
+    BOOST_CHECK_EQUAL( propagatedCovariance.size( ), evaluationTimes.size( ) );
+
+    for( int numberOfThreads = 1; numberOfThreads < 5; numberOfThreads += 3 )
+    {
+        // Check per-epoch propagation distributed over threads
+        std::map< double, Eigen::MatrixXd > parallelPropagatedCovariance;
+        propagateCovariance( parallelPropagatedCovariance, initialCovariance, stateTransitionInterface, evaluationTimes,
+                             numberOfThreads );
+
+        // Propagate full covariance, and marginal covariance of velocity and first position component
+        Eigen::MatrixXd fullCovariances, blockCovariances;
+        propagateCovarianceAtEpochs( fullCovariances, initialCovariance, stateTransitionInterface, evaluationTimes,
+                                     std::vector< std::pair< int, int > >( ), numberOfThreads );
+        propagateCovarianceAtEpochs( blockCovariances, initialCovariance, stateTransitionInterface, evaluationTimes,
+                                     { std::make_pair( 3, 3 ), std::make_pair( 0, 1 ) }, numberOfThreads );
+
+        BOOST_CHECK_EQUAL( fullCovariances.rows( ), stateSize );
+        BOOST_CHECK_EQUAL( fullCovariances.cols( ), stateSize * static_cast< int >( evaluationTimes.size( ) ) );
+        BOOST_CHECK_EQUAL( blockCovariances.rows( ), 4 );
+        BOOST_CHECK_EQUAL( blockCovariances.cols( ), 4 * static_cast< int >( evaluationTimes.size( ) ) );
+
+        std::vector< int > blockIndices = { 3, 4, 5, 0 };
+        for( unsigned int i = 0; i < evaluationTimes.size( ); i++ )
+        {
+            Eigen::MatrixXd expectedCovariance = propagatedCovariance.at( evaluationTimes.at( i ) );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                        parallelPropagatedCovariance.at( evaluationTimes.at( i ) ), expectedCovariance, 1.0E-14 );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                        fullCovariances.block( 0, i * stateSize, stateSize, stateSize ), expectedCovariance, 1.0E-14 );
+
+            Eigen::MatrixXd expectedBlockCovariance = Eigen::MatrixXd( 4, 4 );
+            for( int j = 0; j < 4; j++ )
+            {
+                for( int k = 0; k < 4; k++ )
+                {
+                    expectedBlockCovariance( j, k ) = expectedCovariance( blockIndices.at( j ), blockIndices.at( k ) );
+                }
+            }
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                        blockCovariances.block( 0, i * 4, 4, 4 ), expectedBlockCovariance, 1.0E-12 );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -16,6 +16,7 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include "tudat/basics/allocationCounter.h"
 #include "tudat/math/basic/linearAlgebra.h"
 #include "tudat/astro/basic_astro/physicalConstants.h"
 #include "tudat/astro/basic_astro/orbitalElementConversions.h"
@@ -508,6 +509,85 @@ BOOST_AUTO_TEST_CASE( testCowellPropagatorKeplerCompare )
 
 }
 
+//! Test whether the steady-state evaluation of the state derivative is free of heap allocations
+BOOST_AUTO_TEST_CASE( testCowellStateDerivativeSteadyStateAllocations )
+{
+    // Create bodies with constant ephemerides
+    SystemOfBodies bodies;
+    bodies.createEmptyBody( "Earth" );
+    bodies.createEmptyBody( "Moon" );
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.at( "Earth" )->setEphemeris( std::make_shared< ConstantEphemeris >(
+                                            [ ]( ){ return Eigen::Vector6d::Zero( ); }, "SSB", "ECLIPJ2000" ) );
+    bodies.at( "Moon" )->setEphemeris( std::make_shared< ConstantEphemeris >(
+                                           [ ]( ){ return ( Eigen::Vector6d( ) << 3.8E8, 0.0, 0.0, 0.0, 1.0E3, 0.0 ).finished( ); },
+                                           "SSB", "ECLIPJ2000" ) );
+
+    // Create point mass gravity fields of Earth and Moon.
+    bodies.at( "Earth" )->setGravityFieldModel( std::make_shared< gravitation::GravityFieldModel >( 3.986004418E14 ) );
+    bodies.at( "Moon" )->setGravityFieldModel( std::make_shared< gravitation::GravityFieldModel >( 4.9028E12 ) );
+    bodies.at( "Vehicle" )->setConstantBodyMass( 500.0 );
+
+    // Create accelerations and propagation settings
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back( pointMassGravityAcceleration( ) );
+    accelerationSettings[ "Vehicle" ][ "Moon" ].push_back( pointMassGravityAcceleration( ) );
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodies, accelerationSettings, { "Vehicle" }, { "Earth" } );
+
+    Eigen::Vector6d initialState;
+    initialState << 7.0E6, 0.0, 0.0, 0.0, 7.5E3, 1.0E3;
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            translationalStatePropagatorSettings< double >(
+                { "Earth" }, accelerationModelMap, { "Vehicle" }, initialState, 0.0,
+                rungeKuttaFixedStepSettings( 10.0, CoefficientSets::rungeKutta4Classic ),
+                propagationTimeTerminationSettings( 100.0 ) );
+
+    // Create simulator, and retrieve state derivative model
+    SingleArcDynamicsSimulator< double, double > dynamicsSimulator( bodies, propagatorSettings );
+    std::shared_ptr< DynamicsStateDerivativeModel< double, double > > stateDerivativeModel =
+            dynamicsSimulator.getDynamicsStateDerivative( );
+    std::map< double, Eigen::VectorXd > propagatedStates = dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+
+    // Evaluate state derivative a number of times, to let all internal buffers reach their final size
+    Eigen::MatrixXd currentState = initialState;
+    for( unsigned int i = 0; i < 10; i++ )
+    {
+        stateDerivativeModel->evaluateStateDerivative( static_cast< double >( i ), currentState );
+    }
+    stateDerivativeModel->resetCumulativeFunctionEvaluationCounter( );
+
+    // Evaluate state derivative in steady state, and count heap allocations
+    Eigen::MatrixXd computedStateDerivative = Eigen::MatrixXd::Zero( 6, 1 );
+    long long numberOfAllocations = 0;
+    {
+        utilities::ScopedAllocationCounter allocationCounter;
+        for( unsigned int i = 0; i < 10; i++ )
+        {
+            computedStateDerivative = stateDerivativeModel->evaluateStateDerivative(
+                        20.0 + static_cast< double >( i ), currentState );
+        }
+        numberOfAllocations = allocationCounter.getNumberOfAllocations( );
+    }
+
+    // Check computed state derivative against point mass (and third-body) accelerations
+    Eigen::Vector3d vehiclePosition = initialState.segment< 3 >( 0 );
+    Eigen::Vector3d moonPosition = Eigen::Vector3d::UnitX( ) * 3.8E8;
+    Eigen::Vector3d expectedAcceleration =
+            -3.986004418E14 * vehiclePosition / std::pow( vehiclePosition.norm( ), 3.0 ) -
+            4.9028E12 * ( ( vehiclePosition - moonPosition ) / std::pow( ( vehiclePosition - moonPosition ).norm( ), 3.0 ) +
+                          moonPosition / std::pow( moonPosition.norm( ), 3.0 ) );
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_EQUAL( computedStateDerivative( i ), initialState( i + 3 ) );
+        BOOST_CHECK_SMALL( computedStateDerivative( i + 3 ) - expectedAcceleration( i ), 1.0E-14 * expectedAcceleration.norm( ) );
+    }
+    BOOST_CHECK_EQUAL( stateDerivativeModel->getCumulativeNumberOfFunctionEvaluations( ).size( ), 10 );
+
+    // Check that no heap allocations were made (trivially satisfied if Tudat is not compiled with allocation counting)
+    BOOST_CHECK_EQUAL( numberOfAllocations, 0 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 
@@ -678,6 +678,114 @@ BOOST_AUTO_TEST_CASE( testEnckePopagatorForHighEccentricities )
 
 }
 
+//! Test if Encke propagator rectifies its reference orbit for a strongly perturbed orbit, by comparing the results (both
+//! in forward and backward propagation) to those of the Cowell propagator, and check the reference orbit computation.
+BOOST_AUTO_TEST_CASE( testEnckePropagatorRectification )
+{
+    using namespace tudat;
+    using namespace simulation_setup;
+    using namespace propagators;
+    using namespace numerical_integrators;
+    using namespace orbital_element_conversions;
+
+    // Create point-mass Earth and vehicle
+    double earthGravitationalParameter = 3.986004418E14;
+    BodyListSettings bodySettings = BodyListSettings( "SSB", "J2000" );
+    bodySettings.addSettings( "Earth" );
+    bodySettings.at( "Earth" )->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >(
+                Eigen::Vector6d::Zero( ), "SSB", "J2000" );
+    bodySettings.at( "Earth" )->gravityFieldSettings = centralGravitySettings( earthGravitationalParameter );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+    bodies.createEmptyBody( "Vehicle" );
+
+    // Add large along-track acceleration, so that vehicle deviates strongly from initial Kepler orbit
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back( pointMassGravityAcceleration( ) );
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back( empiricalAcceleration( Eigen::Vector3d( 0.0, 1.0E-3, 0.0 ) ) );
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodies, accelerationMap, { "Vehicle" }, { "Earth" } );
+
+    Eigen::Vector6d initialKeplerianState;
+    initialKeplerianState << 7200.0E3, 0.05, 1.2, 0.3, 2.1, 0.4;
+    Eigen::VectorXd initialState = convertKeplerianToCartesianElements(
+                initialKeplerianState, earthGravitationalParameter );
+
+    for( int testCase = 0; testCase < 2; testCase++ )
+    {
+        // Propagate forward (test case 0) or backward (test case 1)
+        double finalTime = ( testCase == 0 ) ? 86400.0 : -86400.0;
+        double timeStep = ( testCase == 0 ) ? 10.0 : -10.0;
+
+        std::map< TranslationalPropagatorType, std::map< double, Eigen::VectorXd > > stateHistories;
+        for( TranslationalPropagatorType propagatorType : { cowell, encke } )
+        {
+            std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                    std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                        std::vector< std::string >( { "Earth" } ), accelerationModelMap,
+                        std::vector< std::string >( { "Vehicle" } ), initialState, 0.0,
+                        rungeKuttaFixedStepSettings( timeStep, CoefficientSets::rungeKuttaFehlberg78 ),
+                        std::make_shared< PropagationTimeTerminationSettings >( finalTime ), propagatorType );
+
+            SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+            stateHistories[ propagatorType ] = dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+
+            // Check that reference orbit has been rectified
+            if( propagatorType == encke )
+            {
+                std::shared_ptr< NBodyEnckeStateDerivative< double, double > > enckeStateDerivative =
+                        std::dynamic_pointer_cast< NBodyEnckeStateDerivative< double, double > >(
+                            dynamicsSimulator.getDynamicsStateDerivative( )->getStateDerivativeModels( ).at(
+                                translational_state ).at( 0 ) );
+                BOOST_CHECK( enckeStateDerivative->getNumberOfRectifications( ) > 1 );
+
+                // Check that deviation from reference orbit remains bounded
+                std::map< double, Eigen::VectorXd > rawStateHistory =
+                        dynamicsSimulator.getEquationsOfMotionNumericalSolutionRaw( );
+                for( auto stateIterator : rawStateHistory )
+                {
+                    BOOST_CHECK_SMALL( stateIterator.second.segment( 0, 3 ).norm( ), 0.02 * 8000.0E3 );
+                }
+            }
+        }
+
+        // Compare Encke and Cowell results
+        BOOST_CHECK_EQUAL( stateHistories.at( cowell ).size( ), stateHistories.at( encke ).size( ) );
+        for( auto stateIterator : stateHistories.at( cowell ) )
+        {
+            Eigen::VectorXd stateDifference = stateIterator.second - stateHistories.at( encke ).at( stateIterator.first );
+            BOOST_CHECK_SMALL( stateDifference.segment( 0, 3 ).norm( ), 1.0E-3 );
+            BOOST_CHECK_SMALL( stateDifference.segment( 3, 3 ).norm( ), 1.0E-6 );
+        }
+        BOOST_CHECK( ( stateHistories.at( cowell ).rbegin( )->second.segment( 0, 3 ) -
+                       convertKeplerianToCartesianElements(
+                           propagateKeplerOrbit( initialKeplerianState, finalTime, earthGravitationalParameter ),
+                           earthGravitationalParameter ).segment( 0, 3 ) ).norm( ) > 1.0E5 );
+    }
+
+    // Compare reference orbit to Kepler propagator
+    std::shared_ptr< root_finders::RootFinder< double > > rootFinder = root_finders::createRootFinder< double >(
+                root_finders::newtonRaphsonRootFinderSettings(
+                    TUDAT_NAN, 5.0 * std::numeric_limits< double >::epsilon( ), TUDAT_NAN, 50, root_finders::accept_result ) );
+    for( double eccentricity : { 0.0, 0.3, 0.95, 1.5 } )
+    {
+        Eigen::Vector6d keplerianState = initialKeplerianState;
+        keplerianState( semiMajorAxisIndex ) = 7200.0E3 / ( 1.0 - eccentricity );
+        keplerianState( eccentricityIndex ) = eccentricity;
+
+        EnckeReferenceOrbit< double, double > referenceOrbit( keplerianState, 100.0, earthGravitationalParameter );
+        Eigen::Vector6d referenceOrbitState;
+        for( double time = -5000.0; time < 5000.0; time += 37.0 )
+        {
+            referenceOrbit.computeCartesianState( time, rootFinder, referenceOrbitState );
+            Eigen::Vector6d expectedState = convertKeplerianToCartesianElements(
+                        propagateKeplerOrbit( keplerianState, time - 100.0, earthGravitationalParameter, rootFinder ),
+                        earthGravitationalParameter );
+            BOOST_CHECK_SMALL( ( referenceOrbitState - expectedState ).segment( 0, 3 ).norm( ), 1.0E-5 );
+            BOOST_CHECK_SMALL( ( referenceOrbitState - expectedState ).segment( 3, 3 ).norm( ), 1.0E-8 );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 
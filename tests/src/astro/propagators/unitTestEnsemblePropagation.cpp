@@ -0,0 +1,533 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <algorithm>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/astro/basic_astro/orbitalElementConversions.h"
+#include "tudat/astro/ephemerides/tabulatedEphemeris.h"
+#include "tudat/math/interpolators/createInterpolator.h"
+#include "tudat/math/statistics/basicStatistics.h"
+#include "tudat/simulation/environment_setup/createBodies.h"
+#include "tudat/simulation/estimation_setup/createEstimatableParameters.h"
+#include "tudat/simulation/propagation_setup/createAccelerationModels.h"
+#include "tudat/simulation/propagation_setup/deviceEnsembleDynamicsSimulator.h"
+#include "tudat/simulation/propagation_setup/ensembleDynamicsSimulator.h"
+#include "tudat/simulation/propagation_setup/ensembleStatistics.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace numerical_integrators;
+using namespace simulation_setup;
+using namespace propagators;
+
+BOOST_AUTO_TEST_SUITE( test_ensemble_propagation )
+
+// Create environment with point-mass Earth and an empty vehicle
+SystemOfBodies createEnsembleTestBodies( )
+{
+    BodyListSettings bodySettings = BodyListSettings( "Earth", "ECLIPJ2000" );
+    bodySettings.addSettings( "Earth" );
+    bodySettings.at( "Earth" )->ephemerisSettings = constantEphemerisSettings( Eigen::Vector6d::Zero( ), "SSB" );
+    bodySettings.at( "Earth" )->gravityFieldSettings = centralGravitySettings( 3.986004418E14 );
+
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.at( "Vehicle" )->setConstantBodyMass( 1000.0 );
+    return bodies;
+}
+
+// Create propagator settings, with a custom acceleration that depends on the (member-specific) vehicle mass
+std::shared_ptr< SingleArcPropagatorSettings< double > > createEnsembleTestPropagatorSettings(
+        const SystemOfBodies& bodies )
+{
+    std::shared_ptr< Body > vehicle = bodies.at( "Vehicle" );
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back( pointMassGravityAcceleration( ) );
+    accelerationSettings[ "Vehicle" ][ "Vehicle" ].push_back(
+                customAccelerationSettings( [ = ]( const double ){ return
+                    Eigen::Vector3d::UnitZ( ) * 1.0 / vehicle->getBodyMass( ); } ) );
+
+    basic_astrodynamics::AccelerationMap accelerationModels = createAccelerationModelsMap(
+                bodies, accelerationSettings, { "Vehicle" }, { "Earth" } );
+
+    return translationalStatePropagatorSettings< double >(
+                { "Earth" }, accelerationModels, { "Vehicle" }, Eigen::Vector6d::Zero( ), 0.0,
+                rungeKuttaVariableStepSettingsScalarTolerances(
+                    10.0, CoefficientSets::rungeKuttaFehlberg78, 1.0E-4, 1.0E4, 1.0E-12, 1.0E-12 ),
+                propagationTimeTerminationSettings( 86400.0 ) );
+}
+
+void setMemberMass( const int memberIndex, const SystemOfBodies& bodies )
+{
+    bodies.at( "Vehicle" )->setConstantBodyMass( 100.0 + 10.0 * static_cast< double >( memberIndex ) );
+}
+
+//! Test if ensemble propagation, on a single and on multiple threads, reproduces separate propagations exactly
+BOOST_AUTO_TEST_CASE( testEnsemblePropagation )
+{
+    // Create member initial states, one row per member
+    int numberOfMembers = 7;
+    Eigen::MatrixXd memberInitialStates = Eigen::MatrixXd::Zero( numberOfMembers, 6 );
+    for( int i = 0; i < numberOfMembers; i++ )
+    {
+        Eigen::Vector6d initialKeplerElements;
+        initialKeplerElements << 7000.0E3 + 100.0E3 * i, 0.01 * i, 0.1 * i, 0.2, 0.3, 0.4;
+        memberInitialStates.row( i ) = orbital_element_conversions::convertKeplerianToCartesianElements(
+                    initialKeplerElements, 3.986004418E14 ).transpose( );
+    }
+
+    // Propagate each member with a separate dynamics simulator
+    std::vector< std::map< double, Eigen::VectorXd > > separateResults;
+    for( int i = 0; i < numberOfMembers; i++ )
+    {
+        SystemOfBodies bodies = createEnsembleTestBodies( );
+        setMemberMass( i, bodies );
+        std::shared_ptr< SingleArcPropagatorSettings< double > > propagatorSettings =
+                createEnsembleTestPropagatorSettings( bodies );
+        propagatorSettings->resetInitialStates( memberInitialStates.row( i ).transpose( ) );
+        SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+        separateResults.push_back( dynamicsSimulator.getEquationsOfMotionNumericalSolution( ) );
+    }
+
+    for( int numberOfWorkers = 1; numberOfWorkers <= 3; numberOfWorkers++ )
+    {
+        // Create ensemble simulator
+        std::vector< SystemOfBodies > workerBodies;
+        std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > workerPropagatorSettings;
+        for( int i = 0; i < numberOfWorkers; i++ )
+        {
+            workerBodies.push_back( createEnsembleTestBodies( ) );
+            workerPropagatorSettings.push_back( createEnsembleTestPropagatorSettings( workerBodies.at( i ) ) );
+        }
+        EnsembleDynamicsSimulator< > ensembleSimulator( workerBodies, workerPropagatorSettings, &setMemberMass );
+        BOOST_CHECK_EQUAL( ensembleSimulator.getNumberOfWorkers( ), numberOfWorkers );
+
+        // Propagate twice, to check that reuse of the environment does not modify the results
+        for( int propagationIndex = 0; propagationIndex < 2; propagationIndex++ )
+        {
+            ensembleSimulator.propagateEnsemble( memberInitialStates );
+
+            std::vector< std::shared_ptr< SingleArcSimulationResults< double, double > > > memberResults =
+                    ensembleSimulator.getMemberResults( );
+            BOOST_CHECK_EQUAL( static_cast< int >( memberResults.size( ) ), numberOfMembers );
+
+            for( int i = 0; i < numberOfMembers; i++ )
+            {
+                BOOST_CHECK( memberResults.at( i )->integrationCompletedSuccessfully( ) );
+
+                std::map< double, Eigen::VectorXd > currentResults = memberResults.at( i )->getEquationsOfMotionNumericalSolution( );
+                BOOST_CHECK_EQUAL( currentResults.size( ), separateResults.at( i ).size( ) );
+
+                auto separateResultIterator = separateResults.at( i ).begin( );
+                for( auto resultIterator : currentResults )
+                {
+                    BOOST_CHECK_EQUAL( resultIterator.first, separateResultIterator->first );
+                    for( int j = 0; j < 6; j++ )
+                    {
+                        BOOST_CHECK_EQUAL( resultIterator.second( j ), separateResultIterator->second( j ) );
+                    }
+                    separateResultIterator++;
+                }
+            }
+        }
+    }
+
+    // Check that dependent environments are rejected
+    SystemOfBodies bodies = createEnsembleTestBodies( );
+    std::shared_ptr< SingleArcPropagatorSettings< double > > propagatorSettings =
+            createEnsembleTestPropagatorSettings( bodies );
+    bool isExceptionCaught = false;
+    try
+    {
+        EnsembleDynamicsSimulator< > ensembleSimulator(
+                    std::vector< SystemOfBodies >( { bodies, bodies } ),
+                    std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > >( { propagatorSettings, propagatorSettings } ) );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+}
+
+//! Test if ensemble propagation with worker environments created by SystemOfBodies::clone reproduces separate propagations
+BOOST_AUTO_TEST_CASE( testEnsemblePropagationWithClonedBodies )
+{
+    // Create environment, with a tabulated ephemeris for the vehicle
+    SystemOfBodies bodies = createEnsembleTestBodies( );
+    std::map< double, Eigen::Vector6d > tabulatedStates;
+    for( int i = 0; i < 10; i++ )
+    {
+        tabulatedStates[ 100.0 * i ] = Eigen::Vector6d::Constant( static_cast< double >( i * i ) );
+    }
+    bodies.createEmptyBody( "Tabulated" );
+    bodies.at( "Tabulated" )->setEphemeris( std::make_shared< ephemerides::TabulatedCartesianEphemeris< > >(
+                interpolators::createOneDimensionalInterpolator(
+                    tabulatedStates, std::make_shared< interpolators::LagrangeInterpolatorSettings >( 4 ) ),
+                "Earth", "ECLIPJ2000" ) );
+    bodies.processBodyFrameDefinitions( );
+
+    // Check which models are copied, and which are shared
+    SystemOfBodies clonedBodies = bodies.clone( );
+    BOOST_CHECK( !doSystemsOfBodiesShareBodies( bodies, clonedBodies ) );
+    BOOST_CHECK_EQUAL( clonedBodies.getFrameOrigin( ), bodies.getFrameOrigin( ) );
+    BOOST_CHECK_EQUAL( clonedBodies.getFrameOrientation( ), bodies.getFrameOrientation( ) );
+    BOOST_CHECK_EQUAL( clonedBodies.getMap( ).size( ), bodies.getMap( ).size( ) );
+    BOOST_CHECK( clonedBodies.at( "Earth" )->getGravityFieldModel( ) == bodies.at( "Earth" )->getGravityFieldModel( ) );
+    BOOST_CHECK( clonedBodies.at( "Tabulated" )->getEphemeris( ) != bodies.at( "Tabulated" )->getEphemeris( ) );
+
+    clonedBodies.at( "Vehicle" )->setConstantBodyMass( 250.0 );
+    BOOST_CHECK_EQUAL( clonedBodies.at( "Vehicle" )->getBodyMass( ), 250.0 );
+    BOOST_CHECK_EQUAL( bodies.at( "Vehicle" )->getBodyMass( ), 1000.0 );
+
+    for( double testTime = 150.0; testTime < 800.0; testTime += 123.0 )
+    {
+        Eigen::Vector6d originalState = bodies.at( "Tabulated" )->getEphemeris( )->getCartesianState( testTime );
+        Eigen::Vector6d clonedState = clonedBodies.at( "Tabulated" )->getEphemeris( )->getCartesianState( testTime );
+        for( int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_EQUAL( originalState( j ), clonedState( j ) );
+        }
+    }
+
+    // Create member initial states, one row per member
+    int numberOfMembers = 4;
+    Eigen::MatrixXd memberInitialStates = Eigen::MatrixXd::Zero( numberOfMembers, 6 );
+    for( int i = 0; i < numberOfMembers; i++ )
+    {
+        Eigen::Vector6d initialKeplerElements;
+        initialKeplerElements << 7000.0E3 + 100.0E3 * i, 0.01 * i, 0.1 * i, 0.2, 0.3, 0.4;
+        memberInitialStates.row( i ) = orbital_element_conversions::convertKeplerianToCartesianElements(
+                    initialKeplerElements, 3.986004418E14 ).transpose( );
+    }
+
+    // Propagate with worker environments created from a single environment
+    int numberOfWorkers = 2;
+    std::vector< SystemOfBodies > workerBodies;
+    std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > workerPropagatorSettings;
+    for( int i = 0; i < numberOfWorkers; i++ )
+    {
+        workerBodies.push_back( bodies.clone( ) );
+        workerPropagatorSettings.push_back( createEnsembleTestPropagatorSettings( workerBodies.at( i ) ) );
+    }
+    EnsembleDynamicsSimulator< > ensembleSimulator( workerBodies, workerPropagatorSettings, &setMemberMass );
+    ensembleSimulator.propagateEnsemble( memberInitialStates );
+
+    std::vector< std::shared_ptr< SingleArcSimulationResults< double, double > > > memberResults =
+            ensembleSimulator.getMemberResults( );
+    for( int i = 0; i < numberOfMembers; i++ )
+    {
+        SystemOfBodies separateBodies = createEnsembleTestBodies( );
+        setMemberMass( i, separateBodies );
+        std::shared_ptr< SingleArcPropagatorSettings< double > > propagatorSettings =
+                createEnsembleTestPropagatorSettings( separateBodies );
+        propagatorSettings->resetInitialStates( memberInitialStates.row( i ).transpose( ) );
+        SingleArcDynamicsSimulator< > dynamicsSimulator( separateBodies, propagatorSettings );
+        std::map< double, Eigen::VectorXd > separateResults = dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+
+        BOOST_CHECK( memberResults.at( i )->integrationCompletedSuccessfully( ) );
+        std::map< double, Eigen::VectorXd > currentResults = memberResults.at( i )->getEquationsOfMotionNumericalSolution( );
+        BOOST_CHECK_EQUAL( currentResults.size( ), separateResults.size( ) );
+
+        auto separateResultIterator = separateResults.begin( );
+        for( auto resultIterator : currentResults )
+        {
+            BOOST_CHECK_EQUAL( resultIterator.first, separateResultIterator->first );
+            for( int j = 0; j < 6; j++ )
+            {
+                BOOST_CHECK_EQUAL( resultIterator.second( j ), separateResultIterator->second( j ) );
+            }
+            separateResultIterator++;
+        }
+    }
+}
+
+//! Test if re-running a single simulator with new initial states, parameters and termination settings reproduces
+//! separate propagations exactly
+BOOST_AUTO_TEST_CASE( testSimulatorResetAndReuse )
+{
+    // Create single simulator, without propagating
+    SystemOfBodies reusedBodies = createEnsembleTestBodies( );
+    std::shared_ptr< SingleArcPropagatorSettings< double > > reusedPropagatorSettings =
+            createEnsembleTestPropagatorSettings( reusedBodies );
+    SingleArcDynamicsSimulator< > reusedDynamicsSimulator( reusedBodies, reusedPropagatorSettings, false );
+
+    std::vector< std::shared_ptr< estimatable_parameters::EstimatableParameterSettings > > parameterNames;
+    parameterNames.push_back( estimatable_parameters::gravitationalParameter( "Earth" ) );
+    std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > > parameterSet =
+            createParametersToEstimate< double >( parameterNames, reusedBodies );
+
+    for( int i = 0; i < 4; i++ )
+    {
+        // Define sample
+        Eigen::Vector6d initialKeplerElements;
+        initialKeplerElements << 7000.0E3 + 100.0E3 * i, 0.01 * i, 0.1 * i, 0.2, 0.3, 0.4;
+        Eigen::Vector6d initialState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                    initialKeplerElements, 3.986004418E14 );
+        double gravitationalParameter = 3.986004418E14 * ( 1.0 + 1.0E-3 * i );
+        double finalTime = 3600.0 * ( i + 1 );
+
+        // Re-run single simulator
+        reusedDynamicsSimulator.resetAndIntegrateEquationsOfMotion(
+                    initialState, parameterSet, ( Eigen::VectorXd( 1 ) << gravitationalParameter ).finished( ),
+                    propagationTimeTerminationSettings( finalTime ) );
+        std::map< double, Eigen::VectorXd > reusedResults = reusedDynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+
+        // Propagate with new simulator
+        SystemOfBodies bodies = createEnsembleTestBodies( );
+        bodies.at( "Earth" )->getGravityFieldModel( )->resetGravitationalParameter( gravitationalParameter );
+        std::shared_ptr< SingleArcPropagatorSettings< double > > propagatorSettings =
+                createEnsembleTestPropagatorSettings( bodies );
+        propagatorSettings->resetInitialStates( initialState );
+        propagatorSettings->resetTerminationSettings( propagationTimeTerminationSettings( finalTime ) );
+        SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+        std::map< double, Eigen::VectorXd > separateResults = dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+
+        // Compare results
+        BOOST_CHECK_EQUAL( reusedResults.size( ), separateResults.size( ) );
+        BOOST_CHECK( reusedResults.rbegin( )->first >= finalTime );
+        auto separateResultIterator = separateResults.begin( );
+        for( auto resultIterator : reusedResults )
+        {
+            BOOST_CHECK_EQUAL( resultIterator.first, separateResultIterator->first );
+            for( int j = 0; j < 6; j++ )
+            {
+                BOOST_CHECK_EQUAL( resultIterator.second( j ), separateResultIterator->second( j ) );
+            }
+            separateResultIterator++;
+        }
+    }
+}
+
+//! Test if device ensemble propagation (or its host fallback) reproduces the propagation with the regular dynamics
+//! simulator, and rejects unsupported models
+BOOST_AUTO_TEST_CASE( testDeviceEnsemblePropagation )
+{
+    // Create environment with point-mass Earth and Moon
+    BodyListSettings bodySettings = BodyListSettings( "Earth", "ECLIPJ2000" );
+    bodySettings.addSettings( "Earth" );
+    bodySettings.at( "Earth" )->ephemerisSettings = constantEphemerisSettings( Eigen::Vector6d::Zero( ), "SSB" );
+    bodySettings.at( "Earth" )->gravityFieldSettings = centralGravitySettings( 3.986004418E14 );
+    bodySettings.addSettings( "Moon" );
+    Eigen::Vector6d moonKeplerElements;
+    moonKeplerElements << 384400.0E3, 0.0549, 0.09, 0.1, 0.2, 0.3;
+    bodySettings.at( "Moon" )->ephemerisSettings = keplerEphemerisSettings(
+                moonKeplerElements, 0.0, 3.986004418E14 + 4.9028E12, "Earth" );
+    bodySettings.at( "Moon" )->gravityFieldSettings = centralGravitySettings( 4.9028E12 );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.at( "Vehicle" )->setConstantBodyMass( 1000.0 );
+
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back( pointMassGravityAcceleration( ) );
+    accelerationSettings[ "Vehicle" ][ "Moon" ].push_back( pointMassGravityAcceleration( ) );
+
+    double finalTime = 86400.0;
+    double outputTimeStep = 600.0;
+    std::shared_ptr< IntegratorSettings< double > > integratorSettings = rungeKutta4Settings< double >( 10.0 );
+
+    // Create device simulator, and check output epochs and tabulated bodies
+    DeviceEnsembleDynamicsSimulator deviceSimulator(
+                bodies, accelerationSettings, "Vehicle", "Earth", integratorSettings, 0.0,
+                propagationTimeTerminationSettings( finalTime ), outputTimeStep );
+    BOOST_CHECK_EQUAL( deviceSimulator.getOutputEpochs( ).size( ), 145 );
+    BOOST_CHECK_EQUAL( deviceSimulator.getOutputEpochs( ).back( ), finalTime );
+    BOOST_CHECK_EQUAL( deviceSimulator.getTabulatedBodies( ).size( ), 1 );
+    BOOST_CHECK_EQUAL( deviceSimulator.getTabulatedBodies( ).at( 0 ), "Moon" );
+    BOOST_CHECK_EQUAL( deviceSimulator.getDeviceDynamicsModel( ).centralBodyGravitationalParameter, 3.986004418E14 );
+
+    // Create member initial states, one row per member
+    int numberOfMembers = 5;
+    Eigen::MatrixXd memberInitialStates = Eigen::MatrixXd::Zero( numberOfMembers, 6 );
+    for( int i = 0; i < numberOfMembers; i++ )
+    {
+        Eigen::Vector6d initialKeplerElements;
+        initialKeplerElements << 7000.0E3 + 1000.0E3 * i, 0.01 * i, 0.1 * i, 0.2, 0.3, 0.4;
+        memberInitialStates.row( i ) = orbital_element_conversions::convertKeplerianToCartesianElements(
+                    initialKeplerElements, 3.986004418E14 ).transpose( );
+    }
+
+    // Propagate ensemble (on a CUDA device if available, on the host otherwise)
+    std::shared_ptr< DeviceEnsemblePropagationResults > deviceResults =
+            deviceSimulator.propagateEnsemble( memberInitialStates );
+    BOOST_CHECK( deviceResults->integrationCompletedSuccessfully( ) );
+    BOOST_CHECK_EQUAL( deviceResults->getNumberOfMembers( ), numberOfMembers );
+
+    for( int i = 0; i < numberOfMembers; i++ )
+    {
+        // Propagate member with regular dynamics simulator, using the same integrator
+        basic_astrodynamics::AccelerationMap accelerationModels = createAccelerationModelsMap(
+                    bodies, accelerationSettings, { "Vehicle" }, { "Earth" } );
+        std::shared_ptr< SingleArcPropagatorSettings< double > > propagatorSettings =
+                translationalStatePropagatorSettings< double >(
+                    { "Earth" }, accelerationModels, { "Vehicle" }, memberInitialStates.row( i ).transpose( ), 0.0,
+                    integratorSettings, propagationTimeTerminationSettings( finalTime ) );
+        SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+        std::map< double, Eigen::VectorXd > cpuResults = dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+
+        // Compare at output epochs (differences due to tabulation of Moon ephemeris only)
+        std::map< double, Eigen::VectorXd > deviceMemberResults = deviceResults->getMemberStateHistory( i );
+        BOOST_CHECK_EQUAL( deviceMemberResults.size( ), deviceSimulator.getOutputEpochs( ).size( ) );
+        for( auto resultIterator : deviceMemberResults )
+        {
+            Eigen::VectorXd stateDifference = resultIterator.second - cpuResults.at( resultIterator.first );
+            BOOST_CHECK_SMALL( stateDifference.segment( 0, 3 ).norm( ), 1.0E-3 );
+            BOOST_CHECK_SMALL( stateDifference.segment( 3, 3 ).norm( ), 1.0E-6 );
+        }
+        BOOST_CHECK_EQUAL( deviceResults->getStatesAtOutputEpoch( 0 ).row( i ), memberInitialStates.row( i ) );
+    }
+
+    // Check that propagating the members in multiple batches does not change the results
+    DeviceEnsembleDynamicsSimulator batchedDeviceSimulator(
+                bodies, accelerationSettings, "Vehicle", "Earth", integratorSettings, 0.0,
+                propagationTimeTerminationSettings( finalTime ), outputTimeStep,
+                std::make_shared< DeviceEnsemblePropagationSettings >( 300.0, 500.0, 2 ) );
+    std::shared_ptr< DeviceEnsemblePropagationResults > batchedDeviceResults =
+            batchedDeviceSimulator.propagateEnsemble( memberInitialStates );
+    BOOST_CHECK( batchedDeviceResults->getStateData( ) == deviceResults->getStateData( ) );
+    BOOST_CHECK_EQUAL( batchedDeviceResults->getNumberOfAcceptedSteps( ), deviceResults->getNumberOfAcceptedSteps( ) );
+
+    // Check that unsupported termination settings and accelerations are rejected
+    BOOST_CHECK_THROW( DeviceEnsembleDynamicsSimulator(
+                           bodies, accelerationSettings, "Vehicle", "Earth", integratorSettings, 0.0,
+                           propagationHybridTerminationSettings(
+    { propagationTimeTerminationSettings( finalTime ) }, true ), outputTimeStep ), std::runtime_error );
+
+    accelerationSettings[ "Vehicle" ][ "Vehicle" ].push_back(
+                customAccelerationSettings( [ = ]( const double ){ return Eigen::Vector3d::UnitZ( ); } ) );
+    BOOST_CHECK_THROW( DeviceEnsembleDynamicsSimulator(
+                           bodies, accelerationSettings, "Vehicle", "Earth", integratorSettings, 0.0,
+                           propagationTimeTerminationSettings( finalTime ), outputTimeStep ), std::runtime_error );
+}
+
+//! Test if the ensemble statistics accumulated during propagation reproduce the statistics of the stored member results
+BOOST_AUTO_TEST_CASE( testEnsembleStatistics )
+{
+    // Create member initial states, one row per member
+    int numberOfMembers = 11;
+    Eigen::MatrixXd memberInitialStates = Eigen::MatrixXd::Zero( numberOfMembers, 6 );
+    for( int i = 0; i < numberOfMembers; i++ )
+    {
+        Eigen::Vector6d initialKeplerElements;
+        initialKeplerElements << 7000.0E3 + 10.0E3 * i, 0.001 * i, 0.01 * i, 0.2, 0.3, 0.4;
+        memberInitialStates.row( i ) = orbital_element_conversions::convertKeplerianToCartesianElements(
+                    initialKeplerElements, 3.986004418E14 ).transpose( );
+    }
+
+    std::vector< double > statisticsEpochs;
+    for( int i = 0; i <= 24; i++ )
+    {
+        statisticsEpochs.push_back( 3600.0 * i );
+    }
+
+    for( int numberOfWorkers = 1; numberOfWorkers <= 3; numberOfWorkers++ )
+    {
+        std::vector< SystemOfBodies > workerBodies;
+        std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > workerPropagatorSettings;
+        for( int i = 0; i < numberOfWorkers; i++ )
+        {
+            workerBodies.push_back( createEnsembleTestBodies( ) );
+            workerPropagatorSettings.push_back( createEnsembleTestPropagatorSettings( workerBodies.at( i ) ) );
+        }
+        EnsembleDynamicsSimulator< > ensembleSimulator( workerBodies, workerPropagatorSettings, &setMemberMass );
+
+        // Propagate with and without retaining the member results
+        std::vector< std::shared_ptr< EnsembleStatisticsAccumulator< > > > ensembleStatistics;
+        std::vector< std::shared_ptr< SingleArcSimulationResults< double, double > > > memberResults;
+        for( int retainResults = 1; retainResults >= 0; retainResults-- )
+        {
+            ensembleStatistics.push_back( std::make_shared< EnsembleStatisticsAccumulator< > >( statisticsEpochs ) );
+            ensembleSimulator.setEnsembleStatistics( ensembleStatistics.back( ), retainResults );
+            ensembleSimulator.propagateEnsemble( memberInitialStates );
+            BOOST_CHECK_EQUAL( ensembleStatistics.back( )->getNumberOfMembers( ), numberOfMembers );
+
+            for( int i = 0; i < numberOfMembers; i++ )
+            {
+                BOOST_CHECK_EQUAL( ( ensembleSimulator.getMemberResults( i ) != nullptr ),
+                                   static_cast< bool >( retainResults ) );
+            }
+            if( retainResults )
+            {
+                memberResults = ensembleSimulator.getMemberResults( );
+            }
+        }
+
+        // Compute reference statistics from interpolated member results
+        std::vector< std::vector< Eigen::VectorXd > > interpolatedStates( statisticsEpochs.size( ) );
+        for( int i = 0; i < numberOfMembers; i++ )
+        {
+            std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::VectorXd > > stateInterpolator =
+                    interpolators::createOneDimensionalInterpolator(
+                        memberResults.at( i )->getEquationsOfMotionNumericalSolution( ),
+                        std::make_shared< interpolators::LagrangeInterpolatorSettings >( 8 ) );
+            for( unsigned int j = 0; j < statisticsEpochs.size( ); j++ )
+            {
+                interpolatedStates[ j ].push_back( stateInterpolator->interpolate( statisticsEpochs.at( j ) ) );
+            }
+        }
+
+        std::map< double, Eigen::VectorXd > meanHistory = ensembleStatistics.at( 0 )->getStateMeanHistory( );
+        std::map< double, Eigen::MatrixXd > covarianceHistory = ensembleStatistics.at( 0 )->getStateCovarianceHistory( );
+        std::map< double, Eigen::VectorXd > medianHistory = ensembleStatistics.at( 0 )->getStateQuantileHistory( 0.5 );
+        BOOST_CHECK_EQUAL( meanHistory.size( ), statisticsEpochs.size( ) );
+        for( unsigned int j = 0; j < statisticsEpochs.size( ); j++ )
+        {
+            double currentEpoch = statisticsEpochs.at( j );
+            Eigen::VectorXd expectedMean = statistics::computeSampleMean( interpolatedStates.at( j ) );
+            Eigen::VectorXd expectedVariance = statistics::computeSampleVariance( interpolatedStates.at( j ) );
+            const statistics::StreamingSampleStatistics& epochStatistics =
+                    ensembleStatistics.at( 0 )->getStateStatistics( ).at( j );
+            BOOST_CHECK_EQUAL( epochStatistics.getNumberOfSamples( ), numberOfMembers );
+
+            for( int k = 0; k < 6; k++ )
+            {
+                double stateScale = ( k < 3 ) ? 1.0E7 : 1.0E4;
+                BOOST_CHECK_SMALL( meanHistory.at( currentEpoch )( k ) - expectedMean( k ), 1.0E-14 * stateScale );
+                BOOST_CHECK_CLOSE_FRACTION( covarianceHistory.at( currentEpoch )( k, k ), expectedVariance( k ), 1.0E-10 );
+
+                // With fewer samples than the compression, the median is reproduced exactly
+                std::vector< double > entryData;
+                for( int i = 0; i < numberOfMembers; i++ )
+                {
+                    entryData.push_back( interpolatedStates.at( j ).at( i )( k ) );
+                }
+                BOOST_CHECK_CLOSE_FRACTION( medianHistory.at( currentEpoch )( k ),
+                                            statistics::computeSampleMedian( entryData ), 1.0E-14 );
+                BOOST_CHECK_EQUAL( epochStatistics.getMinimum( )( k ),
+                                   *std::min_element( entryData.begin( ), entryData.end( ) ) );
+                BOOST_CHECK_EQUAL( epochStatistics.getMaximum( )( k ),
+                                   *std::max_element( entryData.begin( ), entryData.end( ) ) );
+            }
+
+            // Check that statistics are independent of whether member results are retained
+            const statistics::StreamingSampleStatistics& epochStatisticsWithoutResults =
+                    ensembleStatistics.at( 1 )->getStateStatistics( ).at( j );
+            BOOST_CHECK( epochStatisticsWithoutResults.getMean( ) == epochStatistics.getMean( ) );
+            BOOST_CHECK( epochStatisticsWithoutResults.getCovariance( ) == epochStatistics.getCovariance( ) );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}
+
+}
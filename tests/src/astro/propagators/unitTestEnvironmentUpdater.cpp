@@ -21,6 +21,10 @@
 #include "tudat/astro/basic_astro/physicalConstants.h"
 #include "tudat/astro/basic_astro/unitConversions.h"
 #include "tudat/astro/ephemerides/approximatePlanetPositions.h"
+#include "tudat/astro/ephemerides/customRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/simpleRotationalEphemeris.h"
+#include "tudat/astro/orbit_determination/estimatable_parameters/constantRotationRate.h"
+#include "tudat/astro/orbit_determination/estimatable_parameters/constantRotationalOrientation.h"
 #include "tudat/astro/ephemerides/tabulatedEphemeris.h"
 #include "tudat/simulation/propagation_setup/propagationSettings.h"
 #include "tudat/simulation/propagation_setup/dynamicsSimulator.h"
@@ -622,6 +626,264 @@ BOOST_AUTO_TEST_CASE( test_NonConservativeForceEnvironmentUpdate )
     }
 }
 
+//! Test if models that depend only on time are not recomputed when already current, and recomputed otherwise
+BOOST_AUTO_TEST_CASE( test_TimeDependentEnvironmentUpdateSkipping )
+{
+    // Create bodies with ephemerides that count the number of evaluations
+    int numberOfEarthEvaluations = 0;
+    int numberOfMoonEvaluations = 0;
+    BodyListSettings bodySettings = BodyListSettings( "SSB", "ECLIPJ2000" );
+    bodySettings.addSettings( "Earth" );
+    bodySettings.at( "Earth" )->ephemerisSettings = customEphemerisSettings(
+                [ & ]( const double time ){ numberOfEarthEvaluations++; return
+                    ( Eigen::Vector6d( ) << 1.0E11, time, 0.0, 0.0, 1.0, 0.0 ).finished( ); }, "SSB" );
+    bodySettings.addSettings( "Moon" );
+    bodySettings.at( "Moon" )->ephemerisSettings = customEphemerisSettings(
+                [ & ]( const double time ){ numberOfMoonEvaluations++; return
+                    ( Eigen::Vector6d( ) << 4.0E8, 0.0, time, 0.0, 0.0, 1.0 ).finished( ); }, "Earth" );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+    bodies.createEmptyBody( "Vehicle" );
+
+    std::unordered_map< IntegratedStateType, Eigen::VectorXd > integratedStateToSet;
+    integratedStateToSet[ translational_state ] = Eigen::VectorXd::Zero( 6 );
+
+    // Create updater for non-propagated Earth and Moon
+    std::map< EnvironmentModelsToUpdate, std::vector< std::string > > updateSettings;
+    updateSettings[ body_translational_state_update ] = { "Earth", "Moon" };
+    std::map< IntegratedStateType, std::vector< std::tuple< std::string, std::string, PropagatorType > > > integratedStates;
+    integratedStates[ translational_state ].push_back( std::make_tuple( "Vehicle", "Earth", PropagatorType( cowell ) ) );
+    EnvironmentUpdater< double, double > updater( bodies, updateSettings, integratedStates );
+    BOOST_CHECK_EQUAL( updater.getUpdateOrder( ).size( ), 2 );
+    updater.resetCurrentTime( );
+
+    // Check that models are evaluated only once for repeated updates at the same time
+    double testTime = 100.0;
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        integratedStateToSet[ translational_state ]( 0 ) = static_cast< double >( i );
+        updater.updateEnvironment( testTime, integratedStateToSet );
+    }
+    BOOST_CHECK_EQUAL( numberOfEarthEvaluations, 1 );
+    BOOST_CHECK_EQUAL( numberOfMoonEvaluations, 1 );
+    BOOST_CHECK_EQUAL( bodies.at( "Vehicle" )->getState( )( 0 ), 2.0 );
+    BOOST_CHECK_EQUAL( bodies.at( "Moon" )->getState( )( 2 ), testTime );
+    BOOST_CHECK_EQUAL( bodies.at( "Moon" )->getState( )( 0 ), 1.0E11 + 4.0E8 );
+
+    // Check that models are evaluated for new time, and after reset
+    updater.updateEnvironment( 2.0 * testTime, integratedStateToSet );
+    BOOST_CHECK_EQUAL( numberOfEarthEvaluations, 2 );
+    BOOST_CHECK_EQUAL( numberOfMoonEvaluations, 2 );
+    BOOST_CHECK_EQUAL( bodies.at( "Earth" )->getState( )( 1 ), 2.0 * testTime );
+
+    updater.resetCurrentTime( );
+    updater.updateEnvironment( 2.0 * testTime, integratedStateToSet );
+    BOOST_CHECK_EQUAL( numberOfEarthEvaluations, 3 );
+    BOOST_CHECK_EQUAL( numberOfMoonEvaluations, 3 );
+
+    // Check that model is recomputed for each update if its ephemeris origin is propagated
+    integratedStates.clear( );
+    integratedStates[ translational_state ].push_back( std::make_tuple( "Earth", "SSB", PropagatorType( cowell ) ) );
+    updateSettings[ body_translational_state_update ] = { "Moon" };
+    EnvironmentUpdater< double, double > propagatedOriginUpdater( bodies, updateSettings, integratedStates );
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        propagatedOriginUpdater.updateEnvironment( testTime, integratedStateToSet );
+    }
+    BOOST_CHECK_EQUAL( numberOfMoonEvaluations, 6 );
+}
+
+//! Test if ephemeris states are shared by all users of a body state at a given time, and if reuse statistics are correct
+BOOST_AUTO_TEST_CASE( test_EphemerisStateCacheStatistics )
+{
+    // Create bodies with ephemerides that count the number of evaluations
+    int numberOfEarthEvaluations = 0;
+    int numberOfMoonEvaluations = 0;
+    BodyListSettings bodySettings = BodyListSettings( "SSB", "ECLIPJ2000" );
+    bodySettings.addSettings( "Earth" );
+    bodySettings.at( "Earth" )->ephemerisSettings = customEphemerisSettings(
+                [ & ]( const double time ){ numberOfEarthEvaluations++; return
+                    ( Eigen::Vector6d( ) << 1.0E11, time, 0.0, 0.0, 1.0, 0.0 ).finished( ); }, "SSB" );
+    bodySettings.addSettings( "Moon" );
+    bodySettings.at( "Moon" )->ephemerisSettings = customEphemerisSettings(
+                [ & ]( const double time ){ numberOfMoonEvaluations++; return
+                    ( Eigen::Vector6d( ) << 4.0E8, 0.0, time, 0.0, 0.0, 1.0 ).finished( ); }, "Earth" );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+    resetEphemerisStateCacheStatistics( bodies );
+
+    // Set Earth state, and use it repeatedly (directly, and as ephemeris origin of the Moon)
+    double testTime = 100.0;
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        bodies.at( "Earth" )->setStateFromEphemeris( testTime );
+    }
+    bodies.at( "Moon" )->setStateFromEphemeris( testTime );
+    BOOST_CHECK_EQUAL( numberOfEarthEvaluations, 1 );
+    BOOST_CHECK_EQUAL( numberOfMoonEvaluations, 1 );
+    BOOST_CHECK_EQUAL( bodies.at( "Earth" )->getNumberOfEphemerisStateRequests( ), 5 );
+    BOOST_CHECK_EQUAL( bodies.at( "Earth" )->getNumberOfEphemerisStateCacheHits( ), 4 );
+    BOOST_CHECK_EQUAL( bodies.at( "Moon" )->getNumberOfEphemerisStateRequests( ), 1 );
+    BOOST_CHECK_EQUAL( bodies.at( "Moon" )->getNumberOfEphemerisStateCacheHits( ), 0 );
+
+    // Check that states are recomputed at new time, or when requested
+    bodies.at( "Earth" )->setStateFromEphemeris( 2.0 * testTime );
+    bodies.at( "Earth" )->recomputeStateOnNextCall( );
+    bodies.at( "Earth" )->setStateFromEphemeris( 2.0 * testTime );
+    BOOST_CHECK_EQUAL( numberOfEarthEvaluations, 3 );
+    BOOST_CHECK_EQUAL( bodies.at( "Earth" )->getNumberOfEphemerisStateRequests( ), 7 );
+    BOOST_CHECK_EQUAL( bodies.at( "Earth" )->getNumberOfEphemerisStateCacheHits( ), 4 );
+
+    // Check that state is recomputed if it is requested with higher precision than it was computed with
+    bodies.at( "Earth" )->setStateFromEphemeris< long double, double >( 2.0 * testTime );
+    bodies.at( "Earth" )->setStateFromEphemeris< long double, double >( 2.0 * testTime );
+    bodies.at( "Earth" )->setStateFromEphemeris< double, double >( 2.0 * testTime );
+    BOOST_CHECK_EQUAL( numberOfEarthEvaluations, 4 );
+    BOOST_CHECK_EQUAL( bodies.at( "Earth" )->getNumberOfEphemerisStateCacheHits( ), 6 );
+
+    // Check that a manually set state is not overwritten by the state at the current epoch
+    bodies.at( "Earth" )->setState( Eigen::Vector6d::Zero( ) );
+    bodies.at( "Earth" )->setStateFromEphemeris( 2.0 * testTime );
+    BOOST_CHECK_EQUAL( numberOfEarthEvaluations, 5 );
+    BOOST_CHECK_EQUAL( bodies.at( "Earth" )->getState( )( 1 ), 2.0 * testTime );
+
+    // Check reset of statistics
+    resetEphemerisStateCacheStatistics( bodies );
+    BOOST_CHECK_EQUAL( bodies.at( "Earth" )->getNumberOfEphemerisStateRequests( ), 0 );
+    BOOST_CHECK_EQUAL( bodies.at( "Earth" )->getNumberOfEphemerisStateCacheHits( ), 0 );
+}
+
+//! Custom rotation model, defined to depend only on time
+class TimeDependentCustomRotationalEphemeris: public ephemerides::CustomRotationalEphemeris
+{
+public:
+    TimeDependentCustomRotationalEphemeris(
+            const std::function< Eigen::Quaterniond( const double ) > targetToBaseFrameOrientationFunction ):
+        ephemerides::CustomRotationalEphemeris( targetToBaseFrameOrientationFunction, "ECLIPJ2000", "Body_Fixed" ){ }
+
+    bool isTimeDependentOnly( ){ return true; }
+};
+
+//! Test if rotational states are reused at the same epoch for rotation models that depend only on time
+BOOST_AUTO_TEST_CASE( test_RotationalStateCacheStatistics )
+{
+    int numberOfEvaluations = 0;
+    std::function< Eigen::Quaterniond( const double ) > rotationFunction = [ & ]( const double time )
+    {
+        numberOfEvaluations++;
+        return Eigen::Quaterniond( Eigen::AngleAxisd( 1.0E-4 * time, Eigen::Vector3d::UnitZ( ) ) );
+    };
+
+    // Create bodies with time-dependent and (potentially) state-dependent rotation models
+    SystemOfBodies bodies = SystemOfBodies( "SSB", "ECLIPJ2000" );
+    bodies.createEmptyBody( "TimeDependent" );
+    bodies.at( "TimeDependent" )->setRotationalEphemeris(
+                std::make_shared< TimeDependentCustomRotationalEphemeris >( rotationFunction ) );
+    bodies.createEmptyBody( "Custom" );
+    bodies.at( "Custom" )->setRotationalEphemeris(
+                std::make_shared< ephemerides::CustomRotationalEphemeris >( rotationFunction, "ECLIPJ2000", "Body_Fixed" ) );
+    double testTime = 1000.0;
+
+    // Check reuse of rotational state for time-dependent model
+    std::shared_ptr< Body > timeDependentBody = bodies.at( "TimeDependent" );
+    timeDependentBody->setCurrentRotationalStateToLocalFrameFromEphemeris( testTime );
+    int numberOfFullStateEvaluations = numberOfEvaluations;
+    timeDependentBody->setCurrentRotationalStateToLocalFrameFromEphemeris( testTime );
+    timeDependentBody->setCurrentRotationToLocalFrameFromEphemeris( testTime );
+    BOOST_CHECK_EQUAL( numberOfEvaluations, numberOfFullStateEvaluations );
+    BOOST_CHECK_EQUAL( timeDependentBody->getNumberOfRotationalStateRequests( ), 3 );
+    BOOST_CHECK_EQUAL( timeDependentBody->getNumberOfRotationalStateCacheHits( ), 2 );
+    BOOST_CHECK( timeDependentBody->getCurrentRotationToLocalFrame( ).toRotationMatrix( ).isApprox(
+                     Eigen::AngleAxisd( -1.0E-4 * testTime, Eigen::Vector3d::UnitZ( ) ).toRotationMatrix( ) ) );
+
+    // Check that full rotational state is computed if only rotation is available, and that manual reset is used
+    timeDependentBody->setCurrentRotationToLocalFrameFromEphemeris( 2.0 * testTime );
+    timeDependentBody->setCurrentRotationToLocalFrameFromEphemeris( 2.0 * testTime );
+    BOOST_CHECK_EQUAL( numberOfEvaluations, numberOfFullStateEvaluations + 1 );
+    timeDependentBody->setCurrentRotationalStateToLocalFrameFromEphemeris( 2.0 * testTime );
+    BOOST_CHECK_EQUAL( numberOfEvaluations, 2 * numberOfFullStateEvaluations + 1 );
+    timeDependentBody->recomputeRotationalStateOnNextCall( );
+    timeDependentBody->setCurrentRotationToLocalFrameFromEphemeris( 2.0 * testTime );
+    BOOST_CHECK_EQUAL( numberOfEvaluations, 2 * numberOfFullStateEvaluations + 2 );
+    BOOST_CHECK_EQUAL( timeDependentBody->getNumberOfRotationalStateCacheHits( ), 3 );
+
+    // Check that rotational state is always recomputed for other models
+    numberOfEvaluations = 0;
+    bodies.at( "Custom" )->setCurrentRotationalStateToLocalFrameFromEphemeris( testTime );
+    bodies.at( "Custom" )->setCurrentRotationalStateToLocalFrameFromEphemeris( testTime );
+    BOOST_CHECK_EQUAL( numberOfEvaluations, 2 * numberOfFullStateEvaluations );
+    BOOST_CHECK_EQUAL( bodies.at( "Custom" )->getNumberOfRotationalStateCacheHits( ), 0 );
+
+    // Check reset of statistics
+    resetEphemerisStateCacheStatistics( bodies );
+    BOOST_CHECK_EQUAL( timeDependentBody->getNumberOfRotationalStateRequests( ), 0 );
+    BOOST_CHECK_EQUAL( timeDependentBody->getNumberOfRotationalStateCacheHits( ), 0 );
+}
+
+//! Test if rotational states are recomputed at the same epoch after a modification of the rotation model
+BOOST_AUTO_TEST_CASE( test_RotationalStateCacheAfterParameterModification )
+{
+    SystemOfBodies bodies = SystemOfBodies( "SSB", "ECLIPJ2000" );
+    bodies.createEmptyBody( "Earth" );
+    std::shared_ptr< ephemerides::SimpleRotationalEphemeris > rotationModel =
+            std::make_shared< ephemerides::SimpleRotationalEphemeris >(
+                0.1, 1.2, 0.3, 7.3E-5, 0.0, "ECLIPJ2000", "IAU_Earth" );
+    bodies.at( "Earth" )->setRotationalEphemeris( rotationModel );
+    BOOST_CHECK( rotationModel->isTimeDependentOnly( ) );
+
+    std::shared_ptr< estimatable_parameters::RotationRate > rotationRateParameter =
+            std::make_shared< estimatable_parameters::RotationRate >( rotationModel, "Earth" );
+    std::shared_ptr< estimatable_parameters::ConstantRotationalOrientation > polePositionParameter =
+            std::make_shared< estimatable_parameters::ConstantRotationalOrientation >( rotationModel, "Earth" );
+
+    double testTime = 1.0E5;
+    for( int test = 0; test < 2; test++ )
+    {
+        for( int useFullRotationalState = 0; useFullRotationalState < 2; useFullRotationalState++ )
+        {
+            // Set rotation at test epoch, and modify rotation model through estimatable parameter
+            if( useFullRotationalState )
+            {
+                bodies.at( "Earth" )->setCurrentRotationalStateToLocalFrameFromEphemeris( testTime );
+            }
+            else
+            {
+                bodies.at( "Earth" )->setCurrentRotationToLocalFrameFromEphemeris( testTime );
+            }
+            Eigen::Matrix3d nominalRotation = bodies.at( "Earth" )->getCurrentRotationToLocalFrame( ).toRotationMatrix( );
+
+            if( test == 0 )
+            {
+                rotationRateParameter->setParameterValue( rotationRateParameter->getParameterValue( ) + 1.0E-8 );
+            }
+            else
+            {
+                polePositionParameter->setParameterValue(
+                            polePositionParameter->getParameterValue( ) + Eigen::Vector2d::Constant( 1.0E-4 ) );
+            }
+
+            // Check that rotation at the same epoch is recomputed, and consistent with the modified model
+            int numberOfCacheHits = bodies.at( "Earth" )->getNumberOfRotationalStateCacheHits( );
+            if( useFullRotationalState )
+            {
+                bodies.at( "Earth" )->setCurrentRotationalStateToLocalFrameFromEphemeris( testTime );
+            }
+            else
+            {
+                bodies.at( "Earth" )->setCurrentRotationToLocalFrameFromEphemeris( testTime );
+            }
+            BOOST_CHECK_EQUAL( bodies.at( "Earth" )->getNumberOfRotationalStateCacheHits( ), numberOfCacheHits );
+
+            Eigen::Matrix3d modifiedRotation = bodies.at( "Earth" )->getCurrentRotationToLocalFrame( ).toRotationMatrix( );
+            BOOST_CHECK( !modifiedRotation.isApprox( nominalRotation, 1.0E-12 ) );
+            BOOST_CHECK( modifiedRotation.isApprox( rotationModel->getRotationToTargetFrame( testTime ).toRotationMatrix( ),
+                                                    1.0E-12 ) );
+
+            // Check that rotation is reused again once the model is no longer modified
+            bodies.at( "Earth" )->setCurrentRotationToLocalFrameFromEphemeris( testTime );
+            BOOST_CHECK_EQUAL( bodies.at( "Earth" )->getNumberOfRotationalStateCacheHits( ), numberOfCacheHits + 1 );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -339,6 +339,204 @@ BOOST_AUTO_TEST_CASE( testEnckePopagatorForSphericalHarmonicCentralBodies )
     }
 }
 
+//! Test exact termination using dense output of the integrator, for termination on exact time and exact distance, by comparing
+//! to the results obtained by repeating the last step.
+BOOST_AUTO_TEST_CASE( testExactTerminationWithDenseOutput )
+{
+    using namespace tudat;
+    using namespace simulation_setup;
+    using namespace propagators;
+    using namespace numerical_integrators;
+    using namespace orbital_element_conversions;
+
+    // Create environment with point-mass Earth
+    double earthGravitationalParameter = 3.986004418E14;
+    BodyListSettings bodySettings = BodyListSettings( "Earth", "ECLIPJ2000" );
+    bodySettings.addSettings( "Earth" );
+    bodySettings.at( "Earth" )->ephemerisSettings = constantEphemerisSettings( Eigen::Vector6d::Zero( ), "SSB" );
+    bodySettings.at( "Earth" )->gravityFieldSettings = centralGravitySettings( earthGravitationalParameter );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+    bodies.createEmptyBody( "Vehicle" );
+
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back( pointMassGravityAcceleration( ) );
+    basic_astrodynamics::AccelerationMap accelerationModels = createAccelerationModelsMap(
+                bodies, accelerationSettings, { "Vehicle" }, { "Earth" } );
+
+    Eigen::Vector6d initialKeplerElements;
+    initialKeplerElements << 8000.0E3, 0.1, 0.6, 0.2, 0.3, 0.4;
+    Eigen::Vector6d initialState = convertKeplerianToCartesianElements(
+                initialKeplerElements, earthGravitationalParameter );
+
+    std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables;
+    dependentVariables.push_back( relativeDistanceDependentVariable( "Vehicle", "Earth" ) );
+
+    double finalTime = 10000.0;
+    double finalDistance = 8.5E6;
+    for( unsigned int terminationCase = 0; terminationCase < 2; terminationCase++ )
+    {
+        for( unsigned int direction = 0; direction < 2; direction++ )
+        {
+            double directionSign = ( direction == 0 ) ? 1.0 : -1.0;
+            std::vector< std::shared_ptr< SingleArcSimulationResults< double, double > > > propagationResults;
+            for( unsigned int denseOutputCase = 0; denseOutputCase < 2; denseOutputCase++ )
+            {
+                std::shared_ptr< PropagationTerminationSettings > terminationSettings;
+                if( terminationCase == 0 )
+                {
+                    terminationSettings = propagationTimeTerminationSettings( directionSign * finalTime, true );
+                }
+                else
+                {
+                    terminationSettings = propagationDependentVariableTerminationSettings(
+                                relativeDistanceDependentVariable( "Vehicle", "Earth" ), finalDistance, false, true,
+                                tudat::root_finders::bisectionRootFinderSettings( 1.0E-10, TUDAT_NAN, TUDAT_NAN, 100 ) );
+                }
+
+                std::shared_ptr< IntegratorSettings< > > integratorSettings = rungeKuttaVariableStepSettingsScalarTolerances(
+                            directionSign * 10.0, CoefficientSets::rungeKuttaFehlberg78, 1.0E-4, 1.0E4, 1.0E-12, 1.0E-12 );
+                setIntegratorDenseOutput( integratorSettings, denseOutputCase == 1 );
+
+                std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                        translationalStatePropagatorSettings< double >(
+                            { "Earth" }, accelerationModels, { "Vehicle" }, initialState, 0.0, integratorSettings,
+                            terminationSettings, cowell, dependentVariables );
+
+                SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+                propagationResults.push_back( dynamicsSimulator.getSingleArcPropagationResults( ) );
+            }
+
+            // Compare final epochs and states (dense output is of lower order than integrator)
+            std::map< double, Eigen::VectorXd > stateHistory = propagationResults.at( 0 )->getEquationsOfMotionNumericalSolution( );
+            std::map< double, Eigen::VectorXd > denseOutputStateHistory =
+                    propagationResults.at( 1 )->getEquationsOfMotionNumericalSolution( );
+            std::map< double, Eigen::VectorXd > denseOutputDependentVariableHistory =
+                    propagationResults.at( 1 )->getDependentVariableHistory( );
+            BOOST_CHECK_EQUAL( stateHistory.size( ), denseOutputStateHistory.size( ) );
+
+            auto finalStateIterator = ( direction == 0 ) ? std::prev( stateHistory.end( ) ) : stateHistory.begin( );
+            auto denseOutputFinalStateIterator = ( direction == 0 ) ?
+                        std::prev( denseOutputStateHistory.end( ) ) : denseOutputStateHistory.begin( );
+            auto denseOutputFinalDependentVariableIterator = ( direction == 0 ) ?
+                        std::prev( denseOutputDependentVariableHistory.end( ) ) : denseOutputDependentVariableHistory.begin( );
+            if( terminationCase == 0 )
+            {
+                BOOST_CHECK_EQUAL( denseOutputFinalStateIterator->first, directionSign * finalTime );
+            }
+            else
+            {
+                BOOST_CHECK_SMALL( std::fabs( denseOutputFinalDependentVariableIterator->second( 0 ) - finalDistance ), 1.0E-2 );
+            }
+            BOOST_CHECK_SMALL( std::fabs( denseOutputFinalStateIterator->first - finalStateIterator->first ), 1.0E-4 );
+            BOOST_CHECK_SMALL( ( denseOutputFinalStateIterator->second - finalStateIterator->second ).segment( 0, 3 ).norm( ), 0.1 );
+            BOOST_CHECK_SMALL( ( denseOutputFinalStateIterator->second - finalStateIterator->second ).segment( 3, 3 ).norm( ), 1.0E-4 );
+
+            // Check that results before final epoch are not affected by dense output
+            for( auto stateIterator : denseOutputStateHistory )
+            {
+                if( stateIterator.first != denseOutputFinalStateIterator->first )
+                {
+                    BOOST_CHECK_EQUAL( ( stateIterator.second - stateHistory.at( stateIterator.first ) ).norm( ), 0.0 );
+                }
+            }
+
+            // Check that dense output reduces number of function evaluations
+            BOOST_CHECK( propagationResults.at( 1 )->getTotalNumberOfFunctionEvaluations( ) <
+                         propagationResults.at( 0 )->getTotalNumberOfFunctionEvaluations( ) );
+        }
+    }
+}
+
+//! Test exact termination on hybrid conditions with multiple events in the last step, checking that the earliest event is
+//! located, and that only the events at the final time (including simultaneous events) are flagged in the termination details
+BOOST_AUTO_TEST_CASE( testSimultaneousExactTerminationEvents )
+{
+    using namespace tudat;
+    using namespace simulation_setup;
+    using namespace propagators;
+    using namespace numerical_integrators;
+    using namespace orbital_element_conversions;
+
+    // Create environment with point-mass Earth
+    double earthGravitationalParameter = 3.986004418E14;
+    BodyListSettings bodySettings = BodyListSettings( "Earth", "ECLIPJ2000" );
+    bodySettings.addSettings( "Earth" );
+    bodySettings.at( "Earth" )->ephemerisSettings = constantEphemerisSettings( Eigen::Vector6d::Zero( ), "SSB" );
+    bodySettings.at( "Earth" )->gravityFieldSettings = centralGravitySettings( earthGravitationalParameter );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+    bodies.createEmptyBody( "Vehicle" );
+
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back( pointMassGravityAcceleration( ) );
+    basic_astrodynamics::AccelerationMap accelerationModels = createAccelerationModelsMap(
+                bodies, accelerationSettings, { "Vehicle" }, { "Earth" } );
+
+    Eigen::Vector6d initialKeplerElements;
+    initialKeplerElements << 8000.0E3, 0.1, 0.6, 0.2, 0.3, 0.4;
+    Eigen::Vector6d initialState = convertKeplerianToCartesianElements(
+                initialKeplerElements, earthGravitationalParameter );
+
+    std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables;
+    dependentVariables.push_back( relativeDistanceDependentVariable( "Vehicle", "Earth" ) );
+
+    double finalDistance = 8.5E6;
+    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        for( unsigned int denseOutputCase = 0; denseOutputCase < 2; denseOutputCase++ )
+        {
+            // Case 0: two simultaneous distance events, and a (distant) time event
+            // Case 1: two distance events 1 m apart (occuring within a single step)
+            std::vector< std::shared_ptr< PropagationTerminationSettings > > constituentSettings;
+            constituentSettings.push_back( propagationDependentVariableTerminationSettings(
+                                               relativeDistanceDependentVariable( "Vehicle", "Earth" ), finalDistance, false, true,
+                                               tudat::root_finders::bisectionRootFinderSettings( 1.0E-8, TUDAT_NAN, TUDAT_NAN, 100 ) ) );
+            constituentSettings.push_back( propagationDependentVariableTerminationSettings(
+                                               relativeDistanceDependentVariable( "Vehicle", "Earth" ),
+                                               finalDistance + ( testCase == 0 ? 0.0 : 1.0 ), false, true,
+                                               tudat::root_finders::bisectionRootFinderSettings( 1.0E-8, TUDAT_NAN, TUDAT_NAN, 100 ) ) );
+            if( testCase == 0 )
+            {
+                constituentSettings.push_back( propagationTimeTerminationSettings( 1.0E5, true ) );
+            }
+
+            std::shared_ptr< IntegratorSettings< > > integratorSettings = rungeKuttaVariableStepSettingsScalarTolerances(
+                        10.0, CoefficientSets::rungeKuttaFehlberg78, 1.0E-4, 1.0E4, 1.0E-12, 1.0E-12 );
+            setIntegratorDenseOutput( integratorSettings, denseOutputCase == 1 );
+
+            std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                    translationalStatePropagatorSettings< double >(
+                        { "Earth" }, accelerationModels, { "Vehicle" }, initialState, 0.0, integratorSettings,
+                        propagationHybridTerminationSettings( constituentSettings, true ), cowell, dependentVariables );
+
+            SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+            std::shared_ptr< SingleArcSimulationResults< double, double > > propagationResults =
+                    dynamicsSimulator.getSingleArcPropagationResults( );
+
+            // Check that earliest event is located
+            BOOST_CHECK_SMALL( std::fabs( propagationResults->getDependentVariableHistory( ).rbegin( )->second( 0 ) -
+                                          finalDistance ), 1.0E-2 );
+
+            // Check which events are flagged
+            std::shared_ptr< PropagationTerminationDetailsFromHybridCondition > terminationDetails =
+                    std::dynamic_pointer_cast< PropagationTerminationDetailsFromHybridCondition >(
+                        propagationResults->getPropagationTerminationReason( ) );
+            BOOST_CHECK( terminationDetails != nullptr );
+            std::vector< bool > isConditionMet = terminationDetails->getWasConditionMetWhenStopping( );
+            BOOST_CHECK_EQUAL( isConditionMet.size( ), constituentSettings.size( ) );
+            BOOST_CHECK( isConditionMet.at( 0 ) );
+            if( testCase == 0 )
+            {
+                BOOST_CHECK( isConditionMet.at( 1 ) );
+                BOOST_CHECK( !isConditionMet.at( 2 ) );
+            }
+            else
+            {
+                BOOST_CHECK( !isConditionMet.at( 1 ) );
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
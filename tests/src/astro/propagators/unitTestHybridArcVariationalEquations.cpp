@@ -56,6 +56,34 @@ using namespace tudat::unit_conversions;
 
 BOOST_AUTO_TEST_SUITE( test_hybrid_arc_variational_equation_calculation )
 
+//! Function to create the environment for the Mars and orbiter hybrid-arc propagation
+SystemOfBodies createMarsAndOrbiterBodies( const BodyListSettings& bodySettings )
+{
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+
+    bodies.createEmptyBody( "Orbiter" );
+    bodies.at( "Orbiter" )->setConstantBodyMass( 5.0E3 );
+    bodies.at( "Orbiter" )->setEphemeris( std::make_shared< MultiArcEphemeris >(
+            std::map< double, std::shared_ptr< Ephemeris > >( ),
+            "Mars", "ECLIPJ2000" ) );
+    bodies.processBodyFrameDefinitions( );
+
+    double referenceAreaRadiation = 4.0;
+    double radiationPressureCoefficient = 1.2;
+    std::vector< std::string > occultingBodies;
+    occultingBodies.push_back( "Earth" );
+    std::shared_ptr< RadiationPressureInterfaceSettings > orbiterRadiationPressureSettings =
+            std::make_shared< CannonBallRadiationPressureInterfaceSettings >(
+                    "Sun", referenceAreaRadiation, radiationPressureCoefficient, occultingBodies );
+
+    // Create and set radiation pressure settings
+    bodies.at( "Orbiter" )->setRadiationPressureInterface(
+            "Sun", createRadiationPressureInterface(
+                    orbiterRadiationPressureSettings, "Orbiter", bodies ) );
+
+    return bodies;
+}
+
 
 template< typename TimeType = double , typename StateScalarType  = double >
 std::pair< std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > >,
@@ -68,7 +96,9 @@ executeHybridArcMarsAndOrbiterSensitivitySimulation(
         const std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > forcedMultiArcInitialStates =
         std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >( ),
         const double arcDuration = 0.5 * 86400.0,
-        const double arcOverlap  = 5.0E3 )
+        const double arcOverlap  = 5.0E3,
+        const int numberOfThreads = 1,
+        const bool useArcWiseBodies = false )
 {
 
     std::vector< std::string > bodyNames;
@@ -87,29 +117,7 @@ executeHybridArcMarsAndOrbiterSensitivitySimulation(
     BodyListSettings bodySettings =
             getDefaultBodySettings( bodyNames, initialEphemerisTime - buffer, finalEphemerisTime + buffer );
 
-    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
-
-    bodies.createEmptyBody( "Orbiter" );
-    bodies.at( "Orbiter" )->setConstantBodyMass( 5.0E3 );
-    bodies.at( "Orbiter" )->setEphemeris( std::make_shared< MultiArcEphemeris >(
-            std::map< double, std::shared_ptr< Ephemeris > >( ),
-            "Mars", "ECLIPJ2000" ) );
-    bodies.processBodyFrameDefinitions( );
-
-    double referenceAreaRadiation = 4.0;
-    double radiationPressureCoefficient = 1.2;
-    std::vector< std::string > occultingBodies;
-    occultingBodies.push_back( "Earth" );
-    std::shared_ptr< RadiationPressureInterfaceSettings > orbiterRadiationPressureSettings =
-            std::make_shared< CannonBallRadiationPressureInterfaceSettings >(
-                    "Sun", referenceAreaRadiation, radiationPressureCoefficient, occultingBodies );
-
-    // Create and set radiation pressure settings
-    bodies.at( "Orbiter" )->setRadiationPressureInterface(
-            "Sun", createRadiationPressureInterface(
-                    orbiterRadiationPressureSettings, "Orbiter", bodies ) );
-
-
+    SystemOfBodies bodies = createMarsAndOrbiterBodies( bodySettings );
 
     // Set accelerations between bodies that are to be taken into account.
     SelectedAccelerationMap singleArcAccelerationMap;
@@ -182,6 +190,16 @@ executeHybridArcMarsAndOrbiterSensitivitySimulation(
 
     // Create list of multi-arc initial states
     unsigned int numberOfIntegrationArcs = integrationArcStarts.size( );
+
+    // Create separate environment for each arc, if requested
+    std::vector< SystemOfBodies > arcWiseBodies;
+    if( useArcWiseBodies )
+    {
+        for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+        {
+            arcWiseBodies.push_back( createMarsAndOrbiterBodies( bodySettings ) );
+        }
+    }
     std::vector< Eigen::VectorXd > multiArcSystemInitialStates;
     multiArcSystemInitialStates.resize( numberOfIntegrationArcs );
 
@@ -222,21 +240,38 @@ executeHybridArcMarsAndOrbiterSensitivitySimulation(
 
     // Create propagation settings for each arc
     std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > arcPropagationSettingsList;
+    std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > arcWiseSingleArcPropagationSettingsList;
     for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
     {
         arcPropagationSettingsList.push_back(
                 std::make_shared< TranslationalStatePropagatorSettings< double > >
-                        ( multiArcCentralBodies, multiArcAccelerationModelMap, multiArcBodiesToIntegrate,
+                        ( multiArcCentralBodies, useArcWiseBodies ?
+                              createAccelerationModelsMap(
+                                  arcWiseBodies.at( i ), multiArcAccelerationMap, multiArcBodiesToIntegrate, multiArcCentralBodies ) :
+                              multiArcAccelerationModelMap, multiArcBodiesToIntegrate,
                           multiArcSystemInitialStates.at( i ), integrationArcStarts.at( i ), multiArcIntegratorSettings,
                           propagationTimeTerminationSettings( integrationArcEnds.at( i ) ) ) );
+
+        // Create single-arc models on environment of current arc
+        if( useArcWiseBodies )
+        {
+            arcWiseSingleArcPropagationSettingsList.push_back(
+                    std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                        singleArcCentralBodies, createAccelerationModelsMap(
+                            arcWiseBodies.at( i ), singleArcAccelerationMap, singleArcBodiesToIntegrate, singleArcCentralBodies ),
+                        singleArcBodiesToIntegrate, singleArcInitialStates, initialEphemerisTime, rungeKutta4Settings( 30.0 ),
+                        propagationTimeTerminationSettings( finalEphemerisTime ) ) );
+        }
     }
 
     std::shared_ptr< MultiArcPropagatorSettings< > > multiArcPropagatorSettings =
             std::make_shared< MultiArcPropagatorSettings< > >( arcPropagationSettingsList, patchMultiArcs );
+    multiArcPropagatorSettings->getOutputSettings( )->setNumberOfThreads( numberOfThreads );
 
     std::shared_ptr< HybridArcPropagatorSettings< > > hybridArcPropagatorSettings =
             std::make_shared< HybridArcPropagatorSettings< > >(
                     singleArcPropagatorSettings, multiArcPropagatorSettings );
+    hybridArcPropagatorSettings->setArcWiseSingleArcPropagatorSettings( arcWiseSingleArcPropagationSettingsList );
 
     // Define parameters.
     std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames;
@@ -267,7 +302,7 @@ executeHybridArcMarsAndOrbiterSensitivitySimulation(
         HybridArcVariationalEquationsSolver< StateScalarType, TimeType > variationalEquations =
                 HybridArcVariationalEquationsSolver< StateScalarType, TimeType >(
                         bodies,
-                        hybridArcPropagatorSettings, parametersToEstimate );
+                        hybridArcPropagatorSettings, parametersToEstimate, false, arcWiseBodies );
 
         // Propagate requested equations.
         if( propagateVariationalEquations )
@@ -507,6 +542,43 @@ BOOST_AUTO_TEST_CASE( testMarsAndOrbiterHybridArcVariationalEquationCalculation
     }
 }
 
+BOOST_AUTO_TEST_CASE( testParallelHybridArcVariationalEquations )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Propagate sequentially, on a single environment
+    std::pair< std::vector< Eigen::MatrixXd >, std::vector< Eigen::VectorXd > > sequentialOutput =
+            executeHybridArcMarsAndOrbiterSensitivitySimulation< double, double >(
+                Eigen::Matrix< double, 12, 1 >::Zero( ), Eigen::VectorXd::Zero( 2 ), true );
+    std::pair< std::vector< Eigen::MatrixXd >, std::vector< Eigen::VectorXd > > sequentialStatesOutput =
+            executeHybridArcMarsAndOrbiterSensitivitySimulation< double, double >(
+                Eigen::Matrix< double, 12, 1 >::Zero( ), Eigen::VectorXd::Zero( 2 ), false );
+
+    // Propagate arcs of multi-arc component concurrently, on separate environment for each arc
+    std::pair< std::vector< Eigen::MatrixXd >, std::vector< Eigen::VectorXd > > parallelOutput =
+            executeHybridArcMarsAndOrbiterSensitivitySimulation< double, double >(
+                Eigen::Matrix< double, 12, 1 >::Zero( ), Eigen::VectorXd::Zero( 2 ), true, false,
+                std::vector< Eigen::VectorXd >( ), 0.5 * 86400.0, 5.0E3, 4, true );
+    std::pair< std::vector< Eigen::MatrixXd >, std::vector< Eigen::VectorXd > > parallelStatesOutput =
+            executeHybridArcMarsAndOrbiterSensitivitySimulation< double, double >(
+                Eigen::Matrix< double, 12, 1 >::Zero( ), Eigen::VectorXd::Zero( 2 ), false, false,
+                std::vector< Eigen::VectorXd >( ), 0.5 * 86400.0, 5.0E3, 4, true );
+
+    // Check that results are identical
+    BOOST_CHECK_EQUAL( sequentialOutput.first.size( ), parallelOutput.first.size( ) );
+    BOOST_CHECK_EQUAL( sequentialStatesOutput.second.size( ), parallelStatesOutput.second.size( ) );
+    for( unsigned int arc = 0; arc < sequentialOutput.first.size( ); arc++ )
+    {
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    sequentialOutput.first.at( arc ), parallelOutput.first.at( arc ),
+                    std::numeric_limits< double >::epsilon( ) );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    sequentialStatesOutput.second.at( arc ), parallelStatesOutput.second.at( arc ),
+                    std::numeric_limits< double >::epsilon( ) );
+    }
+}
+
 BOOST_AUTO_TEST_CASE( testVaryingCentralBodyHybridArcVariationalEquations )
 {
     // Load spice kernels.
@@ -256,6 +256,110 @@ BOOST_AUTO_TEST_CASE( testKeplerMultiArcDynamics )
     }
 }
 
+//! Test if concurrent propagation of arcs on separate environments reproduces the sequential propagation exactly
+BOOST_AUTO_TEST_CASE( testParallelMultiArcDynamics )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    std::vector< std::string > bodyNames;
+    bodyNames.push_back( "Earth" );
+    bodyNames.push_back( "Moon" );
+
+    double initialEphemerisTime = 1.0E7;
+    double finalEphemerisTime = 2.0E7;
+    double buffer = 5.0 * 3600.0;
+
+    // Define arcs
+    std::vector< double > integrationArcStarts, integrationArcEnds;
+    double arcDuration = 1.0E6;
+    double currentStartTime = initialEphemerisTime + 1.0E4;
+    while( currentStartTime + arcDuration < finalEphemerisTime - 1.0E4 )
+    {
+        integrationArcStarts.push_back( currentStartTime );
+        integrationArcEnds.push_back( currentStartTime + arcDuration );
+        currentStartTime += arcDuration - 1.0E4;
+    }
+    unsigned int numberOfIntegrationArcs = integrationArcStarts.size( );
+
+    std::vector< std::string > bodiesToIntegrate = { "Moon" };
+    std::vector< std::string > centralBodies = { "Earth" };
+
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Moon" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >( point_mass_gravity ) );
+    accelerationMap[ "Moon" ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >( point_mass_gravity ) );
+
+    std::map< unsigned int, std::map< double, Eigen::VectorXd > > sequentialResults;
+    for( unsigned int testCase = 0; testCase < 3; testCase++ )
+    {
+        // Create one environment for the simulation, and (for test cases 1 and 2) one environment per arc
+        BodyListSettings bodySettings =
+                getDefaultBodySettings( { "Earth", "Moon", "Sun" }, initialEphemerisTime - buffer, finalEphemerisTime + buffer );
+        SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+
+        std::vector< SystemOfBodies > arcWiseBodies;
+        for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+        {
+            arcWiseBodies.push_back( ( testCase == 0 ) ? bodies : createSystemOfBodies( bodySettings ) );
+        }
+
+        // Create arc settings, with models created from the environment of the arc
+        std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > arcPropagationSettingsList;
+        for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+        {
+            AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                        arcWiseBodies.at( i ), accelerationMap, bodiesToIntegrate, centralBodies );
+            Eigen::VectorXd arcInitialState = spice_interface::getBodyCartesianStateAtEpoch(
+                        "Moon", "Earth", "ECLIPJ2000", "NONE", integrationArcStarts.at( i ) );
+            arcPropagationSettingsList.push_back(
+                        translationalStatePropagatorSettings< double >(
+                            centralBodies, accelerationModelMap, bodiesToIntegrate, arcInitialState, integrationArcStarts.at( i ),
+                            rungeKuttaFixedStepSettings( 120.0, CoefficientSets::rungeKuttaFehlberg78 ),
+                            propagationTimeTerminationSettings( integrationArcEnds.at( i ) ) ) );
+        }
+        std::shared_ptr< MultiArcPropagatorSettings< double > > multiArcPropagatorSettings =
+                std::make_shared< MultiArcPropagatorSettings< double > >( arcPropagationSettingsList );
+
+        // Propagate in parallel for test case 2
+        if( testCase == 2 )
+        {
+            multiArcPropagatorSettings->getOutputSettings( )->setNumberOfThreads( 4 );
+        }
+
+        MultiArcDynamicsSimulator< > dynamicsSimulator(
+                    bodies, multiArcPropagatorSettings, true, arcWiseBodies );
+
+        std::vector< std::shared_ptr< SingleArcSimulationResults< double, double > > > singleArcResults =
+                dynamicsSimulator.getMultiArcPropagationResults( )->getSingleArcResults( );
+        BOOST_CHECK_EQUAL( singleArcResults.size( ), numberOfIntegrationArcs );
+
+        for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+        {
+            BOOST_CHECK( singleArcResults.at( i )->integrationCompletedSuccessfully( ) );
+            std::map< double, Eigen::VectorXd > currentArcResults = singleArcResults.at( i )->getEquationsOfMotionNumericalSolution( );
+            if( testCase == 0 )
+            {
+                sequentialResults[ i ] = currentArcResults;
+            }
+            else
+            {
+                // Results must be identical to sequential propagation on a single environment
+                BOOST_CHECK_EQUAL( currentArcResults.size( ), sequentialResults.at( i ).size( ) );
+                auto sequentialIterator = sequentialResults.at( i ).begin( );
+                for( auto resultIterator : currentArcResults )
+                {
+                    BOOST_CHECK_EQUAL( resultIterator.first, sequentialIterator->first );
+                    for( int j = 0; j < 6; j++ )
+                    {
+                        BOOST_CHECK_EQUAL( resultIterator.second( j ), sequentialIterator->second( j ) );
+                    }
+                    sequentialIterator++;
+                }
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
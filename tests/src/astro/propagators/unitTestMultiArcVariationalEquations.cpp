@@ -424,6 +424,117 @@ BOOST_AUTO_TEST_CASE( testEarthMoonMultiArcVariationalEquationCalculation )
 }
 
 
+BOOST_AUTO_TEST_CASE( testParallelMultiArcVariationalEquations )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    double initialEphemerisTime = 1.0E7;
+    double finalEphemerisTime = 1.6E7;
+    double buffer = 5.0 * 3600.0;
+
+    // Define arcs
+    std::vector< double > integrationArcStarts, integrationArcEnds;
+    double arcDuration = 1.0E6;
+    double currentStartTime = initialEphemerisTime + 1.0E4;
+    while( currentStartTime + arcDuration < finalEphemerisTime - 1.0E4 )
+    {
+        integrationArcStarts.push_back( currentStartTime );
+        integrationArcEnds.push_back( currentStartTime + arcDuration );
+        currentStartTime += arcDuration - 1.0E4;
+    }
+    unsigned int numberOfIntegrationArcs = integrationArcStarts.size( );
+
+    std::vector< std::string > bodiesToIntegrate = { "Moon" };
+    std::vector< std::string > centralBodies = { "Earth" };
+
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Moon" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >( point_mass_gravity ) );
+    accelerationMap[ "Moon" ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >( point_mass_gravity ) );
+
+    std::map< unsigned int, std::vector< Eigen::MatrixXd > > sequentialResults;
+    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        // Create one environment for the simulation, and (for test case 1) one environment per arc
+        BodyListSettings bodySettings =
+                getDefaultBodySettings( { "Earth", "Moon", "Sun" }, initialEphemerisTime - buffer, finalEphemerisTime + buffer );
+        SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+
+        std::vector< SystemOfBodies > arcWiseBodies;
+        for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+        {
+            arcWiseBodies.push_back( ( testCase == 0 ) ? bodies : createSystemOfBodies( bodySettings ) );
+        }
+
+        // Create arc settings, with models created from the environment of the arc
+        std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > arcPropagationSettingsList;
+        for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+        {
+            AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                        arcWiseBodies.at( i ), accelerationMap, bodiesToIntegrate, centralBodies );
+            Eigen::VectorXd arcInitialState = spice_interface::getBodyCartesianStateAtEpoch(
+                        "Moon", "Earth", "ECLIPJ2000", "NONE", integrationArcStarts.at( i ) );
+            arcPropagationSettingsList.push_back(
+                        translationalStatePropagatorSettings< double >(
+                            centralBodies, accelerationModelMap, bodiesToIntegrate, arcInitialState, integrationArcStarts.at( i ),
+                            rungeKuttaFixedStepSettings( 120.0, CoefficientSets::rungeKuttaFehlberg78 ),
+                            propagationTimeTerminationSettings( integrationArcEnds.at( i ) ) ) );
+        }
+        std::shared_ptr< MultiArcPropagatorSettings< double > > multiArcPropagatorSettings =
+                std::make_shared< MultiArcPropagatorSettings< double > >( arcPropagationSettingsList );
+
+        // Propagate in parallel for test case 1
+        if( testCase == 1 )
+        {
+            multiArcPropagatorSettings->getOutputSettings( )->setNumberOfThreads( 4 );
+        }
+
+        // Define parameters
+        std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames =
+                getInitialMultiArcParameterSettings< double, double >( multiArcPropagatorSettings, bodies, integrationArcStarts );
+        parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Earth", gravitational_parameter ) );
+        std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > > parametersToEstimate =
+                createParametersToEstimate< double, double >( parameterNames, bodies, multiArcPropagatorSettings );
+
+        MultiArcVariationalEquationsSolver< double, double > variationalEquations(
+                    bodies, multiArcPropagatorSettings, parametersToEstimate, true, arcWiseBodies );
+
+        // Retrieve state transition and sensitivity matrices at a number of epochs in each arc
+        for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+        {
+            std::vector< Eigen::MatrixXd > currentArcResults;
+            for( unsigned int j = 1; j < 5; j++ )
+            {
+                double testEpoch = integrationArcStarts.at( i ) + static_cast< double >( j ) * arcDuration / 5.0;
+                currentArcResults.push_back( variationalEquations.getStateTransitionMatrixInterface( )->
+                                             getCombinedStateTransitionAndSensitivityMatrix( testEpoch ) );
+            }
+
+            if( testCase == 0 )
+            {
+                sequentialResults[ i ] = currentArcResults;
+            }
+            else
+            {
+                // Results must be identical to sequential propagation on a single environment
+                for( unsigned int j = 0; j < currentArcResults.size( ); j++ )
+                {
+                    BOOST_CHECK_EQUAL( currentArcResults.at( j ).rows( ), sequentialResults.at( i ).at( j ).rows( ) );
+                    BOOST_CHECK_EQUAL( currentArcResults.at( j ).cols( ), sequentialResults.at( i ).at( j ).cols( ) );
+                    for( int k = 0; k < currentArcResults.at( j ).rows( ); k++ )
+                    {
+                        for( int l = 0; l < currentArcResults.at( j ).cols( ); l++ )
+                        {
+                            BOOST_CHECK_EQUAL( currentArcResults.at( j )( k, l ), sequentialResults.at( i ).at( j )( k, l ) );
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -0,0 +1,256 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/testMacros.h"
+#include "tudat/astro/basic_astro/orbitalElementConversions.h"
+#include "tudat/simulation/environment_setup/createBodies.h"
+#include "tudat/simulation/propagation_setup/createAccelerationModels.h"
+#include "tudat/simulation/propagation_setup/dynamicsSimulator.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace numerical_integrators;
+using namespace simulation_setup;
+using namespace propagators;
+
+BOOST_AUTO_TEST_SUITE( test_parallel_acceleration_update )
+
+//! Test if propagation of a constellation with acceleration models updated in parallel is identical to serial update
+BOOST_AUTO_TEST_CASE( testParallelAccelerationUpdate )
+{
+    // Create environment with (synthetic) spherical harmonic Earth and point-mass Moon
+    double earthGravitationalParameter = 3.986004418E14;
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( 9, 9 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( 9, 9 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    for( int degree = 2; degree < 9; degree++ )
+    {
+        for( int order = 0; order <= degree; order++ )
+        {
+            cosineCoefficients( degree, order ) = 1.0E-6 / static_cast< double >( degree + order );
+            sineCoefficients( degree, order ) = ( order == 0 ) ? 0.0 : -0.5E-6 / static_cast< double >( degree + order );
+        }
+    }
+
+    BodyListSettings bodySettings = BodyListSettings( "Earth", "ECLIPJ2000" );
+    bodySettings.addSettings( "Earth" );
+    bodySettings.at( "Earth" )->ephemerisSettings = constantEphemerisSettings( Eigen::Vector6d::Zero( ), "SSB" );
+    bodySettings.at( "Earth" )->rotationModelSettings = simpleRotationModelSettings(
+                "ECLIPJ2000", "IAU_Earth", Eigen::Quaterniond( Eigen::AngleAxisd( 0.4, Eigen::Vector3d::UnitX( ) ) ),
+                0.0, 7.2921E-5 );
+    bodySettings.at( "Earth" )->gravityFieldSettings = sphericalHarmonicsGravitySettings(
+                earthGravitationalParameter, 6378.0E3, cosineCoefficients, sineCoefficients, "IAU_Earth" );
+    bodySettings.addSettings( "Moon" );
+    bodySettings.at( "Moon" )->ephemerisSettings = constantEphemerisSettings(
+                ( Eigen::Vector6d( ) << 3.84E8, 0.0, 0.0, 0.0, 1.0E3, 0.0 ).finished( ), "SSB" );
+    bodySettings.at( "Moon" )->gravityFieldSettings = centralGravitySettings( 4.9028E12 );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+
+    // Create constellation
+    int numberOfSatellites = 12;
+    std::vector< std::string > bodiesToPropagate;
+    std::vector< std::string > centralBodies;
+    SelectedAccelerationMap accelerationSettings;
+    Eigen::VectorXd initialStates = Eigen::VectorXd( 6 * numberOfSatellites );
+    for( int i = 0; i < numberOfSatellites; i++ )
+    {
+        std::string satelliteName = "Satellite" + std::to_string( i );
+        bodies.createEmptyBody( satelliteName );
+        bodiesToPropagate.push_back( satelliteName );
+        centralBodies.push_back( "Earth" );
+        accelerationSettings[ satelliteName ][ "Earth" ].push_back( sphericalHarmonicAcceleration( 8, 8 ) );
+        accelerationSettings[ satelliteName ][ "Moon" ].push_back( pointMassGravityAcceleration( ) );
+
+        Eigen::Vector6d initialKeplerElements;
+        initialKeplerElements << 7000.0E3 + 100.0E3 * i, 0.01, 0.9, 0.1 * i, 0.5 * i, 0.3 * i;
+        initialStates.segment( 6 * i, 6 ) = orbital_element_conversions::convertKeplerianToCartesianElements(
+                    initialKeplerElements, earthGravitationalParameter );
+    }
+    basic_astrodynamics::AccelerationMap accelerationModels = createAccelerationModelsMap(
+                bodies, accelerationSettings, bodiesToPropagate, centralBodies );
+
+    // Propagate with serial and parallel update of accelerations
+    std::map< double, Eigen::VectorXd > serialStateHistory;
+    for( int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads += 3 )
+    {
+        std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                translationalStatePropagatorSettings< double >(
+                    centralBodies, accelerationModels, bodiesToPropagate, initialStates, 0.0,
+                    rungeKuttaVariableStepSettingsScalarTolerances(
+                        10.0, CoefficientSets::rungeKuttaFehlberg78, 1.0E-4, 1.0E4, 1.0E-12, 1.0E-12 ),
+                    propagationTimeTerminationSettings( 14400.0 ) );
+        propagatorSettings->setNumberOfAccelerationThreads( numberOfThreads );
+        BOOST_CHECK_EQUAL( propagatorSettings->getNumberOfAccelerationThreads( ), numberOfThreads );
+
+        SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+        std::shared_ptr< NBodyStateDerivative< double, double > > stateDerivativeModel =
+                std::dynamic_pointer_cast< NBodyStateDerivative< double, double > >(
+                    dynamicsSimulator.getDynamicsStateDerivative( )->getStateDerivativeModels( ).at(
+                        translational_state ).at( 0 ) );
+        BOOST_CHECK_EQUAL( stateDerivativeModel->getNumberOfParallelThreads( ), numberOfThreads );
+
+        std::map< double, Eigen::VectorXd > stateHistory =
+                dynamicsSimulator.getSingleArcPropagationResults( )->getEquationsOfMotionNumericalSolution( );
+        if( numberOfThreads == 1 )
+        {
+            serialStateHistory = stateHistory;
+        }
+        else
+        {
+            // Check that results are identical to those of the serial update
+            BOOST_CHECK_EQUAL( stateHistory.size( ), serialStateHistory.size( ) );
+            auto serialIterator = serialStateHistory.begin( );
+            for( auto stateIterator : stateHistory )
+            {
+                BOOST_CHECK_EQUAL( stateIterator.first, serialIterator->first );
+                for( int i = 0; i < stateIterator.second.rows( ); i++ )
+                {
+                    BOOST_CHECK_EQUAL( stateIterator.second( i ), serialIterator->second( i ) );
+                }
+                serialIterator++;
+            }
+        }
+    }
+
+    // Check that invalid number of threads is rejected
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            translationalStatePropagatorSettings< double >(
+                centralBodies, accelerationModels, bodiesToPropagate, initialStates, 0.0,
+                rungeKuttaFixedStepSettings( 10.0, CoefficientSets::rungeKutta4Classic ),
+                propagationTimeTerminationSettings( 100.0 ) );
+    BOOST_CHECK_THROW( propagatorSettings->setNumberOfAccelerationThreads( 0 ), std::runtime_error );
+}
+
+//! Test if propagation of mutually attracting bodies with the all-pairs point-mass kernel is equal to that with separate models
+BOOST_AUTO_TEST_CASE( testMutualPointMassGravityKernel )
+{
+    // Create environment with fixed Sun and set of mutually attracting (massive) asteroids
+    double sunGravitationalParameter = 1.32712440018E20;
+    int numberOfAsteroids = 10;
+    BodyListSettings bodySettings = BodyListSettings( "SSB", "ECLIPJ2000" );
+    bodySettings.addSettings( "Sun" );
+    bodySettings.at( "Sun" )->ephemerisSettings = constantEphemerisSettings( Eigen::Vector6d::Zero( ), "SSB" );
+    bodySettings.at( "Sun" )->gravityFieldSettings = centralGravitySettings( sunGravitationalParameter );
+    for( int i = 0; i < numberOfAsteroids; i++ )
+    {
+        std::string asteroidName = "Asteroid" + std::to_string( i );
+        bodySettings.addSettings( asteroidName );
+        bodySettings.at( asteroidName )->gravityFieldSettings = centralGravitySettings( 1.0E15 * ( i + 1 ) );
+    }
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+
+    // Define point-mass accelerations of Sun and all other asteroids (except Asteroid9 on Asteroid0)
+    std::vector< std::string > bodiesToPropagate;
+    std::vector< std::string > centralBodies;
+    SelectedAccelerationMap accelerationSettings;
+    Eigen::VectorXd initialStates = Eigen::VectorXd( 6 * numberOfAsteroids );
+    for( int i = 0; i < numberOfAsteroids; i++ )
+    {
+        std::string asteroidName = "Asteroid" + std::to_string( i );
+        bodiesToPropagate.push_back( asteroidName );
+        centralBodies.push_back( "SSB" );
+        accelerationSettings[ asteroidName ][ "Sun" ].push_back( pointMassGravityAcceleration( ) );
+        for( int j = 0; j < numberOfAsteroids; j++ )
+        {
+            if( j != i && !( i == 0 && j == numberOfAsteroids - 1 ) )
+            {
+                accelerationSettings[ asteroidName ][ "Asteroid" + std::to_string( j ) ].push_back(
+                            pointMassGravityAcceleration( ) );
+            }
+        }
+
+        Eigen::Vector6d initialKeplerElements;
+        initialKeplerElements << 3.0E11 + 1.0E9 * i, 0.1, 0.05 * i, 0.1 * i, 0.5 * i, 0.3 * i;
+        initialStates.segment( 6 * i, 6 ) = orbital_element_conversions::convertKeplerianToCartesianElements(
+                    initialKeplerElements, sunGravitationalParameter );
+    }
+    basic_astrodynamics::AccelerationMap accelerationModels = createAccelerationModelsMap(
+                bodies, accelerationSettings, bodiesToPropagate, centralBodies );
+
+    std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables;
+    dependentVariables.push_back( singleAccelerationDependentVariable(
+                basic_astrodynamics::point_mass_gravity, "Asteroid0", "Asteroid1" ) );
+    dependentVariables.push_back( totalAccelerationDependentVariable( "Asteroid0" ) );
+
+    // Propagate with separate acceleration models, and with kernel (serial and parallel)
+    std::map< double, Eigen::VectorXd > referenceStateHistory;
+    std::map< double, Eigen::VectorXd > referenceDependentVariableHistory;
+    for( int test = 0; test < 3; test++ )
+    {
+        std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                translationalStatePropagatorSettings< double >(
+                    centralBodies, accelerationModels, bodiesToPropagate, initialStates, 0.0,
+                    rungeKuttaFixedStepSettings( 86400.0, CoefficientSets::rungeKutta4Classic ),
+                    propagationTimeTerminationSettings( 100.0 * 86400.0 ), cowell, dependentVariables );
+        propagatorSettings->setUseMutualPointMassGravityKernel( test > 0 );
+        propagatorSettings->setNumberOfAccelerationThreads( test < 2 ? 1 : 4 );
+        BOOST_CHECK_EQUAL( propagatorSettings->getUseMutualPointMassGravityKernel( ), test > 0 );
+
+        SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+        std::shared_ptr< NBodyStateDerivative< double, double > > stateDerivativeModel =
+                std::dynamic_pointer_cast< NBodyStateDerivative< double, double > >(
+                    dynamicsSimulator.getDynamicsStateDerivative( )->getStateDerivativeModels( ).at(
+                        translational_state ).at( 0 ) );
+
+        std::map< double, Eigen::VectorXd > stateHistory =
+                dynamicsSimulator.getSingleArcPropagationResults( )->getEquationsOfMotionNumericalSolution( );
+        std::map< double, Eigen::VectorXd > dependentVariableHistory =
+                dynamicsSimulator.getSingleArcPropagationResults( )->getDependentVariableHistory( );
+        if( test == 0 )
+        {
+            BOOST_CHECK( stateDerivativeModel->getMutualPointMassGravityKernel( ) == nullptr );
+            referenceStateHistory = stateHistory;
+            referenceDependentVariableHistory = dependentVariableHistory;
+        }
+        else
+        {
+            // Check that kernel includes all accelerations between asteroids (and none of the Sun)
+            BOOST_CHECK_EQUAL( stateDerivativeModel->getMutualPointMassGravityKernel( )->getNumberOfBodies( ),
+                               numberOfAsteroids );
+            BOOST_CHECK_EQUAL( stateDerivativeModel->getMutualPointMassGravityKernel( )->getNumberOfInteractions( ),
+                               numberOfAsteroids * ( numberOfAsteroids - 1 ) - 1 );
+
+            // Check that states and dependent variables are equal up to round-off
+            BOOST_CHECK_EQUAL( stateHistory.size( ), referenceStateHistory.size( ) );
+            auto referenceIterator = referenceStateHistory.begin( );
+            for( auto stateIterator : stateHistory )
+            {
+                BOOST_CHECK_EQUAL( stateIterator.first, referenceIterator->first );
+                TUDAT_CHECK_MATRIX_CLOSE_FRACTION( stateIterator.second, referenceIterator->second, 1.0E-12 );
+                referenceIterator++;
+            }
+
+            referenceIterator = referenceDependentVariableHistory.begin( );
+            for( auto dependentVariableIterator : dependentVariableHistory )
+            {
+                TUDAT_CHECK_MATRIX_CLOSE_FRACTION( dependentVariableIterator.second, referenceIterator->second, 1.0E-12 );
+                referenceIterator++;
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}
+
+}
@@ -0,0 +1,168 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/astro/basic_astro/orbitalElementConversions.h"
+#include "tudat/simulation/environment_setup/createBodies.h"
+#include "tudat/simulation/propagation_setup/createAccelerationModels.h"
+#include "tudat/simulation/propagation_setup/pararealDynamicsSimulator.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace numerical_integrators;
+using namespace simulation_setup;
+using namespace propagators;
+
+BOOST_AUTO_TEST_SUITE( test_parareal_propagation )
+
+// Create environment with Earth (spherical harmonic gravity up to J2) and an empty vehicle
+SystemOfBodies createPararealTestBodies( )
+{
+    BodyListSettings bodySettings = BodyListSettings( "Earth", "ECLIPJ2000" );
+    bodySettings.addSettings( "Earth" );
+    bodySettings.at( "Earth" )->ephemerisSettings = constantEphemerisSettings( Eigen::Vector6d::Zero( ), "SSB" );
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( 3, 3 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    cosineCoefficients( 2, 0 ) = -4.84165371736E-4;
+    bodySettings.at( "Earth" )->gravityFieldSettings = sphericalHarmonicsGravitySettings(
+                3.986004418E14, 6378137.0, cosineCoefficients, Eigen::MatrixXd::Zero( 3, 3 ), "IAU_Earth" );
+    bodySettings.at( "Earth" )->rotationModelSettings = simpleRotationModelSettings(
+                "ECLIPJ2000", "IAU_Earth", Eigen::Quaterniond( Eigen::Matrix3d::Identity( ) ), 0.0, 0.0 );
+
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.at( "Vehicle" )->setConstantBodyMass( 1000.0 );
+    return bodies;
+}
+
+// Create fine (J2, RKF78) or coarse (point mass, large-step RK4) propagator settings
+std::shared_ptr< SingleArcPropagatorSettings< double > > createPararealTestPropagatorSettings(
+        const SystemOfBodies& bodies, const bool isCoarse )
+{
+    SelectedAccelerationMap accelerationSettings;
+    if( isCoarse )
+    {
+        accelerationSettings[ "Vehicle" ][ "Earth" ].push_back( pointMassGravityAcceleration( ) );
+    }
+    else
+    {
+        accelerationSettings[ "Vehicle" ][ "Earth" ].push_back( sphericalHarmonicAcceleration( 2, 0 ) );
+    }
+
+    basic_astrodynamics::AccelerationMap accelerationModels = createAccelerationModelsMap(
+                bodies, accelerationSettings, { "Vehicle" }, { "Earth" } );
+
+    Eigen::Vector6d initialKeplerElements;
+    initialKeplerElements << 7000.0E3, 0.05, 0.8, 0.2, 0.3, 0.4;
+    Eigen::Vector6d initialState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                initialKeplerElements, 3.986004418E14 );
+
+    std::shared_ptr< IntegratorSettings< double > > integratorSettings;
+    if( isCoarse )
+    {
+        integratorSettings = rungeKuttaFixedStepSettings( 60.0, CoefficientSets::rungeKutta4Classic );
+    }
+    else
+    {
+        integratorSettings = rungeKuttaVariableStepSettingsScalarTolerances(
+                    10.0, CoefficientSets::rungeKuttaFehlberg78, 1.0E-4, 1.0E4, 1.0E-12, 1.0E-12 );
+    }
+
+    return translationalStatePropagatorSettings< double >(
+                { "Earth" }, accelerationModels, { "Vehicle" }, initialState, 0.0, integratorSettings,
+                propagationTimeTerminationSettings( 4.0 * 86400.0, true ) );
+}
+
+//! Test if Parareal propagation converges to the sequential fine propagation
+BOOST_AUTO_TEST_CASE( testPararealPropagation )
+{
+    // Propagate sequentially with fine propagator
+    SystemOfBodies bodies = createPararealTestBodies( );
+    std::shared_ptr< SingleArcPropagatorSettings< double > > propagatorSettings =
+            createPararealTestPropagatorSettings( bodies, false );
+    SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+    std::map< double, Eigen::VectorXd > sequentialResults = dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+    Eigen::VectorXd sequentialFinalState = sequentialResults.rbegin( )->second;
+
+    int numberOfSlices = 8;
+    for( int numberOfWorkers = 1; numberOfWorkers <= 4; numberOfWorkers *= 2 )
+    {
+        std::vector< SystemOfBodies > workerBodies;
+        std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > workerPropagatorSettings;
+        for( int i = 0; i < numberOfWorkers; i++ )
+        {
+            workerBodies.push_back( createPararealTestBodies( ) );
+            workerPropagatorSettings.push_back( createPararealTestPropagatorSettings( workerBodies.at( i ), false ) );
+        }
+        SystemOfBodies coarseBodies = createPararealTestBodies( );
+        std::shared_ptr< SingleArcPropagatorSettings< double > > coarsePropagatorSettings =
+                createPararealTestPropagatorSettings( coarseBodies, true );
+
+        PararealDynamicsSimulator< > pararealSimulator(
+                    workerBodies, workerPropagatorSettings, coarseBodies, coarsePropagatorSettings,
+                    pararealSettings( numberOfSlices, -1, 1.0E-12 ) );
+        BOOST_CHECK_EQUAL( pararealSimulator.getNumberOfWorkers( ), numberOfWorkers );
+        pararealSimulator.propagate( );
+
+        // Check convergence diagnostics
+        BOOST_CHECK( pararealSimulator.getIsConverged( ) );
+        BOOST_CHECK( pararealSimulator.getNumberOfIterations( ) <= numberOfSlices );
+        std::vector< double > corrections = pararealSimulator.getMaximumRelativeCorrections( );
+        BOOST_CHECK_EQUAL( static_cast< int >( corrections.size( ) ), pararealSimulator.getNumberOfIterations( ) );
+        BOOST_CHECK( corrections.back( ) <= 1.0E-12 );
+        BOOST_CHECK( pararealSimulator.getNumberOfFineFunctionEvaluations( ) > 0 );
+        BOOST_CHECK( pararealSimulator.getNumberOfCoarseFunctionEvaluations( ) > 0 );
+
+        // Compare final state with that of sequential propagation
+        std::map< double, Eigen::VectorXd > pararealResults = pararealSimulator.getEquationsOfMotionNumericalSolution( );
+        BOOST_CHECK_CLOSE_FRACTION( pararealResults.begin( )->first, 0.0, 1.0E-15 );
+        BOOST_CHECK_CLOSE_FRACTION( pararealResults.rbegin( )->first, 4.0 * 86400.0, 1.0E-15 );
+        for( int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( pararealResults.rbegin( )->second( j ) - sequentialFinalState( j ), 1.0E-1 );
+            BOOST_CHECK_SMALL( pararealResults.rbegin( )->second( j + 3 ) - sequentialFinalState( j + 3 ), 1.0E-4 );
+        }
+        BOOST_CHECK_EQUAL( static_cast< int >( pararealSimulator.getSliceResults( ).size( ) ), numberOfSlices );
+
+        // Check that settings are restored
+        BOOST_CHECK_EQUAL( coarsePropagatorSettings->getInitialTime( ), 0.0 );
+        BOOST_CHECK_CLOSE_FRACTION(
+                    std::dynamic_pointer_cast< PropagationTimeTerminationSettings >(
+                        workerPropagatorSettings.at( 0 )->getTerminationSettings( ) )->terminationTime_, 4.0 * 86400.0, 1.0E-15 );
+    }
+
+    // Check that iterations are stopped at the maximum number of iterations
+    SystemOfBodies fineBodies = createPararealTestBodies( );
+    SystemOfBodies coarseBodies = createPararealTestBodies( );
+    PararealDynamicsSimulator< > pararealSimulator(
+                { fineBodies }, { createPararealTestPropagatorSettings( fineBodies, false ) },
+                coarseBodies, createPararealTestPropagatorSettings( coarseBodies, true ),
+                pararealSettings( numberOfSlices, 1, 1.0E-12 ) );
+    pararealSimulator.propagate( );
+    BOOST_CHECK_EQUAL( pararealSimulator.getNumberOfIterations( ), 1 );
+    BOOST_CHECK( !pararealSimulator.getIsConverged( ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}
+
+}
@@ -0,0 +1,213 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/astro/ephemerides/constantEphemeris.h"
+#include "tudat/astro/ephemerides/keplerEphemeris.h"
+#include "tudat/astro/ephemerides/preInterpolatedEphemeris.h"
+#include "tudat/math/integrators/rungeKuttaCoefficients.h"
+#include "tudat/simulation/environment_setup/body.h"
+#include "tudat/simulation/propagation_setup/dynamicsSimulator.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::ephemerides;
+using namespace tudat::simulation_setup;
+using namespace tudat::propagators;
+using namespace tudat::numerical_integrators;
+
+BOOST_AUTO_TEST_SUITE( test_perturbing_body_ephemeris_interpolation )
+
+//! Function to create a system of bodies with Kepler ephemerides for the Earth and Moon, and a vehicle
+SystemOfBodies getTestBodies( )
+{
+    SystemOfBodies bodies;
+    bodies.createEmptyBody( "Sun", false );
+    bodies.createEmptyBody( "Earth", false );
+    bodies.createEmptyBody( "Moon", false );
+    bodies.createEmptyBody( "Vehicle", false );
+
+    bodies.at( "Sun" )->setEphemeris( std::make_shared< ConstantEphemeris >(
+                                          [ ]( ){ return Eigen::Vector6d::Zero( ); }, "SSB", "ECLIPJ2000" ) );
+    bodies.at( "Earth" )->setEphemeris( std::make_shared< KeplerEphemeris >(
+                                            ( Eigen::Vector6d( ) << 1.496E11, 0.0167, 0.0, 1.8, 0.0, 0.3 ).finished( ),
+                                            0.0, 1.32712440018E20, "SSB", "ECLIPJ2000" ) );
+    bodies.at( "Moon" )->setEphemeris( std::make_shared< KeplerEphemeris >(
+                                           ( Eigen::Vector6d( ) << 3.844E8, 0.0549, 0.09, 0.4, 1.2, 2.0 ).finished( ),
+                                           0.0, 4.035E14, "Earth", "ECLIPJ2000" ) );
+    bodies.processBodyFrameDefinitions( );
+
+    bodies.at( "Sun" )->setGravityFieldModel( std::make_shared< gravitation::GravityFieldModel >( 1.32712440018E20 ) );
+    bodies.at( "Earth" )->setGravityFieldModel( std::make_shared< gravitation::GravityFieldModel >( 3.986004418E14 ) );
+    bodies.at( "Moon" )->setGravityFieldModel( std::make_shared< gravitation::GravityFieldModel >( 4.9028E12 ) );
+    bodies.at( "Vehicle" )->setConstantBodyMass( 500.0 );
+    return bodies;
+}
+
+//! Function to create propagator settings for a vehicle orbiting the Earth, perturbed by the Sun and Moon
+std::shared_ptr< TranslationalStatePropagatorSettings< double > > getTestPropagatorSettings(
+        const SystemOfBodies& bodies,
+        const std::shared_ptr< PropagationTerminationSettings > terminationSettings )
+{
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back( pointMassGravityAcceleration( ) );
+    accelerationSettings[ "Vehicle" ][ "Moon" ].push_back( pointMassGravityAcceleration( ) );
+    accelerationSettings[ "Vehicle" ][ "Sun" ].push_back( pointMassGravityAcceleration( ) );
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodies, accelerationSettings, { "Vehicle" }, { "Earth" } );
+
+    Eigen::Vector6d initialState;
+    initialState << 4.2E7, 0.0, 0.0, 0.0, 3.0E3, 0.5E3;
+    return translationalStatePropagatorSettings< double >(
+                { "Earth" }, accelerationModelMap, { "Vehicle" }, initialState, 0.0,
+                rungeKuttaFixedStepSettings( 60.0, CoefficientSets::rungeKutta4Classic ),
+                terminationSettings );
+}
+
+//! Test whether propagation with fitted perturbing body ephemerides reproduces propagation with original ephemerides
+BOOST_AUTO_TEST_CASE( testPerturbingBodyEphemerisInterpolation )
+{
+    SystemOfBodies bodies = getTestBodies( );
+    std::shared_ptr< Ephemeris > originalEarthEphemeris = bodies.at( "Earth" )->getEphemeris( );
+    std::shared_ptr< Ephemeris > originalMoonEphemeris = bodies.at( "Moon" )->getEphemeris( );
+    std::shared_ptr< Ephemeris > originalSunEphemeris = bodies.at( "Sun" )->getEphemeris( );
+
+    double finalTime = 2.0 * 86400.0;
+
+    // Propagate with original ephemerides
+    SingleArcDynamicsSimulator< double, double > nominalDynamicsSimulator(
+                bodies, getTestPropagatorSettings( bodies, propagationTimeTerminationSettings( finalTime ) ) );
+    std::map< double, Eigen::VectorXd > nominalStates = nominalDynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+
+    // Propagate with fitted ephemerides
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            getTestPropagatorSettings( bodies, propagationTimeTerminationSettings( finalTime ) );
+    propagatorSettings->getOutputSettings( )->setPerturbingBodyEphemerisInterpolationSettings(
+                std::make_shared< PerturbingBodyEphemerisInterpolationSettings >( 1.0E-4, 1.0E-7 ) );
+    SingleArcDynamicsSimulator< double, double > dynamicsSimulator( bodies, propagatorSettings );
+    std::map< double, Eigen::VectorXd > states = dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+
+    // Check that only ephemerides of non-propagated, non-constant bodies are fitted, and that original ephemerides are restored
+    std::shared_ptr< PerturbingBodyEphemerisInterpolator > ephemerisInterpolator =
+            dynamicsSimulator.getPerturbingBodyEphemerisInterpolator( );
+    std::map< std::string, std::shared_ptr< PreInterpolatedEphemeris > > fittedEphemerides =
+            ephemerisInterpolator->getInterpolatedEphemerides( );
+    BOOST_CHECK_EQUAL( fittedEphemerides.size( ), 2 );
+    BOOST_CHECK_EQUAL( fittedEphemerides.count( "Earth" ), 1 );
+    BOOST_CHECK_EQUAL( fittedEphemerides.count( "Moon" ), 1 );
+    BOOST_CHECK_EQUAL( ephemerisInterpolator->getNumberOfEphemerisFits( ), 2 );
+    BOOST_CHECK( !ephemerisInterpolator->areEphemeridesReplaced( ) );
+    BOOST_CHECK( bodies.at( "Earth" )->getEphemeris( ) == originalEarthEphemeris );
+    BOOST_CHECK( bodies.at( "Moon" )->getEphemeris( ) == originalMoonEphemeris );
+    BOOST_CHECK( bodies.at( "Sun" )->getEphemeris( ) == originalSunEphemeris );
+
+    // Check fitted interval, and fit of ephemerides in and outside of this interval
+    std::shared_ptr< PreInterpolatedEphemeris > moonFit = fittedEphemerides.at( "Moon" );
+    BOOST_CHECK_EQUAL( moonFit->getFittedInterval( ).first, -3600.0 );
+    BOOST_CHECK_EQUAL( moonFit->getFittedInterval( ).second, finalTime + 3600.0 );
+    BOOST_CHECK_EQUAL( moonFit->getReferenceFrameOrigin( ), "Earth" );
+    for( double testTime = -3000.0; testTime < finalTime + 3000.0; testTime += 1234.5 )
+    {
+        Eigen::Vector6d stateDifference =
+                moonFit->getCartesianState( testTime ) - originalMoonEphemeris->getCartesianState( testTime );
+        BOOST_CHECK_SMALL( stateDifference.segment< 3 >( 0 ).norm( ), 1.0E-4 );
+        BOOST_CHECK_SMALL( stateDifference.segment< 3 >( 3 ).norm( ), 1.0E-7 );
+    }
+    BOOST_CHECK( moonFit->getCartesianState( finalTime + 1.0E4 ) ==
+                 originalMoonEphemeris->getCartesianState( finalTime + 1.0E4 ) );
+
+    // Check propagated states
+    BOOST_CHECK_EQUAL( states.size( ), nominalStates.size( ) );
+    for( auto stateIterator : nominalStates )
+    {
+        Eigen::VectorXd stateDifference = states.at( stateIterator.first ) - stateIterator.second;
+        BOOST_CHECK_SMALL( stateDifference.segment( 0, 3 ).norm( ), 1.0E-5 );
+        BOOST_CHECK_SMALL( stateDifference.segment( 3, 3 ).norm( ), 1.0E-8 );
+    }
+
+    // Check that fits are reused when re-propagating
+    dynamicsSimulator.integrateEquationsOfMotion( propagatorSettings->getInitialStates( ) );
+    BOOST_CHECK_EQUAL( ephemerisInterpolator->getNumberOfEphemerisFits( ), 2 );
+    BOOST_CHECK( ephemerisInterpolator->getInterpolatedEphemerides( ).at( "Moon" ) == moonFit );
+
+    // Check that only modified ephemeris is refitted
+    bodies.at( "Earth" )->setEphemeris( std::make_shared< KeplerEphemeris >(
+                                            ( Eigen::Vector6d( ) << 1.5E11, 0.0167, 0.0, 1.8, 0.0, 0.3 ).finished( ),
+                                            0.0, 1.32712440018E20, "SSB", "ECLIPJ2000" ) );
+    dynamicsSimulator.integrateEquationsOfMotion( propagatorSettings->getInitialStates( ) );
+    BOOST_CHECK_EQUAL( ephemerisInterpolator->getNumberOfEphemerisFits( ), 3 );
+    BOOST_CHECK( ephemerisInterpolator->getInterpolatedEphemerides( ).at( "Moon" ) == moonFit );
+}
+
+//! Test whether the settings for the fitted interval are correctly processed
+BOOST_AUTO_TEST_CASE( testPerturbingBodyEphemerisInterpolationInterval )
+{
+    std::shared_ptr< PerturbingBodyEphemerisInterpolationSettings > interpolationSettings =
+            std::make_shared< PerturbingBodyEphemerisInterpolationSettings >( );
+
+    // Check interval for time termination (also for backwards propagation)
+    std::pair< double, double > interval = getPerturbingBodyEphemerisInterpolationInterval(
+                1000.0, propagationTimeTerminationSettings( 5000.0 ), interpolationSettings );
+    BOOST_CHECK_EQUAL( interval.first, 1000.0 - 3600.0 );
+    BOOST_CHECK_EQUAL( interval.second, 5000.0 + 3600.0 );
+
+    interval = getPerturbingBodyEphemerisInterpolationInterval(
+                1000.0, propagationTimeTerminationSettings( -5000.0 ), interpolationSettings );
+    BOOST_CHECK_EQUAL( interval.first, -5000.0 - 3600.0 );
+    BOOST_CHECK_EQUAL( interval.second, 1000.0 + 3600.0 );
+
+    // Check interval for hybrid termination, which is only bounded if a single time condition suffices
+    std::shared_ptr< PropagationTerminationSettings > customTerminationSettings =
+            std::make_shared< PropagationCustomTerminationSettings >( [ ]( const double ){ return false; } );
+    interval = getPerturbingBodyEphemerisInterpolationInterval(
+                0.0, std::make_shared< PropagationHybridTerminationSettings >(
+                    std::vector< std::shared_ptr< PropagationTerminationSettings > >(
+                        { customTerminationSettings, propagationTimeTerminationSettings( 5000.0 ) } ), true ),
+                interpolationSettings );
+    BOOST_CHECK_EQUAL( interval.second, 5000.0 + 3600.0 );
+
+    bool isExceptionCaught = false;
+    try
+    {
+        getPerturbingBodyEphemerisInterpolationInterval(
+                    0.0, std::make_shared< PropagationHybridTerminationSettings >(
+                        std::vector< std::shared_ptr< PropagationTerminationSettings > >(
+                            { customTerminationSettings, propagationTimeTerminationSettings( 5000.0 ) } ), false ),
+                    interpolationSettings );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+
+    // Check that explicit final time is used if provided
+    interpolationSettings->finalTime_ = 2.0E4;
+    interval = getPerturbingBodyEphemerisInterpolationInterval(
+                0.0, customTerminationSettings, interpolationSettings );
+    BOOST_CHECK_EQUAL( interval.first, -3600.0 );
+    BOOST_CHECK_EQUAL( interval.second, 2.0E4 + 3600.0 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,277 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <cstdio>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/astro/basic_astro/orbitalElementConversions.h"
+#include "tudat/simulation/environment_setup/createBodies.h"
+#include "tudat/simulation/propagation_setup/createAccelerationModels.h"
+#include "tudat/simulation/propagation_setup/dynamicsSimulator.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace numerical_integrators;
+using namespace simulation_setup;
+using namespace propagators;
+
+BOOST_AUTO_TEST_SUITE( test_propagation_checkpoint )
+
+// Check if two histories are identical
+void checkHistoriesAreEqual( const std::map< double, Eigen::VectorXd >& history,
+                             const std::map< double, Eigen::VectorXd >& expectedHistory )
+{
+    BOOST_CHECK_EQUAL( history.size( ), expectedHistory.size( ) );
+    if( history.size( ) == expectedHistory.size( ) )
+    {
+        auto expectedIterator = expectedHistory.begin( );
+        for( auto historyIterator : history )
+        {
+            BOOST_CHECK_EQUAL( historyIterator.first, expectedIterator->first );
+            BOOST_CHECK_EQUAL( historyIterator.second.rows( ), expectedIterator->second.rows( ) );
+            for( int i = 0; i < historyIterator.second.rows( ); i++ )
+            {
+                BOOST_CHECK_EQUAL( historyIterator.second( i ), expectedIterator->second( i ) );
+            }
+            expectedIterator++;
+        }
+    }
+}
+
+//! Test if propagation resumed from a checkpoint is identical to an uninterrupted propagation
+BOOST_AUTO_TEST_CASE( testPropagationCheckpoint )
+{
+    // Create environment with point-mass Earth and Moon
+    double earthGravitationalParameter = 3.986004418E14;
+    BodyListSettings bodySettings = BodyListSettings( "Earth", "ECLIPJ2000" );
+    bodySettings.addSettings( "Earth" );
+    bodySettings.at( "Earth" )->ephemerisSettings = constantEphemerisSettings( Eigen::Vector6d::Zero( ), "SSB" );
+    bodySettings.at( "Earth" )->gravityFieldSettings = centralGravitySettings( earthGravitationalParameter );
+    bodySettings.addSettings( "Moon" );
+    bodySettings.at( "Moon" )->ephemerisSettings = constantEphemerisSettings(
+                ( Eigen::Vector6d( ) << 3.84E8, 0.0, 0.0, 0.0, 1.0E3, 0.0 ).finished( ), "SSB" );
+    bodySettings.at( "Moon" )->gravityFieldSettings = centralGravitySettings( 4.9028E12 );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+    bodies.createEmptyBody( "Vehicle" );
+
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back( pointMassGravityAcceleration( ) );
+    accelerationSettings[ "Vehicle" ][ "Moon" ].push_back( pointMassGravityAcceleration( ) );
+    basic_astrodynamics::AccelerationMap accelerationModels = createAccelerationModelsMap(
+                bodies, accelerationSettings, { "Vehicle" }, { "Earth" } );
+
+    Eigen::Vector6d initialKeplerElements;
+    initialKeplerElements << 7000.0E3, 0.1, 0.6, 0.2, 0.3, 0.4;
+    Eigen::Vector6d initialState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                initialKeplerElements, earthGravitationalParameter );
+
+    std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables;
+    dependentVariables.push_back( keplerianStateDependentVariable( "Vehicle", "Earth" ) );
+
+    std::string checkpointFile = "propagationCheckpointTestOutput.dat";
+
+    // Test variable step Runge-Kutta, fixed step Runge-Kutta and Adams-Bashforth-Moulton integrators, with map and
+    // contiguous storage of results
+    for( unsigned int integratorIndex = 0; integratorIndex < 3; integratorIndex++ )
+    {
+        for( unsigned int storageIndex = 0; storageIndex < 2; storageIndex++ )
+        {
+            std::shared_ptr< IntegratorSettings< double > > integratorSettings;
+            if( integratorIndex == 0 )
+            {
+                integratorSettings = rungeKuttaVariableStepSettingsScalarTolerances(
+                            10.0, CoefficientSets::rungeKuttaFehlberg78, 1.0E-4, 1.0E4, 1.0E-12, 1.0E-12 );
+            }
+            else if( integratorIndex == 1 )
+            {
+                integratorSettings = rungeKuttaFixedStepSettings( 30.0, CoefficientSets::rungeKutta4Classic );
+            }
+            else
+            {
+                integratorSettings = adamsBashforthMoultonSettings( 10.0, 1.0E-4, 1.0E4, 1.0E-12, 1.0E-12 );
+            }
+
+            // Propagate uninterrupted (0), up to intermediate time writing checkpoints (1), and resumed from checkpoint (2)
+            std::map< double, Eigen::VectorXd > stateHistory;
+            std::map< double, Eigen::VectorXd > dependentVariableHistory;
+            for( unsigned int testCase = 0; testCase < 3; testCase++ )
+            {
+                std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                        translationalStatePropagatorSettings< double >(
+                            { "Earth" }, accelerationModels, { "Vehicle" }, initialState, 0.0, integratorSettings,
+                            propagationTimeTerminationSettings( ( testCase == 1 ) ? 43200.0 : 86400.0 ),
+                            cowell, dependentVariables );
+                propagatorSettings->getOutputSettings( )->setUseContiguousResultStorage( storageIndex == 1 );
+                if( testCase == 1 )
+                {
+                    propagatorSettings->getOutputSettings( )->setCheckpointFile( checkpointFile, 25 );
+                }
+                else if( testCase == 2 )
+                {
+                    propagatorSettings->getOutputSettings( )->setResumeFromCheckpointFile( checkpointFile );
+                }
+
+                SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+                std::shared_ptr< SingleArcSimulationResults< double, double > > propagationResults =
+                        dynamicsSimulator.getSingleArcPropagationResults( );
+                if( testCase == 0 )
+                {
+                    stateHistory = propagationResults->getEquationsOfMotionNumericalSolution( );
+                    dependentVariableHistory = propagationResults->getDependentVariableHistory( );
+                }
+                else if( testCase == 1 )
+                {
+                    BOOST_CHECK( propagationResults->getEquationsOfMotionNumericalSolution( ).rbegin( )->first < 86400.0 );
+                }
+                else
+                {
+                    // Check that resumed propagation is identical to uninterrupted propagation
+                    checkHistoriesAreEqual( propagationResults->getEquationsOfMotionNumericalSolution( ), stateHistory );
+                    checkHistoriesAreEqual( propagationResults->getDependentVariableHistory( ), dependentVariableHistory );
+                    BOOST_CHECK_EQUAL( propagationResults->getPropagationTerminationReason( )->getPropagationTerminationReason( ),
+                                       termination_condition_reached );
+                }
+            }
+            std::remove( checkpointFile.c_str( ) );
+        }
+    }
+
+    // Check that invalid checkpoint settings are rejected
+    std::shared_ptr< SingleArcPropagatorProcessingSettings > processingSettings =
+            std::make_shared< SingleArcPropagatorProcessingSettings >( );
+    BOOST_CHECK_THROW( processingSettings->setCheckpointFile( checkpointFile, 0 ), std::runtime_error );
+    BOOST_CHECK_THROW( ( readSingleArcPropagationCheckpoint< Eigen::MatrixXd, double, double >( "nonExistentCheckpoint.dat" ) ),
+                       std::runtime_error );
+}
+
+//! Test if propagation extended after completion is identical to a single propagation up to the final time
+BOOST_AUTO_TEST_CASE( testPropagationExtension )
+{
+    // Create environment with point-mass Earth and Moon
+    double earthGravitationalParameter = 3.986004418E14;
+    BodyListSettings bodySettings = BodyListSettings( "Earth", "ECLIPJ2000" );
+    bodySettings.addSettings( "Earth" );
+    bodySettings.at( "Earth" )->ephemerisSettings = constantEphemerisSettings( Eigen::Vector6d::Zero( ), "SSB" );
+    bodySettings.at( "Earth" )->gravityFieldSettings = centralGravitySettings( earthGravitationalParameter );
+    bodySettings.addSettings( "Moon" );
+    bodySettings.at( "Moon" )->ephemerisSettings = constantEphemerisSettings(
+                ( Eigen::Vector6d( ) << 3.84E8, 0.0, 0.0, 0.0, 1.0E3, 0.0 ).finished( ), "SSB" );
+    bodySettings.at( "Moon" )->gravityFieldSettings = centralGravitySettings( 4.9028E12 );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+    bodies.createEmptyBody( "Vehicle" );
+
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back( pointMassGravityAcceleration( ) );
+    accelerationSettings[ "Vehicle" ][ "Moon" ].push_back( pointMassGravityAcceleration( ) );
+    basic_astrodynamics::AccelerationMap accelerationModels = createAccelerationModelsMap(
+                bodies, accelerationSettings, { "Vehicle" }, { "Earth" } );
+
+    Eigen::Vector6d initialKeplerElements;
+    initialKeplerElements << 7000.0E3, 0.1, 0.6, 0.2, 0.3, 0.4;
+    Eigen::Vector6d initialState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                initialKeplerElements, earthGravitationalParameter );
+
+    std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables;
+    dependentVariables.push_back( keplerianStateDependentVariable( "Vehicle", "Earth" ) );
+
+    // Test variable step Runge-Kutta, fixed step Runge-Kutta and Adams-Bashforth-Moulton integrators, with map and
+    // contiguous storage of results
+    for( unsigned int integratorIndex = 0; integratorIndex < 3; integratorIndex++ )
+    {
+        for( unsigned int storageIndex = 0; storageIndex < 2; storageIndex++ )
+        {
+            std::shared_ptr< IntegratorSettings< double > > integratorSettings;
+            if( integratorIndex == 0 )
+            {
+                integratorSettings = rungeKuttaVariableStepSettingsScalarTolerances(
+                            10.0, CoefficientSets::rungeKuttaFehlberg78, 1.0E-4, 1.0E4, 1.0E-12, 1.0E-12 );
+            }
+            else if( integratorIndex == 1 )
+            {
+                integratorSettings = rungeKuttaFixedStepSettings( 30.0, CoefficientSets::rungeKutta4Classic );
+            }
+            else
+            {
+                integratorSettings = adamsBashforthMoultonSettings( 10.0, 1.0E-4, 1.0E4, 1.0E-12, 1.0E-12 );
+            }
+
+            // Propagate uninterrupted (0), and up to intermediate time after which propagation is extended (1)
+            std::map< double, Eigen::VectorXd > stateHistory;
+            std::map< double, Eigen::VectorXd > dependentVariableHistory;
+            unsigned int numberOfFunctionEvaluations = 0;
+            for( unsigned int testCase = 0; testCase < 2; testCase++ )
+            {
+                std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                        translationalStatePropagatorSettings< double >(
+                            { "Earth" }, accelerationModels, { "Vehicle" }, initialState, 0.0, integratorSettings,
+                            propagationTimeTerminationSettings( ( testCase == 1 ) ? 43200.0 : 86400.0 ),
+                            cowell, dependentVariables );
+                propagatorSettings->getOutputSettings( )->setUseContiguousResultStorage( storageIndex == 1 );
+                propagatorSettings->getOutputSettings( )->setIntegratedResult( true );
+
+                SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+                std::shared_ptr< SingleArcSimulationResults< double, double > > propagationResults =
+                        dynamicsSimulator.getSingleArcPropagationResults( );
+                std::shared_ptr< ephemerides::Ephemeris > vehicleEphemeris = bodies.at( "Vehicle" )->getEphemeris( );
+                if( testCase == 0 )
+                {
+                    stateHistory = propagationResults->getEquationsOfMotionNumericalSolution( );
+                    dependentVariableHistory = propagationResults->getDependentVariableHistory( );
+                    numberOfFunctionEvaluations = propagationResults->getStepStatistics( ).numberOfFunctionEvaluations_;
+                }
+                else
+                {
+                    BOOST_CHECK( propagationResults->getEquationsOfMotionNumericalSolution( ).rbegin( )->first < 86400.0 );
+                    dynamicsSimulator.extendPropagation( propagationTimeTerminationSettings( 86400.0 ) );
+
+                    // Check that extended propagation is identical to uninterrupted propagation, and appended to results
+                    BOOST_CHECK( dynamicsSimulator.getSingleArcPropagationResults( ) == propagationResults );
+                    checkHistoriesAreEqual( propagationResults->getEquationsOfMotionNumericalSolution( ), stateHistory );
+                    checkHistoriesAreEqual( propagationResults->getDependentVariableHistory( ), dependentVariableHistory );
+                    BOOST_CHECK_EQUAL( propagationResults->getPropagationTerminationReason( )->getPropagationTerminationReason( ),
+                                       termination_condition_reached );
+                    BOOST_CHECK_EQUAL( propagationResults->getCumulativeComputationTimeHistory( ).size( ), stateHistory.size( ) );
+                    BOOST_CHECK_EQUAL( propagationResults->getStepStatistics( ).numberOfAcceptedSteps_ + 1, stateHistory.size( ) );
+
+                    // Only the evaluations at the start of the extension (e.g. dependent variables at initial state) are added
+                    BOOST_CHECK( propagationResults->getStepStatistics( ).numberOfFunctionEvaluations_ >=
+                                 numberOfFunctionEvaluations );
+                    BOOST_CHECK( propagationResults->getStepStatistics( ).numberOfFunctionEvaluations_ <=
+                                 numberOfFunctionEvaluations + 10 );
+
+                    // Check that ephemeris of vehicle is updated in place, over the full propagation interval
+                    BOOST_CHECK( bodies.at( "Vehicle" )->getEphemeris( ) == vehicleEphemeris );
+                    double testTime = std::prev( stateHistory.end( ), 2 )->first;
+                    Eigen::Vector6d ephemerisState = vehicleEphemeris->getCartesianState( testTime );
+                    for( int i = 0; i < 6; i++ )
+                    {
+                        BOOST_CHECK_CLOSE_FRACTION( ephemerisState( i ), stateHistory.at( testTime )( i ), 1.0E-12 );
+                    }
+                }
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}
+
+}
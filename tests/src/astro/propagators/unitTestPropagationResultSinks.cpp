@@ -0,0 +1,267 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <cstdio>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/astro/basic_astro/orbitalElementConversions.h"
+#include "tudat/simulation/environment_setup/createBodies.h"
+#include "tudat/simulation/propagation_setup/createAccelerationModels.h"
+#include "tudat/simulation/propagation_setup/dynamicsSimulator.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace numerical_integrators;
+using namespace simulation_setup;
+using namespace propagators;
+
+BOOST_AUTO_TEST_SUITE( test_propagation_result_sinks )
+
+// Check if two histories are identical
+void checkHistoriesAreEqual( const std::map< double, Eigen::VectorXd >& history,
+                             const std::map< double, Eigen::VectorXd >& expectedHistory )
+{
+    BOOST_CHECK_EQUAL( history.size( ), expectedHistory.size( ) );
+    if( history.size( ) == expectedHistory.size( ) )
+    {
+        auto expectedIterator = expectedHistory.begin( );
+        for( auto historyIterator : history )
+        {
+            BOOST_CHECK_EQUAL( historyIterator.first, expectedIterator->first );
+            BOOST_CHECK_EQUAL( historyIterator.second.rows( ), expectedIterator->second.rows( ) );
+            for( int i = 0; i < historyIterator.second.rows( ); i++ )
+            {
+                BOOST_CHECK_EQUAL( historyIterator.second( i ), expectedIterator->second( i ) );
+            }
+            expectedIterator++;
+        }
+    }
+}
+
+//! Test if results streamed to sinks are identical to those stored in memory
+BOOST_AUTO_TEST_CASE( testPropagationResultSinks )
+{
+    // Create environment with point-mass Earth
+    double earthGravitationalParameter = 3.986004418E14;
+    BodyListSettings bodySettings = BodyListSettings( "Earth", "ECLIPJ2000" );
+    bodySettings.addSettings( "Earth" );
+    bodySettings.at( "Earth" )->ephemerisSettings = constantEphemerisSettings( Eigen::Vector6d::Zero( ), "SSB" );
+    bodySettings.at( "Earth" )->gravityFieldSettings = centralGravitySettings( earthGravitationalParameter );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+    bodies.createEmptyBody( "Vehicle" );
+
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back( pointMassGravityAcceleration( ) );
+    basic_astrodynamics::AccelerationMap accelerationModels = createAccelerationModelsMap(
+                bodies, accelerationSettings, { "Vehicle" }, { "Earth" } );
+
+    Eigen::Vector6d initialKeplerElements;
+    initialKeplerElements << 7000.0E3, 0.1, 0.6, 0.2, 0.3, 0.4;
+    Eigen::Vector6d initialState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                initialKeplerElements, earthGravitationalParameter );
+
+    std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables;
+    dependentVariables.push_back( keplerianStateDependentVariable( "Vehicle", "Earth" ) );
+
+    std::string fileName = "propagationResultSinkTestOutput.dat";
+
+    // Test forward and backward propagation, with Cowell and USM propagator, with map and contiguous storage
+    for( unsigned int propagatorIndex = 0; propagatorIndex < 2; propagatorIndex++ )
+    {
+        for( unsigned int directionIndex = 0; directionIndex < 2; directionIndex++ )
+        {
+            for( unsigned int storageIndex = 0; storageIndex < 2; storageIndex++ )
+            {
+                double direction = ( directionIndex == 0 ) ? 1.0 : -1.0;
+                TranslationalPropagatorType propagatorType =
+                        ( propagatorIndex == 0 ) ? cowell : unified_state_model_quaternions;
+
+                // Propagate with results stored in memory, and with sinks without storing results in memory
+                std::map< double, Eigen::VectorXd > stateHistory;
+                std::map< double, Eigen::VectorXd > dependentVariableHistory;
+                for( unsigned int testCase = 0; testCase < 2; testCase++ )
+                {
+                    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                            translationalStatePropagatorSettings< double >(
+                                { "Earth" }, accelerationModels, { "Vehicle" }, initialState, 0.0,
+                                rungeKuttaVariableStepSettingsScalarTolerances(
+                                    direction * 10.0, CoefficientSets::rungeKuttaFehlberg78, 1.0E-4, 1.0E4, 1.0E-12, 1.0E-12 ),
+                                propagationTimeTerminationSettings( direction * 43200.0, true ),
+                                propagatorType, dependentVariables );
+                    propagatorSettings->getOutputSettings( )->setUseContiguousResultStorage( storageIndex == 1 );
+
+                    if( testCase == 0 )
+                    {
+                        SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+                        stateHistory = dynamicsSimulator.getSingleArcPropagationResults( )->getEquationsOfMotionNumericalSolution( );
+                        dependentVariableHistory = dynamicsSimulator.getSingleArcPropagationResults( )->getDependentVariableHistory( );
+                        continue;
+                    }
+
+                    // Add callback, ring buffer and (background) binary file sinks
+                    std::map< double, Eigen::VectorXd > callbackStateHistory;
+                    std::map< double, Eigen::VectorXd > callbackDependentVariableHistory;
+                    double previousTime = TUDAT_NAN;
+                    bool isOrderCorrect = true;
+                    propagatorSettings->getOutputSettings( )->addResultSink(
+                                callbackResultSink( [ & ]( const double time, const Eigen::VectorXd& state,
+                                                           const Eigen::VectorXd& dependentVariables )
+                    {
+                        if( previousTime == previousTime && direction * ( time - previousTime ) <= 0.0 )
+                        {
+                            isOrderCorrect = false;
+                        }
+                        previousTime = time;
+                        callbackStateHistory[ time ] = state;
+                        callbackDependentVariableHistory[ time ] = dependentVariables;
+                    } ) );
+
+                    int bufferSize = 5;
+                    std::shared_ptr< RingBufferPropagationResultSink > ringBufferSink = ringBufferResultSink( bufferSize );
+                    propagatorSettings->getOutputSettings( )->addResultSink( ringBufferSink );
+                    propagatorSettings->getOutputSettings( )->addResultSink( binaryFileResultSink( fileName ) );
+                    propagatorSettings->getOutputSettings( )->setStoreResultsInMemory( false );
+
+                    SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+                    std::shared_ptr< SingleArcSimulationResults< double, double > > propagationResults =
+                            dynamicsSimulator.getSingleArcPropagationResults( );
+                    BOOST_CHECK( propagationResults->integrationCompletedSuccessfully( ) );
+
+                    // Check that only initial and final epoch are retained in memory
+                    std::map< double, Eigen::VectorXd > storedStateHistory =
+                            propagationResults->getEquationsOfMotionNumericalSolution( );
+                    BOOST_CHECK_EQUAL( storedStateHistory.size( ), 2 );
+                    BOOST_CHECK_EQUAL( propagationResults->getDependentVariableHistory( ).size( ), 2 );
+                    BOOST_CHECK_EQUAL( storedStateHistory.begin( )->first, stateHistory.begin( )->first );
+                    BOOST_CHECK_EQUAL( storedStateHistory.rbegin( )->first, stateHistory.rbegin( )->first );
+
+                    // Check streamed results
+                    BOOST_CHECK( isOrderCorrect );
+                    BOOST_CHECK_EQUAL( previousTime, direction * 43200.0 );
+                    checkHistoriesAreEqual( callbackStateHistory, stateHistory );
+                    checkHistoriesAreEqual( callbackDependentVariableHistory, dependentVariableHistory );
+
+                    std::map< double, Eigen::VectorXd > fileStateHistory;
+                    std::map< double, Eigen::VectorXd > fileDependentVariableHistory;
+                    readPropagationResultsFromBinaryFile( fileName, fileStateHistory, fileDependentVariableHistory );
+                    checkHistoriesAreEqual( fileStateHistory, stateHistory );
+                    checkHistoriesAreEqual( fileDependentVariableHistory, dependentVariableHistory );
+
+                    BOOST_CHECK_EQUAL( ringBufferSink->getNumberOfProcessedEpochs( ), static_cast< int >( stateHistory.size( ) ) );
+                    BOOST_CHECK_EQUAL( ringBufferSink->getNumberOfStoredEpochs( ), bufferSize );
+                    std::map< double, Eigen::VectorXd > expectedBufferHistory;
+                    auto historyIterator = ( direction > 0.0 ) ? std::prev( stateHistory.end( ), bufferSize ) : stateHistory.begin( );
+                    for( int i = 0; i < bufferSize; i++ )
+                    {
+                        expectedBufferHistory[ historyIterator->first ] = historyIterator->second;
+                        historyIterator++;
+                    }
+                    checkHistoriesAreEqual( ringBufferSink->getStateHistory( ), expectedBufferHistory );
+                }
+            }
+        }
+    }
+    std::remove( fileName.c_str( ) );
+
+    // Check that results must be stored in memory when resetting environment
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            translationalStatePropagatorSettings< double >(
+                { "Earth" }, accelerationModels, { "Vehicle" }, initialState, 0.0,
+                rungeKuttaFixedStepSettings( 10.0, CoefficientSets::rungeKutta4Classic ),
+                propagationTimeTerminationSettings( 100.0 ) );
+    propagatorSettings->getOutputSettings( )->setStoreResultsInMemory( false );
+    propagatorSettings->getOutputSettings( )->setIntegratedResult( true );
+    BOOST_CHECK_THROW( SingleArcDynamicsSimulator< >( bodies, propagatorSettings ), std::runtime_error );
+}
+
+//! Test if model evaluation profile is added to the propagation results (if profiling is compiled)
+BOOST_AUTO_TEST_CASE( testModelEvaluationProfile )
+{
+    double earthGravitationalParameter = 3.986004418E14;
+    BodyListSettings bodySettings = BodyListSettings( "Earth", "ECLIPJ2000" );
+    bodySettings.addSettings( "Earth" );
+    bodySettings.at( "Earth" )->ephemerisSettings = constantEphemerisSettings( Eigen::Vector6d::Zero( ), "SSB" );
+    bodySettings.at( "Earth" )->gravityFieldSettings = centralGravitySettings( earthGravitationalParameter );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+    bodies.createEmptyBody( "Vehicle" );
+
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back( pointMassGravityAcceleration( ) );
+    basic_astrodynamics::AccelerationMap accelerationModels = createAccelerationModelsMap(
+                bodies, accelerationSettings, { "Vehicle" }, { "Earth" } );
+
+    Eigen::Vector6d initialKeplerElements;
+    initialKeplerElements << 7000.0E3, 0.1, 0.6, 0.2, 0.3, 0.4;
+    Eigen::Vector6d initialState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                initialKeplerElements, earthGravitationalParameter );
+
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            translationalStatePropagatorSettings< double >(
+                { "Earth" }, accelerationModels, { "Vehicle" }, initialState, 0.0,
+                rungeKuttaFixedStepSettings( 10.0, CoefficientSets::rungeKutta4Classic ),
+                propagationTimeTerminationSettings( 1000.0 ) );
+
+    // Check that no profile is created by default
+    {
+        SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+        BOOST_CHECK( dynamicsSimulator.getSingleArcPropagationResults( )->getModelEvaluationProfile( ) == nullptr );
+    }
+
+    propagatorSettings->getOutputSettings( )->setProfileModelEvaluations( true );
+    if( !utilities::isModelEvaluationProfilingAvailable( ) )
+    {
+        BOOST_CHECK_THROW( SingleArcDynamicsSimulator< >( bodies, propagatorSettings ), std::runtime_error );
+    }
+    else
+    {
+        SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+        std::shared_ptr< SingleArcSimulationResults< double, double > > propagationResults =
+                dynamicsSimulator.getSingleArcPropagationResults( );
+        std::shared_ptr< utilities::ModelEvaluationProfiler > profile = propagationResults->getModelEvaluationProfile( );
+        BOOST_CHECK( profile != nullptr );
+
+        // Check that each state derivative evaluation, and each acceleration evaluation, is counted
+        long long numberOfFunctionEvaluations = static_cast< long long >(
+                    propagationResults->getCumulativeNumberOfFunctionEvaluations( ).rbegin( )->second );
+        bool isTotalFound = false;
+        bool isAccelerationFound = false;
+        for( const utilities::ProfiledModelStatistics& statistics : profile->getModelStatistics( ) )
+        {
+            if( statistics.category_ == "state_derivative" && statistics.modelName_ == "total" )
+            {
+                isTotalFound = true;
+                BOOST_CHECK_EQUAL( statistics.numberOfCalls_, numberOfFunctionEvaluations );
+            }
+            else if( statistics.category_ == "acceleration_evaluation" )
+            {
+                isAccelerationFound = true;
+                BOOST_CHECK_EQUAL( statistics.numberOfCalls_, numberOfFunctionEvaluations );
+            }
+        }
+        BOOST_CHECK( isTotalFound );
+        BOOST_CHECK( isAccelerationFound );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}
+
+}
@@ -216,6 +216,392 @@ namespace tudat
                 }
             }
 
+//! Unit test to check if results stored in contiguous memory are identical to those stored in maps
+            BOOST_AUTO_TEST_CASE( test_ContiguousResultStorage )
+            {
+                spice_interface::loadStandardSpiceKernels( );
+
+                double initialEphemerisTime = 1.0E7;
+                BodyListSettings bodySettings = getDefaultBodySettings( { "Earth" } );
+                SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+                bodies.createEmptyBody( "Vehicle" );
+
+                SelectedAccelerationMap accelerationMap;
+                accelerationMap[ "Vehicle" ][ "Earth" ].push_back( pointMassGravityAcceleration( ) );
+                AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                        bodies, accelerationMap, { "Vehicle" }, { "Earth" } );
+
+                Eigen::Vector6d initialStateInKeplerianElements;
+                initialStateInKeplerianElements << 15000.0E3, 0.3, 1.2, 4.1, 0.4, 2.4;
+                Eigen::Vector6d systemInitialState = convertKeplerianToCartesianElements(
+                        initialStateInKeplerianElements,
+                        bodies.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( ) );
+
+                std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables;
+                dependentVariables.push_back( altitudeDependentVariable( "Vehicle", "Earth" ) );
+                dependentVariables.push_back( keplerianStateDependentVariable( "Vehicle", "Earth" ) );
+
+                // Test forward and backward propagation, with Cowell and USM propagator, terminating at exact final time
+                for( unsigned int propagatorIndex = 0; propagatorIndex < 2; propagatorIndex++ )
+                {
+                    for( unsigned int directionIndex = 0; directionIndex < 2; directionIndex++ )
+                    {
+                        double direction = ( directionIndex == 0 ) ? 1.0 : -1.0;
+                        TranslationalPropagatorType propagatorType =
+                                ( propagatorIndex == 0 ) ? cowell : unified_state_model_quaternions;
+
+                        std::vector< std::shared_ptr< SingleArcSimulationResults< double, double > > > propagationResults;
+                        for( unsigned int storageIndex = 0; storageIndex < 2; storageIndex++ )
+                        {
+                            std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                                    translationalStatePropagatorSettings< double >(
+                                        { "Earth" }, accelerationModelMap, { "Vehicle" }, systemInitialState, initialEphemerisTime,
+                                        rungeKuttaVariableStepSettingsScalarTolerances(
+                                            direction * 70.0, CoefficientSets::rungeKuttaFehlberg78, 0.01, 3600.0, 1.0E-12, 1.0E-12 ),
+                                        propagationTimeTerminationSettings( initialEphemerisTime + direction * 86400.0, true ),
+                                        propagatorType, dependentVariables );
+                            propagatorSettings->getOutputSettings( )->setUseContiguousResultStorage( storageIndex == 1 );
+
+                            SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+                            propagationResults.push_back( dynamicsSimulator.getSingleArcPropagationResults( ) );
+                        }
+
+                        std::shared_ptr< SingleArcSimulationResults< double, double > > mapResults = propagationResults.at( 0 );
+                        std::shared_ptr< SingleArcSimulationResults< double, double > > contiguousResults = propagationResults.at( 1 );
+                        BOOST_CHECK( !mapResults->isSolutionStoredContiguously( ) );
+                        BOOST_CHECK( contiguousResults->isSolutionStoredContiguously( ) );
+
+                        // Check contiguous storage against map storage
+                        std::map< double, Eigen::VectorXd > stateHistory = mapResults->getEquationsOfMotionNumericalSolution( );
+                        std::map< double, Eigen::VectorXd > rawStateHistory = mapResults->getEquationsOfMotionNumericalSolutionRaw( );
+                        std::map< double, Eigen::VectorXd > dependentVariableHistory = mapResults->getDependentVariableHistory( );
+
+                        const utilities::ContiguousTimeHistory< double, double >& stateTable =
+                                contiguousResults->getEquationsOfMotionNumericalSolutionTable( );
+                        const utilities::ContiguousTimeHistory< double, double >& rawStateTable =
+                                contiguousResults->getEquationsOfMotionNumericalSolutionRawTable( );
+                        const utilities::ContiguousTimeHistory< double, double >& dependentVariableTable =
+                                contiguousResults->getDependentVariableTable( );
+
+                        BOOST_CHECK_EQUAL( stateTable.size( ), stateHistory.size( ) );
+                        BOOST_CHECK_EQUAL( rawStateTable.size( ), rawStateHistory.size( ) );
+                        BOOST_CHECK_EQUAL( dependentVariableTable.size( ), dependentVariableHistory.size( ) );
+                        BOOST_CHECK_EQUAL( dependentVariableTable.getNumberOfColumns( ), 7 );
+
+                        int currentIndex = 0;
+                        for( auto it : stateHistory )
+                        {
+                            BOOST_CHECK_EQUAL( stateTable.getTime( currentIndex ), it.first );
+                            BOOST_CHECK_EQUAL( rawStateTable.getTime( currentIndex ), it.first );
+                            BOOST_CHECK_EQUAL( dependentVariableTable.getTime( currentIndex ), it.first );
+                            for( int j = 0; j < 6; j++ )
+                            {
+                                BOOST_CHECK_EQUAL( stateTable.getValue( currentIndex )( j ), it.second( j ) );
+                            }
+                            for( int j = 0; j < rawStateTable.getNumberOfColumns( ); j++ )
+                            {
+                                BOOST_CHECK_EQUAL( rawStateTable.getValue( currentIndex )( j ),
+                                                   rawStateHistory.at( it.first )( j ) );
+                            }
+                            for( int j = 0; j < 7; j++ )
+                            {
+                                BOOST_CHECK_EQUAL( dependentVariableTable.getValue( currentIndex )( j ),
+                                                   dependentVariableHistory.at( it.first )( j ) );
+                            }
+                            currentIndex++;
+                        }
+
+                        // Check map adaptor of contiguous storage
+                        std::map< double, Eigen::VectorXd > adaptedStateHistory =
+                                contiguousResults->getEquationsOfMotionNumericalSolution( );
+                        std::map< double, Eigen::VectorXd > adaptedDependentVariableHistory =
+                                contiguousResults->getDependentVariableHistory( );
+                        BOOST_CHECK_EQUAL( adaptedStateHistory.size( ), stateHistory.size( ) );
+                        BOOST_CHECK_EQUAL( adaptedDependentVariableHistory.size( ), dependentVariableHistory.size( ) );
+                        for( auto it : stateHistory )
+                        {
+                            BOOST_CHECK_EQUAL( ( adaptedStateHistory.at( it.first ) - it.second ).norm( ), 0.0 );
+                            BOOST_CHECK_EQUAL( ( adaptedDependentVariableHistory.at( it.first ) -
+                                                 dependentVariableHistory.at( it.first ) ).norm( ), 0.0 );
+                        }
+                    }
+                }
+            }
+
+//! Unit test to check if results are saved (and dependent variables computed) only at a fixed output interval
+            BOOST_AUTO_TEST_CASE( test_FixedIntervalResultSaving )
+            {
+                double initialEphemerisTime = 1.0E7;
+                double earthGravitationalParameter = 3.986004418E14;
+
+                SystemOfBodies bodies;
+                bodies.createEmptyBody( "Earth" );
+                bodies.createEmptyBody( "Vehicle" );
+                bodies.at( "Earth" )->setEphemeris( std::make_shared< ConstantEphemeris >(
+                                                        [ ]( ){ return Eigen::Vector6d::Zero( ); }, "SSB", "ECLIPJ2000" ) );
+                bodies.at( "Earth" )->setGravityFieldModel(
+                            std::make_shared< gravitation::GravityFieldModel >( earthGravitationalParameter ) );
+
+                SelectedAccelerationMap accelerationMap;
+                accelerationMap[ "Vehicle" ][ "Earth" ].push_back( pointMassGravityAcceleration( ) );
+                AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                        bodies, accelerationMap, { "Vehicle" }, { "Earth" } );
+
+                Eigen::Vector6d initialStateInKeplerianElements;
+                initialStateInKeplerianElements << 15000.0E3, 0.3, 1.2, 4.1, 0.4, 2.4;
+                Eigen::Vector6d systemInitialState = convertKeplerianToCartesianElements(
+                        initialStateInKeplerianElements, earthGravitationalParameter );
+
+                // Define dependent variables, counting the number of evaluations
+                int numberOfDependentVariableEvaluations = 0;
+                std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables;
+                dependentVariables.push_back( relativeDistanceDependentVariable( "Vehicle", "Earth" ) );
+                dependentVariables.push_back( customDependentVariable(
+                                                  [ & ]( ){ numberOfDependentVariableEvaluations++;
+                                                            return Eigen::VectorXd::Zero( 1 ); }, 1 ) );
+
+                double outputInterval = 700.0;
+                for( unsigned int directionIndex = 0; directionIndex < 2; directionIndex++ )
+                {
+                    double direction = ( directionIndex == 0 ) ? 1.0 : -1.0;
+                    double finalEphemerisTime = initialEphemerisTime + direction * 86400.0;
+
+                    std::vector< std::shared_ptr< SingleArcSimulationResults< double, double > > > propagationResults;
+                    std::vector< int > numberOfEvaluations;
+                    for( unsigned int saveIndex = 0; saveIndex < 2; saveIndex++ )
+                    {
+                        std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                                translationalStatePropagatorSettings< double >(
+                                    { "Earth" }, accelerationModelMap, { "Vehicle" }, systemInitialState, initialEphemerisTime,
+                                    rungeKuttaVariableStepSettingsScalarTolerances(
+                                        direction * 70.0, CoefficientSets::rungeKuttaFehlberg78, 0.01, 3600.0, 1.0E-12, 1.0E-12 ),
+                                    propagationTimeTerminationSettings( finalEphemerisTime, true ),
+                                    cowell, dependentVariables );
+                        if( saveIndex == 1 )
+                        {
+                            propagatorSettings->getOutputSettings( )->setFixedResultsSaveInterval( outputInterval );
+                        }
+
+                        numberOfDependentVariableEvaluations = 0;
+                        SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+                        propagationResults.push_back( dynamicsSimulator.getSingleArcPropagationResults( ) );
+                        numberOfEvaluations.push_back( numberOfDependentVariableEvaluations );
+                    }
+
+                    std::map< double, Eigen::VectorXd > nominalStateHistory =
+                            propagationResults.at( 0 )->getEquationsOfMotionNumericalSolution( );
+                    std::map< double, Eigen::VectorXd > stateHistory =
+                            propagationResults.at( 1 )->getEquationsOfMotionNumericalSolution( );
+                    std::map< double, Eigen::VectorXd > dependentVariableHistory =
+                            propagationResults.at( 1 )->getDependentVariableHistory( );
+
+                    // Check that results are saved at all output epochs, and the final epoch
+                    int numberOfOutputEpochs = static_cast< int >( std::floor( 86400.0 / outputInterval ) ) + 1;
+                    BOOST_CHECK_EQUAL( stateHistory.size( ), numberOfOutputEpochs + 1 );
+                    BOOST_CHECK_EQUAL( dependentVariableHistory.size( ), numberOfOutputEpochs + 1 );
+                    BOOST_CHECK( stateHistory.size( ) < nominalStateHistory.size( ) );
+
+                    int outputIndex = ( directionIndex == 0 ) ? 0 : -static_cast< int >( stateHistory.size( ) ) + 2;
+                    for( auto stateIterator : stateHistory )
+                    {
+                        if( stateIterator.first == finalEphemerisTime )
+                        {
+                            if( directionIndex == 1 )
+                            {
+                                continue;
+                            }
+                        }
+                        else
+                        {
+                            BOOST_CHECK_EQUAL( stateIterator.first,
+                                               initialEphemerisTime + static_cast< double >( outputIndex ) * outputInterval );
+                            outputIndex++;
+                        }
+
+                        // Compare saved state to analytical solution
+                        Eigen::Vector6d expectedState = convertKeplerianToCartesianElements(
+                                    propagateKeplerOrbit( initialStateInKeplerianElements,
+                                                          stateIterator.first - initialEphemerisTime,
+                                                          earthGravitationalParameter ), earthGravitationalParameter );
+                        BOOST_CHECK_SMALL( ( stateIterator.second.segment( 0, 3 ) - expectedState.segment( 0, 3 ) ).norm( ), 0.1 );
+                        BOOST_CHECK_SMALL( ( stateIterator.second.segment( 3, 3 ) - expectedState.segment( 3, 3 ) ).norm( ), 1.0E-4 );
+
+                        // Check that dependent variables are computed from saved state
+                        BOOST_CHECK_CLOSE_FRACTION( dependentVariableHistory.at( stateIterator.first )( 0 ),
+                                                    stateIterator.second.segment( 0, 3 ).norm( ), 1.0E-15 );
+                    }
+                    BOOST_CHECK_EQUAL( stateHistory.begin( )->first, std::min( initialEphemerisTime, finalEphemerisTime ) );
+                    BOOST_CHECK_EQUAL( stateHistory.rbegin( )->first, std::max( initialEphemerisTime, finalEphemerisTime ) );
+
+                    // Check that dependent variables are only computed at saved epochs (and once more at the final step,
+                    // before iterating to the exact final time)
+                    BOOST_CHECK_EQUAL( numberOfEvaluations.at( 0 ), static_cast< int >( nominalStateHistory.size( ) ) + 1 );
+                    BOOST_CHECK_EQUAL( numberOfEvaluations.at( 1 ), static_cast< int >( stateHistory.size( ) ) + 1 );
+                }
+
+                // Check that fixed-interval saving is rejected for integrators without dense output
+                std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                        translationalStatePropagatorSettings< double >(
+                            { "Earth" }, accelerationModelMap, { "Vehicle" }, systemInitialState, initialEphemerisTime,
+                            rungeKuttaFixedStepSettings( 60.0, CoefficientSets::rungeKutta4Classic ),
+                            propagationTimeTerminationSettings( initialEphemerisTime + 3600.0 ) );
+                propagatorSettings->getOutputSettings( )->setFixedResultsSaveInterval( outputInterval );
+                BOOST_CHECK_THROW( SingleArcDynamicsSimulator< >( bodies, propagatorSettings ), std::runtime_error );
+            }
+
+//! Unit test to check if dependent variables written directly into the results (by index) are computed correctly
+            BOOST_AUTO_TEST_CASE( test_DependentVariablesWriter )
+            {
+                double initialEphemerisTime = 1.0E7;
+                double earthGravitationalParameter = 3.986004418E14;
+                double moonGravitationalParameter = 4.9028E12;
+
+                SystemOfBodies bodies;
+                bodies.createEmptyBody( "Earth" );
+                bodies.createEmptyBody( "Moon" );
+                bodies.createEmptyBody( "Vehicle" );
+                Eigen::Vector6d moonState = Eigen::Vector6d::Zero( );
+                moonState( 0 ) = 3.844E8;
+                bodies.at( "Earth" )->setEphemeris( std::make_shared< ConstantEphemeris >(
+                                                        [ ]( ){ return Eigen::Vector6d::Zero( ); }, "SSB", "ECLIPJ2000" ) );
+                bodies.at( "Moon" )->setEphemeris( std::make_shared< ConstantEphemeris >(
+                                                       [ = ]( ){ return moonState; }, "SSB", "ECLIPJ2000" ) );
+                bodies.at( "Earth" )->setGravityFieldModel(
+                            std::make_shared< gravitation::GravityFieldModel >( earthGravitationalParameter ) );
+                bodies.at( "Moon" )->setGravityFieldModel(
+                            std::make_shared< gravitation::GravityFieldModel >( moonGravitationalParameter ) );
+
+                SelectedAccelerationMap accelerationMap;
+                accelerationMap[ "Vehicle" ][ "Earth" ].push_back( pointMassGravityAcceleration( ) );
+                accelerationMap[ "Vehicle" ][ "Moon" ].push_back( pointMassGravityAcceleration( ) );
+                AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                        bodies, accelerationMap, { "Vehicle" }, { "Earth" } );
+
+                Eigen::Vector6d initialStateInKeplerianElements;
+                initialStateInKeplerianElements << 15000.0E3, 0.3, 1.2, 4.1, 0.4, 2.4;
+                Eigen::Vector6d systemInitialState = convertKeplerianToCartesianElements(
+                        initialStateInKeplerianElements, earthGravitationalParameter );
+
+                // Define dependent variables: 3-dimensional variables that are written as fixed-size vectors (relative
+                // position w.r.t. Earth, accelerations), or as dynamic-size vector (relative position w.r.t. SSB), other vector
+                // variables and scalar variables
+                std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables;
+                dependentVariables.push_back( relativePositionDependentVariable( "Vehicle", "Earth" ) );
+                dependentVariables.push_back( relativePositionDependentVariable( "Vehicle", "SSB" ) );
+                dependentVariables.push_back( totalAccelerationDependentVariable( "Vehicle" ) );
+                dependentVariables.push_back( singleAccelerationDependentVariable(
+                                                  basic_astrodynamics::point_mass_gravity, "Vehicle", "Earth" ) );
+                dependentVariables.push_back( singleAccelerationDependentVariable(
+                                                  basic_astrodynamics::point_mass_gravity, "Vehicle", "Moon" ) );
+                dependentVariables.push_back( keplerianStateDependentVariable( "Vehicle", "Earth" ) );
+                dependentVariables.push_back( relativeDistanceDependentVariable( "Vehicle", "Earth" ) );
+                dependentVariables.push_back( customDependentVariable(
+                                                  [ & ]( ){ return Eigen::VectorXd::Constant(
+                                                            1, bodies.at( "Vehicle" )->getPosition( )( 2 ) ); }, 1 ) );
+
+                std::vector< std::shared_ptr< SingleArcSimulationResults< double, double > > > propagationResults;
+                for( unsigned int storageIndex = 0; storageIndex < 2; storageIndex++ )
+                {
+                    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                            translationalStatePropagatorSettings< double >(
+                                { "Earth" }, accelerationModelMap, { "Vehicle" }, systemInitialState, initialEphemerisTime,
+                                rungeKuttaVariableStepSettingsScalarTolerances(
+                                    70.0, CoefficientSets::rungeKuttaFehlberg78, 0.01, 3600.0, 1.0E-12, 1.0E-12 ),
+                                propagationTimeTerminationSettings( initialEphemerisTime + 86400.0, true ),
+                                cowell, dependentVariables );
+                    propagatorSettings->getOutputSettings( )->setUseContiguousResultStorage( storageIndex == 1 );
+
+                    SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+                    propagationResults.push_back( dynamicsSimulator.getSingleArcPropagationResults( ) );
+
+                    // Check writer, with environment and accelerations updated to final state
+                    std::map< double, Eigen::VectorXd > currentStateHistory =
+                            propagationResults.back( )->getEquationsOfMotionNumericalSolution( );
+                    dynamicsSimulator.getDynamicsStateDerivative( )->computeStateDerivative(
+                                currentStateHistory.rbegin( )->first, currentStateHistory.rbegin( )->second );
+                    std::shared_ptr< DependentVariablesWriter > dependentVariablesWriter =
+                            dynamicsSimulator.getDependentVariablesWriter( );
+                    BOOST_CHECK_EQUAL( dependentVariablesWriter->getNumberOfVariables( ), 8 );
+                    BOOST_CHECK_EQUAL( dependentVariablesWriter->getTotalSize( ), 23 );
+
+                    Eigen::VectorXd wrongSizeOutput = Eigen::VectorXd::Zero( 22 );
+                    BOOST_CHECK_THROW( dependentVariablesWriter->writeDependentVariables( wrongSizeOutput ),
+                                       std::runtime_error );
+
+                    Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > outputTable =
+                            Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor >::Zero( 3, 23 );
+                    dependentVariablesWriter->writeDependentVariables(
+                                Eigen::Map< Eigen::VectorXd >( outputTable.row( 1 ).data( ), 23 ) );
+                    Eigen::VectorXd evaluatedDependentVariables = dynamicsSimulator.getDependentVariablesFunctions( )( );
+                    for( int j = 0; j < 23; j++ )
+                    {
+                        BOOST_CHECK_EQUAL( outputTable( 1, j ), evaluatedDependentVariables( j ) );
+                        BOOST_CHECK_EQUAL( outputTable( 0, j ), 0.0 );
+                        BOOST_CHECK_EQUAL( outputTable( 2, j ), 0.0 );
+                    }
+                }
+
+                // Check indices of dependent variables
+                std::map< std::pair< int, int >, std::string > dependentVariableIds =
+                        propagationResults.at( 0 )->getDependentVariableId( );
+                std::vector< std::pair< int, int > > expectedIndices =
+                { { 0, 3 }, { 3, 3 }, { 6, 3 }, { 9, 3 }, { 12, 3 }, { 15, 6 }, { 21, 1 }, { 22, 1 } };
+                BOOST_CHECK_EQUAL( dependentVariableIds.size( ), expectedIndices.size( ) );
+                for( unsigned int i = 0; i < expectedIndices.size( ); i++ )
+                {
+                    BOOST_CHECK_EQUAL( dependentVariableIds.count( expectedIndices.at( i ) ), 1 );
+                    BOOST_CHECK_EQUAL( dependentVariableIds.at( expectedIndices.at( i ) ),
+                                       getDependentVariableId( dependentVariables.at( i ) ) );
+                }
+
+                std::map< double, Eigen::VectorXd > stateHistory =
+                        propagationResults.at( 0 )->getEquationsOfMotionNumericalSolution( );
+                std::map< double, Eigen::VectorXd > dependentVariableHistory =
+                        propagationResults.at( 0 )->getDependentVariableHistory( );
+                std::map< double, Eigen::VectorXd > contiguousDependentVariableHistory =
+                        propagationResults.at( 1 )->getDependentVariableHistory( );
+                BOOST_CHECK_EQUAL( dependentVariableHistory.size( ), stateHistory.size( ) );
+                BOOST_CHECK_EQUAL( contiguousDependentVariableHistory.size( ), stateHistory.size( ) );
+
+                for( auto stateIterator : stateHistory )
+                {
+                    Eigen::VectorXd currentDependentVariables = dependentVariableHistory.at( stateIterator.first );
+                    Eigen::Vector3d currentPosition = stateIterator.second.segment( 0, 3 );
+                    Eigen::Vector3d positionWrtMoon = currentPosition - moonState.segment( 0, 3 );
+
+                    // Check results stored in map and contiguous storage
+                    BOOST_CHECK_EQUAL( ( contiguousDependentVariableHistory.at( stateIterator.first ) -
+                                         currentDependentVariables ).norm( ), 0.0 );
+
+                    // Check positions and accelerations
+                    Eigen::Vector3d expectedEarthAcceleration = -earthGravitationalParameter * currentPosition /
+                            std::pow( currentPosition.norm( ), 3.0 );
+                    Eigen::Vector3d expectedMoonAcceleration =
+                            -moonGravitationalParameter * ( positionWrtMoon / std::pow( positionWrtMoon.norm( ), 3.0 ) +
+                                                            moonState.segment( 0, 3 ) / std::pow( moonState( 0 ), 3.0 ) );
+                    for( int j = 0; j < 3; j++ )
+                    {
+                        BOOST_CHECK_EQUAL( currentDependentVariables( j ), currentPosition( j ) );
+                        BOOST_CHECK_EQUAL( currentDependentVariables( 3 + j ), currentPosition( j ) );
+                        BOOST_CHECK_CLOSE_FRACTION( currentDependentVariables( 6 + j ),
+                                                    currentDependentVariables( 9 + j ) + currentDependentVariables( 12 + j ),
+                                                    1.0E-14 );
+                        BOOST_CHECK_CLOSE_FRACTION( currentDependentVariables( 9 + j ), expectedEarthAcceleration( j ), 1.0E-14 );
+                        BOOST_CHECK_CLOSE_FRACTION( currentDependentVariables( 12 + j ), expectedMoonAcceleration( j ), 1.0E-10 );
+                    }
+
+                    // Check Keplerian state and scalar variables
+                    Eigen::Vector6d expectedKeplerianState = convertCartesianToKeplerianElements(
+                                Eigen::Vector6d( stateIterator.second ), earthGravitationalParameter );
+                    for( int j = 0; j < 6; j++ )
+                    {
+                        BOOST_CHECK_CLOSE_FRACTION( currentDependentVariables( 15 + j ), expectedKeplerianState( j ), 1.0E-14 );
+                    }
+                    BOOST_CHECK_CLOSE_FRACTION( currentDependentVariables( 21 ), currentPosition.norm( ), 1.0E-15 );
+                    BOOST_CHECK_EQUAL( currentDependentVariables( 22 ), currentPosition( 2 ) );
+                }
+            }
+
         BOOST_AUTO_TEST_SUITE_END( )
 
     }
@@ -0,0 +1,180 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/astro/basic_astro/physicalConstants.h"
+#include "tudat/astro/mission_segments/createTransferTrajectory.h"
+#include "tudat/simulation/environment_setup/createBodies.h"
+#include "tudat/simulation/propagation_setup/createAccelerationModels.h"
+#include "tudat/simulation/propagation_setup/propagationTransferTrajectoryFullProblem.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace numerical_integrators;
+using namespace simulation_setup;
+using namespace propagators;
+using namespace mission_segments;
+
+BOOST_AUTO_TEST_SUITE( test_transfer_trajectory_full_problem_propagation )
+
+// Create environment with simplified solar system and an empty spacecraft
+SystemOfBodies createFullProblemTestBodies( )
+{
+    SystemOfBodies bodies = createSimplifiedSystemOfBodies( );
+    bodies.createEmptyBody( "Spacecraft" );
+    return bodies;
+}
+
+// Create propagator settings for a single propagation, with only the point-mass gravity of the Sun
+std::shared_ptr< SingleArcPropagatorSettings< double > > createFullProblemTestPropagatorSettings(
+        const SystemOfBodies& bodies, const int legIndex, const Eigen::Vector6d& initialState,
+        const double initialTime, const double finalTime )
+{
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Spacecraft" ][ "Sun" ].push_back( pointMassGravityAcceleration( ) );
+    basic_astrodynamics::AccelerationMap accelerationModels = createAccelerationModelsMap(
+                bodies, accelerationSettings, { "Spacecraft" }, { "Sun" } );
+
+    double initialTimeStep = ( finalTime > initialTime ) ? 3600.0 : -3600.0;
+    return translationalStatePropagatorSettings< double >(
+                { "Sun" }, accelerationModels, { "Spacecraft" }, initialState, initialTime,
+                rungeKuttaVariableStepSettingsScalarTolerances(
+                    initialTimeStep, CoefficientSets::rungeKuttaFehlberg78, 1.0, 10.0 * physical_constants::JULIAN_DAY,
+                    1.0E-12, 1.0E-12 ),
+                propagationTimeTerminationSettings( finalTime, true ) );
+}
+
+//! Test if the full-dynamics propagation of a transfer trajectory reproduces the patched conics for Keplerian dynamics,
+//! and gives identical results on a single and on multiple threads
+BOOST_AUTO_TEST_CASE( testTransferTrajectoryFullProblemPropagation )
+{
+    // Create transfer trajectory with two velocity-based DSM legs
+    SystemOfBodies bodies = createSimplifiedSystemOfBodies( );
+    std::vector< std::string > bodyOrder = { "Earth", "Earth", "Venus" };
+    std::vector< std::shared_ptr< TransferLegSettings > > transferLegSettings =
+    { dsmVelocityBasedLeg( ), dsmVelocityBasedLeg( ) };
+    std::vector< std::shared_ptr< TransferNodeSettings > > transferNodeSettings =
+    { escapeAndDepartureNode( std::numeric_limits< double >::infinity( ), 0.0 ), swingbyNode( ),
+      captureAndInsertionNode( std::numeric_limits< double >::infinity( ), 0.0 ) };
+    std::shared_ptr< TransferTrajectory > transferTrajectory = createTransferTrajectory(
+                bodies, transferLegSettings, transferNodeSettings, bodyOrder, "Sun" );
+
+    double JD = physical_constants::JULIAN_DAY;
+    std::vector< double > nodeTimes;
+    nodeTimes.push_back( ( 1171.64503236 - 0.5 ) * JD );
+    nodeTimes.push_back( nodeTimes.at( 0 ) + 399.999999715 * JD );
+    nodeTimes.push_back( nodeTimes.at( 1 ) + 178.372255301 * JD );
+
+    std::vector< Eigen::VectorXd > transferLegFreeParameters =
+    { ( Eigen::VectorXd( 1 ) << 0.234594654679 ).finished( ), ( Eigen::VectorXd( 1 ) << 0.0964769387134 ).finished( ) };
+    std::vector< Eigen::VectorXd > transferNodeFreeParameters =
+    { ( Eigen::VectorXd( 3 ) << 1408.99421278, 0.37992647165 * 2 * 3.14159265358979,
+        std::acos(  2 * 0.498004040298 - 1. ) - 3.14159265358979 / 2 ).finished( ),
+      ( Eigen::VectorXd( 3 ) << 1.80629232251 * 6.378e6, 1.35077257078, 0.0 ).finished( ),
+      Eigen::VectorXd::Zero( 0 ) };
+    transferTrajectory->evaluateTrajectory( nodeTimes, transferLegFreeParameters, transferNodeFreeParameters );
+
+    std::vector< TransferLegFullProblemResults > singleThreadResults;
+    for( int numberOfWorkers = 1; numberOfWorkers <= 3; numberOfWorkers++ )
+    {
+        std::vector< SystemOfBodies > workerBodies;
+        for( int i = 0; i < numberOfWorkers; i++ )
+        {
+            workerBodies.push_back( createFullProblemTestBodies( ) );
+        }
+
+        std::vector< TransferLegFullProblemResults > fullProblemResults = propagateTransferTrajectoryFullProblem(
+                    transferTrajectory, workerBodies, &createFullProblemTestPropagatorSettings );
+        BOOST_CHECK_EQUAL( fullProblemResults.size( ), 2 );
+
+        // Check that each leg is split at its DSM, and that the propagations end at the segment boundaries
+        for( unsigned int i = 0; i < fullProblemResults.size( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( fullProblemResults.at( i ).getNumberOfSegments( ), 2 );
+            for( int j = 0; j < 2; j++ )
+            {
+                BOOST_CHECK_CLOSE_FRACTION( fullProblemResults.at( i ).backwardStateHistories_.at( j ).begin( )->first,
+                                            fullProblemResults.at( i ).segmentBoundaryTimes_.at( j ), 1.0E-14 );
+                BOOST_CHECK_CLOSE_FRACTION( fullProblemResults.at( i ).forwardStateHistories_.at( j ).rbegin( )->first,
+                                            fullProblemResults.at( i ).segmentBoundaryTimes_.at( j + 1 ), 1.0E-14 );
+            }
+        }
+
+        // For Keplerian dynamics, the full problem reproduces the patched conics up to the integration error
+        std::map< int, std::pair< Eigen::Vector6d, Eigen::Vector6d > > stateDifferences =
+                getDifferenceFullProblemWrtTransferTrajectory( fullProblemResults );
+        for( auto it : stateDifferences )
+        {
+            BOOST_CHECK_SMALL( it.second.first.segment( 0, 3 ).norm( ), 10.0 );
+            BOOST_CHECK_SMALL( it.second.second.segment( 0, 3 ).norm( ), 10.0 );
+            BOOST_CHECK_SMALL( it.second.first.segment( 3, 3 ).norm( ), 1.0E-6 );
+            BOOST_CHECK_SMALL( it.second.second.segment( 3, 3 ).norm( ), 1.0E-6 );
+        }
+
+        // Check that the results do not depend on the number of workers
+        if( numberOfWorkers == 1 )
+        {
+            singleThreadResults = fullProblemResults;
+        }
+        else
+        {
+            for( unsigned int i = 0; i < fullProblemResults.size( ); i++ )
+            {
+                std::map< double, Eigen::VectorXd > stateHistory = fullProblemResults.at( i ).getStateHistory( );
+                std::map< double, Eigen::VectorXd > singleThreadStateHistory = singleThreadResults.at( i ).getStateHistory( );
+                BOOST_CHECK_EQUAL( stateHistory.size( ), singleThreadStateHistory.size( ) );
+
+                auto singleThreadIterator = singleThreadStateHistory.begin( );
+                for( auto it : stateHistory )
+                {
+                    BOOST_CHECK_EQUAL( it.first, singleThreadIterator->first );
+                    for( int j = 0; j < 6; j++ )
+                    {
+                        BOOST_CHECK_EQUAL( it.second( j ), singleThreadIterator->second( j ) );
+                    }
+                    singleThreadIterator++;
+                }
+            }
+        }
+    }
+
+    // Check that dependent environments are rejected
+    SystemOfBodies workerBodies = createFullProblemTestBodies( );
+    bool isExceptionCaught = false;
+    try
+    {
+        propagateTransferTrajectoryFullProblem(
+                    transferTrajectory, std::vector< SystemOfBodies >( { workerBodies, workerBodies } ),
+                    &createFullProblemTestPropagatorSettings );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}
+
+}
@@ -1252,6 +1252,166 @@ BOOST_AUTO_TEST_CASE( testMassRateVariationalEquations )
 
 }
 
+//! Test whether sensitivity matrix columns of parameters that do not influence the dynamics are omitted from the
+//! propagation, and are correctly set to zero in the results
+BOOST_AUTO_TEST_CASE( testDynamicsFreeParameterColumnOmission )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    double initialEphemerisTime = 1.0E7;
+    double finalEphemerisTime = initialEphemerisTime + 1.0E6;
+    double testEpoch = initialEphemerisTime + 5.0E5;
+
+    // Create bodies needed in simulation
+    std::vector< std::string > bodyNames = { "Earth", "Sun", "Moon", "Mars" };
+    SystemOfBodies bodies = createSystemOfBodies(
+                getDefaultBodySettings( bodyNames, initialEphemerisTime - 3.6E4, finalEphemerisTime + 3.6E4 ) );
+
+    // Set accelerations on Moon (Mars does not exert an acceleration)
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Moon" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >( point_mass_gravity ) );
+    accelerationMap[ "Moon" ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >( point_mass_gravity ) );
+
+    std::vector< std::string > bodiesToIntegrate = { "Moon" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodies, accelerationMap, bodiesToIntegrate, centralBodies );
+
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            translationalStatePropagatorSettings< double >(
+                centralBodies, accelerationModelMap, bodiesToIntegrate,
+                getInitialStatesOfBodies( bodiesToIntegrate, centralBodies, bodies, initialEphemerisTime ),
+                initialEphemerisTime, rungeKuttaFixedStepSettings< double >( 1800.0, CoefficientSets::rungeKutta4Classic ),
+                propagationTimeTerminationSettings( finalEphemerisTime ) );
+
+    // Compute state transition and sensitivity matrix, with and without dynamics-free Mars gravitational parameter
+    std::vector< Eigen::MatrixXd > combinedMatrices;
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames =
+                getInitialStateParameterSettings< double >( propagatorSettings, bodies );
+        parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Earth", gravitational_parameter ) );
+        if( test == 1 )
+        {
+            parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Mars", gravitational_parameter ) );
+        }
+        parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Sun", gravitational_parameter ) );
+
+        std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > > parametersToEstimate =
+                createParametersToEstimate( parameterNames, bodies );
+
+        SingleArcVariationalEquationsSolver< double, double > variationalEquationsSolver(
+                    bodies, propagatorSettings, parametersToEstimate );
+
+        // Check that only dynamics-influencing parameters are propagated
+        BOOST_CHECK_EQUAL( variationalEquationsSolver.getVariationalEquationsObject( )->getNumberOfParameterValues( ), 8 );
+        std::vector< int > propagatedColumns =
+                variationalEquationsSolver.getVariationalEquationsObject( )->getPropagatedSensitivityColumnIndices( );
+        BOOST_CHECK_EQUAL( propagatedColumns.size( ), 2 );
+        BOOST_CHECK_EQUAL( propagatedColumns.at( 0 ), 0 );
+        BOOST_CHECK_EQUAL( propagatedColumns.at( 1 ), ( test == 0 ) ? 1 : 2 );
+
+        combinedMatrices.push_back( variationalEquationsSolver.getStateTransitionMatrixInterface( )->
+                                    getCombinedStateTransitionAndSensitivityMatrix( testEpoch ) );
+    }
+
+    // Check that omitted column is zero, and the others are unaffected
+    BOOST_CHECK_EQUAL( combinedMatrices.at( 1 ).cols( ), 9 );
+    for( int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_EQUAL( combinedMatrices.at( 1 )( i, 7 ), 0.0 );
+    }
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                combinedMatrices.at( 0 ).block( 0, 0, 6, 7 ), combinedMatrices.at( 1 ).block( 0, 0, 6, 7 ),
+                1.0E-12 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                combinedMatrices.at( 0 ).block( 0, 7, 6, 1 ), combinedMatrices.at( 1 ).block( 0, 8, 6, 1 ),
+                1.0E-12 );
+}
+
+//! Test whether retaining the variational equations solution only around given epochs reproduces the matrices at these
+//! epochs, and whether storing the solution in single precision reproduces them to single precision
+BOOST_AUTO_TEST_CASE( testVariationalSolutionRetention )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    double initialEphemerisTime = 1.0E7;
+    double finalEphemerisTime = initialEphemerisTime + 1.0E6;
+    std::vector< double > retainedEpochs = { initialEphemerisTime + 1.234E5, initialEphemerisTime + 5.0E5,
+                                             initialEphemerisTime + 8.765E5 };
+
+    // Create bodies needed in simulation
+    std::vector< std::string > bodyNames = { "Earth", "Sun", "Moon" };
+    SystemOfBodies bodies = createSystemOfBodies(
+                getDefaultBodySettings( bodyNames, initialEphemerisTime - 3.6E4, finalEphemerisTime + 3.6E4 ) );
+
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Moon" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >( point_mass_gravity ) );
+    accelerationMap[ "Moon" ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >( point_mass_gravity ) );
+
+    std::vector< std::string > bodiesToIntegrate = { "Moon" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodies, accelerationMap, bodiesToIntegrate, centralBodies );
+
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            translationalStatePropagatorSettings< double >(
+                centralBodies, accelerationModelMap, bodiesToIntegrate,
+                getInitialStatesOfBodies( bodiesToIntegrate, centralBodies, bodies, initialEphemerisTime ),
+                initialEphemerisTime, rungeKuttaFixedStepSettings< double >( 1800.0, CoefficientSets::rungeKutta4Classic ),
+                propagationTimeTerminationSettings( finalEphemerisTime ) );
+
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames =
+            getInitialStateParameterSettings< double >( propagatorSettings, bodies );
+    parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Earth", gravitational_parameter ) );
+    std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > > parametersToEstimate =
+            createParametersToEstimate( parameterNames, bodies );
+
+    SingleArcVariationalEquationsSolver< double, double > variationalEquationsSolver(
+                bodies, propagatorSettings, parametersToEstimate );
+
+    // Compute matrices (and memory) with full solution, retained solution, and retained single-precision solution
+    std::vector< std::vector< Eigen::MatrixXd > > combinedMatrices;
+    std::vector< std::size_t > interpolatorMemory;
+    for( unsigned int test = 0; test < 3; test++ )
+    {
+        if( test > 0 )
+        {
+            variationalEquationsSolver.setVariationalSolutionRetention(
+                        std::make_shared< VariationalEquationsRetentionSettings >( retainedEpochs, 0.0, test == 2 ) );
+            variationalEquationsSolver.resetParameterEstimate(
+                        parametersToEstimate->template getFullParameterValues< double >( ) );
+        }
+
+        std::shared_ptr< SingleArcCombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionInterface =
+                std::dynamic_pointer_cast< SingleArcCombinedStateTransitionAndSensitivityMatrixInterface >(
+                    variationalEquationsSolver.getStateTransitionMatrixInterface( ) );
+        utilities::MemoryFootprint memoryFootprint = stateTransitionInterface->getMemoryFootprint( );
+        interpolatorMemory.push_back( memoryFootprint.getEntry( "state_transition_matrix_interpolators" ) +
+                                      memoryFootprint.getEntry( "sensitivity_matrix_interpolators" ) );
+
+        combinedMatrices.push_back( std::vector< Eigen::MatrixXd >( ) );
+        for( unsigned int i = 0; i < retainedEpochs.size( ); i++ )
+        {
+            combinedMatrices.at( test ).push_back(
+                        stateTransitionInterface->getCombinedStateTransitionAndSensitivityMatrix( retainedEpochs.at( i ) ) );
+        }
+    }
+
+    // Check that the retained solution reproduces the matrices at the retained epochs, using less memory
+    BOOST_CHECK( interpolatorMemory.at( 1 ) < interpolatorMemory.at( 0 ) / 10 );
+    BOOST_CHECK( interpolatorMemory.at( 2 ) < interpolatorMemory.at( 1 ) );
+    for( unsigned int i = 0; i < retainedEpochs.size( ); i++ )
+    {
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( combinedMatrices.at( 0 ).at( i ), combinedMatrices.at( 1 ).at( i ),
+                                           std::numeric_limits< double >::epsilon( ) );
+        BOOST_CHECK_SMALL( ( combinedMatrices.at( 0 ).at( i ) - combinedMatrices.at( 2 ).at( i ) ).norm( ) /
+                           combinedMatrices.at( 0 ).at( i ).norm( ), 1.0E-6 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
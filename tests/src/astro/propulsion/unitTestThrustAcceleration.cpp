@@ -2474,6 +2474,82 @@ BOOST_AUTO_TEST_CASE( testMomentumWheelDesaturationThrust )
                     std::numeric_limits< double >::epsilon( ) );
     }
 }
+
+//! Test whether the engine models are evaluated once per epoch when shared by thrust acceleration and mass rate, and
+//! whether the multi-engine thrust acceleration matches the sum of the single-engine contributions.
+BOOST_AUTO_TEST_CASE( testMultiEngineThrustEvaluationCaching )
+{
+    using namespace tudat::propulsion;
+    using namespace tudat::system_models;
+
+    // Create two engines with custom thrust magnitude, counting the number of thrust evaluations
+    std::vector< int > numberOfThrustEvaluations = { 0, 0 };
+    std::vector< std::shared_ptr< EngineModel > > engineModels;
+    std::vector< Eigen::Vector3d > bodyFixedThrustDirections =
+    { Eigen::Vector3d( 1.0, 0.2, -0.1 ), Eigen::Vector3d( 0.0, -1.0, 0.5 ) };
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        Eigen::Vector3d bodyFixedThrustDirection = bodyFixedThrustDirections.at( i );
+        engineModels.push_back(
+                    std::make_shared< EngineModel >(
+                        std::make_shared< CustomThrustMagnitudeWrapper >(
+                            [ =, &numberOfThrustEvaluations ]( const double time )
+        {
+            // Do not count calls with NaN input, used to signal a reset of the model
+            if( time == time )
+            {
+                numberOfThrustEvaluations[ i ]++;
+            }
+            return 10.0 * ( i + 1 ) + time;
+        }, 300.0 ), "Engine" + std::to_string( i ),
+                        [ = ]( const double ){ return bodyFixedThrustDirection; } ) );
+    }
+
+    Eigen::Quaterniond vehicleRotation = Eigen::Quaterniond(
+                Eigen::AngleAxisd( 0.4, Eigen::Vector3d( 0.3, -0.2, 1.0 ).normalized( ) ) );
+    double vehicleMass = 500.0;
+
+    std::shared_ptr< ThrustAcceleration > thrustAcceleration = std::make_shared< ThrustAcceleration >(
+                engineModels, std::make_shared< OrientationBasedThrustDirectionCalculator >(
+                    [ = ]( ){ return vehicleRotation; } ),
+                [ = ]( ){ return vehicleMass; } );
+    FromThrustMassRateModel massRateModel( thrustAcceleration );
+
+    double currentTime = 100.0;
+    thrustAcceleration->updateMembers( currentTime );
+    massRateModel.updateMembers( currentTime );
+
+    // Check that engines are evaluated only once
+    BOOST_CHECK_EQUAL( numberOfThrustEvaluations.at( 0 ), 1 );
+    BOOST_CHECK_EQUAL( numberOfThrustEvaluations.at( 1 ), 1 );
+
+    // Check acceleration and mass rate against manual computation
+    Eigen::Vector3d expectedAcceleration = Eigen::Vector3d::Zero( );
+    double expectedMassRate = 0.0;
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        double thrustMagnitude = 10.0 * ( i + 1 ) + currentTime;
+        expectedAcceleration += thrustMagnitude / vehicleMass *
+                ( vehicleRotation * bodyFixedThrustDirections.at( i ) ).normalized( );
+        expectedMassRate -= computePropellantMassRateFromSpecificImpulse( thrustMagnitude, 300.0 );
+    }
+    for( int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( thrustAcceleration->getAcceleration( )( i ) - expectedAcceleration( i ) ),
+                           10.0 * std::numeric_limits< double >::epsilon( ) * expectedAcceleration.norm( ) );
+    }
+    BOOST_CHECK_CLOSE_FRACTION( massRateModel.getMassRate( ), expectedMassRate,
+                                10.0 * std::numeric_limits< double >::epsilon( ) );
+
+    // Check that engines are re-evaluated after a reset
+    thrustAcceleration->resetCurrentTime( );
+    massRateModel.resetCurrentTime( );
+    thrustAcceleration->updateMembers( currentTime );
+    massRateModel.updateMembers( currentTime );
+    BOOST_CHECK_EQUAL( numberOfThrustEvaluations.at( 0 ), 2 );
+    BOOST_CHECK_EQUAL( numberOfThrustEvaluations.at( 1 ), 2 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
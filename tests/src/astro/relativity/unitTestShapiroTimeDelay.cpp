@@ -71,6 +71,91 @@ BOOST_AUTO_TEST_CASE( testShapiroDelay )
     BOOST_CHECK_CLOSE_FRACTION( 0.5 * directCalculation * physical_constants::SPEED_OF_LIGHT, expectedResult, 6.0E-2 );
 }
 
+//! Test light-time correction due to multiple bodies, and reuse of perturbing body states by the partials
+BOOST_AUTO_TEST_CASE( testMultipleBodyShapiroDelay )
+{
+    Eigen::Vector6d transmitterState;
+    transmitterState << 1.2E11, -4.0E10, 3.0E9, 0.0, 0.0, 0.0;
+    Eigen::Vector6d receiverState;
+    receiverState << -8.0E10, 1.1E11, -2.0E9, 0.0, 0.0, 0.0;
+    double transmissionTime = 1.0E7;
+    double receptionTime = transmissionTime + 800.0;
+
+    std::vector< std::string > perturbingBodyNames = { "Sun", "Jupiter", "Earth" };
+    std::vector< double > gravitationalParameters = { 1.32712440018E20, 1.26686534E17, 3.986004418E14 };
+    std::vector< Eigen::Vector6d > bodyStates( 3, Eigen::Vector6d::Zero( ) );
+    bodyStates[ 0 ] << 1.0E8, -2.0E8, 3.0E7, 10.0, -5.0, 1.0;
+    bodyStates[ 1 ] << 7.0E11, 2.0E11, -1.0E10, -3.0E3, 1.2E4, 0.0;
+    bodyStates[ 2 ] << -8.0E10, 1.1E11, -2.0E9 - 6.378E6, -2.0E4, -1.5E4, 0.0;
+
+    // Create state functions (linear motion), counting number of evaluations
+    int numberOfStateEvaluations = 0;
+    std::vector< std::function< Eigen::Vector6d( const double ) > > perturbingBodyStateFunctions;
+    std::vector< std::function< double( ) > > perturbingBodyGravitationalParameterFunctions;
+    for( unsigned int i = 0; i < perturbingBodyNames.size( ); i++ )
+    {
+        perturbingBodyStateFunctions.push_back(
+                    [ =, &numberOfStateEvaluations ]( const double time )
+        {
+            numberOfStateEvaluations++;
+            Eigen::Vector6d currentState = bodyStates.at( i );
+            currentState.segment( 0, 3 ) += ( time - transmissionTime ) * bodyStates.at( i ).segment( 3, 3 );
+            return currentState;
+        } );
+        perturbingBodyGravitationalParameterFunctions.push_back( [ = ]( ){ return gravitationalParameters.at( i ); } );
+    }
+
+    std::shared_ptr< FirstOrderLightTimeCorrectionCalculator > correctionCalculator =
+            std::make_shared< FirstOrderLightTimeCorrectionCalculator >(
+                perturbingBodyStateFunctions, perturbingBodyGravitationalParameterFunctions,
+                perturbingBodyNames, "Spacecraft", "Earth" );
+
+    // Compute correction and partials, and check that perturbing body states are evaluated only once
+    double totalCorrection = correctionCalculator->calculateLightTimeCorrection(
+                transmitterState, receiverState, transmissionTime, receptionTime );
+    Eigen::Vector3d receiverPartial = correctionCalculator->calculateLightTimeCorrectionPartialDerivativeWrtLinkEndPosition(
+                transmitterState, receiverState, transmissionTime, receptionTime, receiver );
+    Eigen::Vector3d transmitterPartial = correctionCalculator->calculateLightTimeCorrectionPartialDerivativeWrtLinkEndPosition(
+                transmitterState, receiverState, transmissionTime, receptionTime, transmitter );
+    BOOST_CHECK_EQUAL( numberOfStateEvaluations, 3 );
+
+    // Compute expected values body-by-body
+    double expectedTotalCorrection = 0.0;
+    Eigen::Vector3d expectedReceiverPartial = Eigen::Vector3d::Zero( );
+    Eigen::Vector3d expectedTransmitterPartial = Eigen::Vector3d::Zero( );
+    for( unsigned int i = 0; i < perturbingBodyNames.size( ); i++ )
+    {
+        double evaluationTime = ( i == 2 ) ? receptionTime : ( transmissionTime + receptionTime ) / 2.0;
+        Eigen::Vector3d bodyPosition = bodyStates.at( i ).segment( 0, 3 ) +
+                ( evaluationTime - transmissionTime ) * bodyStates.at( i ).segment( 3, 3 );
+
+        double expectedCorrection = calculateFirstOrderLightTimeCorrectionFromCentralBody(
+                    gravitationalParameters.at( i ), transmitterState.segment( 0, 3 ),
+                    receiverState.segment( 0, 3 ), bodyPosition );
+        BOOST_CHECK_CLOSE_FRACTION( correctionCalculator->getCurrentLightTimeCorrectionComponent( i ),
+                                    expectedCorrection, 1.0E-14 );
+        expectedTotalCorrection += expectedCorrection;
+
+        expectedReceiverPartial += calculateFirstOrderCentralBodyLightTimeCorrectionGradient(
+                    gravitationalParameters.at( i ), transmitterState.segment( 0, 3 ),
+                    receiverState.segment( 0, 3 ), bodyPosition, true ).transpose( );
+        expectedTransmitterPartial += calculateFirstOrderCentralBodyLightTimeCorrectionGradient(
+                    gravitationalParameters.at( i ), transmitterState.segment( 0, 3 ),
+                    receiverState.segment( 0, 3 ), bodyPosition, false ).transpose( );
+    }
+    BOOST_CHECK_CLOSE_FRACTION( totalCorrection, expectedTotalCorrection, 1.0E-14 );
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( receiverPartial( i ), expectedReceiverPartial( i ), 1.0E-14 );
+        BOOST_CHECK_CLOSE_FRACTION( transmitterPartial( i ), expectedTransmitterPartial( i ), 1.0E-14 );
+    }
+
+    // Check that perturbing body states are re-evaluated for new link end times
+    correctionCalculator->calculateLightTimeCorrectionPartialDerivativeWrtLinkEndPosition(
+                transmitterState, receiverState, transmissionTime + 1.0, receptionTime + 1.0, receiver );
+    BOOST_CHECK_EQUAL( numberOfStateEvaluations, 6 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
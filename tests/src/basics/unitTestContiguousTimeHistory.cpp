@@ -0,0 +1,148 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <map>
+#include <stdexcept>
+
+#include <boost/test/unit_test.hpp>
+
+#include <tudat/basics/contiguousTimeHistory.h>
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_contiguous_time_history )
+
+//! Test filling, indexed access and conversion to/from maps
+BOOST_AUTO_TEST_CASE( testContiguousTimeHistoryAccess )
+{
+    utilities::ContiguousTimeHistory< double, double > history;
+    BOOST_CHECK( history.empty( ) );
+
+    std::map< double, Eigen::VectorXd > mapHistory;
+    for( int i = 0; i < 100; i++ )
+    {
+        Eigen::VectorXd currentValue = Eigen::VectorXd::LinSpaced( 4, i, i + 3 );
+        mapHistory[ 10.0 * i ] = currentValue;
+        if( i % 2 == 0 )
+        {
+            history.append( 10.0 * i, currentValue );
+        }
+        else
+        {
+            history.appendEpoch( 10.0 * i ) = currentValue;
+        }
+    }
+
+    BOOST_CHECK_EQUAL( history.size( ), 100 );
+    BOOST_CHECK_EQUAL( history.getNumberOfColumns( ), 4 );
+    BOOST_CHECK( history.getCapacity( ) >= 100 );
+    BOOST_CHECK_EQUAL( history.getFirstTime( ), 0.0 );
+    BOOST_CHECK_EQUAL( history.getLastTime( ), 990.0 );
+    BOOST_CHECK_EQUAL( history.getValues( ).rows( ), 100 );
+
+    for( int i = 0; i < 100; i++ )
+    {
+        BOOST_CHECK_EQUAL( history.getTime( i ), 10.0 * i );
+        BOOST_CHECK_EQUAL( history.findEpochIndex( 10.0 * i ), i );
+        for( int j = 0; j < 4; j++ )
+        {
+            BOOST_CHECK_EQUAL( history.getValue( i )( j ), static_cast< double >( i + j ) );
+            BOOST_CHECK_EQUAL( history.getValues( )( i, j ), static_cast< double >( i + j ) );
+        }
+    }
+    BOOST_CHECK_EQUAL( history.findEpochIndex( 5.0 ), -1 );
+    BOOST_CHECK_EQUAL( history.findEpochIndex( 1.0E4 ), -1 );
+
+    // Check map adaptors
+    std::map< double, Eigen::VectorXd > convertedHistory = history.toMap( );
+    BOOST_CHECK_EQUAL( convertedHistory.size( ), mapHistory.size( ) );
+    for( auto it : mapHistory )
+    {
+        BOOST_CHECK_EQUAL( ( convertedHistory.at( it.first ) - it.second ).norm( ), 0.0 );
+    }
+
+    utilities::ContiguousTimeHistory< double, double > historyFromMap( mapHistory );
+    BOOST_CHECK_EQUAL( historyFromMap.size( ), 100 );
+    BOOST_CHECK_EQUAL( ( historyFromMap.getValues( ) - history.getValues( ) ).norm( ), 0.0 );
+
+    // Check removal of last epoch
+    history.removeLastEpoch( );
+    BOOST_CHECK_EQUAL( history.size( ), 99 );
+    BOOST_CHECK_EQUAL( history.getLastTime( ), 980.0 );
+
+    // Check that incompatible sizes and invalid indices are rejected
+    BOOST_CHECK_THROW( history.append( 1000.0, Eigen::VectorXd::Zero( 3 ) ), std::runtime_error );
+    BOOST_CHECK_THROW( history.getValue( 99 ), std::runtime_error );
+
+    history.clearAndRelease( );
+    BOOST_CHECK( history.empty( ) );
+    BOOST_CHECK_EQUAL( history.getCapacity( ), 0 );
+}
+
+//! Test sorting and merging of histories
+BOOST_AUTO_TEST_CASE( testContiguousTimeHistorySortingAndMerging )
+{
+    // Fill history in descending order, as for a backwards propagation
+    utilities::ContiguousTimeHistory< double, double > backwardHistory( 2 );
+    for( int i = 0; i <= 10; i++ )
+    {
+        backwardHistory.append( -1.0 * i, Eigen::Vector2d( -1.0 * i, 1.0 ) );
+    }
+    backwardHistory.sortByTime( );
+    for( int i = 0; i <= 10; i++ )
+    {
+        BOOST_CHECK_EQUAL( backwardHistory.getTime( i ), static_cast< double >( i - 10 ) );
+        BOOST_CHECK_EQUAL( backwardHistory.getValue( i )( 0 ), static_cast< double >( i - 10 ) );
+    }
+
+    // Sort unordered history
+    utilities::ContiguousTimeHistory< double, double > unorderedHistory( 2 );
+    std::vector< double > unorderedTimes = { 3.0, 1.0, 4.0, 0.5, 2.0 };
+    for( unsigned int i = 0; i < unorderedTimes.size( ); i++ )
+    {
+        unorderedHistory.append( unorderedTimes.at( i ), Eigen::Vector2d( unorderedTimes.at( i ), 2.0 ) );
+    }
+    unorderedHistory.sortByTime( );
+    for( int i = 0; i < unorderedHistory.size( ); i++ )
+    {
+        if( i > 0 )
+        {
+            BOOST_CHECK( unorderedHistory.getTime( i ) > unorderedHistory.getTime( i - 1 ) );
+        }
+        BOOST_CHECK_EQUAL( unorderedHistory.getValue( i )( 0 ), unorderedHistory.getTime( i ) );
+    }
+
+    // Merge histories; for common epochs, the value of the current history is retained
+    backwardHistory.merge( unorderedHistory );
+    BOOST_CHECK_EQUAL( backwardHistory.size( ), 11 + 5 );
+    std::map< double, Eigen::VectorXd > mergedHistory = backwardHistory.toMap( );
+    BOOST_CHECK_EQUAL( mergedHistory.size( ), 16 );
+    BOOST_CHECK_EQUAL( mergedHistory.at( 0.0 )( 1 ), 1.0 );
+    BOOST_CHECK_EQUAL( mergedHistory.at( 4.0 )( 1 ), 2.0 );
+
+    utilities::ContiguousTimeHistory< double, double > overlappingHistory( 2 );
+    overlappingHistory.append( 0.0, Eigen::Vector2d( 0.0, 3.0 ) );
+    overlappingHistory.append( 5.0, Eigen::Vector2d( 5.0, 3.0 ) );
+    backwardHistory.merge( overlappingHistory );
+    BOOST_CHECK_EQUAL( backwardHistory.size( ), 17 );
+    BOOST_CHECK_EQUAL( backwardHistory.getValue( backwardHistory.findEpochIndex( 0.0 ) )( 1 ), 1.0 );
+    BOOST_CHECK_EQUAL( backwardHistory.getValue( backwardHistory.findEpochIndex( 5.0 ) )( 1 ), 3.0 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,196 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <sstream>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Dense>
+
+#include "tudat/basics/doubleDouble.h"
+#include "tudat/basics/tudatTypeTraits.h"
+#include "tudat/math/integrators/rungeKutta4Integrator.h"
+#include "tudat/math/integrators/rungeKuttaVariableStepSizeIntegrator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_double_double )
+
+// Check relative difference between two double-double numbers
+void checkDoubleDoubleClose( const DoubleDouble& computedValue, const DoubleDouble& expectedValue, const double tolerance )
+{
+    double relativeDifference = static_cast< double >( abs( ( computedValue - expectedValue ) / expectedValue ) );
+    BOOST_CHECK_MESSAGE( relativeDifference < tolerance, "Relative difference " << relativeDifference <<
+                         " exceeds tolerance " << tolerance << " for value " << toString( expectedValue ) );
+}
+
+//! Test basic arithmetic operations, for which the double-double type should provide ~106 bits of precision
+BOOST_AUTO_TEST_CASE( testDoubleDoubleArithmetic )
+{
+    // Check that small increments are retained
+    DoubleDouble one( 1.0 );
+    DoubleDouble smallIncrement( 1.0E-20 );
+    BOOST_CHECK_EQUAL( static_cast< double >( ( one + smallIncrement ) - one ), 1.0E-20 );
+    BOOST_CHECK_EQUAL( ( one + smallIncrement ).getHigh( ), 1.0 );
+    BOOST_CHECK_EQUAL( ( one + smallIncrement ).getLow( ), 1.0E-20 );
+
+    // Check division and multiplication
+    DoubleDouble oneThird = one / 3.0;
+    checkDoubleDoubleClose( oneThird * 3.0, one, 1.0E-31 );
+    checkDoubleDoubleClose( oneThird, doubleDoubleFromString( "0.33333333333333333333333333333333333" ), 1.0E-31 );
+    DoubleDouble oneSeventh = one / DoubleDouble( 7.0 );
+    checkDoubleDoubleClose( oneSeventh * DoubleDouble( 7.0 ), one, 1.0E-31 );
+    checkDoubleDoubleClose( oneSeventh, doubleDoubleFromString( "0.142857142857142857142857142857142857" ), 1.0E-31 );
+
+    // Check that rounding error of double precision product is retained
+    double largeValue = 1.0 + std::pow( 2.0, -30 );
+    DoubleDouble product = DoubleDouble( largeValue ) * largeValue;
+    BOOST_CHECK_EQUAL( product.getHigh( ), 1.0 + std::pow( 2.0, -29 ) );
+    BOOST_CHECK_EQUAL( product.getLow( ), std::pow( 2.0, -60 ) );
+
+    // Check conversion from and to long double
+    long double longDoubleValue = 1.0L / 3.0L;
+    BOOST_CHECK_EQUAL( static_cast< long double >( DoubleDouble( longDoubleValue ) ), longDoubleValue );
+    BOOST_CHECK( static_cast< long double >( DoubleDouble( 1.0 ) + longDoubleValue ) == 1.0L + longDoubleValue );
+
+    // Check comparison operators
+    BOOST_CHECK( one + smallIncrement > one );
+    BOOST_CHECK( one - smallIncrement < one );
+    BOOST_CHECK( one + smallIncrement != one );
+    BOOST_CHECK( one <= 1.0 );
+    BOOST_CHECK( 2 > one );
+    BOOST_CHECK( -one < 0.0 );
+
+    // Check integer conversion
+    BOOST_CHECK_EQUAL( static_cast< int >( DoubleDouble( 7.9 ) ), 7 );
+    BOOST_CHECK_EQUAL( static_cast< double >( DoubleDouble( 12345 ) ), 12345.0 );
+
+    // Check numeric limits
+    BOOST_CHECK_EQUAL( std::numeric_limits< DoubleDouble >::digits, 106 );
+    BOOST_CHECK( one + std::numeric_limits< DoubleDouble >::epsilon( ) > one );
+    BOOST_CHECK( isinf( std::numeric_limits< DoubleDouble >::infinity( ) ) );
+    BOOST_CHECK( isnan( std::numeric_limits< DoubleDouble >::quiet_NaN( ) ) );
+    BOOST_CHECK( isnan( sqrt( -one ) ) );
+}
+
+//! Test mathematical functions against known 35-digit values
+BOOST_AUTO_TEST_CASE( testDoubleDoubleFunctions )
+{
+    double tolerance = 1.0E-30;
+
+    checkDoubleDoubleClose( sqrt( DoubleDouble( 2.0 ) ),
+                            doubleDoubleFromString( "1.4142135623730950488016887242096981" ), tolerance );
+    checkDoubleDoubleClose( cbrt( DoubleDouble( 2.0 ) ),
+                            doubleDoubleFromString( "1.2599210498948731647672106072782284" ), tolerance );
+    checkDoubleDoubleClose( exp( DoubleDouble( 1.0 ) ),
+                            doubleDoubleFromString( "2.7182818284590452353602874713526625" ), tolerance );
+    checkDoubleDoubleClose( exp( DoubleDouble( -20.5 ) ),
+                            doubleDoubleFromString( "1.2501528663867426289375531192312222e-9" ), tolerance );
+    checkDoubleDoubleClose( log( DoubleDouble( 2.0 ) ),
+                            doubleDoubleFromString( "0.69314718055994530941723212145817657" ), tolerance );
+    checkDoubleDoubleClose( log10( DoubleDouble( 2.0 ) ),
+                            doubleDoubleFromString( "0.30102999566398119521373889472449303" ), tolerance );
+    checkDoubleDoubleClose( 4.0 * atan( DoubleDouble( 1.0 ) ), double_double_constants::PI, tolerance );
+    checkDoubleDoubleClose( sin( DoubleDouble( 1.0 ) ),
+                            doubleDoubleFromString( "0.84147098480789650665250232163029900" ), tolerance );
+    checkDoubleDoubleClose( cos( DoubleDouble( 1.0 ) ),
+                            doubleDoubleFromString( "0.54030230586813971740093660744297660" ), tolerance );
+    checkDoubleDoubleClose( sin( DoubleDouble( 100.0 ) ),
+                            doubleDoubleFromString( "-0.50636564110975879365655761045978543" ), 1.0E-29 );
+    checkDoubleDoubleClose( tan( DoubleDouble( 0.5 ) ),
+                            doubleDoubleFromString( "0.54630248984379051325517946578028538" ), tolerance );
+    checkDoubleDoubleClose( asin( DoubleDouble( 0.5 ) ), double_double_constants::PI / 6.0, tolerance );
+    checkDoubleDoubleClose( acos( DoubleDouble( 0.5 ) ), double_double_constants::PI / 3.0, tolerance );
+    checkDoubleDoubleClose( atan2( DoubleDouble( -1.0 ), DoubleDouble( -1.0 ) ),
+                            -3.0 * double_double_constants::QUARTER_PI, tolerance );
+    checkDoubleDoubleClose( sinh( DoubleDouble( 1.0 ) ),
+                            doubleDoubleFromString( "1.1752011936438014568823818505956008" ), tolerance );
+    checkDoubleDoubleClose( cosh( DoubleDouble( 1.0 ) ),
+                            doubleDoubleFromString( "1.5430806348152437784779056207570617" ), tolerance );
+    checkDoubleDoubleClose( pow( DoubleDouble( 2.0 ), DoubleDouble( 0.5 ) ), sqrt( DoubleDouble( 2.0 ) ), tolerance );
+    checkDoubleDoubleClose( pow( DoubleDouble( 1.0 ) / 3.0, 5 ), DoubleDouble( 1.0 ) / 243.0, tolerance );
+
+    // Check string conversion
+    std::ostringstream stream;
+    stream.precision( 32 );
+    stream << double_double_constants::PI;
+    BOOST_CHECK_EQUAL( stream.str( ), "3.1415926535897932384626433832795e+00" );
+}
+
+//! Test use of double-double type in Eigen, and as state scalar type for numerical integration
+BOOST_AUTO_TEST_CASE( testDoubleDoubleStateScalar )
+{
+    BOOST_CHECK( ( is_state_scalar< DoubleDouble >::value ) );
+    BOOST_CHECK( ( is_state_scalar_and_time_type< DoubleDouble, Time >::value ) );
+
+    // Check linear algebra
+    Eigen::Matrix< DoubleDouble, 3, 3 > matrix;
+    matrix << 4.0, 1.0, 2.0, 1.0, 5.0, 3.0, 2.0, 3.0, 6.0;
+    Eigen::Matrix< DoubleDouble, 3, 1 > vector;
+    vector << 1.0, 2.0, 3.0;
+    Eigen::Matrix< DoubleDouble, 3, 1 > solution = matrix.ldlt( ).solve( vector );
+    Eigen::Matrix< DoubleDouble, 3, 1 > residual = matrix * solution - vector;
+    BOOST_CHECK( static_cast< double >( residual.norm( ) ) < 1.0E-30 );
+    checkDoubleDoubleClose( vector.norm( ), sqrt( DoubleDouble( 14.0 ) ), 1.0E-31 );
+    checkDoubleDoubleClose( vector.cast< double >( ).cast< DoubleDouble >( ).dot( vector ), DoubleDouble( 14.0 ), 1.0E-31 );
+    BOOST_CHECK_EQUAL( static_cast< double >( ( vector * 1.0E-20L ).sum( ) ), 6.0E-20 );
+
+    // Integrate small constant rate onto large state value, for which the round-off error of a double precision state
+    // accumulates over the steps. Note that the integrator coefficients are in double precision, so that the truncation
+    // error (control) is not improved by a double-double state.
+    VectorXdd initialState = VectorXdd::Constant( 1, 1.0E6 );
+    numerical_integrators::RungeKutta4Integrator< double, VectorXdd, VectorXdd > doubleDoubleIntegrator(
+                [ ]( const double, const VectorXdd& ){ return VectorXdd::Constant( 1, 1.0E-3 ); }, 0.0, initialState, 0.1 );
+    numerical_integrators::RungeKutta4Integrator< double, Eigen::VectorXd > doubleIntegrator(
+                [ ]( const double, const Eigen::VectorXd& ){ return Eigen::VectorXd::Constant( 1, 1.0E-3 ); },
+                0.0, initialState.cast< double >( ), 0.1 );
+    for( int i = 0; i < 100000; i++ )
+    {
+        doubleDoubleIntegrator.performIntegrationStep( 0.1 );
+        doubleIntegrator.performIntegrationStep( 0.1 );
+    }
+    DoubleDouble expectedState = 1.0E6 + DoubleDouble( 1.0E-3 ) * 0.1 * 100000.0;
+    double doubleDoubleError = static_cast< double >( abs( doubleDoubleIntegrator.getCurrentState( )( 0 ) - expectedState ) );
+    double doubleError = static_cast< double >( abs( doubleIntegrator.getCurrentState( )( 0 ) - expectedState ) );
+    BOOST_CHECK_SMALL( doubleDoubleError, 1.0E-14 );
+    BOOST_CHECK( doubleError > 1.0E3 * doubleDoubleError );
+
+    // Integrate harmonic oscillator over ten periods with variable step-size integrator, and compare with analytical
+    // solution
+    double finalTime = 20.0 * mathematical_constants::PI;
+    VectorXdd initialOscillatorState = VectorXdd::Zero( 2 );
+    initialOscillatorState( 0 ) = 1.0;
+    numerical_integrators::RungeKuttaVariableStepSizeIntegrator< double, VectorXdd, VectorXdd > variableStepIntegrator(
+                numerical_integrators::RungeKuttaCoefficients::get(
+                    numerical_integrators::CoefficientSets::rungeKuttaFehlberg78 ),
+                [ ]( const double, const VectorXdd& state )
+    {
+        VectorXdd stateDerivative( 2 );
+        stateDerivative << state( 1 ), -state( 0 );
+        return stateDerivative;
+    }, 0.0, initialOscillatorState, 1.0E-6, 1.0, 1.0E-2, 1.0E-14, 1.0E-14 );
+    VectorXdd finalOscillatorState = variableStepIntegrator.integrateTo( finalTime, 1.0E-2 );
+
+    BOOST_CHECK_EQUAL( variableStepIntegrator.getCurrentIndependentVariable( ), finalTime );
+    BOOST_CHECK_SMALL( static_cast< double >( abs( finalOscillatorState( 0 ) - cos( DoubleDouble( finalTime ) ) ) ), 1.0E-11 );
+    BOOST_CHECK_SMALL( static_cast< double >( abs( finalOscillatorState( 1 ) + sin( DoubleDouble( finalTime ) ) ) ), 1.0E-11 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,102 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include <tudat/basics/contiguousTimeHistory.h>
+#include <tudat/basics/memoryFootprint.h>
+#include <tudat/math/interpolators/lagrangeInterpolator.h>
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_memory_footprint )
+
+//! Test computation of heap memory held by (nested) containers
+BOOST_AUTO_TEST_CASE( testContainerHeapMemorySize )
+{
+    // Check objects without heap storage, and Eigen types
+    BOOST_CHECK_EQUAL( utilities::getHeapMemorySize( 1.0 ), 0 );
+    BOOST_CHECK_EQUAL( utilities::getHeapMemorySize( Eigen::Vector3d( Eigen::Vector3d::Zero( ) ) ), 0 );
+    BOOST_CHECK_EQUAL( utilities::getHeapMemorySize( Eigen::VectorXd( Eigen::VectorXd::Zero( 10 ) ) ), 10 * sizeof( double ) );
+    BOOST_CHECK_EQUAL( utilities::getHeapMemorySize( Eigen::MatrixXd( Eigen::MatrixXd::Zero( 4, 5 ) ) ), 20 * sizeof( double ) );
+    BOOST_CHECK_EQUAL( utilities::getHeapMemorySize( std::string( "a" ) ), 0 );
+
+    // Check vector (capacity is counted, as well as heap storage of entries)
+    std::vector< Eigen::VectorXd > vectorList;
+    vectorList.reserve( 8 );
+    vectorList.push_back( Eigen::VectorXd::Zero( 6 ) );
+    vectorList.push_back( Eigen::VectorXd::Zero( 3 ) );
+    BOOST_CHECK_EQUAL( utilities::getHeapMemorySize( vectorList ), 8 * sizeof( Eigen::VectorXd ) + 9 * sizeof( double ) );
+
+    // Check map (nodes are counted, as well as heap storage of entries)
+    std::map< double, Eigen::VectorXd > vectorMap;
+    for( int i = 0; i < 10; i++ )
+    {
+        vectorMap[ static_cast< double >( i ) ] = Eigen::VectorXd::Zero( 6 );
+    }
+    BOOST_CHECK_EQUAL( utilities::getHeapMemorySize( vectorMap ),
+                       10 * ( sizeof( std::pair< const double, Eigen::VectorXd > ) + utilities::MAP_NODE_OVERHEAD +
+                              6 * sizeof( double ) ) );
+
+    // Check that contiguous storage of the same data is smaller than map storage
+    utilities::ContiguousTimeHistory< double > contiguousHistory( vectorMap );
+    BOOST_CHECK( contiguousHistory.getHeapMemorySize( ) >= 10 * 7 * sizeof( double ) );
+    BOOST_CHECK( contiguousHistory.getHeapMemorySize( ) < utilities::getHeapMemorySize( vectorMap ) );
+    contiguousHistory.clearAndRelease( );
+    BOOST_CHECK_EQUAL( contiguousHistory.getHeapMemorySize( ), 0 );
+
+    // Check that interpolator includes (at least) its data points
+    std::shared_ptr< interpolators::LagrangeInterpolator< double, Eigen::VectorXd > > interpolator =
+            std::make_shared< interpolators::LagrangeInterpolator< double, Eigen::VectorXd > >( vectorMap, 4 );
+    BOOST_CHECK( interpolator->getHeapMemorySize( ) >= 10 * 7 * sizeof( double ) );
+}
+
+//! Test combination and summary of memory footprints
+BOOST_AUTO_TEST_CASE( testMemoryFootprint )
+{
+    utilities::MemoryFootprint firstFootprint;
+    firstFootprint.addEntry( "state_history", 1000 );
+    firstFootprint.addEntry( "state_history", 500 );
+    firstFootprint.addEntry( "dependent_variable_history", 200 );
+    BOOST_CHECK_EQUAL( firstFootprint.getEntry( "state_history" ), 1500 );
+    BOOST_CHECK_EQUAL( firstFootprint.getEntry( "non_existent" ), 0 );
+    BOOST_CHECK_EQUAL( firstFootprint.getTotalSize( ), 1700 );
+
+    utilities::MemoryFootprint combinedFootprint;
+    combinedFootprint.addFootprint( firstFootprint, "propagation_results" );
+    combinedFootprint.addFootprint( firstFootprint, "propagation_results" );
+    combinedFootprint.addEntry( "design_matrix", 3000000 );
+    BOOST_CHECK_EQUAL( combinedFootprint.getEntries( ).size( ), 3 );
+    BOOST_CHECK_EQUAL( combinedFootprint.getEntry( "propagation_results/state_history" ), 3000 );
+    BOOST_CHECK_EQUAL( combinedFootprint.getTotalSize( "propagation_results/" ), 3400 );
+    BOOST_CHECK_EQUAL( combinedFootprint.getTotalSize( ), 3003400 );
+
+    std::string summary = combinedFootprint.getSummary( );
+    BOOST_CHECK( summary.find( "design_matrix: 3.000 MB" ) != std::string::npos );
+    BOOST_CHECK( summary.find( "Total: 3.003 MB" ) != std::string::npos );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
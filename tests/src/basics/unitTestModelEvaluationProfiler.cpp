@@ -0,0 +1,120 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include <tudat/basics/modelEvaluationProfiler.h>
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_model_evaluation_profiler )
+
+//! Test registration of models and accumulation of evaluations
+BOOST_AUTO_TEST_CASE( testModelEvaluationProfilerStatistics )
+{
+    utilities::ModelEvaluationProfiler profiler;
+
+    // Register models, and check that registering existing model returns same index
+    int firstIndex = profiler.addProfiledModel( "acceleration_update", "Vehicle <- Earth: spherical harmonic gravity" );
+    int secondIndex = profiler.addProfiledModel( "acceleration_update", "Vehicle <- Moon: central gravity" );
+    int thirdIndex = profiler.addProfiledModel( "environment_update", "Vehicle <- Earth: spherical harmonic gravity" );
+    BOOST_CHECK_EQUAL( firstIndex, 0 );
+    BOOST_CHECK_EQUAL( secondIndex, 1 );
+    BOOST_CHECK_EQUAL( thirdIndex, 2 );
+    BOOST_CHECK_EQUAL( profiler.addProfiledModel( "acceleration_update", "Vehicle <- Moon: central gravity" ), secondIndex );
+    BOOST_CHECK_EQUAL( profiler.getModelStatistics( ).size( ), 3 );
+
+    // Add evaluations
+    for( int i = 0; i < 10; i++ )
+    {
+        profiler.addEvaluation( firstIndex, 0.5 );
+        profiler.addEvaluation( secondIndex, 0.25 );
+    }
+    profiler.addEvaluation( thirdIndex, 2.0 );
+
+    BOOST_CHECK_EQUAL( profiler.getModelStatistics( ).at( firstIndex ).numberOfCalls_, 10 );
+    BOOST_CHECK_EQUAL( profiler.getModelStatistics( ).at( secondIndex ).numberOfCalls_, 10 );
+    BOOST_CHECK_EQUAL( profiler.getModelStatistics( ).at( thirdIndex ).numberOfCalls_, 1 );
+    BOOST_CHECK_CLOSE_FRACTION( profiler.getModelStatistics( ).at( firstIndex ).accumulatedWallTime_, 5.0, 1.0E-14 );
+    BOOST_CHECK_CLOSE_FRACTION( profiler.getAccumulatedWallTime( "acceleration_update" ), 7.5, 1.0E-14 );
+    BOOST_CHECK_CLOSE_FRACTION( profiler.getAccumulatedWallTime( "environment_update" ), 2.0, 1.0E-14 );
+    BOOST_CHECK_EQUAL( profiler.getAccumulatedWallTime( "torque_update" ), 0.0 );
+
+    // Check that scoped timer adds a single evaluation, and does nothing without profiler
+    {
+        utilities::ScopedEvaluationTimer timer( &profiler, thirdIndex );
+    }
+    {
+        utilities::ScopedEvaluationTimer timer( nullptr, thirdIndex );
+    }
+    BOOST_CHECK_EQUAL( profiler.getModelStatistics( ).at( thirdIndex ).numberOfCalls_, 2 );
+    BOOST_CHECK( profiler.getModelStatistics( ).at( thirdIndex ).accumulatedWallTime_ >= 2.0 );
+
+    // Check that reset retains models, but clears statistics
+    profiler.resetStatistics( );
+    BOOST_CHECK_EQUAL( profiler.getModelStatistics( ).size( ), 3 );
+    for( unsigned int i = 0; i < profiler.getModelStatistics( ).size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( profiler.getModelStatistics( ).at( i ).numberOfCalls_, 0 );
+        BOOST_CHECK_EQUAL( profiler.getModelStatistics( ).at( i ).accumulatedWallTime_, 0.0 );
+    }
+}
+
+//! Test JSON report of profiler
+BOOST_AUTO_TEST_CASE( testModelEvaluationProfilerJsonReport )
+{
+    utilities::ModelEvaluationProfiler profiler;
+    int firstIndex = profiler.addProfiledModel( "torque_update", "Vehicle <- \"Earth\"" );
+    int secondIndex = profiler.addProfiledModel( "environment_update", "Vehicle: mass" );
+    profiler.addEvaluation( firstIndex, 0.5 );
+    profiler.addEvaluation( secondIndex, 0.25 );
+    profiler.addEvaluation( secondIndex, 0.25 );
+
+    // Categories are sorted alphabetically, special characters are escaped
+    std::string expectedReport =
+            "{\n"
+            "  \"environment_update\": {\n"
+            "    \"Vehicle: mass\": { \"wall_time\": 0.5, \"number_of_calls\": 2 }\n"
+            "  },\n"
+            "  \"torque_update\": {\n"
+            "    \"Vehicle <- \\\"Earth\\\"\": { \"wall_time\": 0.5, \"number_of_calls\": 1 }\n"
+            "  }\n"
+            "}\n";
+    BOOST_CHECK_EQUAL( profiler.getJsonReport( ), expectedReport );
+
+    // Check file output
+    std::string fileName = "modelEvaluationProfilerTestOutput.json";
+    profiler.writeJsonReport( fileName );
+    std::ifstream inputFile( fileName );
+    std::stringstream fileContents;
+    fileContents << inputFile.rdbuf( );
+    inputFile.close( );
+    std::remove( fileName.c_str( ) );
+    BOOST_CHECK_EQUAL( fileContents.str( ), expectedReport );
+
+    BOOST_CHECK_THROW( profiler.writeJsonReport( "nonExistentDirectory/profile.json" ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}
+}
@@ -0,0 +1,244 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <tudat/basics/parallelization.h>
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_parallelization )
+
+//! Test if all tasks are executed exactly once, for various numbers of threads
+BOOST_AUTO_TEST_CASE( testParallelTaskExecution )
+{
+    BOOST_CHECK( utilities::getNumberOfAvailableThreads( ) >= 1 );
+
+    int numberOfTasks = 1000;
+    for( int numberOfThreads = 1; numberOfThreads <= 8; numberOfThreads++ )
+    {
+        std::vector< int > executionCounts( numberOfTasks, 0 );
+        std::vector< double > taskResults( numberOfTasks, 0.0 );
+        utilities::executeParallelTasks(
+                    numberOfTasks, [ & ]( const int taskIndex )
+        {
+            executionCounts[ taskIndex ]++;
+            taskResults[ taskIndex ] = 2.0 * static_cast< double >( taskIndex );
+        }, numberOfThreads );
+
+        for( int i = 0; i < numberOfTasks; i++ )
+        {
+            BOOST_CHECK_EQUAL( executionCounts.at( i ), 1 );
+            BOOST_CHECK_EQUAL( taskResults.at( i ), 2.0 * static_cast< double >( i ) );
+        }
+    }
+
+    // Check that no tasks are executed when none are provided
+    std::atomic< int > numberOfExecutedTasks( 0 );
+    utilities::executeParallelTasks( 0, [ & ]( const int ){ numberOfExecutedTasks++; }, 4 );
+    BOOST_CHECK_EQUAL( numberOfExecutedTasks, 0 );
+}
+
+//! Test if exceptions thrown in a task are propagated to the calling thread
+BOOST_AUTO_TEST_CASE( testParallelTaskExceptions )
+{
+    for( int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads++ )
+    {
+        bool isExceptionCaught = false;
+        try
+        {
+            utilities::executeParallelTasks(
+                        100, [ & ]( const int taskIndex )
+            {
+                if( taskIndex == 10 )
+                {
+                    throw std::runtime_error( "Task failed" );
+                }
+            }, numberOfThreads );
+        }
+        catch( const std::runtime_error& caughtException )
+        {
+            isExceptionCaught = true;
+            BOOST_CHECK_EQUAL( std::string( caughtException.what( ) ), "Task failed" );
+        }
+        BOOST_CHECK( isExceptionCaught );
+    }
+}
+
+//! Test if repeated task sets on a persistent task pool are executed exactly once, and if exceptions are rethrown
+BOOST_AUTO_TEST_CASE( testParallelTaskPool )
+{
+    for( int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads++ )
+    {
+        utilities::ParallelTaskPool taskPool( numberOfThreads );
+        BOOST_CHECK_EQUAL( taskPool.getNumberOfThreads( ), numberOfThreads );
+
+        // Execute many (small) sets of tasks, as done e.g. in each state derivative evaluation
+        for( int taskSet = 0; taskSet < 200; taskSet++ )
+        {
+            int numberOfTasks = taskSet % 20;
+            std::vector< std::atomic< int > > executionCounts( numberOfTasks );
+            for( int i = 0; i < numberOfTasks; i++ )
+            {
+                executionCounts[ i ] = 0;
+            }
+            taskPool.executeTasks( numberOfTasks, [ & ]( const int taskIndex )
+            {
+                executionCounts[ taskIndex ]++;
+            } );
+            for( int i = 0; i < numberOfTasks; i++ )
+            {
+                BOOST_CHECK_EQUAL( executionCounts[ i ], 1 );
+            }
+        }
+
+        // Check that exception is rethrown, and that pool can be used afterwards
+        BOOST_CHECK_THROW( taskPool.executeTasks( 100, [ & ]( const int taskIndex )
+        {
+            if( taskIndex == 10 )
+            {
+                throw std::runtime_error( "Task failed" );
+            }
+        } ), std::runtime_error );
+
+        std::atomic< int > numberOfExecutedTasks( 0 );
+        taskPool.executeTasks( 50, [ & ]( const int ){ numberOfExecutedTasks++; } );
+        BOOST_CHECK_EQUAL( numberOfExecutedTasks, 50 );
+    }
+}
+
+//! Test nested use of the shared task scheduler, thread limits and deterministic reductions
+BOOST_AUTO_TEST_CASE( testSharedTaskScheduler )
+{
+    int defaultNumberOfThreads = utilities::getNumberOfSchedulerThreads( );
+    utilities::setNumberOfSchedulerThreads( 4 );
+    BOOST_CHECK_EQUAL( utilities::getNumberOfSchedulerThreads( ), 4 );
+    BOOST_CHECK_EQUAL( utilities::getNumberOfAvailableThreads( ), 4 );
+
+    // Define function to execute nested tasks, recording the maximum number of concurrently running tasks and used threads
+    std::atomic< int > numberOfRunningTasks( 0 );
+    std::atomic< int > maximumNumberOfRunningTasks( 0 );
+    std::mutex threadIdMutex;
+    std::set< std::thread::id > usedThreadIds;
+    auto executeNestedTasks = [ & ]( const int numberOfOuterThreads, const int numberOfInnerThreads )
+    {
+        std::vector< std::atomic< int > > executionCounts( 8 * 50 );
+        for( unsigned int i = 0; i < executionCounts.size( ); i++ )
+        {
+            executionCounts[ i ] = 0;
+        }
+        usedThreadIds.clear( );
+        maximumNumberOfRunningTasks = 0;
+
+        utilities::executeParallelTasks( 8, [ & ]( const int outerTaskIndex )
+        {
+            utilities::executeParallelTasks( 50, [ & ]( const int innerTaskIndex )
+            {
+                int currentNumberOfRunningTasks = ++numberOfRunningTasks;
+                int currentMaximum = maximumNumberOfRunningTasks;
+                while( currentNumberOfRunningTasks > currentMaximum &&
+                       !maximumNumberOfRunningTasks.compare_exchange_weak( currentMaximum, currentNumberOfRunningTasks ) ){ }
+                {
+                    std::lock_guard< std::mutex > lock( threadIdMutex );
+                    usedThreadIds.insert( std::this_thread::get_id( ) );
+                }
+                executionCounts[ 50 * outerTaskIndex + innerTaskIndex ]++;
+                numberOfRunningTasks--;
+            }, numberOfInnerThreads );
+        }, numberOfOuterThreads );
+
+        for( unsigned int i = 0; i < executionCounts.size( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( executionCounts[ i ], 1 );
+        }
+    };
+
+    // Check that nested tasks do not use more threads than available in the scheduler
+    executeNestedTasks( 4, 4 );
+    BOOST_CHECK( maximumNumberOfRunningTasks <= 4 );
+    BOOST_CHECK( usedThreadIds.size( ) <= 4 );
+
+    // Check that scoped thread limit is applied, also to nested tasks, and removed afterwards
+    {
+        utilities::ScopedThreadLimit threadLimit( 2 );
+        BOOST_CHECK_EQUAL( utilities::getNumberOfAvailableThreads( ), 2 );
+        {
+            utilities::ScopedThreadLimit nestedThreadLimit( 3 );
+            BOOST_CHECK_EQUAL( utilities::getNumberOfAvailableThreads( ), 2 );
+        }
+
+        executeNestedTasks( 4, 4 );
+        BOOST_CHECK( maximumNumberOfRunningTasks <= 2 );
+        BOOST_CHECK( usedThreadIds.size( ) <= 2 );
+
+        utilities::executeParallelTasks( 4, [ & ]( const int )
+        {
+            BOOST_CHECK( utilities::getNumberOfAvailableThreads( ) <= 2 );
+        }, 4 );
+    }
+    BOOST_CHECK_EQUAL( utilities::getNumberOfAvailableThreads( ), 4 );
+
+    // Check that a single thread disables parallelism
+    {
+        utilities::ScopedThreadLimit threadLimit( 1 );
+        executeNestedTasks( 4, 4 );
+        BOOST_CHECK_EQUAL( maximumNumberOfRunningTasks, 1 );
+        BOOST_CHECK_EQUAL( usedThreadIds.size( ), 1 );
+        BOOST_CHECK( usedThreadIds.count( std::this_thread::get_id( ) ) == 1 );
+    }
+
+    // Check that reduction result is identical for any number of threads
+    std::function< double( const int ) > taskFunction = [ ]( const int taskIndex )
+    {
+        return 1.0 / static_cast< double >( 3 * taskIndex + 1 );
+    };
+    std::function< double( const double&, const double& ) > reductionFunction = [ ]( const double& first, const double& second )
+    {
+        return first + second;
+    };
+    double serialResult = 0.0;
+    for( int i = 0; i < 10000; i++ )
+    {
+        serialResult += taskFunction( i );
+    }
+    for( int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads++ )
+    {
+        BOOST_CHECK_EQUAL( ( utilities::executeParallelReduction< double >(
+                                 10000, taskFunction, reductionFunction, 0.0, numberOfThreads ) ), serialResult );
+    }
+
+    // Check that scheduler cannot be modified from inside a task
+    BOOST_CHECK_THROW( utilities::executeParallelTasks( 4, [ & ]( const int )
+    {
+        utilities::setNumberOfSchedulerThreads( 2 );
+    }, 4 ), std::runtime_error );
+
+    utilities::setNumberOfSchedulerThreads( defaultNumberOfThreads );
+    BOOST_CHECK_EQUAL( utilities::getNumberOfSchedulerThreads( ), defaultNumberOfThreads );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
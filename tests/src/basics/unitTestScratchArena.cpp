@@ -0,0 +1,137 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include <tudat/basics/allocationCounter.h>
+#include <tudat/basics/scratchArena.h>
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_scratch_arena )
+
+//! Test handing out and releasing of memory by the arena
+BOOST_AUTO_TEST_CASE( testScratchArenaAllocation )
+{
+    utilities::ScratchArena arena;
+    BOOST_CHECK_EQUAL( arena.getCapacity( ), 0 );
+
+    // Retrieve a number of (non-overlapping) blocks, exceeding the size of the first block
+    Eigen::Map< Eigen::VectorXd > firstVector = arena.allocateVector( 5 );
+    Eigen::Map< Eigen::MatrixXd > firstMatrix = arena.allocateMatrix( 3, 20 );
+    Eigen::Map< Eigen::MatrixXd > secondMatrix = arena.allocateMatrix( 20, 20 );
+    firstVector.setConstant( 1.0 );
+    firstMatrix.setConstant( 2.0 );
+    secondMatrix.setConstant( 3.0 );
+
+    BOOST_CHECK_EQUAL( firstVector.sum( ), 5.0 );
+    BOOST_CHECK_EQUAL( firstMatrix.sum( ), 120.0 );
+    BOOST_CHECK_EQUAL( secondMatrix.sum( ), 1200.0 );
+    BOOST_CHECK_EQUAL( arena.getNumberOfBlockAllocations( ), 2 );
+
+    // Check usage (sizes are padded to multiples of 4)
+    std::size_t expectedUsage = 8 + 60 + 400;
+    BOOST_CHECK_EQUAL( arena.getCurrentUsage( ), expectedUsage );
+    BOOST_CHECK_EQUAL( arena.getHighWaterMark( ), expectedUsage );
+
+    // Check that blocks are consolidated into single block on reset
+    arena.reset( );
+    BOOST_CHECK_EQUAL( arena.getCurrentUsage( ), 0 );
+    BOOST_CHECK_EQUAL( arena.getCapacity( ), expectedUsage );
+    BOOST_CHECK_EQUAL( arena.getNumberOfBlockAllocations( ), 3 );
+
+    // Check that repeating the same requests does not allocate new memory
+    for( unsigned int i = 0; i < 10; i++ )
+    {
+        utilities::ScopedAllocationCounter allocationCounter;
+        arena.allocateVector( 5 );
+        arena.allocateMatrix( 3, 20 );
+        arena.allocateMatrix( 20, 20 );
+        arena.reset( );
+        BOOST_CHECK_EQUAL( allocationCounter.getNumberOfAllocations( ), 0 );
+    }
+    BOOST_CHECK_EQUAL( arena.getNumberOfBlockAllocations( ), 3 );
+    BOOST_CHECK_EQUAL( arena.getHighWaterMark( ), expectedUsage );
+}
+
+//! Test activation of arenas in the current thread
+BOOST_AUTO_TEST_CASE( testScopedScratchArena )
+{
+    utilities::ScratchArena outerArena( 100 );
+    utilities::ScratchArena innerArena;
+    BOOST_CHECK( utilities::getCurrentScratchArena( ) == nullptr );
+
+    // Check that fallback matrix is used if no arena is active
+    Eigen::MatrixXd fallbackMatrix;
+    Eigen::Map< Eigen::MatrixXd > scratchMatrix = utilities::getScratchMatrix( 3, 4, fallbackMatrix );
+    BOOST_CHECK( scratchMatrix.data( ) == fallbackMatrix.data( ) );
+    BOOST_CHECK_EQUAL( fallbackMatrix.rows( ), 3 );
+    BOOST_CHECK_EQUAL( fallbackMatrix.cols( ), 4 );
+
+    {
+        utilities::ScopedScratchArena scopedOuterArena( outerArena );
+        BOOST_CHECK( utilities::getCurrentScratchArena( ) == &outerArena );
+
+        Eigen::MatrixXd unusedFallbackMatrix;
+        utilities::getScratchMatrix( 3, 4, unusedFallbackMatrix );
+        BOOST_CHECK_EQUAL( unusedFallbackMatrix.size( ), 0 );
+        BOOST_CHECK_EQUAL( outerArena.getCurrentUsage( ), 12 );
+
+        // Check that nested arena is restored to previous arena
+        {
+            utilities::ScopedScratchArena scopedInnerArena( innerArena );
+            BOOST_CHECK( utilities::getCurrentScratchArena( ) == &innerArena );
+        }
+        BOOST_CHECK( utilities::getCurrentScratchArena( ) == &outerArena );
+        BOOST_CHECK_EQUAL( outerArena.getCurrentUsage( ), 12 );
+    }
+    BOOST_CHECK( utilities::getCurrentScratchArena( ) == nullptr );
+
+    // Check that arena is reset upon activation
+    {
+        utilities::ScopedScratchArena scopedOuterArena( outerArena );
+        BOOST_CHECK_EQUAL( outerArena.getCurrentUsage( ), 0 );
+    }
+}
+
+//! Test counting of heap allocations (if available)
+BOOST_AUTO_TEST_CASE( testAllocationCounter )
+{
+    utilities::ScopedAllocationCounter allocationCounter;
+    Eigen::VectorXd heapAllocatedVector = Eigen::VectorXd::Zero( 100 );
+    std::vector< double > heapAllocatedList( 100, heapAllocatedVector( 0 ) );
+
+    if( utilities::isAllocationCountingAvailable( ) )
+    {
+        // Allocation of Eigen vector is only counted when using glibc
+        BOOST_CHECK( allocationCounter.getNumberOfAllocations( ) >= 1 );
+        BOOST_CHECK( allocationCounter.getNumberOfAllocations( ) <= 2 );
+    }
+    else
+    {
+        BOOST_CHECK_EQUAL( allocationCounter.getNumberOfAllocations( ), 0 );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
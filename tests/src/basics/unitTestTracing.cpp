@@ -0,0 +1,109 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <tudat/basics/tracing.h>
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_tracing )
+
+//! Test recording of (nested and multi-threaded) trace events, and export to Chrome trace format
+BOOST_AUTO_TEST_CASE( testTraceRecording )
+{
+    utilities::setTracingEnabled( false );
+    utilities::clearTraceEvents( );
+
+    // Check that no events are recorded when tracing is disabled
+    {
+        TUDAT_TRACE_SCOPE( "disabled_scope", "test" );
+    }
+    BOOST_CHECK_EQUAL( utilities::getTraceEvents( ).size( ), 0 );
+
+    // Record nested events on main thread
+    utilities::setTracingEnabled( true );
+    {
+        TUDAT_TRACE_SCOPE( "outer_scope", "test" );
+        for( int i = 0; i < 3; i++ )
+        {
+            TUDAT_TRACE_SCOPE_WITH_INDEX( "inner_scope", "test", i );
+        }
+    }
+
+    // Record events on a number of other threads
+    std::vector< std::thread > threads;
+    for( int i = 0; i < 2; i++ )
+    {
+        threads.push_back( std::thread( [ = ]( )
+        {
+            TUDAT_TRACE_SCOPE_WITH_INDEX( "thread_scope", "test", i );
+        } ) );
+    }
+    for( unsigned int i = 0; i < threads.size( ); i++ )
+    {
+        threads.at( i ).join( );
+    }
+    utilities::setTracingEnabled( false );
+
+    std::vector< std::pair< int, utilities::TraceEvent > > traceEvents = utilities::getTraceEvents( );
+    BOOST_CHECK_EQUAL( traceEvents.size( ), 6 );
+
+    // Check events on main thread (inner events are completed, and therefore recorded, before outer event)
+    int mainThreadIndex = traceEvents.at( 0 ).first;
+    for( int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_EQUAL( traceEvents.at( i ).first, mainThreadIndex );
+        BOOST_CHECK_EQUAL( std::string( traceEvents.at( i ).second.name_ ), "inner_scope" );
+        BOOST_CHECK_EQUAL( traceEvents.at( i ).second.index_, i );
+    }
+    const utilities::TraceEvent& outerEvent = traceEvents.at( 3 ).second;
+    BOOST_CHECK_EQUAL( std::string( outerEvent.name_ ), "outer_scope" );
+    BOOST_CHECK_EQUAL( outerEvent.index_, -1 );
+    for( int i = 0; i < 3; i++ )
+    {
+        const utilities::TraceEvent& innerEvent = traceEvents.at( i ).second;
+        BOOST_CHECK( innerEvent.startTime_ >= outerEvent.startTime_ );
+        BOOST_CHECK( innerEvent.startTime_ + innerEvent.duration_ <= outerEvent.startTime_ + outerEvent.duration_ );
+        BOOST_CHECK( innerEvent.duration_ >= 0.0 );
+    }
+
+    // Check that events on other threads have distinct thread indices
+    BOOST_CHECK( traceEvents.at( 4 ).first != mainThreadIndex );
+    BOOST_CHECK( traceEvents.at( 5 ).first != mainThreadIndex );
+    BOOST_CHECK( traceEvents.at( 4 ).first != traceEvents.at( 5 ).first );
+
+    // Check Chrome trace export
+    std::string traceJson = utilities::getChromeTraceJson( );
+    BOOST_CHECK( traceJson.find( "\"traceEvents\"" ) != std::string::npos );
+    BOOST_CHECK( traceJson.find( "\"name\": \"outer_scope\"" ) != std::string::npos );
+    BOOST_CHECK( traceJson.find( "\"ph\": \"X\"" ) != std::string::npos );
+    BOOST_CHECK( traceJson.find( "\"args\": {\"index\": 2}" ) != std::string::npos );
+
+    // Check clearing of events
+    utilities::clearTraceEvents( );
+    BOOST_CHECK_EQUAL( utilities::getTraceEvents( ).size( ), 0 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -221,6 +221,38 @@ BOOST_AUTO_TEST_CASE( test_json_mergeable )
     BOOST_CHECK_EQUAL( merged3, manual3 );
 }
 
+// Test 4: patches and cached deserialization
+BOOST_AUTO_TEST_CASE( test_json_patchAndCache )
+{
+    using namespace json_interface;
+    using namespace boost::filesystem;
+
+    const path inputFilePath =
+            getPathForJSONFile( INPUT( ( path( "mergeable" ) / "inputs" / "merge3" ).string( ) ) );
+
+    // Check that cached object is reused, and identical to directly deserialized object
+    clearDeserializedJSONCache( );
+    const std::shared_ptr< const nlohmann::json > cached1 = getCachedDeserializedJSON( inputFilePath );
+    const std::shared_ptr< const nlohmann::json > cached2 = getCachedDeserializedJSON( inputFilePath );
+    BOOST_CHECK_EQUAL( cached1, cached2 );
+    BOOST_CHECK_EQUAL( *cached1, getDeserializedJSON( inputFilePath ) );
+
+    clearDeserializedJSONCache( );
+    BOOST_CHECK( getCachedDeserializedJSON( inputFilePath ) != cached1 );
+
+    // Apply patch with key paths to copy of cached object
+    nlohmann::json patched = *cached1;
+    applyJSONPatch( patched, R"( { "integrator.stepSize": 30, "integrator.initialTimes[1]": 0, "spice.preloadEpehemeris": true } )"_json );
+
+    nlohmann::json manual = *cached1;
+    manual[ "integrator" ][ "stepSize" ] = 30;
+    manual[ "integrator" ][ "initialTimes" ][ 1 ] = 0;
+    manual[ "spice" ][ "preloadEpehemeris" ] = true;
+
+    BOOST_CHECK_EQUAL( patched, manual );
+    BOOST_CHECK_EQUAL( ( *cached1 )[ "integrator" ][ "stepSize" ], 20 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -89,6 +89,55 @@ BOOST_AUTO_TEST_CASE( testSofaFundamentalArguments )
     }
 }
 
+//! Test whether the shared (per-epoch) fundamental arguments are consistent with the directly computed arguments
+BOOST_AUTO_TEST_CASE( testSharedFundamentalArguments )
+{
+    std::vector< double > testTimes = { 1.0E8, 2.0E8, 3.0E8, 4.0E8, 5.0E8, 6.0E8 };
+
+    // Retrieve arguments at alternating epochs, and compare against direct computation (must be identical).
+    for( unsigned int j = 0; j < 3; j++ )
+    {
+        for( unsigned int i = 0; i < testTimes.size( ); i++ )
+        {
+            double testTime = testTimes.at( ( i * ( j + 1 ) ) % testTimes.size( ) );
+            double terrestrialTime = testTime - 1.0E-3;
+            double universalTime1 = testTime - 65.0;
+
+            Eigen::Vector6d expectedApproximateArguments =
+                    calculateApproximateDelaunayFundamentalArgumentsWithGmst( testTime );
+            Eigen::Vector6d expectedArguments =
+                    calculateDelaunayFundamentalArgumentsWithGmst( testTime, terrestrialTime, universalTime1 );
+
+            for( unsigned int k = 0; k < 2; k++ )
+            {
+                Eigen::Vector6d sharedApproximateArguments =
+                        getSharedApproximateDelaunayFundamentalArgumentsWithGmst( testTime );
+                Eigen::Vector6d sharedArguments =
+                        getSharedDelaunayFundamentalArgumentsWithGmst( testTime, terrestrialTime, universalTime1 );
+                for( unsigned int l = 0; l < 6; l++ )
+                {
+                    BOOST_CHECK_EQUAL( sharedApproximateArguments( l ), expectedApproximateArguments( l ) );
+                    BOOST_CHECK_EQUAL( sharedArguments( l ), expectedArguments( l ) );
+                }
+            }
+
+            // Check that arguments for different time scales are not mixed up
+            BOOST_CHECK( std::fabs( expectedArguments( 0 ) - expectedApproximateArguments( 0 ) ) > 1.0E-5 );
+        }
+    }
+
+    // Compare Doodson arguments against manual computation from Delaunay arguments
+    Eigen::Vector6d delaunayArguments = calculateApproximateDelaunayFundamentalArgumentsWithGmst( testTimes.at( 0 ) );
+    Eigen::Vector6d doodsonArguments = calculateDoodsonFundamentalArguments( testTimes.at( 0 ) );
+    Eigen::Vector6d expectedDoodsonArguments;
+    expectedDoodsonArguments( 0 ) = delaunayArguments( 0 ) - delaunayArguments( 3 ) - delaunayArguments( 5 );
+    expectedDoodsonArguments.segment( 1, 5 ) = delaunayToDoodsonArguments * delaunayArguments.segment( 1, 5 );
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( expectedDoodsonArguments( i ) - doodsonArguments( i ) ), 1.0E-12 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -37,6 +37,7 @@
 #include "tudat/basics/testMacros.h"
 #include "tudat/io/basicInputOutput.h"
 #include "tudat/basics/basicTypedefs.h"
+#include "tudat/basics/parallelization.h"
 #include "tudat/interface/spice/spiceEphemeris.h"
 #include "tudat/interface/spice/spiceInterface.h"
 #include "tudat/interface/spice/spiceRotationalEphemeris.h"
@@ -489,6 +490,165 @@ BOOST_AUTO_TEST_CASE( testSpiceWrappers_7 )
     BOOST_CHECK_EQUAL( spiceKernelsLoaded, 0 );
 }
 
+// Test 8: Concurrent access to Spice from multiple threads.
+BOOST_AUTO_TEST_CASE( testSpiceWrappers_8 )
+{
+    using namespace spice_interface;
+    using namespace ephemerides;
+
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Create Spice-based ephemeris and rotation models.
+    SpiceEphemeris moonEphemeris( "Moon", "Earth", false, false, false, "J2000" );
+    SpiceRotationalEphemeris earthRotationModel( "J2000", "IAU_Earth" );
+
+    // Compute states and rotations serially.
+    const int numberOfEpochs = 1000;
+    std::vector< Eigen::Vector6d > serialStates( numberOfEpochs );
+    std::vector< Eigen::Matrix3d > serialRotations( numberOfEpochs );
+    std::vector< Eigen::Matrix3d > serialRotationDerivatives( numberOfEpochs );
+    for( int i = 0; i < numberOfEpochs; i++ )
+    {
+        double currentTime = 1.0E7 + 3600.0 * static_cast< double >( i );
+        serialStates[ i ] = moonEphemeris.getCartesianState( currentTime );
+        serialRotations[ i ] = earthRotationModel.getRotationMatrixToTargetFrame( currentTime );
+        serialRotationDerivatives[ i ] = earthRotationModel.getDerivativeOfRotationToTargetFrame( currentTime );
+    }
+
+    // Compute same states and rotations concurrently (each epoch twice, so the per-thread caches are used).
+    resetSpiceAccessStatistics( );
+    std::vector< Eigen::Vector6d > parallelStates( numberOfEpochs );
+    std::vector< Eigen::Matrix3d > parallelRotations( numberOfEpochs );
+    std::vector< Eigen::Matrix3d > parallelRotationDerivatives( numberOfEpochs );
+    utilities::executeParallelTasks(
+                numberOfEpochs, [ & ]( const int i )
+    {
+        double currentTime = 1.0E7 + 3600.0 * static_cast< double >( i );
+        parallelStates[ i ] = moonEphemeris.getCartesianState( currentTime );
+        parallelStates[ i ] = moonEphemeris.getCartesianState( currentTime );
+        parallelRotations[ i ] = earthRotationModel.getRotationMatrixToTargetFrame( currentTime );
+        parallelRotationDerivatives[ i ] = earthRotationModel.getDerivativeOfRotationToTargetFrame( currentTime );
+    }, 8 );
+
+    // Check that results are identical.
+    for( int i = 0; i < numberOfEpochs; i++ )
+    {
+        for( unsigned int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_EQUAL( serialStates[ i ]( j ), parallelStates[ i ]( j ) );
+        }
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            for( unsigned int k = 0; k < 3; k++ )
+            {
+                BOOST_CHECK_EQUAL( serialRotations[ i ]( j, k ), parallelRotations[ i ]( j, k ) );
+                BOOST_CHECK_EQUAL( serialRotationDerivatives[ i ]( j, k ), parallelRotationDerivatives[ i ]( j, k ) );
+            }
+        }
+    }
+
+    // Check access statistics: second state request at each epoch is retrieved from cache
+    SpiceAccessStatistics accessStatistics = getSpiceAccessStatistics( );
+    BOOST_CHECK( accessStatistics.numberOfCacheHits_ >= static_cast< unsigned long long >( numberOfEpochs ) );
+    BOOST_CHECK( accessStatistics.numberOfContendedCalls_ <= accessStatistics.numberOfCalls_ );
+    BOOST_CHECK( accessStatistics.totalWaitingTime_ >= 0.0 );
+
+    resetSpiceAccessStatistics( );
+    BOOST_CHECK_EQUAL( getSpiceAccessStatistics( ).numberOfCalls_, 0ULL );
+
+    clearSpiceKernels( );
+}
+
+// Test 9: Loading kernels on demand.
+BOOST_AUTO_TEST_CASE( testSpiceWrappers_9 )
+{
+    using namespace spice_interface;
+
+    // Compute reference Moon state with all kernels loaded.
+    clearSpiceKernels( );
+    spice_interface::loadStandardSpiceKernels( );
+    const double testTime = 1.0E7;
+    Eigen::Vector6d referenceState = getBodyCartesianStateAtEpoch( "Moon", "SSB", "J2000", "None", testTime );
+    clearSpiceKernels( );
+
+    // Register kernels for loading on demand: only text kernels are loaded.
+    loadStandardSpiceKernelsOnDemand( );
+    std::vector< std::string > pendingKernels = getPendingSpiceKernels( );
+    BOOST_CHECK_EQUAL( pendingKernels.size( ), 6 );
+    BOOST_CHECK_EQUAL( getTotalCountOfKernelsLoaded( ), 7 );
+
+    // Load kernels required for Moon w.r.t. barycenter, and check that not all kernels are loaded
+    std::vector< std::string > loadedKernels = loadPendingSpiceKernelsForBodies(
+                { "Moon", "SSB" }, testTime - 86400.0, testTime + 86400.0 );
+    BOOST_CHECK( loadedKernels.size( ) > 0 );
+    BOOST_CHECK( loadedKernels.size( ) < pendingKernels.size( ) );
+    BOOST_CHECK_EQUAL( getPendingSpiceKernels( ).size( ), pendingKernels.size( ) - loadedKernels.size( ) );
+
+    // Check that state is identical to state with all kernels loaded
+    Eigen::Vector6d onDemandState = getBodyCartesianStateAtEpoch( "Moon", "SSB", "J2000", "None", testTime );
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_EQUAL( onDemandState( i ), referenceState( i ) );
+    }
+
+    // Check loading report
+    SpiceKernelLoadingReport loadingReport = getSpiceKernelLoadingReport( );
+    BOOST_CHECK_EQUAL( loadingReport.loadedKernels_.size( ), 7 + loadedKernels.size( ) );
+    BOOST_CHECK_EQUAL( loadingReport.pendingKernels_.size( ), getPendingSpiceKernels( ).size( ) );
+    BOOST_CHECK( loadingReport.totalLoadingTime_ >= 0.0 );
+
+    // Load remaining kernels
+    loadAllPendingSpiceKernels( );
+    BOOST_CHECK_EQUAL( getPendingSpiceKernels( ).size( ), 0 );
+    BOOST_CHECK_EQUAL( getTotalCountOfKernelsLoaded( ), 13 );
+
+    clearSpiceKernels( );
+    BOOST_CHECK_EQUAL( getSpiceKernelLoadingReport( ).loadedKernels_.size( ), 0 );
+}
+
+// Test 10: Shared state histories.
+BOOST_AUTO_TEST_CASE( testSpiceWrappers_10 )
+{
+    using namespace spice_interface;
+
+    clearSpiceKernels( );
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Retrieve state history, and check against directly computed states
+    std::shared_ptr< const std::map< double, Eigen::Vector6d > > stateHistory =
+            getBodyCartesianStateHistory( "Moon", "Earth", "J2000", 1.0E7, 1.0E7 + 86400.0, 3600.0 );
+    BOOST_CHECK_EQUAL( stateHistory->size( ), 24 );
+    for( auto stateIterator : *stateHistory )
+    {
+        Eigen::Vector6d directState = getBodyCartesianStateAtEpoch(
+                    "Moon", "Earth", "J2000", "None", stateIterator.first );
+        for( unsigned int i = 0; i < 6; i++ )
+        {
+            BOOST_CHECK_EQUAL( stateIterator.second( i ), directState( i ) );
+        }
+    }
+
+    // Check that identical requests share the result, without calling CSPICE
+    resetSpiceAccessStatistics( );
+    BOOST_CHECK( getBodyCartesianStateHistory( "Moon", "Earth", "J2000", 1.0E7, 1.0E7 + 86400.0, 3600.0 ) ==
+                 stateHistory );
+    BOOST_CHECK_EQUAL( getSpiceAccessStatistics( ).numberOfCalls_, 0ULL );
+    BOOST_CHECK( getBodyCartesianStateHistory( "Moon", "Earth", "J2000", 1.0E7, 1.0E7 + 86400.0, 1800.0 ) !=
+                 stateHistory );
+
+    // Check that modifying the kernel pool, or clearing the cache, invalidates the shared result
+    clearSpiceKernels( );
+    spice_interface::loadStandardSpiceKernels( );
+    std::shared_ptr< const std::map< double, Eigen::Vector6d > > reloadedStateHistory =
+            getBodyCartesianStateHistory( "Moon", "Earth", "J2000", 1.0E7, 1.0E7 + 86400.0, 3600.0 );
+    BOOST_CHECK( reloadedStateHistory != stateHistory );
+    clearSpiceStateHistoryCache( );
+    BOOST_CHECK( getBodyCartesianStateHistory( "Moon", "Earth", "J2000", 1.0E7, 1.0E7 + 86400.0, 3600.0 ) !=
+                 reloadedStateHistory );
+
+    clearSpiceKernels( );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -17,6 +17,7 @@
 #include <string>
 #include <vector>
 
+#include <boost/filesystem.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include <Eigen/Core>
@@ -123,6 +124,65 @@ BOOST_AUTO_TEST_CASE( testMultiArrayReader )
     }
 }
 
+//! Test conversion of aerodynamic coefficient files to binary coefficient table, and loading of the table
+BOOST_AUTO_TEST_CASE( testBinaryCoefficientTable )
+{
+    std::map< int, std::string > forceFiles;
+    forceFiles[ 0 ] = tudat::paths::getTudatTestDataPath( ) + "/aurora_CD.txt";
+    forceFiles[ 2 ] = tudat::paths::getTudatTestDataPath( ) + "/aurora_CL.txt";
+    std::map< int, std::string > momentFiles;
+    momentFiles[ 1 ] = tudat::paths::getTudatTestDataPath( ) + "/aurora_Cm.txt";
+
+    std::string binaryFile =
+            ( boost::filesystem::temp_directory_path( ) /
+              boost::filesystem::unique_path( "tudat_coefficient_table_%%%%-%%%%.bin" ) ).string( );
+    input_output::convertAerodynamicCoefficientFilesToBinaryTable( forceFiles, momentFiles, binaryFile );
+
+    std::pair< boost::multi_array< Eigen::Vector3d, 2 >, std::vector< std::vector< double > > > forceCoefficients =
+            input_output::readAerodynamicCoefficients< 2 >( forceFiles );
+    std::pair< boost::multi_array< Eigen::Vector3d, 2 >, std::vector< std::vector< double > > > momentCoefficients =
+            input_output::readAerodynamicCoefficients< 2 >( momentFiles );
+
+    {
+        std::shared_ptr< input_output::BinaryCoefficientTable > table =
+                input_output::loadBinaryCoefficientTable( binaryFile );
+
+        // Check table dimensions and independent variables
+        BOOST_CHECK_EQUAL( table->getNumberOfDimensions( ), 2 );
+        BOOST_CHECK_EQUAL( table->getNumberOfComponents( ), 6 );
+        BOOST_CHECK_EQUAL( table->getNumberOfCoefficients( ), forceCoefficients.first.num_elements( ) );
+        for( unsigned int i = 0; i < 2; i++ )
+        {
+            BOOST_CHECK_EQUAL( table->getIndependentVariables( ).at( i ).size( ),
+                               forceCoefficients.second.at( i ).size( ) );
+            for( unsigned int j = 0; j < forceCoefficients.second.at( i ).size( ); j++ )
+            {
+                BOOST_CHECK_EQUAL( table->getIndependentVariables( ).at( i ).at( j ),
+                                   forceCoefficients.second.at( i ).at( j ) );
+            }
+        }
+
+        // Check coefficients, and alignment of coefficients in file
+        BOOST_CHECK_EQUAL( reinterpret_cast< std::uintptr_t >( table->getCoefficients( ) ) % alignof( double ), 0 );
+        for( unsigned int i = 0; i < forceCoefficients.first.num_elements( ); i++ )
+        {
+            for( unsigned int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_EQUAL( table->getCoefficients( )[ 6 * i + j ], forceCoefficients.first.data( )[ i ]( j ) );
+                BOOST_CHECK_EQUAL( table->getCoefficients( )[ 6 * i + 3 + j ], momentCoefficients.first.data( )[ i ]( j ) );
+            }
+        }
+
+        // Check that table is shared when loaded again
+        BOOST_CHECK_EQUAL( input_output::loadBinaryCoefficientTable( binaryFile ), table );
+    }
+
+    // Check that non-table file is rejected
+    BOOST_CHECK_THROW( input_output::BinaryCoefficientTable( forceFiles.at( 0 ) ), std::runtime_error );
+
+    boost::filesystem::remove( binaryFile );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <cmath>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
 #include <map>
 #include <sstream>
@@ -38,6 +39,8 @@
 #include "tudat/io/streamFilters.h"
 #include "tudat/io/matrixTextFileReader.h"
 #include "tudat/io/basicInputOutput.h"
+#include "tudat/io/binaryDataFile.h"
+#include "tudat/io/readHistoryFromFile.h"
 
 namespace tudat
 {
@@ -578,6 +581,151 @@ BOOST_AUTO_TEST_CASE( testMatrixFileWriting )
 
 }
 
+//! Test if buffered text output is identical to iostream-formatted output, and if binary data files are read back exactly
+BOOST_AUTO_TEST_CASE( testBufferedAndBinaryDataMapWriting )
+{
+    // Create data map with values of widely varying magnitude, and special values
+    std::map< double, Eigen::VectorXd > dataMap;
+    for( int i = 0; i < 1000; i++ )
+    {
+        dataMap[ 1.0E8 + 60.0 * i + 1.0 / 3.0 ] =
+                ( Eigen::VectorXd( 4 ) << std::sin( 0.1 * i ) * 1.0E7, -1.0 / ( i + 1.0 ), 1.0E-300 * i, i ).finished( );
+    }
+    dataMap[ 2.0E8 ] = ( Eigen::VectorXd( 4 ) << std::numeric_limits< double >::infinity( ),
+                         -std::numeric_limits< double >::infinity( ), 0.0, -0.0 ).finished( );
+
+    boost::filesystem::path outputDirectory = boost::filesystem::temp_directory_path( ) /
+            boost::filesystem::unique_path( "tudat_test_output_%%%%%%%%" );
+
+    // Write map through buffered writer, and through iostreams (as done previously)
+    input_output::writeDataMapToTextFile( dataMap, "bufferedOutput.dat", outputDirectory, "% Header\n", 16, 12, "\t" );
+    std::ostringstream expectedOutput;
+    expectedOutput << "% Header\n";
+    for( auto it : dataMap )
+    {
+        expectedOutput << std::setprecision( 16 ) << std::left << std::setw( 17 ) << it.first;
+        input_output::writeValueToStream( expectedOutput, it.second, 12, "\t" );
+    }
+
+    std::ifstream writtenFile( ( outputDirectory / "bufferedOutput.dat" ).string( ) );
+    std::stringstream writtenOutput;
+    writtenOutput << writtenFile.rdbuf( );
+    BOOST_CHECK_EQUAL( writtenOutput.str( ), expectedOutput.str( ) );
+
+    // Check that output with shortest round-trip representation is read back exactly
+    std::vector< double > keys;
+    Eigen::MatrixXd values = Eigen::MatrixXd( 1000, 4 );
+    int rowIndex = 0;
+    for( auto it : dataMap )
+    {
+        if( rowIndex < 1000 )
+        {
+            keys.push_back( it.first );
+            values.row( rowIndex ) = it.second.transpose( );
+            rowIndex++;
+        }
+    }
+    input_output::writeDataToTextFile( keys, values, "roundTripOutput.dat", outputDirectory, "", -1, -1, "\t" );
+    Eigen::MatrixXd readValues = input_output::readMatrixFromFile(
+                ( outputDirectory / "roundTripOutput.dat" ).string( ), "\t" );
+    BOOST_CHECK_EQUAL( readValues.rows( ), 1000 );
+    BOOST_CHECK_EQUAL( readValues.cols( ), 5 );
+    for( int i = 0; i < 1000; i++ )
+    {
+        BOOST_CHECK_EQUAL( readValues( i, 0 ), keys.at( i ) );
+        for( int j = 0; j < 4; j++ )
+        {
+            BOOST_CHECK_EQUAL( readValues( i, j + 1 ), values( i, j ) );
+        }
+    }
+
+    // Write map to binary file, and check that it is read back exactly
+    std::string binaryFileName = ( outputDirectory / "binaryOutput.dat" ).string( );
+    input_output::writeDataMapToBinaryFile( dataMap, binaryFileName, "time x y z w" );
+    input_output::BinaryDataFile binaryFile( binaryFileName );
+    BOOST_CHECK_EQUAL( binaryFile.getHeader( ), "time x y z w" );
+    BOOST_CHECK_EQUAL( binaryFile.getNumberOfRows( ), dataMap.size( ) );
+    BOOST_CHECK_EQUAL( binaryFile.getNumberOfColumns( ), 4 );
+
+    std::map< double, Eigen::VectorXd > readDataMap = binaryFile.getDataMap( );
+    BOOST_CHECK_EQUAL( readDataMap.size( ), dataMap.size( ) );
+    auto readIterator = readDataMap.begin( );
+    for( auto it : dataMap )
+    {
+        BOOST_CHECK_EQUAL( readIterator->first, it.first );
+        for( int j = 0; j < 4; j++ )
+        {
+            BOOST_CHECK_EQUAL( readIterator->second( j ), it.second( j ) );
+        }
+        readIterator++;
+    }
+
+    boost::filesystem::remove_all( outputDirectory );
+}
+
+//! Test reading of time histories from binary data files
+BOOST_AUTO_TEST_CASE( testHistoryReadingFromBinaryFile )
+{
+    boost::filesystem::path outputDirectory = boost::filesystem::temp_directory_path( ) /
+            boost::filesystem::unique_path( "tudat_test_output_%%%%%%%%" );
+    boost::filesystem::create_directories( outputDirectory );
+
+    // Create histories
+    std::map< double, Eigen::VectorXd > vectorHistory;
+    std::map< double, double > scalarHistory;
+    for( int i = 0; i < 50; i++ )
+    {
+        double time = 60.0 * i + 1.0 / 3.0;
+        vectorHistory[ time ] = ( Eigen::VectorXd( 6 ) << std::sin( time ), std::cos( time ), time, -time, 1.0 / time,
+                                  std::exp( -time / 1000.0 ) ).finished( );
+        scalarHistory[ time ] = std::sqrt( time );
+    }
+
+    std::string vectorFileName = ( outputDirectory / "vectorHistory.dat" ).string( );
+    std::string scalarFileName = ( outputDirectory / "scalarHistory.dat" ).string( );
+    input_output::writeDataMapToBinaryFile( vectorHistory, vectorFileName );
+    input_output::writeDataMapToBinaryFile( scalarHistory, scalarFileName );
+
+    // Read and compare vector history
+    std::map< double, Eigen::VectorXd > readVectorHistory =
+            input_output::readVectorHistoryFromFile< double, double >( 6, vectorFileName );
+    BOOST_CHECK_EQUAL( readVectorHistory.size( ), vectorHistory.size( ) );
+    for( auto it : vectorHistory )
+    {
+        BOOST_CHECK_EQUAL( readVectorHistory.count( it.first ), 1 );
+        for( int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_EQUAL( readVectorHistory.at( it.first )( j ), it.second( j ) );
+        }
+    }
+
+    // Read and compare vector history as matrix history
+    std::map< double, Eigen::MatrixXd > readMatrixHistory =
+            input_output::readMatrixHistoryFromFile< double, double >( 2, 3, vectorFileName );
+    BOOST_CHECK_EQUAL( readMatrixHistory.size( ), vectorHistory.size( ) );
+    for( auto it : vectorHistory )
+    {
+        for( int i = 0; i < 2; i++ )
+        {
+            for( int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_EQUAL( readMatrixHistory.at( it.first )( i, j ), it.second( 3 * i + j ) );
+            }
+        }
+    }
+
+    // Read and compare scalar history
+    std::map< double, double > readScalarHistory =
+            input_output::readScalarHistoryFromFile< double, double >( scalarFileName );
+    BOOST_CHECK( readScalarHistory == scalarHistory );
+
+    // Check that inconsistent size is detected
+    BOOST_CHECK_THROW( ( input_output::readVectorHistoryFromFile< double, double >( 5, vectorFileName ) ),
+                       std::runtime_error );
+
+    boost::filesystem::remove_all( outputDirectory );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -16,11 +16,13 @@
 #define BOOST_TEST_MAIN
 
 #include <cmath>
+#include <fstream>
 #include <limits>
 #include <stdexcept>
 
 #include <boost/test/tools/floating_point_comparison.hpp>
 #include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
 
 #include <Eigen/Core>
 
@@ -129,5 +131,64 @@ BOOST_AUTO_TEST_CASE( testMatrixTextFileReader )
     }
 }
 
+// Test if reading a large file on multiple threads gives the same result as on a single thread.
+BOOST_AUTO_TEST_CASE( testMultiThreadedMatrixTextFileReader )
+{
+    // Write file with header, comments, empty lines and mixed separators, large enough to be split into chunks.
+    const int numberOfRows = 20000;
+    const std::string fileName =
+            ( boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( "testMatrix_%%%%%%%%.txt" ) ).string( );
+    Eigen::MatrixXd expectedMatrix = Eigen::MatrixXd( numberOfRows, 4 );
+    {
+        std::ofstream outputFile( fileName );
+        outputFile.precision( 17 );
+        outputFile << "Time X Y Z" << std::endl;
+        outputFile << "% Comment line" << std::endl;
+        for( int i = 0; i < numberOfRows; i++ )
+        {
+            expectedMatrix.row( i ) << static_cast< double >( i ), std::sin( 0.1 * i ) * 1.0E7, -1.0 / ( i + 1.0 ), 1.0E-300 * i;
+            outputFile << expectedMatrix( i, 0 ) << "\t" << expectedMatrix( i, 1 ) << ", " << expectedMatrix( i, 2 ) << " ; "
+                       << expectedMatrix( i, 3 );
+            if( i % 1000 == 0 )
+            {
+                outputFile << " % Trailing comment" << std::endl << std::endl;
+            }
+            else
+            {
+                outputFile << "\r" << std::endl;
+            }
+        }
+    }
+
+    // Read file on one and on multiple threads, and compare to written data
+    const Eigen::MatrixXd singleThreadMatrix = input_output::readMatrixFromFile( fileName, "\t ;,", "%", 1, 1 );
+    const Eigen::MatrixXd multiThreadMatrix = input_output::readMatrixFromFile( fileName, "\t ;,", "%", 1, 4 );
+
+    BOOST_CHECK_EQUAL( singleThreadMatrix.rows( ), numberOfRows );
+    BOOST_CHECK_EQUAL( singleThreadMatrix.cols( ), 4 );
+    BOOST_CHECK_EQUAL( multiThreadMatrix.rows( ), numberOfRows );
+    BOOST_CHECK_EQUAL( multiThreadMatrix.cols( ), 4 );
+    for( int i = 0; i < numberOfRows; i++ )
+    {
+        for( int j = 0; j < 4; j++ )
+        {
+            BOOST_CHECK_EQUAL( singleThreadMatrix( i, j ), expectedMatrix( i, j ) );
+            BOOST_CHECK_EQUAL( multiThreadMatrix( i, j ), expectedMatrix( i, j ) );
+        }
+    }
+
+    // Check that reading the file as long double gives the same values
+    const Eigen::Matrix< long double, Eigen::Dynamic, Eigen::Dynamic > longDoubleMatrix =
+            input_output::readMatrixFromFile< long double >( fileName, "\t ;,", "%", 1, 2 );
+    BOOST_CHECK_EQUAL( longDoubleMatrix.rows( ), numberOfRows );
+    for( int i = 0; i < numberOfRows; i += 100 )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( static_cast< double >( longDoubleMatrix( i, 1 ) ), expectedMatrix( i, 1 ),
+                                    std::numeric_limits< double >::epsilon( ) );
+    }
+
+    boost::filesystem::remove( fileName );
+}
+
 } // namespace unit_tests
 } // namespace tudat
@@ -429,6 +429,79 @@ BOOST_AUTO_TEST_CASE( testMultiArrayWriterMultiIndependentVariables )
     }
 }
 
+// Test if binary multi-array files are written and read back correctly
+BOOST_AUTO_TEST_CASE( testBinaryMultiArrayWriterAndReader )
+{
+    boost::filesystem::path outputDirectory = boost::filesystem::temp_directory_path( ) /
+            boost::filesystem::unique_path( "tudat_multi_array_%%%%%%%%" );
+
+    // Create multi-array of coefficients as a function of 3 independent variables
+    std::vector< std::vector< double > > independentVariables;
+    independentVariables.push_back( { 0.1, 0.35, 1.0, 2.5 } );
+    independentVariables.push_back( { -1.0, 0.0, 1.0 / 3.0 } );
+    independentVariables.push_back( { 1.0E3, 2.0E3, 5.0E3, 1.0E4, 2.0E4 } );
+
+    boost::multi_array< Eigen::Vector6d, 3 > coefficients( boost::extents[ 4 ][ 3 ][ 5 ] );
+    for ( unsigned int i = 0; i < 4; i++ )
+    {
+        for ( unsigned int j = 0; j < 3; j++ )
+        {
+            for ( unsigned int k = 0; k < 5; k++ )
+            {
+                for ( unsigned int l = 0; l < 6; l++ )
+                {
+                    coefficients[ i ][ j ][ k ]( l ) = std::sin( 1.0 + i + 0.1 * j + 0.01 * k ) / ( 3.0 + l );
+                }
+            }
+        }
+    }
+
+    // Write two coefficients to binary files
+    std::map< int, std::string > fileNamesMap;
+    fileNamesMap[ 0 ] = ( outputDirectory / "dragCoefficient.dat" ).string( );
+    fileNamesMap[ 4 ] = ( outputDirectory / "liftCoefficient.dat" ).string( );
+    tudat::input_output::writeMultiArrayAndIndependentVariablesToBinaryFiles< 3, 6 >(
+                fileNamesMap, independentVariables, coefficients );
+
+    for ( std::map< int, std::string >::const_iterator fileIterator = fileNamesMap.begin( );
+          fileIterator != fileNamesMap.end( ); fileIterator++ )
+    {
+        BOOST_CHECK( tudat::input_output::isBinaryMultiArrayFile( fileIterator->second ) );
+        BOOST_CHECK_EQUAL( tudat::input_output::getNumberOfIndependentVariablesInCoefficientFile(
+                               fileIterator->second ), 3 );
+
+        // Read through multi-array reader, and directly from memory mapping
+        std::pair< boost::multi_array< double, 3 >, std::vector< std::vector< double > > > readData =
+                tudat::input_output::MultiArrayFileReader< 3 >::readMultiArrayAndIndependentVariables(
+                    fileIterator->second );
+        tudat::input_output::BinaryMultiArrayFile binaryFile( fileIterator->second );
+        boost::const_multi_array_ref< double, 3 > mappedData = binaryFile.getMultiArrayReference< 3 >( );
+
+        // Check that data is identical to data that was written
+        for ( unsigned int i = 0; i < 3; i++ )
+        {
+            BOOST_CHECK( readData.second.at( i ) == independentVariables.at( i ) );
+        }
+        for ( unsigned int i = 0; i < 4; i++ )
+        {
+            for ( unsigned int j = 0; j < 3; j++ )
+            {
+                for ( unsigned int k = 0; k < 5; k++ )
+                {
+                    BOOST_CHECK_EQUAL( readData.first[ i ][ j ][ k ], coefficients[ i ][ j ][ k ]( fileIterator->first ) );
+                    BOOST_CHECK_EQUAL( mappedData[ i ][ j ][ k ], coefficients[ i ][ j ][ k ]( fileIterator->first ) );
+                }
+            }
+        }
+
+        // Check that reading with wrong number of independent variables is detected
+        BOOST_CHECK_THROW( tudat::input_output::MultiArrayFileReader< 2 >::readMultiArray( fileIterator->second ),
+                           std::runtime_error );
+    }
+
+    boost::filesystem::remove_all( outputDirectory );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -174,6 +174,45 @@ BOOST_AUTO_TEST_CASE( test_function_readSolarActivityData )
     }
 }
 
+//! Test shared loading of solar activity data, and retrieval of data per day
+BOOST_AUTO_TEST_CASE( test_loadSolarActivityData )
+{
+    using tudat::input_output::solar_activity::SolarActivityDataMap;
+    using tudat::input_output::solar_activity::SolarActivityContainer;
+
+    std::string filePath = paths::getTudatTestDataPath() + "/sw19571001.txt";
+
+    // Load data, and check that it is shared between calls
+    std::shared_ptr< SolarActivityContainer > solarActivityContainer =
+            tudat::input_output::solar_activity::loadSolarActivityData( filePath );
+    BOOST_CHECK_EQUAL( solarActivityContainer, tudat::input_output::solar_activity::loadSolarActivityData( filePath ) );
+
+    // Check that data for each day (and at any time during the day) is the same as the data read from file
+    SolarActivityDataMap solarActivity = tudat::input_output::solar_activity::readSolarActivityData( filePath );
+    BOOST_CHECK_EQUAL( solarActivityContainer->getFirstJulianDay( ), solarActivity.begin( )->first );
+    BOOST_CHECK_EQUAL( solarActivityContainer->getLastJulianDay( ), solarActivity.rbegin( )->first );
+    for( auto it : solarActivity )
+    {
+        for( double fractionOfDay : { 0.0, 0.25, 0.999 } )
+        {
+            std::shared_ptr< tudat::input_output::solar_activity::SolarActivityData > dayData =
+                    solarActivityContainer->getSolarActivityDataAtJulianDay( it.first + fractionOfDay );
+            BOOST_CHECK_EQUAL( dayData->year, it.second->year );
+            BOOST_CHECK_EQUAL( dayData->month, it.second->month );
+            BOOST_CHECK_EQUAL( dayData->day, it.second->day );
+            BOOST_CHECK_EQUAL( dayData->solarRadioFlux107Observed, it.second->solarRadioFlux107Observed );
+        }
+    }
+
+    // Check that data is clamped to first and last day outside of the range of the file
+    BOOST_CHECK_EQUAL( solarActivityContainer->getSolarActivityDataAtJulianDay( solarActivity.begin( )->first - 10.0 )->day,
+                       solarActivity.begin( )->second->day );
+    BOOST_CHECK_EQUAL( solarActivityContainer->getSolarActivityDataAtJulianDay( solarActivity.rbegin( )->first + 10.0 )->day,
+                       solarActivity.rbegin( )->second->day );
+
+    tudat::input_output::solar_activity::clearSolarActivityDataCache( );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }   // unit_tests
@@ -0,0 +1,214 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <algorithm>
+#include <cmath>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "tudat/math/basic/kdTree.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace basic_mathematics;
+
+//! Function to compute the distance to all points by exhaustive search, sorted by distance (and index for ties)
+std::vector< std::pair< int, double > > computeSortedNeighboursByExhaustiveSearch(
+        const Eigen::MatrixXd& points, const Eigen::VectorXd& queryPoint )
+{
+    std::vector< std::pair< double, int > > squaredDistances;
+    for( int i = 0; i < points.rows( ); i++ )
+    {
+        squaredDistances.push_back( std::make_pair( ( points.row( i ).transpose( ) - queryPoint ).squaredNorm( ), i ) );
+    }
+    std::sort( squaredDistances.begin( ), squaredDistances.end( ) );
+
+    std::vector< std::pair< int, double > > neighbours;
+    for( unsigned int i = 0; i < squaredDistances.size( ); i++ )
+    {
+        neighbours.push_back( std::make_pair( squaredDistances.at( i ).second, std::sqrt( squaredDistances.at( i ).first ) ) );
+    }
+    return neighbours;
+}
+
+//! Function to create set of pseudo-random points, with one point per row
+Eigen::MatrixXd getTestPoints( const int numberOfPoints, const int numberOfDimensions )
+{
+    Eigen::MatrixXd points( numberOfPoints, numberOfDimensions );
+    for( int i = 0; i < numberOfPoints; i++ )
+    {
+        for( int j = 0; j < numberOfDimensions; j++ )
+        {
+            points( i, j ) = 100.0 * std::sin( 12.9898 * i + 78.233 * j + 0.1 * i * j );
+        }
+    }
+    return points;
+}
+
+//! Function to check whether two lists of neighbours are identical (up to rounding in computed distances)
+void checkNeighbours( const std::vector< std::pair< int, double > >& computedNeighbours,
+                      const std::vector< std::pair< int, double > >& expectedNeighbours )
+{
+    BOOST_CHECK_EQUAL( computedNeighbours.size( ), expectedNeighbours.size( ) );
+    for( unsigned int i = 0; i < std::min( computedNeighbours.size( ), expectedNeighbours.size( ) ); i++ )
+    {
+        BOOST_CHECK_EQUAL( computedNeighbours.at( i ).first, expectedNeighbours.at( i ).first );
+        BOOST_CHECK_CLOSE_FRACTION( computedNeighbours.at( i ).second, expectedNeighbours.at( i ).second, 1.0E-15 );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE( test_kd_tree )
+
+//! Test k-nearest neighbour and radius queries against exhaustive search, in 3 dimensions
+BOOST_AUTO_TEST_CASE( testKdTreeQueries3Dimensions )
+{
+    Eigen::MatrixXd points = getTestPoints( 2000, 3 );
+    Eigen::MatrixXd queryPoints = 1.2 * getTestPoints( 200, 3 ).rowwise( ).reverse( );
+
+    for( int maximumLeafSize = 1; maximumLeafSize <= 32; maximumLeafSize *= 4 )
+    {
+        KdTree< 3 > tree( points, maximumLeafSize );
+        BOOST_CHECK_EQUAL( tree.getNumberOfPoints( ), 2000 );
+        BOOST_CHECK_EQUAL( tree.getNumberOfDimensions( ), 3 );
+
+        for( int i = 0; i < queryPoints.rows( ); i++ )
+        {
+            Eigen::Vector3d queryPoint = queryPoints.row( i ).transpose( );
+            std::vector< std::pair< int, double > > expectedNeighbours =
+                    computeSortedNeighboursByExhaustiveSearch( points, queryPoint );
+
+            // Check nearest neighbour
+            double distance;
+            BOOST_CHECK_EQUAL( tree.findNearestNeighbour( queryPoint, distance ), expectedNeighbours.at( 0 ).first );
+            BOOST_CHECK_CLOSE_FRACTION( distance, expectedNeighbours.at( 0 ).second, 1.0E-15 );
+
+            // Check k nearest neighbours
+            checkNeighbours( tree.findNearestNeighbours( queryPoint, 10 ),
+                             std::vector< std::pair< int, double > >(
+                                 expectedNeighbours.begin( ), expectedNeighbours.begin( ) + 10 ) );
+
+            // Check neighbours within radius
+            double radius = 0.5 * ( expectedNeighbours.at( 25 ).second + expectedNeighbours.at( 26 ).second );
+            checkNeighbours( tree.findNeighboursWithinRadius( queryPoint, radius ),
+                             std::vector< std::pair< int, double > >(
+                                 expectedNeighbours.begin( ), expectedNeighbours.begin( ) + 26 ) );
+        }
+    }
+}
+
+//! Test queries in case of many points at identical distance (points on grid, including duplicates)
+BOOST_AUTO_TEST_CASE( testKdTreeQueriesWithTies )
+{
+    Eigen::MatrixXd points( 2 * 125, 3 );
+    for( int i = 0; i < 125; i++ )
+    {
+        points.row( i ) << i % 5, ( i / 5 ) % 5, i / 25;
+        points.row( 125 + i ) = points.row( i );
+    }
+
+    KdTree< 3 > tree( points, 4 );
+    for( int i = 0; i < 125; i++ )
+    {
+        // Query at grid points and cell centers
+        Eigen::Vector3d queryPoint = points.row( i ).transpose( ) + ( i % 2 ) * Eigen::Vector3d::Constant( 0.5 );
+        std::vector< std::pair< int, double > > expectedNeighbours =
+                computeSortedNeighboursByExhaustiveSearch( points, queryPoint );
+
+        checkNeighbours( tree.findNearestNeighbours( queryPoint, 7 ),
+                         std::vector< std::pair< int, double > >(
+                             expectedNeighbours.begin( ), expectedNeighbours.begin( ) + 7 ) );
+
+        // Check nearest neighbour search starting from (arbitrary) initial guesses
+        for( int initialGuess : { -1, 0, i, ( 37 * i ) % 250, 249 } )
+        {
+            double distance;
+            BOOST_CHECK_EQUAL( tree.findNearestNeighbour( queryPoint, distance, initialGuess ),
+                               expectedNeighbours.at( 0 ).first );
+            BOOST_CHECK_EQUAL( distance, expectedNeighbours.at( 0 ).second );
+        }
+
+        std::vector< std::pair< int, double > > neighboursInRadius = tree.findNeighboursWithinRadius( queryPoint, 1.0 );
+        int numberOfExpectedNeighbours = static_cast< int >( std::count_if(
+                    expectedNeighbours.begin( ), expectedNeighbours.end( ),
+                    [ ]( const std::pair< int, double >& neighbour ){ return neighbour.second <= 1.0; } ) );
+        checkNeighbours( neighboursInRadius, std::vector< std::pair< int, double > >(
+                             expectedNeighbours.begin( ), expectedNeighbours.begin( ) + numberOfExpectedNeighbours ) );
+    }
+}
+
+//! Test queries for points of which the dimension is set at run time, and batch queries distributed over threads
+BOOST_AUTO_TEST_CASE( testKdTreeQueriesDynamicDimensionAndBatch )
+{
+    Eigen::MatrixXd points = getTestPoints( 1000, 5 );
+    Eigen::MatrixXd queryPoints = getTestPoints( 300, 5 ).rowwise( ).reverse( );
+
+    KdTree< Eigen::Dynamic > tree( points );
+    BOOST_CHECK_EQUAL( tree.getNumberOfDimensions( ), 5 );
+
+    std::vector< std::vector< std::pair< int, double > > > nearestNeighbours =
+            tree.findNearestNeighboursOfPoints( queryPoints, 5, 4 );
+    std::vector< std::vector< std::pair< int, double > > > neighboursInRadius =
+            tree.findNeighboursWithinRadiusOfPoints( queryPoints, 60.0, 4 );
+    BOOST_CHECK_EQUAL( nearestNeighbours.size( ), 300 );
+    BOOST_CHECK_EQUAL( neighboursInRadius.size( ), 300 );
+
+    for( int i = 0; i < queryPoints.rows( ); i++ )
+    {
+        std::vector< std::pair< int, double > > expectedNeighbours =
+                computeSortedNeighboursByExhaustiveSearch( points, queryPoints.row( i ).transpose( ) );
+        checkNeighbours( nearestNeighbours.at( i ), std::vector< std::pair< int, double > >(
+                             expectedNeighbours.begin( ), expectedNeighbours.begin( ) + 5 ) );
+
+        int numberOfExpectedNeighbours = static_cast< int >( std::count_if(
+                    expectedNeighbours.begin( ), expectedNeighbours.end( ),
+                    [ ]( const std::pair< int, double >& neighbour ){ return neighbour.second <= 60.0; } ) );
+        checkNeighbours( neighboursInRadius.at( i ), std::vector< std::pair< int, double > >(
+                             expectedNeighbours.begin( ), expectedNeighbours.begin( ) + numberOfExpectedNeighbours ) );
+    }
+}
+
+//! Test queries on small and empty trees, and invalid input
+BOOST_AUTO_TEST_CASE( testKdTreeSpecialCases )
+{
+    // Request more neighbours than there are points
+    Eigen::MatrixXd points = getTestPoints( 3, 3 );
+    KdTree< 3 > tree( points );
+    BOOST_CHECK_EQUAL( tree.findNearestNeighbours( Eigen::Vector3d::Zero( ), 10 ).size( ), 3 );
+    BOOST_CHECK_EQUAL( tree.findNearestNeighbours( Eigen::Vector3d::Zero( ), 0 ).size( ), 0 );
+    BOOST_CHECK_EQUAL( tree.findNeighboursWithinRadius( Eigen::Vector3d::Zero( ), -1.0 ).size( ), 0 );
+
+    // Query empty tree
+    KdTree< 3 > emptyTree( Eigen::MatrixXd::Zero( 0, 3 ) );
+    double distance;
+    BOOST_CHECK_EQUAL( emptyTree.findNearestNeighbour( Eigen::Vector3d::Zero( ), distance ), -1 );
+    BOOST_CHECK_EQUAL( emptyTree.findNeighboursWithinRadius( Eigen::Vector3d::Zero( ), 1.0 ).size( ), 0 );
+
+    // Check inconsistent dimensions
+    BOOST_CHECK_THROW( KdTree< 3 >( getTestPoints( 10, 2 ) ), std::runtime_error );
+    BOOST_CHECK_THROW( KdTree< 3 >( points, 0 ), std::runtime_error );
+    KdTree< Eigen::Dynamic > dynamicTree( getTestPoints( 10, 2 ) );
+    BOOST_CHECK_THROW( dynamicTree.findNearestNeighbours( Eigen::Vector3d::Zero( ), 1 ), std::runtime_error );
+    BOOST_CHECK_THROW( dynamicTree.findNearestNeighboursOfPoints( points, 1 ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
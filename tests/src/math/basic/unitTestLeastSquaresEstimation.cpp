@@ -0,0 +1,581 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/LU>
+
+#include "tudat/math/basic/mathematicalConstants.h"
+#include "tudat/math/basic/leastSquaresEstimation.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_least_squares_estimation )
+
+//! Data shared by the threads emulating a group of processes in ThreadProcessCommunicator
+struct SharedThreadProcessData
+{
+    SharedThreadProcessData( const int numberOfProcesses ):
+        numberOfProcesses_( numberOfProcesses ), processData_( numberOfProcesses ), numberOfWaitingProcesses_( 0 ),
+        barrierGeneration_( 0 ){ }
+
+    //! Function to block until all processes have called this function
+    void waitForAllProcesses( )
+    {
+        std::unique_lock< std::mutex > lock( mutex_ );
+        int currentGeneration = barrierGeneration_;
+        if( ++numberOfWaitingProcesses_ == numberOfProcesses_ )
+        {
+            numberOfWaitingProcesses_ = 0;
+            barrierGeneration_++;
+            condition_.notify_all( );
+        }
+        else
+        {
+            condition_.wait( lock, [ & ]( ){ return barrierGeneration_ != currentGeneration; } );
+        }
+    }
+
+    int numberOfProcesses_;
+
+    std::vector< std::vector< double > > processData_;
+
+    std::mutex mutex_;
+
+    std::condition_variable condition_;
+
+    int numberOfWaitingProcesses_;
+
+    int barrierGeneration_;
+};
+
+//! Process communicator emulating a group of processes by threads, to test distributed computations without MPI
+class ThreadProcessCommunicator: public utilities::ProcessCommunicator
+{
+public:
+
+    ThreadProcessCommunicator( const std::shared_ptr< SharedThreadProcessData > sharedData, const int processIndex ):
+        sharedData_( sharedData ), processIndex_( processIndex ){ }
+
+    int getProcessIndex( ){ return processIndex_; }
+
+    int getNumberOfProcesses( ){ return sharedData_->numberOfProcesses_; }
+
+    void sumOverProcesses( double* data, const int dataSize )
+    {
+        combineOverProcesses( data, dataSize, [ ]( const double a, const double b ){ return a + b; } );
+    }
+
+    void minimumOverProcesses( double* data, const int dataSize )
+    {
+        combineOverProcesses( data, dataSize, [ ]( const double a, const double b ){ return std::min( a, b ); } );
+    }
+
+    void maximumOverProcesses( double* data, const int dataSize )
+    {
+        combineOverProcesses( data, dataSize, [ ]( const double a, const double b ){ return std::max( a, b ); } );
+    }
+
+    void broadcastFromRootProcess( double* data, const int dataSize )
+    {
+        combineOverProcesses( data, dataSize, [ ]( const double a, const double ){ return a; } );
+    }
+
+private:
+
+    //! Function to combine the data of all processes in order of the process index
+    void combineOverProcesses( double* data, const int dataSize, const std::function< double( double, double ) >& combine )
+    {
+        sharedData_->processData_[ processIndex_ ].assign( data, data + dataSize );
+        sharedData_->waitForAllProcesses( );
+        for( int i = 0; i < dataSize; i++ )
+        {
+            data[ i ] = sharedData_->processData_[ 0 ][ i ];
+            for( int j = 1; j < sharedData_->numberOfProcesses_; j++ )
+            {
+                data[ i ] = combine( data[ i ], sharedData_->processData_[ j ][ i ] );
+            }
+        }
+        sharedData_->waitForAllProcesses( );
+    }
+
+    std::shared_ptr< SharedThreadProcessData > sharedData_;
+
+    int processIndex_;
+};
+
+//! Test whether normal equations accumulated per block of observations reproduce the solution from the full design matrix
+BOOST_AUTO_TEST_CASE( testNormalEquationsAccumulation )
+{
+    using namespace linear_algebra;
+
+    const int numberOfObservations = 203;
+    const int numberOfParameters = 6;
+    const int numberOfConsiderParameters = 2;
+
+    // Define design matrix (with one all-zero column), residuals, weights and a priori information
+    std::srand( 42 );
+    Eigen::MatrixXd designMatrix = Eigen::MatrixXd::Random( numberOfObservations, numberOfParameters );
+    designMatrix.col( 1 ) *= 1.0E4;
+    designMatrix.col( 4 ).setZero( );
+    Eigen::MatrixXd considerDesignMatrix = Eigen::MatrixXd::Random( numberOfObservations, numberOfConsiderParameters );
+    Eigen::VectorXd residuals = Eigen::VectorXd::Random( numberOfObservations );
+    Eigen::VectorXd weights = Eigen::VectorXd::Random( numberOfObservations ).cwiseAbs( ) +
+            Eigen::VectorXd::Constant( numberOfObservations, 0.1 );
+    Eigen::MatrixXd inverseAprioriCovariance = Eigen::MatrixXd::Identity( numberOfParameters, numberOfParameters );
+    Eigen::MatrixXd considerCovariance = Eigen::MatrixXd::Identity( numberOfConsiderParameters, numberOfConsiderParameters );
+
+    // Accumulate normal equations in blocks (of unequal size), split over two objects
+    NormalEquationsAccumulator firstNormalEquations( numberOfParameters + numberOfConsiderParameters );
+    NormalEquationsAccumulator secondNormalEquations( numberOfParameters + numberOfConsiderParameters );
+    Eigen::MatrixXd fullDesignMatrix = Eigen::MatrixXd( numberOfObservations, numberOfParameters + numberOfConsiderParameters );
+    fullDesignMatrix << designMatrix, considerDesignMatrix;
+    const int blockSize = 17;
+    for( int i = 0; i < numberOfObservations; i += blockSize )
+    {
+        int currentBlockSize = std::min( blockSize, numberOfObservations - i );
+        NormalEquationsAccumulator& currentNormalEquations = ( i < numberOfObservations / 2 ) ?
+                    firstNormalEquations : secondNormalEquations;
+        currentNormalEquations.addObservations(
+                    fullDesignMatrix.block( i, 0, currentBlockSize, fullDesignMatrix.cols( ) ),
+                    residuals.segment( i, currentBlockSize ), weights.segment( i, currentBlockSize ) );
+    }
+    NormalEquationsAccumulator normalEquations( numberOfParameters + numberOfConsiderParameters );
+    normalEquations.addNormalEquations( firstNormalEquations );
+    normalEquations.addNormalEquations( secondNormalEquations );
+    BOOST_CHECK_EQUAL( normalEquations.getNumberOfObservations( ), numberOfObservations );
+
+    // Check normal matrix and right-hand side
+    Eigen::MatrixXd expectedNormalMatrix = fullDesignMatrix.transpose( ) * weights.asDiagonal( ) * fullDesignMatrix;
+    Eigen::VectorXd expectedRightHandSide = fullDesignMatrix.transpose( ) * weights.cwiseProduct( residuals );
+    for( int i = 0; i < fullDesignMatrix.cols( ); i++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( normalEquations.getRightHandSide( )( i ) - expectedRightHandSide( i ) ),
+                           1.0E-12 * expectedRightHandSide.cwiseAbs( ).maxCoeff( ) );
+        for( int j = 0; j < fullDesignMatrix.cols( ); j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( normalEquations.getNormalMatrix( )( i, j ) - expectedNormalMatrix( i, j ) ),
+                               1.0E-12 * expectedNormalMatrix.cwiseAbs( ).maxCoeff( ) );
+        }
+    }
+
+    // Check normalization terms (entry with largest absolute value per column, 1 for zero column)
+    Eigen::VectorXd normalizationTerms = normalEquations.getNormalizationTerms( );
+    for( int i = 0; i < fullDesignMatrix.cols( ); i++ )
+    {
+        int maximumIndex;
+        fullDesignMatrix.col( i ).cwiseAbs( ).maxCoeff( &maximumIndex );
+        double expectedNormalizationTerm = ( i == 4 ) ? 1.0 : fullDesignMatrix( maximumIndex, i );
+        BOOST_CHECK_EQUAL( normalizationTerms( i ), expectedNormalizationTerm );
+    }
+
+    // Compare least squares solution (with and without constraints) to that computed from design matrix
+    Eigen::MatrixXd constraintMultiplier = Eigen::MatrixXd::Zero( 1, numberOfParameters );
+    constraintMultiplier( 0, 0 ) = 1.0;
+    constraintMultiplier( 0, 2 ) = -1.0;
+    Eigen::VectorXd constraintRightHandSide = Eigen::VectorXd::Zero( 1 );
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        Eigen::MatrixXd currentConstraintMultiplier = ( test == 0 ) ? Eigen::MatrixXd( 0, 0 ) : constraintMultiplier;
+        Eigen::VectorXd currentConstraintRightHandSide = ( test == 0 ) ? Eigen::VectorXd( 0 ) : constraintRightHandSide;
+
+        std::pair< Eigen::VectorXd, Eigen::MatrixXd > designMatrixSolution = performLeastSquaresAdjustmentFromDesignMatrix(
+                    designMatrix, residuals, weights, inverseAprioriCovariance, 1.0E12,
+                    currentConstraintMultiplier, currentConstraintRightHandSide );
+        std::pair< Eigen::VectorXd, Eigen::MatrixXd > normalEquationsSolution = performLeastSquaresAdjustmentFromInformationMatrix(
+                    normalEquations.getNormalMatrix( ).block( 0, 0, numberOfParameters, numberOfParameters ),
+                    normalEquations.getRightHandSide( ).segment( 0, numberOfParameters ), inverseAprioriCovariance, 1.0E12,
+                    currentConstraintMultiplier, currentConstraintRightHandSide );
+
+        BOOST_CHECK_EQUAL( designMatrixSolution.first.rows( ), normalEquationsSolution.first.rows( ) );
+        for( int i = 0; i < designMatrixSolution.first.rows( ); i++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( designMatrixSolution.first( i ) - normalEquationsSolution.first( i ) ),
+                               1.0E-10 * designMatrixSolution.first.cwiseAbs( ).maxCoeff( ) );
+            for( int j = 0; j < designMatrixSolution.first.rows( ); j++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( designMatrixSolution.second( i, j ) - normalEquationsSolution.second( i, j ) ),
+                                   1.0E-12 * designMatrixSolution.second.cwiseAbs( ).maxCoeff( ) );
+            }
+        }
+    }
+
+    // Compare consider parameter covariance contribution to that computed from design matrices
+    Eigen::MatrixXd covariance = calculateInverseOfUpdatedCovarianceMatrix(
+                designMatrix, weights, inverseAprioriCovariance ).inverse( );
+    Eigen::MatrixXd expectedConsiderContribution = calculateConsiderParametersCovarianceContribution(
+                covariance, designMatrix, weights, considerDesignMatrix, considerCovariance );
+    Eigen::MatrixXd considerContribution = calculateConsiderParametersCovarianceContributionFromNormalMatrix(
+                covariance, normalEquations.getNormalMatrix( ).block(
+                    0, numberOfParameters, numberOfParameters, numberOfConsiderParameters ), considerCovariance );
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        for( int j = 0; j < numberOfParameters; j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( considerContribution( i, j ) - expectedConsiderContribution( i, j ) ),
+                               1.0E-10 * expectedConsiderContribution.cwiseAbs( ).maxCoeff( ) );
+        }
+    }
+}
+
+//! Test whether all linear solver types give the same least squares solution
+BOOST_AUTO_TEST_CASE( testLeastSquaresLinearSolvers )
+{
+    using namespace linear_algebra;
+
+    const int numberOfObservations = 150;
+    const int numberOfParameters = 8;
+
+    std::srand( 1 );
+    Eigen::MatrixXd designMatrix = Eigen::MatrixXd::Random( numberOfObservations, numberOfParameters );
+    Eigen::VectorXd residuals = Eigen::VectorXd::Random( numberOfObservations );
+    Eigen::VectorXd weights = Eigen::VectorXd::Random( numberOfObservations ).cwiseAbs( ) +
+            Eigen::VectorXd::Constant( numberOfObservations, 0.1 );
+
+    // A priori information on a subset of parameters only (positive semi-definite)
+    Eigen::MatrixXd inverseAprioriCovariance = Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters );
+    inverseAprioriCovariance.block( 0, 0, 3, 3 ) = Eigen::Matrix3d::Identity( ) * 2.0;
+    inverseAprioriCovariance( 0, 1 ) = inverseAprioriCovariance( 1, 0 ) = 0.5;
+
+    Eigen::MatrixXd considerDesignMatrix = Eigen::MatrixXd::Random( numberOfObservations, 2 );
+    Eigen::VectorXd considerParametersDeviations = Eigen::VectorXd::Random( 2 );
+
+    Eigen::MatrixXd constraintMultiplier = Eigen::MatrixXd::Zero( 1, numberOfParameters );
+    constraintMultiplier( 0, 5 ) = 1.0;
+    constraintMultiplier( 0, 6 ) = 1.0;
+    Eigen::VectorXd constraintRightHandSide = Eigen::VectorXd::Constant( 1, 0.1 );
+
+    std::vector< LinearSolverType > solverTypes =
+    { bdc_svd_solver, llt_solver, ldlt_solver, column_pivoting_qr_solver };
+    for( unsigned int useConstraints = 0; useConstraints < 2; useConstraints++ )
+    {
+        Eigen::MatrixXd currentConstraintMultiplier = useConstraints ? constraintMultiplier : Eigen::MatrixXd( 0, 0 );
+        Eigen::VectorXd currentConstraintRightHandSide = useConstraints ? constraintRightHandSide : Eigen::VectorXd( 0 );
+
+        std::pair< Eigen::VectorXd, Eigen::MatrixXd > svdSolution = performLeastSquaresAdjustmentFromDesignMatrix(
+                    designMatrix, residuals, weights, inverseAprioriCovariance, TUDAT_NAN,
+                    currentConstraintMultiplier, currentConstraintRightHandSide,
+                    considerDesignMatrix, considerParametersDeviations, jacobi_svd_solver );
+
+        for( unsigned int i = 0; i < solverTypes.size( ); i++ )
+        {
+            // Cholesky decomposition is not applicable to (indefinite) constrained normal equations
+            if( useConstraints && solverTypes.at( i ) == llt_solver )
+            {
+                BOOST_CHECK_THROW( performLeastSquaresAdjustmentFromDesignMatrix(
+                                       designMatrix, residuals, weights, inverseAprioriCovariance, TUDAT_NAN,
+                                       currentConstraintMultiplier, currentConstraintRightHandSide,
+                                       considerDesignMatrix, considerParametersDeviations, solverTypes.at( i ) ),
+                                   std::runtime_error );
+                continue;
+            }
+
+            std::pair< Eigen::VectorXd, Eigen::MatrixXd > currentSolution = performLeastSquaresAdjustmentFromDesignMatrix(
+                        designMatrix, residuals, weights, inverseAprioriCovariance, TUDAT_NAN,
+                        currentConstraintMultiplier, currentConstraintRightHandSide,
+                        considerDesignMatrix, considerParametersDeviations, solverTypes.at( i ) );
+
+            BOOST_CHECK_EQUAL( currentSolution.first.rows( ), svdSolution.first.rows( ) );
+            for( int j = 0; j < svdSolution.first.rows( ); j++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( currentSolution.first( j ) - svdSolution.first( j ) ),
+                                   1.0E-10 * svdSolution.first.cwiseAbs( ).maxCoeff( ) );
+            }
+            BOOST_CHECK_SMALL( ( currentSolution.second - svdSolution.second ).cwiseAbs( ).maxCoeff( ),
+                               1.0E-12 * svdSolution.second.cwiseAbs( ).maxCoeff( ) );
+        }
+    }
+
+    // Check that Cholesky decomposition detects a singular normal matrix
+    Eigen::MatrixXd singularDesignMatrix = designMatrix;
+    singularDesignMatrix.col( 7 ).setZero( );
+    BOOST_CHECK_THROW( performLeastSquaresAdjustmentFromDesignMatrix(
+                           singularDesignMatrix, residuals, weights, Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters ),
+                           TUDAT_NAN, Eigen::MatrixXd( 0, 0 ), Eigen::VectorXd( 0 ), Eigen::MatrixXd( 0, 0 ), Eigen::VectorXd( 0 ),
+                           llt_solver ), std::runtime_error );
+}
+
+//! Test whether elimination of arc-local parameters reproduces the solution of the full normal equations
+BOOST_AUTO_TEST_CASE( testArcLocalParameterReduction )
+{
+    using namespace linear_algebra;
+
+    const int numberOfArcs = 4;
+    const int numberOfLocalParametersPerArc = 5;
+    const int numberOfObservationsPerArc = 40;
+    const int numberOfGlobalObservations = 10;
+    const int numberOfParameters = 3 + numberOfArcs * numberOfLocalParametersPerArc;
+    const int numberOfObservations = numberOfArcs * numberOfObservationsPerArc + numberOfGlobalObservations;
+
+    // Define division of parameters, with global parameters interleaved with local parameters
+    std::vector< int > globalParameterIndices = { 0, 11, 22 };
+    std::vector< std::vector< int > > arcLocalParameterIndices( numberOfArcs );
+    int localParameterCounter = 0;
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        if( std::find( globalParameterIndices.begin( ), globalParameterIndices.end( ), i ) == globalParameterIndices.end( ) )
+        {
+            arcLocalParameterIndices[ localParameterCounter / numberOfLocalParametersPerArc ].push_back( i );
+            localParameterCounter++;
+        }
+    }
+
+    // Define design matrix, in which each observation depends on global parameters and local parameters of one arc only
+    std::srand( 7 );
+    Eigen::MatrixXd designMatrix = Eigen::MatrixXd::Zero( numberOfObservations, numberOfParameters );
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        for( unsigned int j = 0; j < globalParameterIndices.size( ); j++ )
+        {
+            designMatrix( i, globalParameterIndices.at( j ) ) = Eigen::VectorXd::Random( 1 )( 0 );
+        }
+        if( i < numberOfArcs * numberOfObservationsPerArc )
+        {
+            const std::vector< int >& currentLocalIndices = arcLocalParameterIndices.at( i / numberOfObservationsPerArc );
+            for( unsigned int j = 0; j < currentLocalIndices.size( ); j++ )
+            {
+                designMatrix( i, currentLocalIndices.at( j ) ) = 1.0E3 * Eigen::VectorXd::Random( 1 )( 0 );
+            }
+        }
+    }
+    Eigen::VectorXd residuals = Eigen::VectorXd::Random( numberOfObservations );
+    Eigen::VectorXd weights = Eigen::VectorXd::Random( numberOfObservations ).cwiseAbs( ) +
+            Eigen::VectorXd::Constant( numberOfObservations, 0.1 );
+
+    // Define a priori information, with correlations within an arc, and between local and global parameters
+    Eigen::MatrixXd inverseAprioriCovariance = Eigen::MatrixXd::Identity( numberOfParameters, numberOfParameters );
+    inverseAprioriCovariance( 1, 2 ) = inverseAprioriCovariance( 2, 1 ) = 0.3;
+    inverseAprioriCovariance( 0, 3 ) = inverseAprioriCovariance( 3, 0 ) = 0.2;
+
+    // Accumulate normal equations in blocks that span multiple arcs, split over two objects
+    NormalEquationsAccumulator normalEquations( numberOfParameters );
+    ArcWiseNormalEquationsAccumulator firstArcWiseNormalEquations( numberOfParameters, arcLocalParameterIndices );
+    ArcWiseNormalEquationsAccumulator secondArcWiseNormalEquations( numberOfParameters, arcLocalParameterIndices );
+    const int blockSize = 13;
+    for( int i = 0; i < numberOfObservations; i += blockSize )
+    {
+        int currentBlockSize = std::min( blockSize, numberOfObservations - i );
+        normalEquations.addObservations(
+                    designMatrix.block( i, 0, currentBlockSize, numberOfParameters ),
+                    residuals.segment( i, currentBlockSize ), weights.segment( i, currentBlockSize ) );
+        ArcWiseNormalEquationsAccumulator& currentArcWiseNormalEquations = ( i < numberOfObservations / 2 ) ?
+                    firstArcWiseNormalEquations : secondArcWiseNormalEquations;
+        currentArcWiseNormalEquations.addObservations(
+                    designMatrix.block( i, 0, currentBlockSize, numberOfParameters ),
+                    residuals.segment( i, currentBlockSize ), weights.segment( i, currentBlockSize ) );
+    }
+    ArcWiseNormalEquationsAccumulator arcWiseNormalEquations( numberOfParameters, arcLocalParameterIndices );
+    arcWiseNormalEquations.addNormalEquations( firstArcWiseNormalEquations );
+    arcWiseNormalEquations.addNormalEquations( secondArcWiseNormalEquations );
+    BOOST_CHECK_EQUAL( arcWiseNormalEquations.getNumberOfObservations( ), numberOfObservations );
+    BOOST_CHECK_EQUAL( arcWiseNormalEquations.getGlobalParameterIndices( ).size( ), globalParameterIndices.size( ) );
+
+    // Check assembled normal equations and normalization terms against dense accumulation
+    BOOST_CHECK_SMALL( ( arcWiseNormalEquations.getFullNormalMatrix( ) - normalEquations.getNormalMatrix( ) ).cwiseAbs( ).maxCoeff( ),
+                       1.0E-12 * normalEquations.getNormalMatrix( ).cwiseAbs( ).maxCoeff( ) );
+    BOOST_CHECK_SMALL( ( arcWiseNormalEquations.getFullRightHandSide( ) - normalEquations.getRightHandSide( ) ).cwiseAbs( ).maxCoeff( ),
+                       1.0E-12 * normalEquations.getRightHandSide( ).cwiseAbs( ).maxCoeff( ) );
+    Eigen::VectorXd normalizationTerms = normalEquations.getNormalizationTerms( );
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        BOOST_CHECK_EQUAL( arcWiseNormalEquations.getNormalizationTerms( )( i ), normalizationTerms( i ) );
+    }
+
+    // Compare reduced solution (for various solvers and numbers of threads) to solution of full normalized normal equations
+    Eigen::MatrixXd normalizedNormalMatrix = normalEquations.getNormalMatrix( ).cwiseQuotient(
+                normalizationTerms * normalizationTerms.transpose( ) );
+    Eigen::VectorXd normalizedRightHandSide = normalEquations.getRightHandSide( ).cwiseQuotient( normalizationTerms );
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > fullSolution = performLeastSquaresAdjustmentFromInformationMatrix(
+                normalizedNormalMatrix, normalizedRightHandSide, inverseAprioriCovariance, TUDAT_NAN );
+
+    std::vector< LinearSolverType > solverTypes = { jacobi_svd_solver, ldlt_solver };
+    std::vector< int > numbersOfThreads = { 1, 3 };
+    for( unsigned int i = 0; i < solverTypes.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < numbersOfThreads.size( ); j++ )
+        {
+            std::pair< Eigen::VectorXd, Eigen::MatrixXd > reducedSolution = performLeastSquaresAdjustmentWithArcLocalParameterReduction(
+                        arcWiseNormalEquations, normalizationTerms, inverseAprioriCovariance, TUDAT_NAN,
+                        solverTypes.at( i ), numbersOfThreads.at( j ) );
+
+            BOOST_CHECK_EQUAL( reducedSolution.first.rows( ), numberOfParameters );
+            BOOST_CHECK_SMALL( ( reducedSolution.first - fullSolution.first ).cwiseAbs( ).maxCoeff( ),
+                               1.0E-10 * fullSolution.first.cwiseAbs( ).maxCoeff( ) );
+            BOOST_CHECK_SMALL( ( reducedSolution.second - fullSolution.second ).cwiseAbs( ).maxCoeff( ),
+                               1.0E-12 * fullSolution.second.cwiseAbs( ).maxCoeff( ) );
+        }
+    }
+
+    // Compare solution with arcs distributed over processes (including more processes than arcs) to full solution
+    std::vector< int > numbersOfProcesses = { 1, 3, 6 };
+    for( unsigned int i = 0; i < numbersOfProcesses.size( ); i++ )
+    {
+        int numberOfProcesses = numbersOfProcesses.at( i );
+        std::shared_ptr< SharedThreadProcessData > sharedData = std::make_shared< SharedThreadProcessData >( numberOfProcesses );
+        std::vector< std::pair< Eigen::VectorXd, Eigen::MatrixXd > > processSolutions( numberOfProcesses );
+        std::vector< int > processNumberOfObservations( numberOfProcesses );
+        std::vector< std::thread > processThreads;
+        for( int j = 0; j < numberOfProcesses; j++ )
+        {
+            processThreads.push_back( std::thread( [ &, j ]( )
+            {
+                std::shared_ptr< utilities::ProcessCommunicator > processCommunicator =
+                        std::make_shared< ThreadProcessCommunicator >( sharedData, j );
+
+                // Add observations of arcs of current process, and global observations on the last process
+                std::pair< int, int > arcRange = utilities::getProcessItemRange( numberOfArcs, j, numberOfProcesses );
+                ArcWiseNormalEquationsAccumulator processNormalEquations( numberOfParameters, arcLocalParameterIndices );
+                int firstObservation = arcRange.first * numberOfObservationsPerArc;
+                int numberOfProcessObservations = ( arcRange.second - arcRange.first ) * numberOfObservationsPerArc +
+                        ( ( j == numberOfProcesses - 1 ) ? numberOfGlobalObservations : 0 );
+                processNormalEquations.addObservations(
+                            designMatrix.block( firstObservation, 0, numberOfProcessObservations, numberOfParameters ),
+                            residuals.segment( firstObservation, numberOfProcessObservations ),
+                            weights.segment( firstObservation, numberOfProcessObservations ) );
+                processNormalEquations.reduceOverProcesses( processCommunicator );
+                processNumberOfObservations[ j ] = processNormalEquations.getNumberOfObservations( );
+
+                processSolutions[ j ] = performLeastSquaresAdjustmentWithArcLocalParameterReduction(
+                            processNormalEquations, processNormalEquations.getNormalizationTerms( ), inverseAprioriCovariance,
+                            TUDAT_NAN, ldlt_solver, 1, processCommunicator );
+            } ) );
+        }
+        for( int j = 0; j < numberOfProcesses; j++ )
+        {
+            processThreads.at( j ).join( );
+        }
+
+        for( int j = 0; j < numberOfProcesses; j++ )
+        {
+            BOOST_CHECK_EQUAL( processNumberOfObservations.at( j ), numberOfObservations );
+            BOOST_CHECK_SMALL( ( processSolutions.at( j ).first - fullSolution.first ).cwiseAbs( ).maxCoeff( ),
+                               1.0E-10 * fullSolution.first.cwiseAbs( ).maxCoeff( ) );
+            BOOST_CHECK_SMALL( ( processSolutions.at( j ).second - fullSolution.second ).cwiseAbs( ).maxCoeff( ),
+                               1.0E-12 * fullSolution.second.cwiseAbs( ).maxCoeff( ) );
+            BOOST_CHECK( processSolutions.at( j ).first == processSolutions.at( 0 ).first );
+        }
+    }
+
+    // Check that a priori correlation between local parameters of different arcs is rejected
+    Eigen::MatrixXd invalidInverseAprioriCovariance = inverseAprioriCovariance;
+    invalidInverseAprioriCovariance( arcLocalParameterIndices.at( 0 ).at( 0 ), arcLocalParameterIndices.at( 1 ).at( 0 ) ) = 0.1;
+    invalidInverseAprioriCovariance( arcLocalParameterIndices.at( 1 ).at( 0 ), arcLocalParameterIndices.at( 0 ).at( 0 ) ) = 0.1;
+    BOOST_CHECK_THROW( performLeastSquaresAdjustmentWithArcLocalParameterReduction(
+                           arcWiseNormalEquations, normalizationTerms, invalidInverseAprioriCovariance ), std::runtime_error );
+
+    // Check that an observation depending on local parameters of two arcs is rejected
+    Eigen::MatrixXd invalidDesignMatrix = designMatrix.block( 0, 0, 1, numberOfParameters );
+    invalidDesignMatrix( 0, arcLocalParameterIndices.at( 2 ).at( 0 ) ) = 1.0;
+    BOOST_CHECK_THROW( arcWiseNormalEquations.addObservations(
+                           invalidDesignMatrix, residuals.segment( 0, 1 ), weights.segment( 0, 1 ) ), std::runtime_error );
+
+    // Check that inconsistent division of parameters is rejected
+    std::vector< std::vector< int > > invalidArcLocalParameterIndices = arcLocalParameterIndices;
+    invalidArcLocalParameterIndices.at( 1 ).push_back( arcLocalParameterIndices.at( 0 ).at( 0 ) );
+    BOOST_CHECK_THROW( ArcWiseNormalEquationsAccumulator( numberOfParameters, invalidArcLocalParameterIndices ), std::runtime_error );
+}
+
+//! Test whether normal equations accumulated from the non-zero columns only reproduce the dense accumulation
+BOOST_AUTO_TEST_CASE( testNormalEquationsAccumulationWithNonZeroColumns )
+{
+    using namespace linear_algebra;
+
+    const int numberOfParameters = 12;
+    const int numberOfBlocks = 6;
+    const int blockSize = 9;
+
+    // Define two arcs, with local parameters 4-7 (arc 0) and 8-11 (arc 1), and global parameters 0-3
+    std::vector< std::vector< int > > arcLocalParameterIndices = { { 4, 5, 6, 7 }, { 8, 9, 10, 11 } };
+
+    NormalEquationsAccumulator denseNormalEquations( numberOfParameters );
+    NormalEquationsAccumulator reducedNormalEquations( numberOfParameters );
+    ArcWiseNormalEquationsAccumulator denseArcWiseNormalEquations( numberOfParameters, arcLocalParameterIndices );
+    ArcWiseNormalEquationsAccumulator reducedArcWiseNormalEquations( numberOfParameters, arcLocalParameterIndices );
+
+    // Add blocks of observations, each of which depends on a subset of the global parameters and of the local parameters
+    // of a single arc (e.g. a range bias of only one station)
+    std::srand( 11 );
+    for( int i = 0; i < numberOfBlocks; i++ )
+    {
+        std::vector< int > nonZeroColumns;
+        for( int j = 0; j < 4; j++ )
+        {
+            if( j < 2 || j == 2 + ( i % 2 ) )
+            {
+                nonZeroColumns.push_back( j );
+            }
+        }
+        const std::vector< int >& currentLocalIndices = arcLocalParameterIndices.at( i % 2 );
+        for( unsigned int j = 0; j < currentLocalIndices.size( ); j++ )
+        {
+            if( j != static_cast< unsigned int >( i % 3 ) )
+            {
+                nonZeroColumns.push_back( currentLocalIndices.at( j ) );
+            }
+        }
+
+        Eigen::MatrixXd designMatrixBlock = Eigen::MatrixXd::Zero( blockSize, numberOfParameters );
+        for( unsigned int j = 0; j < nonZeroColumns.size( ); j++ )
+        {
+            designMatrixBlock.col( nonZeroColumns.at( j ) ) = Eigen::VectorXd::Random( blockSize );
+        }
+        Eigen::VectorXd residuals = Eigen::VectorXd::Random( blockSize );
+        Eigen::VectorXd weights = Eigen::VectorXd::Random( blockSize ).cwiseAbs( ) + Eigen::VectorXd::Constant( blockSize, 0.1 );
+
+        denseNormalEquations.addObservations( designMatrixBlock, residuals, weights );
+        reducedNormalEquations.addObservations( designMatrixBlock, residuals, weights, nonZeroColumns );
+        denseArcWiseNormalEquations.addObservations( designMatrixBlock, residuals, weights );
+        reducedArcWiseNormalEquations.addObservations( designMatrixBlock, residuals, weights, nonZeroColumns );
+    }
+
+    // Check that restricted accumulation is identical to dense accumulation
+    BOOST_CHECK_SMALL( ( reducedNormalEquations.getNormalMatrix( ) - denseNormalEquations.getNormalMatrix( ) ).cwiseAbs( ).maxCoeff( ),
+                       1.0E-14 * denseNormalEquations.getNormalMatrix( ).cwiseAbs( ).maxCoeff( ) );
+    BOOST_CHECK_SMALL( ( reducedNormalEquations.getRightHandSide( ) - denseNormalEquations.getRightHandSide( ) ).cwiseAbs( ).maxCoeff( ),
+                       1.0E-14 * denseNormalEquations.getRightHandSide( ).cwiseAbs( ).maxCoeff( ) );
+    BOOST_CHECK_SMALL( ( reducedArcWiseNormalEquations.getFullNormalMatrix( ) - denseNormalEquations.getNormalMatrix( ) ).cwiseAbs( ).maxCoeff( ),
+                       1.0E-14 * denseNormalEquations.getNormalMatrix( ).cwiseAbs( ).maxCoeff( ) );
+    BOOST_CHECK_SMALL( ( reducedArcWiseNormalEquations.getFullRightHandSide( ) - denseNormalEquations.getRightHandSide( ) ).cwiseAbs( ).maxCoeff( ),
+                       1.0E-14 * denseNormalEquations.getRightHandSide( ).cwiseAbs( ).maxCoeff( ) );
+    BOOST_CHECK_SMALL( ( reducedArcWiseNormalEquations.getFullNormalMatrix( ) - denseArcWiseNormalEquations.getFullNormalMatrix( ) ).cwiseAbs( ).maxCoeff( ),
+                       1.0E-14 * denseNormalEquations.getNormalMatrix( ).cwiseAbs( ).maxCoeff( ) );
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        BOOST_CHECK_EQUAL( reducedNormalEquations.getNormalizationTerms( )( i ), denseNormalEquations.getNormalizationTerms( )( i ) );
+        BOOST_CHECK_EQUAL( reducedArcWiseNormalEquations.getNormalizationTerms( )( i ), denseNormalEquations.getNormalizationTerms( )( i ) );
+    }
+
+    // Check that out-of-range non-zero columns are rejected
+    BOOST_CHECK_THROW( reducedArcWiseNormalEquations.addObservations(
+                           Eigen::MatrixXd::Zero( 1, numberOfParameters ), Eigen::VectorXd::Zero( 1 ), Eigen::VectorXd::Ones( 1 ),
+                           std::vector< int >( { numberOfParameters } ) ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
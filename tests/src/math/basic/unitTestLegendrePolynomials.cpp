@@ -277,6 +277,122 @@ BOOST_AUTO_TEST_CASE( test_Legendre_GeodesyLegendrePolynomialDerivative )
     TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedValues, computedTestValues, 1.0e-14 );
 }
 
+//! Test extended range recursion of geodesy-normalized Legendre polynomials.
+BOOST_AUTO_TEST_CASE( test_ExtendedRangeGeodesyLegendrePolynomials )
+{
+    using namespace basic_mathematics;
+
+    // Check that extended range recursion is identical to standard recursion where the latter does not underflow
+    std::vector< double > polynomialParameters = { -0.3, 0.1, 0.7, 0.95 };
+    for( unsigned int i = 0; i < polynomialParameters.size( ); i++ )
+    {
+        LegendreCache standardCache( 300, 300, true );
+        LegendreCache extendedRangeCache( 300, 300, true );
+        extendedRangeCache.setRecursionType( extended_range_legendre_recursion );
+        BOOST_CHECK_EQUAL( extendedRangeCache.getRecursionType( ), extended_range_legendre_recursion );
+
+        standardCache.update( polynomialParameters.at( i ) );
+        extendedRangeCache.update( polynomialParameters.at( i ) );
+        for( int degree = 0; degree <= 300; degree++ )
+        {
+            for( int order = 0; order <= degree; order++ )
+            {
+                BOOST_CHECK_EQUAL( standardCache.getLegendrePolynomial( degree, order ),
+                                   extendedRangeCache.getLegendrePolynomial( degree, order ) );
+                BOOST_CHECK_EQUAL( standardCache.getLegendrePolynomialDerivative( degree, order ),
+                                   extendedRangeCache.getLegendrePolynomialDerivative( degree, order ) );
+            }
+        }
+    }
+
+    // Check very high degree polynomials, at a latitude where the relevant sectoral polynomials underflow in double
+    // precision (cosine of latitude equal to 1/e), against a long double evaluation of the same recursion.
+    int maximumDegree = 2100;
+    int maximumOrder = 800;
+    double cosineOfLatitude = std::exp( -1.0 );
+    double polynomialParameter = std::sqrt( 1.0 - cosineOfLatitude * cosineOfLatitude );
+
+    LegendreCache extendedRangeCache( maximumDegree, maximumOrder, true );
+    extendedRangeCache.setRecursionType( extended_range_legendre_recursion );
+    extendedRangeCache.update( polynomialParameter );
+
+    LegendreCache standardCache( maximumDegree, maximumOrder, true );
+    standardCache.update( polynomialParameter );
+
+    std::vector< int > testOrders = { 700, 760, 780, 800 };
+    for( unsigned int i = 0; i < testOrders.size( ); i++ )
+    {
+        int order = testOrders.at( i );
+
+        long double longParameter = static_cast< long double >( polynomialParameter );
+        long double degreeOneOrderOnePolynomial = std::sqrt( 3.0L - 3.0L * longParameter * longParameter );
+        long double oneDegreePriorPolynomial = degreeOneOrderOnePolynomial;
+        for( int degree = 2; degree <= order; degree++ )
+        {
+            oneDegreePriorPolynomial *= std::sqrt( ( 2.0L * degree + 1.0L ) / ( 6.0L * degree ) ) *
+                    degreeOneOrderOnePolynomial;
+        }
+        long double twoDegreesPriorPolynomial = 0.0L;
+        for( int degree = order + 1; degree <= maximumDegree; degree++ )
+        {
+            long double currentPolynomial =
+                    std::sqrt( ( 2.0L * degree + 1.0L ) / ( static_cast< long double >( degree + order ) *
+                                                            static_cast< long double >( degree - order ) ) ) *
+                    ( std::sqrt( 2.0L * degree - 1.0L ) * longParameter * oneDegreePriorPolynomial -
+                      std::sqrt( ( degree + order - 1.0L ) * ( degree - order - 1.0L ) / ( 2.0L * degree - 3.0L ) ) *
+                      twoDegreesPriorPolynomial );
+            twoDegreesPriorPolynomial = oneDegreePriorPolynomial;
+            oneDegreePriorPolynomial = currentPolynomial;
+        }
+
+        BOOST_CHECK_CLOSE_FRACTION( extendedRangeCache.getLegendrePolynomial( maximumDegree, order ),
+                                    static_cast< double >( oneDegreePriorPolynomial ), 1.0E-11 );
+
+        // Check that standard recursion underflows for all but the lowest tested order
+        if( i > 0 )
+        {
+            BOOST_CHECK_EQUAL( standardCache.getLegendrePolynomial( maximumDegree, order ), 0.0 );
+        }
+    }
+
+    // Check that extended range recursion is rejected for unnormalized polynomials
+    LegendreCache unnormalizedCache( 10, 10, false );
+    BOOST_CHECK_THROW( unnormalizedCache.setRecursionType( extended_range_legendre_recursion ), std::runtime_error );
+}
+
+//! Test packed storage of Legendre cache.
+BOOST_AUTO_TEST_CASE( test_LegendreCachePackedStorage )
+{
+    using namespace basic_mathematics;
+
+    // Check that polynomials retrieved per degree are equal to those retrieved per degree and order, for a cache with
+    // maximum order lower than maximum degree
+    LegendreCache legendreCache( 50, 20, true );
+    legendreCache.update( 0.4 );
+    for( int degree = 0; degree <= 50; degree++ )
+    {
+        const double* polynomialsOfDegree = legendreCache.getLegendrePolynomialValuesOfDegree( degree );
+        const double* derivativesOfDegree = legendreCache.getLegendrePolynomialDerivativeValuesOfDegree( degree );
+        for( int order = 0; order <= std::min( degree, 20 ); order++ )
+        {
+            BOOST_CHECK_EQUAL( polynomialsOfDegree[ order ], legendreCache.getLegendrePolynomial( degree, order ) );
+            BOOST_CHECK_EQUAL( derivativesOfDegree[ order ], legendreCache.getLegendrePolynomialDerivative( degree, order ) );
+            BOOST_CHECK_CLOSE_FRACTION( polynomialsOfDegree[ order ],
+                                        computeGeodesyLegendrePolynomial( degree, order, 0.4 ), 1.0E-13 );
+        }
+    }
+    BOOST_CHECK_THROW( legendreCache.getLegendrePolynomial( 51, 0 ), std::runtime_error );
+    BOOST_CHECK_THROW( legendreCache.getLegendrePolynomial( 30, 21 ), std::runtime_error );
+    BOOST_CHECK_THROW( legendreCache.getLegendrePolynomialSecondDerivative( 30, 10 ), std::runtime_error );
+
+    // Check that cache of degree and order 200 fits in 1 MB, and that second derivatives are only stored when needed
+    LegendreCache largeLegendreCache( 200, 200, true );
+    std::size_t memoryFootprint = largeLegendreCache.getMemoryFootprint( );
+    BOOST_CHECK( memoryFootprint < 1024 * 1024 );
+    largeLegendreCache.setComputeSecondDerivatives( true );
+    BOOST_CHECK_EQUAL( largeLegendreCache.getMemoryFootprint( ) - memoryFootprint, 201 * 202 / 2 * sizeof( double ) );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
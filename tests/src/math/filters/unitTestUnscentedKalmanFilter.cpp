@@ -392,6 +392,101 @@ BOOST_AUTO_TEST_CASE( testUnscentedKalmanFilterThirdCase )
     }
 }
 
+// Test that distributing the sigma points over multiple threads does not change the filter output.
+BOOST_AUTO_TEST_CASE( testUnscentedKalmanFilterParallelSigmaPoints )
+{
+    using namespace tudat::filters;
+
+    // Set initial conditions and uncertainties (as in third case)
+    const double initialTime = 0.0;
+    const double timeStep = 0.1;
+    const unsigned int numberOfTimeSteps = 100;
+
+    Eigen::Vector3d initialStateVector;
+    initialStateVector << 200000.0, -6000.0, 500.0;
+    Eigen::Vector3d initialEstimatedStateVector;
+    initialEstimatedStateVector << 200025.0, -6150.0, 800.0;
+    Eigen::Matrix3d initialEstimatedStateCovarianceMatrix = Eigen::Matrix3d::Zero( );
+    initialEstimatedStateCovarianceMatrix.diagonal( ) << std::pow( 1000.0, 2 ), 20000.0, std::pow( 300.0, 2 );
+
+    Eigen::Matrix3d systemUncertainty = Eigen::Matrix3d::Zero( );
+    systemUncertainty.diagonal( ) << std::pow( 100.0, 2 ), std::pow( 10.0, 2 ), std::pow( 1.0, 2 );
+    Eigen::Vector1d measurementUncertainty;
+    measurementUncertainty[ 0 ] = std::pow( 25.0, 2 );
+
+    // Test with integrated system function, and with system function providing the state at the next time step
+    for ( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        std::shared_ptr< numerical_integrators::IntegratorSettings< > > integratorSettings = nullptr;
+        std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > systemFunction;
+        if ( testCase == 0 )
+        {
+            integratorSettings = std::make_shared< numerical_integrators::IntegratorSettings< > >(
+                        numerical_integrators::rungeKutta4, initialTime, timeStep );
+            systemFunction = [ ]( const double time, const Eigen::VectorXd& state )
+            {
+                return Eigen::VectorXd( stateFunction3( time, state, Eigen::Vector3d::Zero( ) ) );
+            };
+        }
+        else
+        {
+            systemFunction = [ = ]( const double time, const Eigen::VectorXd& state )
+            {
+                return Eigen::VectorXd( state + stateFunction3( time, state, Eigen::Vector3d::Zero( ) ) * timeStep );
+            };
+        }
+        std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > measurementFunction =
+                [ ]( const double time, const Eigen::VectorXd& state )
+        {
+            return Eigen::VectorXd( measurementFunction3( time, state ) );
+        };
+
+        // Create filters with serial and parallel evaluation of sigma points
+        std::vector< UnscentedKalmanFilterDoublePointer > unscentedFilters;
+        for ( int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads += 3 )
+        {
+            unscentedFilters.push_back( std::make_shared< UnscentedKalmanFilterDouble >(
+                                            systemFunction, measurementFunction,
+                                            systemUncertainty, measurementUncertainty, timeStep,
+                                            initialTime, initialEstimatedStateVector, initialEstimatedStateCovarianceMatrix,
+                                            integratorSettings ) );
+            unscentedFilters.back( )->setNumberOfThreads( numberOfThreads );
+        }
+
+        // Update filters with identical measurements
+        Eigen::Vector3d currentActualStateVector = initialStateVector;
+        Eigen::Vector1d currentMeasurementVector;
+        for ( unsigned int i = 0; i < numberOfTimeSteps; i++ )
+        {
+            currentActualStateVector += stateFunction3( 0.0, currentActualStateVector, Eigen::Vector3d::Zero( ) ) * timeStep;
+            currentMeasurementVector[ 0 ] = currentActualStateVector[ 0 ] + 25.0 * std::sin( static_cast< double >( i ) );
+            for ( unsigned int j = 0; j < unscentedFilters.size( ); j++ )
+            {
+                unscentedFilters.at( j )->updateFilter( currentMeasurementVector );
+            }
+        }
+
+        // Check that estimates, covariances and sigma points are identical
+        BOOST_CHECK( unscentedFilters.at( 0 )->getCurrentStateEstimate( ) ==
+                     unscentedFilters.at( 1 )->getCurrentStateEstimate( ) );
+        BOOST_CHECK( unscentedFilters.at( 0 )->getCurrentCovarianceEstimate( ) ==
+                     unscentedFilters.at( 1 )->getCurrentCovarianceEstimate( ) );
+        BOOST_CHECK( std::fabs( unscentedFilters.at( 0 )->getCurrentStateEstimate( )[ 0 ] -
+                     currentActualStateVector[ 0 ] ) < 100.0 );
+
+        std::map< double, Eigen::MatrixXd > serialSigmaPointHistory = unscentedFilters.at( 0 )->getHistoryOfSigmaPoints( );
+        std::map< double, Eigen::MatrixXd > parallelSigmaPointHistory = unscentedFilters.at( 1 )->getHistoryOfSigmaPoints( );
+        BOOST_CHECK_EQUAL( serialSigmaPointHistory.size( ), numberOfTimeSteps );
+        BOOST_CHECK_EQUAL( parallelSigmaPointHistory.size( ), numberOfTimeSteps );
+        for ( auto sigmaPointIterator : serialSigmaPointHistory )
+        {
+            BOOST_CHECK_EQUAL( sigmaPointIterator.second.rows( ), 7 );
+            BOOST_CHECK_EQUAL( sigmaPointIterator.second.cols( ), 15 );
+            BOOST_CHECK( sigmaPointIterator.second == parallelSigmaPointHistory.at( sigmaPointIterator.first ) );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -165,6 +165,54 @@ BOOST_AUTO_TEST_CASE( test_AdamsBashforthMoulton_Integrator_Compare78_VanDerPol
     BOOST_CHECK_SMALL( std::fabs( difference( 1 ) ), 5E-12 );
 }
 
+//! Test ordering, re-use and growth of the ring buffer used for the integration history
+BOOST_AUTO_TEST_CASE( test_AdamsBashforthMoulton_HistoryBuffer )
+{
+    IntegrationHistoryBuffer< Eigen::VectorXd > history( 3 );
+    IntegrationHistoryBuffer< Eigen::VectorXd > otherHistory( 3 );
+
+    // Add entries at the front, beyond initial capacity, and check ordering (most recent first)
+    for( int i = 0; i < 5; i++ )
+    {
+        history.pushFront( Eigen::VectorXd::Constant( 2, static_cast< double >( i ) ) );
+    }
+    BOOST_CHECK_EQUAL( history.size( ), 5 );
+    for( unsigned int i = 0; i < history.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( history.at( i )( 0 ), static_cast< double >( 4 - i ) );
+    }
+
+    // Remove oldest entries, and wrap around the buffer by adding/removing entries at both ends
+    history.truncate( 2 );
+    BOOST_CHECK_EQUAL( history.size( ), 2 );
+    BOOST_CHECK_EQUAL( history.back( )( 0 ), 3.0 );
+    for( int i = 0; i < 20; i++ )
+    {
+        history.pushFront( ) = Eigen::VectorXd::Constant( 2, 10.0 + i );
+        history.pushBack( Eigen::VectorXd::Constant( 2, -1.0 - i ) );
+        history.popFront( );
+        history.truncate( 2 );
+    }
+    BOOST_CHECK_EQUAL( history.size( ), 2 );
+    BOOST_CHECK_EQUAL( history.front( )( 0 ), 4.0 );
+    BOOST_CHECK_EQUAL( history.back( )( 0 ), 3.0 );
+
+    // Modify entry in place
+    history.at( 1 )( 1 ) = 7.0;
+    BOOST_CHECK_EQUAL( history.back( )( 1 ), 7.0 );
+
+    // Swap with other buffer, and clear
+    otherHistory.pushFront( Eigen::VectorXd::Constant( 2, 42.0 ) );
+    history.swap( otherHistory );
+    BOOST_CHECK_EQUAL( history.size( ), 1 );
+    BOOST_CHECK_EQUAL( history.front( )( 0 ), 42.0 );
+    BOOST_CHECK_EQUAL( otherHistory.size( ), 2 );
+    BOOST_CHECK_EQUAL( otherHistory.back( )( 1 ), 7.0 );
+    otherHistory.clear( );
+    BOOST_CHECK_EQUAL( otherHistory.size( ), 0 );
+    BOOST_CHECK_THROW( otherHistory.at( 0 ), std::out_of_range );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -168,6 +168,74 @@ BOOST_AUTO_TEST_CASE( test_BulirschStoer_Integrator_Compare78_VanDerPol )
     BOOST_CHECK_SMALL( std::fabs( difference( 1 ) ), 5E-12 );
 }
 
+//! Test parallel computation of mid-point sequences and adaptive order selection against default settings
+BOOST_AUTO_TEST_CASE( test_BulirschStoer_Integrator_ParallelAndAdaptiveOrder )
+{
+    // Integrator settings
+    double minimumStepSize = std::numeric_limits< double >::epsilon( );
+    double maximumStepSize = std::numeric_limits< double >::infinity( );
+    double initialStepSize = 0.1;
+    double relativeTolerance = 1E-12;
+    double absoluteTolerance = 1E-12;
+
+    // Initial conditions
+    double initialTime = 0.2;
+    Eigen::VectorXd initialState( 2 );
+    initialState << -1.0, 1.0;
+    double endTime = 5.0;
+
+    // State derivative function that counts number of calls
+    int numberOfEvaluations = 0;
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            [ & ]( const double time, const Eigen::VectorXd& state )
+    {
+        numberOfEvaluations++;
+        return computeVanDerPolStateDerivative( time, state );
+    };
+
+    for( unsigned int lengthOfSequence = 4; lengthOfSequence <= 12; lengthOfSequence += 4 )
+    {
+        std::vector< unsigned int > sequence = getBulirschStoerStepSequence( deufelhard_sequence, lengthOfSequence );
+
+        // Integrate with default settings
+        BulirschStoerVariableStepSizeIntegratorXd serialIntegrator(
+                    sequence, stateDerivativeFunction, initialTime, initialState,
+                    minimumStepSize, maximumStepSize, initialStepSize, relativeTolerance, absoluteTolerance );
+        numberOfEvaluations = 0;
+        Eigen::VectorXd serialSolution = serialIntegrator.integrateTo( endTime, initialStepSize );
+        int numberOfSerialEvaluations = numberOfEvaluations;
+
+        // Integrate with sequences distributed over threads, and check that results are identical
+        BulirschStoerVariableStepSizeIntegratorXd parallelIntegrator(
+                    sequence, computeVanDerPolStateDerivative, initialTime, initialState,
+                    minimumStepSize, maximumStepSize, initialStepSize, relativeTolerance, absoluteTolerance );
+        parallelIntegrator.setNumberOfThreads( 3 );
+        Eigen::VectorXd parallelSolution = parallelIntegrator.integrateTo( endTime, initialStepSize );
+        for( int i = 0; i < 2; i++ )
+        {
+            BOOST_CHECK_EQUAL( serialSolution( i ), parallelSolution( i ) );
+        }
+
+        // Integrate with adaptive order, and check that results are close
+        BulirschStoerVariableStepSizeIntegratorXd adaptiveOrderIntegrator(
+                    sequence, stateDerivativeFunction, initialTime, initialState,
+                    minimumStepSize, maximumStepSize, initialStepSize, relativeTolerance, absoluteTolerance );
+        adaptiveOrderIntegrator.setUseAdaptiveOrder( true );
+        numberOfEvaluations = 0;
+        Eigen::VectorXd adaptiveOrderSolution = adaptiveOrderIntegrator.integrateTo( endTime, initialStepSize );
+        for( int i = 0; i < 2; i++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( serialSolution( i ) - adaptiveOrderSolution( i ) ), 1E-9 );
+        }
+
+        // For long sequences, fewer rows of the tableau are needed for most steps
+        if( lengthOfSequence == 12 )
+        {
+            BOOST_CHECK( numberOfEvaluations < numberOfSerialEvaluations );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,193 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/math/integrators/ensembleRungeKuttaVariableStepSizeIntegrator.h"
+#include "tudat/math/integrators/rungeKuttaVariableStepSizeIntegrator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace numerical_integrators;
+
+typedef EnsembleRungeKuttaVariableStepSizeIntegrator< double, double > EnsembleIntegrator;
+
+//! Keplerian state derivative for a single member
+Eigen::VectorXd computeKeplerStateDerivative( const double, const Eigen::VectorXd& state )
+{
+    const double gravitationalParameter = 3.986004418E14;
+    Eigen::VectorXd stateDerivative = Eigen::VectorXd::Zero( 6 );
+    stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+    stateDerivative.segment( 3, 3 ) = -gravitationalParameter * state.segment( 0, 3 ) /
+            std::pow( state.segment( 0, 3 ).norm( ), 3.0 );
+    return stateDerivative;
+}
+
+//! Keplerian state derivative for an ensemble (one row per member), evaluated per member
+Eigen::MatrixXd computeEnsembleKeplerStateDerivativePerMember( const Eigen::VectorXd& times, const Eigen::MatrixXd& states )
+{
+    Eigen::MatrixXd stateDerivatives( states.rows( ), 6 );
+    for( int i = 0; i < states.rows( ); i++ )
+    {
+        stateDerivatives.row( i ) = computeKeplerStateDerivative( times( i ), states.row( i ).transpose( ) ).transpose( );
+    }
+    return stateDerivatives;
+}
+
+//! Keplerian state derivative for an ensemble (one row per member), vectorized over the members
+Eigen::MatrixXd computeEnsembleKeplerStateDerivative( const Eigen::VectorXd&, const Eigen::MatrixXd& states )
+{
+    const double gravitationalParameter = 3.986004418E14;
+    Eigen::MatrixXd stateDerivatives( states.rows( ), 6 );
+    stateDerivatives.leftCols( 3 ) = states.rightCols( 3 );
+    const Eigen::ArrayXd radii = states.leftCols( 3 ).rowwise( ).norm( ).array( );
+    const Eigen::ArrayXd scaling = -gravitationalParameter / ( radii * radii * radii );
+    stateDerivatives.rightCols( 3 ) = ( states.leftCols( 3 ).array( ).colwise( ) * scaling ).matrix( );
+    return stateDerivatives;
+}
+
+//! Initial states of ensemble with different eccentricities (and therefore different step size histories)
+Eigen::MatrixXd getEnsembleInitialStates( const int numberOfMembers )
+{
+    Eigen::MatrixXd initialStates = Eigen::MatrixXd::Zero( numberOfMembers, 6 );
+    for( int i = 0; i < numberOfMembers; i++ )
+    {
+        initialStates( i, 0 ) = 7000.0E3;
+        initialStates( i, 4 ) = 7.5E3 + 2.0E3 * static_cast< double >( i ) / static_cast< double >( numberOfMembers );
+        initialStates( i, 5 ) = 1.0E3;
+    }
+    return initialStates;
+}
+
+BOOST_AUTO_TEST_SUITE( test_ensemble_runge_kutta_variable_step_size_integrator )
+
+//! Test if members of ensemble are integrated identically to single-member integration, and with vectorized dynamics
+BOOST_AUTO_TEST_CASE( testEnsembleIntegrationAgainstSingleIntegration )
+{
+    const int numberOfMembers = 8;
+    const double finalTime = 86400.0;
+    Eigen::MatrixXd initialStates = getEnsembleInitialStates( numberOfMembers );
+
+    std::vector< CoefficientSets > coefficientSets = { rungeKuttaFehlberg45, rungeKuttaFehlberg78 };
+    for( unsigned int i = 0; i < coefficientSets.size( ); i++ )
+    {
+        EnsembleIntegrator ensembleIntegrator(
+                    RungeKuttaCoefficients::get( coefficientSets.at( i ) ), &computeEnsembleKeplerStateDerivativePerMember,
+                    0.0, initialStates, 10.0, 1.0E-4, 1.0E4, 1.0E-10, 1.0E-10 );
+        Eigen::MatrixXd finalStates = ensembleIntegrator.integrateTo( finalTime );
+
+        // Integrate with dynamics vectorized over the members
+        EnsembleIntegrator vectorizedEnsembleIntegrator(
+                    RungeKuttaCoefficients::get( coefficientSets.at( i ) ), &computeEnsembleKeplerStateDerivative,
+                    0.0, initialStates, 10.0, 1.0E-4, 1.0E4, 1.0E-10, 1.0E-10 );
+        Eigen::MatrixXd vectorizedFinalStates = vectorizedEnsembleIntegrator.integrateTo( finalTime );
+
+        BOOST_CHECK_EQUAL( ensembleIntegrator.getNumberOfMembers( ), numberOfMembers );
+        for( int j = 0; j < numberOfMembers; j++ )
+        {
+            // Integrate member separately
+            RungeKuttaVariableStepSizeIntegratorXd singleIntegrator(
+                        RungeKuttaCoefficients::get( coefficientSets.at( i ) ), &computeKeplerStateDerivative,
+                        0.0, initialStates.row( j ).transpose( ), 1.0E-4, 1.0E4, 10.0, 1.0E-10, 1.0E-10 );
+            Eigen::VectorXd singleFinalState = singleIntegrator.integrateTo( finalTime, 10.0 );
+
+            // Results should be identical, since the same operations are performed in the same order
+            BOOST_CHECK_EQUAL( ensembleIntegrator.getCurrentIndependentVariables( )( j ), finalTime );
+            BOOST_CHECK_EQUAL( ensembleIntegrator.getNumberOfRejectedSteps( )( j ),
+                               singleIntegrator.getNumberOfRejectedSteps( ) );
+            for( int k = 0; k < 6; k++ )
+            {
+                BOOST_CHECK_CLOSE_FRACTION( finalStates( j, k ), singleFinalState( k ), 1.0E-14 );
+            }
+
+            // Results with vectorized dynamics differ at the level of the integration error
+            for( int k = 0; k < 3; k++ )
+            {
+                BOOST_CHECK_SMALL( vectorizedFinalStates( j, k ) - singleFinalState( k ), 1.0E-2 );
+                BOOST_CHECK_SMALL( vectorizedFinalStates( j, k + 3 ) - singleFinalState( k + 3 ), 1.0E-5 );
+            }
+        }
+
+        // Check that members have taken different numbers of steps, and that lock-steps are shared
+        Eigen::VectorXi numberOfActiveLockSteps = ensembleIntegrator.getNumberOfActiveLockSteps( );
+        BOOST_CHECK( numberOfActiveLockSteps.minCoeff( ) < numberOfActiveLockSteps.maxCoeff( ) );
+        BOOST_CHECK_EQUAL( ensembleIntegrator.getNumberOfLockSteps( ), numberOfActiveLockSteps.maxCoeff( ) );
+    }
+}
+
+//! Test masking of members that reject a step
+BOOST_AUTO_TEST_CASE( testEnsembleStepRejection )
+{
+    const int numberOfMembers = 4;
+    Eigen::MatrixXd initialStates = getEnsembleInitialStates( numberOfMembers );
+
+    // Scale the dynamics of the last two members, so that only the first two members meet the tolerances for the initial step
+    EnsembleIntegrator::EnsembleStateDerivativeFunction stateDerivativeFunction =
+            [ ]( const Eigen::VectorXd& times, const Eigen::MatrixXd& states )
+    {
+        Eigen::MatrixXd stateDerivatives = computeEnsembleKeplerStateDerivative( times, states );
+        stateDerivatives.bottomRows( 2 ) *= 100.0;
+        return stateDerivatives;
+    };
+
+    EnsembleIntegrator ensembleIntegrator(
+                RungeKuttaCoefficients::get( rungeKuttaFehlberg78 ), stateDerivativeFunction,
+                0.0, initialStates, 10.0, 1.0E-4, 1.0E4, 1.0E-12, 1.0E-12 );
+
+    int numberOfAcceptedMembers = ensembleIntegrator.performIntegrationStep( );
+    BOOST_CHECK_EQUAL( numberOfAcceptedMembers, 2 );
+
+    Eigen::VectorXd currentTimes = ensembleIntegrator.getCurrentIndependentVariables( );
+    Eigen::VectorXi numberOfRejectedSteps = ensembleIntegrator.getNumberOfRejectedSteps( );
+    Eigen::MatrixXd currentStates = ensembleIntegrator.getCurrentStates( );
+    for( int i = 0; i < numberOfMembers; i++ )
+    {
+        if( i < 2 )
+        {
+            BOOST_CHECK_EQUAL( currentTimes( i ), 10.0 );
+            BOOST_CHECK_EQUAL( numberOfRejectedSteps( i ), 0 );
+        }
+        else
+        {
+            // Rejected members keep their state, and retry with reduced step size
+            BOOST_CHECK_EQUAL( currentTimes( i ), 0.0 );
+            BOOST_CHECK_EQUAL( numberOfRejectedSteps( i ), 1 );
+            BOOST_CHECK( ensembleIntegrator.getNextStepSizes( )( i ) < 10.0 );
+            for( int j = 0; j < 6; j++ )
+            {
+                BOOST_CHECK_EQUAL( currentStates( i, j ), initialStates( i, j ) );
+            }
+        }
+    }
+
+    // Check that all members reach the final time
+    ensembleIntegrator.integrateTo( 1000.0 );
+    for( int i = 0; i < numberOfMembers; i++ )
+    {
+        BOOST_CHECK_EQUAL( ensembleIntegrator.getCurrentIndependentVariables( )( i ), 1000.0 );
+    }
+    BOOST_CHECK( ensembleIntegrator.getNumberOfAcceptedSteps( )( 3 ) > ensembleIntegrator.getNumberOfAcceptedSteps( )( 0 ) );
+
+    // Check that fixed step coefficients are rejected
+    BOOST_CHECK_THROW( EnsembleIntegrator(
+                           RungeKuttaCoefficients::get( rungeKutta4Classic ), stateDerivativeFunction,
+                           0.0, initialStates, 200.0, 1.0E-4, 1.0E4, 1.0E-12, 1.0E-12 ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
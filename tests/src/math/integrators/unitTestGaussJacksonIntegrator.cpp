@@ -0,0 +1,303 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Berry, M.M. and Healy, L.M., Implementation of Gauss-Jackson integration for orbit propagation,
+ *          The Journal of the Astronautical Sciences, 52(3), 331-357, 2004.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+
+#include <Eigen/Core>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/testMacros.h"
+#include "tudat/math/integrators/gaussJacksonIntegrator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_gauss_jackson_integrator )
+
+using namespace numerical_integrators;
+
+//! Number of state derivative evaluations in the current test
+static int numberOfFunctionEvaluations = 0;
+
+//! State derivative with acceleration that is a polynomial in time (of degree 5 in x, 3 in y and 0 in z).
+Eigen::VectorXd computePolynomialAccelerationStateDerivative( const double time, const Eigen::VectorXd& state )
+{
+    numberOfFunctionEvaluations++;
+    Eigen::VectorXd stateDerivative = Eigen::VectorXd::Zero( 6 );
+    stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+    stateDerivative( 3 ) = 2.0 * std::pow( time, 5 ) - time;
+    stateDerivative( 4 ) = 3.0 * std::pow( time, 3 ) + 1.0;
+    stateDerivative( 5 ) = -0.5;
+    return stateDerivative;
+}
+
+//! State derivative of Keplerian motion (gravitational parameter equal to one).
+Eigen::VectorXd computeKeplerStateDerivative( const double, const Eigen::VectorXd& state )
+{
+    numberOfFunctionEvaluations++;
+    Eigen::VectorXd stateDerivative = Eigen::VectorXd::Zero( 6 );
+    stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+    stateDerivative.segment( 3, 3 ) = -state.segment( 0, 3 ) / std::pow( state.segment( 0, 3 ).norm( ), 3 );
+    return stateDerivative;
+}
+
+//! State derivative of isotropic harmonic oscillator, including state transition matrix in columns 1-6.
+Eigen::MatrixXd computeHarmonicOscillatorStateDerivative( const double, const Eigen::MatrixXd& state )
+{
+    Eigen::MatrixXd stateDerivative = Eigen::MatrixXd::Zero( 6, 7 );
+    stateDerivative.block( 0, 0, 3, 7 ) = state.block( 3, 0, 3, 7 );
+    stateDerivative.block( 3, 0, 3, 7 ) = -state.block( 0, 0, 3, 7 );
+    return stateDerivative;
+}
+
+//! Function to retrieve the initial state of a circular orbit with unit radius.
+Eigen::VectorXd getCircularOrbitState( const double time )
+{
+    Eigen::VectorXd state = Eigen::VectorXd::Zero( 6 );
+    state << std::cos( time ), std::sin( time ), 0.0, -std::sin( time ), std::cos( time ), 0.0;
+    return state;
+}
+
+//! Test whether integration of polynomial acceleration is exact
+BOOST_AUTO_TEST_CASE( test_GaussJackson_PolynomialAcceleration )
+{
+    Eigen::VectorXd initialState = Eigen::VectorXd::Zero( 6 );
+    initialState << 1.0, -2.0, 0.5, 0.1, 0.2, -0.3;
+
+    // Analytical solution
+    double finalTime = 5.0;
+    Eigen::VectorXd analyticalState = initialState;
+    analyticalState( 0 ) += initialState( 3 ) * finalTime + 2.0 * std::pow( finalTime, 7 ) / 42.0 -
+            std::pow( finalTime, 3 ) / 6.0;
+    analyticalState( 1 ) += initialState( 4 ) * finalTime + 3.0 * std::pow( finalTime, 5 ) / 20.0 +
+            std::pow( finalTime, 2 ) / 2.0;
+    analyticalState( 2 ) += initialState( 5 ) * finalTime - 0.25 * std::pow( finalTime, 2 );
+    analyticalState( 3 ) += 2.0 * std::pow( finalTime, 6 ) / 6.0 - std::pow( finalTime, 2 ) / 2.0;
+    analyticalState( 4 ) += 3.0 * std::pow( finalTime, 4 ) / 4.0 + finalTime;
+    analyticalState( 5 ) += -0.5 * finalTime;
+
+    for( unsigned int evaluateCorrected = 0; evaluateCorrected < 2; evaluateCorrected++ )
+    {
+        GaussJacksonIntegratorXd integrator(
+                    &computePolynomialAccelerationStateDerivative, 0.0, initialState, 0.05, 8, 1,
+                    static_cast< bool >( evaluateCorrected ) );
+        for( int i = 0; i < 100; i++ )
+        {
+            integrator.performIntegrationStep( 0.05 );
+        }
+
+        BOOST_CHECK_CLOSE_FRACTION( integrator.getCurrentIndependentVariable( ), finalTime, 1.0E-14 );
+        for( int i = 0; i < 6; i++ )
+        {
+            BOOST_CHECK_SMALL( integrator.getCurrentState( )( i ) - analyticalState( i ),
+                               1.0E-13 * analyticalState.cwiseAbs( ).maxCoeff( ) );
+        }
+    }
+}
+
+//! Test Gauss-Jackson integrator on a circular orbit, and check number of function evaluations
+BOOST_AUTO_TEST_CASE( test_GaussJackson_CircularOrbit )
+{
+    const double stepSize = 2.0 * mathematical_constants::PI / 100.0;
+    const int numberOfSteps = 1000;
+    for( unsigned int evaluateCorrected = 0; evaluateCorrected < 2; evaluateCorrected++ )
+    {
+        numberOfFunctionEvaluations = 0;
+        GaussJacksonIntegratorXd integrator(
+                    &computeKeplerStateDerivative, 0.0, getCircularOrbitState( 0.0 ), stepSize, 8, 1,
+                    static_cast< bool >( evaluateCorrected ) );
+        for( int i = 0; i < numberOfSteps; i++ )
+        {
+            integrator.performIntegrationStep( stepSize );
+        }
+        int numberOfStartupEvaluations = numberOfFunctionEvaluations;
+
+        Eigen::VectorXd analyticalState = getCircularOrbitState( integrator.getCurrentIndependentVariable( ) );
+        for( int i = 0; i < 6; i++ )
+        {
+            BOOST_CHECK_SMALL( integrator.getCurrentState( )( i ) - analyticalState( i ), 1.0E-9 );
+        }
+
+        // Check that (after startup) one or two state derivative evaluations per step are used
+        numberOfFunctionEvaluations = 0;
+        for( int i = 0; i < numberOfSteps; i++ )
+        {
+            integrator.performIntegrationStep( stepSize );
+        }
+        BOOST_CHECK_EQUAL( numberOfFunctionEvaluations, numberOfSteps * ( 1 + static_cast< int >( evaluateCorrected ) ) );
+        BOOST_CHECK( numberOfStartupEvaluations < numberOfSteps * ( 1 + static_cast< int >( evaluateCorrected ) ) + 500 );
+    }
+}
+
+//! Test convergence order of Gauss-Jackson integrator
+BOOST_AUTO_TEST_CASE( test_GaussJackson_ConvergenceOrder )
+{
+    for( int order = 4; order <= 8; order += 2 )
+    {
+        std::vector< double > errors;
+        for( int numberOfStepsPerOrbit = 40; numberOfStepsPerOrbit <= 80; numberOfStepsPerOrbit *= 2 )
+        {
+            const double stepSize = 2.0 * mathematical_constants::PI / static_cast< double >( numberOfStepsPerOrbit );
+            GaussJacksonIntegratorXd integrator(
+                        &computeKeplerStateDerivative, 0.0, getCircularOrbitState( 0.0 ), stepSize, order );
+            for( int i = 0; i < 4 * numberOfStepsPerOrbit; i++ )
+            {
+                integrator.performIntegrationStep( stepSize );
+            }
+            errors.push_back( ( integrator.getCurrentState( ) - getCircularOrbitState(
+                                    integrator.getCurrentIndependentVariable( ) ) ).norm( ) );
+        }
+
+        // Check that error decreases (at least) with order of integrator
+        BOOST_CHECK_GT( errors.at( 0 ) / errors.at( 1 ), std::pow( 2.0, order - 0.5 ) );
+    }
+}
+
+//! Test integration of state including state transition matrix
+BOOST_AUTO_TEST_CASE( test_GaussJackson_StateTransitionMatrix )
+{
+    Eigen::MatrixXd initialState = Eigen::MatrixXd::Zero( 6, 7 );
+    initialState.col( 0 ) << 1.0, -0.5, 0.2, 0.3, 0.7, -0.1;
+    initialState.block( 0, 1, 6, 6 ).setIdentity( );
+
+    const double stepSize = 0.05;
+    GaussJacksonIntegrator< double, Eigen::MatrixXd, Eigen::MatrixXd > integrator(
+                &computeHarmonicOscillatorStateDerivative, 0.0, initialState, stepSize );
+    for( int i = 0; i < 200; i++ )
+    {
+        integrator.performIntegrationStep( stepSize );
+    }
+
+    // Compute analytical solution
+    const double time = integrator.getCurrentIndependentVariable( );
+    Eigen::MatrixXd analyticalStateTransitionMatrix = Eigen::MatrixXd::Zero( 6, 6 );
+    analyticalStateTransitionMatrix.block( 0, 0, 3, 3 ) = std::cos( time ) * Eigen::Matrix3d::Identity( );
+    analyticalStateTransitionMatrix.block( 0, 3, 3, 3 ) = std::sin( time ) * Eigen::Matrix3d::Identity( );
+    analyticalStateTransitionMatrix.block( 3, 0, 3, 3 ) = -std::sin( time ) * Eigen::Matrix3d::Identity( );
+    analyticalStateTransitionMatrix.block( 3, 3, 3, 3 ) = std::cos( time ) * Eigen::Matrix3d::Identity( );
+    Eigen::VectorXd analyticalState = analyticalStateTransitionMatrix * initialState.col( 0 );
+
+    Eigen::MatrixXd currentState = integrator.getCurrentState( );
+    for( int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_SMALL( currentState( i, 0 ) - analyticalState( i ), 1.0E-12 );
+        for( int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_SMALL( currentState( i, j + 1 ) - analyticalStateTransitionMatrix( i, j ), 1.0E-12 );
+        }
+    }
+}
+
+//! Test steps not equal to nominal step size, rollback and state modification
+BOOST_AUTO_TEST_CASE( test_GaussJackson_PartialStepsAndRollback )
+{
+    const double stepSize = 2.0 * mathematical_constants::PI / 100.0;
+    GaussJacksonIntegratorXd integrator(
+                &computeKeplerStateDerivative, 0.0, getCircularOrbitState( 0.0 ), stepSize );
+
+    // Integrate to epoch that is not a multiple of the step size (including final partial step)
+    double finalTime = 3.7;
+    Eigen::VectorXd finalState = integrator.integrateTo( finalTime, stepSize );
+    BOOST_CHECK_CLOSE_FRACTION( integrator.getCurrentIndependentVariable( ), finalTime, 1.0E-15 );
+    Eigen::VectorXd analyticalState = getCircularOrbitState( finalTime );
+    for( int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_SMALL( finalState( i ) - analyticalState( i ), 1.0E-11 );
+    }
+
+    // Partial step within startup procedure
+    integrator.performIntegrationStep( 0.3 * stepSize );
+    analyticalState = getCircularOrbitState( finalTime + 0.3 * stepSize );
+    for( int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_SMALL( integrator.getCurrentState( )( i ) - analyticalState( i ), 1.0E-11 );
+    }
+
+    // Take nominal steps, and check rollback of partial step, and nominal step
+    for( int i = 0; i < 20; i++ )
+    {
+        integrator.performIntegrationStep( stepSize );
+    }
+    Eigen::VectorXd stateBeforeStep = integrator.getCurrentState( );
+    double timeBeforeStep = integrator.getCurrentIndependentVariable( );
+    Eigen::VectorXd stateAfterStep = integrator.performIntegrationStep( stepSize );
+
+    BOOST_CHECK( integrator.rollbackToPreviousState( ) );
+    BOOST_CHECK( !integrator.rollbackToPreviousState( ) );
+    BOOST_CHECK_EQUAL( integrator.getCurrentIndependentVariable( ), timeBeforeStep );
+    Eigen::VectorXd stateAfterRollback = integrator.getCurrentState( );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( stateAfterRollback, stateBeforeStep, 0.0 );
+
+    integrator.performIntegrationStep( 0.6 * stepSize );
+    BOOST_CHECK( integrator.rollbackToPreviousState( ) );
+    Eigen::VectorXd stateAfterRepeatedStep = integrator.performIntegrationStep( stepSize );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( stateAfterRepeatedStep, stateAfterStep, 0.0 );
+
+    // Modify state to analytical state (history is discarded and startup is repeated)
+    integrator.modifyCurrentState( getCircularOrbitState( integrator.getCurrentIndependentVariable( ) ) );
+    double modificationTime = integrator.getCurrentIndependentVariable( );
+    for( int i = 0; i < 50; i++ )
+    {
+        integrator.performIntegrationStep( stepSize );
+    }
+    analyticalState = getCircularOrbitState( integrator.getCurrentIndependentVariable( ) );
+    BOOST_CHECK_CLOSE_FRACTION( integrator.getCurrentIndependentVariable( ), modificationTime + 50.0 * stepSize, 1.0E-14 );
+    for( int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_SMALL( integrator.getCurrentState( )( i ) - analyticalState( i ), 1.0E-11 );
+    }
+}
+
+//! Test that unsupported states are rejected
+BOOST_AUTO_TEST_CASE( test_GaussJackson_UnsupportedState )
+{
+    bool exceptionIsThrown = false;
+    try
+    {
+        GaussJacksonIntegratorXd integrator(
+                    &computeKeplerStateDerivative, 0.0, Eigen::VectorXd::Zero( 4 ), 1.0 );
+    }
+    catch( std::runtime_error& )
+    {
+        exceptionIsThrown = true;
+    }
+    BOOST_CHECK( exceptionIsThrown );
+
+    // State derivative of which the position rows are not equal to the velocity rows
+    exceptionIsThrown = false;
+    GaussJacksonIntegratorXd integrator(
+                [ ]( const double, const Eigen::VectorXd& state ){ return Eigen::VectorXd( 2.0 * state ); },
+                0.0, getCircularOrbitState( 0.0 ), 1.0 );
+    try
+    {
+        integrator.performIntegrationStep( 1.0 );
+    }
+    catch( std::runtime_error& )
+    {
+        exceptionIsThrown = true;
+    }
+    BOOST_CHECK( exceptionIsThrown );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -315,6 +315,15 @@ BOOST_AUTO_TEST_CASE( testCowellPropagatorKeplerCompare )
 //                    "Earth" )->getGravitationalParameter( ))
 //                                               - stateHistory.rbegin( )->second );
 
+                // Check step statistics in propagation results
+                PropagationStepStatistics stepStatistics =
+                    dynamicsSimulator.getSingleArcPropagationResults( )->getStepStatistics( );
+                BOOST_CHECK_EQUAL( stepStatistics.numberOfAcceptedSteps_, static_cast< int >( stateHistory.size( ) ) - 1 );
+                BOOST_CHECK( stepStatistics.numberOfRejectedSteps_ >= 0 );
+                BOOST_CHECK( static_cast< int >( stepStatistics.numberOfFunctionEvaluations_ ) >= 6 * stepStatistics.numberOfAcceptedSteps_ );
+                BOOST_CHECK_CLOSE_FRACTION( stepStatistics.minimumStepSize_, minimumStep, 1.0E-12 );
+                BOOST_CHECK_CLOSE_FRACTION( stepStatistics.maximumStepSize_, maximumStep, 1.0E-12 );
+
                 double timeStepRatio = maximumStep / minimumStep;
 
                 std::cout<<dynamicsType<<" "<<tolerancesType<<" "<<timeStepRatio<<std::endl;
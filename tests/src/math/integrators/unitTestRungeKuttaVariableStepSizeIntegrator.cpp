@@ -29,6 +29,7 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include "tudat/math/integrators/createNumericalIntegrator.h"
 #include "tudat/math/integrators/rungeKuttaVariableStepSizeIntegrator.h"
 #include "tudat/math/integrators/rungeKutta4Integrator.h"
 #include "tudat/math/integrators/rungeKuttaCoefficients.h"
@@ -315,6 +316,342 @@ BOOST_AUTO_TEST_CASE( testVariableStepIntegrateToFunction )
     BOOST_CHECK_CLOSE_FRACTION( fixedStepIntegratedValue.x( ), integratedValue.x( ), 1.0E-10 );
 }
 
+//! Test dense output of variable step size integrator, for harmonic oscillator.
+BOOST_AUTO_TEST_CASE( testVariableStepDenseOutput )
+{
+    using namespace numerical_integrators;
+
+    // Define harmonic oscillator (with unit angular frequency), and count number of state derivative evaluations
+    int numberOfFunctionEvaluations = 0;
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            [ & ]( const double, const Eigen::VectorXd& state )
+    {
+        numberOfFunctionEvaluations++;
+        return ( Eigen::VectorXd( 2 ) << state( 1 ), -state( 0 ) ).finished( );
+    };
+    Eigen::VectorXd initialState = ( Eigen::VectorXd( 2 ) << 1.0, 0.0 ).finished( );
+
+    // Propagate with and without dense output
+    std::vector< Eigen::VectorXd > referenceStates;
+    int referenceNumberOfFunctionEvaluations = 0;
+    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        numberOfFunctionEvaluations = 0;
+        RungeKuttaVariableStepSizeIntegratorXd integrator(
+                    RungeKuttaCoefficients::get( CoefficientSets::rungeKuttaFehlberg78 ),
+                    stateDerivativeFunction, 0.0, initialState, 1.0E-4, 10.0, 0.1, 1.0E-12, 1.0E-12 );
+        integrator.setDenseOutput( testCase == 1 );
+        BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), false );
+
+        double maximumCubicError = 0.0;
+        double maximumQuinticError = 0.0;
+        for( int i = 0; i < 50; i++ )
+        {
+            Eigen::VectorXd currentState = integrator.performIntegrationStep( integrator.getNextStepSize( ) );
+            if( testCase == 0 )
+            {
+                referenceStates.push_back( currentState );
+            }
+            else
+            {
+                // Check that dense output does not modify integrated results
+                for( int j = 0; j < 2; j++ )
+                {
+                    BOOST_CHECK_EQUAL( currentState( j ), referenceStates.at( i )( j ) );
+                }
+
+                // Compare dense output inside step with analytical solution
+                BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), true );
+                double previousTime = integrator.getPreviousIndependentVariable( );
+                double currentTime = integrator.getCurrentIndependentVariable( );
+                if( i < 49 )
+                {
+                    for( int j = 0; j <= 10; j++ )
+                    {
+                        double interpolationTime = previousTime + ( currentTime - previousTime ) * static_cast< double >( j ) / 10.0;
+                        Eigen::VectorXd interpolatedState = integrator.getDenseOutputState( interpolationTime );
+                        double currentError = std::max( std::fabs( interpolatedState( 0 ) - std::cos( interpolationTime ) ),
+                                                        std::fabs( interpolatedState( 1 ) + std::sin( interpolationTime ) ) );
+                        if( i == 0 )
+                        {
+                            maximumCubicError = std::max( maximumCubicError, currentError );
+                        }
+                        else
+                        {
+                            maximumQuinticError = std::max( maximumQuinticError, currentError );
+                        }
+                    }
+
+                    // Check that boundaries of step are reproduced
+                    BOOST_CHECK_SMALL( ( integrator.getDenseOutputState( currentTime ) - currentState ).norm( ),
+                                       1.0E-14 );
+                    BOOST_CHECK_SMALL( ( integrator.getDenseOutputState( previousTime ) -
+                                         integrator.getPreviousState( ) ).norm( ), 1.0E-14 );
+                }
+            }
+        }
+
+        if( testCase == 0 )
+        {
+            referenceNumberOfFunctionEvaluations = numberOfFunctionEvaluations;
+        }
+        else
+        {
+            // Check that dense output requires no additional state derivative evaluations
+            BOOST_CHECK( numberOfFunctionEvaluations <= referenceNumberOfFunctionEvaluations );
+
+            // Check accuracy of cubic (first step) and quintic interpolant
+            BOOST_CHECK_SMALL( maximumCubicError, 1.0E-6 );
+            BOOST_CHECK_SMALL( maximumQuinticError, 1.0E-8 );
+
+            // Check that dense output is not available outside last step, and after rollback or state modification
+            BOOST_CHECK_THROW( integrator.getDenseOutputState( integrator.getCurrentIndependentVariable( ) + 1.0 ),
+                               std::runtime_error );
+            BOOST_CHECK_EQUAL( integrator.rollbackToPreviousState( ), true );
+            BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), true );
+            integrator.modifyCurrentState( initialState );
+            BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), false );
+            BOOST_CHECK_THROW( integrator.getDenseOutputState( integrator.getCurrentIndependentVariable( ) ),
+                               std::runtime_error );
+        }
+    }
+}
+
+//! Test if integration with fixed-size state gives results identical to integration with dynamic-size state
+BOOST_AUTO_TEST_CASE( testVariableStepFixedSizeState )
+{
+    using namespace numerical_integrators;
+
+    // Define Keplerian orbit state derivative, for fixed- and dynamic-size state
+    double gravitationalParameter = 3.986004418E14;
+    std::function< Eigen::Vector6d( const double, const Eigen::Vector6d& ) > fixedSizeStateDerivativeFunction =
+            [ = ]( const double, const Eigen::Vector6d& state )
+    {
+        Eigen::Vector6d stateDerivative;
+        stateDerivative.segment< 3 >( 0 ) = state.segment< 3 >( 3 );
+        stateDerivative.segment< 3 >( 3 ) = -gravitationalParameter * state.segment< 3 >( 0 ) /
+                std::pow( state.segment< 3 >( 0 ).norm( ), 3.0 );
+        return stateDerivative;
+    };
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > dynamicSizeStateDerivativeFunction =
+            [ = ]( const double time, const Eigen::VectorXd& state )
+    {
+        return Eigen::VectorXd( fixedSizeStateDerivativeFunction( time, state ) );
+    };
+
+    Eigen::Vector6d initialState;
+    initialState << 7000.0E3, 0.0, 0.0, 0.0, 7.0E3, 1.0E3;
+
+    RungeKuttaVariableStepSizeIntegrator< double, Eigen::Vector6d > fixedSizeIntegrator(
+                RungeKuttaCoefficients::get( CoefficientSets::rungeKuttaFehlberg78 ),
+                fixedSizeStateDerivativeFunction, 0.0, initialState, 1.0E-4, 1.0E4, 10.0, 1.0E-12, 1.0E-12 );
+    RungeKuttaVariableStepSizeIntegratorXd dynamicSizeIntegrator(
+                RungeKuttaCoefficients::get( CoefficientSets::rungeKuttaFehlberg78 ),
+                dynamicSizeStateDerivativeFunction, 0.0, initialState, 1.0E-4, 1.0E4, 10.0, 1.0E-12, 1.0E-12 );
+
+    for( int i = 0; i < 100; i++ )
+    {
+        Eigen::Vector6d fixedSizeState = fixedSizeIntegrator.performIntegrationStep(
+                    fixedSizeIntegrator.getNextStepSize( ) );
+        Eigen::VectorXd dynamicSizeState = dynamicSizeIntegrator.performIntegrationStep(
+                    dynamicSizeIntegrator.getNextStepSize( ) );
+
+        BOOST_CHECK_EQUAL( fixedSizeIntegrator.getCurrentIndependentVariable( ),
+                           dynamicSizeIntegrator.getCurrentIndependentVariable( ) );
+        for( int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_EQUAL( fixedSizeState( j ), dynamicSizeState( j ) );
+        }
+    }
+    BOOST_CHECK_EQUAL( fixedSizeIntegrator.getCurrentStateDerivatives( ).size( ), 13 );
+}
+
+//! Test step size ratios of PI step-size controller, including the post-rejection strategy
+BOOST_AUTO_TEST_CASE( testProportionalIntegralStepSizeControl )
+{
+    using namespace numerical_integrators;
+
+    // Create controller with unit absolute tolerance, so that error estimate is the difference between estimates
+    const double integratorOrder = 5.0;
+    PerElementIntegratorStepSizeController< double, Eigen::VectorXd > stepSizeController(
+                0.0, 1.0, 0.8, static_cast< int >( integratorOrder ), 0.1, 4.0 );
+    stepSizeController.setProportionalIntegralControl( 0.7, 0.4, true );
+    BOOST_CHECK( stepSizeController.getUseProportionalIntegralControl( ) );
+    stepSizeController.initialize( Eigen::VectorXd::Zero( 1 ) );
+
+    Eigen::VectorXd zeroEstimate = Eigen::VectorXd::Zero( 1 );
+    std::vector< double > errors = { 0.5, 0.2, 4.0, 2.0, 0.01, 0.3 };
+    std::vector< double > steps = { 10.0, 12.0, 14.0, 10.0, 8.0, 8.0 };
+    std::vector< double > expectedRatios(
+    {
+        // First step: no history
+        0.8 * std::pow( 0.5, -0.7 / integratorOrder ),
+        // Accepted step after accepted step: PI control
+        0.8 * std::pow( 0.2, -0.7 / integratorOrder ) * std::pow( 0.5, 0.4 / integratorOrder ),
+        // First rejection: elementary control
+        0.8 * std::pow( 4.0, -1.0 / integratorOrder ),
+        // Repeated rejection: order estimated from two last attempts
+        0.8 * std::pow( 2.0, -std::log( 14.0 / 10.0 ) / std::log( 4.0 / 2.0 ) ),
+        // Accepted step after rejection: no increase
+        1.0,
+        // Accepted step after accepted step: PI control
+        0.8 * std::pow( 0.3, -0.7 / integratorOrder ) * std::pow( 0.01, 0.4 / integratorOrder )
+    } );
+    std::vector< bool > expectedAcceptance = { true, true, false, false, true, true };
+
+    for( unsigned int i = 0; i < errors.size( ); i++ )
+    {
+        Eigen::VectorXd errorEstimate = Eigen::VectorXd::Constant( 1, errors.at( i ) );
+        std::pair< double, bool > newStepSize = stepSizeController.computeNewStepSize(
+                    errorEstimate, zeroEstimate, steps.at( i ) );
+        stepSizeController.updateStepHistory( newStepSize.second );
+
+        BOOST_CHECK_EQUAL( newStepSize.second, expectedAcceptance.at( i ) );
+        BOOST_CHECK_CLOSE_FRACTION( newStepSize.first, steps.at( i ) * expectedRatios.at( i ), 1.0E-14 );
+    }
+
+    // Test if elementary controller is unchanged
+    PerElementIntegratorStepSizeController< double, Eigen::VectorXd > elementaryStepSizeController(
+                0.0, 1.0, 0.8, static_cast< int >( integratorOrder ), 0.1, 4.0 );
+    elementaryStepSizeController.initialize( Eigen::VectorXd::Zero( 1 ) );
+    for( unsigned int i = 0; i < errors.size( ); i++ )
+    {
+        Eigen::VectorXd errorEstimate = Eigen::VectorXd::Constant( 1, errors.at( i ) );
+        std::pair< double, bool > newStepSize = elementaryStepSizeController.computeNewStepSize(
+                    errorEstimate, zeroEstimate, steps.at( i ) );
+        elementaryStepSizeController.updateStepHistory( newStepSize.second );
+        BOOST_CHECK_CLOSE_FRACTION(
+                    newStepSize.first, steps.at( i ) * std::min(
+                        0.8 * std::pow( errors.at( i ), -1.0 / integratorOrder ), 4.0 ), 1.0E-14 );
+    }
+}
+
+//! Test integration with PI step-size controller, and counting of rejected steps
+BOOST_AUTO_TEST_CASE( testProportionalIntegralControlIntegration )
+{
+    using namespace numerical_integrators;
+
+    // Define Keplerian orbit state derivative
+    double gravitationalParameter = 3.986004418E14;
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            [ = ]( const double, const Eigen::VectorXd& state )
+    {
+        Eigen::VectorXd stateDerivative = Eigen::VectorXd::Zero( 6 );
+        stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+        stateDerivative.segment( 3, 3 ) = -gravitationalParameter * state.segment( 0, 3 ) /
+                std::pow( state.segment( 0, 3 ).norm( ), 3.0 );
+        return stateDerivative;
+    };
+
+    Eigen::VectorXd initialState = Eigen::VectorXd::Zero( 6 );
+    initialState << 7000.0E3, 0.0, 0.0, 0.0, 9.0E3, 1.0E3;
+
+    // Compute reference final state with tight tolerances
+    std::shared_ptr< NumericalIntegrator< double, Eigen::VectorXd, Eigen::VectorXd > > referenceIntegrator =
+            createIntegrator< double, Eigen::VectorXd >(
+                stateDerivativeFunction, initialState, 0.0,
+                multiStageVariableStepSizeSettings< double >(
+                    10.0, CoefficientSets::rungeKuttaFehlberg78,
+                    perElementIntegratorStepSizeControlSettings< double >( 1.0E-14, 1.0E-14 ),
+                    stepSizeValidationSettings( 1.0E-4, 1.0E4 ) ) );
+    Eigen::VectorXd referenceFinalState = referenceIntegrator->integrateTo( 86400.0, 10.0 );
+
+    std::vector< int > numberOfRejectedSteps;
+    for( unsigned int useProportionalIntegralControl = 0; useProportionalIntegralControl < 2; useProportionalIntegralControl++ )
+    {
+        // Create integrator with (too) large initial step, so that the first steps are rejected
+        std::shared_ptr< IntegratorStepSizeControlSettings > stepSizeControlSettings =
+                perElementIntegratorStepSizeControlSettings< double >( 1.0E-10, 1.0E-10 );
+        if( useProportionalIntegralControl )
+        {
+            stepSizeControlSettings->setProportionalIntegralControl( );
+        }
+        std::shared_ptr< NumericalIntegrator< double, Eigen::VectorXd, Eigen::VectorXd > > integrator =
+                createIntegrator< double, Eigen::VectorXd >(
+                    stateDerivativeFunction, initialState, 0.0,
+                    multiStageVariableStepSizeSettings< double >(
+                        1.0E4, CoefficientSets::rungeKuttaFehlberg78, stepSizeControlSettings,
+                        stepSizeValidationSettings( 1.0E-4, 1.0E4 ) ) );
+
+        Eigen::VectorXd finalState = integrator->integrateTo( 86400.0, 1.0E4 );
+        BOOST_CHECK( integrator->getNumberOfRejectedSteps( ) > 0 );
+        numberOfRejectedSteps.push_back( integrator->getNumberOfRejectedSteps( ) );
+
+        // Compare results with reference
+        for( int i = 0; i < 3; i++ )
+        {
+            BOOST_CHECK_SMALL( finalState( i ) - referenceFinalState( i ), 2.0 );
+            BOOST_CHECK_SMALL( finalState( i + 3 ) - referenceFinalState( i + 3 ), 1.0E-3 );
+        }
+    }
+
+    // Check that PI controller, with post-rejection strategy, does not require more rejected steps
+    BOOST_CHECK( numberOfRejectedSteps.at( 1 ) <= numberOfRejectedSteps.at( 0 ) );
+}
+
+//! Test if stage loop unrolled at compile time gives results identical to runtime stage loop
+BOOST_AUTO_TEST_CASE( testStaticRungeKuttaCoefficients )
+{
+    using namespace numerical_integrators;
+
+    // Define Keplerian orbit state derivative
+    double gravitationalParameter = 3.986004418E14;
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            [ = ]( const double, const Eigen::VectorXd& state )
+    {
+        Eigen::VectorXd stateDerivative = Eigen::VectorXd::Zero( 6 );
+        stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+        stateDerivative.segment( 3, 3 ) = -gravitationalParameter * state.segment( 0, 3 ) /
+                std::pow( state.segment( 0, 3 ).norm( ), 3.0 );
+        return stateDerivative;
+    };
+
+    Eigen::VectorXd initialState = Eigen::VectorXd::Zero( 6 );
+    initialState << 7000.0E3, 0.0, 0.0, 0.0, 7.0E3, 1.0E3;
+
+    std::vector< CoefficientSets > staticCoefficientSets =
+    { rungeKuttaFehlberg45, rungeKuttaFehlberg78, rungeKutta87DormandPrince, rungeKuttaFeagin1210 };
+    for( unsigned int i = 0; i < staticCoefficientSets.size( ); i++ )
+    {
+        RungeKuttaVariableStepSizeIntegratorXd staticIntegrator(
+                    RungeKuttaCoefficients::get( staticCoefficientSets.at( i ) ),
+                    stateDerivativeFunction, 0.0, initialState, 1.0E-4, 1.0E4, 10.0, 1.0E-12, 1.0E-12 );
+        RungeKuttaVariableStepSizeIntegratorXd dynamicIntegrator(
+                    RungeKuttaCoefficients::get( staticCoefficientSets.at( i ) ),
+                    stateDerivativeFunction, 0.0, initialState, 1.0E-4, 1.0E4, 10.0, 1.0E-12, 1.0E-12 );
+        dynamicIntegrator.setUseStaticCoefficients( false );
+
+        BOOST_CHECK_EQUAL( staticIntegrator.getStaticCoefficientSet( ), staticCoefficientSets.at( i ) );
+        BOOST_CHECK_EQUAL( dynamicIntegrator.getStaticCoefficientSet( ), undefinedCoefficientSet );
+
+        // Results should be identical, since the same operations are performed in the same order
+        for( int j = 0; j < 100; j++ )
+        {
+            Eigen::VectorXd staticState = staticIntegrator.performIntegrationStep(
+                        staticIntegrator.getNextStepSize( ) );
+            Eigen::VectorXd dynamicState = dynamicIntegrator.performIntegrationStep(
+                        dynamicIntegrator.getNextStepSize( ) );
+
+            BOOST_CHECK_EQUAL( staticIntegrator.getCurrentIndependentVariable( ),
+                               dynamicIntegrator.getCurrentIndependentVariable( ) );
+            for( int k = 0; k < 6; k++ )
+            {
+                BOOST_CHECK_EQUAL( staticState( k ), dynamicState( k ) );
+            }
+        }
+    }
+
+    // Check that static coefficients are not used for coefficient sets without compile-time tableau, or modified sets
+    RungeKuttaVariableStepSizeIntegratorXd rkf89Integrator(
+                RungeKuttaCoefficients::get( rungeKuttaFehlberg89 ),
+                stateDerivativeFunction, 0.0, initialState, 1.0E-4, 1.0E4, 10.0, 1.0E-12, 1.0E-12 );
+    BOOST_CHECK_EQUAL( rkf89Integrator.getStaticCoefficientSet( ), undefinedCoefficientSet );
+
+    RungeKuttaCoefficients modifiedCoefficients = RungeKuttaCoefficients::get( rungeKuttaFehlberg78 );
+    modifiedCoefficients.bCoefficients( 1, 0 ) += 1.0E-15;
+    BOOST_CHECK_EQUAL( getMatchingStaticRungeKuttaCoefficientSet( modifiedCoefficients ), undefinedCoefficientSet );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -14,6 +14,7 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <vector>
 
 #include "tudat/basics/testMacros.h"
@@ -287,6 +288,76 @@ BOOST_AUTO_TEST_CASE( test_cubicSplineInterpolator_boundary_case )
     }
 }
 
+// Test interpolation at a set of independent variable values, for sorted and unsorted values
+BOOST_AUTO_TEST_CASE( test_cubicSplineInterpolator_batch_interpolation )
+{
+    using namespace interpolators;
+
+    // Create data on non-equidistant grid, with fixed-size vector as dependent variable
+    std::vector< double > independentVariableValues;
+    std::vector< Eigen::Vector3d > dependentVariableValues;
+    for( int i = 0; i < 50; i++ )
+    {
+        double independentVariableValue = 0.1 * std::pow( static_cast< double >( i ), 1.2 );
+        independentVariableValues.push_back( independentVariableValue );
+        dependentVariableValues.push_back(
+                    ( Eigen::Vector3d( ) << std::sin( independentVariableValue ), std::cos( independentVariableValue ),
+                      independentVariableValue ).finished( ) );
+    }
+
+    // Create sorted target values, including data points and values outside of range, and unsorted target values
+    std::vector< double > sortedTargetValues;
+    for( int i = -20; i < 1020; i++ )
+    {
+        sortedTargetValues.push_back( -0.5 + i * independentVariableValues.back( ) / 1000.0 );
+    }
+    sortedTargetValues.insert( sortedTargetValues.end( ), independentVariableValues.begin( ), independentVariableValues.end( ) );
+    std::sort( sortedTargetValues.begin( ), sortedTargetValues.end( ) );
+
+    std::vector< double > unsortedTargetValues;
+    for( unsigned int i = 0; i < sortedTargetValues.size( ); i++ )
+    {
+        unsortedTargetValues.push_back( sortedTargetValues.at( ( 37 * i ) % sortedTargetValues.size( ) ) );
+    }
+
+    for( BoundaryInterpolationType boundaryHandling: { extrapolate_at_boundary, use_boundary_value } )
+    {
+        // Create reference interpolator, using binary search (which, unlike the hunting algorithm, always selects the
+        // upper interval for values at data points)
+        CubicSplineInterpolator< double, Eigen::Vector3d > referenceInterpolator(
+                    independentVariableValues, dependentVariableValues, binarySearch, boundaryHandling );
+
+        for( AvailableLookupScheme lookupScheme: { huntingAlgorithm, binarySearch } )
+        {
+            CubicSplineInterpolator< double, Eigen::Vector3d > interpolator(
+                        independentVariableValues, dependentVariableValues, lookupScheme, boundaryHandling );
+            std::shared_ptr< OneDimensionalInterpolator< double, Eigen::Vector3d > > baseInterpolator =
+                    std::make_shared< CubicSplineInterpolator< double, Eigen::Vector3d > >(
+                        independentVariableValues, dependentVariableValues, lookupScheme, boundaryHandling );
+
+            // Check that batch interpolation (also through base class) is identical to single-value interpolation
+            std::vector< Eigen::Vector3d > interpolatedValues, baseInterpolatedValues;
+            for( const std::vector< double >& targetValues: { sortedTargetValues, unsortedTargetValues } )
+            {
+                interpolator.interpolate( targetValues, interpolatedValues );
+                baseInterpolator->interpolate( targetValues, baseInterpolatedValues );
+
+                BOOST_CHECK_EQUAL( interpolatedValues.size( ), targetValues.size( ) );
+                BOOST_CHECK_EQUAL( baseInterpolatedValues.size( ), targetValues.size( ) );
+                for( unsigned int i = 0; i < targetValues.size( ); i++ )
+                {
+                    Eigen::Vector3d expectedValue = referenceInterpolator.interpolate( targetValues.at( i ) );
+                    for( int j = 0; j < 3; j++ )
+                    {
+                        BOOST_CHECK_EQUAL( interpolatedValues.at( i )( j ), expectedValue( j ) );
+                        BOOST_CHECK_EQUAL( baseInterpolatedValues.at( i )( j ), expectedValue( j ) );
+                    }
+                }
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -13,6 +13,8 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include "tudat/basics/testMacros.h"
@@ -172,6 +174,59 @@ BOOST_AUTO_TEST_CASE( testHermiteCubicSplineInterpolatorWithMatlab )
 }
 
 
+// Test interpolation at a set of independent variable values, for sorted and unsorted values
+BOOST_AUTO_TEST_CASE( testHermiteCubicSplineInterpolatorBatchInterpolation )
+{
+    using namespace interpolators;
+
+    // Create data on non-equidistant grid, with analytical derivatives
+    std::vector< double > independentVariables, dependentVariables, derivatives;
+    for( int i = 0; i < 40; i++ )
+    {
+        double independentVariable = 0.2 * std::pow( static_cast< double >( i ), 1.3 );
+        independentVariables.push_back( independentVariable );
+        dependentVariables.push_back( std::sin( independentVariable ) );
+        derivatives.push_back( std::cos( independentVariable ) );
+    }
+
+    // Create sorted target values (including values outside of range and data points), and unsorted target values
+    std::vector< double > sortedTargetValues;
+    for( int i = -10; i < 510; i++ )
+    {
+        sortedTargetValues.push_back( i * independentVariables.back( ) / 500.0 );
+    }
+    sortedTargetValues.insert( sortedTargetValues.end( ), independentVariables.begin( ), independentVariables.end( ) );
+    std::sort( sortedTargetValues.begin( ), sortedTargetValues.end( ) );
+
+    std::vector< double > unsortedTargetValues( sortedTargetValues.rbegin( ), sortedTargetValues.rend( ) );
+
+    for( BoundaryInterpolationType boundaryHandling: { extrapolate_at_boundary, use_default_value } )
+    {
+        // Create reference interpolator, using binary search (which, unlike the hunting algorithm, always selects the
+        // upper interval for values at data points)
+        HermiteCubicSplineInterpolatorDouble referenceInterpolator(
+                    independentVariables, dependentVariables, derivatives, binarySearch, boundaryHandling );
+
+        for( AvailableLookupScheme lookupScheme: { huntingAlgorithm, binarySearch } )
+        {
+            HermiteCubicSplineInterpolatorDouble interpolator(
+                        independentVariables, dependentVariables, derivatives, lookupScheme, boundaryHandling );
+
+            // Check that batch interpolation is identical to single-value interpolation
+            std::vector< double > interpolatedValues;
+            for( const std::vector< double >& targetValues: { sortedTargetValues, unsortedTargetValues } )
+            {
+                interpolator.interpolate( targetValues, interpolatedValues );
+                BOOST_CHECK_EQUAL( interpolatedValues.size( ), targetValues.size( ) );
+                for( unsigned int i = 0; i < targetValues.size( ); i++ )
+                {
+                    BOOST_CHECK_EQUAL( interpolatedValues.at( i ), referenceInterpolator.interpolate( targetValues.at( i ) ) );
+                }
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
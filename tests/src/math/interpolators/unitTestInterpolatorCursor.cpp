@@ -0,0 +1,197 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/parallelization.h"
+#include "tudat/math/interpolators/arcCursor.h"
+#include "tudat/math/interpolators/createInterpolator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace interpolators;
+
+BOOST_AUTO_TEST_SUITE( test_interpolator_cursor )
+
+//! Test whether interpolator cursors share data with, and reproduce results of, the original interpolator
+BOOST_AUTO_TEST_CASE( test_interpolator_cursor_results )
+{
+    // Create irregularly spaced data, and its derivative (for Hermite interpolator)
+    std::map< double, Eigen::VectorXd > dataMap;
+    std::vector< Eigen::VectorXd > dataDerivatives;
+    for( int i = 0; i < 200; i++ )
+    {
+        double currentTime = 10.0 * i + 3.0 * std::sin( 0.7 * i );
+        dataMap[ currentTime ] = ( Eigen::VectorXd( 2 ) << std::sin( 0.01 * currentTime ),
+                                   std::cos( 0.02 * currentTime ) ).finished( );
+        dataDerivatives.push_back( ( Eigen::VectorXd( 2 ) << 0.01 * std::cos( 0.01 * currentTime ),
+                                     -0.02 * std::sin( 0.02 * currentTime ) ).finished( ) );
+    }
+
+    std::vector< std::shared_ptr< InterpolatorSettings > > interpolatorSettingsList =
+    { std::make_shared< InterpolatorSettings >( linear_interpolator ),
+      std::make_shared< InterpolatorSettings >( cubic_spline_interpolator ),
+      std::make_shared< LagrangeInterpolatorSettings >( 8 ),
+      std::make_shared< InterpolatorSettings >( hermite_spline_interpolator ),
+      std::make_shared< InterpolatorSettings >( piecewise_constant_interpolator ),
+      std::make_shared< InterpolatorSettings >( linear_interpolator, binarySearch ) };
+
+    // Define times at which to interpolate (covering boundary regions)
+    std::vector< double > testTimes;
+    for( int i = 0; i < 1000; i++ )
+    {
+        testTimes.push_back( -5.0 + 2.0 * i + 0.1 * std::cos( 1.3 * i ) );
+    }
+
+    for( unsigned int i = 0; i < interpolatorSettingsList.size( ); i++ )
+    {
+        std::shared_ptr< OneDimensionalInterpolator< double, Eigen::VectorXd > > interpolator =
+                createOneDimensionalInterpolator( dataMap, interpolatorSettingsList.at( i ),
+                                                  std::make_pair< Eigen::VectorXd, Eigen::VectorXd >(
+                                                      Eigen::VectorXd::Zero( 2 ), Eigen::VectorXd::Zero( 2 ) ),
+                                                  dataDerivatives );
+
+        std::shared_ptr< OneDimensionalInterpolator< double, Eigen::VectorXd > > cursor = cloneCursor( interpolator );
+        std::shared_ptr< OneDimensionalInterpolator< double, Eigen::VectorXd > > cursorOfCursor = cloneCursor( cursor );
+
+        // Check that interpolator data is shared, and that cursor look-up schemes are separate
+        BOOST_CHECK_EQUAL( cursor->getInterpolatorType( ), interpolator->getInterpolatorType( ) );
+        BOOST_CHECK_EQUAL( cursor->getSelectedLookupScheme( ), interpolator->getSelectedLookupScheme( ) );
+        BOOST_CHECK( cursor->getIndependentValues( ) == interpolator->getIndependentValues( ) );
+        BOOST_CHECK( cursor->getLookUpScheme( ) != interpolator->getLookUpScheme( ) );
+        BOOST_CHECK( cursor->getLookUpScheme( ) != cursorOfCursor->getLookUpScheme( ) );
+        BOOST_CHECK( cursor->getLookUpScheme( )->getIndependentVariableValues( ) ==
+                     interpolator->getLookUpScheme( )->getIndependentVariableValues( ) );
+        typedef OneDimensionalInterpolatorCursor< double, Eigen::VectorXd > InterpolatorCursor;
+        BOOST_CHECK( std::dynamic_pointer_cast< InterpolatorCursor >( cursorOfCursor )->getInterpolator( ) == interpolator );
+
+        // Check that results are identical, with cursors used in a different order than the original interpolator
+        for( unsigned int j = 0; j < testTimes.size( ); j++ )
+        {
+            Eigen::VectorXd interpolatedValue = interpolator->interpolate( testTimes.at( j ) );
+            Eigen::VectorXd cursorValue = cursor->interpolate( testTimes.at( j ) );
+            Eigen::VectorXd reverseCursorValue = cursorOfCursor->interpolate( testTimes.at( testTimes.size( ) - 1 - j ) );
+            BOOST_CHECK( cursorValue == interpolatedValue );
+            BOOST_CHECK( reverseCursorValue == interpolator->interpolate( testTimes.at( testTimes.size( ) - 1 - j ) ) );
+        }
+    }
+}
+
+//! Test concurrent use of a single interpolator through (per-thread) cursors
+BOOST_AUTO_TEST_CASE( test_interpolator_cursor_concurrency )
+{
+    std::map< double, Eigen::VectorXd > dataMap;
+    for( int i = 0; i < 1000; i++ )
+    {
+        double currentTime = 60.0 * i + 10.0 * std::sin( 0.3 * i );
+        dataMap[ currentTime ] = ( Eigen::VectorXd( 3 ) << std::sin( 0.001 * currentTime ),
+                                   std::cos( 0.002 * currentTime ), 1.0E-3 * currentTime ).finished( );
+    }
+
+    std::shared_ptr< OneDimensionalInterpolator< double, Eigen::VectorXd > > interpolator =
+            createOneDimensionalInterpolator( dataMap, std::make_shared< LagrangeInterpolatorSettings >( 8 ) );
+
+    // Compute reference values serially
+    const int numberOfTasks = 8;
+    const int numberOfTimesPerTask = 5000;
+    std::vector< std::vector< double > > testTimes( numberOfTasks );
+    std::vector< std::vector< Eigen::VectorXd > > referenceValues( numberOfTasks );
+    for( int i = 0; i < numberOfTasks; i++ )
+    {
+        for( int j = 0; j < numberOfTimesPerTask; j++ )
+        {
+            // Each task moves through the domain in a different direction, and with a different rate
+            double currentTime = ( i % 2 == 0 ? 17.0 * ( i + 1 ) * j : 60.0E3 - 13.0 * ( i + 1 ) * j );
+            currentTime = std::fmod( std::fabs( currentTime ), 60.0E3 );
+            testTimes[ i ].push_back( currentTime );
+            referenceValues[ i ].push_back( interpolator->interpolate( currentTime ) );
+        }
+    }
+
+    // Interpolate concurrently, with one cursor per task
+    std::vector< std::vector< Eigen::VectorXd > > concurrentValues( numberOfTasks );
+    utilities::executeParallelTasks(
+                numberOfTasks, [ & ]( const int taskIndex )
+    {
+        std::shared_ptr< OneDimensionalInterpolator< double, Eigen::VectorXd > > cursor = cloneCursor( interpolator );
+        for( int j = 0; j < numberOfTimesPerTask; j++ )
+        {
+            concurrentValues[ taskIndex ].push_back( cursor->interpolate( testTimes[ taskIndex ][ j ] ) );
+        }
+    }, 4 );
+
+    for( int i = 0; i < numberOfTasks; i++ )
+    {
+        for( int j = 0; j < numberOfTimesPerTask; j++ )
+        {
+            BOOST_CHECK( concurrentValues[ i ][ j ] == referenceValues[ i ][ j ] );
+        }
+    }
+}
+
+//! Test whether arc cursor returns the same arc indices as a binary search, for monotonic and random requests
+BOOST_AUTO_TEST_CASE( test_arc_cursor )
+{
+    std::vector< double > arcStartTimes = { 0.0, 100.0, 250.0, 300.0, 1000.0 };
+    std::shared_ptr< LookUpScheme< double > > binarySearchLookup =
+            std::make_shared< BinarySearchLookupScheme< double > >( arcStartTimes );
+
+    ArcCursor arcCursor( arcStartTimes );
+    BOOST_CHECK_EQUAL( arcCursor.getNumberOfArcs( ), 5 );
+
+    // Compare arc index for monotonically increasing, decreasing and random times
+    std::vector< double > testTimes;
+    for( double time = 0.0; time < 1500.0; time += 7.0 )
+    {
+        testTimes.push_back( time );
+    }
+    for( double time = 1500.0; time >= 0.0; time -= 11.0 )
+    {
+        testTimes.push_back( time );
+    }
+    std::vector< double > randomTimes = { 1200.0, 5.0, 299.9, 300.0, 100.0, 99.999, 1.0E10, 250.0 };
+    testTimes.insert( testTimes.end( ), randomTimes.begin( ), randomTimes.end( ) );
+
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        int expectedArcIndex = ( testTimes.at( i ) >= 1000.0 ) ?
+                    4 : binarySearchLookup->findNearestLowerNeighbour( testTimes.at( i ) );
+        BOOST_CHECK_EQUAL( arcCursor.getArcIndex( testTimes.at( i ) ), expectedArcIndex );
+    }
+
+    // Check times before first arc, and invalid input
+    BOOST_CHECK_EQUAL( arcCursor.getArcIndex( -1.0 ), -1 );
+    BOOST_CHECK_EQUAL( arcCursor.getArcIndex( TUDAT_NAN ), -1 );
+    BOOST_CHECK_EQUAL( arcCursor.getArcIndex( 260.0 ), 2 );
+
+    bool isExceptionCaught = false;
+    try
+    {
+        ArcCursor invalidArcCursor( std::vector< double >( { 0.0, 100.0, 50.0 } ) );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -18,6 +18,7 @@
 #include "tudat/math/basic/mathematicalConstants.h"
 
 #include "tudat/math/interpolators/lagrangeInterpolator.h"
+#include "tudat/math/interpolators/oneDimensionalInterpolatorCursor.h"
 
 namespace tudat
 {
@@ -43,6 +44,29 @@ double evaluatePolynomial( const std::map< int, double >& coefficients,
     return polynomialValue;
 }
 
+//! Function to evaluate derivative of polynomial
+/*!
+ *  Function to evaluate derivative of polynomial with coefficients and independent variable as input.
+ *  \param coefficients Polynomial coefficients with the coefficient as map value and order as key.
+ *  \param evaluationPoint Independent variable at which polynomial derivative is to be evaluated.
+ *  \return Polynomial derivative value.
+ */
+double evaluatePolynomialDerivative( const std::map< int, double >& coefficients,
+                                     const double evaluationPoint )
+{
+    double polynomialDerivative = 0.0;
+    for( std::map< int, double >::const_iterator it = coefficients.begin( );
+         it != coefficients.end( ) ; it++ )
+    {
+        if( it->first > 0 )
+        {
+            polynomialDerivative += static_cast< double >( it->first ) * it->second *
+                    std::pow( evaluationPoint, it->first - 1 );
+        }
+    }
+    return polynomialDerivative;
+}
+
 //! Function to retrieve polynomial coefficients
 /*!
  *  Function to retrieve quasi-random polynomial coefficients, up to a given maximum order.
@@ -565,7 +589,183 @@ BOOST_AUTO_TEST_CASE( test_lagrange_error_checks )
     }
 }
 
+//! Test whether interpolation of a block of rows of a matrix is equal to the same block of full matrix interpolation
+BOOST_AUTO_TEST_CASE( test_lagrange_interpolation_of_matrix_rows )
+{
+    // Create irregularly spaced matrix data
+    std::vector< double > independentVariables;
+    std::vector< Eigen::MatrixXd > dependentVariables;
+    for( int i = 0; i < 40; i++ )
+    {
+        double currentTime = 10.0 * i + 2.0 * std::sin( 0.3 * i );
+        independentVariables.push_back( currentTime );
+
+        Eigen::MatrixXd currentMatrix = Eigen::MatrixXd::Zero( 6, 9 );
+        for( int j = 0; j < 6; j++ )
+        {
+            for( int k = 0; k < 9; k++ )
+            {
+                currentMatrix( j, k ) = std::cos( 0.01 * ( j + 1 ) * currentTime + k ) * ( 1.0 + j * k );
+            }
+        }
+        dependentVariables.push_back( currentMatrix );
+    }
+
+    for( int numberOfStages = 4; numberOfStages <= 8; numberOfStages += 2 )
+    {
+        interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > interpolator(
+                    independentVariables, dependentVariables, numberOfStages );
+
+        // Test in interior and boundary regions, at and between data points, and outside of domain
+        std::vector< double > testTimes = { -5.0, 1.0, 15.0, 40.0, independentVariables.at( 20 ), 201.7, 385.0, 395.0, 420.0 };
+        for( unsigned int i = 0; i < testTimes.size( ); i++ )
+        {
+            Eigen::MatrixXd fullMatrix = interpolator.interpolate( testTimes.at( i ) );
+            for( int startRow = 0; startRow < 6; startRow += 3 )
+            {
+                Eigen::MatrixXd matrixRows = Eigen::MatrixXd::Constant( 3, 9, TUDAT_NAN );
+                interpolator.interpolateRows( testTimes.at( i ), startRow, matrixRows.block( 0, 0, 3, 9 ) );
+
+                for( int j = 0; j < 3; j++ )
+                {
+                    for( int k = 0; k < 9; k++ )
+                    {
+                        BOOST_CHECK_SMALL( std::fabs( matrixRows( j, k ) - fullMatrix( startRow + j, k ) ),
+                                           1.0E-12 * std::max( 1.0, std::fabs( fullMatrix( startRow + j, k ) ) ) );
+                    }
+                }
+            }
+        }
+    }
+}
+
+//! Test interpolation into given output, and interpolation of derivatives, using polynomials (which are reproduced exactly)
+BOOST_AUTO_TEST_CASE( test_lagrange_interpolation_derivatives )
+{
+    std::vector< double > independentVariableVector = getIndependentVariableVector( );
+    for( int stages = 4; stages < 11; stages += 2 )
+    {
+        std::map< int, double > coefficients = getPolynomialCoefficients( stages - 1 );
+
+        // Generate scalar and vector dependent variables
+        std::map< double, double > dataMap;
+        std::map< double, Eigen::VectorXd > vectorDataMap;
+        for( unsigned int i = 0; i < independentVariableVector.size( ); i++ )
+        {
+            double currentValue = evaluatePolynomial( coefficients, independentVariableVector.at( i ) );
+            dataMap[ independentVariableVector.at( i ) ] = currentValue;
+            vectorDataMap[ independentVariableVector.at( i ) ] = ( Eigen::VectorXd( 2 ) << currentValue, -2.0 * currentValue ).finished( );
+        }
+
+        interpolators::LagrangeInterpolator< double, double > interpolator(
+                    dataMap, stages, interpolators::huntingAlgorithm, interpolators::lagrange_no_boundary_interpolation );
+        interpolators::LagrangeInterpolator< double, Eigen::VectorXd > vectorInterpolator(
+                    vectorDataMap, stages, interpolators::huntingAlgorithm, interpolators::lagrange_no_boundary_interpolation );
+
+        // Iterate over all intervals inside allowed (i.e. non-boundary) range, including the data points themselves
+        int offsetEntries = stages / 2 - 1;
+        double interpolatedValue, interpolatedDerivative;
+        Eigen::VectorXd interpolatedVector = Eigen::VectorXd::Zero( 2 );
+        Eigen::VectorXd interpolatedVectorDerivative = Eigen::VectorXd::Zero( 2 );
+        for( unsigned int i = offsetEntries;
+             i < independentVariableVector.size( ) - ( offsetEntries + 2 ); i++ )
+        {
+            double currentStepSize =  ( independentVariableVector.at( i + 1 ) -
+                                        independentVariableVector.at( i ) ) / 10.0;
+            for( unsigned j = 0; j < 10; j ++ )
+            {
+                double currentDataPoint = independentVariableVector.at( i ) +
+                        static_cast< double >( j ) * currentStepSize;
+                double expectedValue = evaluatePolynomial( coefficients, currentDataPoint );
+                double expectedDerivative = evaluatePolynomialDerivative( coefficients, currentDataPoint );
+
+                interpolator.interpolateWithDerivative( currentDataPoint, interpolatedValue, interpolatedDerivative );
+                BOOST_CHECK_CLOSE_FRACTION( interpolatedValue, expectedValue, 2.0E-14 );
+                BOOST_CHECK_CLOSE_FRACTION( interpolatedDerivative, expectedDerivative, 1.0E-11 );
+
+                // Check that interpolation (into given output) is consistent
+                interpolator.interpolate( currentDataPoint, interpolatedValue );
+                BOOST_CHECK_CLOSE_FRACTION( interpolatedValue, expectedValue, 2.0E-14 );
+
+                vectorInterpolator.interpolateWithDerivative(
+                            currentDataPoint, interpolatedVector, interpolatedVectorDerivative );
+                BOOST_CHECK_CLOSE_FRACTION( interpolatedVector( 0 ), expectedValue, 2.0E-14 );
+                BOOST_CHECK_CLOSE_FRACTION( interpolatedVector( 1 ), -2.0 * expectedValue, 2.0E-14 );
+                BOOST_CHECK_CLOSE_FRACTION( interpolatedVectorDerivative( 0 ), expectedDerivative, 1.0E-11 );
+                BOOST_CHECK_CLOSE_FRACTION( interpolatedVectorDerivative( 1 ), -2.0 * expectedDerivative, 1.0E-11 );
+
+                vectorInterpolator.interpolate( currentDataPoint, interpolatedVector );
+                BOOST_CHECK_EQUAL( interpolatedVector( 0 ), vectorInterpolator.interpolate( currentDataPoint )( 0 ) );
+            }
+        }
+
+        // Check that derivative is not provided in boundary region, or outside of domain
+        BOOST_CHECK_THROW( interpolator.interpolateWithDerivative(
+                               independentVariableVector.at( 0 ), interpolatedValue, interpolatedDerivative ),
+                           std::runtime_error );
+        BOOST_CHECK_THROW( interpolator.interpolateWithDerivative(
+                               independentVariableVector.back( ) + 1.0, interpolatedValue, interpolatedDerivative ),
+                           std::runtime_error );
+    }
+}
+
+//! Test resetting the data of a Lagrange interpolator in place, with unchanged and changed independent variables
+BOOST_AUTO_TEST_CASE( test_lagrange_interpolator_data_reset )
+{
+    // Create irregularly spaced vector data, for three data sets (the last one with different independent variables)
+    std::vector< std::vector< double > > independentVariables( 3 );
+    std::vector< std::vector< Eigen::Vector6d > > dependentVariables( 3 );
+    for( int dataSet = 0; dataSet < 3; dataSet++ )
+    {
+        int numberOfDataPoints = ( dataSet < 2 ) ? 40 : 55;
+        for( int i = 0; i < numberOfDataPoints; i++ )
+        {
+            double currentTime = ( dataSet < 2 ) ? ( 10.0 * i + 2.0 * std::sin( 0.3 * i ) ) : ( 7.5 * i - 3.0 );
+            independentVariables.at( dataSet ).push_back( currentTime );
+
+            Eigen::Vector6d currentState;
+            for( int j = 0; j < 6; j++ )
+            {
+                currentState( j ) = std::cos( 0.01 * ( j + 1 + dataSet ) * currentTime + j ) * ( 1.0 + j * dataSet );
+            }
+            dependentVariables.at( dataSet ).push_back( currentState );
+        }
+    }
+
+    std::shared_ptr< interpolators::LagrangeInterpolator< double, Eigen::Vector6d > > interpolator =
+            std::make_shared< interpolators::LagrangeInterpolator< double, Eigen::Vector6d > >(
+                independentVariables.at( 0 ), dependentVariables.at( 0 ), 6 );
+    interpolators::OneDimensionalInterpolatorCursor< double, Eigen::Vector6d > interpolatorCursor( interpolator );
 
+    std::vector< double > testTimes = { -5.0, 1.0, 15.0, 40.0, independentVariables.at( 0 ).at( 20 ), 201.7, 385.0, 395.0, 420.0 };
+    for( int dataSet = 1; dataSet < 3; dataSet++ )
+    {
+        // Reset data, and compare to newly created interpolator
+        interpolator->resetData( independentVariables.at( dataSet ), dependentVariables.at( dataSet ) );
+        interpolators::LagrangeInterpolator< double, Eigen::Vector6d > newInterpolator(
+                    independentVariables.at( dataSet ), dependentVariables.at( dataSet ), 6 );
+
+        BOOST_CHECK_EQUAL( interpolator->getIndependentValues( ).size( ), independentVariables.at( dataSet ).size( ) );
+        for( unsigned int i = 0; i < testTimes.size( ); i++ )
+        {
+            Eigen::Vector6d expectedState = newInterpolator.interpolate( testTimes.at( i ) );
+            Eigen::Vector6d resetState = interpolator->interpolate( testTimes.at( i ) );
+            Eigen::Vector6d cursorState = interpolatorCursor.interpolate( testTimes.at( i ) );
+            for( int j = 0; j < 6; j++ )
+            {
+                BOOST_CHECK_EQUAL( resetState( j ), expectedState( j ) );
+                BOOST_CHECK_EQUAL( cursorState( j ), expectedState( j ) );
+            }
+        }
+    }
+
+    // Check that inconsistent input is rejected
+    BOOST_CHECK_THROW( interpolator->resetData( independentVariables.at( 0 ), dependentVariables.at( 2 ) ), std::runtime_error );
+    BOOST_CHECK_THROW( interpolator->resetData(
+                           std::vector< double >( independentVariables.at( 0 ).begin( ), independentVariables.at( 0 ).begin( ) + 4 ),
+                           std::vector< Eigen::Vector6d >( dependentVariables.at( 0 ).begin( ), dependentVariables.at( 0 ).begin( ) + 4 ) ),
+                       std::runtime_error );
+}
 
 BOOST_AUTO_TEST_SUITE_END( )
 
@@ -454,6 +454,72 @@ BOOST_AUTO_TEST_CASE( test_linearInterpolation_boundary_case_extrapolation_user_
     }
 }
 
+// Test uniform grid look-up scheme, and its automatic selection for equidistant independent variables.
+BOOST_AUTO_TEST_CASE( test_linearInterpolation_uniform_grid_lookup )
+{
+    using namespace interpolators;
+
+    // Create equidistant grid by summation, so that values contain rounding errors
+    std::vector< double > uniformIndependentValues;
+    std::map< double, double > uniformDataMap;
+    double currentValue = 0.0;
+    for( int i = 0; i < 1001; i++ )
+    {
+        uniformIndependentValues.push_back( currentValue );
+        uniformDataMap[ currentValue ] = 3.0 * currentValue - 2.0;
+        currentValue += 0.1;
+    }
+    std::vector< double > nonUniformIndependentValues = uniformIndependentValues;
+    nonUniformIndependentValues[ 500 ] += 0.01;
+
+    BOOST_CHECK( isIndependentVariableGridUniform( uniformIndependentValues ) );
+    BOOST_CHECK( !isIndependentVariableGridUniform( nonUniformIndependentValues ) );
+    BOOST_CHECK_THROW( UniformGridLookupScheme< double >{ nonUniformIndependentValues }, std::runtime_error );
+
+    // Check that look-up is identical to binary search, inside and outside grid, and at grid values
+    UniformGridLookupScheme< double > uniformGridLookupScheme( uniformIndependentValues );
+    BinarySearchLookupScheme< double > binarySearchLookupScheme( uniformIndependentValues );
+    for( int i = -1000; i < 11000; i++ )
+    {
+        double valueToLookup = static_cast< double >( i ) * 0.01 + 0.0007;
+        BOOST_CHECK_EQUAL( uniformGridLookupScheme.findNearestLowerNeighbour( valueToLookup ),
+                           binarySearchLookupScheme.findNearestLowerNeighbour( valueToLookup ) );
+    }
+    for( unsigned int i = 0; i < uniformIndependentValues.size( ); i++ )
+    {
+        for( int j = -1; j < 2; j++ )
+        {
+            double valueToLookup = uniformIndependentValues.at( i ) + static_cast< double >( j ) *
+                    std::numeric_limits< double >::epsilon( ) * uniformIndependentValues.at( i );
+            BOOST_CHECK_EQUAL( uniformGridLookupScheme.findNearestLowerNeighbour( valueToLookup ),
+                               binarySearchLookupScheme.findNearestLowerNeighbour( valueToLookup ) );
+        }
+    }
+
+    // Check automatic selection of uniform grid look-up
+    BOOST_CHECK( std::dynamic_pointer_cast< UniformGridLookupScheme< double > >(
+                     createLookupScheme( uniformIndependentValues, huntingAlgorithm ) ) != nullptr );
+    BOOST_CHECK( std::dynamic_pointer_cast< UniformGridLookupScheme< double > >(
+                     createLookupScheme( uniformIndependentValues, binarySearch ) ) != nullptr );
+    BOOST_CHECK( std::dynamic_pointer_cast< UniformGridLookupScheme< double > >(
+                     createLookupScheme( uniformIndependentValues, huntingAlgorithm, false ) ) == nullptr );
+    BOOST_CHECK( std::dynamic_pointer_cast< UniformGridLookupScheme< double > >(
+                     createLookupScheme( nonUniformIndependentValues, huntingAlgorithm ) ) == nullptr );
+    BOOST_CHECK_THROW( createLookupScheme( nonUniformIndependentValues, uniformGrid ), std::runtime_error );
+
+    // Check interpolation results with uniform grid look-up
+    for( AvailableLookupScheme lookupScheme: { huntingAlgorithm, uniformGrid } )
+    {
+        LinearInterpolatorDouble interpolator( uniformDataMap, lookupScheme );
+        for( int i = 0; i < 1000; i++ )
+        {
+            double valueToInterpolate = static_cast< double >( i ) * 0.0999 + 0.003;
+            BOOST_CHECK_CLOSE_FRACTION( interpolator.interpolate( valueToInterpolate ),
+                                        3.0 * valueToInterpolate - 2.0, 1.0E-12 );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -619,6 +619,88 @@ BOOST_AUTO_TEST_CASE( test2DimensionsUserExtrapolationCase )
     }
 }
 
+//! Test reproduction of multi-linear function, for vector-valued and scalar dependent variables
+BOOST_AUTO_TEST_CASE( test4DimensionsMultiLinearFunction )
+{
+    using namespace interpolators;
+
+    // Create non-equidistant grid (with different number of points per dimension)
+    std::vector< std::vector< double > > independentValues( 4 );
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        for( unsigned int j = 0; j < 3 + 2 * i; j++ )
+        {
+            independentValues[ i ].push_back( static_cast< double >( j * j ) + 0.3 * static_cast< double >( i * j ) );
+        }
+    }
+
+    // Define multi-linear function of independent variables
+    auto evaluateFunction = [ ]( const std::vector< double >& x )
+    {
+        Eigen::Vector6d functionValue;
+        for( int k = 0; k < 6; k++ )
+        {
+            functionValue( k ) = ( 1.0 + 0.1 * k * x[ 0 ] ) * ( 2.0 - 0.05 * x[ 1 ] ) *
+                    ( 0.5 + 0.2 * x[ 2 ] ) * ( 1.0 + 0.01 * ( k + 1 ) * x[ 3 ] );
+        }
+        return functionValue;
+    };
+
+    // Set dependent values
+    boost::multi_array< Eigen::Vector6d, 4 > dependentValues;
+    boost::multi_array< double, 4 > scalarDependentValues;
+    dependentValues.resize( boost::extents[ 3 ][ 5 ][ 7 ][ 9 ] );
+    scalarDependentValues.resize( boost::extents[ 3 ][ 5 ][ 7 ][ 9 ] );
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        for( unsigned int j = 0; j < 5; j++ )
+        {
+            for( unsigned int k = 0; k < 7; k++ )
+            {
+                for( unsigned int l = 0; l < 9; l++ )
+                {
+                    dependentValues[ i ][ j ][ k ][ l ] = evaluateFunction(
+                    { independentValues[ 0 ][ i ], independentValues[ 1 ][ j ],
+                      independentValues[ 2 ][ k ], independentValues[ 3 ][ l ] } );
+                    scalarDependentValues[ i ][ j ][ k ][ l ] = dependentValues[ i ][ j ][ k ][ l ]( 2 );
+                }
+            }
+        }
+    }
+
+    MultiLinearInterpolator< double, Eigen::Vector6d, 4 > interpolator( independentValues, dependentValues );
+    MultiLinearInterpolator< double, double, 4 > scalarInterpolator( independentValues, scalarDependentValues );
+
+    // Check interpolation inside the grid, at grid points, and (linear) extrapolation outside the grid
+    for( int i = 0; i < 500; i++ )
+    {
+        std::vector< double > targetValue( 4 );
+        for( unsigned int j = 0; j < 4; j++ )
+        {
+            targetValue[ j ] = -1.0 + ( independentValues[ j ].back( ) + 2.0 ) *
+                    ( 0.5 + 0.5 * std::sin( 1.7 * i + 0.9 * j ) );
+        }
+        if( i % 10 == 0 )
+        {
+            for( unsigned int j = 0; j < 4; j++ )
+            {
+                targetValue[ j ] = independentValues[ j ][ ( i / 10 ) % independentValues[ j ].size( ) ];
+            }
+        }
+
+        Eigen::Vector6d interpolatedValue = interpolator.interpolate( targetValue );
+        Eigen::Vector6d expectedValue = evaluateFunction( targetValue );
+        for( int k = 0; k < 6; k++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( interpolatedValue( k ) - expectedValue( k ) ),
+                               1.0E-13 * std::max( 1.0, expectedValue.cwiseAbs( ).maxCoeff( ) ) );
+        }
+
+        // Vector-valued and scalar interpolation should be identical
+        BOOST_CHECK_EQUAL( interpolatedValue( 2 ), scalarInterpolator.interpolate( targetValue ) );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -265,6 +265,39 @@ BOOST_AUTO_TEST_CASE( testIntegralPolyFunction )
 }
 
 
+//! Test if quadrature with integrand evaluated at all nodes at once matches quadrature with scalar integrand.
+BOOST_AUTO_TEST_CASE( testIntegralBatchIntegrand )
+{
+    using namespace numerical_quadrature;
+
+    // Check that nodes and weights are shared between quadratures
+    BOOST_CHECK( getGaussQuadratureNodesAndWeights< double >( ) == getGaussQuadratureNodesAndWeights< double >( ) );
+
+    const double lowerLimit = -2.0;
+    const double upperLimit = 3.0;
+    GaussianQuadrature< double, double >::BatchIntegrandFunction batchExpFunction =
+            [ ]( const Eigen::ArrayXd& independentVariables, Eigen::ArrayXd& integrands )
+    {
+        integrands = independentVariables.exp( );
+    };
+
+    GaussianQuadrature< double, double > batchIntegrator( batchExpFunction, lowerLimit, upperLimit, 2 );
+    for( unsigned int order = 2; order <= 64; order++ )
+    {
+        GaussianQuadrature< double, double > integrator( expFunction, lowerLimit, upperLimit, order );
+        batchIntegrator.reset( batchExpFunction, lowerLimit, upperLimit, order );
+        BOOST_CHECK_CLOSE_FRACTION( batchIntegrator.getQuadrature( ), integrator.getQuadrature( ), 1.0E-14 );
+    }
+
+    // Check that integrand with incorrect number of values is detected
+    GaussianQuadrature< double, double > invalidIntegrator(
+                [ ]( const Eigen::ArrayXd& independentVariables, Eigen::ArrayXd& integrands )
+    {
+        integrands = Eigen::ArrayXd::Zero( independentVariables.rows( ) + 1 );
+    }, lowerLimit, upperLimit, 8 );
+    BOOST_CHECK_THROW( invalidIntegrator.getQuadrature( ), std::runtime_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,123 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/math/root_finders/batchRootFinders.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_batch_root_finders )
+
+using namespace root_finders;
+
+//! Evaluator of Kepler's equation, E - e sin E - M, for a set of mean anomalies.
+struct KeplerEquationEvaluator
+{
+    KeplerEquationEvaluator( const double eccentricity, const Eigen::ArrayXd& meanAnomalies ):
+        eccentricity_( eccentricity ), meanAnomalies_( meanAnomalies ){ }
+
+    void operator( )( const Eigen::ArrayXd& eccentricAnomalies, Eigen::ArrayXd& functionValues ) const
+    {
+        functionValues = eccentricAnomalies - eccentricity_ * eccentricAnomalies.sin( ) - meanAnomalies_;
+    }
+
+    void operator( )( const Eigen::ArrayXd& eccentricAnomalies, Eigen::ArrayXd& functionValues,
+                      Eigen::ArrayXd& firstDerivativeValues ) const
+    {
+        operator( )( eccentricAnomalies, functionValues );
+        firstDerivativeValues = 1.0 - eccentricity_ * eccentricAnomalies.cos( );
+    }
+
+    void operator( )( const Eigen::ArrayXd& eccentricAnomalies, Eigen::ArrayXd& functionValues,
+                      Eigen::ArrayXd& firstDerivativeValues, Eigen::ArrayXd& secondDerivativeValues ) const
+    {
+        operator( )( eccentricAnomalies, functionValues, firstDerivativeValues );
+        secondDerivativeValues = eccentricity_ * eccentricAnomalies.sin( );
+    }
+
+    double eccentricity_;
+
+    Eigen::ArrayXd meanAnomalies_;
+};
+
+//! Check that all batch root finders solve Kepler's equation for a range of mean anomalies.
+BOOST_AUTO_TEST_CASE( testBatchRootFindersKeplerEquation )
+{
+    const double eccentricity = 0.6;
+    const Eigen::ArrayXd meanAnomalies = Eigen::ArrayXd::LinSpaced( 101, 0.0, 2.0 * M_PI );
+    const KeplerEquationEvaluator evaluator( eccentricity, meanAnomalies );
+
+    Eigen::ArrayXd newtonRaphsonRoots = meanAnomalies + eccentricity;
+    Eigen::ArrayXd halleyRoots = meanAnomalies + eccentricity;
+    Eigen::ArrayXd secantRoots = meanAnomalies + eccentricity;
+    Eigen::ArrayXd bisectionRoots;
+
+    BOOST_CHECK( findRootsUsingNewtonRaphson( evaluator, newtonRaphsonRoots, 1.0E-13 ).all( ) );
+    BOOST_CHECK( findRootsUsingHalley( evaluator, halleyRoots, 1.0E-13 ).all( ) );
+    BOOST_CHECK( findRootsUsingSecant( evaluator, Eigen::ArrayXd( meanAnomalies ), secantRoots, 1.0E-13 ).all( ) );
+    BOOST_CHECK( findRootsUsingBisection( evaluator, Eigen::ArrayXd( meanAnomalies - 1.0 ),
+                                          Eigen::ArrayXd( meanAnomalies + 1.0 ), bisectionRoots, 1.0E-15 ).all( ) );
+
+    for( int i = 0; i < meanAnomalies.rows( ); i++ )
+    {
+        // Check that roots satisfy Kepler's equation
+        BOOST_CHECK_SMALL( newtonRaphsonRoots( i ) - eccentricity * std::sin( newtonRaphsonRoots( i ) ) -
+                           meanAnomalies( i ), 1.0E-14 );
+        BOOST_CHECK_SMALL( halleyRoots( i ) - eccentricity * std::sin( halleyRoots( i ) ) -
+                           meanAnomalies( i ), 1.0E-14 );
+        BOOST_CHECK_SMALL( secantRoots( i ) - eccentricity * std::sin( secantRoots( i ) ) -
+                           meanAnomalies( i ), 1.0E-14 );
+
+        // Check that root finders agree
+        BOOST_CHECK_SMALL( halleyRoots( i ) - newtonRaphsonRoots( i ), 1.0E-14 );
+        BOOST_CHECK_SMALL( secantRoots( i ) - newtonRaphsonRoots( i ), 1.0E-14 );
+        BOOST_CHECK_SMALL( bisectionRoots( i ) - newtonRaphsonRoots( i ), 1.0E-14 );
+    }
+
+    // Check that root at zero (exact zero function value at initial guess) is retained
+    BOOST_CHECK_EQUAL( bisectionRoots( 0 ), 0.0 );
+}
+
+//! Check handling of roots that do not converge within the maximum number of iterations.
+BOOST_AUTO_TEST_CASE( testBatchRootFindersNonConvergence )
+{
+    const double eccentricity = 0.9;
+    const Eigen::ArrayXd meanAnomalies = Eigen::ArrayXd::LinSpaced( 11, 0.1, 3.0 );
+    const KeplerEquationEvaluator evaluator( eccentricity, meanAnomalies );
+
+    Eigen::ArrayXd roots = meanAnomalies;
+    BOOST_CHECK_THROW( findRootsUsingNewtonRaphson( evaluator, roots, 1.0E-15, 2 ), std::runtime_error );
+
+    roots = meanAnomalies;
+    Eigen::Array< bool, Eigen::Dynamic, 1 > isRootConverged =
+            findRootsUsingNewtonRaphson( evaluator, roots, 1.0E-15, 2, accept_result );
+    BOOST_CHECK( !isRootConverged.all( ) );
+
+    // Check that bounds without sign change are rejected
+    BOOST_CHECK_THROW( findRootsUsingBisection( evaluator, Eigen::ArrayXd( meanAnomalies + 1.0 ),
+                                                Eigen::ArrayXd( meanAnomalies + 2.0 ), roots, 1.0E-15 ),
+                       std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -12,9 +12,15 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MAIN
 
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
 #include <map>
 #include <limits>
 #include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
 
 #include <Eigen/Core>
 
@@ -22,6 +28,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "tudat/math/statistics/basicStatistics.h"
+#include "tudat/math/statistics/streamingStatistics.h"
 #include "tudat/basics/utilities.h"
 
 namespace tudat
@@ -206,6 +213,232 @@ BOOST_AUTO_TEST_CASE( testMovingAverage )
     }
 }
 
+//! Process communicator emulating a group of processes by threads, combining the data of all processes in order
+class ThreadProcessCommunicator: public utilities::ProcessCommunicator
+{
+public:
+
+    ThreadProcessCommunicator( const int numberOfProcesses, const int processIndex,
+                               std::vector< std::vector< double > >& processData, std::mutex& mutex,
+                               std::condition_variable& condition, int& numberOfWaitingProcesses, int& barrierGeneration ):
+        numberOfProcesses_( numberOfProcesses ), processIndex_( processIndex ), processData_( processData ), mutex_( mutex ),
+        condition_( condition ), numberOfWaitingProcesses_( numberOfWaitingProcesses ),
+        barrierGeneration_( barrierGeneration ){ }
+
+    int getProcessIndex( ){ return processIndex_; }
+
+    int getNumberOfProcesses( ){ return numberOfProcesses_; }
+
+    void sumOverProcesses( double* data, const int dataSize )
+    {
+        combineOverProcesses( data, dataSize, [ ]( const double a, const double b ){ return a + b; } );
+    }
+
+    void minimumOverProcesses( double* data, const int dataSize )
+    {
+        combineOverProcesses( data, dataSize, [ ]( const double a, const double b ){ return std::min( a, b ); } );
+    }
+
+    void maximumOverProcesses( double* data, const int dataSize )
+    {
+        combineOverProcesses( data, dataSize, [ ]( const double a, const double b ){ return std::max( a, b ); } );
+    }
+
+    void broadcastFromRootProcess( double* data, const int dataSize )
+    {
+        combineOverProcesses( data, dataSize, [ ]( const double a, const double ){ return a; } );
+    }
+
+private:
+
+    void waitForAllProcesses( )
+    {
+        std::unique_lock< std::mutex > lock( mutex_ );
+        int currentGeneration = barrierGeneration_;
+        if( ++numberOfWaitingProcesses_ == numberOfProcesses_ )
+        {
+            numberOfWaitingProcesses_ = 0;
+            barrierGeneration_++;
+            condition_.notify_all( );
+        }
+        else
+        {
+            condition_.wait( lock, [ & ]( ){ return barrierGeneration_ != currentGeneration; } );
+        }
+    }
+
+    void combineOverProcesses( double* data, const int dataSize, const std::function< double( double, double ) >& combine )
+    {
+        processData_[ processIndex_ ].assign( data, data + dataSize );
+        waitForAllProcesses( );
+        for( int i = 0; i < dataSize; i++ )
+        {
+            data[ i ] = processData_[ 0 ][ i ];
+            for( int j = 1; j < numberOfProcesses_; j++ )
+            {
+                data[ i ] = combine( data[ i ], processData_[ j ][ i ] );
+            }
+        }
+        waitForAllProcesses( );
+    }
+
+    int numberOfProcesses_;
+
+    int processIndex_;
+
+    std::vector< std::vector< double > >& processData_;
+
+    std::mutex& mutex_;
+
+    std::condition_variable& condition_;
+
+    int& numberOfWaitingProcesses_;
+
+    int& barrierGeneration_;
+};
+
+//! Test if streaming statistics reproduce the statistics of the full sample, also when merging partial statistics
+BOOST_AUTO_TEST_CASE( testStreamingSampleStatistics )
+{
+    // Create correlated samples (last entry with a large offset, for which a naive sum of squares would lose all precision)
+    std::mt19937 randomNumberGenerator( 42 );
+    std::normal_distribution< double > normalDistribution( 3.0, 2.0 );
+    const int numberOfSamples = 20000;
+    std::vector< Eigen::VectorXd > sampleData;
+    for( int i = 0; i < numberOfSamples; i++ )
+    {
+        Eigen::VectorXd sample = Eigen::VectorXd::Zero( 3 );
+        sample( 0 ) = normalDistribution( randomNumberGenerator );
+        sample( 1 ) = 0.5 * sample( 0 ) + normalDistribution( randomNumberGenerator );
+        sample( 2 ) = 1.0E6 + 1.0E-3 * normalDistribution( randomNumberGenerator );
+        sampleData.push_back( sample );
+    }
+
+    // Add all samples sequentially, and to three partial statistics that are merged afterwards
+    statistics::StreamingSampleStatistics sequentialStatistics;
+    std::vector< statistics::StreamingSampleStatistics > partialStatistics( 3 );
+    for( int i = 0; i < numberOfSamples; i++ )
+    {
+        sequentialStatistics.addSample( sampleData.at( i ) );
+        partialStatistics[ ( i < numberOfSamples / 10 ) ? 0 : ( 1 + i % 2 ) ].addSample( sampleData.at( i ) );
+    }
+    statistics::StreamingSampleStatistics mergedStatistics;
+    for( unsigned int i = 0; i < partialStatistics.size( ); i++ )
+    {
+        mergedStatistics.merge( partialStatistics.at( i ) );
+    }
+
+    // Compute reference statistics from full sample
+    Eigen::VectorXd expectedMean = statistics::computeSampleMean( sampleData );
+    Eigen::VectorXd expectedVariance = statistics::computeSampleVariance( sampleData );
+    Eigen::MatrixXd expectedCovariance = Eigen::MatrixXd::Zero( 3, 3 );
+    for( int i = 0; i < numberOfSamples; i++ )
+    {
+        expectedCovariance += ( sampleData.at( i ) - expectedMean ) * ( sampleData.at( i ) - expectedMean ).transpose( );
+    }
+    expectedCovariance /= static_cast< double >( numberOfSamples - 1 );
+
+    std::vector< statistics::StreamingSampleStatistics > statisticsToCheck = { sequentialStatistics, mergedStatistics };
+    for( unsigned int i = 0; i < statisticsToCheck.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( statisticsToCheck.at( i ).getNumberOfSamples( ), numberOfSamples );
+        BOOST_CHECK_EQUAL( statisticsToCheck.at( i ).getSampleSize( ), 3 );
+        for( int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_CLOSE_FRACTION( statisticsToCheck.at( i ).getMean( )( j ), expectedMean( j ), 1.0E-13 );
+            BOOST_CHECK_CLOSE_FRACTION( statisticsToCheck.at( i ).getVariance( )( j ), expectedVariance( j ), 1.0E-6 );
+            for( int k = 0; k < 3; k++ )
+            {
+                BOOST_CHECK_SMALL( statisticsToCheck.at( i ).getCovariance( )( j, k ) - expectedCovariance( j, k ),
+                                   1.0E-6 * std::sqrt( expectedVariance( j ) * expectedVariance( k ) ) );
+            }
+
+            // Check extreme values, and estimated quantiles against the exact quantiles of the full sample
+            std::vector< double > entryData;
+            for( int k = 0; k < numberOfSamples; k++ )
+            {
+                entryData.push_back( sampleData.at( k )( j ) );
+            }
+            std::sort( entryData.begin( ), entryData.end( ) );
+            BOOST_CHECK_EQUAL( statisticsToCheck.at( i ).getMinimum( )( j ), entryData.front( ) );
+            BOOST_CHECK_EQUAL( statisticsToCheck.at( i ).getMaximum( )( j ), entryData.back( ) );
+            BOOST_CHECK_EQUAL( statisticsToCheck.at( i ).getQuantile( j, 0.0 ), entryData.front( ) );
+            BOOST_CHECK_EQUAL( statisticsToCheck.at( i ).getQuantile( j, 1.0 ), entryData.back( ) );
+
+            std::vector< double > quantiles = { 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99 };
+            for( unsigned int k = 0; k < quantiles.size( ); k++ )
+            {
+                double expectedQuantile = entryData.at( static_cast< int >( quantiles.at( k ) * numberOfSamples ) );
+                BOOST_CHECK_SMALL( statisticsToCheck.at( i ).getQuantile( j, quantiles.at( k ) ) - expectedQuantile,
+                                   0.05 * std::sqrt( expectedVariance( j ) ) );
+            }
+        }
+    }
+
+    // Check that memory use is bounded by the compression of the quantile sketch
+    statistics::StreamingQuantileSketch quantileSketch( 100.0 );
+    for( int i = 0; i < numberOfSamples; i++ )
+    {
+        quantileSketch.addSample( sampleData.at( i )( 0 ) );
+    }
+    BOOST_CHECK( quantileSketch.getNumberOfCentroids( ) <= 100 );
+    BOOST_CHECK_EQUAL( quantileSketch.getNumberOfSamples( ), numberOfSamples );
+
+    // Check that samples of inconsistent size are rejected
+    bool isExceptionCaught = false;
+    try
+    {
+        sequentialStatistics.addSample( Eigen::VectorXd::Zero( 2 ) );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+
+    // Combine statistics over emulated processes (including a process without samples), and compare to local merge
+    const int numberOfProcesses = 4;
+    std::vector< std::vector< double > > processData( numberOfProcesses );
+    std::mutex mutex;
+    std::condition_variable condition;
+    int numberOfWaitingProcesses = 0;
+    int barrierGeneration = 0;
+    std::vector< statistics::StreamingSampleStatistics > processStatistics( numberOfProcesses );
+    std::vector< std::thread > processThreads;
+    for( int i = 0; i < numberOfProcesses; i++ )
+    {
+        processThreads.push_back( std::thread( [ &, i ]( )
+        {
+            std::shared_ptr< utilities::ProcessCommunicator > processCommunicator =
+                    std::make_shared< ThreadProcessCommunicator >(
+                        numberOfProcesses, i, processData, mutex, condition, numberOfWaitingProcesses, barrierGeneration );
+            if( i < static_cast< int >( partialStatistics.size( ) ) )
+            {
+                processStatistics[ i ] = partialStatistics.at( i );
+            }
+            processStatistics[ i ].mergeOverProcesses( processCommunicator );
+        } ) );
+    }
+    for( int i = 0; i < numberOfProcesses; i++ )
+    {
+        processThreads.at( i ).join( );
+    }
+
+    for( int i = 0; i < numberOfProcesses; i++ )
+    {
+        BOOST_CHECK_EQUAL( processStatistics.at( i ).getNumberOfSamples( ), numberOfSamples );
+        for( int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_EQUAL( processStatistics.at( i ).getMean( )( j ), mergedStatistics.getMean( )( j ) );
+            BOOST_CHECK_EQUAL( processStatistics.at( i ).getVariance( )( j ), mergedStatistics.getVariance( )( j ) );
+            BOOST_CHECK_EQUAL( processStatistics.at( i ).getMinimum( )( j ), mergedStatistics.getMinimum( )( j ) );
+            BOOST_CHECK_EQUAL( processStatistics.at( i ).getMaximum( )( j ), mergedStatistics.getMaximum( )( j ) );
+            BOOST_CHECK_SMALL( processStatistics.at( i ).getQuantile( j, 0.5 ) - mergedStatistics.getQuantile( j, 0.5 ),
+                               0.01 * std::sqrt( expectedVariance( j ) ) );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -591,6 +591,71 @@ BOOST_AUTO_TEST_CASE( testProbabilityFunctionsUncorrelated2D )
     }
 }
 
+//! Test batch evaluation, and approximate (tree-based) evaluation of pdf against exact evaluation
+BOOST_AUTO_TEST_CASE( testKernelDensityBatchAndApproximateEvaluation )
+{
+    using namespace tudat::statistics;
+
+    Eigen::VectorXd lowerBound( 3 ), upperBound( 3 );
+    lowerBound << -1.0, 0.0, 10.0;
+    upperBound << 1.0, 5.0, 12.0;
+    std::vector< Eigen::VectorXd > samples = generateRandomVectorUniform( 42, 5000, lowerBound, upperBound );
+    std::vector< Eigen::VectorXd > locations = generateRandomVectorUniform( 43, 200, lowerBound, upperBound );
+
+    Eigen::MatrixXd locationMatrix( 3, locations.size( ) );
+    for( unsigned int i = 0; i < locations.size( ); i++ )
+    {
+        locationMatrix.col( i ) = locations.at( i );
+    }
+
+    for( unsigned int kernelTest = 0; kernelTest < 2; kernelTest++ )
+    {
+        KernelType kernelType = ( kernelTest == 0 ) ? gaussian_kernel : epanechnikov_kernel;
+        KernelDensityDistribution distribution(
+                    samples, 1.0, kernelType, Eigen::VectorXd::Zero( 0 ), Eigen::VectorXd::Zero( 0 ), 4 );
+
+        // Check that batch evaluation (in parallel) is identical to evaluation per point
+        Eigen::VectorXd exactPdfs = distribution.evaluatePdfs( locationMatrix );
+        Eigen::VectorXd cdfs = distribution.evaluateCdfs( locationMatrix );
+        for( unsigned int i = 0; i < locations.size( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( exactPdfs( i ), distribution.evaluatePdf( locations.at( i ) ) );
+            BOOST_CHECK_EQUAL( cdfs( i ), distribution.evaluateCdf( locations.at( i ) ) );
+        }
+
+        // Check approximate evaluation against exact evaluation
+        const double pdfEvaluationTolerance = 1.0E-8;
+        distribution.setPdfEvaluationTolerance( pdfEvaluationTolerance );
+        Eigen::VectorXd approximatePdfs = distribution.evaluatePdfs( locationMatrix );
+
+        double maximumKernelPdf = 1.0;
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            maximumKernelPdf *= ( kernelTest == 0 ) ? 1.0 / ( std::sqrt( 2.0 * PI ) * distribution.getBandWidth( )( j ) ) :
+                                                      3.0 / ( 4.0 * distribution.getBandWidth( )( j ) );
+        }
+
+        for( unsigned int i = 0; i < locations.size( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( approximatePdfs( i ), distribution.evaluatePdf( locations.at( i ) ) );
+            BOOST_CHECK_SMALL( std::fabs( approximatePdfs( i ) - exactPdfs( i ) ),
+                               pdfEvaluationTolerance * maximumKernelPdf );
+            if( kernelTest == 1 )
+            {
+                BOOST_CHECK_SMALL( std::fabs( approximatePdfs( i ) - exactPdfs( i ) ),
+                                   1.0E-12 * exactPdfs.maxCoeff( ) );
+            }
+        }
+
+        // Check that tree is reset when changing bandwidth
+        Eigen::VectorXd newBandwidth = 2.0 * distribution.getBandWidth( );
+        distribution.setBandWidth( newBandwidth );
+        const double approximatePdf = distribution.evaluatePdf( locations.at( 0 ) );
+        distribution.setPdfEvaluationTolerance( 0.0 );
+        BOOST_CHECK_SMALL( std::fabs( approximatePdf - distribution.evaluatePdf( locations.at( 0 ) ) ),
+                           pdfEvaluationTolerance * maximumKernelPdf );
+    }
+}
 
 BOOST_AUTO_TEST_SUITE_END( )
 
@@ -127,6 +127,81 @@ BOOST_AUTO_TEST_CASE( test_randomVectorGaussian )
 }
 
 
+//! Test counter-based random number generator against known-answer values, and reproducibility of bulk sampling
+BOOST_AUTO_TEST_CASE( test_reproducibleRandomStreams )
+{
+    using namespace tudat::statistics;
+
+    // Known-answer tests of Philox4x32-10 (Salmon et al., 2011), for zero key/counter and for key/counter from digits of pi
+    {
+        PhiloxRandomNumberGenerator generator( 0, 0 );
+        BOOST_CHECK_EQUAL( generator( ), 0x6627e8d5u );
+        BOOST_CHECK_EQUAL( generator( ), 0xe169c58du );
+        BOOST_CHECK_EQUAL( generator( ), 0xbc57ac4cu );
+        BOOST_CHECK_EQUAL( generator( ), 0x9b00dbd8u );
+    }
+    {
+        PhiloxRandomNumberGenerator generator( 0x299f31d0a4093822u, 0x0370734413198a2eu );
+        for( unsigned int i = 0; i < 4; i++ )
+        {
+            generator.discard( 0x85a308d3243f6a88u );
+        }
+        BOOST_CHECK_EQUAL( generator( ), 0xd16cfe09u );
+        BOOST_CHECK_EQUAL( generator( ), 0x94fdccebu );
+        BOOST_CHECK_EQUAL( generator( ), 0x5001e420u );
+        BOOST_CHECK_EQUAL( generator( ), 0x24126ea1u );
+    }
+
+    // Check that discarding values is equivalent to generating them
+    {
+        PhiloxRandomNumberGenerator generator( 42, 3 );
+        PhiloxRandomNumberGenerator skippingGenerator( 42, 3 );
+        for( unsigned int i = 0; i < 11; i++ )
+        {
+            generator( );
+        }
+        skippingGenerator( );
+        skippingGenerator.discard( 10 );
+        BOOST_CHECK_EQUAL( generator( ), skippingGenerator( ) );
+    }
+
+    // Check that samples are bit-identical regardless of number of threads, and when generated in chunks
+    const int numberOfSamples = 10000;
+    const uint64_t seed = 511;
+    Eigen::MatrixXd serialSamples = Eigen::MatrixXd::Zero( 3, numberOfSamples );
+    Eigen::MatrixXd parallelSamples = Eigen::MatrixXd::Zero( 3, numberOfSamples );
+    fillGaussianRandomMatrix( serialSamples, seed, 1.0, 2.0, 1 );
+    fillGaussianRandomMatrix( parallelSamples, seed, 1.0, 2.0, 4 );
+
+    Eigen::MatrixXd chunkSamples = Eigen::MatrixXd::Zero( 3, numberOfSamples / 2 );
+    fillGaussianRandomMatrix( chunkSamples, seed, 1.0, 2.0, 3, numberOfSamples / 2 );
+
+    BOOST_CHECK( serialSamples == parallelSamples );
+    BOOST_CHECK( serialSamples.rightCols( numberOfSamples / 2 ) == chunkSamples );
+
+    // Check sample statistics
+    BOOST_CHECK_SMALL( std::fabs( serialSamples.mean( ) - 1.0 ), 5.0E-2 );
+    BOOST_CHECK_SMALL( std::fabs( std::sqrt( ( serialSamples.array( ) - serialSamples.mean( ) ).square( ).mean( ) ) - 2.0 ),
+                       5.0E-2 );
+
+    Eigen::MatrixXd uniformSamples = Eigen::MatrixXd::Zero( 2, numberOfSamples );
+    fillUniformRandomMatrix( uniformSamples, seed, -1.0, 3.0, 2 );
+    BOOST_CHECK( uniformSamples.minCoeff( ) >= -1.0 );
+    BOOST_CHECK( uniformSamples.maxCoeff( ) < 3.0 );
+    BOOST_CHECK_SMALL( std::fabs( uniformSamples.mean( ) - 1.0 ), 5.0E-2 );
+
+    // Check that stream-based generation from random variable generator is independent of call order
+    std::shared_ptr< RandomVariableGenerator< double > > randomVariableGenerator =
+            createBoostContinuousRandomVariableGenerator( normal_boost_distribution, { 0.0, 1.0 }, 511 );
+    std::shared_ptr< ContinuousRandomVariableGenerator > continuousRandomVariableGenerator =
+            std::dynamic_pointer_cast< ContinuousRandomVariableGenerator >( randomVariableGenerator );
+    const double thirdSample = continuousRandomVariableGenerator->getRandomVariableValueFromStream( 2 );
+    continuousRandomVariableGenerator->getRandomVariableValueFromStream( 0 );
+    continuousRandomVariableGenerator->getRandomVariableValue( );
+    BOOST_CHECK_EQUAL( continuousRandomVariableGenerator->getRandomVariableValueFromStream( 2 ), thirdSample );
+    BOOST_CHECK( continuousRandomVariableGenerator->getRandomVariableValueFromStream( 1 ) != thirdSample );
+}
+
 #if USE_GSL
 
 //! Test if Sobol sampler interface is working correctly. Note that this test is somewhat minimal, but the core of the
@@ -11,8 +11,10 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MAIN
 
+#include <fstream>
 #include <limits>
 
+#include <boost/filesystem.hpp>
 #include <boost/test/unit_test.hpp>
 
 
@@ -341,6 +343,42 @@ BOOST_AUTO_TEST_CASE( test_ephemerisSetup )
                     std::numeric_limits< double >::epsilon( ) );
     }
 
+    {
+        // Create bodies with direct Spice ephemerides, which are to be automatically pre-sampled
+        const double startTime = 1.0E7;
+        const double endTime = 1.0E7 + 10.0 * 86400.0;
+        BodyListSettings bodySettings = BodyListSettings( "Earth", "J2000" );
+        bodySettings.addSettings( "Moon" );
+        bodySettings.at( "Moon" )->ephemerisSettings = std::make_shared< DirectSpiceEphemerisSettings >( "Earth", "J2000" );
+        bodySettings.addSettings( "Vehicle" );
+        bodySettings.at( "Vehicle" )->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >(
+                    Eigen::Vector6d::Constant( 1.0 ), "Earth", "J2000" );
+        bodySettings.setSpiceEphemerisPreSampling( startTime, endTime, 1.0E-3, 1.0E-6 );
+        SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+
+        // Check that only Spice ephemeris is pre-sampled
+        std::shared_ptr< ephemerides::ChebyshevCartesianEphemeris > preSampledEphemeris =
+                std::dynamic_pointer_cast< ephemerides::ChebyshevCartesianEphemeris >( bodies.at( "Moon" )->getEphemeris( ) );
+        BOOST_CHECK( preSampledEphemeris != nullptr );
+        BOOST_CHECK( std::dynamic_pointer_cast< ephemerides::ConstantEphemeris >(
+                         bodies.at( "Vehicle" )->getEphemeris( ) ) != nullptr );
+        BOOST_CHECK_EQUAL( preSampledEphemeris->getReferenceFrameOrigin( ), "Earth" );
+        BOOST_CHECK_EQUAL( preSampledEphemeris->getReferenceFrameOrientation( ), "J2000" );
+        BOOST_CHECK_EQUAL( getSafeInterpolationInterval( preSampledEphemeris ).first, startTime );
+        BOOST_CHECK_EQUAL( getSafeInterpolationInterval( preSampledEphemeris ).second, endTime );
+
+        // Compare pre-sampled ephemeris against direct spice state
+        double currentTime = startTime;
+        while( currentTime <= endTime )
+        {
+            Eigen::Vector6d stateDifference = preSampledEphemeris->getCartesianState( currentTime ) -
+                    spice_interface::getBodyCartesianStateAtEpoch( "Moon", "Earth", "J2000", "None", currentTime );
+            BOOST_CHECK_SMALL( stateDifference.segment( 0, 3 ).norm( ), 1.0E-3 );
+            BOOST_CHECK_SMALL( stateDifference.segment( 3, 3 ).norm( ), 1.0E-6 );
+            currentTime += 3753.3;
+        }
+    }
+
 
 }
 
@@ -523,6 +561,249 @@ BOOST_AUTO_TEST_CASE( test_gravityFieldSetup )
 
 }
 
+//! Test reading of spherical harmonic gravity field files through the binary coefficient cache
+BOOST_AUTO_TEST_CASE( test_gravityFieldFileCache )
+{
+    // Write small gravity field text file, with header
+    boost::filesystem::path testDirectory = boost::filesystem::temp_directory_path( ) /
+            boost::filesystem::unique_path( "tudat_gravity_cache_%%%%-%%%%" );
+    boost::filesystem::create_directories( testDirectory );
+    std::string textFile = ( testDirectory / "testField.txt" ).string( );
+    {
+        std::ofstream textStream( textFile );
+        textStream << "3.986004415E14, 6378136.3, 4, 4, 1, 0.0" << std::endl;
+        for( int n = 0; n <= 4; n++ )
+        {
+            for( int m = 0; m <= n; m++ )
+            {
+                textStream << n << ", " << m << ", " << 1.0E-6 * ( n + 0.1 * m ) << ", "
+                           << ( m > 0 ? -1.0E-7 * ( n + 0.2 * m ) : 0.0 ) << ", 0.0, 0.0" << std::endl;
+            }
+        }
+    }
+
+    // Read file directly, and through the cache (creating and reusing it), for different degrees and orders
+    for( int test = 0; test < 3; test++ )
+    {
+        int maximumDegree = ( test == 0 ) ? 4 : 3;
+        int maximumOrder = ( test == 2 ) ? 1 : maximumDegree;
+
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > textCoefficients, cachedCoefficients;
+        std::pair< double, double > textReferenceData = readGravityFieldFile(
+                    textFile, maximumDegree, maximumOrder, textCoefficients, 0, 1, false );
+        std::pair< double, double > cachedReferenceData = readGravityFieldFile(
+                    textFile, maximumDegree, maximumOrder, cachedCoefficients, 0, 1, true );
+        BOOST_CHECK( boost::filesystem::exists( getGravityFieldCacheFileName( textFile, true ) ) );
+
+        BOOST_CHECK_EQUAL( textReferenceData.first, 3.986004415E14 );
+        BOOST_CHECK_EQUAL( textReferenceData.second, 6378136.3 );
+        BOOST_CHECK_EQUAL( cachedReferenceData.first, textReferenceData.first );
+        BOOST_CHECK_EQUAL( cachedReferenceData.second, textReferenceData.second );
+
+        BOOST_CHECK_EQUAL( cachedCoefficients.first.rows( ), maximumDegree + 1 );
+        BOOST_CHECK_EQUAL( cachedCoefficients.first.cols( ), maximumOrder + 1 );
+        BOOST_CHECK_EQUAL( textCoefficients.first.rows( ), maximumDegree + 1 );
+        BOOST_CHECK_EQUAL( textCoefficients.first.cols( ), maximumOrder + 1 );
+        for( int n = 0; n <= maximumDegree; n++ )
+        {
+            for( int m = 0; m <= maximumOrder; m++ )
+            {
+                BOOST_CHECK_EQUAL( cachedCoefficients.first( n, m ), textCoefficients.first( n, m ) );
+                BOOST_CHECK_EQUAL( cachedCoefficients.second( n, m ), textCoefficients.second( n, m ) );
+            }
+        }
+        BOOST_CHECK_EQUAL( cachedCoefficients.first( 0, 0 ), 1.0 );
+        BOOST_CHECK_CLOSE_FRACTION( cachedCoefficients.first( 3, 1 ), 3.1E-6, 1.0E-15 );
+    }
+
+    // Check that a modified text file, and a corrupted cache, are detected, and the cache regenerated
+    std::string cacheFile = getGravityFieldCacheFileName( textFile, true );
+    {
+        std::ofstream textStream( textFile, std::ios::app );
+        textStream << "5, 0, 2.5E-6, 0.0, 0.0, 0.0" << std::endl;
+    }
+    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > coefficients;
+    readGravityFieldFile( textFile, 5, 5, coefficients, 0, 1, true );
+    BOOST_CHECK_EQUAL( coefficients.first( 5, 0 ), 2.5E-6 );
+    BOOST_CHECK_EQUAL( input_output::loadBinaryGravityFieldFile( cacheFile )->getMaximumDegree( ), 5 );
+
+    {
+        std::fstream cacheStream( cacheFile, std::ios::in | std::ios::out | std::ios::binary );
+        cacheStream.seekp( 16 );
+        uint32_t invalidDegree = 1000;
+        cacheStream.write( reinterpret_cast< const char* >( &invalidDegree ), sizeof( uint32_t ) );
+    }
+    input_output::unloadBinaryGravityFieldFile( cacheFile );
+    BOOST_CHECK_THROW( input_output::BinaryGravityFieldFile{ cacheFile }, std::runtime_error );
+    readGravityFieldFile( textFile, 5, 5, coefficients, 0, 1, true );
+    BOOST_CHECK_EQUAL( coefficients.first( 5, 0 ), 2.5E-6 );
+    BOOST_CHECK_EQUAL( input_output::loadBinaryGravityFieldFile( cacheFile )->getMaximumDegree( ), 5 );
+
+    boost::filesystem::remove_all( testDirectory );
+}
+
+//! Test reading of spherical harmonic gravity field files for which the binary coefficient cache cannot be written
+BOOST_AUTO_TEST_CASE( test_gravityFieldFileCacheWriteFailure )
+{
+    // Write small gravity field text files, with header
+    boost::filesystem::path testDirectory = boost::filesystem::temp_directory_path( ) /
+            boost::filesystem::unique_path( "tudat_gravity_cache_failure_%%%%-%%%%" );
+    boost::filesystem::create_directories( testDirectory );
+    std::vector< std::string > textFiles =
+    { ( testDirectory / "readOnlyField.txt" ).string( ), ( testDirectory / "blockedField.txt" ).string( ) };
+    for( const std::string& textFile : textFiles )
+    {
+        std::ofstream textStream( textFile );
+        textStream << "3.986004415E14, 6378136.3, 4, 4, 1, 0.0" << std::endl;
+        for( int n = 0; n <= 4; n++ )
+        {
+            for( int m = 0; m <= n; m++ )
+            {
+                textStream << n << ", " << m << ", " << 1.0E-6 * ( n + 0.1 * m ) << ", "
+                           << ( m > 0 ? -1.0E-7 * ( n + 0.2 * m ) : 0.0 ) << ", 0.0, 0.0" << std::endl;
+            }
+        }
+    }
+
+    // Make directory read-only, and check whether it is (not the case when running with elevated privileges)
+    boost::filesystem::permissions( testDirectory, boost::filesystem::owner_read | boost::filesystem::owner_exe );
+    boost::filesystem::path writeTestFile = testDirectory / "writeTest";
+    bool isDirectoryReadOnly = !std::ofstream( writeTestFile.string( ) );
+    boost::system::error_code errorCode;
+    boost::filesystem::remove( writeTestFile, errorCode );
+
+    // Block writing of the cache of the second file by a directory with the name of the cache file
+    std::string blockedCacheFile = getGravityFieldCacheFileName( textFiles.at( 1 ), true );
+    if( !isDirectoryReadOnly )
+    {
+        boost::filesystem::create_directory( blockedCacheFile );
+    }
+
+    // Read files (repeatedly) through the cache, and check that the coefficients are read from the text files
+    for( unsigned int i = 0; i < textFiles.size( ); i++ )
+    {
+        for( int test = 0; test < 2; test++ )
+        {
+            std::pair< Eigen::MatrixXd, Eigen::MatrixXd > textCoefficients, cachedCoefficients;
+            readGravityFieldFile( textFiles.at( i ), 3, 2, textCoefficients, 0, 1, false );
+            std::pair< double, double > cachedReferenceData = readGravityFieldFile(
+                        textFiles.at( i ), 3, 2, cachedCoefficients, 0, 1, true );
+            BOOST_CHECK_EQUAL( cachedReferenceData.first, 3.986004415E14 );
+            BOOST_CHECK_EQUAL( cachedReferenceData.second, 6378136.3 );
+            BOOST_CHECK( cachedCoefficients.first == textCoefficients.first );
+            BOOST_CHECK( cachedCoefficients.second == textCoefficients.second );
+            BOOST_CHECK_EQUAL( cachedCoefficients.first.rows( ), 4 );
+            BOOST_CHECK_EQUAL( cachedCoefficients.first.cols( ), 3 );
+        }
+        if( i == 1 || isDirectoryReadOnly )
+        {
+            BOOST_CHECK( loadGravityFieldCacheFile( textFiles.at( i ), true ) == nullptr );
+        }
+    }
+    if( isDirectoryReadOnly )
+    {
+        BOOST_CHECK( !boost::filesystem::exists( getGravityFieldCacheFileName( textFiles.at( 0 ), true ) ) );
+    }
+
+    // Check that writing the cache is not attempted again once it is no longer blocked, and that no temporary
+    // files are left behind
+    boost::filesystem::permissions( testDirectory, boost::filesystem::owner_all );
+    boost::filesystem::remove( blockedCacheFile, errorCode );
+    BOOST_CHECK( loadGravityFieldCacheFile( textFiles.at( 1 ), true ) == nullptr );
+    BOOST_CHECK( !boost::filesystem::exists( blockedCacheFile ) );
+    for( boost::filesystem::directory_iterator fileIterator( testDirectory );
+         fileIterator != boost::filesystem::directory_iterator( ); fileIterator++ )
+    {
+        BOOST_CHECK( fileIterator->path( ).extension( ).string( ) != ".tmp" );
+    }
+
+    boost::filesystem::remove_all( testDirectory );
+}
+
+BOOST_AUTO_TEST_CASE( test_gravityFieldCoefficientsSharing )
+{
+    // Write small gravity field text file, with header
+    boost::filesystem::path testDirectory = boost::filesystem::temp_directory_path( ) /
+            boost::filesystem::unique_path( "tudat_gravity_sharing_%%%%-%%%%" );
+    boost::filesystem::create_directories( testDirectory );
+    std::string textFile = ( testDirectory / "testField.txt" ).string( );
+    {
+        std::ofstream textStream( textFile );
+        textStream << "3.986004415E14, 6378136.3, 4, 4, 1, 0.0" << std::endl;
+        for( int n = 0; n <= 4; n++ )
+        {
+            for( int m = 0; m <= n; m++ )
+            {
+                textStream << n << ", " << m << ", " << 1.0E-6 * ( n + 0.1 * m ) << ", "
+                           << ( m > 0 ? -1.0E-7 * ( n + 0.2 * m ) : 0.0 ) << ", 0.0, 0.0" << std::endl;
+            }
+        }
+    }
+
+    // Create settings from the same file twice, and check that the coefficients are read once, and shared
+    std::shared_ptr< FromFileSphericalHarmonicsGravityFieldSettings > firstSettings =
+            std::make_shared< FromFileSphericalHarmonicsGravityFieldSettings >( textFile, "IAU_Earth", 4, 4, 0, 1 );
+    std::shared_ptr< FromFileSphericalHarmonicsGravityFieldSettings > secondSettings =
+            std::make_shared< FromFileSphericalHarmonicsGravityFieldSettings >( textFile, "IAU_Earth", 4, 4, 0, 1 );
+    BOOST_CHECK( firstSettings->getSharedCosineCoefficients( ).sharesStorageWith(
+                     secondSettings->getSharedCosineCoefficients( ) ) );
+    BOOST_CHECK( firstSettings->getSharedSineCoefficients( ).sharesStorageWith(
+                     secondSettings->getSharedSineCoefficients( ) ) );
+    BOOST_CHECK_EQUAL( secondSettings->getGravitationalParameter( ), 3.986004415E14 );
+    BOOST_CHECK_EQUAL( secondSettings->getReferenceRadius( ), 6378136.3 );
+
+    // Settings with different degree/order are read separately
+    std::shared_ptr< FromFileSphericalHarmonicsGravityFieldSettings > truncatedSettings =
+            std::make_shared< FromFileSphericalHarmonicsGravityFieldSettings >( textFile, "IAU_Earth", 3, 3, 0, 1 );
+    BOOST_CHECK( !firstSettings->getSharedCosineCoefficients( ).sharesStorageWith(
+                     truncatedSettings->getSharedCosineCoefficients( ) ) );
+    BOOST_CHECK_EQUAL( truncatedSettings->getCosineCoefficients( ).rows( ), 4 );
+
+    // Check that gravity field models created from the settings share the coefficients as well
+    SystemOfBodies bodies;
+    std::shared_ptr< gravitation::SphericalHarmonicsGravityField > gravityField =
+            std::dynamic_pointer_cast< gravitation::SphericalHarmonicsGravityField >(
+                createGravityFieldModel( secondSettings, "Earth", bodies ) );
+    BOOST_CHECK( gravityField->getSharedCosineCoefficients( ).sharesStorageWith(
+                     firstSettings->getSharedCosineCoefficients( ) ) );
+
+    // Check that modifying the coefficients of one of the settings does not modify the others
+    Eigen::MatrixXd modifiedCosineCoefficients = firstSettings->getCosineCoefficients( );
+    modifiedCosineCoefficients( 2, 0 ) = 1.0E-3;
+    firstSettings->resetCosineCoefficients( modifiedCosineCoefficients );
+    BOOST_CHECK_EQUAL( firstSettings->getCosineCoefficients( )( 2, 0 ), 1.0E-3 );
+    BOOST_CHECK_CLOSE_FRACTION( secondSettings->getCosineCoefficients( )( 2, 0 ), 2.0E-6, 1.0E-15 );
+    BOOST_CHECK_CLOSE_FRACTION( gravityField->getCosineCoefficients( )( 2, 0 ), 2.0E-6, 1.0E-15 );
+
+    std::shared_ptr< FromFileSphericalHarmonicsGravityFieldSettings > thirdSettings =
+            std::make_shared< FromFileSphericalHarmonicsGravityFieldSettings >( textFile, "IAU_Earth", 4, 4, 0, 1 );
+    BOOST_CHECK( thirdSettings->getSharedCosineCoefficients( ).sharesStorageWith(
+                     secondSettings->getSharedCosineCoefficients( ) ) );
+    BOOST_CHECK_CLOSE_FRACTION( thirdSettings->getCosineCoefficients( )( 2, 0 ), 2.0E-6, 1.0E-15 );
+
+    // Check that a modified file is read again
+    {
+        std::ofstream textStream( textFile, std::ios::app );
+        textStream << "4, 4, 5.0E-6, 0.0, 0.0, 0.0" << std::endl;
+    }
+    std::shared_ptr< FromFileSphericalHarmonicsGravityFieldSettings > modifiedFileSettings =
+            std::make_shared< FromFileSphericalHarmonicsGravityFieldSettings >( textFile, "IAU_Earth", 4, 4, 0, 1 );
+    BOOST_CHECK( !modifiedFileSettings->getSharedCosineCoefficients( ).sharesStorageWith(
+                     secondSettings->getSharedCosineCoefficients( ) ) );
+    BOOST_CHECK_EQUAL( modifiedFileSettings->getCosineCoefficients( )( 4, 4 ), 5.0E-6 );
+
+    // Check that clearing the cache does not affect existing settings
+    clearGravityFieldCoefficientsCache( );
+    std::shared_ptr< FromFileSphericalHarmonicsGravityFieldSettings > reloadedSettings =
+            std::make_shared< FromFileSphericalHarmonicsGravityFieldSettings >( textFile, "IAU_Earth", 4, 4, 0, 1 );
+    BOOST_CHECK( !modifiedFileSettings->getSharedCosineCoefficients( ).sharesStorageWith(
+                     reloadedSettings->getSharedCosineCoefficients( ) ) );
+    BOOST_CHECK_EQUAL( modifiedFileSettings->getCosineCoefficients( )( 4, 4 ), 5.0E-6 );
+    BOOST_CHECK_EQUAL( reloadedSettings->getCosineCoefficients( )( 4, 4 ), 5.0E-6 );
+
+    boost::filesystem::remove_all( testDirectory );
+}
+
 //! Test set up of polyhedron gravity field model
 BOOST_AUTO_TEST_CASE( test_polyhedronGravityFieldSetup )
 {
@@ -2075,7 +2356,42 @@ BOOST_AUTO_TEST_CASE( test_flightConditionsSetup )
                 vehicleFlightConditions->getCurrentBodyCenteredBodyFixedState( ),vehicleBodyFixedState,
                 ( 2.0 * std::numeric_limits< double >::epsilon( ) ) );
 
+    // Check that, with demand-driven updates, body orientation angles are only updated if declared as required
+    vehicleFlightConditions->setUseDemandDrivenUpdates( true );
+    BOOST_CHECK( !vehicleFlightConditions->isComponentUpdated( aerodynamics::body_orientation_angles_update ) );
+    BOOST_CHECK( !vehicleFlightConditions->isComponentUpdated( aerodynamics::aerodynamic_coefficients_update ) );
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        if( test == 1 )
+        {
+            vehicleFlightConditions->addRequiredUpdateComponent( aerodynamics::body_orientation_angles_update );
+            BOOST_CHECK( vehicleFlightConditions->isComponentUpdated( aerodynamics::body_orientation_angles_update ) );
+        }
+
+        vehicleFlightConditions->resetCurrentTime( );
+        vehicleFlightConditions->updateConditions( testTime );
+
+        BOOST_CHECK_SMALL(
+                    std::fabs( vehicleFlightConditions->getAerodynamicAngleCalculator( )
+                               ->getAerodynamicAngle( heading_angle ) - testHeadingAngle),
+                    10.0 * std::numeric_limits< double >::epsilon( ) );
+        BOOST_CHECK_SMALL(
+                    std::fabs( vehicleFlightConditions->getAerodynamicAngleCalculator( )
+                               ->getAerodynamicAngle( angle_of_attack ) - ( ( test == 0 ) ? 0.0 : angleOfAttack ) ),
+                    10.0 * std::numeric_limits< double >::epsilon( ) );
+        BOOST_CHECK_SMALL(
+                    std::fabs( vehicleFlightConditions->getAerodynamicAngleCalculator( )
+                               ->getAerodynamicAngle( bank_angle ) - ( ( test == 0 ) ? 0.0 : bankAngle ) ),
+                    10.0 * std::numeric_limits< double >::epsilon( ) );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    vehicleFlightConditions->getCurrentBodyCenteredBodyFixedState( ),vehicleBodyFixedState,
+                    ( 2.0 * std::numeric_limits< double >::epsilon( ) ) );
+    }
 
+    // Check that all components are updated without demand-driven updates
+    vehicleFlightConditions->setUseDemandDrivenUpdates( false );
+    BOOST_CHECK( vehicleFlightConditions->isComponentUpdated( aerodynamics::aerodynamic_coefficients_update ) );
+    BOOST_CHECK( vehicleFlightConditions->isComponentUpdated( aerodynamics::body_orientation_angles_update ) );
 }
 
 
@@ -2399,6 +2715,51 @@ BOOST_AUTO_TEST_CASE( test_panelledRadiationPressureInterfaceSetup )
 
 }
 
+//! Test if bodies created in parallel, and with atmosphere models created on first use, are identical to those created
+//! serially
+BOOST_AUTO_TEST_CASE( test_parallelAndOnFirstUseBodyCreation )
+{
+    // Create settings for a number of bodies with independent models
+    BodyListSettings bodySettings = BodyListSettings( "SSB", "ECLIPJ2000" );
+    for( int i = 0; i < 8; i++ )
+    {
+        std::string bodyName = "Body" + std::to_string( i );
+        bodySettings.addSettings( bodyName );
+        bodySettings.at( bodyName )->ephemerisSettings = constantEphemerisSettings(
+                    Eigen::Vector6d::Constant( 1.0E6 * ( i + 1 ) ), "SSB" );
+        bodySettings.at( bodyName )->gravityFieldSettings = centralGravitySettings( 1.0E12 * ( i + 1 ) );
+        bodySettings.at( bodyName )->shapeModelSettings = sphericalBodyShapeSettings( 1.0E5 * ( i + 1 ) );
+        bodySettings.at( bodyName )->atmosphereSettings = exponentialAtmosphereSettings(
+                    8.0E3, 1.0 + 0.1 * i, 270.0, 287.1 );
+    }
+    SystemOfBodies serialBodies = createSystemOfBodies( bodySettings );
+
+    bodySettings.setNumberOfThreadsForModelCreation( 4 );
+    bodySettings.setCreateModelsOnFirstUse( true );
+    SystemOfBodies parallelBodies = createSystemOfBodies( bodySettings );
+
+    for( int i = 0; i < 8; i++ )
+    {
+        std::string bodyName = "Body" + std::to_string( i );
+        std::shared_ptr< Body > serialBody = serialBodies.at( bodyName );
+        std::shared_ptr< Body > parallelBody = parallelBodies.at( bodyName );
+
+        BOOST_CHECK_EQUAL( serialBody->getEphemeris( )->getCartesianState( 0.0 )( 0 ),
+                           parallelBody->getEphemeris( )->getCartesianState( 0.0 )( 0 ) );
+        BOOST_CHECK_EQUAL( serialBody->getGravitationalParameter( ), parallelBody->getGravitationalParameter( ) );
+        BOOST_CHECK_EQUAL( serialBody->getShapeModel( )->getAverageRadius( ),
+                           parallelBody->getShapeModel( )->getAverageRadius( ) );
+
+        // Check that atmosphere model is created only when retrieved
+        BOOST_CHECK( !serialBody->isAtmosphereModelCreationPending( ) );
+        BOOST_CHECK( parallelBody->isAtmosphereModelCreationPending( ) );
+        std::shared_ptr< aerodynamics::AtmosphereModel > atmosphereModel = parallelBody->getAtmosphereModel( );
+        BOOST_CHECK( !parallelBody->isAtmosphereModelCreationPending( ) );
+        BOOST_CHECK( atmosphereModel == parallelBody->getAtmosphereModel( ) );
+        BOOST_CHECK_EQUAL( serialBody->getAtmosphereModel( )->getDensity( 1.0E4, 0.0, 0.0, 0.0 ),
+                           atmosphereModel->getDensity( 1.0E4, 0.0, 0.0, 0.0 ) );
+    }
+}
 
 BOOST_AUTO_TEST_SUITE_END( )
 
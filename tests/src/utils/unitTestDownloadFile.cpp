@@ -0,0 +1,113 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      NIST, FIPS 180-4: Secure Hash Standard, 2015.
+ *      NIST, SHA-256 example values, https://csrc.nist.gov/projects/cryptographic-standards-and-guidelines/example-values
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <tudat/utils/data/downloadFile.h>
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+//! Function to write a string to a (binary) file
+void writeTestFile( const boost::filesystem::path& filePath, const std::string& contents )
+{
+    std::ofstream fileStream( filePath.string( ), std::ios::binary );
+    fileStream << contents;
+}
+
+//! Function to read the full contents of a (binary) file
+std::string readTestFile( const std::string& fileName )
+{
+    std::ifstream fileStream( fileName, std::ios::binary );
+    return std::string( std::istreambuf_iterator< char >( fileStream ), std::istreambuf_iterator< char >( ) );
+}
+
+BOOST_AUTO_TEST_SUITE( test_download_file )
+
+//! Test SHA-256 checksums of files against the FIPS 180-4 test vectors
+BOOST_AUTO_TEST_CASE( testSha256Checksum )
+{
+    boost::filesystem::path testDirectory = boost::filesystem::temp_directory_path( ) /
+            boost::filesystem::unique_path( "tudat_sha256_%%%%-%%%%" );
+    boost::filesystem::create_directories( testDirectory );
+    boost::filesystem::path testFile = testDirectory / "message.txt";
+
+    // Empty message, single block messages, and messages spanning two blocks
+    std::vector< std::pair< std::string, std::string > > testVectors =
+    {
+        { "", "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855" },
+        { "abc", "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" },
+        { "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+          "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1" },
+        { "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmn"
+          "hijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu",
+          "cf5b16a778af8380036ce59e7b0492370b249b11e8f07a51afac45037afee9d1" }
+    };
+    for( unsigned int i = 0; i < testVectors.size( ); i++ )
+    {
+        writeTestFile( testFile, testVectors.at( i ).first );
+        BOOST_CHECK_EQUAL( utils::data::compute_sha256( testFile.string( ) ), testVectors.at( i ).second );
+    }
+
+    // Message of one million times 'a', spanning many blocks
+    writeTestFile( testFile, std::string( 1000000, 'a' ) );
+    BOOST_CHECK_EQUAL( utils::data::compute_sha256( testFile.string( ) ),
+                       "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0" );
+
+    boost::filesystem::remove_all( testDirectory );
+}
+
+//! Test if a file with a given checksum is retrieved from the content-addressed cache, without downloading it
+BOOST_AUTO_TEST_CASE( testContentAddressedCache )
+{
+    boost::filesystem::path prefix = boost::filesystem::temp_directory_path( ) /
+            boost::filesystem::unique_path( "tudat_download_%%%%-%%%%" );
+    boost::filesystem::create_directories( prefix / ".content" );
+
+    // Store file in content-addressed cache only
+    std::string fileContents = "abc";
+    std::string checksum = "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad";
+    writeTestFile( prefix / ".content" / checksum, fileContents );
+
+    // Request file from an unreachable URL (with upper case checksum), and check that it is copied from the cache
+    std::string upperCaseChecksum = "BA7816BF8F01CFEA414140DE5DAE2223B00361A396177A9CB410FF61F20015AD";
+    for( int test = 0; test < 2; test++ )
+    {
+        std::string downloadedFile = utils::data::download_file(
+                    "https://tudat.invalid/data/testFile.txt", "true", 0, true, prefix.string( ).c_str( ),
+                    upperCaseChecksum.c_str( ) );
+        BOOST_CHECK_EQUAL( downloadedFile, ( prefix / "testFile.txt" ).string( ) );
+        BOOST_CHECK_EQUAL( readTestFile( downloadedFile ), fileContents );
+    }
+
+    boost::filesystem::remove_all( prefix );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat